@@ -0,0 +1,26 @@
+// collatz_steps(837799) walks 524 steps of the Collatz sequence, and
+// main() calls it with that literal 2M times. consteval runs the call once
+// at compile time, which leaves a loop adding 524 to the total.
+
+int collatz_steps(long n) {
+    int steps = 0;
+    while (n != 1) {
+        if (n - n / 2 * 2 == 0) {
+            n = n / 2;
+        } else {
+            n = 3 * n + 1;
+        }
+        steps = steps + 1;
+    }
+    return steps;
+}
+
+int main() {
+    long total = 0;
+    int i = 0;
+    while (i < 2000000) {
+        total = total + collatz_steps(837799);
+        i = i + 1;
+    }
+    return total - total / 256 * 256;
+}
\ No newline at end of file
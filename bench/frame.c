@@ -0,0 +1,26 @@
+// walk() calls mix() 60M times, and on every call but the first x is
+// negative, so mix() returns at its first line. mix() is too large to
+// inline. Shrink-wrapped, that early return is taken before mix() sets up
+// its frame or saves a register.
+
+int mix(int x, int y) {
+    if (x < 0) { return y; }
+    int a = x * 3 + y;
+    int b = a * a - x;
+    int c = b / 7 + a * 5 - y;
+    int d = c * c - b * 3 + a;
+    int e = d / 11 + c - b * a;
+    int f = e * 3 - d + c / 5;
+    int g = f + e - d * 2 + c - b + a;
+    return g / 13 + f - e / 3;
+}
+
+int walk(int n, int acc) {
+    if (n == 0) { return acc; }
+    return walk(n - 1, mix(n - 60000000, acc));
+}
+
+int main() {
+    int t = walk(60000000, 1);
+    return t - t / 256 * 256;
+}
\ No newline at end of file
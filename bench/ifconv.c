@@ -0,0 +1,24 @@
+// count() walks an LCG and adds to a total when the state's bit 16 is
+// clear: a loop branch that is always predicted around an if that goes
+// either way at random. As a cmov the if costs the same on every trip; as
+// a branch it mispredicts about half the time.
+
+int count(int n) {
+    int seed = 12345;
+    int total = 0;
+    int i = 0;
+    while (i < n) {
+        seed = seed * 1103515245 + 12345;
+        int r = seed / 65536;
+        if (r - r / 2 * 2 == 0) {
+            total = total + 3;
+        }
+        i = i + 1;
+    }
+    return total;
+}
+
+int main() {
+    int total = count(100000000);
+    return total - total / 256 * 256;
+}
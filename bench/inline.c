@@ -0,0 +1,28 @@
+// mix() is two calls to sq() and one to clamp(), and main() calls it 100M
+// times. Inlined, the three bodies merge into the loop and the argument
+// copies, pushes and returns disappear.
+
+int sq(int x) {
+    return x * x;
+}
+
+int clamp(int v, int lo, int hi) {
+    if (v < lo) { return lo; }
+    if (v > hi) { return hi; }
+    return v;
+}
+
+int mix(int a, int b) {
+    return clamp(sq(a) - sq(b), 0, 1000);
+}
+
+int main() {
+    int acc = 0;
+    for (int round = 0; round < 100; round = round + 1) {
+        for (int i = 0; i < 1000000; i = i + 1) {
+            acc = acc + mix(i - (i / 64) * 64, 7);
+        }
+        acc = acc - (acc / 65536) * 65536;
+    }
+    return acc - (acc / 256) * 256;
+}
@@ -0,0 +1,26 @@
+// kernel() checks mode on every trip and uses step as a multiplier or a
+// divisor. main() calls it with three different pairs of literals, so
+// ipcp gives each call its own copy. Each copy keeps one arm of the if,
+// and the multiply by a step of 1 folds away.
+
+int kernel(int mode, int step, int n) {
+    int total = 0;
+    int i = 0;
+    while (i < n) {
+        if (mode == 0) {
+            total = total + i * step;
+        } else {
+            if (mode == 1) {
+                total = total - i / step;
+            } else {
+                total = total + step;
+            }
+        }
+        i = i + 1;
+    }
+    return total;
+}
+
+int main() {
+    return kernel(0, 1, 100000000) + kernel(1, 4, 100000000) - kernel(2, 1, 100000000);
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+// weigh() adds up i * 12345 over about a million trips, and main() calls
+// it 200 times. Unrolled, each compare and branch covers several trips,
+// and strength reduction turns the imul into adding 12345 to a running
+// product.
+
+long weigh(int n) {
+    long total = 0;
+    int i = 0;
+    while (i < n) {
+        total = total + i * 12345L;
+        i = i + 1;
+    }
+    return total;
+}
+
+int main() {
+    long result = 0;
+    int round = 0;
+    while (round < 200) {
+        result = result + weigh(1000000 - round);
+        round = round + 1;
+    }
+    return result - result / 256 * 256;
+}
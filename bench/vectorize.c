@@ -0,0 +1,38 @@
+// Each of 20000 rounds computes z = x * scale + y over 4096 ints, then
+// the sum and the maximum of z: a map, a sum and a max, the three loop
+// shapes the pass handles. Vectorized, each trip covers 4 elements, or 8
+// with -march=x86-64-v3.
+
+int x[4096];
+int y[4096];
+int z[4096];
+
+int main() {
+    int i;
+    for (i = 0; i < 4096; i = i + 1) {
+        x[i] = i;
+    }
+    for (i = 0; i < 4096; i = i + 1) {
+        y[i] = 4096 - i;
+    }
+
+    int total = 0;
+    int largest = 0;
+    int round = 0;
+    while (round < 20000) {
+        int scale = round - round / 8 * 8;
+        for (i = 0; i < 4096; i = i + 1) {
+            z[i] = x[i] * scale + y[i];
+        }
+        for (i = 0; i < 4096; i = i + 1) {
+            total = total + z[i];
+        }
+        for (i = 0; i < 4096; i = i + 1) {
+            if (z[i] > largest) {
+                largest = z[i];
+            }
+        }
+        round = round + 1;
+    }
+    return total + largest - (total + largest) / 256 * 256;
+}
\ No newline at end of file
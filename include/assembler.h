@@ -0,0 +1,69 @@
+#ifndef ASSEMBLER_H
+#define ASSEMBLER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <insn.h>
+
+#define ASSEMBLER_ERROR_SIZE 512
+
+typedef struct {
+    char *name;
+    unsigned type;           // SHT_PROGBITS, or SHT_NOBITS for .bss
+    unsigned long flags;     // SHF_ALLOC, SHF_WRITE, SHF_EXECINSTR, SHF_MERGE, SHF_STRINGS
+    unsigned long entsize;   // Of the entries of a mergeable section
+    unsigned long align;
+    unsigned char *data;     // NULL for SHT_NOBITS
+    size_t size;
+    int symbol;              // Section symbol, for relocations against it
+} AsmSection;
+
+typedef struct {
+    char *name;
+    int section;             // Defining section, or -1 if undefined
+    unsigned long value;     // Offset in the section
+    unsigned long size;
+    unsigned char type;      // STT_NOTYPE, STT_FUNC, STT_OBJECT or STT_SECTION
+    bool global;
+    bool referenced;         // By a relocation
+} AsmSymbol;
+
+typedef struct {
+    int section;             // Section the relocation patches
+    unsigned long offset;
+    unsigned type;           // R_X86_64_PC32, R_X86_64_PLT32, R_X86_64_32 or R_X86_64_64
+    int symbol;
+    long addend;
+} AsmRelocation;
+
+// An assembled program: machine code and data by section, and what is
+// left for the linker
+typedef struct {
+    AsmSection *sections;
+    int section_count;
+    AsmSymbol *symbols;
+    int symbol_count;
+    AsmRelocation *relocations;
+    int relocation_count;
+} Assembly;
+
+// Assemble the live lines of code, as GNU as would: jumps within a section
+// take the short form when their target is in reach, and references to
+// symbols are resolved in place or left as relocations by the same rules,
+// so that the sections come out byte for byte the same. Returns NULL, with
+// a message in error, for anything it cannot assemble.
+Assembly *assemble(InsnList *code, char *error, size_t error_size);
+void assembly_free(Assembly *assembly);
+
+// Symbol index of name, or -1
+int assembly_find_symbol(const Assembly *assembly, const char *name);
+
+// Apply every relocation, with each section loaded at addresses[section]
+// and each undefined symbol at resolve(name, context); resolve may be NULL
+// if there are none. Returns false, with a message in error, if a symbol
+// is unresolved or a value does not fit its field.
+bool assembly_link(Assembly *assembly, const unsigned long *addresses,
+                   unsigned long (*resolve)(const char *name, void *context), void *context,
+                   char *error, size_t error_size);
+
+#endif // ASSEMBLER_H
\ No newline at end of file
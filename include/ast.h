@@ -2,6 +2,7 @@
 #define AST_H
 
 #include <stdbool.h>
+#include <type.h>
 
 typedef enum {
     NODE_PROGRAM,
@@ -19,23 +20,37 @@ typedef enum {
     NODE_STRING,
     NODE_CHAR,
     NODE_CALL,
-    NODE_ASSIGNMENT
+    NODE_ASSIGNMENT,
+    NODE_INLINE,
+    NODE_SELECT,
+    NODE_SWITCH,
+    NODE_CASE,
+    NODE_BREAK,
+    NODE_GLOBAL,
+    NODE_INDEX,
+    NODE_VECTOR
 } NodeType;
 
 typedef struct ASTNode {
     NodeType type;
+    int profile_id;      // First profile counter of the node plus one, 0 if none
+    TypeKind value_type; // Type of an expression's value, or of a variable
     union {
         // Program node
         struct {
             struct ASTNode **functions;  // Will now include both function and extern function nodes
             int function_count;
+            struct ASTNode **globals;    // File-scope variables, in declaration order
+            int global_count;
         } program;
         
         // Function node (both regular and extern functions)
         struct {
             char *name;
             char **params;
+            TypeKind *param_types;
             int param_count;
+            TypeKind return_type;
             struct ASTNode *body;  // NULL for extern functions
         } function;
         
@@ -62,28 +77,44 @@ typedef struct ASTNode {
             struct ASTNode *condition;
             struct ASTNode *body;
         } while_stmt;
+
+        // For node (any of init, condition and step may be NULL)
+        struct {
+            struct ASTNode *init;
+            struct ASTNode *condition;
+            struct ASTNode *step;
+            struct ASTNode *body;
+        } for_stmt;
         
-        // Binary operation node
+        // Binary operation node. Besides + - * / and =, operator is one of
+        // > < G (>=) L (<=) E (==) N (!=), or A (&&) and O (||), which only
+        // evaluate right when left does not decide the result
         struct {
             char operator;
             struct ASTNode *left;
             struct ASTNode *right;
         } binary_op;
 
-        // Unary operation node
+        // Unary operation node: '!' is logical not, and 'C' converts the
+        // operand to the node's value_type
         struct {
             char operator;
             struct ASTNode *operand;
         } unary_op;
         
-        // Variable/identifier node
+        // Variable/identifier node. A global lives at its symbol for the
+        // whole run, and any call may read or assign it; a local is private
+        // to the function, which no two variables share a name in. An
+        // array only appears as the array of a NODE_INDEX, or declared.
         struct {
             char *name;
+            bool is_global;
+            int length;      // Elements of an array of value_type, 0 for a scalar
         } variable;
         
         // Number literal node
         struct {
-            int value;
+            long value;      // Already converted to value_type
         } number;
 
         // String literal node
@@ -102,6 +133,64 @@ typedef struct ASTNode {
             struct ASTNode **args;
             int arg_count;
         } call;
+
+        // Inlined call: the callee body runs in place, and its returns
+        // produce the value of the expression
+        struct {
+            char *name;            // Callee, kept for diagnostics
+            struct ASTNode *body;
+        } inline_call;
+
+        // Branch-free conditional: both values are evaluated, then
+        // if_true is picked when condition is nonzero
+        struct {
+            struct ASTNode *condition;
+            struct ASTNode *if_true;
+            struct ASTNode *if_false;
+        } select;
+
+        // Switch node: body is a block whose top-level statements include
+        // the case labels, and control falls from one case into the next
+        struct {
+            struct ASTNode *value;
+            struct ASTNode *body;
+        } switch_stmt;
+
+        // Case label node, a statement of a switch body
+        struct {
+            long value;
+            bool is_default;
+        } case_label;
+
+        // File-scope variable of the type value_type. init is NULL for
+        // zero, a number, or for a 64-bit global a string, which stores
+        // its address.
+        struct {
+            char *name;
+            struct ASTNode *init;
+            int length;      // Elements of an array, which is zeroed; 0 for a scalar
+        } global;
+
+        // Array element, of the array's type: array[index], where index
+        // is a long. As the left operand of '=' it is stored to.
+        struct {
+            struct ASTNode *array;   // NODE_VARIABLE
+            struct ASTNode *index;
+        } index;
+
+        // Loop run lanes trips at a time in vector registers
+        // (vectorize.h). Operation, the statement of the loop body besides
+        // the step, is done for lanes values of counter at once while they
+        // are all below limit; loop then runs the trips left. The vector
+        // trips only run if check, when set, is nonzero.
+        struct {
+            struct ASTNode *loop;
+            struct ASTNode *counter;     // Induction variable, stepped by one
+            struct ASTNode *limit;       // Loop-invariant bound: counter < limit
+            struct ASTNode *operation;
+            struct ASTNode *check;
+            int lanes;
+        } vector;
     } data;
 } ASTNode;
 
@@ -111,18 +200,36 @@ void ast_free(ASTNode *node);
 
 // Node creation helper functions
 ASTNode *ast_create_program(void);
-ASTNode *ast_create_function(const char *name, char **params, int param_count, ASTNode *body);
+ASTNode *ast_create_function(const char *name, char **params, const TypeKind *param_types,
+                             int param_count, ASTNode *body);
 ASTNode *ast_create_extern_function(const char *name, char **params, int param_count);
 ASTNode *ast_create_block(void);
 ASTNode *ast_create_return(ASTNode *expression);
 ASTNode *ast_create_if(ASTNode *condition, ASTNode *then_branch, ASTNode *else_branch);
 ASTNode *ast_create_while(ASTNode *condition, ASTNode *body);
+ASTNode *ast_create_for(ASTNode *init, ASTNode *condition, ASTNode *step, ASTNode *body);
 ASTNode *ast_create_binary_op(char operator, ASTNode *left, ASTNode *right);
 ASTNode *ast_create_unary_op(char operator, ASTNode *operand);
-ASTNode *ast_create_number(int value);
+ASTNode *ast_create_number(long value);
 ASTNode *ast_create_variable(const char *name);
 ASTNode *ast_create_string(const char *value);
 ASTNode *ast_create_char(char value);
 ASTNode *ast_create_call(const char *name, ASTNode **args, int arg_count);
+ASTNode *ast_create_inline(const char *name, ASTNode *body);
+ASTNode *ast_create_select(ASTNode *condition, ASTNode *if_true, ASTNode *if_false);
+ASTNode *ast_create_cast(TypeKind type, ASTNode *operand);
+ASTNode *ast_create_switch(ASTNode *value, ASTNode *body);
+ASTNode *ast_create_case(long value, bool is_default);
+ASTNode *ast_create_break(void);
+ASTNode *ast_create_global(const char *name, TypeKind type, ASTNode *init);
+ASTNode *ast_create_index(ASTNode *array, ASTNode *index);
+ASTNode *ast_create_vector(ASTNode *loop, ASTNode *counter, ASTNode *limit, ASTNode *operation,
+                           ASTNode *check, int lanes);
+
+// Deep copy of a subtree
+ASTNode *ast_clone(const ASTNode *node);
+
+// Structural comparison of two expression trees
+bool ast_equal(const ASTNode *a, const ASTNode *b);
 
 #endif // AST_H
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef CALLGRAPH_H
+#define CALLGRAPH_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <ast.h>
+#include <profile.h>
+
+// Static estimate of call frequencies, used where there is no profile
+#define CALLGRAPH_LOOP_WEIGHT 8        // Trips of a loop
+#define CALLGRAPH_MAX_LOOP_DEPTH 3
+
+// Call-chain clusters stop growing at about a 4 KiB page of code
+#define CALLGRAPH_CLUSTER_SIZE 512     // AST nodes
+
+typedef struct {
+    int caller;          // Function indices in the program
+    int callee;
+    double weight;       // Calls along the edge per run, measured or estimated
+} CallEdge;
+
+// Calls between the functions of a program, indexed like its function
+// array. Roots are main, which _start calls, and the exported functions;
+// in whole-program compilation nothing else can be called from outside.
+typedef struct {
+    ASTNode *program;
+    int count;           // Functions, including extern declarations
+    CallEdge *edges;     // One per caller/callee pair
+    int edge_count;
+    double *frequency;   // Entries per run of each function
+    bool *root;
+    bool *reachable;     // From a root
+} CallGraph;
+
+// Graph management functions
+CallGraph *callgraph_build(ASTNode *program, const char **exports, int export_count,
+                           const Profile *profile);
+void callgraph_free(CallGraph *graph);
+
+// True if name is main or one of exports
+bool callgraph_is_exported(const char *name, const char **exports, int export_count);
+
+// Delete the functions no root reaches. The graph is stale afterwards.
+// Returns the number of functions deleted.
+int callgraph_remove_unreachable(CallGraph *graph);
+
+// Reorder the functions of the program for code locality, with call-chain
+// clustering (C3): hottest functions first, each is appended to the
+// cluster of its most frequent caller while the cluster stays within
+// CALLGRAPH_CLUSTER_SIZE, and clusters are laid out densest first.
+// Unreachable functions go last. sizes holds the node count of each
+// function. Returns false if the order did not change.
+bool callgraph_order(CallGraph *graph, const int *sizes);
+
+// Print the functions with their frequencies and outgoing calls
+void callgraph_dump(const CallGraph *graph, FILE *output);
+
+#endif // CALLGRAPH_H
\ No newline at end of file
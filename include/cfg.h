@@ -0,0 +1,71 @@
+#ifndef CFG_H
+#define CFG_H
+
+#include <stdbool.h>
+#include <insn.h>
+
+// Static branch prediction, after Ball and Larus
+#define CFG_LOOP_SCALE 8.0          // Estimated trips per loop level
+#define CFG_BACK_EDGE_PROB 0.88     // Loop branches usually stay in the loop
+#define CFG_LOOP_ENTRY_PROB 0.8     // Guards usually enter the loop
+#define CFG_EXIT_PROB 0.28          // Branches usually avoid early returns
+
+typedef enum {
+    CFG_FALLTHROUGH,   // Successor reached by falling off the end
+    CFG_TARGET         // Successor named by the final jump
+} CfgEdgeKind;
+
+typedef struct {
+    int start;               // First instruction, including leading alignment
+    int end;                 // One past the last instruction
+    int terminator;          // Index of the final jump or ret, or -1
+    const char *label;       // First label in the block, or NULL
+    int succ[2];             // Indexed by CfgEdgeKind; -1 if absent
+    double weight[2];        // Estimated or measured executions of each edge
+    double frequency;        // Estimated or measured executions of the block
+    long count;              // Count recorded by a profiling run, -1 if unknown
+    int loop_depth;
+    bool exits;              // Ends in ret, a jump to the epilogue or a tail call
+} BasicBlock;
+
+typedef struct {
+    const char *name;
+    int block;
+} CfgLabel;
+
+// Edge from a block ending in an indirect jump, as listed by the
+// INSN_TABLE_TARGET_FORMAT comments in front of the jump
+typedef struct {
+    int source;
+    const char *label;
+    int target;              // Block of label, or -1
+} CfgTableEdge;
+
+// Basic blocks of one function, in the order the code generator emitted them.
+// Block 0 is the entry block and starts with the function label.
+typedef struct {
+    InsnList *code;
+    BasicBlock *blocks;
+    int count;
+    int epilogue;            // Block holding the shared return sequence, or -1
+    CfgLabel *labels;        // Sorted by name
+    int label_count;
+    CfgTableEdge *table_edges;
+    int table_edge_count;
+} Cfg;
+
+// CFG management functions
+Cfg *cfg_build(InsnList *code);
+void cfg_free(Cfg *cfg);
+
+// Block defining the given label, or -1
+int cfg_find_label(Cfg *cfg, const char *label);
+
+// Whether a block ends in a jump through a table
+bool cfg_has_table_edges(Cfg *cfg, int block);
+
+// Fill in frequencies and edge weights from the profile counts recorded in
+// the code where there are any, and from static heuristics elsewhere
+void cfg_estimate(Cfg *cfg);
+
+#endif // CFG_H
\ No newline at end of file
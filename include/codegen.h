@@ -2,28 +2,106 @@
 #define CODEGEN_H
 
 #include "ast.h"
+#include "insn.h"
+#include "output.h"
+#include "target.h"
 #include <stdio.h>
 
 typedef struct {
-    FILE *output;
-    int label_count;
-    // Symbol table could be added here
+    char *name;
+    TypeKind type;
+    int offset;          // Stack slot offset from %rbp
+} LocalVariable;
+
+// What the output file holds
+typedef enum {
+    EMIT_ASSEMBLY,       // AT&T assembly text
+    EMIT_OBJECT,         // ELF relocatable object
+    EMIT_EXECUTABLE,     // Static ELF executable, if nothing is left undefined
+    EMIT_MEMORY,         // Nothing: kept in insns for the caller to run
+} EmitFormat;
+
+typedef struct {
+    Output *output;
+    EmitFormat emit;
+    bool failed;         // The program could not be assembled
+    InsnList *insns;     // Buffered output, optimized before printing
+    InsnList *rodata;    // Jump tables of the current function, emitted after it
+    int label_count;     // Labels .L0 up to .L<label_count - 1> are taken
+    char **strings;      // String literals of the program, each once; .LCn is strings[n]
+    int string_count;
+
+    // Code generation options
+    bool tail_calls;     // Emit calls in tail position as jumps
+    bool align_loops;    // Align loop headers to 16 bytes
+    Target target;       // -march: extensions and instruction costs to select for
+
+    // Functions given global symbols besides main; the rest are local to
+    // the program
+    const char **exports;
+    int export_count;
+
+    // Profiling: count executions into __profile_counters, or annotate
+    // blocks with the counts measured by a training run (-1 if unknown)
+    bool profile_counters;
+    const long *profile_counts;
+
+    // Per-function state
+    ASTNode *function;   // Function currently being generated
+    LocalVariable *locals;
+    int local_count;
+    int frame_size;      // Bytes of slots below %rbp in use
+    int push_depth;      // 8-byte pushes below the 16-byte aligned frame
+    int inline_return_label;  // Target of returns in an inlined body, or -1
+    int break_label;          // Exit of the innermost loop or switch, or -1
 } CodeGenerator;
 
 // Code generator management functions
-CodeGenerator *codegen_create(const char *output_file);
-void codegen_free(CodeGenerator *gen);
+CodeGenerator *codegen_create(const char *output_file, EmitFormat emit);
+// Returns false if the output could not all be assembled and written
+bool codegen_free(CodeGenerator *gen);
 
 // Code generation functions
 void codegen_generate(CodeGenerator *gen, ASTNode *ast);
 void codegen_program(CodeGenerator *gen, ASTNode *node);
+void codegen_entry_point(CodeGenerator *gen);
+void codegen_flush(CodeGenerator *gen);
+void codegen_emit_rodata(CodeGenerator *gen);
+void codegen_emit_strings(CodeGenerator *gen);
 void codegen_function(CodeGenerator *gen, ASTNode *node);
 void codegen_block(CodeGenerator *gen, ASTNode *node);
 void codegen_statement(CodeGenerator *gen, ASTNode *node);
 void codegen_expression(CodeGenerator *gen, ASTNode *node);
+void codegen_loop(CodeGenerator *gen, ASTNode *loop);
+
+// Emit a call in tail position as a jump; returns false if it cannot be
+bool codegen_tail_call(CodeGenerator *gen, ASTNode *call);
+
+// Jump to label when node evaluates to jump_if, fall through otherwise
+void codegen_branch(CodeGenerator *gen, ASTNode *node, bool jump_if, int label);
 
 // Helper functions
 void codegen_emit(CodeGenerator *gen, const char *format, ...);
-char *codegen_new_label(CodeGenerator *gen);
+void codegen_emit_line(CodeGenerator *gen, const char *line);
+
+// Labels are numbered; label n is .L<n>
+int codegen_new_label(CodeGenerator *gen);
+void codegen_emit_label(CodeGenerator *gen, int label);
+// A jump instruction, e.g. jmp or jle, to label
+void codegen_emit_jump(CodeGenerator *gen, const char *mnemonic, int label);
+
+// Stack slot of a variable of the current function, or NULL
+LocalVariable *codegen_find_local(CodeGenerator *gen, const char *name);
+
+// Label of a string literal in the pool, adding it if it is new
+int codegen_intern_string(CodeGenerator *gen, const char *value);
+
+// Memory operand of a variable, local or global, of the bytes of a string,
+// or of the array of an element
+void codegen_memory_operand(CodeGenerator *gen, const ASTNode *node, char *out, size_t size);
+
+// Push and pop 8 bytes, keeping track of the stack alignment
+void codegen_push(CodeGenerator *gen, const char *reg);
+void codegen_pop(CodeGenerator *gen, const char *reg);
 
 #endif // CODEGEN_H
\ No newline at end of file
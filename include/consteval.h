@@ -0,0 +1,23 @@
+#ifndef CONSTEVAL_H
+#define CONSTEVAL_H
+
+#include <ast.h>
+
+// Bounds on the work of the interpreter
+#define CONSTEVAL_MAX_DEPTH 64           // Nested calls in one evaluation
+#define CONSTEVAL_MAX_STEPS 1000000      // Statements and expressions in one evaluation
+#define CONSTEVAL_BUDGET 10000000        // Steps for the whole program
+
+// Compile-time evaluation of calls with constant arguments. A function is
+// pure when it uses no global and every call it makes is to a pure function
+// of the program: its value then depends on its arguments alone. A call to a pure function
+// whose arguments all fold to constants is run by an interpreter over the AST
+// and, if it returns within CONSTEVAL_MAX_DEPTH and CONSTEVAL_MAX_STEPS,
+// replaced by the value it returned. Calls whose evaluation divides by
+// zero, overflows a signed type, reads a variable never assigned or runs
+// off the end of the function are left to run. Changed functions are
+// constant folded.
+// Returns the number of calls replaced.
+int consteval_run(ASTNode *program);
+
+#endif // CONSTEVAL_H
\ No newline at end of file
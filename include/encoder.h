@@ -0,0 +1,44 @@
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include <stdbool.h>
+
+#define ENCODER_MAX_LENGTH 15          // Longest x86-64 instruction
+#define ENCODER_SYMBOL_SIZE 256
+
+// How the symbolic operand of an instruction, if any, is filled in
+typedef enum {
+    ENCODE_NONE,         // No symbol: the bytes are final
+    ENCODE_PC32,         // rel32 of a sym(%rip) memory operand
+    ENCODE_CALL,         // rel32 of call sym
+    ENCODE_JUMP,         // jmp or jcc sym, short or near; see EncodedInsn.condition
+    ENCODE_IMM32,        // imm32 of mov $sym-minus
+} EncodeFixup;
+
+typedef struct {
+    unsigned char bytes[ENCODER_MAX_LENGTH];
+    int length;
+    EncodeFixup fixup;
+    char symbol[ENCODER_SYMBOL_SIZE];
+    char minus[ENCODER_SYMBOL_SIZE];    // ENCODE_IMM32: symbol subtracted
+    long addend;         // sym+addend(%rip), less the bytes after the rel32
+    int offset;          // Of the rel32 within bytes
+    int condition;       // ENCODE_JUMP: condition code, or -1 for jmp
+} EncodedInsn;
+
+// Machine code of one AT&T instruction line, e.g. "\taddl $1, -4(%rbp)",
+// with the same choices as GNU as: the shortest immediate and
+// displacement forms, the accumulator forms of the ALU operations, d1 for
+// shifts by 1, and 2-byte VEX prefixes where the registers allow. The
+// rel32 of a symbolic operand is left zero. Jumps to symbols are not
+// encoded: the assembler picks their size once it knows the distance.
+// Returns false, with a message in error, for lines it cannot encode.
+bool encode_insn(const char *line, EncodedInsn *out, char *error, int error_size);
+
+// Bytes of jmp (condition -1) or jcc with a rel8 or a rel32 displacement
+int encode_jump(int condition, bool near, long displacement, unsigned char *out);
+
+// Multi-byte nop padding of length bytes, in the forms GNU as uses
+void encode_nops(unsigned char *out, int length);
+
+#endif // ENCODER_H
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef FOLD_H
+#define FOLD_H
+
+#include <stdbool.h>
+#include <ast.h>
+
+// Value of an expression built only from literals, computed in its type
+// and held as type_convert would. Division by zero and signed overflow
+// have no value.
+bool fold_constant(const ASTNode *node, long *value);
+
+// The binary operator of node applied to the values of its operands, which
+// the checker gave the same type, with the same rules
+bool fold_operation(const ASTNode *node, long left, long right, long *result);
+
+// Constant folding over a function body: literal subexpressions become
+// numbers, x+0, x*1 and the like lose the identity operand (and x = x
+// goes), and if
+// statements and loops with a constant condition keep only the code that
+// can run, as does a block after its return or break.
+// Returns the number of simplifications.
+int fold_function(ASTNode *function);
+
+#endif // FOLD_H
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <stdbool.h>
+#include <insn.h>
+
+// Bytes below %rsp that signal handlers leave alone (System V AMD64 ABI)
+#define FRAME_RED_ZONE 128
+
+// Slots of larger frames are not shared, to bound the interference matrix
+#define FRAME_MAX_COLORED_SLOTS 1024
+
+// Lay out the stack frame of one function. The code generator gives every
+// variable its own slot below %rbp and sets the frame up in full; this
+// trims it:
+// - reads of a register parameter's slot read the register instead while
+//   it still holds the parameter, and stores nothing reads are deleted;
+// - variables that are never live at the same time share a slot;
+// - callee-saved registers are saved only if the body uses them;
+// - the frame is set up only on the paths that use it (shrink-wrapping),
+//   so early exits return without touching the stack; the shared
+//   epilogue is left out once nothing enters it;
+// - leaf functions without pushes keep their slots in the red zone instead
+//   of moving %rsp;
+// - with omit_frame_pointer, slots are addressed from %rsp and %rbp is
+//   neither saved nor set up.
+// Returns the number of changes, 0 if the code is not in the shape the
+// code generator emits.
+int frame_function(InsnList *code, bool omit_frame_pointer);
+
+#endif // FRAME_H
\ No newline at end of file
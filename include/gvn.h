@@ -0,0 +1,17 @@
+#ifndef GVN_H
+#define GVN_H
+
+#include <ast.h>
+
+// Size of the hash-consing table for value numbers; grows when half full
+#define GVN_INITIAL_TABLE_SIZE 64
+
+// Global value numbering over one function. Expressions are numbered by
+// hash-consing their operator and operand numbers, and an assignment gives
+// the variable the number of its right-hand side. A pure expression whose
+// number is already available in a dominating statement is replaced by the
+// variable holding it, or by a temporary stored where it was first computed.
+// Returns the number of expressions replaced.
+int gvn_function(ASTNode *function);
+
+#endif // GVN_H
\ No newline at end of file
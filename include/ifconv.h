@@ -0,0 +1,28 @@
+#ifndef IFCONV_H
+#define IFCONV_H
+
+#include <ast.h>
+#include <profile.h>
+
+// Cost model, in rough cycles of work evaluated on every path
+#define IFCONV_MAX_COST 8             // Both values together, beyond the branch
+#define IFCONV_MAX_OPERANDS 4         // Variables and constants in both values
+#define IFCONV_LEAF_COST 1
+#define IFCONV_ALU_COST 1             // + - and comparisons
+#define IFCONV_MUL_COST 3
+#define IFCONV_DIV_COST 20
+
+// With a profile, a branch going the same way this often predicts well
+// and is kept
+#define IFCONV_PREDICTABLE_BIAS 0.9
+
+// Replace small if statements whose sides only compute a value with a
+// NODE_SELECT, which codegen lowers to cmov (or setcc for 0/1 results):
+//   if (c) { x = a; } else { x = b; }   =>  x = c ? a : b
+//   if (c) { x = a; }                   =>  x = c ? a : x
+//   if (c) { return a; } else/then return b;  =>  return c ? a : b
+// Both values must be free of side effects and traps, since both are
+// evaluated. Returns the number of branches removed.
+int ifconv_function(ASTNode *function, const Profile *profile);
+
+#endif // IFCONV_H
\ No newline at end of file
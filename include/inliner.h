@@ -0,0 +1,30 @@
+#ifndef INLINER_H
+#define INLINER_H
+
+#include <ast.h>
+#include <profile.h>
+
+#define INLINER_DEFAULT_THRESHOLD 30
+
+// Cost model weights, in AST nodes
+#define INLINER_CALL_BENEFIT 12       // Call, prologue and epilogue avoided
+#define INLINER_CONST_ARG_BENEFIT 4   // Per literal argument that can be folded
+#define INLINER_LOOP_BENEFIT 10       // Per loop enclosing the call site
+#define INLINER_MAX_LOOP_DEPTH 3
+#define INLINER_MAX_DEPTH 3           // Nested inlining limit, caps recursion
+#define INLINER_HOT_BENEFIT 40        // Call site among the hottest in the profile
+#define INLINER_HOT_FRACTION 16       // Hot: run at least 1/16 as often as the hottest
+
+// Replace calls to small functions with a copy of the callee body.
+// A call site is inlined when the callee size minus the estimated benefit
+// is at most threshold; a negative threshold disables inlining. sizes holds
+// the node count of each function body, or is NULL to compute them here.
+// With a profile, measured call counts replace the loop depth estimate and
+// call sites that never ran are left alone.
+// Returns the number of call sites inlined.
+int inliner_run(ASTNode *program, int threshold, const int *sizes, const Profile *profile);
+
+// Number of AST nodes in a subtree
+int inliner_node_count(const ASTNode *node);
+
+#endif // INLINER_H
\ No newline at end of file
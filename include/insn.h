@@ -0,0 +1,75 @@
+#ifndef INSN_H
+#define INSN_H
+
+#include <stdbool.h>
+#include <output.h>
+
+#define INSN_MAX_OPERANDS 3
+#define INSN_OPERAND_SIZE 64
+
+// Comment recording how often the block it is in ran in a profiling run
+#define INSN_COUNT_FORMAT "\t# count %ld"
+
+// Comment naming one possible target of the indirect jump ending its block
+#define INSN_TABLE_TARGET_FORMAT "\t# table target %s"
+
+typedef enum {
+    INSN_OP,         // Machine instruction, e.g. "movq $1, %rax"
+    INSN_LABEL,      // Label definition, e.g. ".L3:"
+    INSN_DIRECTIVE,  // Assembler directive or comment
+    INSN_DELETED     // Removed by an optimization pass, skipped on output
+} InsnKind;
+
+typedef struct {
+    InsnKind kind;
+    char *text;                  // Line as it will be printed
+    char mnemonic[16];           // INSN_OP only
+    char operands[INSN_MAX_OPERANDS][INSN_OPERAND_SIZE];
+    int operand_count;
+    char *label;                 // INSN_LABEL only, without the ':'
+} Insn;
+
+typedef struct {
+    Insn *items;
+    int count;
+    int capacity;
+} InsnList;
+
+// Instruction list management functions
+InsnList *insn_list_create(void);
+void insn_list_free(InsnList *list);
+void insn_list_clear(InsnList *list);
+
+// Move every instruction of src to the end of dst, leaving src empty
+bool insn_list_splice(InsnList *dst, InsnList *src);
+
+// Append a raw assembly line, classifying and parsing it
+bool insn_list_append(InsnList *list, const char *line);
+
+// Replace the contents of an instruction with a new line
+void insn_set(Insn *insn, const char *line);
+void insn_delete(Insn *insn);
+
+// Write all live instructions, one per line
+void insn_list_print(InsnList *list, Output *output);
+
+// Query helpers used by optimization passes
+bool insn_is_op(const Insn *insn, const char *mnemonic);
+bool insn_is_jump(const Insn *insn);
+bool insn_is_cond_jump(const Insn *insn);
+const char *insn_jump_target(const Insn *insn);
+bool insn_reads_flags(const Insn *insn);
+bool insn_writes_flags(const Insn *insn);
+bool insn_mentions_reg(const Insn *insn, const char *reg);
+bool insn_touches_stack(const Insn *insn);
+
+// Register name helpers
+const char *insn_reg_family(const char *reg);
+const char *insn_reg32(const char *reg64);
+// The register of reg's family that is size bytes wide, and the width of
+// reg in bytes (0 if it is not a general-purpose register)
+const char *insn_reg_sized(const char *reg, int size);
+int insn_reg_size(const char *reg);
+const char *insn_invert_cond(const char *cond);
+
+#endif // INSN_H
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef IPCP_H
+#define IPCP_H
+
+#include <ast.h>
+#include <profile.h>
+
+#define IPCP_MAX_CLONES 4             // Specialized copies of one function
+#define IPCP_GROWTH_PERCENT 50        // Clones may add this much to the program size,
+#define IPCP_MIN_GROWTH 200           // or this many nodes if that is more
+#define IPCP_MAX_ROUNDS 3             // Clones of recursive functions expose new call sites
+
+// Interprocedural constant propagation. A parameter that receives the
+// same literal at every call site, and that the callee never assigns, is
+// replaced by the literal in the callee and dropped from the calls.
+// Where call sites disagree, the callee is cloned as NAME.constprop.N once
+// per set of literal arguments, most frequent first, and the matching
+// sites call their clone instead, while the clones fit in growth_percent
+// of the program size or IPCP_MIN_GROWTH nodes, whichever is more
+// (0 disables cloning). Changed bodies are constant folded. With a
+// profile, sites that never ran get no clone.
+// Returns the number of parameters propagated plus call sites redirected.
+int ipcp_run(ASTNode *program, int growth_percent, const Profile *profile);
+
+#endif // IPCP_H
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef ISEL_H
+#define ISEL_H
+
+#include <ast.h>
+#include <codegen.h>
+
+// Table-driven instruction selection (BURS). Expression trees are matched
+// against the tree patterns of src/isel.spec, compiled into tables at build
+// time, and covered at the least total cost: constants become immediates,
+// variables are used as memory operands straight from their stack slots,
+// and sums of scaled terms and a displacement fold into one lea. Calls and
+// the other nodes with control flow are left to the code generator.
+
+// Evaluate node into %rax
+void isel_value(CodeGenerator *gen, ASTNode *node);
+
+// Evaluate node for its side effects only
+void isel_effect(CodeGenerator *gen, ASTNode *node);
+
+// Set the flags from node and return the condition code suffix that holds
+// when node is nonzero
+const char *isel_condition(CodeGenerator *gen, ASTNode *node);
+
+#endif // ISEL_H
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <insn.h>
+
+// Assemble a compiled program into memory of this process and call its
+// main with argc and argv, setting *status to what main returns or what
+// the program passes to exit. Functions the program does not define are
+// taken from the built-in runtime, then from the libraries this process
+// has loaded. Nothing is written to disk, and the memory is released on
+// return, so any number of programs can be run one after another.
+// Returns false, with a message in error, if the program cannot be
+// assembled or a symbol resolved.
+bool jit_run(InsnList *code, int argc, char **argv, int *status, char *error, size_t error_size);
+
+#endif // JIT_H
\ No newline at end of file
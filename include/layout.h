@@ -0,0 +1,17 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <insn.h>
+#include <cfg.h>
+
+// Reorder the basic blocks of one function so that the likely successor of
+// each block falls through (Pettis-Hansen bottom-up chaining). Branches are
+// inverted or given an extra jmp as the new order requires, and chains that
+// end in a return are placed last, in front of the epilogue.
+// Returns the number of blocks that moved.
+int layout_function(InsnList *code);
+
+// Same, using the frequencies and edge weights already set in cfg
+int layout_blocks(Cfg *cfg);
+
+#endif // LAYOUT_H
\ No newline at end of file
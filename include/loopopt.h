@@ -0,0 +1,15 @@
+#ifndef LOOPOPT_H
+#define LOOPOPT_H
+
+#include <ast.h>
+
+// Hoist loop-invariant expressions out of every loop in the program into
+// a preheader placed in front of the loop. Loop rotation and header
+// alignment happen when the loop is lowered in codegen_loop.
+// Returns the number of expressions hoisted.
+int loopopt_optimize(ASTNode *program);
+
+// Loop-invariant code motion for the loops in one block
+int loopopt_block(ASTNode *block);
+
+#endif // LOOPOPT_H
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef OBJECT_H
+#define OBJECT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <assembler.h>
+#include <output.h>
+
+#define OBJECT_BASE_ADDRESS 0x400000UL   // Of the executable's first page
+#define OBJECT_PAGE_SIZE 0x1000UL
+
+// Write an ELF64 relocatable object of the assembly, for any linker
+bool object_write_relocatable(const Assembly *assembly, Output *output, char *error, size_t error_size);
+
+// Link the assembly in place and write it as a static ELF64 executable
+// entered at _start: code and read-only data in one segment, writable
+// data and .bss in another. Fails if any symbol is undefined.
+bool object_write_executable(Assembly *assembly, Output *output, char *error, size_t error_size);
+
+#endif // OBJECT_H
\ No newline at end of file
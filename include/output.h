@@ -0,0 +1,43 @@
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define OUTPUT_BUFFER_SIZE (1 << 16)   // Bytes collected for each write(2)
+
+// Output file. Text is appended to an in-memory buffer that is written out
+// whenever it fills, so a program of any size takes a few large writes.
+typedef struct {
+    int fd;
+    char *data;
+    size_t length;       // Bytes of data not yet written
+    bool failed;         // A write failed; the rest of the output is dropped
+} Output;
+
+// Create or truncate path for writing, a new file with the permissions of
+// mode less the umask; NULL if it cannot be opened
+Output *output_open(const char *path, int mode);
+
+// Write what is buffered and close the file. Returns false if any write
+// failed.
+bool output_close(Output *output);
+
+void output_write(Output *output, const char *text, size_t length);
+void output_flush(Output *output);
+
+// Text formatting without printf. Each routine appends to the string
+// ending at out, never writing at or past end, and returns the new end:
+// the terminating '\0', which it always stores.
+char *output_text(char *out, char *end, const char *text);
+char *output_char(char *out, char *end, char c);
+char *output_long(char *out, char *end, long value);
+char *output_label(char *out, char *end, int label);   // .L<label>
+
+// Format a line from the printf conversions %s %c %d %u %x %ld %lu %lx
+// and %%, falling back on vsnprintf for anything else. Returns the end of
+// the line, as above.
+char *output_vformat(char *out, char *end, const char *format, va_list args);
+
+#endif // OUTPUT_H
\ No newline at end of file
@@ -5,10 +5,22 @@
 #include <lexer.h>
 #include <ast.h>
 
+// A variable declared in the function being parsed, or a global
+typedef struct {
+    char *name;
+    TypeKind type;
+    int length;          // Elements of an array, 0 for a scalar
+} Symbol;
+
 typedef struct {
     Lexer *lexer;
     Token *current_token;
     Token *peek_token;
+    int break_depth;     // Enclosing loops and switches, which break may leave
+    Symbol *symbols;     // Parameters and locals of the current function
+    int symbol_count;
+    Symbol *globals;     // Globals declared so far
+    int global_count;
 } Parser;
 
 // Parser management functions
@@ -22,19 +34,34 @@ void parser_error(Parser *parser, const char *message);
 
 // Production rules
 ASTNode *parser_parse_program(Parser *parser);
-ASTNode *parser_parse_function(Parser *parser);
+ASTNode *parser_parse_external_declaration(Parser *parser);
+ASTNode *parser_parse_function(Parser *parser, TypeKind return_type, const char *name);
+ASTNode *parser_parse_global(Parser *parser, TypeKind type, const char *name);
 ASTNode *parser_parse_block(Parser *parser);
 ASTNode *parser_parse_statement(Parser *parser);
 ASTNode *parser_parse_expression(Parser *parser);
+ASTNode *parser_parse_logical_or(Parser *parser);
+ASTNode *parser_parse_logical_and(Parser *parser);
+ASTNode *parser_parse_comparison(Parser *parser);
 ASTNode *parser_parse_arithmetic(Parser *parser);
 ASTNode *parser_parse_term(Parser *parser);
 ASTNode *parser_parse_factor(Parser *parser);
+ASTNode *parser_parse_call(Parser *parser);
+
+// Type names: [signed | unsigned] [char | short | int | long [long]] [int]
+bool parser_at_type(Parser *parser);
+TypeKind parser_parse_type(Parser *parser);
 
 // Statement parsing functions
 ASTNode *parser_parse_return_statement(Parser *parser);
 ASTNode *parser_parse_if_statement(Parser *parser);
 ASTNode *parser_parse_while_statement(Parser *parser);
+ASTNode *parser_parse_for_statement(Parser *parser);
+ASTNode *parser_parse_switch_statement(Parser *parser);
+ASTNode *parser_parse_break_statement(Parser *parser);
 ASTNode *parser_parse_variable_declaration(Parser *parser);
 ASTNode *parser_parse_assignment(Parser *parser);
+ASTNode *parser_parse_assignment_expression(Parser *parser);
+ASTNode *parser_parse_call_statement(Parser *parser);
 
 #endif // PARSER_H
\ No newline at end of file
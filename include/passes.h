@@ -0,0 +1,125 @@
+#ifndef PASSES_H
+#define PASSES_H
+
+#include <stdbool.h>
+#include <ast.h>
+#include <codegen.h>
+#include <insn.h>
+#include <profile.h>
+
+#define PASS_MAX_REQUIRES 4
+
+typedef enum {
+    OPT_LEVEL_0,     // -O0: no optimization, fastest compile
+    OPT_LEVEL_1,     // -O1: cheap local optimizations
+    OPT_LEVEL_2,     // -O2: everything, including inlining
+    OPT_LEVEL_SIZE   // -Os: optimize without growing the code
+} OptLevel;
+
+typedef struct {
+    OptLevel level;
+    int inline_threshold;        // Only used when inline_threshold_set
+    bool inline_threshold_set;   // Otherwise the preset picks the threshold
+    bool time_passes;
+    const char *profile_generate;  // Profile file written by the program, or NULL
+    const char *profile_use;       // Profile file read to guide optimization, or NULL
+    const char **exports;          // Functions callable from outside besides main
+    int export_count;
+    bool dump_callgraph;
+    bool omit_frame_pointer;       // Address the frame from %rsp where the frame pass runs
+    Target target;                 // -march: extensions and costs to generate code for
+} CompileOptions;
+
+typedef enum {
+    PASS_ANALYSIS,   // Computes a cached result for one function
+    PASS_PROGRAM,    // Transforms the whole AST
+    PASS_FUNCTION,   // Transforms the AST of one function
+    PASS_MACHINE     // Transforms the instructions generated for one function
+} PassKind;
+
+typedef struct PassManager PassManager;
+
+typedef struct {
+    const char *name;
+    PassKind kind;
+    const char *requires[PASS_MAX_REQUIRES];  // Analyses computed before the pass runs
+
+    // Analyses: compute and release a result for one function
+    void *(*analyze)(PassManager *pm, ASTNode *function);
+    void (*release)(void *result);
+
+    // Transforms: return true if they changed the code, which invalidates
+    // the cached analyses of the function (or of every function)
+    bool (*run_program)(PassManager *pm, ASTNode *program);
+    bool (*run_function)(PassManager *pm, ASTNode *function);
+    bool (*run_machine)(PassManager *pm, InsnList *code);
+} Pass;
+
+// Cached analyses of one function, indexed like the registered passes;
+// NULL until computed
+typedef struct {
+    ASTNode *function;
+    void **results;
+    int result_count;
+} AnalysisSlot;
+
+typedef struct {
+    const char *pass;
+    char *function;         // Own copy, or NULL for whole-program passes
+    double seconds;
+    long allocations;
+    int runs;
+} PassTiming;
+
+struct PassManager {
+    CompileOptions options;
+    ASTNode *program;
+    CodeGenerator *gen;
+    Profile *profile;        // Counter numbering, and counts with --profile-use
+
+    const Pass **passes;     // Registered passes, in pipeline order
+    bool *enabled;
+    int pass_count;
+
+    // Slots are never removed, only emptied when their function is invalidated
+    AnalysisSlot *slots;
+    int slot_count;
+    int slot_capacity;
+    int *slot_buckets;       // Slot index by function hash, -1 for empty
+    int slot_bucket_count;
+
+    // Recorded only with --time-passes, in the order of the first run
+    PassTiming *timings;
+    int timing_count;
+    int timing_capacity;
+    int *timing_buckets;     // Timing index by pass and function name hash, -1 for empty
+    int timing_bucket_count;
+};
+
+// Pass manager management functions
+PassManager *pass_manager_create(CompileOptions options);
+void pass_manager_free(PassManager *pm);
+
+// Registration and pipeline configuration
+bool pass_manager_register(PassManager *pm, const Pass *pass);
+// Returns false if no pass has that name
+bool pass_manager_enable(PassManager *pm, const char *name, bool enabled);
+void pass_manager_apply_preset(PassManager *pm);
+
+// Run the pipeline over a parsed program and write the generated code
+void pass_manager_run(PassManager *pm, ASTNode *program, CodeGenerator *gen);
+
+// Cached analysis result for a function, computed on first use
+void *pass_manager_get_analysis(PassManager *pm, const char *name, ASTNode *function);
+void pass_manager_invalidate(PassManager *pm, ASTNode *function);
+
+// Write the --time-passes report
+void pass_manager_report(PassManager *pm, FILE *output);
+
+// Parse -O0/-O1/-O2/-Os; returns false if the flag is not an -O flag
+bool pass_parse_opt_level(const char *flag, OptLevel *level);
+
+// Number of heap allocations made by the compiler so far
+long pass_allocation_count(void);
+
+#endif // PASSES_H
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef PEEPHOLE_H
+#define PEEPHOLE_H
+
+#include <stdbool.h>
+#include <insn.h>
+
+// Lookup table from label name to its position in the instruction list
+typedef struct {
+    const char *name;
+    int index;
+} LabelEntry;
+
+typedef struct {
+    LabelEntry *entries;  // Sorted by name
+    int count;
+} LabelIndex;
+
+typedef struct {
+    InsnList *list;
+    LabelIndex labels;
+} PeepholeContext;
+
+// A pattern tries to rewrite the code starting at index and returns true
+// if it changed anything. Add new rewrites to the table in peephole.c.
+typedef struct {
+    const char *name;
+    bool (*apply)(PeepholeContext *ctx, int index);
+} PeepholePattern;
+
+// Run all patterns over the list until nothing changes.
+// Returns the number of rewrites performed.
+int peephole_optimize(InsnList *list);
+
+// Index of the next live instruction after index, or list->count
+int peephole_next(InsnList *list, int index);
+
+#endif // PEEPHOLE_H
\ No newline at end of file
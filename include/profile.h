@@ -0,0 +1,56 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdbool.h>
+#include <ast.h>
+#include <codegen.h>
+
+#define PROFILE_DEFAULT_FILE "opencc.profdata"
+#define PROFILE_MAGIC "OCCPROF1"
+
+// Counters per node, numbered in source order within each function
+#define PROFILE_FUNCTION_COUNTERS 1   // Entries
+#define PROFILE_IF_COUNTERS 2         // Then branch, else path
+#define PROFILE_LOOP_COUNTERS 2       // Entries, iterations
+#define PROFILE_CALL_COUNTERS 1       // Calls made from the site
+
+typedef struct {
+    unsigned long name_hash;
+    unsigned long checksum;   // Shape of the function the counters belong to
+    int first;                // Index of its first counter
+    int count;
+    bool matched;             // Loaded counts are valid for this function
+} ProfileFunction;
+
+// Counter numbering for a program and, with --profile-use, the counts
+// measured by a training run. The numbering is assigned right after parsing,
+// so inlined and transformed copies of a node keep the counters of the
+// original, and the same source gets the same numbering in both builds.
+typedef struct {
+    ProfileFunction *functions;
+    int function_count;
+    long *counts;             // Measured count per counter, -1 if unknown
+    int counter_count;
+    long max_count;           // Largest measured count
+} Profile;
+
+// Profile management functions
+Profile *profile_create(ASTNode *program);
+void profile_free(Profile *profile);
+
+// Read the counts written by an instrumented program. Functions whose shape
+// changed since the training run keep unknown counts. Returns false, with a
+// message in error, if the file is missing or not a profile at all.
+bool profile_load(Profile *profile, const char *path, char *error, int error_size);
+
+// Number of functions with usable counts
+int profile_matched_count(const Profile *profile);
+
+// Measured count of one of a node's counters, or -1 if unknown
+long profile_count(const Profile *profile, const ASTNode *node, int counter);
+
+// Emit the counters and __profile_dump, which _start calls on exit to
+// write them to path
+void profile_emit(const Profile *profile, CodeGenerator *gen, const char *path);
+
+#endif // PROFILE_H
\ No newline at end of file
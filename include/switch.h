@@ -0,0 +1,23 @@
+#ifndef SWITCH_H
+#define SWITCH_H
+
+#include <ast.h>
+#include <codegen.h>
+
+// Case values are split into clusters, each dispatched in O(1) by one of:
+//   a jump table in .rodata, for dense runs of values,
+//   bit tests against a mask, for small sets sharing few targets,
+//   a range check, for consecutive values with the same target,
+// and the clusters are searched with a balanced binary tree.
+#define SWITCH_MIN_TABLE_CASES 4      // Fewer cases than this never get a table
+#define SWITCH_MIN_TABLE_DENSITY 40   // Percent of table entries that are cases
+#define SWITCH_MAX_TABLE_SIZE 4096    // Entries
+#define SWITCH_BIT_TEST_WIDTH 64      // Values one mask can cover
+#define SWITCH_MAX_BIT_TESTS 3        // Distinct targets per mask cluster
+#define SWITCH_LINEAR_CLUSTERS 3      // Clusters tested in sequence at a tree leaf
+
+// Lower a switch statement: dispatch on the value in one pass, then emit the
+// body with its case labels in source order, so that cases fall through
+void codegen_switch(CodeGenerator *gen, ASTNode *node);
+
+#endif // SWITCH_H
\ No newline at end of file
@@ -0,0 +1,36 @@
+#ifndef TARGET_H
+#define TARGET_H
+
+#include <stdbool.h>
+
+// x86-64 microarchitecture levels of the System V psABI. The instruction
+// selector has a cost table per tier, in this order; the costs that differ
+// are those of 32-bit idiv and three-component lea.
+typedef enum {
+    TARGET_X86_64,      // Baseline: cmov, SSE2
+    TARGET_X86_64_V2,   // Nehalem and later: SSE4.2, POPCNT
+    TARGET_X86_64_V3,   // Haswell and later: AVX2, BMI1, BMI2, LZCNT
+    TARGET_TIER_COUNT
+} TargetTier;
+
+// Instruction set extensions the code generator uses, as bits of
+// Target.features. Only the vectorizer looks at them: SSE4.1 for pmulld,
+// pminsd and pmaxsd, AVX2 for 256-bit vectors.
+#define TARGET_SSE4_1     (1u << 0)
+#define TARGET_AVX2       (1u << 1)
+
+#define TARGET_V2_FEATURES TARGET_SSE4_1
+#define TARGET_V3_FEATURES (TARGET_V2_FEATURES | TARGET_AVX2)
+
+typedef struct {
+    TargetTier tier;     // Selects the instruction costs
+    unsigned features;   // Extensions the generated code may use
+} Target;
+
+// Parse an -march= value: x86-64, x86-64-v2, x86-64-v3, or native, which
+// takes the extensions of the CPU running the compiler, as reported by
+// cpuid, and the highest tier they reach. Returns false if the name is
+// not one of these.
+bool target_parse(const char *name, Target *target);
+
+#endif // TARGET_H
\ No newline at end of file
@@ -10,6 +10,15 @@ typedef enum {
     TOKEN_WHILE,
     TOKEN_FOR,
     TOKEN_VOID,
+    TOKEN_SWITCH,
+    TOKEN_CASE,
+    TOKEN_DEFAULT,
+    TOKEN_BREAK,
+    TOKEN_CHAR_TYPE, // 'char'; TOKEN_CHAR is a character literal
+    TOKEN_SHORT,
+    TOKEN_LONG,
+    TOKEN_SIGNED,
+    TOKEN_UNSIGNED,
     
     // Identifiers and literals
     TOKEN_IDENTIFIER,
@@ -43,6 +52,7 @@ typedef enum {
     TOKEN_RBRACKET,  // ]
     TOKEN_SEMICOLON, // ;
     TOKEN_COMMA,     // ,
+    TOKEN_COLON,     // :
     TOKEN_DOT,       // .
     
     // Special tokens
@@ -0,0 +1,41 @@
+#ifndef TYPE_H
+#define TYPE_H
+
+#include <stdbool.h>
+
+// Integer types of the language, with the sizes of the System V AMD64 ABI.
+// A value of type T is held in the low type_size(T) bytes of a register;
+// the bytes above are undefined, so conversions to narrower types cost
+// nothing and only widening conversions emit code.
+typedef enum {
+    TYPE_CHAR,
+    TYPE_UCHAR,
+    TYPE_SHORT,
+    TYPE_USHORT,
+    TYPE_INT,
+    TYPE_UINT,
+    TYPE_LONG,
+    TYPE_ULONG,
+    TYPE_VOID       // Return type of functions without a value
+} TypeKind;
+
+// Size in bytes, 0 for void
+int type_size(TypeKind type);
+bool type_is_signed(TypeKind type);
+const char *type_name(TypeKind type);
+
+// AT&T size suffix of an operation on the type: b, w, l or q
+char type_suffix(TypeKind type);
+
+// Integer promotion: char and short operands are computed as int
+TypeKind type_promote(TypeKind type);
+
+// Type both operands of an arithmetic operator or comparison are converted
+// to (the usual arithmetic conversions)
+TypeKind type_common(TypeKind a, TypeKind b);
+
+// value converted to type: truncated to its size, then sign- or
+// zero-extended back to a long
+long type_convert(long value, TypeKind type);
+
+#endif // TYPE_H
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef TYPECHECK_H
+#define TYPECHECK_H
+
+#include <stdbool.h>
+#include <ast.h>
+
+// Type every expression of a parsed program and make its implicit
+// conversions explicit, as C does: operands of arithmetic and comparisons
+// are promoted to int and converted to their common type, and assigned
+// values, returned values and arguments to the type they are stored as.
+// Conversions become cast nodes ('C' unary operations), except that
+// literals are converted in place. Conditions keep their own type, as
+// testing a narrow value for zero needs no extension.
+// Reports each error and returns false if there were any.
+bool typecheck_program(ASTNode *program);
+
+#endif // TYPECHECK_H
\ No newline at end of file
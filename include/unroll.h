@@ -0,0 +1,35 @@
+#ifndef UNROLL_H
+#define UNROLL_H
+
+#include <ast.h>
+#include <profile.h>
+
+// Size limits, in AST nodes (inliner_node_count) of the loop body
+#define UNROLL_BUDGET 80              // Unrolled main loop body, all copies
+#define UNROLL_MAX_FACTOR 4           // Copies of the body per main loop trip
+#define UNROLL_FULL_BUDGET 120        // All copies of a fully unrolled loop
+#define UNROLL_FULL_MAX_TRIPS 16
+
+// Induction-variable simplification and unrolling of counted loops: loops
+// whose exit test compares a variable stepped by a constant once per trip
+// (i = i + c, the only assignment to it in the loop) against a value the
+// loop never changes, such as
+//   while (i < n) { ...; i = i + 1; }   or   for (...; i < n; i = i + c)
+//
+// - A loop with a known start, limit and at most UNROLL_FULL_MAX_TRIPS
+//   trips is replaced by one copy of its body per trip, with i replaced
+//   by its value in that trip.
+// - Otherwise i * k, for a constant k that needs an imul or a k the loop
+//   never changes, becomes a temporary advanced by c * k every trip.
+// - Then, within budget, the loop gets a main loop running unroll-factor
+//   copies of the body per trip. It counts a precomputed trip count down
+//   to zero instead of testing i, and the original loop is left after it
+//   to run the remaining trips.
+//
+// budget bounds the unrolled main loop body; 0 only simplifies induction
+// variables. With a profile, loops that run fewer trips per entry than
+// the unroll factor are not unrolled.
+// Returns the number of loops changed.
+int unroll_function(ASTNode *function, int budget, const Profile *profile);
+
+#endif // UNROLL_H
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef VECTORIZE_H
+#define VECTORIZE_H
+
+#include <ast.h>
+#include <codegen.h>
+
+// 32-bit lanes per vector register
+#define VECTORIZE_SSE_LANES 4         // SSE2, %xmm
+#define VECTORIZE_AVX_LANES 8         // AVX2, %ymm
+
+// Loop vectorization. A counted loop over int arrays,
+//   while (i < n) { statement; i = i + 1; }   or   for (; i < n; i = i + 1) statement
+// with n a value the loop never changes and statement one of
+//   a[i + c] = e                          map, copy or fill
+//   s = s + e   or   s = s - e            sum
+//   if (e < s) { s = e; }                 min (or max, with >)
+// is run lanes trips at a time. e is built from + - * and conversions over
+// elements b[i + c] of int arrays, values the loop never changes and
+// constants. The trips left over, and all trips when a store could feed a
+// later load within one vector, are run by the original loop. That is
+// decided at compile time when the offsets are constants, and by a test in
+// front of the loop when they are variables.
+// lanes is VECTORIZE_SSE_LANES or VECTORIZE_AVX_LANES.
+// Returns the number of loops vectorized.
+int vectorize_function(ASTNode *function, int lanes);
+
+// Lower a vectorized loop: the vector trips, then the original loop
+void codegen_vector_loop(CodeGenerator *gen, ASTNode *node);
+
+#endif // VECTORIZE_H
\ No newline at end of file
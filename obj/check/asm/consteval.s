@@ -0,0 +1,68 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq $0, -16(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $2000000, -20(%rbp)
+	jge .L0
+	movl $2000000, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	addq $524, -16(%rbp)
+	addl $1, -20(%rbp)
+	addq $524, -16(%rbp)
+	addl $1, -20(%rbp)
+	addq $524, -16(%rbp)
+	addl $1, -20(%rbp)
+	addq $524, -16(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -8(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $2000000, -20(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addq $524, -16(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $2000000, -20(%rbp)
+	jl .L4
+.L5:
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	salq $8, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	subq %rcx, %rax
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
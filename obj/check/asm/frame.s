@@ -0,0 +1,274 @@
+	.section .text
+	.global main
+	.type main, @function
+	.type mix, @function
+	.type walk, @function
+	.type mix.constprop.1, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	call mix.constprop.1
+	movl %eax, -4(%rbp)
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl $-1, %eax
+	movq %rax, %rdi
+	call mix
+	movl %eax, -4(%rbp)
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl $-2, %eax
+	movq %rax, %rdi
+	call mix
+	movq %rax, %rsi
+	movl $59999997, %eax
+	movq %rax, %rdi
+	call walk
+.L2:
+.L1:
+.L0:
+	movl %eax, -4(%rbp)
+	movl -4(%rbp), %eax
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	subl %ecx, %eax
+	leave
+	ret
+	.size main, .-main
+	.align 16
+mix:
+	cmpl $0, %edi
+	jge .L3
+	movl %esi, %eax
+	ret
+.mix_return:
+	leave
+	ret
+.L3:
+.L4:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movl %edi, -4(%rbp)
+	imull $3, %edi, %eax
+	addl %esi, %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	subl -4(%rbp), %eax
+	movl %eax, -20(%rbp)
+	movl -20(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	imull $5, -24(%rbp), %ecx
+	addl %ecx, %eax
+	subl %esi, %eax
+	movl %eax, -16(%rbp)
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	imull $3, -20(%rbp), %ecx
+	subl %ecx, %eax
+	addl -24(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -20(%rbp), %eax
+	imull -24(%rbp), %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $3353953467947191203, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	addl -16(%rbp), %eax
+	popq %rcx
+	subl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rcx
+	imull $3, -12(%rbp), %eax
+	subl -4(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -8(%rbp)
+	movl -4(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl -12(%rbp), %eax
+	subl %ecx, %eax
+	addl -16(%rbp), %eax
+	subl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -12(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5675921253449092805, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	addl -8(%rbp), %eax
+	popq %rcx
+	subl %ecx, %eax
+	jmp .mix_return
+	.size mix, .-mix
+	.align 16
+walk:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.walk_entry:
+	cmpl $0, -8(%rbp)
+	je .LB0
+.L5:
+.L6:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $60000000, %eax
+	movq %rax, %rdi
+	call mix
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .walk_entry
+.LB0:
+	movl -4(%rbp), %eax
+	leave
+	ret
+	.size walk, .-walk
+	.align 16
+mix.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movl $1, -24(%rbp)
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	movl %eax, -20(%rbp)
+	movl -20(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	imull $5, -24(%rbp), %ecx
+	addl %ecx, %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	imull $3, -20(%rbp), %ecx
+	subl %ecx, %eax
+	addl -24(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -20(%rbp), %eax
+	imull -24(%rbp), %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $3353953467947191203, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	addl -16(%rbp), %eax
+	popq %rcx
+	subl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rcx
+	imull $3, -12(%rbp), %eax
+	subl -4(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -8(%rbp)
+	movl -4(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl -12(%rbp), %eax
+	subl %ecx, %eax
+	addl -16(%rbp), %eax
+	subl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -12(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5675921253449092805, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	addl -8(%rbp), %eax
+	popq %rcx
+	subl %ecx, %eax
+	leave
+	ret
+	.size mix.constprop.1, .-mix.constprop.1
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,130 @@
+	.section .data
+	.type limit, @object
+	.size limit, 4
+	.p2align 2
+limit:
+	.long 5
+	.type greeting, @object
+	.size greeting, 8
+	.p2align 3
+greeting:
+	.quad .LC0
+	.type again, @object
+	.size again, 8
+	.p2align 3
+again:
+	.quad .LC0
+	.type other, @object
+	.size other, 8
+	.p2align 3
+other:
+	.quad .LC1
+	.section .bss
+	.type counter, @object
+	.size counter, 4
+	.p2align 2
+counter:
+	.zero 4
+	.type total, @object
+	.size total, 8
+	.p2align 3
+total:
+	.zero 8
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl $0, -12(%rbp)
+	movl -12(%rbp), %eax
+	cmpl limit(%rip), %eax
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movl -12(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	addl %eax, counter(%rip)
+	movslq counter(%rip), %rax
+	addq %rax, total(%rip)
+	movl counter(%rip), %eax
+.L2:
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	cmpl limit(%rip), %eax
+	jl .L0
+.L1:
+	movl counter(%rip), %eax
+	movl %eax, -16(%rbp)
+	addl $1, counter(%rip)
+	movslq counter(%rip), %rax
+	addq %rax, total(%rip)
+	movl counter(%rip), %eax
+.L3:
+	movl counter(%rip), %eax
+	movl %eax, -12(%rbp)
+	leaq .LC0(%rip), %rax
+	movq %rax, -8(%rbp)
+	movq greeting(%rip), %rax
+	cmpq other(%rip), %rax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -8(%rbp), %rax
+	cmpq greeting(%rip), %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq greeting(%rip), %rax
+	cmpq again(%rip), %rax
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	subl -16(%rbp), %eax
+	imull $10, %eax, %eax
+	movq %rax, %rcx
+	imull $100, -16(%rbp), %eax
+	addl %ecx, %eax
+	addl -8(%rbp), %eax
+	movslq %eax, %rax
+	addq total(%rip), %rax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	subl %ecx, %eax
+	leave
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
+	.section .rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string "hello"
+.LC1:
+	.string "world"
+	.section .text
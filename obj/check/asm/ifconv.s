@@ -0,0 +1,165 @@
+	.section .text
+	.global main
+	.type main, @function
+	.type count, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	call count
+	movl %eax, -4(%rbp)
+	movl -4(%rbp), %eax
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	subl %ecx, %eax
+	leave
+	ret
+	.size main, .-main
+	.align 16
+count:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movl $12345, -24(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $100000000, -16(%rbp)
+	jge .L0
+	movl $100000000, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	imull $1103515245, -24(%rbp), %eax
+	addl $12345, %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	leal 65535(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $16, %ecx
+	movl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movl -20(%rbp), %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	addl $3, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	popq %rcx
+	popq %rax
+	cmovel %ecx, %eax
+	movl %eax, -20(%rbp)
+	addl $1, -16(%rbp)
+	imull $1103515245, -24(%rbp), %eax
+	addl $12345, %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	leal 65535(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $16, %ecx
+	movl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movl -20(%rbp), %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	addl $3, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	popq %rcx
+	popq %rax
+	cmovel %ecx, %eax
+	movl %eax, -20(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -8(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $100000000, -16(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	imull $1103515245, -24(%rbp), %eax
+	addl $12345, %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	leal 65535(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $16, %ecx
+	movl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movl -20(%rbp), %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	addl $3, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	popq %rcx
+	popq %rax
+	cmovel %ecx, %eax
+	movl %eax, -20(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $100000000, -16(%rbp)
+	jl .L4
+.L5:
+	movl -20(%rbp), %eax
+	leave
+	ret
+	.size count, .-count
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
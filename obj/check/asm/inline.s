@@ -0,0 +1,99 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl $0, -16(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $100, -12(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movl $0, -8(%rbp)
+	cmpl $1000000, -8(%rbp)
+	jge .L3
+	.p2align 4,,10
+.L2:
+	movl -8(%rbp), %eax
+	leal 63(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $6, %ecx
+	movl %ecx, %eax
+	sall $6, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	subl %ecx, %eax
+	movl %eax, -4(%rbp)
+	movl $49, %eax
+.L6:
+	pushq %rax
+	movl -4(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+.L7:
+	popq %rcx
+	subl %ecx, %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -4(%rbp)
+	jge .L8
+	movl $0, %eax
+.L5:
+.L4:
+	addl %eax, -16(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $1000000, -8(%rbp)
+	jl .L2
+.L3:
+	movl -16(%rbp), %eax
+	leal 65535(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $16, %ecx
+	movl %ecx, %eax
+	sall $16, %eax
+	subl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $100, -12(%rbp)
+	jl .L0
+.L1:
+	movl -16(%rbp), %eax
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	subl %ecx, %eax
+	leave
+	ret
+.L8:
+.L9:
+	movl -4(%rbp), %eax
+	pushq %rax
+	movl $1000, %eax
+	movq %rax, %rcx
+	cmpl $1000, -4(%rbp)
+	popq %rax
+	cmovgl %ecx, %eax
+	jmp .L5
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
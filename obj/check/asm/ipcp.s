@@ -0,0 +1,177 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl $0, -12(%rbp)
+	movl $0, -8(%rbp)
+	movl $1, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	pxor %xmm7, %xmm7
+	movl $100000000, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -8(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L3
+	.p2align 4,,10
+.L2:
+	paddd %xmm8, %xmm7
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L2
+	movl %ecx, -8(%rbp)
+	pshufd $78, %xmm7, %xmm6
+	paddd %xmm6, %xmm7
+	pshufd $177, %xmm7, %xmm6
+	paddd %xmm6, %xmm7
+	movd %xmm7, %eax
+	addl %eax, -12(%rbp)
+.L3:
+.L1:
+	cmpl $100000000, -8(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $1, -12(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $100000000, -8(%rbp)
+	jl .L4
+.L5:
+	movl -12(%rbp), %eax
+.L0:
+	pushq %rax
+	movl $0, -16(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $100000000, -12(%rbp)
+	jge .L7
+	movl $100000000, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L8
+	.p2align 4,,10
+.L9:
+	movl -12(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	subl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	subl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	subl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	subl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -8(%rbp)
+	jne .L9
+.L10:
+.L7:
+.L8:
+	cmpl $100000000, -12(%rbp)
+	jge .L12
+	.p2align 4,,10
+.L11:
+	movl -12(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	subl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $100000000, -12(%rbp)
+	jl .L11
+.L12:
+	movl -16(%rbp), %eax
+.L6:
+	pushq %rax
+	movl $0, -16(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $100000000, -12(%rbp)
+	jge .L14
+	movl $100000000, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L15
+	.p2align 4,,10
+.L16:
+	movl -12(%rbp), %eax
+	addl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	addl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	addl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	addl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -8(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $100000000, -12(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movl -12(%rbp), %eax
+	addl %eax, -16(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $100000000, -12(%rbp)
+	jl .L18
+.L19:
+	movl -16(%rbp), %eax
+.L13:
+	popq %rcx
+	addl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	leave
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
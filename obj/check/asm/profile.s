@@ -0,0 +1,91 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movl $0, -20(%rbp)
+	movl $1, -16(%rbp)
+	cmpl $1000, -16(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movl -16(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $1, -4(%rbp)
+	je .L4
+	.p2align 4,,10
+.L3:
+	movl -4(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movl %eax, -4(%rbp)
+	sall $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	subl %ecx, %eax
+	jne .L6
+	movl -4(%rbp), %eax
+.L5:
+	movl %eax, -4(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $1, -4(%rbp)
+	jne .L3
+.L4:
+	movl -12(%rbp), %eax
+.L2:
+	movl %eax, -8(%rbp)
+	cmpl $1000, -8(%rbp)
+	jle .L8
+	movl -8(%rbp), %eax
+	movl %eax, -4(%rbp)
+	imull $3, -4(%rbp), %eax
+	addl $1, %eax
+.L10:
+	addl %eax, -20(%rbp)
+.L8:
+.L9:
+	movl -8(%rbp), %eax
+	addl %eax, -20(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $1000, -16(%rbp)
+	jl .L0
+.L1:
+	movl -20(%rbp), %eax
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	subl %ecx, %eax
+	popq %rbp
+	ret
+.L6:
+.L7:
+	imull $3, -8(%rbp), %eax
+	addl $1, %eax
+	jmp .L5
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,108 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movl $0, -20(%rbp)
+	movl $1, -16(%rbp)
+	cmpl $2000, -16(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movl -16(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $1, -4(%rbp)
+	je .L4
+	.p2align 4,,10
+.L3:
+	cmpl $100, -12(%rbp)
+	jne .L5
+	movl -12(%rbp), %eax
+.L2:
+	movl %eax, -8(%rbp)
+	cmpl $100, -8(%rbp)
+	jne .L10
+	movl -8(%rbp), %eax
+	movl %eax, -4(%rbp)
+	imull $3, -4(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %rcx
+	cmpl $0, -4(%rbp)
+	popq %rax
+	cmovll %ecx, %eax
+.L12:
+	addl %eax, -20(%rbp)
+.L10:
+.L11:
+	movl -8(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -4(%rbp), %eax
+	sall $1, %eax
+.L13:
+	addl %eax, -20(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $2000, -16(%rbp)
+	jl .L0
+.L1:
+	movl -20(%rbp), %eax
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	subl %ecx, %eax
+	leave
+	ret
+.L5:
+.L6:
+	movl -4(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movl %eax, -4(%rbp)
+	sall $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	subl %ecx, %eax
+	jne .L8
+	movl -4(%rbp), %eax
+.L7:
+	movl %eax, -4(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $1, -4(%rbp)
+	jne .L3
+.L4:
+	movl -12(%rbp), %eax
+	jmp .L2
+.L8:
+.L9:
+	imull $3, -8(%rbp), %eax
+	addl $1, %eax
+	jmp .L7
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,99 @@
+int g0;
+int main() {
+    unsigned char v0 = 2;
+    short v1 = 6;
+    unsigned short v2 = 9;
+    short v3 = 521U;
+    int i0 = 32767;
+    long j0 = 9;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 279; }
+    if ((int)((v3 != 10))) {
+        i0 = 0;
+        while (i0 < 8) {
+            if (v0) {
+                if ((la0[3] == la0[3])) { break; }
+                v0 = ((255 || v1) < (v3 < la0[2]));
+            }
+            v3 = v1;
+            i0 = i0 + 1;
+        }
+        i0 = ((159 - v3) < g0);
+    } else {
+        if (-(v2)) {
+            la0[1] = (unsigned char)(!(g0));
+            v3 = 4294967295U;
+        }
+        switch ((v1 - (v3 / 1024))) {
+        case 9:
+            i0 = ((v0 == v0) / 8);
+            if (4l) {
+                if ((int)(la0[1])) { return i0; }
+                v1 = (long)(g0);
+                if (-(la0[3])) { return 289; }
+            } else {
+                if ((short)(-(790))) { return (char)((9 / (i0 * i0 + 1))); }
+                if (((v1 || 618) >= -(la0[3]))) { return -((v3 / (j0 * j0 + 1))); }
+                if (v2 >= 0 && v2 < 4) { la0[v2] = ((6 > j0) / (i0 * i0 + 1)); }
+            }
+            break;
+        case 5:
+            break;
+        case 8:
+            for (v1 = 1; v1 < 16; v1 = v1 + 1) {
+                if (9) { break; }
+                v3 = (!(666) / (v1 * v1 + 1));
+                if ((540 < (unsigned short)(g0))) { break; }
+            }
+            v2 = (long)(1004961550974);
+        }
+        v3 = ((int)((i0 + la0[0])) && v3);
+    }
+    switch (((3 / (g0 * g0 + 1)) && (g0 >= 973))) {
+    case 7:
+        v2 = ((int)(i0) >= 1);
+        if (2147483647) { return 2; }
+    case 6:
+        if (10) {
+            g0 = 1;
+            v3 = (v1 + la0[1]);
+        }
+        if (-((long)(3))) {
+            for (v3 = 2; v3 < 100; v3 = v3 + 1) {
+                if (-((g0 < j0))) { break; }
+                if (la0[2]) { break; }
+            }
+        }
+        break;
+    case 1:
+        v0 = (!(i0) || (2 || !(i0)));
+        break;
+    case 10:
+        v2 = (i0 < (4 >= 5));
+        if (256) { return ((long)(v0) / (v3 * v3 + 1)); }
+        break;
+    default:
+        v2 = -((unsigned int)(la0[3]));
+        if ((849 < (la0[1] / 3))) { return !(g0); }
+    case 8:
+        break;
+    case 9:
+        break;
+    case 4:
+        i0 = (523 / (i0 * i0 + 1));
+        if (la0[1]) { return (!(v1) + 5); }
+        break;
+    }
+    if (g0) { return (1 > (v0 / 7)); }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,443 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb $2, -43(%rbp)
+	movw $6, -42(%rbp)
+	movw $9, -40(%rbp)
+	movw $521, -38(%rbp)
+	movq $9, -16(%rbp)
+	movl $0, -20(%rbp)
+	movl $279, -24(%rbp)
+	movl $558, -28(%rbp)
+	movl $837, -32(%rbp)
+	movl $4, -36(%rbp)
+	movswl -38(%rbp), %eax
+	cmpl $10, %eax
+	je .L0
+	movl $0, -36(%rbp)
+	movl $1, -8(%rbp)
+	cmpl $8, -36(%rbp)
+	jge .L3
+	.p2align 4,,10
+.L2:
+	cmpb $0, -43(%rbp)
+	je .L4
+	movl -32(%rbp), %eax
+	movl -32(%rbp), %ecx
+	cmpl %ecx, %eax
+	jne .L6
+.L3:
+	movl $159, %eax
+	movswl -38(%rbp), %ecx
+	subl %ecx, %eax
+	cmpl g0(%rip), %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+.L1:
+	movl g0(%rip), %eax
+	imull g0(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L31
+	cmpl $973, g0(%rip)
+	setge %al
+	movzbl %al, %eax
+	jmp .L32
+.L6:
+.L7:
+	movswl -38(%rbp), %eax
+	movl -28(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	cmpl %eax, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movb %al, -43(%rbp)
+.L4:
+.L5:
+	movswl -42(%rbp), %eax
+	movw %ax, -38(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L2
+	jmp .L3
+.L31:
+	movl $0, %eax
+.L32:
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L33
+	leaq .L34(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L27
+	# table target .L25
+	# table target .L30
+	# table target .L24
+	# table target .L23
+	# table target .L28
+	# table target .L29
+	# table target .L26
+	jmp *%rcx
+.L33:
+.L27:
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, -40(%rbp)
+	movl -24(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	cmpl $849, %eax
+	jg .LB0
+.L43:
+.L44:
+.L28:
+.L22:
+	cmpl $0, g0(%rip)
+	je .L47
+	movzbl -43(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	cmpl $1, %eax
+	setl %al
+	movzbl %al, %eax
+.main_return:
+	leave
+	ret
+.L0:
+	xorl %eax, %eax
+	movzwl -40(%rbp), %ecx
+	subl %ecx, %eax
+	je .L8
+	cmpl $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movl %eax, -24(%rbp)
+	movw $-1, -38(%rbp)
+.L8:
+.L9:
+	movswl -38(%rbp), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movswl -42(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L10
+	cmpq $8, %rax
+	je .L13
+	cmpq $9, %rax
+	je .L11
+	jmp .L10
+.L12:
+	jmp .L10
+.L13:
+	movw $1, -42(%rbp)
+	movswl -42(%rbp), %eax
+	cmpl $16, %eax
+	.p2align 4,,10
+.L18:
+.L19:
+	movw $21118, -40(%rbp)
+.L10:
+	movl -20(%rbp), %eax
+	addl -36(%rbp), %eax
+	je .L20
+	cmpw $0, -38(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L21
+.L20:
+	movl $0, %eax
+.L21:
+	movw %ax, -38(%rbp)
+	jmp .L1
+.L11:
+	movzbl -43(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl %eax, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movl %eax, -36(%rbp)
+	movl -24(%rbp), %eax
+	testl %eax, %eax
+	jne .LB1
+.L14:
+.L15:
+	movslq g0(%rip), %rax
+	movw %ax, -42(%rbp)
+	xorl %eax, %eax
+	movl -32(%rbp), %ecx
+	subl %ecx, %eax
+	jne .LB2
+.L16:
+.L17:
+	jmp .L10
+.L24:
+	movl $1, g0(%rip)
+	movswl -42(%rbp), %eax
+	movl -24(%rbp), %ecx
+	addl %ecx, %eax
+	movw $2, -38(%rbp)
+	movswl -38(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $100, %eax
+	jge .L22
+	.p2align 4,,10
+.L35:
+	movslq g0(%rip), %rax
+	cmpq -16(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L37
+.L36:
+	jmp .L22
+.L37:
+.L38:
+	movl -28(%rbp), %eax
+	testl %eax, %eax
+	je .L39
+	jmp .L22
+.L39:
+.L40:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -38(%rbp)
+	movswl -38(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $100, %eax
+	jl .L35
+	jmp .L22
+.L25:
+	cmpl $0, -36(%rbp)
+	je .L41
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L42
+.L41:
+	movl $1, %eax
+.L42:
+	movb %al, -43(%rbp)
+	jmp .L22
+.L29:
+	jmp .L22
+.L30:
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $523, %eax
+	cltd
+	idivl %ecx
+	movl %eax, -36(%rbp)
+	movl -24(%rbp), %eax
+	testl %eax, %eax
+	jne .LB3
+.L45:
+.L46:
+	jmp .L22
+.L47:
+.L48:
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl -43(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movswq -42(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzwl -40(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movswq -38(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movl -20(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl -24(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl -28(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl -32(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	jmp .main_return
+.LB0:
+	cmpl $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB3:
+	cmpw $0, -42(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl $5, %eax
+	jmp .main_return
+.LB1:
+	movl -36(%rbp), %eax
+	jmp .main_return
+.LB2:
+	movl $289, %eax
+	jmp .main_return
+.L23:
+	cmpl $1, -36(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movl $2, %eax
+	jmp .main_return
+.L26:
+	cmpl $0, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movswl -38(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movzbl -43(%rbp), %eax
+	cqo
+	idivq %rcx
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L34:
+	.long .L25-.L34
+	.long .L27-.L34
+	.long .L27-.L34
+	.long .L30-.L34
+	.long .L27-.L34
+	.long .L24-.L34
+	.long .L23-.L34
+	.long .L28-.L34
+	.long .L29-.L34
+	.long .L26-.L34
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
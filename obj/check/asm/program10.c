@@ -0,0 +1,204 @@
+unsigned short g0;
+char g1 = 982;
+int ga0[33];
+unsigned char f0(unsigned long p0, unsigned int p1, unsigned long p2, unsigned int p3, char p4, int p5, unsigned long p6) {
+    short v0 = 9;
+    short v1 = 2147483647;
+    int i0 = 2;
+    long j0 = 7;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 0; }
+    p3 = (unsigned char)((v0 > (unsigned int)(1)));
+    if ((((p5 != j0) < j0) < ((p4 / (p1 * p1 + 1)) + (p3 == g1)))) {
+        j0 = (ga0[16] * p1);
+        v1 = v1 + p5;
+        la1[5] = ((long)(v1) - p3);
+    } else {
+        if ((p4 - (g0 - 598))) { return p0; }
+        p2 = -(j0);
+    }
+    switch (p5) {
+    case 3:
+        v0 = 6;
+        break;
+    case -3:
+        break;
+    default:
+        p6 = p6 + (unsigned char)(0);
+        if ((g1 / (p4 * p4 + 1))) { return ((9 - 1051773040595) - (p3 && p2)); }
+        break;
+    case 1:
+        break;
+    }
+    p5 = 0;
+    while (p5 < 16) {
+        v0 = ((p2 > (short)(1077271976607ul)) + -(376));
+        p5 = p5 + 1;
+    }
+    return ((1 != 818) >= 6);
+}
+unsigned short f1(char p0) {
+    unsigned int v0 = 421l;
+    long v1 = 716;
+    long v2 = 0;
+    unsigned int v3 = 531;
+    unsigned short v4 = 4;
+    short v5 = 127;
+    int i0 = 2;
+    long j0 = 4;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 246517206682u; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 5; }
+    j0 = v3;
+    v2 = (((9 - ga0[13]) < (65536 + 6)) > (p0 != (423 - p0)));
+    v4 = g1;
+    if ((unsigned char)((10 - (4 - 386)))) {
+        p0 = ((unsigned long)((i0 || 6)) / (g1 * g1 + 1));
+        v1 = (((v2 * v4) > i0) == !((unsigned int)(537)));
+        v1 = v1 + f0(v0, 4294967295, v3, p0, 4, v3, v0);
+    } else {
+        v1 = j0;
+        f0(f0(ga0[2], v4, la0[18], 6, g0, j0, 4), 9, (int)(v5), (581 / 10), j0, (7 < 2), (466 + 65535));
+    }
+    v5 = (v4 != (int)(p0));
+    p0 = (f0(ga0[4], 897658260432, i0, v4, v2, p0, 287) - 97);
+    if (((long)((v4 / 3)) < 8)) {
+        v5 = p0;
+        v2 = v2;
+    } else {
+        v4 = (f0(v4, g1, v0, v2, 640166640311l, 9, 10) > v3);
+        j0 = (-(i0) == (f0(la0[32], v3, 5, 127, 589, 1, 2) >= v5));
+        if ((i0 != (int)((g0 - 464)))) {
+            v5 = (((char)(765315363348) > (65535 <= 10)) || 10);
+        } else {
+            v3 = 0;
+            while (v3 < 33) {
+                v4 = (v1 > !((519 + 6)));
+                v2 = (469 + ((long)(581) + (short)(ga0[23])));
+                la0[v3] = v0;
+                v3 = v3 + 1;
+            }
+        }
+    }
+    return (unsigned short)((v5 || (7 < la0[25])));
+}
+unsigned int rec(unsigned int n, unsigned int acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 3, acc);
+}
+int main() {
+    char v0 = 65535;
+    unsigned char v1 = 2;
+    unsigned long v2 = 160956282387;
+    int i0 = 171;
+    long j0 = 1;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 520; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 2; }
+    switch (!((g0 == g1))) {
+    default:
+        break;
+    case 2:
+        la0[24] = rec(ga0[20], 10);
+        break;
+    case 9:
+        if ((char)(v2)) {
+            j0 = (unsigned int)(3);
+            if (((v2 / 3) - rec(v1, v0))) {
+                g1 = (((unsigned int)(1) * rec(v2, 5)) < (!(g0) + (int)(6)));
+                if (g0 >= 0 && g0 < 8) { la1[g0] = ((j0 <= 1) - !(3)); }
+                j0 = (!(6L) - ((716 + 797) / 7));
+            } else {
+                j0 = 256;
+                rec((la0[32] == g1), v2);
+            }
+        } else {
+            i0 = i0 + la1[7];
+            v1 = f1(v0);
+        }
+        if ((g0 <= (848ul <= (3ul >= v1)))) {
+            j0 = f1(f0(ga0[20], 1, g1, 464, 8, 418, j0));
+        }
+        break;
+    case 5:
+        break;
+    case 1:
+        i0 = 0;
+        while (i0 < 3) {
+            if (rec(j0, 998)) { return -(v1); }
+            if (((unsigned int)(v1) && rec(i0, v1))) {
+                if (((120 <= 255) > (i0 * g1))) { break; }
+                la1[i0] = ((v2 - i0) <= (v2 <= 940910396941));
+                v2 = !(470);
+            } else {
+                v0 = 0u;
+                g0 = f0(!(3), (g1 && la1[5]), (char)(g0), (la0[3] && la0[20]), (v1 > j0), 967, (la1[6] < la0[9]));
+            }
+            if (f1(3)) { break; }
+            i0 = i0 + 1;
+        }
+        switch ((f0(394, i0, i0, la1[2], la1[3], 4, v2) / (v2 * v2 + 1))) {
+        default:
+            break;
+        case 8:
+        case 9:
+            i0 = 0;
+            while (i0 < 33) {
+                if ((432140247010 || (460 < v2))) { break; }
+                if ((v2 <= (short)(4))) { break; }
+                g1 = !(((207 / 10) / (v0 * v0 + 1)));
+                i0 = i0 + 1;
+            }
+            if ((((2 * j0) / 3) > (rec(10u, la1[2]) == (unsigned int)(65535)))) {
+                v0 = ga0[29];
+                i0 = v2;
+                if (i0 >= 0 && i0 < 33) { la0[i0] = ((79 < v1) - -(868)); }
+            } else {
+                v1 = v1 + (722396313524U <= (2147483647 * v1));
+                g0 = !(i0);
+            }
+            break;
+        case 4:
+            if (g0 >= 0 && g0 < 33) { la0[g0] = (i0 <= (short)(ga0[20])); }
+            for (i0 = 0; i0 < 8; i0 = i0 + 1) {
+                g0 = (g1 - g1);
+                g1 = f1((2 - 65535ul));
+                g0 = (39 == 8L);
+            }
+            break;
+        case 1:
+            break;
+        case 3:
+            j0 = j0 + 2;
+            if ((((i0 * g1) != (ga0[7] + j0)) <= i0)) {
+                f1((la0[17] >= 630));
+                v2 = f1(ga0[13]);
+            } else {
+                f0(!(3), (i0 + i0), ga0[2], ga0[17], v0, (j0 != ga0[31]), !(v2));
+            }
+        }
+        break;
+    case 6:
+        v1 = v1 + 58;
+        if (g1 >= 0 && g1 < 33) { ga0[g1] = !(-(1059240243138)); }
+    }
+    v0 = v0 + ((long)(3) / (i0 * i0 + 1));
+    g0 = 258;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,4864 @@
+	.section .data
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.byte -42
+	.section .bss
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.section .text
+	.type rec, @function
+	.type f0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.type f1, @function
+	.type f0.constprop.0, @function
+	.type rec.constprop.3, @function
+	.type rec.constprop.4, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	cmpl $4, %edi
+	jb .L2
+	cmpl $18, %edi
+	ja .L2
+.L0:
+.L1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movl %edi, -32(%rbp)
+	movl %esi, -28(%rbp)
+	movl %edi, %eax
+	subl $3, %eax
+	movl %eax, -24(%rbp)
+	movl %esi, %eax
+	movl %eax, -20(%rbp)
+	cmpl $4, -24(%rbp)
+	jb .L6
+	cmpl $18, -24(%rbp)
+	jbe .L4
+.L6:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L3:
+	pushq %rax
+	movl -32(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -24(%rbp)
+	movl -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -20(%rbp)
+	cmpl $4, -24(%rbp)
+	jb .L34
+	cmpl $18, -24(%rbp)
+	jbe .L32
+.L34:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L31:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L4:
+.L5:
+	movl -24(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jb .L10
+	cmpl $18, -16(%rbp)
+	jbe .L8
+.L10:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L7:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jb .L22
+	cmpl $18, -16(%rbp)
+	jbe .L20
+.L22:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L19:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L3
+.L32:
+.L33:
+	movl -24(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jb .L38
+	cmpl $18, -16(%rbp)
+	jbe .L36
+.L38:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L35:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jb .L50
+	cmpl $18, -16(%rbp)
+	jbe .L48
+.L50:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L47:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L31
+.L8:
+.L9:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L14
+	cmpl $18, -8(%rbp)
+	jbe .L12
+.L14:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L11:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L18
+	cmpl $18, -8(%rbp)
+	jbe .L16
+.L18:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L15:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L7
+.L20:
+.L21:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L26
+	cmpl $18, -8(%rbp)
+	jbe .L24
+.L26:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L23:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L30
+	cmpl $18, -8(%rbp)
+	jbe .L28
+.L30:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L27:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L19
+.L36:
+.L37:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L42
+	cmpl $18, -8(%rbp)
+	jbe .L40
+.L42:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L39:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L46
+	cmpl $18, -8(%rbp)
+	jbe .L44
+.L46:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L43:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L35
+.L48:
+.L49:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L54
+	cmpl $18, -8(%rbp)
+	jbe .L52
+.L54:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L51:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L58
+	cmpl $18, -8(%rbp)
+	jbe .L56
+.L58:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L55:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L47
+.L12:
+.L13:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L11
+.L16:
+.L17:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L15
+.L24:
+.L25:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L23
+.L28:
+.L29:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L27
+.L40:
+.L41:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L39
+.L44:
+.L45:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L43
+.L52:
+.L53:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L51
+.L56:
+.L57:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L55
+.L2:
+	movl %esi, %eax
+	addl %edi, %eax
+	ret
+	.size rec, .-rec
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movq %rdx, -24(%rbp)
+	movl %ecx, -28(%rbp)
+	movb %r8b, -29(%rbp)
+	movl %r9d, -36(%rbp)
+	movw $9, -38(%rbp)
+	movw $-1, -40(%rbp)
+	movl $2, -44(%rbp)
+	movq $7, -56(%rbp)
+	movl $0, -44(%rbp)
+	imull $10, -44(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -44(%rbp)
+	jge .L59
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L62
+	.p2align 4,,10
+.L61:
+	addl $10, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $10, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $10, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $10, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -208(%rbp)
+	jne .L61
+.L62:
+.L59:
+.L60:
+	cmpl $33, -44(%rbp)
+	jge .L64
+	.p2align 4,,10
+.L63:
+	addl $10, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L63
+.L64:
+	movl $0, -44(%rbp)
+	movl $0, -240(%rbp)
+	movl $0, -236(%rbp)
+	movl $0, -232(%rbp)
+	movl $0, -228(%rbp)
+	movl $0, -224(%rbp)
+	movl $0, -220(%rbp)
+	movl $0, -216(%rbp)
+	movl $0, -212(%rbp)
+	movl $8, -44(%rbp)
+	movswl -38(%rbp), %eax
+	cmpl $1, %eax
+	seta %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	movsbl g1(%rip), %eax
+	cmpl %eax, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl -29(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	addl %ecx, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	cmpq -56(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -56(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jae .L65
+	movl ga0+64(%rip), %eax
+	imull -12(%rbp), %eax
+	movq %rax, -56(%rbp)
+	movswl -40(%rbp), %eax
+	addl -36(%rbp), %eax
+	movw %ax, -40(%rbp)
+	movswq -40(%rbp), %rax
+	movl -28(%rbp), %ecx
+	subq %rcx, %rax
+	movl %eax, -220(%rbp)
+.L66:
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L71
+	cmpq $1, %rax
+	je .L69
+	cmpq $3, %rax
+	je .L70
+.L72:
+	movsbl -29(%rbp), %eax
+	movl %eax, -244(%rbp)
+	imull -244(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L69
+	cmpl $0, -28(%rbp)
+	je .L76
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L77
+.L65:
+	movzwl g0(%rip), %eax
+	subl $598, %eax
+	movq %rax, %rcx
+	movsbl -29(%rbp), %eax
+	subl %ecx, %eax
+	jne .LB0
+.L67:
+.L68:
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	jmp .L66
+.L71:
+.L69:
+	movl $0, -36(%rbp)
+	cmpq $-9569, -24(%rbp)
+	seta %al
+	movzbl %al, %eax
+	addl $-376, %eax
+	movl %eax, -248(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L78
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L81
+	.p2align 4,,10
+.L80:
+	movl -248(%rbp), %eax
+	movw %ax, -38(%rbp)
+	addl $1, -36(%rbp)
+	movswl -38(%rbp), %eax
+	movw %ax, -38(%rbp)
+	addl $1, -36(%rbp)
+	movswl -38(%rbp), %eax
+	movw %ax, -38(%rbp)
+	addl $1, -36(%rbp)
+	movswl -38(%rbp), %eax
+	movw %ax, -38(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -256(%rbp)
+	jne .L80
+.L81:
+.L78:
+.L79:
+	cmpl $16, -36(%rbp)
+	jge .L83
+	.p2align 4,,10
+.L82:
+	movl -248(%rbp), %eax
+	movw %ax, -38(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L82
+.L83:
+	movl $0, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L73:
+	jmp .L69
+.L70:
+	movw $6, -38(%rbp)
+	jmp .L69
+.L74:
+.L75:
+	jmp .L69
+.LB0:
+	movq -8(%rbp), %rax
+	jmp .f0_return
+.L76:
+	movl $0, %eax
+.L77:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-1051773040586, %rax
+	subq %rcx, %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movl %edx, -20(%rbp)
+	movl %ecx, -24(%rbp)
+	movq %r8, -32(%rbp)
+	movw $9, -34(%rbp)
+	movw $-1, -36(%rbp)
+	movl $2, -40(%rbp)
+	movq $7, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $10, -40(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -40(%rbp)
+	jge .L84
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L87
+	.p2align 4,,10
+.L86:
+	addl $10, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $10, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $10, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $10, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -208(%rbp)
+	jne .L86
+.L87:
+.L84:
+.L85:
+	cmpl $33, -40(%rbp)
+	jge .L89
+	.p2align 4,,10
+.L88:
+	addl $10, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L88
+.L89:
+	movl $0, -40(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -240(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -40(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L92
+	.p2align 4,,10
+.L91:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L91
+	movl %ecx, -40(%rbp)
+.L92:
+.L90:
+	cmpl $8, -40(%rbp)
+	jge .L94
+	.p2align 4,,10
+.L93:
+	movslq -40(%rbp), %rax
+	movl $0, -240(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $8, -40(%rbp)
+	jl .L93
+.L94:
+	movswl -34(%rbp), %eax
+	cmpl $1, %eax
+	seta %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	movsbl g1(%rip), %eax
+	cmpl %eax, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl $2, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	cmpq -48(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -48(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jae .L95
+	movl ga0+64(%rip), %eax
+	imull $4294967295, %eax, %eax
+	movq %rax, -48(%rbp)
+	movswl -36(%rbp), %eax
+	addl -24(%rbp), %eax
+	movw %ax, -36(%rbp)
+	movswq -36(%rbp), %rax
+	movl -20(%rbp), %ecx
+	subq %rcx, %rax
+	movl %eax, -220(%rbp)
+.L96:
+	movl -24(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L101
+	cmpq $1, %rax
+	je .L99
+	cmpq $3, %rax
+	je .L100
+.L102:
+	movsbl g1(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $8680820740569200761, %rdx
+	imulq %rdx
+	sarq $3, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L99
+	cmpl $0, -20(%rbp)
+	je .L106
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L95:
+	movzwl g0(%rip), %eax
+	subl $598, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	subl %ecx, %eax
+	jne .LB1
+.L97:
+.L98:
+	xorl %eax, %eax
+	subq -48(%rbp), %rax
+	movq %rax, -16(%rbp)
+	jmp .L96
+.L101:
+.L99:
+	movl $0, -24(%rbp)
+	cmpq $-9569, -16(%rbp)
+	seta %al
+	movzbl %al, %eax
+	addl $-376, %eax
+	movl %eax, -244(%rbp)
+	cmpl $16, -24(%rbp)
+	jge .L108
+	movl $16, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L111
+	.p2align 4,,10
+.L110:
+	movl -244(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -24(%rbp)
+	movswl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -24(%rbp)
+	movswl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -24(%rbp)
+	movswl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -256(%rbp)
+	jne .L110
+.L111:
+.L108:
+.L109:
+	cmpl $16, -24(%rbp)
+	jge .L113
+	.p2align 4,,10
+.L112:
+	movl -244(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jl .L112
+.L113:
+	movl $0, %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L103:
+	jmp .L99
+.L100:
+	movw $6, -34(%rbp)
+	jmp .L99
+.L104:
+.L105:
+	jmp .L99
+.LB1:
+	movq -8(%rbp), %rax
+	jmp .f0.constprop.1_return
+.L106:
+	movl $0, %eax
+.L107:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-1051773040586, %rax
+	subq %rcx, %rax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movl %edx, -20(%rbp)
+	movb %cl, -21(%rbp)
+	movl %r8d, -28(%rbp)
+	movw $9, -30(%rbp)
+	movw $-1, -32(%rbp)
+	movl $2, -36(%rbp)
+	movq $7, -48(%rbp)
+	movl $0, -36(%rbp)
+	imull $10, -36(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L114
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L117
+	.p2align 4,,10
+.L116:
+	addl $10, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $10, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $10, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $10, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -208(%rbp)
+	jne .L116
+.L117:
+.L114:
+.L115:
+	cmpl $33, -36(%rbp)
+	jge .L119
+	.p2align 4,,10
+.L118:
+	addl $10, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L118
+.L119:
+	movl $0, -36(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -240(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -36(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L122
+	.p2align 4,,10
+.L121:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L121
+	movl %ecx, -36(%rbp)
+.L122:
+.L120:
+	cmpl $8, -36(%rbp)
+	jge .L124
+	.p2align 4,,10
+.L123:
+	movslq -36(%rbp), %rax
+	movl $0, -240(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L123
+.L124:
+	movswl -30(%rbp), %eax
+	cmpl $1, %eax
+	seta %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	movsbl g1(%rip), %eax
+	cmpl %eax, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -21(%rbp), %eax
+	movabsq $7198729394618361607, %rdx
+	imulq %rdx
+	sarq $5, %rdx
+	movl %edx, %eax
+	addl %ecx, %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	cmpq -48(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -48(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jae .L125
+	movl ga0+64(%rip), %eax
+	imull $9, %eax, %eax
+	movq %rax, -48(%rbp)
+	movswl -32(%rbp), %eax
+	addl -28(%rbp), %eax
+	movw %ax, -32(%rbp)
+	movswq -32(%rbp), %rax
+	movl -20(%rbp), %ecx
+	subq %rcx, %rax
+	movl %eax, -220(%rbp)
+.L126:
+	movl -28(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L131
+	cmpq $1, %rax
+	je .L129
+	cmpq $3, %rax
+	je .L130
+.L132:
+	movsbl -21(%rbp), %eax
+	movl %eax, -244(%rbp)
+	imull -244(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L129
+	cmpl $0, -20(%rbp)
+	je .L136
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L137
+.L125:
+	movzwl g0(%rip), %eax
+	subl $598, %eax
+	movq %rax, %rcx
+	movsbl -21(%rbp), %eax
+	subl %ecx, %eax
+	jne .LB2
+.L127:
+.L128:
+	xorl %eax, %eax
+	subq -48(%rbp), %rax
+	movq %rax, -16(%rbp)
+	jmp .L126
+.L131:
+.L129:
+	movl $0, -28(%rbp)
+	cmpq $-9569, -16(%rbp)
+	seta %al
+	movzbl %al, %eax
+	addl $-376, %eax
+	movl %eax, -248(%rbp)
+	cmpl $16, -28(%rbp)
+	jge .L138
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L141
+	.p2align 4,,10
+.L140:
+	movl -248(%rbp), %eax
+	movw %ax, -30(%rbp)
+	addl $1, -28(%rbp)
+	movswl -30(%rbp), %eax
+	movw %ax, -30(%rbp)
+	addl $1, -28(%rbp)
+	movswl -30(%rbp), %eax
+	movw %ax, -30(%rbp)
+	addl $1, -28(%rbp)
+	movswl -30(%rbp), %eax
+	movw %ax, -30(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -256(%rbp)
+	jne .L140
+.L141:
+.L138:
+.L139:
+	cmpl $16, -28(%rbp)
+	jge .L143
+	.p2align 4,,10
+.L142:
+	movl -248(%rbp), %eax
+	movw %ax, -30(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L142
+.L143:
+	movl $0, %eax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L133:
+	jmp .L129
+.L130:
+	movw $6, -30(%rbp)
+	jmp .L129
+.L134:
+.L135:
+	jmp .L129
+.LB2:
+	movq -8(%rbp), %rax
+	jmp .f0.constprop.2_return
+.L136:
+	movl $0, %eax
+.L137:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-1051773040586, %rax
+	subq %rcx, %rax
+	jmp .f0.constprop.2_return
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $416, %rsp
+	movb %dil, -1(%rbp)
+	movl $421, -8(%rbp)
+	movq $716, -16(%rbp)
+	movq $0, -24(%rbp)
+	movl $531, -28(%rbp)
+	movw $4, -30(%rbp)
+	movw $127, -32(%rbp)
+	movl $2, -36(%rbp)
+	movq $4, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	testl %eax, %eax
+	je .L144
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L147
+	.p2align 4,,10
+.L146:
+	movslq -36(%rbp), %rax
+	movabsq $246517206682, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movabsq $246517206682, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movabsq $246517206682, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movabsq $246517206682, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -208(%rbp)
+	jne .L146
+.L147:
+.L144:
+.L145:
+	cmpl $33, -36(%rbp)
+	jge .L149
+	.p2align 4,,10
+.L148:
+	movslq -36(%rbp), %rax
+	movabsq $246517206682, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L148
+.L149:
+	movl $0, -36(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L150
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -360(%rbp)
+	cmpq $0, -360(%rbp)
+	je .L153
+	.p2align 4,,10
+.L152:
+	movslq -36(%rbp), %rax
+	imull $5, -36(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	imull $5, -36(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	imull $5, -36(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	imull $5, -36(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -360(%rbp)
+	jne .L152
+.L153:
+.L150:
+.L151:
+	cmpl $33, -36(%rbp)
+	jge .L155
+	.p2align 4,,10
+.L154:
+	movslq -36(%rbp), %rax
+	imull $5, -36(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L154
+.L155:
+	movl -28(%rbp), %eax
+	movq %rax, -48(%rbp)
+	movsbl -1(%rbp), %eax
+	movl %eax, -364(%rbp)
+	movq %rax, %rcx
+	movl $423, %eax
+	subl %ecx, %eax
+	cmpl %eax, -364(%rbp)
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $65536, %eax
+	addl $6, %eax
+	pushq %rax
+	movl $9, %eax
+	movl ga0+52(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movsbl g1(%rip), %eax
+	movw %ax, -30(%rbp)
+	movl $4, %eax
+	subl $386, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	subl %ecx, %eax
+	testb %al, %al
+	je .L156
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpl $0, -36(%rbp)
+	jne .L158
+	movl $6, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L159
+.L158:
+	movl $1, %eax
+.L159:
+	movslq %eax, %rax
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	movb %al, -1(%rbp)
+	movl $537, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movzwl -30(%rbp), %eax
+	imulq -24(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl -8(%rbp), %eax
+	movq %rax, -376(%rbp)
+	movq %rax, %r8
+	movl -28(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -1(%rbp), %eax
+	movq %rax, %rdx
+	movl -28(%rbp), %eax
+	movq %rax, %rsi
+	movq -376(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movzbl %al, %eax
+	addq %rax, -16(%rbp)
+	jmp .L157
+.L156:
+	movq -48(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $7, %eax
+	cmpl $2, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movl $581, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	movswl -32(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $4, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movq %rax, %r9
+	movzwl g0(%rip), %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movl -120(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movzwl -30(%rbp), %eax
+	movq %rax, %rsi
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f0.constprop.2
+.L157:
+	movsbl -1(%rbp), %eax
+	movl %eax, -384(%rbp)
+	movq %rax, %rcx
+	movzwl -30(%rbp), %eax
+	movl %eax, -380(%rbp)
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -32(%rbp)
+	subq $8, %rsp
+	movl $287, %eax
+	pushq %rax
+	movl -384(%rbp), %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movzwl -30(%rbp), %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movq %rax, %rdx
+	movl $10095568, %eax
+	movq %rax, %rsi
+	movl ga0+16(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	subl $97, %eax
+	movb %al, -1(%rbp)
+	movl -380(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	jge .L160
+	movsbl -1(%rbp), %eax
+	movw %ax, -32(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+.L171:
+.L163:
+.L161:
+	cmpw $0, -32(%rbp)
+	jne .L172
+	movl -92(%rbp), %eax
+	cmpl $7, %eax
+	setg %al
+	movzbl %al, %eax
+	jmp .L173
+.L172:
+	movl $1, %eax
+.L173:
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L160:
+	subq $8, %rsp
+	movl $10, %eax
+	pushq %rax
+	movl $9, %eax
+	movq %rax, %r9
+	movl $-73, %eax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movzwl -30(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	cmpl -28(%rbp), %eax
+	seta %al
+	movzbl %al, %eax
+	movw %ax, -30(%rbp)
+	subq $8, %rsp
+	movl $2, %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movl $77, %eax
+	movq %rax, %r8
+	movl $127, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	movswl -32(%rbp), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl -36(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movzwl g0(%rip), %eax
+	subl $464, %eax
+	cmpl %eax, -36(%rbp)
+	je .L162
+	movl $65535, %eax
+	cmpl $10, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl $20, %eax
+	jl .L164
+	movl $10, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L165
+.L164:
+	movl $1, %eax
+.L165:
+	movw %ax, -32(%rbp)
+	jmp .L163
+.L162:
+	movl $0, -28(%rbp)
+	movl $519, %eax
+	addl $6, %eax
+	movl %eax, -388(%rbp)
+	cmpl $33, -28(%rbp)
+	jae .L166
+	movl $33, %eax
+	movl -28(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -400(%rbp)
+	cmpq $0, -400(%rbp)
+	je .L169
+	.p2align 4,,10
+.L168:
+	cmpl $0, -388(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movw %ax, -30(%rbp)
+	movl ga0+92(%rip), %eax
+	movswq %ax, %rax
+	addq $581, %rax
+	addq $469, %rax
+	movq %rax, -24(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -404(%rbp)
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $0, -388(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movw %ax, -30(%rbp)
+	movl ga0+92(%rip), %eax
+	movswq %ax, %rax
+	addq $581, %rax
+	addq $469, %rax
+	movq %rax, -24(%rbp)
+	movl -28(%rbp), %eax
+	movl -404(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -400(%rbp)
+	jne .L168
+.L169:
+.L166:
+.L167:
+	cmpl $33, -28(%rbp)
+	jae .L171
+	.p2align 4,,10
+.L170:
+	cmpl $0, -388(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movw %ax, -30(%rbp)
+	movl ga0+92(%rip), %eax
+	movswq %ax, %rax
+	addq $581, %rax
+	addq $469, %rax
+	movq %rax, -24(%rbp)
+	movl -8(%rbp), %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jb .L170
+	jmp .L171
+	.size f1, .-f1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movl %edi, -4(%rbp)
+	movq %rsi, -16(%rbp)
+	movl %edx, -20(%rbp)
+	movb %cl, -21(%rbp)
+	movl %r8d, -28(%rbp)
+	movq %r9, -40(%rbp)
+	movw $9, -42(%rbp)
+	movw $-1, -44(%rbp)
+	movl $2, -48(%rbp)
+	movq $7, -56(%rbp)
+	movl $0, -48(%rbp)
+	imull $10, -48(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -48(%rbp)
+	jge .L174
+	movl $33, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L177
+	.p2align 4,,10
+.L176:
+	addl $10, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $10, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $10, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $10, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -208(%rbp)
+	jne .L176
+.L177:
+.L174:
+.L175:
+	cmpl $33, -48(%rbp)
+	jge .L179
+	.p2align 4,,10
+.L178:
+	addl $10, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $33, -48(%rbp)
+	jl .L178
+.L179:
+	movl $0, -48(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -240(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -48(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L182
+	.p2align 4,,10
+.L181:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L181
+	movl %ecx, -48(%rbp)
+.L182:
+.L180:
+	cmpl $8, -48(%rbp)
+	jge .L184
+	.p2align 4,,10
+.L183:
+	movslq -48(%rbp), %rax
+	movl $0, -240(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $8, -48(%rbp)
+	jl .L183
+.L184:
+	movswl -42(%rbp), %eax
+	cmpl $1, %eax
+	seta %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	movsbl g1(%rip), %eax
+	cmpl %eax, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl -21(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	addl %ecx, %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	cmpq -56(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -56(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jae .L185
+	movl ga0+64(%rip), %eax
+	imull -4(%rbp), %eax
+	movq %rax, -56(%rbp)
+	movswl -44(%rbp), %eax
+	addl -28(%rbp), %eax
+	movw %ax, -44(%rbp)
+	movswq -44(%rbp), %rax
+	movl -20(%rbp), %ecx
+	subq %rcx, %rax
+	movl %eax, -220(%rbp)
+.L186:
+	movl -28(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L191
+	cmpq $1, %rax
+	je .L189
+	cmpq $3, %rax
+	je .L190
+.L192:
+	movsbl -21(%rbp), %eax
+	movl %eax, -244(%rbp)
+	imull -244(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L189
+	cmpl $0, -20(%rbp)
+	je .L196
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L197
+.L185:
+	movzwl g0(%rip), %eax
+	subl $598, %eax
+	movq %rax, %rcx
+	movsbl -21(%rbp), %eax
+	subl %ecx, %eax
+	jne .LB3
+.L187:
+.L188:
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -16(%rbp)
+	jmp .L186
+.L191:
+.L189:
+	movl $0, -28(%rbp)
+	cmpq $-9569, -16(%rbp)
+	seta %al
+	movzbl %al, %eax
+	addl $-376, %eax
+	movl %eax, -248(%rbp)
+	cmpl $16, -28(%rbp)
+	jge .L198
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L201
+	.p2align 4,,10
+.L200:
+	movl -248(%rbp), %eax
+	movw %ax, -42(%rbp)
+	addl $1, -28(%rbp)
+	movswl -42(%rbp), %eax
+	movw %ax, -42(%rbp)
+	addl $1, -28(%rbp)
+	movswl -42(%rbp), %eax
+	movw %ax, -42(%rbp)
+	addl $1, -28(%rbp)
+	movswl -42(%rbp), %eax
+	movw %ax, -42(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -256(%rbp)
+	jne .L200
+.L201:
+.L198:
+.L199:
+	cmpl $16, -28(%rbp)
+	jge .L203
+	.p2align 4,,10
+.L202:
+	movl -248(%rbp), %eax
+	movw %ax, -42(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L202
+.L203:
+	movl $0, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L193:
+	jmp .L189
+.L190:
+	movw $6, -42(%rbp)
+	jmp .L189
+.L194:
+.L195:
+	jmp .L189
+.LB3:
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+.L196:
+	movl $0, %eax
+.L197:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-1051773040586, %rax
+	subq %rcx, %rax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+rec.constprop.3:
+	cmpl $4, %edi
+	jb .L206
+	cmpl $18, %edi
+	ja .L206
+.L204:
+.L205:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $3, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jb .L210
+	cmpl $18, -12(%rbp)
+	jbe .L208
+.L210:
+	movl -12(%rbp), %eax
+	addl $10, %eax
+.L207:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jb .L238
+	cmpl $18, -12(%rbp)
+	jbe .L236
+.L238:
+	movl -12(%rbp), %eax
+	addl $11, %eax
+.L235:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L208:
+.L209:
+	movl -12(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L214
+	cmpl $18, -8(%rbp)
+	jbe .L212
+.L214:
+	movl -8(%rbp), %eax
+	addl $10, %eax
+.L211:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L226
+	cmpl $18, -8(%rbp)
+	jbe .L224
+.L226:
+	movl -8(%rbp), %eax
+	addl $11, %eax
+.L223:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L207
+.L236:
+.L237:
+	movl -12(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L242
+	cmpl $18, -8(%rbp)
+	jbe .L240
+.L242:
+	movl -8(%rbp), %eax
+	addl $11, %eax
+.L239:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $11, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jb .L254
+	cmpl $18, -16(%rbp)
+	jbe .L252
+.L254:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L251:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L235
+.L212:
+.L213:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jb .L218
+	cmpl $18, -4(%rbp)
+	jbe .L216
+.L218:
+	movl -4(%rbp), %eax
+	addl $10, %eax
+.L215:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jb .L222
+	cmpl $18, -4(%rbp)
+	jbe .L220
+.L222:
+	movl -4(%rbp), %eax
+	addl $11, %eax
+.L219:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L211
+.L224:
+.L225:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jb .L230
+	cmpl $18, -4(%rbp)
+	jbe .L228
+.L230:
+	movl -4(%rbp), %eax
+	addl $11, %eax
+.L227:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $11, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L234
+	cmpl $18, -8(%rbp)
+	jbe .L232
+.L234:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L231:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L223
+.L240:
+.L241:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jb .L246
+	cmpl $18, -4(%rbp)
+	jbe .L244
+.L246:
+	movl -4(%rbp), %eax
+	addl $11, %eax
+.L243:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $11, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L250
+	cmpl $18, -8(%rbp)
+	jbe .L248
+.L250:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L247:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L239
+.L252:
+.L253:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L258
+	cmpl $18, -8(%rbp)
+	jbe .L256
+.L258:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L255:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L262
+	cmpl $18, -8(%rbp)
+	jbe .L260
+.L262:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L259:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L251
+.L216:
+.L217:
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec.constprop.3
+	pushq %rax
+	subq $8, %rsp
+	movl $11, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L215
+.L220:
+.L221:
+	subq $8, %rsp
+	movl $11, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $11, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L219
+.L228:
+.L229:
+	subq $8, %rsp
+	movl $11, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $11, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L227
+.L232:
+.L233:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L231
+.L244:
+.L245:
+	subq $8, %rsp
+	movl $11, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $11, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L243
+.L248:
+.L249:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L247
+.L256:
+.L257:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L255
+.L260:
+.L261:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L259
+.L206:
+	movl %edi, %eax
+	addl $10, %eax
+	ret
+	.size rec.constprop.3, .-rec.constprop.3
+	.align 16
+rec.constprop.4:
+	cmpl $4, %edi
+	jb .L265
+	cmpl $18, %edi
+	ja .L265
+.L263:
+.L264:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $3, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jb .L269
+	cmpl $18, -12(%rbp)
+	jbe .L267
+.L269:
+	movl -12(%rbp), %eax
+	addl $5, %eax
+.L266:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jb .L297
+	cmpl $18, -12(%rbp)
+	jbe .L295
+.L297:
+	movl -12(%rbp), %eax
+	addl $6, %eax
+.L294:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L267:
+.L268:
+	movl -12(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L273
+	cmpl $18, -8(%rbp)
+	jbe .L271
+.L273:
+	movl -8(%rbp), %eax
+	addl $5, %eax
+.L270:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L285
+	cmpl $18, -8(%rbp)
+	jbe .L283
+.L285:
+	movl -8(%rbp), %eax
+	addl $6, %eax
+.L282:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L266
+.L295:
+.L296:
+	movl -12(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L301
+	cmpl $18, -8(%rbp)
+	jbe .L299
+.L301:
+	movl -8(%rbp), %eax
+	addl $6, %eax
+.L298:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jb .L313
+	cmpl $18, -16(%rbp)
+	jbe .L311
+.L313:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L310:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L294
+.L271:
+.L272:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jb .L277
+	cmpl $18, -4(%rbp)
+	jbe .L275
+.L277:
+	movl -4(%rbp), %eax
+	addl $5, %eax
+.L274:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jb .L281
+	cmpl $18, -4(%rbp)
+	jbe .L279
+.L281:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L278:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L270
+.L283:
+.L284:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jb .L289
+	cmpl $18, -4(%rbp)
+	jbe .L287
+.L289:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L286:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L293
+	cmpl $18, -8(%rbp)
+	jbe .L291
+.L293:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L290:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L282
+.L299:
+.L300:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jb .L305
+	cmpl $18, -4(%rbp)
+	jbe .L303
+.L305:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L302:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L309
+	cmpl $18, -8(%rbp)
+	jbe .L307
+.L309:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L306:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L298
+.L311:
+.L312:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L317
+	cmpl $18, -8(%rbp)
+	jbe .L315
+.L317:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L314:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jb .L321
+	cmpl $18, -8(%rbp)
+	jbe .L319
+.L321:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L318:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L310
+.L275:
+.L276:
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L274
+.L279:
+.L280:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L278
+.L287:
+.L288:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L286
+.L291:
+.L292:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L290
+.L303:
+.L304:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L302
+.L307:
+.L308:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L306
+.L315:
+.L316:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L314
+.L319:
+.L320:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L318
+.L265:
+	movl %edi, %eax
+	addl $5, %eax
+	ret
+	.size rec.constprop.4, .-rec.constprop.4
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $656, %rsp
+	movb $-1, -1(%rbp)
+	movb $2, -2(%rbp)
+	movabsq $160956282387, %rax
+	movq %rax, -16(%rbp)
+	movl $171, -20(%rbp)
+	movq $1, -32(%rbp)
+	movl $0, -20(%rbp)
+	imull $520, -20(%rbp), %eax
+	subl $520, %eax
+	movl %eax, -180(%rbp)
+	cmpl $33, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -184(%rbp)
+	testl %eax, %eax
+	je .L322
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L325
+	.p2align 4,,10
+.L324:
+	addl $520, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $520, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $520, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $520, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -192(%rbp)
+	jne .L324
+.L325:
+.L322:
+.L323:
+	cmpl $33, -20(%rbp)
+	jge .L327
+	.p2align 4,,10
+.L326:
+	addl $520, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L326
+.L327:
+	movl $0, -20(%rbp)
+	movl $0, -224(%rbp)
+	movl $2, -220(%rbp)
+	movl $4, -216(%rbp)
+	movl $6, -212(%rbp)
+	movl $8, -208(%rbp)
+	movl $10, -204(%rbp)
+	movl $12, -200(%rbp)
+	movl $14, -196(%rbp)
+	movl $8, -20(%rbp)
+	movzwl g0(%rip), %eax
+	movsbl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L335
+	leaq .L336(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L329
+	# table target .L333
+	# table target .L330
+	# table target .L332
+	# table target .L334
+	# table target .L331
+	jmp *%rcx
+.L335:
+.L329:
+.L580:
+.L581:
+.L328:
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movsbq -1(%rbp), %rax
+	addq %rcx, %rax
+	movb %al, -1(%rbp)
+	movw $258, g0(%rip)
+	movq $0, -632(%rbp)
+	imulq $31, -632(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	imulq $31, -632(%rbp), %rax
+	movsbq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	imulq $31, -632(%rbp), %rax
+	movsbq -1(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	imulq $31, -632(%rbp), %rax
+	movzbl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	imulq $31, -632(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -632(%rbp)
+	imulq $31, -632(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	imulq $31, -632(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -632(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $0, -184(%rbp)
+	je .L582
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -640(%rbp)
+	cmpq $0, -640(%rbp)
+	je .L585
+	.p2align 4,,10
+.L584:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -640(%rbp)
+	jne .L584
+.L585:
+.L582:
+.L583:
+	cmpl $33, -20(%rbp)
+	jge .L587
+	.p2align 4,,10
+.L586:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L586
+.L587:
+	movl $0, -20(%rbp)
+	cmpl $0, -184(%rbp)
+	je .L588
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -648(%rbp)
+	cmpq $0, -648(%rbp)
+	je .L591
+	.p2align 4,,10
+.L590:
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -648(%rbp)
+	jne .L590
+.L591:
+.L588:
+.L589:
+	cmpl $33, -20(%rbp)
+	jge .L593
+	.p2align 4,,10
+.L592:
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L592
+.L593:
+	movl $0, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jge .L594
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -656(%rbp)
+	cmpq $0, -656(%rbp)
+	je .L597
+	.p2align 4,,10
+.L596:
+	movslq -20(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -656(%rbp)
+	jne .L596
+.L597:
+.L594:
+.L595:
+	cmpl $8, -20(%rbp)
+	jge .L599
+	.p2align 4,,10
+.L598:
+	movslq -20(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -632(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L598
+.L599:
+	movq -632(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -632(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -632(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -632(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -632(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -632(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -632(%rbp)
+	movq -632(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L330:
+	movl ga0+80(%rip), %eax
+	movl %eax, -228(%rbp)
+	cmpl $4, -228(%rbp)
+	jb .L340
+	cmpl $18, -228(%rbp)
+	jbe .L338
+.L340:
+	movl -228(%rbp), %eax
+	addl $10, %eax
+.L337:
+	movl %eax, -80(%rbp)
+	jmp .L328
+.L338:
+.L339:
+	movl -228(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -248(%rbp)
+	cmpl $4, -248(%rbp)
+	jb .L344
+	cmpl $18, -248(%rbp)
+	jbe .L342
+.L344:
+	movl -248(%rbp), %eax
+	addl $10, %eax
+.L341:
+	pushq %rax
+	movl -228(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -232(%rbp)
+	cmpl $4, -232(%rbp)
+	jb .L356
+	cmpl $18, -232(%rbp)
+	jbe .L354
+.L356:
+	movl -232(%rbp), %eax
+	addl $11, %eax
+.L353:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L337
+.L342:
+.L343:
+	movl -248(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -256(%rbp)
+	cmpl $4, -256(%rbp)
+	jb .L348
+	cmpl $18, -256(%rbp)
+	jbe .L346
+.L348:
+	movl -256(%rbp), %eax
+	addl $10, %eax
+.L345:
+	pushq %rax
+	movl -248(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -252(%rbp)
+	cmpl $4, -252(%rbp)
+	jb .L352
+	cmpl $18, -252(%rbp)
+	jbe .L350
+.L352:
+	movl -252(%rbp), %eax
+	addl $11, %eax
+.L349:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L341
+.L354:
+.L355:
+	movl -232(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -244(%rbp)
+	cmpl $4, -244(%rbp)
+	jb .L360
+	cmpl $18, -244(%rbp)
+	jbe .L358
+.L360:
+	movl -244(%rbp), %eax
+	addl $11, %eax
+.L357:
+	pushq %rax
+	movl -232(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -236(%rbp)
+	movl $12, -240(%rbp)
+	cmpl $4, -236(%rbp)
+	jb .L364
+	cmpl $18, -236(%rbp)
+	jbe .L362
+.L364:
+	movl -240(%rbp), %eax
+	addl -236(%rbp), %eax
+.L361:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L353
+.L346:
+.L347:
+	movl -256(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec.constprop.3
+	pushq %rax
+	subq $8, %rsp
+	movl $11, %eax
+	movq %rax, %rsi
+	movl -256(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L345
+.L350:
+.L351:
+	subq $8, %rsp
+	movl $11, %eax
+	movq %rax, %rsi
+	movl -252(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -252(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L349
+.L358:
+.L359:
+	subq $8, %rsp
+	movl $11, %eax
+	movq %rax, %rsi
+	movl -244(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -244(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L357
+.L362:
+.L363:
+	movl -240(%rbp), %eax
+	movq %rax, %rsi
+	movl -236(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -240(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -236(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L361
+.L331:
+	movq -16(%rbp), %rax
+	testb %al, %al
+	je .L365
+	movq $3, -32(%rbp)
+	movzbl -2(%rbp), %eax
+	movl %eax, -260(%rbp)
+	movsbl -1(%rbp), %eax
+	movl %eax, -264(%rbp)
+	cmpl $4, -260(%rbp)
+	jb .L372
+	cmpl $18, -260(%rbp)
+	jbe .L370
+.L372:
+	movl -264(%rbp), %eax
+	addl -260(%rbp), %eax
+.L369:
+	movl %eax, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	je .L367
+	cmpw $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	addl $6, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movl %eax, -316(%rbp)
+	cmpl $4, -316(%rbp)
+	jb .L400
+	cmpl $18, -316(%rbp)
+	jbe .L398
+.L400:
+	movl -316(%rbp), %eax
+	addl $5, %eax
+.L397:
+	popq %rcx
+	cmpl %ecx, %eax
+	setb %al
+	movzbl %al, %eax
+	movb %al, g1(%rip)
+	movzwl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L425
+	movzwl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L425
+	movzwl g0(%rip), %eax
+	cmpq $1, -32(%rbp)
+	setle %cl
+	movzbl %cl, %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+.L425:
+.L426:
+	movq $-216, -32(%rbp)
+.L427:
+.L368:
+	jmp .L366
+.L365:
+	movl -196(%rbp), %eax
+	addl %eax, -20(%rbp)
+	movsbl -1(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movb %al, -2(%rbp)
+.L366:
+	movzbl -2(%rbp), %eax
+	cmpq $3, %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $848, %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cmpl %ecx, %eax
+	jg .L328
+	subq $8, %rsp
+	movq -32(%rbp), %rax
+	pushq %rax
+	movl $418, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movl $464, %eax
+	movq %rax, %rcx
+	movsbq g1(%rip), %rax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl ga0+80(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, -32(%rbp)
+.L455:
+.L456:
+	jmp .L328
+.L367:
+	movq $256, -32(%rbp)
+	movl -48(%rbp), %eax
+	movsbl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -348(%rbp)
+	movq -16(%rbp), %rax
+	movl %eax, -352(%rbp)
+	cmpl $4, -348(%rbp)
+	jb .L430
+	cmpl $18, -348(%rbp)
+	jbe .L428
+.L430:
+	movl -352(%rbp), %eax
+	addl -348(%rbp), %eax
+	jmp .L366
+.L370:
+.L371:
+	movl -260(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -292(%rbp)
+	movl -264(%rbp), %eax
+	movl %eax, -296(%rbp)
+	cmpl $4, -292(%rbp)
+	jb .L376
+	cmpl $18, -292(%rbp)
+	jbe .L374
+.L376:
+	movl -296(%rbp), %eax
+	addl -292(%rbp), %eax
+.L373:
+	pushq %rax
+	movl -260(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -268(%rbp)
+	movl -264(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -272(%rbp)
+	cmpl $4, -268(%rbp)
+	jb .L388
+	cmpl $18, -268(%rbp)
+	jbe .L386
+.L388:
+	movl -272(%rbp), %eax
+	addl -268(%rbp), %eax
+.L385:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L369
+.L398:
+.L399:
+	movl -316(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -336(%rbp)
+	cmpl $4, -336(%rbp)
+	jb .L404
+	cmpl $18, -336(%rbp)
+	jbe .L402
+.L404:
+	movl -336(%rbp), %eax
+	addl $5, %eax
+.L401:
+	pushq %rax
+	movl -316(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -320(%rbp)
+	cmpl $4, -320(%rbp)
+	jb .L416
+	cmpl $18, -320(%rbp)
+	jbe .L414
+.L416:
+	movl -320(%rbp), %eax
+	addl $6, %eax
+.L413:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L397
+.L428:
+.L429:
+	movl -348(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -380(%rbp)
+	movl -352(%rbp), %eax
+	movl %eax, -384(%rbp)
+	cmpl $4, -380(%rbp)
+	jb .L434
+	cmpl $18, -380(%rbp)
+	jbe .L432
+.L434:
+	movl -384(%rbp), %eax
+	addl -380(%rbp), %eax
+.L431:
+	pushq %rax
+	movl -348(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -356(%rbp)
+	movl -352(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -360(%rbp)
+	cmpl $4, -356(%rbp)
+	jb .L446
+	cmpl $18, -356(%rbp)
+	jbe .L444
+.L446:
+	movl -360(%rbp), %eax
+	addl -356(%rbp), %eax
+.L443:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L366
+.L374:
+.L375:
+	movl -292(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -308(%rbp)
+	movl -296(%rbp), %eax
+	movl %eax, -312(%rbp)
+	cmpl $4, -308(%rbp)
+	jb .L380
+	cmpl $18, -308(%rbp)
+	jbe .L378
+.L380:
+	movl -312(%rbp), %eax
+	addl -308(%rbp), %eax
+.L377:
+	pushq %rax
+	movl -292(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -300(%rbp)
+	movl -296(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -304(%rbp)
+	cmpl $4, -300(%rbp)
+	jb .L384
+	cmpl $18, -300(%rbp)
+	jbe .L382
+.L384:
+	movl -304(%rbp), %eax
+	addl -300(%rbp), %eax
+.L381:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L373
+.L386:
+.L387:
+	movl -268(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -284(%rbp)
+	movl -272(%rbp), %eax
+	movl %eax, -288(%rbp)
+	cmpl $4, -284(%rbp)
+	jb .L392
+	cmpl $18, -284(%rbp)
+	jbe .L390
+.L392:
+	movl -288(%rbp), %eax
+	addl -284(%rbp), %eax
+.L389:
+	pushq %rax
+	movl -268(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -276(%rbp)
+	movl -272(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -280(%rbp)
+	cmpl $4, -276(%rbp)
+	jb .L396
+	cmpl $18, -276(%rbp)
+	jbe .L394
+.L396:
+	movl -280(%rbp), %eax
+	addl -276(%rbp), %eax
+.L393:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L385
+.L402:
+.L403:
+	movl -336(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -344(%rbp)
+	cmpl $4, -344(%rbp)
+	jb .L408
+	cmpl $18, -344(%rbp)
+	jbe .L406
+.L408:
+	movl -344(%rbp), %eax
+	addl $5, %eax
+.L405:
+	pushq %rax
+	movl -336(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -340(%rbp)
+	cmpl $4, -340(%rbp)
+	jb .L412
+	cmpl $18, -340(%rbp)
+	jbe .L410
+.L412:
+	movl -340(%rbp), %eax
+	addl $6, %eax
+.L409:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L401
+.L414:
+.L415:
+	movl -320(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -332(%rbp)
+	cmpl $4, -332(%rbp)
+	jb .L420
+	cmpl $18, -332(%rbp)
+	jbe .L418
+.L420:
+	movl -332(%rbp), %eax
+	addl $6, %eax
+.L417:
+	pushq %rax
+	movl -320(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -324(%rbp)
+	movl $7, -328(%rbp)
+	cmpl $4, -324(%rbp)
+	jb .L424
+	cmpl $18, -324(%rbp)
+	jbe .L422
+.L424:
+	movl -328(%rbp), %eax
+	addl -324(%rbp), %eax
+.L421:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L413
+.L432:
+.L433:
+	movl -380(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -396(%rbp)
+	movl -384(%rbp), %eax
+	movl %eax, -400(%rbp)
+	cmpl $4, -396(%rbp)
+	jb .L438
+	cmpl $18, -396(%rbp)
+	jbe .L436
+.L438:
+	movl -400(%rbp), %eax
+	addl -396(%rbp), %eax
+.L435:
+	pushq %rax
+	movl -380(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -388(%rbp)
+	movl -384(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -392(%rbp)
+	cmpl $4, -388(%rbp)
+	jb .L442
+	cmpl $18, -388(%rbp)
+	jbe .L440
+.L442:
+	movl -392(%rbp), %eax
+	addl -388(%rbp), %eax
+.L439:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L431
+.L444:
+.L445:
+	movl -356(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -372(%rbp)
+	movl -360(%rbp), %eax
+	movl %eax, -376(%rbp)
+	cmpl $4, -372(%rbp)
+	jb .L450
+	cmpl $18, -372(%rbp)
+	jbe .L448
+.L450:
+	movl -376(%rbp), %eax
+	addl -372(%rbp), %eax
+.L447:
+	pushq %rax
+	movl -356(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -364(%rbp)
+	movl -360(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -368(%rbp)
+	cmpl $4, -364(%rbp)
+	jb .L454
+	cmpl $18, -364(%rbp)
+	jbe .L452
+.L454:
+	movl -368(%rbp), %eax
+	addl -364(%rbp), %eax
+.L451:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L443
+.L378:
+.L379:
+	movl -312(%rbp), %eax
+	movq %rax, %rsi
+	movl -308(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -312(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -308(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L377
+.L382:
+.L383:
+	subq $8, %rsp
+	movl -304(%rbp), %eax
+	movq %rax, %rsi
+	movl -300(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -304(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -300(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L381
+.L390:
+.L391:
+	subq $8, %rsp
+	movl -288(%rbp), %eax
+	movq %rax, %rsi
+	movl -284(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -288(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -284(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L389
+.L394:
+.L395:
+	movl -280(%rbp), %eax
+	movq %rax, %rsi
+	movl -276(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -280(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -276(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L393
+.L406:
+.L407:
+	subq $8, %rsp
+	movl -344(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -344(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L405
+.L410:
+.L411:
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -340(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -340(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L409
+.L418:
+.L419:
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -332(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -332(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L417
+.L422:
+.L423:
+	subq $8, %rsp
+	movl -328(%rbp), %eax
+	movq %rax, %rsi
+	movl -324(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -328(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -324(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L421
+.L436:
+.L437:
+	movl -400(%rbp), %eax
+	movq %rax, %rsi
+	movl -396(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -400(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -396(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L435
+.L440:
+.L441:
+	subq $8, %rsp
+	movl -392(%rbp), %eax
+	movq %rax, %rsi
+	movl -388(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -392(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -388(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L439
+.L448:
+.L449:
+	subq $8, %rsp
+	movl -376(%rbp), %eax
+	movq %rax, %rsi
+	movl -372(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -376(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -372(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L447
+.L452:
+.L453:
+	movl -368(%rbp), %eax
+	movq %rax, %rsi
+	movl -364(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -368(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -364(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L451
+.L332:
+	jmp .L328
+.L333:
+	movl $0, -20(%rbp)
+	xorl %eax, %eax
+	movzbl -2(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -404(%rbp)
+	movl $1, -408(%rbp)
+	movzbl -2(%rbp), %eax
+	cmpq -32(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -412(%rbp)
+	cmpl $3, -20(%rbp)
+	jge .L458
+	.p2align 4,,10
+.L457:
+	movq -32(%rbp), %rax
+	movl %eax, -416(%rbp)
+	cmpl $4, -416(%rbp)
+	jb .L464
+	cmpl $18, -416(%rbp)
+	jbe .L462
+.L464:
+	movl -416(%rbp), %eax
+	addl $998, %eax
+.L461:
+	testl %eax, %eax
+	jne .LB4
+.L459:
+.L460:
+	movzbl -2(%rbp), %eax
+	movl %eax, -460(%rbp)
+	testl %eax, %eax
+	je .L489
+	movl -20(%rbp), %eax
+	movl %eax, -464(%rbp)
+	movl -460(%rbp), %eax
+	movl %eax, -468(%rbp)
+	cmpl $4, -464(%rbp)
+	jb .L494
+	cmpl $18, -464(%rbp)
+	jbe .L492
+.L494:
+	movl -468(%rbp), %eax
+	addl -464(%rbp), %eax
+.L491:
+	testl %eax, %eax
+	je .L489
+	movsbl g1(%rip), %eax
+	imull -20(%rbp), %eax
+	cmpl %eax, -408(%rbp)
+	jle .L519
+	jmp .L458
+.L489:
+	movb $0, -1(%rbp)
+	movl -200(%rbp), %eax
+	movl -140(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $967, %eax
+	pushq %rax
+	movl -412(%rbp), %eax
+	pushq %rax
+	movl -164(%rbp), %eax
+	testl %eax, %eax
+	je .L521
+	movl -96(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L522
+.L521:
+	movl $0, %eax
+.L522:
+	pushq %rax
+	movzwl g0(%rip), %eax
+	movsbq %al, %rax
+	pushq %rax
+	cmpb $0, g1(%rip)
+	je .L523
+	movl -204(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L524
+.L523:
+	movl $0, %eax
+.L524:
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.0
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+.L490:
+	movl $3, %eax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	je .L525
+.L458:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movl $4, %eax
+	movq %rax, %r9
+	movl -212(%rbp), %eax
+	movq %rax, %r8
+	movl -216(%rbp), %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movq %rax, %rdx
+	movl -20(%rbp), %eax
+	movq %rax, %rsi
+	movl $394, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzbl %al, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L328
+	leaq .L534(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L528
+	# table target .L531
+	# table target .L532
+	# table target .L530
+	# table target .L529
+	jmp *%rcx
+.L525:
+.L526:
+	addl $1, -20(%rbp)
+	cmpl $3, -20(%rbp)
+	jl .L457
+	jmp .L458
+.L462:
+.L463:
+	movl -416(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -444(%rbp)
+	cmpl $4, -444(%rbp)
+	jb .L468
+	cmpl $18, -444(%rbp)
+	jbe .L466
+.L468:
+	movl -444(%rbp), %eax
+	addl $998, %eax
+.L465:
+	pushq %rax
+	movl -416(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -420(%rbp)
+	movl $999, -424(%rbp)
+	cmpl $4, -420(%rbp)
+	jb .L480
+	cmpl $18, -420(%rbp)
+	jbe .L478
+.L480:
+	movl -424(%rbp), %eax
+	addl -420(%rbp), %eax
+.L477:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L461
+.L533:
+.L528:
+.L579:
+.L527:
+	jmp .L328
+.L492:
+.L493:
+	movl -464(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -496(%rbp)
+	movl -468(%rbp), %eax
+	movl %eax, -500(%rbp)
+	cmpl $4, -496(%rbp)
+	jb .L498
+	cmpl $18, -496(%rbp)
+	jbe .L496
+.L498:
+	movl -500(%rbp), %eax
+	addl -496(%rbp), %eax
+.L495:
+	pushq %rax
+	movl -464(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -472(%rbp)
+	movl -468(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -476(%rbp)
+	cmpl $4, -472(%rbp)
+	jb .L510
+	cmpl $18, -472(%rbp)
+	jbe .L508
+.L510:
+	movl -476(%rbp), %eax
+	addl -472(%rbp), %eax
+.L507:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L491
+.L519:
+.L520:
+	movabsq $940910396941, %rax
+	cmpq %rax, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	movq $0, -16(%rbp)
+	jmp .L490
+.L466:
+.L467:
+	movl -444(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -456(%rbp)
+	cmpl $4, -456(%rbp)
+	jb .L472
+	cmpl $18, -456(%rbp)
+	jbe .L470
+.L472:
+	movl -456(%rbp), %eax
+	addl $998, %eax
+.L469:
+	pushq %rax
+	movl -444(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -448(%rbp)
+	movl $999, -452(%rbp)
+	cmpl $4, -448(%rbp)
+	jb .L476
+	cmpl $18, -448(%rbp)
+	jbe .L474
+.L476:
+	movl -452(%rbp), %eax
+	addl -448(%rbp), %eax
+.L473:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L465
+.L478:
+.L479:
+	movl -420(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -436(%rbp)
+	movl -424(%rbp), %eax
+	movl %eax, -440(%rbp)
+	cmpl $4, -436(%rbp)
+	jb .L484
+	cmpl $18, -436(%rbp)
+	jbe .L482
+.L484:
+	movl -440(%rbp), %eax
+	addl -436(%rbp), %eax
+.L481:
+	pushq %rax
+	movl -420(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -428(%rbp)
+	movl -424(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -432(%rbp)
+	cmpl $4, -428(%rbp)
+	jb .L488
+	cmpl $18, -428(%rbp)
+	jbe .L486
+.L488:
+	movl -432(%rbp), %eax
+	addl -428(%rbp), %eax
+.L485:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L477
+.L496:
+.L497:
+	movl -496(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -512(%rbp)
+	movl -500(%rbp), %eax
+	movl %eax, -516(%rbp)
+	cmpl $4, -512(%rbp)
+	jb .L502
+	cmpl $18, -512(%rbp)
+	jbe .L500
+.L502:
+	movl -516(%rbp), %eax
+	addl -512(%rbp), %eax
+.L499:
+	pushq %rax
+	movl -496(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -504(%rbp)
+	movl -500(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -508(%rbp)
+	cmpl $4, -504(%rbp)
+	jb .L506
+	cmpl $18, -504(%rbp)
+	jbe .L504
+.L506:
+	movl -508(%rbp), %eax
+	addl -504(%rbp), %eax
+.L503:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L495
+.L508:
+.L509:
+	movl -472(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -488(%rbp)
+	movl -476(%rbp), %eax
+	movl %eax, -492(%rbp)
+	cmpl $4, -488(%rbp)
+	jb .L514
+	cmpl $18, -488(%rbp)
+	jbe .L512
+.L514:
+	movl -492(%rbp), %eax
+	addl -488(%rbp), %eax
+.L511:
+	pushq %rax
+	movl -472(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -480(%rbp)
+	movl -476(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -484(%rbp)
+	cmpl $4, -480(%rbp)
+	jb .L518
+	cmpl $18, -480(%rbp)
+	jbe .L516
+.L518:
+	movl -484(%rbp), %eax
+	addl -480(%rbp), %eax
+.L515:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L507
+.L470:
+.L471:
+	movl $998, %eax
+	movq %rax, %rsi
+	movl -456(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $999, %eax
+	movq %rax, %rsi
+	movl -456(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L469
+.L474:
+.L475:
+	subq $8, %rsp
+	movl -452(%rbp), %eax
+	movq %rax, %rsi
+	movl -448(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -452(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -448(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L473
+.L482:
+.L483:
+	subq $8, %rsp
+	movl -440(%rbp), %eax
+	movq %rax, %rsi
+	movl -436(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -440(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -436(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L481
+.L486:
+.L487:
+	movl -432(%rbp), %eax
+	movq %rax, %rsi
+	movl -428(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -432(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -428(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L485
+.L500:
+.L501:
+	movl -516(%rbp), %eax
+	movq %rax, %rsi
+	movl -512(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -516(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -512(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L499
+.L504:
+.L505:
+	subq $8, %rsp
+	movl -508(%rbp), %eax
+	movq %rax, %rsi
+	movl -504(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -508(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -504(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L503
+.L512:
+.L513:
+	subq $8, %rsp
+	movl -492(%rbp), %eax
+	movq %rax, %rsi
+	movl -488(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -492(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -488(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L511
+.L516:
+.L517:
+	movl -484(%rbp), %eax
+	movq %rax, %rsi
+	movl -480(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -484(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -480(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L515
+.L529:
+	movl $0, -20(%rbp)
+	movl $1, -520(%rbp)
+	cmpq $4, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, -524(%rbp)
+	movl $20, -528(%rbp)
+	movsbl -1(%rbp), %eax
+	movl %eax, -536(%rbp)
+	imull -536(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -532(%rbp)
+	cmpl $33, -20(%rbp)
+	jge .L536
+	.p2align 4,,10
+.L535:
+	cmpl $0, -520(%rbp)
+	je .L537
+.L536:
+	movl -216(%rbp), %eax
+	movl %eax, -540(%rbp)
+	movl $7, -568(%rbp)
+	movl -540(%rbp), %eax
+	movl %eax, -572(%rbp)
+	cmpl $4, -568(%rbp)
+	jb .L547
+	cmpl $18, -568(%rbp)
+	jbe .L545
+.L547:
+	movl -572(%rbp), %eax
+	addl -568(%rbp), %eax
+.L544:
+	pushq %rax
+	movl $9, -544(%rbp)
+	movl -540(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -548(%rbp)
+	cmpl $4, -544(%rbp)
+	jb .L559
+	cmpl $18, -544(%rbp)
+	jbe .L557
+.L559:
+	movl -548(%rbp), %eax
+	addl -544(%rbp), %eax
+.L556:
+	popq %rcx
+	addl %ecx, %eax
+.L543:
+	cmpl $65535, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	imulq $2, -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	jle .L541
+	movl ga0+116(%rip), %eax
+	movb %al, -1(%rbp)
+	movq -16(%rbp), %rax
+	movl %eax, -20(%rbp)
+	cmpl $0, -20(%rbp)
+	jl .L328
+	cmpl $33, -20(%rbp)
+	jge .L328
+	movzbl -2(%rbp), %eax
+	cmpl $79, %eax
+	setg %al
+	movzbl %al, %eax
+	subl $-868, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+.L568:
+.L569:
+	jmp .L328
+.L541:
+	movzbl -2(%rbp), %eax
+	movl %eax, -592(%rbp)
+	imull $2147483647, %eax, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $722396313524, %rax
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	addl -592(%rbp), %eax
+	movb %al, -2(%rbp)
+	cmpl $0, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+.L542:
+	jmp .L328
+.L537:
+.L538:
+	cmpl $0, -524(%rbp)
+	je .L539
+	jmp .L536
+.L539:
+.L540:
+	movl -528(%rbp), %eax
+	cltd
+	idivl -532(%rbp)
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movb %al, g1(%rip)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L535
+	jmp .L536
+.L545:
+.L546:
+	movl -568(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -584(%rbp)
+	movl -572(%rbp), %eax
+	movl %eax, -588(%rbp)
+	cmpl $4, -584(%rbp)
+	jb .L551
+	cmpl $18, -584(%rbp)
+	jbe .L549
+.L551:
+	movl -588(%rbp), %eax
+	addl -584(%rbp), %eax
+.L548:
+	pushq %rax
+	movl -568(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -576(%rbp)
+	movl -572(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -580(%rbp)
+	cmpl $4, -576(%rbp)
+	jb .L555
+	cmpl $18, -576(%rbp)
+	jbe .L553
+.L555:
+	movl -580(%rbp), %eax
+	addl -576(%rbp), %eax
+.L552:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L544
+.L557:
+.L558:
+	movl -544(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -560(%rbp)
+	movl -548(%rbp), %eax
+	movl %eax, -564(%rbp)
+	cmpl $4, -560(%rbp)
+	jb .L563
+	cmpl $18, -560(%rbp)
+	jbe .L561
+.L563:
+	movl -564(%rbp), %eax
+	addl -560(%rbp), %eax
+.L560:
+	pushq %rax
+	movl -544(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -552(%rbp)
+	movl -548(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -556(%rbp)
+	cmpl $4, -552(%rbp)
+	jb .L567
+	cmpl $18, -552(%rbp)
+	jbe .L565
+.L567:
+	movl -556(%rbp), %eax
+	addl -552(%rbp), %eax
+.L564:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L556
+.L549:
+.L550:
+	movl -588(%rbp), %eax
+	movq %rax, %rsi
+	movl -584(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -588(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -584(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L548
+.L553:
+.L554:
+	subq $8, %rsp
+	movl -580(%rbp), %eax
+	movq %rax, %rsi
+	movl -576(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -580(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -576(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L552
+.L561:
+.L562:
+	subq $8, %rsp
+	movl -564(%rbp), %eax
+	movq %rax, %rsi
+	movl -560(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -564(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -560(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L560
+.L565:
+.L566:
+	movl -556(%rbp), %eax
+	movq %rax, %rsi
+	movl -552(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -556(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -552(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L564
+.L530:
+	movzwl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L570
+	movzwl g0(%rip), %eax
+	cmpl $33, %eax
+	jge .L570
+	movl ga0+80(%rip), %eax
+	movswl %ax, %eax
+	cmpl %eax, -20(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L570:
+.L571:
+	movl $0, -20(%rbp)
+	movq $-65533, -600(%rbp)
+	movl $0, -604(%rbp)
+	cmpl $8, -20(%rbp)
+	jge .L572
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -616(%rbp)
+	cmpq $0, -616(%rbp)
+	je .L575
+	.p2align 4,,10
+.L574:
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movw %ax, g0(%rip)
+	movq -600(%rbp), %rax
+	movb %al, -617(%rbp)
+	movq %rax, %rdi
+	call f1
+	movb %al, g1(%rip)
+	movl -604(%rbp), %eax
+	movw %ax, -620(%rbp)
+	movw %ax, g0(%rip)
+	addl $1, -20(%rbp)
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movw %ax, g0(%rip)
+	movsbl -617(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movb %al, g1(%rip)
+	movzwl -620(%rbp), %eax
+	movw %ax, g0(%rip)
+	addl $1, -20(%rbp)
+	subq $1, -616(%rbp)
+	jne .L574
+.L575:
+.L572:
+.L573:
+	cmpl $8, -20(%rbp)
+	jge .L328
+	.p2align 4,,10
+.L576:
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movw %ax, g0(%rip)
+	movq -600(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movb %al, g1(%rip)
+	movl -604(%rbp), %eax
+	movw %ax, g0(%rip)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L576
+.L577:
+	jmp .L328
+.L531:
+	jmp .L328
+.L532:
+	addq $2, -32(%rbp)
+	movl ga0+28(%rip), %eax
+	movslq %eax, %rax
+	addq -32(%rbp), %rax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	imull -20(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	cmpl -20(%rbp), %eax
+	jg .L578
+	movl -108(%rbp), %eax
+	cmpl $630, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f1
+	movl ga0+52(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, -16(%rbp)
+	jmp .L328
+.L578:
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	movl ga0+124(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movsbl -1(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+68(%rip), %eax
+	movq %rax, %rdx
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl -20(%rbp), %eax
+	addl -20(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	jmp .L328
+.L334:
+	movzbl -2(%rbp), %eax
+	addl $58, %eax
+	movb %al, -2(%rbp)
+	movsbl g1(%rip), %eax
+	testl %eax, %eax
+	jl .L580
+	movsbl g1(%rip), %eax
+	cmpl $33, %eax
+	jge .L580
+	movsbq g1(%rip), %rax
+	leaq ga0(%rip), %rdx
+	movl $0, (%rdx,%rax,4)
+	jmp .L581
+.LB4:
+	movl -404(%rbp), %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L336:
+	.long .L333-.L336
+	.long .L330-.L336
+	.long .L329-.L336
+	.long .L329-.L336
+	.long .L332-.L336
+	.long .L334-.L336
+	.long .L329-.L336
+	.long .L329-.L336
+	.long .L331-.L336
+	.p2align 2
+.L534:
+	.long .L531-.L534
+	.long .L528-.L534
+	.long .L532-.L534
+	.long .L530-.L534
+	.long .L528-.L534
+	.long .L528-.L534
+	.long .L528-.L534
+	.long .L529-.L534
+	.long .L529-.L534
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
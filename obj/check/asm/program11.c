@@ -0,0 +1,304 @@
+unsigned long g0;
+long g1 = 5L;
+unsigned short g2 = 128;
+int ga0[4];
+int ga1[33];
+unsigned short f0(unsigned short p0, char p1, short p2, long p3, long p4) {
+    unsigned long v0 = 5;
+    int v1 = 2l;
+    unsigned short v2 = 65536;
+    int i0 = 9;
+    long j0 = 8L;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 10L; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 2; }
+    if ((unsigned short)(p2)) { return (ga1[16] / 13ul); }
+    switch ((g0 - 8)) {
+    default:
+        break;
+    case 9:
+        if (0) { return 6; }
+        p2 = ((unsigned short)(p3) - ga0[2]);
+    case 8:
+        v0 = !(-(3));
+    }
+    i0 = (((v2 == la1[5]) && p3) || 2147483647);
+    if (-(p3)) {
+        p4 = (unsigned short)((unsigned short)(978));
+    }
+    p0 = (433ul && la1[11]);
+    return (unsigned char)((365L - (unsigned short)(v0)));
+}
+short f1(unsigned int p0, int p1) {
+    unsigned short v0 = 297920839462;
+    long v1 = 2;
+    int v2 = 274;
+    int i0 = 255;
+    long j0 = 722;
+    j0 = (((j0 - g2) <= (v1 && v0)) + (809 / (i0 * i0 + 1)));
+    if (f0((9 == g0), f0(v0, v1, g1, g1, 38), (2 / 1), f0(8, i0, 766, 128l, j0), p0)) {
+        f0(j0, f0(58084894583, 74166282137L, ga0[2], 8, p1), !(p1), !(7), (6 < j0));
+        switch (9) {
+        case 27:
+            for (v1 = 2; v1 < 100; v1 = v1 + 1) {
+                v0 = f0(946537860846, 552422082366u, (127 * ga1[18]), -(p1), !(ga0[0]));
+                v0 = 2147483647;
+                v2 = (!(532) || 768404274917);
+            }
+            i0 = (((6 / 8) > f0(32767, 10, j0, 8, 3)) || ga0[1]);
+        case 980:
+            f0((p0 && p0), (g0 > v2), (g1 && g2), (7 * 65536), 514L);
+            i0 = 0;
+            while (i0 < 4) {
+                if (ga1[i0] < v2) { v2 = ga1[i0]; }
+                if (ga1[i0] < p1) { p1 = ga1[i0]; }
+                if (((578 * ga1[16]) - (unsigned int)(7))) { break; }
+                i0 = i0 + 1;
+            }
+        case 2:
+            break;
+        case 70:
+            if ((!((g0 && i0)) > !(!(g1)))) {
+                f0((6 != 5), p1, 5, j0, (v1 * 911));
+                f0(-(v0), (p0 / 3u), 3, (v0 / (i0 * i0 + 1)), (p0 == g0));
+            } else {
+                f0((ga1[22] / 10), (char)(p1), (813 - g2), (unsigned short)(255), 7);
+                f0(871, (ga0[3] - 4), 747, (416 / (p0 * p0 + 1)), v0);
+                v1 = !(!((1000000007 || p1)));
+            }
+            if (!(((2 < g1) && (g1 + 735006299986)))) {
+                f0(7, (v1 != p0), 4, (514973962159 < 6), (5 - i0));
+                f0((311678653149 - i0), v1, (ga1[28] != 3), f0(v0, ga1[22], p1, 5, g2), 361);
+                f0((unsigned long)(i0), f0(v2, p1, j0, ga1[25], g0), v0, g2, (139 == 2));
+            } else {
+                f0((711 >= 256), 6u, (j0 / 8), (1 && j0), (g1 + v1));
+                j0 = (4 && ga0[2]);
+                f0(v1, (long)(v2), f0(7, g0, 255, i0, i0), (unsigned short)(650), (p1 / (p1 * p1 + 1)));
+            }
+            break;
+        case 45:
+            v0 = (f0(ga0[1], v2, i0, g1, i0) / 16);
+            v1 = (255 == p1);
+            break;
+        case -1:
+        }
+        switch ((!(g2) != f0(v1, i0, g2, 286, g1))) {
+        case 951:
+            f0(v2, 256, (10 + 32767), f0(g0, 54, 470489394785, g2, 5), -(g0));
+            break;
+        case 13:
+            break;
+        default:
+            if (((unsigned short)(1L) - (f0(g2, i0, 975, 1029458012097, i0) + (v2 / 4)))) {
+                f0((i0 + ga1[31]), g2, ga0[1], 336955350712, p0);
+            }
+            if ((unsigned short)(((v0 * ga0[3]) > (g0 / 5l)))) {
+                f0((119 > 65536), 8, (g0 - 9u), ga0[2], (int)(4));
+                f0(!(p1), (7l > 3), (j0 + g1), g1, (1 / 8));
+            }
+            break;
+        }
+    } else {
+        if (((836 >= !(880)) / 4)) {
+            v0 = 6;
+        } else {
+            f0(g2, (g2 == p1), (long)(61), f0(9ul, 880724950964, ga1[13], p1, 604ul), ga1[14]);
+            if ((unsigned long)((f0(708, p0, ga0[3], i0, 32767) / 1))) {
+                f0(!(p0), (ga0[1] == 65536U), (i0 && ga1[15]), (j0 / 1), 599);
+                if (g0) { return ((225757265814 / (j0 * j0 + 1)) - j0); }
+                p0 = ga1[31];
+            } else {
+                f0(4, !(i0), g0, (p0 / (v2 * v2 + 1)), (char)(529));
+                f0((v2 / 1), 517, j0, (9 <= 497u), f0(g1, 127, 8, j0, 8U));
+            }
+            if (2) { return ((j0 != 0) * (g2 > 548L)); }
+        }
+        j0 = j0 + ((286l > g2) <= 3);
+        if ((j0 <= (10 - p0))) {
+            if (643) {
+                f0(v2, -(7), v1, -(g1), ga1[2]);
+            }
+            if ((p0 && (unsigned int)(10))) { return (unsigned short)((10L / (i0 * i0 + 1))); }
+        } else {
+            p1 = p1 + ((int)(603) - (p0 >= 4));
+            f0(v0, (10 != 293), (unsigned long)(10), 796, (v0 - 128));
+            if ((4 / (p0 * p0 + 1))) {
+                f0((p1 != 1), (g2 != ga0[2]), 964887321592, (8 + g0), (short)(557));
+                f0((char)(g2), f0(4, g0, 3, 8, ga0[2]), (j0 < v2), 3, p1);
+            } else {
+                i0 = (v0 <= f0(i0, p1, v2, g0, ga0[0]));
+                p0 = v1;
+            }
+        }
+    }
+    for (v1 = 2; v1 < 4; v1 = v1 + 1) {
+        if (((unsigned int)((656158033884 != v0)) / (v2 * v2 + 1))) {
+            if (ga1[19]) {
+                if (((i0 > j0) / 8)) { break; }
+                if ((p0 < 1000000007)) { break; }
+            }
+            v0 = (128 / 1);
+            p0 = 741;
+        }
+    }
+    p1 = p1 + 1;
+    if ((i0 >= (5 / 13ul))) {
+        p1 = (v2 / (g0 * g0 + 1));
+        j0 = j0 + ((204 - 1000000007) * 7);
+    } else {
+        v0 = ((-(324) <= (ga1[4] > v1)) * f0(0, g0, 694, 1, 2));
+        v0 = ((long)(j0) / 3u);
+        if ((((unsigned char)(18) == g2) * !(291))) {
+            i0 = i0 + 8ul;
+        }
+    }
+    return (!(v1) == (f0(3U, ga0[3], 6, 24, v1) == (10 * 108)));
+}
+void w1(unsigned short q0) {
+    g0 = g0 * 3 + q0;
+    g1 = g1 * 3 + q0;
+}
+unsigned char f2(char p0) {
+    unsigned long v0 = 840U;
+    int v1 = 364;
+    short v2 = 32767;
+    long v3 = 8;
+    int i0 = 4;
+    long j0 = 7;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 988; }
+    if ((i0 != ((5 / (v2 * v2 + 1)) != (935 == ga1[31])))) {
+        v1 = !(g1);
+        p0 = ((7 > (4 / (g1 * g1 + 1))) && (718 != (2 / 3)));
+        f0((g1 * v0), (p0 / (v3 * v3 + 1)), (ga1[1] || g1), 96, 482039162622);
+    }
+    for (v2 = 0; v2 < 3; v2 = v2 + 1) {
+        v1 = 0;
+        while (v1 < 5) {
+            if ((((8 / 13ul) || ga1[16]) / 100)) {
+                if (v2) { break; }
+            }
+            v1 = v1 + 1;
+        }
+    }
+    v2 = v2 + (v2 / (g0 * g0 + 1));
+    v0 = (((3 - v0) / 1024) / (v3 * v3 + 1));
+    if (g0 >= 0 && g0 < 33) { la0[g0] = (v0 || (v0 <= v1)); }
+    for (j0 = 0; j0 < 5; j0 = j0 + 1) {
+        i0 = ga1[32];
+        f0(512813260512, (int)(g2), (j0 / (g2 * g2 + 1)), f0(3, g2, 531, 1070091104957, 4294967295), (v3 - 9));
+        if ((f1(j0, ga1[20]) || (f1(981, i0) / 7))) {
+            v2 = ((!(i0) != 10) && (!(g0) / (v0 * v0 + 1)));
+            v2 = 0;
+            while (v2 < 16) {
+                v0 = f1((v0 / 5l), !(v2));
+                v0 = v0 + (int)(g1);
+                if (6) { break; }
+                v2 = v2 + 1;
+            }
+            i0 = ((5 + (unsigned char)(j0)) >= ((v2 > g2) / 1));
+        } else {
+            v3 = v3 + ((i0 * 1) * (char)(v2));
+            v1 = !(v0);
+            p0 = p0 + ((0 - g1) - 128);
+        }
+    }
+    j0 = ((v0 >= 4) != (5 > 2));
+    if ((g1 && (!(g1) && (unsigned int)(932)))) {
+        switch (((int)(65535u) / 1024)) {
+        case -1:
+            p0 = 656;
+            if (((0 && (7 != i0)) < -(g0))) {
+                f0((char)(590), g0, (700671948675 || 1), la0[31], 86940077775);
+            } else {
+                f1((256 > g1), (862 >= v1));
+            }
+            break;
+        case 43:
+            switch (f0(v0, g2, 10, 255, 900499296823)) {
+            case 9:
+                v1 = v1;
+                break;
+            case 5:
+                break;
+            case 4:
+                f1(v3, i0);
+            case 1:
+                break;
+            case 10:
+                f0((430 <= 255), 989, 5, (p0 <= ga1[20]), f1(g1, ga1[15]));
+                break;
+            default:
+                break;
+            case 7:
+            }
+            break;
+        case 687:
+            f0(f0(ga0[3], 2, 7, 1000000007, 340), 0, (int)(9), (v2 < v2), (9 + 32767));
+            break;
+        case 95:
+            v3 = (-(605) / (i0 * i0 + 1));
+            v3 = v3 + 90;
+            break;
+        default:
+            j0 = f0((65536 - g2), (8 < 0), 422L, (1004055249465 + g1), f0(255, 1, 3, v1, p0));
+            j0 = j0 + ((g0 + v1) / 1);
+            break;
+        case -3:
+            if (-(10)) { return 724; }
+            break;
+        }
+        v1 = v1 + -(93155297026);
+        if (((v2 - 3) / 1)) {
+            j0 = (((v2 || 4) - 0) <= ((4294967295 == v1) / (g2 * g2 + 1)));
+            v0 = (la0[14] || g0);
+            i0 = 0;
+            while (i0 < 5) {
+                la0[i0] = (unsigned short)(v1);
+                if (3) { break; }
+                la0[i0] = (2l - 0);
+                i0 = i0 + 1;
+            }
+        } else {
+            f0((834 > g0), 1000000007, 10, g0, !(586486527585));
+            v2 = 7;
+        }
+    } else {
+        v2 = i0;
+        v2 = (j0 > (unsigned short)(65535));
+    }
+    return (long)((-(2) < g2));
+}
+int main() {
+    unsigned char v0 = 6;
+    unsigned char v1 = 0;
+    int v2 = 70;
+    unsigned int v3 = 3;
+    int i0 = 9;
+    long j0 = 831;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 8; }
+    g1 = (short)((int)((long)(7)));
+    v1 = 472529550990;
+    g1 = ((-(4) != (2L + v0)) || 283021649457l);
+    i0 = i0 + g2;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
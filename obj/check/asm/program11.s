@@ -0,0 +1,441 @@
+	.section .data
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.quad 5
+	.type g2, @object
+	.size g2, 2
+	.p2align 1
+g2:
+	.short 128
+	.section .bss
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movb $6, -1(%rbp)
+	movb $0, -2(%rbp)
+	movl $70, -8(%rbp)
+	movl $3, -12(%rbp)
+	movl $9, -16(%rbp)
+	movq $831, -24(%rbp)
+	movl $0, -16(%rbp)
+	imull $10, -16(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -164(%rbp)
+	cmpl $33, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -168(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	addl $10, -164(%rbp)
+	movslq -16(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	addl $10, -164(%rbp)
+	movslq -16(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	addl $10, -164(%rbp)
+	movslq -16(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	addl $10, -164(%rbp)
+	movslq -16(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	subq $1, -176(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -16(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $10, -164(%rbp)
+	movslq -16(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L4
+.L5:
+	movl $0, -16(%rbp)
+	movl $0, -208(%rbp)
+	movl $8, -204(%rbp)
+	movl $16, -200(%rbp)
+	movl $24, -196(%rbp)
+	movl $32, -192(%rbp)
+	movl $40, -188(%rbp)
+	movl $48, -184(%rbp)
+	movl $56, -180(%rbp)
+	movl $8, -16(%rbp)
+	movq $7, g1(%rip)
+	movb $142, -2(%rbp)
+	movzbl -1(%rbp), %eax
+	movq %rax, -216(%rbp)
+	addq $2, %rax
+	cmpq $-4, %rax
+	jne .L6
+	movabsq $283021649457, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L7
+.L6:
+	movl $1, %eax
+.L7:
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	movzwl g2(%rip), %eax
+	addl %eax, -16(%rbp)
+	movq $0, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	movzwl g2(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	addq -216(%rbp), %rax
+	movq %rax, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	movzbl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	movslq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	movl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	imulq $31, -224(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -224(%rbp)
+	movl $0, -16(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	movl $4, -16(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $0, -168(%rbp)
+	je .L8
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L9
+	.p2align 4,,10
+.L10:
+	movslq -16(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -232(%rbp)
+	jne .L10
+.L11:
+.L8:
+.L9:
+	cmpl $33, -16(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movslq -16(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L12
+.L13:
+	movl $0, -16(%rbp)
+	cmpl $0, -168(%rbp)
+	je .L14
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L15
+	.p2align 4,,10
+.L16:
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -240(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $33, -16(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L18
+.L19:
+	movl $0, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	jge .L20
+	movl $8, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -248(%rbp)
+	cmpq $0, -248(%rbp)
+	je .L21
+	.p2align 4,,10
+.L22:
+	movslq -16(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -248(%rbp)
+	jne .L22
+.L23:
+.L20:
+.L21:
+	cmpl $8, -16(%rbp)
+	jge .L25
+	.p2align 4,,10
+.L24:
+	movslq -16(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -224(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	jl .L24
+.L25:
+	movq -224(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -224(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -224(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -224(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -224(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -224(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -224(%rbp)
+	movq -224(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,72 @@
+int ga0[16];
+long rec(long n, long acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 3, acc);
+}
+int main() {
+    unsigned short v0 = 848;
+    long v1 = 65535;
+    int i0 = 143;
+    long j0 = 313;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 964847538790U; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 1; }
+    switch (9) {
+    default:
+        if (j0 >= 0 && j0 < 8) { la0[j0] = -(rec(127, la1[1])); }
+    case 10:
+        if ((rec(9, i0) > (v1 && 1000000007L))) { return j0; }
+        break;
+    }
+    rec((unsigned char)(366), (v1 != v1));
+    for (i0 = 2; i0 < 4; i0 = i0 + 1) {
+        v1 = 0;
+        while (v1 < 100) {
+            j0 = rec(ga0[15], (i0 <= 237l));
+            for (j0 = 1; j0 < 16; j0 = j0 + 1) {
+                if ((char)(256)) { break; }
+                v0 = rec((la1[4] && i0), v1);
+            }
+            v0 = -((v1 + (la1[6] == ga0[14])));
+            v1 = v1 + 1;
+        }
+    }
+    switch ((ga0[2] - 224)) {
+    case 0:
+    case 3:
+        if (((v1 + i0) <= (la1[7] != 903449277111))) { return (j0 + (i0 / 100)); }
+        for (i0 = 2; i0 < 100; i0 = i0 + 1) {
+            for (j0 = 0; j0 < 3; j0 = j0 + 1) {
+                v1 = -(j0);
+            }
+        }
+        break;
+    }
+    i0 = v1;
+    i0 = i0 + (604ul + 7);
+    ga0[4] = !((unsigned short)(v1));
+    if (!(-((ga0[4] / (i0 * i0 + 1))))) {
+        if ((!((266182410056 * 65535)) + (char)(-(i0)))) {
+            rec((la1[1] - la1[3]), 782);
+        }
+    } else {
+        for (i0 = 0; i0 < 4; i0 = i0 + 1) {
+            ga0[i0] = la1[5];
+            if ((((i0 > i0) == (v1 < i0)) * ((long)(i0) && (v1 && v0)))) {
+                j0 = j0 + v0;
+                if (((1 - 7) >= j0)) { break; }
+            }
+        }
+    }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2167 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.section .text
+	.type rec, @function
+	.type rec.constprop.3, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	cmpq $4, %rdi
+	jl .L2
+	cmpq $18, %rdi
+	jg .L2
+.L0:
+.L1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rdi, -64(%rbp)
+	movq %rsi, -56(%rbp)
+	movq %rdi, %rax
+	subq $3, %rax
+	movq %rax, -48(%rbp)
+	movq %rsi, %rax
+	movq %rax, -40(%rbp)
+	cmpq $4, -48(%rbp)
+	jl .L6
+	cmpq $18, -48(%rbp)
+	jle .L4
+.L6:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L3:
+	pushq %rax
+	movq -64(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -48(%rbp)
+	movq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -40(%rbp)
+	cmpq $4, -48(%rbp)
+	jl .L34
+	cmpq $18, -48(%rbp)
+	jle .L32
+.L34:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L31:
+	popq %rcx
+	addq %rcx, %rax
+	leave
+	ret
+.L4:
+.L5:
+	movq -48(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L10
+	cmpq $18, -32(%rbp)
+	jle .L8
+.L10:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L7:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L22
+	cmpq $18, -32(%rbp)
+	jle .L20
+.L22:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L19:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L3
+.L32:
+.L33:
+	movq -48(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L38
+	cmpq $18, -32(%rbp)
+	jle .L36
+.L38:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L35:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L50
+	cmpq $18, -32(%rbp)
+	jle .L48
+.L50:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L47:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L31
+.L8:
+.L9:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L14
+	cmpq $18, -16(%rbp)
+	jle .L12
+.L14:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L11:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L18
+	cmpq $18, -16(%rbp)
+	jle .L16
+.L18:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L15:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L7
+.L20:
+.L21:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L26
+	cmpq $18, -16(%rbp)
+	jle .L24
+.L26:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L23:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L30
+	cmpq $18, -16(%rbp)
+	jle .L28
+.L30:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L27:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L19
+.L36:
+.L37:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L42
+	cmpq $18, -16(%rbp)
+	jle .L40
+.L42:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L39:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L46
+	cmpq $18, -16(%rbp)
+	jle .L44
+.L46:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L43:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L35
+.L48:
+.L49:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L54
+	cmpq $18, -16(%rbp)
+	jle .L52
+.L54:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L51:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L58
+	cmpq $18, -16(%rbp)
+	jle .L56
+.L58:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L55:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L47
+.L12:
+.L13:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L11
+.L16:
+.L17:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L15
+.L24:
+.L25:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L23
+.L28:
+.L29:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L27
+.L40:
+.L41:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L39
+.L44:
+.L45:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L43
+.L52:
+.L53:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L51
+.L56:
+.L57:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L55
+.L2:
+	movq %rsi, %rax
+	addq %rdi, %rax
+	ret
+	.size rec, .-rec
+	.align 16
+rec.constprop.3:
+	cmpq $4, %rdi
+	jl .L61
+	cmpq $18, %rdi
+	jg .L61
+.L59:
+.L60:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rdi, -32(%rbp)
+	movq %rdi, %rax
+	subq $3, %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -24(%rbp)
+	jl .L65
+	cmpq $18, -24(%rbp)
+	jle .L63
+.L65:
+	movq -24(%rbp), %rax
+	addq $782, %rax
+.L62:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -24(%rbp)
+	jl .L93
+	cmpq $18, -24(%rbp)
+	jle .L91
+.L93:
+	movq -24(%rbp), %rax
+	addq $783, %rax
+.L90:
+	popq %rcx
+	addq %rcx, %rax
+	leave
+	ret
+.L63:
+.L64:
+	movq -24(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L69
+	cmpq $18, -16(%rbp)
+	jle .L67
+.L69:
+	movq -16(%rbp), %rax
+	addq $782, %rax
+.L66:
+	pushq %rax
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L81
+	cmpq $18, -16(%rbp)
+	jle .L79
+.L81:
+	movq -16(%rbp), %rax
+	addq $783, %rax
+.L78:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L62
+.L91:
+.L92:
+	movq -24(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L97
+	cmpq $18, -16(%rbp)
+	jle .L95
+.L97:
+	movq -16(%rbp), %rax
+	addq $783, %rax
+.L94:
+	pushq %rax
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movl $783, %eax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L109
+	cmpq $18, -32(%rbp)
+	jle .L107
+.L109:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L106:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L90
+.L67:
+.L68:
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	jl .L73
+	cmpq $18, -8(%rbp)
+	jle .L71
+.L73:
+	movq -8(%rbp), %rax
+	addq $782, %rax
+.L70:
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	jl .L77
+	cmpq $18, -8(%rbp)
+	jle .L75
+.L77:
+	movq -8(%rbp), %rax
+	addq $783, %rax
+.L74:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L66
+.L79:
+.L80:
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	jl .L85
+	cmpq $18, -8(%rbp)
+	jle .L83
+.L85:
+	movq -8(%rbp), %rax
+	addq $783, %rax
+.L82:
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movl $783, %eax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L89
+	cmpq $18, -16(%rbp)
+	jle .L87
+.L89:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L86:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L78
+.L95:
+.L96:
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	jl .L101
+	cmpq $18, -8(%rbp)
+	jle .L99
+.L101:
+	movq -8(%rbp), %rax
+	addq $783, %rax
+.L98:
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movl $783, %eax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L105
+	cmpq $18, -16(%rbp)
+	jle .L103
+.L105:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L102:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L94
+.L107:
+.L108:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L113
+	cmpq $18, -16(%rbp)
+	jle .L111
+.L113:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L110:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L117
+	cmpq $18, -16(%rbp)
+	jle .L115
+.L117:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L114:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L106
+.L71:
+.L72:
+	movq -8(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec.constprop.3
+	pushq %rax
+	subq $8, %rsp
+	movl $783, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L70
+.L75:
+.L76:
+	subq $8, %rsp
+	movl $783, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $783, %eax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L74
+.L83:
+.L84:
+	subq $8, %rsp
+	movl $783, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $783, %eax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L82
+.L87:
+.L88:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L86
+.L99:
+.L100:
+	subq $8, %rsp
+	movl $783, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $783, %eax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L98
+.L103:
+.L104:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L102
+.L111:
+.L112:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L110
+.L115:
+.L116:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L114
+.L61:
+	movq %rdi, %rax
+	addq $782, %rax
+	ret
+	.size rec.constprop.3, .-rec.constprop.3
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $560, %rsp
+	movw $848, -2(%rbp)
+	movq $65535, -16(%rbp)
+	movl $143, -20(%rbp)
+	movq $313, -32(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -68(%rbp)
+	testl %eax, %eax
+	je .L118
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -80(%rbp)
+	cmpq $0, -80(%rbp)
+	je .L121
+	.p2align 4,,10
+.L120:
+	movslq -20(%rbp), %rax
+	movabsq $964847538790, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movabsq $964847538790, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movabsq $964847538790, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movabsq $964847538790, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -80(%rbp)
+	jne .L120
+.L121:
+.L118:
+.L119:
+	cmpl $8, -20(%rbp)
+	jge .L123
+	.p2align 4,,10
+.L122:
+	movslq -20(%rbp), %rax
+	movabsq $964847538790, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L122
+.L123:
+	movl $0, -20(%rbp)
+	movl $0, -112(%rbp)
+	movl $1, -108(%rbp)
+	movl $2, -104(%rbp)
+	movl $3, -100(%rbp)
+	movl $4, -96(%rbp)
+	movl $5, -92(%rbp)
+	movl $6, -88(%rbp)
+	movl $7, -84(%rbp)
+	movl $8, -20(%rbp)
+	movl $9, %eax
+	movslq %eax, %rax
+	cmpq $10, %rax
+	je .L126
+.L125:
+	cmpq $0, -32(%rbp)
+	jl .L127
+	cmpq $8, -32(%rbp)
+	jge .L127
+	movl -108(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -120(%rbp)
+	movq -120(%rbp), %rax
+	addq $127, %rax
+.L129:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+.L127:
+.L128:
+.L126:
+	cmpq $0, -16(%rbp)
+	je .L132
+	movl $1000000007, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L133
+.L132:
+	movl $0, %eax
+.L133:
+	movslq %eax, %rax
+	pushq %rax
+	movslq -20(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movq -128(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movq $3, -200(%rbp)
+	movq -176(%rbp), %rax
+	movq %rax, -208(%rbp)
+	cmpq $4, -200(%rbp)
+	jl .L139
+	cmpq $18, -200(%rbp)
+	jle .L137
+.L139:
+	movq -208(%rbp), %rax
+	addq -200(%rbp), %rax
+.L136:
+	pushq %rax
+	movq $5, -184(%rbp)
+	movq -176(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -192(%rbp)
+	cmpq $4, -184(%rbp)
+	jl .L143
+	cmpq $18, -184(%rbp)
+	jle .L141
+.L143:
+	movq -192(%rbp), %rax
+	addq -184(%rbp), %rax
+.L140:
+	popq %rcx
+	addq %rcx, %rax
+.L135:
+	pushq %rax
+	movq -128(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -136(%rbp)
+	movq $5, -160(%rbp)
+	movq -136(%rbp), %rax
+	movq %rax, -168(%rbp)
+	cmpq $4, -160(%rbp)
+	jl .L148
+	cmpq $18, -160(%rbp)
+	jle .L146
+.L148:
+	movq -168(%rbp), %rax
+	addq -160(%rbp), %rax
+.L145:
+	pushq %rax
+	movq $7, -144(%rbp)
+	movq -136(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -152(%rbp)
+	cmpq $4, -144(%rbp)
+	jl .L152
+	cmpq $18, -144(%rbp)
+	jle .L150
+.L152:
+	movq -152(%rbp), %rax
+	addq -144(%rbp), %rax
+.L149:
+	popq %rcx
+	addq %rcx, %rax
+.L144:
+	popq %rcx
+	addq %rcx, %rax
+.L134:
+	popq %rcx
+	cmpq %rcx, %rax
+	jg .LB0
+.L130:
+.L131:
+.L124:
+	movq -16(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -216(%rbp)
+	movq -216(%rbp), %rax
+	addq $110, %rax
+.L153:
+	movl $2, -20(%rbp)
+	cmpl $4, -20(%rbp)
+	jge .L155
+	.p2align 4,,10
+.L154:
+	movq $0, -16(%rbp)
+	cmpq $100, -16(%rbp)
+	jge .L157
+	.p2align 4,,10
+.L156:
+	movl ga0+60(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -224(%rbp)
+	movslq -20(%rbp), %rax
+	cmpq $237, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -232(%rbp)
+	cmpq $4, -224(%rbp)
+	jl .L161
+	cmpq $18, -224(%rbp)
+	jle .L159
+.L161:
+	movq -232(%rbp), %rax
+	addq -224(%rbp), %rax
+.L158:
+	movq %rax, -32(%rbp)
+	movq $1, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jge .L187
+	.p2align 4,,10
+.L186:
+	movl -96(%rbp), %eax
+	testl %eax, %eax
+	je .L189
+	cmpl $0, -20(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L190
+.L189:
+	movl $0, %eax
+.L190:
+	movslq %eax, %rax
+	movq %rax, -336(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, -344(%rbp)
+	cmpq $4, -336(%rbp)
+	jl .L193
+	cmpq $18, -336(%rbp)
+	jle .L191
+.L193:
+	movq -344(%rbp), %rax
+	addq -336(%rbp), %rax
+.L188:
+	movw %ax, -2(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jl .L186
+.L187:
+	movl -88(%rbp), %eax
+	movl ga0+56(%rip), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movw %ax, -2(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $100, -16(%rbp)
+	jl .L156
+.L157:
+	addl $1, -20(%rbp)
+	cmpl $4, -20(%rbp)
+	jl .L154
+.L155:
+	movl ga0+8(%rip), %eax
+	subl $224, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L219
+	cmpq $3, %rax
+	je .L219
+	jmp .L218
+.L191:
+.L192:
+	movq -336(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -400(%rbp)
+	movq -344(%rbp), %rax
+	movq %rax, -408(%rbp)
+	cmpq $4, -400(%rbp)
+	jl .L197
+	cmpq $18, -400(%rbp)
+	jle .L195
+.L197:
+	movq -408(%rbp), %rax
+	addq -400(%rbp), %rax
+.L194:
+	pushq %rax
+	movq -336(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -352(%rbp)
+	movq -344(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -360(%rbp)
+	cmpq $4, -352(%rbp)
+	jl .L209
+	cmpq $18, -352(%rbp)
+	jle .L207
+.L209:
+	movq -360(%rbp), %rax
+	addq -352(%rbp), %rax
+.L206:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L188
+.L195:
+.L196:
+	movq -400(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -432(%rbp)
+	movq -408(%rbp), %rax
+	movq %rax, -440(%rbp)
+	cmpq $4, -432(%rbp)
+	jl .L201
+	cmpq $18, -432(%rbp)
+	jle .L199
+.L201:
+	movq -440(%rbp), %rax
+	addq -432(%rbp), %rax
+.L198:
+	pushq %rax
+	movq -400(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -416(%rbp)
+	movq -408(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -424(%rbp)
+	cmpq $4, -416(%rbp)
+	jl .L205
+	cmpq $18, -416(%rbp)
+	jle .L203
+.L205:
+	movq -424(%rbp), %rax
+	addq -416(%rbp), %rax
+.L202:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L194
+.L207:
+.L208:
+	movq -352(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -384(%rbp)
+	movq -360(%rbp), %rax
+	movq %rax, -392(%rbp)
+	cmpq $4, -384(%rbp)
+	jl .L213
+	cmpq $18, -384(%rbp)
+	jle .L211
+.L213:
+	movq -392(%rbp), %rax
+	addq -384(%rbp), %rax
+.L210:
+	pushq %rax
+	movq -352(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -368(%rbp)
+	movq -360(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -376(%rbp)
+	cmpq $4, -368(%rbp)
+	jl .L217
+	cmpq $18, -368(%rbp)
+	jle .L215
+.L217:
+	movq -376(%rbp), %rax
+	addq -368(%rbp), %rax
+.L214:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L206
+.L159:
+.L160:
+	movq -224(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -288(%rbp)
+	movq -232(%rbp), %rax
+	movq %rax, -296(%rbp)
+	cmpq $4, -288(%rbp)
+	jl .L165
+	cmpq $18, -288(%rbp)
+	jle .L163
+.L165:
+	movq -296(%rbp), %rax
+	addq -288(%rbp), %rax
+.L162:
+	pushq %rax
+	movq -224(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -240(%rbp)
+	movq -232(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -248(%rbp)
+	cmpq $4, -240(%rbp)
+	jl .L177
+	cmpq $18, -240(%rbp)
+	jle .L175
+.L177:
+	movq -248(%rbp), %rax
+	addq -240(%rbp), %rax
+.L174:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L158
+.L199:
+.L200:
+	movq -440(%rbp), %rax
+	movq %rax, %rsi
+	movq -432(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -440(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -432(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L198
+.L203:
+.L204:
+	subq $8, %rsp
+	movq -424(%rbp), %rax
+	movq %rax, %rsi
+	movq -416(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -424(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -416(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L202
+.L211:
+.L212:
+	subq $8, %rsp
+	movq -392(%rbp), %rax
+	movq %rax, %rsi
+	movq -384(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -392(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -384(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L210
+.L215:
+.L216:
+	movq -376(%rbp), %rax
+	movq %rax, %rsi
+	movq -368(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -376(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -368(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L214
+.L163:
+.L164:
+	movq -288(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -320(%rbp)
+	movq -296(%rbp), %rax
+	movq %rax, -328(%rbp)
+	cmpq $4, -320(%rbp)
+	jl .L169
+	cmpq $18, -320(%rbp)
+	jle .L167
+.L169:
+	movq -328(%rbp), %rax
+	addq -320(%rbp), %rax
+.L166:
+	pushq %rax
+	movq -288(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -304(%rbp)
+	movq -296(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -312(%rbp)
+	cmpq $4, -304(%rbp)
+	jl .L173
+	cmpq $18, -304(%rbp)
+	jle .L171
+.L173:
+	movq -312(%rbp), %rax
+	addq -304(%rbp), %rax
+.L170:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L162
+.L175:
+.L176:
+	movq -240(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -272(%rbp)
+	movq -248(%rbp), %rax
+	movq %rax, -280(%rbp)
+	cmpq $4, -272(%rbp)
+	jl .L181
+	cmpq $18, -272(%rbp)
+	jle .L179
+.L181:
+	movq -280(%rbp), %rax
+	addq -272(%rbp), %rax
+.L178:
+	pushq %rax
+	movq -240(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -256(%rbp)
+	movq -248(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -264(%rbp)
+	cmpq $4, -256(%rbp)
+	jl .L185
+	cmpq $18, -256(%rbp)
+	jle .L183
+.L185:
+	movq -264(%rbp), %rax
+	addq -256(%rbp), %rax
+.L182:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L174
+.L219:
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	movabsq $903449277111, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	addq -16(%rbp), %rax
+	cmpq %rcx, %rax
+	jle .LB1
+.L220:
+.L221:
+	movl $2, -20(%rbp)
+	cmpl $100, -20(%rbp)
+	jge .L222
+	movl $100, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -448(%rbp)
+	cmpq $0, -448(%rbp)
+	je .L225
+	.p2align 4,,10
+.L224:
+	movq $0, -32(%rbp)
+	movq $0, -16(%rbp)
+	movq $-1, -16(%rbp)
+	movq $-2, -16(%rbp)
+	movq $3, -32(%rbp)
+	addl $1, -20(%rbp)
+	movq $0, -32(%rbp)
+	movq $0, -16(%rbp)
+	movq $-1, -16(%rbp)
+	movq $-2, -16(%rbp)
+	movq $3, -32(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -448(%rbp)
+	jne .L224
+.L225:
+.L222:
+.L223:
+	cmpl $100, -20(%rbp)
+	jge .L227
+	.p2align 4,,10
+.L226:
+	movq $0, -32(%rbp)
+	movq $0, -16(%rbp)
+	movq $-1, -16(%rbp)
+	movq $-2, -16(%rbp)
+	movq $3, -32(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $100, -20(%rbp)
+	jl .L226
+.L227:
+.L218:
+	movq -16(%rbp), %rax
+	movl %eax, -20(%rbp)
+	movslq -20(%rbp), %rax
+	addq $611, %rax
+	movl %eax, -20(%rbp)
+	movq -16(%rbp), %rax
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, ga0+16(%rip)
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jne .L228
+	xorl %eax, %eax
+	subl -20(%rbp), %eax
+	movsbl %al, %eax
+	testl %eax, %eax
+	je .L229
+	movl -108(%rbp), %eax
+	movl -100(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -456(%rbp)
+	cmpq $4, -456(%rbp)
+	jl .L235
+	cmpq $18, -456(%rbp)
+	jle .L233
+.L235:
+	movq -456(%rbp), %rax
+	addq $782, %rax
+.L232:
+.L230:
+.L231:
+	jmp .L229
+.L167:
+.L168:
+	movq -328(%rbp), %rax
+	movq %rax, %rsi
+	movq -320(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -328(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -320(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L166
+.L171:
+.L172:
+	subq $8, %rsp
+	movq -312(%rbp), %rax
+	movq %rax, %rsi
+	movq -304(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -312(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -304(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L170
+.L179:
+.L180:
+	subq $8, %rsp
+	movq -280(%rbp), %rax
+	movq %rax, %rsi
+	movq -272(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -280(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -272(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L178
+.L183:
+.L184:
+	movq -264(%rbp), %rax
+	movq %rax, %rsi
+	movq -256(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -264(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -256(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L182
+.L228:
+	movl $0, -20(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L260
+	cmpw $0, -2(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L261
+.L260:
+	movl $0, %eax
+.L261:
+	movl %eax, -516(%rbp)
+	movl $-6, -520(%rbp)
+	cmpl $4, -20(%rbp)
+	jge .L263
+	.p2align 4,,10
+.L262:
+	movslq -20(%rbp), %rax
+	movq %rax, -528(%rbp)
+	movl -92(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	cmpq $0, -528(%rbp)
+	je .L266
+	cmpl $0, -516(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L267
+.L266:
+	movl $0, %eax
+.L267:
+	pushq %rax
+	movq -16(%rbp), %rax
+	cmpq -528(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	cmpl -20(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	imull %ecx, %eax
+	testl %eax, %eax
+	je .L264
+	movzwl -2(%rbp), %eax
+	addq %rax, -32(%rbp)
+	movslq -520(%rbp), %rax
+	cmpq -32(%rbp), %rax
+	jl .L268
+.L263:
+.L229:
+	movq $0, -536(%rbp)
+	imulq $31, -536(%rbp), %rax
+	movzwl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	imulq $31, -536(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -536(%rbp)
+	imulq $31, -536(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	imulq $31, -536(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -536(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jge .L270
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -544(%rbp)
+	cmpq $0, -544(%rbp)
+	je .L273
+	.p2align 4,,10
+.L272:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -544(%rbp)
+	jne .L272
+.L273:
+.L270:
+.L271:
+	cmpl $16, -20(%rbp)
+	jge .L275
+	.p2align 4,,10
+.L274:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L274
+.L275:
+	movl $0, -20(%rbp)
+	cmpl $0, -68(%rbp)
+	je .L276
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -552(%rbp)
+	cmpq $0, -552(%rbp)
+	je .L279
+	.p2align 4,,10
+.L278:
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -552(%rbp)
+	jne .L278
+.L279:
+.L276:
+.L277:
+	cmpl $8, -20(%rbp)
+	jge .L281
+	.p2align 4,,10
+.L280:
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L280
+.L281:
+	movl $0, -20(%rbp)
+	cmpl $0, -68(%rbp)
+	je .L282
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -560(%rbp)
+	cmpq $0, -560(%rbp)
+	je .L285
+	.p2align 4,,10
+.L284:
+	movslq -20(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -560(%rbp)
+	jne .L284
+.L285:
+.L282:
+.L283:
+	cmpl $8, -20(%rbp)
+	jge .L287
+	.p2align 4,,10
+.L286:
+	movslq -20(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -536(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L286
+.L287:
+	movq -536(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -536(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -536(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -536(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -536(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -536(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -536(%rbp)
+	movq -536(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L268:
+.L269:
+.L264:
+.L265:
+	addl $1, -20(%rbp)
+	cmpl $4, -20(%rbp)
+	jl .L262
+	jmp .L263
+.L137:
+.L138:
+	subq $8, %rsp
+	movq -208(%rbp), %rax
+	movq %rax, %rsi
+	movq -200(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -208(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -200(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L136
+.L141:
+.L142:
+	movq -192(%rbp), %rax
+	movq %rax, %rsi
+	movq -184(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -192(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -184(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L140
+.L146:
+.L147:
+	movq -168(%rbp), %rax
+	movq %rax, %rsi
+	movq -160(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -168(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -160(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L145
+.L150:
+.L151:
+	subq $8, %rsp
+	movq -152(%rbp), %rax
+	movq %rax, %rsi
+	movq -144(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -152(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -144(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L149
+.L233:
+.L234:
+	movq -456(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -496(%rbp)
+	cmpq $4, -496(%rbp)
+	jl .L239
+	cmpq $18, -496(%rbp)
+	jle .L237
+.L239:
+	movq -496(%rbp), %rax
+	addq $782, %rax
+.L236:
+	pushq %rax
+	movq -456(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -464(%rbp)
+	cmpq $4, -464(%rbp)
+	jl .L251
+	cmpq $18, -464(%rbp)
+	jle .L249
+.L251:
+	movq -464(%rbp), %rax
+	addq $783, %rax
+.L248:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L229
+.L237:
+.L238:
+	movq -496(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -512(%rbp)
+	cmpq $4, -512(%rbp)
+	jl .L243
+	cmpq $18, -512(%rbp)
+	jle .L241
+.L243:
+	movq -512(%rbp), %rax
+	addq $782, %rax
+.L240:
+	pushq %rax
+	movq -496(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -504(%rbp)
+	cmpq $4, -504(%rbp)
+	jl .L247
+	cmpq $18, -504(%rbp)
+	jle .L245
+.L247:
+	movq -504(%rbp), %rax
+	addq $783, %rax
+.L244:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L236
+.L249:
+.L250:
+	movq -464(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -488(%rbp)
+	cmpq $4, -488(%rbp)
+	jl .L255
+	cmpq $18, -488(%rbp)
+	jle .L253
+.L255:
+	movq -488(%rbp), %rax
+	addq $783, %rax
+.L252:
+	pushq %rax
+	movq -464(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -472(%rbp)
+	movq $784, -480(%rbp)
+	cmpq $4, -472(%rbp)
+	jl .L259
+	cmpq $18, -472(%rbp)
+	jle .L257
+.L259:
+	movq -480(%rbp), %rax
+	addq -472(%rbp), %rax
+.L256:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L248
+.L241:
+.L242:
+	movq -512(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec.constprop.3
+	pushq %rax
+	subq $8, %rsp
+	movl $783, %eax
+	movq %rax, %rsi
+	movq -512(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L240
+.L245:
+.L246:
+	subq $8, %rsp
+	movl $783, %eax
+	movq %rax, %rsi
+	movq -504(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $784, %eax
+	movq %rax, %rsi
+	movq -504(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L244
+.L253:
+.L254:
+	subq $8, %rsp
+	movl $783, %eax
+	movq %rax, %rsi
+	movq -488(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $784, %eax
+	movq %rax, %rsi
+	movq -488(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L252
+.L257:
+.L258:
+	movq -480(%rbp), %rax
+	movq %rax, %rsi
+	movq -472(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -480(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -472(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L256
+.LB0:
+	movq -32(%rbp), %rax
+	jmp .main_return
+.LB1:
+	movl -20(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	addq -32(%rbp), %rax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,309 @@
+long g0 = 7;
+int ga0[8];
+int ga1[16];
+int f0(unsigned char p0, unsigned char p1, unsigned long p2, unsigned char p3, unsigned long p4, int p5, unsigned char p6) {
+    int v0 = 7ul;
+    long v1 = 982;
+    short v2 = 9;
+    long v3 = 434;
+    int i0 = 32767;
+    long j0 = 90;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 0l; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 1; }
+    if ((3 && ((32767L - la1[4]) * (p0 / (p0 * p0 + 1))))) {
+        if (p3 >= 0 && p3 < 8) { la0[p3] = 87594556974U; }
+    } else {
+        p4 = (!(la0[1]) <= -((65536U <= v2)));
+        v1 = (-(692876600133) < (la0[4] + ga0[5]));
+    }
+    p5 = 2ul;
+    if (660) {
+        switch (-(3l)) {
+        case 1:
+            p4 = p4 + -(127);
+            p1 = p1 + p2;
+            break;
+        default:
+            for (v3 = 0; v3 < 3; v3 = v3 + 1) {
+                if ((j0 < 759)) { break; }
+            }
+            if (p3 >= 0 && p3 < 16) { la1[p3] = (char)(!(v0)); }
+            break;
+        case 0:
+            break;
+        case 6:
+            if (-(((p3 != 4) + p0))) {
+                p5 = (ga0[4] < p0);
+                p0 = v0;
+                if (3) { return (unsigned long)(9); }
+            }
+            v1 = 0;
+            while (v1 < 8) {
+                j0 = !(ga1[3]);
+                v1 = v1 + 1;
+            }
+            break;
+        }
+    }
+    v3 = v3 + (unsigned int)(2147483647);
+    if (ga0[7]) {
+        p1 = (ga1[13] / 2);
+        if (p4 >= 0 && p4 < 16) { la1[p4] = (p4 + p4); }
+    } else {
+        p4 = p4 + 929;
+        v0 = ((short)(921) - (ga0[5] / 5l));
+    }
+    if (p1) {
+        if ((p2 - !(p3))) {
+            v1 = v1;
+        }
+    }
+    return !(v2);
+}
+void w0(long q0) {
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q0;
+}
+unsigned short f1(unsigned char p0, int p1, short p2, long p3) {
+    int v0 = 267;
+    long v1 = 101;
+    char v2 = 4ul;
+    long v3 = 8;
+    long v4 = 0l;
+    char v5 = 7;
+    int i0 = 69204034552;
+    long j0 = 853;
+    if (9) {
+        v0 = (8 || (f0(32767, 271310960293, 863, v1, 804, i0, p3) >= (ga1[4] != 3)));
+    }
+    v1 = (-((p0 / (j0 * j0 + 1))) || ((p3 + 582U) - 452));
+    v0 = v0 + 609997373052;
+    v4 = v3;
+    p3 = 0;
+    while (p3 < 33) {
+        if (((p3 + 1) && (v5 / 8))) { return (-(0U) != (char)(v1)); }
+        p3 = p3 + 1;
+    }
+    switch ((p1 - v0)) {
+    case 10:
+        v4 = (unsigned short)(f0(g0, p0, p1, i0, g0, v2, 68));
+        break;
+    case 0:
+        if (v4) {
+            v3 = (-((ga1[0] == ga0[0])) == (0 <= g0));
+        }
+        i0 = 0;
+        while (i0 < 3) {
+            switch (i0) {
+            case 6:
+                if (((unsigned int)(v0) + (ga0[4] <= 90))) { break; }
+                if (((p1 && p3) || -(6))) { break; }
+            case 1:
+                if (((unsigned long)(i0) + 324u)) { break; }
+                break;
+            }
+            i0 = i0 + 1;
+        }
+    case 5:
+        if (((v2 * ga1[0]) * ((short)(v1) - v5))) {
+            v5 = (v1 + ((0 + g0) && -(v3)));
+            p3 = 0;
+            while (p3 < 17) {
+                v1 = p2;
+                if (424462812024) { break; }
+                if ((!(v1) / (p2 * p2 + 1))) { break; }
+                p3 = p3 + 1;
+            }
+            if ((4 + 853)) {
+                f0(6, (v5 + p2), ga0[6], !(p2), (ga0[6] <= 65536), 941ul, 260958279262);
+            }
+        }
+        switch (ga0[3]) {
+        case 5:
+            switch ((ga1[8] <= (short)(v3))) {
+            default:
+                break;
+            case -3:
+                f0(f0(v2, ga1[3], i0, 395l, p3, 10, 128), 4931030699, v5, (v0 && 487), (unsigned long)(10), g0, (6 || v2));
+                break;
+            case 7:
+                p3 = ((j0 / 4) < (!(8ul) >= (p1 / (p0 * p0 + 1))));
+                break;
+            }
+            break;
+        case 2:
+            v3 = !(-(6));
+        }
+        break;
+    case 2:
+        if (((p1 == (p1 * v3)) + !((v2 + v5)))) {
+            j0 = ((g0 / 3) <= 273);
+            switch (((ga0[2] || v2) + g0)) {
+            default:
+                f0(7, (j0 <= 57), (5 * 127l), v2, f0(0, j0, 2147483647, v0, 404, p1, ga0[2]), f0(ga0[7], 4, ga0[0], 3, 5, 477473105516, 1), (ga0[6] < v5));
+            case 0:
+                break;
+            }
+            v5 = (f0(570, 448787435143, 2, ga1[4], p2, ga1[10], 23211673507) - 874735815205);
+        }
+        f0((unsigned long)(p0), f0(35l, ga1[12], ga0[6], 734635688940, 8, 6, 378ul), (ga0[7] <= v1), f0(v2, 128, 1086788894244, 3, v0, 7, 254), (511 > p0), ga1[13], f0(v4, 8, 128, 1, 10l, v3, p3));
+    default:
+        p1 = (-(p0) / 13ul);
+        break;
+    }
+    if ((-(f0(v4, p1, 1, 788, 117090150048, v1, 255)) != ((v5 <= 486) == 6))) {
+        v5 = v5 + (!(v4) != (ga1[13] + g0));
+        for (v0 = 0; v0 < 17; v0 = v0 + 1) {
+            f0(i0, (853 && p1), ga1[4], (ga1[0] != 3), (929 / 8), j0, (v3 * g0));
+        }
+    }
+    p2 = 0;
+    while (p2 < 3) {
+        v1 = (unsigned char)(p2);
+        p0 = (!((ga0[4] >= 912)) + (-(7) + !(v5)));
+        p1 = 50130482834;
+        p2 = p2 + 1;
+    }
+    return v2;
+}
+long rec(long n, long acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 3, acc * 3 + n);
+}
+int main() {
+    unsigned short v0 = 148;
+    int v1 = 272;
+    int i0 = 368u;
+    long j0 = 7;
+    switch (-((554 == v1))) {
+    case 300:
+        g0 = 8;
+        j0 = (-(j0) && ((g0 == j0) * (422 + 388)));
+        break;
+    case -3:
+        break;
+    }
+    if ((-(i0) > (4 - 5))) { return (!(g0) > (j0 / 8)); }
+    if (9) {
+        g0 = 178349900289;
+        switch ((v1 - f1(902, v0, v1, 0))) {
+        case 9:
+            i0 = 680705960906;
+            if ((!(j0) || v1)) { return 9; }
+            break;
+        case 7:
+            i0 = i0 + -(rec(v0, 643));
+            v1 = rec((ga1[1] <= j0), v0);
+            break;
+        case 1:
+            break;
+        default:
+            if ((char)(((v0 < g0) != ga0[3]))) {
+                w0(65535);
+                w0(v1);
+                v1 = (char)((!(v1) > rec(2ul, v0)));
+            }
+            if (g0) { return f1(4, 778, 2, 1); }
+            break;
+        case 6:
+            break;
+        case 8:
+            break;
+        }
+    } else {
+        i0 = i0 + (unsigned int)((i0 || v1));
+        if (v0 >= 0 && v0 < 8) { ga0[v0] = j0; }
+        j0 = !((rec(i0, g0) || (long)(0)));
+    }
+    for (v1 = 0; v1 < 4; v1 = v1 + 1) {
+        ga0[v1] = v1;
+        i0 = (6 == -((v0 * 746)));
+        for (i0 = 1; i0 < 3; i0 = i0 + 1) {
+            if (ga1[i0] < v0) { v0 = ga1[i0]; }
+            j0 = 0;
+            while (j0 < 3) {
+                g0 = (((994217630383 <= 255) / (g0 * g0 + 1)) - ((32767U * 205299358499) != 2));
+                if (ga0[i0] < g0) { g0 = ga0[i0]; }
+                j0 = j0 + 1;
+            }
+            switch (-((767 + i0))) {
+            default:
+                v0 = 7;
+                ga0[i0] = (255 || i0);
+                break;
+            case 3:
+                j0 = ((rec(145, g0) <= g0) < 412735554500);
+                v0 = !(-(ga1[14]));
+                break;
+            }
+        }
+    }
+    if (f0(ga0[2], (unsigned long)(i0), -(v0), (560 || 741), v0, !(2), (g0 <= g0))) {
+        j0 = ((783 - ga1[3]) - (-(i0) == ga0[4]));
+        w0(j0);
+    } else {
+        g0 = ((short)((v0 > v1)) < !(444496870076));
+        if (v1) {
+            g0 = g0 + (f0(ga1[8], 10, g0, 315, i0, 1, 2) != g0);
+        }
+        g0 = g0 + (-(g0) + (ga0[6] != ga0[6]));
+    }
+    for (i0 = 0; i0 < 17; i0 = i0 + 1) {
+        j0 = 0;
+        while (j0 < 100) {
+            v0 = (ga1[0] / (g0 * g0 + 1));
+            v0 = (((145 > 644) - v0) && ((ga1[11] == v1) == 5u));
+            j0 = j0 + 1;
+        }
+        v0 = 6;
+    }
+    if (((f0(ga1[13], g0, 55, v0, i0, 255, 5) - i0) * ((293L <= 957) - -(10)))) {
+        j0 = (((v1 + v1) / 1) < (f0(65535, 2, 4294967295, 32767, 599, 4294967295, v1) - j0));
+        switch (-(1L)) {
+        case 9:
+            i0 = (j0 + -(v1));
+        case 4:
+            break;
+        case 8:
+            break;
+        case 0:
+            break;
+        case 6:
+            break;
+        }
+        v1 = (unsigned int)(5);
+    } else {
+        v0 = (char)((v1 / 100));
+        f0(i0, (385353993980U / 8), (152 >= i0), v1, (g0 && j0), (i0 || i0), v0);
+        switch ((5 && (20 == i0))) {
+        case 3:
+            w0(113);
+        case 0:
+            i0 = f0((g0 != 868), (ga1[14] <= ga1[2]), (v1 * 3), v1, -(32767L), (char)(g0), !(ga1[0]));
+            g0 = ((i0 - v1) > (284 - (ga0[4] / (g0 * g0 + 1))));
+            break;
+        case 5:
+            g0 = g0 + (unsigned int)(!(g0));
+            break;
+        case 8:
+            break;
+        case 9:
+            if (882) {
+                ga1[9] = 538;
+            }
+        }
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
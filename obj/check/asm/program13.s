@@ -0,0 +1,3094 @@
+	.section .data
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.quad 7
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 64
+	.p2align 5
+ga1:
+	.zero 64
+	.section .text
+	.type f0, @function
+	.type rec, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movb %dil, -1(%rbp)
+	movb %sil, -2(%rbp)
+	movq %rdx, -16(%rbp)
+	movb %cl, -17(%rbp)
+	movq %r8, -32(%rbp)
+	movl %r9d, -36(%rbp)
+	movl $7, -40(%rbp)
+	movq $982, -48(%rbp)
+	movw $9, -50(%rbp)
+	movq $434, -64(%rbp)
+	movl $32767, -68(%rbp)
+	movq $90, -80(%rbp)
+	movl $0, -68(%rbp)
+	cmpl $8, -68(%rbp)
+	jge .L0
+	movl $8, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -120(%rbp)
+	cmpq $0, -120(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movslq -68(%rbp), %rax
+	movl $0, -112(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl $0, -112(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl $0, -112(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl $0, -112(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -120(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $8, -68(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -68(%rbp), %rax
+	movl $0, -112(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $8, -68(%rbp)
+	jl .L4
+.L5:
+	movl $0, -68(%rbp)
+	cmpl $16, -68(%rbp)
+	jge .L6
+	movl $16, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -200(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $16, -68(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $16, -68(%rbp)
+	jl .L10
+.L11:
+	movzbl -1(%rbp), %eax
+	movl %eax, -204(%rbp)
+	imull -204(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -204(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movl -176(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $32767, %eax
+	subq %rcx, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	testq %rax, %rax
+	je .L12
+	movzbl -17(%rbp), %eax
+	movl %eax, -208(%rbp)
+	testl %eax, %eax
+	jl .L13
+	cmpl $8, -208(%rbp)
+	jge .L13
+	movzbl -17(%rbp), %eax
+	movl $1695211054, -112(%rbp,%rax,4)
+.L14:
+.L15:
+	jmp .L13
+.L12:
+	movswl -50(%rbp), %eax
+	cmpl $65536, %eax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl -96(%rbp), %eax
+	movl ga0+20(%rip), %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-692876600133, %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+.L13:
+	movl $2, -36(%rbp)
+	movq $-3, %rax
+	cmpq $0, %rax
+	je .L19
+	cmpq $1, %rax
+	je .L17
+	cmpq $6, %rax
+	je .L20
+.L18:
+	movq $0, -64(%rbp)
+	cmpq $759, -80(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -212(%rbp)
+	cmpq $3, -64(%rbp)
+	jge .L22
+	.p2align 4,,10
+.L21:
+	cmpl $0, -212(%rbp)
+	je .L23
+.L22:
+	movzbl -17(%rbp), %eax
+	movl %eax, -216(%rbp)
+	testl %eax, %eax
+	jl .L16
+	cmpl $16, -216(%rbp)
+	jge .L16
+	cmpl $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzbl -17(%rbp), %eax
+	movl %ecx, -192(%rbp,%rax,4)
+.L25:
+.L26:
+.L19:
+.L16:
+	addq $2147483647, -64(%rbp)
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	je .L29
+	movl ga1+52(%rip), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movb %al, -2(%rbp)
+	cmpq $0, -32(%rbp)
+	jb .L30
+	cmpq $16, -32(%rbp)
+	jae .L30
+	movq -32(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L31:
+.L32:
+	jmp .L30
+.L29:
+	addq $929, -32(%rbp)
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	movl $921, %eax
+	subq %rcx, %rax
+	movl %eax, -40(%rbp)
+.L30:
+	cmpb $0, -2(%rbp)
+	je .L33
+	cmpb $0, -17(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	subq %rcx, %rax
+.L35:
+.L36:
+.L33:
+.L34:
+	cmpw $0, -50(%rbp)
+	sete %al
+	movzbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L23:
+.L24:
+	addq $1, -64(%rbp)
+	cmpq $3, -64(%rbp)
+	jl .L21
+	jmp .L22
+.L17:
+	addq $-127, -32(%rbp)
+	movzbl -2(%rbp), %eax
+	addq -16(%rbp), %rax
+	movb %al, -2(%rbp)
+	jmp .L16
+.L20:
+	movzbl -1(%rbp), %eax
+	movl %eax, -220(%rbp)
+	movq %rax, %rcx
+	movzbl -17(%rbp), %eax
+	cmpl $4, %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jne .LB0
+.L27:
+.L28:
+	movq $0, -48(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movq $8, -48(%rbp)
+	jmp .L16
+.LB0:
+	movl ga0+16(%rip), %eax
+	cmpl -220(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl -40(%rbp), %eax
+	movb %al, -1(%rbp)
+	movl $9, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rdi, -16(%rbp)
+	movq %rsi, -8(%rbp)
+.rec_entry:
+	cmpq $4, -16(%rbp)
+	jl .L39
+	cmpq $18, -16(%rbp)
+	jg .L39
+.L37:
+.L38:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	popq %rax
+	movq %rax, -8(%rbp)
+	jmp .rec_entry
+.L39:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movb %dil, -1(%rbp)
+	movb %sil, -2(%rbp)
+	movb %dl, -3(%rbp)
+	movq %rcx, -16(%rbp)
+	movl %r8d, -20(%rbp)
+	movb %r9b, -21(%rbp)
+	movl $7, -28(%rbp)
+	movq $982, -40(%rbp)
+	movw $9, -42(%rbp)
+	movq $434, -56(%rbp)
+	movl $32767, -60(%rbp)
+	movq $90, -72(%rbp)
+	movl $0, -60(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -112(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -60(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L42
+	.p2align 4,,10
+.L41:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L41
+	movl %ecx, -60(%rbp)
+.L42:
+.L40:
+	cmpl $8, -60(%rbp)
+	jge .L44
+	.p2align 4,,10
+.L43:
+	movslq -60(%rbp), %rax
+	movl $0, -112(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	cmpl $8, -60(%rbp)
+	jl .L43
+.L44:
+	movl $0, -60(%rbp)
+	cmpl $16, -60(%rbp)
+	jge .L45
+	movl $16, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L48
+	.p2align 4,,10
+.L47:
+	movslq -60(%rbp), %rax
+	movl -60(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	movslq -60(%rbp), %rax
+	movl -60(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	movslq -60(%rbp), %rax
+	movl -60(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	movslq -60(%rbp), %rax
+	movl -60(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	subq $1, -184(%rbp)
+	jne .L47
+.L48:
+.L45:
+.L46:
+	cmpl $16, -60(%rbp)
+	jge .L50
+	.p2align 4,,10
+.L49:
+	movslq -60(%rbp), %rax
+	movl -60(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	cmpl $16, -60(%rbp)
+	jl .L49
+.L50:
+	movzbl -1(%rbp), %eax
+	movl %eax, -188(%rbp)
+	imull -188(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -188(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movl -160(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $32767, %eax
+	subq %rcx, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	testq %rax, %rax
+	je .L51
+	movzbl -3(%rbp), %eax
+	movl %eax, -192(%rbp)
+	testl %eax, %eax
+	jl .L52
+	cmpl $8, -192(%rbp)
+	jge .L52
+	movzbl -3(%rbp), %eax
+	movl $1695211054, -112(%rbp,%rax,4)
+.L53:
+.L54:
+	jmp .L52
+.L51:
+	movswl -42(%rbp), %eax
+	cmpl $65536, %eax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl -96(%rbp), %eax
+	movl ga0+20(%rip), %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-692876600133, %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L52:
+	movl $2, -20(%rbp)
+	movq $-3, %rax
+	cmpq $0, %rax
+	je .L58
+	cmpq $1, %rax
+	je .L56
+	cmpq $6, %rax
+	je .L59
+.L57:
+	movq $0, -56(%rbp)
+	cmpq $759, -72(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	cmpq $3, -56(%rbp)
+	jge .L61
+	.p2align 4,,10
+.L60:
+	cmpl $0, -196(%rbp)
+	je .L62
+.L61:
+	movzbl -3(%rbp), %eax
+	movl %eax, -200(%rbp)
+	testl %eax, %eax
+	jl .L55
+	cmpl $16, -200(%rbp)
+	jge .L55
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzbl -3(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L64:
+.L65:
+.L58:
+.L55:
+	addq $2147483647, -56(%rbp)
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	je .L68
+	movl ga1+52(%rip), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movb %al, -2(%rbp)
+	cmpq $0, -16(%rbp)
+	jb .L69
+	cmpq $16, -16(%rbp)
+	jae .L69
+	movq -16(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+.L70:
+.L71:
+	jmp .L69
+.L68:
+	addq $929, -16(%rbp)
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	movl $921, %eax
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+.L69:
+	cmpb $0, -2(%rbp)
+	je .L72
+	cmpb $0, -3(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $863, %eax
+	subq %rcx, %rax
+.L74:
+.L75:
+.L72:
+.L73:
+	cmpw $0, -42(%rbp)
+	sete %al
+	movzbl %al, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L62:
+.L63:
+	addq $1, -56(%rbp)
+	cmpq $3, -56(%rbp)
+	jl .L60
+	jmp .L61
+.L56:
+	addq $-127, -16(%rbp)
+	movzbl -2(%rbp), %eax
+	addq $863, %rax
+	movb %al, -2(%rbp)
+	jmp .L55
+.L59:
+	movzbl -1(%rbp), %eax
+	movl %eax, -204(%rbp)
+	movq %rax, %rcx
+	movzbl -3(%rbp), %eax
+	cmpl $4, %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jne .LB1
+.L66:
+.L67:
+	movq $0, -40(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movq $8, -40(%rbp)
+	jmp .L55
+.LB1:
+	movl ga0+16(%rip), %eax
+	cmpl -204(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	movl -28(%rbp), %eax
+	movb %al, -1(%rbp)
+	movl $9, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movb %dil, -1(%rbp)
+	movb %sil, -2(%rbp)
+	movq %rdx, -16(%rbp)
+	movb %cl, -17(%rbp)
+	movq %r8, -32(%rbp)
+	movl %r9d, -36(%rbp)
+	movl $7, -40(%rbp)
+	movq $982, -48(%rbp)
+	movw $9, -50(%rbp)
+	movq $434, -64(%rbp)
+	movl $32767, -68(%rbp)
+	movq $90, -80(%rbp)
+	movl $0, -68(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -112(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -68(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L78
+	.p2align 4,,10
+.L77:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L77
+	movl %ecx, -68(%rbp)
+.L78:
+.L76:
+	cmpl $8, -68(%rbp)
+	jge .L80
+	.p2align 4,,10
+.L79:
+	movslq -68(%rbp), %rax
+	movl $0, -112(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $8, -68(%rbp)
+	jl .L79
+.L80:
+	movl $0, -68(%rbp)
+	cmpl $16, -68(%rbp)
+	jge .L81
+	movl $16, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L84
+	.p2align 4,,10
+.L83:
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -184(%rbp)
+	jne .L83
+.L84:
+.L81:
+.L82:
+	cmpl $16, -68(%rbp)
+	jge .L86
+	.p2align 4,,10
+.L85:
+	movslq -68(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $16, -68(%rbp)
+	jl .L85
+.L86:
+	movzbl -1(%rbp), %eax
+	movl %eax, -188(%rbp)
+	imull -188(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -188(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movl -160(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $32767, %eax
+	subq %rcx, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	testq %rax, %rax
+	je .L87
+	movzbl -17(%rbp), %eax
+	movl %eax, -192(%rbp)
+	testl %eax, %eax
+	jl .L88
+	cmpl $8, -192(%rbp)
+	jge .L88
+	movzbl -17(%rbp), %eax
+	movl $1695211054, -112(%rbp,%rax,4)
+.L89:
+.L90:
+	jmp .L88
+.L87:
+	movswl -50(%rbp), %eax
+	cmpl $65536, %eax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl -96(%rbp), %eax
+	movl ga0+20(%rip), %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-692876600133, %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+.L88:
+	movl $2, -36(%rbp)
+	movq $-3, %rax
+	cmpq $0, %rax
+	je .L94
+	cmpq $1, %rax
+	je .L92
+	cmpq $6, %rax
+	je .L95
+.L93:
+	movq $0, -64(%rbp)
+	cmpq $759, -80(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	cmpq $3, -64(%rbp)
+	jge .L97
+	.p2align 4,,10
+.L96:
+	cmpl $0, -196(%rbp)
+	je .L98
+.L97:
+	movzbl -17(%rbp), %eax
+	movl %eax, -200(%rbp)
+	testl %eax, %eax
+	jl .L91
+	cmpl $16, -200(%rbp)
+	jge .L91
+	cmpl $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzbl -17(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L100:
+.L101:
+.L94:
+.L91:
+	addq $2147483647, -64(%rbp)
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	je .L104
+	movl ga1+52(%rip), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movb %al, -2(%rbp)
+	cmpq $0, -32(%rbp)
+	jb .L105
+	cmpq $16, -32(%rbp)
+	jae .L105
+	movq -32(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+.L106:
+.L107:
+	jmp .L105
+.L104:
+	addq $929, -32(%rbp)
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	movl $921, %eax
+	subq %rcx, %rax
+	movl %eax, -40(%rbp)
+.L105:
+	cmpb $0, -2(%rbp)
+	je .L108
+	cmpb $0, -17(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	subq %rcx, %rax
+.L110:
+.L111:
+.L108:
+.L109:
+	cmpw $0, -50(%rbp)
+	sete %al
+	movzbl %al, %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L98:
+.L99:
+	addq $1, -64(%rbp)
+	cmpq $3, -64(%rbp)
+	jl .L96
+	jmp .L97
+.L92:
+	addq $-127, -32(%rbp)
+	movzbl -2(%rbp), %eax
+	addq -16(%rbp), %rax
+	movb %al, -2(%rbp)
+	jmp .L91
+.L95:
+	movzbl -1(%rbp), %eax
+	movl %eax, -204(%rbp)
+	movq %rax, %rcx
+	movzbl -17(%rbp), %eax
+	cmpl $4, %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jne .LB2
+.L102:
+.L103:
+	movq $0, -48(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga1+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movq $8, -48(%rbp)
+	jmp .L91
+.LB2:
+	movl ga0+16(%rip), %eax
+	cmpl -204(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl -40(%rbp), %eax
+	movb %al, -1(%rbp)
+	movl $9, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movb %dil, -81(%rbp)
+	movl %esi, -76(%rbp)
+	movw %dx, -78(%rbp)
+	movq %rcx, -40(%rbp)
+	movb $4, -80(%rbp)
+	movq $8, -56(%rbp)
+	movb $7, -79(%rbp)
+	movl $484557816, -68(%rbp)
+	movq $853, -48(%rbp)
+	movl $1, -72(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzbl %dil, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	jne .L112
+	movq -40(%rbp), %rax
+	addq $582, %rax
+	subq $452, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L113
+.L112:
+	movl $1, %eax
+.L113:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movslq -72(%rbp), %rax
+	movabsq $609997373052, %rcx
+	addq %rcx, %rax
+	movl %eax, -72(%rbp)
+	movq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq $0, -40(%rbp)
+	movsbl -79(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movl %eax, -64(%rbp)
+	movq -32(%rbp), %rax
+	movsbl %al, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -60(%rbp)
+	cmpq $33, -40(%rbp)
+	jge .L114
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L117
+	.p2align 4,,10
+.L116:
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	testq %rax, %rax
+	je .L118
+	cmpl $0, -64(%rbp)
+	jne .LB3
+.L118:
+.L119:
+	movq -8(%rbp), %rax
+	movq %rax, -40(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	testq %rax, %rax
+	je .L120
+	cmpl $0, -64(%rbp)
+	jne .LB4
+.L120:
+.L121:
+	movq -8(%rbp), %rax
+	movq %rax, -40(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	testq %rax, %rax
+	je .L122
+	cmpl $0, -64(%rbp)
+	jne .LB5
+.L122:
+.L123:
+	movq -8(%rbp), %rax
+	movq %rax, -40(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	testq %rax, %rax
+	je .L124
+	cmpl $0, -64(%rbp)
+	jne .LB6
+.L124:
+.L125:
+	movq -8(%rbp), %rax
+	movq %rax, -40(%rbp)
+	subq $1, -16(%rbp)
+	jne .L116
+.L117:
+.L114:
+.L115:
+	cmpq $33, -40(%rbp)
+	jge .L127
+	.p2align 4,,10
+.L126:
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	testq %rax, %rax
+	je .L128
+	cmpl $0, -64(%rbp)
+	jne .LB7
+.L128:
+.L129:
+	movq -8(%rbp), %rax
+	movq %rax, -40(%rbp)
+	cmpq $33, -40(%rbp)
+	jl .L126
+.L127:
+	movl %esi, %eax
+	subl -72(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	jge .L136
+	cmpq $0, %rax
+	je .L132
+	cmpq $2, %rax
+	je .L134
+	jmp .L135
+.L136:
+	cmpq $5, %rax
+	je .L133
+	cmpq $10, %rax
+	je .L131
+	jmp .L135
+.L132:
+	cmpq $0, -24(%rbp)
+	je .L137
+	movl ga1+0(%rip), %eax
+	movl ga0+0(%rip), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	cmpq $0, g0(%rip)
+	setge %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+.L137:
+.L138:
+	cmpl $0, %esi
+	je .L141
+	cmpq $0, -40(%rbp)
+	jne .L139
+.L141:
+	movl $-6, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+.L140:
+	movl %eax, -8(%rbp)
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L144
+	cmpq $6, %rax
+	je .L143
+	jmp .L142
+.L161:
+.L162:
+.L158:
+.L156:
+	movl $3, -68(%rbp)
+.L133:
+	movq -32(%rbp), %rax
+	movswl %ax, %eax
+	movsbl -79(%rbp), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movsbl -80(%rbp), %eax
+	movl ga1+0(%rip), %ecx
+	imull %ecx, %eax
+	popq %rcx
+	imull %ecx, %eax
+	testl %eax, %eax
+	je .L163
+	cmpq $0, g0(%rip)
+	je .L165
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L166
+.L165:
+	movl $0, %eax
+.L166:
+	movslq %eax, %rax
+	addq -32(%rbp), %rax
+	movb %al, -79(%rbp)
+	movq $0, -40(%rbp)
+	movswl -78(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	cmpq $17, -40(%rbp)
+	jge .L168
+	.p2align 4,,10
+.L167:
+	movswq -78(%rbp), %rax
+	movq %rax, -32(%rbp)
+.L168:
+	subq $8, %rsp
+	movl $94, %eax
+	pushq %rax
+	movl $941, %eax
+	movq %rax, %r9
+	movl ga0+24(%rip), %eax
+	cmpl $65536, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	cmpw $0, -78(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movsbl -79(%rbp), %eax
+	addl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L163:
+.L164:
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L171
+	cmpq $5, %rax
+	je .L170
+	jmp .L169
+.L171:
+	movq $0, -56(%rbp)
+.L169:
+.L130:
+	movsbl -79(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $486, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl $6, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $255, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq %rax, %r9
+	movabsq $117090150048, %rax
+	movq %rax, %r8
+	movl $20, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movl -76(%rbp), %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	je .L185
+	movl ga1+52(%rip), %eax
+	movslq %eax, %rax
+	addq g0(%rip), %rax
+	movq %rax, %rcx
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	addl -8(%rbp), %eax
+	movb %al, -79(%rbp)
+	movl $0, -72(%rbp)
+	cmpl $0, -76(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	movl $116, -32(%rbp)
+	cmpl $17, -72(%rbp)
+	jge .L187
+	movl $17, %eax
+	movslq -72(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L190
+	.p2align 4,,10
+.L189:
+	subq $8, %rsp
+	movq -56(%rbp), %rax
+	imulq g0(%rip), %rax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movl %eax, -8(%rbp)
+	movq %rax, %r9
+	movslq -32(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movq %rax, %r8
+	movl ga1+0(%rip), %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga1+16(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	movb %al, -60(%rbp)
+	movq %rax, %rsi
+	movl -68(%rbp), %eax
+	movb %al, -64(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	addl $1, -72(%rbp)
+	subq $8, %rsp
+	movq -56(%rbp), %rax
+	imulq g0(%rip), %rax
+	pushq %rax
+	movl -8(%rbp), %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl ga1+0(%rip), %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga1+16(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movzbl -60(%rbp), %eax
+	movq %rax, %rsi
+	movzbl -64(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	addl $1, -72(%rbp)
+	subq $1, -24(%rbp)
+	jne .L189
+.L190:
+.L187:
+.L188:
+	cmpl $17, -72(%rbp)
+	jge .L192
+	.p2align 4,,10
+.L191:
+	subq $8, %rsp
+	movq -56(%rbp), %rax
+	imulq g0(%rip), %rax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movq %rax, %r9
+	movslq -32(%rbp), %rax
+	movq %rax, %r8
+	movl ga1+0(%rip), %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga1+16(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	movq %rax, %rsi
+	movl -68(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	addl $1, -72(%rbp)
+	cmpl $17, -72(%rbp)
+	jl .L191
+.L192:
+.L185:
+.L186:
+	movw $0, -78(%rbp)
+	movl $-7, -16(%rbp)
+	movswl -78(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, %eax
+	jge .L194
+	.p2align 4,,10
+.L193:
+	movswl -78(%rbp), %eax
+	movzbl %al, %eax
+	cmpb $0, -79(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	cmpl $912, %eax
+	setl %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -78(%rbp)
+	movswl -78(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, %eax
+	jl .L193
+.L194:
+	movsbl -80(%rbp), %eax
+.f1_return:
+	leave
+	ret
+.L170:
+	movq -56(%rbp), %rax
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movl ga1+32(%rip), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L174
+	cmpq $7, %rax
+	je .L175
+.L173:
+	jmp .L169
+.L183:
+	movl $1, %eax
+.L184:
+	movslq %eax, %rax
+	addq g0(%rip), %rax
+	je .L182
+.L181:
+	subq $8, %rsp
+	movl ga0+24(%rip), %eax
+	cmpl -8(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $1, %eax
+	pushq %rax
+	movl $731735660, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl $3, %eax
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movl ga0+28(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movl ga0+8(%rip), %eax
+	pushq %rax
+	movl -76(%rbp), %eax
+	movq %rax, %r9
+	movl $404, %eax
+	movq %rax, %r8
+	movl -72(%rbp), %eax
+	movq %rax, %rcx
+	movl $2147483647, %eax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movslq %eax, %rax
+	movq %rax, %r8
+	movsbl -80(%rbp), %eax
+	movq %rax, %rcx
+	movl $635, %eax
+	movq %rax, %rdx
+	cmpq $57, -48(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L182:
+.L180:
+	subq $8, %rsp
+	movl $163, %eax
+	pushq %rax
+	movl ga1+40(%rip), %eax
+	movq %rax, %r9
+	movswq -78(%rbp), %rax
+	movq %rax, %r8
+	movl ga1+16(%rip), %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $135, %eax
+	movq %rax, %rsi
+	movl $58, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movslq %eax, %rax
+	movabsq $874735815205, %rcx
+	subq %rcx, %rax
+	movb %al, -79(%rbp)
+.L178:
+.L179:
+	subq $8, %rsp
+	movq -40(%rbp), %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $128, %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	movl ga1+52(%rip), %eax
+	pushq %rax
+	movzbl -81(%rbp), %eax
+	cmpl $511, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $254, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movslq -72(%rbp), %rax
+	movq %rax, %r8
+	movl $3, %eax
+	movq %rax, %rcx
+	movabsq $1086788894244, %rax
+	movq %rax, %rdx
+	movl $128, %eax
+	movq %rax, %rsi
+	movsbl -80(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movl ga0+28(%rip), %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $122, %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movl $236, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl ga1+48(%rip), %eax
+	movq %rax, %rsi
+	movl $35, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rsi
+	movzbl -81(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L135:
+	xorl %eax, %eax
+	movzbl -81(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -76(%rbp)
+	jmp .L130
+.L174:
+	subq $8, %rsp
+	movl $1, %eax
+	pushq %rax
+	movq g0(%rip), %rax
+	pushq %rax
+	movl $10, %eax
+	pushq %rax
+	cmpl $0, -72(%rbp)
+	je .L176
+	movl $487, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L177
+.L176:
+	movl $0, %eax
+.L177:
+	pushq %rax
+	movsbq -79(%rbp), %rax
+	pushq %rax
+	movl $171, %eax
+	pushq %rax
+	movl $128, %eax
+	pushq %rax
+	movl $10, %eax
+	movq %rax, %r9
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movl $139, %eax
+	movq %rax, %rcx
+	movslq -68(%rbp), %rax
+	movq %rax, %rdx
+	movl ga1+12(%rip), %eax
+	movq %rax, %rsi
+	movsbl -80(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L172:
+	jmp .L169
+.L147:
+.L148:
+.L144:
+.L142:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L151
+	cmpq $6, %rax
+	je .L150
+.L154:
+.L155:
+.L151:
+.L149:
+	movl $2, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L158
+	cmpq $6, %rax
+	je .L157
+	jmp .L156
+.L131:
+	movsbl -80(%rbp), %eax
+	movq %rax, %r9
+	movq g0(%rip), %rax
+	movq %rax, %r8
+	movl -68(%rbp), %eax
+	movq %rax, %rcx
+	movslq %esi, %rax
+	movq %rax, %rdx
+	movzbl %dil, %eax
+	movq %rax, %rsi
+	movq g0(%rip), %rax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movzwl %ax, %eax
+	movq %rax, -24(%rbp)
+	jmp .L130
+.L134:
+	movsbl -79(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rcx
+	movsbl -80(%rbp), %eax
+	addl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq %esi, %rax
+	movq %rax, -16(%rbp)
+	imulq -56(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L178
+	movq g0(%rip), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	cmpq $273, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	jne .L183
+	cmpb $0, -80(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L184
+.L175:
+	movzbl -81(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -76(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -48(%rbp), %rax
+	leaq 3(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $2, %rcx
+	movq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .L169
+.L139:
+	movl $1, %eax
+	jmp .L140
+.L143:
+	movl ga0+16(%rip), %eax
+	cmpl $90, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -72(%rbp), %eax
+	addl %ecx, %eax
+	je .L145
+	jmp .L142
+.L150:
+	movl ga0+16(%rip), %eax
+	cmpl $90, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -72(%rbp), %eax
+	addl %ecx, %eax
+	je .L152
+	jmp .L149
+.L157:
+	movl ga0+16(%rip), %eax
+	cmpl $90, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -72(%rbp), %eax
+	addl %ecx, %eax
+	je .L159
+	jmp .L156
+.L145:
+.L146:
+	cmpl $0, -8(%rbp)
+	je .L147
+	jmp .L142
+.L152:
+.L153:
+	cmpl $0, -8(%rbp)
+	je .L154
+	jmp .L149
+.L159:
+.L160:
+	cmpl $0, -8(%rbp)
+	je .L161
+	jmp .L156
+.LB7:
+	movl -60(%rbp), %eax
+	jmp .f1_return
+.LB3:
+	movl -60(%rbp), %eax
+	jmp .f1_return
+.LB4:
+	movl -60(%rbp), %eax
+	jmp .f1_return
+.LB5:
+	movl -60(%rbp), %eax
+	jmp .f1_return
+.LB6:
+	movl -60(%rbp), %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movw $148, -58(%rbp)
+	movl $272, -56(%rbp)
+	movl $368, -52(%rbp)
+	movq $7, -32(%rbp)
+	xorl %eax, %eax
+	cmpl $554, -56(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L197
+	cmpq $300, %rax
+	je .L196
+.L197:
+.L195:
+	xorl %eax, %eax
+	subl -52(%rbp), %eax
+	cmpl $-1, %eax
+	jg .LB8
+.L200:
+.L201:
+	movabsq $178349900289, %rax
+	movq %rax, g0(%rip)
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	movq %rax, %rdx
+	movzwl -58(%rbp), %eax
+	movq %rax, %rsi
+	movl $134, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L209
+	leaq .L210(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L206
+	# table target .L205
+	# table target .L207
+	# table target .L204
+	# table target .L208
+	# table target .L203
+	jmp *%rcx
+.L209:
+.L206:
+	movzwl -58(%rbp), %eax
+	movq %rax, -16(%rbp)
+	cmpq g0(%rip), %rax
+	setl %al
+	movzbl %al, %eax
+	movl ga0+12(%rip), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	testb %al, %al
+	je .L238
+	imulq $3, g0(%rip), %rax
+	addq $65535, %rax
+	movq %rax, g0(%rip)
+	imulq $3, g0(%rip), %rax
+	addq $65535, %rax
+	movq %rax, g0(%rip)
+	imulq $3, g0(%rip), %rax
+	addq $65535, %rax
+	movq %rax, g0(%rip)
+.L240:
+	movslq -56(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $3, g0(%rip), %rax
+	addq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	imulq $3, g0(%rip), %rax
+	addq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	imulq $3, g0(%rip), %rax
+	addq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+.L241:
+	movq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	addq $2, %rax
+.L242:
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+.L238:
+.L239:
+	cmpq $0, g0(%rip)
+	jne .LB9
+.L243:
+.L244:
+.L202:
+	movl $0, -56(%rbp)
+	movl $0, -48(%rbp)
+	movl $1, -44(%rbp)
+	cmpl $4, -56(%rbp)
+	jge .L246
+	.p2align 4,,10
+.L245:
+	movslq -56(%rbp), %rax
+	movl -56(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movzwl -58(%rbp), %eax
+	imull $746, %eax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	cmpl $6, %eax
+	sete %al
+	movzbl %al, %eax
+	movl $1, -52(%rbp)
+	movl -48(%rbp), %eax
+	movl %eax, -40(%rbp)
+	movl -44(%rbp), %eax
+	movl %eax, -36(%rbp)
+	cmpl $3, -52(%rbp)
+	jge .L248
+	.p2align 4,,10
+.L247:
+	movslq -52(%rbp), %rax
+	movq %rax, -24(%rbp)
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movzwl -58(%rbp), %ecx
+	cmpl %ecx, %eax
+	jge .L249
+	movq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+.L249:
+.L250:
+	movl -40(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movl -36(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movq %rax, -8(%rbp)
+	pushq %rax
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movq %rax, -16(%rbp)
+	cqo
+	idivq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	movq %rax, g0(%rip)
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq g0(%rip), %rax
+	jge .L251
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+.L251:
+.L252:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	subq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq g0(%rip), %rax
+	jge .L253
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+.L253:
+.L254:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	subq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq g0(%rip), %rax
+	jge .L255
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+.L255:
+.L256:
+	movq $3, -32(%rbp)
+	movl -52(%rbp), %eax
+	addl $767, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L259
+.L258:
+	movw $7, -58(%rbp)
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl $1, (%rdx,%rax,4)
+.L257:
+	addl $1, -52(%rbp)
+	cmpl $3, -52(%rbp)
+	jl .L247
+.L248:
+	addl $1, -56(%rbp)
+	cmpl $4, -56(%rbp)
+	jl .L245
+.L246:
+	subq $8, %rsp
+	movq g0(%rip), %rax
+	cmpq g0(%rip), %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movzwl -58(%rbp), %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movzwl -58(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movslq -52(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movq %rax, %rsi
+	movl ga0+8(%rip), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	testl %eax, %eax
+	je .L261
+	xorl %eax, %eax
+	subl -52(%rbp), %eax
+	movl ga0+16(%rip), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $783, %eax
+	movl ga1+12(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $3, g0(%rip), %rax
+	addq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	imulq $3, g0(%rip), %rax
+	addq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	imulq $3, g0(%rip), %rax
+	addq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+.L263:
+	jmp .L262
+.L259:
+	movq g0(%rip), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	addq $145, %rax
+.L260:
+	cmpq g0(%rip), %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $412735554500, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	xorl %eax, %eax
+	movl ga1+56(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -58(%rbp)
+	jmp .L257
+.L261:
+	movl -8(%rbp), %eax
+	cmpl -56(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+	cmpl $0, -56(%rbp)
+	je .L264
+	subq $8, %rsp
+	movl $2, %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl $59, %eax
+	movq %rax, %rcx
+	movq g0(%rip), %rax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl ga1+32(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movslq %eax, %rax
+	cmpq g0(%rip), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, g0(%rip)
+.L264:
+.L265:
+	movl ga0+24(%rip), %eax
+	movl ga0+24(%rip), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq g0(%rip), %rax
+	addq %rcx, %rax
+	addq %rax, g0(%rip)
+.L262:
+	movl $0, -52(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $17, -52(%rbp)
+	jge .L267
+	.p2align 4,,10
+.L266:
+	movq $0, -32(%rbp)
+	movl -24(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpq $100, -32(%rbp)
+	jge .L268
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L271
+	.p2align 4,,10
+.L270:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movw %ax, -58(%rbp)
+	movl -16(%rbp), %eax
+	movzwl -58(%rbp), %ecx
+	subl %ecx, %eax
+	je .L272
+	movl ga1+44(%rip), %eax
+	cmpl -56(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L273
+.L272:
+	movl $0, %eax
+.L273:
+	addq $1, -32(%rbp)
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movw %ax, -58(%rbp)
+	movl -16(%rbp), %eax
+	movzwl -58(%rbp), %ecx
+	subl %ecx, %eax
+	je .L274
+	movl ga1+44(%rip), %eax
+	cmpl -56(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L275
+.L274:
+	movl $0, %eax
+.L275:
+	addq $1, -32(%rbp)
+	subq $1, -8(%rbp)
+	jne .L270
+.L271:
+.L268:
+.L269:
+	cmpq $100, -32(%rbp)
+	jge .L277
+	.p2align 4,,10
+.L276:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movw %ax, -58(%rbp)
+	movl -16(%rbp), %eax
+	movzwl -58(%rbp), %ecx
+	subl %ecx, %eax
+	je .L278
+	movl ga1+44(%rip), %eax
+	cmpl -56(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L279
+.L278:
+	movl $0, %eax
+.L279:
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jl .L276
+.L277:
+	movw $6, -58(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $17, -52(%rbp)
+	jl .L266
+.L267:
+	subq $8, %rsp
+	movl $5, %eax
+	pushq %rax
+	movl $255, %eax
+	movq %rax, %r9
+	movslq -52(%rbp), %rax
+	movq %rax, %r8
+	movzwl -58(%rbp), %eax
+	movq %rax, %rcx
+	movl $55, %eax
+	movq %rax, %rdx
+	movq g0(%rip), %rax
+	movq %rax, %rsi
+	movl ga1+52(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	subl -52(%rbp), %eax
+	imull $11, %eax, %eax
+	testl %eax, %eax
+	je .L280
+	subq $8, %rsp
+	movl -56(%rbp), %eax
+	pushq %rax
+	movl $-1, %eax
+	movq %rax, %r9
+	movl $599, %eax
+	movq %rax, %r8
+	movl $255, %eax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl $255, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movslq %eax, %rax
+	subq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	addl -56(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq $-1, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L288
+	leaq .L289(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L282
+	# table target .L286
+	# table target .L284
+	# table target .L287
+	# table target .L285
+	# table target .L283
+	jmp *%rcx
+.L280:
+	movl -56(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movsbl %al, %eax
+	movw %ax, -58(%rbp)
+	subq $8, %rsp
+	movzwl -58(%rbp), %eax
+	pushq %rax
+	cmpl $0, -52(%rbp)
+	jne .L290
+	cmpl $0, -52(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L291
+.L290:
+	movl $1, %eax
+.L291:
+	pushq %rax
+	cmpq $0, g0(%rip)
+	je .L292
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L293
+.L292:
+	movl $0, %eax
+.L293:
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl -56(%rbp), %eax
+	movb %al, -8(%rbp)
+	movq %rax, %rcx
+	cmpl $152, -52(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $223, %eax
+	movq %rax, %rsi
+	movl -52(%rbp), %eax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	addq $16, %rsp
+	cmpl $20, -52(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L294
+	leaq .L301(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L294
+	# table target .L296
+	# table target .L295
+	# table target .L297
+	# table target .L298
+	# table target .L299
+	jmp *%rcx
+.L196:
+	movq $8, g0(%rip)
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	je .L198
+	movq g0(%rip), %rax
+	cmpq -32(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	imull $810, %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L199
+.L198:
+	movl $0, %eax
+.L199:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	jmp .L195
+.L288:
+.L282:
+	movl $5, -56(%rbp)
+.L294:
+.L281:
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzwl -58(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -56(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -52(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jge .L303
+	movl $8, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L306
+	.p2align 4,,10
+.L305:
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	subq $1, -8(%rbp)
+	jne .L305
+.L306:
+.L303:
+.L304:
+	cmpl $8, -52(%rbp)
+	jge .L308
+	.p2align 4,,10
+.L307:
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jl .L307
+.L308:
+	movl $0, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L309
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L312
+	.p2align 4,,10
+.L311:
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	subq $1, -8(%rbp)
+	jne .L311
+.L312:
+.L309:
+.L310:
+	cmpl $16, -52(%rbp)
+	jge .L314
+	.p2align 4,,10
+.L313:
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L313
+.L314:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L300:
+	jmp .L294
+.L203:
+	movl $2101128138, -52(%rbp)
+	cmpq $0, -32(%rbp)
+	je .L213
+	cmpl $0, -56(%rbp)
+	jne .L213
+.L211:
+.L212:
+	jmp .L202
+.L204:
+	movzwl -58(%rbp), %eax
+	movq %rax, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	jl .L217
+	cmpq $18, -8(%rbp)
+	jle .L215
+.L217:
+	movq -8(%rbp), %rax
+	addq $643, %rax
+.L214:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -52(%rbp)
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movzwl -58(%rbp), %eax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L229
+	cmpq $18, -16(%rbp)
+	jle .L227
+.L229:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L226:
+	jmp .L202
+.L215:
+.L216:
+	movq -8(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	addq $1929, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -24(%rbp)
+	jl .L221
+	cmpq $18, -24(%rbp)
+	jle .L219
+.L221:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L218:
+	jmp .L214
+.L227:
+.L228:
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -24(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -24(%rbp)
+	jl .L233
+	cmpq $18, -24(%rbp)
+	jle .L231
+.L233:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L230:
+	jmp .L226
+.L219:
+.L220:
+	movq -24(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L225
+	cmpq $18, -16(%rbp)
+	jle .L223
+.L225:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L222:
+	jmp .L214
+.L231:
+.L232:
+	movq -24(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L237
+	cmpq $18, -16(%rbp)
+	jle .L235
+.L237:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L234:
+	jmp .L226
+.L223:
+.L224:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L214
+.L235:
+.L236:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L226
+.L205:
+	jmp .L202
+.L207:
+	jmp .L202
+.L208:
+	jmp .L202
+.L283:
+	xorl %eax, %eax
+	subl -56(%rbp), %eax
+	movslq %eax, %rax
+	addq -32(%rbp), %rax
+	movl %eax, -52(%rbp)
+.L284:
+	jmp .L282
+.L285:
+	jmp .L282
+.L286:
+	jmp .L282
+.L287:
+	jmp .L282
+.L295:
+	imulq $3, g0(%rip), %rax
+	addq $113, %rax
+	movq %rax, g0(%rip)
+	imulq $3, g0(%rip), %rax
+	addq $113, %rax
+	movq %rax, g0(%rip)
+	imulq $3, g0(%rip), %rax
+	addq $113, %rax
+	movq %rax, g0(%rip)
+.L302:
+.L296:
+	subq $8, %rsp
+	movl ga1+0(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq g0(%rip), %rax
+	movsbl %al, %eax
+	pushq %rax
+	movq $-32767, %rax
+	pushq %rax
+	movzbl -8(%rbp), %eax
+	pushq %rax
+	imull $3, -56(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl ga1+56(%rip), %eax
+	movl ga1+8(%rip), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	cmpq $868, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl %eax, -52(%rbp)
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movl $284, %eax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	subl -56(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+	jmp .L294
+.L297:
+	cmpq $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	addq %rax, g0(%rip)
+	jmp .L294
+.L298:
+	jmp .L294
+.L299:
+	movl $538, ga1+36(%rip)
+	jmp .L294
+.LB8:
+	movq -32(%rbp), %rax
+	leaq 7(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $3, %rcx
+	movq %rcx, %rax
+	movq %rax, %rcx
+	cmpq $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB9:
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $778, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	jmp .main_return
+.L213:
+	movl $9, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L210:
+	.long .L205-.L210
+	.long .L206-.L210
+	.long .L206-.L210
+	.long .L206-.L210
+	.long .L206-.L210
+	.long .L207-.L210
+	.long .L204-.L210
+	.long .L208-.L210
+	.long .L203-.L210
+	.p2align 2
+.L289:
+	.long .L286-.L289
+	.long .L282-.L289
+	.long .L282-.L289
+	.long .L282-.L289
+	.long .L284-.L289
+	.long .L282-.L289
+	.long .L287-.L289
+	.long .L282-.L289
+	.long .L285-.L289
+	.long .L283-.L289
+	.p2align 2
+.L301:
+	.long .L296-.L301
+	.long .L294-.L301
+	.long .L294-.L301
+	.long .L295-.L301
+	.long .L294-.L301
+	.long .L297-.L301
+	.long .L294-.L301
+	.long .L294-.L301
+	.long .L298-.L301
+	.long .L299-.L301
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,89 @@
+unsigned char g0 = 170;
+unsigned char g1 = 6;
+int ga0[4];
+unsigned char f0(unsigned int p0, unsigned int p1, short p2, short p3, int p4, int p5, unsigned char p6) {
+    long v0 = 8;
+    char v1 = 298812036871;
+    int v2 = 2147483647;
+    int i0 = 1;
+    long j0 = 4;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 1; }
+    p2 = !(-(4));
+    p0 = 684;
+    if ((-(p1) / 4)) {
+        la0[2] = ((unsigned char)(v2) * (6 - 1));
+    }
+    la0[20] = j0;
+    p1 = ((!(ga0[1]) / (p3 * p3 + 1)) > 27L);
+    return v1;
+}
+unsigned long f1(long p0, unsigned short p1, unsigned short p2, unsigned int p3, short p4, char p5) {
+    unsigned short v0 = 2;
+    unsigned char v1 = 444;
+    unsigned char v2 = 10U;
+    int i0 = 6;
+    long j0 = 8262804248;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 277815075749; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v2 = (!((708 < 2)) && (unsigned short)(!(185)));
+        v1 = ga0[0];
+    }
+    p1 = (((p4 + 3U) == i0) * f0(36, p1, la0[7], v0, g1, p5, 4));
+    la0[1] = ((393 - ga0[0]) < (short)(p2));
+    for (i0 = 0; i0 < 17; i0 = i0 + 1) {
+        p5 = (((v2 / (g0 * g0 + 1)) >= (59 + p1)) <= ((v2 >= p2) > (127 == i0)));
+    }
+    return (f0(g0, 9, 334742015626, 550, j0, 9, 0) < -(v2));
+}
+void w1(int q0, unsigned char q1, unsigned char q2) {
+    g0 = g0 * 3 + q1;
+}
+int rec(int n, int acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    int v0 = 540;
+    unsigned char v1 = 6;
+    long v2 = 495;
+    int v3 = 7;
+    char v4 = 0;
+    unsigned short v5 = 8;
+    int i0 = 0;
+    long j0 = 251593154138;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 203; }
+    if (rec(f0(i0, 1, v3, v4, 124607595407, g1, 347ul), (v0 / 5l))) {
+        i0 = (((v1 + 216) / 3) == (unsigned short)(!(ga0[0])));
+    }
+    switch (v5) {
+    case 2:
+        break;
+    case 6:
+        break;
+    default:
+        break;
+    }
+    v2 = -(-((g1 / (g1 * g1 + 1))));
+    v1 = rec((65536 >= i0), (unsigned short)(ga0[1]));
+    j0 = f1(i0, v1, g0, v5, 1038531578766, v2);
+    if ((4 != v5)) { return v5; }
+    if (((2 * 8) && (v4 < i0))) { return (6 && (8 <= v2)); }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
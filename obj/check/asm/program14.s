@@ -0,0 +1,1081 @@
+	.section .data
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.byte 170
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.byte 6
+	.section .bss
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.section .text
+	.type f0.constprop.2, @function
+	.type f1, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.global main
+	.type main, @function
+	.type rec, @function
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movw %dx, -10(%rbp)
+	movw %cx, -12(%rbp)
+	movl %r8d, -16(%rbp)
+	movq $8, -24(%rbp)
+	movb $7, -25(%rbp)
+	movl $2147483647, -32(%rbp)
+	movl $1, -36(%rbp)
+	movq $4, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L0
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -200(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -36(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L4
+.L5:
+	movw $0, -10(%rbp)
+	movl $684, -4(%rbp)
+	xorl %eax, %eax
+	subl -8(%rbp), %eax
+	shrl $2, %eax
+	testl %eax, %eax
+	je .L6
+	movl -32(%rbp), %eax
+	movzbl %al, %eax
+	imull $5, %eax, %eax
+	movl %eax, -184(%rbp)
+.L6:
+.L7:
+	movq -48(%rbp), %rax
+	movl %eax, -112(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -204(%rbp)
+	imull -204(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $27, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	movsbl -25(%rbp), %eax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rdi, -8(%rbp)
+	movw %si, -10(%rbp)
+	movw %dx, -12(%rbp)
+	movl %ecx, -16(%rbp)
+	movb %r8b, -17(%rbp)
+	movw $2, -20(%rbp)
+	movb $188, -21(%rbp)
+	movb $10, -22(%rbp)
+	movl $6, -28(%rbp)
+	movabsq $8262804248, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $8, -28(%rbp)
+	jge .L8
+	movl $8, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -88(%rbp)
+	cmpq $0, -88(%rbp)
+	je .L9
+	.p2align 4,,10
+.L10:
+	movslq -28(%rbp), %rax
+	movq %rax, -96(%rbp)
+	movabsq $277815075749, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -96(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -104(%rbp)
+	movabsq $277815075749, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -104(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -112(%rbp)
+	movabsq $277815075749, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -112(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -120(%rbp)
+	movabsq $277815075749, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -88(%rbp)
+	jne .L10
+.L11:
+.L8:
+.L9:
+	cmpl $8, -28(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movslq -28(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movabsq $277815075749, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $8, -28(%rbp)
+	jl .L12
+.L13:
+	movl $0, -28(%rbp)
+	movb $0, -22(%rbp)
+	movl ga0+0(%rip), %eax
+	movb %al, -21(%rbp)
+	movb $0, -22(%rbp)
+	movl ga0+0(%rip), %eax
+	movb %al, -21(%rbp)
+	movb $0, -22(%rbp)
+	movl ga0+0(%rip), %eax
+	movb %al, -21(%rbp)
+	movb $0, -22(%rbp)
+	movl ga0+0(%rip), %eax
+	movb %al, -21(%rbp)
+	movb $0, -22(%rbp)
+	movl ga0+0(%rip), %eax
+	movb %al, -21(%rbp)
+	movb $0, -22(%rbp)
+	movl ga0+0(%rip), %eax
+	movb %al, -21(%rbp)
+	movb $0, -22(%rbp)
+	movl ga0+0(%rip), %eax
+	movb %al, -21(%rbp)
+	movb $0, -22(%rbp)
+	movl ga0+0(%rip), %eax
+	movb %al, -21(%rbp)
+	movl $8, -28(%rbp)
+	movsbl -17(%rbp), %eax
+	movq %rax, %r9
+	movzbl g1(%rip), %eax
+	movq %rax, %r8
+	movzwl -20(%rbp), %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	movq %rax, %rdx
+	movzwl -10(%rbp), %eax
+	movq %rax, %rsi
+	movl $36, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	cmpl $19345, %eax
+	sete %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	movw %ax, -10(%rbp)
+	movzwl -12(%rbp), %eax
+	movswl %ax, %eax
+	pushq %rax
+	movl $393, %eax
+	movl ga0+0(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -76(%rbp)
+	movl $0, -28(%rbp)
+	movzwl -10(%rbp), %eax
+	addl $59, %eax
+	movl %eax, -132(%rbp)
+	movzbl -22(%rbp), %eax
+	movl %eax, -140(%rbp)
+	movzwl -12(%rbp), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -136(%rbp)
+	cmpl $17, -28(%rbp)
+	jge .L14
+	movl $17, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L15
+	.p2align 4,,10
+.L16:
+	cmpl $127, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -136(%rbp)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movzbl g0(%rip), %eax
+	movzbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -140(%rbp), %eax
+	cltd
+	idivl %ecx
+	cmpl -132(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movb %al, -17(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $127, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -136(%rbp)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movzbl g0(%rip), %eax
+	movzbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -140(%rbp), %eax
+	cltd
+	idivl %ecx
+	cmpl -132(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movb %al, -17(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -152(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $17, -28(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	cmpl $127, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -136(%rbp)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movzbl g0(%rip), %eax
+	movzbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -140(%rbp), %eax
+	cltd
+	idivl %ecx
+	cmpl -132(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movb %al, -17(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $17, -28(%rbp)
+	jl .L18
+.L19:
+	xorl %eax, %eax
+	subl -140(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $-12662, %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $8, %rsp
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1, .-f1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movw %dx, -10(%rbp)
+	movw %cx, -12(%rbp)
+	movl %r8d, -16(%rbp)
+	movl %r9d, -20(%rbp)
+	movq $8, -32(%rbp)
+	movb $7, -33(%rbp)
+	movl $2147483647, -40(%rbp)
+	movl $1, -44(%rbp)
+	movq $4, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jge .L20
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L21
+	.p2align 4,,10
+.L22:
+	movslq -44(%rbp), %rax
+	movl -44(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -44(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -44(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -44(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -200(%rbp)
+	jne .L22
+.L23:
+.L20:
+.L21:
+	cmpl $33, -44(%rbp)
+	jge .L25
+	.p2align 4,,10
+.L24:
+	movslq -44(%rbp), %rax
+	movl -44(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L24
+.L25:
+	movw $0, -10(%rbp)
+	movl $684, -4(%rbp)
+	xorl %eax, %eax
+	subl -8(%rbp), %eax
+	shrl $2, %eax
+	testl %eax, %eax
+	je .L26
+	movl -40(%rbp), %eax
+	movzbl %al, %eax
+	imull $5, %eax, %eax
+	movl %eax, -184(%rbp)
+.L26:
+.L27:
+	movq -56(%rbp), %rax
+	movl %eax, -112(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -204(%rbp)
+	imull -204(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $27, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	movsbl -33(%rbp), %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movw %dx, -10(%rbp)
+	movl %ecx, -16(%rbp)
+	movq $8, -24(%rbp)
+	movb $7, -25(%rbp)
+	movl $2147483647, -32(%rbp)
+	movl $1, -36(%rbp)
+	movq $4, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L28
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L29
+	.p2align 4,,10
+.L30:
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -200(%rbp)
+	jne .L30
+.L31:
+.L28:
+.L29:
+	cmpl $33, -36(%rbp)
+	jge .L33
+	.p2align 4,,10
+.L32:
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L32
+.L33:
+	movw $0, -10(%rbp)
+	movl $684, -4(%rbp)
+	xorl %eax, %eax
+	subl -8(%rbp), %eax
+	shrl $2, %eax
+	testl %eax, %eax
+	je .L34
+	movl -32(%rbp), %eax
+	movzbl %al, %eax
+	imull $5, %eax, %eax
+	movl %eax, -184(%rbp)
+.L34:
+.L35:
+	movq -48(%rbp), %rax
+	movl %eax, -112(%rbp)
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $3996435779103636599, %rdx
+	imulq %rdx
+	sarq $16, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	cmpq $27, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	movsbl -25(%rbp), %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movl $540, -4(%rbp)
+	movb $6, -5(%rbp)
+	movq $495, -16(%rbp)
+	movl $7, -20(%rbp)
+	movb $0, -21(%rbp)
+	movw $8, -24(%rbp)
+	movl $0, -28(%rbp)
+	movabsq $251593154138, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -28(%rbp)
+	imull $203, -28(%rbp), %eax
+	subl $203, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -28(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	testl %eax, %eax
+	je .L36
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L39
+	.p2align 4,,10
+.L38:
+	addl $203, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $203, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $203, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $203, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -128(%rbp)
+	jne .L38
+.L39:
+.L36:
+.L37:
+	cmpl $16, -28(%rbp)
+	jge .L41
+	.p2align 4,,10
+.L40:
+	addl $203, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L40
+.L41:
+	movzbl g1(%rip), %eax
+	movq %rax, %r8
+	movsbl -21(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	movslq -4(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movl %eax, -136(%rbp)
+	cmpl $5, -132(%rbp)
+	jl .L47
+	cmpl $18, -132(%rbp)
+	jle .L45
+.L47:
+	movl -136(%rbp), %eax
+	addl -132(%rbp), %eax
+.L44:
+	testl %eax, %eax
+	je .L42
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movzbl -5(%rbp), %eax
+	addl $216, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+.L42:
+.L43:
+	movzwl -24(%rbp), %eax
+	movl %eax, -156(%rbp)
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L57
+	cmpq $6, %rax
+.L59:
+.L57:
+.L56:
+	movzbl g1(%rip), %eax
+	movzbl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	cmpl $65536, -28(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -160(%rbp)
+	movl ga0+4(%rip), %eax
+	movzwl %ax, %eax
+	movl %eax, -164(%rbp)
+	cmpl $5, -160(%rbp)
+	jl .L63
+	cmpl $18, -160(%rbp)
+	jle .L61
+.L63:
+	movl -164(%rbp), %eax
+	addl -160(%rbp), %eax
+.L60:
+	movb %al, -5(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movzwl -24(%rbp), %eax
+	movq %rax, %rcx
+	movzbl g0(%rip), %eax
+	movq %rax, %rdx
+	movzbl -5(%rbp), %eax
+	movq %rax, %rsi
+	movslq -28(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movq %rax, %rdi
+	call f1
+	movq %rax, -40(%rbp)
+	cmpl $4, -156(%rbp)
+	jne .LB0
+.L72:
+.L73:
+	movsbl -21(%rbp), %eax
+	cmpl -28(%rbp), %eax
+	jl .LB1
+.L74:
+.L75:
+	movq $0, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movzbl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movzbl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movslq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movzbl -5(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movsbq -21(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movzwl -24(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	addq -192(%rbp), %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movl $0, -28(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movl $4, -28(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $0, -120(%rbp)
+	je .L76
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L79
+	.p2align 4,,10
+.L78:
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -208(%rbp)
+	jne .L78
+.L79:
+.L76:
+.L77:
+	cmpl $16, -28(%rbp)
+	jge .L81
+	.p2align 4,,10
+.L80:
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L80
+.L81:
+	movq -200(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -200(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -200(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movq -200(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L45:
+.L46:
+	movl -132(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -140(%rbp)
+	imull $3, -136(%rbp), %eax
+	addl -132(%rbp), %eax
+	movl %eax, -144(%rbp)
+	cmpl $5, -140(%rbp)
+	jl .L51
+	cmpl $18, -140(%rbp)
+	jle .L49
+.L51:
+	movl -144(%rbp), %eax
+	addl -140(%rbp), %eax
+.L48:
+	jmp .L44
+.L58:
+	jmp .L56
+.L61:
+.L62:
+	movl -160(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -168(%rbp)
+	imull $3, -164(%rbp), %eax
+	addl -160(%rbp), %eax
+	movl %eax, -172(%rbp)
+	cmpl $5, -168(%rbp)
+	jl .L67
+	cmpl $18, -168(%rbp)
+	jle .L65
+.L67:
+	movl -172(%rbp), %eax
+	addl -168(%rbp), %eax
+.L64:
+	jmp .L60
+.L49:
+.L50:
+	movl -140(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -148(%rbp)
+	imull $3, -144(%rbp), %eax
+	addl -140(%rbp), %eax
+	movl %eax, -152(%rbp)
+	cmpl $5, -148(%rbp)
+	jl .L55
+	cmpl $18, -148(%rbp)
+	jle .L53
+.L55:
+	movl -152(%rbp), %eax
+	addl -148(%rbp), %eax
+.L52:
+	jmp .L44
+.L65:
+.L66:
+	movl -168(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -176(%rbp)
+	imull $3, -172(%rbp), %eax
+	addl -168(%rbp), %eax
+	movl %eax, -180(%rbp)
+	cmpl $5, -176(%rbp)
+	jl .L71
+	cmpl $18, -176(%rbp)
+	jle .L69
+.L71:
+	movl -180(%rbp), %eax
+	addl -176(%rbp), %eax
+.L68:
+	jmp .L60
+.L53:
+.L54:
+	imull $3, -152(%rbp), %eax
+	addl -148(%rbp), %eax
+	movq %rax, %rsi
+	movl -148(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L44
+.L69:
+.L70:
+	imull $3, -180(%rbp), %eax
+	addl -176(%rbp), %eax
+	movq %rax, %rsi
+	movl -176(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L60
+.LB0:
+	movl -156(%rbp), %eax
+	jmp .main_return
+.LB1:
+	cmpq $8, -16(%rbp)
+	setge %al
+	movzbl %al, %eax
+	jmp .main_return
+	.size main, .-main
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $5, -8(%rbp)
+	jl .L84
+	cmpl $18, -8(%rbp)
+	jg .L84
+.L82:
+.L83:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L84:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,294 @@
+unsigned int g0 = 3;
+unsigned char g1 = 3;
+char g2 = 255;
+int ga0[33];
+int ga1[4];
+unsigned short f0(unsigned char p0, long p1, unsigned short p2, unsigned short p3, unsigned int p4, int p5, unsigned int p6, unsigned int p7) {
+    int v0 = 5;
+    unsigned short v1 = 3;
+    unsigned long v2 = 1;
+    int i0 = 4L;
+    long j0 = 127;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 2ul; }
+    p0 = (((p4 * p0) / 1024) >= (v1 / 4));
+    for (p4 = 1; p4 < 3; p4 = p4 + 1) {
+        switch (p1) {
+        case 10:
+        case 0:
+            p1 = (((p1 && v0) <= (g1 / (v2 * v2 + 1))) >= ((unsigned long)(v0) - 3));
+            p5 = ((j0 + 3) - g0);
+            break;
+        case 9:
+            if (la0[p4] < p0) { p0 = la0[p4]; }
+        default:
+            break;
+        case 6:
+        }
+        if ((-((g1 <= la0[3])) == (unsigned short)(874))) {
+            if (5) {
+                v0 = p3;
+                if (((106 > p1) <= (char)(v2))) { break; }
+            }
+        }
+        if ((686 / 13ul)) {
+            p5 = ((g0 && p4) || (!(ga0[0]) >= (2 + 449)));
+        }
+    }
+    for (v2 = 0; v2 < 33; v2 = v2 + 1) {
+        p7 = !((256 > (g2 || 4294967295)));
+        if (!(((g0 != 273) / (p7 * p7 + 1)))) {
+            if (((v2 / 4) || !(p7))) { return (unsigned short)((201 <= 3)); }
+        }
+    }
+    v1 = (255 == ((908085314395 >= 527) - p3));
+    if (-(7)) {
+        p7 = (((i0 / 1) > (121 || 5)) - -((32767 || 600)));
+        if (i0) {
+            if ((g2 || 976)) { return -((10 && g2)); }
+            p4 = i0;
+        } else {
+            v0 = (!(6) && (10 / (p5 * p5 + 1)));
+            if ((-(p5) || -(p0))) { return (ga0[26] / 100); }
+            if ((p2 <= ((280 > 4) / 2))) {
+                if (!(la0[1])) { return g1; }
+                i0 = (((ga0[23] || p5) <= (g1 - p2)) >= (unsigned long)((ga1[3] < g0)));
+            } else {
+                if (g1) { return ((short)(4294967295) / 4); }
+            }
+        }
+        v0 = (p0 / 13ul);
+    }
+    if ((973117209270l && 400195722186)) { return (4294967295 >= (p6 < 712U)); }
+    p5 = 0;
+    while (p5 < 3) {
+        p7 = (p0 - 32767);
+        p5 = p5 + 1;
+    }
+    return ((unsigned char)(484777968461) >= !(244));
+}
+unsigned short f1(int p0, int p1, long p2, short p3, unsigned short p4, char p5, unsigned long p6) {
+    unsigned short v0 = 450;
+    unsigned char v1 = 227;
+    unsigned char v2 = 452;
+    unsigned long v3 = 418;
+    unsigned short v4 = 667;
+    int i0 = 10;
+    long j0 = 461;
+    if ((v1 * ((7 || 0) - (125L + j0)))) {
+        f0(-(g1), (unsigned long)(0), 1017746780117, (65535 > g0), f0(2, 2, v1, i0, i0, 97, g2, 10), 4294967295, (407219762873 + v2), (83 < v1));
+        p1 = (f0(4294967295, 6, 65536, 144, g1, 1, p2, 3) || v2);
+    } else {
+        for (i0 = 0; i0 < 33; i0 = i0 + 1) {
+            p3 = p3 + (-(v1) - 167);
+            if (p1) { break; }
+            p1 = !(f0(v2, 4, p1, 1000000007ul, p2, p0, ga0[0], 5));
+        }
+        for (p1 = 2; p1 < 5; p1 = p1 + 1) {
+            j0 = 0;
+            while (j0 < 5) {
+                if (g2) { break; }
+                if (p0) { break; }
+                j0 = j0 + 1;
+            }
+        }
+        p5 = p5 + (unsigned short)(p4);
+    }
+    if (f0((289319249902 != 0), 3, (0 + ga1[3]), (4L >= 10), 7, 301, 641, (i0 == p6))) {
+        switch ((!(p2) && (182 >= p2))) {
+        case 4:
+            f0((p2 || 226), ga0[10], (10 <= 32767), f0(ga0[13], p6, g2, ga0[0], v2, 340318392139, v0, 393), (unsigned short)(p1), 4, (ga1[3] - 802605920807), 123);
+            if (f0((10 == 332), (p1 || 672), (j0 / 100), !(p0), -(v0), 466, (0 != v1), f0(65536, v2, p5, p4, 4, p4, 1, ga1[2]))) {
+                f0((946 / 2), (i0 - 8), (p4 * 1039005787768U), (j0 / 5l), p3, (2 / 100), (10 || p0), (ga1[3] + 256));
+                p4 = p4 + f0(86, g2, p4, 258462182268, 111, 6, p4, v1);
+            } else {
+                f0(!(g0), (v1 || ga1[1]), i0, (p4 / (p2 * p2 + 1)), f0(149, 7, p2, 504660300452u, v3, v3, 220522669894l, ga1[3]), (0 < 3), f0(p3, 0, 184521917406, v0, 0, 65535, j0, g0), (566804438761 - 286));
+                f0(f0(v3, p5, 558, 928, 4, i0, ga0[9], g1), !(645256703916), -(2), f0(73, 5, 6, 9, 2, 6, 13, p5), ga0[3], (unsigned short)(p3), (458 >= v1), p4);
+            }
+            break;
+        case -1:
+            f0((v3 <= 403), f0(p6, ga1[0], j0, p3, v3, 6, 838, 169), (9 < 7l), (65536 == g1), 19, v3, ga0[24], j0);
+            if ((short)(533478471483)) {
+                v0 = (unsigned short)(((ga0[27] < 982587642380) <= p5));
+            }
+        case -4:
+            v1 = (g2 >= v4);
+            break;
+        default:
+            break;
+        }
+        for (j0 = 2; j0 < 4; j0 = j0 + 1) {
+            if (ga0[j0] < v3) { v3 = ga0[j0]; }
+        }
+        v4 = ((short)(343ul) > (char)((short)(542)));
+    }
+    p3 = 9;
+    j0 = p5;
+    if ((363 - ((32767 / (p3 * p3 + 1)) > p6))) {
+        if ((unsigned short)(p1)) {
+            p4 = p4 + ((p5 > g2) && (g2 - 5));
+        } else {
+            p5 = -((long)(9));
+            if (f0(ga1[3], (v3 < v0), (4 && ga0[7]), 65535, 797, (p4 && p2), (145 == 0U), (g2 / (p5 * p5 + 1)))) {
+                i0 = 3;
+                f0(f0(g1, g2, v0, v0, 857u, 5, 4, p2), f0(1, 679, p1, 2, 875, v1, v2, 4), (p5 <= p5), 637, ga0[5], (unsigned long)(3), (797L + 262), -(10));
+            }
+            p2 = p2 + ((unsigned char)(v3) < (4 > 2));
+        }
+        v4 = (!(962) / (v3 * v3 + 1));
+    } else {
+        for (p6 = 1; p6 < 8; p6 = p6 + 1) {
+            switch ((f0(p5, p2, 80, p5, 897714744308, 5, v4, v0) == f0(p5, 1, 1, j0, 128, ga0[29], v3, i0))) {
+            case 0:
+                if (f0(p0, 3, g1, 8, 4, v0, g2, v4)) { break; }
+                v3 = 1;
+                break;
+            case 5:
+                break;
+            case 6:
+                break;
+            case 9:
+                p4 = p3;
+                break;
+            case 7:
+                break;
+            default:
+                break;
+            }
+            v2 = (char)((f0(8, 10, ga1[2], i0, p0, 1, g2, ga1[1]) / (p5 * p5 + 1)));
+            v2 = (ga0[23] / (p6 * p6 + 1));
+        }
+        for (p2 = 2; p2 < 5; p2 = p2 + 1) {
+            for (p0 = 1; p0 < 100; p0 = p0 + 1) {
+                if ((g2 - (4 != 7))) { break; }
+                if (!(p3)) { break; }
+            }
+        }
+    }
+    return (f0(v1, 7, p1, 911, 6, 940, 5, v1) + (char)((9 * p6)));
+}
+unsigned char f2(unsigned int p0, unsigned long p1, unsigned long p2, unsigned long p3, short p4, unsigned char p5) {
+    short v0 = 8;
+    unsigned long v1 = 5;
+    unsigned char v2 = 6;
+    int i0 = 103;
+    long j0 = 6;
+    for (p0 = 1; p0 < 17; p0 = p0 + 1) {
+        v0 = ((unsigned int)(-(565)) / (p5 * p5 + 1));
+    }
+    v2 = (long)(p2);
+    for (p2 = 1; p2 < 33; p2 = p2 + 1) {
+        if ((((unsigned long)(2147483647) > v1) / (p3 * p3 + 1))) {
+            switch (g0) {
+            case 1:
+                if (f1(v0, g0, v2, v0, 935, v2, g0)) { return v1; }
+                p3 = 256;
+            case 3:
+                p1 = 5;
+                p1 = p5;
+                break;
+            default:
+                p4 = ((int)(724) + ((ga0[3] || 10U) <= (344662358724 / 1)));
+                j0 = ((f0(961760434861, 10, ga0[1], g2, p0, 0, ga0[9], p3) / (p1 * p1 + 1)) - ((unsigned char)(p1) || (p5 / (v0 * v0 + 1))));
+                break;
+            case 5:
+                p5 = (p4 || (unsigned long)((99 != 14l)));
+                if ((!(ga0[21]) / (g1 * g1 + 1))) { return p5; }
+            case 0:
+                if (((short)(p4) < !(7))) { break; }
+                break;
+            }
+            p3 = (((long)(5) && (4 * j0)) / 1);
+        } else {
+            if ((125 / 4)) { break; }
+            v0 = 0;
+            while (v0 < 33) {
+                if (ga0[17]) { break; }
+                if (((176 + p2) * (4 / 3u))) { break; }
+                v0 = v0 + 1;
+            }
+        }
+    }
+    if (((ga0[18] >= g1) + ((short)(317) * (ga0[17] + 9)))) {
+        f1(-(p3), -(ga0[13]), (p0 <= v0), (j0 < g0), p3, (p0 != 0), (256 + ga1[0]));
+        f1((unsigned int)(p2), (p1 + ga0[28]), !(498518143977), (v2 < 6), f0(850, 506040350450, ga1[1], 6, 980, 7, 684, p4), (p1 - v1), f0(128, 4, 0L, 2, p5, 3, p2, 627));
+    } else {
+        if ((unsigned int)(((v2 < 5) != p1))) {
+            if ((unsigned int)(g1)) {
+                p5 = p5;
+            } else {
+                f0((p2 >= ga1[2]), (5 < g2), (p0 + 5), (p5 && g2), (6L != 4), (p4 / 3), (g2 + p4), 956);
+                p3 = p3 + -((i0 / (p5 * p5 + 1)));
+                f1(f1(ga1[0], g1, g2, 4294967295l, g1, ga1[3], ga0[0]), (p2 && p2), g1, 642, (ga0[15] != ga1[3]), (v0 / 10), (v2 > 2));
+            }
+        }
+        j0 = j0;
+        p5 = (-(-(2)) + (f1(p1, 1, p4, v2, p0, 4294967295, p5) >= (i0 / 7)));
+    }
+    return (((short)(j0) != !(127)) + (char)(!(566u)));
+}
+int main() {
+    unsigned char v0 = 0;
+    unsigned int v1 = 551;
+    unsigned short v2 = 963l;
+    long v3 = 7;
+    int i0 = 8;
+    long j0 = 9;
+    if (f2(v2, ga0[11], i0, g1, 3, v3)) { return 10; }
+    g1 = ((-(v2) / (v2 * v2 + 1)) * 9);
+    if (v3 >= 0 && v3 < 4) { ga1[v3] = (-(1040805554724) / (v0 * v0 + 1)); }
+    if (((649843542742 / 16) + (v2 <= j0))) { return ((8 && 203) && ga0[0]); }
+    ga0[29] = (-(g1) && (594L / 3));
+    if ((v2 <= (int)((unsigned int)(i0)))) {
+        if (293) {
+            f1(i0, f0(g2, g0, v1, 2, ga1[1], ga1[1], j0, 182u), (443 != 4823771732), (v1 == 4), 9, (v2 + i0), -(g0));
+            g2 = g2 + v2;
+            j0 = ((g0 >= (g2 + g2)) / (v3 * v3 + 1));
+        } else {
+            v2 = (unsigned char)(f0(g1, 7U, v1, 191820456853, 255, 174, v2, 1l));
+        }
+        j0 = 0;
+        while (j0 < 17) {
+            i0 = 0;
+            while (i0 < 16) {
+                ga1[1] = (int)(6L);
+                i0 = i0 + 1;
+            }
+            j0 = j0 + 1;
+        }
+        i0 = ((541846450820 - (v2 + 755)) || ((v3 <= g2) + 10));
+    } else {
+        switch (-(v3)) {
+        default:
+            break;
+        case 5:
+        case 3:
+            g2 = (unsigned short)(v0);
+            v3 = v3 + f2(667976867557U, v1, v2, i0, g0, g1);
+        case 56:
+            v3 = f1(g1, v1, v0, g1, 76, 942359413716, ga1[0]);
+            break;
+        case 901:
+        case 555:
+            if (((int)(j0) <= (v1 && 7L))) { return (3 != v3); }
+            ga0[16] = (int)((ga0[23] - 11));
+            break;
+        }
+    }
+    v0 = (unsigned int)(((i0 / (v0 * v0 + 1)) - (441 - ga0[2])));
+    v3 = -((ga1[0] && g0));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,3496 @@
+	.section .data
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.long 3
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.byte 3
+	.type g2, @object
+	.size g2, 1
+	.p2align 0
+g2:
+	.byte -1
+	.section .bss
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.type ga1, @object
+	.size ga1, 16
+	.p2align 5
+ga1:
+	.zero 16
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f1, @function
+	.type f2, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movw %cx, -20(%rbp)
+	movl %r8d, -24(%rbp)
+	movl %r9d, -28(%rbp)
+	movl $5, -32(%rbp)
+	movw $3, -34(%rbp)
+	movq $1, -48(%rbp)
+	movl $4, -52(%rbp)
+	movq $127, -64(%rbp)
+	movl $0, -52(%rbp)
+	movl $0, -80(%rbp)
+	movl $2, -76(%rbp)
+	movl $4, -72(%rbp)
+	movl $6, -68(%rbp)
+	movl $4, -52(%rbp)
+	movzwl -34(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	imull -24(%rbp), %eax
+	shrl $10, %eax
+	cmpl %ecx, %eax
+	setae %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	movl $1, -24(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -88(%rbp)
+	movq -64(%rbp), %rax
+	addq $3, %rax
+	movq %rax, -96(%rbp)
+	movq $52, -104(%rbp)
+	movl $451, -108(%rbp)
+	cmpl $3, -24(%rbp)
+	jae .L1
+	.p2align 4,,10
+.L0:
+	movq -16(%rbp), %rax
+	cmpq $9, %rax
+	jge .L7
+	cmpq $0, %rax
+	je .L3
+	cmpq $6, %rax
+.L10:
+.L11:
+.L5:
+.L6:
+.L2:
+	movzbl g1(%rip), %eax
+	movl -68(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	cmpl $874, %eax
+	jne .L12
+	movzwl -20(%rbp), %eax
+	movl %eax, -32(%rbp)
+	movq -48(%rbp), %rax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	cmpq $106, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jg .L14
+.L1:
+	movq $0, -48(%rbp)
+	movl $0, -124(%rbp)
+	cmpq $33, -48(%rbp)
+	jae .L21
+	movl $33, %eax
+	subq -48(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L24
+	.p2align 4,,10
+.L23:
+	cmpb $0, g2(%rip)
+	jne .L25
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L26
+.L25:
+	movl $1, %eax
+.L26:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 24(%rbp)
+	movl 24(%rbp), %eax
+	imull 24(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L27
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L31
+	cmpl $0, 24(%rbp)
+	je .L31
+.L29:
+.L30:
+.L27:
+.L28:
+	addq $1, -48(%rbp)
+	cmpb $0, g2(%rip)
+	jne .L32
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L33
+.L32:
+	movl $1, %eax
+.L33:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 24(%rbp)
+	movl 24(%rbp), %eax
+	imull 24(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L34
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L38
+	cmpl $0, 24(%rbp)
+	je .L38
+.L36:
+.L37:
+.L34:
+.L35:
+	addq $1, -48(%rbp)
+	subq $1, -136(%rbp)
+	jne .L23
+.L24:
+.L21:
+.L22:
+	cmpq $33, -48(%rbp)
+	jae .L40
+	.p2align 4,,10
+.L39:
+	cmpb $0, g2(%rip)
+	jne .L41
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L42
+.L14:
+.L15:
+.L12:
+.L13:
+	cmpq $0, -104(%rbp)
+	je .L16
+	cmpl $0, g0(%rip)
+	je .L20
+	cmpl $0, -24(%rbp)
+	jne .L18
+.L20:
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl -108(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+.L19:
+	movl %eax, -28(%rbp)
+.L16:
+.L17:
+	addl $1, -24(%rbp)
+	cmpl $3, -24(%rbp)
+	jb .L0
+	jmp .L1
+.L7:
+	cmpq $9, %rax
+	je .L4
+	cmpq $10, %rax
+	je .L3
+	jmp .L5
+.L3:
+	movslq -32(%rbp), %rax
+	subq $3, %rax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	xorl %edx, %edx
+	divq -88(%rbp)
+	pushq %rax
+	cmpq $0, -16(%rbp)
+	je .L8
+	cmpl $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L9
+.L8:
+	movl $0, %eax
+.L9:
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq -96(%rbp), %rax
+	movl g0(%rip), %ecx
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+	jmp .L2
+.L4:
+	movl -24(%rbp), %eax
+	movq %rax, -120(%rbp)
+	movl -80(%rbp,%rax,4), %eax
+	movzbl -1(%rbp), %ecx
+	cmpl %ecx, %eax
+	jge .L10
+	movq -120(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movb %al, -1(%rbp)
+	jmp .L11
+.L18:
+	movl $1, %eax
+	jmp .L19
+.L47:
+	movl -124(%rbp), %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L48:
+	movl $0, -32(%rbp)
+	xorl %eax, %eax
+	subl -28(%rbp), %eax
+	jne .L55
+	xorl %eax, %eax
+	movzbl -1(%rbp), %ecx
+	subl %ecx, %eax
+	jne .L55
+.L53:
+.L54:
+	movzwl -18(%rbp), %eax
+	movl %eax, -140(%rbp)
+	testl %eax, %eax
+	jg .L56
+	movl -76(%rbp), %eax
+	testl %eax, %eax
+	je .LB0
+.L58:
+.L59:
+	movl ga1+12(%rip), %eax
+	cmpl g0(%rip), %eax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	subl -140(%rbp), %eax
+	pushq %rax
+	movl ga0+92(%rip), %eax
+	testl %eax, %eax
+	jne .L60
+	cmpl $0, -28(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L61
+.L60:
+	movl $1, %eax
+.L61:
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	jmp .L57
+.L41:
+	movl $1, %eax
+.L42:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 24(%rbp)
+	movl 24(%rbp), %eax
+	imull 24(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L43
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L47
+	cmpl $0, 24(%rbp)
+	je .L47
+.L45:
+.L46:
+.L43:
+.L44:
+	addq $1, -48(%rbp)
+	cmpq $33, -48(%rbp)
+	jb .L39
+.L40:
+	movl $1, %eax
+	movzwl -20(%rbp), %ecx
+	subl %ecx, %eax
+	cmpl $255, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -34(%rbp)
+	cmpl $1, -52(%rbp)
+	setg %al
+	movzbl %al, %eax
+	subl $-1, %eax
+	movl %eax, 24(%rbp)
+	cmpl $0, -52(%rbp)
+	je .L48
+	cmpb $0, g2(%rip)
+	jne .L52
+	movl $976, %eax
+	testl %eax, %eax
+	jne .L52
+.L50:
+.L51:
+	movl -52(%rbp), %eax
+	movl %eax, -24(%rbp)
+.L62:
+.L63:
+.L57:
+.L49:
+	movzbl -1(%rbp), %eax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -32(%rbp)
+	cmpl $712, 16(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L31:
+	movl -124(%rbp), %eax
+	jmp .f0_return
+.L38:
+	movl -124(%rbp), %eax
+	jmp .f0_return
+.L52:
+	xorl %eax, %eax
+	cmpb $0, g2(%rip)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	jmp .f0_return
+.L55:
+	movl ga0+104(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	jmp .f0_return
+.L56:
+	cmpb $0, g1(%rip)
+	je .L62
+	movl $0, %eax
+	jmp .f0_return
+.LB0:
+	movzbl g1(%rip), %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movl %ecx, -24(%rbp)
+	movl %r8d, -28(%rbp)
+	movl %r9d, -32(%rbp)
+	movl $5, -36(%rbp)
+	movw $3, -38(%rbp)
+	movq $1, -48(%rbp)
+	movl $4, -52(%rbp)
+	movq $127, -64(%rbp)
+	movl $0, -52(%rbp)
+	movl $0, -80(%rbp)
+	movl $2, -76(%rbp)
+	movl $4, -72(%rbp)
+	movl $6, -68(%rbp)
+	movl $4, -52(%rbp)
+	movzwl -38(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	imull -24(%rbp), %eax
+	shrl $10, %eax
+	cmpl %ecx, %eax
+	setae %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	movl $1, -24(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -88(%rbp)
+	movq -64(%rbp), %rax
+	addq $3, %rax
+	movq %rax, -96(%rbp)
+	cmpl $3, -24(%rbp)
+	jae .L65
+	.p2align 4,,10
+.L64:
+	movq -16(%rbp), %rax
+	cmpq $9, %rax
+	jge .L71
+	cmpq $0, %rax
+	je .L67
+	cmpq $6, %rax
+.L74:
+.L75:
+.L69:
+.L70:
+.L66:
+	movzbl g1(%rip), %eax
+	movl -68(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	cmpl $874, %eax
+	jne .L76
+	movzwl -18(%rbp), %eax
+	movl %eax, -36(%rbp)
+	movq -48(%rbp), %rax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	cmpq $106, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jg .L78
+.L65:
+	movq $0, -48(%rbp)
+	cmpq $33, -48(%rbp)
+	jae .L83
+	movl $33, %eax
+	subq -48(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L86
+	.p2align 4,,10
+.L85:
+	cmpb $0, g2(%rip)
+	jne .L87
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L88
+.L87:
+	movl $1, %eax
+.L88:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 16(%rbp)
+	movl 16(%rbp), %eax
+	imull 16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L89
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L93
+	cmpl $0, 16(%rbp)
+	je .L93
+.L91:
+.L92:
+.L89:
+.L90:
+	addq $1, -48(%rbp)
+	cmpb $0, g2(%rip)
+	jne .L94
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L95
+.L94:
+	movl $1, %eax
+.L95:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 16(%rbp)
+	movl 16(%rbp), %eax
+	imull 16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L96
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L100
+	cmpl $0, 16(%rbp)
+	je .L100
+.L98:
+.L99:
+.L96:
+.L97:
+	addq $1, -48(%rbp)
+	subq $1, -112(%rbp)
+	jne .L85
+.L86:
+.L83:
+.L84:
+	cmpq $33, -48(%rbp)
+	jae .L102
+	.p2align 4,,10
+.L101:
+	cmpb $0, g2(%rip)
+	jne .L103
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L104
+.L78:
+.L79:
+.L76:
+.L77:
+	cmpl $0, g0(%rip)
+	je .L82
+	cmpl $0, -24(%rbp)
+	jne .L80
+.L82:
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $451, %eax
+	setge %al
+	movzbl %al, %eax
+.L81:
+	movl %eax, -28(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $3, -24(%rbp)
+	jb .L64
+	jmp .L65
+.L71:
+	cmpq $9, %rax
+	je .L68
+	cmpq $10, %rax
+	je .L67
+	jmp .L69
+.L67:
+	movslq -36(%rbp), %rax
+	subq $3, %rax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	xorl %edx, %edx
+	divq -88(%rbp)
+	pushq %rax
+	cmpq $0, -16(%rbp)
+	je .L72
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L73
+.L72:
+	movl $0, %eax
+.L73:
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq -96(%rbp), %rax
+	movl g0(%rip), %ecx
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+	jmp .L66
+.L68:
+	movl -24(%rbp), %eax
+	movq %rax, -104(%rbp)
+	movl -80(%rbp,%rax,4), %eax
+	movzbl -1(%rbp), %ecx
+	cmpl %ecx, %eax
+	jge .L74
+	movq -104(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movb %al, -1(%rbp)
+	jmp .L75
+.L80:
+	movl $1, %eax
+	jmp .L81
+.L109:
+	movl $0, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L103:
+	movl $1, %eax
+.L104:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 16(%rbp)
+	movl 16(%rbp), %eax
+	imull 16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L105
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L109
+	cmpl $0, 16(%rbp)
+	je .L109
+.L107:
+.L108:
+.L105:
+.L106:
+	addq $1, -48(%rbp)
+	cmpq $33, -48(%rbp)
+	jb .L101
+.L102:
+	movl $1, %eax
+	movzwl -18(%rbp), %ecx
+	subl %ecx, %eax
+	cmpl $255, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -38(%rbp)
+	cmpl $1, -52(%rbp)
+	setg %al
+	movzbl %al, %eax
+	subl $-1, %eax
+	movl %eax, 16(%rbp)
+	cmpl $0, -52(%rbp)
+	je .L110
+	cmpb $0, g2(%rip)
+	jne .L114
+	movl $976, %eax
+	testl %eax, %eax
+	jne .L114
+.L112:
+.L113:
+	movl -52(%rbp), %eax
+	movl %eax, -24(%rbp)
+.L118:
+.L119:
+.L111:
+	movzbl -1(%rbp), %eax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -36(%rbp)
+	cmpl $712, -32(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L93:
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+.L100:
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+.L110:
+	movl $0, -36(%rbp)
+	xorl %eax, %eax
+	subl -28(%rbp), %eax
+	jne .L117
+	xorl %eax, %eax
+	movzbl -1(%rbp), %ecx
+	subl %ecx, %eax
+	jne .L117
+.L115:
+.L116:
+	cmpb $0, g1(%rip)
+	je .L118
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+.L114:
+	xorl %eax, %eax
+	cmpb $0, g2(%rip)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	jmp .f0.constprop.0_return
+.L117:
+	movl ga0+104(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movl %ecx, -24(%rbp)
+	movl %r8d, -28(%rbp)
+	movl %r9d, -32(%rbp)
+	movl $5, -36(%rbp)
+	movw $3, -38(%rbp)
+	movq $1, -48(%rbp)
+	movl $4, -52(%rbp)
+	movq $127, -64(%rbp)
+	movl $0, -52(%rbp)
+	movl $0, -80(%rbp)
+	movl $2, -76(%rbp)
+	movl $4, -72(%rbp)
+	movl $6, -68(%rbp)
+	movl $4, -52(%rbp)
+	movzwl -38(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	imull -24(%rbp), %eax
+	shrl $10, %eax
+	cmpl %ecx, %eax
+	setae %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	movl $1, -24(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -88(%rbp)
+	movq -64(%rbp), %rax
+	addq $3, %rax
+	movq %rax, -96(%rbp)
+	cmpl $3, -24(%rbp)
+	jae .L121
+	.p2align 4,,10
+.L120:
+	movq -16(%rbp), %rax
+	cmpq $9, %rax
+	jge .L127
+	cmpq $0, %rax
+	je .L123
+	cmpq $6, %rax
+.L130:
+.L131:
+.L125:
+.L126:
+.L122:
+	movzbl g1(%rip), %eax
+	movl -68(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	cmpl $874, %eax
+	jne .L132
+	movl $2, -36(%rbp)
+	movq -48(%rbp), %rax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	cmpq $106, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jg .L134
+.L121:
+	movq $0, -48(%rbp)
+	cmpq $33, -48(%rbp)
+	jae .L139
+	movl $33, %eax
+	subq -48(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L142
+	.p2align 4,,10
+.L141:
+	cmpb $0, g2(%rip)
+	jne .L143
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L144
+.L143:
+	movl $1, %eax
+.L144:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 16(%rbp)
+	movl 16(%rbp), %eax
+	imull 16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L145
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L149
+	cmpl $0, 16(%rbp)
+	je .L149
+.L147:
+.L148:
+.L145:
+.L146:
+	addq $1, -48(%rbp)
+	cmpb $0, g2(%rip)
+	jne .L150
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L151
+.L150:
+	movl $1, %eax
+.L151:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 16(%rbp)
+	movl 16(%rbp), %eax
+	imull 16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L152
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L156
+	cmpl $0, 16(%rbp)
+	je .L156
+.L154:
+.L155:
+.L152:
+.L153:
+	addq $1, -48(%rbp)
+	subq $1, -112(%rbp)
+	jne .L141
+.L142:
+.L139:
+.L140:
+	cmpq $33, -48(%rbp)
+	jae .L158
+	.p2align 4,,10
+.L157:
+	cmpb $0, g2(%rip)
+	jne .L159
+	movl $4294967295, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L160
+.L134:
+.L135:
+.L132:
+.L133:
+	cmpl $0, g0(%rip)
+	je .L138
+	cmpl $0, -24(%rbp)
+	jne .L136
+.L138:
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $451, %eax
+	setge %al
+	movzbl %al, %eax
+.L137:
+	movl %eax, -28(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $3, -24(%rbp)
+	jb .L120
+	jmp .L121
+.L127:
+	cmpq $9, %rax
+	je .L124
+	cmpq $10, %rax
+	je .L123
+	jmp .L125
+.L123:
+	movslq -36(%rbp), %rax
+	subq $3, %rax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	xorl %edx, %edx
+	divq -88(%rbp)
+	pushq %rax
+	cmpq $0, -16(%rbp)
+	je .L128
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L129
+.L128:
+	movl $0, %eax
+.L129:
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq -96(%rbp), %rax
+	movl g0(%rip), %ecx
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+	jmp .L122
+.L124:
+	movl -24(%rbp), %eax
+	movq %rax, -104(%rbp)
+	movl -80(%rbp,%rax,4), %eax
+	movzbl -1(%rbp), %ecx
+	cmpl %ecx, %eax
+	jge .L130
+	movq -104(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movb %al, -1(%rbp)
+	jmp .L131
+.L136:
+	movl $1, %eax
+	jmp .L137
+.L165:
+	movl $0, %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L166:
+	movl $0, -36(%rbp)
+	xorl %eax, %eax
+	subl -28(%rbp), %eax
+	jne .L173
+	xorl %eax, %eax
+	movzbl -1(%rbp), %ecx
+	subl %ecx, %eax
+	jne .L173
+.L171:
+.L172:
+	movzwl -18(%rbp), %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	jg .L174
+	movl -76(%rbp), %eax
+	testl %eax, %eax
+	je .LB1
+.L176:
+.L177:
+	movl ga1+12(%rip), %eax
+	cmpl g0(%rip), %eax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	subl -116(%rbp), %eax
+	pushq %rax
+	movl ga0+92(%rip), %eax
+	testl %eax, %eax
+	jne .L178
+	cmpl $0, -28(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L179
+.L178:
+	movl $1, %eax
+.L179:
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	jmp .L175
+.L159:
+	movl $1, %eax
+.L160:
+	cmpl $256, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, 16(%rbp)
+	movl 16(%rbp), %eax
+	imull 16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $273, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .L161
+	movq -48(%rbp), %rax
+	shrq $2, %rax
+	testq %rax, %rax
+	jne .L165
+	cmpl $0, 16(%rbp)
+	je .L165
+.L163:
+.L164:
+.L161:
+.L162:
+	addq $1, -48(%rbp)
+	cmpq $33, -48(%rbp)
+	jb .L157
+.L158:
+	movw $0, -38(%rbp)
+	cmpl $1, -52(%rbp)
+	setg %al
+	movzbl %al, %eax
+	subl $-1, %eax
+	movl %eax, 16(%rbp)
+	cmpl $0, -52(%rbp)
+	je .L166
+	cmpb $0, g2(%rip)
+	jne .L170
+	movl $976, %eax
+	testl %eax, %eax
+	jne .L170
+.L168:
+.L169:
+	movl -52(%rbp), %eax
+	movl %eax, -24(%rbp)
+.L180:
+.L181:
+.L175:
+.L167:
+	movzbl -1(%rbp), %eax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -36(%rbp)
+	cmpl $712, -32(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.1_return
+.L149:
+	movl $0, %eax
+	jmp .f0.constprop.1_return
+.L156:
+	movl $0, %eax
+	jmp .f0.constprop.1_return
+.L170:
+	xorl %eax, %eax
+	cmpb $0, g2(%rip)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	jmp .f0.constprop.1_return
+.L173:
+	movl ga0+104(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	jmp .f0.constprop.1_return
+.L174:
+	cmpb $0, g1(%rip)
+	je .L180
+	movl $0, %eax
+	jmp .f0.constprop.1_return
+.LB1:
+	movzbl g1(%rip), %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movl %edi, -48(%rbp)
+	movl %esi, -44(%rbp)
+	movq %rdx, -24(%rbp)
+	movw %cx, -56(%rbp)
+	movw %r8w, -54(%rbp)
+	movb %r9b, -58(%rbp)
+	movw $450, -52(%rbp)
+	movb $227, -57(%rbp)
+	movb $196, -36(%rbp)
+	movq $418, -16(%rbp)
+	movw $667, -50(%rbp)
+	movl $10, -40(%rbp)
+	movq $461, -8(%rbp)
+	movq -8(%rbp), %rax
+	addq $125, %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movzbl -57(%rbp), %eax
+	imulq %rcx, %rax
+	testq %rax, %rax
+	je .L182
+	movzbl -57(%rbp), %eax
+	cmpl $83, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movabsq $407219762873, %rax
+	movzbl -36(%rbp), %ecx
+	addq %rcx, %rax
+	pushq %rax
+	movl $-1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $10, %eax
+	pushq %rax
+	movsbl g2(%rip), %eax
+	pushq %rax
+	movl $97, %eax
+	movq %rax, %r9
+	movl -40(%rbp), %eax
+	movq %rax, %r8
+	movl -40(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -57(%rbp), %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	cmpl $65535, g0(%rip)
+	setb %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $28629, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movzbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl $3, %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movzbl g1(%rip), %eax
+	movq %rax, %r8
+	movl $144, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movl $255, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	jne .L184
+	cmpb $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L185
+.L184:
+	movl $1, %eax
+.L185:
+	movl %eax, -44(%rbp)
+	jmp .L183
+.L182:
+	movl $0, -40(%rbp)
+	xorl %eax, %eax
+	movzbl -57(%rbp), %ecx
+	subl %ecx, %eax
+	subl $167, %eax
+	movl %eax, -28(%rbp)
+	cmpl $33, -40(%rbp)
+	jge .L187
+	.p2align 4,,10
+.L186:
+	movswl -56(%rbp), %eax
+	addl -28(%rbp), %eax
+	movw %ax, -56(%rbp)
+	cmpl $0, -44(%rbp)
+	je .L188
+.L187:
+	movq $0, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jge .L191
+	.p2align 4,,10
+.L190:
+	cmpb $0, g2(%rip)
+	je .L192
+.L191:
+	movq $0, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jge .L197
+	.p2align 4,,10
+.L196:
+	cmpb $0, g2(%rip)
+	je .L198
+.L197:
+	movq $0, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jge .L203
+	.p2align 4,,10
+.L202:
+	cmpb $0, g2(%rip)
+	je .L204
+.L203:
+	movl $5, -44(%rbp)
+	movsbl -58(%rbp), %eax
+	movzwl -54(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, -58(%rbp)
+.L183:
+	movslq -40(%rbp), %rax
+	cmpq 16(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $641, %eax
+	pushq %rax
+	movl $301, %eax
+	movq %rax, %r9
+	movl $7, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl ga1+12(%rip), %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	je .L208
+	cmpq $0, -24(%rbp)
+	jne .L215
+	cmpq $182, -24(%rbp)
+	setle %al
+	movzbl %al, %eax
+	jmp .L216
+.L204:
+.L205:
+	cmpl $0, -48(%rbp)
+	je .L206
+	jmp .L203
+.L215:
+	movl $0, %eax
+.L216:
+	movslq %eax, %rax
+	cmpq $-4, %rax
+	je .L213
+	cmpq $-1, %rax
+	je .L212
+	cmpq $4, %rax
+	je .L211
+.L214:
+	jmp .L210
+.L212:
+	movq -8(%rbp), %rax
+	pushq %rax
+	movl ga0+96(%rip), %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movl $19, %eax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	cmpl $65536, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl $169, %eax
+	pushq %rax
+	movl $838, %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movswl -56(%rbp), %eax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	movq %rax, %rdx
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movq 16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rsi
+	cmpq $403, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl ga0+108(%rip), %eax
+	movslq %eax, %rax
+	movabsq $982587642380, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movsbl -58(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -52(%rbp)
+.L213:
+	movsbl g2(%rip), %eax
+	movzwl -50(%rbp), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movb %al, -57(%rbp)
+.L210:
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	cmpq -16(%rbp), %rax
+	jae .L225
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L225:
+.L226:
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	cmpq -16(%rbp), %rax
+	jae .L227
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L227:
+.L228:
+	movw $1, -50(%rbp)
+.L208:
+.L209:
+	movw $9, -56(%rbp)
+	movsbq -58(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movswl -56(%rbp), %eax
+	movl %eax, -28(%rbp)
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $32767, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq 16(%rbp), %rax
+	seta %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $363, %eax
+	subl %ecx, %eax
+	je .L229
+	movl -44(%rbp), %eax
+	movw %ax, -32(%rbp)
+	testw %ax, %ax
+	je .L231
+	movsbl -58(%rbp), %eax
+	movsbl g2(%rip), %ecx
+	cmpl %ecx, %eax
+	jle .L233
+	movsbl g2(%rip), %eax
+	subl $5, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L234
+.L229:
+	movq $1, 16(%rbp)
+	movsbl -58(%rbp), %eax
+	movl %eax, -28(%rbp)
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -36(%rbp)
+	cmpq $8, 16(%rbp)
+	jae .L240
+	.p2align 4,,10
+.L239:
+	subq $8, %rsp
+	movl -40(%rbp), %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movq %rax, %r9
+	movl ga0+116(%rip), %eax
+	movq %rax, %r8
+	movl $128, %eax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movsbl -58(%rbp), %eax
+	movb %al, -32(%rbp)
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movzwl -52(%rbp), %eax
+	pushq %rax
+	movzwl -50(%rbp), %eax
+	movl %eax, -28(%rbp)
+	pushq %rax
+	movl $5, %eax
+	movq %rax, %r9
+	movl $66579444, %eax
+	movq %rax, %r8
+	movsbl -58(%rbp), %eax
+	movq %rax, %rcx
+	movl $80, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movzbl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L248
+	leaq .L249(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L247
+	# table target .L242
+	# table target .L243
+	# table target .L244
+	# table target .L246
+	# table target .L245
+	jmp *%rcx
+.L248:
+.L247:
+.L241:
+	movl ga1+4(%rip), %eax
+	pushq %rax
+	movsbl g2(%rip), %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movl -48(%rbp), %eax
+	movq %rax, %r8
+	movl -40(%rbp), %eax
+	movq %rax, %rcx
+	movl ga1+8(%rip), %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	cltd
+	idivl -36(%rbp)
+	movq 16(%rbp), %rax
+	imulq 16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga0+92(%rip), %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	addq $1, 16(%rbp)
+	cmpq $8, 16(%rbp)
+	jb .L239
+.L240:
+	movl $1, -32(%rbp)
+	movl $1, -48(%rbp)
+	movl -32(%rbp), %eax
+	movl %eax, -28(%rbp)
+	cmpl $100, -48(%rbp)
+	jge .L253
+	.p2align 4,,10
+.L252:
+	movsbl g2(%rip), %eax
+	subl -28(%rbp), %eax
+	je .L254
+.L253:
+	movl $1, -48(%rbp)
+	movl -32(%rbp), %eax
+	movl %eax, -28(%rbp)
+	cmpl $100, -48(%rbp)
+	jge .L259
+	.p2align 4,,10
+.L258:
+	movsbl g2(%rip), %eax
+	subl -28(%rbp), %eax
+	je .L260
+.L259:
+	movl $1, -48(%rbp)
+	movl -32(%rbp), %eax
+	movl %eax, -28(%rbp)
+	cmpl $100, -48(%rbp)
+	jge .L265
+	.p2align 4,,10
+.L264:
+	movsbl g2(%rip), %eax
+	subl -28(%rbp), %eax
+	je .L266
+.L265:
+.L230:
+	imulq $9, 16(%rbp), %rax
+	movsbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movzbl -57(%rbp), %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movl $940, %eax
+	movq %rax, %r9
+	movl $6, %eax
+	movq %rax, %r8
+	movl $911, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movzbl -57(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L266:
+.L267:
+	cmpw $0, -56(%rbp)
+	jne .L268
+	jmp .L265
+.L268:
+.L269:
+	addl $1, -48(%rbp)
+	cmpl $100, -48(%rbp)
+	jl .L264
+	jmp .L265
+.L260:
+.L261:
+	cmpw $0, -56(%rbp)
+	jne .L262
+	jmp .L259
+.L262:
+.L263:
+	addl $1, -48(%rbp)
+	cmpl $100, -48(%rbp)
+	jl .L258
+	jmp .L259
+.L254:
+.L255:
+	cmpw $0, -56(%rbp)
+	jne .L256
+	jmp .L253
+.L256:
+.L257:
+	addl $1, -48(%rbp)
+	cmpl $100, -48(%rbp)
+	jl .L252
+	jmp .L253
+.L206:
+.L207:
+	addq $1, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L202
+	jmp .L203
+.L233:
+	movl $0, %eax
+.L234:
+	movq %rax, %rcx
+	movzwl -54(%rbp), %eax
+	addl %ecx, %eax
+	jmp .L232
+.L231:
+	movb $-9, -58(%rbp)
+	movsbl -58(%rbp), %eax
+	movl %eax, -28(%rbp)
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g2(%rip), %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	cmpw $0, -54(%rbp)
+	je .L237
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L238
+.L237:
+	movl $0, %eax
+.L238:
+	movq %rax, %r9
+	movl $797, %eax
+	movq %rax, %r8
+	movl $65535, %eax
+	movq %rax, %rcx
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movzwl -52(%rbp), %eax
+	cmpq %rax, -16(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl ga1+12(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	je .L235
+	movl $4294967286, %eax
+	pushq %rax
+	movl $1059, %eax
+	pushq %rax
+	movl $3, %eax
+	pushq %rax
+	movl ga0+20(%rip), %eax
+	pushq %rax
+	movl $637, %eax
+	pushq %rax
+	movl -28(%rbp), %eax
+	cmpl -28(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $4, %eax
+	pushq %rax
+	movzbl -36(%rbp), %eax
+	movq %rax, %r9
+	movzbl -57(%rbp), %eax
+	movq %rax, %r8
+	movl $875, %eax
+	movq %rax, %rcx
+	movzwl -32(%rbp), %eax
+	movq %rax, %rdx
+	movl $679, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $16, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl $4, %eax
+	pushq %rax
+	movl $5, %eax
+	movq %rax, %r9
+	movl $857, %eax
+	movq %rax, %r8
+	movzwl -52(%rbp), %eax
+	movq %rax, %rcx
+	movzwl -52(%rbp), %eax
+	movq %rax, %rdx
+	movsbq g2(%rip), %rax
+	movq %rax, %rsi
+	movzbl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L235:
+.L236:
+	movq -16(%rbp), %rax
+	movzbl %al, %eax
+	cmpl $1, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+.L232:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divq %rcx
+	jmp .L230
+.L198:
+.L199:
+	cmpl $0, -48(%rbp)
+	je .L200
+	jmp .L197
+.L211:
+	subq $8, %rsp
+	movl $123, %eax
+	pushq %rax
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	movabsq $802605920807, %rcx
+	subq %rcx, %rax
+	pushq %rax
+	movl $4, %eax
+	pushq %rax
+	movl -44(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $393, %eax
+	pushq %rax
+	movzwl -52(%rbp), %eax
+	pushq %rax
+	movl $1015975755, %eax
+	movq %rax, %r9
+	movzbl -36(%rbp), %eax
+	movq %rax, %r8
+	movl ga0+0(%rip), %eax
+	movq %rax, %rcx
+	movsbl g2(%rip), %eax
+	movq %rax, %rdx
+	movq 16(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+52(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl ga0+40(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpq $0, -24(%rbp)
+	jne .L217
+	movl $226, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L218
+.L217:
+	movl $1, %eax
+.L218:
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.0
+	addq $16, %rsp
+	movl ga1+8(%rip), %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movzwl -54(%rbp), %eax
+	movl %eax, -28(%rbp)
+	movq %rax, %r9
+	movl $4, %eax
+	movq %rax, %r8
+	movzwl -54(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -58(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -36(%rbp), %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movzbl -57(%rbp), %eax
+	movl %eax, -32(%rbp)
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $466, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movzwl -52(%rbp), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	cmpl $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	cmpl $0, -44(%rbp)
+	jne .L221
+	movl $672, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L222
+.L221:
+	movl $1, %eax
+.L222:
+	movslq %eax, %rax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	je .L219
+	movl ga1+12(%rip), %eax
+	addl $256, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movswl -56(%rbp), %eax
+	pushq %rax
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	movzwl -54(%rbp), %eax
+	movabsq $1039005787768, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	subl $8, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl $217, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movzbl -57(%rbp), %eax
+	pushq %rax
+	movzwl -54(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %r9
+	movl $111, %eax
+	movq %rax, %r8
+	movl $60284, %eax
+	movq %rax, %rcx
+	movzwl -54(%rbp), %eax
+	movq %rax, %rdx
+	movsbq g2(%rip), %rax
+	movq %rax, %rsi
+	movl $86, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	addl -28(%rbp), %eax
+	movw %ax, -54(%rbp)
+	jmp .L210
+.L200:
+.L201:
+	addq $1, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L196
+	jmp .L197
+.L219:
+	movl $4163722699, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl g0(%rip), %eax
+	pushq %rax
+	movq -8(%rbp), %rax
+	pushq %rax
+	movl $65535, %eax
+	movq %rax, %r9
+	xorl %eax, %eax
+	movq %rax, %r8
+	movzwl -52(%rbp), %eax
+	movq %rax, %rcx
+	movl $990, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movswl -56(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl ga1+12(%rip), %eax
+	pushq %rax
+	movl $1479337798, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl $4772, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $149, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl -54(%rbp), %eax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movl -40(%rbp), %eax
+	pushq %rax
+	cmpb $0, -57(%rbp)
+	jne .L223
+	movl ga1+4(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L224
+.L223:
+	movl $1, %eax
+.L224:
+	movslq %eax, %rax
+	movq %rax, %rsi
+	cmpl $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movzwl -54(%rbp), %eax
+	pushq %rax
+	cmpl $458, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movswl -56(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	pushq %rax
+	movsbl -58(%rbp), %eax
+	pushq %rax
+	movl $13, %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %r9
+	movl $2, %eax
+	movq %rax, %r8
+	movl $9, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $73, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movl $65534, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movzbl g1(%rip), %eax
+	pushq %rax
+	movl ga0+36(%rip), %eax
+	pushq %rax
+	movl -40(%rbp), %eax
+	movq %rax, %r9
+	movl $4, %eax
+	movq %rax, %r8
+	movl $928, %eax
+	movq %rax, %rcx
+	movl $558, %eax
+	movq %rax, %rdx
+	movsbq -58(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L220:
+	jmp .L210
+.L192:
+.L193:
+	cmpl $0, -48(%rbp)
+	je .L194
+	jmp .L191
+.L194:
+.L195:
+	addq $1, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L190
+	jmp .L191
+.L188:
+.L189:
+	movl $5, %eax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	pushq %rax
+	movl -48(%rbp), %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl $51719, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movzbl -36(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L186
+	jmp .L187
+.L242:
+	movl -28(%rbp), %eax
+	pushq %rax
+	movsbl g2(%rip), %eax
+	pushq %rax
+	movzwl -52(%rbp), %eax
+	movq %rax, %r9
+	movl $4, %eax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movzbl g1(%rip), %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movl -48(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	je .L250
+	jmp .L241
+.L250:
+.L251:
+	movq $1, -16(%rbp)
+	jmp .L241
+.L243:
+	jmp .L241
+.L244:
+	jmp .L241
+.L245:
+	movswl -56(%rbp), %eax
+	jmp .L241
+.L246:
+	jmp .L241
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L249:
+	.long .L242-.L249
+	.long .L247-.L249
+	.long .L247-.L249
+	.long .L247-.L249
+	.long .L247-.L249
+	.long .L243-.L249
+	.long .L244-.L249
+	.long .L246-.L249
+	.long .L247-.L249
+	.long .L245-.L249
+	.popsection
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movq %rsi, -64(%rbp)
+	movq %rdx, -56(%rbp)
+	movq %rcx, -48(%rbp)
+	movw %r8w, -92(%rbp)
+	movb %r9b, -94(%rbp)
+	movw $8, -90(%rbp)
+	movq $5, -40(%rbp)
+	movl $103, -84(%rbp)
+	movq $6, -32(%rbp)
+	movl $1, -88(%rbp)
+	xorl %eax, %eax
+	subl $565, %eax
+	movl %eax, -68(%rbp)
+	movzbl %r9b, %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -16(%rbp)
+	cmpl $17, -88(%rbp)
+	jae .L270
+	movl $17, %eax
+	movl -88(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L273
+	.p2align 4,,10
+.L272:
+	movl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movw %ax, -90(%rbp)
+	addl $1, -88(%rbp)
+	movswl -90(%rbp), %eax
+	movw %ax, -90(%rbp)
+	addl $1, -88(%rbp)
+	movswl -90(%rbp), %eax
+	movw %ax, -90(%rbp)
+	addl $1, -88(%rbp)
+	movswl -90(%rbp), %eax
+	movw %ax, -90(%rbp)
+	addl $1, -88(%rbp)
+	subq $1, -8(%rbp)
+	jne .L272
+.L273:
+.L270:
+.L271:
+	cmpl $17, -88(%rbp)
+	jae .L275
+	.p2align 4,,10
+.L274:
+	movl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movw %ax, -90(%rbp)
+	addl $1, -88(%rbp)
+	cmpl $17, -88(%rbp)
+	jb .L274
+.L275:
+	movq -56(%rbp), %rax
+	movb %al, -93(%rbp)
+	movq $1, -56(%rbp)
+	cmpq $2147483647, -40(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -80(%rbp)
+	movabsq $344662358724, %rax
+	movl $1, %ecx
+	cqo
+	idivq %rcx
+	movq %rax, -24(%rbp)
+	movl $99, %eax
+	cmpq $14, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -76(%rbp)
+	movl $125, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movl %eax, -72(%rbp)
+	movl $4, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movl %eax, -68(%rbp)
+	cmpq $33, -56(%rbp)
+	jae .L277
+	.p2align 4,,10
+.L276:
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -80(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L278
+	movl g0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $5, %rcx
+	ja .L286
+	leaq .L287(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L283
+	# table target .L285
+	# table target .L281
+	# table target .L282
+	# table target .L284
+	jmp *%rcx
+.L278:
+	cmpl $0, -72(%rbp)
+	je .L302
+.L277:
+	movl ga0+68(%rip), %eax
+	addl $9, %eax
+	imull $317, %eax, %eax
+	pushq %rax
+	movl ga0+72(%rip), %eax
+	movzbl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	je .L310
+	subq $8, %rsp
+	movl ga1+0(%rip), %eax
+	addl $256, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpl $0, -88(%rbp)
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movl g0(%rip), %eax
+	cmpq %rax, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movswl -90(%rbp), %eax
+	cmpl %eax, -88(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movl ga0+52(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subq -48(%rbp), %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	subq $8, %rsp
+	subq $8, %rsp
+	movl $627, %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	movl $3, %eax
+	movq %rax, %r9
+	movzbl -94(%rbp), %eax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movl $128, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	subq -40(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movswl -92(%rbp), %eax
+	pushq %rax
+	movl $684, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $980, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movl ga1+4(%rip), %eax
+	movq %rax, %rdx
+	movabsq $506040350450, %rax
+	movq %rax, %rsi
+	movl $82, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %r8
+	movzbl -93(%rbp), %eax
+	cmpl $6, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movabsq $498518143977, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl ga0+112(%rip), %eax
+	movslq %eax, %rax
+	addq -64(%rbp), %rax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	popq %r9
+	call f1
+	addq $16, %rsp
+	jmp .L311
+.L286:
+.L283:
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	jne .L290
+	movl $10, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L291
+.L290:
+	movl $1, %eax
+.L291:
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	addl $724, %eax
+	movw %ax, -92(%rbp)
+	movq -64(%rbp), %rax
+	testb %al, %al
+	jne .L292
+	movswl -90(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -94(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L293
+.L292:
+	movl $1, %eax
+.L293:
+	movslq %eax, %rax
+	pushq %rax
+	movq -64(%rbp), %rax
+	imulq -64(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movl ga0+36(%rip), %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movl -88(%rbp), %eax
+	movq %rax, %r8
+	movsbl g2(%rip), %eax
+	movq %rax, %rcx
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl $173, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	movq %rax, -32(%rbp)
+.L280:
+	movl $5, %eax
+	testq %rax, %rax
+	je .L300
+	imulq $4, -32(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L301
+.L300:
+	movl $0, %eax
+.L301:
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	jmp .L279
+.L302:
+.L303:
+	movw $0, -90(%rbp)
+	movq -56(%rbp), %rax
+	addq $176, %rax
+	movl -68(%rbp), %ecx
+	imulq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movswl -90(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $33, %eax
+	jge .L305
+	.p2align 4,,10
+.L304:
+	movl ga0+68(%rip), %eax
+	testl %eax, %eax
+	je .L306
+.L305:
+.L279:
+	addq $1, -56(%rbp)
+	cmpq $33, -56(%rbp)
+	jb .L276
+	jmp .L277
+.L306:
+.L307:
+	cmpq $0, -16(%rbp)
+	je .L308
+	jmp .L305
+.L308:
+.L309:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -90(%rbp)
+	movswl -90(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $33, %eax
+	jl .L304
+	jmp .L305
+.L310:
+	movzbl -93(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $5, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -64(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	je .L312
+	movzbl g1(%rip), %eax
+	testl %eax, %eax
+	je .L314
+	movzbl -94(%rbp), %eax
+	movb %al, -94(%rbp)
+	jmp .L315
+.L318:
+	movl $0, %eax
+.L319:
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl ga1+12(%rip), %eax
+	movq %rax, %r9
+	movzbl g1(%rip), %eax
+	movq %rax, %r8
+	movl $-1, %eax
+	movq %rax, %rcx
+	movsbq g2(%rip), %rax
+	movq %rax, %rdx
+	movzbl g1(%rip), %eax
+	movq %rax, %rsi
+	movl ga1+0(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+.L315:
+.L312:
+.L313:
+	movq -32(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movl -84(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	movzbl -94(%rbp), %eax
+	pushq %rax
+	movl $-1, %eax
+	movq %rax, %r9
+	movl -88(%rbp), %eax
+	movq %rax, %r8
+	movzbl -93(%rbp), %eax
+	movq %rax, %rcx
+	movswq -92(%rbp), %rax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movq -64(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl $2, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+.L311:
+	movl $566, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+	pushq %rax
+	movl $127, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movswl %ax, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+.f2_return:
+	leave
+	ret
+.L314:
+	movl $956, %eax
+	pushq %rax
+	movswl -92(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rcx
+	movsbl g2(%rip), %eax
+	addl %ecx, %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	movl $6, %eax
+	cmpq $4, %rax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpb $0, -94(%rbp)
+	je .L316
+	cmpb $0, g2(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L317
+.L316:
+	movl $0, %eax
+.L317:
+	movq %rax, %rcx
+	movl -88(%rbp), %eax
+	addl $5, %eax
+	movq %rax, %rdx
+	movsbl g2(%rip), %eax
+	cmpl $5, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl ga1+8(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -56(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movzbl -94(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq %rax, -48(%rbp)
+	subq $8, %rsp
+	cmpl $2, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movswl -90(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	movl ga0+60(%rip), %eax
+	movl ga1+12(%rip), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $642, %eax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	pushq %rax
+	cmpq $0, -56(%rbp)
+	je .L318
+	cmpq $0, -56(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L319
+.L281:
+	subq $8, %rsp
+	movl g0(%rip), %eax
+	pushq %rax
+	movzbl -93(%rbp), %eax
+	movq %rax, %r9
+	movl $935, %eax
+	movq %rax, %r8
+	movswl -90(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -93(%rbp), %eax
+	movq %rax, %rdx
+	movl g0(%rip), %eax
+	movq %rax, %rsi
+	movswl -90(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	testw %ax, %ax
+	jne .LB2
+.L288:
+.L289:
+.L282:
+	movzbl -94(%rbp), %eax
+	movq %rax, -64(%rbp)
+	jmp .L280
+.L284:
+	cmpw $0, -92(%rbp)
+	jne .L294
+	movslq -76(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L295
+.L294:
+	movl $1, %eax
+.L295:
+	movb %al, -94(%rbp)
+	movzbl g1(%rip), %eax
+	movzbl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+84(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .LB3
+.L296:
+.L297:
+.L285:
+	movl $7, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -92(%rbp), %eax
+	cmpl %ecx, %eax
+	jge .L280
+	jmp .L280
+.L298:
+.L299:
+	jmp .L280
+.LB2:
+	movq -40(%rbp), %rax
+	jmp .f2_return
+.LB3:
+	movzbl -94(%rbp), %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L287:
+	.long .L285-.L287
+	.long .L281-.L287
+	.long .L283-.L287
+	.long .L282-.L287
+	.long .L283-.L287
+	.long .L284-.L287
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movb $0, -59(%rbp)
+	movl $551, -56(%rbp)
+	movw $963, -58(%rbp)
+	movq $7, -48(%rbp)
+	movl $8, -52(%rbp)
+	movq $9, -40(%rbp)
+	movq -48(%rbp), %rax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movzbl g1(%rip), %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq %rax, %rdx
+	movl ga0+44(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movzwl -58(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	testb %al, %al
+	jne .LB4
+.L320:
+.L321:
+	movzwl -58(%rbp), %eax
+	movl %eax, -16(%rbp)
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl -16(%rbp), %eax
+	cltd
+	idivl %ecx
+	imull $9, %eax, %eax
+	movb %al, g1(%rip)
+	cmpq $0, -48(%rbp)
+	jl .L322
+	cmpq $4, -48(%rbp)
+	jge .L322
+	movzbl -59(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-1040805554724, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L322:
+.L323:
+	movzwl -58(%rbp), %eax
+	movq %rax, -24(%rbp)
+	cmpq -40(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $40615221421, %rax
+	addq %rcx, %rax
+	jne .LB5
+.L324:
+.L325:
+	xorl %eax, %eax
+	movzbl g1(%rip), %ecx
+	subl %ecx, %eax
+	je .L326
+	movl $198, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L327
+.L326:
+	movl $0, %eax
+.L327:
+	movl %eax, ga0+116(%rip)
+	movl -52(%rbp), %eax
+	cmpl %eax, -16(%rbp)
+	jg .L328
+	subq $8, %rsp
+	xorl %eax, %eax
+	subl g0(%rip), %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	addl -52(%rbp), %eax
+	pushq %rax
+	movl $9, %eax
+	pushq %rax
+	cmpl $4, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $182, %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	movq %rax, %r9
+	movl ga1+4(%rip), %eax
+	movq %rax, %r8
+	movl ga1+4(%rip), %eax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	movq %rax, %rdx
+	movl g0(%rip), %eax
+	movq %rax, %rsi
+	movsbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rsi
+	movl -52(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	movsbl g2(%rip), %eax
+	addl -16(%rbp), %eax
+	movb %al, g2(%rip)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movsbl g2(%rip), %eax
+	movsbl g2(%rip), %ecx
+	addl %ecx, %eax
+	cmpl %eax, g0(%rip)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movq $0, -40(%rbp)
+	cmpq $17, -40(%rbp)
+	jge .L331
+	.p2align 4,,10
+.L330:
+	movl $0, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L332
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L335
+	.p2align 4,,10
+.L334:
+	movl $6, ga1+4(%rip)
+	addl $1, -52(%rbp)
+	movl $6, ga1+4(%rip)
+	addl $1, -52(%rbp)
+	movl $6, ga1+4(%rip)
+	addl $1, -52(%rbp)
+	movl $6, ga1+4(%rip)
+	addl $1, -52(%rbp)
+	subq $1, -8(%rbp)
+	jne .L334
+.L335:
+.L332:
+.L333:
+	cmpl $16, -52(%rbp)
+	jge .L337
+	.p2align 4,,10
+.L336:
+	movl $6, ga1+4(%rip)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L336
+.L337:
+	addq $1, -40(%rbp)
+	cmpq $17, -40(%rbp)
+	jl .L330
+.L331:
+	movl -16(%rbp), %eax
+	addl $755, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $541846450820, %rax
+	subq %rcx, %rax
+	jne .L338
+	movsbq g2(%rip), %rax
+	cmpq %rax, -48(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl $10, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L339
+.L328:
+	xorl %eax, %eax
+	subq -48(%rbp), %rax
+	cmpq $56, %rax
+	jge .L345
+	cmpq $3, %rax
+	je .L342
+	cmpq $5, %rax
+	je .L342
+.L341:
+	jmp .L340
+.L338:
+	movl $1, %eax
+.L339:
+	movl %eax, -52(%rbp)
+.L340:
+.L329:
+	movl $441, %eax
+	movl ga0+8(%rip), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movzbl -59(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	subl %ecx, %eax
+	movb %al, -59(%rbp)
+	movl ga1+0(%rip), %eax
+	testl %eax, %eax
+	je .L350
+	cmpl $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L351
+.L350:
+	movl $0, %eax
+.L351:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzbl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq g2(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzbl -59(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movl -56(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -52(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jge .L352
+	movl $33, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L355
+	.p2align 4,,10
+.L354:
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	subq $1, -8(%rbp)
+	jne .L354
+.L355:
+.L352:
+.L353:
+	cmpl $33, -52(%rbp)
+	jge .L357
+	.p2align 4,,10
+.L356:
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jl .L356
+.L357:
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl ga1+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L345:
+	cmpq $56, %rax
+	je .L343
+	cmpq $555, %rax
+	je .L344
+	cmpq $901, %rax
+	je .L344
+	jmp .L340
+.L342:
+	movzbl -59(%rbp), %eax
+	movb %al, g2(%rip)
+	movzbl g1(%rip), %eax
+	movq %rax, %r9
+	movl g0(%rip), %eax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movzwl -58(%rbp), %eax
+	movq %rax, %rdx
+	movl -56(%rbp), %eax
+	movq %rax, %rsi
+	movl $2256936677, %eax
+	movq %rax, %rdi
+	call f2
+	movzbl %al, %eax
+	addq %rax, -48(%rbp)
+.L343:
+	subq $8, %rsp
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $-44, %eax
+	movq %rax, %r9
+	movl $76, %eax
+	movq %rax, %r8
+	movzbl g1(%rip), %eax
+	movq %rax, %rcx
+	movzbl -59(%rbp), %eax
+	movq %rax, %rdx
+	movl -56(%rbp), %eax
+	movq %rax, %rsi
+	movzbl g1(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzwl %ax, %eax
+	jmp .L340
+.L344:
+	cmpl $0, -56(%rbp)
+	je .L348
+	movl $7, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L349
+.L348:
+	movl $0, %eax
+.L349:
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	cmpl %ecx, %eax
+	jle .LB6
+.L346:
+.L347:
+	movl ga0+92(%rip), %eax
+	subl $11, %eax
+	movl %eax, ga0+64(%rip)
+	jmp .L340
+.LB4:
+	movl $10, %eax
+	jmp .main_return
+.LB5:
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB6:
+	cmpq $3, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,178 @@
+int ga0[8];
+int ga1[33];
+char f0(unsigned int p0, char p1, unsigned long p2, unsigned short p3, long p4) {
+    short v0 = 4;
+    short v1 = 9;
+    unsigned short v2 = 745;
+    char v3 = 8;
+    int i0 = 65535;
+    long j0 = 2L;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 5; }
+    if ((96 / 13ul)) { return 10; }
+    v1 = 0;
+    while (v1 < 3) {
+        p2 = p2 + p0;
+        if (!((p1 > i0))) {
+            v0 = ((p3 + -(v1)) * (v0 - -(255)));
+        } else {
+            i0 = (((v2 <= ga0[4]) - (p1 * 902)) >= v1);
+            p1 = p1 + p0;
+            i0 = (821 + (993 / (v1 * v1 + 1)));
+        }
+        v1 = v1 + 1;
+    }
+    i0 = ((3U - (long)(10)) == (255 + (p1 || 315)));
+    p3 = 0;
+    v3 = !(((6ul / (v0 * v0 + 1)) && (471 / 100)));
+    la0[6] = !((char)(193417210665));
+    if (205) { return ((1 <= 273) / 4); }
+    return (unsigned int)(((v1 + 523) || (768893808514 + v3)));
+}
+unsigned int f1(char p0, int p1, long p2, unsigned int p3, unsigned long p4) {
+    unsigned int v0 = 901;
+    long v1 = 560562119289;
+    unsigned long v2 = 0;
+    unsigned char v3 = 1000000007;
+    int i0 = 623;
+    long j0 = 8;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 6; }
+    if (((short)(!(ga0[2])) + (i0 == (v2 - v0)))) {
+        p4 = (char)((5 / 4));
+    }
+    p2 = 0;
+    while (p2 < 3) {
+        if (4) { break; }
+        if (((unsigned char)(f0(p1, j0, p2, j0, p0)) + 9)) {
+            if (ga1[p2] < i0) { i0 = ga1[p2]; }
+        } else {
+            i0 = 0;
+            while (i0 < 100) {
+                if (v2) { break; }
+                i0 = i0 + 1;
+            }
+            if (la0[p2] < j0) { j0 = la0[p2]; }
+            if (((654684031796 != p1) >= f0(p3, 10, p3, 10, 0))) { break; }
+        }
+        for (v0 = 1; v0 < 3; v0 = v0 + 1) {
+            switch (47) {
+            default:
+                break;
+            case -4:
+                v1 = !(2147483647);
+                break;
+            case 433:
+                if (ga1[p2] < p1) { p1 = ga1[p2]; }
+                i0 = 8;
+                break;
+            case 51:
+                if (6) { break; }
+                if (p0) { break; }
+                break;
+            case 695:
+                if (f0(780476625559, j0, 423082224393, 0, p4)) { break; }
+            case 2:
+                break;
+            }
+            for (v1 = 2; v1 < 3; v1 = v1 + 1) {
+                la0[v0] = (ga0[1] - 7);
+            }
+            if (3) { return ga1[16]; }
+        }
+        p2 = p2 + 1;
+    }
+    for (p3 = 0; p3 < 5; p3 = p3 + 1) {
+        if (j0 >= 0 && j0 < 4) { la0[j0] = j0; }
+        i0 = (p2 <= ((280 + 780233527835) - 3));
+    }
+    p3 = ((j0 == j0) && ((i0 < 244) != !(ga0[0])));
+    for (v2 = 2; v2 < 8; v2 = v2 + 1) {
+        for (i0 = 1; i0 < 5; i0 = i0 + 1) {
+            if (p1 >= 0 && p1 < 4) { la0[p1] = (unsigned short)((unsigned long)(ga0[6])); }
+        }
+    }
+    return (p3 / (v3 * v3 + 1));
+}
+short f2(unsigned long p0, long p1, unsigned short p2, int p3, unsigned int p4, unsigned char p5, int p6, unsigned short p7) {
+    unsigned long v0 = 6;
+    long v1 = 1000000007;
+    unsigned int v2 = 1000000007;
+    int v3 = 2;
+    char v4 = 9;
+    int i0 = 8;
+    long j0 = 1;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 256; }
+    p6 = 0;
+    while (p6 < 3) {
+        switch ((int)((long)(89))) {
+        case 2:
+            break;
+        case 28:
+            break;
+        case 3:
+            break;
+        case 159:
+            v0 = !(((2 == p6) / (p3 * p3 + 1)));
+        case 282:
+            if ((10 || f0(p1, 5, 10, 990, 4))) {
+                if ((i0 == p6)) { return f0(p7, 5, 594320450152, j0, v4); }
+            } else {
+                if (p3) { break; }
+            }
+            break;
+        case 528:
+            switch ((421841279668 != 88)) {
+            case 1:
+                la0[p6] = (4 && ga1[14]);
+                v3 = 4;
+                break;
+            default:
+                v0 = 4l;
+            case 5:
+            case 3:
+                if (((p1 && 662310056657ul) + !(628991093349))) { break; }
+                break;
+            }
+            p5 = (char)(836);
+            break;
+        case -3:
+            p1 = 339077703438;
+            break;
+        }
+        p6 = p6 + 1;
+    }
+    f0(9, i0, (short)(v0), p2, (v2 / (p5 * p5 + 1)));
+    if (!((4 && 361))) { return (f0(p0, p0, 243, 2, 960773007253u) || p1); }
+    f1((j0 == p1), (v1 / 1024), (6 <= p5), 417, (unsigned short)(p3));
+    return 7;
+}
+int main() {
+    unsigned long v0 = 2;
+    unsigned short v1 = 9;
+    unsigned short v2 = 65535;
+    char v3 = 7;
+    int i0 = 3;
+    long j0 = 5;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 9; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 707; }
+    f2((152 == la1[3]), (v2 / (v3 * v3 + 1)), (v3 - 999835478690), v1, (9 * 560), (unsigned char)(v0), (int)(v3), f0(9, 1000000007, 5, la1[3], 6));
+    j0 = (((8 && la1[2]) / (j0 * j0 + 1)) <= (unsigned short)(!(280)));
+    v2 = (((v2 == 0) / (j0 * j0 + 1)) + (f1(0, 112, 837, 0, j0) > (j0 + 894)));
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
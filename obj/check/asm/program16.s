@@ -0,0 +1,898 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.type f0, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.type f2, @function
+	.align 16
+f0:
+	movl $10, %eax
+	ret
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movq %r8, -32(%rbp)
+	movl $901, -36(%rbp)
+	movabsq $560562119289, %rax
+	movq %rax, -48(%rbp)
+	movq $0, -56(%rbp)
+	movb $7, -57(%rbp)
+	movl $623, -64(%rbp)
+	movq $8, -72(%rbp)
+	movl $0, -64(%rbp)
+	movl $0, -96(%rbp)
+	movl $6, -92(%rbp)
+	movl $12, -88(%rbp)
+	movl $18, -84(%rbp)
+	movl $4, -64(%rbp)
+	movq -56(%rbp), %rax
+	movl -36(%rbp), %ecx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movslq -64(%rbp), %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	addl %ecx, %eax
+	je .L0
+	movq $1, -32(%rbp)
+.L0:
+.L1:
+	movq $0, -16(%rbp)
+	cmpq $3, -16(%rbp)
+	.p2align 4,,10
+.L2:
+.L3:
+	movl $0, -20(%rbp)
+	cmpq $0, -72(%rbp)
+	jl .L4
+	cmpq $4, -72(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L5
+.L4:
+	movl $0, %eax
+.L5:
+	movl %eax, -100(%rbp)
+	movabsq $780233528112, %rax
+	cmpq %rax, -16(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -104(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L6
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movq -72(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L6:
+.L7:
+	movl -104(%rbp), %eax
+	movl %eax, -64(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L8
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movq -72(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L8:
+.L9:
+	movl -104(%rbp), %eax
+	movl %eax, -64(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L10
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movq -72(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L10:
+.L11:
+	movl -104(%rbp), %eax
+	movl %eax, -64(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L12
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movq -72(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L12:
+.L13:
+	movl -104(%rbp), %eax
+	movl %eax, -64(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L14
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movq -72(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L14:
+.L15:
+	movl -104(%rbp), %eax
+	movl %eax, -64(%rbp)
+	movl $5, -20(%rbp)
+	movq -72(%rbp), %rax
+	cmpq -72(%rbp), %rax
+	jne .L16
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $244, -64(%rbp)
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L17
+.L16:
+	movl $0, %eax
+.L17:
+	movl %eax, -20(%rbp)
+	movq $2, -56(%rbp)
+	cmpl $0, -8(%rbp)
+	jl .L18
+	cmpl $4, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L19
+.L18:
+	movl $0, %eax
+.L19:
+	movl %eax, -108(%rbp)
+	cmpq $8, -56(%rbp)
+	jae .L21
+	.p2align 4,,10
+.L20:
+	movl $1, -64(%rbp)
+	movl -108(%rbp), %eax
+	movl %eax, -112(%rbp)
+	cmpl $0, -112(%rbp)
+	je .L22
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L22:
+.L23:
+	cmpl $0, -112(%rbp)
+	je .L24
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L24:
+.L25:
+	cmpl $0, -112(%rbp)
+	je .L26
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L26:
+.L27:
+	cmpl $0, -112(%rbp)
+	je .L28
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L28:
+.L29:
+	movl $5, -64(%rbp)
+	addq $1, -56(%rbp)
+	cmpq $8, -56(%rbp)
+	jb .L20
+.L21:
+	movzbl -57(%rbp), %eax
+	movl %eax, -116(%rbp)
+	imull -116(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1, .-f1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movq $2, -8(%rbp)
+	movw $9, -10(%rbp)
+	movw $65535, -12(%rbp)
+	movb $7, -13(%rbp)
+	movl $3, -20(%rbp)
+	movq $5, -32(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	je .L30
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L31
+	.p2align 4,,10
+.L32:
+	movslq -20(%rbp), %rax
+	imull $9, -20(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	imull $9, -20(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	imull $9, -20(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	imull $9, -20(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -112(%rbp)
+	jne .L32
+.L33:
+.L30:
+.L31:
+	cmpl $16, -20(%rbp)
+	jge .L35
+	.p2align 4,,10
+.L34:
+	movslq -20(%rbp), %rax
+	imull $9, -20(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L34
+.L35:
+	movl $0, -20(%rbp)
+	movl $0, -128(%rbp)
+	movl $707, -124(%rbp)
+	movl $1414, -120(%rbp)
+	movl $2121, -116(%rbp)
+	movl $4, -20(%rbp)
+	subq $8, %rsp
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %r8
+	movl -116(%rbp), %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	movsbl -13(%rbp), %eax
+	movl %eax, -136(%rbp)
+	pushq %rax
+	movq -8(%rbp), %rax
+	pushq %rax
+	movzwl -10(%rbp), %eax
+	pushq %rax
+	movsbq -13(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movabsq $999835478690, %rcx
+	subq %rcx, %rax
+	pushq %rax
+	movl -136(%rbp), %eax
+	imull -136(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %eax, -132(%rbp)
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl -116(%rbp), %eax
+	cmpl $152, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f2
+	addq $16, %rsp
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -120(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	addq $894, %rax
+	pushq %rax
+	subq $8, %rsp
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $837, %eax
+	movq %rax, %rdx
+	movl $112, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movl %eax, %eax
+	popq %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	cmpl $0, -132(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	addq %rcx, %rax
+	movw %ax, -12(%rbp)
+	movq $0, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movzwl -10(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movzwl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	addq -144(%rbp), %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jge .L36
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L37
+	.p2align 4,,10
+.L38:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -160(%rbp)
+	jne .L38
+.L39:
+.L36:
+.L37:
+	cmpl $8, -20(%rbp)
+	jge .L41
+	.p2align 4,,10
+.L40:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L40
+.L41:
+	movl $0, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jge .L42
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -168(%rbp)
+	cmpq $0, -168(%rbp)
+	je .L43
+	.p2align 4,,10
+.L44:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -168(%rbp)
+	jne .L44
+.L45:
+.L42:
+.L43:
+	cmpl $33, -20(%rbp)
+	jge .L47
+	.p2align 4,,10
+.L46:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L46
+.L47:
+	movl $0, -20(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L48
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L49
+	.p2align 4,,10
+.L50:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -176(%rbp)
+	jne .L50
+.L51:
+.L48:
+.L49:
+	cmpl $16, -20(%rbp)
+	jge .L53
+	.p2align 4,,10
+.L52:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L52
+.L53:
+	movl $0, -20(%rbp)
+	movl -128(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl -124(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl -120(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl -116(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl $4, -20(%rbp)
+	movq -152(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -152(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -152(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movq -152(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movl %ecx, -24(%rbp)
+	movb %r8b, -25(%rbp)
+	movl %r9d, -32(%rbp)
+	movq $6, -40(%rbp)
+	movq $1000000007, -48(%rbp)
+	movl $1000000007, -52(%rbp)
+	movl $2, -56(%rbp)
+	movb $9, -57(%rbp)
+	movl $8, -64(%rbp)
+	movq $1, -72(%rbp)
+	movl $0, -64(%rbp)
+	movl $0, -112(%rbp)
+	movl $256, -108(%rbp)
+	movl $512, -104(%rbp)
+	movl $768, -100(%rbp)
+	movl $1024, -96(%rbp)
+	movl $1280, -92(%rbp)
+	movl $1536, -88(%rbp)
+	movl $1792, -84(%rbp)
+	movl $8, -64(%rbp)
+	movl $0, -32(%rbp)
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -116(%rbp)
+	cmpl $3, -32(%rbp)
+	jge .L55
+	.p2align 4,,10
+.L54:
+	movl $89, %eax
+	movslq %eax, %rax
+	cmpq $28, %rax
+	jge .L64
+	cmpq $-3, %rax
+	je .L63
+	cmpq $2, %rax
+	je .L56
+	cmpq $3, %rax
+	je .L56
+	jmp .L56
+.L64:
+	cmpq $282, %rax
+	jge .L65
+	cmpq $28, %rax
+	je .L56
+	cmpq $159, %rax
+	je .L60
+	jmp .L56
+.L63:
+	movabsq $339077703438, %rax
+	movq %rax, -16(%rbp)
+.L56:
+	addl $1, -32(%rbp)
+	cmpl $3, -32(%rbp)
+	jl .L54
+.L55:
+	movzbl -25(%rbp), %eax
+	movl %eax, -120(%rbp)
+	imull -120(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %r8
+	movzwl -18(%rbp), %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movswq %ax, %rax
+	movq %rax, %rdx
+	movl -64(%rbp), %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	movl -24(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movl $417, %eax
+	pushq %rax
+	cmpl $6, -120(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	leaq 1023(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $10, %rcx
+	movq %rcx, %rax
+	movq %rax, %rsi
+	movq -72(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f1
+	movl $7, %eax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L65:
+	cmpq $282, %rax
+	je .L61
+	cmpq $528, %rax
+	je .L62
+	jmp .L56
+.L60:
+	cmpl $2, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -116(%rbp)
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L61:
+	movl -64(%rbp), %eax
+	cmpl -32(%rbp), %eax
+	je .LB0
+.L66:
+.L67:
+	jmp .L56
+.L57:
+	jmp .L56
+.L58:
+	jmp .L56
+.L59:
+	jmp .L56
+.L62:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L69
+	cmpq $3, %rax
+	je .L71
+	cmpq $5, %rax
+	je .L71
+.L70:
+	movq $4, -40(%rbp)
+.L71:
+	cmpq $0, -16(%rbp)
+	je .L68
+	movabsq $662310056657, %rax
+	testq %rax, %rax
+	je .L68
+	jmp .L68
+.L69:
+	movl ga1+56(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	movl $4, -56(%rbp)
+.L68:
+	movb $68, -25(%rbp)
+	jmp .L56
+.L72:
+.L73:
+	jmp .L68
+.LB0:
+	movsbq -57(%rbp), %rax
+	movq %rax, %r8
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $594320450152, %rax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movzwl 16(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movsbl %al, %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,218 @@
+int g0 = 285;
+int ga0[16];
+int ga1[33];
+int f0(int p0, char p1, char p2, unsigned short p3, long p4, unsigned char p5, unsigned long p6) {
+    long v0 = 6u;
+    char v1 = 161281873428;
+    unsigned char v2 = 1;
+    long v3 = 753;
+    long v4 = 3;
+    int i0 = 9;
+    long j0 = 9;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 718; }
+    p3 = ((p4 || p4) * 1000000007);
+    v2 = -(((0 / 13ul) + (v2 != 399)));
+    if ((255 <= (p5 + p4))) {
+        if ((int)(962)) {
+            if (v3) {
+                if (((i0 - p0) - 675l)) { return ((v4 < p1) && v2); }
+                if (((ga1[8] / 7) != (3 && g0))) { return !(-(4)); }
+            } else {
+                v1 = v1 + 32767l;
+                if ((v2 / (p6 * p6 + 1))) { return (917ul < p5); }
+                p2 = (((la0[1] / 7) + 4) + (p6 || 0));
+            }
+            v4 = ((p2 * 310646932249) / (p0 * p0 + 1));
+        } else {
+            if (g0) {
+                if (278) { return (unsigned long)(7); }
+                v2 = 790157506114U;
+            } else {
+                if (7) { return (256L >= (ga1[8] - 309)); }
+            }
+            v4 = (!((8 - p6)) <= (p4 != (568 > p1)));
+        }
+    } else {
+        p3 = ((ga1[9] || (j0 <= 696)) + (4 + (v0 + 431)));
+        p0 = 6;
+        if (g0 >= 0 && g0 < 8) { la0[g0] = v3; }
+    }
+    p4 = -(p0);
+    p4 = 0;
+    while (p4 < 100) {
+        if (-(p0)) {
+            v0 = 0;
+            while (v0 < 3) {
+                p6 = (2147483647 || (i0 / 16));
+                j0 = ((758 + p0) + (6 / 16));
+                if (p5) { return ga0[3]; }
+                v0 = v0 + 1;
+            }
+            if (i0 >= 0 && i0 < 8) { la0[i0] = p6; }
+            for (v4 = 1; v4 < 8; v4 = v4 + 1) {
+                la0[3] = (p2 < (long)(j0));
+            }
+        } else {
+            v2 = -(v2);
+            for (v3 = 1; v3 < 3; v3 = v3 + 1) {
+                p3 = p3 + (6 <= 3);
+                i0 = i0 + 3;
+            }
+        }
+        p3 = p3 + 182u;
+        p4 = p4 + 1;
+    }
+    if ((((16 > p0) == p0) - 994)) {
+        switch (((g0 + ga1[18]) - p1)) {
+        case 8:
+            v1 = -((-(3) == p3));
+            j0 = 0;
+            while (j0 < 8) {
+                if (((ga1[4] * j0) >= (p1 != 260))) { break; }
+                la0[j0] = (4 && (1 && v3));
+                p5 = p5 + 890;
+                j0 = j0 + 1;
+            }
+            break;
+        case 4:
+            switch ((ga0[9] - v2)) {
+            case -1:
+            case 658:
+                if (((unsigned long)(ga1[29]) && -(i0))) { return !((p4 == la0[5])); }
+            default:
+                j0 = (ga1[13] != (995 > p0));
+                p2 = p2 + (5 <= 3);
+                break;
+            case 556:
+                v2 = -(((p0 < 5) / (i0 * i0 + 1)));
+                if (!(127)) { return ((int)(770) != p1); }
+                break;
+            case 10:
+                if (!(v0)) { return ga1[7]; }
+                v1 = 4;
+            case 0:
+                la0[7] = (char)((3 * j0));
+                v2 = v2 + ((p0 / (p3 * p3 + 1)) >= 2147483647);
+                break;
+            case 38:
+                j0 = 3;
+                v2 = (char)((unsigned char)(0));
+                break;
+            case 33:
+            case 49:
+                break;
+            }
+            p1 = 1;
+            break;
+        case 1:
+            v0 = 8;
+            switch ((ga1[22] > -(1))) {
+            case 263:
+                if (((p5 >= 352208142881) == 8)) { return i0; }
+                break;
+            default:
+                p2 = p2 + i0;
+            case 4:
+                if ((p5 && 852)) { return 10; }
+                break;
+            case 543:
+                break;
+            case 142:
+                if ((-(v0) + (int)(32767u))) { return ((p2 / 16) + v0); }
+                p0 = p0 + ((888 >= ga0[8]) / (p5 * p5 + 1));
+                break;
+            case -1:
+                if ((9 + (p1 == v3))) { return ((6 - 8) < ga0[11]); }
+                break;
+            case 36:
+                break;
+            case 24:
+                break;
+            }
+        }
+        switch (762) {
+        default:
+            break;
+        case 10:
+            break;
+        case 1:
+            break;
+        }
+        p1 = p3;
+    } else {
+        p0 = !(p2);
+    }
+    la0[3] = ((65535ul * 271) - g0);
+    p6 = p6 + p0;
+    return (((v0 || 381) / 16) != p5);
+}
+void w0(short q0) {
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q0;
+}
+unsigned int f1(unsigned short p0) {
+    unsigned char v0 = 7;
+    char v1 = 0;
+    long v2 = 7;
+    unsigned long v3 = 972;
+    int i0 = 127;
+    long j0 = 1;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 0u; }
+    for (v3 = 1; v3 < 33; v3 = v3 + 1) {
+        la0[3] = ((327u + la0[1]) == f0(v1, v3, 425832458148, 8, v1, i0, ga1[32]));
+    }
+    v2 = 0;
+    while (v2 < 16) {
+        p0 = (((10 < ga0[11]) * v2) * (unsigned long)(i0));
+        v1 = f0((831 - v3), (short)(v3), (v1 <= 858354201495), p0, (unsigned long)(ga0[1]), 128L, (i0 / (v1 * v1 + 1)));
+        v2 = v2 + 1;
+    }
+    for (v2 = 2; v2 < 3; v2 = v2 + 1) {
+        p0 = p0 + 32767;
+        if (f0((634 / (v3 * v3 + 1)), (v0 > p0), (201091230232ul / (p0 * p0 + 1)), 801, 0U, (128 * 845), (102 || 966))) {
+            v3 = v3 + -((2 - v0));
+            v1 = !(((912516914836 || p0) - (long)(332)));
+            if ((((j0 == 505) * -(195465619979)) > f0(5, 8, 255, v1, 5, 658504985598, j0))) {
+                if (((int)(818) * (short)(161U))) { break; }
+                la0[v2] = (v2 != v0);
+                if (p0) { break; }
+            } else {
+                p0 = 4294967295;
+                if (((char)(4294967295) && v2)) { break; }
+                if (((unsigned long)(65535) - (3 + v3))) { break; }
+            }
+        }
+    }
+    return (i0 / (v1 * v1 + 1));
+}
+int main() {
+    unsigned int v0 = 5;
+    short v1 = 9;
+    unsigned short v2 = 7U;
+    unsigned char v3 = 6ul;
+    int v4 = 106;
+    int i0 = 754;
+    long j0 = 0;
+    if (j0 >= 0 && j0 < 33) { ga1[j0] = 2; }
+    i0 = !(ga0[1]);
+    for (v4 = 1; v4 < 16; v4 = v4 + 1) {
+        g0 = !(f0(ga0[1], j0, 732822579086, 1, v1, 37, 959));
+    }
+    v1 = (g0 >= v3);
+    v0 = (((10 + j0) - (i0 >= 2147483647L)) != (v4 + f1(1000000007)));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
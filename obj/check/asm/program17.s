@@ -0,0 +1,1345 @@
+	.section .data
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.long 285
+	.section .bss
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.type f0, @function
+	.global main
+	.type main, @function
+	.type f1, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movl %edi, -4(%rbp)
+	movb %sil, -5(%rbp)
+	movb %dl, -6(%rbp)
+	movw %cx, -8(%rbp)
+	movq %r8, -16(%rbp)
+	movb %r9b, -17(%rbp)
+	movq $6, -32(%rbp)
+	movb $20, -33(%rbp)
+	movb $1, -34(%rbp)
+	movq $753, -48(%rbp)
+	movq $3, -56(%rbp)
+	movl $9, -60(%rbp)
+	movq $9, -72(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -112(%rbp)
+	movl $718, -108(%rbp)
+	movl $1436, -104(%rbp)
+	movl $2154, -100(%rbp)
+	movl $2872, -96(%rbp)
+	movl $3590, -92(%rbp)
+	movl $4308, -88(%rbp)
+	movl $5026, -84(%rbp)
+	movl $8, -60(%rbp)
+	cmpq $0, -16(%rbp)
+	jne .L0
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L1
+.L0:
+	movl $1, %eax
+.L1:
+	imull $1000000007, %eax, %eax
+	movw %ax, -8(%rbp)
+	movzbl -34(%rbp), %eax
+	cmpl $399, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movb %al, -34(%rbp)
+	movzbl -17(%rbp), %eax
+	addq -16(%rbp), %rax
+	cmpq $255, %rax
+	jl .L2
+	cmpq $0, -48(%rbp)
+	je .L4
+	movl -60(%rbp), %eax
+	subl -4(%rbp), %eax
+	movslq %eax, %rax
+	subq $675, %rax
+	je .L6
+	movsbq -5(%rbp), %rax
+	cmpq %rax, -56(%rbp)
+	jge .L8
+	cmpb $0, -34(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L2:
+	movq -32(%rbp), %rax
+	addq $431, %rax
+	addq $4, %rax
+	pushq %rax
+	movl ga1+36(%rip), %eax
+	testl %eax, %eax
+	jne .L16
+	cmpq $696, -72(%rbp)
+	setle %al
+	movzbl %al, %eax
+	jmp .L17
+.L16:
+	movl $1, %eax
+.L17:
+	movslq %eax, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movw %ax, -8(%rbp)
+	movl $6, -4(%rbp)
+	cmpl $0, g0(%rip)
+	jl .L18
+	cmpl $8, g0(%rip)
+	jge .L18
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	jmp .L19
+.L14:
+	movl $1, %eax
+.L15:
+	pushq %rax
+	movl -108(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	addl $4, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movb %al, -6(%rbp)
+.L5:
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movsbq -6(%rbp), %rax
+	movabsq $310646932249, %rcx
+	imulq %rcx, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movq %rax, -56(%rbp)
+.L18:
+.L19:
+.L3:
+	xorl %eax, %eax
+	subl -4(%rbp), %eax
+	movl %eax, -116(%rbp)
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq $0, -16(%rbp)
+	movl -116(%rbp), %eax
+	movl %eax, -120(%rbp)
+	movl -4(%rbp), %eax
+	addl $758, %eax
+	movl %eax, -124(%rbp)
+	movl $0, -128(%rbp)
+	cmpq $100, -16(%rbp)
+	jge .L21
+	.p2align 4,,10
+.L20:
+	cmpl $0, -120(%rbp)
+	je .L22
+	movq $0, -32(%rbp)
+	movl $1, -132(%rbp)
+	movl -124(%rbp), %eax
+	movl %eax, -136(%rbp)
+	movslq -132(%rbp), %rax
+	movq %rax, 16(%rbp)
+	movslq -136(%rbp), %rax
+	movq %rax, -72(%rbp)
+	cmpb $0, -17(%rbp)
+	jne .LB0
+.L24:
+.L25:
+	movq 16(%rbp), %rax
+	movq %rax, 16(%rbp)
+	movq -72(%rbp), %rax
+	movq %rax, -72(%rbp)
+	cmpb $0, -17(%rbp)
+	jne .LB1
+.L26:
+.L27:
+	movq 16(%rbp), %rax
+	movq %rax, 16(%rbp)
+	movq -72(%rbp), %rax
+	movq %rax, -72(%rbp)
+	cmpb $0, -17(%rbp)
+	jne .LB2
+.L28:
+.L29:
+	movq $3, -32(%rbp)
+	cmpl $0, -60(%rbp)
+	jl .L30
+	cmpl $8, -60(%rbp)
+	jge .L30
+	movq 16(%rbp), %rax
+	movq %rax, %rcx
+	movslq -60(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L30:
+.L31:
+	movq $1, -56(%rbp)
+	movsbq -6(%rbp), %rax
+	cmpq -72(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -140(%rbp)
+	movl -140(%rbp), %eax
+	movl %eax, -100(%rbp)
+	movl -140(%rbp), %eax
+	movl %eax, -100(%rbp)
+	movl -140(%rbp), %eax
+	movl %eax, -100(%rbp)
+	movl -140(%rbp), %eax
+	movl %eax, -100(%rbp)
+	movl -140(%rbp), %eax
+	movl %eax, -100(%rbp)
+	movl -140(%rbp), %eax
+	movl %eax, -100(%rbp)
+	movl -140(%rbp), %eax
+	movl %eax, -100(%rbp)
+	movq $8, -56(%rbp)
+	jmp .L23
+.L22:
+	xorl %eax, %eax
+	movzbl -34(%rbp), %ecx
+	subl %ecx, %eax
+	movb %al, -34(%rbp)
+	movq $1, -48(%rbp)
+	movl -128(%rbp), %eax
+	movl %eax, -144(%rbp)
+	movzwl -8(%rbp), %eax
+	addl -144(%rbp), %eax
+	movw %ax, -8(%rbp)
+	addl $3, -60(%rbp)
+	movzwl -8(%rbp), %eax
+	addl -144(%rbp), %eax
+	movw %ax, -8(%rbp)
+	addl $3, -60(%rbp)
+	movq $3, -48(%rbp)
+.L23:
+	movzwl -8(%rbp), %eax
+	addl $182, %eax
+	movw %ax, -8(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $100, -16(%rbp)
+	jl .L20
+.L21:
+	cmpl $16, -4(%rbp)
+	setl %al
+	movzbl %al, %eax
+	cmpl -4(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	subl $994, %eax
+	je .L32
+	movl ga1+72(%rip), %eax
+	addl g0(%rip), %eax
+	movsbl -5(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L37
+	cmpq $4, %rax
+	je .L36
+	cmpq $8, %rax
+	je .L35
+	jmp .L34
+.LB0:
+	movl ga0+12(%rip), %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L32:
+	cmpb $0, -6(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	jmp .L33
+.L79:
+.L76:
+	movzwl -8(%rbp), %eax
+	movb %al, -5(%rbp)
+.L33:
+	movl $17759985, %eax
+	movslq g0(%rip), %rcx
+	subq %rcx, %rax
+	movl %eax, -100(%rbp)
+	movslq -4(%rbp), %rax
+	addq %rax, 16(%rbp)
+	cmpq $0, -32(%rbp)
+	jne .L80
+	movl $381, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L81
+.L4:
+	movsbq -33(%rbp), %rax
+	addq $32767, %rax
+	movb %al, -33(%rbp)
+	movq 16(%rbp), %rax
+	imulq 16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzbl -34(%rbp), %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	jne .LB3
+.L12:
+.L13:
+	cmpq $0, 16(%rbp)
+	jne .L14
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L15
+.L37:
+	movq $8, -32(%rbp)
+	movl ga1+88(%rip), %eax
+	cmpl $-1, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $36, %rax
+	jge .L66
+	cmpq $-1, %rax
+	je .L63
+	cmpq $4, %rax
+	je .L60
+	cmpq $24, %rax
+	je .L57
+.L59:
+	movsbl -6(%rbp), %eax
+	addl -60(%rbp), %eax
+	movb %al, -6(%rbp)
+.L60:
+	cmpb $0, -17(%rbp)
+	je .L57
+	movl $852, %eax
+	testl %eax, %eax
+	jne .LB4
+.L70:
+.L71:
+	jmp .L57
+.L6:
+.L7:
+	movl ga1+32(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	cmpl $0, g0(%rip)
+	setne %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	jne .LB5
+.L10:
+.L11:
+	jmp .L5
+.L35:
+	movzwl -8(%rbp), %eax
+	cmpl $-3, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -33(%rbp)
+	movq $0, -72(%rbp)
+	movsbl -5(%rbp), %eax
+	cmpl $260, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -148(%rbp)
+	cmpq $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -152(%rbp)
+	cmpq $8, -72(%rbp)
+	jge .L39
+	.p2align 4,,10
+.L38:
+	movl ga1+16(%rip), %eax
+	movslq %eax, %rax
+	imulq -72(%rbp), %rax
+	movslq -148(%rbp), %rcx
+	cmpq %rcx, %rax
+	jl .L40
+.L39:
+.L57:
+.L34:
+	movl $762, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L79
+	cmpq $10, %rax
+	je .L76
+.L77:
+	jmp .L76
+.L40:
+.L41:
+	movq -72(%rbp), %rax
+	movl -152(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	movzbl -17(%rbp), %eax
+	addl $890, %eax
+	movb %al, -17(%rbp)
+	addq $1, -72(%rbp)
+	cmpq $8, -72(%rbp)
+	jl .L38
+	jmp .L39
+.L78:
+	jmp .L76
+.L36:
+	movl ga0+36(%rip), %eax
+	movzbl -34(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $38, %rax
+	jge .L50
+	cmpq $10, %rax
+	jge .L51
+	cmpq $-1, %rax
+	je .L43
+	cmpq $0, %rax
+	je .L47
+	jmp .L44
+.L66:
+	cmpq $263, %rax
+	jge .L67
+	cmpq $36, %rax
+	je .L57
+	cmpq $142, %rax
+	je .L62
+	jmp .L59
+.L50:
+	cmpq $556, %rax
+	jge .L52
+	cmpq $38, %rax
+	je .L48
+	cmpq $49, %rax
+	je .L42
+	jmp .L44
+.L67:
+	cmpq $263, %rax
+	je .L58
+	cmpq $543, %rax
+	je .L57
+	jmp .L59
+.L63:
+	movsbq -5(%rbp), %rax
+	cmpq -48(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	addl $9, %eax
+	jne .LB6
+.L74:
+.L75:
+	jmp .L57
+.L51:
+	cmpq $10, %rax
+	je .L46
+	cmpq $33, %rax
+	je .L42
+	jmp .L44
+.L43:
+	movl ga1+116(%rip), %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L53
+	xorl %eax, %eax
+	subl -60(%rbp), %eax
+	jne .LB7
+.L53:
+.L54:
+.L44:
+	movl ga1+52(%rip), %eax
+	cmpl $995, -4(%rbp)
+	setl %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movsbl -6(%rbp), %eax
+	movb %al, -6(%rbp)
+.L42:
+	movb $1, -5(%rbp)
+	jmp .L34
+.L52:
+	cmpq $556, %rax
+	je .L45
+	cmpq $658, %rax
+	je .L43
+	jmp .L44
+.L58:
+	movzbl -17(%rbp), %eax
+	movabsq $352208142881, %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	cmpl $8, %eax
+	je .LB8
+.L68:
+.L69:
+	jmp .L57
+.L64:
+	jmp .L57
+.L46:
+	cmpq $0, -32(%rbp)
+	je .LB9
+.L55:
+.L56:
+	movb $4, -33(%rbp)
+.L47:
+	imulq $3, -72(%rbp), %rax
+	movsbl %al, %eax
+	movl %eax, -84(%rbp)
+	movzwl -8(%rbp), %eax
+	movl %eax, -156(%rbp)
+	imull -156(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	cltd
+	idivl %ecx
+	cmpl $2147483647, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -34(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -34(%rbp)
+	jmp .L42
+.L45:
+	movl -60(%rbp), %eax
+	imull -60(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $5, -4(%rbp)
+	setl %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -34(%rbp)
+	jmp .L42
+.L48:
+	movq $3, -72(%rbp)
+	movb $0, -34(%rbp)
+	jmp .L42
+.L49:
+	jmp .L42
+.L61:
+	jmp .L57
+.L62:
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	addq $32767, %rax
+	jne .LB10
+.L72:
+.L73:
+	movzbl -17(%rbp), %eax
+	movl %eax, -160(%rbp)
+	imull -160(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+32(%rip), %eax
+	cmpl $888, %eax
+	setle %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	addl %eax, -4(%rbp)
+	jmp .L57
+.L65:
+	jmp .L57
+.L80:
+	movl $1, %eax
+.L81:
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movzbl -17(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB1:
+	movl ga0+12(%rip), %eax
+	jmp .f0_return
+.LB2:
+	movl ga0+12(%rip), %eax
+	jmp .f0_return
+.L8:
+	movl $0, %eax
+.L9:
+	jmp .f0_return
+.LB3:
+	movzbl -17(%rbp), %eax
+	cmpq $917, %rax
+	seta %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB5:
+	movl $0, %eax
+	jmp .f0_return
+.LB6:
+	movl ga0+44(%rip), %eax
+	cmpl $-2, %eax
+	setg %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB4:
+	movl $10, %eax
+	jmp .f0_return
+.LB8:
+	movl -60(%rbp), %eax
+	jmp .f0_return
+.LB9:
+	movl ga1+28(%rip), %eax
+	jmp .f0_return
+.LB10:
+	movsbl -6(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	addq -32(%rbp), %rax
+	jmp .f0_return
+.LB7:
+	movl -92(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movw $9, -44(%rbp)
+	movw $7, -42(%rbp)
+	movb $6, -45(%rbp)
+	movq $0, -32(%rbp)
+	cmpq $0, -32(%rbp)
+	jl .L82
+	cmpq $33, -32(%rbp)
+	jge .L82
+	movq -32(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl $2, (%rdx,%rax,4)
+.L82:
+.L83:
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jge .L84
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L85
+	.p2align 4,,10
+.L86:
+	subq $8, %rsp
+	movl $959, %eax
+	pushq %rax
+	movl $37, %eax
+	movq %rax, %r9
+	movswq -44(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $-114, %eax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movb %al, -16(%rbp)
+	movq %rax, %rsi
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	addl $1, -40(%rbp)
+	subq $8, %rsp
+	movl $959, %eax
+	pushq %rax
+	movl $37, %eax
+	movq %rax, %r9
+	movq -8(%rbp), %rax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $-114, %eax
+	movq %rax, %rdx
+	movsbl -16(%rbp), %eax
+	movq %rax, %rsi
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	addl $1, -40(%rbp)
+	subq $1, -24(%rbp)
+	jne .L86
+.L87:
+.L84:
+.L85:
+	cmpl $16, -40(%rbp)
+	jge .L89
+	.p2align 4,,10
+.L88:
+	subq $8, %rsp
+	movl $959, %eax
+	pushq %rax
+	movl $37, %eax
+	movq %rax, %r9
+	movswq -44(%rbp), %rax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $-114, %eax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L88
+.L89:
+	movzbl -45(%rbp), %eax
+	cmpl %eax, g0(%rip)
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -44(%rbp)
+	movl $51719, %eax
+	movq %rax, %rdi
+	call f1
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	addl %ecx, %eax
+	pushq %rax
+	movslq -36(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2147483647, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	addq $10, %rax
+	subq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -24(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movl -24(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movswq -44(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzwl -42(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzbl -45(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -40(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L90
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L91
+	.p2align 4,,10
+.L92:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -8(%rbp)
+	jne .L92
+.L93:
+.L90:
+.L91:
+	cmpl $16, -36(%rbp)
+	jge .L95
+	.p2align 4,,10
+.L94:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L94
+.L95:
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L96
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L97
+	.p2align 4,,10
+.L98:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -8(%rbp)
+	jne .L98
+.L99:
+.L96:
+.L97:
+	cmpl $33, -36(%rbp)
+	jge .L101
+	.p2align 4,,10
+.L100:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L100
+.L101:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	leave
+	ret
+	.size main, .-main
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movw %di, -2(%rbp)
+	movb $7, -3(%rbp)
+	movb $0, -4(%rbp)
+	movq $7, -16(%rbp)
+	movq $972, -24(%rbp)
+	movl $127, -28(%rbp)
+	movq $1, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -64(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -56(%rbp)
+	movl $0, -52(%rbp)
+	movl $4, -28(%rbp)
+	movq $1, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jae .L102
+	movl $33, %eax
+	subq -24(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -72(%rbp)
+	cmpq $0, -72(%rbp)
+	je .L105
+	.p2align 4,,10
+.L104:
+	subq $8, %rsp
+	movl ga1+128(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -28(%rbp), %eax
+	movb %al, -89(%rbp)
+	movq %rax, %r9
+	movsbq -4(%rbp), %rax
+	movq %rax, -88(%rbp)
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movl $-92, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movsbl -4(%rbp), %eax
+	movl %eax, -76(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	addl $327, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	addq $1, -24(%rbp)
+	subq $8, %rsp
+	movl ga1+128(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzbl -89(%rbp), %eax
+	movq %rax, %r9
+	movq -88(%rbp), %rax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movl $-92, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl -76(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	addl $327, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -72(%rbp)
+	jne .L104
+.L105:
+.L102:
+.L103:
+	cmpq $33, -24(%rbp)
+	jae .L107
+	.p2align 4,,10
+.L106:
+	subq $8, %rsp
+	movl ga1+128(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -28(%rbp), %eax
+	movq %rax, %r9
+	movsbq -4(%rbp), %rax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movl $-92, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movsbl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	addl $327, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jb .L106
+.L107:
+	movq $0, -16(%rbp)
+	movl $831, %eax
+	subq -24(%rbp), %rax
+	movq %rax, -104(%rbp)
+	cmpq $16, -16(%rbp)
+	jge .L109
+	.p2align 4,,10
+.L108:
+	movl ga0+44(%rip), %eax
+	cmpl $10, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	imulq -16(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	imulq %rcx, %rax
+	movw %ax, -2(%rbp)
+	subq $8, %rsp
+	movsbl -4(%rbp), %eax
+	movl %eax, -108(%rbp)
+	imull -108(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movl $128, %eax
+	pushq %rax
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzwl -2(%rbp), %eax
+	pushq %rax
+	movsbq -4(%rbp), %rax
+	movabsq $858354201495, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movq -104(%rbp), %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movb %al, -4(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $16, -16(%rbp)
+	jl .L108
+.L109:
+	movq $2, -16(%rbp)
+	movl $108160, -112(%rbp)
+	movl $1, -116(%rbp)
+	movzbl -3(%rbp), %eax
+	movl %eax, -124(%rbp)
+	movq %rax, %rcx
+	movl $2, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -120(%rbp)
+	cmpq $505, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $-195465619979, %rcx
+	imulq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl $131698, -140(%rbp)
+	cmpq $3, -16(%rbp)
+	jge .L111
+	.p2align 4,,10
+.L110:
+	movzwl -2(%rbp), %eax
+	addl $32767, %eax
+	movw %ax, -2(%rbp)
+	subq $8, %rsp
+	movslq -116(%rbp), %rax
+	pushq %rax
+	movl -112(%rbp), %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl $801, %eax
+	pushq %rax
+	movzwl -2(%rbp), %eax
+	movl %eax, -144(%rbp)
+	imull -144(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $201091230232, %rax
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movl -124(%rbp), %eax
+	cmpl -144(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $634, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	testl %eax, %eax
+	je .L112
+	movslq -120(%rbp), %rax
+	addq %rax, -24(%rbp)
+	movb $0, -4(%rbp)
+	subq $8, %rsp
+	movq -40(%rbp), %rax
+	pushq %rax
+	movl $254, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movsbl -4(%rbp), %eax
+	movq %rax, %rcx
+	movl $-1, %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movslq %eax, %rax
+	cmpq %rax, -136(%rbp)
+	jle .L114
+	cmpl $0, -140(%rbp)
+	je .L116
+.L111:
+	movsbl -4(%rbp), %eax
+	movl %eax, -148(%rbp)
+	imull -148(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	cltd
+	idivl %ecx
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L118:
+.L119:
+.L122:
+.L123:
+.L115:
+.L112:
+.L113:
+	addq $1, -16(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L110
+	jmp .L111
+.L114:
+	movw $65535, -2(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L120
+	jmp .L111
+.L116:
+.L117:
+	movzbl -3(%rbp), %eax
+	cmpq %rax, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	cmpw $0, -2(%rbp)
+	je .L118
+	jmp .L111
+.L120:
+.L121:
+	movq -24(%rbp), %rax
+	addq $3, %rax
+	movq %rax, %rcx
+	movl $65535, %eax
+	subq %rcx, %rax
+	je .L122
+	jmp .L111
+	.size f1, .-f1
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
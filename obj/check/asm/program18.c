@@ -0,0 +1,265 @@
+unsigned long g0;
+short g1;
+long f0(unsigned long p0, int p1, short p2, unsigned long p3, long p4, unsigned long p5) {
+    int v0 = 43;
+    short v1 = 337;
+    unsigned char v2 = 5;
+    unsigned int v3 = 418;
+    unsigned long v4 = 81;
+    unsigned long v5 = 4;
+    int i0 = 860;
+    long j0 = 1;
+    switch (1) {
+    case 65:
+        p0 = !(594);
+        break;
+    case 2:
+        for (p0 = 0; p0 < 17; p0 = p0 + 1) {
+            p2 = (unsigned int)(((unsigned long)(12u) != p1));
+        }
+        switch (v4) {
+        default:
+            if ((char)(-(255))) {
+                p4 = (((7 + 140202828695) <= (v4 / 13ul)) * ((308 == 7) != (v5 == g1)));
+                v1 = v1 + 6;
+                if (p4) { return (int)((p2 - 9)); }
+            }
+        case 5:
+        case 1:
+            break;
+        case 4:
+            v5 = -(((int)(284724889492) + (v3 + 8)));
+            v3 = (-(502123965049) * (long)((i0 + 4)));
+            break;
+        }
+        break;
+    case -2:
+        v4 = v4 + ((128 - g0) > 9);
+        for (i0 = 0; i0 < 16; i0 = i0 + 1) {
+            if ((3 < (8 != j0))) {
+                v1 = 6;
+            } else {
+                v1 = -(((v4 <= p1) != 5));
+            }
+        }
+    case 4:
+        switch (((j0 <= v1) - 979570928384)) {
+        case 2:
+            if ((unsigned int)(-(377))) { return 3; }
+            break;
+        case 3:
+        case 830:
+            if ((short)(v5)) { return (unsigned char)((280 < 859)); }
+            switch (g0) {
+            case 57:
+                j0 = (unsigned short)(4);
+                break;
+            case 47:
+                p4 = (((j0 + 909) == (v0 && p4)) <= ((short)(0) / 3));
+                break;
+            case 12:
+                if (((v0 / (g1 * g1 + 1)) / 5l)) { return ((8 < 288) > (349 + 3)); }
+                if (((p3 && 3) == -(5))) { return v5; }
+            default:
+                break;
+            case 63:
+                p0 = p0 + ((v4 / 3) * (p4 / (v3 * v3 + 1)));
+                break;
+            case -2:
+            case 472:
+                v4 = ((i0 + (9L + 10)) - v4);
+                break;
+            case 26:
+                if ((10 / (g0 * g0 + 1))) { return (unsigned int)(9); }
+                if (((char)(v5) * p2)) { return (v0 / 1024); }
+                break;
+            }
+            break;
+        case 963:
+            break;
+        case 61:
+            if (((unsigned short)(p1) + !(8))) { return (p4 || 127); }
+            p3 = 0;
+            while (p3 < 4) {
+                if (10l) { break; }
+                if (235) { break; }
+                v5 = v5 + (p1 / 10);
+                p3 = p3 + 1;
+            }
+        case 235:
+            if (65536) {
+                if ((i0 * (3 && i0))) { return (p5 < (v5 * 0)); }
+            }
+            if ((6u != i0)) { return 0; }
+            break;
+        default:
+            i0 = ((p2 / (p1 * p1 + 1)) + !(-(j0)));
+            if (p2) { return 436; }
+        }
+    case 39:
+        if (1) {
+            p4 = (v3 || p0);
+            for (p4 = 0; p4 < 5; p4 = p4 + 1) {
+                v4 = g0;
+            }
+        }
+        switch (-(3)) {
+        case 41:
+            switch ((65535 < 32767)) {
+            case 0:
+                break;
+            case 9:
+                if (362349224859) { return (0 + g1); }
+                if ((int)(3)) { return p2; }
+                break;
+            case 4:
+                break;
+            case 102:
+                v4 = 6;
+                break;
+            }
+            v2 = ((v3 / 1024) - 0ul);
+            break;
+        default:
+        case 559:
+            break;
+        }
+        break;
+    }
+    if ((3ul / (v1 * v1 + 1))) {
+        if (5) {
+            v1 = v2;
+        } else {
+            p3 = ((255 - (8 && 576)) >= (unsigned int)(32767));
+        }
+    }
+    v2 = 749;
+    return (-((g0 + 10)) * ((g0 / 10) < (p0 || p0)));
+}
+char f1(unsigned int p0, unsigned int p1, unsigned char p2) {
+    unsigned short v0 = 5;
+    int v1 = 270694625215;
+    unsigned long v2 = 8;
+    int i0 = 316309140011;
+    long j0 = 5;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 364; }
+    if (f0((2 / (i0 * i0 + 1)), 2, (155706869391 || 49), !(210), (la0[11] + 598388751341), -(p2))) {
+        switch ((704 >= (i0 / (i0 * i0 + 1)))) {
+        case 44:
+        case 216:
+            v2 = p0;
+            break;
+        case 0:
+            switch (272) {
+            case 10:
+                v1 = v1 + !((p1 / 16));
+            case 6:
+                f0(353ul, g1, (la0[29] + p1), 10, (p0 - 2), (p0 != g1));
+                f0(293U, v2, (i0 + 664), 5, (j0 + 2147483647l), (65535 && 256));
+            case 7:
+                if (9) { return f0(v0, g1, p1, 7ul, 803, la0[0]); }
+                f0(!(i0), f0(j0, 4, v0, la0[4], j0, 6), v0, f0(la0[29], 420u, 574169118277, i0, 218, i0), v2, 6);
+                break;
+            case 5:
+                f0(3, (g1 / (g0 * g0 + 1)), f0(g1, 338, v0, la0[21], la0[10], j0), 6, (10 - p2), v1);
+                p2 = (p0 != f0(6, v1, p0, la0[23], 4, 65535));
+                break;
+            }
+            if ((-(2) - (char)(198))) { return (long)(v2); }
+            break;
+        case -3:
+            break;
+        case 1:
+            if (-((846 >= j0))) {
+                f0(i0, v0, (p1 + 255), (v2 - p2), (2 <= 10), j0);
+                p2 = g0;
+            } else {
+                p1 = v1;
+            }
+            break;
+        default:
+            if (i0) {
+                f0(v1, (int)(497), (398287026980 + 6L), i0, (71482490376 / (v2 * v2 + 1)), (v2 + 10));
+                f0((long)(v1), (v0 == 602515046061), (2 / 5l), 3, -(p2), (10 > la0[29]));
+                f0((0 / (p0 * p0 + 1)), 32767, (v0 * v1), (unsigned long)(v1), 2, (j0 || 32767));
+            }
+            j0 = (p0 <= ((7 + 74ul) + !(9)));
+            break;
+        }
+    }
+    j0 = 0;
+    while (j0 < 33) {
+        switch ((463664081917 > (v1 / 16))) {
+        case 8:
+            if (f0(!(6), (i0 - j0), p2, 10, (p1 - la0[12]), !(4))) {
+                la0[j0] = 2147483647;
+            }
+            if (f0((la0[14] - i0), !(p0), (10 > v1), f0(354, 10, p0, 5, 837, i0), f0(j0, g0, j0, 181198227992, 32767, 1025433876307u), !(10))) {
+                la0[30] = f0(g0, 2147483647, 6, g0, 849, 959);
+                p1 = 6;
+                la0[j0] = 111;
+            } else {
+                v0 = v0 + 1u;
+            }
+            break;
+        case 9:
+            i0 = (int)(-((p2 < v0)));
+            break;
+        case 4:
+            v1 = (short)((f0(p2, p1, 0, 819, v2, 4) - (la0[4] >= la0[4])));
+            break;
+        }
+        j0 = j0 + 1;
+    }
+    if (884294983364) { return (p0 / 4); }
+    return (f0(p0, 0ul, 255, 15, v1, 867) + (unsigned long)((g1 && la0[7])));
+}
+int main() {
+    unsigned char v0 = 977514065848l;
+    unsigned int v1 = 5;
+    int i0 = 10u;
+    long j0 = 768;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 367361463893; }
+    f1((595 != i0), (5L || 4u), (i0 + v0));
+    g1 = (unsigned int)((i0 || 2));
+    if (((f0(10, v1, g1, v0, 424676111185ul, 6) && (la0[1] - i0)) / 100)) {
+        v1 = v1 + (long)(6u);
+        j0 = 9;
+    } else {
+        if (v1 >= 0 && v1 < 8) { la0[v1] = 0; }
+        f1(502, !(la0[5]), (7 + 833));
+        if (g1 >= 0 && g1 < 8) { la0[g1] = !(!(857344337902)); }
+    }
+    f1(f1(la0[5], i0, 0), 984, v0);
+    f0((8 != la1[5]), 7L, (7 || la0[3]), (i0 <= 510U), f0(g1, g0, 980, g1, i0, v1), f1(531, v1, j0));
+    if (i0) {
+        la0[6] = (7 >= f1(1041403023119, g1, 10));
+    }
+    if (v1 >= 0 && v1 < 8) { la0[v1] = f1(g0, g0, 127ul); }
+    if ((((unsigned int)(j0) / 4) < (v0 / 16))) {
+        for (j0 = 0; j0 < 16; j0 = j0 + 1) {
+            if (v1 >= 0 && v1 < 8) { la1[v1] = ((j0 - la1[2]) == (32767 + 781u)); }
+            for (v1 = 0; v1 < 5; v1 = v1 + 1) {
+                g0 = (-(4) == la0[7]);
+                if (!(657)) { break; }
+                if (7) { break; }
+            }
+        }
+        v1 = i0;
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
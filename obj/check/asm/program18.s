@@ -0,0 +1,2461 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.zero 8
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.zero 2
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq %rdi, -48(%rbp)
+	movw %dx, -72(%rbp)
+	movq %rcx, -40(%rbp)
+	movl $43, -68(%rbp)
+	movw $337, -70(%rbp)
+	movb $5, -73(%rbp)
+	movl $418, -64(%rbp)
+	movq $81, -32(%rbp)
+	movq $4, -24(%rbp)
+	movl $860, -60(%rbp)
+	movq $1, -16(%rbp)
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $4, %rax
+	jge .L6
+	cmpq $-2, %rax
+	je .L3
+	cmpq $2, %rax
+	je .L2
+	jmp .L0
+.L6:
+	cmpq $4, %rax
+	je .L4
+	cmpq $39, %rax
+	je .L5
+	cmpq $65, %rax
+	je .L1
+	jmp .L0
+.L69:
+	movl $1, %eax
+.L70:
+	movslq %eax, %rax
+	movq g0(%rip), %rax
+	movq g0(%rip), %rax
+	movq g0(%rip), %rax
+	movq g0(%rip), %rax
+	movq g0(%rip), %rax
+	movl $-3, %eax
+	movslq %eax, %rax
+	cmpq $41, %rax
+	je .L72
+	cmpq $559, %rax
+.L73:
+.L71:
+.L0:
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L80
+	movzbl -73(%rbp), %eax
+.L80:
+.L81:
+	cmpq $0, -48(%rbp)
+	jne .L82
+	cmpq $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L83
+.L82:
+	movl $1, %eax
+.L83:
+	movslq %eax, %rax
+	pushq %rax
+	movq g0(%rip), %rax
+	movl $10, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq g0(%rip), %rax
+	addq $10, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	popq %rcx
+	imulq %rcx, %rax
+.f0_return:
+	leave
+	ret
+.L72:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $9, %rax
+	jge .L79
+	cmpq $0, %rax
+	je .L75
+	cmpq $4, %rax
+	je .L74
+	jmp .L74
+.L2:
+	movq $0, -48(%rbp)
+	movslq %esi, %rax
+	cmpq $12, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	cmpq $17, -48(%rbp)
+	jae .L7
+	movl $17, %eax
+	subq -48(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L10
+	.p2align 4,,10
+.L9:
+	movl -52(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	movswl -72(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	movswl -72(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	movswl -72(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	subq $1, -8(%rbp)
+	jne .L9
+.L10:
+.L7:
+.L8:
+	cmpq $17, -48(%rbp)
+	jae .L12
+	.p2align 4,,10
+.L11:
+	movl -52(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $17, -48(%rbp)
+	jb .L11
+.L12:
+	movq -32(%rbp), %rax
+	cmpq $1, %rax
+	je .L0
+	cmpq $4, %rax
+	je .L16
+	cmpq $5, %rax
+	je .L0
+.L14:
+	movswq g1(%rip), %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movabsq $140202828702, %rax
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	popq %rcx
+	imull %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movswl -70(%rbp), %eax
+	addl $6, %eax
+	movw %ax, -70(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .LB0
+.L17:
+.L18:
+.L15:
+.L13:
+	jmp .L0
+.L57:
+.L58:
+	movq $0, -40(%rbp)
+	movl %esi, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	cmpq $4, -40(%rbp)
+	.p2align 4,,10
+.L61:
+.L62:
+.L30:
+	cmpl $0, -60(%rbp)
+	setne %al
+	movzbl %al, %eax
+	imull -60(%rbp), %eax
+	testl %eax, %eax
+	jne .LB1
+.L63:
+.L64:
+	movl -60(%rbp), %eax
+	cmpl $6, %eax
+	jne .LB2
+.L65:
+.L66:
+.L67:
+.L68:
+.L25:
+.L5:
+	cmpl $0, -64(%rbp)
+	jne .L69
+	cmpq $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L70
+.L79:
+	cmpq $9, %rax
+	je .L76
+	cmpq $102, %rax
+	je .L78
+.L75:
+.L74:
+	movl -64(%rbp), %eax
+	shrl $10, %eax
+	movb %al, -73(%rbp)
+	jmp .L71
+.L1:
+	movq $0, -48(%rbp)
+	jmp .L0
+.L78:
+	jmp .L74
+.L16:
+	movl -64(%rbp), %eax
+	addl $8, %eax
+	addl $1257047956, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl -60(%rbp), %eax
+	addl $4, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-502123965049, %rax
+	imulq %rcx, %rax
+	jmp .L0
+.L77:
+	jmp .L74
+.L32:
+	cmpq $235, %rax
+	je .L30
+	cmpq $830, %rax
+	je .L27
+	cmpq $963, %rax
+	je .L25
+	jmp .L31
+.L27:
+	movq -24(%rbp), %rax
+	testw %ax, %ax
+	jne .LB3
+.L33:
+.L34:
+	movq g0(%rip), %rax
+	cmpq $47, %rax
+	jge .L43
+	cmpq $-2, %rax
+	je .L41
+	cmpq $12, %rax
+	je .L38
+	cmpq $26, %rax
+	je .L42
+	jmp .L25
+.L43:
+	cmpq $63, %rax
+	jge .L44
+	cmpq $47, %rax
+	je .L37
+	cmpq $57, %rax
+	je .L36
+	jmp .L25
+.L28:
+	jmp .L25
+.L44:
+	cmpq $63, %rax
+	je .L40
+	cmpq $472, %rax
+	je .L41
+	jmp .L25
+.L41:
+	movslq -60(%rbp), %rax
+	addq $19, %rax
+	subq -32(%rbp), %rax
+.L35:
+	jmp .L25
+.L51:
+	movl $0, %eax
+.L52:
+	cmpl $-5, %eax
+	je .LB4
+.L49:
+.L50:
+.L39:
+	jmp .L25
+.L37:
+	cmpl $0, -68(%rbp)
+	je .L45
+	cmpq $0, %r8
+	setne %al
+	movzbl %al, %eax
+	jmp .L46
+.L45:
+	movl $0, %eax
+.L46:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	addq $909, %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .L25
+.L38:
+	movswl g1(%rip), %eax
+	movswl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	jne .LB5
+.L47:
+.L48:
+	cmpq $0, -40(%rbp)
+	je .L51
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L52
+.L40:
+	movl -64(%rbp), %eax
+	imull -64(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movq %r8, %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -32(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	imulq %rcx, %rax
+	addq %rax, -48(%rbp)
+	jmp .L25
+.L36:
+	jmp .L25
+.L42:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $10, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	jne .LB6
+.L53:
+.L54:
+	movq -24(%rbp), %rax
+	movsbl %al, %eax
+	movswl -72(%rbp), %ecx
+	imull %ecx, %eax
+	testl %eax, %eax
+	jne .LB7
+.L55:
+.L56:
+	jmp .L25
+.L29:
+	movl %esi, %eax
+	movzwl %ax, %eax
+	testl %eax, %eax
+	je .L57
+	cmpq $0, %r8
+	jne .L59
+	movl $127, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L60
+.L3:
+	movl $128, %eax
+	subq g0(%rip), %rax
+	cmpq $9, %rax
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	movl $0, -60(%rbp)
+	cmpq $8, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	movslq %esi, %rax
+	cmpq %rax, -32(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	cmpl $5, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -52(%rbp)
+	cmpl $16, -60(%rbp)
+	jge .L19
+	movl $16, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L22
+	.p2align 4,,10
+.L21:
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	addl $1, -60(%rbp)
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	addl $1, -60(%rbp)
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	addl $1, -60(%rbp)
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movw %ax, -70(%rbp)
+	addl $1, -60(%rbp)
+	subq $1, -8(%rbp)
+	jne .L21
+.L22:
+.L19:
+.L20:
+	cmpl $16, -60(%rbp)
+	jge .L24
+	.p2align 4,,10
+.L23:
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movw %ax, -70(%rbp)
+	addl $1, -60(%rbp)
+	cmpl $16, -60(%rbp)
+	jl .L23
+.L24:
+.L4:
+	movswq -70(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $979570928384, %rcx
+	subq %rcx, %rax
+	cmpq $235, %rax
+	jge .L32
+	cmpq $2, %rax
+	je .L26
+	cmpq $3, %rax
+	je .L27
+	cmpq $61, %rax
+	je .L29
+.L31:
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl %esi, %eax
+	imull %esi, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movswl %dx, %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	addl %ecx, %eax
+	cmpw $0, -72(%rbp)
+	je .L67
+	movl $436, %eax
+	jmp .f0_return
+.LB1:
+	cmpq $0, %r9
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f0_return
+.L26:
+	movl $3, %eax
+	jmp .f0_return
+.LB2:
+	movl $0, %eax
+	jmp .f0_return
+.LB3:
+	movl $1, %eax
+	jmp .f0_return
+.L76:
+	movswl g1(%rip), %eax
+	movslq %eax, %rax
+	jmp .f0_return
+.L59:
+	movl $1, %eax
+.L60:
+	movslq %eax, %rax
+	jmp .f0_return
+.LB0:
+	movswl -72(%rbp), %eax
+	subl $9, %eax
+	movslq %eax, %rax
+	jmp .f0_return
+.LB5:
+	movl $0, %eax
+	jmp .f0_return
+.LB4:
+	movq -24(%rbp), %rax
+	jmp .f0_return
+.LB6:
+	movl $9, %eax
+	jmp .f0_return
+.LB7:
+	movl -68(%rbp), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq %rdi, -48(%rbp)
+	movw %dx, -72(%rbp)
+	movq %rcx, -40(%rbp)
+	movl $43, -68(%rbp)
+	movw $337, -70(%rbp)
+	movb $5, -73(%rbp)
+	movl $418, -64(%rbp)
+	movq $81, -32(%rbp)
+	movq $4, -24(%rbp)
+	movl $860, -60(%rbp)
+	movq $1, -16(%rbp)
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $4, %rax
+	jge .L90
+	cmpq $-2, %rax
+	je .L87
+	cmpq $2, %rax
+	je .L86
+	jmp .L84
+.L90:
+	cmpq $4, %rax
+	je .L88
+	cmpq $39, %rax
+	je .L89
+	cmpq $65, %rax
+	je .L85
+	jmp .L84
+.L153:
+	movl $1, %eax
+.L154:
+	movslq %eax, %rax
+	movq g0(%rip), %rax
+	movq g0(%rip), %rax
+	movq g0(%rip), %rax
+	movq g0(%rip), %rax
+	movq g0(%rip), %rax
+	movl $-3, %eax
+	movslq %eax, %rax
+	cmpq $41, %rax
+	je .L156
+	cmpq $559, %rax
+.L157:
+.L155:
+.L84:
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L164
+	movzbl -73(%rbp), %eax
+.L164:
+.L165:
+	cmpq $0, -48(%rbp)
+	jne .L166
+	cmpq $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L167
+.L166:
+	movl $1, %eax
+.L167:
+	movslq %eax, %rax
+	pushq %rax
+	movq g0(%rip), %rax
+	movl $10, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq g0(%rip), %rax
+	addq $10, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	popq %rcx
+	imulq %rcx, %rax
+.f0.constprop.0_return:
+	leave
+	ret
+.L156:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $9, %rax
+	jge .L163
+	cmpq $0, %rax
+	je .L159
+	cmpq $4, %rax
+	je .L158
+	jmp .L158
+.L86:
+	movq $0, -48(%rbp)
+	movslq %esi, %rax
+	cmpq $12, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	cmpq $17, -48(%rbp)
+	jae .L91
+	movl $17, %eax
+	subq -48(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L94
+	.p2align 4,,10
+.L93:
+	movl -52(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	movswl -72(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	movswl -72(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	movswl -72(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	subq $1, -8(%rbp)
+	jne .L93
+.L94:
+.L91:
+.L92:
+	cmpq $17, -48(%rbp)
+	jae .L96
+	.p2align 4,,10
+.L95:
+	movl -52(%rbp), %eax
+	movw %ax, -72(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $17, -48(%rbp)
+	jb .L95
+.L96:
+	movq -32(%rbp), %rax
+	cmpq $1, %rax
+	je .L84
+	cmpq $4, %rax
+	je .L100
+	cmpq $5, %rax
+	je .L84
+.L98:
+	movswq g1(%rip), %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movabsq $140202828702, %rax
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	popq %rcx
+	imull %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movswl -70(%rbp), %eax
+	addl $6, %eax
+	movw %ax, -70(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .LB8
+.L101:
+.L102:
+.L99:
+.L97:
+	jmp .L84
+.L141:
+.L142:
+	movq $0, -40(%rbp)
+	cmpq $4, -40(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpl $0, -8(%rbp)
+	.p2align 4,,10
+.L145:
+.L146:
+.L114:
+	cmpl $0, -60(%rbp)
+	setne %al
+	movzbl %al, %eax
+	imull -60(%rbp), %eax
+	testl %eax, %eax
+	jne .LB9
+.L147:
+.L148:
+	movl -60(%rbp), %eax
+	cmpl $6, %eax
+	jne .LB10
+.L149:
+.L150:
+.L151:
+.L152:
+.L109:
+.L89:
+	cmpl $0, -64(%rbp)
+	jne .L153
+	cmpq $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L154
+.L163:
+	cmpq $9, %rax
+	je .L160
+	cmpq $102, %rax
+	je .L162
+.L159:
+.L158:
+	movl -64(%rbp), %eax
+	shrl $10, %eax
+	movb %al, -73(%rbp)
+	jmp .L155
+.L85:
+	movq $0, -48(%rbp)
+	jmp .L84
+.L162:
+	jmp .L158
+.L100:
+	movl -64(%rbp), %eax
+	addl $8, %eax
+	addl $1257047956, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl -60(%rbp), %eax
+	addl $4, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-502123965049, %rax
+	imulq %rcx, %rax
+	jmp .L84
+.L161:
+	jmp .L158
+.L116:
+	cmpq $235, %rax
+	je .L114
+	cmpq $830, %rax
+	je .L111
+	cmpq $963, %rax
+	je .L109
+	jmp .L115
+.L111:
+	movq -24(%rbp), %rax
+	testw %ax, %ax
+	jne .LB11
+.L117:
+.L118:
+	movq g0(%rip), %rax
+	cmpq $47, %rax
+	jge .L127
+	cmpq $-2, %rax
+	je .L125
+	cmpq $12, %rax
+	je .L122
+	cmpq $26, %rax
+	je .L126
+	jmp .L109
+.L127:
+	cmpq $63, %rax
+	jge .L128
+	cmpq $47, %rax
+	je .L121
+	cmpq $57, %rax
+	je .L120
+	jmp .L109
+.L112:
+	jmp .L109
+.L128:
+	cmpq $63, %rax
+	je .L124
+	cmpq $472, %rax
+	je .L125
+	jmp .L109
+.L125:
+	movslq -60(%rbp), %rax
+	addq $19, %rax
+	subq -32(%rbp), %rax
+.L119:
+	jmp .L109
+.L135:
+	movl $0, %eax
+.L136:
+	cmpl $-5, %eax
+	je .LB12
+.L133:
+.L134:
+.L123:
+	jmp .L109
+.L121:
+	cmpl $0, -68(%rbp)
+	je .L129
+	cmpq $0, %r8
+	setne %al
+	movzbl %al, %eax
+	jmp .L130
+.L129:
+	movl $0, %eax
+.L130:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	addq $909, %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .L109
+.L122:
+	movswl g1(%rip), %eax
+	movswl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	jne .LB13
+.L131:
+.L132:
+	cmpq $0, -40(%rbp)
+	je .L135
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L136
+.L124:
+	movl -64(%rbp), %eax
+	imull -64(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movq %r8, %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -32(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	imulq %rcx, %rax
+	addq %rax, -48(%rbp)
+	jmp .L109
+.L120:
+	jmp .L109
+.L126:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $10, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	jne .LB14
+.L137:
+.L138:
+	movq -24(%rbp), %rax
+	movsbl %al, %eax
+	movswl -72(%rbp), %ecx
+	imull %ecx, %eax
+	testl %eax, %eax
+	jne .LB15
+.L139:
+.L140:
+	jmp .L109
+.L113:
+	movl %esi, %eax
+	movzwl %ax, %eax
+	testl %eax, %eax
+	je .L141
+	cmpq $0, %r8
+	jne .L143
+	movl $127, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L144
+.L87:
+	movl $128, %eax
+	subq g0(%rip), %rax
+	cmpq $9, %rax
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	movl $0, -60(%rbp)
+	cmpq $8, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	movslq %esi, %rax
+	cmpq %rax, -32(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	cmpl $5, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -52(%rbp)
+	cmpl $16, -60(%rbp)
+	jge .L103
+	movl $16, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L106
+	.p2align 4,,10
+.L105:
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	addl $1, -60(%rbp)
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	addl $1, -60(%rbp)
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	addl $1, -60(%rbp)
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movw %ax, -70(%rbp)
+	addl $1, -60(%rbp)
+	subq $1, -8(%rbp)
+	jne .L105
+.L106:
+.L103:
+.L104:
+	cmpl $16, -60(%rbp)
+	jge .L108
+	.p2align 4,,10
+.L107:
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movw %ax, -70(%rbp)
+	addl $1, -60(%rbp)
+	cmpl $16, -60(%rbp)
+	jl .L107
+.L108:
+.L88:
+	movswq -70(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $979570928384, %rcx
+	subq %rcx, %rax
+	cmpq $235, %rax
+	jge .L116
+	cmpq $2, %rax
+	je .L110
+	cmpq $3, %rax
+	je .L111
+	cmpq $61, %rax
+	je .L113
+.L115:
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl %esi, %eax
+	imull %esi, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movswl %dx, %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	addl %ecx, %eax
+	cmpw $0, -72(%rbp)
+	je .L151
+	movl $436, %eax
+	jmp .f0.constprop.0_return
+.LB9:
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+.L110:
+	movl $3, %eax
+	jmp .f0.constprop.0_return
+.LB10:
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+.LB11:
+	movl $1, %eax
+	jmp .f0.constprop.0_return
+.L160:
+	movswl g1(%rip), %eax
+	movslq %eax, %rax
+	jmp .f0.constprop.0_return
+.L143:
+	movl $1, %eax
+.L144:
+	movslq %eax, %rax
+	jmp .f0.constprop.0_return
+.LB8:
+	movswl -72(%rbp), %eax
+	subl $9, %eax
+	movslq %eax, %rax
+	jmp .f0.constprop.0_return
+.LB13:
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+.LB12:
+	movq -24(%rbp), %rax
+	jmp .f0.constprop.0_return
+.LB14:
+	movl $9, %eax
+	jmp .f0.constprop.0_return
+.LB15:
+	movl -68(%rbp), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movw $5, -12(%rbp)
+	movl $111685567, -16(%rbp)
+	movq $8, -24(%rbp)
+	movl $-1518439893, -28(%rbp)
+	movq $5, -40(%rbp)
+	movl $0, -28(%rbp)
+	imull $364, -28(%rbp), %eax
+	subl $364, %eax
+	movl %eax, -180(%rbp)
+	cmpl $33, -28(%rbp)
+	jge .L168
+	movl $33, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L171
+	.p2align 4,,10
+.L170:
+	addl $364, -180(%rbp)
+	movslq -28(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $364, -180(%rbp)
+	movslq -28(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $364, -180(%rbp)
+	movslq -28(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $364, -180(%rbp)
+	movslq -28(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -192(%rbp)
+	jne .L170
+.L171:
+.L168:
+.L169:
+	cmpl $33, -28(%rbp)
+	jge .L173
+	.p2align 4,,10
+.L172:
+	addl $364, -180(%rbp)
+	movslq -28(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jl .L172
+.L173:
+	xorl %eax, %eax
+	movzbl -9(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -132(%rbp), %eax
+	movslq %eax, %rax
+	movabsq $598388751341, %rcx
+	addq %rcx, %rax
+	pushq %rax
+	movl $210, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movabsq $155706869391, %rax
+	testq %rax, %rax
+	jne .L176
+	movl $49, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L177
+.L176:
+	movl $1, %eax
+.L177:
+	pushq %rax
+	movl $2, %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -196(%rbp)
+	movq %rax, %rcx
+	movl $2, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	testq %rax, %rax
+	je .L174
+	movl -28(%rbp), %eax
+	cltd
+	idivl -196(%rbp)
+	cmpl $704, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	jge .L184
+	cmpq $-3, %rax
+	je .L181
+	cmpq $0, %rax
+	je .L180
+.L183:
+	cmpl $0, -28(%rbp)
+	je .L200
+	movq -24(%rbp), %rax
+	addq $10, %rax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movabsq $71482490376, %rax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %r8
+	movslq -28(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $398287026980, %rax
+	addq $6, %rax
+	movq %rax, %rdx
+	movl $497, %eax
+	movq %rax, %rsi
+	movslq -16(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movq %rax, %rdi
+	call f0
+	movl -60(%rbp), %eax
+	cmpl $10, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	xorl %eax, %eax
+	movzbl -9(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $3, %eax
+	pushq %rax
+	movl $2, %eax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rdx
+	movzwl -12(%rbp), %eax
+	movabsq $602515046061, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movslq -16(%rbp), %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	cmpq $0, -40(%rbp)
+	jne .L202
+	movl $32767, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L203
+.L181:
+.L178:
+.L174:
+.L175:
+	movq $0, -40(%rbp)
+	cmpq $33, -40(%rbp)
+	jge .L205
+	.p2align 4,,10
+.L204:
+	movl -16(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $463664081917, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $4, %rax
+	je .L209
+	cmpq $8, %rax
+	je .L207
+	cmpq $9, %rax
+	je .L208
+	jmp .L206
+.L209:
+	movl -160(%rbp), %eax
+	movl -160(%rbp), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $4, %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl $819, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movzbl -9(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	subq %rcx, %rax
+	movswl %ax, %eax
+	movl %eax, -16(%rbp)
+.L206:
+	addq $1, -40(%rbp)
+	cmpq $33, -40(%rbp)
+	jl .L204
+.L205:
+	movabsq $884294983364, %rax
+	testq %rax, %rax
+	jne .LB16
+.L214:
+.L215:
+	cmpw $0, g1(%rip)
+	je .L216
+	movl -148(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L217
+.L207:
+	movl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	movl -128(%rbp), %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	subl %ecx, %eax
+	movq %rax, %r8
+	movl $10, %eax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	movq %rax, %rdx
+	movslq -28(%rbp), %rax
+	subq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $6, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	je .L210
+	movq -40(%rbp), %rax
+	movl $2147483647, -176(%rbp,%rax,4)
+.L210:
+.L211:
+	movl $10, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movabsq $1025433876307, %rax
+	movq %rax, %r9
+	movl $32767, %eax
+	movq %rax, %r8
+	movabsq $181198227992, %rax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movq %rax, %rdx
+	movq g0(%rip), %rax
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	movslq -28(%rbp), %rax
+	movq %rax, %r9
+	movl $837, %eax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl $354, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	cmpl $10, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	cmpl $0, -4(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -120(%rbp), %eax
+	subl -28(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f0
+	testq %rax, %rax
+	je .L212
+	movl $959, %eax
+	movq %rax, %r9
+	movl $849, %eax
+	movq %rax, %r8
+	movq g0(%rip), %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl $2147483647, %eax
+	movq %rax, %rsi
+	movq g0(%rip), %rax
+	movq %rax, %rdi
+	call f0
+	movl %eax, -56(%rbp)
+	movl $6, -8(%rbp)
+	movq -40(%rbp), %rax
+	movl $111, -176(%rbp,%rax,4)
+	jmp .L206
+.L212:
+	movzwl -12(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -12(%rbp)
+.L213:
+	jmp .L206
+.L208:
+	movzbl -9(%rbp), %eax
+	movzwl -12(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -28(%rbp)
+	jmp .L206
+.L216:
+	movl $0, %eax
+.L217:
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $867, %eax
+	movq %rax, %r9
+	movslq -16(%rbp), %rax
+	movq %rax, %r8
+	movl $15, %eax
+	movq %rax, %rcx
+	movl $255, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L184:
+	cmpq $1, %rax
+	je .L182
+	cmpq $44, %rax
+	je .L179
+	cmpq $216, %rax
+	je .L179
+	jmp .L183
+.L182:
+	xorl %eax, %eax
+	cmpq $846, -40(%rbp)
+	setle %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	je .L198
+	movq -40(%rbp), %rax
+	movq %rax, %r9
+	movl $2, %eax
+	cmpl $10, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movzbl -9(%rbp), %ecx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl $255, %eax
+	movq %rax, %rdx
+	movzwl -12(%rbp), %eax
+	movq %rax, %rsi
+	movslq -28(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	movq g0(%rip), %rax
+	movb %al, -9(%rbp)
+	jmp .L178
+.L198:
+	movl -16(%rbp), %eax
+	movl %eax, -8(%rbp)
+.L199:
+	jmp .L178
+.L179:
+	movl -4(%rbp), %eax
+	movq %rax, -24(%rbp)
+	jmp .L178
+.L202:
+	movl $1, %eax
+.L203:
+	movslq %eax, %rax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	movq -216(%rbp), %rax
+	pushq %rax
+	movzwl -12(%rbp), %eax
+	imull -16(%rbp), %eax
+	pushq %rax
+	movl $32767, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+.L200:
+.L201:
+	movl $9, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $7, %eax
+	addq $74, %rax
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	jmp .L178
+.L180:
+	movl $272, %eax
+	movslq %eax, %rax
+	leaq -5(%rax), %rcx
+	cmpq $5, %rcx
+	ja .L190
+	leaq .L191(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L185
+	# table target .L189
+	# table target .L187
+	# table target .L188
+	# table target .L186
+	jmp *%rcx
+.L190:
+.L185:
+	xorl %eax, %eax
+	subl $2, %eax
+	subl $-58, %eax
+	jne .LB17
+.L196:
+.L197:
+	jmp .L178
+.L186:
+	movl -8(%rbp), %eax
+	shrl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl %eax, -16(%rbp)
+.L187:
+	movswl g1(%rip), %eax
+	cmpl %eax, -4(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	movl -4(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %r8
+	movl $10, %eax
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	addl -8(%rbp), %eax
+	movq %rax, %rdx
+	movswl g1(%rip), %eax
+	movq %rax, %rsi
+	movl $353, %eax
+	movq %rax, %rdi
+	call f0
+	movl $65535, %eax
+	testl %eax, %eax
+	je .L192
+	movl $256, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L193
+.L192:
+	movl $0, %eax
+.L193:
+	movslq %eax, %rax
+	movq %rax, %r9
+	movq -40(%rbp), %rax
+	addq $2147483647, %rax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	addl $664, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl $293, %eax
+	movq %rax, %rdi
+	call f0
+.L188:
+	movl $9, %eax
+	testl %eax, %eax
+	jne .LB18
+.L194:
+.L195:
+	movq -24(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movslq -28(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movq %rax, %r9
+	movl $218, %eax
+	movq %rax, %r8
+	movq -208(%rbp), %rax
+	movq %rax, %rcx
+	movl $30277, %eax
+	movq %rax, %rdx
+	movl $420, %eax
+	movq %rax, %rsi
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	movzwl -12(%rbp), %eax
+	movw %ax, -198(%rbp)
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %r9
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movl -160(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movswl -198(%rbp), %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rsi
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f0.constprop.0
+	jmp .L185
+.L189:
+	movslq -16(%rbp), %rax
+	pushq %rax
+	movl $10, %eax
+	movzbl -9(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -40(%rbp), %rax
+	movq %rax, %r9
+	movl -136(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl -92(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movq %rax, %rdx
+	movl $338, %eax
+	movq %rax, %rsi
+	movswq g1(%rip), %rax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movswq g1(%rip), %rax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	movl $65535, %eax
+	movq %rax, %r9
+	movl $4, %eax
+	movq %rax, %r8
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movq %rax, %rdx
+	movl -16(%rbp), %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	jmp .L185
+.LB16:
+	movl -4(%rbp), %eax
+	shrl $2, %eax
+	jmp .f1_return
+.LB17:
+	movq -24(%rbp), %rax
+	jmp .f1_return
+.LB18:
+	movl -176(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	movl $803, %eax
+	movq %rax, %r8
+	movl $7, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movswl g1(%rip), %eax
+	movq %rax, %rsi
+	movzwl -12(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	jmp .f1_return
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L191:
+	.long .L189-.L191
+	.long .L187-.L191
+	.long .L188-.L191
+	.long .L185-.L191
+	.long .L185-.L191
+	.long .L186-.L191
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movb $184, -1(%rbp)
+	movl $5, -8(%rbp)
+	movl $10, -12(%rbp)
+	movq $768, -24(%rbp)
+	movl $0, -12(%rbp)
+	movl $0, -64(%rbp)
+	movl $2, -60(%rbp)
+	movl $4, -56(%rbp)
+	movl $6, -52(%rbp)
+	movl $8, -48(%rbp)
+	movl $10, -44(%rbp)
+	movl $12, -40(%rbp)
+	movl $14, -36(%rbp)
+	movl $8, -12(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	je .L218
+	movl $8, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L221
+	.p2align 4,,10
+.L220:
+	movslq -12(%rbp), %rax
+	movq %rax, -120(%rbp)
+	movabsq $367361463893, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movabsq $367361463893, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movabsq $367361463893, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movabsq $367361463893, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	subq $1, -112(%rbp)
+	jne .L220
+.L221:
+.L218:
+.L219:
+	cmpl $8, -12(%rbp)
+	jge .L223
+	.p2align 4,,10
+.L222:
+	movslq -12(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movabsq $367361463893, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jl .L222
+.L223:
+	movzbl -1(%rbp), %eax
+	movl %eax, -156(%rbp)
+	addl -12(%rbp), %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	cmpl $595, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f1
+	cmpl $0, -12(%rbp)
+	jne .L224
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L225
+.L224:
+	movl $1, %eax
+.L225:
+	movw %ax, g1(%rip)
+	movabsq $424676111185, %rax
+	movq %rax, %r8
+	movzbl -1(%rbp), %eax
+	movq %rax, %rcx
+	movswl g1(%rip), %eax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	testq %rax, %rax
+	je .L228
+	movl -60(%rbp), %eax
+	subl -12(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L229
+.L228:
+	movl $0, %eax
+.L229:
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L226
+	movl -8(%rbp), %eax
+	addq $6, %rax
+	movl %eax, -8(%rbp)
+	movq $9, -24(%rbp)
+.L232:
+.L233:
+.L227:
+	movzbl -1(%rbp), %eax
+	pushq %rax
+	movl $984, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl -12(%rbp), %eax
+	movl %eax, -160(%rbp)
+	movq %rax, %rsi
+	movl -44(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movsbl %al, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	call f1
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl $531, %eax
+	movq %rax, %rdi
+	call f1
+	movsbq %al, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	movq %rax, %r9
+	movslq -12(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movq %rax, %r8
+	movswq g1(%rip), %rax
+	movq %rax, %rcx
+	movl $980, %eax
+	movq %rax, %rdx
+	movq g0(%rip), %rax
+	movq %rax, %rsi
+	movswq g1(%rip), %rax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %r8
+	cmpl $510, -160(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -76(%rbp), %eax
+	cmpl $8, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	cmpl $0, -12(%rbp)
+	je .L234
+	movl $10, %eax
+	movq %rax, %rdx
+	movswl g1(%rip), %eax
+	movq %rax, %rsi
+	movl $2020937487, %eax
+	movq %rax, %rdi
+	call f1
+	movsbl %al, %eax
+	cmpl $7, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+.L234:
+.L235:
+	cmpl $0, -8(%rbp)
+	jb .L236
+	cmpl $8, -8(%rbp)
+	jae .L236
+	movl $127, %eax
+	movq %rax, %rdx
+	movq g0(%rip), %rax
+	movq %rax, %rsi
+	movq g0(%rip), %rax
+	movq %rax, %rdi
+	call f1
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movl %ecx, -64(%rbp,%rax,4)
+.L236:
+.L237:
+	movl -156(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	shrl $2, %eax
+	cmpl %ecx, %eax
+	jae .L238
+	movq $0, -24(%rbp)
+	movl $33548, -172(%rbp)
+	movl $-4, -176(%rbp)
+	cmpq $16, -24(%rbp)
+	jge .L241
+	.p2align 4,,10
+.L240:
+	cmpl $0, -8(%rbp)
+	jb .L242
+	cmpl $8, -8(%rbp)
+	jae .L242
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	subq %rcx, %rax
+	movl -172(%rbp), %ecx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L242:
+.L243:
+	movl $0, -8(%rbp)
+	movl -176(%rbp), %eax
+	movl %eax, -180(%rbp)
+	cmpl $5, -8(%rbp)
+	jae .L245
+	.p2align 4,,10
+.L244:
+	movl -36(%rbp), %eax
+	cmpl %eax, -180(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+.L245:
+	addq $1, -24(%rbp)
+	cmpq $16, -24(%rbp)
+	jl .L240
+.L241:
+	movl -160(%rbp), %eax
+	movl %eax, -8(%rbp)
+.L238:
+.L239:
+	movq $0, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movswq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movzbl -1(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq -168(%rbp), %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L246
+	movl $8, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L249
+	.p2align 4,,10
+.L248:
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -200(%rbp)
+	jne .L248
+.L249:
+.L246:
+.L247:
+	cmpl $8, -12(%rbp)
+	jge .L251
+	.p2align 4,,10
+.L250:
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jl .L250
+.L251:
+	movl $0, -12(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L252
+	movl $8, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L255
+	.p2align 4,,10
+.L254:
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -208(%rbp)
+	jne .L254
+.L255:
+.L252:
+.L253:
+	cmpl $8, -12(%rbp)
+	jge .L257
+	.p2align 4,,10
+.L256:
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jl .L256
+.L257:
+	movq -192(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -192(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -192(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movq -192(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L226:
+	cmpl $0, -8(%rbp)
+	jb .L230
+	cmpl $8, -8(%rbp)
+	jae .L230
+	movl -8(%rbp), %eax
+	movl $0, -64(%rbp,%rax,4)
+.L230:
+.L231:
+	movl $72, %eax
+	movq %rax, %rdx
+	movl -44(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl $502, %eax
+	movq %rax, %rdi
+	call f1
+	movswl g1(%rip), %eax
+	testl %eax, %eax
+	jl .L232
+	movswl g1(%rip), %eax
+	cmpl $8, %eax
+	jge .L232
+	movswq g1(%rip), %rax
+	movl $1, -64(%rbp,%rax,4)
+	jmp .L233
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
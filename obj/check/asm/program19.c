@@ -0,0 +1,132 @@
+unsigned short g0;
+unsigned long g1;
+int g2 = 4;
+int main() {
+    unsigned int v0 = 3;
+    int v1 = 945;
+    int i0 = 6;
+    long j0 = 7;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 616; }
+    if (-(g2)) {
+        if (v1) {
+            g1 = ((-(v0) / (g0 * g0 + 1)) * (g0 - (9 < v0)));
+            i0 = 99;
+            if (((2 == g1) + (short)(j0))) {
+                if ((10 <= (2147483647 && 65536))) { return g1; }
+                g0 = j0;
+                if ((unsigned int)(!(347))) { return ((127 / (v1 * v1 + 1)) > 3); }
+            } else {
+                v1 = i0;
+            }
+        } else {
+            switch (((2 / (v0 * v0 + 1)) == (v0 / 8))) {
+            case 6:
+                if ((7 < g2)) { return ((9 == 4) - (g0 && g1)); }
+                if (v0) { return (i0 * v0); }
+                break;
+            case 5:
+                if (717u) { return (g0 / (v1 * v1 + 1)); }
+                if ((g2 && (2 && 0))) { return g1; }
+                break;
+            case 8:
+                if (1) { return j0; }
+                v0 = (unsigned char)(j0);
+            default:
+                i0 = i0 + 10;
+            case 4:
+                j0 = (short)((444 * 7));
+            case 2:
+                v1 = !(i0);
+                if (j0) { return (int)(i0); }
+                break;
+            }
+        }
+        j0 = j0 + ((3U / (g2 * g2 + 1)) > 832898042526);
+    }
+    j0 = ((char)((v1 + v1)) + ((1 != 168) + 10));
+    i0 = 0;
+    for (j0 = 1; j0 < 16; j0 = j0 + 1) {
+        switch ((unsigned short)((la0[3] - la0[1]))) {
+        case 2:
+            for (i0 = 2; i0 < 4; i0 = i0 + 1) {
+                g0 = (char)((i0 - 65535));
+            }
+            break;
+        case 3:
+            i0 = j0;
+            break;
+        case 80:
+            break;
+        case 114:
+            g2 = 683;
+        case 9:
+        case 184:
+            la0[1] = ((4 != g2) && g1);
+            la0[1] = ((v0 > v1) > (3 != 431));
+            break;
+        }
+        v1 = 0L;
+    }
+    if ((v1 > 5)) { return (unsigned char)(v1); }
+    switch (j0) {
+    case 136:
+        la0[2] = (0 * (4 / 4));
+        for (v0 = 2; v0 < 17; v0 = v0 + 1) {
+            for (i0 = 1; i0 < 33; i0 = i0 + 1) {
+                if (((g0 * 455) || -(j0))) { break; }
+                v1 = v1 + ((0 - 761) / (i0 * i0 + 1));
+            }
+        }
+        break;
+    case 4:
+        break;
+    default:
+        la0[0] = (j0 - 481);
+        for (i0 = 0; i0 < 16; i0 = i0 + 1) {
+            j0 = 255;
+        }
+    case 66:
+        if (i0 >= 0 && i0 < 4) { la0[i0] = ((10 + g1) < v0); }
+        j0 = ((356L && (i0 - i0)) && (unsigned int)(0));
+        break;
+    case 0:
+        if ((unsigned char)((3 / 13ul))) {
+            for (v0 = 0; v0 < 16; v0 = v0 + 1) {
+                g0 = (unsigned int)((!(i0) < j0));
+                if ((g2 || la0[0])) { break; }
+                if ((!(8u) + (776 < g2))) { break; }
+            }
+            if (-(g1)) {
+                if (7) { return !(g1); }
+                if ((-(9) || v0)) { return -((5 * 0)); }
+                i0 = (short)((g1 != 9));
+            }
+            v0 = 0;
+            while (v0 < 16) {
+                g1 = !(j0);
+                v1 = ((919235358264 - 53l) || j0);
+                v0 = v0 + 1;
+            }
+        }
+        v0 = 5;
+    case 1:
+        v0 = v0 + (char)(la0[3]);
+        break;
+    case -5:
+        g1 = v1;
+        v0 = 195;
+        break;
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,541 @@
+	.section .data
+	.type g2, @object
+	.size g2, 4
+	.p2align 2
+g2:
+	.long 4
+	.section .bss
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.zero 2
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.zero 8
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movl $3, -4(%rbp)
+	movl $945, -8(%rbp)
+	movl $6, -12(%rbp)
+	movq $7, -24(%rbp)
+	movl $0, -12(%rbp)
+	movl $0, -48(%rbp)
+	movl $616, -44(%rbp)
+	movl $1232, -40(%rbp)
+	movl $1848, -36(%rbp)
+	movl $4, -12(%rbp)
+	xorl %eax, %eax
+	subl g2(%rip), %eax
+	je .L0
+	cmpl $0, -8(%rbp)
+	je .L2
+	movzwl g0(%rip), %eax
+	cmpl $9, -4(%rbp)
+	seta %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movzwl g0(%rip), %eax
+	movzwl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl -4(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	imull %ecx, %eax
+	movq %rax, g1(%rip)
+	movl $99, -12(%rbp)
+	movq -24(%rbp), %rax
+	movswl %ax, %eax
+	movq %rax, %rcx
+	cmpq $2, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L4
+	movq -24(%rbp), %rax
+	movw %ax, g0(%rip)
+	jmp .L5
+.L4:
+	movl -12(%rbp), %eax
+	movl %eax, -8(%rbp)
+.L5:
+.L6:
+.L3:
+	movl g2(%rip), %eax
+	imull g2(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movabsq $832898042526, %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+.L0:
+.L1:
+	movl -8(%rbp), %eax
+	addl -8(%rbp), %eax
+	movsbl %al, %eax
+	addl $11, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl $0, -12(%rbp)
+	movq $1, -24(%rbp)
+	movl $1, -52(%rbp)
+	cmpq $16, -24(%rbp)
+	jge .L24
+	.p2align 4,,10
+.L23:
+	movl -36(%rbp), %eax
+	movl -44(%rbp), %ecx
+	subl %ecx, %eax
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $80, %rax
+	jge .L31
+	cmpq $2, %rax
+	je .L26
+	cmpq $3, %rax
+	je .L27
+	cmpq $9, %rax
+	je .L30
+	jmp .L25
+.L31:
+	cmpq $80, %rax
+	je .L25
+	cmpq $114, %rax
+	je .L29
+	cmpq $184, %rax
+	je .L30
+	jmp .L25
+.L26:
+	movl $2, -12(%rbp)
+	movw $3, g0(%rip)
+	movw $4, g0(%rip)
+	movl $4, -12(%rbp)
+.L25:
+	movl $0, -8(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $16, -24(%rbp)
+	jl .L23
+.L24:
+	cmpl $5, -8(%rbp)
+	jg .LB0
+.L34:
+.L35:
+	movq -24(%rbp), %rax
+	leaq 5(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L44
+	leaq .L45(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L39
+	# table target .L43
+	# table target .L41
+	# table target .L42
+	# table target .L38
+	jmp *%rcx
+.L28:
+	jmp .L25
+.L29:
+	movl $683, g2(%rip)
+.L30:
+	cmpl $4, g2(%rip)
+	je .L32
+	cmpq $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L33
+.L32:
+	movl $0, %eax
+.L33:
+	movl %eax, -44(%rbp)
+	movl -8(%rbp), %eax
+	cmpl %eax, -4(%rbp)
+	seta %al
+	movzbl %al, %eax
+	cmpl -52(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	jmp .L25
+.L27:
+	movq -24(%rbp), %rax
+	movl %eax, -12(%rbp)
+	jmp .L25
+.L44:
+	cmpq $66, %rax
+	je .L40
+	cmpq $136, %rax
+	je .L37
+.L39:
+	movq -24(%rbp), %rax
+	subq $481, %rax
+	movl %eax, -48(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $16, -12(%rbp)
+	jge .L53
+	movl $16, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -96(%rbp)
+	cmpq $0, -96(%rbp)
+	je .L56
+	.p2align 4,,10
+.L55:
+	movq $255, -24(%rbp)
+	addl $1, -12(%rbp)
+	movq $255, -24(%rbp)
+	addl $1, -12(%rbp)
+	movq $255, -24(%rbp)
+	addl $1, -12(%rbp)
+	movq $255, -24(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -96(%rbp)
+	jne .L55
+.L56:
+.L53:
+.L54:
+	cmpl $16, -12(%rbp)
+	jge .L58
+	.p2align 4,,10
+.L57:
+	movq $255, -24(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $16, -12(%rbp)
+	jl .L57
+.L58:
+.L40:
+	cmpl $0, -12(%rbp)
+	jl .L59
+	cmpl $4, -12(%rbp)
+	jge .L59
+	movq g1(%rip), %rax
+	addq $10, %rax
+	movl -4(%rbp), %ecx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -12(%rbp), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+.L59:
+.L60:
+	movl -12(%rbp), %eax
+	subl -12(%rbp), %eax
+	je .L61
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L62
+.L61:
+	movl $0, %eax
+.L62:
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	jmp .L36
+.L37:
+	movl $0, -40(%rbp)
+	movl $2, -4(%rbp)
+	xorl %eax, %eax
+	subq -24(%rbp), %rax
+	movq %rax, -64(%rbp)
+	movl $-761, -68(%rbp)
+	cmpl $17, -4(%rbp)
+	jae .L47
+	.p2align 4,,10
+.L46:
+	movl $1, -12(%rbp)
+	movq -64(%rbp), %rax
+	movq %rax, -80(%rbp)
+	movl -68(%rbp), %eax
+	movl %eax, -84(%rbp)
+	cmpl $33, -12(%rbp)
+	jge .L49
+	.p2align 4,,10
+.L48:
+	movzwl g0(%rip), %eax
+	imull $455, %eax, %eax
+	testl %eax, %eax
+	jne .L52
+	cmpq $0, -80(%rbp)
+	je .L50
+.L52:
+.L49:
+	addl $1, -4(%rbp)
+	cmpl $17, -4(%rbp)
+	jb .L46
+.L47:
+.L36:
+	movq $0, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movslq g2(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movl -4(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movslq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movslq -12(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -104(%rbp)
+	movl $0, -12(%rbp)
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movl $4, -12(%rbp)
+	movq -104(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -104(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -104(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movq -104(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L50:
+.L51:
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	cltd
+	idivl %ecx
+	addl %eax, -8(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jl .L48
+	jmp .L49
+.L2:
+	movl -4(%rbp), %eax
+	shrl $3, %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L13
+	leaq .L14(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L10
+	# table target .L12
+	# table target .L11
+	# table target .L8
+	# table target .L7
+	# table target .L9
+	jmp *%rcx
+.L13:
+.L10:
+	addl $10, -12(%rbp)
+.L11:
+	movq $3108, -24(%rbp)
+.L12:
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpq $0, -24(%rbp)
+	jne .LB1
+.L21:
+.L22:
+	jmp .L6
+.L7:
+	cmpl $7, g2(%rip)
+	jle .L15
+	cmpw $0, g0(%rip)
+	je .L17
+	cmpq $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L18
+.L15:
+.L16:
+	cmpl $0, -4(%rbp)
+	jne .LB2
+.L19:
+.L20:
+	jmp .L6
+.L38:
+	jmp .L36
+.L41:
+	movl $5, -4(%rbp)
+.L42:
+	movl -36(%rbp), %eax
+	movsbl %al, %eax
+	addl %eax, -4(%rbp)
+	jmp .L36
+.L43:
+	movslq -8(%rbp), %rax
+	movq %rax, g1(%rip)
+	movl $195, -4(%rbp)
+	jmp .L36
+.LB0:
+	movl -8(%rbp), %eax
+	movzbl %al, %eax
+	jmp .main_return
+.LB1:
+	movl -12(%rbp), %eax
+	jmp .main_return
+.L17:
+	movl $0, %eax
+.L18:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .main_return
+.LB2:
+	movl -12(%rbp), %eax
+	imull -4(%rbp), %eax
+	jmp .main_return
+.L8:
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	jmp .main_return
+.L9:
+	movq -24(%rbp), %rax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L14:
+	.long .L12-.L14
+	.long .L10-.L14
+	.long .L11-.L14
+	.long .L8-.L14
+	.long .L7-.L14
+	.long .L10-.L14
+	.long .L9-.L14
+	.p2align 2
+.L45:
+	.long .L43-.L45
+	.long .L39-.L45
+	.long .L39-.L45
+	.long .L39-.L45
+	.long .L39-.L45
+	.long .L41-.L45
+	.long .L42-.L45
+	.long .L39-.L45
+	.long .L39-.L45
+	.long .L38-.L45
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,421 @@
+char g0;
+unsigned long g1 = 4294967295;
+int ga0[33];
+int ga1[16];
+char f0(short p0, short p1, unsigned int p2, long p3, unsigned long p4, char p5, long p6) {
+    short v0 = 512;
+    unsigned int v1 = 6;
+    long v2 = 846420505333;
+    unsigned long v3 = 2;
+    short v4 = 614;
+    unsigned long v5 = 3;
+    int i0 = 762ul;
+    long j0 = 42;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 177; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 3; }
+    j0 = (v0 <= 3);
+    p4 = -((long)((v5 == la0[1])));
+    p4 = ((g0 / (v0 * v0 + 1)) / (g0 * g0 + 1));
+    return g1;
+}
+void w0(long q0, long q1) {
+    ga1[11] = ga1[2] + q1;
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q1;
+}
+unsigned short f1(short p0, long p1, short p2, long p3, unsigned int p4, short p5) {
+    unsigned int v0 = 7;
+    unsigned char v1 = 1u;
+    int i0 = 7;
+    long j0 = 864;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 5; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 2; }
+    p2 = (unsigned long)(((p0 - p0) / (g1 * g1 + 1)));
+    p0 = (785 / (p5 * p5 + 1));
+    la0[4] = 2;
+    if ((unsigned long)(g1)) {
+        f0((ga1[13] - g0), p0, f0(p0, v0, 927L, 888000788266, p1, p2, p0), 255, f0(0, p5, g0, 798, 850, 20859939348, la1[0]), (4 != 1), (4294967295U / 100));
+        if (ga0[8]) {
+            v1 = (char)(9);
+            p1 = ((!(9) != i0) >= !((long)(p5)));
+            p4 = ((i0 && !(j0)) / (p3 * p3 + 1));
+        }
+        p5 = (((p0 && g0) / (g0 * g0 + 1)) || f0(5, g1, p1, i0, 26, p2, la1[0]));
+    }
+    if (((-(256) <= 9) || -((ga0[13] + p0)))) {
+        f0(v1, (3 > 518), -(p5), f0(0, la0[3], 8, p5, 3, 2, 10), i0, (8 <= p3), (150898395688 > 784917524442));
+    }
+    i0 = 0;
+    while (i0 < 8) {
+        if ((j0 && f0(g0, p0, 7, 4, 194362424110, p0, g0))) { return ((398197262931 * 7) || (short)(469)); }
+        i0 = i0 + 1;
+    }
+    la0[14] = (char)(p1);
+    p3 = 0;
+    while (p3 < 16) {
+        if (ga1[p3] < p5) { p5 = ga1[p3]; }
+        if (p4 >= 0 && p4 < 4) { la1[p4] = f0(ga1[11], 10, v0, 5, 128, p2, ga0[1]); }
+        if (((7 + p0) == (p5 + 2))) {
+            switch (((p0 || p0) || (2 * 243))) {
+            case 3:
+                break;
+            case 6:
+                la1[0] = ((p5 && 9) - (v0 * j0));
+                break;
+            case 10:
+                break;
+            default:
+                break;
+            case 1:
+                break;
+            case 7:
+                p5 = !(p0);
+                break;
+            case 0:
+                if (p0 >= 0 && p0 < 16) { la0[p0] = (!(114) || (5 * p1)); }
+                break;
+            }
+        } else {
+            p0 = ((65536 != p4) / (v0 * v0 + 1));
+            p1 = ((522361430774 <= 359088844519) || ((255ul == 694) == f0(p5, 163, la0[3], la1[3], 4294967295, 930079134257, v1)));
+            v1 = (unsigned int)(g1);
+        }
+        p3 = p3 + 1;
+    }
+    return g1;
+}
+unsigned long f2(unsigned short p0, long p1, unsigned int p2, unsigned short p3, unsigned short p4) {
+    char v0 = 212;
+    unsigned char v1 = 524;
+    unsigned int v2 = 6;
+    unsigned char v3 = 8;
+    int i0 = 1;
+    long j0 = 0l;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 1; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 8; }
+    v3 = v3 + -(2);
+    p2 = v3;
+    f0(7, 729954826164, !(394), p2, p4, (v2 <= 3), g0);
+    v2 = (v2 < !(la1[13]));
+    for (v2 = 0; v2 < 5; v2 = v2 + 1) {
+        p1 = p1 + (unsigned char)(f1(v0, p4, 332406691510, v2, p4, v1));
+        if (72) {
+            if (f1((unsigned int)(v2), (unsigned int)(32767), -(p3), !(538118993835), (p3 > p4), !(p2))) {
+                p1 = 8;
+                p3 = g1;
+                p2 = !(v1);
+            }
+            switch (f1(8, ga0[1], v3, j0, 5, p4)) {
+            case 9:
+                break;
+            case 400:
+                break;
+            case 929:
+                break;
+            case 40:
+                if ((unsigned int)((4 != 7l))) { break; }
+                v3 = p3;
+                break;
+            case 957:
+                break;
+            case -1:
+                if (i0 >= 0 && i0 < 16) { la1[i0] = 1; }
+                p2 = (f0(10, 7, 645, g1, v3, 4, ga1[14]) == p1);
+            case 5:
+                break;
+            }
+            if (i0 >= 0 && i0 < 33) { la0[i0] = f1(g0, la0[18], 1092548315854L, 3, la1[12], v3); }
+        }
+        if ((((p3 / (p1 * p1 + 1)) - p1) == ((ga1[14] <= la1[6]) != p0))) {
+            p1 = 0;
+            while (p1 < 100) {
+                p2 = p2 + (p0 / (i0 * i0 + 1));
+                if (f0(i0, 99, 410635852506, 951, 543, p3, 2)) { break; }
+                p1 = p1 + 1;
+            }
+        }
+    }
+    return (1 > 452767149861);
+}
+void w2(int q0) {
+    g1 = g1 * 3 + q0;
+    ga0[25] = ga0[6] + q0;
+    g0 = g0 * 3 + q0;
+}
+short f3(char p0, unsigned short p1) {
+    unsigned int v0 = 360;
+    long v1 = 165;
+    int i0 = 484;
+    long j0 = 0;
+    if (-(ga0[23])) {
+        if (1l) {
+            v0 = (g1 == ((j0 >= 729) / (j0 * j0 + 1)));
+        } else {
+            p0 = (char)((-(0) || (10L / 3)));
+            if (f0(6L, 861033374429, ga0[10], v0, p1, j0, v1)) {
+                p0 = 1L;
+            } else {
+                f1((g0 == p1), (10 < 7), 32767, v1, 999, -(3));
+            }
+        }
+        p0 = !(255);
+        f2((ga0[0] * v1), 5, (ga1[8] + v0), (556821636694 / (j0 * j0 + 1)), (676877756964 == j0));
+    }
+    v1 = (unsigned int)(((10 / (v0 * v0 + 1)) < -(i0)));
+    for (v1 = 2; v1 < 100; v1 = v1 + 1) {
+        if ((10 == g1)) {
+            for (v0 = 2; v0 < 3; v0 = v0 + 1) {
+                if (932) { break; }
+            }
+            p0 = ga0[4];
+        } else {
+            if (ga1[6]) {
+                i0 = ((0L / (g0 * g0 + 1)) / (i0 * i0 + 1));
+                if (((p1 > 5ul) == (2 * 9))) { break; }
+                if ((g0 <= j0)) { break; }
+            } else {
+                f0((v0 + p1), (10 < 949u), (g1 + 7), !(p0), i0, g1, (p1 != v0));
+                i0 = (char)(263367864117);
+            }
+            p0 = f2((p0 < ga1[3]), (ga1[7] < v0), (i0 + g1), (unsigned int)(p1), f0(ga1[3], 6, 0, p0, i0, 0, 432));
+            if (p1) {
+                if (144742322906ul) { break; }
+            }
+        }
+        if ((10 != 3)) {
+            if (((unsigned long)(f0(i0, g1, 469990077185, 678, p1, 9, g1)) / (j0 * j0 + 1))) {
+                if ((988 == (v1 < 594))) { break; }
+                i0 = i0 + 1000000007;
+                if (p0) { break; }
+            }
+        }
+    }
+    for (v0 = 0; v0 < 17; v0 = v0 + 1) {
+        if (p1) {
+            if ((-(j0) == !(699))) { return v1; }
+            if (-(((p0 + g1) >= f2(78, 851, p1, ga0[24], 32767)))) {
+                j0 = -(f2(1097674178541, 6, v1, v0, ga1[8]));
+            }
+            for (j0 = 0; j0 < 8; j0 = j0 + 1) {
+                if (((v1 >= i0) || !(p1))) { break; }
+                if (((i0 / 8) || f2(0, 5, 20306144814, 943675524983, 2))) { break; }
+            }
+        } else {
+            if ((8 / 10)) {
+                j0 = j0 + f2(868, 507649858510, p1, v0, v1);
+                j0 = 2;
+                p1 = p1 + 0;
+            } else {
+                if (j0) { break; }
+                if (39) { break; }
+            }
+            switch (0) {
+            case 11:
+                p1 = ((unsigned long)(f2(7, 9, 583, 90, g0)) - f2(p0, 9, 459, p1, 25));
+                break;
+            case 208:
+                if (779) { break; }
+                j0 = ((v1 - !(34)) != f1(ga0[30], 6, 63, g0, 6, i0));
+            case -4:
+                p1 = (((unsigned char)(j0) || i0) - (ga1[10] + v1));
+                j0 = 3;
+                break;
+            case -1:
+                v1 = v1 + (g0 / (v1 * v1 + 1));
+                break;
+            case 951:
+                p1 = (char)(f2(v0, 7, ga1[0], p1, v0));
+                break;
+            case -3:
+                j0 = ga0[19];
+                p1 = ((127 == (v0 < 689)) >= f2(4, 32, 580L, 32767, g1));
+                break;
+            case 2:
+            }
+            v1 = (unsigned int)((i0 + (p1 / 13ul)));
+        }
+    }
+    if (f0(p0, -(ga0[24]), f2(p1, 128, ga0[2], 517, p0), (long)(ga1[14]), f0(541175310891, 6, 2, p0, 252, 0, i0), (int)(v1), (9 / (v0 * v0 + 1)))) {
+        f1(948, f0(5, i0, 410, 299, 807, 2L, 614), !(2u), 3, (g1 != v1), f1(938336911123, p1, g0, 398412640910, i0, ga1[2]));
+        f2(f2(777301851667, 7U, j0, 1000000007, i0), ga0[32], f1(160120882747, ga0[2], 20, j0, 1000000007, 8), 8, (809128929066L || 4294967295));
+    }
+    if (f2((983 * ga0[28]), j0, 193, (v0 && g0), (479 + ga1[14]))) {
+        j0 = (!((int)(i0)) + f2(10, 10, 9, v1, 1));
+    } else {
+        for (v1 = 1; v1 < 16; v1 = v1 + 1) {
+            v0 = g0;
+            for (j0 = 2; j0 < 8; j0 = j0 + 1) {
+                p0 = j0;
+                i0 = 4;
+            }
+        }
+        if (((f0(v1, g0, 50, 631, 32767, i0, 0) * (v0 / 100)) / 13ul)) {
+            p1 = ((unsigned int)(p1) - f2(8, v1, v0, 2147483647, 793));
+            if (v0) { return (g0 / (p1 * p1 + 1)); }
+        }
+        p1 = p1 + (4 * (v0 * g0));
+    }
+    switch (f1(3, 32767, g1, 583, 8, v1)) {
+    case 3:
+        j0 = g1;
+        switch (((p0 / (g0 * g0 + 1)) + 1)) {
+        case 9:
+            p1 = (long)(10);
+            break;
+        default:
+            switch ((p1 * (6 - 8u))) {
+            case -5:
+                break;
+            case 718:
+                p1 = v0;
+                f0(g0, (7u - p1), -(483822586428), !(32767u), (p0 > 928U), (611 / 3), v1);
+            case 4:
+                f2((1 != 2), ga0[32], (0 >= i0), (8 != 31), (9 * j0));
+                break;
+            case 589:
+                f0((ga0[31] != p1), !(50), f1(p1, 1, 1, g0, v0, ga1[6]), ga1[15], 358, p0, (ga0[25] != p1));
+            case -2:
+                break;
+            case 506:
+                f0(v1, !(v0), f1(j0, 394, 8, v1, g1, 5), (v0 * ga0[1]), (p1 <= ga0[5]), -(p0), (g0 == v0));
+                i0 = i0 + v0;
+            case 0:
+                f1((j0 < 5), (unsigned long)(j0), -(j0), (g1 && p1), ga0[19], (char)(ga0[30]));
+                p1 = 685;
+                break;
+            }
+            break;
+        case 0:
+            break;
+        }
+        break;
+    case 5:
+        v0 = 0;
+        while (v0 < 16) {
+            p1 = j0;
+            v0 = v0 + 1;
+        }
+        f1(f2(749, 487, v0, 4, v1), (ga1[13] / 5l), (i0 || 8), (275 <= p0), (10 / 3u), f2(v0, p1, j0, ga0[4], 1));
+        break;
+    case 1:
+        v0 = (0 || f2(ga1[10], p0, 727, 776, ga0[26]));
+        switch (((char)(3) || f1(j0, i0, 6l, p1, 5, g0))) {
+        case -4:
+            f1(-(p1), (65536 - 913u), f2(7, 65535, 524, 1000000007, ga1[2]), 6, g1, (p0 / 100));
+            v1 = (32767 <= 1);
+        case 5:
+            i0 = (long)((p1 <= 4));
+            i0 = (((j0 - 2ul) != !(p0)) >= (-(ga1[12]) >= 555));
+        case 833:
+            break;
+        case 309:
+            break;
+        case 548:
+            if (f2(g0, (v0 <= v1), (g1 == g1), (174615812732 + 241173150334), j0)) {
+                f2((unsigned int)(v0), (v0 / (p0 * p0 + 1)), (ga1[10] - v1), !(j0), (10 / 4));
+                j0 = p1;
+                f0(!(111), g0, g1, (ga0[14] >= p1), -(v0), 193748684343, p0);
+            }
+        }
+        break;
+    case 10:
+        v0 = 0;
+        while (v0 < 16) {
+            switch (f1(3, g1, 38928511795, ga1[1], 65536, 125)) {
+            case 4:
+            case 10:
+                break;
+            case 8:
+                if (!(p1)) { break; }
+                if ((p0 / 8)) { break; }
+            default:
+                if (0) { break; }
+            case 1:
+                break;
+            case 6:
+            case 0:
+                p1 = i0;
+                if ((!(j0) - (50 / 8))) { break; }
+            case 5:
+                v1 = v1 + ((0 && 6) && (p1 / 13ul));
+            }
+            if (!((unsigned char)((p1 == 4)))) {
+                if (f1(1, g1, v0, 10L, g1, g1)) { break; }
+            } else {
+                p0 = p0 + (unsigned short)(960);
+            }
+            v0 = v0 + 1;
+        }
+        for (v0 = 0; v0 < 33; v0 = v0 + 1) {
+            p1 = (!(551) + !((23000744763 / (p1 * p1 + 1))));
+        }
+        break;
+    default:
+    }
+    return (-(!(j0)) - i0);
+}
+void w3(unsigned char q0) {
+    g0 = g0 * 3 + q0;
+    g1 = g1 * 3 + q0;
+    g1 = g1 * 3 + q0;
+}
+long rec(long n, long acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 4, acc);
+}
+int main() {
+    int v0 = 872;
+    unsigned char v1 = 971;
+    unsigned long v2 = 908;
+    int i0 = 8;
+    long j0 = 283;
+    v0 = 438;
+    v0 = ((long)(2) * (0 + f1(v1, g0, v0, 8ul, v2, v2)));
+    switch ((int)(!(v2))) {
+    case 6:
+    default:
+        g1 = g1 + (unsigned int)((short)(v1));
+        v0 = i0;
+    case 0:
+        break;
+    case 1:
+        i0 = 4;
+        break;
+    case 5:
+        switch ((!(6) - !(i0))) {
+        case 4:
+            if ((unsigned char)(-(v1))) { return (char)((unsigned long)(v2)); }
+            j0 = j0 + (!(ga0[1]) != g0);
+        case 10:
+            g1 = (-(j0) - 345L);
+            break;
+        }
+        break;
+    case 8:
+    }
+    ga0[30] = (v2 < 4);
+    i0 = 0;
+    while (i0 < 8) {
+        g1 = g1 + 169;
+        i0 = i0 + 1;
+    }
+    v2 = f2(ga1[11], 1, g0, (7 * i0), i0);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1955 @@
+	.section .data
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.quad 4294967295
+	.section .bss
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.zero 1
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.type ga1, @object
+	.size ga1, 64
+	.p2align 5
+ga1:
+	.zero 64
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.type f0.constprop.3, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.type f2, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movl %edx, -8(%rbp)
+	movq %rcx, -16(%rbp)
+	movq %r8, -24(%rbp)
+	movb %r9b, -25(%rbp)
+	movw $512, -28(%rbp)
+	movl $6, -32(%rbp)
+	movabsq $846420505333, %rax
+	movq %rax, -40(%rbp)
+	movq $2, -48(%rbp)
+	movw $614, -50(%rbp)
+	movq $3, -64(%rbp)
+	movl $762, -68(%rbp)
+	movq $42, -80(%rbp)
+	movl $0, -68(%rbp)
+	movl $0, -96(%rbp)
+	movl $177, -92(%rbp)
+	movl $354, -88(%rbp)
+	movl $531, -84(%rbp)
+	movl $4, -68(%rbp)
+	movl $0, -68(%rbp)
+	cmpl $33, -68(%rbp)
+	jge .L0
+	movl $33, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -248(%rbp)
+	cmpq $0, -248(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -248(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -68(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $33, -68(%rbp)
+	jl .L4
+.L5:
+	movswl -28(%rbp), %eax
+	movl %eax, -252(%rbp)
+	cmpl $3, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl -92(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -24(%rbp)
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	pushq %rax
+	movl -252(%rbp), %eax
+	imull -252(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movq g1(%rip), %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movq %rdx, -16(%rbp)
+	movb %cl, -17(%rbp)
+	movq %r8, -32(%rbp)
+	movw $512, -34(%rbp)
+	movl $6, -40(%rbp)
+	movabsq $846420505333, %rax
+	movq %rax, -48(%rbp)
+	movq $2, -56(%rbp)
+	movw $614, -58(%rbp)
+	movq $3, -72(%rbp)
+	movl $762, -76(%rbp)
+	movq $42, -88(%rbp)
+	movl $0, -76(%rbp)
+	movl $0, -112(%rbp)
+	movl $177, -108(%rbp)
+	movl $354, -104(%rbp)
+	movl $531, -100(%rbp)
+	movl $4, -76(%rbp)
+	movl $0, -76(%rbp)
+	cmpl $33, -76(%rbp)
+	jge .L6
+	movl $33, %eax
+	movslq -76(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L7
+	.p2align 4,,10
+.L8:
+	movslq -76(%rbp), %rax
+	imull $3, -76(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	movslq -76(%rbp), %rax
+	imull $3, -76(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	movslq -76(%rbp), %rax
+	imull $3, -76(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	movslq -76(%rbp), %rax
+	imull $3, -76(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	subq $1, -264(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $33, -76(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movslq -76(%rbp), %rax
+	imull $3, -76(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	cmpl $33, -76(%rbp)
+	jl .L10
+.L11:
+	movswl -34(%rbp), %eax
+	movl %eax, -268(%rbp)
+	cmpl $3, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -88(%rbp)
+	movl -108(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -72(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	pushq %rax
+	movl -268(%rbp), %eax
+	imull -268(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq g1(%rip), %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movw %di, -2(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movq %rcx, -24(%rbp)
+	movw $512, -26(%rbp)
+	movl $6, -32(%rbp)
+	movabsq $846420505333, %rax
+	movq %rax, -40(%rbp)
+	movq $2, -48(%rbp)
+	movw $614, -50(%rbp)
+	movq $3, -64(%rbp)
+	movl $762, -68(%rbp)
+	movq $42, -80(%rbp)
+	movl $0, -68(%rbp)
+	movl $0, -96(%rbp)
+	movl $177, -92(%rbp)
+	movl $354, -88(%rbp)
+	movl $531, -84(%rbp)
+	movl $4, -68(%rbp)
+	movl $0, -68(%rbp)
+	cmpl $33, -68(%rbp)
+	jge .L12
+	movl $33, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -248(%rbp)
+	cmpq $0, -248(%rbp)
+	je .L13
+	.p2align 4,,10
+.L14:
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -248(%rbp)
+	jne .L14
+.L15:
+.L12:
+.L13:
+	cmpl $33, -68(%rbp)
+	jge .L17
+	.p2align 4,,10
+.L16:
+	movslq -68(%rbp), %rax
+	imull $3, -68(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $33, -68(%rbp)
+	jl .L16
+.L17:
+	movswl -26(%rbp), %eax
+	movl %eax, -252(%rbp)
+	cmpl $3, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl -92(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	pushq %rax
+	movl -252(%rbp), %eax
+	imull -252(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq g1(%rip), %rax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movl %edx, -8(%rbp)
+	movq %rcx, -16(%rbp)
+	movw $512, -18(%rbp)
+	movl $6, -24(%rbp)
+	movabsq $846420505333, %rax
+	movq %rax, -32(%rbp)
+	movq $2, -40(%rbp)
+	movw $614, -42(%rbp)
+	movq $3, -56(%rbp)
+	movl $762, -60(%rbp)
+	movq $42, -72(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -96(%rbp)
+	movl $177, -92(%rbp)
+	movl $354, -88(%rbp)
+	movl $531, -84(%rbp)
+	movl $4, -60(%rbp)
+	movl $0, -60(%rbp)
+	cmpl $33, -60(%rbp)
+	jge .L18
+	movl $33, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -248(%rbp)
+	cmpq $0, -248(%rbp)
+	je .L19
+	.p2align 4,,10
+.L20:
+	movslq -60(%rbp), %rax
+	imull $3, -60(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	movslq -60(%rbp), %rax
+	imull $3, -60(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	movslq -60(%rbp), %rax
+	imull $3, -60(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	movslq -60(%rbp), %rax
+	imull $3, -60(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	subq $1, -248(%rbp)
+	jne .L20
+.L21:
+.L18:
+.L19:
+	cmpl $33, -60(%rbp)
+	jge .L23
+	.p2align 4,,10
+.L22:
+	movslq -60(%rbp), %rax
+	imull $3, -60(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	cmpl $33, -60(%rbp)
+	jl .L22
+.L23:
+	movswl -18(%rbp), %eax
+	movl %eax, -252(%rbp)
+	cmpl $3, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movl -92(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	pushq %rax
+	movl -252(%rbp), %eax
+	imull -252(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq g1(%rip), %rax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f0.constprop.3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movw %di, -2(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movq %rcx, -24(%rbp)
+	movb %r8b, -25(%rbp)
+	movq %r9, -40(%rbp)
+	movw $512, -42(%rbp)
+	movl $6, -48(%rbp)
+	movabsq $846420505333, %rax
+	movq %rax, -56(%rbp)
+	movq $2, -64(%rbp)
+	movw $614, -66(%rbp)
+	movq $3, -80(%rbp)
+	movl $762, -84(%rbp)
+	movq $42, -96(%rbp)
+	movl $0, -84(%rbp)
+	movl $0, -112(%rbp)
+	movl $177, -108(%rbp)
+	movl $354, -104(%rbp)
+	movl $531, -100(%rbp)
+	movl $4, -84(%rbp)
+	movl $0, -84(%rbp)
+	cmpl $33, -84(%rbp)
+	jge .L24
+	movl $33, %eax
+	movslq -84(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L25
+	.p2align 4,,10
+.L26:
+	movslq -84(%rbp), %rax
+	imull $3, -84(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -84(%rbp)
+	movslq -84(%rbp), %rax
+	imull $3, -84(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -84(%rbp)
+	movslq -84(%rbp), %rax
+	imull $3, -84(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -84(%rbp)
+	movslq -84(%rbp), %rax
+	imull $3, -84(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -84(%rbp)
+	subq $1, -264(%rbp)
+	jne .L26
+.L27:
+.L24:
+.L25:
+	cmpl $33, -84(%rbp)
+	jge .L29
+	.p2align 4,,10
+.L28:
+	movslq -84(%rbp), %rax
+	imull $3, -84(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -84(%rbp)
+	cmpl $33, -84(%rbp)
+	jl .L28
+.L29:
+	movswl -42(%rbp), %eax
+	movl %eax, -268(%rbp)
+	cmpl $3, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -96(%rbp)
+	movl -108(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -80(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -24(%rbp)
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	pushq %rax
+	movl -268(%rbp), %eax
+	imull -268(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movq g1(%rip), %rax
+.f0.constprop.3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.3, .-f0.constprop.3
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movw %di, -2(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movq %rcx, -32(%rbp)
+	movl %r8d, -36(%rbp)
+	movw %r9w, -38(%rbp)
+	movl $7, -44(%rbp)
+	movb $1, -45(%rbp)
+	movl $7, -52(%rbp)
+	movq $864, -64(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L30
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L33
+	.p2align 4,,10
+.L32:
+	movslq -52(%rbp), %rax
+	imull $5, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $5, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $5, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $5, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -136(%rbp)
+	jne .L32
+.L33:
+.L30:
+.L31:
+	cmpl $16, -52(%rbp)
+	jge .L35
+	.p2align 4,,10
+.L34:
+	movslq -52(%rbp), %rax
+	imull $5, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L34
+.L35:
+	movl $0, -52(%rbp)
+	movl $0, -160(%rbp)
+	movl $2, -156(%rbp)
+	movl $4, -152(%rbp)
+	movl $6, -148(%rbp)
+	movl $4, -52(%rbp)
+	movq g1(%rip), %rax
+	imulq g1(%rip), %rax
+	addq $1, %rax
+	pushq %rax
+	movswl -2(%rbp), %eax
+	movl %eax, -164(%rbp)
+	movq %rax, %rcx
+	movl -164(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	movw %ax, -18(%rbp)
+	movswl -38(%rbp), %eax
+	movl %eax, -168(%rbp)
+	imull -168(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $785, %eax
+	cltd
+	idivl %ecx
+	movw %ax, -2(%rbp)
+	movl $2, -112(%rbp)
+	cmpq $0, g1(%rip)
+	je .L36
+	movl -160(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $850, %eax
+	movq %rax, %rdx
+	movsbl g0(%rip), %eax
+	movq %rax, %rsi
+	movswl -38(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movsbq %al, %rax
+	pushq %rax
+	subq $8, %rsp
+	movswq -2(%rbp), %rax
+	movq %rax, %r8
+	movswl -18(%rbp), %eax
+	movb %al, -169(%rbp)
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movq %rax, %rdx
+	movl -44(%rbp), %eax
+	movq %rax, %rsi
+	movswl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $8, %rsp
+	movsbl %al, %eax
+	movq %rax, %rdx
+	movswl -2(%rbp), %eax
+	movq %rax, %rsi
+	movl ga1+52(%rip), %eax
+	movsbl g0(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rdi
+	popq %rcx
+	call f0.constprop.2
+	movl ga0+32(%rip), %eax
+	testl %eax, %eax
+	je .L38
+	movb $9, -45(%rbp)
+	movswq -38(%rbp), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $0, -52(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	cmpl $0, -52(%rbp)
+	je .L40
+	cmpq $0, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L41
+.L40:
+	movl $0, %eax
+.L41:
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movl %eax, -36(%rbp)
+.L38:
+.L39:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	pushq %rax
+	cmpw $0, -2(%rbp)
+	je .L44
+	cmpb $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L45
+.L44:
+	movl $0, %eax
+.L45:
+	popq %rcx
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .L42
+	movl -160(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	movsbl -169(%rbp), %eax
+	movq %rax, %r8
+	movl $26, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq g1(%rip), %rax
+	movq %rax, %rdi
+	call f0.constprop.3
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L43
+.L42:
+	movl $1, %eax
+.L43:
+	movw %ax, -38(%rbp)
+.L36:
+.L37:
+	subq $8, %rsp
+	xorl %eax, %eax
+	pushq %rax
+	cmpq $8, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	movslq -52(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $10, %eax
+	pushq %rax
+	movl $2, %eax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movswq -38(%rbp), %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movl -116(%rbp), %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbq %al, %rax
+	pushq %rax
+	xorl %eax, %eax
+	movswl -38(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movzbl -45(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl $0, -52(%rbp)
+	movl $1, -176(%rbp)
+	cmpl $8, -52(%rbp)
+	jge .L46
+	movl $8, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L49
+	.p2align 4,,10
+.L48:
+	cmpq $0, -64(%rbp)
+	je .L50
+	subq $8, %rsp
+	movsbq g0(%rip), %rax
+	pushq %rax
+	movswl -2(%rbp), %eax
+	movq %rax, %r9
+	movabsq $194362424110, %rax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movswl -2(%rbp), %eax
+	movq %rax, %rsi
+	movsbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	jne .LB0
+.L50:
+.L51:
+	addl $1, -52(%rbp)
+	cmpq $0, -64(%rbp)
+	je .L52
+	subq $8, %rsp
+	movsbq g0(%rip), %rax
+	pushq %rax
+	movswl -2(%rbp), %eax
+	movq %rax, %r9
+	movabsq $194362424110, %rax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movswl -2(%rbp), %eax
+	movq %rax, %rsi
+	movsbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	jne .LB1
+.L52:
+.L53:
+	addl $1, -52(%rbp)
+	subq $1, -184(%rbp)
+	jne .L48
+.L49:
+.L46:
+.L47:
+	cmpl $8, -52(%rbp)
+	jge .L55
+	.p2align 4,,10
+.L54:
+	cmpq $0, -64(%rbp)
+	je .L56
+	subq $8, %rsp
+	movsbq g0(%rip), %rax
+	pushq %rax
+	movswl -2(%rbp), %eax
+	movq %rax, %r9
+	movabsq $194362424110, %rax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movswl -2(%rbp), %eax
+	movq %rax, %rsi
+	movsbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	jne .LB2
+.L56:
+.L57:
+	addl $1, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jl .L54
+.L55:
+	movq -16(%rbp), %rax
+	movsbl %al, %eax
+	movl %eax, -72(%rbp)
+	movq $0, -32(%rbp)
+	cmpl $0, -36(%rbp)
+	jb .L58
+	cmpl $4, -36(%rbp)
+	setb %al
+	movzbl %al, %eax
+	jmp .L59
+.LB2:
+	movl -176(%rbp), %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L58:
+	movl $0, %eax
+.L59:
+	movl %eax, -188(%rbp)
+	movl $486, -192(%rbp)
+	movl -44(%rbp), %eax
+	imulq -64(%rbp), %rax
+	movq %rax, -200(%rbp)
+	cmpl $65536, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -204(%rbp)
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -208(%rbp)
+	movl $0, -212(%rbp)
+	movl $0, -216(%rbp)
+	cmpq $16, -32(%rbp)
+	jge .L61
+	.p2align 4,,10
+.L60:
+	movq -32(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movswl -38(%rbp), %ecx
+	cmpl %ecx, %eax
+	jge .L62
+	movq -32(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movw %ax, -38(%rbp)
+.L62:
+.L63:
+	cmpl $0, -188(%rbp)
+	je .L64
+	subq $8, %rsp
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movswl -18(%rbp), %eax
+	movq %rax, %r9
+	movl $128, %eax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl ga1+44(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	movl %ecx, -160(%rbp,%rax,4)
+.L64:
+.L65:
+	movswl -38(%rbp), %eax
+	addl $2, %eax
+	movq %rax, %rcx
+	movswl -2(%rbp), %eax
+	movl %eax, -220(%rbp)
+	addl $7, %eax
+	cmpl %ecx, %eax
+	jne .L66
+	cmpw $0, -2(%rbp)
+	jne .L76
+	cmpw $0, -2(%rbp)
+	jne .L76
+	cmpl $0, -192(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L77
+.L76:
+	movl $1, %eax
+.L77:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L67
+	leaq .L79(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L72
+	# table target .L75
+	# table target .L73
+	# table target .L69
+	# table target .L70
+	# table target .L74
+	# table target .L71
+	jmp *%rcx
+.L66:
+	movl -204(%rbp), %eax
+	xorl %edx, %edx
+	divl -208(%rbp)
+	movw %ax, -2(%rbp)
+	cmpl $0, -212(%rbp)
+	jne .L84
+	subq $8, %rsp
+	movzbl -45(%rbp), %eax
+	pushq %rax
+	movl $49, %eax
+	movq %rax, %r9
+	movl $4294967295, %eax
+	movq %rax, %r8
+	movl -148(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl -116(%rbp), %eax
+	movq %rax, %rdx
+	movl $163, %eax
+	movq %rax, %rsi
+	movswl -38(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	cmpl %eax, -216(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L85
+.L78:
+.L72:
+.L68:
+	jmp .L67
+.L69:
+	jmp .L67
+.L70:
+	cmpw $0, -38(%rbp)
+	je .L80
+	movl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L81
+.L80:
+	movl $0, %eax
+.L81:
+	movslq %eax, %rax
+	subq -200(%rbp), %rax
+	movl %eax, -160(%rbp)
+	jmp .L67
+.L71:
+	jmp .L67
+.L73:
+	jmp .L67
+.L74:
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -38(%rbp)
+	jmp .L67
+.L75:
+	cmpl $0, -220(%rbp)
+	jl .L67
+	cmpl $16, -220(%rbp)
+	jge .L67
+	imulq $5, -16(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -2(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+.L82:
+.L83:
+	jmp .L67
+.L84:
+	movl $1, %eax
+.L85:
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq g1(%rip), %rax
+	movb %al, -45(%rbp)
+.L67:
+	addq $1, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jl .L60
+.L61:
+	movq g1(%rip), %rax
+	jmp .f1_return
+.LB0:
+	movl -176(%rbp), %eax
+	jmp .f1_return
+.LB1:
+	movl -176(%rbp), %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L79:
+	.long .L75-.L79
+	.long .L73-.L79
+	.long .L72-.L79
+	.long .L69-.L79
+	.long .L72-.L79
+	.long .L72-.L79
+	.long .L70-.L79
+	.long .L74-.L79
+	.long .L72-.L79
+	.long .L72-.L79
+	.long .L71-.L79
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb $203, -41(%rbp)
+	movq $908, -32(%rbp)
+	movl $8, -36(%rbp)
+	movq $283, -24(%rbp)
+	movl $438, -40(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	movq %rax, %rdx
+	movsbq g0(%rip), %rax
+	movq %rax, %rsi
+	movzbl -41(%rbp), %eax
+	movw %ax, -8(%rbp)
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	imulq $2, %rax, %rax
+	movl %eax, -40(%rbp)
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $8, %rcx
+	ja .L92
+	leaq .L93(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L87
+	# table target .L88
+	# table target .L89
+	# table target .L90
+	# table target .L87
+	# table target .L91
+	jmp *%rcx
+.L92:
+.L87:
+	movswl -8(%rbp), %eax
+	addq %rax, g1(%rip)
+	movl -36(%rbp), %eax
+	movl %eax, -40(%rbp)
+.L88:
+.L91:
+.L86:
+	cmpq $4, -32(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movl %eax, ga0+120(%rip)
+	addq $169, g1(%rip)
+	addq $169, g1(%rip)
+	addq $169, g1(%rip)
+	addq $169, g1(%rip)
+	addq $169, g1(%rip)
+	addq $169, g1(%rip)
+	addq $169, g1(%rip)
+	addq $169, g1(%rip)
+	movl $8, -36(%rbp)
+	movl -36(%rbp), %eax
+	movq %rax, %r8
+	imull $7, -36(%rbp), %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl ga1+44(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	movq %rax, -32(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -40(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzbl -41(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L99
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L102
+	.p2align 4,,10
+.L101:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -8(%rbp)
+	jne .L101
+.L102:
+.L99:
+.L100:
+	cmpl $33, -36(%rbp)
+	jge .L104
+	.p2align 4,,10
+.L103:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L103
+.L104:
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L105
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L108
+	.p2align 4,,10
+.L107:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -8(%rbp)
+	jne .L107
+.L108:
+.L105:
+.L106:
+	cmpl $16, -36(%rbp)
+	jge .L110
+	.p2align 4,,10
+.L109:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L109
+.L110:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L89:
+	jmp .L86
+.L90:
+	cmpl $0, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $4, %rax
+	je .L95
+	cmpq $10, %rax
+	je .L96
+	jmp .L86
+.L95:
+	xorl %eax, %eax
+	movzbl -41(%rbp), %ecx
+	subl %ecx, %eax
+	testb %al, %al
+	jne .LB3
+.L97:
+.L98:
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movsbl g0(%rip), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+.L96:
+	xorl %eax, %eax
+	subq -24(%rbp), %rax
+	subq $345, %rax
+	movq %rax, g1(%rip)
+.L94:
+	jmp .L86
+.LB3:
+	movq -32(%rbp), %rax
+	movsbl %al, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L93:
+	.long .L88-.L93
+	.long .L89-.L93
+	.long .L87-.L93
+	.long .L87-.L93
+	.long .L87-.L93
+	.long .L90-.L93
+	.long .L87-.L93
+	.long .L87-.L93
+	.long .L91-.L93
+	.popsection
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movw %di, -2(%rbp)
+	movq %rsi, -16(%rbp)
+	movl %edx, -20(%rbp)
+	movw %cx, -22(%rbp)
+	movw %r8w, -24(%rbp)
+	movb $-44, -25(%rbp)
+	movb $12, -26(%rbp)
+	movl $6, -32(%rbp)
+	movb $8, -33(%rbp)
+	movl $1, -40(%rbp)
+	movq $0, -48(%rbp)
+	movl $0, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jge .L111
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L114
+	.p2align 4,,10
+.L113:
+	movl -40(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -200(%rbp)
+	jne .L113
+.L114:
+.L111:
+.L112:
+	cmpl $33, -40(%rbp)
+	jge .L116
+	.p2align 4,,10
+.L115:
+	movl -40(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L115
+.L116:
+	movl $0, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jge .L117
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L120
+	.p2align 4,,10
+.L119:
+	movl -40(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -280(%rbp)
+	jne .L119
+.L120:
+.L117:
+.L118:
+	cmpl $16, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -284(%rbp)
+	testl %eax, %eax
+	je .L122
+	.p2align 4,,10
+.L121:
+	movl -40(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -284(%rbp)
+	testl %eax, %eax
+	jne .L121
+.L122:
+	xorl %eax, %eax
+	subl $2, %eax
+	movq %rax, %rcx
+	movzbl -33(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -33(%rbp)
+	movzbl -33(%rbp), %eax
+	movl %eax, -20(%rbp)
+	subq $8, %rsp
+	movsbq g0(%rip), %rax
+	pushq %rax
+	cmpl $3, -32(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movzwl -24(%rbp), %eax
+	movq %rax, %r8
+	movl -20(%rbp), %eax
+	movq %rax, %rcx
+	movl $394, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $-18508, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl -220(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -32(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -32(%rbp)
+	movl $0, -32(%rbp)
+	movl $4, %eax
+	cmpq $7, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -288(%rbp)
+	cmpl $0, -40(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -296(%rbp)
+	testl %eax, %eax
+	je .L123
+	cmpl $0, -284(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L124
+.L123:
+	movl $0, %eax
+.L124:
+	movl %eax, -292(%rbp)
+	cmpl $0, -296(%rbp)
+	je .L125
+	cmpl $33, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L126
+.L125:
+	movl $0, %eax
+.L126:
+	movl %eax, -300(%rbp)
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -304(%rbp)
+	cmpl $5, -32(%rbp)
+	jae .L128
+	.p2align 4,,10
+.L127:
+	movzbl -26(%rbp), %eax
+	movq %rax, %r9
+	movzwl -24(%rbp), %eax
+	movq %rax, %r8
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movl $-26954, %eax
+	movq %rax, %rdx
+	movzwl -24(%rbp), %eax
+	movq %rax, %rsi
+	movsbl -25(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	addq %rax, -16(%rbp)
+	movl $72, %eax
+	testl %eax, %eax
+	je .L129
+	cmpl $0, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movzwl -22(%rbp), %eax
+	movl %eax, -308(%rbp)
+	movzwl -24(%rbp), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movabsq $538118993835, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl -308(%rbp), %eax
+	movq %rax, %rdx
+	movl $32767, %eax
+	movq %rax, %rsi
+	movl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	je .L131
+	movq $8, -16(%rbp)
+	movq g1(%rip), %rax
+	movw %ax, -22(%rbp)
+	cmpb $0, -26(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+.L131:
+.L132:
+	movzwl -24(%rbp), %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movzbl -33(%rbp), %eax
+	movq %rax, %rdx
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $40, %rax
+	jge .L141
+	cmpq $-1, %rax
+	je .L139
+	cmpq $5, %rax
+	je .L140
+	cmpq $9, %rax
+	je .L133
+	jmp .L133
+.L139:
+	cmpl $0, -292(%rbp)
+	je .L145
+	movslq -40(%rbp), %rax
+	movl $1, -272(%rbp,%rax,4)
+.L145:
+.L146:
+	subq $8, %rsp
+	movl ga1+56(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $4, %eax
+	movq %rax, %r9
+	movzbl -33(%rbp), %eax
+	movq %rax, %r8
+	movq g1(%rip), %rax
+	movq %rax, %rcx
+	movl $645, %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbq %al, %rax
+	cmpq -16(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+.L140:
+.L133:
+	cmpl $0, -300(%rbp)
+	je .L147
+	movzbl -33(%rbp), %eax
+	movq %rax, %r9
+	movl -224(%rbp), %eax
+	movq %rax, %r8
+	movl $3, %eax
+	movq %rax, %rcx
+	movl $19150, %eax
+	movq %rax, %rdx
+	movl -120(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movsbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L147:
+.L148:
+.L129:
+.L130:
+	movzwl -2(%rbp), %eax
+	movl %eax, -312(%rbp)
+	pushq %rax
+	movl ga1+56(%rip), %eax
+	movl -248(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl -22(%rbp), %eax
+	cqo
+	idivq %rcx
+	subq -16(%rbp), %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	jne .L149
+	movq $0, -16(%rbp)
+	movl -304(%rbp), %eax
+	movl %eax, -316(%rbp)
+	cmpq $100, -16(%rbp)
+	jge .L152
+	.p2align 4,,10
+.L151:
+	movl -312(%rbp), %eax
+	cltd
+	idivl -316(%rbp)
+	addl %eax, -20(%rbp)
+	subq $8, %rsp
+	movl $2, %eax
+	pushq %rax
+	movzwl -22(%rbp), %eax
+	movq %rax, %r9
+	movl $543, %eax
+	movq %rax, %r8
+	movl $951, %eax
+	movq %rax, %rcx
+	movl $2613959386, %eax
+	movq %rax, %rdx
+	movl $99, %eax
+	movq %rax, %rsi
+	movl -40(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	je .L153
+.L152:
+.L149:
+.L150:
+	addl $1, -32(%rbp)
+	cmpl $5, -32(%rbp)
+	jb .L127
+.L128:
+	movabsq $452767149861, %rax
+	cmpq $1, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L153:
+.L154:
+	addq $1, -16(%rbp)
+	cmpq $100, -16(%rbp)
+	jl .L151
+	jmp .L152
+.L141:
+	cmpq $929, %rax
+	jge .L142
+	cmpq $40, %rax
+	je .L137
+	cmpq $400, %rax
+	je .L133
+	jmp .L133
+.L142:
+	cmpq $929, %rax
+	je .L133
+	cmpq $957, %rax
+	je .L133
+	jmp .L133
+.L136:
+	jmp .L133
+.L137:
+	movl -288(%rbp), %eax
+	testl %eax, %eax
+	je .L143
+	jmp .L133
+.L134:
+	jmp .L133
+.L135:
+	jmp .L133
+.L143:
+.L144:
+	movzwl -22(%rbp), %eax
+	movb %al, -33(%rbp)
+	jmp .L133
+.L138:
+	jmp .L133
+	.size f2, .-f2
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,198 @@
+int f0() {
+    unsigned long v0 = 5;
+    unsigned long v1 = 266158438300;
+    unsigned int v2 = 10;
+    unsigned long v3 = 363821260545L;
+    int v4 = 2;
+    int i0 = 10;
+    long j0 = 462;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 550; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 248; }
+    v4 = v4 + (65535 == v2);
+    if (-(226259168929U)) { return ((v0 / 3) == (la0[6] && 233)); }
+    v1 = v4;
+    if (la0[1]) {
+        j0 = !(((v4 * v4) || la1[0]));
+        if (v0 >= 0 && v0 < 8) { la0[v0] = ((v0 || 1) < v2); }
+    } else {
+        j0 = (73364628060 > v3);
+    }
+    v3 = (!((v1 + i0)) - la1[0]);
+    v4 = la1[1];
+    if (v0) { return ((v2 + 3) != 8); }
+    return (int)((long)((v3 > v3)));
+}
+unsigned long f1(short p0, unsigned short p1, unsigned int p2, unsigned char p3, unsigned char p4, unsigned int p5, long p6) {
+    long v0 = 930;
+    long v1 = 8l;
+    char v2 = 6;
+    short v3 = 277;
+    int i0 = 145L;
+    long j0 = 360342543049;
+    v3 = v3 + (8 / (p2 * p2 + 1));
+    if ((-(6) + (unsigned long)(320509946858))) {
+        switch ((p5 - p1)) {
+        case 7:
+            if (2) {
+                f0();
+                f0();
+                f0();
+            }
+            break;
+        case 5:
+            p1 = 5;
+            if ((((163 <= 829956495050) || (618977878883 - 90)) * (unsigned long)((789 * p1)))) {
+                p0 = (unsigned char)(1);
+                i0 = ((8 >= v3) < p5);
+                v2 = v2 + ((128U * p2) / 8);
+            }
+            break;
+        case 1:
+            if ((9 - (p3 / (v1 * v1 + 1)))) {
+                f0();
+            } else {
+                f0();
+                f0();
+                v3 = f0();
+            }
+            break;
+        default:
+            f0();
+            break;
+        case 10:
+            switch (!(f0())) {
+            case 4:
+                break;
+            case 2:
+                f0();
+                break;
+            case 34:
+                break;
+            case -2:
+                break;
+            case 59:
+                break;
+            case 156:
+                i0 = (8 || !(0));
+                break;
+            default:
+                f0();
+                if ((p0 && f0())) { return (j0 != 2); }
+            case 244:
+                f0();
+                f0();
+                break;
+            case -1:
+                p6 = 206875320251;
+                f0();
+            }
+            f0();
+            break;
+        case 4:
+            if ((((111 || 128U) + 405554452359ul) || (v2 || 0))) {
+                f0();
+            } else {
+                f0();
+            }
+            break;
+        }
+        p1 = p1 + p1;
+    }
+    p5 = (p1 == -(p5));
+    return ((p2 / (v2 * v2 + 1)) < ((v1 - 0) / (v1 * v1 + 1)));
+}
+int main() {
+    unsigned char v0 = 4;
+    long v1 = 9;
+    int i0 = 1;
+    long j0 = 363;
+    for (j0 = 0; j0 < 3; j0 = j0 + 1) {
+        i0 = -((v1 != 928735984445U));
+        v1 = 0;
+        while (v1 < 17) {
+            f1(2, (10 / (v0 * v0 + 1)), (i0 - j0), (j0 - 928u), (10U - 684), v1, !(i0));
+            v0 = 552u;
+            v1 = v1 + 1;
+        }
+    }
+    v0 = 4;
+    switch (i0) {
+    case 10:
+        break;
+    case 4:
+        break;
+    default:
+        if ((unsigned short)(1)) {
+            j0 = (int)((-(2) > -(10)));
+            f0();
+        }
+        break;
+    case 3:
+    }
+    switch (((674 <= j0) + (j0 == 2))) {
+    case 1:
+    case 10:
+        for (j0 = 0; j0 < 100; j0 = j0 + 1) {
+            v0 = f0();
+            if ((f0() < (1 >= 803180046908))) { break; }
+            v0 = 357;
+        }
+        break;
+    default:
+    }
+    if (!((unsigned char)(f0()))) {
+        i0 = j0;
+        for (i0 = 1; i0 < 16; i0 = i0 + 1) {
+            f0();
+            v0 = ((i0 - 603504772861) + (long)(v0));
+            if ((f0() / (i0 * i0 + 1))) {
+                if (((char)(v1) || !(2))) { break; }
+            } else {
+                if (((i0 + 9) || 6)) { break; }
+            }
+        }
+        if ((v0 * j0)) {
+            if (f0()) {
+                f1(3U, (short)(136), !(v0), (0 == 372), (long)(j0), i0, -(i0));
+            } else {
+                f1((v1 + v0), (j0 - 8), (4 + 7), 5, 5, 304U, 2);
+            }
+        } else {
+            switch (1) {
+            case 26:
+                f0();
+                break;
+            case 365:
+                j0 = (6 > j0);
+            case -4:
+                j0 = i0;
+                break;
+            case -3:
+                v1 = j0;
+                i0 = (-((0 - i0)) < ((75 / 7) <= (10 || 9)));
+                break;
+            case 386:
+            }
+        }
+    } else {
+        for (j0 = 0; j0 < 8; j0 = j0 + 1) {
+            switch (v1) {
+            case 0:
+            default:
+                v0 = -(!((8 / 8)));
+            }
+        }
+        i0 = v1;
+        f0();
+    }
+    v1 = v1;
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
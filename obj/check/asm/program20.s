@@ -0,0 +1,1130 @@
+	.section .text
+	.type f1.constprop.0, @function
+	.type f0, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.align 16
+f1.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movw %di, -30(%rbp)
+	movw %si, -28(%rbp)
+	movl %edx, -24(%rbp)
+	movb %cl, -32(%rbp)
+	movl %r8d, -20(%rbp)
+	movq $8, -16(%rbp)
+	movb $6, -31(%rbp)
+	movw $277, -26(%rbp)
+	movabsq $360342543049, %rax
+	movq %rax, -8(%rbp)
+	movl %edx, %eax
+	imull %edx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movswl -26(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -26(%rbp)
+	movl %r8d, %eax
+	movzwl %si, %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L7
+	leaq .L8(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L4
+	# table target .L3
+	# table target .L6
+	# table target .L2
+	# table target .L1
+	# table target .L5
+	jmp *%rcx
+.L7:
+.L4:
+	call f0
+.L0:
+	movzwl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	addl -8(%rbp), %eax
+	movw %ax, -28(%rbp)
+	xorl %eax, %eax
+	subl -20(%rbp), %eax
+	movq %rax, %rcx
+	movzwl -28(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movsbl -31(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f1.constprop.0_return:
+	leave
+	ret
+.L1:
+	call f0
+	call f0
+	call f0
+	jmp .L0
+.L2:
+	movw $5, -28(%rbp)
+	movzwl -28(%rbp), %eax
+	imull $789, %eax, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L0
+	movswl -26(%rbp), %eax
+	cmpl $8, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl %r8d, %eax
+	setb %al
+	movzbl %al, %eax
+	imull $128, -24(%rbp), %eax
+	shrl $3, %eax
+	movq %rax, %rcx
+	movsbl -31(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -31(%rbp)
+.L9:
+.L10:
+	jmp .L0
+.L3:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzbl -32(%rbp), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movl $9, %eax
+	subq %rcx, %rax
+	je .L11
+	call f0
+	jmp .L0
+.L11:
+	call f0
+	call f0
+	call f0
+.L12:
+	jmp .L0
+.L5:
+	call f0
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $59, %rax
+	jge .L23
+	leaq 2(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L24
+	leaq .L25(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L20
+	# table target .L17
+	# table target .L22
+	# table target .L15
+	# table target .L14
+	jmp *%rcx
+.L23:
+	cmpq $59, %rax
+	je .L13
+	cmpq $156, %rax
+	je .L19
+	cmpq $244, %rax
+	je .L21
+	jmp .L20
+.L24:
+	cmpq $34, %rax
+	je .L13
+.L20:
+	call f0
+	cmpw $0, -30(%rbp)
+	je .L26
+	call f0
+	testl %eax, %eax
+	jne .LB0
+.L26:
+.L27:
+.L21:
+	call f0
+	call f0
+.L13:
+	call f0
+	jmp .L0
+.L18:
+	jmp .L13
+.L16:
+	jmp .L13
+.L19:
+	jmp .L13
+.L14:
+	jmp .L13
+.L15:
+	call f0
+	jmp .L13
+.L17:
+	jmp .L13
+.L22:
+	movabsq $206875320251, %rax
+	call f0
+	jmp .L13
+.L6:
+	call f0
+	jmp .L0
+.LB0:
+	cmpq $2, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f1.constprop.0_return
+	.size f1.constprop.0, .-f1.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L8:
+	.long .L3-.L8
+	.long .L4-.L8
+	.long .L4-.L8
+	.long .L6-.L8
+	.long .L2-.L8
+	.long .L4-.L8
+	.long .L1-.L8
+	.long .L4-.L8
+	.long .L4-.L8
+	.long .L5-.L8
+	.p2align 2
+.L25:
+	.long .L17-.L25
+	.long .L22-.L25
+	.long .L20-.L25
+	.long .L20-.L25
+	.long .L15-.L25
+	.long .L20-.L25
+	.long .L14-.L25
+	.popsection
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movq $5, -8(%rbp)
+	movabsq $266158438300, %rax
+	movl $10, -20(%rbp)
+	movabsq $363821260545, %rax
+	movl $2, -16(%rbp)
+	movl $3300, -12(%rbp)
+	cmpl $65535, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %eax, -16(%rbp)
+	movl -12(%rbp), %eax
+	testl %eax, %eax
+	je .L28
+	movl $233, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L29
+.L28:
+	movl $0, %eax
+.L29:
+	movslq %eax, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	leave
+	ret
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movw %di, -30(%rbp)
+	movw %si, -28(%rbp)
+	movl %edx, -24(%rbp)
+	movb %cl, -32(%rbp)
+	movl %r9d, -20(%rbp)
+	movq $8, -16(%rbp)
+	movb $6, -31(%rbp)
+	movw $277, -26(%rbp)
+	movabsq $360342543049, %rax
+	movq %rax, -8(%rbp)
+	movl %edx, %eax
+	imull %edx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movswl -26(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -26(%rbp)
+	xorl %eax, %eax
+	subl $6, %eax
+	movslq %eax, %rax
+	movabsq $320509946858, %rcx
+	addq %rcx, %rax
+	je .L30
+	movl %r9d, %eax
+	movzwl %si, %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L39
+	leaq .L40(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L36
+	# table target .L35
+	# table target .L38
+	# table target .L34
+	# table target .L33
+	# table target .L37
+	jmp *%rcx
+.L39:
+.L36:
+	call f0
+.L32:
+	movzwl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	addl -8(%rbp), %eax
+	movw %ax, -28(%rbp)
+.L30:
+.L31:
+	xorl %eax, %eax
+	subl -20(%rbp), %eax
+	movq %rax, %rcx
+	movzwl -28(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	subq $0, %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movsbl -31(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f1_return:
+	leave
+	ret
+.L33:
+	movl $2, %eax
+	testl %eax, %eax
+	je .L32
+	call f0
+	call f0
+	call f0
+.L41:
+.L42:
+	jmp .L32
+.L34:
+	movw $5, -28(%rbp)
+	movzwl -28(%rbp), %eax
+	imull $789, %eax, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movabsq $829956495050, %rax
+	cmpq $163, %rax
+	jge .L45
+	movabsq $618977878883, %rax
+	subq $90, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L46
+.L45:
+	movl $1, %eax
+.L46:
+	movslq %eax, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	testq %rax, %rax
+	je .L32
+	movswl -26(%rbp), %eax
+	cmpl $8, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl %r9d, %eax
+	setb %al
+	movzbl %al, %eax
+	imull $128, -24(%rbp), %eax
+	shrl $3, %eax
+	movq %rax, %rcx
+	movsbl -31(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -31(%rbp)
+.L43:
+.L44:
+	jmp .L32
+.L35:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzbl -32(%rbp), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movl $9, %eax
+	subq %rcx, %rax
+	je .L47
+	call f0
+	jmp .L32
+.L47:
+	call f0
+	call f0
+	call f0
+.L48:
+	jmp .L32
+.L37:
+	call f0
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $59, %rax
+	jge .L59
+	leaq 2(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L60
+	leaq .L61(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L56
+	# table target .L53
+	# table target .L58
+	# table target .L51
+	# table target .L50
+	jmp *%rcx
+.L59:
+	cmpq $59, %rax
+	je .L49
+	cmpq $156, %rax
+	je .L55
+	cmpq $244, %rax
+	je .L57
+	jmp .L56
+.L60:
+	cmpq $34, %rax
+	je .L49
+.L56:
+	call f0
+	cmpw $0, -30(%rbp)
+	je .L64
+	call f0
+	testl %eax, %eax
+	jne .LB1
+.L64:
+.L65:
+.L57:
+	call f0
+	call f0
+.L49:
+	call f0
+	jmp .L32
+.L54:
+	jmp .L49
+.L52:
+	jmp .L49
+.L55:
+	movl $8, %eax
+	testl %eax, %eax
+	jne .L62
+	xorl %eax, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L63
+.L62:
+	movl $1, %eax
+.L63:
+	jmp .L49
+.L50:
+	jmp .L49
+.L51:
+	call f0
+	jmp .L49
+.L53:
+	jmp .L49
+.L58:
+	movabsq $206875320251, %rax
+	movq %rax, 16(%rbp)
+	call f0
+	jmp .L49
+.L38:
+	movl $111, %eax
+	testl %eax, %eax
+	jne .L69
+	movl $128, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L70
+.L69:
+	movl $1, %eax
+.L70:
+	movslq %eax, %rax
+	movabsq $405554452359, %rcx
+	addq %rcx, %rax
+	jne .L68
+	cmpb $0, -31(%rbp)
+	jne .L71
+	xorl %eax, %eax
+	je .L66
+.L71:
+.L68:
+	call f0
+.L67:
+	jmp .L32
+.L66:
+	call f0
+	jmp .L32
+.LB1:
+	cmpq $2, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f1_return
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L40:
+	.long .L35-.L40
+	.long .L36-.L40
+	.long .L36-.L40
+	.long .L38-.L40
+	.long .L34-.L40
+	.long .L36-.L40
+	.long .L33-.L40
+	.long .L36-.L40
+	.long .L36-.L40
+	.long .L37-.L40
+	.p2align 2
+.L61:
+	.long .L53-.L61
+	.long .L58-.L61
+	.long .L56-.L61
+	.long .L56-.L61
+	.long .L51-.L61
+	.long .L56-.L61
+	.long .L50-.L61
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movb $4, -56(%rbp)
+	movq $9, -48(%rbp)
+	movl $1, -60(%rbp)
+	movq $0, -40(%rbp)
+	cmpq $3, -40(%rbp)
+	jge .L73
+	.p2align 4,,10
+.L72:
+	movq -48(%rbp), %rax
+	movabsq $928735984445, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -60(%rbp)
+	movq $0, -48(%rbp)
+	movslq -60(%rbp), %rax
+	subq -40(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	subq $928, %rax
+	movq %rax, -24(%rbp)
+	cmpq $17, -48(%rbp)
+	jge .L74
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L77
+	.p2align 4,,10
+.L76:
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movb %al, -8(%rbp)
+	pushq %rax
+	movq -32(%rbp), %rax
+	movl %eax, -52(%rbp)
+	pushq %rax
+	movzbl -56(%rbp), %eax
+	movl %eax, -56(%rbp)
+	imull -56(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1.constprop.0
+	movb $40, -56(%rbp)
+	addq $1, -48(%rbp)
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movzbl -8(%rbp), %eax
+	pushq %rax
+	movl -52(%rbp), %eax
+	pushq %rax
+	movzbl -56(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1.constprop.0
+	movb $40, -56(%rbp)
+	addq $1, -48(%rbp)
+	subq $1, -16(%rbp)
+	jne .L76
+.L77:
+.L74:
+.L75:
+	cmpq $17, -48(%rbp)
+	jge .L79
+	.p2align 4,,10
+.L78:
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	pushq %rax
+	movzbl -56(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1.constprop.0
+	movb $40, -56(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $17, -48(%rbp)
+	jl .L78
+.L79:
+	addq $1, -40(%rbp)
+	cmpq $3, -40(%rbp)
+	jl .L72
+.L73:
+	movb $4, -56(%rbp)
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L84
+	cmpq $4, %rax
+	je .L82
+	cmpq $10, %rax
+	je .L80
+.L83:
+	movl $1, %eax
+	testw %ax, %ax
+	je .L80
+	xorl %eax, %eax
+	subl $10, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl $2, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	call f0
+.L85:
+.L86:
+.L82:
+.L84:
+.L80:
+	cmpq $674, -40(%rbp)
+	setge %al
+	movzbl %al, %eax
+	cmpq $2, -40(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L88
+	cmpq $10, %rax
+	je .L88
+	jmp .L89
+.L88:
+	movq $0, -40(%rbp)
+	movabsq $803180046908, %rax
+	cmpq $1, %rax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpq $100, -40(%rbp)
+	jge .L91
+	.p2align 4,,10
+.L90:
+	call f0
+	movb %al, -56(%rbp)
+	call f0
+	cmpl -8(%rbp), %eax
+	jge .L92
+.L91:
+.L89:
+.L87:
+	call f0
+	testb %al, %al
+	jne .L94
+	movq -40(%rbp), %rax
+	movl $1, -60(%rbp)
+	cmpl $16, -60(%rbp)
+	jge .L97
+	.p2align 4,,10
+.L96:
+	call f0
+	movslq -60(%rbp), %rax
+	movabsq $603504772861, %rcx
+	subq %rcx, %rax
+	movzbl -56(%rbp), %ecx
+	addq %rcx, %rax
+	movb %al, -56(%rbp)
+	movl -60(%rbp), %eax
+	imull -60(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L98
+	movq -48(%rbp), %rax
+	testb %al, %al
+	jne .L102
+	movl $2, %eax
+	testl %eax, %eax
+	jne .L100
+.L102:
+.L97:
+	movzbl -56(%rbp), %eax
+	movq %rax, -8(%rbp)
+	imulq -40(%rbp), %rax
+	testq %rax, %rax
+	je .L106
+	call f0
+	testl %eax, %eax
+	je .L108
+	subq $8, %rsp
+	xorl %eax, %eax
+	subl -60(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -60(%rbp), %eax
+	movq %rax, %r9
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movl $372, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpb $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $136, %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	jmp .L109
+.L98:
+	movl -60(%rbp), %eax
+	addl $9, %eax
+	jne .L97
+	movl $6, %eax
+	testl %eax, %eax
+	je .L103
+.L105:
+	jmp .L97
+.L108:
+	subq $8, %rsp
+	movl $2, %eax
+	pushq %rax
+	movl $304, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	addl $7, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	subq $8, %rax
+	movq %rax, %rsi
+	movq -48(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+.L109:
+.L115:
+.L110:
+.L107:
+.L95:
+	movq -48(%rbp), %rax
+	movq %rax, -48(%rbp)
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl -56(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -60(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	leave
+	ret
+.L106:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $26, %rax
+	jge .L116
+	cmpq $-4, %rax
+	je .L113
+	cmpq $-3, %rax
+	je .L114
+	jmp .L110
+.L100:
+.L101:
+.L103:
+.L104:
+.L99:
+	addl $1, -60(%rbp)
+	cmpl $16, -60(%rbp)
+	jl .L96
+	jmp .L97
+.L92:
+.L93:
+	movb $101, -56(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jl .L90
+	jmp .L91
+.L116:
+	cmpq $26, %rax
+	je .L111
+	cmpq $365, %rax
+	je .L112
+	cmpq $386, %rax
+	je .L115
+	jmp .L110
+.L94:
+	movq $0, -40(%rbp)
+	movl $8, %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movl %eax, -52(%rbp)
+	cmpq $8, -40(%rbp)
+	jge .L119
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L122
+	.p2align 4,,10
+.L121:
+	movq -48(%rbp), %rax
+	cmpq $0, %rax
+.L124:
+	cmpl $0, -52(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+.L123:
+	addq $1, -40(%rbp)
+	movq -48(%rbp), %rax
+	cmpq $0, %rax
+.L126:
+	cmpl $0, -52(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+.L125:
+	addq $1, -40(%rbp)
+	movq -48(%rbp), %rax
+	cmpq $0, %rax
+.L128:
+	cmpl $0, -52(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+.L127:
+	addq $1, -40(%rbp)
+	movq -48(%rbp), %rax
+	cmpq $0, %rax
+.L130:
+	cmpl $0, -52(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -56(%rbp)
+.L129:
+	addq $1, -40(%rbp)
+	subq $1, -8(%rbp)
+	jne .L121
+.L122:
+.L119:
+.L120:
+	cmpq $8, -40(%rbp)
+	jge .L132
+	.p2align 4,,10
+.L131:
+	movq -48(%rbp), %rax
+	cmpq $0, %rax
+.L134:
+	cmpl $0, -52(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -56(%rbp)
+.L133:
+	addq $1, -40(%rbp)
+	cmpq $8, -40(%rbp)
+	jl .L131
+.L132:
+	movq -48(%rbp), %rax
+	movl %eax, -60(%rbp)
+	call f0
+	jmp .L95
+.L112:
+	cmpq $6, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.L113:
+	movslq -60(%rbp), %rax
+	movq %rax, -40(%rbp)
+	jmp .L110
+.L111:
+	call f0
+	jmp .L110
+.L114:
+	movq -40(%rbp), %rax
+	movq %rax, -48(%rbp)
+	movl $10, %eax
+	testl %eax, %eax
+	jne .L117
+	movl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L118
+.L117:
+	movl $1, %eax
+.L118:
+	pushq %rax
+	movl $75, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl -60(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -60(%rbp)
+	jmp .L110
+.L81:
+	jmp .L80
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,214 @@
+short g0;
+int ga0[4];
+int ga1[4];
+int f0(int p0, int p1) {
+    unsigned long v0 = 32767ul;
+    char v1 = 2147483647;
+    short v2 = 489;
+    long v3 = 120;
+    int i0 = 10;
+    long j0 = 2;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 162; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 5U; }
+    v3 = !(((5 - 8) > p0));
+    if (p0) { return (short)(p1); }
+    la1[9] = ((8 / 8) + (v3 <= ga0[3]));
+    p0 = 0;
+    while (p0 < 17) {
+        if (((v0 + (v3 || i0)) / 13ul)) {
+            switch ((unsigned short)((3 && v3))) {
+            case 20:
+                if ((la0[9] + (7 > v3))) { break; }
+            }
+            i0 = 0;
+            while (i0 < 5) {
+                if ((i0 != p0)) { break; }
+                if (413) { break; }
+                if ((!(9) / (i0 * i0 + 1))) { break; }
+                i0 = i0 + 1;
+            }
+        }
+        if ((-(547L) - (long)(4))) { return v3; }
+        p0 = p0 + 1;
+    }
+    switch (3) {
+    case 747:
+        switch (p1) {
+        case 3:
+            if (v1) { return ((j0 && 931232071562) == (char)(0)); }
+            if (!(j0)) { return 978; }
+        }
+        break;
+    default:
+        la1[10] = (v2 > !(6));
+        if (((v2 - 7) < i0)) { return v3; }
+        break;
+    case 264:
+        switch (la1[3]) {
+        case 4:
+            la0[14] = ((ga0[3] - j0) >= (j0 < p0));
+            if (((long)(6l) / (v2 * v2 + 1))) { return (v1 != (355 <= 2)); }
+        default:
+            j0 = j0 + 0;
+            v0 = 0;
+            while (v0 < 4) {
+                v3 = (v3 / 7);
+                v0 = v0 + 1;
+            }
+            break;
+        case 0:
+            v2 = j0;
+            break;
+        case 7:
+            p0 = (unsigned char)(g0);
+            if (v1 >= 0 && v1 < 16) { la0[v1] = ((ga1[2] <= 3) / 3u); }
+        case 8:
+            for (p0 = 1; p0 < 33; p0 = p0 + 1) {
+                if ((v1 + (v3 != v2))) { break; }
+                if ((v3 || i0)) { break; }
+            }
+        case 1:
+            p0 = 0;
+            while (p0 < 5) {
+                if (j0) { break; }
+                p0 = p0 + 1;
+            }
+            switch (((462 - 348) - 4u)) {
+            case 4:
+                if (((v0 && 500) + (unsigned short)(la0[15]))) { return (v3 / (g0 * g0 + 1)); }
+            default:
+                v3 = (unsigned int)((259 + v1));
+                if ((ga1[0] / (v3 * v3 + 1))) { return 754062356090; }
+                break;
+            case 5:
+                break;
+            case 2:
+                break;
+            case 9:
+                j0 = 0;
+            }
+        }
+        break;
+    }
+    return 5;
+}
+void w0(unsigned long q0, char q1) {
+    ga0[2] = ga0[1] + q1;
+}
+char f1() {
+    unsigned int v0 = 832172620316;
+    unsigned long v1 = 9L;
+    long v2 = 0;
+    int v3 = 9;
+    char v4 = 9L;
+    unsigned long v5 = 5;
+    int i0 = 3;
+    long j0 = 9;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 7u; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 10; }
+    switch (((unsigned short)(g0) <= (10L + 748))) {
+    case 5:
+        break;
+    case -2:
+        break;
+    case 946:
+        v1 = 65535;
+        v2 = ((i0 >= 2) || (913 * (j0 / (v5 * v5 + 1))));
+    default:
+        v1 = v1;
+        for (j0 = 2; j0 < 4; j0 = j0 + 1) {
+            for (v0 = 0; v0 < 33; v0 = v0 + 1) {
+                if (i0) { break; }
+            }
+        }
+        break;
+    }
+    if (f0((v5 * v1), (127 <= 127))) {
+        if (g0 >= 0 && g0 < 4) { la1[g0] = (2 >= -(v1)); }
+        la0[4] = -(0);
+        switch (666) {
+        case 4:
+            v4 = 27;
+            if (-(v0)) { return ((short)(431943899684) || !(v4)); }
+        case 6:
+            v0 = (unsigned int)((3 <= i0));
+            break;
+        }
+    }
+    for (v3 = 0; v3 < 8; v3 = v3 + 1) {
+        j0 = j0 + ((2 < v4) <= f0(9, v1));
+    }
+    j0 = ((5 - (v0 && g0)) - (!(9L) <= (i0 > v0)));
+    return 7;
+}
+int rec(int n, int acc) {
+    if (n < 3 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 4, acc);
+}
+int main() {
+    int v0 = 831;
+    unsigned short v1 = 1;
+    unsigned short v2 = 6;
+    unsigned char v3 = 2147483647;
+    unsigned long v4 = 687977082542;
+    unsigned long v5 = 862;
+    int i0 = 10;
+    long j0 = 10;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 574; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 65535; }
+    if ((v1 < v0)) { return ((v0 <= 998288721415) * (1 / 3)); }
+    v4 = v4 + (!(j0) + v2);
+    for (i0 = 2; i0 < 16; i0 = i0 + 1) {
+        v0 = f1();
+        for (j0 = 0; j0 < 3; j0 = j0 + 1) {
+            v0 = (unsigned short)((-(v1) / 1024));
+            switch (f1()) {
+            default:
+                v0 = v5;
+                v4 = v0;
+                break;
+            case 7:
+                v5 = 10;
+                if (((g0 * v0) == (i0 / (v0 * v0 + 1)))) { break; }
+            case 3:
+                if (f0(107, 5)) { return j0; }
+                if (((v1 / 3u) + 3)) { break; }
+            case 2:
+                break;
+            case 4:
+                if (0) { break; }
+                rec(2, g0);
+                break;
+            case 1:
+                break;
+            }
+            v0 = !(v5);
+        }
+        for (v0 = 0; v0 < 3; v0 = v0 + 1) {
+            g0 = (!((int)(j0)) == f1());
+        }
+    }
+    w0(550537968193, 9);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1832 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 16
+	.p2align 5
+ga1:
+	.zero 16
+	.section .text
+	.type f0, @function
+	.type f1, @function
+	.type f0.constprop.0, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movq $32767, -16(%rbp)
+	movb $-1, -17(%rbp)
+	movw $489, -20(%rbp)
+	movq $120, -32(%rbp)
+	movl $10, -36(%rbp)
+	movq $2, -48(%rbp)
+	movl $0, -36(%rbp)
+	imull $162, -36(%rbp), %eax
+	subl $162, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -128(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -36(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L4
+.L5:
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L6
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -280(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $33, -36(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L10
+.L11:
+	cmpl $-3, -4(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -4(%rbp)
+	jne .LB0
+.L12:
+.L13:
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl $1, %eax
+	movl %eax, -236(%rbp)
+	movl $0, -4(%rbp)
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -284(%rbp)
+	cmpq $7, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -288(%rbp)
+	movq $-551, -296(%rbp)
+	cmpl $17, -4(%rbp)
+	jge .L15
+	.p2align 4,,10
+.L14:
+	cmpq $0, -32(%rbp)
+	jne .L18
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L19
+.L18:
+	movl $1, %eax
+.L19:
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L16
+	movl -284(%rbp), %eax
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $20, %rax
+	je .L21
+.L22:
+.L23:
+.L20:
+	movl $0, -36(%rbp)
+	cmpl $5, -36(%rbp)
+	jge .L25
+	.p2align 4,,10
+.L24:
+	movl -36(%rbp), %eax
+	cmpl -4(%rbp), %eax
+.L25:
+.L16:
+.L17:
+	cmpq $0, -296(%rbp)
+	jne .LB1
+.L28:
+.L29:
+	addl $1, -4(%rbp)
+	cmpl $17, -4(%rbp)
+	jl .L14
+.L15:
+	movl $3, %eax
+	movslq %eax, %rax
+	cmpq $264, %rax
+	je .L33
+	cmpq $747, %rax
+	je .L31
+.L32:
+	movswl -20(%rbp), %eax
+	movl %eax, -300(%rbp)
+	testl %eax, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -232(%rbp)
+	movl -300(%rbp), %eax
+	subl $7, %eax
+	cmpl -36(%rbp), %eax
+	jl .LB2
+.L42:
+.L43:
+	jmp .L30
+.L26:
+.L27:
+	jmp .L25
+.LB1:
+	movq -32(%rbp), %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L21:
+	movl -76(%rbp), %eax
+	addl -288(%rbp), %eax
+	je .L22
+	jmp .L20
+.L33:
+	movl -260(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $8, %rcx
+	ja .L51
+	leaq .L52(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L46
+	# table target .L47
+	# table target .L50
+	# table target .L45
+	# table target .L48
+	# table target .L49
+	jmp *%rcx
+.L31:
+	movl -8(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L35
+.L40:
+.L41:
+.L34:
+	jmp .L30
+.L51:
+.L53:
+.L54:
+.L46:
+	movq $0, -16(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -32(%rbp)
+	movq $4, -16(%rbp)
+	jmp .L44
+.L35:
+	cmpb $0, -17(%rbp)
+	je .L36
+	cmpq $0, -48(%rbp)
+	je .L38
+	movabsq $931232071562, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L39
+.L47:
+	movq -48(%rbp), %rax
+	movw %ax, -20(%rbp)
+	jmp .L44
+.L48:
+	movswl g0(%rip), %eax
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movsbl -17(%rbp), %eax
+	movl %eax, -308(%rbp)
+	testl %eax, %eax
+	jl .L55
+	cmpl $16, -308(%rbp)
+	jge .L55
+	movl ga1+8(%rip), %eax
+	cmpl $3, %eax
+	setle %al
+	movzbl %al, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movsbq -17(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L55:
+.L56:
+.L49:
+	movl $1, -4(%rbp)
+	movswq -20(%rbp), %rax
+	cmpq %rax, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -17(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -312(%rbp)
+	cmpq $0, -32(%rbp)
+	jne .L57
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L58
+.L57:
+	movl $1, %eax
+.L58:
+	movl %eax, -316(%rbp)
+	cmpl $33, -4(%rbp)
+	jge .L60
+	.p2align 4,,10
+.L59:
+	cmpl $0, -312(%rbp)
+	je .L61
+.L60:
+.L50:
+	movl $0, -4(%rbp)
+	cmpl $5, -4(%rbp)
+	jge .L66
+	.p2align 4,,10
+.L65:
+	cmpq $0, -48(%rbp)
+	je .L67
+.L66:
+	movl $110, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $7, %rcx
+	ja .L75
+	leaq .L76(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L71
+	# table target .L73
+	# table target .L70
+	# table target .L72
+	# table target .L74
+	jmp *%rcx
+.L67:
+.L68:
+	addl $1, -4(%rbp)
+	cmpl $5, -4(%rbp)
+	jl .L65
+	jmp .L66
+.L61:
+.L62:
+	cmpl $0, -316(%rbp)
+	je .L63
+	jmp .L60
+.L63:
+.L64:
+	addl $1, -4(%rbp)
+	cmpl $33, -4(%rbp)
+	jl .L59
+	jmp .L60
+.L70:
+	movl -52(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	cmpq $0, -16(%rbp)
+	je .L79
+	movl $500, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L80
+.L72:
+	jmp .L69
+.L73:
+	jmp .L69
+.L74:
+	movq $0, -48(%rbp)
+	jmp .L69
+.L75:
+.L77:
+.L78:
+.L71:
+	movsbl -17(%rbp), %eax
+	addl $259, %eax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB3
+.L81:
+.L82:
+.L69:
+.L44:
+.L30:
+	movl $5, %eax
+	jmp .f0_return
+.LB3:
+	movl $-1851888006, %eax
+	jmp .f0_return
+.L79:
+	movl $0, %eax
+.L80:
+	popq %rcx
+	addl %ecx, %eax
+	je .L77
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cqo
+	idivq %rcx
+	jmp .f0_return
+.LB0:
+	movl -8(%rbp), %eax
+	movswl %ax, %eax
+	jmp .f0_return
+.LB2:
+	movq -32(%rbp), %rax
+	jmp .f0_return
+.L38:
+	movl $0, %eax
+.L39:
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L36:
+.L37:
+	cmpq $0, -48(%rbp)
+	jne .L30
+	movl $978, %eax
+	jmp .f0_return
+.L45:
+	movslq -4(%rbp), %rax
+	cmpq %rax, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	subq -48(%rbp), %rax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	movswl -20(%rbp), %eax
+	movl %eax, -304(%rbp)
+	imull -304(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L53
+	movsbl -17(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L52:
+	.long .L47-.L52
+	.long .L50-.L52
+	.long .L46-.L52
+	.long .L46-.L52
+	.long .L45-.L52
+	.long .L46-.L52
+	.long .L46-.L52
+	.long .L48-.L52
+	.long .L49-.L52
+	.p2align 2
+.L76:
+	.long .L73-.L76
+	.long .L71-.L76
+	.long .L70-.L76
+	.long .L72-.L76
+	.long .L71-.L76
+	.long .L71-.L76
+	.long .L71-.L76
+	.long .L74-.L76
+	.popsection
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movl $3243932188, -4(%rbp)
+	movq $9, -16(%rbp)
+	movq $0, -24(%rbp)
+	movl $9, -28(%rbp)
+	movb $9, -29(%rbp)
+	movq $5, -40(%rbp)
+	movl $3, -44(%rbp)
+	movq $9, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $8, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	je .L83
+	movl $8, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L86
+	.p2align 4,,10
+.L85:
+	movl -44(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -112(%rbp)
+	jne .L85
+.L86:
+.L83:
+.L84:
+	cmpl $8, -44(%rbp)
+	jge .L88
+	.p2align 4,,10
+.L87:
+	movl -44(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $8, -44(%rbp)
+	jl .L87
+.L88:
+	movl $0, -44(%rbp)
+	movl $0, -128(%rbp)
+	movl $10, -124(%rbp)
+	movl $20, -120(%rbp)
+	movl $30, -116(%rbp)
+	movl $4, -44(%rbp)
+	movswl g0(%rip), %eax
+	movzwl %ax, %eax
+	cmpq $758, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $-2, %rax
+	je .L89
+	cmpq $5, %rax
+	je .L89
+	cmpq $946, %rax
+	je .L92
+	jmp .L93
+.L91:
+	jmp .L89
+.L94:
+	movl $1, %eax
+.L95:
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L93:
+	movq $2, -56(%rbp)
+	movl $0, -4(%rbp)
+	cmpl $33, -4(%rbp)
+	jae .L97
+	.p2align 4,,10
+.L96:
+	cmpl $0, -44(%rbp)
+	je .L98
+.L97:
+	movl $0, -4(%rbp)
+	cmpl $33, -4(%rbp)
+	jae .L101
+	.p2align 4,,10
+.L100:
+	cmpl $0, -44(%rbp)
+	je .L102
+.L101:
+	movq $4, -56(%rbp)
+.L89:
+	movq -40(%rbp), %rax
+	imulq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.0
+	testl %eax, %eax
+	je .L104
+	movswl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L106
+	movswl g0(%rip), %eax
+	cmpl $4, %eax
+	jge .L106
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	cmpq $2, %rax
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq g0(%rip), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+.L106:
+.L107:
+	movl $0, -80(%rbp)
+	movl $666, %eax
+	movslq %eax, %rax
+	cmpq $4, %rax
+	je .L109
+	cmpq $6, %rax
+	je .L110
+	jmp .L108
+.L109:
+	movb $27, -29(%rbp)
+	xorl %eax, %eax
+	subl -4(%rbp), %eax
+	jne .LB4
+.L111:
+.L112:
+.L110:
+	cmpl $3, -44(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+.L108:
+.L104:
+.L105:
+	movl $0, -28(%rbp)
+	movsbl -29(%rbp), %eax
+	cmpl $2, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L113
+	movl $8, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L116
+	.p2align 4,,10
+.L115:
+	movq -16(%rbp), %rax
+	movl %eax, -148(%rbp)
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	cmpl %eax, -132(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -56(%rbp)
+	addl $1, -28(%rbp)
+	movl -148(%rbp), %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	cmpl %eax, -132(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -56(%rbp)
+	addl $1, -28(%rbp)
+	movl -148(%rbp), %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	cmpl %eax, -132(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -56(%rbp)
+	addl $1, -28(%rbp)
+	movl -148(%rbp), %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	cmpl %eax, -132(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -56(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -144(%rbp)
+	jne .L115
+.L116:
+.L113:
+.L114:
+	cmpl $8, -28(%rbp)
+	jge .L118
+	.p2align 4,,10
+.L117:
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	cmpl %eax, -132(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -56(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $8, -28(%rbp)
+	jl .L117
+.L118:
+	movl -44(%rbp), %eax
+	cmpl -4(%rbp), %eax
+	seta %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -4(%rbp)
+	je .L119
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L120
+.L119:
+	movl $0, %eax
+.L120:
+	movq %rax, %rcx
+	movl $5, %eax
+	subl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	movl $7, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L102:
+.L103:
+	addl $1, -4(%rbp)
+	cmpl $33, -4(%rbp)
+	jb .L100
+	jmp .L101
+.L98:
+.L99:
+	addl $1, -4(%rbp)
+	cmpl $33, -4(%rbp)
+	jb .L96
+	jmp .L97
+.L90:
+	jmp .L89
+.L92:
+	movq $65535, -16(%rbp)
+	cmpl $2, -44(%rbp)
+	jge .L94
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	imulq $913, %rax, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L95
+.LB4:
+	movl $1, %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movl %edi, -4(%rbp)
+	movq $32767, -16(%rbp)
+	movb $-1, -17(%rbp)
+	movw $489, -20(%rbp)
+	movq $120, -32(%rbp)
+	movl $10, -36(%rbp)
+	movq $2, -48(%rbp)
+	movl $0, -36(%rbp)
+	imull $162, -36(%rbp), %eax
+	subl $162, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L121
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L124
+	.p2align 4,,10
+.L123:
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -128(%rbp)
+	jne .L123
+.L124:
+.L121:
+.L122:
+	cmpl $16, -36(%rbp)
+	jge .L126
+	.p2align 4,,10
+.L125:
+	addl $162, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L125
+.L126:
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L127
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L130
+	.p2align 4,,10
+.L129:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -280(%rbp)
+	jne .L129
+.L130:
+.L127:
+.L128:
+	cmpl $33, -36(%rbp)
+	jge .L132
+	.p2align 4,,10
+.L131:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L131
+.L132:
+	cmpl $-3, -4(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -4(%rbp)
+	jne .LB5
+.L133:
+.L134:
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl $1, %eax
+	movl %eax, -236(%rbp)
+	movl $0, -4(%rbp)
+	cmpl $17, -4(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -284(%rbp)
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -288(%rbp)
+	cmpq $7, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -292(%rbp)
+	cmpl $0, -284(%rbp)
+	je .L136
+	.p2align 4,,10
+.L135:
+	cmpq $0, -32(%rbp)
+	jne .L139
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L140
+.L139:
+	movl $1, %eax
+.L140:
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L137
+	movl -288(%rbp), %eax
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $20, %rax
+	je .L142
+.L143:
+.L144:
+.L141:
+	movl $0, -36(%rbp)
+	cmpl $5, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -296(%rbp)
+	movl -36(%rbp), %eax
+	cmpl -4(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -300(%rbp)
+	cmpl $0, -296(%rbp)
+	je .L146
+	.p2align 4,,10
+.L145:
+	cmpl $0, -300(%rbp)
+.L146:
+.L137:
+.L138:
+	movq -32(%rbp), %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L147:
+.L148:
+	jmp .L146
+.L142:
+	movl -76(%rbp), %eax
+	addl -292(%rbp), %eax
+	je .L143
+	jmp .L141
+.L136:
+	movl $3, %eax
+	movslq %eax, %rax
+	cmpq $264, %rax
+	je .L152
+	cmpq $747, %rax
+	je .L150
+.L151:
+	movswl -20(%rbp), %eax
+	movl %eax, -304(%rbp)
+	testl %eax, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -232(%rbp)
+	movl -304(%rbp), %eax
+	subl $7, %eax
+	cmpl -36(%rbp), %eax
+	jl .LB6
+.L161:
+.L162:
+	jmp .L149
+.L152:
+	movl -260(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $8, %rcx
+	ja .L170
+	leaq .L171(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L165
+	# table target .L166
+	# table target .L169
+	# table target .L164
+	# table target .L167
+	# table target .L168
+	jmp *%rcx
+.L150:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L154
+.L159:
+.L160:
+.L153:
+	jmp .L149
+.L170:
+.L172:
+.L173:
+.L165:
+	movq $0, -16(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -32(%rbp)
+	movq $4, -16(%rbp)
+	jmp .L163
+.L154:
+	cmpb $0, -17(%rbp)
+	je .L155
+	cmpq $0, -48(%rbp)
+	je .L157
+	movabsq $931232071562, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L158
+.L166:
+	movq -48(%rbp), %rax
+	movw %ax, -20(%rbp)
+	jmp .L163
+.L167:
+	movswl g0(%rip), %eax
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movsbl -17(%rbp), %eax
+	movl %eax, -312(%rbp)
+	testl %eax, %eax
+	jl .L174
+	cmpl $16, -312(%rbp)
+	jge .L174
+	movl ga1+8(%rip), %eax
+	cmpl $3, %eax
+	setle %al
+	movzbl %al, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movsbq -17(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L174:
+.L175:
+.L168:
+	movl $1, -4(%rbp)
+	movswq -20(%rbp), %rax
+	cmpq %rax, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -17(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -316(%rbp)
+	cmpq $0, -32(%rbp)
+	jne .L176
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L177
+.L176:
+	movl $1, %eax
+.L177:
+	movl %eax, -320(%rbp)
+	cmpl $33, -4(%rbp)
+	jge .L179
+	.p2align 4,,10
+.L178:
+	cmpl $0, -316(%rbp)
+	je .L180
+.L179:
+.L169:
+	movl $0, -4(%rbp)
+	cmpl $5, -4(%rbp)
+	jge .L185
+	.p2align 4,,10
+.L184:
+	cmpq $0, -48(%rbp)
+	je .L186
+.L185:
+	movl $110, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $7, %rcx
+	ja .L194
+	leaq .L195(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L190
+	# table target .L192
+	# table target .L189
+	# table target .L191
+	# table target .L193
+	jmp *%rcx
+.L186:
+.L187:
+	addl $1, -4(%rbp)
+	cmpl $5, -4(%rbp)
+	jl .L184
+	jmp .L185
+.L180:
+.L181:
+	cmpl $0, -320(%rbp)
+	je .L182
+	jmp .L179
+.L182:
+.L183:
+	addl $1, -4(%rbp)
+	cmpl $33, -4(%rbp)
+	jl .L178
+	jmp .L179
+.L189:
+	movl -52(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	cmpq $0, -16(%rbp)
+	je .L198
+	movl $500, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L199
+.L191:
+	jmp .L188
+.L192:
+	jmp .L188
+.L193:
+	movq $0, -48(%rbp)
+	jmp .L188
+.L194:
+.L196:
+.L197:
+.L190:
+	movsbl -17(%rbp), %eax
+	addl $259, %eax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB7
+.L200:
+.L201:
+.L188:
+.L163:
+.L149:
+	movl $5, %eax
+	jmp .f0.constprop.0_return
+.LB5:
+	movl $1, %eax
+	jmp .f0.constprop.0_return
+.LB7:
+	movl $-1851888006, %eax
+	jmp .f0.constprop.0_return
+.L198:
+	movl $0, %eax
+.L199:
+	popq %rcx
+	addl %ecx, %eax
+	je .L196
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cqo
+	idivq %rcx
+	jmp .f0.constprop.0_return
+.LB6:
+	movq -32(%rbp), %rax
+	jmp .f0.constprop.0_return
+.L157:
+	movl $0, %eax
+.L158:
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L155:
+.L156:
+	cmpq $0, -48(%rbp)
+	jne .L149
+	movl $978, %eax
+	jmp .f0.constprop.0_return
+.L164:
+	movslq -4(%rbp), %rax
+	cmpq %rax, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	subq -48(%rbp), %rax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	movswl -20(%rbp), %eax
+	movl %eax, -308(%rbp)
+	imull -308(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L172
+	movsbl -17(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L171:
+	.long .L166-.L171
+	.long .L169-.L171
+	.long .L165-.L171
+	.long .L165-.L171
+	.long .L164-.L171
+	.long .L165-.L171
+	.long .L165-.L171
+	.long .L167-.L171
+	.long .L168-.L171
+	.p2align 2
+.L195:
+	.long .L192-.L195
+	.long .L190-.L195
+	.long .L189-.L195
+	.long .L191-.L195
+	.long .L190-.L195
+	.long .L190-.L195
+	.long .L190-.L195
+	.long .L193-.L195
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movl $831, -4(%rbp)
+	movw $1, -6(%rbp)
+	movw $6, -8(%rbp)
+	movb $255, -9(%rbp)
+	movabsq $687977082542, %rax
+	movq %rax, -24(%rbp)
+	movq $862, -32(%rbp)
+	movl $10, -36(%rbp)
+	movq $10, -48(%rbp)
+	movl $0, -36(%rbp)
+	movl $0, -80(%rbp)
+	movl $574, -76(%rbp)
+	movl $1148, -72(%rbp)
+	movl $1722, -68(%rbp)
+	movl $2296, -64(%rbp)
+	movl $2870, -60(%rbp)
+	movl $3444, -56(%rbp)
+	movl $4018, -52(%rbp)
+	movl $8, -36(%rbp)
+	movl $0, -36(%rbp)
+	movl $0, -96(%rbp)
+	movl $65535, -92(%rbp)
+	movl $131070, -88(%rbp)
+	movl $196605, -84(%rbp)
+	movl $4, -36(%rbp)
+	movzwl -6(%rbp), %eax
+	movl %eax, -100(%rbp)
+	cmpl -4(%rbp), %eax
+	jl .LB8
+.L202:
+.L203:
+	cmpq $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movzwl -8(%rbp), %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	movl $2, -36(%rbp)
+	xorl %eax, %eax
+	subl -100(%rbp), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movl %eax, -104(%rbp)
+	movzwl -6(%rbp), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	addl $3, %eax
+	movl %eax, -108(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L205
+	.p2align 4,,10
+.L204:
+	call f1
+	movsbl %al, %eax
+	movl %eax, -4(%rbp)
+	movq $0, -48(%rbp)
+	movl -104(%rbp), %eax
+	movl %eax, -112(%rbp)
+	movl -108(%rbp), %eax
+	movl %eax, -116(%rbp)
+	cmpq $3, -48(%rbp)
+	jge .L207
+	.p2align 4,,10
+.L206:
+	movl -112(%rbp), %eax
+	movzwl %ax, %eax
+	movl %eax, -4(%rbp)
+	call f1
+	movsbl %al, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L215
+	leaq .L216(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L209
+	# table target .L214
+	# table target .L212
+	# table target .L211
+	# table target .L213
+	# table target .L210
+	jmp *%rcx
+.L210:
+	movq $10, -32(%rbp)
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movswl g0(%rip), %eax
+	imull -4(%rbp), %eax
+	cmpl %ecx, %eax
+	jne .L217
+	jmp .L208
+.L217:
+.L218:
+.L211:
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $107, %eax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	jne .LB9
+.L219:
+.L220:
+	cmpl $0, -116(%rbp)
+	je .L208
+	jmp .L208
+.L221:
+.L222:
+.L212:
+	jmp .L208
+.LB9:
+	movq -48(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L213:
+	movswl g0(%rip), %eax
+	movl %eax, -120(%rbp)
+	movl -120(%rbp), %eax
+	addl $2, %eax
+.L223:
+	jmp .L208
+.L214:
+	jmp .L208
+.L215:
+.L209:
+	movq -32(%rbp), %rax
+	movl %eax, -4(%rbp)
+	movslq -4(%rbp), %rax
+	movq %rax, -24(%rbp)
+.L208:
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $3, -48(%rbp)
+	jl .L206
+.L207:
+	movl $0, -4(%rbp)
+	call f1
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	movl %eax, -124(%rbp)
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+	call f1
+	movsbl %al, %eax
+	movq %rax, %rcx
+	cmpl $0, -124(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+	call f1
+	movsbl %al, %eax
+	movq %rax, %rcx
+	cmpl $0, -124(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+	movl $3, -4(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L204
+.L205:
+	movl ga0+4(%rip), %eax
+	addl $9, %eax
+	movl %eax, ga0+8(%rip)
+.L224:
+	movq $0, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movswq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movslq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movzwl -6(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movzwl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movzbl -9(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movl $0, -36(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl $4, -36(%rbp)
+	movl $0, -36(%rbp)
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga1+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl $4, -36(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jge .L225
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L228
+	.p2align 4,,10
+.L227:
+	movslq -36(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -144(%rbp)
+	jne .L227
+.L228:
+.L225:
+.L226:
+	cmpl $8, -36(%rbp)
+	jge .L230
+	.p2align 4,,10
+.L229:
+	movslq -36(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L229
+.L230:
+	movl $0, -36(%rbp)
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl -92(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl $4, -36(%rbp)
+	movq -136(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -136(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -136(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movq -136(%rbp), %rax
+	jmp .main_return
+.LB8:
+	movl $0, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L216:
+	.long .L214-.L216
+	.long .L212-.L216
+	.long .L211-.L216
+	.long .L213-.L216
+	.long .L209-.L216
+	.long .L209-.L216
+	.long .L210-.L216
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,56 @@
+unsigned int g0;
+long g1;
+int ga0[16];
+long rec(long n, long acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 4, acc);
+}
+int main() {
+    char v0 = 404;
+    long v1 = 768827028166;
+    int v2 = 386;
+    char v3 = 386;
+    unsigned long v4 = 7;
+    int i0 = 364;
+    long j0 = 101;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 731; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 903; }
+    v1 = v1 + 4L;
+    if ((j0 || ((unsigned short)(v1) > (4 < 0)))) {
+        g0 = (((95 && 879) - v3) && (1 * (v3 || g1)));
+    }
+    if (495) {
+        if (i0) {
+            if ((la1[0] == ((i0 != v1) / (v2 * v2 + 1)))) {
+                v3 = (((v0 / (j0 * j0 + 1)) || 89) - (v3 + (la0[13] < v1)));
+            } else {
+                la0[32] = (ga0[9] / 100);
+                v1 = v2;
+                g0 = (i0 + ((short)(10) / 5l));
+            }
+        }
+    } else {
+        g0 = g1;
+        if (-(g0)) {
+            if (v4 >= 0 && v4 < 33) { la0[v4] = rec(v1, la1[0]); }
+        }
+        j0 = (j0 < ((la0[12] + v2) || (173 + g1)));
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,856 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.section .text
+	.type rec, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	cmpq $2, %rdi
+	jl .L2
+	cmpq $18, %rdi
+	jg .L2
+.L0:
+.L1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rdi, -64(%rbp)
+	movq %rsi, -56(%rbp)
+	movq %rdi, %rax
+	subq $4, %rax
+	movq %rax, -48(%rbp)
+	movq %rsi, %rax
+	movq %rax, -40(%rbp)
+	cmpq $2, -48(%rbp)
+	jl .L6
+	cmpq $18, -48(%rbp)
+	jle .L4
+.L6:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L3:
+	pushq %rax
+	movq -64(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -48(%rbp)
+	movq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -40(%rbp)
+	cmpq $2, -48(%rbp)
+	jl .L34
+	cmpq $18, -48(%rbp)
+	jle .L32
+.L34:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L31:
+	popq %rcx
+	addq %rcx, %rax
+	leave
+	ret
+.L4:
+.L5:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L10
+	cmpq $18, -32(%rbp)
+	jle .L8
+.L10:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L7:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L22
+	cmpq $18, -32(%rbp)
+	jle .L20
+.L22:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L19:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L3
+.L32:
+.L33:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L38
+	cmpq $18, -32(%rbp)
+	jle .L36
+.L38:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L35:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L50
+	cmpq $18, -32(%rbp)
+	jle .L48
+.L50:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L47:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L31
+.L8:
+.L9:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L14
+	cmpq $18, -16(%rbp)
+	jle .L12
+.L14:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L11:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L18
+	cmpq $18, -16(%rbp)
+	jle .L16
+.L18:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L15:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L7
+.L20:
+.L21:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L26
+	cmpq $18, -16(%rbp)
+	jle .L24
+.L26:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L23:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L30
+	cmpq $18, -16(%rbp)
+	jle .L28
+.L30:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L27:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L19
+.L36:
+.L37:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L42
+	cmpq $18, -16(%rbp)
+	jle .L40
+.L42:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L39:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L46
+	cmpq $18, -16(%rbp)
+	jle .L44
+.L46:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L43:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L35
+.L48:
+.L49:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L54
+	cmpq $18, -16(%rbp)
+	jle .L52
+.L54:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L51:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L58
+	cmpq $18, -16(%rbp)
+	jle .L56
+.L58:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L55:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L47
+.L12:
+.L13:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L11
+.L16:
+.L17:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L15
+.L24:
+.L25:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L23
+.L28:
+.L29:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L27
+.L40:
+.L41:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L39
+.L44:
+.L45:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L43
+.L52:
+.L53:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L51
+.L56:
+.L57:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L55
+.L2:
+	movq %rsi, %rax
+	addq %rdi, %rax
+	ret
+	.size rec, .-rec
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movb $-108, -1(%rbp)
+	movabsq $768827028166, %rax
+	movq %rax, -16(%rbp)
+	movl $386, -20(%rbp)
+	movb $-126, -21(%rbp)
+	movq $7, -32(%rbp)
+	movl $364, -36(%rbp)
+	movq $101, -48(%rbp)
+	movl $0, -36(%rbp)
+	imull $731, -36(%rbp), %eax
+	subl $731, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -200(%rbp)
+	testl %eax, %eax
+	je .L59
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L62
+	.p2align 4,,10
+.L61:
+	addl $731, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $731, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $731, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $731, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -208(%rbp)
+	jne .L61
+.L62:
+.L59:
+.L60:
+	cmpl $33, -36(%rbp)
+	jge .L64
+	.p2align 4,,10
+.L63:
+	addl $731, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L63
+.L64:
+	movl $0, -36(%rbp)
+	movl $0, -224(%rbp)
+	movl $903, -220(%rbp)
+	movl $1806, -216(%rbp)
+	movl $2709, -212(%rbp)
+	movl $4, -36(%rbp)
+	addq $4, -16(%rbp)
+	cmpq $0, -48(%rbp)
+	jne .L67
+	movq -16(%rbp), %rax
+	movzwl %ax, %eax
+	testl %eax, %eax
+	jle .L65
+.L67:
+	movl $1, %eax
+	movsbl -21(%rbp), %ecx
+	subl %ecx, %eax
+	je .L68
+	cmpb $0, -21(%rbp)
+	jne .L70
+	cmpq $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L69
+.L68:
+	movl $0, %eax
+.L69:
+	movl %eax, g0(%rip)
+.L65:
+.L66:
+	cmpl $0, -36(%rbp)
+	je .L72
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movq %rax, -232(%rbp)
+	cmpq -16(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movl -224(%rbp), %eax
+	cmpl %ecx, %eax
+	jne .L74
+	movl -140(%rbp), %eax
+	movslq %eax, %rax
+	cmpq -16(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -21(%rbp), %eax
+	addl %ecx, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbq -1(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .L76
+	movl $89, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L77
+.L74:
+	movl ga0+36(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl %eax, -64(%rbp)
+	movslq -20(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movq -232(%rbp), %rax
+	addq $2, %rax
+	movl %eax, g0(%rip)
+.L75:
+.L72:
+.L73:
+	movq $0, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movsbq -1(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movsbq -21(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -240(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L78
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -248(%rbp)
+	cmpq $0, -248(%rbp)
+	je .L81
+	.p2align 4,,10
+.L80:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -248(%rbp)
+	jne .L80
+.L81:
+.L78:
+.L79:
+	cmpl $16, -36(%rbp)
+	jge .L83
+	.p2align 4,,10
+.L82:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L82
+.L83:
+	movl $0, -36(%rbp)
+	cmpl $0, -200(%rbp)
+	je .L84
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L87
+	.p2align 4,,10
+.L86:
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -256(%rbp)
+	jne .L86
+.L87:
+.L84:
+.L85:
+	cmpl $33, -36(%rbp)
+	jge .L89
+	.p2align 4,,10
+.L88:
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L88
+.L89:
+	movl $0, -36(%rbp)
+	movl -224(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	movl -220(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	movl -216(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	movl -212(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	movl $4, -36(%rbp)
+	movq -240(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -240(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -240(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	movq -240(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L70:
+	movl $1, %eax
+.L71:
+	jmp .L69
+.L76:
+	movl $1, %eax
+.L77:
+	popq %rcx
+	subl %ecx, %eax
+	movb %al, -21(%rbp)
+	jmp .L75
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,72 @@
+char g0 = 10;
+long g1;
+unsigned short g2;
+int ga0[4];
+int ga1[8];
+int main() {
+    short v0 = 186;
+    unsigned char v1 = 255;
+    unsigned char v2 = 130;
+    long v3 = 7;
+    int i0 = 3;
+    long j0 = 9;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 2; }
+    v3 = 0;
+    while (v3 < 8) {
+        if ((short)((501135001582 || la1[4]))) {
+            i0 = 9;
+        } else {
+            v2 = (v0 - -((v0 - 6)));
+            v0 = j0;
+        }
+        v1 = (char)(v0);
+        if (v1) {
+            if (la1[v3] < g2) { g2 = la1[v3]; }
+            if (-(-(ga0[0]))) {
+                if ((-(7) > (g0 + j0))) { break; }
+                v1 = (ga0[1] * g0);
+            } else {
+                if (834) { break; }
+                if ((unsigned int)((1 >= v0))) { break; }
+                v1 = ga0[3];
+            }
+        }
+        v3 = v3 + 1;
+    }
+    v1 = ((ga0[0] * 1) + ((851077104352 + 5) / (g2 * g2 + 1)));
+    g1 = (short)((i0 - 9));
+    g0 = g0 + (3U * i0);
+    if ((g0 > (la0[2] * g0))) { return (6 + !(g2)); }
+    for (j0 = 2; j0 < 100; j0 = j0 + 1) {
+        if (v3) {
+            g2 = (128 >= (g1 >= v2));
+        }
+        if ((-((6 >= 2147483647)) || i0)) {
+            for (v0 = 2; v0 < 16; v0 = v0 + 1) {
+                if (g0) { break; }
+                g0 = ((v0 - 790) != 67);
+                if (((10 + 0) > (336L + g2))) { break; }
+            }
+        }
+        ga1[4] = g2;
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
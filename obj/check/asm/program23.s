@@ -0,0 +1,498 @@
+	.section .data
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.byte 10
+	.section .bss
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.zero 8
+	.type g2, @object
+	.size g2, 2
+	.p2align 1
+g2:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 32
+	.p2align 5
+ga1:
+	.zero 32
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movw $186, -2(%rbp)
+	movb $255, -3(%rbp)
+	movb $130, -4(%rbp)
+	movq $7, -16(%rbp)
+	movl $3, -20(%rbp)
+	movq $9, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -48(%rbp)
+	movl $2, -44(%rbp)
+	movl $4, -40(%rbp)
+	movl $6, -36(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -80(%rbp)
+	movl $2, -76(%rbp)
+	movl $4, -72(%rbp)
+	movl $6, -68(%rbp)
+	movl $8, -64(%rbp)
+	movl $10, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $14, -52(%rbp)
+	movl $8, -20(%rbp)
+	movq $0, -16(%rbp)
+	movl $-7, -84(%rbp)
+	cmpq $8, -16(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movl $9, -20(%rbp)
+	movswl -2(%rbp), %eax
+	movb %al, -3(%rbp)
+	cmpb $0, -3(%rbp)
+	je .L2
+	movq -16(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movzwl g2(%rip), %ecx
+	cmpl %ecx, %eax
+	jge .L4
+	movq -16(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movw %ax, g2(%rip)
+.L4:
+.L5:
+	xorl %eax, %eax
+	movl ga0+0(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L6
+	movsbq g0(%rip), %rax
+	addq -32(%rbp), %rax
+	movq %rax, %rcx
+	movslq -84(%rbp), %rax
+	cmpq %rcx, %rax
+	jle .L8
+	jmp .L1
+.L8:
+.L9:
+	movl ga0+4(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	movb %al, -3(%rbp)
+.L7:
+.L2:
+.L3:
+	addq $1, -16(%rbp)
+	cmpq $8, -16(%rbp)
+	jl .L0
+.L6:
+.L1:
+	movzwl g2(%rip), %eax
+	movzwl g2(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $851077104357, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	addq %rcx, %rax
+	movb %al, -3(%rbp)
+	movl -20(%rbp), %eax
+	subl $9, %eax
+	movswq %ax, %rax
+	movq %rax, g1(%rip)
+	movl -20(%rbp), %eax
+	imull $3, %eax, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g0(%rip)
+	movl -40(%rbp), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cmpl %ecx, %eax
+	jg .LB0
+.L10:
+.L11:
+	movq $2, -32(%rbp)
+	cmpl $0, -20(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -88(%rbp)
+	movl $10, -92(%rbp)
+	cmpq $100, -32(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movzwl g2(%rip), %eax
+	pushq %rax
+	movzbl -4(%rbp), %eax
+	cmpq %rax, g1(%rip)
+	setge %al
+	movzbl %al, %eax
+	cmpl $128, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -16(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movw %ax, g2(%rip)
+	cmpl $0, -88(%rbp)
+	je .L14
+	movw $2, -2(%rbp)
+	movl -92(%rbp), %eax
+	movl %eax, -96(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -100(%rbp)
+	cmpl $16, %eax
+	jge .L17
+	.p2align 4,,10
+.L16:
+	cmpb $0, g0(%rip)
+	je .L18
+.L17:
+.L14:
+.L15:
+	movzwl g2(%rip), %eax
+	movl %eax, ga1+16(%rip)
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jl .L12
+.L13:
+	movq $0, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	movzwl g2(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	movzbl -3(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	movzbl -4(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	imulq $31, -112(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -112(%rbp)
+	movl $0, -20(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	je .L22
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L25
+	.p2align 4,,10
+.L24:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -128(%rbp)
+	jne .L24
+.L25:
+.L22:
+.L23:
+	cmpl $8, -20(%rbp)
+	jge .L27
+	.p2align 4,,10
+.L26:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L26
+.L27:
+	movl $0, -20(%rbp)
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $0, -116(%rbp)
+	je .L28
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L31
+	.p2align 4,,10
+.L30:
+	movslq -20(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -136(%rbp)
+	jne .L30
+.L31:
+.L28:
+.L29:
+	cmpl $8, -20(%rbp)
+	jge .L33
+	.p2align 4,,10
+.L32:
+	movslq -20(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -112(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L32
+.L33:
+	movq -112(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -112(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -112(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -112(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -112(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -112(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -112(%rbp)
+	movq -112(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L18:
+.L19:
+	movl -100(%rbp), %eax
+	subl $790, %eax
+	cmpl $67, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, g0(%rip)
+	movzwl g2(%rip), %eax
+	addq $336, %rax
+	movq %rax, %rcx
+	movslq -96(%rbp), %rax
+	cmpq %rcx, %rax
+	jle .L20
+	jmp .L17
+.L20:
+.L21:
+	movl -100(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -2(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -100(%rbp)
+	cmpl $16, %eax
+	jl .L16
+	jmp .L17
+.LB0:
+	cmpw $0, g2(%rip)
+	sete %al
+	movzbl %al, %eax
+	addl $6, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
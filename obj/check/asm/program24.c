@@ -0,0 +1,28 @@
+int ga0[33];
+int main() {
+    unsigned int v0 = 8ul;
+    char v1 = 4ul;
+    short v2 = 0;
+    char v3 = 3;
+    int i0 = 128;
+    long j0 = 9;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 966; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 3; }
+    v0 = ((ga0[16] + i0) > 6);
+    if (j0 >= 0 && j0 < 4) { la0[j0] = (j0 / (i0 * i0 + 1)); }
+    ga0[6] = 4;
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
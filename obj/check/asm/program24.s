@@ -0,0 +1,340 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movl $8, -4(%rbp)
+	movb $4, -5(%rbp)
+	movw $0, -8(%rbp)
+	movb $3, -9(%rbp)
+	movl $128, -16(%rbp)
+	movq $9, -24(%rbp)
+	movl $0, -16(%rbp)
+	movl $0, -48(%rbp)
+	movl $966, -44(%rbp)
+	movl $1932, -40(%rbp)
+	movl $2898, -36(%rbp)
+	movl $4, -16(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movslq -16(%rbp), %rax
+	imull $3, -16(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	imull $3, -16(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	imull $3, -16(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	imull $3, -16(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	subq $1, -208(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -16(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -16(%rbp), %rax
+	imull $3, -16(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L4
+.L5:
+	movl ga0+64(%rip), %eax
+	addl -16(%rbp), %eax
+	cmpl $6, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	cmpq $0, -24(%rbp)
+	jl .L6
+	cmpq $4, -24(%rbp)
+	jge .L6
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+.L6:
+.L7:
+	movl $4, ga0+24(%rip)
+	movq $0, -216(%rbp)
+	imulq $31, -216(%rbp), %rax
+	movl -4(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	imulq $31, -216(%rbp), %rax
+	movsbq -5(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	imulq $31, -216(%rbp), %rax
+	movswq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	imulq $31, -216(%rbp), %rax
+	movsbq -9(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	imulq $31, -216(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	imulq $31, -216(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L8
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -224(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L9
+	.p2align 4,,10
+.L10:
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -224(%rbp)
+	jne .L10
+.L11:
+.L8:
+.L9:
+	cmpl $33, -16(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L12
+.L13:
+	movl $0, -16(%rbp)
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	movl $4, -16(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L14
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L15
+	.p2align 4,,10
+.L16:
+	movslq -16(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -232(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $33, -16(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movslq -16(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -216(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L18
+.L19:
+	movq -216(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -216(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -216(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -216(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -216(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -216(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -216(%rbp)
+	movq -216(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
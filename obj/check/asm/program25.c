@@ -0,0 +1,52 @@
+unsigned long g0 = 6;
+long rec(long n, long acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 4, acc);
+}
+int main() {
+    unsigned short v0 = 2;
+    char v1 = 0;
+    long v2 = 1;
+    int i0 = 256;
+    long j0 = 3;
+    v2 = (v0 < j0);
+    if (rec((v0 + g0), (i0 >= v0))) {
+        if (!(!((v1 + 2)))) {
+            if ((rec(37, 554) + (rec(361U, 7) < v2))) {
+                rec(v0, (j0 * 388));
+                g0 = g0 + (short)(v0);
+                rec((unsigned int)(4), 1);
+            }
+            j0 = ((rec(141, 0) >= 5) / (g0 * g0 + 1));
+        }
+    } else {
+        g0 = (int)(rec(g0, v0));
+        j0 = j0 + (unsigned char)((509l == 2));
+        if (65536) {
+            if ((unsigned char)(rec(3L, 3))) {
+                rec((unsigned short)(1), rec(1000000007, 313));
+                j0 = 0;
+                v1 = v1 + (219 || 396);
+            } else {
+                v2 = ((i0 != !(9)) / 10);
+                rec(635, 9);
+            }
+        } else {
+            v1 = ((unsigned long)((v0 + v1)) && v0);
+        }
+    }
+    if ((unsigned long)((int)(j0))) {
+        i0 = i0 + 356;
+    } else {
+        v1 = (2 >= ((v1 * j0) + 5));
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1234 @@
+	.section .data
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.quad 6
+	.section .text
+	.type rec, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	cmpq $2, %rdi
+	jl .L2
+	cmpq $18, %rdi
+	jg .L2
+.L0:
+.L1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rdi, -64(%rbp)
+	movq %rsi, -56(%rbp)
+	movq %rdi, %rax
+	subq $4, %rax
+	movq %rax, -48(%rbp)
+	movq %rsi, %rax
+	movq %rax, -40(%rbp)
+	cmpq $2, -48(%rbp)
+	jl .L6
+	cmpq $18, -48(%rbp)
+	jle .L4
+.L6:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L3:
+	pushq %rax
+	movq -64(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -48(%rbp)
+	movq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -40(%rbp)
+	cmpq $2, -48(%rbp)
+	jl .L34
+	cmpq $18, -48(%rbp)
+	jle .L32
+.L34:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L31:
+	popq %rcx
+	addq %rcx, %rax
+	leave
+	ret
+.L4:
+.L5:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L10
+	cmpq $18, -32(%rbp)
+	jle .L8
+.L10:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L7:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L22
+	cmpq $18, -32(%rbp)
+	jle .L20
+.L22:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L19:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L3
+.L32:
+.L33:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L38
+	cmpq $18, -32(%rbp)
+	jle .L36
+.L38:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L35:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L50
+	cmpq $18, -32(%rbp)
+	jle .L48
+.L50:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L47:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L31
+.L8:
+.L9:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L14
+	cmpq $18, -16(%rbp)
+	jle .L12
+.L14:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L11:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L18
+	cmpq $18, -16(%rbp)
+	jle .L16
+.L18:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L15:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L7
+.L20:
+.L21:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L26
+	cmpq $18, -16(%rbp)
+	jle .L24
+.L26:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L23:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L30
+	cmpq $18, -16(%rbp)
+	jle .L28
+.L30:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L27:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L19
+.L36:
+.L37:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L42
+	cmpq $18, -16(%rbp)
+	jle .L40
+.L42:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L39:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L46
+	cmpq $18, -16(%rbp)
+	jle .L44
+.L46:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L43:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L35
+.L48:
+.L49:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L54
+	cmpq $18, -16(%rbp)
+	jle .L52
+.L54:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L51:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L58
+	cmpq $18, -16(%rbp)
+	jle .L56
+.L58:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L55:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L47
+.L12:
+.L13:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L11
+.L16:
+.L17:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L15
+.L24:
+.L25:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L23
+.L28:
+.L29:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L27
+.L40:
+.L41:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L39
+.L44:
+.L45:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L43
+.L52:
+.L53:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L51
+.L56:
+.L57:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L55
+.L2:
+	movq %rsi, %rax
+	addq %rdi, %rax
+	ret
+	.size rec, .-rec
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movw $2, -78(%rbp)
+	movb $0, -79(%rbp)
+	movl $256, -76(%rbp)
+	movq $3, -64(%rbp)
+	movzwl -78(%rbp), %eax
+	movq %rax, -56(%rbp)
+	cmpq -64(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	movzwl -78(%rbp), %eax
+	addq g0(%rip), %rax
+	movq %rax, -48(%rbp)
+	movzwl -78(%rbp), %eax
+	cmpl %eax, -76(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	cmpq $2, -48(%rbp)
+	jl .L64
+	cmpq $18, -48(%rbp)
+	jle .L62
+.L64:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L61:
+	testq %rax, %rax
+	je .L59
+	movsbl -79(%rbp), %eax
+	addl $2, %eax
+	je .L60
+	cmpq $368, -72(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $591, %rax
+	je .L91
+	movq -56(%rbp), %rax
+	movq %rax, -48(%rbp)
+	imulq $388, -64(%rbp), %rax
+	movq %rax, -40(%rbp)
+	cmpq $2, -48(%rbp)
+	jl .L96
+	cmpq $18, -48(%rbp)
+	jle .L94
+.L96:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L93:
+	movzwl -78(%rbp), %eax
+	movswq %ax, %rax
+	addq %rax, g0(%rip)
+	movl $1, %eax
+.L122:
+	pushq %rax
+	movq $-1, %rax
+	cmpq $2, %rax
+	jl .L127
+	movq $-1, %rax
+	cmpq $18, %rax
+	jle .L125
+.L127:
+	movl $2, %eax
+	addq $-1, %rax
+.L124:
+	pushq %rax
+	movl $2, %eax
+	cmpq $2, %rax
+	jl .L131
+	movl $2, %eax
+	cmpq $18, %rax
+	jle .L129
+.L131:
+	movl $3, %eax
+	addq $2, %rax
+.L128:
+	popq %rcx
+	addq %rcx, %rax
+.L123:
+	popq %rcx
+	addq %rcx, %rax
+.L121:
+.L91:
+.L92:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, -64(%rbp)
+.L89:
+.L90:
+	jmp .L60
+.L59:
+	movq g0(%rip), %rax
+	movq %rax, -48(%rbp)
+	movq -56(%rbp), %rax
+	movq %rax, -40(%rbp)
+	cmpq $2, -48(%rbp)
+	jl .L135
+	cmpq $18, -48(%rbp)
+	jle .L133
+.L135:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L132:
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+	movl $1000000321, %eax
+.L160:
+	movq $0, -64(%rbp)
+	movsbl -79(%rbp), %eax
+	addl $1, %eax
+	movb %al, -79(%rbp)
+.L60:
+	movq -64(%rbp), %rax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L161
+	addl $356, -76(%rbp)
+	jmp .L162
+.L161:
+	movsbq -79(%rbp), %rax
+	imulq -64(%rbp), %rax
+	addq $5, %rax
+	cmpq $2, %rax
+	setle %al
+	movzbl %al, %eax
+	movb %al, -79(%rbp)
+.L162:
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -56(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq -79(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -72(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -76(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -64(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	leave
+	ret
+.L62:
+.L63:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L68
+	cmpq $18, -32(%rbp)
+	jle .L66
+.L68:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L65:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L80
+	cmpq $18, -32(%rbp)
+	jle .L78
+.L80:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L77:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L61
+.L133:
+.L134:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L139
+	cmpq $18, -32(%rbp)
+	jle .L137
+.L139:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L136:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L151
+	cmpq $18, -32(%rbp)
+	jle .L149
+.L151:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L148:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L132
+.L66:
+.L67:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L72
+	cmpq $18, -16(%rbp)
+	jle .L70
+.L72:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L69:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L76
+	cmpq $18, -16(%rbp)
+	jle .L74
+.L76:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L73:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L65
+.L78:
+.L79:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L84
+	cmpq $18, -16(%rbp)
+	jle .L82
+.L84:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L81:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L88
+	cmpq $18, -16(%rbp)
+	jle .L86
+.L88:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L85:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L77
+.L94:
+.L95:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L100
+	cmpq $18, -32(%rbp)
+	jle .L98
+.L100:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L97:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $2, -32(%rbp)
+	jl .L112
+	cmpq $18, -32(%rbp)
+	jle .L110
+.L112:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L109:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L93
+.L125:
+.L126:
+	subq $8, %rsp
+	movl $2, %eax
+	movq %rax, %rsi
+	movq $-1, %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $2, %eax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq $-1, %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L124
+.L129:
+.L130:
+	movl $3, %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $3, %eax
+	addq $1, %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L128
+.L137:
+.L138:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L143
+	cmpq $18, -16(%rbp)
+	jle .L141
+.L143:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L140:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L147
+	cmpq $18, -16(%rbp)
+	jle .L145
+.L147:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L144:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L136
+.L149:
+.L150:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L155
+	cmpq $18, -16(%rbp)
+	jle .L153
+.L155:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L152:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L159
+	cmpq $18, -16(%rbp)
+	jle .L157
+.L159:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L156:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L148
+.L70:
+.L71:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L69
+.L74:
+.L75:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L73
+.L82:
+.L83:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L81
+.L86:
+.L87:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L85
+.L98:
+.L99:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L104
+	cmpq $18, -16(%rbp)
+	jle .L102
+.L104:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L101:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L108
+	cmpq $18, -16(%rbp)
+	jle .L106
+.L108:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L105:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L97
+.L110:
+.L111:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L116
+	cmpq $18, -16(%rbp)
+	jle .L114
+.L116:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L113:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L120
+	cmpq $18, -16(%rbp)
+	jle .L118
+.L120:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L117:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L109
+.L141:
+.L142:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L140
+.L145:
+.L146:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L144
+.L153:
+.L154:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L152
+.L157:
+.L158:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L156
+.L102:
+.L103:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L101
+.L106:
+.L107:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L105
+.L114:
+.L115:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L113
+.L118:
+.L119:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L117
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,312 @@
+unsigned short g0 = 941;
+int g1 = 992;
+int ga0[8];
+unsigned char f0(int p0, unsigned int p1, long p2, int p3, unsigned short p4, int p5, unsigned char p6, unsigned long p7) {
+    char v0 = 5;
+    long v1 = 9;
+    unsigned int v2 = 1000000007;
+    int i0 = 0;
+    long j0 = 214;
+    if (949) {
+        if (256u) {
+            p6 = 198;
+        } else {
+            if ((unsigned short)(g0)) { return (1 == p5); }
+        }
+    }
+    i0 = 0;
+    while (i0 < 16) {
+        p4 = v0;
+        i0 = i0 + 1;
+    }
+    if ((!(9) >= 32767)) { return 329132589670; }
+    p1 = !(p4);
+    if (!(v1)) {
+        p0 = 744;
+        if (!(p3)) {
+            p6 = !(3ul);
+            for (p2 = 2; p2 < 4; p2 = p2 + 1) {
+                if (907) { break; }
+                if (!(i0)) { break; }
+            }
+        } else {
+            p5 = p5 + ((v1 + g0) > 4294967295);
+        }
+    } else {
+        switch ((ga0[4] + 436)) {
+        case 679:
+            if (p5) {
+                if (5) { return ((548430873588 - 1ul) < (6 + g1)); }
+                if (((p7 + g1) + (541 - 51))) { return ((491591879210u + p2) * !(9ul)); }
+            } else {
+                i0 = 894800803596;
+                v0 = (((586 * 7) >= -(ga0[3])) / (g1 * g1 + 1));
+                if ((long)(10)) { return ((0 > 805710274527) || (4 <= 4)); }
+            }
+            switch ((10L <= (537 / (g0 * g0 + 1)))) {
+            default:
+                break;
+            case 5:
+                p0 = !((unsigned int)(-(ga0[6])));
+                v2 = v2 + !((i0 <= j0));
+            case 31:
+                if (603912770281) { return ((j0 / (j0 * j0 + 1)) - (p4 / (p6 * p6 + 1))); }
+                p3 = (p4 - g0);
+            case -4:
+                p3 = (9 >= (7 < (32767 <= 6)));
+            case 892:
+                if (((9 || g1) && (g1 / (p3 * p3 + 1)))) { return p3; }
+                break;
+            case 17:
+                break;
+            }
+            break;
+        case -2:
+            break;
+        default:
+            break;
+        case 24:
+            p6 = (-(932) <= 803);
+            break;
+        case 43:
+        case -1:
+            p2 = (ga0[0] + (p2 || ga0[0]));
+            p1 = ((unsigned char)((long)(308)) + (short)(1));
+            break;
+        }
+        j0 = 0;
+        while (j0 < 33) {
+            p5 = !(p0);
+            j0 = j0 + 1;
+        }
+        if (((i0 + v0) == (v0 >= ga0[1]))) { return ((1 != p6) / 10); }
+    }
+    if (g1) { return (p3 / (p7 * p7 + 1)); }
+    return (unsigned int)((!(v1) + p3));
+}
+unsigned long f1(unsigned long p0, int p1, unsigned long p2) {
+    unsigned int v0 = 483;
+    long v1 = 1;
+    unsigned int v2 = 864;
+    unsigned short v3 = 765;
+    int i0 = 7;
+    long j0 = 3;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 7; }
+    if (((v0 - (v1 - 282)) <= (v3 * (unsigned int)(3)))) {
+        v0 = 0;
+        while (v0 < 33) {
+            p2 = 955L;
+            p0 = 0;
+            while (p0 < 3) {
+                if (((j0 + la1[1]) < 907)) { break; }
+                p0 = p0 + 1;
+            }
+            switch (p1) {
+            case 515:
+                break;
+            case 7:
+                break;
+            default:
+            case 549:
+                p2 = ((unsigned short)(322) / (v1 * v1 + 1));
+                if (1069555865584) { break; }
+                break;
+            case 862:
+                v1 = (((p2 > v2) / 8) - f0(228, v2, i0, 910, i0, la1[0], p0, 5));
+                break;
+            case 53:
+                if (((p1 - 5) + 128)) { break; }
+                j0 = (p0 >= v2);
+            }
+            v0 = v0 + 1;
+        }
+        p1 = (unsigned short)(617);
+        for (p2 = 0; p2 < 33; p2 = p2 + 1) {
+            v1 = v1 + f0(la0[0], 383089248844, p1, 10, p1, la1[3], p0, v3);
+        }
+    } else {
+        switch ((661286148969 < j0)) {
+        case 0:
+            break;
+        case 10:
+            p1 = p1 + ((8ul > la1[2]) - 7);
+        case 6:
+            break;
+        default:
+            v2 = v2 + (char)((979 / 8));
+            break;
+        }
+    }
+    if ((unsigned short)(((v1 != p2) * (v1 <= v0)))) {
+        if (f0(p0, 396U, j0, g1, 255, 7ul, p1, 442)) { return ((661601581945 / (v2 * v2 + 1)) > v1); }
+        v1 = 0;
+        while (v1 < 5) {
+            la0[1] = ((ga0[6] * v0) > 316);
+            v1 = v1 + 1;
+        }
+    }
+    f0((p2 + v0), 10, g0, (1000000007 || 9), f0(g1, g0, p0, g1, p2, g1, v2, 6), 465, (56 == 9), f0(la0[0], v1, v1, g0, 8, 1030377159249, ga0[0], 762614041090));
+    p0 = (237495669703 != 65535);
+    switch (v1) {
+    case 1:
+        break;
+    case 630:
+        p2 = !(((int)(p1) > f0(7, 2, 0, 273641574087, 5, la1[2], 1000000007, 1011200660060)));
+        break;
+    case 31:
+        j0 = 10;
+        if ((-(la1[1]) - (v1 == 7))) {
+            f0(f0(ga0[5], 6, v0, 855l, v1, la0[2], v1, 3), la1[3], (la0[3] / (v3 * v3 + 1)), f0(i0, j0, 745, 8, 7, v2, ga0[0], 770), (3 / 13ul), p1, !(g0), -(v2));
+            for (v2 = 1; v2 < 5; v2 = v2 + 1) {
+                v1 = (unsigned int)((-(g1) * (p0 || g0)));
+            }
+        }
+    }
+    return (-((p1 * la1[0])) - (693135216303 / 100));
+}
+unsigned short f2(int p0) {
+    unsigned short v0 = 683ul;
+    unsigned char v1 = 2;
+    unsigned short v2 = 378;
+    unsigned long v3 = 6;
+    int i0 = 10;
+    long j0 = 368;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 65536; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 1; }
+    la0[15] = 434;
+    v1 = ga0[6];
+    switch ((la1[8] != (v0 <= v1))) {
+    case 5:
+    case 906:
+        break;
+    default:
+        for (i0 = 1; i0 < 17; i0 = i0 + 1) {
+            v2 = f1((j0 + g1), !(la1[32]), (unsigned char)(5ul));
+            if (v1 >= 0 && v1 < 33) { la1[v1] = (f0(8, 7U, 751058334328, 713460305658, 5l, 127, 868290769492, 803u) / 1024); }
+        }
+        break;
+    }
+    v3 = ((8 / 16) / 1);
+    la1[17] = (!(ga0[7]) >= p0);
+    p0 = (((381 / 1024) / 7) || 3);
+    return 255;
+}
+int main() {
+    long v0 = 6;
+    unsigned long v1 = 877;
+    unsigned long v2 = 32767;
+    unsigned long v3 = 1;
+    unsigned int v4 = 8;
+    int i0 = 768;
+    long j0 = 6;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 3l; }
+    i0 = v2;
+    v3 = 0;
+    while (v3 < 8) {
+        if ((f1(3, g0, 3U) <= v0)) {
+            for (v4 = 0; v4 < 100; v4 = v4 + 1) {
+                if ((f0(v0, v0, v0, v1, i0, i0, v2, la0[14]) < la0[12])) { break; }
+                v0 = (((j0 == 128) < (46 != 878)) - (f1(247, 471, v0) * (short)(10)));
+            }
+        } else {
+            g1 = j0;
+            switch ((!(128) - (436U < 10))) {
+            case 4:
+                if (f2(128)) { break; }
+                break;
+            default:
+                break;
+            case 1:
+                break;
+            case 2:
+            case 0:
+                ga0[v3] = f2(7);
+                if (ga0[v3] < v2) { v2 = ga0[v3]; }
+                break;
+            case 6:
+                break;
+            case 8:
+            case 3:
+                if (!(-(i0))) { break; }
+                v2 = -((i0 || !(ga0[3])));
+            }
+        }
+        v4 = 781;
+        v2 = ((927 >= v0) && ((v4 / 3) / 1024));
+        v3 = v3 + 1;
+    }
+    if ((v3 <= (v4 - j0))) { return (9 * (3 != g0)); }
+    v3 = (unsigned short)(!((v4 - v2)));
+    if ((5 <= ((la0[5] - v0) + f1(v4, 644692408202, 1032444420880)))) {
+        switch (((v1 == 221) <= 4)) {
+        case 41:
+            for (v1 = 1; v1 < 4; v1 = v1 + 1) {
+                if ((519 + f1(6, 5, v1))) { break; }
+                g1 = f0((unsigned short)(g0), (ga0[5] * 10), !(v2), 155, (v0 || i0), j0, (8u >= v0), (ga0[5] >= 556));
+            }
+            if (v2 >= 0 && v2 < 8) { ga0[v2] = (v3 > (6 || j0)); }
+            break;
+        default:
+            v0 = -((unsigned short)((j0 + 444)));
+            break;
+        case 0:
+            switch ((long)((g1 || ga0[7]))) {
+            default:
+                j0 = f1(7, j0, (2 != g1));
+                break;
+            case 47:
+                f0((i0 < la0[15]), (ga0[1] > 4), g1, (g1 - 750), i0, g0, v4, 1l);
+                f0(v0, (3u / (v4 * v4 + 1)), (3 - 683766763261), v1, ga0[6], (65536 + 455), (v4 * 625), (3 / 13ul));
+                break;
+            case 780:
+                f0(v1, (0l && v0), (short)(1), (v1 + j0), v1, f2(j0), -(94), la0[1]);
+                break;
+            }
+        case 785:
+            if (((528 == v4) <= (7 != 3))) {
+                v3 = -(-(4));
+                f0((char)(g1), (int)(999), v3, (v2 && v1), g1, (592815999527 > 128), !(la0[14]), (v4 - i0));
+                f2(i0);
+            }
+        case 31:
+            f1(3, (4294967295ul / (j0 * j0 + 1)), f2(j0));
+            for (v1 = 0; v1 < 16; v1 = v1 + 1) {
+                if (g0) { break; }
+            }
+            break;
+        case -1:
+            i0 = 2;
+            break;
+        case 454:
+            break;
+        case 208:
+            for (v4 = 2; v4 < 4; v4 = v4 + 1) {
+                g0 = f1((90U == v1), 939, g0);
+            }
+            j0 = (127 - (8 + g0));
+        }
+    } else {
+        g0 = -(-((428 > i0)));
+    }
+    g1 = g1 + (unsigned long)(-(3));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2927 @@
+	.section .data
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.short 941
+	.type g1, @object
+	.size g1, 4
+	.p2align 2
+g1:
+	.long 992
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f1, @function
+	.type f2, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movl %edi, -44(%rbp)
+	movl %ecx, -40(%rbp)
+	movw %r8w, -46(%rbp)
+	movl %r9d, -36(%rbp)
+	movb $5, -47(%rbp)
+	movq $9, -24(%rbp)
+	movl $1000000007, -32(%rbp)
+	movq $214, -16(%rbp)
+	movl $949, %eax
+	testl %eax, %eax
+	je .L0
+	movl $256, %eax
+	testl %eax, %eax
+	je .L2
+	movb $198, 16(%rbp)
+.L4:
+.L5:
+.L3:
+.L0:
+.L1:
+	movl $0, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jge .L6
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movsbl -47(%rbp), %eax
+	movw %ax, -46(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -46(%rbp), %eax
+	movw %ax, -46(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -46(%rbp), %eax
+	movw %ax, -46(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -46(%rbp), %eax
+	movw %ax, -46(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -8(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $16, -28(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movsbl -47(%rbp), %eax
+	movw %ax, -46(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L10
+.L11:
+	movl $9, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $32767, %eax
+	jge .LB0
+.L12:
+.L13:
+	cmpw $0, -46(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpq $0, -24(%rbp)
+	jne .L14
+	cmpl $0, -40(%rbp)
+	jne .L16
+	movl $3, %eax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movb %al, 16(%rbp)
+	movq $2, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movl $907, %eax
+	testl %eax, %eax
+	je .L20
+.L19:
+.L17:
+.L62:
+.L63:
+.L15:
+	cmpl $0, g1(%rip)
+	je .L64
+	movq 24(%rbp), %rax
+	imulq 24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+.f0_return:
+	leave
+	ret
+.L20:
+.L21:
+	cmpl $0, -28(%rbp)
+	jne .L22
+	jmp .L19
+.L14:
+	movl ga0+16(%rip), %eax
+	addl $436, %eax
+	movslq %eax, %rax
+	cmpq $24, %rax
+	jge .L30
+	cmpq $-2, %rax
+	je .L26
+	cmpq $-1, %rax
+	je .L29
+.L27:
+	jmp .L24
+.L22:
+.L23:
+	addq $1, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	jl .L18
+	jmp .L19
+.L16:
+	movzwl g0(%rip), %eax
+	addq -24(%rbp), %rax
+	movl $4294967295, %ecx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -36(%rbp)
+	jmp .L17
+.L30:
+	cmpq $24, %rax
+	je .L28
+	cmpq $43, %rax
+	je .L29
+	cmpq $679, %rax
+	je .L25
+	jmp .L24
+.L28:
+	xorl %eax, %eax
+	subl $932, %eax
+	cmpl $803, %eax
+	setle %al
+	movzbl %al, %eax
+	movb %al, 16(%rbp)
+	jmp .L24
+.L29:
+	cmpq $0, %rdx
+	jne .L54
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L55
+.L54:
+	movl $1, %eax
+.L55:
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movl $52, %eax
+	addl $1, %eax
+	jmp .L24
+.L25:
+	cmpl $0, %r9d
+	je .L31
+	movl $5, %eax
+	testl %eax, %eax
+	jne .LB1
+.L33:
+.L34:
+	movl $541, %eax
+	subl $51, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq g1(%rip), %rax
+	addq 24(%rbp), %rax
+	addq %rcx, %rax
+	jne .LB2
+.L35:
+.L36:
+.L37:
+.L38:
+.L32:
+	movzwl g0(%rip), %eax
+	movzwl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $537, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $10, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $17, %rax
+	jge .L48
+	cmpq $-4, %rax
+	je .L45
+	cmpq $5, %rax
+	je .L43
+.L42:
+	jmp .L24
+.L31:
+	movl $1447606028, -28(%rbp)
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl $586, %eax
+	imull $7, %eax, %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	movb %al, -47(%rbp)
+	movl $10, %eax
+	testq %rax, %rax
+	je .L37
+	movabsq $805710274527, %rax
+	testq %rax, %rax
+	jl .L39
+	movl $4, %eax
+	cmpl $4, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L43:
+	xorl %eax, %eax
+	movl ga0+24(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	movslq -28(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -32(%rbp)
+.L44:
+	movabsq $603912770281, %rax
+	testq %rax, %rax
+	jne .LB3
+.L49:
+.L50:
+	movzwl -46(%rbp), %eax
+	movzwl g0(%rip), %ecx
+	subl %ecx, %eax
+.L45:
+	movl $32767, %eax
+	cmpl $6, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl $7, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl $9, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+.L46:
+	movl $9, %eax
+	testl %eax, %eax
+	jne .L53
+	cmpl $0, g1(%rip)
+	je .L24
+.L53:
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .LB4
+.L51:
+.L52:
+.L41:
+	jmp .L24
+.L48:
+	cmpq $17, %rax
+	je .L24
+	cmpq $31, %rax
+	je .L44
+	cmpq $892, %rax
+	je .L46
+	jmp .L24
+.L47:
+	jmp .L24
+.L64:
+.L65:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl -40(%rbp), %eax
+	jmp .f0_return
+.L26:
+.L24:
+	movq $0, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jge .L56
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L59
+	.p2align 4,,10
+.L58:
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	subq $1, -8(%rbp)
+	jne .L58
+.L59:
+.L56:
+.L57:
+	cmpq $33, -16(%rbp)
+	jge .L61
+	.p2align 4,,10
+.L60:
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jl .L60
+.L61:
+	movsbl -47(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl ga0+4(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	addl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	jne .L62
+	movzbl 16(%rbp), %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	jmp .f0_return
+.L2:
+	cmpw $0, g0(%rip)
+	je .L4
+	cmpl $1, %r9d
+	sete %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB0:
+	movl $102, %eax
+	jmp .f0_return
+.L39:
+	movl $1, %eax
+.L40:
+	jmp .f0_return
+.LB1:
+	movl g1(%rip), %eax
+	addl $6, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $548430873588, %rax
+	subq $1, %rax
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB2:
+	movl $9, %eax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq %rdx, %rax
+	movq %rax, %rcx
+	movabsq $491591879210, %rax
+	addq %rcx, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	jmp .f0_return
+.LB4:
+	movl -40(%rbp), %eax
+	jmp .f0_return
+.LB3:
+	movzbl 16(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl -46(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $40, %rsp
+	movl %ecx, -32(%rbp)
+	movw %r8w, -34(%rbp)
+	movl %r9d, -16(%rbp)
+	movb $5, -35(%rbp)
+	movq $9, -24(%rbp)
+	movb $198, 16(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jge .L66
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L69
+	.p2align 4,,10
+.L68:
+	movsbl -35(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -8(%rbp)
+	jne .L68
+.L69:
+.L66:
+.L67:
+	cmpl $16, -28(%rbp)
+	jge .L71
+	.p2align 4,,10
+.L70:
+	movsbl -35(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L70
+.L71:
+	cmpw $0, -34(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpq $0, -24(%rbp)
+	jne .L72
+	cmpl $0, -32(%rbp)
+	jne .L74
+	movb $0, 16(%rbp)
+	movq $2, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	.p2align 4,,10
+.L76:
+.L77:
+.L75:
+.L105:
+.L106:
+.L73:
+	cmpl $0, g1(%rip)
+	je .L107
+	movslq -32(%rbp), %rax
+	movl $26, %ecx
+	xorl %edx, %edx
+	divq %rcx
+.f0.constprop.0_return:
+	leave
+	ret
+.L72:
+	movl ga0+16(%rip), %eax
+	addl $436, %eax
+	movslq %eax, %rax
+	cmpq $24, %rax
+	jge .L84
+	cmpq $-2, %rax
+	je .L80
+	cmpq $-1, %rax
+	je .L83
+.L81:
+	jmp .L78
+.L74:
+	movzwl g0(%rip), %eax
+	addq -24(%rbp), %rax
+	movl $4294967295, %ecx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -16(%rbp)
+	jmp .L75
+.L84:
+	cmpq $24, %rax
+	je .L82
+	cmpq $43, %rax
+	je .L83
+	cmpq $679, %rax
+	je .L79
+	jmp .L78
+.L82:
+	movb $1, 16(%rbp)
+	jmp .L78
+.L83:
+	cmpq $0, %rdx
+	jne .L97
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L98
+.L97:
+	movl $1, %eax
+.L98:
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	jmp .L78
+.L107:
+.L108:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl -32(%rbp), %eax
+	jmp .f0.constprop.0_return
+.L80:
+.L78:
+	movq $0, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jge .L99
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L102
+	.p2align 4,,10
+.L101:
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	subq $1, -8(%rbp)
+	jne .L101
+.L102:
+.L99:
+.L100:
+	cmpq $33, -16(%rbp)
+	jge .L104
+	.p2align 4,,10
+.L103:
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jl .L103
+.L104:
+	movsbl -35(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl ga0+4(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	addl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	jne .L105
+	movzbl 16(%rbp), %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	jmp .f0.constprop.0_return
+.L79:
+	cmpl $0, %r9d
+	je .L85
+	movl g1(%rip), %eax
+	addl $6, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $548430873587, %rax
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L85:
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	cmpl $4102, %eax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	movl $1, %eax
+	jmp .f0.constprop.0_return
+.L86:
+	movzwl g0(%rip), %eax
+	movzwl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $537, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $10, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $17, %rax
+	jge .L94
+	cmpq $-4, %rax
+	je .L91
+	cmpq $5, %rax
+	je .L89
+.L88:
+.L87:
+	jmp .L78
+.L94:
+	cmpq $17, %rax
+	je .L78
+	cmpq $31, %rax
+	je .L90
+	cmpq $892, %rax
+	je .L92
+	jmp .L78
+.L89:
+	xorl %eax, %eax
+	movl ga0+24(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq -28(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -8(%rbp)
+.L90:
+	movzbl 16(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl %r8w, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	jmp .f0.constprop.0_return
+.L91:
+	movl $1, -32(%rbp)
+.L92:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L78
+	movl -32(%rbp), %eax
+	jmp .f0.constprop.0_return
+.L95:
+.L96:
+	jmp .L78
+.L93:
+	jmp .L78
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $40, %rsp
+	movl %ecx, -32(%rbp)
+	movw %r8w, -34(%rbp)
+	movl %r9d, -16(%rbp)
+	movb $5, -35(%rbp)
+	movq $9, -24(%rbp)
+	movb $198, 16(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jge .L109
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L112
+	.p2align 4,,10
+.L111:
+	movsbl -35(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	movzwl -34(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -8(%rbp)
+	jne .L111
+.L112:
+.L109:
+.L110:
+	cmpl $16, -28(%rbp)
+	jge .L114
+	.p2align 4,,10
+.L113:
+	movsbl -35(%rbp), %eax
+	movw %ax, -34(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L113
+.L114:
+	cmpw $0, -34(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpq $0, -24(%rbp)
+	jne .L115
+	cmpl $0, -32(%rbp)
+	jne .L117
+	movb $0, 16(%rbp)
+	movq $2, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	.p2align 4,,10
+.L119:
+.L120:
+.L118:
+.L148:
+.L149:
+.L116:
+	cmpl $0, g1(%rip)
+	je .L150
+	movslq -32(%rbp), %rax
+	movl $195365, %ecx
+	xorl %edx, %edx
+	divq %rcx
+.f0.constprop.1_return:
+	leave
+	ret
+.L115:
+	movl ga0+16(%rip), %eax
+	addl $436, %eax
+	movslq %eax, %rax
+	cmpq $24, %rax
+	jge .L127
+	cmpq $-2, %rax
+	je .L123
+	cmpq $-1, %rax
+	je .L126
+.L124:
+	jmp .L121
+.L117:
+	movzwl g0(%rip), %eax
+	addq -24(%rbp), %rax
+	movl $4294967295, %ecx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -16(%rbp)
+	jmp .L118
+.L127:
+	cmpq $24, %rax
+	je .L125
+	cmpq $43, %rax
+	je .L126
+	cmpq $679, %rax
+	je .L122
+	jmp .L121
+.L125:
+	movb $1, 16(%rbp)
+	jmp .L121
+.L126:
+	cmpq $0, %rdx
+	jne .L140
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L141
+.L140:
+	movl $1, %eax
+.L141:
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	jmp .L121
+.L150:
+.L151:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl -32(%rbp), %eax
+	jmp .f0.constprop.1_return
+.L123:
+.L121:
+	movq $0, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jge .L142
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L145
+	.p2align 4,,10
+.L144:
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	subq $1, -8(%rbp)
+	jne .L144
+.L145:
+.L142:
+.L143:
+	cmpq $33, -16(%rbp)
+	jge .L147
+	.p2align 4,,10
+.L146:
+	cmpl $0, %edi
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jl .L146
+.L147:
+	movsbl -35(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl ga0+4(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	addl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	jne .L148
+	movzbl 16(%rbp), %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	jmp .f0.constprop.1_return
+.L122:
+	cmpl $0, %r9d
+	je .L128
+	movl g1(%rip), %eax
+	addl $6, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $548430873587, %rax
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	jmp .f0.constprop.1_return
+.L128:
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	cmpl $4102, %eax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	movl $1, %eax
+	jmp .f0.constprop.1_return
+.L129:
+	movzwl g0(%rip), %eax
+	movzwl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $537, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $10, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $17, %rax
+	jge .L137
+	cmpq $-4, %rax
+	je .L134
+	cmpq $5, %rax
+	je .L132
+.L131:
+.L130:
+	jmp .L121
+.L137:
+	cmpq $17, %rax
+	je .L121
+	cmpq $31, %rax
+	je .L133
+	cmpq $892, %rax
+	je .L135
+	jmp .L121
+.L132:
+	xorl %eax, %eax
+	movl ga0+24(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq -28(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -8(%rbp)
+.L133:
+	movzbl 16(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl %r8w, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	jmp .f0.constprop.1_return
+.L134:
+	movl $1, -32(%rbp)
+.L135:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L121
+	movl -32(%rbp), %eax
+	jmp .f0.constprop.1_return
+.L138:
+.L139:
+	jmp .L121
+.L136:
+	jmp .L121
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq %rdi, -64(%rbp)
+	movl %esi, -108(%rbp)
+	movq %rdx, -56(%rbp)
+	movl $483, -104(%rbp)
+	movq $1, -48(%rbp)
+	movl $864, -100(%rbp)
+	movw $765, -112(%rbp)
+	movq $3, -40(%rbp)
+	movl $0, -84(%rbp)
+	movl $4, -88(%rbp)
+	movl $6, -92(%rbp)
+	movl $0, -68(%rbp)
+	movl $7, -72(%rbp)
+	movl $14, -76(%rbp)
+	movl $21, -80(%rbp)
+	movl $4, -96(%rbp)
+	movzwl -112(%rbp), %eax
+	imull $3, %eax, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $282, %rax
+	movq %rax, %rcx
+	movl -104(%rbp), %eax
+	subq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	jg .L152
+	movl $0, -104(%rbp)
+	movl %esi, %eax
+	subl $5, %eax
+	addl $128, %eax
+	movl %eax, -8(%rbp)
+	cmpl $33, -104(%rbp)
+	jae .L155
+	.p2align 4,,10
+.L154:
+	movq $955, -56(%rbp)
+	movq $0, -64(%rbp)
+	cmpq $3, -64(%rbp)
+	jae .L157
+	.p2align 4,,10
+.L156:
+	movl -72(%rbp), %eax
+	movslq %eax, %rax
+	addq -40(%rbp), %rax
+	cmpq $907, %rax
+	jge .L158
+.L157:
+	movl -108(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $515, %rax
+	jge .L166
+	cmpq $7, %rax
+	je .L160
+	cmpq $53, %rax
+	je .L165
+.L163:
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $322, %eax
+	cqo
+	idivq %rcx
+.L160:
+	addl $1, -104(%rbp)
+	cmpl $33, -104(%rbp)
+	jb .L154
+.L155:
+	movl $617, -108(%rbp)
+	movq $0, -56(%rbp)
+	cmpq $33, -56(%rbp)
+	jae .L169
+	movl $33, %eax
+	subq -56(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -32(%rbp)
+	cmpq $0, -32(%rbp)
+	je .L172
+	.p2align 4,,10
+.L171:
+	movzwl -112(%rbp), %eax
+	movq %rax, -8(%rbp)
+	pushq %rax
+	movq -64(%rbp), %rax
+	movb %al, -16(%rbp)
+	pushq %rax
+	movl -80(%rbp), %eax
+	movq %rax, %r9
+	movl -108(%rbp), %eax
+	movw %ax, -110(%rbp)
+	movq %rax, %r8
+	movl $10, %eax
+	movq %rax, %rcx
+	movslq -108(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq %rax, %rdx
+	movl $837159500, %eax
+	movq %rax, %rsi
+	movl -84(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	addq %rax, -48(%rbp)
+	addq $1, -56(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movzbl -16(%rbp), %eax
+	pushq %rax
+	movl -80(%rbp), %eax
+	movq %rax, %r9
+	movzwl -110(%rbp), %eax
+	movq %rax, %r8
+	movl $10, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl $837159500, %eax
+	movq %rax, %rsi
+	movl -84(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	addq %rax, -48(%rbp)
+	addq $1, -56(%rbp)
+	subq $1, -32(%rbp)
+	jne .L171
+.L172:
+.L169:
+.L170:
+	cmpq $33, -56(%rbp)
+	jae .L174
+	.p2align 4,,10
+.L173:
+	movzwl -112(%rbp), %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	pushq %rax
+	movl -80(%rbp), %eax
+	movq %rax, %r9
+	movl -108(%rbp), %eax
+	movq %rax, %r8
+	movl $10, %eax
+	movq %rax, %rcx
+	movslq -108(%rbp), %rax
+	movq %rax, %rdx
+	movl $837159500, %eax
+	movq %rax, %rsi
+	movl -84(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	addq %rax, -48(%rbp)
+	addq $1, -56(%rbp)
+	cmpq $33, -56(%rbp)
+	jb .L173
+.L174:
+.L175:
+.L153:
+	movl -104(%rbp), %eax
+	movq %rax, -16(%rbp)
+	cmpq %rax, -48(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	cmpq -56(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	testw %ax, %ax
+	je .L180
+	subq $8, %rsp
+	movl -108(%rbp), %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $255, %eax
+	movq %rax, %r8
+	movl g1(%rip), %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movq %rax, %rdx
+	movl $396, %eax
+	movq %rax, %rsi
+	movq -64(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $16, %rsp
+	testb %al, %al
+	jne .LB5
+.L182:
+.L183:
+	movl ga0+24(%rip), %eax
+	imull -104(%rbp), %eax
+	cmpl $316, %eax
+	seta %al
+	movzbl %al, %eax
+	movl ga0+24(%rip), %eax
+	imull -104(%rbp), %eax
+	cmpl $316, %eax
+	seta %al
+	movzbl %al, %eax
+	movl ga0+24(%rip), %eax
+	imull -104(%rbp), %eax
+	cmpl $316, %eax
+	seta %al
+	movzbl %al, %eax
+	movl ga0+24(%rip), %eax
+	imull -104(%rbp), %eax
+	cmpl $316, %eax
+	seta %al
+	movzbl %al, %eax
+	movl ga0+24(%rip), %eax
+	imull -104(%rbp), %eax
+	cmpl $316, %eax
+	seta %al
+	movzbl %al, %eax
+	movq $5, -48(%rbp)
+.L180:
+.L181:
+	movabsq $762614041090, %rax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	pushq %rax
+	movl $-414991791, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movzwl g0(%rip), %eax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movl -84(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl $465, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	pushq %rax
+	movl -100(%rbp), %eax
+	pushq %rax
+	movl g1(%rip), %eax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	movq %rax, %r8
+	movl g1(%rip), %eax
+	movq %rax, %rcx
+	movq -64(%rbp), %rax
+	movq %rax, %rdx
+	movzwl g0(%rip), %eax
+	movq %rax, %rsi
+	movl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzbl %al, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl -104(%rbp), %eax
+	addq -56(%rbp), %rax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movq $1, -64(%rbp)
+	movq -48(%rbp), %rax
+	cmpq $1, %rax
+	je .L185
+	cmpq $31, %rax
+	je .L187
+	cmpq $630, %rax
+	je .L186
+	jmp .L184
+.L158:
+.L159:
+	addq $1, -64(%rbp)
+	cmpq $3, -64(%rbp)
+	jb .L156
+	jmp .L157
+.L166:
+	cmpq $515, %rax
+	je .L160
+	cmpq $549, %rax
+	je .L163
+	cmpq $862, %rax
+	je .L164
+	jmp .L163
+.L161:
+	jmp .L160
+.L162:
+	jmp .L160
+.L165:
+	cmpl $0, -8(%rbp)
+	je .L167
+	jmp .L160
+.L185:
+.L188:
+.L189:
+.L184:
+	movl -68(%rbp), %eax
+	imull -108(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movabsq $6931352163, %rcx
+	subq %rcx, %rax
+.f1_return:
+	leave
+	ret
+.L164:
+	subq $8, %rsp
+	movq -64(%rbp), %rax
+	pushq %rax
+	movl -68(%rbp), %eax
+	movq %rax, %r9
+	movl -96(%rbp), %eax
+	movq %rax, %r8
+	movl $910, %eax
+	movq %rax, %rcx
+	movslq -96(%rbp), %rax
+	movq %rax, %rdx
+	movl -100(%rbp), %eax
+	movq %rax, %rsi
+	movl $228, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $16, %rsp
+	movzbl %al, %eax
+	pushq %rax
+	movl -100(%rbp), %eax
+	cmpq %rax, -56(%rbp)
+	seta %al
+	movzbl %al, %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	jmp .L160
+.L167:
+.L168:
+	movl -100(%rbp), %eax
+	cmpq %rax, -64(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	jmp .L160
+.L152:
+	movabsq $661286148969, %rax
+	cmpq -40(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L175
+	cmpq $6, %rax
+	je .L175
+	cmpq $10, %rax
+	je .L177
+.L179:
+	addl $122, -100(%rbp)
+	jmp .L175
+.L187:
+	movq $10, -40(%rbp)
+	xorl %eax, %eax
+	movl -72(%rbp), %ecx
+	subl %ecx, %eax
+	cmpq $7, -48(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	je .L188
+	xorl %eax, %eax
+	subl -100(%rbp), %eax
+	pushq %rax
+	cmpw $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl $770, %eax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	pushq %rax
+	movl -100(%rbp), %eax
+	movq %rax, %r9
+	movl $7, %eax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movl $745, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl -96(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	pushq %rax
+	movzwl -112(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -92(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movl -80(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $3, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movl -88(%rbp), %eax
+	movq %rax, %r9
+	movq -48(%rbp), %rax
+	movq %rax, %r8
+	movl $855, %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movl ga0+20(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	cmpq $0, -64(%rbp)
+	jne .L190
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L191
+.L190:
+	movl $1, %eax
+.L191:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl g1(%rip), %eax
+	imull %ecx, %eax
+	cmpq $0, -64(%rbp)
+	jne .L192
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L193
+.L192:
+	movl $1, %eax
+.L193:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl g1(%rip), %eax
+	imull %ecx, %eax
+	cmpq $0, -64(%rbp)
+	jne .L194
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L195
+.L194:
+	movl $1, %eax
+.L195:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl g1(%rip), %eax
+	imull %ecx, %eax
+	cmpq $0, -64(%rbp)
+	jne .L196
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L197
+.L196:
+	movl $1, %eax
+.L197:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl g1(%rip), %eax
+	imull %ecx, %eax
+	jmp .L189
+.L176:
+	jmp .L175
+.L186:
+	movabsq $1011200660060, %rax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movl -76(%rbp), %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl $-1236332857, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	cmpl %eax, -108(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .L184
+.L177:
+	movl -76(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	setb %al
+	movzbl %al, %eax
+	subl $7, %eax
+	addl %eax, -108(%rbp)
+.L178:
+	jmp .L175
+.LB5:
+	movl -100(%rbp), %eax
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movabsq $661601581945, %rax
+	cqo
+	idivq %rcx
+	cmpq -48(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $288, %rsp
+	movl %edi, -4(%rbp)
+	movw $683, -6(%rbp)
+	movb $2, -7(%rbp)
+	movw $378, -10(%rbp)
+	movq $6, -24(%rbp)
+	movl $10, -28(%rbp)
+	movq $368, -40(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jge .L198
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -120(%rbp)
+	cmpq $0, -120(%rbp)
+	je .L201
+	.p2align 4,,10
+.L200:
+	movl -28(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movl -28(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movl -28(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movl -28(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -120(%rbp)
+	jne .L200
+.L201:
+.L198:
+.L199:
+	cmpl $16, -28(%rbp)
+	jge .L203
+	.p2align 4,,10
+.L202:
+	movl -28(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L202
+.L203:
+	movl $0, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jge .L204
+	movl $33, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L207
+	.p2align 4,,10
+.L206:
+	movl -28(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movl -28(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movl -28(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movl -28(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -264(%rbp)
+	jne .L206
+.L207:
+.L204:
+.L205:
+	cmpl $33, -28(%rbp)
+	jge .L209
+	.p2align 4,,10
+.L208:
+	movl -28(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jl .L208
+.L209:
+	movl $434, -52(%rbp)
+	movl ga0+24(%rip), %eax
+	movb %al, -7(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -268(%rbp)
+	movq %rax, %rcx
+	movzwl -6(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -224(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L211
+	cmpq $906, %rax
+	je .L211
+.L212:
+	movl $1, -28(%rbp)
+	cmpl $0, -268(%rbp)
+	jl .L213
+	cmpl $33, -268(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L214
+.L211:
+.L210:
+	movl $8, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl -4(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -188(%rbp)
+	movl $381, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	jne .L227
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L228
+.L227:
+	movl $1, %eax
+.L228:
+	movl %eax, -4(%rbp)
+	movl $255, %eax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L213:
+	movl $0, %eax
+.L214:
+	movl %eax, -272(%rbp)
+	cmpl $17, -28(%rbp)
+	jge .L215
+	movl $17, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L218
+	.p2align 4,,10
+.L217:
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -128(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movslq g1(%rip), %rax
+	addq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movw %ax, -10(%rbp)
+	cmpl $0, -272(%rbp)
+	je .L219
+	movl $803, %eax
+	pushq %rax
+	movl $84, %eax
+	pushq %rax
+	movl $127, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl $495734522, %eax
+	movq %rax, %rcx
+	movabsq $751058334328, %rax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -7(%rbp), %eax
+	movl %ecx, -256(%rbp,%rax,4)
+.L219:
+.L220:
+	addl $1, -28(%rbp)
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -128(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movslq g1(%rip), %rax
+	addq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movw %ax, -10(%rbp)
+	cmpl $0, -272(%rbp)
+	je .L221
+	movl $803, %eax
+	pushq %rax
+	movl $84, %eax
+	pushq %rax
+	movl $127, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl $495734522, %eax
+	movq %rax, %rcx
+	movabsq $751058334328, %rax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -7(%rbp), %eax
+	movl %ecx, -256(%rbp,%rax,4)
+.L221:
+.L222:
+	addl $1, -28(%rbp)
+	subq $1, -280(%rbp)
+	jne .L217
+.L218:
+.L215:
+.L216:
+	cmpl $17, -28(%rbp)
+	jge .L210
+	.p2align 4,,10
+.L223:
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -128(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movslq g1(%rip), %rax
+	addq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movw %ax, -10(%rbp)
+	cmpl $0, -272(%rbp)
+	je .L225
+	movl $803, %eax
+	pushq %rax
+	movl $84, %eax
+	pushq %rax
+	movl $127, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl $495734522, %eax
+	movq %rax, %rcx
+	movabsq $751058334328, %rax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -7(%rbp), %eax
+	movl %ecx, -256(%rbp,%rax,4)
+.L225:
+.L226:
+	addl $1, -28(%rbp)
+	cmpl $17, -28(%rbp)
+	jl .L223
+.L224:
+	jmp .L210
+	.size f2, .-f2
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movq $6, -8(%rbp)
+	movq $877, -16(%rbp)
+	movq $32767, -24(%rbp)
+	movq $1, -32(%rbp)
+	movl $8, -36(%rbp)
+	movl $768, -40(%rbp)
+	movq $6, -48(%rbp)
+	movl $0, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	je .L229
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L232
+	.p2align 4,,10
+.L231:
+	movslq -40(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movq %rax, -144(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movq %rax, -152(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movq %rax, -160(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -160(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -128(%rbp)
+	jne .L231
+.L232:
+.L229:
+.L230:
+	cmpl $16, -40(%rbp)
+	jge .L234
+	.p2align 4,,10
+.L233:
+	movslq -40(%rbp), %rax
+	movq %rax, -168(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -168(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L233
+.L234:
+	movq -24(%rbp), %rax
+	movl %eax, -40(%rbp)
+	movq $0, -32(%rbp)
+	cmpq $128, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -172(%rbp)
+	movl $0, -176(%rbp)
+	xorl %eax, %eax
+	subl -40(%rbp), %eax
+	movl %eax, -180(%rbp)
+	cmpq $8, -32(%rbp)
+	jae .L236
+	.p2align 4,,10
+.L235:
+	movq -8(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $3, %eax
+	movq %rax, %rdx
+	movzwl g0(%rip), %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cmpq %rcx, %rax
+	ja .L237
+	movl $0, -36(%rbp)
+	movl -172(%rbp), %eax
+	movl %eax, -184(%rbp)
+	cmpl $100, -36(%rbp)
+	jae .L240
+	.p2align 4,,10
+.L239:
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl -40(%rbp), %eax
+	movq %rax, %r9
+	movl -40(%rbp), %eax
+	movq %rax, %r8
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	movq %rax, %rdx
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	movl -64(%rbp), %ecx
+	cmpl %ecx, %eax
+	jge .L241
+.L240:
+.L243:
+.L238:
+	movl $781, -36(%rbp)
+	cmpq $927, -8(%rbp)
+	jg .L260
+	movl -36(%rbp), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	shrl $10, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L261
+.L260:
+	movl $0, %eax
+.L261:
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $8, -32(%rbp)
+	jb .L235
+.L236:
+	movl -36(%rbp), %eax
+	subq -48(%rbp), %rax
+	cmpq %rax, -32(%rbp)
+	jbe .LB6
+.L262:
+.L263:
+	movl -36(%rbp), %eax
+	movq %rax, -200(%rbp)
+	subq -24(%rbp), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movzwl %ax, %eax
+	movq %rax, -32(%rbp)
+	movabsq $1032444420880, %rax
+	movq %rax, %rdx
+	movl $447313802, %eax
+	movq %rax, %rsi
+	movq -200(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movq %rax, %rcx
+	movl -92(%rbp), %eax
+	movslq %eax, %rax
+	subq -8(%rbp), %rax
+	addq %rcx, %rax
+	cmpq $5, %rax
+	jb .L264
+	cmpq $221, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $41, %rax
+	jge .L275
+	cmpq $-1, %rax
+	je .L272
+	cmpq $0, %rax
+	je .L269
+	cmpq $31, %rax
+	je .L271
+.L268:
+	movq -48(%rbp), %rax
+	addq $444, %rax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	jmp .L266
+.L241:
+.L242:
+	movq -8(%rbp), %rax
+	movq %rax, %rdx
+	movl $471, %eax
+	movq %rax, %rsi
+	movl $247, %eax
+	movq %rax, %rdi
+	call f1
+	imulq $10, %rax, %rax
+	movq %rax, %rcx
+	movslq -184(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, -8(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $100, -36(%rbp)
+	jb .L239
+	jmp .L240
+.L237:
+	movq -48(%rbp), %rax
+	movl %eax, g1(%rip)
+	xorl %eax, %eax
+	subl -176(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $8, %rcx
+	ja .L243
+	leaq .L251(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L245
+	# table target .L247
+	# table target .L246
+	# table target .L249
+	# table target .L244
+	# table target .L248
+	jmp *%rcx
+.L250:
+.L245:
+	jmp .L243
+.L264:
+	xorl %eax, %eax
+	cmpl $428, -40(%rbp)
+	setl %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, g0(%rip)
+	jmp .L265
+.L293:
+	movl $0, %eax
+.L294:
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movl $999, %eax
+	movq %rax, %rsi
+	movl g1(%rip), %eax
+	movsbl %al, %eax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl -40(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+.L291:
+.L292:
+.L271:
+	movq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f2
+	movzwl %ax, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	popq %rdx
+	call f1
+	movq $0, -16(%rbp)
+	cmpq $16, -16(%rbp)
+	jae .L296
+	.p2align 4,,10
+.L295:
+	cmpw $0, g0(%rip)
+	je .L297
+.L296:
+.L266:
+.L265:
+	movslq g1(%rip), %rax
+	addq $-3, %rax
+	movl %eax, g1(%rip)
+	movq $0, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	movslq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	movl -36(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	movslq -40(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	imulq $31, -232(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -232(%rbp)
+	movl $0, -40(%rbp)
+	cmpl $8, -40(%rbp)
+	jge .L299
+	movl $8, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L302
+	.p2align 4,,10
+.L301:
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	subq $1, -240(%rbp)
+	jne .L301
+.L302:
+.L299:
+.L300:
+	cmpl $8, -40(%rbp)
+	jge .L304
+	.p2align 4,,10
+.L303:
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $8, -40(%rbp)
+	jl .L303
+.L304:
+	movl $0, -40(%rbp)
+	cmpl $0, -116(%rbp)
+	je .L305
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -248(%rbp)
+	cmpq $0, -248(%rbp)
+	je .L308
+	.p2align 4,,10
+.L307:
+	movslq -40(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	subq $1, -248(%rbp)
+	jne .L307
+.L308:
+.L305:
+.L306:
+	cmpl $16, -40(%rbp)
+	jge .L310
+	.p2align 4,,10
+.L309:
+	movslq -40(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -232(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L309
+.L310:
+	movq -232(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -232(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -232(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -232(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -232(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -232(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -232(%rbp)
+	movq -232(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L297:
+.L298:
+	addq $1, -16(%rbp)
+	cmpq $16, -16(%rbp)
+	jb .L295
+	jmp .L296
+.L275:
+	cmpq $454, %rax
+	jge .L276
+	cmpq $41, %rax
+	je .L267
+	cmpq $208, %rax
+	je .L274
+	jmp .L268
+.L276:
+	cmpq $454, %rax
+	je .L266
+	cmpq $785, %rax
+	je .L270
+	jmp .L268
+.L272:
+	movl $2, -40(%rbp)
+	jmp .L266
+.L267:
+	movq $1, -16(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .L277
+	cmpl $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L278
+.L277:
+	movl $1, %eax
+.L278:
+	movl %eax, -204(%rbp)
+	cmpq $8, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -208(%rbp)
+	cmpq $4, -16(%rbp)
+	jae .L280
+	.p2align 4,,10
+.L279:
+	movq -16(%rbp), %rax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f1
+	addq $519, %rax
+	je .L281
+.L280:
+	cmpq $0, -24(%rbp)
+	jb .L266
+	cmpq $8, -24(%rbp)
+	jae .L266
+	movq -24(%rbp), %rax
+	cmpq $1, -32(%rbp)
+	seta %cl
+	movzbl %cl, %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L283:
+.L284:
+	jmp .L266
+.L281:
+.L282:
+	movl ga0+20(%rip), %eax
+	cmpl $556, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -208(%rbp), %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movq %rax, %r9
+	movl -204(%rbp), %eax
+	movq %rax, %r8
+	movl $155, %eax
+	movq %rax, %rcx
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl ga0+20(%rip), %eax
+	imull $10, %eax, %eax
+	movq %rax, %rsi
+	movzwl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzbl %al, %eax
+	movl %eax, g1(%rip)
+	addq $1, -16(%rbp)
+	cmpq $4, -16(%rbp)
+	jb .L279
+	jmp .L280
+.L269:
+	cmpl $0, g1(%rip)
+	jne .L289
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L290
+.L289:
+	movl $1, %eax
+.L290:
+	movslq %eax, %rax
+	cmpq $47, %rax
+	je .L287
+	cmpq $780, %rax
+	je .L288
+.L286:
+	cmpl $2, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f1
+	movq %rax, -48(%rbp)
+	jmp .L285
+.L287:
+	movl $1, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	pushq %rax
+	movzwl g0(%rip), %eax
+	movq %rax, %r9
+	movl -40(%rbp), %eax
+	movq %rax, %r8
+	movl g1(%rip), %eax
+	subl $750, %eax
+	movq %rax, %rcx
+	movslq g1(%rip), %rax
+	movq %rax, %rdx
+	movl ga0+4(%rip), %eax
+	cmpl $4, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -52(%rbp), %eax
+	cmpl %eax, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	xorl %eax, %eax
+	pushq %rax
+	imull $625, -36(%rbp), %eax
+	pushq %rax
+	movl $65991, %eax
+	pushq %rax
+	movl ga0+24(%rip), %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movabsq $-683766763258, %rax
+	pushq %rax
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L285:
+.L270:
+	cmpl $528, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	jg .L291
+	movq $4, -32(%rbp)
+	movl -40(%rbp), %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	subl %ecx, %eax
+	pushq %rax
+	movl -56(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl g1(%rip), %eax
+	pushq %rax
+	cmpq $0, -24(%rbp)
+	je .L293
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L294
+.L273:
+	jmp .L266
+.L274:
+	movl $2, -36(%rbp)
+	cmpq $90, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -212(%rbp)
+	movzwl g0(%rip), %eax
+	movq %rax, %rdx
+	movl $939, %eax
+	movq %rax, %rsi
+	movslq -212(%rbp), %rax
+	movq %rax, -224(%rbp)
+	movq %rax, %rdi
+	call f1
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	movq %rax, %rdx
+	movl $939, %eax
+	movq %rax, %rsi
+	movq -224(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movw %ax, g0(%rip)
+	movl $4, -36(%rbp)
+	movzwl g0(%rip), %eax
+	addl $8, %eax
+	movq %rax, %rcx
+	movl $127, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	jmp .L266
+.L288:
+	movl -108(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $162, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f2
+	movzwl %ax, %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movq -48(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	jmp .L285
+.L244:
+	movl $128, %eax
+	movq %rax, %rdi
+	call f2
+	testw %ax, %ax
+	je .L243
+	jmp .L243
+.L252:
+.L253:
+	jmp .L243
+.L246:
+	jmp .L243
+.L247:
+	movl $7, %eax
+	movq %rax, %rdi
+	call f2
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, -192(%rbp)
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movq -192(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	jae .L243
+	movq -192(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L254:
+.L255:
+	jmp .L243
+.L248:
+	jmp .L243
+.L249:
+	cmpl $0, -180(%rbp)
+	jne .L256
+	jmp .L243
+.L256:
+.L257:
+	cmpl $0, -40(%rbp)
+	jne .L258
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L259
+.L258:
+	movl $1, %eax
+.L259:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	jmp .L243
+.LB6:
+	movzwl g0(%rip), %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	imull $9, %eax, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L251:
+	.long .L247-.L251
+	.long .L246-.L251
+	.long .L247-.L251
+	.long .L249-.L251
+	.long .L244-.L251
+	.long .L245-.L251
+	.long .L248-.L251
+	.long .L245-.L251
+	.long .L249-.L251
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
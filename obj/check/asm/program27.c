@@ -0,0 +1,81 @@
+long g0;
+char g1;
+long g2;
+int ga0[4];
+long rec(long n, long acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    short v0 = 959;
+    long v1 = 105;
+    int i0 = 686;
+    long j0 = 39;
+    i0 = (10U / 5l);
+    g0 = -(((unsigned short)(v1) * !(g2)));
+    g1 = ((long)(4) || (v1 + v0));
+    v0 = -(379);
+    v0 = 0;
+    while (v0 < 8) {
+        switch ((g1 > v1)) {
+        case 592:
+            break;
+        default:
+            g1 = g1 + ((2 / (v1 * v1 + 1)) || !(g2));
+            if ((v0 > (g2 && v1))) { return ga0[1]; }
+            break;
+        case -3:
+            switch (i0) {
+            case 3:
+                if (!((ga0[1] - ga0[3]))) { break; }
+            }
+            break;
+        case 1:
+            switch (-((300 / (g1 * g1 + 1)))) {
+            case 314:
+                i0 = (rec(ga0[1], 733172402874) != j0);
+            case 26:
+                v1 = g2;
+                if (rec(256, v1)) { break; }
+                break;
+            case 561:
+                break;
+            case 36:
+                i0 = (unsigned char)(((0U && 127) - -(g2)));
+                break;
+            default:
+            case 4:
+            case 177:
+                if (!(9)) { break; }
+                g2 = g2 + 8;
+                break;
+            case 3:
+                i0 = (((1 - 343) + !(10)) < ((5 <= ga0[2]) < v1));
+                break;
+            }
+            if (-((unsigned int)(ga0[2]))) { return (-(g2) || (8 - 32767)); }
+            break;
+        case 628:
+        case 59:
+            break;
+        case 65:
+            if ((g1 / 3)) { break; }
+            break;
+        case -4:
+            break;
+        }
+        v0 = v0 + 1;
+    }
+    ga0[2] = 411U;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,457 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.zero 8
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.zero 1
+	.type g2, @object
+	.size g2, 8
+	.p2align 3
+g2:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.section .text
+	.global main
+	.type main, @function
+	.type rec, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq $105, -24(%rbp)
+	movq $39, -32(%rbp)
+	movl $2, -16(%rbp)
+	cmpq $0, g2(%rip)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movzwl %ax, %eax
+	imull %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+	movb $1, g1(%rip)
+	movw $0, -50(%rbp)
+	movl $0, -48(%rbp)
+	movl $-342, -44(%rbp)
+	movl $-32759, -40(%rbp)
+	movswl -50(%rbp), %eax
+	movl %eax, -36(%rbp)
+	cmpl $8, %eax
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movsbq g1(%rip), %rax
+	cmpq -24(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $59, %rax
+	jge .L10
+	cmpq $-4, %rax
+	je .L9
+	cmpq $-3, %rax
+	je .L5
+	cmpq $1, %rax
+	je .L6
+.L4:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $2, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .L12
+	cmpq $0, g2(%rip)
+	sete %al
+	movzbl %al, %eax
+	jmp .L13
+.L10:
+	cmpq $592, %rax
+	jge .L11
+	cmpq $59, %rax
+	je .L2
+	cmpq $65, %rax
+	je .L8
+	jmp .L4
+.L9:
+.L2:
+	movl -36(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -50(%rbp)
+	movswl -50(%rbp), %eax
+	movl %eax, -36(%rbp)
+	cmpl $8, %eax
+	jl .L0
+.L1:
+	movl $411, ga0+8(%rip)
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq g2(%rip), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movswq -50(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L11:
+	cmpq $592, %rax
+	je .L2
+	cmpq $628, %rax
+	je .L2
+	jmp .L4
+.L12:
+	movl $1, %eax
+.L13:
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	cmpq $0, g2(%rip)
+	je .L16
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L17
+.L16:
+	movl $0, %eax
+.L17:
+	cmpl %eax, -36(%rbp)
+	jg .LB0
+.L14:
+.L15:
+	jmp .L2
+.L7:
+	jmp .L2
+.L3:
+	jmp .L2
+.L5:
+	movl -16(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L19
+.L20:
+.L21:
+.L18:
+	jmp .L2
+.L19:
+	movl ga0+4(%rip), %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	jne .L2
+	jmp .L2
+.L6:
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $300, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $36, %rax
+	jge .L29
+	cmpq $3, %rax
+	je .L28
+	cmpq $4, %rax
+	je .L27
+	cmpq $26, %rax
+	je .L24
+.L27:
+	addq $8, g2(%rip)
+.L22:
+	movl ga0+8(%rip), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L2
+	xorl %eax, %eax
+	subq g2(%rip), %rax
+	jne .L48
+	cmpl $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .main_return
+.L8:
+	movsbl g1(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L2
+	jmp .L2
+.L29:
+	cmpq $314, %rax
+	jge .L30
+	cmpq $36, %rax
+	je .L26
+	cmpq $177, %rax
+	je .L27
+	jmp .L27
+.L46:
+.L47:
+	jmp .L2
+.L50:
+.L51:
+	jmp .L2
+.L30:
+	cmpq $314, %rax
+	je .L23
+	cmpq $561, %rax
+	je .L22
+	jmp .L27
+.L28:
+	movl ga0+8(%rip), %eax
+	cmpl $5, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	cmpl %eax, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	jmp .L22
+.L23:
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -8(%rbp)
+	jl .L34
+	cmpq $18, -8(%rbp)
+	jle .L32
+.L34:
+	movabsq $733172402874, %rax
+	addq -8(%rbp), %rax
+.L31:
+	cmpq -32(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+.L24:
+	movq g2(%rip), %rax
+	movq %rax, -24(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	addq $256, %rax
+.L45:
+	testq %rax, %rax
+	je .L22
+	jmp .L22
+.L26:
+	xorl %eax, %eax
+	subq g2(%rip), %rax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	subq %rcx, %rax
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	jmp .L22
+.L43:
+.L44:
+	jmp .L22
+.L25:
+	jmp .L22
+.L32:
+.L33:
+	movq -8(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -24(%rbp)
+	movabsq $2199517208622, %rax
+	addq -8(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -24(%rbp)
+	jl .L38
+	cmpq $18, -24(%rbp)
+	jle .L36
+.L38:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L35:
+	jmp .L31
+.L36:
+.L37:
+	movq -24(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L42
+	cmpq $18, -16(%rbp)
+	jle .L40
+.L42:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L39:
+	jmp .L31
+.L40:
+.L41:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $2, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L31
+.LB0:
+	movl ga0+4(%rip), %eax
+	jmp .main_return
+.L48:
+	movl $1, %eax
+.L49:
+	jmp .main_return
+	.size main, .-main
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rdi, -16(%rbp)
+	movq %rsi, -8(%rbp)
+.rec_entry:
+	cmpq $2, -16(%rbp)
+	jl .L54
+	cmpq $18, -16(%rbp)
+	jg .L54
+.L52:
+.L53:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -16(%rbp)
+	popq %rax
+	movq %rax, -8(%rbp)
+	jmp .rec_entry
+.L54:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	leave
+	ret
+	.size rec, .-rec
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,24 @@
+int ga0[16];
+int ga1[8];
+int main() {
+    unsigned char v0 = 5;
+    unsigned long v1 = 725475548134L;
+    char v2 = 753665556350;
+    unsigned int v3 = 10;
+    int i0 = 952;
+    long j0 = 999;
+    if (v2 >= 0 && v2 < 16) { ga0[v2] = (i0 + i0); }
+    if (v2 >= 0 && v2 < 16) { ga0[v2] = ((ga0[3] == j0) >= (1000000007ul + 234)); }
+    v2 = -(2);
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
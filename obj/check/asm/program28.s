@@ -0,0 +1,287 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.type ga1, @object
+	.size ga1, 32
+	.p2align 5
+ga1:
+	.zero 32
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb $5, -42(%rbp)
+	movabsq $725475548134, %rax
+	movq %rax, -32(%rbp)
+	movb $126, -41(%rbp)
+	movl $10, -40(%rbp)
+	movl $952, -36(%rbp)
+	movq $999, -24(%rbp)
+	movsbl -41(%rbp), %eax
+	movl %eax, -8(%rbp)
+	testl %eax, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	testl %eax, %eax
+	je .L0
+	cmpl $16, -8(%rbp)
+	jge .L0
+	movl -36(%rbp), %eax
+	addl -36(%rbp), %eax
+	movq %rax, %rcx
+	movsbq -41(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L0:
+.L1:
+	cmpl $0, -16(%rbp)
+	je .L2
+	cmpl $16, -8(%rbp)
+	jge .L2
+	movl $1000000007, %eax
+	addq $234, %rax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbq -41(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L2:
+.L3:
+	xorl %eax, %eax
+	subl $2, %eax
+	movb %al, -41(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzbl -42(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq -41(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movl -40(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L4
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L5
+	.p2align 4,,10
+.L6:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -8(%rbp)
+	jne .L6
+.L7:
+.L4:
+.L5:
+	cmpl $16, -36(%rbp)
+	jge .L9
+	.p2align 4,,10
+.L8:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L8
+.L9:
+	movl $0, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jge .L10
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L11
+	.p2align 4,,10
+.L12:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -8(%rbp)
+	jne .L12
+.L13:
+.L10:
+.L11:
+	cmpl $8, -36(%rbp)
+	jge .L15
+	.p2align 4,,10
+.L14:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L14
+.L15:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	leave
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,275 @@
+unsigned int g0;
+unsigned short f0(short p0, long p1, int p2) {
+    int v0 = 687;
+    unsigned int v1 = 581;
+    int i0 = 523L;
+    long j0 = 7;
+    j0 = p1;
+    j0 = ((118 / 8) + (v0 - 10));
+    if (((unsigned long)(658211598849) + -(1))) { return !(7); }
+    v1 = 129904824301;
+    for (j0 = 1; j0 < 5; j0 = j0 + 1) {
+        if ((unsigned short)(!(v1))) { break; }
+        switch (!(!(7))) {
+        case -4:
+            if (!(1)) {
+                p2 = ((565u || !(i0)) != ((9L + 263) - (256 <= 127)));
+                v1 = (unsigned char)((g0 >= (559ul && 128)));
+                if (((252466851785 > 6) != p0)) { break; }
+            }
+            break;
+        case 200:
+        default:
+            break;
+        case 9:
+            i0 = (!(-(v1)) * ((809 + 11026196094) != p2));
+            v0 = 0;
+            while (v0 < 100) {
+                v0 = v0 + 1;
+            }
+            break;
+        }
+    }
+    v0 = 0;
+    while (v0 < 4) {
+        p0 = !(((0 >= p1) != v1));
+        j0 = ((-(173233269281) / (i0 * i0 + 1)) * 1);
+        v0 = v0 + 1;
+    }
+    return (7 - v1);
+}
+void w0(unsigned char q0, char q1) {
+    g0 = g0 * 3 + q1;
+    g0 = g0 * 3 + q0;
+}
+char f1(short p0, short p1, unsigned char p2, unsigned char p3, unsigned short p4, unsigned short p5) {
+    long v0 = 340;
+    unsigned char v1 = 809;
+    char v2 = 4;
+    long v3 = 154604216201;
+    int i0 = 530;
+    long j0 = 2;
+    p5 = (p4 / 13ul);
+    switch (p3) {
+    case 10:
+        break;
+    case 3:
+        if ((g0 >= f0(p5, 8, 1))) {
+            p3 = (6 + ((j0 / (p1 * p1 + 1)) && (7 - 9)));
+            v1 = f0(9, 302, 5);
+            f0((v3 + 398), f0(g0, v2, 8), 3);
+        } else {
+            switch ((int)((p4 >= i0))) {
+            case 504:
+                break;
+            default:
+                v0 = f0(222, i0, 212);
+                f0(f0(p2, i0, v1), (699477897979 / (i0 * i0 + 1)), 298);
+            case 5:
+                p5 = p5 + -((v1 / (j0 * j0 + 1)));
+                break;
+            }
+            p1 = 0;
+            while (p1 < 16) {
+                if (((1000000007 > p4) / (p5 * p5 + 1))) { break; }
+                if ((g0 * 2)) { break; }
+                if ((65535 > (6 + p2))) { break; }
+                p1 = p1 + 1;
+            }
+            for (p1 = 0; p1 < 8; p1 = p1 + 1) {
+                v3 = v1;
+                v0 = (p5 == f0(i0, 992873825257, 933));
+                p0 = 1028001801834;
+            }
+        }
+    case 6:
+    case 0:
+        j0 = 729;
+        break;
+    }
+    p1 = (10 / 1);
+    return (((int)(i0) > (p1 != v1)) / 1024);
+}
+void w1(short q0) {
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q0;
+}
+unsigned long f2(unsigned int p0, unsigned int p1, char p2, unsigned int p3, unsigned short p4, long p5) {
+    unsigned int v0 = 231;
+    long v1 = 6ul;
+    unsigned short v2 = 8L;
+    int i0 = 197;
+    long j0 = 10;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 411; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 4; }
+    i0 = i0 + (char)((858 >= v0));
+    la0[1] = (f0(v1, 724619079523, 3) - (596 <= 8));
+    switch ((unsigned short)((unsigned long)(9))) {
+    case 6:
+        if (p5 >= 0 && p5 < 4) { la0[p5] = p3; }
+        break;
+    default:
+        if ((((la0[2] - v0) <= !(la1[15])) <= 750)) {
+            i0 = i0;
+            if (f1((p1 <= i0), (unsigned short)(156), (10 / (i0 * i0 + 1)), p0, (unsigned long)(7), la0[0])) {
+                p5 = p5 + f1(p0, p2, p4, p0, la0[3], 3);
+                f0(f0(2L, 4, 10ul), !(la1[13]), (81912806357 > g0));
+            }
+        }
+        v2 = (v2 + f0(127, 161, 656));
+    case 4:
+        v1 = (((unsigned int)(la0[2]) == 127) && ((p1 / 5l) / (p4 * p4 + 1)));
+        switch (la1[8]) {
+        case 9:
+            break;
+        case 7:
+            for (p0 = 2; p0 < 3; p0 = p0 + 1) {
+                if (v0) { break; }
+            }
+            break;
+        case 1:
+        case 8:
+            break;
+        case 6:
+            break;
+        }
+    case 3:
+        break;
+    }
+    if (p3 >= 0 && p3 < 4) { la0[p3] = p4; }
+    p4 = p0;
+    if (j0) {
+        if (3L) { return (unsigned int)(f1(1000000007, la1[3], j0, 1, p5, v0)); }
+    } else {
+        if (p1 >= 0 && p1 < 16) { la1[p1] = (unsigned char)((v2 / 100)); }
+        if (f0(v1, 730, p5)) { return 157778646797; }
+        if (0) {
+            p3 = -((!(1000000007) / (v0 * v0 + 1)));
+        }
+    }
+    if (-(p5)) {
+        p0 = 0;
+        while (p0 < 100) {
+            if ((3l == g0)) {
+                v0 = !((7 + -(p5)));
+                j0 = (long)(656019486361);
+                if (!(j0)) { return f0(453, p5, i0); }
+            } else {
+                if ((unsigned char)(p0)) { break; }
+            }
+            la1[8] = (127 - -(8));
+            p0 = p0 + 1;
+        }
+        p4 = f1((407110886399 / 13ul), v2, 3, (4294967295 < 549), (6 * p4), (i0 && 894));
+        v0 = v0 + !(-(141ul));
+    } else {
+        if (f1(p4, p0, 1000000007l, 678, j0, 6)) {
+            i0 = i0 + ((65535 * 336572856238ul) / (i0 * i0 + 1));
+        }
+        p0 = !(v0);
+        for (p0 = 0; p0 < 5; p0 = p0 + 1) {
+            switch ((la0[0] * (p3 == 32767))) {
+            case 9:
+                if ((p0 / (v0 * v0 + 1))) { break; }
+                v2 = (g0 * -(p2));
+                break;
+            case 0:
+                if (g0) { break; }
+                if ((unsigned int)(!(3))) { break; }
+            case 3:
+                p3 = p3 + 769;
+            case 10:
+                p4 = ((long)(v1) < 996);
+                break;
+            case 8:
+                p1 = (p4 <= (f0(1000000007, v0, la0[0]) * i0));
+                break;
+            default:
+                la1[p0] = (la0[3] > !(p2));
+                break;
+            }
+            if (la0[1]) {
+                if (((762 / (g0 * g0 + 1)) / (p5 * p5 + 1))) { break; }
+                la0[2] = ((j0 - i0) + 715);
+                la1[p0] = (unsigned long)(p2);
+            }
+        }
+    }
+    return p0;
+}
+void w2(int q0, short q1) {
+    g0 = g0 * 3 + q1;
+    g0 = g0 * 3 + q1;
+}
+int f3(unsigned short p0, char p1, long p2, long p3, unsigned short p4, int p5, unsigned short p6) {
+    int v0 = 160;
+    unsigned long v1 = 6;
+    unsigned char v2 = 9;
+    int i0 = 347767142200;
+    long j0 = 510ul;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 479063413512; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 4; }
+    p1 = (p5 >= (5 - p6));
+    p2 = ((-(3) + (255 || la1[4])) && ((p4 / (v2 * v2 + 1)) / 1024));
+    j0 = j0 + (!(104) <= (0 >= p6));
+    p1 = p1;
+    if (f0(100, p3, (8 == p2))) {
+        p3 = (f2(i0, p4, p6, v0, p3, la1[18]) / (p4 * p4 + 1));
+        p3 = p1;
+    } else {
+        p3 = 0;
+        while (p3 < 3) {
+            p2 = 0;
+            while (p2 < 5) {
+                if ((v0 / 7)) { break; }
+                p5 = p5 + !(p2);
+                p2 = p2 + 1;
+            }
+            p3 = p3 + 1;
+        }
+    }
+    return (unsigned short)(918);
+}
+void w3(long q0, long q1) {
+    g0 = g0 * 3 + q0;
+}
+long rec(long n, long acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 4, acc);
+}
+int main() {
+    long v0 = 36;
+    unsigned char v1 = 1000000007;
+    unsigned char v2 = 5;
+    unsigned int v3 = 4;
+    short v4 = 1;
+    int i0 = 277071119145;
+    long j0 = 127l;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 576395028372; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 4l; }
+    v2 = g0;
+    j0 = ((rec(394, 5) / 1) + (f3(v4, i0, j0, 905u, j0, 35, 3) >= (813 || v2)));
+    v1 = v3;
+    if ((((unsigned short)(2) * (0 - 8)) <= ((334 >= i0) + (v3 <= i0)))) {
+        v0 = ((632212966175u + v0) + la1[0]);
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1574 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.section .text
+	.type f1, @function
+	.type f0, @function
+	.global main
+	.type main, @function
+	.type f3, @function
+	.type f2, @function
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb %dl, -40(%rbp)
+	movb %cl, -8(%rbp)
+	movb $41, -39(%rbp)
+	movb $4, -28(%rbp)
+	movabsq $154604216201, %rax
+	movq %rax, -16(%rbp)
+	movl $530, -36(%rbp)
+	movq $2, -24(%rbp)
+	movzwl %r8w, %eax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movw %ax, -38(%rbp)
+	movzbl -8(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $6, %rax
+	jge .L4
+	cmpq $0, %rax
+	je .L3
+	cmpq $3, %rax
+	je .L2
+	jmp .L0
+.L4:
+	cmpq $6, %rax
+	je .L3
+	cmpq $10, %rax
+	je .L0
+	jmp .L0
+.L5:
+	movzwl %r8w, %eax
+	movl %eax, -16(%rbp)
+	cmpl -36(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L14
+	cmpq $504, %rax
+	je .L11
+.L13:
+	movl $212, %eax
+	movq %rax, %rdx
+	movslq -36(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq %rax, %rsi
+	movl $222, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movl $298, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $699477897979, %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movzbl -39(%rbp), %eax
+	movq %rax, %rdx
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movzbl -40(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	call f0
+.L14:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzbl -39(%rbp), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movzwl -38(%rbp), %eax
+	addq %rcx, %rax
+	movw %ax, -38(%rbp)
+.L11:
+	movw $0, -8(%rbp)
+	cmpl $1000000007, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -32(%rbp)
+	movzwl -38(%rbp), %eax
+	movl %eax, -24(%rbp)
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -28(%rbp)
+	movzbl -40(%rbp), %eax
+	addl $6, %eax
+	cmpl $65535, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $16, %eax
+	jge .L16
+	.p2align 4,,10
+.L15:
+	movl -32(%rbp), %eax
+	cltd
+	idivl -28(%rbp)
+	testl %eax, %eax
+	je .L17
+.L16:
+	movw $0, -8(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $8, %eax
+	jge .L24
+	.p2align 4,,10
+.L23:
+	movzbl -39(%rbp), %eax
+	movl -36(%rbp), %eax
+	movl $687, -8(%rbp)
+	movabsq $992873825257, %rax
+	movl -8(%rbp), %eax
+	subl $10, %eax
+	addl $14, %eax
+	movslq %eax, %rax
+	movl $0, %eax
+.L25:
+	movzwl %ax, %eax
+	cmpl %eax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl -16(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -8(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $8, %eax
+	jl .L23
+.L24:
+.L6:
+.L3:
+.L0:
+	movl $10, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movw %ax, -8(%rbp)
+	movswl -8(%rbp), %eax
+	movzbl -39(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl %eax, -36(%rbp)
+	setg %al
+	movzbl %al, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	leave
+	ret
+.L17:
+.L18:
+	movl g0(%rip), %eax
+	sall $1, %eax
+	testl %eax, %eax
+	je .L19
+	jmp .L16
+.L1:
+	jmp .L0
+.L2:
+	movzwl -38(%rbp), %eax
+	movl $687, -8(%rbp)
+	movl -8(%rbp), %eax
+	subl $10, %eax
+	addl $14, %eax
+	movslq %eax, %rax
+	movl $0, %eax
+.L7:
+	movzwl %ax, %eax
+	cmpl %eax, g0(%rip)
+	jb .L5
+	movswl %si, %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L8
+	movl $7, %eax
+	subl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L9
+.L19:
+.L20:
+	cmpl $0, -16(%rbp)
+	je .L21
+	jmp .L16
+.L8:
+	movl $0, %eax
+.L9:
+	addl $6, %eax
+	movl $687, -8(%rbp)
+	movl -8(%rbp), %eax
+	subl $10, %eax
+	addl $14, %eax
+	movslq %eax, %rax
+	movl $0, %eax
+.L10:
+	movb %al, -39(%rbp)
+	movl $3, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $8, %eax
+	movq %rax, %rdx
+	movsbq -28(%rbp), %rax
+	movq %rax, %rsi
+	movl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	addq $398, %rax
+	movq %rax, %rdi
+	popq %rdx
+	call f0
+	jmp .L6
+.L21:
+.L22:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -8(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $16, %eax
+	jl .L15
+	jmp .L16
+.L12:
+	jmp .L11
+	.size f1, .-f1
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	movl $687, -4(%rbp)
+	movq %rsi, %rax
+	movl -4(%rbp), %eax
+	subl $10, %eax
+	addl $14, %eax
+	movslq %eax, %rax
+	movl $0, %eax
+	popq %rbp
+	ret
+	.size f0, .-f0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movq $36, -8(%rbp)
+	movb $7, -9(%rbp)
+	movb $5, -10(%rbp)
+	movl $4, -16(%rbp)
+	movw $1, -18(%rbp)
+	movl $-2101755095, -24(%rbp)
+	movq $127, -32(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	je .L26
+	movl $16, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L27
+	.p2align 4,,10
+.L28:
+	movslq -24(%rbp), %rax
+	movq %rax, -120(%rbp)
+	movabsq $576395028372, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movabsq $576395028372, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movabsq $576395028372, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movabsq $576395028372, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -112(%rbp)
+	jne .L28
+.L29:
+.L26:
+.L27:
+	cmpl $16, -24(%rbp)
+	jge .L31
+	.p2align 4,,10
+.L30:
+	movslq -24(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movabsq $576395028372, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jl .L30
+.L31:
+	movl $0, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	testl %eax, %eax
+	je .L32
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L33
+	.p2align 4,,10
+.L34:
+	movslq -24(%rbp), %rax
+	movq %rax, -216(%rbp)
+	salq $2, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -224(%rbp)
+	salq $2, %rax
+	movq %rax, %rcx
+	movq -224(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -232(%rbp)
+	salq $2, %rax
+	movq %rax, %rcx
+	movq -232(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -240(%rbp)
+	salq $2, %rax
+	movq %rax, %rcx
+	movq -240(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -208(%rbp)
+	jne .L34
+.L35:
+.L32:
+.L33:
+	cmpl $8, -24(%rbp)
+	jge .L37
+	.p2align 4,,10
+.L36:
+	movslq -24(%rbp), %rax
+	movq %rax, -248(%rbp)
+	salq $2, %rax
+	movq %rax, %rcx
+	movq -248(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L36
+.L37:
+	movl g0(%rip), %eax
+	movb %al, -10(%rbp)
+	movl $35, %eax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movl $905, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movl -24(%rbp), %eax
+	movq %rax, %rsi
+	movswl -18(%rbp), %eax
+	movq %rax, %rdi
+	call f3
+	cmpl $1, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $399, %rax
+	movq %rax, -32(%rbp)
+	movl -16(%rbp), %eax
+	movb %al, -9(%rbp)
+	movl -24(%rbp), %eax
+	cmpl %eax, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $334, -24(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	cmpl $-16, %eax
+	jl .L38
+	movl -192(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $632212966175, %rax
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+.L38:
+.L39:
+	movq $0, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movzbl -9(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movzbl -10(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movl -16(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movswq -18(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movslq -24(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -256(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L40
+	movl $16, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L41
+	.p2align 4,,10
+.L42:
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -264(%rbp)
+	jne .L42
+.L43:
+.L40:
+.L41:
+	cmpl $16, -24(%rbp)
+	jge .L45
+	.p2align 4,,10
+.L44:
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jl .L44
+.L45:
+	movl $0, -24(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L46
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -272(%rbp)
+	cmpq $0, -272(%rbp)
+	je .L47
+	.p2align 4,,10
+.L48:
+	movslq -24(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -272(%rbp)
+	jne .L48
+.L49:
+.L46:
+.L47:
+	cmpl $8, -24(%rbp)
+	jge .L51
+	.p2align 4,,10
+.L50:
+	movslq -24(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L50
+.L51:
+	movq -256(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -256(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -256(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -256(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -256(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -256(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	movq -256(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.align 16
+f3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movw %di, -2(%rbp)
+	movb %sil, -3(%rbp)
+	movq %rdx, -16(%rbp)
+	movq %rcx, -24(%rbp)
+	movw %r8w, -26(%rbp)
+	movl %r9d, -32(%rbp)
+	movl $160, -36(%rbp)
+	movq $6, -48(%rbp)
+	movb $9, -49(%rbp)
+	movl $-125208776, -56(%rbp)
+	movq $510, -64(%rbp)
+	movl $0, -56(%rbp)
+	cmpl $8, -56(%rbp)
+	jge .L52
+	movl $8, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -104(%rbp)
+	cmpq $0, -104(%rbp)
+	je .L55
+	.p2align 4,,10
+.L54:
+	movslq -56(%rbp), %rax
+	movq %rax, -112(%rbp)
+	movabsq $479063413512, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -112(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	movq %rax, -120(%rbp)
+	movabsq $479063413512, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movabsq $479063413512, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movabsq $479063413512, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -104(%rbp)
+	jne .L54
+.L55:
+.L52:
+.L53:
+	cmpl $8, -56(%rbp)
+	jge .L57
+	.p2align 4,,10
+.L56:
+	movslq -56(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movabsq $479063413512, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $8, -56(%rbp)
+	jl .L56
+.L57:
+	movl $0, -56(%rbp)
+	cmpl $33, -56(%rbp)
+	jge .L58
+	movl $33, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -296(%rbp)
+	cmpq $0, -296(%rbp)
+	je .L61
+	.p2align 4,,10
+.L60:
+	movl -56(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -56(%rbp), %rax
+	movl %ecx, -288(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movl -56(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -56(%rbp), %rax
+	movl %ecx, -288(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movl -56(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -56(%rbp), %rax
+	movl %ecx, -288(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movl -56(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -56(%rbp), %rax
+	movl %ecx, -288(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -296(%rbp)
+	jne .L60
+.L61:
+.L58:
+.L59:
+	cmpl $33, -56(%rbp)
+	jge .L63
+	.p2align 4,,10
+.L62:
+	movl -56(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -56(%rbp), %rax
+	movl %ecx, -288(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $33, -56(%rbp)
+	jl .L62
+.L63:
+	cmpl $2, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movb %al, -3(%rbp)
+	movzbl -49(%rbp), %eax
+	movl %eax, -304(%rbp)
+	imull -304(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl -26(%rbp), %eax
+	movl %eax, -300(%rbp)
+	cltd
+	idivl %ecx
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	addq $1, -64(%rbp)
+	cmpq $8, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl $100, %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L64
+	movl -300(%rbp), %eax
+	imull -300(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl -216(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	movq %rax, %rdx
+	movzwl -26(%rbp), %eax
+	movq %rax, %rsi
+	movl -56(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	addq $8, %rsp
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, -24(%rbp)
+	movsbq -3(%rbp), %rax
+	movq %rax, -24(%rbp)
+	jmp .L65
+.L64:
+	movq $0, -24(%rbp)
+	movl -36(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl %eax, -308(%rbp)
+	movq $0, -16(%rbp)
+	movl -308(%rbp), %eax
+	movl %eax, -312(%rbp)
+	cmpq $5, -16(%rbp)
+	jge .L67
+	.p2align 4,,10
+.L66:
+	cmpl $0, -312(%rbp)
+	je .L68
+.L67:
+	movq $0, -16(%rbp)
+	movl -308(%rbp), %eax
+	movl %eax, -312(%rbp)
+	cmpq $5, -16(%rbp)
+	jge .L71
+	.p2align 4,,10
+.L70:
+	cmpl $0, -312(%rbp)
+	je .L72
+.L71:
+	movq $0, -16(%rbp)
+	movl -308(%rbp), %eax
+	movl %eax, -312(%rbp)
+	cmpq $5, -16(%rbp)
+	jge .L75
+	.p2align 4,,10
+.L74:
+	cmpl $0, -312(%rbp)
+	je .L76
+.L75:
+	movq $3, -24(%rbp)
+.L65:
+	movl $918, %eax
+.f3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L76:
+.L77:
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %eax, -32(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L74
+	jmp .L75
+.L72:
+.L73:
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %eax, -32(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L70
+	jmp .L71
+.L68:
+.L69:
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %eax, -32(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L66
+	jmp .L67
+	.size f3, .-f3
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movl %edx, -12(%rbp)
+	movw %cx, -14(%rbp)
+	movq %r8, -24(%rbp)
+	movl $231, -28(%rbp)
+	movq $6, -40(%rbp)
+	movw $8, -42(%rbp)
+	movl $197, -48(%rbp)
+	movq $10, -56(%rbp)
+	movl $0, -48(%rbp)
+	movl $0, -80(%rbp)
+	movl $411, -76(%rbp)
+	movl $822, -72(%rbp)
+	movl $1233, -68(%rbp)
+	movl $4, -48(%rbp)
+	movl $0, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jge .L78
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L81
+	.p2align 4,,10
+.L80:
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -152(%rbp)
+	jne .L80
+.L81:
+.L78:
+.L79:
+	cmpl $16, -48(%rbp)
+	jge .L83
+	.p2align 4,,10
+.L82:
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L82
+.L83:
+	cmpl $858, -28(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+	addl %eax, -48(%rbp)
+	movq -40(%rbp), %rax
+	movw %ax, -154(%rbp)
+	movl $687, -160(%rbp)
+	movl $581, -164(%rbp)
+	movl $523, -168(%rbp)
+	movq $7, -176(%rbp)
+	movabsq $724619079523, %rax
+	movq %rax, -176(%rbp)
+	movl -160(%rbp), %eax
+	subl $10, %eax
+	addl $14, %eax
+	movslq %eax, %rax
+	movq %rax, -176(%rbp)
+	movl $0, %eax
+.L84:
+	movzwl %ax, %eax
+	movl %eax, -76(%rbp)
+	movl $9, %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L89
+	cmpq $4, %rax
+	je .L88
+	cmpq $6, %rax
+	je .L86
+.L87:
+	movl -84(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -72(%rbp), %eax
+	subl -28(%rbp), %eax
+	cmpl %ecx, %eax
+	setbe %al
+	movzbl %al, %eax
+	cmpl $750, %eax
+	jg .L92
+	movl -80(%rbp), %eax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	movb %al, -177(%rbp)
+	pushq %rax
+	movl -48(%rbp), %eax
+	imull -48(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdx
+	movl $156, %eax
+	movq %rax, %rsi
+	movl -48(%rbp), %eax
+	cmpl %eax, -8(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	testb %al, %al
+	je .L94
+	movl $3, %eax
+	movq %rax, %r9
+	movl -68(%rbp), %eax
+	movq %rax, %r8
+	movzbl -177(%rbp), %eax
+	movq %rax, %rcx
+	movzwl -14(%rbp), %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movsbq %al, %rax
+	addq %rax, -24(%rbp)
+	movabsq $81912806357, %rax
+	movl g0(%rip), %ecx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -92(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	call f0
+.L94:
+.L95:
+.L92:
+.L93:
+	movl $656, %eax
+	movq %rax, %rdx
+	movl $161, %eax
+	movq %rax, %rsi
+	movl $127, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movzwl -42(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -42(%rbp)
+.L88:
+	movl -72(%rbp), %eax
+	cmpl $127, %eax
+	jne .L96
+	movzwl -14(%rbp), %eax
+	movl %eax, -184(%rbp)
+	imull -184(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -8(%rbp), %eax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L97
+.L103:
+.L98:
+.L89:
+.L85:
+	cmpl $0, -12(%rbp)
+	jb .L109
+	cmpl $4, -12(%rbp)
+	jae .L109
+	movl -12(%rbp), %eax
+	movzwl -14(%rbp), %ecx
+	movl %ecx, -80(%rbp,%rax,4)
+.L109:
+.L110:
+	movl -4(%rbp), %eax
+	movw %ax, -14(%rbp)
+	cmpq $0, -56(%rbp)
+	jne .LB0
+.L111:
+	cmpl $0, -8(%rbp)
+	jb .L113
+	cmpl $16, -8(%rbp)
+	jae .L113
+	movzwl -42(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movl %ecx, -144(%rbp,%rax,4)
+.L113:
+.L114:
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl $730, %eax
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	jne .LB1
+.L115:
+.L116:
+.L112:
+	xorl %eax, %eax
+	subq -24(%rbp), %rax
+	movq %rax, -192(%rbp)
+	testq %rax, %rax
+	je .L117
+	movl $0, -4(%rbp)
+	movq -192(%rbp), %rax
+	addq $7, %rax
+	movq %rax, -200(%rbp)
+	cmpl $100, -4(%rbp)
+	jae .L120
+	.p2align 4,,10
+.L119:
+	movl g0(%rip), %eax
+	cmpq $3, %rax
+	jne .L121
+	cmpq $0, -200(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	movabsq $656019486361, %rax
+	movq %rax, -56(%rbp)
+	cmpq $0, -56(%rbp)
+	je .LB2
+.L123:
+.L124:
+.L125:
+.L126:
+.L122:
+	movl $135, -112(%rbp)
+	addl $1, -4(%rbp)
+	cmpl $100, -4(%rbp)
+	jb .L119
+	jmp .L120
+.L121:
+	movl -4(%rbp), %eax
+	testb %al, %al
+	je .L125
+.L120:
+	cmpl $0, -48(%rbp)
+	je .L127
+	movl $894, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L128
+.L127:
+	movl $0, %eax
+.L128:
+	movq %rax, %r9
+	movzwl -14(%rbp), %eax
+	imull $6, %eax, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	movq %rax, %rdx
+	movzwl -42(%rbp), %eax
+	movq %rax, %rsi
+	movl $-24498, %eax
+	movq %rax, %rdi
+	call f1
+	movsbl %al, %eax
+	movw %ax, -14(%rbp)
+.L132:
+.L118:
+	movl -4(%rbp), %eax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L96:
+	movl $0, %eax
+.L97:
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L103
+	leaq .L104(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L98
+	# table target .L101
+	# table target .L102
+	# table target .L100
+	# table target .L99
+	jmp *%rcx
+.L117:
+	movl $6, %eax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	movq %rax, %r8
+	movl $166, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -14(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testb %al, %al
+	je .L129
+	movl -48(%rbp), %eax
+	imull -48(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $22057302133557330, %rax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -48(%rbp)
+.L129:
+.L130:
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movl $0, -4(%rbp)
+	movl -28(%rbp), %eax
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -204(%rbp)
+	cmpq $996, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -208(%rbp)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -216(%rbp)
+	movq -56(%rbp), %rax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	addq $715, %rax
+	movq %rax, -224(%rbp)
+	cmpl $5, -4(%rbp)
+	jae .L132
+	.p2align 4,,10
+.L131:
+	movl -80(%rbp), %eax
+	cmpl $32767, -12(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	imull %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L140
+	leaq .L141(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L139
+	# table target .L135
+	# table target .L136
+	# table target .L138
+	# table target .L134
+	# table target .L137
+	jmp *%rcx
+.L140:
+.L139:
+	movl -68(%rbp), %eax
+	testl %eax, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movl %ecx, -144(%rbp,%rax,4)
+.L133:
+	movl -76(%rbp), %eax
+	testl %eax, %eax
+	je .L146
+	movl g0(%rip), %eax
+	imull g0(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $762, %eax
+	xorl %edx, %edx
+	divl %ecx
+	cqo
+	idivq -216(%rbp)
+	testq %rax, %rax
+	je .L148
+	jmp .L132
+.L148:
+.L149:
+	movq -224(%rbp), %rax
+	movl %eax, -72(%rbp)
+	movl -4(%rbp), %eax
+	movl $3, -144(%rbp,%rax,4)
+.L146:
+.L147:
+	addl $1, -4(%rbp)
+	cmpl $5, -4(%rbp)
+	jb .L131
+	jmp .L132
+.L86:
+	cmpq $0, -24(%rbp)
+	jl .L85
+	cmpq $4, -24(%rbp)
+	jge .L85
+	movl -12(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+.L90:
+.L91:
+	jmp .L85
+.L99:
+	jmp .L98
+.L100:
+	movl $2, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jae .L98
+	.p2align 4,,10
+.L105:
+	cmpl $0, -28(%rbp)
+	je .L107
+.L106:
+	jmp .L98
+.L107:
+.L108:
+	addl $1, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L105
+	jmp .L98
+.L101:
+	jmp .L98
+.L102:
+	jmp .L98
+.L134:
+	movl -4(%rbp), %eax
+	xorl %edx, %edx
+	divl -204(%rbp)
+	testl %eax, %eax
+	je .L142
+	jmp .L133
+.L142:
+.L143:
+	imull $4294967293, g0(%rip), %eax
+	movw %ax, -42(%rbp)
+	jmp .L133
+.L135:
+	cmpl $0, g0(%rip)
+	je .L144
+	jmp .L133
+.L144:
+.L145:
+.L136:
+	addl $769, -12(%rbp)
+.L137:
+	movl -208(%rbp), %eax
+	movw %ax, -14(%rbp)
+	jmp .L133
+.L138:
+	movl -80(%rbp), %eax
+	movq %rax, %rdx
+	movl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl $-13817, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	imull -48(%rbp), %eax
+	movq %rax, %rcx
+	movzwl -14(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	jmp .L133
+.LB0:
+	movl -28(%rbp), %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	movq %rax, %rdx
+	movl -132(%rbp), %eax
+	movq %rax, %rsi
+	movl $-13817, %eax
+	movq %rax, %rdi
+	call f1
+	movsbl %al, %eax
+	jmp .f2_return
+.LB2:
+	movl -48(%rbp), %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl $453, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	jmp .f2_return
+.LB1:
+	movabsq $157778646797, %rax
+	jmp .f2_return
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L104:
+	.long .L101-.L104
+	.long .L98-.L104
+	.long .L98-.L104
+	.long .L98-.L104
+	.long .L98-.L104
+	.long .L102-.L104
+	.long .L100-.L104
+	.long .L101-.L104
+	.long .L99-.L104
+	.p2align 2
+.L141:
+	.long .L135-.L141
+	.long .L139-.L141
+	.long .L139-.L141
+	.long .L136-.L141
+	.long .L139-.L141
+	.long .L139-.L141
+	.long .L139-.L141
+	.long .L139-.L141
+	.long .L138-.L141
+	.long .L134-.L141
+	.long .L137-.L141
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
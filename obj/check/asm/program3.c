@@ -0,0 +1,457 @@
+unsigned short g0;
+int g1 = 420;
+unsigned char g2 = 4;
+int ga0[8];
+unsigned long f0(char p0) {
+    long v0 = 527;
+    unsigned short v1 = 9;
+    int i0 = 9;
+    long j0 = 3;
+    i0 = (((134 + g2) || !(j0)) <= p0);
+    for (i0 = 2; i0 < 8; i0 = i0 + 1) {
+        j0 = j0 + p0;
+        v0 = 5;
+    }
+    for (v0 = 2; v0 < 4; v0 = v0 + 1) {
+        switch ((unsigned long)((g0 - 597))) {
+        case 2:
+            p0 = g2;
+        case 9:
+        case 3:
+            for (j0 = 2; j0 < 17; j0 = j0 + 1) {
+                i0 = -((128 != (v0 - v1)));
+                i0 = !(((5 > 7) / 4));
+            }
+            v1 = v1 + g2;
+            break;
+        default:
+            break;
+        }
+    }
+    v0 = (v1 >= (unsigned short)(420));
+    if ((int)(i0)) {
+        v0 = (g0 && g1);
+        if (((p0 - g1) != !((unsigned int)(975)))) {
+            if ((((g0 <= 511) == p0) / (i0 * i0 + 1))) {
+                if ((v0 / (v0 * v0 + 1))) { return ((v1 < 37) * (65535L + v1)); }
+                if (((p0 / 2) + (unsigned short)(ga0[0]))) { return 916; }
+                if ((v1 / 8)) { return ((978569143918 >= v0) + !(p0)); }
+            } else {
+                v0 = !(!(0));
+            }
+            v0 = (unsigned short)(215900420900l);
+        } else {
+            if (((4 != g1) / 8)) {
+                p0 = ((ga0[2] == i0) >= g1);
+            }
+        }
+        if (2) {
+            for (v0 = 2; v0 < 5; v0 = v0 + 1) {
+                if ((7 <= ga0[7])) { return (1 < v1); }
+            }
+            if (((j0 >= j0) < (i0 / 10))) { return (ga0[5] > (j0 >= 9)); }
+        } else {
+            v1 = 6;
+        }
+    }
+    if ((374 + 2)) {
+        if (!(7)) {
+            switch (!(v1)) {
+            case 1:
+                if ((unsigned long)(4)) { return 2; }
+                i0 = ((unsigned char)(1010791982004) || (319556023905 < 29805311599));
+                break;
+            case 5:
+                j0 = j0 + 9;
+                if (((316 / (g1 * g1 + 1)) < -(ga0[2]))) { return (unsigned short)((641 + 7)); }
+                break;
+            default:
+            case 10:
+                j0 = (ga0[7] * ga0[6]);
+                if ((2 - (i0 > v1))) { return -((g1 < g2)); }
+            }
+            if (4) { return v1; }
+            if (((25410360274 + 1) + 9)) { return ((char)(p0) - ga0[6]); }
+        } else {
+            j0 = ((unsigned int)((127 / 13ul)) && (-(7) * (j0 || 9)));
+            switch (((unsigned int)(81757199135l) <= (j0 - 457U))) {
+            case 5:
+                p0 = (char)((g0 == (893 + g0)));
+                p0 = p0 + 5;
+            case 8:
+                j0 = (((j0 == 1) - (g2 / 8)) != ga0[0]);
+                if (g0) { return 1; }
+                break;
+            default:
+                if ((1 > v1)) { return -(p0); }
+                break;
+            case 3:
+                if (((ga0[1] / 1) >= 32767U)) { return ((v1 / 10) - !(g2)); }
+                v0 = !(855);
+                break;
+            }
+        }
+        if (!((738l < (697 / (i0 * i0 + 1))))) {
+            v0 = v0 + -(v0);
+        }
+        v0 = 394;
+    }
+    return ((short)(10) != 9);
+}
+unsigned long f1(unsigned char p0, long p1) {
+    long v0 = 7;
+    unsigned short v1 = 618570475325;
+    short v2 = 5;
+    unsigned int v3 = 3;
+    int i0 = 180;
+    long j0 = 7l;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 789911372794; }
+    p0 = (((v3 / 1024) * 759) - 252);
+    switch (1) {
+    case 0:
+        la0[13] = 4;
+        break;
+    case 350:
+        break;
+    }
+    if ((32767 / (v3 * v3 + 1))) {
+        v3 = 759;
+        v3 = (((short)(i0) - 890) || (unsigned long)((j0 * la0[15])));
+    }
+    if (i0 >= 0 && i0 < 16) { la0[i0] = ((9 * v0) < f0(g2)); }
+    for (v2 = 2; v2 < 17; v2 = v2 + 1) {
+        j0 = ((unsigned int)((159 == g0)) >= f0(i0));
+        p1 = 7;
+    }
+    if (g1 >= 0 && g1 < 16) { la0[g1] = (unsigned char)((i0 > 335912258467)); }
+    if (((ga0[6] > i0) - 979)) { return (g1 < p1); }
+    i0 = (unsigned short)(!((j0 > 4)));
+    return (((unsigned int)(v3) + f0(6ul)) * v2);
+}
+unsigned char f2(unsigned long p0, char p1, unsigned long p2) {
+    unsigned char v0 = 1;
+    long v1 = 938;
+    unsigned char v2 = 1096144327413;
+    int i0 = 9;
+    long j0 = 354401438484;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 124; }
+    switch (((g2 + 1) && -(9))) {
+    case 746:
+        p1 = (((i0 > 84353182446) || (i0 - i0)) / (v1 * v1 + 1));
+        if (!((240738037580 && (8 < p1)))) {
+            f1((unsigned long)(34ul), (895 == p0));
+            v2 = (j0 && 0);
+        }
+    case 55:
+        j0 = j0 + 0;
+        la0[9] = (p0 || (1000000007 * 0));
+        break;
+    case -4:
+        if (2) { return -(!(914)); }
+        p2 = i0;
+        break;
+    case 0:
+        v1 = 514748098295;
+        for (p2 = 1; p2 < 17; p2 = p2 + 1) {
+            if ((((2 <= 902L) >= (507 / 100)) == 316)) {
+                i0 = (((2l / 2) * j0) / 5l);
+                if (!(g2)) { break; }
+            }
+            if (la0[1]) {
+                v1 = v1 + (unsigned char)((v0 / (j0 * j0 + 1)));
+                if (((4 <= 6) != (short)(5))) { break; }
+            }
+            if (g1) { break; }
+        }
+        break;
+    case 5:
+        f1((142 / (p2 * p2 + 1)), (char)(891));
+    }
+    v1 = (f0(8) || 5);
+    p2 = p2 + !(f0(p2));
+    p2 = p2 + (p2 <= -(ga0[5]));
+    if (v2 >= 0 && v2 < 16) { la0[v2] = (f1(g2, 7) < la0[12]); }
+    v0 = ((j0 >= 177) - 7);
+    switch (-((unsigned short)(v0))) {
+    default:
+        v0 = !(0);
+        p1 = p1 + g1;
+        break;
+    case 9:
+    case 5:
+        if (g1) {
+            i0 = ((-(v1) + p2) / 3u);
+            v1 = (unsigned char)(j0);
+        }
+        f1(5, g1);
+        break;
+    }
+    v2 = !(f1(1000000007, g1));
+    return (((8L == v1) != f0(g2)) && g1);
+}
+void w2(unsigned short q0) {
+    g1 = g1 * 3 + q0;
+    ga0[3] = ga0[5] + q0;
+    g1 = g1 * 3 + q0;
+}
+short f3(short p0, unsigned long p1, int p2, unsigned char p3, unsigned short p4, long p5) {
+    unsigned short v0 = 208920611571;
+    unsigned long v1 = 71;
+    unsigned long v2 = 500;
+    char v3 = 846;
+    char v4 = 0;
+    char v5 = 4;
+    int i0 = 10;
+    long j0 = 8;
+    p4 = ((164 - 0ul) - -((v4 * p5)));
+    if (f0((unsigned char)(759))) {
+        switch (!((92098262871 + p2))) {
+        case -4:
+            break;
+        case 302:
+            break;
+        case 990:
+            p0 = (f2(619, 127, 950) > (unsigned short)(-(ga0[3])));
+            for (p5 = 0; p5 < 8; p5 = p5 + 1) {
+                v4 = (f0(i0) - (v5 + ga0[7]));
+            }
+        case 53:
+            v5 = !((unsigned int)((g0 - 184)));
+            v5 = g2;
+            break;
+        case 0:
+            if (6) {
+                f1(5, (ga0[1] * 2L));
+                i0 = (136L - ga0[4]);
+                f2((g2 - g1), p5, (v3 >= 105U));
+            } else {
+                v1 = (-((8 >= 9U)) <= (unsigned char)(ga0[6]));
+                f2((v5 >= i0), f0(7), f1(9, j0));
+                p3 = (32767 <= (103 && 4));
+            }
+            break;
+        case 745:
+            f2(f0(ga0[5]), (v0 - g1), 890);
+            p3 = (636 == (p5 == (g1 + ga0[3])));
+            break;
+        }
+        for (i0 = 1; i0 < 17; i0 = i0 + 1) {
+            v2 = (unsigned char)(f2(ga0[3], 127, i0));
+            if ((f1(5, p2) <= ((253 > 101) / (p3 * p3 + 1)))) {
+                j0 = ((v2 + p4) != (880u && v4));
+            } else {
+                if (((ga0[7] && g1) && (g0 - 3))) { break; }
+                if (!(1072191815468)) { break; }
+                if (5) { break; }
+            }
+        }
+    }
+    p5 = v4;
+    if (8) {
+        v0 = !(10);
+    }
+    v3 = v3 + g0;
+    j0 = -((!(p2) * (273002070701 && 6)));
+    return (f2(g2, 230572328593, i0) || ((10U - g1) - (0 == ga0[1])));
+}
+void w3(unsigned short q0, unsigned short q1) {
+    ga0[3] = ga0[7] + q0;
+}
+int rec(int n, int acc) {
+    if (n < 3 || n > 18) { return acc + n; }
+    return rec(n - 1, acc * 3 + n);
+}
+int main() {
+    int v0 = 1000000007;
+    unsigned short v1 = 8;
+    unsigned int v2 = 809;
+    unsigned int v3 = 705913589506;
+    unsigned char v4 = 394250367828;
+    int i0 = 954;
+    long j0 = 10;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    if (((8 < 4) / 16)) {
+        v4 = f0((127 || la0[0]));
+        v3 = !((v1 < v2));
+    } else {
+        switch (v3) {
+        default:
+            for (v0 = 0; v0 < 33; v0 = v0 + 1) {
+                g0 = ((9ul + !(v2)) / 2);
+            }
+            g0 = g0 + (ga0[5] + f0(g1));
+            break;
+        case 6:
+            break;
+        case 1:
+            v1 = (65535 < 921);
+            if (65536) {
+                w2(137);
+                g1 = (((32767 + v4) - (g1 > v4)) == ((3 && 256) == 6));
+            } else {
+                f2(10, v4, 561339248510u);
+                v3 = (f1(266147844700, 385) + ((0 < 65535) >= (5 / (v2 * v2 + 1))));
+                j0 = (unsigned long)((g2 / (g1 * g1 + 1)));
+            }
+        case 3:
+            break;
+        case 10:
+            la0[2] = g0;
+            v3 = (229 < !((8 || v4)));
+            break;
+        }
+        w3(20, 5);
+    }
+    i0 = la0[3];
+    for (j0 = 0; j0 < 100; j0 = j0 + 1) {
+        switch (!((unsigned char)(92))) {
+        case 11:
+            break;
+        case 1:
+            g2 = g2;
+            g2 = 8;
+            break;
+        case 29:
+            la0[3] = (char)(839);
+            break;
+        case 846:
+            g2 = ((short)(2) < 2);
+            f2(!(9), g1, (120ul >= v0));
+            break;
+        case 529:
+            g2 = !(rec(i0, g0));
+            break;
+        default:
+            break;
+        }
+    }
+    v2 = (((i0 / 10) && v3) <= ((445794995062 / 2) > (2 * g0)));
+    if ((f2(3, v0, v4) / 4)) {
+        if ((585 / (g0 * g0 + 1))) {
+            v3 = v3 + (g2 && i0);
+            if (-(957463203508)) {
+                w3(i0, g2);
+                w3(283, ga0[3]);
+            } else {
+                w2(j0);
+                j0 = j0 + ((j0 - g0) / (g1 * g1 + 1));
+            }
+        } else {
+            if (v2) { return (short)((unsigned short)(g2)); }
+        }
+        v4 = i0;
+        la0[0] = ((8 / (v3 * v3 + 1)) - 65535U);
+    } else {
+        g2 = g1;
+        for (v2 = 0; v2 < 33; v2 = v2 + 1) {
+            g1 = g0;
+            i0 = i0 + 2;
+        }
+        g2 = 911;
+    }
+    if ((51l >= -((118573055835 + 4)))) {
+        v2 = ((g2 && ga0[7]) < ((j0 / (g2 * g2 + 1)) == v3));
+        switch ((7 + f1(9L, g2))) {
+        case 5:
+        case 2:
+            f1(f1(7L, g1), (0 != v3));
+            g0 = f1((g1 && v4), (v1 || v2));
+        case 7:
+        case 8:
+            v3 = -(((10 || 964l) / 2));
+            break;
+        case 3:
+            break;
+        case 4:
+            v0 = (int)(!(j0));
+            if (i0 >= 0 && i0 < 4) { la0[i0] = g1; }
+            break;
+        default:
+            j0 = 248;
+            break;
+        }
+    } else {
+        if (((char)(f2(1040391187976, 602, 8)) >= (int)(133860254262))) {
+            if ((9 - i0)) {
+                i0 = ((!(v4) + (224 / 2)) + (65536 < (4294967295 + v3)));
+                v2 = -(f2(la0[3], g0, 738));
+            } else {
+                w2(j0);
+                w2(v2);
+            }
+            g0 = ((ga0[7] - 3) + -(!(g2)));
+            g1 = 10;
+        } else {
+            if (1002305541000) {
+                w3(2, 19714093663);
+            }
+            switch (((10U == g1) < f0(786))) {
+            case 2:
+            case 5:
+                w3(g0, 391);
+                w2(v4);
+                break;
+            default:
+                w2(314007387969l);
+                break;
+            }
+            v1 = ((j0 - (g0 || 358468971327)) / (g2 * g2 + 1));
+        }
+        g2 = ga0[0];
+        switch ((f1(v1, 840) <= -(g2))) {
+        case 9:
+        case 6:
+        default:
+            g2 = v3;
+            for (j0 = 0; j0 < 5; j0 = j0 + 1) {
+                i0 = (2 + (10 / (i0 * i0 + 1)));
+            }
+            break;
+        case 3:
+            break;
+        }
+    }
+    switch (((i0 / (v0 * v0 + 1)) && !(g1))) {
+    case 525:
+        v3 = (i0 / (v3 * v3 + 1));
+        if ((i0 - !(3))) {
+            for (v3 = 2; v3 < 4; v3 = v3 + 1) {
+                if ((unsigned char)(10)) { break; }
+                v4 = ((v1 <= g2) > (j0 == f0(1)));
+                j0 = 10;
+            }
+            if (f2((5 / (i0 * i0 + 1)), -(g2), (548 > 65536))) {
+                v2 = (((132 - g1) == rec(ga0[4], i0)) && ((long)(109) < f3(j0, 588, ga0[2], 583u, 4, 0)));
+                w3(7, v2);
+                la0[3] = (8ul <= (1 == v4));
+            }
+        }
+    case 21:
+        break;
+    case -4:
+        for (v0 = 1; v0 < 17; v0 = v0 + 1) {
+            for (j0 = 2; j0 < 100; j0 = j0 + 1) {
+                if (rec(la0[0], v3)) { break; }
+            }
+        }
+        break;
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,3403 @@
+	.section .data
+	.type g1, @object
+	.size g1, 4
+	.p2align 2
+g1:
+	.long 420
+	.type g2, @object
+	.size g2, 1
+	.p2align 0
+g2:
+	.byte 4
+	.section .bss
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.section .text
+	.type rec, @function
+	.type f0, @function
+	.type f1, @function
+	.type f2, @function
+	.type f2.constprop.2, @function
+	.type f2.constprop.0, @function
+	.type f2.constprop.1, @function
+	.type f3, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $3, -8(%rbp)
+	jl .L2
+	cmpl $18, -8(%rbp)
+	jg .L2
+.L0:
+.L1:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L2:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb %dil, -43(%rbp)
+	movw $9, -42(%rbp)
+	movq $3, -16(%rbp)
+	movzbl g2(%rip), %eax
+	addl $134, %eax
+	jne .L3
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L4
+.L3:
+	movl $1, %eax
+.L4:
+	movsbl %dil, %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movsbq %dil, %rax
+	movq %rax, -8(%rbp)
+	addq %rax, -16(%rbp)
+	movq -8(%rbp), %rax
+	addq %rax, -16(%rbp)
+	movq -8(%rbp), %rax
+	addq %rax, -16(%rbp)
+	movq -8(%rbp), %rax
+	addq %rax, -16(%rbp)
+	movq -8(%rbp), %rax
+	addq %rax, -16(%rbp)
+	movq -8(%rbp), %rax
+	addq %rax, -16(%rbp)
+	movl $8, -40(%rbp)
+	movq $2, -24(%rbp)
+	movl $0, -36(%rbp)
+	cmpq $4, -24(%rbp)
+	jge .L6
+	.p2align 4,,10
+.L5:
+	movzwl g0(%rip), %eax
+	subl $597, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L8
+	cmpq $3, %rax
+	je .L9
+	cmpq $9, %rax
+	je .L9
+.L10:
+	jmp .L7
+.L8:
+	movzbl g2(%rip), %eax
+	movb %al, -43(%rbp)
+.L9:
+	movq $2, -16(%rbp)
+	movq -24(%rbp), %rax
+	movzwl -42(%rbp), %ecx
+	subq %rcx, %rax
+	cmpq $128, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -32(%rbp)
+	movl -36(%rbp), %eax
+	movl %eax, -28(%rbp)
+	cmpq $17, -16(%rbp)
+	jge .L11
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L14
+	.p2align 4,,10
+.L13:
+	movl -32(%rbp), %eax
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	movl -32(%rbp), %eax
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	movl -32(%rbp), %eax
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	movl -32(%rbp), %eax
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	addq $1, -16(%rbp)
+	subq $1, -8(%rbp)
+	jne .L13
+.L14:
+.L11:
+.L12:
+	cmpq $17, -16(%rbp)
+	jge .L16
+	.p2align 4,,10
+.L15:
+	movl -32(%rbp), %eax
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L15
+.L16:
+	movzwl -42(%rbp), %eax
+	movzbl g2(%rip), %ecx
+	addl %ecx, %eax
+	movw %ax, -42(%rbp)
+.L7:
+	addq $1, -24(%rbp)
+	cmpq $4, -24(%rbp)
+	jl .L5
+.L6:
+	movzwl -42(%rbp), %eax
+	movl %eax, -28(%rbp)
+	cmpl $420, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	cmpl $0, -40(%rbp)
+	je .L17
+	cmpw $0, g0(%rip)
+	je .L19
+	cmpl $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L20
+.L19:
+	movl $0, %eax
+.L20:
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movsbl -43(%rbp), %eax
+	movl %eax, -8(%rbp)
+	subl g1(%rip), %eax
+	je .L21
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cmpl $511, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl -8(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L23
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB0
+.L25:
+.L26:
+	movl ga0+0(%rip), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	jne .LB1
+.L27:
+.L28:
+	movl -28(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .LB2
+.L29:
+.L30:
+	jmp .L24
+.L23:
+.L24:
+.L31:
+.L32:
+.L22:
+	cmpl $1, -28(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	movl ga0+28(%rip), %eax
+	cmpl $7, %eax
+	jge .LB3
+.L33:
+.L34:
+	movl ga0+28(%rip), %eax
+	cmpl $7, %eax
+	jge .LB4
+.L35:
+.L36:
+	movl ga0+28(%rip), %eax
+	cmpl $7, %eax
+	jge .LB5
+.L37:
+.L38:
+	movq $5, -24(%rbp)
+	movl -40(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jl .LB6
+.L39:
+.L40:
+.L17:
+.L18:
+	cmpq $0, -16(%rbp)
+	jne .L41
+	movl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L42
+.L41:
+	movl $1, %eax
+.L42:
+	imull $-7, %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	subq $457, %rax
+	cmpq $152820511, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L47
+	cmpq $5, %rax
+	je .L44
+	cmpq $8, %rax
+	je .L45
+.L46:
+	cmpl $1, -28(%rbp)
+	jl .LB7
+.L50:
+.L51:
+	jmp .L43
+.L47:
+	movl ga0+4(%rip), %eax
+	cmpl $32767, %eax
+	jae .LB8
+.L52:
+.L53:
+	movq $0, -24(%rbp)
+.L43:
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $697, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $738, %rax
+	jg .L54
+	xorl %eax, %eax
+	subq -24(%rbp), %rax
+	addq %rax, -24(%rbp)
+.L54:
+.L55:
+	movl $1, %eax
+.f0_return:
+	leave
+	ret
+.L21:
+	cmpl $4, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L31
+	movl ga0+8(%rip), %eax
+	cmpl -40(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl g1(%rip), %eax
+	setge %al
+	movzbl %al, %eax
+	movb %al, -43(%rbp)
+	jmp .L32
+.L44:
+	movzwl g0(%rip), %eax
+	addl $893, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -43(%rbp)
+	movsbl -43(%rbp), %eax
+	addl $5, %eax
+.L45:
+	movzbl g2(%rip), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	cmpq $1, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movl ga0+0(%rip), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpw $0, g0(%rip)
+	jne .LB9
+.L48:
+.L49:
+	jmp .L43
+.LB3:
+	movslq -8(%rbp), %rax
+	jmp .f0_return
+.LB8:
+	cmpb $0, g2(%rip)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -28(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	jmp .f0_return
+.LB4:
+	movslq -8(%rbp), %rax
+	jmp .f0_return
+.LB9:
+	movl $1, %eax
+	jmp .f0_return
+.LB5:
+	movslq -8(%rbp), %rax
+	jmp .f0_return
+.LB6:
+	movl ga0+20(%rip), %eax
+	cmpq $9, -16(%rbp)
+	setge %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f0_return
+.LB0:
+	movzwl -42(%rbp), %eax
+	addq $65535, %rax
+	movq %rax, %rcx
+	cmpl $37, -28(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	imulq %rcx, %rax
+	jmp .f0_return
+.LB1:
+	movl $916, %eax
+	jmp .f0_return
+.LB7:
+	xorl %eax, %eax
+	movsbl -43(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	jmp .f0_return
+.LB2:
+	cmpb $0, -43(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movabsq $978569143918, %rax
+	cmpq -24(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movq $7, -24(%rbp)
+	movw $26429, -26(%rbp)
+	movw $5, -28(%rbp)
+	movl $3, -32(%rbp)
+	movl $180, -36(%rbp)
+	movq $7, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L56
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -120(%rbp)
+	cmpq $0, -120(%rbp)
+	je .L59
+	.p2align 4,,10
+.L58:
+	movslq -36(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movabsq $789911372794, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movabsq $789911372794, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movabsq $789911372794, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movabsq $789911372794, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -120(%rbp)
+	jne .L58
+.L59:
+.L56:
+.L57:
+	cmpl $16, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -156(%rbp)
+	testl %eax, %eax
+	je .L61
+	.p2align 4,,10
+.L60:
+	movslq -36(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movabsq $789911372794, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -168(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -156(%rbp)
+	testl %eax, %eax
+	jne .L60
+.L61:
+	movl -32(%rbp), %eax
+	shrl $10, %eax
+	imull $759, %eax, %eax
+	subl $252, %eax
+	movb %al, -1(%rbp)
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L63
+	cmpq $350, %rax
+	je .L62
+	jmp .L62
+.L63:
+	movl $4, -60(%rbp)
+.L62:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $32767, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	je .L65
+	movl $759, -32(%rbp)
+	movl -36(%rbp), %eax
+	movswl %ax, %eax
+	subl $890, %eax
+	jne .L67
+	movl -52(%rbp), %eax
+	movslq %eax, %rax
+	imulq -48(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L68
+.L67:
+	movl $1, %eax
+.L68:
+	movl %eax, -32(%rbp)
+.L65:
+.L66:
+	cmpl $0, -36(%rbp)
+	jl .L69
+	cmpl $0, -156(%rbp)
+	je .L69
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	imulq $9, -24(%rbp), %rax
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L69:
+.L70:
+	movw $2, -28(%rbp)
+	movswl -28(%rbp), %eax
+	movl %eax, -172(%rbp)
+	cmpl $17, %eax
+	jge .L72
+	.p2align 4,,10
+.L71:
+	movl -36(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cmpl $159, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movq $7, -16(%rbp)
+	movl -172(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -28(%rbp)
+	movswl -28(%rbp), %eax
+	movl %eax, -172(%rbp)
+	cmpl $17, %eax
+	jl .L71
+.L72:
+	cmpl $0, g1(%rip)
+	jl .L73
+	cmpl $16, g1(%rip)
+	jge .L73
+	movslq -36(%rbp), %rax
+	movabsq $335912258467, %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq g1(%rip), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L73:
+.L74:
+	movl ga0+24(%rip), %eax
+	cmpl -36(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	subl $979, %eax
+	je .L75
+	movslq g1(%rip), %rax
+	cmpq -16(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L64:
+	jmp .L62
+.L75:
+.L76:
+	cmpq $4, -48(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movzwl %ax, %eax
+	movl %eax, -36(%rbp)
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	addq %rcx, %rax
+	movswq -28(%rbp), %rcx
+	imulq %rcx, %rax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movq %rdi, -8(%rbp)
+	movb %sil, -9(%rbp)
+	movq %rdx, -24(%rbp)
+	movb $1, -25(%rbp)
+	movq $938, -40(%rbp)
+	movb $245, -41(%rbp)
+	movl $9, -48(%rbp)
+	movabsq $354401438484, %rax
+	movq %rax, -56(%rbp)
+	movl $0, -48(%rbp)
+	imull $124, -48(%rbp), %eax
+	subl $124, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -48(%rbp)
+	jge .L77
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L80
+	.p2align 4,,10
+.L79:
+	addl $124, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $124, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $124, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $124, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -144(%rbp)
+	jne .L79
+.L80:
+.L77:
+.L78:
+	cmpl $16, -48(%rbp)
+	jge .L82
+	.p2align 4,,10
+.L81:
+	addl $124, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L81
+.L82:
+	movzbl g2(%rip), %eax
+	addl $1, %eax
+	je .L89
+	xorl %eax, %eax
+	subl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L90
+.L89:
+	movl $0, %eax
+.L90:
+	movslq %eax, %rax
+	cmpq $5, %rax
+	jge .L91
+	cmpq $-4, %rax
+	je .L86
+	cmpq $0, %rax
+	je .L87
+	jmp .L83
+.L91:
+	cmpq $5, %rax
+	je .L88
+	cmpq $55, %rax
+	je .L85
+	cmpq $746, %rax
+	je .L84
+	jmp .L83
+.L86:
+	movl $2, %eax
+	testl %eax, %eax
+	jne .LB10
+.L101:
+.L102:
+	movslq -48(%rbp), %rax
+	movq %rax, -24(%rbp)
+	jmp .L83
+.L111:
+.L112:
+.L109:
+.L110:
+	cmpl $0, g1(%rip)
+	je .L113
+.L104:
+.L83:
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	jne .L115
+	movl $5, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L116
+.L115:
+	movl $1, %eax
+.L116:
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	xorl %eax, %eax
+	movl ga0+20(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	movzbl -41(%rbp), %eax
+	movl %eax, -176(%rbp)
+	testl %eax, %eax
+	jl .L117
+	cmpl $16, -176(%rbp)
+	jge .L117
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	movq %rax, %rsi
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -41(%rbp), %eax
+	movl %ecx, -128(%rbp,%rax,4)
+.L117:
+.L118:
+	cmpq $177, -56(%rbp)
+	setge %al
+	movzbl %al, %eax
+	subl $7, %eax
+	movb %al, -25(%rbp)
+	movzbl -25(%rbp), %eax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L121
+	cmpq $9, %rax
+	je .L121
+.L120:
+	xorl %eax, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -25(%rbp)
+	movsbl -9(%rbp), %eax
+	addl g1(%rip), %eax
+	movb %al, -9(%rbp)
+	jmp .L119
+.L121:
+	cmpl $0, g1(%rip)
+	je .L122
+	xorl %eax, %eax
+	subq -40(%rbp), %rax
+	addq -24(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -48(%rbp)
+	movq -56(%rbp), %rax
+	movzbl %al, %eax
+	movq %rax, -40(%rbp)
+.L122:
+.L123:
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+.L119:
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f1
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -41(%rbp)
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	cmpq $8, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	je .L124
+	cmpl $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L125
+.L124:
+	movl $0, %eax
+.L125:
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L88:
+	movl $123, %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $142, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rdi
+	call f1
+	jmp .L83
+.L113:
+.L114:
+	addq $1, -24(%rbp)
+	cmpq $17, -24(%rbp)
+	jb .L103
+	jmp .L104
+.L87:
+	movabsq $514748098295, %rax
+	movq %rax, -40(%rbp)
+	movq $1, -24(%rbp)
+	movl $507, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	cmpq $902, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpl $316, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -148(%rbp)
+	movl $2, %eax
+	leaq 1(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $1, %rcx
+	movq %rcx, %rax
+	imulq -56(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -160(%rbp)
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -168(%rbp)
+	movl $4, %eax
+	cmpl $6, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl $5, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -172(%rbp)
+	cmpq $17, -24(%rbp)
+	jae .L104
+	.p2align 4,,10
+.L103:
+	cmpl $0, -148(%rbp)
+	je .L105
+	movq -160(%rbp), %rax
+	movl %eax, -48(%rbp)
+	cmpb $0, g2(%rip)
+	jne .L107
+	jmp .L104
+.L107:
+.L108:
+.L105:
+.L106:
+	movl -124(%rbp), %eax
+	testl %eax, %eax
+	je .L109
+	movzbl -25(%rbp), %eax
+	cqo
+	idivq -168(%rbp)
+	movzbl %al, %eax
+	addq %rax, -40(%rbp)
+	cmpl $0, -172(%rbp)
+	je .L111
+	jmp .L104
+.L97:
+	movl $0, %eax
+.L98:
+	movb %al, -41(%rbp)
+.L94:
+.L95:
+.L85:
+	addq $0, -56(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .L99
+	movl $1000000007, %eax
+	imull $0, %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L100
+.L99:
+	movl $1, %eax
+.L100:
+	movl %eax, -92(%rbp)
+	jmp .L83
+.L84:
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movslq -48(%rbp), %rax
+	movabsq $84353182446, %rcx
+	cmpq %rcx, %rax
+	jg .L92
+	movl -48(%rbp), %eax
+	subl -48(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L93
+.L92:
+	movl $1, %eax
+.L93:
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movb %al, -9(%rbp)
+	movabsq $240738037580, %rax
+	testq %rax, %rax
+	je .L96
+	movsbl -9(%rbp), %eax
+	cmpl $8, %eax
+	jg .L94
+.L96:
+	cmpq $895, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl $34, %eax
+	movq %rax, %rdi
+	call f1
+	cmpq $0, -56(%rbp)
+	je .L97
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L98
+.LB10:
+	movl $914, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.align 16
+f2.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movb $1, -17(%rbp)
+	movq $938, -32(%rbp)
+	movb $245, -33(%rbp)
+	movl $9, -40(%rbp)
+	movabsq $354401438484, %rax
+	movq %rax, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $124, -40(%rbp), %eax
+	subl $124, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -40(%rbp)
+	jge .L126
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L129
+	.p2align 4,,10
+.L128:
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -128(%rbp)
+	jne .L128
+.L129:
+.L126:
+.L127:
+	cmpl $16, -40(%rbp)
+	jge .L131
+	.p2align 4,,10
+.L130:
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L130
+.L131:
+	movzbl g2(%rip), %eax
+	addl $1, %eax
+	je .L138
+	movl $-9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L139
+.L138:
+	movl $0, %eax
+.L139:
+	movslq %eax, %rax
+	cmpq $5, %rax
+	jge .L140
+	cmpq $-4, %rax
+	je .L135
+	cmpq $0, %rax
+	je .L136
+	jmp .L132
+.L140:
+	cmpq $5, %rax
+	je .L137
+	cmpq $55, %rax
+	je .L134
+	cmpq $746, %rax
+	je .L133
+	jmp .L132
+.L136:
+	movabsq $514748098295, %rax
+	movq %rax, -32(%rbp)
+	movq $1, -16(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -136(%rbp)
+	cmpq $17, -16(%rbp)
+	jae .L148
+	.p2align 4,,10
+.L147:
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	je .L149
+	movzbl -17(%rbp), %eax
+	cqo
+	idivq -136(%rbp)
+	movzbl %al, %eax
+	addq %rax, -32(%rbp)
+.L148:
+.L132:
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	jne .L153
+	movl $5, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L154
+.L153:
+	movl $1, %eax
+.L154:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	xorl %eax, %eax
+	movl ga0+20(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	movzbl -33(%rbp), %eax
+	movl %eax, -140(%rbp)
+	testl %eax, %eax
+	jl .L155
+	cmpl $16, -140(%rbp)
+	jge .L155
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	movq %rax, %rsi
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -33(%rbp), %eax
+	movl %ecx, -112(%rbp,%rax,4)
+.L155:
+.L156:
+	cmpq $177, -48(%rbp)
+	setge %al
+	movzbl %al, %eax
+	subl $7, %eax
+	movb %al, -17(%rbp)
+	movzbl -17(%rbp), %eax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L159
+	cmpq $9, %rax
+	je .L159
+.L158:
+	movb $1, -17(%rbp)
+	movsbl -1(%rbp), %eax
+	addl g1(%rip), %eax
+	movb %al, -1(%rbp)
+	jmp .L157
+.L159:
+	cmpl $0, g1(%rip)
+	je .L160
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	addq -16(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -40(%rbp)
+	movq -48(%rbp), %rax
+	movzbl %al, %eax
+	movq %rax, -32(%rbp)
+.L160:
+.L161:
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+.L157:
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f1
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -33(%rbp)
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	cmpq $8, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	je .L162
+	cmpl $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L163
+.L162:
+	movl $0, %eax
+.L163:
+.f2.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L149:
+.L150:
+	cmpl $0, g1(%rip)
+	je .L151
+	jmp .L148
+.L151:
+.L152:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jb .L147
+	jmp .L148
+.L137:
+	movl $123, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $142, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rdi
+	call f1
+	jmp .L132
+.L145:
+	movl $0, %eax
+.L146:
+	movb %al, -33(%rbp)
+.L143:
+.L144:
+.L134:
+	movl $0, -76(%rbp)
+	jmp .L132
+.L133:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movslq -40(%rbp), %rax
+	movabsq $84353182446, %rcx
+	cmpq %rcx, %rax
+	jg .L141
+	movl -40(%rbp), %eax
+	subl -40(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L142
+.L141:
+	movl $1, %eax
+.L142:
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movb %al, -1(%rbp)
+	movsbl -1(%rbp), %eax
+	cmpl $8, %eax
+	jg .L143
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl $34, %eax
+	movq %rax, %rdi
+	call f1
+	cmpq $0, -48(%rbp)
+	je .L145
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L146
+.L135:
+	movl $0, %eax
+	jmp .f2.constprop.2_return
+	.size f2.constprop.2, .-f2.constprop.2
+	.align 16
+f2.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movb $1, -17(%rbp)
+	movq $938, -32(%rbp)
+	movb $245, -33(%rbp)
+	movl $9, -40(%rbp)
+	movabsq $354401438484, %rax
+	movq %rax, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $124, -40(%rbp), %eax
+	subl $124, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -40(%rbp)
+	jge .L164
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L167
+	.p2align 4,,10
+.L166:
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -128(%rbp)
+	jne .L166
+.L167:
+.L164:
+.L165:
+	cmpl $16, -40(%rbp)
+	jge .L169
+	.p2align 4,,10
+.L168:
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L168
+.L169:
+	movzbl g2(%rip), %eax
+	addl $1, %eax
+	je .L176
+	movl $-9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L177
+.L176:
+	movl $0, %eax
+.L177:
+	movslq %eax, %rax
+	cmpq $5, %rax
+	jge .L178
+	cmpq $-4, %rax
+	je .L173
+	cmpq $0, %rax
+	je .L174
+	jmp .L170
+.L178:
+	cmpq $5, %rax
+	je .L175
+	cmpq $55, %rax
+	je .L172
+	cmpq $746, %rax
+	je .L171
+	jmp .L170
+.L174:
+	movabsq $514748098295, %rax
+	movq %rax, -32(%rbp)
+	movq $1, -16(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -136(%rbp)
+	cmpq $17, -16(%rbp)
+	jae .L186
+	.p2align 4,,10
+.L185:
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	je .L187
+	movzbl -17(%rbp), %eax
+	cqo
+	idivq -136(%rbp)
+	movzbl %al, %eax
+	addq %rax, -32(%rbp)
+.L186:
+.L170:
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	jne .L191
+	movl $5, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L192
+.L191:
+	movl $1, %eax
+.L192:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	xorl %eax, %eax
+	movl ga0+20(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	movzbl -33(%rbp), %eax
+	movl %eax, -140(%rbp)
+	testl %eax, %eax
+	jl .L193
+	cmpl $16, -140(%rbp)
+	jge .L193
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	movq %rax, %rsi
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -33(%rbp), %eax
+	movl %ecx, -112(%rbp,%rax,4)
+.L193:
+.L194:
+	cmpq $177, -48(%rbp)
+	setge %al
+	movzbl %al, %eax
+	subl $7, %eax
+	movb %al, -17(%rbp)
+	movzbl -17(%rbp), %eax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L197
+	cmpq $9, %rax
+	je .L197
+.L196:
+	movb $1, -17(%rbp)
+	movsbl -1(%rbp), %eax
+	addl g1(%rip), %eax
+	movb %al, -1(%rbp)
+	jmp .L195
+.L197:
+	cmpl $0, g1(%rip)
+	je .L198
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	addq -16(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -40(%rbp)
+	movq -48(%rbp), %rax
+	movzbl %al, %eax
+	movq %rax, -32(%rbp)
+.L198:
+.L199:
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+.L195:
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f1
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -33(%rbp)
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	cmpq $8, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	je .L200
+	cmpl $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L201
+.L200:
+	movl $0, %eax
+.L201:
+.f2.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L187:
+.L188:
+	cmpl $0, g1(%rip)
+	je .L189
+	jmp .L186
+.L189:
+.L190:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jb .L185
+	jmp .L186
+.L175:
+	movl $123, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $142, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rdi
+	call f1
+	jmp .L170
+.L183:
+	movl $0, %eax
+.L184:
+	movb %al, -33(%rbp)
+.L181:
+.L182:
+.L172:
+	movl $1, -76(%rbp)
+	jmp .L170
+.L171:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movslq -40(%rbp), %rax
+	movabsq $84353182446, %rcx
+	cmpq %rcx, %rax
+	jg .L179
+	movl -40(%rbp), %eax
+	subl -40(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L180
+.L179:
+	movl $1, %eax
+.L180:
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movb %al, -1(%rbp)
+	movsbl -1(%rbp), %eax
+	cmpl $8, %eax
+	jg .L181
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl $34, %eax
+	movq %rax, %rdi
+	call f1
+	cmpq $0, -48(%rbp)
+	je .L183
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L184
+.L173:
+	movl $0, %eax
+	jmp .f2.constprop.0_return
+	.size f2.constprop.0, .-f2.constprop.0
+	.align 16
+f2.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movb $1, -17(%rbp)
+	movq $938, -32(%rbp)
+	movb $245, -33(%rbp)
+	movl $9, -40(%rbp)
+	movabsq $354401438484, %rax
+	movq %rax, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $124, -40(%rbp), %eax
+	subl $124, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -40(%rbp)
+	jge .L202
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L205
+	.p2align 4,,10
+.L204:
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -128(%rbp)
+	jne .L204
+.L205:
+.L202:
+.L203:
+	cmpl $16, -40(%rbp)
+	jge .L207
+	.p2align 4,,10
+.L206:
+	addl $124, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L206
+.L207:
+	movzbl g2(%rip), %eax
+	addl $1, %eax
+	je .L214
+	movl $-9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L215
+.L214:
+	movl $0, %eax
+.L215:
+	movslq %eax, %rax
+	cmpq $5, %rax
+	jge .L216
+	cmpq $-4, %rax
+	je .L211
+	cmpq $0, %rax
+	je .L212
+	jmp .L208
+.L216:
+	cmpq $5, %rax
+	je .L213
+	cmpq $55, %rax
+	je .L210
+	cmpq $746, %rax
+	je .L209
+	jmp .L208
+.L212:
+	movabsq $514748098295, %rax
+	movq %rax, -32(%rbp)
+	movq $1, -16(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -136(%rbp)
+	cmpq $17, -16(%rbp)
+	jae .L224
+	.p2align 4,,10
+.L223:
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	je .L225
+	movzbl -17(%rbp), %eax
+	cqo
+	idivq -136(%rbp)
+	movzbl %al, %eax
+	addq %rax, -32(%rbp)
+.L224:
+.L208:
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	jne .L229
+	movl $5, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L230
+.L229:
+	movl $1, %eax
+.L230:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	xorl %eax, %eax
+	movl ga0+20(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	movzbl -33(%rbp), %eax
+	movl %eax, -140(%rbp)
+	testl %eax, %eax
+	jl .L231
+	cmpl $16, -140(%rbp)
+	jge .L231
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	movq %rax, %rsi
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -33(%rbp), %eax
+	movl %ecx, -112(%rbp,%rax,4)
+.L231:
+.L232:
+	cmpq $177, -48(%rbp)
+	setge %al
+	movzbl %al, %eax
+	subl $7, %eax
+	movb %al, -17(%rbp)
+	movzbl -17(%rbp), %eax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L235
+	cmpq $9, %rax
+	je .L235
+.L234:
+	movb $1, -17(%rbp)
+	movsbl -1(%rbp), %eax
+	addl g1(%rip), %eax
+	movb %al, -1(%rbp)
+	jmp .L233
+.L235:
+	cmpl $0, g1(%rip)
+	je .L236
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	addq -16(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -40(%rbp)
+	movq -48(%rbp), %rax
+	movzbl %al, %eax
+	movq %rax, -32(%rbp)
+.L236:
+.L237:
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+.L233:
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f1
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -33(%rbp)
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	cmpq $8, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	je .L238
+	cmpl $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L239
+.L238:
+	movl $0, %eax
+.L239:
+.f2.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L225:
+.L226:
+	cmpl $0, g1(%rip)
+	je .L227
+	jmp .L224
+.L227:
+.L228:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jb .L223
+	jmp .L224
+.L213:
+	movl $123, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $142, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rdi
+	call f1
+	jmp .L208
+.L221:
+	movl $0, %eax
+.L222:
+	movb %al, -33(%rbp)
+.L219:
+.L220:
+.L210:
+	movl $1, -76(%rbp)
+	jmp .L208
+.L209:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movslq -40(%rbp), %rax
+	movabsq $84353182446, %rcx
+	cmpq %rcx, %rax
+	jg .L217
+	movl -40(%rbp), %eax
+	subl -40(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L218
+.L217:
+	movl $1, %eax
+.L218:
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movb %al, -1(%rbp)
+	movsbl -1(%rbp), %eax
+	cmpl $8, %eax
+	jg .L219
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl $34, %eax
+	movq %rax, %rdi
+	call f1
+	cmpq $0, -48(%rbp)
+	je .L221
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L222
+.L211:
+	movl $0, %eax
+	jmp .f2.constprop.1_return
+	.size f2.constprop.1, .-f2.constprop.1
+	.align 16
+f3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movl %esi, -40(%rbp)
+	movb %dl, -46(%rbp)
+	movq %r8, -24(%rbp)
+	movw $35571, -28(%rbp)
+	movb $78, -45(%rbp)
+	movb $0, -44(%rbp)
+	movb $4, -43(%rbp)
+	movl $10, -36(%rbp)
+	movsbq -44(%rbp), %rax
+	imulq %r8, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl $164, %eax
+	subq %rcx, %rax
+	movw %ax, -42(%rbp)
+	movl $-9, %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	je .L240
+	movslq -40(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movq %rax, %rcx
+	movabsq $92098262871, %rax
+	addq %rcx, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $302, %rax
+	jge .L249
+	cmpq $-4, %rax
+	je .L243
+	cmpq $0, %rax
+	je .L247
+	cmpq $53, %rax
+	je .L246
+	jmp .L242
+.L260:
+.L261:
+.L257:
+.L240:
+.L241:
+	movsbq -44(%rbp), %rax
+	movsbl -45(%rbp), %eax
+	movzwl g0(%rip), %ecx
+	addl %ecx, %eax
+	cmpl $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movslq -36(%rbp), %rax
+	movq %rax, %rdx
+	movl $-111, %eax
+	movq %rax, %rsi
+	movzbl g2(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	testb %al, %al
+	jne .L262
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl g1(%rip), %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	subl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L263
+.L262:
+	movl $1, %eax
+.L263:
+.f3_return:
+	leave
+	ret
+.L249:
+	cmpq $302, %rax
+	je .L242
+	cmpq $745, %rax
+	je .L248
+	cmpq $990, %rax
+	je .L245
+.L243:
+.L242:
+	movl $1, -36(%rbp)
+	movzbl -46(%rbp), %eax
+	movl %eax, -28(%rbp)
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -32(%rbp)
+	cmpb $0, -44(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	cmpl $17, -36(%rbp)
+	jge .L257
+	.p2align 4,,10
+.L256:
+	movslq -36(%rbp), %rax
+	movq %rax, %rdx
+	movl $127, %eax
+	movq %rax, %rsi
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f2
+	movzbl %al, %eax
+	movq %rax, -8(%rbp)
+	movl $1, %eax
+	cltd
+	idivl -32(%rbp)
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cmpq %rcx, %rax
+	ja .L258
+	movzwl -42(%rbp), %eax
+	addq -8(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.L259:
+	addl $1, -36(%rbp)
+	cmpl $17, -36(%rbp)
+	jl .L256
+	jmp .L257
+.L258:
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	je .L260
+	cmpl $0, g1(%rip)
+	je .L260
+	movzwl g0(%rip), %eax
+	subl $3, %eax
+	je .L260
+	jmp .L257
+.L244:
+	jmp .L242
+.L245:
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	movzwl %ax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $950, %eax
+	movq %rax, %rsi
+	movl $127, %eax
+	movq %rax, %rdi
+	call f2.constprop.0
+	addq $8, %rsp
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq $0, -24(%rbp)
+	cmpq $8, -24(%rbp)
+	jge .L250
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L253
+	.p2align 4,,10
+.L252:
+	movsbl -43(%rbp), %eax
+	movl %eax, -28(%rbp)
+	movl ga0+28(%rip), %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	movb %al, -32(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	subq %rcx, %rax
+	addq $1, -24(%rbp)
+	movl ga0+28(%rip), %eax
+	addl -28(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movsbl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	subq %rcx, %rax
+	addq $1, -24(%rbp)
+	movl ga0+28(%rip), %eax
+	addl -28(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movsbl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	subq %rcx, %rax
+	addq $1, -24(%rbp)
+	movl ga0+28(%rip), %eax
+	addl -28(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movsbl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	subq %rcx, %rax
+	movb %al, -44(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -8(%rbp)
+	jne .L252
+.L253:
+.L250:
+.L251:
+	cmpq $8, -24(%rbp)
+	jge .L255
+	.p2align 4,,10
+.L254:
+	movsbl -43(%rbp), %eax
+	movl ga0+28(%rip), %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	subq %rcx, %rax
+	movb %al, -44(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $8, -24(%rbp)
+	jl .L254
+.L255:
+.L246:
+	movzwl g0(%rip), %eax
+	subl $184, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movzbl g2(%rip), %eax
+	jmp .L242
+.L247:
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	salq $1, %rax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+	movl ga0+16(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $136, %eax
+	subq %rcx, %rax
+	movsbl -45(%rbp), %eax
+	cmpl $105, %eax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movzbl g2(%rip), %eax
+	subl g1(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f2
+	jmp .L242
+.L248:
+	movl $890, %eax
+	pushq %rax
+	movzwl -28(%rbp), %eax
+	subl g1(%rip), %eax
+	pushq %rax
+	movl ga0+20(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	call f2
+	movl ga0+12(%rip), %eax
+	addl g1(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $636, %eax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -46(%rbp)
+	jmp .L242
+	.size f3, .-f3
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movl $1000000007, -4(%rbp)
+	movw $8, -6(%rbp)
+	movl $809, -12(%rbp)
+	movl $1538952962, -16(%rbp)
+	movb $84, -17(%rbp)
+	movl $954, -24(%rbp)
+	movq $10, -32(%rbp)
+	movl $0, -24(%rbp)
+	movl $0, -48(%rbp)
+	movl $4, -44(%rbp)
+	movl $8, -40(%rbp)
+	movl $12, -36(%rbp)
+	movl $4, -24(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L270
+	leaq .L271(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L265
+	# table target .L267
+	# table target .L268
+	# table target .L266
+	# table target .L269
+	jmp *%rcx
+.L270:
+.L265:
+	movl $0, -4(%rbp)
+	cmpl $33, -4(%rbp)
+	jge .L272
+	movl $33, %eax
+	movslq -4(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -56(%rbp)
+	cmpq $0, -56(%rbp)
+	je .L275
+	.p2align 4,,10
+.L274:
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $9, %rax
+	shrq $1, %rax
+	movw %ax, g0(%rip)
+	addl $1, -4(%rbp)
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $9, %rax
+	shrq $1, %rax
+	movw %ax, g0(%rip)
+	addl $1, -4(%rbp)
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $9, %rax
+	shrq $1, %rax
+	movw %ax, g0(%rip)
+	addl $1, -4(%rbp)
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $9, %rax
+	shrq $1, %rax
+	movw %ax, g0(%rip)
+	addl $1, -4(%rbp)
+	subq $1, -56(%rbp)
+	jne .L274
+.L275:
+.L272:
+.L273:
+	cmpl $33, -4(%rbp)
+	jge .L277
+	.p2align 4,,10
+.L276:
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $9, %rax
+	shrq $1, %rax
+	movw %ax, g0(%rip)
+	addl $1, -4(%rbp)
+	cmpl $33, -4(%rbp)
+	jl .L276
+.L277:
+	movl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	addq %rcx, %rax
+	movw %ax, g0(%rip)
+.L264:
+	movl ga0+28(%rip), %eax
+	addl $20, %eax
+	movl %eax, ga0+12(%rip)
+.L279:
+	movl -36(%rbp), %eax
+	movl %eax, -24(%rbp)
+	movq $0, -32(%rbp)
+	movl $0, -64(%rbp)
+	movslq -4(%rbp), %rax
+	cmpq $120, %rax
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, -68(%rbp)
+	cmpq $100, -32(%rbp)
+	jge .L281
+	.p2align 4,,10
+.L280:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $29, %rax
+	jge .L289
+	cmpq $1, %rax
+	je .L284
+	cmpq $11, %rax
+	je .L282
+.L288:
+	jmp .L282
+.L289:
+	cmpq $29, %rax
+	je .L285
+	cmpq $529, %rax
+	je .L287
+	cmpq $846, %rax
+	je .L286
+	jmp .L282
+.L284:
+	movb $8, g2(%rip)
+.L282:
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jl .L280
+.L281:
+	movzwl g0(%rip), %eax
+	imull $2, %eax, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $222897497531, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -24(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L302
+	cmpl $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L303
+.L285:
+	movl $71, -36(%rbp)
+	jmp .L282
+.L302:
+	movl $0, %eax
+.L303:
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+	movzbl -17(%rbp), %eax
+	movq %rax, %rdx
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f2
+	movzbl %al, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L304
+	movzwl g0(%rip), %eax
+	movzwl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $585, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L306
+	cmpb $0, g2(%rip)
+	je .L308
+	cmpl $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L309
+.L283:
+	jmp .L282
+.L287:
+	movl -24(%rbp), %eax
+	movl %eax, -72(%rbp)
+	movzwl g0(%rip), %eax
+	movl %eax, -76(%rbp)
+	cmpl $3, -72(%rbp)
+	jl .L293
+	cmpl $18, -72(%rbp)
+	jle .L291
+.L293:
+	movl -76(%rbp), %eax
+	addl -72(%rbp), %eax
+.L290:
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movb %al, g2(%rip)
+	jmp .L282
+.L304:
+	movl g1(%rip), %eax
+	movb %al, g2(%rip)
+	movl $0, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jae .L314
+	movl $33, %eax
+	movl -12(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L317
+	.p2align 4,,10
+.L316:
+	movzwl g0(%rip), %eax
+	movl %eax, g1(%rip)
+	addl $2, -24(%rbp)
+	addl $1, -12(%rbp)
+	movzwl g0(%rip), %eax
+	movl %eax, g1(%rip)
+	addl $2, -24(%rbp)
+	addl $1, -12(%rbp)
+	movzwl g0(%rip), %eax
+	movl %eax, g1(%rip)
+	addl $2, -24(%rbp)
+	addl $1, -12(%rbp)
+	movzwl g0(%rip), %eax
+	movl %eax, g1(%rip)
+	addl $2, -24(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -112(%rbp)
+	jne .L316
+.L317:
+.L314:
+.L315:
+	cmpl $33, -12(%rbp)
+	jae .L319
+	.p2align 4,,10
+.L318:
+	movzwl g0(%rip), %eax
+	movl %eax, g1(%rip)
+	addl $2, -24(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jb .L318
+.L319:
+	movb $143, g2(%rip)
+.L305:
+	movzbl g2(%rip), %eax
+	movzbl g2(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cqo
+	idivq %rcx
+	movl -16(%rbp), %ecx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpb $0, g2(%rip)
+	je .L320
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L321
+.L320:
+	movl $0, %eax
+.L321:
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+	movzbl g2(%rip), %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f1
+	addq $7, %rax
+	leaq -2(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L328
+	leaq .L329(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L327
+	# table target .L323
+	# table target .L325
+	# table target .L326
+	# table target .L324
+	jmp *%rcx
+.L328:
+.L327:
+	movq $248, -32(%rbp)
+.L322:
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L340
+	cmpl $0, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	jmp .L341
+.L340:
+	movl $0, %eax
+.L341:
+	movslq %eax, %rax
+	cmpq $-4, %rax
+	je .L339
+	cmpq $21, %rax
+	je .L336
+	cmpq $525, %rax
+	je .L337
+	jmp .L336
+.L339:
+	movl $1, -4(%rbp)
+	cmpl $17, -4(%rbp)
+	jge .L364
+	.p2align 4,,10
+.L363:
+	movq $2, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jge .L366
+	.p2align 4,,10
+.L365:
+	movl -48(%rbp), %eax
+	movl %eax, -144(%rbp)
+	movl -16(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl $3, -144(%rbp)
+	jl .L372
+	cmpl $18, -144(%rbp)
+	jle .L370
+.L372:
+	movl -148(%rbp), %eax
+	addl -144(%rbp), %eax
+.L369:
+	testl %eax, %eax
+	je .L367
+.L366:
+	addl $1, -4(%rbp)
+	cmpl $17, -4(%rbp)
+	jl .L363
+.L364:
+.L336:
+	movq $0, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movslq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movzbl g2(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movslq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movzwl -6(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movl -16(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movzbl -17(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movslq -24(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jge .L381
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L384
+	.p2align 4,,10
+.L383:
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -184(%rbp)
+	jne .L383
+.L384:
+.L381:
+.L382:
+	cmpl $8, -24(%rbp)
+	jge .L386
+	.p2align 4,,10
+.L385:
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L385
+.L386:
+	movl $0, -24(%rbp)
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	movl $4, -24(%rbp)
+	movq -176(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -176(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -176(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	movq -176(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L367:
+.L368:
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jl .L365
+	jmp .L366
+.L370:
+.L371:
+	movl -144(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -152(%rbp)
+	imull $3, -148(%rbp), %eax
+	addl -144(%rbp), %eax
+	movl %eax, -156(%rbp)
+	cmpl $3, -152(%rbp)
+	jl .L376
+	cmpl $18, -152(%rbp)
+	jle .L374
+.L376:
+	movl -156(%rbp), %eax
+	addl -152(%rbp), %eax
+.L373:
+	jmp .L369
+.L374:
+.L375:
+	movl -152(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -160(%rbp)
+	imull $3, -156(%rbp), %eax
+	addl -152(%rbp), %eax
+	movl %eax, -164(%rbp)
+	cmpl $3, -160(%rbp)
+	jl .L380
+	cmpl $18, -160(%rbp)
+	jle .L378
+.L380:
+	movl -164(%rbp), %eax
+	addl -160(%rbp), %eax
+.L377:
+	jmp .L369
+.L286:
+	movl -64(%rbp), %eax
+	movb %al, g2(%rip)
+	movslq -68(%rbp), %rax
+	movq %rax, %rsi
+	movl g1(%rip), %eax
+	movq %rax, %rdi
+	call f2.constprop.2
+	jmp .L282
+.L378:
+.L379:
+	imull $3, -164(%rbp), %eax
+	addl -160(%rbp), %eax
+	movq %rax, %rsi
+	movl -160(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L369
+.L308:
+	movl $0, %eax
+.L309:
+	addl %eax, -16(%rbp)
+	movl -24(%rbp), %eax
+	movw %ax, -94(%rbp)
+	movzbl g2(%rip), %eax
+	movw %ax, -96(%rbp)
+	movl ga0+28(%rip), %eax
+	movzwl -94(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, ga0+12(%rip)
+.L310:
+	movl ga0+12(%rip), %eax
+	movw %ax, -98(%rbp)
+	movl ga0+28(%rip), %eax
+	addl $283, %eax
+	movl %eax, ga0+12(%rip)
+.L311:
+.L312:
+.L313:
+.L307:
+	movl -24(%rbp), %eax
+	movb %al, -17(%rbp)
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	xorl %edx, %edx
+	divl %ecx
+	subl $65535, %eax
+	movl %eax, -48(%rbp)
+	jmp .L305
+.L348:
+	movl $0, %eax
+.L349:
+	movl %eax, -12(%rbp)
+	movl -12(%rbp), %eax
+	movw %ax, -138(%rbp)
+	movl ga0+28(%rip), %eax
+	addl $7, %eax
+	movl %eax, ga0+12(%rip)
+.L362:
+	movzbl -17(%rbp), %eax
+	cmpl $1, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+.L346:
+.L347:
+.L342:
+.L343:
+.L338:
+	jmp .L336
+.L291:
+.L292:
+	movl -72(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -80(%rbp)
+	imull $3, -76(%rbp), %eax
+	addl -72(%rbp), %eax
+	movl %eax, -84(%rbp)
+	cmpl $3, -80(%rbp)
+	jl .L297
+	cmpl $18, -80(%rbp)
+	jle .L295
+.L297:
+	movl -84(%rbp), %eax
+	addl -80(%rbp), %eax
+.L294:
+	jmp .L290
+.L337:
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -16(%rbp)
+	cmpl $0, -24(%rbp)
+	je .L336
+	movl $2, -16(%rbp)
+	cmpl $4, -16(%rbp)
+	.p2align 4,,10
+.L344:
+.L345:
+	xorl %eax, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movzbl g2(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rdx
+	call f2
+	testb %al, %al
+	je .L336
+	movl ga0+16(%rip), %eax
+	movl %eax, -116(%rbp)
+	movl -24(%rbp), %eax
+	movl %eax, -120(%rbp)
+	cmpl $3, -116(%rbp)
+	jl .L353
+	cmpl $18, -116(%rbp)
+	jle .L351
+.L353:
+	movl -120(%rbp), %eax
+	addl -116(%rbp), %eax
+.L350:
+	movq %rax, %rcx
+	movl $132, %eax
+	subl g1(%rip), %eax
+	cmpl %ecx, %eax
+	jne .L348
+	xorl %eax, %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl $71, %eax
+	movq %rax, %rdx
+	movl ga0+8(%rip), %eax
+	movq %rax, %rsi
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f3
+	movswq %ax, %rax
+	cmpq $109, %rax
+	setg %al
+	movzbl %al, %eax
+	jmp .L349
+.L295:
+.L296:
+	movl -80(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -88(%rbp)
+	imull $3, -84(%rbp), %eax
+	addl -80(%rbp), %eax
+	movl %eax, -92(%rbp)
+	cmpl $3, -88(%rbp)
+	jl .L301
+	cmpl $18, -88(%rbp)
+	jle .L299
+.L301:
+	movl -92(%rbp), %eax
+	addl -88(%rbp), %eax
+.L298:
+	jmp .L290
+.L351:
+.L352:
+	movl -116(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -124(%rbp)
+	imull $3, -120(%rbp), %eax
+	addl -116(%rbp), %eax
+	movl %eax, -128(%rbp)
+	cmpl $3, -124(%rbp)
+	jl .L357
+	cmpl $18, -124(%rbp)
+	jle .L355
+.L357:
+	movl -128(%rbp), %eax
+	addl -124(%rbp), %eax
+.L354:
+	jmp .L350
+.L299:
+.L300:
+	imull $3, -92(%rbp), %eax
+	addl -88(%rbp), %eax
+	movq %rax, %rsi
+	movl -88(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L290
+.L355:
+.L356:
+	movl -124(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -132(%rbp)
+	imull $3, -128(%rbp), %eax
+	addl -124(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $3, -132(%rbp)
+	jl .L361
+	cmpl $18, -132(%rbp)
+	jle .L359
+.L361:
+	movl -136(%rbp), %eax
+	addl -132(%rbp), %eax
+.L358:
+	jmp .L350
+.L359:
+.L360:
+	imull $3, -136(%rbp), %eax
+	addl -132(%rbp), %eax
+	movq %rax, %rsi
+	movl -132(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L350
+.L266:
+	jmp .L264
+.L267:
+	movw $0, -6(%rbp)
+	imull $3, g1(%rip), %eax
+	addl $137, %eax
+	movl %eax, g1(%rip)
+	movl ga0+20(%rip), %eax
+	addl $137, %eax
+	movl %eax, ga0+12(%rip)
+	imull $3, g1(%rip), %eax
+	addl $137, %eax
+	movl %eax, g1(%rip)
+.L278:
+	movzbl -17(%rbp), %eax
+	movl %eax, -60(%rbp)
+	cmpl %eax, g1(%rip)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	addl $32767, %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, g1(%rip)
+.L268:
+	jmp .L264
+.L269:
+	movzwl g0(%rip), %eax
+	movl %eax, -40(%rbp)
+	movl $0, -16(%rbp)
+	jmp .L264
+.L323:
+	cmpl $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movslq g1(%rip), %rax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	call f1
+	cmpw $0, -6(%rbp)
+	jne .L330
+	cmpl $0, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L331
+.L330:
+	movl $1, %eax
+.L331:
+	movslq %eax, %rax
+	pushq %rax
+	cmpl $0, g1(%rip)
+	je .L332
+	cmpb $0, -17(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L333
+.L332:
+	movl $0, %eax
+.L333:
+	movq %rax, %rdi
+	popq %rsi
+	call f1
+	movw %ax, g0(%rip)
+.L324:
+	movl $0, -16(%rbp)
+	jmp .L322
+.L325:
+	jmp .L322
+.L326:
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -24(%rbp)
+	jl .L322
+	cmpl $4, -24(%rbp)
+	jge .L322
+	movslq -24(%rbp), %rax
+	movl g1(%rip), %ecx
+	movl %ecx, -48(%rbp,%rax,4)
+.L334:
+.L335:
+	jmp .L322
+.L306:
+	cmpl $0, -12(%rbp)
+	je .L312
+	movzbl g2(%rip), %eax
+	movswl %ax, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L271:
+	.long .L267-.L271
+	.long .L265-.L271
+	.long .L268-.L271
+	.long .L265-.L271
+	.long .L265-.L271
+	.long .L266-.L271
+	.long .L265-.L271
+	.long .L265-.L271
+	.long .L265-.L271
+	.long .L269-.L271
+	.p2align 2
+.L329:
+	.long .L323-.L329
+	.long .L325-.L329
+	.long .L326-.L329
+	.long .L323-.L329
+	.long .L327-.L329
+	.long .L324-.L329
+	.long .L324-.L329
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
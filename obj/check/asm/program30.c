@@ -0,0 +1,95 @@
+unsigned char g0;
+char g1;
+int ga0[33];
+char f0(unsigned int p0, short p1, char p2, unsigned int p3, short p4, unsigned short p5, int p6, short p7) {
+    unsigned long v0 = 283040091671;
+    unsigned int v1 = 614895738598;
+    int i0 = 483;
+    long j0 = 203065400016;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 81; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 6; }
+    if (p1 >= 0 && p1 < 33) { la0[p1] = 600; }
+    p4 = ((la0[23] - (ga0[15] - p6)) == ((p1 / (p7 * p7 + 1)) - (p6 <= v1)));
+    for (p0 = 2; p0 < 100; p0 = p0 + 1) {
+        v0 = ((-(7) - (j0 < p0)) + (2147483647 == (unsigned long)(p3)));
+        v1 = (10U - -(p5));
+        if (((p6 * p5) + (2 == 7))) { return (unsigned long)(-(255)); }
+    }
+    if (-((p1 != 6))) { return 7; }
+    if (((int)(v0) - p2)) { return (short)((8 / (p7 * p7 + 1))); }
+    return v0;
+}
+int main() {
+    char v0 = 10;
+    unsigned int v1 = 256;
+    char v2 = 6;
+    long v3 = 317941089006u;
+    int i0 = 828;
+    long j0 = 689ul;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 668; }
+    if (((g0 >= ga0[22]) / (v3 * v3 + 1))) {
+        f0((v2 + i0), (v1 + 6), (i0 + 378352696266), v1, f0(v3, j0, 2, v0, g1, 65535, 852, v0), (unsigned char)(921), j0, (117796474757L - 22L));
+    }
+    if (v1 >= 0 && v1 < 8) { la0[v1] = (128 >= (v1 >= v0)); }
+    v1 = 0;
+    while (v1 < 16) {
+        switch (((v3 / (g0 * g0 + 1)) * (g1 != 880ul))) {
+        case 913:
+            break;
+        case 305:
+        case 1:
+            break;
+        case -4:
+        case -2:
+            for (v3 = 0; v3 < 100; v3 = v3 + 1) {
+                j0 = (v3 + ((4 / 3u) - (int)(v2)));
+            }
+            break;
+        case 6:
+            j0 = !((255 / (v1 * v1 + 1)));
+            if (1) { return (!(722u) && (v2 / 1024)); }
+            break;
+        case 251:
+            break;
+        case 50:
+            for (i0 = 0; i0 < 33; i0 = i0 + 1) {
+                v3 = (f0(la0[1], 553, j0, v2, v2, 1, 9, v1) || f0(v1, v0, 3, 2L, 3U, 10, v0, v1));
+                j0 = g0;
+                if (!((254 - 127l))) { break; }
+            }
+            v2 = (v2 <= (j0 / 4));
+            break;
+        }
+        for (i0 = 0; i0 < 16; i0 = i0 + 1) {
+            if (476706232192) {
+                g1 = g1 + (f0(v2, 8, la0[1], 81, v3, 3, g0, v0) - g0);
+                g0 = ((f0(6, 520l, v0, v0, ga0[0], v2, ga0[15], v3) == (unsigned short)(la0[6])) <= (v0 / (i0 * i0 + 1)));
+                v2 = f0(f0(6, ga0[26], 301588157342, v2, j0, 4, g0, 9), 7, i0, (71972464166 >= v0), (g1 + la0[2]), -(la0[7]), (101903073110 + v1), f0(992, 347, ga0[31], g1, g1, 9, 1l, 4));
+            }
+            ga0[i0] = v2;
+            g1 = (v3 * (unsigned long)(j0));
+        }
+        v1 = v1 + 1;
+    }
+    f0((unsigned long)(v3), ga0[25], (g0 + 9), -(6), 3, (171 == 65536), 6, g0);
+    v0 = f0((2147483647 / (i0 * i0 + 1)), (ga0[23] + v2), 7, (8 / (v3 * v3 + 1)), (short)(128), -(v3), -(v2), (5 && 822));
+    if (((0 * la0[3]) && (g0 > la0[4]))) { return (f0(26, 0, j0, 8l, v1, v2, 131, i0) * -(v2)); }
+    if (!((9 + 9))) { return (f0(i0, v2, i0, 957846440537, 6, 946, 5, 0) / 1); }
+    if ((j0 || (v1 - v3))) { return ((v0 == v2) + (g1 >= v1)); }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
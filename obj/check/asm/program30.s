@@ -0,0 +1,1595 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.zero 1
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.zero 1
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.section .text
+	.type f0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.0, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movb %dl, -7(%rbp)
+	movl %ecx, -12(%rbp)
+	movw %r8w, -14(%rbp)
+	movw %r9w, -16(%rbp)
+	movabsq $283040091671, %rax
+	movq %rax, -24(%rbp)
+	movl $715415270, -28(%rbp)
+	movl $483, -32(%rbp)
+	movabsq $203065400016, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -32(%rbp)
+	imull $81, -32(%rbp), %eax
+	subl $81, %eax
+	movl %eax, -180(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L0
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -192(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -32(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L4
+.L5:
+	movl $0, -32(%rbp)
+	imull $6, -32(%rbp), %eax
+	subl $6, %eax
+	movl %eax, -260(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L6
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -272(%rbp)
+	cmpq $0, -272(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -272(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $16, -32(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L10
+.L11:
+	movswl -6(%rbp), %eax
+	movl %eax, -276(%rbp)
+	testl %eax, %eax
+	jl .L12
+	cmpl $33, -276(%rbp)
+	jge .L12
+	movswq -6(%rbp), %rax
+	movl $600, -176(%rbp,%rax,4)
+.L12:
+.L13:
+	movl 16(%rbp), %eax
+	cmpl -28(%rbp), %eax
+	setbe %al
+	movzbl %al, %eax
+	pushq %rax
+	movswl 24(%rbp), %eax
+	movl %eax, -280(%rbp)
+	imull -280(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -276(%rbp), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	subl %ecx, %eax
+	pushq %rax
+	movl ga0+60(%rip), %eax
+	subl 16(%rbp), %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -14(%rbp)
+	movl $2, -4(%rbp)
+	xorl %eax, %eax
+	subl $7, %eax
+	movl %eax, -284(%rbp)
+	movl -12(%rbp), %eax
+	cmpq $2147483647, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -288(%rbp)
+	movzwl -16(%rbp), %eax
+	movl %eax, -296(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	subl %ecx, %eax
+	movl %eax, -292(%rbp)
+	movl $2, %eax
+	cmpl $7, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl 16(%rbp), %eax
+	imull -296(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -300(%rbp)
+	xorl %eax, %eax
+	subl $255, %eax
+	movl %eax, -304(%rbp)
+	cmpl $100, -4(%rbp)
+	jae .L14
+	movl $100, %eax
+	movl -4(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -312(%rbp)
+	cmpq $0, -312(%rbp)
+	je .L17
+	.p2align 4,,10
+.L16:
+	movl -4(%rbp), %eax
+	cmpq %rax, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -284(%rbp), %eax
+	subl %ecx, %eax
+	addl -288(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -292(%rbp), %eax
+	movl %eax, -28(%rbp)
+	cmpl $0, -300(%rbp)
+	jne .LB0
+.L18:
+.L19:
+	addl $1, -4(%rbp)
+	movl -4(%rbp), %eax
+	cmpq %rax, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -284(%rbp), %eax
+	subl %ecx, %eax
+	addl -288(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -292(%rbp), %eax
+	movl %eax, -28(%rbp)
+	cmpl $0, -300(%rbp)
+	jne .LB1
+.L20:
+.L21:
+	addl $1, -4(%rbp)
+	subq $1, -312(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $100, -4(%rbp)
+	jae .L23
+	.p2align 4,,10
+.L22:
+	movl -4(%rbp), %eax
+	cmpq %rax, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -284(%rbp), %eax
+	subl %ecx, %eax
+	addl -288(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -292(%rbp), %eax
+	movl %eax, -28(%rbp)
+	cmpl $0, -300(%rbp)
+	jne .LB2
+.L24:
+.L25:
+	addl $1, -4(%rbp)
+	cmpl $100, -4(%rbp)
+	jb .L22
+.L23:
+	xorl %eax, %eax
+	cmpl $6, -276(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	jne .LB3
+.L26:
+.L27:
+	movq -24(%rbp), %rax
+	movsbl -7(%rbp), %ecx
+	subl %ecx, %eax
+	je .L28
+	movl -280(%rbp), %eax
+	imull -280(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	cltd
+	idivl %ecx
+	jmp .f0_return
+.LB2:
+	movslq -304(%rbp), %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB0:
+	movslq -304(%rbp), %rax
+	jmp .f0_return
+.LB1:
+	movslq -304(%rbp), %rax
+	jmp .f0_return
+.L28:
+.L29:
+	movq -24(%rbp), %rax
+	jmp .f0_return
+.LB3:
+	movl $7, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movb %dl, -7(%rbp)
+	movl %ecx, -12(%rbp)
+	movw %r8w, -14(%rbp)
+	movl %r9d, -20(%rbp)
+	movabsq $283040091671, %rax
+	movq %rax, -32(%rbp)
+	movl $715415270, -36(%rbp)
+	movl $483, -40(%rbp)
+	movabsq $203065400016, %rax
+	movq %rax, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $81, -40(%rbp), %eax
+	subl $81, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -40(%rbp)
+	jge .L30
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L33
+	.p2align 4,,10
+.L32:
+	addl $81, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $81, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $81, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $81, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -208(%rbp)
+	jne .L32
+.L33:
+.L30:
+.L31:
+	cmpl $33, -40(%rbp)
+	jge .L35
+	.p2align 4,,10
+.L34:
+	addl $81, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L34
+.L35:
+	movl $0, -40(%rbp)
+	imull $6, -40(%rbp), %eax
+	subl $6, %eax
+	movl %eax, -276(%rbp)
+	cmpl $16, -40(%rbp)
+	jge .L36
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -288(%rbp)
+	cmpq $0, -288(%rbp)
+	je .L39
+	.p2align 4,,10
+.L38:
+	addl $6, -276(%rbp)
+	movslq -40(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $6, -276(%rbp)
+	movslq -40(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $6, -276(%rbp)
+	movslq -40(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $6, -276(%rbp)
+	movslq -40(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -288(%rbp)
+	jne .L38
+.L39:
+.L36:
+.L37:
+	cmpl $16, -40(%rbp)
+	jge .L41
+	.p2align 4,,10
+.L40:
+	addl $6, -276(%rbp)
+	movslq -40(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L40
+.L41:
+	movswl -6(%rbp), %eax
+	movl %eax, -292(%rbp)
+	testl %eax, %eax
+	jl .L42
+	cmpl $33, -292(%rbp)
+	jge .L42
+	movswq -6(%rbp), %rax
+	movl $600, -192(%rbp,%rax,4)
+.L42:
+.L43:
+	movl -20(%rbp), %eax
+	cmpl -36(%rbp), %eax
+	setbe %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -292(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5962962354293395859, %rdx
+	imulq %rdx
+	sarq $28, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	subl %ecx, %eax
+	pushq %rax
+	movl ga0+60(%rip), %eax
+	subl -20(%rbp), %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -14(%rbp)
+	movl $2, -4(%rbp)
+	movl -12(%rbp), %eax
+	cmpq $2147483647, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -296(%rbp)
+	imull $153, -20(%rbp), %eax
+	movl %eax, -300(%rbp)
+	cmpl $100, -4(%rbp)
+	jae .L44
+	movl $100, %eax
+	movl -4(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -312(%rbp)
+	cmpq $0, -312(%rbp)
+	je .L47
+	.p2align 4,,10
+.L46:
+	movl -4(%rbp), %eax
+	cmpq %rax, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $-7, %eax
+	subl %ecx, %eax
+	addl -296(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl $163, -36(%rbp)
+	cmpl $0, -300(%rbp)
+	jne .LB4
+.L48:
+.L49:
+	addl $1, -4(%rbp)
+	movl -4(%rbp), %eax
+	cmpq %rax, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $-7, %eax
+	subl %ecx, %eax
+	addl -296(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl $163, -36(%rbp)
+	cmpl $0, -300(%rbp)
+	jne .LB5
+.L50:
+.L51:
+	addl $1, -4(%rbp)
+	subq $1, -312(%rbp)
+	jne .L46
+.L47:
+.L44:
+.L45:
+	cmpl $100, -4(%rbp)
+	jae .L53
+	.p2align 4,,10
+.L52:
+	movl -4(%rbp), %eax
+	cmpq %rax, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $-7, %eax
+	subl %ecx, %eax
+	addl -296(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl $163, -36(%rbp)
+	cmpl $0, -300(%rbp)
+	jne .LB6
+.L54:
+.L55:
+	addl $1, -4(%rbp)
+	cmpl $100, -4(%rbp)
+	jb .L52
+.L53:
+	xorl %eax, %eax
+	cmpl $6, -292(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	je .L56
+	movl $7, %eax
+	jmp .f0.constprop.1_return
+.LB6:
+	movl $1, %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB4:
+	movl $1, %eax
+	jmp .f0.constprop.1_return
+.LB5:
+	movl $1, %eax
+	jmp .f0.constprop.1_return
+.L56:
+.L57:
+	movq -32(%rbp), %rax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movsbl -7(%rbp), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	popq %rcx
+	popq %rax
+	cmovnel %ecx, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $304, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movl %edx, -12(%rbp)
+	movw %cx, -14(%rbp)
+	movw %r8w, -16(%rbp)
+	movabsq $283040091671, %rax
+	movq %rax, -24(%rbp)
+	movl $715415270, -28(%rbp)
+	movl $483, -32(%rbp)
+	movabsq $203065400016, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -32(%rbp)
+	imull $81, -32(%rbp), %eax
+	subl $81, %eax
+	movl %eax, -180(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L58
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L61
+	.p2align 4,,10
+.L60:
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -192(%rbp)
+	jne .L60
+.L61:
+.L58:
+.L59:
+	cmpl $33, -32(%rbp)
+	jge .L63
+	.p2align 4,,10
+.L62:
+	addl $81, -180(%rbp)
+	movslq -32(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L62
+.L63:
+	movl $0, -32(%rbp)
+	imull $6, -32(%rbp), %eax
+	subl $6, %eax
+	movl %eax, -260(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L64
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -272(%rbp)
+	cmpq $0, -272(%rbp)
+	je .L67
+	.p2align 4,,10
+.L66:
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -272(%rbp)
+	jne .L66
+.L67:
+.L64:
+.L65:
+	cmpl $16, -32(%rbp)
+	jge .L69
+	.p2align 4,,10
+.L68:
+	addl $6, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L68
+.L69:
+	movswl -6(%rbp), %eax
+	movl %eax, -276(%rbp)
+	testl %eax, %eax
+	jl .L70
+	cmpl $33, -276(%rbp)
+	jge .L70
+	movswq -6(%rbp), %rax
+	movl $600, -176(%rbp,%rax,4)
+.L70:
+.L71:
+	movswl -16(%rbp), %eax
+	movl %eax, -280(%rbp)
+	imull -280(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -276(%rbp), %eax
+	cltd
+	idivl %ecx
+	cmpl $852, -28(%rbp)
+	setae %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movl ga0+60(%rip), %eax
+	subl $852, %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -14(%rbp)
+	movl $2, -4(%rbp)
+	movl -12(%rbp), %eax
+	cmpq $2147483647, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -284(%rbp)
+	cmpl $100, -4(%rbp)
+	jae .L72
+	movl $100, %eax
+	movl -4(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -296(%rbp)
+	cmpq $0, -296(%rbp)
+	je .L75
+	.p2align 4,,10
+.L74:
+	movl -4(%rbp), %eax
+	cmpq %rax, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $-7, %eax
+	subl %ecx, %eax
+	addl -284(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl $65545, -28(%rbp)
+	movl $1, %eax
+	jmp .f0.constprop.0_return
+.L75:
+.L72:
+.L73:
+	cmpl $100, -4(%rbp)
+	jae .L77
+	.p2align 4,,10
+.L76:
+	movl -4(%rbp), %eax
+	cmpq %rax, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $-7, %eax
+	subl %ecx, %eax
+	addl -284(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl $65545, -28(%rbp)
+	movl $1, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L77:
+	xorl %eax, %eax
+	cmpl $6, -276(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	jne .LB7
+.L78:
+.L79:
+	movq -24(%rbp), %rax
+	subl $2, %eax
+	je .L80
+	movl -280(%rbp), %eax
+	imull -280(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	cltd
+	idivl %ecx
+	jmp .f0.constprop.0_return
+.L80:
+.L81:
+	movq -24(%rbp), %rax
+	jmp .f0.constprop.0_return
+.LB7:
+	movl $7, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movb $10, -1(%rbp)
+	movl $256, -8(%rbp)
+	movb $6, -9(%rbp)
+	movabsq $317941089006, %rax
+	movq %rax, -24(%rbp)
+	movl $828, -28(%rbp)
+	movq $689, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -80(%rbp)
+	movl $668, -76(%rbp)
+	movl $1336, -72(%rbp)
+	movl $2004, -68(%rbp)
+	movl $2672, -64(%rbp)
+	movl $3340, -60(%rbp)
+	movl $4008, -56(%rbp)
+	movl $4676, -52(%rbp)
+	movl $8, -28(%rbp)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movzbl g0(%rip), %eax
+	movl ga0+88(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L82
+	movq -40(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movsbl -1(%rbp), %eax
+	movq %rax, %r8
+	movsbl g1(%rip), %eax
+	movq %rax, %rcx
+	movsbl -1(%rbp), %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $8, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	pushq %rax
+	movslq -28(%rbp), %rax
+	movabsq $378352696266, %rcx
+	addq %rcx, %rax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	addl $6, %eax
+	movq %rax, %rsi
+	movsbl -9(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.1
+.L82:
+.L83:
+	cmpl $0, -8(%rbp)
+	jb .L84
+	cmpl $8, -8(%rbp)
+	jae .L84
+	movsbl -1(%rbp), %eax
+	cmpl %eax, -8(%rbp)
+	setae %al
+	movzbl %al, %eax
+	cmpl $128, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movl %ecx, -80(%rbp,%rax,4)
+.L84:
+.L85:
+	movl $0, -8(%rbp)
+	movl $1, -84(%rbp)
+	movq $127, -96(%rbp)
+	movabsq $71972464166, %rax
+	movsbq -1(%rbp), %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	cmpl $16, -8(%rbp)
+	jae .L87
+	.p2align 4,,10
+.L86:
+	movsbq g1(%rip), %rax
+	cmpq $880, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzbl g0(%rip), %eax
+	movzbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	imulq %rcx, %rax
+	cmpq $50, %rax
+	jge .L95
+	cmpq $1, %rax
+	jge .L96
+	cmpq $-4, %rax
+	je .L91
+	cmpq $-2, %rax
+	je .L91
+	jmp .L88
+.L95:
+	cmpq $305, %rax
+	jge .L97
+	cmpq $50, %rax
+	je .L94
+	cmpq $251, %rax
+	je .L88
+	jmp .L88
+.L96:
+	cmpq $1, %rax
+	je .L88
+	cmpq $6, %rax
+	je .L92
+	jmp .L88
+.L97:
+	cmpq $305, %rax
+	je .L88
+	cmpq $913, %rax
+	je .L88
+	jmp .L88
+.L90:
+	jmp .L88
+.L91:
+	movq $0, -24(%rbp)
+	movsbl -9(%rbp), %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	subl %ecx, %eax
+	movl %eax, -104(%rbp)
+	cmpq $100, -24(%rbp)
+	jge .L98
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L101
+	.p2align 4,,10
+.L100:
+	movl -104(%rbp), %eax
+	movq %rax, -120(%rbp)
+	addq -24(%rbp), %rax
+	movq %rax, -40(%rbp)
+	addq $1, -24(%rbp)
+	movq -24(%rbp), %rax
+	addq -120(%rbp), %rax
+	movq %rax, -40(%rbp)
+	addq $1, -24(%rbp)
+	movq -24(%rbp), %rax
+	addq -120(%rbp), %rax
+	movq %rax, -40(%rbp)
+	addq $1, -24(%rbp)
+	movq -24(%rbp), %rax
+	addq -120(%rbp), %rax
+	movq %rax, -40(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -112(%rbp)
+	jne .L100
+.L101:
+.L98:
+.L99:
+	cmpq $100, -24(%rbp)
+	jge .L88
+	.p2align 4,,10
+.L102:
+	movl -104(%rbp), %eax
+	addq -24(%rbp), %rax
+	movq %rax, -40(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jl .L102
+.L103:
+	jmp .L88
+.L94:
+	movl $0, -28(%rbp)
+	movq -96(%rbp), %rax
+	movq %rax, -128(%rbp)
+	cmpl $33, -28(%rbp)
+	jge .L105
+	.p2align 4,,10
+.L104:
+	movl -8(%rbp), %eax
+	movw %ax, -130(%rbp)
+	pushq %rax
+	movl $9, %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movsbl -9(%rbp), %eax
+	movq %rax, %r8
+	movsbl -9(%rbp), %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movq %rax, %rdx
+	movl $553, %eax
+	movq %rax, %rsi
+	movl -76(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	jne .L106
+	movswl -130(%rbp), %eax
+	pushq %rax
+	movsbl -1(%rbp), %eax
+	pushq %rax
+	movl $10, %eax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	movq %rax, %rdx
+	movsbl -1(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L89:
+	jmp .L88
+.L93:
+	jmp .L88
+.L108:
+.L109:
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jl .L104
+	jmp .L105
+.L114:
+	movsbl g1(%rip), %eax
+	cmpl -8(%rbp), %eax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -1(%rbp), %eax
+	cmpl -164(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L106:
+	movl $1, %eax
+.L107:
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movzbl g0(%rip), %eax
+	movq %rax, -40(%rbp)
+	cmpq $0, -128(%rbp)
+	jne .L108
+.L105:
+	movq -40(%rbp), %rax
+	leaq 3(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $2, %rcx
+	movq %rcx, %rax
+	movq %rax, %rcx
+	movsbq -9(%rbp), %rax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+.L88:
+	movl $0, -28(%rbp)
+	movl -100(%rbp), %eax
+	movl %eax, -136(%rbp)
+	movabsq $101903073110, %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -144(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	imulq %rcx, %rax
+	movq %rax, -152(%rbp)
+	cmpl $16, -28(%rbp)
+	jge .L111
+	.p2align 4,,10
+.L110:
+	movzbl g0(%rip), %eax
+	pushq %rax
+	subq $8, %rsp
+	movsbl -1(%rbp), %eax
+	pushq %rax
+	movzbl g0(%rip), %eax
+	pushq %rax
+	movl $3, %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movw %ax, -158(%rbp)
+	movq %rax, %r8
+	movl $81, %eax
+	movq %rax, %rcx
+	movl -76(%rbp), %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movsbl -9(%rbp), %eax
+	movl %eax, -156(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	movl -28(%rbp), %eax
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl -1(%rbp), %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	movl -56(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movswl -158(%rbp), %eax
+	pushq %rax
+	movl ga0+60(%rip), %eax
+	pushq %rax
+	movsbl -9(%rbp), %eax
+	movq %rax, %r9
+	movl ga0+0(%rip), %eax
+	movq %rax, %r8
+	movsbl -1(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -1(%rbp), %eax
+	movq %rax, %rdx
+	movl $520, %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movb %al, g0(%rip)
+	movl $4, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl $9, %eax
+	movq %rax, %r9
+	movsbl g1(%rip), %eax
+	movq %rax, %r8
+	movsbl g1(%rip), %eax
+	movq %rax, %rcx
+	movl ga0+124(%rip), %eax
+	movq %rax, %rdx
+	movl $347, %eax
+	movq %rax, %rsi
+	movl $992, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	movq -144(%rbp), %rax
+	pushq %rax
+	xorl %eax, %eax
+	movl -52(%rbp), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movsbl g1(%rip), %eax
+	movl -72(%rbp), %ecx
+	addl %ecx, %eax
+	pushq %rax
+	movl -136(%rbp), %eax
+	pushq %rax
+	movl -28(%rbp), %eax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $9, %eax
+	pushq %rax
+	movzbl g0(%rip), %eax
+	pushq %rax
+	movl $4, %eax
+	movq %rax, %r9
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movl -156(%rbp), %eax
+	movq %rax, %rcx
+	movl $-98, %eax
+	movq %rax, %rdx
+	movl ga0+104(%rip), %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movsbl %al, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movb %al, -9(%rbp)
+	movslq -28(%rbp), %rax
+	movsbl -9(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movq -152(%rbp), %rax
+	movb %al, g1(%rip)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L110
+.L111:
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jb .L86
+.L87:
+	movzbl g0(%rip), %eax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl $4294967290, %eax
+	movq %rax, %rcx
+	movzbl g0(%rip), %eax
+	addl $9, %eax
+	movq %rax, %rdx
+	movl ga0+100(%rip), %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl $1, %eax
+	pushq %rax
+	movsbl -9(%rbp), %eax
+	movl %eax, -164(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subq -24(%rbp), %rax
+	pushq %rax
+	movl $128, %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movl ga0+92(%rip), %eax
+	addl -164(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2147483647, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movb %al, -1(%rbp)
+	cmpq $0, -40(%rbp)
+	jne .L114
+	movl -8(%rbp), %eax
+	subq -24(%rbp), %rax
+	jne .L114
+.L112:
+.L113:
+	movq $0, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movzbl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movsbq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movsbq -1(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movsbq -9(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jge .L115
+	movl $33, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L118
+	.p2align 4,,10
+.L117:
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -184(%rbp)
+	jne .L117
+.L118:
+.L115:
+.L116:
+	cmpl $33, -28(%rbp)
+	jge .L120
+	.p2align 4,,10
+.L119:
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jl .L119
+.L120:
+	movl $0, -28(%rbp)
+	cmpl $8, -28(%rbp)
+	jge .L121
+	movl $8, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L124
+	.p2align 4,,10
+.L123:
+	movslq -28(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -192(%rbp)
+	jne .L123
+.L124:
+.L121:
+.L122:
+	cmpl $8, -28(%rbp)
+	jge .L126
+	.p2align 4,,10
+.L125:
+	movslq -28(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $8, -28(%rbp)
+	jl .L125
+.L126:
+	movq -176(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -176(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -176(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	movq -176(%rbp), %rax
+	jmp .main_return
+.L92:
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $255, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movl $0, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
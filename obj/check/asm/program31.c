@@ -0,0 +1,255 @@
+int g0;
+unsigned int g1;
+unsigned long g2 = 3;
+unsigned short f0(char p0, int p1, unsigned char p2, unsigned short p3, long p4, int p5, long p6, unsigned int p7) {
+    unsigned long v0 = 255L;
+    unsigned char v1 = 10l;
+    unsigned char v2 = 675;
+    unsigned int v3 = 5;
+    unsigned short v4 = 0;
+    char v5 = 6;
+    int i0 = 5;
+    long j0 = 8;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 3; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 295; }
+    j0 = -((395 != (unsigned int)(750)));
+    switch (-((9 < 2))) {
+    case 2:
+    case 255:
+        if (p7) {
+            if ((!(i0) - !(v1))) {
+                p6 = g2;
+                if (((v1 / (p1 * p1 + 1)) > 4)) { return (v1 * p1); }
+            }
+            if ((!(926) || (char)(g1))) {
+                if (661246238490) { return p4; }
+            } else {
+                p3 = j0;
+                p7 = 820393226059;
+            }
+        }
+        break;
+    case 571:
+        for (v0 = 2; v0 < 100; v0 = v0 + 1) {
+            la0[4] = g1;
+        }
+        v5 = la0[5];
+        break;
+    case 28:
+        j0 = j0 + 8;
+        switch (p5) {
+        case 6:
+            break;
+        case 2:
+            v3 = (unsigned char)((0 <= (1 && 493)));
+            p2 = ((520 / 5l) && p4);
+            break;
+        case 3:
+            break;
+        case 10:
+            if ((((v4 <= v4) * (633 - la1[3])) / 1024)) {
+                v5 = v5;
+                v5 = 951;
+                v2 = 2147483647;
+            } else {
+                if (((long)(g0) < (v3 || v5))) { return ((804795827060u > la1[6]) || (char)(g2)); }
+                if (g0 >= 0 && g0 < 8) { la0[g0] = (int)((int)(p5)); }
+            }
+            p5 = v5;
+            break;
+        case 5:
+            break;
+        case 9:
+            if ((p3 + v5)) { return (char)((unsigned short)(la1[0])); }
+            break;
+        }
+    case 27:
+        if (!((10 / (g1 * g1 + 1)))) { return (unsigned int)(v1); }
+        break;
+    case 521:
+        v0 = v0 + 904u;
+        if (p2 >= 0 && p2 < 8) { la0[p2] = (unsigned char)(4); }
+        break;
+    case 5:
+        v5 = (3 != p2);
+        break;
+    }
+    if (!((unsigned short)((p4 && 918)))) {
+        i0 = p4;
+    } else {
+        la1[5] = (long)(174);
+        p7 = (int)(p0);
+        v4 = (!(v0) - 1);
+    }
+    if ((i0 >= 0)) { return ((6 + 6) / 1024); }
+    i0 = ((unsigned long)(v0) && (p5 - v3));
+    i0 = j0;
+    return (1 >= ((p4 / (v3 * v3 + 1)) - (p7 + v4)));
+}
+void w0(long q0, char q1) {
+    g1 = g1 * 3 + q0;
+}
+int main() {
+    short v0 = 8;
+    unsigned char v1 = 429;
+    long v2 = 831;
+    unsigned long v3 = 617849016254;
+    unsigned short v4 = 854;
+    long v5 = 676309928896;
+    int i0 = 0;
+    long j0 = 1;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 65536; }
+    switch (304786754066) {
+    case 500:
+    case 0:
+        j0 = ((f0(g0, 708074608203, 125, la0[32], v4, 1093640468177, v1, 2) - (839109027725 || v1)) > f0(8, v1, 817, la0[11], 7, j0, 184, la0[0]));
+    default:
+        for (i0 = 0; i0 < 100; i0 = i0 + 1) {
+            v3 = 0;
+            while (v3 < 16) {
+                g2 = g2;
+                if ((v5 / 3u)) { break; }
+                v3 = v3 + 1;
+            }
+            for (v5 = 1; v5 < 3; v5 = v5 + 1) {
+                if ((i0 / 16)) { break; }
+            }
+        }
+    case 18:
+        break;
+    case 203:
+        v1 = (short)((unsigned char)((v4 && v4)));
+        w0(9, v5);
+        break;
+    }
+    switch (f0(v2, 6, v3, 1000000007, 317, 341, v5, 492)) {
+    default:
+        if ((g1 * 2)) {
+            v1 = (f0(i0, v3, 4, 0, 7, 259, 65536, j0) < -(583));
+            if ((-((v4 != 603)) || -((j0 - 1)))) {
+                w0(v5, 3);
+            } else {
+                w0(la0[17], v2);
+            }
+        }
+        if ((v5 > g1)) {
+            for (i0 = 1; i0 < 4; i0 = i0 + 1) {
+                v1 = ((g0 >= (v0 == v2)) / (v1 * v1 + 1));
+            }
+            v5 = !((unsigned char)(128));
+            g0 = (v4 != (g0 - (1 && j0)));
+        } else {
+            if (la0[5]) { return g2; }
+            g0 = 602;
+        }
+        break;
+    case 488:
+    case 0:
+    case -3:
+        v2 = (((1000000007 / 16) + j0) == -((la0[17] >= 247)));
+        switch (g2) {
+        default:
+            switch ((f0(10, la0[22], la0[11], 32767, g0, 165, v2, v2) * i0)) {
+            case 2:
+                v0 = ((1000000007ul <= 7) || (v5 > v3));
+                v2 = v2;
+            default:
+                break;
+            case 5:
+                w0(g0, g2);
+                w0(j0, la0[1]);
+            case 0:
+                w0(i0, 10);
+                i0 = g1;
+                break;
+            }
+            v5 = (f0(860, v2, g0, 2, 128, g1, v5, i0) / 4);
+            break;
+        case 6:
+        case 4:
+            v5 = v5 + 10L;
+            v2 = v2 + (v2 + 2);
+        case 1:
+            switch (f0(v0, g2, v4, i0, j0, v0, 7, v5)) {
+            case 62:
+                w0(183, g2);
+                break;
+            case 4:
+                w0(858, 65535);
+                g2 = f0((g2 < 4l), (173868057203 + 479), (6 > 955), (311 * 244), (v3 - 879), 3, f0(v3, i0, v3, g0, 255, 0, 8, 857), (i0 + 64L));
+                break;
+            default:
+                break;
+            case 16:
+                i0 = (v1 <= (-(9) == i0));
+                v2 = 5;
+            case 426:
+                la0[12] = la0[10];
+                break;
+            case 510:
+                w0(8, v3);
+                break;
+            case 67:
+                w0(la0[2], la0[30]);
+                v5 = ((837008931616 * (short)(2)) / 8);
+                break;
+            case 646:
+                v5 = 4294967295;
+                if (g0 >= 0 && g0 < 33) { la0[g0] = (v3 * -(v4)); }
+                break;
+            case -3:
+                break;
+            }
+            break;
+        case 7:
+            break;
+        case 3:
+        case 2:
+            break;
+        case 0:
+            if (g2 >= 0 && g2 < 33) { la0[g2] = f0(4U, 148973040135, v0, 2, 5, 3, g0, 187); }
+            break;
+        }
+        break;
+    case 720:
+        break;
+    }
+    for (v5 = 0; v5 < 33; v5 = v5 + 1) {
+        if (!((short)(352753105650))) { return (i0 > (g2 <= 256)); }
+    }
+    v0 = (v5 - 255);
+    for (v5 = 0; v5 < 5; v5 = v5 + 1) {
+        if (i0) {
+            if ((9 != v4)) {
+                if (4U) { break; }
+                la0[v5] = (14909414391 == 10u);
+                v0 = (short)((j0 - (v3 + la0[13])));
+            } else {
+                v1 = v0;
+                la0[v5] = ((6 - 146) / (v3 * v3 + 1));
+                w0(716, 6ul);
+            }
+            f0(4, (char)(v3), i0, (long)(8), (4 / (v2 * v2 + 1)), (int)(g1), v4, g1);
+        }
+        v4 = ((long)(v5) * la0[3]);
+    }
+    g2 = ((v5 && (la0[22] + g0)) || g2);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1769 @@
+	.section .data
+	.type g2, @object
+	.size g2, 8
+	.p2align 3
+g2:
+	.quad 3
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.type g1, @object
+	.size g1, 4
+	.p2align 2
+g1:
+	.zero 4
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movw %cx, -12(%rbp)
+	movq %r8, -24(%rbp)
+	movl %r9d, -28(%rbp)
+	movq $255, -40(%rbp)
+	movb $10, -41(%rbp)
+	movb $163, -42(%rbp)
+	movl $5, -48(%rbp)
+	movw $0, -50(%rbp)
+	movb $6, -51(%rbp)
+	movl $5, -56(%rbp)
+	movq $8, -64(%rbp)
+	movl $0, -56(%rbp)
+	movl $0, -96(%rbp)
+	movl $3, -92(%rbp)
+	movl $6, -88(%rbp)
+	movl $9, -84(%rbp)
+	movl $12, -80(%rbp)
+	movl $15, -76(%rbp)
+	movl $18, -72(%rbp)
+	movl $21, -68(%rbp)
+	movl $8, -56(%rbp)
+	movl $0, -56(%rbp)
+	movl $0, -128(%rbp)
+	movl $295, -124(%rbp)
+	movl $590, -120(%rbp)
+	movl $885, -116(%rbp)
+	movl $1180, -112(%rbp)
+	movl $1475, -108(%rbp)
+	movl $1770, -104(%rbp)
+	movl $2065, -100(%rbp)
+	movl $8, -56(%rbp)
+	movq $-1, -64(%rbp)
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $28, %rax
+	jge .L7
+	cmpq $2, %rax
+	je .L1
+	cmpq $5, %rax
+	je .L6
+	cmpq $27, %rax
+	je .L4
+	jmp .L0
+.L7:
+	cmpq $521, %rax
+	jge .L8
+	cmpq $28, %rax
+	je .L3
+	cmpq $255, %rax
+	je .L1
+	jmp .L0
+.L1:
+	cmpl $0, 24(%rbp)
+	je .L9
+	cmpb $0, -41(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	je .L11
+	movq g2(%rip), %rax
+	movq %rax, 16(%rbp)
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -41(%rbp), %eax
+	movl %eax, -132(%rbp)
+	cltd
+	idivl %ecx
+	cmpl $4, %eax
+	jg .LB0
+.L13:
+.L14:
+.L11:
+.L12:
+	movl g1(%rip), %eax
+	testb %al, %al
+	jne .LB1
+.L15:
+	movq -64(%rbp), %rax
+	movw %ax, -12(%rbp)
+	movl $54472523, 24(%rbp)
+.L16:
+.L9:
+.L10:
+.L0:
+	cmpq $0, -24(%rbp)
+	je .L50
+	movl $918, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L51
+.L50:
+	movl $0, %eax
+.L51:
+	testw %ax, %ax
+	jne .L48
+	movq -24(%rbp), %rax
+	movl %eax, -56(%rbp)
+	jmp .L49
+.L48:
+	movl $174, -108(%rbp)
+	movsbl -1(%rbp), %eax
+	movl %eax, 24(%rbp)
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl $1, %eax
+	movw %ax, -50(%rbp)
+.L49:
+	cmpl $0, -56(%rbp)
+	jge .LB2
+.L52:
+.L53:
+	cmpq $0, -40(%rbp)
+	je .L54
+	movl -28(%rbp), %eax
+	subl -48(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L55
+.L54:
+	movl $0, %eax
+.L55:
+	movl %eax, -56(%rbp)
+	movq -64(%rbp), %rax
+	movl %eax, -56(%rbp)
+	movzwl -50(%rbp), %eax
+	addl 24(%rbp), %eax
+	pushq %rax
+	movl -48(%rbp), %eax
+	imull -48(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	cmpq $1, %rax
+	setle %al
+	movzbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L8:
+	cmpq $521, %rax
+	je .L5
+	cmpq $571, %rax
+	je .L2
+	jmp .L0
+.L3:
+	addq $8, -64(%rbp)
+	movl -28(%rbp), %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L30
+	leaq .L31(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L23
+	# table target .L25
+	# table target .L26
+	# table target .L28
+	# table target .L24
+	# table target .L29
+	# table target .L27
+	jmp *%rcx
+.L30:
+.L23:
+.L4:
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	je .LB3
+.L44:
+.L45:
+	jmp .L0
+.L5:
+	addq $904, -40(%rbp)
+	movzbl -9(%rbp), %eax
+	movl %eax, -152(%rbp)
+	testl %eax, %eax
+	jl .L0
+	cmpl $8, -152(%rbp)
+	jge .L0
+	movzbl -9(%rbp), %eax
+	movl $4, -96(%rbp,%rax,4)
+.L46:
+.L47:
+	jmp .L0
+.L6:
+	movzbl -9(%rbp), %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -51(%rbp)
+	jmp .L0
+.L2:
+	movq $2, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jae .L17
+	movl $100, %eax
+	subq -40(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L20
+	.p2align 4,,10
+.L19:
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	subq $1, -144(%rbp)
+	jne .L19
+.L20:
+.L17:
+.L18:
+	cmpq $100, -40(%rbp)
+	jae .L22
+	.p2align 4,,10
+.L21:
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jb .L21
+.L22:
+	movl -76(%rbp), %eax
+	movb %al, -51(%rbp)
+	jmp .L0
+.L24:
+	jmp .L23
+.L25:
+	movl $1, -48(%rbp)
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	jmp .L23
+.L26:
+	jmp .L23
+.L27:
+	movl $633, %eax
+	movl -116(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzwl -50(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl %eax, -148(%rbp)
+	setle %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L32
+	movb $-73, -51(%rbp)
+	movb $255, -42(%rbp)
+.L40:
+.L41:
+.L33:
+	movsbl -51(%rbp), %eax
+	movl %eax, -28(%rbp)
+	jmp .L23
+.L32:
+	cmpl $0, -48(%rbp)
+	jne .L36
+	cmpb $0, -51(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L37
+.L36:
+	movl $1, %eax
+.L37:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	cmpq %rcx, %rax
+	jge .L34
+	movl -104(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $804795827060, %rax
+	cmpq %rcx, %rax
+	ja .L38
+	movq g2(%rip), %rax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L34:
+.L35:
+	cmpl $0, g0(%rip)
+	jl .L40
+	cmpl $8, g0(%rip)
+	jge .L40
+	movslq g0(%rip), %rax
+	movl -28(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	jmp .L41
+.L28:
+	jmp .L23
+.L29:
+	movzwl -12(%rbp), %eax
+	movsbl -51(%rbp), %ecx
+	addl %ecx, %eax
+	jne .LB4
+.L42:
+.L43:
+	jmp .L23
+.LB2:
+	movl $0, %eax
+	jmp .f0_return
+.LB3:
+	movzbl -41(%rbp), %eax
+	jmp .f0_return
+.LB1:
+	movq -24(%rbp), %rax
+	jmp .f0_return
+.LB0:
+	movl -132(%rbp), %eax
+	imull -8(%rbp), %eax
+	jmp .f0_return
+.LB4:
+	movl -128(%rbp), %eax
+	movsbl %al, %eax
+	jmp .f0_return
+.L38:
+	movl $1, %eax
+.L39:
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L31:
+	.long .L25-.L31
+	.long .L26-.L31
+	.long .L23-.L31
+	.long .L28-.L31
+	.long .L24-.L31
+	.long .L23-.L31
+	.long .L23-.L31
+	.long .L29-.L31
+	.long .L27-.L31
+	.popsection
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movb %dil, -1(%rbp)
+	movb %sil, -2(%rbp)
+	movw %dx, -4(%rbp)
+	movq %rcx, -16(%rbp)
+	movl %r8d, -20(%rbp)
+	movq %r9, -32(%rbp)
+	movq $255, -40(%rbp)
+	movb $10, -41(%rbp)
+	movb $163, -42(%rbp)
+	movl $5, -48(%rbp)
+	movw $0, -50(%rbp)
+	movb $6, -51(%rbp)
+	movl $5, -56(%rbp)
+	movq $8, -64(%rbp)
+	movl $0, -56(%rbp)
+	movl $0, -96(%rbp)
+	movl $3, -92(%rbp)
+	movl $6, -88(%rbp)
+	movl $9, -84(%rbp)
+	movl $12, -80(%rbp)
+	movl $15, -76(%rbp)
+	movl $18, -72(%rbp)
+	movl $21, -68(%rbp)
+	movl $8, -56(%rbp)
+	movl $0, -56(%rbp)
+	movl $0, -128(%rbp)
+	movl $295, -124(%rbp)
+	movl $590, -120(%rbp)
+	movl $885, -116(%rbp)
+	movl $1180, -112(%rbp)
+	movl $1475, -108(%rbp)
+	movl $1770, -104(%rbp)
+	movl $2065, -100(%rbp)
+	movl $8, -56(%rbp)
+	movq $-1, -64(%rbp)
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $28, %rax
+	jge .L63
+	cmpq $2, %rax
+	je .L57
+	cmpq $5, %rax
+	je .L62
+	cmpq $27, %rax
+	je .L60
+	jmp .L56
+.L63:
+	cmpq $521, %rax
+	jge .L64
+	cmpq $28, %rax
+	je .L59
+	cmpq $255, %rax
+	je .L57
+	jmp .L56
+.L57:
+	cmpl $0, 16(%rbp)
+	je .L65
+	cmpb $0, -41(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	je .L67
+	movq g2(%rip), %rax
+	movq %rax, -32(%rbp)
+	movl $-594995637, %eax
+	imull $-594995637, %eax, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -41(%rbp), %eax
+	movl %eax, -132(%rbp)
+	cltd
+	idivl %ecx
+	cmpl $4, %eax
+	jg .LB5
+.L69:
+.L70:
+.L67:
+.L68:
+	movl g1(%rip), %eax
+	testb %al, %al
+	jne .LB6
+.L71:
+	movq -64(%rbp), %rax
+	movw %ax, -4(%rbp)
+	movl $54472523, 16(%rbp)
+.L72:
+.L65:
+.L66:
+.L56:
+	cmpq $0, -16(%rbp)
+	je .L106
+	movl $918, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L106:
+	movl $0, %eax
+.L107:
+	testw %ax, %ax
+	jne .L104
+	movq -16(%rbp), %rax
+	movl %eax, -56(%rbp)
+	jmp .L105
+.L104:
+	movl $174, -108(%rbp)
+	movsbl -1(%rbp), %eax
+	movl %eax, 16(%rbp)
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl $1, %eax
+	movw %ax, -50(%rbp)
+.L105:
+	cmpl $0, -56(%rbp)
+	jge .LB7
+.L108:
+.L109:
+	cmpq $0, -40(%rbp)
+	je .L110
+	movl -20(%rbp), %eax
+	subl -48(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L111
+.L110:
+	movl $0, %eax
+.L111:
+	movl %eax, -56(%rbp)
+	movq -64(%rbp), %rax
+	movl %eax, -56(%rbp)
+	movzwl -50(%rbp), %eax
+	addl 16(%rbp), %eax
+	pushq %rax
+	movl -48(%rbp), %eax
+	imull -48(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	cmpq $1, %rax
+	setle %al
+	movzbl %al, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L64:
+	cmpq $521, %rax
+	je .L61
+	cmpq $571, %rax
+	je .L58
+	jmp .L56
+.L59:
+	addq $8, -64(%rbp)
+	movl -20(%rbp), %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L86
+	leaq .L87(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L79
+	# table target .L81
+	# table target .L82
+	# table target .L84
+	# table target .L80
+	# table target .L85
+	# table target .L83
+	jmp *%rcx
+.L86:
+.L79:
+.L60:
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	je .LB8
+.L100:
+.L101:
+	jmp .L56
+.L61:
+	addq $904, -40(%rbp)
+	movzbl -2(%rbp), %eax
+	movl %eax, -152(%rbp)
+	testl %eax, %eax
+	jl .L56
+	cmpl $8, -152(%rbp)
+	jge .L56
+	movzbl -2(%rbp), %eax
+	movl $4, -96(%rbp,%rax,4)
+.L102:
+.L103:
+	jmp .L56
+.L62:
+	movzbl -2(%rbp), %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -51(%rbp)
+	jmp .L56
+.L58:
+	movq $2, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jae .L73
+	movl $100, %eax
+	subq -40(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L76
+	.p2align 4,,10
+.L75:
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	subq $1, -144(%rbp)
+	jne .L75
+.L76:
+.L73:
+.L74:
+	cmpq $100, -40(%rbp)
+	jae .L78
+	.p2align 4,,10
+.L77:
+	movl g1(%rip), %eax
+	movl %eax, -80(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jb .L77
+.L78:
+	movl -76(%rbp), %eax
+	movb %al, -51(%rbp)
+	jmp .L56
+.L80:
+	jmp .L79
+.L81:
+	movl $1, -48(%rbp)
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movb %al, -2(%rbp)
+	jmp .L79
+.L82:
+	jmp .L79
+.L83:
+	movl $633, %eax
+	movl -116(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzwl -50(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl %eax, -148(%rbp)
+	setle %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L88
+	movb $-73, -51(%rbp)
+	movb $255, -42(%rbp)
+.L96:
+.L97:
+.L89:
+	movsbl -51(%rbp), %eax
+	movl %eax, -20(%rbp)
+	jmp .L79
+.L88:
+	cmpl $0, -48(%rbp)
+	jne .L92
+	cmpb $0, -51(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L93
+.L92:
+	movl $1, %eax
+.L93:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	cmpq %rcx, %rax
+	jge .L90
+	movl -104(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $804795827060, %rax
+	cmpq %rcx, %rax
+	ja .L94
+	movq g2(%rip), %rax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L90:
+.L91:
+	cmpl $0, g0(%rip)
+	jl .L96
+	cmpl $8, g0(%rip)
+	jge .L96
+	movslq g0(%rip), %rax
+	movl -20(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	jmp .L97
+.L84:
+	jmp .L79
+.L85:
+	movzwl -4(%rbp), %eax
+	movsbl -51(%rbp), %ecx
+	addl %ecx, %eax
+	jne .LB9
+.L98:
+.L99:
+	jmp .L79
+.LB7:
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+.LB8:
+	movzbl -41(%rbp), %eax
+	jmp .f0.constprop.0_return
+.LB6:
+	movq -16(%rbp), %rax
+	jmp .f0.constprop.0_return
+.LB5:
+	imull $-594995637, -132(%rbp), %eax
+	jmp .f0.constprop.0_return
+.LB9:
+	movl -128(%rbp), %eax
+	movsbl %al, %eax
+	jmp .f0.constprop.0_return
+.L94:
+	movl $1, %eax
+.L95:
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L87:
+	.long .L81-.L87
+	.long .L82-.L87
+	.long .L79-.L87
+	.long .L84-.L87
+	.long .L80-.L87
+	.long .L79-.L87
+	.long .L79-.L87
+	.long .L85-.L87
+	.long .L83-.L87
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $384, %rsp
+	movw $8, -2(%rbp)
+	movb $173, -3(%rbp)
+	movq $831, -16(%rbp)
+	movabsq $617849016254, %rax
+	movq %rax, -24(%rbp)
+	movw $854, -26(%rbp)
+	movabsq $676309928896, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -44(%rbp)
+	movq $1, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	testl %eax, %eax
+	je .L112
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L115
+	.p2align 4,,10
+.L114:
+	movl -44(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -208(%rbp)
+	jne .L114
+.L115:
+.L112:
+.L113:
+	cmpl $33, -44(%rbp)
+	jge .L117
+	.p2align 4,,10
+.L116:
+	movl -44(%rbp), %eax
+	sall $16, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L116
+.L117:
+	movabsq $304786754066, %rax
+	cmpq $203, %rax
+	jge .L123
+	cmpq $0, %rax
+	je .L119
+	cmpq $18, %rax
+	je .L121
+	jmp .L120
+.L123:
+	cmpq $203, %rax
+	je .L122
+	cmpq $500, %rax
+	je .L119
+	jmp .L120
+.L119:
+	movl -192(%rbp), %eax
+	pushq %rax
+	movl $184, %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	movq %rax, %r9
+	movl $7, %eax
+	movq %rax, %r8
+	movl -148(%rbp), %eax
+	movq %rax, %rcx
+	movl $49, %eax
+	movq %rax, %rdx
+	movzbl -3(%rbp), %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	movzbl -3(%rbp), %eax
+	movq %rax, %r9
+	movl $-1576192303, %eax
+	movq %rax, %r8
+	movzwl -26(%rbp), %eax
+	movq %rax, %rcx
+	movl -64(%rbp), %eax
+	movq %rax, %rdx
+	movl $125, %eax
+	movq %rax, %rsi
+	movl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	subl $1, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+.L120:
+	movl $0, -44(%rbp)
+	cmpl $100, -44(%rbp)
+	jge .L125
+	.p2align 4,,10
+.L124:
+	movq $0, -24(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -216(%rbp)
+	cmpq $16, -24(%rbp)
+	jae .L127
+	.p2align 4,,10
+.L126:
+	cmpq $0, -216(%rbp)
+	je .L128
+.L127:
+	movq $1, -40(%rbp)
+	movl -44(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movl %eax, -220(%rbp)
+	cmpq $3, -40(%rbp)
+	jge .L131
+	.p2align 4,,10
+.L130:
+	cmpl $0, -220(%rbp)
+	je .L132
+.L131:
+	addl $1, -44(%rbp)
+	cmpl $100, -44(%rbp)
+	jl .L124
+.L125:
+.L121:
+.L118:
+	movl $492, %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	pushq %rax
+	movl $341, %eax
+	movq %rax, %r9
+	movl $317, %eax
+	movq %rax, %r8
+	movl $51719, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movb %al, -222(%rbp)
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $488, %rax
+	jge .L141
+	cmpq $-3, %rax
+	je .L139
+	cmpq $0, %rax
+	je .L139
+.L138:
+	movl g1(%rip), %eax
+	sall $1, %eax
+	testl %eax, %eax
+	je .L142
+	movq -56(%rbp), %rax
+	pushq %rax
+	movl $65536, %eax
+	pushq %rax
+	movl $259, %eax
+	movq %rax, %r9
+	movl $7, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl -44(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	cmpl $-583, %eax
+	setl %al
+	movzbl %al, %eax
+	movb %al, -3(%rbp)
+	movzwl -26(%rbp), %eax
+	cmpl $603, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jne .L146
+	movq -56(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L144
+.L146:
+	movq -40(%rbp), %rax
+	movq %rax, -232(%rbp)
+	imull $3, g1(%rip), %eax
+	addq -232(%rbp), %rax
+	movl %eax, g1(%rip)
+.L147:
+.L148:
+.L145:
+.L142:
+.L143:
+	movl g1(%rip), %eax
+	cmpq %rax, -40(%rbp)
+	jle .L149
+	movl $1, -44(%rbp)
+	movswq -2(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -248(%rbp)
+	movzbl -3(%rbp), %eax
+	movl %eax, -252(%rbp)
+	imull -252(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	cmpl -248(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movb %al, -3(%rbp)
+	movzbl -3(%rbp), %eax
+	movl %eax, -256(%rbp)
+	imull -256(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	cmpl -248(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movb %al, -3(%rbp)
+	movzbl -3(%rbp), %eax
+	movl %eax, -260(%rbp)
+	imull -260(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	cmpl -248(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movb %al, -3(%rbp)
+	movl $4, -44(%rbp)
+	movq $0, -40(%rbp)
+	movl g0(%rip), %eax
+	cmpq $0, -56(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzwl -26(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+.L150:
+	jmp .L137
+.L132:
+.L133:
+	addq $1, -40(%rbp)
+	cmpq $3, -40(%rbp)
+	jl .L130
+	jmp .L131
+.L128:
+.L129:
+	addq $1, -24(%rbp)
+	cmpq $16, -24(%rbp)
+	jb .L126
+	jmp .L127
+.L141:
+	cmpq $488, %rax
+	je .L139
+	cmpq $720, %rax
+	je .L137
+	jmp .L138
+.L139:
+	movl -124(%rbp), %eax
+	cmpl $247, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	addq $62500000, %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq g2(%rip), %rax
+	movq %rax, %rcx
+	cmpq $7, %rcx
+	ja .L160
+	leaq .L161(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L154
+	# table target .L159
+	# table target .L156
+	# table target .L158
+	# table target .L155
+	# table target .L157
+	jmp *%rcx
+.L160:
+.L154:
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movl $165, %eax
+	movq %rax, %r9
+	movslq g0(%rip), %rax
+	movq %rax, %r8
+	movl $32767, %eax
+	movq %rax, %rcx
+	movl -148(%rbp), %eax
+	movq %rax, %rdx
+	movl -104(%rbp), %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	imull -44(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L166
+	cmpq $2, %rax
+	je .L163
+	cmpq $5, %rax
+	je .L165
+	jmp .L162
+.L165:
+	movslq g0(%rip), %rax
+	movq %rax, -272(%rbp)
+	movq g2(%rip), %rax
+	movb %al, -273(%rbp)
+	imull $3, g1(%rip), %eax
+	addq -272(%rbp), %rax
+	movl %eax, g1(%rip)
+.L167:
+	movq -56(%rbp), %rax
+	movq %rax, -288(%rbp)
+	movl -188(%rbp), %eax
+	movb %al, -289(%rbp)
+	imull $3, g1(%rip), %eax
+	addq -288(%rbp), %rax
+	movl %eax, g1(%rip)
+.L168:
+.L166:
+	movslq -44(%rbp), %rax
+	movq %rax, -304(%rbp)
+	imull $3, g1(%rip), %eax
+	addq -304(%rbp), %rax
+	movl %eax, g1(%rip)
+.L169:
+	movl g1(%rip), %eax
+	movl %eax, -44(%rbp)
+.L162:
+	movl -44(%rbp), %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	pushq %rax
+	movl g1(%rip), %eax
+	movq %rax, %r9
+	movl $128, %eax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $92, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L153:
+.L137:
+	movq $0, -40(%rbp)
+	cmpq $33, -40(%rbp)
+	jge .L191
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -336(%rbp)
+	cmpq $0, -336(%rbp)
+	je .L194
+	.p2align 4,,10
+.L193:
+	addq $1, -40(%rbp)
+	addq $1, -40(%rbp)
+	addq $1, -40(%rbp)
+	addq $1, -40(%rbp)
+	subq $1, -336(%rbp)
+	jne .L193
+.L194:
+.L191:
+.L192:
+	cmpq $33, -40(%rbp)
+	jge .L196
+	.p2align 4,,10
+.L195:
+	addq $1, -40(%rbp)
+	cmpq $33, -40(%rbp)
+	jl .L195
+.L196:
+	movq -40(%rbp), %rax
+	subq $255, %rax
+	movw %ax, -2(%rbp)
+	movq $0, -40(%rbp)
+	movl $0, -340(%rbp)
+	movl $-140, -344(%rbp)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -352(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -360(%rbp)
+	cmpq $5, -40(%rbp)
+	jge .L198
+	.p2align 4,,10
+.L197:
+	cmpl $0, -44(%rbp)
+	je .L199
+	movzwl -26(%rbp), %eax
+	cmpl $9, %eax
+	je .L201
+.L198:
+	cmpq $0, -40(%rbp)
+	je .L206
+	movl -104(%rbp), %eax
+	addl g0(%rip), %eax
+	jne .L204
+.L206:
+	cmpq $0, g2(%rip)
+	setne %al
+	movzbl %al, %eax
+.L205:
+	movslq %eax, %rax
+	movq %rax, g2(%rip)
+	movq $0, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	movl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	addq g2(%rip), %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	movzbl -3(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	movzwl -26(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	movslq -44(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	imulq $31, -368(%rbp), %rax
+	addq -56(%rbp), %rax
+	movq %rax, -368(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L207
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -376(%rbp)
+	cmpq $0, -376(%rbp)
+	je .L210
+	.p2align 4,,10
+.L209:
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -368(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -368(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -368(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -368(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	addl $1, -44(%rbp)
+	subq $1, -376(%rbp)
+	jne .L209
+.L210:
+.L207:
+.L208:
+	cmpl $33, -44(%rbp)
+	jge .L212
+	.p2align 4,,10
+.L211:
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -368(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L211
+.L212:
+	movq -368(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -368(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -368(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -368(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -368(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -368(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -368(%rbp)
+	movq -368(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L201:
+	movswl -2(%rbp), %eax
+	movb %al, -3(%rbp)
+	movslq -344(%rbp), %rax
+	xorl %edx, %edx
+	divq -352(%rbp)
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	imull $3, g1(%rip), %eax
+	addq $716, %rax
+	movl %eax, g1(%rip)
+.L203:
+.L202:
+	movl g1(%rip), %eax
+	pushq %rax
+	movzwl -26(%rbp), %eax
+	pushq %rax
+	movl g1(%rip), %eax
+	movq %rax, %r9
+	movl $4, %eax
+	cqo
+	idivq -360(%rbp)
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movsbl %al, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L199:
+.L200:
+	movl -180(%rbp), %eax
+	movslq %eax, %rax
+	imulq -40(%rbp), %rax
+	movw %ax, -26(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $5, -40(%rbp)
+	jl .L197
+	jmp .L198
+.L204:
+	movl $1, %eax
+	jmp .L205
+.L163:
+	movq -40(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	seta %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+.L164:
+	jmp .L162
+.L149:
+	movl -172(%rbp), %eax
+	testl %eax, %eax
+	jne .LB10
+.L151:
+.L152:
+	movl $602, g0(%rip)
+	jmp .L137
+.L140:
+	jmp .L137
+.L122:
+	cmpw $0, -26(%rbp)
+	je .L134
+	cmpw $0, -26(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L135
+.L134:
+	movl $0, %eax
+.L135:
+	movzbl %al, %eax
+	movb %al, -3(%rbp)
+	movq -40(%rbp), %rax
+	movb %al, -221(%rbp)
+	imull $3, g1(%rip), %eax
+	addq $9, %rax
+	movl %eax, g1(%rip)
+.L136:
+	jmp .L118
+.L144:
+	movl -124(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -240(%rbp)
+	movq -16(%rbp), %rax
+	movb %al, -241(%rbp)
+	imull $3, g1(%rip), %eax
+	addq -240(%rbp), %rax
+	movl %eax, g1(%rip)
+	jmp .L148
+.L155:
+	addq $10, -40(%rbp)
+	movq -16(%rbp), %rax
+	addq $2, %rax
+	addq %rax, -16(%rbp)
+.L156:
+	movq -40(%rbp), %rax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movswl -2(%rbp), %eax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	movq %rax, %r8
+	movl -44(%rbp), %eax
+	movq %rax, %rcx
+	movzwl -26(%rbp), %eax
+	movq %rax, %rdx
+	movq g2(%rip), %rax
+	movq %rax, %rsi
+	movswl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $67, %rax
+	jge .L180
+	cmpq $16, %rax
+	jge .L181
+	cmpq $-3, %rax
+	je .L153
+	cmpq $4, %rax
+	je .L172
+.L173:
+.L170:
+	jmp .L153
+.L180:
+	cmpq $510, %rax
+	jge .L182
+	cmpq $67, %rax
+	je .L177
+	cmpq $426, %rax
+	je .L175
+	jmp .L153
+.L181:
+	cmpq $16, %rax
+	je .L174
+	cmpq $62, %rax
+	je .L171
+	jmp .L153
+.L182:
+	cmpq $510, %rax
+	je .L176
+	cmpq $646, %rax
+	je .L178
+	jmp .L153
+.L174:
+	movzbl -3(%rbp), %eax
+	cmpl $-9, -44(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	movq $5, -16(%rbp)
+.L175:
+	movl -152(%rbp), %eax
+	movl %eax, -144(%rbp)
+	jmp .L153
+.L176:
+	movq -24(%rbp), %rax
+	movb %al, -306(%rbp)
+	imull $3, g1(%rip), %eax
+	addq $8, %rax
+	movl %eax, g1(%rip)
+.L185:
+	jmp .L153
+.L177:
+	movl -184(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -320(%rbp)
+	movl -72(%rbp), %eax
+	movb %al, -321(%rbp)
+	imull $3, g1(%rip), %eax
+	addq -320(%rbp), %rax
+	movl %eax, g1(%rip)
+.L186:
+	movabsq $209252232904, %rax
+	movq %rax, -40(%rbp)
+	jmp .L153
+.L179:
+	jmp .L153
+.L171:
+	movq g2(%rip), %rax
+	movb %al, -305(%rbp)
+	imull $3, g1(%rip), %eax
+	addq $183, %rax
+	movl %eax, g1(%rip)
+.L183:
+	jmp .L153
+.L172:
+	imull $3, g1(%rip), %eax
+	addq $858, %rax
+	movl %eax, g1(%rip)
+.L184:
+	movslq -44(%rbp), %rax
+	addq $64, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $857, %eax
+	pushq %rax
+	movl $8, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movl $255, %eax
+	movq %rax, %r8
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movzbl -222(%rbp), %eax
+	movq %rax, %rdx
+	movl -44(%rbp), %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movl $3, %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	subq $879, %rax
+	movq %rax, %r8
+	movl $10348, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $2069365842, %eax
+	movq %rax, %rsi
+	cmpq $4, g2(%rip)
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, g2(%rip)
+	jmp .L153
+.L178:
+	movl $4294967295, %eax
+	movq %rax, -40(%rbp)
+	cmpl $0, g0(%rip)
+	jl .L153
+	cmpl $33, g0(%rip)
+	jge .L153
+	xorl %eax, %eax
+	movzwl -26(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	imulq -24(%rbp), %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L187:
+.L188:
+	jmp .L153
+.L157:
+	jmp .L153
+.L158:
+	jmp .L153
+.L159:
+	cmpq $0, g2(%rip)
+	jb .L153
+	cmpq $33, g2(%rip)
+	jae .L153
+	movl $187, %eax
+	pushq %rax
+	movslq g0(%rip), %rax
+	pushq %rax
+	movl $3, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	movswl -2(%rbp), %eax
+	movq %rax, %rdx
+	movl $-1350815225, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movq g2(%rip), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L189:
+.L190:
+	jmp .L153
+.LB10:
+	movq g2(%rip), %rax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L161:
+	.long .L159-.L161
+	.long .L156-.L161
+	.long .L158-.L161
+	.long .L158-.L161
+	.long .L155-.L161
+	.long .L154-.L161
+	.long .L155-.L161
+	.long .L157-.L161
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
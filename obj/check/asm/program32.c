@@ -0,0 +1,95 @@
+int main() {
+    short v0 = 774;
+    short v1 = 255;
+    unsigned short v2 = 761;
+    int i0 = 255;
+    long j0 = 32767;
+    if ((unsigned long)(((v2 / 2) + (392 - 9)))) {
+        j0 = -(((j0 - 313) + (2147483647 >= 9)));
+        v1 = (270 || (long)(7));
+        if (867) {
+            v1 = 73138395759l;
+            if (!((-(5) * (7 + 7)))) {
+                if (((v2 <= 796) + (5 - 569))) { return 3; }
+            }
+        } else {
+            v1 = v1 + (short)((9 - i0));
+            i0 = ((5579064194 + 10) - -(v0));
+            switch ((short)(-(i0))) {
+            case 501:
+                i0 = (((8 == 514) || 674) / 4);
+                if ((v0 / 1024)) { return -((1 > j0)); }
+            case 760:
+                v1 = 9;
+                j0 = (v1 + (v1 + j0));
+                break;
+            default:
+                break;
+            case 62:
+                if (375) { return ((v2 + 5) == v0); }
+                break;
+            case 279:
+                if (!(1000000007)) { return i0; }
+            case 701:
+                break;
+            case 2:
+                i0 = ((3 / (v2 * v2 + 1)) / 3u);
+                break;
+            }
+        }
+    } else {
+        v0 = 786;
+        v1 = ((int)(v1) == (char)((v2 > 958)));
+    }
+    v1 = v1 + 157958850383;
+    if ((unsigned long)(v2)) {
+        switch (v1) {
+        default:
+            j0 = j0 + ((v2 == v0) >= 2);
+        case 9:
+        case 10:
+            j0 = 0;
+            while (j0 < 4) {
+                v0 = 127L;
+                j0 = j0 + 1;
+            }
+            break;
+        case 4:
+            j0 = j0 + v0;
+            break;
+        case 0:
+            v0 = v0 + v0;
+            v1 = 0;
+            while (v1 < 33) {
+                if (((7 || v2) == !(4))) { break; }
+                if (237349897860) { break; }
+                v1 = v1 + 1;
+            }
+        }
+    } else {
+        if (v1) {
+            for (v0 = 1; v0 < 16; v0 = v0 + 1) {
+                j0 = j0 + ((v2 >= 655u) == 3);
+                if (v2) { break; }
+            }
+            v0 = v2;
+        }
+        j0 = 0;
+        while (j0 < 17) {
+            v2 = ((2 < 3) / 7);
+            if ((1 == (j0 != 184))) { break; }
+            j0 = j0 + 1;
+        }
+    }
+    v2 = 0;
+    if ((short)((723250211734 <= 393179504128))) { return (v1 || 2); }
+    i0 = v2;
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,236 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movw $774, -26(%rbp)
+	movw $255, -24(%rbp)
+	movw $761, -22(%rbp)
+	movq $32767, -16(%rbp)
+	movzwl -22(%rbp), %eax
+	movl %eax, -8(%rbp)
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	addl $383, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L0
+	movq -16(%rbp), %rax
+	subq $313, %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movw $23151, -24(%rbp)
+	jmp .L1
+.L0:
+	movw $786, -26(%rbp)
+	cmpl $958, -8(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movswl -24(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -24(%rbp)
+.L1:
+	movswq -24(%rbp), %rax
+	movabsq $157958850383, %rcx
+	addq %rcx, %rax
+	movw %ax, -24(%rbp)
+	movzwl -22(%rbp), %eax
+	testq %rax, %rax
+	je .L2
+	movswl -24(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L8
+	cmpq $4, %rax
+	je .L7
+	leaq -9(%rax), %rcx
+	cmpq $1, %rcx
+	jbe .L6
+.L5:
+	movswl -26(%rbp), %eax
+	cmpl %eax, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $2, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+.L6:
+	movw $127, -26(%rbp)
+	movq $4, -16(%rbp)
+	jmp .L3
+.L2:
+	cmpw $0, -24(%rbp)
+	je .L13
+	movw $1, -26(%rbp)
+	movzwl -22(%rbp), %eax
+	cmpl $655, %eax
+	setae %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $16, %eax
+	jge .L16
+	.p2align 4,,10
+.L15:
+	movslq -20(%rbp), %rax
+	addq %rax, -16(%rbp)
+	cmpw $0, -22(%rbp)
+	je .L17
+.L16:
+	movzwl -22(%rbp), %eax
+	movw %ax, -26(%rbp)
+.L13:
+.L14:
+	movq $0, -16(%rbp)
+	movl $0, -8(%rbp)
+	cmpq $17, -16(%rbp)
+	jge .L20
+	.p2align 4,,10
+.L19:
+	movl -8(%rbp), %eax
+	cmpq $184, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	jne .L21
+.L20:
+.L3:
+	movw $0, -22(%rbp)
+	movzwl -22(%rbp), %eax
+	movl %eax, -20(%rbp)
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movswq -26(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movswq -24(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzwl -22(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	leave
+	ret
+.L21:
+.L22:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L19
+	jmp .L20
+.L17:
+.L18:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -26(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $16, %eax
+	jl .L15
+	jmp .L16
+.L8:
+	movswl -26(%rbp), %eax
+	movl %eax, -8(%rbp)
+	addl -8(%rbp), %eax
+	movw %ax, -26(%rbp)
+	movw $0, -24(%rbp)
+	movl $1, -8(%rbp)
+	movswl -24(%rbp), %eax
+	cmpl $33, %eax
+	jge .L3
+	.p2align 4,,10
+.L9:
+	cmpl $0, -8(%rbp)
+	jne .L3
+.L10:
+.L4:
+	jmp .L3
+.L11:
+.L12:
+	jmp .L3
+.L7:
+	movswq -26(%rbp), %rax
+	addq %rax, -16(%rbp)
+	jmp .L3
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,116 @@
+unsigned short g0 = 3;
+int f0(unsigned int p0, int p1, unsigned char p2, unsigned long p3, unsigned int p4) {
+    unsigned int v0 = 8;
+    long v1 = 8;
+    unsigned char v2 = 32767;
+    int i0 = 2;
+    long j0 = 7;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 694; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 4u; }
+    if (((p0 - 4294967295) + -(p2))) { return 385ul; }
+    if (!(p4)) { return ((la1[6] + 65535) + (v2 > 1)); }
+    v2 = (p0 <= (434 <= (la1[6] <= p3)));
+    if (!((118 <= 554314761750))) {
+        switch ((char)(-(919u))) {
+        case 3:
+            for (p3 = 0; p3 < 4; p3 = p3 + 1) {
+                la1[p3] = ((302933165590 < 8) * (0 > la1[1]));
+                if ((la0[3] * (572 == i0))) { return ((p4 >= la0[11]) / (p3 * p3 + 1)); }
+            }
+            p3 = (((10 <= p1) / 100) / 1);
+            break;
+        case 2:
+        case 0:
+            p0 = 1051823037258;
+            break;
+        case 7:
+            if ((short)((278 == 5l))) { return (unsigned int)((p0 && 802)); }
+            break;
+        default:
+            switch ((la1[2] / (v0 * v0 + 1))) {
+            case 9:
+            case 959:
+                if (47L) { return (227 || 652); }
+            default:
+                if (1241005811) { return p2; }
+                i0 = (((636 + p2) / 3u) / 13ul);
+                break;
+            case -5:
+                if (((167320882949 / (v1 * v1 + 1)) - 6)) { return (!(p2) + 744078233218ul); }
+                if (4) { return -(la1[5]); }
+                break;
+            case 362:
+                j0 = j0 + (5 && 710);
+                v0 = ((unsigned char)(604) / (v0 * v0 + 1));
+            }
+            break;
+        case 9:
+            if ((5 * 264)) { return -(j0); }
+            break;
+        }
+    } else {
+        for (p0 = 1; p0 < 3; p0 = p0 + 1) {
+            p3 = !(la0[15]);
+            switch (-((377 < i0))) {
+            case 8:
+                break;
+            case 711:
+                if (332) { return (p1 || g0); }
+                if ((unsigned short)((8 || j0))) { return (p0 && g0); }
+            case 37:
+                if ((1 == 253479234325)) { break; }
+                if (la0[p0] < p1) { p1 = la0[p0]; }
+                break;
+            }
+            j0 = j0 + (3 < (4294967295 + 2));
+        }
+    }
+    p3 = (((3 || v0) >= p4) && (0 / 10));
+    return ((p3 == (i0 / 8)) - -(v2));
+}
+long rec(long n, long acc) {
+    if (n < 3 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 3, acc);
+}
+int main() {
+    long v0 = 737;
+    unsigned long v1 = 405;
+    int i0 = 0U;
+    long j0 = 4294967295;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 761; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 6; }
+    for (v1 = 2; v1 < 17; v1 = v1 + 1) {
+        la0[v1] = 1000000007;
+        for (v0 = 0; v0 < 33; v0 = v0 + 1) {
+            if (j0 >= 0 && j0 < 4) { la1[j0] = j0; }
+            if (f0(i0, !(v0), j0, i0, (v0 || g0))) {
+                if (8l) { break; }
+                if ((unsigned long)(f0(100, 825, 7, 743915862743, 5))) { break; }
+            }
+            la0[v0] = (v0 < i0);
+        }
+        g0 = (((i0 < 733206445849l) + g0) * (short)((j0 != v1)));
+    }
+    for (v1 = 2; v1 < 4; v1 = v1 + 1) {
+        f0(f0(g0, v1, v1, 0, i0), !(i0), (v0 * g0), 6, -(la0[16]));
+    }
+    g0 = v1;
+    if ((((unsigned int)(5) >= f0(639, 284, v1, i0, g0)) != rec(2, 5))) {
+        g0 = j0;
+        if (i0) { return rec(la1[3], v0); }
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1678 @@
+	.section .data
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.short 3
+	.section .text
+	.type f0, @function
+	.type rec, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movq %rcx, -24(%rbp)
+	movl %r8d, -28(%rbp)
+	movl $8, -32(%rbp)
+	movq $8, -40(%rbp)
+	movb $255, -41(%rbp)
+	movl $2, -48(%rbp)
+	movq $7, -56(%rbp)
+	movl $0, -48(%rbp)
+	imull $694, -48(%rbp), %eax
+	subl $694, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -48(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $694, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $694, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $694, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $694, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -144(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -48(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $694, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L4
+.L5:
+	movl $0, -48(%rbp)
+	cmpl $8, -48(%rbp)
+	jge .L6
+	movl $8, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -184(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $8, -48(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movl -48(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $8, -48(%rbp)
+	jl .L10
+.L11:
+	movzbl -9(%rbp), %eax
+	movl %eax, -188(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -4(%rbp), %eax
+	movl $4294967295, %ecx
+	subq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	jne .LB0
+.L12:
+.L13:
+	cmpl $0, -28(%rbp)
+	je .LB1
+.L14:
+.L15:
+	movl -152(%rbp), %eax
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	setbe %al
+	movzbl %al, %eax
+	cmpl $434, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpl %eax, -4(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movb %al, -41(%rbp)
+	movabsq $554314761750, %rax
+	cmpq $118, %rax
+	jge .L16
+	xorl %eax, %eax
+	subl $919, %eax
+	movsbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L24
+	leaq .L25(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L22
+	# table target .L20
+	# table target .L19
+	# table target .L21
+	# table target .L23
+	jmp *%rcx
+.L16:
+	movl $1, -4(%rbp)
+	xorl %eax, %eax
+	cmpl $377, -48(%rbp)
+	setg %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movl %eax, -212(%rbp)
+	movabsq $253479234325, %rax
+	cmpq $1, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -216(%rbp)
+	movl $4294967295, %eax
+	addq $2, %rax
+	cmpq $3, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -220(%rbp)
+	cmpl $3, -4(%rbp)
+	jae .L63
+	.p2align 4,,10
+.L62:
+	movl -68(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -212(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	je .L65
+	cmpq $37, %rax
+	je .L67
+	cmpq $711, %rax
+	je .L66
+.L65:
+.L64:
+	movslq -220(%rbp), %rax
+	addq %rax, -56(%rbp)
+	addl $1, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L62
+.L63:
+.L17:
+	movl $3, %eax
+	testl %eax, %eax
+	jne .L84
+	cmpl $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L85
+.L72:
+.L73:
+.L67:
+	cmpl $0, -216(%rbp)
+	je .L78
+	jmp .L64
+.L84:
+	movl $1, %eax
+.L85:
+	cmpl -28(%rbp), %eax
+	jb .L82
+	xorl %eax, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L83
+.L82:
+	movl $0, %eax
+.L83:
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	xorl %eax, %eax
+	movzbl -41(%rbp), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movl -48(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	subl %ecx, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L78:
+.L79:
+	movl -4(%rbp), %eax
+	movq %rax, -232(%rbp)
+	movl -128(%rbp,%rax,4), %eax
+	cmpl -8(%rbp), %eax
+	jge .L64
+	movq -232(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movl %eax, -8(%rbp)
+.L80:
+.L81:
+	jmp .L64
+.L66:
+	movl $332, %eax
+	testl %eax, %eax
+	je .L68
+	cmpl $0, -8(%rbp)
+	jne .L70
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L24:
+.L22:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -168(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movslq %eax, %rax
+	cmpq $362, %rax
+	jge .L47
+	cmpq $-5, %rax
+	je .L45
+	cmpq $9, %rax
+	je .L43
+.L48:
+.L49:
+.L44:
+	movl $1241005811, %eax
+	testl %eax, %eax
+	jne .LB2
+.L52:
+.L53:
+	movl -188(%rbp), %eax
+	addl $636, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -48(%rbp)
+.L42:
+.L18:
+	jmp .L17
+.L68:
+.L69:
+	movl $8, %eax
+	testl %eax, %eax
+	jne .L74
+	cmpq $0, -56(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L75
+.L74:
+	movl $1, %eax
+.L75:
+	testw %ax, %ax
+	je .L72
+	cmpl $0, -4(%rbp)
+	je .L76
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L47:
+	cmpq $362, %rax
+	je .L46
+	cmpq $959, %rax
+	je .L43
+	jmp .L44
+.L43:
+	movl $47, %eax
+	testq %rax, %rax
+	je .L48
+	movl $227, %eax
+	testl %eax, %eax
+	jne .L50
+	movl $652, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L45:
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movabsq $167320882949, %rax
+	cqo
+	idivq %rcx
+	subq $6, %rax
+	jne .LB3
+.L54:
+.L55:
+	movl $4, %eax
+	testl %eax, %eax
+	jne .LB4
+.L56:
+.L57:
+	jmp .L17
+.L46:
+	movl $5, %eax
+	testl %eax, %eax
+	je .L58
+	movl $710, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L59
+.L58:
+	movl $0, %eax
+.L59:
+	movslq %eax, %rax
+	addq %rax, -56(%rbp)
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $92, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -32(%rbp)
+	jmp .L17
+.L19:
+	movq $0, -24(%rbp)
+	movabsq $302933165590, %rax
+	cmpq $8, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -192(%rbp)
+	cmpl $572, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	cmpq $4, -24(%rbp)
+	jae .L26
+	movl $4, %eax
+	subq -24(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L29
+	.p2align 4,,10
+.L28:
+	movl -172(%rbp), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	imull -192(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	movl -116(%rbp), %eax
+	imull -196(%rbp), %eax
+	testl %eax, %eax
+	jne .LB5
+.L30:
+.L31:
+	addq $1, -24(%rbp)
+	movl -172(%rbp), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	imull -192(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	movl -116(%rbp), %eax
+	imull -196(%rbp), %eax
+	testl %eax, %eax
+	jne .LB6
+.L32:
+.L33:
+	addq $1, -24(%rbp)
+	subq $1, -208(%rbp)
+	jne .L28
+.L29:
+.L26:
+.L27:
+	cmpq $4, -24(%rbp)
+	jae .L35
+	.p2align 4,,10
+.L34:
+	movl -172(%rbp), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	imull -192(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	movl -116(%rbp), %eax
+	imull -196(%rbp), %eax
+	testl %eax, %eax
+	jne .LB7
+.L36:
+.L37:
+	addq $1, -24(%rbp)
+	cmpq $4, -24(%rbp)
+	jb .L34
+.L35:
+	cmpl $10, -8(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	jmp .L17
+.L20:
+	movl $3851017034, -4(%rbp)
+	jmp .L17
+.L21:
+	movl $278, %eax
+	cmpq $5, %rax
+	sete %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	je .L17
+	cmpl $0, -4(%rbp)
+	je .L40
+	movl $802, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L38:
+.L39:
+	jmp .L17
+.L23:
+	movl $5, %eax
+	imull $264, %eax, %eax
+	testl %eax, %eax
+	jne .LB8
+.L60:
+.L61:
+	jmp .L17
+.LB0:
+	movl $385, %eax
+	jmp .f0_return
+.LB1:
+	movzbl -41(%rbp), %eax
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -152(%rbp), %eax
+	addl $65535, %eax
+	addl %ecx, %eax
+	jmp .f0_return
+.L70:
+	movl $1, %eax
+.L71:
+	jmp .f0_return
+.L76:
+	movl $0, %eax
+.L77:
+	jmp .f0_return
+.LB7:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	cmpl %eax, -28(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	jmp .f0_return
+.LB5:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	cmpl %eax, -28(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	jmp .f0_return
+.L50:
+	movl $1, %eax
+.L51:
+	jmp .f0_return
+.LB6:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	cmpl %eax, -28(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	jmp .f0_return
+.LB2:
+	movl -188(%rbp), %eax
+	jmp .f0_return
+.L40:
+	movl $0, %eax
+.L41:
+	jmp .f0_return
+.LB3:
+	cmpb $0, -9(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $744078233218, %rcx
+	addq %rcx, %rax
+	jmp .f0_return
+.LB4:
+	xorl %eax, %eax
+	movl -156(%rbp), %ecx
+	subl %ecx, %eax
+	jmp .f0_return
+.LB8:
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L25:
+	.long .L20-.L25
+	.long .L22-.L25
+	.long .L20-.L25
+	.long .L19-.L25
+	.long .L22-.L25
+	.long .L22-.L25
+	.long .L22-.L25
+	.long .L21-.L25
+	.long .L22-.L25
+	.long .L23-.L25
+	.popsection
+	.align 16
+rec:
+	cmpq $3, %rdi
+	jl .L88
+	cmpq $18, %rdi
+	jg .L88
+.L86:
+.L87:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rdi, -64(%rbp)
+	movq %rsi, -56(%rbp)
+	movq %rdi, %rax
+	subq $3, %rax
+	movq %rax, -48(%rbp)
+	movq %rsi, %rax
+	movq %rax, -40(%rbp)
+	cmpq $3, -48(%rbp)
+	jl .L92
+	cmpq $18, -48(%rbp)
+	jle .L90
+.L92:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L89:
+	pushq %rax
+	movq -64(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -48(%rbp)
+	movq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -40(%rbp)
+	cmpq $3, -48(%rbp)
+	jl .L120
+	cmpq $18, -48(%rbp)
+	jle .L118
+.L120:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L117:
+	popq %rcx
+	addq %rcx, %rax
+	leave
+	ret
+.L90:
+.L91:
+	movq -48(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L96
+	cmpq $18, -32(%rbp)
+	jle .L94
+.L96:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L93:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L108
+	cmpq $18, -32(%rbp)
+	jle .L106
+.L108:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L105:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L89
+.L118:
+.L119:
+	movq -48(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L124
+	cmpq $18, -32(%rbp)
+	jle .L122
+.L124:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L121:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L136
+	cmpq $18, -32(%rbp)
+	jle .L134
+.L136:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L133:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L117
+.L94:
+.L95:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L100
+	cmpq $18, -16(%rbp)
+	jle .L98
+.L100:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L97:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L104
+	cmpq $18, -16(%rbp)
+	jle .L102
+.L104:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L101:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L93
+.L106:
+.L107:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L112
+	cmpq $18, -16(%rbp)
+	jle .L110
+.L112:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L109:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L116
+	cmpq $18, -16(%rbp)
+	jle .L114
+.L116:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L113:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L105
+.L122:
+.L123:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L128
+	cmpq $18, -16(%rbp)
+	jle .L126
+.L128:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L125:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L132
+	cmpq $18, -16(%rbp)
+	jle .L130
+.L132:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L129:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L121
+.L134:
+.L135:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L140
+	cmpq $18, -16(%rbp)
+	jle .L138
+.L140:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L137:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L144
+	cmpq $18, -16(%rbp)
+	jle .L142
+.L144:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L141:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L133
+.L98:
+.L99:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L97
+.L102:
+.L103:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L101
+.L110:
+.L111:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L109
+.L114:
+.L115:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L113
+.L126:
+.L127:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L125
+.L130:
+.L131:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L129
+.L138:
+.L139:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L137
+.L142:
+.L143:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L141
+.L88:
+	movq %rsi, %rax
+	addq %rdi, %rax
+	ret
+	.size rec, .-rec
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $368, %rsp
+	movq $737, -8(%rbp)
+	movq $405, -16(%rbp)
+	movl $0, -20(%rbp)
+	movl $4294967295, %eax
+	movq %rax, -32(%rbp)
+	movl $0, -20(%rbp)
+	imull $761, -20(%rbp), %eax
+	subl $761, %eax
+	movl %eax, -180(%rbp)
+	cmpl $33, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -184(%rbp)
+	testl %eax, %eax
+	je .L145
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L148
+	.p2align 4,,10
+.L147:
+	addl $761, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $761, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $761, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $761, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -192(%rbp)
+	jne .L147
+.L148:
+.L145:
+.L146:
+	cmpl $33, -20(%rbp)
+	jge .L150
+	.p2align 4,,10
+.L149:
+	addl $761, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L149
+.L150:
+	movl $0, -20(%rbp)
+	movl $0, -208(%rbp)
+	movl $6, -204(%rbp)
+	movl $12, -200(%rbp)
+	movl $18, -196(%rbp)
+	movl $4, -20(%rbp)
+	movq $2, -16(%rbp)
+	cmpq $0, -32(%rbp)
+	jl .L151
+	cmpq $4, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L152
+.L151:
+	movl $0, %eax
+.L152:
+	movl %eax, -212(%rbp)
+	movslq -20(%rbp), %rax
+	movq %rax, -224(%rbp)
+	movabsq $733206445849, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -216(%rbp)
+	cmpq $17, -16(%rbp)
+	jae .L154
+	.p2align 4,,10
+.L153:
+	movq -16(%rbp), %rax
+	movl $1000000007, -176(%rbp,%rax,4)
+	movq $0, -8(%rbp)
+	movl -212(%rbp), %eax
+	movl %eax, -228(%rbp)
+	cmpq $33, -8(%rbp)
+	jge .L156
+	.p2align 4,,10
+.L155:
+	cmpl $0, -228(%rbp)
+	je .L157
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+.L157:
+.L158:
+	cmpq $0, -8(%rbp)
+	jne .L161
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L162
+.L159:
+.L160:
+	movq -8(%rbp), %rax
+	cmpq -224(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addq $1, -8(%rbp)
+	cmpq $33, -8(%rbp)
+	jl .L155
+	jmp .L156
+.L168:
+.L169:
+	movq -240(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -304(%rbp)
+	movq -248(%rbp), %rax
+	movq %rax, -312(%rbp)
+	cmpq $3, -304(%rbp)
+	jl .L174
+	cmpq $18, -304(%rbp)
+	jle .L172
+.L174:
+	movq -312(%rbp), %rax
+	addq -304(%rbp), %rax
+.L171:
+	pushq %rax
+	movq -240(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -256(%rbp)
+	movq -248(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -264(%rbp)
+	cmpq $3, -256(%rbp)
+	jl .L186
+	cmpq $18, -256(%rbp)
+	jle .L184
+.L186:
+	movq -264(%rbp), %rax
+	addq -256(%rbp), %rax
+.L183:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .main_return
+.L172:
+.L173:
+	movq -304(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -336(%rbp)
+	movq -312(%rbp), %rax
+	movq %rax, -344(%rbp)
+	cmpq $3, -336(%rbp)
+	jl .L178
+	cmpq $18, -336(%rbp)
+	jle .L176
+.L178:
+	movq -344(%rbp), %rax
+	addq -336(%rbp), %rax
+.L175:
+	pushq %rax
+	movq -304(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -320(%rbp)
+	movq -312(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -328(%rbp)
+	cmpq $3, -320(%rbp)
+	jl .L182
+	cmpq $18, -320(%rbp)
+	jle .L180
+.L182:
+	movq -328(%rbp), %rax
+	addq -320(%rbp), %rax
+.L179:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L171
+.L184:
+.L185:
+	movq -256(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -288(%rbp)
+	movq -264(%rbp), %rax
+	movq %rax, -296(%rbp)
+	cmpq $3, -288(%rbp)
+	jl .L190
+	cmpq $18, -288(%rbp)
+	jle .L188
+.L190:
+	movq -296(%rbp), %rax
+	addq -288(%rbp), %rax
+.L187:
+	pushq %rax
+	movq -256(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -272(%rbp)
+	movq -264(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -280(%rbp)
+	cmpq $3, -272(%rbp)
+	jl .L194
+	cmpq $18, -272(%rbp)
+	jle .L192
+.L194:
+	movq -280(%rbp), %rax
+	addq -272(%rbp), %rax
+.L191:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L183
+.L176:
+.L177:
+	movq -344(%rbp), %rax
+	movq %rax, %rsi
+	movq -336(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -344(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -336(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L175
+.L180:
+.L181:
+	subq $8, %rsp
+	movq -328(%rbp), %rax
+	movq %rax, %rsi
+	movq -320(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -328(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -320(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L179
+.L188:
+.L189:
+	subq $8, %rsp
+	movq -296(%rbp), %rax
+	movq %rax, %rsi
+	movq -288(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -296(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -288(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L187
+.L192:
+.L193:
+	movq -280(%rbp), %rax
+	movq %rax, %rsi
+	movq -272(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -280(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -272(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L191
+.L165:
+.L166:
+.L163:
+.L164:
+	movq $0, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	addq -224(%rbp), %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -352(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $0, -184(%rbp)
+	je .L195
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -360(%rbp)
+	cmpq $0, -360(%rbp)
+	je .L198
+	.p2align 4,,10
+.L197:
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -360(%rbp)
+	jne .L197
+.L198:
+.L195:
+.L196:
+	cmpl $33, -20(%rbp)
+	jge .L200
+	.p2align 4,,10
+.L199:
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L199
+.L200:
+	movl $0, -20(%rbp)
+	movl -208(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	movl -204(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	movl -200(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	movl -196(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	movl $4, -20(%rbp)
+	movq -352(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -352(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -352(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -352(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -352(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -352(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	movq -352(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L161:
+	movl $1, %eax
+.L162:
+	movq %rax, %r8
+	movslq -20(%rbp), %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	cmpq $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -20(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	je .L159
+.L156:
+	movq -32(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	addl -216(%rbp), %eax
+	imull %ecx, %eax
+	movw %ax, g0(%rip)
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jb .L153
+.L154:
+	movq $2, -16(%rbp)
+	xorl %eax, %eax
+	movl -112(%rbp), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	movzwl g0(%rip), %eax
+	imulq -8(%rbp), %rax
+	pushq %rax
+	cmpl $0, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	movl %eax, -232(%rbp)
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movzwl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f0
+	xorl %eax, %eax
+	movl -112(%rbp), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	movzwl g0(%rip), %eax
+	imulq -8(%rbp), %rax
+	pushq %rax
+	cmpl $0, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -232(%rbp), %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movzwl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f0
+	movq $4, -16(%rbp)
+	movq -16(%rbp), %rax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	movq %rax, %r8
+	movslq -20(%rbp), %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movq %rax, %rdx
+	movl $284, %eax
+	movq %rax, %rsi
+	movl $639, %eax
+	movq %rax, %rdi
+	call f0
+	cmpl $5, %eax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $7, %rax
+	je .L163
+	movq -32(%rbp), %rax
+	movw %ax, g0(%rip)
+	cmpl $0, -20(%rbp)
+	je .L165
+	movl -196(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -240(%rbp)
+	movq -8(%rbp), %rax
+	movq %rax, -248(%rbp)
+	cmpq $3, -240(%rbp)
+	jl .L170
+	cmpq $18, -240(%rbp)
+	jle .L168
+.L170:
+	movq -248(%rbp), %rax
+	addq -240(%rbp), %rax
+.L167:
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
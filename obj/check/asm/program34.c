@@ -0,0 +1,117 @@
+unsigned long g0 = 1L;
+unsigned short g1 = 5;
+int ga0[8];
+int ga1[33];
+long rec(long n, long acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 1, acc * 3 + n);
+}
+int main() {
+    char v0 = 423;
+    unsigned long v1 = 6;
+    short v2 = 10;
+    unsigned short v3 = 936809599757L;
+    short v4 = 569;
+    int v5 = 8;
+    int i0 = 0;
+    long j0 = 43;
+    v5 = ((128 <= 3) + 0);
+    rec((g0 / 1), (9 * 565));
+    rec((int)(v1), (2u && 4));
+    switch ((!(ga1[20]) * 7)) {
+    case 6:
+        break;
+    default:
+        g1 = g1 + (v0 < 461);
+        break;
+    case 10:
+        for (v1 = 2; v1 < 8; v1 = v1 + 1) {
+            switch (rec(3, v2)) {
+            case 12:
+                if (ga0[v1] < j0) { j0 = ga0[v1]; }
+                break;
+            case 253:
+                if (j0) { break; }
+                v0 = v0 + ga1[26];
+                break;
+            case 3:
+                v3 = 155;
+                if (v4) { break; }
+                break;
+            case 10:
+                v2 = (char)((487 + (long)(v4)));
+                if (i0) { break; }
+            case 230:
+                j0 = -(-(rec(v1, 9)));
+            case 42:
+                break;
+            }
+        }
+        switch (v2) {
+        case 1:
+            j0 = 0;
+            while (j0 < 100) {
+                v0 = v0 + 924;
+                j0 = j0 + 1;
+            }
+            i0 = i0 + rec(7, 608);
+        default:
+            break;
+        case 0:
+            v1 = rec(10, i0);
+            break;
+        case 6:
+            if (!(j0)) { return ((i0 + 7) - (unsigned int)(67)); }
+            v0 = v0 + !((655 / (v1 * v1 + 1)));
+            break;
+        case 7:
+            v3 = v3 + ((1093793586952 >= ga0[2]) > (ga1[13] / 2));
+            if (((v0 + rec(309, v1)) + 2)) {
+                rec(-(g0), 629);
+                i0 = (int)(rec(0, v5));
+            }
+            break;
+        }
+        break;
+    case 2:
+        v5 = (0 + rec(v3, 5l));
+        break;
+    case 9:
+        break;
+    case 3:
+        break;
+    case 4:
+        v0 = (rec(v5, v0) <= 864);
+        if (rec(286, 1026558581307l)) {
+            v2 = 0;
+            while (v2 < 4) {
+                if ((unsigned short)(rec(10, 4294967295L))) { break; }
+                v2 = v2 + 1;
+            }
+            v3 = v0;
+        } else {
+            rec(v0, !(ga1[2]));
+            v1 = v1 + (v2 + ga0[1]);
+        }
+    }
+    for (j0 = 1; j0 < 8; j0 = j0 + 1) {
+        g0 = ((702 / 1024) / (v4 * v4 + 1));
+    }
+    v5 = rec(v2, -(v3));
+    v1 = (v4 <= (unsigned short)(v2));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
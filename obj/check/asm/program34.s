@@ -0,0 +1,1068 @@
+	.section .data
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.quad 1
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.short 5
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.type rec, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rdi, -16(%rbp)
+	movq %rsi, -8(%rbp)
+.rec_entry:
+	cmpq $5, -16(%rbp)
+	jl .L2
+	cmpq $18, -16(%rbp)
+	jg .L2
+.L0:
+.L1:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	popq %rax
+	movq %rax, -8(%rbp)
+	jmp .rec_entry
+.L2:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movb $-89, -63(%rbp)
+	movq $6, -48(%rbp)
+	movw $10, -62(%rbp)
+	movw $4877, -60(%rbp)
+	movw $569, -58(%rbp)
+	movl $0, -52(%rbp)
+	movq $43, -40(%rbp)
+	movl $0, -56(%rbp)
+	movq g0(%rip), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L6
+	cmpq $18, -8(%rbp)
+	jle .L4
+.L6:
+	movq -8(%rbp), %rax
+	addq $5085, %rax
+.L3:
+	movq -48(%rbp), %rax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L18
+	cmpq $18, -8(%rbp)
+	jle .L16
+.L18:
+	movq -8(%rbp), %rax
+	addq $1, %rax
+.L15:
+	movl ga1+80(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	imull $7, %eax, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L35
+	leaq .L36(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L29
+	# table target .L31
+	# table target .L33
+	# table target .L34
+	# table target .L28
+	# table target .L32
+	# table target .L30
+	jmp *%rcx
+.L35:
+.L29:
+	movsbl -63(%rbp), %eax
+	cmpl $461, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl g1(%rip), %eax
+	addl %ecx, %eax
+	movw %ax, g1(%rip)
+.L27:
+	movswl -58(%rbp), %eax
+	movl %eax, -32(%rbp)
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	xorl %eax, %eax
+	cltd
+	idivl -8(%rbp)
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movq %rax, g0(%rip)
+	movq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movq $8, -40(%rbp)
+	movswq -62(%rbp), %rax
+	movq %rax, -16(%rbp)
+	xorl %eax, %eax
+	movzwl -60(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L138
+	cmpq $18, -16(%rbp)
+	jle .L136
+.L138:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L135:
+	movl %eax, -56(%rbp)
+	movswl -62(%rbp), %eax
+	movzwl %ax, %eax
+	cmpl %eax, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzwl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq -63(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movswq -62(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzwl -60(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movswq -58(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -56(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -52(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jge .L147
+	movl $8, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L150
+	.p2align 4,,10
+.L149:
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	subq $1, -8(%rbp)
+	jne .L149
+.L150:
+.L147:
+.L148:
+	cmpl $8, -52(%rbp)
+	jge .L152
+	.p2align 4,,10
+.L151:
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jl .L151
+.L152:
+	movl $0, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jge .L153
+	movl $33, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L156
+	.p2align 4,,10
+.L155:
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	subq $1, -8(%rbp)
+	jne .L155
+.L156:
+.L153:
+.L154:
+	cmpl $33, -52(%rbp)
+	jge .L158
+	.p2align 4,,10
+.L157:
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jl .L157
+.L158:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L136:
+.L137:
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -24(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L142
+	cmpq $18, -24(%rbp)
+	jle .L140
+.L142:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L139:
+	jmp .L135
+.L4:
+.L5:
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	addq $15255, %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L10
+	cmpq $18, -24(%rbp)
+	jle .L8
+.L10:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L7:
+	jmp .L3
+.L16:
+.L17:
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	addq $3, %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L22
+	cmpq $18, -24(%rbp)
+	jle .L20
+.L22:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L19:
+	jmp .L15
+.L140:
+.L141:
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L146
+	cmpq $18, -16(%rbp)
+	jle .L144
+.L146:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L143:
+	jmp .L135
+.L8:
+.L9:
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L14
+	cmpq $18, -16(%rbp)
+	jle .L12
+.L14:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L11:
+	jmp .L3
+.L20:
+.L21:
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L26
+	cmpq $18, -16(%rbp)
+	jle .L24
+.L26:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L23:
+	jmp .L15
+.L144:
+.L145:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L135
+.L12:
+.L13:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L3
+.L24:
+.L25:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L15
+.L28:
+	jmp .L27
+.L30:
+	movq $2, -48(%rbp)
+	movswq -58(%rbp), %rax
+	addq $487, %rax
+	movq %rax, -32(%rbp)
+	cmpq $8, -48(%rbp)
+	jae .L38
+	.p2align 4,,10
+.L37:
+	movswq -62(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	addq $3, %rax
+.L46:
+	cmpq $42, %rax
+	jge .L47
+	cmpq $3, %rax
+	je .L42
+	cmpq $10, %rax
+	je .L43
+	cmpq $12, %rax
+	je .L40
+	jmp .L39
+.L47:
+	cmpq $42, %rax
+	je .L45
+	cmpq $230, %rax
+	je .L44
+	cmpq $253, %rax
+	je .L41
+	jmp .L39
+.L54:
+.L55:
+.L44:
+	movq -48(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L59
+	cmpq $18, -8(%rbp)
+	jle .L57
+.L59:
+	movq -8(%rbp), %rax
+	addq $9, %rax
+.L56:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -40(%rbp)
+.L45:
+.L39:
+	addq $1, -48(%rbp)
+	cmpq $8, -48(%rbp)
+	jb .L37
+.L38:
+	movswl -62(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $7, %rcx
+	ja .L27
+	leaq .L75(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L70
+	# table target .L71
+	# table target .L69
+	# table target .L72
+	# table target .L73
+	jmp *%rcx
+.L42:
+	movw $155, -60(%rbp)
+	cmpw $0, -58(%rbp)
+	je .L39
+	jmp .L39
+.L52:
+.L53:
+	jmp .L39
+.L43:
+	movq -32(%rbp), %rax
+	movsbl %al, %eax
+	movw %ax, -62(%rbp)
+	cmpl $0, -52(%rbp)
+	je .L54
+	jmp .L39
+.L74:
+.L70:
+.L68:
+	jmp .L27
+.L40:
+	movq -48(%rbp), %rax
+	movq %rax, -8(%rbp)
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq -40(%rbp), %rax
+	jge .L39
+	movq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L48:
+.L49:
+	jmp .L39
+.L41:
+	cmpq $0, -40(%rbp)
+	je .L50
+	jmp .L39
+.L57:
+.L58:
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	addq $27, %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L63
+	cmpq $18, -24(%rbp)
+	jle .L61
+.L63:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L60:
+	jmp .L56
+.L50:
+.L51:
+	movsbl -63(%rbp), %eax
+	movl ga1+104(%rip), %ecx
+	addl %ecx, %eax
+	movb %al, -63(%rbp)
+	jmp .L39
+.L61:
+.L62:
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L67
+	cmpq $18, -16(%rbp)
+	jle .L65
+.L67:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L64:
+	jmp .L56
+.L65:
+.L66:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L56
+.L69:
+	movq $0, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jge .L76
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L79
+	.p2align 4,,10
+.L78:
+	movsbl -63(%rbp), %eax
+	addl $924, %eax
+	movb %al, -63(%rbp)
+	addq $1, -40(%rbp)
+	movsbl -63(%rbp), %eax
+	addl $924, %eax
+	movb %al, -63(%rbp)
+	addq $1, -40(%rbp)
+	movsbl -63(%rbp), %eax
+	addl $924, %eax
+	movb %al, -63(%rbp)
+	addq $1, -40(%rbp)
+	movsbl -63(%rbp), %eax
+	addl $924, %eax
+	movb %al, -63(%rbp)
+	addq $1, -40(%rbp)
+	subq $1, -8(%rbp)
+	jne .L78
+.L79:
+.L76:
+.L77:
+	cmpq $100, -40(%rbp)
+	jge .L81
+	.p2align 4,,10
+.L80:
+	movsbl -63(%rbp), %eax
+	addl $924, %eax
+	movb %al, -63(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jl .L80
+.L81:
+	movslq -52(%rbp), %rax
+	addq $16506, %rax
+	movl %eax, -52(%rbp)
+	jmp .L27
+.L71:
+	movslq -52(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq $9, -24(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq $10, %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L86
+	cmpq $18, -24(%rbp)
+	jle .L84
+.L86:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L83:
+.L82:
+	jmp .L27
+.L84:
+.L85:
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L90
+	cmpq $18, -16(%rbp)
+	jle .L88
+.L90:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L87:
+	jmp .L83
+.L88:
+.L89:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L83
+.L72:
+	cmpq $0, -40(%rbp)
+	je .LB0
+.L91:
+.L92:
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $655, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -63(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -63(%rbp)
+	jmp .L27
+.L73:
+	movl ga1+52(%rip), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	pushq %rax
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $1093793586952, %rax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -60(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -60(%rbp)
+	movq -48(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	addq $309, %rax
+.L95:
+	movq %rax, %rcx
+	movsbq -63(%rbp), %rax
+	leaq 2(%rax,%rcx), %rax
+	testq %rax, %rax
+	je .L27
+	xorl %eax, %eax
+	subq g0(%rip), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L99
+	cmpq $18, -8(%rbp)
+	jle .L97
+.L99:
+	movq -8(%rbp), %rax
+	addq $629, %rax
+.L96:
+	movslq -56(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+.L108:
+	movl %eax, -52(%rbp)
+.L93:
+.L94:
+	jmp .L27
+.L97:
+.L98:
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	addq $1887, %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L103
+	cmpq $18, -24(%rbp)
+	jle .L101
+.L103:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L100:
+	jmp .L96
+.L101:
+.L102:
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L107
+	cmpq $18, -16(%rbp)
+	jle .L105
+.L107:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L104:
+	jmp .L96
+.L105:
+.L106:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L96
+.L31:
+	movzwl -60(%rbp), %eax
+	movq %rax, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L112
+	cmpq $18, -8(%rbp)
+	jle .L110
+.L112:
+	movq -8(%rbp), %rax
+	addq $5, %rax
+.L109:
+	jmp .L27
+.L110:
+.L111:
+	movq -8(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	addq $15, %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L116
+	cmpq $18, -24(%rbp)
+	jle .L114
+.L116:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L113:
+	jmp .L109
+.L114:
+.L115:
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L120
+	cmpq $18, -16(%rbp)
+	jle .L118
+.L120:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L117:
+	jmp .L109
+.L118:
+.L119:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L109
+.L32:
+	jmp .L27
+.L33:
+	jmp .L27
+.L34:
+	movslq -56(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movsbq -63(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L124
+	cmpq $18, -16(%rbp)
+	jle .L122
+.L124:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L121:
+	cmpq $864, %rax
+	setle %al
+	movzbl %al, %eax
+	movb %al, -63(%rbp)
+	movw $0, -62(%rbp)
+	movswl -62(%rbp), %eax
+	cmpl $4, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpl $0, -8(%rbp)
+	.p2align 4,,10
+.L133:
+.L134:
+	movsbl -63(%rbp), %eax
+	movw %ax, -60(%rbp)
+	jmp .L27
+.L122:
+.L123:
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -24(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L128
+	cmpq $18, -24(%rbp)
+	jle .L126
+.L128:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L125:
+	jmp .L121
+.L126:
+.L127:
+	movq -24(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L132
+	cmpq $18, -16(%rbp)
+	jle .L130
+.L132:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L129:
+	jmp .L121
+.L130:
+.L131:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L121
+.LB0:
+	movl -52(%rbp), %eax
+	addl $7, %eax
+	subl $67, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L36:
+	.long .L31-.L36
+	.long .L33-.L36
+	.long .L34-.L36
+	.long .L29-.L36
+	.long .L28-.L36
+	.long .L29-.L36
+	.long .L29-.L36
+	.long .L32-.L36
+	.long .L30-.L36
+	.p2align 2
+.L75:
+	.long .L71-.L75
+	.long .L69-.L75
+	.long .L70-.L75
+	.long .L70-.L75
+	.long .L70-.L75
+	.long .L70-.L75
+	.long .L72-.L75
+	.long .L73-.L75
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
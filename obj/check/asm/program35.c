@@ -0,0 +1,221 @@
+short g0 = 10;
+unsigned char g1 = 820;
+char g2;
+int ga0[8];
+int ga1[16];
+int f0() {
+    char v0 = 314U;
+    char v1 = 1091912058731;
+    char v2 = 542ul;
+    unsigned long v3 = 895;
+    unsigned long v4 = 184;
+    int i0 = 945L;
+    long j0 = 7;
+    v3 = v3 + j0;
+    if (74) {
+        if (-(555)) {
+            if ((g1 >= (255 <= 763))) {
+                v3 = (((v4 == ga0[2]) > j0) + 9);
+            } else {
+                v1 = v1 + (g2 / 13ul);
+                if ((!(1) / (v1 * v1 + 1))) { return !((141 / (g2 * g2 + 1))); }
+                v0 = ((1 + (255040122510 * i0)) - ((v2 * v0) == 572));
+            }
+            switch (((7 < 255) * -(v0))) {
+            default:
+                if ((210U < !(v2))) { return (unsigned long)(i0); }
+            case 0:
+                j0 = v0;
+                if (g1) { return (0 - 1005089878643); }
+                break;
+            }
+            for (v4 = 0; v4 < 33; v4 = v4 + 1) {
+                if (!(10)) { break; }
+            }
+        }
+        if ((char)(v4)) { return !((int)(262)); }
+    }
+    v4 = ((3U || (v1 * i0)) || (442 / (j0 * j0 + 1)));
+    switch (ga0[6]) {
+    case 69:
+        break;
+    case 237:
+    case 7:
+        j0 = (!((v2 || 540)) != (51 - (unsigned long)(v0)));
+        break;
+    case -2:
+        if (8) {
+            j0 = !((short)(414494207669));
+            j0 = ((v0 != 4) / (g0 * g0 + 1));
+            if (-((v2 && 1))) { return ((v0 * v1) / 100); }
+        } else {
+            i0 = 5;
+            for (v3 = 0; v3 < 100; v3 = v3 + 1) {
+                v1 = -(((v3 > 106) - (232796420789 - 431)));
+            }
+            if ((long)(94)) { return i0; }
+        }
+        if (743) { return 4294967295; }
+    default:
+        if ((unsigned short)(g1)) { return (!(72) - ga0[1]); }
+        if ((unsigned short)(-((v3 <= 0)))) {
+            if (0) { return (v1 < 0); }
+            if (!(590)) {
+                v0 = v0 + (long)((i0 && v3));
+            }
+        } else {
+            switch (v0) {
+            case 3:
+                if ((ga1[11] >= g0)) { return 9; }
+                if (788) { return (unsigned long)(548870020935); }
+            case 0:
+                break;
+            default:
+                if ((106 && ga0[1])) { return ga0[7]; }
+            case 6:
+                if ((g1 && 5u)) { return (-(g1) == (v2 < i0)); }
+                if ((7 / 4)) { return v1; }
+                break;
+            }
+        }
+        break;
+    }
+    v1 = (-((v3 / 5l)) - ((10 + v2) == v1));
+    return 683;
+}
+unsigned short f1(unsigned int p0) {
+    int v0 = 363;
+    unsigned char v1 = 360513545858;
+    unsigned char v2 = 643953156771;
+    char v3 = 577;
+    long v4 = 0;
+    int i0 = 6;
+    long j0 = 205u;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 951l; }
+    if (v4 >= 0 && v4 < 8) { la0[v4] = -(i0); }
+    la0[6] = i0;
+    v1 = v1 + g1;
+    v4 = 0;
+    while (v4 < 16) {
+        for (v0 = 1; v0 < 4; v0 = v0 + 1) {
+            switch ((unsigned char)((v4 + g1))) {
+            case 56:
+                if ((unsigned int)((7l == 10))) { break; }
+                if (((unsigned long)(106199091112) >= g2)) { break; }
+                break;
+            case 256:
+                la0[v0] = g2;
+            case 384:
+                break;
+            case 5:
+                j0 = j0 + (-(358) / (v0 * v0 + 1));
+                if (-(3ul)) { break; }
+                break;
+            case 941:
+                if (f0()) { break; }
+            }
+            p0 = (!(-(6ul)) <= v2);
+            if (((v1 / (g0 * g0 + 1)) + p0)) {
+                v2 = v1;
+                f0();
+            } else {
+                if (g2) { break; }
+                v2 = f0();
+            }
+        }
+        v4 = v4 + 1;
+    }
+    switch (((ga0[1] || la0[7]) >= g1)) {
+    case -1:
+        if (f0()) {
+            switch (((255 != v2) - g1)) {
+            case 0:
+                f0();
+                f0();
+                break;
+            case 734:
+                f0();
+            default:
+                break;
+            case 1:
+                v2 = ((unsigned long)((unsigned long)(700)) < (-(i0) < (765 > v4)));
+                i0 = 5;
+                break;
+            case 24:
+                break;
+            case 858:
+            case 812:
+                v0 = f0();
+                break;
+            case -3:
+                v3 = f0();
+                break;
+            }
+        } else {
+            la0[4] = -(5);
+            switch (((2 && 256) && (3 / (i0 * i0 + 1)))) {
+            case 5:
+                v3 = (g0 != (unsigned char)((la0[4] || g1)));
+                break;
+            case 9:
+                la0[1] = ((unsigned short)(716110658104u) + 10);
+                la0[1] = (f0() + v1);
+            case 0:
+                break;
+            default:
+                f0();
+                f0();
+                break;
+            case 1:
+                v3 = f0();
+            }
+        }
+        for (v0 = 2; v0 < 3; v0 = v0 + 1) {
+            v2 = ((la0[6] || (short)(574)) / (j0 * j0 + 1));
+        }
+    default:
+        p0 = (171 || g0);
+        break;
+    case 898:
+        if ((int)((unsigned char)(1))) { return (int)((524405959385 / (g2 * g2 + 1))); }
+        for (p0 = 1; p0 < 4; p0 = p0 + 1) {
+            v3 = -((f0() < g2));
+            v1 = (((499 && v3) == (952 <= 561)) / 5l);
+            if (f0()) { return (!(v3) + f0()); }
+        }
+        break;
+    }
+    la0[2] = g1;
+    return ((4 + (v0 >= 384)) && la0[3]);
+}
+unsigned int rec(unsigned int n, unsigned int acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 1, acc * 3 + n);
+}
+int main() {
+    long v0 = 400563107707;
+    long v1 = 649;
+    unsigned short v2 = 1u;
+    int i0 = 6;
+    long j0 = 2;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 8; }
+    if (v1 >= 0 && v1 < 8) { ga0[v1] = !((2 * 9)); }
+    g0 = g2;
+    f0();
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
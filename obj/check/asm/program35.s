@@ -0,0 +1,820 @@
+	.section .data
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.short 10
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.byte 52
+	.section .bss
+	.type g2, @object
+	.size g2, 1
+	.p2align 0
+g2:
+	.zero 1
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 64
+	.p2align 5
+ga1:
+	.zero 64
+	.section .text
+	.global main
+	.type main, @function
+	.type f0, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movabsq $400563107707, %rax
+	movq %rax, -32(%rbp)
+	movq $649, -24(%rbp)
+	movw $1, -54(%rbp)
+	movq $2, -8(%rbp)
+	movl $0, -36(%rbp)
+	movl $8, -40(%rbp)
+	movl $16, -44(%rbp)
+	movl $24, -48(%rbp)
+	movl $4, -52(%rbp)
+	cmpq $0, -24(%rbp)
+	jl .L0
+	cmpq $8, -24(%rbp)
+	jge .L0
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl $0, (%rdx,%rax,4)
+.L0:
+.L1:
+	movsbl g2(%rip), %eax
+	movw %ax, g0(%rip)
+	call f0
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movswq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzbl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq g2(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzwl -54(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -52(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jge .L2
+	movl $8, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L3
+	.p2align 4,,10
+.L4:
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	subq $1, -8(%rbp)
+	jne .L4
+.L5:
+.L2:
+.L3:
+	cmpl $8, -52(%rbp)
+	jge .L7
+	.p2align 4,,10
+.L6:
+	movslq -52(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jl .L6
+.L7:
+	movl $0, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L8
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L9
+	.p2align 4,,10
+.L10:
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	subq $1, -8(%rbp)
+	jne .L10
+.L11:
+.L8:
+.L9:
+	cmpl $16, -52(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movslq -52(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L12
+.L13:
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	leave
+	ret
+	.size main, .-main
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movb $58, -31(%rbp)
+	movb $107, -30(%rbp)
+	movb $30, -29(%rbp)
+	movq $895, -24(%rbp)
+	movq $184, -16(%rbp)
+	movl $945, -28(%rbp)
+	movq $7, -8(%rbp)
+	movq -8(%rbp), %rax
+	addq %rax, -24(%rbp)
+	movl $74, %eax
+	testl %eax, %eax
+	je .L14
+	xorl %eax, %eax
+	subl $555, %eax
+	je .L16
+	movl $255, %eax
+	cmpl $763, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl g1(%rip), %eax
+	cmpl %ecx, %eax
+	jl .L18
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -8(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	addl $9, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L19:
+	xorl %eax, %eax
+	movsbl -31(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	cmpl $255, %eax
+	setl %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L24
+.L23:
+	cmpb $0, -29(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $210, %eax
+	ja .LB0
+.L25:
+.L26:
+.L24:
+	movsbq -31(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpb $0, g1(%rip)
+	jne .LB1
+.L27:
+.L28:
+.L22:
+	movq $0, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jae .L30
+	.p2align 4,,10
+.L29:
+	movl $10, %eax
+	testl %eax, %eax
+	jne .L31
+.L30:
+.L16:
+.L17:
+	movq -16(%rbp), %rax
+	testb %al, %al
+	jne .LB2
+.L33:
+.L34:
+.L14:
+.L15:
+	movl $3, %eax
+	testl %eax, %eax
+	jne .L35
+	movsbl -30(%rbp), %eax
+	imull -28(%rbp), %eax
+	testl %eax, %eax
+	jne .L35
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $442, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L36
+.L35:
+	movl $1, %eax
+.L36:
+	movslq %eax, %rax
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	cmpq $69, %rax
+	jge .L42
+	cmpq $-2, %rax
+	je .L40
+	cmpq $7, %rax
+	je .L39
+	jmp .L41
+.L42:
+	cmpq $69, %rax
+	je .L38
+	cmpq $237, %rax
+	je .L39
+	jmp .L41
+.L31:
+.L32:
+	addq $1, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jb .L29
+	jmp .L30
+.L38:
+.L37:
+	movsbl -29(%rbp), %eax
+	addl $10, %eax
+	movsbl -30(%rbp), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movl $5, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	popq %rcx
+	subq %rcx, %rax
+	movl $683, %eax
+.f0_return:
+	leave
+	ret
+.L39:
+	movl $51, %eax
+	movsbq -31(%rbp), %rcx
+	subq %rcx, %rax
+	pushq %rax
+	cmpb $0, -29(%rbp)
+	jne .L43
+	movl $540, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L44
+.L43:
+	movl $0, %eax
+.L44:
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .L37
+.L40:
+	movl $8, %eax
+	testl %eax, %eax
+	je .L45
+	movl $-20811, %eax
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl -31(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, %eax
+	setne %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpb $0, -29(%rbp)
+	je .L49
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L50
+.L49:
+	movl $0, %eax
+.L50:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jne .LB3
+.L47:
+.L48:
+.L57:
+.L58:
+.L46:
+	movl $743, %eax
+	testl %eax, %eax
+	jne .LB4
+.L59:
+.L60:
+.L41:
+	movzbl g1(%rip), %eax
+	testw %ax, %ax
+	jne .LB5
+.L61:
+.L62:
+	xorl %eax, %eax
+	cmpq $0, -24(%rbp)
+	setbe %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	testw %ax, %ax
+	je .L63
+	xorl %eax, %eax
+	jne .LB6
+.L65:
+.L66:
+	movl $590, %eax
+	testl %eax, %eax
+	jne .L37
+	cmpl $0, -28(%rbp)
+	je .L69
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L70
+.L63:
+	movsbl -31(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L37
+	cmpq $3, %rax
+	je .L72
+	cmpq $6, %rax
+	je .L75
+.L74:
+	movl $106, %eax
+	testl %eax, %eax
+	je .L80
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	jne .LB7
+.L80:
+.L81:
+.L75:
+	cmpb $0, g1(%rip)
+	je .L82
+	movl $5, %eax
+	testl %eax, %eax
+	jne .LB8
+.L82:
+.L83:
+	movl $7, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .LB9
+.L84:
+.L85:
+	jmp .L37
+.L18:
+	movsbq g2(%rip), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movsbq -30(%rbp), %rax
+	addq %rcx, %rax
+	movb %al, -30(%rbp)
+	movsbl -30(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .LB10
+.L20:
+.L21:
+	movsbl -29(%rbp), %eax
+	movsbl -31(%rbp), %ecx
+	imull %ecx, %eax
+	cmpl $572, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movabsq $255040122510, %rax
+	movslq -28(%rbp), %rcx
+	imulq %rcx, %rax
+	addq $1, %rax
+	popq %rcx
+	subq %rcx, %rax
+	movb %al, -31(%rbp)
+	jmp .L19
+.L69:
+	movl $0, %eax
+.L70:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movsbq -31(%rbp), %rax
+	addq %rcx, %rax
+.L67:
+.L68:
+.L71:
+.L64:
+	jmp .L37
+.L72:
+	movl ga1+44(%rip), %eax
+	movswl g0(%rip), %ecx
+	cmpl %ecx, %eax
+	jge .LB11
+.L76:
+.L77:
+	movl $788, %eax
+	testl %eax, %eax
+	jne .LB12
+.L78:
+.L79:
+.L73:
+	jmp .L37
+.LB2:
+	movl $262, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L45:
+	movl $5, -28(%rbp)
+	movq $0, -24(%rbp)
+	movabsq $232796420789, %rax
+	subq $431, %rax
+	movq %rax, -16(%rbp)
+	cmpq $100, -24(%rbp)
+	jae .L51
+	movl $100, %eax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L54
+	.p2align 4,,10
+.L53:
+	cmpq $106, -24(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	addq $1, -24(%rbp)
+	cmpq $106, -24(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	addq $1, -24(%rbp)
+	cmpq $106, -24(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	addq $1, -24(%rbp)
+	cmpq $106, -24(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movb %al, -30(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -8(%rbp)
+	jne .L53
+.L54:
+.L51:
+.L52:
+	cmpq $100, -24(%rbp)
+	jae .L56
+	.p2align 4,,10
+.L55:
+	cmpq $106, -24(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movb %al, -30(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jb .L55
+.L56:
+	movl $94, %eax
+	testq %rax, %rax
+	je .L57
+	movl -28(%rbp), %eax
+	jmp .f0_return
+.LB5:
+	movl $72, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl ga0+4(%rip), %ecx
+	subl %ecx, %eax
+	jmp .f0_return
+.LB1:
+	xorl %eax, %eax
+	movabsq $1005089878643, %rcx
+	subq %rcx, %rax
+	jmp .f0_return
+.LB4:
+	movl $-1, %eax
+	jmp .f0_return
+.LB6:
+	movsbl -30(%rbp), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB3:
+	movsbl -30(%rbp), %eax
+	imull -8(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	jmp .f0_return
+.LB10:
+	movsbl g2(%rip), %eax
+	movsbl g2(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $141, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB0:
+	movslq -28(%rbp), %rax
+	jmp .f0_return
+.LB11:
+	movl $9, %eax
+	jmp .f0_return
+.LB9:
+	movsbl -30(%rbp), %eax
+	jmp .f0_return
+.LB12:
+	movl $-885792953, %eax
+	jmp .f0_return
+.LB8:
+	movsbl -29(%rbp), %eax
+	cmpl -28(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movzbl g1(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB7:
+	movl ga0+28(%rip), %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,147 @@
+int ga0[8];
+int ga1[33];
+unsigned char f0(int p0, unsigned char p1, char p2) {
+    long v0 = 456;
+    unsigned char v1 = 585;
+    unsigned char v2 = 56;
+    char v3 = 8;
+    int i0 = 10L;
+    long j0 = 618;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 9; }
+    i0 = (unsigned short)((int)(3U));
+    v2 = p1;
+    if ((!(ga1[17]) - !(0))) { return (ga1[31] + (4 > p0)); }
+    switch ((6 && 8)) {
+    case 4:
+        if (j0) { return ((i0 && p1) / 7); }
+        i0 = ((char)((9 == 4)) && (p2 != v2));
+        break;
+    case 7:
+        if (j0 >= 0 && j0 < 8) { la0[j0] = ((p2 || 746) < (unsigned long)(175)); }
+        break;
+    case 2:
+        break;
+    case 3:
+        for (j0 = 0; j0 < 100; j0 = j0 + 1) {
+            v3 = v3 + v0;
+        }
+        break;
+    default:
+        p0 = p0 + p0;
+        break;
+    case 8:
+        if (v3) {
+            v0 = 0;
+            while (v0 < 17) {
+                p0 = -((j0 + 301));
+                p0 = (unsigned short)(p2);
+                v0 = v0 + 1;
+            }
+        }
+        p1 = (ga0[3] / 16);
+        break;
+    }
+    p0 = (((680 - 992397874722) / 5l) / (p1 * p1 + 1));
+    for (j0 = 0; j0 < 8; j0 = j0 + 1) {
+        v2 = la0[2];
+        p0 = 0;
+        while (p0 < 5) {
+            v0 = (((i0 != v2) + (688 / (v0 * v0 + 1))) + 157);
+            v3 = (i0 != (unsigned long)(7));
+            p0 = p0 + 1;
+        }
+    }
+    switch ((650u + 4)) {
+    case 68:
+        break;
+    case 724:
+        break;
+    case 443:
+        if ((unsigned short)(v0)) { return (p1 - 6); }
+    case 48:
+        switch (-(8)) {
+        default:
+            if (((10 >= ga1[14]) <= v0)) { return (v2 + i0); }
+            p2 = -(871);
+            break;
+        case 7:
+            p1 = (unsigned int)(2);
+            break;
+        case 0:
+            if ((unsigned int)(534)) {
+                if (p0 >= 0 && p0 < 8) { la0[p0] = (!(p0) / 5l); }
+            }
+        case 3:
+            if (p2 >= 0 && p2 < 8) { la0[p2] = (178U == (8 >= 201)); }
+            break;
+        case 2:
+            if (p1 >= 0 && p1 < 8) { la0[p1] = 3; }
+            break;
+        case 6:
+            v2 = ((char)(4294967295) == 6u);
+        case 9:
+            if (((unsigned short)(j0) < (7 - i0))) {
+                if (((v1 != p1) + (i0 / (j0 * j0 + 1)))) { return p0; }
+                p0 = 272;
+                if (((p0 / (v3 * v3 + 1)) || (ga1[4] + ga1[9]))) { return ((la0[3] / (v1 * v1 + 1)) / (p2 * p2 + 1)); }
+            } else {
+                if (v2 >= 0 && v2 < 8) { la0[v2] = 256; }
+            }
+            j0 = v2;
+            break;
+        }
+    default:
+        break;
+    case 42:
+        break;
+    case -1:
+    }
+    return !(1);
+}
+unsigned char f1(unsigned short p0) {
+    char v0 = 8;
+    long v1 = 3;
+    unsigned short v2 = 426623006592;
+    char v3 = 2;
+    unsigned char v4 = 6ul;
+    int v5 = 5;
+    int i0 = 4294967295;
+    long j0 = 835114971897;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 255; }
+    v0 = (((la0[2] / 16) == 7) == (unsigned long)(995861841461));
+    if (p0 >= 0 && p0 < 4) { la0[p0] = (9 - (7 == la0[2])); }
+    v1 = v1 + !(-(v1));
+    f0((v1 + 5), 3, (j0 > v1));
+    return 249;
+}
+int main() {
+    short v0 = 4ul;
+    unsigned long v1 = 12;
+    long v2 = 952371542596;
+    int i0 = 6;
+    long j0 = 32767;
+    if (2) {
+        for (i0 = 0; i0 < 33; i0 = i0 + 1) {
+            f0(65536, (v2 - 9), (0 - v2));
+            v0 = v0 + (-(32767) * 1000000007);
+            j0 = (v2 == (ga1[8] <= v1));
+        }
+    } else {
+        v0 = -(f1(ga1[20]));
+    }
+    ga1[24] = 32767;
+    j0 = !((-(v2) <= v0));
+    v1 = 0;
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1002 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.type f0, @function
+	.global main
+	.type main, @function
+	.type f1, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movl %edi, -4(%rbp)
+	movb %sil, -5(%rbp)
+	movb %dl, -6(%rbp)
+	movq $456, -16(%rbp)
+	movb $73, -17(%rbp)
+	movb $56, -18(%rbp)
+	movb $8, -19(%rbp)
+	movl $10, -24(%rbp)
+	movq $618, -32(%rbp)
+	movl $0, -24(%rbp)
+	movl $0, -64(%rbp)
+	movl $9, -60(%rbp)
+	movl $18, -56(%rbp)
+	movl $27, -52(%rbp)
+	movl $36, -48(%rbp)
+	movl $45, -44(%rbp)
+	movl $54, -40(%rbp)
+	movl $63, -36(%rbp)
+	movl $8, -24(%rbp)
+	movl $3, -24(%rbp)
+	movzbl -5(%rbp), %eax
+	movb %al, -18(%rbp)
+	movl ga1+68(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	subl $1, %eax
+	jne .LB0
+.L0:
+.L1:
+	movl $1, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L9
+	leaq .L10(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L7
+	# table target .L5
+	# table target .L6
+	# table target .L3
+	# table target .L4
+	# table target .L8
+	jmp *%rcx
+.L9:
+.L7:
+	movl -4(%rbp), %eax
+	addl %eax, -4(%rbp)
+.L2:
+	movzbl -5(%rbp), %eax
+	movl %eax, -100(%rbp)
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-198479574808, %rax
+	cqo
+	idivq %rcx
+	movl %eax, -4(%rbp)
+	movq $0, -32(%rbp)
+	movslq -24(%rbp), %rax
+	cmpq $7, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -104(%rbp)
+	cmpq $8, -32(%rbp)
+	jge .L34
+	.p2align 4,,10
+.L33:
+	movl -56(%rbp), %eax
+	movb %al, -18(%rbp)
+	movl $0, -4(%rbp)
+	movzbl -18(%rbp), %eax
+	cmpl %eax, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -108(%rbp)
+	movl -104(%rbp), %eax
+	movl %eax, -112(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $688, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movslq -108(%rbp), %rax
+	movq %rax, -120(%rbp)
+	leaq 157(%rax,%rcx), %rax
+	movq %rax, -16(%rbp)
+	movl -112(%rbp), %eax
+	movb %al, -19(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $688, %eax
+	cqo
+	idivq %rcx
+	addq -120(%rbp), %rax
+	addq $157, %rax
+	movq %rax, -16(%rbp)
+	movsbl -19(%rbp), %eax
+	movb %al, -19(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $688, %eax
+	cqo
+	idivq %rcx
+	addq -120(%rbp), %rax
+	addq $157, %rax
+	movq %rax, -16(%rbp)
+	movsbl -19(%rbp), %eax
+	movb %al, -19(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $688, %eax
+	cqo
+	idivq %rcx
+	addq -120(%rbp), %rax
+	addq $157, %rax
+	movq %rax, -16(%rbp)
+	movsbl -19(%rbp), %eax
+	movb %al, -19(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $688, %eax
+	cqo
+	idivq %rcx
+	addq -120(%rbp), %rax
+	addq $157, %rax
+	movq %rax, -16(%rbp)
+	movsbl -19(%rbp), %eax
+	movb %al, -19(%rbp)
+	movl $5, -4(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $8, -32(%rbp)
+	jl .L33
+.L34:
+	movl $654, %eax
+	movslq %eax, %rax
+	cmpq $68, %rax
+	jge .L43
+	cmpq $-1, %rax
+	je .L42
+	cmpq $42, %rax
+	je .L35
+	cmpq $48, %rax
+	je .L39
+.L46:
+.L40:
+.L42:
+.L35:
+	movl $0, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L43:
+	cmpq $68, %rax
+	je .L35
+	cmpq $443, %rax
+	je .L38
+	cmpq $724, %rax
+	je .L35
+	jmp .L40
+.L36:
+	jmp .L35
+.L38:
+	movq -16(%rbp), %rax
+	testw %ax, %ax
+	jne .LB1
+.L44:
+.L45:
+.L39:
+	movl $-8, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L54
+	leaq .L55(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L47
+	# table target .L49
+	# table target .L51
+	# table target .L50
+	# table target .L52
+	# table target .L48
+	# table target .L53
+	jmp *%rcx
+.L41:
+	jmp .L35
+.L54:
+.L47:
+	movl ga1+56(%rip), %eax
+	cmpl $10, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -16(%rbp), %rax
+	jle .LB2
+.L56:
+.L57:
+	movb $-103, -6(%rbp)
+	jmp .L46
+.L37:
+	jmp .L35
+.L3:
+	cmpq $0, -32(%rbp)
+	je .L11
+	cmpl $0, -24(%rbp)
+	je .L13
+	cmpb $0, -5(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L14
+.L11:
+.L12:
+	movl $0, -24(%rbp)
+	jmp .L2
+.L4:
+	cmpq $0, -32(%rbp)
+	jl .L2
+	cmpq $8, -32(%rbp)
+	jge .L2
+	cmpb $0, -6(%rbp)
+	jne .L17
+	movl $746, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L18
+.L17:
+	movl $1, %eax
+.L18:
+	movslq %eax, %rax
+	cmpq $175, %rax
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+.L15:
+.L16:
+	jmp .L2
+.L5:
+	jmp .L2
+.L6:
+	movq $0, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jge .L19
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -72(%rbp)
+	cmpq $0, -72(%rbp)
+	je .L22
+	.p2align 4,,10
+.L21:
+	movsbq -19(%rbp), %rax
+	addq -16(%rbp), %rax
+	movb %al, -19(%rbp)
+	addq $1, -32(%rbp)
+	movsbq -19(%rbp), %rax
+	addq -16(%rbp), %rax
+	movb %al, -19(%rbp)
+	addq $1, -32(%rbp)
+	movsbq -19(%rbp), %rax
+	addq -16(%rbp), %rax
+	movb %al, -19(%rbp)
+	addq $1, -32(%rbp)
+	movsbq -19(%rbp), %rax
+	addq -16(%rbp), %rax
+	movb %al, -19(%rbp)
+	addq $1, -32(%rbp)
+	subq $1, -72(%rbp)
+	jne .L21
+.L22:
+.L19:
+.L20:
+	cmpq $100, -32(%rbp)
+	jge .L2
+	.p2align 4,,10
+.L23:
+	movsbq -19(%rbp), %rax
+	addq -16(%rbp), %rax
+	movb %al, -19(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jl .L23
+.L24:
+	jmp .L2
+.L8:
+	cmpb $0, -19(%rbp)
+	je .L25
+	movq $0, -16(%rbp)
+	movq -32(%rbp), %rax
+	addq $301, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -80(%rbp)
+	cmpq $17, -16(%rbp)
+	jge .L27
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -88(%rbp)
+	cmpq $0, -88(%rbp)
+	je .L30
+	.p2align 4,,10
+.L29:
+	movq -80(%rbp), %rax
+	movl %eax, -92(%rbp)
+	movl %eax, -4(%rbp)
+	movsbl -6(%rbp), %eax
+	movzwl %ax, %eax
+	movl %eax, -96(%rbp)
+	movl %eax, -4(%rbp)
+	addq $1, -16(%rbp)
+	movl -92(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -96(%rbp), %eax
+	movl %eax, -4(%rbp)
+	addq $1, -16(%rbp)
+	movl -92(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -96(%rbp), %eax
+	movl %eax, -4(%rbp)
+	addq $1, -16(%rbp)
+	movl -92(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -96(%rbp), %eax
+	movl %eax, -4(%rbp)
+	addq $1, -16(%rbp)
+	subq $1, -88(%rbp)
+	jne .L29
+.L30:
+.L27:
+.L28:
+	cmpq $17, -16(%rbp)
+	jge .L32
+	.p2align 4,,10
+.L31:
+	movq -80(%rbp), %rax
+	movl %eax, -4(%rbp)
+	movsbl -6(%rbp), %eax
+	movzwl %ax, %eax
+	movl %eax, -4(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L31
+.L32:
+.L25:
+.L26:
+	movl ga0+12(%rip), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movb %al, -5(%rbp)
+	jmp .L2
+.L48:
+	movb $2, -5(%rbp)
+	jmp .L46
+.L49:
+	cmpl $0, -4(%rbp)
+	jl .L58
+	cmpl $8, -4(%rbp)
+	jge .L58
+	cmpl $0, -4(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	movslq -4(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+.L58:
+.L59:
+.L50:
+	movsbl -6(%rbp), %eax
+	movl %eax, -124(%rbp)
+	testl %eax, %eax
+	jl .L46
+	cmpl $8, -124(%rbp)
+	jge .L46
+	movsbq -6(%rbp), %rax
+	movl $0, -64(%rbp,%rax,4)
+.L60:
+.L61:
+	jmp .L46
+.L51:
+	movzbl -5(%rbp), %eax
+	movl %eax, -128(%rbp)
+	testl %eax, %eax
+	jl .L46
+	cmpl $8, -128(%rbp)
+	jge .L46
+	movzbl -5(%rbp), %eax
+	movl $3, -64(%rbp,%rax,4)
+.L62:
+.L63:
+	jmp .L46
+.L52:
+	movb $0, -18(%rbp)
+.L53:
+	movl $7, %eax
+	subl -24(%rbp), %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movzwl %ax, %eax
+	cmpl %ecx, %eax
+	jge .L64
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movzbl -17(%rbp), %eax
+	movl %eax, -132(%rbp)
+	movzbl -5(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	addq %rcx, %rax
+	jne .LB3
+.L66:
+.L67:
+	movl $272, -4(%rbp)
+	movsbl -19(%rbp), %eax
+	movl %eax, -136(%rbp)
+	imull -136(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .L70
+	movl ga1+16(%rip), %eax
+	movl ga1+36(%rip), %ecx
+	addl %ecx, %eax
+	jne .L70
+.L68:
+.L69:
+.L71:
+.L72:
+.L65:
+	movzbl -18(%rbp), %eax
+	movq %rax, -32(%rbp)
+	jmp .L46
+.L64:
+	movzbl -18(%rbp), %eax
+	movl %eax, -144(%rbp)
+	testl %eax, %eax
+	jl .L71
+	cmpl $8, -144(%rbp)
+	jge .L71
+	movzbl -18(%rbp), %eax
+	movl $256, -64(%rbp,%rax,4)
+	jmp .L72
+.LB0:
+	movl ga1+124(%rip), %eax
+	cmpl $4, -4(%rbp)
+	setl %cl
+	movzbl %cl, %ecx
+	addl %ecx, %eax
+	jmp .f0_return
+.L13:
+	movl $0, %eax
+.L14:
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	jmp .f0_return
+.LB1:
+	movzbl -5(%rbp), %eax
+	subl $6, %eax
+	jmp .f0_return
+.LB2:
+	movzbl -18(%rbp), %eax
+	addl -24(%rbp), %eax
+	jmp .f0_return
+.L70:
+	movsbl -6(%rbp), %eax
+	movl %eax, -140(%rbp)
+	imull -140(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl -132(%rbp), %eax
+	imull -132(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cltd
+	idivl %ecx
+	jmp .f0_return
+.LB3:
+	movl -4(%rbp), %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L10:
+	.long .L5-.L10
+	.long .L6-.L10
+	.long .L3-.L10
+	.long .L7-.L10
+	.long .L7-.L10
+	.long .L4-.L10
+	.long .L8-.L10
+	.p2align 2
+.L55:
+	.long .L49-.L55
+	.long .L47-.L55
+	.long .L51-.L55
+	.long .L50-.L55
+	.long .L47-.L55
+	.long .L47-.L55
+	.long .L52-.L55
+	.long .L48-.L55
+	.long .L47-.L55
+	.long .L53-.L55
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movw $4, -66(%rbp)
+	movq $12, -56(%rbp)
+	movabsq $952371542596, %rax
+	movq %rax, -48(%rbp)
+	movl $6, -64(%rbp)
+	movl $2, %eax
+	testl %eax, %eax
+	je .L73
+	movl $0, -64(%rbp)
+	movq -48(%rbp), %rax
+	subq $9, %rax
+	movq %rax, -40(%rbp)
+	xorl %eax, %eax
+	subq -48(%rbp), %rax
+	movq %rax, -32(%rbp)
+	xorl %eax, %eax
+	subl $32767, %eax
+	imull $1000000007, %eax, %eax
+	movl %eax, -60(%rbp)
+	cmpl $33, -64(%rbp)
+	jge .L75
+	movl $33, %eax
+	movslq -64(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L76
+	.p2align 4,,10
+.L77:
+	movq -32(%rbp), %rax
+	movb %al, -8(%rbp)
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movb %al, -16(%rbp)
+	movq %rax, %rsi
+	movl $65536, %eax
+	movq %rax, %rdi
+	call f0
+	movswl -66(%rbp), %eax
+	addl -60(%rbp), %eax
+	movw %ax, -66(%rbp)
+	movl ga1+32(%rip), %eax
+	movslq %eax, %rax
+	cmpq -56(%rbp), %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addl $1, -64(%rbp)
+	movsbl -8(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -16(%rbp), %eax
+	movq %rax, %rsi
+	movl $65536, %eax
+	movq %rax, %rdi
+	call f0
+	movswl -66(%rbp), %eax
+	addl -60(%rbp), %eax
+	movw %ax, -66(%rbp)
+	movl ga1+32(%rip), %eax
+	movslq %eax, %rax
+	cmpq -56(%rbp), %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addl $1, -64(%rbp)
+	subq $1, -24(%rbp)
+	jne .L77
+.L78:
+.L75:
+.L76:
+	cmpl $33, -64(%rbp)
+	jge .L74
+	.p2align 4,,10
+.L79:
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $65536, %eax
+	movq %rax, %rdi
+	call f0
+	movswl -66(%rbp), %eax
+	addl -60(%rbp), %eax
+	movw %ax, -66(%rbp)
+	movl ga1+32(%rip), %eax
+	movslq %eax, %rax
+	cmpq -56(%rbp), %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addl $1, -64(%rbp)
+	cmpl $33, -64(%rbp)
+	jl .L79
+.L80:
+	jmp .L74
+.L73:
+	movl ga1+80(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, -66(%rbp)
+.L74:
+	movl $32767, ga1+96(%rip)
+	movswq -66(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq -48(%rbp), %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movq $0, -56(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -56(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -64(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -64(%rbp)
+	cmpl $8, -64(%rbp)
+	jge .L81
+	movl $8, %eax
+	movslq -64(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L82
+	.p2align 4,,10
+.L83:
+	movslq -64(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	movslq -64(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	movslq -64(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	movslq -64(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	subq $1, -8(%rbp)
+	jne .L83
+.L84:
+.L81:
+.L82:
+	cmpl $8, -64(%rbp)
+	jge .L86
+	.p2align 4,,10
+.L85:
+	movslq -64(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	cmpl $8, -64(%rbp)
+	jl .L85
+.L86:
+	movl $0, -64(%rbp)
+	cmpl $33, -64(%rbp)
+	jge .L87
+	movl $33, %eax
+	movslq -64(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L88
+	.p2align 4,,10
+.L89:
+	movslq -64(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	movslq -64(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	movslq -64(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	movslq -64(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	subq $1, -8(%rbp)
+	jne .L89
+.L90:
+.L87:
+.L88:
+	cmpl $33, -64(%rbp)
+	jge .L92
+	.p2align 4,,10
+.L91:
+	movslq -64(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -64(%rbp)
+	cmpl $33, -64(%rbp)
+	jl .L91
+.L92:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	leave
+	ret
+	.size main, .-main
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movw %di, -2(%rbp)
+	movb $8, -3(%rbp)
+	movq $3, -16(%rbp)
+	movw $30592, -18(%rbp)
+	movb $2, -19(%rbp)
+	movb $6, -20(%rbp)
+	movl $5, -24(%rbp)
+	movl $-1, -28(%rbp)
+	movabsq $835114971897, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -64(%rbp)
+	movl $255, -60(%rbp)
+	movl $510, -56(%rbp)
+	movl $765, -52(%rbp)
+	movl $4, -28(%rbp)
+	movl -56(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	cmpl $7, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $995861841461, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -3(%rbp)
+	movzwl -2(%rbp), %eax
+	movl %eax, -68(%rbp)
+	testl %eax, %eax
+	jl .L93
+	cmpl $4, -68(%rbp)
+	jge .L93
+	movl -56(%rbp), %eax
+	cmpl $7, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	movl %ecx, -64(%rbp,%rax,4)
+.L93:
+.L94:
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	movq -40(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	addq $5, %rax
+	movq %rax, %rdi
+	call f0
+	movl $249, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1, .-f1
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,118 @@
+unsigned char g0;
+char f0() {
+    unsigned char v0 = 65536;
+    int v1 = 209;
+    int i0 = 0;
+    long j0 = 10;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 284; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 206000947147; }
+    for (v1 = 0; v1 < 33; v1 = v1 + 1) {
+        for (i0 = 2; i0 < 17; i0 = i0 + 1) {
+            if ((v1 - 256)) { return ((v1 / 4) <= 9); }
+            v0 = g0;
+            v0 = 0;
+        }
+        for (j0 = 1; j0 < 33; j0 = j0 + 1) {
+            if (((g0 / (i0 * i0 + 1)) > (v0 != 1))) {
+                i0 = ((7 <= 814187919346) || 8);
+                if (((6 != v1) + 927)) { break; }
+                la1[10] = (g0 || (i0 != g0));
+            } else {
+                if (((g0 / (g0 * g0 + 1)) / (v1 * v1 + 1))) { break; }
+            }
+            la0[j0] = (short)(-(j0));
+        }
+        j0 = g0;
+    }
+    i0 = (((320 * i0) * 7L) - !(757));
+    la1[11] = i0;
+    if (i0 >= 0 && i0 < 16) { la1[i0] = (unsigned short)((4294967295 / (i0 * i0 + 1))); }
+    if ((g0 == 5)) {
+        switch ((3 * (int)(j0))) {
+        case -2:
+            v1 = v1 + 0;
+            break;
+        default:
+            if ((((unsigned long)(793074083432) == (g0 + i0)) <= (int)((v1 > la0[3])))) {
+                i0 = la1[1];
+                i0 = (i0 + (!(j0) / 13ul));
+                v0 = !(6);
+            } else {
+                i0 = (v1 > 4);
+            }
+            if (2) { return ((g0 + v0) < (la1[5] / 5l)); }
+            break;
+        case 48:
+            v1 = ((j0 != (i0 / (v1 * v1 + 1))) / 4);
+            if ((19 || la1[1])) { return la0[18]; }
+            break;
+        case 41:
+            if ((j0 || v0)) { return (600l + 60); }
+        case 853:
+            v1 = v1 + ((399 || j0) <= -(la1[12]));
+            break;
+        case 35:
+        }
+        v0 = v0 + -(j0);
+    }
+    return la0[31];
+}
+void w0(unsigned short q0, unsigned char q1) {
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q1;
+    g0 = g0 * 3 + q0;
+}
+unsigned int rec(unsigned int n, unsigned int acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 1, acc * 3 + n);
+}
+int main() {
+    char v0 = 114349629380;
+    unsigned char v1 = 4;
+    unsigned long v2 = 371l;
+    int v3 = 7;
+    short v4 = 0;
+    int v5 = 128;
+    int i0 = 0;
+    long j0 = 203;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 0; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 3; }
+    i0 = v2;
+    for (v4 = 0; v4 < 3; v4 = v4 + 1) {
+        i0 = 0;
+        while (i0 < 17) {
+            w0(g0, v1);
+            if (v3) {
+                if (((987588587473 >= 3l) > (261524116470 + la1[7]))) { break; }
+                v2 = ((v1 / (v2 * v2 + 1)) != (unsigned long)((2 - i0)));
+                if (((v3 + 255) / 2)) { break; }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    switch (la1[7]) {
+    case 860:
+        break;
+    default:
+        break;
+    }
+    if (v3) { return i0; }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
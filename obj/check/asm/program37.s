@@ -0,0 +1,373 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.zero 1
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movb $-60, -1(%rbp)
+	movb $4, -2(%rbp)
+	movq $371, -16(%rbp)
+	movl $7, -20(%rbp)
+	movw $0, -22(%rbp)
+	movl $128, -28(%rbp)
+	movl $0, -32(%rbp)
+	movq $203, -40(%rbp)
+	movl $0, -32(%rbp)
+	movl $0, -64(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -56(%rbp)
+	movl $0, -52(%rbp)
+	movl $4, -32(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movslq -32(%rbp), %rax
+	imull $3, -32(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	imull $3, -32(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	imull $3, -32(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	imull $3, -32(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -144(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -32(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -32(%rbp), %rax
+	imull $3, -32(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L4
+.L5:
+	movq -16(%rbp), %rax
+	movl %eax, -32(%rbp)
+	movw $0, -22(%rbp)
+	movl $1, -148(%rbp)
+	movl -20(%rbp), %eax
+	addl $255, %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movl %eax, -152(%rbp)
+	movswl -22(%rbp), %eax
+	movl %eax, -156(%rbp)
+	cmpl $3, %eax
+	jge .L7
+	.p2align 4,,10
+.L6:
+	movl $0, -32(%rbp)
+	movl -148(%rbp), %eax
+	movl %eax, -160(%rbp)
+	movl -152(%rbp), %eax
+	movl %eax, -164(%rbp)
+	cmpl $17, -32(%rbp)
+	jge .L9
+	.p2align 4,,10
+.L8:
+	movzbl g0(%rip), %eax
+	movw %ax, -166(%rbp)
+	movzbl -2(%rbp), %eax
+	movb %al, -167(%rbp)
+	movzwl -166(%rbp), %eax
+	movl %eax, -172(%rbp)
+	movq %rax, %rcx
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl %ecx, %eax
+	movb %al, g0(%rip)
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movzbl -167(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, g0(%rip)
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl -172(%rbp), %eax
+	movb %al, g0(%rip)
+.L10:
+	cmpl $0, -20(%rbp)
+	je .L11
+	movl -100(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $261524116470, %rax
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movslq -160(%rbp), %rax
+	cmpq %rcx, %rax
+	jle .L13
+.L9:
+	movl -156(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -22(%rbp)
+	movswl -22(%rbp), %eax
+	movl %eax, -156(%rbp)
+	cmpl $3, %eax
+	jl .L6
+.L7:
+	movl -100(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $860, %rax
+	je .L18
+.L19:
+	jmp .L17
+.L15:
+.L16:
+.L11:
+.L12:
+	addl $1, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jl .L8
+	jmp .L9
+.L13:
+.L14:
+	movl $2, %eax
+	subl -32(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L15
+	jmp .L9
+.L18:
+.L17:
+	cmpl $0, -20(%rbp)
+	jne .LB0
+.L20:
+.L21:
+	movq $0, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	movzbl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	movsbq -1(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	movzbl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	movswq -22(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	movslq -32(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	imulq $31, -184(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -184(%rbp)
+	movl $0, -32(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	movl -52(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	movl $4, -32(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $0, -132(%rbp)
+	je .L22
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L25
+	.p2align 4,,10
+.L24:
+	movslq -32(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -192(%rbp)
+	jne .L24
+.L25:
+.L22:
+.L23:
+	cmpl $16, -32(%rbp)
+	jge .L27
+	.p2align 4,,10
+.L26:
+	movslq -32(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -184(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L26
+.L27:
+	movq -184(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -184(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -184(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -184(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -184(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -184(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -184(%rbp)
+	movq -184(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB0:
+	movl -32(%rbp), %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,364 @@
+unsigned int g0;
+unsigned char g1;
+int ga0[4];
+int ga1[4];
+long f0(short p0) {
+    int v0 = 6;
+    int v1 = 4;
+    char v2 = 66;
+    unsigned short v3 = 1;
+    int i0 = 8;
+    long j0 = 0;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 1000000007; }
+    if (g1 >= 0 && g1 < 4) { la1[g1] = (2 < (0U > 1049911485393)); }
+    v1 = v1;
+    if ((unsigned short)(g1)) { return (j0 + 1003877575317); }
+    if ((short)(-((unsigned char)(14)))) {
+        if (p0 >= 0 && p0 < 4) { la1[p0] = 929; }
+        i0 = ((!(p0) >= g0) != (v3 + g1));
+    } else {
+        switch ((976178134637 == ga1[2])) {
+        case 7:
+            if (2) { return (9 > 673); }
+            v3 = v3 + (int)(la1[2]);
+        default:
+            i0 = v2;
+            v1 = 0;
+            while (v1 < 3) {
+                if (((v1 >= g0) != (4 * 0u))) { break; }
+                v1 = v1 + 1;
+            }
+            break;
+        case 0:
+            v2 = ((-(g0) - !(ga0[3])) || 4);
+            p0 = 0;
+            while (p0 < 4) {
+                j0 = ((long)(90) + (1 || j0));
+                la0[p0] = ((char)(583) == ga1[1]);
+                p0 = p0 + 1;
+            }
+            break;
+        case 5:
+            break;
+        case 9:
+            if ((705 / 10)) { return (g1 && (182 - 246869467900)); }
+            break;
+        case 8:
+            if (i0 >= 0 && i0 < 4) { la1[i0] = ((v1 - ga0[0]) > (402 == ga0[0])); }
+        case 1:
+            if (((p0 || v0) / 4)) {
+                if ((!(v3) / (i0 * i0 + 1))) { return 41; }
+                if ((ga1[0] < 65536)) { return ((65536 - 5) - 128); }
+            } else {
+                if ((!(g0) / 3u)) { return 9; }
+                v0 = v0 + (short)((ga0[1] == g0));
+                la0[14] = (9 / (p0 * p0 + 1));
+            }
+            switch ((!(2) - (9 / (v0 * v0 + 1)))) {
+            default:
+                v3 = ((j0 / (v0 * v0 + 1)) > -((la1[0] / 4)));
+                break;
+            case 8:
+                if (p0) { return ga1[1]; }
+                break;
+            }
+        }
+        p0 = !(((v2 - 648254135913) > (i0 + ga0[1])));
+    }
+    i0 = (!(7) - (v1 + 950));
+    return (((char)(v2) / 1024) != -(44));
+}
+void w0(int q0, short q1, char q2) {
+    g0 = g0 * 3 + q0;
+}
+unsigned char f1(unsigned short p0, unsigned int p1, int p2, long p3, char p4, unsigned short p5) {
+    unsigned short v0 = 38279019089;
+    unsigned short v1 = 8l;
+    int v2 = 7;
+    int i0 = 774;
+    long j0 = 479;
+    v2 = 0;
+    while (v2 < 17) {
+        if (f0(402)) { return -(10); }
+        p5 = (int)(((short)(p1) || (g0 / 7)));
+        v2 = v2 + 1;
+    }
+    p2 = (f0(9) - (v1 + (j0 || p3)));
+    if (288) {
+        j0 = (f0(p3) < (255 + 232));
+        if (4) {
+            i0 = ga0[2];
+            if (((4U > (i0 - i0)) + ((long)(ga1[0]) > (v2 != g0)))) {
+                p1 = (long)(((short)(1) <= g0));
+                f0((g0 > 0));
+                p2 = p2 + ((250 * 958) + (v2 == p3));
+            } else {
+                f0(514);
+            }
+            if (f0(0)) { return ((p1 / (v2 * v2 + 1)) - (v1 + ga0[0])); }
+        } else {
+            p3 = 0;
+            while (p3 < 3) {
+                v0 = (((p3 || 0) + 723) / 5l);
+                p3 = p3 + 1;
+            }
+        }
+        f0((2147483647 <= 65));
+    }
+    j0 = -(457);
+    for (p3 = 2; p3 < 5; p3 = p3 + 1) {
+        switch (v0) {
+        case 809:
+            break;
+        default:
+            i0 = j0;
+            break;
+        case 30:
+            if (((g1 >= (i0 < p2)) && ((long)(i0) && ga0[0]))) {
+                i0 = i0 + ((g0 != j0) * v1);
+                if (477) { break; }
+            }
+            p4 = (short)(-(f0(10)));
+            break;
+        case 38:
+            p4 = ((-(p1) <= 65535) + g0);
+            switch (65536) {
+            case -1:
+                if ((p5 / (g1 * g1 + 1))) { break; }
+                break;
+            case 36:
+                if (f0(v0)) { break; }
+                if (v2) { break; }
+            case 8:
+                if (!(!(p4))) { break; }
+                break;
+            case 0:
+                p4 = ga0[1];
+            case 27:
+                break;
+            }
+        case 52:
+            if ((f0(626) >= (!(ga0[1]) + 689890539067))) {
+                v1 = (279 + ((3 >= p1) - (ga0[3] && 4)));
+                p4 = ga0[3];
+                if (((7 * ga1[3]) && 8ul)) { break; }
+            } else {
+                v0 = v0 + !((unsigned short)(776));
+            }
+            p1 = p1 + (0 < 0);
+        case 698:
+            break;
+        case -5:
+            if (f0(ga1[3])) { break; }
+            break;
+        }
+    }
+    if (!(p5)) {
+        for (j0 = 0; j0 < 33; j0 = j0 + 1) {
+            if (((g0 >= p2) / (p0 * p0 + 1))) {
+                if (-((p1 < 4294967295))) { break; }
+            }
+            p1 = p0;
+            p1 = ga1[0];
+        }
+        p2 = 0;
+        while (p2 < 5) {
+            i0 = -(p2);
+            p2 = p2 + 1;
+        }
+    } else {
+        i0 = i0 + (p1 * -(156666142228L));
+        p1 = p1 + -(v0);
+        i0 = -(f0(p2));
+    }
+    f0((g0 / (j0 * j0 + 1)));
+    p4 = p4 + !((3 - 965U));
+    return !((1022487464475 * p3));
+}
+void w1(unsigned long q0, char q1) {
+    g1 = g1 * 3 + q0;
+    g0 = g0 * 3 + q0;
+}
+unsigned char f2(unsigned char p0, unsigned short p1, unsigned long p2, unsigned long p3, int p4, unsigned short p5) {
+    unsigned int v0 = 7l;
+    unsigned int v1 = 811;
+    unsigned char v2 = 587;
+    short v3 = 3;
+    unsigned char v4 = 1;
+    char v5 = 2;
+    int i0 = 458;
+    long j0 = 1000000007;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 540; }
+    p4 = ((722646215304u - g0) / 100);
+    f0(i0);
+    p3 = p3 + v4;
+    p2 = 0;
+    while (p2 < 4) {
+        v1 = 0;
+        while (v1 < 3) {
+            switch (((p5 + g1) >= (432 > g1))) {
+            case 5:
+            case 4:
+                if (f0(v3)) { break; }
+                p1 = f1(p4, 94, ga0[1], 56, 234, ga1[1]);
+                break;
+            case 6:
+                if ((f0(128u) - (p5 != ga0[0]))) { break; }
+                break;
+            case 9:
+                if (553) { break; }
+                if (5) { break; }
+            case 7:
+                la0[p2] = v3;
+                la0[v1] = (f1(p4, p2, 934, 7, 9, la0[14]) > (v5 == v5));
+            case 2:
+            }
+            p4 = p4 + 6ul;
+            v1 = v1 + 1;
+        }
+        la0[p2] = f0(p1);
+        p2 = p2 + 1;
+    }
+    if (f1(10, (p0 && 7), (g0 / 2), v2, p2, -(2))) {
+        switch ((unsigned char)(v0)) {
+        case 4:
+            v1 = 0;
+            while (v1 < 3) {
+                v4 = -((p0 || 7));
+                v1 = v1 + 1;
+            }
+            v5 = (((p3 - ga0[3]) <= 4) / (p2 * p2 + 1));
+            break;
+        case 6:
+            p5 = f1(v4, (v2 / 1), (109 - 178), (2 - 153338147421), f1(3, g1, 274, 6u, g0, p1), (p5 / (v5 * v5 + 1)));
+            break;
+        default:
+            f1(256, ga1[3], (j0 < g0), 3, (667 || 549), (int)(p4));
+            break;
+        case 0:
+            break;
+        case 9:
+            break;
+        case 2:
+            break;
+        case 3:
+            i0 = (-(2) || v4);
+            break;
+        }
+        if ((j0 * (-(g1) / (p0 * p0 + 1)))) {
+            if (v3 >= 0 && v3 < 16) { la0[v3] = 10ul; }
+        } else {
+            f1((short)(603), (unsigned char)(la0[1]), -(p5), (char)(j0), 591256432181, v4);
+        }
+        p0 = p0 + (977 / (g1 * g1 + 1));
+    } else {
+        p3 = (1 + ga1[0]);
+        if (369) {
+            for (j0 = 0; j0 < 3; j0 = j0 + 1) {
+                if (((10 / (p4 * p4 + 1)) && f0(v2))) { break; }
+                if (((2 <= p0) - 667)) { break; }
+            }
+            if ((g0 * -((p2 <= j0)))) {
+                f1(-(648877168157L), (i0 - p3), (j0 - v1), (128 - p0), v4, p2);
+                la0[8] = p0;
+                p2 = 0;
+            }
+            p4 = -(((v0 && 8) > (325 != 6)));
+        } else {
+            if ((f0(p3) == f1(v4, 2, p5, g0, ga1[3], 522250828634))) {
+                v1 = v5;
+                p5 = (p2 != (v0 == 77));
+                f0(v3);
+            } else {
+                f1(p5, -(p5), 1, (ga0[2] / (p5 * p5 + 1)), p2, (g1 * 255));
+            }
+            for (j0 = 0; j0 < 8; j0 = j0 + 1) {
+                if (!(v4)) { break; }
+                p5 = p5 + (!(v4) == (8 < ga0[3]));
+                p1 = p1 + (9 == f0(665));
+            }
+        }
+        switch (f0(1)) {
+        case -5:
+            for (j0 = 0; j0 < 4; j0 = j0 + 1) {
+                if (f1(2, 7, 868, 230, v0, v2)) { break; }
+                if (2) { return (65536 - (648 / 5l)); }
+            }
+        case 1:
+            break;
+        case -4:
+            v0 = (unsigned char)(((g1 >= v0) && p4));
+            break;
+        default:
+            if (i0 >= 0 && i0 < 16) { la0[i0] = ((408 - ga1[3]) && f0(p5)); }
+        case 873:
+            if ((2147483647 && (128 / (p1 * p1 + 1)))) {
+                v1 = !(((p0 / 3u) > 5));
+                f1((p1 + p1), 286, (j0 / 5l), f1(0, v5, 4294967295, ga1[2], 0, p2), f1(p5, g1, v0, p3, 949255157556, g1), 174);
+                f1(9, (la0[10] == v2), (v0 >= 6u), -(v3), (p4 > ga0[2]), ga1[3]);
+            } else {
+                if (p1 >= 0 && p1 < 16) { la0[p1] = !(!(v5)); }
+                v4 = (32767 == 8);
+                p3 = -(((ga1[2] - 8) / 3u));
+            }
+            switch ((6 && p0)) {
+            case 48:
+                break;
+            case 1:
+            case -5:
+                la0[12] = v3;
+                break;
+            case 308:
+                if (v5 >= 0 && v5 < 16) { la0[v5] = v3; }
+                v3 = -(0);
+                break;
+            case 490:
+                break;
+            case 660:
+                v3 = 639461017337;
+            case 5:
+                f0(406);
+                break;
+            }
+        }
+    }
+    p3 = !((int)(9));
+    return ((6 + (p0 + 65535)) * (7 + (628703651455l == v4)));
+}
+int main() {
+    unsigned int v0 = 5;
+    short v1 = 4;
+    int v2 = 5;
+    unsigned long v3 = 898;
+    char v4 = 9L;
+    int i0 = 454;
+    long j0 = 5;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 1U; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 10L; }
+    v4 = ((919 || j0) + (6u < 763));
+    j0 = j0 + ((unsigned long)(256) * 4);
+    i0 = (f0(g1) && 128);
+    v4 = v4 + (ga1[0] * ga1[2]);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
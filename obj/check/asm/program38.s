@@ -0,0 +1,493 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.zero 1
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 16
+	.p2align 5
+ga1:
+	.zero 16
+	.section .text
+	.global main
+	.type main, @function
+	.type f0, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movl $5, -4(%rbp)
+	movw $4, -6(%rbp)
+	movl $5, -12(%rbp)
+	movq $898, -24(%rbp)
+	movb $9, -25(%rbp)
+	movl $454, -32(%rbp)
+	movq $5, -40(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -128(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -32(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L4
+.L5:
+	movl $0, -32(%rbp)
+	movl $0, -144(%rbp)
+	movl $10, -140(%rbp)
+	movl $20, -136(%rbp)
+	movl $30, -132(%rbp)
+	movl $4, -32(%rbp)
+	movb $2, -25(%rbp)
+	movq -40(%rbp), %rax
+	addq $1024, %rax
+	movq %rax, -40(%rbp)
+	movzbl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	je .L6
+	movl $128, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L7
+.L6:
+	movl $0, %eax
+.L7:
+	movl %eax, -32(%rbp)
+	movl ga1+0(%rip), %eax
+	movl ga1+8(%rip), %ecx
+	imull %ecx, %eax
+	movq %rax, %rcx
+	movsbl -25(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -25(%rbp)
+	movq $0, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movzbl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movl -4(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movswq -6(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movslq -12(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movsbq -25(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movslq -32(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movl $0, -32(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl $4, -32(%rbp)
+	movl $0, -32(%rbp)
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl ga1+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl $4, -32(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $0, -116(%rbp)
+	je .L8
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L9
+	.p2align 4,,10
+.L10:
+	movslq -32(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -160(%rbp)
+	jne .L10
+.L11:
+.L8:
+.L9:
+	cmpl $16, -32(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movslq -32(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L12
+.L13:
+	movl $0, -32(%rbp)
+	movl -144(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl -140(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl -136(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl -132(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movl $4, -32(%rbp)
+	movq -152(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -152(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -152(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movq -152(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movw %di, -2(%rbp)
+	movl $6, -8(%rbp)
+	movl $4, -12(%rbp)
+	movb $66, -13(%rbp)
+	movw $1, -16(%rbp)
+	movl $8, -20(%rbp)
+	movq $0, -32(%rbp)
+	movl $0, -20(%rbp)
+	imull $10, -20(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -180(%rbp)
+	cmpl $33, -20(%rbp)
+	jge .L14
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L17
+	.p2align 4,,10
+.L16:
+	addl $10, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $10, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $10, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $10, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -192(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $33, -20(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	addl $10, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L18
+.L19:
+	movl $0, -20(%rbp)
+	movl $0, -208(%rbp)
+	movl $1000000007, -204(%rbp)
+	movl $2000000014, -200(%rbp)
+	movl $3, %eax
+	imull $1000000007, %eax, %eax
+	movl %eax, -196(%rbp)
+	movl $4, -20(%rbp)
+	movzbl g1(%rip), %eax
+	testl %eax, %eax
+	jl .L20
+	movzbl g1(%rip), %eax
+	cmpl $4, %eax
+	jge .L20
+	movzbl g1(%rip), %eax
+	movl $0, -208(%rbp,%rax,4)
+.L20:
+.L21:
+	movzbl g1(%rip), %eax
+	testw %ax, %ax
+	jne .LB0
+.L22:
+.L23:
+	movswl -2(%rbp), %eax
+	movl %eax, -212(%rbp)
+	testl %eax, %eax
+	jl .L24
+	cmpl $4, -212(%rbp)
+	jge .L24
+	movswq -2(%rbp), %rax
+	movl $929, -208(%rbp,%rax,4)
+.L24:
+.L25:
+	movzwl -16(%rbp), %eax
+	movzbl g1(%rip), %ecx
+	addl %ecx, %eax
+	movq %rax, %rcx
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl g0(%rip), %eax
+	setae %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	movl -12(%rbp), %eax
+	addl $950, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -20(%rbp)
+	movsbl -13(%rbp), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	cmpl $-44, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB0:
+	movabsq $1003877575317, %rax
+	addq -32(%rbp), %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
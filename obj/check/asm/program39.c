@@ -0,0 +1,35 @@
+char g0;
+long g1;
+short g2 = 6;
+int ga0[4];
+int ga1[8];
+int main() {
+    unsigned char v0 = 2;
+    unsigned int v1 = 571496872464;
+    unsigned short v2 = 1;
+    unsigned short v3 = 2;
+    short v4 = 7u;
+    int i0 = 829;
+    long j0 = 9;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 0; }
+    ga0[2] = (!(v3) / (g0 * g0 + 1));
+    v4 = -(((g2 == 5) >= g2));
+    v2 = -(v3);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,375 @@
+	.section .data
+	.type g2, @object
+	.size g2, 2
+	.p2align 1
+g2:
+	.short 6
+	.section .bss
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.zero 1
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 32
+	.p2align 5
+ga1:
+	.zero 32
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movb $2, -1(%rbp)
+	movl $266222096, -8(%rbp)
+	movw $1, -10(%rbp)
+	movw $2, -12(%rbp)
+	movw $7, -14(%rbp)
+	movl $829, -20(%rbp)
+	movq $9, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -180(%rbp)
+	cmpl $33, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -184(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -192(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -20(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L4
+.L5:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpw $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movl %eax, ga0+8(%rip)
+	movswl g2(%rip), %eax
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	movswl g2(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, -14(%rbp)
+	xorl %eax, %eax
+	movzwl -12(%rbp), %ecx
+	subl %ecx, %eax
+	movw %ax, -10(%rbp)
+	movq $0, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movswq g2(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movzbl -1(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movzwl -10(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movzwl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movswq -14(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movl $0, -20(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jge .L6
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L7
+	.p2align 4,,10
+.L8:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -208(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $8, -20(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L10
+.L11:
+	movl $0, -20(%rbp)
+	cmpl $0, -184(%rbp)
+	je .L12
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -216(%rbp)
+	cmpq $0, -216(%rbp)
+	je .L13
+	.p2align 4,,10
+.L14:
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -216(%rbp)
+	jne .L14
+.L15:
+.L12:
+.L13:
+	cmpl $33, -20(%rbp)
+	jge .L17
+	.p2align 4,,10
+.L16:
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L16
+.L17:
+	movq -200(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -200(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -200(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movq -200(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,29 @@
+int ga0[33];
+long rec(long n, long acc) {
+    if (n < 3 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 3, acc);
+}
+int main() {
+    short v0 = 0;
+    long v1 = 5;
+    int i0 = 4294967295;
+    long j0 = 7;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 7U; }
+    v0 = (rec(4, v0) >= (j0 >= 4));
+    rec(1006995906411, (7 <= ga0[1]));
+    j0 = 0;
+    while (j0 < 33) {
+        v1 = ga0[11];
+        j0 = j0 + 1;
+    }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,849 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.section .text
+	.type rec, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	cmpq $3, %rdi
+	jl .L2
+	cmpq $18, %rdi
+	jg .L2
+.L0:
+.L1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rdi, -64(%rbp)
+	movq %rsi, -56(%rbp)
+	movq %rdi, %rax
+	subq $3, %rax
+	movq %rax, -48(%rbp)
+	movq %rsi, %rax
+	movq %rax, -40(%rbp)
+	cmpq $3, -48(%rbp)
+	jl .L6
+	cmpq $18, -48(%rbp)
+	jle .L4
+.L6:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L3:
+	pushq %rax
+	movq -64(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -48(%rbp)
+	movq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -40(%rbp)
+	cmpq $3, -48(%rbp)
+	jl .L34
+	cmpq $18, -48(%rbp)
+	jle .L32
+.L34:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L31:
+	popq %rcx
+	addq %rcx, %rax
+	leave
+	ret
+.L4:
+.L5:
+	movq -48(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L10
+	cmpq $18, -32(%rbp)
+	jle .L8
+.L10:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L7:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L22
+	cmpq $18, -32(%rbp)
+	jle .L20
+.L22:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L19:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L3
+.L32:
+.L33:
+	movq -48(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L38
+	cmpq $18, -32(%rbp)
+	jle .L36
+.L38:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L35:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L50
+	cmpq $18, -32(%rbp)
+	jle .L48
+.L50:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L47:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L31
+.L8:
+.L9:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L14
+	cmpq $18, -16(%rbp)
+	jle .L12
+.L14:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L11:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L18
+	cmpq $18, -16(%rbp)
+	jle .L16
+.L18:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L15:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L7
+.L20:
+.L21:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L26
+	cmpq $18, -16(%rbp)
+	jle .L24
+.L26:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L23:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L30
+	cmpq $18, -16(%rbp)
+	jle .L28
+.L30:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L27:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L19
+.L36:
+.L37:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L42
+	cmpq $18, -16(%rbp)
+	jle .L40
+.L42:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L39:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L46
+	cmpq $18, -16(%rbp)
+	jle .L44
+.L46:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L43:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L35
+.L48:
+.L49:
+	movq -32(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L54
+	cmpq $18, -16(%rbp)
+	jle .L52
+.L54:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L51:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $3, -16(%rbp)
+	jl .L58
+	cmpq $18, -16(%rbp)
+	jle .L56
+.L58:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L55:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L47
+.L12:
+.L13:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L11
+.L16:
+.L17:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L15
+.L24:
+.L25:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L23
+.L28:
+.L29:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L27
+.L40:
+.L41:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L39
+.L44:
+.L45:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L43
+.L52:
+.L53:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L51
+.L56:
+.L57:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L55
+.L2:
+	movq %rsi, %rax
+	addq %rdi, %rax
+	ret
+	.size rec, .-rec
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movw $0, -2(%rbp)
+	movq $5, -16(%rbp)
+	movl $-1, -20(%rbp)
+	movq $7, -32(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	je .L59
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L62
+	.p2align 4,,10
+.L61:
+	movl -20(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -112(%rbp)
+	jne .L61
+.L62:
+.L59:
+.L60:
+	cmpl $16, -20(%rbp)
+	jge .L64
+	.p2align 4,,10
+.L63:
+	movl -20(%rbp), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L63
+.L64:
+	cmpq $4, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movswq -2(%rbp), %rax
+	movq %rax, -120(%rbp)
+	movq -120(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movq -152(%rbp), %rax
+	addq $1, %rax
+.L66:
+	pushq %rax
+	movq -120(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -128(%rbp)
+	movq -128(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movl $3, %eax
+	testq %rax, %rax
+	jg .L71
+	movl $18, %eax
+	testq %rax, %rax
+	jge .L69
+.L71:
+	movq -144(%rbp), %rax
+	addq $0, %rax
+.L68:
+	pushq %rax
+	movq -128(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -136(%rbp)
+	movl $2, %eax
+	cmpq $3, %rax
+	jl .L75
+	movl $2, %eax
+	cmpq $18, %rax
+	jle .L73
+.L75:
+	movq -136(%rbp), %rax
+	addq $2, %rax
+.L72:
+	popq %rcx
+	addq %rcx, %rax
+.L67:
+	popq %rcx
+	addq %rcx, %rax
+.L65:
+	popq %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	movl ga0+4(%rip), %eax
+	cmpl $7, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -160(%rbp)
+	movabsq $1006995906411, %rax
+	addq -160(%rbp), %rax
+.L76:
+	movq $0, -32(%rbp)
+	cmpq $33, -32(%rbp)
+	jge .L77
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -168(%rbp)
+	cmpq $0, -168(%rbp)
+	je .L80
+	.p2align 4,,10
+.L79:
+	movl ga0+44(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	addq $1, -32(%rbp)
+	movl ga0+44(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	addq $1, -32(%rbp)
+	movl ga0+44(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	addq $1, -32(%rbp)
+	movl ga0+44(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	addq $1, -32(%rbp)
+	subq $1, -168(%rbp)
+	jne .L79
+.L80:
+.L77:
+.L78:
+	cmpq $33, -32(%rbp)
+	jge .L82
+	.p2align 4,,10
+.L81:
+	movl ga0+44(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $33, -32(%rbp)
+	jl .L81
+.L82:
+	movq $0, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jge .L83
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L86
+	.p2align 4,,10
+.L85:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -184(%rbp)
+	jne .L85
+.L86:
+.L83:
+.L84:
+	cmpl $33, -20(%rbp)
+	jge .L88
+	.p2align 4,,10
+.L87:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L87
+.L88:
+	movl $0, -20(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L89
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L92
+	.p2align 4,,10
+.L91:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -192(%rbp)
+	jne .L91
+.L92:
+.L89:
+.L90:
+	cmpl $16, -20(%rbp)
+	jge .L94
+	.p2align 4,,10
+.L93:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L93
+.L94:
+	movq -176(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -176(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -176(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	movq -176(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L69:
+.L70:
+	movq -144(%rbp), %rax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -144(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L68
+.L73:
+.L74:
+	subq $8, %rsp
+	movq -136(%rbp), %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -136(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L72
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
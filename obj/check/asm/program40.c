@@ -0,0 +1,156 @@
+int f0(int p0, unsigned long p1, unsigned int p2, long p3) {
+    long v0 = 4;
+    long v1 = 8;
+    int v2 = 5;
+    char v3 = 144;
+    unsigned char v4 = 1U;
+    unsigned char v5 = 2;
+    int i0 = 601;
+    long j0 = 3;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    if (((p2 + v3) / (v1 * v1 + 1))) { return ((v3 + 3ul) + (0 * 993)); }
+    for (p1 = 0; p1 < 4; p1 = p1 + 1) {
+        v5 = (!((8 / 8)) / 10);
+        v1 = v1 + -(0);
+        v2 = la0[5];
+    }
+    if (p2 >= 0 && p2 < 8) { la0[p2] = (!(j0) - (255 * v0)); }
+    if (0) { return !((p0 || 671)); }
+    return (((i0 == 4) + (202ul == j0)) - ((10 > 226) / (p3 * p3 + 1)));
+}
+int main() {
+    unsigned short v0 = 217553428124;
+    unsigned int v1 = 580;
+    unsigned int v2 = 6;
+    int i0 = 10;
+    long j0 = 226u;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 797553704880; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 10; }
+    v1 = v0;
+    v0 = v0 + ((6 / (v2 * v2 + 1)) - (v0 - 5));
+    v1 = f0(749, la0[12], (8l - la0[20]), (9 * 0));
+    la0[8] = f0(j0, 9, la1[16], v2);
+    v2 = 7;
+    v1 = 506;
+    for (v2 = 0; v2 < 33; v2 = v2 + 1) {
+        for (v1 = 0; v1 < 5; v1 = v1 + 1) {
+            j0 = ((65535 < (v0 == 7)) < (880115087263 <= i0));
+            v0 = (!(v0) > (!(j0) == (j0 == v0)));
+        }
+    }
+    if (f0(124, 2, 293402076082, la1[10])) {
+        i0 = -((939 || (j0 + 422)));
+        if ((v1 / (v2 * v2 + 1))) { return f0(v0, v1, v2, 712); }
+        v2 = j0;
+    } else {
+        v1 = (7 + i0);
+        switch (i0) {
+        case 1:
+            for (j0 = 0; j0 < 100; j0 = j0 + 1) {
+                if ((7 && (683 || v2))) { break; }
+            }
+            v2 = (la0[4] == (unsigned int)(5));
+        case 481:
+            if (128) {
+                if (j0 >= 0 && j0 < 33) { la1[j0] = ((2 / (v2 * v2 + 1)) != (6 != v0)); }
+                v1 = (218 <= (943 >= 4));
+                la1[16] = 128;
+            }
+            break;
+        case 995:
+            switch (f0(9, 6, i0, la1[12])) {
+            case 5:
+                break;
+            case 2:
+                f0((i0 / 5l), (i0 / 16), (v2 >= 525), v2);
+                f0((4U / (v0 * v0 + 1)), v2, (i0 / 13ul), -(6));
+                break;
+            case 9:
+                break;
+            case 8:
+                f0(v1, (6 >= 626), (j0 < v2), 299);
+            case 1:
+                break;
+            case 10:
+                v0 = (f0(5, i0, v1, j0) / (v2 * v2 + 1));
+                v1 = !(v1);
+            }
+        case 3:
+            break;
+        case 46:
+            break;
+        case 739:
+            break;
+        case 37:
+            switch ((v1 == (j0 * v0))) {
+            case 10:
+            default:
+            case 1:
+                v0 = (unsigned int)((v0 != f0(v0, la0[32], 838, v2)));
+                break;
+            case 2:
+                break;
+            }
+            break;
+        }
+        switch ((-(la1[6]) + f0(4, 565, la0[27], v2))) {
+        case 9:
+            break;
+        case 1:
+            la1[0] = i0;
+            if (((long)(v1) > (v0 + (975 > 7)))) {
+                v0 = v0 + !(la1[14]);
+                f0((v1 + 2), (8 / (i0 * i0 + 1)), f0(6, 2, la1[18], i0), f0(1, v0, i0, 9));
+                if (((i0 * v2) / (j0 * j0 + 1))) { return v1; }
+            } else {
+                v0 = (v0 && i0);
+            }
+        case 5:
+        case 0:
+            if (f0(424423254821, i0, (v2 + v2), -(j0))) {
+                j0 = !((v0 == la0[8]));
+                f0((v2 - v0), v0, 103833461704, (v1 / (v0 * v0 + 1)));
+            }
+            switch (-((j0 - j0))) {
+            case 37:
+                v0 = v0 + !((unsigned int)(i0));
+                break;
+            default:
+                v1 = (i0 / (i0 * i0 + 1));
+            case 54:
+            case 23:
+                if (j0 >= 0 && j0 < 33) { la0[j0] = (!(la0[28]) + (la1[30] <= 2)); }
+            case -2:
+            }
+            break;
+        case 3:
+            for (j0 = 0; j0 < 33; j0 = j0 + 1) {
+                if (v1) { break; }
+            }
+            v2 = 0;
+            while (v2 < 5) {
+                if ((v0 / (v1 * v1 + 1))) { break; }
+                v2 = v2 + 1;
+            }
+            break;
+        case 6:
+            v1 = ((0 - 6) <= (!(v0) + (261 * v2)));
+            if (j0 >= 0 && j0 < 33) { la0[j0] = j0; }
+        default:
+            break;
+        }
+    }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1528 @@
+	.section .text
+	.type f0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.2, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movl %edi, -4(%rbp)
+	movq %rsi, -16(%rbp)
+	movl %edx, -20(%rbp)
+	movq %rcx, -32(%rbp)
+	movq $4, -40(%rbp)
+	movq $8, -48(%rbp)
+	movl $5, -52(%rbp)
+	movb $-112, -53(%rbp)
+	movb $1, -54(%rbp)
+	movb $2, -55(%rbp)
+	movl $601, -60(%rbp)
+	movq $3, -72(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -112(%rbp)
+	movl $2, -108(%rbp)
+	movl $4, -104(%rbp)
+	movl $6, -100(%rbp)
+	movl $8, -96(%rbp)
+	movl $10, -92(%rbp)
+	movl $12, -88(%rbp)
+	movl $14, -84(%rbp)
+	movl $8, -60(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbl -53(%rbp), %eax
+	addl -20(%rbp), %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB0
+.L0:
+.L1:
+	movq $0, -16(%rbp)
+	movl $1, -116(%rbp)
+	movl $0, -120(%rbp)
+	cmpl $0, -116(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -55(%rbp)
+	movslq -120(%rbp), %rax
+	movq %rax, -128(%rbp)
+	addq %rax, -48(%rbp)
+	movl -92(%rbp), %eax
+	movl %eax, -52(%rbp)
+	cmpl $0, -116(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -55(%rbp)
+	movq -128(%rbp), %rax
+	addq %rax, -48(%rbp)
+	movl -92(%rbp), %eax
+	movl %eax, -52(%rbp)
+	cmpl $0, -116(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -55(%rbp)
+	movq -128(%rbp), %rax
+	addq %rax, -48(%rbp)
+	movl -92(%rbp), %eax
+	movl %eax, -52(%rbp)
+	cmpl $0, -116(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -55(%rbp)
+	movq -128(%rbp), %rax
+	addq %rax, -48(%rbp)
+	movl -92(%rbp), %eax
+	movl %eax, -52(%rbp)
+	movq $4, -16(%rbp)
+	cmpl $0, -20(%rbp)
+	jb .L2
+	cmpl $8, -20(%rbp)
+	jae .L2
+	cmpq $0, -72(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	imulq $255, -40(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	movl %ecx, -112(%rbp,%rax,4)
+.L2:
+.L3:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -72(%rbp), %rax
+	cmpq $202, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $4, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	subq %rcx, %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB0:
+	movsbq -53(%rbp), %rax
+	addq $3, %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq $8, -16(%rbp)
+	movb $-112, -25(%rbp)
+	movq $3, -8(%rbp)
+	movl $10, -20(%rbp)
+	movl $8, -24(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbl -25(%rbp), %eax
+	addl $1344299954, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L4
+	movsbq -25(%rbp), %rax
+	addq $3, %rax
+.f0.constprop.1_return:
+	leave
+	ret
+.L4:
+.L5:
+	movl -20(%rbp), %eax
+	movl -20(%rbp), %eax
+	movl -20(%rbp), %eax
+	movl -20(%rbp), %eax
+	movq %rsi, %rax
+	imulq %rsi, %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	cmpq $202, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $4, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	subq %rcx, %rax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movq $4, -24(%rbp)
+	movq $8, -32(%rbp)
+	movl $5, -36(%rbp)
+	movb $-112, -37(%rbp)
+	movb $1, -38(%rbp)
+	movb $2, -39(%rbp)
+	movl $601, -44(%rbp)
+	movq $3, -56(%rbp)
+	movl $0, -44(%rbp)
+	movl $0, -96(%rbp)
+	movl $2, -92(%rbp)
+	movl $4, -88(%rbp)
+	movl $6, -84(%rbp)
+	movl $8, -80(%rbp)
+	movl $10, -76(%rbp)
+	movl $12, -72(%rbp)
+	movl $14, -68(%rbp)
+	movl $8, -44(%rbp)
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbl -37(%rbp), %eax
+	addl -12(%rbp), %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB1
+.L6:
+.L7:
+	movq $0, -8(%rbp)
+	movb $0, -39(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -36(%rbp)
+	movb $0, -39(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -36(%rbp)
+	movb $0, -39(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -36(%rbp)
+	movb $0, -39(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -36(%rbp)
+	movq $4, -8(%rbp)
+	cmpl $0, -12(%rbp)
+	jb .L8
+	cmpl $8, -12(%rbp)
+	jae .L8
+	cmpq $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	imulq $255, -24(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L8:
+.L9:
+	movq -56(%rbp), %rax
+	cmpq $202, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $4, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB1:
+	movsbq -37(%rbp), %rax
+	addq $3, %rax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movl %edi, -4(%rbp)
+	movq %rsi, -16(%rbp)
+	movl %edx, -20(%rbp)
+	movq $4, -32(%rbp)
+	movq $8, -40(%rbp)
+	movl $5, -44(%rbp)
+	movb $-112, -45(%rbp)
+	movb $1, -46(%rbp)
+	movb $2, -47(%rbp)
+	movl $601, -52(%rbp)
+	movq $3, -64(%rbp)
+	movl $0, -52(%rbp)
+	movl $0, -96(%rbp)
+	movl $2, -92(%rbp)
+	movl $4, -88(%rbp)
+	movl $6, -84(%rbp)
+	movl $8, -80(%rbp)
+	movl $10, -76(%rbp)
+	movl $12, -72(%rbp)
+	movl $14, -68(%rbp)
+	movl $8, -52(%rbp)
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbl -45(%rbp), %eax
+	addl -20(%rbp), %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB2
+.L10:
+.L11:
+	movq $0, -16(%rbp)
+	movb $0, -47(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -44(%rbp)
+	movb $0, -47(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -44(%rbp)
+	movb $0, -47(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -44(%rbp)
+	movb $0, -47(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -44(%rbp)
+	movq $4, -16(%rbp)
+	cmpl $0, -20(%rbp)
+	jb .L12
+	cmpl $8, -20(%rbp)
+	jae .L12
+	cmpq $0, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	imulq $255, -32(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L12:
+.L13:
+	movq -64(%rbp), %rax
+	cmpq $202, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $4, -52(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB2:
+	movsbq -45(%rbp), %rax
+	addq $3, %rax
+	jmp .f0.constprop.2_return
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $464, %rsp
+	movw $56988, -2(%rbp)
+	movl $580, -8(%rbp)
+	movl $6, -12(%rbp)
+	movl $10, -16(%rbp)
+	movq $226, -24(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -164(%rbp)
+	testl %eax, %eax
+	je .L14
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L17
+	.p2align 4,,10
+.L16:
+	movslq -16(%rbp), %rax
+	movq %rax, -184(%rbp)
+	movabsq $797553704880, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -184(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $797553704880, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $797553704880, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movabsq $797553704880, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -208(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	subq $1, -176(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $33, -16(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movslq -16(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movabsq $797553704880, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L18
+.L19:
+	movl $0, -16(%rbp)
+	imull $10, -16(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -356(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L20
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -368(%rbp)
+	cmpq $0, -368(%rbp)
+	je .L23
+	.p2align 4,,10
+.L22:
+	addl $10, -356(%rbp)
+	movslq -16(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	addl $10, -356(%rbp)
+	movslq -16(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	addl $10, -356(%rbp)
+	movslq -16(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	addl $10, -356(%rbp)
+	movslq -16(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	subq $1, -368(%rbp)
+	jne .L22
+.L23:
+.L20:
+.L21:
+	cmpl $33, -16(%rbp)
+	jge .L25
+	.p2align 4,,10
+.L24:
+	addl $10, -356(%rbp)
+	movslq -16(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L24
+.L25:
+	movzwl -2(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	subl $5, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	subl %ecx, %eax
+	addl -8(%rbp), %eax
+	movw %ax, -2(%rbp)
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	subq %rcx, %rax
+	movq %rax, %rsi
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movq %rax, %rcx
+	movl -288(%rbp), %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	movl %eax, -128(%rbp)
+	movl $7, -12(%rbp)
+	movl $506, -8(%rbp)
+	movl $0, -12(%rbp)
+	movslq -16(%rbp), %rax
+	movq %rax, -384(%rbp)
+	movq %rax, %rcx
+	movabsq $880115087263, %rax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -372(%rbp)
+	cmpl $33, -12(%rbp)
+	jae .L27
+	.p2align 4,,10
+.L26:
+	movl $0, -8(%rbp)
+	movl -372(%rbp), %eax
+	movl %eax, -388(%rbp)
+	cmpl $5, -8(%rbp)
+	jae .L28
+	movl $5, %eax
+	movl -8(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -400(%rbp)
+	cmpq $0, -400(%rbp)
+	je .L31
+	.p2align 4,,10
+.L30:
+	movzwl -2(%rbp), %eax
+	cmpl $7, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $65535, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl -388(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movzwl -2(%rbp), %eax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	addl $1, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	cmpl $7, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $65535, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl -388(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movzwl -2(%rbp), %eax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -400(%rbp)
+	jne .L30
+.L31:
+.L28:
+.L29:
+	cmpl $5, -8(%rbp)
+	jae .L33
+	.p2align 4,,10
+.L32:
+	movzwl -2(%rbp), %eax
+	cmpl $7, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $65535, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl -388(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movzwl -2(%rbp), %eax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L32
+.L33:
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jb .L26
+.L27:
+	movl -312(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	testl %eax, %eax
+	je .L34
+	movl $939, %eax
+	testl %eax, %eax
+	jne .L36
+	movq -24(%rbp), %rax
+	addq $422, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L37
+.L36:
+	movl $1, %eax
+.L37:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -16(%rbp)
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .LB3
+.L38:
+.L39:
+	movq -24(%rbp), %rax
+	movl %eax, -12(%rbp)
+	jmp .L35
+.L34:
+	movl -16(%rbp), %eax
+	addl $7, %eax
+	movl %eax, -8(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $46, %rax
+	jge .L48
+	cmpq $1, %rax
+	je .L41
+	cmpq $3, %rax
+	je .L40
+	cmpq $37, %rax
+	je .L47
+	jmp .L40
+.L78:
+	movq $0, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jge .L100
+	.p2align 4,,10
+.L99:
+	cmpl $0, -8(%rbp)
+	je .L101
+.L100:
+	movl $0, -12(%rbp)
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -428(%rbp)
+	cmpl $5, -12(%rbp)
+	jae .L104
+	.p2align 4,,10
+.L103:
+	movzwl -2(%rbp), %eax
+	xorl %edx, %edx
+	divl -428(%rbp)
+	testl %eax, %eax
+	je .L105
+.L104:
+.L74:
+.L35:
+	movq $0, -440(%rbp)
+	imulq $31, -440(%rbp), %rax
+	movzwl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	imulq $31, -440(%rbp), %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	imulq $31, -440(%rbp), %rax
+	movl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	imulq $31, -440(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	imulq $31, -440(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -440(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L109
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -448(%rbp)
+	cmpq $0, -448(%rbp)
+	je .L112
+	.p2align 4,,10
+.L111:
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -448(%rbp)
+	jne .L111
+.L112:
+.L109:
+.L110:
+	cmpl $33, -16(%rbp)
+	jge .L114
+	.p2align 4,,10
+.L113:
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L113
+.L114:
+	movl $0, -16(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L115
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -456(%rbp)
+	cmpq $0, -456(%rbp)
+	je .L118
+	.p2align 4,,10
+.L117:
+	movslq -16(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -456(%rbp)
+	jne .L117
+.L118:
+.L115:
+.L116:
+	cmpl $33, -16(%rbp)
+	jge .L120
+	.p2align 4,,10
+.L119:
+	movslq -16(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -440(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L119
+.L120:
+	movq -440(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -440(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -440(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -440(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -440(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -440(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -440(%rbp)
+	movq -440(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L105:
+.L106:
+	addl $1, -12(%rbp)
+	cmpl $5, -12(%rbp)
+	jb .L103
+	jmp .L104
+.L48:
+	cmpq $739, %rax
+	jge .L49
+	cmpq $46, %rax
+	je .L40
+	cmpq $481, %rax
+	je .L42
+	jmp .L40
+.L101:
+.L102:
+	addq $1, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jl .L99
+	jmp .L100
+.L49:
+	cmpq $739, %rax
+	je .L40
+	cmpq $995, %rax
+	je .L43
+	jmp .L40
+.L41:
+	movq $0, -24(%rbp)
+	movl $7, %eax
+	testl %eax, %eax
+	je .L50
+	movl $683, %eax
+	testl %eax, %eax
+	jne .L52
+	cmpl $0, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L51
+.L50:
+	movl $0, %eax
+.L51:
+	movl %eax, -404(%rbp)
+	cmpq $100, -24(%rbp)
+	jge .L55
+	.p2align 4,,10
+.L54:
+	cmpl $0, -404(%rbp)
+	je .L56
+.L55:
+	movl -144(%rbp), %eax
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+.L42:
+	movl $128, %eax
+	testl %eax, %eax
+	je .L58
+	cmpq $0, -24(%rbp)
+	jl .L60
+	cmpq $33, -24(%rbp)
+	jge .L60
+	movzwl -2(%rbp), %eax
+	cmpl $6, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -352(%rbp,%rax,4)
+.L60:
+.L61:
+	movl $943, %eax
+	cmpl $4, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpl $218, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	movl $128, -288(%rbp)
+.L58:
+.L59:
+.L40:
+	movl -12(%rbp), %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	movq %rax, %rdx
+	movl $565, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f0
+	pushq %rax
+	xorl %eax, %eax
+	movl -328(%rbp), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L74
+	leaq .L82(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L80
+	# table target .L77
+	# table target .L76
+	# table target .L78
+	# table target .L79
+	# table target .L75
+	jmp *%rcx
+.L81:
+.L107:
+.L108:
+.L80:
+	jmp .L74
+.L56:
+.L57:
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jl .L54
+	jmp .L55
+.L52:
+	movl $1, %eax
+.L53:
+	jmp .L51
+.L69:
+.L62:
+.L44:
+	jmp .L40
+.L45:
+	jmp .L40
+.L46:
+	jmp .L40
+.L43:
+	movl -304(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L40
+	leaq .L70(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L62
+	# table target .L67
+	# table target .L64
+	# table target .L63
+	# table target .L66
+	# table target .L65
+	# table target .L68
+	jmp *%rcx
+.L47:
+	movzwl -2(%rbp), %eax
+	imulq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L72
+	cmpq $2, %rax
+	je .L40
+	cmpq $10, %rax
+.L72:
+	movl -12(%rbp), %eax
+	movq %rax, %rcx
+	movl $838, %eax
+	movq %rax, %rdx
+	movl -32(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movl %eax, -412(%rbp)
+	movq %rax, %rdi
+	call f0
+	cmpl %eax, -412(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+.L71:
+	jmp .L40
+.L73:
+	jmp .L40
+.L63:
+	jmp .L40
+.L64:
+	movl -12(%rbp), %eax
+	pushq %rax
+	cmpl $525, -12(%rbp)
+	setae %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movq -384(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	xorl %eax, %eax
+	subl $6, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movslq -16(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movl -12(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movl %eax, -408(%rbp)
+	imull -408(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	jmp .L40
+.L65:
+	jmp .L40
+.L66:
+	movl $299, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	cmpq %rax, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $6, %eax
+	cmpl $626, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+.L67:
+	jmp .L40
+.L68:
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movslq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movw %ax, -2(%rbp)
+	cmpl $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	jmp .L40
+.L75:
+	jmp .L74
+.L76:
+	movl -16(%rbp), %eax
+	movl %eax, -352(%rbp)
+	movl $975, %eax
+	cmpl $7, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	movl %eax, -416(%rbp)
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	cmpq %rcx, %rax
+	jle .L83
+	movl -296(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl -416(%rbp), %eax
+	movw %ax, -2(%rbp)
+	movl $9, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	movl %eax, -420(%rbp)
+	movq %rax, %rdx
+	movzwl -2(%rbp), %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movq -384(%rbp), %rax
+	movq %rax, %rcx
+	movl -280(%rbp), %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	addl $2, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -420(%rbp), %eax
+	imull -12(%rbp), %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB4
+.L85:
+.L86:
+	jmp .L84
+.L83:
+	cmpw $0, -2(%rbp)
+	je .L87
+	cmpl $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L88
+.L87:
+	movl $0, %eax
+.L88:
+	movw %ax, -2(%rbp)
+.L84:
+.L77:
+	xorl %eax, %eax
+	subq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	addl -12(%rbp), %eax
+	movq %rax, %rdx
+	movslq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $-778507483, %eax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	je .L89
+	movzwl -2(%rbp), %eax
+	movl %eax, -424(%rbp)
+	movl -128(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -424(%rbp), %eax
+	imull -424(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	pushq %rax
+	movl $754246600, %eax
+	movq %rax, %rdx
+	movzwl -2(%rbp), %eax
+	movq %rax, %rsi
+	movl -12(%rbp), %eax
+	movzwl -2(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rdi
+	popq %rcx
+	call f0
+.L89:
+.L90:
+	movq -24(%rbp), %rax
+	subq -24(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	cmpq $37, %rax
+	jge .L96
+	cmpq $-2, %rax
+	je .L74
+	cmpq $23, %rax
+	je .L94
+.L93:
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	cltd
+	idivl %ecx
+	movl %eax, -8(%rbp)
+.L94:
+	cmpq $0, -24(%rbp)
+	jl .L74
+	cmpq $33, -24(%rbp)
+	jge .L74
+	movl -232(%rbp), %eax
+	cmpl $2, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -48(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	jmp .L74
+.L92:
+	movl -16(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -2(%rbp)
+.L97:
+.L98:
+.L95:
+.L91:
+	jmp .L74
+.L96:
+	cmpq $37, %rax
+	je .L92
+	cmpq $54, %rax
+	je .L94
+	jmp .L93
+.L79:
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	imull $261, -12(%rbp), %ecx
+	addl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl $6, %eax
+	cmpl %ecx, %eax
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpq $0, -24(%rbp)
+	jl .L74
+	cmpq $33, -24(%rbp)
+	jge .L74
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	jmp .L74
+.LB3:
+	movl -12(%rbp), %eax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdi
+	movq %rbp, %rsp
+	popq %rbp
+	jmp f0.constprop.2
+.LB4:
+	movl -8(%rbp), %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L70:
+	.long .L67-.L70
+	.long .L64-.L70
+	.long .L62-.L70
+	.long .L62-.L70
+	.long .L63-.L70
+	.long .L62-.L70
+	.long .L62-.L70
+	.long .L66-.L70
+	.long .L65-.L70
+	.long .L68-.L70
+	.p2align 2
+.L82:
+	.long .L77-.L82
+	.long .L76-.L82
+	.long .L80-.L82
+	.long .L78-.L82
+	.long .L80-.L82
+	.long .L77-.L82
+	.long .L79-.L82
+	.long .L80-.L82
+	.long .L80-.L82
+	.long .L75-.L82
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,47 @@
+unsigned long g0 = 515L;
+int ga0[16];
+int ga1[4];
+int main() {
+    long v0 = 430;
+    unsigned long v1 = 1;
+    short v2 = 4L;
+    unsigned int v3 = 8ul;
+    char v4 = 0;
+    long v5 = 5;
+    int i0 = 344;
+    long j0 = 128;
+    v4 = g0;
+    j0 = 0;
+    while (j0 < 4) {
+        if (!((int)(831))) {
+            if (j0) {
+                if (v1) { break; }
+                if (ga0[j0] < v3) { v3 = ga0[j0]; }
+            } else {
+                v3 = -(((unsigned char)(v1) / 10));
+                ga0[j0] = ((ga0[10] || i0) - 420743280410);
+            }
+            v5 = (v5 - ((v2 - 8) + i0));
+            i0 = (g0 - ((8U >= 10) / (v2 * v2 + 1)));
+        }
+        j0 = j0 + 1;
+    }
+    v2 = ((unsigned short)(661) / (i0 * i0 + 1));
+    v5 = 8ul;
+    v0 = (((j0 * v2) <= (v3 > v2)) * 540);
+    v1 = -(6);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,176 @@
+short g0 = 7;
+long g1;
+int ga0[4];
+int ga1[16];
+int f0(unsigned int p0) {
+    unsigned short v0 = 3;
+    unsigned char v1 = 4ul;
+    int i0 = 939;
+    long j0 = 710;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 501; }
+    if ((((381 >= j0) || (7 || 0)) - (g1 * 453))) {
+        v0 = (j0 * 65535);
+    }
+    if (3) {
+        if (j0 >= 0 && j0 < 4) { la0[j0] = ((unsigned int)(v0) || 2); }
+        if (-(!(la0[3]))) {
+            if ((char)(10)) {
+                if (ga0[3]) { return (p0 * (unsigned char)(j0)); }
+            }
+            j0 = 0;
+            while (j0 < 3) {
+                if (g1) { break; }
+                if (1000000007) { break; }
+                j0 = j0 + 1;
+            }
+            la0[0] = (v0 || (1 > 10));
+        }
+    } else {
+        v1 = 848840627186;
+    }
+    v1 = v0;
+    if (la0[1]) { return i0; }
+    j0 = 0;
+    while (j0 < 33) {
+        v0 = v0;
+        j0 = j0 + 1;
+    }
+    switch (((g1 * p0) <= (389 + 422l))) {
+    case 3:
+        switch (((953 / (v1 * v1 + 1)) / 3u)) {
+        default:
+            switch (i0) {
+            case -5:
+                j0 = j0 + ((unsigned long)(v1) < 612071767008);
+                if (i0) { return (char)(v1); }
+            case 3:
+                break;
+            default:
+                if (g0) { return (g0 / (i0 * i0 + 1)); }
+                v0 = -(((716 * 633L) != -(965ul)));
+                break;
+            case 43:
+                break;
+            case 1:
+                break;
+            case 927:
+                j0 = (1 / 2);
+                break;
+            }
+        case 44:
+            j0 = !(-(508));
+            v1 = (4 < -(p0));
+            break;
+        case -2:
+            for (p0 = 2; p0 < 8; p0 = p0 + 1) {
+                i0 = i0 + (p0 * g0);
+                j0 = (v1 < -(-(9)));
+            }
+            if (p0 >= 0 && p0 < 4) { la0[p0] = (4 || 952); }
+            break;
+        }
+        break;
+    case 0:
+        if (453ul) { return j0; }
+        for (p0 = 0; p0 < 4; p0 = p0 + 1) {
+            if ((i0 + (p0 < 649U))) {
+                i0 = -((1035005885214 / (v1 * v1 + 1)));
+                j0 = j0 + i0;
+                if ((2147483647 <= (v1 && g0))) { break; }
+            }
+            switch (((7 == 4294967295) && g0)) {
+            case 4:
+                i0 = 968598927246;
+                break;
+            case 6:
+                break;
+            default:
+                v1 = (char)((618 != 109));
+                break;
+            case 7:
+                break;
+            }
+            la0[p0] = (8 || (j0 / (v1 * v1 + 1)));
+        }
+    }
+    j0 = (g0 / 13ul);
+    return v0;
+}
+unsigned short f1(char p0, char p1, unsigned char p2, char p3) {
+    unsigned char v0 = 755;
+    char v1 = 9;
+    int i0 = 8ul;
+    long j0 = 2147483647L;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 761812796961; }
+    p1 = (127 / 3u);
+    if (8) {
+        p3 = g1;
+        p2 = ((unsigned short)(p1) || (ga1[0] * !(j0)));
+    } else {
+        i0 = 0;
+        while (i0 < 8) {
+            v1 = ((10 + p0) == !(f0(j0)));
+            p2 = 6;
+            i0 = i0 + 1;
+        }
+        if ((-(5ul) + (v1 / 1024))) {
+            j0 = (unsigned int)(f0(p3));
+            f0(-(v1));
+        } else {
+            p2 = (v0 + (492000122487 && 830));
+        }
+        f0(f0(la0[6]));
+    }
+    if ((la1[4] != (p0 < -(902)))) {
+        i0 = f0((g0 * ga0[0]));
+    } else {
+        f0((i0 - g1));
+        if (p0 >= 0 && p0 < 8) { la1[p0] = ((i0 != ga1[5]) > v1); }
+    }
+    return (0l > 708);
+}
+int rec(int n, int acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    unsigned char v0 = 4;
+    unsigned long v1 = 727384468461;
+    unsigned char v2 = 128;
+    short v3 = 890;
+    unsigned char v4 = 9;
+    long v5 = 570;
+    int i0 = 8;
+    long j0 = 982552074102;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 2; }
+    f1(f0(0), (v5 < g0), v3, (403241737834U >= 9));
+    f0((int)(1000000007));
+    for (j0 = 0; j0 < 16; j0 = j0 + 1) {
+        v2 = rec(v4, 436u);
+    }
+    v5 = ((short)(f1(j0, g1, v5, g1)) != v0);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
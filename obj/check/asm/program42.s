@@ -0,0 +1,933 @@
+	.section .data
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.short 7
+	.section .bss
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 64
+	.p2align 5
+ga1:
+	.zero 64
+	.section .text
+	.type f0, @function
+	.global main
+	.type main, @function
+	.type rec, @function
+	.type f1, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movl %edi, -4(%rbp)
+	movw $3, -6(%rbp)
+	movb $4, -7(%rbp)
+	movl $939, -12(%rbp)
+	movq $710, -24(%rbp)
+	movl $0, -12(%rbp)
+	movl $0, -48(%rbp)
+	movl $501, -44(%rbp)
+	movl $1002, -40(%rbp)
+	movl $1503, -36(%rbp)
+	movl $4, -12(%rbp)
+	cmpq $381, -24(%rbp)
+	jle .L2
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L3
+.L2:
+	movl $1, %eax
+.L3:
+	movslq %eax, %rax
+	imulq $453, g1(%rip), %rcx
+	subq %rcx, %rax
+	je .L0
+	imulq $65535, -24(%rbp), %rax
+	movw %ax, -6(%rbp)
+.L0:
+.L1:
+	cmpq $0, -24(%rbp)
+	jl .L4
+	cmpq $4, -24(%rbp)
+	jge .L4
+	movzwl -6(%rbp), %eax
+	testl %eax, %eax
+	jne .L6
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L7
+.L6:
+	movl $1, %eax
+.L7:
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+.L4:
+.L5:
+	movl -36(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L8
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	jne .LB0
+.L10:
+.L11:
+	movq $0, -24(%rbp)
+	cmpq $3, -24(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	cmpq $0, g1(%rip)
+.L13:
+	cmpw $0, -6(%rbp)
+	jne .L16
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L17
+.L16:
+	movl $1, %eax
+.L17:
+	movl %eax, -48(%rbp)
+.L8:
+.L9:
+	movzwl -6(%rbp), %eax
+	movb %al, -7(%rbp)
+	movl -44(%rbp), %eax
+	testl %eax, %eax
+	jne .LB1
+.L18:
+.L19:
+	movq $0, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jge .L20
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -56(%rbp)
+	cmpq $0, -56(%rbp)
+	je .L23
+	.p2align 4,,10
+.L22:
+	addq $1, -24(%rbp)
+	addq $1, -24(%rbp)
+	addq $1, -24(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -56(%rbp)
+	jne .L22
+.L23:
+.L20:
+.L21:
+	cmpq $33, -24(%rbp)
+	jge .L25
+	.p2align 4,,10
+.L24:
+	addq $1, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jl .L24
+.L25:
+	movl -4(%rbp), %eax
+	imulq g1(%rip), %rax
+	cmpq $811, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L28
+	cmpq $3, %rax
+	je .L27
+.L26:
+	movswq g0(%rip), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, -24(%rbp)
+	movzwl -6(%rbp), %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L14:
+.L15:
+	jmp .L13
+.L27:
+	movzbl -7(%rbp), %eax
+	movl %eax, -60(%rbp)
+	imull -60(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $953, %eax
+	cltd
+	idivl %ecx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movslq %eax, %rax
+	cmpq $-2, %rax
+	je .L32
+	cmpq $44, %rax
+	je .L31
+.L30:
+	movl -12(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	jge .L40
+	cmpq $-5, %rax
+	je .L34
+	cmpq $1, %rax
+	je .L33
+.L36:
+	cmpw $0, g0(%rip)
+	jne .LB2
+.L43:
+.L44:
+	movw $65535, -6(%rbp)
+	jmp .L33
+.L32:
+	movl $2, -4(%rbp)
+	movzbl -7(%rbp), %eax
+	cmpl $9, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	movswl g0(%rip), %eax
+	imull $2, %eax, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movslq -64(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movswl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movswl g0(%rip), %eax
+	imull $4, %eax, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movswl g0(%rip), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movswl g0(%rip), %eax
+	imull $6, %eax, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movswl g0(%rip), %eax
+	imull $7, %eax, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movl $8, -4(%rbp)
+	cmpl $0, -4(%rbp)
+	jb .L26
+	cmpl $4, -4(%rbp)
+	jae .L26
+	movl -4(%rbp), %eax
+	movl $1, -48(%rbp,%rax,4)
+.L45:
+.L46:
+.L29:
+	jmp .L26
+.L34:
+	movzbl -7(%rbp), %eax
+	movabsq $612071767008, %rcx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -12(%rbp)
+	jne .LB3
+.L41:
+.L42:
+.L35:
+.L33:
+.L31:
+	movq $0, -24(%rbp)
+	xorl %eax, %eax
+	subl -4(%rbp), %eax
+	cmpl $4, %eax
+	seta %al
+	movzbl %al, %eax
+	movb %al, -7(%rbp)
+	jmp .L26
+.L40:
+	cmpq $3, %rax
+	je .L35
+	cmpq $43, %rax
+	je .L33
+	cmpq $927, %rax
+	je .L39
+	jmp .L36
+.L37:
+	jmp .L33
+.L38:
+	jmp .L33
+.L39:
+	movq $0, -24(%rbp)
+	jmp .L33
+.LB1:
+	movl -12(%rbp), %eax
+	jmp .f0_return
+.L28:
+	movq -24(%rbp), %rax
+	jmp .f0_return
+.LB0:
+	movq -24(%rbp), %rax
+	movzbl %al, %eax
+	imull -4(%rbp), %eax
+	jmp .f0_return
+.LB3:
+	movzbl -7(%rbp), %eax
+	movsbl %al, %eax
+	jmp .f0_return
+.LB2:
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movswl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movb $4, -1(%rbp)
+	movabsq $727384468461, %rax
+	movq %rax, -16(%rbp)
+	movb $128, -17(%rbp)
+	movw $890, -20(%rbp)
+	movb $9, -21(%rbp)
+	movq $570, -32(%rbp)
+	movl $8, -36(%rbp)
+	movabsq $982552074102, %rax
+	movq %rax, -48(%rbp)
+	movl $0, -36(%rbp)
+	movl $0, -64(%rbp)
+	movl $2, -60(%rbp)
+	movl $4, -56(%rbp)
+	movl $6, -52(%rbp)
+	movl $4, -36(%rbp)
+	movl $0, -36(%rbp)
+	movl $0, -96(%rbp)
+	movl $2, -92(%rbp)
+	movl $4, -88(%rbp)
+	movl $6, -84(%rbp)
+	movl $8, -80(%rbp)
+	movl $10, -76(%rbp)
+	movl $12, -72(%rbp)
+	movl $14, -68(%rbp)
+	movl $8, -36(%rbp)
+	movl $1, %eax
+	pushq %rax
+	movswl -20(%rbp), %eax
+	pushq %rax
+	movswq g0(%rip), %rax
+	cmpq %rax, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	call f1
+	movl $1000000007, %eax
+	movq %rax, %rdi
+	call f0
+	movq $0, -48(%rbp)
+	cmpq $16, -48(%rbp)
+	jge .L48
+	.p2align 4,,10
+.L47:
+	movzbl -21(%rbp), %eax
+	movl %eax, -100(%rbp)
+	cmpl $2, -100(%rbp)
+	jl .L52
+	cmpl $18, -100(%rbp)
+	jle .L50
+.L52:
+	movl -100(%rbp), %eax
+	addl $436, %eax
+.L49:
+	movb %al, -17(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $16, -48(%rbp)
+	jl .L47
+.L48:
+	movq g1(%rip), %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movq g1(%rip), %rax
+	movq %rax, %rsi
+	movq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movswl %ax, %eax
+	movzbl -1(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq $0, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movswq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movzbl -1(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movzbl -17(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movswq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movzbl -21(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movl $0, -36(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movl $4, -36(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L61
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L64
+	.p2align 4,,10
+.L63:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -136(%rbp)
+	jne .L63
+.L64:
+.L61:
+.L62:
+	cmpl $16, -36(%rbp)
+	jge .L66
+	.p2align 4,,10
+.L65:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L65
+.L66:
+	movl $0, -36(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movl -52(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movl $4, -36(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jge .L67
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L70
+	.p2align 4,,10
+.L69:
+	movslq -36(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -144(%rbp)
+	jne .L69
+.L70:
+.L67:
+.L68:
+	cmpl $8, -36(%rbp)
+	jge .L72
+	.p2align 4,,10
+.L71:
+	movslq -36(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L71
+.L72:
+	movq -128(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -128(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -128(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movq -128(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L50:
+.L51:
+	movl -100(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -104(%rbp)
+	movl -100(%rbp), %eax
+	addl $1308, %eax
+	movl %eax, -108(%rbp)
+	cmpl $2, -104(%rbp)
+	jl .L56
+	cmpl $18, -104(%rbp)
+	jle .L54
+.L56:
+	movl -108(%rbp), %eax
+	addl -104(%rbp), %eax
+.L53:
+	jmp .L49
+.L54:
+.L55:
+	movl -104(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -112(%rbp)
+	imull $3, -108(%rbp), %eax
+	addl -104(%rbp), %eax
+	movl %eax, -116(%rbp)
+	cmpl $2, -112(%rbp)
+	jl .L60
+	cmpl $18, -112(%rbp)
+	jle .L58
+.L60:
+	movl -116(%rbp), %eax
+	addl -112(%rbp), %eax
+.L57:
+	jmp .L49
+.L58:
+.L59:
+	imull $3, -116(%rbp), %eax
+	addl -112(%rbp), %eax
+	movq %rax, %rsi
+	movl -112(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L49
+	.size main, .-main
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $2, -8(%rbp)
+	jl .L75
+	cmpl $18, -8(%rbp)
+	jg .L75
+.L73:
+.L74:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L75:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movb %dil, -1(%rbp)
+	movb %sil, -2(%rbp)
+	movb %dl, -3(%rbp)
+	movb %cl, -4(%rbp)
+	movb $243, -5(%rbp)
+	movb $9, -6(%rbp)
+	movl $8, -12(%rbp)
+	movq $2147483647, -24(%rbp)
+	movl $0, -12(%rbp)
+	movl $0, -64(%rbp)
+	movl $4, -60(%rbp)
+	movl $8, -56(%rbp)
+	movl $12, -52(%rbp)
+	movl $16, -48(%rbp)
+	movl $20, -44(%rbp)
+	movl $24, -40(%rbp)
+	movl $28, -36(%rbp)
+	movl $8, -12(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jge .L76
+	movl $8, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -104(%rbp)
+	cmpq $0, -104(%rbp)
+	je .L79
+	.p2align 4,,10
+.L78:
+	movslq -12(%rbp), %rax
+	movq %rax, -112(%rbp)
+	movabsq $761812796961, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -112(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -120(%rbp)
+	movabsq $761812796961, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movabsq $761812796961, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movabsq $761812796961, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	subq $1, -104(%rbp)
+	jne .L78
+.L79:
+.L76:
+.L77:
+	cmpl $8, -12(%rbp)
+	jge .L81
+	.p2align 4,,10
+.L80:
+	movslq -12(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movabsq $761812796961, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jl .L80
+.L81:
+	movb $42, -2(%rbp)
+	movq g1(%rip), %rax
+	movb %al, -4(%rbp)
+	movsbl -2(%rbp), %eax
+	testw %ax, %ax
+	jne .L82
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga1+0(%rip), %eax
+	imull %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L83
+.L82:
+	movl $1, %eax
+.L83:
+	movb %al, -3(%rbp)
+	movsbl -1(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl $-902, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	cmpl %ecx, %eax
+	je .L84
+	movswl g0(%rip), %eax
+	movl ga0+0(%rip), %ecx
+	imull %ecx, %eax
+	movq %rax, %rdi
+	call f0
+	movl %eax, -12(%rbp)
+.L86:
+.L87:
+.L85:
+	movl $0, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L84:
+	movslq -12(%rbp), %rax
+	subq g1(%rip), %rax
+	movq %rax, %rdi
+	call f0
+	cmpl $0, -148(%rbp)
+	jl .L86
+	cmpl $8, -148(%rbp)
+	jge .L86
+	movl ga1+20(%rip), %eax
+	cmpl %eax, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movsbl -6(%rbp), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbq -1(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	jmp .L87
+	.size f1, .-f1
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,318 @@
+long g0 = 568;
+long g1;
+int g2;
+short f0(unsigned short p0, unsigned short p1, unsigned char p2, unsigned short p3, short p4) {
+    int v0 = 3;
+    unsigned int v1 = 3;
+    unsigned long v2 = 325301422075;
+    char v3 = 0;
+    int i0 = 4;
+    long j0 = 910075253307;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 751; }
+    if (!(v2)) { return ((unsigned char)(i0) / (g0 * g0 + 1)); }
+    for (p4 = 1; p4 < 8; p4 = p4 + 1) {
+        if (((2 != 499310177228) != (p2 - p4))) { return -(v3); }
+    }
+    if (((v1 - 10) / 2)) {
+        p4 = p4 + ((unsigned long)(la0[0]) / 8);
+        if (((0 && 720142223011U) == (9 / (p3 * p3 + 1)))) { return ((2 >= p2) != p2); }
+        if (v0 >= 0 && v0 < 16) { la0[v0] = 5; }
+    }
+    v2 = 0;
+    while (v2 < 100) {
+        p1 = (g2 <= (195 && 35));
+        v2 = v2 + 1;
+    }
+    p4 = (!(!(p2)) >= 133);
+    p3 = (p0 / 4);
+    p1 = p1 + 10;
+    return (((v0 || j0) <= (947l / 5l)) == 372);
+}
+char f1(unsigned char p0, int p1, long p2) {
+    unsigned short v0 = 2l;
+    int v1 = 796001797060;
+    unsigned short v2 = 817;
+    int i0 = 7;
+    long j0 = 348698577445;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 132ul; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 264; }
+    for (v1 = 0; v1 < 5; v1 = v1 + 1) {
+        p0 = ((255 < i0) + (7 == g1));
+        v0 = ((f0(859, p1, 49578495633, g1, 0) + (v2 <= g1)) / 1);
+    }
+    i0 = i0 + (unsigned char)(323);
+    p2 = (unsigned long)(f0(6, 9U, 3, g0, 229006228114));
+    i0 = f0(j0, (255u * v0), (49270845152 / 4), (j0 / 3), (unsigned long)(6));
+    if (!(2)) {
+        j0 = f0(-(g2), v0, (v0 == 29), !(i0), (627 < 8));
+        switch (128) {
+        case 815:
+        case -3:
+            break;
+        case 573:
+            p1 = 0;
+            while (p1 < 5) {
+                if (f0(992, 3, 0, p0, p2)) { break; }
+                if (la0[p1] < p2) { p2 = la0[p1]; }
+                p1 = p1 + 1;
+            }
+            break;
+        case 55:
+            break;
+        case 289:
+            if (v2 >= 0 && v2 < 16) { la1[v2] = (-(1030404858727) / (p1 * p1 + 1)); }
+            break;
+        case 12:
+        case 56:
+            p0 = p0 + (!(j0) && (short)(v0));
+            p0 = ((p2 <= (810142745480 / 4)) && 99);
+            break;
+        default:
+        case 27:
+            if ((((int)(p0) - (long)(3)) != f0(207, p2, 8, 1000000007, 160))) {
+                f0(f0(la0[4], 392, 6, 5, v2), (unsigned long)(9), -(8), p2, (659 * p1));
+                p0 = f0((la0[7] > v1), g1, (unsigned char)(0), 264, -(la0[28]));
+            } else {
+                i0 = p1;
+                la1[15] = (9 * (unsigned int)(3));
+            }
+            p1 = f0(p1, (773034552264 - la0[0]), (8 <= 481), f0(la1[15], v2, g0, p0, 0), 10);
+            break;
+        }
+        v0 = 3;
+    }
+    v2 = v2;
+    v1 = (-((g0 - la0[24])) + ((v0 / 10) * 493356815090));
+    return 170;
+}
+int f2(unsigned int p0, short p1, int p2, int p3, long p4) {
+    unsigned char v0 = 255;
+    char v1 = 3;
+    unsigned char v2 = 7;
+    char v3 = 8ul;
+    int v4 = 719831541625;
+    unsigned int v5 = 7;
+    int i0 = 2;
+    long j0 = 6;
+    v5 = v5 + ((j0 >= 2147483647) / (g2 * g2 + 1));
+    if (0) {
+        if (f1((2147483647 * v3), i0, (v3 + 6))) {
+            f0((v2 - p2), (v2 <= p3), !(522l), (int)(6), (v4 <= 8));
+            j0 = g1;
+            switch (((p0 || 1) / (g1 * g1 + 1))) {
+            case -3:
+                break;
+            case 24:
+                p2 = p2 + (0 >= g2);
+                break;
+            default:
+                f0(!(7), (g2 - v3), f0(65535u, 849817389855, 6, 255, 6), p2, f1(108866170713, 0, p1));
+                break;
+            case 49:
+                f1(4, (g2 && 630), 3ul);
+                break;
+            case 404:
+                break;
+            }
+        }
+    }
+    if (f1((unsigned long)(v1), (433 == 10), (p0 / 3))) {
+        switch (1) {
+        case 8:
+            switch ((v2 <= (v5 != v5))) {
+            case -1:
+                v5 = g1;
+                v5 = (f0(v0, p0, 820935802755, 1, g2) != ((g0 - 8) > v2));
+                break;
+            default:
+                f1((0 && 988), (p0 + 1), v3);
+            case 1:
+                v3 = f0(10, -(j0), -(41), i0, 475);
+                break;
+            case 481:
+                f0((v1 / (g1 * g1 + 1)), g2, (p4 - v2), f1(p0, p3, g1), (260 + g0));
+                p3 = (((g1 - 4) + p3) || f0(v0, p3, 5, 0, 5));
+                break;
+            }
+            j0 = (!(2) / (g2 * g2 + 1));
+            break;
+        case 4:
+            if (!(-((857 <= 0)))) {
+                f0(p3, -(v4), (unsigned char)(750), p3, (char)(i0));
+                f1(v2, p4, (v0 >= 222));
+                p1 = f0(p1, g2, 1071686246100, 409l, j0);
+            } else {
+                f0((char)(v1), v1, f1(0, 3, 255), (5 + 3), f0(v2, g2, 1, 364, 6));
+                v4 = v3;
+            }
+            v4 = (f0(1, 783, j0, 581896232501, v5) + f0(p0, v0, 6, 379, g1));
+            break;
+        case 7:
+            p3 = (unsigned char)((unsigned long)(v1));
+        case 2:
+            switch (f0(9, i0, 10, p0, 127)) {
+            case 6:
+                v2 = v2 + ((p0 < p3) - (unsigned char)(v3));
+            default:
+                break;
+            case 1:
+                f0(3, (int)(p0), 1, g2, (p0 - 10));
+                f0(v5, (3 >= i0), p0, p0, (j0 >= v4));
+                break;
+            case 0:
+                break;
+            case 7:
+            }
+            break;
+        }
+        p3 = ((216 * 6) / 3u);
+        p2 = (4 >= ((p4 < 817) == 256));
+    }
+    return j0;
+}
+void w2(unsigned char q0, char q1) {
+    g1 = g1 * 3 + q0;
+}
+long rec(long n, long acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    unsigned long v0 = 778158827136;
+    unsigned int v1 = 531;
+    int i0 = 372;
+    long j0 = 6;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 8; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 603; }
+    g0 = ((g2 + (unsigned short)(10)) || -((j0 <= 3)));
+    v0 = (((1 + la0[21]) + la0[6]) / 2);
+    switch (f0(v1, 649426017085ul, 2, g0, g1)) {
+    case 0:
+        if (((f1(j0, v1, 10) * g1) || 65536)) {
+            if ((unsigned short)((9 || (g0 - 128)))) {
+                g0 = ((v0 - (unsigned int)(64)) >= (unsigned int)((10 + g1)));
+                w2(g2, v1);
+                g1 = f0((i0 / 100), !(la0[32]), la0[30], j0, (977ul / (g0 * g0 + 1)));
+            } else {
+                i0 = (la1[1] - g2);
+            }
+            la0[5] = (974 != 8);
+        } else {
+            if (((g0 + 9) - (731U - v0))) { return 3L; }
+            la1[3] = (int)((g0 + v1));
+        }
+    case 8:
+        switch (3) {
+        case 3:
+            break;
+        case 7:
+            break;
+        case 4:
+            if (g0) { return (g0 - (int)(3U)); }
+            break;
+        case 5:
+            break;
+        case 1:
+            g0 = (7 && ((g0 == i0) != 521));
+            break;
+        case 2:
+            v1 = 0;
+            while (v1 < 3) {
+                if (((861 / 100) < (v0 / (g0 * g0 + 1)))) { break; }
+                v1 = v1 + 1;
+            }
+            break;
+        case 6:
+            i0 = la0[1];
+        }
+        f2((long)(v1), !(544), f0(5, 0, 5, 163, i0), (g1 == 273429693032), 8);
+        break;
+    case 2:
+        break;
+    case 9:
+        w2(g1, 256);
+    case 4:
+        break;
+    default:
+        switch (!(la0[5])) {
+        case 5:
+            w2(g0, i0);
+        }
+        break;
+    }
+    if (j0 >= 0 && j0 < 33) { la0[j0] = f0(g2, la1[0], 444, la1[1], 9); }
+    switch ((481 > g2)) {
+    case -3:
+        break;
+    case 88:
+    case -5:
+        i0 = 0;
+        while (i0 < 33) {
+            switch (((la1[3] + 213) - (g1 <= 4))) {
+            case 1:
+                la0[16] = 3;
+                break;
+            case 0:
+                break;
+            }
+            for (j0 = 0; j0 < 3; j0 = j0 + 1) {
+                if (f1(v1, 494, 65536)) { break; }
+                if (f0(50, 9, 2, g1, g2)) { break; }
+                if (((v1 != 6) - 477)) { break; }
+            }
+            if (g0) {
+                g0 = g0 + ((7u / (g2 * g2 + 1)) * !(5));
+            } else {
+                g0 = (unsigned int)(((631 + g1) - 10));
+                v1 = (((5 >= g2) == g1) - (short)((la0[10] <= la1[3])));
+                j0 = j0 + 4294967295;
+            }
+            i0 = i0 + 1;
+        }
+        break;
+    default:
+        j0 = ((8 / (g2 * g2 + 1)) / (g0 * g0 + 1));
+        v1 = v1 + ((g0 * v1) > 571);
+        break;
+    case 54:
+        if (v0) {
+            switch ((g1 - !(293))) {
+            case 7:
+                break;
+            }
+        }
+        break;
+    case 67:
+        break;
+    case 12:
+        switch (!((v1 || la0[11]))) {
+        default:
+            w2(g0, 8);
+            break;
+        case 31:
+            w2(j0, 983);
+            break;
+        }
+        v0 = rec((g1 && g0), 788);
+        break;
+    case 521:
+    }
+    g1 = (f0(798, la1[2], g1, 127, 397012325946) - f2(v0, la1[0], 7, v1, v1));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
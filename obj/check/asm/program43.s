@@ -0,0 +1,3241 @@
+	.section .data
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.quad 568
+	.section .bss
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.zero 8
+	.type g2, @object
+	.size g2, 4
+	.p2align 2
+g2:
+	.zero 4
+	.section .text
+	.type f0, @function
+	.type f0.constprop.3, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.type f1, @function
+	.type rec, @function
+	.type f2, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movb %dl, -5(%rbp)
+	movw %cx, -8(%rbp)
+	movw %r8w, -10(%rbp)
+	movl $3, -16(%rbp)
+	movl $3, -20(%rbp)
+	movabsq $325301422075, %rax
+	movq %rax, -32(%rbp)
+	movb $0, -33(%rbp)
+	movl $4, -40(%rbp)
+	movabsq $910075253307, %rax
+	movq %rax, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $751, -40(%rbp), %eax
+	subl $751, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -40(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $751, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $751, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $751, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $751, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -128(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -40(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $751, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L4
+.L5:
+	cmpq $0, -32(%rbp)
+	je .LB0
+.L6:
+.L7:
+	movw $1, -10(%rbp)
+	movabsq $499310177228, %rax
+	cmpq $2, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	xorl %eax, %eax
+	movsbl -33(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -136(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -140(%rbp)
+	cmpl $8, %eax
+	jge .L9
+	.p2align 4,,10
+.L8:
+	movzbl -5(%rbp), %eax
+	subl -140(%rbp), %eax
+	cmpl %eax, -132(%rbp)
+	jne .LB1
+.L10:
+.L11:
+	movl -140(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -140(%rbp)
+	cmpl $8, %eax
+	jl .L8
+.L9:
+	movl -20(%rbp), %eax
+	subl $10, %eax
+	shrl $1, %eax
+	testl %eax, %eax
+	je .L12
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	shrq $3, %rax
+	movq %rax, %rcx
+	movswq -10(%rbp), %rax
+	addq %rcx, %rax
+	movw %ax, -10(%rbp)
+	movzwl -8(%rbp), %eax
+	movl %eax, -144(%rbp)
+	imull -144(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	xorl %eax, %eax
+	je .L16
+	movabsq $720142223011, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L17
+.LB1:
+	movl -136(%rbp), %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L16:
+	movl $0, %eax
+.L17:
+	popq %rcx
+	cmpl %ecx, %eax
+	je .LB2
+.L14:
+.L15:
+	cmpl $0, -16(%rbp)
+	jl .L18
+	cmpl $16, -16(%rbp)
+	jge .L18
+	movslq -16(%rbp), %rax
+	movl $5, -112(%rbp,%rax,4)
+.L18:
+.L19:
+.L12:
+.L13:
+	movq $0, -32(%rbp)
+	movl $195, %eax
+	testl %eax, %eax
+	je .L20
+	movl $35, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L21
+.L20:
+	movl $0, %eax
+.L21:
+	movl %eax, -152(%rbp)
+	cmpq $100, -32(%rbp)
+	jae .L22
+	movl $100, %eax
+	subq -32(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L25
+	.p2align 4,,10
+.L24:
+	movl g2(%rip), %eax
+	cmpl -152(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -32(%rbp)
+	movl g2(%rip), %eax
+	cmpl -152(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -32(%rbp)
+	movl g2(%rip), %eax
+	cmpl -152(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -32(%rbp)
+	movl g2(%rip), %eax
+	cmpl -152(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -32(%rbp)
+	subq $1, -160(%rbp)
+	jne .L24
+.L25:
+.L22:
+.L23:
+	cmpq $100, -32(%rbp)
+	jae .L27
+	.p2align 4,,10
+.L26:
+	movl g2(%rip), %eax
+	cmpl -152(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jb .L26
+.L27:
+	cmpb $0, -5(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cmpl $133, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -10(%rbp)
+	movzwl -2(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movw %ax, -8(%rbp)
+	movzwl -4(%rbp), %eax
+	addl $10, %eax
+	movw %ax, -4(%rbp)
+	movl $947, %eax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	cmpl $0, -16(%rbp)
+	jne .L28
+	cmpq $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L29
+.L28:
+	movl $1, %eax
+.L29:
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl $372, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB0:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	movzbl %al, %eax
+	cqo
+	idivq %rcx
+	jmp .f0_return
+.LB2:
+	movzbl -5(%rbp), %eax
+	movl %eax, -148(%rbp)
+	movq %rax, %rcx
+	cmpl $2, -148(%rbp)
+	setle %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movw %dx, -6(%rbp)
+	movl $3, -12(%rbp)
+	movl $3, -16(%rbp)
+	movabsq $325301422075, %rax
+	movq %rax, -24(%rbp)
+	movb $0, -25(%rbp)
+	movl $4, -32(%rbp)
+	movabsq $910075253307, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -32(%rbp)
+	imull $751, -32(%rbp), %eax
+	subl $751, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L30
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L33
+	.p2align 4,,10
+.L32:
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -128(%rbp)
+	jne .L32
+.L33:
+.L30:
+.L31:
+	cmpl $16, -32(%rbp)
+	jge .L35
+	.p2align 4,,10
+.L34:
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L34
+.L35:
+	cmpq $0, -24(%rbp)
+	je .LB3
+.L36:
+.L37:
+	movw $1, -6(%rbp)
+	xorl %eax, %eax
+	movsbl -25(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -132(%rbp)
+	movswl -6(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $8, %eax
+	jge .L39
+	.p2align 4,,10
+.L38:
+	movl $145, %eax
+	subl -136(%rbp), %eax
+	cmpl $1, %eax
+	jne .LB4
+.L40:
+.L41:
+	movl -136(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -6(%rbp)
+	movswl -6(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $8, %eax
+	jl .L38
+.L39:
+	movl -16(%rbp), %eax
+	subl $10, %eax
+	shrl $1, %eax
+	testl %eax, %eax
+	je .L42
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	shrq $3, %rax
+	movq %rax, %rcx
+	movswq -6(%rbp), %rax
+	addq %rcx, %rax
+	movw %ax, -6(%rbp)
+	movzwl -4(%rbp), %eax
+	movl %eax, -140(%rbp)
+	imull -140(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .LB5
+.L44:
+.L45:
+	cmpl $0, -12(%rbp)
+	jl .L46
+	cmpl $16, -12(%rbp)
+	jge .L46
+	movslq -12(%rbp), %rax
+	movl $5, -112(%rbp,%rax,4)
+.L46:
+.L47:
+.L42:
+.L43:
+	movq $0, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jae .L48
+	movl $100, %eax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L51
+	.p2align 4,,10
+.L50:
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -152(%rbp)
+	jne .L50
+.L51:
+.L48:
+.L49:
+	cmpq $100, -24(%rbp)
+	jae .L53
+	.p2align 4,,10
+.L52:
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jb .L52
+.L53:
+	movw $0, -6(%rbp)
+	movw $214, -4(%rbp)
+	movzwl -2(%rbp), %eax
+	addl $10, %eax
+	movw %ax, -2(%rbp)
+	cmpl $0, -12(%rbp)
+	jne .L54
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L55
+.LB4:
+	movl -132(%rbp), %eax
+.f0.constprop.3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L54:
+	movl $1, %eax
+.L55:
+	movslq %eax, %rax
+	cmpq $189, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl $372, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0.constprop.3_return
+.LB3:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movzbl %al, %eax
+	cqo
+	idivq %rcx
+	jmp .f0.constprop.3_return
+.LB5:
+	movl $1, %eax
+	jmp .f0.constprop.3_return
+	.size f0.constprop.3, .-f0.constprop.3
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movw %dx, -6(%rbp)
+	movw %cx, -8(%rbp)
+	movl $3, -12(%rbp)
+	movl $3, -16(%rbp)
+	movabsq $325301422075, %rax
+	movq %rax, -24(%rbp)
+	movb $0, -25(%rbp)
+	movl $4, -32(%rbp)
+	movabsq $910075253307, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -32(%rbp)
+	imull $751, -32(%rbp), %eax
+	subl $751, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L56
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L59
+	.p2align 4,,10
+.L58:
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -128(%rbp)
+	jne .L58
+.L59:
+.L56:
+.L57:
+	cmpl $16, -32(%rbp)
+	jge .L61
+	.p2align 4,,10
+.L60:
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L60
+.L61:
+	cmpq $0, -24(%rbp)
+	je .LB6
+.L62:
+.L63:
+	movw $1, -8(%rbp)
+	xorl %eax, %eax
+	movsbl -25(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -132(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $8, %eax
+	jge .L65
+	.p2align 4,,10
+.L64:
+	movl $6, %eax
+	subl -136(%rbp), %eax
+	cmpl $1, %eax
+	jne .LB7
+.L66:
+.L67:
+	movl -136(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -8(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $8, %eax
+	jl .L64
+.L65:
+	movl -16(%rbp), %eax
+	subl $10, %eax
+	shrl $1, %eax
+	testl %eax, %eax
+	je .L68
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	shrq $3, %rax
+	movq %rax, %rcx
+	movswq -8(%rbp), %rax
+	addq %rcx, %rax
+	movw %ax, -8(%rbp)
+	movzwl -6(%rbp), %eax
+	movl %eax, -140(%rbp)
+	imull -140(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .LB8
+.L70:
+.L71:
+	cmpl $0, -12(%rbp)
+	jl .L72
+	cmpl $16, -12(%rbp)
+	jge .L72
+	movslq -12(%rbp), %rax
+	movl $5, -112(%rbp,%rax,4)
+.L72:
+.L73:
+.L68:
+.L69:
+	movq $0, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jae .L74
+	movl $100, %eax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L77
+	.p2align 4,,10
+.L76:
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -152(%rbp)
+	jne .L76
+.L77:
+.L74:
+.L75:
+	cmpq $100, -24(%rbp)
+	jae .L79
+	.p2align 4,,10
+.L78:
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jb .L78
+.L79:
+	movw $0, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movw %ax, -6(%rbp)
+	movzwl -4(%rbp), %eax
+	addl $10, %eax
+	movw %ax, -4(%rbp)
+	cmpl $0, -12(%rbp)
+	jne .L80
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L81
+.LB7:
+	movl -132(%rbp), %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L80:
+	movl $1, %eax
+.L81:
+	movslq %eax, %rax
+	cmpq $189, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl $372, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.LB6:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movzbl %al, %eax
+	cqo
+	idivq %rcx
+	jmp .f0.constprop.0_return
+.LB8:
+	movl $1, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movw %dx, -6(%rbp)
+	movw %cx, -8(%rbp)
+	movl $3, -12(%rbp)
+	movl $3, -16(%rbp)
+	movabsq $325301422075, %rax
+	movq %rax, -24(%rbp)
+	movb $0, -25(%rbp)
+	movl $4, -32(%rbp)
+	movabsq $910075253307, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -32(%rbp)
+	imull $751, -32(%rbp), %eax
+	subl $751, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L82
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L85
+	.p2align 4,,10
+.L84:
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -128(%rbp)
+	jne .L84
+.L85:
+.L82:
+.L83:
+	cmpl $16, -32(%rbp)
+	jge .L87
+	.p2align 4,,10
+.L86:
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L86
+.L87:
+	cmpq $0, -24(%rbp)
+	je .LB9
+.L88:
+.L89:
+	movw $1, -8(%rbp)
+	xorl %eax, %eax
+	movsbl -25(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -132(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $8, %eax
+	jge .L91
+	.p2align 4,,10
+.L90:
+	xorl %eax, %eax
+	subl -136(%rbp), %eax
+	cmpl $1, %eax
+	jne .LB10
+.L92:
+.L93:
+	movl -136(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -8(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $8, %eax
+	jl .L90
+.L91:
+	movl -16(%rbp), %eax
+	subl $10, %eax
+	shrl $1, %eax
+	testl %eax, %eax
+	je .L94
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	shrq $3, %rax
+	movq %rax, %rcx
+	movswq -8(%rbp), %rax
+	addq %rcx, %rax
+	movw %ax, -8(%rbp)
+	movzwl -6(%rbp), %eax
+	movl %eax, -140(%rbp)
+	imull -140(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .LB11
+.L96:
+.L97:
+	cmpl $0, -12(%rbp)
+	jl .L98
+	cmpl $16, -12(%rbp)
+	jge .L98
+	movslq -12(%rbp), %rax
+	movl $5, -112(%rbp,%rax,4)
+.L98:
+.L99:
+.L94:
+.L95:
+	movq $0, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jae .L100
+	movl $100, %eax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L103
+	.p2align 4,,10
+.L102:
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -152(%rbp)
+	jne .L102
+.L103:
+.L100:
+.L101:
+	cmpq $100, -24(%rbp)
+	jae .L105
+	.p2align 4,,10
+.L104:
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jb .L104
+.L105:
+	movw $0, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movw %ax, -6(%rbp)
+	movzwl -4(%rbp), %eax
+	addl $10, %eax
+	movw %ax, -4(%rbp)
+	cmpl $0, -12(%rbp)
+	jne .L106
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.LB10:
+	movl -132(%rbp), %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L106:
+	movl $1, %eax
+.L107:
+	movslq %eax, %rax
+	cmpq $189, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl $372, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0.constprop.1_return
+.LB9:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movzbl %al, %eax
+	cqo
+	idivq %rcx
+	jmp .f0.constprop.1_return
+.LB11:
+	movl $1, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movw %dx, -6(%rbp)
+	movw %cx, -8(%rbp)
+	movl $3, -12(%rbp)
+	movl $3, -16(%rbp)
+	movabsq $325301422075, %rax
+	movq %rax, -24(%rbp)
+	movb $0, -25(%rbp)
+	movl $4, -32(%rbp)
+	movabsq $910075253307, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -32(%rbp)
+	imull $751, -32(%rbp), %eax
+	subl $751, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L108
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L111
+	.p2align 4,,10
+.L110:
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -128(%rbp)
+	jne .L110
+.L111:
+.L108:
+.L109:
+	cmpl $16, -32(%rbp)
+	jge .L113
+	.p2align 4,,10
+.L112:
+	addl $751, -116(%rbp)
+	movslq -32(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L112
+.L113:
+	cmpq $0, -24(%rbp)
+	je .LB12
+.L114:
+.L115:
+	movw $1, -8(%rbp)
+	xorl %eax, %eax
+	movsbl -25(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -132(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $8, %eax
+	jge .L117
+	.p2align 4,,10
+.L116:
+	movl $1, %eax
+	subl -136(%rbp), %eax
+	cmpl $1, %eax
+	jne .LB13
+.L118:
+.L119:
+	movl -136(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -8(%rbp)
+	movswl -8(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $8, %eax
+	jl .L116
+.L117:
+	movl -16(%rbp), %eax
+	subl $10, %eax
+	shrl $1, %eax
+	testl %eax, %eax
+	je .L120
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	shrq $3, %rax
+	movq %rax, %rcx
+	movswq -8(%rbp), %rax
+	addq %rcx, %rax
+	movw %ax, -8(%rbp)
+	movzwl -6(%rbp), %eax
+	movl %eax, -140(%rbp)
+	imull -140(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .LB14
+.L122:
+.L123:
+	cmpl $0, -12(%rbp)
+	jl .L124
+	cmpl $16, -12(%rbp)
+	jge .L124
+	movslq -12(%rbp), %rax
+	movl $5, -112(%rbp,%rax,4)
+.L124:
+.L125:
+.L120:
+.L121:
+	movq $0, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jae .L126
+	movl $100, %eax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L129
+	.p2align 4,,10
+.L128:
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -152(%rbp)
+	jne .L128
+.L129:
+.L126:
+.L127:
+	cmpq $100, -24(%rbp)
+	jae .L131
+	.p2align 4,,10
+.L130:
+	cmpl $1, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jb .L130
+.L131:
+	movw $0, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movw %ax, -6(%rbp)
+	movzwl -4(%rbp), %eax
+	addl $10, %eax
+	movw %ax, -4(%rbp)
+	cmpl $0, -12(%rbp)
+	jne .L132
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L133
+.LB13:
+	movl -132(%rbp), %eax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L132:
+	movl $1, %eax
+.L133:
+	movslq %eax, %rax
+	cmpq $189, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl $372, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0.constprop.2_return
+.LB12:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movzbl %al, %eax
+	cqo
+	idivq %rcx
+	jmp .f0.constprop.2_return
+.LB14:
+	movl $0, %eax
+	jmp .f0.constprop.2_return
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movw $2, -18(%rbp)
+	movl $1432847300, -24(%rbp)
+	movw $817, -26(%rbp)
+	movl $7, -32(%rbp)
+	movabsq $348698577445, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L134
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L137
+	.p2align 4,,10
+.L136:
+	movslq -32(%rbp), %rax
+	imulq $132, %rax, %rax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	imulq $132, %rax, %rax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	imulq $132, %rax, %rax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	imulq $132, %rax, %rax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -184(%rbp)
+	jne .L136
+.L137:
+.L134:
+.L135:
+	cmpl $33, -32(%rbp)
+	jge .L139
+	.p2align 4,,10
+.L138:
+	movslq -32(%rbp), %rax
+	imulq $132, %rax, %rax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L138
+.L139:
+	movl $0, -32(%rbp)
+	imull $264, -32(%rbp), %eax
+	subl $264, %eax
+	movl %eax, -260(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L140
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -272(%rbp)
+	cmpq $0, -272(%rbp)
+	je .L143
+	.p2align 4,,10
+.L142:
+	addl $264, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $264, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $264, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	addl $264, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -272(%rbp)
+	jne .L142
+.L143:
+.L140:
+.L141:
+	cmpl $16, -32(%rbp)
+	jge .L145
+	.p2align 4,,10
+.L144:
+	addl $264, -260(%rbp)
+	movslq -32(%rbp), %rax
+	movl -260(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L144
+.L145:
+	movl $0, -24(%rbp)
+	cmpl $255, -32(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -276(%rbp)
+	cmpl $5, -24(%rbp)
+	jge .L146
+	movl $5, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -288(%rbp)
+	cmpq $0, -288(%rbp)
+	je .L149
+	.p2align 4,,10
+.L148:
+	cmpq $7, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	addl -276(%rbp), %eax
+	movb %al, -1(%rbp)
+	movzwl -26(%rbp), %eax
+	movq %rax, -304(%rbp)
+	cmpq g1(%rip), %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movq g1(%rip), %rax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movw %ax, -290(%rbp)
+	movq %rax, %rdi
+	call f0.constprop.3
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movw %ax, -18(%rbp)
+	addl $1, -24(%rbp)
+	cmpq $7, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	addl -276(%rbp), %eax
+	movb %al, -1(%rbp)
+	movq -304(%rbp), %rax
+	cmpq g1(%rip), %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movq g1(%rip), %rax
+	movq %rax, %rsi
+	movzwl -290(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.3
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movw %ax, -18(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -288(%rbp)
+	jne .L148
+.L149:
+.L146:
+.L147:
+	cmpl $5, -24(%rbp)
+	jge .L151
+	.p2align 4,,10
+.L150:
+	cmpq $7, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	addl -276(%rbp), %eax
+	movb %al, -1(%rbp)
+	movzwl -26(%rbp), %eax
+	cmpq g1(%rip), %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movq g1(%rip), %rax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.3
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movw %ax, -18(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $5, -24(%rbp)
+	jl .L150
+.L151:
+	addl $67, -32(%rbp)
+	movl $-17774, %eax
+	movq %rax, %r8
+	movq g0(%rip), %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movswq %ax, %rax
+	movq %rax, -16(%rbp)
+	movl $6, %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	movabsq $49270845152, %rax
+	leaq 3(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $2, %rcx
+	movq %rcx, %rax
+	movq %rax, %rdx
+	movzwl -18(%rbp), %eax
+	imull $255, %eax, %eax
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f0
+	movswl %ax, %eax
+	movl %eax, -32(%rbp)
+	movl $2, %eax
+	testl %eax, %eax
+	jne .L152
+	movl $627, %eax
+	cmpl $8, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -18(%rbp), %eax
+	cmpl $29, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movzwl -18(%rbp), %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subl g2(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movswq %ax, %rax
+	movq %rax, -40(%rbp)
+	movl $128, %eax
+	movslq %eax, %rax
+	cmpq $56, %rax
+	jge .L161
+	cmpq $27, %rax
+	jge .L162
+	cmpq $-3, %rax
+	je .L154
+	cmpq $12, %rax
+	je .L159
+.L160:
+	movl $160, %eax
+	movq %rax, %r8
+	movl $51719, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movw %ax, -318(%rbp)
+	movq %rax, %rsi
+	movl $207, %eax
+	movq %rax, %rdi
+	call f0
+	movswq %ax, %rax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movslq %eax, %rax
+	subq $3, %rax
+	cmpq %rcx, %rax
+	je .L176
+	imull $659, -8(%rbp), %eax
+	pushq %rax
+	movzwl -318(%rbp), %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl $8, %eax
+	pushq %rax
+	movl $9, %eax
+	pushq %rax
+	movzwl -26(%rbp), %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $392, %eax
+	movq %rax, %rsi
+	movl -160(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f0
+	xorl %eax, %eax
+	movl -64(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl $264, %eax
+	movq %rax, %rdx
+	movq g1(%rip), %rax
+	movq %rax, %rsi
+	movl -148(%rbp), %eax
+	cmpl -24(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movb %al, -1(%rbp)
+	jmp .L177
+.L161:
+	cmpq $573, %rax
+	jge .L163
+	cmpq $56, %rax
+	je .L159
+	cmpq $289, %rax
+	je .L158
+	jmp .L160
+.L156:
+	movl $0, -8(%rbp)
+	cmpl $5, -8(%rbp)
+	jge .L165
+	.p2align 4,,10
+.L164:
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movzbl -1(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movl $992, %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L166
+.L165:
+.L154:
+	movw $3, -18(%rbp)
+.L152:
+.L153:
+	movzwl -26(%rbp), %eax
+	movw %ax, -26(%rbp)
+	movzwl -18(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	movabsq $493356815090, %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq g0(%rip), %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movl %eax, -24(%rbp)
+	movl $-86, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L166:
+.L167:
+	movslq -8(%rbp), %rax
+	movq %rax, -312(%rbp)
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq -16(%rbp), %rax
+	jge .L168
+	movq -312(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L168:
+.L169:
+	addl $1, -8(%rbp)
+	cmpl $5, -8(%rbp)
+	jl .L164
+	jmp .L165
+.L176:
+	movl -8(%rbp), %eax
+	movl %eax, -32(%rbp)
+	movl $9, %eax
+	imull $3, %eax, %eax
+	movl %eax, -196(%rbp)
+.L177:
+	movl $10, %eax
+	pushq %rax
+	subq $8, %rsp
+	xorl %eax, %eax
+	movq %rax, %r8
+	movzbl -1(%rbp), %eax
+	movq %rax, %rcx
+	movq g0(%rip), %rax
+	movq %rax, %rdx
+	movzwl -26(%rbp), %eax
+	movq %rax, %rsi
+	movl -196(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rdx
+	movl -176(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $773034552264, %rax
+	subq %rcx, %rax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	call f0.constprop.2
+	movswl %ax, %eax
+	movl %eax, -8(%rbp)
+	jmp .L154
+.L162:
+	cmpq $27, %rax
+	je .L160
+	cmpq $55, %rax
+	je .L154
+	jmp .L160
+.L163:
+	cmpq $573, %rax
+	je .L156
+	cmpq $815, %rax
+	je .L154
+	jmp .L160
+.L155:
+	jmp .L154
+.L159:
+	cmpq $0, -40(%rbp)
+	jne .L172
+	movzwl -18(%rbp), %eax
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L173
+.L172:
+	movl $0, %eax
+.L173:
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -1(%rbp)
+	movabsq $810142745480, %rax
+	leaq 3(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $2, %rcx
+	movq %rcx, %rax
+	cmpq %rax, -16(%rbp)
+	jg .L174
+	movl $99, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L175
+.L174:
+	movl $0, %eax
+.L175:
+	movb %al, -1(%rbp)
+	jmp .L154
+.L157:
+	jmp .L154
+.L158:
+	movzwl -26(%rbp), %eax
+	movl %eax, -316(%rbp)
+	testl %eax, %eax
+	jl .L154
+	cmpl $16, -316(%rbp)
+	jge .L154
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	xorl %eax, %eax
+	movabsq $1030404858727, %rcx
+	subq %rcx, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movzwl -26(%rbp), %eax
+	movl %ecx, -256(%rbp,%rax,4)
+.L170:
+.L171:
+	jmp .L154
+	.size f1, .-f1
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rdi, -16(%rbp)
+	movq %rsi, -8(%rbp)
+.rec_entry:
+	cmpq $4, -16(%rbp)
+	jl .L180
+	cmpq $18, -16(%rbp)
+	jg .L180
+.L178:
+.L179:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -16(%rbp)
+	popq %rax
+	movq %rax, -8(%rbp)
+	jmp .rec_entry
+.L180:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movl %edi, -48(%rbp)
+	movw %si, -50(%rbp)
+	movl %edx, -44(%rbp)
+	movl %ecx, -40(%rbp)
+	movq %r8, -16(%rbp)
+	movb $255, -54(%rbp)
+	movb $3, -53(%rbp)
+	movb $7, -52(%rbp)
+	movb $8, -51(%rbp)
+	movl $-1722964103, -36(%rbp)
+	movl $7, -32(%rbp)
+	movl $2, -28(%rbp)
+	movq $6, -8(%rbp)
+	movl g2(%rip), %eax
+	imull g2(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpq $2147483647, -8(%rbp)
+	setge %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	addl %eax, -32(%rbp)
+	xorl %eax, %eax
+	je .L181
+	movsbl -51(%rbp), %eax
+	movl %eax, -24(%rbp)
+	addl $6, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl -28(%rbp), %eax
+	movq %rax, %rsi
+	imull $2147483647, -24(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testb %al, %al
+	je .L183
+	cmpl $8, -36(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movzbl -52(%rbp), %eax
+	movl %eax, -20(%rbp)
+	cmpl -40(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -20(%rbp), %eax
+	subl -44(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movq g1(%rip), %rax
+	movq %rax, -8(%rbp)
+	movq g1(%rip), %rax
+	imulq g1(%rip), %rax
+	addq $1, %rax
+	pushq %rax
+	cmpl $0, -48(%rbp)
+	jne .L191
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L192
+.L186:
+.L185:
+.L183:
+.L184:
+.L181:
+.L182:
+	movl -48(%rbp), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rdx
+	movl $433, %eax
+	cmpl $10, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movsbq -53(%rbp), %rax
+	movb %al, -20(%rbp)
+	movq %rax, %rdi
+	call f1
+	testb %al, %al
+	je .L196
+	movl $1, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L203
+	leaq .L204(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L198
+	# table target .L202
+	# table target .L200
+	# table target .L201
+	# table target .L199
+	jmp *%rcx
+.L203:
+.L198:
+	movl $216, %eax
+	imull $6, %eax, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	cmpq $817, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	cmpl $256, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	setle %al
+	movzbl %al, %eax
+.L196:
+.L197:
+	movq -8(%rbp), %rax
+	leave
+	ret
+.L191:
+	movl $1, %eax
+.L192:
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	cmpq $49, %rax
+	jge .L193
+	cmpq $-3, %rax
+	je .L186
+	cmpq $24, %rax
+	je .L187
+.L188:
+	movswq -50(%rbp), %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl $89, %eax
+	movq %rax, %rdi
+	call f1
+	movsbl %al, %eax
+	pushq %rax
+	movl -44(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %r8
+	movl $255, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl $19231, %eax
+	movq %rax, %rsi
+	movl $65535, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rdx
+	movl g2(%rip), %eax
+	subl -24(%rbp), %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f0
+	jmp .L185
+.L193:
+	cmpq $49, %rax
+	je .L189
+	cmpq $404, %rax
+	je .L185
+	jmp .L188
+.L189:
+	movl $3, %eax
+	pushq %rax
+	cmpl $0, g2(%rip)
+	je .L194
+	movl $630, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L195
+.L194:
+	movl $0, %eax
+.L195:
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	popq %rdx
+	call f1
+	jmp .L185
+.L187:
+	cmpl $0, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	addl %eax, -44(%rbp)
+	jmp .L185
+.L190:
+	jmp .L185
+.L199:
+	movl -32(%rbp), %eax
+	cmpl -32(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -52(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $-1, %rax
+	je .L206
+	cmpq $1, %rax
+	je .L208
+	cmpq $481, %rax
+	je .L209
+.L207:
+	movsbq -51(%rbp), %rax
+	pushq %rax
+	movl -48(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	xorl %eax, %eax
+	je .L210
+	movl $988, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L211
+.L206:
+	movq g1(%rip), %rax
+	movq g0(%rip), %rax
+	subq $8, %rax
+	movzbl -52(%rbp), %ecx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl g2(%rip), %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $131, %eax
+	movq %rax, %rdx
+	movl -48(%rbp), %eax
+	movq %rax, %rsi
+	movzbl -54(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+.L205:
+	movl g2(%rip), %eax
+	imull g2(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	jmp .L198
+.L210:
+	movl $0, %eax
+.L211:
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	call f1
+.L208:
+	movl $475, %eax
+	movq %rax, %r8
+	movl -28(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl $41, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	subq -8(%rbp), %rax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L205
+.L209:
+	movq g0(%rip), %rax
+	addq $260, %rax
+	pushq %rax
+	subq $8, %rsp
+	movq g1(%rip), %rax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	movq %rax, %rsi
+	movl -48(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movzbl -52(%rbp), %ecx
+	subq %rcx, %rax
+	pushq %rax
+	movl g2(%rip), %eax
+	movq %rax, %rsi
+	movq g1(%rip), %rax
+	imulq g1(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbq -53(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f0
+	movq g1(%rip), %rax
+	subq $4, %rax
+	movslq -40(%rbp), %rcx
+	addq %rcx, %rax
+	jne .L212
+	movl $5, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	movq %rax, %rsi
+	movzbl -54(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L213
+.L212:
+	movl $1, %eax
+.L213:
+	jmp .L205
+.L200:
+	movl $857, %eax
+	testl %eax, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jne .L214
+	movl -28(%rbp), %eax
+	movsbl %al, %eax
+	movq %rax, %r8
+	movl -40(%rbp), %eax
+	movw %ax, -20(%rbp)
+	movq %rax, %rcx
+	movl $238, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	subl -36(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -20(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movzbl -54(%rbp), %eax
+	cmpl $222, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movzbl -52(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movq -8(%rbp), %rax
+	movq %rax, %r8
+	movl $409, %eax
+	movq %rax, %rcx
+	movl $212, %eax
+	movq %rax, %rdx
+	movl g2(%rip), %eax
+	movq %rax, %rsi
+	movswl -50(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L215
+.L214:
+	movl $6, %eax
+	movq %rax, %rcx
+	movl $364, %eax
+	movq %rax, %rdx
+	movl g2(%rip), %eax
+	movq %rax, %rsi
+	movzbl -52(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	pushq %rax
+	movl $5, %eax
+	addl $3, %eax
+	pushq %rax
+	movl $255, %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f1
+	movq %rax, %rdx
+	movsbl -53(%rbp), %eax
+	movw %ax, -20(%rbp)
+	movq %rax, %rsi
+	movzwl -20(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f0
+	movsbl -51(%rbp), %eax
+.L215:
+	movq g1(%rip), %rax
+	movq %rax, %rcx
+	movl $379, %eax
+	movq %rax, %rdx
+	movzbl -54(%rbp), %eax
+	movq %rax, %rsi
+	movl -48(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movswl %ax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -32(%rbp), %eax
+	movq %rax, %r8
+	movl $56885, %eax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	movq %rax, %rdx
+	movl $783, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L198
+.L201:
+	movzbl -20(%rbp), %eax
+	movl %eax, -40(%rbp)
+.L202:
+	movl $127, %eax
+	movq %rax, %r8
+	movl -48(%rbp), %eax
+	movw %ax, -20(%rbp)
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $7, %rcx
+	ja .L198
+	leaq .L223(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L218
+	# table target .L220
+	# table target .L219
+	# table target .L217
+	# table target .L221
+	jmp *%rcx
+.L222:
+.L218:
+.L221:
+.L216:
+	jmp .L198
+.L217:
+	movsbl -51(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	cmpl %eax, -48(%rbp)
+	setb %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -52(%rbp), %eax
+	addl %ecx, %eax
+	jmp .L198
+.L219:
+	movl -48(%rbp), %eax
+	subl $10, %eax
+	movq %rax, %r8
+	movl g2(%rip), %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movl -48(%rbp), %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f0
+	movslq -36(%rbp), %rax
+	cmpq %rax, -8(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movzwl -20(%rbp), %eax
+	movq %rax, %rcx
+	movl -48(%rbp), %eax
+	movq %rax, %rdx
+	cmpl $3, -28(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L198
+.L220:
+	jmp .L198
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L204:
+	.long .L202-.L204
+	.long .L198-.L204
+	.long .L200-.L204
+	.long .L198-.L204
+	.long .L198-.L204
+	.long .L201-.L204
+	.long .L199-.L204
+	.p2align 2
+.L223:
+	.long .L220-.L223
+	.long .L219-.L223
+	.long .L218-.L223
+	.long .L218-.L223
+	.long .L218-.L223
+	.long .L218-.L223
+	.long .L217-.L223
+	.long .L221-.L223
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $288, %rsp
+	movabsq $778158827136, %rax
+	movq %rax, -8(%rbp)
+	movl $531, -12(%rbp)
+	movl $372, -16(%rbp)
+	movq $6, -24(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -164(%rbp)
+	testl %eax, %eax
+	je .L224
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L227
+	.p2align 4,,10
+.L226:
+	movl -16(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	subq $1, -176(%rbp)
+	jne .L226
+.L227:
+.L224:
+.L225:
+	cmpl $33, -16(%rbp)
+	jge .L229
+	.p2align 4,,10
+.L228:
+	movl -16(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L228
+.L229:
+	movl $0, -16(%rbp)
+	movl $0, -192(%rbp)
+	movl $603, -188(%rbp)
+	movl $1206, -184(%rbp)
+	movl $1809, -180(%rbp)
+	movl $4, -16(%rbp)
+	movl g2(%rip), %eax
+	addl $10, %eax
+	jne .L230
+	xorl %eax, %eax
+	cmpq $3, -24(%rbp)
+	setle %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L231
+.L230:
+	movl $1, %eax
+.L231:
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+	movl -76(%rbp), %eax
+	addl $1, %eax
+	movl -136(%rbp), %ecx
+	addl %ecx, %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movq g1(%rip), %rax
+	movq %rax, %r8
+	movq g0(%rip), %rax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $39741, %eax
+	movq %rax, %rsi
+	movl -12(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L239
+	leaq .L240(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L238
+	# table target .L233
+	# table target .L235
+	# table target .L237
+	# table target .L234
+	# table target .L236
+	jmp *%rcx
+.L239:
+.L238:
+	movl -140(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L265
+	jmp .L264
+.L265:
+	movq g0(%rip), %rax
+	movb %al, -202(%rbp)
+	movl -16(%rbp), %eax
+	movb %al, -203(%rbp)
+	imulq $3, g1(%rip), %rax
+	movzbl -202(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, g1(%rip)
+.L266:
+.L264:
+.L232:
+	cmpq $0, -24(%rbp)
+	jl .L267
+	cmpq $33, -24(%rbp)
+	jge .L267
+	movl $9, %eax
+	movq %rax, %r8
+	movl -188(%rbp), %eax
+	movq %rax, %rcx
+	movl $188, %eax
+	movq %rax, %rdx
+	movl -192(%rbp), %eax
+	movq %rax, %rsi
+	movl g2(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+.L267:
+.L268:
+	cmpl $481, g2(%rip)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $54, %rax
+	jge .L277
+	cmpq $-5, %rax
+	je .L271
+	cmpq $-3, %rax
+	je .L269
+	cmpq $12, %rax
+	je .L275
+.L272:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	pushq %rax
+	movl g2(%rip), %eax
+	imull g2(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movq %rax, -24(%rbp)
+	movl -12(%rbp), %eax
+	imulq g0(%rip), %rax
+	cmpq $571, %rax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -12(%rbp)
+	jmp .L269
+.L277:
+	cmpq $88, %rax
+	jge .L278
+	cmpq $54, %rax
+	je .L273
+	cmpq $67, %rax
+	je .L269
+	jmp .L272
+.L278:
+	cmpq $88, %rax
+	je .L271
+	cmpq $521, %rax
+	je .L276
+	jmp .L272
+.L271:
+	movl $0, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jge .L280
+	.p2align 4,,10
+.L279:
+	movl -180(%rbp), %eax
+	addl $213, %eax
+	cmpq $4, g1(%rip)
+	setle %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L283
+	cmpq $1, %rax
+	je .L282
+.L283:
+.L281:
+	movq $0, -24(%rbp)
+	cmpl $6, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	subl $477, %eax
+	movl %eax, -208(%rbp)
+	cmpq $3, -24(%rbp)
+	jge .L285
+	.p2align 4,,10
+.L284:
+	movl $65536, %eax
+	movq %rax, %rdx
+	movl $494, %eax
+	movq %rax, %rsi
+	movl -12(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testb %al, %al
+	je .L286
+.L285:
+	cmpq $0, g0(%rip)
+	je .L292
+	jmp .L293
+.L292:
+	movq g1(%rip), %rax
+	addq $631, %rax
+	subq $10, %rax
+	movl %eax, %eax
+	movq %rax, g0(%rip)
+	movl -120(%rbp), %eax
+	movl -180(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movq %rax, %rcx
+	cmpl $5, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq g1(%rip), %rax
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movl %eax, -12(%rbp)
+	movl $4294967295, %eax
+	addq %rax, -24(%rbp)
+.L293:
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L279
+.L280:
+.L276:
+.L269:
+	movl -12(%rbp), %eax
+	movq %rax, -264(%rbp)
+	movq %rax, %r8
+	movl -12(%rbp), %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl -192(%rbp), %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f2
+	pushq %rax
+	subq $8, %rsp
+	movl $22074, %eax
+	movq %rax, %r8
+	movl $127, %eax
+	movq %rax, %rcx
+	movq g1(%rip), %rax
+	movq %rax, %rdx
+	movl -184(%rbp), %eax
+	movq %rax, %rsi
+	movl $798, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	movq $0, -272(%rbp)
+	imulq $31, -272(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -272(%rbp)
+	imulq $31, -272(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -272(%rbp)
+	imulq $31, -272(%rbp), %rax
+	movslq g2(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	imulq $31, -272(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -272(%rbp)
+	imulq $31, -272(%rbp), %rax
+	addq -264(%rbp), %rax
+	movq %rax, -272(%rbp)
+	imulq $31, -272(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	imulq $31, -272(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -272(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L319
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L322
+	.p2align 4,,10
+.L321:
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -280(%rbp)
+	jne .L321
+.L322:
+.L319:
+.L320:
+	cmpl $33, -16(%rbp)
+	jge .L324
+	.p2align 4,,10
+.L323:
+	movslq -16(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L323
+.L324:
+	movl $0, -16(%rbp)
+	movl -192(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	movl -188(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	movl -184(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	movl -180(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -272(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	movl $4, -16(%rbp)
+	movq -272(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -272(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -272(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -272(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -272(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -272(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -272(%rbp)
+	movq -272(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L286:
+.L287:
+	movl g2(%rip), %eax
+	movq %rax, %r8
+	movq g1(%rip), %rax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movl $50, %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L288
+	jmp .L285
+.L288:
+.L289:
+	cmpl $0, -208(%rbp)
+	je .L290
+	jmp .L285
+.L290:
+.L291:
+	addq $1, -24(%rbp)
+	cmpq $3, -24(%rbp)
+	jl .L284
+	jmp .L285
+.L282:
+	movl $3, -96(%rbp)
+	jmp .L281
+.L270:
+	jmp .L269
+.L273:
+	cmpq $0, -8(%rbp)
+	je .L269
+	movq g1(%rip), %rax
+	cmpq $7, %rax
+	je .L269
+.L296:
+.L294:
+.L295:
+	jmp .L269
+.L274:
+	jmp .L269
+.L275:
+	cmpl $0, -12(%rbp)
+	jne .L301
+	movl -116(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L302
+.L301:
+	movl $0, %eax
+.L302:
+	movslq %eax, %rax
+	cmpq $31, %rax
+	je .L300
+.L299:
+	movq g0(%rip), %rax
+	movb %al, -209(%rbp)
+	imulq $3, g1(%rip), %rax
+	movzbl -209(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, g1(%rip)
+.L303:
+.L298:
+	cmpq $0, g1(%rip)
+	je .L306
+	cmpq $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L307
+.L306:
+	movl $0, %eax
+.L307:
+	movslq %eax, %rax
+	movq %rax, -224(%rbp)
+	cmpq $4, -224(%rbp)
+	jl .L310
+	cmpq $18, -224(%rbp)
+	jle .L308
+.L310:
+	movq -224(%rbp), %rax
+	addq $788, %rax
+.L305:
+	movq %rax, -8(%rbp)
+	jmp .L269
+.L297:
+	jmp .L269
+.L300:
+	movq -24(%rbp), %rax
+	movb %al, -210(%rbp)
+	imulq $3, g1(%rip), %rax
+	movzbl -210(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, g1(%rip)
+.L304:
+	jmp .L298
+.L308:
+.L309:
+	movq -224(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -232(%rbp)
+	movq -224(%rbp), %rax
+	addq $2364, %rax
+	movq %rax, -240(%rbp)
+	cmpq $4, -232(%rbp)
+	jl .L314
+	cmpq $18, -232(%rbp)
+	jle .L312
+.L314:
+	movq -240(%rbp), %rax
+	addq -232(%rbp), %rax
+.L311:
+	jmp .L305
+.L312:
+.L313:
+	movq -232(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -248(%rbp)
+	imulq $3, -240(%rbp), %rax
+	addq -232(%rbp), %rax
+	movq %rax, -256(%rbp)
+	cmpq $4, -248(%rbp)
+	jl .L318
+	cmpq $18, -248(%rbp)
+	jle .L316
+.L318:
+	movq -256(%rbp), %rax
+	addq -248(%rbp), %rax
+.L315:
+	jmp .L305
+.L316:
+.L317:
+	imulq $3, -256(%rbp), %rax
+	addq -248(%rbp), %rax
+	movq %rax, %rsi
+	movq -248(%rbp), %rax
+	subq $2, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L305
+.L233:
+	movl $10, %eax
+	movq %rax, %rdx
+	movl -12(%rbp), %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movsbq %al, %rax
+	imulq g1(%rip), %rax
+	testq %rax, %rax
+	jne .L243
+	movl $65536, %eax
+	testl %eax, %eax
+	je .L241
+.L243:
+	movq g1(%rip), %rax
+	addq $10, %rax
+	movl %eax, %eax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	subq $64, %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+	movl g2(%rip), %eax
+	movb %al, -193(%rbp)
+	movl -12(%rbp), %eax
+	movb %al, -194(%rbp)
+	imulq $3, g1(%rip), %rax
+	movzbl -193(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, g1(%rip)
+.L244:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $977, %eax
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl -40(%rbp), %eax
+	pushq %rax
+	movl -32(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f0
+	movswq %ax, %rax
+	movq %rax, g1(%rip)
+	movl $1, -140(%rbp)
+.L242:
+.L234:
+	movl $3, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L255
+	leaq .L256(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L247
+	# table target .L252
+	# table target .L253
+	# table target .L248
+	# table target .L250
+	# table target .L251
+	# table target .L254
+	# table target .L249
+	jmp *%rcx
+.L255:
+.L247:
+	movl $8, %eax
+	pushq %rax
+	movabsq $273429693032, %rax
+	cmpq %rax, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movl $163, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl -12(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f2
+	jmp .L232
+.L241:
+	movl $731, %eax
+	subq -8(%rbp), %rax
+	movq %rax, %rcx
+	movq g0(%rip), %rax
+	addq $9, %rax
+	subq %rcx, %rax
+	jne .LB15
+.L245:
+.L246:
+	movl -12(%rbp), %eax
+	addq g0(%rip), %rax
+	movl %eax, -180(%rbp)
+	jmp .L242
+.L248:
+	jmp .L247
+.L249:
+	jmp .L247
+.L250:
+	cmpq $0, g0(%rip)
+	jne .LB16
+.L257:
+.L258:
+	jmp .L247
+.L251:
+	jmp .L247
+.L252:
+	movslq -16(%rbp), %rax
+	cmpq %rax, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	cmpl $521, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+	jmp .L247
+.L253:
+	movl $0, -12(%rbp)
+	movl $8, -200(%rbp)
+	cmpl $3, -12(%rbp)
+	jae .L247
+	.p2align 4,,10
+.L259:
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movslq -200(%rbp), %rax
+	cmpq %rcx, %rax
+	jae .L261
+.L260:
+	jmp .L247
+.L261:
+.L262:
+	addl $1, -12(%rbp)
+	cmpl $3, -12(%rbp)
+	jb .L259
+	jmp .L247
+.L254:
+	movl -156(%rbp), %eax
+	movl %eax, -16(%rbp)
+	jmp .L247
+.L235:
+	jmp .L232
+.L236:
+	movq g1(%rip), %rax
+	movb %al, -201(%rbp)
+	imulq $3, g1(%rip), %rax
+	movzbl -201(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, g1(%rip)
+.L263:
+.L237:
+	jmp .L232
+.LB15:
+	movl $3, %eax
+	jmp .main_return
+.LB16:
+	movq g0(%rip), %rax
+	subq $3, %rax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L240:
+	.long .L233-.L240
+	.long .L238-.L240
+	.long .L235-.L240
+	.long .L238-.L240
+	.long .L237-.L240
+	.long .L238-.L240
+	.long .L238-.L240
+	.long .L238-.L240
+	.long .L234-.L240
+	.long .L236-.L240
+	.p2align 2
+.L256:
+	.long .L252-.L256
+	.long .L253-.L256
+	.long .L248-.L256
+	.long .L250-.L256
+	.long .L251-.L256
+	.long .L254-.L256
+	.long .L249-.L256
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
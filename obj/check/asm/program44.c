@@ -0,0 +1,78 @@
+int f0(unsigned int p0, unsigned int p1, long p2, int p3, char p4, long p5, unsigned int p6, unsigned long p7) {
+    short v0 = 193;
+    unsigned short v1 = 10;
+    unsigned long v2 = 0l;
+    int v3 = 6;
+    unsigned short v4 = 7;
+    unsigned short v5 = 596;
+    int i0 = 9;
+    long j0 = 444241873880L;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 547; }
+    if (((la1[2] + 182ul) + (short)(10))) { return (long)(la1[3]); }
+    p2 = 4;
+    p4 = p4 + (unsigned char)((9 * v0));
+    return (v1 / (v2 * v2 + 1));
+}
+unsigned int rec(unsigned int n, unsigned int acc) {
+    if (n < 3 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 3, acc);
+}
+int main() {
+    short v0 = 1;
+    char v1 = 967;
+    short v2 = 128;
+    short v3 = 439;
+    int i0 = 6;
+    long j0 = 380569220615;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 9; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 7; }
+    if ((((j0 - j0) < (i0 >= i0)) + (v2 / 7))) {
+        j0 = 0;
+        while (j0 < 100) {
+            switch ((i0 / (v0 * v0 + 1))) {
+            case 3:
+                break;
+            case 9:
+            default:
+                v3 = (unsigned char)((v0 >= f0(i0, 12, v0, la0[7], la0[2], la0[7], i0, 682011048950)));
+            case 0:
+                i0 = (((814l - v1) - !(v3)) != (v0 > f0(v1, 2, 975489059398, 0, v0, 65536, v1, v2)));
+                v3 = -((8 * v0));
+                break;
+            case 6:
+                if (f0(j0, la1[4], la1[5], 65536, la0[3], 5, 736, 3)) { break; }
+                break;
+            }
+            j0 = j0 + 1;
+        }
+    } else {
+        la1[3] = ((v1 / (j0 * j0 + 1)) <= 412028799912);
+        rec(4, (unsigned int)(86));
+        j0 = (unsigned char)((i0 && !(v1)));
+    }
+    f0((long)(v1), (unsigned long)(v2), (v2 <= 424837826104), -(257), 255, (561 / (v0 * v0 + 1)), (la0[3] / 7), (unsigned char)(445U));
+    if ((la0[4] + ((v1 - la1[6]) == 4))) {
+        if ((rec(5, v3) < ((v0 - 1) <= 1))) {
+            v0 = 8;
+            j0 = j0 + rec(i0, 5);
+        }
+    }
+    v2 = v2 + (f0(v0, j0, v3, v2, 3, v1, 2147483647, v1) + (216 + 481));
+    if (v1 >= 0 && v1 < 8) { la0[v1] = (v3 - f0(la1[2], 7, 0, v1, 3, v0, v2, la0[7])); }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2029 @@
+	.section .text
+	.type f0, @function
+	.type rec, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type rec.constprop.4, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movb %r8b, -21(%rbp)
+	movq %r9, -32(%rbp)
+	movw $193, -34(%rbp)
+	movw $10, -36(%rbp)
+	movq $0, -48(%rbp)
+	movl $6, -52(%rbp)
+	movw $7, -54(%rbp)
+	movw $596, -56(%rbp)
+	movl $9, -60(%rbp)
+	movabsq $444241873880, %rax
+	movq %rax, -72(%rbp)
+	movl $0, -60(%rbp)
+	imull $10, -60(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -212(%rbp)
+	cmpl $33, -60(%rbp)
+	jge .L0
+	movl $33, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -224(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	subq $1, -224(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -60(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	cmpl $33, -60(%rbp)
+	jl .L4
+.L5:
+	movl $0, -60(%rbp)
+	movl $0, -256(%rbp)
+	movl $547, -252(%rbp)
+	movl $1094, -248(%rbp)
+	movl $1641, -244(%rbp)
+	movl $2188, -240(%rbp)
+	movl $2735, -236(%rbp)
+	movl $3282, -232(%rbp)
+	movl $3829, -228(%rbp)
+	movl $8, -60(%rbp)
+	movl -248(%rbp), %eax
+	movslq %eax, %rax
+	addq $182, %rax
+	addq $10, %rax
+	je .L6
+	movl -244(%rbp), %eax
+	movslq %eax, %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L6:
+.L7:
+	movq $4, -16(%rbp)
+	movswl -34(%rbp), %eax
+	imull $9, %eax, %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -21(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -21(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl -36(%rbp), %eax
+	xorl %edx, %edx
+	divq %rcx
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+rec:
+	cmpl $3, %edi
+	jb .L10
+	cmpl $18, %edi
+	ja .L10
+.L8:
+.L9:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movl %edi, -32(%rbp)
+	movl %esi, -28(%rbp)
+	movl %edi, %eax
+	subl $3, %eax
+	movl %eax, -24(%rbp)
+	movl %esi, %eax
+	movl %eax, -20(%rbp)
+	cmpl $3, -24(%rbp)
+	jb .L14
+	cmpl $18, -24(%rbp)
+	jbe .L12
+.L14:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L11:
+	pushq %rax
+	movl -32(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -24(%rbp)
+	movl -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -20(%rbp)
+	cmpl $3, -24(%rbp)
+	jb .L42
+	cmpl $18, -24(%rbp)
+	jbe .L40
+.L42:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L39:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L12:
+.L13:
+	movl -24(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $3, -16(%rbp)
+	jb .L18
+	cmpl $18, -16(%rbp)
+	jbe .L16
+.L18:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L15:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $3, -16(%rbp)
+	jb .L30
+	cmpl $18, -16(%rbp)
+	jbe .L28
+.L30:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L27:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L11
+.L40:
+.L41:
+	movl -24(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $3, -16(%rbp)
+	jb .L46
+	cmpl $18, -16(%rbp)
+	jbe .L44
+.L46:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L43:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $3, -16(%rbp)
+	jb .L58
+	cmpl $18, -16(%rbp)
+	jbe .L56
+.L58:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L55:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L39
+.L16:
+.L17:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L22
+	cmpl $18, -8(%rbp)
+	jbe .L20
+.L22:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L19:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L26
+	cmpl $18, -8(%rbp)
+	jbe .L24
+.L26:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L23:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L15
+.L28:
+.L29:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L34
+	cmpl $18, -8(%rbp)
+	jbe .L32
+.L34:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L31:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L38
+	cmpl $18, -8(%rbp)
+	jbe .L36
+.L38:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L35:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L27
+.L44:
+.L45:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L50
+	cmpl $18, -8(%rbp)
+	jbe .L48
+.L50:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L47:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L54
+	cmpl $18, -8(%rbp)
+	jbe .L52
+.L54:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L51:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L43
+.L56:
+.L57:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L62
+	cmpl $18, -8(%rbp)
+	jbe .L60
+.L62:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L59:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L66
+	cmpl $18, -8(%rbp)
+	jbe .L64
+.L66:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L63:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L55
+.L20:
+.L21:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L19
+.L24:
+.L25:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L23
+.L32:
+.L33:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L31
+.L36:
+.L37:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L35
+.L48:
+.L49:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L47
+.L52:
+.L53:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L51
+.L60:
+.L61:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L59
+.L64:
+.L65:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L63
+.L10:
+	movl %esi, %eax
+	addl %edi, %eax
+	ret
+	.size rec, .-rec
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movl %edi, -4(%rbp)
+	movq %rsi, -16(%rbp)
+	movl %edx, -20(%rbp)
+	movb %cl, -21(%rbp)
+	movq %r8, -32(%rbp)
+	movl %r9d, -36(%rbp)
+	movw $193, -38(%rbp)
+	movw $10, -40(%rbp)
+	movq $0, -48(%rbp)
+	movl $6, -52(%rbp)
+	movw $7, -54(%rbp)
+	movw $596, -56(%rbp)
+	movl $9, -60(%rbp)
+	movabsq $444241873880, %rax
+	movq %rax, -72(%rbp)
+	movl $0, -60(%rbp)
+	imull $10, -60(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -212(%rbp)
+	cmpl $33, -60(%rbp)
+	jge .L67
+	movl $33, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -224(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L70
+	.p2align 4,,10
+.L69:
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	subq $1, -224(%rbp)
+	jne .L69
+.L70:
+.L67:
+.L68:
+	cmpl $33, -60(%rbp)
+	jge .L72
+	.p2align 4,,10
+.L71:
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	cmpl $33, -60(%rbp)
+	jl .L71
+.L72:
+	movl $0, -60(%rbp)
+	movl $0, -256(%rbp)
+	movl $547, -252(%rbp)
+	movl $1094, -248(%rbp)
+	movl $1641, -244(%rbp)
+	movl $2188, -240(%rbp)
+	movl $2735, -236(%rbp)
+	movl $3282, -232(%rbp)
+	movl $3829, -228(%rbp)
+	movl $8, -60(%rbp)
+	movl -248(%rbp), %eax
+	movslq %eax, %rax
+	addq $182, %rax
+	addq $10, %rax
+	je .L73
+	movl -244(%rbp), %eax
+	movslq %eax, %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L73:
+.L74:
+	movq $4, -16(%rbp)
+	movswl -38(%rbp), %eax
+	imull $9, %eax, %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -21(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -21(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl -40(%rbp), %eax
+	xorl %edx, %edx
+	divq %rcx
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movl %edi, -4(%rbp)
+	movq %rsi, -16(%rbp)
+	movb %dl, -17(%rbp)
+	movl %ecx, -24(%rbp)
+	movq %r8, -32(%rbp)
+	movw $193, -34(%rbp)
+	movw $10, -36(%rbp)
+	movq $0, -48(%rbp)
+	movl $6, -52(%rbp)
+	movw $7, -54(%rbp)
+	movw $596, -56(%rbp)
+	movl $9, -60(%rbp)
+	movabsq $444241873880, %rax
+	movq %rax, -72(%rbp)
+	movl $0, -60(%rbp)
+	imull $10, -60(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -212(%rbp)
+	cmpl $33, -60(%rbp)
+	jge .L75
+	movl $33, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -224(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L78
+	.p2align 4,,10
+.L77:
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	subq $1, -224(%rbp)
+	jne .L77
+.L78:
+.L75:
+.L76:
+	cmpl $33, -60(%rbp)
+	jge .L80
+	.p2align 4,,10
+.L79:
+	addl $10, -212(%rbp)
+	movslq -60(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	cmpl $33, -60(%rbp)
+	jl .L79
+.L80:
+	movl $0, -60(%rbp)
+	movl $0, -256(%rbp)
+	movl $547, -252(%rbp)
+	movl $1094, -248(%rbp)
+	movl $1641, -244(%rbp)
+	movl $2188, -240(%rbp)
+	movl $2735, -236(%rbp)
+	movl $3282, -232(%rbp)
+	movl $3829, -228(%rbp)
+	movl $8, -60(%rbp)
+	movl -248(%rbp), %eax
+	movslq %eax, %rax
+	addq $182, %rax
+	addq $10, %rax
+	je .L81
+	movl -244(%rbp), %eax
+	movslq %eax, %rax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L81:
+.L82:
+	movq $4, -16(%rbp)
+	movswl -34(%rbp), %eax
+	imull $9, %eax, %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -17(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -17(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl -36(%rbp), %eax
+	xorl %edx, %edx
+	divq %rcx
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+rec.constprop.4:
+	cmpl $3, %edi
+	jb .L85
+	cmpl $18, %edi
+	ja .L85
+.L83:
+.L84:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $3, %eax
+	movl %eax, -12(%rbp)
+	cmpl $3, -12(%rbp)
+	jb .L89
+	cmpl $18, -12(%rbp)
+	jbe .L87
+.L89:
+	movl -12(%rbp), %eax
+	addl $5, %eax
+.L86:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $3, -12(%rbp)
+	jb .L117
+	cmpl $18, -12(%rbp)
+	jbe .L115
+.L117:
+	movl -12(%rbp), %eax
+	addl $6, %eax
+.L114:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L87:
+.L88:
+	movl -12(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L93
+	cmpl $18, -8(%rbp)
+	jbe .L91
+.L93:
+	movl -8(%rbp), %eax
+	addl $5, %eax
+.L90:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L105
+	cmpl $18, -8(%rbp)
+	jbe .L103
+.L105:
+	movl -8(%rbp), %eax
+	addl $6, %eax
+.L102:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L86
+.L115:
+.L116:
+	movl -12(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L121
+	cmpl $18, -8(%rbp)
+	jbe .L119
+.L121:
+	movl -8(%rbp), %eax
+	addl $6, %eax
+.L118:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $3, -16(%rbp)
+	jb .L133
+	cmpl $18, -16(%rbp)
+	jbe .L131
+.L133:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L130:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L114
+.L91:
+.L92:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L97
+	cmpl $18, -4(%rbp)
+	jbe .L95
+.L97:
+	movl -4(%rbp), %eax
+	addl $5, %eax
+.L94:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L101
+	cmpl $18, -4(%rbp)
+	jbe .L99
+.L101:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L98:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L90
+.L103:
+.L104:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L109
+	cmpl $18, -4(%rbp)
+	jbe .L107
+.L109:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L106:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L113
+	cmpl $18, -8(%rbp)
+	jbe .L111
+.L113:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L110:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L102
+.L119:
+.L120:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L125
+	cmpl $18, -4(%rbp)
+	jbe .L123
+.L125:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L122:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L129
+	cmpl $18, -8(%rbp)
+	jbe .L127
+.L129:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L126:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L118
+.L131:
+.L132:
+	movl -16(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L137
+	cmpl $18, -8(%rbp)
+	jbe .L135
+.L137:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L134:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $3, -8(%rbp)
+	jb .L141
+	cmpl $18, -8(%rbp)
+	jbe .L139
+.L141:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L138:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L130
+.L95:
+.L96:
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L94
+.L99:
+.L100:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L98
+.L107:
+.L108:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L106
+.L111:
+.L112:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L110
+.L123:
+.L124:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L122
+.L127:
+.L128:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L126
+.L135:
+.L136:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L134
+.L139:
+.L140:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L138
+.L85:
+	movl %edi, %eax
+	addl $5, %eax
+	ret
+	.size rec.constprop.4, .-rec.constprop.4
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movw $1, -2(%rbp)
+	movb $-57, -3(%rbp)
+	movw $128, -6(%rbp)
+	movw $439, -8(%rbp)
+	movl $6, -12(%rbp)
+	movabsq $380569220615, %rax
+	movq %rax, -24(%rbp)
+	movl $0, -12(%rbp)
+	movl $0, -64(%rbp)
+	movl $9, -60(%rbp)
+	movl $18, -56(%rbp)
+	movl $27, -52(%rbp)
+	movl $36, -48(%rbp)
+	movl $45, -44(%rbp)
+	movl $54, -40(%rbp)
+	movl $63, -36(%rbp)
+	movl $8, -12(%rbp)
+	movl $0, -12(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $28, -80(%rbp)
+	movl $35, -76(%rbp)
+	movl $42, -72(%rbp)
+	movl $49, -68(%rbp)
+	movl $8, -12(%rbp)
+	movswl -6(%rbp), %eax
+	movl %eax, -100(%rbp)
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	cmpl -12(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	subq -24(%rbp), %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	je .L142
+	movq $0, -24(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -108(%rbp)
+	imull -108(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -104(%rbp)
+	movl $814, %eax
+	movsbq -3(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, -120(%rbp)
+	xorl %eax, %eax
+	imull $8, -108(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -124(%rbp)
+	cmpq $100, -24(%rbp)
+	jge .L143
+	.p2align 4,,10
+.L144:
+	movl -12(%rbp), %eax
+	cltd
+	idivl -104(%rbp)
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L151
+	leaq .L152(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L148
+	# table target .L149
+	# table target .L147
+	# table target .L150
+	# table target .L148
+	jmp *%rcx
+.L151:
+.L148:
+	movl -12(%rbp), %eax
+	movl %eax, -128(%rbp)
+	movq %rax, %r9
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl -56(%rbp), %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	movq %rax, %rdx
+	movswq -2(%rbp), %rax
+	movq %rax, %rsi
+	movl -128(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	cmpl %eax, -108(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movw %ax, -8(%rbp)
+.L149:
+	movswq -6(%rbp), %rax
+	movq %rax, %r8
+	movsbl -3(%rbp), %eax
+	movl %eax, -132(%rbp)
+	movq %rax, %rcx
+	movswl -2(%rbp), %eax
+	movq %rax, %rdx
+	movabsq $975489059398, %rax
+	movq %rax, %rsi
+	movl -132(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	cmpl %eax, -108(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpw $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	subq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+	movl -124(%rbp), %eax
+	movw %ax, -8(%rbp)
+.L146:
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jl .L144
+.L145:
+	jmp .L143
+.L142:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbq -3(%rbp), %rax
+	cqo
+	idivq %rcx
+	movabsq $412028799912, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -84(%rbp)
+	movl $87, %eax
+.L156:
+	pushq %rax
+	movl $0, -144(%rbp)
+	cmpl $3, -144(%rbp)
+	jb .L161
+	cmpl $18, -144(%rbp)
+	jbe .L159
+.L161:
+	movl -144(%rbp), %eax
+	addl $87, %eax
+.L158:
+	pushq %rax
+	movl $2, -136(%rbp)
+	movl $88, -140(%rbp)
+	cmpl $3, -136(%rbp)
+	jb .L165
+	cmpl $18, -136(%rbp)
+	jbe .L163
+.L165:
+	movl -140(%rbp), %eax
+	addl -136(%rbp), %eax
+.L162:
+	popq %rcx
+	addl %ecx, %eax
+.L157:
+	popq %rcx
+	addl %ecx, %eax
+.L155:
+	cmpl $0, -12(%rbp)
+	je .L166
+	cmpb $0, -3(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L167
+.L166:
+	movl $0, %eax
+.L167:
+	movzbl %al, %eax
+	movq %rax, -24(%rbp)
+.L143:
+	movl $189, %eax
+	pushq %rax
+	movl -52(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	movswl -2(%rbp), %eax
+	movl %eax, -156(%rbp)
+	imull -156(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $561, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movl $-1, %eax
+	pushq %rax
+	movl $-257, %eax
+	pushq %rax
+	movswq -6(%rbp), %rax
+	movabsq $424837826104, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movswq -6(%rbp), %rax
+	movq %rax, %rsi
+	movsbq -3(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movsbl -3(%rbp), %eax
+	movl %eax, -160(%rbp)
+	movl -72(%rbp), %ecx
+	subl %ecx, %eax
+	cmpl $4, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -48(%rbp), %eax
+	addl %ecx, %eax
+	je .L168
+	movl -156(%rbp), %eax
+	subl $1, %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movswl -8(%rbp), %eax
+	movl %eax, -164(%rbp)
+	movl -164(%rbp), %eax
+	movl %eax, -188(%rbp)
+	movl -188(%rbp), %eax
+	addl $2, %eax
+.L173:
+	pushq %rax
+	movl -164(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -168(%rbp)
+	movl $1, -180(%rbp)
+	movl -168(%rbp), %eax
+	movl %eax, -184(%rbp)
+	cmpl $3, -180(%rbp)
+	jb .L178
+	cmpl $18, -180(%rbp)
+	jbe .L176
+.L178:
+	movl -184(%rbp), %eax
+	addl -180(%rbp), %eax
+.L175:
+	pushq %rax
+	movl $3, -172(%rbp)
+	movl -168(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -176(%rbp)
+	cmpl $3, -172(%rbp)
+	jb .L182
+	cmpl $18, -172(%rbp)
+	jbe .L180
+.L182:
+	movl -176(%rbp), %eax
+	addl -172(%rbp), %eax
+.L179:
+	popq %rcx
+	addl %ecx, %eax
+.L174:
+	popq %rcx
+	addl %ecx, %eax
+.L172:
+	popq %rcx
+	cmpl %ecx, %eax
+	jae .L170
+	movw $8, -2(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -192(%rbp)
+	cmpl $3, -192(%rbp)
+	jb .L186
+	cmpl $18, -192(%rbp)
+	jbe .L184
+.L186:
+	movl -192(%rbp), %eax
+	addl $5, %eax
+.L183:
+	movl %eax, %eax
+	addq %rax, -24(%rbp)
+.L170:
+.L171:
+.L168:
+.L169:
+	movsbq -3(%rbp), %rax
+	pushq %rax
+	movl $2147483647, %eax
+	pushq %rax
+	movq -152(%rbp), %rax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl -100(%rbp), %eax
+	movq %rax, %rcx
+	movswq -8(%rbp), %rax
+	movq %rax, -232(%rbp)
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movswl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	addl $697, %eax
+	addl -100(%rbp), %eax
+	movw %ax, -6(%rbp)
+	cmpl $0, -160(%rbp)
+	jl .L211
+	cmpl $8, -160(%rbp)
+	jge .L211
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movswl -6(%rbp), %eax
+	pushq %rax
+	movswq -2(%rbp), %rax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl -160(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -88(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movswl -8(%rbp), %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+.L211:
+.L212:
+	movq $0, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -152(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movswq -6(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -232(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movslq -12(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -240(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -244(%rbp)
+	testl %eax, %eax
+	je .L213
+	movl $8, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L216
+	.p2align 4,,10
+.L215:
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -256(%rbp)
+	jne .L215
+.L216:
+.L213:
+.L214:
+	cmpl $8, -12(%rbp)
+	jge .L218
+	.p2align 4,,10
+.L217:
+	movslq -12(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jl .L217
+.L218:
+	movl $0, -12(%rbp)
+	cmpl $0, -244(%rbp)
+	je .L219
+	movl $8, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L222
+	.p2align 4,,10
+.L221:
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -264(%rbp)
+	jne .L221
+.L222:
+.L219:
+.L220:
+	cmpl $8, -12(%rbp)
+	jge .L224
+	.p2align 4,,10
+.L223:
+	movslq -12(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jl .L223
+.L224:
+	movq -240(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -240(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -240(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	movq -240(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L159:
+.L160:
+	subq $8, %rsp
+	movl $87, %eax
+	movq %rax, %rsi
+	movl -144(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $88, %eax
+	movq %rax, %rsi
+	movl -144(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L158
+.L163:
+.L164:
+	movl -140(%rbp), %eax
+	movq %rax, %rsi
+	movl -136(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -140(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -136(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L162
+.L176:
+.L177:
+	movl -184(%rbp), %eax
+	movq %rax, %rsi
+	movl -180(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -184(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -180(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L175
+.L180:
+.L181:
+	subq $8, %rsp
+	movl -176(%rbp), %eax
+	movq %rax, %rsi
+	movl -172(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -176(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -172(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L179
+.L184:
+.L185:
+	movl -192(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -212(%rbp)
+	cmpl $3, -212(%rbp)
+	jb .L190
+	cmpl $18, -212(%rbp)
+	jbe .L188
+.L190:
+	movl -212(%rbp), %eax
+	addl $5, %eax
+.L187:
+	pushq %rax
+	movl -192(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -196(%rbp)
+	cmpl $3, -196(%rbp)
+	jb .L202
+	cmpl $18, -196(%rbp)
+	jbe .L200
+.L202:
+	movl -196(%rbp), %eax
+	addl $6, %eax
+.L199:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L183
+.L188:
+.L189:
+	movl -212(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -220(%rbp)
+	cmpl $3, -220(%rbp)
+	jb .L194
+	cmpl $18, -220(%rbp)
+	jbe .L192
+.L194:
+	movl -220(%rbp), %eax
+	addl $5, %eax
+.L191:
+	pushq %rax
+	movl -212(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -216(%rbp)
+	cmpl $3, -216(%rbp)
+	jb .L198
+	cmpl $18, -216(%rbp)
+	jbe .L196
+.L198:
+	movl -216(%rbp), %eax
+	addl $6, %eax
+.L195:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L187
+.L200:
+.L201:
+	movl -196(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -208(%rbp)
+	cmpl $3, -208(%rbp)
+	jb .L206
+	cmpl $18, -208(%rbp)
+	jbe .L204
+.L206:
+	movl -208(%rbp), %eax
+	addl $6, %eax
+.L203:
+	pushq %rax
+	movl -196(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -200(%rbp)
+	movl $7, -204(%rbp)
+	cmpl $3, -200(%rbp)
+	jb .L210
+	cmpl $18, -200(%rbp)
+	jbe .L208
+.L210:
+	movl -204(%rbp), %eax
+	addl -200(%rbp), %eax
+.L207:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L199
+.L192:
+.L193:
+	movl -220(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -220(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L191
+.L196:
+.L197:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -216(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -216(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L195
+.L204:
+.L205:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -208(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -208(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L203
+.L208:
+.L209:
+	movl -204(%rbp), %eax
+	movq %rax, %rsi
+	movl -200(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -204(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -200(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L207
+.L147:
+	jmp .L146
+.L150:
+	movl $3, %eax
+	pushq %rax
+	movl $736, %eax
+	pushq %rax
+	movl $5, %eax
+	movq %rax, %r9
+	movl -52(%rbp), %eax
+	movq %rax, %r8
+	movl $65536, %eax
+	movq %rax, %rcx
+	movl -76(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl -80(%rbp), %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testl %eax, %eax
+	je .L146
+	jmp .L146
+.L153:
+.L154:
+	jmp .L146
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L152:
+	.long .L149-.L152
+	.long .L148-.L152
+	.long .L148-.L152
+	.long .L147-.L152
+	.long .L148-.L152
+	.long .L148-.L152
+	.long .L150-.L152
+	.long .L148-.L152
+	.long .L148-.L152
+	.long .L148-.L152
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,185 @@
+unsigned int g0 = 3l;
+int ga0[33];
+unsigned short f0(short p0, long p1, char p2, int p3, unsigned int p4, unsigned int p5) {
+    char v0 = 65535;
+    unsigned int v1 = 201;
+    short v2 = 434637296419;
+    unsigned long v3 = 1;
+    char v4 = 964;
+    unsigned int v5 = 2ul;
+    int i0 = 2;
+    long j0 = 222634111673;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 398L; }
+    switch (((g0 + 10) != 7)) {
+    default:
+        break;
+    case 2:
+        break;
+    }
+    for (j0 = 0; j0 < 17; j0 = j0 + 1) {
+        for (i0 = 0; i0 < 17; i0 = i0 + 1) {
+            v0 = ((360083010370 - 8432501264) / (p0 * p0 + 1));
+        }
+        if ((v4 && 93)) {
+            if ((v4 || p1)) {
+                p2 = p2 + 293;
+                if ((p1 <= 256)) { return ((p4 - 258747274164) == p0); }
+                if (!(p3)) { break; }
+            } else {
+                if (945) { break; }
+                la1[j0] = 2U;
+            }
+            p2 = 864;
+        }
+        p1 = 222;
+    }
+    if (((128 / (v2 * v2 + 1)) || -((478 - p1)))) {
+        p0 = -((6 - (50 / 100)));
+    } else {
+        for (p5 = 2; p5 < 16; p5 = p5 + 1) {
+            v1 = 0;
+            while (v1 < 17) {
+                la1[2] = (unsigned short)(903);
+                la0[19] = v2;
+                v1 = v1 + 1;
+            }
+            p3 = p3 + 256;
+        }
+        v2 = v2 + !((v4 >= 167));
+        v2 = (la0[4] / (p0 * p0 + 1));
+    }
+    if (v0 >= 0 && v0 < 33) { la1[v0] = ((v0 * 8) - (v3 > 3)); }
+    p5 = 9;
+    v5 = (i0 >= p2);
+    return !(p4);
+}
+unsigned short f1(char p0, short p1, char p2, unsigned int p3, unsigned int p4) {
+    long v0 = 2;
+    unsigned char v1 = 5;
+    int v2 = 7;
+    int i0 = 1;
+    long j0 = 940;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 8; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 8; }
+    f0(v1, v2, 65536, (376 && la0[14]), f0(la0[9], v0, 9, la1[0], 984238192432, 9), (g0 + 412));
+    switch ((la0[4] - (902 < la0[5]))) {
+    case 5:
+        break;
+    case 1:
+        if (!(v2)) {
+            p4 = 0;
+            while (p4 < 5) {
+                if (p3) { break; }
+                p4 = p4 + 1;
+            }
+            j0 = 128;
+            v2 = (497 == g0);
+        } else {
+            if (((0 == p3) == (unsigned long)(6))) { return (v2 < 6); }
+        }
+        f0((unsigned int)(8), f0(256, 385, v1, p4, g0, 606064429827), 256, (5 || v2), (i0 >= p4), (10 - 9));
+        break;
+    case 7:
+        for (v2 = 2; v2 < 4; v2 = v2 + 1) {
+            if (((int)(g0) == (la0[5] >= la1[3]))) {
+                p2 = ((-(v0) < (ga0[21] >= g0)) / (p2 * p2 + 1));
+            } else {
+                if ((v2 <= !(p3))) { break; }
+            }
+            j0 = 0;
+            while (j0 < 17) {
+                la1[1] = -((4 <= p1));
+                if ((unsigned char)(ga0[5])) { break; }
+                j0 = j0 + 1;
+            }
+            if ((la0[12] / 13ul)) {
+                if (((58 <= j0) + p0)) { break; }
+                v0 = (f0(65535, p1, 177, v2, ga0[13], j0) + (1034329430899 && (10 < 142115046132)));
+            }
+        }
+        v1 = -(p3);
+        break;
+    }
+    for (v0 = 0; v0 < 100; v0 = v0 + 1) {
+        p1 = (unsigned long)(6);
+    }
+    f0((5 - 8), 4, f0(i0, 65536, 210, g0, v0, la0[7]), !(9), 4, !(la0[14]));
+    la1[1] = ((760 && v2) < la1[2]);
+    return (-(!(p2)) / (j0 * j0 + 1));
+}
+unsigned long f2() {
+    unsigned short v0 = 4;
+    long v1 = 5l;
+    unsigned char v2 = 8;
+    char v3 = 518;
+    long v4 = 0;
+    int i0 = 39927009039;
+    long j0 = 128;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 228; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 469; }
+    if ((long)((203616209906u != g0))) { return ((8 > 11205355417) || g0); }
+    j0 = 0;
+    while (j0 < 3) {
+        v2 = f0(6, (g0 > v3), v2, (unsigned short)(2), (10 - 127), (v3 / 8));
+        v1 = f1((8 > 0), f1(j0, 147, v0, la0[20], la1[23]), la1[31], 9, j0);
+        v4 = (unsigned int)(v0);
+        j0 = j0 + 1;
+    }
+    i0 = 0;
+    while (i0 < 4) {
+        j0 = (f1(j0, 9, v1, 10, 4) / (v3 * v3 + 1));
+        i0 = i0 + 1;
+    }
+    for (i0 = 2; i0 < 33; i0 = i0 + 1) {
+        la0[14] = (8 - j0);
+    }
+    i0 = 127;
+    la0[17] = !(!(1u));
+    return v1;
+}
+unsigned long f3() {
+    long v0 = 0;
+    short v1 = 861751393253;
+    long v2 = 65535;
+    int i0 = 1;
+    long j0 = 665;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 1002542878696; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 4; }
+    la0[7] = ((3U - la1[10]) - (v1 > i0));
+    v0 = !((v0 == v2));
+    v0 = 8L;
+    return (((g0 + 5) + 7L) + (574 >= f0(v0, 6, j0, 3, v1, 4)));
+}
+int main() {
+    short v0 = 624;
+    short v1 = 437;
+    int i0 = 472l;
+    long j0 = 2;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 791; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 576; }
+    la1[4] = f0(v1, i0, g0, j0, g0, v0);
+    if (v1 >= 0 && v1 < 33) { ga0[v1] = j0; }
+    v0 = (9 && !(!(g0)));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
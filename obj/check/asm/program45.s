@@ -0,0 +1,803 @@
+	.section .data
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.long 3
+	.section .bss
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.section .text
+	.global main
+	.type main, @function
+	.type f0, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movw $624, -2(%rbp)
+	movw $437, -4(%rbp)
+	movl $472, -8(%rbp)
+	movq $2, -16(%rbp)
+	movl $0, -8(%rbp)
+	movl $0, -48(%rbp)
+	movl $791, -44(%rbp)
+	movl $1582, -40(%rbp)
+	movl $2373, -36(%rbp)
+	movl $3164, -32(%rbp)
+	movl $3955, -28(%rbp)
+	movl $4746, -24(%rbp)
+	movl $5537, -20(%rbp)
+	movl $8, -8(%rbp)
+	movl $0, -8(%rbp)
+	imull $576, -8(%rbp), %eax
+	subl $576, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	addl $576, -116(%rbp)
+	movslq -8(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	addl $576, -116(%rbp)
+	movslq -8(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	addl $576, -116(%rbp)
+	movslq -8(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	addl $576, -116(%rbp)
+	movslq -8(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -128(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -8(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $576, -116(%rbp)
+	movslq -8(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L4
+.L5:
+	movswl -2(%rbp), %eax
+	movq %rax, %r9
+	movl g0(%rip), %eax
+	movq %rax, %r8
+	movq -16(%rbp), %rax
+	movl %eax, -140(%rbp)
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	movq %rax, %rdx
+	movslq -8(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movq %rax, %rsi
+	movswl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movl %eax, -96(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -144(%rbp)
+	testl %eax, %eax
+	jl .L6
+	cmpl $33, -144(%rbp)
+	jge .L6
+	movswq -4(%rbp), %rax
+	movl -140(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L6:
+.L7:
+	cmpl $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	movq $0, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	movswq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	addq -136(%rbp), %rax
+	movq %rax, -152(%rbp)
+	imulq $31, -152(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movl $0, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jge .L8
+	movl $33, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L9
+	.p2align 4,,10
+.L10:
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -160(%rbp)
+	jne .L10
+.L11:
+.L8:
+.L9:
+	cmpl $33, -8(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jl .L12
+.L13:
+	movl $0, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jge .L14
+	movl $8, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -168(%rbp)
+	cmpq $0, -168(%rbp)
+	je .L15
+	.p2align 4,,10
+.L16:
+	movslq -8(%rbp), %rax
+	movl -48(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -48(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -48(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -48(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -168(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $8, -8(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movslq -8(%rbp), %rax
+	movl -48(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jl .L18
+.L19:
+	movl $0, -8(%rbp)
+	cmpl $0, -120(%rbp)
+	je .L20
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L21
+	.p2align 4,,10
+.L22:
+	movslq -8(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -176(%rbp)
+	jne .L22
+.L23:
+.L20:
+.L21:
+	cmpl $16, -8(%rbp)
+	jge .L25
+	.p2align 4,,10
+.L24:
+	movslq -8(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -152(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L24
+.L25:
+	movq -152(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -152(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -152(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -152(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movq -152(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $512, %rsp
+	movw %di, -2(%rbp)
+	movq %rsi, -16(%rbp)
+	movb %dl, -17(%rbp)
+	movl %ecx, -24(%rbp)
+	movl %r8d, -28(%rbp)
+	movl %r9d, -32(%rbp)
+	movb $-1, -33(%rbp)
+	movl $201, -40(%rbp)
+	movw $-11485, -42(%rbp)
+	movq $1, -56(%rbp)
+	movb $-60, -57(%rbp)
+	movl $2, -64(%rbp)
+	movl $2, -68(%rbp)
+	movabsq $222634111673, %rax
+	movq %rax, -80(%rbp)
+	movl $0, -68(%rbp)
+	imull $10, -68(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -228(%rbp)
+	cmpl $33, -68(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -232(%rbp)
+	testl %eax, %eax
+	je .L26
+	movl $33, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L29
+	.p2align 4,,10
+.L28:
+	addl $10, -228(%rbp)
+	movslq -68(%rbp), %rax
+	movl -228(%rbp), %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $10, -228(%rbp)
+	movslq -68(%rbp), %rax
+	movl -228(%rbp), %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $10, -228(%rbp)
+	movslq -68(%rbp), %rax
+	movl -228(%rbp), %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $10, -228(%rbp)
+	movslq -68(%rbp), %rax
+	movl -228(%rbp), %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -240(%rbp)
+	jne .L28
+.L29:
+.L26:
+.L27:
+	cmpl $33, -68(%rbp)
+	jge .L31
+	.p2align 4,,10
+.L30:
+	addl $10, -228(%rbp)
+	movslq -68(%rbp), %rax
+	movl -228(%rbp), %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $33, -68(%rbp)
+	jl .L30
+.L31:
+	movl $0, -68(%rbp)
+	cmpl $0, -232(%rbp)
+	je .L32
+	movl $33, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -392(%rbp)
+	cmpq $0, -392(%rbp)
+	je .L35
+	.p2align 4,,10
+.L34:
+	movslq -68(%rbp), %rax
+	movq %rax, -400(%rbp)
+	imulq $398, %rax, %rax
+	movq %rax, %rcx
+	movq -400(%rbp), %rax
+	movl %ecx, -384(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movq %rax, -408(%rbp)
+	imulq $398, %rax, %rax
+	movq %rax, %rcx
+	movq -408(%rbp), %rax
+	movl %ecx, -384(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movq %rax, -416(%rbp)
+	imulq $398, %rax, %rax
+	movq %rax, %rcx
+	movq -416(%rbp), %rax
+	movl %ecx, -384(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	movq %rax, -424(%rbp)
+	imulq $398, %rax, %rax
+	movq %rax, %rcx
+	movq -424(%rbp), %rax
+	movl %ecx, -384(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -392(%rbp)
+	jne .L34
+.L35:
+.L32:
+.L33:
+	cmpl $33, -68(%rbp)
+	jge .L37
+	.p2align 4,,10
+.L36:
+	movslq -68(%rbp), %rax
+	movq %rax, -432(%rbp)
+	imulq $398, %rax, %rax
+	movq %rax, %rcx
+	movq -432(%rbp), %rax
+	movl %ecx, -384(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $33, -68(%rbp)
+	jl .L36
+.L37:
+	movl g0(%rip), %eax
+	addl $10, %eax
+	cmpl $7, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+.L39:
+.L38:
+	movq $0, -80(%rbp)
+	movabsq $360083010370, %rax
+	movabsq $8432501264, %rcx
+	subq %rcx, %rax
+	movq %rax, -440(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -448(%rbp)
+	imull -448(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -444(%rbp)
+	cmpb $0, -57(%rbp)
+	je .L41
+	movl $93, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L42
+.L41:
+	movl $0, %eax
+.L42:
+	movl %eax, -452(%rbp)
+	movl -28(%rbp), %eax
+	movabsq $258747274164, %rcx
+	subq %rcx, %rax
+	movswq -2(%rbp), %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -456(%rbp)
+	cmpq $17, -80(%rbp)
+	jge .L44
+	.p2align 4,,10
+.L43:
+	movl $0, -68(%rbp)
+	movq -440(%rbp), %rax
+	movq %rax, -464(%rbp)
+	movl -444(%rbp), %eax
+	movl %eax, -468(%rbp)
+	cmpl $17, -68(%rbp)
+	jge .L45
+	movl $17, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -480(%rbp)
+	cmpq $0, -480(%rbp)
+	je .L48
+	.p2align 4,,10
+.L47:
+	movq -464(%rbp), %rax
+	movslq -468(%rbp), %rcx
+	cqo
+	idivq %rcx
+	movb %al, -33(%rbp)
+	addl $1, -68(%rbp)
+	movsbl -33(%rbp), %eax
+	movb %al, -33(%rbp)
+	addl $1, -68(%rbp)
+	movsbl -33(%rbp), %eax
+	movb %al, -33(%rbp)
+	addl $1, -68(%rbp)
+	movsbl -33(%rbp), %eax
+	movb %al, -33(%rbp)
+	addl $1, -68(%rbp)
+	subq $1, -480(%rbp)
+	jne .L47
+.L48:
+.L45:
+.L46:
+	cmpl $17, -68(%rbp)
+	jge .L50
+	.p2align 4,,10
+.L49:
+	movq -464(%rbp), %rax
+	movslq -468(%rbp), %rcx
+	cqo
+	idivq %rcx
+	movb %al, -33(%rbp)
+	addl $1, -68(%rbp)
+	cmpl $17, -68(%rbp)
+	jl .L49
+.L50:
+	cmpl $0, -452(%rbp)
+	je .L51
+	cmpb $0, -57(%rbp)
+	jne .L55
+	cmpq $0, -16(%rbp)
+	je .L53
+.L55:
+	movsbl -17(%rbp), %eax
+	addl $293, %eax
+	movb %al, -17(%rbp)
+	cmpq $256, -16(%rbp)
+	jle .LB0
+.L56:
+.L57:
+	cmpl $0, -24(%rbp)
+	jne .L58
+.L44:
+	movswl -42(%rbp), %eax
+	movl %eax, -484(%rbp)
+	imull -484(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $128, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .L64
+	movl $478, %eax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L62
+.L64:
+	movl $50, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, -2(%rbp)
+.L63:
+	movsbl -33(%rbp), %eax
+	movl %eax, -500(%rbp)
+	testl %eax, %eax
+	jl .L73
+	cmpl $33, -500(%rbp)
+	jge .L73
+	movl -500(%rbp), %eax
+	sall $3, %eax
+	cmpq $3, -56(%rbp)
+	seta %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movsbq -33(%rbp), %rax
+	movl %ecx, -384(%rbp,%rax,4)
+.L73:
+.L74:
+	movl $9, -32(%rbp)
+	movsbl -17(%rbp), %eax
+	cmpl %eax, -68(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L58:
+.L59:
+.L54:
+	movb $96, -17(%rbp)
+.L51:
+.L52:
+	movq $222, -16(%rbp)
+	addq $1, -80(%rbp)
+	cmpq $17, -80(%rbp)
+	jl .L43
+	jmp .L44
+.L53:
+	movl $945, %eax
+	testl %eax, %eax
+	je .L60
+	jmp .L44
+.L40:
+	jmp .L38
+.L62:
+	movl $2, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jae .L66
+	.p2align 4,,10
+.L65:
+	movl $0, -40(%rbp)
+	cmpl $17, -40(%rbp)
+	jae .L67
+	movl $17, %eax
+	movl -40(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -496(%rbp)
+	cmpq $0, -496(%rbp)
+	je .L70
+	.p2align 4,,10
+.L69:
+	movl $903, -376(%rbp)
+	movl -484(%rbp), %eax
+	movl %eax, -148(%rbp)
+	addl $1, -40(%rbp)
+	movl $903, -376(%rbp)
+	movl -484(%rbp), %eax
+	movl %eax, -148(%rbp)
+	addl $1, -40(%rbp)
+	movl $903, -376(%rbp)
+	movl -484(%rbp), %eax
+	movl %eax, -148(%rbp)
+	addl $1, -40(%rbp)
+	movl $903, -376(%rbp)
+	movl -484(%rbp), %eax
+	movl %eax, -148(%rbp)
+	addl $1, -40(%rbp)
+	subq $1, -496(%rbp)
+	jne .L69
+.L70:
+.L67:
+.L68:
+	cmpl $17, -40(%rbp)
+	jae .L72
+	.p2align 4,,10
+.L71:
+	movl $903, -376(%rbp)
+	movl -484(%rbp), %eax
+	movl %eax, -148(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $17, -40(%rbp)
+	jb .L71
+.L72:
+	addl $256, -24(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jb .L65
+.L66:
+	movsbl -57(%rbp), %eax
+	cmpl $167, %eax
+	setl %al
+	movzbl %al, %eax
+	addl -484(%rbp), %eax
+	movw %ax, -42(%rbp)
+	movl -448(%rbp), %eax
+	imull -448(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -208(%rbp), %eax
+	cltd
+	idivl %ecx
+	movw %ax, -42(%rbp)
+	jmp .L63
+.L60:
+.L61:
+	movq -80(%rbp), %rax
+	movl $2, -384(%rbp,%rax,4)
+	jmp .L54
+.LB0:
+	movl -456(%rbp), %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,77 @@
+char g0;
+short g1;
+int ga0[8];
+int main() {
+    long v0 = 922;
+    unsigned char v1 = 10;
+    unsigned int v2 = 247U;
+    int v3 = 2;
+    long v4 = 103;
+    unsigned int v5 = 184;
+    int i0 = 0;
+    long j0 = 959;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 1000000007; }
+    if (-(((i0 + 2147483647u) && v5))) {
+        g1 = (!((short)(9)) > g0);
+        i0 = !(10);
+    }
+    v4 = v4 + ((3 <= v0) <= g1);
+    v1 = (!(la1[2]) != !(v4));
+    v4 = 0;
+    while (v4 < 4) {
+        if ((int)(v3)) {
+            if (v1) {
+                if (((318 == j0) + v5)) { break; }
+            }
+        }
+        v3 = 4;
+        v4 = v4 + 1;
+    }
+    if (812) {
+        v5 = v3;
+    } else {
+        for (v0 = 1; v0 < 100; v0 = v0 + 1) {
+            if (5) {
+                if (5) { break; }
+            }
+            switch (((10 != i0) - (5 < 889))) {
+            case 750:
+                break;
+            default:
+                if (v0 >= 0 && v0 < 8) { ga0[v0] = 1; }
+                break;
+            case 21:
+                if (!((char)(j0))) { break; }
+                if ((v5 >= -(748985451439))) { return 9; }
+                break;
+            case 3:
+                v4 = v3;
+                j0 = (((la1[12] != 303u) >= (v4 + 305)) == v2);
+                break;
+            case 177:
+                break;
+            }
+        }
+        i0 = ((unsigned int)((10U / 1024)) >= (char)(la1[25]));
+    }
+    if (v1) { return (v1 - 0); }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
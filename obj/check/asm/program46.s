@@ -0,0 +1,643 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.zero 1
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $416, %rsp
+	movq $922, -8(%rbp)
+	movb $10, -9(%rbp)
+	movl $247, -16(%rbp)
+	movl $2, -20(%rbp)
+	movq $103, -32(%rbp)
+	movl $184, -36(%rbp)
+	movl $0, -40(%rbp)
+	movq $959, -48(%rbp)
+	movl $0, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movl -40(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -208(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -40(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movl -40(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L4
+.L5:
+	movl $0, -40(%rbp)
+	imull $1000000007, -40(%rbp), %eax
+	subl $1000000007, %eax
+	movl %eax, -356(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L6
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -368(%rbp)
+	cmpq $0, -368(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	addl $1000000007, -356(%rbp)
+	movslq -40(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $1000000007, -356(%rbp)
+	movslq -40(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $1000000007, -356(%rbp)
+	movslq -40(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $1000000007, -356(%rbp)
+	movslq -40(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -368(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $33, -40(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	addl $1000000007, -356(%rbp)
+	movslq -40(%rbp), %rax
+	movl -356(%rbp), %ecx
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L10
+.L11:
+	movl -40(%rbp), %eax
+	addl $2147483647, %eax
+	je .L14
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L15
+.L14:
+	movl $0, %eax
+.L15:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L12
+	movl $9, %eax
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movsbl g0(%rip), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movw %ax, g1(%rip)
+	movl $10, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+.L12:
+.L13:
+	cmpq $3, -8(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movswl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -344(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	movq $0, -32(%rbp)
+	cmpq $318, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl -36(%rbp), %eax
+	movl %eax, -372(%rbp)
+	cmpq $4, -32(%rbp)
+	jge .L17
+	.p2align 4,,10
+.L16:
+	cmpl $0, -20(%rbp)
+	je .L18
+	cmpb $0, -9(%rbp)
+	je .L20
+	cmpl $0, -372(%rbp)
+	je .L22
+.L17:
+	movl $812, %eax
+	testl %eax, %eax
+	je .L24
+	movl -20(%rbp), %eax
+	movl %eax, -36(%rbp)
+	jmp .L25
+.L22:
+.L23:
+.L20:
+.L21:
+.L18:
+.L19:
+	movl $4, -20(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L16
+	jmp .L17
+.L24:
+	movq $1, -8(%rbp)
+	movl $5, %eax
+	cmpl $889, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $10, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movl %eax, -376(%rbp)
+	xorl %eax, %eax
+	movabsq $748985451439, %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -380(%rbp)
+	cmpq $100, -8(%rbp)
+	jge .L27
+	.p2align 4,,10
+.L26:
+	movl $5, %eax
+	testl %eax, %eax
+	je .L28
+	movl $5, %eax
+	testl %eax, %eax
+	je .L30
+.L27:
+	movl -252(%rbp), %eax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	shrl $10, %eax
+	cmpl %ecx, %eax
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+.L25:
+	cmpb $0, -9(%rbp)
+	jne .LB0
+.L45:
+.L46:
+	movq $0, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	movswq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	movzbl -9(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	movl -16(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	movl -36(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	movslq -40(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	imulq $31, -392(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -392(%rbp)
+	movl $0, -40(%rbp)
+	cmpl $8, -40(%rbp)
+	jge .L47
+	movl $8, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -400(%rbp)
+	cmpq $0, -400(%rbp)
+	je .L50
+	.p2align 4,,10
+.L49:
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	subq $1, -400(%rbp)
+	jne .L49
+.L50:
+.L47:
+.L48:
+	cmpl $8, -40(%rbp)
+	jge .L52
+	.p2align 4,,10
+.L51:
+	movslq -40(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $8, -40(%rbp)
+	jl .L51
+.L52:
+	movl $0, -40(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L53
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -408(%rbp)
+	cmpq $0, -408(%rbp)
+	je .L56
+	.p2align 4,,10
+.L55:
+	movslq -40(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	subq $1, -408(%rbp)
+	jne .L55
+.L56:
+.L53:
+.L54:
+	cmpl $33, -40(%rbp)
+	jge .L58
+	.p2align 4,,10
+.L57:
+	movslq -40(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L57
+.L58:
+	movl $0, -40(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L59
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -416(%rbp)
+	cmpq $0, -416(%rbp)
+	je .L62
+	.p2align 4,,10
+.L61:
+	movslq -40(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	movslq -40(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	subq $1, -416(%rbp)
+	jne .L61
+.L62:
+.L59:
+.L60:
+	cmpl $33, -40(%rbp)
+	jge .L64
+	.p2align 4,,10
+.L63:
+	movslq -40(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -392(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L63
+.L64:
+	movq -392(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -392(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -392(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -392(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -392(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -392(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -392(%rbp)
+	movq -392(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L30:
+.L31:
+.L28:
+.L29:
+	movl -376(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $177, %rax
+	jge .L38
+	cmpq $3, %rax
+	je .L36
+	cmpq $21, %rax
+	je .L35
+.L34:
+	cmpq $0, -8(%rbp)
+	jl .L39
+	cmpq $8, -8(%rbp)
+	jge .L39
+	movq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl $1, (%rdx,%rax,4)
+.L39:
+.L40:
+.L32:
+	addq $1, -8(%rbp)
+	cmpq $100, -8(%rbp)
+	jl .L26
+	jmp .L27
+.L38:
+	cmpq $177, %rax
+	je .L32
+	cmpq $750, %rax
+	je .L32
+	jmp .L34
+.L36:
+	movslq -20(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	addq $305, %rax
+	movq %rax, %rcx
+	movl -304(%rbp), %eax
+	cmpl $303, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	cmpl -16(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	jmp .L32
+.L37:
+	jmp .L32
+.L33:
+	jmp .L32
+.L35:
+	movq -48(%rbp), %rax
+	testb %al, %al
+	jne .L41
+	jmp .L32
+.L41:
+.L42:
+	cmpl $0, -380(%rbp)
+	jne .LB1
+.L43:
+.L44:
+	jmp .L32
+.LB0:
+	movzbl -9(%rbp), %eax
+	subl $0, %eax
+	jmp .main_return
+.LB1:
+	movl $9, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
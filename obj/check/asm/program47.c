@@ -0,0 +1,401 @@
+int g0;
+char g1 = 0;
+unsigned char g2;
+short f0(unsigned int p0, unsigned int p1, char p2, char p3) {
+    short v0 = 1;
+    long v1 = 2147483647;
+    int i0 = 946312504155;
+    long j0 = 128;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 6L; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 7; }
+    p1 = (((unsigned long)(g1) / 7) + g0);
+    for (j0 = 0; j0 < 16; j0 = j0 + 1) {
+        for (v0 = 0; v0 < 8; v0 = v0 + 1) {
+            for (p0 = 0; p0 < 3; p0 = p0 + 1) {
+                if ((-(309) * (2147483647u - j0))) { break; }
+                if (p0 >= 0 && p0 < 8) { la1[p0] = (!(1) - (p0 * v0)); }
+            }
+            i0 = -(((p3 - g0) - (342 + 4294967295)));
+            v1 = v1 + (5 + (unsigned int)(la1[3]));
+        }
+        p1 = (165 + p0);
+    }
+    p2 = p2 + (!(10) + (i0 - i0));
+    return -((la0[0] * 3l));
+}
+unsigned short f1(unsigned long p0) {
+    long v0 = 583;
+    short v1 = 877294602228;
+    long v2 = 550;
+    short v3 = 751;
+    char v4 = 3;
+    int i0 = 845066613416;
+    long j0 = 9;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 529; }
+    p0 = g1;
+    v2 = la0[0];
+    f0((5 + g2), (2147483647 / 1024), f0(p0, la0[3], v0, 451), f0(3, v4, 518601840502, la0[32]));
+    j0 = g1;
+    i0 = i0 + i0;
+    return -((v3 <= (4 && p0)));
+}
+char f2(unsigned long p0, short p1, char p2) {
+    unsigned char v0 = 6ul;
+    char v1 = 235042150265;
+    char v2 = 9l;
+    short v3 = 482139499362;
+    int i0 = 256;
+    long j0 = 0;
+    if (f1(p2)) { return i0; }
+    i0 = 0;
+    while (i0 < 33) {
+        for (j0 = 1; j0 < 100; j0 = j0 + 1) {
+            p1 = (f0(p2, 282, 7, 8613728940) == -(v3));
+        }
+        p2 = -((long)((5 <= p1)));
+        switch ((-(0) < (v1 && v2))) {
+        default:
+            p1 = 0;
+            while (p1 < 5) {
+                if (774) { break; }
+                if (((char)(p0) + -(800))) { break; }
+                p1 = p1 + 1;
+            }
+        case 588:
+            break;
+        case 1:
+            if (v1) {
+                v3 = ((char)((5 - 1)) + v1);
+                if (f0(10, v0, 0, 51652326361)) { break; }
+                if (184462172118) { break; }
+            }
+            break;
+        case 58:
+            j0 = j0 + (f1(j0) || (1071127848571 * g0));
+            break;
+        case -1:
+            v2 = (((g1 - 609) > (2 <= p2)) <= (int)(!(v1)));
+            if ((8 + p0)) {
+                if ((p2 / (v2 * v2 + 1))) { break; }
+                if (g1) { break; }
+            }
+        case 64:
+            if (-((g0 / 2))) { break; }
+            break;
+        case 7:
+            for (v3 = 0; v3 < 17; v3 = v3 + 1) {
+                v0 = (unsigned char)((!(10) <= 1));
+                if ((j0 < (v3 || 6))) { break; }
+                p1 = ((g2 && 128) - !((7 >= 1050895124464)));
+            }
+        }
+        i0 = i0 + 1;
+    }
+    f1(676);
+    switch (-(6)) {
+    case 4:
+        f0((unsigned int)(v1), -(1034876702590), v0, 66);
+        break;
+    case 62:
+        j0 = 32767;
+        break;
+    case 318:
+        p1 = p0;
+    case 0:
+        if (302350663587) {
+            if (!(f0(1, p1, 65536, 425))) {
+                f0(-(786), (i0 / 5l), (5 != 564), !(6));
+                f0(f0(v1, v0, p0, p0), (20 > 1), (5 == v3), 2);
+                v3 = v3 + g0;
+            }
+            if ((f1(p0) || (f0(246, 175, p1, g0) < (3 * 4294967295)))) {
+                f1((long)(6));
+                i0 = f1(230);
+                f1((4 > g0));
+            } else {
+                f1((6 / (p0 * p0 + 1)));
+                v0 = p2;
+            }
+            v0 = -((j0 + 6));
+        } else {
+            v0 = v2;
+            f1(!(1));
+        }
+        if ((f0(472, 182, 256, 6) - p0)) {
+            i0 = i0 + -(v1);
+        }
+        break;
+    case -3:
+        if ((f1(5) != ((g1 / (g0 * g0 + 1)) / (v3 * v3 + 1)))) {
+            i0 = f0((v2 - 616), (p0 - v2), (p1 * 2), (972 == g0));
+        } else {
+            if (-(p2)) {
+                i0 = f0(60, 253, j0, 758);
+            } else {
+                f1(1000000007u);
+            }
+            p0 = (f1(395) == (!(973) < 256));
+        }
+        v0 = f1(!(g0));
+    default:
+        p0 = p0 + (853832672784 / 2);
+    case 47:
+        for (v3 = 0; v3 < 16; v3 = v3 + 1) {
+            if (((int)(i0) / 100)) { return (f0(289, g2, 430, 9) / 3u); }
+            if (f1(f1(6))) {
+                p1 = p1 + ((g0 - 13573340123) < (unsigned char)(0));
+            } else {
+                if (v0) { break; }
+                if (v2) { break; }
+            }
+        }
+        p1 = (256 - !(4u));
+    }
+    if (83) {
+        if ((0 > (v3 - (928 - 5)))) {
+            if ((!(512l) > -(f1(p1)))) {
+                f0(!(668383451687), (873l == g2), (int)(j0), (unsigned int)(7));
+                v1 = g0;
+            } else {
+                f0(f0(3, 7, g1, 1000000007), v3, 173773613726, p2);
+                f0(1, 8, (i0 > 6), (2 + 890));
+            }
+            for (j0 = 0; j0 < 16; j0 = j0 + 1) {
+                if (p2) { break; }
+                p1 = p1 + !((p0 + 0));
+                if ((364 - (550 + g0))) { break; }
+            }
+            switch (65535) {
+            case 3:
+                p2 = !((!(2) / 13ul));
+                if ((560 != (4 - 2))) { return ((unsigned int)(256025507420) <= (v2 > 256)); }
+                break;
+            default:
+            case 6:
+                break;
+            case 2:
+                j0 = (((839336043106 > p2) == (long)(2)) && 442);
+                break;
+            case 8:
+                v3 = v3 + ((2 / (v0 * v0 + 1)) != (0 / (v1 * v1 + 1)));
+            case 10:
+                if (v1) { return (p1 && (1 <= 6)); }
+                f0(-(32767), p2, 770, !(v3));
+                break;
+            }
+        }
+        v0 = f0(8l, 787, 454l, (2 && 0));
+        v1 = i0;
+    } else {
+        f1(9);
+        p1 = p1 + ((0 * 716862100428) != !(10));
+        v1 = ((char)(v0) > j0);
+    }
+    return ((!(6) + g1) >= i0);
+}
+void w2(unsigned char q0, unsigned long q1) {
+    g1 = g1 * 3 + q1;
+    g1 = g1 * 3 + q1;
+}
+short f3() {
+    int v0 = 65536;
+    int v1 = 5;
+    unsigned char v2 = 7;
+    int i0 = 256;
+    long j0 = 0;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 3; }
+    if (-(((977 == g1) - (546L - g0)))) {
+        if (v0) {
+            v1 = v1 + (!(v1) && 0);
+            f1(la0[0]);
+        }
+        if ((73775242053 / 3)) {
+            if (((i0 >= 905) < (!(la0[3]) || i0))) {
+                f2((g1 > 268), g0, f2(v2, la0[0], i0));
+                v0 = v0 + (v2 / 100);
+                f2(957, f1(g0), (10 && 8));
+            } else {
+                f0(f2(v2, v2, 813u), (8 / 13ul), la0[1], (unsigned int)(g0));
+            }
+            f1((g2 == j0));
+        } else {
+            i0 = i0 + ((687 / 4) && (v1 / (g2 * g2 + 1)));
+            v0 = ((v2 - (2 <= 77459471040)) > (v0 == 0ul));
+            la0[0] = 4;
+        }
+    } else {
+        for (v0 = 1; v0 < 17; v0 = v0 + 1) {
+            if ((f1(la0[1]) || v0)) {
+                if ((char)((6 - 172u))) { break; }
+                v2 = (((g0 <= 874314122208) > (la0[2] < la0[3])) >= (j0 / (v0 * v0 + 1)));
+                i0 = (450024959552 - v1);
+            }
+            i0 = v1;
+            switch (-((i0 || v0))) {
+            case 34:
+                break;
+            case 0:
+                v1 = f2(-(g0), (373132446681 >= 9), (952030074451 - la0[3]));
+            case 26:
+                break;
+            case 24:
+                v1 = (-(-(la0[2])) * ((v2 / (j0 * j0 + 1)) / (g0 * g0 + 1)));
+                if (g0 >= 0 && g0 < 4) { la0[g0] = (j0 <= (5 > g0)); }
+                break;
+            case 1:
+                if ((f2(i0, 7, v1) - (i0 + 4))) { break; }
+                if (246) { break; }
+            }
+        }
+    }
+    v1 = (1 < (g1 != (223ul <= 811ul)));
+    v0 = v0 + v0;
+    v1 = 0;
+    while (v1 < 8) {
+        if (((g0 != la0[1]) / 10)) {
+            v2 = v2 + f2(v0, 57, 459);
+            switch (i0) {
+            case 2:
+                if (9) { break; }
+                v0 = (unsigned short)(g0);
+                break;
+            default:
+                if (((8U / 4) == (256 / (g2 * g2 + 1)))) { break; }
+            case 7:
+                f0(i0, g1, (670 / (v0 * v0 + 1)), 2);
+                if ((short)(g2)) { break; }
+                break;
+            case 5:
+                if ((-(i0) - j0)) { break; }
+                v2 = f0((v1 / (g2 * g2 + 1)), (166 != 7U), (unsigned long)(4294967295), f0(4294967295, g2, g1, 10));
+            case 0:
+                if (((g0 <= 7) + 10)) { break; }
+                v0 = (((v0 != v1) + (1 / (g1 * g1 + 1))) / 13ul);
+                break;
+            }
+        } else {
+            v0 = !(i0);
+            switch ((v2 - (unsigned char)(g0))) {
+            case 3:
+                v0 = v0 + (9U || 10);
+            case 8:
+            case 7:
+                v0 = 748;
+                la0[2] = !((la0[2] * 788U));
+                break;
+            case 1:
+                j0 = ((unsigned int)((g2 + g2)) + v2);
+                break;
+            case 10:
+                break;
+            case 6:
+                j0 = f0((long)(574907361116), f1(v0), f0(g0, g1, 9L, 628484279843U), 335);
+                break;
+            case 5:
+                break;
+            }
+        }
+        v1 = v1 + 1;
+    }
+    v1 = (((65536 - g1) * la0[0]) * ((647u + j0) < (932 < 4294967295)));
+    return (992 - ((1 && la0[1]) + (215 && 8U)));
+}
+void w3(int q0) {
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q0;
+    g2 = g2 * 3 + q0;
+}
+int rec(int n, int acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    unsigned long v0 = 263;
+    unsigned short v1 = 523l;
+    int v2 = 3;
+    unsigned int v3 = 949831418731;
+    int i0 = 822;
+    long j0 = 1046570623804ul;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 9ul; }
+    v2 = ((v1 * rec(453ul, 26ul)) / (v1 * v1 + 1));
+    if ((j0 * v1)) {
+        i0 = (!((v3 <= 639)) && 7);
+    } else {
+        if (-(4)) {
+            if (((j0 || 54) / (v3 * v3 + 1))) {
+                w3(4);
+                w3(5);
+            }
+            switch (((v2 != v1) / 7)) {
+            case 10:
+                w2(301, 8);
+                v2 = (la0[3] / (g0 * g0 + 1));
+            case 5:
+                w2(v1, 7);
+                g0 = !((v3 < (long)(la0[2])));
+                break;
+            case 7:
+                if (((952 || g0) - f3())) { return (i0 >= (j0 >= 8l)); }
+                if (v2 >= 0 && v2 < 4) { la0[v2] = 128; }
+            }
+        } else {
+            if (255) { return (char)((v3 == g2)); }
+            switch (la0[1]) {
+            case 2:
+            case 0:
+                j0 = !(((10 + g1) < 255));
+                break;
+            case 11:
+                w2(i0, 8);
+                break;
+            case 474:
+                if (i0 >= 0 && i0 < 4) { la0[i0] = f3(); }
+            case 3:
+                la0[0] = (char)((long)(i0));
+                break;
+            case 690:
+                v3 = (v0 > (908 + 8));
+                w2(38, v3);
+            case 4:
+                break;
+            case 5:
+                if (g1 >= 0 && g1 < 4) { la0[g1] = ((7 > 1) <= (la0[3] - la0[0])); }
+                break;
+            default:
+                v0 = f3();
+                break;
+            }
+        }
+    }
+    for (i0 = 1; i0 < 16; i0 = i0 + 1) {
+        g1 = g1 + f3();
+    }
+    i0 = 0;
+    while (i0 < 8) {
+        g0 = 923;
+        v0 = 96U;
+        i0 = i0 + 1;
+    }
+    v0 = rec(-(g0), v1);
+    g2 = ((g1 + v3) || (64 + 737885173498U));
+    la0[0] = ((i0 - 0) > (2 + j0));
+    v1 = v1 + -(2147483647);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
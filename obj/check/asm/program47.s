@@ -0,0 +1,2949 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.zero 1
+	.type g2, @object
+	.size g2, 1
+	.p2align 0
+g2:
+	.zero 1
+	.section .text
+	.type f0, @function
+	.type f1, @function
+	.type f0.constprop.3, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.2, @function
+	.type f0.constprop.1, @function
+	.type f2, @function
+	.type rec, @function
+	.type f3, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movb %cl, -10(%rbp)
+	movw $1, -12(%rbp)
+	movq $2147483647, -24(%rbp)
+	movl $1419699035, -28(%rbp)
+	movq $128, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -64(%rbp)
+	movl $6, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $18, -52(%rbp)
+	movl $4, -28(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $28, -80(%rbp)
+	movl $35, -76(%rbp)
+	movl $42, -72(%rbp)
+	movl $49, -68(%rbp)
+	movl $8, -28(%rbp)
+	movsbq g1(%rip), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movl %eax, -8(%rbp)
+	movq $0, -40(%rbp)
+	movl $-309, -100(%rbp)
+	movabsq $4294967637, %rax
+	movq %rax, -112(%rbp)
+	cmpq $16, -40(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movw $0, -12(%rbp)
+	movl $2147483647, %eax
+	subq -40(%rbp), %rax
+	movq %rax, %rcx
+	movslq -100(%rbp), %rax
+	imulq %rcx, %rax
+	movq %rax, -120(%rbp)
+	movq -112(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -132(%rbp)
+	cmpl $8, %eax
+	jge .L3
+	.p2align 4,,10
+.L2:
+	movl $0, -4(%rbp)
+	movq -120(%rbp), %rax
+	movq %rax, -144(%rbp)
+	cmpl $3, -4(%rbp)
+	jae .L5
+	.p2align 4,,10
+.L4:
+	cmpq $0, -144(%rbp)
+	je .L6
+.L5:
+	movsbl -10(%rbp), %eax
+	subl g0(%rip), %eax
+	movslq %eax, %rax
+	subq -128(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+	movl -84(%rbp), %eax
+	addl $5, %eax
+	addq %rax, -24(%rbp)
+	movl -132(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -12(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -132(%rbp)
+	cmpl $8, %eax
+	jl .L2
+.L3:
+	movl -4(%rbp), %eax
+	addl $165, %eax
+	movl %eax, -8(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jl .L0
+.L1:
+	movl -28(%rbp), %eax
+	subl -28(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -9(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -9(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L6:
+.L7:
+	cmpl $0, -4(%rbp)
+	jb .L8
+	cmpl $8, -4(%rbp)
+	jae .L8
+	movswl -12(%rbp), %eax
+	imull -4(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L8:
+.L9:
+	addl $1, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L4
+	jmp .L5
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movq %rdi, -8(%rbp)
+	movq $583, -16(%rbp)
+	movw $18420, -18(%rbp)
+	movq $550, -32(%rbp)
+	movw $751, -34(%rbp)
+	movb $3, -35(%rbp)
+	movl $-1041943896, -40(%rbp)
+	movq $9, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $529, -40(%rbp), %eax
+	subl $529, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -40(%rbp)
+	jge .L10
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L11
+	.p2align 4,,10
+.L12:
+	addl $529, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $529, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $529, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $529, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -208(%rbp)
+	jne .L12
+.L13:
+.L10:
+.L11:
+	cmpl $33, -40(%rbp)
+	jge .L15
+	.p2align 4,,10
+.L14:
+	addl $529, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L14
+.L15:
+	movsbq g1(%rip), %rax
+	movq %rax, -8(%rbp)
+	movl -192(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl -64(%rbp), %eax
+	movq %rax, %rcx
+	movl $118, %eax
+	movq %rax, %rdx
+	movsbl -35(%rbp), %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f0
+	pushq %rax
+	subq $8, %rsp
+	movq -16(%rbp), %rax
+	movq %rax, %rdx
+	movl -180(%rbp), %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.3
+	addq $8, %rsp
+	movq %rax, %rdx
+	movl $2147483647, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movq %rax, %rsi
+	movzbl g2(%rip), %eax
+	addl $5, %eax
+	movq %rax, %rdi
+	popq %rcx
+	call f0
+	movsbq g1(%rip), %rax
+	movq %rax, -48(%rbp)
+	movl -40(%rbp), %eax
+	addl %eax, -40(%rbp)
+	movl $4, %eax
+	testl %eax, %eax
+	je .L16
+	cmpq $0, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L17
+.L16:
+	movl $0, %eax
+.L17:
+	movq %rax, %rcx
+	movswl -34(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1, .-f1
+	.align 16
+f0.constprop.3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movw $1, -12(%rbp)
+	movq $2147483647, -24(%rbp)
+	movl $1419699035, -28(%rbp)
+	movq $128, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -64(%rbp)
+	movl $6, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $18, -52(%rbp)
+	movl $4, -28(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $28, -80(%rbp)
+	movl $35, -76(%rbp)
+	movl $42, -72(%rbp)
+	movl $49, -68(%rbp)
+	movl $8, -28(%rbp)
+	movsbq g1(%rip), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movl %eax, -8(%rbp)
+	movq $0, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movw $0, -12(%rbp)
+	movl $2147483647, %eax
+	subq -40(%rbp), %rax
+	imulq $-309, %rax, %rax
+	movq %rax, -104(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jge .L21
+	.p2align 4,,10
+.L20:
+	movl $0, -4(%rbp)
+	movq -104(%rbp), %rax
+	movq %rax, -120(%rbp)
+	cmpl $3, -4(%rbp)
+	jae .L23
+	.p2align 4,,10
+.L22:
+	cmpq $0, -120(%rbp)
+	je .L24
+.L23:
+	movl $-61, %eax
+	subl g0(%rip), %eax
+	movslq %eax, %rax
+	movabsq $4294967637, %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+	movl -84(%rbp), %eax
+	addl $5, %eax
+	addq %rax, -24(%rbp)
+	movl -108(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -12(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jl .L20
+.L21:
+	movl -4(%rbp), %eax
+	addl $165, %eax
+	movl %eax, -8(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jl .L18
+.L19:
+	movl -28(%rbp), %eax
+	subl -28(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -9(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -9(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+.f0.constprop.3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L24:
+.L25:
+	cmpl $0, -4(%rbp)
+	jb .L26
+	cmpl $8, -4(%rbp)
+	jae .L26
+	movswl -12(%rbp), %eax
+	imull -4(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L26:
+.L27:
+	addl $1, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L22
+	jmp .L23
+	.size f0.constprop.3, .-f0.constprop.3
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movw $1, -12(%rbp)
+	movq $2147483647, -24(%rbp)
+	movl $1419699035, -28(%rbp)
+	movq $128, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -64(%rbp)
+	movl $6, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $18, -52(%rbp)
+	movl $4, -28(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $28, -80(%rbp)
+	movl $35, -76(%rbp)
+	movl $42, -72(%rbp)
+	movl $49, -68(%rbp)
+	movl $8, -28(%rbp)
+	movsbq g1(%rip), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movl %eax, -8(%rbp)
+	movq $0, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jge .L29
+	.p2align 4,,10
+.L28:
+	movw $0, -12(%rbp)
+	movl $2147483647, %eax
+	subq -40(%rbp), %rax
+	imulq $-309, %rax, %rax
+	movq %rax, -104(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jge .L31
+	.p2align 4,,10
+.L30:
+	movl $0, -4(%rbp)
+	movq -104(%rbp), %rax
+	movq %rax, -120(%rbp)
+	cmpl $3, -4(%rbp)
+	jae .L33
+	.p2align 4,,10
+.L32:
+	cmpq $0, -120(%rbp)
+	je .L34
+.L33:
+	xorl %eax, %eax
+	subl g0(%rip), %eax
+	movslq %eax, %rax
+	movabsq $4294967637, %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+	movl -84(%rbp), %eax
+	addl $5, %eax
+	addq %rax, -24(%rbp)
+	movl -108(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -12(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jl .L30
+.L31:
+	movl -4(%rbp), %eax
+	addl $165, %eax
+	movl %eax, -8(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jl .L28
+.L29:
+	movl -28(%rbp), %eax
+	subl -28(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -9(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -9(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L34:
+.L35:
+	cmpl $0, -4(%rbp)
+	jb .L36
+	cmpl $8, -4(%rbp)
+	jae .L36
+	movswl -12(%rbp), %eax
+	imull -4(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L36:
+.L37:
+	addl $1, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L32
+	jmp .L33
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movw $1, -12(%rbp)
+	movq $2147483647, -24(%rbp)
+	movl $1419699035, -28(%rbp)
+	movq $128, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -64(%rbp)
+	movl $6, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $18, -52(%rbp)
+	movl $4, -28(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $28, -80(%rbp)
+	movl $35, -76(%rbp)
+	movl $42, -72(%rbp)
+	movl $49, -68(%rbp)
+	movl $8, -28(%rbp)
+	movsbq g1(%rip), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movl %eax, -8(%rbp)
+	movq $0, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jge .L39
+	.p2align 4,,10
+.L38:
+	movw $0, -12(%rbp)
+	movl $2147483647, %eax
+	subq -40(%rbp), %rax
+	imulq $-309, %rax, %rax
+	movq %rax, -104(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jge .L41
+	.p2align 4,,10
+.L40:
+	movl $0, -4(%rbp)
+	movq -104(%rbp), %rax
+	movq %rax, -120(%rbp)
+	cmpl $3, -4(%rbp)
+	jae .L43
+	.p2align 4,,10
+.L42:
+	cmpq $0, -120(%rbp)
+	je .L44
+.L43:
+	movl $7, %eax
+	subl g0(%rip), %eax
+	movslq %eax, %rax
+	movabsq $4294967637, %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+	movl -84(%rbp), %eax
+	addl $5, %eax
+	addq %rax, -24(%rbp)
+	movl -108(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -12(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jl .L40
+.L41:
+	movl -4(%rbp), %eax
+	addl $165, %eax
+	movl %eax, -8(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jl .L38
+.L39:
+	movl -28(%rbp), %eax
+	subl -28(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -9(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -9(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L44:
+.L45:
+	cmpl $0, -4(%rbp)
+	jb .L46
+	cmpl $8, -4(%rbp)
+	jae .L46
+	movswl -12(%rbp), %eax
+	imull -4(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L46:
+.L47:
+	addl $1, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L42
+	jmp .L43
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movw $1, -12(%rbp)
+	movq $2147483647, -24(%rbp)
+	movl $1419699035, -28(%rbp)
+	movq $128, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -64(%rbp)
+	movl $6, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $18, -52(%rbp)
+	movl $4, -28(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $28, -80(%rbp)
+	movl $35, -76(%rbp)
+	movl $42, -72(%rbp)
+	movl $49, -68(%rbp)
+	movl $8, -28(%rbp)
+	movsbq g1(%rip), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movl %eax, -8(%rbp)
+	movq $0, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jge .L49
+	.p2align 4,,10
+.L48:
+	movw $0, -12(%rbp)
+	movl $2147483647, %eax
+	subq -40(%rbp), %rax
+	imulq $-309, %rax, %rax
+	movq %rax, -104(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jge .L51
+	.p2align 4,,10
+.L50:
+	movl $0, -4(%rbp)
+	movq -104(%rbp), %rax
+	movq %rax, -120(%rbp)
+	cmpl $3, -4(%rbp)
+	jae .L53
+	.p2align 4,,10
+.L52:
+	cmpq $0, -120(%rbp)
+	je .L54
+.L53:
+	movl $2, %eax
+	subl g0(%rip), %eax
+	movslq %eax, %rax
+	movabsq $4294967637, %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -28(%rbp)
+	movl -84(%rbp), %eax
+	addl $5, %eax
+	addq %rax, -24(%rbp)
+	movl -108(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -12(%rbp)
+	movswl -12(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jl .L50
+.L51:
+	movl -4(%rbp), %eax
+	addl $165, %eax
+	movl %eax, -8(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jl .L48
+.L49:
+	movl -28(%rbp), %eax
+	subl -28(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -9(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -9(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L54:
+.L55:
+	cmpl $0, -4(%rbp)
+	jb .L56
+	cmpl $8, -4(%rbp)
+	jae .L56
+	movswl -12(%rbp), %eax
+	imull -4(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L56:
+.L57:
+	addl $1, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jb .L52
+	jmp .L53
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq %rdi, -40(%rbp)
+	movw %si, -72(%rbp)
+	movb %dl, -76(%rbp)
+	movb $6, -75(%rbp)
+	movb $121, -74(%rbp)
+	movb $9, -73(%rbp)
+	movw $-5278, -70(%rbp)
+	movl $256, -68(%rbp)
+	movq $0, -32(%rbp)
+	movsbq %dl, %rax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	jne .LB0
+.L58:
+.L59:
+	movl $0, -68(%rbp)
+	xorl %eax, %eax
+	subl $0, %eax
+	movl %eax, -64(%rbp)
+	xorl %eax, %eax
+	subl $800, %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movsbl %al, %eax
+	addl %ecx, %eax
+	movl %eax, -60(%rbp)
+	movsbl -74(%rbp), %eax
+	movl %eax, -52(%rbp)
+	movq %rax, %rcx
+	movl $5, %eax
+	subl $1, %eax
+	movsbl %al, %eax
+	addl %ecx, %eax
+	movl %eax, -56(%rbp)
+	movq -40(%rbp), %rax
+	addq $8, %rax
+	movq %rax, -24(%rbp)
+	movabsq $1050895124464, %rax
+	cmpq $7, %rax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -48(%rbp)
+	cmpl $33, -68(%rbp)
+	jge .L61
+	.p2align 4,,10
+.L60:
+	movq $1, -32(%rbp)
+	xorl %eax, %eax
+	movswl -70(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -44(%rbp)
+	cmpq $100, -32(%rbp)
+	jge .L62
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L65
+	.p2align 4,,10
+.L64:
+	movl $-84, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $282, %eax
+	movq %rax, %rsi
+	movsbl -76(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	cmpl -44(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	addq $1, -32(%rbp)
+	movl $-84, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $282, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	cmpl -44(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	addq $1, -32(%rbp)
+	movl $-84, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $282, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	cmpl -44(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	addq $1, -32(%rbp)
+	movl $-84, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $282, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	cmpl -44(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -72(%rbp)
+	addq $1, -32(%rbp)
+	subq $1, -16(%rbp)
+	jne .L64
+.L65:
+.L62:
+.L63:
+	cmpq $100, -32(%rbp)
+	jge .L67
+	.p2align 4,,10
+.L66:
+	movl $-84, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $282, %eax
+	movq %rax, %rsi
+	movsbl -76(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	cmpl -44(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -72(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jl .L66
+.L67:
+	movswl -72(%rbp), %eax
+	cmpl $5, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movb %al, -76(%rbp)
+	cmpb $0, -74(%rbp)
+	je .L76
+	cmpb $0, -73(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L77
+.L76:
+	movl $0, %eax
+.L77:
+	cmpl %eax, -64(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $58, %rax
+	jge .L78
+	cmpq $-1, %rax
+	je .L73
+	cmpq $1, %rax
+	je .L71
+	cmpq $7, %rax
+	je .L75
+.L69:
+	movw $0, -72(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movswl -72(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, %eax
+	jge .L80
+	.p2align 4,,10
+.L79:
+	movl $774, %eax
+	testl %eax, %eax
+	je .L81
+.L80:
+.L70:
+.L102:
+.L68:
+	addl $1, -68(%rbp)
+	cmpl $33, -68(%rbp)
+	jl .L60
+.L61:
+	movl $676, %eax
+	movq %rax, %rdi
+	call f1
+	xorl %eax, %eax
+	subl $6, %eax
+	movslq %eax, %rax
+	cmpq $47, %rax
+	jge .L117
+	cmpq $-3, %rax
+	je .L114
+	cmpq $0, %rax
+	je .L113
+	cmpq $4, %rax
+	je .L110
+	jmp .L115
+.L78:
+	cmpq $58, %rax
+	je .L72
+	cmpq $64, %rax
+	je .L74
+	cmpq $588, %rax
+	je .L70
+	jmp .L69
+.L81:
+.L82:
+	cmpl $0, -16(%rbp)
+	je .L83
+	jmp .L80
+.L72:
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	jne .L91
+	movabsq $1071127848571, %rax
+	movslq g0(%rip), %rcx
+	imulq %rcx, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L92
+.L91:
+	movl $1, %eax
+.L92:
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	jmp .L68
+.L73:
+	cmpb $0, -74(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movsbl -76(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $2, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	subl $609, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movb %al, -73(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L93
+	movsbl -73(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L95
+	jmp .L68
+.L97:
+.L98:
+.L93:
+.L94:
+.L74:
+	movl g0(%rip), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L68
+	jmp .L68
+.L83:
+.L84:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -72(%rbp)
+	movswl -72(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, %eax
+	jl .L79
+	jmp .L80
+.L99:
+.L100:
+	jmp .L68
+.L71:
+	cmpb $0, -74(%rbp)
+	je .L68
+	movl -56(%rbp), %eax
+	movw %ax, -70(%rbp)
+	movl $-39, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movzbl -75(%rbp), %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L87
+	jmp .L68
+.L117:
+	cmpq $47, %rax
+	je .L116
+	cmpq $62, %rax
+	je .L111
+	cmpq $318, %rax
+	je .L112
+	jmp .L115
+.L129:
+	movl $1000000007, %eax
+	movq %rax, %rdi
+	call f1
+.L130:
+	movl $973, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $256, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $395, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L128:
+	cmpl $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+	movb %al, -75(%rbp)
+.L115:
+	movabsq $853832672784, %rax
+	leaq 1(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $1, %rcx
+	movq %rcx, %rax
+	addq %rax, -40(%rbp)
+.L116:
+	movw $0, -70(%rbp)
+	movl -68(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl %eax, -16(%rbp)
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $16, %eax
+	jge .L132
+	.p2align 4,,10
+.L131:
+	cmpl $0, -16(%rbp)
+	jne .LB1
+.L133:
+.L134:
+	movl $6, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	je .L135
+	movslq g0(%rip), %rax
+	movabsq $13573340123, %rcx
+	subq %rcx, %rax
+	testq %rax, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -72(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -72(%rbp)
+.L139:
+.L140:
+.L136:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -70(%rbp)
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $16, %eax
+	jl .L131
+	jmp .L132
+.L135:
+	cmpb $0, -75(%rbp)
+	je .L137
+.L132:
+	movl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $256, %eax
+	subl %ecx, %eax
+	movw %ax, -72(%rbp)
+.L109:
+	movl $83, %eax
+	testl %eax, %eax
+	je .L141
+	movl $928, %eax
+	subl $5, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	jge .L143
+	movswq -72(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl $512, %eax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jle .L145
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movzbl g2(%rip), %eax
+	cmpq $873, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movabsq $668383451687, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	movl g0(%rip), %eax
+	movb %al, -74(%rbp)
+	jmp .L146
+.L141:
+	movl $9, %eax
+	movq %rax, %rdi
+	call f1
+	movl $10, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $716862100428, %rax
+	imulq $0, %rax, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -72(%rbp), %eax
+	addl %ecx, %eax
+	movzbl -75(%rbp), %eax
+	movsbq %al, %rax
+	cmpq -32(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	jmp .L142
+.L159:
+.L155:
+.L153:
+.L143:
+.L144:
+	movl $-58, %eax
+	movq %rax, %rdx
+	movl $787, %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movl -68(%rbp), %eax
+.L142:
+	movl $6, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movsbl g1(%rip), %ecx
+	addl %ecx, %eax
+	cmpl -68(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+.f2_return:
+	leave
+	ret
+.L137:
+.L138:
+	cmpb $0, -73(%rbp)
+	je .L139
+	jmp .L132
+.L145:
+	movsbl -76(%rbp), %eax
+	pushq %rax
+	movl $-98, %eax
+	pushq %rax
+	movswl -70(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movsbl g1(%rip), %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	addq $8, %rsp
+	movswl %ax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	call f0
+	movl $2, %eax
+	addl $890, %eax
+	movq %rax, %rcx
+	cmpl $6, -68(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+.L146:
+	movq $0, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $0, %rax
+	movq %rax, -8(%rbp)
+	cmpq $16, -32(%rbp)
+	jge .L148
+	.p2align 4,,10
+.L147:
+	cmpb $0, -76(%rbp)
+	je .L149
+.L148:
+	movl $65535, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L159
+	leaq .L160(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L155
+	# table target .L156
+	# table target .L154
+	# table target .L155
+	# table target .L157
+	# table target .L158
+	jmp *%rcx
+.L149:
+.L150:
+	cmpq $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -72(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -72(%rbp)
+	movl g0(%rip), %eax
+	addl $550, %eax
+	movq %rax, %rcx
+	movl $364, %eax
+	subl %ecx, %eax
+	je .L151
+	jmp .L148
+.L151:
+.L152:
+	addq $1, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jl .L147
+	jmp .L148
+.L89:
+.L90:
+.L85:
+.L86:
+	jmp .L68
+.L95:
+.L96:
+	cmpb $0, g1(%rip)
+	je .L97
+	jmp .L68
+.L75:
+	movw $0, -70(%rbp)
+	movl -48(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $17, %eax
+	jge .L102
+	.p2align 4,,10
+.L101:
+	movl $10, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	movb %al, -75(%rbp)
+	cmpw $0, -70(%rbp)
+	jne .L105
+	movl $6, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L106
+.L105:
+	movl $1, %eax
+.L106:
+	movslq %eax, %rax
+	cmpq %rax, -32(%rbp)
+	jge .L103
+	jmp .L102
+.L103:
+.L104:
+	cmpl $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpb $0, g2(%rip)
+	je .L107
+	movl $128, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L108
+.L107:
+	movl $0, %eax
+.L108:
+	popq %rcx
+	subl %ecx, %eax
+	movw %ax, -72(%rbp)
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -70(%rbp)
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $17, %eax
+	jl .L101
+	jmp .L102
+.L114:
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	imull g0(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cltd
+	idivl %ecx
+	pushq %rax
+	subq $8, %rsp
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	je .L127
+	cmpl $972, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movswl -72(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movsbq -73(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, %rsi
+	movsbl -73(%rbp), %eax
+	subl $616, %eax
+	movq %rax, %rdi
+	popq %rcx
+	call f0
+	movswl %ax, %eax
+	movl %eax, -68(%rbp)
+	jmp .L128
+.L112:
+	movq -40(%rbp), %rax
+	movw %ax, -72(%rbp)
+.L113:
+	movabsq $302350663587, %rax
+	testq %rax, %rax
+	je .L118
+	movl $-87, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movswl -72(%rbp), %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	jne .L120
+	movl $5, %eax
+	cmpl $564, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movslq -68(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subl $786, %eax
+	movq %rax, %rdi
+	popq %rdx
+	call f0.constprop.0
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $20, %eax
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	movb %al, -16(%rbp)
+	movq %rax, %rcx
+	movsbl -16(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -75(%rbp), %eax
+	movq %rax, %rsi
+	movsbl -74(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	call f0.constprop.1
+	movl -8(%rbp), %eax
+	addl g0(%rip), %eax
+	movw %ax, -70(%rbp)
+.L120:
+.L121:
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	jne .L124
+	movl $4294967295, %eax
+	imulq $3, %rax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movswl -72(%rbp), %eax
+	movq %rax, %rdx
+	movl $175, %eax
+	movq %rax, %rsi
+	movl $246, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswq %ax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	jge .L122
+.L124:
+	movl $6, %eax
+	movq %rax, %rdi
+	call f1
+	movl $230, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movl %eax, -68(%rbp)
+	cmpl $4, g0(%rip)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+.L123:
+	movq -32(%rbp), %rax
+	addq $6, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movb %al, -75(%rbp)
+	jmp .L119
+.L118:
+	movsbl -73(%rbp), %eax
+	movb %al, -75(%rbp)
+	movl $1, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+.L119:
+	movl $6, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $182, %eax
+	movq %rax, %rsi
+	movl $472, %eax
+	movq %rax, %rdi
+	call f0
+	movswq %ax, %rax
+	subq -40(%rbp), %rax
+	je .L109
+	xorl %eax, %eax
+	subl -52(%rbp), %eax
+	addl %eax, -68(%rbp)
+.L125:
+.L126:
+	jmp .L109
+.L87:
+.L88:
+	movabsq $184462172118, %rax
+	testq %rax, %rax
+	je .L68
+	jmp .L68
+.L111:
+	movq $32767, -32(%rbp)
+	jmp .L109
+.L127:
+	xorl %eax, %eax
+	movsbl -76(%rbp), %ecx
+	subl %ecx, %eax
+	je .L129
+	movl $-10, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movl $253, %eax
+	movq %rax, %rsi
+	movl $60, %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	movl %eax, -68(%rbp)
+	jmp .L130
+.L110:
+	movl $66, %eax
+	pushq %rax
+	movzbl -75(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movabsq $1034876702590, %rcx
+	subq %rcx, %rax
+	movq %rax, %rsi
+	movsbl -74(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	call f0
+	jmp .L109
+.L122:
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rdi
+	call f1
+	movsbl -76(%rbp), %eax
+	jmp .L123
+.L154:
+	movl $2, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movl $4, %eax
+	subl $2, %eax
+	cmpl $560, %eax
+	jne .LB2
+.L161:
+.L162:
+	jmp .L153
+.L156:
+	movabsq $839336043106, %rax
+	movsbq -76(%rbp), %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	jne .L163
+	movl $442, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L164
+.L163:
+	movl $0, %eax
+.L164:
+	movslq %eax, %rax
+	jmp .L153
+.L157:
+	movsbl -74(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	movzbl -75(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -70(%rbp)
+.L158:
+	cmpb $0, -74(%rbp)
+	je .L165
+	cmpw $0, -72(%rbp)
+	je .L167
+	movl $1, %eax
+	cmpl $6, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .f2_return
+.L165:
+.L166:
+	cmpw $0, -70(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movsbl -76(%rbp), %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subl $32767, %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L153
+.LB1:
+	movl $9, %eax
+	movq %rax, %rcx
+	movl $-82, %eax
+	movq %rax, %rdx
+	movzbl g2(%rip), %eax
+	movq %rax, %rsi
+	movl $289, %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	jmp .f2_return
+.LB0:
+	movl -68(%rbp), %eax
+	jmp .f2_return
+.L167:
+	movl $0, %eax
+.L168:
+	jmp .f2_return
+.LB2:
+	movsbl -73(%rbp), %eax
+	cmpl $256, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl $2622436956, %eax
+	setae %al
+	movzbl %al, %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L160:
+	.long .L156-.L160
+	.long .L154-.L160
+	.long .L155-.L160
+	.long .L155-.L160
+	.long .L155-.L160
+	.long .L155-.L160
+	.long .L157-.L160
+	.long .L155-.L160
+	.long .L158-.L160
+	.popsection
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $2, -8(%rbp)
+	jl .L171
+	cmpl $18, -8(%rbp)
+	jg .L171
+.L169:
+.L170:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L171:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movl $65536, -4(%rbp)
+	movl $5, -8(%rbp)
+	movb $7, -9(%rbp)
+	movl $256, -16(%rbp)
+	movq $0, -24(%rbp)
+	movl $0, -16(%rbp)
+	movl $0, -48(%rbp)
+	movl $3, -44(%rbp)
+	movl $6, -40(%rbp)
+	movl $9, -36(%rbp)
+	movl $4, -16(%rbp)
+	movl $546, %eax
+	movslq g0(%rip), %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	cmpl $977, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L172
+	cmpl $0, -4(%rbp)
+	je .L174
+	cmpl $0, -8(%rbp)
+	jne .L176
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L177
+.L176:
+	movl $0, %eax
+.L177:
+	addl %eax, -8(%rbp)
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+.L174:
+.L175:
+	movl -36(%rbp), %eax
+	testl %eax, %eax
+	je .L180
+	cmpl $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L181
+.L180:
+	movl $1, %eax
+.L181:
+	movq %rax, %rcx
+	cmpl $905, -16(%rbp)
+	setge %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jge .L178
+	movl -16(%rbp), %eax
+	movq %rax, %rdx
+	movl -48(%rbp), %eax
+	movq %rax, %rsi
+	movzbl -9(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	movq %rax, %rdx
+	movl g0(%rip), %eax
+	movq %rax, %rsi
+	movsbl g1(%rip), %eax
+	cmpl $268, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f2
+	movzbl -9(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	addl %eax, -4(%rbp)
+	movl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movslq g0(%rip), %rax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movq %rax, %rsi
+	movl $957, %eax
+	movq %rax, %rdi
+	popq %rdx
+	call f2
+	jmp .L179
+.L178:
+	movl g0(%rip), %eax
+	pushq %rax
+	movl -44(%rbp), %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $45, %eax
+	movq %rax, %rdx
+	movzbl -9(%rbp), %eax
+	movq %rax, %rsi
+	movzbl -9(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	addq $8, %rsp
+	movsbl %al, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	call f0
+.L179:
+	movzbl g2(%rip), %eax
+	cmpq -24(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+	jmp .L173
+.L172:
+	movl $1, -4(%rbp)
+	movl $4294967130, -52(%rbp)
+	movl $1, -56(%rbp)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -64(%rbp)
+	cmpl $17, -4(%rbp)
+	jge .L183
+	.p2align 4,,10
+.L182:
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	jne .L186
+	cmpl $0, -4(%rbp)
+	je .L184
+.L186:
+	movl -52(%rbp), %eax
+	testb %al, %al
+	je .L187
+.L183:
+.L173:
+	movsbl g1(%rip), %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	movl -4(%rbp), %eax
+	addl %eax, -4(%rbp)
+	movl $0, -8(%rbp)
+	movl $2, -68(%rbp)
+	xorl %eax, %eax
+	subl -16(%rbp), %eax
+	movl %eax, -72(%rbp)
+	movl $1, -76(%rbp)
+	movl $1, -80(%rbp)
+	cmpl $8, -8(%rbp)
+	jge .L203
+	.p2align 4,,10
+.L202:
+	movl -44(%rbp), %eax
+	cmpl %eax, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L204
+	movl $-53, %eax
+	movq %rax, %rdx
+	movl $57, %eax
+	movq %rax, %rsi
+	movslq -4(%rbp), %rax
+	movq %rax, %rdi
+	call f2
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -9(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $7, %rcx
+	ja .L212
+	leaq .L213(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L208
+	# table target .L211
+	# table target .L207
+	# table target .L210
+	# table target .L209
+	jmp *%rcx
+.L204:
+	cmpl $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movl g0(%rip), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L222
+	leaq .L230(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L222
+	# table target .L225
+	# table target .L223
+	# table target .L228
+	# table target .L227
+	# table target .L224
+	# table target .L226
+	jmp *%rcx
+.L212:
+.L208:
+	movzbl g2(%rip), %eax
+	movzbl g2(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $256, %eax
+	cltd
+	idivl %ecx
+	cmpl %eax, -68(%rbp)
+	jne .L214
+.L206:
+.L222:
+.L205:
+	addl $1, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jl .L202
+.L203:
+	movq -24(%rbp), %rax
+	addq $647, %rax
+	cmpq $1, %rax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $65536, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movl -48(%rbp), %ecx
+	imull %ecx, %eax
+	popq %rcx
+	imull %ecx, %eax
+	movl %eax, -8(%rbp)
+	movl -44(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $992, %eax
+	subl %ecx, %eax
+.f3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L229:
+	jmp .L222
+.L187:
+.L188:
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movl -40(%rbp), %eax
+	movl -36(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movslq g0(%rip), %rax
+	movabsq $874314122208, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	movabsq $450024959552, %rax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	movl %eax, -16(%rbp)
+.L184:
+.L185:
+	movl -8(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $0, -16(%rbp)
+	jne .L195
+	cmpl $0, -4(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L196
+.L195:
+	movl $1, %eax
+.L196:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $24, %rax
+	jge .L197
+	cmpq $0, %rax
+	je .L191
+	cmpq $1, %rax
+	je .L194
+	jmp .L189
+.L214:
+.L215:
+.L209:
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $670, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdx
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movzbl g2(%rip), %eax
+	testw %ax, %ax
+	je .L206
+	jmp .L206
+.L216:
+.L217:
+	jmp .L206
+.L197:
+	cmpq $24, %rax
+	je .L193
+	cmpq $26, %rax
+	je .L192
+	cmpq $34, %rax
+	je .L189
+	jmp .L189
+.L191:
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $952030074451, %rax
+	subq %rcx, %rax
+	movq %rax, %rdx
+	movl -56(%rbp), %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subl g0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f2
+	movsbl %al, %eax
+	movl %eax, -8(%rbp)
+.L192:
+.L189:
+	addl $1, -4(%rbp)
+	cmpl $17, -4(%rbp)
+	jl .L182
+	jmp .L183
+.L193:
+	movl g0(%rip), %eax
+	imull g0(%rip), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	cqo
+	idivq -64(%rbp)
+	cqo
+	idivq %rcx
+	pushq %rax
+	xorl %eax, %eax
+	movl -40(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movl %eax, -8(%rbp)
+	cmpl $0, g0(%rip)
+	jl .L189
+	cmpl $4, g0(%rip)
+	jge .L189
+	cmpl $5, g0(%rip)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+.L198:
+.L199:
+	jmp .L189
+.L194:
+	movl -16(%rbp), %eax
+	addl $4, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movslq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	subl %ecx, %eax
+	je .L189
+	jmp .L189
+.L190:
+	jmp .L189
+.L200:
+.L201:
+	jmp .L189
+.L207:
+	jmp .L206
+.L210:
+	movslq -72(%rbp), %rax
+	subq -24(%rbp), %rax
+	je .L218
+	jmp .L206
+.L218:
+.L219:
+	movl $10, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	movq %rax, %rdx
+	movzbl g2(%rip), %eax
+	movq %rax, %rsi
+	movl $4294967295, %eax
+	movq %rax, %rdi
+	call f0
+	pushq %rax
+	movl $-1, %eax
+	pushq %rax
+	movl -76(%rbp), %eax
+	movq %rax, %rsi
+	movzbl g2(%rip), %eax
+	movzbl g2(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movb %al, -9(%rbp)
+.L211:
+	cmpl $7, g0(%rip)
+	setle %al
+	movzbl %al, %eax
+	addl $10, %eax
+	je .L220
+	jmp .L206
+.L220:
+.L221:
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	cmpl -8(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -4(%rbp)
+	jmp .L206
+.L223:
+	movl -80(%rbp), %eax
+	addl %eax, -4(%rbp)
+.L224:
+	movl $748, -4(%rbp)
+	movl -40(%rbp), %eax
+	imull $788, %eax, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	jmp .L222
+.L225:
+	movzbl g2(%rip), %eax
+	movzbl g2(%rip), %ecx
+	addl %ecx, %eax
+	movzbl -9(%rbp), %ecx
+	addl %ecx, %eax
+	movq %rax, -24(%rbp)
+	jmp .L222
+.L226:
+	jmp .L222
+.L227:
+	movl $79, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $35, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	movslq -4(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rsi
+	movl $3676710748, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movswq %ax, %rax
+	movq %rax, -24(%rbp)
+	jmp .L222
+.L228:
+	jmp .L222
+	.size f3, .-f3
+	.pushsection .rodata
+	.p2align 2
+.L213:
+	.long .L211-.L213
+	.long .L208-.L213
+	.long .L207-.L213
+	.long .L208-.L213
+	.long .L208-.L213
+	.long .L210-.L213
+	.long .L208-.L213
+	.long .L209-.L213
+	.p2align 2
+.L230:
+	.long .L225-.L230
+	.long .L222-.L230
+	.long .L223-.L230
+	.long .L222-.L230
+	.long .L228-.L230
+	.long .L227-.L230
+	.long .L224-.L230
+	.long .L224-.L230
+	.long .L222-.L230
+	.long .L226-.L230
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq $263, -8(%rbp)
+	movw $523, -10(%rbp)
+	movl $3, -16(%rbp)
+	movl $643646315, -20(%rbp)
+	movl $822, -24(%rbp)
+	movabsq $1046570623804, %rax
+	movq %rax, -32(%rbp)
+	movl $0, -24(%rbp)
+	movl $0, -48(%rbp)
+	movl $9, -44(%rbp)
+	movl $18, -40(%rbp)
+	movl $27, -36(%rbp)
+	movl $4, -24(%rbp)
+	movzwl -10(%rbp), %eax
+	movl %eax, -52(%rbp)
+	imull -52(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	imull $479, -52(%rbp), %eax
+	cltd
+	idivl %ecx
+	movl %eax, -16(%rbp)
+	movzwl -10(%rbp), %eax
+	imulq -32(%rbp), %rax
+	testq %rax, %rax
+	je .L231
+	cmpl $639, -20(%rbp)
+	jbe .L233
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L234
+.L233:
+	movl $0, %eax
+.L234:
+	movl %eax, -24(%rbp)
+.L249:
+.L250:
+.L241:
+.L232:
+	movl $1, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jge .L251
+	movl $16, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -64(%rbp)
+	cmpq $0, -64(%rbp)
+	je .L254
+	.p2align 4,,10
+.L253:
+	call f3
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	addl $1, -24(%rbp)
+	call f3
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	addl $1, -24(%rbp)
+	call f3
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	addl $1, -24(%rbp)
+	call f3
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	addl $1, -24(%rbp)
+	subq $1, -64(%rbp)
+	jne .L253
+.L254:
+.L251:
+.L252:
+	cmpl $16, -24(%rbp)
+	jge .L256
+	.p2align 4,,10
+.L255:
+	call f3
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	addl $1, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jl .L255
+.L256:
+	movl $0, -24(%rbp)
+	movl $923, g0(%rip)
+	movq $96, -8(%rbp)
+	movl $923, g0(%rip)
+	movq $96, -8(%rbp)
+	movl $923, g0(%rip)
+	movq $96, -8(%rbp)
+	movl $923, g0(%rip)
+	movq $96, -8(%rbp)
+	movl $923, g0(%rip)
+	movq $96, -8(%rbp)
+	movl $923, g0(%rip)
+	movq $96, -8(%rbp)
+	movl $923, g0(%rip)
+	movq $96, -8(%rbp)
+	movl $923, g0(%rip)
+	movq $96, -8(%rbp)
+	movl $8, -24(%rbp)
+	xorl %eax, %eax
+	subl g0(%rip), %eax
+	movl %eax, -68(%rbp)
+	movl -52(%rbp), %eax
+	movl %eax, -72(%rbp)
+	cmpl $2, -68(%rbp)
+	jl .L260
+	cmpl $18, -68(%rbp)
+	jle .L258
+.L260:
+	movl -72(%rbp), %eax
+	addl -68(%rbp), %eax
+.L257:
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movsbl g1(%rip), %eax
+	addl -20(%rbp), %eax
+	jne .L269
+	movabsq $737885173562, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L270
+.L269:
+	movl $1, %eax
+.L270:
+	movb %al, g2(%rip)
+	movq -32(%rbp), %rax
+	addq $2, %rax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movq %rax, -96(%rbp)
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -48(%rbp)
+	movl -52(%rbp), %eax
+	addl $-2147483647, %eax
+	movw %ax, -10(%rbp)
+	movq $0, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movsbq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movzbl g2(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movzwl -10(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movl -20(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	addq -96(%rbp), %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -104(%rbp)
+	movl $0, -24(%rbp)
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movl $4, -24(%rbp)
+	movq -104(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -104(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -104(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movq -104(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L231:
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	cmpq $0, -32(%rbp)
+	jne .L237
+	movl $54, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L238
+.L237:
+	movl $1, %eax
+.L238:
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	je .L235
+	imull $3, g0(%rip), %eax
+	addl $4, %eax
+	movl %eax, g0(%rip)
+	imull $3, g0(%rip), %eax
+	addl $4, %eax
+	movl %eax, g0(%rip)
+	movzbl g2(%rip), %eax
+	imull $3, %eax, %eax
+	addl $4, %eax
+	movb %al, g2(%rip)
+.L239:
+	imull $3, g0(%rip), %eax
+	addl $5, %eax
+	movl %eax, g0(%rip)
+	imull $3, g0(%rip), %eax
+	addl $5, %eax
+	movl %eax, g0(%rip)
+	movzbl g2(%rip), %eax
+	imull $3, %eax, %eax
+	addl $5, %eax
+	movb %al, g2(%rip)
+.L240:
+.L235:
+.L236:
+	movl -16(%rbp), %eax
+	cmpl -52(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L243
+	cmpq $7, %rax
+	je .L244
+	cmpq $10, %rax
+	je .L242
+	jmp .L241
+.L242:
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $8, %rax
+	movb %al, g1(%rip)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $8, %rax
+	movb %al, g1(%rip)
+.L245:
+	movl g0(%rip), %eax
+	imull g0(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	cltd
+	idivl %ecx
+	movl %eax, -16(%rbp)
+.L243:
+	movzwl -10(%rbp), %eax
+	movb %al, -53(%rbp)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $7, %rax
+	movb %al, g1(%rip)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $7, %rax
+	movb %al, g1(%rip)
+.L246:
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	jmp .L241
+.L258:
+.L259:
+	movl -68(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -76(%rbp)
+	imull $3, -72(%rbp), %eax
+	addl -68(%rbp), %eax
+	movl %eax, -80(%rbp)
+	cmpl $2, -76(%rbp)
+	jl .L264
+	cmpl $18, -76(%rbp)
+	jle .L262
+.L264:
+	movl -80(%rbp), %eax
+	addl -76(%rbp), %eax
+.L261:
+	jmp .L257
+.L244:
+	call f3
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	jne .LB3
+.L247:
+.L248:
+	cmpl $0, -16(%rbp)
+	jl .L249
+	cmpl $4, -16(%rbp)
+	jge .L249
+	movslq -16(%rbp), %rax
+	movl $128, -48(%rbp,%rax,4)
+	jmp .L250
+.L262:
+.L263:
+	movl -76(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -84(%rbp)
+	imull $3, -80(%rbp), %eax
+	addl -76(%rbp), %eax
+	movl %eax, -88(%rbp)
+	cmpl $2, -84(%rbp)
+	jl .L268
+	cmpl $18, -84(%rbp)
+	jle .L266
+.L268:
+	movl -88(%rbp), %eax
+	addl -84(%rbp), %eax
+.L265:
+	jmp .L257
+.L266:
+.L267:
+	imull $3, -88(%rbp), %eax
+	addl -84(%rbp), %eax
+	movq %rax, %rsi
+	movl -84(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L257
+.LB3:
+	cmpq $8, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	cmpl %eax, -24(%rbp)
+	setge %al
+	movzbl %al, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
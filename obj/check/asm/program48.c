@@ -0,0 +1,75 @@
+int ga0[16];
+int rec(int n, int acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 4, acc);
+}
+int main() {
+    unsigned long v0 = 2;
+    unsigned int v1 = 6;
+    short v2 = 128;
+    int i0 = 8;
+    long j0 = 0;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 593; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 836945904449; }
+    v1 = 4ul;
+    v1 = 97;
+    rec(rec(i0, 65536), (2 / 13ul));
+    switch (i0) {
+    case 0:
+        if (j0 >= 0 && j0 < 16) { la0[j0] = ((v1 != 1000000007) && i0); }
+        i0 = rec((i0 + 1), 1000000007);
+        break;
+    default:
+        break;
+    case 3:
+        v0 = v0 + ((unsigned char)(i0) - (3 >= 777L));
+        break;
+    case 9:
+        i0 = (143 == 939);
+        j0 = 6L;
+    case 4:
+        if (((236 < 601) && rec(v2, 1000000007))) {
+            for (j0 = 1; j0 < 17; j0 = j0 + 1) {
+                v2 = (((v0 + 259) + j0) / 4);
+            }
+        } else {
+            if ((!(v1) >= (9 != j0))) {
+                j0 = (rec(v1, ga0[6]) <= j0);
+                rec((i0 && v2), rec(4, 6));
+                rec(183, 732115507135L);
+            } else {
+                rec((715 - v2), ga0[0]);
+                v1 = rec((6 / 7), (v1 != i0));
+            }
+        }
+        switch (((ga0[4] + 2) != 0ul)) {
+        case 53:
+            v1 = (3 > (-(v2) <= (j0 >= la1[0])));
+            break;
+        default:
+            break;
+        case -3:
+            if ((rec(i0, 8) == ((ga0[3] || 42) / 3u))) {
+                rec(65536, (v0 + 369610613330));
+            }
+            for (v1 = 0; v1 < 5; v1 = v1 + 1) {
+                if (i0) { break; }
+                if (rec(205, i0)) { break; }
+                v2 = (ga0[14] <= j0);
+            }
+        }
+    }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,5502 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.section .text
+	.type rec, @function
+	.type rec.constprop.0, @function
+	.type rec.constprop.2, @function
+	.type rec.constprop.1, @function
+	.type rec.constprop.3, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	cmpl $2, %edi
+	jl .L2
+	cmpl $18, %edi
+	jg .L2
+.L0:
+.L1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movl %edi, -32(%rbp)
+	movl %esi, -28(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -24(%rbp)
+	movl %esi, %eax
+	movl %eax, -20(%rbp)
+	cmpl $2, -24(%rbp)
+	jl .L6
+	cmpl $18, -24(%rbp)
+	jle .L4
+.L6:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L3:
+	pushq %rax
+	movl -32(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -24(%rbp)
+	movl -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -20(%rbp)
+	cmpl $2, -24(%rbp)
+	jl .L34
+	cmpl $18, -24(%rbp)
+	jle .L32
+.L34:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L31:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L4:
+.L5:
+	movl -24(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -16(%rbp)
+	jl .L10
+	cmpl $18, -16(%rbp)
+	jle .L8
+.L10:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L7:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -16(%rbp)
+	jl .L22
+	cmpl $18, -16(%rbp)
+	jle .L20
+.L22:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L19:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L3
+.L32:
+.L33:
+	movl -24(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -16(%rbp)
+	jl .L38
+	cmpl $18, -16(%rbp)
+	jle .L36
+.L38:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L35:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -16(%rbp)
+	jl .L50
+	cmpl $18, -16(%rbp)
+	jle .L48
+.L50:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L47:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L31
+.L8:
+.L9:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L14
+	cmpl $18, -8(%rbp)
+	jle .L12
+.L14:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L11:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L18
+	cmpl $18, -8(%rbp)
+	jle .L16
+.L18:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L15:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L7
+.L20:
+.L21:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L26
+	cmpl $18, -8(%rbp)
+	jle .L24
+.L26:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L23:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L30
+	cmpl $18, -8(%rbp)
+	jle .L28
+.L30:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L27:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L19
+.L36:
+.L37:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L42
+	cmpl $18, -8(%rbp)
+	jle .L40
+.L42:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L39:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L46
+	cmpl $18, -8(%rbp)
+	jle .L44
+.L46:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L43:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L35
+.L48:
+.L49:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L54
+	cmpl $18, -8(%rbp)
+	jle .L52
+.L54:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L51:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L58
+	cmpl $18, -8(%rbp)
+	jle .L56
+.L58:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L55:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L47
+.L12:
+.L13:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L11
+.L16:
+.L17:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L15
+.L24:
+.L25:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L23
+.L28:
+.L29:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L27
+.L40:
+.L41:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L39
+.L44:
+.L45:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L43
+.L52:
+.L53:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L51
+.L56:
+.L57:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L55
+.L2:
+	movl %esi, %eax
+	addl %edi, %eax
+	ret
+	.size rec, .-rec
+	.align 16
+rec.constprop.0:
+	cmpl $2, %edi
+	jl .L61
+	cmpl $18, %edi
+	jg .L61
+.L59:
+.L60:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -12(%rbp)
+	jl .L65
+	cmpl $18, -12(%rbp)
+	jle .L63
+.L65:
+	movl -12(%rbp), %eax
+	addl $1000000007, %eax
+.L62:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -12(%rbp)
+	jl .L93
+	cmpl $18, -12(%rbp)
+	jle .L91
+.L93:
+	movl -12(%rbp), %eax
+	addl $1000000008, %eax
+.L90:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L63:
+.L64:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L69
+	cmpl $18, -8(%rbp)
+	jle .L67
+.L69:
+	movl -8(%rbp), %eax
+	addl $1000000007, %eax
+.L66:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L81
+	cmpl $18, -8(%rbp)
+	jle .L79
+.L81:
+	movl -8(%rbp), %eax
+	addl $1000000008, %eax
+.L78:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L62
+.L91:
+.L92:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L97
+	cmpl $18, -8(%rbp)
+	jle .L95
+.L97:
+	movl -8(%rbp), %eax
+	addl $1000000008, %eax
+.L94:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $1000000008, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -16(%rbp)
+	jl .L109
+	cmpl $18, -16(%rbp)
+	jle .L107
+.L109:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L106:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L90
+.L67:
+.L68:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L73
+	cmpl $18, -4(%rbp)
+	jle .L71
+.L73:
+	movl -4(%rbp), %eax
+	addl $1000000007, %eax
+.L70:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L77
+	cmpl $18, -4(%rbp)
+	jle .L75
+.L77:
+	movl -4(%rbp), %eax
+	addl $1000000008, %eax
+.L74:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L66
+.L79:
+.L80:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L85
+	cmpl $18, -4(%rbp)
+	jle .L83
+.L85:
+	movl -4(%rbp), %eax
+	addl $1000000008, %eax
+.L82:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $1000000008, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L89
+	cmpl $18, -8(%rbp)
+	jle .L87
+.L89:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L86:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L78
+.L95:
+.L96:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L101
+	cmpl $18, -4(%rbp)
+	jle .L99
+.L101:
+	movl -4(%rbp), %eax
+	addl $1000000008, %eax
+.L98:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $1000000008, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L105
+	cmpl $18, -8(%rbp)
+	jle .L103
+.L105:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L102:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L94
+.L107:
+.L108:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L113
+	cmpl $18, -8(%rbp)
+	jle .L111
+.L113:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L110:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L117
+	cmpl $18, -8(%rbp)
+	jle .L115
+.L117:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L114:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L106
+.L71:
+.L72:
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.0
+	pushq %rax
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L70
+.L75:
+.L76:
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1000000008, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L74
+.L83:
+.L84:
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1000000008, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L82
+.L87:
+.L88:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L86
+.L99:
+.L100:
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1000000008, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L98
+.L103:
+.L104:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L102
+.L111:
+.L112:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L110
+.L115:
+.L116:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L114
+.L61:
+	movl %edi, %eax
+	addl $1000000007, %eax
+	ret
+	.size rec.constprop.0, .-rec.constprop.0
+	.align 16
+rec.constprop.2:
+	cmpl $2, %edi
+	jl .L120
+	cmpl $18, %edi
+	jg .L120
+.L118:
+.L119:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -12(%rbp)
+	jl .L124
+	cmpl $18, -12(%rbp)
+	jle .L122
+.L124:
+	movl -12(%rbp), %eax
+.L121:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -12(%rbp)
+	jl .L152
+	cmpl $18, -12(%rbp)
+	jle .L150
+.L152:
+	movl -12(%rbp), %eax
+	addl $1, %eax
+.L149:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L122:
+.L123:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L128
+	cmpl $18, -8(%rbp)
+	jle .L126
+.L128:
+	movl -8(%rbp), %eax
+.L125:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L140
+	cmpl $18, -8(%rbp)
+	jle .L138
+.L140:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+.L137:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L121
+.L150:
+.L151:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L156
+	cmpl $18, -8(%rbp)
+	jle .L154
+.L156:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+.L153:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $1, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -16(%rbp)
+	jl .L168
+	cmpl $18, -16(%rbp)
+	jle .L166
+.L168:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L165:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L149
+.L126:
+.L127:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L132
+	cmpl $18, -4(%rbp)
+	jle .L130
+.L132:
+	movl -4(%rbp), %eax
+.L129:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L136
+	cmpl $18, -4(%rbp)
+	jle .L134
+.L136:
+	movl -4(%rbp), %eax
+	addl $1, %eax
+.L133:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L125
+.L138:
+.L139:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L144
+	cmpl $18, -4(%rbp)
+	jle .L142
+.L144:
+	movl -4(%rbp), %eax
+	addl $1, %eax
+.L141:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $1, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L148
+	cmpl $18, -8(%rbp)
+	jle .L146
+.L148:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L145:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L137
+.L154:
+.L155:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L160
+	cmpl $18, -4(%rbp)
+	jle .L158
+.L160:
+	movl -4(%rbp), %eax
+	addl $1, %eax
+.L157:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $1, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L164
+	cmpl $18, -8(%rbp)
+	jle .L162
+.L164:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L161:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L153
+.L166:
+.L167:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L172
+	cmpl $18, -8(%rbp)
+	jle .L170
+.L172:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L169:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L176
+	cmpl $18, -8(%rbp)
+	jle .L174
+.L176:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L173:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L165
+.L130:
+.L131:
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.2
+	pushq %rax
+	subq $8, %rsp
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L129
+.L134:
+.L135:
+	subq $8, %rsp
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L133
+.L142:
+.L143:
+	subq $8, %rsp
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L141
+.L146:
+.L147:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L145
+.L158:
+.L159:
+	subq $8, %rsp
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L157
+.L162:
+.L163:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L161
+.L170:
+.L171:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L169
+.L174:
+.L175:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L173
+.L120:
+	movl %edi, %eax
+	ret
+	.size rec.constprop.2, .-rec.constprop.2
+	.align 16
+rec.constprop.1:
+	cmpl $2, %edi
+	jl .L179
+	cmpl $18, %edi
+	jg .L179
+.L177:
+.L178:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -12(%rbp)
+	jl .L183
+	cmpl $18, -12(%rbp)
+	jle .L181
+.L183:
+	movl -12(%rbp), %eax
+	addl $65536, %eax
+.L180:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -12(%rbp)
+	jl .L211
+	cmpl $18, -12(%rbp)
+	jle .L209
+.L211:
+	movl -12(%rbp), %eax
+	addl $65537, %eax
+.L208:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L181:
+.L182:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L187
+	cmpl $18, -8(%rbp)
+	jle .L185
+.L187:
+	movl -8(%rbp), %eax
+	addl $65536, %eax
+.L184:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L199
+	cmpl $18, -8(%rbp)
+	jle .L197
+.L199:
+	movl -8(%rbp), %eax
+	addl $65537, %eax
+.L196:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L180
+.L209:
+.L210:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L215
+	cmpl $18, -8(%rbp)
+	jle .L213
+.L215:
+	movl -8(%rbp), %eax
+	addl $65537, %eax
+.L212:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -16(%rbp)
+	jl .L227
+	cmpl $18, -16(%rbp)
+	jle .L225
+.L227:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L224:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L208
+.L185:
+.L186:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L191
+	cmpl $18, -4(%rbp)
+	jle .L189
+.L191:
+	movl -4(%rbp), %eax
+	addl $65536, %eax
+.L188:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L195
+	cmpl $18, -4(%rbp)
+	jle .L193
+.L195:
+	movl -4(%rbp), %eax
+	addl $65537, %eax
+.L192:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L184
+.L197:
+.L198:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L203
+	cmpl $18, -4(%rbp)
+	jle .L201
+.L203:
+	movl -4(%rbp), %eax
+	addl $65537, %eax
+.L200:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L207
+	cmpl $18, -8(%rbp)
+	jle .L205
+.L207:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L204:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L196
+.L213:
+.L214:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L219
+	cmpl $18, -4(%rbp)
+	jle .L217
+.L219:
+	movl -4(%rbp), %eax
+	addl $65537, %eax
+.L216:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L223
+	cmpl $18, -8(%rbp)
+	jle .L221
+.L223:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L220:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L212
+.L225:
+.L226:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L231
+	cmpl $18, -8(%rbp)
+	jle .L229
+.L231:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L228:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L235
+	cmpl $18, -8(%rbp)
+	jle .L233
+.L235:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L232:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L224
+.L189:
+.L190:
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.1
+	pushq %rax
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L188
+.L193:
+.L194:
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $65537, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L192
+.L201:
+.L202:
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $65537, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L200
+.L205:
+.L206:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L204
+.L217:
+.L218:
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $65537, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L216
+.L221:
+.L222:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L220
+.L229:
+.L230:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L228
+.L233:
+.L234:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L232
+.L179:
+	movl %edi, %eax
+	addl $65536, %eax
+	ret
+	.size rec.constprop.1, .-rec.constprop.1
+	.align 16
+rec.constprop.3:
+	cmpl $2, %edi
+	jl .L238
+	cmpl $18, %edi
+	jg .L238
+.L236:
+.L237:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -12(%rbp)
+	jl .L242
+	cmpl $18, -12(%rbp)
+	jle .L240
+.L242:
+	movl -12(%rbp), %eax
+	addl $28, %eax
+.L239:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -12(%rbp)
+	jl .L270
+	cmpl $18, -12(%rbp)
+	jle .L268
+.L270:
+	movl -12(%rbp), %eax
+	addl $29, %eax
+.L267:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L240:
+.L241:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L246
+	cmpl $18, -8(%rbp)
+	jle .L244
+.L246:
+	movl -8(%rbp), %eax
+	addl $28, %eax
+.L243:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L258
+	cmpl $18, -8(%rbp)
+	jle .L256
+.L258:
+	movl -8(%rbp), %eax
+	addl $29, %eax
+.L255:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L239
+.L268:
+.L269:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L274
+	cmpl $18, -8(%rbp)
+	jle .L272
+.L274:
+	movl -8(%rbp), %eax
+	addl $29, %eax
+.L271:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $29, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, -16(%rbp)
+	jl .L286
+	cmpl $18, -16(%rbp)
+	jle .L284
+.L286:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L283:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L267
+.L244:
+.L245:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L250
+	cmpl $18, -4(%rbp)
+	jle .L248
+.L250:
+	movl -4(%rbp), %eax
+	addl $28, %eax
+.L247:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L254
+	cmpl $18, -4(%rbp)
+	jle .L252
+.L254:
+	movl -4(%rbp), %eax
+	addl $29, %eax
+.L251:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L243
+.L256:
+.L257:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L262
+	cmpl $18, -4(%rbp)
+	jle .L260
+.L262:
+	movl -4(%rbp), %eax
+	addl $29, %eax
+.L259:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $29, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L266
+	cmpl $18, -8(%rbp)
+	jle .L264
+.L266:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L263:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L255
+.L272:
+.L273:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -4(%rbp)
+	jl .L278
+	cmpl $18, -4(%rbp)
+	jle .L276
+.L278:
+	movl -4(%rbp), %eax
+	addl $29, %eax
+.L275:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $29, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L282
+	cmpl $18, -8(%rbp)
+	jle .L280
+.L282:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L279:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L271
+.L284:
+.L285:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L290
+	cmpl $18, -8(%rbp)
+	jle .L288
+.L290:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L287:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $2, -8(%rbp)
+	jl .L294
+	cmpl $18, -8(%rbp)
+	jle .L292
+.L294:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L291:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L283
+.L248:
+.L249:
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.3
+	pushq %rax
+	subq $8, %rsp
+	movl $29, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L247
+.L252:
+.L253:
+	subq $8, %rsp
+	movl $29, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $29, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L251
+.L260:
+.L261:
+	subq $8, %rsp
+	movl $29, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $29, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L259
+.L264:
+.L265:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L263
+.L276:
+.L277:
+	subq $8, %rsp
+	movl $29, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $29, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L275
+.L280:
+.L281:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L279
+.L288:
+.L289:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L287
+.L292:
+.L293:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L291
+.L238:
+	movl %edi, %eax
+	addl $28, %eax
+	ret
+	.size rec.constprop.3, .-rec.constprop.3
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $928, %rsp
+	movq $2, -8(%rbp)
+	movl $6, -12(%rbp)
+	movw $128, -14(%rbp)
+	movl $8, -20(%rbp)
+	movq $0, -32(%rbp)
+	movl $0, -20(%rbp)
+	imull $593, -20(%rbp), %eax
+	subl $593, %eax
+	movl %eax, -100(%rbp)
+	cmpl $16, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -104(%rbp)
+	testl %eax, %eax
+	je .L295
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L298
+	.p2align 4,,10
+.L297:
+	addl $593, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $593, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $593, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $593, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -112(%rbp)
+	jne .L297
+.L298:
+.L295:
+.L296:
+	cmpl $16, -20(%rbp)
+	jge .L300
+	.p2align 4,,10
+.L299:
+	addl $593, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L299
+.L300:
+	movl $0, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -148(%rbp)
+	testl %eax, %eax
+	je .L301
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L304
+	.p2align 4,,10
+.L303:
+	movslq -20(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movabsq $836945904449, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -168(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movabsq $836945904449, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -176(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movq %rax, -184(%rbp)
+	movabsq $836945904449, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -184(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $836945904449, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -160(%rbp)
+	jne .L303
+.L304:
+.L301:
+.L302:
+	cmpl $8, -20(%rbp)
+	jge .L306
+	.p2align 4,,10
+.L305:
+	movslq -20(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $836945904449, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L305
+.L306:
+	movl $4, -12(%rbp)
+	movl $97, -12(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -208(%rbp)
+	cmpl $2, -208(%rbp)
+	jl .L311
+	cmpl $18, -208(%rbp)
+	jle .L309
+.L311:
+	movl -208(%rbp), %eax
+	addl $65536, %eax
+.L308:
+	movl %eax, -204(%rbp)
+	cmpl $2, -204(%rbp)
+	jl .L434
+	cmpl $18, -204(%rbp)
+	jle .L432
+.L434:
+	movl -204(%rbp), %eax
+.L307:
+	movl -20(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L465
+	leaq .L466(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L461
+	# table target .L460
+	# table target .L462
+	# table target .L464
+	# table target .L463
+	jmp *%rcx
+.L465:
+.L461:
+.L744:
+.L679:
+.L459:
+	movq $0, -896(%rbp)
+	imulq $31, -896(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -896(%rbp)
+	imulq $31, -896(%rbp), %rax
+	movl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	imulq $31, -896(%rbp), %rax
+	movswq -14(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	imulq $31, -896(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	imulq $31, -896(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -896(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $0, -104(%rbp)
+	je .L777
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -904(%rbp)
+	cmpq $0, -904(%rbp)
+	je .L780
+	.p2align 4,,10
+.L779:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -904(%rbp)
+	jne .L779
+.L780:
+.L777:
+.L778:
+	cmpl $16, -20(%rbp)
+	jge .L782
+	.p2align 4,,10
+.L781:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L781
+.L782:
+	movl $0, -20(%rbp)
+	cmpl $0, -104(%rbp)
+	je .L783
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -912(%rbp)
+	cmpq $0, -912(%rbp)
+	je .L786
+	.p2align 4,,10
+.L785:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -912(%rbp)
+	jne .L785
+.L786:
+.L783:
+.L784:
+	cmpl $16, -20(%rbp)
+	jge .L788
+	.p2align 4,,10
+.L787:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L787
+.L788:
+	movl $0, -20(%rbp)
+	cmpl $0, -148(%rbp)
+	je .L789
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -920(%rbp)
+	cmpq $0, -920(%rbp)
+	je .L792
+	.p2align 4,,10
+.L791:
+	movslq -20(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -920(%rbp)
+	jne .L791
+.L792:
+.L789:
+.L790:
+	cmpl $8, -20(%rbp)
+	jge .L794
+	.p2align 4,,10
+.L793:
+	movslq -20(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -896(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L793
+.L794:
+	movq -896(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -896(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -896(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -896(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -896(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -896(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -896(%rbp)
+	movq -896(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L309:
+.L310:
+	movl -208(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -316(%rbp)
+	cmpl $2, -316(%rbp)
+	jl .L315
+	cmpl $18, -316(%rbp)
+	jle .L313
+.L315:
+	movl -316(%rbp), %eax
+	addl $65536, %eax
+.L312:
+	pushq %rax
+	movl -208(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -212(%rbp)
+	cmpl $2, -212(%rbp)
+	jl .L375
+	cmpl $18, -212(%rbp)
+	jle .L373
+.L375:
+	movl -212(%rbp), %eax
+	addl $65537, %eax
+.L372:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L308
+.L432:
+.L433:
+	movl -204(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -412(%rbp)
+	cmpl $2, -412(%rbp)
+	jl .L438
+	cmpl $18, -412(%rbp)
+	jle .L436
+.L438:
+	movl -412(%rbp), %eax
+.L435:
+	pushq %rax
+	movl -204(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -396(%rbp)
+	cmpl $2, -396(%rbp)
+	jl .L450
+	cmpl $18, -396(%rbp)
+	jle .L448
+.L450:
+	movl -396(%rbp), %eax
+	addl $1, %eax
+.L447:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L307
+.L313:
+.L314:
+	movl -316(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -364(%rbp)
+	cmpl $2, -364(%rbp)
+	jl .L319
+	cmpl $18, -364(%rbp)
+	jle .L317
+.L319:
+	movl -364(%rbp), %eax
+	addl $65536, %eax
+.L316:
+	pushq %rax
+	movl -316(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -320(%rbp)
+	cmpl $2, -320(%rbp)
+	jl .L347
+	cmpl $18, -320(%rbp)
+	jle .L345
+.L347:
+	movl -320(%rbp), %eax
+	addl $65537, %eax
+.L344:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L312
+.L373:
+.L374:
+	movl -212(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -272(%rbp)
+	cmpl $2, -272(%rbp)
+	jl .L379
+	cmpl $18, -272(%rbp)
+	jle .L377
+.L379:
+	movl -272(%rbp), %eax
+	addl $65537, %eax
+.L376:
+	pushq %rax
+	movl -212(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -216(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -220(%rbp)
+	cmpl $2, -216(%rbp)
+	jl .L407
+	cmpl $18, -216(%rbp)
+	jle .L405
+.L407:
+	movl -220(%rbp), %eax
+	addl -216(%rbp), %eax
+.L404:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L372
+.L436:
+.L437:
+	movl -412(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -420(%rbp)
+	cmpl $2, -420(%rbp)
+	jl .L442
+	cmpl $18, -420(%rbp)
+	jle .L440
+.L442:
+	movl -420(%rbp), %eax
+.L439:
+	pushq %rax
+	movl -412(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -416(%rbp)
+	cmpl $2, -416(%rbp)
+	jl .L446
+	cmpl $18, -416(%rbp)
+	jle .L444
+.L446:
+	movl -416(%rbp), %eax
+	addl $1, %eax
+.L443:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L435
+.L448:
+.L449:
+	movl -396(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -408(%rbp)
+	cmpl $2, -408(%rbp)
+	jl .L454
+	cmpl $18, -408(%rbp)
+	jle .L452
+.L454:
+	movl -408(%rbp), %eax
+	addl $1, %eax
+.L451:
+	pushq %rax
+	movl -396(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -400(%rbp)
+	movl $1, %eax
+	addl $1, %eax
+	movl %eax, -404(%rbp)
+	cmpl $2, -400(%rbp)
+	jl .L458
+	cmpl $18, -400(%rbp)
+	jle .L456
+.L458:
+	movl -404(%rbp), %eax
+	addl -400(%rbp), %eax
+.L455:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L447
+.L317:
+.L318:
+	movl -364(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -384(%rbp)
+	cmpl $2, -384(%rbp)
+	jl .L323
+	cmpl $18, -384(%rbp)
+	jle .L321
+.L323:
+	movl -384(%rbp), %eax
+	addl $65536, %eax
+.L320:
+	pushq %rax
+	movl -364(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -368(%rbp)
+	cmpl $2, -368(%rbp)
+	jl .L335
+	cmpl $18, -368(%rbp)
+	jle .L333
+.L335:
+	movl -368(%rbp), %eax
+	addl $65537, %eax
+.L332:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L316
+.L345:
+.L346:
+	movl -320(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -348(%rbp)
+	cmpl $2, -348(%rbp)
+	jl .L351
+	cmpl $18, -348(%rbp)
+	jle .L349
+.L351:
+	movl -348(%rbp), %eax
+	addl $65537, %eax
+.L348:
+	pushq %rax
+	movl -320(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -324(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -328(%rbp)
+	cmpl $2, -324(%rbp)
+	jl .L363
+	cmpl $18, -324(%rbp)
+	jle .L361
+.L363:
+	movl -328(%rbp), %eax
+	addl -324(%rbp), %eax
+.L360:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L344
+.L377:
+.L378:
+	movl -272(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -300(%rbp)
+	cmpl $2, -300(%rbp)
+	jl .L383
+	cmpl $18, -300(%rbp)
+	jle .L381
+.L383:
+	movl -300(%rbp), %eax
+	addl $65537, %eax
+.L380:
+	pushq %rax
+	movl -272(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -276(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -280(%rbp)
+	cmpl $2, -276(%rbp)
+	jl .L395
+	cmpl $18, -276(%rbp)
+	jle .L393
+.L395:
+	movl -280(%rbp), %eax
+	addl -276(%rbp), %eax
+.L392:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L376
+.L405:
+.L406:
+	movl -216(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -248(%rbp)
+	movl -220(%rbp), %eax
+	movl %eax, -252(%rbp)
+	cmpl $2, -248(%rbp)
+	jl .L411
+	cmpl $18, -248(%rbp)
+	jle .L409
+.L411:
+	movl -252(%rbp), %eax
+	addl -248(%rbp), %eax
+.L408:
+	pushq %rax
+	movl -216(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -224(%rbp)
+	movl -220(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -228(%rbp)
+	cmpl $2, -224(%rbp)
+	jl .L423
+	cmpl $18, -224(%rbp)
+	jle .L421
+.L423:
+	movl -228(%rbp), %eax
+	addl -224(%rbp), %eax
+.L420:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L404
+.L440:
+.L441:
+	movl -420(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.2
+	pushq %rax
+	subq $8, %rsp
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -420(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L439
+.L444:
+.L445:
+	subq $8, %rsp
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -416(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -416(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L443
+.L452:
+.L453:
+	subq $8, %rsp
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -408(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -408(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L451
+.L456:
+.L457:
+	movl -404(%rbp), %eax
+	movq %rax, %rsi
+	movl -400(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -404(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -400(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L455
+.L321:
+.L322:
+	movl -384(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -392(%rbp)
+	cmpl $2, -392(%rbp)
+	jl .L327
+	cmpl $18, -392(%rbp)
+	jle .L325
+.L327:
+	movl -392(%rbp), %eax
+	addl $65536, %eax
+.L324:
+	pushq %rax
+	movl -384(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -388(%rbp)
+	cmpl $2, -388(%rbp)
+	jl .L331
+	cmpl $18, -388(%rbp)
+	jle .L329
+.L331:
+	movl -388(%rbp), %eax
+	addl $65537, %eax
+.L328:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L320
+.L333:
+.L334:
+	movl -368(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -380(%rbp)
+	cmpl $2, -380(%rbp)
+	jl .L339
+	cmpl $18, -380(%rbp)
+	jle .L337
+.L339:
+	movl -380(%rbp), %eax
+	addl $65537, %eax
+.L336:
+	pushq %rax
+	movl -368(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -372(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -376(%rbp)
+	cmpl $2, -372(%rbp)
+	jl .L343
+	cmpl $18, -372(%rbp)
+	jle .L341
+.L343:
+	movl -376(%rbp), %eax
+	addl -372(%rbp), %eax
+.L340:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L332
+.L349:
+.L350:
+	movl -348(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -360(%rbp)
+	cmpl $2, -360(%rbp)
+	jl .L355
+	cmpl $18, -360(%rbp)
+	jle .L353
+.L355:
+	movl -360(%rbp), %eax
+	addl $65537, %eax
+.L352:
+	pushq %rax
+	movl -348(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -352(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -356(%rbp)
+	cmpl $2, -352(%rbp)
+	jl .L359
+	cmpl $18, -352(%rbp)
+	jle .L357
+.L359:
+	movl -356(%rbp), %eax
+	addl -352(%rbp), %eax
+.L356:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L348
+.L361:
+.L362:
+	movl -324(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -340(%rbp)
+	movl -328(%rbp), %eax
+	movl %eax, -344(%rbp)
+	cmpl $2, -340(%rbp)
+	jl .L367
+	cmpl $18, -340(%rbp)
+	jle .L365
+.L367:
+	movl -344(%rbp), %eax
+	addl -340(%rbp), %eax
+.L364:
+	pushq %rax
+	movl -324(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -332(%rbp)
+	movl -328(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -336(%rbp)
+	cmpl $2, -332(%rbp)
+	jl .L371
+	cmpl $18, -332(%rbp)
+	jle .L369
+.L371:
+	movl -336(%rbp), %eax
+	addl -332(%rbp), %eax
+.L368:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L360
+.L381:
+.L382:
+	movl -300(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -312(%rbp)
+	cmpl $2, -312(%rbp)
+	jl .L387
+	cmpl $18, -312(%rbp)
+	jle .L385
+.L387:
+	movl -312(%rbp), %eax
+	addl $65537, %eax
+.L384:
+	pushq %rax
+	movl -300(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -304(%rbp)
+	movl $65537, %eax
+	addl $1, %eax
+	movl %eax, -308(%rbp)
+	cmpl $2, -304(%rbp)
+	jl .L391
+	cmpl $18, -304(%rbp)
+	jle .L389
+.L391:
+	movl -308(%rbp), %eax
+	addl -304(%rbp), %eax
+.L388:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L380
+.L393:
+.L394:
+	movl -276(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -292(%rbp)
+	movl -280(%rbp), %eax
+	movl %eax, -296(%rbp)
+	cmpl $2, -292(%rbp)
+	jl .L399
+	cmpl $18, -292(%rbp)
+	jle .L397
+.L399:
+	movl -296(%rbp), %eax
+	addl -292(%rbp), %eax
+.L396:
+	pushq %rax
+	movl -276(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -284(%rbp)
+	movl -280(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -288(%rbp)
+	cmpl $2, -284(%rbp)
+	jl .L403
+	cmpl $18, -284(%rbp)
+	jle .L401
+.L403:
+	movl -288(%rbp), %eax
+	addl -284(%rbp), %eax
+.L400:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L392
+.L409:
+.L410:
+	movl -248(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -264(%rbp)
+	movl -252(%rbp), %eax
+	movl %eax, -268(%rbp)
+	cmpl $2, -264(%rbp)
+	jl .L415
+	cmpl $18, -264(%rbp)
+	jle .L413
+.L415:
+	movl -268(%rbp), %eax
+	addl -264(%rbp), %eax
+.L412:
+	pushq %rax
+	movl -248(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -256(%rbp)
+	movl -252(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -260(%rbp)
+	cmpl $2, -256(%rbp)
+	jl .L419
+	cmpl $18, -256(%rbp)
+	jle .L417
+.L419:
+	movl -260(%rbp), %eax
+	addl -256(%rbp), %eax
+.L416:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L408
+.L421:
+.L422:
+	movl -224(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -240(%rbp)
+	movl -228(%rbp), %eax
+	movl %eax, -244(%rbp)
+	cmpl $2, -240(%rbp)
+	jl .L427
+	cmpl $18, -240(%rbp)
+	jle .L425
+.L427:
+	movl -244(%rbp), %eax
+	addl -240(%rbp), %eax
+.L424:
+	pushq %rax
+	movl -224(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -232(%rbp)
+	movl -228(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -236(%rbp)
+	cmpl $2, -232(%rbp)
+	jl .L431
+	cmpl $18, -232(%rbp)
+	jle .L429
+.L431:
+	movl -236(%rbp), %eax
+	addl -232(%rbp), %eax
+.L428:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L420
+.L325:
+.L326:
+	movl -392(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.1
+	pushq %rax
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -392(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L324
+.L329:
+.L330:
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -388(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $65537, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -388(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L328
+.L337:
+.L338:
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -380(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $65537, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -380(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L336
+.L341:
+.L342:
+	movl -376(%rbp), %eax
+	movq %rax, %rsi
+	movl -372(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -376(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -372(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L340
+.L353:
+.L354:
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -360(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $65537, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -360(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L352
+.L357:
+.L358:
+	movl -356(%rbp), %eax
+	movq %rax, %rsi
+	movl -352(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -356(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -352(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L356
+.L365:
+.L366:
+	movl -344(%rbp), %eax
+	movq %rax, %rsi
+	movl -340(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -344(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -340(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L364
+.L369:
+.L370:
+	subq $8, %rsp
+	movl -336(%rbp), %eax
+	movq %rax, %rsi
+	movl -332(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -336(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -332(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L368
+.L385:
+.L386:
+	subq $8, %rsp
+	movl $65537, %eax
+	movq %rax, %rsi
+	movl -312(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $65537, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -312(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L384
+.L389:
+.L390:
+	movl -308(%rbp), %eax
+	movq %rax, %rsi
+	movl -304(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -308(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -304(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L388
+.L397:
+.L398:
+	movl -296(%rbp), %eax
+	movq %rax, %rsi
+	movl -292(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -296(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -292(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L396
+.L401:
+.L402:
+	subq $8, %rsp
+	movl -288(%rbp), %eax
+	movq %rax, %rsi
+	movl -284(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -288(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -284(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L400
+.L413:
+.L414:
+	movl -268(%rbp), %eax
+	movq %rax, %rsi
+	movl -264(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -268(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -264(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L412
+.L417:
+.L418:
+	subq $8, %rsp
+	movl -260(%rbp), %eax
+	movq %rax, %rsi
+	movl -256(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -260(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -256(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L416
+.L425:
+.L426:
+	subq $8, %rsp
+	movl -244(%rbp), %eax
+	movq %rax, %rsi
+	movl -240(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -244(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -240(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L424
+.L429:
+.L430:
+	movl -236(%rbp), %eax
+	movq %rax, %rsi
+	movl -232(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -236(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -232(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L428
+.L460:
+	cmpq $0, -32(%rbp)
+	jl .L467
+	cmpq $16, -32(%rbp)
+	jge .L467
+	cmpl $1000000007, -12(%rbp)
+	je .L469
+	cmpl $0, -20(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L470
+.L469:
+	movl $0, %eax
+.L470:
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L467:
+.L468:
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -424(%rbp)
+	cmpl $2, -424(%rbp)
+	jl .L474
+	cmpl $18, -424(%rbp)
+	jle .L472
+.L474:
+	movl -424(%rbp), %eax
+	addl $1000000007, %eax
+.L471:
+	movl %eax, -20(%rbp)
+	jmp .L459
+.L472:
+.L473:
+	movl -424(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -444(%rbp)
+	cmpl $2, -444(%rbp)
+	jl .L478
+	cmpl $18, -444(%rbp)
+	jle .L476
+.L478:
+	movl -444(%rbp), %eax
+	addl $1000000007, %eax
+.L475:
+	pushq %rax
+	movl -424(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -428(%rbp)
+	cmpl $2, -428(%rbp)
+	jl .L490
+	cmpl $18, -428(%rbp)
+	jle .L488
+.L490:
+	movl -428(%rbp), %eax
+	addl $1000000008, %eax
+.L487:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L471
+.L476:
+.L477:
+	movl -444(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -452(%rbp)
+	cmpl $2, -452(%rbp)
+	jl .L482
+	cmpl $18, -452(%rbp)
+	jle .L480
+.L482:
+	movl -452(%rbp), %eax
+	addl $1000000007, %eax
+.L479:
+	pushq %rax
+	movl -444(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -448(%rbp)
+	cmpl $2, -448(%rbp)
+	jl .L486
+	cmpl $18, -448(%rbp)
+	jle .L484
+.L486:
+	movl -448(%rbp), %eax
+	addl $1000000008, %eax
+.L483:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L475
+.L488:
+.L489:
+	movl -428(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -440(%rbp)
+	cmpl $2, -440(%rbp)
+	jl .L494
+	cmpl $18, -440(%rbp)
+	jle .L492
+.L494:
+	movl -440(%rbp), %eax
+	addl $1000000008, %eax
+.L491:
+	pushq %rax
+	movl -428(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -432(%rbp)
+	movl $1000000008, %eax
+	addl $1, %eax
+	movl %eax, -436(%rbp)
+	cmpl $2, -432(%rbp)
+	jl .L498
+	cmpl $18, -432(%rbp)
+	jle .L496
+.L498:
+	movl -436(%rbp), %eax
+	addl -432(%rbp), %eax
+.L495:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L487
+.L480:
+.L481:
+	movl -452(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.0
+	pushq %rax
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -452(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L479
+.L484:
+.L485:
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -448(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1000000008, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -448(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L483
+.L492:
+.L493:
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -440(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1000000008, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -440(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L491
+.L496:
+.L497:
+	movl -436(%rbp), %eax
+	movq %rax, %rsi
+	movl -432(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -436(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -432(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L495
+.L462:
+	movl -20(%rbp), %eax
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -8(%rbp)
+	jmp .L459
+.L463:
+	movl $0, -20(%rbp)
+	movq $6, -32(%rbp)
+.L464:
+	movswl -14(%rbp), %eax
+	movl %eax, -456(%rbp)
+	cmpl $2, -456(%rbp)
+	jl .L504
+	cmpl $18, -456(%rbp)
+	jle .L502
+.L504:
+	movl -456(%rbp), %eax
+	addl $1000000007, %eax
+.L501:
+	testl %eax, %eax
+	je .L499
+	movq $1, -32(%rbp)
+	movq -8(%rbp), %rax
+	addq $259, %rax
+	movq %rax, -496(%rbp)
+	cmpq $17, -32(%rbp)
+	jge .L529
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -504(%rbp)
+	cmpq $0, -504(%rbp)
+	je .L532
+	.p2align 4,,10
+.L531:
+	movq -32(%rbp), %rax
+	addq -496(%rbp), %rax
+	shrq $2, %rax
+	movw %ax, -14(%rbp)
+	addq $1, -32(%rbp)
+	movq -32(%rbp), %rax
+	addq -496(%rbp), %rax
+	shrq $2, %rax
+	movw %ax, -14(%rbp)
+	addq $1, -32(%rbp)
+	movq -32(%rbp), %rax
+	addq -496(%rbp), %rax
+	shrq $2, %rax
+	movw %ax, -14(%rbp)
+	addq $1, -32(%rbp)
+	movq -32(%rbp), %rax
+	addq -496(%rbp), %rax
+	shrq $2, %rax
+	movw %ax, -14(%rbp)
+	addq $1, -32(%rbp)
+	subq $1, -504(%rbp)
+	jne .L531
+.L532:
+.L529:
+.L530:
+	cmpq $17, -32(%rbp)
+	jge .L534
+	.p2align 4,,10
+.L533:
+	movq -32(%rbp), %rax
+	addq -496(%rbp), %rax
+	shrq $2, %rax
+	movw %ax, -14(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $17, -32(%rbp)
+	jl .L533
+.L534:
+.L536:
+.L500:
+	movl ga0+16(%rip), %eax
+	addl $2, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L682
+	cmpq $53, %rax
+	je .L680
+.L681:
+	jmp .L679
+.L499:
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpq $9, -32(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	jl .L535
+	movl -12(%rbp), %eax
+	movl %eax, -508(%rbp)
+	movl ga0+24(%rip), %eax
+	movl %eax, -512(%rbp)
+	cmpl $2, -508(%rbp)
+	jl .L540
+	cmpl $18, -508(%rbp)
+	jle .L538
+.L540:
+	movl -512(%rbp), %eax
+	addl -508(%rbp), %eax
+.L537:
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -20(%rbp)
+	je .L566
+	cmpw $0, -14(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L567
+.L682:
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	jne .L685
+	movl $42, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L686
+.L685:
+	movl $1, %eax
+.L686:
+	movl %eax, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	movl %eax, -744(%rbp)
+	cmpl $2, -744(%rbp)
+	jl .L690
+	cmpl $18, -744(%rbp)
+	jle .L688
+.L690:
+	movl -744(%rbp), %eax
+	addl $8, %eax
+.L687:
+	popq %rcx
+	cmpl %ecx, %eax
+	jne .L683
+	movabsq $369610613330, %rax
+	addq -8(%rbp), %rax
+	movl %eax, -788(%rbp)
+	movl $65536, %eax
+	cmpl $2, %eax
+	jl .L718
+	movl $65536, %eax
+	cmpl $18, %eax
+	jle .L716
+.L718:
+	movl -788(%rbp), %eax
+	addl $65536, %eax
+.L715:
+.L683:
+.L684:
+	movl $0, -12(%rbp)
+	cmpl $5, -12(%rbp)
+	jae .L744
+	.p2align 4,,10
+.L743:
+	cmpl $0, -20(%rbp)
+	je .L745
+	jmp .L744
+.L745:
+.L746:
+	movl -20(%rbp), %eax
+	movl %eax, -840(%rbp)
+	movl $205, %eax
+	cmpl $2, %eax
+	jl .L752
+	movl $205, %eax
+	cmpl $18, %eax
+	jle .L750
+.L752:
+	movl -840(%rbp), %eax
+	addl $205, %eax
+.L749:
+	testl %eax, %eax
+	je .L747
+	jmp .L744
+.L747:
+.L748:
+	movl ga0+56(%rip), %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -14(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $5, -12(%rbp)
+	jb .L743
+	jmp .L744
+.L750:
+.L751:
+	movl $205, %eax
+	subl $4, %eax
+	movl %eax, -868(%rbp)
+	movl -840(%rbp), %eax
+	movl %eax, -872(%rbp)
+	cmpl $2, -868(%rbp)
+	jl .L756
+	cmpl $18, -868(%rbp)
+	jle .L754
+.L756:
+	movl -872(%rbp), %eax
+	addl -868(%rbp), %eax
+.L753:
+	pushq %rax
+	movl $205, %eax
+	subl $1, %eax
+	movl %eax, -844(%rbp)
+	movl -840(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -848(%rbp)
+	cmpl $2, -844(%rbp)
+	jl .L768
+	cmpl $18, -844(%rbp)
+	jle .L766
+.L768:
+	movl -848(%rbp), %eax
+	addl -844(%rbp), %eax
+.L765:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L749
+.L502:
+.L503:
+	movl -456(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -476(%rbp)
+	cmpl $2, -476(%rbp)
+	jl .L508
+	cmpl $18, -476(%rbp)
+	jle .L506
+.L508:
+	movl -476(%rbp), %eax
+	addl $1000000007, %eax
+.L505:
+	pushq %rax
+	movl -456(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -460(%rbp)
+	cmpl $2, -460(%rbp)
+	jl .L520
+	cmpl $18, -460(%rbp)
+	jle .L518
+.L520:
+	movl -460(%rbp), %eax
+	addl $1000000008, %eax
+.L517:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L501
+.L566:
+	movl $0, %eax
+.L567:
+	movl %eax, -564(%rbp)
+	cmpl $2, -564(%rbp)
+	jl .L570
+	cmpl $18, -564(%rbp)
+	jle .L568
+.L570:
+	movl -564(%rbp), %eax
+	addl $28, %eax
+.L565:
+	movl $183, %eax
+	cmpl $2, %eax
+	jl .L598
+	movl $183, %eax
+	cmpl $18, %eax
+	jle .L596
+.L598:
+	movl $1971066815, %eax
+	addl $183, %eax
+.L595:
+	jmp .L536
+.L535:
+	movl $715, %eax
+	movswl -14(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -636(%rbp)
+	movl ga0+0(%rip), %eax
+	movl %eax, -640(%rbp)
+	cmpl $2, -636(%rbp)
+	jl .L626
+	cmpl $18, -636(%rbp)
+	jle .L624
+.L626:
+	movl -640(%rbp), %eax
+	addl -636(%rbp), %eax
+.L623:
+	movl -20(%rbp), %eax
+	cmpl %eax, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -692(%rbp)
+	movl $2, %eax
+	testl %eax, %eax
+	jg .L654
+	movl $18, %eax
+	testl %eax, %eax
+	jge .L652
+.L654:
+	movl -692(%rbp), %eax
+	addl $0, %eax
+.L651:
+	movl %eax, -12(%rbp)
+	jmp .L536
+.L680:
+	movl -144(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movswl -14(%rbp), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+	jmp .L679
+.L688:
+.L689:
+	movl -744(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -772(%rbp)
+	cmpl $2, -772(%rbp)
+	jl .L694
+	cmpl $18, -772(%rbp)
+	jle .L692
+.L694:
+	movl -772(%rbp), %eax
+	addl $8, %eax
+.L691:
+	pushq %rax
+	movl -744(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -748(%rbp)
+	movl $8, %eax
+	addl $1, %eax
+	movl %eax, -752(%rbp)
+	cmpl $2, -748(%rbp)
+	jl .L706
+	cmpl $18, -748(%rbp)
+	jle .L704
+.L706:
+	movl -752(%rbp), %eax
+	addl -748(%rbp), %eax
+.L703:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L687
+.L754:
+.L755:
+	movl -868(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -884(%rbp)
+	movl -872(%rbp), %eax
+	movl %eax, -888(%rbp)
+	cmpl $2, -884(%rbp)
+	jl .L760
+	cmpl $18, -884(%rbp)
+	jle .L758
+.L760:
+	movl -888(%rbp), %eax
+	addl -884(%rbp), %eax
+.L757:
+	pushq %rax
+	movl -868(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -876(%rbp)
+	movl -872(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -880(%rbp)
+	cmpl $2, -876(%rbp)
+	jl .L764
+	cmpl $18, -876(%rbp)
+	jle .L762
+.L764:
+	movl -880(%rbp), %eax
+	addl -876(%rbp), %eax
+.L761:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L753
+.L766:
+.L767:
+	movl -844(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -860(%rbp)
+	movl -848(%rbp), %eax
+	movl %eax, -864(%rbp)
+	cmpl $2, -860(%rbp)
+	jl .L772
+	cmpl $18, -860(%rbp)
+	jle .L770
+.L772:
+	movl -864(%rbp), %eax
+	addl -860(%rbp), %eax
+.L769:
+	pushq %rax
+	movl -844(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -852(%rbp)
+	movl -848(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -856(%rbp)
+	cmpl $2, -852(%rbp)
+	jl .L776
+	cmpl $18, -852(%rbp)
+	jle .L774
+.L776:
+	movl -856(%rbp), %eax
+	addl -852(%rbp), %eax
+.L773:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L765
+.L506:
+.L507:
+	movl -476(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -484(%rbp)
+	cmpl $2, -484(%rbp)
+	jl .L512
+	cmpl $18, -484(%rbp)
+	jle .L510
+.L512:
+	movl -484(%rbp), %eax
+	addl $1000000007, %eax
+.L509:
+	pushq %rax
+	movl -476(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -480(%rbp)
+	cmpl $2, -480(%rbp)
+	jl .L516
+	cmpl $18, -480(%rbp)
+	jle .L514
+.L516:
+	movl -480(%rbp), %eax
+	addl $1000000008, %eax
+.L513:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L505
+.L518:
+.L519:
+	movl -460(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -472(%rbp)
+	cmpl $2, -472(%rbp)
+	jl .L524
+	cmpl $18, -472(%rbp)
+	jle .L522
+.L524:
+	movl -472(%rbp), %eax
+	addl $1000000008, %eax
+.L521:
+	pushq %rax
+	movl -460(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -464(%rbp)
+	movl $1000000008, %eax
+	addl $1, %eax
+	movl %eax, -468(%rbp)
+	cmpl $2, -464(%rbp)
+	jl .L528
+	cmpl $18, -464(%rbp)
+	jle .L526
+.L528:
+	movl -468(%rbp), %eax
+	addl -464(%rbp), %eax
+.L525:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L517
+.L538:
+.L539:
+	movl -508(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -540(%rbp)
+	movl -512(%rbp), %eax
+	movl %eax, -544(%rbp)
+	cmpl $2, -540(%rbp)
+	jl .L544
+	cmpl $18, -540(%rbp)
+	jle .L542
+.L544:
+	movl -544(%rbp), %eax
+	addl -540(%rbp), %eax
+.L541:
+	pushq %rax
+	movl -508(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -516(%rbp)
+	movl -512(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -520(%rbp)
+	cmpl $2, -516(%rbp)
+	jl .L556
+	cmpl $18, -516(%rbp)
+	jle .L554
+.L556:
+	movl -520(%rbp), %eax
+	addl -516(%rbp), %eax
+.L553:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L537
+.L568:
+.L569:
+	movl -564(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -584(%rbp)
+	cmpl $2, -584(%rbp)
+	jl .L574
+	cmpl $18, -584(%rbp)
+	jle .L572
+.L574:
+	movl -584(%rbp), %eax
+	addl $28, %eax
+.L571:
+	pushq %rax
+	movl -564(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -568(%rbp)
+	cmpl $2, -568(%rbp)
+	jl .L586
+	cmpl $18, -568(%rbp)
+	jle .L584
+.L586:
+	movl -568(%rbp), %eax
+	addl $29, %eax
+.L583:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L565
+.L596:
+.L597:
+	movl $183, %eax
+	subl $4, %eax
+	movl %eax, -620(%rbp)
+	cmpl $2, -620(%rbp)
+	jl .L602
+	cmpl $18, -620(%rbp)
+	jle .L600
+.L602:
+	movl -620(%rbp), %eax
+	addl $1971066815, %eax
+.L599:
+	pushq %rax
+	movl $183, %eax
+	subl $1, %eax
+	movl %eax, -596(%rbp)
+	movl $1971066815, %eax
+	addl $1, %eax
+	movl %eax, -600(%rbp)
+	cmpl $2, -596(%rbp)
+	jl .L614
+	cmpl $18, -596(%rbp)
+	jle .L612
+.L614:
+	movl -600(%rbp), %eax
+	addl -596(%rbp), %eax
+.L611:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L536
+.L624:
+.L625:
+	movl -636(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -668(%rbp)
+	movl -640(%rbp), %eax
+	movl %eax, -672(%rbp)
+	cmpl $2, -668(%rbp)
+	jl .L630
+	cmpl $18, -668(%rbp)
+	jle .L628
+.L630:
+	movl -672(%rbp), %eax
+	addl -668(%rbp), %eax
+.L627:
+	pushq %rax
+	movl -636(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -644(%rbp)
+	movl -640(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -648(%rbp)
+	cmpl $2, -644(%rbp)
+	jl .L642
+	cmpl $18, -644(%rbp)
+	jle .L640
+.L642:
+	movl -648(%rbp), %eax
+	addl -644(%rbp), %eax
+.L639:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L623
+.L652:
+.L653:
+	xorl %eax, %eax
+	subl $4, %eax
+	movl %eax, -720(%rbp)
+	movl -692(%rbp), %eax
+	movl %eax, -724(%rbp)
+	cmpl $2, -720(%rbp)
+	jl .L658
+	cmpl $18, -720(%rbp)
+	jle .L656
+.L658:
+	movl -724(%rbp), %eax
+	addl -720(%rbp), %eax
+.L655:
+	pushq %rax
+	xorl %eax, %eax
+	subl $1, %eax
+	movl %eax, -696(%rbp)
+	movl -692(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -700(%rbp)
+	cmpl $2, -696(%rbp)
+	jl .L670
+	cmpl $18, -696(%rbp)
+	jle .L668
+.L670:
+	movl -700(%rbp), %eax
+	addl -696(%rbp), %eax
+.L667:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L651
+.L716:
+.L717:
+	movl $65536, %eax
+	subl $4, %eax
+	movl %eax, -816(%rbp)
+	movl -788(%rbp), %eax
+	movl %eax, -820(%rbp)
+	cmpl $2, -816(%rbp)
+	jl .L722
+	cmpl $18, -816(%rbp)
+	jle .L720
+.L722:
+	movl -820(%rbp), %eax
+	addl -816(%rbp), %eax
+.L719:
+	pushq %rax
+	movl $65536, %eax
+	subl $1, %eax
+	movl %eax, -792(%rbp)
+	movl -788(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -796(%rbp)
+	cmpl $2, -792(%rbp)
+	jl .L734
+	cmpl $18, -792(%rbp)
+	jle .L732
+.L734:
+	movl -796(%rbp), %eax
+	addl -792(%rbp), %eax
+.L731:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L715
+.L692:
+.L693:
+	movl -772(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -784(%rbp)
+	cmpl $2, -784(%rbp)
+	jl .L698
+	cmpl $18, -784(%rbp)
+	jle .L696
+.L698:
+	movl -784(%rbp), %eax
+	addl $8, %eax
+.L695:
+	pushq %rax
+	movl -772(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -776(%rbp)
+	movl $8, %eax
+	addl $1, %eax
+	movl %eax, -780(%rbp)
+	cmpl $2, -776(%rbp)
+	jl .L702
+	cmpl $18, -776(%rbp)
+	jle .L700
+.L702:
+	movl -780(%rbp), %eax
+	addl -776(%rbp), %eax
+.L699:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L691
+.L704:
+.L705:
+	movl -748(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -764(%rbp)
+	movl -752(%rbp), %eax
+	movl %eax, -768(%rbp)
+	cmpl $2, -764(%rbp)
+	jl .L710
+	cmpl $18, -764(%rbp)
+	jle .L708
+.L710:
+	movl -768(%rbp), %eax
+	addl -764(%rbp), %eax
+.L707:
+	pushq %rax
+	movl -748(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -756(%rbp)
+	movl -752(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -760(%rbp)
+	cmpl $2, -756(%rbp)
+	jl .L714
+	cmpl $18, -756(%rbp)
+	jle .L712
+.L714:
+	movl -760(%rbp), %eax
+	addl -756(%rbp), %eax
+.L711:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L703
+.L758:
+.L759:
+	movl -888(%rbp), %eax
+	movq %rax, %rsi
+	movl -884(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -888(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -884(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L757
+.L762:
+.L763:
+	subq $8, %rsp
+	movl -880(%rbp), %eax
+	movq %rax, %rsi
+	movl -876(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -880(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -876(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L761
+.L770:
+.L771:
+	subq $8, %rsp
+	movl -864(%rbp), %eax
+	movq %rax, %rsi
+	movl -860(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -864(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -860(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L769
+.L774:
+.L775:
+	movl -856(%rbp), %eax
+	movq %rax, %rsi
+	movl -852(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -856(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -852(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L773
+.L510:
+.L511:
+	movl -484(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.0
+	pushq %rax
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -484(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L509
+.L514:
+.L515:
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -480(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1000000008, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -480(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L513
+.L522:
+.L523:
+	subq $8, %rsp
+	movl $1000000008, %eax
+	movq %rax, %rsi
+	movl -472(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $1000000008, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -472(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L521
+.L526:
+.L527:
+	movl -468(%rbp), %eax
+	movq %rax, %rsi
+	movl -464(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -468(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -464(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L525
+.L542:
+.L543:
+	movl -540(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -556(%rbp)
+	movl -544(%rbp), %eax
+	movl %eax, -560(%rbp)
+	cmpl $2, -556(%rbp)
+	jl .L548
+	cmpl $18, -556(%rbp)
+	jle .L546
+.L548:
+	movl -560(%rbp), %eax
+	addl -556(%rbp), %eax
+.L545:
+	pushq %rax
+	movl -540(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -548(%rbp)
+	movl -544(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -552(%rbp)
+	cmpl $2, -548(%rbp)
+	jl .L552
+	cmpl $18, -548(%rbp)
+	jle .L550
+.L552:
+	movl -552(%rbp), %eax
+	addl -548(%rbp), %eax
+.L549:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L541
+.L554:
+.L555:
+	movl -516(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -532(%rbp)
+	movl -520(%rbp), %eax
+	movl %eax, -536(%rbp)
+	cmpl $2, -532(%rbp)
+	jl .L560
+	cmpl $18, -532(%rbp)
+	jle .L558
+.L560:
+	movl -536(%rbp), %eax
+	addl -532(%rbp), %eax
+.L557:
+	pushq %rax
+	movl -516(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -524(%rbp)
+	movl -520(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -528(%rbp)
+	cmpl $2, -524(%rbp)
+	jl .L564
+	cmpl $18, -524(%rbp)
+	jle .L562
+.L564:
+	movl -528(%rbp), %eax
+	addl -524(%rbp), %eax
+.L561:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L553
+.L572:
+.L573:
+	movl -584(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -592(%rbp)
+	cmpl $2, -592(%rbp)
+	jl .L578
+	cmpl $18, -592(%rbp)
+	jle .L576
+.L578:
+	movl -592(%rbp), %eax
+	addl $28, %eax
+.L575:
+	pushq %rax
+	movl -584(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -588(%rbp)
+	cmpl $2, -588(%rbp)
+	jl .L582
+	cmpl $18, -588(%rbp)
+	jle .L580
+.L582:
+	movl -588(%rbp), %eax
+	addl $29, %eax
+.L579:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L571
+.L584:
+.L585:
+	movl -568(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -580(%rbp)
+	cmpl $2, -580(%rbp)
+	jl .L590
+	cmpl $18, -580(%rbp)
+	jle .L588
+.L590:
+	movl -580(%rbp), %eax
+	addl $29, %eax
+.L587:
+	pushq %rax
+	movl -568(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -572(%rbp)
+	movl $29, %eax
+	addl $1, %eax
+	movl %eax, -576(%rbp)
+	cmpl $2, -572(%rbp)
+	jl .L594
+	cmpl $18, -572(%rbp)
+	jle .L592
+.L594:
+	movl -576(%rbp), %eax
+	addl -572(%rbp), %eax
+.L591:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L583
+.L600:
+.L601:
+	movl -620(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -632(%rbp)
+	cmpl $2, -632(%rbp)
+	jl .L606
+	cmpl $18, -632(%rbp)
+	jle .L604
+.L606:
+	movl -632(%rbp), %eax
+	addl $1971066815, %eax
+.L603:
+	pushq %rax
+	movl -620(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -624(%rbp)
+	movl $1971066815, %eax
+	addl $1, %eax
+	movl %eax, -628(%rbp)
+	cmpl $2, -624(%rbp)
+	jl .L610
+	cmpl $18, -624(%rbp)
+	jle .L608
+.L610:
+	movl -628(%rbp), %eax
+	addl -624(%rbp), %eax
+.L607:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L599
+.L612:
+.L613:
+	movl -596(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -612(%rbp)
+	movl -600(%rbp), %eax
+	movl %eax, -616(%rbp)
+	cmpl $2, -612(%rbp)
+	jl .L618
+	cmpl $18, -612(%rbp)
+	jle .L616
+.L618:
+	movl -616(%rbp), %eax
+	addl -612(%rbp), %eax
+.L615:
+	pushq %rax
+	movl -596(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -604(%rbp)
+	movl -600(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -608(%rbp)
+	cmpl $2, -604(%rbp)
+	jl .L622
+	cmpl $18, -604(%rbp)
+	jle .L620
+.L622:
+	movl -608(%rbp), %eax
+	addl -604(%rbp), %eax
+.L619:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L611
+.L628:
+.L629:
+	movl -668(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -684(%rbp)
+	movl -672(%rbp), %eax
+	movl %eax, -688(%rbp)
+	cmpl $2, -684(%rbp)
+	jl .L634
+	cmpl $18, -684(%rbp)
+	jle .L632
+.L634:
+	movl -688(%rbp), %eax
+	addl -684(%rbp), %eax
+.L631:
+	pushq %rax
+	movl -668(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -676(%rbp)
+	movl -672(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -680(%rbp)
+	cmpl $2, -676(%rbp)
+	jl .L638
+	cmpl $18, -676(%rbp)
+	jle .L636
+.L638:
+	movl -680(%rbp), %eax
+	addl -676(%rbp), %eax
+.L635:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L627
+.L640:
+.L641:
+	movl -644(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -660(%rbp)
+	movl -648(%rbp), %eax
+	movl %eax, -664(%rbp)
+	cmpl $2, -660(%rbp)
+	jl .L646
+	cmpl $18, -660(%rbp)
+	jle .L644
+.L646:
+	movl -664(%rbp), %eax
+	addl -660(%rbp), %eax
+.L643:
+	pushq %rax
+	movl -644(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -652(%rbp)
+	movl -648(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -656(%rbp)
+	cmpl $2, -652(%rbp)
+	jl .L650
+	cmpl $18, -652(%rbp)
+	jle .L648
+.L650:
+	movl -656(%rbp), %eax
+	addl -652(%rbp), %eax
+.L647:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L639
+.L656:
+.L657:
+	movl -720(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -736(%rbp)
+	movl -724(%rbp), %eax
+	movl %eax, -740(%rbp)
+	cmpl $2, -736(%rbp)
+	jl .L662
+	cmpl $18, -736(%rbp)
+	jle .L660
+.L662:
+	movl -740(%rbp), %eax
+	addl -736(%rbp), %eax
+.L659:
+	pushq %rax
+	movl -720(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -728(%rbp)
+	movl -724(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -732(%rbp)
+	cmpl $2, -728(%rbp)
+	jl .L666
+	cmpl $18, -728(%rbp)
+	jle .L664
+.L666:
+	movl -732(%rbp), %eax
+	addl -728(%rbp), %eax
+.L663:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L655
+.L668:
+.L669:
+	movl -696(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -712(%rbp)
+	movl -700(%rbp), %eax
+	movl %eax, -716(%rbp)
+	cmpl $2, -712(%rbp)
+	jl .L674
+	cmpl $18, -712(%rbp)
+	jle .L672
+.L674:
+	movl -716(%rbp), %eax
+	addl -712(%rbp), %eax
+.L671:
+	pushq %rax
+	movl -696(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -704(%rbp)
+	movl -700(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -708(%rbp)
+	cmpl $2, -704(%rbp)
+	jl .L678
+	cmpl $18, -704(%rbp)
+	jle .L676
+.L678:
+	movl -708(%rbp), %eax
+	addl -704(%rbp), %eax
+.L675:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L667
+.L720:
+.L721:
+	movl -816(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -832(%rbp)
+	movl -820(%rbp), %eax
+	movl %eax, -836(%rbp)
+	cmpl $2, -832(%rbp)
+	jl .L726
+	cmpl $18, -832(%rbp)
+	jle .L724
+.L726:
+	movl -836(%rbp), %eax
+	addl -832(%rbp), %eax
+.L723:
+	pushq %rax
+	movl -816(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -824(%rbp)
+	movl -820(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -828(%rbp)
+	cmpl $2, -824(%rbp)
+	jl .L730
+	cmpl $18, -824(%rbp)
+	jle .L728
+.L730:
+	movl -828(%rbp), %eax
+	addl -824(%rbp), %eax
+.L727:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L719
+.L732:
+.L733:
+	movl -792(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -808(%rbp)
+	movl -796(%rbp), %eax
+	movl %eax, -812(%rbp)
+	cmpl $2, -808(%rbp)
+	jl .L738
+	cmpl $18, -808(%rbp)
+	jle .L736
+.L738:
+	movl -812(%rbp), %eax
+	addl -808(%rbp), %eax
+.L735:
+	pushq %rax
+	movl -792(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -800(%rbp)
+	movl -796(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -804(%rbp)
+	cmpl $2, -800(%rbp)
+	jl .L742
+	cmpl $18, -800(%rbp)
+	jle .L740
+.L742:
+	movl -804(%rbp), %eax
+	addl -800(%rbp), %eax
+.L739:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L731
+.L696:
+.L697:
+	subq $8, %rsp
+	movl $8, %eax
+	movq %rax, %rsi
+	movl -784(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $8, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -784(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L695
+.L700:
+.L701:
+	movl -780(%rbp), %eax
+	movq %rax, %rsi
+	movl -776(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -780(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -776(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L699
+.L708:
+.L709:
+	movl -768(%rbp), %eax
+	movq %rax, %rsi
+	movl -764(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -768(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -764(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L707
+.L712:
+.L713:
+	subq $8, %rsp
+	movl -760(%rbp), %eax
+	movq %rax, %rsi
+	movl -756(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -760(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -756(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L711
+.L546:
+.L547:
+	movl -560(%rbp), %eax
+	movq %rax, %rsi
+	movl -556(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -560(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -556(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L545
+.L550:
+.L551:
+	subq $8, %rsp
+	movl -552(%rbp), %eax
+	movq %rax, %rsi
+	movl -548(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -552(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -548(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L549
+.L558:
+.L559:
+	subq $8, %rsp
+	movl -536(%rbp), %eax
+	movq %rax, %rsi
+	movl -532(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -536(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -532(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L557
+.L562:
+.L563:
+	movl -528(%rbp), %eax
+	movq %rax, %rsi
+	movl -524(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -528(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -524(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L561
+.L576:
+.L577:
+	movl -592(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.3
+	pushq %rax
+	subq $8, %rsp
+	movl $29, %eax
+	movq %rax, %rsi
+	movl -592(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L575
+.L580:
+.L581:
+	subq $8, %rsp
+	movl $29, %eax
+	movq %rax, %rsi
+	movl -588(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $29, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -588(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L579
+.L588:
+.L589:
+	subq $8, %rsp
+	movl $29, %eax
+	movq %rax, %rsi
+	movl -580(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $29, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -580(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L587
+.L592:
+.L593:
+	movl -576(%rbp), %eax
+	movq %rax, %rsi
+	movl -572(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -576(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -572(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L591
+.L604:
+.L605:
+	movl $1971066815, %eax
+	movq %rax, %rsi
+	movl -632(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $1971066815, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -632(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L603
+.L608:
+.L609:
+	subq $8, %rsp
+	movl -628(%rbp), %eax
+	movq %rax, %rsi
+	movl -624(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -628(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -624(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L607
+.L616:
+.L617:
+	subq $8, %rsp
+	movl -616(%rbp), %eax
+	movq %rax, %rsi
+	movl -612(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -616(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -612(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L615
+.L620:
+.L621:
+	movl -608(%rbp), %eax
+	movq %rax, %rsi
+	movl -604(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -608(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -604(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L619
+.L632:
+.L633:
+	movl -688(%rbp), %eax
+	movq %rax, %rsi
+	movl -684(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -688(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -684(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L631
+.L636:
+.L637:
+	subq $8, %rsp
+	movl -680(%rbp), %eax
+	movq %rax, %rsi
+	movl -676(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -680(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -676(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L635
+.L644:
+.L645:
+	subq $8, %rsp
+	movl -664(%rbp), %eax
+	movq %rax, %rsi
+	movl -660(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -664(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -660(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L643
+.L648:
+.L649:
+	movl -656(%rbp), %eax
+	movq %rax, %rsi
+	movl -652(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -656(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -652(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L647
+.L660:
+.L661:
+	movl -740(%rbp), %eax
+	movq %rax, %rsi
+	movl -736(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -740(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -736(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L659
+.L664:
+.L665:
+	subq $8, %rsp
+	movl -732(%rbp), %eax
+	movq %rax, %rsi
+	movl -728(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -732(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -728(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L663
+.L672:
+.L673:
+	subq $8, %rsp
+	movl -716(%rbp), %eax
+	movq %rax, %rsi
+	movl -712(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -716(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -712(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L671
+.L676:
+.L677:
+	movl -708(%rbp), %eax
+	movq %rax, %rsi
+	movl -704(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -708(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -704(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L675
+.L724:
+.L725:
+	movl -836(%rbp), %eax
+	movq %rax, %rsi
+	movl -832(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -836(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -832(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L723
+.L728:
+.L729:
+	subq $8, %rsp
+	movl -828(%rbp), %eax
+	movq %rax, %rsi
+	movl -824(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -828(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -824(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L727
+.L736:
+.L737:
+	subq $8, %rsp
+	movl -812(%rbp), %eax
+	movq %rax, %rsi
+	movl -808(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -812(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -808(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L735
+.L740:
+.L741:
+	movl -804(%rbp), %eax
+	movq %rax, %rsi
+	movl -800(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -804(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -800(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L739
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L466:
+	.long .L460-.L466
+	.long .L461-.L466
+	.long .L461-.L466
+	.long .L462-.L466
+	.long .L464-.L466
+	.long .L461-.L466
+	.long .L461-.L466
+	.long .L461-.L466
+	.long .L461-.L466
+	.long .L463-.L466
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,489 @@
+unsigned short g0;
+int ga0[8];
+char f0(char p0, int p1, unsigned long p2, unsigned short p3, unsigned int p4, long p5, unsigned char p6, long p7) {
+    short v0 = 26;
+    unsigned short v1 = 564;
+    unsigned short v2 = 190;
+    unsigned long v3 = 128L;
+    unsigned int v4 = 952;
+    int i0 = 6;
+    long j0 = 65536;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 215; }
+    p0 = (4 + i0);
+    for (i0 = 2; i0 < 17; i0 = i0 + 1) {
+        p6 = (v0 - p4);
+        if (p7 >= 0 && p7 < 16) { la0[p7] = (p0 + p3); }
+        p1 = 0;
+        while (p1 < 16) {
+            la0[14] = !(9);
+            la0[p1] = ((p4 / (v1 * v1 + 1)) / (i0 * i0 + 1));
+            p1 = p1 + 1;
+        }
+    }
+    if ((0 && ((char)(v4) != 8))) {
+        for (j0 = 0; j0 < 16; j0 = j0 + 1) {
+            la0[j0] = la0[15];
+            v0 = ((6 <= p0) / 13ul);
+        }
+        switch ((802 || 87758079515)) {
+        case 6:
+            break;
+        case 9:
+            for (p7 = 1; p7 < 4; p7 = p7 + 1) {
+                if ((v2 && p6)) { break; }
+                if (!((v4 || 951))) { break; }
+            }
+            break;
+        case 2:
+            if ((la0[2] < 491)) { return 6; }
+            break;
+        case 5:
+            if (p4 >= 0 && p4 < 16) { la0[p4] = (10 * -(v0)); }
+            break;
+        case 3:
+            if (((unsigned long)(0) * (j0 - v1))) { return v2; }
+            switch ((i0 && 5)) {
+            default:
+                p4 = (((p6 / (g0 * g0 + 1)) != (6 < 2)) - (unsigned short)((368177141590u - ga0[6])));
+            case 5:
+                if (((g0 / (p3 * p3 + 1)) + v2)) { return (int)(p6); }
+                j0 = (-(p1) + p3);
+                break;
+            case 3:
+            case 0:
+                break;
+            case 95:
+                break;
+            }
+        case 1:
+            if (g0) {
+                v3 = (int)(((p2 >= ga0[2]) > (unsigned char)(ga0[2])));
+            }
+            if (838) { return !(6); }
+            break;
+        }
+        p5 = 10;
+    }
+    v4 = 0;
+    while (v4 < 4) {
+        p6 = 172;
+        la0[5] = v2;
+        v4 = v4 + 1;
+    }
+    p2 = ((3 < !(1)) - (1 >= (662 - 8u)));
+    p0 = 8;
+    return (p7 - g0);
+}
+long f1(short p0, short p1, unsigned char p2) {
+    unsigned char v0 = 960320045861;
+    unsigned short v1 = 2147483647;
+    short v2 = 10;
+    int i0 = 885;
+    long j0 = 274;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 1U; }
+    i0 = (f0(3, 989, 4294967295, j0, i0, i0, i0, p0) == f0(i0, i0, 10, j0, 35, 10, 61, j0));
+    f0(!(p1), -(v0), (la0[14] - p2), 0, !(1), (la0[15] / (v0 * v0 + 1)), (ga0[3] || 4), (0 * v2));
+    for (p1 = 0; p1 < 4; p1 = p1 + 1) {
+        v1 = f0((unsigned char)(128), (char)(7U), f0(v1, 2147483647, v2, 943L, la0[20], 794, 678, v0), (975 - 377100590065), (p0 >= 10), j0, v2, -(v1));
+    }
+    if ((((ga0[5] + 21ul) == (961 - j0)) || f0(la0[5], v2, 10, 79, 9, v0, ga0[3], 6))) {
+        if (v0 >= 0 && v0 < 33) { la0[v0] = ((1 + v1) - (7 != 3)); }
+    }
+    p1 = p1 + (6 >= (short)(986012528408u));
+    v1 = (g0 != (unsigned long)((unsigned char)(v0)));
+    switch ((v2 - p2)) {
+    case 194:
+        if (((382 || (i0 * p1)) / (v0 * v0 + 1))) {
+            for (p1 = 0; p1 < 100; p1 = p1 + 1) {
+                i0 = (v1 / (g0 * g0 + 1));
+            }
+            v1 = (i0 * (546459079195 || 556));
+        } else {
+            for (v2 = 1; v2 < 8; v2 = v2 + 1) {
+                la0[29] = ga0[7];
+            }
+            switch (p1) {
+            case 61:
+                f0((3 / (p1 * p1 + 1)), v0, ga0[4], (v2 || p2), (la0[6] < 3), 481, (10U < ga0[1]), j0);
+            default:
+                f0(f0(109, j0, 5, 8, 146, v0, 10, 0), j0, v2, (p1 + 32767), (711 >= g0), f0(337, 8, 9, 608, i0, 733, j0, p0), (8 != p0), (8 + ga0[2]));
+                p1 = (short)(la0[27]);
+                break;
+            case 8:
+                break;
+            case 445:
+                f0(v0, (short)(4294967295), p0, p1, f0(v1, 8, la0[26], p0, 0, p2, la0[32], 2), (int)(270068223924), p1, (int)(541));
+                break;
+            case 29:
+                break;
+            case 3:
+            }
+            v2 = ((6 + (8l - p2)) + i0);
+        }
+        break;
+    case 672:
+        f0(f0(ga0[0], 500, 10, 10, 249, 8, g0, 32767), (10 + v2), (6 > v0), (p1 || 1000000007), (v0 || v1), !(7), 6, (v1 >= 360090198617));
+        break;
+    default:
+        switch (((37 / (j0 * j0 + 1)) >= (g0 || g0))) {
+        case 865:
+            if (v1 >= 0 && v1 < 33) { la0[v1] = 8ul; }
+            p1 = 934;
+            break;
+        default:
+            i0 = ((v1 + (p0 && 595)) * f0(648, 6, 1, 703, 128, 4, j0, p1));
+            break;
+        case -3:
+            break;
+        case 58:
+            break;
+        }
+        p1 = 748;
+        break;
+    case 43:
+        break;
+    case 33:
+        v2 = ((ga0[6] || v1) - -(p0));
+        break;
+    case 58:
+        if (((f0(5, p0, p1, 5, 128, 324, p2, 8) > (65536 || v2)) && 276u)) {
+            if (p0) {
+                v0 = -(g0);
+                if (i0 >= 0 && i0 < 33) { la0[i0] = la0[28]; }
+                i0 = !(((i0 > j0) + i0));
+            }
+        } else {
+            v0 = v0 + !((v1 > p1));
+            v0 = ga0[7];
+            if (f0(la0[17], 581, 9, v0, 128, 7, 4294967295, 764)) { return f0(256, 256, la0[9], 32767L, v0, v2, 641, v2); }
+        }
+        f0(4, f0(v0, 9, 5, 8, g0, 48, v2, 204), v1, la0[14], (v1 < 1), (770 - ga0[1]), (v2 - 7), (1 - ga0[7]));
+    case -2:
+        for (p1 = 2; p1 < 17; p1 = p1 + 1) {
+            switch (((j0 / (v2 * v2 + 1)) - 10)) {
+            case 1:
+                j0 = (10 * (3 <= 6));
+            case 2:
+                break;
+            case 10:
+                p2 = ((la0[29] >= !(p1)) + (p1 >= f0(v1, 317, j0, 381, v2, 483, 475, v0)));
+                if (((j0 || v1) + f0(73, la0[24], 9, 525, 0U, j0, ga0[2], 379))) { break; }
+            case 9:
+                if (p2) { break; }
+                break;
+            case 8:
+                break;
+            }
+        }
+        v0 = (ga0[4] > ((char)(v0) - (215349800860 / 3)));
+        break;
+    }
+    p0 = 0;
+    while (p0 < 4) {
+        if ((f0(p1, p2, ga0[2], p0, v2, v2, la0[6], 7) >= -(i0))) { break; }
+        switch (8) {
+        default:
+            i0 = (j0 || ((la0[25] / (p0 * p0 + 1)) <= (311 / 7)));
+            p2 = f0(la0[10], (long)(4), la0[18], p2, (la0[11] <= v0), (0 > 9), la0[28], (p0 / 2));
+            break;
+        case 4:
+            if ((((p0 < p1) / 1024) - la0[19])) {
+                if ((p2 < j0)) { break; }
+            }
+            v2 = 0;
+            while (v2 < 100) {
+                v0 = v0 + f0(g0, 210, 2, j0, 10, 130, 316, 996);
+                v2 = v2 + 1;
+            }
+        case 8:
+            la0[p0] = !(f0(p2, 88, p2, la0[25], i0, 0, 1, 65));
+            break;
+        case 2:
+            v1 = 9;
+            break;
+        case 6:
+            if (f0(7, (v2 >= p1), 3, (i0 / 5l), v2, p1, (v0 / 2), f0(ga0[4], v0, p2, 1, i0, p2, 5, p1))) {
+                f0((ga0[4] + 256), 591686850383, (6 >= 573667414559), -(v1), (i0 != j0), (p1 / (p1 * p1 + 1)), la0[27], (8 || 3));
+                la0[p0] = (0 || p2);
+            } else {
+                if (f0(255, 65535, 5, p1, j0, v2, p1, v1)) { break; }
+                i0 = i0 + 7;
+                if ((v1 || (v0 - v0))) { break; }
+            }
+            break;
+        }
+        if ((v0 == v2)) { break; }
+        p0 = p0 + 1;
+    }
+    return f0(81, 134, i0, 160, j0, p2, 7, v0);
+}
+unsigned long f2(short p0, short p1, long p2, unsigned long p3, int p4, short p5, short p6, unsigned short p7) {
+    unsigned short v0 = 7;
+    unsigned short v1 = 681;
+    int i0 = 796848568043;
+    long j0 = 727;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 232; }
+    p6 = (p7 < f0(8l, 913072286573, 10, v1, v1, 2, 855L, p6));
+    f1((p3 >= p1), (p2 - i0), (short)(0));
+    i0 = ((unsigned char)((unsigned short)(g0)) <= ((p3 + 0) - (p3 <= p3)));
+    return !(7);
+}
+void w2(int q0, unsigned int q1) {
+    ga0[0] = ga0[2] + q1;
+}
+char f3(unsigned char p0, unsigned long p1, char p2, unsigned long p3) {
+    int v0 = 1;
+    unsigned short v1 = 4;
+    unsigned long v2 = 7l;
+    short v3 = 585;
+    unsigned short v4 = 655;
+    int i0 = 10;
+    long j0 = 613;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 9; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 68; }
+    v2 = (4 < !((p2 >= 994)));
+    v0 = f2(g0, 642865172443, 8l, (unsigned char)(985), (long)(65535), (unsigned long)(v0), f1(v0, v4, 402), 65535);
+    if (!((!(g0) > v2))) {
+        i0 = ((v3 >= (673 + 9)) || v0);
+    }
+    la0[13] = f1(v1, p2, g0);
+    if (((5 < 441455615536) || f1(v0, 0, v2))) { return ((p3 < 8) + !(v0)); }
+    if ((g0 <= (unsigned short)(95))) { return (j0 / 1); }
+    return (char)(((long)(v0) <= (v0 <= p2)));
+}
+long rec(long n, long acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 4, acc);
+}
+int main() {
+    unsigned char v0 = 8;
+    unsigned char v1 = 65536;
+    short v2 = 220;
+    short v3 = 1000000007;
+    unsigned short v4 = 16;
+    int i0 = 322;
+    long j0 = 9;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 413439201207; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 1l; }
+    j0 = (-((v0 != j0)) >= i0);
+    if (4) {
+        v4 = ((unsigned short)((unsigned int)(390)) <= (ga0[5] != v3));
+    } else {
+        ga0[3] = 211;
+        v0 = v0 + ((8 <= 903) / (j0 * j0 + 1));
+    }
+    switch (f0(v2, 49, 981, 0, 536, 2, la1[19], ga0[7])) {
+    case 10:
+        v4 = 0;
+        for (v3 = 0; v3 < 4; v3 = v3 + 1) {
+            for (j0 = 0; j0 < 5; j0 = j0 + 1) {
+                v1 = (unsigned int)(((3U - 631221836613) < rec(256, v4)));
+                if (v1) { break; }
+                if (v1) { break; }
+            }
+            j0 = 1000000007;
+            v4 = !(2u);
+        }
+        break;
+    case 3:
+        break;
+    default:
+        if (g0) {
+            la0[31] = 436;
+            if (32767u) {
+                v2 = f2((i0 < 255), (0 * 480), 10, (7 + 542), (unsigned long)(la0[25]), (v2 != 201), (4 + 190), (v4 <= la0[5]));
+                v4 = f1(i0, (unsigned long)(la0[24]), -(10));
+                v0 = ((short)((856408165962 || v1)) - (f1(v1, 2147483647, 656743730916) != f0(i0, v4, 1093937325984, 4, 3, 797, 322, v4)));
+            }
+            v0 = v1;
+        } else {
+            for (i0 = 1; i0 < 100; i0 = i0 + 1) {
+                if (!((unsigned long)(60))) { break; }
+            }
+            if (i0 >= 0 && i0 < 33) { la0[i0] = (i0 / (v0 * v0 + 1)); }
+            la1[19] = (v4 / (v4 * v4 + 1));
+        }
+        w2(v0, ga0[5]);
+    case 7:
+        for (v2 = 1; v2 < 3; v2 = v2 + 1) {
+            v3 = 0;
+            while (v3 < 3) {
+                if (((v0 - 1) != (v0 + j0))) { break; }
+                if (rec(i0, 8l)) { break; }
+                if ((char)(v2)) { break; }
+                v3 = v3 + 1;
+            }
+            i0 = v0;
+        }
+        w2(2147483647, 7L);
+        break;
+    case 1:
+        switch (!(i0)) {
+        case 43:
+            switch (((j0 - la0[19]) || (i0 * ga0[0]))) {
+            case 559:
+                if (v2) { return 8; }
+                w2(8, 865573841459);
+                break;
+            case 823:
+                v2 = (((v1 / 3u) - (28466293590 + i0)) && ((v2 - i0) / 13ul));
+                break;
+            case 786:
+                i0 = 128;
+                w2(v3, v1);
+                break;
+            case -5:
+                w2(v3, g0);
+                f0((ga0[7] + j0), (i0 && 4), -(la0[22]), v0, f3(g0, v3, ga0[1], 128), f3(la0[18], 378, v0, g0), v0, (la1[19] / 2));
+                break;
+            case 62:
+                v3 = v3 + (v0 / 1);
+                w2(0, 2);
+                break;
+            case 0:
+                la0[15] = ((v1 - 3) == f3(v3, 1ul, ga0[1], 51));
+            default:
+                la0[0] = f2(780, j0, j0, v1, g0, 0, 614, 2);
+                i0 = -(((1 + 128) - (unsigned int)(5)));
+                break;
+            }
+            switch (94) {
+            case 532:
+            case 3:
+                if (v4 >= 0 && v4 < 33) { la0[v4] = !((v4 || v1)); }
+                v2 = (int)(((ga0[0] != 320) / 16));
+            case 1:
+                break;
+            case -3:
+                w2(4, g0);
+                w2(v3, v0);
+                break;
+            case 653:
+                w2(la1[24], g0);
+                w2(la0[32], 10);
+                break;
+            case 4:
+                w2(ga0[7], 39);
+                j0 = (unsigned int)(i0);
+            default:
+                v2 = (((516 / 3) - (unsigned short)(v2)) / 2);
+                la1[7] = f3(1000000007, 10, 1000000007, 668);
+                break;
+            case 607:
+                v3 = v3 + !(f2(ga0[7], g0, 960794039870, 0, v3, 7, 7, 732399349516));
+                break;
+            case 281:
+                v2 = ((v4 <= -(143)) >= (2 > (char)(la0[0])));
+                break;
+            }
+        case -3:
+            if ((v0 / 100)) {
+                v4 = (f0(g0, 5, j0, la0[32], j0, 849, v2, 8) < 5);
+            } else {
+                v2 = (v0 && ((j0 != v4) != (306 != v2)));
+            }
+        case 38:
+            g0 = -((la0[16] / 5l));
+            break;
+        case -4:
+            if (!(f2(65536, la1[7], la0[4], 2147483647, 4l, i0, 1, v2))) {
+                v4 = v4 + i0;
+            }
+            break;
+        default:
+            break;
+        case 443:
+            i0 = (f2(v2, v1, 1, j0, la1[31], 389723135511U, v4, ga0[4]) == f2(v4, i0, 8, 124, v4, 267, 6, 3));
+        case 883:
+            break;
+        case 5:
+            break;
+        }
+        break;
+    case 4:
+    case 6:
+        break;
+    }
+    switch (((v0 != 649) * (v1 < v1))) {
+    case 0:
+        w2(127, 1099327666908);
+    case 6:
+        j0 = (la1[0] >= rec(v0, v4));
+        switch ((5 / (j0 * j0 + 1))) {
+        default:
+            switch (((v0 * 127) || la1[1])) {
+            default:
+                break;
+            case 7:
+                break;
+            case 8:
+            case 6:
+                w2(611795962576, 127);
+                v0 = v3;
+                break;
+            }
+            break;
+        case 4:
+            v0 = -((10 > (g0 / (v0 * v0 + 1))));
+            break;
+        case -4:
+            if (v1 >= 0 && v1 < 8) { ga0[v1] = ((ga0[6] / 16) * f2(4, 0, g0, 2, 3, v4, 518098918226, g0)); }
+            g0 = (((unsigned int)(j0) != v3) && j0);
+            break;
+        case 55:
+        case 721:
+            v2 = ((v3 && (char)(i0)) && (g0 - 10l));
+            v0 = (f0(v4, j0, v4, v3, 4U, 4294967295, la0[10], v4) && v0);
+            break;
+        case -2:
+            break;
+        case 47:
+            i0 = 0;
+            while (i0 < 16) {
+                v1 = (((1 - 669) / 2) == ((470 * 894970854197) <= 503));
+                v0 = (((short)(303) >= rec(32767, la0[22])) || j0);
+                w2(j0, la0[8]);
+                i0 = i0 + 1;
+            }
+            v2 = v2 + ((v0 / 3) / 3);
+            break;
+        case 14:
+            i0 = (((v1 / (v4 * v4 + 1)) < (unsigned long)(6)) + !(823724881761));
+            break;
+        }
+        break;
+    case 10:
+        break;
+    case 7:
+        if ((((1 - g0) - (v0 / (v2 * v2 + 1))) + 2)) {
+            v1 = v1 + rec(la1[14], g0);
+        }
+        break;
+    case 1:
+        break;
+    }
+    rec(276573654626, (745265904175 - j0));
+    v0 = f3(v0, i0, 954, v3);
+    i0 = i0 + g0;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,6233 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.section .text
+	.type f0, @function
+	.type rec, @function
+	.type f0.constprop.2, @function
+	.type f0.constprop.3, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.0, @function
+	.type f2, @function
+	.type f3, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movw %cx, -18(%rbp)
+	movl %r8d, -24(%rbp)
+	movq %r9, -32(%rbp)
+	movw $26, -34(%rbp)
+	movw $564, -36(%rbp)
+	movw $190, -38(%rbp)
+	movq $128, -48(%rbp)
+	movl $952, -52(%rbp)
+	movl $6, -56(%rbp)
+	movq $65536, -64(%rbp)
+	movl $0, -56(%rbp)
+	imull $215, -56(%rbp), %eax
+	subl $215, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -136(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -144(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -56(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L4
+.L5:
+	movl -56(%rbp), %eax
+	addl $4, %eax
+	movb %al, -1(%rbp)
+	movl $2, -56(%rbp)
+	movswl -34(%rbp), %eax
+	subl -24(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpq $0, 24(%rbp)
+	jl .L6
+	cmpq $16, 24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L7
+.L6:
+	movl $0, %eax
+.L7:
+	movl %eax, -152(%rbp)
+	movsbl -1(%rbp), %eax
+	movzwl -18(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -156(%rbp)
+	movzwl -36(%rbp), %eax
+	movl %eax, -164(%rbp)
+	imull -164(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -160(%rbp)
+	cmpl $17, -56(%rbp)
+	jge .L9
+	.p2align 4,,10
+.L8:
+	movl -148(%rbp), %eax
+	movb %al, 16(%rbp)
+	cmpl $0, -152(%rbp)
+	je .L10
+	movq 24(%rbp), %rax
+	movl -156(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+.L10:
+.L11:
+	movl $0, -8(%rbp)
+	movl -160(%rbp), %eax
+	movl %eax, -168(%rbp)
+	movl -56(%rbp), %eax
+	imull -56(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -172(%rbp)
+	cmpl $0, -136(%rbp)
+	je .L12
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L13
+	.p2align 4,,10
+.L14:
+	movl $0, -72(%rbp)
+	movl -172(%rbp), %eax
+	pushq %rax
+	movl -168(%rbp), %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -188(%rbp)
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl $0, -72(%rbp)
+	movslq -8(%rbp), %rax
+	movl -188(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -184(%rbp)
+	jne .L14
+.L15:
+.L12:
+.L13:
+	cmpl $16, -8(%rbp)
+	jge .L17
+	.p2align 4,,10
+.L16:
+	movl $0, -72(%rbp)
+	movl -172(%rbp), %eax
+	pushq %rax
+	movl -168(%rbp), %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L16
+.L17:
+	addl $1, -56(%rbp)
+	cmpl $17, -56(%rbp)
+	jl .L8
+.L9:
+	movl $0, -52(%rbp)
+	movb $172, 16(%rbp)
+	movzwl -38(%rbp), %eax
+	movl %eax, -192(%rbp)
+	movl %eax, -108(%rbp)
+	movb $172, 16(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, 16(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, 16(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movl $4, -52(%rbp)
+	movq $0, -16(%rbp)
+	movb $8, -1(%rbp)
+	movq 24(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0, .-f0
+	.align 16
+rec:
+	cmpq $4, %rdi
+	jl .L20
+	cmpq $18, %rdi
+	jg .L20
+.L18:
+.L19:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rdi, -64(%rbp)
+	movq %rsi, -56(%rbp)
+	movq %rdi, %rax
+	subq $4, %rax
+	movq %rax, -48(%rbp)
+	movq %rsi, %rax
+	movq %rax, -40(%rbp)
+	cmpq $4, -48(%rbp)
+	jl .L24
+	cmpq $18, -48(%rbp)
+	jle .L22
+.L24:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L21:
+	pushq %rax
+	movq -64(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -48(%rbp)
+	movq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -40(%rbp)
+	cmpq $4, -48(%rbp)
+	jl .L52
+	cmpq $18, -48(%rbp)
+	jle .L50
+.L52:
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+.L49:
+	popq %rcx
+	addq %rcx, %rax
+	leave
+	ret
+.L22:
+.L23:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L28
+	cmpq $18, -32(%rbp)
+	jle .L26
+.L28:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L25:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L40
+	cmpq $18, -32(%rbp)
+	jle .L38
+.L40:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L37:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L21
+.L50:
+.L51:
+	movq -48(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L56
+	cmpq $18, -32(%rbp)
+	jle .L54
+.L56:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L53:
+	pushq %rax
+	movq -48(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L68
+	cmpq $18, -32(%rbp)
+	jle .L66
+.L68:
+	movq -24(%rbp), %rax
+	addq -32(%rbp), %rax
+.L65:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L49
+.L26:
+.L27:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L32
+	cmpq $18, -16(%rbp)
+	jle .L30
+.L32:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L29:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L36
+	cmpq $18, -16(%rbp)
+	jle .L34
+.L36:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L33:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L25
+.L38:
+.L39:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L44
+	cmpq $18, -16(%rbp)
+	jle .L42
+.L44:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L41:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L48
+	cmpq $18, -16(%rbp)
+	jle .L46
+.L48:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L45:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L37
+.L54:
+.L55:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L60
+	cmpq $18, -16(%rbp)
+	jle .L58
+.L60:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L57:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L64
+	cmpq $18, -16(%rbp)
+	jle .L62
+.L64:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L61:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L53
+.L66:
+.L67:
+	movq -32(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L72
+	cmpq $18, -16(%rbp)
+	jle .L70
+.L72:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L69:
+	pushq %rax
+	movq -32(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -16(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L76
+	cmpq $18, -16(%rbp)
+	jle .L74
+.L76:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L73:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L65
+.L30:
+.L31:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L29
+.L34:
+.L35:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L33
+.L42:
+.L43:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L41
+.L46:
+.L47:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L45
+.L58:
+.L59:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L57
+.L62:
+.L63:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L61
+.L70:
+.L71:
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L69
+.L74:
+.L75:
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L73
+.L20:
+	movq %rsi, %rax
+	addq %rdi, %rax
+	ret
+	.size rec, .-rec
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movb %r8b, -21(%rbp)
+	movq %r9, -32(%rbp)
+	movw $26, -34(%rbp)
+	movw $564, -36(%rbp)
+	movw $190, -38(%rbp)
+	movq $128, -48(%rbp)
+	movl $952, -52(%rbp)
+	movl $6, -56(%rbp)
+	movq $65536, -64(%rbp)
+	movl $0, -56(%rbp)
+	imull $215, -56(%rbp), %eax
+	subl $215, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -136(%rbp)
+	testl %eax, %eax
+	je .L77
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L78
+	.p2align 4,,10
+.L79:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -144(%rbp)
+	jne .L79
+.L80:
+.L77:
+.L78:
+	cmpl $16, -56(%rbp)
+	jge .L82
+	.p2align 4,,10
+.L81:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L81
+.L82:
+	movl -56(%rbp), %eax
+	addl $4, %eax
+	movb %al, -1(%rbp)
+	movl $2, -56(%rbp)
+	movswl -34(%rbp), %eax
+	subl -20(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpq $0, -32(%rbp)
+	jl .L83
+	cmpq $16, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L84
+.L83:
+	movl $0, %eax
+.L84:
+	movl %eax, -152(%rbp)
+	movsbl -1(%rbp), %eax
+	addl $943, %eax
+	movl %eax, -156(%rbp)
+	movzwl -36(%rbp), %eax
+	movl %eax, -164(%rbp)
+	imull -164(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -160(%rbp)
+	cmpl $17, -56(%rbp)
+	jge .L86
+	.p2align 4,,10
+.L85:
+	movl -148(%rbp), %eax
+	movb %al, -21(%rbp)
+	cmpl $0, -152(%rbp)
+	je .L87
+	movq -32(%rbp), %rax
+	movl -156(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+.L87:
+.L88:
+	movl $0, -8(%rbp)
+	movl -160(%rbp), %eax
+	movl %eax, -168(%rbp)
+	movl -56(%rbp), %eax
+	imull -56(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -172(%rbp)
+	cmpl $0, -136(%rbp)
+	je .L89
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L90
+	.p2align 4,,10
+.L91:
+	movl $0, -72(%rbp)
+	movl -172(%rbp), %eax
+	pushq %rax
+	movl -168(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -188(%rbp)
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl $0, -72(%rbp)
+	movslq -8(%rbp), %rax
+	movl -188(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -184(%rbp)
+	jne .L91
+.L92:
+.L89:
+.L90:
+	cmpl $16, -8(%rbp)
+	jge .L94
+	.p2align 4,,10
+.L93:
+	movl $0, -72(%rbp)
+	movl -172(%rbp), %eax
+	pushq %rax
+	movl -168(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L93
+.L94:
+	addl $1, -56(%rbp)
+	cmpl $17, -56(%rbp)
+	jl .L85
+.L86:
+	movl $0, -52(%rbp)
+	movb $172, -21(%rbp)
+	movzwl -38(%rbp), %eax
+	movl %eax, -192(%rbp)
+	movl %eax, -108(%rbp)
+	movb $172, -21(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, -21(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, -21(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movl $4, -52(%rbp)
+	movq $0, -16(%rbp)
+	movb $8, -1(%rbp)
+	movq -32(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f0.constprop.3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movq %r8, -32(%rbp)
+	movb %r9b, -33(%rbp)
+	movw $26, -36(%rbp)
+	movw $564, -38(%rbp)
+	movw $190, -40(%rbp)
+	movq $128, -48(%rbp)
+	movl $952, -52(%rbp)
+	movl $6, -56(%rbp)
+	movq $65536, -64(%rbp)
+	movl $0, -56(%rbp)
+	imull $215, -56(%rbp), %eax
+	subl $215, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -136(%rbp)
+	testl %eax, %eax
+	je .L95
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L96
+	.p2align 4,,10
+.L97:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -144(%rbp)
+	jne .L97
+.L98:
+.L95:
+.L96:
+	cmpl $16, -56(%rbp)
+	jge .L100
+	.p2align 4,,10
+.L99:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L99
+.L100:
+	movl -56(%rbp), %eax
+	addl $4, %eax
+	movb %al, -1(%rbp)
+	movl $2, -56(%rbp)
+	movswl -36(%rbp), %eax
+	subl -20(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpq $0, 16(%rbp)
+	jl .L101
+	cmpq $16, 16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L102
+.L101:
+	movl $0, %eax
+.L102:
+	movl %eax, -152(%rbp)
+	movsbl -1(%rbp), %eax
+	addl $42974, %eax
+	movl %eax, -156(%rbp)
+	movzwl -38(%rbp), %eax
+	movl %eax, -164(%rbp)
+	imull -164(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -160(%rbp)
+	cmpl $17, -56(%rbp)
+	jge .L104
+	.p2align 4,,10
+.L103:
+	movl -148(%rbp), %eax
+	movb %al, -33(%rbp)
+	cmpl $0, -152(%rbp)
+	je .L105
+	movq 16(%rbp), %rax
+	movl -156(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+.L105:
+.L106:
+	movl $0, -8(%rbp)
+	movl -160(%rbp), %eax
+	movl %eax, -168(%rbp)
+	movl -56(%rbp), %eax
+	imull -56(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -172(%rbp)
+	cmpl $0, -136(%rbp)
+	je .L107
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L108
+	.p2align 4,,10
+.L109:
+	movl $0, -72(%rbp)
+	movl -172(%rbp), %eax
+	pushq %rax
+	movl -168(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -188(%rbp)
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl $0, -72(%rbp)
+	movslq -8(%rbp), %rax
+	movl -188(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -184(%rbp)
+	jne .L109
+.L110:
+.L107:
+.L108:
+	cmpl $16, -8(%rbp)
+	jge .L112
+	.p2align 4,,10
+.L111:
+	movl $0, -72(%rbp)
+	movl -172(%rbp), %eax
+	pushq %rax
+	movl -168(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L111
+.L112:
+	addl $1, -56(%rbp)
+	cmpl $17, -56(%rbp)
+	jl .L103
+.L104:
+	movl $0, -52(%rbp)
+	movb $172, -33(%rbp)
+	movzwl -40(%rbp), %eax
+	movl %eax, -192(%rbp)
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movl $4, -52(%rbp)
+	movq $0, -16(%rbp)
+	movb $8, -1(%rbp)
+	movq 16(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+.f0.constprop.3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.3, .-f0.constprop.3
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movq %r8, -32(%rbp)
+	movb %r9b, -33(%rbp)
+	movw $26, -36(%rbp)
+	movw $564, -38(%rbp)
+	movw $190, -40(%rbp)
+	movq $128, -48(%rbp)
+	movl $952, -52(%rbp)
+	movl $6, -56(%rbp)
+	movq $65536, -64(%rbp)
+	movl $0, -56(%rbp)
+	imull $215, -56(%rbp), %eax
+	subl $215, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -136(%rbp)
+	testl %eax, %eax
+	je .L113
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L114
+	.p2align 4,,10
+.L115:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -144(%rbp)
+	jne .L115
+.L116:
+.L113:
+.L114:
+	cmpl $16, -56(%rbp)
+	jge .L118
+	.p2align 4,,10
+.L117:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L117
+.L118:
+	movl -56(%rbp), %eax
+	addl $4, %eax
+	movb %al, -1(%rbp)
+	movl $2, -56(%rbp)
+	movswl -36(%rbp), %eax
+	subl -20(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpq $0, 16(%rbp)
+	jl .L119
+	cmpq $16, 16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L120
+.L119:
+	movl $0, %eax
+.L120:
+	movl %eax, -152(%rbp)
+	movsbl -1(%rbp), %eax
+	addl $8, %eax
+	movl %eax, -156(%rbp)
+	movzwl -38(%rbp), %eax
+	movl %eax, -164(%rbp)
+	imull -164(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -160(%rbp)
+	cmpl $17, -56(%rbp)
+	jge .L122
+	.p2align 4,,10
+.L121:
+	movl -148(%rbp), %eax
+	movb %al, -33(%rbp)
+	cmpl $0, -152(%rbp)
+	je .L123
+	movq 16(%rbp), %rax
+	movl -156(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+.L123:
+.L124:
+	movl $0, -8(%rbp)
+	movl -160(%rbp), %eax
+	movl %eax, -168(%rbp)
+	movl -56(%rbp), %eax
+	imull -56(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -172(%rbp)
+	cmpl $0, -136(%rbp)
+	je .L125
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L126
+	.p2align 4,,10
+.L127:
+	movl $0, -72(%rbp)
+	movl -172(%rbp), %eax
+	pushq %rax
+	movl -168(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -188(%rbp)
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl $0, -72(%rbp)
+	movslq -8(%rbp), %rax
+	movl -188(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -184(%rbp)
+	jne .L127
+.L128:
+.L125:
+.L126:
+	cmpl $16, -8(%rbp)
+	jge .L130
+	.p2align 4,,10
+.L129:
+	movl $0, -72(%rbp)
+	movl -172(%rbp), %eax
+	pushq %rax
+	movl -168(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L129
+.L130:
+	addl $1, -56(%rbp)
+	cmpl $17, -56(%rbp)
+	jl .L121
+.L122:
+	movl $0, -52(%rbp)
+	movb $172, -33(%rbp)
+	movzwl -40(%rbp), %eax
+	movl %eax, -192(%rbp)
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -192(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movl $4, -52(%rbp)
+	movq $0, -16(%rbp)
+	movb $8, -1(%rbp)
+	movq 16(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movq %rdx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movq %r8, -32(%rbp)
+	movb %r9b, -33(%rbp)
+	movw $26, -36(%rbp)
+	movw $564, -38(%rbp)
+	movw $190, -40(%rbp)
+	movq $128, -48(%rbp)
+	movl $952, -52(%rbp)
+	movl $6, -56(%rbp)
+	movq $65536, -64(%rbp)
+	movl $0, -56(%rbp)
+	imull $215, -56(%rbp), %eax
+	subl $215, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -136(%rbp)
+	testl %eax, %eax
+	je .L131
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L132
+	.p2align 4,,10
+.L133:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -144(%rbp)
+	jne .L133
+.L134:
+.L131:
+.L132:
+	cmpl $16, -56(%rbp)
+	jge .L136
+	.p2align 4,,10
+.L135:
+	addl $215, -132(%rbp)
+	movslq -56(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L135
+.L136:
+	movl -56(%rbp), %eax
+	addl $4, %eax
+	movb %al, -1(%rbp)
+	movl $2, -56(%rbp)
+	movswl -36(%rbp), %eax
+	subl -20(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpq $0, 16(%rbp)
+	jl .L137
+	cmpq $16, 16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L138
+.L137:
+	movl $0, %eax
+.L138:
+	movl %eax, -152(%rbp)
+	movzwl -38(%rbp), %eax
+	movl %eax, -160(%rbp)
+	imull -160(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -156(%rbp)
+	cmpl $17, -56(%rbp)
+	jge .L140
+	.p2align 4,,10
+.L139:
+	movl -148(%rbp), %eax
+	movb %al, -33(%rbp)
+	cmpl $0, -152(%rbp)
+	je .L141
+	movq 16(%rbp), %rax
+	movsbl -1(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+.L141:
+.L142:
+	movl $0, -8(%rbp)
+	movl -156(%rbp), %eax
+	movl %eax, -164(%rbp)
+	movl -56(%rbp), %eax
+	imull -56(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -168(%rbp)
+	cmpl $0, -136(%rbp)
+	je .L143
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L144
+	.p2align 4,,10
+.L145:
+	movl $0, -72(%rbp)
+	movl -168(%rbp), %eax
+	pushq %rax
+	movl -164(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -180(%rbp)
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl $0, -72(%rbp)
+	movslq -8(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -176(%rbp)
+	jne .L145
+.L146:
+.L143:
+.L144:
+	cmpl $16, -8(%rbp)
+	jge .L148
+	.p2align 4,,10
+.L147:
+	movl $0, -72(%rbp)
+	movl -168(%rbp), %eax
+	pushq %rax
+	movl -164(%rbp), %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L147
+.L148:
+	addl $1, -56(%rbp)
+	cmpl $17, -56(%rbp)
+	jl .L139
+.L140:
+	movl $0, -52(%rbp)
+	movb $172, -33(%rbp)
+	movzwl -40(%rbp), %eax
+	movl %eax, -184(%rbp)
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -184(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -184(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movb $172, -33(%rbp)
+	movl -184(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movl $4, -52(%rbp)
+	movq $0, -16(%rbp)
+	movb $8, -1(%rbp)
+	movq 16(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movq %rdx, -16(%rbp)
+	movq %rcx, -24(%rbp)
+	movl %r8d, -28(%rbp)
+	movw %r9w, -30(%rbp)
+	movw $7, -32(%rbp)
+	movw $681, -34(%rbp)
+	movl $-2015349013, -40(%rbp)
+	movq $727, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $232, -40(%rbp), %eax
+	subl $232, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -40(%rbp)
+	jge .L149
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L150
+	.p2align 4,,10
+.L151:
+	addl $232, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $232, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $232, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $232, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -208(%rbp)
+	jne .L151
+.L152:
+.L149:
+.L150:
+	cmpl $33, -40(%rbp)
+	jge .L154
+	.p2align 4,,10
+.L153:
+	addl $232, -196(%rbp)
+	movslq -40(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L153
+.L154:
+	movswq 16(%rbp), %rax
+	pushq %rax
+	movl $87, %eax
+	pushq %rax
+	movl $2, %eax
+	movq %rax, %r9
+	movzwl -34(%rbp), %eax
+	movq %rax, %r8
+	movzwl -34(%rbp), %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $-1755747475, %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzwl 24(%rbp), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movw %ax, 16(%rbp)
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, %rsi
+	movswq -4(%rbp), %rax
+	cmpq %rax, -24(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f1
+	movq -24(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	addq $0, %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	movzbl %al, %eax
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	movl $7, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f2, .-f2
+	.align 16
+f3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movb %dl, -17(%rbp)
+	movq %rcx, -32(%rbp)
+	movl $1, -36(%rbp)
+	movw $4, -38(%rbp)
+	movq $7, -48(%rbp)
+	movw $585, -50(%rbp)
+	movw $655, -52(%rbp)
+	movl $10, -56(%rbp)
+	movq $613, -64(%rbp)
+	movl $0, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	testl %eax, %eax
+	je .L155
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L158
+	.p2align 4,,10
+.L157:
+	movslq -56(%rbp), %rax
+	imull $9, -56(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	imull $9, -56(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	imull $9, -56(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	imull $9, -56(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -144(%rbp)
+	jne .L157
+.L158:
+.L155:
+.L156:
+	cmpl $16, -56(%rbp)
+	jge .L160
+	.p2align 4,,10
+.L159:
+	movslq -56(%rbp), %rax
+	imull $9, -56(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L159
+.L160:
+	movl $0, -56(%rbp)
+	imull $68, -56(%rbp), %eax
+	subl $68, %eax
+	movl %eax, -212(%rbp)
+	cmpl $0, -132(%rbp)
+	je .L161
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -224(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L164
+	.p2align 4,,10
+.L163:
+	addl $68, -212(%rbp)
+	movslq -56(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $68, -212(%rbp)
+	movslq -56(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $68, -212(%rbp)
+	movslq -56(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	addl $68, -212(%rbp)
+	movslq -56(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -224(%rbp)
+	jne .L163
+.L164:
+.L161:
+.L162:
+	cmpl $16, -56(%rbp)
+	jge .L166
+	.p2align 4,,10
+.L165:
+	addl $68, -212(%rbp)
+	movslq -56(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L165
+.L166:
+	movsbl -17(%rbp), %eax
+	movl %eax, -228(%rbp)
+	cmpl $994, %eax
+	setl %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movl $65535, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $146, %eax
+	movq %rax, %rdx
+	movzwl -52(%rbp), %eax
+	movq %rax, %rsi
+	movl -36(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	pushq %rax
+	movslq -36(%rbp), %rax
+	movq %rax, %r9
+	movl $65535, %eax
+	movq %rax, %r8
+	movl $217, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movl $4059, %eax
+	movq %rax, %rsi
+	movzwl g0(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+	movl %eax, -36(%rbp)
+	cmpw $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -48(%rbp), %rax
+	ja .L167
+	movl $673, %eax
+	addl $9, %eax
+	movq %rax, %rcx
+	movswl -50(%rbp), %eax
+	cmpl %ecx, %eax
+	jge .L169
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L170
+.L173:
+	cmpl $0, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $8, -32(%rbp)
+	setb %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+.f3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L169:
+	movl $1, %eax
+.L170:
+	movl %eax, -56(%rbp)
+.L167:
+.L168:
+	movzwl g0(%rip), %eax
+	movq %rax, %rdx
+	movsbl -17(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -38(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movl %eax, -76(%rbp)
+	movabsq $441455615536, %rax
+	cmpq $5, %rax
+	jg .L173
+	movq -48(%rbp), %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl -36(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testq %rax, %rax
+	jne .L173
+.L171:
+.L172:
+	movzwl g0(%rip), %eax
+	cmpl $95, %eax
+	jg .L174
+	movq -64(%rbp), %rax
+	movl $1, %ecx
+	cqo
+	idivq %rcx
+	jmp .f3_return
+.L174:
+.L175:
+	movl -36(%rbp), %eax
+	cmpl -228(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	jmp .f3_return
+	.size f3, .-f3
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movb %dl, -5(%rbp)
+	movb $37, -6(%rbp)
+	movw $65535, -8(%rbp)
+	movw $10, -10(%rbp)
+	movl $885, -16(%rbp)
+	movq $274, -24(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jge .L176
+	movl $33, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -168(%rbp)
+	cmpq $0, -168(%rbp)
+	je .L179
+	.p2align 4,,10
+.L178:
+	movl -16(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	subq $1, -168(%rbp)
+	jne .L178
+.L179:
+.L176:
+.L177:
+	cmpl $33, -16(%rbp)
+	jge .L181
+	.p2align 4,,10
+.L180:
+	movl -16(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	cmpl $33, -16(%rbp)
+	jl .L180
+.L181:
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl $61, %eax
+	pushq %rax
+	movl $10, %eax
+	movq %rax, %r9
+	movl $35, %eax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movw %ax, -170(%rbp)
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl -16(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movswq -2(%rbp), %rax
+	movq %rax, -184(%rbp)
+	pushq %rax
+	movl -16(%rbp), %eax
+	pushq %rax
+	movslq -16(%rbp), %rax
+	movq %rax, %r9
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movzwl -170(%rbp), %eax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	movq %rax, %rdx
+	movl $989, %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	subq $8, %rsp
+	movswl -10(%rbp), %eax
+	movl %eax, -196(%rbp)
+	imull $0, %eax, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	jne .L182
+	movl $4, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L183
+.L182:
+	movl $1, %eax
+.L183:
+	pushq %rax
+	movzbl -6(%rbp), %eax
+	movl %eax, -188(%rbp)
+	imull -188(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movl $1, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movzbl -5(%rbp), %eax
+	movl %eax, -192(%rbp)
+	movq %rax, %rcx
+	movl -104(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	subl -188(%rbp), %eax
+	movq %rax, %rsi
+	cmpw $0, -4(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.0
+	addq $16, %rsp
+	movw $0, -4(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -204(%rbp)
+	cmpl $10, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -200(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -208(%rbp)
+	cmpl $4, %eax
+	jge .L185
+	.p2align 4,,10
+.L184:
+	subq $8, %rsp
+	xorl %eax, %eax
+	movzwl -8(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movswl -10(%rbp), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl -200(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movzbl -6(%rbp), %eax
+	movq %rax, %r9
+	movl $166, %eax
+	movq %rax, %r8
+	movl -80(%rbp), %eax
+	movq %rax, %rcx
+	movswq -10(%rbp), %rax
+	movq %rax, %rdx
+	movl $2147483647, %eax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	addq $8, %rsp
+	movsbq %al, %rax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $-128, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.3
+	addq $16, %rsp
+	movsbl %al, %eax
+	movw %ax, -8(%rbp)
+	movl -208(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -208(%rbp)
+	cmpl $4, %eax
+	jl .L184
+.L185:
+	movl $961, %eax
+	subq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	addq $21, %rax
+	cmpq %rcx, %rax
+	je .L188
+	movl $6, %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	pushq %rax
+	movzbl -6(%rbp), %eax
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movl $79, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl -196(%rbp), %eax
+	movq %rax, %rsi
+	movl -140(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	je .L186
+.L188:
+	cmpl $0, -188(%rbp)
+	jl .L189
+	cmpl $33, -188(%rbp)
+	jge .L189
+	movl $7, %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	addl $1, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -6(%rbp), %eax
+	movl %ecx, -160(%rbp,%rax,4)
+.L189:
+.L190:
+.L186:
+.L187:
+	movl $6, %eax
+	cmpl $12056, %eax
+	setge %al
+	movzbl %al, %eax
+	addl -208(%rbp), %eax
+	movw %ax, -4(%rbp)
+	movzwl g0(%rip), %eax
+	movzbl -6(%rbp), %ecx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -8(%rbp)
+	movl -196(%rbp), %eax
+	subl -192(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $58, %rax
+	jge .L199
+	cmpq $-2, %rax
+	je .L198
+	cmpq $33, %rax
+	je .L196
+	cmpq $43, %rax
+	je .L191
+.L194:
+	cmpw $0, g0(%rip)
+	jne .L229
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L230
+.L199:
+	cmpq $58, %rax
+	je .L197
+	cmpq $194, %rax
+	je .L192
+	cmpq $672, %rax
+	je .L193
+	jmp .L194
+.L197:
+	movl $65536, %eax
+	testl %eax, %eax
+	jne .L239
+	cmpw $0, -10(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L240
+.L239:
+	movl $1, %eax
+.L240:
+	pushq %rax
+	subq $8, %rsp
+	movl $8, %eax
+	pushq %rax
+	movzbl -5(%rbp), %eax
+	pushq %rax
+	movl $324, %eax
+	movq %rax, %r9
+	movl $128, %eax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movswq -4(%rbp), %rax
+	movq %rax, %rdx
+	movl -204(%rbp), %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jle .L237
+	movl $276, %eax
+	testl %eax, %eax
+	je .L237
+	cmpw $0, -2(%rbp)
+	je .L238
+	xorl %eax, %eax
+	movzwl g0(%rip), %ecx
+	subl %ecx, %eax
+	movb %al, -6(%rbp)
+	cmpl $0, -16(%rbp)
+	jl .L243
+	cmpl $33, -16(%rbp)
+	jge .L243
+	movslq -16(%rbp), %rax
+	movl -48(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+.L243:
+.L244:
+	movslq -16(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	addl -16(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+.L241:
+.L242:
+	jmp .L238
+.L237:
+	movzwl -8(%rbp), %eax
+	movswl -4(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -6(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -6(%rbp)
+	movl ga0+28(%rip), %eax
+	movb %al, -6(%rbp)
+	movl $764, %eax
+	pushq %rax
+	movl $255, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $128, %eax
+	movq %rax, %r8
+	movzbl -6(%rbp), %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl $581, %eax
+	movq %rax, %rsi
+	movl -92(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	jne .LB0
+.L245:
+.L246:
+.L238:
+	movl $1, %eax
+	movl ga0+28(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movswl -10(%rbp), %eax
+	subl $7, %eax
+	pushq %rax
+	movl $770, %eax
+	movl ga0+4(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzwl -8(%rbp), %eax
+	cmpl $1, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -104(%rbp), %eax
+	pushq %rax
+	movzwl -8(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $204, %eax
+	pushq %rax
+	movswl -10(%rbp), %eax
+	movq %rax, %r9
+	movl $48, %eax
+	movq %rax, %r8
+	movzwl g0(%rip), %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movzbl -6(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $16, %rsp
+	movsbl %al, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L198:
+	movw $2, -4(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -248(%rbp)
+	imull -248(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -244(%rbp)
+	movl $3, %eax
+	cmpl $6, %eax
+	setle %al
+	movzbl %al, %eax
+	imull $10, %eax, %eax
+	movl %eax, -252(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -256(%rbp)
+	cmpl $17, %eax
+	jge .L248
+	.p2align 4,,10
+.L247:
+	movq -24(%rbp), %rax
+	movslq -244(%rbp), %rcx
+	cqo
+	idivq %rcx
+	subq $10, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L255
+	leaq .L256(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L249
+	# table target .L250
+	# table target .L251
+	# table target .L254
+	# table target .L253
+	# table target .L252
+	jmp *%rcx
+.L255:
+.L249:
+	movl -256(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -256(%rbp)
+	cmpl $17, %eax
+	jl .L247
+.L248:
+	movabsq $215349800860, %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	movzbl -6(%rbp), %eax
+	movsbq %al, %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movb %al, -6(%rbp)
+.L191:
+	movw $0, -2(%rbp)
+	movl $311, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl %eax, -260(%rbp)
+	movl $9, %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -264(%rbp)
+	movabsq $573667414559, %rax
+	cmpq $6, %rax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -268(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -276(%rbp)
+	imull -276(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -272(%rbp)
+	movl $8, %eax
+	testl %eax, %eax
+	jne .L263
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L264
+.L263:
+	movl $1, %eax
+.L264:
+	movl %eax, -280(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -284(%rbp)
+	cmpl $4, %eax
+	jge .L266
+	.p2align 4,,10
+.L265:
+	xorl %eax, %eax
+	subl -16(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	pushq %rax
+	movl -136(%rbp), %eax
+	pushq %rax
+	movswq -10(%rbp), %rax
+	movq %rax, %r9
+	movswl -10(%rbp), %eax
+	movq %rax, %r8
+	movswl -2(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movzbl -5(%rbp), %eax
+	movq %rax, %rsi
+	movswl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jl .L267
+.L266:
+	movzbl -6(%rbp), %eax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movzbl -5(%rbp), %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl $160, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movq %rax, %rdx
+	movl $134, %eax
+	movq %rax, %rsi
+	movl $81, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbq %al, %rax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L267:
+.L268:
+	movl $8, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L275
+	leaq .L276(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L270
+	# table target .L273
+	# table target .L271
+	# table target .L274
+	# table target .L272
+	jmp *%rcx
+.L275:
+.L270:
+	cmpq $0, -24(%rbp)
+	jne .L277
+	movl -284(%rbp), %eax
+	imull -284(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	cltd
+	idivl %ecx
+	cmpl -260(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .L278
+.L277:
+	movl $1, %eax
+.L278:
+	movl %eax, -16(%rbp)
+	movl -284(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -48(%rbp), %eax
+	pushq %rax
+	movslq -264(%rbp), %rax
+	movq %rax, %r9
+	movl -116(%rbp), %eax
+	movzbl -6(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movzbl -5(%rbp), %eax
+	movq %rax, %rcx
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movl -120(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movb %al, -5(%rbp)
+.L269:
+	movzbl -6(%rbp), %eax
+	movswl -10(%rbp), %ecx
+	cmpl %ecx, %eax
+	jne .L294
+	jmp .L266
+.L294:
+.L295:
+	movl -284(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -2(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -284(%rbp)
+	cmpl $4, %eax
+	jl .L265
+	jmp .L266
+.L192:
+	movzbl -6(%rbp), %eax
+	movl %eax, -212(%rbp)
+	imull -212(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl $382, %eax
+	testl %eax, %eax
+	jne .L202
+	movswl -4(%rbp), %eax
+	imull -16(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L203
+.L202:
+	movl $1, %eax
+.L203:
+	popq %rcx
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L200
+	movw $0, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -216(%rbp)
+	cmpl $100, %eax
+	jge .L205
+	.p2align 4,,10
+.L204:
+	movzwl g0(%rip), %eax
+	movzwl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	cltd
+	idivl %ecx
+	movl %eax, -16(%rbp)
+	movl -216(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -216(%rbp)
+	cmpl $100, %eax
+	jl .L204
+.L205:
+	movabsq $546459079195, %rax
+	testq %rax, %rax
+	jne .L206
+	movl $556, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L207
+.L229:
+	movl $1, %eax
+.L230:
+	movslq %eax, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $37, %eax
+	cqo
+	idivq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L227
+	cmpq $58, %rax
+	je .L224
+	cmpq $865, %rax
+	je .L225
+.L226:
+	movswq -4(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl $4, %eax
+	movq %rax, %r9
+	movl $128, %eax
+	movq %rax, %r8
+	movl $703, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movl $-120, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	cmpw $0, -2(%rbp)
+	je .L233
+	movl $595, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L234
+.L196:
+	xorl %eax, %eax
+	subl -204(%rbp), %eax
+	pushq %rax
+	movl ga0+24(%rip), %eax
+	testl %eax, %eax
+	jne .L235
+	cmpw $0, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L236
+.L235:
+	movl $1, %eax
+.L236:
+	popq %rcx
+	subl %ecx, %eax
+	movw %ax, -10(%rbp)
+	jmp .L191
+.L200:
+	movw $1, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -220(%rbp)
+	cmpl $8, %eax
+	jge .L209
+	.p2align 4,,10
+.L208:
+	movl ga0+28(%rip), %eax
+	movl %eax, -44(%rbp)
+	movl -220(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -220(%rbp)
+	cmpl $8, %eax
+	jl .L208
+.L209:
+	movswl -4(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $29, %rax
+	jge .L217
+	cmpq $3, %rax
+	je .L216
+	cmpq $8, %rax
+	je .L210
+	jmp .L212
+.L193:
+	movzwl -8(%rbp), %eax
+	movabsq $360090198617, %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	movl $7, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpb $0, -6(%rbp)
+	jne .L220
+	cmpw $0, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L221
+.L220:
+	movl $1, %eax
+.L221:
+	pushq %rax
+	cmpw $0, -4(%rbp)
+	jne .L222
+	movl $1000000007, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L223
+.L222:
+	movl $1, %eax
+.L223:
+	pushq %rax
+	movzbl -6(%rbp), %eax
+	cmpl $6, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movswl -10(%rbp), %eax
+	addl $10, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $32767, %eax
+	pushq %rax
+	movzwl g0(%rip), %eax
+	pushq %rax
+	movl $8, %eax
+	movq %rax, %r9
+	movl $249, %eax
+	movq %rax, %r8
+	movl $10, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $500, %eax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L191
+.L227:
+.L224:
+	movw $748, -4(%rbp)
+	jmp .L191
+.L195:
+	jmp .L191
+.L206:
+	movl $1, %eax
+.L207:
+	imull -16(%rbp), %eax
+	movw %ax, -8(%rbp)
+	jmp .L191
+.L218:
+	movl $1, %eax
+.L219:
+	pushq %rax
+	movl ga0+16(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -212(%rbp), %eax
+	movq %rax, %rsi
+	movswl -4(%rbp), %eax
+	movl %eax, -224(%rbp)
+	imull -224(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L212:
+	movl ga0+8(%rip), %eax
+	addl $8, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpl $8, -204(%rbp)
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -184(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl $733, %eax
+	movq %rax, %r9
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movl $608, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $81, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbq %al, %rax
+	pushq %rax
+	movzwl g0(%rip), %eax
+	cmpl $711, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movswl -4(%rbp), %eax
+	addl $32767, %eax
+	pushq %rax
+	movswq -10(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movl %eax, -228(%rbp)
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl $10, %eax
+	movq %rax, %r9
+	movzbl -6(%rbp), %eax
+	movq %rax, %r8
+	movl $146, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -228(%rbp), %eax
+	movq %rax, %rsi
+	movl $109, %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $8, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl -52(%rbp), %eax
+	movw %ax, -4(%rbp)
+.L216:
+.L210:
+	movl $8, %eax
+	movzbl -5(%rbp), %ecx
+	subq %rcx, %rax
+	addq $6, %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movw %ax, -10(%rbp)
+.L201:
+	jmp .L191
+.L228:
+	jmp .L224
+.L217:
+	cmpq $29, %rax
+	je .L210
+	cmpq $61, %rax
+	je .L211
+	cmpq $445, %rax
+	je .L214
+	jmp .L212
+.L225:
+	movzwl -8(%rbp), %eax
+	movl %eax, -232(%rbp)
+	testl %eax, %eax
+	jl .L231
+	cmpl $33, -232(%rbp)
+	jge .L231
+	movzwl -8(%rbp), %eax
+	movl $8, -160(%rbp,%rax,4)
+.L231:
+.L232:
+	movw $934, -4(%rbp)
+	jmp .L224
+.L233:
+	movl $0, %eax
+.L234:
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	addl %ecx, %eax
+	popq %rcx
+	imull %ecx, %eax
+	movl %eax, -16(%rbp)
+	jmp .L224
+.L215:
+	jmp .L210
+.L211:
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl ga0+4(%rip), %eax
+	cmpl $10, %eax
+	seta %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $481, %eax
+	pushq %rax
+	movl -136(%rbp), %eax
+	cmpl $3, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpw $0, -10(%rbp)
+	jne .L218
+	cmpb $0, -5(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L219
+.L213:
+	jmp .L210
+.L214:
+	movl $541, %eax
+	pushq %rax
+	movswl -4(%rbp), %eax
+	pushq %rax
+	movq $-514715724, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $2, %eax
+	pushq %rax
+	movl -32(%rbp), %eax
+	pushq %rax
+	movzbl -5(%rbp), %eax
+	movq %rax, %r9
+	xorl %eax, %eax
+	movq %rax, %r8
+	movswl -2(%rbp), %eax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movsbl %al, %eax
+	movq %rax, %r8
+	movswl -4(%rbp), %eax
+	movq %rax, %rcx
+	movswq -2(%rbp), %rax
+	movq %rax, %rdx
+	movl $-1, %eax
+	movq %rax, %rsi
+	movzbl -6(%rbp), %eax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L210
+.L250:
+	movslq -252(%rbp), %rax
+	movq %rax, -24(%rbp)
+.L251:
+	jmp .L249
+.L252:
+	movzbl -6(%rbp), %eax
+	pushq %rax
+	movl $219, %eax
+	pushq %rax
+	movl $483, %eax
+	movq %rax, %r9
+	movswl -10(%rbp), %eax
+	movq %rax, %r8
+	movl $381, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl $317, %eax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	cmpl %eax, -256(%rbp)
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpw $0, -4(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movb %al, -5(%rbp)
+	movl $379, %eax
+	pushq %rax
+	movl ga0+8(%rip), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movq %rax, %r9
+	xorl %eax, %eax
+	movq %rax, %r8
+	movl $525, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl -64(%rbp), %eax
+	movq %rax, %rsi
+	movl $73, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	cmpq $0, -24(%rbp)
+	jne .L259
+	cmpw $0, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L260
+.L259:
+	movl $1, %eax
+.L260:
+	popq %rcx
+	addl %ecx, %eax
+	je .L257
+	jmp .L249
+.L257:
+.L258:
+.L253:
+	cmpb $0, -5(%rbp)
+	je .L249
+	jmp .L249
+.L261:
+.L262:
+	jmp .L249
+.L254:
+	jmp .L249
+.L271:
+	movl -284(%rbp), %eax
+	cmpl -276(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movl -84(%rbp), %ecx
+	subl %ecx, %eax
+	je .L279
+	movzbl -5(%rbp), %eax
+	cmpq -24(%rbp), %rax
+	jge .L281
+	jmp .L269
+.L281:
+.L282:
+.L279:
+.L280:
+	movw $0, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -288(%rbp)
+	cmpl $100, %eax
+	jge .L284
+	.p2align 4,,10
+.L283:
+	movl $996, %eax
+	pushq %rax
+	movl $60, %eax
+	pushq %rax
+	movl $130, %eax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $210, %eax
+	movq %rax, %rsi
+	movzwl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzbl -6(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -6(%rbp)
+	movl -288(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -288(%rbp)
+	cmpl $100, %eax
+	jl .L283
+.L284:
+.L272:
+	movl $65, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movl -60(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -5(%rbp), %eax
+	movq %rax, %rdx
+	movl $88, %eax
+	movq %rax, %rsi
+	movzbl -5(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -2(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	jmp .L269
+.L273:
+	movw $9, -8(%rbp)
+	jmp .L269
+.L274:
+	movswq -4(%rbp), %rax
+	movq %rax, -304(%rbp)
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movzbl -5(%rbp), %eax
+	movq %rax, %r9
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movzbl -5(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -6(%rbp), %eax
+	movl %eax, -308(%rbp)
+	movq %rax, %rsi
+	movl ga0+16(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbq %al, %rax
+	pushq %rax
+	movl -308(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	pushq %rax
+	movq -304(%rbp), %rax
+	movq %rax, %r9
+	movswl -10(%rbp), %eax
+	movq %rax, %r8
+	movslq -16(%rbp), %rax
+	movq %rax, -296(%rbp)
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	movq %rax, %rdx
+	movswl -10(%rbp), %eax
+	cmpl -276(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	je .L285
+	movslq -280(%rbp), %rax
+	pushq %rax
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl -276(%rbp), %eax
+	cltd
+	idivl -272(%rbp)
+	movslq %eax, %rax
+	movq %rax, %r9
+	movq -296(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movzwl -8(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movslq -268(%rbp), %rax
+	movq %rax, %rdx
+	movl $-1018636465, %eax
+	movq %rax, %rsi
+	movl ga0+16(%rip), %eax
+	addl $256, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	xorl %eax, %eax
+	jne .L287
+	cmpb $0, -5(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L288
+.L287:
+	movl $1, %eax
+.L288:
+	movq %rax, %rcx
+	movswq -2(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+.L291:
+.L292:
+.L286:
+	jmp .L269
+.L285:
+	movzwl -8(%rbp), %eax
+	pushq %rax
+	movswl -4(%rbp), %eax
+	pushq %rax
+	movswq -10(%rbp), %rax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movswl -4(%rbp), %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $65535, %eax
+	movq %rax, %rsi
+	movl $-1, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	je .L289
+	jmp .L269
+.L289:
+.L290:
+	addl $7, -16(%rbp)
+	cmpw $0, -8(%rbp)
+	jne .L269
+	movl -308(%rbp), %eax
+	subl -308(%rbp), %eax
+	je .L269
+.L293:
+	jmp .L269
+.LB0:
+	movswq -10(%rbp), %rax
+	movq %rax, -240(%rbp)
+	pushq %rax
+	movl $129, %eax
+	pushq %rax
+	movq -240(%rbp), %rax
+	movq %rax, %r9
+	movzbl -6(%rbp), %eax
+	movq %rax, %r8
+	movl $32767, %eax
+	movq %rax, %rcx
+	movl -124(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $256, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbq %al, %rax
+	jmp .f1_return
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L256:
+	.long .L250-.L256
+	.long .L251-.L256
+	.long .L249-.L256
+	.long .L249-.L256
+	.long .L249-.L256
+	.long .L249-.L256
+	.long .L249-.L256
+	.long .L254-.L256
+	.long .L253-.L256
+	.long .L252-.L256
+	.p2align 2
+.L276:
+	.long .L273-.L276
+	.long .L270-.L276
+	.long .L271-.L276
+	.long .L270-.L276
+	.long .L274-.L276
+	.long .L270-.L276
+	.long .L272-.L276
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $1232, %rsp
+	movb $8, -1(%rbp)
+	movb $0, -2(%rbp)
+	movw $220, -4(%rbp)
+	movw $-13817, -6(%rbp)
+	movw $16, -8(%rbp)
+	movl $322, -12(%rbp)
+	movq $9, -24(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -164(%rbp)
+	testl %eax, %eax
+	je .L296
+	movl $33, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L299
+	.p2align 4,,10
+.L298:
+	movslq -12(%rbp), %rax
+	movq %rax, -184(%rbp)
+	movabsq $413439201207, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -184(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $413439201207, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $413439201207, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movabsq $413439201207, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -208(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	subq $1, -176(%rbp)
+	jne .L298
+.L299:
+.L296:
+.L297:
+	cmpl $33, -12(%rbp)
+	jge .L301
+	.p2align 4,,10
+.L300:
+	movslq -12(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movabsq $413439201207, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jl .L300
+.L301:
+	movl $0, -12(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L302
+	movl $33, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -360(%rbp)
+	cmpq $0, -360(%rbp)
+	je .L305
+	.p2align 4,,10
+.L304:
+	movslq -12(%rbp), %rax
+	movq %rax, -368(%rbp)
+	leaq (,%rax,1), %rax
+	movq %rax, %rcx
+	movq -368(%rbp), %rax
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -376(%rbp)
+	leaq (,%rax,1), %rax
+	movq %rax, %rcx
+	movq -376(%rbp), %rax
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -384(%rbp)
+	leaq (,%rax,1), %rax
+	movq %rax, %rcx
+	movq -384(%rbp), %rax
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movq %rax, -392(%rbp)
+	leaq (,%rax,1), %rax
+	movq %rax, %rcx
+	movq -392(%rbp), %rax
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	subq $1, -360(%rbp)
+	jne .L304
+.L305:
+.L302:
+.L303:
+	cmpl $33, -12(%rbp)
+	jge .L307
+	.p2align 4,,10
+.L306:
+	movslq -12(%rbp), %rax
+	movq %rax, -400(%rbp)
+	leaq (,%rax,1), %rax
+	movq %rax, %rcx
+	movq -400(%rbp), %rax
+	movl %ecx, -352(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jl .L306
+.L307:
+	movzbl -1(%rbp), %eax
+	movq %rax, -408(%rbp)
+	cmpq -24(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	cmpl -12(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl $4, %eax
+	testl %eax, %eax
+	je .L308
+	movl ga0+20(%rip), %eax
+	movswl -6(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl $390, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -8(%rbp)
+	jmp .L309
+.L308:
+	movl $211, ga0+12(%rip)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	cmpl $903, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	addq -408(%rbp), %rax
+	movb %al, -1(%rbp)
+.L309:
+	subq $8, %rsp
+	movl ga0+28(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -276(%rbp), %eax
+	movq %rax, %r9
+	movl $2, %eax
+	movq %rax, %r8
+	movl $536, %eax
+	movq %rax, %rcx
+	movl $981, %eax
+	movq %rax, %rdx
+	movl $49, %eax
+	movq %rax, %rsi
+	movswl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $16, %rsp
+	movsbl %al, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L317
+	leaq .L318(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L313
+	# table target .L315
+	# table target .L312
+	# table target .L316
+	# table target .L314
+	# table target .L311
+	jmp *%rcx
+.L317:
+.L313:
+	cmpw $0, g0(%rip)
+	je .L355
+	movl $436, -36(%rbp)
+	movl $32767, %eax
+	testl %eax, %eax
+	je .L357
+	movzwl -8(%rbp), %eax
+	movl -140(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $4, %eax
+	addl $190, %eax
+	pushq %rax
+	movswl -4(%rbp), %eax
+	cmpl $201, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl $7, %eax
+	addl $542, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	imull $480, %eax, %eax
+	movq %rax, %rsi
+	cmpl $255, -12(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+	movw %ax, -4(%rbp)
+	xorl %eax, %eax
+	subl $10, %eax
+	movq %rax, %rdx
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl -12(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movw %ax, -8(%rbp)
+	movzwl -8(%rbp), %eax
+	pushq %rax
+	movl $66, %eax
+	pushq %rax
+	movl $797, %eax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movabsq $1093937325984, %rax
+	movq %rax, %rdx
+	movzwl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -12(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbq %al, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $228, %eax
+	movq %rax, %rdx
+	movl $-1, %eax
+	movq %rax, %rsi
+	movzbl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movabsq $856408165962, %rax
+	testq %rax, %rax
+	jne .L359
+	cmpb $0, -2(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L360
+.L359:
+	movl $1, %eax
+.L360:
+	movswl %ax, %eax
+	popq %rcx
+	subl %ecx, %eax
+	movb %al, -1(%rbp)
+.L357:
+.L358:
+	movzbl -2(%rbp), %eax
+	movb %al, -1(%rbp)
+	jmp .L356
+.L355:
+	movl $1, -12(%rbp)
+	cmpl $100, -12(%rbp)
+	jge .L362
+	.p2align 4,,10
+.L361:
+	movl $60, %eax
+	testq %rax, %rax
+	jne .L363
+.L362:
+	cmpl $0, -12(%rbp)
+	jl .L365
+	cmpl $33, -12(%rbp)
+	jge .L365
+	movzbl -1(%rbp), %eax
+	movl %eax, -540(%rbp)
+	imull -540(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movslq -12(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+.L365:
+.L366:
+	movzwl -8(%rbp), %eax
+	movl %eax, -544(%rbp)
+	imull -544(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -544(%rbp), %eax
+	cltd
+	idivl %ecx
+	movl %eax, -276(%rbp)
+.L356:
+	movzbl -1(%rbp), %eax
+	movl %eax, -548(%rbp)
+	movl ga0+20(%rip), %eax
+	movl %eax, -552(%rbp)
+	movl ga0+8(%rip), %eax
+	addl -552(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L367:
+.L314:
+	movw $1, -4(%rbp)
+	movzbl -1(%rbp), %eax
+	addq -24(%rbp), %rax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movl %eax, -560(%rbp)
+	subl $1, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -556(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -564(%rbp)
+	cmpl $3, %eax
+	jge .L369
+	.p2align 4,,10
+.L368:
+	movw $0, -6(%rbp)
+	movl -556(%rbp), %eax
+	movl %eax, -568(%rbp)
+	movswl -6(%rbp), %eax
+	movl %eax, -572(%rbp)
+	cmpl $3, %eax
+	jge .L371
+	.p2align 4,,10
+.L370:
+	cmpl $0, -568(%rbp)
+	je .L372
+.L371:
+	movl -560(%rbp), %eax
+	movl %eax, -12(%rbp)
+	movl -564(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -564(%rbp)
+	cmpl $3, %eax
+	jl .L368
+.L369:
+	movl ga0+8(%rip), %eax
+	addl $7, %eax
+	movl %eax, ga0+0(%rip)
+.L406:
+.L310:
+	movzbl -2(%rbp), %eax
+	movl %eax, -724(%rbp)
+	cmpl %eax, -724(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	cmpl $649, %eax
+	setne %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L472
+	leaq .L473(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L466
+	# table target .L467
+	# table target .L471
+	# table target .L468
+	# table target .L470
+	# table target .L469
+	jmp *%rcx
+.L372:
+.L373:
+	movslq -12(%rbp), %rax
+	movq %rax, -584(%rbp)
+	cmpq $4, -584(%rbp)
+	jl .L379
+	cmpq $18, -584(%rbp)
+	jle .L377
+.L379:
+	movq -584(%rbp), %rax
+	addq $8, %rax
+.L376:
+	testq %rax, %rax
+	je .L374
+	jmp .L371
+.L374:
+.L375:
+	movswl -4(%rbp), %eax
+	testb %al, %al
+	je .L404
+	jmp .L371
+.L377:
+.L378:
+	movq -584(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -640(%rbp)
+	cmpq $4, -640(%rbp)
+	jl .L383
+	cmpq $18, -640(%rbp)
+	jle .L381
+.L383:
+	movq -640(%rbp), %rax
+	addq $8, %rax
+.L380:
+	pushq %rax
+	movq -584(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -592(%rbp)
+	movl $8, %eax
+	addq $1, %rax
+	movq %rax, -600(%rbp)
+	cmpq $4, -592(%rbp)
+	jl .L395
+	cmpq $18, -592(%rbp)
+	jle .L393
+.L395:
+	movq -600(%rbp), %rax
+	addq -592(%rbp), %rax
+.L392:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L376
+.L404:
+.L405:
+	movl -572(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -6(%rbp)
+	movswl -6(%rbp), %eax
+	movl %eax, -572(%rbp)
+	cmpl $3, %eax
+	jl .L370
+	jmp .L371
+.L472:
+.L466:
+	movabsq $745265904175, %rax
+	subq -24(%rbp), %rax
+	movq %rax, -1096(%rbp)
+	movabsq $276573654626, %rax
+	cmpq $4, %rax
+	jl .L594
+	movabsq $276573654626, %rax
+	cmpq $18, %rax
+	jle .L592
+.L594:
+	movabsq $276573654626, %rax
+	addq -1096(%rbp), %rax
+.L591:
+	movswq -6(%rbp), %rax
+	movq %rax, %rcx
+	movl $-70, %eax
+	movq %rax, %rdx
+	movslq -12(%rbp), %rax
+	movq %rax, %rsi
+	movzbl -1(%rbp), %eax
+	movq %rax, %rdi
+	call f3
+	movb %al, -1(%rbp)
+	movzwl g0(%rip), %eax
+	addl %eax, -12(%rbp)
+	movq $0, -1200(%rbp)
+	imulq $31, -1200(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	imulq $31, -1200(%rbp), %rax
+	movzbl -1(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	imulq $31, -1200(%rbp), %rax
+	movzbl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	imulq $31, -1200(%rbp), %rax
+	movswq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	imulq $31, -1200(%rbp), %rax
+	movswq -6(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	imulq $31, -1200(%rbp), %rax
+	movzwl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	imulq $31, -1200(%rbp), %rax
+	movslq -12(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	imulq $31, -1200(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -1200(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jge .L619
+	movl $8, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -1208(%rbp)
+	cmpq $0, -1208(%rbp)
+	je .L622
+	.p2align 4,,10
+.L621:
+	movslq -12(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -1208(%rbp)
+	jne .L621
+.L622:
+.L619:
+.L620:
+	cmpl $8, -12(%rbp)
+	jge .L624
+	.p2align 4,,10
+.L623:
+	movslq -12(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $8, -12(%rbp)
+	jl .L623
+.L624:
+	movl $0, -12(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L625
+	movl $33, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -1216(%rbp)
+	cmpq $0, -1216(%rbp)
+	je .L628
+	.p2align 4,,10
+.L627:
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -1216(%rbp)
+	jne .L627
+.L628:
+.L625:
+.L626:
+	cmpl $33, -12(%rbp)
+	jge .L630
+	.p2align 4,,10
+.L629:
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jl .L629
+.L630:
+	movl $0, -12(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L631
+	movl $33, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -1224(%rbp)
+	cmpq $0, -1224(%rbp)
+	je .L634
+	.p2align 4,,10
+.L633:
+	movslq -12(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -1224(%rbp)
+	jne .L633
+.L634:
+.L631:
+.L632:
+	cmpl $33, -12(%rbp)
+	jge .L636
+	.p2align 4,,10
+.L635:
+	movslq -12(%rbp), %rax
+	movl -352(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -1200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jl .L635
+.L636:
+	movq -1200(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -1200(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -1200(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -1200(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -1200(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -1200(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -1200(%rbp)
+	movq -1200(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L592:
+.L593:
+	movabsq $276573654626, %rax
+	subq $4, %rax
+	movq %rax, -1152(%rbp)
+	movq -1096(%rbp), %rax
+	movq %rax, -1160(%rbp)
+	cmpq $4, -1152(%rbp)
+	jl .L598
+	cmpq $18, -1152(%rbp)
+	jle .L596
+.L598:
+	movq -1160(%rbp), %rax
+	addq -1152(%rbp), %rax
+.L595:
+	pushq %rax
+	movabsq $276573654626, %rax
+	subq $1, %rax
+	movq %rax, -1104(%rbp)
+	movq -1096(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -1112(%rbp)
+	cmpq $4, -1104(%rbp)
+	jl .L610
+	cmpq $18, -1104(%rbp)
+	jle .L608
+.L610:
+	movq -1112(%rbp), %rax
+	addq -1104(%rbp), %rax
+.L607:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L591
+.L381:
+.L382:
+	movq -640(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -664(%rbp)
+	cmpq $4, -664(%rbp)
+	jl .L387
+	cmpq $18, -664(%rbp)
+	jle .L385
+.L387:
+	movq -664(%rbp), %rax
+	addq $8, %rax
+.L384:
+	pushq %rax
+	movq -640(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -648(%rbp)
+	movl $8, %eax
+	addq $1, %rax
+	movq %rax, -656(%rbp)
+	cmpq $4, -648(%rbp)
+	jl .L391
+	cmpq $18, -648(%rbp)
+	jle .L389
+.L391:
+	movq -656(%rbp), %rax
+	addq -648(%rbp), %rax
+.L388:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L380
+.L393:
+.L394:
+	movq -592(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -624(%rbp)
+	movq -600(%rbp), %rax
+	movq %rax, -632(%rbp)
+	cmpq $4, -624(%rbp)
+	jl .L399
+	cmpq $18, -624(%rbp)
+	jle .L397
+.L399:
+	movq -632(%rbp), %rax
+	addq -624(%rbp), %rax
+.L396:
+	pushq %rax
+	movq -592(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -608(%rbp)
+	movq -600(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -616(%rbp)
+	cmpq $4, -608(%rbp)
+	jl .L403
+	cmpq $18, -608(%rbp)
+	jle .L401
+.L403:
+	movq -616(%rbp), %rax
+	addq -608(%rbp), %rax
+.L400:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L392
+.L363:
+.L364:
+	addl $1, -12(%rbp)
+	cmpl $100, -12(%rbp)
+	jl .L361
+	jmp .L362
+.L596:
+.L597:
+	movq -1152(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -1184(%rbp)
+	movq -1160(%rbp), %rax
+	movq %rax, -1192(%rbp)
+	cmpq $4, -1184(%rbp)
+	jl .L602
+	cmpq $18, -1184(%rbp)
+	jle .L600
+.L602:
+	movq -1192(%rbp), %rax
+	addq -1184(%rbp), %rax
+.L599:
+	pushq %rax
+	movq -1152(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -1168(%rbp)
+	movq -1160(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -1176(%rbp)
+	cmpq $4, -1168(%rbp)
+	jl .L606
+	cmpq $18, -1168(%rbp)
+	jle .L604
+.L606:
+	movq -1176(%rbp), %rax
+	addq -1168(%rbp), %rax
+.L603:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L595
+.L608:
+.L609:
+	movq -1104(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -1136(%rbp)
+	movq -1112(%rbp), %rax
+	movq %rax, -1144(%rbp)
+	cmpq $4, -1136(%rbp)
+	jl .L614
+	cmpq $18, -1136(%rbp)
+	jle .L612
+.L614:
+	movq -1144(%rbp), %rax
+	addq -1136(%rbp), %rax
+.L611:
+	pushq %rax
+	movq -1104(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -1120(%rbp)
+	movq -1112(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -1128(%rbp)
+	cmpq $4, -1120(%rbp)
+	jl .L618
+	cmpq $18, -1120(%rbp)
+	jle .L616
+.L618:
+	movq -1128(%rbp), %rax
+	addq -1120(%rbp), %rax
+.L615:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L607
+.L385:
+.L386:
+	movl $8, %eax
+	movq %rax, %rsi
+	movq -664(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $8, %eax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -664(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L384
+.L389:
+.L390:
+	subq $8, %rsp
+	movq -656(%rbp), %rax
+	movq %rax, %rsi
+	movq -648(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -656(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -648(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L388
+.L397:
+.L398:
+	subq $8, %rsp
+	movq -632(%rbp), %rax
+	movq %rax, %rsi
+	movq -624(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -632(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -624(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L396
+.L401:
+.L402:
+	movq -616(%rbp), %rax
+	movq %rax, %rsi
+	movq -608(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -616(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -608(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L400
+.L600:
+.L601:
+	movq -1192(%rbp), %rax
+	movq %rax, %rsi
+	movq -1184(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -1192(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -1184(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L599
+.L604:
+.L605:
+	subq $8, %rsp
+	movq -1176(%rbp), %rax
+	movq %rax, %rsi
+	movq -1168(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -1176(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -1168(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L603
+.L612:
+.L613:
+	subq $8, %rsp
+	movq -1144(%rbp), %rax
+	movq %rax, %rsi
+	movq -1136(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -1144(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -1136(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L611
+.L616:
+.L617:
+	movq -1128(%rbp), %rax
+	movq %rax, %rsi
+	movq -1120(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -1128(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -1120(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L615
+.L311:
+	movw $0, -8(%rbp)
+	movw $0, -6(%rbp)
+	movl $3, %eax
+	movabsq $631221836613, %rcx
+	subq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movswl -6(%rbp), %eax
+	movl %eax, -420(%rbp)
+	cmpl $4, %eax
+	jge .L310
+	.p2align 4,,10
+.L319:
+	movq $0, -24(%rbp)
+	movq -416(%rbp), %rax
+	movq %rax, -432(%rbp)
+	cmpq $5, -24(%rbp)
+	jge .L322
+	.p2align 4,,10
+.L321:
+	movzwl -8(%rbp), %eax
+	movq %rax, -440(%rbp)
+	movl $256, %eax
+	cmpq $4, %rax
+	jl .L326
+	movl $256, %eax
+	cmpq $18, %rax
+	jle .L324
+.L326:
+	movq -440(%rbp), %rax
+	addq $256, %rax
+.L323:
+	cmpq %rax, -432(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movb %al, -2(%rbp)
+	cmpb $0, -2(%rbp)
+	je .L351
+.L322:
+	movq $1000000007, -24(%rbp)
+	movl $2, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -8(%rbp)
+	movl -420(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -6(%rbp)
+	movswl -6(%rbp), %eax
+	movl %eax, -420(%rbp)
+	cmpl $4, %eax
+	jl .L319
+.L320:
+	jmp .L310
+.L351:
+.L352:
+	cmpb $0, -2(%rbp)
+	je .L353
+	jmp .L322
+.L324:
+.L325:
+	movl $256, %eax
+	subq $4, %rax
+	movq %rax, -496(%rbp)
+	movq -440(%rbp), %rax
+	movq %rax, -504(%rbp)
+	cmpq $4, -496(%rbp)
+	jl .L330
+	cmpq $18, -496(%rbp)
+	jle .L328
+.L330:
+	movq -504(%rbp), %rax
+	addq -496(%rbp), %rax
+.L327:
+	pushq %rax
+	movl $256, %eax
+	subq $1, %rax
+	movq %rax, -448(%rbp)
+	movq -440(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -456(%rbp)
+	cmpq $4, -448(%rbp)
+	jl .L342
+	cmpq $18, -448(%rbp)
+	jle .L340
+.L342:
+	movq -456(%rbp), %rax
+	addq -448(%rbp), %rax
+.L339:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L323
+.L353:
+.L354:
+	addq $1, -24(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L321
+	jmp .L322
+.L328:
+.L329:
+	movq -496(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -528(%rbp)
+	movq -504(%rbp), %rax
+	movq %rax, -536(%rbp)
+	cmpq $4, -528(%rbp)
+	jl .L334
+	cmpq $18, -528(%rbp)
+	jle .L332
+.L334:
+	movq -536(%rbp), %rax
+	addq -528(%rbp), %rax
+.L331:
+	pushq %rax
+	movq -496(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -512(%rbp)
+	movq -504(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -520(%rbp)
+	cmpq $4, -512(%rbp)
+	jl .L338
+	cmpq $18, -512(%rbp)
+	jle .L336
+.L338:
+	movq -520(%rbp), %rax
+	addq -512(%rbp), %rax
+.L335:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L327
+.L340:
+.L341:
+	movq -448(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -480(%rbp)
+	movq -456(%rbp), %rax
+	movq %rax, -488(%rbp)
+	cmpq $4, -480(%rbp)
+	jl .L346
+	cmpq $18, -480(%rbp)
+	jle .L344
+.L346:
+	movq -488(%rbp), %rax
+	addq -480(%rbp), %rax
+.L343:
+	pushq %rax
+	movq -448(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -464(%rbp)
+	movq -456(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -472(%rbp)
+	cmpq $4, -464(%rbp)
+	jl .L350
+	cmpq $18, -464(%rbp)
+	jle .L348
+.L350:
+	movq -472(%rbp), %rax
+	addq -464(%rbp), %rax
+.L347:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L339
+.L332:
+.L333:
+	movq -536(%rbp), %rax
+	movq %rax, %rsi
+	movq -528(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -536(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -528(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L331
+.L336:
+.L337:
+	subq $8, %rsp
+	movq -520(%rbp), %rax
+	movq %rax, %rsi
+	movq -512(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -520(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -512(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L335
+.L344:
+.L345:
+	subq $8, %rsp
+	movq -488(%rbp), %rax
+	movq %rax, %rsi
+	movq -480(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -488(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -480(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L343
+.L348:
+.L349:
+	movq -472(%rbp), %rax
+	movq %rax, %rsi
+	movq -464(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -472(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -464(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L347
+.L312:
+	jmp .L310
+.L315:
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $38, %rax
+	jge .L416
+	cmpq $-4, %rax
+	je .L411
+	cmpq $-3, %rax
+	je .L409
+	cmpq $5, %rax
+	je .L310
+.L412:
+	jmp .L310
+.L416:
+	cmpq $443, %rax
+	jge .L417
+	cmpq $38, %rax
+	je .L410
+	cmpq $43, %rax
+	je .L408
+	jmp .L310
+.L462:
+	movl $0, %eax
+.L463:
+	movw %ax, -4(%rbp)
+.L461:
+.L410:
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movw %ax, g0(%rip)
+.L407:
+	jmp .L310
+.L417:
+	cmpq $443, %rax
+	je .L413
+	cmpq $883, %rax
+	je .L310
+	jmp .L310
+.L411:
+	movswl -4(%rbp), %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	movq %rax, %r9
+	movl $4, %eax
+	movq %rax, %r8
+	movl $2147483647, %eax
+	movq %rax, %rcx
+	movl -144(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl -324(%rbp), %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+	testq %rax, %rax
+	jne .L310
+	movzwl -8(%rbp), %eax
+	addl -12(%rbp), %eax
+	movw %ax, -8(%rbp)
+.L464:
+.L465:
+	jmp .L310
+.L413:
+	movl $3, %eax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	movl $267, %eax
+	movq %rax, %r9
+	movzwl -8(%rbp), %eax
+	movq %rax, %r8
+	movl $124, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movl -12(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movw %ax, -718(%rbp)
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+	pushq %rax
+	subq $8, %rsp
+	movl ga0+16(%rip), %eax
+	pushq %rax
+	movswl -718(%rbp), %eax
+	pushq %rax
+	movl $7703, %eax
+	movq %rax, %r9
+	movl -228(%rbp), %eax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movzbl -2(%rbp), %eax
+	movq %rax, %rsi
+	movswl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	addq $24, %rsp
+	popq %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+.L414:
+	jmp .L310
+.L453:
+	movl $0, %eax
+.L454:
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	movl %ecx, -160(%rbp,%rax,4)
+.L451:
+.L452:
+	movl ga0+0(%rip), %eax
+	cmpl $320, %eax
+	setne %al
+	movzbl %al, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movw %ax, -4(%rbp)
+.L441:
+.L439:
+.L409:
+	movzbl -1(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L460
+	movl $8, %eax
+	pushq %rax
+	movswl -4(%rbp), %eax
+	pushq %rax
+	movl $849, %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movzwl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movsbl %al, %eax
+	cmpl $5, %eax
+	setl %al
+	movzbl %al, %eax
+	movw %ax, -8(%rbp)
+	jmp .L461
+.L460:
+	cmpb $0, -1(%rbp)
+	je .L462
+	movswl -4(%rbp), %eax
+	cmpl $306, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	cmpq %rax, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L463
+.L408:
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	subq %rcx, %rax
+	jne .L426
+	movl ga0+0(%rip), %eax
+	imull -12(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L427
+.L426:
+	movl $1, %eax
+.L427:
+	movslq %eax, %rax
+	cmpq $559, %rax
+	jge .L428
+	cmpq $-5, %rax
+	je .L422
+	cmpq $0, %rax
+	je .L424
+	cmpq $62, %rax
+	je .L423
+	jmp .L425
+.L415:
+	jmp .L310
+.L428:
+	cmpq $559, %rax
+	je .L419
+	cmpq $786, %rax
+	je .L421
+	cmpq $823, %rax
+	je .L420
+	jmp .L425
+.L419:
+	cmpw $0, -4(%rbp)
+	jne .LB1
+.L429:
+.L430:
+	movl ga0+8(%rip), %eax
+	addl $2285414963, %eax
+	movl %eax, ga0+0(%rip)
+.L431:
+	jmp .L418
+.L422:
+	movswl -6(%rbp), %eax
+	movl %eax, -676(%rbp)
+	movzwl g0(%rip), %eax
+	movl %eax, -680(%rbp)
+	movl ga0+8(%rip), %eax
+	addl -680(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L435:
+	movl -276(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzbl -1(%rbp), %eax
+	pushq %rax
+	movzwl g0(%rip), %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movq %rax, %rdx
+	movl $378, %eax
+	movq %rax, %rsi
+	movl -88(%rbp), %eax
+	movq %rax, %rdi
+	call f3
+	movsbq %al, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $128, %eax
+	movq %rax, %rcx
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdx
+	movswq -6(%rbp), %rax
+	movq %rax, %rsi
+	movzwl g0(%rip), %eax
+	movq %rax, %rdi
+	call f3
+	addq $8, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	movzbl -1(%rbp), %eax
+	pushq %rax
+	xorl %eax, %eax
+	movl -72(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpl $0, -12(%rbp)
+	je .L436
+	movl $4, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L437
+.L436:
+	movl $0, %eax
+.L437:
+	movq %rax, %rsi
+	movl ga0+28(%rip), %eax
+	movslq %eax, %rax
+	addq -24(%rbp), %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L418:
+	movl $94, %eax
+	movslq %eax, %rax
+	cmpq $532, %rax
+	jge .L448
+	leaq 3(%rax), %rcx
+	cmpq $7, %rcx
+	ja .L449
+	leaq .L450(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L445
+	# table target .L442
+	# table target .L441
+	# table target .L440
+	# table target .L444
+	jmp *%rcx
+.L448:
+	cmpq $532, %rax
+	je .L440
+	cmpq $607, %rax
+	je .L446
+	cmpq $653, %rax
+	je .L443
+	jmp .L445
+.L449:
+	cmpq $281, %rax
+	je .L447
+.L445:
+	movswl -4(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movl $516, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	subl %ecx, %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movw %ax, -4(%rbp)
+	movl $668, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f3
+	movsbl %al, %eax
+	movl %eax, -324(%rbp)
+	jmp .L439
+.L424:
+	movl $51, %eax
+	movq %rax, %rcx
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movswl -6(%rbp), %eax
+	movq %rax, %rdi
+	call f3
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	subl $3, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+.L425:
+	movl $2, %eax
+	pushq %rax
+	movl $614, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movzwl g0(%rip), %eax
+	movq %rax, %r8
+	movzbl -2(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl $780, %eax
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+	movl %eax, -160(%rbp)
+	movl $1, %eax
+	addl $128, %eax
+	subl $5, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -12(%rbp)
+	jmp .L418
+.L440:
+	movzwl -8(%rbp), %eax
+	movl %eax, -684(%rbp)
+	testl %eax, %eax
+	jl .L451
+	cmpl $33, -684(%rbp)
+	jge .L451
+	cmpw $0, -8(%rbp)
+	jne .L453
+	cmpb $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L454
+.L421:
+	movl $128, -12(%rbp)
+	movswl -6(%rbp), %eax
+	movl %eax, -668(%rbp)
+	movzbl -2(%rbp), %eax
+	movl %eax, -672(%rbp)
+	movl ga0+8(%rip), %eax
+	addl -672(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L434:
+	jmp .L418
+.L446:
+	movl $12044, %eax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movswl -6(%rbp), %eax
+	movl %eax, -716(%rbp)
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movabsq $960794039870, %rax
+	movq %rax, %rdx
+	movzwl g0(%rip), %eax
+	movq %rax, %rsi
+	movl ga0+28(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	addl -716(%rbp), %eax
+	movw %ax, -6(%rbp)
+	jmp .L439
+.L447:
+	movl -160(%rbp), %eax
+	movsbl %al, %eax
+	cmpl $2, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl $143, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	jmp .L439
+.L420:
+	movabsq $28466293590, %rax
+	movslq -12(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	subq %rcx, %rax
+	je .L432
+	movswl -4(%rbp), %eax
+	subl -12(%rbp), %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L433
+.L432:
+	movl $0, %eax
+.L433:
+	movw %ax, -4(%rbp)
+	jmp .L418
+.L423:
+	movzbl -1(%rbp), %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movswl -6(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -6(%rbp)
+	movl ga0+8(%rip), %eax
+	addl $2, %eax
+	movl %eax, ga0+0(%rip)
+.L438:
+	jmp .L418
+.L443:
+	movl -256(%rbp), %eax
+	movl %eax, -700(%rbp)
+	movzwl g0(%rip), %eax
+	movl %eax, -704(%rbp)
+	movl ga0+8(%rip), %eax
+	addl -704(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L457:
+	movl -32(%rbp), %eax
+	movl %eax, -708(%rbp)
+	movl ga0+8(%rip), %eax
+	addl $10, %eax
+	movl %eax, ga0+0(%rip)
+.L458:
+	jmp .L439
+.L442:
+	movzwl g0(%rip), %eax
+	movl %eax, -688(%rbp)
+	movl ga0+8(%rip), %eax
+	addl -688(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L455:
+	movswl -6(%rbp), %eax
+	movl %eax, -692(%rbp)
+	movzbl -1(%rbp), %eax
+	movl %eax, -696(%rbp)
+	movl ga0+8(%rip), %eax
+	addl -696(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L456:
+	jmp .L439
+.L444:
+	movl ga0+28(%rip), %eax
+	movl %eax, -712(%rbp)
+	movl ga0+8(%rip), %eax
+	addl $39, %eax
+	movl %eax, ga0+0(%rip)
+.L459:
+	movl -12(%rbp), %eax
+	movq %rax, -24(%rbp)
+	jmp .L445
+.L316:
+	jmp .L310
+.L467:
+	movl ga0+8(%rip), %eax
+	addl $4111006428, %eax
+	movl %eax, ga0+0(%rip)
+.L474:
+.L468:
+	movzbl -1(%rbp), %eax
+	movq %rax, -736(%rbp)
+	movzwl -8(%rbp), %eax
+	movq %rax, -744(%rbp)
+	cmpq $4, -736(%rbp)
+	jl .L478
+	cmpq $18, -736(%rbp)
+	jle .L476
+.L478:
+	movq -744(%rbp), %rax
+	addq -736(%rbp), %rax
+.L475:
+	movq %rax, %rcx
+	movl -352(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $5, %eax
+	cqo
+	idivq %rcx
+	cmpq $14, %rax
+	jge .L511
+	cmpq $-4, %rax
+	je .L506
+	cmpq $-2, %rax
+	je .L466
+	cmpq $4, %rax
+	je .L505
+.L504:
+	movzbl -1(%rbp), %eax
+	imull $127, %eax, %eax
+	testl %eax, %eax
+	jne .L517
+	movl -348(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L518
+.L511:
+	cmpq $55, %rax
+	jge .L512
+	cmpq $14, %rax
+	je .L510
+	cmpq $47, %rax
+	je .L509
+	jmp .L504
+.L476:
+.L477:
+	movq -736(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -800(%rbp)
+	movq -744(%rbp), %rax
+	movq %rax, -808(%rbp)
+	cmpq $4, -800(%rbp)
+	jl .L482
+	cmpq $18, -800(%rbp)
+	jle .L480
+.L482:
+	movq -808(%rbp), %rax
+	addq -800(%rbp), %rax
+.L479:
+	pushq %rax
+	movq -736(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -752(%rbp)
+	movq -744(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -760(%rbp)
+	cmpq $4, -752(%rbp)
+	jl .L494
+	cmpq $18, -752(%rbp)
+	jle .L492
+.L494:
+	movq -760(%rbp), %rax
+	addq -752(%rbp), %rax
+.L491:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L475
+.L512:
+	cmpq $55, %rax
+	je .L507
+	cmpq $721, %rax
+	je .L507
+	jmp .L504
+.L506:
+	movzbl -2(%rbp), %eax
+	movl %eax, -848(%rbp)
+	testl %eax, %eax
+	jl .L520
+	cmpl $8, -848(%rbp)
+	jge .L520
+	movzwl g0(%rip), %eax
+	pushq %rax
+	movl $6994, %eax
+	pushq %rax
+	movzwl -8(%rbp), %eax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+	pushq %rax
+	movl ga0+24(%rip), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L520:
+.L521:
+	movq -24(%rbp), %rax
+	movswl -6(%rbp), %ecx
+	cmpl %ecx, %eax
+	je .L522
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L523
+.L522:
+	movl $0, %eax
+.L523:
+	movw %ax, g0(%rip)
+.L503:
+	jmp .L466
+.L517:
+	movl $1, %eax
+.L518:
+	movslq %eax, %rax
+	cmpq $6, %rax
+	je .L516
+	cmpq $7, %rax
+	je .L466
+	cmpq $8, %rax
+	je .L516
+.L514:
+	jmp .L466
+.L507:
+	cmpw $0, -6(%rbp)
+	je .L524
+	movl -12(%rbp), %eax
+	testb %al, %al
+	je .L524
+	movzwl g0(%rip), %eax
+	subq $10, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L525
+.L524:
+	movl $0, %eax
+.L525:
+	movw %ax, -4(%rbp)
+	movzwl -8(%rbp), %eax
+	pushq %rax
+	movl -120(%rbp), %eax
+	pushq %rax
+	movl $4294967295, %eax
+	movq %rax, %r9
+	movl $4, %eax
+	movq %rax, %r8
+	movswl -6(%rbp), %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testb %al, %al
+	je .L526
+	cmpb $0, -1(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L527
+.L526:
+	movl $0, %eax
+.L527:
+	movb %al, -1(%rbp)
+	jmp .L466
+.L516:
+	movl ga0+8(%rip), %eax
+	addl $127, %eax
+	movl %eax, ga0+0(%rip)
+.L519:
+	movswl -6(%rbp), %eax
+	movb %al, -1(%rbp)
+.L513:
+	jmp .L466
+.L508:
+	jmp .L466
+.L510:
+	movabsq $823724881761, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movzwl -8(%rbp), %eax
+	movl %eax, -972(%rbp)
+	imull -972(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $6, %rax
+	setb %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movl %eax, -12(%rbp)
+	jmp .L466
+.L480:
+.L481:
+	movq -800(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -832(%rbp)
+	movq -808(%rbp), %rax
+	movq %rax, -840(%rbp)
+	cmpq $4, -832(%rbp)
+	jl .L486
+	cmpq $18, -832(%rbp)
+	jle .L484
+.L486:
+	movq -840(%rbp), %rax
+	addq -832(%rbp), %rax
+.L483:
+	pushq %rax
+	movq -800(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -816(%rbp)
+	movq -808(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -824(%rbp)
+	cmpq $4, -816(%rbp)
+	jl .L490
+	cmpq $18, -816(%rbp)
+	jle .L488
+.L490:
+	movq -824(%rbp), %rax
+	addq -816(%rbp), %rax
+.L487:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L479
+.L492:
+.L493:
+	movq -752(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -784(%rbp)
+	movq -760(%rbp), %rax
+	movq %rax, -792(%rbp)
+	cmpq $4, -784(%rbp)
+	jl .L498
+	cmpq $18, -784(%rbp)
+	jle .L496
+.L498:
+	movq -792(%rbp), %rax
+	addq -784(%rbp), %rax
+.L495:
+	pushq %rax
+	movq -752(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -768(%rbp)
+	movq -760(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -776(%rbp)
+	cmpq $4, -768(%rbp)
+	jl .L502
+	cmpq $18, -768(%rbp)
+	jle .L500
+.L502:
+	movq -776(%rbp), %rax
+	addq -768(%rbp), %rax
+.L499:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L491
+.L505:
+	movzbl -1(%rbp), %eax
+	movl %eax, -844(%rbp)
+	imull -844(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	cmpl $10, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -1(%rbp)
+	jmp .L466
+.L509:
+	movl $0, -12(%rbp)
+	movabsq $894970854197, %rax
+	imulq $470, %rax, %rax
+	cmpq $503, %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $1, %eax
+	subl $669, %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -852(%rbp)
+	cmpl $16, -12(%rbp)
+	jge .L529
+	.p2align 4,,10
+.L528:
+	movl -852(%rbp), %eax
+	movb %al, -2(%rbp)
+	movl -72(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -864(%rbp)
+	movl $32767, %eax
+	cmpq $4, %rax
+	jl .L535
+	movl $32767, %eax
+	cmpq $18, %rax
+	jle .L533
+.L535:
+	movq -864(%rbp), %rax
+	addq $32767, %rax
+.L532:
+	cmpq $303, %rax
+	jle .L530
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L531
+.L530:
+	movl $1, %eax
+.L531:
+	movb %al, -1(%rbp)
+	movq -24(%rbp), %rax
+	movl %eax, -964(%rbp)
+	movl -128(%rbp), %eax
+	movl %eax, -968(%rbp)
+	movl ga0+8(%rip), %eax
+	addl -968(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L560:
+	addl $1, -12(%rbp)
+	cmpl $16, -12(%rbp)
+	jl .L528
+.L529:
+	movzbl -1(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rcx
+	movswl -4(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -4(%rbp)
+	jmp .L466
+.L533:
+.L534:
+	movl $32767, %eax
+	subq $4, %rax
+	movq %rax, -920(%rbp)
+	movq -864(%rbp), %rax
+	movq %rax, -928(%rbp)
+	cmpq $4, -920(%rbp)
+	jl .L539
+	cmpq $18, -920(%rbp)
+	jle .L537
+.L539:
+	movq -928(%rbp), %rax
+	addq -920(%rbp), %rax
+.L536:
+	pushq %rax
+	movl $32767, %eax
+	subq $1, %rax
+	movq %rax, -872(%rbp)
+	movq -864(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -880(%rbp)
+	cmpq $4, -872(%rbp)
+	jl .L551
+	cmpq $18, -872(%rbp)
+	jle .L549
+.L551:
+	movq -880(%rbp), %rax
+	addq -872(%rbp), %rax
+.L548:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L532
+.L515:
+	jmp .L466
+.L537:
+.L538:
+	movq -920(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -952(%rbp)
+	movq -928(%rbp), %rax
+	movq %rax, -960(%rbp)
+	cmpq $4, -952(%rbp)
+	jl .L543
+	cmpq $18, -952(%rbp)
+	jle .L541
+.L543:
+	movq -960(%rbp), %rax
+	addq -952(%rbp), %rax
+.L540:
+	pushq %rax
+	movq -920(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -936(%rbp)
+	movq -928(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -944(%rbp)
+	cmpq $4, -936(%rbp)
+	jl .L547
+	cmpq $18, -936(%rbp)
+	jle .L545
+.L547:
+	movq -944(%rbp), %rax
+	addq -936(%rbp), %rax
+.L544:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L536
+.L549:
+.L550:
+	movq -872(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -904(%rbp)
+	movq -880(%rbp), %rax
+	movq %rax, -912(%rbp)
+	cmpq $4, -904(%rbp)
+	jl .L555
+	cmpq $18, -904(%rbp)
+	jle .L553
+.L555:
+	movq -912(%rbp), %rax
+	addq -904(%rbp), %rax
+.L552:
+	pushq %rax
+	movq -872(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -888(%rbp)
+	movq -880(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -896(%rbp)
+	cmpq $4, -888(%rbp)
+	jl .L559
+	cmpq $18, -888(%rbp)
+	jle .L557
+.L559:
+	movq -896(%rbp), %rax
+	addq -888(%rbp), %rax
+.L556:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L548
+.L484:
+.L485:
+	movq -840(%rbp), %rax
+	movq %rax, %rsi
+	movq -832(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -840(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -832(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L483
+.L488:
+.L489:
+	subq $8, %rsp
+	movq -824(%rbp), %rax
+	movq %rax, %rsi
+	movq -816(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -824(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -816(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L487
+.L496:
+.L497:
+	subq $8, %rsp
+	movq -792(%rbp), %rax
+	movq %rax, %rsi
+	movq -784(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -792(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -784(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L495
+.L500:
+.L501:
+	movq -776(%rbp), %rax
+	movq %rax, %rsi
+	movq -768(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -776(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -768(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L499
+.L541:
+.L542:
+	movq -960(%rbp), %rax
+	movq %rax, %rsi
+	movq -952(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -960(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -952(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L540
+.L545:
+.L546:
+	subq $8, %rsp
+	movq -944(%rbp), %rax
+	movq %rax, %rsi
+	movq -936(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -944(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -936(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L544
+.L553:
+.L554:
+	subq $8, %rsp
+	movq -912(%rbp), %rax
+	movq %rax, %rsi
+	movq -904(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -912(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -904(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L552
+.L557:
+.L558:
+	movq -896(%rbp), %rax
+	movq %rax, %rsi
+	movq -888(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -896(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -888(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L556
+.L469:
+	jmp .L466
+.L470:
+	movswl -4(%rbp), %eax
+	movl %eax, -976(%rbp)
+	imull -976(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	movl $1, %eax
+	movzwl g0(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	addl $2, %eax
+	je .L466
+	movl -296(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -984(%rbp)
+	movzwl g0(%rip), %eax
+	movq %rax, -992(%rbp)
+	cmpq $4, -984(%rbp)
+	jl .L566
+	cmpq $18, -984(%rbp)
+	jle .L564
+.L566:
+	movq -992(%rbp), %rax
+	addq -984(%rbp), %rax
+.L563:
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	addq %rcx, %rax
+	movb %al, -2(%rbp)
+.L561:
+.L562:
+	jmp .L466
+.L564:
+.L565:
+	movq -984(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -1048(%rbp)
+	movq -992(%rbp), %rax
+	movq %rax, -1056(%rbp)
+	cmpq $4, -1048(%rbp)
+	jl .L570
+	cmpq $18, -1048(%rbp)
+	jle .L568
+.L570:
+	movq -1056(%rbp), %rax
+	addq -1048(%rbp), %rax
+.L567:
+	pushq %rax
+	movq -984(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -1000(%rbp)
+	movq -992(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -1008(%rbp)
+	cmpq $4, -1000(%rbp)
+	jl .L582
+	cmpq $18, -1000(%rbp)
+	jle .L580
+.L582:
+	movq -1008(%rbp), %rax
+	addq -1000(%rbp), %rax
+.L579:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L563
+.L568:
+.L569:
+	movq -1048(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -1080(%rbp)
+	movq -1056(%rbp), %rax
+	movq %rax, -1088(%rbp)
+	cmpq $4, -1080(%rbp)
+	jl .L574
+	cmpq $18, -1080(%rbp)
+	jle .L572
+.L574:
+	movq -1088(%rbp), %rax
+	addq -1080(%rbp), %rax
+.L571:
+	pushq %rax
+	movq -1048(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -1064(%rbp)
+	movq -1056(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -1072(%rbp)
+	cmpq $4, -1064(%rbp)
+	jl .L578
+	cmpq $18, -1064(%rbp)
+	jle .L576
+.L578:
+	movq -1072(%rbp), %rax
+	addq -1064(%rbp), %rax
+.L575:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L567
+.L580:
+.L581:
+	movq -1000(%rbp), %rax
+	subq $4, %rax
+	movq %rax, -1032(%rbp)
+	movq -1008(%rbp), %rax
+	movq %rax, -1040(%rbp)
+	cmpq $4, -1032(%rbp)
+	jl .L586
+	cmpq $18, -1032(%rbp)
+	jle .L584
+.L586:
+	movq -1040(%rbp), %rax
+	addq -1032(%rbp), %rax
+.L583:
+	pushq %rax
+	movq -1000(%rbp), %rax
+	subq $1, %rax
+	movq %rax, -1016(%rbp)
+	movq -1008(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -1024(%rbp)
+	cmpq $4, -1016(%rbp)
+	jl .L590
+	cmpq $18, -1016(%rbp)
+	jle .L588
+.L590:
+	movq -1024(%rbp), %rax
+	addq -1016(%rbp), %rax
+.L587:
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L579
+.L572:
+.L573:
+	movq -1088(%rbp), %rax
+	movq %rax, %rsi
+	movq -1080(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -1088(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -1080(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L571
+.L576:
+.L577:
+	subq $8, %rsp
+	movq -1072(%rbp), %rax
+	movq %rax, %rsi
+	movq -1064(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -1072(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -1064(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L575
+.L584:
+.L585:
+	subq $8, %rsp
+	movq -1040(%rbp), %rax
+	movq %rax, %rsi
+	movq -1032(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movq -1040(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -1032(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L583
+.L588:
+.L589:
+	movq -1024(%rbp), %rax
+	movq %rax, %rsi
+	movq -1016(%rbp), %rax
+	subq $4, %rax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movq -1024(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rsi
+	movq -1016(%rbp), %rax
+	subq $1, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	jmp .L587
+.L471:
+	jmp .L466
+.LB1:
+	movl $8, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L318:
+	.long .L315-.L318
+	.long .L313-.L318
+	.long .L312-.L318
+	.long .L316-.L318
+	.long .L313-.L318
+	.long .L316-.L318
+	.long .L314-.L318
+	.long .L313-.L318
+	.long .L313-.L318
+	.long .L311-.L318
+	.p2align 2
+.L450:
+	.long .L442-.L450
+	.long .L445-.L450
+	.long .L445-.L450
+	.long .L445-.L450
+	.long .L441-.L450
+	.long .L445-.L450
+	.long .L440-.L450
+	.long .L444-.L450
+	.p2align 2
+.L473:
+	.long .L467-.L473
+	.long .L471-.L473
+	.long .L466-.L473
+	.long .L466-.L473
+	.long .L466-.L473
+	.long .L466-.L473
+	.long .L468-.L473
+	.long .L470-.L473
+	.long .L466-.L473
+	.long .L466-.L473
+	.long .L469-.L473
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,492 @@
+short g0 = 516;
+int ga0[16];
+short f0(int p0, unsigned short p1, unsigned char p2) {
+    int v0 = 4;
+    unsigned long v1 = 4;
+    short v2 = 1;
+    int v3 = 35508213439U;
+    int i0 = 670;
+    long j0 = 8;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 5U; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 3; }
+    switch ((la0[4] != v0)) {
+    case 3:
+        i0 = 0;
+        while (i0 < 17) {
+            la0[1] = 237;
+            la1[3] = (9 == 378);
+            i0 = i0 + 1;
+        }
+        break;
+    case 289:
+        for (v2 = 0; v2 < 17; v2 = v2 + 1) {
+            p0 = (!(v3) <= (3 / (g0 * g0 + 1)));
+            i0 = 8;
+        }
+        switch (0) {
+        case 7:
+            v3 = v3 + (p1 && j0);
+            for (j0 = 0; j0 < 5; j0 = j0 + 1) {
+                v1 = v1 + (v3 < -(v0));
+                p2 = (!(v3) / (p1 * p1 + 1));
+            }
+        }
+        break;
+    case 370:
+    case 0:
+        if (169) { return p0; }
+        break;
+    case 34:
+        if (g0 >= 0 && g0 < 8) { la0[g0] = 448; }
+        if (g0 >= 0 && g0 < 4) { la1[g0] = (v1 && (5 == i0)); }
+        break;
+    case 458:
+        break;
+    case 413:
+        j0 = j0 + (g0 > (p2 > v0));
+        break;
+    }
+    if ((((7 <= 32767) - (p0 * v2)) <= (p1 > (9 - v2)))) {
+        switch (92) {
+        case 8:
+            if ((short)(la0[7])) { return (0 - !(830)); }
+            break;
+        }
+        if ((4 * (8 - v3))) { return (v3 / (v3 * v3 + 1)); }
+        v0 = 947;
+    }
+    if (-(975)) {
+        i0 = 0;
+        while (i0 < 33) {
+            v1 = 572959139789;
+            la1[0] = ((v3 - v1) / 4);
+            v3 = 0;
+            while (v3 < 17) {
+                if (v3) { break; }
+                v3 = v3 + 1;
+            }
+            i0 = i0 + 1;
+        }
+        v1 = v1 + (unsigned short)((p2 || v0));
+    } else {
+        if (579731635046) { return ((i0 - 10) / 1); }
+        la0[6] = g0;
+        for (j0 = 0; j0 < 17; j0 = j0 + 1) {
+            if ((((6 <= v1) > p0) != 8)) {
+                if (p2) { break; }
+                p2 = (unsigned char)((933U < 5));
+                if (g0 >= 0 && g0 < 8) { la0[g0] = ((long)(p2) == (5U / 4)); }
+            } else {
+                p2 = (long)(((unsigned char)(i0) - (v3 != p1)));
+                i0 = (unsigned int)((v0 != 470));
+            }
+            if (j0) { break; }
+        }
+    }
+    v1 = ((!(p2) < p0) / (i0 * i0 + 1));
+    if (la1[0]) {
+        if (150) { return v0; }
+    } else {
+        switch ((835048263409 / (v3 * v3 + 1))) {
+        case 5:
+            switch (!(v1)) {
+            case 2:
+                if (la1[1]) { return (v1 <= (j0 && i0)); }
+                break;
+            default:
+                v1 = v1 + (795 + v3);
+                v0 = i0;
+                break;
+            case 10:
+                break;
+            }
+            i0 = ((v1 * 264) * (p2 < la1[2]));
+            break;
+        }
+    }
+    return 8;
+}
+void w0(unsigned short q0) {
+    ga0[7] = ga0[0] + q0;
+    ga0[14] = ga0[15] + q0;
+}
+short f1(long p0, unsigned int p1, unsigned int p2, unsigned char p3) {
+    char v0 = 0;
+    char v1 = 9;
+    int v2 = 841;
+    long v3 = 1;
+    int i0 = 6;
+    long j0 = 10;
+    if (f0((v3 - 455), (1000000007 < i0), (4294967295 / 7))) {
+        if (j0) {
+            f0(0, (p1 != v2), (unsigned char)(p0));
+        } else {
+            p1 = (-(-(v0)) * ((unsigned int)(3) == (p2 * g0)));
+            p2 = 0;
+            while (p2 < 4) {
+                v3 = -(((ga0[8] && ga0[5]) / (v1 * v1 + 1)));
+                v0 = (p3 - (short)(7));
+                p2 = p2 + 1;
+            }
+            p0 = p0 + ((ga0[13] && 1) / 1024);
+        }
+        if ((10 * (ga0[2] / (i0 * i0 + 1)))) { return (!(4) / 13ul); }
+    }
+    if ((((unsigned short)(j0) / 4) + (!(v1) < (p0 < 10)))) {
+        if (4294967295) {
+            f0(-(ga0[8]), 10, (8 == 6));
+            if (p1) {
+                v0 = (1 != ((127 + ga0[11]) < (0 / (p2 * p2 + 1))));
+                f0((10 != v2), v3, (long)(v0));
+                p0 = -(p1);
+            } else {
+                f0(!(127), (938 + 943L), (long)(7));
+                f0(595, (449 + 8), (1 != 707));
+                v2 = ((0 != f0(g0, 82728985547, v3)) / (p2 * p2 + 1));
+            }
+        }
+    }
+    if (9) { return (j0 / (p1 * p1 + 1)); }
+    if (-(f0(323, 0, 779603025672))) { return ((455 / (v3 * v3 + 1)) - (v2 == 531)); }
+    if (f0((ga0[3] - 561), (976 / 8), (v3 / (v0 * v0 + 1)))) {
+        j0 = j0 + 5;
+        for (p2 = 2; p2 < 16; p2 = p2 + 1) {
+            v1 = f0(278, (ga0[9] / (g0 * g0 + 1)), -(p3));
+            if (f0(ga0[0], (i0 > ga0[11]), f0(7, v0, 2))) {
+                if ((unsigned int)((237 - ga0[12]))) { break; }
+                v2 = (p2 > ga0[8]);
+            }
+        }
+        f0(8l, (unsigned short)(1), 4);
+    }
+    f0(v0, f0(925901240059, p0, p2), f0(ga0[8], ga0[13], i0));
+    return !((j0 > ga0[9]));
+}
+char f2() {
+    unsigned long v0 = 5;
+    unsigned long v1 = 65536;
+    unsigned int v2 = 840;
+    short v3 = 14;
+    short v4 = 188;
+    int i0 = 255;
+    long j0 = 394;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    i0 = (101098992301l / 2);
+    v3 = -((ga0[2] == 10));
+    la0[2] = v1;
+    for (i0 = 0; i0 < 5; i0 = i0 + 1) {
+        if ((char)(((la0[14] - g0) < 643))) {
+            j0 = v4;
+            v3 = ((char)(255) / 1024);
+            v0 = f0(v4, (8 * 0), v1);
+        }
+        if ((((v0 > v1) + (j0 && v3)) / 1024)) {
+            for (v0 = 0; v0 < 5; v0 = v0 + 1) {
+                v1 = !(f0(i0, v0, 7));
+                j0 = j0 + v2;
+                if ((unsigned char)(f1(268, i0, i0, 785))) { break; }
+            }
+            v4 = ((f0(255, v4, 1) < f1(645472086682, 75, i0, 395193615186)) <= 701);
+        } else {
+            if ((((8 * 1) >= 0) || ((g0 / 10) / 100))) {
+                v0 = (7 + la0[0]);
+            } else {
+                if (v3 >= 0 && v3 < 16) { la0[v3] = 489; }
+                v0 = (564253117113 < 8);
+            }
+            if (((v3 + v0) == (971906452099 / (v0 * v0 + 1)))) { return -((v4 * 8)); }
+            switch (10) {
+            case 663:
+                break;
+            case 610:
+                v0 = (int)((v3 + (319 + v3)));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    if (324) {
+        for (v1 = 0; v1 < 4; v1 = v1 + 1) {
+            switch (4294967295) {
+            case 65:
+                i0 = 4294967295;
+            case 51:
+                break;
+            default:
+                break;
+            }
+            j0 = !(f1(v4, v3, j0, 442));
+            switch (((387733867231 != v1) * (710041179796 / (g0 * g0 + 1)))) {
+            default:
+                break;
+            case 187:
+                if (((ga0[15] * 997) / (v2 * v2 + 1))) { break; }
+            case 2:
+                if ((v4 * (48 / (g0 * g0 + 1)))) { break; }
+                v2 = (!(921) + -((g0 / 5l)));
+                break;
+            case -3:
+                v2 = f0((417 < 59858446888), i0, 0l);
+                break;
+            case 31:
+                if ((f1(g0, v4, v3, i0) * 0)) { break; }
+            case -2:
+                break;
+            case 64:
+                i0 = ga0[7];
+                v0 = -(f1(930, g0, 65536, v1));
+                break;
+            case 3:
+                if ((j0 != (v3 && 783))) { break; }
+                v4 = v4 + (367 <= 1);
+                break;
+            case 119:
+                if (((593 + 2147483647) * (v2 <= v3))) { break; }
+            }
+        }
+        j0 = -((char)(0));
+        f1((0 < 235), (v1 >= 367), (la0[13] + v3), f1(3, la0[11], ga0[7], la0[3]));
+    }
+    switch ((!(682) - 3U)) {
+    case 847:
+        for (v3 = 1; v3 < 4; v3 = v3 + 1) {
+            i0 = v1;
+            if (f0(v2, (v1 / 8), (5ul >= 8))) {
+                if (10) { break; }
+                v4 = ((unsigned char)(v4) - ((v3 - v2) < f1(la0[9], i0, 0, v2)));
+            } else {
+                v4 = ((v2 != 2) && (i0 - (long)(4)));
+            }
+        }
+        f1((unsigned long)(314), 333, g0, f1(v1, 1, g0, g0));
+        break;
+    default:
+        la0[12] = 3;
+        if (f1(v3, j0, 735251184438, la0[8])) { return !((short)(1ul)); }
+    }
+    v0 = (!((v3 < v4)) != g0);
+    for (v1 = 0; v1 < 16; v1 = v1 + 1) {
+        for (v4 = 0; v4 < 8; v4 = v4 + 1) {
+            if ((851 / (v1 * v1 + 1))) {
+                j0 = v2;
+                j0 = g0;
+                j0 = ((f0(g0, v0, 456155683558) == la0[5]) - -(1));
+            } else {
+                i0 = (short)(((unsigned long)(ga0[0]) >= (480 / 5l)));
+                v0 = (((3 / 8) + (165 < v3)) - v2);
+            }
+        }
+        for (i0 = 2; i0 < 100; i0 = i0 + 1) {
+            v4 = ((v0 / 13ul) > !(f0(0, v0, 397)));
+            v2 = -((v3 / 1));
+        }
+    }
+    return f0(v2, 9, (la0[6] || v0));
+}
+unsigned short f3(int p0, unsigned int p1, long p2, unsigned char p3) {
+    char v0 = 621;
+    unsigned long v1 = 176756827796;
+    int i0 = 7;
+    long j0 = 0;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 941; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 290310056528; }
+    if (p0 >= 0 && p0 < 33) { la1[p0] = p2; }
+    switch (((char)(889) && p1)) {
+    case 16:
+        break;
+    case 9:
+        switch (f2()) {
+        case 378:
+            if (4) {
+                p2 = f1((unsigned long)(p1), 2, f2(), (10 - v1));
+            } else {
+                j0 = -((p0 / (j0 * j0 + 1)));
+            }
+            p1 = ((unsigned int)(516353259245) + p2);
+            break;
+        case -4:
+            p1 = p2;
+            p0 = v0;
+            break;
+        case 21:
+            break;
+        default:
+            break;
+        }
+        p0 = g0;
+        break;
+    case 702:
+        break;
+    }
+    p0 = 0;
+    while (p0 < 5) {
+        v1 = ((3 / 10) > p3);
+        if ((unsigned short)(f1(ga0[0], p0, g0, 5))) {
+            if (p0 >= 0 && p0 < 33) { la1[p0] = (4 + f2()); }
+        } else {
+            j0 = ((3 > 8) && p1);
+        }
+        p3 = (4 - ga0[12]);
+        p0 = p0 + 1;
+    }
+    p0 = 0;
+    while (p0 < 8) {
+        if (g0 >= 0 && g0 < 33) { la1[g0] = ((8 && 646u) && (p3 - v0)); }
+        for (i0 = 1; i0 < 8; i0 = i0 + 1) {
+            j0 = p2;
+            v0 = (!(v1) + (681 - j0));
+        }
+        p1 = (unsigned long)(-((la1[15] > i0)));
+        p0 = p0 + 1;
+    }
+    p1 = 0;
+    while (p1 < 4) {
+        j0 = (j0 + (7 == v1));
+        la0[0] = !(p2);
+        p0 = -(((v1 <= v1) / 8));
+        p1 = p1 + 1;
+    }
+    if ((i0 / (v0 * v0 + 1))) {
+        if (!((-(p3) + (v1 < 9)))) {
+            p3 = (!(v0) >= ((la0[3] / 100) > (998 / 3)));
+            p0 = (g0 < f1(p0, p0, j0, 5u));
+        }
+        j0 = 0;
+        while (j0 < 16) {
+            switch (la1[3]) {
+            case 2:
+                break;
+            default:
+            case 4:
+                v1 = (-((i0 == i0)) * -((unsigned char)(5)));
+                if (p0 >= 0 && p0 < 4) { la0[p0] = 4l; }
+                break;
+            case 50:
+                break;
+            case 46:
+                break;
+            case 68:
+                p1 = 7;
+            }
+            p2 = 4;
+            j0 = j0 + 1;
+        }
+        if (v1 >= 0 && v1 < 33) { la1[v1] = (v1 / (g0 * g0 + 1)); }
+    } else {
+        f2();
+    }
+    switch (((v0 == 150584970208) / (p1 * p1 + 1))) {
+    default:
+        switch (((600633855983 + la0[0]) && v0)) {
+        case 8:
+            v0 = (la1[6] >= (unsigned char)(472));
+            break;
+        default:
+            break;
+        case 10:
+            f0(v1, (unsigned short)(p3), (p2 / 1024));
+            if (la0[2]) {
+                j0 = 345033179973ul;
+                f1(la0[1], (0 && 2), -(7), (731 + g0));
+            } else {
+                j0 = f0((903 && v1), la1[24], v0);
+                p2 = (0 >= ((10 + 8) / 1024));
+            }
+            break;
+        case 5:
+            for (p1 = 1; p1 < 16; p1 = p1 + 1) {
+                la1[p1] = f1(104, la1[32], v1, j0);
+            }
+            v0 = (f1(100, 872711382671, 3u, 1) >= !(-(10)));
+        case 1:
+            f1(p1, (la1[5] && 256), 566, (p1 / (i0 * i0 + 1)));
+        }
+        f0((p1 * la0[0]), (p1 / (i0 * i0 + 1)), (10 && 0));
+        break;
+    case 575:
+        if (i0) {
+            for (v1 = 0; v1 < 3; v1 = v1 + 1) {
+                if (f1(v0, 7U, ga0[10], 2)) { break; }
+            }
+            v0 = v0 + 2147483647;
+            switch ((!(p0) && 957)) {
+            case -4:
+                j0 = p1;
+            case 69:
+                v1 = j0;
+                break;
+            case 61:
+            case -1:
+            case 2:
+                f2();
+                break;
+            }
+        }
+        p1 = (1 / (p3 * p3 + 1));
+        break;
+    case 500:
+        switch (la0[2]) {
+        case 3:
+            if (f2()) {
+                f2();
+            } else {
+                f0((425053665227 / 3u), !(471194762208), la1[32]);
+            }
+            v1 = (la1[31] <= -(1000000007));
+            break;
+        case 9:
+            if (-((7 <= 2))) {
+                p3 = 3L;
+                p0 = p0 + 3;
+                p3 = v1;
+            } else {
+                f1((short)(j0), (556826608345 - i0), (p1 * v1), (long)(la0[0]));
+                f2();
+            }
+            p1 = (((p1 / 10) > (ga0[13] + j0)) > ((v0 == la0[3]) / 16));
+            break;
+        case 6:
+        }
+        break;
+    }
+    return (((v1 >= 620) <= (i0 + p3)) + f0(319u, 7, ga0[0]));
+}
+int rec(int n, int acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 4, acc);
+}
+int main() {
+    char v0 = 5;
+    unsigned int v1 = 2;
+    unsigned char v2 = 203;
+    long v3 = 5;
+    int i0 = 726;
+    long j0 = 255;
+    ga0[10] = rec(j0, 10);
+    if (i0 >= 0 && i0 < 16) { ga0[i0] = !(v0); }
+    v3 = ((i0 >= f1(117L, v1, i0, 6)) != (!(128) <= (695 || g0)));
+    if ((2147483647 - ((unsigned long)(v3) >= -(374)))) {
+        g0 = (unsigned long)(rec(ga0[6], 4));
+    }
+    if (j0 >= 0 && j0 < 16) { ga0[j0] = 4; }
+    v3 = (17 * (3 / (g0 * g0 + 1)));
+    w0(5ul);
+    v0 = ((i0 == (ga0[3] * 3)) >= 44);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,4284 @@
+	.section .data
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.short 516
+	.section .bss
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.section .text
+	.type rec, @function
+	.type f0, @function
+	.type rec.constprop.4, @function
+	.type rec.constprop.5, @function
+	.type f1, @function
+	.type f0.constprop.0, @function
+	.type rec.constprop.2, @function
+	.type rec.constprop.3, @function
+	.type f0.constprop.1, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	cmpl $4, %edi
+	jl .L2
+	cmpl $18, %edi
+	jg .L2
+.L0:
+.L1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movl %edi, -32(%rbp)
+	movl %esi, -28(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -24(%rbp)
+	movl %esi, %eax
+	movl %eax, -20(%rbp)
+	cmpl $4, -24(%rbp)
+	jl .L6
+	cmpl $18, -24(%rbp)
+	jle .L4
+.L6:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L3:
+	pushq %rax
+	movl -32(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -24(%rbp)
+	movl -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -20(%rbp)
+	cmpl $4, -24(%rbp)
+	jl .L34
+	cmpl $18, -24(%rbp)
+	jle .L32
+.L34:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L31:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L4:
+.L5:
+	movl -24(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L10
+	cmpl $18, -16(%rbp)
+	jle .L8
+.L10:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L7:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L22
+	cmpl $18, -16(%rbp)
+	jle .L20
+.L22:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L19:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L3
+.L32:
+.L33:
+	movl -24(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L38
+	cmpl $18, -16(%rbp)
+	jle .L36
+.L38:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L35:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L50
+	cmpl $18, -16(%rbp)
+	jle .L48
+.L50:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L47:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L31
+.L8:
+.L9:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L14
+	cmpl $18, -8(%rbp)
+	jle .L12
+.L14:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L11:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L18
+	cmpl $18, -8(%rbp)
+	jle .L16
+.L18:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L15:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L7
+.L20:
+.L21:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L26
+	cmpl $18, -8(%rbp)
+	jle .L24
+.L26:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L23:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L30
+	cmpl $18, -8(%rbp)
+	jle .L28
+.L30:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L27:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L19
+.L36:
+.L37:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L42
+	cmpl $18, -8(%rbp)
+	jle .L40
+.L42:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L39:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L46
+	cmpl $18, -8(%rbp)
+	jle .L44
+.L46:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L43:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L35
+.L48:
+.L49:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L54
+	cmpl $18, -8(%rbp)
+	jle .L52
+.L54:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L51:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L58
+	cmpl $18, -8(%rbp)
+	jle .L56
+.L58:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L55:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L47
+.L12:
+.L13:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L11
+.L16:
+.L17:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L15
+.L24:
+.L25:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L23
+.L28:
+.L29:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L27
+.L40:
+.L41:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L39
+.L44:
+.L45:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L43
+.L52:
+.L53:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L51
+.L56:
+.L57:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L55
+.L2:
+	movl %esi, %eax
+	addl %edi, %eax
+	ret
+	.size rec, .-rec
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movb %dl, -7(%rbp)
+	movl $4, -12(%rbp)
+	movq $4, -24(%rbp)
+	movw $1, -26(%rbp)
+	movl $1148475071, -32(%rbp)
+	movl $670, -36(%rbp)
+	movq $8, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jge .L59
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -88(%rbp)
+	cmpq $0, -88(%rbp)
+	je .L62
+	.p2align 4,,10
+.L61:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -88(%rbp)
+	jne .L61
+.L62:
+.L59:
+.L60:
+	cmpl $8, -36(%rbp)
+	jge .L64
+	.p2align 4,,10
+.L63:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L63
+.L64:
+	movl $0, -36(%rbp)
+	movl $0, -112(%rbp)
+	movl $3, -108(%rbp)
+	movl $6, -104(%rbp)
+	movl $9, -100(%rbp)
+	movl $4, -36(%rbp)
+	movl -64(%rbp), %eax
+	cmpl -12(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $289, %rax
+	jge .L72
+	cmpq $0, %rax
+	je .L68
+	cmpq $3, %rax
+	je .L66
+	cmpq $34, %rax
+	je .L69
+	jmp .L65
+.L72:
+	cmpq $413, %rax
+	jge .L73
+	cmpq $289, %rax
+	je .L67
+	cmpq $370, %rax
+	je .L68
+	jmp .L65
+.L66:
+	movl $0, -36(%rbp)
+	movl $0, -116(%rbp)
+	cmpl $17, -36(%rbp)
+	jge .L74
+	movl $17, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L77
+	.p2align 4,,10
+.L76:
+	movl $237, -76(%rbp)
+	movl -116(%rbp), %eax
+	movl %eax, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl -116(%rbp), %eax
+	movl %eax, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl -116(%rbp), %eax
+	movl %eax, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl -116(%rbp), %eax
+	movl %eax, -100(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -128(%rbp)
+	jne .L76
+.L77:
+.L74:
+.L75:
+	cmpl $17, -36(%rbp)
+	jge .L79
+	.p2align 4,,10
+.L78:
+	movl $237, -76(%rbp)
+	movl -116(%rbp), %eax
+	movl %eax, -100(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $17, -36(%rbp)
+	jl .L78
+.L79:
+.L65:
+	movswl -26(%rbp), %eax
+	movl %eax, -156(%rbp)
+	movq %rax, %rcx
+	movl $9, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzwl -6(%rbp), %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	imull -156(%rbp), %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jg .L92
+	movl $92, %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	je .L95
+.L94:
+	movl $8, %eax
+	subl -32(%rbp), %eax
+	imull $4, %eax, %eax
+	testl %eax, %eax
+	jne .LB0
+.L98:
+.L99:
+	movl $947, -12(%rbp)
+.L92:
+.L93:
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L101
+	.p2align 4,,10
+.L100:
+	movabsq $572959139789, %rax
+	movq %rax, -24(%rbp)
+	movslq -32(%rbp), %rax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movl %eax, -112(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jge .L103
+	.p2align 4,,10
+.L102:
+	cmpl $0, -32(%rbp)
+	je .L104
+.L103:
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L100
+.L101:
+	cmpb $0, -7(%rbp)
+	jne .L106
+	cmpl $0, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L104:
+.L105:
+	addl $1, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jl .L102
+	jmp .L103
+.L106:
+	movl $1, %eax
+.L107:
+	movzwl %ax, %eax
+	addq %rax, -24(%rbp)
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpb $0, -7(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl -4(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -112(%rbp), %eax
+	testl %eax, %eax
+	jne .LB1
+.L108:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $835048263409, %rax
+	cqo
+	idivq %rcx
+	cmpq $5, %rax
+	je .L111
+.L110:
+.L109:
+	movl $8, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L111:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L113
+	cmpq $10, %rax
+	je .L112
+.L114:
+	movl -32(%rbp), %eax
+	addl $795, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	movl -36(%rbp), %eax
+	movl %eax, -12(%rbp)
+	jmp .L112
+.L113:
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	je .L116
+	cmpq $0, -48(%rbp)
+	je .L118
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L119
+.L116:
+.L117:
+.L112:
+	movzbl -7(%rbp), %eax
+	movl -104(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $264, -24(%rbp), %rax
+	imulq %rcx, %rax
+	movl %eax, -36(%rbp)
+	jmp .L110
+.L73:
+	cmpq $413, %rax
+	je .L71
+	cmpq $458, %rax
+	je .L65
+	jmp .L65
+.L95:
+	movl -52(%rbp), %eax
+	testw %ax, %ax
+	jne .LB2
+.L96:
+.L97:
+	jmp .L94
+.L115:
+	jmp .L112
+.L67:
+	movw $0, -26(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -132(%rbp)
+	cmpl $17, %eax
+	jge .L81
+	.p2align 4,,10
+.L80:
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movl $8, -36(%rbp)
+	movl -132(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -26(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -132(%rbp)
+	cmpl $17, %eax
+	jl .L80
+.L81:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $7, %rax
+	je .L83
+	jmp .L65
+.L71:
+	movzbl -7(%rbp), %eax
+	cmpl -12(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl g0(%rip), %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -48(%rbp)
+	jmp .L65
+.L69:
+	movswl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L86
+	movswl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L86
+	movswq g0(%rip), %rax
+	movl $448, -80(%rbp,%rax,4)
+.L86:
+.L87:
+	movswl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L65
+	movswl g0(%rip), %eax
+	cmpl $4, %eax
+	jge .L65
+	cmpq $0, -24(%rbp)
+	je .L90
+	cmpl $5, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L91
+.L90:
+	movl $0, %eax
+.L91:
+	movq %rax, %rcx
+	movswq g0(%rip), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L88:
+.L89:
+	jmp .L65
+.L70:
+	jmp .L65
+.L83:
+	cmpw $0, -6(%rbp)
+	je .L84
+	cmpq $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L85
+.L84:
+	movl $0, %eax
+.L85:
+	addl %eax, -32(%rbp)
+	movq $0, -48(%rbp)
+	xorl %eax, %eax
+	subl -12(%rbp), %eax
+	cmpl %eax, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -136(%rbp)
+	movzwl -6(%rbp), %eax
+	movl %eax, -144(%rbp)
+	imull -144(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -140(%rbp)
+	movslq -136(%rbp), %rax
+	movq %rax, -152(%rbp)
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -140(%rbp)
+	movb %al, -7(%rbp)
+	movq -152(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -140(%rbp)
+	movb %al, -7(%rbp)
+	movq -152(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -140(%rbp)
+	movb %al, -7(%rbp)
+	movq -152(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -140(%rbp)
+	movb %al, -7(%rbp)
+	movq -152(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -140(%rbp)
+	movb %al, -7(%rbp)
+	movq $5, -48(%rbp)
+.L82:
+	jmp .L65
+.LB1:
+	movl -12(%rbp), %eax
+	jmp .f0_return
+.L118:
+	movl $0, %eax
+.L119:
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L68:
+	movl -4(%rbp), %eax
+	jmp .f0_return
+.LB0:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	cltd
+	idivl %ecx
+	jmp .f0_return
+.LB2:
+	movl $0, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+rec.constprop.4:
+	cmpl $4, %edi
+	jl .L122
+	cmpl $18, %edi
+	jg .L122
+.L120:
+.L121:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jl .L126
+	cmpl $18, -12(%rbp)
+	jle .L124
+.L126:
+	movl -12(%rbp), %eax
+	addl $11, %eax
+.L123:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jl .L154
+	cmpl $18, -12(%rbp)
+	jle .L152
+.L154:
+	movl -12(%rbp), %eax
+	addl $12, %eax
+.L151:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L124:
+.L125:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L130
+	cmpl $18, -8(%rbp)
+	jle .L128
+.L130:
+	movl -8(%rbp), %eax
+	addl $11, %eax
+.L127:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L142
+	cmpl $18, -8(%rbp)
+	jle .L140
+.L142:
+	movl -8(%rbp), %eax
+	addl $12, %eax
+.L139:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L123
+.L152:
+.L153:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L158
+	cmpl $18, -8(%rbp)
+	jle .L156
+.L158:
+	movl -8(%rbp), %eax
+	addl $12, %eax
+.L155:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $12, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L170
+	cmpl $18, -16(%rbp)
+	jle .L168
+.L170:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L167:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L151
+.L128:
+.L129:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L134
+	cmpl $18, -4(%rbp)
+	jle .L132
+.L134:
+	movl -4(%rbp), %eax
+	addl $11, %eax
+.L131:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L138
+	cmpl $18, -4(%rbp)
+	jle .L136
+.L138:
+	movl -4(%rbp), %eax
+	addl $12, %eax
+.L135:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L127
+.L140:
+.L141:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L146
+	cmpl $18, -4(%rbp)
+	jle .L144
+.L146:
+	movl -4(%rbp), %eax
+	addl $12, %eax
+.L143:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $12, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L150
+	cmpl $18, -8(%rbp)
+	jle .L148
+.L150:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L147:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L139
+.L156:
+.L157:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L162
+	cmpl $18, -4(%rbp)
+	jle .L160
+.L162:
+	movl -4(%rbp), %eax
+	addl $12, %eax
+.L159:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $12, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L166
+	cmpl $18, -8(%rbp)
+	jle .L164
+.L166:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L163:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L155
+.L168:
+.L169:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L174
+	cmpl $18, -8(%rbp)
+	jle .L172
+.L174:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L171:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L178
+	cmpl $18, -8(%rbp)
+	jle .L176
+.L178:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L175:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L167
+.L132:
+.L133:
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	pushq %rax
+	subq $8, %rsp
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L131
+.L136:
+.L137:
+	subq $8, %rsp
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L135
+.L144:
+.L145:
+	subq $8, %rsp
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L143
+.L148:
+.L149:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L147
+.L160:
+.L161:
+	subq $8, %rsp
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L159
+.L164:
+.L165:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L163
+.L172:
+.L173:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L171
+.L176:
+.L177:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L175
+.L122:
+	movl %edi, %eax
+	addl $11, %eax
+	ret
+	.size rec.constprop.4, .-rec.constprop.4
+	.align 16
+rec.constprop.5:
+	cmpl $4, %edi
+	jl .L181
+	cmpl $18, %edi
+	jg .L181
+.L179:
+.L180:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jl .L185
+	cmpl $18, -12(%rbp)
+	jle .L183
+.L185:
+	movl -12(%rbp), %eax
+	addl $5, %eax
+.L182:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jl .L213
+	cmpl $18, -12(%rbp)
+	jle .L211
+.L213:
+	movl -12(%rbp), %eax
+	addl $6, %eax
+.L210:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L183:
+.L184:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L189
+	cmpl $18, -8(%rbp)
+	jle .L187
+.L189:
+	movl -8(%rbp), %eax
+	addl $5, %eax
+.L186:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L201
+	cmpl $18, -8(%rbp)
+	jle .L199
+.L201:
+	movl -8(%rbp), %eax
+	addl $6, %eax
+.L198:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L182
+.L211:
+.L212:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L217
+	cmpl $18, -8(%rbp)
+	jle .L215
+.L217:
+	movl -8(%rbp), %eax
+	addl $6, %eax
+.L214:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L229
+	cmpl $18, -16(%rbp)
+	jle .L227
+.L229:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L226:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L210
+.L187:
+.L188:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L193
+	cmpl $18, -4(%rbp)
+	jle .L191
+.L193:
+	movl -4(%rbp), %eax
+	addl $5, %eax
+.L190:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L197
+	cmpl $18, -4(%rbp)
+	jle .L195
+.L197:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L194:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L186
+.L199:
+.L200:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L205
+	cmpl $18, -4(%rbp)
+	jle .L203
+.L205:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L202:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L209
+	cmpl $18, -8(%rbp)
+	jle .L207
+.L209:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L206:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L198
+.L215:
+.L216:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L221
+	cmpl $18, -4(%rbp)
+	jle .L219
+.L221:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L218:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L225
+	cmpl $18, -8(%rbp)
+	jle .L223
+.L225:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L222:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L214
+.L227:
+.L228:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L233
+	cmpl $18, -8(%rbp)
+	jle .L231
+.L233:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L230:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L237
+	cmpl $18, -8(%rbp)
+	jle .L235
+.L237:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L234:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L226
+.L191:
+.L192:
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.5
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L190
+.L195:
+.L196:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L194
+.L203:
+.L204:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L202
+.L207:
+.L208:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L206
+.L219:
+.L220:
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L218
+.L223:
+.L224:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L222
+.L231:
+.L232:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L230
+.L235:
+.L236:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L234
+.L181:
+	movl %edi, %eax
+	addl $5, %eax
+	ret
+	.size rec.constprop.5, .-rec.constprop.5
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movq %rdi, -24(%rbp)
+	movl %esi, -40(%rbp)
+	movl %edx, -28(%rbp)
+	movb %cl, -43(%rbp)
+	movb $0, -42(%rbp)
+	movb $9, -41(%rbp)
+	movl $841, -36(%rbp)
+	movq $1, -8(%rbp)
+	movl $6, -32(%rbp)
+	movq $10, -16(%rbp)
+	movl $36, %eax
+	movq %rax, %rdx
+	cmpl $1000000007, -32(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	subq $455, %rax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L238
+	cmpq $0, -16(%rbp)
+	je .L240
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl -36(%rbp), %eax
+	cmpl %eax, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L241
+.L250:
+	movl $0, %eax
+.L251:
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+.L241:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+8(%rip), %eax
+	cltd
+	idivl %ecx
+	imull $10, %eax, %eax
+	testl %eax, %eax
+	jne .LB3
+.L252:
+.L253:
+.L238:
+.L239:
+	cmpb $0, -41(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpq $10, -24(%rbp)
+	setl %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movzwl %ax, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	je .L254
+	xorl %eax, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movl ga0+32(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	cmpl $0, -40(%rbp)
+	je .L256
+	movl -28(%rbp), %eax
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movl ga0+44(%rip), %eax
+	addl $127, %eax
+	cmpl %ecx, %eax
+	setb %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -42(%rbp)
+	movsbq -42(%rbp), %rax
+	movq %rax, %rdx
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	cmpl $10, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	xorl %eax, %eax
+	subl -40(%rbp), %eax
+	jmp .L257
+.L256:
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $1881, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	movl $1, %eax
+	movq %rax, %rdx
+	movl $457, %eax
+	movq %rax, %rsi
+	movl $595, %eax
+	movq %rax, %rdi
+	call f0
+	movl -28(%rbp), %eax
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rdx
+	movl $9163, %eax
+	movq %rax, %rsi
+	movswl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+.L257:
+.L254:
+.L255:
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+.f1_return:
+	leave
+	ret
+.L240:
+	movswl g0(%rip), %eax
+	imull -28(%rbp), %eax
+	cmpl $3, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movsbl -42(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	popq %rcx
+	imull %ecx, %eax
+	movl %eax, -40(%rbp)
+	movsbl -41(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -28(%rbp)
+	movzbl -43(%rbp), %eax
+	subl $7, %eax
+	movl %eax, -8(%rbp)
+	movl ga0+32(%rip), %eax
+	testl %eax, %eax
+	je .L242
+	movl ga0+20(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L243
+.L242:
+	movl $0, %eax
+.L243:
+	cltd
+	idivl -28(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movl -8(%rbp), %eax
+	movb %al, -42(%rbp)
+	movl ga0+32(%rip), %eax
+	testl %eax, %eax
+	je .L244
+	movl ga0+20(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L245
+.L244:
+	movl $0, %eax
+.L245:
+	cltd
+	idivl -28(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movsbl -42(%rbp), %eax
+	movb %al, -42(%rbp)
+	movl ga0+32(%rip), %eax
+	testl %eax, %eax
+	je .L246
+	movl ga0+20(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L247
+.L246:
+	movl $0, %eax
+.L247:
+	cltd
+	idivl -28(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movsbl -42(%rbp), %eax
+	movb %al, -42(%rbp)
+	movl ga0+32(%rip), %eax
+	testl %eax, %eax
+	je .L248
+	movl ga0+20(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L249
+.L248:
+	movl $0, %eax
+.L249:
+	cltd
+	idivl -28(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movsbl -42(%rbp), %eax
+	movl $4, -28(%rbp)
+	movl ga0+52(%rip), %eax
+	testl %eax, %eax
+	je .L250
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L251
+.LB3:
+	movl $0, %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movl %edi, -4(%rbp)
+	movb %sil, -5(%rbp)
+	movl $4, -12(%rbp)
+	movq $4, -24(%rbp)
+	movw $1, -26(%rbp)
+	movl $1148475071, -32(%rbp)
+	movl $670, -36(%rbp)
+	movq $8, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jge .L258
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -88(%rbp)
+	cmpq $0, -88(%rbp)
+	je .L261
+	.p2align 4,,10
+.L260:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -88(%rbp)
+	jne .L260
+.L261:
+.L258:
+.L259:
+	cmpl $8, -36(%rbp)
+	jge .L263
+	.p2align 4,,10
+.L262:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L262
+.L263:
+	movl $0, -36(%rbp)
+	movl $0, -112(%rbp)
+	movl $3, -108(%rbp)
+	movl $6, -104(%rbp)
+	movl $9, -100(%rbp)
+	movl $4, -36(%rbp)
+	movl -64(%rbp), %eax
+	cmpl -12(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $289, %rax
+	jge .L271
+	cmpq $0, %rax
+	je .L267
+	cmpq $3, %rax
+	je .L265
+	cmpq $34, %rax
+	je .L268
+	jmp .L264
+.L271:
+	cmpq $413, %rax
+	jge .L272
+	cmpq $289, %rax
+	je .L266
+	cmpq $370, %rax
+	je .L267
+	jmp .L264
+.L265:
+	movl $0, -36(%rbp)
+	cmpl $17, -36(%rbp)
+	jge .L273
+	movl $17, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -120(%rbp)
+	cmpq $0, -120(%rbp)
+	je .L276
+	.p2align 4,,10
+.L275:
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -120(%rbp)
+	jne .L275
+.L276:
+.L273:
+.L274:
+	cmpl $17, -36(%rbp)
+	jge .L278
+	.p2align 4,,10
+.L277:
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $17, -36(%rbp)
+	jl .L277
+.L278:
+.L264:
+	movswl -26(%rbp), %eax
+	movl %eax, -140(%rbp)
+	movq %rax, %rcx
+	movl $9, %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	imull -140(%rbp), %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jg .L289
+	movl $92, %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	je .L292
+.L291:
+	movl $8, %eax
+	subl -32(%rbp), %eax
+	imull $4, %eax, %eax
+	testl %eax, %eax
+	jne .LB4
+.L295:
+.L296:
+	movl $947, -12(%rbp)
+.L289:
+.L290:
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L298
+	.p2align 4,,10
+.L297:
+	movabsq $572959139789, %rax
+	movq %rax, -24(%rbp)
+	movslq -32(%rbp), %rax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movl %eax, -112(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jge .L300
+	.p2align 4,,10
+.L299:
+	cmpl $0, -32(%rbp)
+	je .L301
+.L300:
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L297
+.L298:
+	cmpb $0, -5(%rbp)
+	jne .L303
+	cmpl $0, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L304
+.L301:
+.L302:
+	addl $1, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jl .L299
+	jmp .L300
+.L303:
+	movl $1, %eax
+.L304:
+	movzwl %ax, %eax
+	addq %rax, -24(%rbp)
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpb $0, -5(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl -4(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -112(%rbp), %eax
+	testl %eax, %eax
+	jne .LB5
+.L305:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $835048263409, %rax
+	cqo
+	idivq %rcx
+	cmpq $5, %rax
+	je .L308
+.L307:
+.L306:
+	movl $8, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L308:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L310
+	cmpq $10, %rax
+	je .L309
+.L311:
+	movl -32(%rbp), %eax
+	addl $795, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	movl -36(%rbp), %eax
+	movl %eax, -12(%rbp)
+	jmp .L309
+.L310:
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	je .L313
+	cmpq $0, -48(%rbp)
+	je .L315
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L316
+.L313:
+.L314:
+.L309:
+	movzbl -5(%rbp), %eax
+	movl -104(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $264, -24(%rbp), %rax
+	imulq %rcx, %rax
+	movl %eax, -36(%rbp)
+	jmp .L307
+.L272:
+	cmpq $413, %rax
+	je .L270
+	cmpq $458, %rax
+	je .L264
+	jmp .L264
+.L292:
+	movl -52(%rbp), %eax
+	testw %ax, %ax
+	jne .LB6
+.L293:
+.L294:
+	jmp .L291
+.L312:
+	jmp .L309
+.L266:
+	movw $0, -26(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -124(%rbp)
+	cmpl $17, %eax
+	jge .L280
+	.p2align 4,,10
+.L279:
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movl $8, -36(%rbp)
+	movl -124(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -26(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -124(%rbp)
+	cmpl $17, %eax
+	jl .L279
+.L280:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $7, %rax
+	je .L282
+	jmp .L264
+.L270:
+	movzbl -5(%rbp), %eax
+	cmpl -12(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl g0(%rip), %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -48(%rbp)
+	jmp .L264
+.L282:
+	movq $0, -48(%rbp)
+	xorl %eax, %eax
+	subl -12(%rbp), %eax
+	cmpl %eax, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -128(%rbp)
+	movslq -128(%rbp), %rax
+	movq %rax, -136(%rbp)
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	movq -136(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	movq -136(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	movq -136(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	movq -136(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	movq $5, -48(%rbp)
+.L281:
+	jmp .L264
+.L268:
+	movswl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L283
+	movswl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L283
+	movswq g0(%rip), %rax
+	movl $448, -80(%rbp,%rax,4)
+.L283:
+.L284:
+	movswl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L264
+	movswl g0(%rip), %eax
+	cmpl $4, %eax
+	jge .L264
+	cmpq $0, -24(%rbp)
+	je .L287
+	cmpl $5, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L288
+.L287:
+	movl $0, %eax
+.L288:
+	movq %rax, %rcx
+	movswq g0(%rip), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L285:
+.L286:
+	jmp .L264
+.L269:
+	jmp .L264
+.LB5:
+	movl -12(%rbp), %eax
+	jmp .f0.constprop.0_return
+.L315:
+	movl $0, %eax
+.L316:
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L267:
+	movl -4(%rbp), %eax
+	jmp .f0.constprop.0_return
+.LB4:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	cltd
+	idivl %ecx
+	jmp .f0.constprop.0_return
+.LB6:
+	movl $0, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+rec.constprop.2:
+	cmpl $4, %edi
+	jl .L319
+	cmpl $18, %edi
+	jg .L319
+.L317:
+.L318:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jl .L323
+	cmpl $18, -12(%rbp)
+	jle .L321
+.L323:
+	movl -12(%rbp), %eax
+	addl $10, %eax
+.L320:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jl .L351
+	cmpl $18, -12(%rbp)
+	jle .L349
+.L351:
+	movl -12(%rbp), %eax
+	addl $11, %eax
+.L348:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L321:
+.L322:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L327
+	cmpl $18, -8(%rbp)
+	jle .L325
+.L327:
+	movl -8(%rbp), %eax
+	addl $10, %eax
+.L324:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L339
+	cmpl $18, -8(%rbp)
+	jle .L337
+.L339:
+	movl -8(%rbp), %eax
+	addl $11, %eax
+.L336:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L320
+.L349:
+.L350:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L355
+	cmpl $18, -8(%rbp)
+	jle .L353
+.L355:
+	movl -8(%rbp), %eax
+	addl $11, %eax
+.L352:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L367
+	cmpl $18, -8(%rbp)
+	jle .L365
+.L367:
+	movl -8(%rbp), %eax
+	addl $12, %eax
+.L364:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L348
+.L325:
+.L326:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L331
+	cmpl $18, -4(%rbp)
+	jle .L329
+.L331:
+	movl -4(%rbp), %eax
+	addl $10, %eax
+.L328:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L335
+	cmpl $18, -4(%rbp)
+	jle .L333
+.L335:
+	movl -4(%rbp), %eax
+	addl $11, %eax
+.L332:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L324
+.L337:
+.L338:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L343
+	cmpl $18, -4(%rbp)
+	jle .L341
+.L343:
+	movl -4(%rbp), %eax
+	addl $11, %eax
+.L340:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L347
+	cmpl $18, -4(%rbp)
+	jle .L345
+.L347:
+	movl -4(%rbp), %eax
+	addl $12, %eax
+.L344:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L336
+.L353:
+.L354:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L359
+	cmpl $18, -4(%rbp)
+	jle .L357
+.L359:
+	movl -4(%rbp), %eax
+	addl $11, %eax
+.L356:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L363
+	cmpl $18, -4(%rbp)
+	jle .L361
+.L363:
+	movl -4(%rbp), %eax
+	addl $12, %eax
+.L360:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L352
+.L365:
+.L366:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L371
+	cmpl $18, -4(%rbp)
+	jle .L369
+.L371:
+	movl -4(%rbp), %eax
+	addl $12, %eax
+.L368:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $12, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L375
+	cmpl $18, -8(%rbp)
+	jle .L373
+.L375:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L372:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L364
+.L329:
+.L330:
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.2
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L328
+.L333:
+.L334:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L332
+.L341:
+.L342:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L340
+.L345:
+.L346:
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $12, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L344
+.L357:
+.L358:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L356
+.L361:
+.L362:
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $12, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L360
+.L369:
+.L370:
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $12, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L368
+.L373:
+.L374:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L372
+.L319:
+	movl %edi, %eax
+	addl $10, %eax
+	ret
+	.size rec.constprop.2, .-rec.constprop.2
+	.align 16
+rec.constprop.3:
+	cmpl $4, %edi
+	jl .L378
+	cmpl $18, %edi
+	jg .L378
+.L376:
+.L377:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl %edi, -16(%rbp)
+	movl %edi, %eax
+	subl $4, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jl .L382
+	cmpl $18, -12(%rbp)
+	jle .L380
+.L382:
+	movl -12(%rbp), %eax
+	addl $4, %eax
+.L379:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $4, -12(%rbp)
+	jl .L410
+	cmpl $18, -12(%rbp)
+	jle .L408
+.L410:
+	movl -12(%rbp), %eax
+	addl $5, %eax
+.L407:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L380:
+.L381:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L386
+	cmpl $18, -8(%rbp)
+	jle .L384
+.L386:
+	movl -8(%rbp), %eax
+	addl $4, %eax
+.L383:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L398
+	cmpl $18, -8(%rbp)
+	jle .L396
+.L398:
+	movl -8(%rbp), %eax
+	addl $5, %eax
+.L395:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L379
+.L408:
+.L409:
+	movl -12(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L414
+	cmpl $18, -8(%rbp)
+	jle .L412
+.L414:
+	movl -8(%rbp), %eax
+	addl $5, %eax
+.L411:
+	pushq %rax
+	movl -12(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L426
+	cmpl $18, -8(%rbp)
+	jle .L424
+.L426:
+	movl -8(%rbp), %eax
+	addl $6, %eax
+.L423:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L407
+.L384:
+.L385:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L390
+	cmpl $18, -4(%rbp)
+	jle .L388
+.L390:
+	movl -4(%rbp), %eax
+	addl $4, %eax
+.L387:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L394
+	cmpl $18, -4(%rbp)
+	jle .L392
+.L394:
+	movl -4(%rbp), %eax
+	addl $5, %eax
+.L391:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L383
+.L396:
+.L397:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L402
+	cmpl $18, -4(%rbp)
+	jle .L400
+.L402:
+	movl -4(%rbp), %eax
+	addl $5, %eax
+.L399:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L406
+	cmpl $18, -4(%rbp)
+	jle .L404
+.L406:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L403:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L395
+.L412:
+.L413:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L418
+	cmpl $18, -4(%rbp)
+	jle .L416
+.L418:
+	movl -4(%rbp), %eax
+	addl $5, %eax
+.L415:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L422
+	cmpl $18, -4(%rbp)
+	jle .L420
+.L422:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L419:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L411
+.L424:
+.L425:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	jl .L430
+	cmpl $18, -4(%rbp)
+	jle .L428
+.L430:
+	movl -4(%rbp), %eax
+	addl $6, %eax
+.L427:
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl $6, %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L434
+	cmpl $18, -8(%rbp)
+	jle .L432
+.L434:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L431:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L423
+.L388:
+.L389:
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.3
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec.constprop.5
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L387
+.L392:
+.L393:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.5
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L391
+.L400:
+.L401:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.5
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L399
+.L404:
+.L405:
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L403
+.L416:
+.L417:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.5
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L415
+.L420:
+.L421:
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L419
+.L428:
+.L429:
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L427
+.L432:
+.L433:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L431
+.L378:
+	movl %edi, %eax
+	addl $4, %eax
+	ret
+	.size rec.constprop.3, .-rec.constprop.3
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movl %edi, -4(%rbp)
+	movb %sil, -5(%rbp)
+	movl $4, -12(%rbp)
+	movq $4, -24(%rbp)
+	movw $1, -26(%rbp)
+	movl $1148475071, -32(%rbp)
+	movl $670, -36(%rbp)
+	movq $8, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jge .L435
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -88(%rbp)
+	cmpq $0, -88(%rbp)
+	je .L438
+	.p2align 4,,10
+.L437:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -88(%rbp)
+	jne .L437
+.L438:
+.L435:
+.L436:
+	cmpl $8, -36(%rbp)
+	jge .L440
+	.p2align 4,,10
+.L439:
+	movl -36(%rbp), %eax
+	imull $5, %eax, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L439
+.L440:
+	movl $0, -36(%rbp)
+	movl $0, -112(%rbp)
+	movl $3, -108(%rbp)
+	movl $6, -104(%rbp)
+	movl $9, -100(%rbp)
+	movl $4, -36(%rbp)
+	movl -64(%rbp), %eax
+	cmpl -12(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $289, %rax
+	jge .L448
+	cmpq $0, %rax
+	je .L444
+	cmpq $3, %rax
+	je .L442
+	cmpq $34, %rax
+	je .L445
+	jmp .L441
+.L448:
+	cmpq $413, %rax
+	jge .L449
+	cmpq $289, %rax
+	je .L443
+	cmpq $370, %rax
+	je .L444
+	jmp .L441
+.L442:
+	movl $0, -36(%rbp)
+	cmpl $17, -36(%rbp)
+	jge .L450
+	movl $17, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -120(%rbp)
+	cmpq $0, -120(%rbp)
+	je .L453
+	.p2align 4,,10
+.L452:
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -120(%rbp)
+	jne .L452
+.L453:
+.L450:
+.L451:
+	cmpl $17, -36(%rbp)
+	jge .L455
+	.p2align 4,,10
+.L454:
+	movl $237, -76(%rbp)
+	movl $0, -100(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $17, -36(%rbp)
+	jl .L454
+.L455:
+.L441:
+	movswl -26(%rbp), %eax
+	movl %eax, -140(%rbp)
+	movq %rax, %rcx
+	movl $9, %eax
+	subl %ecx, %eax
+	cmpl $10, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	imull -140(%rbp), %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jg .L466
+	movl $92, %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	je .L469
+.L468:
+	movl $8, %eax
+	subl -32(%rbp), %eax
+	imull $4, %eax, %eax
+	testl %eax, %eax
+	jne .LB7
+.L472:
+.L473:
+	movl $947, -12(%rbp)
+.L466:
+.L467:
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L475
+	.p2align 4,,10
+.L474:
+	movabsq $572959139789, %rax
+	movq %rax, -24(%rbp)
+	movslq -32(%rbp), %rax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movl %eax, -112(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jge .L477
+	.p2align 4,,10
+.L476:
+	cmpl $0, -32(%rbp)
+	je .L478
+.L477:
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L474
+.L475:
+	cmpb $0, -5(%rbp)
+	jne .L480
+	cmpl $0, -12(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L481
+.L478:
+.L479:
+	addl $1, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jl .L476
+	jmp .L477
+.L480:
+	movl $1, %eax
+.L481:
+	movzwl %ax, %eax
+	addq %rax, -24(%rbp)
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpb $0, -5(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl -4(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -112(%rbp), %eax
+	testl %eax, %eax
+	jne .LB8
+.L482:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $835048263409, %rax
+	cqo
+	idivq %rcx
+	cmpq $5, %rax
+	je .L485
+.L484:
+.L483:
+	movl $8, %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L485:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L487
+	cmpq $10, %rax
+	je .L486
+.L488:
+	movl -32(%rbp), %eax
+	addl $795, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	movl -36(%rbp), %eax
+	movl %eax, -12(%rbp)
+	jmp .L486
+.L487:
+	movl -108(%rbp), %eax
+	testl %eax, %eax
+	je .L490
+	cmpq $0, -48(%rbp)
+	je .L492
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L493
+.L490:
+.L491:
+.L486:
+	movzbl -5(%rbp), %eax
+	movl -104(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $264, -24(%rbp), %rax
+	imulq %rcx, %rax
+	movl %eax, -36(%rbp)
+	jmp .L484
+.L449:
+	cmpq $413, %rax
+	je .L447
+	cmpq $458, %rax
+	je .L441
+	jmp .L441
+.L469:
+	movl -52(%rbp), %eax
+	testw %ax, %ax
+	jne .LB9
+.L470:
+.L471:
+	jmp .L468
+.L489:
+	jmp .L486
+.L443:
+	movw $0, -26(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -124(%rbp)
+	cmpl $17, %eax
+	jge .L457
+	.p2align 4,,10
+.L456:
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movl $8, -36(%rbp)
+	movl -124(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -26(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -124(%rbp)
+	cmpl $17, %eax
+	jl .L456
+.L457:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $7, %rax
+	je .L459
+	jmp .L441
+.L447:
+	movzbl -5(%rbp), %eax
+	cmpl -12(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl g0(%rip), %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -48(%rbp)
+	jmp .L441
+.L459:
+	cmpq $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	addl %eax, -32(%rbp)
+	movq $0, -48(%rbp)
+	xorl %eax, %eax
+	subl -12(%rbp), %eax
+	cmpl %eax, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -128(%rbp)
+	movslq -128(%rbp), %rax
+	movq %rax, -136(%rbp)
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6757718126012409997, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -5(%rbp)
+	movq -136(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6757718126012409997, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -5(%rbp)
+	movq -136(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6757718126012409997, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -5(%rbp)
+	movq -136(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6757718126012409997, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -5(%rbp)
+	movq -136(%rbp), %rax
+	addq %rax, -24(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6757718126012409997, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movb %al, -5(%rbp)
+	movq $5, -48(%rbp)
+.L458:
+	jmp .L441
+.L445:
+	movswl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L460
+	movswl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L460
+	movswq g0(%rip), %rax
+	movl $448, -80(%rbp,%rax,4)
+.L460:
+.L461:
+	movswl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L441
+	movswl g0(%rip), %eax
+	cmpl $4, %eax
+	jge .L441
+	cmpq $0, -24(%rbp)
+	je .L464
+	cmpl $5, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L465
+.L464:
+	movl $0, %eax
+.L465:
+	movq %rax, %rcx
+	movswq g0(%rip), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L462:
+.L463:
+	jmp .L441
+.L446:
+	jmp .L441
+.LB8:
+	movl -12(%rbp), %eax
+	jmp .f0.constprop.1_return
+.L492:
+	movl $0, %eax
+.L493:
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	jmp .f0.constprop.1_return
+.L444:
+	movl -4(%rbp), %eax
+	jmp .f0.constprop.1_return
+.LB7:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	cltd
+	idivl %ecx
+	jmp .f0.constprop.1_return
+.LB9:
+	movl $0, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb $5, -38(%rbp)
+	movl $2, -36(%rbp)
+	movb $203, -37(%rbp)
+	movl $726, -32(%rbp)
+	movq $255, -24(%rbp)
+	movq -24(%rbp), %rax
+	movl %eax, -28(%rbp)
+	cmpl $4, -28(%rbp)
+	jl .L497
+	cmpl $18, -28(%rbp)
+	jle .L495
+.L497:
+	movl -28(%rbp), %eax
+	addl $10, %eax
+.L494:
+	movl %eax, ga0+40(%rip)
+	cmpl $0, -32(%rbp)
+	jl .L522
+	cmpl $16, -32(%rbp)
+	jge .L522
+	cmpb $0, -38(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L522:
+.L523:
+	movl $695, %eax
+	testl %eax, %eax
+	jne .L524
+	cmpw $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L525
+.L524:
+	movl $1, %eax
+.L525:
+	movq %rax, %rcx
+	movl $128, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movq %rax, %rdx
+	movl -36(%rbp), %eax
+	movq %rax, %rsi
+	movl $117, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movswl %ax, %eax
+	cmpl %eax, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	xorl %eax, %eax
+	subl $374, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $2147483647, %eax
+	subl %ecx, %eax
+	je .L526
+	movl ga0+24(%rip), %eax
+	movl %eax, -28(%rbp)
+	cmpl $4, -28(%rbp)
+	jl .L531
+	cmpl $18, -28(%rbp)
+	jle .L529
+.L531:
+	movl -28(%rbp), %eax
+	addl $4, %eax
+.L528:
+	movslq %eax, %rax
+	movw %ax, g0(%rip)
+.L526:
+.L527:
+	cmpq $0, -24(%rbp)
+	jl .L556
+	cmpq $16, -24(%rbp)
+	jge .L556
+	movq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl $4, (%rdx,%rax,4)
+.L556:
+.L557:
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	cltd
+	idivl %ecx
+	imull $17, %eax, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+0(%rip), %eax
+	addl $5, %eax
+	movl %eax, ga0+28(%rip)
+	movl ga0+60(%rip), %eax
+	addl $5, %eax
+	movl %eax, ga0+56(%rip)
+.L558:
+	movl ga0+12(%rip), %eax
+	imull $3, %eax, %eax
+	cmpl %eax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $44, %eax
+	setge %al
+	movzbl %al, %eax
+	movb %al, -38(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movswq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq -38(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movl -36(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzbl -37(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -32(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L559
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L562
+	.p2align 4,,10
+.L561:
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -8(%rbp)
+	jne .L561
+.L562:
+.L559:
+.L560:
+	cmpl $16, -32(%rbp)
+	jge .L564
+	.p2align 4,,10
+.L563:
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L563
+.L564:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	leave
+	ret
+.L495:
+.L496:
+	movl -28(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -16(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L501
+	cmpl $18, -16(%rbp)
+	jle .L499
+.L501:
+	movl -16(%rbp), %eax
+	addl $10, %eax
+.L498:
+	pushq %rax
+	movl -28(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L513
+	cmpl $18, -16(%rbp)
+	jle .L511
+.L513:
+	movl -16(%rbp), %eax
+	addl $11, %eax
+.L510:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L494
+.L529:
+.L530:
+	movl -28(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -16(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L535
+	cmpl $18, -16(%rbp)
+	jle .L533
+.L535:
+	movl -16(%rbp), %eax
+	addl $4, %eax
+.L532:
+	pushq %rax
+	movl -28(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	cmpl $4, -16(%rbp)
+	jl .L547
+	cmpl $18, -16(%rbp)
+	jle .L545
+.L547:
+	movl -16(%rbp), %eax
+	addl $5, %eax
+.L544:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L528
+.L499:
+.L500:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L505
+	cmpl $18, -8(%rbp)
+	jle .L503
+.L505:
+	movl -8(%rbp), %eax
+	addl $10, %eax
+.L502:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L509
+	cmpl $18, -8(%rbp)
+	jle .L507
+.L509:
+	movl -8(%rbp), %eax
+	addl $11, %eax
+.L506:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L498
+.L511:
+.L512:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L517
+	cmpl $18, -8(%rbp)
+	jle .L515
+.L517:
+	movl -8(%rbp), %eax
+	addl $11, %eax
+.L514:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L521
+	cmpl $18, -8(%rbp)
+	jle .L519
+.L521:
+	movl -8(%rbp), %eax
+	addl $12, %eax
+.L518:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L510
+.L533:
+.L534:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L539
+	cmpl $18, -8(%rbp)
+	jle .L537
+.L539:
+	movl -8(%rbp), %eax
+	addl $4, %eax
+.L536:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L543
+	cmpl $18, -8(%rbp)
+	jle .L541
+.L543:
+	movl -8(%rbp), %eax
+	addl $5, %eax
+.L540:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L532
+.L545:
+.L546:
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L551
+	cmpl $18, -8(%rbp)
+	jle .L549
+.L551:
+	movl -8(%rbp), %eax
+	addl $5, %eax
+.L548:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L555
+	cmpl $18, -8(%rbp)
+	jle .L553
+.L555:
+	movl -8(%rbp), %eax
+	addl $6, %eax
+.L552:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L544
+.L503:
+.L504:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.2
+	pushq %rax
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L502
+.L507:
+.L508:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L506
+.L515:
+.L516:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.4
+	addq $8, %rsp
+	pushq %rax
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L514
+.L519:
+.L520:
+	movl $12, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $12, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L518
+.L537:
+.L538:
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.3
+	pushq %rax
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec.constprop.5
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L536
+.L541:
+.L542:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.5
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L540
+.L549:
+.L550:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec.constprop.5
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L548
+.L553:
+.L554:
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L552
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
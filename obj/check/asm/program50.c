@@ -0,0 +1,316 @@
+long g0;
+unsigned long g1 = 791;
+int ga0[4];
+char f0(unsigned short p0, unsigned long p1) {
+    short v0 = 7;
+    int v1 = 901;
+    unsigned int v2 = 65535;
+    char v3 = 9;
+    int i0 = 2;
+    long j0 = 4;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 968; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 0; }
+    v1 = -((p1 > 2));
+    p0 = p0 + (long)(-(2147483647));
+    la0[3] = ((p1 && 9) < (p0 && 3));
+    return ((la0[2] / 4) || (j0 >= (336u >= 2)));
+}
+short f1(short p0, short p1, unsigned short p2) {
+    long v0 = 317;
+    unsigned long v1 = 792;
+    unsigned short v2 = 628;
+    unsigned short v3 = 622039562192;
+    int v4 = 941;
+    int i0 = 256137773619L;
+    long j0 = 6;
+    if ((817 + ((649 == v2) * (unsigned char)(v2)))) {
+        if ((7 || (g1 - f0(v3, v3)))) {
+            v1 = 0;
+            while (v1 < 3) {
+                if (0) { break; }
+                v1 = v1 + 1;
+            }
+            switch (p1) {
+            case 892:
+                f0(p0, (v4 / 7));
+                v4 = f0((unsigned char)(ga0[0]), f0(10, 4));
+                break;
+            default:
+            case 997:
+                f0(v3, v3);
+                p0 = -(((j0 / (p1 * p1 + 1)) / 5l));
+                break;
+            }
+            p2 = (j0 + ((v1 * 874) < (5 > 2)));
+        }
+        f0(!(p1), (v4 / (p2 * p2 + 1)));
+        if (f0(v1, (ga0[3] + 992))) {
+            f0((65536 + ga0[0]), (long)(ga0[0]));
+            if (814) {
+                f0(v1, (v0 - p2));
+                v0 = v0 + ((0 + p2) + 1086361517736);
+            }
+        } else {
+            switch (530) {
+            case 211:
+                p2 = f0(7, (2 > 2));
+                f0(!(g1), (876U + 65535));
+                break;
+            case 593:
+                f0(ga0[3], j0);
+                f0((long)(725), f0(7, 4294967295));
+            case 984:
+                j0 = f0(-(0), (0 > 439));
+            case 11:
+                break;
+            case -1:
+            case 68:
+                f0((v2 / (v3 * v3 + 1)), -(6));
+                f0(ga0[1], f0(1, 5));
+                break;
+            }
+            switch (p1) {
+            case 11:
+            }
+            if (-(v4)) {
+                f0(g1, (990 - v1));
+                j0 = 8;
+            }
+        }
+    } else {
+        v0 = -(((101 != 5) < f0(j0, j0)));
+        if ((p1 <= 370)) {
+            for (v4 = 1; v4 < 100; v4 = v4 + 1) {
+                p1 = ((2 >= 366318356113) - (4 && (p2 >= 288)));
+            }
+            f0((2 / (j0 * j0 + 1)), 7);
+            v1 = v1 + (65535 && (p1 < p1));
+        } else {
+            for (j0 = 0; j0 < 17; j0 = j0 + 1) {
+                v3 = (666 == ((10 - 2) / (i0 * i0 + 1)));
+            }
+            v1 = (long)(i0);
+        }
+        v3 = ((!(32767) + (v4 + 9)) && (char)((v2 + 3)));
+    }
+    i0 = 0;
+    while (i0 < 17) {
+        v4 = 0;
+        while (v4 < 16) {
+            p1 = 0;
+            while (p1 < 5) {
+                if ((0 - (j0 < v3))) { break; }
+                if ((unsigned short)((3 - v3))) { break; }
+                p1 = p1 + 1;
+            }
+            v0 = ((6 != ga0[0]) / 1);
+            f0(!(151), f0(209, v0));
+            v4 = v4 + 1;
+        }
+        i0 = i0 + 1;
+    }
+    if ((ga0[3] + g1)) {
+        if (!(f0(j0, g0))) {
+            p2 = (((unsigned short)(2) < (unsigned short)(g0)) != f0(931717304072, ga0[0]));
+            j0 = 0;
+            while (j0 < 100) {
+                if (g0) { break; }
+                j0 = j0 + 1;
+            }
+            if ((!(p2) >= j0)) {
+                v1 = ((ga0[3] + (255U || ga0[0])) < (p2 && (j0 + 468)));
+                f0(i0, 8);
+                f0((short)(v4), 1);
+            } else {
+                v3 = v3 + g0;
+                v1 = ((10 / 10) || (ga0[1] >= !(v0)));
+                f0(-(v2), (4 >= 631));
+            }
+        }
+        f0(v4, p0);
+    } else {
+        p1 = 0;
+        while (p1 < 100) {
+            f0((1 / (j0 * j0 + 1)), p2);
+            p1 = p1 + 1;
+        }
+    }
+    p1 = 0;
+    while (p1 < 4) {
+        for (v4 = 0; v4 < 100; v4 = v4 + 1) {
+            v1 = (f0(p1, v4) < !((p1 > 2)));
+        }
+        if (p0) { return ((775708482512 * 961) <= f0(189l, p2)); }
+        p1 = p1 + 1;
+    }
+    v2 = ((405832760201 != (200196331079u < 256)) - (3 + j0));
+    f0(65535, (v3 < 444));
+    return (i0 / (v4 * v4 + 1));
+}
+char f2() {
+    int v0 = 2;
+    unsigned char v1 = 509;
+    unsigned long v2 = 0;
+    short v3 = 10;
+    int v4 = 8;
+    unsigned char v5 = 4;
+    int i0 = 6;
+    long j0 = 323;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 470736245373; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 17; }
+    f0(!(1043402311231), !(i0));
+    for (v3 = 1; v3 < 5; v3 = v3 + 1) {
+        if (!((708 == v2))) {
+            switch (325878850396) {
+            case 6:
+                i0 = f1(!(v5), 405, (425506385830 / (i0 * i0 + 1)));
+                break;
+            case 0:
+            case 7:
+                if (v2 >= 0 && v2 < 4) { la1[v2] = ((3 / 3) != (v2 == ga0[0])); }
+                break;
+            case 8:
+                if (f0(619, v2)) { break; }
+                if ((g1 + (unsigned short)(6))) { break; }
+                break;
+            case 3:
+                v5 = (!(1) > 10);
+                if (f1(v2, 65536, v2)) { break; }
+                break;
+            default:
+                v0 = 794;
+                if ((la1[0] || i0)) { break; }
+            }
+        }
+        v1 = 0;
+        v0 = !(v3);
+    }
+    if (8) {
+        v2 = ((f1(9, 1095121381984, 3) <= v0) + ga0[0]);
+        if (ga0[2]) {
+            f1(128, 8L, 284260700078);
+            v2 = (((7 / (g1 * g1 + 1)) < (127 - j0)) + (unsigned int)((v5 - g1)));
+        } else {
+            v0 = (((i0 / (j0 * j0 + 1)) - !(v1)) * !(-(216002027126)));
+        }
+        v2 = v2 + la0[6];
+    } else {
+        v3 = 201;
+        for (v4 = 2; v4 < 16; v4 = v4 + 1) {
+            v0 = f0(g1, g0);
+            v1 = v1 + v3;
+        }
+        if (!((6 + !(g0)))) {
+            v2 = (f0(8, 2) >= 9);
+            if ((short)((v1 - v3))) { return f0(8, 6); }
+        }
+    }
+    if ((short)((6 && (952 != 3)))) {
+        i0 = i0 + f1(5u, la1[3], 256);
+        j0 = (-(g0) / 16);
+    } else {
+        i0 = i0 + (!(v3) * 8);
+        switch (v1) {
+        default:
+            f1((la1[1] / 2), (v0 && 5u), !(g0));
+            switch (((unsigned short)(i0) + v2)) {
+            default:
+                break;
+            case 5:
+                break;
+            case 3:
+                v1 = (2 / (v4 * v4 + 1));
+            case 4:
+                f0(!(769678371794), !(v1));
+                break;
+            case 10:
+                break;
+            case 2:
+                break;
+            case 8:
+                f1((v5 * 3), j0, !(j0));
+                f1((3 || v3), (v5 < v3), (la1[3] - 10));
+                break;
+            }
+            break;
+        case 477:
+            v5 = f1((2 == v0), (long)(g1), (unsigned long)(821));
+            for (v2 = 2; v2 < 8; v2 = v2 + 1) {
+                if (!((4294967295 + 10))) { break; }
+                v5 = g0;
+                v1 = (f1(j0, v2, i0) > ((630134876088 * la1[1]) + (char)(6)));
+            }
+        case 3:
+            if ((f0(v0, 919) - (!(v0) - (char)(v0)))) {
+                v3 = 46;
+            }
+            break;
+        case 269:
+            break;
+        case 16:
+            break;
+        case 918:
+            break;
+        }
+    }
+    v4 = (6 + ((i0 < v2) / 7));
+    i0 = ((long)((5 || v5)) / 3);
+    for (j0 = 0; j0 < 33; j0 = j0 + 1) {
+        v3 = f0(ga0[0], j0);
+        if (266) {
+            v2 = ((v4 - v1) != 236);
+            if ((((v3 / (v4 * v4 + 1)) / 10) != ((2147483647 == g1) + !(la0[2])))) {
+                v5 = ((v4 + i0) / (v0 * v0 + 1));
+                v0 = f0(ga0[0], i0);
+                if (la1[3]) { break; }
+            }
+            if (450) {
+                la0[2] = v3;
+            }
+        } else {
+            v1 = ((v1 <= v2) && j0);
+            if (v3 >= 0 && v3 < 8) { la0[v3] = (unsigned short)(j0); }
+            if ((f1(7, v5, v3) || 8)) {
+                v1 = (((unsigned int)(la0[4]) <= la1[1]) <= (v4 && f0(ga0[2], 1)));
+                if ((char)(v1)) { return 7; }
+                if (((v5 || 10) <= v4)) { break; }
+            }
+        }
+    }
+    return (!((j0 != la0[6])) - ((unsigned short)(6) != f0(v0, v1)));
+}
+int main() {
+    unsigned char v0 = 590;
+    int v1 = 8;
+    unsigned short v2 = 7;
+    long v3 = 127;
+    int v4 = 505;
+    int i0 = 65536;
+    long j0 = 1070393379363;
+    if (!(v4)) {
+        f1((v1 - 6), 762, (v1 > 687));
+    }
+    i0 = ((1 / (v3 * v3 + 1)) >= g1);
+    if ((v1 + 9u)) {
+        v4 = f0((int)(v0), v1);
+        v0 = (long)(440);
+        j0 = f2();
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1916 @@
+	.section .data
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.quad 791
+	.section .bss
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.type f0.constprop.3, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.type f2, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq $4, -8(%rbp)
+	movl $1936, -12(%rbp)
+	xorl %eax, %eax
+	cmpq $2, %rsi
+	seta %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movzwl %di, %eax
+	addq $-2147483647, %rax
+	movw %ax, -14(%rbp)
+	cmpw $0, -14(%rbp)
+	je .L0
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L1
+.L0:
+	movl $0, %eax
+.L1:
+	pushq %rax
+	cmpq $0, %rsi
+	je .L2
+	movl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L3
+.L2:
+	movl $0, %eax
+.L3:
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl -12(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L4
+	cmpq $1, -8(%rbp)
+	setge %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L4:
+	movl $1, %eax
+.L5:
+.f0_return:
+	leave
+	ret
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movw %di, -2(%rbp)
+	movw $7, -4(%rbp)
+	movl $901, -8(%rbp)
+	movl $65535, -12(%rbp)
+	movb $9, -13(%rbp)
+	movl $2, -20(%rbp)
+	movq $4, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -48(%rbp)
+	movl $968, -44(%rbp)
+	movl $1936, -40(%rbp)
+	movl $2904, -36(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -80(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -20(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L8
+	.p2align 4,,10
+.L7:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L7
+	movl %ecx, -20(%rbp)
+.L8:
+.L6:
+	cmpl $8, -20(%rbp)
+	jge .L10
+	.p2align 4,,10
+.L9:
+	movslq -20(%rbp), %rax
+	movl $0, -80(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L9
+.L10:
+	movl $0, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	addq $-2147483647, %rax
+	movw %ax, -2(%rbp)
+	cmpw $0, -2(%rbp)
+	je .L11
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L12
+.L11:
+	movl $0, %eax
+.L12:
+	testl %eax, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl -40(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L13
+	cmpq $1, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L13:
+	movl $1, %eax
+.L14:
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movw %di, -2(%rbp)
+	movw $7, -4(%rbp)
+	movl $901, -8(%rbp)
+	movl $65535, -12(%rbp)
+	movb $9, -13(%rbp)
+	movl $2, -20(%rbp)
+	movq $4, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -48(%rbp)
+	movl $968, -44(%rbp)
+	movl $1936, -40(%rbp)
+	movl $2904, -36(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -80(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -20(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L17
+	.p2align 4,,10
+.L16:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L16
+	movl %ecx, -20(%rbp)
+.L17:
+.L15:
+	cmpl $8, -20(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movslq -20(%rbp), %rax
+	movl $0, -80(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L18
+.L19:
+	movl $0, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	addq $-2147483647, %rax
+	movw %ax, -2(%rbp)
+	cmpw $0, -2(%rbp)
+	je .L20
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L21
+.L20:
+	movl $0, %eax
+.L21:
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl -40(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L22
+	cmpq $1, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.1_return
+.L22:
+	movl $1, %eax
+.L23:
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movw %di, -2(%rbp)
+	movw $7, -4(%rbp)
+	movl $901, -8(%rbp)
+	movl $65535, -12(%rbp)
+	movb $9, -13(%rbp)
+	movl $2, -20(%rbp)
+	movq $4, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -48(%rbp)
+	movl $968, -44(%rbp)
+	movl $1936, -40(%rbp)
+	movl $2904, -36(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -80(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -20(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L26
+	.p2align 4,,10
+.L25:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L25
+	movl %ecx, -20(%rbp)
+.L26:
+.L24:
+	cmpl $8, -20(%rbp)
+	jge .L28
+	.p2align 4,,10
+.L27:
+	movslq -20(%rbp), %rax
+	movl $0, -80(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L27
+.L28:
+	movl $-1, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	addq $-2147483647, %rax
+	movw %ax, -2(%rbp)
+	cmpw $0, -2(%rbp)
+	je .L29
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L30
+.L29:
+	movl $0, %eax
+.L30:
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl -40(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L31
+	cmpq $1, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.2_return
+.L31:
+	movl $1, %eax
+.L32:
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f0.constprop.3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movw %di, -2(%rbp)
+	movw $7, -4(%rbp)
+	movl $901, -8(%rbp)
+	movl $65535, -12(%rbp)
+	movb $9, -13(%rbp)
+	movl $2, -20(%rbp)
+	movq $4, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -48(%rbp)
+	movl $968, -44(%rbp)
+	movl $1936, -40(%rbp)
+	movl $2904, -36(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -80(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -20(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L35
+	.p2align 4,,10
+.L34:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L34
+	movl %ecx, -20(%rbp)
+.L35:
+.L33:
+	cmpl $8, -20(%rbp)
+	jge .L37
+	.p2align 4,,10
+.L36:
+	movslq -20(%rbp), %rax
+	movl $0, -80(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L36
+.L37:
+	movl $-1, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	addq $-2147483647, %rax
+	movw %ax, -2(%rbp)
+	cmpw $0, -2(%rbp)
+	je .L38
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L39
+.L38:
+	movl $0, %eax
+.L39:
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl -40(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L40
+	cmpq $1, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.3_return
+.L40:
+	movl $1, %eax
+.L41:
+.f0.constprop.3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.3, .-f0.constprop.3
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movw %di, -88(%rbp)
+	movw %si, -86(%rbp)
+	movw %dx, -84(%rbp)
+	movq $317, -56(%rbp)
+	movq $792, -24(%rbp)
+	movw $628, -8(%rbp)
+	movw $30672, -82(%rbp)
+	movl $941, -80(%rbp)
+	movl $-1560264141, -76(%rbp)
+	movq $6, -48(%rbp)
+	movzwl -8(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	movl %eax, -72(%rbp)
+	cmpl $649, %eax
+	sete %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	addl $817, %eax
+	je .L42
+	movl $7, %eax
+	testl %eax, %eax
+	jne .L46
+	movzwl -82(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -82(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movsbq %al, %rax
+	movq %rax, %rcx
+	movq g1(%rip), %rax
+	subq %rcx, %rax
+	je .L44
+.L46:
+	movq $0, -24(%rbp)
+	cmpq $3, -24(%rbp)
+	jae .L48
+	.p2align 4,,10
+.L47:
+	xorl %eax, %eax
+	je .L49
+.L48:
+	movswl -86(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movslq %eax, %rax
+	cmpq $892, %rax
+	je .L52
+	cmpq $997, %rax
+.L53:
+	movzwl -82(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -82(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movw %ax, -88(%rbp)
+	jmp .L51
+.L52:
+	movl -80(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movswl -88(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	movsbq %al, %rax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movsbl %al, %eax
+	movl %eax, -80(%rbp)
+.L51:
+	movl $5, %eax
+	cmpl $2, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $874, -24(%rbp), %rax
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq -48(%rbp), %rax
+	movw %ax, -84(%rbp)
+.L44:
+.L45:
+	movzwl -84(%rbp), %eax
+	movl %eax, -16(%rbp)
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rsi
+	cmpw $0, -86(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movl ga0+12(%rip), %eax
+	addl $992, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movw %ax, -8(%rbp)
+	movq %rax, %rdi
+	call f0
+	testb %al, %al
+	je .L54
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	addl $65536, %eax
+	movq %rax, %rdi
+	call f0
+	movl $814, %eax
+	testl %eax, %eax
+	je .L56
+	movq -56(%rbp), %rax
+	movzwl -84(%rbp), %ecx
+	subq %rcx, %rax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movl -16(%rbp), %eax
+	addl $0, %eax
+	movslq %eax, %rax
+	movabsq $1086361517736, %rcx
+	addq %rcx, %rax
+	addq %rax, -56(%rbp)
+.L56:
+.L57:
+.L67:
+.L68:
+.L55:
+.L43:
+	movl $0, -76(%rbp)
+	movzwl -82(%rbp), %eax
+	movq %rax, -40(%rbp)
+	cmpq %rax, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -68(%rbp)
+	movl $3, %eax
+	movzwl -82(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -64(%rbp)
+	cmpl $17, -76(%rbp)
+	jge .L90
+	.p2align 4,,10
+.L89:
+	movl $0, -80(%rbp)
+	movl -68(%rbp), %eax
+	movl %eax, -32(%rbp)
+	movl -64(%rbp), %eax
+	movl %eax, -60(%rbp)
+	cmpl $16, -80(%rbp)
+	jge .L92
+	.p2align 4,,10
+.L91:
+	movw $0, -86(%rbp)
+	movl -32(%rbp), %eax
+	movl %eax, -24(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movswl -86(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, %eax
+	jge .L94
+	.p2align 4,,10
+.L93:
+	cmpl $0, -24(%rbp)
+	je .L95
+.L94:
+	movl ga0+0(%rip), %eax
+	cmpl $6, %eax
+	setne %al
+	movzbl %al, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	movq -56(%rbp), %rax
+	movq %rax, %rsi
+	movl $209, %eax
+	movq %rax, %rdi
+	call f0
+	movsbq %al, %rax
+	movq %rax, %rsi
+	movl $151, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	addl $1, -80(%rbp)
+	cmpl $16, -80(%rbp)
+	jl .L91
+.L92:
+	addl $1, -76(%rbp)
+	cmpl $17, -76(%rbp)
+	jl .L89
+.L90:
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	addq g1(%rip), %rax
+	je .L99
+	movq g0(%rip), %rax
+	movq %rax, %rsi
+	movq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testb %al, %al
+	jne .L101
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl $53000, %eax
+	movq %rax, %rdi
+	call f0
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movq g0(%rip), %rax
+	movzwl %ax, %eax
+	cmpl $2, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -84(%rbp)
+	movq $0, -48(%rbp)
+	cmpq $100, -48(%rbp)
+	jge .L104
+	.p2align 4,,10
+.L103:
+	cmpq $0, g0(%rip)
+	je .L105
+.L104:
+	cmpw $0, -84(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -48(%rbp), %rax
+	jl .L107
+	cmpw $0, -84(%rbp)
+	je .L109
+	movq -48(%rbp), %rax
+	addq $468, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L110
+.L95:
+.L96:
+	movl -16(%rbp), %eax
+	testw %ax, %ax
+	je .L97
+	jmp .L94
+.L97:
+.L98:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -86(%rbp)
+	movswl -86(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, %eax
+	jl .L93
+	jmp .L94
+.L105:
+.L106:
+	addq $1, -48(%rbp)
+	cmpq $100, -48(%rbp)
+	jl .L103
+	jmp .L104
+.L99:
+	movw $0, -86(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -16(%rbp)
+	movswl -86(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $100, %eax
+	jge .L116
+	.p2align 4,,10
+.L115:
+	movzwl -84(%rbp), %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	cqo
+	idivq -16(%rbp)
+	movq %rax, %rdi
+	call f0
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -86(%rbp)
+	movswl -86(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $100, %eax
+	jl .L115
+	jmp .L116
+.L109:
+	movl $0, %eax
+.L110:
+	pushq %rax
+	movl $255, %eax
+	testl %eax, %eax
+	jne .L111
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L112
+.L111:
+	movl $1, %eax
+.L112:
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	addl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl $8, %eax
+	movq %rax, %rsi
+	movl -76(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movl -80(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	jmp .L108
+.L107:
+	movq -40(%rbp), %rax
+	addq g0(%rip), %rax
+	movw %ax, -82(%rbp)
+	movl $10, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	jne .L113
+	cmpq $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga0+4(%rip), %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .L114
+.L49:
+.L50:
+	addq $1, -24(%rbp)
+	cmpq $3, -24(%rbp)
+	jb .L47
+	jmp .L48
+.L54:
+	movl $530, %eax
+	movslq %eax, %rax
+	cmpq $211, %rax
+	jge .L64
+	cmpq $-1, %rax
+	je .L63
+	cmpq $11, %rax
+	je .L58
+	cmpq $68, %rax
+	je .L63
+	jmp .L58
+.L42:
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movl $101, %eax
+	cmpl $5, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	movswl -86(%rbp), %eax
+	cmpl $370, %eax
+	jg .L69
+	movl $1, -80(%rbp)
+	movl $4, %eax
+	testl %eax, %eax
+	je .L71
+	movzwl -84(%rbp), %eax
+	cmpl $288, %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .L72
+.L64:
+	cmpq $211, %rax
+	je .L59
+	cmpq $593, %rax
+	je .L60
+	cmpq $984, %rax
+	je .L61
+	jmp .L58
+.L63:
+	xorl %eax, %eax
+	subl $6, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movzwl -82(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -72(%rbp), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdi
+	call f0
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	movsbq %al, %rax
+	movq %rax, %rsi
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdi
+	call f0
+.L58:
+	movswl -86(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $11, %rax
+.L66:
+.L65:
+	xorl %eax, %eax
+	subl -80(%rbp), %eax
+	je .L67
+	movl $990, %eax
+	subq -24(%rbp), %rax
+	movq %rax, %rsi
+	movq g1(%rip), %rax
+	movq %rax, %rdi
+	call f0
+	movq $8, -48(%rbp)
+	jmp .L68
+.L71:
+	movl $0, %eax
+.L72:
+	movq %rax, %rcx
+	movabsq $366318356113, %rax
+	cmpq $2, %rax
+	setle %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movl %eax, -16(%rbp)
+	cmpl $100, -80(%rbp)
+	jge .L73
+	movl $100, %eax
+	movslq -80(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L76
+	.p2align 4,,10
+.L75:
+	movl -16(%rbp), %eax
+	movw %ax, -86(%rbp)
+	addl $1, -80(%rbp)
+	movswl -86(%rbp), %eax
+	movw %ax, -86(%rbp)
+	addl $1, -80(%rbp)
+	movswl -86(%rbp), %eax
+	movw %ax, -86(%rbp)
+	addl $1, -80(%rbp)
+	movswl -86(%rbp), %eax
+	movw %ax, -86(%rbp)
+	addl $1, -80(%rbp)
+	subq $1, -8(%rbp)
+	jne .L75
+.L76:
+.L73:
+.L74:
+	cmpl $100, -80(%rbp)
+	jge .L78
+	.p2align 4,,10
+.L77:
+	movl -16(%rbp), %eax
+	movw %ax, -86(%rbp)
+	addl $1, -80(%rbp)
+	cmpl $100, -80(%rbp)
+	jl .L77
+.L78:
+	movl $7, %eax
+	movq %rax, %rsi
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $2, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rdi
+	call f0
+	movl $65535, %eax
+	testl %eax, %eax
+	je .L79
+	movswl -86(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl %eax, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L80
+.L69:
+	movq $0, -48(%rbp)
+	movl $10, %eax
+	subl $2, %eax
+	movl %eax, -24(%rbp)
+	movl -76(%rbp), %eax
+	imull -76(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -16(%rbp)
+	cmpq $17, -48(%rbp)
+	jge .L81
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L84
+	.p2align 4,,10
+.L83:
+	movl -24(%rbp), %eax
+	cltd
+	idivl -16(%rbp)
+	cmpl $666, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -82(%rbp)
+	addq $1, -48(%rbp)
+	movzwl -82(%rbp), %eax
+	movw %ax, -82(%rbp)
+	addq $1, -48(%rbp)
+	movzwl -82(%rbp), %eax
+	movw %ax, -82(%rbp)
+	addq $1, -48(%rbp)
+	movzwl -82(%rbp), %eax
+	addq $1, -48(%rbp)
+	subq $1, -8(%rbp)
+	jne .L83
+.L84:
+.L81:
+.L82:
+	cmpq $17, -48(%rbp)
+	jge .L86
+	.p2align 4,,10
+.L85:
+	movl -24(%rbp), %eax
+	cltd
+	idivl -16(%rbp)
+	cmpl $666, %eax
+	sete %al
+	movzbl %al, %eax
+	addq $1, -48(%rbp)
+	cmpq $17, -48(%rbp)
+	jl .L85
+.L86:
+	movslq -76(%rbp), %rax
+.L70:
+	movl -80(%rbp), %eax
+	addl $9, %eax
+	movq %rax, %rcx
+	movl $32767, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L87
+	movl -72(%rbp), %eax
+	addl $3, %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L88
+.L87:
+	movl $0, %eax
+.L88:
+	movw %ax, -82(%rbp)
+	jmp .L43
+.L60:
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+12(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movl $4294967295, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	movsbq %al, %rax
+	movq %rax, %rsi
+	movl $725, %eax
+	movq %rax, %rdi
+	call f0
+.L61:
+	xorl %eax, %eax
+	subl $0, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movsbq %al, %rax
+	movq %rax, -48(%rbp)
+.L62:
+	jmp .L58
+.L79:
+	movl $0, %eax
+.L80:
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	jmp .L70
+.L59:
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movsbl %al, %eax
+	movw %ax, -84(%rbp)
+	cmpq $0, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0.constprop.3
+	jmp .L58
+.LB0:
+	movzwl -84(%rbp), %eax
+	movq %rax, %rsi
+	movl $189, %eax
+	movq %rax, %rdi
+	call f0
+	movsbq %al, %rax
+	cmpq %rax, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+.f1_return:
+	leave
+	ret
+.L113:
+	movl $1, %eax
+.L114:
+	movslq %eax, %rax
+	xorl %eax, %eax
+	subl -72(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+.L108:
+.L101:
+.L102:
+	movswq -88(%rbp), %rax
+	movq %rax, %rsi
+	movl -80(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+.L116:
+.L100:
+	movw $0, -86(%rbp)
+	movabsq $775708482512, %rax
+	imulq $961, %rax, %rax
+	movq %rax, -32(%rbp)
+	movswl -86(%rbp), %eax
+	movl %eax, -60(%rbp)
+	cmpl $4, %eax
+	jge .L118
+	.p2align 4,,10
+.L117:
+	movl $0, -80(%rbp)
+	cmpl $2, -60(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -24(%rbp)
+	cmpl $100, -80(%rbp)
+	jge .L119
+	movl $100, %eax
+	movslq -80(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L122
+	.p2align 4,,10
+.L121:
+	cmpl $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movslq -80(%rbp), %rax
+	movq %rax, %rsi
+	movswl -86(%rbp), %eax
+	movw %ax, -8(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addl $1, -80(%rbp)
+	cmpl $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movslq -80(%rbp), %rax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addl $1, -80(%rbp)
+	cmpl $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movslq -80(%rbp), %rax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addl $1, -80(%rbp)
+	cmpl $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movslq -80(%rbp), %rax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addl $1, -80(%rbp)
+	subq $1, -16(%rbp)
+	jne .L121
+.L122:
+.L119:
+.L120:
+	cmpl $100, -80(%rbp)
+	jge .L124
+	.p2align 4,,10
+.L123:
+	cmpl $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movslq -80(%rbp), %rax
+	movq %rax, %rsi
+	movswl -86(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addl $1, -80(%rbp)
+	cmpl $100, -80(%rbp)
+	jl .L123
+.L124:
+	cmpw $0, -88(%rbp)
+	jne .LB0
+.L125:
+.L126:
+	movl -60(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -86(%rbp)
+	movswl -86(%rbp), %eax
+	movl %eax, -60(%rbp)
+	cmpl $4, %eax
+	jl .L117
+.L118:
+	movq -48(%rbp), %rax
+	addq $3, %rax
+	pushq %rax
+	movabsq $200196331079, %rax
+	cmpq $256, %rax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $405832760201, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	subq %rcx, %rax
+	movzwl -82(%rbp), %eax
+	cmpl $444, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl $65535, %eax
+	movq %rax, %rdi
+	call f0
+	movl -80(%rbp), %eax
+	imull -80(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -76(%rbp), %eax
+	cltd
+	idivl %ecx
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb $78, -39(%rbp)
+	movl $8, -36(%rbp)
+	movw $7, -38(%rbp)
+	movq $127, -24(%rbp)
+	movl $505, -32(%rbp)
+	movabsq $1070393379363, %rax
+	movq %rax, -16(%rbp)
+	cmpl $0, -32(%rbp)
+	jne .L127
+	cmpl $687, -36(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $762, %eax
+	movq %rax, %rsi
+	movl -36(%rbp), %eax
+	subl $6, %eax
+	movq %rax, %rdi
+	call f1
+.L127:
+.L128:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	cqo
+	idivq %rcx
+	cmpq g1(%rip), %rax
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	movl -36(%rbp), %eax
+	addl $9, %eax
+	je .L129
+	movslq -36(%rbp), %rax
+	movq %rax, %rsi
+	movzbl -39(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movsbl %al, %eax
+	movl %eax, -32(%rbp)
+	movb $184, -39(%rbp)
+	call f2
+	movsbq %al, %rax
+	movq %rax, -16(%rbp)
+.L129:
+.L130:
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl -39(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzwl -38(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -32(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	leave
+	ret
+	.size main, .-main
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movl $2, -4(%rbp)
+	movb $253, -5(%rbp)
+	movq $0, -16(%rbp)
+	movw $10, -18(%rbp)
+	movl $8, -24(%rbp)
+	movb $4, -25(%rbp)
+	movl $6, -32(%rbp)
+	movq $323, -40(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jge .L131
+	movl $8, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -88(%rbp)
+	cmpq $0, -88(%rbp)
+	je .L134
+	.p2align 4,,10
+.L133:
+	movslq -32(%rbp), %rax
+	movq %rax, -96(%rbp)
+	movabsq $470736245373, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -96(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -104(%rbp)
+	movabsq $470736245373, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -104(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -112(%rbp)
+	movabsq $470736245373, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -112(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -120(%rbp)
+	movabsq $470736245373, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -88(%rbp)
+	jne .L133
+.L134:
+.L131:
+.L132:
+	cmpl $8, -32(%rbp)
+	jge .L136
+	.p2align 4,,10
+.L135:
+	movslq -32(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movabsq $470736245373, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jl .L135
+.L136:
+	movl $0, -32(%rbp)
+	movl $0, -144(%rbp)
+	movl $17, -140(%rbp)
+	movl $34, -136(%rbp)
+	movl $51, -132(%rbp)
+	movl $4, -32(%rbp)
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	movw $1, -18(%rbp)
+	cmpq $708, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -148(%rbp)
+	cmpq $0, -16(%rbp)
+	jb .L137
+	cmpq $4, -16(%rbp)
+	setb %al
+	movzbl %al, %eax
+	jmp .L138
+.L137:
+	movl $0, %eax
+.L138:
+	movl %eax, -152(%rbp)
+	movl $1, -156(%rbp)
+	movswl -18(%rbp), %eax
+	movl %eax, -160(%rbp)
+	cmpl $5, %eax
+	jge .L140
+	.p2align 4,,10
+.L139:
+	cmpl $0, -148(%rbp)
+	jne .L141
+	movabsq $325878850396, %rax
+	movq %rax, %rcx
+	cmpq $8, %rcx
+	ja .L149
+	leaq .L150(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L148
+	# table target .L145
+	# table target .L147
+	# table target .L144
+	# table target .L146
+	jmp *%rcx
+.L149:
+.L148:
+	movl $794, -4(%rbp)
+	movl -144(%rbp), %eax
+	testl %eax, %eax
+	jne .L161
+	cmpl $0, -32(%rbp)
+.L161:
+.L159:
+.L160:
+.L143:
+.L141:
+.L142:
+	movb $0, -5(%rbp)
+	cmpw $0, -18(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movl -160(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -18(%rbp)
+	movswl -18(%rbp), %eax
+	movl %eax, -160(%rbp)
+	cmpl $5, %eax
+	jl .L139
+.L140:
+	movl ga0+0(%rip), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $3, %eax
+	movq %rax, %rdx
+	movl $10848, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movswl %ax, %eax
+	cmpl -4(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	je .L162
+	movl $4014, %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $128, %eax
+	movq %rax, %rdi
+	call f1
+	movzbl -25(%rbp), %eax
+	subq g1(%rip), %rax
+	pushq %rax
+	movl $127, %eax
+	subq -40(%rbp), %rax
+	pushq %rax
+	movq g1(%rip), %rax
+	imulq g1(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $7, %eax
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movq %rax, -16(%rbp)
+	jmp .L163
+.L162:
+	movl $0, -4(%rbp)
+.L163:
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	movl $256, %eax
+	movq %rax, %rdx
+	movl -132(%rbp), %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+	movswl %ax, %eax
+	addl %eax, -32(%rbp)
+	xorl %eax, %eax
+	subq g0(%rip), %rax
+	leaq 15(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $4, %rcx
+	movq %rcx, %rax
+	movq %rax, -40(%rbp)
+	movslq -32(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	addl $6, %eax
+	movl %eax, -24(%rbp)
+	movl $0, -32(%rbp)
+	movq $0, -40(%rbp)
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -164(%rbp)
+	movl -24(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -168(%rbp)
+	cmpq $33, -40(%rbp)
+	jge .L165
+	.p2align 4,,10
+.L164:
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movsbl %al, %eax
+	movw %ax, -18(%rbp)
+	movl -24(%rbp), %eax
+	movzbl -5(%rbp), %ecx
+	subl %ecx, %eax
+	cmpl $236, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl -72(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $2147483647, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	pushq %rax
+	movswl -18(%rbp), %eax
+	movl %eax, -172(%rbp)
+	cltd
+	idivl -164(%rbp)
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	je .L166
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -168(%rbp), %eax
+	cltd
+	idivl %ecx
+	movb %al, -25(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movsbl %al, %eax
+	movl %eax, -4(%rbp)
+	movl -132(%rbp), %eax
+	testl %eax, %eax
+	je .L168
+.L165:
+	movzbl -5(%rbp), %eax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movsbl %al, %eax
+	cmpl $6, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L168:
+.L169:
+.L166:
+.L167:
+	movl -172(%rbp), %eax
+	movl %eax, -72(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $33, -40(%rbp)
+	jl .L164
+	jmp .L165
+.L144:
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $425506385830, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rdx
+	movl $405, %eax
+	movq %rax, %rsi
+	cmpb $0, -25(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f1
+	movswl %ax, %eax
+	movl %eax, -32(%rbp)
+	jmp .L143
+.L145:
+	cmpl $0, -152(%rbp)
+	je .L143
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -156(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+.L151:
+.L152:
+	jmp .L143
+.L146:
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $619, %eax
+	movq %rax, %rdi
+	call f0
+	testb %al, %al
+	je .L153
+	jmp .L143
+.L153:
+.L154:
+	movq g1(%rip), %rax
+	addq $6, %rax
+	je .L143
+	jmp .L143
+.L155:
+.L156:
+	jmp .L143
+.L147:
+	movb $0, -25(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	je .L143
+	jmp .L143
+.L157:
+.L158:
+	jmp .L143
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L150:
+	.long .L145-.L150
+	.long .L148-.L150
+	.long .L148-.L150
+	.long .L147-.L150
+	.long .L148-.L150
+	.long .L148-.L150
+	.long .L144-.L150
+	.long .L145-.L150
+	.long .L146-.L150
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,69 @@
+short g0 = 3;
+unsigned short g1;
+unsigned long g2;
+int ga0[33];
+int ga1[33];
+char f0(char p0, unsigned int p1, unsigned long p2) {
+    unsigned char v0 = 5ul;
+    short v1 = 8;
+    unsigned long v2 = 0;
+    unsigned char v3 = 4;
+    int i0 = 701;
+    long j0 = 332706488212;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 1; }
+    v3 = ((807753144021 - g0) / (p1 * p1 + 1));
+    v1 = (((i0 && 0) != 1000000007) || !(g1));
+    if (316) { return 111355780739; }
+    v2 = 0;
+    while (v2 < 17) {
+        if (v3 >= 0 && v3 < 8) { la0[v3] = ((151L - 4) - g2); }
+        v2 = v2 + 1;
+    }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) {
+        for (j0 = 1; j0 < 100; j0 = j0 + 1) {
+            p0 = g2;
+        }
+        p2 = ((256U || (g1 > v2)) == (j0 / 10));
+    }
+    for (i0 = 2; i0 < 16; i0 = i0 + 1) {
+        v0 = j0;
+    }
+    return (p0 < ((v0 != 917) / (j0 * j0 + 1)));
+}
+void w0(char q0, unsigned long q1) {
+    g0 = g0 * 3 + q0;
+    g2 = g2 * 3 + q0;
+}
+int main() {
+    unsigned char v0 = 200778690393U;
+    unsigned long v1 = 105891875685;
+    int i0 = 746;
+    long j0 = 7;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 9l; }
+    if (173) { return ((v0 / (g0 * g0 + 1)) - (9 * la0[9])); }
+    j0 = 0;
+    while (j0 < 16) {
+        g0 = g0 + 4;
+        j0 = j0 + 1;
+    }
+    v0 = v0 + (v1 || 9l);
+    f0((2 != v0), 2, (65535 >= 192));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,636 @@
+	.section .data
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.short 3
+	.section .bss
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.zero 2
+	.type g2, @object
+	.size g2, 8
+	.p2align 3
+g2:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.global main
+	.type main, @function
+	.type f0, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $288, %rsp
+	movb $89, -1(%rbp)
+	movabsq $105891875685, %rax
+	movq %rax, -16(%rbp)
+	movl $746, -20(%rbp)
+	movq $7, -32(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movl -20(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -112(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -20(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movl -20(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L4
+.L5:
+	movl $0, -20(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L6
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movslq -20(%rbp), %rax
+	movq %rax, -192(%rbp)
+	imulq $9, %rax, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movq %rax, -200(%rbp)
+	imulq $9, %rax, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movq %rax, -208(%rbp)
+	imulq $9, %rax, %rax
+	movq %rax, %rcx
+	movq -208(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movq %rax, -216(%rbp)
+	imulq $9, %rax, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -184(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $16, -20(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movslq -20(%rbp), %rax
+	movq %rax, -224(%rbp)
+	imulq $9, %rax, %rax
+	movq %rax, %rcx
+	movq -224(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L10
+.L11:
+	movl $173, %eax
+	testl %eax, %eax
+	jne .LB0
+.L12:
+.L13:
+	movq $0, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jge .L14
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $16, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L17
+	.p2align 4,,10
+.L16:
+	movswl g0(%rip), %eax
+	addl $4, %eax
+	movw %ax, g0(%rip)
+	addq $1, -32(%rbp)
+	movswl g0(%rip), %eax
+	addl $4, %eax
+	movw %ax, g0(%rip)
+	addq $1, -32(%rbp)
+	movswl g0(%rip), %eax
+	addl $4, %eax
+	movw %ax, g0(%rip)
+	addq $1, -32(%rbp)
+	movswl g0(%rip), %eax
+	addl $4, %eax
+	movw %ax, g0(%rip)
+	addq $1, -32(%rbp)
+	subq $1, -232(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpq $16, -32(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movswl g0(%rip), %eax
+	addl $4, %eax
+	movw %ax, g0(%rip)
+	addq $1, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jl .L18
+.L19:
+	cmpq $0, -16(%rbp)
+	jne .L20
+	movl $9, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L21
+.L20:
+	movl $1, %eax
+.L21:
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -1(%rbp)
+	movzbl -1(%rbp), %eax
+	cmpl $2, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movq $0, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movswq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movzwl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq g2(%rip), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movzbl -1(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -240(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -244(%rbp)
+	testl %eax, %eax
+	je .L22
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L25
+	.p2align 4,,10
+.L24:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -256(%rbp)
+	jne .L24
+.L25:
+.L22:
+.L23:
+	cmpl $33, -20(%rbp)
+	jge .L27
+	.p2align 4,,10
+.L26:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L26
+.L27:
+	movl $0, -20(%rbp)
+	cmpl $0, -244(%rbp)
+	je .L28
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L31
+	.p2align 4,,10
+.L30:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -264(%rbp)
+	jne .L30
+.L31:
+.L28:
+.L29:
+	cmpl $33, -20(%rbp)
+	jge .L33
+	.p2align 4,,10
+.L32:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L32
+.L33:
+	movl $0, -20(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L34
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -272(%rbp)
+	cmpq $0, -272(%rbp)
+	je .L37
+	.p2align 4,,10
+.L36:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -272(%rbp)
+	jne .L36
+.L37:
+.L34:
+.L35:
+	cmpl $16, -20(%rbp)
+	jge .L39
+	.p2align 4,,10
+.L38:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L38
+.L39:
+	movl $0, -20(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L40
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L43
+	.p2align 4,,10
+.L42:
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -280(%rbp)
+	jne .L42
+.L43:
+.L40:
+.L41:
+	cmpl $16, -20(%rbp)
+	jge .L45
+	.p2align 4,,10
+.L44:
+	movslq -20(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L44
+.L45:
+	movq -240(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -240(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -240(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	movq -240(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB0:
+	movl -60(%rbp), %eax
+	imull $9, %eax, %eax
+	pushq %rax
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	subl %ecx, %eax
+	jmp .main_return
+	.size main, .-main
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	movabsq $332706488212, %rax
+	movl $8, -4(%rbp)
+	movabsq $807753144021, %rax
+	movswq g0(%rip), %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	cmpl $0, -4(%rbp)
+	je .L48
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L49
+.L48:
+	movl $0, %eax
+.L49:
+	cmpl $1000000007, %eax
+	jne .L46
+	cmpw $0, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	jmp .L47
+.L46:
+	movl $1, %eax
+.L47:
+	movl $-125, %eax
+	popq %rbp
+	ret
+	.size f0, .-f0
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,111 @@
+int ga0[8];
+int ga1[8];
+int main() {
+    unsigned char v0 = 120;
+    long v1 = 445;
+    int i0 = 4l;
+    long j0 = 3;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 183; }
+    v1 = !(j0);
+    for (j0 = 0; j0 < 3; j0 = j0 + 1) {
+        switch ((v1 / (j0 * j0 + 1))) {
+        case 47:
+            break;
+        case 185:
+            if (((short)(ga0[6]) + v0)) { return (j0 - (j0 > 7u)); }
+            if ((127 <= (9 >= 191038187111))) { return ga0[1]; }
+        case 522:
+            i0 = 10;
+        default:
+            break;
+        case 31:
+            if (v1) { return ((long)(v1) >= (847714672264 / (v1 * v1 + 1))); }
+        case 186:
+            i0 = i0 + (j0 / 8);
+        }
+        v1 = (366 == (!(v0) < (v1 - 0L)));
+        switch (8) {
+        case 281:
+            break;
+        case 246:
+            i0 = (short)(i0);
+            break;
+        case 44:
+            switch (((v1 > 3) <= (v1 != i0))) {
+            case 7:
+                v0 = (short)(j0);
+                if (107) { break; }
+            default:
+                if (((v0 / 16) / (i0 * i0 + 1))) { break; }
+                if (v1) { break; }
+            }
+            i0 = (i0 && (i0 - v1));
+            break;
+        default:
+            la0[j0] = (-(8) != 3);
+            break;
+        }
+    }
+    i0 = 0;
+    while (i0 < 33) {
+        if (i0 >= 0 && i0 < 8) { ga1[i0] = i0; }
+        i0 = i0 + 1;
+    }
+    i0 = (((unsigned long)(627u) < (i0 && la0[7])) && ((la0[0] + ga1[2]) || v0));
+    switch (260679521114) {
+    case 497:
+        break;
+    case 353:
+        if (j0 >= 0 && j0 < 8) { ga0[j0] = ((int)(la0[1]) < (i0 <= ga0[5])); }
+        break;
+    default:
+        if (-(ga0[3])) {
+            for (i0 = 0; i0 < 33; i0 = i0 + 1) {
+                v0 = ((unsigned short)((i0 - j0)) - (ga0[0] <= i0));
+                if (i0) { return !((43 / 8)); }
+            }
+            switch (((int)(i0) / (v0 * v0 + 1))) {
+            case 505:
+                break;
+            default:
+                if (836) { return 139; }
+                break;
+            case 1:
+                if (((ga0[3] != 65535) || !(119))) { return v0; }
+                break;
+            case -5:
+                if (j0 >= 0 && j0 < 8) { la0[j0] = !(i0); }
+                break;
+            case 161:
+                break;
+            }
+        } else {
+            if ((unsigned long)(la0[7])) {
+                i0 = i0 + ((10 && j0) > (4 * 640));
+                if (((4u || i0) / (i0 * i0 + 1))) { return (unsigned short)(0l); }
+            } else {
+                v0 = ((2 < 2) || !(j0));
+                if ((unsigned int)(j0)) { return v1; }
+                j0 = (((v0 / 3u) / 5l) == ((i0 > v1) / 16));
+            }
+            if ((v0 / 4)) { return ((0 - 32767l) || (la0[5] - j0)); }
+            j0 = j0 + (v1 - (v1 / (j0 * j0 + 1)));
+        }
+        i0 = (((506 * j0) - (short)(v1)) * (unsigned short)(4));
+        break;
+    }
+    for (i0 = 2; i0 < 5; i0 = i0 + 1) {
+        if ((int)((i0 >= ga1[5]))) { return v0; }
+    }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
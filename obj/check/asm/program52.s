@@ -0,0 +1,889 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 32
+	.p2align 5
+ga1:
+	.zero 32
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movb $120, -1(%rbp)
+	movq $445, -16(%rbp)
+	movl $4, -20(%rbp)
+	movq $3, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -64(%rbp)
+	movl $183, -60(%rbp)
+	movl $366, -56(%rbp)
+	movl $549, -52(%rbp)
+	movl $732, -48(%rbp)
+	movl $915, -44(%rbp)
+	movl $1098, -40(%rbp)
+	movl $1281, -36(%rbp)
+	movl $8, -20(%rbp)
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq $0, -32(%rbp)
+	movl $0, -68(%rbp)
+	movl $1, -72(%rbp)
+	cmpq $3, -32(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	cmpq $185, %rax
+	jge .L9
+	cmpq $31, %rax
+	je .L7
+	cmpq $47, %rax
+	je .L2
+	jmp .L6
+.L9:
+	cmpq $185, %rax
+	je .L4
+	cmpq $186, %rax
+	je .L8
+	cmpq $522, %rax
+	je .L5
+	jmp .L6
+.L4:
+	movl ga0+24(%rip), %eax
+	movswl %ax, %eax
+	movzbl -1(%rbp), %ecx
+	addl %ecx, %eax
+	jne .LB0
+.L10:
+.L11:
+	cmpl $0, -68(%rbp)
+	jne .LB1
+.L12:
+.L13:
+.L5:
+	movl $10, -20(%rbp)
+.L6:
+.L2:
+	cmpb $0, -1(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -16(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	cmpl $366, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl $8, %eax
+	movslq %eax, %rax
+	cmpq $44, %rax
+	je .L19
+	cmpq $246, %rax
+	je .L18
+	cmpq $281, %rax
+	je .L16
+.L20:
+	movq -32(%rbp), %rax
+	movl -72(%rbp), %ecx
+	movl %ecx, -64(%rbp,%rax,4)
+	jmp .L16
+.L19:
+	movslq -20(%rbp), %rax
+	movq %rax, -80(%rbp)
+	cmpq %rax, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $3, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $7, %rax
+	je .L22
+.L23:
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movzbl -1(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L24
+	jmp .L21
+.L7:
+	cmpq $0, -16(%rbp)
+	jne .LB2
+.L14:
+.L15:
+.L8:
+	movq -32(%rbp), %rax
+	leaq 7(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $3, %rcx
+	movq %rcx, %rax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -20(%rbp)
+	jmp .L2
+.L22:
+	movq -32(%rbp), %rax
+	movb %al, -1(%rbp)
+.L26:
+.L27:
+.L21:
+	cmpl $0, -20(%rbp)
+	je .L28
+	movq -80(%rbp), %rax
+	subq -16(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L29
+.L28:
+	movl $0, %eax
+.L29:
+	movl %eax, -20(%rbp)
+.L16:
+	addq $1, -32(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L0
+.L1:
+	movl $0, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -84(%rbp)
+	testl %eax, %eax
+	je .L30
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -96(%rbp)
+	cmpq $0, -96(%rbp)
+	je .L33
+	.p2align 4,,10
+.L32:
+	cmpl $0, -20(%rbp)
+	jl .L34
+	cmpl $8, -20(%rbp)
+	jge .L34
+	movslq -20(%rbp), %rax
+	movl -20(%rbp), %ecx
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L34:
+.L35:
+	addl $1, -20(%rbp)
+	cmpl $0, -20(%rbp)
+	jl .L36
+	cmpl $8, -20(%rbp)
+	jge .L36
+	movslq -20(%rbp), %rax
+	movl -20(%rbp), %ecx
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L36:
+.L37:
+	addl $1, -20(%rbp)
+	subq $1, -96(%rbp)
+	jne .L32
+.L33:
+.L30:
+.L31:
+	cmpl $33, -20(%rbp)
+	jge .L39
+	.p2align 4,,10
+.L38:
+	cmpl $0, -20(%rbp)
+	jl .L40
+	cmpl $8, -20(%rbp)
+	jge .L40
+	movslq -20(%rbp), %rax
+	movl -20(%rbp), %ecx
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L40:
+.L41:
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L38
+.L39:
+	cmpl $0, -20(%rbp)
+	je .L44
+	movl -36(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L45
+.L18:
+	movl -20(%rbp), %eax
+	movswl %ax, %eax
+	movl %eax, -20(%rbp)
+	jmp .L16
+.L3:
+	jmp .L2
+.L44:
+	movl $0, %eax
+.L45:
+	movslq %eax, %rax
+	cmpq $627, %rax
+	jbe .L42
+	movl -64(%rbp), %eax
+	movl ga1+8(%rip), %ecx
+	addl %ecx, %eax
+	jne .L46
+	cmpb $0, -1(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L43
+.L17:
+	jmp .L16
+.L24:
+.L25:
+	cmpq $0, -16(%rbp)
+	je .L26
+	jmp .L21
+.LB0:
+	cmpq $7, -32(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	subq %rcx, %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L46:
+	movl $1, %eax
+.L47:
+	jmp .L43
+.L49:
+	jmp .L48
+.L74:
+	cmpq $161, %rax
+	je .L55
+	cmpq $505, %rax
+	je .L55
+	jmp .L70
+.L73:
+	jmp .L55
+.L72:
+	cmpq $0, -32(%rbp)
+	jl .L55
+	cmpq $8, -32(%rbp)
+	jge .L55
+	cmpl $0, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+.L78:
+.L79:
+.L68:
+	jmp .L55
+.L80:
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	movq -32(%rbp), %rax
+	testl %eax, %eax
+	jne .LB3
+.L84:
+.L85:
+	movslq -20(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzbl -1(%rbp), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+.L81:
+	movzbl -1(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .LB4
+.L86:
+.L87:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	subq %rcx, %rax
+	addq %rax, -32(%rbp)
+.L55:
+	movq -16(%rbp), %rax
+	movswq %ax, %rax
+	movq %rax, %rcx
+	imulq $506, -32(%rbp), %rax
+	subq %rcx, %rax
+	salq $2, %rax
+	movl %eax, -20(%rbp)
+	jmp .L48
+.L69:
+	jmp .L55
+.L71:
+	movl ga0+12(%rip), %eax
+	cmpl $65535, %eax
+	jne .L77
+	xorl %eax, %eax
+	jne .L77
+.L75:
+.L76:
+	jmp .L55
+.L54:
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L80
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cmpl $2560, %eax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -20(%rbp)
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .LB5
+.L82:
+.L83:
+	jmp .L81
+.L42:
+	movl $0, %eax
+.L43:
+	movl %eax, -20(%rbp)
+	movabsq $260679521114, %rax
+	cmpq $353, %rax
+	je .L50
+	cmpq $497, %rax
+	je .L48
+.L51:
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	je .L54
+	movl $0, -20(%rbp)
+	movl $5, -100(%rbp)
+	cmpl $0, -84(%rbp)
+	je .L56
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L59
+	.p2align 4,,10
+.L58:
+	movl ga0+0(%rip), %eax
+	cmpl -20(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	subq -32(%rbp), %rax
+	movzwl %ax, %eax
+	subl %ecx, %eax
+	movb %al, -1(%rbp)
+	cmpl $0, -20(%rbp)
+	jne .LB6
+.L60:
+.L61:
+	addl $1, -20(%rbp)
+	movl ga0+0(%rip), %eax
+	cmpl -20(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	subq -32(%rbp), %rax
+	movzwl %ax, %eax
+	subl %ecx, %eax
+	movb %al, -1(%rbp)
+	cmpl $0, -20(%rbp)
+	jne .LB7
+.L62:
+.L63:
+	addl $1, -20(%rbp)
+	subq $1, -112(%rbp)
+	jne .L58
+.L59:
+.L56:
+.L57:
+	cmpl $33, -20(%rbp)
+	jge .L65
+	.p2align 4,,10
+.L64:
+	movl ga0+0(%rip), %eax
+	cmpl -20(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	subq -32(%rbp), %rax
+	movzwl %ax, %eax
+	subl %ecx, %eax
+	movb %al, -1(%rbp)
+	cmpl $0, -20(%rbp)
+	jne .LB8
+.L66:
+.L67:
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L64
+.L65:
+	movzbl -1(%rbp), %eax
+	movl %eax, -116(%rbp)
+	imull -116(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $161, %rax
+	jge .L74
+	cmpq $-5, %rax
+	je .L72
+	cmpq $1, %rax
+	je .L71
+.L70:
+	movl $139, %eax
+	jmp .main_return
+.L50:
+	cmpq $0, -32(%rbp)
+	jl .L52
+	cmpq $8, -32(%rbp)
+	jge .L52
+	movl ga0+20(%rip), %eax
+	cmpl %eax, -20(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L52:
+.L53:
+.L48:
+	movl $2, -20(%rbp)
+	movl ga1+20(%rip), %eax
+	cmpl $2, %eax
+	jle .LB9
+.L88:
+.L89:
+	movl ga1+20(%rip), %eax
+	cmpl $3, %eax
+	jle .LB10
+.L90:
+.L91:
+	movl ga1+20(%rip), %eax
+	cmpl $4, %eax
+	jle .LB11
+.L92:
+.L93:
+	movl $5, -20(%rbp)
+	movq $0, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movzbl -1(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	testl %eax, %eax
+	je .L94
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L97
+	.p2align 4,,10
+.L96:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -144(%rbp)
+	jne .L96
+.L97:
+.L94:
+.L95:
+	cmpl $8, -20(%rbp)
+	jge .L99
+	.p2align 4,,10
+.L98:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L98
+.L99:
+	movl $0, -20(%rbp)
+	cmpl $0, -132(%rbp)
+	je .L100
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L103
+	.p2align 4,,10
+.L102:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -152(%rbp)
+	jne .L102
+.L103:
+.L100:
+.L101:
+	cmpl $8, -20(%rbp)
+	jge .L105
+	.p2align 4,,10
+.L104:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L104
+.L105:
+	movl $0, -20(%rbp)
+	cmpl $0, -132(%rbp)
+	je .L106
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L109
+	.p2align 4,,10
+.L108:
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -160(%rbp)
+	jne .L108
+.L109:
+.L106:
+.L107:
+	cmpl $8, -20(%rbp)
+	jge .L111
+	.p2align 4,,10
+.L110:
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L110
+.L111:
+	movq -128(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -128(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -128(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movq -128(%rbp), %rax
+	jmp .main_return
+.LB2:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movabsq $847714672264, %rax
+	cqo
+	idivq %rcx
+	cmpq %rax, -16(%rbp)
+	setge %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB1:
+	movl ga0+4(%rip), %eax
+	jmp .main_return
+.LB9:
+	movzbl -1(%rbp), %eax
+	jmp .main_return
+.LB8:
+	cmpl $0, -100(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB10:
+	movzbl -1(%rbp), %eax
+	jmp .main_return
+.LB11:
+	movzbl -1(%rbp), %eax
+	jmp .main_return
+.LB6:
+	cmpl $0, -100(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB7:
+	cmpl $0, -100(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB4:
+	movl $1, %eax
+	jmp .main_return
+.LB5:
+	movl $0, %eax
+	jmp .main_return
+.LB3:
+	movq -16(%rbp), %rax
+	jmp .main_return
+.L77:
+	movl -116(%rbp), %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,268 @@
+unsigned char g0 = 285;
+int ga0[8];
+unsigned long f0(unsigned short p0) {
+    unsigned int v0 = 893644108398;
+    short v1 = 2;
+    int i0 = 52;
+    long j0 = 609;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 3; }
+    if ((!(g0) <= p0)) {
+        p0 = ((v0 < (v0 >= la0[0])) != ((i0 + 511) && v1));
+        v0 = 0;
+        while (v0 < 5) {
+            j0 = j0;
+            switch ((2147483647 != 2147483647)) {
+            case 57:
+                p0 = !((unsigned long)(j0));
+                p0 = ((long)((906 > v0)) > ((char)(1) - i0));
+                break;
+            case -1:
+                if (10) { break; }
+                if (2147483647) { break; }
+            case 14:
+                v1 = v1 + ((ga0[0] >= v1) >= (i0 != 9));
+                p0 = 694;
+                break;
+            case -5:
+                p0 = 958338605742;
+                break;
+            case 5:
+                i0 = (5 / 8);
+                if (v1) { break; }
+                break;
+            case -4:
+                break;
+            default:
+            case 38:
+                if (j0) { break; }
+                break;
+            }
+            v0 = v0 + 1;
+        }
+        v0 = ga0[4];
+    } else {
+        p0 = i0;
+        la0[7] = (9 > 0);
+        if (i0) { return ga0[4]; }
+    }
+    for (v0 = 1; v0 < 5; v0 = v0 + 1) {
+        if (((41718241263 * 447) < j0)) {
+            if ((-(3) + 8)) {
+                i0 = ((ga0[4] >= 8) == (-(921) || j0));
+                i0 = (j0 || !(5ul));
+            }
+            i0 = 0;
+            while (i0 < 5) {
+                j0 = j0 + ((j0 < 473) == j0);
+                j0 = ((long)(v1) < (!(454) / 8));
+                i0 = i0 + 1;
+            }
+        }
+        if ((la0[6] / 8)) { return -(2); }
+        la0[2] = 1u;
+    }
+    p0 = 4;
+    if ((6 + 8)) {
+        la0[1] = (char)(198);
+        v1 = ((p0 - (p0 < i0)) - i0);
+    }
+    return (long)(((unsigned short)(ga0[6]) - (65536 + j0)));
+}
+int f1(long p0, unsigned long p1, unsigned short p2, unsigned long p3, char p4, unsigned long p5) {
+    char v0 = 6;
+    unsigned int v1 = 7;
+    unsigned long v2 = 138;
+    int i0 = 61L;
+    long j0 = 9;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 8; }
+    f0(!(p5));
+    switch (p3) {
+    case 9:
+    case 1:
+        break;
+    case 8:
+    case 5:
+        p4 = (-((p2 - p1)) - v2);
+        break;
+    case 4:
+        f0(p1);
+        break;
+    default:
+        for (v1 = 1; v1 < 4; v1 = v1 + 1) {
+            if ((char)((v0 == (p0 || 7)))) {
+                v2 = !((v1 / 16));
+                v2 = 65536;
+                if (ga0[2]) { break; }
+            } else {
+                p2 = ((short)((v2 != p2)) || f0(g0));
+                if ((char)((p2 || 9l))) { break; }
+            }
+            if (((p3 * v2) == -(p4))) { break; }
+        }
+        p5 = f0((unsigned short)(461));
+    case 2:
+        f0(128ul);
+        if (((f0(412) > 567) == 1)) {
+            for (j0 = 1; j0 < 4; j0 = j0 + 1) {
+                if (((i0 != 216686192337) <= (ga0[4] == 255))) { break; }
+                p5 = p4;
+            }
+        }
+    }
+    p4 = 94;
+    j0 = p3;
+    v1 = -(f0(6u));
+    i0 = v2;
+    if (p4 >= 0 && p4 < 8) { la0[p4] = (la0[7] && 354134748084); }
+    la0[4] = ga0[0];
+    return (!(4) || !((0 * ga0[7])));
+}
+unsigned char f2(unsigned short p0, unsigned char p1, unsigned char p2, char p3, char p4) {
+    char v0 = 0;
+    unsigned long v1 = 731539394239;
+    unsigned short v2 = 149522411510;
+    int i0 = 6;
+    long j0 = 956;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 5; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 10; }
+    v2 = v2 + (f1(j0, p3, i0, v0, v2, j0) / (p1 * p1 + 1));
+    v1 = v1 + (!(i0) == 1000000007);
+    if (((f1(v0, i0, j0, 727, j0, 379966576337) != (v1 != j0)) / 1024)) {
+        if ((4294967295 > ((540 > v1) / (v2 * v2 + 1)))) {
+            for (j0 = 0; j0 < 4; j0 = j0 + 1) {
+                f1((la1[28] * v2), (155 + v2), 9, f1(g0, i0, 10, 1000000007U, la1[3], v1), (8 || ga0[3]), (1 - 506));
+            }
+            p1 = p1 + (42 <= p0);
+            j0 = ((unsigned short)((4 > p0)) && (-(g0) != (v0 * la1[24])));
+        }
+    } else {
+        v1 = 0;
+        while (v1 < 3) {
+            for (i0 = 2; i0 < 4; i0 = i0 + 1) {
+                if (6) { break; }
+                p1 = p1 + 373624355555;
+                if (p1) { break; }
+            }
+            switch ((f1(v1, 6, 489, ga0[2], 128, 10) / (g0 * g0 + 1))) {
+            case 10:
+                if ((long)((j0 - p2))) { break; }
+                break;
+            case 6:
+                p0 = (32767 >= ((6 / (p0 * p0 + 1)) / 3u));
+                break;
+            case 7:
+                la1[v1] = (!(p0) - (ga0[0] / (v2 * v2 + 1)));
+                break;
+            default:
+                break;
+            case 1:
+                if ((g0 / 100)) { break; }
+                break;
+            case 9:
+                p3 = g0;
+            }
+            v1 = v1 + 1;
+        }
+    }
+    if ((p0 >= (la1[17] > p4))) { return (7 <= 8); }
+    if (g0) { return ((v0 / (g0 * g0 + 1)) == (p4 - 616)); }
+    for (j0 = 2; j0 < 5; j0 = j0 + 1) {
+        p1 = p1 + v2;
+    }
+    if (8) { return v1; }
+    f1((long)(v0), !(990587187108), 0, -(1), !(j0), f1(p3, la0[1], 10, g0, p2, 335));
+    return -(((v1 * 811) - g0));
+}
+unsigned short f3(unsigned short p0, unsigned char p1, unsigned int p2, unsigned char p3, short p4, char p5, int p6, short p7) {
+    unsigned long v0 = 99;
+    unsigned short v1 = 1;
+    short v2 = 8;
+    int i0 = 1;
+    long j0 = 128;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 8; }
+    f2((v1 > g0), (980u / 10), 1, p1, p6);
+    if (706) {
+        i0 = ((-(705U) > f2(ga0[6], 2147483647, p7, p2, la0[13])) + p6);
+        v0 = v0 + p2;
+        f2((p2 / 7), (p7 / (p1 * p1 + 1)), (la0[4] || 589), (96 + p5), f1(5, 26, 2, 0, ga0[6], p2));
+    }
+    if (((p2 + (i0 || v2)) / 7)) {
+        v2 = la0[17];
+        f1(p6, -(3), 1, (ga0[1] + j0), (int)(p4), (8 > 9));
+        p1 = p1 + ((i0 && g0) + 127);
+    }
+    p0 = p0 + ((v0 == j0) == p6);
+    p1 = v0;
+    for (p2 = 0; p2 < 33; p2 = p2 + 1) {
+        if (((v0 <= -(p4)) + g0)) {
+            if ((short)(p4)) { break; }
+            v2 = 0;
+            while (v2 < 3) {
+                i0 = i0 + (short)(953);
+                v2 = v2 + 1;
+            }
+            v0 = v0 + ((p5 < 889603327692) > (v2 + 5));
+        } else {
+            la0[4] = ((unsigned int)(ga0[4]) < i0);
+        }
+    }
+    return f2(f1(i0, 1, 3, p2, p6, 1), (7 + 7), j0, (4 <= p7), (p4 / (p4 * p4 + 1)));
+}
+void w3(unsigned int q0, unsigned int q1, long q2) {
+    g0 = g0 * 3 + q1;
+    ga0[3] = ga0[0] + q0;
+    ga0[3] = ga0[1] + q2;
+}
+long rec(long n, long acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 1, acc * 3 + n);
+}
+int main() {
+    int v0 = 434l;
+    int v1 = 6;
+    char v2 = 784L;
+    int v3 = 32767;
+    int i0 = 3l;
+    long j0 = 6;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 330u; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 9; }
+    la1[2] = (v1 > -(438177356386));
+    i0 = 0;
+    while (i0 < 33) {
+        g0 = v0;
+        g0 = (((2 / (v2 * v2 + 1)) || (char)(i0)) + f2(ga0[2], j0, 937, 6, 65536l));
+        j0 = v0;
+        i0 = i0 + 1;
+    }
+    if ((j0 == 774107212655)) {
+        v1 = 0;
+        while (v1 < 17) {
+            f2((v3 || i0), (7 - v3), (i0 >= 2), (v3 + 687), (0 - 768757263106L));
+            if (g0 >= 0 && g0 < 8) { ga0[g0] = (5 > v3); }
+            v1 = v1 + 1;
+        }
+    } else {
+        v0 = ((6 == f2(24410413582, v3, 985, la1[1], 355)) && v3);
+    }
+    v0 = v0 + f3(ga0[0], 308, 259, 273, 450, i0, 4, 7);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2600 @@
+	.section .data
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.byte 29
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.section .text
+	.type f0, @function
+	.type f1, @function
+	.type f1.constprop.1, @function
+	.type f1.constprop.2, @function
+	.type f1.constprop.0, @function
+	.type f2, @function
+	.type f3, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	movl $290910830, -56(%rbp)
+	movw $2, -58(%rbp)
+	movq $609, -32(%rbp)
+	movl $0, -8(%rbp)
+	movl $18, -48(%rbp)
+	movl $8, -52(%rbp)
+	cmpb $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movzwl %di, %ecx
+	cmpl %ecx, %eax
+	jg .L0
+	movl -52(%rbp), %eax
+	addl $511, %eax
+	je .L2
+	cmpw $0, -58(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L3
+.L2:
+	movl $0, %eax
+.L3:
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	cmpl %eax, -56(%rbp)
+	setae %al
+	movzbl %al, %eax
+	cmpl %eax, -56(%rbp)
+	setb %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movl $0, -56(%rbp)
+	movl $0, -36(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $5, -56(%rbp)
+	jae .L5
+	.p2align 4,,10
+.L4:
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	jge .L14
+	cmpq $-5, %rax
+	je .L10
+	cmpq $-4, %rax
+	je .L6
+	cmpq $-1, %rax
+	je .L6
+.L13:
+	cmpq $0, -32(%rbp)
+	je .L6
+	jmp .L6
+.L14:
+	cmpq $38, %rax
+	jge .L15
+	cmpq $5, %rax
+	je .L11
+	cmpq $14, %rax
+	je .L9
+	jmp .L13
+.L10:
+.L6:
+	addl $1, -56(%rbp)
+	cmpl $5, -56(%rbp)
+	jb .L4
+.L5:
+	movl ga0+16(%rip), %eax
+.L20:
+.L21:
+.L1:
+	movl $1, -56(%rbp)
+	movabsq $18648053844561, %rax
+	movq %rax, -24(%rbp)
+	movl $5, -44(%rbp)
+	movl $-921, -40(%rbp)
+	movl $-2, -36(%rbp)
+	cmpl $5, -56(%rbp)
+	jae .L23
+	.p2align 4,,10
+.L22:
+	movq -24(%rbp), %rax
+	cmpq -32(%rbp), %rax
+	jge .L24
+	cmpl $0, -44(%rbp)
+	je .L26
+	cmpl $0, -40(%rbp)
+	jne .L28
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L29
+.L28:
+	movl $1, %eax
+.L29:
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	cmpl $8, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpq $0, -32(%rbp)
+	jne .L30
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L31
+.L15:
+	cmpq $38, %rax
+	je .L13
+	cmpq $57, %rax
+	je .L7
+	jmp .L13
+.L18:
+.L19:
+	jmp .L6
+.L11:
+	movl -16(%rbp), %eax
+	movl %eax, -52(%rbp)
+	cmpw $0, -58(%rbp)
+	je .L6
+	jmp .L6
+.L12:
+	jmp .L6
+.L7:
+	movq -32(%rbp), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movl $1, %eax
+	subl -52(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpl $906, -56(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	jmp .L6
+.L8:
+	jmp .L6
+.L9:
+	movswl -58(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpl $9, -52(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	addl -8(%rbp), %eax
+	movw %ax, -58(%rbp)
+	jmp .L6
+.L16:
+.L17:
+	jmp .L6
+.LB0:
+	movslq -36(%rbp), %rax
+.f0_return:
+	popq %rbp
+	ret
+.L30:
+	movl $1, %eax
+.L31:
+.L26:
+.L27:
+	movl $0, -52(%rbp)
+	cmpl $5, -52(%rbp)
+	jge .L32
+	movl $5, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L35
+	.p2align 4,,10
+.L34:
+	cmpq $473, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	movswq -58(%rbp), %rax
+	testq %rax, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movq %rax, -32(%rbp)
+	addl $1, -52(%rbp)
+	cmpq $473, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	movq -8(%rbp), %rax
+	movq %rax, -32(%rbp)
+	addl $1, -52(%rbp)
+	subq $1, -16(%rbp)
+	jne .L34
+.L35:
+.L32:
+.L33:
+	cmpl $5, -52(%rbp)
+	jge .L37
+	.p2align 4,,10
+.L36:
+	cmpq $473, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	movswq -58(%rbp), %rax
+	testq %rax, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $5, -52(%rbp)
+	jl .L36
+.L37:
+.L24:
+.L25:
+	movl -48(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .LB0
+.L38:
+.L39:
+	addl $1, -56(%rbp)
+	cmpl $5, -56(%rbp)
+	jb .L22
+.L23:
+	movw $4, -8(%rbp)
+	movzwl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl -52(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	subl %ecx, %eax
+	subl -52(%rbp), %eax
+	movq -32(%rbp), %rax
+	addq $65536, %rax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	movzwl %ax, %eax
+	subq %rcx, %rax
+	jmp .f0_return
+.L0:
+	movl -52(%rbp), %eax
+	cmpl $0, -52(%rbp)
+	je .L20
+	movl ga0+16(%rip), %eax
+	movslq %eax, %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movq %rcx, -32(%rbp)
+	movb %r8b, -33(%rbp)
+	movq %r9, -48(%rbp)
+	movb $6, -49(%rbp)
+	movl $7, -56(%rbp)
+	movq $138, -64(%rbp)
+	movl $61, -68(%rbp)
+	movq $9, -80(%rbp)
+	movl $0, -68(%rbp)
+	movl $0, -112(%rbp)
+	movl $8, -108(%rbp)
+	movl $16, -104(%rbp)
+	movl $24, -100(%rbp)
+	movl $32, -96(%rbp)
+	movl $40, -92(%rbp)
+	movl $48, -88(%rbp)
+	movl $56, -84(%rbp)
+	movl $8, -68(%rbp)
+	cmpq $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movq -32(%rbp), %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L46
+	leaq .L47(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L44
+	# table target .L41
+	# table target .L45
+	# table target .L43
+	# table target .L42
+	jmp *%rcx
+.L46:
+.L44:
+	movl $1, -56(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .L48
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L49
+.L48:
+	movl $1, %eax
+.L49:
+	movq %rax, %rcx
+	movsbl -49(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -116(%rbp)
+	xorl %eax, %eax
+	movsbl -33(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -120(%rbp)
+	cmpl $4, -56(%rbp)
+	jae .L51
+	.p2align 4,,10
+.L50:
+	movl -116(%rbp), %eax
+	testb %al, %al
+	je .L52
+	movl -56(%rbp), %eax
+	shrl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	movq $65536, -64(%rbp)
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	je .L54
+.L51:
+	movl $461, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, -48(%rbp)
+.L45:
+	movl $128, %eax
+	movq %rax, %rdi
+	call f0
+	movl $412, %eax
+	movq %rax, %rdi
+	call f0
+	cmpq $567, %rax
+	seta %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	jne .L64
+	movq $1, -80(%rbp)
+	movslq -68(%rbp), %rax
+	movabsq $216686192337, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -124(%rbp)
+	cmpq $4, -80(%rbp)
+	jge .L67
+	.p2align 4,,10
+.L66:
+	movl ga0+16(%rip), %eax
+	cmpl $255, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -124(%rbp)
+	jg .L68
+.L67:
+.L64:
+.L65:
+.L40:
+	movb $94, -33(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, -80(%rbp)
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -56(%rbp)
+	movq -64(%rbp), %rax
+	movl %eax, -68(%rbp)
+	movsbl -33(%rbp), %eax
+	movl %eax, -128(%rbp)
+	testl %eax, %eax
+	jl .L70
+	cmpl $8, -128(%rbp)
+	jge .L70
+	movl -84(%rbp), %eax
+	testl %eax, %eax
+	je .L72
+	movabsq $354134748084, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L73
+.L72:
+	movl $0, %eax
+.L73:
+	movq %rax, %rcx
+	movsbq -33(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L70:
+.L71:
+	movl ga0+0(%rip), %eax
+	movl %eax, -96(%rbp)
+	movl $1, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L68:
+.L69:
+	movsbq -33(%rbp), %rax
+	movq %rax, -48(%rbp)
+	addq $1, -80(%rbp)
+	cmpq $4, -80(%rbp)
+	jl .L66
+	jmp .L67
+.L52:
+	movzwl -18(%rbp), %eax
+	cmpq %rax, -64(%rbp)
+	setne %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	jne .L56
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L57
+.L56:
+	movl $1, %eax
+.L57:
+	movw %ax, -18(%rbp)
+	cmpw $0, -18(%rbp)
+	jne .L60
+	movl $9, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L61
+.L60:
+	movl $1, %eax
+.L61:
+	testb %al, %al
+	je .L58
+	jmp .L51
+.L54:
+.L55:
+.L58:
+.L59:
+.L53:
+	movq -32(%rbp), %rax
+	imulq -64(%rbp), %rax
+	movslq -120(%rbp), %rcx
+	cmpq %rcx, %rax
+	jne .L62
+	jmp .L51
+.L62:
+.L63:
+	addl $1, -56(%rbp)
+	cmpl $4, -56(%rbp)
+	jb .L50
+	jmp .L51
+.L41:
+	jmp .L40
+.L42:
+	movzwl -18(%rbp), %eax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	subq -64(%rbp), %rax
+	movb %al, -33(%rbp)
+	jmp .L40
+.L43:
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	jmp .L40
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L47:
+	.long .L41-.L47
+	.long .L45-.L47
+	.long .L44-.L47
+	.long .L43-.L47
+	.long .L42-.L47
+	.long .L44-.L47
+	.long .L44-.L47
+	.long .L42-.L47
+	.long .L41-.L47
+	.popsection
+	.align 16
+f1.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movb %cl, -19(%rbp)
+	movq %r8, -32(%rbp)
+	movb $6, -33(%rbp)
+	movl $7, -40(%rbp)
+	movq $138, -48(%rbp)
+	movl $61, -52(%rbp)
+	movq $9, -64(%rbp)
+	movl $0, -52(%rbp)
+	movl $0, -96(%rbp)
+	movl $8, -92(%rbp)
+	movl $16, -88(%rbp)
+	movl $24, -84(%rbp)
+	movl $32, -80(%rbp)
+	movl $40, -76(%rbp)
+	movl $48, -72(%rbp)
+	movl $56, -68(%rbp)
+	movl $8, -52(%rbp)
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movl $1000000007, %eax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L80
+	leaq .L81(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L78
+	# table target .L75
+	# table target .L79
+	# table target .L77
+	# table target .L76
+	jmp *%rcx
+.L80:
+.L78:
+	movl $1, -40(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .L82
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L83
+.L82:
+	movl $1, %eax
+.L83:
+	movq %rax, %rcx
+	movsbl -33(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	xorl %eax, %eax
+	movsbl -19(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -104(%rbp)
+	cmpl $4, -40(%rbp)
+	jae .L85
+	.p2align 4,,10
+.L84:
+	movl -100(%rbp), %eax
+	testb %al, %al
+	je .L86
+	movl -40(%rbp), %eax
+	shrl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movq $65536, -48(%rbp)
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	je .L88
+.L85:
+	movl $461, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, -32(%rbp)
+.L79:
+	movl $128, %eax
+	movq %rax, %rdi
+	call f0
+	movl $412, %eax
+	movq %rax, %rdi
+	call f0
+	cmpq $567, %rax
+	seta %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	jne .L98
+	movq $1, -64(%rbp)
+	movslq -52(%rbp), %rax
+	movabsq $216686192337, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -108(%rbp)
+	cmpq $4, -64(%rbp)
+	jge .L101
+	.p2align 4,,10
+.L100:
+	movl ga0+16(%rip), %eax
+	cmpl $255, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -108(%rbp)
+	jg .L102
+.L101:
+.L98:
+.L99:
+.L74:
+	movb $94, -19(%rbp)
+	movq $1000000007, -64(%rbp)
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -40(%rbp)
+	movq -48(%rbp), %rax
+	movl %eax, -52(%rbp)
+	movsbl -19(%rbp), %eax
+	movl %eax, -112(%rbp)
+	testl %eax, %eax
+	jl .L104
+	cmpl $8, -112(%rbp)
+	jge .L104
+	movl -68(%rbp), %eax
+	testl %eax, %eax
+	je .L106
+	movabsq $354134748084, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L106:
+	movl $0, %eax
+.L107:
+	movq %rax, %rcx
+	movsbq -19(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L104:
+.L105:
+	movl ga0+0(%rip), %eax
+	movl %eax, -80(%rbp)
+	movl $1, %eax
+.f1.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L102:
+.L103:
+	movsbq -19(%rbp), %rax
+	movq %rax, -32(%rbp)
+	addq $1, -64(%rbp)
+	cmpq $4, -64(%rbp)
+	jl .L100
+	jmp .L101
+.L86:
+	movzwl -18(%rbp), %eax
+	cmpq %rax, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	jne .L90
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L91
+.L90:
+	movl $1, %eax
+.L91:
+	movw %ax, -18(%rbp)
+	cmpw $0, -18(%rbp)
+	jne .L94
+	movl $9, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L95
+.L94:
+	movl $1, %eax
+.L95:
+	testb %al, %al
+	je .L92
+	jmp .L85
+.L88:
+.L89:
+.L92:
+.L93:
+.L87:
+	imulq $1000000007, -48(%rbp), %rax
+	movslq -104(%rbp), %rcx
+	cmpq %rcx, %rax
+	jne .L96
+	jmp .L85
+.L96:
+.L97:
+	addl $1, -40(%rbp)
+	cmpl $4, -40(%rbp)
+	jb .L84
+	jmp .L85
+.L75:
+	jmp .L74
+.L76:
+	movzwl -18(%rbp), %eax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	subq -48(%rbp), %rax
+	movb %al, -19(%rbp)
+	jmp .L74
+.L77:
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	jmp .L74
+	.size f1.constprop.1, .-f1.constprop.1
+	.pushsection .rodata
+	.p2align 2
+.L81:
+	.long .L75-.L81
+	.long .L79-.L81
+	.long .L78-.L81
+	.long .L77-.L81
+	.long .L76-.L81
+	.long .L78-.L81
+	.long .L78-.L81
+	.long .L76-.L81
+	.long .L75-.L81
+	.popsection
+	.align 16
+f1.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movq %rdi, -8(%rbp)
+	movw %si, -10(%rbp)
+	movq %rdx, -24(%rbp)
+	movb %cl, -25(%rbp)
+	movq %r8, -40(%rbp)
+	movb $6, -41(%rbp)
+	movl $7, -48(%rbp)
+	movq $138, -56(%rbp)
+	movl $61, -60(%rbp)
+	movq $9, -72(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -112(%rbp)
+	movl $8, -108(%rbp)
+	movl $16, -104(%rbp)
+	movl $24, -100(%rbp)
+	movl $32, -96(%rbp)
+	movl $40, -92(%rbp)
+	movl $48, -88(%rbp)
+	movl $56, -84(%rbp)
+	movl $8, -60(%rbp)
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movq -24(%rbp), %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L114
+	leaq .L115(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L112
+	# table target .L109
+	# table target .L113
+	# table target .L111
+	# table target .L110
+	jmp *%rcx
+.L114:
+.L112:
+	movl $1, -48(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .L116
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L117
+.L116:
+	movl $1, %eax
+.L117:
+	movq %rax, %rcx
+	movsbl -41(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -116(%rbp)
+	xorl %eax, %eax
+	movsbl -25(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -120(%rbp)
+	cmpl $4, -48(%rbp)
+	jae .L119
+	.p2align 4,,10
+.L118:
+	movl -116(%rbp), %eax
+	testb %al, %al
+	je .L120
+	movl -48(%rbp), %eax
+	shrl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	movq $65536, -56(%rbp)
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	je .L122
+.L119:
+	movl $461, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, -40(%rbp)
+.L113:
+	movl $128, %eax
+	movq %rax, %rdi
+	call f0
+	movl $412, %eax
+	movq %rax, %rdi
+	call f0
+	cmpq $567, %rax
+	seta %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	jne .L132
+	movq $1, -72(%rbp)
+	movslq -60(%rbp), %rax
+	movabsq $216686192337, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -124(%rbp)
+	cmpq $4, -72(%rbp)
+	jge .L135
+	.p2align 4,,10
+.L134:
+	movl ga0+16(%rip), %eax
+	cmpl $255, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -124(%rbp)
+	jg .L136
+.L135:
+.L132:
+.L133:
+.L108:
+	movb $94, -25(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -72(%rbp)
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -48(%rbp)
+	movq -56(%rbp), %rax
+	movl %eax, -60(%rbp)
+	movsbl -25(%rbp), %eax
+	movl %eax, -128(%rbp)
+	testl %eax, %eax
+	jl .L138
+	cmpl $8, -128(%rbp)
+	jge .L138
+	movl -84(%rbp), %eax
+	testl %eax, %eax
+	je .L140
+	movabsq $354134748084, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L141
+.L140:
+	movl $0, %eax
+.L141:
+	movq %rax, %rcx
+	movsbq -25(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L138:
+.L139:
+	movl ga0+0(%rip), %eax
+	movl %eax, -96(%rbp)
+	movl $1, %eax
+.f1.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L136:
+.L137:
+	movsbq -25(%rbp), %rax
+	movq %rax, -40(%rbp)
+	addq $1, -72(%rbp)
+	cmpq $4, -72(%rbp)
+	jl .L134
+	jmp .L135
+.L120:
+	movzwl -10(%rbp), %eax
+	cmpq %rax, -56(%rbp)
+	setne %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	jne .L124
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L125
+.L124:
+	movl $1, %eax
+.L125:
+	movw %ax, -10(%rbp)
+	cmpw $0, -10(%rbp)
+	jne .L128
+	movl $9, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L129
+.L128:
+	movl $1, %eax
+.L129:
+	testb %al, %al
+	je .L126
+	jmp .L119
+.L122:
+.L123:
+.L126:
+.L127:
+.L121:
+	movq -24(%rbp), %rax
+	imulq -56(%rbp), %rax
+	movslq -120(%rbp), %rcx
+	cmpq %rcx, %rax
+	jne .L130
+	jmp .L119
+.L130:
+.L131:
+	addl $1, -48(%rbp)
+	cmpl $4, -48(%rbp)
+	jb .L118
+	jmp .L119
+.L109:
+	jmp .L108
+.L110:
+	movzwl -10(%rbp), %eax
+	subq $6, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	subq -56(%rbp), %rax
+	movb %al, -25(%rbp)
+	jmp .L108
+.L111:
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L108
+	.size f1.constprop.2, .-f1.constprop.2
+	.pushsection .rodata
+	.p2align 2
+.L115:
+	.long .L109-.L115
+	.long .L113-.L115
+	.long .L112-.L115
+	.long .L111-.L115
+	.long .L110-.L115
+	.long .L112-.L115
+	.long .L112-.L115
+	.long .L110-.L115
+	.long .L109-.L115
+	.popsection
+	.align 16
+f1.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movb %cl, -19(%rbp)
+	movq %r8, -32(%rbp)
+	movb $6, -33(%rbp)
+	movl $7, -40(%rbp)
+	movq $138, -48(%rbp)
+	movl $61, -52(%rbp)
+	movq $9, -64(%rbp)
+	movl $0, -52(%rbp)
+	movl $0, -96(%rbp)
+	movl $8, -92(%rbp)
+	movl $16, -88(%rbp)
+	movl $24, -84(%rbp)
+	movl $32, -80(%rbp)
+	movl $40, -76(%rbp)
+	movl $48, -72(%rbp)
+	movl $56, -68(%rbp)
+	movl $8, -52(%rbp)
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movl $727, %eax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L148
+	leaq .L149(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L146
+	# table target .L143
+	# table target .L147
+	# table target .L145
+	# table target .L144
+	jmp *%rcx
+.L148:
+.L146:
+	movl $1, -40(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .L150
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L151
+.L150:
+	movl $1, %eax
+.L151:
+	movq %rax, %rcx
+	movsbl -33(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	xorl %eax, %eax
+	movsbl -19(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -104(%rbp)
+	cmpl $4, -40(%rbp)
+	jae .L153
+	.p2align 4,,10
+.L152:
+	movl -100(%rbp), %eax
+	testb %al, %al
+	je .L154
+	movl -40(%rbp), %eax
+	shrl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movq $65536, -48(%rbp)
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	je .L156
+.L153:
+	movl $461, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, -32(%rbp)
+.L147:
+	movl $128, %eax
+	movq %rax, %rdi
+	call f0
+	movl $412, %eax
+	movq %rax, %rdi
+	call f0
+	cmpq $567, %rax
+	seta %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	jne .L166
+	movq $1, -64(%rbp)
+	movslq -52(%rbp), %rax
+	movabsq $216686192337, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -108(%rbp)
+	cmpq $4, -64(%rbp)
+	jge .L169
+	.p2align 4,,10
+.L168:
+	movl ga0+16(%rip), %eax
+	cmpl $255, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -108(%rbp)
+	jg .L170
+.L169:
+.L166:
+.L167:
+.L142:
+	movb $94, -19(%rbp)
+	movq $727, -64(%rbp)
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, -40(%rbp)
+	movq -48(%rbp), %rax
+	movl %eax, -52(%rbp)
+	movsbl -19(%rbp), %eax
+	movl %eax, -112(%rbp)
+	testl %eax, %eax
+	jl .L172
+	cmpl $8, -112(%rbp)
+	jge .L172
+	movl -68(%rbp), %eax
+	testl %eax, %eax
+	je .L174
+	movabsq $354134748084, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L175
+.L174:
+	movl $0, %eax
+.L175:
+	movq %rax, %rcx
+	movsbq -19(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L172:
+.L173:
+	movl ga0+0(%rip), %eax
+	movl %eax, -80(%rbp)
+	movl $1, %eax
+.f1.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L170:
+.L171:
+	movsbq -19(%rbp), %rax
+	movq %rax, -32(%rbp)
+	addq $1, -64(%rbp)
+	cmpq $4, -64(%rbp)
+	jl .L168
+	jmp .L169
+.L154:
+	movzwl -18(%rbp), %eax
+	cmpq %rax, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	jne .L158
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L159
+.L158:
+	movl $1, %eax
+.L159:
+	movw %ax, -18(%rbp)
+	cmpw $0, -18(%rbp)
+	jne .L162
+	movl $9, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L163
+.L162:
+	movl $1, %eax
+.L163:
+	testb %al, %al
+	je .L160
+	jmp .L153
+.L156:
+.L157:
+.L160:
+.L161:
+.L155:
+	imulq $727, -48(%rbp), %rax
+	movslq -104(%rbp), %rcx
+	cmpq %rcx, %rax
+	jne .L164
+	jmp .L153
+.L164:
+.L165:
+	addl $1, -40(%rbp)
+	cmpl $4, -40(%rbp)
+	jb .L152
+	jmp .L153
+.L143:
+	jmp .L142
+.L144:
+	movzwl -18(%rbp), %eax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	subq -48(%rbp), %rax
+	movb %al, -19(%rbp)
+	jmp .L142
+.L145:
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	jmp .L142
+	.size f1.constprop.0, .-f1.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L149:
+	.long .L143-.L149
+	.long .L147-.L149
+	.long .L146-.L149
+	.long .L145-.L149
+	.long .L144-.L149
+	.long .L146-.L149
+	.long .L146-.L149
+	.long .L144-.L149
+	.long .L143-.L149
+	.popsection
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $336, %rsp
+	movw %di, -2(%rbp)
+	movb %sil, -3(%rbp)
+	movb %dl, -4(%rbp)
+	movb %cl, -5(%rbp)
+	movb %r8b, -6(%rbp)
+	movb $0, -7(%rbp)
+	movabsq $731539394239, %rax
+	movq %rax, -16(%rbp)
+	movw $61430, -18(%rbp)
+	movl $6, -24(%rbp)
+	movq $956, -32(%rbp)
+	movl $0, -24(%rbp)
+	movl $0, -64(%rbp)
+	movl $5, -60(%rbp)
+	movl $10, -56(%rbp)
+	movl $15, -52(%rbp)
+	movl $20, -48(%rbp)
+	movl $25, -44(%rbp)
+	movl $30, -40(%rbp)
+	movl $35, -36(%rbp)
+	movl $8, -24(%rbp)
+	movl $0, -24(%rbp)
+	imull $10, -24(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -212(%rbp)
+	cmpl $33, -24(%rbp)
+	jge .L176
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -224(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L179
+	.p2align 4,,10
+.L178:
+	addl $10, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $10, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $10, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $10, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -224(%rbp)
+	jne .L178
+.L179:
+.L176:
+.L177:
+	cmpl $33, -24(%rbp)
+	jge .L181
+	.p2align 4,,10
+.L180:
+	addl $10, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L180
+.L181:
+	movzbl -3(%rbp), %eax
+	movl %eax, -236(%rbp)
+	imull -236(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -32(%rbp), %rax
+	movq %rax, -232(%rbp)
+	movq %rax, %r9
+	movzwl -18(%rbp), %eax
+	movq %rax, %r8
+	movsbq -7(%rbp), %rax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	movq %rax, %rdx
+	movsbq -5(%rbp), %rax
+	movq %rax, %rsi
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movzwl -18(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -18(%rbp)
+	cmpl $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $1000000007, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	cmpq -232(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movabsq $379966576337, %rax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movslq -24(%rbp), %rax
+	movq %rax, -248(%rbp)
+	movq %rax, %rsi
+	movsbq -7(%rbp), %rax
+	movq %rax, %rdi
+	call f1.constprop.0
+	addq $8, %rsp
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L182
+	movzwl -18(%rbp), %eax
+	movl %eax, -252(%rbp)
+	imull -252(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpq $540, -16(%rbp)
+	setb %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	cmpq %rcx, %rax
+	jle .L183
+	movq $0, -32(%rbp)
+	movl -252(%rbp), %eax
+	addl $155, %eax
+	movl %eax, -256(%rbp)
+	movl $-505, -260(%rbp)
+	cmpq $4, -32(%rbp)
+	jge .L186
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $4, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -272(%rbp)
+	cmpq $0, -272(%rbp)
+	je .L189
+	.p2align 4,,10
+.L188:
+	movslq -260(%rbp), %rax
+	movq %rax, -288(%rbp)
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl -196(%rbp), %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movq -248(%rbp), %rax
+	movq %rax, %rsi
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f1.constprop.1
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movslq -256(%rbp), %rax
+	movq %rax, -280(%rbp)
+	movq %rax, %rsi
+	movl -96(%rbp), %eax
+	imull -252(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f1
+	addq $1, -32(%rbp)
+	movq -288(%rbp), %rax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl -196(%rbp), %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movq -248(%rbp), %rax
+	movq %rax, %rsi
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f1.constprop.1
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movq -280(%rbp), %rax
+	movq %rax, %rsi
+	movl -96(%rbp), %eax
+	imull -252(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f1
+	addq $1, -32(%rbp)
+	subq $1, -272(%rbp)
+	jne .L188
+.L189:
+.L186:
+.L187:
+	cmpq $4, -32(%rbp)
+	jge .L191
+	.p2align 4,,10
+.L190:
+	movslq -260(%rbp), %rax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl -196(%rbp), %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movq -248(%rbp), %rax
+	movq %rax, %rsi
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f1.constprop.1
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movslq -256(%rbp), %rax
+	movq %rax, %rsi
+	movl -96(%rbp), %eax
+	imull -252(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f1
+	addq $1, -32(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L190
+.L191:
+	movzwl -2(%rbp), %eax
+	movl %eax, -292(%rbp)
+	cmpl $42, %eax
+	setge %al
+	movzbl %al, %eax
+	addl -236(%rbp), %eax
+	movb %al, -3(%rbp)
+	cmpl $4, -292(%rbp)
+	setl %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	je .L192
+	movsbl -7(%rbp), %eax
+	movl -112(%rbp), %ecx
+	imull %ecx, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movzbl g0(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L193
+.L182:
+	movq $0, -16(%rbp)
+	movq -32(%rbp), %rax
+	movzbl -4(%rbp), %ecx
+	subq %rcx, %rax
+	movq %rax, -304(%rbp)
+	movzwl -18(%rbp), %eax
+	movl %eax, -312(%rbp)
+	imull -312(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -308(%rbp)
+	cmpq $3, -16(%rbp)
+	jae .L195
+	.p2align 4,,10
+.L194:
+	movl $2, -24(%rbp)
+	cmpl $4, -24(%rbp)
+	.p2align 4,,10
+.L196:
+.L197:
+	movzbl g0(%rip), %eax
+	movzbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $10, %eax
+	movq %rax, %r8
+	movl $-128, %eax
+	movq %rax, %rcx
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $489, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, -320(%rbp)
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	popq %rcx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L205
+	leaq .L206(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L202
+	# table target .L203
+	# table target .L200
+	# table target .L201
+	# table target .L204
+	# table target .L199
+	jmp *%rcx
+.L205:
+.L202:
+.L198:
+	addq $1, -16(%rbp)
+	cmpq $3, -16(%rbp)
+	jb .L194
+.L195:
+.L183:
+	movsbl -6(%rbp), %eax
+	movl %eax, -328(%rbp)
+	movq %rax, %rcx
+	movl -140(%rbp), %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	cmpl %ecx, %eax
+	jge .LB1
+.L211:
+.L212:
+	cmpb $0, g0(%rip)
+	je .L213
+	movl -328(%rbp), %eax
+	subl $616, %eax
+	pushq %rax
+	movzbl g0(%rip), %eax
+	movzbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl -7(%rbp), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L192:
+	movl $0, %eax
+.L193:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+.L184:
+.L185:
+	jmp .L183
+.L199:
+	cmpq $0, -304(%rbp)
+	je .L198
+	jmp .L198
+.L207:
+.L208:
+	jmp .L198
+.L200:
+	movzwl -2(%rbp), %eax
+	movl %eax, -324(%rbp)
+	imull -324(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	cltd
+	idivl %ecx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	cmpl $32767, %eax
+	setbe %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	jmp .L198
+.L201:
+	movl ga0+0(%rip), %eax
+	cltd
+	idivl -308(%rbp)
+	movq %rax, %rcx
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movq -320(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	jmp .L198
+.L203:
+	movzbl g0(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L198
+	jmp .L198
+.L209:
+.L210:
+	jmp .L198
+.L204:
+	movzbl g0(%rip), %eax
+	movb %al, -5(%rbp)
+	jmp .L198
+.L213:
+.L214:
+	movq $2, -32(%rbp)
+	movzwl -18(%rbp), %eax
+	movl %eax, -332(%rbp)
+	movq %rax, %rcx
+	movzbl -3(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -3(%rbp)
+	movzbl -3(%rbp), %eax
+	addl -332(%rbp), %eax
+	movb %al, -3(%rbp)
+	movzbl -3(%rbp), %eax
+	addl -332(%rbp), %eax
+	movb %al, -3(%rbp)
+	movq $5, -32(%rbp)
+	movq -16(%rbp), %rax
+	jmp .f2_return
+.LB1:
+	movl $1, %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L206:
+	.long .L203-.L206
+	.long .L202-.L206
+	.long .L202-.L206
+	.long .L202-.L206
+	.long .L202-.L206
+	.long .L200-.L206
+	.long .L201-.L206
+	.long .L202-.L206
+	.long .L204-.L206
+	.long .L199-.L206
+	.popsection
+	.align 16
+f3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movw %di, -2(%rbp)
+	movb %sil, -3(%rbp)
+	movl %edx, -8(%rbp)
+	movb %cl, -9(%rbp)
+	movq $99, -24(%rbp)
+	movw $1, -26(%rbp)
+	movw $8, -28(%rbp)
+	movl $1, -32(%rbp)
+	movq $128, -40(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L215
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L218
+	.p2align 4,,10
+.L217:
+	movl -32(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -184(%rbp)
+	jne .L217
+.L218:
+.L215:
+.L216:
+	cmpl $33, -32(%rbp)
+	jge .L220
+	.p2align 4,,10
+.L219:
+	movl -32(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L219
+.L220:
+	movl $4, %eax
+	pushq %rax
+	movzbl -3(%rbp), %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %rdx
+	movl $98, %eax
+	movq %rax, %rsi
+	movzwl -26(%rbp), %eax
+	movzbl g0(%rip), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f2
+	movl -124(%rbp), %eax
+	movq %rax, %r8
+	movl -8(%rbp), %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $255, %eax
+	movq %rax, %rsi
+	movl ga0+24(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	movzbl %al, %eax
+	cmpl $4294966591, %eax
+	setb %al
+	movzbl %al, %eax
+	addl $4, %eax
+	movl %eax, -32(%rbp)
+	movl -8(%rbp), %eax
+	movq %rax, -192(%rbp)
+	addq %rax, -24(%rbp)
+	movq -192(%rbp), %rax
+	movq %rax, %r9
+	movl ga0+24(%rip), %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $26, %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+	pushq %rax
+	movsbl -9(%rbp), %eax
+	addl $96, %eax
+	pushq %rax
+	movl -160(%rbp), %eax
+	testl %eax, %eax
+	jne .L221
+	movl $589, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L222
+.L221:
+	movl $1, %eax
+.L222:
+	pushq %rax
+	movzbl -3(%rbp), %eax
+	movl %eax, -196(%rbp)
+	imull -196(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f2
+	cmpl $0, -32(%rbp)
+	jne .L225
+	cmpw $0, -28(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L226
+.L225:
+	movl $1, %eax
+.L226:
+	addl -8(%rbp), %eax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	testl %eax, %eax
+	je .L223
+	movl -108(%rbp), %eax
+	movw %ax, -28(%rbp)
+	xorl %eax, %eax
+	movq %rax, %r9
+	movl $-62, %eax
+	movq %rax, %r8
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	addq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movq $-3, %rax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f1
+	cmpl $0, -32(%rbp)
+	je .L227
+	cmpb $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L228
+.L227:
+	movl $0, %eax
+.L228:
+	addl $127, %eax
+	addl -196(%rbp), %eax
+	movb %al, -3(%rbp)
+.L223:
+.L224:
+	movq -40(%rbp), %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -2(%rbp)
+	movq -24(%rbp), %rax
+	movb %al, -3(%rbp)
+	movl $0, -8(%rbp)
+	cmpq $-450, -24(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, -200(%rbp)
+	cmpl $33, -8(%rbp)
+	jae .L230
+	.p2align 4,,10
+.L229:
+	movzbl g0(%rip), %eax
+	addl -200(%rbp), %eax
+	je .L231
+.L230:
+	xorl %eax, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	pushq %rax
+	movl $14, %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movl $4, %eax
+	movq %rax, %r8
+	movl -8(%rbp), %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movslq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f2
+	movzbl %al, %eax
+.f3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L231:
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	cmpl %ecx, %eax
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -160(%rbp)
+.L232:
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jb .L229
+	jmp .L230
+	.size f3, .-f3
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movl $434, -120(%rbp)
+	movl $6, -116(%rbp)
+	movb $16, -123(%rbp)
+	movl $32767, -112(%rbp)
+	movq $6, -48(%rbp)
+	movl $0, -92(%rbp)
+	movl $330, -96(%rbp)
+	movl $660, -100(%rbp)
+	movl $990, -104(%rbp)
+	movl $0, -76(%rbp)
+	movl $9, -80(%rbp)
+	movl $27, -88(%rbp)
+	movslq -116(%rbp), %rax
+	movabsq $-438177356386, %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -84(%rbp)
+	movl $0, -108(%rbp)
+	movsbl -123(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -52(%rbp)
+	cmpl $33, -108(%rbp)
+	jge .L233
+	movl $33, %eax
+	movslq -108(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L234
+	.p2align 4,,10
+.L235:
+	movl -120(%rbp), %eax
+	movb %al, -16(%rbp)
+	movb %al, g0(%rip)
+	xorl %eax, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movl $169, %eax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+8(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	movzbl %al, %eax
+	pushq %rax
+	movl $2, %eax
+	cltd
+	idivl -52(%rbp)
+	movl %eax, -8(%rbp)
+	testl %eax, %eax
+	jne .L237
+	movl -108(%rbp), %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L238
+.L237:
+	movl $1, %eax
+.L238:
+	popq %rcx
+	addl %ecx, %eax
+	movb %al, g0(%rip)
+	movslq -120(%rbp), %rax
+	movq %rax, -48(%rbp)
+	addl $1, -108(%rbp)
+	movzbl -16(%rbp), %eax
+	movb %al, g0(%rip)
+	xorl %eax, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movl $169, %eax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+8(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -8(%rbp)
+	jne .L239
+	movl -108(%rbp), %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L240
+.L239:
+	movl $1, %eax
+.L240:
+	popq %rcx
+	addl %ecx, %eax
+	movb %al, g0(%rip)
+	movq -48(%rbp), %rax
+	movq %rax, -48(%rbp)
+	addl $1, -108(%rbp)
+	subq $1, -24(%rbp)
+	jne .L235
+.L236:
+.L233:
+.L234:
+	cmpl $33, -108(%rbp)
+	jge .L242
+	.p2align 4,,10
+.L241:
+	movl -120(%rbp), %eax
+	movb %al, g0(%rip)
+	xorl %eax, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movl $169, %eax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+8(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	movzbl %al, %eax
+	pushq %rax
+	movl $2, %eax
+	cltd
+	idivl -52(%rbp)
+	testl %eax, %eax
+	jne .L243
+	movl -108(%rbp), %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L244
+.L243:
+	movl $1, %eax
+.L244:
+	popq %rcx
+	addl %ecx, %eax
+	movb %al, g0(%rip)
+	movslq -120(%rbp), %rax
+	movq %rax, -48(%rbp)
+	addl $1, -108(%rbp)
+	cmpl $33, -108(%rbp)
+	jl .L241
+.L242:
+	movabsq $774107212655, %rax
+	cmpq %rax, -48(%rbp)
+	jne .L245
+	movl $0, -116(%rbp)
+	cmpl $0, -112(%rbp)
+	jne .L247
+	cmpl $0, -108(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L248
+.L247:
+	movl $1, %eax
+.L248:
+	movl %eax, -72(%rbp)
+	movl $7, %eax
+	subl -112(%rbp), %eax
+	movl %eax, -68(%rbp)
+	cmpl $2, -108(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	movl -112(%rbp), %eax
+	addl $687, %eax
+	movl %eax, -60(%rbp)
+	movabsq $-768757263106, %rax
+	movq %rax, -40(%rbp)
+	cmpl $5, -112(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	cmpl $17, -116(%rbp)
+	jge .L249
+	movl $17, %eax
+	movslq -116(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -32(%rbp)
+	cmpq $0, -32(%rbp)
+	je .L250
+	.p2align 4,,10
+.L251:
+	movq -40(%rbp), %rax
+	movb %al, -8(%rbp)
+	movq %rax, %r8
+	movl -60(%rbp), %eax
+	movb %al, -16(%rbp)
+	movq %rax, %rcx
+	movl -64(%rbp), %eax
+	movb %al, -24(%rbp)
+	movq %rax, %rdx
+	movl -68(%rbp), %eax
+	movb %al, -52(%rbp)
+	movq %rax, %rsi
+	movl -72(%rbp), %eax
+	movw %ax, -122(%rbp)
+	movq %rax, %rdi
+	call f2
+	movzbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L253
+	movzbl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L253
+	movzbl g0(%rip), %eax
+	movl -56(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L253:
+.L254:
+	addl $1, -116(%rbp)
+	movsbl -8(%rbp), %eax
+	movq %rax, %r8
+	movsbl -16(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -24(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -52(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -122(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	movzbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L255
+	movzbl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L255
+	movzbl g0(%rip), %eax
+	movl -56(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L255:
+.L256:
+	addl $1, -116(%rbp)
+	subq $1, -32(%rbp)
+	jne .L251
+.L252:
+.L249:
+.L250:
+	cmpl $17, -116(%rbp)
+	jge .L246
+	.p2align 4,,10
+.L257:
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movl -60(%rbp), %eax
+	movq %rax, %rcx
+	movl -64(%rbp), %eax
+	movq %rax, %rdx
+	movl -68(%rbp), %eax
+	movq %rax, %rsi
+	movl -72(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	movzbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L259
+	movzbl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L259
+	movzbl g0(%rip), %eax
+	movl -56(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L259:
+.L260:
+	addl $1, -116(%rbp)
+	cmpl $17, -116(%rbp)
+	jl .L257
+.L258:
+	jmp .L246
+.L245:
+	movl $99, %eax
+	movq %rax, %r8
+	movl -80(%rbp), %eax
+	movq %rax, %rcx
+	movl $217, %eax
+	movq %rax, %rdx
+	movl -112(%rbp), %eax
+	movq %rax, %rsi
+	movl $23054, %eax
+	movq %rax, %rdi
+	call f2
+	movzbl %al, %eax
+	cmpl $6, %eax
+	jne .L261
+	cmpl $0, -112(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L262
+.L261:
+	movl $0, %eax
+.L262:
+	movl %eax, -120(%rbp)
+.L246:
+	movl -108(%rbp), %eax
+	movq %rax, %rcx
+	movl $259, %eax
+	movq %rax, %rdx
+	movl $52, %eax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	movq %rax, %rdi
+	call f3
+	movzwl %ax, %eax
+	addl %eax, -120(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzbl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -120(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -116(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq -123(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -112(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -108(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -108(%rbp)
+	cmpl $8, -108(%rbp)
+	jge .L263
+	movl $8, %eax
+	movslq -108(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L264
+	.p2align 4,,10
+.L265:
+	movslq -108(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -108(%rbp)
+	movslq -108(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -108(%rbp)
+	movslq -108(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -108(%rbp)
+	movslq -108(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -108(%rbp)
+	subq $1, -8(%rbp)
+	jne .L265
+.L266:
+.L263:
+.L264:
+	cmpl $8, -108(%rbp)
+	jge .L268
+	.p2align 4,,10
+.L267:
+	movslq -108(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -108(%rbp)
+	cmpl $8, -108(%rbp)
+	jl .L267
+.L268:
+	movl -92(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -100(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -104(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -76(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	leave
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
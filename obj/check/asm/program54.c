@@ -0,0 +1,238 @@
+int g0 = 8;
+short g1 = 826;
+int ga0[33];
+int ga1[33];
+short f0(unsigned char p0, unsigned short p1, int p2, short p3) {
+    unsigned long v0 = 599633034097;
+    unsigned char v1 = 2;
+    int i0 = 3;
+    long j0 = 4;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 0; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 2; }
+    if (((g1 * g0) / (i0 * i0 + 1))) { return (unsigned int)((long)(966)); }
+    switch (((128 * 1) - v0)) {
+    case 9:
+        break;
+    case 0:
+    case 8:
+        switch ((j0 / 4)) {
+        case 27:
+            p1 = !(256);
+            j0 = 5;
+        default:
+            break;
+        case -1:
+            p1 = p1 + (j0 != v0);
+            p1 = 0;
+        case 2:
+            if (p3) {
+                if ((char)(p0)) { return (g0 + v1); }
+            }
+            for (j0 = 1; j0 < 8; j0 = j0 + 1) {
+                la1[j0] = ((0 <= 539) != (380066303936 <= v1));
+                v1 = v1 + 825134535424;
+            }
+            break;
+        }
+        break;
+    }
+    switch (!(!(j0))) {
+    case 0:
+    case 7:
+        j0 = -((g1 || (188U - i0)));
+        if (!((g0 + j0))) {
+            v1 = (((534l < g1) + (g1 <= 255)) >= p2);
+            switch ((p2 + 8)) {
+            default:
+                if ((la0[1] >= !(4294967295))) { return (-(64) < ga1[20]); }
+                break;
+            case 289:
+                la1[3] = ((g0 != 9) + (p1 * 255));
+                if (332) { return -((2 / 1024)); }
+                break;
+            }
+        } else {
+            p0 = p0 + -((long)(3));
+            p3 = 213303900134;
+            i0 = (v1 / (p3 * p3 + 1));
+        }
+    case 3:
+        v1 = (0 || (255 + (g1 == 435)));
+        if (p3 >= 0 && p3 < 8) { la1[p3] = 10; }
+    case 8:
+        la0[0] = ((5 > 7) * (0 - p2));
+        j0 = (-(la0[1]) + i0);
+        break;
+    case 4:
+        if (ga0[3]) { return ((g1 == g1) + j0); }
+        break;
+    case 1:
+        break;
+    default:
+        p3 = p3 + -((char)(la1[7]));
+        j0 = ((0 + (short)(la1[1])) / 1);
+        break;
+    }
+    la0[0] = (96 > (ga1[0] / (v0 * v0 + 1)));
+    i0 = 0;
+    while (i0 < 16) {
+        p2 = (unsigned long)(p3);
+        i0 = i0 + 1;
+    }
+    p0 = p0 + -((644377077630 / 1024));
+    if (((la1[1] / (p3 * p3 + 1)) - 4)) {
+        if (!((g1 - 604u))) { return (p1 < (g0 + la1[4])); }
+        if (((v1 / (g1 * g1 + 1)) >= v0)) {
+            j0 = 0;
+            while (j0 < 100) {
+                if (!(-(i0))) { break; }
+                j0 = j0 + 1;
+            }
+        }
+        if (p2) {
+            if (g0) {
+                i0 = g1;
+            } else {
+                if (((i0 || 5) && (la0[3] && 989))) { return ((1 + la0[3]) == p3); }
+                p0 = 696;
+                j0 = ((j0 != (v0 && 5)) && ((p3 >= p2) / 3));
+            }
+            p2 = 138989521679;
+        } else {
+            if (p2) {
+                if (((j0 + la1[6]) <= 5ul)) { return 0L; }
+                if (494349675179) { return ((7 / 10) >= (4U && i0)); }
+            } else {
+                p1 = 9;
+                if ((la1[1] / 100)) { return (10 <= 864); }
+                if ((304185686698 - (670 > 586801581730))) { return p3; }
+            }
+            for (v0 = 0; v0 < 33; v0 = v0 + 1) {
+                if ((855 - (650ul >= 3))) { break; }
+                i0 = (ga1[21] && (j0 != ga0[14]));
+                i0 = -((unsigned char)(p1));
+            }
+        }
+    } else {
+        for (i0 = 0; i0 < 8; i0 = i0 + 1) {
+            if ((int)((ga1[8] != la0[2]))) { break; }
+            p1 = !(4294967295);
+        }
+        switch (65535) {
+        case 7:
+        default:
+            if (((1 / (p3 * p3 + 1)) < (4294967295u / (g1 * g1 + 1)))) { return ((char)(1016656562748) - i0); }
+            if (j0) { return (int)(p3); }
+            break;
+        }
+        p1 = (int)(((la1[6] - 6) / 1024));
+    }
+    return (((la1[1] + p3) - i0) >= ((v0 / 8) + i0));
+}
+void w0(short q0) {
+    g0 = g0 * 3 + q0;
+}
+long rec(long n, long acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    unsigned short v0 = 872;
+    unsigned long v1 = 9ul;
+    unsigned char v2 = 622;
+    int i0 = 638;
+    long j0 = 1ul;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 744; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 0u; }
+    if (g1) { return v2; }
+    i0 = (255 <= -(1));
+    g1 = ga1[9];
+    if (100) {
+        switch ((f0(7, 1000000007, i0, ga1[22]) > 750)) {
+        case 40:
+            if (v2 >= 0 && v2 < 8) { la0[v2] = 62429450096; }
+        case 30:
+            break;
+        case 541:
+            if (266381086631) {
+                v2 = !(513L);
+                i0 = (((1000000007 / 13ul) - (2 / (g1 * g1 + 1))) * f0(583439196097, v2, 166538823377, j0));
+                g1 = (int)(((6 || 65535) < (g1 - g0)));
+            }
+        default:
+            for (i0 = 0; i0 < 100; i0 = i0 + 1) {
+                v2 = (int)(3);
+                j0 = (-((214L >= 8)) - ((v1 <= j0) + (unsigned long)(938ul)));
+            }
+            v2 = ((short)(1) + (7 == (377 != g1)));
+            break;
+        case 2:
+            for (i0 = 1; i0 < 17; i0 = i0 + 1) {
+                g0 = ((79 && (2147483647 + v0)) <= !(-(g1)));
+            }
+            break;
+        case 612:
+            break;
+        }
+        j0 = 0;
+        while (j0 < 4) {
+            v0 = rec(3, g0);
+            j0 = j0 + 1;
+        }
+    }
+    v2 = 158538879615;
+    switch ((v1 - g1)) {
+    case 217:
+    default:
+        v0 = v0;
+        break;
+    case 586:
+        if (v2 >= 0 && v2 < 33) { ga1[v2] = ((unsigned short)(8) && f0(i0, v1, 0, g0)); }
+        if (g0 >= 0 && g0 < 33) { ga1[g0] = !(-(la0[0])); }
+        break;
+    case 62:
+        la1[4] = ((ga1[29] - j0) - (la0[5] != ga0[6]));
+    case 10:
+        v1 = 0;
+        while (v1 < 17) {
+            i0 = 0;
+            while (i0 < 100) {
+                if (v1 >= 0 && v1 < 8) { la1[v1] = ((4l > v2) / (v2 * v2 + 1)); }
+                if (!(5)) { return g1; }
+                if ((0 > 10)) { break; }
+                i0 = i0 + 1;
+            }
+            v1 = v1 + 1;
+        }
+        break;
+    case 687:
+        if (g1) {
+            v2 = f0((g0 * 5), (i0 - 4), (g1 + i0), (v2 < 536));
+            v1 = (119 != (rec(g0, i0) - !(112)));
+        }
+        break;
+    case 649:
+        ga0[11] = (2 + 1);
+        if ((7 && v2)) { return (439027676013ul != (j0 && 8)); }
+        break;
+    }
+    g1 = ((unsigned short)(v1) / 10);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
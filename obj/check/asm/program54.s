@@ -0,0 +1,1685 @@
+	.section .data
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.long 8
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.short 826
+	.section .bss
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.type rec, @function
+	.type f0, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rdi, -16(%rbp)
+	movq %rsi, -8(%rbp)
+.rec_entry:
+	cmpq $4, -16(%rbp)
+	jl .L2
+	cmpq $18, -16(%rbp)
+	jg .L2
+.L0:
+.L1:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -16(%rbp)
+	popq %rax
+	movq %rax, -8(%rbp)
+	jmp .rec_entry
+.L2:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movb %dil, -1(%rbp)
+	movw %si, -4(%rbp)
+	movl %edx, -8(%rbp)
+	movw %cx, -10(%rbp)
+	movabsq $599633034097, %rax
+	movq %rax, -24(%rbp)
+	movb $2, -25(%rbp)
+	movl $3, -32(%rbp)
+	movq $4, -40(%rbp)
+	movl $0, -32(%rbp)
+	movl $0, -64(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -56(%rbp)
+	movl $0, -52(%rbp)
+	movl $4, -32(%rbp)
+	movl $0, -32(%rbp)
+	movl $0, -96(%rbp)
+	movl $2, -92(%rbp)
+	movl $4, -88(%rbp)
+	movl $6, -84(%rbp)
+	movl $8, -80(%rbp)
+	movl $10, -76(%rbp)
+	movl $12, -72(%rbp)
+	movl $14, -68(%rbp)
+	movl $8, -32(%rbp)
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movswl g1(%rip), %eax
+	imull g0(%rip), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .LB0
+.L3:
+.L4:
+	movl $128, %eax
+	subq -24(%rbp), %rax
+	je .L7
+	cmpq $8, %rax
+	je .L7
+	cmpq $9, %rax
+	je .L5
+	jmp .L5
+.L7:
+	movq -40(%rbp), %rax
+	leaq 3(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $2, %rcx
+	movq %rcx, %rax
+	cmpq $-1, %rax
+	je .L11
+	cmpq $2, %rax
+	je .L12
+	cmpq $27, %rax
+	je .L9
+	jmp .L8
+.L11:
+	movq -40(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -4(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -4(%rbp)
+	movw $0, -4(%rbp)
+.L12:
+	cmpw $0, -10(%rbp)
+	je .L13
+	movzbl -1(%rbp), %eax
+	testb %al, %al
+	jne .LB1
+.L15:
+.L16:
+.L13:
+.L14:
+	movq $1, -40(%rbp)
+	movl $1, -100(%rbp)
+	cmpq $8, -40(%rbp)
+	jge .L17
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L20
+	.p2align 4,,10
+.L19:
+	movzbl -25(%rbp), %eax
+	movq %rax, -120(%rbp)
+	movq %rax, %rcx
+	movabsq $380066303936, %rax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl %eax, -100(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	movabsq $825134535424, %rax
+	addq -120(%rbp), %rax
+	movb %al, -25(%rbp)
+	addq $1, -40(%rbp)
+	movzbl -25(%rbp), %eax
+	movq %rax, -128(%rbp)
+	movq %rax, %rcx
+	movabsq $380066303936, %rax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl %eax, -100(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	movabsq $825134535424, %rax
+	addq -128(%rbp), %rax
+	movb %al, -25(%rbp)
+	addq $1, -40(%rbp)
+	subq $1, -112(%rbp)
+	jne .L19
+.L20:
+.L17:
+.L18:
+	cmpq $8, -40(%rbp)
+	jge .L22
+	.p2align 4,,10
+.L21:
+	movzbl -25(%rbp), %eax
+	movq %rax, -136(%rbp)
+	movq %rax, %rcx
+	movabsq $380066303936, %rax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl %eax, -100(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	movabsq $825134535424, %rax
+	addq -136(%rbp), %rax
+	movb %al, -25(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $8, -40(%rbp)
+	jl .L21
+.L22:
+.L8:
+.L5:
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $8, %rcx
+	ja .L30
+	leaq .L31(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L29
+	# table target .L24
+	# table target .L28
+	# table target .L25
+	# table target .L27
+	# table target .L26
+	jmp *%rcx
+.L30:
+.L29:
+	movl -68(%rbp), %eax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movswl -10(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -10(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L23:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	cmpq $96, %rax
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jge .L45
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L48
+	.p2align 4,,10
+.L47:
+	movswq -10(%rbp), %rax
+	movl %eax, -8(%rbp)
+	addl $1, -32(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	addl $1, -32(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	addl $1, -32(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -152(%rbp)
+	jne .L47
+.L48:
+.L45:
+.L46:
+	cmpl $16, -32(%rbp)
+	jge .L50
+	.p2align 4,,10
+.L49:
+	movswq -10(%rbp), %rax
+	movl %eax, -8(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L49
+.L50:
+	movzbl -1(%rbp), %eax
+	addq $-629274489, %rax
+	movb %al, -1(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -156(%rbp)
+	imull -156(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -92(%rbp), %eax
+	cltd
+	idivl %ecx
+	subl $4, %eax
+	je .L51
+	movswl g1(%rip), %eax
+	subl $604, %eax
+	je .LB2
+.L53:
+.L54:
+	movswl g1(%rip), %eax
+	movswl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -25(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	jb .L55
+	movq $0, -40(%rbp)
+	xorl %eax, %eax
+	subl -32(%rbp), %eax
+	movl %eax, -160(%rbp)
+	cmpq $100, -40(%rbp)
+	jge .L58
+	.p2align 4,,10
+.L57:
+	cmpl $0, -160(%rbp)
+	jne .L59
+.L58:
+.L55:
+.L56:
+	cmpl $0, -8(%rbp)
+	je .L61
+	cmpl $0, g0(%rip)
+	je .L63
+	movswl g1(%rip), %eax
+	movl %eax, -32(%rbp)
+.L64:
+	movl $1550568207, -8(%rbp)
+.L79:
+.L62:
+	jmp .L52
+.L51:
+	movl $0, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jge .L85
+	.p2align 4,,10
+.L84:
+	movl ga1+32(%rip), %eax
+	movl -56(%rbp), %ecx
+	cmpl %ecx, %eax
+	je .L86
+.L85:
+	movl $65535, %eax
+	movslq %eax, %rax
+	cmpq $7, %rax
+.L89:
+	movswl g1(%rip), %eax
+	movswl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	xorl %edx, %edx
+	divl %ecx
+	pushq %rax
+	movl -156(%rbp), %eax
+	imull -156(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cmpl %ecx, %eax
+	jb .LB3
+.L90:
+.L91:
+	cmpq $0, -40(%rbp)
+	jne .LB4
+.L92:
+.L93:
+.L88:
+	movl -72(%rbp), %eax
+	subl $6, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movw %ax, -4(%rbp)
+.L52:
+	movq -24(%rbp), %rax
+	shrq $3, %rax
+	movslq -32(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movl -92(%rbp), %eax
+	addl -156(%rbp), %eax
+	subl -32(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L86:
+.L87:
+	movw $0, -4(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jl .L84
+	jmp .L85
+.L59:
+.L60:
+	addq $1, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jl .L57
+	jmp .L58
+.L9:
+	movw $0, -4(%rbp)
+	movq $5, -40(%rbp)
+.L10:
+	jmp .L8
+.L63:
+	cmpl $0, -32(%rbp)
+	jne .L67
+	movl $5, %eax
+	testl %eax, %eax
+	je .L65
+.L67:
+	movl -52(%rbp), %eax
+	testl %eax, %eax
+	je .L65
+	movl $989, %eax
+	testl %eax, %eax
+	jne .LB5
+.L65:
+.L66:
+	movb $184, -1(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L70
+	movl $5, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L71
+.L70:
+	movl $0, %eax
+.L71:
+	movslq %eax, %rax
+	cmpq %rax, -40(%rbp)
+	je .L68
+	movl -156(%rbp), %eax
+	cmpl -8(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L69
+.L68:
+	movl $0, %eax
+.L69:
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	jmp .L64
+.L6:
+	jmp .L5
+.L24:
+	cmpw $0, g1(%rip)
+	jne .L32
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movl $188, %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L33
+.L32:
+	movl $1, %eax
+.L33:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movslq g0(%rip), %rax
+	addq -40(%rbp), %rax
+	jne .L34
+	movswl g1(%rip), %eax
+	cmpl $255, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq g1(%rip), %rax
+	cmpq $534, %rax
+	setg %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	cmpl -8(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movb %al, -25(%rbp)
+	movl -8(%rbp), %eax
+	addl $8, %eax
+	movslq %eax, %rax
+	cmpq $289, %rax
+	je .L38
+.L37:
+	movl -60(%rbp), %eax
+	testl %eax, %eax
+	jge .LB6
+.L39:
+.L40:
+.L36:
+	jmp .L35
+.L34:
+	movzbl -1(%rbp), %eax
+	addq $-3, %rax
+	movb %al, -1(%rbp)
+	movw $14310, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -140(%rbp)
+	imull -140(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -25(%rbp), %eax
+	cltd
+	idivl %ecx
+	movl %eax, -32(%rbp)
+.L35:
+.L25:
+	movswl g1(%rip), %eax
+	cmpl $435, %eax
+	sete %al
+	movzbl %al, %eax
+	addl $255, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -25(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -144(%rbp)
+	testl %eax, %eax
+	jl .L41
+	cmpl $8, -144(%rbp)
+	jge .L41
+	movswq -10(%rbp), %rax
+	movl $10, -96(%rbp,%rax,4)
+.L41:
+.L42:
+.L26:
+	movl $0, -64(%rbp)
+	xorl %eax, %eax
+	movl -60(%rbp), %ecx
+	subl %ecx, %eax
+	addl -32(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	jmp .L23
+.L27:
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	jne .LB7
+.L43:
+.L44:
+	jmp .L23
+.L28:
+	jmp .L23
+.LB3:
+	movl $60, %eax
+	subl -32(%rbp), %eax
+	jmp .f0_return
+.LB0:
+	movl $966, %eax
+	jmp .f0_return
+.L61:
+	cmpl $0, -8(%rbp)
+	je .L72
+	movl -72(%rbp), %eax
+	movslq %eax, %rax
+	addq -40(%rbp), %rax
+	cmpq $5, %rax
+	ja .L74
+	movl $0, %eax
+	jmp .f0_return
+.LB4:
+	movl -156(%rbp), %eax
+	jmp .f0_return
+.L72:
+	movw $9, -4(%rbp)
+	movl -92(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L76
+	movl $1, %eax
+	jmp .f0_return
+.LB2:
+	movl -80(%rbp), %eax
+	addl g0(%rip), %eax
+	movq %rax, %rcx
+	movzwl -4(%rbp), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L74:
+.L75:
+	cmpl $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L76:
+.L77:
+	movswl -10(%rbp), %eax
+	jmp .f0_return
+.LB1:
+	movzbl -25(%rbp), %eax
+	addl g0(%rip), %eax
+	jmp .f0_return
+.LB7:
+	movswl g1(%rip), %eax
+	movswl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq -40(%rbp), %rax
+	jmp .f0_return
+.LB5:
+	movl -52(%rbp), %eax
+	addl $1, %eax
+	cmpl -156(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L38:
+	movzwl -4(%rbp), %eax
+	imull $255, %eax, %eax
+	movq %rax, %rcx
+	cmpl $9, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movl %eax, -84(%rbp)
+	movl $0, %eax
+	jmp .f0_return
+.LB6:
+	movl ga1+80(%rip), %eax
+	cmpl $-64, %eax
+	setg %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L73:
+	movq $0, -24(%rbp)
+	movl $854, -164(%rbp)
+	movzwl -4(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -168(%rbp)
+	cmpq $33, -24(%rbp)
+	jae .L52
+	.p2align 4,,10
+.L78:
+	cmpl $0, -164(%rbp)
+	je .L80
+	jmp .L52
+.L80:
+.L81:
+	movl ga1+84(%rip), %eax
+	testl %eax, %eax
+	je .L82
+	movl ga0+56(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L83
+.L82:
+	movl $0, %eax
+.L83:
+	movl %eax, -32(%rbp)
+	movl -168(%rbp), %eax
+	movl %eax, -32(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jb .L78
+	jmp .L52
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L31:
+	.long .L24-.L31
+	.long .L28-.L31
+	.long .L29-.L31
+	.long .L25-.L31
+	.long .L27-.L31
+	.long .L29-.L31
+	.long .L29-.L31
+	.long .L24-.L31
+	.long .L26-.L31
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $304, %rsp
+	movw $872, -2(%rbp)
+	movq $9, -16(%rbp)
+	movb $110, -17(%rbp)
+	movl $638, -24(%rbp)
+	movq $1, -32(%rbp)
+	movl $0, -24(%rbp)
+	movl $0, -64(%rbp)
+	movl $744, -60(%rbp)
+	movl $1488, -56(%rbp)
+	movl $2232, -52(%rbp)
+	movl $2976, -48(%rbp)
+	movl $3720, -44(%rbp)
+	movl $4464, -40(%rbp)
+	movl $5208, -36(%rbp)
+	movl $8, -24(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	je .L94
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L97
+	.p2align 4,,10
+.L96:
+	movslq -24(%rbp), %rax
+	movl $0, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl $0, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl $0, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl $0, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -112(%rbp)
+	jne .L96
+.L97:
+.L94:
+.L95:
+	cmpl $8, -24(%rbp)
+	jge .L99
+	.p2align 4,,10
+.L98:
+	movslq -24(%rbp), %rax
+	movl $0, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L98
+.L99:
+	cmpw $0, g1(%rip)
+	jne .LB8
+.L100:
+.L101:
+	movl $0, -24(%rbp)
+	movl ga1+36(%rip), %eax
+	movw %ax, g1(%rip)
+	movl ga1+88(%rip), %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	movq %rax, %rdx
+	movl $51719, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	cmpl $750, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $40, %rax
+	jge .L109
+	cmpq $2, %rax
+	je .L107
+	cmpq $30, %rax
+	je .L104
+	jmp .L106
+.L109:
+	cmpq $40, %rax
+	je .L103
+	cmpq $541, %rax
+	je .L105
+	cmpq $612, %rax
+	je .L102
+	jmp .L106
+.L103:
+	movzbl -17(%rbp), %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	jl .L110
+	cmpl $8, -116(%rbp)
+	jge .L110
+	movzbl -17(%rbp), %eax
+	movl $-1995059344, -64(%rbp,%rax,4)
+.L110:
+.L111:
+.L104:
+.L102:
+	movq $0, -32(%rbp)
+	movslq g0(%rip), %rax
+	movq %rax, -160(%rbp)
+	movq -160(%rbp), %rax
+	addq $3, %rax
+.L124:
+	movw %ax, -2(%rbp)
+	movslq g0(%rip), %rax
+	movq %rax, -160(%rbp)
+	movq -160(%rbp), %rax
+	addq $3, %rax
+.L125:
+	movw %ax, -2(%rbp)
+	movslq g0(%rip), %rax
+	movq %rax, -160(%rbp)
+	movq -160(%rbp), %rax
+	addq $3, %rax
+.L126:
+	movw %ax, -2(%rbp)
+	movslq g0(%rip), %rax
+	movq %rax, -160(%rbp)
+	movq -160(%rbp), %rax
+	addq $3, %rax
+.L127:
+	movw %ax, -2(%rbp)
+	movq $4, -32(%rbp)
+	movb $127, -17(%rbp)
+	movq -16(%rbp), %rax
+	movswq g1(%rip), %rcx
+	subq %rcx, %rax
+	cmpq $586, %rax
+	jge .L135
+	cmpq $10, %rax
+	je .L132
+	cmpq $62, %rax
+	je .L131
+	cmpq $217, %rax
+.L129:
+	jmp .L128
+.L135:
+	cmpq $586, %rax
+	je .L130
+	cmpq $649, %rax
+	je .L134
+	cmpq $687, %rax
+	je .L133
+	jmp .L128
+.L131:
+	movl -44(%rbp), %eax
+	movl ga0+24(%rip), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl ga1+116(%rip), %eax
+	movslq %eax, %rax
+	subq -32(%rbp), %rax
+	subq %rcx, %rax
+	movl %eax, -80(%rbp)
+.L132:
+	movq $0, -16(%rbp)
+	movzbl -17(%rbp), %eax
+	cmpq $4, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -168(%rbp)
+	movzbl -17(%rbp), %eax
+	movl %eax, -176(%rbp)
+	imull -176(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -172(%rbp)
+	movl $0, -180(%rbp)
+	cmpq $17, -16(%rbp)
+	jae .L141
+	.p2align 4,,10
+.L140:
+	movl $0, -24(%rbp)
+	cmpq $0, -16(%rbp)
+	jb .L142
+	cmpq $8, -16(%rbp)
+	setb %al
+	movzbl %al, %eax
+	jmp .L143
+.L142:
+	movl $0, %eax
+.L143:
+	movl %eax, -184(%rbp)
+	movl -168(%rbp), %eax
+	movl %eax, -188(%rbp)
+	movl -172(%rbp), %eax
+	movl %eax, -192(%rbp)
+	movl -180(%rbp), %eax
+	movl %eax, -196(%rbp)
+	cmpl $100, -24(%rbp)
+	jge .L145
+	.p2align 4,,10
+.L144:
+	cmpl $0, -184(%rbp)
+	je .L146
+	movl -188(%rbp), %eax
+	cltd
+	idivl -192(%rbp)
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L146:
+.L147:
+	cmpl $0, -196(%rbp)
+	je .L148
+.L145:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jb .L140
+.L141:
+.L128:
+	movq -16(%rbp), %rax
+	movzwl %ax, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movw %ax, g1(%rip)
+	movq $0, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movswq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movzwl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movzbl -17(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	movslq -24(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	imulq $31, -256(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -256(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -260(%rbp)
+	testl %eax, %eax
+	je .L168
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -272(%rbp)
+	cmpq $0, -272(%rbp)
+	je .L171
+	.p2align 4,,10
+.L170:
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -272(%rbp)
+	jne .L170
+.L171:
+.L168:
+.L169:
+	cmpl $33, -24(%rbp)
+	jge .L173
+	.p2align 4,,10
+.L172:
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L172
+.L173:
+	movl $0, -24(%rbp)
+	cmpl $0, -260(%rbp)
+	je .L174
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L177
+	.p2align 4,,10
+.L176:
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -280(%rbp)
+	jne .L176
+.L177:
+.L174:
+.L175:
+	cmpl $33, -24(%rbp)
+	jge .L179
+	.p2align 4,,10
+.L178:
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L178
+.L179:
+	movl $0, -24(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L180
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -288(%rbp)
+	cmpq $0, -288(%rbp)
+	je .L183
+	.p2align 4,,10
+.L182:
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -288(%rbp)
+	jne .L182
+.L183:
+.L180:
+.L181:
+	cmpl $8, -24(%rbp)
+	jge .L185
+	.p2align 4,,10
+.L184:
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L184
+.L185:
+	movl $0, -24(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L186
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -296(%rbp)
+	cmpq $0, -296(%rbp)
+	je .L189
+	.p2align 4,,10
+.L188:
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -296(%rbp)
+	jne .L188
+.L189:
+.L186:
+.L187:
+	cmpl $8, -24(%rbp)
+	jge .L191
+	.p2align 4,,10
+.L190:
+	movslq -24(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -256(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L190
+.L191:
+	movq -256(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -256(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -256(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -256(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -256(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -256(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -256(%rbp)
+	movq -256(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L148:
+.L149:
+	addl $1, -24(%rbp)
+	cmpl $100, -24(%rbp)
+	jl .L144
+	jmp .L145
+.L105:
+	movb $0, -17(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $-964901167, %eax
+	movq %rax, %rdx
+	movzbl -17(%rbp), %eax
+	movq %rax, %rsi
+	movl $193, %eax
+	movq %rax, %rdi
+	call f0
+	movswq %ax, %rax
+	pushq %rax
+	movswl g1(%rip), %eax
+	movswl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $76923077, %eax
+	subq %rcx, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movl %eax, -24(%rbp)
+	movswl g1(%rip), %eax
+	subl g0(%rip), %eax
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movw %ax, g1(%rip)
+.L106:
+	movl $0, -24(%rbp)
+	movl $-1, -120(%rbp)
+	cmpl $100, -24(%rbp)
+	jge .L112
+	movl $100, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L115
+	.p2align 4,,10
+.L114:
+	movb $3, -17(%rbp)
+	movq -32(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $938, %rax
+	movq %rax, %rcx
+	movslq -120(%rbp), %rax
+	movq %rax, -136(%rbp)
+	subq %rcx, %rax
+	movq %rax, -32(%rbp)
+	addl $1, -24(%rbp)
+	movb $3, -17(%rbp)
+	movq -32(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $938, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, -32(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -128(%rbp)
+	jne .L114
+.L115:
+.L112:
+.L113:
+	cmpl $100, -24(%rbp)
+	jge .L117
+	.p2align 4,,10
+.L116:
+	movb $3, -17(%rbp)
+	movq -32(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $938, %rax
+	movq %rax, %rcx
+	movslq -120(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, -32(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $100, -24(%rbp)
+	jl .L116
+.L117:
+	movswl g1(%rip), %eax
+	cmpl $377, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl $7, %eax
+	sete %al
+	movzbl %al, %eax
+	addl $1, %eax
+	movb %al, -17(%rbp)
+	jmp .L102
+.L107:
+	movl $1, -24(%rbp)
+	movzwl -2(%rbp), %eax
+	addl $2147483647, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -140(%rbp)
+	cmpl $17, -24(%rbp)
+	jge .L118
+	movl $17, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -152(%rbp)
+	cmpq $0, -152(%rbp)
+	je .L121
+	.p2align 4,,10
+.L120:
+	xorl %eax, %eax
+	movswl g1(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -140(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	addl $1, -24(%rbp)
+	xorl %eax, %eax
+	movswl g1(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -140(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	addl $1, -24(%rbp)
+	xorl %eax, %eax
+	movswl g1(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -140(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	addl $1, -24(%rbp)
+	xorl %eax, %eax
+	movswl g1(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -140(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	addl $1, -24(%rbp)
+	subq $1, -152(%rbp)
+	jne .L120
+.L121:
+.L118:
+.L119:
+	cmpl $17, -24(%rbp)
+	jge .L102
+	.p2align 4,,10
+.L122:
+	xorl %eax, %eax
+	movswl g1(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -140(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	addl $1, -24(%rbp)
+	cmpl $17, -24(%rbp)
+	jl .L122
+.L123:
+	jmp .L102
+.L130:
+	movzbl -17(%rbp), %eax
+	movl %eax, -164(%rbp)
+	testl %eax, %eax
+	jl .L136
+	cmpl $33, -164(%rbp)
+	jge .L136
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -17(%rbp), %eax
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L136:
+.L137:
+	cmpl $0, g0(%rip)
+	jl .L128
+	cmpl $33, g0(%rip)
+	jge .L128
+	xorl %eax, %eax
+	movl -64(%rbp), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L138:
+.L139:
+	jmp .L128
+.L134:
+	movl $3, ga0+44(%rip)
+	cmpb $0, -17(%rbp)
+	je .L128
+	cmpq $0, -32(%rbp)
+	je .L166
+	movl $8, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L167
+.L108:
+	jmp .L102
+.L133:
+	cmpw $0, g1(%rip)
+	je .L128
+	movzbl -17(%rbp), %eax
+	cmpl $536, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl g1(%rip), %eax
+	addl -24(%rbp), %eax
+	movq %rax, %rdx
+	movl -24(%rbp), %eax
+	subl $4, %eax
+	movq %rax, %rsi
+	imull $5, g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -17(%rbp)
+	movslq g0(%rip), %rax
+	movq %rax, -208(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -216(%rbp)
+	cmpq $4, -208(%rbp)
+	jl .L155
+	cmpq $18, -208(%rbp)
+	jle .L153
+.L155:
+	movq -216(%rbp), %rax
+	addq -208(%rbp), %rax
+.L152:
+	cmpq $119, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L150:
+.L151:
+	jmp .L128
+.L164:
+.L165:
+	jmp .L128
+.L153:
+.L154:
+	movq -208(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -224(%rbp)
+	imulq $3, -216(%rbp), %rax
+	addq -208(%rbp), %rax
+	movq %rax, -232(%rbp)
+	cmpq $4, -224(%rbp)
+	jl .L159
+	cmpq $18, -224(%rbp)
+	jle .L157
+.L159:
+	movq -232(%rbp), %rax
+	addq -224(%rbp), %rax
+.L156:
+	jmp .L152
+.L157:
+.L158:
+	movq -224(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -240(%rbp)
+	imulq $3, -232(%rbp), %rax
+	addq -224(%rbp), %rax
+	movq %rax, -248(%rbp)
+	cmpq $4, -240(%rbp)
+	jl .L163
+	cmpq $18, -240(%rbp)
+	jle .L161
+.L163:
+	movq -248(%rbp), %rax
+	addq -240(%rbp), %rax
+.L160:
+	jmp .L152
+.L161:
+.L162:
+	imulq $3, -248(%rbp), %rax
+	addq -240(%rbp), %rax
+	movq %rax, %rsi
+	movq -240(%rbp), %rax
+	subq $2, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L152
+.LB8:
+	movzbl -17(%rbp), %eax
+	jmp .main_return
+.L166:
+	movl $0, %eax
+.L167:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $439027676013, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
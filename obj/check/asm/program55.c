@@ -0,0 +1,129 @@
+char g0;
+unsigned char g1 = 3;
+int g2 = 51;
+char f0(short p0, unsigned int p1, char p2, unsigned short p3, unsigned int p4, long p5, unsigned char p6) {
+    short v0 = 2;
+    short v1 = 736;
+    int i0 = 306280606644;
+    long j0 = 625522452238;
+    p3 = (333 != (!(5) || (p5 / 100)));
+    v0 = (!(237) + g1);
+    j0 = -(960550399559);
+    if (-(((p6 + p1) - (p0 + 716)))) {
+        for (p4 = 1; p4 < 17; p4 = p4 + 1) {
+            switch (g1) {
+            case 273:
+                if (((int)(g0) <= (704 == 5))) { break; }
+                break;
+            case 40:
+                if ((p0 < 83818593006)) { break; }
+            default:
+            case 36:
+                p1 = (short)((unsigned long)((0 / (p4 * p4 + 1))));
+                v0 = 526;
+                break;
+            case -3:
+                break;
+            case 63:
+                break;
+            case 56:
+                p5 = p5 + (65535 + (946 != 3));
+                if (v1) { break; }
+                break;
+            case 2:
+                break;
+            }
+        }
+        v1 = ((v1 + p3) * -(1));
+    }
+    j0 = (10 > (-(5) - (p2 <= 1)));
+    return g2;
+}
+void w0(int q0) {
+    g1 = g1 * 3 + q0;
+    g2 = g2 * 3 + q0;
+    g1 = g1 * 3 + q0;
+}
+unsigned short f1() {
+    unsigned int v0 = 6L;
+    long v1 = 965;
+    short v2 = 5L;
+    int i0 = 2147483647;
+    long j0 = 500;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 57; }
+    i0 = (la0[3] < (f0(v2, 2, 5, g0, 128, v2, g1) == 916));
+    switch (i0) {
+    case 7:
+        for (v1 = 1; v1 < 17; v1 = v1 + 1) {
+            if (g0 >= 0 && g0 < 8) { la0[g0] = 2; }
+        }
+    case 2:
+        break;
+    case 10:
+        la0[3] = ((8 && 1000000007) * (int)(5));
+        f0((i0 || v1), (7 || 2), !(v0), (g1 / 2), f0(v1, la0[2], 65536, i0, g1, 1086756433673, g1), (3 || j0), (i0 == v1));
+        break;
+    case 4:
+        f0((v1 > g2), (3 > v2), -(0), (424 || 3l), (i0 / 1), g1, 9);
+        if ((unsigned int)((2 + 7))) {
+            for (i0 = 1; i0 < 4; i0 = i0 + 1) {
+                v0 = (g2 || (370 < i0));
+            }
+            v2 = g0;
+        } else {
+            f0((v2 / (g2 * g2 + 1)), g1, (g0 - 3), f0(3, la0[6], j0, v2, g2, 485304079069, la0[6]), 6U, f0(79385246520, la0[5], g2, 1, 6, g2, j0), (g0 == 128));
+            switch (((0 / 8) && (1 < g0))) {
+            case 0:
+            case 5:
+                break;
+            case 9:
+                f0((g1 >= 2), v0, (75ul >= 2), 5, 10, i0, !(g0));
+                break;
+            default:
+                f0(-(7), (g0 / 16), (g0 > 36), (j0 + j0), (i0 < v2), 297, (3 >= g0));
+                break;
+            case 8:
+                f0(g2, 1075371980747, i0, f0(v0, 84U, i0, 199, g0, 925736145527, 10), (192 >= la0[1]), (4u || 6), !(1));
+                break;
+            case 3:
+                break;
+            }
+            if (2) { return (short)(10u); }
+        }
+        break;
+    case 0:
+        f0(6, (v1 + g0), (unsigned int)(g2), (char)(la0[1]), 3, (g0 != j0), j0);
+        break;
+    }
+    if (v1 >= 0 && v1 < 8) { la0[v1] = v1; }
+    v1 = (g0 == 892);
+    i0 = ((255 / (v0 * v0 + 1)) == (779L / 100));
+    return -(!((unsigned char)(g2)));
+}
+int main() {
+    int v0 = 10;
+    unsigned short v1 = 793l;
+    unsigned char v2 = 2;
+    unsigned char v3 = 4;
+    short v4 = 365;
+    int i0 = 816;
+    long j0 = 272;
+    g1 = 128;
+    g1 = f1();
+    v1 = !((v3 + (g1 + 9)));
+    g1 = f0(g2, (int)(0), g0, (944127323945 || 256), 0, -(7), f0(65536, 9, 2, 892, 1, g1, 10u));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,915 @@
+	.section .data
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.byte 3
+	.type g2, @object
+	.size g2, 4
+	.p2align 2
+g2:
+	.long 51
+	.section .bss
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.zero 1
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.global main
+	.type main, @function
+	.type f1, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movb %dl, -29(%rbp)
+	movq %r9, -8(%rbp)
+	movw $736, -26(%rbp)
+	movabsq $625522452238, %rax
+	movl $5, %eax
+	testl %eax, %eax
+	je .L0
+	movq %r9, %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L1
+.L0:
+	movl $1, %eax
+.L1:
+	cmpl $333, %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -28(%rbp)
+	movl $237, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movzbl g1(%rip), %ecx
+	addl %ecx, %eax
+	xorl %eax, %eax
+	movabsq $960550399559, %rcx
+	subq %rcx, %rax
+	movswl %di, %eax
+	addl $716, %eax
+	movq %rax, %rcx
+	movzbl 16(%rbp), %eax
+	addl %esi, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L2
+	movl $1, -24(%rbp)
+	movl $704, %eax
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	movswq %di, %rax
+	movabsq $83818593006, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	movl $946, %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	addl $65535, %eax
+	movl %eax, -12(%rbp)
+	cmpl $17, -24(%rbp)
+	jae .L5
+	.p2align 4,,10
+.L4:
+	movzbl g1(%rip), %eax
+	movslq %eax, %rax
+	cmpq $40, %rax
+	jge .L14
+	cmpq $-3, %rax
+	je .L6
+	cmpq $2, %rax
+	je .L6
+	cmpq $36, %rax
+.L18:
+.L19:
+.L9:
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movswl %ax, %eax
+.L6:
+	addl $1, -24(%rbp)
+	cmpl $17, -24(%rbp)
+	jb .L4
+.L5:
+	xorl %eax, %eax
+	subl $1, %eax
+	pushq %rax
+	movswl -26(%rbp), %eax
+	movzwl -28(%rbp), %ecx
+	addl %ecx, %eax
+	popq %rcx
+	imull %ecx, %eax
+.L2:
+.L3:
+	movsbl -29(%rbp), %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl $5, %eax
+	subl %ecx, %eax
+	cmpl $10, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl g2(%rip), %eax
+	leave
+	ret
+.L14:
+	cmpq $63, %rax
+	jge .L15
+	cmpq $40, %rax
+	je .L8
+	cmpq $56, %rax
+	je .L12
+	jmp .L9
+.L15:
+	cmpq $63, %rax
+	je .L6
+	cmpq $273, %rax
+	je .L7
+	jmp .L9
+.L10:
+	jmp .L6
+.L8:
+	cmpl $0, -16(%rbp)
+	je .L18
+	jmp .L6
+.L11:
+	jmp .L6
+.L13:
+	jmp .L6
+.L7:
+	movsbl g0(%rip), %eax
+	cmpl -20(%rbp), %eax
+	jg .L6
+	jmp .L6
+.L12:
+	movslq -12(%rbp), %rax
+	addq %rax, -8(%rbp)
+	cmpw $0, -26(%rbp)
+	je .L6
+	jmp .L6
+.L16:
+.L17:
+	jmp .L6
+.L20:
+.L21:
+	jmp .L6
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq %r8, -8(%rbp)
+	movw $736, -18(%rbp)
+	movabsq $625522452238, %rax
+	movq %r8, %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	cmpl $333, %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -20(%rbp)
+	movzbl g1(%rip), %eax
+	movabsq $-960550399559, %rax
+	movswl %di, %eax
+	addl $716, %eax
+	movq %rax, %rcx
+	movzbl %r9b, %eax
+	addl %esi, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L22
+	movl $1, -16(%rbp)
+	movswq %di, %rax
+	movabsq $83818593006, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+	cmpl $17, -16(%rbp)
+	jae .L25
+	.p2align 4,,10
+.L24:
+	movzbl g1(%rip), %eax
+	movslq %eax, %rax
+	cmpq $40, %rax
+	jge .L34
+	cmpq $-3, %rax
+	je .L26
+	cmpq $2, %rax
+	je .L26
+	cmpq $36, %rax
+.L38:
+.L39:
+.L29:
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movswl %ax, %eax
+.L26:
+	addl $1, -16(%rbp)
+	cmpl $17, -16(%rbp)
+	jb .L24
+.L25:
+	movswl -18(%rbp), %eax
+	movzwl -20(%rbp), %ecx
+	addl %ecx, %eax
+	imull $-1, %eax, %eax
+.L22:
+.L23:
+	movl g2(%rip), %eax
+	popq %rbp
+	ret
+.L34:
+	cmpq $63, %rax
+	jge .L35
+	cmpq $40, %rax
+	je .L28
+	cmpq $56, %rax
+	je .L32
+	jmp .L29
+.L35:
+	cmpq $63, %rax
+	je .L26
+	cmpq $273, %rax
+	je .L27
+	jmp .L29
+.L30:
+	jmp .L26
+.L28:
+	cmpl $0, -12(%rbp)
+	je .L38
+	jmp .L26
+.L31:
+	jmp .L26
+.L33:
+	jmp .L26
+.L27:
+	movsbl g0(%rip), %eax
+	testl %eax, %eax
+	jg .L26
+	jmp .L26
+.L32:
+	addq $65536, -8(%rbp)
+	cmpw $0, -18(%rbp)
+	je .L26
+	jmp .L26
+.L36:
+.L37:
+	jmp .L26
+.L40:
+.L41:
+	jmp .L26
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq %r8, -8(%rbp)
+	movw $736, -18(%rbp)
+	movabsq $625522452238, %rax
+	movq %r8, %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	cmpl $333, %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -20(%rbp)
+	movzbl g1(%rip), %eax
+	movabsq $-960550399559, %rax
+	movswl %di, %eax
+	addl $716, %eax
+	movq %rax, %rcx
+	movzbl %r9b, %eax
+	addl %esi, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L42
+	movl $1, -16(%rbp)
+	movswq %di, %rax
+	movabsq $83818593006, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+	cmpl $17, -16(%rbp)
+	jae .L45
+	.p2align 4,,10
+.L44:
+	movzbl g1(%rip), %eax
+	movslq %eax, %rax
+	cmpq $40, %rax
+	jge .L54
+	cmpq $-3, %rax
+	je .L46
+	cmpq $2, %rax
+	je .L46
+	cmpq $36, %rax
+.L58:
+.L59:
+.L49:
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movswl %ax, %eax
+.L46:
+	addl $1, -16(%rbp)
+	cmpl $17, -16(%rbp)
+	jb .L44
+.L45:
+	movswl -18(%rbp), %eax
+	movzwl -20(%rbp), %ecx
+	addl %ecx, %eax
+	imull $-1, %eax, %eax
+.L42:
+.L43:
+	movl g2(%rip), %eax
+	popq %rbp
+	ret
+.L54:
+	cmpq $63, %rax
+	jge .L55
+	cmpq $40, %rax
+	je .L48
+	cmpq $56, %rax
+	je .L52
+	jmp .L49
+.L55:
+	cmpq $63, %rax
+	je .L46
+	cmpq $273, %rax
+	je .L47
+	jmp .L49
+.L50:
+	jmp .L46
+.L48:
+	cmpl $0, -12(%rbp)
+	je .L58
+	jmp .L46
+.L51:
+	jmp .L46
+.L53:
+	jmp .L46
+.L47:
+	movsbl g0(%rip), %eax
+	testl %eax, %eax
+	jg .L46
+	jmp .L46
+.L52:
+	addq $65536, -8(%rbp)
+	cmpw $0, -18(%rbp)
+	je .L46
+	jmp .L46
+.L56:
+.L57:
+	jmp .L46
+.L60:
+.L61:
+	jmp .L46
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movl $10, -24(%rbp)
+	movb $2, -30(%rbp)
+	movb $4, -29(%rbp)
+	movw $365, -26(%rbp)
+	movl $816, -20(%rbp)
+	movq $272, -16(%rbp)
+	movb $128, g1(%rip)
+	call f1
+	movb %al, g1(%rip)
+	movzbl g1(%rip), %eax
+	addl $9, %eax
+	movq %rax, %rcx
+	movzbl -29(%rbp), %eax
+	addl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -28(%rbp)
+	subq $8, %rsp
+	movl $10, %eax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	movq %rax, %r9
+	movl $1, %eax
+	movq %rax, %r8
+	movl $892, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	xorl %eax, %eax
+	subl $7, %eax
+	movslq %eax, %rax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movabsq $944127323945, %rax
+	testq %rax, %rax
+	jne .L62
+	movl $256, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L63
+.L62:
+	movl $1, %eax
+.L63:
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl g2(%rip), %eax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movb %al, g1(%rip)
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq g2(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -24(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzwl -28(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl -30(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl -29(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movswq -26(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	leave
+	ret
+	.size main, .-main
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movl $6, -4(%rbp)
+	movq $965, -16(%rbp)
+	movw $5, -18(%rbp)
+	movl $2147483647, -24(%rbp)
+	movq $500, -32(%rbp)
+	movl $0, -24(%rbp)
+	movl $0, -64(%rbp)
+	movl $57, -60(%rbp)
+	movl $114, -56(%rbp)
+	movl $171, -52(%rbp)
+	movl $228, -48(%rbp)
+	movl $285, -44(%rbp)
+	movl $342, -40(%rbp)
+	movl $399, -36(%rbp)
+	movl $8, -24(%rbp)
+	movzbl g1(%rip), %eax
+	movq %rax, %r9
+	movswq -18(%rbp), %rax
+	movq %rax, %r8
+	movl $128, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movswl -18(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movsbl %al, %eax
+	cmpl $916, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L70
+	leaq .L71(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L64
+	# table target .L69
+	# table target .L66
+	# table target .L68
+	# table target .L65
+	# table target .L67
+	jmp *%rcx
+.L70:
+.L64:
+	cmpq $0, -16(%rbp)
+	jl .L92
+	cmpq $8, -16(%rbp)
+	jge .L92
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+.L92:
+.L93:
+	movsbl g0(%rip), %eax
+	cmpl $892, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $255, %eax
+	xorl %edx, %edx
+	divl %ecx
+	cmpq $7, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -24(%rbp)
+	movl g2(%rip), %eax
+	testb %al, %al
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L65:
+	movq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jge .L72
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -72(%rbp)
+	cmpq $0, -72(%rbp)
+	je .L75
+	.p2align 4,,10
+.L74:
+	movsbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L76
+	movsbl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L76
+	movsbq g0(%rip), %rax
+	movl $2, -64(%rbp,%rax,4)
+.L76:
+.L77:
+	addq $1, -16(%rbp)
+	movsbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L78
+	movsbl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L78
+	movsbq g0(%rip), %rax
+	movl $2, -64(%rbp,%rax,4)
+.L78:
+.L79:
+	addq $1, -16(%rbp)
+	subq $1, -72(%rbp)
+	jne .L74
+.L75:
+.L72:
+.L73:
+	cmpq $17, -16(%rbp)
+	jge .L64
+	.p2align 4,,10
+.L80:
+	movsbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L82
+	movsbl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L82
+	movsbq g0(%rip), %rax
+	movl $2, -64(%rbp,%rax,4)
+.L82:
+.L83:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L80
+.L81:
+.L66:
+	jmp .L64
+.L67:
+	movl $5, -52(%rbp)
+	subq $8, %rsp
+	movslq -24(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movzbl g1(%rip), %eax
+	movq %rax, %r9
+	movabsq $1086756433673, %rax
+	movq %rax, %r8
+	movzbl g1(%rip), %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	movq %rax, %rdx
+	movl -56(%rbp), %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $8, %rsp
+	movsbl %al, %eax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	pushq %rax
+	cmpl $0, -4(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	cmpl $0, -24(%rbp)
+	jne .L84
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L85
+.L84:
+	movl $1, %eax
+.L85:
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L64
+.L68:
+	subq $8, %rsp
+	movl $9, %eax
+	pushq %rax
+	movzbl g1(%rip), %eax
+	movq %rax, %r9
+	movl -24(%rbp), %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movswl -18(%rbp), %eax
+	cmpl $3, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movslq g2(%rip), %rax
+	cmpq %rax, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl $1, -24(%rbp)
+	cmpl $0, g2(%rip)
+	jne .L86
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L87
+.L86:
+	movl $1, %eax
+.L87:
+	movl %eax, -4(%rbp)
+	cmpl $0, g2(%rip)
+	jne .L88
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L89
+.L88:
+	movl $1, %eax
+.L89:
+	movl %eax, -4(%rbp)
+	cmpl $0, g2(%rip)
+	jne .L90
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L91
+.L90:
+	movl $1, %eax
+.L91:
+	movl %eax, -4(%rbp)
+	movl $4, -24(%rbp)
+	movsbl g0(%rip), %eax
+	movw %ax, -18(%rbp)
+	jmp .L64
+.L69:
+	subq $8, %rsp
+	movq -32(%rbp), %rax
+	pushq %rax
+	movsbq g0(%rip), %rax
+	cmpq -32(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl -60(%rbp), %eax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movl g2(%rip), %eax
+	movq %rax, %rdx
+	movsbq g0(%rip), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	jmp .L64
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L71:
+	.long .L69-.L71
+	.long .L64-.L71
+	.long .L66-.L71
+	.long .L64-.L71
+	.long .L68-.L71
+	.long .L64-.L71
+	.long .L64-.L71
+	.long .L65-.L71
+	.long .L64-.L71
+	.long .L64-.L71
+	.long .L67-.L71
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,263 @@
+int ga0[4];
+unsigned char f0(unsigned char p0, short p1, unsigned short p2, unsigned char p3) {
+    unsigned int v0 = 611;
+    char v1 = 1000000007;
+    int i0 = 5;
+    long j0 = 10;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 970; }
+    if (((v0 - p1) - ((ga0[0] > v1) + (p2 - j0)))) {
+        if ((((p1 - i0) <= (1 + ga0[3])) - ((576 / 5l) != (unsigned char)(128)))) {
+            i0 = v0;
+            p0 = v1;
+            i0 = i0;
+        }
+        j0 = 0;
+        while (j0 < 17) {
+            p2 = -(8);
+            j0 = j0 + 1;
+        }
+        p3 = p3 + (v0 > i0);
+    }
+    for (v0 = 0; v0 < 17; v0 = v0 + 1) {
+        for (p1 = 2; p1 < 100; p1 = p1 + 1) {
+            p2 = ((286087301072 && p1) || !(636U));
+            if (p3 >= 0 && p3 < 33) { la0[p3] = v1; }
+            if (v0 >= 0 && v0 < 8) { la1[v0] = (p2 <= (la0[0] == 2)); }
+        }
+        v1 = (128 > 986);
+        p0 = -(((5 / (v1 * v1 + 1)) && 433185023975));
+    }
+    j0 = (!(v0) * -(7));
+    v1 = (la1[3] || ((p2 >= v1) == (p3 < la1[2])));
+    p2 = -(5);
+    p0 = (!((short)(933456552910)) - ((p1 + p1) < (j0 - 9)));
+    v0 = v0 + (-(v0) < 0);
+    p0 = ((unsigned short)((8u - 4)) > !(j0));
+    return (int)(-((j0 + 0)));
+}
+char f1(long p0, unsigned short p1, long p2, unsigned int p3, short p4, unsigned int p5) {
+    unsigned long v0 = 2147483647;
+    short v1 = 3;
+    char v2 = 1;
+    long v3 = 792777312920;
+    short v4 = 3;
+    int v5 = 728158760873;
+    int i0 = 826189188831;
+    long j0 = 264;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 32767; }
+    p4 = f0(8, (v2 / (p2 * p2 + 1)), !(255ul), 10);
+    v3 = 110;
+    v5 = (p1 <= v4);
+    f0((p2 > i0), (v4 && 4), 2, (3 && 65535ul));
+    return ((!(j0) + f0(1, 5, v1, v1)) && !(v5));
+}
+int f2(unsigned short p0, unsigned short p1, unsigned int p2, char p3, short p4, long p5, unsigned long p6, unsigned char p7) {
+    short v0 = 8U;
+    int v1 = 901;
+    long v2 = 5L;
+    int v3 = 256;
+    int i0 = 304;
+    long j0 = 2u;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 65535; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 65535; }
+    if (0) {
+        p6 = 0;
+        while (p6 < 4) {
+            i0 = la1[0];
+            switch (p6) {
+            default:
+            case 803:
+                if (((310 / 10) || -(65536))) { break; }
+            case 5:
+                v3 = (ga0[3] * -(p5));
+                if (p0) { break; }
+                break;
+            case 647:
+                p0 = p0;
+                p5 = !(3);
+                break;
+            case 51:
+                break;
+            case -5:
+                if ((!(8) < 595122385515)) { break; }
+                j0 = 708405652294;
+                break;
+            case 2:
+                if (3) { break; }
+                if ((4 || p0)) { break; }
+            case 593:
+                if ((-(p3) || (5 / (p6 * p6 + 1)))) { break; }
+                la0[31] = ((6 < 236) <= v2);
+            case 656:
+                p3 = p3 + (!(9) / (p2 * p2 + 1));
+                if (111) { break; }
+                break;
+            }
+            la1[p6] = 3;
+            p6 = p6 + 1;
+        }
+        if ((6 == 137)) {
+            i0 = (v2 || ((7 / (p7 * p7 + 1)) - p5));
+        } else {
+            i0 = ((-(j0) != p4) > 626069974781);
+            f0(f0(7, 6, 2u, p1), v3, 3, la0[7]);
+            if ((p5 <= ((327623464696 && p3) / (p4 * p4 + 1)))) {
+                f0(f1(717, 9, 9, p3, la1[2], p1), 2, (p4 + ga0[0]), p7);
+            }
+        }
+        if ((((9 == 3) + (v1 - p4)) && (p5 - (i0 / (p1 * p1 + 1))))) {
+            i0 = j0;
+        } else {
+            if (p6 >= 0 && p6 < 4) { la1[p6] = f1(v1, v0, p4, p1, i0, ga0[2]); }
+            if (!(((p1 && p3) > (char)(v1)))) {
+                la1[0] = la0[22];
+                v0 = f1((j0 + 768), 2, (8 || 386503126972), (v1 / 1024), (v3 >= 127), p5);
+                la1[1] = ((p0 - 609L) < (1 * p7));
+            }
+            f0((7 && p3), -(v1), -(6), -(661071282967L));
+        }
+    }
+    if (p2 >= 0 && p2 < 4) { la1[p2] = ((unsigned short)(ga0[3]) / (v0 * v0 + 1)); }
+    if (f1((0 * p2), p4, (10L / (v3 * v3 + 1)), ga0[3], 919, ga0[1])) {
+        if (p1 >= 0 && p1 < 4) { la1[p1] = (f0(la0[3], 434, 9, 8) || 0); }
+    }
+    for (i0 = 1; i0 < 16; i0 = i0 + 1) {
+        p1 = (992024504030 && (f1(1, p2, 0, 2, 117ul, 2) == !(p5)));
+    }
+    return (((p6 / (p2 * p2 + 1)) - p1) - f1(p5, p5, v0, 607, j0, 519));
+}
+unsigned short f3(unsigned long p0, char p1, long p2, short p3, unsigned short p4) {
+    unsigned short v0 = 255;
+    unsigned short v1 = 584513520310;
+    int i0 = 542;
+    long j0 = 171;
+    if ((unsigned long)((4 && (p1 / (v0 * v0 + 1))))) {
+        p1 = ((2 == 133) < (int)(ga0[3]));
+    }
+    v1 = -(v0);
+    i0 = !((f2(j0, 516, p0, p2, 256, p1, 0, v0) / 1024));
+    if (f2(1, (ga0[2] > 977800939451), (299128171295 / (v0 * v0 + 1)), !(3), !(9), (char)(2), 10, (9 + v0))) {
+        for (p3 = 0; p3 < 3; p3 = p3 + 1) {
+            v1 = f1(1, (p2 < p1), 6, (short)(p0), -(333), 228);
+            if (f0(f2(p1, 496638069670, p2, p4, 4294967295, p2, i0, 363972325971), (i0 + 722620006283), f2(7, p3, 8, 185, p3, p3, p0, v0), !(4))) {
+                v0 = (f0(p1, 4ul, 977, p3) * v1);
+                p0 = ((8 || (p0 && v1)) / 100);
+                p4 = ((long)(584) <= (p4 >= 689));
+            } else {
+                j0 = (p4 >= 883);
+            }
+            v1 = v1 + (65535 / (v1 * v1 + 1));
+        }
+        if (ga0[3]) {
+            if (((888u * v1) < j0)) {
+                if (ga0[3]) { return (!(p3) / (v1 * v1 + 1)); }
+            } else {
+                f0(65535, v0, (8 / (v1 * v1 + 1)), !(p1));
+                f2(f1(9, 7, 32767, 380788014051, p2, v1), (ga0[2] * p2), p3, !(663), (p4 <= ga0[2]), f1(703, ga0[2], 10, 7, 948602121858, 3), 333, 21);
+                f2(1, (short)(p3), (65535 == p0), (764 < 255), (1 || ga0[1]), i0, i0, p3);
+            }
+            if ((char)((432 <= p2))) {
+                i0 = (((10 + 588u) != f0(ga0[0], ga0[3], 2, i0)) * ((p0 - 6) || -(p1)));
+                f0((6 + p0), -(981), (2 > v1), (1 < j0));
+            }
+        } else {
+            v1 = v1 + -((10 * v0));
+            p3 = 0;
+            while (p3 < 3) {
+                if ((j0 + p2)) { break; }
+                p3 = p3 + 1;
+            }
+        }
+    }
+    p0 = 0;
+    while (p0 < 16) {
+        if ((short)(!((v0 * 9)))) {
+            if ((994 && 237)) {
+                if (((3 != v0) - p3)) { break; }
+                if (((p2 / (p2 * p2 + 1)) || (ga0[3] >= i0))) { break; }
+                f1((4 / (p1 * p1 + 1)), (short)(v0), ga0[3], v1, f2(599, p3, p4, p2, 0, v1, ga0[1], 2L), (char)(ga0[1]));
+            }
+            if ((!((j0 / 100)) != ((852 != ga0[3]) == v1))) {
+                if (((ga0[1] <= ga0[1]) <= (ga0[3] && ga0[1]))) { break; }
+            } else {
+                p1 = (unsigned short)(((703 * j0) == f1(i0, 1, 632, 257, p2, 7)));
+                v0 = (f2(532, p4, p4, p0, 47965818369, p3, p3, 6) != (p0 + 602283612104));
+                if (!(569611412027U)) { break; }
+            }
+        }
+        p0 = p0 + 1;
+    }
+    if ((v0 / 7)) {
+        v0 = 10;
+        i0 = 0;
+        while (i0 < 5) {
+            if ((1 && 32767u)) { return ((118 - j0) < 422); }
+            p3 = (unsigned int)((long)((7 || 7)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((f2(65536u, 6, v1, 309, ga0[0], v1, 128, 749) / 5l)) {
+        if (((1088528470819 / (p0 * p0 + 1)) == 2)) {
+            p2 = 2;
+        }
+        i0 = ((char)(f1(p4, p1, 41, 65535, 695, v0)) + (v0 <= (720 == 3)));
+    }
+    return 1042569379684;
+}
+int main() {
+    short v0 = 225971389233;
+    unsigned short v1 = 5;
+    char v2 = 256;
+    short v3 = 562;
+    unsigned int v4 = 1;
+    short v5 = 315;
+    int i0 = 1022731100147;
+    long j0 = 586L;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 66; }
+    switch (((la0[9] - 10) / (v1 * v1 + 1))) {
+    default:
+        if (969) { return (!(i0) || (271 == v2)); }
+        break;
+    case 16:
+    case 382:
+        f0((unsigned int)(v5), (v5 && v5), ga0[2], (v1 > v3));
+        if (2147483647) {
+            for (v0 = 0; v0 < 3; v0 = v0 + 1) {
+                v2 = 2147483647;
+            }
+        }
+        break;
+    case 69:
+        break;
+    }
+    f3((short)(v2), (4294967295 != la0[7]), (unsigned char)(4), (v3 - 7), (unsigned char)(6));
+    v4 = (unsigned short)((6 >= (unsigned char)(v0)));
+    i0 = ((v0 != (v1 && i0)) / (v4 * v4 + 1));
+    if ((!((v1 > v2)) == (unsigned char)(4))) {
+        v0 = (!(la0[7]) >= (311897891555 != (short)(j0)));
+    } else {
+        v5 = (((short)(v4) / (v4 * v4 + 1)) - !(710));
+        j0 = (((630 > la0[5]) * 565) >= ((i0 == 1) + (la0[15] + v5)));
+        j0 = j0 + f3(974, 171, 8, la0[10], v1);
+    }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2872 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.section .text
+	.type f1.constprop.2, @function
+	.type f0, @function
+	.type f1, @function
+	.type f1.constprop.0, @function
+	.type f1.constprop.1, @function
+	.type f1.constprop.3, @function
+	.type f2, @function
+	.type f2.constprop.4, @function
+	.type f3, @function
+	.global main
+	.type main, @function
+	.align 16
+f1.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movq $2147483647, -16(%rbp)
+	movw $3, -18(%rbp)
+	movb $1, -19(%rbp)
+	movabsq $792777312920, %rax
+	movq %rax, -32(%rbp)
+	movw $3, -34(%rbp)
+	movl $-1985679447, -40(%rbp)
+	movl $1555467999, -44(%rbp)
+	movq $264, -56(%rbp)
+	movl $0, -44(%rbp)
+	imull $32767, -44(%rbp), %eax
+	subl $32767, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	addl $32767, -132(%rbp)
+	movslq -44(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $32767, -132(%rbp)
+	movslq -44(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $32767, -132(%rbp)
+	movslq -44(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $32767, -132(%rbp)
+	movslq -44(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -144(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -44(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $32767, -132(%rbp)
+	movslq -44(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L4
+.L5:
+	movl $10, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movsbq -19(%rbp), %rax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	movq $110, -32(%rbp)
+	movzwl -2(%rbp), %eax
+	movswl -34(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	movl $1, %eax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	cmpw $0, -34(%rbp)
+	je .L6
+	movl $4, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L7
+.L6:
+	movl $0, %eax
+.L7:
+	movq %rax, %rsi
+	movslq -44(%rbp), %rax
+	testq %rax, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movswl -18(%rbp), %eax
+	movq %rax, %rcx
+	movswl -18(%rbp), %eax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L8
+	cmpl $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .f1.constprop.2_return
+.L8:
+	movl $0, %eax
+.L9:
+.f1.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1.constprop.2, .-f1.constprop.2
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movb %dil, -1(%rbp)
+	movw %si, -4(%rbp)
+	movw %dx, -6(%rbp)
+	movb %cl, -7(%rbp)
+	movl $611, -12(%rbp)
+	movb $7, -13(%rbp)
+	movl $5, -20(%rbp)
+	movq $10, -32(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jge .L10
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L11
+	.p2align 4,,10
+.L12:
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -184(%rbp)
+	jne .L12
+.L13:
+.L10:
+.L11:
+	cmpl $33, -20(%rbp)
+	jge .L15
+	.p2align 4,,10
+.L14:
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L14
+.L15:
+	movl $0, -20(%rbp)
+	movl $0, -224(%rbp)
+	movl $970, -220(%rbp)
+	movl $1940, -216(%rbp)
+	movl $2910, -212(%rbp)
+	movl $3880, -208(%rbp)
+	movl $4850, -204(%rbp)
+	movl $5820, -200(%rbp)
+	movl $6790, -196(%rbp)
+	movl $8, -20(%rbp)
+	movzwl -6(%rbp), %eax
+	subq -32(%rbp), %rax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	movsbl -13(%rbp), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	addq %rcx, %rax
+	pushq %rax
+	movl -12(%rbp), %eax
+	movswl -4(%rbp), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	subq %rcx, %rax
+	je .L16
+	movl ga0+12(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movswl -4(%rbp), %eax
+	subl -20(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	subl $1, %eax
+	je .L18
+	movl -12(%rbp), %eax
+	movl %eax, -20(%rbp)
+	movsbl -13(%rbp), %eax
+	movb %al, -1(%rbp)
+.L18:
+.L19:
+	movq $0, -32(%rbp)
+	movl $-8, -228(%rbp)
+	cmpq $17, -32(%rbp)
+	jge .L20
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L21
+	.p2align 4,,10
+.L22:
+	movl -228(%rbp), %eax
+	movw %ax, -6(%rbp)
+	addq $1, -32(%rbp)
+	movzwl -6(%rbp), %eax
+	movw %ax, -6(%rbp)
+	addq $1, -32(%rbp)
+	movzwl -6(%rbp), %eax
+	movw %ax, -6(%rbp)
+	addq $1, -32(%rbp)
+	movzwl -6(%rbp), %eax
+	movw %ax, -6(%rbp)
+	addq $1, -32(%rbp)
+	subq $1, -240(%rbp)
+	jne .L22
+.L23:
+.L20:
+.L21:
+	cmpq $17, -32(%rbp)
+	jge .L25
+	.p2align 4,,10
+.L24:
+	movl -228(%rbp), %eax
+	movw %ax, -6(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $17, -32(%rbp)
+	jl .L24
+.L25:
+	movl -20(%rbp), %eax
+	cmpl %eax, -12(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -7(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -7(%rbp)
+.L16:
+.L17:
+	movl $0, -12(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -248(%rbp)
+	testl %eax, %eax
+	jl .L26
+	cmpl $33, -248(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L27
+.L26:
+	movl $0, %eax
+.L27:
+	movl %eax, -244(%rbp)
+	movl $0, -252(%rbp)
+	cmpl $17, -12(%rbp)
+	jae .L29
+	.p2align 4,,10
+.L28:
+	movw $2, -4(%rbp)
+	movl -244(%rbp), %eax
+	movl %eax, -256(%rbp)
+	cmpl $0, -12(%rbp)
+	jb .L30
+	cmpl $8, -12(%rbp)
+	setb %al
+	movzbl %al, %eax
+	jmp .L31
+.L30:
+	movl $0, %eax
+.L31:
+	movl %eax, -260(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -264(%rbp)
+	cmpl $100, %eax
+	jge .L33
+	.p2align 4,,10
+.L32:
+	cmpw $0, -4(%rbp)
+	jne .L34
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L35
+.L34:
+	movl $1, %eax
+.L35:
+	movw %ax, -6(%rbp)
+	cmpl $0, -256(%rbp)
+	je .L36
+	movzbl -7(%rbp), %eax
+	movsbl -13(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+.L36:
+.L37:
+	cmpl $0, -260(%rbp)
+	je .L38
+	movl -176(%rbp), %eax
+	cmpl $2, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -6(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	movl %ecx, -224(%rbp,%rax,4)
+.L38:
+.L39:
+	movl -264(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -264(%rbp)
+	cmpl $100, %eax
+	jl .L32
+.L33:
+	movl -252(%rbp), %eax
+	movb %al, -13(%rbp)
+	movsbl -13(%rbp), %eax
+	movl %eax, -268(%rbp)
+	imull -268(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L40
+	movabsq $433185023975, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L41
+.L40:
+	movl $0, %eax
+.L41:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -1(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $17, -12(%rbp)
+	jb .L28
+.L29:
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	imull $-7, %eax, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl -212(%rbp), %eax
+	testl %eax, %eax
+	jne .L42
+	movl -216(%rbp), %eax
+	cmpl %eax, -248(%rbp)
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movzwl -6(%rbp), %eax
+	movsbl -13(%rbp), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L43
+.L42:
+	movl $1, %eax
+.L43:
+	movb %al, -13(%rbp)
+	movw $65531, -6(%rbp)
+	movq -32(%rbp), %rax
+	subq $9, %rax
+	movq %rax, %rcx
+	movswl -4(%rbp), %eax
+	movl %eax, -272(%rbp)
+	addl -272(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -1(%rbp)
+	xorl %eax, %eax
+	subl -12(%rbp), %eax
+	testl %eax, %eax
+	setb %al
+	movzbl %al, %eax
+	addl %eax, -12(%rbp)
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	setl %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movq %rdi, -8(%rbp)
+	movw %si, -10(%rbp)
+	movq %rdx, -24(%rbp)
+	movl %ecx, -28(%rbp)
+	movw %r8w, -30(%rbp)
+	movl %r9d, -36(%rbp)
+	movq $2147483647, -48(%rbp)
+	movw $3, -50(%rbp)
+	movb $1, -51(%rbp)
+	movabsq $792777312920, %rax
+	movq %rax, -64(%rbp)
+	movw $3, -66(%rbp)
+	movl $-1985679447, -72(%rbp)
+	movl $1555467999, -76(%rbp)
+	movq $264, -88(%rbp)
+	movl $0, -76(%rbp)
+	imull $32767, -76(%rbp), %eax
+	subl $32767, %eax
+	movl %eax, -164(%rbp)
+	cmpl $16, -76(%rbp)
+	jge .L44
+	movl $16, %eax
+	movslq -76(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L45
+	.p2align 4,,10
+.L46:
+	addl $32767, -164(%rbp)
+	movslq -76(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	addl $32767, -164(%rbp)
+	movslq -76(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	addl $32767, -164(%rbp)
+	movslq -76(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	addl $32767, -164(%rbp)
+	movslq -76(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	subq $1, -176(%rbp)
+	jne .L46
+.L47:
+.L44:
+.L45:
+	cmpl $16, -76(%rbp)
+	jge .L49
+	.p2align 4,,10
+.L48:
+	addl $32767, -164(%rbp)
+	movslq -76(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -76(%rbp)
+	cmpl $16, -76(%rbp)
+	jl .L48
+.L49:
+	movl $10, %eax
+	pushq %rax
+	movl $255, %eax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbq -51(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movzbl %al, %eax
+	movw %ax, -30(%rbp)
+	movq $110, -64(%rbp)
+	movzwl -10(%rbp), %eax
+	movswl -66(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -72(%rbp)
+	movl $3, %eax
+	testl %eax, %eax
+	je .L50
+	movl $65535, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L51
+.L50:
+	movl $0, %eax
+.L51:
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	cmpw $0, -66(%rbp)
+	je .L52
+	movl $4, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L53
+.L52:
+	movl $0, %eax
+.L53:
+	movq %rax, %rsi
+	movslq -76(%rbp), %rax
+	cmpq %rax, -24(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movswl -50(%rbp), %eax
+	movq %rax, %rcx
+	movswl -50(%rbp), %eax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -88(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L54
+	cmpl $0, -72(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .f1_return
+.L54:
+	movl $0, %eax
+.L55:
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1, .-f1
+	.align 16
+f1.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movl %edx, -12(%rbp)
+	movq $2147483647, -24(%rbp)
+	movw $3, -26(%rbp)
+	movb $1, -27(%rbp)
+	movabsq $792777312920, %rax
+	movq %rax, -40(%rbp)
+	movw $3, -42(%rbp)
+	movl $-1985679447, -48(%rbp)
+	movl $1555467999, -52(%rbp)
+	movq $264, -64(%rbp)
+	movl $0, -52(%rbp)
+	imull $32767, -52(%rbp), %eax
+	subl $32767, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L56
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L57
+	.p2align 4,,10
+.L58:
+	addl $32767, -132(%rbp)
+	movslq -52(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	addl $32767, -132(%rbp)
+	movslq -52(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	addl $32767, -132(%rbp)
+	movslq -52(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	addl $32767, -132(%rbp)
+	movslq -52(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -144(%rbp)
+	jne .L58
+.L59:
+.L56:
+.L57:
+	cmpl $16, -52(%rbp)
+	jge .L61
+	.p2align 4,,10
+.L60:
+	addl $32767, -132(%rbp)
+	movslq -52(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L60
+.L61:
+	movl $10, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movsbq -27(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7198729394618361607, %rdx
+	imulq %rdx
+	sarq $5, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movzbl %al, %eax
+	movw %ax, -6(%rbp)
+	movq $110, -40(%rbp)
+	movswl -42(%rbp), %eax
+	cmpl $9, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -48(%rbp)
+	movl $1, %eax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	cmpw $0, -42(%rbp)
+	je .L62
+	movl $4, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L63
+.L62:
+	movl $0, %eax
+.L63:
+	movq %rax, %rsi
+	movslq -52(%rbp), %rax
+	cmpq $9, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movswl -26(%rbp), %eax
+	movq %rax, %rcx
+	movswl -26(%rbp), %eax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L64
+	cmpl $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .f1.constprop.0_return
+.L64:
+	movl $0, %eax
+.L65:
+.f1.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1.constprop.0, .-f1.constprop.0
+	.align 16
+f1.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movw %dx, -14(%rbp)
+	movl %ecx, -20(%rbp)
+	movq $2147483647, -32(%rbp)
+	movw $3, -34(%rbp)
+	movb $1, -35(%rbp)
+	movabsq $792777312920, %rax
+	movq %rax, -48(%rbp)
+	movw $3, -50(%rbp)
+	movl $-1985679447, -56(%rbp)
+	movl $1555467999, -60(%rbp)
+	movq $264, -72(%rbp)
+	movl $0, -60(%rbp)
+	imull $32767, -60(%rbp), %eax
+	subl $32767, %eax
+	movl %eax, -148(%rbp)
+	cmpl $16, -60(%rbp)
+	jge .L66
+	movl $16, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L67
+	.p2align 4,,10
+.L68:
+	addl $32767, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $32767, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $32767, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $32767, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	subq $1, -160(%rbp)
+	jne .L68
+.L69:
+.L66:
+.L67:
+	cmpl $16, -60(%rbp)
+	jge .L71
+	.p2align 4,,10
+.L70:
+	addl $32767, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	cmpl $16, -60(%rbp)
+	jl .L70
+.L71:
+	movl $10, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movsbq -35(%rbp), %rax
+	leaq 1(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $1, %rcx
+	movq %rcx, %rax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	popq %rcx
+	call f0
+	movzbl %al, %eax
+	movw %ax, -14(%rbp)
+	movq $110, -48(%rbp)
+	movswl -50(%rbp), %eax
+	cmpl $2, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	movl $1, %eax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	cmpw $0, -50(%rbp)
+	je .L72
+	movl $4, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L73
+.L72:
+	movl $0, %eax
+.L73:
+	movq %rax, %rsi
+	movslq -60(%rbp), %rax
+	cmpq $1, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movswl -34(%rbp), %eax
+	movq %rax, %rcx
+	movswl -34(%rbp), %eax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -72(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L74
+	cmpl $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .f1.constprop.1_return
+.L74:
+	movl $0, %eax
+.L75:
+.f1.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1.constprop.1, .-f1.constprop.1
+	.align 16
+f1.constprop.3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rdi, -8(%rbp)
+	movw %si, -10(%rbp)
+	movq %rdx, -24(%rbp)
+	movw %cx, -26(%rbp)
+	movq $2147483647, -40(%rbp)
+	movw $3, -42(%rbp)
+	movb $1, -43(%rbp)
+	movabsq $792777312920, %rax
+	movq %rax, -56(%rbp)
+	movw $3, -58(%rbp)
+	movl $-1985679447, -64(%rbp)
+	movl $1555467999, -68(%rbp)
+	movq $264, -80(%rbp)
+	movl $0, -68(%rbp)
+	imull $32767, -68(%rbp), %eax
+	subl $32767, %eax
+	movl %eax, -148(%rbp)
+	cmpl $16, -68(%rbp)
+	jge .L76
+	movl $16, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L77
+	.p2align 4,,10
+.L78:
+	addl $32767, -148(%rbp)
+	movslq -68(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $32767, -148(%rbp)
+	movslq -68(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $32767, -148(%rbp)
+	movslq -68(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $32767, -148(%rbp)
+	movslq -68(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -160(%rbp)
+	jne .L78
+.L79:
+.L76:
+.L77:
+	cmpl $16, -68(%rbp)
+	jge .L81
+	.p2align 4,,10
+.L80:
+	addl $32767, -148(%rbp)
+	movslq -68(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $16, -68(%rbp)
+	jl .L80
+.L81:
+	movl $10, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbq -43(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movzbl %al, %eax
+	movw %ax, -26(%rbp)
+	movq $110, -56(%rbp)
+	movzwl -10(%rbp), %eax
+	movswl -58(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	movl $1, %eax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	cmpw $0, -58(%rbp)
+	je .L82
+	movl $4, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L83
+.L82:
+	movl $0, %eax
+.L83:
+	movq %rax, %rsi
+	movslq -68(%rbp), %rax
+	cmpq %rax, -24(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movswl -42(%rbp), %eax
+	movq %rax, %rcx
+	movswl -42(%rbp), %eax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -80(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L84
+	cmpl $0, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .f1.constprop.3_return
+.L84:
+	movl $0, %eax
+.L85:
+.f1.constprop.3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1.constprop.3, .-f1.constprop.3
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movl %edx, -8(%rbp)
+	movb %cl, -9(%rbp)
+	movw %r8w, -12(%rbp)
+	movq %r9, -24(%rbp)
+	movw $8, -26(%rbp)
+	movl $901, -32(%rbp)
+	movq $5, -40(%rbp)
+	movl $256, -44(%rbp)
+	movl $304, -48(%rbp)
+	movq $2, -56(%rbp)
+	movl $0, -48(%rbp)
+	imull $65535, -48(%rbp), %eax
+	subl $65535, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -48(%rbp)
+	jge .L86
+	movl $33, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L87
+	.p2align 4,,10
+.L88:
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -208(%rbp)
+	jne .L88
+.L89:
+.L86:
+.L87:
+	cmpl $33, -48(%rbp)
+	jge .L91
+	.p2align 4,,10
+.L90:
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $33, -48(%rbp)
+	jl .L90
+.L91:
+	movl $0, -48(%rbp)
+	movl $0, -224(%rbp)
+	movl $65535, -220(%rbp)
+	movl $131070, -216(%rbp)
+	movl $196605, -212(%rbp)
+	movl $4, -48(%rbp)
+	cmpl $0, -8(%rbp)
+	jb .L92
+	cmpl $4, -8(%rbp)
+	jae .L92
+	movswl -26(%rbp), %eax
+	movl %eax, -228(%rbp)
+	imull -228(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movzwl %ax, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movl %ecx, -224(%rbp,%rax,4)
+.L92:
+.L93:
+	movl ga0+4(%rip), %eax
+	pushq %rax
+	movl $919, %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	pushq %rax
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $10, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rdx
+	movswl -12(%rbp), %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	testb %al, %al
+	je .L94
+	movzwl -4(%rbp), %eax
+	movl %eax, -232(%rbp)
+	testl %eax, %eax
+	jl .L95
+	cmpl $4, -232(%rbp)
+	jge .L95
+	movl $8, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl $434, %eax
+	movq %rax, %rsi
+	movl -180(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testb %al, %al
+	jne .L98
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L99
+.L98:
+	movl $1, %eax
+.L99:
+	movq %rax, %rcx
+	movzwl -4(%rbp), %eax
+	movl %ecx, -224(%rbp,%rax,4)
+.L96:
+.L97:
+.L94:
+.L95:
+	movl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jge .L100
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L101
+	.p2align 4,,10
+.L102:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movw %ax, -242(%rbp)
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movzwl -242(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movzwl -242(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movzwl -242(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	subq $1, -240(%rbp)
+	jne .L102
+.L103:
+.L100:
+.L101:
+	cmpl $16, -48(%rbp)
+	jge .L105
+	.p2align 4,,10
+.L104:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L104
+.L105:
+	movq -56(%rbp), %rax
+	movq %rax, %rcx
+	movswq -26(%rbp), %rax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f1.constprop.3
+	movsbq %al, %rax
+	pushq %rax
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movq 16(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	movzwl -4(%rbp), %ecx
+	subq %rcx, %rax
+	popq %rcx
+	subq %rcx, %rax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f2, .-f2
+	.align 16
+f2.constprop.4:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movw %di, -2(%rbp)
+	movw %si, -4(%rbp)
+	movl %edx, -8(%rbp)
+	movb %cl, -9(%rbp)
+	movq %r8, -24(%rbp)
+	movb %r9b, -25(%rbp)
+	movw $8, -28(%rbp)
+	movl $901, -32(%rbp)
+	movq $5, -40(%rbp)
+	movl $256, -44(%rbp)
+	movl $304, -48(%rbp)
+	movq $2, -56(%rbp)
+	movl $0, -48(%rbp)
+	imull $65535, -48(%rbp), %eax
+	subl $65535, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -48(%rbp)
+	jge .L106
+	movl $33, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L107
+	.p2align 4,,10
+.L108:
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -208(%rbp)
+	jne .L108
+.L109:
+.L106:
+.L107:
+	cmpl $33, -48(%rbp)
+	jge .L111
+	.p2align 4,,10
+.L110:
+	addl $65535, -196(%rbp)
+	movslq -48(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $33, -48(%rbp)
+	jl .L110
+.L111:
+	movl $0, -48(%rbp)
+	movl $0, -224(%rbp)
+	movl $65535, -220(%rbp)
+	movl $131070, -216(%rbp)
+	movl $196605, -212(%rbp)
+	movl $4, -48(%rbp)
+	cmpl $0, -8(%rbp)
+	jb .L112
+	cmpl $4, -8(%rbp)
+	jae .L112
+	movswl -28(%rbp), %eax
+	movl %eax, -228(%rbp)
+	imull -228(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movzwl %ax, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movl %ecx, -224(%rbp,%rax,4)
+.L112:
+.L113:
+	movl ga0+4(%rip), %eax
+	pushq %rax
+	movl $919, %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	pushq %rax
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $10, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rdx
+	movl $256, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	testb %al, %al
+	je .L114
+	movzwl -4(%rbp), %eax
+	movl %eax, -232(%rbp)
+	testl %eax, %eax
+	jl .L115
+	cmpl $4, -232(%rbp)
+	jge .L115
+	movl $8, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl $434, %eax
+	movq %rax, %rsi
+	movl -180(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testb %al, %al
+	jne .L118
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L119
+.L118:
+	movl $1, %eax
+.L119:
+	movq %rax, %rcx
+	movzwl -4(%rbp), %eax
+	movl %ecx, -224(%rbp,%rax,4)
+.L116:
+.L117:
+.L114:
+.L115:
+	movl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jge .L120
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L121
+	.p2align 4,,10
+.L122:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movw %ax, -242(%rbp)
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movzwl -242(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movzwl -242(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movzwl -242(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	subq $1, -240(%rbp)
+	jne .L122
+.L123:
+.L120:
+.L121:
+	cmpl $16, -48(%rbp)
+	jge .L125
+	.p2align 4,,10
+.L124:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $117, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L124
+.L125:
+	movq -56(%rbp), %rax
+	movq %rax, %rcx
+	movswq -28(%rbp), %rax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f1.constprop.3
+	movsbq %al, %rax
+	pushq %rax
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movzwl -4(%rbp), %ecx
+	subq %rcx, %rax
+	popq %rcx
+	subq %rcx, %rax
+.f2.constprop.4_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f2.constprop.4, .-f2.constprop.4
+	.align 16
+f3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq %rdi, -56(%rbp)
+	movb %sil, -78(%rbp)
+	movq %rdx, -48(%rbp)
+	movw %cx, -76(%rbp)
+	movw %r8w, -74(%rbp)
+	movw $255, -72(%rbp)
+	movq $171, -40(%rbp)
+	movzwl -72(%rbp), %eax
+	movl %eax, -16(%rbp)
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl %sil, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L126
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	setg %al
+	movzbl %al, %eax
+	movb %al, -78(%rbp)
+.L126:
+.L127:
+	xorl %eax, %eax
+	subl -16(%rbp), %eax
+	movw %ax, -70(%rbp)
+	movzwl -72(%rbp), %eax
+	movq %rax, %r9
+	movsbq -78(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq %rax, %r8
+	movq -48(%rbp), %rax
+	movb %al, -77(%rbp)
+	movq %rax, %rcx
+	movq %rdi, %rax
+	movq %rax, %rdx
+	movl $516, %eax
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f2.constprop.4
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -68(%rbp)
+	movl -16(%rbp), %eax
+	addl $9, %eax
+	pushq %rax
+	movl $10, %eax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $299128171295, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rdx
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movabsq $977800939451, %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f2
+	addq $16, %rsp
+	testl %eax, %eax
+	je .L128
+	movw $0, -76(%rbp)
+	movq -48(%rbp), %rax
+	cmpq -8(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	movl $-333, -60(%rbp)
+	movslq -68(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movabsq $722620006283, %rcx
+	addq %rcx, %rax
+	movq %rax, -32(%rbp)
+	movswl -76(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $3, %eax
+	jge .L131
+	.p2align 4,,10
+.L130:
+	movl $228, %eax
+	movq %rax, %r9
+	movl -60(%rbp), %eax
+	movq %rax, %r8
+	movq -56(%rbp), %rax
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl -64(%rbp), %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f1
+	movsbl %al, %eax
+	movw %ax, -70(%rbp)
+	xorl %eax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movzwl -72(%rbp), %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	pushq %rax
+	movswq -76(%rbp), %rax
+	movq %rax, %r9
+	movswl -76(%rbp), %eax
+	movq %rax, %r8
+	movl $-71, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movswl -76(%rbp), %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f2
+	addq $24, %rsp
+	pushq %rax
+	movq -32(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $83, %eax
+	pushq %rax
+	movslq -68(%rbp), %rax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movq %rax, %r9
+	movl $-1, %eax
+	movq %rax, %r8
+	movzwl -74(%rbp), %eax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	movq %rax, %rdx
+	movl $35750, %eax
+	movq %rax, %rsi
+	movsbl -78(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	call f0
+	testb %al, %al
+	je .L132
+	movswl -76(%rbp), %eax
+	movq %rax, %rcx
+	movl $977, %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movsbl -78(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movzwl -70(%rbp), %ecx
+	imull %ecx, %eax
+	movw %ax, -72(%rbp)
+	movq $0, -56(%rbp)
+	movzwl -74(%rbp), %eax
+	cmpl $689, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $584, %rax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -74(%rbp)
+	jmp .L133
+.L132:
+	movzwl -74(%rbp), %eax
+	cmpl $883, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L133:
+	movzwl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $65535, %eax
+	cltd
+	idivl %ecx
+	addl -8(%rbp), %eax
+	movw %ax, -70(%rbp)
+	movl -16(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -76(%rbp)
+	movswl -76(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $3, %eax
+	jl .L130
+.L131:
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	je .L134
+	movzwl -70(%rbp), %eax
+	movl %eax, -16(%rbp)
+	imull $888, %eax, %eax
+	cmpq -40(%rbp), %rax
+	jge .L136
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	jne .LB0
+.L138:
+.L139:
+	jmp .L137
+.L134:
+	movzwl -72(%rbp), %eax
+	imull $10, %eax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzwl -70(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -70(%rbp)
+	movw $0, -76(%rbp)
+	movq -40(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movswl -76(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, %eax
+	jge .L145
+	.p2align 4,,10
+.L144:
+	cmpq $0, -16(%rbp)
+	je .L146
+.L145:
+.L135:
+.L128:
+.L129:
+	movq $0, -56(%rbp)
+	movl $1, -60(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -32(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -24(%rbp)
+	imulq $703, -40(%rbp), %rax
+	movq %rax, -16(%rbp)
+	cmpq $16, -56(%rbp)
+	jae .L149
+	.p2align 4,,10
+.L148:
+	movzwl -72(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull $9, %eax, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	je .L150
+	cmpl $0, -60(%rbp)
+	je .L152
+	cmpl $3, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movswl -76(%rbp), %ecx
+	subl %ecx, %eax
+	je .L154
+.L149:
+	movzwl -72(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L165
+	movw $10, -72(%rbp)
+	movl $1, -24(%rbp)
+	movl $118, %eax
+	subq -40(%rbp), %rax
+	cmpq $422, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	movl $1, -8(%rbp)
+	cmpl $0, -24(%rbp)
+	jne .LB1
+.L167:
+.L168:
+	movslq -8(%rbp), %rax
+	movw %ax, -76(%rbp)
+	cmpl $0, -24(%rbp)
+	jne .LB2
+.L169:
+.L170:
+	movswl -76(%rbp), %eax
+	movw %ax, -76(%rbp)
+	cmpl $0, -24(%rbp)
+	jne .LB3
+.L171:
+.L172:
+	movswl -76(%rbp), %eax
+	movw %ax, -76(%rbp)
+	cmpl $0, -24(%rbp)
+	jne .LB4
+.L173:
+.L174:
+	movswl -76(%rbp), %eax
+	movw %ax, -76(%rbp)
+	cmpl $0, -24(%rbp)
+	jne .LB5
+.L175:
+.L176:
+	movswl -76(%rbp), %eax
+.L165:
+.L166:
+	movl $237, %eax
+	pushq %rax
+	movl $128, %eax
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	movq %rax, %r9
+	movl ga0+0(%rip), %eax
+	movq %rax, %r8
+	movl $53, %eax
+	movq %rax, %rcx
+	movzwl -70(%rbp), %eax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	je .L177
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movabsq $1088528470819, %rax
+	xorl %edx, %edx
+	divq %rcx
+	cmpq $2, %rax
+	jne .L179
+.L179:
+.L180:
+	movzwl -72(%rbp), %eax
+	testl %eax, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movzwl -72(%rbp), %eax
+	movq %rax, %r9
+	movl $695, %eax
+	movq %rax, %r8
+	movl $65535, %eax
+	movq %rax, %rcx
+	movl $41, %eax
+	movq %rax, %rdx
+	movsbl -78(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -74(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+.L177:
+.L178:
+	movl $16228, %eax
+.f3_return:
+	leave
+	ret
+.L159:
+	movl $7, %eax
+	movq %rax, %r9
+	movq -48(%rbp), %rax
+	movq %rax, %r8
+	movl $257, %eax
+	movq %rax, %rcx
+	movl $632, %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movslq -68(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movsbq %al, %rax
+	cmpq %rax, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -78(%rbp)
+	movabsq $602283612104, %rax
+	addq -56(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	pushq %rax
+	movswq -76(%rbp), %rax
+	pushq %rax
+	movswq -76(%rbp), %rax
+	movq %rax, %r9
+	movl $19969, %eax
+	movq %rax, %r8
+	movq -56(%rbp), %rax
+	movq %rax, %rcx
+	movzwl -74(%rbp), %eax
+	movq %rax, %rdx
+	movzwl -74(%rbp), %eax
+	movq %rax, %rsi
+	movl $532, %eax
+	movq %rax, %rdi
+	call f2
+	addq $24, %rsp
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -72(%rbp)
+.L160:
+.L150:
+.L151:
+	addq $1, -56(%rbp)
+	cmpq $16, -56(%rbp)
+	jb .L148
+	jmp .L149
+.L156:
+.L157:
+	movl ga0+4(%rip), %eax
+	movsbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $2, %eax
+	pushq %rax
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	movq %rax, %r9
+	xorl %eax, %eax
+	movq %rax, %r8
+	movsbl -77(%rbp), %eax
+	movq %rax, %rcx
+	movzwl -74(%rbp), %eax
+	movq %rax, %rdx
+	movswl -76(%rbp), %eax
+	movq %rax, %rsi
+	movl $599, %eax
+	movq %rax, %rdi
+	call f2
+	addq $24, %rsp
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzwl -72(%rbp), %eax
+	movq %rax, %rsi
+	movsbl -78(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+.L152:
+.L153:
+	movl ga0+12(%rip), %eax
+	cmpl $852, %eax
+	setne %al
+	movzbl %al, %eax
+	movzwl -70(%rbp), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	je .L159
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	je .L163
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L164
+.L163:
+	movl $0, %eax
+.L164:
+	pushq %rax
+	movl ga0+4(%rip), %eax
+	movl ga0+4(%rip), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jg .L160
+	jmp .L149
+.L154:
+.L155:
+	movq -48(%rbp), %rax
+	cqo
+	idivq -32(%rbp)
+	testq %rax, %rax
+	jne .L149
+	movl ga0+12(%rip), %eax
+	cmpl -68(%rbp), %eax
+	jl .L156
+.L158:
+	jmp .L149
+.L146:
+.L147:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -76(%rbp)
+	movswl -76(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, %eax
+	jl .L144
+	jmp .L145
+.L161:
+.L162:
+	jmp .L160
+.L136:
+	cmpb $0, -78(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdx
+	movzwl -72(%rbp), %eax
+	movq %rax, %rsi
+	movl $255, %eax
+	movq %rax, %rdi
+	popq %rcx
+	call f0
+	movl $21, %eax
+	pushq %rax
+	movl $333, %eax
+	pushq %rax
+	movl $3, %eax
+	movq %rax, %r9
+	movl $-20862, %eax
+	movq %rax, %r8
+	movl $7, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl ga0+8(%rip), %eax
+	movq %rax, %rsi
+	movl $703, %eax
+	movq %rax, %rdi
+	call f1
+	movsbq %al, %rax
+	pushq %rax
+	movzwl -74(%rbp), %eax
+	movl ga0+8(%rip), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movswl -76(%rbp), %eax
+	pushq %rax
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	imulq -48(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movl -16(%rbp), %eax
+	movq %rax, %r9
+	movq -48(%rbp), %rax
+	movq %rax, %r8
+	movl $2830892003, %eax
+	movq %rax, %rcx
+	movl $32767, %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movsbl %al, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f2
+	addq $16, %rsp
+	movswl -76(%rbp), %eax
+	pushq %rax
+	movslq -68(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movq %rax, %r9
+	movl $1, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	cmpq $65535, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movswl -76(%rbp), %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f2
+	addq $16, %rsp
+.L137:
+	cmpq $432, -48(%rbp)
+	setge %al
+	movzbl %al, %eax
+	testb %al, %al
+	je .L135
+	movq -56(%rbp), %rax
+	subq $6, %rax
+	jne .L142
+	xorl %eax, %eax
+	movsbl -78(%rbp), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L143
+.L142:
+	movl $1, %eax
+.L143:
+	pushq %rax
+	subq $8, %rsp
+	movl -68(%rbp), %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl ga0+12(%rip), %eax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzbl %al, %eax
+	cmpl $598, %eax
+	setne %al
+	movzbl %al, %eax
+	popq %rcx
+	imull %ecx, %eax
+	movl %eax, -68(%rbp)
+	cmpq $1, -40(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -70(%rbp), %eax
+	cmpl $2, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $-981, %eax
+	movq %rax, %rsi
+	movq -56(%rbp), %rax
+	addq $6, %rax
+	movq %rax, %rdi
+	call f0
+.L140:
+.L141:
+	jmp .L135
+.LB1:
+	movl -16(%rbp), %eax
+	jmp .f3_return
+.LB2:
+	movl -16(%rbp), %eax
+	jmp .f3_return
+.LB3:
+	movl -16(%rbp), %eax
+	jmp .f3_return
+.LB4:
+	movl -16(%rbp), %eax
+	jmp .f3_return
+.LB5:
+	movl -16(%rbp), %eax
+	jmp .f3_return
+.LB0:
+	movzwl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpw $0, -76(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	jmp .f3_return
+	.size f3, .-f3
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movw $-15567, -2(%rbp)
+	movw $5, -4(%rbp)
+	movb $0, -5(%rbp)
+	movw $562, -8(%rbp)
+	movl $1, -12(%rbp)
+	movw $315, -14(%rbp)
+	movl $528883699, -20(%rbp)
+	movq $586, -32(%rbp)
+	movl $0, -20(%rbp)
+	imull $66, -20(%rbp), %eax
+	subl $66, %eax
+	movl %eax, -100(%rbp)
+	cmpl $16, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -104(%rbp)
+	testl %eax, %eax
+	je .L181
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L184
+	.p2align 4,,10
+.L183:
+	addl $66, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $66, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $66, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $66, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -112(%rbp)
+	jne .L183
+.L184:
+.L181:
+.L182:
+	cmpl $16, -20(%rbp)
+	jge .L186
+	.p2align 4,,10
+.L185:
+	addl $66, -100(%rbp)
+	movslq -20(%rbp), %rax
+	movl -100(%rbp), %ecx
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L185
+.L186:
+	movzwl -4(%rbp), %eax
+	movl %eax, -116(%rbp)
+	imull -116(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	subl $10, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $16, %rax
+	je .L189
+	cmpq $69, %rax
+	je .L187
+	cmpq $382, %rax
+	je .L189
+.L188:
+	cmpl $0, -20(%rbp)
+	je .L191
+	movsbl -5(%rbp), %eax
+	cmpl $271, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .main_return
+.L189:
+	movswl -8(%rbp), %eax
+	cmpl %eax, -116(%rbp)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl ga0+8(%rip), %eax
+	pushq %rax
+	cmpw $0, -14(%rbp)
+	je .L193
+	cmpw $0, -14(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L194
+.L193:
+	movl $0, %eax
+.L194:
+	movq %rax, %rsi
+	movswl -14(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0
+	movw $0, -2(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -120(%rbp)
+	cmpl $3, %eax
+	jge .L196
+	.p2align 4,,10
+.L195:
+	movb $-1, -5(%rbp)
+	movl -120(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -2(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -120(%rbp)
+	cmpl $3, %eax
+	jl .L195
+.L196:
+.L187:
+	movl $6, %eax
+	pushq %rax
+	movswl -8(%rbp), %eax
+	subl $7, %eax
+	pushq %rax
+	movl $4, %eax
+	movq %rax, %rdx
+	movl -68(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movsbl -5(%rbp), %eax
+	movswq %ax, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f3
+	movswl -2(%rbp), %eax
+	movzbl %al, %eax
+	cmpl $6, %eax
+	setle %al
+	movzbl %al, %eax
+	movzwl %ax, %eax
+	movl %eax, -12(%rbp)
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -124(%rbp)
+	pushq %rax
+	cmpw $0, -4(%rbp)
+	je .L197
+	cmpl $0, -20(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L198
+.L197:
+	movl $0, %eax
+.L198:
+	movq %rax, %rcx
+	movswl -2(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -20(%rbp)
+	movsbl -5(%rbp), %eax
+	cmpl %eax, -116(%rbp)
+	setle %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	jne .L199
+	movq -32(%rbp), %rax
+	movswq %ax, %rax
+	movq %rax, %rcx
+	movabsq $311897891555, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	jmp .L200
+.L199:
+	movl -12(%rbp), %eax
+	movswl %ax, %eax
+	xorl %edx, %edx
+	divl -124(%rbp)
+	movw %ax, -14(%rbp)
+	movl -36(%rbp), %eax
+	movswl -14(%rbp), %ecx
+	addl %ecx, %eax
+	movq %rax, %rcx
+	cmpl $1, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movq %rax, %rcx
+	movl -76(%rbp), %eax
+	cmpl $630, %eax
+	setl %al
+	movzbl %al, %eax
+	imull $565, %eax, %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movzwl -4(%rbp), %eax
+	movq %rax, %r8
+	movl -56(%rbp), %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movl $-85, %eax
+	movq %rax, %rsi
+	movl $974, %eax
+	movq %rax, %rdi
+	call f3
+	movzwl %ax, %eax
+	addq %rax, -32(%rbp)
+.L200:
+	movq $0, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movzwl -4(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movsbq -5(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movswq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movswq -14(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movl $0, -20(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $0, -104(%rbp)
+	je .L201
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L204
+	.p2align 4,,10
+.L203:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -144(%rbp)
+	jne .L203
+.L204:
+.L201:
+.L202:
+	cmpl $16, -20(%rbp)
+	jge .L206
+	.p2align 4,,10
+.L205:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L205
+.L206:
+	movq -136(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -136(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -136(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movq -136(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L190:
+	jmp .L187
+.L191:
+	movl $1, %eax
+.L192:
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,132 @@
+unsigned long g0;
+int ga0[8];
+short f0(short p0, unsigned int p1, char p2, unsigned short p3) {
+    unsigned int v0 = 896;
+    unsigned short v1 = 255;
+    unsigned short v2 = 415;
+    int i0 = 805036671570;
+    long j0 = 199;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 639L; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 2; }
+    for (p0 = 0; p0 < 4; p0 = p0 + 1) {
+        j0 = !((g0 + 351));
+        for (i0 = 2; i0 < 16; i0 = i0 + 1) {
+            if (32767) { return !(1); }
+            if (la1[6]) {
+                if (((unsigned char)(p2) >= (85 - 65535ul))) { break; }
+            } else {
+                p2 = (9 != (j0 - 65536));
+            }
+            v1 = (((9 / 3) / (v1 * v1 + 1)) > (940U / (g0 * g0 + 1)));
+        }
+    }
+    p2 = !(63);
+    j0 = (i0 && !(219));
+    if (g0 >= 0 && g0 < 8) { la1[g0] = 5L; }
+    if (2) { return 7; }
+    if (-((4 != 4))) {
+        if ((i0 / 4)) {
+            p1 = 71u;
+            v1 = v1 + p2;
+            v1 = (long)(v2);
+        }
+        if ((2 == 10)) { return ((p0 - 3) || !(423634528852)); }
+        for (p1 = 2; p1 < 5; p1 = p1 + 1) {
+            j0 = -(-(la0[5]));
+            for (v0 = 0; v0 < 17; v0 = v0 + 1) {
+                if (!(-(v1))) { break; }
+            }
+            la1[p1] = (v2 || 555);
+        }
+    } else {
+        if (!(((2 != ga0[1]) + (ga0[6] / (j0 * j0 + 1))))) {
+            i0 = -(la1[3]);
+            p2 = (g0 * i0);
+            la0[13] = (1037695692509 + p0);
+        }
+    }
+    i0 = (unsigned short)((char)(255));
+    for (j0 = 0; j0 < 4; j0 = j0 + 1) {
+        p2 = 8;
+        i0 = i0 + v0;
+        if (!((unsigned char)(7))) {
+            v2 = -(8);
+            if ((146 >= 2)) {
+                if (287L) { return !(v0); }
+            } else {
+                if (g0) { break; }
+                p3 = p3 + ((134083476287l / (v1 * v1 + 1)) / 3u);
+                if ((int)((v0 - g0))) { break; }
+            }
+        } else {
+            for (i0 = 0; i0 < 8; i0 = i0 + 1) {
+                v2 = (((106 > p0) != g0) == ((g0 && 2) && p3));
+            }
+            if (la1[j0] < v2) { v2 = la1[j0]; }
+            p2 = (!((p1 > 8)) / 3u);
+        }
+    }
+    return (p0 || v0);
+}
+void w0(int q0, char q1, unsigned int q2) {
+    g0 = g0 * 3 + q2;
+    g0 = g0 * 3 + q2;
+    g0 = g0 * 3 + q0;
+}
+unsigned long f1(unsigned char p0, unsigned short p1, unsigned short p2, long p3, unsigned char p4, unsigned long p5, unsigned char p6, unsigned char p7) {
+    unsigned char v0 = 176592931648L;
+    int v1 = 7;
+    char v2 = 118069600881;
+    unsigned short v3 = 42;
+    long v4 = 4;
+    int i0 = 486l;
+    long j0 = 4;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 7; }
+    if ((-(73353814656) != ga0[7])) { return ((i0 >= 0l) && 442); }
+    la0[3] = 349;
+    p1 = p1 + (0 || (5 / (p1 * p1 + 1)));
+    p6 = f0((986 >= p7), (4 >= p2), -(995), !(842));
+    return (-((v4 <= 399)) + (f0(9ul, 256, 10, p5) / (p6 * p6 + 1)));
+}
+int main() {
+    char v0 = 718971939684u;
+    short v1 = 824;
+    int i0 = 7;
+    long j0 = 687;
+    j0 = f1((g0 == i0), !(g0), (1000 < 8), (62 - 3), (v0 + i0), 6, (g0 > 7), ga0[4]);
+    g0 = i0;
+    if (ga0[4]) {
+        f1(i0, 1, (9 / (j0 * j0 + 1)), (i0 - 504), 2, (i0 - 5), (ga0[2] + 1), (ga0[1] <= v1));
+        i0 = (5 || !((7 > 6l)));
+        j0 = !((unsigned short)((1 > i0)));
+    }
+    if ((v1 == ga0[1])) {
+        f0(677, v0, v1, !(668384608777));
+        v1 = 0;
+        while (v1 < 100) {
+            if (-(((j0 - v1) >= (short)(i0)))) {
+                j0 = (ga0[6] < (32767 / 10));
+            }
+            v1 = v1 + 1;
+        }
+    }
+    v1 = 0;
+    while (v1 < 3) {
+        if (((i0 - 8) && g0)) { break; }
+        g0 = 8;
+        v1 = v1 + 1;
+    }
+    f1((5 > 36L), (459 - j0), g0, (7 == ga0[6]), (0 + 7), (unsigned char)(j0), (g0 + 255), -(255));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,778 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.section .text
+	.type f0, @function
+	.type f1.constprop.2, @function
+	.type f1.constprop.1, @function
+	.global main
+	.type main, @function
+	.type f1.constprop.0, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movw %di, -2(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movw %cx, -12(%rbp)
+	movl $896, -16(%rbp)
+	movw $255, -18(%rbp)
+	movw $415, -20(%rbp)
+	movl $1877787218, -24(%rbp)
+	movq $199, -32(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -104(%rbp)
+	cmpq $0, -104(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movslq -24(%rbp), %rax
+	movq %rax, -112(%rbp)
+	imulq $639, %rax, %rax
+	movq %rax, %rcx
+	movq -112(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -120(%rbp)
+	imulq $639, %rax, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -128(%rbp)
+	imulq $639, %rax, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $639, %rax, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -104(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -24(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -24(%rbp), %rax
+	movq %rax, -144(%rbp)
+	imulq $639, %rax, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jl .L4
+.L5:
+	movl $0, -24(%rbp)
+	movl $0, -176(%rbp)
+	movl $2, -172(%rbp)
+	movl $4, -168(%rbp)
+	movl $6, -164(%rbp)
+	movl $8, -160(%rbp)
+	movl $10, -156(%rbp)
+	movl $12, -152(%rbp)
+	movl $14, -148(%rbp)
+	movl $8, -24(%rbp)
+	movw $0, -2(%rbp)
+	movq $-65450, -184(%rbp)
+	movl $3, -188(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -192(%rbp)
+	cmpl $4, %eax
+	jge .L7
+	.p2align 4,,10
+.L6:
+	movq g0(%rip), %rax
+	addq $351, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl $2, -24(%rbp)
+	movq -184(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movq -32(%rbp), %rax
+	subq $65536, %rax
+	cmpq $9, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -204(%rbp)
+	movl -188(%rbp), %eax
+	movl %eax, -208(%rbp)
+	cmpl $16, -24(%rbp)
+	jge .L9
+	.p2align 4,,10
+.L8:
+	movl $0, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L9:
+	movl -192(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -2(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -192(%rbp)
+	cmpl $4, %eax
+	jl .L6
+.L7:
+	movb $0, -9(%rbp)
+	cmpl $0, -24(%rbp)
+	je .L10
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L11
+.L10:
+	movl $0, %eax
+.L11:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	cmpq $0, g0(%rip)
+	jb .L12
+	cmpq $8, g0(%rip)
+	jae .L12
+	movq g0(%rip), %rax
+	movl $5, -176(%rbp,%rax,4)
+.L12:
+.L13:
+	movl $7, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f1.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq %rcx, -16(%rbp)
+	movq $4, -8(%rbp)
+	movl $4, -20(%rbp)
+	movl ga0+28(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-73353814656, %rax
+	cmpq %rcx, %rax
+	je .L14
+	movslq -20(%rbp), %rax
+	testq %rax, %rax
+	jl .L16
+	movl $442, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L17
+.L16:
+	movl $0, %eax
+.L17:
+	movslq %eax, %rax
+.f1.constprop.2_return:
+	leave
+	ret
+.L14:
+.L15:
+	movzwl %di, %eax
+	movl %eax, -20(%rbp)
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	addl -20(%rbp), %eax
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $29, %eax
+	movq %rax, %rdx
+	movzwl %si, %eax
+	cmpl $4, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -20(%rbp)
+	movzbl -20(%rbp), %eax
+	movl %eax, -20(%rbp)
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $256, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	pushq %rax
+	xorl %eax, %eax
+	cmpq $399, -8(%rbp)
+	setle %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	jmp .f1.constprop.2_return
+	.size f1.constprop.2, .-f1.constprop.2
+	.align 16
+f1.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movw %dx, -22(%rbp)
+	movq %r8, -16(%rbp)
+	movq $4, -8(%rbp)
+	movl $4, -20(%rbp)
+	movl ga0+28(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-73353814656, %rax
+	cmpq %rcx, %rax
+	je .L18
+	movslq -20(%rbp), %rax
+	testq %rax, %rax
+	jl .L20
+	movl $442, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L21
+.L20:
+	movl $0, %eax
+.L21:
+	movslq %eax, %rax
+.f1.constprop.1_return:
+	leave
+	ret
+.L18:
+.L19:
+	movzwl %si, %eax
+	movl %eax, -20(%rbp)
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	addl -20(%rbp), %eax
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $29, %eax
+	movq %rax, %rdx
+	movzwl -22(%rbp), %eax
+	cmpl $4, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movzbl 16(%rbp), %eax
+	cmpl $986, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -20(%rbp)
+	movzbl -20(%rbp), %eax
+	movl %eax, -20(%rbp)
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $256, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	pushq %rax
+	xorl %eax, %eax
+	cmpq $399, -8(%rbp)
+	setle %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	jmp .f1.constprop.1_return
+	.size f1.constprop.1, .-f1.constprop.1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movb $100, -31(%rbp)
+	movw $824, -30(%rbp)
+	movl $7, -28(%rbp)
+	movl ga0+16(%rip), %eax
+	movq %rax, %r8
+	cmpq $7, g0(%rip)
+	seta %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -31(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rdx
+	cmpq $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movslq -28(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq %rax, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f1.constprop.0
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	movq %rax, g0(%rip)
+	movl ga0+16(%rip), %eax
+	testl %eax, %eax
+	je .L22
+	subq $8, %rsp
+	movl ga0+4(%rip), %eax
+	movswl -30(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl ga0+8(%rip), %eax
+	addl $1, %eax
+	pushq %rax
+	movl -28(%rbp), %eax
+	subl $5, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -28(%rbp), %eax
+	subl $504, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $9, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1.constprop.1
+	addq $16, %rsp
+	movl $5, %eax
+	testl %eax, %eax
+	jne .L24
+	movl $7, %eax
+	cmpq $6, %rax
+	setle %al
+	movzbl %al, %eax
+	jmp .L25
+.L24:
+	movl $1, %eax
+.L25:
+	movl %eax, -28(%rbp)
+	cmpl $1, -28(%rbp)
+	setl %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L22:
+.L23:
+	movswl -30(%rbp), %eax
+	movl ga0+4(%rip), %ecx
+	cmpl %ecx, %eax
+	jne .L26
+	movabsq $668384608777, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -30(%rbp), %eax
+	movq %rax, %rdx
+	movsbl -31(%rbp), %eax
+	movq %rax, %rsi
+	movl $677, %eax
+	movq %rax, %rdi
+	call f0
+	movw $0, -30(%rbp)
+	movl $32767, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl %eax, -16(%rbp)
+	movswl -30(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $100, %eax
+	jge .L29
+	.p2align 4,,10
+.L28:
+	movl -28(%rbp), %eax
+	movswq %ax, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movswq -30(%rbp), %rcx
+	subq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L30
+	movl ga0+24(%rip), %eax
+	cmpl -16(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L30:
+.L31:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -30(%rbp)
+	movswl -30(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $100, %eax
+	jl .L28
+.L29:
+.L26:
+.L27:
+	movw $0, -30(%rbp)
+	movl -28(%rbp), %eax
+	subl $8, %eax
+	movl %eax, -16(%rbp)
+	movswl -30(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, %eax
+	jge .L33
+	.p2align 4,,10
+.L32:
+	cmpl $0, -16(%rbp)
+	je .L34
+	cmpq $0, g0(%rip)
+	je .L34
+.L33:
+	movq g0(%rip), %rax
+	addq $255, %rax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	cmpl $7, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movq g0(%rip), %rax
+	movq %rax, %rsi
+	movl $459, %eax
+	subq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f1.constprop.2
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq -31(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movswq -30(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $8, -28(%rbp)
+	jge .L36
+	movl $8, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L39
+	.p2align 4,,10
+.L38:
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -8(%rbp)
+	jne .L38
+.L39:
+.L36:
+.L37:
+	cmpl $8, -28(%rbp)
+	jge .L41
+	.p2align 4,,10
+.L40:
+	movslq -28(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $8, -28(%rbp)
+	jl .L40
+.L41:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	leave
+	ret
+.L34:
+.L35:
+	movq $8, g0(%rip)
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -30(%rbp)
+	movswl -30(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $3, %eax
+	jl .L32
+	jmp .L33
+	.size main, .-main
+	.align 16
+f1.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq $4, -8(%rbp)
+	movl $4, -12(%rbp)
+	movl ga0+28(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-73353814656, %rax
+	cmpq %rcx, %rax
+	je .L42
+	movslq -12(%rbp), %rax
+	testq %rax, %rax
+	jl .L44
+	movl $442, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L45
+.L44:
+	movl $0, %eax
+.L45:
+	movslq %eax, %rax
+.f1.constprop.0_return:
+	leave
+	ret
+.L42:
+.L43:
+	movzwl %si, %eax
+	movl %eax, -12(%rbp)
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	addl -12(%rbp), %eax
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $29, %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movzbl %r8b, %eax
+	cmpl $986, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -12(%rbp)
+	movzbl -12(%rbp), %eax
+	movl %eax, -12(%rbp)
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $256, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	pushq %rax
+	xorl %eax, %eax
+	cmpq $399, -8(%rbp)
+	setle %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	jmp .f1.constprop.0_return
+	.size f1.constprop.0, .-f1.constprop.0
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,308 @@
+short g0;
+char g1 = 2;
+int ga0[8];
+long f0(unsigned short p0, unsigned char p1, int p2, short p3, long p4, short p5, unsigned long p6, int p7) {
+    long v0 = 128;
+    unsigned char v1 = 722;
+    unsigned short v2 = 0;
+    int v3 = 8;
+    long v4 = 10;
+    int i0 = 808;
+    long j0 = 790048731763u;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    switch (((65535 / 3u) / 4)) {
+    case -4:
+        break;
+    case 139:
+        v3 = v3 + ((unsigned long)(p2) + !(p7));
+        if (7) { return ((784 - p6) >= (p7 + 98)); }
+        break;
+    case 54:
+        j0 = 0;
+        while (j0 < 33) {
+            p1 = g0;
+            i0 = (char)((255 / (v4 * v4 + 1)));
+            j0 = j0 + 1;
+        }
+        break;
+    case 65:
+        if (4) {
+            p1 = (unsigned char)(!(624460364770));
+            p3 = (((3 / 10) / 7) - 66);
+            p1 = ((695 && 4) / 100);
+        } else {
+            switch ((7 || j0)) {
+            case 0:
+            default:
+                if (((345 + 2) + (short)(v2))) { return ((long)(g0) < (i0 - p2)); }
+                v2 = (p6 < ((unsigned short)(448086256330) + 359));
+                break;
+            case 46:
+                break;
+            case 43:
+            case 140:
+                v1 = p7;
+                if (((p7 - 3) > !(g0))) { return -(v3); }
+                break;
+            case 69:
+                if (((p2 / (p6 * p6 + 1)) == (short)(ga0[0]))) { return ((int)(v0) > (v3 * 750761748297)); }
+                p2 = 9;
+            case 414:
+                if (5) { return ((v4 || p0) - (255 || p2)); }
+            }
+            if (!((i0 + 256))) {
+                if (978040765019) { return (v3 != (299u == 6)); }
+            }
+            j0 = (1010268482550 - ((v3 / 3) - (unsigned short)(3)));
+        }
+        break;
+    case 391:
+    case -3:
+        j0 = (-(679) >= ((p5 >= i0) + (239l / 3u)));
+        p4 = p4 + (796L && (unsigned int)(2));
+        break;
+    case 449:
+        break;
+    }
+    if (p1 >= 0 && p1 < 4) { la0[p1] = (v2 / 2); }
+    la0[3] = ((p6 + p0) || 459970124585L);
+    la0[1] = la0[0];
+    v3 = v3 + 119557037892;
+    p2 = 1000000007L;
+    return ((la0[0] + v2) || 2);
+}
+void w0(short q0) {
+    g0 = g0 * 3 + q0;
+    g1 = g1 * 3 + q0;
+}
+unsigned short f1(long p0, unsigned int p1, unsigned short p2, long p3, long p4, unsigned char p5) {
+    unsigned long v0 = 8;
+    unsigned char v1 = 2;
+    long v2 = 8;
+    int i0 = 746;
+    long j0 = 7;
+    f0((6 && 6), (553690050171 / (p5 * p5 + 1)), -(ga0[7]), (4 > p2), (g1 >= g1), 7, 46, (639 - 7l));
+    v2 = ((unsigned long)(895) < (!(5) + !(6)));
+    switch (((v1 + 247686435473) * p4)) {
+    case 2:
+        if (792230271819) {
+            v0 = 0;
+            while (v0 < 5) {
+                if (5) { break; }
+                v0 = v0 + 1;
+            }
+            p3 = (!((ga0[4] / (p0 * p0 + 1))) + ((v0 + p1) >= (6 != v1)));
+            f0(ga0[3], !(p5), (p0 + p5), p3, (718 / (g1 * g1 + 1)), (short)(v1), 1, (unsigned short)(i0));
+        }
+        break;
+    default:
+        p0 = p0 + v0;
+        if ((p1 > (int)(ga0[3]))) {
+            p2 = ((128 == (g1 - 1)) > !((3 + v2)));
+            if (p0) {
+                p5 = p5 + (10 == (541 / (v0 * v0 + 1)));
+            } else {
+                v1 = v0;
+            }
+        } else {
+            p5 = f0((p0 * p5), (j0 * g1), 970, g0, p4, 0, f0(p2, j0, 755, p2, g0, ga0[7], i0, v0), (v0 || p1));
+        }
+    case 1:
+        p1 = (((378 == 130132008706) == (unsigned int)(7)) || (int)((v0 != 663)));
+        p4 = 0;
+        while (p4 < 17) {
+            p3 = !(p5);
+            v2 = ((8 && (0 > 10)) <= -((p2 >= p1)));
+            p4 = p4 + 1;
+        }
+        break;
+    }
+    j0 = ((2147483647 != -(p0)) / 4);
+    j0 = (ga0[6] / (p5 * p5 + 1));
+    return (j0 < !((632 <= 8)));
+}
+char f2(unsigned long p0, unsigned int p1, char p2) {
+    unsigned int v0 = 368;
+    unsigned char v1 = 375;
+    unsigned short v2 = 10;
+    int i0 = 2;
+    long j0 = 9ul;
+    f0((p2 >= 128), i0, v1, -(1), 10, -(p2), f0(986647387819, p2, 7, 1, p1, v1, ga0[0], p0), 1);
+    if (((627 - (g0 != 585L)) != ((unsigned int)(39) / (p0 * p0 + 1)))) {
+        f1(f0(ga0[7], g1, g0, 8L, ga0[0], p2, 758, 127), !(6), 312, v1, g0, (unsigned char)(65535));
+        if (f1((i0 + 8), (v2 < 9), (p2 == 1), (2u - v1), 2, p1)) {
+            f0((877 || ga0[4]), (unsigned int)(464), -(226), (short)(112L), p2, !(j0), v1, (p2 + 713));
+            v0 = (128 < (short)((unsigned long)(6)));
+            if (f1((v2 - 8), (6 || ga0[6]), f1(423, v0, p2, j0, 151, j0), (p1 != 65535), (p1 != v2), f0(8, 267, g1, 79, 696, v0, 1, v1))) {
+                f1((ga0[2] != 0), v1, (7 >= 512), (v1 && 8), v2, !(359));
+            } else {
+                f1(756, 497L, -(p2), 161, (128 / 4), (p0 != 8));
+                p1 = ((271 - !(g1)) / (j0 * j0 + 1));
+                f0(f0(p2, j0, 9l, 870132904461, p1, 6, 361, p1), f1(g0, 9l, ga0[6], 0, 188, v2), !(132), (79 && p1), 869932661733L, !(4), (short)(v0), v2);
+            }
+        }
+        j0 = (((v2 * 913) || 0) / (i0 * i0 + 1));
+    }
+    if ((v2 / (j0 * j0 + 1))) {
+        i0 = (((8 - v1) - (65535 - 99)) / 2);
+        for (j0 = 0; j0 < 3; j0 = j0 + 1) {
+            i0 = p1;
+            if ((short)((unsigned long)(f0(255, ga0[1], p2, 547716505089, p0, j0, v0, i0)))) {
+                v1 = v1 + (unsigned short)(g0);
+                if (((j0 / 100) + (long)(350))) { break; }
+                if (!((6 / (v0 * v0 + 1)))) { break; }
+            }
+        }
+    } else {
+        switch (((0 >= p2) * (g0 / (i0 * i0 + 1)))) {
+        case -5:
+            j0 = j0 + ((unsigned int)(8) / 13ul);
+            if (v2) {
+                j0 = ((0 || -(v1)) + ((v1 / (g0 * g0 + 1)) / (p2 * p2 + 1)));
+                f1((2ul == 5), (ga0[4] - ga0[6]), p0, -(5), (char)(v0), j0);
+            }
+            break;
+        case 58:
+            i0 = (unsigned short)(-((ga0[3] || p2)));
+            p1 = (f0(10, i0, 4, 162, 552, 10, g0, v2) && f0(g0, ga0[7], p2, 5, 7, ga0[4], ga0[5], 9));
+            break;
+        case 616:
+            f1((474 - p2), v2, 833, (66952760060 > 127ul), (v2 < g1), f0(340, 2, 752, 80ul, 188, 0, ga0[5], 4ul));
+            if (((255044218807 == (p0 < p2)) / 2)) {
+                f0(0, 10, (710 != p0), v2, ga0[3], g0, (g0 + 3), !(p0));
+                v1 = (p2 == 6);
+                p2 = (short)((v1 && (v1 || p0)));
+            }
+            break;
+        default:
+            break;
+        case 247:
+            p1 = (((ga0[2] * 8) * (v2 / (g0 * g0 + 1))) + (1 || (558046898764 / 5l)));
+            v0 = (unsigned char)(-((g1 / 4)));
+            break;
+        case 2:
+            for (j0 = 0; j0 < 5; j0 = j0 + 1) {
+                if (f1(p1, j0, v2, 5, j0, i0)) { break; }
+            }
+            break;
+        }
+        switch (f0(ga0[4], ga0[6], i0, 452, i0, v2, i0, 192U)) {
+        default:
+            break;
+        case 5:
+            p1 = (f0(47789362885, 860, p2, ga0[7], 783, 538732446606, ga0[6], 271136552780) - (unsigned short)((1 < g0)));
+            p0 = 0;
+            while (p0 < 4) {
+                if ((!(8) - (p0 - 1000000007))) { return 9; }
+                p0 = p0 + 1;
+            }
+            break;
+        case 1:
+            break;
+        case 3:
+        case 4:
+            v0 = !(p2);
+        case 0:
+            switch ((10u / 3)) {
+            case 5:
+                break;
+            case 2:
+                break;
+            case 1:
+                f1((5 != g1), !(839483048619), p0, (256 / (v0 * v0 + 1)), (unsigned int)(v2), 9);
+                break;
+            case 6:
+                v1 = (!((986l - v2)) || 665);
+            }
+            for (v0 = 0; v0 < 3; v0 = v0 + 1) {
+                p1 = f0(i0, 1000000007, -(905), f0(j0, g1, 269, p2, 7, p1, p1, p1), 65536, f1(v0, 2, 471, p0, i0, 3), f1(4, ga0[4], ga0[3], 127, 5, 6), !(i0));
+                if (((8 + 9) < (int)(4))) { break; }
+                if (ga0[3]) { break; }
+            }
+            break;
+        }
+        f1(i0, f1(v0, 278U, 32767ul, g0, 3, j0), -(i0), (281 == 670813470590), (long)(127), (9 + ga0[4]));
+    }
+    j0 = (f1(3, ga0[0], 8, 279, ga0[0], 10) <= g1);
+    p2 = (unsigned short)(f0(1, g0, 6, 24354866700L, v1, 7, v2, ga0[1]));
+    f1((97166970644 || g0), 612052459155, 1, (ga0[4] + v0), ga0[0], f1(2, g1, 46, 1U, v2, v0));
+    if ((v2 || v0)) { return ((ga0[4] > 1000000007) / (p2 * p2 + 1)); }
+    if (!((552ul >= f0(p0, j0, 0, g1, p0, g1, 5, p1)))) {
+        for (v0 = 0; v0 < 4; v0 = v0 + 1) {
+            i0 = !(i0);
+            if (((v0 / (p1 * p1 + 1)) / (g0 * g0 + 1))) { break; }
+        }
+    }
+    return ((unsigned short)(!(ga0[2])) <= p0);
+}
+void w2(char q0, short q1) {
+    ga0[3] = ga0[1] + q1;
+}
+int main() {
+    long v0 = 593;
+    unsigned char v1 = 0;
+    unsigned char v2 = 4;
+    unsigned long v3 = 733;
+    short v4 = 32767;
+    int v5 = 514;
+    int i0 = 251ul;
+    long j0 = 599;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 589; }
+    v0 = 2;
+    j0 = j0 + i0;
+    v4 = (f0(g1, 50, 6l, 1, 9L, g0, j0, la0[1]) * (g0 > 8));
+    f1((1 / (g1 * g1 + 1)), f1(6u, 735, 6, ga0[2], 128, j0), 1000000007, (10 != 3), (g0 <= v5), (582 / (v3 * v3 + 1)));
+    if (((f1(379, 7, 0, 4, v4, la0[2]) + (int)(792)) || (9 - (400 > v4)))) {
+        v4 = 0;
+        while (v4 < 4) {
+            switch (!(v2)) {
+            case 8:
+                v0 = (870 / (v3 * v3 + 1));
+            case 10:
+                j0 = -(!((v5 * 232)));
+                if (((8 / (v1 * v1 + 1)) && f0(v0, g1, 620, 966, 340U, 826, 228141967225, v2))) { break; }
+                break;
+            case 9:
+                if (((la0[0] - v2) <= v3)) { break; }
+                v1 = -(102);
+                break;
+            case 6:
+                g0 = 0;
+                f0(!(5), f2(65535, 26, i0), f0(v2, v3, v4, 918, v3, ga0[4], 8, v5), v5, 11, !(v5), v3, (7 == 373));
+                break;
+            case 2:
+                break;
+            default:
+                if ((v0 || f1(v1, 4, i0, ga0[0], 0, ga0[6]))) { break; }
+                g0 = v5;
+                break;
+            case 1:
+                j0 = ((f2(453996000838, 0, v0) / (g0 * g0 + 1)) > la0[0]);
+                la0[v4] = (-(v2) / (g0 * g0 + 1));
+                break;
+            }
+            v4 = v4 + 1;
+        }
+        if (g1 >= 0 && g1 < 4) { la0[g1] = (char)(5); }
+    }
+    v3 = v3 + j0;
+    v2 = v2 + f1(662, g0, 5, 552, v5, 702);
+    v4 = 10;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2977 @@
+	.section .data
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.byte 2
+	.section .bss
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.section .text
+	.type f0.constprop.1, @function
+	.type f0, @function
+	.type f0.constprop.2, @function
+	.type f1, @function
+	.type f0.constprop.0, @function
+	.type f2, @function
+	.global main
+	.type main, @function
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movw %dx, -10(%rbp)
+	movq %rcx, -24(%rbp)
+	movq $128, -32(%rbp)
+	movb $210, -33(%rbp)
+	movw $0, -36(%rbp)
+	movl $8, -40(%rbp)
+	movq $10, -48(%rbp)
+	movl $808, -52(%rbp)
+	movabsq $790048731763, %rax
+	movq %rax, -64(%rbp)
+	movl $0, -52(%rbp)
+	movl $0, -80(%rbp)
+	movl $10, -76(%rbp)
+	movl $20, -72(%rbp)
+	movl $30, -68(%rbp)
+	movl $4, -52(%rbp)
+	movl $5461, %eax
+	movslq %eax, %rax
+	cmpq $65, %rax
+	jge .L7
+	cmpq $-4, %rax
+	je .L1
+	cmpq $-3, %rax
+	je .L5
+	cmpq $54, %rax
+	je .L3
+	jmp .L0
+.L7:
+	cmpq $391, %rax
+	jge .L8
+	cmpq $65, %rax
+	je .L4
+	cmpq $139, %rax
+	je .L2
+.L1:
+.L0:
+	movzbl -1(%rbp), %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	jl .L15
+	cmpl $4, -100(%rbp)
+	jge .L15
+	movzwl -36(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movl %ecx, -80(%rbp,%rax,4)
+.L15:
+.L16:
+	movl $1, -68(%rbp)
+	movl -80(%rbp), %eax
+	movl %eax, -76(%rbp)
+	movslq -40(%rbp), %rax
+	movabsq $119557037892, %rcx
+	addq %rcx, %rax
+	movl %eax, -40(%rbp)
+	movl $1000000007, -8(%rbp)
+	movl -80(%rbp), %eax
+	movzwl -36(%rbp), %ecx
+	addl %ecx, %eax
+	jne .L17
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L18
+.L17:
+	movl $1, %eax
+.L18:
+	movslq %eax, %rax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L8:
+	cmpq $391, %rax
+	je .L5
+	cmpq $449, %rax
+	je .L0
+	jmp .L0
+.L5:
+	cmpl $7, -52(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $79, %rax
+	cmpq $-679, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	addq $1, -24(%rbp)
+	jmp .L0
+.L4:
+	movb $0, -1(%rbp)
+	movw $-66, -10(%rbp)
+	movb $0, -1(%rbp)
+	jmp .L0
+.L3:
+	movq $0, -64(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -88(%rbp)
+	cmpq $33, -64(%rbp)
+	jge .L9
+	movq -64(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -96(%rbp)
+	cmpq $0, -96(%rbp)
+	je .L12
+	.p2align 4,,10
+.L11:
+	movswl g0(%rip), %eax
+	movb %al, -1(%rbp)
+	movl $255, %eax
+	cqo
+	idivq -88(%rbp)
+	movsbl %al, %eax
+	movl %eax, -52(%rbp)
+	addq $1, -64(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -1(%rbp)
+	movl -52(%rbp), %eax
+	movl %eax, -52(%rbp)
+	addq $1, -64(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -1(%rbp)
+	movl -52(%rbp), %eax
+	movl %eax, -52(%rbp)
+	addq $1, -64(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -1(%rbp)
+	movl -52(%rbp), %eax
+	movl %eax, -52(%rbp)
+	addq $1, -64(%rbp)
+	subq $1, -96(%rbp)
+	jne .L11
+.L12:
+.L9:
+.L10:
+	cmpq $33, -64(%rbp)
+	jge .L0
+	.p2align 4,,10
+.L13:
+	movswl g0(%rip), %eax
+	movb %al, -1(%rbp)
+	movl $255, %eax
+	cqo
+	idivq -88(%rbp)
+	movsbl %al, %eax
+	movl %eax, -52(%rbp)
+	addq $1, -64(%rbp)
+	cmpq $33, -64(%rbp)
+	jl .L13
+.L14:
+	jmp .L0
+.L6:
+	jmp .L0
+.L2:
+	movslq -40(%rbp), %rax
+	movslq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movl %eax, -40(%rbp)
+	movl $1, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movw %di, -2(%rbp)
+	movb %sil, -3(%rbp)
+	movl %edx, -8(%rbp)
+	movw %cx, -10(%rbp)
+	movq %r8, -24(%rbp)
+	movw %r9w, -26(%rbp)
+	movq $128, -40(%rbp)
+	movb $210, -41(%rbp)
+	movw $0, -44(%rbp)
+	movl $8, -48(%rbp)
+	movq $10, -56(%rbp)
+	movl $808, -60(%rbp)
+	movabsq $790048731763, %rax
+	movq %rax, -72(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -96(%rbp)
+	movl $10, -92(%rbp)
+	movl $20, -88(%rbp)
+	movl $30, -84(%rbp)
+	movl $4, -60(%rbp)
+	movl $5461, %eax
+	movslq %eax, %rax
+	cmpq $65, %rax
+	jge .L26
+	cmpq $-4, %rax
+	je .L20
+	cmpq $-3, %rax
+	je .L24
+	cmpq $54, %rax
+	je .L22
+	jmp .L19
+.L26:
+	cmpq $391, %rax
+	jge .L27
+	cmpq $65, %rax
+	je .L23
+	cmpq $139, %rax
+	je .L21
+.L20:
+.L19:
+	movzbl -3(%rbp), %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	jl .L34
+	cmpl $4, -116(%rbp)
+	jge .L34
+	movzwl -44(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -3(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L34:
+.L35:
+	movzwl -2(%rbp), %eax
+	addq 16(%rbp), %rax
+	jne .L36
+	movabsq $459970124585, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L37
+.L36:
+	movl $1, %eax
+.L37:
+	movl %eax, -84(%rbp)
+	movl -96(%rbp), %eax
+	movl %eax, -92(%rbp)
+	movslq -48(%rbp), %rax
+	movabsq $119557037892, %rcx
+	addq %rcx, %rax
+	movl %eax, -48(%rbp)
+	movl $1000000007, -8(%rbp)
+	movl -96(%rbp), %eax
+	movzwl -44(%rbp), %ecx
+	addl %ecx, %eax
+	jne .L38
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L39
+.L38:
+	movl $1, %eax
+.L39:
+	movslq %eax, %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L27:
+	cmpq $391, %rax
+	je .L24
+	cmpq $449, %rax
+	je .L19
+	jmp .L19
+.L24:
+	movswl -26(%rbp), %eax
+	cmpl -60(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $79, %rax
+	cmpq $-679, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	addq $1, -24(%rbp)
+	jmp .L19
+.L23:
+	movb $0, -3(%rbp)
+	movw $-66, -10(%rbp)
+	movb $0, -3(%rbp)
+	jmp .L19
+.L22:
+	movq $0, -72(%rbp)
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -104(%rbp)
+	cmpq $33, -72(%rbp)
+	jge .L28
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L31
+	.p2align 4,,10
+.L30:
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl $255, %eax
+	cqo
+	idivq -104(%rbp)
+	movsbl %al, %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	subq $1, -112(%rbp)
+	jne .L30
+.L31:
+.L28:
+.L29:
+	cmpq $33, -72(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L32:
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl $255, %eax
+	cqo
+	idivq -104(%rbp)
+	movsbl %al, %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	cmpq $33, -72(%rbp)
+	jl .L32
+.L33:
+	jmp .L19
+.L25:
+	jmp .L19
+.L21:
+	cmpl $0, 24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -48(%rbp)
+	movl 24(%rbp), %eax
+	addl $98, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $784, %eax
+	subq 16(%rbp), %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movw %di, -2(%rbp)
+	movb %sil, -3(%rbp)
+	movl %edx, -8(%rbp)
+	movw %cx, -10(%rbp)
+	movq %r8, -24(%rbp)
+	movw %r9w, -26(%rbp)
+	movq $128, -40(%rbp)
+	movb $210, -41(%rbp)
+	movw $0, -44(%rbp)
+	movl $8, -48(%rbp)
+	movq $10, -56(%rbp)
+	movl $808, -60(%rbp)
+	movabsq $790048731763, %rax
+	movq %rax, -72(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -96(%rbp)
+	movl $10, -92(%rbp)
+	movl $20, -88(%rbp)
+	movl $30, -84(%rbp)
+	movl $4, -60(%rbp)
+	movl $5461, %eax
+	movslq %eax, %rax
+	cmpq $65, %rax
+	jge .L47
+	cmpq $-4, %rax
+	je .L41
+	cmpq $-3, %rax
+	je .L45
+	cmpq $54, %rax
+	je .L43
+	jmp .L40
+.L47:
+	cmpq $391, %rax
+	jge .L48
+	cmpq $65, %rax
+	je .L44
+	cmpq $139, %rax
+	je .L42
+.L41:
+.L40:
+	movzbl -3(%rbp), %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	jl .L55
+	cmpl $4, -116(%rbp)
+	jge .L55
+	movzwl -44(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -3(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L55:
+.L56:
+	movzwl -2(%rbp), %eax
+	addq $1, %rax
+	jne .L57
+	movabsq $459970124585, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L58
+.L57:
+	movl $1, %eax
+.L58:
+	movl %eax, -84(%rbp)
+	movl -96(%rbp), %eax
+	movl %eax, -92(%rbp)
+	movslq -48(%rbp), %rax
+	movabsq $119557037892, %rcx
+	addq %rcx, %rax
+	movl %eax, -48(%rbp)
+	movl $1000000007, -8(%rbp)
+	movl -96(%rbp), %eax
+	movzwl -44(%rbp), %ecx
+	addl %ecx, %eax
+	jne .L59
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L60
+.L59:
+	movl $1, %eax
+.L60:
+	movslq %eax, %rax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L48:
+	cmpq $391, %rax
+	je .L45
+	cmpq $449, %rax
+	je .L40
+	jmp .L40
+.L45:
+	movswl -26(%rbp), %eax
+	cmpl -60(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $79, %rax
+	cmpq $-679, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	addq $1, -24(%rbp)
+	jmp .L40
+.L44:
+	movb $0, -3(%rbp)
+	movw $-66, -10(%rbp)
+	movb $0, -3(%rbp)
+	jmp .L40
+.L43:
+	movq $0, -72(%rbp)
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -104(%rbp)
+	cmpq $33, -72(%rbp)
+	jge .L49
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L52
+	.p2align 4,,10
+.L51:
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl $255, %eax
+	cqo
+	idivq -104(%rbp)
+	movsbl %al, %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	subq $1, -112(%rbp)
+	jne .L51
+.L52:
+.L49:
+.L50:
+	cmpq $33, -72(%rbp)
+	jge .L40
+	.p2align 4,,10
+.L53:
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl $255, %eax
+	cqo
+	idivq -104(%rbp)
+	movsbl %al, %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	cmpq $33, -72(%rbp)
+	jl .L53
+.L54:
+	jmp .L40
+.L46:
+	jmp .L40
+.L42:
+	cmpl $0, 16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -48(%rbp)
+	movl 16(%rbp), %eax
+	addl $98, %eax
+	movslq %eax, %rax
+	cmpq $783, %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f0.constprop.2_return
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq %rdi, -48(%rbp)
+	movl %esi, -56(%rbp)
+	movw %dx, -58(%rbp)
+	movq %r8, -40(%rbp)
+	movb %r9b, -60(%rbp)
+	movq $8, -32(%rbp)
+	movb $2, -59(%rbp)
+	movl $746, -52(%rbp)
+	movq $7, -16(%rbp)
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzwl %dx, %eax
+	cmpl $4, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movl ga0+28(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rsi
+	movzbl %r9b, %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $553690050171, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0.constprop.1
+	movl $6, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $895, %rax
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movzbl -59(%rbp), %eax
+	movabsq $247686435473, %rcx
+	addq %rcx, %rax
+	imulq -40(%rbp), %rax
+	cmpq $1, %rax
+	je .L64
+	cmpq $2, %rax
+	je .L62
+.L63:
+	movq -48(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -48(%rbp)
+	movl ga0+12(%rip), %eax
+	cmpl %eax, -56(%rbp)
+	jbe .L71
+	movq -24(%rbp), %rax
+	addq $3, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	subl $1, %eax
+	cmpl $128, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movw %ax, -58(%rbp)
+	cmpq $0, -48(%rbp)
+	je .L73
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $541, %eax
+	xorl %edx, %edx
+	divq %rcx
+	cmpq $10, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -60(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -60(%rbp)
+	jmp .L72
+.L75:
+	movl $1, %eax
+.L76:
+	pushq %rax
+	movq -32(%rbp), %rax
+	pushq %rax
+	movslq -52(%rbp), %rax
+	pushq %rax
+	movl ga0+28(%rip), %eax
+	movq %rax, %r9
+	movswq g0(%rip), %rax
+	movq %rax, %r8
+	movzwl -58(%rbp), %eax
+	movq %rax, %rcx
+	movl $755, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movzwl -58(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %r9
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movswl g0(%rip), %eax
+	movq %rax, %rcx
+	movl $970, %eax
+	movq %rax, %rdx
+	movsbq g1(%rip), %rax
+	imulq -16(%rbp), %rax
+	movq %rax, %rsi
+	movzbl -60(%rbp), %eax
+	imulq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $16, %rsp
+	movb %al, -60(%rbp)
+.L72:
+.L64:
+	movabsq $130132008706, %rax
+	cmpq $378, %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl $7, %eax
+	je .L77
+	cmpq $663, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L78
+.L77:
+	movl $1, %eax
+.L78:
+	movl %eax, -56(%rbp)
+	movq $0, -40(%rbp)
+	movzwl -58(%rbp), %eax
+	cmpl -56(%rbp), %eax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	pushq %rax
+	movl $8, %eax
+	testl %eax, %eax
+	je .L79
+	movl $10, %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .L80
+.L79:
+	movl $0, %eax
+.L80:
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	cmpq $17, -40(%rbp)
+	jge .L81
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L84
+	.p2align 4,,10
+.L83:
+	cmpb $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movslq -16(%rbp), %rax
+	movq %rax, -24(%rbp)
+	addq $1, -40(%rbp)
+	cmpb $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+	addq $1, -40(%rbp)
+	cmpb $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+	addq $1, -40(%rbp)
+	cmpb $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq -24(%rbp), %rax
+	addq $1, -40(%rbp)
+	subq $1, -8(%rbp)
+	jne .L83
+.L84:
+.L81:
+.L82:
+	cmpq $17, -40(%rbp)
+	jge .L86
+	.p2align 4,,10
+.L85:
+	cmpb $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movslq -16(%rbp), %rax
+	addq $1, -40(%rbp)
+	cmpq $17, -40(%rbp)
+	jl .L85
+.L86:
+.L61:
+	xorl %eax, %eax
+	subq -48(%rbp), %rax
+	cmpq $2147483647, %rax
+	setne %al
+	movzbl %al, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movzbl -60(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl $632, %eax
+	cmpl $8, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	leave
+	ret
+.L62:
+	movabsq $792230271819, %rax
+	testq %rax, %rax
+	je .L61
+	movq $0, -32(%rbp)
+	cmpq $5, -32(%rbp)
+	jae .L68
+	.p2align 4,,10
+.L67:
+	movl $5, %eax
+	testl %eax, %eax
+	je .L69
+.L68:
+	movzbl -59(%rbp), %eax
+	cmpl $6, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	addq -32(%rbp), %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	subq $8, %rsp
+	movl -52(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movzbl -59(%rbp), %eax
+	movq %rax, %r9
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $718, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %r8
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movzbl -60(%rbp), %eax
+	addq -48(%rbp), %rax
+	movq %rax, %rdx
+	cmpb $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl ga0+12(%rip), %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	addq $16, %rsp
+.L65:
+.L66:
+	jmp .L61
+.L69:
+.L70:
+	addq $1, -32(%rbp)
+	cmpq $5, -32(%rbp)
+	jb .L67
+	jmp .L68
+.L73:
+	movq -32(%rbp), %rax
+.L74:
+	jmp .L72
+.L71:
+	subq $8, %rsp
+	cmpq $0, -32(%rbp)
+	jne .L75
+	cmpl $0, -56(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L76
+	.size f1, .-f1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movw %di, -2(%rbp)
+	movb %sil, -3(%rbp)
+	movl %edx, -8(%rbp)
+	movw %cx, -10(%rbp)
+	movq %r8, -24(%rbp)
+	movq %r9, -32(%rbp)
+	movq $128, -40(%rbp)
+	movb $210, -41(%rbp)
+	movw $0, -44(%rbp)
+	movl $8, -48(%rbp)
+	movq $10, -56(%rbp)
+	movl $808, -60(%rbp)
+	movabsq $790048731763, %rax
+	movq %rax, -72(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -96(%rbp)
+	movl $10, -92(%rbp)
+	movl $20, -88(%rbp)
+	movl $30, -84(%rbp)
+	movl $4, -60(%rbp)
+	movl $5461, %eax
+	movslq %eax, %rax
+	cmpq $65, %rax
+	jge .L94
+	cmpq $-4, %rax
+	je .L88
+	cmpq $-3, %rax
+	je .L92
+	cmpq $54, %rax
+	je .L90
+	jmp .L87
+.L94:
+	cmpq $391, %rax
+	jge .L95
+	cmpq $65, %rax
+	je .L91
+	cmpq $139, %rax
+	je .L89
+.L88:
+.L87:
+	movzbl -3(%rbp), %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	jl .L102
+	cmpl $4, -116(%rbp)
+	jge .L102
+	movzwl -44(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -3(%rbp), %eax
+	movl %ecx, -96(%rbp,%rax,4)
+.L102:
+.L103:
+	movzwl -2(%rbp), %eax
+	addq -32(%rbp), %rax
+	jne .L104
+	movabsq $459970124585, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L105
+.L104:
+	movl $1, %eax
+.L105:
+	movl %eax, -84(%rbp)
+	movl -96(%rbp), %eax
+	movl %eax, -92(%rbp)
+	movslq -48(%rbp), %rax
+	movabsq $119557037892, %rcx
+	addq %rcx, %rax
+	movl %eax, -48(%rbp)
+	movl $1000000007, -8(%rbp)
+	movl -96(%rbp), %eax
+	movzwl -44(%rbp), %ecx
+	addl %ecx, %eax
+	jne .L106
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L106:
+	movl $1, %eax
+.L107:
+	movslq %eax, %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L95:
+	cmpq $391, %rax
+	je .L92
+	cmpq $449, %rax
+	je .L87
+	jmp .L87
+.L92:
+	cmpl $0, -60(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $79, %rax
+	cmpq $-679, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	addq $1, -24(%rbp)
+	jmp .L87
+.L91:
+	movb $0, -3(%rbp)
+	movw $-66, -10(%rbp)
+	movb $0, -3(%rbp)
+	jmp .L87
+.L90:
+	movq $0, -72(%rbp)
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -104(%rbp)
+	cmpq $33, -72(%rbp)
+	jge .L96
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L99
+	.p2align 4,,10
+.L98:
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl $255, %eax
+	cqo
+	idivq -104(%rbp)
+	movsbl %al, %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	subq $1, -112(%rbp)
+	jne .L98
+.L99:
+.L96:
+.L97:
+	cmpq $33, -72(%rbp)
+	jge .L87
+	.p2align 4,,10
+.L100:
+	movswl g0(%rip), %eax
+	movb %al, -3(%rbp)
+	movl $255, %eax
+	cqo
+	idivq -104(%rbp)
+	movsbl %al, %eax
+	movl %eax, -60(%rbp)
+	addq $1, -72(%rbp)
+	cmpq $33, -72(%rbp)
+	jl .L100
+.L101:
+	jmp .L87
+.L93:
+	jmp .L87
+.L89:
+	cmpl $0, 16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movslq -48(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -48(%rbp)
+	movl 16(%rbp), %eax
+	addl $98, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $784, %eax
+	subq -32(%rbp), %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq %rdi, -32(%rbp)
+	movl %esi, -68(%rbp)
+	movb %dl, -72(%rbp)
+	movl $368, -64(%rbp)
+	movb $119, -71(%rbp)
+	movw $10, -70(%rbp)
+	movl $2, -60(%rbp)
+	movq $9, -24(%rbp)
+	movl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq %rdi, %rax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movzbl -71(%rbp), %eax
+	movq %rax, %r9
+	movl %esi, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movsbl -72(%rbp), %eax
+	movq %rax, %rsi
+	movl $24235, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movsbl -72(%rbp), %eax
+	movl %eax, -56(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -48(%rbp)
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movl $-1, %eax
+	movq %rax, %rcx
+	movzbl -71(%rbp), %eax
+	movl %eax, -52(%rbp)
+	movq %rax, %rdx
+	movl -60(%rbp), %eax
+	movq %rax, %rsi
+	cmpl $128, -56(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $39, %eax
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movswq g0(%rip), %rax
+	cmpq $585, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $627, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	je .L108
+	movl $255, %eax
+	pushq %rax
+	movswq g0(%rip), %rax
+	pushq %rax
+	movzbl -71(%rbp), %eax
+	pushq %rax
+	movl $312, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $127, %eax
+	pushq %rax
+	movl $758, %eax
+	pushq %rax
+	movsbl -72(%rbp), %eax
+	movq %rax, %r9
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movswl g0(%rip), %eax
+	movq %rax, %rdx
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movl ga0+28(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	movl -68(%rbp), %eax
+	movq %rax, %r9
+	movl $2, %eax
+	movq %rax, %r8
+	movzbl -71(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movq %rax, %rcx
+	movl $2, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	cmpl $1, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movzwl -70(%rbp), %eax
+	movl %eax, -44(%rbp)
+	cmpl $9, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -60(%rbp), %eax
+	addl $8, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	je .L110
+	movl -56(%rbp), %eax
+	addl $713, %eax
+	pushq %rax
+	movzbl -71(%rbp), %eax
+	pushq %rax
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movsbq -72(%rbp), %rax
+	movq %rax, %r8
+	movl $112, %eax
+	movq %rax, %rcx
+	movl $-226, %eax
+	movq %rax, %rdx
+	movl $208, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl $0, -64(%rbp)
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl -64(%rbp), %eax
+	movw %ax, -36(%rbp)
+	movq %rax, %r9
+	movl $696, %eax
+	movq %rax, %r8
+	movl $79, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	movq %rax, %rdx
+	movl $11, %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	cmpl %eax, -68(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpl $65535, -68(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movq -24(%rbp), %rax
+	movb %al, -40(%rbp)
+	movq %rax, %r9
+	movl $151, %eax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movsbl -72(%rbp), %eax
+	movw %ax, -8(%rbp)
+	movq %rax, %rdx
+	movl -64(%rbp), %eax
+	movq %rax, %rsi
+	movl $423, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -44(%rbp), %eax
+	subl $8, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	testw %ax, %ax
+	je .L112
+	xorl %eax, %eax
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	pushq %rax
+	cmpb $0, -71(%rbp)
+	je .L114
+	movl $8, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L115
+.L116:
+	movl $1, %eax
+.L117:
+	popq %rcx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L108:
+.L109:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl -70(%rbp), %eax
+	movq %rax, -16(%rbp)
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L118
+	movl $8, %eax
+	subl -52(%rbp), %eax
+	subl $65436, %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movl %eax, -60(%rbp)
+	movq $0, -24(%rbp)
+	movl -64(%rbp), %eax
+	imull -64(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -36(%rbp)
+	cmpq $3, -24(%rbp)
+	jge .L121
+	.p2align 4,,10
+.L120:
+	movl -68(%rbp), %eax
+	movl %eax, -60(%rbp)
+	movl -60(%rbp), %eax
+	pushq %rax
+	movl -64(%rbp), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movl $-25087, %eax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	movq %rax, %rdx
+	movl ga0+4(%rip), %eax
+	movq %rax, %rsi
+	movl $255, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	je .L122
+	movswl g0(%rip), %eax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movzbl -71(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -71(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	addq $350, %rax
+	je .L124
+.L121:
+.L119:
+	movsbl g1(%rip), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $10, %eax
+	movq %rax, %r9
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl $279, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movl ga0+0(%rip), %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl ga0+4(%rip), %eax
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movzbl -71(%rbp), %eax
+	movq %rax, %r8
+	movl $-14836, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movswl g0(%rip), %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movb %al, -72(%rbp)
+	movl -64(%rbp), %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $46, %eax
+	movq %rax, %rdx
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f1
+	movq %rax, %r9
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl ga0+16(%rip), %eax
+	addl -64(%rbp), %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movl $2167103123, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f1
+	cmpw $0, -70(%rbp)
+	jne .L177
+	cmpl $0, -64(%rbp)
+	jne .L177
+.L175:
+.L176:
+	movl -68(%rbp), %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movsbl g1(%rip), %eax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movsbl g1(%rip), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	cmpq $552, %rax
+	jbe .L178
+	movl $0, -64(%rbp)
+	movl -68(%rbp), %eax
+	imull -68(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -36(%rbp)
+	cmpl $4, -64(%rbp)
+	jae .L181
+	.p2align 4,,10
+.L180:
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -60(%rbp)
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -64(%rbp), %eax
+	xorl %edx, %edx
+	divl -36(%rbp)
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	je .L182
+.L181:
+.L178:
+.L179:
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movzwl %ax, %eax
+	cmpq -32(%rbp), %rax
+	setbe %al
+	movzbl %al, %eax
+.f2_return:
+	leave
+	ret
+.L182:
+.L183:
+	addl $1, -64(%rbp)
+	cmpl $4, -64(%rbp)
+	jb .L180
+	jmp .L181
+.L126:
+.L127:
+.L122:
+.L123:
+	addq $1, -24(%rbp)
+	cmpq $3, -24(%rbp)
+	jl .L120
+	jmp .L121
+.L124:
+.L125:
+	movl $6, %eax
+	xorl %edx, %edx
+	divl -36(%rbp)
+	testl %eax, %eax
+	jne .L126
+	jmp .L121
+.L118:
+	movl -60(%rbp), %eax
+	imull -60(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movswl g0(%rip), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	cmpl $0, -56(%rbp)
+	setle %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	movslq %eax, %rax
+	cmpq $58, %rax
+	jge .L135
+	cmpq $-5, %rax
+	je .L129
+	cmpq $2, %rax
+	je .L134
+.L132:
+	jmp .L128
+.L112:
+	cmpq $8, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movl $32, %eax
+	movq %rax, %r8
+	movl $161, %eax
+	movq %rax, %rcx
+	movl -48(%rbp), %eax
+	movq %rax, %rdx
+	movl $497, %eax
+	movq %rax, %rsi
+	movl $756, %eax
+	movq %rax, %rdi
+	call f1
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	cmpb $0, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $271, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movl %eax, -68(%rbp)
+	subq $8, %rsp
+	movl -44(%rbp), %eax
+	pushq %rax
+	movswq -36(%rbp), %rax
+	pushq %rax
+	movabsq $869932661733, %rax
+	pushq %rax
+	cmpl $0, -68(%rbp)
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	movq %rax, %r9
+	movl $188, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movswq g0(%rip), %rax
+	movq %rax, %rdi
+	call f1
+	pushq %rax
+	subq $8, %rsp
+	movl -68(%rbp), %eax
+	pushq %rax
+	movl $361, %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %r9
+	movl -68(%rbp), %eax
+	movq %rax, %r8
+	movl $29197, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movzbl -40(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.0
+	addq $16, %rsp
+.L113:
+.L110:
+.L111:
+	movl -60(%rbp), %eax
+	imull -60(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	imull $913, -44(%rbp), %eax
+	testl %eax, %eax
+	jne .L116
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L117
+.L135:
+	cmpq $58, %rax
+	je .L130
+	cmpq $247, %rax
+	je .L133
+	cmpq $616, %rax
+	je .L131
+	jmp .L128
+.L134:
+	movq $0, -24(%rbp)
+	cmpq $5, -24(%rbp)
+	jge .L149
+	.p2align 4,,10
+.L148:
+	movl -60(%rbp), %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movzwl -70(%rbp), %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl -68(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	je .L150
+.L149:
+.L128:
+	movl $192, %eax
+	pushq %rax
+	movslq -60(%rbp), %rax
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	movq %rax, %r9
+	movslq -60(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq %rax, %r8
+	movl $452, %eax
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	movq %rax, %rdx
+	movl ga0+24(%rip), %eax
+	movq %rax, %rsi
+	movl ga0+16(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	cmpq $5, %rcx
+	ja .L152
+	leaq .L159(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L153
+	# table target .L157
+	# table target .L155
+	# table target .L156
+	# table target .L154
+	jmp *%rcx
+.L158:
+.L153:
+	jmp .L152
+.L165:
+.L160:
+	movl $0, -64(%rbp)
+	movl $-905, -40(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $3, -64(%rbp)
+	jae .L170
+	.p2align 4,,10
+.L169:
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl $127, %eax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movq %rax, %rdx
+	movl ga0+16(%rip), %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movl $3, %eax
+	movq %rax, %r9
+	movq -8(%rbp), %rax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $471, %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl -64(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	pushq %rax
+	movl $65536, %eax
+	pushq %rax
+	movl -68(%rbp), %eax
+	pushq %rax
+	movl -68(%rbp), %eax
+	pushq %rax
+	movl -68(%rbp), %eax
+	movq %rax, %r9
+	movl $7, %eax
+	movq %rax, %r8
+	movsbl -72(%rbp), %eax
+	movq %rax, %rcx
+	movl $269, %eax
+	movq %rax, %rdx
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -60(%rbp), %eax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl %eax, -68(%rbp)
+	cmpl $0, -36(%rbp)
+	je .L171
+.L170:
+.L152:
+	movl ga0+16(%rip), %eax
+	addl $9, %eax
+	pushq %rax
+	movl $127, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl -60(%rbp), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movswq g0(%rip), %rax
+	movq %rax, %rcx
+	movl $32767, %eax
+	movq %rax, %rdx
+	movl $278, %eax
+	movq %rax, %rsi
+	movl -64(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	jmp .L119
+.L171:
+.L172:
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	je .L173
+	jmp .L170
+.L173:
+.L174:
+	addl $1, -64(%rbp)
+	cmpl $3, -64(%rbp)
+	jb .L169
+	jmp .L170
+.L150:
+.L151:
+	addq $1, -24(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L148
+	jmp .L149
+.L114:
+	movl $0, %eax
+.L115:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl -16(%rbp), %eax
+	movq %rax, %rsi
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f1
+	jmp .L113
+.L129:
+	movq -24(%rbp), %rax
+	movq %rax, -24(%rbp)
+	cmpw $0, -70(%rbp)
+	je .L128
+	movsbl -72(%rbp), %eax
+	movl %eax, -36(%rbp)
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -71(%rbp), %eax
+	movl %eax, -36(%rbp)
+	cltd
+	idivl %ecx
+	popq %rcx
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl -36(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl -64(%rbp), %eax
+	movsbq %al, %rax
+	pushq %rax
+	movq $-5, %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movl ga0+16(%rip), %eax
+	movl ga0+24(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+.L136:
+.L137:
+	jmp .L128
+.L130:
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	jne .L138
+	cmpb $0, -72(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L139
+.L138:
+	movl $1, %eax
+.L139:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movzwl %ax, %eax
+	movl %eax, -60(%rbp)
+	movzwl -70(%rbp), %eax
+	pushq %rax
+	movswq g0(%rip), %rax
+	pushq %rax
+	movl $10, %eax
+	movq %rax, %r9
+	movl $552, %eax
+	movq %rax, %r8
+	movl $162, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	movq %rax, %rdx
+	movl -60(%rbp), %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testq %rax, %rax
+	je .L140
+	movl $9, %eax
+	pushq %rax
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl ga0+16(%rip), %eax
+	movq %rax, %r9
+	movl $7, %eax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movsbl -72(%rbp), %eax
+	movq %rax, %rdx
+	movl ga0+28(%rip), %eax
+	movq %rax, %rsi
+	movswl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L141
+.L140:
+	movl $0, %eax
+.L141:
+	movl %eax, -68(%rbp)
+	jmp .L128
+.L133:
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl -70(%rbp), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movl ga0+8(%rip), %eax
+	sall $3, %eax
+	imull %ecx, %eax
+	addl $1, %eax
+	movl %eax, -68(%rbp)
+	movsbl g1(%rip), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	jmp .L128
+.L131:
+	movl $4, %eax
+	pushq %rax
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movl $188, %eax
+	movq %rax, %r8
+	movl $80, %eax
+	movq %rax, %rcx
+	movl $752, %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl $340, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movzwl -70(%rbp), %eax
+	movsbl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl $833, %eax
+	movq %rax, %rdx
+	movzwl -70(%rbp), %eax
+	movq %rax, %rsi
+	movsbl -72(%rbp), %eax
+	movl %eax, -36(%rbp)
+	movq %rax, %rcx
+	movl $474, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	movsbq -72(%rbp), %rax
+	cmpq %rax, -32(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $255044218807, %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L128
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movswl g0(%rip), %eax
+	addl $3, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movswl g0(%rip), %eax
+	movq %rax, %r9
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movzwl -70(%rbp), %eax
+	movq %rax, %rcx
+	cmpq $710, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	cmpl $6, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -71(%rbp)
+	cmpb $0, -71(%rbp)
+	je .L144
+	cmpb $0, -71(%rbp)
+	jne .L146
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L145
+.L144:
+	movl $0, %eax
+.L145:
+	movb %al, -72(%rbp)
+.L142:
+.L143:
+	jmp .L128
+.L146:
+	movl $1, %eax
+.L147:
+	jmp .L145
+.L155:
+	jmp .L152
+.L156:
+	cmpb $0, -72(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+.L157:
+	movl $3, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $5, %rcx
+	ja .L165
+	leaq .L166(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L160
+	# table target .L163
+	# table target .L162
+	# table target .L161
+	# table target .L164
+	jmp *%rcx
+.L161:
+	jmp .L160
+.L162:
+	jmp .L160
+.L163:
+	movl $9, %eax
+	movq %rax, %r9
+	movzwl -70(%rbp), %eax
+	movq %rax, %r8
+	movl -64(%rbp), %eax
+	imull -64(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $256, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movsbl g1(%rip), %eax
+	cmpl $5, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+	jmp .L160
+.L164:
+	movl $986, %eax
+	subq -16(%rbp), %rax
+	je .L167
+	movl $665, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L168
+.L167:
+	movl $1, %eax
+.L168:
+	movb %al, -71(%rbp)
+	jmp .L160
+.L177:
+	movsbl -72(%rbp), %eax
+	movl %eax, -36(%rbp)
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	cmpl $1000000007, %eax
+	setg %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	jmp .f2_return
+.L154:
+	movswl g0(%rip), %eax
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movzwl %ax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $553613132, %eax
+	pushq %rax
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $-15474, %eax
+	movq %rax, %r9
+	movl $783, %eax
+	movq %rax, %r8
+	movl ga0+28(%rip), %eax
+	movq %rax, %rcx
+	movsbl -72(%rbp), %eax
+	movq %rax, %rdx
+	movl $92, %eax
+	movq %rax, %rsi
+	movl $52933, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	popq %rcx
+	subq %rcx, %rax
+	movl $9, %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L159:
+	.long .L157-.L159
+	.long .L155-.L159
+	.long .L153-.L159
+	.long .L156-.L159
+	.long .L156-.L159
+	.long .L154-.L159
+	.p2align 2
+.L166:
+	.long .L163-.L166
+	.long .L162-.L166
+	.long .L160-.L166
+	.long .L160-.L166
+	.long .L161-.L166
+	.long .L164-.L166
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq $593, -8(%rbp)
+	movb $0, -9(%rbp)
+	movb $4, -10(%rbp)
+	movq $733, -24(%rbp)
+	movw $32767, -26(%rbp)
+	movl $514, -32(%rbp)
+	movl $251, -36(%rbp)
+	movq $599, -48(%rbp)
+	movl $0, -36(%rbp)
+	movl $0, -64(%rbp)
+	movl $589, -60(%rbp)
+	movl $1178, -56(%rbp)
+	movl $1767, -52(%rbp)
+	movl $4, -36(%rbp)
+	movq $2, -8(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -72(%rbp)
+	addq %rax, -48(%rbp)
+	movswl g0(%rip), %eax
+	cmpl $8, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl -60(%rbp), %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movswl g0(%rip), %eax
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl $50, %eax
+	movq %rax, %rsi
+	movsbl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	popq %rcx
+	imulq %rcx, %rax
+	movw %ax, -26(%rbp)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -80(%rbp)
+	movq %rax, %rcx
+	movl $582, %eax
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movswl g0(%rip), %eax
+	cmpl -32(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl $51719, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movq %rax, %r9
+	movl $128, %eax
+	movq %rax, %r8
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl $735, %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rsi
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	movl -56(%rbp), %eax
+	movq %rax, %r9
+	movswq -26(%rbp), %rax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl $379, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	addl $792, %eax
+	jne .L186
+	movswl -26(%rbp), %eax
+	cmpl $400, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	subl %ecx, %eax
+	je .L184
+.L186:
+	movw $0, -26(%rbp)
+	movq -80(%rbp), %rax
+	movq %rax, -88(%rbp)
+	imull $232, -32(%rbp), %eax
+	movl %eax, -92(%rbp)
+	movl $-102, -96(%rbp)
+	movl $0, -100(%rbp)
+	movzbl -10(%rbp), %eax
+	movl %eax, -108(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -104(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -112(%rbp)
+	cmpl $4, %eax
+	jge .L188
+	.p2align 4,,10
+.L187:
+	cmpb $0, -10(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L197
+	leaq .L198(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L195
+	# table target .L196
+	# table target .L194
+	# table target .L193
+	# table target .L190
+	# table target .L192
+	# table target .L191
+	jmp *%rcx
+.L197:
+.L195:
+	cmpq $0, -8(%rbp)
+	jne .L205
+	movl ga0+24(%rip), %eax
+	movq %rax, %r9
+	xorl %eax, %eax
+	movq %rax, %r8
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movzbl -9(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	je .L203
+.L205:
+.L189:
+	movl -112(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -26(%rbp)
+	movswl -26(%rbp), %eax
+	movl %eax, -112(%rbp)
+	cmpl $4, %eax
+	jl .L187
+.L188:
+	movsbl g1(%rip), %eax
+	testl %eax, %eax
+	jl .L206
+	movsbl g1(%rip), %eax
+	cmpl $4, %eax
+	jge .L206
+	movsbq g1(%rip), %rax
+	movl $5, -64(%rbp,%rax,4)
+.L206:
+.L207:
+.L184:
+.L185:
+	movq -48(%rbp), %rax
+	addq %rax, -24(%rbp)
+	movl $190, %eax
+	movq %rax, %r9
+	movslq -32(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movq %rax, %r8
+	movl $552, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movswl g0(%rip), %eax
+	movq %rax, %rsi
+	movl $662, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movzbl -10(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -10(%rbp)
+	movw $10, -26(%rbp)
+	movq $0, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movswq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movsbq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movzbl -9(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movzbl -10(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	movswq -26(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -128(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -72(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $31, -136(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jge .L208
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L211
+	.p2align 4,,10
+.L210:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -144(%rbp)
+	jne .L210
+.L211:
+.L208:
+.L209:
+	cmpl $8, -36(%rbp)
+	jge .L213
+	.p2align 4,,10
+.L212:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L212
+.L213:
+	movl $0, -36(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl -52(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -136(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movl $4, -36(%rbp)
+	movq -136(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -136(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -136(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -136(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -136(%rbp)
+	movq -136(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L203:
+.L204:
+	movl -32(%rbp), %eax
+	movw %ax, g0(%rip)
+	jmp .L189
+.L190:
+	movl $870, %eax
+	xorl %edx, %edx
+	divq -88(%rbp)
+	movq %rax, -8(%rbp)
+.L191:
+	cmpl $0, -92(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movzbl -9(%rbp), %eax
+	movl %eax, -116(%rbp)
+	imull -116(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L189
+	movl -108(%rbp), %eax
+	pushq %rax
+	movabsq $228141967225, %rax
+	pushq %rax
+	movl $826, %eax
+	movq %rax, %r9
+	movl $340, %eax
+	movq %rax, %r8
+	movl $966, %eax
+	movq %rax, %rcx
+	movl $620, %eax
+	movq %rax, %rdx
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testq %rax, %rax
+	je .L189
+	jmp .L189
+.L199:
+.L200:
+	jmp .L189
+.L192:
+	movl -64(%rbp), %eax
+	subl -108(%rbp), %eax
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	ja .L201
+	jmp .L189
+.L201:
+.L202:
+	movl -96(%rbp), %eax
+	movb %al, -9(%rbp)
+	jmp .L189
+.L193:
+	movw $0, g0(%rip)
+	movl -100(%rbp), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $11, %eax
+	pushq %rax
+	movl -32(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -32(%rbp), %eax
+	pushq %rax
+	movl $8, %eax
+	pushq %rax
+	movl ga0+16(%rip), %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl $918, %eax
+	movq %rax, %rcx
+	movl -112(%rbp), %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movzbl -10(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl -36(%rbp), %eax
+	movq %rax, %rdx
+	movl $26, %eax
+	movq %rax, %rsi
+	movl $65535, %eax
+	movq %rax, %rdi
+	call f2
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L189
+.L194:
+	jmp .L189
+.L196:
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movabsq $453996000838, %rax
+	movq %rax, %rdi
+	call f2
+	addq $8, %rsp
+	movsbl %al, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	movl -64(%rbp), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movswl g0(%rip), %eax
+	movswl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -104(%rbp), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movswq -26(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	jmp .L189
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L198:
+	.long .L196-.L198
+	.long .L194-.L198
+	.long .L195-.L198
+	.long .L195-.L198
+	.long .L195-.L198
+	.long .L193-.L198
+	.long .L195-.L198
+	.long .L190-.L198
+	.long .L192-.L198
+	.long .L191-.L198
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,122 @@
+unsigned int g0;
+long g1 = 5;
+unsigned char g2 = 2147483647;
+int ga0[4];
+int ga1[4];
+unsigned int rec(unsigned int n, unsigned int acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 3, acc * 3 + n);
+}
+int main() {
+    unsigned char v0 = 10;
+    char v1 = 756972389965;
+    unsigned long v2 = 884;
+    char v3 = 673;
+    int i0 = 985U;
+    long j0 = 1;
+    switch (((ga1[2] / (j0 * j0 + 1)) != (char)(g0))) {
+    case 25:
+        if (j0 >= 0 && j0 < 4) { ga1[j0] = v3; }
+        rec(5, (445 != g2));
+        break;
+    case -1:
+        break;
+    case 3:
+        if (v1 >= 0 && v1 < 4) { ga0[v1] = ((4294967295 / 4) >= ga1[3]); }
+        break;
+    case 66:
+        switch (-((v3 + ga1[0]))) {
+        case 3:
+            break;
+        case 5:
+            i0 = ga1[0];
+            switch ((ga0[2] + -(128u))) {
+            case -4:
+                ga0[2] = (g2 / 2);
+            case 166:
+                rec((2 >= g2), g1);
+                break;
+            default:
+                i0 = i0 + (4 >= v1);
+                v0 = -(v1);
+                break;
+            case 0:
+                ga1[1] = 239;
+                break;
+            }
+        case 8:
+            g2 = v3;
+        default:
+            if (g2) { return ((j0 - g0) == 8); }
+        case 0:
+            i0 = i0 + g0;
+            if (v3 >= 0 && v3 < 4) { ga1[v3] = (-(0l) == (1 * g1)); }
+            break;
+        case 10:
+            break;
+        case 7:
+        case 4:
+            j0 = ((long)(v3) == 1);
+            break;
+        }
+        g0 = (unsigned int)((rec(g1, ga1[0]) > (ga0[3] == 345838340718)));
+    case 43:
+        if (((v3 / (g1 * g1 + 1)) && 3)) {
+            j0 = -((g1 == (g2 > j0)));
+        }
+        break;
+    case 4:
+        if ((((8 == g0) + 489) <= !(ga0[0]))) {
+            g1 = rec((v2 >= 1062684195745), (g2 > 105));
+            if ((((273967109099 == g2) == (750903618545 != 463u)) / 7)) {
+                i0 = 917663011440;
+                rec(!(v1), rec(v0, j0));
+                rec(rec(ga1[1], 8), (g0 * 950322518812));
+            } else {
+                rec(6, ga0[1]);
+                ga1[2] = ((i0 - 3) == rec(ga1[3], j0));
+            }
+        }
+        j0 = 9;
+        break;
+    case -5:
+        for (i0 = 1; i0 < 3; i0 = i0 + 1) {
+            if (ga0[2]) { return rec(415, 9); }
+            if (v1 >= 0 && v1 < 4) { ga1[v1] = g0; }
+            g2 = -(rec(j0, 9U));
+        }
+        for (v2 = 0; v2 < 3; v2 = v2 + 1) {
+            if (v0) { return ((v3 / (i0 * i0 + 1)) != (g2 > 127u)); }
+            if (rec(9, g2)) {
+                g1 = (((ga0[0] <= 4) > rec(ga0[1], g2)) / 10);
+                g1 = -((g2 || 4));
+            } else {
+                g2 = (-(8) <= -(g2));
+            }
+            v0 = v0 + ((ga0[3] && i0) - rec(357, v3));
+        }
+        break;
+    case 40:
+        rec((217 || 9), (ga1[0] * 4));
+    }
+    v1 = rec((unsigned short)(315), (103 == 1));
+    g0 = (((int)(2) + rec(10, 5)) - (unsigned int)(!(105)));
+    g2 = g2 + ((1 / (v1 * v1 + 1)) <= rec(ga1[2], 4));
+    j0 = rec(ga1[3], 8);
+    rec(!(g2), v3);
+    g0 = 9;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
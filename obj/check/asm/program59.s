@@ -0,0 +1,1580 @@
+	.section .data
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.quad 5
+	.type g2, @object
+	.size g2, 1
+	.p2align 0
+g2:
+	.byte 255
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 16
+	.p2align 5
+ga1:
+	.zero 16
+	.section .text
+	.type rec, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $2, -8(%rbp)
+	jb .L2
+	cmpl $18, -8(%rbp)
+	ja .L2
+.L0:
+.L1:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L2:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb $10, -43(%rbp)
+	movb $77, -42(%rbp)
+	movq $884, -24(%rbp)
+	movb $-95, -41(%rbp)
+	movl $985, -40(%rbp)
+	movq $1, -16(%rbp)
+	movl g0(%rip), %eax
+	movsbq %al, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga1+8(%rip), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $40, %rax
+	jge .L12
+	leaq 5(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L13
+	leaq .L14(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L3
+	# table target .L10
+	# table target .L5
+	# table target .L6
+	# table target .L9
+	jmp *%rcx
+.L12:
+	cmpq $40, %rax
+	je .L11
+	cmpq $43, %rax
+	je .L8
+	cmpq $66, %rax
+	je .L7
+	jmp .L3
+.L11:
+	movl ga1+0(%rip), %eax
+	sall $2, %eax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	addl $1, %eax
+.L220:
+.L3:
+	movb $59, -42(%rbp)
+	movl $253, g0(%rip)
+	movl ga1+8(%rip), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jb .L224
+	cmpl $18, -8(%rbp)
+	jbe .L222
+.L224:
+	movl -8(%rbp), %eax
+	addl $4, %eax
+.L221:
+	pushq %rax
+	movsbl -42(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cmpl %ecx, %eax
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl g2(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g2(%rip)
+	movl ga1+12(%rip), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jb .L236
+	cmpl $18, -8(%rbp)
+	jbe .L234
+.L236:
+	movl -8(%rbp), %eax
+	addl $8, %eax
+.L233:
+	movl %eax, %eax
+	movq %rax, -16(%rbp)
+	cmpb $0, g2(%rip)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	movsbl -41(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L248
+	cmpl $18, -28(%rbp)
+	jbe .L246
+.L248:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L245:
+	movl $9, g0(%rip)
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl g2(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl -43(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq -42(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq -41(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -40(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga1+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -8(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L13:
+	cmpq $25, %rax
+	je .L4
+	jmp .L3
+.L222:
+.L223:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	movl -8(%rbp), %eax
+	addl $12, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L228
+	cmpl $18, -32(%rbp)
+	jbe .L226
+.L228:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L225:
+	jmp .L221
+.L234:
+.L235:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	movl -8(%rbp), %eax
+	addl $24, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L240
+	cmpl $18, -32(%rbp)
+	jbe .L238
+.L240:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L237:
+	jmp .L233
+.L246:
+.L247:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L252
+	cmpl $18, -32(%rbp)
+	jbe .L250
+.L252:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L249:
+	jmp .L245
+.L4:
+	cmpq $0, -16(%rbp)
+	jl .L15
+	cmpq $4, -16(%rbp)
+	jge .L15
+	movq -16(%rbp), %rax
+	movsbl -41(%rbp), %ecx
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L15:
+.L16:
+	movzbl g2(%rip), %eax
+	cmpl $445, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl $5, %eax
+	movl %eax, -8(%rbp)
+	movl $4294967295, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl $2, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L22
+	cmpl $18, -28(%rbp)
+	jbe .L20
+.L22:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L19:
+.L18:
+.L17:
+	jmp .L3
+.L33:
+.L29:
+	cmpb $0, g2(%rip)
+	jne .LB0
+.L52:
+.L53:
+.L30:
+	movl -40(%rbp), %eax
+	addl g0(%rip), %eax
+	movl %eax, -40(%rbp)
+	cmpl $0, -36(%rbp)
+	jl .L54
+	cmpl $4, -36(%rbp)
+	jge .L54
+	movsbq -41(%rbp), %rax
+	cmpq $0, g1(%rip)
+	sete %cl
+	movzbl %cl, %ecx
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L54:
+.L55:
+.L25:
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movabsq $345838340718, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq g1(%rip), %rax
+	movl %eax, -28(%rbp)
+	movl ga1+0(%rip), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L59
+	cmpl $18, -28(%rbp)
+	jbe .L57
+.L59:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L56:
+	popq %rcx
+	cmpl %ecx, %eax
+	seta %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+.L8:
+	movq g1(%rip), %rax
+	imulq g1(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbq -41(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L3
+	movl $3, %eax
+	testl %eax, %eax
+	je .L3
+	movzbl g2(%rip), %eax
+	cmpq -16(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+.L68:
+.L69:
+	jmp .L3
+.L7:
+	movsbl -41(%rbp), %eax
+	movl %eax, -36(%rbp)
+	movl ga1+0(%rip), %ecx
+	addl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L33
+	leaq .L34(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L29
+	# table target .L30
+	# table target .L26
+	# table target .L32
+	# table target .L27
+	# table target .L28
+	# table target .L31
+	jmp *%rcx
+.L226:
+.L227:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L232
+	cmpl $18, -28(%rbp)
+	jbe .L230
+.L232:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L229:
+	jmp .L221
+.L238:
+.L239:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L244
+	cmpl $18, -28(%rbp)
+	jbe .L242
+.L244:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L241:
+	jmp .L233
+.L250:
+.L251:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L256
+	cmpl $18, -28(%rbp)
+	jbe .L254
+.L256:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L253:
+	jmp .L245
+.L20:
+.L21:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L3
+.L230:
+.L231:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L221
+.L242:
+.L243:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L233
+.L254:
+.L255:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L245
+.L57:
+.L58:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L63
+	cmpl $18, -32(%rbp)
+	jbe .L61
+.L63:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L60:
+	jmp .L56
+.L61:
+.L62:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L67
+	cmpl $18, -28(%rbp)
+	jbe .L65
+.L67:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L64:
+	jmp .L56
+.L65:
+.L66:
+	subq $8, %rsp
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	jmp .L56
+.L5:
+	jmp .L3
+.L6:
+	movsbl -42(%rbp), %eax
+	movl %eax, -8(%rbp)
+	testl %eax, %eax
+	jl .L3
+	cmpl $4, -8(%rbp)
+	jge .L3
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	cmpq $1073741823, %rax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbq -42(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L23:
+.L24:
+	jmp .L3
+.L26:
+	jmp .L25
+.L27:
+	movl ga1+0(%rip), %eax
+	movl %eax, -40(%rbp)
+	movl ga0+8(%rip), %eax
+	addl $4294967168, %eax
+	movslq %eax, %rax
+	cmpq $-4, %rax
+	je .L36
+	cmpq $0, %rax
+	je .L39
+	cmpq $166, %rax
+	je .L37
+.L38:
+	movsbl -42(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, %eax
+	setle %al
+	movzbl %al, %eax
+	addl %eax, -40(%rbp)
+	xorl %eax, %eax
+	subl -8(%rbp), %eax
+	movb %al, -43(%rbp)
+	jmp .L35
+.L36:
+	movzbl g2(%rip), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movl %eax, ga0+8(%rip)
+.L37:
+	movzbl g2(%rip), %eax
+	cmpl $2, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	movq g1(%rip), %rax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L43
+	cmpl $18, -28(%rbp)
+	jbe .L41
+.L43:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L40:
+.L35:
+.L28:
+	movsbl -41(%rbp), %eax
+	movb %al, g2(%rip)
+	jmp .L29
+.L39:
+	movl $239, ga1+4(%rip)
+	jmp .L35
+.L41:
+.L42:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L47
+	cmpl $18, -32(%rbp)
+	jbe .L45
+.L47:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L44:
+	jmp .L40
+.L45:
+.L46:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L51
+	cmpl $18, -28(%rbp)
+	jbe .L49
+.L51:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L48:
+	jmp .L40
+.L49:
+.L50:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L40
+.L31:
+	jmp .L25
+.L32:
+	movsbq -41(%rbp), %rax
+	cmpq $1, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	jmp .L25
+.L9:
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $8, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	addl $489, %eax
+	cmpl %ecx, %eax
+	jg .L70
+	movabsq $1062684195745, %rax
+	cmpq %rax, -24(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	movzbl g2(%rip), %eax
+	cmpl $105, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L75
+	cmpl $18, -28(%rbp)
+	jbe .L73
+.L75:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L72:
+	movl %eax, %eax
+	movq %rax, g1(%rip)
+	movabsq $273967109099, %rax
+	movzbl g2(%rip), %ecx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L84
+	movl $-1459989904, -40(%rbp)
+	cmpb $0, -42(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movzbl -43(%rbp), %eax
+	movl %eax, -28(%rbp)
+	movq -16(%rbp), %rax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L90
+	cmpl $18, -28(%rbp)
+	jbe .L88
+.L90:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L87:
+	movl %eax, -8(%rbp)
+	cmpl $2, -36(%rbp)
+	jb .L109
+	cmpl $18, -36(%rbp)
+	jbe .L107
+.L109:
+	movl -8(%rbp), %eax
+	addl -36(%rbp), %eax
+.L86:
+	movl ga1+4(%rip), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jb .L122
+	cmpl $18, -8(%rbp)
+	jbe .L120
+.L122:
+	movl -8(%rbp), %eax
+	addl $8, %eax
+.L119:
+	movl %eax, -28(%rbp)
+	movl g0(%rip), %eax
+	movabsq $950322518812, %rcx
+	imulq %rcx, %rax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L141
+	cmpl $18, -28(%rbp)
+	jbe .L139
+.L141:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L118:
+	jmp .L85
+.L84:
+	movl ga0+4(%rip), %eax
+	movl %eax, -8(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl $6, %eax
+	movl %eax, -8(%rbp)
+	movl $0, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl $3, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L155
+	cmpl $18, -28(%rbp)
+	jbe .L153
+.L155:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L152:
+.L151:
+.L150:
+	movl ga1+12(%rip), %eax
+	movl %eax, -28(%rbp)
+	movq -16(%rbp), %rax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L159
+	cmpl $18, -28(%rbp)
+	jbe .L157
+.L159:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L156:
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	subl $3, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, ga1+8(%rip)
+.L85:
+.L70:
+.L71:
+	jmp .L3
+.L73:
+.L74:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L79
+	cmpl $18, -32(%rbp)
+	jbe .L77
+.L79:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L76:
+	jmp .L72
+.L88:
+.L89:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L94
+	cmpl $18, -32(%rbp)
+	jbe .L92
+.L94:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L91:
+	jmp .L87
+.L107:
+.L108:
+	movl -36(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -36(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L113
+	cmpl $18, -32(%rbp)
+	jbe .L111
+.L113:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L110:
+	jmp .L86
+.L120:
+.L121:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	movl -8(%rbp), %eax
+	addl $24, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L126
+	cmpl $18, -32(%rbp)
+	jbe .L124
+.L126:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L123:
+	jmp .L119
+.L139:
+.L140:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L145
+	cmpl $18, -32(%rbp)
+	jbe .L143
+.L145:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L142:
+	jmp .L85
+.L153:
+.L154:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L152
+.L157:
+.L158:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L163
+	cmpl $18, -32(%rbp)
+	jbe .L161
+.L163:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L160:
+	jmp .L156
+.L77:
+.L78:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L83
+	cmpl $18, -28(%rbp)
+	jbe .L81
+.L83:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L80:
+	jmp .L72
+.L92:
+.L93:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L98
+	cmpl $18, -28(%rbp)
+	jbe .L96
+.L98:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L95:
+	jmp .L87
+.L111:
+.L112:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L117
+	cmpl $18, -28(%rbp)
+	jbe .L115
+.L117:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L114:
+	jmp .L86
+.L124:
+.L125:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L130
+	cmpl $18, -28(%rbp)
+	jbe .L128
+.L130:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L127:
+	jmp .L119
+.L143:
+.L144:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L149
+	cmpl $18, -28(%rbp)
+	jbe .L147
+.L149:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L146:
+	jmp .L85
+.L161:
+.L162:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L167
+	cmpl $18, -28(%rbp)
+	jbe .L165
+.L167:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L164:
+	jmp .L156
+.L81:
+.L82:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L72
+.L96:
+.L97:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L102
+	cmpl $18, -32(%rbp)
+	jbe .L100
+.L102:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L99:
+	jmp .L87
+.L115:
+.L116:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L86
+.L128:
+.L129:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L134
+	cmpl $18, -32(%rbp)
+	jbe .L132
+.L134:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L131:
+	jmp .L119
+.L147:
+.L148:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L85
+.L165:
+.L166:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L156
+.L100:
+.L101:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L106
+	cmpl $18, -28(%rbp)
+	jbe .L104
+.L106:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L103:
+	jmp .L87
+.L132:
+.L133:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L138
+	cmpl $18, -28(%rbp)
+	jbe .L136
+.L138:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L135:
+	jmp .L119
+.L104:
+.L105:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L87
+.L136:
+.L137:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L119
+.L10:
+	movl $1, -40(%rbp)
+	movsbl -42(%rbp), %eax
+	movl %eax, -8(%rbp)
+	testl %eax, %eax
+	jl .L168
+	cmpl $4, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L169
+.L168:
+	movl $0, %eax
+.L169:
+	movl %eax, -36(%rbp)
+	cmpl $3, -40(%rbp)
+	jge .L171
+	.p2align 4,,10
+.L170:
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	jne .LB1
+.L172:
+.L173:
+	cmpl $0, -36(%rbp)
+	je .L174
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movsbq -42(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L174:
+.L175:
+	movq -16(%rbp), %rax
+	movl %eax, -8(%rbp)
+	cmpl $2, -8(%rbp)
+	jb .L179
+	cmpl $18, -8(%rbp)
+	jbe .L177
+.L179:
+	movl -8(%rbp), %eax
+	addl $9, %eax
+.L176:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, g2(%rip)
+	addl $1, -40(%rbp)
+	cmpl $3, -40(%rbp)
+	jl .L170
+.L171:
+	movq $0, -24(%rbp)
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -36(%rbp)
+	cmpq $3, -24(%rbp)
+	jae .L3
+	.p2align 4,,10
+.L188:
+	cmpb $0, -43(%rbp)
+	jne .LB2
+.L190:
+.L191:
+	movzbl g2(%rip), %eax
+	movl %eax, -8(%rbp)
+	movl $6, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl $9, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L198
+	cmpl $18, -32(%rbp)
+	jbe .L196
+.L198:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L195:
+.L194:
+	testl %eax, %eax
+	je .L192
+	movl ga0+4(%rip), %eax
+	movl %eax, -28(%rbp)
+	movzbl g2(%rip), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L206
+	cmpl $18, -28(%rbp)
+	jbe .L204
+.L206:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L203:
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	cmpl $4, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	cmpb $0, g2(%rip)
+	jne .L215
+	movl $4, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L216
+.L215:
+	movl $1, %eax
+.L216:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	jmp .L193
+.L192:
+	xorl %eax, %eax
+	movzbl g2(%rip), %ecx
+	subl %ecx, %eax
+	cmpl $-8, %eax
+	setge %al
+	movzbl %al, %eax
+	movb %al, g2(%rip)
+.L193:
+	movsbl -41(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	addl $357, %eax
+.L217:
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	je .L218
+	cmpl $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L219
+.L218:
+	movl $0, %eax
+.L219:
+	popq %rcx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -43(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -43(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $3, -24(%rbp)
+	jb .L188
+.L189:
+	jmp .L3
+.L177:
+.L178:
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	movl -8(%rbp), %eax
+	addl $27, %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L183
+	cmpl $18, -32(%rbp)
+	jbe .L181
+.L183:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L180:
+	jmp .L176
+.L196:
+.L197:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L202
+	cmpl $18, -28(%rbp)
+	jbe .L200
+.L202:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L199:
+	jmp .L195
+.L204:
+.L205:
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -32(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -32(%rbp)
+	jb .L210
+	cmpl $18, -32(%rbp)
+	jbe .L208
+.L210:
+	movl -8(%rbp), %eax
+	addl -32(%rbp), %eax
+.L207:
+	jmp .L203
+.L181:
+.L182:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L187
+	cmpl $18, -28(%rbp)
+	jbe .L185
+.L187:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L184:
+	jmp .L176
+.L200:
+.L201:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L195
+.L208:
+.L209:
+	movl -32(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -28(%rbp)
+	imull $3, -8(%rbp), %eax
+	addl -32(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $2, -28(%rbp)
+	jb .L214
+	cmpl $18, -28(%rbp)
+	jbe .L212
+.L214:
+	movl -8(%rbp), %eax
+	addl -28(%rbp), %eax
+.L211:
+	jmp .L203
+.L185:
+.L186:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L176
+.L212:
+.L213:
+	imull $3, -8(%rbp), %eax
+	addl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L203
+.LB1:
+	movl $424, %eax
+	jmp .main_return
+.LB2:
+	movzbl g2(%rip), %eax
+	cmpl $127, %eax
+	seta %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -41(%rbp), %eax
+	cltd
+	idivl -36(%rbp)
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB0:
+	movq -16(%rbp), %rax
+	movl g0(%rip), %ecx
+	subq %rcx, %rax
+	cmpq $8, %rax
+	sete %al
+	movzbl %al, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L14:
+	.long .L10-.L14
+	.long .L3-.L14
+	.long .L3-.L14
+	.long .L3-.L14
+	.long .L5-.L14
+	.long .L3-.L14
+	.long .L3-.L14
+	.long .L3-.L14
+	.long .L6-.L14
+	.long .L9-.L14
+	.p2align 2
+.L34:
+	.long .L30-.L34
+	.long .L29-.L34
+	.long .L29-.L34
+	.long .L26-.L34
+	.long .L32-.L34
+	.long .L27-.L34
+	.long .L29-.L34
+	.long .L32-.L34
+	.long .L28-.L34
+	.long .L29-.L34
+	.long .L31-.L34
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,51 @@
+unsigned int g0 = 8;
+int g1;
+int main() {
+    long v0 = 4;
+    unsigned long v1 = 0;
+    int i0 = 6;
+    long j0 = 947;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 501; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 4ul; }
+    v1 = (v1 / 16);
+    if (117946091504) { return (i0 > 6); }
+    if (!(v1)) {
+        v1 = ((g1 / 100) * 1);
+        if (((2 + 800) + 65536)) { return ((i0 + 8) * (g1 - 841)); }
+    } else {
+        if (8) {
+            switch ((g0 / 3u)) {
+            default:
+                break;
+            case 10:
+                break;
+            case 5:
+            case 1:
+                i0 = v1;
+                if (!(369)) { return (g0 < 578276751253); }
+                break;
+            }
+            if ((la1[2] + v1)) { return g1; }
+        } else {
+            v0 = 827;
+            v0 = v1;
+        }
+        g0 = 0;
+        i0 = i0 + (3 / (g1 * g1 + 1));
+    }
+    g1 = (8 - -((j0 != g1)));
+    i0 = 4294967295;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,106 @@
+	.section .data
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.long 8
+	.section .bss
+	.type g1, @object
+	.size g1, 4
+	.p2align 2
+g1:
+	.zero 4
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movq $4, -8(%rbp)
+	movq $0, -16(%rbp)
+	movl $6, -20(%rbp)
+	movq $947, -32(%rbp)
+	movl $0, -20(%rbp)
+	imull $501, -20(%rbp), %eax
+	subl $501, %eax
+	movl %eax, -180(%rbp)
+	cmpl $33, -20(%rbp)
+	jge .L0
+	movl $33, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	addl $501, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $501, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $501, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	addl $501, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -192(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -20(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $501, -180(%rbp)
+	movslq -20(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $33, -20(%rbp)
+	jl .L4
+.L5:
+	movl $0, -20(%rbp)
+	movl $0, -208(%rbp)
+	movl $4, -204(%rbp)
+	movl $8, -200(%rbp)
+	movl $12, -196(%rbp)
+	movl $4, -20(%rbp)
+	movq -16(%rbp), %rax
+	shrq $4, %rax
+	movq %rax, -16(%rbp)
+	cmpl $6, -20(%rbp)
+	setg %al
+	movzbl %al, %eax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
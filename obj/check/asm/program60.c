@@ -0,0 +1,34 @@
+int ga0[33];
+int ga1[33];
+int main() {
+    unsigned short v0 = 419010134642;
+    char v1 = 166306339675;
+    int i0 = 372;
+    long j0 = 734;
+    i0 = (((v1 + ga1[21]) / 1024) / 13ul);
+    v0 = (i0 + (v1 / (j0 * j0 + 1)));
+    v1 = !((6 <= !(ga1[23])));
+    j0 = j0 + (v1 / (j0 * j0 + 1));
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) {
+        if (((i0 + (v0 == i0)) && j0)) {
+            if ((unsigned char)(-(5))) { break; }
+        } else {
+            j0 = 0;
+            while (j0 < 16) {
+                v1 = ((677 + i0) - (i0 < 1029769026338));
+                j0 = j0 + 1;
+            }
+        }
+        j0 = j0 + (i0 != j0);
+    }
+    j0 = !(-((char)(v0)));
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
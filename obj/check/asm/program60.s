@@ -0,0 +1,368 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $40, %rsp
+	movb $91, -35(%rbp)
+	movq $734, -24(%rbp)
+	movsbl -35(%rbp), %eax
+	movl ga1+84(%rip), %ecx
+	addl %ecx, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -32(%rbp)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	movq %rax, %rcx
+	movsbq -35(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	addq %rcx, %rax
+	movw %ax, -34(%rbp)
+	movl ga1+92(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $6, %eax
+	setl %al
+	movzbl %al, %eax
+	movb %al, -35(%rbp)
+	movsbq -35(%rbp), %rax
+	cqo
+	idivq -8(%rbp)
+	addq %rax, -24(%rbp)
+	movl $0, -32(%rbp)
+	xorl %eax, %eax
+	subl $5, %eax
+	movl %eax, -16(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movzwl -34(%rbp), %eax
+	cmpl -32(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	addl -32(%rbp), %eax
+	je .L2
+	cmpq $0, -24(%rbp)
+	je .L2
+	movl -16(%rbp), %eax
+	testb %al, %al
+	je .L3
+.L1:
+	movzwl -34(%rbp), %eax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzwl -34(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq -35(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -32(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	testl %eax, %eax
+	je .L12
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L15
+	.p2align 4,,10
+.L14:
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -8(%rbp)
+	jne .L14
+.L15:
+.L12:
+.L13:
+	cmpl $33, -32(%rbp)
+	jge .L17
+	.p2align 4,,10
+.L16:
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L16
+.L17:
+	movl $0, -32(%rbp)
+	cmpl $0, -28(%rbp)
+	je .L18
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L21
+	.p2align 4,,10
+.L20:
+	movslq -32(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -8(%rbp)
+	jne .L20
+.L21:
+.L18:
+.L19:
+	cmpl $33, -32(%rbp)
+	jge .L23
+	.p2align 4,,10
+.L22:
+	movslq -32(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L22
+.L23:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	leave
+	ret
+.L2:
+	movq $0, -24(%rbp)
+	movslq -32(%rbp), %rax
+	movabsq $1029769026338, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	addl $677, %eax
+	subl %ecx, %eax
+	movl %eax, -28(%rbp)
+	cmpq $16, -24(%rbp)
+	jge .L6
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl $16, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movl -28(%rbp), %eax
+	movb %al, -35(%rbp)
+	addq $1, -24(%rbp)
+	movsbl -35(%rbp), %eax
+	movb %al, -35(%rbp)
+	addq $1, -24(%rbp)
+	movsbl -35(%rbp), %eax
+	movb %al, -35(%rbp)
+	addq $1, -24(%rbp)
+	movsbl -35(%rbp), %eax
+	movb %al, -35(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -8(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpq $16, -24(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movl -28(%rbp), %eax
+	movb %al, -35(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $16, -24(%rbp)
+	jl .L10
+.L11:
+.L3:
+	movslq -32(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -24(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L0
+	jmp .L1
+.L4:
+.L5:
+	jmp .L3
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
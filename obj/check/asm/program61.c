@@ -0,0 +1,452 @@
+int g0 = 7;
+int ga0[4];
+int ga1[33];
+unsigned short f0(long p0, int p1, int p2, unsigned int p3, unsigned short p4, short p5, unsigned long p6, unsigned int p7) {
+    unsigned int v0 = 575;
+    long v1 = 65535;
+    unsigned char v2 = 5;
+    unsigned short v3 = 10;
+    long v4 = 56558883630;
+    int i0 = 908;
+    long j0 = 9;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 7; }
+    p2 = (long)(la0[0]);
+    if (1) {
+        switch (p1) {
+        case 8:
+            if (((133L || 333) <= -(p6))) { return (v3 / (v3 * v3 + 1)); }
+            break;
+        case 10:
+            if (!((-(499130475492) >= p5))) {
+                if (v3) { return p3; }
+            } else {
+                j0 = (((v3 / 7) + (unsigned short)(j0)) > (j0 + la0[3]));
+                if ((i0 == !(88))) { return (v4 * 2); }
+            }
+            p0 = 1000000007;
+        case 0:
+            if (ga1[5]) { return ga1[29]; }
+            break;
+        case 7:
+        default:
+        }
+    } else {
+        if ((long)((long)(3))) {
+            switch (((v0 > v1) || g0)) {
+            default:
+                p2 = (9 - ((p3 / (v0 * v0 + 1)) != v2));
+                break;
+            case 17:
+            }
+            for (v1 = 0; v1 < 8; v1 = v1 + 1) {
+                v3 = (1 * (char)((p1 >= 2)));
+                if ((1 - ga0[0])) { break; }
+                i0 = (500962308758 / 3u);
+            }
+        }
+    }
+    for (j0 = 0; j0 < 100; j0 = j0 + 1) {
+        i0 = i0 + (unsigned short)((p2 - p7));
+        p5 = ((short)(la0[1]) >= 6);
+    }
+    v2 = (p1 == ((ga0[2] + 5) || -(ga0[3])));
+    if (p6 >= 0 && p6 < 4) { la0[p6] = (ga1[30] / 3u); }
+    for (v1 = 1; v1 < 8; v1 = v1 + 1) {
+        for (p2 = 0; p2 < 100; p2 = p2 + 1) {
+            for (p5 = 1; p5 < 17; p5 = p5 + 1) {
+                if (((858 - 5) || !(v2))) { break; }
+            }
+            if (((unsigned long)((v4 == 4)) != v0)) {
+                v4 = (char)(((p1 && 538) - !(v1)));
+                p1 = p3;
+                v3 = !(((p3 >= 32767) == (v1 + 2)));
+            } else {
+                if (((p3 - p5) && g0)) { break; }
+                if (((7 && v2) + (v3 <= 1))) { break; }
+            }
+        }
+        p7 = (9 / (i0 * i0 + 1));
+        p2 = (((p6 / 7) / 2) + !((2L >= 65535)));
+    }
+    return 3;
+}
+void w0(char q0, unsigned long q1) {
+    g0 = g0 * 3 + q0;
+    ga1[7] = ga1[19] + q0;
+    g0 = g0 * 3 + q1;
+}
+unsigned char f1(int p0, unsigned char p1, int p2, unsigned char p3, unsigned long p4) {
+    unsigned long v0 = 9;
+    unsigned char v1 = 421;
+    char v2 = 6;
+    int i0 = 178;
+    long j0 = 5;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 10u; }
+    la1[28] = f0(485, v0, la1[18], p0, v1, 10, p2, 4);
+    if ((!(!(g0)) + ((1 && 13) > (p1 - 67318553376)))) {
+        p3 = (unsigned long)(v0);
+        v2 = -((9 / (v2 * v2 + 1)));
+    }
+    p0 = 0;
+    while (p0 < 3) {
+        p1 = (f0(27125227234, j0, 149, 4, j0, ga1[13], v1, 65536L) < f0(ga1[22], v2, j0, 6, 880, v2, p3, p1));
+        la1[p0] = f0(477l, 289L, ga0[2], j0, 10, 831, p2, j0);
+        i0 = 0;
+        p0 = p0 + 1;
+    }
+    if (1000000007) {
+        switch (((la1[23] == 50907089546) * 69913830301)) {
+        case 0:
+            v2 = ((559 || p0) == (8U <= 964));
+            if (443) {
+                f0(-(812), f0(p3, 513, p1, v1, 359, 9, 980, 4), p2, (3U / 1), (ga0[2] >= p2), 9, p2, (32767 + p0));
+            } else {
+                if ((542 - (760458178533l + p0))) { return 7; }
+                if (!((951085762514 - ga0[1]))) { return p3; }
+            }
+        default:
+            for (j0 = 0; j0 < 5; j0 = j0 + 1) {
+                v0 = v2;
+                if (((i0 / 5l) >= p3)) { break; }
+            }
+        case 6:
+            la1[16] = i0;
+        case 7:
+            for (p0 = 2; p0 < 16; p0 = p0 + 1) {
+                if (la0[4]) { break; }
+            }
+        case 2:
+            break;
+        case 10:
+            p3 = (((v0 / (p0 * p0 + 1)) / (v2 * v2 + 1)) + j0);
+            p3 = (long)(p4);
+            break;
+        case 8:
+            switch (7) {
+            case 486:
+                v0 = (1000000007 / (p2 * p2 + 1));
+                break;
+            case 1:
+                la1[1] = ((p1 == 2147483647) < (v0 / (p3 * p3 + 1)));
+                f0(9, (p0 / 4), 448, la1[32], -(p3), (int)(p2), f0(la0[4], la1[17], ga0[1], p3, la1[24], v1, p3, i0), -(0));
+            case 254:
+                v0 = v0;
+                break;
+            default:
+                v0 = ga0[2];
+                break;
+            case 239:
+                f0(p2, (6 < g0), !(9), (la0[3] / (p1 * p1 + 1)), (g0 - i0), (la1[17] - j0), (p2 - ga1[32]), j0);
+            case 616:
+                la0[2] = 890u;
+                break;
+            case 0:
+            case 391:
+                v1 = (f0(ga1[10], p4, v2, 665u, 143ul, v0, ga1[5], 202) != -(3));
+                break;
+            }
+        case 5:
+            p3 = p3 + -((8 / (i0 * i0 + 1)));
+            p1 = ((la0[4] <= (3 >= p2)) >= v0);
+            break;
+        }
+    }
+    return v0;
+}
+unsigned short f2(unsigned int p0) {
+    char v0 = 144;
+    long v1 = 347662120799U;
+    unsigned int v2 = 9;
+    unsigned int v3 = 10;
+    int i0 = 199;
+    long j0 = 427;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 453988730766; }
+    la0[1] = (!(v3) - v1);
+    p0 = la0[0];
+    if ((unsigned int)((j0 - v1))) { return ((4 * 3) != -(2)); }
+    v0 = (-((p0 / (v1 * v1 + 1))) >= ((v3 != 9) / (i0 * i0 + 1)));
+    for (j0 = 0; j0 < 17; j0 = j0 + 1) {
+        if ((1 == p0)) {
+            if ((((char)(571) && (213 + i0)) != f1(v0, ga1[14], 9, la0[3], 6L))) {
+                if ((v3 == (1000000007 >= 5))) { break; }
+            } else {
+                if ((ga0[0] < 7L)) { break; }
+            }
+            if ((short)((6 - f0(44, 8, v3, la0[0], g0, i0, v0, 315)))) {
+                if ((la0[2] / (g0 * g0 + 1))) { break; }
+                v0 = (unsigned short)((!(p0) != (v2 < 7)));
+            } else {
+                if (((la0[2] != j0) / 7)) { break; }
+                v3 = (((int)(v0) || (g0 - 245)) - (unsigned long)(-(v1)));
+            }
+        }
+        v2 = f0(i0, 2, j0, 9, v1, !(j0), 0, (v1 + v1));
+    }
+    for (v3 = 1; v3 < 16; v3 = v3 + 1) {
+        if (((424 - v3) / 4)) {
+            la0[3] = (v3 / (v3 * v3 + 1));
+            if (ga0[1]) { return 3; }
+        }
+    }
+    j0 = 0;
+    while (j0 < 16) {
+        v0 = (!((831 / 7)) - f0(v2, v2, 5, 5, v2, g0, g0, 5));
+        j0 = j0 + 1;
+    }
+    v1 = v1 + p0;
+    return (v3 / (j0 * j0 + 1));
+}
+unsigned short f3(char p0, char p1) {
+    unsigned long v0 = 318;
+    unsigned char v1 = 200;
+    int v2 = 3;
+    int i0 = 5U;
+    long j0 = 821;
+    f0(v2, f1(1, 489078061981, 8, 1015650779948u, v0), !(5ul), (4 > 0), -(ga0[0]), (i0 - 496), 4, g0);
+    for (j0 = 0; j0 < 17; j0 = j0 + 1) {
+        v2 = (g0 > (-(ga1[23]) + (long)(j0)));
+    }
+    if (-((f1(v1, 256, 233, 1000000007U, 2147483647) && (j0 == 0)))) {
+        switch (10) {
+        case 4:
+            f0((p0 / 2), ga1[0], f0(512, p1, g0, p1, j0, v2, p0, v2), !(v1), g0, ga1[4], (181 + j0), 65535);
+            for (j0 = 0; j0 < 17; j0 = j0 + 1) {
+                v0 = 8;
+            }
+        case -3:
+            v0 = 5ul;
+            if ((4 <= f1(709, 65535, ga0[0], 498, 513))) { return ((j0 - v0) + g0); }
+            break;
+        case 302:
+            break;
+        }
+        for (v0 = 0; v0 < 4; v0 = v0 + 1) {
+            if ((((short)(ga0[0]) > 505) == -((unsigned long)(34)))) {
+                v1 = v1 + g0;
+            } else {
+                p1 = ((p1 * -(ga0[0])) && v2);
+            }
+            switch (0) {
+            case 6:
+                if (((char)(i0) - f2(p1))) { break; }
+                j0 = (int)(f0(v1, p0, v1, 2, v2, 861, 1, 189842165381));
+                break;
+            default:
+                if ((-(5) + (g0 >= 1000000007))) { break; }
+                v1 = p0;
+            case 0:
+                i0 = i0 + 4;
+            case 5:
+                p0 = p0 + i0;
+                v2 = v2 + (356 + (short)(p0));
+                break;
+            case 1:
+                break;
+            case 3:
+                j0 = 6;
+                if (f2(142)) { break; }
+                break;
+            }
+            if (3) {
+                v2 = 1000000007;
+                if (((2 + 9) / (p1 * p1 + 1))) { break; }
+            } else {
+                if (-(1)) { break; }
+                p1 = (long)((!(v0) + (256 >= p0)));
+                if ((char)((624 + 392))) { break; }
+            }
+        }
+    } else {
+        if ((unsigned short)(-(v0))) {
+            f0(7, !(655ul), (ga0[3] && i0), (2 == 8), (4 <= p1), !(p1), (10 < p0), (866 / (v2 * v2 + 1)));
+            j0 = j0 + j0;
+            if ((ga0[1] != ga0[3])) {
+                p0 = !(g0);
+                v0 = i0;
+            }
+        } else {
+            if (1) {
+                f1((220 || i0), (540 >= v2), f1(3, 342, v1, g0, 278), (char)(p0), (v0 >= 63));
+                f2((v0 || 136658872207));
+            }
+        }
+        v0 = (566 || (v0 + ga0[1]));
+    }
+    return (p0 + v1);
+}
+void w3(char q0, unsigned int q1, int q2) {
+    g0 = g0 * 3 + q0;
+    ga0[1] = ga0[2] + q0;
+    g0 = g0 * 3 + q0;
+}
+long rec(long n, long acc) {
+    if (n < 3 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    unsigned char v0 = 7;
+    unsigned char v1 = 7;
+    int i0 = 25;
+    long j0 = 2147483647;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 2l; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 1; }
+    if (-((5 / (i0 * i0 + 1)))) {
+        j0 = f2(f2(la0[5]));
+        la0[15] = ((la0[11] <= la0[0]) <= (i0 * 808));
+    } else {
+        for (j0 = 0; j0 < 4; j0 = j0 + 1) {
+            v0 = 10;
+        }
+        g0 = g0;
+        switch ((la0[14] + i0)) {
+        case 3:
+            v1 = (2 < ((unsigned char)(j0) - (778 * 0)));
+            v1 = (((957 / 16) / 1024) - ((g0 + la0[4]) / 3u));
+            break;
+        case 1:
+            break;
+        case 10:
+            i0 = la1[7];
+        case 4:
+            break;
+        default:
+            switch (((unsigned int)(g0) || j0)) {
+            case 64:
+            case 41:
+                w0(447, g0);
+                w0(4, j0);
+                break;
+            case 15:
+            default:
+                i0 = j0;
+                g0 = (short)((char)((v0 - 1072708238908)));
+                break;
+            }
+            v1 = g0;
+            break;
+        case 5:
+        }
+    }
+    switch (!((2 == v1))) {
+    case 3:
+        la1[6] = 3;
+        v1 = !(((la1[0] / 4) && 557));
+        break;
+    case 9:
+        if (i0 >= 0 && i0 < 4) { ga0[i0] = ((2 != 8) > (810 == 74)); }
+        break;
+    case 2:
+        w3(904, 3, la1[2]);
+        break;
+    case 6:
+        break;
+    }
+    switch ((unsigned short)((g0 > g0))) {
+    default:
+        v0 = (unsigned char)((i0 < 7));
+    case 57:
+        g0 = (i0 == 0);
+        break;
+    case 22:
+        if (v0) {
+            i0 = 3;
+            w0(907, 4);
+            v0 = -(4);
+        } else {
+            if (((i0 - (ga0[1] == 911)) == ((142U > 4) >= v0))) {
+                w3(174778603448, v1, v0);
+            } else {
+                j0 = j0 + ((127 || j0) != (la0[12] - 146));
+                v1 = i0;
+                j0 = -(f1(ga1[0], g0, v1, la0[4], v0));
+            }
+            switch ((255 - (9 + i0))) {
+            default:
+                w3(i0, v0, v1);
+                v0 = (f2(g0) - (rec(ga0[0], i0) + (v1 * v0)));
+                break;
+            case 0:
+                w0(9, i0);
+                break;
+            case 3:
+                v0 = (!((1 / 100)) + -((j0 - i0)));
+                j0 = (unsigned long)((j0 == v0));
+                break;
+            }
+        }
+        i0 = 0;
+        while (i0 < 8) {
+            la0[i0] = (v0 <= (v1 + g0));
+            if (v1 >= 0 && v1 < 8) { la1[v1] = (7 >= (char)(3)); }
+            i0 = i0 + 1;
+        }
+    case 358:
+        if ((442034129825 - ((j0 || 10l) > (v0 + i0)))) {
+            i0 = 0;
+            while (i0 < 3) {
+                if ((i0 > 6)) { break; }
+                if ((unsigned int)(!(j0))) { break; }
+                f0((i0 / 10), f0(139, i0, 6, 5, 10, g0, i0, 5), (g0 - 4), g0, f2(v0), (j0 * 811492259816), (la0[11] >= i0), (ga0[3] >= 41l));
+                i0 = i0 + 1;
+            }
+            j0 = (v1 + (v1 || f0(10, 8, i0, 2, j0, 1, j0, 8)));
+            if (6) {
+                v1 = 548;
+                w3(la1[4], v0, g0);
+                w3(j0, v0, 8);
+            } else {
+                w3(6, 404, v1);
+            }
+        } else {
+            j0 = 0;
+            while (j0 < 33) {
+                v0 = (g0 != j0);
+                j0 = j0 + 1;
+            }
+            if ((char)(((unsigned long)(v0) / 4))) {
+                if (v1 >= 0 && v1 < 33) { ga1[v1] = (ga0[1] < (360698915344 / 1)); }
+            } else {
+                v1 = v1 + v1;
+                w3(10, v1, j0);
+            }
+        }
+    case 642:
+        ga0[0] = v1;
+        switch ((i0 != (v1 / (j0 * j0 + 1)))) {
+        case 8:
+            i0 = (unsigned long)((!(804) + v0));
+            break;
+        }
+        break;
+    case 497:
+        v1 = g0;
+        if (((4l && (653 * 3)) - 4)) {
+            v0 = v0 + ((3 + 571) - f3(2, 65536));
+            v1 = 944180187977;
+        }
+        break;
+    case -3:
+        i0 = ((unsigned short)((g0 == 0U)) && ((ga0[3] * v0) / (j0 * j0 + 1)));
+        break;
+    }
+    if (((1045850122054 - 3l) >= (1 < 4))) { return v0; }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,3998 @@
+	.section .data
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.long 7
+	.section .bss
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.type f0, @function
+	.type f1, @function
+	.type f2, @function
+	.type rec, @function
+	.type f3, @function
+	.global main
+	.type main, @function
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movl %edx, -16(%rbp)
+	movw %cx, -18(%rbp)
+	movw %r8w, -20(%rbp)
+	movq %r9, -32(%rbp)
+	movl $575, -36(%rbp)
+	movq $65535, -48(%rbp)
+	movb $5, -49(%rbp)
+	movw $10, -52(%rbp)
+	movabsq $56558883630, %rax
+	movq %rax, -64(%rbp)
+	movl $908, -68(%rbp)
+	movq $9, -80(%rbp)
+	movl $0, -68(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $4, -68(%rbp)
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	movl %eax, -16(%rbp)
+	movl -12(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	jge .L5
+	cmpq $0, %rax
+	je .L3
+	cmpq $7, %rax
+	je .L4
+	jmp .L4
+.L5:
+	cmpq $8, %rax
+	je .L1
+	cmpq $10, %rax
+	je .L2
+	jmp .L4
+.L2:
+	movabsq $-499130475492, %rax
+	movswq -20(%rbp), %rcx
+	cmpq %rcx, %rax
+	jge .L8
+	cmpw $0, -52(%rbp)
+	jne .LB0
+.L10:
+.L11:
+.L12:
+.L13:
+.L9:
+	movq $1000000007, -8(%rbp)
+.L3:
+	movl ga1+20(%rip), %eax
+	testl %eax, %eax
+	jne .LB1
+.L14:
+.L15:
+.L4:
+.L0:
+	movq $0, -80(%rbp)
+	movl -16(%rbp), %eax
+	subl 16(%rbp), %eax
+	movl %eax, -104(%rbp)
+	cmpq $100, -80(%rbp)
+	jge .L16
+	movq -80(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L19
+	.p2align 4,,10
+.L18:
+	movl -104(%rbp), %eax
+	movzwl %ax, %eax
+	movl %eax, -116(%rbp)
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -20(%rbp)
+	addq $1, -80(%rbp)
+	movl -116(%rbp), %eax
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -20(%rbp)
+	addq $1, -80(%rbp)
+	subq $1, -112(%rbp)
+	jne .L18
+.L19:
+.L16:
+.L17:
+	cmpq $100, -80(%rbp)
+	jge .L21
+	.p2align 4,,10
+.L20:
+	movl -104(%rbp), %eax
+	movzwl %ax, %eax
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -20(%rbp)
+	addq $1, -80(%rbp)
+	cmpq $100, -80(%rbp)
+	jl .L20
+.L21:
+	movl ga0+8(%rip), %eax
+	addl $5, %eax
+	jne .L22
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L23
+.L22:
+	movl $1, %eax
+.L23:
+	cmpl %eax, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -49(%rbp)
+	cmpq $0, -32(%rbp)
+	jb .L24
+	cmpq $4, -32(%rbp)
+	jae .L24
+	movl ga1+120(%rip), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L24:
+.L25:
+	movq $1, -48(%rbp)
+	cmpb $0, -49(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	movl -68(%rbp), %eax
+	imull -68(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -124(%rbp)
+	movq -32(%rbp), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	shrq $1, %rax
+	addq $1, %rax
+	movq %rax, -136(%rbp)
+	cmpq $8, -48(%rbp)
+	jge .L27
+	.p2align 4,,10
+.L26:
+	movl $0, -16(%rbp)
+	movq -48(%rbp), %rax
+	addq $2, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -140(%rbp)
+	movl -120(%rbp), %eax
+	movl %eax, -144(%rbp)
+	cmpl $100, -16(%rbp)
+	jge .L29
+	.p2align 4,,10
+.L28:
+	movw $1, -20(%rbp)
+	movswl -20(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl $17, %eax
+	.p2align 4,,10
+.L30:
+.L31:
+	cmpq $4, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl -36(%rbp), %ecx
+	cmpq %rcx, %rax
+	je .L32
+	cmpq $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -12(%rbp)
+	je .L34
+	movl $538, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L35
+.L34:
+	movl $0, %eax
+.L35:
+	popq %rcx
+	subl %ecx, %eax
+	movsbq %al, %rax
+	movq %rax, -64(%rbp)
+	movl $4, -12(%rbp)
+	cmpl $0, -140(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -52(%rbp)
+.L38:
+.L39:
+.L33:
+	addl $1, -16(%rbp)
+	cmpl $100, -16(%rbp)
+	jl .L28
+	jmp .L29
+.L32:
+	movl $4, %eax
+	movswl -20(%rbp), %ecx
+	subl %ecx, %eax
+	je .L36
+	cmpl $0, g0(%rip)
+	je .L36
+	jmp .L29
+.L36:
+.L37:
+	movzwl -52(%rbp), %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	addl -144(%rbp), %eax
+	je .L38
+.L29:
+	movl $9, %eax
+	cltd
+	idivl -124(%rbp)
+	movl %eax, 16(%rbp)
+	movq -136(%rbp), %rax
+	movl %eax, -16(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $8, -48(%rbp)
+	jl .L26
+.L27:
+	movl $3, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L1:
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	cmpq $1, %rax
+	jae .LB2
+.L6:
+.L7:
+	jmp .L0
+.LB1:
+	movl ga1+116(%rip), %eax
+	jmp .f0.constprop.0_return
+.LB2:
+	movzwl -52(%rbp), %eax
+	movl %eax, -100(%rbp)
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	cltd
+	idivl %ecx
+	jmp .f0.constprop.0_return
+.L8:
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	addq -80(%rbp), %rax
+	pushq %rax
+	movq -80(%rbp), %rax
+	movzwl %ax, %eax
+	pushq %rax
+	movzwl -52(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	cmpl $0, -68(%rbp)
+	jne .L12
+	movq -64(%rbp), %rax
+	salq $1, %rax
+	jmp .f0.constprop.0_return
+.LB0:
+	movl $4, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movl %edx, -16(%rbp)
+	movw %cx, -18(%rbp)
+	movq %r8, -32(%rbp)
+	movl %r9d, -36(%rbp)
+	movl $575, -40(%rbp)
+	movq $65535, -48(%rbp)
+	movb $5, -49(%rbp)
+	movw $10, -52(%rbp)
+	movabsq $56558883630, %rax
+	movq %rax, -64(%rbp)
+	movl $908, -68(%rbp)
+	movq $9, -80(%rbp)
+	movl $0, -68(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $4, -68(%rbp)
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	movl %eax, -16(%rbp)
+	movl -12(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	jge .L45
+	cmpq $0, %rax
+	je .L43
+	cmpq $7, %rax
+	je .L44
+	jmp .L44
+.L45:
+	cmpq $8, %rax
+	je .L41
+	cmpq $10, %rax
+	je .L42
+	jmp .L44
+.L42:
+	movabsq $-499130475492, %rax
+	movswq -18(%rbp), %rcx
+	cmpq %rcx, %rax
+	jge .L48
+	cmpw $0, -52(%rbp)
+	jne .LB3
+.L50:
+.L51:
+.L52:
+.L53:
+.L49:
+	movq $1000000007, -8(%rbp)
+.L43:
+	movl ga1+20(%rip), %eax
+	testl %eax, %eax
+	jne .LB4
+.L54:
+.L55:
+.L44:
+.L40:
+	movq $0, -80(%rbp)
+	movl -16(%rbp), %eax
+	subl -36(%rbp), %eax
+	movl %eax, -104(%rbp)
+	cmpq $100, -80(%rbp)
+	jge .L56
+	movq -80(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L59
+	.p2align 4,,10
+.L58:
+	movl -104(%rbp), %eax
+	movzwl %ax, %eax
+	movl %eax, -116(%rbp)
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -18(%rbp)
+	addq $1, -80(%rbp)
+	movl -116(%rbp), %eax
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -18(%rbp)
+	addq $1, -80(%rbp)
+	subq $1, -112(%rbp)
+	jne .L58
+.L59:
+.L56:
+.L57:
+	cmpq $100, -80(%rbp)
+	jge .L61
+	.p2align 4,,10
+.L60:
+	movl -104(%rbp), %eax
+	movzwl %ax, %eax
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -18(%rbp)
+	addq $1, -80(%rbp)
+	cmpq $100, -80(%rbp)
+	jl .L60
+.L61:
+	movl ga0+8(%rip), %eax
+	addl $5, %eax
+	jne .L62
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L63
+.L62:
+	movl $1, %eax
+.L63:
+	cmpl %eax, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -49(%rbp)
+	cmpq $0, -32(%rbp)
+	jb .L64
+	cmpq $4, -32(%rbp)
+	jae .L64
+	movl ga1+120(%rip), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L64:
+.L65:
+	movq $1, -48(%rbp)
+	cmpb $0, -49(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	movl -68(%rbp), %eax
+	imull -68(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -124(%rbp)
+	movq -32(%rbp), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	shrq $1, %rax
+	addq $1, %rax
+	movq %rax, -136(%rbp)
+	cmpq $8, -48(%rbp)
+	jge .L67
+	.p2align 4,,10
+.L66:
+	movl $0, -16(%rbp)
+	movq -48(%rbp), %rax
+	addq $2, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -140(%rbp)
+	movl -120(%rbp), %eax
+	movl %eax, -144(%rbp)
+	cmpl $100, -16(%rbp)
+	jge .L69
+	.p2align 4,,10
+.L68:
+	movw $1, -18(%rbp)
+	movswl -18(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl $17, %eax
+	.p2align 4,,10
+.L70:
+.L71:
+	cmpq $4, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl -40(%rbp), %ecx
+	cmpq %rcx, %rax
+	je .L72
+	cmpq $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -12(%rbp)
+	je .L74
+	movl $538, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L75
+.L74:
+	movl $0, %eax
+.L75:
+	popq %rcx
+	subl %ecx, %eax
+	movsbq %al, %rax
+	movq %rax, -64(%rbp)
+	movl $6, -12(%rbp)
+	cmpl $0, -140(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -52(%rbp)
+.L78:
+.L79:
+.L73:
+	addl $1, -16(%rbp)
+	cmpl $100, -16(%rbp)
+	jl .L68
+	jmp .L69
+.L72:
+	movl $6, %eax
+	movswl -18(%rbp), %ecx
+	subl %ecx, %eax
+	je .L76
+	cmpl $0, g0(%rip)
+	je .L76
+	jmp .L69
+.L76:
+.L77:
+	movzwl -52(%rbp), %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	addl -144(%rbp), %eax
+	je .L78
+.L69:
+	movl $9, %eax
+	cltd
+	idivl -124(%rbp)
+	movl %eax, -36(%rbp)
+	movq -136(%rbp), %rax
+	movl %eax, -16(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $8, -48(%rbp)
+	jl .L66
+.L67:
+	movl $3, %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L41:
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	cmpq $1, %rax
+	jae .LB5
+.L46:
+.L47:
+	jmp .L40
+.LB4:
+	movl ga1+116(%rip), %eax
+	jmp .f0.constprop.1_return
+.LB5:
+	movzwl -52(%rbp), %eax
+	movl %eax, -100(%rbp)
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	cltd
+	idivl %ecx
+	jmp .f0.constprop.1_return
+.L48:
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	addq -80(%rbp), %rax
+	pushq %rax
+	movq -80(%rbp), %rax
+	movzwl %ax, %eax
+	pushq %rax
+	movzwl -52(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	cmpl $0, -68(%rbp)
+	jne .L52
+	movq -64(%rbp), %rax
+	salq $1, %rax
+	jmp .f0.constprop.1_return
+.LB3:
+	movl $6, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movl %edx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movw %r8w, -22(%rbp)
+	movq %r9, -32(%rbp)
+	movl $575, -36(%rbp)
+	movq $65535, -48(%rbp)
+	movb $5, -49(%rbp)
+	movw $10, -52(%rbp)
+	movabsq $56558883630, %rax
+	movq %rax, -64(%rbp)
+	movl $908, -68(%rbp)
+	movq $9, -80(%rbp)
+	movl $0, -68(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $4, -68(%rbp)
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	movl %eax, -16(%rbp)
+	movl -12(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	jge .L85
+	cmpq $0, %rax
+	je .L83
+	cmpq $7, %rax
+	je .L84
+	jmp .L84
+.L85:
+	cmpq $8, %rax
+	je .L81
+	cmpq $10, %rax
+	je .L82
+	jmp .L84
+.L82:
+	movabsq $-499130475492, %rax
+	movswq -22(%rbp), %rcx
+	cmpq %rcx, %rax
+	jge .L88
+	cmpw $0, -52(%rbp)
+	jne .LB6
+.L90:
+.L91:
+.L92:
+.L93:
+.L89:
+	movq $1000000007, -8(%rbp)
+.L83:
+	movl ga1+20(%rip), %eax
+	testl %eax, %eax
+	jne .LB7
+.L94:
+.L95:
+.L84:
+.L80:
+	movq $0, -80(%rbp)
+	movl -16(%rbp), %eax
+	subl 16(%rbp), %eax
+	movl %eax, -104(%rbp)
+	cmpq $100, -80(%rbp)
+	jge .L96
+	movq -80(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L99
+	.p2align 4,,10
+.L98:
+	movl -104(%rbp), %eax
+	movzwl %ax, %eax
+	movl %eax, -116(%rbp)
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -22(%rbp)
+	addq $1, -80(%rbp)
+	movl -116(%rbp), %eax
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -22(%rbp)
+	addq $1, -80(%rbp)
+	subq $1, -112(%rbp)
+	jne .L98
+.L99:
+.L96:
+.L97:
+	cmpq $100, -80(%rbp)
+	jge .L101
+	.p2align 4,,10
+.L100:
+	movl -104(%rbp), %eax
+	movzwl %ax, %eax
+	addl %eax, -68(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -22(%rbp)
+	addq $1, -80(%rbp)
+	cmpq $100, -80(%rbp)
+	jl .L100
+.L101:
+	movl ga0+8(%rip), %eax
+	addl $5, %eax
+	jne .L102
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L103
+.L102:
+	movl $1, %eax
+.L103:
+	cmpl %eax, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -49(%rbp)
+	cmpq $0, -32(%rbp)
+	jb .L104
+	cmpq $4, -32(%rbp)
+	jae .L104
+	movl ga1+120(%rip), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L104:
+.L105:
+	movq $1, -48(%rbp)
+	cmpl $32767, -20(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	cmpb $0, -49(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -124(%rbp)
+	movl -68(%rbp), %eax
+	imull -68(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -128(%rbp)
+	movq -32(%rbp), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	shrq $1, %rax
+	addq $1, %rax
+	movq %rax, -136(%rbp)
+	cmpq $8, -48(%rbp)
+	jge .L107
+	.p2align 4,,10
+.L106:
+	movl $0, -16(%rbp)
+	movq -48(%rbp), %rax
+	addq $2, %rax
+	movq %rax, %rcx
+	movslq -120(%rbp), %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -140(%rbp)
+	movl -124(%rbp), %eax
+	movl %eax, -144(%rbp)
+	cmpl $100, -16(%rbp)
+	jge .L109
+	.p2align 4,,10
+.L108:
+	movw $1, -22(%rbp)
+	movswl -22(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl $17, %eax
+	.p2align 4,,10
+.L110:
+.L111:
+	cmpq $4, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl -36(%rbp), %ecx
+	cmpq %rcx, %rax
+	je .L112
+	cmpq $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -12(%rbp)
+	je .L114
+	movl $538, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L115
+.L114:
+	movl $0, %eax
+.L115:
+	popq %rcx
+	subl %ecx, %eax
+	movsbq %al, %rax
+	movq %rax, -64(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $0, -140(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -52(%rbp)
+.L118:
+.L119:
+.L113:
+	addl $1, -16(%rbp)
+	cmpl $100, -16(%rbp)
+	jl .L108
+	jmp .L109
+.L112:
+	movl -20(%rbp), %eax
+	movswl -22(%rbp), %ecx
+	subl %ecx, %eax
+	je .L116
+	cmpl $0, g0(%rip)
+	je .L116
+	jmp .L109
+.L116:
+.L117:
+	movzwl -52(%rbp), %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	addl -144(%rbp), %eax
+	je .L118
+.L109:
+	movl $9, %eax
+	cltd
+	idivl -128(%rbp)
+	movl %eax, 16(%rbp)
+	movq -136(%rbp), %rax
+	movl %eax, -16(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $8, -48(%rbp)
+	jl .L106
+.L107:
+	movl $3, %eax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L81:
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	cmpq $1, %rax
+	jae .LB8
+.L86:
+.L87:
+	jmp .L80
+.LB7:
+	movl ga1+116(%rip), %eax
+	jmp .f0.constprop.2_return
+.LB8:
+	movzwl -52(%rbp), %eax
+	movl %eax, -100(%rbp)
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	cltd
+	idivl %ecx
+	jmp .f0.constprop.2_return
+.L88:
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	addq -80(%rbp), %rax
+	pushq %rax
+	movq -80(%rbp), %rax
+	movzwl %ax, %eax
+	pushq %rax
+	movzwl -52(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	cmpl $0, -68(%rbp)
+	jne .L92
+	movq -64(%rbp), %rax
+	salq $1, %rax
+	jmp .f0.constprop.2_return
+.LB6:
+	movl -20(%rbp), %eax
+	jmp .f0.constprop.2_return
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movl %edx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movw %r8w, -22(%rbp)
+	movw %r9w, -24(%rbp)
+	movl $575, -28(%rbp)
+	movq $65535, -40(%rbp)
+	movb $5, -41(%rbp)
+	movw $10, -44(%rbp)
+	movabsq $56558883630, %rax
+	movq %rax, -56(%rbp)
+	movl $908, -60(%rbp)
+	movq $9, -72(%rbp)
+	movl $0, -60(%rbp)
+	movl $0, -96(%rbp)
+	movl $7, -92(%rbp)
+	movl $14, -88(%rbp)
+	movl $21, -84(%rbp)
+	movl $4, -60(%rbp)
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	movl %eax, -16(%rbp)
+	movl -12(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	jge .L125
+	cmpq $0, %rax
+	je .L123
+	cmpq $7, %rax
+	je .L124
+	jmp .L124
+.L125:
+	cmpq $8, %rax
+	je .L121
+	cmpq $10, %rax
+	je .L122
+	jmp .L124
+.L122:
+	movabsq $-499130475492, %rax
+	movswq -24(%rbp), %rcx
+	cmpq %rcx, %rax
+	jge .L128
+	cmpw $0, -44(%rbp)
+	jne .LB9
+.L130:
+.L131:
+.L132:
+.L133:
+.L129:
+	movq $1000000007, -8(%rbp)
+.L123:
+	movl ga1+20(%rip), %eax
+	testl %eax, %eax
+	jne .LB10
+.L134:
+.L135:
+.L124:
+.L120:
+	movq $0, -72(%rbp)
+	movl -16(%rbp), %eax
+	subl 24(%rbp), %eax
+	movl %eax, -104(%rbp)
+	cmpq $100, -72(%rbp)
+	jge .L136
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L139
+	.p2align 4,,10
+.L138:
+	movl -104(%rbp), %eax
+	movzwl %ax, %eax
+	movl %eax, -116(%rbp)
+	addl %eax, -60(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -24(%rbp)
+	addq $1, -72(%rbp)
+	movl -116(%rbp), %eax
+	addl %eax, -60(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -24(%rbp)
+	addq $1, -72(%rbp)
+	subq $1, -112(%rbp)
+	jne .L138
+.L139:
+.L136:
+.L137:
+	cmpq $100, -72(%rbp)
+	jge .L141
+	.p2align 4,,10
+.L140:
+	movl -104(%rbp), %eax
+	movzwl %ax, %eax
+	addl %eax, -60(%rbp)
+	movl -92(%rbp), %eax
+	movswl %ax, %eax
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movw %ax, -24(%rbp)
+	addq $1, -72(%rbp)
+	cmpq $100, -72(%rbp)
+	jl .L140
+.L141:
+	movl ga0+8(%rip), %eax
+	addl $5, %eax
+	jne .L142
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L143
+.L142:
+	movl $1, %eax
+.L143:
+	cmpl %eax, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -41(%rbp)
+	cmpq $0, 16(%rbp)
+	jb .L144
+	cmpq $4, 16(%rbp)
+	jae .L144
+	movl ga1+120(%rip), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movq 16(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+.L144:
+.L145:
+	movq $1, -40(%rbp)
+	movl $853, -120(%rbp)
+	cmpl $32767, -20(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -124(%rbp)
+	cmpb $0, -41(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -128(%rbp)
+	movl -60(%rbp), %eax
+	imull -60(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -132(%rbp)
+	movq 16(%rbp), %rax
+	movl $7, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	shrq $1, %rax
+	movq %rax, -144(%rbp)
+	movl $0, -148(%rbp)
+	cmpq $8, -40(%rbp)
+	jge .L147
+	.p2align 4,,10
+.L146:
+	movl $0, -16(%rbp)
+	movl -120(%rbp), %eax
+	movl %eax, -152(%rbp)
+	movq -40(%rbp), %rax
+	addq $2, %rax
+	movq %rax, %rcx
+	movslq -124(%rbp), %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -156(%rbp)
+	movl -128(%rbp), %eax
+	movl %eax, -160(%rbp)
+	cmpl $100, -16(%rbp)
+	jge .L149
+	.p2align 4,,10
+.L148:
+	movw $1, -24(%rbp)
+	movl -152(%rbp), %eax
+	movl %eax, -164(%rbp)
+	movswl -24(%rbp), %eax
+	movl %eax, -168(%rbp)
+	cmpl $17, %eax
+	jge .L151
+	.p2align 4,,10
+.L150:
+	cmpl $0, -164(%rbp)
+	jne .L154
+	cmpb $0, -41(%rbp)
+	jne .L152
+.L154:
+.L151:
+	cmpq $4, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl -28(%rbp), %ecx
+	cmpq %rcx, %rax
+	je .L155
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -12(%rbp)
+	je .L157
+	movl $538, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L158
+.L157:
+	movl $0, %eax
+.L158:
+	popq %rcx
+	subl %ecx, %eax
+	movsbq %al, %rax
+	movq %rax, -56(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $0, -156(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -44(%rbp)
+.L161:
+.L162:
+.L156:
+	addl $1, -16(%rbp)
+	cmpl $100, -16(%rbp)
+	jl .L148
+	jmp .L149
+.L155:
+	movl -20(%rbp), %eax
+	movswl -24(%rbp), %ecx
+	subl %ecx, %eax
+	je .L159
+	cmpl $0, g0(%rip)
+	je .L159
+	jmp .L149
+.L159:
+.L160:
+	movzwl -44(%rbp), %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	addl -160(%rbp), %eax
+	je .L161
+.L149:
+	movl $9, %eax
+	cltd
+	idivl -132(%rbp)
+	movl %eax, 24(%rbp)
+	cmpl $0, -148(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq -144(%rbp), %rax
+	movl %eax, -16(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $8, -40(%rbp)
+	jl .L146
+.L147:
+	movl $3, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L152:
+.L153:
+	movl -168(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -24(%rbp)
+	movswl -24(%rbp), %eax
+	movl %eax, -168(%rbp)
+	cmpl $17, %eax
+	jl .L150
+	jmp .L151
+.L121:
+	xorl %eax, %eax
+	subq 16(%rbp), %rax
+	cmpq $1, %rax
+	jae .LB11
+.L126:
+.L127:
+	jmp .L120
+.LB10:
+	movl ga1+116(%rip), %eax
+	jmp .f0_return
+.LB11:
+	movzwl -44(%rbp), %eax
+	movl %eax, -100(%rbp)
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	cltd
+	idivl %ecx
+	jmp .f0_return
+.L128:
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	addq -72(%rbp), %rax
+	pushq %rax
+	movq -72(%rbp), %rax
+	movzwl %ax, %eax
+	pushq %rax
+	movzwl -44(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	cmpl $0, -60(%rbp)
+	jne .L132
+	movq -56(%rbp), %rax
+	salq $1, %rax
+	jmp .f0_return
+.LB9:
+	movl -20(%rbp), %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movl %edi, -4(%rbp)
+	movb %sil, -5(%rbp)
+	movl %edx, -12(%rbp)
+	movb %cl, -13(%rbp)
+	movq %r8, -24(%rbp)
+	movq $9, -32(%rbp)
+	movb $165, -33(%rbp)
+	movb $6, -34(%rbp)
+	movl $178, -40(%rbp)
+	movq $5, -48(%rbp)
+	movl $0, -40(%rbp)
+	movl $0, -80(%rbp)
+	movl $2, -76(%rbp)
+	movl $4, -72(%rbp)
+	movl $6, -68(%rbp)
+	movl $8, -64(%rbp)
+	movl $10, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $14, -52(%rbp)
+	movl $8, -40(%rbp)
+	movl $0, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jge .L163
+	movl $33, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L166
+	.p2align 4,,10
+.L165:
+	movl -40(%rbp), %eax
+	imull $10, %eax, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	imull $10, %eax, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	imull $10, %eax, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	movl -40(%rbp), %eax
+	imull $10, %eax, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -232(%rbp)
+	jne .L165
+.L166:
+.L163:
+.L164:
+	cmpl $33, -40(%rbp)
+	jge .L168
+	.p2align 4,,10
+.L167:
+	movl -40(%rbp), %eax
+	imull $10, %eax, %eax
+	movq %rax, %rcx
+	movslq -40(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L167
+.L168:
+	movl $4, %eax
+	pushq %rax
+	movslq -12(%rbp), %rax
+	movq %rax, -240(%rbp)
+	pushq %rax
+	movl $10, %eax
+	movq %rax, %r9
+	movzbl -33(%rbp), %eax
+	movq %rax, %r8
+	movl -4(%rbp), %eax
+	movq %rax, %rcx
+	movl -152(%rbp), %eax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movq %rax, %rsi
+	movl $485, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movl %eax, -112(%rbp)
+	movzbl -5(%rbp), %eax
+	movabsq $67318553376, %rcx
+	subq %rcx, %rax
+	cmpq $1, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	je .L169
+	movq -32(%rbp), %rax
+	movb %al, -13(%rbp)
+	movsbl -34(%rbp), %eax
+	movl %eax, -244(%rbp)
+	imull -244(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -34(%rbp)
+.L169:
+.L170:
+	movl $0, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jge .L172
+	.p2align 4,,10
+.L171:
+	movzbl -5(%rbp), %eax
+	movq %rax, %r9
+	movzbl -13(%rbp), %eax
+	movq %rax, %r8
+	movsbl -34(%rbp), %eax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	movl %eax, -248(%rbp)
+	movq %rax, %rdx
+	movsbl -34(%rbp), %eax
+	movq %rax, %rsi
+	movl ga1+88(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movzwl %ax, %eax
+	pushq %rax
+	movl $65536, %eax
+	pushq %rax
+	movzbl -33(%rbp), %eax
+	movq %rax, %r9
+	movl ga1+52(%rip), %eax
+	movq %rax, %r8
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movl $149, %eax
+	movq %rax, %rdx
+	movl -248(%rbp), %eax
+	movq %rax, %rsi
+	movabsq $27125227234, %rax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	subq $8, %rsp
+	movq -48(%rbp), %rax
+	movl %eax, -252(%rbp)
+	pushq %rax
+	movq -240(%rbp), %rax
+	movq %rax, %r9
+	movl $831, %eax
+	movq %rax, %r8
+	movl -252(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+8(%rip), %eax
+	movq %rax, %rdx
+	movl $289, %eax
+	movq %rax, %rsi
+	movl $477, %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movslq -4(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	movl $0, -40(%rbp)
+	addl $1, -4(%rbp)
+	cmpl $3, -4(%rbp)
+	jl .L171
+.L172:
+	movl -132(%rbp), %eax
+	movslq %eax, %rax
+	movabsq $50907089546, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $69913830301, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L182
+	leaq .L183(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L175
+	# table target .L174
+	# table target .L178
+	# table target .L181
+	# table target .L176
+	# table target .L177
+	# table target .L180
+	# table target .L179
+	jmp *%rcx
+.L182:
+.L175:
+	movq $0, -48(%rbp)
+	movslq -40(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movzbl -13(%rbp), %ecx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -256(%rbp)
+	cmpq $5, -48(%rbp)
+	jge .L185
+	.p2align 4,,10
+.L184:
+	movsbq -34(%rbp), %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -256(%rbp)
+	je .L186
+.L185:
+.L176:
+	movl -40(%rbp), %eax
+	movl %eax, -160(%rbp)
+.L177:
+	movl $2, -4(%rbp)
+	cmpl $16, -4(%rbp)
+	jge .L189
+	.p2align 4,,10
+.L188:
+	movl -64(%rbp), %eax
+	testl %eax, %eax
+	je .L190
+.L189:
+.L178:
+.L173:
+	movq -32(%rbp), %rax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L190:
+.L191:
+	addl $1, -4(%rbp)
+	cmpl $16, -4(%rbp)
+	jl .L188
+	jmp .L189
+.L186:
+.L187:
+	addq $1, -48(%rbp)
+	cmpq $5, -48(%rbp)
+	jl .L184
+	jmp .L185
+.L174:
+	movb $1, -34(%rbp)
+	movl -4(%rbp), %eax
+	addl $32767, %eax
+	pushq %rax
+	movq -240(%rbp), %rax
+	pushq %rax
+	movl $9, %eax
+	pushq %rax
+	movl ga0+8(%rip), %eax
+	cmpl -12(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $3, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	pushq %rax
+	movl $4, %eax
+	pushq %rax
+	movl $980, %eax
+	pushq %rax
+	movl $9, %eax
+	movq %rax, %r9
+	movl $359, %eax
+	movq %rax, %r8
+	movzbl -33(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -5(%rbp), %eax
+	movq %rax, %rdx
+	movl $513, %eax
+	movq %rax, %rsi
+	movzbl -13(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rsi
+	movq $-812, %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L175
+.L179:
+	movq -48(%rbp), %rax
+	pushq %rax
+	movsbl -34(%rbp), %eax
+	movl %eax, -260(%rbp)
+	imull -260(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	addq %rcx, %rax
+	movb %al, -13(%rbp)
+	movq -24(%rbp), %rax
+	movb %al, -13(%rbp)
+	jmp .L173
+.L180:
+	movl $7, %eax
+	movslq %eax, %rax
+	cmpq $254, %rax
+	jge .L200
+	cmpq $0, %rax
+	je .L199
+	cmpq $1, %rax
+	je .L194
+	cmpq $239, %rax
+	je .L197
+.L196:
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	jmp .L192
+.L200:
+	cmpq $486, %rax
+	jge .L201
+	cmpq $254, %rax
+	je .L192
+	cmpq $391, %rax
+	je .L199
+	jmp .L196
+.L199:
+	movl $202, %eax
+	pushq %rax
+	movl ga1+20(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq %rax, %r9
+	movl $143, %eax
+	movq %rax, %r8
+	movl $665, %eax
+	movq %rax, %rcx
+	movsbl -34(%rbp), %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl ga1+40(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	cmpl $-3, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -33(%rbp)
+.L192:
+.L181:
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -13(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -13(%rbp)
+	movl -64(%rbp), %eax
+	cmpl $3, -12(%rbp)
+	setle %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	setae %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	jmp .L173
+.L201:
+	cmpq $486, %rax
+	je .L193
+	cmpq $616, %rax
+	je .L198
+	jmp .L196
+.L194:
+	movzbl -13(%rbp), %eax
+	movl %eax, -264(%rbp)
+	imull -264(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movzbl -5(%rbp), %eax
+	cmpl $2147483647, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -220(%rbp)
+	xorl %eax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -40(%rbp), %eax
+	pushq %rax
+	movzbl -13(%rbp), %eax
+	pushq %rax
+	movzbl -33(%rbp), %eax
+	movq %rax, %r9
+	movl -128(%rbp), %eax
+	movq %rax, %r8
+	movzbl -13(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdx
+	movl -156(%rbp), %eax
+	movq %rax, %rsi
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl -264(%rbp), %eax
+	pushq %rax
+	movl -96(%rbp), %eax
+	pushq %rax
+	movl $448, %eax
+	movq %rax, %rdx
+	movl -4(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L195:
+	jmp .L192
+.L193:
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1000000007, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	jmp .L192
+.L197:
+	movq -48(%rbp), %rax
+	pushq %rax
+	movl -12(%rbp), %eax
+	movl ga1+128(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -156(%rbp), %eax
+	movslq %eax, %rax
+	subq -48(%rbp), %rax
+	movq %rax, %r9
+	movl g0(%rip), %eax
+	subl -40(%rbp), %eax
+	movq %rax, %r8
+	movzbl -5(%rbp), %eax
+	movl %eax, -268(%rbp)
+	imull -268(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	cmpl $6, g0(%rip)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movslq -12(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L198:
+	movl $890, -72(%rbp)
+	jmp .L192
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L183:
+	.long .L174-.L183
+	.long .L175-.L183
+	.long .L178-.L183
+	.long .L175-.L183
+	.long .L175-.L183
+	.long .L181-.L183
+	.long .L176-.L183
+	.long .L177-.L183
+	.long .L180-.L183
+	.long .L175-.L183
+	.long .L179-.L183
+	.popsection
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movabsq $347662120799, %rax
+	movq %rax, -56(%rbp)
+	movl $9, -88(%rbp)
+	movl $10, -84(%rbp)
+	movq $427, -48(%rbp)
+	movl $0, -68(%rbp)
+	movl $1739362076, -72(%rbp)
+	movl $461559466, -76(%rbp)
+	movl $4, -80(%rbp)
+	cmpl $0, -84(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq -56(%rbp), %rax
+	movl -68(%rbp), %eax
+	movl %eax, -92(%rbp)
+	movq -48(%rbp), %rax
+	subq -56(%rbp), %rax
+	testl %eax, %eax
+	jne .LB12
+.L202:
+.L203:
+	movl -80(%rbp), %eax
+	imull -80(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpl $9, -84(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -92(%rbp), %eax
+	movq %rax, -40(%rbp)
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movb %al, -93(%rbp)
+	movq $0, -48(%rbp)
+	cmpl $1, -92(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	movl -80(%rbp), %eax
+	addl $213, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -60(%rbp)
+	movl $1, -32(%rbp)
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq -56(%rbp), %rax
+	addq -56(%rbp), %rax
+	movq %rax, -16(%rbp)
+	cmpq $17, -48(%rbp)
+	jge .L205
+	.p2align 4,,10
+.L204:
+	cmpl $0, -64(%rbp)
+	je .L206
+	movl $6, %eax
+	movq %rax, %r8
+	movl -76(%rbp), %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl ga1+56(%rip), %eax
+	movq %rax, %rsi
+	movsbl -93(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	cmpl %eax, -60(%rbp)
+	je .L208
+	movl -32(%rbp), %eax
+	cmpl %eax, -84(%rbp)
+	jne .L210
+.L205:
+	movl $1, -84(%rbp)
+	cmpl $16, -84(%rbp)
+	jae .L222
+	movl $16, %eax
+	movl -84(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L225
+	.p2align 4,,10
+.L224:
+	movl $424, %eax
+	subl -84(%rbp), %eax
+	shrl $2, %eax
+	testl %eax, %eax
+	je .L226
+	movl -84(%rbp), %eax
+	imull -84(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	jne .LB13
+.L228:
+.L229:
+.L226:
+.L227:
+	addl $1, -84(%rbp)
+	movl $424, %eax
+	subl -84(%rbp), %eax
+	shrl $2, %eax
+	testl %eax, %eax
+	je .L230
+	movl -84(%rbp), %eax
+	imull -84(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	jne .LB14
+.L232:
+.L233:
+.L230:
+.L231:
+	addl $1, -84(%rbp)
+	subq $1, -8(%rbp)
+	jne .L224
+.L225:
+.L222:
+.L223:
+	cmpl $16, -84(%rbp)
+	jae .L235
+	.p2align 4,,10
+.L234:
+	movl $424, %eax
+	subl -84(%rbp), %eax
+	shrl $2, %eax
+	testl %eax, %eax
+	je .L236
+	movl -84(%rbp), %eax
+	imull -84(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	jne .LB15
+.L238:
+.L239:
+.L236:
+.L237:
+	addl $1, -84(%rbp)
+	cmpl $16, -84(%rbp)
+	jb .L234
+.L235:
+	movq $0, -48(%rbp)
+	movl $118, -60(%rbp)
+	cmpq $16, -48(%rbp)
+	jge .L240
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movl $16, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -32(%rbp)
+	cmpq $0, -32(%rbp)
+	je .L243
+	.p2align 4,,10
+.L242:
+	movl $5, %eax
+	pushq %rax
+	movslq g0(%rip), %rax
+	pushq %rax
+	movl g0(%rip), %eax
+	movq %rax, %r9
+	movl -88(%rbp), %eax
+	movw %ax, -8(%rbp)
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -88(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movq %rax, %rsi
+	movl -88(%rbp), %eax
+	movq %rax, -24(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	addq $1, -48(%rbp)
+	movl $5, %eax
+	pushq %rax
+	movslq g0(%rip), %rax
+	pushq %rax
+	movl g0(%rip), %eax
+	movq %rax, %r9
+	movzwl -8(%rbp), %eax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -16(%rbp), %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	addq $1, -48(%rbp)
+	subq $1, -32(%rbp)
+	jne .L242
+.L243:
+.L240:
+.L241:
+	cmpq $16, -48(%rbp)
+	jge .L245
+	.p2align 4,,10
+.L244:
+	movl $5, %eax
+	pushq %rax
+	movslq g0(%rip), %rax
+	pushq %rax
+	movl g0(%rip), %eax
+	movq %rax, %r9
+	movl -88(%rbp), %eax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -88(%rbp), %eax
+	movq %rax, %rsi
+	movl -88(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	addq $1, -48(%rbp)
+	cmpq $16, -48(%rbp)
+	jl .L244
+.L245:
+	movq -40(%rbp), %rax
+	addq %rax, -56(%rbp)
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	cqo
+	idivq %rcx
+	jmp .f2_return
+.LB15:
+	movl $3, %eax
+.f2_return:
+	leave
+	ret
+.L220:
+	movl $1, %eax
+.L221:
+	movslq %eax, %rax
+	popq %rcx
+	subq %rcx, %rax
+	movl %eax, -84(%rbp)
+.L215:
+.L206:
+.L207:
+	movq -16(%rbp), %rax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	cmpq $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	movq %rax, %r8
+	movl $9, %eax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movslq -80(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movl %eax, -88(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $17, -48(%rbp)
+	jl .L204
+	jmp .L205
+.L208:
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $7, %rax
+	jge .L212
+	jmp .L205
+.L210:
+.L211:
+.L212:
+.L213:
+.L209:
+	movl $315, %eax
+	pushq %rax
+	movsbq -93(%rbp), %rax
+	pushq %rax
+	movl -80(%rbp), %eax
+	movq %rax, %r9
+	movl g0(%rip), %eax
+	movq %rax, %r8
+	movl -68(%rbp), %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $44, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	subl %ecx, %eax
+	testw %ax, %ax
+	je .L214
+	movl g0(%rip), %eax
+	imull g0(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -72(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L216
+	jmp .L205
+.L214:
+	movl -72(%rbp), %eax
+	movslq %eax, %rax
+	cmpq -48(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L218
+	jmp .L205
+.L216:
+.L217:
+	cmpl $0, -92(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $7, -88(%rbp)
+	setb %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -93(%rbp)
+	jmp .L215
+.L218:
+.L219:
+	movq -24(%rbp), %rax
+	pushq %rax
+	cmpl $0, -8(%rbp)
+	jne .L220
+	movl g0(%rip), %eax
+	subl $245, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L221
+.LB13:
+	movl $3, %eax
+	jmp .f2_return
+.LB14:
+	movl $3, %eax
+	jmp .f2_return
+.LB12:
+	movl $1, %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rdi, -16(%rbp)
+	movq %rsi, -8(%rbp)
+.rec_entry:
+	cmpq $3, -16(%rbp)
+	jl .L248
+	cmpq $18, -16(%rbp)
+	jg .L248
+.L246:
+.L247:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -16(%rbp)
+	popq %rax
+	movq %rax, -8(%rbp)
+	jmp .rec_entry
+.L248:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movb %dil, -55(%rbp)
+	movb %sil, -54(%rbp)
+	movq $318, -32(%rbp)
+	movb $200, -53(%rbp)
+	movl $3, -52(%rbp)
+	movl $5, -48(%rbp)
+	movl g0(%rip), %eax
+	pushq %rax
+	movl $4, %eax
+	pushq %rax
+	movl -48(%rbp), %eax
+	subl $496, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movl ga0+0(%rip), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movl $4, %eax
+	testl %eax, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $5, %eax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movl $44, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movl $157, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movslq -52(%rbp), %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movq $0, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	testl %eax, %eax
+	je .L249
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L252
+	.p2align 4,,10
+.L251:
+	xorl %eax, %eax
+	movl ga1+92(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	xorl %eax, %eax
+	movl ga1+92(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	xorl %eax, %eax
+	movl ga1+92(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	addq $1, -16(%rbp)
+	xorl %eax, %eax
+	movl ga1+92(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	addq $1, -16(%rbp)
+	subq $1, -8(%rbp)
+	jne .L251
+.L252:
+.L249:
+.L250:
+	cmpq $17, -16(%rbp)
+	jge .L254
+	.p2align 4,,10
+.L253:
+	xorl %eax, %eax
+	movl ga1+92(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rcx
+	movslq g0(%rip), %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L253
+.L254:
+	movl $2147483647, %eax
+	movq %rax, %r8
+	movl $7, %eax
+	movq %rax, %rcx
+	movl $233, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movzbl -53(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rdi
+	call f1
+	testb %al, %al
+	je .L257
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L258
+.L257:
+	movl $0, %eax
+.L258:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L255
+	movl $10, %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L261
+	cmpq $4, %rax
+	je .L260
+	cmpq $302, %rax
+	je .L259
+	jmp .L259
+.L255:
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	testw %ax, %ax
+	je .L300
+	movl -52(%rbp), %eax
+	imull -52(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $866, %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	movsbl -55(%rbp), %eax
+	cmpl $10, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpb $0, -54(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movsbl -54(%rbp), %eax
+	cmpl $4, %eax
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $2, %eax
+	cmpl $8, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	testl %eax, %eax
+	je .L302
+	cmpl $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L303
+.L260:
+	movl $65535, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	addq $181, %rax
+	pushq %rax
+	movl ga1+16(%rip), %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	cmpb $0, -53(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -52(%rbp), %eax
+	pushq %rax
+	movsbq -55(%rbp), %rax
+	pushq %rax
+	movl -52(%rbp), %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movsbl -54(%rbp), %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	movq %rax, %rdx
+	movsbl -54(%rbp), %eax
+	movq %rax, %rsi
+	movl $512, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rdx
+	movl ga1+0(%rip), %eax
+	movq %rax, %rsi
+	movsbl -55(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movq $0, -16(%rbp)
+	cmpl $0, -36(%rbp)
+	je .L263
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L266
+	.p2align 4,,10
+.L265:
+	addq $1, -16(%rbp)
+	addq $1, -16(%rbp)
+	addq $1, -16(%rbp)
+	addq $1, -16(%rbp)
+	subq $1, -8(%rbp)
+	jne .L265
+.L266:
+.L263:
+.L264:
+	cmpq $17, -16(%rbp)
+	jge .L268
+	.p2align 4,,10
+.L267:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L267
+.L268:
+.L261:
+	movq $5, -32(%rbp)
+	movl $513, %eax
+	movq %rax, %r8
+	movl $242, %eax
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	movq %rax, %rdx
+	movl $255, %eax
+	movq %rax, %rsi
+	movl $709, %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	cmpl $4, %eax
+	jge .LB16
+.L269:
+.L270:
+.L259:
+	movq $0, -32(%rbp)
+	xorl %eax, %eax
+	subq $34, %rax
+	movq %rax, -24(%rbp)
+	xorl %eax, %eax
+	subl $5, %eax
+	movl %eax, -44(%rbp)
+	movl $2, %eax
+	addl $9, %eax
+	movl %eax, -40(%rbp)
+	xorl %eax, %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl $624, %eax
+	addl $392, %eax
+	movl %eax, -36(%rbp)
+	cmpq $4, -32(%rbp)
+	jae .L272
+	.p2align 4,,10
+.L271:
+	movl ga0+0(%rip), %eax
+	movswl %ax, %eax
+	cmpl $505, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	jne .L273
+	movzbl -53(%rbp), %eax
+	addl g0(%rip), %eax
+	movb %al, -53(%rbp)
+	jmp .L274
+.L273:
+	xorl %eax, %eax
+	movl ga0+0(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movsbl -54(%rbp), %eax
+	imull %ecx, %eax
+	testl %eax, %eax
+	je .L275
+	cmpl $0, -52(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L276
+.L275:
+	movl $0, %eax
+.L276:
+	movb %al, -54(%rbp)
+.L274:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $6, %rcx
+	ja .L284
+	leaq .L285(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L279
+	# table target .L280
+	# table target .L282
+	# table target .L283
+	# table target .L281
+	# table target .L278
+	jmp *%rcx
+.L284:
+.L279:
+	cmpl $1000000007, g0(%rip)
+	setge %al
+	movzbl %al, %eax
+	addl -44(%rbp), %eax
+	je .L288
+	jmp .L277
+.L288:
+.L289:
+	movsbl -55(%rbp), %eax
+	movb %al, -53(%rbp)
+.L280:
+	addl $4, -48(%rbp)
+.L281:
+	movsbl -55(%rbp), %eax
+	addl -48(%rbp), %eax
+	movb %al, -55(%rbp)
+	movsbl -55(%rbp), %eax
+	movswl %ax, %eax
+	addl $356, %eax
+	addl %eax, -52(%rbp)
+.L277:
+	movl $3, %eax
+	testl %eax, %eax
+	je .L292
+	movl $1000000007, -52(%rbp)
+	movsbl -54(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L294
+.L272:
+.L256:
+	movsbl -55(%rbp), %eax
+	movzbl -53(%rbp), %ecx
+	addl %ecx, %eax
+.f3_return:
+	leave
+	ret
+.L292:
+	cmpl $0, -16(%rbp)
+	je .L296
+	jmp .L272
+.L294:
+.L295:
+.L298:
+.L299:
+.L293:
+	addq $1, -32(%rbp)
+	cmpq $4, -32(%rbp)
+	jb .L271
+	jmp .L272
+.L296:
+.L297:
+	movsbl -55(%rbp), %eax
+	cmpl $256, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movb %al, -54(%rbp)
+	movl -36(%rbp), %eax
+	testb %al, %al
+	je .L298
+	jmp .L272
+.L302:
+	movl $0, %eax
+.L303:
+	movq %rax, %rdx
+	movl $655, %eax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movq -16(%rbp), %rax
+	addq %rax, -16(%rbp)
+	movl ga0+4(%rip), %eax
+	movl ga0+12(%rip), %ecx
+	cmpl %ecx, %eax
+	je .L304
+	cmpl $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movb %al, -55(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -32(%rbp)
+.L304:
+.L305:
+.L306:
+.L307:
+.L301:
+	movl $566, %eax
+	testl %eax, %eax
+	jne .L312
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	addq -32(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L313
+.L312:
+	movl $1, %eax
+.L313:
+	movslq %eax, %rax
+	jmp .L256
+.L300:
+	movl $1, %eax
+	testl %eax, %eax
+	je .L306
+	cmpq $63, -32(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movsbl -55(%rbp), %eax
+	pushq %rax
+	movl $278, %eax
+	movq %rax, %r8
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movl $86, %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $540, -52(%rbp)
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $220, %eax
+	testl %eax, %eax
+	jne .L308
+	cmpl $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L309
+.L308:
+	movl $1, %eax
+.L309:
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f1
+	cmpq $0, -32(%rbp)
+	jne .L310
+	movabsq $136658872207, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L311
+.L310:
+	movl $1, %eax
+.L311:
+	movq %rax, %rdi
+	call f2
+	jmp .L307
+.L262:
+	jmp .L259
+.L278:
+	movsbl -54(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl -48(%rbp), %eax
+	movsbl %al, %eax
+	subl %ecx, %eax
+	je .L286
+	jmp .L277
+.L286:
+.L287:
+	movl $863604357, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl $861, %eax
+	movq %rax, %r9
+	movl -52(%rbp), %eax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	movzbl -53(%rbp), %eax
+	movq %rax, %rdx
+	movsbl -55(%rbp), %eax
+	movq %rax, %rsi
+	movzbl -53(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	jmp .L277
+.L282:
+	jmp .L277
+.L283:
+	movl $142, %eax
+	movq %rax, %rdi
+	call f2
+	testw %ax, %ax
+	je .L277
+	jmp .L277
+.L290:
+.L291:
+	jmp .L277
+.LB16:
+	movq -16(%rbp), %rax
+	subq -32(%rbp), %rax
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	jmp .f3_return
+	.size f3, .-f3
+	.pushsection .rodata
+	.p2align 2
+.L285:
+	.long .L280-.L285
+	.long .L282-.L285
+	.long .L279-.L285
+	.long .L283-.L285
+	.long .L279-.L285
+	.long .L281-.L285
+	.long .L278-.L285
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $368, %rsp
+	movb $7, -1(%rbp)
+	movb $7, -2(%rbp)
+	movl $25, -8(%rbp)
+	movq $2147483647, -16(%rbp)
+	movl $0, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jge .L314
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -88(%rbp)
+	cmpq $0, -88(%rbp)
+	je .L317
+	.p2align 4,,10
+.L316:
+	movslq -8(%rbp), %rax
+	movq %rax, -96(%rbp)
+	salq $1, %rax
+	movq %rax, %rcx
+	movq -96(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movq %rax, -104(%rbp)
+	salq $1, %rax
+	movq %rax, %rcx
+	movq -104(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movq %rax, -112(%rbp)
+	salq $1, %rax
+	movq %rax, %rcx
+	movq -112(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movq %rax, -120(%rbp)
+	salq $1, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -88(%rbp)
+	jne .L316
+.L317:
+.L314:
+.L315:
+	cmpl $16, -8(%rbp)
+	jge .L319
+	.p2align 4,,10
+.L318:
+	movslq -8(%rbp), %rax
+	movq %rax, -128(%rbp)
+	salq $1, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L318
+.L319:
+	movl $0, -8(%rbp)
+	movl $0, -160(%rbp)
+	movl $1, -156(%rbp)
+	movl $2, -152(%rbp)
+	movl $3, -148(%rbp)
+	movl $4, -144(%rbp)
+	movl $5, -140(%rbp)
+	movl $6, -136(%rbp)
+	movl $7, -132(%rbp)
+	movl $8, -8(%rbp)
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L320
+	movl -60(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	movzwl %ax, %eax
+	movq %rax, %rdi
+	call f2
+	movzwl %ax, %eax
+	movq %rax, -16(%rbp)
+	movl -36(%rbp), %eax
+	movl -80(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	imull $808, -8(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+.L328:
+.L322:
+.L321:
+	movzbl -2(%rbp), %eax
+	cmpl $2, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $7, %rcx
+	ja .L343
+	leaq .L344(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L338
+	# table target .L341
+	# table target .L339
+	# table target .L342
+	# table target .L340
+	jmp *%rcx
+.L320:
+	movq $0, -16(%rbp)
+	movb $10, -1(%rbp)
+	movb $10, -1(%rbp)
+	movb $10, -1(%rbp)
+	movb $10, -1(%rbp)
+	movq $4, -16(%rbp)
+	movl -24(%rbp), %eax
+	addl -8(%rbp), %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $9, %rcx
+	ja .L329
+	leaq .L330(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L327
+	# table target .L324
+	# table target .L323
+	# table target .L326
+	# table target .L328
+	# table target .L325
+	jmp *%rcx
+.L343:
+.L338:
+	movl g0(%rip), %eax
+	cmpl g0(%rip), %eax
+	setg %al
+	movzbl %al, %eax
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $358, %rax
+	jge .L358
+	cmpq $-3, %rax
+	je .L357
+	cmpq $22, %rax
+	je .L353
+	cmpq $57, %rax
+	je .L352
+.L351:
+	cmpl $7, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+.L352:
+	cmpl $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, g0(%rip)
+	jmp .L350
+.L358:
+	cmpq $358, %rax
+	je .L354
+	cmpq $497, %rax
+	je .L356
+	cmpq $642, %rax
+	je .L355
+	jmp .L351
+.L329:
+.L327:
+	movl g0(%rip), %eax
+	testl %eax, %eax
+	jne .L334
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L335
+.L334:
+	movl $1, %eax
+.L335:
+	movslq %eax, %rax
+	cmpq $15, %rax
+	je .L333
+	cmpq $41, %rax
+	je .L332
+	cmpq $64, %rax
+	je .L332
+.L333:
+	movq -16(%rbp), %rax
+	movl %eax, -8(%rbp)
+	movzbl -1(%rbp), %eax
+	movabsq $1072708238908, %rcx
+	subq %rcx, %rax
+	movsbl %al, %eax
+	movswl %ax, %eax
+	movl %eax, g0(%rip)
+.L331:
+	movl g0(%rip), %eax
+	movb %al, -2(%rbp)
+	jmp .L322
+.L383:
+	movl $0, %eax
+.L384:
+	movl %eax, -268(%rbp)
+	movl $1, -276(%rbp)
+	cmpl $8, -8(%rbp)
+	jge .L385
+	movl $8, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -288(%rbp)
+	cmpq $0, -288(%rbp)
+	je .L388
+	.p2align 4,,10
+.L387:
+	movl -272(%rbp), %eax
+	addl g0(%rip), %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movl %eax, -292(%rbp)
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	cmpl $0, -268(%rbp)
+	je .L389
+	movzbl -2(%rbp), %eax
+	movl -276(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+.L389:
+.L390:
+	addl $1, -8(%rbp)
+	movl -272(%rbp), %eax
+	addl g0(%rip), %eax
+	cmpl %eax, -292(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	cmpl $0, -268(%rbp)
+	je .L391
+	movzbl -2(%rbp), %eax
+	movl -276(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+.L391:
+.L392:
+	addl $1, -8(%rbp)
+	subq $1, -288(%rbp)
+	jne .L387
+.L388:
+.L385:
+.L386:
+	cmpl $8, -8(%rbp)
+	jge .L394
+	.p2align 4,,10
+.L393:
+	movl -272(%rbp), %eax
+	addl g0(%rip), %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	cmpl $0, -268(%rbp)
+	je .L395
+	movzbl -2(%rbp), %eax
+	movl -276(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+.L395:
+.L396:
+	addl $1, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jl .L393
+.L394:
+.L354:
+	movzbl -1(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	cmpq $0, -16(%rbp)
+	jne .L399
+	movl $10, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L400
+.L399:
+	movl $1, %eax
+.L400:
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $442034129825, %rax
+	subq %rcx, %rax
+	je .L397
+	movl $0, -8(%rbp)
+	movabsq $811492259816, %rax
+	imulq -16(%rbp), %rax
+	movq %rax, -304(%rbp)
+	cmpl $3, -8(%rbp)
+	jge .L402
+	.p2align 4,,10
+.L401:
+	cmpl $6, -8(%rbp)
+	jle .L403
+.L402:
+	cmpb $0, -2(%rbp)
+	jne .L407
+	movl $8, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L408
+.L407:
+	movl $1, %eax
+.L408:
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movb $36, -2(%rbp)
+	movl -144(%rbp), %eax
+	movb %al, -305(%rbp)
+	movzbl -1(%rbp), %eax
+	movl %eax, -312(%rbp)
+	movl g0(%rip), %eax
+	movl %eax, -316(%rbp)
+	movsbl -305(%rbp), %eax
+	movl %eax, -320(%rbp)
+	movq %rax, %rcx
+	imull $3, g0(%rip), %eax
+	addl %ecx, %eax
+	movl %eax, g0(%rip)
+	movl ga0+8(%rip), %eax
+	addl -320(%rbp), %eax
+	movl %eax, ga0+4(%rip)
+	imull $3, g0(%rip), %eax
+	addl -320(%rbp), %eax
+	movl %eax, g0(%rip)
+.L409:
+	movq -16(%rbp), %rax
+	movb %al, -321(%rbp)
+	movzbl -1(%rbp), %eax
+	movl %eax, -328(%rbp)
+	movsbl -321(%rbp), %eax
+	movl %eax, -332(%rbp)
+	movq %rax, %rcx
+	imull $3, g0(%rip), %eax
+	addl %ecx, %eax
+	movl %eax, g0(%rip)
+	movl ga0+8(%rip), %eax
+	addl -332(%rbp), %eax
+	movl %eax, ga0+4(%rip)
+	imull $3, g0(%rip), %eax
+	addl -332(%rbp), %eax
+	movl %eax, g0(%rip)
+.L410:
+.L421:
+.L418:
+.L398:
+.L355:
+	movzbl -2(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	je .L423
+.L422:
+.L350:
+	movzbl -1(%rbp), %eax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L423:
+	movzbl -1(%rbp), %eax
+	movslq %eax, %rax
+	movl %eax, -8(%rbp)
+	jmp .L422
+.L403:
+.L404:
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jne .L405
+	jmp .L402
+.L405:
+.L406:
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	cmpq $41, %rax
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	cmpl -8(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -304(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movzbl -1(%rbp), %eax
+	movq %rax, %rdi
+	call f2
+	addq $8, %rsp
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	subl $4, %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movslq -8(%rbp), %rax
+	pushq %rax
+	movl g0(%rip), %eax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl $139, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	addl $1, -8(%rbp)
+	cmpl $3, -8(%rbp)
+	jl .L401
+	jmp .L402
+.L357:
+	movl g0(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	je .L424
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	movzbl -1(%rbp), %ecx
+	imull %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L425
+.L424:
+	movl $0, %eax
+.L425:
+	movl %eax, -8(%rbp)
+	jmp .L350
+.L397:
+	movq $0, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jge .L411
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $33, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -344(%rbp)
+	cmpq $0, -344(%rbp)
+	je .L414
+	.p2align 4,,10
+.L413:
+	movslq g0(%rip), %rax
+	cmpq -16(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	addq $1, -16(%rbp)
+	movslq g0(%rip), %rax
+	cmpq -16(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	addq $1, -16(%rbp)
+	movslq g0(%rip), %rax
+	cmpq -16(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	addq $1, -16(%rbp)
+	movslq g0(%rip), %rax
+	cmpq -16(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	addq $1, -16(%rbp)
+	subq $1, -344(%rbp)
+	jne .L413
+.L414:
+.L411:
+.L412:
+	cmpq $33, -16(%rbp)
+	jge .L416
+	.p2align 4,,10
+.L415:
+	movslq g0(%rip), %rax
+	cmpq -16(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jl .L415
+.L416:
+	movzbl -1(%rbp), %eax
+	shrq $2, %rax
+	testb %al, %al
+	je .L417
+	movzbl -2(%rbp), %eax
+	movl %eax, -348(%rbp)
+	testl %eax, %eax
+	jl .L418
+	cmpl $33, -348(%rbp)
+	jge .L418
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movabsq $360698915344, %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L419:
+.L420:
+	jmp .L418
+.L353:
+	cmpb $0, -1(%rbp)
+	je .L359
+	movl $3, -8(%rbp)
+	imull $3, g0(%rip), %eax
+	addl $-117, %eax
+	movl %eax, g0(%rip)
+	movl ga1+76(%rip), %eax
+	addl $-117, %eax
+	movl %eax, ga1+28(%rip)
+	imull $3, g0(%rip), %eax
+	movslq %eax, %rax
+	addq $4, %rax
+	movl %eax, g0(%rip)
+.L361:
+	movb $252, -1(%rbp)
+.L365:
+.L360:
+	movl $0, -8(%rbp)
+	movzbl -2(%rbp), %eax
+	movl %eax, -272(%rbp)
+	testl %eax, %eax
+	jl .L383
+	cmpl $8, -272(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L384
+.L356:
+	movl g0(%rip), %eax
+	movb %al, -2(%rbp)
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f3
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl $574, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -1(%rbp)
+	movb $73, -2(%rbp)
+	jmp .L350
+.L332:
+	movslq g0(%rip), %rax
+	movq %rax, -168(%rbp)
+	imull $3, g0(%rip), %eax
+	addl $-65, %eax
+	movl %eax, g0(%rip)
+	movl ga1+76(%rip), %eax
+	addl $-65, %eax
+	movl %eax, ga1+28(%rip)
+	imull $3, g0(%rip), %eax
+	movslq %eax, %rax
+	addq -168(%rbp), %rax
+	movl %eax, g0(%rip)
+.L336:
+	movq -16(%rbp), %rax
+	movq %rax, -176(%rbp)
+	imull $3, g0(%rip), %eax
+	addl $4, %eax
+	movl %eax, g0(%rip)
+	movl ga1+76(%rip), %eax
+	addl $4, %eax
+	movl %eax, ga1+28(%rip)
+	imull $3, g0(%rip), %eax
+	movslq %eax, %rax
+	addq -176(%rbp), %rax
+	movl %eax, g0(%rip)
+.L337:
+	jmp .L331
+.L417:
+	movzbl -2(%rbp), %eax
+	movl %eax, -352(%rbp)
+	addl -352(%rbp), %eax
+	movb %al, -2(%rbp)
+	movzbl -2(%rbp), %eax
+	movl %eax, -356(%rbp)
+	movq -16(%rbp), %rax
+	movl %eax, -360(%rbp)
+	imull $3, g0(%rip), %eax
+	addl $10, %eax
+	movl %eax, g0(%rip)
+	movl ga0+8(%rip), %eax
+	addl $10, %eax
+	movl %eax, ga0+4(%rip)
+	imull $3, g0(%rip), %eax
+	addl $10, %eax
+	movl %eax, g0(%rip)
+	jmp .L421
+.L359:
+	movzbl -1(%rbp), %eax
+	movl %eax, -184(%rbp)
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl ga0+4(%rip), %eax
+	cmpl $911, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jne .L362
+	movzbl -2(%rbp), %eax
+	movl %eax, -188(%rbp)
+	movl -184(%rbp), %eax
+	movl %eax, -192(%rbp)
+	imull $3, g0(%rip), %eax
+	addl $-72, %eax
+	movl %eax, g0(%rip)
+	movl ga0+8(%rip), %eax
+	addl $-72, %eax
+	movl %eax, ga0+4(%rip)
+	imull $3, g0(%rip), %eax
+	addl $-72, %eax
+	movl %eax, g0(%rip)
+.L364:
+	jmp .L363
+.L362:
+	movl -32(%rbp), %eax
+	subl $146, %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	movl -8(%rbp), %eax
+	movb %al, -2(%rbp)
+	movzbl -1(%rbp), %eax
+	movq %rax, %r8
+	movl -64(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -2(%rbp), %eax
+	movq %rax, %rdx
+	movl g0(%rip), %eax
+	movq %rax, %rsi
+	movl ga1+0(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L363:
+	movl -8(%rbp), %eax
+	addl $9, %eax
+	movq %rax, %rcx
+	movl $255, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L367
+	cmpq $3, %rax
+	je .L368
+.L366:
+	movl -8(%rbp), %eax
+	movb %al, -193(%rbp)
+	movzbl -1(%rbp), %eax
+	movl %eax, -200(%rbp)
+	movzbl -2(%rbp), %eax
+	movl %eax, -204(%rbp)
+	movsbl -193(%rbp), %eax
+	movl %eax, -208(%rbp)
+	movq %rax, %rcx
+	imull $3, g0(%rip), %eax
+	addl %ecx, %eax
+	movl %eax, g0(%rip)
+	movl ga0+8(%rip), %eax
+	addl -208(%rbp), %eax
+	movl %eax, ga0+4(%rip)
+	imull $3, g0(%rip), %eax
+	addl -208(%rbp), %eax
+	movl %eax, g0(%rip)
+.L369:
+	movzbl -2(%rbp), %eax
+	movzbl -1(%rbp), %ecx
+	imull %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, -216(%rbp)
+	movslq -8(%rbp), %rax
+	movq %rax, -224(%rbp)
+	cmpq $3, -216(%rbp)
+	jl .L373
+	cmpq $18, -216(%rbp)
+	jle .L371
+.L373:
+	movq -224(%rbp), %rax
+	addq -216(%rbp), %rax
+.L370:
+	popq %rcx
+	addq %rcx, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl g0(%rip), %eax
+	movq %rax, %rdi
+	call f2
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	subq %rcx, %rax
+	movb %al, -1(%rbp)
+	jmp .L365
+.L367:
+	movslq -8(%rbp), %rax
+	movq %rax, -264(%rbp)
+	imull $3, g0(%rip), %eax
+	addl $9, %eax
+	movl %eax, g0(%rip)
+	movl ga1+76(%rip), %eax
+	addl $9, %eax
+	movl %eax, ga1+28(%rip)
+	imull $3, g0(%rip), %eax
+	movslq %eax, %rax
+	addq -264(%rbp), %rax
+	movl %eax, g0(%rip)
+.L382:
+	jmp .L365
+.L368:
+	movq -16(%rbp), %rax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	addq $1, %rax
+	movb %al, -1(%rbp)
+	movzbl -1(%rbp), %eax
+	cmpq %rax, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	jmp .L365
+.L371:
+.L372:
+	movq -216(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -232(%rbp)
+	imulq $3, -224(%rbp), %rax
+	addq -216(%rbp), %rax
+	movq %rax, -240(%rbp)
+	cmpq $3, -232(%rbp)
+	jl .L377
+	cmpq $18, -232(%rbp)
+	jle .L375
+.L377:
+	movq -240(%rbp), %rax
+	addq -232(%rbp), %rax
+.L374:
+	jmp .L370
+.L375:
+.L376:
+	movq -232(%rbp), %rax
+	subq $2, %rax
+	movq %rax, -248(%rbp)
+	imulq $3, -240(%rbp), %rax
+	addq -232(%rbp), %rax
+	movq %rax, -256(%rbp)
+	cmpq $3, -248(%rbp)
+	jl .L381
+	cmpq $18, -248(%rbp)
+	jle .L379
+.L381:
+	movq -256(%rbp), %rax
+	addq -248(%rbp), %rax
+.L378:
+	jmp .L370
+.L379:
+.L380:
+	subq $8, %rsp
+	imulq $3, -256(%rbp), %rax
+	addq -248(%rbp), %rax
+	movq %rax, %rsi
+	movq -248(%rbp), %rax
+	subq $2, %rax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	jmp .L370
+.L323:
+	movq -16(%rbp), %rax
+	movzbl %al, %eax
+	cmpl $2, %eax
+	setg %al
+	movzbl %al, %eax
+	movb %al, -2(%rbp)
+	movl -64(%rbp), %eax
+	addl g0(%rip), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -2(%rbp)
+	jmp .L322
+.L324:
+	jmp .L322
+.L325:
+	movl -132(%rbp), %eax
+	movl %eax, -8(%rbp)
+.L326:
+	jmp .L322
+.L339:
+	movl $3, -136(%rbp)
+	movl -160(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L345
+	movl $557, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L346
+.L345:
+	movl $1, %eax
+.L346:
+	movb %al, -2(%rbp)
+	jmp .L338
+.L340:
+	cmpl $0, -8(%rbp)
+	jl .L338
+	cmpl $4, -8(%rbp)
+	jge .L338
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl $1, (%rdx,%rax,4)
+.L347:
+.L348:
+	jmp .L338
+.L341:
+	movl -152(%rbp), %eax
+	movl %eax, -180(%rbp)
+	imull $3, g0(%rip), %eax
+	addl $-120, %eax
+	movl %eax, g0(%rip)
+	movl ga0+8(%rip), %eax
+	addl $-120, %eax
+	movl %eax, ga0+4(%rip)
+	imull $3, g0(%rip), %eax
+	addl $-120, %eax
+	movl %eax, g0(%rip)
+.L349:
+	jmp .L338
+.L342:
+	jmp .L338
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L330:
+	.long .L324-.L330
+	.long .L327-.L330
+	.long .L323-.L330
+	.long .L326-.L330
+	.long .L328-.L330
+	.long .L327-.L330
+	.long .L327-.L330
+	.long .L327-.L330
+	.long .L327-.L330
+	.long .L325-.L330
+	.p2align 2
+.L344:
+	.long .L341-.L344
+	.long .L339-.L344
+	.long .L338-.L344
+	.long .L338-.L344
+	.long .L342-.L344
+	.long .L338-.L344
+	.long .L338-.L344
+	.long .L340-.L344
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,89 @@
+char g0 = 5;
+long g1;
+int ga0[8];
+int ga1[4];
+short f0(unsigned short p0, long p1, unsigned char p2, unsigned short p3, char p4, short p5, long p6) {
+    long v0 = 127;
+    unsigned char v1 = 853;
+    int i0 = 1000000007;
+    long j0 = 10;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    if ((4294967295 <= (6 && 1))) {
+        if (553398532893) { return (129 / (p4 * p4 + 1)); }
+    } else {
+        if (p0) { return (char)(127U); }
+        if ((unsigned char)((short)(0))) { return (p4 - p6); }
+    }
+    if ((32767 / (j0 * j0 + 1))) { return !(p5); }
+    v0 = (char)((!(3) != (unsigned short)(i0)));
+    p6 = p3;
+    return (g1 - ((p4 + 7) - (g0 < p4)));
+}
+void w0(short q0, unsigned long q1, int q2) {
+    ga1[2] = ga1[0] + q2;
+}
+int main() {
+    unsigned short v0 = 10;
+    unsigned int v1 = 233U;
+    unsigned char v2 = 8;
+    int i0 = 7;
+    long j0 = 970;
+    v1 = (int)(f0(g0, ga1[0], ga0[4], i0, i0, 4, 7));
+    f0(g1, f0(10l, i0, 8, g1, v1, 10, g0), (j0 == 736), 864, g0, (10 * i0), !(v0));
+    v0 = v0;
+    v1 = 0;
+    while (v1 < 16) {
+        if ((long)(v2)) {
+            v2 = ((89 >= 10) != (7U <= 470));
+            if ((v2 / (v1 * v1 + 1))) {
+                i0 = 4l;
+                if (v0) { break; }
+                if (!((819 + v0))) { break; }
+            }
+        }
+        ga0[5] = 10;
+        v1 = v1 + 1;
+    }
+    g1 = ((i0 || g1) * i0);
+    if ((((i0 + v2) - 7) != (g1 - v2))) {
+        if (231) {
+            w0(v2, g1, j0);
+            w0(v2, 171, 233131069191);
+            if ((918 >= g1)) {
+                w0(i0, g0, 73);
+                j0 = (f0(843, j0, 707570457366, v1, g1, 468, 6) / 10);
+                v0 = ((g1 + (v0 || 10)) != ((unsigned int)(4) && (unsigned int)(ga0[2])));
+            } else {
+                v0 = v0 + ((7 - 317524689756l) < (0 + ga0[6]));
+            }
+        }
+        if (v0 >= 0 && v0 < 4) { ga1[v0] = f0(v0, 0, v0, j0, i0, 618456708959, g0); }
+        v0 = v0 + (ga0[5] || !(j0));
+    }
+    g1 = ((!(1033342376755) * i0) < (!(708) / (v1 * v1 + 1)));
+    if (((8l >= !(ga1[2])) / 1024)) {
+        g0 = j0;
+    } else {
+        j0 = 0;
+        while (j0 < 3) {
+            ga0[j0] = v1;
+            i0 = i0 + ((1003563402138 / 1024) - (g0 > 261750108139));
+            j0 = j0 + 1;
+        }
+        v1 = v1 + 230;
+        v1 = 2147483647;
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,888 @@
+	.section .data
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.byte 5
+	.section .bss
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 16
+	.p2align 5
+ga1:
+	.zero 16
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movw %di, -2(%rbp)
+	movq %rsi, -16(%rbp)
+	movb %dl, -17(%rbp)
+	movw %cx, -20(%rbp)
+	movb %r8b, -21(%rbp)
+	movw %r9w, -24(%rbp)
+	movq $127, -32(%rbp)
+	movb $85, -33(%rbp)
+	movl $1000000007, -40(%rbp)
+	movq $10, -48(%rbp)
+	movl $0, -40(%rbp)
+	imull $10, -40(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -40(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -40(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $10, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $10, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $10, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	addl $10, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	subq $1, -128(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -40(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $10, -116(%rbp)
+	movslq -40(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -40(%rbp)
+	cmpl $16, -40(%rbp)
+	jl .L4
+.L5:
+	movl $6, %eax
+	testl %eax, %eax
+	je .L8
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L9
+.L8:
+	movl $0, %eax
+.L9:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	cmpq %rcx, %rax
+	jg .L6
+	movabsq $553398532893, %rax
+	testq %rax, %rax
+	jne .LB0
+.L10:
+.L11:
+.L14:
+.L15:
+.L7:
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $32767, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L16
+	cmpw $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L6:
+	cmpw $0, -2(%rbp)
+	jne .LB1
+.L12:
+.L13:
+	xorl %eax, %eax
+	testb %al, %al
+	je .L14
+	movsbq -21(%rbp), %rax
+	subq 16(%rbp), %rax
+	jmp .f0_return
+.L16:
+.L17:
+	movl -40(%rbp), %eax
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movsbq %al, %rax
+	movq %rax, -32(%rbp)
+	movzwl -20(%rbp), %eax
+	movq %rax, 16(%rbp)
+	movsbl -21(%rbp), %eax
+	movl %eax, -136(%rbp)
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -136(%rbp), %eax
+	addl $7, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq g1(%rip), %rax
+	subq %rcx, %rax
+	jmp .f0_return
+.LB0:
+	movsbl -21(%rbp), %eax
+	movl %eax, -132(%rbp)
+	imull -132(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $129, %eax
+	cltd
+	idivl %ecx
+	jmp .f0_return
+.LB1:
+	movl $127, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movw %di, -2(%rbp)
+	movq %rsi, -16(%rbp)
+	movb %dl, -17(%rbp)
+	movw %cx, -20(%rbp)
+	movb %r8b, -21(%rbp)
+	movq %r9, -32(%rbp)
+	movq $127, -40(%rbp)
+	movb $85, -41(%rbp)
+	movl $1000000007, -48(%rbp)
+	movq $10, -56(%rbp)
+	movl $0, -48(%rbp)
+	imull $10, -48(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -48(%rbp)
+	jge .L18
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L21
+	.p2align 4,,10
+.L20:
+	addl $10, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $10, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $10, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $10, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -144(%rbp)
+	jne .L20
+.L21:
+.L18:
+.L19:
+	cmpl $16, -48(%rbp)
+	jge .L23
+	.p2align 4,,10
+.L22:
+	addl $10, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L22
+.L23:
+	cmpw $0, -2(%rbp)
+	jne .LB2
+.L24:
+.L25:
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $32767, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L26
+	movl $0, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L26:
+.L27:
+	movl -48(%rbp), %eax
+	movzwl %ax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movsbq %al, %rax
+	movq %rax, -40(%rbp)
+	movzwl -20(%rbp), %eax
+	movq %rax, -32(%rbp)
+	movsbl -21(%rbp), %eax
+	movl %eax, -148(%rbp)
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -148(%rbp), %eax
+	addl $7, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq g1(%rip), %rax
+	subq %rcx, %rax
+	jmp .f0.constprop.0_return
+.LB2:
+	movl $127, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movw $10, -2(%rbp)
+	movl $233, -8(%rbp)
+	movb $8, -9(%rbp)
+	movl $7, -16(%rbp)
+	movq $970, -24(%rbp)
+	movl $7, %eax
+	movq %rax, %r9
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	movq %rax, %rdx
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movsbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movswl %ax, %eax
+	movl %eax, -8(%rbp)
+	subq $8, %rsp
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	imull $10, -16(%rbp), %eax
+	pushq %rax
+	movsbl g0(%rip), %eax
+	pushq %rax
+	movl $864, %eax
+	pushq %rax
+	cmpq $736, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movslq -16(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq g1(%rip), %rax
+	movw %ax, -34(%rbp)
+	movl -8(%rbp), %eax
+	movb %al, -35(%rbp)
+	movsbq g0(%rip), %rax
+	movq %rax, -48(%rbp)
+	movq $127, -56(%rbp)
+	movb $85, -57(%rbp)
+	movl $1000000007, -64(%rbp)
+	movq $10, -72(%rbp)
+	movl $0, -64(%rbp)
+	imull $10, -64(%rbp), %eax
+	subl $10, %eax
+	movl %eax, -148(%rbp)
+	cmpl $16, -64(%rbp)
+	jge .L29
+	movl $16, %eax
+	movslq -64(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L32
+	.p2align 4,,10
+.L31:
+	addl $10, -148(%rbp)
+	movslq -64(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -64(%rbp)
+	addl $10, -148(%rbp)
+	movslq -64(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -64(%rbp)
+	addl $10, -148(%rbp)
+	movslq -64(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -64(%rbp)
+	addl $10, -148(%rbp)
+	movslq -64(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -64(%rbp)
+	subq $1, -160(%rbp)
+	jne .L31
+.L32:
+.L29:
+.L30:
+	cmpl $16, -64(%rbp)
+	jge .L34
+	.p2align 4,,10
+.L33:
+	addl $10, -148(%rbp)
+	movslq -64(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -64(%rbp)
+	cmpl $16, -64(%rbp)
+	jl .L33
+.L34:
+	movl $127, %eax
+.L28:
+	movswq %ax, %rax
+	movq %rax, %rsi
+	movq g1(%rip), %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl $0, -8(%rbp)
+	movl $0, -164(%rbp)
+	movzwl -2(%rbp), %eax
+	movl %eax, -172(%rbp)
+	addl $819, %eax
+	movl %eax, -168(%rbp)
+	cmpl $16, -8(%rbp)
+	jae .L36
+	.p2align 4,,10
+.L35:
+	movzbl -9(%rbp), %eax
+	testq %rax, %rax
+	je .L37
+	movl -164(%rbp), %eax
+	movb %al, -9(%rbp)
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	je .L39
+	movl $4, -16(%rbp)
+	cmpw $0, -2(%rbp)
+	je .L41
+.L36:
+	cmpl $0, -16(%rbp)
+	jne .L45
+	cmpq $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L46
+.L43:
+.L44:
+.L39:
+.L40:
+.L37:
+.L38:
+	movl $10, ga0+20(%rip)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jb .L35
+	jmp .L36
+.L45:
+	movl $1, %eax
+.L46:
+	imull -16(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	movzbl -9(%rbp), %eax
+	movq %rax, -184(%rbp)
+	movq %rax, %rcx
+	movq g1(%rip), %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	addl -16(%rbp), %eax
+	subl $7, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	je .L47
+	movzbl -9(%rbp), %eax
+	movw %ax, -186(%rbp)
+	movq g1(%rip), %rax
+	movq %rax, -200(%rbp)
+	movq -24(%rbp), %rax
+	movl %eax, -204(%rbp)
+	movl ga1+0(%rip), %eax
+	addl -204(%rbp), %eax
+	movl %eax, ga1+8(%rip)
+.L49:
+	movzbl -9(%rbp), %eax
+	movw %ax, -206(%rbp)
+	movl ga1+0(%rip), %eax
+	addl $1202835207, %eax
+	movl %eax, ga1+8(%rip)
+.L50:
+	cmpq $918, g1(%rip)
+	jg .L51
+	movl -16(%rbp), %eax
+	movw %ax, -208(%rbp)
+	movsbq g0(%rip), %rax
+	movq %rax, -216(%rbp)
+	movl ga1+0(%rip), %eax
+	addl $73, %eax
+	movl %eax, ga1+8(%rip)
+.L53:
+	subq $8, %rsp
+	movl $6, %eax
+	pushq %rax
+	movl $468, %eax
+	movq %rax, %r9
+	movq g1(%rip), %rax
+	movq %rax, %r8
+	movl -8(%rbp), %eax
+	movq %rax, %rcx
+	movl $22, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl $843, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movswl %ax, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpw $0, -2(%rbp)
+	jne .L54
+	movl $10, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L55
+.L58:
+	movl $1, %eax
+.L59:
+	addl -220(%rbp), %eax
+	movw %ax, -2(%rbp)
+.L47:
+.L48:
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	movl ga1+8(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $8, %rax
+	setle %al
+	movzbl %al, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L60
+	movq -24(%rbp), %rax
+	movb %al, g0(%rip)
+	jmp .L61
+.L60:
+	movq $0, -24(%rbp)
+	movq $980042384, -232(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -236(%rbp)
+	movl %eax, ga0+0(%rip)
+	movsbq g0(%rip), %rax
+	movabsq $261750108139, %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -232(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -16(%rbp)
+	movl -236(%rbp), %eax
+	movl %eax, ga0+4(%rip)
+	movsbq g0(%rip), %rax
+	movabsq $261750108139, %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -232(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -16(%rbp)
+	movl -236(%rbp), %eax
+	movl %eax, ga0+8(%rip)
+	movsbq g0(%rip), %rax
+	movabsq $261750108139, %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -232(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -16(%rbp)
+	movq $3, -24(%rbp)
+	addl $230, -8(%rbp)
+	movl $2147483647, -8(%rbp)
+.L61:
+	movq $0, -248(%rbp)
+	imulq $31, -248(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	imulq $31, -248(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -248(%rbp)
+	imulq $31, -248(%rbp), %rax
+	movzwl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	imulq $31, -248(%rbp), %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	imulq $31, -248(%rbp), %rax
+	addq -184(%rbp), %rax
+	movq %rax, -248(%rbp)
+	imulq $31, -248(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	imulq $31, -248(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -248(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	jge .L62
+	movl $8, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L65
+	.p2align 4,,10
+.L64:
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -256(%rbp)
+	jne .L64
+.L65:
+.L62:
+.L63:
+	cmpl $8, -16(%rbp)
+	jge .L67
+	.p2align 4,,10
+.L66:
+	movslq -16(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	jl .L66
+.L67:
+	movl $0, -16(%rbp)
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	movl ga1+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -248(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	movl $4, -16(%rbp)
+	movq -248(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -248(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -248(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -248(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -248(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -248(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -248(%rbp)
+	movq -248(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L41:
+.L42:
+	cmpl $0, -168(%rbp)
+	jne .L43
+	jmp .L36
+.L54:
+	movl $1, %eax
+.L55:
+	movslq %eax, %rax
+	addq g1(%rip), %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	jmp .L52
+.L51:
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-317524689749, %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	addl -172(%rbp), %eax
+	movw %ax, -2(%rbp)
+.L52:
+	movzwl -2(%rbp), %eax
+	movl %eax, -220(%rbp)
+	testl %eax, %eax
+	jl .L56
+	cmpl $4, -220(%rbp)
+	jge .L56
+	subq $8, %rsp
+	movsbq g0(%rip), %rax
+	pushq %rax
+	movl $30559, %eax
+	movq %rax, %r9
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L56:
+.L57:
+	movl ga0+20(%rip), %eax
+	testl %eax, %eax
+	jne .L58
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .L59
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,328 @@
+unsigned short g0 = 3;
+long g1;
+long g2 = 9;
+unsigned long f0(int p0, short p1, unsigned long p2) {
+    short v0 = 504;
+    long v1 = 151;
+    unsigned char v2 = 573;
+    long v3 = 363u;
+    int i0 = 450395566011;
+    long j0 = 3;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 247U; }
+    if (g2 >= 0 && g2 < 33) { la0[g2] = (g1 - g0); }
+    i0 = 0;
+    while (i0 < 16) {
+        if (-((la0[28] / (g2 * g2 + 1)))) {
+            j0 = (((6 < 841) <= (78810582645 + p1)) - ((v0 && v2) >= (v1 == 985302404623)));
+            v1 = -(j0);
+            p2 = !((10 <= 221));
+        }
+        i0 = i0 + 1;
+    }
+    p2 = la0[26];
+    if (v1 >= 0 && v1 < 33) { la0[v1] = ((long)(g0) / (g2 * g2 + 1)); }
+    return (g2 <= ((2 > j0) / 5l));
+}
+void w0(unsigned short q0, unsigned long q1) {
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q0;
+}
+unsigned long f1(int p0, long p1, int p2, unsigned char p3, long p4, unsigned char p5, unsigned long p6, unsigned int p7) {
+    char v0 = 3;
+    int v1 = 0;
+    unsigned long v2 = 9;
+    char v3 = 1;
+    int v4 = 0U;
+    unsigned char v5 = 6;
+    int i0 = 680284604993;
+    long j0 = 7l;
+    p7 = 0;
+    while (p7 < 33) {
+        p2 = (int)(f0(v3, 2, 0));
+        i0 = (g2 >= (g1 / (i0 * i0 + 1)));
+        if (((p3 < (5 / (p6 * p6 + 1))) / 5l)) {
+            if (((6 || v3) < 5)) { break; }
+        }
+        p7 = p7 + 1;
+    }
+    if (v2) {
+        p6 = (-((p7 / (p0 * p0 + 1))) * -((848 == v0)));
+    } else {
+        if ((short)(f0(255, g0, 2))) {
+            p5 = p5 + f0(178, 437, v3);
+            for (p0 = 2; p0 < 100; p0 = p0 + 1) {
+                v1 = (10 != ((4 <= 8) + j0));
+            }
+        }
+        p3 = ((f0(332009287311, 255, g2) - (830 <= 474)) * p1);
+    }
+    if (((unsigned short)(591U) / 2)) { return v0; }
+    p2 = p2 + (g0 / (p0 * p0 + 1));
+    switch (((32767 <= p6) / (v0 * v0 + 1))) {
+    default:
+    case 10:
+        break;
+    case 4:
+        if ((p0 < f0(222, v2, 7))) {
+            v0 = ((g2 * (9 + 7)) != 3);
+            if ((int)(((short)(v0) - p0))) {
+                v0 = 4;
+            }
+        } else {
+            v4 = ((-(894) * -(v1)) > (long)(g0));
+        }
+    case 5:
+    case 0:
+        if (-((803161661367 >= 6))) { return (8 != (2 < 9)); }
+        break;
+    case 3:
+    case 1:
+        switch (!((984 <= 329))) {
+        case 288:
+            v2 = v2 + !((p1 >= v0));
+            break;
+        case 45:
+        case 2:
+            p3 = 860778434343;
+            break;
+        case -1:
+            for (j0 = 1; j0 < 33; j0 = j0 + 1) {
+                p5 = (((i0 >= g1) <= !(1)) <= f0(633, 7L, 255));
+                v3 = f0(127, 1ul, (3 / 13ul));
+            }
+        default:
+            break;
+        }
+        if (f0(246, !(g1), g0)) {
+            f0((g1 - g1), (v1 - p2), (v1 + v3));
+        } else {
+            i0 = 0;
+            while (i0 < 17) {
+                v1 = (i0 || (g2 && (unsigned long)(6)));
+                i0 = i0 + 1;
+            }
+        }
+        break;
+    }
+    p7 = 0;
+    while (p7 < 17) {
+        switch (((2 || 1) != (short)(6))) {
+        case 4:
+            if (((458 > (731 / 8)) && (long)((0 / (v3 * v3 + 1))))) {
+                v5 = v2;
+                if (!(p4)) { break; }
+            } else {
+                v4 = (((3 && 65536) >= 616) + (long)(v5));
+                if (((unsigned short)(0) > (2 / 4))) { break; }
+                if ((i0 - 76694072255)) { break; }
+            }
+            break;
+        default:
+            break;
+        case 7:
+            p1 = (!(9) && (p6 / (g0 * g0 + 1)));
+        case 3:
+            p0 = 0;
+            while (p0 < 3) {
+                p4 = p4 + 1043213055576L;
+                v3 = f0(p2, 2, v0);
+                p0 = p0 + 1;
+            }
+            for (p2 = 0; p2 < 4; p2 = p2 + 1) {
+                p4 = 1000;
+            }
+        case 0:
+            v2 = -(p7);
+            switch (0) {
+            case 2:
+                if ((f0(151L, p2, 32767) / (p4 * p4 + 1))) { break; }
+                p0 = 9l;
+            case 8:
+            case 7:
+                break;
+            case 1:
+                break;
+            case 4:
+                p3 = p3 + (f0(9, 323u, 255) >= (i0 >= 4));
+            }
+            break;
+        case 8:
+            p6 = p2;
+            break;
+        case 6:
+            p5 = v5;
+            break;
+        }
+        if ((1 < 505)) {
+            p0 = (f0(1, 8U, 5) - v4);
+            j0 = f0((i0 / (v2 * v2 + 1)), f0(1, v5, 5), 836);
+            if (f0((p4 || g1), 506, 7)) {
+                if (((4 + 3) == (g2 / 100))) { break; }
+                i0 = 762;
+                if (f0(i0, v5, 2)) { break; }
+            } else {
+                if (((6 && 9) / (p2 * p2 + 1))) { break; }
+                if (3) { break; }
+                f0((8 - p6), !(0), f0(v0, 10, p6));
+            }
+        }
+        p7 = p7 + 1;
+    }
+    for (i0 = 2; i0 < 3; i0 = i0 + 1) {
+        f0((unsigned short)(117463454614), (286108881461 / (v0 * v0 + 1)), (139 || p1));
+    }
+    f0(v1, p5, (190u / (g1 * g1 + 1)));
+    return i0;
+}
+long rec(long n, long acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 3, acc * 3 + n);
+}
+int main() {
+    unsigned char v0 = 1;
+    char v1 = 3;
+    short v2 = 2;
+    int i0 = 256;
+    long j0 = 256;
+    if (((104 / (g2 * g2 + 1)) + ((v1 || g2) / 1))) {
+        if (((v1 / (j0 * j0 + 1)) != (unsigned int)(2))) { return 9; }
+        for (j0 = 1; j0 < 5; j0 = j0 + 1) {
+            g2 = ((long)(rec(g1, 3)) >= 82);
+        }
+        g1 = !(((3 > 7) >= (j0 / 3u)));
+    } else {
+        g0 = g0 + ((10 != 8) + 8);
+        if ((((unsigned int)(7) / 100) / (v1 * v1 + 1))) {
+            v1 = ((3 + 443) && f1(g1, 6, 623, g0, i0, i0, 7, 117));
+            v2 = (-((9 != 521)) / (g2 * g2 + 1));
+            if (-(((4 / (i0 * i0 + 1)) * f0(773, j0, 487)))) {
+                g1 = rec(!(j0), (unsigned char)(g0));
+                j0 = 5;
+                j0 = (v1 - !(!(7)));
+            }
+        }
+        j0 = rec(2L, v1);
+    }
+    if ((6 / 1)) {
+        g0 = 277;
+    }
+    if (j0) {
+        w0(127, 9L);
+        g2 = f0((i0 + 32767), (i0 && j0), rec(848, 455l));
+        if (j0) {
+            g1 = (unsigned long)(g0);
+            g0 = rec(574651760242, (int)(5));
+        }
+    } else {
+        v2 = 0;
+        while (v2 < 8) {
+            if (i0) {
+                if ((4 / 2)) { break; }
+                if (((unsigned int)(4294967295) && 576)) { break; }
+                j0 = v1;
+            } else {
+                if (v0) { break; }
+                if (-((j0 || g1))) { break; }
+            }
+            v2 = v2 + 1;
+        }
+        if (g2) {
+            if (g2) {
+                w0(g1, v1);
+                w0(3, v1);
+                w0(723, j0);
+            } else {
+                g0 = (4 || (5 / 16));
+            }
+            j0 = 0;
+            while (j0 < 8) {
+                g0 = g0 + 440;
+                j0 = j0 + 1;
+            }
+            g0 = i0;
+        }
+        if (f1((630 - 405), (1 / (g2 * g2 + 1)), (6 < i0), (867 - 702775459458), rec(6, 32767), (8 < g2), 6, (v1 + 122))) {
+            switch (g2) {
+            case 5:
+                break;
+            case -2:
+                break;
+            case 672:
+                w0(381, j0);
+                g0 = (3 < rec(j0, g1));
+                break;
+            }
+            g1 = f0((v1 > v0), (g1 + 687), (505l * 365));
+            g1 = g1 + ((5 > 5) || rec(6, v1));
+        }
+    }
+    j0 = 0;
+    while (j0 < 3) {
+        for (v2 = 0; v2 < 4; v2 = v2 + 1) {
+            i0 = 0;
+            while (i0 < 16) {
+                if (!((v0 > 6))) { break; }
+                if (g2) { break; }
+                if (((v2 == g2) <= g0)) { break; }
+                i0 = i0 + 1;
+            }
+            i0 = 485;
+        }
+        if ((unsigned int)(-((2L < 5)))) {
+            i0 = (9 >= (unsigned int)((603 * g2)));
+            g0 = !((8 < (int)(i0)));
+        }
+        j0 = j0 + 1;
+    }
+    for (j0 = 1; j0 < 5; j0 = j0 + 1) {
+        switch (-((g1 / 100))) {
+        case 387:
+            if (10) {
+                g0 = (((unsigned char)(349) * j0) == ((j0 <= 4294967295) + (1 + 2)));
+            } else {
+                if (((i0 > v0) + (unsigned char)(v2))) { break; }
+            }
+            v1 = v1 + 819;
+            break;
+        default:
+            v1 = -(65536);
+            v2 = (((unsigned int)(5) + !(v0)) < !((g1 + 680038164207)));
+            break;
+        case 76:
+            if ((g1 / (g0 * g0 + 1))) {
+                g1 = rec(v1, g2);
+                if ((i0 - (g0 - 0))) { return g1; }
+                if (f0(v1, j0, g0)) { break; }
+            } else {
+                if ((v1 != (v2 + g1))) { break; }
+                g1 = (((unsigned char)(289) == v2) != f1(4, 34093450003, 217, 1, 9, 0, v0, 6));
+            }
+        case 47:
+            if (((1 + 10) || (781 / 10))) { break; }
+            break;
+        case 162:
+            v0 = v0 + (v1 * !(455));
+            g0 = g0 + -((j0 || 9));
+            break;
+        }
+        g1 = (i0 > ((v1 != g0) == (g1 - 302)));
+        v1 = (((v2 - 65535) / (g1 * g1 + 1)) * f1(g1, 597, 7, i0, i0, 529, g1, 627445314231));
+    }
+    for (j0 = 0; j0 < 16; j0 = j0 + 1) {
+        g1 = ((f0(v2, 892, g1) / (g2 * g2 + 1)) <= -(180620748546));
+        w0(v1, v1);
+    }
+    j0 = j0 + (-(729) || (331 - g2));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
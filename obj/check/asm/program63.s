@@ -0,0 +1,2542 @@
+	.section .data
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.short 3
+	.type g2, @object
+	.size g2, 8
+	.p2align 3
+g2:
+	.quad 9
+	.section .bss
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.zero 8
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type rec, @function
+	.type f0.constprop.2, @function
+	.type f0.constprop.3, @function
+	.type f0.constprop.1, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movq %rdx, -16(%rbp)
+	movw $504, -18(%rbp)
+	movq $151, -32(%rbp)
+	movb $61, -33(%rbp)
+	movq $363, -48(%rbp)
+	movl $-576000069, -52(%rbp)
+	movq $3, -64(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jge .L0
+	movl $33, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -216(%rbp)
+	cmpq $0, -216(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -216(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -52(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jl .L4
+.L5:
+	cmpq $0, g2(%rip)
+	jl .L6
+	cmpq $33, g2(%rip)
+	jge .L6
+	movq g1(%rip), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movq g2(%rip), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+.L6:
+.L7:
+	movl $0, -52(%rbp)
+	movabsq $78810582645, %rax
+	movswq -6(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	cmpl $841, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -220(%rbp)
+	cmpw $0, -18(%rbp)
+	je .L8
+	cmpb $0, -33(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L9
+.L8:
+	movl $0, %eax
+.L9:
+	movl %eax, -224(%rbp)
+	movl $10, %eax
+	cmpl $221, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -228(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L10
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L11
+	.p2align 4,,10
+.L12:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L14
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -224(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -220(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -228(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L14:
+.L15:
+	addl $1, -52(%rbp)
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L16
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -224(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -220(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -228(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L16:
+.L17:
+	addl $1, -52(%rbp)
+	subq $1, -240(%rbp)
+	jne .L12
+.L13:
+.L10:
+.L11:
+	cmpl $16, -52(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L20
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -224(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -220(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -228(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L20:
+.L21:
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L18
+.L19:
+	movl -104(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -32(%rbp)
+	jl .L22
+	cmpq $33, -32(%rbp)
+	jge .L22
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+.L22:
+.L23:
+	cmpq $2, -64(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	cmpq %rax, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movl %edi, -4(%rbp)
+	movq %rsi, -16(%rbp)
+	movw $504, -18(%rbp)
+	movq $151, -32(%rbp)
+	movb $61, -33(%rbp)
+	movq $363, -48(%rbp)
+	movl $-576000069, -52(%rbp)
+	movq $3, -64(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jge .L24
+	movl $33, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -216(%rbp)
+	cmpq $0, -216(%rbp)
+	je .L25
+	.p2align 4,,10
+.L26:
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -216(%rbp)
+	jne .L26
+.L27:
+.L24:
+.L25:
+	cmpl $33, -52(%rbp)
+	jge .L29
+	.p2align 4,,10
+.L28:
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jl .L28
+.L29:
+	cmpq $0, g2(%rip)
+	jl .L30
+	cmpq $33, g2(%rip)
+	jge .L30
+	movq g1(%rip), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movq g2(%rip), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+.L30:
+.L31:
+	movl $0, -52(%rbp)
+	cmpw $0, -18(%rbp)
+	je .L32
+	cmpb $0, -33(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L33
+.L32:
+	movl $0, %eax
+.L33:
+	movl %eax, -220(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L34
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L35
+	.p2align 4,,10
+.L36:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L38
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -220(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq $0, -16(%rbp)
+.L38:
+.L39:
+	addl $1, -52(%rbp)
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L40
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -220(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq $0, -16(%rbp)
+.L40:
+.L41:
+	addl $1, -52(%rbp)
+	subq $1, -232(%rbp)
+	jne .L36
+.L37:
+.L34:
+.L35:
+	cmpl $16, -52(%rbp)
+	jge .L43
+	.p2align 4,,10
+.L42:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L44
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -220(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq $0, -16(%rbp)
+.L44:
+.L45:
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L42
+.L43:
+	movl -104(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -32(%rbp)
+	jl .L46
+	cmpq $33, -32(%rbp)
+	jge .L46
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+.L46:
+.L47:
+	cmpq $2, -64(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	cmpq %rax, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rdi, -16(%rbp)
+	movq %rsi, -8(%rbp)
+.rec_entry:
+	cmpq $2, -16(%rbp)
+	jl .L50
+	cmpq $18, -16(%rbp)
+	jg .L50
+.L48:
+.L49:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	popq %rax
+	movq %rax, -8(%rbp)
+	jmp .rec_entry
+.L50:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movq %rdi, -8(%rbp)
+	movw $504, -10(%rbp)
+	movq $151, -24(%rbp)
+	movb $61, -25(%rbp)
+	movq $363, -40(%rbp)
+	movl $-576000069, -44(%rbp)
+	movq $3, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jge .L51
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L52
+	.p2align 4,,10
+.L53:
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -200(%rbp)
+	jne .L53
+.L54:
+.L51:
+.L52:
+	cmpl $33, -44(%rbp)
+	jge .L56
+	.p2align 4,,10
+.L55:
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L55
+.L56:
+	cmpq $0, g2(%rip)
+	jl .L57
+	cmpq $33, g2(%rip)
+	jge .L57
+	movq g1(%rip), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movq g2(%rip), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L57:
+.L58:
+	movl $0, -44(%rbp)
+	cmpw $0, -10(%rbp)
+	je .L59
+	cmpb $0, -25(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L60
+.L59:
+	movl $0, %eax
+.L60:
+	movl %eax, -204(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L61
+	movl $16, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -216(%rbp)
+	cmpq $0, -216(%rbp)
+	je .L62
+	.p2align 4,,10
+.L63:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L65
+	movabsq $985302404623, %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -204(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq $0, -8(%rbp)
+.L65:
+.L66:
+	addl $1, -44(%rbp)
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L67
+	movabsq $985302404623, %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -204(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq $0, -8(%rbp)
+.L67:
+.L68:
+	addl $1, -44(%rbp)
+	subq $1, -216(%rbp)
+	jne .L63
+.L64:
+.L61:
+.L62:
+	cmpl $16, -44(%rbp)
+	jge .L70
+	.p2align 4,,10
+.L69:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L71
+	movabsq $985302404623, %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -204(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq $0, -8(%rbp)
+.L71:
+.L72:
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L69
+.L70:
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -24(%rbp)
+	jl .L73
+	cmpq $33, -24(%rbp)
+	jge .L73
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L73:
+.L74:
+	cmpq $2, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	cmpq %rax, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f0.constprop.3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movq %rdi, -8(%rbp)
+	movw $504, -10(%rbp)
+	movq $151, -24(%rbp)
+	movb $61, -25(%rbp)
+	movq $363, -40(%rbp)
+	movl $-576000069, -44(%rbp)
+	movq $3, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jge .L75
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L76
+	.p2align 4,,10
+.L77:
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -200(%rbp)
+	jne .L77
+.L78:
+.L75:
+.L76:
+	cmpl $33, -44(%rbp)
+	jge .L80
+	.p2align 4,,10
+.L79:
+	movl -44(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L79
+.L80:
+	cmpq $0, g2(%rip)
+	jl .L81
+	cmpq $33, g2(%rip)
+	jge .L81
+	movq g1(%rip), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movq g2(%rip), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L81:
+.L82:
+	movl $0, -44(%rbp)
+	cmpw $0, -10(%rbp)
+	je .L83
+	cmpb $0, -25(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L84
+.L83:
+	movl $0, %eax
+.L84:
+	movl %eax, -204(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L85
+	movl $16, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -216(%rbp)
+	cmpq $0, -216(%rbp)
+	je .L86
+	.p2align 4,,10
+.L87:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L89
+	movabsq $985302404623, %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -204(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq $0, -8(%rbp)
+.L89:
+.L90:
+	addl $1, -44(%rbp)
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L91
+	movabsq $985302404623, %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -204(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq $0, -8(%rbp)
+.L91:
+.L92:
+	addl $1, -44(%rbp)
+	subq $1, -216(%rbp)
+	jne .L87
+.L88:
+.L85:
+.L86:
+	cmpl $16, -44(%rbp)
+	jge .L94
+	.p2align 4,,10
+.L93:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L95
+	movabsq $985302404623, %rax
+	cmpq %rax, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -204(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq $0, -8(%rbp)
+.L95:
+.L96:
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L93
+.L94:
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -24(%rbp)
+	jl .L97
+	cmpq $33, -24(%rbp)
+	jge .L97
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L97:
+.L98:
+	cmpq $2, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	cmpq %rax, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f0.constprop.3_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.3, .-f0.constprop.3
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movw %di, -2(%rbp)
+	movq %rsi, -16(%rbp)
+	movw $504, -18(%rbp)
+	movq $151, -32(%rbp)
+	movb $61, -33(%rbp)
+	movq $363, -48(%rbp)
+	movl $-576000069, -52(%rbp)
+	movq $3, -64(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jge .L99
+	movl $33, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -216(%rbp)
+	cmpq $0, -216(%rbp)
+	je .L100
+	.p2align 4,,10
+.L101:
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -216(%rbp)
+	jne .L101
+.L102:
+.L99:
+.L100:
+	cmpl $33, -52(%rbp)
+	jge .L104
+	.p2align 4,,10
+.L103:
+	movl -52(%rbp), %eax
+	imull $247, %eax, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jl .L103
+.L104:
+	cmpq $0, g2(%rip)
+	jl .L105
+	cmpq $33, g2(%rip)
+	jge .L105
+	movq g1(%rip), %rax
+	movzwl g0(%rip), %ecx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movq g2(%rip), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+.L105:
+.L106:
+	movl $0, -52(%rbp)
+	movabsq $78810582645, %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	cmpq $1, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -220(%rbp)
+	cmpw $0, -18(%rbp)
+	je .L107
+	cmpb $0, -33(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L108
+.L107:
+	movl $0, %eax
+.L108:
+	movl %eax, -224(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L109
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L110
+	.p2align 4,,10
+.L111:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L113
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -224(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -220(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq $0, -16(%rbp)
+.L113:
+.L114:
+	addl $1, -52(%rbp)
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L115
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -224(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -220(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq $0, -16(%rbp)
+.L115:
+.L116:
+	addl $1, -52(%rbp)
+	subq $1, -232(%rbp)
+	jne .L111
+.L112:
+.L109:
+.L110:
+	cmpl $16, -52(%rbp)
+	jge .L118
+	.p2align 4,,10
+.L117:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L119
+	movabsq $985302404623, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -224(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -220(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	xorl %eax, %eax
+	subq -64(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq $0, -16(%rbp)
+.L119:
+.L120:
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L117
+.L118:
+	movl -104(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -32(%rbp)
+	jl .L121
+	cmpq $33, -32(%rbp)
+	jge .L121
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+.L121:
+.L122:
+	cmpq $2, -64(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	cmpq %rax, g2(%rip)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movl %edi, -48(%rbp)
+	movq %rsi, -40(%rbp)
+	movb %cl, -52(%rbp)
+	movb %r9b, -51(%rbp)
+	movb $3, -50(%rbp)
+	movq $9, -32(%rbp)
+	movb $1, -49(%rbp)
+	movl $1679772225, -44(%rbp)
+	movq $7, -24(%rbp)
+	movl $0, 24(%rbp)
+	movq 16(%rbp), %rax
+	imulq 16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -16(%rbp)
+	movl $1, -8(%rbp)
+	cmpl $33, 24(%rbp)
+	jae .L124
+	.p2align 4,,10
+.L123:
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movsbl -49(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq g1(%rip), %rax
+	cqo
+	idivq %rcx
+	cmpq %rax, g2(%rip)
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	movl $5, %eax
+	xorl %edx, %edx
+	divq -16(%rbp)
+	movq %rax, %rcx
+	movzbl -52(%rbp), %eax
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	je .L125
+	cmpl $0, -8(%rbp)
+	je .L127
+.L124:
+	cmpq $0, -32(%rbp)
+	je .L129
+	movsbl -50(%rbp), %eax
+	cmpl $848, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	pushq %rax
+	movl -48(%rbp), %eax
+	imull -48(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl 24(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	popq %rcx
+	imull %ecx, %eax
+	movq %rax, 16(%rbp)
+.L130:
+	movsbq -50(%rbp), %rax
+	leave
+	ret
+.L127:
+.L128:
+.L125:
+.L126:
+	addl $1, 24(%rbp)
+	cmpl $33, 24(%rbp)
+	jb .L123
+	jmp .L124
+.L129:
+	movl $2, %eax
+	movq %rax, %rsi
+	movzwl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	testw %ax, %ax
+	je .L131
+	movsbq -49(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.2
+	movq %rax, %rcx
+	movzbl -51(%rbp), %eax
+	addq %rcx, %rax
+	movl $2, -48(%rbp)
+	movq -24(%rbp), %rax
+	addq $1, %rax
+	cmpq $10, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	cmpl $100, -48(%rbp)
+	jge .L133
+	movl $100, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L136
+	.p2align 4,,10
+.L135:
+	movl -16(%rbp), %eax
+	addl $1, -48(%rbp)
+	movl -16(%rbp), %eax
+	addl $1, -48(%rbp)
+	movl -16(%rbp), %eax
+	addl $1, -48(%rbp)
+	movl -16(%rbp), %eax
+	addl $1, -48(%rbp)
+	subq $1, -8(%rbp)
+	jne .L135
+.L136:
+.L133:
+.L134:
+	cmpl $100, -48(%rbp)
+	jge .L138
+	.p2align 4,,10
+.L137:
+	movl -16(%rbp), %eax
+	addl $1, -48(%rbp)
+	cmpl $100, -48(%rbp)
+	jl .L137
+.L138:
+.L131:
+.L132:
+	movq -40(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movq g2(%rip), %rax
+	movq %rax, %rdi
+	call f0.constprop.3
+	addq $8, %rsp
+	popq %rcx
+	imulq %rcx, %rax
+	jmp .L130
+	.size f1, .-f1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb $1, -48(%rbp)
+	movb $3, -47(%rbp)
+	movw $2, -46(%rbp)
+	movl $256, -44(%rbp)
+	movq $256, -40(%rbp)
+	cmpb $0, -47(%rbp)
+	jne .L141
+	cmpq $0, g2(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L142
+.L141:
+	movl $1, %eax
+.L142:
+	movslq %eax, %rax
+	pushq %rax
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $104, %eax
+	cqo
+	idivq %rcx
+	popq %rcx
+	addq %rcx, %rax
+	je .L139
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbq -47(%rbp), %rax
+	cqo
+	idivq %rcx
+	cmpq $2, %rax
+	jne .LB0
+.L143:
+.L144:
+	movq $1, -40(%rbp)
+	cmpq $5, -40(%rbp)
+	jge .L146
+	.p2align 4,,10
+.L145:
+	movq g1(%rip), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -8(%rbp)
+	jl .L150
+	cmpq $18, -8(%rbp)
+	jle .L148
+.L150:
+	movq -8(%rbp), %rax
+	addq $3, %rax
+.L147:
+	cmpq $82, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g2(%rip)
+	addq $1, -40(%rbp)
+	cmpq $5, -40(%rbp)
+	jl .L145
+.L146:
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	jmp .L140
+.L139:
+	movzwl g0(%rip), %eax
+	addl $9, %eax
+	movw %ax, g0(%rip)
+	movsbl -47(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	je .L159
+	movl $117, %eax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movl -44(%rbp), %eax
+	movq %rax, %r9
+	movslq -44(%rbp), %rax
+	movq %rax, %r8
+	movzwl g0(%rip), %eax
+	movq %rax, %rcx
+	movl $623, %eax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movq g1(%rip), %rax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -47(%rbp)
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq $-1, %rax
+	cqo
+	idivq %rcx
+	movw %ax, -46(%rbp)
+	movl $487, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $773, %eax
+	movq %rax, %rdi
+	call f0
+	pushq %rax
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	je .L161
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movzwl g0(%rip), %eax
+	movzbl %al, %eax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L166
+	cmpq $18, -16(%rbp)
+	jle .L164
+.L166:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L163:
+	movq %rax, g1(%rip)
+	movsbl -47(%rbp), %eax
+	subl $1, %eax
+	movslq %eax, %rax
+.L161:
+.L162:
+.L159:
+.L160:
+	movsbq -47(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq $2, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	addq $-1, %rax
+.L176:
+.L175:
+	movq %rax, -40(%rbp)
+.L140:
+	movw $277, g0(%rip)
+	cmpq $0, -40(%rbp)
+	je .L177
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $127, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $127, %eax
+	movw %ax, g0(%rip)
+.L179:
+	movl $1303, %eax
+	pushq %rax
+	cmpl $0, -44(%rbp)
+	je .L180
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L181
+.L148:
+.L149:
+	movq -8(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	addq $9, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -24(%rbp)
+	jl .L154
+	cmpq $18, -24(%rbp)
+	jle .L152
+.L154:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L151:
+	jmp .L147
+.L180:
+	movl $0, %eax
+.L181:
+	movq %rax, %rsi
+	movl -44(%rbp), %eax
+	addl $32767, %eax
+	movq %rax, %rdi
+	popq %rdx
+	call f0
+	movq %rax, g2(%rip)
+	cmpq $0, -40(%rbp)
+	je .L178
+	movzwl g0(%rip), %eax
+	movq %rax, g1(%rip)
+	movw $65143, g0(%rip)
+.L182:
+.L183:
+	jmp .L178
+.L177:
+	movw $0, -46(%rbp)
+	movswl -46(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $8, %eax
+	jge .L185
+	.p2align 4,,10
+.L184:
+	cmpl $0, -44(%rbp)
+	je .L186
+.L185:
+	cmpq $0, g2(%rip)
+	je .L194
+	cmpq $0, g2(%rip)
+	je .L196
+	movq g1(%rip), %rax
+	movw %ax, -8(%rbp)
+	movsbq -47(%rbp), %rax
+	movzwl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl %ecx, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl -8(%rbp), %eax
+	movw %ax, g0(%rip)
+.L198:
+	movsbq -47(%rbp), %rax
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $3, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $3, %eax
+	movw %ax, g0(%rip)
+.L199:
+	movq -40(%rbp), %rax
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $723, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $723, %eax
+	movw %ax, g0(%rip)
+.L200:
+	jmp .L197
+.L196:
+	movw $1, g0(%rip)
+.L197:
+	movzwl g0(%rip), %eax
+	addl $440, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	addl $440, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	addl $440, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	addl $440, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	addl $440, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	addl $440, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	addl $440, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	addl $440, %eax
+	movw %ax, g0(%rip)
+	movq $8, -40(%rbp)
+	movl -44(%rbp), %eax
+	movw %ax, g0(%rip)
+.L194:
+.L195:
+	movsbl -47(%rbp), %eax
+	movl %eax, -32(%rbp)
+	addl $122, %eax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	cmpq $8, g2(%rip)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $294924, %eax
+	pushq %rax
+	movl $225, %eax
+	pushq %rax
+	cmpl $6, -44(%rbp)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rsi
+	movl $225, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	testq %rax, %rax
+	je .L201
+	movq g2(%rip), %rax
+	cmpq $-2, %rax
+	je .L205
+	cmpq $5, %rax
+	je .L203
+	cmpq $672, %rax
+	je .L206
+.L205:
+.L203:
+	movl $184325, %eax
+	movq %rax, %rdx
+	movq g1(%rip), %rax
+	addq $687, %rax
+	movq %rax, %rsi
+	movzbl -48(%rbp), %eax
+	cmpl %eax, -32(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, g1(%rip)
+	movsbq -47(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq $6, %rax
+	movq %rax, -8(%rbp)
+	movq $0, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq $3, %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L225
+	cmpq $18, -16(%rbp)
+	jle .L223
+.L225:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L222:
+.L221:
+.L220:
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, g1(%rip)
+.L201:
+.L202:
+.L178:
+	movq $0, -40(%rbp)
+	movzbl -48(%rbp), %eax
+	cmpl $6, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -32(%rbp)
+	cmpq $3, -40(%rbp)
+	jge .L227
+	.p2align 4,,10
+.L226:
+	movw $0, -46(%rbp)
+	movl -32(%rbp), %eax
+	movl %eax, -24(%rbp)
+	movswl -46(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $4, %eax
+	jge .L229
+	.p2align 4,,10
+.L228:
+	movl $0, -44(%rbp)
+	movl -24(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L231
+	.p2align 4,,10
+.L230:
+	cmpl $0, -8(%rbp)
+	jne .L232
+.L231:
+	movl -16(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -46(%rbp)
+	movswl -46(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl $4, %eax
+	jl .L228
+.L229:
+	imulq $603, g2(%rip), %rax
+	cmpl $9, %eax
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	cmpl $8, -44(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+	addq $1, -40(%rbp)
+	cmpq $3, -40(%rbp)
+	jl .L226
+.L227:
+	movq $1, -40(%rbp)
+	imulq $93, -40(%rbp), %rax
+	subq $93, %rax
+	movq %rax, -32(%rbp)
+	cmpq $5, -40(%rbp)
+	jge .L239
+	.p2align 4,,10
+.L238:
+	addq $93, -32(%rbp)
+	movq g1(%rip), %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	cmpq $162, %rax
+	jge .L246
+	cmpq $47, %rax
+	je .L244
+	cmpq $76, %rax
+	je .L243
+.L242:
+	movb $0, -47(%rbp)
+	movabsq $680038164207, %rax
+	addq g1(%rip), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpb $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl $5, %eax
+	cmpl %ecx, %eax
+	setb %al
+	movzbl %al, %eax
+	movw %ax, -46(%rbp)
+	jmp .L240
+.L232:
+.L233:
+	cmpq $0, g2(%rip)
+	je .L234
+	jmp .L231
+.L234:
+.L235:
+	movswq -46(%rbp), %rax
+	cmpq g2(%rip), %rax
+	sete %al
+	movzbl %al, %eax
+	movzwl g0(%rip), %ecx
+	cmpl %ecx, %eax
+	jg .L236
+	jmp .L231
+.L236:
+.L237:
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L230
+	jmp .L231
+.L265:
+.L266:
+	movl $6, %eax
+	pushq %rax
+	movzbl -48(%rbp), %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $217, %eax
+	movq %rax, %rdx
+	movabsq $34093450003, %rax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movq %rax, %rcx
+	movswl -46(%rbp), %eax
+	cmpl $33, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+.L248:
+.L244:
+.L240:
+	movq g1(%rip), %rax
+	subq $302, %rax
+	pushq %rax
+	movsbl -47(%rbp), %eax
+	movzwl g0(%rip), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -44(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	movl $380089015, %eax
+	pushq %rax
+	movq g1(%rip), %rax
+	pushq %rax
+	movl $17, %eax
+	movq %rax, %r9
+	movslq -44(%rbp), %rax
+	movq %rax, %r8
+	movl -44(%rbp), %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $597, %eax
+	movq %rax, %rsi
+	movq g1(%rip), %rax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	pushq %rax
+	movq g1(%rip), %rax
+	imulq g1(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movswl -46(%rbp), %eax
+	subl $65535, %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	imulq %rcx, %rax
+	movb %al, -47(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $5, -40(%rbp)
+	jl .L238
+.L239:
+	movq $0, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jge .L270
+	.p2align 4,,10
+.L269:
+	movq g2(%rip), %rax
+	imulq g2(%rip), %rax
+	addq $1, %rax
+	pushq %rax
+	subq $8, %rsp
+	movq g1(%rip), %rax
+	movq %rax, %rdx
+	movl $892, %eax
+	movq %rax, %rsi
+	movswl -46(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	movabsq $-180620748546, %rcx
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g1(%rip)
+	movsbl -47(%rbp), %eax
+	movw %ax, -8(%rbp)
+	movsbq -47(%rbp), %rax
+	movzwl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl %ecx, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl -8(%rbp), %eax
+	movw %ax, g0(%rip)
+.L271:
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jl .L269
+.L270:
+	addq $1, -40(%rbp)
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzwl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq g2(%rip), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl -48(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq -47(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movswq -46(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -44(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L246:
+	cmpq $162, %rax
+	je .L245
+	cmpq $387, %rax
+	je .L241
+	jmp .L242
+.L245:
+	movzbl -48(%rbp), %eax
+	movb %al, -48(%rbp)
+	cmpq $0, -40(%rbp)
+	jne .L267
+	movl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L268
+.L267:
+	movl $1, %eax
+.L268:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzwl g0(%rip), %eax
+	addl %ecx, %eax
+	movw %ax, g0(%rip)
+	jmp .L240
+.L241:
+	movl $4294967295, %eax
+	cmpq %rax, -40(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl $3, %eax
+	movslq %eax, %rax
+	cmpq %rax, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+	movsbl -47(%rbp), %eax
+	addl $819, %eax
+	movb %al, -47(%rbp)
+	jmp .L240
+.L243:
+	movzwl g0(%rip), %eax
+	movzwl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq g1(%rip), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L247
+	movsbq -47(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movq g2(%rip), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L252
+	cmpq $18, -16(%rbp)
+	jle .L250
+.L252:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L249:
+	movq %rax, g1(%rip)
+	movl -44(%rbp), %eax
+	movzwl g0(%rip), %ecx
+	subl %ecx, %eax
+	jne .LB1
+.L261:
+.L262:
+	movzwl g0(%rip), %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movsbl -47(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testq %rax, %rax
+	je .L248
+	jmp .L240
+.L247:
+	movswq -46(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, %rcx
+	movsbq -47(%rbp), %rax
+	cmpq %rcx, %rax
+	je .L265
+	jmp .L240
+.L263:
+.L264:
+	jmp .L248
+.L186:
+	cmpb $0, -48(%rbp)
+	je .L188
+	jmp .L185
+.L250:
+.L251:
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -24(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -24(%rbp)
+	jl .L256
+	cmpq $18, -24(%rbp)
+	jle .L254
+.L256:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L253:
+	jmp .L249
+.L188:
+.L189:
+	cmpq $0, -40(%rbp)
+	jne .L192
+	cmpq $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L193
+.L192:
+	movl $1, %eax
+.L193:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L190
+	jmp .L185
+.L190:
+.L191:
+.L187:
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -46(%rbp)
+	movswl -46(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $8, %eax
+	jl .L184
+	jmp .L185
+.L204:
+	jmp .L203
+.L223:
+.L224:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L222
+.L254:
+.L255:
+	movq -24(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L260
+	cmpq $18, -16(%rbp)
+	jle .L258
+.L260:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L257:
+	jmp .L249
+.L206:
+	movq -40(%rbp), %rax
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $381, %eax
+	movw %ax, g0(%rip)
+	movzwl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $381, %eax
+	movw %ax, g0(%rip)
+.L207:
+	movq -40(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movq g1(%rip), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L211
+	cmpq $18, -16(%rbp)
+	jle .L209
+.L211:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L208:
+	cmpq $3, %rax
+	setg %al
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+	jmp .L203
+.L152:
+.L153:
+	movq -24(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L158
+	cmpq $18, -16(%rbp)
+	jle .L156
+.L158:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L155:
+	jmp .L147
+.L258:
+.L259:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L249
+.L209:
+.L210:
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -24(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -24(%rbp)
+	jl .L215
+	cmpq $18, -24(%rbp)
+	jle .L213
+.L215:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L212:
+	jmp .L208
+.L156:
+.L157:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L147
+.L164:
+.L165:
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -24(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -24(%rbp)
+	jl .L170
+	cmpq $18, -24(%rbp)
+	jle .L168
+.L170:
+	movq -8(%rbp), %rax
+	addq -24(%rbp), %rax
+.L167:
+	jmp .L163
+.L213:
+.L214:
+	movq -24(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L219
+	cmpq $18, -16(%rbp)
+	jle .L217
+.L219:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L216:
+	jmp .L208
+.L168:
+.L169:
+	movq -24(%rbp), %rax
+	subq $3, %rax
+	movq %rax, -16(%rbp)
+	imulq $3, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpq $2, -16(%rbp)
+	jl .L174
+	cmpq $18, -16(%rbp)
+	jle .L172
+.L174:
+	movq -8(%rbp), %rax
+	addq -16(%rbp), %rax
+.L171:
+	jmp .L163
+.L217:
+.L218:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L208
+.L172:
+.L173:
+	imulq $3, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	subq $3, %rax
+	movq %rax, %rdi
+	call rec
+	jmp .L163
+.LB1:
+	movq g1(%rip), %rax
+	jmp .main_return
+.LB0:
+	movl $9, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,151 @@
+unsigned int f0(int p0, long p1, unsigned int p2) {
+    unsigned char v0 = 593379286839;
+    char v1 = 647;
+    unsigned int v2 = 10;
+    unsigned long v3 = 233;
+    long v4 = 1000000007;
+    int i0 = 0;
+    long j0 = 0;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 440853437066; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 1; }
+    v2 = (((j0 + 0L) + (9 == 256)) / (p2 * p2 + 1));
+    if (32767) { return (9u != 1); }
+    switch (8l) {
+    case 135:
+        for (p1 = 1; p1 < 8; p1 = p1 + 1) {
+            if ((!(747) * (int)(j0))) {
+                if ((v0 + (198 - 3))) { break; }
+                i0 = ((unsigned long)(j0) >= p2);
+            }
+            p0 = (592 == (short)((201 == la0[12])));
+        }
+        break;
+    case 671:
+        break;
+    case 46:
+        for (i0 = 0; i0 < 16; i0 = i0 + 1) {
+            if (((v4 || (p0 || 10)) * -((v3 > v2)))) {
+                if ((0 && (634097090197 >= 5))) { break; }
+                if ((8 - (v4 < la0[13]))) { break; }
+                if (((p0 - 8) - (281456880548 != 413))) { return v3; }
+            }
+            if (((676489384915 < p2) / 13ul)) {
+                v0 = 5;
+                if (-(v4)) { break; }
+            }
+            if (((3 > v0) / 13ul)) {
+                p1 = ((unsigned int)(9) + ((j0 == 9) * (long)(la1[19])));
+                la1[i0] = (6 || (v1 <= 487));
+            } else {
+                if (la0[i0] < v4) { v4 = la0[i0]; }
+            }
+        }
+        break;
+    case 2:
+        if ((86 > (la0[2] / 8))) {
+            p0 = (p0 + v2);
+            if (v2 >= 0 && v2 < 33) { la1[v2] = ((j0 + 572850610881) >= (la0[14] - 1)); }
+        } else {
+            j0 = ((long)(v4) / 16);
+            v3 = (!((la0[13] < v2)) == ((v3 - 3) * 242141055683));
+        }
+        if (v4) {
+            i0 = (((char)(8u) + 7l) * ((4465212983 <= 995) == (unsigned long)(i0)));
+            if (v3) {
+                if (v2) { return p1; }
+            }
+        }
+        break;
+    case 261:
+        la1[31] = la1[24];
+    case 8:
+        v4 = (-((v3 > 255)) / 4);
+        v4 = 0;
+        while (v4 < 8) {
+            j0 = !(((v4 > 5) + (v2 + 1000000007)));
+            v3 = (v1 / (i0 * i0 + 1));
+            v4 = v4 + 1;
+        }
+    }
+    p0 = -(p0);
+    return p2;
+}
+unsigned short f1(char p0, short p1, unsigned char p2, unsigned long p3) {
+    long v0 = 9;
+    int v1 = 9;
+    char v2 = 111;
+    unsigned char v3 = 8;
+    short v4 = 634;
+    int i0 = 177963299657;
+    long j0 = 4;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 5u; }
+    p0 = !(((la0[3] / (v2 * v2 + 1)) / 100));
+    p0 = (-(f0(65535U, v2, 853)) >= (la0[1] + (v2 <= 951243699136)));
+    v3 = v3 + 6;
+    v2 = (!(f0(p3, 10, v0)) + j0);
+    i0 = 0;
+    while (i0 < 33) {
+        v3 = f0(8, v3, v4);
+        v1 = 1;
+        i0 = i0 + 1;
+    }
+    return (unsigned long)(-(!(p2)));
+}
+int rec(int n, int acc) {
+    if (n < 2 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 3, acc);
+}
+int main() {
+    int v0 = 2;
+    char v1 = 2;
+    int i0 = 887;
+    long j0 = 663;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 919; }
+    v0 = ((821 - -(i0)) / 3);
+    v1 = v1 + ((short)(i0) / (v1 * v1 + 1));
+    if ((((j0 && j0) / 7) / 3)) {
+        j0 = 2;
+        la0[11] = ((j0 / 16) != j0);
+        if (v0) {
+            v0 = v0 + f1(657544191627l, 2147483647l, v0, i0);
+            i0 = 9;
+            if (944) {
+                la0[8] = ((la0[14] / 1) + 285);
+                f0(la0[16], -(i0), 2);
+            } else {
+                i0 = 127;
+            }
+        } else {
+            j0 = ((497 || v0) > !((i0 <= j0)));
+            switch (1) {
+            case 0:
+                break;
+            case 8:
+                f0((la0[8] < 5), j0, 709406064405);
+            case 9:
+                f0(la0[4], i0, (2147483647 / 7));
+                break;
+            case 10:
+                v0 = (((220809650872 / 13ul) / (j0 * j0 + 1)) / (v0 * v0 + 1));
+                la0[6] = (j0 / 2);
+                break;
+            case 2:
+                v0 = 312468735853;
+                f1((j0 > 120), (v1 * v0), j0, (9 + 529));
+            }
+        }
+    }
+    i0 = (long)((-(v1) * (i0 && v1)));
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
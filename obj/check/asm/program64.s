@@ -0,0 +1,1317 @@
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.global main
+	.type main, @function
+	.type f1, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $400, %rsp
+	movl %edi, -4(%rbp)
+	movq %rsi, -16(%rbp)
+	movl %edx, -20(%rbp)
+	movb $55, -21(%rbp)
+	movb $-121, -22(%rbp)
+	movl $10, -28(%rbp)
+	movq $233, -40(%rbp)
+	movq $1000000007, -48(%rbp)
+	movl $0, -52(%rbp)
+	movq $0, -64(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movslq -52(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	movq %rax, -160(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -160(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -168(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -136(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -52(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -52(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -176(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L4
+.L5:
+	movl $0, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jge .L6
+	movl $33, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -328(%rbp)
+	cmpq $0, -328(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movl -52(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -320(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -320(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -320(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -320(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -328(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $33, -52(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movl -52(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -320(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $33, -52(%rbp)
+	jl .L10
+.L11:
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl $9, %eax
+	cmpl $256, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -64(%rbp), %rax
+	addq $0, %rax
+	addq %rcx, %rax
+	popq %rcx
+	cqo
+	idivq %rcx
+	movl %eax, -28(%rbp)
+	movl $32767, %eax
+	testl %eax, %eax
+	jne .LB0
+.L12:
+.L13:
+	movl $8, %eax
+	cmpq $135, %rax
+	jge .L21
+	cmpq $2, %rax
+	je .L18
+	cmpq $8, %rax
+	je .L20
+	cmpq $46, %rax
+	je .L17
+	jmp .L14
+.L21:
+	cmpq $135, %rax
+	je .L15
+	cmpq $261, %rax
+	je .L19
+	cmpq $671, %rax
+	je .L14
+	jmp .L14
+.L15:
+	movq $1, -16(%rbp)
+	movl $198, %eax
+	subl $3, %eax
+	movq %rax, %rcx
+	movzbl -21(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -332(%rbp)
+	movq -64(%rbp), %rax
+	movl -20(%rbp), %ecx
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movl %eax, -336(%rbp)
+	cmpq $8, -16(%rbp)
+	jge .L23
+	.p2align 4,,10
+.L22:
+	movq -64(%rbp), %rax
+	movq %rax, %rcx
+	movl $747, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	testl %eax, %eax
+	je .L24
+	cmpl $0, -332(%rbp)
+	je .L26
+.L23:
+.L69:
+.L14:
+	xorl %eax, %eax
+	subl -4(%rbp), %eax
+	movl %eax, -4(%rbp)
+	movl -20(%rbp), %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L26:
+.L27:
+	movl -336(%rbp), %eax
+	movl %eax, -52(%rbp)
+.L24:
+.L25:
+	movl -80(%rbp), %eax
+	cmpl $201, %eax
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	cmpl $592, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $8, -16(%rbp)
+	jl .L22
+	jmp .L23
+.L18:
+	movl -120(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	cmpl $86, %eax
+	jge .L54
+	movl -4(%rbp), %eax
+	addl -28(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -28(%rbp)
+	jb .L55
+	cmpl $33, -28(%rbp)
+	jae .L55
+	movl -72(%rbp), %eax
+	subl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $572850610881, %rax
+	addq -64(%rbp), %rax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	movl %ecx, -320(%rbp,%rax,4)
+.L56:
+.L57:
+	jmp .L55
+.L54:
+	movq -48(%rbp), %rax
+	leaq 15(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $4, %rcx
+	movq %rcx, %rax
+	movq %rax, -64(%rbp)
+	movq -40(%rbp), %rax
+	subq $3, %rax
+	movabsq $242141055683, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movl -76(%rbp), %eax
+	cmpl -28(%rbp), %eax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L55:
+	cmpq $0, -48(%rbp)
+	je .L14
+	movabsq $4465212983, %rax
+	cmpq $995, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movslq -52(%rbp), %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	addq $7, %rax
+	imulq %rcx, %rax
+	movl %eax, -52(%rbp)
+	cmpq $0, -40(%rbp)
+	je .L14
+	cmpl $0, -28(%rbp)
+	jne .LB1
+.L62:
+.L63:
+.L60:
+.L61:
+.L58:
+.L59:
+	jmp .L14
+.L19:
+	movl -224(%rbp), %eax
+	movl %eax, -196(%rbp)
+.L20:
+	xorl %eax, %eax
+	cmpq $255, -40(%rbp)
+	seta %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movq $0, -48(%rbp)
+	movl -28(%rbp), %eax
+	addl $1000000007, %eax
+	movl %eax, -380(%rbp)
+	movl -52(%rbp), %eax
+	imull -52(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -384(%rbp)
+	cmpq $8, -48(%rbp)
+	jge .L64
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -392(%rbp)
+	cmpq $0, -392(%rbp)
+	je .L67
+	.p2align 4,,10
+.L66:
+	cmpq $5, -48(%rbp)
+	setg %al
+	movzbl %al, %eax
+	addl -380(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	movsbl -22(%rbp), %eax
+	cltd
+	idivl -384(%rbp)
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $5, -48(%rbp)
+	setg %al
+	movzbl %al, %eax
+	addl -380(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -40(%rbp)
+	addq $1, -48(%rbp)
+	subq $1, -392(%rbp)
+	jne .L66
+.L67:
+.L64:
+.L65:
+	cmpq $8, -48(%rbp)
+	jge .L69
+	.p2align 4,,10
+.L68:
+	cmpq $5, -48(%rbp)
+	setg %al
+	movzbl %al, %eax
+	addl -380(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	movsbl -22(%rbp), %eax
+	cltd
+	idivl -384(%rbp)
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	addq $1, -48(%rbp)
+	cmpq $8, -48(%rbp)
+	jl .L68
+	jmp .L69
+.L16:
+	jmp .L14
+.L17:
+	movl $0, -52(%rbp)
+	cmpl $0, -4(%rbp)
+	jne .L28
+	movl $10, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L29
+.L28:
+	movl $1, %eax
+.L29:
+	movl %eax, -340(%rbp)
+	movl -28(%rbp), %eax
+	cmpq %rax, -40(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -344(%rbp)
+	xorl %eax, %eax
+	je .L30
+	movabsq $634097090197, %rax
+	cmpq $5, %rax
+	setge %al
+	movzbl %al, %eax
+	jmp .L31
+.L30:
+	movl $0, %eax
+.L31:
+	movl %eax, -348(%rbp)
+	movabsq $281456880548, %rax
+	cmpq $413, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	subl $8, %eax
+	subl %ecx, %eax
+	movl %eax, -352(%rbp)
+	movabsq $676489384915, %rax
+	movl -20(%rbp), %ecx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, -360(%rbp)
+	cmpq $9, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -364(%rbp)
+	movl $6, %eax
+	testl %eax, %eax
+	jne .L32
+	movsbl -22(%rbp), %eax
+	cmpl $487, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .L33
+.L32:
+	movl $1, %eax
+.L33:
+	movl %eax, -368(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L14
+	.p2align 4,,10
+.L34:
+	cmpq $0, -48(%rbp)
+	jne .L38
+	cmpl $0, -340(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L39
+.L38:
+	movl $1, %eax
+.L39:
+	imull -344(%rbp), %eax
+	testl %eax, %eax
+	je .L36
+	cmpl $0, -348(%rbp)
+	je .L40
+.L35:
+	jmp .L14
+.L42:
+.L43:
+	cmpl $0, -352(%rbp)
+	jne .LB2
+.L44:
+.L45:
+.L36:
+.L37:
+	cmpq $0, -360(%rbp)
+	je .L46
+	movb $5, -21(%rbp)
+	xorl %eax, %eax
+	subq -48(%rbp), %rax
+	je .L48
+	jmp .L14
+.L48:
+.L49:
+.L46:
+.L47:
+	movzbl -21(%rbp), %eax
+	cmpl $3, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L50
+	movl -244(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq -364(%rbp), %rax
+	imulq %rcx, %rax
+	addq $9, %rax
+	movq %rax, -16(%rbp)
+	movslq -52(%rbp), %rax
+	movl -368(%rbp), %ecx
+	movl %ecx, -320(%rbp,%rax,4)
+.L52:
+.L53:
+.L51:
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L34
+	jmp .L14
+.L40:
+.L41:
+	movl -76(%rbp), %eax
+	movslq %eax, %rax
+	cmpq %rax, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	subl %ecx, %eax
+	je .L42
+	jmp .L14
+.L50:
+	movslq -52(%rbp), %rax
+	movq %rax, -376(%rbp)
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq -48(%rbp), %rax
+	jge .L52
+	movq -376(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	jmp .L53
+.LB0:
+	movl $9, %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB1:
+	movq -16(%rbp), %rax
+	jmp .f0_return
+.LB2:
+	movq -40(%rbp), %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $320, %rsp
+	movq %rdi, -8(%rbp)
+	movb $55, -9(%rbp)
+	movb $-121, -10(%rbp)
+	movl $10, -16(%rbp)
+	movq $233, -24(%rbp)
+	movq $1000000007, -32(%rbp)
+	movl $0, -36(%rbp)
+	movq $0, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L70
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -120(%rbp)
+	cmpq $0, -120(%rbp)
+	je .L71
+	.p2align 4,,10
+.L72:
+	movslq -36(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -136(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -144(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -120(%rbp)
+	jne .L72
+.L73:
+.L70:
+.L71:
+	cmpl $16, -36(%rbp)
+	jge .L75
+	.p2align 4,,10
+.L74:
+	movslq -36(%rbp), %rax
+	movq %rax, -160(%rbp)
+	movabsq $440853437066, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -160(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L74
+.L75:
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L76
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -312(%rbp)
+	cmpq $0, -312(%rbp)
+	je .L77
+	.p2align 4,,10
+.L78:
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -304(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -304(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -304(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -304(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -312(%rbp)
+	jne .L78
+.L79:
+.L76:
+.L77:
+	cmpl $33, -36(%rbp)
+	jge .L81
+	.p2align 4,,10
+.L80:
+	movslq -36(%rbp), %rax
+	movl -36(%rbp), %ecx
+	movl %ecx, -304(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L80
+.L81:
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $1661502480194924719, %rdx
+	imulq %rdx
+	sarq $16, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movl %eax, -16(%rbp)
+	movl $1, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movl $2, -4(%rbp)
+	movb $2, -5(%rbp)
+	movl $887, -12(%rbp)
+	movq $663, -24(%rbp)
+	movl $0, -12(%rbp)
+	imull $919, -12(%rbp), %eax
+	subl $919, %eax
+	movl %eax, -164(%rbp)
+	cmpl $33, -12(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -168(%rbp)
+	testl %eax, %eax
+	je .L82
+	movl $33, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L85
+	.p2align 4,,10
+.L84:
+	addl $919, -164(%rbp)
+	movslq -12(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	addl $919, -164(%rbp)
+	movslq -12(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	addl $919, -164(%rbp)
+	movslq -12(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	addl $919, -164(%rbp)
+	movslq -12(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	subq $1, -176(%rbp)
+	jne .L84
+.L85:
+.L82:
+.L83:
+	cmpl $33, -12(%rbp)
+	jge .L87
+	.p2align 4,,10
+.L86:
+	addl $919, -164(%rbp)
+	movslq -12(%rbp), %rax
+	movl -164(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jl .L86
+.L87:
+	xorl %eax, %eax
+	subl -12(%rbp), %eax
+	movq %rax, %rcx
+	movl $821, %eax
+	subl %ecx, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl %eax, -4(%rbp)
+	movsbl -5(%rbp), %eax
+	movl %eax, -180(%rbp)
+	imull -180(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	movswl %ax, %eax
+	cltd
+	idivl %ecx
+	addl -180(%rbp), %eax
+	movb %al, -5(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L90
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L91
+.L90:
+	movl $0, %eax
+.L91:
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L88
+	movq $2, -24(%rbp)
+	movq -24(%rbp), %rax
+	leaq 15(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $4, %rcx
+	movq %rcx, %rax
+	cmpq -24(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -116(%rbp)
+	cmpl $0, -4(%rbp)
+	je .L92
+	movslq -12(%rbp), %rax
+	movq %rax, %rcx
+	movl -4(%rbp), %eax
+	movq %rax, %rdx
+	movl $-1, %eax
+	movq %rax, %rsi
+	movl $-117, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	addl %eax, -4(%rbp)
+	movl $9, -12(%rbp)
+	movl $944, %eax
+	testl %eax, %eax
+	je .L94
+	movl -104(%rbp), %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	addl $285, %eax
+	movl %eax, -128(%rbp)
+	movl $2, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	subl -12(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl -96(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L95
+.L94:
+	movl $127, -12(%rbp)
+.L95:
+.L98:
+.L93:
+.L88:
+.L89:
+	cmpl $0, -12(%rbp)
+	je .L106
+	cmpb $0, -5(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L106:
+	movl $0, %eax
+.L107:
+	pushq %rax
+	xorl %eax, %eax
+	movsbl -5(%rbp), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	imull %ecx, %eax
+	movslq %eax, %rax
+	movl %eax, -12(%rbp)
+	movq $0, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movslq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movsbq -5(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	movslq -12(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	imulq $31, -200(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $0, -168(%rbp)
+	je .L108
+	movl $33, %eax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L111
+	.p2align 4,,10
+.L110:
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -208(%rbp)
+	jne .L110
+.L111:
+.L108:
+.L109:
+	cmpl $33, -12(%rbp)
+	jge .L113
+	.p2align 4,,10
+.L112:
+	movslq -12(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -200(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $33, -12(%rbp)
+	jl .L112
+.L113:
+	movq -200(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -200(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -200(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -200(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -200(%rbp)
+	movq -200(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L92:
+	movslq -12(%rbp), %rax
+	movq %rax, -192(%rbp)
+	cmpq -24(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $497, %eax
+	testl %eax, %eax
+	jne .L96
+	cmpl $0, -4(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L97
+.L96:
+	movl $1, %eax
+.L97:
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L98
+	leaq .L105(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L98
+	# table target .L99
+	# table target .L103
+	# table target .L100
+	# table target .L101
+	# table target .L102
+	jmp *%rcx
+.L104:
+	jmp .L98
+.L99:
+	jmp .L98
+.L100:
+	movl $736460565, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl -128(%rbp), %eax
+	cmpl $5, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+.L101:
+	movl $2147483647, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rdx
+	movq -192(%rbp), %rax
+	movq %rax, %rsi
+	movl -144(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L98
+.L102:
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movabsq $220809650872, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -4(%rbp)
+	movq -24(%rbp), %rax
+	leaq 1(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $1, %rcx
+	movq %rcx, %rax
+	movl %eax, -136(%rbp)
+	jmp .L98
+.L103:
+	movl $-1063876755, -4(%rbp)
+	movl $9, %eax
+	addl $529, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movsbl -5(%rbp), %eax
+	imull -4(%rbp), %eax
+	movq %rax, %rsi
+	cmpq $120, -24(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f1
+	jmp .L98
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L105:
+	.long .L99-.L105
+	.long .L98-.L105
+	.long .L103-.L105
+	.long .L98-.L105
+	.long .L98-.L105
+	.long .L98-.L105
+	.long .L98-.L105
+	.long .L98-.L105
+	.long .L100-.L105
+	.long .L101-.L105
+	.long .L102-.L105
+	.popsection
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movb %dl, -49(%rbp)
+	movq %rcx, -40(%rbp)
+	movq $9, -32(%rbp)
+	movb $111, -48(%rbp)
+	movb $8, -47(%rbp)
+	movw $634, -46(%rbp)
+	movq $4, -24(%rbp)
+	movl $5, -16(%rbp)
+	movl $15, -44(%rbp)
+	movsbl -48(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movsbq -48(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movabsq $951243699136, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	addl %ecx, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $8, %rsp
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setae %al
+	movzbl %al, %eax
+	movzbl -47(%rbp), %eax
+	addl $6, %eax
+	movb %al, -47(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq -24(%rbp), %rax
+	movl $0, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jge .L114
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L115
+	.p2align 4,,10
+.L116:
+	movswl -46(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rdx
+	movzbl -47(%rbp), %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -47(%rbp)
+	addl $1, -44(%rbp)
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -47(%rbp), %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -47(%rbp)
+	addl $1, -44(%rbp)
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -47(%rbp), %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -47(%rbp)
+	addl $1, -44(%rbp)
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -47(%rbp), %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -47(%rbp)
+	addl $1, -44(%rbp)
+	subq $1, -16(%rbp)
+	jne .L116
+.L117:
+.L114:
+.L115:
+	cmpl $33, -44(%rbp)
+	jge .L119
+	.p2align 4,,10
+.L118:
+	movswl -46(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -47(%rbp), %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -47(%rbp)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L118
+.L119:
+	cmpb $0, -49(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	leave
+	ret
+	.size f1, .-f1
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
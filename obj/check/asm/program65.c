@@ -0,0 +1,23 @@
+short g0;
+int main() {
+    unsigned int v0 = 5;
+    unsigned int v1 = 128;
+    unsigned int v2 = 7;
+    int i0 = 5;
+    long j0 = 10;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 3L; }
+    j0 = la0[6];
+    v0 = (252 + (55 != v1));
+    j0 = (8 + ((la0[0] >= 325) > v1));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,247 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.zero 2
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movl $5, -4(%rbp)
+	movl $128, -8(%rbp)
+	movl $7, -12(%rbp)
+	movl $5, -16(%rbp)
+	movq $10, -24(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -68(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $8, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -80(%rbp)
+	cmpq $0, -80(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movslq -16(%rbp), %rax
+	movq %rax, -88(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -88(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movq %rax, -96(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -96(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movq %rax, -104(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -104(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movq %rax, -112(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -112(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	subq $1, -80(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $8, -16(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -16(%rbp), %rax
+	movq %rax, -120(%rbp)
+	imulq $3, %rax, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+	addl $1, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	jl .L4
+.L5:
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	cmpl $55, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	addl $252, %eax
+	movl %eax, -4(%rbp)
+	movl -64(%rbp), %eax
+	cmpl $325, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpl -8(%rbp), %eax
+	seta %al
+	movzbl %al, %eax
+	addl $8, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movq $0, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movswq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movl -4(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	imulq $31, -128(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -128(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $0, -68(%rbp)
+	je .L6
+	movl $8, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L7
+	.p2align 4,,10
+.L8:
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -136(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $8, -16(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -128(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	jl .L10
+.L11:
+	movq -128(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -128(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -128(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -128(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -128(%rbp)
+	movq -128(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
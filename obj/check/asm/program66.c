@@ -0,0 +1,91 @@
+long g0;
+short g1 = 5;
+unsigned char f0(int p0, short p1, int p2, char p3, unsigned char p4) {
+    unsigned long v0 = 1;
+    long v1 = 5;
+    int i0 = 4;
+    long j0 = 4;
+    if (((502 + 7) <= (p4 / (p3 * p3 + 1)))) { return v1; }
+    v1 = (3 != !(g0));
+    if (i0) { return p0; }
+    return -((v1 >= v0));
+}
+void w0(long q0, long q1, unsigned short q2) {
+    g0 = g0 * 3 + q2;
+    g1 = g1 * 3 + q0;
+}
+unsigned int rec(unsigned int n, unsigned int acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 3, acc * 3 + n);
+}
+int main() {
+    char v0 = 10;
+    int v1 = 2;
+    short v2 = 0;
+    int i0 = 10;
+    long j0 = 900;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 65536; }
+    if (j0 >= 0 && j0 < 8) { la0[j0] = la0[3]; }
+    f0(!(6), la0[2], (v1 && 0), -(g0), (la0[7] - 10));
+    j0 = 0;
+    while (j0 < 8) {
+        v0 = v0 + (v1 / 3u);
+        for (v2 = 2; v2 < 100; v2 = v2 + 1) {
+            v1 = g1;
+            i0 = 0;
+            while (i0 < 17) {
+                w0(v0, 8, la0[5]);
+                i0 = i0 + 1;
+            }
+            la0[j0] = v0;
+        }
+        switch ((8 < (2U && g1))) {
+        case 584:
+        default:
+        }
+        j0 = j0 + 1;
+    }
+    for (v2 = 1; v2 < 8; v2 = v2 + 1) {
+        g0 = (((unsigned int)(g0) >= rec(4, 3)) / 5l);
+        g0 = (-((732 && 175)) / 10);
+        if (v0) {
+            g1 = -((rec(v1, g1) <= (9 + 5)));
+            if (((g1 / (v1 * v1 + 1)) != v0)) { break; }
+            if ((5 == v0)) { return ((i0 == v2) && i0); }
+        } else {
+            g0 = g0 + ((v0 != v1) != (char)(j0));
+            v1 = 0;
+            while (v1 < 3) {
+                if (-(v0)) { break; }
+                if ((char)(v2)) { break; }
+                v1 = v1 + 1;
+            }
+        }
+    }
+    g0 = g0 + ((la0[6] - v1) >= 448);
+    g1 = ((rec(v2, 10) / (g0 * g0 + 1)) != f0(868, la0[7], 10, v0, g0));
+    if (8) {
+        switch ((la0[0] || (0 / 4))) {
+        default:
+            g1 = f0((g1 || 8), (9 == 240), -(9), (g0 / (i0 * i0 + 1)), la0[3]);
+            v0 = -(rec(j0, v2));
+            break;
+        case 32:
+            break;
+        }
+    } else {
+        v1 = (unsigned char)(v1);
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,861 @@
+	.section .data
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.short 5
+	.section .bss
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.zero 8
+	.section .text
+	.type rec, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $5, -8(%rbp)
+	jb .L2
+	cmpl $18, -8(%rbp)
+	ja .L2
+.L0:
+.L1:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L2:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movb %cl, -25(%rbp)
+	movq $1, -16(%rbp)
+	movq $5, -8(%rbp)
+	movl $4, -24(%rbp)
+	movsbl %dl, %eax
+	movl %eax, -20(%rbp)
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl -25(%rbp), %eax
+	cltd
+	idivl %ecx
+	cmpl $509, %eax
+	jl .L3
+	movq -8(%rbp), %rax
+.f0.constprop.0_return:
+	leave
+	ret
+.L3:
+.L4:
+	cmpq $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %rcx
+	cmpl $0, -24(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movq $1, -16(%rbp)
+	movq $5, -8(%rbp)
+	movl $4, -24(%rbp)
+	movsbl %sil, %eax
+	movl %eax, -20(%rbp)
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl %dl, %eax
+	cltd
+	idivl %ecx
+	cmpl $509, %eax
+	jl .L5
+	movq -8(%rbp), %rax
+.f0.constprop.1_return:
+	leave
+	ret
+.L5:
+.L6:
+	cmpq $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	pushq %rax
+	movl $100, %eax
+	movq %rax, %rcx
+	cmpl $0, -24(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq $1, -16(%rbp)
+	movq $5, -8(%rbp)
+	movl $4, -24(%rbp)
+	movsbl %sil, %eax
+	movl %eax, -20(%rbp)
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzbl %dl, %eax
+	cltd
+	idivl %ecx
+	cmpl $509, %eax
+	jge .LB0
+.L7:
+.L8:
+	cmpq $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	cmpl $0, -24(%rbp)
+	je .L9
+	movl %edi, %eax
+.f0.constprop.2_return:
+	popq %rbp
+	ret
+.L9:
+.L10:
+	movq -8(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .f0.constprop.2_return
+.LB0:
+	movq -8(%rbp), %rax
+	jmp .f0.constprop.2_return
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movb $10, -1(%rbp)
+	movl $2, -8(%rbp)
+	movw $0, -10(%rbp)
+	movl $10, -16(%rbp)
+	movq $900, -24(%rbp)
+	movl $0, -16(%rbp)
+	movl $0, -64(%rbp)
+	movl $65536, -60(%rbp)
+	movl $131072, -56(%rbp)
+	movl $196608, -52(%rbp)
+	movl $262144, -48(%rbp)
+	movl $327680, -44(%rbp)
+	movl $393216, -40(%rbp)
+	movl $458752, -36(%rbp)
+	movl $8, -16(%rbp)
+	cmpq $0, -24(%rbp)
+	jl .L11
+	cmpq $8, -24(%rbp)
+	jge .L11
+	movq -24(%rbp), %rax
+	movl -52(%rbp), %ecx
+	movl %ecx, -64(%rbp,%rax,4)
+.L11:
+.L12:
+	movl -36(%rbp), %eax
+	subl $10, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subq g0(%rip), %rax
+	pushq %rax
+	cmpl $0, -8(%rbp)
+	je .L13
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L14
+.L13:
+	movl $0, %eax
+.L14:
+	movq %rax, %rsi
+	movl -56(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	call f0.constprop.0
+	movq $0, -24(%rbp)
+	cmpq $8, -24(%rbp)
+	jge .L16
+	.p2align 4,,10
+.L15:
+	movl -8(%rbp), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movsbl -1(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -1(%rbp)
+	movw $2, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -68(%rbp)
+	cmpl $100, %eax
+	jge .L18
+	.p2align 4,,10
+.L17:
+	movswl g1(%rip), %eax
+	movl %eax, -8(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $17, -16(%rbp)
+	jge .L19
+	movl $17, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -80(%rbp)
+	cmpq $0, -80(%rbp)
+	je .L22
+	.p2align 4,,10
+.L21:
+	movsbq -1(%rbp), %rax
+	movq %rax, -88(%rbp)
+	movl -44(%rbp), %eax
+	movw %ax, -90(%rbp)
+	imulq $3, g0(%rip), %rax
+	movzwl -90(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, g0(%rip)
+	movswl g1(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq -88(%rbp), %rax
+	movw %ax, g1(%rip)
+.L23:
+	addl $1, -16(%rbp)
+	movsbq -1(%rbp), %rax
+	movq %rax, -88(%rbp)
+	movl -44(%rbp), %eax
+	movw %ax, -90(%rbp)
+	imulq $3, g0(%rip), %rax
+	movzwl -90(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, g0(%rip)
+	movswl g1(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq -88(%rbp), %rax
+	movw %ax, g1(%rip)
+.L24:
+	addl $1, -16(%rbp)
+	subq $1, -80(%rbp)
+	jne .L21
+.L22:
+.L19:
+.L20:
+	cmpl $17, -16(%rbp)
+	jge .L26
+	.p2align 4,,10
+.L25:
+	movsbq -1(%rbp), %rax
+	movq %rax, -88(%rbp)
+	movl -44(%rbp), %eax
+	movw %ax, -90(%rbp)
+	imulq $3, g0(%rip), %rax
+	movzwl -90(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, g0(%rip)
+	movswl g1(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq -88(%rbp), %rax
+	movw %ax, g1(%rip)
+.L27:
+	addl $1, -16(%rbp)
+	cmpl $17, -16(%rbp)
+	jl .L25
+.L26:
+	movq -24(%rbp), %rax
+	movsbl -1(%rbp), %ecx
+	movl %ecx, -64(%rbp,%rax,4)
+	movl -68(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -68(%rbp)
+	cmpl $100, %eax
+	jl .L17
+.L18:
+	cmpw $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	cmpl $8, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $584, %rax
+.L29:
+.L28:
+	addq $1, -24(%rbp)
+	cmpq $8, -24(%rbp)
+	jl .L15
+.L16:
+	movw $1, -10(%rbp)
+	movsbl -1(%rbp), %eax
+	movl %eax, -100(%rbp)
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -96(%rbp)
+	xorl %eax, %eax
+	subl -100(%rbp), %eax
+	movl %eax, -104(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jge .L31
+	.p2align 4,,10
+.L30:
+	movq g0(%rip), %rax
+	cmpl $7, %eax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, g0(%rip)
+	movq $0, g0(%rip)
+	cmpb $0, -1(%rbp)
+	je .L32
+	movl -8(%rbp), %eax
+	movl %eax, -112(%rbp)
+	movswl g1(%rip), %eax
+	movl %eax, -116(%rbp)
+	cmpl $5, -112(%rbp)
+	jb .L37
+	cmpl $18, -112(%rbp)
+	jbe .L35
+.L37:
+	movl -116(%rbp), %eax
+	addl -112(%rbp), %eax
+.L34:
+	cmpl $14, %eax
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, g1(%rip)
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movswl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	cmpl -100(%rbp), %eax
+	je .L46
+	jmp .L31
+.L32:
+	movq -24(%rbp), %rax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	cmpl -8(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, g0(%rip)
+	movl $0, -8(%rbp)
+	movl -104(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpl $3, -8(%rbp)
+	jge .L53
+	.p2align 4,,10
+.L52:
+	cmpl $0, -136(%rbp)
+	je .L54
+.L53:
+.L33:
+	movl -108(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -10(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $8, %eax
+	jl .L30
+.L31:
+	movl -40(%rbp), %eax
+	subl -8(%rbp), %eax
+	cmpl $448, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, g0(%rip)
+	movq g0(%rip), %rax
+	movq %rax, %rdx
+	movsbl -1(%rbp), %eax
+	movq %rax, %rsi
+	movl -36(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movzbl %al, %eax
+	pushq %rax
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	pushq %rax
+	movswl -10(%rbp), %eax
+	movl %eax, -140(%rbp)
+	cmpl $5, -140(%rbp)
+	jb .L61
+	cmpl $18, -140(%rbp)
+	jbe .L59
+.L61:
+	movl -140(%rbp), %eax
+	addl $10, %eax
+.L58:
+	movl %eax, %eax
+	popq %rcx
+	cqo
+	idivq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, g1(%rip)
+	movl -64(%rbp), %eax
+	testl %eax, %eax
+	jne .L73
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L74
+.L54:
+.L55:
+	movswl -10(%rbp), %eax
+	testb %al, %al
+	je .L56
+	jmp .L53
+.L56:
+.L57:
+	addl $1, -8(%rbp)
+	cmpl $3, -8(%rbp)
+	jl .L52
+	jmp .L53
+.L73:
+	movl $1, %eax
+.L74:
+	movslq %eax, %rax
+	cmpq $32, %rax
+	je .L70
+.L71:
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq g0(%rip), %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	cmpw $0, g1(%rip)
+	jne .L75
+	movl $8, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L76
+.L75:
+	movl $1, %eax
+.L76:
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	call f0.constprop.2
+	movzbl %al, %eax
+	movw %ax, g1(%rip)
+	movq -24(%rbp), %rax
+	movl %eax, -160(%rbp)
+	movswl -10(%rbp), %eax
+	movl %eax, -164(%rbp)
+	cmpl $5, -160(%rbp)
+	jb .L80
+	cmpl $18, -160(%rbp)
+	jbe .L78
+.L80:
+	movl -164(%rbp), %eax
+	addl -160(%rbp), %eax
+.L77:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -1(%rbp)
+.L70:
+	movq $0, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movswq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movsbq -1(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movslq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movswq -10(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movl $0, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	jge .L89
+	movl $8, %eax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L92
+	.p2align 4,,10
+.L91:
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -16(%rbp)
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -200(%rbp)
+	jne .L91
+.L92:
+.L89:
+.L90:
+	cmpl $8, -16(%rbp)
+	jge .L94
+	.p2align 4,,10
+.L93:
+	movslq -16(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $8, -16(%rbp)
+	jl .L93
+.L94:
+	movq -192(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -192(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -192(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movq -192(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L72:
+	jmp .L70
+.L46:
+.L47:
+	cmpl $0, -96(%rbp)
+	je .L33
+	movl -16(%rbp), %eax
+	cmpl -108(%rbp), %eax
+	jne .L50
+	cmpl $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .main_return
+.L59:
+.L60:
+	movl -140(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -144(%rbp)
+	movl -140(%rbp), %eax
+	addl $30, %eax
+	movl %eax, -148(%rbp)
+	cmpl $5, -144(%rbp)
+	jb .L65
+	cmpl $18, -144(%rbp)
+	jbe .L63
+.L65:
+	movl -148(%rbp), %eax
+	addl -144(%rbp), %eax
+.L62:
+	jmp .L58
+.L35:
+.L36:
+	movl -112(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -120(%rbp)
+	imull $3, -116(%rbp), %eax
+	addl -112(%rbp), %eax
+	movl %eax, -124(%rbp)
+	cmpl $5, -120(%rbp)
+	jb .L41
+	cmpl $18, -120(%rbp)
+	jbe .L39
+.L41:
+	movl -124(%rbp), %eax
+	addl -120(%rbp), %eax
+.L38:
+	jmp .L34
+.L48:
+.L49:
+	jmp .L33
+.L78:
+.L79:
+	movl -160(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -168(%rbp)
+	imull $3, -164(%rbp), %eax
+	addl -160(%rbp), %eax
+	movl %eax, -172(%rbp)
+	cmpl $5, -168(%rbp)
+	jb .L84
+	cmpl $18, -168(%rbp)
+	jbe .L82
+.L84:
+	movl -172(%rbp), %eax
+	addl -168(%rbp), %eax
+.L81:
+	jmp .L77
+.L63:
+.L64:
+	movl -144(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -152(%rbp)
+	imull $3, -148(%rbp), %eax
+	addl -144(%rbp), %eax
+	movl %eax, -156(%rbp)
+	cmpl $5, -152(%rbp)
+	jb .L69
+	cmpl $18, -152(%rbp)
+	jbe .L67
+.L69:
+	movl -156(%rbp), %eax
+	addl -152(%rbp), %eax
+.L66:
+	jmp .L58
+.L39:
+.L40:
+	movl -120(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -128(%rbp)
+	imull $3, -124(%rbp), %eax
+	addl -120(%rbp), %eax
+	movl %eax, -132(%rbp)
+	cmpl $5, -128(%rbp)
+	jb .L45
+	cmpl $18, -128(%rbp)
+	jbe .L43
+.L45:
+	movl -132(%rbp), %eax
+	addl -128(%rbp), %eax
+.L42:
+	jmp .L34
+.L82:
+.L83:
+	movl -168(%rbp), %eax
+	subl $3, %eax
+	movl %eax, -176(%rbp)
+	imull $3, -172(%rbp), %eax
+	addl -168(%rbp), %eax
+	movl %eax, -180(%rbp)
+	cmpl $5, -176(%rbp)
+	jb .L88
+	cmpl $18, -176(%rbp)
+	jbe .L86
+.L88:
+	movl -180(%rbp), %eax
+	addl -176(%rbp), %eax
+.L85:
+	jmp .L77
+.L67:
+.L68:
+	imull $3, -156(%rbp), %eax
+	addl -152(%rbp), %eax
+	movq %rax, %rsi
+	movl -152(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L58
+.L43:
+.L44:
+	imull $3, -132(%rbp), %eax
+	addl -128(%rbp), %eax
+	movq %rax, %rsi
+	movl -128(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L34
+.L86:
+.L87:
+	imull $3, -180(%rbp), %eax
+	addl -176(%rbp), %eax
+	movq %rax, %rsi
+	movl -176(%rbp), %eax
+	subl $3, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L77
+.L50:
+	movl $0, %eax
+.L51:
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,148 @@
+unsigned char g0;
+unsigned long g1 = 981188863533;
+long g2 = 9;
+int ga0[4];
+int ga1[16];
+unsigned char f0(unsigned char p0, short p1) {
+    int v0 = 4;
+    long v1 = 7;
+    short v2 = 0;
+    unsigned short v3 = 1;
+    short v4 = 5;
+    int i0 = 7;
+    long j0 = 9;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 1087199293298; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 575; }
+    v0 = (g0 < (354ul < 0));
+    if ((i0 + (121 >= v0))) { return (5 >= (unsigned short)(v2)); }
+    switch (!(-(la0[17]))) {
+    default:
+        break;
+    case 5:
+        break;
+    }
+    if (220u) { return (v1 + v2); }
+    return (int)(v0);
+}
+unsigned int rec(unsigned int n, unsigned int acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 1, acc * 3 + n);
+}
+int main() {
+    long v0 = 1000000007;
+    unsigned int v1 = 3;
+    char v2 = 972917590641;
+    int i0 = 64ul;
+    long j0 = 32767;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 478L; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 6; }
+    v1 = v1 + v0;
+    v2 = -(((3 / (v0 * v0 + 1)) && 418));
+    g2 = v0;
+    j0 = (f0(g0, la0[3]) > !(!(la0[3])));
+    if (v0) {
+        if (g2) {
+            g1 = (700061147674U - la1[3]);
+            i0 = (f0(i0, 593) / 3u);
+            if (rec(rec(v0, ga1[2]), (v0 && g2))) {
+                rec(!(v0), (6 + 256));
+                g1 = -((unsigned int)(5));
+            } else {
+                i0 = !(((la1[1] / (i0 * i0 + 1)) && (7 > g2)));
+                if (v1) { return (unsigned short)(j0); }
+            }
+        }
+        if (f0((1 && la0[0]), (241 != 709))) {
+            i0 = 0;
+            while (i0 < 4) {
+                v0 = -(la0[1]);
+                i0 = i0 + 1;
+            }
+            switch (g2) {
+            case 1:
+                i0 = (short)(!(rec(6, v1)));
+                v1 = 0u;
+            case 3:
+                break;
+            case 4:
+                rec((v0 + 65536), (g1 * 0));
+                rec(258939033274, (j0 + j0));
+                break;
+            case 2:
+                rec(ga1[10], -(4));
+            case 7:
+            }
+        } else {
+            j0 = j0 + ((long)(65) >= -(90));
+            f0(v2, (126 / (v1 * v1 + 1)));
+            for (j0 = 1; j0 < 3; j0 = j0 + 1) {
+                if (g2) { break; }
+                if ((unsigned char)(g0)) { break; }
+            }
+        }
+        switch ((!(9) * rec(la1[0], 5))) {
+        case 0:
+            j0 = 0;
+            while (j0 < 5) {
+                g0 = (((ga1[13] / 13ul) > (98L == 567437875096)) || -((v1 * g2)));
+                g0 = (((245 || 349) == (unsigned int)(3)) + !((v1 != g2)));
+                j0 = j0 + 1;
+            }
+            g0 = (8 < (v2 > 0));
+            break;
+        default:
+            switch ((v2 + f0(g1, g2))) {
+            case 1:
+                g1 = g1 + i0;
+                rec(5, f0(497ul, 1));
+                break;
+            default:
+                if (g2 >= 0 && g2 < 4) { la1[g2] = 1U; }
+                break;
+            case 8:
+                j0 = 10ul;
+                break;
+            case 7:
+                ga1[6] = (long)((2 > ga0[0]));
+                g1 = g1 + ((2 <= g2) / 3);
+                break;
+            case 2:
+                g2 = v2;
+                rec(f0(600, ga0[1]), (g1 - la0[3]));
+                break;
+            case 3:
+                rec(f0(i0, 1U), -(1));
+                rec((v1 - 237773219706), g2);
+                break;
+            }
+            v0 = v2;
+            break;
+        case 6:
+            break;
+        case 8:
+            if (v0 >= 0 && v0 < 4) { ga0[v0] = rec(g2, g0); }
+            break;
+        }
+    } else {
+        if (v1) { return (v2 * rec(la0[1], 0U)); }
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
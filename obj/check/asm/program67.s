@@ -0,0 +1,1998 @@
+	.section .data
+	.type g1, @object
+	.size g1, 8
+	.p2align 3
+g1:
+	.quad 981188863533
+	.type g2, @object
+	.size g2, 8
+	.p2align 3
+g2:
+	.quad 9
+	.section .bss
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.zero 1
+	.type ga0, @object
+	.size ga0, 16
+	.p2align 5
+ga0:
+	.zero 16
+	.type ga1, @object
+	.size ga1, 64
+	.p2align 5
+ga1:
+	.zero 64
+	.section .text
+	.type rec, @function
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $4, -8(%rbp)
+	jb .L2
+	cmpl $18, -8(%rbp)
+	ja .L2
+.L0:
+.L1:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L2:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movb %dil, -1(%rbp)
+	movw %si, -4(%rbp)
+	movl $4, -8(%rbp)
+	movq $7, -16(%rbp)
+	movw $0, -18(%rbp)
+	movw $1, -20(%rbp)
+	movw $5, -22(%rbp)
+	movl $7, -28(%rbp)
+	movq $9, -40(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jge .L3
+	movl $33, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L6
+	.p2align 4,,10
+.L5:
+	movslq -28(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -208(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -184(%rbp)
+	jne .L5
+.L6:
+.L3:
+.L4:
+	cmpl $33, -28(%rbp)
+	jge .L8
+	.p2align 4,,10
+.L7:
+	movslq -28(%rbp), %rax
+	movq %rax, -224(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -224(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jl .L7
+.L8:
+	movl $0, -28(%rbp)
+	movl $0, -256(%rbp)
+	movl $575, -252(%rbp)
+	movl $1150, -248(%rbp)
+	movl $1725, -244(%rbp)
+	movl $2300, -240(%rbp)
+	movl $2875, -236(%rbp)
+	movl $3450, -232(%rbp)
+	movl $4025, -228(%rbp)
+	movl $8, -28(%rbp)
+	movzbl g0(%rip), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpl $121, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl -28(%rbp), %eax
+	jne .LB0
+.L9:
+.L10:
+	xorl %eax, %eax
+	movl -108(%rbp), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+.L12:
+.L11:
+	movswq -18(%rbp), %rax
+	addq -16(%rbp), %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L13:
+	jmp .L11
+.LB0:
+	movswl -18(%rbp), %eax
+	movzwl %ax, %eax
+	cmpl $5, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movb %dil, -1(%rbp)
+	movl $4, -8(%rbp)
+	movq $7, -16(%rbp)
+	movw $0, -18(%rbp)
+	movw $1, -20(%rbp)
+	movw $5, -22(%rbp)
+	movl $7, -28(%rbp)
+	movq $9, -40(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jge .L14
+	movl $33, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L17
+	.p2align 4,,10
+.L16:
+	movslq -28(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -208(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -184(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $33, -28(%rbp)
+	jge .L19
+	.p2align 4,,10
+.L18:
+	movslq -28(%rbp), %rax
+	movq %rax, -224(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -224(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jl .L18
+.L19:
+	movl $0, -28(%rbp)
+	movl $0, -256(%rbp)
+	movl $575, -252(%rbp)
+	movl $1150, -248(%rbp)
+	movl $1725, -244(%rbp)
+	movl $2300, -240(%rbp)
+	movl $2875, -236(%rbp)
+	movl $3450, -232(%rbp)
+	movl $4025, -228(%rbp)
+	movl $8, -28(%rbp)
+	movzbl g0(%rip), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpl $121, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl -28(%rbp), %eax
+	jne .LB1
+.L20:
+.L21:
+	xorl %eax, %eax
+	movl -108(%rbp), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+.L23:
+.L22:
+	movswq -18(%rbp), %rax
+	addq -16(%rbp), %rax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L24:
+	jmp .L22
+.LB1:
+	movswl -18(%rbp), %eax
+	movzwl %ax, %eax
+	cmpl $5, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movb %dil, -1(%rbp)
+	movl $4, -8(%rbp)
+	movq $7, -16(%rbp)
+	movw $0, -18(%rbp)
+	movw $1, -20(%rbp)
+	movw $5, -22(%rbp)
+	movl $7, -28(%rbp)
+	movq $9, -40(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jge .L25
+	movl $33, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L28
+	.p2align 4,,10
+.L27:
+	movslq -28(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -208(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -184(%rbp)
+	jne .L27
+.L28:
+.L25:
+.L26:
+	cmpl $33, -28(%rbp)
+	jge .L30
+	.p2align 4,,10
+.L29:
+	movslq -28(%rbp), %rax
+	movq %rax, -224(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -224(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jl .L29
+.L30:
+	movl $0, -28(%rbp)
+	movl $0, -256(%rbp)
+	movl $575, -252(%rbp)
+	movl $1150, -248(%rbp)
+	movl $1725, -244(%rbp)
+	movl $2300, -240(%rbp)
+	movl $2875, -236(%rbp)
+	movl $3450, -232(%rbp)
+	movl $4025, -228(%rbp)
+	movl $8, -28(%rbp)
+	movzbl g0(%rip), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpl $121, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl -28(%rbp), %eax
+	jne .LB2
+.L31:
+.L32:
+	xorl %eax, %eax
+	movl -108(%rbp), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+.L34:
+.L33:
+	movswq -18(%rbp), %rax
+	addq -16(%rbp), %rax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L35:
+	jmp .L33
+.LB2:
+	movswl -18(%rbp), %eax
+	movzwl %ax, %eax
+	cmpl $5, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movl $4, -4(%rbp)
+	movq $7, -16(%rbp)
+	movw $0, -18(%rbp)
+	movw $1, -20(%rbp)
+	movw $5, -22(%rbp)
+	movl $7, -28(%rbp)
+	movq $9, -40(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jge .L36
+	movl $33, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L39
+	.p2align 4,,10
+.L38:
+	movslq -28(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -208(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -184(%rbp)
+	jne .L38
+.L39:
+.L36:
+.L37:
+	cmpl $33, -28(%rbp)
+	jge .L41
+	.p2align 4,,10
+.L40:
+	movslq -28(%rbp), %rax
+	movq %rax, -224(%rbp)
+	movabsq $1087199293298, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -224(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $33, -28(%rbp)
+	jl .L40
+.L41:
+	movl $0, -28(%rbp)
+	movl $0, -256(%rbp)
+	movl $575, -252(%rbp)
+	movl $1150, -248(%rbp)
+	movl $1725, -244(%rbp)
+	movl $2300, -240(%rbp)
+	movl $2875, -236(%rbp)
+	movl $3450, -232(%rbp)
+	movl $4025, -228(%rbp)
+	movl $8, -28(%rbp)
+	movzbl g0(%rip), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	cmpl $121, -4(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl -28(%rbp), %eax
+	jne .LB3
+.L42:
+.L43:
+	xorl %eax, %eax
+	movl -108(%rbp), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+.L45:
+.L44:
+	movswq -18(%rbp), %rax
+	addq -16(%rbp), %rax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L46:
+	jmp .L44
+.LB3:
+	movswl -18(%rbp), %eax
+	movzwl %ax, %eax
+	cmpl $5, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .f0.constprop.2_return
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $432, %rsp
+	movq $1000000007, -8(%rbp)
+	movl $3, -12(%rbp)
+	movb $113, -13(%rbp)
+	movl $64, -20(%rbp)
+	movq $32767, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -48(%rbp)
+	movl $478, -44(%rbp)
+	movl $956, -40(%rbp)
+	movl $1434, -36(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -64(%rbp)
+	movl $6, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $18, -52(%rbp)
+	movl $4, -20(%rbp)
+	movl -12(%rbp), %eax
+	addq -8(%rbp), %rax
+	movl %eax, -12(%rbp)
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L47
+	movl $418, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L48
+.L47:
+	movl $0, %eax
+.L48:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -13(%rbp)
+	movq -8(%rbp), %rax
+	movq %rax, g2(%rip)
+	movl -36(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	movq %rax, %rsi
+	movzbl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L49
+	cmpq $0, g2(%rip)
+	je .L51
+	movl -52(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $700061147674, %rax
+	subq %rcx, %rax
+	movq %rax, g1(%rip)
+	movl -20(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movzbl %al, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movl %eax, -20(%rbp)
+	movq -8(%rbp), %rax
+	movl %eax, -72(%rbp)
+	movl ga1+8(%rip), %eax
+	movl %eax, -76(%rbp)
+	cmpl $4, -72(%rbp)
+	jb .L59
+	cmpl $18, -72(%rbp)
+	jbe .L57
+.L59:
+	movl -76(%rbp), %eax
+	addl -72(%rbp), %eax
+.L56:
+	movl %eax, -68(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L76
+	cmpq $0, g2(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L77
+.L76:
+	movl $0, %eax
+.L77:
+	movl %eax, -112(%rbp)
+	cmpl $4, -68(%rbp)
+	jb .L80
+	cmpl $18, -68(%rbp)
+	jbe .L78
+.L80:
+	movl -112(%rbp), %eax
+	addl -68(%rbp), %eax
+.L55:
+	testl %eax, %eax
+	je .L53
+	cmpq $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	cmpl $4, -132(%rbp)
+	jb .L92
+	cmpl $18, -132(%rbp)
+	jbe .L90
+.L92:
+	movl -132(%rbp), %eax
+	addl $262, %eax
+.L89:
+	movl $4294967291, %eax
+	movq %rax, g1(%rip)
+.L103:
+.L104:
+.L54:
+.L51:
+.L52:
+	movl -48(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	testb %al, %al
+	je .L105
+	movl $0, -20(%rbp)
+	xorl %eax, %eax
+	movl -44(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	xorl %eax, %eax
+	movl -44(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	xorl %eax, %eax
+	movl -44(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	xorl %eax, %eax
+	movl -44(%rbp), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movl $4, -20(%rbp)
+	movq g2(%rip), %rax
+	leaq -1(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L106
+	leaq .L114(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L107
+	# table target .L108
+	# table target .L111
+	# table target .L109
+	# table target .L110
+	# table target .L112
+	jmp *%rcx
+.L105:
+	addq $1, -32(%rbp)
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $126, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rsi
+	movsbl -13(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movq $1, -32(%rbp)
+	cmpq $3, -32(%rbp)
+	jge .L147
+	.p2align 4,,10
+.L146:
+	cmpq $0, g2(%rip)
+	je .L148
+.L147:
+.L106:
+	movl -64(%rbp), %eax
+	movl %eax, -220(%rbp)
+	cmpl $4, -220(%rbp)
+	jb .L160
+	cmpl $18, -220(%rbp)
+	jbe .L158
+.L160:
+	movl -220(%rbp), %eax
+	addl $5, %eax
+.L157:
+	imull $0, %eax, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L153
+	cmpq $6, %rax
+	je .L152
+	cmpq $8, %rax
+	je .L156
+.L154:
+	movq g2(%rip), %rax
+	movq %rax, %rsi
+	movq g1(%rip), %rax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -13(%rbp), %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $7, %rcx
+	ja .L188
+	leaq .L189(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L183
+	# table target .L182
+	# table target .L186
+	# table target .L187
+	# table target .L185
+	# table target .L184
+	jmp *%rcx
+.L148:
+.L149:
+	cmpb $0, g0(%rip)
+	je .L150
+	jmp .L147
+.L153:
+	movq $0, -32(%rbp)
+	movl $0, -240(%rbp)
+	movl $0, -244(%rbp)
+	cmpq $5, -32(%rbp)
+	jge .L169
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $5, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L172
+	.p2align 4,,10
+.L171:
+	movslq -240(%rbp), %rax
+	movq %rax, -264(%rbp)
+	pushq %rax
+	movl ga1+52(%rip), %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	ja .L173
+	movl -12(%rbp), %eax
+	imulq g2(%rip), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L174
+.L173:
+	movl $1, %eax
+.L174:
+	movb %al, g0(%rip)
+	movl -12(%rbp), %eax
+	movq %rax, -272(%rbp)
+	cmpq g2(%rip), %rax
+	sete %al
+	movzbl %al, %eax
+	addl -244(%rbp), %eax
+	movb %al, g0(%rip)
+	addq $1, -32(%rbp)
+	movl ga1+52(%rip), %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	cmpq -264(%rbp), %rax
+	ja .L175
+	movq -272(%rbp), %rax
+	imulq g2(%rip), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L176
+.L175:
+	movl $1, %eax
+.L176:
+	movb %al, g0(%rip)
+	movq -272(%rbp), %rax
+	cmpq g2(%rip), %rax
+	sete %al
+	movzbl %al, %eax
+	addl -244(%rbp), %eax
+	movb %al, g0(%rip)
+	addq $1, -32(%rbp)
+	subq $1, -256(%rbp)
+	jne .L171
+.L172:
+.L169:
+.L170:
+	cmpq $5, -32(%rbp)
+	jge .L178
+	.p2align 4,,10
+.L177:
+	movl ga1+52(%rip), %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movslq -240(%rbp), %rcx
+	cmpq %rcx, %rax
+	ja .L179
+	movl -12(%rbp), %eax
+	imulq g2(%rip), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L180
+.L179:
+	movl $1, %eax
+.L180:
+	movb %al, g0(%rip)
+	movl -12(%rbp), %eax
+	cmpq g2(%rip), %rax
+	sete %al
+	movzbl %al, %eax
+	addl -244(%rbp), %eax
+	movb %al, g0(%rip)
+	addq $1, -32(%rbp)
+	cmpq $5, -32(%rbp)
+	jl .L177
+.L178:
+	movsbl -13(%rbp), %eax
+	testl %eax, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl $8, %eax
+	setg %al
+	movzbl %al, %eax
+	movb %al, g0(%rip)
+.L152:
+.L251:
+.L252:
+.L50:
+	movq $0, -416(%rbp)
+	imulq $31, -416(%rbp), %rax
+	movzbl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	imulq $31, -416(%rbp), %rax
+	addq g1(%rip), %rax
+	movq %rax, -416(%rbp)
+	imulq $31, -416(%rbp), %rax
+	addq g2(%rip), %rax
+	movq %rax, -416(%rbp)
+	imulq $31, -416(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -416(%rbp)
+	imulq $31, -416(%rbp), %rax
+	movl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	imulq $31, -416(%rbp), %rax
+	movsbq -13(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	imulq $31, -416(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	imulq $31, -416(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -416(%rbp)
+	movl $0, -20(%rbp)
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jge .L265
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -424(%rbp)
+	cmpq $0, -424(%rbp)
+	je .L268
+	.p2align 4,,10
+.L267:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -424(%rbp)
+	jne .L267
+.L268:
+.L265:
+.L266:
+	cmpl $16, -20(%rbp)
+	jge .L270
+	.p2align 4,,10
+.L269:
+	movslq -20(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L269
+.L270:
+	movl $0, -20(%rbp)
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl -40(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl $4, -20(%rbp)
+	movl $0, -20(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl -52(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -416(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movl $4, -20(%rbp)
+	movq -416(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -416(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -416(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -416(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -416(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -416(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -416(%rbp)
+	movq -416(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L150:
+.L151:
+	addq $1, -32(%rbp)
+	cmpq $3, -32(%rbp)
+	jl .L146
+	jmp .L147
+.L158:
+.L159:
+	movl -220(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -224(%rbp)
+	movl -220(%rbp), %eax
+	addl $15, %eax
+	movl %eax, -228(%rbp)
+	cmpl $4, -224(%rbp)
+	jb .L164
+	cmpl $18, -224(%rbp)
+	jbe .L162
+.L164:
+	movl -228(%rbp), %eax
+	addl -224(%rbp), %eax
+.L161:
+	jmp .L157
+.L155:
+	jmp .L152
+.L156:
+	cmpq $0, -8(%rbp)
+	jl .L152
+	cmpq $4, -8(%rbp)
+	jge .L152
+	movq g2(%rip), %rax
+	movl %eax, -368(%rbp)
+	movzbl g0(%rip), %eax
+	movl %eax, -372(%rbp)
+	cmpl $4, -368(%rbp)
+	jb .L242
+	cmpl $18, -368(%rbp)
+	jbe .L240
+.L242:
+	movl -372(%rbp), %eax
+	addl -368(%rbp), %eax
+.L239:
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L237:
+.L238:
+	jmp .L152
+.L53:
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L101
+	cmpq $7, g2(%rip)
+	setge %al
+	movzbl %al, %eax
+	jmp .L102
+.L113:
+.L134:
+.L112:
+.L107:
+	jmp .L106
+.L162:
+.L163:
+	movl -224(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -232(%rbp)
+	imull $3, -228(%rbp), %eax
+	addl -224(%rbp), %eax
+	movl %eax, -236(%rbp)
+	cmpl $4, -232(%rbp)
+	jb .L168
+	cmpl $18, -232(%rbp)
+	jbe .L166
+.L168:
+	movl -236(%rbp), %eax
+	addl -232(%rbp), %eax
+.L165:
+	jmp .L157
+.L188:
+.L183:
+	cmpq $0, g2(%rip)
+	jl .L199
+	cmpq $4, g2(%rip)
+	jge .L199
+	movq g2(%rip), %rax
+	movl $1, -64(%rbp,%rax,4)
+.L199:
+.L200:
+.L181:
+	movsbq -13(%rbp), %rax
+	movq %rax, -8(%rbp)
+	jmp .L152
+.L57:
+.L58:
+	movl -72(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -80(%rbp)
+	imull $3, -76(%rbp), %eax
+	addl -72(%rbp), %eax
+	movl %eax, -84(%rbp)
+	cmpl $4, -80(%rbp)
+	jb .L63
+	cmpl $18, -80(%rbp)
+	jbe .L61
+.L63:
+	movl -84(%rbp), %eax
+	addl -80(%rbp), %eax
+.L60:
+	jmp .L56
+.L78:
+.L79:
+	movl -68(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -116(%rbp)
+	imull $3, -112(%rbp), %eax
+	addl -68(%rbp), %eax
+	movl %eax, -120(%rbp)
+	cmpl $4, -116(%rbp)
+	jb .L84
+	cmpl $18, -116(%rbp)
+	jbe .L82
+.L84:
+	movl -120(%rbp), %eax
+	addl -116(%rbp), %eax
+.L81:
+	jmp .L55
+.L90:
+.L91:
+	movl -132(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -136(%rbp)
+	movl -132(%rbp), %eax
+	addl $786, %eax
+	movl %eax, -140(%rbp)
+	cmpl $4, -136(%rbp)
+	jb .L96
+	cmpl $18, -136(%rbp)
+	jbe .L94
+.L96:
+	movl -140(%rbp), %eax
+	addl -136(%rbp), %eax
+.L93:
+	jmp .L89
+.L166:
+.L167:
+	imull $3, -236(%rbp), %eax
+	addl -232(%rbp), %eax
+	movq %rax, %rsi
+	movl -232(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L157
+.L61:
+.L62:
+	movl -80(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -88(%rbp)
+	imull $3, -84(%rbp), %eax
+	addl -80(%rbp), %eax
+	movl %eax, -92(%rbp)
+	cmpl $4, -88(%rbp)
+	jb .L67
+	cmpl $18, -88(%rbp)
+	jbe .L65
+.L67:
+	movl -92(%rbp), %eax
+	addl -88(%rbp), %eax
+.L64:
+	jmp .L56
+.L82:
+.L83:
+	movl -116(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -124(%rbp)
+	imull $3, -120(%rbp), %eax
+	addl -116(%rbp), %eax
+	movl %eax, -128(%rbp)
+	cmpl $4, -124(%rbp)
+	jb .L88
+	cmpl $18, -124(%rbp)
+	jbe .L86
+.L88:
+	movl -128(%rbp), %eax
+	addl -124(%rbp), %eax
+.L85:
+	jmp .L55
+.L240:
+.L241:
+	movl -368(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -376(%rbp)
+	imull $3, -372(%rbp), %eax
+	addl -368(%rbp), %eax
+	movl %eax, -380(%rbp)
+	cmpl $4, -376(%rbp)
+	jb .L246
+	cmpl $18, -376(%rbp)
+	jbe .L244
+.L246:
+	movl -380(%rbp), %eax
+	addl -376(%rbp), %eax
+.L243:
+	jmp .L239
+.L94:
+.L95:
+	movl -136(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -144(%rbp)
+	imull $3, -140(%rbp), %eax
+	addl -136(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl $4, -144(%rbp)
+	jb .L100
+	cmpl $18, -144(%rbp)
+	jbe .L98
+.L100:
+	movl -148(%rbp), %eax
+	addl -144(%rbp), %eax
+.L97:
+	jmp .L89
+.L65:
+.L66:
+	movl -88(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -96(%rbp)
+	imull $3, -92(%rbp), %eax
+	addl -88(%rbp), %eax
+	movl %eax, -100(%rbp)
+	cmpl $4, -96(%rbp)
+	jb .L71
+	cmpl $18, -96(%rbp)
+	jbe .L69
+.L71:
+	movl -100(%rbp), %eax
+	addl -96(%rbp), %eax
+.L68:
+	jmp .L56
+.L86:
+.L87:
+	imull $3, -128(%rbp), %eax
+	addl -124(%rbp), %eax
+	movq %rax, %rsi
+	movl -124(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L55
+.L244:
+.L245:
+	movl -376(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -384(%rbp)
+	imull $3, -380(%rbp), %eax
+	addl -376(%rbp), %eax
+	movl %eax, -388(%rbp)
+	cmpl $4, -384(%rbp)
+	jb .L250
+	cmpl $18, -384(%rbp)
+	jbe .L248
+.L250:
+	movl -388(%rbp), %eax
+	addl -384(%rbp), %eax
+.L247:
+	jmp .L239
+.L98:
+.L99:
+	imull $3, -148(%rbp), %eax
+	addl -144(%rbp), %eax
+	movq %rax, %rsi
+	movl -144(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L89
+.L69:
+.L70:
+	movl -96(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -104(%rbp)
+	imull $3, -100(%rbp), %eax
+	addl -96(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpl $4, -104(%rbp)
+	jb .L75
+	cmpl $18, -104(%rbp)
+	jbe .L73
+.L75:
+	movl -108(%rbp), %eax
+	addl -104(%rbp), %eax
+.L72:
+	jmp .L56
+.L248:
+.L249:
+	imull $3, -388(%rbp), %eax
+	addl -384(%rbp), %eax
+	movq %rax, %rsi
+	movl -384(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L239
+.L73:
+.L74:
+	imull $3, -108(%rbp), %eax
+	addl -104(%rbp), %eax
+	movq %rax, %rsi
+	movl -104(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L56
+.L108:
+	movl -12(%rbp), %eax
+	movl %eax, -152(%rbp)
+	imull $3, -152(%rbp), %eax
+	addl $6, %eax
+	movl %eax, -156(%rbp)
+	movl $4, -160(%rbp)
+	imull $3, -156(%rbp), %eax
+	addl $5, %eax
+	movl %eax, -164(%rbp)
+	cmpl $4, -160(%rbp)
+	jb .L120
+	cmpl $18, -160(%rbp)
+	jbe .L118
+.L120:
+	movl -164(%rbp), %eax
+	addl -160(%rbp), %eax
+.L117:
+.L116:
+.L115:
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movl %eax, -20(%rbp)
+	movl $0, -12(%rbp)
+.L109:
+	jmp .L106
+.L118:
+.L119:
+	imull $3, -164(%rbp), %eax
+	addl -160(%rbp), %eax
+	movq %rax, %rsi
+	movl -160(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L117
+.L110:
+	movq -8(%rbp), %rax
+	addq $65536, %rax
+	movl %eax, -168(%rbp)
+	movl $0, -172(%rbp)
+	cmpl $4, -168(%rbp)
+	jb .L124
+	cmpl $18, -168(%rbp)
+	jbe .L122
+.L124:
+	movl -172(%rbp), %eax
+	addl -168(%rbp), %eax
+.L121:
+	movq -32(%rbp), %rax
+	addq -32(%rbp), %rax
+	movl %eax, -192(%rbp)
+	movl -192(%rbp), %eax
+	addl $1240995514, %eax
+.L133:
+	jmp .L106
+.L122:
+.L123:
+	movl -168(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -176(%rbp)
+	imull $3, -172(%rbp), %eax
+	addl -168(%rbp), %eax
+	movl %eax, -180(%rbp)
+	cmpl $4, -176(%rbp)
+	jb .L128
+	cmpl $18, -176(%rbp)
+	jbe .L126
+.L128:
+	movl -180(%rbp), %eax
+	addl -176(%rbp), %eax
+.L125:
+	jmp .L121
+.L126:
+.L127:
+	movl -176(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -184(%rbp)
+	imull $3, -180(%rbp), %eax
+	addl -176(%rbp), %eax
+	movl %eax, -188(%rbp)
+	cmpl $4, -184(%rbp)
+	jb .L132
+	cmpl $18, -184(%rbp)
+	jbe .L130
+.L132:
+	movl -188(%rbp), %eax
+	addl -184(%rbp), %eax
+.L129:
+	jmp .L121
+.L130:
+.L131:
+	imull $3, -188(%rbp), %eax
+	addl -184(%rbp), %eax
+	movq %rax, %rsi
+	movl -184(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L121
+.L111:
+	movl ga1+40(%rip), %eax
+	movl %eax, -196(%rbp)
+	movl $4294967292, -200(%rbp)
+	cmpl $4, -196(%rbp)
+	jb .L137
+	cmpl $18, -196(%rbp)
+	jbe .L135
+.L137:
+	movl -200(%rbp), %eax
+	addl -196(%rbp), %eax
+	jmp .L106
+.L135:
+.L136:
+	movl -196(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -204(%rbp)
+	imull $3, -200(%rbp), %eax
+	addl -196(%rbp), %eax
+	movl %eax, -208(%rbp)
+	cmpl $4, -204(%rbp)
+	jb .L141
+	cmpl $18, -204(%rbp)
+	jbe .L139
+.L141:
+	movl -208(%rbp), %eax
+	addl -204(%rbp), %eax
+.L138:
+	jmp .L106
+.L139:
+.L140:
+	movl -204(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -212(%rbp)
+	imull $3, -208(%rbp), %eax
+	addl -204(%rbp), %eax
+	movl %eax, -216(%rbp)
+	cmpl $4, -212(%rbp)
+	jb .L145
+	cmpl $18, -212(%rbp)
+	jbe .L143
+.L145:
+	movl -216(%rbp), %eax
+	addl -212(%rbp), %eax
+.L142:
+	jmp .L106
+.L143:
+.L144:
+	imull $3, -216(%rbp), %eax
+	addl -212(%rbp), %eax
+	movq %rax, %rsi
+	movl -212(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L106
+.L182:
+	movslq -20(%rbp), %rax
+	addq %rax, g1(%rip)
+	call f0.constprop.2
+	movzbl %al, %eax
+	movl %eax, -276(%rbp)
+	movl $4, -280(%rbp)
+	imull $3, -276(%rbp), %eax
+	addl $5, %eax
+	movl %eax, -284(%rbp)
+	cmpl $4, -280(%rbp)
+	jb .L194
+	cmpl $18, -280(%rbp)
+	jbe .L192
+.L194:
+	movl -284(%rbp), %eax
+	addl -280(%rbp), %eax
+.L191:
+.L190:
+	jmp .L181
+.L192:
+.L193:
+	movl -280(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -288(%rbp)
+	imull $3, -284(%rbp), %eax
+	addl -280(%rbp), %eax
+	movl %eax, -292(%rbp)
+	cmpl $4, -288(%rbp)
+	jb .L198
+	cmpl $18, -288(%rbp)
+	jbe .L196
+.L198:
+	movl -292(%rbp), %eax
+	addl -288(%rbp), %eax
+.L195:
+	jmp .L181
+.L196:
+.L197:
+	imull $3, -292(%rbp), %eax
+	addl -288(%rbp), %eax
+	movq %rax, %rsi
+	movl -288(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L181
+.L184:
+	movq $10, -32(%rbp)
+	jmp .L181
+.L185:
+	movl ga0+0(%rip), %eax
+	cmpl $2, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl %eax, ga1+24(%rip)
+	cmpq $2, g2(%rip)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	addq %rax, g1(%rip)
+	jmp .L181
+.L186:
+	movsbq -13(%rbp), %rax
+	movq %rax, g2(%rip)
+	movl ga0+4(%rip), %eax
+	movq %rax, %rsi
+	movl $88, %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movl %eax, -296(%rbp)
+	movl -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq g1(%rip), %rax
+	subq %rcx, %rax
+	movl %eax, -300(%rbp)
+	cmpl $4, -296(%rbp)
+	jb .L204
+	cmpl $18, -296(%rbp)
+	jbe .L202
+.L204:
+	movl -300(%rbp), %eax
+	addl -296(%rbp), %eax
+.L201:
+	jmp .L181
+.L202:
+.L203:
+	movl -296(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -304(%rbp)
+	imull $3, -300(%rbp), %eax
+	addl -296(%rbp), %eax
+	movl %eax, -308(%rbp)
+	cmpl $4, -304(%rbp)
+	jb .L208
+	cmpl $18, -304(%rbp)
+	jbe .L206
+.L208:
+	movl -308(%rbp), %eax
+	addl -304(%rbp), %eax
+.L205:
+	jmp .L181
+.L206:
+.L207:
+	movl -304(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -312(%rbp)
+	imull $3, -308(%rbp), %eax
+	addl -304(%rbp), %eax
+	movl %eax, -316(%rbp)
+	cmpl $4, -312(%rbp)
+	jb .L212
+	cmpl $18, -312(%rbp)
+	jbe .L210
+.L212:
+	movl -316(%rbp), %eax
+	addl -312(%rbp), %eax
+.L209:
+	jmp .L181
+.L210:
+.L211:
+	imull $3, -316(%rbp), %eax
+	addl -312(%rbp), %eax
+	movq %rax, %rsi
+	movl -312(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L181
+.L187:
+	movl -20(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movzbl %al, %eax
+	movl %eax, -320(%rbp)
+	movl $4294967295, -324(%rbp)
+	cmpl $4, -320(%rbp)
+	jb .L216
+	cmpl $18, -320(%rbp)
+	jbe .L214
+.L216:
+	movl -324(%rbp), %eax
+	addl -320(%rbp), %eax
+.L213:
+	movl -12(%rbp), %eax
+	movabsq $237773219706, %rcx
+	subq %rcx, %rax
+	movl %eax, -344(%rbp)
+	movq g2(%rip), %rax
+	movl %eax, -348(%rbp)
+	cmpl $4, -344(%rbp)
+	jb .L228
+	cmpl $18, -344(%rbp)
+	jbe .L226
+.L228:
+	movl -348(%rbp), %eax
+	addl -344(%rbp), %eax
+.L225:
+	jmp .L181
+.L214:
+.L215:
+	movl -320(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -328(%rbp)
+	imull $3, -324(%rbp), %eax
+	addl -320(%rbp), %eax
+	movl %eax, -332(%rbp)
+	cmpl $4, -328(%rbp)
+	jb .L220
+	cmpl $18, -328(%rbp)
+	jbe .L218
+.L220:
+	movl -332(%rbp), %eax
+	addl -328(%rbp), %eax
+.L217:
+	jmp .L213
+.L226:
+.L227:
+	movl -344(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -352(%rbp)
+	imull $3, -348(%rbp), %eax
+	addl -344(%rbp), %eax
+	movl %eax, -356(%rbp)
+	cmpl $4, -352(%rbp)
+	jb .L232
+	cmpl $18, -352(%rbp)
+	jbe .L230
+.L232:
+	movl -356(%rbp), %eax
+	addl -352(%rbp), %eax
+.L229:
+	jmp .L181
+.L218:
+.L219:
+	movl -328(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -336(%rbp)
+	imull $3, -332(%rbp), %eax
+	addl -328(%rbp), %eax
+	movl %eax, -340(%rbp)
+	cmpl $4, -336(%rbp)
+	jb .L224
+	cmpl $18, -336(%rbp)
+	jbe .L222
+.L224:
+	movl -340(%rbp), %eax
+	addl -336(%rbp), %eax
+.L221:
+	jmp .L213
+.L230:
+.L231:
+	movl -352(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -360(%rbp)
+	imull $3, -356(%rbp), %eax
+	addl -352(%rbp), %eax
+	movl %eax, -364(%rbp)
+	cmpl $4, -360(%rbp)
+	jb .L236
+	cmpl $18, -360(%rbp)
+	jbe .L234
+.L236:
+	movl -364(%rbp), %eax
+	addl -360(%rbp), %eax
+.L233:
+	jmp .L181
+.L222:
+.L223:
+	imull $3, -340(%rbp), %eax
+	addl -336(%rbp), %eax
+	movq %rax, %rsi
+	movl -336(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L213
+.L234:
+.L235:
+	imull $3, -364(%rbp), %eax
+	addl -360(%rbp), %eax
+	movq %rax, %rsi
+	movl -360(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L181
+.L254:
+.L255:
+	movl -392(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -396(%rbp)
+	movl -392(%rbp), %eax
+	movl %eax, -400(%rbp)
+	cmpl $4, -396(%rbp)
+	jb .L260
+	cmpl $18, -396(%rbp)
+	jbe .L258
+.L260:
+	movl -400(%rbp), %eax
+	addl -396(%rbp), %eax
+.L257:
+	jmp .L253
+.L258:
+.L259:
+	movl -396(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -404(%rbp)
+	imull $3, -400(%rbp), %eax
+	addl -396(%rbp), %eax
+	movl %eax, -408(%rbp)
+	cmpl $4, -404(%rbp)
+	jb .L264
+	cmpl $18, -404(%rbp)
+	jbe .L262
+.L264:
+	movl -408(%rbp), %eax
+	addl -404(%rbp), %eax
+.L261:
+	jmp .L253
+.L262:
+.L263:
+	imull $3, -408(%rbp), %eax
+	addl -404(%rbp), %eax
+	movq %rax, %rsi
+	movl -404(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L253
+.L49:
+	cmpl $0, -12(%rbp)
+	je .L251
+	movl -44(%rbp), %eax
+	movl %eax, -392(%rbp)
+	cmpl $4, -392(%rbp)
+	jb .L256
+	cmpl $18, -392(%rbp)
+	jbe .L254
+.L256:
+	movl -392(%rbp), %eax
+.L253:
+	movq %rax, %rcx
+	movsbl -13(%rbp), %eax
+	imull %ecx, %eax
+	jmp .main_return
+.L101:
+	movl $1, %eax
+.L102:
+	movl %eax, -20(%rbp)
+	cmpl $0, -12(%rbp)
+	je .L103
+	movq -32(%rbp), %rax
+	movzwl %ax, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L114:
+	.long .L108-.L114
+	.long .L111-.L114
+	.long .L109-.L114
+	.long .L110-.L114
+	.long .L107-.L114
+	.long .L107-.L114
+	.long .L112-.L114
+	.p2align 2
+.L189:
+	.long .L182-.L189
+	.long .L186-.L189
+	.long .L187-.L189
+	.long .L183-.L189
+	.long .L183-.L189
+	.long .L183-.L189
+	.long .L185-.L189
+	.long .L184-.L189
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,300 @@
+int ga0[16];
+unsigned int f0(int p0, long p1, short p2, unsigned char p3, unsigned char p4, unsigned int p5) {
+    long v0 = 115;
+    char v1 = 714;
+    int i0 = 6;
+    long j0 = 356;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 1; }
+    switch (((10 - p5) / (p0 * p0 + 1))) {
+    case 2:
+        switch (((int)(p1) - !(1088189951970))) {
+        case 1:
+            switch ((long)(255)) {
+            default:
+                if (v0) { return !((v0 / (v0 * v0 + 1))); }
+                break;
+            case 15:
+                break;
+            }
+            break;
+        case -2:
+            if (i0) {
+                v1 = 190;
+            }
+            switch (p2) {
+            case 1:
+                p3 = (65536L / 2);
+                break;
+            case 4:
+                p4 = 609;
+                if (((p5 == 275094834999) / (p5 * p5 + 1))) { return (char)((unsigned char)(j0)); }
+            case 6:
+                if (((p5 < 156) || 2)) { return 4; }
+                if (195) { return ((char)(65535) <= (286 < p1)); }
+                break;
+            case 9:
+                p1 = ((v1 <= (int)(v1)) >= 92);
+                break;
+            case 8:
+            }
+            break;
+        case 236:
+            p4 = -(p2);
+            if ((4 >= ga0[9])) {
+                p1 = p1 + ((v1 - v1) || (379L || v1));
+            }
+        case 50:
+            v0 = (short)(930571586368);
+            break;
+        }
+        p3 = (p0 + (3 - p1));
+    }
+    p5 = (((ga0[2] >= i0) || (p5 || p0)) - (int)(10U));
+    j0 = 6;
+    p5 = ((unsigned short)(4) + p2);
+    if (p5 >= 0 && p5 < 8) { la0[p5] = p5; }
+    if (((v0 > v0) >= 2)) { return i0; }
+    for (j0 = 0; j0 < 4; j0 = j0 + 1) {
+        v1 = v0;
+    }
+    p2 = (((686 * v0) < p3) <= 359227980728);
+    return -(!(p3));
+}
+unsigned int f1(char p0, long p1, short p2, unsigned short p3) {
+    unsigned int v0 = 260100541362;
+    char v1 = 4;
+    unsigned int v2 = 255;
+    unsigned char v3 = 10;
+    unsigned char v4 = 4;
+    int v5 = 0;
+    int i0 = 8;
+    long j0 = 65536;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    if ((unsigned char)(v3)) {
+        v4 = (-(65536) / 3u);
+    } else {
+        v5 = ((la0[0] - (573 <= v4)) == 1);
+        if ((((ga0[6] != p3) - v3) / (i0 * i0 + 1))) {
+            switch (f0(274, 10, ga0[10], 6, v3, 4u)) {
+            default:
+            case 620:
+                j0 = f0(v0, 1, 5, v2, 3, 4294967295);
+                break;
+            }
+        } else {
+            v5 = ga0[11];
+        }
+        p1 = f0(p0, 0, v1, 833, j0, v1);
+    }
+    if (p1 >= 0 && p1 < 4) { la0[p1] = f0(la0[3], 237941903352, la0[0], v3, 8l, v1); }
+    v4 = v4 + f0(8, v3, 1, v5, p1, 525);
+    p1 = f0(430, (1 - 868), (char)(756), (516 / (i0 * i0 + 1)), (1 / (v0 * v0 + 1)), (unsigned short)(2));
+    p1 = (((unsigned char)(807) > (3 + p2)) / 16);
+    v1 = ((4 / (v0 * v0 + 1)) != ((unsigned char)(32767) < (la0[1] / 4)));
+    if (v3 >= 0 && v3 < 4) { la0[v3] = 2; }
+    f0((v0 + v3), (1 + 801), f0(988, 675234734065, 10, v0, 229, 1000000007), (v3 < p1), f0(9, 861, 9, 234, j0, 5), (p2 == i0));
+    return f0((323 != p1), i0, !(p0), (230 - v3), la0[2], (la0[2] == 10));
+}
+unsigned long f2(long p0, unsigned int p1, long p2, short p3, int p4, unsigned long p5, unsigned short p6) {
+    long v0 = 7;
+    unsigned short v1 = 22L;
+    short v2 = 0;
+    int v3 = 1;
+    unsigned char v4 = 32767;
+    unsigned long v5 = 785275248323;
+    int i0 = 0;
+    long j0 = 3;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 1; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 194; }
+    if (p6 >= 0 && p6 < 8) { la1[p6] = f0(249847971596, 10, 65535, v3, v2, 619L); }
+    if (p2) {
+        switch (!(1)) {
+        case 0:
+        case 2:
+            f1(p2, (127 / 7), v3, v5);
+            f0(p3, la0[3], f0(5, 617, p4, j0, p5, 635U), (unsigned int)(v4), p1, 2);
+            break;
+        case 6:
+            p5 = (((p3 && v4) + !(p1)) + !(f0(v0, p4, 5, 597481477070, 3, p1)));
+            break;
+        case 7:
+            p2 = 0;
+            while (p2 < 17) {
+                p3 = (unsigned long)((unsigned long)(i0));
+                p6 = ((p4 + i0) - 6);
+                if (f0(p1, 925837531770, p2, p1, la0[0], 821979591332)) { break; }
+                p2 = p2 + 1;
+            }
+            break;
+        case 9:
+            break;
+        case 1:
+        }
+        i0 = -((f1(p4, p5, 528, 3U) > p4));
+    } else {
+        p0 = (f1(p6, 951, p4, 10) >= (594 || v0));
+    }
+    for (p4 = 0; p4 < 100; p4 = p4 + 1) {
+        v3 = 0;
+        while (v3 < 8) {
+            if (f1(256, la0[0], v5, 447)) { break; }
+            v3 = v3 + 1;
+        }
+        v3 = 509;
+        v5 = !(-(f1(4, 0ul, 331, 2)));
+    }
+    switch ((v1 >= j0)) {
+    case 3:
+        if (p6 >= 0 && p6 < 4) { la0[p6] = ((la1[7] - p4) + (p4 <= v4)); }
+        p3 = 65536;
+        break;
+    case 0:
+        break;
+    default:
+        if ((unsigned char)(909446261442u)) {
+            v3 = ((p5 || 7) > ((i0 < 987) && (la1[2] - 5)));
+            v1 = (((8 >= 41) < 583483166411) / (p4 * p4 + 1));
+            p5 = p4;
+        }
+        break;
+    case 214:
+        break;
+    case -5:
+        if ((((unsigned short)(9) == 3) < 306531911658)) {
+            v5 = (4 != !(227608544956));
+            p2 = p1;
+        } else {
+            switch (((la0[3] / 1) * (10L / (v5 * v5 + 1)))) {
+            case 0:
+                v3 = (2 || (426 + 3));
+                f0(6, (long)(4294967295), 417040281365, (6 + 6), f0(p4, v3, i0, p3, 1, ga0[0]), !(4));
+            case 7:
+                f0((la1[5] >= la1[3]), (439297249102 == 387), (j0 && v3), !(3), (unsigned short)(10), (936973275805 < v0));
+                break;
+            case 4:
+                f1(p0, (1 + 9), (char)(9), (4294967295 / (p3 * p3 + 1)));
+                v5 = ((long)((i0 < i0)) != 885ul);
+            case 6:
+                f1(845141667476, (v4 / 1024), (p0 <= 520ul), !(p6));
+            case 10:
+                break;
+            }
+        }
+        break;
+    }
+    if ((10 == 412)) {
+        v1 = v1 + ((454 == p1) >= (p3 && j0));
+        p2 = (((32767 <= p6) * (4 && 65535)) != 1L);
+    }
+    switch (1) {
+    case 0:
+        p0 = (f0(p1, j0, p5, 10, la1[7], v4) + (j0 <= 3));
+        for (p5 = 0; p5 < 17; p5 = p5 + 1) {
+            v5 = (!(f1(la1[0], p6, 10, v2)) + 2);
+        }
+    case 33:
+        f1(345, (822U - 8), (v0 - 498), (v2 / (p1 * p1 + 1)));
+        if (f0((2 != la0[1]), !(p3), 7, v2, 9, (unsigned long)(3))) {
+            p2 = (-(p2) + (-(v3) - (la0[0] - v5)));
+        }
+        break;
+    default:
+        if (v4 >= 0 && v4 < 8) { la1[v4] = (unsigned char)((p0 - 561L)); }
+        if ((long)(!(p5))) {
+            p0 = 462;
+        }
+        break;
+    }
+    v4 = -(v4);
+    return !(v1);
+}
+unsigned long f3() {
+    char v0 = 8;
+    int v1 = 727;
+    unsigned char v2 = 9;
+    long v3 = 32767;
+    int i0 = 637432693522;
+    long j0 = 6;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 3; }
+    i0 = (((7 != j0) + !(3)) * ((450 != v0) - -(v3)));
+    j0 = (char)(((538U >= v1) / (v1 * v1 + 1)));
+    f0(!(i0), i0, (7ul < v1), (i0 < 837999979395), (j0 * v3), (v3 && ga0[1]));
+    v0 = j0;
+    if (((8 || 306553676373) * (j0 / 13ul))) { return ((i0 / 3) + (1 == v2)); }
+    v0 = v0 + ((892 && 2) && ga0[4]);
+    v0 = f0(10, !(v2), 10, f2(v0, i0, v0, la0[3], j0, j0, v2), (310785617617 < v2), (unsigned long)(ga0[0]));
+    return (((v3 == ga0[12]) / 13ul) / 2);
+}
+int main() {
+    unsigned long v0 = 2;
+    long v1 = 524716758765;
+    unsigned char v2 = 5;
+    unsigned long v3 = 1000000007;
+    int i0 = 3;
+    long j0 = 1;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 73; }
+    if (v0 >= 0 && v0 < 16) { ga0[v0] = !((v0 < ga0[10])); }
+    i0 = 0;
+    while (i0 < 16) {
+        switch (((unsigned char)(684) >= (v0 != 263))) {
+        case 539:
+        case 52:
+            if (ga0[i0] < v2) { v2 = ga0[i0]; }
+            break;
+        case 712:
+            ga0[4] = ((3 * 9) / 3);
+            for (j0 = 0; j0 < 3; j0 = j0 + 1) {
+                if (-(65535)) { break; }
+            }
+        case 58:
+            ga0[i0] = ((ga0[8] - 65535) <= 7);
+            v0 = 7;
+            break;
+        case 962:
+            v0 = v2;
+            v3 = 0;
+            while (v3 < 16) {
+                if (v3) { break; }
+                v0 = v0 + (i0 - (v0 + v2));
+                v3 = v3 + 1;
+            }
+            break;
+        case 653:
+            la0[i0] = (la0[2] || 223);
+            if (la0[i0] < v3) { v3 = la0[i0]; }
+            break;
+        case 177:
+            break;
+        }
+        if ((-(f0(ga0[9], 730794091372, j0, 610801894003, la0[23], v3)) != (unsigned short)((732 || 7)))) {
+            if (v1) { return (unsigned int)((v0 && v0)); }
+        } else {
+            v3 = v3 + ((unsigned long)(617) < -(i0));
+        }
+        i0 = i0 + 1;
+    }
+    if ((1000000007 + (unsigned long)((char)(692)))) {
+        v3 = (long)((726 && i0));
+        j0 = (int)(f1(10, v0, j0, v3));
+    }
+    f2((295 - 2L), v0, (4 / 100), 2, (int)(i0), 6, 558u);
+    v3 = !(1053913845696);
+    ga0[1] = v3;
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2591 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.type f2, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movl %edi, -4(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movb %cl, -19(%rbp)
+	movb %r8b, -20(%rbp)
+	movl %r9d, -24(%rbp)
+	movq $115, -32(%rbp)
+	movb $-54, -33(%rbp)
+	movl $6, -40(%rbp)
+	movq $356, -48(%rbp)
+	movl $0, -40(%rbp)
+	movl $0, -80(%rbp)
+	movl $1, -76(%rbp)
+	movl $2, -72(%rbp)
+	movl $3, -68(%rbp)
+	movl $4, -64(%rbp)
+	movl $5, -60(%rbp)
+	movl $6, -56(%rbp)
+	movl $7, -52(%rbp)
+	movl $8, -40(%rbp)
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	subl -24(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L1
+.L0:
+	movl ga0+8(%rip), %eax
+	cmpl -40(%rbp), %eax
+	jge .L30
+	cmpl $0, -24(%rbp)
+	jne .L32
+	cmpl $0, -4(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L31
+.L1:
+	movq -16(%rbp), %rax
+	movslq %eax, %rax
+	cmpq $50, %rax
+	jge .L7
+	cmpq $-2, %rax
+	je .L4
+	cmpq $1, %rax
+	je .L3
+	jmp .L2
+.L32:
+	movl $1, %eax
+.L33:
+	jmp .L31
+.L30:
+	movl $1, %eax
+.L31:
+	subl $10, %eax
+	movl %eax, -24(%rbp)
+	movq $6, -48(%rbp)
+	movswl -18(%rbp), %eax
+	addl $4, %eax
+	movl %eax, -24(%rbp)
+	cmpl $0, -24(%rbp)
+	jb .L34
+	cmpl $8, -24(%rbp)
+	jae .L34
+	movl -24(%rbp), %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	movl %ecx, -80(%rbp,%rax,4)
+.L34:
+.L35:
+	movq -32(%rbp), %rax
+	cmpq -32(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	cmpl $2, %eax
+	jl .L36
+	movl -40(%rbp), %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L7:
+	cmpq $50, %rax
+	je .L6
+	cmpq $236, %rax
+	je .L5
+	jmp .L2
+.L28:
+	movl $1, %eax
+.L29:
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+.L26:
+.L27:
+.L6:
+	movq $-29888, -32(%rbp)
+.L2:
+	movl $3, %eax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	movslq -4(%rbp), %rax
+	addq %rcx, %rax
+	movb %al, -19(%rbp)
+	jmp .L0
+.L4:
+	movsbl -33(%rbp), %eax
+	pushq %rax
+	movl $-66, %eax
+	movq %rax, %rcx
+	cmpl $0, -40(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movb %al, -33(%rbp)
+	movswl -18(%rbp), %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L2
+	leaq .L20(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L13
+	# table target .L14
+	# table target .L15
+	# table target .L16
+	# table target .L18
+	# table target .L17
+	jmp *%rcx
+.L3:
+	movl $255, %eax
+	cmpq $15, %rax
+	je .L2
+.L9:
+	cmpq $0, -32(%rbp)
+	jne .LB0
+.L11:
+.L12:
+	jmp .L2
+.L19:
+.L18:
+.L13:
+	jmp .L2
+.L5:
+	xorl %eax, %eax
+	movswl -18(%rbp), %ecx
+	subl %ecx, %eax
+	movb %al, -20(%rbp)
+	movl ga0+36(%rip), %eax
+	cmpl $4, %eax
+	jg .L26
+	movsbl -33(%rbp), %eax
+	movl %eax, -88(%rbp)
+	movq %rax, %rcx
+	movl -88(%rbp), %eax
+	subl %ecx, %eax
+	jne .L28
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L29
+.L10:
+.L8:
+	jmp .L2
+.L14:
+	movb $0, -19(%rbp)
+	jmp .L2
+.L17:
+	movsbl -33(%rbp), %eax
+	movl %eax, -84(%rbp)
+	cmpl %eax, -84(%rbp)
+	setle %al
+	movzbl %al, %eax
+	cmpl $92, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	jmp .L2
+.L36:
+.L37:
+	movq $0, -48(%rbp)
+	movq -32(%rbp), %rax
+	movb %al, -33(%rbp)
+	movsbl -33(%rbp), %eax
+	movb %al, -33(%rbp)
+	movsbl -33(%rbp), %eax
+	movb %al, -33(%rbp)
+	movsbl -33(%rbp), %eax
+	movb %al, -33(%rbp)
+	movq $4, -48(%rbp)
+	imulq $686, -32(%rbp), %rax
+	movzbl -19(%rbp), %ecx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $359227980728, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -18(%rbp)
+	cmpb $0, -19(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .f0_return
+.LB0:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L15:
+	movb $97, -20(%rbp)
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl -24(%rbp), %eax
+	movabsq $275094834999, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .LB1
+.L21:
+.L22:
+.L16:
+	cmpl $156, -24(%rbp)
+	jb .L25
+	movl $2, %eax
+	testl %eax, %eax
+	je .L23
+.L25:
+	movl $4, %eax
+	jmp .f0_return
+.L23:
+.L24:
+	cmpq $286, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	cmpl $-1, %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB1:
+	movq -48(%rbp), %rax
+	movsbl %al, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L20:
+	.long .L14-.L20
+	.long .L13-.L20
+	.long .L13-.L20
+	.long .L15-.L20
+	.long .L13-.L20
+	.long .L16-.L20
+	.long .L13-.L20
+	.long .L18-.L20
+	.long .L17-.L20
+	.popsection
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movq %rdi, -8(%rbp)
+	movw %si, -10(%rbp)
+	movb %dl, -11(%rbp)
+	movb %cl, -12(%rbp)
+	movl %r8d, -16(%rbp)
+	movq $115, -24(%rbp)
+	movb $-54, -25(%rbp)
+	movl $6, -32(%rbp)
+	movq $356, -40(%rbp)
+	movl $0, -32(%rbp)
+	movl $0, -80(%rbp)
+	movl $1, -76(%rbp)
+	movl $2, -72(%rbp)
+	movl $3, -68(%rbp)
+	movl $4, -64(%rbp)
+	movl $5, -60(%rbp)
+	movl $6, -56(%rbp)
+	movl $7, -52(%rbp)
+	movl $8, -32(%rbp)
+	movl $10, %eax
+	subl -16(%rbp), %eax
+	movabsq $4025619762426006549, %rdx
+	imulq %rdx
+	sarq $14, %rdx
+	movl %edx, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L39
+.L38:
+	movl ga0+8(%rip), %eax
+	cmpl -32(%rbp), %eax
+	jge .L68
+	cmpl $0, -16(%rbp)
+	jne .L70
+	movl $274, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L69
+.L39:
+	movq -8(%rbp), %rax
+	movslq %eax, %rax
+	cmpq $50, %rax
+	jge .L45
+	cmpq $-2, %rax
+	je .L42
+	cmpq $1, %rax
+	je .L41
+	jmp .L40
+.L70:
+	movl $1, %eax
+.L71:
+	jmp .L69
+.L68:
+	movl $1, %eax
+.L69:
+	subl $10, %eax
+	movl %eax, -16(%rbp)
+	movq $6, -40(%rbp)
+	movswl -10(%rbp), %eax
+	addl $4, %eax
+	movl %eax, -16(%rbp)
+	cmpl $0, -16(%rbp)
+	jb .L72
+	cmpl $8, -16(%rbp)
+	jae .L72
+	movl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	movl %ecx, -80(%rbp,%rax,4)
+.L72:
+.L73:
+	movq -24(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	cmpl $2, %eax
+	jl .L74
+	movl -32(%rbp), %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L45:
+	cmpq $50, %rax
+	je .L44
+	cmpq $236, %rax
+	je .L43
+	jmp .L40
+.L66:
+	movl $1, %eax
+.L67:
+	movslq %eax, %rax
+	addq %rax, -8(%rbp)
+.L64:
+.L65:
+.L44:
+	movq $-29888, -24(%rbp)
+.L40:
+	movl $3, %eax
+	subq -8(%rbp), %rax
+	addq $274, %rax
+	movb %al, -11(%rbp)
+	jmp .L38
+.L42:
+	movsbl -25(%rbp), %eax
+	pushq %rax
+	movl $-66, %eax
+	movq %rax, %rcx
+	cmpl $0, -32(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movb %al, -25(%rbp)
+	movswl -10(%rbp), %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L40
+	leaq .L58(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L51
+	# table target .L52
+	# table target .L53
+	# table target .L54
+	# table target .L56
+	# table target .L55
+	jmp *%rcx
+.L41:
+	movl $255, %eax
+	cmpq $15, %rax
+	je .L40
+.L47:
+	cmpq $0, -24(%rbp)
+	jne .LB2
+.L49:
+.L50:
+	jmp .L40
+.L57:
+.L56:
+.L51:
+	jmp .L40
+.L43:
+	xorl %eax, %eax
+	movswl -10(%rbp), %ecx
+	subl %ecx, %eax
+	movb %al, -12(%rbp)
+	movl ga0+36(%rip), %eax
+	cmpl $4, %eax
+	jg .L64
+	movsbl -25(%rbp), %eax
+	movl %eax, -88(%rbp)
+	movq %rax, %rcx
+	movl -88(%rbp), %eax
+	subl %ecx, %eax
+	jne .L66
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L67
+.L48:
+.L46:
+	jmp .L40
+.L52:
+	movb $0, -11(%rbp)
+	jmp .L40
+.L55:
+	movsbl -25(%rbp), %eax
+	movl %eax, -84(%rbp)
+	cmpl %eax, -84(%rbp)
+	setle %al
+	movzbl %al, %eax
+	cmpl $92, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	jmp .L40
+.L74:
+.L75:
+	movq $0, -40(%rbp)
+	movq -24(%rbp), %rax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movq $4, -40(%rbp)
+	imulq $686, -24(%rbp), %rax
+	movzbl -11(%rbp), %ecx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $359227980728, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -10(%rbp)
+	cmpb $0, -11(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .f0.constprop.0_return
+.LB2:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L53:
+	movb $97, -12(%rbp)
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	movabsq $275094834999, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .LB3
+.L59:
+.L60:
+.L54:
+	cmpl $156, -16(%rbp)
+	jb .L63
+	movl $2, %eax
+	testl %eax, %eax
+	je .L61
+.L63:
+	movl $4, %eax
+	jmp .f0.constprop.0_return
+.L61:
+.L62:
+	cmpq $286, -8(%rbp)
+	setg %al
+	movzbl %al, %eax
+	cmpl $-1, %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.LB3:
+	movq -40(%rbp), %rax
+	movsbl %al, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L58:
+	.long .L52-.L58
+	.long .L51-.L58
+	.long .L51-.L58
+	.long .L53-.L58
+	.long .L51-.L58
+	.long .L54-.L58
+	.long .L51-.L58
+	.long .L56-.L58
+	.long .L55-.L58
+	.popsection
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movq %rdi, -8(%rbp)
+	movw %si, -10(%rbp)
+	movb %dl, -11(%rbp)
+	movb %cl, -12(%rbp)
+	movl %r8d, -16(%rbp)
+	movq $115, -24(%rbp)
+	movb $-54, -25(%rbp)
+	movl $6, -32(%rbp)
+	movq $356, -40(%rbp)
+	movl $0, -32(%rbp)
+	movl $0, -80(%rbp)
+	movl $1, -76(%rbp)
+	movl $2, -72(%rbp)
+	movl $3, -68(%rbp)
+	movl $4, -64(%rbp)
+	movl $5, -60(%rbp)
+	movl $6, -56(%rbp)
+	movl $7, -52(%rbp)
+	movl $8, -32(%rbp)
+	movl $10, %eax
+	subl -16(%rbp), %eax
+	movabsq $1135184250689818561, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	movl %edx, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L77
+.L76:
+	movl ga0+8(%rip), %eax
+	cmpl -32(%rbp), %eax
+	jge .L106
+	cmpl $0, -16(%rbp)
+	jne .L108
+	movl $8, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L77:
+	movq -8(%rbp), %rax
+	movslq %eax, %rax
+	cmpq $50, %rax
+	jge .L83
+	cmpq $-2, %rax
+	je .L80
+	cmpq $1, %rax
+	je .L79
+	jmp .L78
+.L108:
+	movl $1, %eax
+.L109:
+	jmp .L107
+.L106:
+	movl $1, %eax
+.L107:
+	subl $10, %eax
+	movl %eax, -16(%rbp)
+	movq $6, -40(%rbp)
+	movswl -10(%rbp), %eax
+	addl $4, %eax
+	movl %eax, -16(%rbp)
+	cmpl $0, -16(%rbp)
+	jb .L110
+	cmpl $8, -16(%rbp)
+	jae .L110
+	movl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	movl %ecx, -80(%rbp,%rax,4)
+.L110:
+.L111:
+	movq -24(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	cmpl $2, %eax
+	jl .L112
+	movl -32(%rbp), %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L83:
+	cmpq $50, %rax
+	je .L82
+	cmpq $236, %rax
+	je .L81
+	jmp .L78
+.L104:
+	movl $1, %eax
+.L105:
+	movslq %eax, %rax
+	addq %rax, -8(%rbp)
+.L102:
+.L103:
+.L82:
+	movq $-29888, -24(%rbp)
+.L78:
+	movl $3, %eax
+	subq -8(%rbp), %rax
+	addq $8, %rax
+	movb %al, -11(%rbp)
+	jmp .L76
+.L80:
+	movsbl -25(%rbp), %eax
+	pushq %rax
+	movl $-66, %eax
+	movq %rax, %rcx
+	cmpl $0, -32(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movb %al, -25(%rbp)
+	movswl -10(%rbp), %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L78
+	leaq .L96(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L89
+	# table target .L90
+	# table target .L91
+	# table target .L92
+	# table target .L94
+	# table target .L93
+	jmp *%rcx
+.L79:
+	movl $255, %eax
+	cmpq $15, %rax
+	je .L78
+.L85:
+	cmpq $0, -24(%rbp)
+	jne .LB4
+.L87:
+.L88:
+	jmp .L78
+.L95:
+.L94:
+.L89:
+	jmp .L78
+.L81:
+	xorl %eax, %eax
+	movswl -10(%rbp), %ecx
+	subl %ecx, %eax
+	movb %al, -12(%rbp)
+	movl ga0+36(%rip), %eax
+	cmpl $4, %eax
+	jg .L102
+	movsbl -25(%rbp), %eax
+	movl %eax, -88(%rbp)
+	movq %rax, %rcx
+	movl -88(%rbp), %eax
+	subl %ecx, %eax
+	jne .L104
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L105
+.L86:
+.L84:
+	jmp .L78
+.L90:
+	movb $0, -11(%rbp)
+	jmp .L78
+.L93:
+	movsbl -25(%rbp), %eax
+	movl %eax, -84(%rbp)
+	cmpl %eax, -84(%rbp)
+	setle %al
+	movzbl %al, %eax
+	cmpl $92, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	jmp .L78
+.L112:
+.L113:
+	movq $0, -40(%rbp)
+	movq -24(%rbp), %rax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movq $4, -40(%rbp)
+	imulq $686, -24(%rbp), %rax
+	movzbl -11(%rbp), %ecx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $359227980728, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -10(%rbp)
+	cmpb $0, -11(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .f0.constprop.1_return
+.LB4:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0.constprop.1_return
+.L91:
+	movb $97, -12(%rbp)
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	movabsq $275094834999, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .LB5
+.L97:
+.L98:
+.L92:
+	cmpl $156, -16(%rbp)
+	jb .L101
+	movl $2, %eax
+	testl %eax, %eax
+	je .L99
+.L101:
+	movl $4, %eax
+	jmp .f0.constprop.1_return
+.L99:
+.L100:
+	cmpq $286, -8(%rbp)
+	setg %al
+	movzbl %al, %eax
+	cmpl $-1, %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.1_return
+.LB5:
+	movq -40(%rbp), %rax
+	movsbl %al, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.pushsection .rodata
+	.p2align 2
+.L96:
+	.long .L90-.L96
+	.long .L89-.L96
+	.long .L89-.L96
+	.long .L91-.L96
+	.long .L89-.L96
+	.long .L92-.L96
+	.long .L89-.L96
+	.long .L94-.L96
+	.long .L93-.L96
+	.popsection
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $96, %rsp
+	movq %rdi, -8(%rbp)
+	movw %si, -10(%rbp)
+	movb %dl, -11(%rbp)
+	movb %cl, -12(%rbp)
+	movl %r8d, -16(%rbp)
+	movq $115, -24(%rbp)
+	movb $-54, -25(%rbp)
+	movl $6, -32(%rbp)
+	movq $356, -40(%rbp)
+	movl $0, -32(%rbp)
+	movl $0, -80(%rbp)
+	movl $1, -76(%rbp)
+	movl $2, -72(%rbp)
+	movl $3, -68(%rbp)
+	movl $4, -64(%rbp)
+	movl $5, -60(%rbp)
+	movl $6, -56(%rbp)
+	movl $7, -52(%rbp)
+	movl $8, -32(%rbp)
+	movl $10, %eax
+	subl -16(%rbp), %eax
+	movabsq $6538232998278155201, %rdx
+	imulq %rdx
+	sarq $16, %rdx
+	movl %edx, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L115
+.L114:
+	movl ga0+8(%rip), %eax
+	cmpl -32(%rbp), %eax
+	jge .L144
+	cmpl $0, -16(%rbp)
+	jne .L146
+	movl $430, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L145
+.L115:
+	movq -8(%rbp), %rax
+	movslq %eax, %rax
+	cmpq $50, %rax
+	jge .L121
+	cmpq $-2, %rax
+	je .L118
+	cmpq $1, %rax
+	je .L117
+	jmp .L116
+.L146:
+	movl $1, %eax
+.L147:
+	jmp .L145
+.L144:
+	movl $1, %eax
+.L145:
+	subl $10, %eax
+	movl %eax, -16(%rbp)
+	movq $6, -40(%rbp)
+	movswl -10(%rbp), %eax
+	addl $4, %eax
+	movl %eax, -16(%rbp)
+	cmpl $0, -16(%rbp)
+	jb .L148
+	cmpl $8, -16(%rbp)
+	jae .L148
+	movl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	movl %ecx, -80(%rbp,%rax,4)
+.L148:
+.L149:
+	movq -24(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	cmpl $2, %eax
+	jl .L150
+	movl -32(%rbp), %eax
+.f0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L121:
+	cmpq $50, %rax
+	je .L120
+	cmpq $236, %rax
+	je .L119
+	jmp .L116
+.L142:
+	movl $1, %eax
+.L143:
+	movslq %eax, %rax
+	addq %rax, -8(%rbp)
+.L140:
+.L141:
+.L120:
+	movq $-29888, -24(%rbp)
+.L116:
+	movl $3, %eax
+	subq -8(%rbp), %rax
+	addq $430, %rax
+	movb %al, -11(%rbp)
+	jmp .L114
+.L118:
+	movsbl -25(%rbp), %eax
+	pushq %rax
+	movl $-66, %eax
+	movq %rax, %rcx
+	cmpl $0, -32(%rbp)
+	popq %rax
+	cmovnel %ecx, %eax
+	movb %al, -25(%rbp)
+	movswl -10(%rbp), %eax
+	movslq %eax, %rax
+	leaq -1(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L116
+	leaq .L134(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L127
+	# table target .L128
+	# table target .L129
+	# table target .L130
+	# table target .L132
+	# table target .L131
+	jmp *%rcx
+.L117:
+	movl $255, %eax
+	cmpq $15, %rax
+	je .L116
+.L123:
+	cmpq $0, -24(%rbp)
+	jne .LB6
+.L125:
+.L126:
+	jmp .L116
+.L133:
+.L132:
+.L127:
+	jmp .L116
+.L119:
+	xorl %eax, %eax
+	movswl -10(%rbp), %ecx
+	subl %ecx, %eax
+	movb %al, -12(%rbp)
+	movl ga0+36(%rip), %eax
+	cmpl $4, %eax
+	jg .L140
+	movsbl -25(%rbp), %eax
+	movl %eax, -88(%rbp)
+	movq %rax, %rcx
+	movl -88(%rbp), %eax
+	subl %ecx, %eax
+	jne .L142
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L143
+.L124:
+.L122:
+	jmp .L116
+.L128:
+	movb $0, -11(%rbp)
+	jmp .L116
+.L131:
+	movsbl -25(%rbp), %eax
+	movl %eax, -84(%rbp)
+	cmpl %eax, -84(%rbp)
+	setle %al
+	movzbl %al, %eax
+	cmpl $92, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	jmp .L116
+.L150:
+.L151:
+	movq $0, -40(%rbp)
+	movq -24(%rbp), %rax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movsbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	movq $4, -40(%rbp)
+	imulq $686, -24(%rbp), %rax
+	movzbl -11(%rbp), %ecx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $359227980728, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movw %ax, -10(%rbp)
+	cmpb $0, -11(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .f0.constprop.2_return
+.LB6:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	jmp .f0.constprop.2_return
+.L129:
+	movb $97, -12(%rbp)
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	movabsq $275094834999, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .LB7
+.L135:
+.L136:
+.L130:
+	cmpl $156, -16(%rbp)
+	jb .L139
+	movl $2, %eax
+	testl %eax, %eax
+	je .L137
+.L139:
+	movl $4, %eax
+	jmp .f0.constprop.2_return
+.L137:
+.L138:
+	cmpq $286, -8(%rbp)
+	setg %al
+	movzbl %al, %eax
+	cmpl $-1, %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.2_return
+.LB7:
+	movq -40(%rbp), %rax
+	movsbl %al, %eax
+	jmp .f0.constprop.2_return
+	.size f0.constprop.2, .-f0.constprop.2
+	.pushsection .rodata
+	.p2align 2
+.L134:
+	.long .L128-.L134
+	.long .L127-.L134
+	.long .L127-.L134
+	.long .L129-.L134
+	.long .L127-.L134
+	.long .L130-.L134
+	.long .L127-.L134
+	.long .L132-.L134
+	.long .L131-.L134
+	.popsection
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movb %dil, -1(%rbp)
+	movq %rsi, -16(%rbp)
+	movw %dx, -18(%rbp)
+	movw %cx, -20(%rbp)
+	movl $2402503602, -24(%rbp)
+	movb $4, -25(%rbp)
+	movl $255, -32(%rbp)
+	movb $10, -33(%rbp)
+	movb $4, -34(%rbp)
+	movl $0, -40(%rbp)
+	movl $8, -44(%rbp)
+	movq $65536, -56(%rbp)
+	movl $0, -44(%rbp)
+	movl $0, -80(%rbp)
+	movl $4, -76(%rbp)
+	movl $8, -72(%rbp)
+	movl $12, -68(%rbp)
+	movl $4, -44(%rbp)
+	cmpb $0, -33(%rbp)
+	je .L152
+	movb $0, -34(%rbp)
+	jmp .L153
+.L152:
+	movzbl -34(%rbp), %eax
+	cmpl $573, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	subl %ecx, %eax
+	cmpl $1, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl ga0+24(%rip), %eax
+	movzwl -20(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movzbl -33(%rbp), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L154
+	movl $4, %eax
+	movq %rax, %r8
+	movzbl -33(%rbp), %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl ga0+40(%rip), %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movslq %eax, %rax
+	cmpq $620, %rax
+.L157:
+	movl $4294967295, %eax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl -32(%rbp), %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movl %eax, %eax
+	movq %rax, -56(%rbp)
+.L156:
+	jmp .L155
+.L154:
+	movl ga0+44(%rip), %eax
+	movl %eax, -40(%rbp)
+.L155:
+	movsbl -25(%rbp), %eax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	movq %rax, %r8
+	movl $65, %eax
+	movq %rax, %rcx
+	movsbl -25(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movsbl -1(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movl %eax, %eax
+	movq %rax, -16(%rbp)
+.L153:
+	cmpq $0, -16(%rbp)
+	jl .L158
+	cmpq $4, -16(%rbp)
+	jge .L158
+	movsbl -25(%rbp), %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movzbl -33(%rbp), %eax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	movq %rax, %rdx
+	movabsq $237941903352, %rax
+	movq %rax, %rsi
+	movl -68(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+.L158:
+.L159:
+	movl $525, %eax
+	movq %rax, %r8
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movzbl -33(%rbp), %eax
+	movq %rax, -88(%rbp)
+	movq %rax, %rdi
+	call f0.constprop.1
+	movq %rax, %rcx
+	movzbl -34(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -34(%rbp)
+	movl $2, %eax
+	pushq %rax
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -92(%rbp)
+	movq %rax, %rcx
+	movl $1, %eax
+	xorl %edx, %edx
+	divl %ecx
+	pushq %rax
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $516, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdx
+	movl $-12, %eax
+	movq %rax, %rsi
+	movq $-867, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f0.constprop.2
+	movl %eax, %eax
+	movq %rax, -16(%rbp)
+	movswl -18(%rbp), %eax
+	movl %eax, -96(%rbp)
+	addl $3, %eax
+	cmpl $39, %eax
+	setl %al
+	movzbl %al, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl -76(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	cmpl $255, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	xorl %edx, %edx
+	divl -92(%rbp)
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -25(%rbp)
+	movzbl -33(%rbp), %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	jl .L160
+	cmpl $4, -100(%rbp)
+	jge .L160
+	movq -88(%rbp), %rax
+	movl $2, -80(%rbp,%rax,4)
+.L160:
+.L161:
+	movl -96(%rbp), %eax
+	cmpl -44(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $5, %eax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	movq %rax, %r8
+	movl $234, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl $861, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	movq -88(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $1000000007, %eax
+	movq %rax, %r9
+	movl $229, %eax
+	movq %rax, %r8
+	movl -24(%rbp), %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movabsq $675234734065, %rax
+	movq %rax, %rsi
+	movl $988, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rdx
+	movl $802, %eax
+	movq %rax, %rsi
+	movzbl -33(%rbp), %eax
+	addl -24(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	movl -72(%rbp), %eax
+	cmpl $10, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movl -72(%rbp), %eax
+	movq %rax, %r8
+	movl $230, %eax
+	subl -100(%rbp), %eax
+	movq %rax, %rcx
+	cmpb $0, -1(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movslq -44(%rbp), %rax
+	movq %rax, %rsi
+	cmpq $323, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	movq %rbp, %rsp
+	popq %rbp
+	jmp f0
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1, .-f1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $288, %rsp
+	movq $2, -8(%rbp)
+	movabsq $524716758765, %rax
+	movq %rax, -16(%rbp)
+	movb $5, -17(%rbp)
+	movq $1000000007, -32(%rbp)
+	movl $3, -36(%rbp)
+	movq $1, -48(%rbp)
+	movl $0, -36(%rbp)
+	imull $73, -36(%rbp), %eax
+	subl $73, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -200(%rbp)
+	testl %eax, %eax
+	je .L162
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L165
+	.p2align 4,,10
+.L164:
+	addl $73, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $73, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $73, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $73, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -208(%rbp)
+	jne .L164
+.L165:
+.L162:
+.L163:
+	cmpl $33, -36(%rbp)
+	jge .L167
+	.p2align 4,,10
+.L166:
+	addl $73, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L166
+.L167:
+	cmpq $0, -8(%rbp)
+	jb .L168
+	cmpq $16, -8(%rbp)
+	jae .L168
+	movl ga0+40(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -8(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L168:
+.L169:
+	movl $0, -36(%rbp)
+	movl $3, %eax
+	imull $9, %eax, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl %eax, -212(%rbp)
+	xorl %eax, %eax
+	subl $65535, %eax
+	movl %eax, -216(%rbp)
+	movl $732, %eax
+	testl %eax, %eax
+	jne .L170
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L171
+.L170:
+	movl $1, %eax
+.L171:
+	movl %eax, -220(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L173
+	.p2align 4,,10
+.L172:
+	cmpq $263, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	cmpl $172, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $539, %rax
+	jge .L181
+	cmpq $52, %rax
+	je .L175
+	cmpq $58, %rax
+	je .L177
+	cmpq $177, %rax
+	je .L174
+	jmp .L174
+.L181:
+	cmpq $712, %rax
+	jge .L182
+	cmpq $539, %rax
+	je .L175
+	cmpq $653, %rax
+	je .L179
+	jmp .L174
+.L175:
+	movslq -36(%rbp), %rax
+	movq %rax, -232(%rbp)
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movzbl -17(%rbp), %ecx
+	cmpl %ecx, %eax
+	jge .L174
+	movq -232(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movb %al, -17(%rbp)
+.L183:
+.L184:
+	jmp .L174
+.L176:
+	movl -212(%rbp), %eax
+	movl %eax, ga0+16(%rip)
+	movq $0, -48(%rbp)
+	movl -216(%rbp), %eax
+	movl %eax, -236(%rbp)
+	cmpq $3, -48(%rbp)
+	jge .L186
+	.p2align 4,,10
+.L185:
+	cmpl $0, -236(%rbp)
+	je .L187
+.L186:
+.L177:
+	movl ga0+32(%rip), %eax
+	subl $65535, %eax
+	cmpl $7, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movq $7, -8(%rbp)
+.L174:
+	movl -220(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -32(%rbp), %rax
+	movq %rax, %r9
+	movl -100(%rbp), %eax
+	movq %rax, %r8
+	movl $115, %eax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	movq %rax, %rdx
+	movabsq $730794091372, %rax
+	movq %rax, %rsi
+	movl ga0+36(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	je .L197
+	cmpq $0, -16(%rbp)
+	je .L198
+	cmpq $0, -8(%rbp)
+	je .L201
+	cmpq $0, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L202
+.L197:
+	xorl %eax, %eax
+	subl -36(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $617, %rax
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+.L198:
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L172
+.L173:
+	movl $1000000007, %eax
+	addq $-76, %rax
+	je .L203
+	movl $726, %eax
+	testl %eax, %eax
+	je .L205
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L206
+.L187:
+.L188:
+	addq $1, -48(%rbp)
+	cmpq $3, -48(%rbp)
+	jl .L185
+	jmp .L186
+.L201:
+	movl $0, %eax
+.L202:
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L199:
+.L200:
+	jmp .L198
+.L182:
+	cmpq $712, %rax
+	je .L176
+	cmpq $962, %rax
+	je .L178
+	jmp .L174
+.L178:
+	movzbl -17(%rbp), %eax
+	movq %rax, -248(%rbp)
+	movq %rax, -8(%rbp)
+	movq $0, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jae .L174
+	.p2align 4,,10
+.L189:
+	cmpq $0, -32(%rbp)
+	je .L191
+.L190:
+	jmp .L174
+.L191:
+.L192:
+	movq -8(%rbp), %rax
+	addq -248(%rbp), %rax
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	subq %rcx, %rax
+	addq %rax, -8(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jb .L189
+	jmp .L174
+.L179:
+	movl -184(%rbp), %eax
+	testl %eax, %eax
+	jne .L193
+	movl $223, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L194
+.L193:
+	movl $1, %eax
+.L194:
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movq %rax, -256(%rbp)
+	movl %ecx, -192(%rbp,%rax,4)
+	movq -256(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	jae .L174
+	movq -256(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+.L195:
+.L196:
+	jmp .L174
+.L180:
+	jmp .L174
+.L205:
+	movl $0, %eax
+.L206:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	movq %rax, %rdx
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f1
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+.L203:
+.L204:
+	subq $8, %rsp
+	movl $558, %eax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	movl $4, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movl $295, %eax
+	subq $2, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f2
+	addq $16, %rsp
+	movabsq $1053913845696, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -32(%rbp), %rax
+	movl %eax, ga0+4(%rip)
+	movq $0, -264(%rbp)
+	imulq $31, -264(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -264(%rbp)
+	imulq $31, -264(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -264(%rbp)
+	imulq $31, -264(%rbp), %rax
+	movzbl -17(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	imulq $31, -264(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -264(%rbp)
+	imulq $31, -264(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	imulq $31, -264(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -264(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L207
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -272(%rbp)
+	cmpq $0, -272(%rbp)
+	je .L210
+	.p2align 4,,10
+.L209:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -272(%rbp)
+	jne .L209
+.L210:
+.L207:
+.L208:
+	cmpl $16, -36(%rbp)
+	jge .L212
+	.p2align 4,,10
+.L211:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L211
+.L212:
+	movl $0, -36(%rbp)
+	cmpl $0, -200(%rbp)
+	je .L213
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L216
+	.p2align 4,,10
+.L215:
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -280(%rbp)
+	jne .L215
+.L216:
+.L213:
+.L214:
+	cmpl $33, -36(%rbp)
+	jge .L218
+	.p2align 4,,10
+.L217:
+	movslq -36(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -264(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L217
+.L218:
+	movq -264(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -264(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -264(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -264(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -264(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -264(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -264(%rbp)
+	movq -264(%rbp), %rax
+	jmp .main_return
+	.size main, .-main
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movq %rdx, -24(%rbp)
+	movw %cx, -26(%rbp)
+	movl %r8d, -32(%rbp)
+	movq %r9, -40(%rbp)
+	movq $7, -48(%rbp)
+	movw $22, -50(%rbp)
+	movw $0, -52(%rbp)
+	movl $1, -56(%rbp)
+	movb $255, -57(%rbp)
+	movabsq $785275248323, %rax
+	movq %rax, -72(%rbp)
+	movl $0, -76(%rbp)
+	movq $3, -88(%rbp)
+	movl $0, -76(%rbp)
+	movl $0, -112(%rbp)
+	movl $1, -108(%rbp)
+	movl $2, -104(%rbp)
+	movl $3, -100(%rbp)
+	movl $4, -76(%rbp)
+	movl $0, -76(%rbp)
+	movl $0, -144(%rbp)
+	movl $194, -140(%rbp)
+	movl $388, -136(%rbp)
+	movl $582, -132(%rbp)
+	movl $776, -128(%rbp)
+	movl $970, -124(%rbp)
+	movl $1164, -120(%rbp)
+	movl $1358, -116(%rbp)
+	movl $8, -76(%rbp)
+	movzwl 16(%rbp), %eax
+	movl %eax, -148(%rbp)
+	testl %eax, %eax
+	jl .L219
+	cmpl $8, -148(%rbp)
+	jge .L219
+	movl $619, %eax
+	movq %rax, %r9
+	movswl -52(%rbp), %eax
+	movq %rax, %r8
+	movl -56(%rbp), %eax
+	movq %rax, %rcx
+	movl $-1, %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl $739868428, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rcx
+	movzwl 16(%rbp), %eax
+	movl %ecx, -144(%rbp,%rax,4)
+.L219:
+.L220:
+	cmpq $0, -24(%rbp)
+	je .L221
+	xorl %eax, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L229
+	leaq .L230(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L223
+	# table target .L224
+	# table target .L228
+	# table target .L225
+	# table target .L226
+	# table target .L227
+	jmp *%rcx
+.L221:
+	movl $10, %eax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movq %rax, %rdx
+	movl $951, %eax
+	movq %rax, %rsi
+	movzwl 16(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	cmpl $1, %eax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	jmp .L222
+.L229:
+.L228:
+.L223:
+	movl -32(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $3, %eax
+	movq %rax, %rcx
+	movl $528, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	popq %rcx
+	cmpl %ecx, %eax
+	seta %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -76(%rbp)
+.L222:
+	movl $0, -32(%rbp)
+	cmpl $100, -32(%rbp)
+	jge .L238
+	.p2align 4,,10
+.L237:
+	movl $0, -56(%rbp)
+	cmpl $8, -56(%rbp)
+	jge .L240
+	.p2align 4,,10
+.L239:
+	movl $447, %eax
+	movq %rax, %rcx
+	movq -72(%rbp), %rax
+	movq %rax, %rdx
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f1
+	testl %eax, %eax
+	je .L241
+.L240:
+	movl $509, -56(%rbp)
+	movl $2, %eax
+	movq %rax, %rcx
+	movl $331, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f1
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $100, -32(%rbp)
+	jl .L237
+.L238:
+	movzwl -50(%rbp), %eax
+	cmpq -88(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	jge .L249
+	cmpq $-5, %rax
+	je .L248
+	cmpq $0, %rax
+	je .L243
+.L246:
+	cmpl $987, -76(%rbp)
+	jge .L252
+	movl -136(%rbp), %eax
+	subl $5, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L253
+.L241:
+.L242:
+	addl $1, -56(%rbp)
+	cmpl $8, -56(%rbp)
+	jl .L239
+	jmp .L240
+.L249:
+	cmpq $3, %rax
+	je .L244
+	cmpq $214, %rax
+	je .L243
+	jmp .L246
+.L244:
+	movzwl 16(%rbp), %eax
+	movl %eax, -156(%rbp)
+	testl %eax, %eax
+	jl .L250
+	cmpl $4, -156(%rbp)
+	jge .L250
+	movzbl -57(%rbp), %eax
+	cmpl %eax, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -116(%rbp), %eax
+	subl -32(%rbp), %eax
+	addl %ecx, %eax
+	movq %rax, %rcx
+	movzwl 16(%rbp), %eax
+	movl %ecx, -112(%rbp,%rax,4)
+.L250:
+.L251:
+	movw $0, -26(%rbp)
+.L243:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L257
+	cmpq $33, %rax
+	je .L258
+.L259:
+	movzbl -57(%rbp), %eax
+	movl %eax, -184(%rbp)
+	testl %eax, %eax
+	jl .L268
+	cmpl $8, -184(%rbp)
+	jge .L268
+	movq -8(%rbp), %rax
+	subq $561, %rax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -57(%rbp), %eax
+	movl %ecx, -144(%rbp,%rax,4)
+.L268:
+.L269:
+	movq -8(%rbp), %rax
+	pushq %rax
+	movl $462, %eax
+	movq %rax, %rcx
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	popq %rax
+	cmovneq %rcx, %rax
+	movq %rax, -8(%rbp)
+	jmp .L256
+.L257:
+	cmpq $3, -88(%rbp)
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movzbl -57(%rbp), %eax
+	movq %rax, %r9
+	movl -116(%rbp), %eax
+	movq %rax, %r8
+	movl $10, %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movq %rax, %rdx
+	movq -88(%rbp), %rax
+	movq %rax, %rsi
+	movl -12(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	movq %rax, -8(%rbp)
+	movq $0, -40(%rbp)
+	cmpq $17, -40(%rbp)
+	jae .L260
+	movl $17, %eax
+	subq -40(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -168(%rbp)
+	cmpq $0, -168(%rbp)
+	je .L263
+	.p2align 4,,10
+.L262:
+	movswl -52(%rbp), %eax
+	movw %ax, -178(%rbp)
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movzwl 16(%rbp), %eax
+	movq %rax, -176(%rbp)
+	movq %rax, %rsi
+	movl -144(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl $2, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	addq $1, -40(%rbp)
+	movzwl -178(%rbp), %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movq -176(%rbp), %rax
+	movq %rax, %rsi
+	movl -144(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl $2, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	addq $1, -40(%rbp)
+	subq $1, -168(%rbp)
+	jne .L262
+.L263:
+.L260:
+.L261:
+	cmpq $17, -40(%rbp)
+	jae .L265
+	.p2align 4,,10
+.L264:
+	movswl -52(%rbp), %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movzwl 16(%rbp), %eax
+	movq %rax, %rsi
+	movl -144(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl $2, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $17, -40(%rbp)
+	jb .L264
+.L265:
+.L258:
+	movl -12(%rbp), %eax
+	imull -12(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movswl -52(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	subq $498, %rax
+	movq %rax, %rdx
+	movl $814, %eax
+	movq %rax, %rsi
+	movl $89, %eax
+	movq %rax, %rdi
+	call f1
+	movl $3, %eax
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movswl -52(%rbp), %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	cmpw $0, -26(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl -108(%rbp), %eax
+	cmpl $2, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	je .L266
+	movl -112(%rbp), %eax
+	movslq %eax, %rax
+	subq -72(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl -56(%rbp), %eax
+	movslq %eax, %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq -24(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -24(%rbp)
+.L266:
+.L267:
+.L256:
+	xorl %eax, %eax
+	movzbl -57(%rbp), %ecx
+	subl %ecx, %eax
+	movb %al, -57(%rbp)
+	cmpw $0, -50(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L252:
+	movl $0, %eax
+.L253:
+	pushq %rax
+	cmpq $0, -40(%rbp)
+	jne .L254
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L255
+.L254:
+	movl $1, %eax
+.L255:
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	cltd
+	idivl %ecx
+	movw %ax, -50(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -40(%rbp)
+	jmp .L243
+.L248:
+	movq $1, -72(%rbp)
+	movl -12(%rbp), %eax
+	movq %rax, -24(%rbp)
+	jmp .L243
+.L245:
+	jmp .L243
+.L247:
+	jmp .L243
+.L224:
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	movq %rax, %rdx
+	movl $18, %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movl $2, %eax
+	pushq %rax
+	movl -12(%rbp), %eax
+	pushq %rax
+	movzbl -57(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $635, %eax
+	movq %rax, %r9
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movq -88(%rbp), %rax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movq %rax, %rdx
+	movl $617, %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rdx
+	movl -100(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movswl -26(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	jmp .L223
+.L225:
+	movl -12(%rbp), %eax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl $206, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movslq -32(%rbp), %rax
+	movq %rax, %rsi
+	movq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpw $0, -26(%rbp)
+	je .L231
+	cmpb $0, -57(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L232
+.L231:
+	movl $0, %eax
+.L232:
+	popq %rcx
+	addl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	jmp .L223
+.L226:
+	movq $0, -24(%rbp)
+	movl -32(%rbp), %eax
+	addl -76(%rbp), %eax
+	subl $6, %eax
+	movl %eax, -152(%rbp)
+	cmpq $17, -24(%rbp)
+	jge .L223
+	.p2align 4,,10
+.L233:
+	movslq -76(%rbp), %rax
+	movw %ax, -26(%rbp)
+	movl -152(%rbp), %eax
+	movw %ax, 16(%rbp)
+	movl $1640837796, %eax
+	movq %rax, %r9
+	movl -112(%rbp), %eax
+	movq %rax, %r8
+	movl -12(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movabsq $925837531770, %rax
+	movq %rax, %rsi
+	movl -12(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	je .L235
+.L234:
+	jmp .L223
+.L235:
+.L236:
+	addq $1, -24(%rbp)
+	cmpq $17, -24(%rbp)
+	jl .L233
+	jmp .L223
+.L227:
+	jmp .L223
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L230:
+	.long .L224-.L230
+	.long .L228-.L230
+	.long .L224-.L230
+	.long .L223-.L230
+	.long .L223-.L230
+	.long .L223-.L230
+	.long .L225-.L230
+	.long .L226-.L230
+	.long .L223-.L230
+	.long .L227-.L230
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
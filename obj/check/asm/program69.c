@@ -0,0 +1,374 @@
+char g0 = 2;
+unsigned int f0(unsigned char p0, unsigned short p1, unsigned int p2, int p3, long p4, short p5) {
+    int v0 = 2;
+    int v1 = 127;
+    int v2 = 4L;
+    int i0 = 10;
+    long j0 = 32767;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 167; }
+    p1 = !(la1[2]);
+    if ((((short)(653L) && (p1 - 2)) - (la0[11] != (p2 + p5)))) {
+        v1 = (short)((6 < p5));
+        p2 = la0[0];
+        if ((v1 / (p2 * p2 + 1))) { return (unsigned long)((int)(128)); }
+    } else {
+        for (v2 = 0; v2 < 17; v2 = v2 + 1) {
+            switch ((881 || (i0 + 847))) {
+            case -5:
+                j0 = ((!(v1) || (short)(120)) > (v2 - (4 || 926)));
+                v1 = -((!(5) == (32767 < 0)));
+                break;
+            case 52:
+                p1 = p1 + ((4 + 343115606565) > (p2 >= 471));
+                if (((871480683091U || 0) < la1[1])) { break; }
+            case 550:
+            case 0:
+                if ((124 - la0[6])) { break; }
+                if (((9 + p0) > (int)(980))) { break; }
+                break;
+            case 9:
+                p1 = (849659176828 - la0[7]);
+                if (373) { break; }
+                break;
+            default:
+                break;
+            }
+            v0 = (p4 && ((588 == la1[0]) < (p1 || p5)));
+        }
+        if (!((la0[2] / 4))) { return 5; }
+        if ((807 >= (short)(10))) { return (long)((j0 + v1)); }
+    }
+    for (v0 = 0; v0 < 33; v0 = v0 + 1) {
+        if (9) {
+            p4 = 0;
+            while (p4 < 17) {
+                if (!((4 - i0))) { break; }
+                if (v2) { break; }
+                if (!(p1)) { break; }
+                p4 = p4 + 1;
+            }
+        } else {
+            p5 = (((short)(7) > 6) + la1[0]);
+            if (323) {
+                v2 = !(la1[2]);
+            }
+        }
+    }
+    p3 = 0;
+    while (p3 < 5) {
+        v1 = (!(p1) == (294755547938 * la1[2]));
+        switch ((-(la0[14]) * v1)) {
+        case 36:
+            p4 = ((char)((g0 == 4)) + (0 == 282));
+            if ((la0[13] / 1024)) {
+                la0[8] = p3;
+            }
+        case 70:
+            break;
+        case 21:
+            break;
+        case 3:
+            if (g0 >= 0 && g0 < 16) { la0[g0] = p2; }
+            p4 = (unsigned int)(!(6U));
+            break;
+        case 628:
+        }
+        v0 = 448;
+        p3 = p3 + 1;
+    }
+    if (j0 >= 0 && j0 < 4) { la1[j0] = ((v2 && 456) && (unsigned short)(10)); }
+    v0 = !(((unsigned short)(9) + (606 == 1)));
+    v0 = p1;
+    switch (4294967295) {
+    case 487:
+        break;
+    case 47:
+        p5 = (-((26 == p2)) < (unsigned short)((256U || 284)));
+        v2 = 128;
+        break;
+    default:
+        j0 = (31 == (!(v0) > 256));
+        break;
+    case 24:
+        j0 = 6;
+        switch ((5 / (j0 * j0 + 1))) {
+        default:
+            if (((1 * p3) <= p5)) { return (86 / 3); }
+            if (10U) { return (5 / 1); }
+            break;
+        case -3:
+            for (v0 = 0; v0 < 17; v0 = v0 + 1) {
+                if (v2) { break; }
+                if (v2) { return ((v1 <= 617) >= v0); }
+            }
+        case 703:
+            break;
+        }
+        break;
+    }
+    return ((long)(p1) >= ((256 - 10) > (p2 / (g0 * g0 + 1))));
+}
+unsigned short f1(unsigned long p0, long p1) {
+    unsigned int v0 = 8;
+    unsigned char v1 = 3;
+    int i0 = 128;
+    long j0 = 223864729188;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 645; }
+    v0 = 0;
+    while (v0 < 100) {
+        v1 = (unsigned int)(i0);
+        v0 = v0 + 1;
+    }
+    j0 = (unsigned short)((unsigned long)(7));
+    for (v0 = 0; v0 < 5; v0 = v0 + 1) {
+        v1 = 624U;
+        if ((short)((568 + v1))) { return 32767; }
+        p1 = 0;
+        while (p1 < 33) {
+            if ((i0 + ((char)(v0) && (char)(p1)))) {
+                if (v0) { break; }
+                if ((la0[1] < la0[1])) { return f0(612, la0[0], 608600893020L, v1, v0, 422); }
+            }
+            p0 = (p1 > (la0[1] - (7 - 5u)));
+            p1 = p1 + 1;
+        }
+    }
+    i0 = !(g0);
+    switch ((f0(916, 65535, v0, 526ul, la0[3], 2u) == (la0[3] == 4))) {
+    default:
+        for (j0 = 1; j0 < 100; j0 = j0 + 1) {
+            if (g0) {
+                if (f0(v0, 6, 919, 6ul, 3, p0)) { break; }
+                v1 = -(v1);
+            } else {
+                p0 = p1;
+                v0 = la0[0];
+                p0 = (((5 / (v1 * v1 + 1)) && (short)(786)) - v1);
+            }
+        }
+        break;
+    case 3:
+        j0 = (p0 + (la0[1] != (80426167816 <= 3)));
+        p0 = -(((127 == i0) || (g0 + g0)));
+        break;
+    case 5:
+        j0 = (((i0 == la0[3]) * (i0 != i0)) || ((32767 + g0) + (v0 && 827)));
+        f0((p1 >= g0), -(la0[1]), (65536 == 10), !(v0), !(p0), la0[2]);
+        break;
+    case 8:
+        break;
+    case 0:
+        break;
+    }
+    if (((la0[1] - -(327288816591)) >= (v1 + 2))) {
+        if (j0) {
+            j0 = (p1 < 586);
+        }
+        for (p1 = 1; p1 < 4; p1 = p1 + 1) {
+            if (!(la0[3])) { break; }
+        }
+    }
+    for (v0 = 1; v0 < 100; v0 = v0 + 1) {
+        v1 = -((char)((10 / 1)));
+        if (((p0 - g0) != (unsigned short)(!(6)))) {
+            if ((((i0 < j0) * (int)(v0)) / 13ul)) {
+                v1 = g0;
+                if (f0(4, j0, 10l, 385, 406, 1)) { break; }
+            } else {
+                i0 = (((unsigned long)(v0) <= (unsigned char)(p0)) - ((332 <= g0) <= 611));
+            }
+            p0 = p0 + (j0 - (la0[3] / 2));
+            if (p1 >= 0 && p1 < 4) { la0[p1] = (unsigned char)(0); }
+        } else {
+            if (0) { break; }
+            j0 = 10;
+            for (p0 = 0; p0 < 16; p0 = p0 + 1) {
+                if (((10 - g0) <= (j0 < g0))) { break; }
+                j0 = (unsigned char)(10);
+            }
+        }
+        p1 = p1 + (-(2147483647) / (v1 * v1 + 1));
+    }
+    return (((v1 != i0) == la0[1]) <= (v1 - 5));
+}
+void w1(short q0, short q1, unsigned long q2) {
+    g0 = g0 * 3 + q2;
+}
+int main() {
+    long v0 = 6;
+    char v1 = 768;
+    int v2 = 753;
+    int i0 = 707;
+    long j0 = 10;
+    if (!((2 || 4))) {
+        f0((g0 > v2), 986678266725, 7, -(543), 613, (int)(i0));
+        if ((-(4294967295) && v0)) {
+            if (!(f1(10L, 555))) {
+                w1(3, g0, 24);
+            }
+        }
+        w1(j0, 48, g0);
+    } else {
+        for (i0 = 1; i0 < 5; i0 = i0 + 1) {
+            v2 = v2 + (f0(127, v0, 1000000007, v2, v1, 898) + g0);
+            v0 = 0;
+            while (v0 < 4) {
+                j0 = f0((635 - v1), (g0 / (v2 * v2 + 1)), (859 < v0), (g0 && 1), 8, i0);
+                if (((v2 / (i0 * i0 + 1)) - 879)) { break; }
+                if (-(-(9))) { break; }
+                v0 = v0 + 1;
+            }
+        }
+        v0 = (862L == f0(j0, 78, 6, v1, 10u, 6U));
+    }
+    for (i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (1 != f1(2, 339215620667));
+        v0 = (0 * ((j0 || 4ul) - (j0 / 1)));
+    }
+    switch (((522 / 13ul) - 1)) {
+    case 722:
+        break;
+    case 801:
+        break;
+    case 40:
+        switch ((f0(448, 711l, 1000000007, j0, v2, v1) / (v1 * v1 + 1))) {
+        default:
+        case 320:
+            break;
+        }
+        for (i0 = 2; i0 < 17; i0 = i0 + 1) {
+            if (3) { break; }
+            if (((long)((4 / 5l)) / 2)) {
+                if ((2147483647 >= 721)) { break; }
+            }
+            j0 = 0;
+            while (j0 < 33) {
+                if (f1(256, 467014225750)) { break; }
+                j0 = j0 + 1;
+            }
+        }
+    default:
+        if (4) {
+            f1(i0, v2);
+        } else {
+            w1(4, 9, 4);
+            v2 = 0;
+            while (v2 < 16) {
+                j0 = ((f1(24, 3) <= (8 + 8)) * (325 >= j0));
+                if (i0) { break; }
+                i0 = ((6 > 0) + !(f0(131636228681, g0, 256, j0, 140705556381, v1)));
+                v2 = v2 + 1;
+            }
+        }
+        break;
+    case 50:
+        if ((g0 / 1024)) { return -((unsigned int)(v2)); }
+        f0((g0 > 997), !(1000000007), i0, (g0 + 265), !(v0), (v1 >= j0));
+    case 748:
+        break;
+    case 68:
+        j0 = 0;
+        while (j0 < 4) {
+            switch (-((unsigned long)(g0))) {
+            case 1:
+                g0 = !(!(v0));
+                break;
+            case 6:
+                i0 = f0((unsigned int)(438607974333), -(v1), (8 < 5), (127 <= i0), f0(2147483647, v0, v0, v0, j0, v2), f1(v1, 2));
+                if ((3 > g0)) { break; }
+                break;
+            case 4:
+                if (((v1 - v2) / (g0 * g0 + 1))) { break; }
+                v0 = (((v1 == 4294967295) / (j0 * j0 + 1)) > (v0 || f1(141, v0)));
+                break;
+            default:
+                if (((unsigned int)(v2) || 2)) { break; }
+                if (v1) { break; }
+            }
+            for (v0 = 0; v0 < 17; v0 = v0 + 1) {
+                v2 = v2 + 2;
+                if (1000000007) { break; }
+                v2 = v2 + j0;
+            }
+            j0 = j0 + 1;
+        }
+        i0 = (-(f1(6, v0)) - (v0 + v0));
+    case 674:
+        w1(v1, i0, 4);
+        break;
+    }
+    if (!(((v0 / 5l) + (i0 != v1)))) {
+        if ((-(v2) && (8ul + 216U))) { return (g0 - g0); }
+    } else {
+        if (1) {
+            switch ((2U - (unsigned int)(7))) {
+            case 973:
+                i0 = ((202 == i0) < ((v0 + i0) != (1 - v0)));
+                w1(6, 135, 415);
+            case 379:
+                w1(534, 138, 127);
+                break;
+            case -4:
+                w1(502, v1, 8);
+                w1(7l, 657, 375);
+            case 41:
+                w1(1080245549801, 2, 329703280639);
+                break;
+            case 653:
+                i0 = (7ul > (v0 || 707));
+                w1(v2, v2, v0);
+                break;
+            case 1:
+                break;
+            case 36:
+            default:
+                break;
+            }
+            f0(v2, (491078707061 && 3), !(v1), (3 && v0), (long)(g0), (362ul / 10));
+            g0 = g0 + !((127 || v0));
+        } else {
+            w1(j0, g0, v2);
+            v1 = (f0(g0, 3, 408, 1, 3ul, g0) < ((7 == 363005803365ul) && 255));
+            v2 = 5;
+        }
+    }
+    if ((!((unsigned char)(8)) + ((v2 <= j0) > (759 / (g0 * g0 + 1))))) {
+        for (v2 = 2; v2 < 4; v2 = v2 + 1) {
+            if (((392l && j0) / 4)) {
+                if (((259 > v0) < j0)) { break; }
+            }
+            i0 = i0;
+        }
+    }
+    v0 = 4;
+    j0 = j0 + (32767 > (j0 - 5));
+    switch (((v1 / (v0 * v0 + 1)) - f0(i0, i0, 5, 71, v0, 7ul))) {
+    default:
+        break;
+    case 4:
+        break;
+    case 7:
+        g0 = ((unsigned char)((unsigned long)(413ul)) && (v1 / 100));
+        v2 = v0;
+    case 0:
+        g0 = g0 + (9 - f1(1, 670));
+        for (v0 = 2; v0 < 100; v0 = v0 + 1) {
+            v1 = (!((g0 < v1)) > (699415659432 / (j0 * j0 + 1)));
+            v1 = v0;
+        }
+        break;
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2489 @@
+	.section .data
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.byte 2
+	.section .text
+	.type f0.constprop.0, @function
+	.type f0, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $176, %rsp
+	movw %di, -2(%rbp)
+	movl %esi, -8(%rbp)
+	movl %edx, -12(%rbp)
+	movq %rcx, -24(%rbp)
+	movw %r8w, -26(%rbp)
+	movl $2, -32(%rbp)
+	movl $127, -36(%rbp)
+	movl $4, -40(%rbp)
+	movl $10, -44(%rbp)
+	movq $32767, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -136(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -44(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L4
+.L5:
+	movl $0, -44(%rbp)
+	movl $0, -160(%rbp)
+	movl $167, -156(%rbp)
+	movl $334, -152(%rbp)
+	movl $501, -148(%rbp)
+	movl $4, -44(%rbp)
+	movl -152(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	movswl -26(%rbp), %eax
+	addl -8(%rbp), %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	subl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	je .L6
+	movswl -26(%rbp), %eax
+	cmpl $6, %eax
+	setg %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movl %eax, -36(%rbp)
+	movl -128(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .LB0
+.L8:
+.L9:
+.L7:
+	movl $0, -32(%rbp)
+	movl $4, %eax
+	subl -44(%rbp), %eax
+	movl %eax, -168(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L32
+	.p2align 4,,10
+.L31:
+	movq $0, -24(%rbp)
+	movl -168(%rbp), %eax
+	movl %eax, -172(%rbp)
+	cmpq $17, -24(%rbp)
+	jge .L34
+	.p2align 4,,10
+.L33:
+	cmpl $0, -172(%rbp)
+	jne .L35
+.L34:
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L31
+.L32:
+	movl $0, -12(%rbp)
+	cmpl $5, -12(%rbp)
+	jge .L42
+	.p2align 4,,10
+.L41:
+	movl -152(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $294755547938, %rax
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	cmpw $0, -2(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	xorl %eax, %eax
+	movl -72(%rbp), %ecx
+	subl %ecx, %eax
+	imull -36(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $36, %rax
+	jge .L49
+	cmpq $3, %rax
+	je .L47
+	cmpq $21, %rax
+	je .L43
+	jmp .L43
+.L35:
+.L36:
+	cmpl $0, -40(%rbp)
+	je .L37
+	jmp .L34
+.L49:
+	cmpq $36, %rax
+	je .L44
+	cmpq $70, %rax
+	je .L45
+	cmpq $628, %rax
+	je .L48
+	jmp .L43
+.L44:
+	movsbl g0(%rip), %eax
+	cmpl $4, %eax
+	sete %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -76(%rbp), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L50
+	movl -12(%rbp), %eax
+	movl %eax, -96(%rbp)
+.L50:
+.L51:
+.L45:
+.L48:
+.L43:
+	movl $448, -32(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $5, -12(%rbp)
+	jl .L41
+.L42:
+	cmpq $0, -56(%rbp)
+	jl .L54
+	cmpq $4, -56(%rbp)
+	jge .L54
+	cmpl $0, -40(%rbp)
+	je .L56
+	movl $456, %eax
+	testl %eax, %eax
+	je .L56
+	movl $10, %eax
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L57
+.L37:
+.L38:
+	cmpw $0, -2(%rbp)
+	jne .L39
+	jmp .L34
+.L47:
+	movsbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L52
+	movsbl g0(%rip), %eax
+	cmpl $16, %eax
+	jge .L52
+	movl -8(%rbp), %eax
+	movq %rax, %rcx
+	movsbq g0(%rip), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+.L52:
+.L53:
+	movq $0, -24(%rbp)
+	jmp .L43
+.L39:
+.L40:
+	addq $1, -24(%rbp)
+	cmpq $17, -24(%rbp)
+	jl .L33
+	jmp .L34
+.L56:
+	movl $0, %eax
+.L57:
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+.L54:
+.L55:
+	movl $0, -32(%rbp)
+	movzwl -2(%rbp), %eax
+	movl %eax, -32(%rbp)
+	movl $4294967295, %eax
+	cmpq $24, %rax
+	je .L62
+	cmpq $47, %rax
+	je .L60
+	cmpq $487, %rax
+	je .L58
+.L61:
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $256, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl $31, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	jmp .L58
+.L46:
+	jmp .L43
+.L6:
+	movl $0, -40(%rbp)
+	cmpl $471, -8(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $343115606569, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -164(%rbp)
+	cmpl $17, -40(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $9, %rax
+	jge .L18
+	cmpq $-5, %rax
+	je .L13
+	cmpq $0, %rax
+	je .L15
+.L17:
+	jmp .L12
+.L18:
+	cmpq $9, %rax
+	je .L16
+	cmpq $52, %rax
+	je .L14
+	cmpq $550, %rax
+	je .L15
+	jmp .L12
+.L13:
+	movl -40(%rbp), %eax
+	subl $1, %eax
+	pushq %rax
+	cmpl $0, -36(%rbp)
+	je .L19
+	movl $120, %eax
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L20
+.L19:
+	movl $1, %eax
+.L20:
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	movl $-1, -36(%rbp)
+.L12:
+	cmpq $0, -24(%rbp)
+	je .L25
+	cmpw $0, -2(%rbp)
+	jne .L27
+	cmpw $0, -26(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L28
+.L27:
+	movl $1, %eax
+.L28:
+	movq %rax, %rcx
+	movl -160(%rbp), %eax
+	cmpl $588, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .L26
+.L16:
+	movl -100(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $849659176828, %rax
+	subq %rcx, %rax
+	movw %ax, -2(%rbp)
+	jmp .L12
+.L21:
+.L22:
+.L15:
+	movl $124, %eax
+	movl -104(%rbp), %ecx
+	subl %ecx, %eax
+	je .L12
+	jmp .L12
+.L60:
+	xorl %eax, %eax
+	cmpl $26, -8(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	cmpl $1, %eax
+	setl %al
+	movzbl %al, %eax
+	movw %ax, -26(%rbp)
+	movl $128, -40(%rbp)
+	jmp .L58
+.L65:
+	movl $0, -32(%rbp)
+	cmpl $617, -36(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -176(%rbp)
+	cmpl $17, -32(%rbp)
+	jge .L68
+	.p2align 4,,10
+.L67:
+	cmpl $0, -40(%rbp)
+	je .L69
+.L68:
+.L66:
+.L63:
+.L58:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	cmpl $246, %eax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L69:
+.L70:
+	cmpl $0, -40(%rbp)
+	jne .LB1
+.L71:
+.L72:
+	addl $1, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jl .L67
+	jmp .L68
+.L14:
+	movzwl -2(%rbp), %eax
+	addl -164(%rbp), %eax
+	movw %ax, -2(%rbp)
+	movl -156(%rbp), %eax
+	cmpl $1, %eax
+	jle .L21
+	jmp .L12
+.L23:
+.L24:
+	jmp .L12
+.L59:
+	jmp .L58
+.L25:
+	movl $0, %eax
+.L26:
+	movl %eax, -32(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $17, -40(%rbp)
+	jl .L10
+.L11:
+	movl -120(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L29
+	movl $5, %eax
+	jmp .f0.constprop.0_return
+.L62:
+	movq $6, -56(%rbp)
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $5, %eax
+	cqo
+	idivq %rcx
+	cmpq $-3, %rax
+	je .L65
+	cmpq $703, %rax
+	je .L66
+.L64:
+	movl $5, %eax
+	pushq %rax
+	movl $28, %eax
+	movq %rax, %rcx
+	movswl -26(%rbp), %eax
+	cmpl %eax, -12(%rbp)
+	popq %rax
+	cmovlel %ecx, %eax
+	jmp .f0.constprop.0_return
+.LB1:
+	movl -176(%rbp), %eax
+	cmpl -32(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L29:
+.L30:
+	movslq -36(%rbp), %rax
+	addq -56(%rbp), %rax
+	jmp .f0.constprop.0_return
+.LB0:
+	movl $128, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movb %dil, -1(%rbp)
+	movw %si, -4(%rbp)
+	movl %edx, -8(%rbp)
+	movl %ecx, -12(%rbp)
+	movq %r8, -24(%rbp)
+	movw %r9w, -26(%rbp)
+	movl $2, -32(%rbp)
+	movl $127, -36(%rbp)
+	movl $4, -40(%rbp)
+	movl $10, -44(%rbp)
+	movq $32767, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L73
+	movl $16, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L76
+	.p2align 4,,10
+.L75:
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -136(%rbp)
+	jne .L75
+.L76:
+.L73:
+.L74:
+	cmpl $16, -44(%rbp)
+	jge .L78
+	.p2align 4,,10
+.L77:
+	movl -44(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L77
+.L78:
+	movl $0, -44(%rbp)
+	movl $0, -160(%rbp)
+	movl $167, -156(%rbp)
+	movl $334, -152(%rbp)
+	movl $501, -148(%rbp)
+	movl $4, -44(%rbp)
+	movl -152(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	movswl -26(%rbp), %eax
+	addl -8(%rbp), %eax
+	movq %rax, %rcx
+	movl -84(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -4(%rbp), %eax
+	subl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	je .L79
+	movswl -26(%rbp), %eax
+	cmpl $6, %eax
+	setg %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movl %eax, -36(%rbp)
+	movl -128(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	jne .LB2
+.L81:
+.L82:
+.L80:
+	movl $0, -32(%rbp)
+	movl $4, %eax
+	subl -44(%rbp), %eax
+	movl %eax, -188(%rbp)
+	movl $1, -192(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L107
+	.p2align 4,,10
+.L106:
+	movq $0, -24(%rbp)
+	movl -188(%rbp), %eax
+	movl %eax, -196(%rbp)
+	cmpq $17, -24(%rbp)
+	jge .L109
+	.p2align 4,,10
+.L108:
+	cmpl $0, -196(%rbp)
+	jne .L110
+.L109:
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L106
+.L107:
+	movl $0, -12(%rbp)
+	movl $0, -200(%rbp)
+	cmpl $5, -12(%rbp)
+	jge .L117
+	.p2align 4,,10
+.L116:
+	movl -152(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $294755547938, %rax
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	cmpw $0, -4(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	xorl %eax, %eax
+	movl -72(%rbp), %ecx
+	subl %ecx, %eax
+	imull -36(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $36, %rax
+	jge .L124
+	cmpq $3, %rax
+	je .L122
+	cmpq $21, %rax
+	je .L118
+	jmp .L118
+.L110:
+.L111:
+	cmpl $0, -40(%rbp)
+	je .L112
+	jmp .L109
+.L124:
+	cmpq $36, %rax
+	je .L119
+	cmpq $70, %rax
+	je .L120
+	cmpq $628, %rax
+	je .L123
+	jmp .L118
+.L119:
+	movsbl g0(%rip), %eax
+	cmpl $4, %eax
+	sete %al
+	movzbl %al, %eax
+	movsbl %al, %eax
+	addl -200(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movl -76(%rbp), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	je .L125
+	movl -12(%rbp), %eax
+	movl %eax, -96(%rbp)
+.L125:
+.L126:
+.L120:
+.L123:
+.L118:
+	movl $448, -32(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $5, -12(%rbp)
+	jl .L116
+.L117:
+	cmpq $0, -56(%rbp)
+	jl .L129
+	cmpq $4, -56(%rbp)
+	jge .L129
+	cmpl $0, -40(%rbp)
+	je .L131
+	movl $456, %eax
+	testl %eax, %eax
+	je .L131
+	movl $10, %eax
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L132
+.L112:
+.L113:
+	cmpw $0, -4(%rbp)
+	jne .L114
+	jmp .L109
+.L122:
+	movsbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L127
+	movsbl g0(%rip), %eax
+	cmpl $16, %eax
+	jge .L127
+	movl -8(%rbp), %eax
+	movq %rax, %rcx
+	movsbq g0(%rip), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+.L127:
+.L128:
+	movq $0, -24(%rbp)
+	jmp .L118
+.L114:
+.L115:
+	addq $1, -24(%rbp)
+	cmpq $17, -24(%rbp)
+	jl .L108
+	jmp .L109
+.L131:
+	movl $0, %eax
+.L132:
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+.L129:
+.L130:
+	movl $0, -32(%rbp)
+	movzwl -4(%rbp), %eax
+	movl %eax, -32(%rbp)
+	movl $4294967295, %eax
+	cmpq $24, %rax
+	je .L137
+	cmpq $47, %rax
+	je .L135
+	cmpq $487, %rax
+	je .L133
+.L136:
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $256, %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl $31, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	jmp .L133
+.L121:
+	jmp .L118
+.L79:
+	movl $0, -40(%rbp)
+	movl $1, -164(%rbp)
+	movl $1, -168(%rbp)
+	movl $0, -172(%rbp)
+	cmpl $471, -8(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $343115606569, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -176(%rbp)
+	movl $1, -180(%rbp)
+	movzbl -1(%rbp), %eax
+	addl $9, %eax
+	cmpl $980, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -184(%rbp)
+	cmpl $17, -40(%rbp)
+	jge .L84
+	.p2align 4,,10
+.L83:
+	movl -164(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $9, %rax
+	jge .L91
+	cmpq $-5, %rax
+	je .L86
+	cmpq $0, %rax
+	je .L88
+.L90:
+	jmp .L85
+.L91:
+	cmpq $9, %rax
+	je .L89
+	cmpq $52, %rax
+	je .L87
+	cmpq $550, %rax
+	je .L88
+	jmp .L85
+.L86:
+	movl -40(%rbp), %eax
+	subl -168(%rbp), %eax
+	pushq %rax
+	cmpl $0, -36(%rbp)
+	je .L92
+	movl $120, %eax
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L93
+.L92:
+	movl $1, %eax
+.L93:
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	xorl %eax, %eax
+	cmpl $0, -172(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movl %eax, -36(%rbp)
+.L85:
+	cmpq $0, -24(%rbp)
+	je .L100
+	cmpw $0, -4(%rbp)
+	jne .L102
+	cmpw $0, -26(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L103
+.L102:
+	movl $1, %eax
+.L103:
+	movq %rax, %rcx
+	movl -160(%rbp), %eax
+	cmpl $588, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .L101
+.L89:
+	movl -100(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $849659176828, %rax
+	subq %rcx, %rax
+	movw %ax, -4(%rbp)
+	jmp .L85
+.L94:
+.L95:
+.L88:
+	movl $124, %eax
+	movl -104(%rbp), %ecx
+	subl %ecx, %eax
+	je .L96
+	jmp .L85
+.L135:
+	xorl %eax, %eax
+	cmpl $26, -8(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	cmpl $1, %eax
+	setl %al
+	movzbl %al, %eax
+	movw %ax, -26(%rbp)
+	movl $128, -40(%rbp)
+	jmp .L133
+.L140:
+	movl $0, -32(%rbp)
+	cmpl $617, -36(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -204(%rbp)
+	cmpl $17, -32(%rbp)
+	jge .L143
+	.p2align 4,,10
+.L142:
+	cmpl $0, -40(%rbp)
+	je .L144
+.L143:
+.L141:
+.L138:
+.L133:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	cmpl $246, %eax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movzwl -4(%rbp), %eax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L144:
+.L145:
+	cmpl $0, -40(%rbp)
+	jne .LB3
+.L146:
+.L147:
+	addl $1, -32(%rbp)
+	cmpl $17, -32(%rbp)
+	jl .L142
+	jmp .L143
+.L87:
+	movzwl -4(%rbp), %eax
+	addl -176(%rbp), %eax
+	movw %ax, -4(%rbp)
+	movl -156(%rbp), %eax
+	cmpl %eax, -180(%rbp)
+	jge .L94
+	jmp .L85
+.L96:
+.L97:
+	cmpl $0, -184(%rbp)
+	je .L85
+	jmp .L85
+.L134:
+	jmp .L133
+.L98:
+.L99:
+	jmp .L85
+.L100:
+	movl $0, %eax
+.L101:
+	movl %eax, -32(%rbp)
+	addl $1, -40(%rbp)
+	cmpl $17, -40(%rbp)
+	jl .L83
+.L84:
+	movl -120(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L104
+	movl $5, %eax
+	jmp .f0_return
+.L137:
+	movq $6, -56(%rbp)
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $5, %eax
+	cqo
+	idivq %rcx
+	cmpq $-3, %rax
+	je .L140
+	cmpq $703, %rax
+	je .L141
+.L139:
+	movl $5, %eax
+	pushq %rax
+	movl $28, %eax
+	movq %rax, %rcx
+	movswl -26(%rbp), %eax
+	cmpl %eax, -12(%rbp)
+	popq %rax
+	cmovlel %ecx, %eax
+	jmp .f0_return
+.LB3:
+	movl -204(%rbp), %eax
+	cmpl -32(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L104:
+.L105:
+	movslq -36(%rbp), %rax
+	addq -56(%rbp), %rax
+	jmp .f0_return
+.LB2:
+	movl $128, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movl $8, -20(%rbp)
+	movb $3, -21(%rbp)
+	movl $128, -28(%rbp)
+	movabsq $223864729188, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -28(%rbp)
+	movl $0, -64(%rbp)
+	movl $645, -60(%rbp)
+	movl $1290, -56(%rbp)
+	movl $1935, -52(%rbp)
+	movl $4, -28(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $100, -20(%rbp)
+	jae .L148
+	movl $100, %eax
+	movl -20(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -72(%rbp)
+	cmpq $0, -72(%rbp)
+	je .L151
+	.p2align 4,,10
+.L150:
+	movl -28(%rbp), %eax
+	movb %al, -21(%rbp)
+	addl $1, -20(%rbp)
+	movzbl -21(%rbp), %eax
+	movb %al, -21(%rbp)
+	addl $1, -20(%rbp)
+	movzbl -21(%rbp), %eax
+	movb %al, -21(%rbp)
+	addl $1, -20(%rbp)
+	movzbl -21(%rbp), %eax
+	movb %al, -21(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -72(%rbp)
+	jne .L150
+.L151:
+.L148:
+.L149:
+	cmpl $100, -20(%rbp)
+	jae .L153
+	.p2align 4,,10
+.L152:
+	movl -28(%rbp), %eax
+	movb %al, -21(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $100, -20(%rbp)
+	jb .L152
+.L153:
+	movq $7, -40(%rbp)
+	movl $0, -20(%rbp)
+	movl $2, -76(%rbp)
+	cmpl $5, -20(%rbp)
+	jae .L155
+	.p2align 4,,10
+.L154:
+	movb $112, -21(%rbp)
+	movzbl -21(%rbp), %eax
+	movl %eax, -80(%rbp)
+	addl $568, %eax
+	testw %ax, %ax
+	jne .LB4
+.L156:
+.L157:
+	movq $0, -16(%rbp)
+	movl -76(%rbp), %eax
+	movl %eax, -84(%rbp)
+	cmpq $33, -16(%rbp)
+	jge .L159
+	.p2align 4,,10
+.L158:
+	movl -20(%rbp), %eax
+	testb %al, %al
+	je .L162
+	movq -16(%rbp), %rax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L163
+.L162:
+	movl $0, %eax
+.L163:
+	addl -28(%rbp), %eax
+	je .L160
+	cmpl $0, -20(%rbp)
+	je .L164
+.L159:
+	addl $1, -20(%rbp)
+	cmpl $5, -20(%rbp)
+	jb .L154
+.L155:
+	cmpb $0, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	movl -52(%rbp), %eax
+	cmpl $4, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $2, %eax
+	movq %rax, %r9
+	movl -52(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl $526, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	movq %rax, %rdx
+	movl $65535, %eax
+	movq %rax, %rsi
+	movl $148, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $8, %rcx
+	ja .L174
+	leaq .L175(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L169
+	# table target .L173
+	# table target .L170
+	# table target .L171
+	# table target .L172
+	jmp *%rcx
+.L164:
+.L165:
+	movl -60(%rbp), %eax
+	movl -60(%rbp), %ecx
+	cmpl %ecx, %eax
+	jl .LB5
+.L166:
+.L167:
+.L160:
+.L161:
+	movl -60(%rbp), %eax
+	subl -84(%rbp), %eax
+	cmpq %rax, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jl .L158
+	jmp .L159
+.L174:
+.L169:
+	movq $1, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jge .L177
+	.p2align 4,,10
+.L176:
+	cmpb $0, g0(%rip)
+	je .L178
+	movq -8(%rbp), %rax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movl $919, %eax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -20(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	je .L180
+.L177:
+.L168:
+	movzbl -21(%rbp), %eax
+	addl $2, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	movabsq $-327288816591, %rcx
+	subq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	jl .L190
+	movq -40(%rbp), %rax
+	pushq %rax
+	cmpq $586, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $0, -40(%rbp)
+	popq %rax
+	cmovneq %rcx, %rax
+	movq %rax, -40(%rbp)
+	movq $1, -16(%rbp)
+	cmpq $4, -16(%rbp)
+	jge .L193
+	.p2align 4,,10
+.L192:
+	movl -52(%rbp), %eax
+	testl %eax, %eax
+	jne .L194
+.L193:
+.L190:
+.L191:
+	movl $1, -20(%rbp)
+	movl $-10, -92(%rbp)
+	movl $-2147483647, -96(%rbp)
+	cmpl $100, -20(%rbp)
+	jae .L197
+	.p2align 4,,10
+.L196:
+	movl -92(%rbp), %eax
+	movb %al, -21(%rbp)
+	movq -8(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	subq %rcx, %rax
+	je .L198
+	movl -20(%rbp), %eax
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	cmpq -40(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L200
+	movsbl g0(%rip), %eax
+	movb %al, -21(%rbp)
+	movl $1, %eax
+	movq %rax, %r9
+	movl $406, %eax
+	movq %rax, %r8
+	movl $385, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f0
+	testl %eax, %eax
+	je .L201
+	jmp .L197
+.L198:
+	movq $10, -40(%rbp)
+	movq $0, -8(%rbp)
+	cmpq $16, -8(%rbp)
+	jae .L207
+	.p2align 4,,10
+.L206:
+	movsbq g0(%rip), %rax
+	cmpq %rax, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $10, %eax
+	movsbl g0(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jg .L208
+.L207:
+.L199:
+	movzbl -21(%rbp), %eax
+	movl %eax, -100(%rbp)
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $100, -20(%rbp)
+	jb .L196
+.L197:
+	movzbl -21(%rbp), %eax
+	movl %eax, -104(%rbp)
+	subl $5, %eax
+	pushq %rax
+	movl -104(%rbp), %eax
+	cmpl -28(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movl -60(%rbp), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L208:
+.L209:
+	movq $10, -40(%rbp)
+	addq $1, -8(%rbp)
+	cmpq $16, -8(%rbp)
+	jb .L206
+	jmp .L207
+.L200:
+	movsbl g0(%rip), %eax
+	cmpl $332, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpl $611, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -8(%rbp), %rax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	popq %rcx
+	subl %ecx, %eax
+	movl %eax, -28(%rbp)
+.L201:
+	movl -52(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	subq %rcx, %rax
+	addq %rax, -8(%rbp)
+	cmpq $0, -16(%rbp)
+	jl .L199
+	cmpq $4, -16(%rbp)
+	jge .L199
+	movq -16(%rbp), %rax
+	movl $0, -64(%rbp,%rax,4)
+.L204:
+.L205:
+	jmp .L199
+.L202:
+.L203:
+	jmp .L201
+.L194:
+.L195:
+	addq $1, -16(%rbp)
+	cmpq $4, -16(%rbp)
+	jl .L192
+	jmp .L193
+.L178:
+	movq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movl -64(%rbp), %eax
+	movl %eax, -20(%rbp)
+	movzbl -21(%rbp), %eax
+	movl %eax, -88(%rbp)
+	pushq %rax
+	movl -88(%rbp), %eax
+	imull -88(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L182
+	movl $786, %eax
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L183
+.L182:
+	movl $0, %eax
+.L183:
+	popq %rcx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+.L179:
+	addq $1, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jl .L176
+	jmp .L177
+.L180:
+.L181:
+	xorl %eax, %eax
+	movzbl -21(%rbp), %ecx
+	subl %ecx, %eax
+	movb %al, -21(%rbp)
+	jmp .L179
+.L170:
+	movl -60(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq -8(%rbp), %rax
+	movq %rax, -40(%rbp)
+	cmpl $127, -28(%rbp)
+	je .L184
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	addl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L185
+.L184:
+	movl $1, %eax
+.L185:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	jmp .L168
+.L171:
+	movl -28(%rbp), %eax
+	cmpl -28(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	cmpl %eax, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	testl %eax, %eax
+	jne .L186
+	cmpl $0, -20(%rbp)
+	je .L188
+	movl $827, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L189
+.L188:
+	movl $0, %eax
+.L189:
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	addl $32767, %eax
+	addl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L187
+.L186:
+	movl $1, %eax
+.L187:
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movl -56(%rbp), %eax
+	pushq %rax
+	cmpq $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpl $0, -20(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movl -60(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rsi
+	movsbq g0(%rip), %rax
+	cmpq %rax, -16(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	jmp .L168
+.L172:
+	jmp .L168
+.L173:
+	jmp .L168
+.LB5:
+	movl $422, %eax
+	movq %rax, %r8
+	movl -20(%rbp), %eax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	movq %rax, %rdx
+	movl $3010504284, %eax
+	movq %rax, %rsi
+	movl -64(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	jmp .f1_return
+.LB4:
+	movl $32767, %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L175:
+	.long .L173-.L175
+	.long .L169-.L175
+	.long .L169-.L175
+	.long .L170-.L175
+	.long .L169-.L175
+	.long .L171-.L175
+	.long .L169-.L175
+	.long .L169-.L175
+	.long .L172-.L175
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq $6, -40(%rbp)
+	movb $0, -65(%rbp)
+	movl $753, -64(%rbp)
+	movq $10, -32(%rbp)
+	movl $1, -60(%rbp)
+	movsbl -65(%rbp), %eax
+	movl %eax, -52(%rbp)
+	movq %rax, %rcx
+	movl $635, %eax
+	subl %ecx, %eax
+	movl %eax, -56(%rbp)
+	movl $9, -48(%rbp)
+	cmpl $5, -60(%rbp)
+	jge .L211
+	.p2align 4,,10
+.L210:
+	movsbl g0(%rip), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $898, %eax
+	movq %rax, %r9
+	movsbq -65(%rbp), %rax
+	movq %rax, %r8
+	movl -64(%rbp), %eax
+	movq %rax, %rcx
+	movl $1000000007, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $127, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	movq %rax, %rcx
+	movl -64(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -64(%rbp)
+	movq $0, -40(%rbp)
+	movl -56(%rbp), %eax
+	movl %eax, -44(%rbp)
+	movl -64(%rbp), %eax
+	imull -64(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -24(%rbp)
+	movl -60(%rbp), %eax
+	imull -60(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -48(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpq $4, -40(%rbp)
+	jge .L213
+	.p2align 4,,10
+.L212:
+	movl -60(%rbp), %eax
+	pushq %rax
+	movl $8, %eax
+	pushq %rax
+	cmpb $0, g0(%rip)
+	je .L214
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L215
+.L214:
+	movl $0, %eax
+.L215:
+	pushq %rax
+	cmpq $859, -40(%rbp)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movsbl g0(%rip), %eax
+	cltd
+	idivl -24(%rbp)
+	movq %rax, %rsi
+	movl -44(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	movl %eax, %eax
+	movq %rax, -32(%rbp)
+	movl -64(%rbp), %eax
+	cltd
+	idivl -16(%rbp)
+	subl $879, %eax
+	je .L216
+.L213:
+	addl $1, -60(%rbp)
+	cmpl $5, -60(%rbp)
+	jl .L210
+.L211:
+	movl $6, %eax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movl -52(%rbp), %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl $78, %eax
+	movq %rax, %rsi
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	movl %eax, %eax
+	cmpq $862, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq $0, -8(%rbp)
+	movabsq $339215620667, %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movq -8(%rbp), %rax
+	movabsq $339215620667, %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movq -8(%rbp), %rax
+	movabsq $339215620667, %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movq -8(%rbp), %rax
+	movabsq $339215620667, %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movq -8(%rbp), %rax
+	movabsq $339215620667, %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	movq -8(%rbp), %rax
+	movq %rax, -40(%rbp)
+	movl $5, -60(%rbp)
+	movl $39, %eax
+	cmpq $674, %rax
+	jge .L229
+	cmpq $40, %rax
+	je .L223
+	cmpq $50, %rax
+	je .L225
+	cmpq $68, %rax
+	je .L227
+	jmp .L224
+.L216:
+.L217:
+	cmpl $0, -8(%rbp)
+	je .L218
+	jmp .L213
+.L218:
+.L219:
+	addq $1, -40(%rbp)
+	cmpq $4, -40(%rbp)
+	jl .L212
+	jmp .L213
+.L229:
+	cmpq $748, %rax
+	jge .L230
+	cmpq $674, %rax
+	je .L228
+	cmpq $722, %rax
+	je .L220
+	jmp .L224
+.L223:
+	movl -52(%rbp), %eax
+	imull -52(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movsbl -65(%rbp), %eax
+	movq %rax, %r9
+	movslq -64(%rbp), %rax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $1000000007, %eax
+	movq %rax, %rdx
+	movl $711, %eax
+	movq %rax, %rsi
+	movl $192, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movslq %eax, %rax
+	cmpq $320, %rax
+.L232:
+.L231:
+	movl $2, -60(%rbp)
+	cmpl $17, -60(%rbp)
+	.p2align 4,,10
+.L233:
+.L234:
+.L224:
+	movslq -64(%rbp), %rax
+	movq %rax, %rsi
+	movslq -60(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+.L220:
+	movl -60(%rbp), %eax
+	cmpl -52(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	popq %rcx
+	addq %rcx, %rax
+	jne .L258
+	xorl %eax, %eax
+	subl -64(%rbp), %eax
+	je .L259
+	movl $224, %eax
+	testq %rax, %rax
+	jne .LB6
+.L260:
+.L261:
+	jmp .L259
+.L258:
+	movl $4294967291, %eax
+	movslq %eax, %rax
+	cmpq $41, %rax
+	jge .L270
+	cmpq $-4, %rax
+	je .L265
+	cmpq $1, %rax
+	je .L262
+	cmpq $36, %rax
+.L269:
+	jmp .L262
+.L265:
+	movsbl -65(%rbp), %eax
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $8, %rax
+	movb %al, g0(%rip)
+.L274:
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $375, %rax
+	movb %al, g0(%rip)
+.L275:
+.L266:
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	movabsq $329703280639, %rcx
+	addq %rcx, %rax
+	movb %al, g0(%rip)
+.L276:
+.L262:
+	movl $36, %eax
+	movq %rax, %r9
+	movsbq g0(%rip), %rax
+	movq %rax, %r8
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpb $0, -65(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl -64(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movsbl g0(%rip), %eax
+	movb %al, g0(%rip)
+.L259:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $759, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movslq -64(%rbp), %rax
+	cmpq -32(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jle .L280
+	movl $2, -64(%rbp)
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movl %eax, -16(%rbp)
+	cmpq $259, -40(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -32(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -64(%rbp)
+	jge .L283
+	.p2align 4,,10
+.L282:
+	cmpl $0, -16(%rbp)
+	je .L284
+	cmpl $0, -8(%rbp)
+	je .L286
+.L283:
+.L280:
+.L281:
+	movq $4, -40(%rbp)
+	movq -32(%rbp), %rax
+	subq $5, %rax
+	cmpq $32767, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	movl $7, %eax
+	movq %rax, %r9
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movl $71, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl -60(%rbp), %eax
+	movq %rax, %rsi
+	movl -60(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movl %eax, %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movsbq -65(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	je .L292
+	cmpq $4, %rax
+	je .L288
+	cmpq $7, %rax
+	je .L291
+.L289:
+	jmp .L288
+.L286:
+.L287:
+.L284:
+.L285:
+	addl $1, -64(%rbp)
+	cmpl $4, -64(%rbp)
+	jl .L282
+	jmp .L283
+.L291:
+	movsbl -65(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, g0(%rip)
+	movq -40(%rbp), %rax
+	movl %eax, -64(%rbp)
+.L292:
+	movl $670, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f1
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g0(%rip)
+	movq $2, -40(%rbp)
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $100, -40(%rbp)
+	jge .L293
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $100, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L296
+	.p2align 4,,10
+.L295:
+	movabsq $699415659432, %rax
+	cqo
+	idivq -24(%rbp)
+	movq %rax, -8(%rbp)
+	pushq %rax
+	movsbl g0(%rip), %eax
+	movsbl -65(%rbp), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movq -40(%rbp), %rax
+	movb %al, -65(%rbp)
+	addq $1, -40(%rbp)
+	movsbl g0(%rip), %eax
+	movsbl -65(%rbp), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq -8(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	movq -40(%rbp), %rax
+	movb %al, -65(%rbp)
+	addq $1, -40(%rbp)
+	subq $1, -16(%rbp)
+	jne .L295
+.L296:
+.L293:
+.L294:
+	cmpq $100, -40(%rbp)
+	jge .L298
+	.p2align 4,,10
+.L297:
+	movabsq $699415659432, %rax
+	cqo
+	idivq -24(%rbp)
+	pushq %rax
+	movsbl g0(%rip), %eax
+	movsbl -65(%rbp), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movq -40(%rbp), %rax
+	movb %al, -65(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $100, -40(%rbp)
+	jl .L297
+.L298:
+.L288:
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq -65(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -64(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -60(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L290:
+	jmp .L288
+.L270:
+	cmpq $653, %rax
+	jge .L271
+	cmpq $41, %rax
+	je .L266
+	cmpq $379, %rax
+	je .L264
+	jmp .L262
+.L271:
+	cmpq $653, %rax
+	je .L267
+	cmpq $973, %rax
+	je .L263
+	jmp .L262
+.L230:
+	cmpq $748, %rax
+	je .L220
+	cmpq $801, %rax
+	je .L220
+	jmp .L224
+.L225:
+	movsbl g0(%rip), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .LB7
+.L235:
+.L236:
+	movsbq -65(%rbp), %rax
+	cmpq -32(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %r8
+	movsbl g0(%rip), %eax
+	addl $265, %eax
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movsbl g0(%rip), %eax
+	cmpl $997, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+.L226:
+	jmp .L220
+.L263:
+	movl $1, %eax
+	subq -40(%rbp), %rax
+	movq %rax, %rcx
+	movslq -60(%rbp), %rax
+	addq -40(%rbp), %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpl $202, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -60(%rbp)
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $415, %rax
+	movb %al, g0(%rip)
+.L272:
+.L264:
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $127, %rax
+	movb %al, g0(%rip)
+.L273:
+	jmp .L262
+.L267:
+	cmpq $0, -40(%rbp)
+	jne .L277
+	movl $707, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L278
+.L277:
+	movl $1, %eax
+.L278:
+	movslq %eax, %rax
+	cmpq $7, %rax
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -60(%rbp)
+	movl -64(%rbp), %eax
+	movw %ax, -8(%rbp)
+	movswl -8(%rbp), %eax
+	movq -40(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq -8(%rbp), %rax
+	movb %al, g0(%rip)
+.L279:
+	jmp .L262
+.L268:
+	jmp .L262
+.L240:
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movb %al, g0(%rip)
+.L253:
+.L254:
+.L239:
+	movq $0, -40(%rbp)
+	cmpq $17, -40(%rbp)
+	jge .L256
+	.p2align 4,,10
+.L255:
+	addl $2, -64(%rbp)
+.L256:
+	addq $1, -32(%rbp)
+	cmpq $4, -32(%rbp)
+	jl .L237
+.L238:
+	movq -40(%rbp), %rax
+	addq -40(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	subq %rcx, %rax
+	movl %eax, -60(%rbp)
+.L228:
+	movsbl -65(%rbp), %eax
+	movl -60(%rbp), %eax
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $4, %rax
+	movb %al, g0(%rip)
+.L257:
+	jmp .L220
+.L227:
+	movq $0, -32(%rbp)
+	xorl %eax, %eax
+	subl -52(%rbp), %eax
+	movl %eax, -24(%rbp)
+	movl $0, -16(%rbp)
+	movsbq -65(%rbp), %rax
+	movl $4294967295, %ecx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpq $4, -32(%rbp)
+	jge .L238
+	.p2align 4,,10
+.L237:
+	xorl %eax, %eax
+	movsbq g0(%rip), %rcx
+	subq %rcx, %rax
+	cmpq $1, %rax
+	je .L240
+	cmpq $4, %rax
+	je .L242
+	cmpq $6, %rax
+	je .L241
+.L243:
+	movl -64(%rbp), %eax
+	testl %eax, %eax
+	jne .L239
+	movl $2, %eax
+	testl %eax, %eax
+	je .L250
+.L252:
+	jmp .L239
+.L242:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	subl -64(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L246
+	jmp .L239
+.L221:
+	jmp .L220
+.L222:
+	jmp .L220
+.L241:
+	movl $2, %eax
+	movq %rax, %rsi
+	movsbq -65(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	pushq %rax
+	subq $8, %rsp
+	movl -64(%rbp), %eax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $255, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movl %eax, %eax
+	movq %rax, %r8
+	cmpl $127, -60(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	movq %rax, %rdx
+	movl -24(%rbp), %eax
+	movq %rax, %rsi
+	movl $189, %eax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	movl %eax, -60(%rbp)
+	movsbl g0(%rip), %eax
+	cmpl $3, %eax
+	jge .L239
+	jmp .L239
+.L246:
+.L247:
+	cmpq $0, -40(%rbp)
+	jne .L248
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $141, %eax
+	movq %rax, %rdi
+	call f1
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L249
+.L248:
+	movl $1, %eax
+.L249:
+	movslq %eax, %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .L239
+.L244:
+.L245:
+	jmp .L239
+.L250:
+.L251:
+	cmpb $0, -65(%rbp)
+	je .L253
+	jmp .L239
+.LB6:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	subl %ecx, %eax
+	jmp .main_return
+.LB7:
+	movl -64(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,205 @@
+unsigned char g0 = 259;
+int g1 = 986;
+char g2;
+unsigned short f0() {
+    unsigned long v0 = 8;
+    char v1 = 3;
+    unsigned char v2 = 3;
+    int i0 = 910;
+    long j0 = 3;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    v0 = g0;
+    if (44) {
+        v1 = (((unsigned short)(v1) + 5L) < ((8 / 10) - !(399071119056)));
+        v2 = ((j0 + 3) / 13ul);
+    } else {
+        i0 = i0;
+        if (((5 / 2) || (la0[1] * 10))) { return (int)(7); }
+        v2 = (short)((!(762ul) - v2));
+    }
+    v0 = 0;
+    while (v0 < 100) {
+        switch (g0) {
+        case -2:
+            if (i0 >= 0 && i0 < 4) { la0[i0] = (g1 / 1024); }
+            break;
+        case 475:
+            i0 = (!(8) + 5);
+            break;
+        case 2:
+            v2 = (g2 + (unsigned short)(7ul));
+            if (g0 >= 0 && g0 < 4) { la0[g0] = v1; }
+        case -1:
+            break;
+        case 853:
+            v2 = g1;
+            j0 = j0 + 7;
+            break;
+        }
+        i0 = (((8 == la0[2]) / 7) + (g2 - 710));
+        v1 = (unsigned char)(2);
+        v0 = v0 + 1;
+    }
+    for (j0 = 0; j0 < 4; j0 = j0 + 1) {
+        v2 = (((j0 + 128) < !(8)) + -((6 + 1000000007)));
+        v2 = (short)((v0 * -(245)));
+        v0 = 0;
+        while (v0 < 33) {
+            la0[j0] = j0;
+            v0 = v0 + 1;
+        }
+    }
+    if ((((g2 + v2) * 7) + -(977))) {
+        if (v0 >= 0 && v0 < 4) { la0[v0] = (-(2) / (g1 * g1 + 1)); }
+        v0 = 0;
+        while (v0 < 4) {
+            for (i0 = 0; i0 < 17; i0 = i0 + 1) {
+                if (((729692625870 + 128) + (la0[2] || la0[3]))) { break; }
+                if (!(la0[0])) { break; }
+            }
+            v0 = v0 + 1;
+        }
+    }
+    if ((316 + (0 > i0))) {
+        if (i0 >= 0 && i0 < 4) { la0[i0] = ((g1 >= 8) && (v1 - v2)); }
+    } else {
+        if (v2) {
+            la0[0] = (508 + (char)(g2));
+            switch (((6 <= 4) / (i0 * i0 + 1))) {
+            default:
+                if ((i0 / (g1 * g1 + 1))) { return la0[3]; }
+                v1 = 10u;
+                break;
+            case -2:
+                if ((v1 + v0)) { return (la0[1] > 663); }
+                v2 = (la0[2] || !((long)(v1)));
+            case 4:
+                break;
+            case 925:
+                if (((v0 / 4) - (128u && j0))) { return (4 / 8); }
+                break;
+            case 57:
+                break;
+            case 31:
+                if ((v2 == (8 + v1))) { return (unsigned int)((127 * la0[3])); }
+                break;
+            }
+        }
+        switch (-(888)) {
+        case 6:
+            for (i0 = 0; i0 < 5; i0 = i0 + 1) {
+                j0 = (861 / (i0 * i0 + 1));
+            }
+        case 0:
+        default:
+        case 4:
+        }
+        if (693) {
+            for (j0 = 0; j0 < 5; j0 = j0 + 1) {
+                v0 = -(!((j0 + 190U)));
+            }
+            v1 = (i0 <= (1 - 10));
+        } else {
+            v1 = v0;
+            j0 = (-((g0 / (g0 * g0 + 1))) - v0);
+            v2 = (!((177 - 2)) + !((g0 + 10)));
+        }
+    }
+    for (j0 = 0; j0 < 17; j0 = j0 + 1) {
+        v0 = (1 != (i0 || i0));
+        v1 = ((g2 && 310) > (char)((g0 || la0[3])));
+    }
+    return ((v2 < v0) < 1000000007);
+}
+void w0(unsigned short q0, unsigned char q1, unsigned char q2) {
+    g0 = g0 * 3 + q2;
+    g0 = g0 * 3 + q0;
+}
+unsigned long f1(short p0, unsigned char p1, char p2, unsigned int p3, int p4, unsigned long p5) {
+    short v0 = 9;
+    unsigned char v1 = 1;
+    int i0 = 2;
+    long j0 = 655629122397;
+    v0 = (!((i0 * p4)) - ((2 * p5) >= (2 / 5l)));
+    p0 = (f0() != (v1 > 2));
+    if ((6 >= ((unsigned int)(p0) * (5l + 600)))) {
+        p5 = p5 + (v1 - (g2 < i0));
+        i0 = !((unsigned char)((g1 - 2)));
+        p5 = f0();
+    } else {
+        p5 = (!((10 >= p1)) || !(4));
+        p2 = p2 + i0;
+    }
+    return !(((65536 - i0) != (unsigned int)(0l)));
+}
+void w1(unsigned char q0, long q1, char q2) {
+    g0 = g0 * 3 + q2;
+    g2 = g2 * 3 + q1;
+}
+unsigned int rec(unsigned int n, unsigned int acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 1, acc + 1) + rec(n - 2, acc);
+}
+int main() {
+    long v0 = 32767;
+    unsigned long v1 = 7;
+    unsigned int v2 = 597233243733;
+    unsigned long v3 = 539;
+    int i0 = 9;
+    long j0 = 707;
+    if (!((short)((0 / (g1 * g1 + 1))))) {
+        if (rec(v0, g2)) { return !((v1 / (v1 * v1 + 1))); }
+    } else {
+        w1(v2, 3, 5);
+        if ((rec(3, g1) || j0)) {
+            w1(g0, v2, 7);
+            g2 = 10;
+            g2 = (444 / 16);
+        } else {
+            for (v2 = 0; v2 < 4; v2 = v2 + 1) {
+                if (v2) { break; }
+                g2 = g2 + g2;
+                g1 = rec((g2 >= 10), (j0 + 1090808371092));
+            }
+            g2 = (f1(v1, 0ul, g0, g0, v3, i0) + 924);
+        }
+    }
+    v0 = g2;
+    g1 = 1;
+    switch (v3) {
+    case 10:
+        break;
+    case 9:
+        g0 = (unsigned int)(((i0 - j0) + 0));
+        break;
+    }
+    if (v3) {
+        if (((f0() + 306) - j0)) {
+            j0 = j0 + v2;
+            if (j0) {
+                w0(7l, j0, v0);
+                j0 = f1(-(9), (7 >= 578), (g1 - 10), 10, 62, -(650));
+                v3 = (((591 - g1) > 6) && g2);
+            } else {
+                v1 = (6 < (7 / (g1 * g1 + 1)));
+                f1((g1 || v2), i0, v0, (799 < i0), (v1 || 9), 1);
+                w0(547695963887, 10, 1997460394);
+            }
+        }
+    }
+    i0 = i0 + !((v2 / 8));
+    g2 = 838958781384;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
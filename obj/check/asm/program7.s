@@ -0,0 +1,1974 @@
+	.section .data
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.byte 3
+	.type g1, @object
+	.size g1, 4
+	.p2align 2
+g1:
+	.long 986
+	.section .bss
+	.type g2, @object
+	.size g2, 1
+	.p2align 0
+g2:
+	.zero 1
+	.section .text
+	.type rec, @function
+	.type f1.constprop.2, @function
+	.type f1.constprop.3, @function
+	.type f0, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	cmpl $5, %edi
+	jb .L2
+	cmpl $18, %edi
+	ja .L2
+.L0:
+.L1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movl %edi, -32(%rbp)
+	movl %esi, -28(%rbp)
+	movl %edi, %eax
+	subl $2, %eax
+	movl %eax, -24(%rbp)
+	movl %esi, %eax
+	movl %eax, -20(%rbp)
+	cmpl $5, -24(%rbp)
+	jb .L6
+	cmpl $18, -24(%rbp)
+	jbe .L4
+.L6:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L3:
+	pushq %rax
+	movl -32(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -24(%rbp)
+	movl -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -20(%rbp)
+	cmpl $5, -24(%rbp)
+	jb .L34
+	cmpl $18, -24(%rbp)
+	jbe .L32
+.L34:
+	movl -20(%rbp), %eax
+	addl -24(%rbp), %eax
+.L31:
+	popq %rcx
+	addl %ecx, %eax
+	leave
+	ret
+.L4:
+.L5:
+	movl -24(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L10
+	cmpl $18, -16(%rbp)
+	jbe .L8
+.L10:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L7:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L22
+	cmpl $18, -16(%rbp)
+	jbe .L20
+.L22:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L19:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L3
+.L32:
+.L33:
+	movl -24(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L38
+	cmpl $18, -16(%rbp)
+	jbe .L36
+.L38:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L35:
+	pushq %rax
+	movl -24(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L50
+	cmpl $18, -16(%rbp)
+	jbe .L48
+.L50:
+	movl -12(%rbp), %eax
+	addl -16(%rbp), %eax
+.L47:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L31
+.L8:
+.L9:
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L14
+	cmpl $18, -8(%rbp)
+	jbe .L12
+.L14:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L11:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L18
+	cmpl $18, -8(%rbp)
+	jbe .L16
+.L18:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L15:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L7
+.L20:
+.L21:
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L26
+	cmpl $18, -8(%rbp)
+	jbe .L24
+.L26:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L23:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L30
+	cmpl $18, -8(%rbp)
+	jbe .L28
+.L30:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L27:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L19
+.L36:
+.L37:
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L42
+	cmpl $18, -8(%rbp)
+	jbe .L40
+.L42:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L39:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L46
+	cmpl $18, -8(%rbp)
+	jbe .L44
+.L46:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L43:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L35
+.L48:
+.L49:
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -4(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L54
+	cmpl $18, -8(%rbp)
+	jbe .L52
+.L54:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L51:
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	movl -12(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $5, -8(%rbp)
+	jb .L58
+	cmpl $18, -8(%rbp)
+	jbe .L56
+.L58:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+.L55:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L47
+.L12:
+.L13:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L11
+.L16:
+.L17:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L15
+.L24:
+.L25:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L23
+.L28:
+.L29:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L27
+.L40:
+.L41:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L39
+.L44:
+.L45:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L43
+.L52:
+.L53:
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L51
+.L56:
+.L57:
+	subq $8, %rsp
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L55
+.L2:
+	movl %esi, %eax
+	addl %edi, %eax
+	ret
+	.size rec, .-rec
+	.align 16
+f1.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movb %sil, -21(%rbp)
+	movl %ecx, -20(%rbp)
+	movq %r8, -8(%rbp)
+	movb $1, -12(%rbp)
+	movl $2, -16(%rbp)
+	movabsq $655629122397, %rax
+	imulq $2, %r8, %rax
+	testq %rax, %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	imull -20(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movzbl -12(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -20(%rbp)
+	movswl -20(%rbp), %eax
+	imulq $605, %rax, %rax
+	cmpq $6, %rax
+	jg .L59
+	movsbl g2(%rip), %eax
+	cmpl -16(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq %rax, -8(%rbp)
+	movl g1(%rip), %eax
+	subl $2, %eax
+	testb %al, %al
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	call f0
+	movzwl %ax, %eax
+	jmp .L60
+.L59:
+	movsbl -21(%rbp), %eax
+	addl -16(%rbp), %eax
+.L60:
+	movl $65536, %eax
+	subl -16(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leave
+	ret
+	.size f1.constprop.2, .-f1.constprop.2
+	.align 16
+f1.constprop.3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movb %sil, -19(%rbp)
+	movq %rdx, -8(%rbp)
+	movb $1, -12(%rbp)
+	movl $2, -16(%rbp)
+	movabsq $655629122397, %rax
+	imulq $2, %rdx, %rax
+	testq %rax, %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	imull $62, -16(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movzbl -12(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -18(%rbp)
+	movswl -18(%rbp), %eax
+	imulq $605, %rax, %rax
+	cmpq $6, %rax
+	jg .L61
+	movsbl g2(%rip), %eax
+	cmpl -16(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq %rax, -8(%rbp)
+	movl g1(%rip), %eax
+	subl $2, %eax
+	testb %al, %al
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	call f0
+	movzwl %ax, %eax
+	jmp .L62
+.L61:
+	movsbl -19(%rbp), %eax
+	addl -16(%rbp), %eax
+.L62:
+	movl $65536, %eax
+	subl -16(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leave
+	ret
+	.size f1.constprop.3, .-f1.constprop.3
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq $8, -8(%rbp)
+	movb $3, -9(%rbp)
+	movb $3, -10(%rbp)
+	movl $910, -16(%rbp)
+	movq $3, -24(%rbp)
+	movl $0, -16(%rbp)
+	movl $0, -48(%rbp)
+	movl $10, -44(%rbp)
+	movl $20, -40(%rbp)
+	movl $30, -36(%rbp)
+	movl $4, -16(%rbp)
+	movzbl g0(%rip), %eax
+	movq %rax, -8(%rbp)
+	movsbl -9(%rbp), %eax
+	movzwl %ax, %eax
+	addq $5, %rax
+	testq %rax, %rax
+	setl %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	movq -24(%rbp), %rax
+	addq $3, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movb %al, -10(%rbp)
+	movq $0, -8(%rbp)
+	cmpq $100, -8(%rbp)
+	jae .L64
+	.p2align 4,,10
+.L63:
+	movzbl g0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	jge .L71
+	cmpq $-2, %rax
+	je .L66
+	cmpq $-1, %rax
+	je .L69
+	jmp .L65
+.L71:
+	cmpq $2, %rax
+	je .L68
+	cmpq $475, %rax
+	je .L67
+	cmpq $853, %rax
+	je .L70
+	jmp .L65
+.L68:
+	movsbl g2(%rip), %eax
+	addl $7, %eax
+	movb %al, -10(%rbp)
+	movzbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L74
+	movzbl g0(%rip), %eax
+	cmpl $4, %eax
+	jge .L74
+	movzbl g0(%rip), %eax
+	movsbl -9(%rbp), %ecx
+	movl %ecx, -48(%rbp,%rax,4)
+.L74:
+.L75:
+.L69:
+.L65:
+	movsbl g2(%rip), %eax
+	subl $710, %eax
+	pushq %rax
+	movl -40(%rbp), %eax
+	cmpl $8, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	addl %ecx, %eax
+	movl %eax, -16(%rbp)
+	movb $2, -9(%rbp)
+	addq $1, -8(%rbp)
+	cmpq $100, -8(%rbp)
+	jb .L63
+.L64:
+	movq $0, -24(%rbp)
+	movl $-1000000013, -52(%rbp)
+	movl $-245, -56(%rbp)
+	cmpq $4, -24(%rbp)
+	jge .L77
+	.p2align 4,,10
+.L76:
+	movq -24(%rbp), %rax
+	addq $128, %rax
+	testq %rax, %rax
+	setl %al
+	movzbl %al, %eax
+	addl -52(%rbp), %eax
+	movb %al, -10(%rbp)
+	movslq -56(%rbp), %rax
+	imulq -8(%rbp), %rax
+	movb %al, -10(%rbp)
+	movq $0, -8(%rbp)
+	cmpq $33, -8(%rbp)
+	jae .L78
+	movl $33, %eax
+	subq -8(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -64(%rbp)
+	cmpq $0, -64(%rbp)
+	je .L81
+	.p2align 4,,10
+.L80:
+	movq -24(%rbp), %rax
+	movl %eax, -68(%rbp)
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+	addq $1, -8(%rbp)
+	movq -24(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -48(%rbp,%rax,4)
+	addq $1, -8(%rbp)
+	movq -24(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -48(%rbp,%rax,4)
+	addq $1, -8(%rbp)
+	movq -24(%rbp), %rax
+	movl -68(%rbp), %ecx
+	movl %ecx, -48(%rbp,%rax,4)
+	addq $1, -8(%rbp)
+	subq $1, -64(%rbp)
+	jne .L80
+.L81:
+.L78:
+.L79:
+	cmpq $33, -8(%rbp)
+	jae .L83
+	.p2align 4,,10
+.L82:
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+	addq $1, -8(%rbp)
+	cmpq $33, -8(%rbp)
+	jb .L82
+.L83:
+	addq $1, -24(%rbp)
+	cmpq $4, -24(%rbp)
+	jl .L76
+.L77:
+	movzbl -10(%rbp), %eax
+	movl %eax, -72(%rbp)
+	movq %rax, %rcx
+	movsbl g2(%rip), %eax
+	addl %ecx, %eax
+	imull $7, %eax, %eax
+	addl $-977, %eax
+	je .L84
+	cmpq $0, -8(%rbp)
+	jb .L86
+	cmpq $4, -8(%rbp)
+	jae .L86
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $-2, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+.L86:
+.L87:
+	movq $0, -8(%rbp)
+	movabsq $729692625998, %rax
+	movq %rax, -80(%rbp)
+	cmpq $4, -8(%rbp)
+	jae .L89
+	.p2align 4,,10
+.L88:
+	movl $0, -16(%rbp)
+	movq -80(%rbp), %rax
+	movq %rax, -88(%rbp)
+	cmpl $17, -16(%rbp)
+	jge .L91
+	.p2align 4,,10
+.L90:
+	movl -40(%rbp), %eax
+	testl %eax, %eax
+	jne .L94
+	movl -36(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L95
+.L94:
+	movl $1, %eax
+.L95:
+	movslq %eax, %rax
+	addq -88(%rbp), %rax
+	je .L92
+.L91:
+	addq $1, -8(%rbp)
+	cmpq $4, -8(%rbp)
+	jb .L88
+.L89:
+.L84:
+.L85:
+	cmpl $0, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	addl $316, %eax
+	je .L98
+	cmpl $0, -16(%rbp)
+	jl .L100
+	cmpl $4, -16(%rbp)
+	jge .L100
+	cmpl $8, g1(%rip)
+	jl .L102
+	movsbl -9(%rbp), %eax
+	subl -72(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L103
+.L92:
+.L93:
+	movl -48(%rbp), %eax
+	testl %eax, %eax
+	jne .L96
+	jmp .L91
+.L96:
+.L97:
+	addl $1, -16(%rbp)
+	cmpl $17, -16(%rbp)
+	jl .L90
+	jmp .L91
+.L66:
+	cmpl $0, -16(%rbp)
+	jl .L65
+	cmpl $4, -16(%rbp)
+	jge .L65
+	movl g1(%rip), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+.L72:
+.L73:
+	jmp .L65
+.L102:
+	movl $0, %eax
+.L103:
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	movl %ecx, -48(%rbp,%rax,4)
+.L100:
+.L101:
+.L99:
+	movq $0, -24(%rbp)
+	cmpl $0, -16(%rbp)
+	jne .L127
+	cmpl $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L128
+.L127:
+	movl $1, %eax
+.L128:
+	cmpl $1, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -92(%rbp)
+	cmpq $17, -24(%rbp)
+	jge .L129
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -104(%rbp)
+	cmpq $0, -104(%rbp)
+	je .L132
+	.p2align 4,,10
+.L131:
+	movslq -92(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpb $0, g0(%rip)
+	jne .L133
+	movl -36(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L134
+.L133:
+	movl $1, %eax
+.L134:
+	movsbl %al, %eax
+	pushq %rax
+	cmpb $0, g2(%rip)
+	je .L135
+	movl $310, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L136
+.L135:
+	movl $0, %eax
+.L136:
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	addq $1, -24(%rbp)
+	movq -8(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpb $0, g0(%rip)
+	jne .L137
+	movl -36(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L138
+.L137:
+	movl $1, %eax
+.L138:
+	movsbl %al, %eax
+	pushq %rax
+	cmpb $0, g2(%rip)
+	je .L139
+	movl $310, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L140
+.L139:
+	movl $0, %eax
+.L140:
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -104(%rbp)
+	jne .L131
+.L132:
+.L129:
+.L130:
+	cmpq $17, -24(%rbp)
+	jge .L142
+	.p2align 4,,10
+.L141:
+	movslq -92(%rbp), %rax
+	movq %rax, -8(%rbp)
+	cmpb $0, g0(%rip)
+	jne .L143
+	movl -36(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L144
+.L143:
+	movl $1, %eax
+.L144:
+	movsbl %al, %eax
+	pushq %rax
+	cmpb $0, g2(%rip)
+	je .L145
+	movl $310, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L146
+.L145:
+	movl $0, %eax
+.L146:
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $17, -24(%rbp)
+	jl .L141
+.L142:
+	movzbl -10(%rbp), %eax
+	cmpq -8(%rbp), %rax
+	setb %al
+	movzbl %al, %eax
+	cmpl $1000000007, %eax
+	setl %al
+	movzbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L98:
+	cmpb $0, -10(%rbp)
+	je .L104
+	movsbl g2(%rip), %eax
+	addl $508, %eax
+	movl %eax, -48(%rbp)
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $31, %rax
+	jge .L113
+	cmpq $-2, %rax
+	je .L108
+	cmpq $4, %rax
+	je .L109
+.L107:
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jne .LB0
+.L114:
+.L115:
+	movb $10, -9(%rbp)
+	jmp .L106
+.L67:
+	movl $5, -16(%rbp)
+	jmp .L65
+.L118:
+	movl $1, %eax
+.L119:
+	movb %al, -10(%rbp)
+.L109:
+.L106:
+.L104:
+.L105:
+	movl $-888, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L126
+	cmpq $4, %rax
+	je .L126
+	cmpq $6, %rax
+	je .L125
+	jmp .L126
+.L125:
+	movl $0, -16(%rbp)
+	movq $861, -24(%rbp)
+	movq $430, -24(%rbp)
+	movq $172, -24(%rbp)
+	movq $86, -24(%rbp)
+	movq $50, -24(%rbp)
+	movl $5, -16(%rbp)
+.L126:
+.L124:
+	movq $0, -24(%rbp)
+	movq $0, -8(%rbp)
+	movq $0, -8(%rbp)
+	movq $0, -8(%rbp)
+	movq $0, -8(%rbp)
+	movq $0, -8(%rbp)
+	movq $5, -24(%rbp)
+	cmpl $-9, -16(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movb %al, -9(%rbp)
+	jmp .L99
+.L70:
+	movl g1(%rip), %eax
+	movb %al, -10(%rbp)
+	addq $7, -24(%rbp)
+	jmp .L65
+.L113:
+	cmpq $31, %rax
+	je .L112
+	cmpq $57, %rax
+	je .L106
+	cmpq $925, %rax
+	je .L110
+	jmp .L107
+.L108:
+	movsbq -9(%rbp), %rax
+	addq -8(%rbp), %rax
+	jne .LB1
+.L116:
+.L117:
+	movl -40(%rbp), %eax
+	testl %eax, %eax
+	jne .L118
+	movsbq -9(%rbp), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	jmp .L119
+.L112:
+	movsbl -9(%rbp), %eax
+	addl $8, %eax
+	movq %rax, %rcx
+	movzbl -10(%rbp), %eax
+	cmpl %ecx, %eax
+	je .LB2
+.L122:
+.L123:
+	jmp .L106
+.L111:
+	jmp .L106
+.L110:
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	shrq $2, %rax
+	subq %rcx, %rax
+	jne .LB3
+.L120:
+.L121:
+	jmp .L106
+.LB1:
+	movl -44(%rbp), %eax
+	cmpl $663, %eax
+	setg %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB2:
+	movl -36(%rbp), %eax
+	imull $127, %eax, %eax
+	jmp .f0_return
+.LB0:
+	movl -36(%rbp), %eax
+	jmp .f0_return
+.LB3:
+	movl $0, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movb %sil, -20(%rbp)
+	movb %dl, -19(%rbp)
+	movq %r9, -8(%rbp)
+	movb $1, -12(%rbp)
+	movl $2, -16(%rbp)
+	movabsq $655629122397, %rax
+	movl $2, %eax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	imulq $2, %r9, %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	imull %r8d, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movzbl -12(%rbp), %eax
+	movl %eax, -12(%rbp)
+	cmpl $2, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -18(%rbp)
+	movl $5, %eax
+	addq $600, %rax
+	movq %rax, %rcx
+	movswl -18(%rbp), %eax
+	imulq %rcx, %rax
+	cmpq $6, %rax
+	jg .L147
+	movsbl g2(%rip), %eax
+	cmpl -16(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq %rax, -8(%rbp)
+	movl g1(%rip), %eax
+	subl $2, %eax
+	testb %al, %al
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -16(%rbp)
+	call f0
+	movzwl %ax, %eax
+	jmp .L148
+.L147:
+	movzbl -20(%rbp), %eax
+	cmpl $10, %eax
+	jg .L149
+	movl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L150
+.L149:
+	movl $1, %eax
+.L150:
+	movslq %eax, %rax
+	movsbl -19(%rbp), %eax
+	addl -16(%rbp), %eax
+.L148:
+	movl $65536, %eax
+	subl -16(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leave
+	ret
+	.size f1, .-f1
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq $32767, -16(%rbp)
+	movq $7, -40(%rbp)
+	movl $232789589, -64(%rbp)
+	movq $539, -32(%rbp)
+	movl $9, -60(%rbp)
+	movq $707, -24(%rbp)
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	cltd
+	idivl %ecx
+	testw %ax, %ax
+	jne .L151
+	movq -16(%rbp), %rax
+	movl %eax, -56(%rbp)
+	movsbl g2(%rip), %eax
+	movl %eax, -52(%rbp)
+	cmpl $5, -56(%rbp)
+	jb .L158
+	cmpl $18, -56(%rbp)
+	jbe .L156
+.L158:
+	movl -52(%rbp), %eax
+	addl -56(%rbp), %eax
+.L155:
+	testl %eax, %eax
+	jne .LB4
+.L153:
+.L154:
+	jmp .L152
+.L151:
+	movl -64(%rbp), %eax
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $5, %eax
+	movb %al, g0(%rip)
+	movsbl g2(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $3, %rax
+	movb %al, g2(%rip)
+.L183:
+	movl g1(%rip), %eax
+	movl %eax, -8(%rbp)
+	movl -8(%rbp), %eax
+	addl $3, %eax
+.L187:
+	testl %eax, %eax
+	jne .L186
+	cmpq $0, -24(%rbp)
+	je .L184
+.L186:
+	movzbl g0(%rip), %eax
+	movl -64(%rbp), %eax
+	movq %rax, -8(%rbp)
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $7, %eax
+	movb %al, g0(%rip)
+	movsbl g2(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq -8(%rbp), %rax
+	movb %al, g2(%rip)
+.L188:
+	movb $10, g2(%rip)
+	movl $444, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movb %al, g2(%rip)
+	jmp .L185
+.L184:
+	movl $0, -64(%rbp)
+	cmpl $4, -64(%rbp)
+	jae .L190
+	.p2align 4,,10
+.L189:
+	cmpl $0, -64(%rbp)
+	je .L191
+.L190:
+	movslq -60(%rbp), %rax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movzbl g0(%rip), %eax
+	movq %rax, %rdx
+	movzbl g0(%rip), %eax
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $924, %rax
+	movb %al, g2(%rip)
+.L185:
+.L152:
+	movsbq g2(%rip), %rax
+	movq %rax, -16(%rbp)
+	movl $1, g1(%rip)
+	movq -32(%rbp), %rax
+	cmpq $9, %rax
+	je .L223
+	cmpq $10, %rax
+	je .L221
+	jmp .L221
+.L223:
+	movslq -60(%rbp), %rax
+	subq -24(%rbp), %rax
+	addq $0, %rax
+	movb %al, g0(%rip)
+.L221:
+	cmpq $0, -32(%rbp)
+	je .L224
+	call f0
+	movzwl %ax, %eax
+	addl $306, %eax
+	movslq %eax, %rax
+	subq -24(%rbp), %rax
+	je .L226
+	movl -64(%rbp), %eax
+	addq %rax, -24(%rbp)
+	je .L228
+	movq -24(%rbp), %rax
+	movq -16(%rbp), %rax
+	movb %al, -8(%rbp)
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movzbl -8(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, g0(%rip)
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $7, %eax
+	movb %al, g0(%rip)
+.L230:
+	xorl %eax, %eax
+	subl $650, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl g1(%rip), %eax
+	subl $10, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subl $9, %eax
+	movq %rax, %rdi
+	call f1.constprop.3
+	movq %rax, -24(%rbp)
+	movl $591, %eax
+	subl g1(%rip), %eax
+	cmpl $6, %eax
+	jle .L231
+	cmpb $0, g2(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L232
+.L235:
+	movl $1, %eax
+.L236:
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $170, %eax
+	movb %al, g0(%rip)
+	movzbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $12015, %eax
+	movb %al, g0(%rip)
+.L237:
+.L229:
+.L226:
+.L227:
+.L224:
+.L225:
+	movl -64(%rbp), %eax
+	shrl $3, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl %eax, -60(%rbp)
+	movb $-56, g2(%rip)
+	movq $0, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movzbl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movsbq g2(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movl -64(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	movslq -60(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	imulq $31, -8(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L191:
+.L192:
+	movsbl g2(%rip), %eax
+	movsbl g2(%rip), %ecx
+	addl %ecx, %eax
+	movb %al, g2(%rip)
+	movsbl g2(%rip), %eax
+	cmpl $10, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	movabsq $1090808371092, %rax
+	addq -24(%rbp), %rax
+	movl %eax, -52(%rbp)
+	cmpl $5, -56(%rbp)
+	jb .L196
+	cmpl $18, -56(%rbp)
+	jbe .L194
+.L196:
+	movl -52(%rbp), %eax
+	addl -56(%rbp), %eax
+.L193:
+	movl %eax, g1(%rip)
+	addl $1, -64(%rbp)
+	cmpl $4, -64(%rbp)
+	jb .L189
+	jmp .L190
+.L222:
+	jmp .L221
+.L231:
+	movl $0, %eax
+.L232:
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	jmp .L229
+.L228:
+	movl g1(%rip), %eax
+	imull g1(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	cltd
+	idivl %ecx
+	cmpl $6, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movl $1, %eax
+	pushq %rax
+	cmpq $0, -40(%rbp)
+	jne .L233
+	movl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L234
+.L233:
+	movl $1, %eax
+.L234:
+	pushq %rax
+	cmpl $799, -60(%rbp)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movl -60(%rbp), %eax
+	pushq %rax
+	cmpl $0, g1(%rip)
+	jne .L235
+	cmpl $0, -64(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L236
+.L156:
+.L157:
+	movl -56(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -48(%rbp)
+	movl -52(%rbp), %eax
+	movl %eax, -44(%rbp)
+	cmpl $5, -48(%rbp)
+	jb .L162
+	cmpl $18, -48(%rbp)
+	jbe .L160
+.L162:
+	movl -44(%rbp), %eax
+	addl -48(%rbp), %eax
+.L159:
+	pushq %rax
+	movl -56(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -48(%rbp)
+	movl -52(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -44(%rbp)
+	cmpl $5, -48(%rbp)
+	jb .L174
+	cmpl $18, -48(%rbp)
+	jbe .L172
+.L174:
+	movl -44(%rbp), %eax
+	addl -48(%rbp), %eax
+.L171:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L155
+.L194:
+.L195:
+	movl -56(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -48(%rbp)
+	movl -52(%rbp), %eax
+	movl %eax, -44(%rbp)
+	cmpl $5, -48(%rbp)
+	jb .L200
+	cmpl $18, -48(%rbp)
+	jbe .L198
+.L200:
+	movl -44(%rbp), %eax
+	addl -48(%rbp), %eax
+.L197:
+	pushq %rax
+	movl -56(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -48(%rbp)
+	movl -52(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -44(%rbp)
+	cmpl $5, -48(%rbp)
+	jb .L212
+	cmpl $18, -48(%rbp)
+	jbe .L210
+.L212:
+	movl -44(%rbp), %eax
+	addl -48(%rbp), %eax
+.L209:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L193
+.L160:
+.L161:
+	movl -48(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -16(%rbp)
+	movl -44(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L166
+	cmpl $18, -16(%rbp)
+	jbe .L164
+.L166:
+	movl -8(%rbp), %eax
+	addl -16(%rbp), %eax
+.L163:
+	pushq %rax
+	movl -48(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -44(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L170
+	cmpl $18, -16(%rbp)
+	jbe .L168
+.L170:
+	movl -8(%rbp), %eax
+	addl -16(%rbp), %eax
+.L167:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L159
+.L172:
+.L173:
+	movl -48(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -16(%rbp)
+	movl -44(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L178
+	cmpl $18, -16(%rbp)
+	jbe .L176
+.L178:
+	movl -8(%rbp), %eax
+	addl -16(%rbp), %eax
+.L175:
+	pushq %rax
+	movl -48(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -44(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L182
+	cmpl $18, -16(%rbp)
+	jbe .L180
+.L182:
+	movl -8(%rbp), %eax
+	addl -16(%rbp), %eax
+.L179:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L171
+.L198:
+.L199:
+	movl -48(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -16(%rbp)
+	movl -44(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L204
+	cmpl $18, -16(%rbp)
+	jbe .L202
+.L204:
+	movl -8(%rbp), %eax
+	addl -16(%rbp), %eax
+.L201:
+	pushq %rax
+	movl -48(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -44(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L208
+	cmpl $18, -16(%rbp)
+	jbe .L206
+.L208:
+	movl -8(%rbp), %eax
+	addl -16(%rbp), %eax
+.L205:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L197
+.L210:
+.L211:
+	movl -48(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -16(%rbp)
+	movl -44(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L216
+	cmpl $18, -16(%rbp)
+	jbe .L214
+.L216:
+	movl -8(%rbp), %eax
+	addl -16(%rbp), %eax
+.L213:
+	pushq %rax
+	movl -48(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -16(%rbp)
+	movl -44(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	cmpl $5, -16(%rbp)
+	jb .L220
+	cmpl $18, -16(%rbp)
+	jbe .L218
+.L220:
+	movl -8(%rbp), %eax
+	addl -16(%rbp), %eax
+.L217:
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L209
+.L164:
+.L165:
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L163
+.L168:
+.L169:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L167
+.L176:
+.L177:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L175
+.L180:
+.L181:
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L179
+.L202:
+.L203:
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L201
+.L206:
+.L207:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L205
+.L214:
+.L215:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	pushq %rax
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L213
+.L218:
+.L219:
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	pushq %rax
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	popq %rcx
+	addl %ecx, %eax
+	jmp .L217
+.LB4:
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,316 @@
+int g0 = 0;
+unsigned short g1;
+int ga0[8];
+unsigned long f0(short p0, unsigned int p1, unsigned short p2, unsigned char p3, unsigned int p4, long p5, unsigned char p6, unsigned short p7) {
+    unsigned int v0 = 339332367146;
+    short v1 = 7;
+    unsigned short v2 = 338;
+    int v3 = 8;
+    char v4 = 449L;
+    int i0 = 525486520280u;
+    long j0 = 9;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 835749503823; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 6l; }
+    if (((v3 >= v4) / 10)) {
+        if (9) {
+            if (((p2 - 604849766028) >= (long)(j0))) {
+                if (p6 >= 0 && p6 < 33) { la1[p6] = 7; }
+                if (((9 - 396245908354) >= -(p6))) { return v4; }
+            } else {
+                if ((unsigned int)((int)(p4))) { return g1; }
+                if ((p1 / 1024)) { return 432; }
+                if ((long)(la0[3])) { return (!(la1[27]) || v4); }
+            }
+            for (p5 = 1; p5 < 100; p5 = p5 + 1) {
+                if (((int)(p3) / (v2 * v2 + 1))) { break; }
+                v1 = (3L + 3);
+            }
+            p5 = -(((5u - 3ul) / 16));
+        }
+        v1 = (127030906827 && v2);
+        la1[2] = (v1 < p0);
+    } else {
+        p4 = p6;
+        for (v1 = 0; v1 < 8; v1 = v1 + 1) {
+            p4 = 0;
+            while (p4 < 100) {
+                v4 = (v1 / (p3 * p3 + 1));
+                p6 = v2;
+                p4 = p4 + 1;
+            }
+        }
+    }
+    p7 = ((896 - j0) && g1);
+    if (((573010918389l < 1) < (10 / (p0 * p0 + 1)))) {
+        p7 = !(7);
+        v2 = (!((2 / (v0 * v0 + 1))) < 0ul);
+        la0[0] = ((4 >= p1) && -(65536u));
+    } else {
+        p4 = p4;
+    }
+    for (p4 = 2; p4 < 5; p4 = p4 + 1) {
+        p3 = p3 + -((209 <= p3));
+    }
+    for (v3 = 2; v3 < 100; v3 = v3 + 1) {
+        for (v0 = 0; v0 < 3; v0 = v0 + 1) {
+            j0 = ((366 <= 4) - p6);
+            switch ((1 == v4)) {
+            case 4:
+                break;
+            default:
+                if ((121 / (g1 * g1 + 1))) { break; }
+                v4 = i0;
+                break;
+            case 1:
+                break;
+            case 0:
+                break;
+            case 5:
+                break;
+            case 9:
+                break;
+            }
+        }
+        for (p1 = 0; p1 < 17; p1 = p1 + 1) {
+            if (-((i0 != 969))) {
+                if (!((g0 - p7))) { break; }
+            } else {
+                if (v3) { break; }
+            }
+        }
+        if (i0 >= 0 && i0 < 33) { la1[i0] = p2; }
+    }
+    return 586;
+}
+unsigned char f1(short p0, unsigned char p1, unsigned long p2, unsigned int p3, unsigned char p4, int p5, char p6, char p7) {
+    int v0 = 6;
+    unsigned long v1 = 8;
+    long v2 = 737;
+    int i0 = 63ul;
+    long j0 = 138;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 650472360518; }
+    v1 = 0;
+    while (v1 < 5) {
+        if (la1[v1] < j0) { j0 = la1[v1]; }
+        p5 = 0;
+        while (p5 < 16) {
+            switch (g0) {
+            case 784:
+                if (f0(p4, la1[1], p2, 358645160537, g1, p1, g0, la0[10])) { break; }
+                if (8) { break; }
+                break;
+            case 1:
+                break;
+            default:
+                if ((i0 / (i0 * i0 + 1))) { return -((g0 - 4)); }
+                p2 = (((la1[3] != la0[7]) && 10) - -(43));
+            case -2:
+                if (((384957905704l + la0[14]) - (char)(p1))) { break; }
+                break;
+            case 436:
+                break;
+            }
+            p5 = p5 + 1;
+        }
+        v1 = v1 + 1;
+    }
+    v0 = f0((7 + ga0[3]), -(p5), (short)(la1[2]), (416569732958 >= v2), (j0 && ga0[5]), (p3 && p4), (char)(v2), (la0[0] < p5));
+    if (!(((558 + 4) > 64463615981))) {
+        j0 = 0;
+    }
+    p1 = p1 + 3l;
+    p2 = p2;
+    switch (2147483647) {
+    case 65:
+    case 419:
+        break;
+    case 291:
+        f0((0 >= 606), f0(v2, g1, v0, 13, 255, v0, p4, p4), (p0 / (i0 * i0 + 1)), 878, (6 >= 366), f0(1, p1, v1, g0, 9, 353L, la0[6], 9), !(623393689308), (g0 <= 419740078033));
+        switch (((ga0[0] - 931782968295) / 16)) {
+        default:
+            break;
+        case 29:
+            p6 = p6 + la1[6];
+            break;
+        }
+    case 40:
+        break;
+    default:
+        la1[0] = 233212461580;
+        break;
+    case -3:
+        if (804145499963) {
+            f0((4 + 339410995007), (2l / (v1 * v1 + 1)), (p3 / 100), 256, 366, (v1 + p1), (short)(v2), f0(733, p2, 754, la0[10], g0, 65536, 10, v0));
+        } else {
+            if ((((p6 + 754) - (8 > v0)) - ((la1[7] == 665) * 300))) {
+                f0((728 * p0), (6 + 622951050064), f0(j0, p1, 32767, p5, p1, 464, 1u, 12), !(65536), (4294967295 < j0), p3, (unsigned int)(p2), 779);
+                f0(2, (7 - p5), ga0[6], (p6 - g1), (4 || 9), (848 / (g0 * g0 + 1)), f0(p7, 415, 6, 345, p3, 256, g1, 9), (5 / (p2 * p2 + 1)));
+                la0[13] = (la1[2] / 5l);
+            } else {
+                f0(f0(10, v2, 216, 643529010874, 9, 9, 806, 1), (387179770733 * p7), f0(0, 2, g1, 4, 65535, p0, 38, 127), !(la0[6]), (v0 != 230165181364), 1, 1, (j0 - p6));
+            }
+            p4 = f0(0, 3, 171, (681 >= 901L), (2 > p2), (v2 / 8), (5 - p4), (3 / 16));
+            v2 = v0;
+        }
+        la1[6] = 94341775337;
+        break;
+    }
+    p4 = la0[0];
+    if (j0 >= 0 && j0 < 8) { la1[j0] = f0(la1[6], 5, 7, la1[5], la0[14], v2, 5, 864); }
+    return !(((j0 && 751) < (742U / (v1 * v1 + 1))));
+}
+short f2() {
+    unsigned int v0 = 0;
+    unsigned long v1 = 127u;
+    int i0 = 290;
+    long j0 = 5;
+    j0 = 0;
+    while (j0 < 8) {
+        i0 = v0;
+        if (g0) { return ((ga0[1] == 6) + 326ul); }
+        j0 = j0 + 1;
+    }
+    if (441) {
+        if (928) {
+            if (7) {
+                f0((short)(v1), (unsigned char)(ga0[4]), ga0[4], g0, (v1 <= 735L), (9 / (i0 * i0 + 1)), f0(i0, j0, 2, i0, v0, 543, 735, g1), 4);
+                f0((736993771334 != 416), !(i0), f1(g1, 1, v0, 70, v0, v1, 411, v1), g1, -(2), (727 - 3), f0(280, 2, ga0[5], v1, 10, 2, v0, 829), (i0 - 1));
+            }
+            v1 = v1 + ((g1 <= i0) || 792851762890U);
+        } else {
+            if (i0) {
+                f0((ga0[5] == g1), (unsigned int)(6), (j0 - 5), j0, !(236), (935 - g0), j0, (i0 * 4));
+            }
+            if (v1) {
+                f1(j0, (j0 / (i0 * i0 + 1)), f0(g0, 1, ga0[3], 7, j0, g1, g1, 7), 602699458155, (984 - 3), (g0 > g0), 10, j0);
+                v0 = 25;
+                f0((8 + j0), (32767 == v0), f0(g1, 924, 1, g0, g1, 875, 4, 256), (255 < 9u), (8 > ga0[5]), 168, (255 - v1), (6 < ga0[4]));
+            } else {
+                f0(221, v1, (i0 || 0), !(779), (short)(i0), 968, f0(4, ga0[5], g0, 4, 3, i0, ga0[3], v0), v1);
+                f0(j0, (0 > 1l), -(v1), (g1 - 1), f0(g0, 4294967295, g0, 1, v0, ga0[3], g0, 6), f0(ga0[4], j0, 7, 882, i0, 7, g0, 468), (368 + g1), (v0 / 2));
+                f0(!(g1), i0, (v1 + v1), 117u, v1, 998u, !(j0), (ga0[0] / (i0 * i0 + 1)));
+            }
+            j0 = (-(v1) && -((6 < j0)));
+        }
+    }
+    v0 = ga0[3];
+    v1 = (!(ga0[4]) + (j0 >= 8));
+    if ((((j0 / 4) != (g0 == 292344242691)) <= 256)) {
+        if (g0) {
+            switch (3) {
+            case 5:
+                v0 = ((unsigned int)((v0 > v1)) / 8);
+                if (g0) { return -((ga0[7] && i0)); }
+                break;
+            case 6:
+                f1((unsigned short)(i0), (g0 >= ga0[7]), (v1 - 1071190783858), g1, 274ul, f0(7, 9, ga0[4], i0, v0, i0, v0, g1), i0, (181875721980 <= v0));
+                i0 = !(65536);
+                break;
+            case 8:
+                v0 = (((g0 <= i0) / (g1 * g1 + 1)) == ((24 || g0) - (361 <= g0)));
+                j0 = 5;
+                break;
+            case 9:
+                v0 = v0 + v1;
+                f1(v0, 416, 945, 323, 750, 9, (g1 - ga0[4]), (8l / 5l));
+            default:
+            }
+        } else {
+            if (65535) {
+                v0 = v0;
+            } else {
+                f1((int)(i0), (ga0[6] / (g1 * g1 + 1)), f0(4, 230, 5, 759906744202ul, 2, 5, v0, ga0[3]), (0 && 0), -(j0), f1(i0, 256, 222512475836, 0, g1, 1, 485, g1), (584542043847 <= ga0[1]), (g0 <= 8));
+                f1(j0, (7 || 626), -(g0), (ga0[2] <= g1), (long)(v0), (4u - i0), (829 / 16), (439 || 2));
+                f1(v0, (unsigned long)(v1), i0, f0(1, ga0[1], g0, j0, v0, g1, 908, 1), (843 && 6), (unsigned long)(3), (g0 + 1l), f1(640, j0, g1, v1, 246626907925ul, g1, 0, 10));
+            }
+            f1(101117634456U, (unsigned short)(v1), (int)(ga0[3]), v0, (g0 != 189), g0, (9 > i0), (i0 + j0));
+            f1(f0(ga0[4], 9, v0, v0, g1, 2147483647, 304, g0), (8 + v1), (v0 - g0), (249 || i0), 4294967295, (unsigned long)(4), 1, i0);
+        }
+        if (g1) { return (884326829712u <= 0); }
+    } else {
+        v0 = ((g1 != j0) - (j0 * i0));
+    }
+    if (!((v0 == (i0 && ga0[7])))) {
+        switch (((7 + ga0[5]) / 8)) {
+        default:
+            i0 = (((215 + 7) >= (698 - v1)) + (short)(!(j0)));
+            break;
+        case 35:
+            i0 = (unsigned short)(i0);
+            if ((735936634621 < (5 == v1))) {
+                f1((252 >= 484), ga0[3], (v0 / 13ul), (v1 || 447), 127, j0, g0, (1000000007 >= 41u));
+                f0(ga0[1], g1, (v0 <= 5), 8, (416 < v0), (8 >= 7), f0(2, j0, 10, 934, i0, v1, g0, 24), 0);
+                f0((unsigned int)(j0), (g0 < ga0[2]), (g1 <= i0), j0, j0, 673, (v1 < v1), j0);
+            }
+            break;
+        }
+        if (i0) {
+            switch (f0(v1, j0, 173, g0, 9, j0, j0, 65535)) {
+            case 9:
+                f1((j0 > ga0[0]), (795 + g1), (i0 / (i0 * i0 + 1)), (ga0[0] != 2), (882 / 4), v0, (7 < g1), 2);
+            }
+        } else {
+            if (j0) {
+                i0 = (!(ga0[2]) && ((short)(ga0[6]) - (unsigned int)(v0)));
+            }
+        }
+        i0 = 0;
+        while (i0 < 33) {
+            v1 = ((!(4) >= f0(g1, 0, i0, 4U, 6, j0, g0, j0)) / 1);
+            i0 = i0 + 1;
+        }
+    }
+    return f1(g1, (318 && 8), g1, v0, !(8), ga0[3], 686, f1(493, j0, ga0[4], 7, v1, ga0[0], v1, 689));
+}
+void w2(unsigned long q0, unsigned short q1) {
+    g1 = g1 * 3 + q1;
+    ga0[6] = ga0[1] + q1;
+}
+int rec(int n, int acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    unsigned short v0 = 429;
+    unsigned long v1 = 6;
+    short v2 = 6;
+    int i0 = 5;
+    long j0 = 32767;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 967; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 433; }
+    v1 = 0;
+    while (v1 < 17) {
+        if ((f2() > (long)((v0 + la1[18])))) {
+            i0 = rec((8 / 7), rec(i0, 984083189307));
+            v2 = f1(g0, (g0 - g1), 1, (la0[7] < 2), (unsigned int)(g0), (g0 > 898), !(9), (ga0[7] >= g0));
+            ga0[4] = 8;
+        }
+        g0 = f0((v2 == j0), (2 <= 65536), (unsigned short)(v0), !(2), (ga0[1] / 3), f1(10, 924, 776553492147, g1, i0, 5, 3, i0), 358, -(539));
+        i0 = i0 + ((la0[1] / (v0 * v0 + 1)) > (i0 && v1));
+        v1 = v1 + 1;
+    }
+    if ((unsigned int)((10 - la0[7]))) { return ((v0 || 848) > v2); }
+    v1 = -(0);
+    v2 = (rec(7, la1[3]) - v0);
+    g0 = (f0(v2, 4, ga0[7], v0, 8, 9, 7, v0) || (char)((42 <= 7u)));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
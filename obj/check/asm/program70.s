@@ -0,0 +1,4506 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.section .text
+	.type f0, @function
+	.type f0.constprop.1, @function
+	.type rec, @function
+	.type f0.constprop.0, @function
+	.type f1, @function
+	.type f2, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $368, %rsp
+	movw %di, -2(%rbp)
+	movl %esi, -8(%rbp)
+	movw %dx, -10(%rbp)
+	movb %cl, -11(%rbp)
+	movl %r8d, -16(%rbp)
+	movq %r9, -24(%rbp)
+	movl $29950762, -28(%rbp)
+	movw $7, -30(%rbp)
+	movw $338, -32(%rbp)
+	movl $8, -36(%rbp)
+	movb $-63, -37(%rbp)
+	movl $1500510168, -44(%rbp)
+	movq $9, -56(%rbp)
+	movl $0, -44(%rbp)
+	movl $0, -80(%rbp)
+	movl $-1769118897, -76(%rbp)
+	movl $756729502, -72(%rbp)
+	movl $-1012389395, -68(%rbp)
+	movl $4, -44(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jge .L0
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movslq -44(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -240(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movq %rax, -248(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -248(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movq %rax, -256(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -256(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movq %rax, -264(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -264(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -232(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -268(%rbp)
+	testl %eax, %eax
+	je .L5
+	.p2align 4,,10
+.L4:
+	movslq -44(%rbp), %rax
+	movq %rax, -280(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -280(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -268(%rbp)
+	testl %eax, %eax
+	jne .L4
+.L5:
+	movsbl -37(%rbp), %eax
+	cmpl %eax, -36(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L6
+	movzwl -10(%rbp), %eax
+	movabsq $604849766028, %rcx
+	subq %rcx, %rax
+	cmpq -56(%rbp), %rax
+	jl .L8
+	movzbl 16(%rbp), %eax
+	movl %eax, -284(%rbp)
+	testl %eax, %eax
+	jl .L10
+	cmpl $33, -284(%rbp)
+	jge .L10
+	movzbl 16(%rbp), %eax
+	movl $7, -224(%rbp,%rax,4)
+.L10:
+.L11:
+	xorl %eax, %eax
+	subl -284(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-396245908345, %rax
+	cmpq %rcx, %rax
+	jge .LB0
+.L12:
+.L13:
+.L18:
+.L19:
+.L9:
+	movq $1, -24(%rbp)
+	movzwl -32(%rbp), %eax
+	movl %eax, -292(%rbp)
+	imull -292(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -288(%rbp)
+	movq $6, -304(%rbp)
+	cmpq $100, -24(%rbp)
+	jge .L23
+	.p2align 4,,10
+.L22:
+	movzbl -11(%rbp), %eax
+	cltd
+	idivl -288(%rbp)
+	testl %eax, %eax
+	je .L24
+.L23:
+	movq $0, -24(%rbp)
+	cmpw $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -30(%rbp)
+	movswl -30(%rbp), %eax
+	movswl -2(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -216(%rbp)
+.L27:
+.L7:
+	movl $896, %eax
+	subq -56(%rbp), %rax
+	je .L34
+	cmpw $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L35
+.L34:
+	movl $0, %eax
+.L35:
+	movw %ax, 24(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -332(%rbp)
+	imull -332(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	jle .L36
+	movw $0, 24(%rbp)
+	movl -28(%rbp), %eax
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	setb %al
+	movzbl %al, %eax
+	movw %ax, -32(%rbp)
+	cmpl $4, -8(%rbp)
+	ja .L38
+	movl $4294901760, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L39
+.L38:
+	movl $0, %eax
+.L39:
+	movl %eax, -80(%rbp)
+.L36:
+.L37:
+	movl $2, -16(%rbp)
+	movzbl -11(%rbp), %eax
+	movl %eax, -336(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -336(%rbp), %eax
+	movb %al, -11(%rbp)
+	movzbl -11(%rbp), %eax
+	movl %eax, -340(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -340(%rbp), %eax
+	movb %al, -11(%rbp)
+	movzbl -11(%rbp), %eax
+	movl %eax, -344(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -344(%rbp), %eax
+	movb %al, -11(%rbp)
+	movl $5, -16(%rbp)
+	movl $2, -36(%rbp)
+	xorl %eax, %eax
+	movzbl 16(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -348(%rbp)
+	xorl %eax, %eax
+	cmpl $969, -44(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movl %eax, -352(%rbp)
+	cmpl $0, -44(%rbp)
+	jl .L40
+	cmpl $0, -268(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L41
+.L40:
+	movl $0, %eax
+.L41:
+	movl %eax, -356(%rbp)
+	cmpl $100, -36(%rbp)
+	jge .L43
+	.p2align 4,,10
+.L42:
+	movl $0, -28(%rbp)
+	movl -348(%rbp), %eax
+	movl %eax, -360(%rbp)
+	cmpl $3, -28(%rbp)
+	jae .L45
+	.p2align 4,,10
+.L44:
+	movslq -360(%rbp), %rax
+	movq %rax, -56(%rbp)
+	movsbl -37(%rbp), %eax
+	cmpl $1, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L53
+	leaq .L54(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L48
+	# table target .L50
+	# table target .L49
+	# table target .L47
+	# table target .L51
+	# table target .L52
+	jmp *%rcx
+.L53:
+.L48:
+	movzwl g1(%rip), %eax
+	movzwl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $121, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L55
+.L46:
+	addl $1, -28(%rbp)
+	cmpl $3, -28(%rbp)
+	jb .L44
+.L45:
+	movl $0, -8(%rbp)
+	movl -352(%rbp), %eax
+	movl %eax, -364(%rbp)
+	cmpl $17, -8(%rbp)
+	jae .L58
+	.p2align 4,,10
+.L57:
+	cmpl $0, -364(%rbp)
+	je .L59
+	movl g0(%rip), %eax
+	movzwl 24(%rbp), %ecx
+	subl %ecx, %eax
+	jne .L61
+.L58:
+	cmpl $0, -356(%rbp)
+	je .L65
+	movslq -44(%rbp), %rax
+	movzwl -10(%rbp), %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+.L65:
+.L66:
+	addl $1, -36(%rbp)
+	cmpl $100, -36(%rbp)
+	jl .L42
+.L43:
+	movl $586, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L59:
+	cmpl $0, -36(%rbp)
+	je .L63
+	jmp .L58
+.L61:
+.L62:
+.L63:
+.L64:
+.L60:
+	addl $1, -8(%rbp)
+	cmpl $17, -8(%rbp)
+	jb .L57
+	jmp .L58
+.L55:
+.L56:
+	movl -44(%rbp), %eax
+	movb %al, -37(%rbp)
+	jmp .L46
+.L24:
+.L25:
+	movq -304(%rbp), %rax
+	movw %ax, -30(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jl .L22
+	jmp .L23
+.L6:
+	movzbl 16(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movw $0, -30(%rbp)
+	movzbl -11(%rbp), %eax
+	movl %eax, -312(%rbp)
+	imull -312(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -308(%rbp)
+	movswl -30(%rbp), %eax
+	movl %eax, -316(%rbp)
+	cmpl $8, %eax
+	jge .L27
+	.p2align 4,,10
+.L26:
+	movl $0, -16(%rbp)
+	movl -308(%rbp), %eax
+	movl %eax, -320(%rbp)
+	cmpl $100, -16(%rbp)
+	jae .L28
+	movl $100, %eax
+	movl -16(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -328(%rbp)
+	cmpq $0, -328(%rbp)
+	je .L31
+	.p2align 4,,10
+.L30:
+	movl -316(%rbp), %eax
+	cltd
+	idivl -320(%rbp)
+	movb %al, -37(%rbp)
+	movzwl -32(%rbp), %eax
+	movb %al, 16(%rbp)
+	addl $1, -16(%rbp)
+	movl -316(%rbp), %eax
+	cltd
+	idivl -320(%rbp)
+	movb %al, -37(%rbp)
+	movzbl 16(%rbp), %eax
+	movb %al, 16(%rbp)
+	addl $1, -16(%rbp)
+	movl -316(%rbp), %eax
+	cltd
+	idivl -320(%rbp)
+	movb %al, -37(%rbp)
+	movzbl 16(%rbp), %eax
+	movb %al, 16(%rbp)
+	addl $1, -16(%rbp)
+	movl -316(%rbp), %eax
+	cltd
+	idivl -320(%rbp)
+	movb %al, -37(%rbp)
+	movzbl 16(%rbp), %eax
+	movb %al, 16(%rbp)
+	addl $1, -16(%rbp)
+	subq $1, -328(%rbp)
+	jne .L30
+.L31:
+.L28:
+.L29:
+	cmpl $100, -16(%rbp)
+	jae .L33
+	.p2align 4,,10
+.L32:
+	movl -316(%rbp), %eax
+	cltd
+	idivl -320(%rbp)
+	movb %al, -37(%rbp)
+	movzwl -32(%rbp), %eax
+	movb %al, 16(%rbp)
+	addl $1, -16(%rbp)
+	cmpl $100, -16(%rbp)
+	jb .L32
+.L33:
+	movl -316(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -30(%rbp)
+	movswl -30(%rbp), %eax
+	movl %eax, -316(%rbp)
+	cmpl $8, %eax
+	jl .L26
+	jmp .L27
+.L8:
+	movl -16(%rbp), %eax
+	testl %eax, %eax
+	jne .LB1
+.L14:
+.L15:
+	movl -8(%rbp), %eax
+	shrl $10, %eax
+	testl %eax, %eax
+	jne .LB2
+.L16:
+.L17:
+	movl -68(%rbp), %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L18
+	movl -116(%rbp), %eax
+	testl %eax, %eax
+	je .L20
+	cmpb $0, -37(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L21
+.L47:
+	jmp .L46
+.L49:
+	jmp .L46
+.L50:
+	jmp .L46
+.L51:
+	jmp .L46
+.L52:
+	jmp .L46
+.LB0:
+	movsbq -37(%rbp), %rax
+	jmp .f0_return
+.LB1:
+	movzwl g1(%rip), %eax
+	jmp .f0_return
+.L20:
+	movl $1, %eax
+.L21:
+	movslq %eax, %rax
+	jmp .f0_return
+.LB2:
+	movl $432, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L54:
+	.long .L50-.L54
+	.long .L49-.L54
+	.long .L48-.L54
+	.long .L48-.L54
+	.long .L47-.L54
+	.long .L51-.L54
+	.long .L48-.L54
+	.long .L48-.L54
+	.long .L48-.L54
+	.long .L52-.L54
+	.popsection
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $352, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movb %dl, -7(%rbp)
+	movl %ecx, -12(%rbp)
+	movq %r8, -24(%rbp)
+	movb %r9b, -25(%rbp)
+	movl $29950762, -32(%rbp)
+	movw $7, -34(%rbp)
+	movw $338, -36(%rbp)
+	movl $8, -40(%rbp)
+	movb $-63, -41(%rbp)
+	movl $1500510168, -48(%rbp)
+	movq $9, -56(%rbp)
+	movl $0, -48(%rbp)
+	movl $0, -80(%rbp)
+	movl $-1769118897, -76(%rbp)
+	movl $756729502, -72(%rbp)
+	movl $-1012389395, -68(%rbp)
+	movl $4, -48(%rbp)
+	movl $0, -48(%rbp)
+	cmpl $33, -48(%rbp)
+	jge .L67
+	movl $33, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L70
+	.p2align 4,,10
+.L69:
+	movslq -48(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -240(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -248(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -248(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -256(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -256(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -264(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -264(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -232(%rbp)
+	jne .L69
+.L70:
+.L67:
+.L68:
+	cmpl $33, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -268(%rbp)
+	testl %eax, %eax
+	je .L72
+	.p2align 4,,10
+.L71:
+	movslq -48(%rbp), %rax
+	movq %rax, -280(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -280(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $33, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -268(%rbp)
+	testl %eax, %eax
+	jne .L71
+.L72:
+	movsbl -41(%rbp), %eax
+	cmpl %eax, -40(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L73
+	movzwl -6(%rbp), %eax
+	movabsq $604849766028, %rcx
+	subq %rcx, %rax
+	cmpq -56(%rbp), %rax
+	jl .L75
+	movzbl -25(%rbp), %eax
+	movl %eax, -284(%rbp)
+	testl %eax, %eax
+	jl .L77
+	cmpl $33, -284(%rbp)
+	jge .L77
+	movzbl -25(%rbp), %eax
+	movl $7, -224(%rbp,%rax,4)
+.L77:
+.L78:
+	xorl %eax, %eax
+	subl -284(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-396245908345, %rax
+	cmpq %rcx, %rax
+	jge .LB3
+.L79:
+.L80:
+.L85:
+.L86:
+.L76:
+	movq $1, -24(%rbp)
+	movzwl -36(%rbp), %eax
+	movl %eax, -292(%rbp)
+	imull -292(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -288(%rbp)
+	cmpq $100, -24(%rbp)
+	jge .L90
+	.p2align 4,,10
+.L89:
+	movzbl -7(%rbp), %eax
+	cltd
+	idivl -288(%rbp)
+	testl %eax, %eax
+	je .L91
+.L90:
+	movq $0, -24(%rbp)
+	cmpw $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -34(%rbp)
+	movswl -34(%rbp), %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -216(%rbp)
+.L94:
+.L74:
+	movl $896, %eax
+	subq -56(%rbp), %rax
+	je .L101
+	cmpw $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L102
+.L101:
+	movl $0, %eax
+.L102:
+	movw %ax, 16(%rbp)
+	movw $0, 16(%rbp)
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	setb %al
+	movzbl %al, %eax
+	movw %ax, -36(%rbp)
+	cmpl $4, -4(%rbp)
+	ja .L103
+	movl $4294901760, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L104
+.L103:
+	movl $0, %eax
+.L104:
+	movl %eax, -80(%rbp)
+	movl $2, -12(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -324(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -324(%rbp), %eax
+	movb %al, -7(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -328(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -328(%rbp), %eax
+	movb %al, -7(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -332(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -332(%rbp), %eax
+	movb %al, -7(%rbp)
+	movl $5, -12(%rbp)
+	movl $2, -40(%rbp)
+	xorl %eax, %eax
+	movzbl -25(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -336(%rbp)
+	xorl %eax, %eax
+	cmpl $969, -48(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movl %eax, -340(%rbp)
+	cmpl $0, -48(%rbp)
+	jl .L105
+	cmpl $0, -268(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L106
+.L105:
+	movl $0, %eax
+.L106:
+	movl %eax, -344(%rbp)
+	cmpl $100, -40(%rbp)
+	jge .L108
+	.p2align 4,,10
+.L107:
+	movl $0, -32(%rbp)
+	movl -336(%rbp), %eax
+	movl %eax, -348(%rbp)
+	cmpl $3, -32(%rbp)
+	jae .L110
+	.p2align 4,,10
+.L109:
+	movslq -348(%rbp), %rax
+	movq %rax, -56(%rbp)
+	movsbl -41(%rbp), %eax
+	cmpl $1, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L118
+	leaq .L119(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L113
+	# table target .L115
+	# table target .L114
+	# table target .L112
+	# table target .L116
+	# table target .L117
+	jmp *%rcx
+.L118:
+.L113:
+	movzwl g1(%rip), %eax
+	movzwl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $121, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L120
+.L111:
+	addl $1, -32(%rbp)
+	cmpl $3, -32(%rbp)
+	jb .L109
+.L110:
+	movl $0, -4(%rbp)
+	movl -340(%rbp), %eax
+	movl %eax, -352(%rbp)
+	cmpl $17, -4(%rbp)
+	jae .L123
+	.p2align 4,,10
+.L122:
+	cmpl $0, -352(%rbp)
+	je .L124
+	movl g0(%rip), %eax
+	movzwl 16(%rbp), %ecx
+	subl %ecx, %eax
+	jne .L126
+.L123:
+	cmpl $0, -344(%rbp)
+	je .L130
+	movslq -48(%rbp), %rax
+	movzwl -6(%rbp), %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+.L130:
+.L131:
+	addl $1, -40(%rbp)
+	cmpl $100, -40(%rbp)
+	jl .L107
+.L108:
+	movl $586, %eax
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L124:
+	cmpl $0, -40(%rbp)
+	je .L128
+	jmp .L123
+.L126:
+.L127:
+.L128:
+.L129:
+.L125:
+	addl $1, -4(%rbp)
+	cmpl $17, -4(%rbp)
+	jb .L122
+	jmp .L123
+.L120:
+.L121:
+	movl -48(%rbp), %eax
+	movb %al, -41(%rbp)
+	jmp .L111
+.L91:
+.L92:
+	movw $6, -34(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jl .L89
+	jmp .L90
+.L73:
+	movzbl -25(%rbp), %eax
+	movl %eax, -12(%rbp)
+	movw $0, -34(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -300(%rbp)
+	imull -300(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -296(%rbp)
+	movswl -34(%rbp), %eax
+	movl %eax, -304(%rbp)
+	cmpl $8, %eax
+	jge .L94
+	.p2align 4,,10
+.L93:
+	movl $0, -12(%rbp)
+	movl -296(%rbp), %eax
+	movl %eax, -308(%rbp)
+	cmpl $100, -12(%rbp)
+	jae .L95
+	movl $100, %eax
+	movl -12(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -320(%rbp)
+	cmpq $0, -320(%rbp)
+	je .L98
+	.p2align 4,,10
+.L97:
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzwl -36(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -320(%rbp)
+	jne .L97
+.L98:
+.L95:
+.L96:
+	cmpl $100, -12(%rbp)
+	jae .L100
+	.p2align 4,,10
+.L99:
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzwl -36(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $100, -12(%rbp)
+	jb .L99
+.L100:
+	movl -304(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -34(%rbp)
+	movswl -34(%rbp), %eax
+	movl %eax, -304(%rbp)
+	cmpl $8, %eax
+	jl .L93
+	jmp .L94
+.L75:
+	movl -12(%rbp), %eax
+	testl %eax, %eax
+	jne .LB4
+.L81:
+.L82:
+	movl -4(%rbp), %eax
+	shrl $10, %eax
+	testl %eax, %eax
+	jne .LB5
+.L83:
+.L84:
+	movl -68(%rbp), %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L85
+	movl -116(%rbp), %eax
+	testl %eax, %eax
+	je .L87
+	cmpb $0, -41(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L88
+.L112:
+	jmp .L111
+.L114:
+	jmp .L111
+.L115:
+	jmp .L111
+.L116:
+	jmp .L111
+.L117:
+	jmp .L111
+.LB3:
+	movsbq -41(%rbp), %rax
+	jmp .f0.constprop.1_return
+.LB4:
+	movzwl g1(%rip), %eax
+	jmp .f0.constprop.1_return
+.L87:
+	movl $1, %eax
+.L88:
+	movslq %eax, %rax
+	jmp .f0.constprop.1_return
+.LB5:
+	movl $432, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.pushsection .rodata
+	.p2align 2
+.L119:
+	.long .L115-.L119
+	.long .L114-.L119
+	.long .L113-.L119
+	.long .L113-.L119
+	.long .L112-.L119
+	.long .L116-.L119
+	.long .L113-.L119
+	.long .L113-.L119
+	.long .L113-.L119
+	.long .L117-.L119
+	.popsection
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $5, -8(%rbp)
+	jl .L134
+	cmpl $18, -8(%rbp)
+	jg .L134
+.L132:
+.L133:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L134:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $352, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movb %dl, -7(%rbp)
+	movl %ecx, -12(%rbp)
+	movq %r8, -24(%rbp)
+	movb %r9b, -25(%rbp)
+	movl $29950762, -32(%rbp)
+	movw $7, -34(%rbp)
+	movw $338, -36(%rbp)
+	movl $8, -40(%rbp)
+	movb $-63, -41(%rbp)
+	movl $1500510168, -48(%rbp)
+	movq $9, -56(%rbp)
+	movl $0, -48(%rbp)
+	movl $0, -80(%rbp)
+	movl $-1769118897, -76(%rbp)
+	movl $756729502, -72(%rbp)
+	movl $-1012389395, -68(%rbp)
+	movl $4, -48(%rbp)
+	movl $0, -48(%rbp)
+	cmpl $33, -48(%rbp)
+	jge .L135
+	movl $33, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L138
+	.p2align 4,,10
+.L137:
+	movslq -48(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -240(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -248(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -248(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -256(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -256(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -264(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -264(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -232(%rbp)
+	jne .L137
+.L138:
+.L135:
+.L136:
+	cmpl $33, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -268(%rbp)
+	testl %eax, %eax
+	je .L140
+	.p2align 4,,10
+.L139:
+	movslq -48(%rbp), %rax
+	movq %rax, -280(%rbp)
+	imulq $6, %rax, %rax
+	movq %rax, %rcx
+	movq -280(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $33, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -268(%rbp)
+	testl %eax, %eax
+	jne .L139
+.L140:
+	movsbl -41(%rbp), %eax
+	cmpl %eax, -40(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L141
+	movzwl -6(%rbp), %eax
+	movabsq $604849766028, %rcx
+	subq %rcx, %rax
+	cmpq -56(%rbp), %rax
+	jl .L143
+	movzbl -25(%rbp), %eax
+	movl %eax, -284(%rbp)
+	testl %eax, %eax
+	jl .L145
+	cmpl $33, -284(%rbp)
+	jge .L145
+	movzbl -25(%rbp), %eax
+	movl $7, -224(%rbp,%rax,4)
+.L145:
+.L146:
+	xorl %eax, %eax
+	subl -284(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $-396245908345, %rax
+	cmpq %rcx, %rax
+	jge .LB6
+.L147:
+.L148:
+.L153:
+.L154:
+.L144:
+	movq $1, -24(%rbp)
+	movzwl -36(%rbp), %eax
+	movl %eax, -292(%rbp)
+	imull -292(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -288(%rbp)
+	cmpq $100, -24(%rbp)
+	jge .L158
+	.p2align 4,,10
+.L157:
+	movzbl -7(%rbp), %eax
+	cltd
+	idivl -288(%rbp)
+	testl %eax, %eax
+	je .L159
+.L158:
+	movq $0, -24(%rbp)
+	cmpw $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -34(%rbp)
+	movswl -34(%rbp), %eax
+	cmpl $1, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -216(%rbp)
+.L162:
+.L142:
+	movl $896, %eax
+	subq -56(%rbp), %rax
+	je .L169
+	cmpw $0, g1(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L170
+.L169:
+	movl $0, %eax
+.L170:
+	movw %ax, 16(%rbp)
+	movw $0, 16(%rbp)
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	setb %al
+	movzbl %al, %eax
+	movw %ax, -36(%rbp)
+	cmpl $4, -4(%rbp)
+	ja .L171
+	movl $4294901760, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L172
+.L171:
+	movl $0, %eax
+.L172:
+	movl %eax, -80(%rbp)
+	movl $2, -12(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -324(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -324(%rbp), %eax
+	movb %al, -7(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -328(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -328(%rbp), %eax
+	movb %al, -7(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -332(%rbp)
+	cmpl $209, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -332(%rbp), %eax
+	movb %al, -7(%rbp)
+	movl $5, -12(%rbp)
+	movl $2, -40(%rbp)
+	xorl %eax, %eax
+	movzbl -25(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -336(%rbp)
+	xorl %eax, %eax
+	cmpl $969, -48(%rbp)
+	setne %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movl %eax, -340(%rbp)
+	cmpl $0, -48(%rbp)
+	jl .L173
+	cmpl $0, -268(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L174
+.L173:
+	movl $0, %eax
+.L174:
+	movl %eax, -344(%rbp)
+	cmpl $100, -40(%rbp)
+	jge .L176
+	.p2align 4,,10
+.L175:
+	movl $0, -32(%rbp)
+	movl -336(%rbp), %eax
+	movl %eax, -348(%rbp)
+	cmpl $3, -32(%rbp)
+	jae .L178
+	.p2align 4,,10
+.L177:
+	movslq -348(%rbp), %rax
+	movq %rax, -56(%rbp)
+	movsbl -41(%rbp), %eax
+	cmpl $1, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L186
+	leaq .L187(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L181
+	# table target .L183
+	# table target .L182
+	# table target .L180
+	# table target .L184
+	# table target .L185
+	jmp *%rcx
+.L186:
+.L181:
+	movzwl g1(%rip), %eax
+	movzwl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $121, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L188
+.L179:
+	addl $1, -32(%rbp)
+	cmpl $3, -32(%rbp)
+	jb .L177
+.L178:
+	movl $0, -4(%rbp)
+	movl -340(%rbp), %eax
+	movl %eax, -352(%rbp)
+	cmpl $17, -4(%rbp)
+	jae .L191
+	.p2align 4,,10
+.L190:
+	cmpl $0, -352(%rbp)
+	je .L192
+	movl g0(%rip), %eax
+	movzwl 16(%rbp), %ecx
+	subl %ecx, %eax
+	jne .L194
+.L191:
+	cmpl $0, -344(%rbp)
+	je .L198
+	movslq -48(%rbp), %rax
+	movzwl -6(%rbp), %ecx
+	movl %ecx, -224(%rbp,%rax,4)
+.L198:
+.L199:
+	addl $1, -40(%rbp)
+	cmpl $100, -40(%rbp)
+	jl .L175
+.L176:
+	movl $586, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L192:
+	cmpl $0, -40(%rbp)
+	je .L196
+	jmp .L191
+.L194:
+.L195:
+.L196:
+.L197:
+.L193:
+	addl $1, -4(%rbp)
+	cmpl $17, -4(%rbp)
+	jb .L190
+	jmp .L191
+.L188:
+.L189:
+	movl -48(%rbp), %eax
+	movb %al, -41(%rbp)
+	jmp .L179
+.L159:
+.L160:
+	movw $6, -34(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $100, -24(%rbp)
+	jl .L157
+	jmp .L158
+.L141:
+	movzbl -25(%rbp), %eax
+	movl %eax, -12(%rbp)
+	movw $0, -34(%rbp)
+	movzbl -7(%rbp), %eax
+	movl %eax, -300(%rbp)
+	imull -300(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -296(%rbp)
+	movswl -34(%rbp), %eax
+	movl %eax, -304(%rbp)
+	cmpl $8, %eax
+	jge .L162
+	.p2align 4,,10
+.L161:
+	movl $0, -12(%rbp)
+	movl -296(%rbp), %eax
+	movl %eax, -308(%rbp)
+	cmpl $100, -12(%rbp)
+	jae .L163
+	movl $100, %eax
+	movl -12(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -320(%rbp)
+	cmpq $0, -320(%rbp)
+	je .L166
+	.p2align 4,,10
+.L165:
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzwl -36(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzbl -25(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	subq $1, -320(%rbp)
+	jne .L165
+.L166:
+.L163:
+.L164:
+	cmpl $100, -12(%rbp)
+	jae .L168
+	.p2align 4,,10
+.L167:
+	movl -304(%rbp), %eax
+	cltd
+	idivl -308(%rbp)
+	movb %al, -41(%rbp)
+	movzwl -36(%rbp), %eax
+	movb %al, -25(%rbp)
+	addl $1, -12(%rbp)
+	cmpl $100, -12(%rbp)
+	jb .L167
+.L168:
+	movl -304(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -34(%rbp)
+	movswl -34(%rbp), %eax
+	movl %eax, -304(%rbp)
+	cmpl $8, %eax
+	jl .L161
+	jmp .L162
+.L143:
+	movl -12(%rbp), %eax
+	testl %eax, %eax
+	jne .LB7
+.L149:
+.L150:
+	movl -4(%rbp), %eax
+	shrl $10, %eax
+	testl %eax, %eax
+	jne .LB8
+.L151:
+.L152:
+	movl -68(%rbp), %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L153
+	movl -116(%rbp), %eax
+	testl %eax, %eax
+	je .L155
+	cmpb $0, -41(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L156
+.L180:
+	jmp .L179
+.L182:
+	jmp .L179
+.L183:
+	jmp .L179
+.L184:
+	jmp .L179
+.L185:
+	jmp .L179
+.LB6:
+	movsbq -41(%rbp), %rax
+	jmp .f0.constprop.0_return
+.LB7:
+	movzwl g1(%rip), %eax
+	jmp .f0.constprop.0_return
+.L155:
+	movl $1, %eax
+.L156:
+	movslq %eax, %rax
+	jmp .f0.constprop.0_return
+.LB8:
+	movl $432, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L187:
+	.long .L183-.L187
+	.long .L182-.L187
+	.long .L181-.L187
+	.long .L181-.L187
+	.long .L180-.L187
+	.long .L184-.L187
+	.long .L181-.L187
+	.long .L181-.L187
+	.long .L181-.L187
+	.long .L185-.L187
+	.popsection
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movw %di, -2(%rbp)
+	movb %sil, -3(%rbp)
+	movq %rdx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movb %r8b, -21(%rbp)
+	movl %r9d, -28(%rbp)
+	movl $6, -32(%rbp)
+	movq $8, -40(%rbp)
+	movq $737, -48(%rbp)
+	movl $63, -52(%rbp)
+	movq $138, -64(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L200
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L203
+	.p2align 4,,10
+.L202:
+	movl -52(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movl -52(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -136(%rbp)
+	jne .L202
+.L203:
+.L200:
+.L201:
+	cmpl $16, -52(%rbp)
+	jge .L205
+	.p2align 4,,10
+.L204:
+	movl -52(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -52(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L204
+.L205:
+	movl $0, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jge .L206
+	movl $8, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L209
+	.p2align 4,,10
+.L208:
+	movslq -52(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $650472360518, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $650472360518, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movabsq $650472360518, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -208(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movabsq $650472360518, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -216(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -184(%rbp)
+	jne .L208
+.L209:
+.L206:
+.L207:
+	cmpl $8, -52(%rbp)
+	jge .L211
+	.p2align 4,,10
+.L210:
+	movslq -52(%rbp), %rax
+	movq %rax, -224(%rbp)
+	movabsq $650472360518, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -224(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jl .L210
+.L211:
+	movq $0, -40(%rbp)
+	movl -52(%rbp), %eax
+	imull -52(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -228(%rbp)
+	xorl %eax, %eax
+	subl $43, %eax
+	movl %eax, -232(%rbp)
+	cmpq $5, -40(%rbp)
+	jae .L213
+	.p2align 4,,10
+.L212:
+	movq -40(%rbp), %rax
+	movq %rax, -240(%rbp)
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq -64(%rbp), %rax
+	jge .L214
+	movq -240(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+.L214:
+.L215:
+	movl $0, -28(%rbp)
+	movl -228(%rbp), %eax
+	movl %eax, -244(%rbp)
+	movl -232(%rbp), %eax
+	movl %eax, -248(%rbp)
+	cmpl $16, -28(%rbp)
+	jge .L217
+	.p2align 4,,10
+.L216:
+	movl g0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $436, %rax
+	jge .L224
+	cmpq $-2, %rax
+	je .L222
+	cmpq $1, %rax
+	je .L218
+.L221:
+	movl -52(%rbp), %eax
+	cltd
+	idivl -244(%rbp)
+	testl %eax, %eax
+	jne .LB9
+.L229:
+.L230:
+	movl -164(%rbp), %eax
+	movl -100(%rbp), %ecx
+	cmpl %ecx, %eax
+	je .L231
+	movl $10, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L232
+.L224:
+	cmpq $436, %rax
+	je .L223
+	cmpq $784, %rax
+	je .L219
+	jmp .L221
+.L231:
+	movl $0, %eax
+.L232:
+	subl -248(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L222:
+	movzbl -3(%rbp), %eax
+	movsbq %al, %rax
+	pushq %rax
+	movl -72(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $384957905704, %rax
+	addq %rcx, %rax
+	popq %rcx
+	subq %rcx, %rax
+.L223:
+.L218:
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L216
+.L217:
+	addq $1, -40(%rbp)
+	cmpq $5, -40(%rbp)
+	jb .L212
+.L213:
+	movl -128(%rbp), %eax
+	cmpl -28(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	cmpl $0, -20(%rbp)
+	je .L235
+	cmpb $0, -21(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L236
+.L233:
+.L234:
+	jmp .L218
+.L219:
+	movl -88(%rbp), %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movzbl -3(%rbp), %eax
+	movq %rax, %r9
+	movzwl g1(%rip), %eax
+	movq %rax, %r8
+	movl $89, %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movq %rax, %rdx
+	movl -172(%rbp), %eax
+	movq %rax, %rsi
+	movzbl -21(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testq %rax, %rax
+	je .L225
+	jmp .L218
+.L220:
+	jmp .L218
+.LB9:
+	movl g0(%rip), %eax
+	subl $4, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L225:
+.L226:
+	movl $8, %eax
+	testl %eax, %eax
+	je .L218
+	jmp .L218
+.L227:
+.L228:
+	jmp .L218
+.L235:
+	movl $0, %eax
+.L236:
+	movslq %eax, %rax
+	pushq %rax
+	cmpq $0, -64(%rbp)
+	je .L237
+	movl ga0+20(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L238
+.L237:
+	movl $0, %eax
+.L238:
+	movq %rax, %r8
+	movabsq $416569732958, %rax
+	cmpq -48(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -168(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	subl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl ga0+12(%rip), %eax
+	addl $7, %eax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl %eax, -32(%rbp)
+	movq -64(%rbp), %rax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl $558, %eax
+	addl $4, %eax
+	movslq %eax, %rax
+	movabsq $64463615981, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	popq %rcx
+	popq %rax
+	cmovneq %rcx, %rax
+	movq %rax, -64(%rbp)
+	movzbl -3(%rbp), %eax
+	addq $3, %rax
+	movb %al, -3(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $2147483647, %eax
+	movslq %eax, %rax
+	cmpq $65, %rax
+	jge .L245
+	cmpq $-3, %rax
+	je .L244
+	cmpq $40, %rax
+	je .L239
+.L243:
+	movl $1284227596, -176(%rbp)
+	jmp .L239
+.L245:
+	cmpq $65, %rax
+	je .L240
+	cmpq $291, %rax
+	je .L241
+	cmpq $419, %rax
+	je .L240
+	jmp .L243
+.L240:
+.L239:
+	movl -128(%rbp), %eax
+	movb %al, -21(%rbp)
+	cmpq $0, -64(%rbp)
+	jl .L255
+	cmpq $8, -64(%rbp)
+	jge .L255
+	movl $864, %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movq %rax, %r9
+	movl -72(%rbp), %eax
+	movq %rax, %r8
+	movl -156(%rbp), %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	movl -152(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movq -64(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+.L255:
+.L256:
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $742, %eax
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	cmpq $0, -64(%rbp)
+	je .L257
+	movl $751, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L258
+.L241:
+	subq $8, %rsp
+	movslq g0(%rip), %rax
+	movabsq $419740078033, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movabsq $623393689308, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $9, %eax
+	pushq %rax
+	movl -104(%rbp), %eax
+	movq %rax, %r9
+	movl $353, %eax
+	movq %rax, %r8
+	movl $9, %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movzbl -3(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $8, %rsp
+	pushq %rax
+	movl $6, %eax
+	cmpl $366, %eax
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $110, %eax
+	pushq %rax
+	movswl -2(%rbp), %eax
+	cltd
+	idivl -228(%rbp)
+	pushq %rax
+	subq $8, %rsp
+	movzbl -21(%rbp), %eax
+	pushq %rax
+	movzbl -21(%rbp), %eax
+	pushq %rax
+	movslq -32(%rbp), %rax
+	movq %rax, %r9
+	movl $255, %eax
+	movq %rax, %r8
+	movl $13, %eax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movq %rax, %rdx
+	movzwl g1(%rip), %eax
+	movq %rax, %rsi
+	movq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.1
+	addq $16, %rsp
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movabsq $931782968295, %rcx
+	subq %rcx, %rax
+	leaq 15(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $4, %rcx
+	movq %rcx, %rax
+	cmpq $29, %rax
+	je .L248
+.L247:
+.L246:
+.L242:
+	jmp .L239
+.L244:
+	movabsq $804145499963, %rax
+	testq %rax, %rax
+	je .L249
+	movl -32(%rbp), %eax
+	pushq %rax
+	movl $10, %eax
+	pushq %rax
+	movl $65536, %eax
+	movq %rax, %r9
+	movl g0(%rip), %eax
+	movq %rax, %r8
+	movl -88(%rbp), %eax
+	movq %rax, %rcx
+	movl $754, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $733, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	movzbl -3(%rbp), %eax
+	addq -40(%rbp), %rax
+	pushq %rax
+	movl $366, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	movl %edx, %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $2, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rsi
+	movabsq $339410995007, %rax
+	addq $4, %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L250
+.L249:
+	movl -148(%rbp), %eax
+	cmpl $665, %eax
+	sete %al
+	movzbl %al, %eax
+	imull $300, %eax, %eax
+	pushq %rax
+	movsbl 16(%rbp), %eax
+	movl %eax, -252(%rbp)
+	addl $754, %eax
+	cmpl $8, -32(%rbp)
+	setl %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	je .L251
+	movl $779, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movl -20(%rbp), %eax
+	pushq %rax
+	movl $4294967295, %eax
+	cmpq -64(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $65536, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $12, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl $464, %eax
+	movq %rax, %r9
+	movzbl -3(%rbp), %eax
+	movl %eax, -256(%rbp)
+	movq %rax, %r8
+	movl -28(%rbp), %eax
+	movq %rax, %rcx
+	movl $32767, %eax
+	movq %rax, %rdx
+	movl -256(%rbp), %eax
+	movq %rax, %rsi
+	movq -64(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdx
+	movabsq $622951050064, %rax
+	addq $6, %rax
+	movq %rax, %rsi
+	movswl -2(%rbp), %eax
+	imull $728, %eax, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $5, %eax
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	subq $8, %rsp
+	movl $9, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	pushq %rax
+	movl $256, %eax
+	movq %rax, %r9
+	movl -20(%rbp), %eax
+	movq %rax, %r8
+	movl $89, %eax
+	movq %rax, %rcx
+	movl $6, %eax
+	movq %rax, %rdx
+	movl $415, %eax
+	movq %rax, %rsi
+	movsbl 24(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl g0(%rip), %eax
+	imull g0(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $848, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	pushq %rax
+	movl $4, %eax
+	testl %eax, %eax
+	jne .L253
+	movl $9, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L254
+.L251:
+	movq -64(%rbp), %rax
+	movsbq 16(%rbp), %rcx
+	subq %rcx, %rax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movslq -32(%rbp), %rax
+	movabsq $230165181364, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -104(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $127, %eax
+	pushq %rax
+	movl $38, %eax
+	movq %rax, %r9
+	movswq -2(%rbp), %rax
+	movq %rax, %r8
+	movl $65535, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	movq %rax, %rdx
+	movzwl g1(%rip), %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $8, %rsp
+	pushq %rax
+	movabsq $387179770733, %rax
+	movsbq 24(%rbp), %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $1, %eax
+	pushq %rax
+	movl $38, %eax
+	pushq %rax
+	movl $9, %eax
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movl $186, %eax
+	movq %rax, %rcx
+	movl $216, %eax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L252:
+	movl $3, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	pushq %rax
+	movl $5, %eax
+	movzbl -21(%rbp), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	leaq 7(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $3, %rcx
+	movq %rcx, %rax
+	movq %rax, %r9
+	cmpq $2, -16(%rbp)
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movl $681, %eax
+	cmpq $901, %rax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $171, %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movb %al, -21(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -48(%rbp)
+.L250:
+	movl $-147505175, -152(%rbp)
+	jmp .L239
+.L248:
+	movsbl 16(%rbp), %eax
+	movl -152(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, 16(%rbp)
+	jmp .L239
+.L253:
+	movl $1, %eax
+.L254:
+	movq %rax, %r8
+	movl -252(%rbp), %eax
+	movzwl g1(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	subl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl -168(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movl %eax, -76(%rbp)
+	jmp .L252
+.L257:
+	movl $0, %eax
+.L258:
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movl $0, -40(%rbp)
+	movq $127, -32(%rbp)
+	movl $290, -36(%rbp)
+	movq $0, -24(%rbp)
+	cmpq $8, -24(%rbp)
+	jge .L259
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L262
+	.p2align 4,,10
+.L261:
+	movl -40(%rbp), %eax
+	movl %eax, -36(%rbp)
+	cmpl $0, g0(%rip)
+	jne .LB10
+.L263:
+.L264:
+	addq $1, -24(%rbp)
+	movl -36(%rbp), %eax
+	movl %eax, -36(%rbp)
+	cmpl $0, g0(%rip)
+	jne .LB11
+.L265:
+.L266:
+	addq $1, -24(%rbp)
+	subq $1, -8(%rbp)
+	jne .L261
+.L262:
+.L259:
+.L260:
+	cmpq $8, -24(%rbp)
+	jge .L268
+	.p2align 4,,10
+.L267:
+	movl -40(%rbp), %eax
+	movl %eax, -36(%rbp)
+	cmpl $0, g0(%rip)
+	jne .LB12
+.L269:
+.L270:
+	addq $1, -24(%rbp)
+	cmpq $8, -24(%rbp)
+	jl .L267
+.L268:
+	movl $441, %eax
+	testl %eax, %eax
+	je .L271
+	movl $928, %eax
+	testl %eax, %eax
+	je .L273
+	movl $7, %eax
+	testl %eax, %eax
+	je .L275
+	movl $4, %eax
+	pushq %rax
+	subq $8, %rsp
+	movzwl g1(%rip), %eax
+	pushq %rax
+	movl $223, %eax
+	pushq %rax
+	movl $543, %eax
+	movq %rax, %r9
+	movl -40(%rbp), %eax
+	movq %rax, %r8
+	movl -36(%rbp), %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl -36(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %r9
+	cmpq $735, -32(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	movq %rax, %rdx
+	movl ga0+16(%rip), %eax
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	subl $1, %eax
+	pushq %rax
+	movl $829, %eax
+	pushq %rax
+	movl -40(%rbp), %eax
+	movb %al, -8(%rbp)
+	pushq %rax
+	movl $2, %eax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl ga0+20(%rip), %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl $280, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movl $727, %eax
+	subl $3, %eax
+	movslq %eax, %rax
+	pushq %rax
+	xorl %eax, %eax
+	subl $2, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	pushq %rax
+	movl $-101, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq %rax, %r9
+	movzbl -8(%rbp), %eax
+	movq %rax, %r8
+	movl $70, %eax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movzwl g1(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzbl %al, %eax
+	movq %rax, %rsi
+	cmpl $0, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.0
+	addq $16, %rsp
+.L275:
+.L276:
+	movzwl g1(%rip), %eax
+	cmpl -36(%rbp), %eax
+	jle .L277
+	movabsq $792851762890, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L278
+.LB12:
+	movl ga0+4(%rip), %eax
+	cmpl $6, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $326, %rax
+.f2_return:
+	leave
+	ret
+.L285:
+	movl $0, %eax
+.L286:
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L274:
+.L271:
+.L272:
+	movl ga0+12(%rip), %eax
+	movl %eax, -40(%rbp)
+	movl ga0+16(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpq $8, -24(%rbp)
+	setge %cl
+	movzbl %cl, %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movslq g0(%rip), %rax
+	movabsq $292344242691, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	leaq 3(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $2, %rcx
+	movq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	cmpl $256, %eax
+	jg .L287
+	cmpl $0, g0(%rip)
+	je .L289
+	movl $3, %eax
+	movslq %eax, %rax
+	leaq -5(%rax), %rcx
+	cmpq $4, %rcx
+	ja .L290
+	leaq .L298(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L296
+	# table target .L292
+	# table target .L293
+	# table target .L294
+	# table target .L295
+	jmp *%rcx
+.L287:
+	movslq -36(%rbp), %rax
+	imulq -24(%rbp), %rax
+	movq %rax, %rcx
+	movzwl g1(%rip), %eax
+	cmpq -24(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq %rcx, %rax
+	movl %eax, -40(%rbp)
+.L288:
+	cmpl $0, -36(%rbp)
+	je .L321
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L322
+.L321:
+	movl $0, %eax
+.L322:
+	cmpl %eax, -40(%rbp)
+	je .L319
+	movl ga0+20(%rip), %eax
+	addl $7, %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $35, %rax
+	je .L325
+.L324:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	pushq %rax
+	movl $698, %eax
+	subq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $215, %eax
+	addl $7, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movl %eax, -36(%rbp)
+.L323:
+	cmpl $0, -36(%rbp)
+	je .L330
+	movl $65535, %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movl $173, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	cmpq $9, %rax
+	je .L333
+	jmp .L332
+.L333:
+	movl $2, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	cmpl $7, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -40(%rbp), %eax
+	pushq %rax
+	movl $882, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	cmpl $2, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movzwl g1(%rip), %eax
+	addl $795, %eax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+.L332:
+.L334:
+.L335:
+.L331:
+	movl $0, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jge .L338
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L341
+	.p2align 4,,10
+.L340:
+	movq -24(%rbp), %rax
+	movw %ax, -8(%rbp)
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movq %rax, %r9
+	movl $6, %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movzwl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	addl $1, -36(%rbp)
+	movzwl -8(%rbp), %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movq %rax, %r9
+	movl $6, %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movzwl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -16(%rbp)
+	jne .L340
+.L341:
+.L338:
+.L339:
+	cmpl $33, -36(%rbp)
+	jge .L343
+	.p2align 4,,10
+.L342:
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movq %rax, %r9
+	movl $6, %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl -36(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movzwl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl $4, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setae %al
+	movzbl %al, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L342
+.L343:
+.L319:
+.L320:
+	movl $-79, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movl $7, %eax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl $493, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	pushq %rax
+	movl $-82, %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	pushq %rax
+	movl $8, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -40(%rbp), %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	pushq %rax
+	movl $318, %eax
+	testl %eax, %eax
+	je .L344
+	movl $8, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L345
+.L277:
+	movl $1, %eax
+.L278:
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	jmp .L274
+.L273:
+	cmpl $0, -36(%rbp)
+	je .L279
+	movl -36(%rbp), %eax
+	sall $2, %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	movb %al, -8(%rbp)
+	pushq %rax
+	movl $935, %eax
+	subl g0(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $236, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movzbl -8(%rbp), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	subq $5, %rax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movl ga0+20(%rip), %eax
+	movzwl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L279:
+.L280:
+	cmpq $0, -32(%rbp)
+	je .L281
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl $10, %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	cmpl g0(%rip), %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $984, %eax
+	subl $3, %eax
+	pushq %rax
+	movl $1404036715, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl $7, %eax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	movl $25, -40(%rbp)
+	movl ga0+16(%rip), %eax
+	cmpl $6, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $255, %eax
+	subq -32(%rbp), %rax
+	pushq %rax
+	movl $168, %eax
+	pushq %rax
+	movl ga0+20(%rip), %eax
+	cmpl $8, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $255, %eax
+	cmpl $9, %eax
+	setb %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $256, %eax
+	pushq %rax
+	movl $4, %eax
+	pushq %rax
+	movl $875, %eax
+	movq %rax, %r9
+	movzwl g1(%rip), %eax
+	movq %rax, %r8
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movl $924, %eax
+	movq %rax, %rsi
+	movzwl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdx
+	cmpl $32767, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	addq $8, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L282
+.L289:
+	movl $65535, %eax
+	testl %eax, %eax
+	je .L305
+	movl -40(%rbp), %eax
+	movl %eax, -40(%rbp)
+	jmp .L306
+.L325:
+	movl -36(%rbp), %eax
+	movzwl %ax, %eax
+	movl %eax, -36(%rbp)
+	cmpq $5, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $735936634621, %rax
+	cmpq %rcx, %rax
+	jge .L323
+	movl $1000000007, %eax
+	cmpl $41, %eax
+	setae %al
+	movzbl %al, %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movl $127, %eax
+	pushq %rax
+	cmpq $0, -32(%rbp)
+	jne .L328
+	movl $447, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L329
+.L328:
+	movl $1, %eax
+.L329:
+	pushq %rax
+	movl -40(%rbp), %eax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rdx
+	movl ga0+12(%rip), %eax
+	movq %rax, %rsi
+	movl $252, %eax
+	cmpl $484, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	xorl %eax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $24, %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq %rax, %r9
+	movl -36(%rbp), %eax
+	movq %rax, %r8
+	movl $166, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movl %eax, -8(%rbp)
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl $8, %eax
+	cmpl $7, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	cmpl $416, -40(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	cmpl $5, -40(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movzwl g1(%rip), %eax
+	movq %rax, %rsi
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	cmpq -32(%rbp), %rax
+	setb %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $673, %eax
+	movq %rax, %r9
+	movl -8(%rbp), %eax
+	movq %rax, %r8
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movzwl g1(%rip), %eax
+	cmpl -36(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl ga0+8(%rip), %eax
+	cmpl %eax, g0(%rip)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L326:
+.L327:
+	jmp .L323
+.L330:
+	cmpq $0, -24(%rbp)
+	je .L334
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	jne .L336
+	movl ga0+24(%rip), %eax
+	movswl %ax, %eax
+	subl -40(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L337
+.L281:
+	movq -32(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movl -40(%rbp), %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	pushq %rax
+	movslq -36(%rbp), %rax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	movq %rax, %rdx
+	movl ga0+20(%rip), %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl $968, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	movswl %ax, %eax
+	pushq %rax
+	movl $779, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -36(%rbp)
+	jne .L283
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L284
+.L283:
+	movl $1, %eax
+.L284:
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movl %eax, -16(%rbp)
+	movq %rax, %rsi
+	movl $221, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl -40(%rbp), %eax
+	shrl $1, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	addl $368, %eax
+	pushq %rax
+	movl $468, %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl -36(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %r8
+	movl $114, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+16(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	movl -40(%rbp), %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	movq %rax, %rdx
+	movl $4294967295, %eax
+	movq %rax, %rsi
+	movl g0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %r8
+	movzwl g1(%rip), %eax
+	subl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	movq %rax, %rdx
+	movl $1, %eax
+	testq %rax, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl -36(%rbp), %eax
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+0(%rip), %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $998, %eax
+	movq %rax, %r9
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movl $117, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	cmpw $0, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L282:
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	je .L285
+	xorl %eax, %eax
+	cmpq $6, -24(%rbp)
+	setg %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L286
+.L297:
+.L296:
+.L291:
+	jmp .L290
+.L315:
+	movl $1, %eax
+.L316:
+	pushq %rax
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	subl %ecx, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	addq $8, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl g0(%rip), %eax
+	pushq %rax
+	movl $48, %eax
+	pushq %rax
+	movl $2147483647, %eax
+	movq %rax, %r9
+	movzwl g1(%rip), %eax
+	movq %rax, %r8
+	movl -40(%rbp), %eax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movl ga0+16(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+.L290:
+	cmpw $0, g1(%rip)
+	jne .LB13
+.L317:
+.L318:
+	jmp .L288
+.L305:
+	cmpl $8, g0(%rip)
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $584542043847, %rax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	pushq %rax
+	movl $-27, %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movzwl g1(%rip), %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movabsq $222512475836, %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl -36(%rbp), %eax
+	movw %ax, -8(%rbp)
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subq -24(%rbp), %rax
+	pushq %rax
+	xorl %eax, %eax
+	je .L307
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L308
+.L307:
+	movl $0, %eax
+.L308:
+	pushq %rax
+	subq $8, %rsp
+	movl ga0+12(%rip), %eax
+	pushq %rax
+	movl -40(%rbp), %eax
+	pushq %rax
+	movl $5, %eax
+	movq %rax, %r9
+	movl $2, %eax
+	movq %rax, %r8
+	movl $138, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $230, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movzwl g1(%rip), %eax
+	movzwl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rsi
+	movswl -8(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	movl $439, %eax
+	testl %eax, %eax
+	jne .L309
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L310
+.L309:
+	movl $1, %eax
+.L310:
+	pushq %rax
+	movl $829, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	subl %ecx, %eax
+	pushq %rax
+	movl -40(%rbp), %eax
+	pushq %rax
+	movl ga0+8(%rip), %eax
+	movzwl g1(%rip), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl g0(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $7, %eax
+	testl %eax, %eax
+	jne .L311
+	movl $626, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L312
+.L311:
+	movl $1, %eax
+.L312:
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	movl $10, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	movq %rax, %r9
+	movl $21, %eax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movzwl g1(%rip), %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movb %al, -8(%rbp)
+	movq %rax, %rsi
+	movl $640, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	pushq %rax
+	movslq g0(%rip), %rax
+	addq $1, %rax
+	pushq %rax
+	movl $3, %eax
+	pushq %rax
+	movl $843, %eax
+	testl %eax, %eax
+	je .L313
+	movl $6, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L314
+.L313:
+	movl $0, %eax
+.L314:
+	pushq %rax
+	subq $8, %rsp
+	movl $1, %eax
+	pushq %rax
+	movl $140, %eax
+	movq %rax, %r9
+	movzwl g1(%rip), %eax
+	movq %rax, %r8
+	movl -40(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -8(%rbp), %eax
+	movq %rax, %rdx
+	movl g0(%rip), %eax
+	movq %rax, %rsi
+	movl ga0+4(%rip), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movslq -36(%rbp), %rax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movq %rax, %rsi
+	movl -40(%rbp), %eax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+.L306:
+	movslq -36(%rbp), %rax
+	addq -24(%rbp), %rax
+	pushq %rax
+	cmpl $9, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	movq %rax, %r9
+	cmpl $189, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movl -40(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movq %rax, %rsi
+	movl $-22632, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movl -36(%rbp), %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl $4, %eax
+	pushq %rax
+	movl $255, %eax
+	pushq %rax
+	movl $249, %eax
+	testl %eax, %eax
+	jne .L315
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L316
+.L336:
+	movl $0, %eax
+.L337:
+	jmp .L335
+.L292:
+	movl -40(%rbp), %eax
+	cmpq -32(%rbp), %rax
+	seta %al
+	movzbl %al, %eax
+	shrl $3, %eax
+	movl %eax, -40(%rbp)
+	cmpl $0, g0(%rip)
+	je .L290
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	je .L301
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L302
+.L299:
+.L300:
+	jmp .L290
+.L293:
+	movabsq $181875721980, %rax
+	movl -40(%rbp), %ecx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	pushq %rax
+	movl -40(%rbp), %eax
+	pushq %rax
+	movslq -36(%rbp), %rax
+	movq %rax, %r9
+	movl -40(%rbp), %eax
+	movq %rax, %r8
+	movl -36(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+16(%rip), %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movl $18, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movabsq $1071190783858, %rcx
+	subq %rcx, %rax
+	movq %rax, %rdx
+	movl ga0+28(%rip), %eax
+	cmpl %eax, g0(%rip)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl -36(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	movl $65536, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	jmp .L290
+.L294:
+	movl $24, %eax
+	testl %eax, %eax
+	jne .L303
+	cmpl $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L304
+.L303:
+	movl $1, %eax
+.L304:
+	cmpl $361, g0(%rip)
+	setge %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	movzwl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl g0(%rip), %eax
+	cmpl -36(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	movq $5, -24(%rbp)
+	jmp .L290
+.L295:
+	movl -40(%rbp), %eax
+	addq -32(%rbp), %rax
+	movl %eax, -40(%rbp)
+	movl $8, %eax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	movzwl g1(%rip), %eax
+	movl ga0+16(%rip), %ecx
+	subl %ecx, %eax
+	pushq %rax
+	movl $9, %eax
+	movq %rax, %r9
+	movl $238, %eax
+	movq %rax, %r8
+	movl $323, %eax
+	movq %rax, %rcx
+	movl $945, %eax
+	movq %rax, %rdx
+	movl $160, %eax
+	movq %rax, %rsi
+	movl -40(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	jmp .L290
+.LB10:
+	movl ga0+4(%rip), %eax
+	cmpl $6, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $326, %rax
+	jmp .f2_return
+.LB11:
+	movl ga0+4(%rip), %eax
+	cmpl $6, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq $326, %rax
+	jmp .f2_return
+.L344:
+	movl $0, %eax
+.L345:
+	movq %rax, %rsi
+	movzwl g1(%rip), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	movzbl %al, %eax
+	jmp .f2_return
+.LB13:
+	movabsq $884326829712, %rax
+	testq %rax, %rax
+	setbe %al
+	movzbl %al, %eax
+	jmp .f2_return
+.L301:
+	movl $0, %eax
+.L302:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.pushsection .rodata
+	.p2align 2
+.L298:
+	.long .L292-.L298
+	.long .L293-.L298
+	.long .L296-.L298
+	.long .L294-.L298
+	.long .L295-.L298
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $336, %rsp
+	movw $429, -2(%rbp)
+	movq $6, -16(%rbp)
+	movw $6, -18(%rbp)
+	movl $5, -24(%rbp)
+	movq $32767, -32(%rbp)
+	movl $0, -24(%rbp)
+	movl $0, -64(%rbp)
+	movl $967, -60(%rbp)
+	movl $1934, -56(%rbp)
+	movl $2901, -52(%rbp)
+	movl $3868, -48(%rbp)
+	movl $4835, -44(%rbp)
+	movl $5802, -40(%rbp)
+	movl $6769, -36(%rbp)
+	movl $8, -24(%rbp)
+	movl $0, -24(%rbp)
+	imull $433, -24(%rbp), %eax
+	subl $433, %eax
+	movl %eax, -212(%rbp)
+	cmpl $33, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -216(%rbp)
+	testl %eax, %eax
+	je .L346
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -224(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L349
+	.p2align 4,,10
+.L348:
+	addl $433, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $433, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $433, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $433, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -224(%rbp)
+	jne .L348
+.L349:
+.L346:
+.L347:
+	cmpl $33, -24(%rbp)
+	jge .L351
+	.p2align 4,,10
+.L350:
+	addl $433, -212(%rbp)
+	movslq -24(%rbp), %rax
+	movl -212(%rbp), %ecx
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L350
+.L351:
+	movq $0, -16(%rbp)
+	movl $1, -228(%rbp)
+	movl $-539, -232(%rbp)
+	movzwl -2(%rbp), %eax
+	movl %eax, -240(%rbp)
+	imull -240(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -236(%rbp)
+	cmpq $17, -16(%rbp)
+	jae .L353
+	.p2align 4,,10
+.L352:
+	movl -136(%rbp), %eax
+	addl -240(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	call f2
+	addq $8, %rsp
+	movswq %ax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	jle .L354
+	movl -24(%rbp), %eax
+	movl %eax, -248(%rbp)
+	cmpl $5, -248(%rbp)
+	jl .L360
+	cmpl $18, -248(%rbp)
+	jle .L358
+.L360:
+	movl -248(%rbp), %eax
+	addl $535678523, %eax
+.L357:
+	movl %eax, -244(%rbp)
+	movl -244(%rbp), %eax
+	addl $1, %eax
+.L356:
+	movl %eax, -24(%rbp)
+	movl ga0+28(%rip), %eax
+	cmpl g0(%rip), %eax
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	cmpl $898, g0(%rip)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl g0(%rip), %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	cmpl $2, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %rdx
+	movl g0(%rip), %eax
+	movzwl g1(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rsi
+	movl g0(%rip), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	movzbl %al, %eax
+	movw %ax, -18(%rbp)
+	movl $8, ga0+16(%rip)
+.L354:
+.L355:
+	movl -232(%rbp), %eax
+	pushq %rax
+	movl $102, %eax
+	pushq %rax
+	movl -24(%rbp), %eax
+	pushq %rax
+	movl $3, %eax
+	pushq %rax
+	movl $5, %eax
+	movq %rax, %r9
+	movl -24(%rbp), %eax
+	movq %rax, %r8
+	movzwl g1(%rip), %eax
+	movq %rax, %rcx
+	movabsq $776553492147, %rax
+	movq %rax, %rdx
+	movl $156, %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzbl %al, %eax
+	movq %rax, %r9
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdx
+	movl -228(%rbp), %eax
+	movq %rax, %rsi
+	movswq -18(%rbp), %rax
+	cmpq -32(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl %eax, g0(%rip)
+	cmpl $0, -24(%rbp)
+	je .L377
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L378
+.L377:
+	movl $0, %eax
+.L378:
+	movq %rax, %rcx
+	movl -60(%rbp), %eax
+	cltd
+	idivl -236(%rbp)
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	addl %eax, -24(%rbp)
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jb .L352
+.L353:
+	movl $10, %eax
+	movl -36(%rbp), %ecx
+	subl %ecx, %eax
+	je .L379
+	cmpw $0, -2(%rbp)
+	jne .L381
+	movl $848, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L382
+.L358:
+.L359:
+	movl -248(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -252(%rbp)
+	movl -248(%rbp), %eax
+	addl $1607035569, %eax
+	movl %eax, -256(%rbp)
+	cmpl $5, -252(%rbp)
+	jl .L364
+	cmpl $18, -252(%rbp)
+	jle .L362
+.L364:
+	movl -256(%rbp), %eax
+	addl -252(%rbp), %eax
+.L361:
+	jmp .L357
+.L381:
+	movl $1, %eax
+.L382:
+	movswl -18(%rbp), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L379:
+.L380:
+	movq $0, -16(%rbp)
+	movl -196(%rbp), %eax
+	movl %eax, -284(%rbp)
+	imull $3, -284(%rbp), %eax
+	addl $7, %eax
+	movl %eax, -288(%rbp)
+	imull $3, -288(%rbp), %eax
+	addl $5, %eax
+	movl %eax, -292(%rbp)
+	movl -292(%rbp), %eax
+	addl $3, %eax
+.L385:
+.L384:
+.L383:
+	subl -240(%rbp), %eax
+	movw %ax, -18(%rbp)
+	movzwl -2(%rbp), %eax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movl $9, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movzwl -2(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+28(%rip), %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movswl -18(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testq %rax, %rax
+	jne .L386
+	xorl %eax, %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L387
+.L362:
+.L363:
+	movl -252(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -260(%rbp)
+	imull $3, -256(%rbp), %eax
+	addl -252(%rbp), %eax
+	movl %eax, -264(%rbp)
+	cmpl $5, -260(%rbp)
+	jl .L368
+	cmpl $18, -260(%rbp)
+	jle .L366
+.L368:
+	movl -264(%rbp), %eax
+	addl -260(%rbp), %eax
+.L365:
+	jmp .L357
+.L366:
+.L367:
+	movl -260(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -268(%rbp)
+	imull $3, -264(%rbp), %eax
+	addl -260(%rbp), %eax
+	movl %eax, -272(%rbp)
+	cmpl $5, -268(%rbp)
+	jl .L372
+	cmpl $18, -268(%rbp)
+	jle .L370
+.L372:
+	movl -272(%rbp), %eax
+	addl -268(%rbp), %eax
+.L369:
+	jmp .L357
+.L370:
+.L371:
+	movl -268(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -276(%rbp)
+	imull $3, -272(%rbp), %eax
+	addl -268(%rbp), %eax
+	movl %eax, -280(%rbp)
+	cmpl $5, -276(%rbp)
+	jl .L376
+	cmpl $18, -276(%rbp)
+	jle .L374
+.L376:
+	movl -280(%rbp), %eax
+	addl -276(%rbp), %eax
+.L373:
+	jmp .L357
+.L374:
+.L375:
+	imull $3, -280(%rbp), %eax
+	addl -276(%rbp), %eax
+	movq %rax, %rsi
+	movl -276(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L357
+.L386:
+	movl $1, %eax
+.L387:
+	movl %eax, g0(%rip)
+	movq $0, -304(%rbp)
+	imulq $31, -304(%rbp), %rax
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	imulq $31, -304(%rbp), %rax
+	movzwl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	imulq $31, -304(%rbp), %rax
+	movzwl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	imulq $31, -304(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -304(%rbp)
+	imulq $31, -304(%rbp), %rax
+	movswq -18(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	imulq $31, -304(%rbp), %rax
+	movslq -24(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	imulq $31, -304(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -304(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -308(%rbp)
+	testl %eax, %eax
+	je .L388
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -320(%rbp)
+	cmpq $0, -320(%rbp)
+	je .L391
+	.p2align 4,,10
+.L390:
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -320(%rbp)
+	jne .L390
+.L391:
+.L388:
+.L389:
+	cmpl $8, -24(%rbp)
+	jge .L393
+	.p2align 4,,10
+.L392:
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L392
+.L393:
+	movl $0, -24(%rbp)
+	cmpl $0, -308(%rbp)
+	je .L394
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -328(%rbp)
+	cmpq $0, -328(%rbp)
+	je .L397
+	.p2align 4,,10
+.L396:
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -328(%rbp)
+	jne .L396
+.L397:
+.L394:
+.L395:
+	cmpl $8, -24(%rbp)
+	jge .L399
+	.p2align 4,,10
+.L398:
+	movslq -24(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L398
+.L399:
+	movl $0, -24(%rbp)
+	cmpl $0, -216(%rbp)
+	je .L400
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -336(%rbp)
+	cmpq $0, -336(%rbp)
+	je .L403
+	.p2align 4,,10
+.L402:
+	movslq -24(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -336(%rbp)
+	jne .L402
+.L403:
+.L400:
+.L401:
+	cmpl $33, -24(%rbp)
+	jge .L405
+	.p2align 4,,10
+.L404:
+	movslq -24(%rbp), %rax
+	movl -208(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -304(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L404
+.L405:
+	movq -304(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -304(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -304(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -304(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -304(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -304(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -304(%rbp)
+	movq -304(%rbp), %rax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,113 @@
+unsigned long g0 = 9;
+unsigned short g1 = 1;
+unsigned long g2;
+int ga0[33];
+int ga1[33];
+int rec(int n, int acc) {
+    if (n < 4 || n > 18) { return acc + n; }
+    return rec(n - 2, acc * 3 + n);
+}
+int main() {
+    short v0 = 32767;
+    unsigned char v1 = 8;
+    int i0 = 9;
+    long j0 = 832208604007;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 4; }
+    rec((v0 + 128), -(444L));
+    v1 = v1 + -(rec(la1[3], g1));
+    g2 = 347;
+    rec((10 && 7), !(g1));
+    rec((367L * i0), (ga1[16] && 191U));
+    rec((462 == 127), (6 + 256));
+    switch (rec(521, 2)) {
+    default:
+        switch (((v0 <= 417L) < (g2 != g1))) {
+        default:
+            g2 = 84;
+            j0 = (la0[12] / 16);
+            break;
+        case 885:
+            switch (((0u <= i0) - (ga0[0] <= g2))) {
+            case 4:
+                i0 = (g0 * rec(v0, 280));
+                rec((2 / 10), 882);
+                break;
+            case 6:
+            case 8:
+                rec((128 - v0), 6);
+                break;
+            }
+            if (713903380009) { return (short)(-(255)); }
+            break;
+        case 243:
+            i0 = (!((g1 >= 5)) > ((86 / 2) || rec(v1, 2)));
+            if (la1[1]) {
+                rec((la1[5] > j0), 813077948986);
+            }
+            break;
+        case 462:
+            break;
+        case 548:
+            g1 = (unsigned char)((int)(g0));
+            break;
+        case 141:
+            if (rec((v1 < la0[10]), rec(v0, 680160112373))) {
+                rec((909ul * v1), (9712634452 <= 7u));
+                la0[11] = (unsigned char)(!(117));
+                v0 = g0;
+            }
+            g2 = (rec(385, 2) / 13ul);
+            break;
+        }
+        if (((i0 / 13ul) - j0)) { return 5; }
+        break;
+    case 2:
+        if (285294391985) {
+            g1 = (!(i0) || g0);
+        }
+        break;
+    case 3:
+    case 10:
+        rec(65536, 85);
+        for (j0 = 2; j0 < 5; j0 = j0 + 1) {
+            i0 = i0 + 7;
+            i0 = 387;
+            if ((((1000000007 < 10) / 3u) == rec(34, 10))) {
+                if ((65536 + (g0 < 4294967295))) { break; }
+                if (j0 >= 0 && j0 < 33) { ga0[j0] = (short)((3 / 2)); }
+            } else {
+                v1 = i0;
+                la1[j0] = 331;
+                if ((rec(934, 673730938369u) / 10)) { break; }
+            }
+        }
+        break;
+    case 9:
+        g1 = 7;
+        break;
+    case 5:
+        j0 = ((g0 + ga1[21]) || (v1 || 438969148968));
+        if (!((-(10) >= v0))) {
+            if (i0 >= 0 && i0 < 16) { la0[i0] = (!(5) + 448); }
+            ga1[21] = g1;
+        }
+        break;
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1271 @@
+	.section .data
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.quad 9
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.short 1
+	.section .bss
+	.type g2, @object
+	.size g2, 8
+	.p2align 3
+g2:
+	.zero 8
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.type ga1, @object
+	.size ga1, 132
+	.p2align 5
+ga1:
+	.zero 132
+	.section .text
+	.type rec, @function
+	.global main
+	.type main, @function
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $4, -8(%rbp)
+	jl .L2
+	cmpl $18, -8(%rbp)
+	jg .L2
+.L0:
+.L1:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L2:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $400, %rsp
+	movw $32767, -2(%rbp)
+	movb $8, -3(%rbp)
+	movl $9, -8(%rbp)
+	movabsq $832208604007, %rax
+	movq %rax, -16(%rbp)
+	movl $0, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -84(%rbp)
+	testl %eax, %eax
+	je .L3
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -96(%rbp)
+	cmpq $0, -96(%rbp)
+	je .L6
+	.p2align 4,,10
+.L5:
+	movl -8(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl -8(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl -8(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl -8(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -96(%rbp)
+	jne .L5
+.L6:
+.L3:
+.L4:
+	cmpl $16, -8(%rbp)
+	jge .L8
+	.p2align 4,,10
+.L7:
+	movl -8(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L7
+.L8:
+	movl $0, -8(%rbp)
+	movl $0, -128(%rbp)
+	movl $4, -124(%rbp)
+	movl $8, -120(%rbp)
+	movl $12, -116(%rbp)
+	movl $16, -112(%rbp)
+	movl $20, -108(%rbp)
+	movl $24, -104(%rbp)
+	movl $28, -100(%rbp)
+	movl $8, -8(%rbp)
+	movswl -2(%rbp), %eax
+	addl $128, %eax
+	movl %eax, -132(%rbp)
+	cmpl $4, -132(%rbp)
+	jl .L12
+	cmpl $18, -132(%rbp)
+	jle .L10
+.L12:
+	movl -132(%rbp), %eax
+	addl $-444, %eax
+.L9:
+	movl -116(%rbp), %eax
+	movl %eax, -152(%rbp)
+	movzwl g1(%rip), %eax
+	movl %eax, -156(%rbp)
+	cmpl $4, -152(%rbp)
+	jl .L24
+	cmpl $18, -152(%rbp)
+	jle .L22
+.L24:
+	movl -156(%rbp), %eax
+	addl -152(%rbp), %eax
+.L21:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -3(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -3(%rbp)
+	movq $347, g2(%rip)
+	cmpw $0, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -176(%rbp)
+	movl -176(%rbp), %eax
+	addl $1, %eax
+.L33:
+	movslq -8(%rbp), %rax
+	imulq $367, %rax, %rax
+	movl %eax, -180(%rbp)
+	movl ga1+64(%rip), %eax
+	testl %eax, %eax
+	je .L35
+	movl $191, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L36
+.L35:
+	movl $0, %eax
+.L36:
+	movl %eax, -184(%rbp)
+	cmpl $4, -180(%rbp)
+	jl .L39
+	cmpl $18, -180(%rbp)
+	jle .L37
+.L39:
+	movl -184(%rbp), %eax
+	addl -180(%rbp), %eax
+.L34:
+	movl $262, %eax
+.L48:
+	movl $523, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L55
+	leaq .L56(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L50
+	# table target .L51
+	# table target .L52
+	# table target .L54
+	# table target .L53
+	jmp *%rcx
+.L55:
+.L50:
+	movzwl g1(%rip), %eax
+	cmpq %rax, g2(%rip)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -2(%rbp), %rax
+	cmpq $417, %rax
+	setle %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $462, %rax
+	jge .L64
+	cmpq $141, %rax
+	je .L63
+	cmpq $243, %rax
+	je .L60
+.L58:
+	movq $84, g2(%rip)
+	movl -32(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	jmp .L57
+.L64:
+	cmpq $462, %rax
+	je .L61
+	cmpq $548, %rax
+	je .L62
+	cmpq $885, %rax
+	je .L59
+	jmp .L58
+.L61:
+.L57:
+	movq -16(%rbp), %rax
+	pushq %rax
+	movslq -8(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	subq %rcx, %rax
+	jne .LB0
+.L153:
+.L154:
+	jmp .L49
+.L52:
+	movl $65621, %eax
+.L157:
+	movq $2, -16(%rbp)
+	cmpq $5, -16(%rbp)
+	jge .L159
+	.p2align 4,,10
+.L158:
+	addl $7, -8(%rbp)
+	movl $387, -8(%rbp)
+	movl -8(%rbp), %eax
+	movb %al, -3(%rbp)
+	movq -16(%rbp), %rax
+	movl $331, -128(%rbp,%rax,4)
+.L159:
+.L49:
+	movq $0, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	movzwl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	addq g2(%rip), %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	movzbl -3(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	movslq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	imulq $31, -352(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -352(%rbp)
+	movl $0, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -356(%rbp)
+	testl %eax, %eax
+	je .L168
+	movl $33, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -368(%rbp)
+	cmpq $0, -368(%rbp)
+	je .L171
+	.p2align 4,,10
+.L170:
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -368(%rbp)
+	jne .L170
+.L171:
+.L168:
+.L169:
+	cmpl $33, -8(%rbp)
+	jge .L173
+	.p2align 4,,10
+.L172:
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jl .L172
+.L173:
+	movl $0, -8(%rbp)
+	cmpl $0, -356(%rbp)
+	je .L174
+	movl $33, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -376(%rbp)
+	cmpq $0, -376(%rbp)
+	je .L177
+	.p2align 4,,10
+.L176:
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -376(%rbp)
+	jne .L176
+.L177:
+.L174:
+.L175:
+	cmpl $33, -8(%rbp)
+	jge .L179
+	.p2align 4,,10
+.L178:
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jl .L178
+.L179:
+	movl $0, -8(%rbp)
+	cmpl $0, -84(%rbp)
+	je .L180
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -384(%rbp)
+	cmpq $0, -384(%rbp)
+	je .L183
+	.p2align 4,,10
+.L182:
+	movslq -8(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -384(%rbp)
+	jne .L182
+.L183:
+.L180:
+.L181:
+	cmpl $16, -8(%rbp)
+	jge .L185
+	.p2align 4,,10
+.L184:
+	movslq -8(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L184
+.L185:
+	movl $0, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jge .L186
+	movl $8, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -392(%rbp)
+	cmpq $0, -392(%rbp)
+	je .L189
+	.p2align 4,,10
+.L188:
+	movslq -8(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -392(%rbp)
+	jne .L188
+.L189:
+.L186:
+.L187:
+	cmpl $8, -8(%rbp)
+	jge .L191
+	.p2align 4,,10
+.L190:
+	movslq -8(%rbp), %rax
+	movl -128(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -352(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jl .L190
+.L191:
+	movq -352(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -352(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -352(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -352(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -352(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -352(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -352(%rbp)
+	movq -352(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L10:
+.L11:
+	movl -132(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -136(%rbp)
+	movl -132(%rbp), %eax
+	addl $-1332, %eax
+	movl %eax, -140(%rbp)
+	cmpl $4, -136(%rbp)
+	jl .L16
+	cmpl $18, -136(%rbp)
+	jle .L14
+.L16:
+	movl -140(%rbp), %eax
+	addl -136(%rbp), %eax
+.L13:
+	jmp .L9
+.L22:
+.L23:
+	movl -152(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -160(%rbp)
+	imull $3, -156(%rbp), %eax
+	addl -152(%rbp), %eax
+	movl %eax, -164(%rbp)
+	cmpl $4, -160(%rbp)
+	jl .L28
+	cmpl $18, -160(%rbp)
+	jle .L26
+.L28:
+	movl -164(%rbp), %eax
+	addl -160(%rbp), %eax
+.L25:
+	jmp .L21
+.L37:
+.L38:
+	movl -180(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -188(%rbp)
+	imull $3, -184(%rbp), %eax
+	addl -180(%rbp), %eax
+	movl %eax, -192(%rbp)
+	cmpl $4, -188(%rbp)
+	jl .L43
+	cmpl $18, -188(%rbp)
+	jle .L41
+.L43:
+	movl -192(%rbp), %eax
+	addl -188(%rbp), %eax
+.L40:
+	jmp .L34
+.L63:
+	movzbl -3(%rbp), %eax
+	movl -40(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -264(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -272(%rbp)
+	cmpl $4, -272(%rbp)
+	jl .L113
+	cmpl $18, -272(%rbp)
+	jle .L111
+.L113:
+	movl -272(%rbp), %eax
+	addl $1555279605, %eax
+.L110:
+	movl %eax, -268(%rbp)
+	cmpl $4, -264(%rbp)
+	jl .L132
+	cmpl $18, -264(%rbp)
+	jle .L130
+.L132:
+	movl -268(%rbp), %eax
+	addl -264(%rbp), %eax
+.L109:
+	testl %eax, %eax
+	je .L107
+	movzbl -3(%rbp), %eax
+	imulq $909, %rax, %rax
+	movl %eax, -324(%rbp)
+	cmpl $4, -324(%rbp)
+	jl .L144
+	cmpl $18, -324(%rbp)
+	jle .L142
+.L144:
+	movl -324(%rbp), %eax
+.L141:
+	movl $0, -36(%rbp)
+	movq g0(%rip), %rax
+	movw %ax, -2(%rbp)
+.L107:
+.L108:
+	movq $29, g2(%rip)
+	jmp .L57
+.L60:
+	movzwl g1(%rip), %eax
+	cmpl $5, %eax
+	setl %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	movl -124(%rbp), %eax
+	testl %eax, %eax
+	je .L57
+	movl -108(%rbp), %eax
+	movslq %eax, %rax
+	cmpq -16(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -244(%rbp)
+	cmpl $4, -244(%rbp)
+	jl .L98
+	cmpl $18, -244(%rbp)
+	jle .L96
+.L98:
+	movl -244(%rbp), %eax
+	addl $1329130042, %eax
+.L95:
+.L93:
+.L94:
+	jmp .L57
+.L62:
+	movq g0(%rip), %rax
+	movzbl %al, %eax
+	movw %ax, g1(%rip)
+	jmp .L57
+.L14:
+.L15:
+	movl -136(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -144(%rbp)
+	imull $3, -140(%rbp), %eax
+	addl -136(%rbp), %eax
+	movl %eax, -148(%rbp)
+	cmpl $4, -144(%rbp)
+	jl .L20
+	cmpl $18, -144(%rbp)
+	jle .L18
+.L20:
+	movl -148(%rbp), %eax
+	addl -144(%rbp), %eax
+.L17:
+	jmp .L9
+.L26:
+.L27:
+	movl -160(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -168(%rbp)
+	imull $3, -164(%rbp), %eax
+	addl -160(%rbp), %eax
+	movl %eax, -172(%rbp)
+	cmpl $4, -168(%rbp)
+	jl .L32
+	cmpl $18, -168(%rbp)
+	jle .L30
+.L32:
+	movl -172(%rbp), %eax
+	addl -168(%rbp), %eax
+.L29:
+	jmp .L21
+.L41:
+.L42:
+	movl -188(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -196(%rbp)
+	imull $3, -192(%rbp), %eax
+	addl -188(%rbp), %eax
+	movl %eax, -200(%rbp)
+	cmpl $4, -196(%rbp)
+	jl .L47
+	cmpl $18, -196(%rbp)
+	jle .L45
+.L47:
+	movl -200(%rbp), %eax
+	addl -196(%rbp), %eax
+.L44:
+	jmp .L34
+.L59:
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	cmpq g2(%rip), %rax
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	testl %eax, %eax
+	setae %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq $4, %rax
+	je .L66
+	cmpq $6, %rax
+	je .L67
+	cmpq $8, %rax
+	je .L67
+	jmp .L65
+.L111:
+.L112:
+	movl -272(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -276(%rbp)
+	movl $1555279605, %eax
+	imull $3, %eax, %eax
+	addl -272(%rbp), %eax
+	movl %eax, -280(%rbp)
+	cmpl $4, -276(%rbp)
+	jl .L117
+	cmpl $18, -276(%rbp)
+	jle .L115
+.L117:
+	movl -280(%rbp), %eax
+	addl -276(%rbp), %eax
+.L114:
+	jmp .L110
+.L130:
+.L131:
+	movl -264(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -308(%rbp)
+	imull $3, -268(%rbp), %eax
+	addl -264(%rbp), %eax
+	movl %eax, -312(%rbp)
+	cmpl $4, -308(%rbp)
+	jl .L136
+	cmpl $18, -308(%rbp)
+	jle .L134
+.L136:
+	movl -312(%rbp), %eax
+	addl -308(%rbp), %eax
+.L133:
+	jmp .L109
+.L142:
+.L143:
+	movl -324(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -328(%rbp)
+	movl -324(%rbp), %eax
+	movl %eax, -332(%rbp)
+	cmpl $4, -328(%rbp)
+	jl .L148
+	cmpl $18, -328(%rbp)
+	jle .L146
+.L148:
+	movl -332(%rbp), %eax
+	addl -328(%rbp), %eax
+.L145:
+	jmp .L141
+.L18:
+.L19:
+	imull $3, -148(%rbp), %eax
+	addl -144(%rbp), %eax
+	movq %rax, %rsi
+	movl -144(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L9
+.L30:
+.L31:
+	imull $3, -172(%rbp), %eax
+	addl -168(%rbp), %eax
+	movq %rax, %rsi
+	movl -168(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L21
+.L45:
+.L46:
+	imull $3, -200(%rbp), %eax
+	addl -196(%rbp), %eax
+	movq %rax, %rsi
+	movl -196(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L34
+.L67:
+	movl $128, %eax
+	movswl -2(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -224(%rbp)
+	cmpl $4, -224(%rbp)
+	jl .L84
+	cmpl $18, -224(%rbp)
+	jle .L82
+.L84:
+	movl -224(%rbp), %eax
+	addl $6, %eax
+.L81:
+	jmp .L65
+.L96:
+.L97:
+	movl -244(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -248(%rbp)
+	movl $1329130042, %eax
+	imull $3, %eax, %eax
+	addl -244(%rbp), %eax
+	movl %eax, -252(%rbp)
+	cmpl $4, -248(%rbp)
+	jl .L102
+	cmpl $18, -248(%rbp)
+	jle .L100
+.L102:
+	movl -252(%rbp), %eax
+	addl -248(%rbp), %eax
+.L99:
+	jmp .L57
+.L115:
+.L116:
+	movl -276(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -284(%rbp)
+	imull $3, -280(%rbp), %eax
+	addl -276(%rbp), %eax
+	movl %eax, -288(%rbp)
+	cmpl $4, -284(%rbp)
+	jl .L121
+	cmpl $18, -284(%rbp)
+	jle .L119
+.L121:
+	movl -288(%rbp), %eax
+	addl -284(%rbp), %eax
+.L118:
+	jmp .L110
+.L134:
+.L135:
+	movl -308(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -316(%rbp)
+	imull $3, -312(%rbp), %eax
+	addl -308(%rbp), %eax
+	movl %eax, -320(%rbp)
+	cmpl $4, -316(%rbp)
+	jl .L140
+	cmpl $18, -316(%rbp)
+	jle .L138
+.L140:
+	movl -320(%rbp), %eax
+	addl -316(%rbp), %eax
+.L137:
+	jmp .L109
+.L146:
+.L147:
+	movl -328(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -336(%rbp)
+	imull $3, -332(%rbp), %eax
+	addl -328(%rbp), %eax
+	movl %eax, -340(%rbp)
+	cmpl $4, -336(%rbp)
+	jl .L152
+	cmpl $18, -336(%rbp)
+	jle .L150
+.L152:
+	movl -340(%rbp), %eax
+	addl -336(%rbp), %eax
+.L149:
+	jmp .L141
+.L82:
+.L83:
+	movl -224(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -228(%rbp)
+	movl -224(%rbp), %eax
+	addl $18, %eax
+	movl %eax, -232(%rbp)
+	cmpl $4, -228(%rbp)
+	jl .L88
+	cmpl $18, -228(%rbp)
+	jle .L86
+.L88:
+	movl -232(%rbp), %eax
+	addl -228(%rbp), %eax
+.L85:
+	jmp .L65
+.L100:
+.L101:
+	movl -248(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -256(%rbp)
+	imull $3, -252(%rbp), %eax
+	addl -248(%rbp), %eax
+	movl %eax, -260(%rbp)
+	cmpl $4, -256(%rbp)
+	jl .L106
+	cmpl $18, -256(%rbp)
+	jle .L104
+.L106:
+	movl -260(%rbp), %eax
+	addl -256(%rbp), %eax
+.L103:
+	jmp .L57
+.L119:
+.L120:
+	movl -284(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -292(%rbp)
+	imull $3, -288(%rbp), %eax
+	addl -284(%rbp), %eax
+	movl %eax, -296(%rbp)
+	cmpl $4, -292(%rbp)
+	jl .L125
+	cmpl $18, -292(%rbp)
+	jle .L123
+.L125:
+	movl -296(%rbp), %eax
+	addl -292(%rbp), %eax
+.L122:
+	jmp .L110
+.L138:
+.L139:
+	imull $3, -320(%rbp), %eax
+	addl -316(%rbp), %eax
+	movq %rax, %rsi
+	movl -316(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L109
+.L150:
+.L151:
+	imull $3, -340(%rbp), %eax
+	addl -336(%rbp), %eax
+	movq %rax, %rsi
+	movl -336(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L141
+.L86:
+.L87:
+	movl -228(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -236(%rbp)
+	imull $3, -232(%rbp), %eax
+	addl -228(%rbp), %eax
+	movl %eax, -240(%rbp)
+	cmpl $4, -236(%rbp)
+	jl .L92
+	cmpl $18, -236(%rbp)
+	jle .L90
+.L92:
+	movl -240(%rbp), %eax
+	addl -236(%rbp), %eax
+.L89:
+	jmp .L65
+.L104:
+.L105:
+	imull $3, -260(%rbp), %eax
+	addl -256(%rbp), %eax
+	movq %rax, %rsi
+	movl -256(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L57
+.L123:
+.L124:
+	movl -292(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -300(%rbp)
+	imull $3, -296(%rbp), %eax
+	addl -292(%rbp), %eax
+	movl %eax, -304(%rbp)
+	cmpl $4, -300(%rbp)
+	jl .L129
+	cmpl $18, -300(%rbp)
+	jle .L127
+.L129:
+	movl -304(%rbp), %eax
+	addl -300(%rbp), %eax
+.L126:
+	jmp .L110
+.L90:
+.L91:
+	imull $3, -240(%rbp), %eax
+	addl -236(%rbp), %eax
+	movq %rax, %rsi
+	movl -236(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L65
+.L127:
+.L128:
+	imull $3, -304(%rbp), %eax
+	addl -300(%rbp), %eax
+	movq %rax, %rsi
+	movl -300(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L110
+.L69:
+.L70:
+	movl -204(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -208(%rbp)
+	movl -204(%rbp), %eax
+	addl $840, %eax
+	movl %eax, -212(%rbp)
+	cmpl $4, -208(%rbp)
+	jl .L75
+	cmpl $18, -208(%rbp)
+	jle .L73
+.L75:
+	movl -212(%rbp), %eax
+	addl -208(%rbp), %eax
+.L72:
+	jmp .L68
+.L73:
+.L74:
+	movl -208(%rbp), %eax
+	subl $2, %eax
+	movl %eax, -216(%rbp)
+	imull $3, -212(%rbp), %eax
+	addl -208(%rbp), %eax
+	movl %eax, -220(%rbp)
+	cmpl $4, -216(%rbp)
+	jl .L79
+	cmpl $18, -216(%rbp)
+	jle .L77
+.L79:
+	movl -220(%rbp), %eax
+	addl -216(%rbp), %eax
+.L76:
+	jmp .L68
+.L77:
+.L78:
+	imull $3, -220(%rbp), %eax
+	addl -216(%rbp), %eax
+	movq %rax, %rsi
+	movl -216(%rbp), %eax
+	subl $2, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L68
+.L51:
+	cmpl $0, -8(%rbp)
+	je .L155
+	cmpq $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L156
+.L155:
+	movl $1, %eax
+.L156:
+	movw %ax, g1(%rip)
+	jmp .L49
+.L53:
+	movw $7, g1(%rip)
+	jmp .L49
+.L54:
+	movl ga1+84(%rip), %eax
+	movslq %eax, %rax
+	addq g0(%rip), %rax
+	jne .L160
+	cmpb $0, -3(%rbp)
+	jne .L162
+	movabsq $438969148968, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L161
+.L162:
+	movl $1, %eax
+.L163:
+	jmp .L161
+.L160:
+	movl $1, %eax
+.L161:
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movswl -2(%rbp), %eax
+	cmpl $-10, %eax
+	jle .L49
+	cmpl $0, -8(%rbp)
+	jl .L166
+	cmpl $16, -8(%rbp)
+	jge .L166
+	movslq -8(%rbp), %rax
+	movl $448, -80(%rbp,%rax,4)
+.L166:
+.L167:
+	movzwl g1(%rip), %eax
+	movl %eax, ga1+84(%rip)
+.L164:
+.L165:
+	jmp .L49
+.LB0:
+	movl $5, %eax
+	jmp .main_return
+.L66:
+	movswl -2(%rbp), %eax
+	movl %eax, -204(%rbp)
+	cmpl $4, -204(%rbp)
+	jl .L71
+	cmpl $18, -204(%rbp)
+	jle .L69
+.L71:
+	movl -204(%rbp), %eax
+	addl $280, %eax
+.L68:
+	movslq %eax, %rax
+	imulq g0(%rip), %rax
+	movl %eax, -8(%rbp)
+	movl $882, %eax
+.L80:
+.L65:
+	movl $-255, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L56:
+	.long .L51-.L56
+	.long .L52-.L56
+	.long .L50-.L56
+	.long .L54-.L56
+	.long .L50-.L56
+	.long .L50-.L56
+	.long .L50-.L56
+	.long .L53-.L56
+	.long .L52-.L56
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
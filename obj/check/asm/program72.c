@@ -0,0 +1,312 @@
+int ga0[8];
+int ga1[8];
+unsigned short f0(unsigned long p0, unsigned long p1, unsigned char p2, unsigned char p3, unsigned int p4, unsigned int p5, long p6) {
+    int v0 = 4;
+    unsigned int v1 = 128;
+    char v2 = 8;
+    unsigned char v3 = 6;
+    unsigned short v4 = 2;
+    int v5 = 4L;
+    int i0 = 537;
+    long j0 = 5;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 166; }
+    v2 = 107;
+    if (v1) { return 910; }
+    v4 = (j0 * 7);
+    switch (22) {
+    case 54:
+        p3 = ((char)((1 / (p1 * p1 + 1))) || !(!(1)));
+        p4 = (unsigned int)(p2);
+        break;
+    case 46:
+        switch (475) {
+        case 2:
+            break;
+        case 4:
+            if (p4 >= 0 && p4 < 16) { la0[p4] = (ga1[1] > (unsigned char)(i0)); }
+            break;
+        case 9:
+            p6 = p6 + i0;
+            p6 = (0 - v1);
+            break;
+        case 10:
+            if (p3 >= 0 && p3 < 16) { la0[p3] = (int)(v1); }
+            if (ga1[2]) { return 9; }
+            break;
+        case 3:
+            if ((10 <= (i0 / 16))) {
+                v2 = (((8 / 3) - (p5 * 8)) + p1);
+            } else {
+                if (p0) { return j0; }
+                if (((p0 / (p0 * p0 + 1)) / 3)) { return p3; }
+            }
+            p6 = 527;
+            break;
+        }
+        for (p1 = 1; p1 < 5; p1 = p1 + 1) {
+            v1 = v1 + (!(v0) / (v0 * v0 + 1));
+            switch (v0) {
+            default:
+                break;
+            case 681:
+                v4 = (((1 + v3) > (441 + 755)) - ((v5 > 5) - (char)(v2)));
+                if (3) { break; }
+            case 44:
+                if ((1 && v5)) { break; }
+                i0 = (short)(!(p3));
+                break;
+            }
+        }
+        break;
+    case 978:
+    case 42:
+        for (v1 = 2; v1 < 4; v1 = v1 + 1) {
+            p5 = 449;
+            if (337) { return -(p1); }
+        }
+        p4 = ((ga0[0] * 128) > !(650217901747));
+        break;
+    case 1:
+        switch (p2) {
+        case 64:
+            v1 = v1 + ((v2 || i0) <= v1);
+            if (v1) { return ((1 - v3) < (short)(168983029432)); }
+            break;
+        case 7:
+            if ((unsigned short)((int)(10))) { return (p4 != (6 && la0[10])); }
+            p4 = p4 + ((877705932383 / 2) > v0);
+        case 724:
+            break;
+        case 0:
+            break;
+        default:
+            v2 = !((int)((1003591577522 || 2)));
+        case 3:
+            p5 = (unsigned long)((ga1[1] + (274 > 301)));
+            p6 = (long)((int)(p0));
+        case 855:
+            if (!(((ga1[2] < 807) + -(j0)))) {
+                v5 = v5 + ((char)(ga1[0]) || (9L || p0));
+                p6 = p4;
+            } else {
+                if (-(255)) { return (p4 != i0); }
+                if (((548 || 10l) < (j0 - 406))) { return (764 / 3u); }
+            }
+            v2 = (640 <= (854 / (p1 * p1 + 1)));
+        case 984:
+            break;
+        case 41:
+            v2 = v2 + 335;
+            v3 = (int)(j0);
+            break;
+        }
+        if (((p2 == 256ul) < (short)(j0))) { return (v4 && (i0 && 2)); }
+        break;
+    case -4:
+        if (5) {
+            v1 = !(v5);
+        }
+        i0 = (-((2 <= 679936173590)) * (la0[8] + p5));
+        break;
+    }
+    if ((p6 && (v5 > p6))) { return (int)((351 - i0)); }
+    if ((((long)(p0) > (ga1[6] + p0)) / 3u)) {
+        if (!((v0 / 4))) { return (j0 || (395262105097 / 3)); }
+        j0 = !((2 - (v0 != p0)));
+    } else {
+        if ((v4 && (v0 + ga0[4]))) { return (4 != (ga1[1] <= v3)); }
+        for (v1 = 1; v1 < 3; v1 = v1 + 1) {
+            v3 = ((!(932773636885) - p1) && (729L || (p2 != 6)));
+            if (((p3 == !(p3)) / (v5 * v5 + 1))) {
+                j0 = 68230005291;
+            }
+            p5 = p5 + (p5 < !(v1));
+        }
+    }
+    return v1;
+}
+unsigned short f1(unsigned char p0, long p1, unsigned char p2, unsigned short p3, unsigned short p4, unsigned short p5, int p6, int p7) {
+    unsigned int v0 = 8;
+    long v1 = 3;
+    unsigned long v2 = 50;
+    unsigned char v3 = 780;
+    int i0 = 555;
+    long j0 = 2;
+    v0 = ((!(p4) < f0(i0, v0, v0, j0, 112, p6, ga0[1])) <= p6);
+    p4 = ((p5 <= (char)(p1)) == !(1ul));
+    switch (f0(p5, v0, 432L, v1, p0, 2, 7)) {
+    case 4:
+        switch (ga1[0]) {
+        case 5:
+            p6 = ((unsigned int)(p1) && ((126 == 1001384509246) != 4));
+            break;
+        default:
+            p2 = (v2 != p6);
+            v2 = 33;
+            break;
+        }
+        if ((p2 == (long)(ga0[2]))) {
+            p7 = -((long)((p3 * p7)));
+            if (2) {
+                if ((i0 <= 0)) { return 5; }
+            }
+            v1 = v1 + p5;
+        } else {
+            p7 = p4;
+            p0 = p3;
+        }
+    case 6:
+    case 0:
+        p4 = (v1 && (149 * (long)(v2)));
+    }
+    p2 = p2 + (v0 - 859);
+    return (((8 < p1) > (v1 - 1000000007)) - (j0 / 3u));
+}
+unsigned long f2(char p0, unsigned int p1, unsigned char p2, unsigned char p3, long p4, unsigned short p5, unsigned int p6, long p7) {
+    long v0 = 4;
+    long v1 = 751721482017;
+    unsigned short v2 = 175;
+    unsigned short v3 = 6;
+    int v4 = 452687170150;
+    int i0 = 4;
+    long j0 = 32767;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 1L; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 229; }
+    p7 = p7 + (256 * f1(ga0[3], p3, p6, 2, p2, 10, p7, 298));
+    f0((p7 || 32767), (v0 / 16), v2, v0, (short)(7), (p2 - p3), f0(v2, v4, ga1[6], 4294967295, 495000688390, 5, 6));
+    if (((p6 == (p0 / (p2 * p2 + 1))) <= la1[6])) {
+        if (!((p0 < p3))) { return 419; }
+    }
+    if (p1 >= 0 && p1 < 16) { la1[p1] = (!(6) - (8 - p6)); }
+    if ((v0 <= ((4 || v3) + (p0 + p1)))) {
+        if (((p5 >= (i0 == p2)) - (639 / (j0 * j0 + 1)))) {
+            switch (695) {
+            default:
+                f1(la0[6], (char)(ga0[4]), p5, (97149736494 - 891723883102), (790048496517 - p6), p4, 256, (2 > 7));
+                f1(817516979195, (p2 - v1), 1, (long)(v2), (p6 != p1), f0(ga1[7], 10, 837, 0, 3, 4, 4294967295), v0, 194);
+                break;
+            case 52:
+                p5 = -(v3);
+                break;
+            case 956:
+                break;
+            case -5:
+                j0 = (255 <= f1(725, 1, 269, 705, p2, 0, la1[12], v4));
+                p0 = (((v1 * 522) - (p6 * ga0[3])) / 7);
+            case 64:
+                break;
+            case 1:
+                v1 = v2;
+                f0((p7 / (v4 * v4 + 1)), 65536, (p2 - j0), v3, -(4), 893279579942, (ga0[1] > 0));
+            }
+        } else {
+            f1((9 || 606), (char)(235), f1(560u, p7, 227, ga0[2], 8, 604058147494, 855, 128), (p3 - i0), (unsigned short)(v3), (7 - v1), f0(38, 8, 926, la0[1], la0[5], 769, 5U), p2);
+            if (((p4 * 727) >= (p1 != 3))) {
+                f0(672, (j0 / (p1 * p1 + 1)), (p0 == j0), (long)(p0), (p1 || p7), p4, v0);
+            } else {
+                f1((3 && v2), 5U, (short)(10), (101 && p4), (p4 > 255), 7, (unsigned int)(2147483647), (la0[6] < p7));
+            }
+        }
+        if (((1 > 6) + f0(368289392568, p7, v1, ga1[4], 790, 3, j0))) {
+            v4 = 0;
+            while (v4 < 8) {
+                la1[v4] = ga0[6];
+                if (la0[0]) { break; }
+                la0[v4] = -((1000000007 || 0));
+                v4 = v4 + 1;
+            }
+            j0 = j0 + (705105883700 >= j0);
+        } else {
+            if ((f0(710, v3, ga1[3], 1, 663, p6, i0) != ((v0 >= j0) / (p6 * p6 + 1)))) {
+                v4 = v4 + (!(p7) / 1);
+                i0 = i0 + f0(5, 597, 663, 2147483647, p5, 32767, 839);
+                f0(362, (p1 >= 1), 2, (6 != ga1[0]), p4, la0[1], (v1 / 3));
+            } else {
+                f1(p7, 883, (j0 != p7), i0, (v4 / 10), 297, p5, (279 / (p1 * p1 + 1)));
+            }
+            v1 = (1 - ((p4 > 189852978710L) / (p2 * p2 + 1)));
+        }
+    } else {
+        switch (((7 - i0) / (p7 * p7 + 1))) {
+        case 33:
+            switch ((unsigned int)((7 + p2))) {
+            case 2:
+                f0((v2 != p5), 263U, p4, 2, (v2 > p2), j0, 7);
+                p2 = ((!(j0) >= (v0 != v4)) - ((2 - 845) == p4));
+            default:
+                la0[7] = (8 / (v0 * v0 + 1));
+                f0(v0, (ga1[7] * 8), 4, 9, (4 + v1), 143, (15 || v0));
+                break;
+            case 1:
+                break;
+            }
+            p0 = !(-(7));
+            break;
+        case -2:
+            v1 = ((f1(ga1[7], p0, ga1[0], 8, 640, 4, 6, p3) / (j0 * j0 + 1)) < f0(p6, 1056781578098, v0, 619, 183, p7, 5));
+            f1((33U <= 9), j0, (v3 == la1[4]), (7 + la1[1]), (8 / (p3 * p3 + 1)), (la0[5] == 123), (p5 - v4), (v0 <= p0));
+            break;
+        default:
+            break;
+        }
+        i0 = ((f0(v2, 4, 697, ga1[1], 0, la1[9], 6) / (v1 * v1 + 1)) != ((j0 / 7) >= f1(v1, p4, i0, p0, la1[7], 825, 964920975049, p7)));
+    }
+    la1[3] = ((v4 * la0[4]) - f0(ga0[0], la1[10], ga0[6], v2, i0, j0, v2));
+    return (short)(f0(p2, p2, 521021368218U, p5, p3, 7u, 109));
+}
+int main() {
+    unsigned long v0 = 9;
+    char v1 = 8U;
+    short v2 = 878008391360;
+    int i0 = 583;
+    long j0 = 90;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 8; }
+    v2 = f0(v2, (v0 + i0), j0, (short)(0), (9l <= 10), (j0 == 132l), v0);
+    if (v2 >= 0 && v2 < 8) { ga1[v2] = 128u; }
+    for (j0 = 2; j0 < 100; j0 = j0 + 1) {
+        switch ((392 && 6)) {
+        case 0:
+            v0 = (((j0 != 256) / 10) + ((j0 || ga1[6]) <= v1));
+            v0 = v0 + v2;
+            break;
+        case 10:
+            if ((f0(473433573960, v1, ga0[7], v1, 10, ga0[4], ga0[0]) > f1(5, j0, j0, ga0[4], 10, ga0[5], 1, v0))) {
+                if (j0) { return f0(1u, 429U, v2, 3, v2, v1, 255); }
+                v2 = v2 + !(f0(233, ga0[6], 793672734524, v0, 896819921706, v2, i0));
+            }
+            if ((v2 * 383963489203)) {
+                v1 = v1 + !((4 && v1));
+                v2 = (short)(((j0 <= v0) * !(i0)));
+                if (v0) { break; }
+            }
+        }
+        v1 = v1;
+        f0(!(v2), !(2), (v0 != j0), (j0 - 279920163597), (i0 || 961780643344), 1000000007, i0);
+    }
+    if (4294967295) {
+        if (v2 >= 0 && v2 < 8) { ga0[v2] = (5l < f1(v1, 9, 2, v2, v2, 259, 8, ga0[2])); }
+        f1((178957347560 - j0), !(9), !(i0), j0, (unsigned int)(803), (i0 >= 256), (int)(8), v0);
+        j0 = ((v1 - (0 / (v1 * v1 + 1))) != ((v0 < i0) > (v1 != v2)));
+    }
+    f2((269 && 0), v2, 2L, 305, (char)(v0), (v2 - v0), 479, (v1 - 4));
+    f1(la0[3], (ga1[6] > ga1[6]), i0, f0(ga1[3], v2, j0, v1, v2, i0, i0), (9 != j0), (v1 - 4), 906, (4 / 8));
+    i0 = (32767 >= (-(682) + v2));
+    for (i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = v2 + !(f0(v1, 671, v2, 6, 8, 7, 973));
+    }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,3622 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 32
+	.p2align 5
+ga1:
+	.zero 32
+	.section .text
+	.type f0, @function
+	.type f1, @function
+	.type f0.constprop.0, @function
+	.type f1.constprop.1, @function
+	.type f1.constprop.2, @function
+	.global main
+	.type main, @function
+	.type f2, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movb %dl, -17(%rbp)
+	movb %cl, -18(%rbp)
+	movl %r8d, -24(%rbp)
+	movl %r9d, -28(%rbp)
+	movl $4, -32(%rbp)
+	movl $128, -36(%rbp)
+	movb $8, -37(%rbp)
+	movb $6, -38(%rbp)
+	movw $2, -40(%rbp)
+	movl $4, -44(%rbp)
+	movl $537, -48(%rbp)
+	movq $5, -56(%rbp)
+	movl $0, -48(%rbp)
+	imull $166, -48(%rbp), %eax
+	subl $166, %eax
+	movl %eax, -132(%rbp)
+	cmpl $16, -48(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $166, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $166, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $166, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	addl $166, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -144(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -48(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $166, -132(%rbp)
+	movslq -48(%rbp), %rax
+	movl -132(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L4
+.L5:
+	movb $107, -37(%rbp)
+	cmpl $0, -36(%rbp)
+	jne .LB0
+.L6:
+.L7:
+	imulq $7, -56(%rbp), %rax
+	movw %ax, -40(%rbp)
+	movl $22, %eax
+	movslq %eax, %rax
+	cmpq $46, %rax
+	jge .L14
+	cmpq $-4, %rax
+	je .L13
+	cmpq $1, %rax
+	je .L12
+	cmpq $42, %rax
+	je .L11
+	jmp .L8
+.L14:
+	cmpq $46, %rax
+	je .L10
+	cmpq $54, %rax
+	je .L9
+	cmpq $978, %rax
+	je .L11
+	jmp .L8
+.L13:
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl -96(%rbp), %eax
+	addl -28(%rbp), %eax
+	imull $4294967295, %eax, %eax
+	movl %eax, -48(%rbp)
+.L8:
+	cmpq $0, 16(%rbp)
+	je .L72
+	movslq -44(%rbp), %rax
+	cmpq 16(%rbp), %rax
+	jg .LB1
+.L72:
+.L73:
+	movl ga1+24(%rip), %eax
+	movslq %eax, %rax
+	addq -8(%rbp), %rax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	cmpq %rcx, %rax
+	seta %al
+	movzbl %al, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	testl %eax, %eax
+	je .L74
+	movl -32(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L76
+	cmpq $0, -56(%rbp)
+	jne .L78
+	movabsq $131754035032, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L74:
+	cmpw $0, -40(%rbp)
+	je .L80
+	movl ga0+16(%rip), %eax
+	addl -32(%rbp), %eax
+	jne .LB2
+.L80:
+.L81:
+	movl $1, -36(%rbp)
+	movl $1, -172(%rbp)
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -176(%rbp)
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	je .L82
+	cmpl $0, -172(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L83
+.L82:
+	movl $0, %eax
+.L83:
+	movb %al, -38(%rbp)
+	cmpb $0, -18(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -18(%rbp), %eax
+	movl %eax, -180(%rbp)
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -176(%rbp)
+	testl %eax, %eax
+	je .L84
+	movabsq $68230005291, %rax
+	movq %rax, -56(%rbp)
+.L84:
+.L85:
+	cmpl $0, -28(%rbp)
+	setb %al
+	movzbl %al, %eax
+	addl %eax, -28(%rbp)
+	movzbl -38(%rbp), %eax
+	movb %al, -38(%rbp)
+	cmpb $0, -18(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -180(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -176(%rbp)
+	testl %eax, %eax
+	je .L86
+	movabsq $68230005291, %rax
+	movq %rax, -56(%rbp)
+.L86:
+.L87:
+	cmpl $0, -28(%rbp)
+	setb %al
+	movzbl %al, %eax
+	addl %eax, -28(%rbp)
+	movl $3, -36(%rbp)
+.L75:
+	movl -36(%rbp), %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L10:
+	movl $475, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L23
+	leaq .L24(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L17
+	# table target .L18
+	# table target .L22
+	# table target .L19
+	# table target .L20
+	# table target .L21
+	jmp *%rcx
+.L76:
+.L77:
+	movslq -32(%rbp), %rax
+	cmpq -8(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	jmp .L75
+.L9:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testb %al, %al
+	jne .L15
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L16
+.L15:
+	movl $1, %eax
+.L16:
+	movb %al, -18(%rbp)
+	movzbl -17(%rbp), %eax
+	movl %eax, -24(%rbp)
+	jmp .L8
+.L23:
+.L17:
+	movq $1, -16(%rbp)
+	movl -32(%rbp), %eax
+	imull -32(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -152(%rbp)
+	cmpl $5, -44(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movsbl -37(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -38(%rbp), %eax
+	addl $1, %eax
+	cmpl $1196, %eax
+	setg %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movl %eax, -156(%rbp)
+	cmpl $0, -44(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -160(%rbp)
+	cmpq $5, -16(%rbp)
+	jae .L8
+	.p2align 4,,10
+.L37:
+	cmpl $0, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -152(%rbp)
+	addl %eax, -36(%rbp)
+	movl -32(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $44, %rax
+	je .L42
+	cmpq $681, %rax
+	je .L41
+.L40:
+.L39:
+	addq $1, -16(%rbp)
+	cmpq $5, -16(%rbp)
+	jb .L37
+.L38:
+	jmp .L8
+.L42:
+	cmpl $0, -160(%rbp)
+	je .L43
+	jmp .L39
+.L41:
+	movl -156(%rbp), %eax
+	movw %ax, -40(%rbp)
+	jmp .L39
+.L43:
+.L44:
+	cmpb $0, -18(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movl %eax, -48(%rbp)
+	jmp .L39
+.L12:
+	movzbl -17(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $64, %rax
+	jge .L55
+	cmpq $7, %rax
+	jge .L56
+	cmpq $0, %rax
+	je .L45
+	cmpq $3, %rax
+	je .L51
+	jmp .L50
+.L55:
+	cmpq $855, %rax
+	jge .L57
+	cmpq $64, %rax
+	je .L46
+	cmpq $724, %rax
+	je .L45
+	jmp .L50
+.L56:
+	cmpq $7, %rax
+	je .L47
+	cmpq $41, %rax
+	je .L54
+.L50:
+	movb $0, -37(%rbp)
+.L51:
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	movl %eax, -28(%rbp)
+	movq -8(%rbp), %rax
+	movslq %eax, %rax
+	movq %rax, 16(%rbp)
+.L52:
+	xorl %eax, %eax
+	subq -56(%rbp), %rax
+	movq %rax, %rcx
+	movl ga1+8(%rip), %eax
+	cmpl $807, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rcx, %rax
+	jne .L62
+	movl ga1+0(%rip), %eax
+	testb %al, %al
+	jne .L64
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L65
+.L64:
+	movl $1, %eax
+.L65:
+	addl %eax, -44(%rbp)
+	movl -24(%rbp), %eax
+	movq %rax, 16(%rbp)
+.L63:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $854, %eax
+	xorl %edx, %edx
+	divq %rcx
+	cmpq $640, %rax
+	setae %al
+	movzbl %al, %eax
+	movb %al, -37(%rbp)
+.L53:
+.L45:
+	movq -56(%rbp), %rax
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movzbl -17(%rbp), %eax
+	cmpq $256, %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jge .L8
+	cmpw $0, -40(%rbp)
+	je .L68
+	cmpl $0, -48(%rbp)
+	je .L70
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L66:
+.L67:
+	jmp .L8
+.L57:
+	cmpq $855, %rax
+	je .L52
+	cmpq $984, %rax
+	je .L53
+	jmp .L50
+.L70:
+	movl $0, %eax
+.L71:
+	jmp .f0_return
+.L46:
+	cmpb $0, -37(%rbp)
+	jne .L58
+	cmpl $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L59
+.L58:
+	movl $1, %eax
+.L59:
+	cmpl -36(%rbp), %eax
+	setbe %al
+	movzbl %al, %eax
+	addl %eax, -36(%rbp)
+	jne .LB3
+.L60:
+.L61:
+	jmp .L45
+.L49:
+	jmp .L45
+.L54:
+	movsbl -37(%rbp), %eax
+	addl $335, %eax
+	movb %al, -37(%rbp)
+	movq -56(%rbp), %rax
+	movb %al, -38(%rbp)
+	jmp .L45
+.L48:
+	jmp .L45
+.L18:
+	jmp .L17
+.L19:
+	cmpl $0, -24(%rbp)
+	jb .L17
+	cmpl $16, -24(%rbp)
+	jae .L17
+	movl -48(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga1+4(%rip), %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	movl %ecx, -128(%rbp,%rax,4)
+.L25:
+.L26:
+	jmp .L17
+.L20:
+	movslq -48(%rbp), %rax
+	addq %rax, 16(%rbp)
+	xorl %eax, %eax
+	subl -36(%rbp), %eax
+	movq %rax, 16(%rbp)
+	jmp .L17
+.L21:
+	movzbl -18(%rbp), %eax
+	movl %eax, -148(%rbp)
+	testl %eax, %eax
+	jl .L27
+	cmpl $16, -148(%rbp)
+	jge .L27
+	movl -36(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -18(%rbp), %eax
+	movl %ecx, -128(%rbp,%rax,4)
+.L27:
+.L28:
+	movl ga1+8(%rip), %eax
+	testl %eax, %eax
+	jne .LB4
+.L29:
+.L30:
+	jmp .L17
+.L22:
+	movl -48(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	cmpl $10, %eax
+	jl .L31
+	movl -28(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	subl %ecx, %eax
+	addq -16(%rbp), %rax
+	movb %al, -37(%rbp)
+.L35:
+.L36:
+.L32:
+	movq $527, 16(%rbp)
+	jmp .L17
+.LB0:
+	movl $910, %eax
+	jmp .f0_return
+.L78:
+	movl $1, %eax
+.L79:
+	jmp .f0_return
+.LB1:
+	movl $351, %eax
+	subl -48(%rbp), %eax
+	jmp .f0_return
+.L11:
+	movl $2, -36(%rbp)
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movl $449, -28(%rbp)
+	movq -168(%rbp), %rax
+	jmp .f0_return
+.LB2:
+	movl ga1+4(%rip), %eax
+	movzbl -38(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L68:
+	movl $0, %eax
+.L69:
+	jmp .f0_return
+.L62:
+	movl -48(%rbp), %eax
+	cmpl %eax, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L31:
+	cmpq $0, -8(%rbp)
+	jne .LB5
+.L33:
+.L34:
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L35
+	movzbl -18(%rbp), %eax
+	jmp .f0_return
+.L47:
+	movl -88(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl %eax, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB4:
+	movl $9, %eax
+	jmp .f0_return
+.LB3:
+	movl $1, %eax
+	movzbl -38(%rbp), %ecx
+	subl %ecx, %eax
+	cmpl $26296, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB5:
+	movq -56(%rbp), %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L24:
+	.long .L18-.L24
+	.long .L22-.L24
+	.long .L19-.L24
+	.long .L17-.L24
+	.long .L17-.L24
+	.long .L17-.L24
+	.long .L17-.L24
+	.long .L20-.L24
+	.long .L21-.L24
+	.popsection
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb %dil, -48(%rbp)
+	movq %rsi, -32(%rbp)
+	movb %dl, -47(%rbp)
+	movw %cx, -46(%rbp)
+	movw %r8w, -44(%rbp)
+	movw %r9w, -42(%rbp)
+	movl $8, -40(%rbp)
+	movq $3, -24(%rbp)
+	movq $50, -16(%rbp)
+	movl $555, -36(%rbp)
+	movq $2, -8(%rbp)
+	subq $8, %rsp
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl 16(%rbp), %eax
+	movq %rax, %r9
+	movl $112, %eax
+	movq %rax, %r8
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	movq %rax, %rsi
+	movslq -36(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	cmpw $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	cmpl 16(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	movl $1, %eax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzwl -42(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -44(%rbp)
+	movl $7, %eax
+	movq %rax, %r9
+	movl $2, %eax
+	movq %rax, %r8
+	movzbl -48(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -42(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L90
+	cmpq $4, %rax
+	je .L89
+	cmpq $6, %rax
+	je .L90
+	jmp .L88
+.L96:
+	movzwl -44(%rbp), %eax
+	movl %eax, 24(%rbp)
+	movzwl -46(%rbp), %eax
+.L97:
+.L90:
+	cmpq $0, -24(%rbp)
+	je .L102
+	movq -16(%rbp), %rax
+	imulq $149, %rax, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L103
+.L102:
+	movl $0, %eax
+.L103:
+.L88:
+	movl -40(%rbp), %eax
+	subl $859, %eax
+	movq %rax, %rcx
+	movzbl -47(%rbp), %eax
+	addl %ecx, %eax
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	subq $1000000007, %rax
+	movq %rax, %rcx
+	cmpq $8, -32(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	subq %rcx, %rax
+.f1_return:
+	leave
+	ret
+.L89:
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L92
+.L93:
+	movslq 16(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movb %al, -47(%rbp)
+	movq $33, -16(%rbp)
+	jmp .L91
+.L92:
+	movq -32(%rbp), %rax
+	testl %eax, %eax
+	je .L94
+	movabsq $1001384509246, %rax
+	cmpq $126, %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L95
+.L94:
+	movl $0, %eax
+.L95:
+	movl %eax, 16(%rbp)
+.L91:
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movzbl -47(%rbp), %eax
+	cmpq %rcx, %rax
+	jne .L96
+	movzwl -46(%rbp), %eax
+	imull 24(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, 24(%rbp)
+	movl $2, %eax
+	testl %eax, %eax
+	je .L98
+	cmpl $0, -36(%rbp)
+	jle .LB6
+.L100:
+.L101:
+.L98:
+.L99:
+	movzwl -42(%rbp), %eax
+	addq %rax, -24(%rbp)
+	jmp .L97
+.LB6:
+	movl $5, %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movb %dl, -17(%rbp)
+	movl %ecx, -24(%rbp)
+	movl %r8d, -28(%rbp)
+	movq %r9, -40(%rbp)
+	movl $4, -44(%rbp)
+	movl $128, -48(%rbp)
+	movb $8, -49(%rbp)
+	movb $6, -50(%rbp)
+	movw $2, -52(%rbp)
+	movl $4, -56(%rbp)
+	movl $537, -60(%rbp)
+	movq $5, -72(%rbp)
+	movl $0, -60(%rbp)
+	imull $166, -60(%rbp), %eax
+	subl $166, %eax
+	movl %eax, -148(%rbp)
+	cmpl $16, -60(%rbp)
+	jge .L104
+	movl $16, %eax
+	movslq -60(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L107
+	.p2align 4,,10
+.L106:
+	addl $166, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $166, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $166, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	addl $166, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	subq $1, -160(%rbp)
+	jne .L106
+.L107:
+.L104:
+.L105:
+	cmpl $16, -60(%rbp)
+	jge .L109
+	.p2align 4,,10
+.L108:
+	addl $166, -148(%rbp)
+	movslq -60(%rbp), %rax
+	movl -148(%rbp), %ecx
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -60(%rbp)
+	cmpl $16, -60(%rbp)
+	jl .L108
+.L109:
+	movb $107, -49(%rbp)
+	cmpl $0, -48(%rbp)
+	jne .LB7
+.L110:
+.L111:
+	imulq $7, -72(%rbp), %rax
+	movw %ax, -52(%rbp)
+	movl $22, %eax
+	movslq %eax, %rax
+	cmpq $46, %rax
+	jge .L118
+	cmpq $-4, %rax
+	je .L117
+	cmpq $1, %rax
+	je .L116
+	cmpq $42, %rax
+	je .L115
+	jmp .L112
+.L118:
+	cmpq $46, %rax
+	je .L114
+	cmpq $54, %rax
+	je .L113
+	cmpq $978, %rax
+	je .L115
+	jmp .L112
+.L117:
+	cmpl $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -48(%rbp)
+	movl -112(%rbp), %eax
+	addl -28(%rbp), %eax
+	imull $4294967295, %eax, %eax
+	movl %eax, -60(%rbp)
+.L112:
+	cmpq $0, -40(%rbp)
+	je .L192
+	movslq -56(%rbp), %rax
+	cmpq -40(%rbp), %rax
+	jg .LB8
+.L192:
+.L193:
+	movl ga1+24(%rip), %eax
+	movslq %eax, %rax
+	addq -8(%rbp), %rax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	cmpq %rcx, %rax
+	seta %al
+	movzbl %al, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	testl %eax, %eax
+	je .L194
+	movl -44(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	jne .L196
+	cmpq $0, -72(%rbp)
+	jne .L198
+	movabsq $131754035032, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L194:
+	cmpw $0, -52(%rbp)
+	je .L200
+	movl ga0+16(%rip), %eax
+	addl -44(%rbp), %eax
+	jne .LB9
+.L200:
+.L201:
+	movl $1, -48(%rbp)
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	je .L202
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L203
+.L202:
+	movl $0, %eax
+.L203:
+	movl %eax, -196(%rbp)
+	movl -56(%rbp), %eax
+	imull -56(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -200(%rbp)
+	movl -196(%rbp), %eax
+	movb %al, -50(%rbp)
+	cmpb $0, -17(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -17(%rbp), %eax
+	movl %eax, -204(%rbp)
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -200(%rbp)
+	testl %eax, %eax
+	je .L204
+	movabsq $68230005291, %rax
+	movq %rax, -72(%rbp)
+.L204:
+.L205:
+	cmpl $0, -28(%rbp)
+	setb %al
+	movzbl %al, %eax
+	addl %eax, -28(%rbp)
+	movzbl -50(%rbp), %eax
+	movb %al, -50(%rbp)
+	cmpb $0, -17(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -204(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -200(%rbp)
+	testl %eax, %eax
+	je .L206
+	movabsq $68230005291, %rax
+	movq %rax, -72(%rbp)
+.L206:
+.L207:
+	cmpl $0, -28(%rbp)
+	setb %al
+	movzbl %al, %eax
+	addl %eax, -28(%rbp)
+	movl $3, -48(%rbp)
+.L195:
+	movl -48(%rbp), %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L114:
+	movl $475, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L127
+	leaq .L128(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L121
+	# table target .L122
+	# table target .L126
+	# table target .L123
+	# table target .L124
+	# table target .L125
+	jmp *%rcx
+.L196:
+.L197:
+	movslq -44(%rbp), %rax
+	cmpq -8(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -72(%rbp)
+	jmp .L195
+.L113:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testb %al, %al
+	jne .L119
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L120
+.L119:
+	movl $1, %eax
+.L120:
+	movb %al, -17(%rbp)
+	movl $176, -24(%rbp)
+	jmp .L112
+.L127:
+.L121:
+	movq $1, -16(%rbp)
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -168(%rbp)
+	cmpl $5, -56(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movsbl -49(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movzbl -50(%rbp), %eax
+	addl $1, %eax
+	cmpl $1196, %eax
+	setg %al
+	movzbl %al, %eax
+	subl %ecx, %eax
+	movl %eax, -172(%rbp)
+	cmpl $0, -56(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -176(%rbp)
+	cmpq $5, -16(%rbp)
+	jae .L141
+	movl $5, %eax
+	subq -16(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L144
+	.p2align 4,,10
+.L143:
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -168(%rbp)
+	addl %eax, -48(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $44, %rax
+	je .L148
+	cmpq $681, %rax
+	je .L147
+.L146:
+.L145:
+	addq $1, -16(%rbp)
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -168(%rbp)
+	addl %eax, -48(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $44, %rax
+	je .L154
+	cmpq $681, %rax
+	je .L153
+.L152:
+.L151:
+	addq $1, -16(%rbp)
+	subq $1, -184(%rbp)
+	jne .L143
+.L144:
+.L141:
+.L142:
+	cmpq $5, -16(%rbp)
+	jae .L112
+	.p2align 4,,10
+.L157:
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl -168(%rbp)
+	addl %eax, -48(%rbp)
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $44, %rax
+	je .L162
+	cmpq $681, %rax
+	je .L161
+.L160:
+.L159:
+	addq $1, -16(%rbp)
+	cmpq $5, -16(%rbp)
+	jb .L157
+.L158:
+	jmp .L112
+.L162:
+	cmpl $0, -176(%rbp)
+	je .L163
+	jmp .L159
+.L148:
+	cmpl $0, -176(%rbp)
+	je .L149
+	jmp .L145
+.L154:
+	cmpl $0, -176(%rbp)
+	je .L155
+	jmp .L151
+.L161:
+	movl -172(%rbp), %eax
+	movw %ax, -52(%rbp)
+	jmp .L159
+.L163:
+.L164:
+	cmpb $0, -17(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movl %eax, -60(%rbp)
+	jmp .L159
+.L147:
+	movl -172(%rbp), %eax
+	movw %ax, -52(%rbp)
+	jmp .L145
+.L149:
+.L150:
+	cmpb $0, -17(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movl %eax, -60(%rbp)
+	jmp .L145
+.L153:
+	movl -172(%rbp), %eax
+	movw %ax, -52(%rbp)
+	jmp .L151
+.L155:
+.L156:
+	cmpb $0, -17(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movl %eax, -60(%rbp)
+	jmp .L151
+.L116:
+	movl $176, %eax
+	movslq %eax, %rax
+	cmpq $64, %rax
+	jge .L175
+	cmpq $7, %rax
+	jge .L176
+	cmpq $0, %rax
+	je .L165
+	cmpq $3, %rax
+	je .L171
+	jmp .L170
+.L175:
+	cmpq $855, %rax
+	jge .L177
+	cmpq $64, %rax
+	je .L166
+	cmpq $724, %rax
+	je .L165
+	jmp .L170
+.L176:
+	cmpq $7, %rax
+	je .L167
+	cmpq $41, %rax
+	je .L174
+.L170:
+	movb $0, -49(%rbp)
+.L171:
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	movl %eax, -28(%rbp)
+	movq -8(%rbp), %rax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L172:
+	xorl %eax, %eax
+	subq -72(%rbp), %rax
+	movq %rax, %rcx
+	movl ga1+8(%rip), %eax
+	cmpl $807, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rcx, %rax
+	jne .L182
+	movl ga1+0(%rip), %eax
+	testb %al, %al
+	jne .L184
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L185
+.L184:
+	movl $1, %eax
+.L185:
+	addl %eax, -56(%rbp)
+	movl -24(%rbp), %eax
+	movq %rax, -40(%rbp)
+.L183:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $854, %eax
+	xorl %edx, %edx
+	divq %rcx
+	cmpq $640, %rax
+	setae %al
+	movzbl %al, %eax
+	movb %al, -49(%rbp)
+.L173:
+.L165:
+	movq -72(%rbp), %rax
+	movswl %ax, %eax
+	testl %eax, %eax
+	jle .L112
+	cmpw $0, -52(%rbp)
+	je .L188
+	cmpl $0, -60(%rbp)
+	je .L190
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L186:
+.L187:
+	jmp .L112
+.L177:
+	cmpq $855, %rax
+	je .L172
+	cmpq $984, %rax
+	je .L173
+	jmp .L170
+.L190:
+	movl $0, %eax
+.L191:
+	jmp .f0.constprop.0_return
+.L166:
+	cmpb $0, -49(%rbp)
+	jne .L178
+	cmpl $0, -60(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L179
+.L178:
+	movl $1, %eax
+.L179:
+	cmpl -48(%rbp), %eax
+	setbe %al
+	movzbl %al, %eax
+	addl %eax, -48(%rbp)
+	jne .LB10
+.L180:
+.L181:
+	jmp .L165
+.L169:
+	jmp .L165
+.L174:
+	movsbl -49(%rbp), %eax
+	addl $335, %eax
+	movb %al, -49(%rbp)
+	movq -72(%rbp), %rax
+	movb %al, -50(%rbp)
+	jmp .L165
+.L168:
+	jmp .L165
+.L122:
+	jmp .L121
+.L123:
+	cmpl $0, -24(%rbp)
+	jb .L121
+	cmpl $16, -24(%rbp)
+	jae .L121
+	movl -60(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga1+4(%rip), %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	movl %ecx, -144(%rbp,%rax,4)
+.L129:
+.L130:
+	jmp .L121
+.L124:
+	movslq -60(%rbp), %rax
+	addq %rax, -40(%rbp)
+	xorl %eax, %eax
+	subl -48(%rbp), %eax
+	movq %rax, -40(%rbp)
+	jmp .L121
+.L125:
+	movzbl -17(%rbp), %eax
+	movl %eax, -164(%rbp)
+	testl %eax, %eax
+	jl .L131
+	cmpl $16, -164(%rbp)
+	jge .L131
+	movl -48(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -17(%rbp), %eax
+	movl %ecx, -144(%rbp,%rax,4)
+.L131:
+.L132:
+	movl ga1+8(%rip), %eax
+	testl %eax, %eax
+	jne .LB11
+.L133:
+.L134:
+	jmp .L121
+.L126:
+	movl -60(%rbp), %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	cmpl $10, %eax
+	jl .L135
+	movl -28(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	subl %ecx, %eax
+	addq -16(%rbp), %rax
+	movb %al, -49(%rbp)
+.L139:
+.L140:
+.L136:
+	movq $527, -40(%rbp)
+	jmp .L121
+.LB7:
+	movl $910, %eax
+	jmp .f0.constprop.0_return
+.L198:
+	movl $1, %eax
+.L199:
+	jmp .f0.constprop.0_return
+.LB8:
+	movl $351, %eax
+	subl -60(%rbp), %eax
+	jmp .f0.constprop.0_return
+.L115:
+	movl $2, -48(%rbp)
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movl $449, -28(%rbp)
+	movq -192(%rbp), %rax
+	jmp .f0.constprop.0_return
+.LB9:
+	movl ga1+4(%rip), %eax
+	movzbl -50(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	cmpl $4, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L188:
+	movl $0, %eax
+.L189:
+	jmp .f0.constprop.0_return
+.L182:
+	movl -60(%rbp), %eax
+	cmpl %eax, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L135:
+	cmpq $0, -8(%rbp)
+	jne .LB12
+.L137:
+.L138:
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L139
+	movzbl -17(%rbp), %eax
+	jmp .f0.constprop.0_return
+.L167:
+	movl -104(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl %eax, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.LB11:
+	movl $9, %eax
+	jmp .f0.constprop.0_return
+.LB10:
+	movl $1, %eax
+	movzbl -50(%rbp), %ecx
+	subl %ecx, %eax
+	cmpl $26296, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.LB12:
+	movq -72(%rbp), %rax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L128:
+	.long .L122-.L128
+	.long .L126-.L128
+	.long .L123-.L128
+	.long .L121-.L128
+	.long .L121-.L128
+	.long .L121-.L128
+	.long .L121-.L128
+	.long .L124-.L128
+	.long .L125-.L128
+	.popsection
+	.align 16
+f1.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movb %dil, -44(%rbp)
+	movb %sil, -43(%rbp)
+	movw %dx, -42(%rbp)
+	movl %ecx, -40(%rbp)
+	movl %r8d, -36(%rbp)
+	movl $8, -32(%rbp)
+	movq $3, -24(%rbp)
+	movq $50, -16(%rbp)
+	movl $555, -28(%rbp)
+	movq $2, -8(%rbp)
+	subq $8, %rsp
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl %ecx, %eax
+	movq %rax, %r9
+	movl $112, %eax
+	movq %rax, %r8
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	movq %rax, %rdx
+	movl -32(%rbp), %eax
+	movq %rax, %rsi
+	movslq -28(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	cmpw $0, -42(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	cmpl -40(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -32(%rbp)
+	movw $0, -42(%rbp)
+	movl $7, %eax
+	movq %rax, %r9
+	movl $2, %eax
+	movq %rax, %r8
+	movzbl -44(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl -32(%rbp), %eax
+	movq %rax, %rsi
+	movl $10, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L210
+	cmpq $4, %rax
+	je .L209
+	cmpq $6, %rax
+	je .L210
+	jmp .L208
+.L214:
+	movzwl -42(%rbp), %eax
+.L215:
+.L210:
+	cmpq $0, -24(%rbp)
+	je .L218
+	movq -16(%rbp), %rax
+	imulq $149, %rax, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L219
+.L218:
+	movl $0, %eax
+.L219:
+.L208:
+	movl -32(%rbp), %eax
+	subl $859, %eax
+	movq %rax, %rcx
+	movzbl -43(%rbp), %eax
+	addl %ecx, %eax
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	subq $1000000007, %rax
+	cmpq $1, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	subq %rcx, %rax
+.f1.constprop.1_return:
+	leave
+	ret
+.L209:
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L212
+.L213:
+	movslq -40(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movb %al, -43(%rbp)
+	movq $33, -16(%rbp)
+	jmp .L211
+.L212:
+.L211:
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movzbl -43(%rbp), %eax
+	cmpq %rcx, %rax
+	jne .L214
+	imull $2, -36(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	cmpl $0, -28(%rbp)
+	jle .LB13
+.L216:
+.L217:
+	addq $10, -24(%rbp)
+	jmp .L215
+.LB13:
+	movl $5, %eax
+	jmp .f1.constprop.1_return
+	.size f1.constprop.1, .-f1.constprop.1
+	.align 16
+f1.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movb %dil, -50(%rbp)
+	movq %rsi, -32(%rbp)
+	movb %dl, -49(%rbp)
+	movw %cx, -48(%rbp)
+	movw %r8w, -46(%rbp)
+	movl %r9d, -44(%rbp)
+	movl $8, -40(%rbp)
+	movq $3, -24(%rbp)
+	movq $50, -16(%rbp)
+	movl $555, -36(%rbp)
+	movq $2, -8(%rbp)
+	subq $8, %rsp
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl %r9d, %eax
+	movq %rax, %r9
+	movl $112, %eax
+	movq %rax, %r8
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movl -40(%rbp), %eax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	movq %rax, %rsi
+	movslq -36(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	cmpw $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	cmpl -44(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -40(%rbp)
+	movq -32(%rbp), %rax
+	movsbl %al, %eax
+	movq %rax, %rcx
+	movzwl -46(%rbp), %eax
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -48(%rbp)
+	movl $7, %eax
+	movq %rax, %r9
+	movl $2, %eax
+	movq %rax, %r8
+	movzbl -50(%rbp), %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl -40(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -46(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L222
+	cmpq $4, %rax
+	je .L221
+	cmpq $6, %rax
+	je .L222
+	jmp .L220
+.L228:
+	movzwl -48(%rbp), %eax
+	movl %eax, 16(%rbp)
+.L229:
+.L222:
+	cmpq $0, -24(%rbp)
+	je .L232
+	movq -16(%rbp), %rax
+	imulq $149, %rax, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L233
+.L232:
+	movl $0, %eax
+.L233:
+.L220:
+	movl -40(%rbp), %eax
+	subl $859, %eax
+	movq %rax, %rcx
+	movzbl -49(%rbp), %eax
+	addl %ecx, %eax
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	subq $1000000007, %rax
+	movq %rax, %rcx
+	cmpq $8, -32(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	subq %rcx, %rax
+.f1.constprop.2_return:
+	leave
+	ret
+.L221:
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $5, %rax
+	je .L224
+.L225:
+	movslq -44(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movb %al, -49(%rbp)
+	movq $33, -16(%rbp)
+	jmp .L223
+.L224:
+	movq -32(%rbp), %rax
+	testl %eax, %eax
+	je .L226
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L227
+.L226:
+	movl $0, %eax
+.L227:
+.L223:
+	movl ga0+8(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movzbl -49(%rbp), %eax
+	cmpq %rcx, %rax
+	jne .L228
+	imull $46032, 16(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl %eax, 16(%rbp)
+	cmpl $0, -36(%rbp)
+	jle .LB14
+.L230:
+.L231:
+	movzwl -46(%rbp), %eax
+	addq %rax, -24(%rbp)
+	jmp .L229
+.LB14:
+	movl $5, %eax
+	jmp .f1.constprop.2_return
+	.size f1.constprop.2, .-f1.constprop.2
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movq $9, -40(%rbp)
+	movb $8, -71(%rbp)
+	movw $-10560, -70(%rbp)
+	movq $90, -32(%rbp)
+	movl $0, -52(%rbp)
+	movl $8, -56(%rbp)
+	movl $16, -60(%rbp)
+	movl $24, -64(%rbp)
+	movl $4, -68(%rbp)
+	subq $8, %rsp
+	movq -40(%rbp), %rax
+	pushq %rax
+	cmpq $132, -32(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movl $1, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movslq -68(%rbp), %rax
+	movq %rax, -24(%rbp)
+	addq -40(%rbp), %rax
+	movq %rax, %rsi
+	movswq -70(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movw %ax, -70(%rbp)
+	movswl -70(%rbp), %eax
+	movl %eax, -8(%rbp)
+	testl %eax, %eax
+	jl .L234
+	cmpl $8, -8(%rbp)
+	jge .L234
+	movswq -70(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl $128, (%rdx,%rax,4)
+.L234:
+.L235:
+	movq $2, -32(%rbp)
+	movl $1, -44(%rbp)
+	cmpl $0, -68(%rbp)
+	jne .L236
+	movabsq $961780643344, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L237
+.L236:
+	movl $1, %eax
+.L237:
+	movl %eax, -8(%rbp)
+	cmpq $100, -32(%rbp)
+	jge .L239
+	.p2align 4,,10
+.L238:
+	movl -44(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L241
+	cmpq $10, %rax
+	je .L242
+	jmp .L240
+.L241:
+	cmpq $0, -32(%rbp)
+	jne .L243
+	movl ga1+24(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L244
+.L243:
+	movl $1, %eax
+.L244:
+	movsbl -71(%rbp), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpq $256, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movswq -70(%rbp), %rax
+	addq %rax, -40(%rbp)
+.L249:
+.L250:
+.L240:
+	subq $8, %rsp
+	movslq -68(%rbp), %rax
+	pushq %rax
+	movl $1000000007, %eax
+	movq %rax, %r9
+	movl -8(%rbp), %eax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movabsq $279920163597, %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cmpq %rax, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	cmpw $0, -70(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jl .L238
+.L239:
+	movswl -70(%rbp), %eax
+	movl %eax, -48(%rbp)
+	testl %eax, %eax
+	jl .L253
+	cmpl $8, -48(%rbp)
+	jge .L253
+	movl ga0+8(%rip), %eax
+	pushq %rax
+	movl $8, %eax
+	pushq %rax
+	movl $259, %eax
+	movq %rax, %r9
+	movswl -70(%rbp), %eax
+	movw %ax, -8(%rbp)
+	movq %rax, %r8
+	movzwl -8(%rbp), %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movsbl -71(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzwl %ax, %eax
+	cmpq $5, %rax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -70(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L253:
+.L254:
+	movq -40(%rbp), %rax
+	pushq %rax
+	movl $8, %eax
+	pushq %rax
+	cmpl $256, -68(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movl $803, %eax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	cmpl $0, -68(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movabsq $178957347560, %rax
+	subq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movsbl -71(%rbp), %eax
+	movl %eax, -16(%rbp)
+	cmpl -48(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	cmpq -24(%rbp), %rax
+	setb %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	imull -16(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movl -16(%rbp), %eax
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	movslq %eax, %rax
+	movq %rax, %r9
+	movswq -70(%rbp), %rax
+	movq %rax, -8(%rbp)
+	subq -40(%rbp), %rax
+	movq %rax, %r8
+	movq -40(%rbp), %rax
+	movsbq %al, %rax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movswl -70(%rbp), %eax
+	movl %eax, -44(%rbp)
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f2
+	xorl %eax, %eax
+	pushq %rax
+	movl $906, %eax
+	pushq %rax
+	movl -16(%rbp), %eax
+	subl $4, %eax
+	pushq %rax
+	cmpq $9, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movslq -68(%rbp), %rax
+	pushq %rax
+	movl -68(%rbp), %eax
+	movq %rax, %r9
+	movl -44(%rbp), %eax
+	movq %rax, %r8
+	movsbl -71(%rbp), %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movq -8(%rbp), %rax
+	movq %rax, %rsi
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movl -68(%rbp), %eax
+	movq %rax, %rdx
+	movl ga1+24(%rip), %eax
+	movl ga1+24(%rip), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl -64(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	movl -48(%rbp), %eax
+	addl $-682, %eax
+	cmpl $32767, %eax
+	setle %al
+	movzbl %al, %eax
+	subq $8, %rsp
+	movl $973, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	movq %rax, %rdx
+	movl $671, %eax
+	movq %rax, %rsi
+	movsbq -71(%rbp), %rax
+	movq %rax, -8(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	addl -48(%rbp), %eax
+	movw %ax, -70(%rbp)
+	subq $8, %rsp
+	movl $973, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	movq %rax, %rdx
+	movl $671, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -70(%rbp)
+	subq $8, %rsp
+	movl $973, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	movq %rax, %rdx
+	movl $671, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -70(%rbp)
+	subq $8, %rsp
+	movl $973, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	movq %rax, %rdx
+	movl $671, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -70(%rbp)
+	subq $8, %rsp
+	movl $973, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movl $6, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	movq %rax, %rdx
+	movl $671, %eax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -70(%rbp)
+	movl $5, -68(%rbp)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movsbq -71(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movswq -70(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -68(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -68(%rbp)
+	cmpl $8, -68(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	testl %eax, %eax
+	je .L255
+	movl $8, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L258
+	.p2align 4,,10
+.L257:
+	movslq -68(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	subq $1, -8(%rbp)
+	jne .L257
+.L258:
+.L255:
+.L256:
+	cmpl $8, -68(%rbp)
+	jge .L260
+	.p2align 4,,10
+.L259:
+	movslq -68(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	cmpl $8, -68(%rbp)
+	jl .L259
+.L260:
+	movl $0, -68(%rbp)
+	cmpl $0, -44(%rbp)
+	je .L261
+	movl $8, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L264
+	.p2align 4,,10
+.L263:
+	movslq -68(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	movslq -68(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	subq $1, -8(%rbp)
+	jne .L263
+.L264:
+.L261:
+.L262:
+	cmpl $8, -68(%rbp)
+	jge .L266
+	.p2align 4,,10
+.L265:
+	movslq -68(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -68(%rbp)
+	cmpl $8, -68(%rbp)
+	jl .L265
+.L266:
+	movl -52(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -56(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -60(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movl -64(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+.main_return:
+	leave
+	ret
+.L242:
+	movq -40(%rbp), %rax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movl ga0+20(%rip), %eax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movl ga0+16(%rip), %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl ga0+16(%rip), %eax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movsbl -71(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+28(%rip), %eax
+	movq %rax, %rdx
+	movsbq -71(%rbp), %rax
+	movq %rax, %rsi
+	movabsq $473433573960, %rax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jle .L245
+	cmpq $0, -32(%rbp)
+	jne .LB15
+.L247:
+.L248:
+	subq $8, %rsp
+	movslq -68(%rbp), %rax
+	pushq %rax
+	movswl -70(%rbp), %eax
+	movq %rax, %r9
+	movl $3466724138, %eax
+	movq %rax, %r8
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $60, %eax
+	movq %rax, %rdx
+	movl ga0+24(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl $233, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	addl %ecx, %eax
+	movw %ax, -70(%rbp)
+.L245:
+.L246:
+	movswq -70(%rbp), %rax
+	movabsq $383963489203, %rcx
+	imulq %rcx, %rax
+	testq %rax, %rax
+	je .L249
+	cmpb $0, -71(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl -71(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -71(%rbp)
+	cmpl $0, -68(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cmpq -40(%rbp), %rax
+	setbe %al
+	movzbl %al, %eax
+	imull %ecx, %eax
+	movw %ax, -70(%rbp)
+	cmpq $0, -40(%rbp)
+	je .L250
+	jmp .L240
+.L251:
+.L252:
+	jmp .L250
+.LB15:
+	subq $8, %rsp
+	movl $255, %eax
+	pushq %rax
+	movsbl -71(%rbp), %eax
+	movq %rax, %r9
+	movswl -70(%rbp), %eax
+	movq %rax, %r8
+	movl $3, %eax
+	movq %rax, %rcx
+	movswl -70(%rbp), %eax
+	movq %rax, %rdx
+	movl $429, %eax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	jmp .main_return
+	.size main, .-main
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movb %dil, -1(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movq %rcx, -24(%rbp)
+	movw %r8w, -26(%rbp)
+	movq %r9, -40(%rbp)
+	movq $4, -48(%rbp)
+	movabsq $751721482017, %rax
+	movq %rax, -56(%rbp)
+	movw $175, -58(%rbp)
+	movw $6, -60(%rbp)
+	movl $1715604070, -64(%rbp)
+	movl $4, -68(%rbp)
+	movq $32767, -80(%rbp)
+	movl $0, -68(%rbp)
+	movl $0, -112(%rbp)
+	movl $1, -108(%rbp)
+	movl $2, -104(%rbp)
+	movl $3, -100(%rbp)
+	movl $4, -96(%rbp)
+	movl $5, -92(%rbp)
+	movl $6, -88(%rbp)
+	movl $7, -84(%rbp)
+	movl $8, -68(%rbp)
+	movl $0, -68(%rbp)
+	imull $229, -68(%rbp), %eax
+	subl $229, %eax
+	movl %eax, -180(%rbp)
+	cmpl $16, -68(%rbp)
+	jge .L267
+	movl $16, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L270
+	.p2align 4,,10
+.L269:
+	addl $229, -180(%rbp)
+	movslq -68(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $229, -180(%rbp)
+	movslq -68(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $229, -180(%rbp)
+	movslq -68(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	addl $229, -180(%rbp)
+	movslq -68(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	subq $1, -192(%rbp)
+	jne .L269
+.L270:
+.L267:
+.L268:
+	cmpl $16, -68(%rbp)
+	jge .L272
+	.p2align 4,,10
+.L271:
+	addl $229, -180(%rbp)
+	movslq -68(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -68(%rbp)
+	cmpl $16, -68(%rbp)
+	jl .L271
+.L272:
+	movl $298, %eax
+	movq %rax, %r8
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	movw %ax, -194(%rbp)
+	movq %rax, %rdx
+	movl $223, %eax
+	movq %rax, %rsi
+	movl ga0+12(%rip), %eax
+	movq %rax, %rdi
+	call f1.constprop.1
+	movzwl %ax, %eax
+	imull $256, %eax, %eax
+	movslq %eax, %rax
+	addq %rax, -40(%rbp)
+	subq $8, %rsp
+	movl $6, %eax
+	pushq %rax
+	movl $5, %eax
+	movq %rax, %r9
+	movl $1079449350, %eax
+	movq %rax, %r8
+	movl $255, %eax
+	movq %rax, %rcx
+	movl ga1+24(%rip), %eax
+	movq %rax, %rdx
+	movslq -64(%rbp), %rax
+	movq %rax, %rsi
+	movzwl -58(%rbp), %eax
+	movq %rax, -208(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movzbl -9(%rbp), %eax
+	movl %eax, -200(%rbp)
+	subl $49, %eax
+	pushq %rax
+	movl $7, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	movb %al, -196(%rbp)
+	pushq %rax
+	movzwl -58(%rbp), %eax
+	movb %al, -195(%rbp)
+	pushq %rax
+	movq -48(%rbp), %rax
+	leaq 15(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $4, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	cmpq $0, -40(%rbp)
+	jne .L273
+	movl $32767, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L274
+.L273:
+	movl $1, %eax
+.L274:
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl -200(%rbp), %eax
+	imull -200(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl -1(%rbp), %eax
+	movl %eax, -212(%rbp)
+	cltd
+	idivl %ecx
+	cmpl $479, %eax
+	sete %al
+	movzbl %al, %eax
+	movl -152(%rbp), %ecx
+	cmpl %ecx, %eax
+	jg .L275
+	cmpl $49, -212(%rbp)
+	jge .LB16
+.L277:
+.L278:
+.L275:
+.L276:
+	cmpl $0, -8(%rbp)
+	jb .L279
+	cmpl $16, -8(%rbp)
+	jae .L279
+	movl -8(%rbp), %eax
+	movl $471, -176(%rbp,%rax,4)
+.L279:
+.L280:
+	movsbl -1(%rbp), %eax
+	addl -8(%rbp), %eax
+	addl $1, %eax
+	cmpq %rax, -48(%rbp)
+	jg .L281
+	movq -80(%rbp), %rax
+	imulq -80(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $639, %eax
+	cqo
+	idivq %rcx
+	pushq %rax
+	movl -68(%rbp), %eax
+	cmpl -200(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -26(%rbp), %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	popq %rcx
+	subq %rcx, %rax
+	je .L283
+	movl $695, %eax
+	movslq %eax, %rax
+	cmpq $52, %rax
+	jge .L292
+	cmpq $-5, %rax
+	je .L289
+	cmpq $1, %rax
+	je .L291
+.L286:
+	subq $8, %rsp
+	xorl %eax, %eax
+	pushq %rax
+	movl $256, %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl $22950, %eax
+	movq %rax, %rcx
+	movzwl -26(%rbp), %eax
+	movq %rax, %rdx
+	movl ga0+16(%rip), %eax
+	movsbq %al, %rax
+	movq %rax, %rsi
+	movl -88(%rbp), %eax
+	movq %rax, %rdi
+	call f1.constprop.2
+	addq $16, %rsp
+	movl $194, %eax
+	pushq %rax
+	movq -48(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $4294967295, %eax
+	pushq %rax
+	movl $4, %eax
+	movq %rax, %r9
+	movl $3, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $69, %eax
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl ga1+28(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %r9
+	cmpl $479, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movzwl -58(%rbp), %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movzbl -9(%rbp), %eax
+	subq -56(%rbp), %rax
+	movq %rax, %rsi
+	movl $251, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	jmp .L285
+.L281:
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $7, %eax
+	subl -68(%rbp), %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	cmpq $-2, %rax
+	je .L307
+	cmpq $33, %rax
+	je .L306
+.L308:
+	jmp .L305
+.L307:
+	subq $8, %rsp
+	movl $5, %eax
+	pushq %rax
+	movq -40(%rbp), %rax
+	movq %rax, %r9
+	movl $183, %eax
+	movq %rax, %r8
+	movl $107, %eax
+	movq %rax, %rcx
+	movzbl -196(%rbp), %eax
+	movq %rax, %rdx
+	movabsq $1056781578098, %rax
+	movq %rax, %rsi
+	movl $479, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movq -80(%rbp), %rax
+	imulq -80(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movl $49, %eax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	movl $4, %eax
+	movq %rax, %r9
+	movl $640, %eax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movl ga1+0(%rip), %eax
+	movq %rax, %rdx
+	movsbq -1(%rbp), %rax
+	movq %rax, -248(%rbp)
+	movq %rax, %rsi
+	movl ga1+28(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cqo
+	idivq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	movq -48(%rbp), %rax
+	cmpq -248(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movzwl -26(%rbp), %eax
+	subl -64(%rbp), %eax
+	pushq %rax
+	movl -92(%rbp), %eax
+	cmpl $123, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	movl -172(%rbp), %eax
+	addl $7, %eax
+	pushq %rax
+	movzwl -60(%rbp), %eax
+	movl -160(%rbp), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movq -80(%rbp), %rax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+.L305:
+	movq -40(%rbp), %rax
+	pushq %rax
+	movl $-1446666551, %eax
+	pushq %rax
+	movl $825, %eax
+	movq %rax, %r9
+	movl -148(%rbp), %eax
+	movq %rax, %r8
+	movsbl -1(%rbp), %eax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movq -56(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movq -80(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $6, %eax
+	pushq %rax
+	movl -140(%rbp), %eax
+	movq %rax, %r9
+	xorl %eax, %eax
+	movq %rax, %r8
+	movl ga1+4(%rip), %eax
+	movq %rax, %rcx
+	movl $185, %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movq -208(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cqo
+	idivq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -68(%rbp)
+	jmp .L282
+.L289:
+	movl -64(%rbp), %eax
+	pushq %rax
+	movl -128(%rbp), %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movzwl -194(%rbp), %eax
+	movq %rax, %r8
+	movl $705, %eax
+	movq %rax, %rcx
+	movl $13, %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl $213, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	movzwl %ax, %eax
+	cmpl $255, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	movl ga0+12(%rip), %eax
+	imull $479, %eax, %eax
+	movq %rax, %rcx
+	imulq $522, -56(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movb %al, -1(%rbp)
+.L290:
+.L285:
+.L294:
+.L284:
+	subq $8, %rsp
+	movq -80(%rbp), %rax
+	pushq %rax
+	movl $3, %eax
+	movq %rax, %r9
+	movl $790, %eax
+	movq %rax, %r8
+	movl ga1+16(%rip), %eax
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movabsq $368289392568, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	testl %eax, %eax
+	je .L297
+	movl $0, -64(%rbp)
+	cmpl $8, -64(%rbp)
+	jge .L300
+	.p2align 4,,10
+.L299:
+	movslq -64(%rbp), %rax
+	movq %rax, -232(%rbp)
+	movl ga0+24(%rip), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	movl -112(%rbp), %eax
+	testl %eax, %eax
+	je .L301
+.L300:
+	movabsq $705105883700, %rax
+	cmpq -80(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -80(%rbp)
+.L298:
+.L282:
+	subq $8, %rsp
+	movzwl -58(%rbp), %eax
+	pushq %rax
+	movq -80(%rbp), %rax
+	movq %rax, %r9
+	movl -68(%rbp), %eax
+	movq %rax, %r8
+	movzbl -195(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	movq %rax, %rdx
+	movl -136(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl ga0+0(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	imull -64(%rbp), %eax
+	subl %ecx, %eax
+	movl %eax, -164(%rbp)
+	subq $8, %rsp
+	movl $109, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movl $49, %eax
+	movq %rax, %r8
+	movzwl -26(%rbp), %eax
+	movq %rax, %rcx
+	movl $154, %eax
+	movq %rax, %rdx
+	movzbl -9(%rbp), %eax
+	movq %rax, -256(%rbp)
+	movq %rax, %rsi
+	movq -256(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movswq %ax, %rax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L301:
+.L302:
+	movq -232(%rbp), %rax
+	movl $-1, -112(%rbp,%rax,4)
+	addl $1, -64(%rbp)
+	cmpl $8, -64(%rbp)
+	jl .L299
+	jmp .L300
+.L283:
+	movl -200(%rbp), %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movl $769, %eax
+	movq %rax, %r9
+	movl -92(%rbp), %eax
+	movq %rax, %r8
+	movl -108(%rbp), %eax
+	movq %rax, %rcx
+	movl $158, %eax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $38, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	movl $7, %eax
+	subq -56(%rbp), %rax
+	pushq %rax
+	movzwl -60(%rbp), %eax
+	pushq %rax
+	movl $49, %eax
+	subl -68(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $128, %eax
+	pushq %rax
+	movl $855, %eax
+	pushq %rax
+	movl $55974, %eax
+	movq %rax, %r9
+	movl $8, %eax
+	movq %rax, %r8
+	movl ga0+8(%rip), %eax
+	movq %rax, %rcx
+	movl $227, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $48, %eax
+	movq %rax, %rdi
+	call f1
+	addq $24, %rsp
+	movq %rax, %rdx
+	movq $-21, %rax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f1
+	addq $16, %rsp
+	cmpl $3, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $727, -24(%rbp), %rax
+	cmpq %rcx, %rax
+	jl .L293
+	subq $8, %rsp
+	movq -48(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	cmpl $0, -8(%rbp)
+	jne .L295
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L296
+.L297:
+	movq -48(%rbp), %rax
+	cmpq -80(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movabsq $-7908779624178696979, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $17, %rdx
+	movl %edx, %eax
+	pushq %rax
+	movslq -68(%rbp), %rax
+	pushq %rax
+	movl $479, %eax
+	movq %rax, %r9
+	movl $663, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl ga1+12(%rip), %eax
+	movq %rax, %rdx
+	movzwl -60(%rbp), %eax
+	movq %rax, %rsi
+	movl $710, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	je .L303
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	addl %eax, -64(%rbp)
+	subq $8, %rsp
+	movl $839, %eax
+	pushq %rax
+	movl $32767, %eax
+	movq %rax, %r9
+	movzwl -26(%rbp), %eax
+	movq %rax, %r8
+	movl $255, %eax
+	movq %rax, %rcx
+	movl $151, %eax
+	movq %rax, %rdx
+	movl $597, %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	addl %eax, -68(%rbp)
+	subq $8, %rsp
+	movq -56(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	movl -108(%rbp), %eax
+	movq %rax, %r9
+	movq -24(%rbp), %rax
+	movq %rax, %r8
+	movl ga1+0(%rip), %eax
+	cmpl $6, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	cmpl $1, -8(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movl $362, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	jmp .L304
+.L303:
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $279, %eax
+	xorl %edx, %edx
+	divl %ecx
+	pushq %rax
+	movzwl -26(%rbp), %eax
+	pushq %rax
+	movl $297, %eax
+	movq %rax, %r9
+	movl -64(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %r8
+	movl -68(%rbp), %eax
+	movq %rax, %rcx
+	movq -80(%rbp), %rax
+	cmpq -40(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $883, %eax
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+.L304:
+	movl -200(%rbp), %eax
+	imull -200(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movabsq $189852978710, %rax
+	cmpq %rax, -24(%rbp)
+	setg %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movl $1, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	jmp .L298
+.L292:
+	cmpq $52, %rax
+	je .L287
+	cmpq $64, %rax
+	je .L290
+	cmpq $956, %rax
+	je .L285
+	jmp .L286
+.L295:
+	movl $1, %eax
+.L296:
+	pushq %rax
+	movsbq -1(%rbp), %rax
+	movq %rax, -224(%rbp)
+	pushq %rax
+	movq -224(%rbp), %rax
+	cmpq -80(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movq -80(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rsi
+	movl $672, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L294
+.L293:
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	cmpq -40(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $2147483647, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	cmpq $255, -24(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	cmpq $0, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $5, %eax
+	movq %rax, %rsi
+	cmpw $0, -58(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f1
+	addq $16, %rsp
+	jmp .L294
+.L306:
+	movzbl -9(%rbp), %eax
+	addl $7, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L309
+	cmpq $2, %rax
+	je .L310
+	jmp .L311
+.L287:
+	xorl %eax, %eax
+	movzwl -60(%rbp), %ecx
+	subl %ecx, %eax
+	movw %ax, -26(%rbp)
+	jmp .L285
+.L310:
+	subq $8, %rsp
+	movl $7, %eax
+	pushq %rax
+	movq -80(%rbp), %rax
+	movq %rax, %r9
+	movzwl -58(%rbp), %eax
+	movl %eax, -236(%rbp)
+	movzbl -9(%rbp), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl $263, %eax
+	movq %rax, %rsi
+	movzwl -26(%rbp), %eax
+	cmpl %eax, -236(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movslq -64(%rbp), %rax
+	cmpq %rax, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	cmpq $0, -80(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpq $-843, -24(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	movb %al, -9(%rbp)
+.L311:
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $8, %eax
+	cqo
+	idivq %rcx
+	movl %eax, -84(%rbp)
+	subq $8, %rsp
+	movl $1, %eax
+	pushq %rax
+	movl $143, %eax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	addq $4, %rax
+	movq %rax, %r8
+	movl $9, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	movq %rax, %rdx
+	movl ga1+28(%rip), %eax
+	sall $3, %eax
+	movslq %eax, %rax
+	movq %rax, %rsi
+	movq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L309:
+	movb $0, -1(%rbp)
+	jmp .L305
+.L312:
+	jmp .L309
+.L291:
+	movzwl -58(%rbp), %eax
+	movq %rax, -56(%rbp)
+	subq $8, %rsp
+	movl ga0+4(%rip), %eax
+	testl %eax, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $4221349670, %eax
+	pushq %rax
+	movl $4294967292, %eax
+	pushq %rax
+	movzwl -60(%rbp), %eax
+	pushq %rax
+	movzbl -9(%rbp), %eax
+	subq -80(%rbp), %rax
+	pushq %rax
+	movl $65536, %eax
+	movq %rax, %rsi
+	movl -64(%rbp), %eax
+	imull -64(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L285
+.L288:
+	jmp .L285
+.LB16:
+	movl $419, %eax
+	jmp .f2_return
+	.size f2, .-f2
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,147 @@
+long g0 = 5;
+unsigned int f0(unsigned char p0, unsigned short p1, char p2, unsigned short p3, char p4, unsigned int p5, unsigned short p6) {
+    short v0 = 90;
+    unsigned long v1 = 6;
+    int i0 = 259;
+    long j0 = 383;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 349; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 291; }
+    v0 = -(!(!(i0)));
+    switch (((la0[12] != 990) != 105509457901)) {
+    case 0:
+        v0 = (((p2 * p4) - (p5 + 764)) + p5);
+        p6 = ((p0 > p3) || (v0 <= p3));
+        break;
+    case 3:
+        if (g0 >= 0 && g0 < 16) { la0[g0] = 7; }
+        break;
+    default:
+        p2 = (512 == p0);
+        break;
+    }
+    if (((-(22) - !(p0)) - (127 != (i0 + 6)))) {
+        p0 = (6 == 583);
+    } else {
+        p1 = (unsigned char)(((336 - p0) / 16));
+        switch (((2 < 213U) >= p5)) {
+        case 557:
+        case 861:
+            p3 = 770319559181;
+            i0 = 0;
+            while (i0 < 3) {
+                la1[14] = la0[4];
+                if ((853002229449 * 724)) { break; }
+                p6 = (unsigned short)(((65535 - 9) / 8));
+                i0 = i0 + 1;
+            }
+        case 66:
+        default:
+            break;
+        case 941:
+            if (p0 >= 0 && p0 < 16) { la0[p0] = !((v0 > 10)); }
+            if (((9 / 100) + -(p1))) { return (p3 != (p5 / 7)); }
+            break;
+        case 100:
+            p5 = -(916);
+            if (v1) {
+                p1 = p0;
+                p0 = (int)((740984345501 != 919l));
+                if (-((la0[7] - g0))) { return i0; }
+            }
+            break;
+        case 1000:
+            i0 = i0 + -(i0);
+        case 29:
+            for (i0 = 0; i0 < 3; i0 = i0 + 1) {
+                if (v0 >= 0 && v0 < 16) { la1[v0] = (95 > !(p5)); }
+            }
+        }
+        v1 = !(p1);
+    }
+    v0 = la1[8];
+    return (unsigned char)((i0 != 567L));
+}
+int main() {
+    unsigned char v0 = 5;
+    long v1 = 218;
+    char v2 = 5;
+    unsigned long v3 = 5;
+    int v4 = 426;
+    char v5 = 2;
+    int i0 = 128;
+    long j0 = 0;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 8; }
+    if ((f0(2, 643214192373, i0, v5, v5, v2, i0) / 2)) {
+        i0 = 0;
+        while (i0 < 3) {
+            if (g0) { break; }
+            v5 = f0((v3 + 977), (v0 || 6), (unsigned int)(v5), (v5 + 974630804417), (3 / 3u), f0(v2, g0, 128, 515780541121, 0, 417, 4), v2);
+            i0 = i0 + 1;
+        }
+        f0((9 / 7), f0(v1, 996657438245, 2, v2, v1, v0, 7), !(i0), (la0[31] < la0[8]), f0(v1, 588874649163, v5, v1, 561748638690, 2, 245), v4, (v0 - j0));
+        for (v1 = 1; v1 < 16; v1 = v1 + 1) {
+            v3 = (f0(122, 2, v0, 7, j0, j0, g0) - f0(v2, la0[13], v2, v4, v1, v0, 8));
+            j0 = la0[19];
+            if (32767) {
+                g0 = g0 + 5;
+                la0[v1] = (la0[12] < (g0 > 1));
+            }
+        }
+    } else {
+        if (v2 >= 0 && v2 < 33) { la0[v2] = (unsigned long)((8 / (v0 * v0 + 1))); }
+        switch ((long)(v5)) {
+        default:
+            f0(940l, v2, (short)(i0), 127, v3, (j0 + v5), la0[3]);
+            switch ((i0 != 6)) {
+            case 5:
+                v0 = v0 + (395 <= !(la0[4]));
+                break;
+            case 6:
+                v4 = la0[11];
+                g0 = v2;
+            case 4:
+                v3 = v4;
+                j0 = g0;
+            case 10:
+            }
+            break;
+        case 33:
+            for (v3 = 2; v3 < 33; v3 = v3 + 1) {
+                if ((la0[28] < !(5))) { break; }
+                if (f0(9, 974, 4, j0, i0, i0, 128)) { break; }
+            }
+            v5 = ((576039526162 != (1 - 0)) + (10 || 526));
+        case 48:
+        case 5:
+            if (i0 >= 0 && i0 < 33) { la0[i0] = (f0(3, v4, 35, v3, 479, v3, v1) - (la0[24] / 1024)); }
+            break;
+        case 91:
+            break;
+        }
+        for (i0 = 0; i0 < 33; i0 = i0 + 1) {
+            if (i0 >= 0 && i0 < 33) { la0[i0] = -(32309729008); }
+            v2 = v4;
+            v2 = la0[28];
+        }
+    }
+    v0 = ((unsigned long)(613) >= (840 <= (i0 + 0)));
+    i0 = (5 || (f0(i0, v3, i0, 1077805931164, 633563688895, 210, i0) / (v3 * v3 + 1)));
+    f0(-(10), 682L, !(3), -(127), j0, (v4 + v2), (int)(10));
+    v2 = 8;
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1622 @@
+	.section .data
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.quad 5
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movb %dil, -1(%rbp)
+	movw %si, -4(%rbp)
+	movb %dl, -5(%rbp)
+	movw %cx, -8(%rbp)
+	movb %r8b, -9(%rbp)
+	movl %r9d, -16(%rbp)
+	movw $90, -18(%rbp)
+	movq $6, -32(%rbp)
+	movl $259, -36(%rbp)
+	movq $383, -48(%rbp)
+	movl $0, -36(%rbp)
+	imull $349, -36(%rbp), %eax
+	subl $349, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $349, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $349, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $349, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $349, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -128(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -36(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $349, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L4
+.L5:
+	movl $0, -36(%rbp)
+	imull $291, -36(%rbp), %eax
+	subl $291, %eax
+	movl %eax, -196(%rbp)
+	cmpl $0, -120(%rbp)
+	je .L6
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	addl $291, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $291, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $291, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $291, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -208(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $16, -36(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	addl $291, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L10
+.L11:
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, -18(%rbp)
+	movl -64(%rbp), %eax
+	cmpl $990, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $105509457901, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L13
+	cmpq $3, %rax
+	je .L14
+.L15:
+	movzbl -1(%rbp), %eax
+	cmpl $512, %eax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	jmp .L12
+.L13:
+	movl -16(%rbp), %eax
+	addl $764, %eax
+	pushq %rax
+	movsbl -5(%rbp), %eax
+	movsbl -9(%rbp), %ecx
+	imull %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	addl -16(%rbp), %eax
+	movw %ax, -18(%rbp)
+	movzwl -8(%rbp), %eax
+	movl %eax, -212(%rbp)
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	cmpl %ecx, %eax
+	jg .L16
+	movswl -18(%rbp), %eax
+	cmpl -212(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .L17
+.L16:
+	movl $1, %eax
+.L17:
+	movw %ax, 16(%rbp)
+.L12:
+	movl -36(%rbp), %eax
+	addl $6, %eax
+	cmpl $127, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpb $0, -1(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $-22, %eax
+	subl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	je .L20
+	movb $0, -1(%rbp)
+	jmp .L21
+.L20:
+	movl $336, %eax
+	movzbl -1(%rbp), %ecx
+	subl %ecx, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	cmpl $1, -16(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $557, %rax
+	jge .L29
+	cmpq $29, %rax
+	je .L28
+	cmpq $66, %rax
+	je .L24
+	cmpq $100, %rax
+	je .L26
+	jmp .L24
+.L23:
+	movw $43533, -8(%rbp)
+	movl $0, -36(%rbp)
+	movabsq $617573614121076, %rax
+	movq %rax, -224(%rbp)
+	movl $8190, -228(%rbp)
+	cmpl $3, -36(%rbp)
+	jge .L32
+	.p2align 4,,10
+.L31:
+	movl -96(%rbp), %eax
+	movl %eax, -136(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L33
+.L32:
+.L24:
+.L22:
+	cmpw $0, -4(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+.L21:
+	movl -160(%rbp), %eax
+	movw %ax, -18(%rbp)
+	movslq -36(%rbp), %rax
+	cmpq $567, %rax
+	setne %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L33:
+.L34:
+	movl -228(%rbp), %eax
+	movw %ax, 16(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $3, -36(%rbp)
+	jl .L31
+	jmp .L32
+.L14:
+	cmpq $0, g0(%rip)
+	jl .L12
+	cmpq $16, g0(%rip)
+	jge .L12
+	movq g0(%rip), %rax
+	movl $7, -112(%rbp,%rax,4)
+.L18:
+.L19:
+	jmp .L12
+.L29:
+	cmpq $941, %rax
+	jge .L30
+	cmpq $557, %rax
+	je .L23
+	cmpq $861, %rax
+	je .L23
+	jmp .L24
+.L30:
+	cmpq $941, %rax
+	je .L25
+	cmpq $1000, %rax
+	je .L27
+	jmp .L24
+.L27:
+	xorl %eax, %eax
+	subl -36(%rbp), %eax
+	addl %eax, -36(%rbp)
+.L28:
+	movl $0, -36(%rbp)
+	movswl -18(%rbp), %eax
+	movl %eax, -240(%rbp)
+	testl %eax, %eax
+	jl .L43
+	cmpl $16, -240(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L44
+.L43:
+	movl $0, %eax
+.L44:
+	movl %eax, -236(%rbp)
+	cmpl $0, -236(%rbp)
+	je .L45
+	cmpl $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $95, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -18(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L45:
+.L46:
+	cmpl $0, -236(%rbp)
+	je .L47
+	cmpl $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $95, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -18(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L47:
+.L48:
+	cmpl $0, -236(%rbp)
+	je .L49
+	cmpl $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $95, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -18(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L49:
+.L50:
+	movl $3, -36(%rbp)
+	jmp .L22
+.L25:
+	movzbl -1(%rbp), %eax
+	movl %eax, -232(%rbp)
+	testl %eax, %eax
+	jl .L35
+	cmpl $16, -232(%rbp)
+	jge .L35
+	movswl -18(%rbp), %eax
+	cmpl $10, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movl %ecx, -112(%rbp,%rax,4)
+.L35:
+.L36:
+	xorl %eax, %eax
+	movzwl -4(%rbp), %ecx
+	subl %ecx, %eax
+	jne .LB0
+.L37:
+.L38:
+	jmp .L22
+.L26:
+	movl $4294966380, -16(%rbp)
+	cmpq $0, -32(%rbp)
+	je .L22
+	movzbl -1(%rbp), %eax
+	movw %ax, -4(%rbp)
+	movb $1, -1(%rbp)
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	subq g0(%rip), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	jne .LB1
+.L41:
+.L42:
+.L39:
+.L40:
+	jmp .L22
+.LB0:
+	movl -16(%rbp), %eax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB1:
+	movl -36(%rbp), %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movb %dil, -1(%rbp)
+	movw %si, -4(%rbp)
+	movb %dl, -5(%rbp)
+	movw %cx, -8(%rbp)
+	movl %r8d, -12(%rbp)
+	movw %r9w, -14(%rbp)
+	movw $90, -16(%rbp)
+	movq $6, -24(%rbp)
+	movl $259, -28(%rbp)
+	movq $383, -40(%rbp)
+	movl $0, -28(%rbp)
+	imull $349, -28(%rbp), %eax
+	subl $349, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -28(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	testl %eax, %eax
+	je .L51
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L54
+	.p2align 4,,10
+.L53:
+	addl $349, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $349, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $349, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $349, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -128(%rbp)
+	jne .L53
+.L54:
+.L51:
+.L52:
+	cmpl $16, -28(%rbp)
+	jge .L56
+	.p2align 4,,10
+.L55:
+	addl $349, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L55
+.L56:
+	movl $0, -28(%rbp)
+	imull $291, -28(%rbp), %eax
+	subl $291, %eax
+	movl %eax, -196(%rbp)
+	cmpl $0, -120(%rbp)
+	je .L57
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L60
+	.p2align 4,,10
+.L59:
+	addl $291, -196(%rbp)
+	movslq -28(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $291, -196(%rbp)
+	movslq -28(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $291, -196(%rbp)
+	movslq -28(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $291, -196(%rbp)
+	movslq -28(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -208(%rbp)
+	jne .L59
+.L60:
+.L57:
+.L58:
+	cmpl $16, -28(%rbp)
+	jge .L62
+	.p2align 4,,10
+.L61:
+	addl $291, -196(%rbp)
+	movslq -28(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L61
+.L62:
+	cmpl $0, -28(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, -16(%rbp)
+	movl -64(%rbp), %eax
+	cmpl $990, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movabsq $105509457901, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L64
+	cmpq $3, %rax
+	je .L65
+.L66:
+	movzbl -1(%rbp), %eax
+	cmpl $512, %eax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -5(%rbp)
+	jmp .L63
+.L64:
+	movl -12(%rbp), %eax
+	addl $764, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	addl -12(%rbp), %eax
+	movw %ax, -16(%rbp)
+	movzwl -8(%rbp), %eax
+	movl %eax, -212(%rbp)
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	cmpl %ecx, %eax
+	jg .L67
+	movswl -16(%rbp), %eax
+	cmpl -212(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .L68
+.L67:
+	movl $1, %eax
+.L68:
+	movw %ax, -14(%rbp)
+.L63:
+	movl -28(%rbp), %eax
+	addl $6, %eax
+	cmpl $127, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpb $0, -1(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $-22, %eax
+	subl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	je .L71
+	movb $0, -1(%rbp)
+	jmp .L72
+.L71:
+	movl $336, %eax
+	movzbl -1(%rbp), %ecx
+	subl %ecx, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	cmpl $1, -12(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $557, %rax
+	jge .L80
+	cmpq $29, %rax
+	je .L79
+	cmpq $66, %rax
+	je .L75
+	cmpq $100, %rax
+	je .L77
+	jmp .L75
+.L74:
+	movw $43533, -8(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $3, -28(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -216(%rbp)
+	cmpl $0, -216(%rbp)
+	je .L83
+	.p2align 4,,10
+.L82:
+	movl -96(%rbp), %eax
+	movl %eax, -136(%rbp)
+.L83:
+.L75:
+.L73:
+	cmpw $0, -4(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L72:
+	movl -160(%rbp), %eax
+	movw %ax, -16(%rbp)
+	movslq -28(%rbp), %rax
+	cmpq $567, %rax
+	setne %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L65:
+	cmpq $0, g0(%rip)
+	jl .L63
+	cmpq $16, g0(%rip)
+	jge .L63
+	movq g0(%rip), %rax
+	movl $7, -112(%rbp,%rax,4)
+.L69:
+.L70:
+	jmp .L63
+.L80:
+	cmpq $941, %rax
+	jge .L81
+	cmpq $557, %rax
+	je .L74
+	cmpq $861, %rax
+	je .L74
+	jmp .L75
+.L81:
+	cmpq $941, %rax
+	je .L76
+	cmpq $1000, %rax
+	je .L78
+	jmp .L75
+.L78:
+	xorl %eax, %eax
+	subl -28(%rbp), %eax
+	addl %eax, -28(%rbp)
+.L79:
+	movl $0, -28(%rbp)
+	movswl -16(%rbp), %eax
+	movl %eax, -228(%rbp)
+	testl %eax, %eax
+	jl .L92
+	cmpl $16, -228(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L93
+.L92:
+	movl $0, %eax
+.L93:
+	movl %eax, -224(%rbp)
+	cmpl $0, -224(%rbp)
+	je .L94
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $95, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -16(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L94:
+.L95:
+	cmpl $0, -224(%rbp)
+	je .L96
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $95, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -16(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L96:
+.L97:
+	cmpl $0, -224(%rbp)
+	je .L98
+	cmpl $0, -12(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $95, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswq -16(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L98:
+.L99:
+	movl $3, -28(%rbp)
+	jmp .L73
+.L76:
+	movzbl -1(%rbp), %eax
+	movl %eax, -220(%rbp)
+	testl %eax, %eax
+	jl .L84
+	cmpl $16, -220(%rbp)
+	jge .L84
+	movswl -16(%rbp), %eax
+	cmpl $10, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movl %ecx, -112(%rbp,%rax,4)
+.L84:
+.L85:
+	xorl %eax, %eax
+	movzwl -4(%rbp), %ecx
+	subl %ecx, %eax
+	jne .LB2
+.L86:
+.L87:
+	jmp .L73
+.L77:
+	movl $4294966380, -12(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L73
+	movzbl -1(%rbp), %eax
+	movw %ax, -4(%rbp)
+	movb $1, -1(%rbp)
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	subq g0(%rip), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	jne .LB3
+.L90:
+.L91:
+.L88:
+.L89:
+	jmp .L73
+.LB2:
+	movl -12(%rbp), %eax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.LB3:
+	movl -28(%rbp), %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $288, %rsp
+	movb $5, -1(%rbp)
+	movq $218, -16(%rbp)
+	movb $5, -17(%rbp)
+	movq $5, -32(%rbp)
+	movl $426, -36(%rbp)
+	movb $2, -37(%rbp)
+	movl $128, -44(%rbp)
+	movq $0, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -196(%rbp)
+	testl %eax, %eax
+	je .L100
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L103
+	.p2align 4,,10
+.L102:
+	movl -44(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movl -44(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -208(%rbp)
+	jne .L102
+.L103:
+.L100:
+.L101:
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -212(%rbp)
+	testl %eax, %eax
+	je .L105
+	.p2align 4,,10
+.L104:
+	movl -44(%rbp), %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -212(%rbp)
+	testl %eax, %eax
+	jne .L104
+.L105:
+	subq $8, %rsp
+	movl -44(%rbp), %eax
+	pushq %rax
+	movsbl -17(%rbp), %eax
+	movq %rax, %r9
+	movsbl -37(%rbp), %eax
+	movq %rax, %r8
+	movsbl -37(%rbp), %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	movb %al, -213(%rbp)
+	movq %rax, %rdx
+	movl $44789, %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	shrl $1, %eax
+	testl %eax, %eax
+	je .L106
+	movl $0, -44(%rbp)
+	movq -32(%rbp), %rax
+	addq $977, %rax
+	movq %rax, -224(%rbp)
+	cmpb $0, -1(%rbp)
+	jne .L108
+	movl $6, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L109
+.L108:
+	movl $1, %eax
+.L109:
+	movl %eax, -228(%rbp)
+	movl $3, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movl %eax, -232(%rbp)
+	cmpl $3, -44(%rbp)
+	jge .L111
+	.p2align 4,,10
+.L110:
+	cmpq $0, g0(%rip)
+	je .L112
+.L111:
+	subq $8, %rsp
+	movzbl -1(%rbp), %eax
+	subq -56(%rbp), %rax
+	pushq %rax
+	movl -36(%rbp), %eax
+	pushq %rax
+	movl $245, %eax
+	pushq %rax
+	movl $2, %eax
+	movq %rax, %r9
+	movl $-30, %eax
+	movq %rax, %r8
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movsbl -37(%rbp), %eax
+	movq %rax, %rdx
+	movl $3659, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movb %al, -233(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	pushq %rax
+	movl -68(%rbp), %eax
+	movl -160(%rbp), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -44(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $7, %eax
+	pushq %rax
+	movzbl -1(%rbp), %eax
+	movl %eax, -240(%rbp)
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movsbl -17(%rbp), %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl $40485, %eax
+	movq %rax, %rsi
+	movzbl -233(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rsi
+	movl $9, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movq $1, -16(%rbp)
+	cmpq $16, -16(%rbp)
+	jge .L115
+	.p2align 4,,10
+.L114:
+	subq $8, %rsp
+	movl $8, %eax
+	pushq %rax
+	movl -240(%rbp), %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl -36(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -17(%rbp), %eax
+	movq %rax, %rdx
+	movl -140(%rbp), %eax
+	movq %rax, %rsi
+	movsbl -17(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movq g0(%rip), %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	movq %rax, %r8
+	movl $7, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl $122, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	subl %ecx, %eax
+	movq %rax, -32(%rbp)
+	movl -116(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	movl $32767, %eax
+	testl %eax, %eax
+	je .L116
+	addq $5, g0(%rip)
+	movl -144(%rbp), %eax
+	cmpq $1, g0(%rip)
+	setg %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L116:
+.L117:
+	addq $1, -16(%rbp)
+	cmpq $16, -16(%rbp)
+	jl .L114
+.L115:
+.L152:
+.L107:
+	movl -44(%rbp), %eax
+	addl $0, %eax
+	cmpl $840, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $613, %rax
+	setbe %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	movl $5, %eax
+	testl %eax, %eax
+	jne .L155
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movl -44(%rbp), %eax
+	pushq %rax
+	movl $210, %eax
+	movq %rax, %r9
+	movl $-65, %eax
+	movq %rax, %r8
+	movl $23196, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movq %rax, %rsi
+	movl -44(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movl %eax, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L156
+.L155:
+	movl $1, %eax
+.L156:
+	movl %eax, -44(%rbp)
+	subq $8, %rsp
+	movl $10, %eax
+	pushq %rax
+	movsbl -17(%rbp), %eax
+	addl -36(%rbp), %eax
+	movq %rax, %r9
+	movq -56(%rbp), %rax
+	movq %rax, %r8
+	xorl %eax, %eax
+	subl $127, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $682, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subl $10, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movb $8, -17(%rbp)
+	movq $0, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	movzbl -1(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	movsbq -17(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	movsbq -37(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	movslq -44(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	imulq $31, -280(%rbp), %rax
+	addq -56(%rbp), %rax
+	movq %rax, -280(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L157
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -288(%rbp)
+	cmpq $0, -288(%rbp)
+	je .L160
+	.p2align 4,,10
+.L159:
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -280(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -280(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -280(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -280(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	addl $1, -44(%rbp)
+	subq $1, -288(%rbp)
+	jne .L159
+.L160:
+.L157:
+.L158:
+	cmpl $33, -44(%rbp)
+	jge .L162
+	.p2align 4,,10
+.L161:
+	movslq -44(%rbp), %rax
+	movl -192(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -280(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L161
+.L162:
+	movq -280(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -280(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -280(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -280(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -280(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -280(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -280(%rbp)
+	movq -280(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L112:
+.L113:
+	subq $8, %rsp
+	movsbl -17(%rbp), %eax
+	pushq %rax
+	movl $4, %eax
+	movq %rax, %r9
+	movl $417, %eax
+	movq %rax, %r8
+	movl $31425, %eax
+	movq %rax, %rcx
+	movl $-128, %eax
+	movq %rax, %rdx
+	movq g0(%rip), %rax
+	movq %rax, %rsi
+	movsbl -17(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movq %rax, %r9
+	movl -232(%rbp), %eax
+	movq %rax, %r8
+	movsbq -37(%rbp), %rax
+	movabsq $974630804417, %rcx
+	addq %rcx, %rax
+	movq %rax, %rcx
+	movsbl -37(%rbp), %eax
+	movq %rax, %rdx
+	movl -228(%rbp), %eax
+	movq %rax, %rsi
+	movq -224(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movb %al, -37(%rbp)
+	addl $1, -44(%rbp)
+	cmpl $3, -44(%rbp)
+	jl .L110
+	jmp .L111
+.L106:
+	movsbl -17(%rbp), %eax
+	movl %eax, -244(%rbp)
+	testl %eax, %eax
+	jl .L118
+	cmpl $33, -244(%rbp)
+	jge .L118
+	movzbl -1(%rbp), %eax
+	movl %eax, -248(%rbp)
+	imull -248(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movsbq -17(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L118:
+.L119:
+	movsbq -37(%rbp), %rax
+	cmpq $48, %rax
+	jge .L125
+	cmpq $5, %rax
+	je .L123
+	cmpq $33, %rax
+	je .L122
+.L121:
+	subq $8, %rsp
+	movl -180(%rbp), %eax
+	pushq %rax
+	movsbq -37(%rbp), %rax
+	addq -56(%rbp), %rax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movl $127, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	movq %rax, %rdx
+	movsbl -17(%rbp), %eax
+	movq %rax, %rsi
+	movl $172, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	cmpl $6, -44(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leaq -4(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L120
+	leaq .L132(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L126
+	# table target .L129
+	# table target .L127
+	# table target .L128
+	# table target .L130
+	jmp *%rcx
+.L125:
+	cmpq $48, %rax
+	je .L123
+	cmpq $91, %rax
+	je .L120
+	jmp .L121
+.L139:
+	movl $1, %eax
+.L140:
+	pushq %rax
+	movl $1, %eax
+	subl $0, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $576039526162, %rax
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movb %al, -37(%rbp)
+.L123:
+	cmpl $0, -44(%rbp)
+	jl .L141
+	cmpl $0, -212(%rbp)
+	je .L141
+	movl -96(%rbp), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq %rax, %r9
+	movl $-33, %eax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $35, %eax
+	movq %rax, %rdx
+	movl -36(%rbp), %eax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L141:
+.L142:
+.L120:
+	movl $0, -44(%rbp)
+	xorl %eax, %eax
+	movabsq $32309729008, %rcx
+	subq %rcx, %rax
+	movq %rax, -256(%rbp)
+	cmpl $0, -196(%rbp)
+	je .L143
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L146
+	.p2align 4,,10
+.L145:
+	cmpl $0, -44(%rbp)
+	jl .L147
+	cmpl $33, -44(%rbp)
+	jge .L147
+	movq -256(%rbp), %rax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L147:
+.L148:
+	movl -36(%rbp), %eax
+	movb %al, -265(%rbp)
+	movb %al, -17(%rbp)
+	movl -80(%rbp), %eax
+	movb %al, -17(%rbp)
+	addl $1, -44(%rbp)
+	cmpl $0, -44(%rbp)
+	jl .L149
+	cmpl $33, -44(%rbp)
+	jge .L149
+	movq -256(%rbp), %rax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L149:
+.L150:
+	movsbl -265(%rbp), %eax
+	movb %al, -17(%rbp)
+	movl -80(%rbp), %eax
+	movb %al, -17(%rbp)
+	addl $1, -44(%rbp)
+	subq $1, -264(%rbp)
+	jne .L145
+.L146:
+.L143:
+.L144:
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -272(%rbp)
+	testl %eax, %eax
+	je .L152
+	.p2align 4,,10
+.L151:
+	cmpl $0, -44(%rbp)
+	jl .L153
+	cmpl $0, -272(%rbp)
+	je .L153
+	movq -256(%rbp), %rax
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+.L153:
+.L154:
+	movl -36(%rbp), %eax
+	movb %al, -17(%rbp)
+	movl -80(%rbp), %eax
+	movb %al, -17(%rbp)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -272(%rbp)
+	testl %eax, %eax
+	jne .L151
+	jmp .L152
+.L131:
+.L130:
+.L126:
+	jmp .L120
+.L122:
+	movq $2, -32(%rbp)
+	cmpq $33, -32(%rbp)
+	jae .L134
+	.p2align 4,,10
+.L133:
+	movl $5, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -80(%rbp), %eax
+	cmpl %ecx, %eax
+	jge .L135
+.L134:
+	movl $10, %eax
+	testl %eax, %eax
+	jne .L139
+	movl $526, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L140
+.L135:
+.L136:
+	subq $8, %rsp
+	movl $128, %eax
+	pushq %rax
+	movl -44(%rbp), %eax
+	movq %rax, %r9
+	movsbl -213(%rbp), %eax
+	movq %rax, %r8
+	movq -56(%rbp), %rax
+	movq %rax, %rcx
+	movl $4, %eax
+	movq %rax, %rdx
+	movl $974, %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testl %eax, %eax
+	je .L137
+	jmp .L134
+.L137:
+.L138:
+	addq $1, -32(%rbp)
+	cmpq $33, -32(%rbp)
+	jb .L133
+	jmp .L134
+.L124:
+	jmp .L120
+.L127:
+	movl -176(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $395, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -1(%rbp)
+	jmp .L120
+.L128:
+	movl -148(%rbp), %eax
+	movl %eax, -36(%rbp)
+	movsbq -17(%rbp), %rax
+	movq %rax, g0(%rip)
+.L129:
+	movslq -36(%rbp), %rax
+	movq %rax, -32(%rbp)
+	movq g0(%rip), %rax
+	movq %rax, -56(%rbp)
+	jmp .L120
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L132:
+	.long .L129-.L132
+	.long .L127-.L132
+	.long .L128-.L132
+	.long .L126-.L132
+	.long .L126-.L132
+	.long .L126-.L132
+	.long .L130-.L132
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
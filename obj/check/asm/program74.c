@@ -0,0 +1,308 @@
+short g0;
+unsigned short g1 = 10;
+int ga0[8];
+int ga1[8];
+unsigned char f0(long p0, unsigned int p1, unsigned char p2, short p3) {
+    int v0 = 1;
+    unsigned int v1 = 621;
+    unsigned short v2 = 4;
+    unsigned int v3 = 8;
+    short v4 = 4;
+    unsigned char v5 = 8;
+    int i0 = 10;
+    long j0 = 4;
+    for (v4 = 0; v4 < 5; v4 = v4 + 1) {
+        if (((unsigned long)((128 + 3)) + (!(v2) - 4))) {
+            if ((v2 - 8)) {
+                v5 = v0;
+                if (!((v3 / 3u))) { break; }
+            } else {
+                p0 = v3;
+                if (((v1 / (v0 * v0 + 1)) + 939)) { break; }
+                if (7) { break; }
+            }
+        }
+    }
+    switch ((1 >= (0 * 466))) {
+    case 4:
+        v4 = j0;
+        for (v4 = 2; v4 < 5; v4 = v4 + 1) {
+            if (v4) {
+                if (ga0[7]) { break; }
+            }
+            i0 = !(v2);
+            if (v3) {
+                if (v2) { break; }
+                v2 = v4;
+            }
+        }
+        break;
+    case 9:
+        p1 = 0;
+    default:
+    }
+    v0 = (5 / (v5 * v5 + 1));
+    v0 = v0 + (2 == j0);
+    if (803842165318) {
+        if ((313 || (1 + ga0[6]))) { return (4 == v2); }
+    }
+    v3 = v4;
+    return p1;
+}
+void w0(unsigned short q0, unsigned long q1) {
+    g1 = g1 * 3 + q0;
+    g0 = g0 * 3 + q1;
+    ga0[0] = ga0[7] + q0;
+}
+short f1(int p0, short p1, int p2, short p3, unsigned int p4, unsigned long p5, int p6, long p7) {
+    unsigned char v0 = 199;
+    short v1 = 46176184082;
+    int i0 = 909;
+    long j0 = 8;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 1; }
+    if ((((305 + g0) - (unsigned short)(g1)) < (-(ga0[0]) - g1))) {
+        f0(f0(ga1[0], p7, 6, ga1[6]), 477, (unsigned char)(1091787601737), -(1084130053004));
+        j0 = 0;
+        while (j0 < 17) {
+            v0 = (p0 != (9 != g0));
+            switch (8) {
+            case 1:
+                break;
+            case 45:
+                break;
+            case 27:
+                p4 = p4 + (ga1[6] < f0(v1, i0, p1, 9l));
+                break;
+            }
+            j0 = j0 + 1;
+        }
+    } else {
+        if ((short)(((la0[31] / 7) > (7 * i0)))) {
+            i0 = -((!(1000000007) <= (unsigned long)(p7)));
+            v1 = i0;
+            f0(!(78), (ga0[4] / 3), (237684843453 == 2147483647), (ga0[6] + i0));
+        } else {
+            if (p2 >= 0 && p2 < 33) { la0[p2] = f0(254, 340, i0, j0); }
+            p0 = ga1[3];
+        }
+        for (p4 = 0; p4 < 33; p4 = p4 + 1) {
+            if (!(((i0 + 304) - (5 || 7)))) {
+                if (p6) { break; }
+                if (g0 >= 0 && g0 < 33) { la0[g0] = (int)((79083437907 + 546L)); }
+            } else {
+                f0(1, -(p7), (p6 == i0), (v1 > p5));
+                p6 = (f0(g1, 4l, p4, 4) != (-(10) * g0));
+            }
+            i0 = f0((unsigned int)(v1), (unsigned short)(p1), f0(4l, 344, 974, ga1[6]), (9 == 65535));
+            p3 = 2147483647;
+        }
+    }
+    if (g1 >= 0 && g1 < 33) { la0[g1] = f0(ga0[4], ga0[1], ga1[3], 36747258658); }
+    if (p0 >= 0 && p0 < 33) { la0[p0] = 961; }
+    f0(p6, p6, f0(634, 202486010439, 256, g1), (p2 / 3));
+    f0(685180287725, (short)(p1), 65535, p7);
+    la0[16] = (281 != 751);
+    return (((9 > p5) || 1000000007) < ((128 <= 128) + (p5 || 983)));
+}
+unsigned long f2(unsigned long p0, long p1, unsigned char p2, unsigned short p3) {
+    unsigned short v0 = 935;
+    unsigned long v1 = 0;
+    int v2 = 3;
+    int i0 = 0;
+    long j0 = 0l;
+    if (((unsigned int)(v0) && 0)) {
+        i0 = (9 >= -(7));
+        j0 = f0(294, f0(g0, 8, i0, i0), p2, (g0 / (p0 * p0 + 1)));
+    } else {
+        p2 = (7 * (ga0[4] / (i0 * i0 + 1)));
+        i0 = (f1(6, ga0[3], j0, 32767, i0, g0, 0, 899) - ((p2 > g1) - (v1 && v2)));
+    }
+    if ((((short)(381) - 9) - !((968l < p1)))) {
+        if (ga1[6]) {
+            i0 = v0;
+            if (2147483647) { return ((unsigned short)(p1) - (v2 >= v0)); }
+            v1 = v1;
+        }
+        if ((((9 / (p0 * p0 + 1)) == (8 > i0)) * ((310 + p3) >= ga0[7]))) {
+            if (((ga1[3] * 868) && 5)) { return ((788 == 4294967295) + (v0 == 2)); }
+            for (j0 = 2; j0 < 33; j0 = j0 + 1) {
+                v2 = (p1 > (-(g1) / 10));
+                p3 = (j0 * (p2 <= 3));
+            }
+        }
+        p0 = !(v0);
+    } else {
+        j0 = j0 + (ga0[2] / 10);
+        if (ga0[6]) {
+            i0 = i0;
+            v1 = 0;
+            while (v1 < 16) {
+                if (((v2 <= 255) || v1)) { break; }
+                if (ga1[5]) { break; }
+                if (f1(0, 8, 1, p1, p3, 2, v2, 10)) { break; }
+                v1 = v1 + 1;
+            }
+        } else {
+            p2 = ((p2 - 0) && ga1[1]);
+        }
+        v2 = ((char)(ga0[3]) <= (v0 / (j0 * j0 + 1)));
+    }
+    if ((p1 <= ((255 != 128) != 54802134679))) {
+        i0 = ga0[1];
+        for (v1 = 0; v1 < 5; v1 = v1 + 1) {
+            v2 = 3;
+            p3 = (unsigned char)((p2 >= 279));
+        }
+        j0 = ((0 - (829749201875 > g1)) / 1);
+    } else {
+        p1 = (p2 || (unsigned long)(g0));
+        p1 = (short)(5);
+    }
+    if (!(v2)) {
+        if ((p2 <= (9 != 8))) {
+            p1 = (((ga1[4] - 3ul) / 4) && (f1(p0, v1, v0, g1, 452, 8, ga1[2], v2) - (p2 != v2)));
+        } else {
+            v1 = ((ga1[2] / 3u) != ((ga0[3] > j0) < !(v2)));
+        }
+        v1 = ((10l - (unsigned short)(p2)) - 0);
+    } else {
+        v0 = ((v2 == ga0[3]) / 5l);
+    }
+    f1(g0, (0L || i0), 737, (0 >= i0), f0(4, 7, 5, 255), (v0 * 243876495031), (long)(6), f0(960268835509, 0, g1, p0));
+    p3 = 2;
+    return (((924515194835 <= v1) != -(v0)) || f0(p3, 812, v2, 544));
+}
+unsigned char f3(unsigned char p0, short p1, unsigned int p2, char p3) {
+    unsigned short v0 = 65536;
+    short v1 = 5;
+    long v2 = 6;
+    int i0 = 936;
+    long j0 = 632;
+    if ((10 == (!(j0) / (g0 * g0 + 1)))) {
+        j0 = (!(ga0[0]) / (p3 * p3 + 1));
+        v1 = -(f0(6, 458, g0, i0));
+    } else {
+        p2 = ((p2 - p0) - (451357654814 > (6 || p1)));
+        f0((800 && 3), (v2 + i0), (246 + 996), (648 <= p1));
+        p2 = p2 + ((ga1[4] != 128) / 5l);
+    }
+    p3 = (g1 <= (unsigned long)((p1 && g1)));
+    v0 = v0 + -((497 - 711504936663));
+    if (341) {
+        if (f1((ga1[7] / (g0 * g0 + 1)), v1, 6, (32767 - 508331263932), f2(p2, v2, v2, v1), 3, (0 && 4), (3 - 10))) {
+            p1 = -((-(7) < (p3 / (p2 * p2 + 1))));
+            if (((long)((741 >= v1)) - ((288 / (p1 * p1 + 1)) == -(331)))) {
+                p2 = 255;
+                f1((int)(i0), -(10), p0, (1000000007 < 0), -(6), (5u + g0), (v1 == 542), -(v0));
+                i0 = !(f1(561251389264, 255, 491298406057, j0, v1, ga1[5], p3, g1));
+            } else {
+                f1(ga1[3], !(v1), f0(v0, ga0[7], 6, 989027163665), (v1 + g1), v1, !(ga1[1]), (256 >= 8), i0);
+                f2((p1 - 526048905910), (5 / (p1 * p1 + 1)), (j0 != ga0[3]), v1);
+                f1(318, (4 + 2), f1(v1, 750327423788, 2, p2, 7, p2, p1, ga1[0]), v2, (ga1[3] <= p2), !(j0), !(935), 256);
+            }
+        }
+    } else {
+        f2(!(4), (i0 + v1), p3, (8 == 5u));
+        if ((char)((f0(ga0[1], 3, 164546032224, ga0[0]) - (674 / 1)))) {
+            switch (-(-(g0))) {
+            case 58:
+            case 552:
+            case -1:
+            case 4:
+                f0(p2, (v2 != g0), (704765885289 / (v0 * v0 + 1)), (7 / (g1 * g1 + 1)));
+                i0 = ((p3 * g1) + ((5 - p0) <= 909847352130));
+                break;
+            case 3:
+            case 39:
+            case 2:
+                f2((1 / (p0 * p0 + 1)), ga1[4], i0, 1);
+                if (f0(i0, 3, 8ul, 1)) { return j0; }
+                break;
+            }
+            if (ga0[0]) {
+                f2((ga0[7] || 9), -(g0), 6, (ga0[2] == 9));
+                v1 = (((g1 > ga0[1]) + v1) >= (char)(v1));
+                f2((unsigned short)(g0), 241989672572, -(v1), p0);
+            }
+            if ((861 || !(v2))) {
+                f1(f2(i0, 6, ga0[0], v0), -(p2), (9 / 2), f2(0, 5, v1, p0), (p0 - 5), 1004301265555, -(0U), 918226140148);
+                f1((2 / (g1 * g1 + 1)), (i0 <= p3), p1, (p1 / 1024), -(ga0[0]), p0, ga1[6], (v2 >= 8));
+                f1(f1(i0, 7, j0, 8, p3, g1, ga1[0], v2), (288 != 886), (unsigned int)(117), 58966435828, ga0[2], !(j0), f1(10, 4294967295, v0, p3, p1, 226, 410, 1000000007), g1);
+            }
+        }
+        p0 = j0;
+    }
+    if ((((p0 || 5) + -(v2)) + -((443 != 725)))) {
+        p2 = (ga1[6] + p2);
+    }
+    return (-((int)(p0)) * (g0 * (p3 * p3)));
+}
+int rec(int n, int acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 1, acc * 3 + n);
+}
+int main() {
+    unsigned short v0 = 32767;
+    unsigned int v1 = 272;
+    unsigned int v2 = 342;
+    int v3 = 4;
+    int v4 = 787006602236;
+    long v5 = 273;
+    int i0 = 2;
+    long j0 = 121;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 182; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 398; }
+    v2 = g1;
+    v2 = g0;
+    if (g0 >= 0 && g0 < 8) { ga0[g0] = v0; }
+    switch ((unsigned int)(ga1[0])) {
+    case 51:
+        if (!(((short)(v4) > (v1 && 6)))) {
+            v2 = -(i0);
+        } else {
+            g0 = 813;
+            w0(4, 9U);
+        }
+    case 45:
+        break;
+    case 25:
+        w0(1, v4);
+        if (v3 >= 0 && v3 < 8) { la1[v3] = -(313); }
+    case 631:
+        break;
+    case 2:
+        break;
+    case 435:
+        break;
+    case -1:
+        if (v5 >= 0 && v5 < 16) { la0[v5] = v3; }
+        g0 = (unsigned long)((unsigned int)((v5 < 2)));
+        break;
+    case -3:
+        break;
+    default:
+        break;
+    }
+    w0(v3, 120);
+    w0(v5, la1[4]);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,644 @@
+	.section .data
+	.type g1, @object
+	.size g1, 2
+	.p2align 1
+g1:
+	.short 10
+	.section .bss
+	.type g0, @object
+	.size g0, 2
+	.p2align 1
+g0:
+	.zero 2
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 32
+	.p2align 5
+ga1:
+	.zero 32
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $256, %rsp
+	movw $32767, -2(%rbp)
+	movl $272, -8(%rbp)
+	movl $342, -12(%rbp)
+	movl $4, -16(%rbp)
+	movl $1027587068, -20(%rbp)
+	movq $273, -32(%rbp)
+	movl $2, -36(%rbp)
+	movq $121, -48(%rbp)
+	movl $0, -36(%rbp)
+	imull $182, -36(%rbp), %eax
+	subl $182, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	addl $182, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $182, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $182, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $182, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -128(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -36(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	addl $182, -116(%rbp)
+	movslq -36(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L4
+.L5:
+	movl $0, -36(%rbp)
+	movl $0, -160(%rbp)
+	movl $398, -156(%rbp)
+	movl $796, -152(%rbp)
+	movl $1194, -148(%rbp)
+	movl $1592, -144(%rbp)
+	movl $1990, -140(%rbp)
+	movl $2388, -136(%rbp)
+	movl $2786, -132(%rbp)
+	movl $8, -36(%rbp)
+	movzwl g1(%rip), %eax
+	movl %eax, -12(%rbp)
+	movswl g0(%rip), %eax
+	movl %eax, -12(%rbp)
+	movswl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L6
+	movswl g0(%rip), %eax
+	cmpl $8, %eax
+	jge .L6
+	movswq g0(%rip), %rax
+	movzwl -2(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L6:
+.L7:
+	movl ga1+0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $45, %rax
+	jge .L18
+	cmpq $2, %rax
+	jge .L19
+	cmpq $-3, %rax
+	je .L8
+	cmpq $-1, %rax
+	je .L15
+.L17:
+.L8:
+	movl -16(%rbp), %eax
+	movw %ax, -170(%rbp)
+	movzwl -170(%rbp), %eax
+	movl %eax, -176(%rbp)
+	movq %rax, %rcx
+	movzwl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl %ecx, %eax
+	movw %ax, g1(%rip)
+	movswl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $120, %rax
+	movw %ax, g0(%rip)
+	movl ga0+28(%rip), %eax
+	addl -176(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L31:
+	movq -32(%rbp), %rax
+	movw %ax, -178(%rbp)
+	movl -144(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -192(%rbp)
+	movzwl -178(%rbp), %eax
+	movl %eax, -196(%rbp)
+	movq %rax, %rcx
+	movzwl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl %ecx, %eax
+	movw %ax, g1(%rip)
+	movswl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq -192(%rbp), %rax
+	movw %ax, g0(%rip)
+	movl ga0+28(%rip), %eax
+	addl -196(%rbp), %eax
+	movl %eax, ga0+0(%rip)
+.L32:
+	movq $0, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	movswq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	movzwl g1(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	movzwl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	movl -12(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	imulq $31, -208(%rbp), %rax
+	addq -48(%rbp), %rax
+	movq %rax, -208(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -212(%rbp)
+	testl %eax, %eax
+	je .L33
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -224(%rbp)
+	cmpq $0, -224(%rbp)
+	je .L36
+	.p2align 4,,10
+.L35:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -224(%rbp)
+	jne .L35
+.L36:
+.L33:
+.L34:
+	cmpl $8, -36(%rbp)
+	jge .L38
+	.p2align 4,,10
+.L37:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L37
+.L38:
+	movl $0, -36(%rbp)
+	cmpl $0, -212(%rbp)
+	je .L39
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L42
+	.p2align 4,,10
+.L41:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -232(%rbp)
+	jne .L41
+.L42:
+.L39:
+.L40:
+	cmpl $8, -36(%rbp)
+	jge .L44
+	.p2align 4,,10
+.L43:
+	movslq -36(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L43
+.L44:
+	movl $0, -36(%rbp)
+	cmpl $0, -120(%rbp)
+	je .L45
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L48
+	.p2align 4,,10
+.L47:
+	movslq -36(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -240(%rbp)
+	jne .L47
+.L48:
+.L45:
+.L46:
+	cmpl $16, -36(%rbp)
+	jge .L50
+	.p2align 4,,10
+.L49:
+	movslq -36(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L49
+.L50:
+	movl $0, -36(%rbp)
+	cmpl $0, -212(%rbp)
+	je .L51
+	movl $8, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -248(%rbp)
+	cmpq $0, -248(%rbp)
+	je .L54
+	.p2align 4,,10
+.L53:
+	movslq -36(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -248(%rbp)
+	jne .L53
+.L54:
+.L51:
+.L52:
+	cmpl $8, -36(%rbp)
+	jge .L56
+	.p2align 4,,10
+.L55:
+	movslq -36(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -208(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $8, -36(%rbp)
+	jl .L55
+.L56:
+	movq -208(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -208(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -208(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -208(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -208(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -208(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -208(%rbp)
+	movq -208(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L18:
+	cmpq $435, %rax
+	jge .L20
+	cmpq $45, %rax
+	je .L8
+	cmpq $51, %rax
+	je .L9
+	jmp .L17
+.L19:
+	cmpq $2, %rax
+	je .L8
+	cmpq $25, %rax
+	je .L11
+	jmp .L17
+.L20:
+	cmpq $435, %rax
+	je .L8
+	cmpq $631, %rax
+	je .L8
+	jmp .L17
+.L21:
+	movw $813, g0(%rip)
+	movzwl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl $4, %eax
+	movw %ax, g1(%rip)
+	movswl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq $9, %rax
+	movw %ax, g0(%rip)
+	movl ga0+28(%rip), %eax
+	addl $4, %eax
+	movl %eax, ga0+0(%rip)
+.L25:
+.L22:
+.L10:
+	jmp .L8
+.L11:
+	movslq -20(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movzwl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl $1, %eax
+	movw %ax, g1(%rip)
+	movswl g0(%rip), %eax
+	imull $3, %eax, %eax
+	movslq %eax, %rax
+	addq -168(%rbp), %rax
+	movw %ax, g0(%rip)
+	movl ga0+28(%rip), %eax
+	addl $1, %eax
+	movl %eax, ga0+0(%rip)
+.L26:
+	cmpl $0, -16(%rbp)
+	jl .L8
+	cmpl $8, -16(%rbp)
+	jge .L8
+	movslq -16(%rbp), %rax
+	movl $-313, -160(%rbp,%rax,4)
+.L27:
+.L28:
+.L12:
+	jmp .L8
+.L13:
+	jmp .L8
+.L14:
+	jmp .L8
+.L16:
+	jmp .L8
+.L9:
+	cmpl $0, -8(%rbp)
+	je .L23
+	movl $6, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L24
+.L23:
+	movl $0, %eax
+.L24:
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	movswl %ax, %eax
+	cmpl %ecx, %eax
+	jg .L21
+	xorl %eax, %eax
+	subl -36(%rbp), %eax
+	movl %eax, -12(%rbp)
+	jmp .L8
+.L15:
+	cmpq $0, -32(%rbp)
+	jl .L29
+	cmpq $16, -32(%rbp)
+	jge .L29
+	movq -32(%rbp), %rax
+	movl -16(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+.L29:
+.L30:
+	cmpq $2, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movw %ax, g0(%rip)
+	jmp .L8
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,245 @@
+unsigned int g0;
+char g1 = 892;
+unsigned int g2 = 463;
+long f0() {
+    long v0 = 9;
+    unsigned char v1 = 270;
+    long v2 = 499;
+    short v3 = 987l;
+    unsigned int v4 = 255;
+    int i0 = 6;
+    long j0 = 714;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 831L; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 5; }
+    v3 = (unsigned char)((96 + (unsigned char)(938)));
+    v3 = (unsigned char)(((g2 >= v2) < !(la1[0])));
+    for (v0 = 2; v0 < 5; v0 = v0 + 1) {
+        if ((1078335308308 + (9 <= (v1 || la0[0])))) {
+            j0 = (256 != v2);
+            v1 = (i0 + (unsigned char)((1024206755510 - 975)));
+            switch ((unsigned int)((6l / (v0 * v0 + 1)))) {
+            default:
+                break;
+            case 8:
+                break;
+            case 3:
+                if ((short)((v1 == 6))) { break; }
+            case 7:
+                if (v3) { break; }
+                if ((-(1060238520277) + (v3 / (j0 * j0 + 1)))) { break; }
+                break;
+            }
+        }
+        if (((4 || 0) - ((g2 - 10) > (8 == la0[10])))) {
+            if (57) { break; }
+        } else {
+            v1 = v1 + ((int)(v4) < !(la1[3]));
+        }
+    }
+    v4 = !((!(10) <= (991L + 256)));
+    return (v2 != (-(g1) + !(2)));
+}
+unsigned short f1() {
+    long v0 = 703U;
+    unsigned long v1 = 7;
+    unsigned short v2 = 10L;
+    int i0 = 6;
+    long j0 = 65536;
+    f0();
+    if (v2) {
+        switch (f0()) {
+        case -5:
+            if (((int)((g0 - g1)) > (unsigned int)(g2))) {
+                v0 = !(-(256));
+                f0();
+                f0();
+            }
+            if ((unsigned short)((unsigned int)(9))) {
+                v2 = 9;
+                f0();
+                if (387) { return !((v2 / 3)); }
+            }
+            break;
+        default:
+            break;
+        case 50:
+            break;
+        case 63:
+        case 3:
+            v0 = v1;
+            j0 = j0;
+            break;
+        case 516:
+            break;
+        }
+    }
+    if ((((1 != 395) + (4 == v1)) >= (g2 / 3))) {
+        if ((((550032732041 || 7) <= (529u / 13ul)) >= ((32767 && g0) * (32767 > 8)))) {
+            f0();
+            j0 = 817;
+            if (7) {
+                f0();
+                f0();
+            }
+        } else {
+            if ((-(!(v0)) * g1)) {
+                f0();
+            } else {
+                f0();
+                f0();
+                f0();
+            }
+            v1 = ((short)((127 / 10)) != (-(g1) < (913 != v2)));
+            f0();
+        }
+        if (576) {
+            f0();
+            for (v0 = 0; v0 < 4; v0 = v0 + 1) {
+                if ((-(7) / 13ul)) { break; }
+                v1 = (v1 == 63);
+                if (((6 || g2) >= f0())) { break; }
+            }
+        }
+    }
+    return (((g0 - g1) / (v0 * v0 + 1)) < v0);
+}
+long f2(unsigned short p0, int p1, int p2, unsigned short p3, unsigned char p4, int p5, short p6) {
+    unsigned long v0 = 177;
+    int v1 = 65535;
+    char v2 = 0;
+    int i0 = 969;
+    long j0 = 7;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 809; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 588; }
+    p1 = 0;
+    while (p1 < 33) {
+        p0 = g0;
+        v2 = (f1() || (char)((694011371278 - 661)));
+        p1 = p1 + 1;
+    }
+    v1 = ((g2 - 202) + p6);
+    if (-(-((347 / 1)))) {
+        j0 = (((v1 - la1[8]) == (unsigned short)(v1)) > ((4U || 776463257518) / (p4 * p4 + 1)));
+        if (la1[5]) {
+            if (((f0() || 2) * (char)(p6))) {
+                if (g2 >= 0 && g2 < 16) { la1[g2] = (j0 - p5); }
+            }
+            f1();
+            if (la0[8]) {
+                v0 = -(g1);
+                if (f0()) { return (p1 < 3); }
+            } else {
+                i0 = (((la0[26] / (v0 * v0 + 1)) + (10 < v0)) != (1 && (6 > p1)));
+            }
+        } else {
+            switch (f0()) {
+            case 6:
+                v0 = la0[5];
+            default:
+                p5 = p5 + 7;
+                f0();
+            }
+        }
+        v0 = 0;
+        while (v0 < 33) {
+            p2 = (7 / 5l);
+            v0 = v0 + 1;
+        }
+    }
+    return !((j0 < (60 - 223)));
+}
+unsigned short f3() {
+    unsigned int v0 = 2;
+    unsigned int v1 = 5;
+    int v2 = 6;
+    int v3 = 917;
+    int i0 = 1000000007;
+    long j0 = 7;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 5; }
+    f0();
+    v1 = (255 != (v2 && (la0[2] + 7ul)));
+    i0 = (unsigned char)((555U && 0));
+    return (4294967295 + !((538757170721 >= 157)));
+}
+void w3(unsigned char q0, unsigned int q1) {
+    g1 = g1 * 3 + q0;
+    g0 = g0 * 3 + q0;
+    g2 = g2 * 3 + q1;
+}
+int main() {
+    unsigned int v0 = 1058379023055;
+    short v1 = 3;
+    unsigned char v2 = 7;
+    long v3 = 0;
+    int i0 = 499;
+    long j0 = 805;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 6; }
+    v3 = 0;
+    while (v3 < 5) {
+        if (f2((1000000007 / (g0 * g0 + 1)), (v1 && g0), j0, f0(), (char)(i0), (5 - i0), (4294967295 * 962984642297))) {
+            j0 = (f0() + (v2 - g1));
+            g2 = ((2 <= -(v1)) && (373 == 127));
+            j0 = (f2(j0, 3, la0[2], g0, g0, v0, v1) * f3());
+        }
+        v3 = v3 + 1;
+    }
+    g1 = g1 + (g1 + 595);
+    if (((int)((255 != g2)) < 9)) {
+        if (10) {
+            v1 = g1;
+            switch ((387 + la0[5])) {
+            default:
+                g2 = g2 + 10;
+            case 0:
+                w3(4, g1);
+                break;
+            case 9:
+                f0();
+                break;
+            case 3:
+                break;
+            }
+        } else {
+            f3();
+            v2 = ((g2 < 522U) * g0);
+            la0[3] = 671;
+        }
+    }
+    if (547) {
+        w3(g1, 946);
+        w3(9u, v3);
+    } else {
+        switch (128) {
+        case 0:
+            i0 = ((unsigned short)((unsigned short)(v0)) <= (256 < (g2 + 297)));
+            la0[1] = la0[5];
+        case 61:
+            i0 = ((la0[0] > f3()) + 593418536546);
+            break;
+        default:
+            break;
+        }
+        v3 = v3 + -(g1);
+        i0 = (f3() > !(f2(la0[5], 216, v2, 918, 0, j0, 9)));
+    }
+    v2 = la0[6];
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + g2;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
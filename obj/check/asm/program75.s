@@ -0,0 +1,1724 @@
+	.section .data
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.byte 124
+	.type g2, @object
+	.size g2, 4
+	.p2align 2
+g2:
+	.long 463
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.section .text
+	.type f1, @function
+	.type f0, @function
+	.type f3, @function
+	.type f2, @function
+	.type f2.constprop.0, @function
+	.global main
+	.type main, @function
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq $703, -24(%rbp)
+	movq $7, -16(%rbp)
+	movw $10, -26(%rbp)
+	movq $65536, -8(%rbp)
+	call f0
+	cmpw $0, -26(%rbp)
+	je .L0
+	call f0
+	cmpq $50, %rax
+	jge .L8
+	cmpq $-5, %rax
+	je .L3
+	cmpq $3, %rax
+	je .L6
+.L4:
+.L5:
+.L2:
+.L0:
+.L1:
+	movl g2(%rip), %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	pushq %rax
+	movl $1, %eax
+	cmpl $395, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpq $4, -16(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	addl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jb .L15
+	movl $32767, %eax
+	cmpl $8, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $32767, %eax
+	testl %eax, %eax
+	je .L19
+	cmpl $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L20
+.L19:
+	movl $0, %eax
+.L20:
+	popq %rcx
+	imull %ecx, %eax
+	pushq %rax
+	movl $529, %eax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movabsq $550032732041, %rax
+	testq %rax, %rax
+	jne .L21
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L22
+.L21:
+	movl $1, %eax
+.L22:
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jl .L17
+	call f0
+	movl $7, %eax
+	testl %eax, %eax
+	je .L18
+	call f0
+	call f0
+.L23:
+.L24:
+	jmp .L18
+.L25:
+	call f0
+	call f0
+	call f0
+.L26:
+	movzwl -26(%rbp), %eax
+	cmpl $913, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $127, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movswl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	call f0
+.L18:
+	movl $576, %eax
+	testl %eax, %eax
+	je .L27
+	call f0
+	movq $0, -24(%rbp)
+	xorl %eax, %eax
+	subl $7, %eax
+	movslq %eax, %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, -8(%rbp)
+	cmpq $4, -24(%rbp)
+	jge .L30
+	.p2align 4,,10
+.L29:
+	cmpq $0, -8(%rbp)
+	je .L31
+.L30:
+.L27:
+.L28:
+.L15:
+.L16:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movl g0(%rip), %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cqo
+	idivq %rcx
+	cmpq -24(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+.f1_return:
+	leave
+	ret
+.L31:
+.L32:
+	cmpq $63, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	call f0
+	pushq %rax
+	movl $6, %eax
+	testl %eax, %eax
+	jne .L35
+	cmpl $0, g2(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L36
+.L35:
+	movl $1, %eax
+.L36:
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	jl .L33
+	jmp .L30
+.L33:
+.L34:
+	addq $1, -24(%rbp)
+	cmpq $4, -24(%rbp)
+	jl .L29
+	jmp .L30
+.L17:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movsbl g1(%rip), %ecx
+	imull %ecx, %eax
+	testl %eax, %eax
+	je .L25
+	call f0
+	jmp .L26
+.L8:
+	cmpq $50, %rax
+	je .L5
+	cmpq $63, %rax
+	je .L6
+	cmpq $516, %rax
+	je .L2
+	jmp .L4
+.L3:
+	movl g0(%rip), %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	cmpl g2(%rip), %eax
+	jbe .L9
+	xorl %eax, %eax
+	subl $256, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	call f0
+	call f0
+.L9:
+.L10:
+	movl $9, %eax
+	testw %ax, %ax
+	je .L2
+	movw $9, -26(%rbp)
+	call f0
+	movl $387, %eax
+	testl %eax, %eax
+	jne .LB0
+.L13:
+.L14:
+.L11:
+.L12:
+	jmp .L2
+.L6:
+	movq -16(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	jmp .L2
+.L7:
+	jmp .L2
+.LB0:
+	movzwl -26(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movq $9, -8(%rbp)
+	movb $14, -9(%rbp)
+	movq $499, -24(%rbp)
+	movw $987, -26(%rbp)
+	movl $255, -32(%rbp)
+	movl $6, -36(%rbp)
+	movq $714, -48(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L37
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -120(%rbp)
+	cmpq $0, -120(%rbp)
+	je .L40
+	.p2align 4,,10
+.L39:
+	movslq -36(%rbp), %rax
+	movq %rax, -128(%rbp)
+	imulq $831, %rax, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -136(%rbp)
+	imulq $831, %rax, %rax
+	movq %rax, %rcx
+	movq -136(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -144(%rbp)
+	imulq $831, %rax, %rax
+	movq %rax, %rcx
+	movq -144(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -152(%rbp)
+	imulq $831, %rax, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -120(%rbp)
+	jne .L39
+.L40:
+.L37:
+.L38:
+	cmpl $16, -36(%rbp)
+	jge .L42
+	.p2align 4,,10
+.L41:
+	movslq -36(%rbp), %rax
+	movq %rax, -160(%rbp)
+	imulq $831, %rax, %rax
+	movq %rax, %rcx
+	movq -160(%rbp), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L41
+.L42:
+	movl $0, -36(%rbp)
+	movl $0, -176(%rbp)
+	movl $5, -172(%rbp)
+	movl $10, -168(%rbp)
+	movl $15, -164(%rbp)
+	movl $4, -36(%rbp)
+	movw $10, -26(%rbp)
+	movl -176(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl g2(%rip), %eax
+	cmpq -24(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movw %ax, -26(%rbp)
+	movq $2, -8(%rbp)
+	cmpq $256, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -180(%rbp)
+	movl -36(%rbp), %eax
+	addl $231, %eax
+	movl %eax, -184(%rbp)
+	movabsq $-1060238520277, %rax
+	movq %rax, -192(%rbp)
+	movl $1, -196(%rbp)
+	cmpq $5, -8(%rbp)
+	jge .L44
+	.p2align 4,,10
+.L43:
+	cmpb $0, -9(%rbp)
+	jne .L47
+	movl -112(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L48
+.L47:
+	movl $1, %eax
+.L48:
+	cmpl $9, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $1078335308308, %rax
+	addq %rcx, %rax
+	je .L45
+	movslq -180(%rbp), %rax
+	movq %rax, -48(%rbp)
+	movl -184(%rbp), %eax
+	movb %al, -9(%rbp)
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	cqo
+	idivq %rcx
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L52
+	cmpq $7, %rax
+	je .L53
+	cmpq $8, %rax
+	je .L49
+.L50:
+	jmp .L49
+.L52:
+	movzbl -9(%rbp), %eax
+	cmpl $6, %eax
+	sete %al
+	movzbl %al, %eax
+	testw %ax, %ax
+	je .L54
+.L49:
+.L45:
+.L46:
+	movl -72(%rbp), %eax
+	cmpl $8, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl g2(%rip), %eax
+	subl $10, %eax
+	cmpl %ecx, %eax
+	seta %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -196(%rbp), %eax
+	subl %ecx, %eax
+	je .L60
+.L44:
+	movl $0, -32(%rbp)
+	xorl %eax, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L60:
+	movl -164(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -9(%rbp)
+.L61:
+	addq $1, -8(%rbp)
+	cmpq $5, -8(%rbp)
+	jl .L43
+	jmp .L44
+.L54:
+.L55:
+.L53:
+	cmpw $0, -26(%rbp)
+	je .L56
+	jmp .L49
+.L56:
+.L57:
+	movq -48(%rbp), %rax
+	imulq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movswq -26(%rbp), %rax
+	cqo
+	idivq %rcx
+	addq -192(%rbp), %rax
+	je .L49
+	jmp .L49
+.L51:
+	jmp .L49
+.L58:
+.L59:
+	jmp .L49
+	.size f0, .-f0
+	.align 16
+f3:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movl $6, -8(%rbp)
+	movl $10, -4(%rbp)
+	call f0
+	cmpl $0, -8(%rbp)
+	je .L62
+	movl -4(%rbp), %eax
+	movslq %eax, %rax
+	addq $7, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L63
+.L62:
+	movl $0, %eax
+.L63:
+	cmpl $255, %eax
+	setne %al
+	movzbl %al, %eax
+	movl $65535, %eax
+	leave
+	ret
+	.size f3, .-f3
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $336, %rsp
+	movw %di, -2(%rbp)
+	movl %esi, -8(%rbp)
+	movl %edx, -12(%rbp)
+	movw %cx, -14(%rbp)
+	movb %r8b, -15(%rbp)
+	movl %r9d, -20(%rbp)
+	movq $177, -32(%rbp)
+	movl $65535, -36(%rbp)
+	movb $0, -37(%rbp)
+	movl $969, -44(%rbp)
+	movq $7, -56(%rbp)
+	movl $0, -44(%rbp)
+	imull $809, -44(%rbp), %eax
+	subl $809, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -44(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -200(%rbp)
+	testl %eax, %eax
+	je .L64
+	movl $33, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L67
+	.p2align 4,,10
+.L66:
+	addl $809, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $809, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $809, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $809, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -208(%rbp)
+	jne .L66
+.L67:
+.L64:
+.L65:
+	cmpl $33, -44(%rbp)
+	jge .L69
+	.p2align 4,,10
+.L68:
+	addl $809, -196(%rbp)
+	movslq -44(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $33, -44(%rbp)
+	jl .L68
+.L69:
+	movl $0, -44(%rbp)
+	imull $588, -44(%rbp), %eax
+	subl $588, %eax
+	movl %eax, -276(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L70
+	movl $16, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -288(%rbp)
+	cmpq $0, -288(%rbp)
+	je .L73
+	.p2align 4,,10
+.L72:
+	addl $588, -276(%rbp)
+	movslq -44(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $588, -276(%rbp)
+	movslq -44(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $588, -276(%rbp)
+	movslq -44(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	addl $588, -276(%rbp)
+	movslq -44(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -288(%rbp)
+	jne .L72
+.L73:
+.L70:
+.L71:
+	cmpl $16, -44(%rbp)
+	jge .L75
+	.p2align 4,,10
+.L74:
+	addl $588, -276(%rbp)
+	movslq -44(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L74
+.L75:
+	movl $0, -8(%rbp)
+	movabsq $694011371278, %rax
+	subq $661, %rax
+	movq %rax, -296(%rbp)
+	cmpl $0, -200(%rbp)
+	je .L76
+	movl $33, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -304(%rbp)
+	cmpq $0, -304(%rbp)
+	je .L79
+	.p2align 4,,10
+.L78:
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L80
+	movq -296(%rbp), %rax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L81
+.L80:
+	movl $1, %eax
+.L81:
+	movb %al, -37(%rbp)
+	addl $1, -8(%rbp)
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L82
+	movq -296(%rbp), %rax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L83
+.L82:
+	movl $1, %eax
+.L83:
+	movb %al, -37(%rbp)
+	addl $1, -8(%rbp)
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L84
+	movq -296(%rbp), %rax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L85
+.L84:
+	movl $1, %eax
+.L85:
+	movb %al, -37(%rbp)
+	addl $1, -8(%rbp)
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L86
+	movq -296(%rbp), %rax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L87
+.L86:
+	movl $1, %eax
+.L87:
+	movb %al, -37(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -304(%rbp)
+	jne .L78
+.L79:
+.L76:
+.L77:
+	cmpl $33, -8(%rbp)
+	jge .L89
+	.p2align 4,,10
+.L88:
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L90
+	movq -296(%rbp), %rax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L91
+.L90:
+	movl $1, %eax
+.L91:
+	movb %al, -37(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jl .L88
+.L89:
+	movl g2(%rip), %eax
+	subl $202, %eax
+	movswl 16(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, -36(%rbp)
+	movl $347, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L92
+	movzbl -15(%rbp), %eax
+	movl %eax, -308(%rbp)
+	imull -308(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl $4, %eax
+	testl %eax, %eax
+	jne .L94
+	movabsq $776463257518, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L95
+.L94:
+	movl $1, %eax
+.L95:
+	popq %rcx
+	cltd
+	idivl %ecx
+	pushq %rax
+	movl -36(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movl -36(%rbp), %eax
+	movl -240(%rbp), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -56(%rbp)
+	movl -252(%rbp), %eax
+	testl %eax, %eax
+	je .L96
+	movswl 16(%rbp), %eax
+	movsbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	call f0
+	addq $8, %rsp
+	testq %rax, %rax
+	jne .L100
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L101
+.L100:
+	movl $1, %eax
+.L101:
+	popq %rcx
+	imull %ecx, %eax
+	testl %eax, %eax
+	je .L98
+	cmpl $0, g2(%rip)
+	jb .L102
+	cmpl $16, g2(%rip)
+	jae .L102
+	movq -56(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl g2(%rip), %eax
+	movl %ecx, -272(%rbp,%rax,4)
+.L102:
+.L103:
+.L98:
+.L99:
+	call f1
+	movl -160(%rbp), %eax
+	testl %eax, %eax
+	je .L104
+	xorl %eax, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	call f0
+	testq %rax, %rax
+	jne .LB1
+.L106:
+.L107:
+	jmp .L97
+.L96:
+	call f0
+	cmpq $6, %rax
+	je .L111
+	jmp .L112
+.L111:
+	movl -172(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+.L112:
+	addl $7, -20(%rbp)
+	call f0
+.L110:
+.L97:
+	movq $0, -32(%rbp)
+	movl $7, %eax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, -320(%rbp)
+	cmpq $33, -32(%rbp)
+	jae .L113
+	movl $33, %eax
+	subq -32(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -328(%rbp)
+	cmpq $0, -328(%rbp)
+	je .L116
+	.p2align 4,,10
+.L115:
+	movq -320(%rbp), %rax
+	movl %eax, -12(%rbp)
+	addq $1, -32(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -12(%rbp)
+	addq $1, -32(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -12(%rbp)
+	addq $1, -32(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -12(%rbp)
+	addq $1, -32(%rbp)
+	subq $1, -328(%rbp)
+	jne .L115
+.L116:
+.L113:
+.L114:
+	cmpq $33, -32(%rbp)
+	jae .L118
+	.p2align 4,,10
+.L117:
+	movq -320(%rbp), %rax
+	movl %eax, -12(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $33, -32(%rbp)
+	jb .L117
+.L118:
+.L92:
+.L93:
+	movl $60, %eax
+	subl $223, %eax
+	movslq %eax, %rax
+	cmpq %rax, -56(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L104:
+	movl $1, %eax
+	testl %eax, %eax
+	je .L108
+	cmpl $6, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L109
+.L108:
+	movl $0, %eax
+.L109:
+	movslq %eax, %rax
+	pushq %rax
+	cmpq $10, -32(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+.L105:
+	jmp .L97
+.LB1:
+	cmpl $3, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f2_return
+	.size f2, .-f2
+	.align 16
+f2.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $304, %rsp
+	movw %di, -2(%rbp)
+	movl %esi, -8(%rbp)
+	movl %edx, -12(%rbp)
+	movl %ecx, -16(%rbp)
+	movq $177, -24(%rbp)
+	movl $65535, -28(%rbp)
+	movb $0, -29(%rbp)
+	movl $969, -36(%rbp)
+	movq $7, -48(%rbp)
+	movl $0, -36(%rbp)
+	imull $809, -36(%rbp), %eax
+	subl $809, %eax
+	movl %eax, -196(%rbp)
+	cmpl $33, -36(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -200(%rbp)
+	testl %eax, %eax
+	je .L119
+	movl $33, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -208(%rbp)
+	cmpq $0, -208(%rbp)
+	je .L122
+	.p2align 4,,10
+.L121:
+	addl $809, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $809, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $809, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $809, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -208(%rbp)
+	jne .L121
+.L122:
+.L119:
+.L120:
+	cmpl $33, -36(%rbp)
+	jge .L124
+	.p2align 4,,10
+.L123:
+	addl $809, -196(%rbp)
+	movslq -36(%rbp), %rax
+	movl -196(%rbp), %ecx
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $33, -36(%rbp)
+	jl .L123
+.L124:
+	movl $0, -36(%rbp)
+	imull $588, -36(%rbp), %eax
+	subl $588, %eax
+	movl %eax, -276(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L125
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -288(%rbp)
+	cmpq $0, -288(%rbp)
+	je .L128
+	.p2align 4,,10
+.L127:
+	addl $588, -276(%rbp)
+	movslq -36(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $588, -276(%rbp)
+	movslq -36(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $588, -276(%rbp)
+	movslq -36(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	addl $588, -276(%rbp)
+	movslq -36(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	subq $1, -288(%rbp)
+	jne .L127
+.L128:
+.L125:
+.L126:
+	cmpl $16, -36(%rbp)
+	jge .L130
+	.p2align 4,,10
+.L129:
+	addl $588, -276(%rbp)
+	movslq -36(%rbp), %rax
+	movl -276(%rbp), %ecx
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L129
+.L130:
+	movl $0, -8(%rbp)
+	cmpl $0, -200(%rbp)
+	je .L131
+	movl $33, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -296(%rbp)
+	cmpq $0, -296(%rbp)
+	je .L134
+	.p2align 4,,10
+.L133:
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L135
+	movl $121, %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L136
+.L135:
+	movl $1, %eax
+.L136:
+	movb %al, -29(%rbp)
+	addl $1, -8(%rbp)
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L137
+	movl $121, %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L138
+.L137:
+	movl $1, %eax
+.L138:
+	movb %al, -29(%rbp)
+	addl $1, -8(%rbp)
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L139
+	movl $121, %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L140
+.L139:
+	movl $1, %eax
+.L140:
+	movb %al, -29(%rbp)
+	addl $1, -8(%rbp)
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L141
+	movl $121, %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L142
+.L141:
+	movl $1, %eax
+.L142:
+	movb %al, -29(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -296(%rbp)
+	jne .L133
+.L134:
+.L131:
+.L132:
+	cmpl $33, -8(%rbp)
+	jge .L144
+	.p2align 4,,10
+.L143:
+	movl g0(%rip), %eax
+	movw %ax, -2(%rbp)
+	call f1
+	testw %ax, %ax
+	jne .L145
+	movl $121, %eax
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L146
+.L145:
+	movl $1, %eax
+.L146:
+	movb %al, -29(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jl .L143
+.L144:
+	movl g2(%rip), %eax
+	subl $202, %eax
+	addl $9, %eax
+	movl %eax, -28(%rbp)
+	movl -28(%rbp), %eax
+	movzwl %ax, %eax
+	pushq %rax
+	movl -28(%rbp), %eax
+	movl -240(%rbp), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -48(%rbp)
+	movl -252(%rbp), %eax
+	testl %eax, %eax
+	je .L147
+	call f0
+	testq %rax, %rax
+	jne .L151
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L152
+.L151:
+	movl $1, %eax
+.L152:
+	imull $9, %eax, %eax
+	testl %eax, %eax
+	je .L149
+	cmpl $0, g2(%rip)
+	jb .L153
+	cmpl $16, g2(%rip)
+	jae .L153
+	movq -48(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movl g2(%rip), %eax
+	movl %ecx, -272(%rbp,%rax,4)
+.L153:
+.L154:
+.L149:
+.L150:
+	call f1
+	movl -160(%rbp), %eax
+	testl %eax, %eax
+	je .L155
+	xorl %eax, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	call f0
+	testq %rax, %rax
+	jne .LB2
+.L157:
+.L158:
+	jmp .L148
+.L147:
+	call f0
+	cmpq $6, %rax
+	je .L160
+	jmp .L161
+.L160:
+	movl -172(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+.L161:
+	addl $7, -16(%rbp)
+	call f0
+.L159:
+.L148:
+	movq $0, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jae .L162
+	movl $33, %eax
+	subq -24(%rbp), %rax
+	shrq $2, %rax
+	movq %rax, -304(%rbp)
+	cmpq $0, -304(%rbp)
+	je .L165
+	.p2align 4,,10
+.L164:
+	movl $1, -12(%rbp)
+	addq $1, -24(%rbp)
+	movl $1, -12(%rbp)
+	addq $1, -24(%rbp)
+	movl $1, -12(%rbp)
+	addq $1, -24(%rbp)
+	movl $1, -12(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -304(%rbp)
+	jne .L164
+.L165:
+.L162:
+.L163:
+	cmpq $33, -24(%rbp)
+	jae .L167
+	.p2align 4,,10
+.L166:
+	movl $1, -12(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jb .L166
+.L167:
+	cmpq $-163, -48(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.f2.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L155:
+	cmpl $6, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	cmpq $10, -24(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+.L156:
+	jmp .L148
+.LB2:
+	cmpl $3, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	jmp .f2.constprop.0_return
+	.size f2.constprop.0, .-f2.constprop.0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movl $1817068239, -4(%rbp)
+	movw $3, -6(%rbp)
+	movb $7, -7(%rbp)
+	movq $0, -16(%rbp)
+	movl $499, -20(%rbp)
+	movq $805, -32(%rbp)
+	movl $0, -20(%rbp)
+	movl $0, -64(%rbp)
+	movl $6, -60(%rbp)
+	movl $12, -56(%rbp)
+	movl $18, -52(%rbp)
+	movl $24, -48(%rbp)
+	movl $30, -44(%rbp)
+	movl $36, -40(%rbp)
+	movl $42, -36(%rbp)
+	movl $8, -20(%rbp)
+	movq $0, -16(%rbp)
+	movl $5, %eax
+	subl -20(%rbp), %eax
+	movl %eax, -68(%rbp)
+	movl $4294967295, %eax
+	movabsq $962984642297, %rcx
+	imulq %rcx, %rax
+	movq %rax, -80(%rbp)
+	xorl %eax, %eax
+	movswl -6(%rbp), %ecx
+	subl %ecx, %eax
+	cmpl $2, %eax
+	jl .L168
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L169
+.L168:
+	movl $0, %eax
+.L169:
+	movl %eax, -84(%rbp)
+	cmpq $5, -16(%rbp)
+	jge .L171
+	.p2align 4,,10
+.L170:
+	subq $8, %rsp
+	movq -80(%rbp), %rax
+	pushq %rax
+	movl -68(%rbp), %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	pushq %rax
+	call f0
+	pushq %rax
+	movq -32(%rbp), %rax
+	pushq %rax
+	cmpw $0, -6(%rbp)
+	je .L174
+	cmpl $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L175
+.L174:
+	movl $0, %eax
+.L175:
+	movq %rax, %rsi
+	movl g0(%rip), %eax
+	imull g0(%rip), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $1000000007, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f2
+	addq $16, %rsp
+	testq %rax, %rax
+	je .L172
+	movzbl -7(%rbp), %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	call f0
+	addq $8, %rsp
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -32(%rbp)
+	movl -84(%rbp), %eax
+	movl %eax, g2(%rip)
+	call f3
+	movzwl %ax, %eax
+	pushq %rax
+	movswl -6(%rbp), %eax
+	pushq %rax
+	movl -4(%rbp), %eax
+	movq %rax, %r9
+	movl g0(%rip), %eax
+	movq %rax, %r8
+	movl g0(%rip), %eax
+	movq %rax, %rcx
+	movl -56(%rbp), %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f2
+	addq $8, %rsp
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, -32(%rbp)
+.L172:
+.L173:
+	addq $1, -16(%rbp)
+	cmpq $5, -16(%rbp)
+	jl .L170
+.L171:
+	movsbl g1(%rip), %eax
+	addl $595, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	cmpl $255, g2(%rip)
+	setne %al
+	movzbl %al, %eax
+	cmpl $9, %eax
+	jge .L176
+	movsbl g1(%rip), %eax
+	movw %ax, -6(%rbp)
+	movl -44(%rbp), %eax
+	addl $387, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L180
+	cmpq $3, %rax
+	je .L178
+	cmpq $9, %rax
+	je .L181
+.L179:
+	addl $10, g2(%rip)
+.L180:
+	movsbl g1(%rip), %eax
+	movl %eax, -88(%rbp)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl $4, %eax
+	movb %al, g1(%rip)
+	imull $3, g0(%rip), %eax
+	addl $4, %eax
+	movl %eax, g0(%rip)
+	imull $3, g2(%rip), %eax
+	addl -88(%rbp), %eax
+	movl %eax, g2(%rip)
+.L183:
+.L178:
+.L176:
+.L177:
+	movsbl g1(%rip), %eax
+	movb %al, -89(%rbp)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	movzbl -89(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+	imull $3, g0(%rip), %eax
+	movzbl -89(%rbp), %ecx
+	addl %ecx, %eax
+	movl %eax, g0(%rip)
+	imull $3, g2(%rip), %eax
+	addl $946, %eax
+	movl %eax, g2(%rip)
+.L184:
+	movq -16(%rbp), %rax
+	movl %eax, -96(%rbp)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl $9, %eax
+	movb %al, g1(%rip)
+	imull $3, g0(%rip), %eax
+	addl $9, %eax
+	movl %eax, g0(%rip)
+	imull $3, g2(%rip), %eax
+	addl -96(%rbp), %eax
+	movl %eax, g2(%rip)
+.L185:
+	movl -40(%rbp), %eax
+	movb %al, -7(%rbp)
+	movq $0, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movl g0(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movsbq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movl g2(%rip), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movl -4(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movswq -6(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movzbl -7(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	imulq $31, -104(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -104(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jge .L186
+	movl $8, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L189
+	.p2align 4,,10
+.L188:
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -112(%rbp)
+	jne .L188
+.L189:
+.L186:
+.L187:
+	cmpl $8, -20(%rbp)
+	jge .L191
+	.p2align 4,,10
+.L190:
+	movslq -20(%rbp), %rax
+	movl -64(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -104(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $8, -20(%rbp)
+	jl .L190
+.L191:
+	movq -104(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -104(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -104(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -104(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -104(%rbp)
+	movq -104(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L182:
+	jmp .L178
+.L181:
+	call f0
+	jmp .L178
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
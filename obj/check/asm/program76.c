@@ -0,0 +1,297 @@
+unsigned int f0(unsigned long p0, unsigned char p1, char p2, unsigned int p3, unsigned char p4, unsigned char p5, unsigned int p6, char p7) {
+    short v0 = 401;
+    long v1 = 883ul;
+    int v2 = 642214486610;
+    unsigned int v3 = 706843109906L;
+    int i0 = 1;
+    long j0 = 3;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 9; }
+    if (la0[14]) { return (3ul / (p0 * p0 + 1)); }
+    p0 = 0;
+    while (p0 < 3) {
+        v1 = v1 + v2;
+        p0 = p0 + 1;
+    }
+    if (167) { return ((0 / (v3 * v3 + 1)) / 7); }
+    if (479) {
+        p6 = (char)(!(8));
+        if (p6 >= 0 && p6 < 16) { la0[p6] = (la0[6] <= 919); }
+        p2 = !(p7);
+    } else {
+        v3 = ((!(1) - p2) + (p7 / 1));
+        j0 = j0;
+    }
+    if ((short)(p0)) { return p5; }
+    if (1) {
+        switch ((unsigned char)(p1)) {
+        case 7:
+            p7 = p7 + v0;
+        default:
+            p1 = (unsigned int)((int)((550 / 3u)));
+            if (v2 >= 0 && v2 < 16) { la0[v2] = i0; }
+            break;
+        case 4:
+        case 5:
+            if (v0) {
+                p0 = (5 && la0[14]);
+                la0[15] = 4;
+            }
+            for (p3 = 1; p3 < 8; p3 = p3 + 1) {
+                p6 = (long)(p4);
+                if (p1) { break; }
+            }
+        case 6:
+            p5 = (-((unsigned char)(9)) || (607L && (931 + la0[8])));
+            break;
+        case -2:
+            if ((v2 == 5)) { return ((la0[14] != v2) < p2); }
+            if (8) { return i0; }
+        }
+        v0 = (948533765031 != 669u);
+        if (p3 >= 0 && p3 < 16) { la0[p3] = 5; }
+    } else {
+        if (((4 || v2) <= p3)) { return -((la0[9] + v0)); }
+    }
+    switch ((0 / 1024)) {
+    case 5:
+        p6 = !(v0);
+        for (p6 = 0; p6 < 17; p6 = p6 + 1) {
+            p1 = ((127 - 3) * 973);
+        }
+        break;
+    case 2:
+    default:
+        switch (0) {
+        case 1:
+            p6 = (7 / 100);
+            v0 = (v3 <= !((p3 == 3)));
+            break;
+        case 2:
+        case 6:
+            i0 = (la0[7] * v3);
+            p0 = p0;
+            break;
+        default:
+            v0 = p2;
+        }
+        p5 = p6;
+    case 8:
+        v0 = 0;
+        while (v0 < 100) {
+            p6 = (-(7) + 10);
+            switch (la0[15]) {
+            case 45:
+                break;
+            case -5:
+                if (j0) { break; }
+                if ((5 || 964983715463)) { return (87792844399 || 5); }
+                break;
+            case -1:
+                if (6L) { break; }
+            case 32:
+                p0 = 273;
+                if (!(!(32767))) { break; }
+                break;
+            case 169:
+                p6 = (255 / 3u);
+                p5 = -(((2 == p0) == 247));
+            default:
+                break;
+            case 454:
+                if (la0[5]) { break; }
+                if (p3 >= 0 && p3 < 16) { la0[p3] = -((v2 - la0[14])); }
+                break;
+            }
+            v0 = v0 + 1;
+        }
+        break;
+    case 7:
+        if (p3 >= 0 && p3 < 16) { la0[p3] = p3; }
+        break;
+    }
+    return 0;
+}
+unsigned int f1(unsigned char p0) {
+    long v0 = 848;
+    unsigned long v1 = 154;
+    unsigned int v2 = 795;
+    unsigned int v3 = 749;
+    unsigned long v4 = 8;
+    unsigned int v5 = 3;
+    int i0 = 17;
+    long j0 = 10;
+    p0 = p0 + (!(739ul) && 128);
+    if (i0) {
+        if ((int)(((p0 == j0) <= (i0 + 3)))) {
+            if (!(((10 - v2) < (v3 || 1ul)))) {
+                if (((v3 + p0) == (5 == 6ul))) { return 2; }
+            } else {
+                f0(f0(3u, v0, 890, 850L, v5, p0, v3, v2), f0(v1, 242658088679, 876, 65536, 7, 435, 9, 3), 32767, i0, f0(v3, p0, 445ul, v3, 306, 64561080036, i0, p0), (732 / 10), !(3), j0);
+                v2 = (1 / (v1 * v1 + 1));
+                f0((j0 + v0), !(146), (j0 && v1), (i0 / (i0 * i0 + 1)), v2, v1, f0(v1, 815, 172, 163, 515519416020, 198, 974759516076, 1), 756);
+            }
+            i0 = 359;
+            switch ((unsigned char)(j0)) {
+            case 933:
+                f0((996 / 2), !(v2), j0, (j0 * v2), v5, (v0 + j0), !(2), v3);
+                break;
+            case -1:
+                break;
+            default:
+                i0 = f0((j0 || v4), 141, 410, v5, v4, (3 && p0), v4, (2 != 2));
+                f0(486596167652, (int)(259), (unsigned char)(10ul), (v5 / 13ul), (v0 / 13ul), v0, (7 || 2), (1000000007 + i0));
+                break;
+            case 32:
+                break;
+            case 7:
+                f0(v5, (p0 / 10), v1, (v0 / 100), 1, (281284909955 <= v0), f0(i0, v0, j0, v1, 4, v5, 997, 678), 694405677791);
+                v5 = ((0 >= (v5 != 149)) < (unsigned long)(v2));
+                break;
+            case 13:
+                v1 = f0(f0(i0, 739769958100, v1, 446, 985, 484232222516, v4, 5), (v2 <= v5), 5, (unsigned int)(p0), (v3 != v1), 53, v3, v1);
+                v5 = v4;
+                break;
+            case 59:
+                f0(0, (921 >= i0), p0, 1, 6, (256ul <= j0), 497, j0);
+                break;
+            case 570:
+                f0(f0(158ul, j0, 4294967295, v5, 530283565833, v4, j0, j0), (long)(j0), (516 != v2), (int)(5), (611l < v1), 0, (809454161510 - 1000000007), v1);
+                f0((v1 / 1024), v4, v3, (v2 * v3), 8, 956, (562 - 1), (7 > v5));
+            case 129:
+                i0 = 1000000007;
+            }
+        } else {
+            if ((char)(3)) {
+                p0 = f0(-(1), (v5 < 5l), (v4 >= 0), v3, (v2 + 0), i0, 826, 6);
+            } else {
+                v4 = 153;
+                f0((v0 / 2), !(v0), v2, (7 == 0), (i0 - 428), f0(1007639520978, p0, i0, 87L, 568U, v3, i0, v0), !(960426434415L), f0(960, v4, 1, 2, 676, 10, 3, 4));
+                f0(v2, (7 / 1), (v1 <= 2l), 0, 269, (j0 - v0), (unsigned long)(738), -(5));
+            }
+            v1 = (unsigned long)(4);
+            v2 = v0;
+        }
+        p0 = ((!(i0) / 2) < (259 + f0(148, 254, 65536, v1, i0, 1, 963, v1)));
+        if (!(!((p0 + v5)))) {
+            for (v3 = 2; v3 < 16; v3 = v3 + 1) {
+                j0 = -(v2);
+                if (f0(575, 136223359593, 443, 509, 300, v5, v5, v1)) { break; }
+                p0 = 153;
+            }
+            switch ((f0(7, 235, j0, v3, 5, 2147483647, p0, v4) < 10)) {
+            case 5:
+                v1 = f0(v0, (9 <= 976), (680 - v4), (j0 / (i0 * i0 + 1)), i0, -(818), v1, (p0 != v2));
+                i0 = i0;
+                break;
+            default:
+                break;
+            case 4:
+                f0(!(175347829549), 331, (638899757854 - 6), (j0 / (v5 * v5 + 1)), (2147483647 / 8), f0(j0, 978, p0, v3, 0, 326, v3, i0), (v0 && 2), (0 / (v5 * v5 + 1)));
+                break;
+            }
+        } else {
+            j0 = 4;
+            switch (((688701337281 && j0) + (unsigned int)(7))) {
+            case 5:
+                break;
+            case 4:
+                break;
+            case 8:
+                f0(2, (823 / 3u), !(127), (i0 > 3), 32767, -(9), 250636697512, !(65535));
+                break;
+            case 6:
+                v3 = (((393 - v2) / 10) <= (421 || (v5 > j0)));
+                break;
+            default:
+                f0(v2, (i0 / 5l), (unsigned char)(787), (6 + v5), (short)(10), 4294967295, 429900748433, (unsigned short)(53));
+            }
+            if (4) {
+                f0(i0, (unsigned int)(p0), 4, 232, v4, (268 * 363), i0, f0(537517147884, v5, v1, 4, 8, 496, v4, 591383674845));
+                f0((5 != v0), -(7), f0(575, 255, 4294967295, 255, 191, 9, 10, v2), !(3), v2, (1 - 6), (v1 / 3), 9);
+            } else {
+                if (-((2147483647 * v3))) { return (unsigned long)(482); }
+                v1 = v1 + 502;
+            }
+        }
+    } else {
+        f0((913284244456 < 8), 213, (v1 - v5), (v0 / (v1 * v1 + 1)), (unsigned long)(v0), (v3 || 0u), (813 <= v2), 8);
+        if ((4 < 8)) {
+            if (!(-((127 >= 10)))) {
+                f0((unsigned char)(1098084761305L), 4, !(v2), 4294967295, (short)(v1), (v1 - 717188756358), f0(v4, 497, 813, p0, v0, 258, 624064931821, 8), 67);
+                v3 = v3 + ((2 + 7) == (4 || i0));
+            }
+        } else {
+            if (1) {
+                f0(255, 2, (745 * 804), j0, (527599574599 > 955683312610), -(4), (v4 / 1024), -(7));
+                f0(f0(v2, v0, v4, i0, v0, 7, 189, v4), v2, j0, (v2 && 377), !(4), (i0 / (j0 * j0 + 1)), -(309), 24);
+            } else {
+                f0(5, (v1 || v4), p0, f0(i0, 871, v5, v4, v3, j0, i0, v0), (256 - 6), f0(v2, 9, 709101936158, 4, 10, v2, 2l, v1), (6 / (v1 * v1 + 1)), 8u);
+            }
+            i0 = 0;
+            while (i0 < 5) {
+                j0 = f0((j0 - 7), 893, f0(p0, 1000000007, v0, 272, 404974888700, v4, 511, v5), (1 || p0), (j0 / (v0 * v0 + 1)), (v1 - p0), f0(2, v5, 159, 93534888922, 823, 3, 472, 779), v5);
+                if ((long)(-(i0))) { return v0; }
+                f0(422, (10 * 2147483647), f0(v2, 7, 10, 970, v5, 933, 573, i0), -(852), (char)(j0), (265201295000 + 9), (long)(v4), 487);
+                i0 = i0 + 1;
+            }
+        }
+        if ((!(j0) / 1)) { return ((i0 || 1l) >= (1 == j0)); }
+    }
+    v0 = f0((p0 <= 883), (v2 >= 164), 104, -(v1), (v3 / 13ul), 8, (2 - 580), (unsigned char)(836));
+    v5 = ((8 == j0) / 1024);
+    v2 = 0;
+    if (((p0 / 2) - (unsigned char)(!(v5)))) {
+        v2 = (unsigned int)(j0);
+        v4 = ((-(2) > p0) > ((922 - 65536) == (13 && v2)));
+    } else {
+        if ((v3 || (p0 - !(v4)))) {
+            if (!((v0 || j0))) {
+                v0 = ((short)(p0) + (7 - i0));
+                f0(!(5), v5, (2 / 1024), (p0 || 611), 8, (p0 == 333), (2 || v1), i0);
+            } else {
+                f0((unsigned char)(622), f0(p0, 866041558558, v5, 528, p0, 0, 4, 127), -(v1), (1008889722658 != v1), (65536 - 318), !(317), f0(v3, v0, 7, 1L, p0, j0, 9l, v4), f0(v5, 2, 2147483647, 445, 403, 782U, j0, 8));
+            }
+            f0(f0(v4, v0, v0, i0, 885587015395, 907, 128, 304), f0(i0, v3, v0, v3, v0, 1u, 5, 4), v3, (i0 + v3), (unsigned short)(211600030370), (6 && 2), (i0 + 978), (256 >= i0));
+        } else {
+            v4 = -((5 / (v0 * v0 + 1)));
+            f0((428 && v5), (p0 - v5), (char)(494), (128u < 788), p0, 776, (3U == 1), i0);
+            v0 = v5;
+        }
+    }
+    v5 = v5 + (!(3) >= (j0 - 700));
+    v2 = v2 + f0(272, 64, 9U, 8, 9U, v2, 8, 9);
+    return (v2 > ((int)(v5) + f0(775615928123, 238, 366, v5, 0, 10, v3, j0)));
+}
+int main() {
+    int v0 = 2;
+    unsigned char v1 = 124;
+    unsigned short v2 = 8;
+    short v3 = 684072268489;
+    long v4 = 540;
+    int i0 = 65536;
+    long j0 = 8;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 829; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 642; }
+    f1(760);
+    f0((i0 < v0), v0, 2, !(202l), (283L / 16), 0, (unsigned char)(i0), f1(926));
+    v1 = f1((v0 / 10));
+    for (v0 = 1; v0 < 8; v0 = v0 + 1) {
+        v1 = ((v1 != -(7)) + (v1 / 16));
+    }
+    f0(f0(4, 3, v4, j0, 969, 6, 6, la0[4]), v3, 65535, (la0[13] == 2), (v2 || 781), v1, 255, (unsigned int)(271593425689L));
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
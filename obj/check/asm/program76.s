@@ -0,0 +1,2910 @@
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.0.constprop.2, @function
+	.global main
+	.type main, @function
+	.type f1, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rdi, -8(%rbp)
+	movb %sil, -9(%rbp)
+	movb %dl, -10(%rbp)
+	movl %ecx, -16(%rbp)
+	movb %r8b, -17(%rbp)
+	movb %r9b, -18(%rbp)
+	movw $401, -20(%rbp)
+	movq $883, -32(%rbp)
+	movl $-2030607790, -36(%rbp)
+	movl $2468473362, -40(%rbp)
+	movl $1, -44(%rbp)
+	movq $3, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L0
+	movl $16, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -136(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -44(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L4
+.L5:
+	movl -72(%rbp), %eax
+	testl %eax, %eax
+	je .L6
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	xorl %edx, %edx
+	divq %rcx
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L6:
+.L7:
+	movq $0, -8(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -144(%rbp)
+	addq %rax, -32(%rbp)
+	movq -144(%rbp), %rax
+	addq %rax, -32(%rbp)
+	movq -144(%rbp), %rax
+	addq %rax, -32(%rbp)
+	movq $3, -8(%rbp)
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rdi, -8(%rbp)
+	movb %sil, -9(%rbp)
+	movb %dl, -10(%rbp)
+	movl %ecx, -16(%rbp)
+	movb %r8b, -17(%rbp)
+	movl %r9d, -24(%rbp)
+	movw $401, -26(%rbp)
+	movq $883, -40(%rbp)
+	movl $-2030607790, -44(%rbp)
+	movl $2468473362, -48(%rbp)
+	movl $1, -52(%rbp)
+	movq $3, -64(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L8
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L11
+	.p2align 4,,10
+.L10:
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -136(%rbp)
+	jne .L10
+.L11:
+.L8:
+.L9:
+	cmpl $16, -52(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L12
+.L13:
+	movl -72(%rbp), %eax
+	testl %eax, %eax
+	je .L14
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	xorl %edx, %edx
+	divq %rcx
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L14:
+.L15:
+	movq $0, -8(%rbp)
+	movslq -44(%rbp), %rax
+	movq %rax, -144(%rbp)
+	addq %rax, -40(%rbp)
+	movq -144(%rbp), %rax
+	addq %rax, -40(%rbp)
+	movq -144(%rbp), %rax
+	addq %rax, -40(%rbp)
+	movq $3, -8(%rbp)
+	movl -48(%rbp), %eax
+	imull -48(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rdi, -8(%rbp)
+	movb %sil, -9(%rbp)
+	movb %dl, -10(%rbp)
+	movl %ecx, -16(%rbp)
+	movb %r8b, -17(%rbp)
+	movl %r9d, -24(%rbp)
+	movw $401, -26(%rbp)
+	movq $883, -40(%rbp)
+	movl $-2030607790, -44(%rbp)
+	movl $2468473362, -48(%rbp)
+	movl $1, -52(%rbp)
+	movq $3, -64(%rbp)
+	movl $0, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jge .L16
+	movl $16, %eax
+	movslq -52(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L19
+	.p2align 4,,10
+.L18:
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	subq $1, -136(%rbp)
+	jne .L18
+.L19:
+.L16:
+.L17:
+	cmpl $16, -52(%rbp)
+	jge .L21
+	.p2align 4,,10
+.L20:
+	movslq -52(%rbp), %rax
+	imull $9, -52(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -52(%rbp)
+	cmpl $16, -52(%rbp)
+	jl .L20
+.L21:
+	movl -72(%rbp), %eax
+	testl %eax, %eax
+	je .L22
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	xorl %edx, %edx
+	divq %rcx
+.f0.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L22:
+.L23:
+	movq $0, -8(%rbp)
+	movslq -44(%rbp), %rax
+	movq %rax, -144(%rbp)
+	addq %rax, -40(%rbp)
+	movq -144(%rbp), %rax
+	addq %rax, -40(%rbp)
+	movq -144(%rbp), %rax
+	addq %rax, -40(%rbp)
+	movq $3, -8(%rbp)
+	movl -48(%rbp), %eax
+	imull -48(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	jmp .f0.constprop.1_return
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $144, %rsp
+	movq %rdi, -8(%rbp)
+	movb %sil, -9(%rbp)
+	movl %edx, -16(%rbp)
+	movl %ecx, -20(%rbp)
+	movb %r8b, -21(%rbp)
+	movw $401, -24(%rbp)
+	movq $883, -32(%rbp)
+	movl $-2030607790, -36(%rbp)
+	movl $2468473362, -40(%rbp)
+	movl $1, -44(%rbp)
+	movq $3, -56(%rbp)
+	movl $0, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jge .L24
+	movl $16, %eax
+	movslq -44(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -136(%rbp)
+	cmpq $0, -136(%rbp)
+	je .L27
+	.p2align 4,,10
+.L26:
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	subq $1, -136(%rbp)
+	jne .L26
+.L27:
+.L24:
+.L25:
+	cmpl $16, -44(%rbp)
+	jge .L29
+	.p2align 4,,10
+.L28:
+	movslq -44(%rbp), %rax
+	imull $9, -44(%rbp), %ecx
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -44(%rbp)
+	cmpl $16, -44(%rbp)
+	jl .L28
+.L29:
+	movl -72(%rbp), %eax
+	testl %eax, %eax
+	je .L30
+	movq -8(%rbp), %rax
+	imulq -8(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	xorl %edx, %edx
+	divq %rcx
+.f0.constprop.0.constprop.2_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L30:
+.L31:
+	movq $0, -8(%rbp)
+	movslq -36(%rbp), %rax
+	movq %rax, -144(%rbp)
+	addq %rax, -32(%rbp)
+	movq -144(%rbp), %rax
+	addq %rax, -32(%rbp)
+	movq -144(%rbp), %rax
+	addq %rax, -32(%rbp)
+	movq $3, -8(%rbp)
+	movl -40(%rbp), %eax
+	imull -40(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	jmp .f0.constprop.0.constprop.2_return
+	.size f0.constprop.0.constprop.2, .-f0.constprop.0.constprop.2
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movl $2, -4(%rbp)
+	movb $124, -5(%rbp)
+	movw $8, -8(%rbp)
+	movw $29385, -10(%rbp)
+	movq $540, -24(%rbp)
+	movl $65536, -28(%rbp)
+	movq $8, -40(%rbp)
+	movl $0, -28(%rbp)
+	imull $829, -28(%rbp), %eax
+	subl $829, %eax
+	movl %eax, -116(%rbp)
+	cmpl $16, -28(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -120(%rbp)
+	testl %eax, %eax
+	je .L32
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L33
+	.p2align 4,,10
+.L34:
+	addl $829, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $829, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $829, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	addl $829, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -128(%rbp)
+	jne .L34
+.L35:
+.L32:
+.L33:
+	cmpl $16, -28(%rbp)
+	jge .L37
+	.p2align 4,,10
+.L36:
+	addl $829, -116(%rbp)
+	movslq -28(%rbp), %rax
+	movl -116(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L36
+.L37:
+	movl $0, -28(%rbp)
+	movl $0, -144(%rbp)
+	movl $642, -140(%rbp)
+	movl $1284, -136(%rbp)
+	movl $1926, -132(%rbp)
+	movl $4, -28(%rbp)
+	movl $248, %eax
+	movq %rax, %rdi
+	call f1
+	movl $158, %eax
+	movq %rax, %rdi
+	call f1
+	pushq %rax
+	movl -28(%rbp), %eax
+	movzbl %al, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movl $17, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl $2, %eax
+	movq %rax, %rdx
+	movl -4(%rbp), %eax
+	movq %rax, %rsi
+	movl -28(%rbp), %eax
+	cmpl -4(%rbp), %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl -4(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rdi
+	call f1
+	movb %al, -5(%rbp)
+	movl $1, -4(%rbp)
+	movl $-7, -148(%rbp)
+	cmpl $8, -4(%rbp)
+	jge .L38
+	movl $8, %eax
+	movslq -4(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L39
+	.p2align 4,,10
+.L40:
+	movzbl -5(%rbp), %eax
+	movl %eax, -164(%rbp)
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movl -164(%rbp), %eax
+	cmpl -148(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movb %al, -5(%rbp)
+	addl $1, -4(%rbp)
+	movzbl -5(%rbp), %eax
+	movl %eax, -168(%rbp)
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movl -168(%rbp), %eax
+	cmpl -148(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movb %al, -5(%rbp)
+	addl $1, -4(%rbp)
+	movzbl -5(%rbp), %eax
+	movl %eax, -172(%rbp)
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movl -172(%rbp), %eax
+	cmpl -148(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movb %al, -5(%rbp)
+	addl $1, -4(%rbp)
+	movzbl -5(%rbp), %eax
+	movl %eax, -176(%rbp)
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movl -176(%rbp), %eax
+	cmpl -148(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movb %al, -5(%rbp)
+	addl $1, -4(%rbp)
+	subq $1, -160(%rbp)
+	jne .L40
+.L41:
+.L38:
+.L39:
+	cmpl $8, -4(%rbp)
+	jge .L43
+	.p2align 4,,10
+.L42:
+	movzbl -5(%rbp), %eax
+	movl %eax, -180(%rbp)
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movl -180(%rbp), %eax
+	cmpl -148(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	addl %ecx, %eax
+	movb %al, -5(%rbp)
+	addl $1, -4(%rbp)
+	cmpl $8, -4(%rbp)
+	jl .L42
+.L43:
+	movl $25, %eax
+	pushq %rax
+	movl $255, %eax
+	pushq %rax
+	movzbl -5(%rbp), %eax
+	pushq %rax
+	cmpw $0, -8(%rbp)
+	jne .L44
+	movl $781, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L45
+.L44:
+	movl $1, %eax
+.L45:
+	pushq %rax
+	movl -60(%rbp), %eax
+	cmpl $2, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $-1, %eax
+	pushq %rax
+	movswl -10(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -96(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %r9
+	movl $201, %eax
+	movq %rax, %r8
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movl %eax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movq $0, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movslq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movzbl -5(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movzwl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movswq -10(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $0, -120(%rbp)
+	je .L46
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L47
+	.p2align 4,,10
+.L48:
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -200(%rbp)
+	jne .L48
+.L49:
+.L46:
+.L47:
+	cmpl $16, -28(%rbp)
+	jge .L51
+	.p2align 4,,10
+.L50:
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L50
+.L51:
+	movl $0, -28(%rbp)
+	movl -144(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movl -140(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movl -136(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movl -132(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movl $4, -28(%rbp)
+	movq -192(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -192(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -192(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movq -192(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq $848, -80(%rbp)
+	movq $154, -72(%rbp)
+	movl $795, -108(%rbp)
+	movl $749, -104(%rbp)
+	movq $8, -64(%rbp)
+	movl $3, -100(%rbp)
+	movl $17, -96(%rbp)
+	movq $10, -56(%rbp)
+	movl $739, %eax
+	testq %rax, %rax
+	jne .L52
+	movl $128, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L53
+.L52:
+	movl $0, %eax
+.L53:
+	movq %rax, %rcx
+	movzbl %dil, %eax
+	addl %ecx, %eax
+	movb %al, -109(%rbp)
+	cmpl $0, -96(%rbp)
+	je .L54
+	movl -96(%rbp), %eax
+	addl $3, %eax
+	movq %rax, %rcx
+	movzbl -109(%rbp), %eax
+	cmpq -56(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jg .L56
+	cmpl $0, -104(%rbp)
+	jne .L60
+	movl $1, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L61
+.L54:
+	movl $8, %eax
+	pushq %rax
+	cmpl $813, -108(%rbp)
+	setae %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpl $0, -104(%rbp)
+	jne .L115
+	xorl %eax, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L116
+.L115:
+	movl $1, %eax
+.L116:
+	pushq %rax
+	movq -80(%rbp), %rax
+	movq %rax, -16(%rbp)
+	pushq %rax
+	movq -72(%rbp), %rax
+	imulq -72(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movq -72(%rbp), %rax
+	movl -100(%rbp), %ecx
+	subq %rcx, %rax
+	movq %rax, %rdx
+	movl $213, %eax
+	movq %rax, %rsi
+	movabsq $913284244456, %rax
+	cmpq $8, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl $4, %eax
+	cmpl $8, %eax
+	jge .L117
+	movl $127, %eax
+	cmpl $10, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jne .L119
+	movl $67, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $8, %eax
+	pushq %rax
+	movl $1294673901, %eax
+	pushq %rax
+	movl $2, %eax
+	movq %rax, %r9
+	movq -80(%rbp), %rax
+	movq %rax, %r8
+	movzbl -109(%rbp), %eax
+	movq %rax, %rcx
+	movl $45, %eax
+	movq %rax, %rdx
+	movl $241, %eax
+	movq %rax, %rsi
+	movq -64(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movq -72(%rbp), %rax
+	movabsq $717188756358, %rcx
+	subq %rcx, %rax
+	movq %rax, %r9
+	movq -72(%rbp), %rax
+	movq %rax, %r8
+	movl $4294967295, %eax
+	movq %rax, %rcx
+	cmpl $0, -108(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movl $217, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl $4, %eax
+	testl %eax, %eax
+	jne .L121
+	cmpl $0, -96(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L122
+.L60:
+	movl $1, %eax
+.L61:
+	movq %rax, %rcx
+	movl $10, %eax
+	subl -108(%rbp), %eax
+	cmpl %ecx, %eax
+	jb .L58
+	movl $5, %eax
+	cmpq $6, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -109(%rbp), %eax
+	addl -104(%rbp), %eax
+	cmpl %ecx, %eax
+	je .LB0
+.L62:
+.L63:
+	jmp .L59
+.L56:
+	movl $3, %eax
+	testb %al, %al
+	je .L85
+	movl $6, %eax
+	pushq %rax
+	movl $826, %eax
+	pushq %rax
+	movl -96(%rbp), %eax
+	movq %rax, %r9
+	movl -108(%rbp), %eax
+	addl $0, %eax
+	movq %rax, %r8
+	movl -104(%rbp), %eax
+	movq %rax, %rcx
+	cmpq $0, -64(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl -100(%rbp), %eax
+	cmpq $5, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	subl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	jmp .L86
+.L85:
+	movq $153, -64(%rbp)
+	movl $4, %eax
+	pushq %rax
+	movl $3, %eax
+	pushq %rax
+	movl $10, %eax
+	movq %rax, %r9
+	movl $164, %eax
+	movq %rax, %r8
+	movl $2, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movq -64(%rbp), %rax
+	movq %rax, %rsi
+	movl $960, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movabsq $960426434415, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -80(%rbp), %rax
+	pushq %rax
+	movl -96(%rbp), %eax
+	pushq %rax
+	movl -104(%rbp), %eax
+	movq %rax, %r9
+	movl $56, %eax
+	movq %rax, %r8
+	movl $87, %eax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -109(%rbp), %eax
+	movq %rax, %rsi
+	movabsq $1007639520978, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movl -96(%rbp), %eax
+	subl $428, %eax
+	pushq %rax
+	movl $7, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	movq %rax, %rdx
+	cmpq $0, -80(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -80(%rbp), %rax
+	leaq 1(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $1, %rcx
+	movq %rcx, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	xorl %eax, %eax
+	subl $5, %eax
+	pushq %rax
+	movl $738, %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	subq -80(%rbp), %rax
+	pushq %rax
+	movl $13, %eax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	cmpq $2, -72(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $7, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movq %rax, %rsi
+	movl -108(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L86:
+	movq $4, -72(%rbp)
+	movq -80(%rbp), %rax
+	movl %eax, -108(%rbp)
+.L57:
+	movq -72(%rbp), %rax
+	movb %al, -16(%rbp)
+	pushq %rax
+	movl $963, %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movl -96(%rbp), %eax
+	movq %rax, %r8
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl $254, %eax
+	movq %rax, %rsi
+	movl $148, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	addl $259, %eax
+	pushq %rax
+	cmpl $0, -96(%rbp)
+	sete %al
+	movzbl %al, %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setb %al
+	movzbl %al, %eax
+	movb %al, -109(%rbp)
+	movzbl -109(%rbp), %eax
+	movl %eax, -8(%rbp)
+	addl -100(%rbp), %eax
+	je .L87
+	movl $2, -104(%rbp)
+	xorl %eax, %eax
+	subl -108(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $16, -104(%rbp)
+	jae .L90
+	.p2align 4,,10
+.L89:
+	movl -8(%rbp), %eax
+	movq %rax, -56(%rbp)
+	movsbl -16(%rbp), %eax
+	pushq %rax
+	movl -100(%rbp), %eax
+	pushq %rax
+	movl -100(%rbp), %eax
+	movq %rax, %r9
+	movl $44, %eax
+	movq %rax, %r8
+	movl $509, %eax
+	movq %rax, %rcx
+	movl $-69, %eax
+	movq %rax, %rdx
+	movl $105, %eax
+	movq %rax, %rsi
+	movl $575, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testl %eax, %eax
+	je .L91
+.L90:
+	movq -64(%rbp), %rax
+	pushq %rax
+	movzbl -109(%rbp), %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	movl $255, %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl -104(%rbp), %eax
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	movq %rax, %rdx
+	movl $235, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	cmpl $10, %eax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $4, %rax
+	je .L96
+	cmpq $5, %rax
+	je .L94
+.L95:
+	jmp .L93
+.L91:
+.L92:
+	movb $153, -109(%rbp)
+	addl $1, -104(%rbp)
+	cmpl $16, -104(%rbp)
+	jb .L89
+	jmp .L90
+.L96:
+	movl -100(%rbp), %eax
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	pushq %rax
+	cmpq $0, -80(%rbp)
+	je .L97
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L98
+.L97:
+	movl $0, %eax
+.L98:
+	pushq %rax
+	movl -96(%rbp), %eax
+	movq %rax, %r8
+	movl -104(%rbp), %eax
+	movq %rax, %rcx
+	movl -104(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -109(%rbp), %eax
+	movq %rax, %rsi
+	movq -56(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.0.constprop.2
+	movq %rax, %r9
+	movl $2147483647, %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movq %rax, %r8
+	movq -56(%rbp), %rax
+	movl -8(%rbp), %ecx
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movabsq $638899757854, %rax
+	subq $6, %rax
+	movq %rax, %rdx
+	movl $75, %eax
+	movq %rax, %rsi
+	movabsq $175347829549, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L93:
+.L112:
+.L88:
+.L135:
+.L136:
+.L55:
+	movl $68, %eax
+	pushq %rax
+	movl $2, %eax
+	subl $580, %eax
+	pushq %rax
+	movl $8, %eax
+	movq %rax, %r9
+	movl -104(%rbp), %eax
+	movq %rax, -8(%rbp)
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %r8
+	xorl %eax, %eax
+	subq -72(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movq %rax, %rcx
+	movl $104, %eax
+	movq %rax, %rdx
+	cmpl $164, -108(%rbp)
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movzbl -109(%rbp), %eax
+	movl %eax, -24(%rbp)
+	cmpl $883, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl %eax, %eax
+	movq %rax, -80(%rbp)
+	cmpq $8, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movl %eax, -100(%rbp)
+	movl $0, -108(%rbp)
+	cmpl $0, -100(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	pushq %rax
+	movl -24(%rbp), %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	popq %rcx
+	subl %ecx, %eax
+	je .L139
+	movq -56(%rbp), %rax
+	movl %eax, -108(%rbp)
+	movl $13, %eax
+	testl %eax, %eax
+	je .L141
+	cmpl $0, -108(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L142
+.L141:
+	movl $0, %eax
+.L142:
+	movq %rax, %rcx
+	movl $922, %eax
+	subl $65536, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl $2, %eax
+	cmpl -24(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.L144:
+.L140:
+	movq -56(%rbp), %rax
+	subq $700, %rax
+	movq %rax, %rcx
+	movl $3, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	addl %eax, -100(%rbp)
+	movl $9, %eax
+	pushq %rax
+	movl $8, %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movl $8, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl $64, %eax
+	movq %rax, %rsi
+	movl $272, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	addl %eax, -108(%rbp)
+	subq $8, %rsp
+	movq -56(%rbp), %rax
+	pushq %rax
+	movl -104(%rbp), %eax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movl -100(%rbp), %eax
+	movq %rax, %rcx
+	movl $110, %eax
+	movq %rax, %rdx
+	movl $238, %eax
+	movq %rax, %rsi
+	movabsq $775615928123, %rax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	addl %ecx, %eax
+	cmpl %eax, -108(%rbp)
+	seta %al
+	movzbl %al, %eax
+.f1_return:
+	leave
+	ret
+.L139:
+	cmpl $0, -104(%rbp)
+	jne .L145
+	cmpq $0, -64(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	subl %ecx, %eax
+	je .L143
+.L145:
+	cmpq $0, -80(%rbp)
+	jne .L146
+	cmpq $0, -56(%rbp)
+	jne .L146
+	movl $7, %eax
+	subl -96(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -109(%rbp), %eax
+	movswl %ax, %eax
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -80(%rbp)
+	subq $8, %rsp
+	movl -96(%rbp), %eax
+	pushq %rax
+	movl $2, %eax
+	testl %eax, %eax
+	jne .L148
+	cmpq $0, -72(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L149
+.L146:
+	movl $8, %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	pushq %rax
+	movl $14, %eax
+	movq %rax, %r9
+	movl $147, %eax
+	movq %rax, %r8
+	movl $445, %eax
+	movq %rax, %rcx
+	movl $-1, %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl -100(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	subq $8, %rsp
+	movq -64(%rbp), %rax
+	pushq %rax
+	movl $9, %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	movq %rax, %r9
+	movzbl -109(%rbp), %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movq -80(%rbp), %rax
+	movq %rax, %rsi
+	movq -8(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl $317, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $65536, %eax
+	subl $318, %eax
+	pushq %rax
+	movabsq $1008889722658, %rax
+	cmpq -72(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movl $127, %eax
+	pushq %rax
+	movl $4, %eax
+	pushq %rax
+	xorl %eax, %eax
+	movq %rax, %r9
+	movzbl -109(%rbp), %eax
+	movq %rax, %r8
+	movl $528, %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	movq %rax, %rdx
+	movl $30, %eax
+	movq %rax, %rsi
+	movzbl -109(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rsi
+	movl $110, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L147:
+	cmpl $256, -96(%rbp)
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl -96(%rbp), %eax
+	addl $978, %eax
+	pushq %rax
+	movl $6, %eax
+	testl %eax, %eax
+	je .L152
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L153
+.L152:
+	movl $0, %eax
+.L153:
+	pushq %rax
+	movl $162, %eax
+	pushq %rax
+	movl -96(%rbp), %eax
+	movl %eax, -8(%rbp)
+	addl -104(%rbp), %eax
+	pushq %rax
+	movl -104(%rbp), %eax
+	pushq %rax
+	movl $4, %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movq -80(%rbp), %rax
+	movb %al, -24(%rbp)
+	movq %rax, %r8
+	movl -104(%rbp), %eax
+	movq %rax, %rcx
+	movq -80(%rbp), %rax
+	movb %al, -16(%rbp)
+	movq %rax, %rdx
+	movl -104(%rbp), %eax
+	movq %rax, %rsi
+	movslq -96(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	subq $8, %rsp
+	movl $48, %eax
+	pushq %rax
+	movl $128, %eax
+	pushq %rax
+	movl $139, %eax
+	movq %rax, %r9
+	movl $227, %eax
+	movq %rax, %r8
+	movl -8(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -16(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -24(%rbp), %eax
+	movq %rax, %rsi
+	movq -64(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movl %eax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L144
+.L121:
+	movl $1, %eax
+.L122:
+	movq %rax, %rcx
+	movl $2, %eax
+	addl $7, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	addl %eax, -104(%rbp)
+.L119:
+.L120:
+.L132:
+.L118:
+	cmpq $0, -56(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L135
+	cmpl $0, -96(%rbp)
+	jne .L137
+	movl $1, %eax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L138
+.L117:
+	movl $1, %eax
+	testl %eax, %eax
+	je .L123
+	subq $8, %rsp
+	xorl %eax, %eax
+	subl $7, %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	shrq $10, %rax
+	movq %rax, %r9
+	xorl %eax, %eax
+	subl $4, %eax
+	movq %rax, %r8
+	movq -56(%rbp), %rax
+	movq %rax, %rcx
+	movl $745, %eax
+	imull $804, %eax, %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movl $255, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $16, %rsp
+	subq $8, %rsp
+	movl $24, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl $309, %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -96(%rbp), %rax
+	cqo
+	idivq %rcx
+	pushq %rax
+	cmpl $0, -108(%rbp)
+	je .L125
+	movl $377, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L126
+.L87:
+	movq $4, -56(%rbp)
+	movabsq $688701337281, %rax
+	testq %rax, %rax
+	je .L105
+	cmpq $0, -56(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L106
+.L105:
+	movl $0, %eax
+.L106:
+	addl $7, %eax
+	movslq %eax, %rax
+	leaq -4(%rax), %rcx
+	cmpq $4, %rcx
+	ja .L107
+	leaq .L108(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L104
+	# table target .L101
+	# table target .L100
+	# table target .L103
+	# table target .L102
+	jmp *%rcx
+.L94:
+	movl -8(%rbp), %eax
+	cmpl -108(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -72(%rbp), %rax
+	pushq %rax
+	xorl %eax, %eax
+	subl $818, %eax
+	movq %rax, %r9
+	movl -96(%rbp), %eax
+	movq %rax, %r8
+	movl -96(%rbp), %eax
+	imull -96(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movl $680, %eax
+	subq -64(%rbp), %rax
+	movq %rax, %rdx
+	movl $9, %eax
+	cmpl $976, %eax
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -80(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl %eax, %eax
+	movq %rax, -72(%rbp)
+	movl -96(%rbp), %eax
+	movl %eax, -96(%rbp)
+	jmp .L93
+.L143:
+	movq -80(%rbp), %rax
+	imulq -80(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $5, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movl -96(%rbp), %eax
+	pushq %rax
+	movl $3, %eax
+	cmpl $1, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $8, %eax
+	pushq %rax
+	movzbl -109(%rbp), %eax
+	pushq %rax
+	movl $128, %eax
+	cmpl $788, %eax
+	setb %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $-18, %eax
+	pushq %rax
+	movzbl -109(%rbp), %eax
+	subl -100(%rbp), %eax
+	pushq %rax
+	movl $428, %eax
+	testl %eax, %eax
+	je .L154
+	cmpl $0, -100(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L155
+.L154:
+	movl $0, %eax
+.L155:
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl -100(%rbp), %eax
+	jmp .L144
+.L58:
+	movq -56(%rbp), %rax
+	pushq %rax
+	movl $3, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $732, %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	pushq %rax
+	subq $8, %rsp
+	movzbl -109(%rbp), %eax
+	pushq %rax
+	movl -96(%rbp), %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	movl $228, %eax
+	movq %rax, %r9
+	movl $50, %eax
+	movq %rax, %r8
+	movl -104(%rbp), %eax
+	movq %rax, %rcx
+	movl $-67, %eax
+	movq %rax, %rdx
+	movzbl -109(%rbp), %eax
+	movq %rax, %rsi
+	movl -104(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movl -8(%rbp), %eax
+	pushq %rax
+	movl $-1, %eax
+	pushq %rax
+	movl $3, %eax
+	pushq %rax
+	movl $9, %eax
+	pushq %rax
+	movl $179, %eax
+	movq %rax, %r9
+	movl $7, %eax
+	movq %rax, %r8
+	movl $65536, %eax
+	movq %rax, %rcx
+	movl $108, %eax
+	movq %rax, %rdx
+	movl $231, %eax
+	movq %rax, %rsi
+	movq -72(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	subq $8, %rsp
+	movl -108(%rbp), %eax
+	pushq %rax
+	movl -104(%rbp), %eax
+	pushq %rax
+	movzbl -109(%rbp), %eax
+	movq %rax, %r9
+	movl -100(%rbp), %eax
+	movq %rax, %r8
+	movl $850, %eax
+	movq %rax, %rcx
+	movl $122, %eax
+	movq %rax, %rdx
+	movq -80(%rbp), %rax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movl %eax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movq -72(%rbp), %rax
+	imulq -72(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	xorl %edx, %edx
+	divq %rcx
+	movl %eax, -108(%rbp)
+	movl $-12, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $1, %eax
+	pushq %rax
+	movl $4096907180, %eax
+	pushq %rax
+	movl $198, %eax
+	movq %rax, %r9
+	movl $212, %eax
+	movq %rax, %r8
+	movl $163, %eax
+	movq %rax, %rcx
+	movl $-84, %eax
+	movq %rax, %rdx
+	movl $47, %eax
+	movq %rax, %rsi
+	movq -72(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movq -72(%rbp), %rax
+	pushq %rax
+	movl -108(%rbp), %eax
+	pushq %rax
+	movl -96(%rbp), %eax
+	imull -96(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -96(%rbp), %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	cmpq $0, -56(%rbp)
+	je .L64
+	cmpq $0, -72(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L65
+.L64:
+	movl $0, %eax
+.L65:
+	movq %rax, %rdx
+	movl $146, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -56(%rbp), %rax
+	addq -80(%rbp), %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L59:
+	movl $359, -96(%rbp)
+	movq -56(%rbp), %rax
+	movb %al, -16(%rbp)
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $59, %rax
+	jge .L76
+	cmpq $13, %rax
+	jge .L77
+	cmpq $-1, %rax
+	je .L57
+	cmpq $7, %rax
+	je .L71
+.L69:
+	movl $2, %eax
+	cmpl $2, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	pushq %rax
+	movl $3, %eax
+	testl %eax, %eax
+	je .L79
+	cmpb $0, -109(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L80
+.L125:
+	movl $0, %eax
+.L126:
+	pushq %rax
+	movq -56(%rbp), %rax
+	pushq %rax
+	movl -108(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -64(%rbp), %rax
+	movb %al, -8(%rbp)
+	pushq %rax
+	movl $189, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %r9
+	movq -80(%rbp), %rax
+	movb %al, -16(%rbp)
+	movq %rax, %r8
+	movl -96(%rbp), %eax
+	movq %rax, %rcx
+	movsbl -8(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -16(%rbp), %eax
+	movq %rax, %rsi
+	movl -108(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movl %eax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.0
+	addq $16, %rsp
+	jmp .L124
+.L123:
+	movl $8, %eax
+	pushq %rax
+	movl $6, %eax
+	xorl %edx, %edx
+	divq -8(%rbp)
+	pushq %rax
+	movq -72(%rbp), %rax
+	pushq %rax
+	movl $2, %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	movq %rax, %r9
+	movl $10, %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl $30, %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movl -108(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movl $256, %eax
+	subl $6, %eax
+	pushq %rax
+	movq -80(%rbp), %rax
+	pushq %rax
+	movl -96(%rbp), %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	movq %rax, %r9
+	movl -104(%rbp), %eax
+	movq %rax, %r8
+	movq -64(%rbp), %rax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	movq %rax, %rdx
+	movl $103, %eax
+	movq %rax, %rsi
+	movslq -96(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	movzbl -109(%rbp), %eax
+	pushq %rax
+	cmpq $0, -72(%rbp)
+	jne .L127
+	cmpq $0, -64(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L128
+.L127:
+	movl $1, %eax
+.L128:
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L124:
+	movl $0, -96(%rbp)
+	movl $1, %eax
+	testl %eax, %eax
+	jne .L129
+	cmpb $0, -109(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L130
+.L129:
+	movl $1, %eax
+.L130:
+	movl %eax, -92(%rbp)
+	movq -80(%rbp), %rax
+	imulq -80(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -48(%rbp)
+	movzbl -109(%rbp), %eax
+	movq %rax, -32(%rbp)
+	movq %rax, %rcx
+	movq -72(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, -40(%rbp)
+	movl $10, %eax
+	imull $2147483647, %eax, %eax
+	movl %eax, -88(%rbp)
+	xorl %eax, %eax
+	subl $852, %eax
+	movl %eax, -84(%rbp)
+	movabsq $265201295000, %rax
+	addq $9, %rax
+	movq %rax, -24(%rbp)
+	cmpl $5, -96(%rbp)
+	jge .L132
+	.p2align 4,,10
+.L131:
+	movl -100(%rbp), %eax
+	movb %al, -16(%rbp)
+	pushq %rax
+	subq $8, %rsp
+	movl $11, %eax
+	pushq %rax
+	movl $472, %eax
+	pushq %rax
+	movl $3, %eax
+	movq %rax, %r9
+	movl $55, %eax
+	movq %rax, %r8
+	movl $3340575706, %eax
+	movq %rax, %rcx
+	movl $-97, %eax
+	movq %rax, %rdx
+	movl -100(%rbp), %eax
+	movb %al, -8(%rbp)
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movq -40(%rbp), %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	cqo
+	idivq -48(%rbp)
+	pushq %rax
+	movl -92(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movsbl -16(%rbp), %eax
+	pushq %rax
+	movl $511, %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	movq %rax, %r9
+	movl $252, %eax
+	movq %rax, %r8
+	movl $272, %eax
+	movq %rax, %rcx
+	movq -80(%rbp), %rax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movq -32(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdx
+	movl $125, %eax
+	movq %rax, %rsi
+	movq -56(%rbp), %rax
+	subq $7, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl %eax, %eax
+	movq %rax, -56(%rbp)
+	xorl %eax, %eax
+	subl -96(%rbp), %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	jne .LB1
+.L133:
+.L134:
+	movl $-25, %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	pushq %rax
+	movl -84(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -96(%rbp), %eax
+	pushq %rax
+	movl $573, %eax
+	pushq %rax
+	movl $165, %eax
+	movq %rax, %r9
+	movzbl -8(%rbp), %eax
+	movq %rax, %r8
+	movl $970, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -108(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdx
+	movl -88(%rbp), %eax
+	movq %rax, %rsi
+	movl $422, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	addl $1, -96(%rbp)
+	cmpl $5, -96(%rbp)
+	jl .L131
+	jmp .L132
+.L148:
+	movl $1, %eax
+.L149:
+	pushq %rax
+	cmpl $333, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpb $0, -109(%rbp)
+	jne .L150
+	movl $611, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L151
+.L150:
+	movl $1, %eax
+.L151:
+	pushq %rax
+	movl $2, %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movq %rax, %rdx
+	movl -100(%rbp), %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.1
+	addq $16, %rsp
+	jmp .L147
+.L107:
+.L104:
+	movl $53, %eax
+	pushq %rax
+	movl $404018833, %eax
+	pushq %rax
+	movl $255, %eax
+	pushq %rax
+	movl $10, %eax
+	pushq %rax
+	movl -100(%rbp), %eax
+	addl $6, %eax
+	pushq %rax
+	movl $19, %eax
+	pushq %rax
+	movslq -96(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rsi
+	movl -108(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L99:
+	movl $4, %eax
+	testl %eax, %eax
+	je .L111
+	subq $8, %rsp
+	movl $-35, %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	movq %rax, %r9
+	movl $240, %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movsbl -16(%rbp), %eax
+	movq %rax, %rdx
+	movl -100(%rbp), %eax
+	movq %rax, %rsi
+	movabsq $537517147884, %rax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $16, %rsp
+	pushq %rax
+	movl -96(%rbp), %eax
+	pushq %rax
+	movl $268, %eax
+	imull $363, %eax, %eax
+	movq %rax, %r9
+	movq -64(%rbp), %rax
+	movq %rax, %r8
+	movl $232, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	movq %rax, %rsi
+	movslq -96(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movl $9, %eax
+	pushq %rax
+	movq -72(%rbp), %rax
+	movl $3, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movl $1, %eax
+	subl $6, %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	pushq %rax
+	movl $3, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -108(%rbp), %eax
+	pushq %rax
+	movl $10, %eax
+	pushq %rax
+	movl $9, %eax
+	movq %rax, %r9
+	movl $191, %eax
+	movq %rax, %r8
+	movl $255, %eax
+	movq %rax, %rcx
+	movl $-1, %eax
+	movq %rax, %rdx
+	movl $255, %eax
+	movq %rax, %rsi
+	movl $575, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movq %rax, %rdx
+	xorl %eax, %eax
+	subl $7, %eax
+	movq %rax, %rsi
+	cmpq $5, -80(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L112
+.L111:
+	xorl %eax, %eax
+	imull $2147483647, -104(%rbp), %ecx
+	subl %ecx, %eax
+	jne .LB2
+.L113:
+.L114:
+	addq $502, -72(%rbp)
+	jmp .L112
+.L76:
+	cmpq $570, %rax
+	jge .L78
+	cmpq $59, %rax
+	je .L73
+	cmpq $129, %rax
+	je .L75
+	jmp .L69
+.L77:
+	cmpq $13, %rax
+	je .L72
+	cmpq $32, %rax
+	je .L57
+	jmp .L69
+.L78:
+	cmpq $570, %rax
+	je .L74
+	cmpq $933, %rax
+	je .L67
+	jmp .L69
+.L79:
+	movl $0, %eax
+.L80:
+	pushq %rax
+	movq -64(%rbp), %rax
+	pushq %rax
+	movl -100(%rbp), %eax
+	pushq %rax
+	movl $-102, %eax
+	pushq %rax
+	movl $141, %eax
+	pushq %rax
+	cmpq $0, -56(%rbp)
+	jne .L81
+	cmpq $0, -64(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L82
+.L81:
+	movl $1, %eax
+.L82:
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl %eax, -96(%rbp)
+	movl -96(%rbp), %eax
+	addl $1000000007, %eax
+	pushq %rax
+	movl $7, %eax
+	testl %eax, %eax
+	jne .L83
+	movl $2, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L84
+.L83:
+	movl $1, %eax
+.L84:
+	pushq %rax
+	movq -80(%rbp), %rax
+	movq %rax, %r9
+	movq -80(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %r8
+	movl -100(%rbp), %eax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl $3, %eax
+	movq %rax, %rsi
+	movabsq $486596167652, %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L66:
+	jmp .L57
+.L74:
+	movq -72(%rbp), %rax
+	pushq %rax
+	movabsq $809454161510, %rax
+	subq $1000000007, %rax
+	pushq %rax
+	xorl %eax, %eax
+	pushq %rax
+	cmpq $611, -72(%rbp)
+	seta %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	cmpl $516, -108(%rbp)
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movzbl -16(%rbp), %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -56(%rbp), %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	pushq %rax
+	movq -64(%rbp), %rax
+	movb %al, -8(%rbp)
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movl -100(%rbp), %eax
+	movq %rax, %rcx
+	movl $-1, %eax
+	movq %rax, %rdx
+	movzbl -16(%rbp), %eax
+	movq %rax, %rsi
+	movl $158, %eax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movl %eax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	subq $8, %rsp
+	cmpl $7, -100(%rbp)
+	setb %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $562, %eax
+	subl $1, %eax
+	movq %rax, %r9
+	movl $188, %eax
+	movq %rax, %r8
+	movl -108(%rbp), %eax
+	imull -104(%rbp), %eax
+	movq %rax, %rcx
+	movl -104(%rbp), %eax
+	movq %rax, %rdx
+	movzbl -8(%rbp), %eax
+	movq %rax, %rsi
+	movq -72(%rbp), %rax
+	shrq $10, %rax
+	movq %rax, %rdi
+	call f0.constprop.1
+	addq $16, %rsp
+.L75:
+	movl $1000000007, -96(%rbp)
+	jmp .L57
+.L68:
+	jmp .L57
+.L72:
+	movq -72(%rbp), %rax
+	movb %al, -16(%rbp)
+	pushq %rax
+	movl -104(%rbp), %eax
+	pushq %rax
+	movl $53, %eax
+	pushq %rax
+	movl -104(%rbp), %eax
+	cmpq -72(%rbp), %rax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movzbl -109(%rbp), %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	cmpl -100(%rbp), %eax
+	setbe %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $5, %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	movl $52, %eax
+	movq %rax, %r9
+	movl $217, %eax
+	movq %rax, %r8
+	movl $446, %eax
+	movq %rax, %rcx
+	movsbl -16(%rbp), %eax
+	movq %rax, %rdx
+	movl $212, %eax
+	movq %rax, %rsi
+	movslq -96(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	movl %eax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl %eax, %eax
+	movq %rax, -72(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -100(%rbp)
+	jmp .L57
+.L73:
+	movq -56(%rbp), %rax
+	pushq %rax
+	movl $497, %eax
+	pushq %rax
+	movq -56(%rbp), %rax
+	cmpq $256, %rax
+	setae %al
+	movzbl %al, %eax
+	movq %rax, %r9
+	movl $6, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movzbl -109(%rbp), %eax
+	movq %rax, %rdx
+	cmpl $921, -96(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	jmp .L57
+.L67:
+	movl -104(%rbp), %eax
+	pushq %rax
+	movl $2, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -80(%rbp), %rax
+	addq -56(%rbp), %rax
+	pushq %rax
+	movl -100(%rbp), %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	imulq -56(%rbp), %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	movq %rax, %rdx
+	cmpl $0, -108(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movl $996, %eax
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L57
+.L70:
+	jmp .L57
+.L71:
+	movl $-33, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $-90, %eax
+	pushq %rax
+	movl $997, %eax
+	pushq %rax
+	movl -100(%rbp), %eax
+	movq %rax, %r9
+	movl $4, %eax
+	movq %rax, %r8
+	movq -72(%rbp), %rax
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	movq %rax, %rdx
+	movq -80(%rbp), %rax
+	movq %rax, %rsi
+	movslq -96(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $24, %rsp
+	pushq %rax
+	movabsq $281284909955, %rax
+	cmpq -80(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movq -80(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	pushq %rax
+	movq -72(%rbp), %rax
+	pushq %rax
+	movzbl -109(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rsi
+	movl -100(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	cmpl $149, -100(%rbp)
+	setne %al
+	movzbl %al, %eax
+	testl %eax, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movl -108(%rbp), %ecx
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	jmp .L57
+.L100:
+	jmp .L99
+.L101:
+	jmp .L99
+.L102:
+	movl $65535, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $1528594344, %eax
+	pushq %rax
+	xorl %eax, %eax
+	subl $9, %eax
+	pushq %rax
+	movl $255, %eax
+	pushq %rax
+	cmpl $3, -96(%rbp)
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $127, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $823, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L99
+.L103:
+	movl $421, %eax
+	testl %eax, %eax
+	jne .L109
+	movl -100(%rbp), %eax
+	cmpq -56(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	jmp .L110
+.L109:
+	movl $1, %eax
+.L110:
+	movq %rax, %rcx
+	movl $393, %eax
+	subl -108(%rbp), %eax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	movl %edx, %eax
+	cmpl %ecx, %eax
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, -104(%rbp)
+	jmp .L99
+.LB1:
+	movq -80(%rbp), %rax
+	jmp .f1_return
+.L137:
+	movl $1, %eax
+.L138:
+	cmpq $1, -56(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .f1_return
+.LB0:
+	movl $2, %eax
+	jmp .f1_return
+.LB2:
+	movl $482, %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L108:
+	.long .L101-.L108
+	.long .L100-.L108
+	.long .L103-.L108
+	.long .L104-.L108
+	.long .L102-.L108
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,98 @@
+int g0;
+int ga0[16];
+unsigned char f0(int p0, unsigned int p1, unsigned char p2) {
+    unsigned short v0 = 6;
+    unsigned short v1 = 3;
+    unsigned char v2 = 1;
+    unsigned long v3 = 212105881376ul;
+    short v4 = 697855359628;
+    int i0 = 87;
+    long j0 = 667;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 1; }
+    i0 = ((i0 > 3) > (v1 && (278 <= p2)));
+    v3 = 0;
+    while (v3 < 33) {
+        p0 = p0 + ((ga0[6] * p1) >= (g0 > 1000000007));
+        p1 = p1 + (v4 / (v2 * v2 + 1));
+        for (i0 = 0; i0 < 8; i0 = i0 + 1) {
+            if (v0 >= 0 && v0 < 33) { la0[v0] = !(j0); }
+        }
+        v3 = v3 + 1;
+    }
+    v2 = (char)(((la0[8] + la0[11]) * 2));
+    v4 = 99u;
+    if ((unsigned long)(la0[25])) { return (3ul < -(717)); }
+    for (v3 = 0; v3 < 5; v3 = v3 + 1) {
+        if (v0 >= 0 && v0 < 33) { la0[v0] = (i0 <= (v3 && 306215905207)); }
+        v4 = (!(0) + i0);
+        v4 = ga0[8];
+    }
+    switch ((p1 + v2)) {
+    case -3:
+        break;
+    case 29:
+        switch ((i0 || (v1 + v1))) {
+        default:
+            switch (ga0[7]) {
+            case 0:
+            default:
+                if ((p0 || v2)) { return la0[21]; }
+                if ((unsigned int)((j0 > g0))) { return ((457L / (v3 * v3 + 1)) / 2); }
+            }
+            v1 = ((415 <= (586 || 6)) > (la0[27] - v0));
+            break;
+        case 0:
+            v4 = (unsigned char)(((la0[13] / (p0 * p0 + 1)) <= (812 * 740296314733u)));
+            break;
+        case 9:
+            break;
+        }
+    case 38:
+        if (v2 >= 0 && v2 < 33) { la0[v2] = ((p0 / 13ul) / (p0 * p0 + 1)); }
+    }
+    return p2;
+}
+int f1(short p0, unsigned char p1, unsigned long p2, unsigned char p3, unsigned char p4, unsigned short p5, short p6, char p7) {
+    short v0 = 10;
+    unsigned long v1 = 20;
+    int i0 = 912;
+    long j0 = 230;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 200; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 2; }
+    v1 = v0;
+    p4 = p4 + !(v1);
+    p7 = ((118U - (p6 && 4)) <= ((p0 - p1) + (unsigned long)(p0)));
+    p0 = p0 + ((i0 - j0) < (i0 == 126));
+    f0(!(10), (p2 * i0), (int)(p7));
+    f0((v1 - p1), (p7 - p2), (p1 <= p5));
+    return (4 > 6);
+}
+int main() {
+    long v0 = 801613608847;
+    unsigned long v1 = 267;
+    unsigned short v2 = 6;
+    unsigned short v3 = 427U;
+    short v4 = 1009275642621;
+    int i0 = 9;
+    long j0 = 9;
+    if (v3 >= 0 && v3 < 16) { ga0[v3] = f0(256, v4, ga0[8]); }
+    v0 = ((short)(j0) != v2);
+    j0 = j0 + (unsigned long)(v2);
+    if (v0) { return v4; }
+    g0 = (9 + (unsigned char)((v0 || v4)));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,724 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 4
+	.p2align 2
+g0:
+	.zero 4
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.section .text
+	.global main
+	.type main, @function
+	.type f0, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movabsq $801613608847, %rax
+	movq $267, -32(%rbp)
+	movw $6, -42(%rbp)
+	movw $427, -40(%rbp)
+	movw $8957, -38(%rbp)
+	movl $9, -36(%rbp)
+	movq $9, -24(%rbp)
+	movzwl -40(%rbp), %eax
+	movl %eax, -8(%rbp)
+	testl %eax, %eax
+	jl .L0
+	cmpl $16, -8(%rbp)
+	jge .L0
+	movl ga0+32(%rip), %eax
+	movq %rax, %rdx
+	movswl -38(%rbp), %eax
+	movq %rax, %rsi
+	movl $256, %eax
+	movq %rax, %rdi
+	call f0
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -40(%rbp), %eax
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L0:
+.L1:
+	movq -24(%rbp), %rax
+	movswl %ax, %eax
+	movzwl -42(%rbp), %ecx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -8(%rbp)
+	movq -24(%rbp), %rax
+	movzwl -42(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -24(%rbp)
+	cmpq $0, -8(%rbp)
+	jne .LB0
+.L2:
+.L3:
+	cmpq $0, -8(%rbp)
+	jne .L4
+	cmpw $0, -38(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L5
+.L4:
+	movl $1, %eax
+.L5:
+	movzbl %al, %eax
+	addl $9, %eax
+	movl %eax, g0(%rip)
+	movq $0, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -8(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzwl -42(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movzwl -40(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movswq -38(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	movslq -36(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	imulq $31, -16(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jge .L6
+	movl $16, %eax
+	movslq -36(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	subq $1, -8(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $16, -36(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movslq -36(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -16(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $16, -36(%rbp)
+	jl .L10
+.L11:
+	movq -16(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -16(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+.main_return:
+	leave
+	ret
+.LB0:
+	movswl -38(%rbp), %eax
+	jmp .main_return
+	.size main, .-main
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $240, %rsp
+	movl %edi, -4(%rbp)
+	movl %esi, -8(%rbp)
+	movb %dl, -9(%rbp)
+	movw $6, -12(%rbp)
+	movw $3, -14(%rbp)
+	movb $1, -15(%rbp)
+	movabsq $212105881376, %rax
+	movq %rax, -24(%rbp)
+	movw $-17780, -26(%rbp)
+	movl $87, -32(%rbp)
+	movq $667, -40(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L12
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L15
+	.p2align 4,,10
+.L14:
+	movl -32(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -184(%rbp)
+	jne .L14
+.L15:
+.L12:
+.L13:
+	cmpl $33, -32(%rbp)
+	jge .L17
+	.p2align 4,,10
+.L16:
+	movl -32(%rbp), %eax
+	leal (,%rax,1), %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L16
+.L17:
+	cmpw $0, -14(%rbp)
+	je .L18
+	movzbl -9(%rbp), %eax
+	cmpl $278, %eax
+	setge %al
+	movzbl %al, %eax
+	jmp .L19
+.L18:
+	movl $0, %eax
+.L19:
+	movq %rax, %rcx
+	cmpl $3, -32(%rbp)
+	setg %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -32(%rbp)
+	movq $0, -24(%rbp)
+	movzbl -15(%rbp), %eax
+	movl %eax, -192(%rbp)
+	imull -192(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -188(%rbp)
+	movzwl -12(%rbp), %eax
+	movl %eax, -204(%rbp)
+	testl %eax, %eax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -200(%rbp)
+	testl %eax, %eax
+	je .L20
+	cmpl $33, -204(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L21
+.L20:
+	movl $0, %eax
+.L21:
+	movl %eax, -196(%rbp)
+	cmpq $33, -24(%rbp)
+	jae .L23
+	.p2align 4,,10
+.L22:
+	cmpl $1000000007, g0(%rip)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	imull -8(%rbp), %eax
+	cmpl %ecx, %eax
+	setae %al
+	movzbl %al, %eax
+	addl %eax, -4(%rbp)
+	movswl -26(%rbp), %eax
+	cltd
+	idivl -188(%rbp)
+	addl %eax, -8(%rbp)
+	movl $0, -32(%rbp)
+	movl -196(%rbp), %eax
+	movl %eax, -208(%rbp)
+	cmpl $8, -32(%rbp)
+	jge .L24
+	movl $8, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -216(%rbp)
+	cmpq $0, -216(%rbp)
+	je .L27
+	.p2align 4,,10
+.L26:
+	cmpl $0, -208(%rbp)
+	je .L28
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L28:
+.L29:
+	addl $1, -32(%rbp)
+	cmpl $0, -208(%rbp)
+	je .L30
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L30:
+.L31:
+	addl $1, -32(%rbp)
+	cmpl $0, -208(%rbp)
+	je .L32
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L32:
+.L33:
+	addl $1, -32(%rbp)
+	cmpl $0, -208(%rbp)
+	je .L34
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L34:
+.L35:
+	addl $1, -32(%rbp)
+	subq $1, -216(%rbp)
+	jne .L26
+.L27:
+.L24:
+.L25:
+	cmpl $8, -32(%rbp)
+	jge .L37
+	.p2align 4,,10
+.L36:
+	cmpl $0, -208(%rbp)
+	je .L38
+	cmpq $0, -40(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L38:
+.L39:
+	addl $1, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jl .L36
+.L37:
+	addq $1, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jb .L22
+.L23:
+	movl -144(%rbp), %eax
+	movl -132(%rbp), %ecx
+	addl %ecx, %eax
+	sall $1, %eax
+	movb %al, -15(%rbp)
+	movw $99, -26(%rbp)
+	movl -76(%rbp), %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	jne .LB1
+.L40:
+.L41:
+	movq $0, -24(%rbp)
+	cmpl $0, -200(%rbp)
+	je .L42
+	cmpl $33, -204(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L43
+.L42:
+	movl $0, %eax
+.L43:
+	movl %eax, -220(%rbp)
+	cmpq $5, -24(%rbp)
+	jae .L44
+	movl $5, %eax
+	subq -24(%rbp), %rax
+	shrq $1, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L47
+	.p2align 4,,10
+.L46:
+	cmpl $0, -220(%rbp)
+	je .L48
+	cmpq $0, -24(%rbp)
+	je .L50
+	movabsq $306215905207, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L51
+.L50:
+	movl $0, %eax
+.L51:
+	cmpl %eax, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L48:
+.L49:
+	xorl %eax, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl -32(%rbp), %eax
+	movw %ax, -26(%rbp)
+	movl ga0+32(%rip), %eax
+	movw %ax, -26(%rbp)
+	addq $1, -24(%rbp)
+	cmpl $0, -220(%rbp)
+	je .L52
+	cmpq $0, -24(%rbp)
+	je .L54
+	movabsq $306215905207, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L55
+.L54:
+	movl $0, %eax
+.L55:
+	cmpl %eax, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L52:
+.L53:
+	xorl %eax, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl -32(%rbp), %eax
+	movw %ax, -26(%rbp)
+	movl ga0+32(%rip), %eax
+	movw %ax, -26(%rbp)
+	addq $1, -24(%rbp)
+	subq $1, -232(%rbp)
+	jne .L46
+.L47:
+.L44:
+.L45:
+	cmpq $5, -24(%rbp)
+	jae .L57
+	.p2align 4,,10
+.L56:
+	cmpl $0, -220(%rbp)
+	je .L58
+	cmpq $0, -24(%rbp)
+	je .L60
+	movabsq $306215905207, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L61
+.L60:
+	movl $0, %eax
+.L61:
+	cmpl %eax, -32(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -12(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+.L58:
+.L59:
+	xorl %eax, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	addl -32(%rbp), %eax
+	movw %ax, -26(%rbp)
+	movl ga0+32(%rip), %eax
+	movw %ax, -26(%rbp)
+	addq $1, -24(%rbp)
+	cmpq $5, -24(%rbp)
+	jb .L56
+.L57:
+	movzbl -15(%rbp), %eax
+	addl -8(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $-3, %rax
+	je .L63
+	cmpq $29, %rax
+	je .L64
+	cmpq $38, %rax
+	je .L65
+.L63:
+.L81:
+.L82:
+.L62:
+	movzbl -9(%rbp), %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L64:
+	cmpl $0, -32(%rbp)
+	jne .L70
+	movzwl -14(%rbp), %eax
+	movl %eax, -236(%rbp)
+	addl -236(%rbp), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L71
+.L70:
+	movl $1, %eax
+.L71:
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L68
+	cmpq $9, %rax
+	je .L66
+.L67:
+	movl ga0+28(%rip), %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+.L73:
+	cmpl $0, -4(%rbp)
+	jne .L76
+	cmpb $0, -15(%rbp)
+	jne .L76
+.L74:
+.L75:
+	movslq g0(%rip), %rax
+	cmpq %rax, -40(%rbp)
+	setg %al
+	movzbl %al, %eax
+	jg .LB2
+.L77:
+.L78:
+.L72:
+	movl -68(%rbp), %eax
+	subl -204(%rbp), %eax
+	pushq %rax
+	movl $586, %eax
+	testl %eax, %eax
+	jne .L79
+	movl $6, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L80
+.L68:
+	movabsq $740296314733, %rax
+	imulq $812, %rax, %rax
+	pushq %rax
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -124(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	popq %rcx
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movzbl %al, %eax
+	movw %ax, -26(%rbp)
+.L66:
+.L65:
+	movzbl -15(%rbp), %eax
+	movl %eax, -240(%rbp)
+	testl %eax, %eax
+	jl .L81
+	cmpl $33, -240(%rbp)
+	jge .L81
+	movl -4(%rbp), %eax
+	imull -4(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movslq -4(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movzbl -15(%rbp), %eax
+	movl %ecx, -176(%rbp,%rax,4)
+	jmp .L82
+.L69:
+	jmp .L66
+.L79:
+	movl $1, %eax
+.L80:
+	cmpl $415, %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movw %ax, -14(%rbp)
+	jmp .L66
+.LB1:
+	xorl %eax, %eax
+	subl $717, %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	seta %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L76:
+	movl -92(%rbp), %eax
+	jmp .f0_return
+.LB2:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $457, %eax
+	xorl %edx, %edx
+	divq %rcx
+	shrq $1, %rax
+	jmp .f0_return
+	.size f0, .-f0
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
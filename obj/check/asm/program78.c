@@ -0,0 +1,213 @@
+unsigned long g0;
+char g1;
+unsigned short f0(unsigned char p0, short p1) {
+    long v0 = 297672601274U;
+    unsigned char v1 = 992;
+    int i0 = 5;
+    long j0 = 3;
+    int la0[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 4; }
+    i0 = ((j0 / 13ul) || (278l && 1));
+    p0 = ((la0[0] && g0) / 2);
+    if (v0) {
+        la1[32] = (-(g1) + (720 && 516596198331));
+        if (j0) {
+            if (8) {
+                if (310) { return (p0 < (j0 + 3)); }
+                if ((2147483647 > 5L)) { return (la0[2] / (p1 * p1 + 1)); }
+            }
+        }
+        p0 = (v0 >= v0);
+    } else {
+        p1 = (7 * ((1 - 5) * (g1 / (v1 * v1 + 1))));
+    }
+    if (2) { return (char)((g0 / (i0 * i0 + 1))); }
+    p0 = la1[18];
+    return (i0 + p0);
+}
+int f1(unsigned long p0, unsigned int p1, unsigned short p2) {
+    unsigned char v0 = 954;
+    long v1 = 2;
+    unsigned short v2 = 254;
+    int i0 = 924;
+    long j0 = 711407544284;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 0l; }
+    int la1[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la1[i0] = i0 * 256; }
+    if (i0 >= 0 && i0 < 8) { la0[i0] = (v1 > (194 * p2)); }
+    if (v0) {
+        switch ((p1 <= (g0 != 586))) {
+        default:
+            f0((659 - g1), f0(123, 679));
+            for (v1 = 0; v1 < 33; v1 = v1 + 1) {
+                if (((203 + p0) / (v1 * v1 + 1))) { break; }
+                if (8) { break; }
+            }
+            break;
+        case 8:
+            if (((unsigned long)(256) / (v0 * v0 + 1))) {
+                f0((la0[0] || 65536), f0(i0, 7));
+                f0((j0 != 436), v1);
+                f0((v2 + la1[5]), 938);
+            } else {
+                f0((5 / (v2 * v2 + 1)), (10 && 7));
+                p2 = 2;
+                v2 = i0;
+            }
+        case 3:
+            if (((129 <= 38649845641) - (i0 < 531))) { return (7l - f0(g1, la0[2])); }
+            break;
+        case 0:
+            if (j0 >= 0 && j0 < 33) { la1[j0] = (f0(256662020801l, g1) != 7780786835); }
+            break;
+        }
+        i0 = i0 + (818 >= p1);
+    }
+    p1 = 80;
+    v0 = (unsigned short)(f0(6, i0));
+    f0(7L, (219 - 8));
+    if (f0(v2, (la1[12] / 10))) {
+        v1 = v0;
+        p1 = !((f0(447l, 8) == (118 - 5)));
+    } else {
+        j0 = ((f0(i0, 300l) != (j0 - i0)) / 1);
+    }
+    return g0;
+}
+void w1(unsigned long q0, unsigned int q1, unsigned short q2) {
+    g1 = g1 * 3 + q1;
+    g1 = g1 * 3 + q1;
+}
+int main() {
+    short v0 = 637345218093;
+    int v1 = 1076028922594;
+    long v2 = 188;
+    long v3 = 897;
+    int i0 = 8l;
+    long j0 = 560;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 9; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 6; }
+    switch ((v2 + (198061600 + 0))) {
+    case 104:
+        v1 = f1((v2 / 5l), (la1[2] && 1), f1(0l, 0, 334));
+        break;
+    case 5:
+        v2 = v2 + (508595179388 + v3);
+        i0 = (9 - g0);
+        break;
+    case 1:
+        break;
+    case 24:
+    case 715:
+        break;
+    case 56:
+        la1[3] = 1000000007;
+        break;
+    }
+    if ((!(v2) / (g1 * g1 + 1))) {
+        for (v1 = 0; v1 < 3; v1 = v1 + 1) {
+            switch (((short)(g1) <= (long)(1))) {
+            case -1:
+                break;
+            case 4:
+                break;
+            case 0:
+                if (((5l * 107) * (unsigned short)(9))) { break; }
+                if (((10 / 5l) < -(2))) { break; }
+            case -3:
+            case 27:
+                break;
+            case 402:
+                if (6) { break; }
+                if (la0[v1] < i0) { i0 = la0[v1]; }
+                break;
+            case 575:
+                v2 = (((32767 && i0) != -(v2)) || !(g1));
+                g1 = (f0(v2, 3) + la1[3]);
+            default:
+                if (v3 >= 0 && v3 < 4) { la1[v3] = ((v1 + 719) < (v2 - 9)); }
+            case 3:
+                j0 = (long)(((v3 / 2) / 16));
+                break;
+            }
+            for (v2 = 0; v2 < 17; v2 = v2 + 1) {
+                v3 = f0(934, (v3 / 1024));
+                g0 = (((440u - la0[6]) / (i0 * i0 + 1)) == (unsigned long)(994600268582));
+                if ((la0[11] / 7)) { break; }
+            }
+        }
+        for (v3 = 0; v3 < 5; v3 = v3 + 1) {
+            switch (v2) {
+            case 6:
+                break;
+            case 2:
+                g0 = g0 + ((j0 - 2147483647) - (842 == g0));
+                break;
+            default:
+                break;
+            case 10:
+            case 4:
+                j0 = (6 == f0(5, i0));
+                v2 = -((int)((g0 - 7)));
+                break;
+            }
+        }
+        i0 = ((985 - g0) == (la1[3] > v3));
+    } else {
+        w1(la0[11], 9, v0);
+    }
+    switch (818U) {
+    default:
+        f1((la1[1] + 127), (v1 + 7), 65536);
+        v2 = (long)(f1(3, v2, 3));
+        break;
+    case 6:
+        la1[3] = (int)((10 + v1));
+        switch (((v2 + la1[3]) < (int)(6l))) {
+        case 2:
+            for (v1 = 1; v1 < 4; v1 = v1 + 1) {
+                if (f1(i0, v2, 6)) { break; }
+                v0 = v1;
+                i0 = f1(g0, (la1[3] || g0), la0[15]);
+            }
+            if (((short)(j0) || 323)) {
+                v2 = v2 + ((2 - 32767) > v2);
+            }
+            break;
+        default:
+            la1[0] = (v3 || 469);
+            if (g0 >= 0 && g0 < 16) { la0[g0] = ((v1 < g1) > -(g1)); }
+            break;
+        }
+        break;
+    case 8:
+        i0 = i0 + (10 / (v3 * v3 + 1));
+        w1(128, v0, i0);
+        break;
+    case 3:
+        break;
+    }
+    j0 = (f1(8, 861l, g1) / 3u);
+    g0 = g0 + (10 * 4);
+    g1 = g1 + (-(111) && (6 || 299));
+    v0 = (((v2 / 7) || 610) != v1);
+    la0[9] = -(835);
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + g1;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1709 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.zero 8
+	.type g1, @object
+	.size g1, 1
+	.p2align 0
+g1:
+	.zero 1
+	.section .text
+	.type f1, @function
+	.type f0, @function
+	.type f1.constprop.0, @function
+	.global main
+	.type main, @function
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $304, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movw %dx, -14(%rbp)
+	movb $186, -15(%rbp)
+	movq $2, -24(%rbp)
+	movw $254, -26(%rbp)
+	movl $924, -32(%rbp)
+	movabsq $711407544284, %rax
+	movq %rax, -40(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jge .L0
+	movl $8, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -88(%rbp)
+	cmpq $0, -88(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movslq -32(%rbp), %rax
+	movq %rax, -96(%rbp)
+	imulq $0, %rax, %rax
+	movq %rax, %rcx
+	movq -96(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -104(%rbp)
+	imulq $0, %rax, %rax
+	movq %rax, %rcx
+	movq -104(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -112(%rbp)
+	imulq $0, %rax, %rax
+	movq %rax, %rcx
+	movq -112(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -120(%rbp)
+	imulq $0, %rax, %rax
+	movq %rax, %rcx
+	movq -120(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -88(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $8, -32(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -32(%rbp), %rax
+	movq %rax, -128(%rbp)
+	imulq $0, %rax, %rax
+	movq %rax, %rcx
+	movq -128(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jl .L4
+.L5:
+	movl $0, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L6
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -280(%rbp)
+	cmpq $0, -280(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movl -32(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movl -32(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -280(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $33, -32(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movl -32(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L10
+.L11:
+	cmpl $0, -32(%rbp)
+	jl .L12
+	cmpl $8, -32(%rbp)
+	jge .L12
+	movzwl -14(%rbp), %eax
+	imull $194, %eax, %eax
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -32(%rbp), %rax
+	movl %ecx, -80(%rbp,%rax,4)
+.L12:
+.L13:
+	cmpb $0, -15(%rbp)
+	je .L14
+	cmpq $586, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	cmpl %eax, -12(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L20
+	cmpq $3, %rax
+	je .L19
+	cmpq $8, %rax
+	je .L18
+.L17:
+	movl $679, %eax
+	movq %rax, %rsi
+	movl $123, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rsi
+	movl $659, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rdi
+	call f0
+	movq $0, -24(%rbp)
+	movq -8(%rbp), %rax
+	addq $203, %rax
+	movq %rax, -288(%rbp)
+	cmpq $33, -24(%rbp)
+	jge .L22
+	.p2align 4,,10
+.L21:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -288(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L23
+.L22:
+.L16:
+	cmpl $818, -12(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	addl %eax, -32(%rbp)
+.L14:
+.L15:
+	movl $80, -12(%rbp)
+	movl -32(%rbp), %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -15(%rbp)
+	movl $219, %eax
+	subl $8, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	movl -224(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rsi
+	movzwl -26(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L37
+	movzbl -15(%rbp), %eax
+	movq %rax, -24(%rbp)
+	movl $118, %eax
+	subl $5, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $191, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+	jmp .L38
+.L37:
+	movq -40(%rbp), %rax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $300, %eax
+	movq %rax, %rsi
+	movl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L38:
+	movq g0(%rip), %rax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L20:
+	cmpq $0, -40(%rbp)
+	jl .L16
+	cmpq $33, -40(%rbp)
+	jge .L16
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movl $193, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movabsq $7780786835, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movl %ecx, -272(%rbp,%rax,4)
+.L35:
+.L36:
+	jmp .L16
+.L23:
+.L24:
+	movl $8, %eax
+	testl %eax, %eax
+	je .L25
+	jmp .L22
+.L31:
+	movl $0, %eax
+.L32:
+	movq %rax, %rsi
+	movzwl -26(%rbp), %eax
+	movl %eax, -296(%rbp)
+	imull -296(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdi
+	call f0
+	movw $2, -14(%rbp)
+	movl -32(%rbp), %eax
+	movw %ax, -26(%rbp)
+.L28:
+.L19:
+	movabsq $38649845641, %rax
+	cmpq $129, %rax
+	setge %al
+	movzbl %al, %eax
+	cmpl $531, -32(%rbp)
+	setl %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	jne .LB0
+.L33:
+.L34:
+	jmp .L16
+.L25:
+.L26:
+	addq $1, -24(%rbp)
+	cmpq $33, -24(%rbp)
+	jl .L21
+	jmp .L22
+.L18:
+	movzbl -15(%rbp), %eax
+	movl %eax, -292(%rbp)
+	imull -292(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $256, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L27
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -32(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	pushq %rax
+	movl -80(%rbp), %eax
+	testl %eax, %eax
+	jne .L29
+	movl $65536, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L30
+.L29:
+	movl $1, %eax
+.L30:
+	movq %rax, %rdi
+	popq %rsi
+	call f0
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	cmpq $436, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movl $938, %eax
+	movq %rax, %rsi
+	movzwl -26(%rbp), %eax
+	movl -252(%rbp), %ecx
+	addl %ecx, %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L28
+.L27:
+	movl $10, %eax
+	testl %eax, %eax
+	je .L31
+	movl $7, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L32
+.LB0:
+	movl -72(%rbp), %eax
+	movq %rax, %rsi
+	movsbl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	subq %rcx, %rax
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movb %dil, -1(%rbp)
+	movw %si, -4(%rbp)
+	movabsq $297672601274, %rax
+	movq %rax, -16(%rbp)
+	movb $224, -17(%rbp)
+	movl $5, -24(%rbp)
+	movq $3, -32(%rbp)
+	movl $0, -24(%rbp)
+	movl $0, -48(%rbp)
+	movl $4, -44(%rbp)
+	movl $8, -40(%rbp)
+	movl $12, -36(%rbp)
+	movl $4, -24(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jge .L39
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L42
+	.p2align 4,,10
+.L41:
+	movl -24(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movl -24(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movl -24(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movl -24(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -200(%rbp)
+	jne .L41
+.L42:
+.L39:
+.L40:
+	cmpl $33, -24(%rbp)
+	jge .L44
+	.p2align 4,,10
+.L43:
+	movl -24(%rbp), %eax
+	sall $2, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -192(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L43
+.L44:
+	movq -32(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	jne .L45
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L46
+.L45:
+	movl $1, %eax
+.L46:
+	movl %eax, -24(%rbp)
+	movl -48(%rbp), %eax
+	testl %eax, %eax
+	je .L47
+	cmpq $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L48
+.L47:
+	movl $0, %eax
+.L48:
+	leal 1(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $1, %ecx
+	movl %ecx, %eax
+	movb %al, -1(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L49
+	xorl %eax, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	addl $1, %eax
+	movl %eax, -64(%rbp)
+	cmpq $0, -32(%rbp)
+	jne .LB1
+.L51:
+.L52:
+	movq -16(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setge %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	jmp .L50
+.L49:
+	movzbl -17(%rbp), %eax
+	movl %eax, -204(%rbp)
+	imull -204(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	cltd
+	idivl %ecx
+	imull $-4, %eax, %eax
+	imull $7, %eax, %eax
+	movw %ax, -4(%rbp)
+.L50:
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq g0(%rip), %rax
+	xorl %edx, %edx
+	divq %rcx
+	movsbl %al, %eax
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.LB1:
+	movq -32(%rbp), %rax
+	addq $3, %rax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.align 16
+f1.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $224, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movb $186, -7(%rbp)
+	movq $2, -16(%rbp)
+	movw $254, -18(%rbp)
+	movl $924, -24(%rbp)
+	movabsq $711407544284, %rax
+	movq %rax, -32(%rbp)
+	movl $0, -24(%rbp)
+	xorl %eax, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq -64(%rbp), %rsi
+	movl $8, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -24(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L55
+	.p2align 4,,10
+.L54:
+	movdqu %xmm8, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L54
+	movl %ecx, -24(%rbp)
+.L55:
+.L53:
+	cmpl $8, -24(%rbp)
+	jge .L57
+	.p2align 4,,10
+.L56:
+	movslq -24(%rbp), %rax
+	movl $0, -64(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L56
+.L57:
+	movl $0, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jge .L58
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -216(%rbp)
+	cmpq $0, -216(%rbp)
+	je .L61
+	.p2align 4,,10
+.L60:
+	movl -24(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movl -24(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movl -24(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movl -24(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -216(%rbp)
+	jne .L60
+.L61:
+.L58:
+.L59:
+	cmpl $33, -24(%rbp)
+	jge .L63
+	.p2align 4,,10
+.L62:
+	movl -24(%rbp), %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L62
+.L63:
+	cmpl $0, -24(%rbp)
+	jl .L64
+	cmpl $8, -24(%rbp)
+	jge .L64
+	movzwl -6(%rbp), %eax
+	imull $194, %eax, %eax
+	movslq %eax, %rax
+	cmpq %rax, -16(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	movl %ecx, -64(%rbp,%rax,4)
+.L64:
+.L65:
+	cmpb $0, -7(%rbp)
+	je .L66
+	cmpq $586, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	cmpl %eax, -4(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L72
+	cmpq $3, %rax
+	je .L71
+	cmpq $8, %rax
+	je .L70
+.L69:
+	movl $679, %eax
+	movq %rax, %rsi
+	movl $123, %eax
+	movq %rax, %rdi
+	call f0
+	movq %rax, %rsi
+	movl $659, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rdi
+	call f0
+	movq $0, -16(%rbp)
+	cmpq $33, -16(%rbp)
+	jge .L74
+	.p2align 4,,10
+.L73:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $203, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+.L74:
+.L68:
+	cmpl $818, -4(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	addl %eax, -24(%rbp)
+.L66:
+.L67:
+	movl $80, -4(%rbp)
+	movl -24(%rbp), %eax
+	movq %rax, %rsi
+	movl $6, %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -7(%rbp)
+	movl $211, %eax
+	movq %rax, %rsi
+	movl $7, %eax
+	movq %rax, %rdi
+	call f0
+	movl -160(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movq %rax, %rsi
+	movzwl -18(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L85
+	movzbl -7(%rbp), %eax
+	movq %rax, -16(%rbp)
+	movl $8, %eax
+	movq %rax, %rsi
+	movl $191, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	cmpl $113, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	jmp .L86
+.L85:
+	movq -32(%rbp), %rax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $300, %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+.L86:
+	movq g0(%rip), %rax
+.f1.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L72:
+	cmpq $0, -32(%rbp)
+	jl .L68
+	cmpq $33, -32(%rbp)
+	jge .L68
+	movsbl g1(%rip), %eax
+	movq %rax, %rsi
+	movl $193, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movabsq $7780786835, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movl %ecx, -208(%rbp,%rax,4)
+.L83:
+.L84:
+	jmp .L68
+.L75:
+.L76:
+	jmp .L74
+.L77:
+	movl $1, %eax
+	movq %rax, %rsi
+	movzwl -18(%rbp), %eax
+	movl %eax, -224(%rbp)
+	imull -224(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rdi
+	call f0
+	movw $2, -6(%rbp)
+	movl -24(%rbp), %eax
+	movw %ax, -18(%rbp)
+.L78:
+.L71:
+	movl $1, %eax
+	cmpl $531, -24(%rbp)
+	setl %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	jne .LB2
+.L81:
+.L82:
+	jmp .L68
+.L70:
+	movzbl -7(%rbp), %eax
+	movl %eax, -220(%rbp)
+	imull -220(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $256, %eax
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L77
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	pushq %rax
+	movl -64(%rbp), %eax
+	testl %eax, %eax
+	jne .L79
+	movl $65536, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L80
+.L79:
+	movl $1, %eax
+.L80:
+	movq %rax, %rdi
+	popq %rsi
+	call f0
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	cmpq $436, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movl $938, %eax
+	movq %rax, %rsi
+	movzwl -18(%rbp), %eax
+	movl -188(%rbp), %ecx
+	addl %ecx, %eax
+	movq %rax, %rdi
+	call f0
+	jmp .L78
+.LB2:
+	movl -56(%rbp), %eax
+	movq %rax, %rsi
+	movsbl g1(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	subq %rcx, %rax
+	jmp .f1.constprop.0_return
+	.size f1.constprop.0, .-f1.constprop.0
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $208, %rsp
+	movw $15917, -2(%rbp)
+	movl $-2007868702, -8(%rbp)
+	movq $188, -16(%rbp)
+	movq $897, -24(%rbp)
+	movl $8, -28(%rbp)
+	movq $560, -40(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -116(%rbp)
+	testl %eax, %eax
+	je .L87
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -128(%rbp)
+	cmpq $0, -128(%rbp)
+	je .L90
+	.p2align 4,,10
+.L89:
+	movslq -28(%rbp), %rax
+	imull $9, -28(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	imull $9, -28(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	imull $9, -28(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	imull $9, -28(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	subq $1, -128(%rbp)
+	jne .L89
+.L90:
+.L87:
+.L88:
+	cmpl $16, -28(%rbp)
+	jge .L92
+	.p2align 4,,10
+.L91:
+	movslq -28(%rbp), %rax
+	imull $9, -28(%rbp), %ecx
+	movl %ecx, -112(%rbp,%rax,4)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L91
+.L92:
+	movl $0, -28(%rbp)
+	movl $0, -144(%rbp)
+	movl $6, -140(%rbp)
+	movl $12, -136(%rbp)
+	movl $18, -132(%rbp)
+	movl $4, -28(%rbp)
+	movq -16(%rbp), %rax
+	addq $198061600, %rax
+	cmpq $56, %rax
+	jge .L99
+	cmpq $1, %rax
+	je .L96
+	cmpq $5, %rax
+	je .L95
+	cmpq $24, %rax
+	je .L93
+	jmp .L93
+.L99:
+	cmpq $56, %rax
+	je .L98
+	cmpq $104, %rax
+	je .L94
+	cmpq $715, %rax
+.L96:
+.L93:
+	movsbl g1(%rip), %eax
+	movsbl g1(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L102
+	movl $0, -8(%rbp)
+	movq $4815, -152(%rbp)
+	movl $0, -156(%rbp)
+	cmpl $3, -8(%rbp)
+	jge .L105
+	.p2align 4,,10
+.L104:
+	movsbl g1(%rip), %eax
+	movswq %ax, %rax
+	cmpq $1, %rax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $402, %rax
+	jge .L115
+	leaq 3(%rax), %rcx
+	cmpq $7, %rcx
+	ja .L116
+	leaq .L117(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L113
+	# table target .L110
+	# table target .L107
+	# table target .L109
+	# table target .L114
+	# table target .L108
+	jmp *%rcx
+.L115:
+	cmpq $402, %rax
+	je .L106
+	cmpq $575, %rax
+	je .L112
+	jmp .L113
+.L116:
+	cmpq $27, %rax
+	je .L106
+	jmp .L113
+.L122:
+	movl $1, %eax
+.L123:
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl $3, %eax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movl -132(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, g1(%rip)
+.L113:
+	cmpq $0, -24(%rbp)
+	jl .L124
+	cmpq $4, -24(%rbp)
+	jge .L124
+	movq -16(%rbp), %rax
+	subq $9, %rax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl $719, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+.L124:
+.L125:
+.L114:
+	movq -24(%rbp), %rax
+	leaq 1(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $1, %rcx
+	movq %rcx, %rax
+	leaq 15(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $4, %rcx
+	movq %rcx, %rax
+	movq %rax, -40(%rbp)
+.L106:
+	movq $0, -16(%rbp)
+	movl -28(%rbp), %eax
+	imull -28(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -160(%rbp)
+	cmpq $17, -16(%rbp)
+	jge .L127
+	.p2align 4,,10
+.L126:
+	movq -24(%rbp), %rax
+	leaq 1023(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $10, %rcx
+	movq %rcx, %rax
+	movq %rax, %rsi
+	movl $166, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	movq %rax, -24(%rbp)
+	movl -160(%rbp), %eax
+	pushq %rax
+	movl -88(%rbp), %eax
+	movq %rax, %rcx
+	movl $440, %eax
+	subl %ecx, %eax
+	popq %rcx
+	xorl %edx, %edx
+	divl %ecx
+	movabsq $994600268582, %rcx
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, g0(%rip)
+	movl -68(%rbp), %eax
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	testl %eax, %eax
+	je .L128
+.L127:
+	addl $1, -8(%rbp)
+	cmpl $3, -8(%rbp)
+	jl .L104
+.L105:
+	movq $0, -24(%rbp)
+	cmpq $5, -24(%rbp)
+	jge .L131
+	.p2align 4,,10
+.L130:
+	movq -16(%rbp), %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L137
+	leaq .L138(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L135
+	# table target .L134
+	# table target .L136
+	# table target .L133
+	jmp *%rcx
+.L128:
+.L129:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L126
+	jmp .L127
+.L137:
+.L135:
+.L132:
+	addq $1, -24(%rbp)
+	cmpq $5, -24(%rbp)
+	jl .L130
+.L131:
+	movl -132(%rbp), %eax
+	movslq %eax, %rax
+	cmpq -24(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $985, %eax
+	subq g0(%rip), %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+.L139:
+.L103:
+	movl $818, %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+	je .L140
+	cmpq $6, %rax
+	je .L142
+	cmpq $8, %rax
+	je .L143
+.L141:
+	xorl %eax, %eax
+	movq %rax, %rdx
+	movl -8(%rbp), %eax
+	addl $7, %eax
+	movq %rax, %rsi
+	movl -140(%rbp), %eax
+	addl $127, %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+	movl $3, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $3, %eax
+	movq %rax, %rdi
+	call f1
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	jmp .L140
+.L144:
+	jmp .L140
+.L146:
+	movl $1, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jge .L149
+	.p2align 4,,10
+.L148:
+	movl $6, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movslq -28(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	testl %eax, %eax
+	je .L150
+.L149:
+	movq -40(%rbp), %rax
+	testw %ax, %ax
+	jne .L156
+	movl $323, %eax
+	testl %eax, %eax
+	je .L154
+.L156:
+	cmpq $-32765, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+.L154:
+.L155:
+.L145:
+.L140:
+	movsbl g1(%rip), %eax
+	movq %rax, %rdx
+	movl $861, %eax
+	movq %rax, %rsi
+	movl $8, %eax
+	movq %rax, %rdi
+	call f1
+	movl %eax, %eax
+	movabsq $6148914691236517206, %rdx
+	imulq %rdx
+	movl %edx, %eax
+	movq %rax, -40(%rbp)
+	addq $40, g0(%rip)
+	movsbl g1(%rip), %eax
+	addl $1, %eax
+	movb %al, g1(%rip)
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	jne .L162
+	movl $610, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L163
+.L162:
+	movl $1, %eax
+.L163:
+	cmpl -8(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -2(%rbp)
+	movl $-835, -76(%rbp)
+	movq $0, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movsbq g1(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movswq -2(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movslq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq -24(%rbp), %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	imulq $31, -192(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movl $0, -28(%rbp)
+	cmpl $0, -116(%rbp)
+	je .L164
+	movl $16, %eax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -200(%rbp)
+	cmpq $0, -200(%rbp)
+	je .L167
+	.p2align 4,,10
+.L166:
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -200(%rbp)
+	jne .L166
+.L167:
+.L164:
+.L165:
+	cmpl $16, -28(%rbp)
+	jge .L169
+	.p2align 4,,10
+.L168:
+	movslq -28(%rbp), %rax
+	movl -112(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	addl $1, -28(%rbp)
+	cmpl $16, -28(%rbp)
+	jl .L168
+.L169:
+	movl $0, -28(%rbp)
+	movl -144(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movl -140(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movl -136(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movl -132(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -192(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movl $4, -28(%rbp)
+	movq -192(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -192(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -192(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -192(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -192(%rbp)
+	movq -192(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L150:
+.L151:
+	movl -8(%rbp), %eax
+	movw %ax, -2(%rbp)
+	movl -52(%rbp), %eax
+	pushq %rax
+	movl -132(%rbp), %eax
+	testl %eax, %eax
+	jne .L152
+	cmpq $0, g0(%rip)
+	setne %al
+	movzbl %al, %eax
+	jmp .L153
+.L152:
+	movl $1, %eax
+.L153:
+	movq %rax, %rsi
+	movq g0(%rip), %rax
+	movq %rax, %rdi
+	popq %rdx
+	call f1
+	movl %eax, -28(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $4, -8(%rbp)
+	jl .L148
+	jmp .L149
+.L111:
+	jmp .L106
+.L142:
+	movl -8(%rbp), %eax
+	addl $10, %eax
+	movl %eax, -132(%rbp)
+	movl -132(%rbp), %eax
+	movslq %eax, %rax
+	addq -16(%rbp), %rax
+	cmpq $6, %rax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L146
+.L147:
+	cmpq $0, -24(%rbp)
+	jne .L157
+	movl $469, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L158
+.L102:
+	movl -68(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, -168(%rbp)
+	movswl -2(%rbp), %eax
+	movw %ax, -170(%rbp)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl $9, %eax
+	movb %al, g1(%rip)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl $9, %eax
+	movb %al, g1(%rip)
+	jmp .L139
+.L120:
+.L121:
+.L110:
+	jmp .L106
+.L112:
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	movq %rax, %rcx
+	cmpl $0, -28(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	jne .L122
+	cmpb $0, g1(%rip)
+	sete %al
+	movzbl %al, %eax
+	jmp .L123
+.L157:
+	movl $1, %eax
+.L158:
+	movl %eax, -144(%rbp)
+	cmpq $0, g0(%rip)
+	jb .L145
+	cmpq $16, g0(%rip)
+	jae .L145
+	xorl %eax, %eax
+	movsbl g1(%rip), %ecx
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movsbl g1(%rip), %eax
+	cmpl %eax, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq g0(%rip), %rax
+	movl %ecx, -112(%rbp,%rax,4)
+.L159:
+.L160:
+	jmp .L145
+.L143:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $10, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movslq -28(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -28(%rbp)
+	movswl -2(%rbp), %eax
+	movl %eax, -176(%rbp)
+	movl -28(%rbp), %eax
+	movw %ax, -178(%rbp)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl -176(%rbp), %eax
+	movb %al, g1(%rip)
+	movsbl g1(%rip), %eax
+	imull $3, %eax, %eax
+	addl -176(%rbp), %eax
+	movb %al, g1(%rip)
+.L161:
+	jmp .L140
+.L98:
+	movl $1000000007, -132(%rbp)
+	jmp .L93
+.L94:
+	movl $334, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	call f1.constprop.0
+	pushq %rax
+	movl -136(%rbp), %eax
+	testl %eax, %eax
+	je .L100
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L101
+.L100:
+	movl $0, %eax
+.L101:
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	movq %rax, %rdi
+	popq %rdx
+	call f1
+	movl %eax, -8(%rbp)
+	jmp .L93
+.L95:
+	movabsq $508595179388, %rax
+	addq -24(%rbp), %rax
+	addq %rax, -16(%rbp)
+	movl $9, %eax
+	subq g0(%rip), %rax
+	movl %eax, -28(%rbp)
+	jmp .L93
+.L97:
+	jmp .L93
+.L107:
+	jmp .L106
+.L108:
+	jmp .L106
+.L109:
+	cmpq $0, -152(%rbp)
+	je .L118
+	jmp .L106
+.L118:
+.L119:
+	cmpl $0, -156(%rbp)
+	je .L106
+	jmp .L106
+.L133:
+	jmp .L132
+.L134:
+	cmpq $842, g0(%rip)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	subq $2147483647, %rax
+	subq %rcx, %rax
+	addq %rax, g0(%rip)
+	jmp .L132
+.L136:
+	movl -28(%rbp), %eax
+	movq %rax, %rsi
+	movl $5, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	cmpl $6, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movq g0(%rip), %rax
+	subq $7, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	jmp .L132
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L117:
+	.long .L110-.L117
+	.long .L113-.L117
+	.long .L107-.L117
+	.long .L109-.L117
+	.long .L113-.L117
+	.long .L113-.L117
+	.long .L114-.L117
+	.long .L108-.L117
+	.p2align 2
+.L138:
+	.long .L134-.L138
+	.long .L135-.L138
+	.long .L136-.L138
+	.long .L135-.L138
+	.long .L133-.L138
+	.long .L135-.L138
+	.long .L135-.L138
+	.long .L135-.L138
+	.long .L136-.L138
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
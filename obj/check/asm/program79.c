@@ -0,0 +1,120 @@
+int ga0[8];
+int ga1[8];
+int main() {
+    unsigned char v0 = 2;
+    short v1 = 138;
+    int i0 = 1;
+    long j0 = 4u;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 0U; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 9; }
+    switch ((unsigned long)((989424716472 / 100))) {
+    case 3:
+        if (((short)(!(la0[15])) + ((short)(v0) < (9 <= v0)))) {
+            for (v1 = 1; v1 < 8; v1 = v1 + 1) {
+                j0 = 10;
+                if (v0) { break; }
+                if (368) { break; }
+            }
+        } else {
+            i0 = i0 + 9;
+            if (!((j0 + 8))) { return (i0 < j0); }
+            ga1[6] = 3;
+        }
+    case 413:
+        break;
+    case -4:
+        v1 = (i0 != 256);
+        if (-(533)) { return v0; }
+        break;
+    case 59:
+        if (j0 >= 0 && j0 < 16) { la1[j0] = (464593023700 + 128); }
+        v0 = ((i0 * v1) == !(!(761)));
+    default:
+        v1 = v0;
+        break;
+    case 61:
+        for (i0 = 1; i0 < 8; i0 = i0 + 1) {
+            if (!(!(ga0[2]))) { break; }
+        }
+        v1 = ga1[4];
+        break;
+    case -2:
+        for (i0 = 0; i0 < 100; i0 = i0 + 1) {
+            if ((((7 + ga0[6]) == (unsigned long)(128)) / (i0 * i0 + 1))) {
+                ga1[0] = ((4 * j0) > (short)(4));
+            } else {
+                v0 = (972 + (v0 + (unsigned char)(j0)));
+                if (((10 != 767) / (j0 * j0 + 1))) { break; }
+            }
+            v0 = 7;
+        }
+        break;
+    case 411:
+        if (j0) { return !(2); }
+        break;
+    }
+    for (j0 = 0; j0 < 17; j0 = j0 + 1) {
+        v1 = ((v0 <= 154654898913) + (j0 / (j0 * j0 + 1)));
+        if (i0 >= 0 && i0 < 33) { la0[i0] = ((v0 && 93) > 8); }
+    }
+    la0[14] = (j0 - (7 / (v1 * v1 + 1)));
+    for (i0 = 2; i0 < 33; i0 = i0 + 1) {
+        if ((unsigned long)((la1[2] > 622530989834))) {
+            switch (v0) {
+            case 8:
+                v0 = !(!((int)(1)));
+                if (6) { break; }
+                break;
+            case 2:
+                if (!((j0 <= i0))) { return i0; }
+                v1 = v0;
+            default:
+                break;
+            }
+            if (v1 >= 0 && v1 < 16) { la1[v1] = (10 - !(la1[14])); }
+            switch (!(v0)) {
+            default:
+            case 10:
+                if (((7 + 9) / (i0 * i0 + 1))) { break; }
+                if (((32767 * i0) == (v1 / (j0 * j0 + 1)))) { break; }
+                break;
+            case 7:
+            case 8:
+                if ((1080534061847 - (v0 == i0))) { break; }
+                break;
+            case 2:
+                v0 = ((int)(j0) && (8l * 85));
+                break;
+            }
+        }
+    }
+    i0 = 0;
+    while (i0 < 3) {
+        v1 = 0;
+        while (v1 < 3) {
+            switch (v0) {
+            case 3:
+                break;
+            }
+            ga1[v1] = (unsigned int)((191 <= 1));
+            j0 = ((unsigned char)(i0) == (la1[0] == la0[23]));
+            v1 = v1 + 1;
+        }
+        i0 = i0 + 1;
+    }
+    v1 = j0;
+    if (v0) { return ((v1 != 609102141132) <= (ga0[4] || j0)); }
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,1072 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 32
+	.p2align 5
+ga0:
+	.zero 32
+	.type ga1, @object
+	.size ga1, 32
+	.p2align 5
+ga1:
+	.zero 32
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $400, %rsp
+	movb $2, -1(%rbp)
+	movw $138, -4(%rbp)
+	movl $1, -8(%rbp)
+	movq $4, -16(%rbp)
+	movl $0, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -164(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $33, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -176(%rbp)
+	cmpq $0, -176(%rbp)
+	je .L3
+	.p2align 4,,10
+.L2:
+	movl -8(%rbp), %eax
+	imull $0, %eax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl -8(%rbp), %eax
+	imull $0, %eax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl -8(%rbp), %eax
+	imull $0, %eax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movl -8(%rbp), %eax
+	imull $0, %eax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -176(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $33, -8(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movl -8(%rbp), %eax
+	imull $0, %eax, %eax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	movl %ecx, -160(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jl .L4
+.L5:
+	movl $0, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -244(%rbp)
+	testl %eax, %eax
+	je .L6
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L9
+	.p2align 4,,10
+.L8:
+	movslq -8(%rbp), %rax
+	imull $9, -8(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	imull $9, -8(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	imull $9, -8(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	imull $9, -8(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	subq $1, -256(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $16, -8(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movslq -8(%rbp), %rax
+	imull $9, -8(%rbp), %ecx
+	movl %ecx, -240(%rbp,%rax,4)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L10
+.L11:
+	movabsq $989424716472, %rax
+	movq %rax, %rcx
+	movabsq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	cmpq $59, %rax
+	jge .L21
+	cmpq $-4, %rax
+	je .L15
+	cmpq $-2, %rax
+	je .L19
+	cmpq $3, %rax
+	je .L13
+	jmp .L17
+.L21:
+	cmpq $411, %rax
+	jge .L22
+	cmpq $59, %rax
+	je .L16
+	cmpq $61, %rax
+	je .L18
+	jmp .L17
+.L22:
+	cmpq $411, %rax
+	je .L20
+	cmpq $413, %rax
+	je .L12
+	jmp .L17
+.L16:
+	cmpq $0, -16(%rbp)
+	jl .L35
+	cmpq $16, -16(%rbp)
+	jge .L35
+	movabsq $464593023700, %rax
+	addq $128, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movl %ecx, -240(%rbp,%rax,4)
+.L35:
+.L36:
+	movl $761, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl -4(%rbp), %eax
+	imull -8(%rbp), %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+.L17:
+	movzbl -1(%rbp), %eax
+	movw %ax, -4(%rbp)
+.L12:
+	movq $0, -16(%rbp)
+	movzbl -1(%rbp), %eax
+	movabsq $154654898913, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -284(%rbp)
+	cmpl $0, -8(%rbp)
+	jl .L49
+	cmpl $33, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L50
+.L49:
+	movl $0, %eax
+.L50:
+	movl %eax, -288(%rbp)
+	cmpb $0, -1(%rbp)
+	je .L51
+	movl $93, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L52
+.L51:
+	movl $0, %eax
+.L52:
+	cmpl $8, %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -292(%rbp)
+	cmpq $17, -16(%rbp)
+	jge .L53
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -304(%rbp)
+	cmpq $0, -304(%rbp)
+	je .L56
+	.p2align 4,,10
+.L55:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movslq -284(%rbp), %rax
+	movq %rax, -312(%rbp)
+	addq %rcx, %rax
+	movw %ax, -4(%rbp)
+	cmpl $0, -288(%rbp)
+	je .L57
+	movslq -8(%rbp), %rax
+	movl -292(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+.L57:
+.L58:
+	addq $1, -16(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	addq -312(%rbp), %rax
+	movw %ax, -4(%rbp)
+	cmpl $0, -288(%rbp)
+	je .L59
+	movslq -8(%rbp), %rax
+	movl -292(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+.L59:
+.L60:
+	addq $1, -16(%rbp)
+	subq $1, -304(%rbp)
+	jne .L55
+.L56:
+.L53:
+.L54:
+	cmpq $17, -16(%rbp)
+	jge .L62
+	.p2align 4,,10
+.L61:
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movslq -284(%rbp), %rax
+	addq %rcx, %rax
+	movw %ax, -4(%rbp)
+	cmpl $0, -288(%rbp)
+	je .L63
+	movslq -8(%rbp), %rax
+	movl -292(%rbp), %ecx
+	movl %ecx, -160(%rbp,%rax,4)
+.L63:
+.L64:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L61
+.L62:
+	movswl -4(%rbp), %eax
+	movl %eax, -316(%rbp)
+	imull -316(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	subq %rcx, %rax
+	movl %eax, -104(%rbp)
+	movl $2, -8(%rbp)
+	movl $7, %eax
+	addl $9, %eax
+	movl %eax, -320(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -328(%rbp)
+	movq -16(%rbp), %rax
+	testl %eax, %eax
+	je .L65
+	movl $8, %eax
+	imulq $85, %rax, %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L66
+.L65:
+	movl $0, %eax
+.L66:
+	movl %eax, -332(%rbp)
+	imull $32767, -8(%rbp), %eax
+	subl $32767, %eax
+	movl %eax, -336(%rbp)
+	cmpl $33, -8(%rbp)
+	jge .L68
+	.p2align 4,,10
+.L67:
+	addl $32767, -336(%rbp)
+	movl -232(%rbp), %eax
+	movslq %eax, %rax
+	movabsq $622530989834, %rcx
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	je .L69
+	movzbl -1(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L73
+	cmpq $8, %rax
+	je .L72
+	jmp .L74
+.L85:
+.L82:
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -320(%rbp), %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L87
+.L81:
+.L69:
+.L70:
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jl .L67
+.L68:
+	movl $0, -8(%rbp)
+	movl $191, %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -344(%rbp)
+	cmpl $3, -8(%rbp)
+	jge .L94
+	.p2align 4,,10
+.L93:
+	movw $0, -4(%rbp)
+	movl -344(%rbp), %eax
+	movl %eax, -348(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -352(%rbp)
+	cmpl $3, %eax
+	jge .L96
+	.p2align 4,,10
+.L95:
+	movzbl -1(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $3, %rax
+.L97:
+	movl -348(%rbp), %eax
+	movq %rax, %rcx
+	movswq -4(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movl -240(%rbp), %eax
+	movl -68(%rbp), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movl -352(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -352(%rbp)
+	cmpl $3, %eax
+	jl .L95
+.L96:
+	addl $1, -8(%rbp)
+	cmpl $3, -8(%rbp)
+	jl .L93
+.L94:
+	movq -16(%rbp), %rax
+	movw %ax, -4(%rbp)
+	cmpb $0, -1(%rbp)
+	je .L99
+	movl ga0+16(%rip), %eax
+	testl %eax, %eax
+	jne .L101
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L102
+.L98:
+	jmp .L97
+.L73:
+	movslq -8(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	jg .LB0
+.L77:
+.L78:
+	movzbl -1(%rbp), %eax
+	movw %ax, -4(%rbp)
+.L74:
+.L71:
+	movswl -4(%rbp), %eax
+	movl %eax, -340(%rbp)
+	testl %eax, %eax
+	jl .L79
+	cmpl $16, -340(%rbp)
+	jge .L79
+	movl -184(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	subl %ecx, %eax
+	movq %rax, %rcx
+	movswq -4(%rbp), %rax
+	movl %ecx, -240(%rbp,%rax,4)
+.L79:
+.L80:
+	cmpb $0, -1(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leaq -2(%rax), %rcx
+	cmpq $8, %rcx
+	ja .L85
+	leaq .L86(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L82
+	# table target .L84
+	# table target .L83
+	# table target .L82
+	jmp *%rcx
+.L87:
+.L88:
+	movswq -4(%rbp), %rax
+	cqo
+	idivq -328(%rbp)
+	movq %rax, %rcx
+	movslq -336(%rbp), %rax
+	cmpq %rcx, %rax
+	jne .L81
+	jmp .L81
+.L72:
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movb %al, -1(%rbp)
+	movl $6, %eax
+	testl %eax, %eax
+	je .L71
+	jmp .L71
+.L89:
+.L90:
+	jmp .L81
+.LB0:
+	movl -8(%rbp), %eax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L75:
+.L76:
+	jmp .L71
+.L15:
+	cmpl $256, -8(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -4(%rbp)
+	xorl %eax, %eax
+	subl $533, %eax
+	jne .LB1
+.L33:
+.L34:
+	jmp .L12
+.L13:
+	movzbl -1(%rbp), %eax
+	cmpl $9, %eax
+	setge %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	movswl %ax, %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	addl %ecx, %eax
+	je .L23
+	movw $1, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -260(%rbp)
+	cmpl $8, %eax
+	jge .L12
+	.p2align 4,,10
+.L25:
+	movq $10, -16(%rbp)
+	cmpb $0, -1(%rbp)
+	je .L27
+.L26:
+.L24:
+.L14:
+	jmp .L12
+.L19:
+	movl $0, -8(%rbp)
+	imulq $4, -16(%rbp), %rax
+	cmpq $4, %rax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -264(%rbp)
+	movl $10, %eax
+	cmpl $767, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -268(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -280(%rbp)
+	cmpl $100, -8(%rbp)
+	jge .L12
+	.p2align 4,,10
+.L41:
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga0+24(%rip), %eax
+	addl $7, %eax
+	movslq %eax, %rax
+	cmpq $128, %rax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	testl %eax, %eax
+	je .L43
+	movl -264(%rbp), %eax
+	movl %eax, ga1+0(%rip)
+.L45:
+.L46:
+.L44:
+	movb $7, -1(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $100, -8(%rbp)
+	jl .L41
+	jmp .L12
+.L43:
+	movq -16(%rbp), %rax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzbl -1(%rbp), %eax
+	addl %ecx, %eax
+	addl $972, %eax
+	movb %al, -1(%rbp)
+	movslq -268(%rbp), %rax
+	cqo
+	idivq -280(%rbp)
+	testq %rax, %rax
+	je .L45
+.L42:
+	jmp .L12
+.L20:
+	cmpq $0, -16(%rbp)
+	jne .LB2
+.L47:
+.L48:
+	jmp .L12
+.L27:
+.L28:
+	movl $368, %eax
+	testl %eax, %eax
+	je .L29
+	jmp .L12
+.L18:
+	movl $1, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jge .L38
+	.p2align 4,,10
+.L37:
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	je .L39
+.L38:
+	movl ga1+16(%rip), %eax
+	movw %ax, -4(%rbp)
+	jmp .L12
+.L39:
+.L40:
+	addl $1, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jl .L37
+	jmp .L38
+.L29:
+.L30:
+	movl -260(%rbp), %eax
+	addl $1, %eax
+	movw %ax, -4(%rbp)
+	movswl -4(%rbp), %eax
+	movl %eax, -260(%rbp)
+	cmpl $8, %eax
+	jl .L25
+	jmp .L12
+.L23:
+	addl $9, -8(%rbp)
+	movq -16(%rbp), %rax
+	addq $8, %rax
+	je .LB3
+.L31:
+.L32:
+	movl $3, ga1+24(%rip)
+	jmp .L12
+.L83:
+	movzbl -1(%rbp), %eax
+	cmpl -8(%rbp), %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $1080534061847, %rax
+	subq %rcx, %rax
+	je .L81
+	jmp .L81
+.L91:
+.L92:
+	jmp .L81
+.L84:
+	movl -332(%rbp), %eax
+	movb %al, -1(%rbp)
+	jmp .L81
+.L101:
+	movl $1, %eax
+.L102:
+	pushq %rax
+	movswq -4(%rbp), %rax
+	movabsq $609102141132, %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	jmp .main_return
+.L99:
+.L100:
+	movq $0, -360(%rbp)
+	imulq $31, -360(%rbp), %rax
+	movzbl -1(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	imulq $31, -360(%rbp), %rax
+	movswq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	imulq $31, -360(%rbp), %rax
+	movslq -8(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	imulq $31, -360(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -360(%rbp)
+	movl $0, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -364(%rbp)
+	testl %eax, %eax
+	je .L103
+	movl $8, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -376(%rbp)
+	cmpq $0, -376(%rbp)
+	je .L106
+	.p2align 4,,10
+.L105:
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -376(%rbp)
+	jne .L105
+.L106:
+.L103:
+.L104:
+	cmpl $8, -8(%rbp)
+	jge .L108
+	.p2align 4,,10
+.L107:
+	movslq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jl .L107
+.L108:
+	movl $0, -8(%rbp)
+	cmpl $0, -364(%rbp)
+	je .L109
+	movl $8, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -384(%rbp)
+	cmpq $0, -384(%rbp)
+	je .L112
+	.p2align 4,,10
+.L111:
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -384(%rbp)
+	jne .L111
+.L112:
+.L109:
+.L110:
+	cmpl $8, -8(%rbp)
+	jge .L114
+	.p2align 4,,10
+.L113:
+	movslq -8(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $8, -8(%rbp)
+	jl .L113
+.L114:
+	movl $0, -8(%rbp)
+	cmpl $0, -164(%rbp)
+	je .L115
+	movl $33, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -392(%rbp)
+	cmpq $0, -392(%rbp)
+	je .L118
+	.p2align 4,,10
+.L117:
+	movslq -8(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -392(%rbp)
+	jne .L117
+.L118:
+.L115:
+.L116:
+	cmpl $33, -8(%rbp)
+	jge .L120
+	.p2align 4,,10
+.L119:
+	movslq -8(%rbp), %rax
+	movl -160(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $33, -8(%rbp)
+	jl .L119
+.L120:
+	movl $0, -8(%rbp)
+	cmpl $0, -244(%rbp)
+	je .L121
+	movl $16, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -400(%rbp)
+	cmpq $0, -400(%rbp)
+	je .L124
+	.p2align 4,,10
+.L123:
+	movslq -8(%rbp), %rax
+	movl -240(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -240(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -240(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	movslq -8(%rbp), %rax
+	movl -240(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	subq $1, -400(%rbp)
+	jne .L123
+.L124:
+.L121:
+.L122:
+	cmpl $16, -8(%rbp)
+	jge .L126
+	.p2align 4,,10
+.L125:
+	movslq -8(%rbp), %rax
+	movl -240(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -360(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $16, -8(%rbp)
+	jl .L125
+.L126:
+	movq -360(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -360(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -360(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -360(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -360(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -360(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -360(%rbp)
+	movq -360(%rbp), %rax
+	jmp .main_return
+.LB1:
+	movzbl -1(%rbp), %eax
+	jmp .main_return
+.LB2:
+	movl $2, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .main_return
+.LB3:
+	movslq -8(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setl %al
+	movzbl %al, %eax
+	jmp .main_return
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L86:
+	.long .L84-.L86
+	.long .L82-.L86
+	.long .L82-.L86
+	.long .L82-.L86
+	.long .L82-.L86
+	.long .L83-.L86
+	.long .L83-.L86
+	.long .L82-.L86
+	.long .L82-.L86
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,375 @@
+int ga0[33];
+int ga1[16];
+unsigned short f0(unsigned short p0, unsigned int p1, unsigned long p2, unsigned short p3, long p4, unsigned short p5, unsigned short p6) {
+    long v0 = 10;
+    unsigned char v1 = 3;
+    long v2 = 5;
+    char v3 = 979204843160;
+    int i0 = 824130191273;
+    long j0 = 4294967295;
+    switch ((p5 / (p5 * p5 + 1))) {
+    case 2:
+        p3 = 1012697517822;
+        v2 = v2;
+        break;
+    default:
+        break;
+    }
+    if ((unsigned short)((unsigned char)((0 / 8)))) {
+        if ((!(32767) / (p5 * p5 + 1))) { return ((p0 / 4) + j0); }
+        if (3) { return (long)(p2); }
+        if (((154080583330 / (j0 * j0 + 1)) < (long)(341))) {
+            if (507) {
+                p6 = (((8 * 8) >= (ga0[9] || p4)) > (p0 / (p2 * p2 + 1)));
+            }
+            p3 = p3 + !(v0);
+        }
+    }
+    for (p1 = 0; p1 < 5; p1 = p1 + 1) {
+        for (v0 = 2; v0 < 16; v0 = v0 + 1) {
+            if ((char)((v1 >= ga1[2]))) {
+                p0 = p3;
+                if (((p0 - p1) / (p4 * p4 + 1))) { break; }
+                if ((unsigned long)((v2 <= 7418464825))) { break; }
+            }
+            switch (((7 <= 700) - !(4))) {
+            case 9:
+                if (((p6 - p4) >= (842 - 256U))) { break; }
+                if (!((i0 && p0))) { break; }
+                break;
+            case 1:
+                if (p0) { break; }
+                if (2) { break; }
+            default:
+                break;
+            }
+        }
+        j0 = -((ga1[4] * 8ul));
+        if (((short)((i0 >= 406)) <= i0)) {
+            v3 = v3 + p6;
+            if ((char)(-((unsigned char)(p0)))) {
+                if ((2 < 991)) { break; }
+                if (127) { break; }
+                i0 = -(p2);
+            }
+        } else {
+            p6 = !((6l - (v3 <= 8)));
+            p6 = p4;
+        }
+    }
+    v2 = 0;
+    while (v2 < 4) {
+        p3 = 204625581598;
+        p0 = v0;
+        v2 = v2 + 1;
+    }
+    return (1 / 7);
+}
+unsigned char f1(short p0, unsigned short p1, char p2, unsigned long p3, short p4) {
+    unsigned long v0 = 5;
+    long v1 = 9;
+    unsigned short v2 = 10;
+    int i0 = 700443898675;
+    long j0 = 9;
+    v0 = !((unsigned short)(v2));
+    if (p1) {
+        p4 = p4 + (-(10ul) < p3);
+        j0 = j0 + -((p2 + v2));
+    } else {
+        if (((167 < 184) <= (-(p3) <= j0))) {
+            if ((((p4 / (j0 * j0 + 1)) && 841) + ((p2 + 2) / (p4 * p4 + 1)))) {
+                f0(v1, !(10), p2, !(64), (295 / 10), (unsigned long)(0), (2l > 599));
+                p1 = p1 + (v1 - (3 || p3));
+            }
+            p0 = (((804 - 3) * p3) - (p4 - 1));
+        }
+        v2 = 127;
+    }
+    for (p3 = 2; p3 < 16; p3 = p3 + 1) {
+        p2 = -((p3 != (p1 <= ga1[4])));
+        if (ga0[p3] < p4) { p4 = ga0[p3]; }
+        p2 = ((p2 / 4) > ga1[9]);
+    }
+    v1 = v1 + p1;
+    if (p4) {
+        p3 = p1;
+        if (5l) {
+            for (i0 = 0; i0 < 4; i0 = i0 + 1) {
+                if (p3) { break; }
+                if ((v1 < 1)) { break; }
+                p4 = f0(1, j0, (6 < 847), (2 == 9), i0, -(p0), (unsigned short)(p2));
+            }
+            if (ga1[4]) { return f0(p4, p1, v0, 27302563463, 388, v0, 831); }
+            i0 = 0;
+            while (i0 < 8) {
+                if (!(v0)) { break; }
+                i0 = i0 + 1;
+            }
+        } else {
+            v0 = v2;
+            if (26) { return (unsigned short)((ga1[3] / (p0 * p0 + 1))); }
+        }
+    }
+    p2 = p2 + ((v2 + 147) / (v2 * v2 + 1));
+    if (798L) { return 7; }
+    switch (f0(p3, p1, p0, ga1[8], 5, p2, 0)) {
+    case 6:
+        if ((((p4 <= ga0[16]) / (p3 * p3 + 1)) / (p4 * p4 + 1))) {
+            if ((p3 + (!(p1) < 567))) {
+                j0 = ((472 || f0(p3, 255, ga0[25], p0, 550, 6, p3)) < (p3 >= 693));
+                p0 = 6;
+            } else {
+                f0(v2, (unsigned long)(i0), (138 && 4), f0(i0, v0, j0, 5, v0, p4, 6ul), (5 + p0), v1, (885 / (p4 * p4 + 1)));
+                v2 = v2 + !((90 / (j0 * j0 + 1)));
+            }
+        }
+        f0((unsigned long)(p1), p3, f0(9, p1, 10u, 833U, v0, ga0[15], p1), (7 != 2), v0, j0, (4 / (v0 * v0 + 1)));
+        break;
+    default:
+        break;
+    }
+    return p2;
+}
+unsigned char f2() {
+    unsigned long v0 = 3;
+    unsigned int v1 = 3;
+    unsigned long v2 = 180;
+    unsigned long v3 = 43;
+    int v4 = 1000000007;
+    unsigned long v5 = 131;
+    int i0 = 565;
+    long j0 = 704L;
+    f1((ga0[14] == ga0[14]), (unsigned int)(v2), (i0 / 8), 5, ga0[16]);
+    if (2) {
+        v1 = 10;
+        v4 = 0;
+        while (v4 < 16) {
+            if ((((9 + ga0[11]) >= (ga1[4] / 1024)) * 2147483647)) {
+                v5 = !((ga0[9] != (832 - v5)));
+                v1 = (f0(84, v4, j0, 65535, 630, v1, i0) || (!(v3) + (v3 + 1)));
+                if ((9 - (v3 && 172))) { return (i0 == (619U || v0)); }
+            } else {
+                f0((v0 * v3), (long)(1046224358301), !(185), (v3 / 8), 9, (v3 / (j0 * j0 + 1)), (v1 - v1));
+            }
+            switch (((81 / 1) + ga0[24])) {
+            case 714:
+                if (-((ga1[1] - 65536))) { break; }
+            case -4:
+                v0 = !((128 >= (v2 + 7)));
+            case 50:
+                if ((10 / 4)) { break; }
+                if ((j0 / (i0 * i0 + 1))) { return f1(v1, 7ul, 1, v0, ga0[12]); }
+                break;
+            case 263:
+                break;
+            case 2:
+                v5 = -(((2 / (v0 * v0 + 1)) / (v5 * v5 + 1)));
+                if (440) { break; }
+                break;
+            case 32:
+                if (-(10)) { break; }
+                if (f1(v0, 145, ga1[2], 20, 274L)) { break; }
+            case 381:
+                break;
+            default:
+            case 15:
+                v5 = !(v1);
+            }
+            if ((unsigned char)((int)((8 - ga1[14])))) {
+                v5 = ((f1(v2, 0, v2, 4294967295, 5) >= (v4 || 6)) + f0(ga1[0], v0, 869531294643, j0, v4, v3, v3));
+                if ((v3 >= v5)) { break; }
+            } else {
+                i0 = (((911 == 5) / (v0 * v0 + 1)) + j0);
+                v0 = (-(3) && ((long)(0) <= f1(v4, 6, v1, ga1[1], v5)));
+                if (127) { break; }
+            }
+            v4 = v4 + 1;
+        }
+        v2 = 0;
+        while (v2 < 17) {
+            if ((((1 != 2) + v1) / (v1 * v1 + 1))) {
+                j0 = (char)(62);
+            } else {
+                v5 = (3 <= f1(2, v5, v4, 0, 522210273245));
+                v1 = v1 + ((ga1[15] / (v5 * v5 + 1)) <= 2);
+            }
+            v1 = f0((291482111852U + v5), 1, !(456), f0(ga0[19], 8, v5, v4, 790116070115, 650, v0), v0, !(v4), 3);
+            v2 = v2 + 1;
+        }
+    } else {
+        for (v4 = 1; v4 < 4; v4 = v4 + 1) {
+            v0 = (f1(v4, 9, 9, 3556428671, ga1[8]) + -((7 == v0)));
+            if (v2) { break; }
+            v1 = 0;
+            while (v1 < 16) {
+                if (!((long)(ga1[3]))) { break; }
+                v1 = v1 + 1;
+            }
+        }
+    }
+    i0 = i0 + 45;
+    v0 = 574;
+    v0 = (((0 / (v1 * v1 + 1)) / 7) <= f1(4, v3, 265, v5, ga1[12]));
+    f1(!(v1), 739, v3, f1(312, 1U, 405233842842, ga0[1], 10), (j0 && ga0[8]));
+    return i0;
+}
+int rec(int n, int acc) {
+    if (n < 5 || n > 18) { return acc + n; }
+    return rec(n - 1, acc * 3 + n);
+}
+int main() {
+    unsigned short v0 = 256;
+    unsigned int v1 = 495279119227;
+    long v2 = 0;
+    unsigned int v3 = 3;
+    int i0 = 9;
+    long j0 = 996;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 593; }
+    int la1[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la1[i0] = i0 * 896636272285; }
+    j0 = 0;
+    while (j0 < 100) {
+        switch (((la0[10] * 2) < v1)) {
+        case 315:
+            v3 = v3 + ((v0 == v2) / (i0 * i0 + 1));
+            v1 = (unsigned short)(((unsigned char)(586301977344) > 256));
+            break;
+        default:
+            v2 = (!((v1 - 65495690016)) && f1(v0, i0, 1000000007, 3, v2));
+            v2 = (9 / 3u);
+            break;
+        case 48:
+            v3 = ((rec(la1[1], la0[23]) / (i0 * i0 + 1)) - 6);
+            break;
+        case 65:
+            break;
+        case 7:
+        case 9:
+            v1 = !(!((v0 > i0)));
+            v3 = v3 + ((866 != 7) >= (i0 > j0));
+            break;
+        }
+        if ((f2() >= !((932 + v3)))) {
+            if (rec(-(v0), (v1 || v0))) {
+                i0 = -(405);
+            }
+            for (v1 = 2; v1 < 17; v1 = v1 + 1) {
+                if (la0[v1] < v2) { v2 = la0[v1]; }
+                if ((unsigned char)((unsigned short)(i0))) { break; }
+                v3 = f0(937, i0, 4, i0, 858, v1, 225);
+            }
+        } else {
+            v3 = v3 + 982;
+        }
+        v2 = v2;
+        j0 = j0 + 1;
+    }
+    switch (rec(684, j0)) {
+    case 6:
+        v3 = f2();
+        break;
+    case 522:
+        break;
+    case -3:
+        switch (((797 || 4294967295) - i0)) {
+        case 388:
+        case 4:
+        case 26:
+            j0 = 0;
+            while (j0 < 8) {
+                if ((v1 > 0)) { break; }
+                if ((unsigned short)((unsigned long)(2))) { break; }
+                v3 = (la1[5] * v3);
+                j0 = j0 + 1;
+            }
+            v1 = (((v3 || 559) >= -(737)) < v1);
+            break;
+        case -2:
+            switch (f1(v0, 4, 994, 1, v3)) {
+            default:
+                break;
+            case 4:
+                la0[17] = (j0 + (long)(527866767282));
+                rec((unsigned char)(v0), (v3 / (v2 * v2 + 1)));
+                break;
+            case 2:
+                i0 = f1((650 + 127), (i0 && v2), f0(v2, v2, 796L, 1000000007, v2, 8, 5), (i0 <= ga1[3]), (v3 || 5));
+            case 9:
+                f2();
+            }
+            break;
+        case 63:
+            switch (573) {
+            case 26:
+                v3 = (((long)(v1) >= (9 / (j0 * j0 + 1))) - (rec(v2, 356) * (8 < v0)));
+                f0((la0[18] > 5), (v2 + 7), (i0 / (v2 * v2 + 1)), (932 >= 5), (v3 >= v3), (285 - v0), v1);
+                break;
+            case 607:
+                j0 = j0;
+                break;
+            case 50:
+                rec((32767 / 16), !(7));
+            case 1:
+                v3 = (char)((la0[7] + 4));
+                f1((5 && ga0[14]), 0ul, (v3 + 0), (unsigned int)(j0), i0);
+            default:
+                break;
+            case 860:
+                break;
+            }
+            break;
+        case -4:
+            rec((0 > 127), (unsigned int)(483278550633u));
+            break;
+        }
+        if (f0((98 / (v1 * v1 + 1)), (unsigned short)(7), 5, 316U, (unsigned long)(la0[22]), rec(7U, 671), (i0 <= v2))) {
+            la1[4] = !(v2);
+            switch (((v2 * 17) + (5 / 10))) {
+            case 15:
+                rec(j0, f2());
+                break;
+            }
+            v1 = 0;
+            while (v1 < 100) {
+                if (v0 >= 0 && v0 < 33) { ga0[v0] = v0; }
+                v1 = v1 + 1;
+            }
+        }
+        break;
+    case -5:
+        j0 = 0;
+        while (j0 < 17) {
+            v1 = v1 + (f0(v0, 326, 5, 1, 65535, 1ul, v1) >= (v2 && v2));
+            j0 = j0 + 1;
+        }
+        if (v3 >= 0 && v3 < 8) { la1[v3] = (short)((255 && 0)); }
+        break;
+    case 824:
+        break;
+    case 491:
+        j0 = (((v1 == 621) / 16) < !((8 + 1)));
+    case 18:
+        f2();
+        v1 = 269u;
+    }
+    la1[2] = 0;
+    f0(-(0), (723 < i0), rec(v3, 63), f2(), 571, (582 < v1), (v2 * i0));
+    v1 = !(377);
+    v1 = !(10);
+    f0((ga1[5] - v1), !(5), (6 <= v2), (v3 / (v1 * v1 + 1)), rec(ga0[17], ga0[30]), la1[6], i0);
+    v3 = (((696 + j0) >= (847 / 4)) / (v3 * v3 + 1));
+    long h = 0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga1[i0]; }
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,3641 @@
+	.section .bss
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.type ga1, @object
+	.size ga1, 64
+	.p2align 5
+ga1:
+	.zero 64
+	.section .text
+	.type f0.constprop.0, @function
+	.type f0, @function
+	.type f0.constprop.1, @function
+	.type f0.constprop.2, @function
+	.type f1, @function
+	.type rec, @function
+	.type f2, @function
+	.global main
+	.type main, @function
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	movw %di, -66(%rbp)
+	movw %dx, -64(%rbp)
+	movq %rcx, -40(%rbp)
+	movw %r9w, -62(%rbp)
+	movq $10, -32(%rbp)
+	movb $3, -68(%rbp)
+	movq $5, -8(%rbp)
+	movb $-104, -67(%rbp)
+	movl $-503529559, -56(%rbp)
+	movl $4294967295, %eax
+	movzwl %r8w, %eax
+	movl %eax, -44(%rbp)
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L1
+.L2:
+	jmp .L0
+.L1:
+	movw $52990, -64(%rbp)
+.L0:
+	movl $0, -60(%rbp)
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	movabsq $7418464825, %rax
+	cmpq %rax, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -52(%rbp)
+	cmpl $406, -56(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	cmpl -56(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -48(%rbp)
+	cmpl $5, -60(%rbp)
+	jae .L4
+	.p2align 4,,10
+.L3:
+	movq $2, -32(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movl -52(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movzwl -62(%rbp), %eax
+	subq -40(%rbp), %rax
+	cmpq $586, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	cmpq $16, -32(%rbp)
+	jge .L6
+	.p2align 4,,10
+.L5:
+	movzbl -68(%rbp), %eax
+	movl ga1+8(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	testb %al, %al
+	je .L7
+	movzwl -64(%rbp), %eax
+	movw %ax, -66(%rbp)
+	movzwl -66(%rbp), %eax
+	subl -60(%rbp), %eax
+	cqo
+	idivq -16(%rbp)
+	testq %rax, %rax
+	je .L9
+.L6:
+	movl ga1+16(%rip), %eax
+	movslq %eax, %rax
+	salq $3, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	cmpl $0, -48(%rbp)
+	je .L24
+	movsbl -67(%rbp), %eax
+	movzwl -62(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, -67(%rbp)
+	movzwl -66(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	testb %al, %al
+	je .L25
+.L4:
+	movq -32(%rbp), %rax
+	movw %ax, -66(%rbp)
+	movzwl -66(%rbp), %eax
+	movw %ax, -66(%rbp)
+	movzwl -66(%rbp), %eax
+	movw %ax, -66(%rbp)
+	movzwl -66(%rbp), %eax
+	movl $0, %eax
+	popq %rbp
+	ret
+.L11:
+.L12:
+.L7:
+.L8:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L15
+	cmpq $9, %rax
+	je .L14
+.L16:
+	jmp .L13
+.L15:
+	cmpw $0, -66(%rbp)
+.L13:
+	addq $1, -32(%rbp)
+	cmpq $16, -32(%rbp)
+	jl .L5
+	jmp .L6
+.L9:
+.L10:
+	movslq -8(%rbp), %rax
+	testq %rax, %rax
+	je .L11
+	jmp .L6
+.L24:
+	movsbl -67(%rbp), %eax
+	cmpl $8, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	subq %rcx, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq -40(%rbp), %rax
+	movw %ax, -62(%rbp)
+.L25:
+	addl $1, -60(%rbp)
+	cmpl $5, -60(%rbp)
+	jb .L3
+	jmp .L4
+.L14:
+	cmpl $0, -44(%rbp)
+	je .L17
+	jmp .L13
+.L22:
+.L23:
+	jmp .L13
+.L26:
+.L27:
+	jmp .L25
+.L17:
+.L18:
+	cmpl $0, -56(%rbp)
+	je .L13
+	cmpw $0, -66(%rbp)
+	jne .L13
+.L21:
+	jmp .L13
+.L19:
+.L20:
+	jmp .L13
+	.size f0.constprop.0, .-f0.constprop.0
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	movw %di, -72(%rbp)
+	movq %rdx, -16(%rbp)
+	movw %cx, -70(%rbp)
+	movq $10, -40(%rbp)
+	movb $3, -74(%rbp)
+	movq $5, -8(%rbp)
+	movb $-104, -73(%rbp)
+	movl $-503529559, -64(%rbp)
+	movl $4294967295, %eax
+	movzwl %r9w, %eax
+	movl %eax, -44(%rbp)
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L29
+.L30:
+	jmp .L28
+.L29:
+	movw $52990, -70(%rbp)
+.L28:
+	movl $0, -68(%rbp)
+	movq %r8, %rax
+	imulq %r8, %rax
+	addq $1, %rax
+	movq %rax, -32(%rbp)
+	movabsq $7418464825, %rax
+	cmpq %rax, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -60(%rbp)
+	movl $1, -56(%rbp)
+	movl $586, -52(%rbp)
+	movl $1, -48(%rbp)
+	xorl %eax, %eax
+	subq -16(%rbp), %rax
+	cmpl $5, -68(%rbp)
+	jae .L32
+	.p2align 4,,10
+.L31:
+	movq $2, -40(%rbp)
+	movq -32(%rbp), %rax
+	movq %rax, -24(%rbp)
+	movl -60(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movl -56(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movzwl 16(%rbp), %eax
+	subq %r8, %rax
+	movl -52(%rbp), %ecx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	cmpq $16, -40(%rbp)
+	jge .L34
+	.p2align 4,,10
+.L33:
+	movzbl -74(%rbp), %eax
+	movl ga1+8(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	testb %al, %al
+	je .L35
+	movzwl -70(%rbp), %eax
+	movw %ax, -72(%rbp)
+	movzwl -72(%rbp), %eax
+	subl -68(%rbp), %eax
+	cqo
+	idivq -24(%rbp)
+	testq %rax, %rax
+	je .L37
+.L34:
+	movl ga1+16(%rip), %eax
+	movslq %eax, %rax
+	salq $3, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	cmpl $406, -64(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	cmpl -64(%rbp), %eax
+	jg .L52
+	movsbl -73(%rbp), %eax
+	movzwl 16(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, -73(%rbp)
+	movzwl -72(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	testb %al, %al
+	je .L53
+	cmpl $0, -48(%rbp)
+.L32:
+	movq -40(%rbp), %rax
+	movw %ax, -72(%rbp)
+	movzwl -72(%rbp), %eax
+	movw %ax, -72(%rbp)
+	movzwl -72(%rbp), %eax
+	movw %ax, -72(%rbp)
+	movzwl -72(%rbp), %eax
+	movl $0, %eax
+	popq %rbp
+	ret
+.L39:
+.L40:
+.L35:
+.L36:
+	movl -8(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L43
+	cmpq $9, %rax
+	je .L42
+.L44:
+	jmp .L41
+.L43:
+	cmpw $0, -72(%rbp)
+.L41:
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jl .L33
+	jmp .L34
+.L37:
+.L38:
+	movslq -16(%rbp), %rax
+	testq %rax, %rax
+	je .L39
+	jmp .L34
+.L52:
+	movsbl -73(%rbp), %eax
+	cmpl $8, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	subq %rcx, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, 16(%rbp)
+	movq %r8, %rax
+	movw %ax, 16(%rbp)
+.L53:
+	addl $1, -68(%rbp)
+	cmpl $5, -68(%rbp)
+	jb .L31
+	jmp .L32
+.L42:
+	cmpl $0, -44(%rbp)
+	je .L45
+	jmp .L41
+.L50:
+.L51:
+	jmp .L41
+.L54:
+.L55:
+	jmp .L53
+.L45:
+.L46:
+	cmpl $0, -64(%rbp)
+	je .L41
+	cmpw $0, -72(%rbp)
+	jne .L41
+.L49:
+	jmp .L41
+.L56:
+.L57:
+	jmp .L32
+.L47:
+.L48:
+	jmp .L41
+	.size f0, .-f0
+	.align 16
+f0.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	movw %di, -42(%rbp)
+	movw %cx, -40(%rbp)
+	movw %r8w, -38(%rbp)
+	movq $10, -16(%rbp)
+	movb $3, -44(%rbp)
+	movq $5, -8(%rbp)
+	movb $-104, -43(%rbp)
+	movl $-503529559, -32(%rbp)
+	movl $4294967295, %eax
+	xorl %eax, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L59
+.L60:
+	jmp .L58
+.L59:
+	movw $52990, -40(%rbp)
+.L58:
+	movl $0, -36(%rbp)
+	movabsq $7418464825, %rax
+	cmpq %rax, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	cmpl $406, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	cmpl -32(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -24(%rbp)
+	cmpl $5, -36(%rbp)
+	jae .L62
+	.p2align 4,,10
+.L61:
+	movq $2, -16(%rbp)
+	movl -28(%rbp), %eax
+	movl %eax, -20(%rbp)
+	movzwl -38(%rbp), %eax
+	subq $29, %rax
+	cmpq $586, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpq $16, -16(%rbp)
+	jge .L64
+	.p2align 4,,10
+.L63:
+	movzbl -44(%rbp), %eax
+	movl ga1+8(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	testb %al, %al
+	je .L65
+	movzwl -40(%rbp), %eax
+	movw %ax, -42(%rbp)
+	movzwl -42(%rbp), %eax
+	subl -36(%rbp), %eax
+	movq %rax, %rcx
+	movabsq $701063907789436641, %rdx
+	imulq %rdx
+	sarq $5, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	je .L67
+.L64:
+	movl ga1+16(%rip), %eax
+	movslq %eax, %rax
+	salq $3, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	cmpl $0, -24(%rbp)
+	je .L82
+	movsbl -43(%rbp), %eax
+	movzwl -38(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, -43(%rbp)
+	movzwl -42(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	testb %al, %al
+	je .L83
+.L62:
+	movq -16(%rbp), %rax
+	movw %ax, -42(%rbp)
+	movzwl -42(%rbp), %eax
+	movw %ax, -42(%rbp)
+	movzwl -42(%rbp), %eax
+	movw %ax, -42(%rbp)
+	movzwl -42(%rbp), %eax
+	movl $0, %eax
+	popq %rbp
+	ret
+.L69:
+.L70:
+.L65:
+.L66:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L73
+	cmpq $9, %rax
+	je .L72
+.L74:
+	jmp .L71
+.L73:
+	cmpw $0, -42(%rbp)
+.L71:
+	addq $1, -16(%rbp)
+	cmpq $16, -16(%rbp)
+	jl .L63
+	jmp .L64
+.L67:
+.L68:
+	movslq -20(%rbp), %rax
+	testq %rax, %rax
+	je .L69
+	jmp .L64
+.L82:
+	movsbl -43(%rbp), %eax
+	cmpl $8, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	subq %rcx, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movw $29, -38(%rbp)
+.L83:
+	addl $1, -36(%rbp)
+	cmpl $5, -36(%rbp)
+	jb .L61
+	jmp .L62
+.L72:
+	cmpl $0, -8(%rbp)
+	je .L75
+	jmp .L71
+.L80:
+.L81:
+	jmp .L71
+.L84:
+.L85:
+	jmp .L83
+.L75:
+.L76:
+	cmpl $0, -32(%rbp)
+	je .L71
+	cmpw $0, -42(%rbp)
+	jne .L71
+.L79:
+	jmp .L71
+.L77:
+.L78:
+	jmp .L71
+	.size f0.constprop.1, .-f0.constprop.1
+	.align 16
+f0.constprop.2:
+	pushq %rbp
+	movq %rsp, %rbp
+	movw %di, -42(%rbp)
+	movw %cx, -40(%rbp)
+	movw %r9w, -38(%rbp)
+	movq $10, -16(%rbp)
+	movb $3, -44(%rbp)
+	movq $5, -8(%rbp)
+	movb $-104, -43(%rbp)
+	movl $-503529559, -32(%rbp)
+	movl $4294967295, %eax
+	movzwl %r8w, %eax
+	movl %eax, -20(%rbp)
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L87
+.L88:
+	jmp .L86
+.L87:
+	movw $52990, -40(%rbp)
+.L86:
+	movl $0, -36(%rbp)
+	movabsq $7418464825, %rax
+	cmpq %rax, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -28(%rbp)
+	cmpl $406, -32(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	cmpl -32(%rbp), %eax
+	setle %al
+	movzbl %al, %eax
+	movl %eax, -24(%rbp)
+	cmpl $5, -36(%rbp)
+	jae .L90
+	.p2align 4,,10
+.L89:
+	movq $2, -16(%rbp)
+	movl -28(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movzwl -38(%rbp), %eax
+	subq $388, %rax
+	cmpq $586, %rax
+	setge %al
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	cmpq $16, -16(%rbp)
+	jge .L92
+	.p2align 4,,10
+.L91:
+	movzbl -44(%rbp), %eax
+	movl ga1+8(%rip), %ecx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	testb %al, %al
+	je .L93
+	movzwl -40(%rbp), %eax
+	movw %ax, -42(%rbp)
+	movzwl -42(%rbp), %eax
+	subl -36(%rbp), %eax
+	movq %rax, %rcx
+	movabsq $2007582150876198437, %rdx
+	imulq %rdx
+	sarq $14, %rdx
+	shrq $63, %rcx
+	leaq (%rdx,%rcx), %rax
+	testq %rax, %rax
+	je .L95
+.L92:
+	movl ga1+16(%rip), %eax
+	movslq %eax, %rax
+	salq $3, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	cmpl $0, -24(%rbp)
+	je .L110
+	movsbl -43(%rbp), %eax
+	movzwl -38(%rbp), %ecx
+	addl %ecx, %eax
+	movb %al, -43(%rbp)
+	movzwl -42(%rbp), %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	testb %al, %al
+	je .L111
+.L90:
+	movq -16(%rbp), %rax
+	movw %ax, -42(%rbp)
+	movzwl -42(%rbp), %eax
+	movw %ax, -42(%rbp)
+	movzwl -42(%rbp), %eax
+	movw %ax, -42(%rbp)
+	movzwl -42(%rbp), %eax
+	movl $0, %eax
+	popq %rbp
+	ret
+.L97:
+.L98:
+.L93:
+.L94:
+	movl $1, %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L101
+	cmpq $9, %rax
+	je .L100
+.L102:
+	jmp .L99
+.L101:
+	cmpw $0, -42(%rbp)
+.L99:
+	addq $1, -16(%rbp)
+	cmpq $16, -16(%rbp)
+	jl .L91
+	jmp .L92
+.L95:
+.L96:
+	movslq -8(%rbp), %rax
+	testq %rax, %rax
+	je .L97
+	jmp .L92
+.L110:
+	movsbl -43(%rbp), %eax
+	cmpl $8, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $6, %eax
+	subq %rcx, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movw $388, -38(%rbp)
+.L111:
+	addl $1, -36(%rbp)
+	cmpl $5, -36(%rbp)
+	jb .L89
+	jmp .L90
+.L100:
+	cmpl $0, -20(%rbp)
+	je .L103
+	jmp .L99
+.L108:
+.L109:
+	jmp .L99
+.L112:
+.L113:
+	jmp .L111
+.L103:
+.L104:
+	cmpl $0, -32(%rbp)
+	je .L99
+	cmpw $0, -42(%rbp)
+	jne .L99
+.L107:
+	jmp .L99
+.L105:
+.L106:
+	jmp .L99
+	.size f0.constprop.2, .-f0.constprop.2
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movw %di, -60(%rbp)
+	movw %si, -58(%rbp)
+	movb %dl, -61(%rbp)
+	movq %rcx, -40(%rbp)
+	movw %r8w, -56(%rbp)
+	movq $9, -24(%rbp)
+	movw $10, -54(%rbp)
+	movl $364229427, -52(%rbp)
+	movq $9, -16(%rbp)
+	cmpw $0, -54(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	cmpw $0, %si
+	je .L114
+	xorl %eax, %eax
+	subq $10, %rax
+	cmpq %rcx, %rax
+	setb %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movswl %r8w, %eax
+	addl %ecx, %eax
+	movw %ax, -56(%rbp)
+	movsbl %dl, %eax
+	movzwl -54(%rbp), %ecx
+	addl %ecx, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	addq %rax, -16(%rbp)
+	jmp .L115
+.L114:
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq -40(%rbp), %rax
+	cmpq %rcx, %rax
+	setbe %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $167, %eax
+	cmpl $184, %eax
+	setl %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jg .L116
+	movswl %r8w, %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movsbl %dl, %eax
+	addl $2, %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movswq %r8w, %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	je .L120
+	movl $841, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L121
+.L122:
+	movl $1, %eax
+.L123:
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	subq %rcx, %rax
+	movq %rax, %rcx
+	movzwl -58(%rbp), %eax
+	addq %rcx, %rax
+	movw %ax, -58(%rbp)
+.L118:
+.L119:
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $804, %eax
+	subl $3, %eax
+	movslq %eax, %rax
+	imulq -40(%rbp), %rax
+	subq %rcx, %rax
+	movw %ax, -60(%rbp)
+.L116:
+.L117:
+	movw $127, -54(%rbp)
+.L115:
+	movq $2, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jae .L125
+	.p2align 4,,10
+.L124:
+	movzwl -58(%rbp), %eax
+	movl ga1+16(%rip), %ecx
+	cmpl %ecx, %eax
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rax, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movb %al, -61(%rbp)
+	movq -40(%rbp), %rax
+	movq %rax, -8(%rbp)
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movswl -56(%rbp), %ecx
+	cmpl %ecx, %eax
+	jge .L126
+	movq -8(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movw %ax, -56(%rbp)
+.L126:
+.L127:
+	movsbl -61(%rbp), %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movl ga1+36(%rip), %ecx
+	cmpl %ecx, %eax
+	setg %al
+	movzbl %al, %eax
+	movb %al, -61(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jb .L124
+.L125:
+	movzwl -58(%rbp), %eax
+	addq %rax, -24(%rbp)
+	cmpw $0, -56(%rbp)
+	je .L128
+	movzwl -58(%rbp), %eax
+	movq %rax, -40(%rbp)
+	movl $5, %eax
+	testq %rax, %rax
+	je .L130
+	movl $0, -52(%rbp)
+	cmpq $1, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -48(%rbp)
+	movl $2, %eax
+	cmpl $9, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	xorl %eax, %eax
+	movswl -60(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -8(%rbp)
+	cmpl $4, -52(%rbp)
+	jge .L133
+	.p2align 4,,10
+.L132:
+	cmpq $0, -40(%rbp)
+	je .L134
+.L133:
+	movl ga1+16(%rip), %eax
+	testl %eax, %eax
+	jne .LB0
+.L138:
+.L139:
+	movl $0, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jge .L141
+	.p2align 4,,10
+.L140:
+	cmpq $0, -32(%rbp)
+	jne .L142
+.L141:
+.L144:
+.L145:
+.L131:
+.L128:
+.L129:
+	movzwl -54(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl $147, %eax
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movsbl -61(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -61(%rbp)
+	movl $798, %eax
+	testq %rax, %rax
+	jne .LB1
+.L146:
+.L147:
+	subq $8, %rsp
+	xorl %eax, %eax
+	pushq %rax
+	movsbl -61(%rbp), %eax
+	movq %rax, %r9
+	movl $5, %eax
+	movq %rax, %r8
+	movl ga1+32(%rip), %eax
+	movq %rax, %rcx
+	movswq -60(%rbp), %rax
+	movq %rax, %rdx
+	movzwl -58(%rbp), %eax
+	movl %eax, -44(%rbp)
+	movq %rax, %rsi
+	movq -40(%rbp), %rax
+	movw %ax, -48(%rbp)
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movslq %eax, %rax
+	cmpq $6, %rax
+	je .L149
+.L150:
+	jmp .L148
+.L142:
+.L143:
+	addl $1, -52(%rbp)
+	cmpl $8, -52(%rbp)
+	jl .L140
+	jmp .L141
+.L149:
+	movswl -56(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga0+64(%rip), %eax
+	cmpl %eax, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	je .L151
+	cmpw $0, -58(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $567, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq -40(%rbp), %rax
+	je .L153
+	movl $472, %eax
+	testl %eax, %eax
+	jne .L155
+	subq $8, %rsp
+	movzwl -48(%rbp), %eax
+	pushq %rax
+	movl $6, %eax
+	movq %rax, %r9
+	movl $550, %eax
+	movq %rax, %r8
+	movswl -60(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+100(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $255, %eax
+	movq %rax, %rsi
+	movzwl -48(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L156
+.L153:
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $885, %eax
+	cltd
+	idivl %ecx
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movswl -60(%rbp), %eax
+	addl $5, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $6, %eax
+	pushq %rax
+	movswl -56(%rbp), %eax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movl $5, %eax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movq %rax, %rsi
+	movl -52(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movq %rax, %rdx
+	movslq -52(%rbp), %rax
+	movq %rax, %rsi
+	movzwl -54(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0.constprop.0
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $90, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -54(%rbp), %eax
+	addl %ecx, %eax
+.L154:
+.L151:
+.L152:
+	subq $8, %rsp
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $4, %eax
+	xorl %edx, %edx
+	divq %rcx
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq %rax, -8(%rbp)
+	pushq %rax
+	movl $7, %eax
+	cmpl $2, %eax
+	setne %al
+	movzbl %al, %eax
+	pushq %rax
+	movzwl -58(%rbp), %eax
+	pushq %rax
+	movl ga0+60(%rip), %eax
+	movq %rax, %r9
+	movq -8(%rbp), %rax
+	movq %rax, %r8
+	movl $833, %eax
+	movq %rax, %rcx
+	movl $10, %eax
+	movq %rax, %rdx
+	movl -44(%rbp), %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movzwl -58(%rbp), %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+.L148:
+	movsbl -61(%rbp), %eax
+.f1_return:
+	leave
+	ret
+.L134:
+.L135:
+	cmpl $0, -48(%rbp)
+	je .L136
+	jmp .L133
+.L136:
+.L137:
+	movsbl -61(%rbp), %eax
+	movq %rax, %r9
+	movl -8(%rbp), %eax
+	movq %rax, %r8
+	movslq -52(%rbp), %rax
+	movq %rax, %rcx
+	movl -44(%rbp), %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl $1, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movw %ax, -56(%rbp)
+	addl $1, -52(%rbp)
+	cmpl $4, -52(%rbp)
+	jl .L132
+	jmp .L133
+.L155:
+	movl $1, %eax
+.L156:
+	cmpq $693, -40(%rbp)
+	setae %cl
+	movzbl %cl, %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	jmp .L154
+.L120:
+	movl $0, %eax
+.L121:
+	popq %rcx
+	addl %ecx, %eax
+	je .L118
+	movl $2, %eax
+	cmpq $599, %rax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %r8
+	movl $64, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbq -61(%rbp), %rax
+	movq %rax, %rdx
+	movl $10, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	movq -24(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.1
+	movl $3, %eax
+	testl %eax, %eax
+	jne .L122
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L123
+.LB1:
+	movl $7, %eax
+	jmp .f1_return
+.LB0:
+	movl $831, %eax
+	movq %rax, %r9
+	movq -32(%rbp), %rax
+	movq %rax, %r8
+	movl $3719, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movzwl -58(%rbp), %eax
+	movq %rax, %rsi
+	movswl -56(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.2
+	jmp .f1_return
+.L130:
+	movzwl -54(%rbp), %eax
+	movq %rax, -32(%rbp)
+	movl $26, %eax
+	testl %eax, %eax
+	je .L144
+	movswl -60(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl ga1+12(%rip), %eax
+	cltd
+	idivl %ecx
+	jmp .f1_return
+	.size f1, .-f1
+	.align 16
+rec:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movl %edi, -8(%rbp)
+	movl %esi, -4(%rbp)
+.rec_entry:
+	cmpl $5, -8(%rbp)
+	jl .L159
+	cmpl $18, -8(%rbp)
+	jg .L159
+.L157:
+.L158:
+	imull $3, -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -8(%rbp)
+	popq %rax
+	movl %eax, -4(%rbp)
+	jmp .rec_entry
+.L159:
+	movl -4(%rbp), %eax
+	addl -8(%rbp), %eax
+	leave
+	ret
+	.size rec, .-rec
+	.align 16
+f2:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $112, %rsp
+	movq $3, -64(%rbp)
+	movl $3, -108(%rbp)
+	movq $180, -56(%rbp)
+	movq $43, -48(%rbp)
+	movq $131, -40(%rbp)
+	movl $565, -100(%rbp)
+	movq $704, -32(%rbp)
+	movl ga0+64(%rip), %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movl -100(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movq %rax, %rdx
+	movq -56(%rbp), %rax
+	movq %rax, %rsi
+	movl ga0+56(%rip), %eax
+	movl ga0+56(%rip), %ecx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	call f1
+	movl $2, %eax
+	testl %eax, %eax
+	je .L160
+	movl $10, -108(%rbp)
+	movl $0, -104(%rbp)
+	movq -48(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpq $0, -48(%rbp)
+	je .L162
+	movl $172, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L163
+.L162:
+	movl $0, %eax
+.L163:
+	movq %rax, %rcx
+	movl $9, %eax
+	subl %ecx, %eax
+	movl %eax, -96(%rbp)
+	movq -48(%rbp), %rax
+	shrq $3, %rax
+	movq %rax, -16(%rbp)
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -8(%rbp)
+	movl $81, %eax
+	movl $1, %ecx
+	cltd
+	idivl %ecx
+	movl %eax, -92(%rbp)
+	movq -56(%rbp), %rax
+	addq $7, %rax
+	cmpq $128, %rax
+	setbe %al
+	movzbl %al, %eax
+	movl %eax, -88(%rbp)
+	movl $10, %eax
+	leal 3(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $2, %ecx
+	movl %ecx, %eax
+	movl %eax, -84(%rbp)
+	xorl %eax, %eax
+	subl $10, %eax
+	movl %eax, -80(%rbp)
+	movl $911, %eax
+	cmpl $5, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -76(%rbp)
+	xorl %eax, %eax
+	subl $3, %eax
+	movl %eax, -72(%rbp)
+	cmpl $16, -104(%rbp)
+	jge .L165
+	.p2align 4,,10
+.L164:
+	movl ga1+16(%rip), %eax
+	leal 1023(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $10, %ecx
+	movl %ecx, %eax
+	movq %rax, %rcx
+	movl ga0+44(%rip), %eax
+	addl $9, %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	imull $2147483647, %eax, %eax
+	testl %eax, %eax
+	je .L166
+	movl $832, %eax
+	subq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl ga0+36(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	subq $8, %rsp
+	movl -100(%rbp), %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	movq %rax, %r9
+	movl $630, %eax
+	movq %rax, %r8
+	movl $65535, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movl -104(%rbp), %eax
+	movq %rax, %rsi
+	movl $84, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	jne .L168
+	cmpq $0, -48(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	addq -24(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L169
+.L168:
+	movl $1, %eax
+.L169:
+	movl %eax, -108(%rbp)
+	cmpl $0, -96(%rbp)
+	je .L167
+	movl $619, %eax
+	testl %eax, %eax
+	jne .L172
+	cmpq $0, -64(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L173
+.L166:
+	subq $8, %rsp
+	movl -108(%rbp), %eax
+	subl -108(%rbp), %eax
+	pushq %rax
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %r9
+	movl $9, %eax
+	movq %rax, %r8
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	movl $185, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $2547305373, %eax
+	movq %rax, %rsi
+	movq -64(%rbp), %rax
+	imulq -48(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+.L167:
+	movl ga0+96(%rip), %eax
+	addl -92(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $50, %rax
+	jge .L183
+	cmpq $15, %rax
+	jge .L184
+	cmpq $-4, %rax
+	je .L176
+	cmpq $2, %rax
+	je .L179
+.L182:
+	cmpl $0, -108(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+.L174:
+	movl $8, %eax
+	movl ga1+56(%rip), %ecx
+	subl %ecx, %eax
+	testb %al, %al
+	je .L198
+	subq $8, %rsp
+	movq -48(%rbp), %rax
+	movw %ax, -68(%rbp)
+	pushq %rax
+	movzwl -68(%rbp), %eax
+	movq %rax, %r9
+	movslq -104(%rbp), %rax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movabsq $869531294643, %rax
+	movq %rax, %rdx
+	movq -64(%rbp), %rax
+	movq %rax, %rsi
+	movl ga1+0(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	pushq %rax
+	cmpl $0, -104(%rbp)
+	jne .L200
+	movl $6, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L201
+.L200:
+	movl $1, %eax
+.L201:
+	pushq %rax
+	movl $5, %eax
+	movq %rax, %r8
+	movl $4294967295, %eax
+	movq %rax, %rcx
+	movq -56(%rbp), %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movq -56(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movq -48(%rbp), %rax
+	cmpq -40(%rbp), %rax
+	jb .L202
+.L165:
+	movq $0, -56(%rbp)
+	movl $1, %eax
+	cmpl $2, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -68(%rbp)
+	cmpq $17, -56(%rbp)
+	jae .L161
+	.p2align 4,,10
+.L208:
+	movl -108(%rbp), %eax
+	imull -108(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	addl -108(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	testl %eax, %eax
+	je .L210
+	movq $62, -32(%rbp)
+	jmp .L211
+.L210:
+	movl $26589, %eax
+	movq %rax, %r8
+	xorl %eax, %eax
+	movq %rax, %rcx
+	movl -104(%rbp), %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $2, %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	cmpl $3, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl ga1+60(%rip), %eax
+	movslq %eax, %rax
+	xorl %edx, %edx
+	divq %rcx
+	cmpq $2, %rax
+	setbe %al
+	movzbl %al, %eax
+	addl %eax, -108(%rbp)
+.L211:
+	subq $8, %rsp
+	movl $3, %eax
+	pushq %rax
+	cmpl $0, -104(%rbp)
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -64(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movq -64(%rbp), %rax
+	pushq %rax
+	movl $650, %eax
+	movq %rax, %r9
+	movabsq $790116070115, %rax
+	movq %rax, %r8
+	movl -104(%rbp), %eax
+	movq %rax, %rcx
+	movq -40(%rbp), %rax
+	movq %rax, %rdx
+	movl $8, %eax
+	movq %rax, %rsi
+	movl ga0+76(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movq %rax, %rcx
+	movl $456, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movabsq $291482111852, %rax
+	addq -40(%rbp), %rax
+	movq %rax, %rdi
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movl %eax, -108(%rbp)
+	addq $1, -56(%rbp)
+	cmpq $17, -56(%rbp)
+	jb .L208
+.L209:
+	jmp .L161
+.L160:
+	movl $1, -104(%rbp)
+	cmpl $4, -104(%rbp)
+	jge .L213
+	.p2align 4,,10
+.L212:
+	xorl %eax, %eax
+	cmpq $7, -64(%rbp)
+	sete %cl
+	movzbl %cl, %ecx
+	subl %ecx, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl ga1+32(%rip), %eax
+	movq %rax, %r8
+	movl $3556428671, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movl -104(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzbl %al, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	cmpq $0, -56(%rbp)
+	je .L214
+.L213:
+.L161:
+	addl $45, -100(%rbp)
+	movl ga1+48(%rip), %eax
+	movq %rax, %r8
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movq -48(%rbp), %rax
+	movq %rax, %rsi
+	movl $4, %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	pushq %rax
+	movl -108(%rbp), %eax
+	imull -108(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movabsq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movl %edx, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $0, -32(%rbp)
+	je .L220
+	movl ga0+32(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L221
+.L220:
+	movl $0, %eax
+.L221:
+	pushq %rax
+	subq $8, %rsp
+	movl $10, %eax
+	movq %rax, %r8
+	movl ga0+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $-102, %eax
+	movq %rax, %rdx
+	movl $1, %eax
+	movq %rax, %rsi
+	movl $312, %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movq -48(%rbp), %rax
+	movq %rax, %rdx
+	movl $739, %eax
+	movq %rax, %rsi
+	cmpl $0, -108(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %r8
+	call f1
+	movl -100(%rbp), %eax
+.f2_return:
+	leave
+	ret
+.L214:
+.L215:
+	movl $0, -108(%rbp)
+	cmpl $16, -108(%rbp)
+	jae .L217
+	.p2align 4,,10
+.L216:
+	movl ga1+12(%rip), %eax
+	movslq %eax, %rax
+	testq %rax, %rax
+	jne .L218
+.L217:
+	addl $1, -104(%rbp)
+	cmpl $4, -104(%rbp)
+	jl .L212
+	jmp .L213
+.L218:
+.L219:
+	addl $1, -108(%rbp)
+	cmpl $16, -108(%rbp)
+	jb .L216
+	jmp .L217
+.L183:
+	cmpq $381, %rax
+	jge .L185
+	cmpq $50, %rax
+	je .L177
+	cmpq $263, %rax
+	je .L174
+	jmp .L182
+.L198:
+	movq -32(%rbp), %rax
+	pushq %rax
+	movq -64(%rbp), %rax
+	imulq -64(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -76(%rbp), %rax
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	addq %rcx, %rax
+	movl %eax, -100(%rbp)
+	cmpl $0, -72(%rbp)
+	je .L204
+	movq -40(%rbp), %rax
+	movq %rax, %r8
+	movl ga1+4(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl -108(%rbp), %eax
+	movq %rax, %rdx
+	movl $6, %eax
+	movq %rax, %rsi
+	movl -104(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	testq %rax, %rax
+	setge %al
+	movzbl %al, %eax
+	jmp .L205
+.L204:
+	movl $0, %eax
+.L205:
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+	movl $127, %eax
+	testl %eax, %eax
+	je .L206
+	jmp .L165
+.L202:
+.L203:
+.L206:
+.L207:
+.L199:
+	addl $1, -104(%rbp)
+	cmpl $16, -104(%rbp)
+	jl .L164
+	jmp .L165
+.L170:
+.L171:
+	jmp .L167
+.L184:
+	cmpq $15, %rax
+	je .L182
+	cmpq $32, %rax
+	je .L180
+	jmp .L182
+.L185:
+	cmpq $381, %rax
+	je .L174
+	cmpq $714, %rax
+	je .L175
+	jmp .L182
+.L186:
+.L187:
+.L176:
+	cmpl $0, -88(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -64(%rbp)
+.L177:
+	cmpl $0, -84(%rbp)
+	je .L188
+	jmp .L174
+.L188:
+.L189:
+	movl -100(%rbp), %eax
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB2
+.L190:
+.L191:
+	jmp .L174
+.L196:
+.L197:
+.L181:
+	jmp .L174
+.L175:
+	movl ga1+4(%rip), %eax
+	subl $65536, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L186
+	jmp .L174
+.L178:
+	jmp .L174
+.L179:
+	movq -40(%rbp), %rax
+	imulq -40(%rbp), %rax
+	addq $1, %rax
+	pushq %rax
+	movq -64(%rbp), %rax
+	imulq -64(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $2, %eax
+	xorl %edx, %edx
+	divq %rcx
+	popq %rcx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -40(%rbp)
+	movl $440, %eax
+	testl %eax, %eax
+	je .L174
+	jmp .L174
+.L180:
+	cmpl $0, -80(%rbp)
+	je .L194
+	jmp .L174
+.L192:
+.L193:
+	jmp .L174
+.L194:
+.L195:
+	movl $274, %eax
+	movq %rax, %r8
+	movl $20, %eax
+	movq %rax, %rcx
+	movl ga1+8(%rip), %eax
+	movq %rax, %rdx
+	movl $145, %eax
+	movq %rax, %rsi
+	movq -64(%rbp), %rax
+	movq %rax, %rdi
+	call f1
+	testb %al, %al
+	je .L174
+	jmp .L174
+.L172:
+	movl $1, %eax
+.L173:
+	cmpl %eax, -100(%rbp)
+	sete %al
+	movzbl %al, %eax
+	jmp .f2_return
+.LB2:
+	movl ga0+48(%rip), %eax
+	movq %rax, %r8
+	movq -64(%rbp), %rax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -108(%rbp), %eax
+	movq %rax, %rdi
+	leave
+	jmp f1
+	.size f2, .-f2
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $560, %rsp
+	movw $256, -2(%rbp)
+	movl $1357880187, -8(%rbp)
+	movq $0, -16(%rbp)
+	movl $3, -20(%rbp)
+	movl $9, -24(%rbp)
+	movq $996, -32(%rbp)
+	movl $0, -24(%rbp)
+	imull $593, -24(%rbp), %eax
+	subl $593, %eax
+	movl %eax, -180(%rbp)
+	cmpl $33, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -184(%rbp)
+	testl %eax, %eax
+	je .L222
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L225
+	.p2align 4,,10
+.L224:
+	addl $593, -180(%rbp)
+	movslq -24(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $593, -180(%rbp)
+	movslq -24(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $593, -180(%rbp)
+	movslq -24(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	addl $593, -180(%rbp)
+	movslq -24(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -192(%rbp)
+	jne .L224
+.L225:
+.L222:
+.L223:
+	cmpl $33, -24(%rbp)
+	jge .L227
+	.p2align 4,,10
+.L226:
+	addl $593, -180(%rbp)
+	movslq -24(%rbp), %rax
+	movl -180(%rbp), %ecx
+	movl %ecx, -176(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L226
+.L227:
+	movl $0, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -228(%rbp)
+	testl %eax, %eax
+	je .L228
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -240(%rbp)
+	cmpq $0, -240(%rbp)
+	je .L231
+	.p2align 4,,10
+.L230:
+	movslq -24(%rbp), %rax
+	movq %rax, -248(%rbp)
+	movabsq $896636272285, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -248(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -256(%rbp)
+	movabsq $896636272285, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -256(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -264(%rbp)
+	movabsq $896636272285, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -264(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movq %rax, -272(%rbp)
+	movabsq $896636272285, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -272(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -240(%rbp)
+	jne .L230
+.L231:
+.L228:
+.L229:
+	cmpl $8, -24(%rbp)
+	jge .L233
+	.p2align 4,,10
+.L232:
+	movslq -24(%rbp), %rax
+	movq %rax, -280(%rbp)
+	movabsq $896636272285, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -280(%rbp), %rax
+	movl %ecx, -224(%rbp,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L232
+.L233:
+	movq $0, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jge .L235
+	.p2align 4,,10
+.L234:
+	movl -136(%rbp), %eax
+	sall $1, %eax
+	cmpl -8(%rbp), %eax
+	setb %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $48, %rax
+	jge .L242
+	cmpq $7, %rax
+	je .L241
+	cmpq $9, %rax
+	je .L241
+.L238:
+	movl -8(%rbp), %eax
+	movabsq $65495690016, %rcx
+	subq %rcx, %rax
+	jne .L243
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl $3, %eax
+	movq %rax, %rcx
+	movl $7, %eax
+	movq %rax, %rdx
+	movl -24(%rbp), %eax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	testb %al, %al
+	setne %al
+	movzbl %al, %eax
+	jmp .L244
+.L242:
+	cmpq $48, %rax
+	je .L239
+	cmpq $65, %rax
+	je .L236
+	cmpq $315, %rax
+	je .L237
+	jmp .L238
+.L241:
+	movzwl -2(%rbp), %eax
+	cmpl -24(%rbp), %eax
+	setg %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	movslq -24(%rbp), %rax
+	cmpq -32(%rbp), %rax
+	setg %al
+	movzbl %al, %eax
+	cmpl $1, %eax
+	setle %al
+	movzbl %al, %eax
+	addl %eax, -20(%rbp)
+.L236:
+	movl -20(%rbp), %eax
+	addl $932, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	call f2
+	addq $8, %rsp
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	jl .L257
+	xorl %eax, %eax
+	movzwl -2(%rbp), %ecx
+	subl %ecx, %eax
+	movl %eax, -308(%rbp)
+	cmpl $0, -8(%rbp)
+	jne .L262
+	cmpw $0, -2(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L263
+.L262:
+	movl $1, %eax
+.L263:
+	movl %eax, -312(%rbp)
+	cmpl $5, -308(%rbp)
+	jl .L266
+	cmpl $18, -308(%rbp)
+	jle .L264
+.L266:
+	movl -312(%rbp), %eax
+	addl -308(%rbp), %eax
+.L261:
+	testl %eax, %eax
+	je .L259
+	movl $-405, -24(%rbp)
+.L259:
+.L260:
+	movl $2, -8(%rbp)
+	cmpl $17, -8(%rbp)
+	jae .L276
+	.p2align 4,,10
+.L275:
+	movl -8(%rbp), %eax
+	movq %rax, -336(%rbp)
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	cmpq -16(%rbp), %rax
+	jge .L277
+	movq -336(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+.L277:
+.L278:
+	movl -24(%rbp), %eax
+	movw %ax, -338(%rbp)
+	testb %al, %al
+	je .L279
+.L276:
+.L258:
+	addq $1, -32(%rbp)
+	cmpq $100, -32(%rbp)
+	jl .L234
+.L235:
+	movq -32(%rbp), %rax
+	movl %eax, -344(%rbp)
+	movl -344(%rbp), %eax
+	addl $684, %eax
+.L289:
+	movslq %eax, %rax
+	cmpq $18, %rax
+	jge .L290
+	cmpq $-5, %rax
+	je .L285
+	cmpq $-3, %rax
+	je .L284
+	cmpq $6, %rax
+	je .L282
+	jmp .L281
+.L279:
+.L280:
+	subq $8, %rsp
+	movl $225, %eax
+	pushq %rax
+	movl -8(%rbp), %eax
+	movq %rax, %r9
+	movl $858, %eax
+	movq %rax, %r8
+	movzwl -338(%rbp), %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	movq %rax, %rdx
+	movl -24(%rbp), %eax
+	movq %rax, %rsi
+	movl $937, %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	movl %eax, -20(%rbp)
+	addl $1, -8(%rbp)
+	cmpl $17, -8(%rbp)
+	jb .L275
+	jmp .L276
+.L257:
+	addl $982, -20(%rbp)
+	jmp .L258
+.L239:
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movl -220(%rbp), %eax
+	movl %eax, -284(%rbp)
+	movl -84(%rbp), %eax
+	movl %eax, -288(%rbp)
+	cmpl $5, -284(%rbp)
+	jl .L248
+	cmpl $18, -284(%rbp)
+	jle .L246
+.L248:
+	movl -288(%rbp), %eax
+	addl -284(%rbp), %eax
+.L245:
+	popq %rcx
+	cltd
+	idivl %ecx
+	subl $6, %eax
+	movl %eax, -20(%rbp)
+	jmp .L236
+.L243:
+	movl $0, %eax
+.L244:
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	movq $3, -16(%rbp)
+	jmp .L236
+.L290:
+	cmpq $522, %rax
+	jge .L291
+	cmpq $18, %rax
+	je .L288
+	cmpq $491, %rax
+	je .L287
+	jmp .L281
+.L240:
+	jmp .L236
+.L264:
+.L265:
+	movl -308(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -316(%rbp)
+	imull $3, -312(%rbp), %eax
+	addl -308(%rbp), %eax
+	movl %eax, -320(%rbp)
+	cmpl $5, -316(%rbp)
+	jl .L270
+	cmpl $18, -316(%rbp)
+	jle .L268
+.L270:
+	movl -320(%rbp), %eax
+	addl -316(%rbp), %eax
+.L267:
+	jmp .L261
+.L291:
+	cmpq $522, %rax
+	je .L281
+	cmpq $824, %rax
+	je .L281
+	jmp .L281
+.L285:
+	movq $0, -32(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L381
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L382
+.L381:
+	movl $0, %eax
+.L382:
+	movl %eax, -444(%rbp)
+	cmpq $17, -32(%rbp)
+	jge .L383
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movl $17, %eax
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -456(%rbp)
+	cmpq $0, -456(%rbp)
+	je .L386
+	.p2align 4,,10
+.L385:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movl $65535, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $326, %eax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	cmpl -444(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	addl %eax, -8(%rbp)
+	addq $1, -32(%rbp)
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movl $65535, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $326, %eax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	cmpl -444(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	addl %eax, -8(%rbp)
+	addq $1, -32(%rbp)
+	subq $1, -456(%rbp)
+	jne .L385
+.L386:
+.L383:
+.L384:
+	cmpq $17, -32(%rbp)
+	jge .L388
+	.p2align 4,,10
+.L387:
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	pushq %rax
+	movl $1, %eax
+	movq %rax, %r9
+	movl $65535, %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movl $326, %eax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	movzwl %ax, %eax
+	cmpl -444(%rbp), %eax
+	setge %al
+	movzbl %al, %eax
+	addl %eax, -8(%rbp)
+	addq $1, -32(%rbp)
+	cmpq $17, -32(%rbp)
+	jl .L387
+.L388:
+	cmpl $0, -20(%rbp)
+	jb .L281
+	cmpl $8, -20(%rbp)
+	jae .L281
+	movl -20(%rbp), %eax
+	movl $0, -224(%rbp,%rax,4)
+.L389:
+.L390:
+	jmp .L281
+.L363:
+	movl $0, %eax
+.L364:
+	movl %eax, -428(%rbp)
+	cmpl $100, -8(%rbp)
+	jae .L365
+	movl $100, %eax
+	movl -8(%rbp), %ecx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -440(%rbp)
+	cmpq $0, -440(%rbp)
+	je .L368
+	.p2align 4,,10
+.L367:
+	cmpl $0, -428(%rbp)
+	je .L369
+	movzwl -2(%rbp), %eax
+	movl -432(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L369:
+.L370:
+	addl $1, -8(%rbp)
+	cmpl $0, -428(%rbp)
+	je .L371
+	movzwl -2(%rbp), %eax
+	movl -432(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L371:
+.L372:
+	addl $1, -8(%rbp)
+	cmpl $0, -428(%rbp)
+	je .L373
+	movzwl -2(%rbp), %eax
+	movl -432(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L373:
+.L374:
+	addl $1, -8(%rbp)
+	cmpl $0, -428(%rbp)
+	je .L375
+	movzwl -2(%rbp), %eax
+	movl -432(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L375:
+.L376:
+	addl $1, -8(%rbp)
+	subq $1, -440(%rbp)
+	jne .L367
+.L368:
+.L365:
+.L366:
+	cmpl $100, -8(%rbp)
+	jae .L378
+	.p2align 4,,10
+.L377:
+	cmpl $0, -428(%rbp)
+	je .L379
+	movzwl -2(%rbp), %eax
+	movl -432(%rbp), %ecx
+	leaq ga0(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+.L379:
+.L380:
+	addl $1, -8(%rbp)
+	cmpl $100, -8(%rbp)
+	jb .L377
+.L378:
+.L347:
+.L348:
+.L281:
+	movl $0, -216(%rbp)
+	subq $8, %rsp
+	movslq -24(%rbp), %rax
+	movq %rax, -488(%rbp)
+	imulq -16(%rbp), %rax
+	pushq %rax
+	cmpl $582, -8(%rbp)
+	seta %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $571, %eax
+	pushq %rax
+	call f2
+	movzbl %al, %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	movl %eax, -460(%rbp)
+	cmpl $5, -460(%rbp)
+	jl .L394
+	cmpl $18, -460(%rbp)
+	jle .L392
+.L394:
+	movl -460(%rbp), %eax
+	addl $63, %eax
+.L391:
+	movslq %eax, %rax
+	movq %rax, %rdx
+	cmpl $723, -24(%rbp)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rsi
+	xorl %eax, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl $0, -8(%rbp)
+	movl $0, -8(%rbp)
+	subq $8, %rsp
+	movl -24(%rbp), %eax
+	pushq %rax
+	movl -200(%rbp), %eax
+	pushq %rax
+	movl ga0+68(%rip), %eax
+	movl %eax, -492(%rbp)
+	movl ga0+120(%rip), %eax
+	movl %eax, -496(%rbp)
+	cmpl $5, -492(%rbp)
+	jl .L406
+	cmpl $18, -492(%rbp)
+	jle .L404
+.L406:
+	movl -496(%rbp), %eax
+	addl -492(%rbp), %eax
+.L403:
+	movslq %eax, %rax
+	movq %rax, %r8
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rcx
+	cmpq $6, -16(%rbp)
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl ga1+20(%rip), %eax
+	subl -8(%rbp), %eax
+	movq %rax, %rdi
+	popq %r9
+	call f0
+	addq $16, %rsp
+	movl -20(%rbp), %eax
+	imull -20(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	addq $696, %rax
+	cmpq $211, %rax
+	setge %al
+	movzbl %al, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movl %eax, -20(%rbp)
+	movq $0, -520(%rbp)
+	imulq $31, -520(%rbp), %rax
+	movzwl -2(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	imulq $31, -520(%rbp), %rax
+	movl -8(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	imulq $31, -520(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -520(%rbp)
+	imulq $31, -520(%rbp), %rax
+	movl -20(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	imulq $31, -520(%rbp), %rax
+	addq -488(%rbp), %rax
+	movq %rax, -520(%rbp)
+	imulq $31, -520(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -520(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $0, -184(%rbp)
+	je .L415
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -528(%rbp)
+	cmpq $0, -528(%rbp)
+	je .L418
+	.p2align 4,,10
+.L417:
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -528(%rbp)
+	jne .L417
+.L418:
+.L415:
+.L416:
+	cmpl $33, -24(%rbp)
+	jge .L420
+	.p2align 4,,10
+.L419:
+	movslq -24(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L419
+.L420:
+	movl $0, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jge .L421
+	movl $16, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -536(%rbp)
+	cmpq $0, -536(%rbp)
+	je .L424
+	.p2align 4,,10
+.L423:
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -536(%rbp)
+	jne .L423
+.L424:
+.L421:
+.L422:
+	cmpl $16, -24(%rbp)
+	jge .L426
+	.p2align 4,,10
+.L425:
+	movslq -24(%rbp), %rax
+	leaq ga1(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $16, -24(%rbp)
+	jl .L425
+.L426:
+	movl $0, -24(%rbp)
+	cmpl $0, -184(%rbp)
+	je .L427
+	movl $33, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -544(%rbp)
+	cmpq $0, -544(%rbp)
+	je .L430
+	.p2align 4,,10
+.L429:
+	movslq -24(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -544(%rbp)
+	jne .L429
+.L430:
+.L427:
+.L428:
+	cmpl $33, -24(%rbp)
+	jge .L432
+	.p2align 4,,10
+.L431:
+	movslq -24(%rbp), %rax
+	movl -176(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $33, -24(%rbp)
+	jl .L431
+.L432:
+	movl $0, -24(%rbp)
+	cmpl $0, -228(%rbp)
+	je .L433
+	movl $8, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -552(%rbp)
+	cmpq $0, -552(%rbp)
+	je .L436
+	.p2align 4,,10
+.L435:
+	movslq -24(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	subq $1, -552(%rbp)
+	jne .L435
+.L436:
+.L433:
+.L434:
+	cmpl $8, -24(%rbp)
+	jge .L438
+	.p2align 4,,10
+.L437:
+	movslq -24(%rbp), %rax
+	movl -224(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -520(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $8, -24(%rbp)
+	jl .L437
+.L438:
+	movq -520(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -520(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -520(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -520(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -520(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -520(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -520(%rbp)
+	movq -520(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L392:
+.L393:
+	movl -460(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -464(%rbp)
+	movl $63, %eax
+	imull $3, %eax, %eax
+	addl -460(%rbp), %eax
+	movl %eax, -468(%rbp)
+	cmpl $5, -464(%rbp)
+	jl .L398
+	cmpl $18, -464(%rbp)
+	jle .L396
+.L398:
+	movl -468(%rbp), %eax
+	addl -464(%rbp), %eax
+.L395:
+	jmp .L391
+.L404:
+.L405:
+	movl -492(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -500(%rbp)
+	imull $3, -496(%rbp), %eax
+	addl -492(%rbp), %eax
+	movl %eax, -504(%rbp)
+	cmpl $5, -500(%rbp)
+	jl .L410
+	cmpl $18, -500(%rbp)
+	jle .L408
+.L410:
+	movl -504(%rbp), %eax
+	addl -500(%rbp), %eax
+.L407:
+	jmp .L403
+.L237:
+	movl -24(%rbp), %eax
+	imull -24(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movzwl -2(%rbp), %eax
+	cmpq -16(%rbp), %rax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	addl %eax, -20(%rbp)
+	movl $0, -8(%rbp)
+	jmp .L236
+.L246:
+.L247:
+	movl -284(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -292(%rbp)
+	imull $3, -288(%rbp), %eax
+	addl -284(%rbp), %eax
+	movl %eax, -296(%rbp)
+	cmpl $5, -292(%rbp)
+	jl .L252
+	cmpl $18, -292(%rbp)
+	jle .L250
+.L252:
+	movl -296(%rbp), %eax
+	addl -292(%rbp), %eax
+.L249:
+	jmp .L245
+.L287:
+	cmpl $621, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	testl %eax, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+.L288:
+	call f2
+	movl $269, -8(%rbp)
+	jmp .L281
+.L283:
+	jmp .L281
+.L284:
+	movl $1, %eax
+	subl -24(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $26, %rax
+	jge .L297
+	cmpq $-4, %rax
+	je .L296
+	cmpq $-2, %rax
+	je .L294
+	cmpq $4, %rax
+	je .L293
+	jmp .L292
+.L268:
+.L269:
+	movl -316(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -324(%rbp)
+	imull $3, -320(%rbp), %eax
+	addl -316(%rbp), %eax
+	movl %eax, -328(%rbp)
+	cmpl $5, -324(%rbp)
+	jl .L274
+	cmpl $18, -324(%rbp)
+	jle .L272
+.L274:
+	movl -328(%rbp), %eax
+	addl -324(%rbp), %eax
+.L271:
+	jmp .L261
+.L396:
+.L397:
+	movl -464(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -472(%rbp)
+	imull $3, -468(%rbp), %eax
+	addl -464(%rbp), %eax
+	movl %eax, -476(%rbp)
+	cmpl $5, -472(%rbp)
+	jl .L402
+	cmpl $18, -472(%rbp)
+	jle .L400
+.L402:
+	movl -476(%rbp), %eax
+	addl -472(%rbp), %eax
+.L399:
+	jmp .L391
+.L408:
+.L409:
+	movl -500(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -508(%rbp)
+	imull $3, -504(%rbp), %eax
+	addl -500(%rbp), %eax
+	movl %eax, -512(%rbp)
+	cmpl $5, -508(%rbp)
+	jl .L414
+	cmpl $18, -508(%rbp)
+	jle .L412
+.L414:
+	movl -512(%rbp), %eax
+	addl -508(%rbp), %eax
+.L411:
+	jmp .L403
+.L282:
+	call f2
+	movzbl %al, %eax
+	movl %eax, -20(%rbp)
+	jmp .L281
+.L297:
+	cmpq $26, %rax
+	je .L293
+	cmpq $63, %rax
+	je .L295
+	cmpq $388, %rax
+	je .L293
+	jmp .L292
+.L286:
+	jmp .L281
+.L250:
+.L251:
+	movl -292(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -300(%rbp)
+	imull $3, -296(%rbp), %eax
+	addl -292(%rbp), %eax
+	movl %eax, -304(%rbp)
+	cmpl $5, -300(%rbp)
+	jl .L256
+	cmpl $18, -300(%rbp)
+	jle .L254
+.L256:
+	movl -304(%rbp), %eax
+	addl -300(%rbp), %eax
+.L253:
+	jmp .L245
+.L293:
+	movq $0, -32(%rbp)
+	cmpq $8, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -348(%rbp)
+	cmpl $0, -8(%rbp)
+	seta %al
+	movzbl %al, %eax
+	movl %eax, -352(%rbp)
+	cmpl $0, -348(%rbp)
+	je .L299
+	.p2align 4,,10
+.L298:
+	cmpl $0, -352(%rbp)
+.L299:
+	cmpl $0, -20(%rbp)
+	jne .L302
+	movl $559, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L303
+.L302:
+	movl $1, %eax
+.L303:
+	cmpl $-737, %eax
+	setge %al
+	movzbl %al, %eax
+	cmpl -8(%rbp), %eax
+	setb %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+.L292:
+	subq $8, %rsp
+	movslq -24(%rbp), %rax
+	cmpq -16(%rbp), %rax
+	setle %al
+	movzbl %al, %eax
+	pushq %rax
+	movl $18207, %eax
+	pushq %rax
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $316, %eax
+	pushq %rax
+	movl $5, %eax
+	pushq %rax
+	movl $7, %eax
+	movq %rax, %rsi
+	movl -8(%rbp), %eax
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $98, %eax
+	xorl %edx, %edx
+	divl %ecx
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	testw %ax, %ax
+	je .L347
+	cmpq $0, -16(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -208(%rbp)
+	imulq $17, -16(%rbp), %rax
+	cmpq $15, %rax
+	je .L350
+.L349:
+	movl $0, -8(%rbp)
+	movzwl -2(%rbp), %eax
+	movl %eax, -432(%rbp)
+	testl %eax, %eax
+	jl .L363
+	cmpl $33, -432(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .L364
+.L300:
+.L301:
+	jmp .L299
+.L350:
+	movq -32(%rbp), %rax
+	movl %eax, -404(%rbp)
+	call f2
+	movzbl %al, %eax
+	movl %eax, -408(%rbp)
+	cmpl $5, -404(%rbp)
+	jl .L354
+	cmpl $18, -404(%rbp)
+	jle .L352
+.L354:
+	movl -408(%rbp), %eax
+	addl -404(%rbp), %eax
+.L351:
+	jmp .L349
+.L296:
+	movl $-2052753815, %eax
+.L346:
+	jmp .L292
+.L272:
+.L273:
+	imull $3, -328(%rbp), %eax
+	addl -324(%rbp), %eax
+	movq %rax, %rsi
+	movl -324(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L261
+.L352:
+.L353:
+	movl -404(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -412(%rbp)
+	imull $3, -408(%rbp), %eax
+	addl -404(%rbp), %eax
+	movl %eax, -416(%rbp)
+	cmpl $5, -412(%rbp)
+	jl .L358
+	cmpl $18, -412(%rbp)
+	jle .L356
+.L358:
+	movl -416(%rbp), %eax
+	addl -412(%rbp), %eax
+.L355:
+	jmp .L349
+.L400:
+.L401:
+	subq $8, %rsp
+	imull $3, -476(%rbp), %eax
+	addl -472(%rbp), %eax
+	movq %rax, %rsi
+	movl -472(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	jmp .L391
+.L412:
+.L413:
+	subq $8, %rsp
+	imull $3, -512(%rbp), %eax
+	addl -508(%rbp), %eax
+	movq %rax, %rsi
+	movl -508(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	jmp .L403
+.L294:
+	movl -20(%rbp), %eax
+	movq %rax, %r8
+	movl $1, %eax
+	movq %rax, %rcx
+	movl $-30, %eax
+	movq %rax, %rdx
+	movl $4, %eax
+	movq %rax, %rsi
+	movzwl -2(%rbp), %eax
+	movq %rax, %rdi
+	call f1
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $2, %rax
+	je .L307
+	cmpq $4, %rax
+	je .L306
+	cmpq $9, %rax
+	je .L308
+.L305:
+	jmp .L292
+.L295:
+	movl $573, %eax
+	movslq %eax, %rax
+	cmpq $50, %rax
+	jge .L332
+	cmpq $1, %rax
+	je .L329
+	cmpq $26, %rax
+	je .L326
+	jmp .L292
+.L254:
+.L255:
+	subq $8, %rsp
+	imull $3, -304(%rbp), %eax
+	addl -300(%rbp), %eax
+	movq %rax, %rsi
+	movl -300(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	jmp .L245
+.L307:
+	cmpl $0, -20(%rbp)
+	jne .L321
+	movl $5, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L322
+.L321:
+	movl $1, %eax
+.L322:
+	pushq %rax
+	movl ga1+12(%rip), %eax
+	cmpl %eax, -24(%rbp)
+	setle %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $5, %eax
+	pushq %rax
+	movl $8, %eax
+	movq %rax, %r9
+	movq -16(%rbp), %rax
+	movq %rax, %r8
+	movl $51719, %eax
+	movq %rax, %rcx
+	movl $796, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movq -16(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	addq $16, %rsp
+	pushq %rax
+	cmpl $0, -24(%rbp)
+	je .L323
+	cmpq $0, -16(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L324
+.L323:
+	movl $0, %eax
+.L324:
+	movq %rax, %rsi
+	movl $777, %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f1
+	movzbl %al, %eax
+	movl %eax, -24(%rbp)
+.L308:
+	call f2
+.L304:
+	jmp .L292
+.L332:
+	cmpq $50, %rax
+	je .L328
+	cmpq $607, %rax
+	je .L292
+	cmpq $860, %rax
+	je .L292
+	jmp .L292
+.L328:
+	movl $2047, %eax
+.L345:
+.L329:
+	movl -148(%rbp), %eax
+	addl $4, %eax
+	movsbl %al, %eax
+	movl %eax, -20(%rbp)
+	movl -24(%rbp), %eax
+	movq %rax, %r8
+	movq -32(%rbp), %rax
+	movl %eax, %eax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movq %rax, %rsi
+	movl ga0+56(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f1
+.L330:
+.L325:
+	jmp .L292
+.L356:
+.L357:
+	movl -412(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -420(%rbp)
+	imull $3, -416(%rbp), %eax
+	addl -412(%rbp), %eax
+	movl %eax, -424(%rbp)
+	cmpl $5, -420(%rbp)
+	jl .L362
+	cmpl $18, -420(%rbp)
+	jle .L360
+.L362:
+	movl -424(%rbp), %eax
+	addl -420(%rbp), %eax
+.L359:
+	jmp .L349
+.L306:
+	movabsq $527866767282, %rax
+	addq -32(%rbp), %rax
+	movl %eax, -108(%rbp)
+	movzwl -2(%rbp), %eax
+	movzbl %al, %eax
+	movl %eax, -356(%rbp)
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl -20(%rbp), %eax
+	cqo
+	idivq %rcx
+	movl %eax, -360(%rbp)
+	cmpl $5, -356(%rbp)
+	jl .L312
+	cmpl $18, -356(%rbp)
+	jle .L310
+.L312:
+	movl -360(%rbp), %eax
+	addl -356(%rbp), %eax
+.L309:
+	jmp .L292
+.L326:
+	movzwl -2(%rbp), %eax
+	movl %eax, -400(%rbp)
+	cmpl $8, %eax
+	setg %al
+	movzbl %al, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	movl %eax, -380(%rbp)
+	cmpl $5, -380(%rbp)
+	jl .L336
+	cmpl $18, -380(%rbp)
+	jle .L334
+.L336:
+	movl -380(%rbp), %eax
+	addl $356, %eax
+.L333:
+	popq %rcx
+	imull %ecx, %eax
+	pushq %rax
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $9, %eax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	subl %ecx, %eax
+	movl %eax, -20(%rbp)
+	subq $8, %rsp
+	movl -8(%rbp), %eax
+	pushq %rax
+	movl $285, %eax
+	subl -400(%rbp), %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	cmpl -20(%rbp), %eax
+	setae %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movl $1, %eax
+	pushq %rax
+	movq -16(%rbp), %rax
+	imulq -16(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	addq $7, %rax
+	movq %rax, %rsi
+	movl -104(%rbp), %eax
+	cmpl $5, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	popq %rcx
+	popq %r8
+	popq %r9
+	call f0
+	addq $16, %rsp
+	jmp .L292
+.L327:
+	jmp .L292
+.L360:
+.L361:
+	imull $3, -424(%rbp), %eax
+	addl -420(%rbp), %eax
+	movq %rax, %rsi
+	movl -420(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L349
+.L310:
+.L311:
+	movl -356(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -364(%rbp)
+	imull $3, -360(%rbp), %eax
+	addl -356(%rbp), %eax
+	movl %eax, -368(%rbp)
+	cmpl $5, -364(%rbp)
+	jl .L316
+	cmpl $18, -364(%rbp)
+	jle .L314
+.L316:
+	movl -368(%rbp), %eax
+	addl -364(%rbp), %eax
+.L313:
+	jmp .L292
+.L331:
+	jmp .L292
+.L334:
+.L335:
+	movl -380(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -384(%rbp)
+	movl -380(%rbp), %eax
+	addl $1068, %eax
+	movl %eax, -388(%rbp)
+	cmpl $5, -384(%rbp)
+	jl .L340
+	cmpl $18, -384(%rbp)
+	jle .L338
+.L340:
+	movl -388(%rbp), %eax
+	addl -384(%rbp), %eax
+.L337:
+	jmp .L333
+.L314:
+.L315:
+	movl -364(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -372(%rbp)
+	imull $3, -368(%rbp), %eax
+	addl -364(%rbp), %eax
+	movl %eax, -376(%rbp)
+	cmpl $5, -372(%rbp)
+	jl .L320
+	cmpl $18, -372(%rbp)
+	jle .L318
+.L320:
+	movl -376(%rbp), %eax
+	addl -372(%rbp), %eax
+.L317:
+	jmp .L292
+.L338:
+.L339:
+	movl -384(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -392(%rbp)
+	imull $3, -388(%rbp), %eax
+	addl -384(%rbp), %eax
+	movl %eax, -396(%rbp)
+	cmpl $5, -392(%rbp)
+	jl .L344
+	cmpl $18, -392(%rbp)
+	jle .L342
+.L344:
+	movl -396(%rbp), %eax
+	addl -392(%rbp), %eax
+.L341:
+	jmp .L333
+.L318:
+.L319:
+	imull $3, -376(%rbp), %eax
+	addl -372(%rbp), %eax
+	movq %rax, %rsi
+	movl -372(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	jmp .L292
+.L342:
+.L343:
+	subq $8, %rsp
+	imull $3, -396(%rbp), %eax
+	addl -392(%rbp), %eax
+	movq %rax, %rsi
+	movl -392(%rbp), %eax
+	subl $1, %eax
+	movq %rax, %rdi
+	call rec
+	addq $8, %rsp
+	jmp .L333
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,243 @@
+long g0 = 5;
+int ga0[16];
+short f0(unsigned int p0, unsigned short p1, unsigned int p2, unsigned short p3) {
+    int v0 = 10;
+    short v1 = 481;
+    long v2 = 538179773170;
+    unsigned char v3 = 247;
+    char v4 = 4;
+    unsigned short v5 = 4294967295;
+    int i0 = 7;
+    long j0 = 0;
+    if (((p3 <= p0) >= (short)((v0 && ga0[5])))) {
+        v0 = !(-((unsigned char)(1)));
+        v5 = v5 + ga0[9];
+        for (j0 = 2; j0 < 17; j0 = j0 + 1) {
+            if ((7 > !(!(ga0[2])))) {
+                i0 = (((717 / 16) / (g0 * g0 + 1)) != (8 && (p0 - g0)));
+                if ((j0 - (ga0[3] > 10))) { return 797U; }
+                v5 = ((v5 || p3) != (unsigned int)(p2));
+            }
+        }
+    } else {
+        v5 = -((p1 && i0));
+        switch (p2) {
+        default:
+            switch (((unsigned long)(p1) <= p1)) {
+            case 17:
+                break;
+            case -1:
+            case 257:
+                break;
+            case 690:
+                break;
+            case 709:
+                if (!(2U)) { return ((ga0[5] + ga0[11]) >= g0); }
+            case 5:
+                v3 = (short)(ga0[5]);
+                break;
+            case -3:
+                if (((431 - 5) && -(ga0[3]))) { return p3; }
+                break;
+            }
+            if ((1 * 768)) { return 2; }
+        case 137:
+            break;
+        case 336:
+            break;
+        }
+        v0 = 0;
+        while (v0 < 33) {
+            if (p0) { break; }
+            switch (((p3 / (v3 * v3 + 1)) * v1)) {
+            case 1:
+                p0 = p0 + ((v1 / (p3 * p3 + 1)) != (p1 == 1000000007));
+                p1 = g0;
+            case 35:
+                v3 = v4;
+                if (((9 || v1) && !(ga0[8]))) { break; }
+                break;
+            case 47:
+                if (((unsigned long)(65536) + 385)) { break; }
+                v3 = -(-(i0));
+                break;
+            case 615:
+                break;
+            case 3:
+                if (625465251714) { break; }
+                break;
+            default:
+            case 447:
+                if (-(2)) { break; }
+            case 70:
+                p0 = 903;
+                break;
+            }
+            v0 = v0 + 1;
+        }
+    }
+    if ((!((7L + p1)) == 661)) {
+        switch ((935L != i0)) {
+        default:
+            v0 = v0 + i0;
+            v0 = -((ga0[11] && 874));
+            break;
+        case 90:
+            break;
+        case 170:
+            switch ((p0 / 1)) {
+            case 0:
+                break;
+            case 8:
+                v0 = g0;
+                if (((v3 + v0) < (ga0[7] && p3))) { return v3; }
+            case 2:
+                if ((v1 && (1 * i0))) { return (!(5) / (v5 * v5 + 1)); }
+                if ((566 <= (char)(558))) { return (5 + j0); }
+                break;
+            case 9:
+                break;
+            }
+            v4 = (((p2 && 5) || 1) - 9);
+            break;
+        case 68:
+            j0 = j0 + p2;
+            if ((364 > !(i0))) { return (v1 / (v2 * v2 + 1)); }
+        }
+    } else {
+        switch (ga0[5]) {
+        case 3:
+            break;
+        case 1:
+            break;
+        case 0:
+            p1 = 156766182101;
+            break;
+        case 7:
+            p2 = 0;
+            while (p2 < 100) {
+                if ((p2 == 347933926223)) { break; }
+                p2 = p2 + 1;
+            }
+            break;
+        default:
+            p1 = p1;
+            break;
+        }
+    }
+    p0 = ((p2 <= (770986009152 + 534)) < v1);
+    return (((3 - v1) >= (v4 || p0)) - 2);
+}
+unsigned int f1(char p0, unsigned long p1, long p2, int p3, unsigned short p4) {
+    unsigned long v0 = 708U;
+    char v1 = 128;
+    unsigned int v2 = 6;
+    short v3 = 9;
+    long v4 = 637;
+    int i0 = 10;
+    long j0 = 4294967295;
+    switch (((1u || 17) < (int)(5ul))) {
+    case 0:
+        if (((2u >= 2) > v1)) {
+            j0 = 0;
+            while (j0 < 4) {
+                if (175) { break; }
+                if (f0(ga0[11], 372, 437, p2)) { break; }
+                v2 = f0((6 * 7), 9, (p3 < 4), 255);
+                j0 = j0 + 1;
+            }
+            j0 = (2 + (j0 != f0(473, v0, 5, 10ul)));
+            v2 = p0;
+        } else {
+            p3 = p4;
+        }
+        v0 = 788;
+    case 3:
+    default:
+        f0(p3, p0, (unsigned int)(1046825369409), (ga0[4] && 78));
+    case -2:
+        v3 = i0;
+        break;
+    case -3:
+        if (!(275u)) {
+            if (!(397)) {
+                p4 = p4 + ((127 / (j0 * j0 + 1)) || (g0 + v0));
+                f0(v1, (i0 + 4), 187, v1);
+            }
+            p4 = v0;
+        }
+        switch (((740 - p3) / (v3 * v3 + 1))) {
+        default:
+            break;
+        case 33:
+        case 63:
+            break;
+        case 928:
+            if (f0(p1, p4, ga0[3], v3)) {
+                v2 = v0;
+                f0((p0 == 85L), (unsigned long)(v4), 8, (6 < p0));
+                v2 = !((4 && -(ga0[12])));
+            } else {
+                if (v2) { return !((j0 >= ga0[3])); }
+            }
+            break;
+        case 657:
+            break;
+        case 746:
+            if ((0 / (v4 * v4 + 1))) { return (char)(6); }
+            break;
+        case 70:
+            if (128ul) {
+                v3 = v3 + ga0[8];
+            } else {
+                f0(f0(p3, ga0[9], 9, 3), j0, f0(9, v3, 53, 65535), 1);
+                p3 = (996193612649 > -(f0(674182717166, p0, ga0[11], 7)));
+                v0 = (!(ga0[7]) >= ((522779504251 >= p4) / (v1 * v1 + 1)));
+            }
+        case 156:
+            break;
+        }
+        break;
+    }
+    i0 = (((4 || 3) <= f0(p4, 1000000007, v3, v1)) || 877);
+    for (p3 = 1; p3 < 100; p3 = p3 + 1) {
+        v1 = ((v4 / (j0 * j0 + 1)) <= ga0[13]);
+    }
+    return f0(983, (0 - p0), (42340561768 && ga0[0]), 3);
+}
+int main() {
+    char v0 = 4;
+    unsigned char v1 = 1000000007;
+    int v2 = 0;
+    unsigned char v3 = 32767;
+    unsigned char v4 = 3;
+    int v5 = 8;
+    int i0 = 32767;
+    long j0 = 7;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 2; }
+    v1 = j0;
+    g0 = (((1 / 4) * (v1 / 1)) + v2);
+    i0 = 0;
+    while (i0 < 3) {
+        j0 = !(((5 != v4) + g0));
+        i0 = i0 + 1;
+    }
+    f1(i0, (unsigned char)(10), v0, f0(la0[5], v0, j0, j0), (unsigned short)(561307043580));
+    f1(i0, f1(ga0[6], v4, 1, 4u, v5), (v5 > g0), (v4 - 6), 9);
+    v3 = f0(v3, 2u, (v2 != v4), (g0 > v1));
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
@@ -0,0 +1,2065 @@
+	.section .data
+	.type g0, @object
+	.size g0, 8
+	.p2align 3
+g0:
+	.quad 5
+	.section .bss
+	.type ga0, @object
+	.size ga0, 64
+	.p2align 5
+ga0:
+	.zero 64
+	.section .text
+	.type f0, @function
+	.type f0.constprop.0, @function
+	.type f1, @function
+	.global main
+	.type main, @function
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $88, %rsp
+	movl %edi, -72(%rbp)
+	movw %si, -80(%rbp)
+	movl %edx, -68(%rbp)
+	movw %cx, -78(%rbp)
+	movl $10, -64(%rbp)
+	movw $481, -76(%rbp)
+	movabsq $538179773170, %rax
+	movq %rax, -32(%rbp)
+	movb $247, -82(%rbp)
+	movb $4, -81(%rbp)
+	movw $65535, -74(%rbp)
+	movl $7, -60(%rbp)
+	movq $0, -24(%rbp)
+	cmpl $0, -64(%rbp)
+	je .L2
+	movl ga0+20(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L3
+.L2:
+	movl $0, %eax
+.L3:
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movzwl -78(%rbp), %eax
+	cmpl %edi, %eax
+	setbe %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jl .L0
+	xorl %eax, %eax
+	subl $1, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -64(%rbp)
+	movzwl -74(%rbp), %eax
+	movl ga0+36(%rip), %ecx
+	addl %ecx, %eax
+	movw %ax, -74(%rbp)
+	movq $2, -24(%rbp)
+	movl $717, %eax
+	leal 15(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $4, %ecx
+	movl %ecx, %eax
+	movl %eax, -8(%rbp)
+	cmpq $17, -24(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L4:
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl $7, %eax
+	jge .L6
+	movl $8, %eax
+	testl %eax, %eax
+	je .L8
+	movl %edi, %eax
+	subq g0(%rip), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L9
+.L12:
+	movl $1, %eax
+.L13:
+	cmpl -68(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -74(%rbp)
+.L6:
+.L7:
+	addq $1, -24(%rbp)
+	cmpq $17, -24(%rbp)
+	jl .L4
+.L5:
+	jmp .L1
+.L8:
+	movl $0, %eax
+.L9:
+	movslq %eax, %rax
+	pushq %rax
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movslq -8(%rbp), %rax
+	cqo
+	idivq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -60(%rbp)
+	movl ga0+12(%rip), %eax
+	cmpl $10, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	subq %rcx, %rax
+	jne .LB0
+.L10:
+.L11:
+	cmpw $0, -74(%rbp)
+	jne .L12
+	cmpw $0, -78(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L13
+.L0:
+	cmpw $0, %si
+	je .L14
+	cmpl $0, -60(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L15
+.L14:
+	movl $0, %eax
+.L15:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, -74(%rbp)
+	movl %edx, %eax
+	movslq %eax, %rax
+	cmpq $137, %rax
+	je .L18
+	cmpq $336, %rax
+	je .L16
+.L17:
+	movzwl %si, %eax
+	movq %rax, -8(%rbp)
+	cmpq %rax, -8(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $17, %rax
+	jge .L27
+	cmpq $-3, %rax
+	je .L26
+	cmpq $-1, %rax
+	je .L20
+	cmpq $5, %rax
+	je .L25
+	jmp .L20
+.L35:
+	movl $1, %eax
+.L36:
+	movl %eax, -48(%rbp)
+	movl $65536, %eax
+	addq $385, %rax
+	movq %rax, -16(%rbp)
+	xorl %eax, %eax
+	subl -60(%rbp), %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movl %eax, -44(%rbp)
+	xorl %eax, %eax
+	subl $2, %eax
+	movl %eax, -40(%rbp)
+	cmpl $33, -64(%rbp)
+	jge .L38
+	.p2align 4,,10
+.L37:
+	cmpl $0, -72(%rbp)
+	je .L39
+.L38:
+.L1:
+	movzwl -80(%rbp), %eax
+	addq $7, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl $661, %eax
+	jne .L59
+	movslq -60(%rbp), %rax
+	cmpq $935, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $68, %rax
+	je .L65
+	cmpq $90, %rax
+	je .L61
+	cmpq $170, %rax
+	je .L64
+.L62:
+	movl -60(%rbp), %eax
+	addl %eax, -64(%rbp)
+	movl ga0+44(%rip), %eax
+	testl %eax, %eax
+	je .L66
+	movl $874, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L67
+.L39:
+.L40:
+	movswl -76(%rbp), %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	movzbl -82(%rbp), %eax
+	movl %eax, -36(%rbp)
+	imull -36(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -52(%rbp), %eax
+	cltd
+	idivl %ecx
+	popq %rcx
+	imull %ecx, %eax
+	movslq %eax, %rax
+	cmpq $47, %rax
+	jge .L49
+	cmpq $1, %rax
+	je .L42
+	cmpq $3, %rax
+	je .L46
+	cmpq $35, %rax
+	je .L43
+.L47:
+	cmpl $0, -40(%rbp)
+	je .L57
+	jmp .L41
+.L59:
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $7, %rcx
+	ja .L94
+	leaq .L95(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L93
+	# table target .L91
+	# table target .L90
+	# table target .L89
+	# table target .L92
+	jmp *%rcx
+.L49:
+	cmpq $447, %rax
+	jge .L50
+	cmpq $47, %rax
+	je .L44
+	cmpq $70, %rax
+	je .L48
+	jmp .L47
+.L65:
+	movl -68(%rbp), %eax
+	addq %rax, -24(%rbp)
+	cmpl $0, -60(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $364, %eax
+	jl .LB1
+.L86:
+.L87:
+.L61:
+.L88:
+.L60:
+	movswl -76(%rbp), %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	movabsq $770986009152, %rax
+	addq $534, %rax
+	movq %rax, %rcx
+	movl -68(%rbp), %eax
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -72(%rbp)
+	cmpb $0, -81(%rbp)
+	jne .L100
+	cmpl $0, -72(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L101
+.L100:
+	movl $1, %eax
+.L101:
+	movq %rax, %rcx
+	movl $3, %eax
+	subl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	subl $2, %eax
+.f0_return:
+	leave
+	ret
+.L94:
+.L93:
+	movzwl -80(%rbp), %eax
+	jmp .L88
+.L42:
+	movzwl -80(%rbp), %eax
+	cmpl $1000000007, %eax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	cltd
+	idivl -56(%rbp)
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	addl %eax, -72(%rbp)
+	movq g0(%rip), %rax
+	movw %ax, -80(%rbp)
+.L43:
+	movsbl -81(%rbp), %eax
+	movb %al, -82(%rbp)
+	cmpl $0, -48(%rbp)
+	je .L51
+	movl ga0+32(%rip), %eax
+	testl %eax, %eax
+.L51:
+.L52:
+.L41:
+	addl $1, -64(%rbp)
+	cmpl $33, -64(%rbp)
+	jl .L37
+	jmp .L38
+.L50:
+	cmpq $447, %rax
+	je .L47
+	cmpq $615, %rax
+	je .L41
+	jmp .L47
+.L57:
+.L58:
+.L48:
+	movl $903, -72(%rbp)
+	jmp .L41
+.L26:
+	movl $431, %eax
+	subl $5, %eax
+	je .L31
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	jne .LB2
+.L31:
+.L32:
+.L20:
+	movl $1, %eax
+	imull $768, %eax, %eax
+	testl %eax, %eax
+	jne .LB3
+.L33:
+.L34:
+.L18:
+.L16:
+	movl $0, -64(%rbp)
+	movzwl -78(%rbp), %eax
+	movl %eax, -52(%rbp)
+	imull -52(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -56(%rbp)
+	movl $9, %eax
+	testl %eax, %eax
+	jne .L35
+	cmpw $0, -76(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L36
+.L63:
+	jmp .L61
+.L44:
+	cmpq $0, -16(%rbp)
+	je .L53
+	jmp .L41
+.L46:
+	movabsq $625465251714, %rax
+	testq %rax, %rax
+	je .L41
+	jmp .L41
+.L66:
+	movl $0, %eax
+.L67:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .L61
+.L64:
+	movl -72(%rbp), %eax
+	movl $1, %ecx
+	xorl %edx, %edx
+	divl %ecx
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L73
+	leaq .L74(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L68
+	# table target .L69
+	# table target .L71
+	# table target .L70
+	# table target .L72
+	jmp *%rcx
+.L19:
+	jmp .L16
+.L53:
+.L54:
+	movl -44(%rbp), %eax
+	movb %al, -82(%rbp)
+	jmp .L41
+.L45:
+	jmp .L41
+.L55:
+.L56:
+	jmp .L41
+.L73:
+.L68:
+	cmpl $0, -68(%rbp)
+	je .L85
+	movl $5, %eax
+	testl %eax, %eax
+	jne .L83
+.L85:
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+.L84:
+	subl $9, %eax
+	movb %al, -81(%rbp)
+	jmp .L61
+.L27:
+	cmpq $690, %rax
+	jge .L28
+	cmpq $17, %rax
+	je .L20
+	cmpq $257, %rax
+	je .L20
+	jmp .L20
+.L28:
+	cmpq $690, %rax
+	je .L20
+	cmpq $709, %rax
+	je .L24
+	jmp .L20
+.L83:
+	movl $1, %eax
+	jmp .L84
+.L22:
+	jmp .L20
+.L21:
+	jmp .L20
+.L23:
+	jmp .L20
+.L24:
+	movl $2, %eax
+	testl %eax, %eax
+	je .LB4
+.L29:
+.L30:
+.L25:
+	movl ga0+20(%rip), %eax
+	movb %al, -82(%rbp)
+	jmp .L20
+.L69:
+	jmp .L68
+.L70:
+	movq g0(%rip), %rax
+	movl %eax, -64(%rbp)
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	je .L77
+	cmpw $0, -78(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L78
+.L77:
+	movl $0, %eax
+.L78:
+	movq %rax, %rcx
+	movzbl -82(%rbp), %eax
+	addl -64(%rbp), %eax
+	cmpl %ecx, %eax
+	jl .LB5
+.L75:
+.L76:
+.L71:
+	cmpw $0, -76(%rbp)
+	je .L79
+	imull $1, -60(%rbp), %eax
+	testl %eax, %eax
+	jne .LB6
+.L79:
+.L80:
+	movl $566, %eax
+	cmpl $46, %eax
+	jle .LB7
+.L81:
+.L82:
+	jmp .L68
+.L72:
+	jmp .L68
+.L89:
+	jmp .L88
+.L90:
+	jmp .L88
+.L91:
+	jmp .L88
+.L92:
+	movl $0, -68(%rbp)
+	cmpl $100, -68(%rbp)
+	jae .L88
+	.p2align 4,,10
+.L96:
+	movl -68(%rbp), %eax
+	movabsq $347933926223, %rcx
+	cmpq %rcx, %rax
+	jne .L98
+.L97:
+	jmp .L88
+.L98:
+.L99:
+	addl $1, -68(%rbp)
+	cmpl $100, -68(%rbp)
+	jb .L96
+	jmp .L88
+.LB0:
+	movl $797, %eax
+	jmp .f0_return
+.LB1:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movswq -76(%rbp), %rax
+	cqo
+	idivq %rcx
+	jmp .f0_return
+.LB3:
+	movl $2, %eax
+	jmp .f0_return
+.LB7:
+	movq -24(%rbp), %rax
+	addq $5, %rax
+	jmp .f0_return
+.LB2:
+	movzwl -78(%rbp), %eax
+	jmp .f0_return
+.LB5:
+	movzbl -82(%rbp), %eax
+	jmp .f0_return
+.LB6:
+	movzwl -74(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cltd
+	idivl %ecx
+	jmp .f0_return
+.LB4:
+	movl ga0+20(%rip), %eax
+	movl ga0+44(%rip), %ecx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	cmpq g0(%rip), %rax
+	setge %al
+	movzbl %al, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L74:
+	.long .L69-.L74
+	.long .L68-.L74
+	.long .L71-.L74
+	.long .L68-.L74
+	.long .L68-.L74
+	.long .L68-.L74
+	.long .L68-.L74
+	.long .L68-.L74
+	.long .L70-.L74
+	.long .L72-.L74
+	.p2align 2
+.L95:
+	.long .L91-.L95
+	.long .L90-.L95
+	.long .L93-.L95
+	.long .L89-.L95
+	.long .L93-.L95
+	.long .L93-.L95
+	.long .L93-.L95
+	.long .L92-.L95
+	.popsection
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $56, %rsp
+	movl %edi, -48(%rbp)
+	movw %si, -54(%rbp)
+	movl %edx, -44(%rbp)
+	movl $10, -40(%rbp)
+	movw $481, -52(%rbp)
+	movabsq $538179773170, %rax
+	movq %rax, -24(%rbp)
+	movb $247, -56(%rbp)
+	movb $4, -55(%rbp)
+	movw $65535, -50(%rbp)
+	movl $7, -36(%rbp)
+	movq $0, -16(%rbp)
+	cmpl $0, -40(%rbp)
+	je .L104
+	movl ga0+20(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L105
+.L104:
+	movl $0, %eax
+.L105:
+	movswl %ax, %eax
+	movq %rax, %rcx
+	cmpl $3, %edi
+	setae %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	jl .L102
+	movl $0, -40(%rbp)
+	movzwl -50(%rbp), %eax
+	movl ga0+36(%rip), %ecx
+	addl %ecx, %eax
+	movw %ax, -50(%rbp)
+	movq $2, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jge .L103
+	.p2align 4,,10
+.L106:
+	movl ga0+8(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	cmpl $7, %eax
+	jge .L108
+	movl %edi, %eax
+	subq g0(%rip), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	movq g0(%rip), %rax
+	imulq g0(%rip), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $44, %eax
+	cqo
+	idivq %rcx
+	popq %rcx
+	cmpq %rcx, %rax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -36(%rbp)
+	movl ga0+12(%rip), %eax
+	cmpl $10, %eax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -16(%rbp), %rax
+	subq %rcx, %rax
+	jne .LB8
+.L110:
+.L111:
+	cmpw $0, -50(%rbp)
+	jne .L112
+	movl $3, %eax
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L113
+.L112:
+	movl $1, %eax
+.L113:
+	cmpl -44(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movw %ax, -50(%rbp)
+.L108:
+.L109:
+	addq $1, -16(%rbp)
+	cmpq $17, -16(%rbp)
+	jl .L106
+.L107:
+	jmp .L103
+.L102:
+	cmpw $0, %si
+	je .L114
+	cmpl $0, -36(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L115
+.L114:
+	movl $0, %eax
+.L115:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movw %ax, -50(%rbp)
+	movl %edx, %eax
+	movslq %eax, %rax
+	cmpq $137, %rax
+	je .L118
+	cmpq $336, %rax
+	je .L116
+.L117:
+	movzwl %si, %eax
+	movq %rax, -8(%rbp)
+	cmpq %rax, -8(%rbp)
+	setbe %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $17, %rax
+	jge .L126
+	cmpq $-3, %rax
+	je .L125
+	cmpq $-1, %rax
+	je .L122
+	cmpq $5, %rax
+	je .L124
+	jmp .L120
+.L118:
+.L116:
+	movl $0, -40(%rbp)
+	movswl -52(%rbp), %eax
+	movl %eax, -28(%rbp)
+	movslq %eax, %rcx
+	movq %rcx, %rax
+	movabsq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	shrq $63, %rcx
+	leal (%rdx,%rcx), %eax
+	movl %eax, -32(%rbp)
+	cmpl $33, -40(%rbp)
+	jge .L131
+	.p2align 4,,10
+.L130:
+	cmpl $0, -48(%rbp)
+	je .L132
+.L131:
+.L103:
+	movzwl -54(%rbp), %eax
+	addq $7, %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	cmpl $661, %eax
+	jne .L146
+	movslq -36(%rbp), %rax
+	cmpq $935, %rax
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $68, %rax
+	je .L152
+	cmpq $90, %rax
+	je .L148
+	cmpq $170, %rax
+	je .L151
+.L149:
+	movl -36(%rbp), %eax
+	addl %eax, -40(%rbp)
+	movl ga0+44(%rip), %eax
+	testl %eax, %eax
+	je .L153
+	movl $874, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L154
+.L132:
+.L133:
+	movzbl -56(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $3, %eax
+	cltd
+	idivl %ecx
+	imull -28(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $47, %rax
+	jge .L142
+	cmpq $1, %rax
+	je .L135
+	cmpq $3, %rax
+	je .L134
+	cmpq $35, %rax
+	je .L136
+.L140:
+.L134:
+	addl $1, -40(%rbp)
+	cmpl $33, -40(%rbp)
+	jl .L130
+	jmp .L131
+.L146:
+	movl ga0+20(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $7, %rcx
+	ja .L173
+	leaq .L180(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L178
+	# table target .L176
+	# table target .L175
+	# table target .L174
+	# table target .L177
+	jmp *%rcx
+.L142:
+	cmpq $447, %rax
+	jge .L143
+	cmpq $47, %rax
+	je .L134
+	cmpq $70, %rax
+	je .L141
+	jmp .L140
+.L152:
+	movl -44(%rbp), %eax
+	addq %rax, -16(%rbp)
+	cmpl $0, -36(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $364, %eax
+	jl .LB9
+.L171:
+.L172:
+.L148:
+.L173:
+.L147:
+	movswl -52(%rbp), %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	movl -44(%rbp), %eax
+	movabsq $770986009686, %rcx
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -48(%rbp)
+	cmpb $0, -55(%rbp)
+	jne .L185
+	cmpl $0, -48(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L186
+.L185:
+	movl $1, %eax
+.L186:
+	movq %rax, %rcx
+	movl $3, %eax
+	subl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	subl $2, %eax
+.f0.constprop.0_return:
+	leave
+	ret
+.L179:
+.L178:
+	jmp .L173
+.L135:
+	movzwl -54(%rbp), %eax
+	cmpl $1000000007, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %eax, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	addl %eax, -48(%rbp)
+	movq g0(%rip), %rax
+	movw %ax, -54(%rbp)
+.L136:
+	movsbl -55(%rbp), %eax
+	movb %al, -56(%rbp)
+	movl ga0+32(%rip), %eax
+	testl %eax, %eax
+	jne .L134
+	jmp .L134
+.L143:
+	cmpq $447, %rax
+	je .L140
+	cmpq $615, %rax
+	je .L134
+	jmp .L140
+.L150:
+	jmp .L148
+.L144:
+.L145:
+	jmp .L134
+.L137:
+	jmp .L134
+.L139:
+	jmp .L134
+.L119:
+	jmp .L116
+.L153:
+	movl $0, %eax
+.L154:
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	jmp .L148
+.L151:
+	movl -48(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $9, %rcx
+	ja .L160
+	leaq .L161(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L155
+	# table target .L156
+	# table target .L158
+	# table target .L157
+	# table target .L159
+	jmp *%rcx
+.L138:
+	jmp .L134
+.L141:
+	movl $903, -48(%rbp)
+	jmp .L134
+.L126:
+	cmpq $690, %rax
+	jge .L127
+	cmpq $17, %rax
+	je .L120
+	cmpq $257, %rax
+	je .L122
+	jmp .L120
+.L160:
+.L155:
+	cmpl $0, -44(%rbp)
+	je .L170
+	movl $5, %eax
+	testl %eax, %eax
+	jne .L168
+.L170:
+	movl $1, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+.L169:
+	subl $9, %eax
+	movb %al, -55(%rbp)
+	jmp .L148
+.L127:
+	cmpq $690, %rax
+	je .L120
+	cmpq $709, %rax
+	je .L124
+	jmp .L120
+.L125:
+	xorl %eax, %eax
+	movl ga0+12(%rip), %ecx
+	subl %ecx, %eax
+	jne .LB10
+.L128:
+.L129:
+	jmp .L120
+.L168:
+	movl $1, %eax
+	jmp .L169
+.L121:
+	jmp .L120
+.L123:
+	jmp .L120
+.L124:
+	movl ga0+20(%rip), %eax
+	jmp .L120
+.L156:
+	jmp .L155
+.L157:
+	movq g0(%rip), %rax
+	movl %eax, -40(%rbp)
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	je .L164
+	movl $3, %eax
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L165
+.L164:
+	movl $0, %eax
+.L165:
+	movq %rax, %rcx
+	movzbl -56(%rbp), %eax
+	addl -40(%rbp), %eax
+	cmpl %ecx, %eax
+	jl .LB11
+.L162:
+.L163:
+.L158:
+	cmpw $0, -52(%rbp)
+	je .L155
+	cmpl $0, -36(%rbp)
+	jne .LB12
+.L166:
+.L167:
+	jmp .L155
+.L159:
+	jmp .L155
+.L174:
+	jmp .L173
+.L175:
+	jmp .L173
+.L176:
+	jmp .L173
+.L177:
+	movl $0, -44(%rbp)
+	cmpl $100, -44(%rbp)
+	jae .L173
+	.p2align 4,,10
+.L181:
+	movl -44(%rbp), %eax
+	movabsq $347933926223, %rcx
+	cmpq %rcx, %rax
+	jne .L183
+.L182:
+	jmp .L173
+.L183:
+.L184:
+	addl $1, -44(%rbp)
+	cmpl $100, -44(%rbp)
+	jb .L181
+	jmp .L173
+.LB8:
+	movl $797, %eax
+	jmp .f0.constprop.0_return
+.LB9:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movswq -52(%rbp), %rax
+	cqo
+	idivq %rcx
+	jmp .f0.constprop.0_return
+.L122:
+.L120:
+	movl $2, %eax
+	jmp .f0.constprop.0_return
+.LB10:
+	movl $3, %eax
+	jmp .f0.constprop.0_return
+.LB11:
+	movzbl -56(%rbp), %eax
+	jmp .f0.constprop.0_return
+.LB12:
+	movzwl -50(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	cltd
+	idivl %ecx
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L161:
+	.long .L156-.L161
+	.long .L155-.L161
+	.long .L158-.L161
+	.long .L155-.L161
+	.long .L155-.L161
+	.long .L155-.L161
+	.long .L155-.L161
+	.long .L155-.L161
+	.long .L157-.L161
+	.long .L159-.L161
+	.p2align 2
+.L180:
+	.long .L176-.L180
+	.long .L175-.L180
+	.long .L178-.L180
+	.long .L174-.L180
+	.long .L178-.L180
+	.long .L178-.L180
+	.long .L178-.L180
+	.long .L177-.L180
+	.popsection
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $80, %rsp
+	movb %dil, -72(%rbp)
+	movq %rsi, -56(%rbp)
+	movq %rdx, -48(%rbp)
+	movl %ecx, -68(%rbp)
+	movw %r8w, -70(%rbp)
+	movq $708, -40(%rbp)
+	movb $-128, -71(%rbp)
+	movl $6, -64(%rbp)
+	movw $9, -16(%rbp)
+	movq $637, -32(%rbp)
+	movl $10, -60(%rbp)
+	movl $4294967295, %eax
+	movq %rax, -24(%rbp)
+	movl $1, %eax
+	testl %eax, %eax
+	jne .L192
+	movl $17, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L193
+.L192:
+	movl $1, %eax
+.L193:
+	cmpl $5, %eax
+	setl %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	leaq 3(%rax), %rcx
+	cmpq $6, %rcx
+	ja .L194
+	leaq .L195(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L189
+	# table target .L191
+	# table target .L190
+	# table target .L188
+	# table target .L189
+	jmp *%rcx
+.L194:
+.L189:
+	movl ga0+16(%rip), %eax
+	testl %eax, %eax
+	je .L204
+	movl $78, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L205
+.L204:
+	movl $0, %eax
+.L205:
+	movq %rax, %rcx
+	movl $3148316481, %eax
+	movq %rax, %rdx
+	movsbl -72(%rbp), %eax
+	movq %rax, %rsi
+	movl -68(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+.L190:
+	movl -60(%rbp), %eax
+	movw %ax, -16(%rbp)
+.L187:
+	movsbl -71(%rbp), %eax
+	movq %rax, %rcx
+	movswl -16(%rbp), %eax
+	movq %rax, %rdx
+	movl $51719, %eax
+	movq %rax, %rsi
+	movzwl -70(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	pushq %rax
+	movl $4, %eax
+	testl %eax, %eax
+	jne .L234
+	movl $3, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L235
+.L234:
+	movl $1, %eax
+.L235:
+	popq %rcx
+	cmpl %ecx, %eax
+	jle .L232
+	movl $877, %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L233
+.L232:
+	movl $1, %eax
+.L233:
+	movl $1, -68(%rbp)
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, -24(%rbp)
+	cmpl $100, -68(%rbp)
+	jge .L236
+	movl $100, %eax
+	movslq -68(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L239
+	.p2align 4,,10
+.L238:
+	movl ga0+52(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cqo
+	idivq -24(%rbp)
+	movq %rax, -8(%rbp)
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	addl $1, -68(%rbp)
+	movl ga0+52(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl $1, -68(%rbp)
+	movl ga0+52(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl $1, -68(%rbp)
+	movl ga0+52(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -8(%rbp)
+	setle %al
+	movzbl %al, %eax
+	addl $1, -68(%rbp)
+	subq $1, -16(%rbp)
+	jne .L238
+.L239:
+.L236:
+.L237:
+	cmpl $100, -68(%rbp)
+	jge .L241
+	.p2align 4,,10
+.L240:
+	movl ga0+52(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	cqo
+	idivq -24(%rbp)
+	cmpq %rcx, %rax
+	setle %al
+	movzbl %al, %eax
+	addl $1, -68(%rbp)
+	cmpl $100, -68(%rbp)
+	jl .L240
+.L241:
+	movabsq $42340561768, %rax
+	testq %rax, %rax
+	je .L242
+	movl ga0+0(%rip), %eax
+	testl %eax, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .L243
+.L242:
+	movl $0, %eax
+.L243:
+	movq %rax, %rdx
+	xorl %eax, %eax
+	movsbl -72(%rbp), %ecx
+	subl %ecx, %eax
+	movq %rax, %rsi
+	movl $983, %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	movswl %ax, %eax
+.f1_return:
+	leave
+	ret
+.L188:
+	movl $2, %eax
+	cmpl $2, %eax
+	setae %al
+	movzbl %al, %eax
+	movsbl -71(%rbp), %ecx
+	cmpl %ecx, %eax
+	jle .L196
+	movq $0, -24(%rbp)
+	movl $6, %eax
+	imull $7, %eax, %eax
+	movl %eax, -16(%rbp)
+	cmpl $4, -68(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -8(%rbp)
+	cmpq $4, -24(%rbp)
+	jge .L199
+	.p2align 4,,10
+.L198:
+	movl $175, %eax
+	testl %eax, %eax
+	je .L200
+.L199:
+	movl $10, %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $473, %eax
+	movq %rax, %rdi
+	call f0
+	movswq %ax, %rax
+	cmpq %rax, -24(%rbp)
+	setne %al
+	movzbl %al, %eax
+	addl $2, %eax
+	movslq %eax, %rax
+	movq %rax, -24(%rbp)
+	movsbl -72(%rbp), %eax
+.L197:
+	jmp .L189
+.L200:
+.L201:
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	movl $437, %eax
+	movq %rax, %rdx
+	movl $372, %eax
+	movq %rax, %rsi
+	movl ga0+44(%rip), %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L202
+	jmp .L199
+.L202:
+.L203:
+	movl $255, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	movq %rax, %rdx
+	movl $9, %eax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	addq $1, -24(%rbp)
+	cmpq $4, -24(%rbp)
+	jl .L198
+	jmp .L199
+.L196:
+	movzwl %r8w, %eax
+	movl %eax, -68(%rbp)
+	jmp .L197
+.L191:
+	movl $275, %eax
+	testl %eax, %eax
+	jne .L206
+	movl $397, %eax
+	testl %eax, %eax
+	jne .L208
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $127, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .L210
+	movq g0(%rip), %rax
+	addq -40(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L211
+.L210:
+	movl $1, %eax
+.L211:
+	movq %rax, %rcx
+	movzwl %r8w, %eax
+	addl %ecx, %eax
+	movsbl -71(%rbp), %eax
+	movq %rax, %rcx
+	movl $187, %eax
+	movq %rax, %rdx
+	movl -60(%rbp), %eax
+	addl $4, %eax
+	movq %rax, %rsi
+	movsbl -71(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+.L208:
+.L209:
+	movq -40(%rbp), %rax
+	movw %ax, -70(%rbp)
+.L206:
+.L207:
+	movswl -16(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $740, %eax
+	subl -68(%rbp), %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	cmpq $156, %rax
+	jge .L220
+	cmpq $33, %rax
+	je .L187
+	cmpq $63, %rax
+	je .L187
+	cmpq $70, %rax
+	je .L218
+.L213:
+.L214:
+.L212:
+	jmp .L187
+.L220:
+	cmpq $746, %rax
+	jge .L221
+	cmpq $156, %rax
+	je .L187
+	cmpq $657, %rax
+	je .L187
+	jmp .L187
+.L221:
+	cmpq $746, %rax
+	je .L217
+	cmpq $928, %rax
+	je .L215
+	jmp .L187
+.L217:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	cqo
+	idivq %rcx
+	testq %rax, %rax
+	jne .LB13
+.L228:
+.L229:
+	jmp .L187
+.L230:
+	movl $1, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $65535, %eax
+	movq %rax, %rcx
+	movl $53, %eax
+	movq %rax, %rdx
+	movswl -16(%rbp), %eax
+	movq %rax, %rsi
+	movl $9, %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	subq $8, %rsp
+	movl $9, %eax
+	movq %rax, %rdx
+	movl ga0+36(%rip), %eax
+	movq %rax, %rsi
+	movl -68(%rbp), %eax
+	movq %rax, %rdi
+	call f0.constprop.0
+	addq $8, %rsp
+	movswl %ax, %eax
+	movq %rax, %rdi
+	popq %rsi
+	popq %rdx
+	popq %rcx
+	call f0
+	movl $7, %eax
+	movq %rax, %rcx
+	movl ga0+44(%rip), %eax
+	movq %rax, %rdx
+	movsbl -72(%rbp), %eax
+	movq %rax, %rsi
+	movl $4167818990, %eax
+	movq %rax, %rdi
+	call f0
+	movswl %ax, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $996193612649, %rax
+	cmpq %rcx, %rax
+	setg %al
+	movzbl %al, %eax
+	movsbl -71(%rbp), %eax
+	movl %eax, -8(%rbp)
+	imull -8(%rbp), %eax
+	addl $1, %eax
+	pushq %rax
+	movabsq $522779504251, %rax
+	movzwl -70(%rbp), %ecx
+	cmpq %rcx, %rax
+	setge %al
+	movzbl %al, %eax
+	popq %rcx
+	cltd
+	idivl %ecx
+	movq %rax, %rcx
+	movl ga0+28(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+.L231:
+.L219:
+	jmp .L187
+.L215:
+	movswl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl ga0+12(%rip), %eax
+	movq %rax, %rdx
+	movzwl -70(%rbp), %eax
+	movq %rax, %rsi
+	movq -56(%rbp), %rax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L222
+	movq -40(%rbp), %rax
+	movsbl -72(%rbp), %eax
+	cmpl $6, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl $8, %eax
+	movq %rax, %rdx
+	movq -32(%rbp), %rax
+	movq %rax, %rsi
+	movsbq -72(%rbp), %rax
+	cmpq $85, %rax
+	sete %al
+	movzbl %al, %eax
+	movq %rax, %rdi
+	call f0
+	movl $4, %eax
+	testl %eax, %eax
+	je .L224
+	xorl %eax, %eax
+	movl ga0+48(%rip), %ecx
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	jmp .L225
+.L216:
+	jmp .L187
+.L218:
+	movl $128, %eax
+	testq %rax, %rax
+	je .L230
+	movswl -16(%rbp), %eax
+	movl ga0+32(%rip), %ecx
+	addl %ecx, %eax
+	movw %ax, -16(%rbp)
+	jmp .L187
+.L224:
+	movl $1, %eax
+.L225:
+.L226:
+.L227:
+.L223:
+	jmp .L187
+.LB13:
+	movl $6, %eax
+	jmp .f1_return
+.L222:
+	cmpl $0, -64(%rbp)
+	je .L187
+	movl ga0+12(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .f1_return
+	.size f1, .-f1
+	.pushsection .rodata
+	.p2align 2
+.L195:
+	.long .L191-.L195
+	.long .L190-.L195
+	.long .L189-.L195
+	.long .L188-.L195
+	.long .L189-.L195
+	.long .L189-.L195
+	.long .L189-.L195
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $192, %rsp
+	movb $4, -1(%rbp)
+	movb $7, -2(%rbp)
+	movl $0, -8(%rbp)
+	movb $255, -9(%rbp)
+	movb $3, -10(%rbp)
+	movl $8, -16(%rbp)
+	movl $32767, -20(%rbp)
+	movq $7, -32(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -100(%rbp)
+	testl %eax, %eax
+	je .L244
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -112(%rbp)
+	cmpq $0, -112(%rbp)
+	je .L245
+	.p2align 4,,10
+.L246:
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	subq $1, -112(%rbp)
+	jne .L246
+.L247:
+.L244:
+.L245:
+	cmpl $16, -20(%rbp)
+	jge .L249
+	.p2align 4,,10
+.L248:
+	movl -20(%rbp), %eax
+	sall $1, %eax
+	movq %rax, %rcx
+	movslq -20(%rbp), %rax
+	movl %ecx, -96(%rbp,%rax,4)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L248
+.L249:
+	movq -32(%rbp), %rax
+	movb %al, -2(%rbp)
+	movslq -8(%rbp), %rax
+	movq %rax, -120(%rbp)
+	movq %rax, g0(%rip)
+	movl $0, -20(%rbp)
+	movzbl -10(%rbp), %eax
+	movl %eax, -128(%rbp)
+	cmpl $5, %eax
+	setne %al
+	movzbl %al, %eax
+	movl %eax, -124(%rbp)
+	movslq -124(%rbp), %rax
+	movq %rax, -136(%rbp)
+	addq g0(%rip), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -136(%rbp), %rax
+	addq g0(%rip), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movq -136(%rbp), %rax
+	addq g0(%rip), %rax
+	testq %rax, %rax
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	movl $3, -20(%rbp)
+	movl $50940, %eax
+	pushq %rax
+	subq $8, %rsp
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	movq -32(%rbp), %rax
+	movq %rax, %rdx
+	movsbl -1(%rbp), %eax
+	movq %rax, %rsi
+	movl -76(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movswl %ax, %eax
+	movq %rax, %rcx
+	movsbq -1(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movq %rax, %rdx
+	movl $10, %eax
+	movq %rax, %rsi
+	movl -20(%rbp), %eax
+	movb %al, -137(%rbp)
+	movq %rax, %rdi
+	popq %r8
+	call f1
+	movl $9, %eax
+	pushq %rax
+	movl -128(%rbp), %eax
+	subl $6, %eax
+	pushq %rax
+	movslq -16(%rbp), %rax
+	movq %rax, -160(%rbp)
+	cmpq g0(%rip), %rax
+	setg %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	pushq %rax
+	subq $8, %rsp
+	movl -16(%rbp), %eax
+	movq %rax, %r8
+	movl $4, %eax
+	movq %rax, %rcx
+	movl $1, %eax
+	movq %rax, %rdx
+	movzbl -10(%rbp), %eax
+	movq %rax, %rsi
+	movl ga0+24(%rip), %eax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movl %eax, %eax
+	movq %rax, %rsi
+	movsbl -137(%rbp), %eax
+	movq %rax, %rdi
+	popq %rdx
+	popq %rcx
+	popq %r8
+	call f1
+	movzbl -2(%rbp), %eax
+	movq %rax, -168(%rbp)
+	cmpq %rax, g0(%rip)
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	cmpl -128(%rbp), %eax
+	setne %al
+	movzbl %al, %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movzbl -9(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	movb %al, -9(%rbp)
+	movq $0, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq g0(%rip), %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -152(%rbp), %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -168(%rbp), %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -120(%rbp), %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movzbl -9(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movzbl -10(%rbp), %ecx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -160(%rbp), %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	movslq -20(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	imulq $31, -176(%rbp), %rax
+	addq -32(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movl $0, -20(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L250
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -184(%rbp)
+	cmpq $0, -184(%rbp)
+	je .L251
+	.p2align 4,,10
+.L252:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -184(%rbp)
+	jne .L252
+.L253:
+.L250:
+.L251:
+	cmpl $16, -20(%rbp)
+	jge .L255
+	.p2align 4,,10
+.L254:
+	movslq -20(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L254
+.L255:
+	movl $0, -20(%rbp)
+	cmpl $0, -100(%rbp)
+	je .L256
+	movl $16, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -192(%rbp)
+	cmpq $0, -192(%rbp)
+	je .L257
+	.p2align 4,,10
+.L258:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	subq $1, -192(%rbp)
+	jne .L258
+.L259:
+.L256:
+.L257:
+	cmpl $16, -20(%rbp)
+	jge .L261
+	.p2align 4,,10
+.L260:
+	movslq -20(%rbp), %rax
+	movl -96(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -176(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $16, -20(%rbp)
+	jl .L260
+.L261:
+	movq -176(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -176(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -176(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -176(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -176(%rbp)
+	movq -176(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
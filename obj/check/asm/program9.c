@@ -0,0 +1,282 @@
+char g0;
+int ga0[33];
+unsigned short f0(unsigned int p0, unsigned short p1, unsigned short p2, int p3) {
+    unsigned char v0 = 990116658838;
+    long v1 = 6;
+    long v2 = 10;
+    unsigned long v3 = 918;
+    int i0 = 993;
+    long j0 = 4;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 10; }
+    switch ((v2 || (3 > g0))) {
+    case -3:
+        if ((char)(v3)) { return (9 && i0); }
+        switch (g0) {
+        case 5:
+            break;
+        case 10:
+            v2 = v2 + (!(6) + (971 / (p1 * p1 + 1)));
+            if (v0) { return (unsigned char)((4294967295 / (j0 * j0 + 1))); }
+            break;
+        case 985:
+            v3 = (6 <= (v0 && v2));
+            break;
+        case 828:
+            break;
+        case 995:
+            i0 = (!(v0) / (v2 * v2 + 1));
+            if (((8 == 906) != (short)(249))) {
+                if (((4 <= 7) + 3)) { return (v2 / 16); }
+            } else {
+                if ((unsigned char)((ga0[14] == 8))) { return -((la0[3] == 10)); }
+            }
+            break;
+        case 166:
+            i0 = i0 + (!(v0) / (v1 * v1 + 1));
+            break;
+        case 695:
+            break;
+        case 63:
+            break;
+        }
+    case 596:
+        j0 = 0;
+        while (j0 < 8) {
+            for (v1 = 0; v1 < 16; v1 = v1 + 1) {
+                if ((9 - i0)) { break; }
+                if (((unsigned short)(v1) == (unsigned short)(p1))) { break; }
+            }
+            j0 = j0 + 1;
+        }
+        break;
+    case 817:
+        switch (la0[2]) {
+        case 378:
+            if (j0 >= 0 && j0 < 8) { la0[j0] = (828 || -(372)); }
+        default:
+            switch (0) {
+            case 10:
+                break;
+            case 5:
+                v1 = (short)(!(ga0[14]));
+                break;
+            case 0:
+                if (((65535L / (p2 * p2 + 1)) / 13ul)) { return ((short)(8) >= !(3)); }
+                break;
+            case 3:
+                v2 = (short)(v0);
+                p1 = g0;
+            case 2:
+                break;
+            }
+            switch ((short)(!(p1))) {
+            case -4:
+            default:
+            case 654:
+                if (-(v2)) { return v2; }
+                break;
+            case 836:
+                if (((unsigned char)(128) == 1)) { return -((v3 * v2)); }
+                break;
+            case 43:
+                v1 = 4;
+                break;
+            case 253:
+                break;
+            case 239:
+                if (j0) { return ((j0 * 178) / (g0 * g0 + 1)); }
+            case 59:
+                if (((9 != p0) != (4 + v1))) { return 926; }
+                break;
+            case -2:
+                if (v0) { return (p2 != (608 < p1)); }
+                v3 = -((621200163824 * la0[3]));
+            }
+            break;
+        case 52:
+            for (p0 = 0; p0 < 4; p0 = p0 + 1) {
+                if (608) { break; }
+                if (ga0[p0] < v1) { v1 = ga0[p0]; }
+                j0 = j0 + v0;
+            }
+            break;
+        case 1:
+            break;
+        }
+        break;
+    case -2:
+        break;
+    }
+    v0 = v0 + ((4 / (i0 * i0 + 1)) - (p3 + 0));
+    if ((!(893L) - (0 - 80))) {
+        i0 = !((g0 >= (v0 < g0)));
+        v2 = !(p2);
+        if (p0) { return (v2 < ga0[27]); }
+    } else {
+        if ((g0 - (5 * la0[3]))) { return 399731742473; }
+        switch (((748 - j0) > (207 / 7))) {
+        case 4:
+            la0[6] = ((3 < 9) + (848 + 205));
+        case 2:
+        case 5:
+            j0 = j0 + (p1 + (8 <= ga0[27]));
+            p0 = p0 + ((6 != v1) || (1 / 100));
+            break;
+        case 6:
+            break;
+        case 7:
+            break;
+        default:
+            if (6) { return v3; }
+            break;
+        }
+        p1 = 4;
+    }
+    for (v3 = 2; v3 < 4; v3 = v3 + 1) {
+        j0 = (long)((long)(232));
+    }
+    if (p1) { return (9 != (char)(10)); }
+    if ((((j0 || v3) * (9 + 1)) * ((1 + 2) == !(v1)))) {
+        v3 = p1;
+    } else {
+        i0 = ((p3 * v1) < (p1 / 8));
+    }
+    return (-(v0) / (g0 * g0 + 1));
+}
+void w0(unsigned long q0, unsigned long q1) {
+    ga0[3] = ga0[26] + q0;
+}
+unsigned char f1(long p0, int p1) {
+    unsigned int v0 = 0;
+    unsigned long v1 = 5;
+    short v2 = 7U;
+    long v3 = 201025965619L;
+    long v4 = 7;
+    char v5 = 1;
+    int i0 = 0;
+    long j0 = 207;
+    int la0[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la0[i0] = i0 * 183760455345; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 3; }
+    if (p0 >= 0 && p0 < 16) { la1[p0] = (f0(v2, la0[11], la0[7], v0) && f0(j0, 2, la1[12], 505)); }
+    i0 = !(f0(v0, v1, 563, 56));
+    v1 = g0;
+    return ((int)(882) + v1);
+}
+unsigned int f2(long p0, long p1, long p2) {
+    long v0 = 32767;
+    unsigned char v1 = 5;
+    short v2 = 570;
+    unsigned char v3 = 608010746664;
+    unsigned long v4 = 1;
+    int i0 = 9;
+    long j0 = 4294967295;
+    int la0[33];
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { la0[i0] = i0 * 4; }
+    int la1[4];
+    for (i0 = 0; i0 < 4; i0 = i0 + 1) { la1[i0] = i0 * 88; }
+    f0(9, p1, (4 - v2), la0[15]);
+    if ((p2 > 4294967295)) {
+        if (g0 >= 0 && g0 < 4) { la1[g0] = ((long)(la0[7]) / (p1 * p1 + 1)); }
+    }
+    v0 = !((!(5) / 4));
+    for (p2 = 1; p2 < 100; p2 = p2 + 1) {
+        v2 = (((p2 || p1) >= 6) <= 9);
+    }
+    la0[29] = 9;
+    la0[4] = f0(959, 6, v4, la1[0]);
+    if (((la0[19] != !(371)) <= -((v1 - 553)))) {
+        v1 = 5;
+    } else {
+        p2 = !((unsigned char)((unsigned short)(392)));
+    }
+    switch (213U) {
+    case 23:
+        break;
+    case 29:
+        p1 = p1 + v1;
+        v4 = 122;
+        break;
+    case 409:
+        break;
+    case 725:
+        p0 = ((-(v0) && (long)(p1)) - 9u);
+        break;
+    case 4:
+        if (v4 >= 0 && v4 < 4) { la1[v4] = (7 && (int)(j0)); }
+        p0 = j0;
+    default:
+        v4 = (8L / (g0 * g0 + 1));
+        if (270) {
+            v2 = v4;
+            v0 = 359974737613U;
+            f0(778589608752, f0(la1[2], 934, v3, 48), p1, (short)(p0));
+        }
+        break;
+    }
+    return (f0(5, 1068169768894, ga0[14], la0[3]) <= (char)((unsigned int)(j0)));
+}
+void w2(unsigned int q0) {
+    g0 = g0 * 3 + q0;
+    g0 = g0 * 3 + q0;
+}
+int main() {
+    int v0 = 762923898850;
+    short v1 = 9;
+    long v2 = 698;
+    unsigned int v3 = 392110136012;
+    int v4 = 5;
+    int v5 = 938235417315;
+    int i0 = 468;
+    long j0 = 5;
+    int la0[8];
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { la0[i0] = i0 * 8; }
+    int la1[16];
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { la1[i0] = i0 * 12062806839; }
+    g0 = !(397838801626);
+    if ((((364 - g0) + (g0 + la1[8])) + (v3 - 139198776054))) {
+        v5 = ((f0(286771757738, j0, 9, 980) && (g0 - v2)) + v3);
+        if (g0 >= 0 && g0 < 16) { la1[g0] = !((3 - 10)); }
+        la1[0] = g0;
+    } else {
+        switch (!(v5)) {
+        case 6:
+            v0 = (-((v2 < i0)) == (unsigned char)((6 < 3u)));
+            v1 = (f1(ga0[17], la1[3]) == (f0(la1[11], ga0[2], g0, 497) >= f0(154602480145, j0, 5, v5)));
+            break;
+        case 0:
+            if (-((unsigned char)((i0 - 227)))) {
+                w2(683);
+            } else {
+                w0(v0, 9);
+            }
+            for (v2 = 0; v2 < 3; v2 = v2 + 1) {
+                v1 = v0;
+                v1 = f1(190709944113, 3);
+            }
+        }
+        v4 = (unsigned short)((v1 > (j0 / 13ul)));
+        la1[10] = 2;
+    }
+    w2(910u);
+    for (j0 = 0; j0 < 16; j0 = j0 + 1) {
+        v5 = (v1 * 752);
+    }
+    long h = 0;
+    h = h * 31 + g0;
+    h = h * 31 + v0;
+    h = h * 31 + v1;
+    h = h * 31 + v2;
+    h = h * 31 + v3;
+    h = h * 31 + v4;
+    h = h * 31 + v5;
+    h = h * 31 + i0;
+    h = h * 31 + j0;
+    for (i0 = 0; i0 < 33; i0 = i0 + 1) { h = h * 7 + ga0[i0]; }
+    for (i0 = 0; i0 < 8; i0 = i0 + 1) { h = h * 7 + la0[i0]; }
+    for (i0 = 0; i0 < 16; i0 = i0 + 1) { h = h * 7 + la1[i0]; }
+    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;
+    return h;
+}
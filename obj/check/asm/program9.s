@@ -0,0 +1,2021 @@
+	.section .bss
+	.type g0, @object
+	.size g0, 1
+	.p2align 0
+g0:
+	.zero 1
+	.type ga0, @object
+	.size ga0, 132
+	.p2align 5
+ga0:
+	.zero 132
+	.section .text
+	.type f1.constprop.1, @function
+	.type f0, @function
+	.type f1, @function
+	.type f0.constprop.0, @function
+	.global main
+	.type main, @function
+	.align 16
+f1.constprop.1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movl $0, -4(%rbp)
+	movq $5, -16(%rbp)
+	movw $7, -18(%rbp)
+	movabsq $201025965619, %rax
+	movq %rax, -32(%rbp)
+	movq $7, -40(%rbp)
+	movb $1, -41(%rbp)
+	movl $0, -48(%rbp)
+	movq $207, -56(%rbp)
+	movl $0, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movslq -48(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -160(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -160(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -168(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -176(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -144(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $16, -48(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -48(%rbp), %rax
+	movq %rax, -184(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -184(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L4
+.L5:
+	movl $0, -48(%rbp)
+	cmpl $0, -132(%rbp)
+	je .L6
+	movl $16, %eax
+	movslq -48(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L7
+	.p2align 4,,10
+.L8:
+	movslq -48(%rbp), %rax
+	imull $3, -48(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	imull $3, -48(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	imull $3, -48(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	movslq -48(%rbp), %rax
+	imull $3, -48(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	subq $1, -264(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $16, -48(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movslq -48(%rbp), %rax
+	imull $3, -48(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -48(%rbp)
+	cmpl $16, -48(%rbp)
+	jl .L10
+.L11:
+	movl $56, %eax
+	movq %rax, %rcx
+	movl $563, %eax
+	movq %rax, %rdx
+	movq -16(%rbp), %rax
+	movq %rax, %rsi
+	movl -4(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -48(%rbp)
+	movsbq g0(%rip), %rax
+	movq %rax, -16(%rbp)
+	movq -16(%rbp), %rax
+	addq $882, %rax
+.f1.constprop.1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1.constprop.1, .-f1.constprop.1
+	.align 16
+f0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movw %dx, -8(%rbp)
+	movl %ecx, -12(%rbp)
+	movb $150, -13(%rbp)
+	movq $6, -24(%rbp)
+	movq $10, -32(%rbp)
+	movq $918, -40(%rbp)
+	movl $993, -44(%rbp)
+	movq $4, -56(%rbp)
+	movl $0, -44(%rbp)
+	movl $0, -96(%rbp)
+	movl $10, -92(%rbp)
+	movl $20, -88(%rbp)
+	movl $30, -84(%rbp)
+	movl $40, -80(%rbp)
+	movl $50, -76(%rbp)
+	movl $60, -72(%rbp)
+	movl $70, -68(%rbp)
+	movl $8, -44(%rbp)
+	cmpq $0, -32(%rbp)
+	jne .L17
+	movsbl g0(%rip), %eax
+	cmpl $3, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .L18
+.L17:
+	movl $1, %eax
+.L18:
+	movslq %eax, %rax
+	cmpq $596, %rax
+	jge .L19
+	cmpq $-3, %rax
+	je .L13
+	cmpq $-2, %rax
+	je .L12
+	jmp .L12
+.L19:
+	cmpq $596, %rax
+	je .L14
+	cmpq $817, %rax
+	je .L15
+	jmp .L12
+.L23:
+.L22:
+.L14:
+	movq $0, -56(%rbp)
+	movl $9, %eax
+	subl -44(%rbp), %eax
+	movl %eax, -104(%rbp)
+	cmpq $8, -56(%rbp)
+	jge .L39
+	.p2align 4,,10
+.L38:
+	movq $0, -24(%rbp)
+	movl -104(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpq $16, -24(%rbp)
+	jge .L41
+	.p2align 4,,10
+.L40:
+	cmpl $0, -108(%rbp)
+	je .L42
+.L41:
+	addq $1, -56(%rbp)
+	cmpq $8, -56(%rbp)
+	jl .L38
+.L39:
+.L12:
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	cltd
+	idivl %ecx
+	subl -12(%rbp), %eax
+	movq %rax, %rcx
+	movzbl -13(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -13(%rbp)
+	movzbl -13(%rbp), %eax
+	movl %eax, -116(%rbp)
+	movsbl g0(%rip), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	cmpw $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -4(%rbp)
+	jne .LB0
+.L84:
+.L85:
+	movq $2, -40(%rbp)
+	movq $232, -56(%rbp)
+	movq $232, -56(%rbp)
+	movq $4, -40(%rbp)
+	cmpw $0, -6(%rbp)
+	jne .LB1
+.L86:
+.L87:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpq $0, -56(%rbp)
+	jne .L90
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L91
+.L42:
+.L43:
+	movq -24(%rbp), %rax
+	movzwl %ax, %eax
+	movzwl -6(%rbp), %ecx
+	cmpl %ecx, %eax
+	jne .L44
+	jmp .L41
+.L44:
+.L45:
+	addq $1, -24(%rbp)
+	cmpq $16, -24(%rbp)
+	jl .L40
+	jmp .L41
+.L90:
+	movl $1, %eax
+.L91:
+	imull $10, %eax, %eax
+	popq %rcx
+	imull %ecx, %eax
+	testl %eax, %eax
+	je .L88
+	movzwl -6(%rbp), %eax
+	movq %rax, -40(%rbp)
+	jmp .L89
+.L88:
+	movzwl -6(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movslq -12(%rbp), %rax
+	imulq -24(%rbp), %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+.L89:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl -116(%rbp), %eax
+	cltd
+	idivl %ecx
+.f0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L13:
+	movq -40(%rbp), %rax
+	testb %al, %al
+	jne .LB2
+.L20:
+.L21:
+	movsbl g0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $695, %rax
+	jge .L31
+	cmpq $63, %rax
+	jge .L32
+	cmpq $5, %rax
+	je .L23
+	cmpq $10, %rax
+	je .L24
+	jmp .L22
+.L15:
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L12
+	cmpq $52, %rax
+	je .L49
+	cmpq $378, %rax
+	je .L47
+.L51:
+.L52:
+.L48:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L59
+	leaq .L60(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L53
+	# table target .L56
+	# table target .L58
+	# table target .L57
+	# table target .L55
+	# table target .L54
+	jmp *%rcx
+.L16:
+	jmp .L12
+.L31:
+	cmpq $985, %rax
+	jge .L33
+	cmpq $695, %rax
+	je .L22
+	cmpq $828, %rax
+	je .L22
+	jmp .L22
+.L50:
+	jmp .L12
+.L49:
+	movl $0, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	.p2align 4,,10
+.L82:
+.L83:
+.L46:
+	jmp .L12
+.L32:
+	cmpq $63, %rax
+	je .L22
+	cmpq $166, %rax
+	je .L28
+	jmp .L22
+.L33:
+	cmpq $985, %rax
+	je .L25
+	cmpq $995, %rax
+	je .L27
+	jmp .L22
+.L25:
+	cmpb $0, -13(%rbp)
+	je .L36
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L37
+.L36:
+	movl $0, %eax
+.L37:
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	jmp .L22
+.L29:
+	jmp .L22
+.L30:
+	jmp .L22
+.L47:
+	cmpq $0, -56(%rbp)
+	jl .L51
+	cmpq $8, -56(%rbp)
+	jge .L51
+	movq -56(%rbp), %rax
+	movl $1, -96(%rbp,%rax,4)
+	jmp .L52
+.L59:
+.L53:
+	cmpw $0, -6(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movslq %eax, %rax
+	cmpq $239, %rax
+	jge .L71
+	cmpq $43, %rax
+	jge .L72
+	cmpq $-4, %rax
+	je .L64
+	cmpq $-2, %rax
+	je .L70
+.L64:
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	jne .LB3
+.L74:
+.L75:
+.L63:
+	jmp .L12
+.L71:
+	cmpq $654, %rax
+	jge .L73
+	cmpq $239, %rax
+	je .L68
+	cmpq $253, %rax
+	je .L12
+	jmp .L64
+.L24:
+	movzwl -6(%rbp), %eax
+	movl %eax, -100(%rbp)
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $971, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	cmpb $0, -13(%rbp)
+	jne .LB4
+.L34:
+.L35:
+	jmp .L22
+.L26:
+	jmp .L22
+.L28:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	cmpb $0, -13(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -44(%rbp)
+	jmp .L22
+.L72:
+	cmpq $43, %rax
+	je .L66
+	cmpq $59, %rax
+	je .L69
+	jmp .L64
+.L73:
+	cmpq $654, %rax
+	je .L64
+	cmpq $836, %rax
+	je .L12
+	jmp .L64
+.L68:
+	cmpq $0, -56(%rbp)
+	jne .LB5
+.L76:
+.L77:
+.L69:
+	movq -24(%rbp), %rax
+	addq $4, %rax
+	movq %rax, %rcx
+	cmpl $9, -4(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	jne .LB6
+.L78:
+.L79:
+	jmp .L12
+.L66:
+	movq $4, -24(%rbp)
+	jmp .L12
+.L65:
+	jmp .L12
+.L67:
+	jmp .L12
+.L70:
+	cmpb $0, -13(%rbp)
+	jne .LB7
+.L80:
+.L81:
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $621200163824, %rax
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -40(%rbp)
+	jmp .L12
+.L54:
+	jmp .L53
+.L55:
+	movl ga0+56(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movswq %ax, %rax
+	movq %rax, -24(%rbp)
+	jmp .L53
+.L56:
+	movzwl -8(%rbp), %eax
+	movl %eax, -112(%rbp)
+	imull -112(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $65535, %eax
+	cqo
+	idivq %rcx
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	jne .LB8
+.L61:
+.L62:
+	jmp .L53
+.L57:
+	movzbl -13(%rbp), %eax
+	movswq %ax, %rax
+	movq %rax, -32(%rbp)
+	movsbl g0(%rip), %eax
+	movw %ax, -6(%rbp)
+.L58:
+	jmp .L53
+.LB0:
+	movl ga0+108(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .f0_return
+.LB1:
+	movl $1, %eax
+	jmp .f0_return
+.LB2:
+	cmpl $0, -44(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+.L27:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	cmpb $0, -13(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movl %eax, -44(%rbp)
+	movq -32(%rbp), %rax
+	leaq 15(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $4, %rcx
+	movq %rcx, %rax
+	jmp .f0_return
+.LB3:
+	movq -32(%rbp), %rax
+	jmp .f0_return
+.LB4:
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	cqo
+	idivq %rcx
+	movzbl %al, %eax
+	jmp .f0_return
+.LB6:
+	movl $926, %eax
+	jmp .f0_return
+.LB5:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $178, -56(%rbp), %rax
+	cqo
+	idivq %rcx
+	jmp .f0_return
+.LB8:
+	movl $1, %eax
+	jmp .f0_return
+.LB7:
+	movzwl -6(%rbp), %eax
+	cmpl $608, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0_return
+	.size f0, .-f0
+	.pushsection .rodata
+	.p2align 2
+.L60:
+	.long .L56-.L60
+	.long .L53-.L60
+	.long .L58-.L60
+	.long .L57-.L60
+	.long .L53-.L60
+	.long .L55-.L60
+	.long .L53-.L60
+	.long .L53-.L60
+	.long .L53-.L60
+	.long .L53-.L60
+	.long .L54-.L60
+	.popsection
+	.align 16
+f1:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movq %rdi, -8(%rbp)
+	movl %esi, -12(%rbp)
+	movl $0, -16(%rbp)
+	movq $5, -24(%rbp)
+	movw $7, -26(%rbp)
+	movabsq $201025965619, %rax
+	movq %rax, -40(%rbp)
+	movq $7, -48(%rbp)
+	movb $1, -49(%rbp)
+	movl $0, -56(%rbp)
+	movq $207, -64(%rbp)
+	movl $0, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -132(%rbp)
+	testl %eax, %eax
+	je .L92
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -144(%rbp)
+	cmpq $0, -144(%rbp)
+	je .L93
+	.p2align 4,,10
+.L94:
+	movslq -56(%rbp), %rax
+	movq %rax, -152(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -152(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	movq %rax, -160(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -160(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -168(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -176(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -144(%rbp)
+	jne .L94
+.L95:
+.L92:
+.L93:
+	cmpl $16, -56(%rbp)
+	jge .L97
+	.p2align 4,,10
+.L96:
+	movslq -56(%rbp), %rax
+	movq %rax, -184(%rbp)
+	movabsq $183760455345, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -184(%rbp), %rax
+	movl %ecx, -128(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L96
+.L97:
+	movl $0, -56(%rbp)
+	cmpl $0, -132(%rbp)
+	je .L98
+	movl $16, %eax
+	movslq -56(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L99
+	.p2align 4,,10
+.L100:
+	movslq -56(%rbp), %rax
+	imull $3, -56(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	imull $3, -56(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	imull $3, -56(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	movslq -56(%rbp), %rax
+	imull $3, -56(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	subq $1, -264(%rbp)
+	jne .L100
+.L101:
+.L98:
+.L99:
+	cmpl $16, -56(%rbp)
+	jge .L103
+	.p2align 4,,10
+.L102:
+	movslq -56(%rbp), %rax
+	imull $3, -56(%rbp), %ecx
+	movl %ecx, -256(%rbp,%rax,4)
+	addl $1, -56(%rbp)
+	cmpl $16, -56(%rbp)
+	jl .L102
+.L103:
+	cmpq $0, -8(%rbp)
+	jl .L104
+	cmpq $16, -8(%rbp)
+	jge .L104
+	movl -16(%rbp), %eax
+	movq %rax, %rcx
+	movl -100(%rbp), %eax
+	movq %rax, %rdx
+	movl -84(%rbp), %eax
+	movq %rax, %rsi
+	movswl -26(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L106
+	movl -208(%rbp), %eax
+	movq %rax, %rdx
+	movl $2, %eax
+	movq %rax, %rsi
+	movq -64(%rbp), %rax
+	movq %rax, %rdi
+	call f0.constprop.0
+	testw %ax, %ax
+	setne %al
+	movzbl %al, %eax
+	jmp .L107
+.L106:
+	movl $0, %eax
+.L107:
+	movq %rax, %rcx
+	movq -8(%rbp), %rax
+	movl %ecx, -256(%rbp,%rax,4)
+.L104:
+.L105:
+	movl $56, %eax
+	movq %rax, %rcx
+	movl $563, %eax
+	movq %rax, %rdx
+	movq -24(%rbp), %rax
+	movq %rax, %rsi
+	movl -16(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -56(%rbp)
+	movsbq g0(%rip), %rax
+	movq %rax, -24(%rbp)
+	movq -24(%rbp), %rax
+	addq $882, %rax
+.f1_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.size f1, .-f1
+	.align 16
+f0.constprop.0:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $128, %rsp
+	movl %edi, -4(%rbp)
+	movw %si, -6(%rbp)
+	movw %dx, -8(%rbp)
+	movb $150, -9(%rbp)
+	movq $6, -24(%rbp)
+	movq $10, -32(%rbp)
+	movq $918, -40(%rbp)
+	movl $993, -44(%rbp)
+	movq $4, -56(%rbp)
+	movl $0, -44(%rbp)
+	movl $0, -96(%rbp)
+	movl $10, -92(%rbp)
+	movl $20, -88(%rbp)
+	movl $30, -84(%rbp)
+	movl $40, -80(%rbp)
+	movl $50, -76(%rbp)
+	movl $60, -72(%rbp)
+	movl $70, -68(%rbp)
+	movl $8, -44(%rbp)
+	cmpq $0, -32(%rbp)
+	jne .L113
+	movsbl g0(%rip), %eax
+	cmpl $3, %eax
+	setl %al
+	movzbl %al, %eax
+	jmp .L114
+.L113:
+	movl $1, %eax
+.L114:
+	movslq %eax, %rax
+	cmpq $596, %rax
+	jge .L115
+	cmpq $-3, %rax
+	je .L109
+	cmpq $-2, %rax
+	je .L108
+	jmp .L108
+.L115:
+	cmpq $596, %rax
+	je .L110
+	cmpq $817, %rax
+	je .L111
+	jmp .L108
+.L119:
+.L118:
+.L110:
+	movq $0, -56(%rbp)
+	movl $9, %eax
+	subl -44(%rbp), %eax
+	movl %eax, -104(%rbp)
+	cmpq $8, -56(%rbp)
+	jge .L135
+	.p2align 4,,10
+.L134:
+	movq $0, -24(%rbp)
+	movl -104(%rbp), %eax
+	movl %eax, -108(%rbp)
+	cmpq $16, -24(%rbp)
+	jge .L137
+	.p2align 4,,10
+.L136:
+	cmpl $0, -108(%rbp)
+	je .L138
+.L137:
+	addq $1, -56(%rbp)
+	cmpq $8, -56(%rbp)
+	jl .L134
+.L135:
+.L108:
+	movl -44(%rbp), %eax
+	imull -44(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $4, %eax
+	cltd
+	idivl %ecx
+	subl $505, %eax
+	movq %rax, %rcx
+	movzbl -9(%rbp), %eax
+	addl %ecx, %eax
+	movb %al, -9(%rbp)
+	movzbl -9(%rbp), %eax
+	movl %eax, -116(%rbp)
+	movsbl g0(%rip), %ecx
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	cmpl %ecx, %eax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+	cmpw $0, -8(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -32(%rbp)
+	cmpl $0, -4(%rbp)
+	jne .LB9
+.L180:
+.L181:
+	movq $2, -40(%rbp)
+	movq $232, -56(%rbp)
+	movq $232, -56(%rbp)
+	movq $4, -40(%rbp)
+	cmpw $0, -6(%rbp)
+	jne .LB10
+.L182:
+.L183:
+	cmpq $0, -24(%rbp)
+	sete %al
+	movzbl %al, %eax
+	cmpl $3, %eax
+	sete %al
+	movzbl %al, %eax
+	pushq %rax
+	cmpq $0, -56(%rbp)
+	jne .L186
+	cmpq $0, -40(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L187
+.L138:
+.L139:
+	movq -24(%rbp), %rax
+	movzwl %ax, %eax
+	movzwl -6(%rbp), %ecx
+	cmpl %ecx, %eax
+	jne .L140
+	jmp .L137
+.L140:
+.L141:
+	addq $1, -24(%rbp)
+	cmpq $16, -24(%rbp)
+	jl .L136
+	jmp .L137
+.L186:
+	movl $1, %eax
+.L187:
+	imull $10, %eax, %eax
+	popq %rcx
+	imull %ecx, %eax
+	testl %eax, %eax
+	je .L184
+	movzwl -6(%rbp), %eax
+	movq %rax, -40(%rbp)
+	jmp .L185
+.L184:
+	movzwl -6(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $505, -24(%rbp), %rax
+	cmpq %rcx, %rax
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -44(%rbp)
+.L185:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl -116(%rbp), %eax
+	cltd
+	idivl %ecx
+.f0.constprop.0_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L109:
+	movq -40(%rbp), %rax
+	testb %al, %al
+	jne .LB11
+.L116:
+.L117:
+	movsbl g0(%rip), %eax
+	movslq %eax, %rax
+	cmpq $695, %rax
+	jge .L127
+	cmpq $63, %rax
+	jge .L128
+	cmpq $5, %rax
+	je .L119
+	cmpq $10, %rax
+	je .L120
+	jmp .L118
+.L111:
+	movl -88(%rbp), %eax
+	movslq %eax, %rax
+	cmpq $1, %rax
+	je .L108
+	cmpq $52, %rax
+	je .L145
+	cmpq $378, %rax
+	je .L143
+.L147:
+.L148:
+.L144:
+	xorl %eax, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $10, %rcx
+	ja .L155
+	leaq .L156(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L149
+	# table target .L152
+	# table target .L154
+	# table target .L153
+	# table target .L151
+	# table target .L150
+	jmp *%rcx
+.L112:
+	jmp .L108
+.L127:
+	cmpq $985, %rax
+	jge .L129
+	cmpq $695, %rax
+	je .L118
+	cmpq $828, %rax
+	je .L118
+	jmp .L118
+.L146:
+	jmp .L108
+.L145:
+	movl $0, -4(%rbp)
+	cmpl $4, -4(%rbp)
+	.p2align 4,,10
+.L178:
+.L179:
+.L142:
+	jmp .L108
+.L128:
+	cmpq $63, %rax
+	je .L118
+	cmpq $166, %rax
+	je .L124
+	jmp .L118
+.L129:
+	cmpq $985, %rax
+	je .L121
+	cmpq $995, %rax
+	je .L123
+	jmp .L118
+.L121:
+	cmpb $0, -9(%rbp)
+	je .L132
+	cmpq $0, -32(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .L133
+.L132:
+	movl $0, %eax
+.L133:
+	cmpl $6, %eax
+	setge %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	movq %rax, -40(%rbp)
+	jmp .L118
+.L125:
+	jmp .L118
+.L126:
+	jmp .L118
+.L143:
+	cmpq $0, -56(%rbp)
+	jl .L147
+	cmpq $8, -56(%rbp)
+	jge .L147
+	movq -56(%rbp), %rax
+	movl $1, -96(%rbp,%rax,4)
+	jmp .L148
+.L155:
+.L149:
+	cmpw $0, -6(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movswl %ax, %eax
+	movslq %eax, %rax
+	cmpq $239, %rax
+	jge .L167
+	cmpq $43, %rax
+	jge .L168
+	cmpq $-4, %rax
+	je .L160
+	cmpq $-2, %rax
+	je .L166
+.L160:
+	xorl %eax, %eax
+	subq -32(%rbp), %rax
+	jne .LB12
+.L170:
+.L171:
+.L159:
+	jmp .L108
+.L167:
+	cmpq $654, %rax
+	jge .L169
+	cmpq $239, %rax
+	je .L164
+	cmpq $253, %rax
+	je .L108
+	jmp .L160
+.L120:
+	movzwl -6(%rbp), %eax
+	movl %eax, -100(%rbp)
+	imull -100(%rbp), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl $971, %eax
+	cltd
+	idivl %ecx
+	movslq %eax, %rax
+	addq %rax, -32(%rbp)
+	cmpb $0, -9(%rbp)
+	jne .LB13
+.L130:
+.L131:
+	jmp .L118
+.L122:
+	jmp .L118
+.L124:
+	movq -24(%rbp), %rax
+	imulq -24(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	cmpb $0, -9(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movq %rax, %rcx
+	movslq -44(%rbp), %rax
+	addq %rcx, %rax
+	movl %eax, -44(%rbp)
+	jmp .L118
+.L168:
+	cmpq $43, %rax
+	je .L162
+	cmpq $59, %rax
+	je .L165
+	jmp .L160
+.L169:
+	cmpq $654, %rax
+	je .L160
+	cmpq $836, %rax
+	je .L108
+	jmp .L160
+.L164:
+	cmpq $0, -56(%rbp)
+	jne .LB14
+.L172:
+.L173:
+.L165:
+	movq -24(%rbp), %rax
+	addq $4, %rax
+	movq %rax, %rcx
+	cmpl $9, -4(%rbp)
+	setne %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq %rcx, %rax
+	jne .LB15
+.L174:
+.L175:
+	jmp .L108
+.L162:
+	movq $4, -24(%rbp)
+	jmp .L108
+.L161:
+	jmp .L108
+.L163:
+	jmp .L108
+.L166:
+	cmpb $0, -9(%rbp)
+	jne .LB16
+.L176:
+.L177:
+	movl -84(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movabsq $621200163824, %rax
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subq %rcx, %rax
+	movq %rax, -40(%rbp)
+	jmp .L108
+.L150:
+	jmp .L149
+.L151:
+	movl ga0+56(%rip), %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movswq %ax, %rax
+	movq %rax, -24(%rbp)
+	jmp .L149
+.L152:
+	movzwl -8(%rbp), %eax
+	movl %eax, -112(%rbp)
+	imull -112(%rbp), %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	movl $65535, %eax
+	cqo
+	idivq %rcx
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	testq %rax, %rax
+	jne .LB17
+.L157:
+.L158:
+	jmp .L149
+.L153:
+	movzbl -9(%rbp), %eax
+	movswq %ax, %rax
+	movq %rax, -32(%rbp)
+	movsbl g0(%rip), %eax
+	movw %ax, -6(%rbp)
+.L154:
+	jmp .L149
+.LB9:
+	movl ga0+108(%rip), %eax
+	movslq %eax, %rax
+	cmpq %rax, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.LB10:
+	movl $1, %eax
+	jmp .f0.constprop.0_return
+.LB11:
+	cmpl $0, -44(%rbp)
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.L123:
+	movq -32(%rbp), %rax
+	imulq -32(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	cmpb $0, -9(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cqo
+	idivq %rcx
+	movl %eax, -44(%rbp)
+	movq -32(%rbp), %rax
+	leaq 15(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $4, %rcx
+	movq %rcx, %rax
+	jmp .f0.constprop.0_return
+.LB12:
+	movq -32(%rbp), %rax
+	jmp .f0.constprop.0_return
+.LB13:
+	movq -56(%rbp), %rax
+	imulq -56(%rbp), %rax
+	addq $1, %rax
+	movq %rax, %rcx
+	movl $4294967295, %eax
+	cqo
+	idivq %rcx
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+.LB15:
+	movl $926, %eax
+	jmp .f0.constprop.0_return
+.LB14:
+	movsbl g0(%rip), %eax
+	movsbl g0(%rip), %ecx
+	imull %ecx, %eax
+	addl $1, %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $178, -56(%rbp), %rax
+	cqo
+	idivq %rcx
+	jmp .f0.constprop.0_return
+.LB17:
+	movl $1, %eax
+	jmp .f0.constprop.0_return
+.LB16:
+	movzwl -6(%rbp), %eax
+	cmpl $608, %eax
+	setg %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	movzwl -8(%rbp), %eax
+	cmpl %ecx, %eax
+	setne %al
+	movzbl %al, %eax
+	jmp .f0.constprop.0_return
+	.size f0.constprop.0, .-f0.constprop.0
+	.pushsection .rodata
+	.p2align 2
+.L156:
+	.long .L152-.L156
+	.long .L149-.L156
+	.long .L154-.L156
+	.long .L153-.L156
+	.long .L149-.L156
+	.long .L151-.L156
+	.long .L149-.L156
+	.long .L149-.L156
+	.long .L149-.L156
+	.long .L149-.L156
+	.long .L150-.L156
+	.popsection
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $272, %rsp
+	movl $-1580279838, -4(%rbp)
+	movw $9, -6(%rbp)
+	movq $698, -16(%rbp)
+	movl $1268112076, -20(%rbp)
+	movl $5, -24(%rbp)
+	movl $1932546787, -28(%rbp)
+	movl $468, -32(%rbp)
+	movq $5, -40(%rbp)
+	movl $0, -32(%rbp)
+	movl $0, -80(%rbp)
+	movl $8, -76(%rbp)
+	movl $16, -72(%rbp)
+	movl $24, -68(%rbp)
+	movl $32, -64(%rbp)
+	movl $40, -60(%rbp)
+	movl $48, -56(%rbp)
+	movl $56, -52(%rbp)
+	movl $8, -32(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -148(%rbp)
+	testl %eax, %eax
+	je .L188
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -160(%rbp)
+	cmpq $0, -160(%rbp)
+	je .L191
+	.p2align 4,,10
+.L190:
+	movslq -32(%rbp), %rax
+	movq %rax, -168(%rbp)
+	movabsq $12062806839, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -168(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -176(%rbp)
+	movabsq $12062806839, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -176(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -184(%rbp)
+	movabsq $12062806839, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -184(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movq %rax, -192(%rbp)
+	movabsq $12062806839, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -192(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	subq $1, -160(%rbp)
+	jne .L190
+.L191:
+.L188:
+.L189:
+	cmpl $16, -32(%rbp)
+	jge .L193
+	.p2align 4,,10
+.L192:
+	movslq -32(%rbp), %rax
+	movq %rax, -200(%rbp)
+	movabsq $12062806839, %rcx
+	imulq %rcx, %rax
+	movq %rax, %rcx
+	movq -200(%rbp), %rax
+	movl %ecx, -144(%rbp,%rax,4)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L192
+.L193:
+	movb $0, g0(%rip)
+	movl -20(%rbp), %eax
+	movq %rax, -208(%rbp)
+	movabsq $139198776054, %rcx
+	subq %rcx, %rax
+	pushq %rax
+	movsbl g0(%rip), %eax
+	movl -112(%rbp), %ecx
+	addl %ecx, %eax
+	pushq %rax
+	movl $364, %eax
+	movsbl g0(%rip), %ecx
+	subl %ecx, %eax
+	popq %rcx
+	addl %ecx, %eax
+	movslq %eax, %rax
+	popq %rcx
+	addq %rcx, %rax
+	je .L194
+	movl $980, %eax
+	movq %rax, %rcx
+	movl $9, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $3303916202, %eax
+	movq %rax, %rdi
+	call f0
+	testw %ax, %ax
+	je .L196
+	movsbq g0(%rip), %rax
+	subq -16(%rbp), %rax
+	testq %rax, %rax
+	setne %al
+	movzbl %al, %eax
+	jmp .L197
+.L196:
+	movl $0, %eax
+.L197:
+	addl -20(%rbp), %eax
+	movl %eax, -28(%rbp)
+	movsbl g0(%rip), %eax
+	testl %eax, %eax
+	jl .L198
+	movsbl g0(%rip), %eax
+	cmpl $16, %eax
+	jge .L198
+	movsbq g0(%rip), %rax
+	movl $0, -144(%rbp,%rax,4)
+.L198:
+.L199:
+	movsbl g0(%rip), %eax
+	movl %eax, -144(%rbp)
+	jmp .L195
+.L194:
+	cmpl $0, -28(%rbp)
+	sete %al
+	movzbl %al, %eax
+	movslq %eax, %rax
+	cmpq $0, %rax
+	je .L202
+	cmpq $6, %rax
+	je .L201
+	jmp .L200
+.L203:
+	movslq -4(%rbp), %rax
+	movq %rax, -216(%rbp)
+	movl ga0+104(%rip), %eax
+	movslq %eax, %rax
+	addq -216(%rbp), %rax
+	movl %eax, ga0+12(%rip)
+.L206:
+.L204:
+	movq $0, -16(%rbp)
+	movl -4(%rbp), %eax
+	movw %ax, -218(%rbp)
+	movw %ax, -6(%rbp)
+	call f1.constprop.1
+	movzbl %al, %eax
+	movw %ax, -6(%rbp)
+	movswl -218(%rbp), %eax
+	movw %ax, -6(%rbp)
+	call f1.constprop.1
+	movzbl %al, %eax
+	movw %ax, -6(%rbp)
+	movswl -218(%rbp), %eax
+	movw %ax, -6(%rbp)
+	call f1.constprop.1
+	movzbl %al, %eax
+	movw %ax, -6(%rbp)
+	movq $3, -16(%rbp)
+.L200:
+	movq -40(%rbp), %rax
+	movl $13, %ecx
+	xorl %edx, %edx
+	divq %rcx
+	movq %rax, %rcx
+	movswq -6(%rbp), %rax
+	cmpq %rcx, %rax
+	seta %al
+	movzbl %al, %eax
+	movzwl %ax, %eax
+	movl %eax, -24(%rbp)
+	movl $2, -104(%rbp)
+.L195:
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $910, %eax
+	movb %al, g0(%rip)
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $910, %eax
+	movb %al, g0(%rip)
+.L207:
+	movq $0, -40(%rbp)
+	movswl -6(%rbp), %eax
+	imull $752, %eax, %eax
+	movl %eax, -224(%rbp)
+	cmpq $16, -40(%rbp)
+	jge .L208
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	movl $16, %eax
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -232(%rbp)
+	cmpq $0, -232(%rbp)
+	je .L211
+	.p2align 4,,10
+.L210:
+	movl -224(%rbp), %eax
+	movl %eax, -28(%rbp)
+	addq $1, -40(%rbp)
+	movl -224(%rbp), %eax
+	movl %eax, -28(%rbp)
+	addq $1, -40(%rbp)
+	movl -224(%rbp), %eax
+	movl %eax, -28(%rbp)
+	addq $1, -40(%rbp)
+	movl -224(%rbp), %eax
+	movl %eax, -28(%rbp)
+	addq $1, -40(%rbp)
+	subq $1, -232(%rbp)
+	jne .L210
+.L211:
+.L208:
+.L209:
+	cmpq $16, -40(%rbp)
+	jge .L213
+	.p2align 4,,10
+.L212:
+	movl -224(%rbp), %eax
+	movl %eax, -28(%rbp)
+	addq $1, -40(%rbp)
+	cmpq $16, -40(%rbp)
+	jl .L212
+.L213:
+	movq $0, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movsbq g0(%rip), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movslq -4(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movswq -6(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -16(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -208(%rbp), %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movslq -24(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	movslq -32(%rbp), %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	imulq $31, -240(%rbp), %rax
+	addq -40(%rbp), %rax
+	movq %rax, -240(%rbp)
+	movl $0, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jge .L214
+	movl $33, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -248(%rbp)
+	cmpq $0, -248(%rbp)
+	je .L217
+	.p2align 4,,10
+.L216:
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -248(%rbp)
+	jne .L216
+.L217:
+.L214:
+.L215:
+	cmpl $33, -32(%rbp)
+	jge .L219
+	.p2align 4,,10
+.L218:
+	movslq -32(%rbp), %rax
+	leaq ga0(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $33, -32(%rbp)
+	jl .L218
+.L219:
+	movl $0, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jge .L220
+	movl $8, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -256(%rbp)
+	cmpq $0, -256(%rbp)
+	je .L223
+	.p2align 4,,10
+.L222:
+	movslq -32(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -256(%rbp)
+	jne .L222
+.L223:
+.L220:
+.L221:
+	cmpl $8, -32(%rbp)
+	jge .L225
+	.p2align 4,,10
+.L224:
+	movslq -32(%rbp), %rax
+	movl -80(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $8, -32(%rbp)
+	jl .L224
+.L225:
+	movl $0, -32(%rbp)
+	cmpl $0, -148(%rbp)
+	je .L226
+	movl $16, %eax
+	movslq -32(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -264(%rbp)
+	cmpq $0, -264(%rbp)
+	je .L229
+	.p2align 4,,10
+.L228:
+	movslq -32(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	movslq -32(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	subq $1, -264(%rbp)
+	jne .L228
+.L229:
+.L226:
+.L227:
+	cmpl $16, -32(%rbp)
+	jge .L231
+	.p2align 4,,10
+.L230:
+	movslq -32(%rbp), %rax
+	movl -144(%rbp,%rax,4), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	imulq $7, -240(%rbp), %rax
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	addl $1, -32(%rbp)
+	cmpl $16, -32(%rbp)
+	jl .L230
+.L231:
+	movq -240(%rbp), %rax
+	movabsq $1099511627776, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -240(%rbp), %rax
+	movabsq $4294967296, %rcx
+	cqo
+	idivq %rcx
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 16777215(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $24, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 65535(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $16, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq -240(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	addq -240(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -240(%rbp)
+	movq -240(%rbp), %rax
+.main_return:
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.L202:
+	movl -32(%rbp), %eax
+	subl $227, %eax
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	je .L203
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $683, %eax
+	movb %al, g0(%rip)
+	movsbl g0(%rip), %eax
+	imull $3, %eax, %eax
+	addl $683, %eax
+	movb %al, g0(%rip)
+.L205:
+	jmp .L204
+.L201:
+	movslq -32(%rbp), %rax
+	cmpq %rax, -16(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movq %rax, %rcx
+	xorl %eax, %eax
+	subl %ecx, %eax
+	testl %eax, %eax
+	sete %al
+	movzbl %al, %eax
+	movl %eax, -4(%rbp)
+	movl -28(%rbp), %eax
+	movq %rax, %rcx
+	movl $5, %eax
+	movq %rax, %rdx
+	movq -40(%rbp), %rax
+	movq %rax, %rsi
+	movl $4278624785, %eax
+	movq %rax, %rdi
+	call f0
+	movzwl %ax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $497, %eax
+	movq %rax, %rcx
+	movsbl g0(%rip), %eax
+	movq %rax, %rdx
+	movl ga0+8(%rip), %eax
+	movq %rax, %rsi
+	movl -100(%rbp), %eax
+	movq %rax, %rdi
+	call f0
+	addq $8, %rsp
+	movzwl %ax, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	setge %al
+	movzbl %al, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl -132(%rbp), %eax
+	movq %rax, %rsi
+	movl ga0+68(%rip), %eax
+	movslq %eax, %rax
+	movq %rax, %rdi
+	call f1
+	addq $8, %rsp
+	movzbl %al, %eax
+	popq %rcx
+	cmpl %ecx, %eax
+	sete %al
+	movzbl %al, %eax
+	movw %ax, -6(%rbp)
+	jmp .L200
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
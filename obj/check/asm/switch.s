@@ -0,0 +1,241 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movl $0, -24(%rbp)
+	movl $-2, -20(%rbp)
+	cmpl $10, -20(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movl -20(%rbp), %eax
+	addl $3, %eax
+	pushq %rax
+	movl -20(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movl $0, -12(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rax
+	movq %rax, %rcx
+	cmpq $7, %rcx
+	ja .L12
+	leaq .L13(%rip), %rdx
+	movslq (%rdx,%rcx,4), %rcx
+	addq %rdx, %rcx
+	# table target .L11
+	# table target .L4
+	# table target .L5
+	# table target .L6
+	# table target .L7
+	# table target .L8
+	# table target .L9
+	# table target .L10
+	jmp *%rcx
+.L12:
+.L11:
+	movl $99, -12(%rbp)
+.L3:
+	movl -12(%rbp), %eax
+.L2:
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -24(%rbp)
+	addl $1, -20(%rbp)
+	cmpl $10, -20(%rbp)
+	jl .L0
+.L1:
+	movl $0, -20(%rbp)
+	cmpl $64, -20(%rbp)
+	jge .L14
+	movl $64, %eax
+	movslq -20(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $1, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L17
+	.p2align 4,,10
+.L16:
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	pushq %rax
+	movl -20(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rax
+	leaq -4(%rax), %rcx
+	cmpq $56, %rcx
+	ja .L23
+	movabsq $1099528470785, %rdx
+	btq %rcx, %rdx
+	jc .L20
+	movabsq $72057594038976528, %rdx
+	btq %rcx, %rdx
+	jc .L21
+.L23:
+.L22:
+	movl $3, %eax
+.L19:
+.L18:
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -24(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -20(%rbp)
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	pushq %rax
+	movl -20(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rax
+	leaq -4(%rax), %rcx
+	cmpq $56, %rcx
+	ja .L29
+	movabsq $1099528470785, %rdx
+	btq %rcx, %rdx
+	jc .L26
+	movabsq $72057594038976528, %rdx
+	btq %rcx, %rdx
+	jc .L27
+.L29:
+.L28:
+	movl $3, %eax
+.L25:
+.L24:
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -24(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -20(%rbp)
+	subq $1, -8(%rbp)
+	jne .L16
+.L17:
+.L14:
+.L15:
+	cmpl $64, -20(%rbp)
+	jge .L31
+	.p2align 4,,10
+.L30:
+	movl -20(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -12(%rbp)
+	pushq %rax
+	movl -20(%rbp), %eax
+	movl %eax, -16(%rbp)
+	movl -16(%rbp), %eax
+	movslq %eax, %rax
+	leaq -4(%rax), %rcx
+	cmpq $56, %rcx
+	ja .L37
+	movabsq $1099528470785, %rdx
+	btq %rcx, %rdx
+	jc .L34
+	movabsq $72057594038976528, %rdx
+	btq %rcx, %rdx
+	jc .L35
+.L37:
+.L36:
+	movl $3, %eax
+.L33:
+.L32:
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -24(%rbp)
+	movl -12(%rbp), %eax
+	movl %eax, -20(%rbp)
+	cmpl $64, -20(%rbp)
+	jl .L30
+.L31:
+	movl -24(%rbp), %eax
+	addl $2, %eax
+	addl $26, %eax
+	addl $45, %eax
+	addl $52, %eax
+	addl $25, %eax
+	addl $42, %eax
+	addl $77, %eax
+	addl $104, %eax
+	addl $117, %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -24(%rbp), %eax
+	subl %ecx, %eax
+	leave
+	ret
+.L34:
+	movl $1, %eax
+	jmp .L32
+.L20:
+	movl $1, %eax
+	jmp .L18
+.L26:
+	movl $1, %eax
+	jmp .L24
+.L35:
+	movl $2, %eax
+	jmp .L32
+.L21:
+	movl $2, %eax
+	jmp .L18
+.L27:
+	movl $2, %eax
+	jmp .L24
+.L4:
+	movl $10, -12(%rbp)
+	jmp .L3
+.L5:
+	movl $11, -12(%rbp)
+.L6:
+	addl $12, -12(%rbp)
+	jmp .L3
+.L7:
+	movl $13, -12(%rbp)
+	jmp .L3
+.L8:
+	movl $15, -12(%rbp)
+	jmp .L3
+.L9:
+	movl $16, -12(%rbp)
+.L10:
+	addl $17, -12(%rbp)
+	jmp .L3
+	.size main, .-main
+	.pushsection .rodata
+	.p2align 2
+.L13:
+	.long .L4-.L13
+	.long .L5-.L13
+	.long .L6-.L13
+	.long .L7-.L13
+	.long .L8-.L13
+	.long .L8-.L13
+	.long .L9-.L13
+	.long .L10-.L13
+	.popsection
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
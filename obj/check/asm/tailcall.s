@@ -0,0 +1,143 @@
+	.section .text
+	.global main
+	.type main, @function
+	.type even, @function
+	.type odd, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movl $19999998, %eax
+	movq %rax, %rdi
+	call even
+.L2:
+.L1:
+.L0:
+	imull $2, %eax, %eax
+	pushq %rax
+	subq $8, %rsp
+	movl $19999998, %eax
+	movq %rax, %rdi
+	call odd
+	addq $8, %rsp
+.L5:
+.L4:
+.L3:
+	popq %rcx
+	addl %ecx, %eax
+	popq %rbp
+	ret
+	.size main, .-main
+	.align 16
+even:
+	pushq %rbp
+	movq %rsp, %rbp
+	movl %edi, -4(%rbp)
+.even_entry:
+	cmpl $0, -4(%rbp)
+	je .LB0
+.L6:
+.L7:
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -4(%rbp)
+	je .LB1
+.L8:
+.L9:
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -4(%rbp)
+	je .LB2
+.L10:
+.L11:
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -4(%rbp)
+	je .LB3
+.L12:
+.L13:
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	jmp .even_entry
+.LB0:
+	movl $1, %eax
+.even_return:
+	popq %rbp
+	ret
+.LB1:
+	movl $0, %eax
+	jmp .even_return
+.LB2:
+	movl $1, %eax
+	jmp .even_return
+.LB3:
+	movl $0, %eax
+	jmp .even_return
+	.size even, .-even
+	.align 16
+odd:
+	pushq %rbp
+	movq %rsp, %rbp
+	movl %edi, -4(%rbp)
+.odd_entry:
+	cmpl $0, -4(%rbp)
+	je .LB4
+.L14:
+.L15:
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -4(%rbp)
+	je .LB5
+.L16:
+.L17:
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -4(%rbp)
+	je .LB6
+.L18:
+.L19:
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	cmpl $0, -4(%rbp)
+	je .LB7
+.L20:
+.L21:
+	movl -4(%rbp), %eax
+	subl $1, %eax
+	movl %eax, -4(%rbp)
+	jmp .odd_entry
+.LB4:
+	movl $0, %eax
+.odd_return:
+	popq %rbp
+	ret
+.LB5:
+	movl $1, %eax
+	jmp .odd_return
+.LB6:
+	movl $0, %eax
+	jmp .odd_return
+.LB7:
+	movl $1, %eax
+	jmp .odd_return
+	.size odd, .-odd
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
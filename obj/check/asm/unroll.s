@@ -0,0 +1,97 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq $0, -24(%rbp)
+	movl $0, -36(%rbp)
+	cmpl $200, -36(%rbp)
+	jge .L1
+	.p2align 4,,10
+.L0:
+	movl $1000000, %eax
+	subl -36(%rbp), %eax
+	movl %eax, -32(%rbp)
+	movq $0, -16(%rbp)
+	movl $0, -28(%rbp)
+	movl -28(%rbp), %eax
+	cmpl -32(%rbp), %eax
+	jge .L3
+	movslq -32(%rbp), %rax
+	movslq -28(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L4
+	.p2align 4,,10
+.L5:
+	movslq -28(%rbp), %rax
+	imulq $12345, %rax, %rax
+	addq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	imulq $12345, %rax, %rax
+	addq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	imulq $12345, %rax, %rax
+	addq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	movslq -28(%rbp), %rax
+	imulq $12345, %rax, %rax
+	addq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	subq $1, -8(%rbp)
+	jne .L5
+.L6:
+.L3:
+.L4:
+	movl -28(%rbp), %eax
+	cmpl -32(%rbp), %eax
+	jge .L8
+	.p2align 4,,10
+.L7:
+	movslq -28(%rbp), %rax
+	imulq $12345, %rax, %rax
+	addq %rax, -16(%rbp)
+	addl $1, -28(%rbp)
+	movl -28(%rbp), %eax
+	cmpl -32(%rbp), %eax
+	jl .L7
+.L8:
+	movq -16(%rbp), %rax
+.L2:
+	addq %rax, -24(%rbp)
+	addl $1, -36(%rbp)
+	cmpl $200, -36(%rbp)
+	jl .L0
+.L1:
+	movq -24(%rbp), %rax
+	leaq 255(%rax), %rcx
+	testq %rax, %rax
+	cmovnsq %rax, %rcx
+	sarq $8, %rcx
+	movq %rcx, %rax
+	salq $8, %rax
+	movq %rax, %rcx
+	movq -24(%rbp), %rax
+	subq %rcx, %rax
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
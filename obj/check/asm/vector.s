@@ -0,0 +1,571 @@
+	.section .bss
+	.type a, @object
+	.size a, 412
+	.p2align 5
+a:
+	.zero 412
+	.type b, @object
+	.size b, 412
+	.p2align 5
+b:
+	.zero 412
+	.section .text
+	.global main
+	.type main, @function
+	.type shift, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $48, %rsp
+	movl $103, -36(%rbp)
+	movl $0, -16(%rbp)
+	movl -16(%rbp), %eax
+	cmpl -36(%rbp), %eax
+	jge .L0
+	movslq -36(%rbp), %rax
+	movslq -16(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	imull $3, -16(%rbp), %eax
+	subl $100, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -16(%rbp)
+	imull $3, -16(%rbp), %eax
+	subl $100, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -16(%rbp)
+	imull $3, -16(%rbp), %eax
+	subl $100, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -16(%rbp)
+	imull $3, -16(%rbp), %eax
+	subl $100, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -16(%rbp)
+	subq $1, -8(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	movl -16(%rbp), %eax
+	cmpl -36(%rbp), %eax
+	jge .L5
+	.p2align 4,,10
+.L4:
+	imull $3, -16(%rbp), %eax
+	subl $100, %eax
+	movq %rax, %rcx
+	movslq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	cmpl -36(%rbp), %eax
+	jl .L4
+.L5:
+	movl $0, -32(%rbp)
+	movl $0, -16(%rbp)
+	pxor %xmm7, %xmm7
+	leaq a(%rip), %rsi
+	movl -36(%rbp), %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -16(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L8
+	.p2align 4,,10
+.L7:
+	movdqu (%rsi,%rcx,4), %xmm0
+	paddd %xmm0, %xmm7
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L7
+	movl %ecx, -16(%rbp)
+	pshufd $78, %xmm7, %xmm6
+	paddd %xmm6, %xmm7
+	pshufd $177, %xmm7, %xmm6
+	paddd %xmm6, %xmm7
+	movd %xmm7, %eax
+	addl %eax, -32(%rbp)
+.L8:
+.L6:
+	movl -16(%rbp), %eax
+	cmpl -36(%rbp), %eax
+	jge .L10
+	.p2align 4,,10
+.L9:
+	movslq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl %eax, -32(%rbp)
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	cmpl -36(%rbp), %eax
+	jl .L9
+.L10:
+	movl $0, -28(%rbp)
+	movl $0, -16(%rbp)
+	movl -28(%rbp), %eax
+	movd %eax, %xmm7
+	pshufd $0, %xmm7, %xmm7
+	leaq a(%rip), %rsi
+	movl -36(%rbp), %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -16(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L13
+	.p2align 4,,10
+.L12:
+	movdqu (%rsi,%rcx,4), %xmm0
+	movdqa %xmm0, %xmm1
+	pcmpgtd %xmm7, %xmm1
+	pand %xmm1, %xmm7
+	pandn %xmm0, %xmm1
+	por %xmm1, %xmm7
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L12
+	movl %ecx, -16(%rbp)
+	pshufd $78, %xmm7, %xmm6
+	movdqa %xmm6, %xmm5
+	pcmpgtd %xmm7, %xmm5
+	pand %xmm5, %xmm7
+	pandn %xmm6, %xmm5
+	por %xmm5, %xmm7
+	pshufd $177, %xmm7, %xmm6
+	movdqa %xmm6, %xmm5
+	pcmpgtd %xmm7, %xmm5
+	pand %xmm5, %xmm7
+	pandn %xmm6, %xmm5
+	por %xmm5, %xmm7
+	movd %xmm7, %eax
+	movl %eax, -28(%rbp)
+.L13:
+.L11:
+	movl -16(%rbp), %eax
+	cmpl -36(%rbp), %eax
+	jge .L15
+	.p2align 4,,10
+.L14:
+	movslq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	cmpl -28(%rbp), %eax
+	jge .L16
+	movslq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movl %eax, -28(%rbp)
+.L16:
+.L17:
+	addl $1, -16(%rbp)
+	movl -16(%rbp), %eax
+	cmpl -36(%rbp), %eax
+	jl .L14
+.L15:
+	movl $0, -8(%rbp)
+	cmpl $102, -8(%rbp)
+	jge .L19
+	movl $102, %eax
+	movslq -8(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -24(%rbp)
+	cmpq $0, -24(%rbp)
+	je .L20
+	.p2align 4,,10
+.L21:
+	movslq -8(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl $2, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl $2, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl $2, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	movslq %eax, %rax
+	movq %rax, -16(%rbp)
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	movq -16(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl $2, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	movslq %eax, %rax
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	subq $1, -24(%rbp)
+	jne .L21
+.L22:
+.L19:
+.L20:
+	cmpl $102, -8(%rbp)
+	jge .L24
+	.p2align 4,,10
+.L23:
+	movslq -8(%rbp), %rax
+	leaq a(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl $2, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	movslq %eax, %rax
+	leaq a(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	movl -8(%rbp), %eax
+	movl %eax, -8(%rbp)
+	cmpl $102, -8(%rbp)
+	jl .L23
+.L24:
+	movl a+408(%rip), %eax
+.L18:
+	movq %rax, %rcx
+	movl -32(%rbp), %eax
+	subl -28(%rbp), %eax
+	addl %ecx, %eax
+	movl %eax, -28(%rbp)
+	movl $0, -24(%rbp)
+	cmpl $10, -24(%rbp)
+	jge .L25
+	movl $10, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -16(%rbp)
+	cmpq $0, -16(%rbp)
+	je .L26
+	.p2align 4,,10
+.L27:
+	movl -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call shift
+	addq $8, %rsp
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -28(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call shift
+	addq $8, %rsp
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -28(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call shift
+	addq $8, %rsp
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -28(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -24(%rbp)
+	movl -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call shift
+	addq $8, %rsp
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -28(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -24(%rbp)
+	subq $1, -16(%rbp)
+	jne .L27
+.L28:
+.L25:
+.L26:
+	cmpl $10, -24(%rbp)
+	jge .L30
+	.p2align 4,,10
+.L29:
+	movl -24(%rbp), %eax
+	addl $1, %eax
+	movl %eax, -8(%rbp)
+	pushq %rax
+	subq $8, %rsp
+	movl -36(%rbp), %eax
+	movq %rax, %rsi
+	movl -24(%rbp), %eax
+	movq %rax, %rdi
+	call shift
+	addq $8, %rsp
+	popq %rcx
+	imull %ecx, %eax
+	addl %eax, -28(%rbp)
+	movl -8(%rbp), %eax
+	movl %eax, -24(%rbp)
+	cmpl $10, -24(%rbp)
+	jl .L29
+.L30:
+	movl -28(%rbp), %eax
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -28(%rbp), %eax
+	subl %ecx, %eax
+	leave
+	ret
+	.size main, .-main
+	.align 16
+shift:
+	pushq %rbp
+	movq %rsp, %rbp
+	movl %edi, -20(%rbp)
+	movl %esi, -16(%rbp)
+	movl $0, -12(%rbp)
+	movl -12(%rbp), %eax
+	cmpl %esi, %eax
+	jge .L31
+	movslq %esi, %rax
+	movslq -12(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L32
+	.p2align 4,,10
+.L33:
+	movslq -12(%rbp), %rax
+	movl -12(%rbp), %ecx
+	leaq b(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -12(%rbp), %ecx
+	leaq b(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -12(%rbp), %ecx
+	leaq b(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -12(%rbp)
+	movslq -12(%rbp), %rax
+	movl -12(%rbp), %ecx
+	leaq b(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -12(%rbp)
+	subq $1, -8(%rbp)
+	jne .L33
+.L34:
+.L31:
+.L32:
+	movl -12(%rbp), %eax
+	cmpl %esi, %eax
+	jge .L36
+	.p2align 4,,10
+.L35:
+	movslq -12(%rbp), %rax
+	movl -12(%rbp), %ecx
+	leaq b(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	cmpl %esi, %eax
+	jl .L35
+.L36:
+	movl $0, -12(%rbp)
+	movl %esi, %eax
+	subl %edi, %eax
+	movl %eax, -8(%rbp)
+	movslq %edi, %rax
+	testq %rax, %rax
+	jle .L40
+	movslq %edi, %rax
+	cmpq $4, %rax
+	jl .L37
+.L40:
+	movl $1, %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	movl %edi, %eax
+	cltq
+	leaq b(%rip), %rsi
+	leaq (%rsi,%rax,4), %rsi
+	leaq b(%rip), %rdi
+	movl -8(%rbp), %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -12(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L39
+	.p2align 4,,10
+.L38:
+	movdqu (%rdi,%rcx,4), %xmm0
+	paddd %xmm8, %xmm0
+	movdqu %xmm0, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L38
+	movl %ecx, -12(%rbp)
+.L39:
+.L37:
+	movl -12(%rbp), %eax
+	cmpl -8(%rbp), %eax
+	jge .L42
+	.p2align 4,,10
+.L41:
+	movslq -12(%rbp), %rax
+	leaq b(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl $1, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	addl -20(%rbp), %eax
+	movslq %eax, %rax
+	leaq b(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	cmpl -8(%rbp), %eax
+	jl .L41
+.L42:
+	movl $0, -8(%rbp)
+	movl $0, -12(%rbp)
+	pxor %xmm7, %xmm7
+	leaq b(%rip), %rsi
+	movl -16(%rbp), %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -12(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L45
+	.p2align 4,,10
+.L44:
+	movdqu (%rsi,%rcx,4), %xmm0
+	paddd %xmm0, %xmm7
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L44
+	movl %ecx, -12(%rbp)
+	pshufd $78, %xmm7, %xmm6
+	paddd %xmm6, %xmm7
+	pshufd $177, %xmm7, %xmm6
+	paddd %xmm6, %xmm7
+	movd %xmm7, %eax
+	addl %eax, -8(%rbp)
+.L45:
+.L43:
+	movl -12(%rbp), %eax
+	cmpl -16(%rbp), %eax
+	jge .L47
+	.p2align 4,,10
+.L46:
+	movslq -12(%rbp), %rax
+	leaq b(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl %eax, -8(%rbp)
+	addl $1, -12(%rbp)
+	movl -12(%rbp), %eax
+	cmpl -16(%rbp), %eax
+	jl .L46
+.L47:
+	movl -8(%rbp), %eax
+	popq %rbp
+	ret
+	.size shift, .-shift
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,335 @@
+	.section .bss
+	.type x, @object
+	.size x, 16384
+	.p2align 5
+x:
+	.zero 16384
+	.type y, @object
+	.size y, 16384
+	.p2align 5
+y:
+	.zero 16384
+	.type z, @object
+	.size z, 16384
+	.p2align 5
+z:
+	.zero 16384
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movl $0, -24(%rbp)
+	cmpl $4096, -24(%rbp)
+	setl %al
+	movzbl %al, %eax
+	movl %eax, -12(%rbp)
+	testl %eax, %eax
+	je .L0
+	movl $4096, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L1
+	.p2align 4,,10
+.L2:
+	movslq -24(%rbp), %rax
+	movl -24(%rbp), %ecx
+	leaq x(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -24(%rbp), %ecx
+	leaq x(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -24(%rbp), %ecx
+	leaq x(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	movslq -24(%rbp), %rax
+	movl -24(%rbp), %ecx
+	leaq x(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -8(%rbp)
+	jne .L2
+.L3:
+.L0:
+.L1:
+	cmpl $4096, -24(%rbp)
+	jge .L5
+	.p2align 4,,10
+.L4:
+	movslq -24(%rbp), %rax
+	movl -24(%rbp), %ecx
+	leaq x(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $4096, -24(%rbp)
+	jl .L4
+.L5:
+	movl $0, -24(%rbp)
+	cmpl $0, -12(%rbp)
+	je .L6
+	movl $4096, %eax
+	movslq -24(%rbp), %rcx
+	subq %rcx, %rax
+	shrq $2, %rax
+	movq %rax, -8(%rbp)
+	cmpq $0, -8(%rbp)
+	je .L7
+	.p2align 4,,10
+.L8:
+	movl $4096, %eax
+	subl -24(%rbp), %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	leaq y(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	movl $4096, %eax
+	subl -24(%rbp), %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	leaq y(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	movl $4096, %eax
+	subl -24(%rbp), %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	leaq y(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	movl $4096, %eax
+	subl -24(%rbp), %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	leaq y(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	subq $1, -8(%rbp)
+	jne .L8
+.L9:
+.L6:
+.L7:
+	cmpl $4096, -24(%rbp)
+	jge .L11
+	.p2align 4,,10
+.L10:
+	movl $4096, %eax
+	subl -24(%rbp), %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	leaq y(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $4096, -24(%rbp)
+	jl .L10
+.L11:
+	movl $0, -20(%rbp)
+	movl $0, -16(%rbp)
+	movl $0, -12(%rbp)
+	cmpl $20000, -12(%rbp)
+	jge .L13
+	.p2align 4,,10
+.L12:
+	movl -12(%rbp), %eax
+	leal 7(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $3, %ecx
+	movl %ecx, %eax
+	sall $3, %eax
+	movq %rax, %rcx
+	movl -12(%rbp), %eax
+	subl %ecx, %eax
+	movl %eax, -8(%rbp)
+	movl $0, -24(%rbp)
+	movl -8(%rbp), %eax
+	movd %eax, %xmm8
+	pshufd $0, %xmm8, %xmm8
+	leaq z(%rip), %rsi
+	leaq x(%rip), %rdi
+	leaq y(%rip), %r8
+	movl $4096, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -24(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L16
+	.p2align 4,,10
+.L15:
+	movdqu (%rdi,%rcx,4), %xmm0
+	movdqa %xmm0, %xmm2
+	pmuludq %xmm8, %xmm0
+	psrlq $32, %xmm2
+	movdqa %xmm8, %xmm3
+	psrlq $32, %xmm3
+	pmuludq %xmm3, %xmm2
+	pshufd $8, %xmm0, %xmm0
+	pshufd $8, %xmm2, %xmm2
+	punpckldq %xmm2, %xmm0
+	movdqu (%r8,%rcx,4), %xmm1
+	paddd %xmm1, %xmm0
+	movdqu %xmm0, (%rsi,%rcx,4)
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L15
+	movl %ecx, -24(%rbp)
+.L16:
+.L14:
+	cmpl $4096, -24(%rbp)
+	jge .L18
+	.p2align 4,,10
+.L17:
+	movslq -24(%rbp), %rax
+	leaq y(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	leaq x(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	imull -8(%rbp), %eax
+	addl %ecx, %eax
+	movq %rax, %rcx
+	movslq -24(%rbp), %rax
+	leaq z(%rip), %rdx
+	movl %ecx, (%rdx,%rax,4)
+	addl $1, -24(%rbp)
+	cmpl $4096, -24(%rbp)
+	jl .L17
+.L18:
+	movl $0, -24(%rbp)
+	pxor %xmm7, %xmm7
+	leaq z(%rip), %rsi
+	movl $4096, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -24(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L21
+	.p2align 4,,10
+.L20:
+	movdqu (%rsi,%rcx,4), %xmm0
+	paddd %xmm0, %xmm7
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L20
+	movl %ecx, -24(%rbp)
+	pshufd $78, %xmm7, %xmm6
+	paddd %xmm6, %xmm7
+	pshufd $177, %xmm7, %xmm6
+	paddd %xmm6, %xmm7
+	movd %xmm7, %eax
+	addl %eax, -20(%rbp)
+.L21:
+.L19:
+	cmpl $4096, -24(%rbp)
+	jge .L23
+	.p2align 4,,10
+.L22:
+	movslq -24(%rbp), %rax
+	leaq z(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	addl %eax, -20(%rbp)
+	addl $1, -24(%rbp)
+	cmpl $4096, -24(%rbp)
+	jl .L22
+.L23:
+	movl $0, -24(%rbp)
+	movl -16(%rbp), %eax
+	movd %eax, %xmm7
+	pshufd $0, %xmm7, %xmm7
+	leaq z(%rip), %rsi
+	movl $4096, %eax
+	movslq %eax, %rdx
+	subq $4, %rdx
+	movslq -24(%rbp), %rcx
+	cmpq %rdx, %rcx
+	jg .L26
+	.p2align 4,,10
+.L25:
+	movdqu (%rsi,%rcx,4), %xmm0
+	movdqa %xmm7, %xmm1
+	pcmpgtd %xmm0, %xmm1
+	pand %xmm1, %xmm7
+	pandn %xmm0, %xmm1
+	por %xmm1, %xmm7
+	addq $4, %rcx
+	cmpq %rdx, %rcx
+	jle .L25
+	movl %ecx, -24(%rbp)
+	pshufd $78, %xmm7, %xmm6
+	movdqa %xmm7, %xmm5
+	pcmpgtd %xmm6, %xmm5
+	pand %xmm5, %xmm7
+	pandn %xmm6, %xmm5
+	por %xmm5, %xmm7
+	pshufd $177, %xmm7, %xmm6
+	movdqa %xmm7, %xmm5
+	pcmpgtd %xmm6, %xmm5
+	pand %xmm5, %xmm7
+	pandn %xmm6, %xmm5
+	por %xmm5, %xmm7
+	movd %xmm7, %eax
+	movl %eax, -16(%rbp)
+.L26:
+.L24:
+	cmpl $4096, -24(%rbp)
+	jge .L28
+	.p2align 4,,10
+.L27:
+	movslq -24(%rbp), %rax
+	leaq z(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	cmpl -16(%rbp), %eax
+	jle .L29
+	movslq -24(%rbp), %rax
+	leaq z(%rip), %rdx
+	movl (%rdx,%rax,4), %eax
+	movl %eax, -16(%rbp)
+.L29:
+.L30:
+	addl $1, -24(%rbp)
+	cmpl $4096, -24(%rbp)
+	jl .L27
+.L28:
+	addl $1, -12(%rbp)
+	cmpl $20000, -12(%rbp)
+	jl .L12
+.L13:
+	movl -20(%rbp), %eax
+	addl -16(%rbp), %eax
+	movl %eax, -8(%rbp)
+	leal 255(%rax), %ecx
+	testl %eax, %eax
+	cmovnsl %eax, %ecx
+	sarl $8, %ecx
+	movl %ecx, %eax
+	sall $8, %eax
+	movq %rax, %rcx
+	movl -8(%rbp), %eax
+	subl %ecx, %eax
+	popq %rbp
+	ret
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
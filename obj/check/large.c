@@ -0,0 +1,3004 @@
+int main(int argc) {
+  int x = argc;
+  if (x == 0) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1) { return putchar(x) + 1; }
+  if (x == 2) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 3) { return putchar(x) + 3; }
+  if (x == 4) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 5) { return putchar(x) + 5; }
+  if (x == 6) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 7) { return putchar(x) + 0; }
+  if (x == 8) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 9) { return putchar(x) + 2; }
+  if (x == 10) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 11) { return putchar(x) + 4; }
+  if (x == 12) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 13) { return putchar(x) + 6; }
+  if (x == 14) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 15) { return putchar(x) + 1; }
+  if (x == 16) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 17) { return putchar(x) + 3; }
+  if (x == 18) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 19) { return putchar(x) + 5; }
+  if (x == 20) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 21) { return putchar(x) + 0; }
+  if (x == 22) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 23) { return putchar(x) + 2; }
+  if (x == 24) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 25) { return putchar(x) + 4; }
+  if (x == 26) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 27) { return putchar(x) + 6; }
+  if (x == 28) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 29) { return putchar(x) + 1; }
+  if (x == 30) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 31) { return putchar(x) + 3; }
+  if (x == 32) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 33) { return putchar(x) + 5; }
+  if (x == 34) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 35) { return putchar(x) + 0; }
+  if (x == 36) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 37) { return putchar(x) + 2; }
+  if (x == 38) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 39) { return putchar(x) + 4; }
+  if (x == 40) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 41) { return putchar(x) + 6; }
+  if (x == 42) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 43) { return putchar(x) + 1; }
+  if (x == 44) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 45) { return putchar(x) + 3; }
+  if (x == 46) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 47) { return putchar(x) + 5; }
+  if (x == 48) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 49) { return putchar(x) + 0; }
+  if (x == 50) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 51) { return putchar(x) + 2; }
+  if (x == 52) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 53) { return putchar(x) + 4; }
+  if (x == 54) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 55) { return putchar(x) + 6; }
+  if (x == 56) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 57) { return putchar(x) + 1; }
+  if (x == 58) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 59) { return putchar(x) + 3; }
+  if (x == 60) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 61) { return putchar(x) + 5; }
+  if (x == 62) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 63) { return putchar(x) + 0; }
+  if (x == 64) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 65) { return putchar(x) + 2; }
+  if (x == 66) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 67) { return putchar(x) + 4; }
+  if (x == 68) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 69) { return putchar(x) + 6; }
+  if (x == 70) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 71) { return putchar(x) + 1; }
+  if (x == 72) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 73) { return putchar(x) + 3; }
+  if (x == 74) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 75) { return putchar(x) + 5; }
+  if (x == 76) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 77) { return putchar(x) + 0; }
+  if (x == 78) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 79) { return putchar(x) + 2; }
+  if (x == 80) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 81) { return putchar(x) + 4; }
+  if (x == 82) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 83) { return putchar(x) + 6; }
+  if (x == 84) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 85) { return putchar(x) + 1; }
+  if (x == 86) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 87) { return putchar(x) + 3; }
+  if (x == 88) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 89) { return putchar(x) + 5; }
+  if (x == 90) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 91) { return putchar(x) + 0; }
+  if (x == 92) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 93) { return putchar(x) + 2; }
+  if (x == 94) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 95) { return putchar(x) + 4; }
+  if (x == 96) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 97) { return putchar(x) + 6; }
+  if (x == 98) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 99) { return putchar(x) + 1; }
+  if (x == 100) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 101) { return putchar(x) + 3; }
+  if (x == 102) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 103) { return putchar(x) + 5; }
+  if (x == 104) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 105) { return putchar(x) + 0; }
+  if (x == 106) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 107) { return putchar(x) + 2; }
+  if (x == 108) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 109) { return putchar(x) + 4; }
+  if (x == 110) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 111) { return putchar(x) + 6; }
+  if (x == 112) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 113) { return putchar(x) + 1; }
+  if (x == 114) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 115) { return putchar(x) + 3; }
+  if (x == 116) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 117) { return putchar(x) + 5; }
+  if (x == 118) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 119) { return putchar(x) + 0; }
+  if (x == 120) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 121) { return putchar(x) + 2; }
+  if (x == 122) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 123) { return putchar(x) + 4; }
+  if (x == 124) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 125) { return putchar(x) + 6; }
+  if (x == 126) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 127) { return putchar(x) + 1; }
+  if (x == 128) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 129) { return putchar(x) + 3; }
+  if (x == 130) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 131) { return putchar(x) + 5; }
+  if (x == 132) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 133) { return putchar(x) + 0; }
+  if (x == 134) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 135) { return putchar(x) + 2; }
+  if (x == 136) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 137) { return putchar(x) + 4; }
+  if (x == 138) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 139) { return putchar(x) + 6; }
+  if (x == 140) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 141) { return putchar(x) + 1; }
+  if (x == 142) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 143) { return putchar(x) + 3; }
+  if (x == 144) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 145) { return putchar(x) + 5; }
+  if (x == 146) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 147) { return putchar(x) + 0; }
+  if (x == 148) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 149) { return putchar(x) + 2; }
+  if (x == 150) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 151) { return putchar(x) + 4; }
+  if (x == 152) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 153) { return putchar(x) + 6; }
+  if (x == 154) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 155) { return putchar(x) + 1; }
+  if (x == 156) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 157) { return putchar(x) + 3; }
+  if (x == 158) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 159) { return putchar(x) + 5; }
+  if (x == 160) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 161) { return putchar(x) + 0; }
+  if (x == 162) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 163) { return putchar(x) + 2; }
+  if (x == 164) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 165) { return putchar(x) + 4; }
+  if (x == 166) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 167) { return putchar(x) + 6; }
+  if (x == 168) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 169) { return putchar(x) + 1; }
+  if (x == 170) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 171) { return putchar(x) + 3; }
+  if (x == 172) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 173) { return putchar(x) + 5; }
+  if (x == 174) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 175) { return putchar(x) + 0; }
+  if (x == 176) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 177) { return putchar(x) + 2; }
+  if (x == 178) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 179) { return putchar(x) + 4; }
+  if (x == 180) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 181) { return putchar(x) + 6; }
+  if (x == 182) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 183) { return putchar(x) + 1; }
+  if (x == 184) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 185) { return putchar(x) + 3; }
+  if (x == 186) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 187) { return putchar(x) + 5; }
+  if (x == 188) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 189) { return putchar(x) + 0; }
+  if (x == 190) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 191) { return putchar(x) + 2; }
+  if (x == 192) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 193) { return putchar(x) + 4; }
+  if (x == 194) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 195) { return putchar(x) + 6; }
+  if (x == 196) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 197) { return putchar(x) + 1; }
+  if (x == 198) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 199) { return putchar(x) + 3; }
+  if (x == 200) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 201) { return putchar(x) + 5; }
+  if (x == 202) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 203) { return putchar(x) + 0; }
+  if (x == 204) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 205) { return putchar(x) + 2; }
+  if (x == 206) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 207) { return putchar(x) + 4; }
+  if (x == 208) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 209) { return putchar(x) + 6; }
+  if (x == 210) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 211) { return putchar(x) + 1; }
+  if (x == 212) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 213) { return putchar(x) + 3; }
+  if (x == 214) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 215) { return putchar(x) + 5; }
+  if (x == 216) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 217) { return putchar(x) + 0; }
+  if (x == 218) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 219) { return putchar(x) + 2; }
+  if (x == 220) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 221) { return putchar(x) + 4; }
+  if (x == 222) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 223) { return putchar(x) + 6; }
+  if (x == 224) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 225) { return putchar(x) + 1; }
+  if (x == 226) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 227) { return putchar(x) + 3; }
+  if (x == 228) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 229) { return putchar(x) + 5; }
+  if (x == 230) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 231) { return putchar(x) + 0; }
+  if (x == 232) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 233) { return putchar(x) + 2; }
+  if (x == 234) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 235) { return putchar(x) + 4; }
+  if (x == 236) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 237) { return putchar(x) + 6; }
+  if (x == 238) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 239) { return putchar(x) + 1; }
+  if (x == 240) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 241) { return putchar(x) + 3; }
+  if (x == 242) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 243) { return putchar(x) + 5; }
+  if (x == 244) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 245) { return putchar(x) + 0; }
+  if (x == 246) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 247) { return putchar(x) + 2; }
+  if (x == 248) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 249) { return putchar(x) + 4; }
+  if (x == 250) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 251) { return putchar(x) + 6; }
+  if (x == 252) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 253) { return putchar(x) + 1; }
+  if (x == 254) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 255) { return putchar(x) + 3; }
+  if (x == 256) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 257) { return putchar(x) + 5; }
+  if (x == 258) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 259) { return putchar(x) + 0; }
+  if (x == 260) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 261) { return putchar(x) + 2; }
+  if (x == 262) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 263) { return putchar(x) + 4; }
+  if (x == 264) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 265) { return putchar(x) + 6; }
+  if (x == 266) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 267) { return putchar(x) + 1; }
+  if (x == 268) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 269) { return putchar(x) + 3; }
+  if (x == 270) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 271) { return putchar(x) + 5; }
+  if (x == 272) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 273) { return putchar(x) + 0; }
+  if (x == 274) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 275) { return putchar(x) + 2; }
+  if (x == 276) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 277) { return putchar(x) + 4; }
+  if (x == 278) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 279) { return putchar(x) + 6; }
+  if (x == 280) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 281) { return putchar(x) + 1; }
+  if (x == 282) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 283) { return putchar(x) + 3; }
+  if (x == 284) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 285) { return putchar(x) + 5; }
+  if (x == 286) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 287) { return putchar(x) + 0; }
+  if (x == 288) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 289) { return putchar(x) + 2; }
+  if (x == 290) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 291) { return putchar(x) + 4; }
+  if (x == 292) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 293) { return putchar(x) + 6; }
+  if (x == 294) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 295) { return putchar(x) + 1; }
+  if (x == 296) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 297) { return putchar(x) + 3; }
+  if (x == 298) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 299) { return putchar(x) + 5; }
+  if (x == 300) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 301) { return putchar(x) + 0; }
+  if (x == 302) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 303) { return putchar(x) + 2; }
+  if (x == 304) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 305) { return putchar(x) + 4; }
+  if (x == 306) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 307) { return putchar(x) + 6; }
+  if (x == 308) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 309) { return putchar(x) + 1; }
+  if (x == 310) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 311) { return putchar(x) + 3; }
+  if (x == 312) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 313) { return putchar(x) + 5; }
+  if (x == 314) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 315) { return putchar(x) + 0; }
+  if (x == 316) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 317) { return putchar(x) + 2; }
+  if (x == 318) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 319) { return putchar(x) + 4; }
+  if (x == 320) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 321) { return putchar(x) + 6; }
+  if (x == 322) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 323) { return putchar(x) + 1; }
+  if (x == 324) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 325) { return putchar(x) + 3; }
+  if (x == 326) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 327) { return putchar(x) + 5; }
+  if (x == 328) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 329) { return putchar(x) + 0; }
+  if (x == 330) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 331) { return putchar(x) + 2; }
+  if (x == 332) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 333) { return putchar(x) + 4; }
+  if (x == 334) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 335) { return putchar(x) + 6; }
+  if (x == 336) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 337) { return putchar(x) + 1; }
+  if (x == 338) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 339) { return putchar(x) + 3; }
+  if (x == 340) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 341) { return putchar(x) + 5; }
+  if (x == 342) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 343) { return putchar(x) + 0; }
+  if (x == 344) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 345) { return putchar(x) + 2; }
+  if (x == 346) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 347) { return putchar(x) + 4; }
+  if (x == 348) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 349) { return putchar(x) + 6; }
+  if (x == 350) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 351) { return putchar(x) + 1; }
+  if (x == 352) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 353) { return putchar(x) + 3; }
+  if (x == 354) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 355) { return putchar(x) + 5; }
+  if (x == 356) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 357) { return putchar(x) + 0; }
+  if (x == 358) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 359) { return putchar(x) + 2; }
+  if (x == 360) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 361) { return putchar(x) + 4; }
+  if (x == 362) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 363) { return putchar(x) + 6; }
+  if (x == 364) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 365) { return putchar(x) + 1; }
+  if (x == 366) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 367) { return putchar(x) + 3; }
+  if (x == 368) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 369) { return putchar(x) + 5; }
+  if (x == 370) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 371) { return putchar(x) + 0; }
+  if (x == 372) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 373) { return putchar(x) + 2; }
+  if (x == 374) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 375) { return putchar(x) + 4; }
+  if (x == 376) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 377) { return putchar(x) + 6; }
+  if (x == 378) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 379) { return putchar(x) + 1; }
+  if (x == 380) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 381) { return putchar(x) + 3; }
+  if (x == 382) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 383) { return putchar(x) + 5; }
+  if (x == 384) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 385) { return putchar(x) + 0; }
+  if (x == 386) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 387) { return putchar(x) + 2; }
+  if (x == 388) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 389) { return putchar(x) + 4; }
+  if (x == 390) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 391) { return putchar(x) + 6; }
+  if (x == 392) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 393) { return putchar(x) + 1; }
+  if (x == 394) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 395) { return putchar(x) + 3; }
+  if (x == 396) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 397) { return putchar(x) + 5; }
+  if (x == 398) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 399) { return putchar(x) + 0; }
+  if (x == 400) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 401) { return putchar(x) + 2; }
+  if (x == 402) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 403) { return putchar(x) + 4; }
+  if (x == 404) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 405) { return putchar(x) + 6; }
+  if (x == 406) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 407) { return putchar(x) + 1; }
+  if (x == 408) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 409) { return putchar(x) + 3; }
+  if (x == 410) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 411) { return putchar(x) + 5; }
+  if (x == 412) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 413) { return putchar(x) + 0; }
+  if (x == 414) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 415) { return putchar(x) + 2; }
+  if (x == 416) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 417) { return putchar(x) + 4; }
+  if (x == 418) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 419) { return putchar(x) + 6; }
+  if (x == 420) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 421) { return putchar(x) + 1; }
+  if (x == 422) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 423) { return putchar(x) + 3; }
+  if (x == 424) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 425) { return putchar(x) + 5; }
+  if (x == 426) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 427) { return putchar(x) + 0; }
+  if (x == 428) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 429) { return putchar(x) + 2; }
+  if (x == 430) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 431) { return putchar(x) + 4; }
+  if (x == 432) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 433) { return putchar(x) + 6; }
+  if (x == 434) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 435) { return putchar(x) + 1; }
+  if (x == 436) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 437) { return putchar(x) + 3; }
+  if (x == 438) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 439) { return putchar(x) + 5; }
+  if (x == 440) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 441) { return putchar(x) + 0; }
+  if (x == 442) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 443) { return putchar(x) + 2; }
+  if (x == 444) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 445) { return putchar(x) + 4; }
+  if (x == 446) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 447) { return putchar(x) + 6; }
+  if (x == 448) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 449) { return putchar(x) + 1; }
+  if (x == 450) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 451) { return putchar(x) + 3; }
+  if (x == 452) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 453) { return putchar(x) + 5; }
+  if (x == 454) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 455) { return putchar(x) + 0; }
+  if (x == 456) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 457) { return putchar(x) + 2; }
+  if (x == 458) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 459) { return putchar(x) + 4; }
+  if (x == 460) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 461) { return putchar(x) + 6; }
+  if (x == 462) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 463) { return putchar(x) + 1; }
+  if (x == 464) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 465) { return putchar(x) + 3; }
+  if (x == 466) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 467) { return putchar(x) + 5; }
+  if (x == 468) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 469) { return putchar(x) + 0; }
+  if (x == 470) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 471) { return putchar(x) + 2; }
+  if (x == 472) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 473) { return putchar(x) + 4; }
+  if (x == 474) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 475) { return putchar(x) + 6; }
+  if (x == 476) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 477) { return putchar(x) + 1; }
+  if (x == 478) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 479) { return putchar(x) + 3; }
+  if (x == 480) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 481) { return putchar(x) + 5; }
+  if (x == 482) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 483) { return putchar(x) + 0; }
+  if (x == 484) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 485) { return putchar(x) + 2; }
+  if (x == 486) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 487) { return putchar(x) + 4; }
+  if (x == 488) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 489) { return putchar(x) + 6; }
+  if (x == 490) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 491) { return putchar(x) + 1; }
+  if (x == 492) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 493) { return putchar(x) + 3; }
+  if (x == 494) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 495) { return putchar(x) + 5; }
+  if (x == 496) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 497) { return putchar(x) + 0; }
+  if (x == 498) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 499) { return putchar(x) + 2; }
+  if (x == 500) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 501) { return putchar(x) + 4; }
+  if (x == 502) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 503) { return putchar(x) + 6; }
+  if (x == 504) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 505) { return putchar(x) + 1; }
+  if (x == 506) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 507) { return putchar(x) + 3; }
+  if (x == 508) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 509) { return putchar(x) + 5; }
+  if (x == 510) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 511) { return putchar(x) + 0; }
+  if (x == 512) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 513) { return putchar(x) + 2; }
+  if (x == 514) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 515) { return putchar(x) + 4; }
+  if (x == 516) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 517) { return putchar(x) + 6; }
+  if (x == 518) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 519) { return putchar(x) + 1; }
+  if (x == 520) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 521) { return putchar(x) + 3; }
+  if (x == 522) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 523) { return putchar(x) + 5; }
+  if (x == 524) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 525) { return putchar(x) + 0; }
+  if (x == 526) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 527) { return putchar(x) + 2; }
+  if (x == 528) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 529) { return putchar(x) + 4; }
+  if (x == 530) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 531) { return putchar(x) + 6; }
+  if (x == 532) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 533) { return putchar(x) + 1; }
+  if (x == 534) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 535) { return putchar(x) + 3; }
+  if (x == 536) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 537) { return putchar(x) + 5; }
+  if (x == 538) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 539) { return putchar(x) + 0; }
+  if (x == 540) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 541) { return putchar(x) + 2; }
+  if (x == 542) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 543) { return putchar(x) + 4; }
+  if (x == 544) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 545) { return putchar(x) + 6; }
+  if (x == 546) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 547) { return putchar(x) + 1; }
+  if (x == 548) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 549) { return putchar(x) + 3; }
+  if (x == 550) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 551) { return putchar(x) + 5; }
+  if (x == 552) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 553) { return putchar(x) + 0; }
+  if (x == 554) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 555) { return putchar(x) + 2; }
+  if (x == 556) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 557) { return putchar(x) + 4; }
+  if (x == 558) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 559) { return putchar(x) + 6; }
+  if (x == 560) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 561) { return putchar(x) + 1; }
+  if (x == 562) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 563) { return putchar(x) + 3; }
+  if (x == 564) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 565) { return putchar(x) + 5; }
+  if (x == 566) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 567) { return putchar(x) + 0; }
+  if (x == 568) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 569) { return putchar(x) + 2; }
+  if (x == 570) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 571) { return putchar(x) + 4; }
+  if (x == 572) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 573) { return putchar(x) + 6; }
+  if (x == 574) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 575) { return putchar(x) + 1; }
+  if (x == 576) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 577) { return putchar(x) + 3; }
+  if (x == 578) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 579) { return putchar(x) + 5; }
+  if (x == 580) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 581) { return putchar(x) + 0; }
+  if (x == 582) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 583) { return putchar(x) + 2; }
+  if (x == 584) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 585) { return putchar(x) + 4; }
+  if (x == 586) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 587) { return putchar(x) + 6; }
+  if (x == 588) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 589) { return putchar(x) + 1; }
+  if (x == 590) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 591) { return putchar(x) + 3; }
+  if (x == 592) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 593) { return putchar(x) + 5; }
+  if (x == 594) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 595) { return putchar(x) + 0; }
+  if (x == 596) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 597) { return putchar(x) + 2; }
+  if (x == 598) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 599) { return putchar(x) + 4; }
+  if (x == 600) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 601) { return putchar(x) + 6; }
+  if (x == 602) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 603) { return putchar(x) + 1; }
+  if (x == 604) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 605) { return putchar(x) + 3; }
+  if (x == 606) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 607) { return putchar(x) + 5; }
+  if (x == 608) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 609) { return putchar(x) + 0; }
+  if (x == 610) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 611) { return putchar(x) + 2; }
+  if (x == 612) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 613) { return putchar(x) + 4; }
+  if (x == 614) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 615) { return putchar(x) + 6; }
+  if (x == 616) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 617) { return putchar(x) + 1; }
+  if (x == 618) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 619) { return putchar(x) + 3; }
+  if (x == 620) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 621) { return putchar(x) + 5; }
+  if (x == 622) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 623) { return putchar(x) + 0; }
+  if (x == 624) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 625) { return putchar(x) + 2; }
+  if (x == 626) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 627) { return putchar(x) + 4; }
+  if (x == 628) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 629) { return putchar(x) + 6; }
+  if (x == 630) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 631) { return putchar(x) + 1; }
+  if (x == 632) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 633) { return putchar(x) + 3; }
+  if (x == 634) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 635) { return putchar(x) + 5; }
+  if (x == 636) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 637) { return putchar(x) + 0; }
+  if (x == 638) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 639) { return putchar(x) + 2; }
+  if (x == 640) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 641) { return putchar(x) + 4; }
+  if (x == 642) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 643) { return putchar(x) + 6; }
+  if (x == 644) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 645) { return putchar(x) + 1; }
+  if (x == 646) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 647) { return putchar(x) + 3; }
+  if (x == 648) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 649) { return putchar(x) + 5; }
+  if (x == 650) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 651) { return putchar(x) + 0; }
+  if (x == 652) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 653) { return putchar(x) + 2; }
+  if (x == 654) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 655) { return putchar(x) + 4; }
+  if (x == 656) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 657) { return putchar(x) + 6; }
+  if (x == 658) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 659) { return putchar(x) + 1; }
+  if (x == 660) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 661) { return putchar(x) + 3; }
+  if (x == 662) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 663) { return putchar(x) + 5; }
+  if (x == 664) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 665) { return putchar(x) + 0; }
+  if (x == 666) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 667) { return putchar(x) + 2; }
+  if (x == 668) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 669) { return putchar(x) + 4; }
+  if (x == 670) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 671) { return putchar(x) + 6; }
+  if (x == 672) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 673) { return putchar(x) + 1; }
+  if (x == 674) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 675) { return putchar(x) + 3; }
+  if (x == 676) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 677) { return putchar(x) + 5; }
+  if (x == 678) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 679) { return putchar(x) + 0; }
+  if (x == 680) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 681) { return putchar(x) + 2; }
+  if (x == 682) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 683) { return putchar(x) + 4; }
+  if (x == 684) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 685) { return putchar(x) + 6; }
+  if (x == 686) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 687) { return putchar(x) + 1; }
+  if (x == 688) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 689) { return putchar(x) + 3; }
+  if (x == 690) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 691) { return putchar(x) + 5; }
+  if (x == 692) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 693) { return putchar(x) + 0; }
+  if (x == 694) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 695) { return putchar(x) + 2; }
+  if (x == 696) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 697) { return putchar(x) + 4; }
+  if (x == 698) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 699) { return putchar(x) + 6; }
+  if (x == 700) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 701) { return putchar(x) + 1; }
+  if (x == 702) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 703) { return putchar(x) + 3; }
+  if (x == 704) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 705) { return putchar(x) + 5; }
+  if (x == 706) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 707) { return putchar(x) + 0; }
+  if (x == 708) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 709) { return putchar(x) + 2; }
+  if (x == 710) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 711) { return putchar(x) + 4; }
+  if (x == 712) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 713) { return putchar(x) + 6; }
+  if (x == 714) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 715) { return putchar(x) + 1; }
+  if (x == 716) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 717) { return putchar(x) + 3; }
+  if (x == 718) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 719) { return putchar(x) + 5; }
+  if (x == 720) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 721) { return putchar(x) + 0; }
+  if (x == 722) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 723) { return putchar(x) + 2; }
+  if (x == 724) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 725) { return putchar(x) + 4; }
+  if (x == 726) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 727) { return putchar(x) + 6; }
+  if (x == 728) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 729) { return putchar(x) + 1; }
+  if (x == 730) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 731) { return putchar(x) + 3; }
+  if (x == 732) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 733) { return putchar(x) + 5; }
+  if (x == 734) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 735) { return putchar(x) + 0; }
+  if (x == 736) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 737) { return putchar(x) + 2; }
+  if (x == 738) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 739) { return putchar(x) + 4; }
+  if (x == 740) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 741) { return putchar(x) + 6; }
+  if (x == 742) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 743) { return putchar(x) + 1; }
+  if (x == 744) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 745) { return putchar(x) + 3; }
+  if (x == 746) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 747) { return putchar(x) + 5; }
+  if (x == 748) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 749) { return putchar(x) + 0; }
+  if (x == 750) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 751) { return putchar(x) + 2; }
+  if (x == 752) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 753) { return putchar(x) + 4; }
+  if (x == 754) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 755) { return putchar(x) + 6; }
+  if (x == 756) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 757) { return putchar(x) + 1; }
+  if (x == 758) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 759) { return putchar(x) + 3; }
+  if (x == 760) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 761) { return putchar(x) + 5; }
+  if (x == 762) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 763) { return putchar(x) + 0; }
+  if (x == 764) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 765) { return putchar(x) + 2; }
+  if (x == 766) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 767) { return putchar(x) + 4; }
+  if (x == 768) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 769) { return putchar(x) + 6; }
+  if (x == 770) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 771) { return putchar(x) + 1; }
+  if (x == 772) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 773) { return putchar(x) + 3; }
+  if (x == 774) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 775) { return putchar(x) + 5; }
+  if (x == 776) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 777) { return putchar(x) + 0; }
+  if (x == 778) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 779) { return putchar(x) + 2; }
+  if (x == 780) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 781) { return putchar(x) + 4; }
+  if (x == 782) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 783) { return putchar(x) + 6; }
+  if (x == 784) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 785) { return putchar(x) + 1; }
+  if (x == 786) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 787) { return putchar(x) + 3; }
+  if (x == 788) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 789) { return putchar(x) + 5; }
+  if (x == 790) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 791) { return putchar(x) + 0; }
+  if (x == 792) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 793) { return putchar(x) + 2; }
+  if (x == 794) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 795) { return putchar(x) + 4; }
+  if (x == 796) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 797) { return putchar(x) + 6; }
+  if (x == 798) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 799) { return putchar(x) + 1; }
+  if (x == 800) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 801) { return putchar(x) + 3; }
+  if (x == 802) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 803) { return putchar(x) + 5; }
+  if (x == 804) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 805) { return putchar(x) + 0; }
+  if (x == 806) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 807) { return putchar(x) + 2; }
+  if (x == 808) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 809) { return putchar(x) + 4; }
+  if (x == 810) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 811) { return putchar(x) + 6; }
+  if (x == 812) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 813) { return putchar(x) + 1; }
+  if (x == 814) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 815) { return putchar(x) + 3; }
+  if (x == 816) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 817) { return putchar(x) + 5; }
+  if (x == 818) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 819) { return putchar(x) + 0; }
+  if (x == 820) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 821) { return putchar(x) + 2; }
+  if (x == 822) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 823) { return putchar(x) + 4; }
+  if (x == 824) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 825) { return putchar(x) + 6; }
+  if (x == 826) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 827) { return putchar(x) + 1; }
+  if (x == 828) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 829) { return putchar(x) + 3; }
+  if (x == 830) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 831) { return putchar(x) + 5; }
+  if (x == 832) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 833) { return putchar(x) + 0; }
+  if (x == 834) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 835) { return putchar(x) + 2; }
+  if (x == 836) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 837) { return putchar(x) + 4; }
+  if (x == 838) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 839) { return putchar(x) + 6; }
+  if (x == 840) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 841) { return putchar(x) + 1; }
+  if (x == 842) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 843) { return putchar(x) + 3; }
+  if (x == 844) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 845) { return putchar(x) + 5; }
+  if (x == 846) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 847) { return putchar(x) + 0; }
+  if (x == 848) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 849) { return putchar(x) + 2; }
+  if (x == 850) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 851) { return putchar(x) + 4; }
+  if (x == 852) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 853) { return putchar(x) + 6; }
+  if (x == 854) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 855) { return putchar(x) + 1; }
+  if (x == 856) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 857) { return putchar(x) + 3; }
+  if (x == 858) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 859) { return putchar(x) + 5; }
+  if (x == 860) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 861) { return putchar(x) + 0; }
+  if (x == 862) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 863) { return putchar(x) + 2; }
+  if (x == 864) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 865) { return putchar(x) + 4; }
+  if (x == 866) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 867) { return putchar(x) + 6; }
+  if (x == 868) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 869) { return putchar(x) + 1; }
+  if (x == 870) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 871) { return putchar(x) + 3; }
+  if (x == 872) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 873) { return putchar(x) + 5; }
+  if (x == 874) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 875) { return putchar(x) + 0; }
+  if (x == 876) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 877) { return putchar(x) + 2; }
+  if (x == 878) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 879) { return putchar(x) + 4; }
+  if (x == 880) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 881) { return putchar(x) + 6; }
+  if (x == 882) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 883) { return putchar(x) + 1; }
+  if (x == 884) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 885) { return putchar(x) + 3; }
+  if (x == 886) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 887) { return putchar(x) + 5; }
+  if (x == 888) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 889) { return putchar(x) + 0; }
+  if (x == 890) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 891) { return putchar(x) + 2; }
+  if (x == 892) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 893) { return putchar(x) + 4; }
+  if (x == 894) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 895) { return putchar(x) + 6; }
+  if (x == 896) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 897) { return putchar(x) + 1; }
+  if (x == 898) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 899) { return putchar(x) + 3; }
+  if (x == 900) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 901) { return putchar(x) + 5; }
+  if (x == 902) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 903) { return putchar(x) + 0; }
+  if (x == 904) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 905) { return putchar(x) + 2; }
+  if (x == 906) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 907) { return putchar(x) + 4; }
+  if (x == 908) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 909) { return putchar(x) + 6; }
+  if (x == 910) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 911) { return putchar(x) + 1; }
+  if (x == 912) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 913) { return putchar(x) + 3; }
+  if (x == 914) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 915) { return putchar(x) + 5; }
+  if (x == 916) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 917) { return putchar(x) + 0; }
+  if (x == 918) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 919) { return putchar(x) + 2; }
+  if (x == 920) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 921) { return putchar(x) + 4; }
+  if (x == 922) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 923) { return putchar(x) + 6; }
+  if (x == 924) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 925) { return putchar(x) + 1; }
+  if (x == 926) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 927) { return putchar(x) + 3; }
+  if (x == 928) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 929) { return putchar(x) + 5; }
+  if (x == 930) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 931) { return putchar(x) + 0; }
+  if (x == 932) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 933) { return putchar(x) + 2; }
+  if (x == 934) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 935) { return putchar(x) + 4; }
+  if (x == 936) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 937) { return putchar(x) + 6; }
+  if (x == 938) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 939) { return putchar(x) + 1; }
+  if (x == 940) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 941) { return putchar(x) + 3; }
+  if (x == 942) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 943) { return putchar(x) + 5; }
+  if (x == 944) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 945) { return putchar(x) + 0; }
+  if (x == 946) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 947) { return putchar(x) + 2; }
+  if (x == 948) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 949) { return putchar(x) + 4; }
+  if (x == 950) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 951) { return putchar(x) + 6; }
+  if (x == 952) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 953) { return putchar(x) + 1; }
+  if (x == 954) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 955) { return putchar(x) + 3; }
+  if (x == 956) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 957) { return putchar(x) + 5; }
+  if (x == 958) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 959) { return putchar(x) + 0; }
+  if (x == 960) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 961) { return putchar(x) + 2; }
+  if (x == 962) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 963) { return putchar(x) + 4; }
+  if (x == 964) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 965) { return putchar(x) + 6; }
+  if (x == 966) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 967) { return putchar(x) + 1; }
+  if (x == 968) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 969) { return putchar(x) + 3; }
+  if (x == 970) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 971) { return putchar(x) + 5; }
+  if (x == 972) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 973) { return putchar(x) + 0; }
+  if (x == 974) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 975) { return putchar(x) + 2; }
+  if (x == 976) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 977) { return putchar(x) + 4; }
+  if (x == 978) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 979) { return putchar(x) + 6; }
+  if (x == 980) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 981) { return putchar(x) + 1; }
+  if (x == 982) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 983) { return putchar(x) + 3; }
+  if (x == 984) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 985) { return putchar(x) + 5; }
+  if (x == 986) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 987) { return putchar(x) + 0; }
+  if (x == 988) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 989) { return putchar(x) + 2; }
+  if (x == 990) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 991) { return putchar(x) + 4; }
+  if (x == 992) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 993) { return putchar(x) + 6; }
+  if (x == 994) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 995) { return putchar(x) + 1; }
+  if (x == 996) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 997) { return putchar(x) + 3; }
+  if (x == 998) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 999) { return putchar(x) + 5; }
+  if (x == 1000) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1001) { return putchar(x) + 0; }
+  if (x == 1002) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1003) { return putchar(x) + 2; }
+  if (x == 1004) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1005) { return putchar(x) + 4; }
+  if (x == 1006) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1007) { return putchar(x) + 6; }
+  if (x == 1008) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1009) { return putchar(x) + 1; }
+  if (x == 1010) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1011) { return putchar(x) + 3; }
+  if (x == 1012) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1013) { return putchar(x) + 5; }
+  if (x == 1014) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1015) { return putchar(x) + 0; }
+  if (x == 1016) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1017) { return putchar(x) + 2; }
+  if (x == 1018) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1019) { return putchar(x) + 4; }
+  if (x == 1020) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1021) { return putchar(x) + 6; }
+  if (x == 1022) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1023) { return putchar(x) + 1; }
+  if (x == 1024) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1025) { return putchar(x) + 3; }
+  if (x == 1026) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1027) { return putchar(x) + 5; }
+  if (x == 1028) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1029) { return putchar(x) + 0; }
+  if (x == 1030) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1031) { return putchar(x) + 2; }
+  if (x == 1032) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1033) { return putchar(x) + 4; }
+  if (x == 1034) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1035) { return putchar(x) + 6; }
+  if (x == 1036) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1037) { return putchar(x) + 1; }
+  if (x == 1038) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1039) { return putchar(x) + 3; }
+  if (x == 1040) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1041) { return putchar(x) + 5; }
+  if (x == 1042) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1043) { return putchar(x) + 0; }
+  if (x == 1044) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1045) { return putchar(x) + 2; }
+  if (x == 1046) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1047) { return putchar(x) + 4; }
+  if (x == 1048) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1049) { return putchar(x) + 6; }
+  if (x == 1050) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1051) { return putchar(x) + 1; }
+  if (x == 1052) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1053) { return putchar(x) + 3; }
+  if (x == 1054) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1055) { return putchar(x) + 5; }
+  if (x == 1056) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1057) { return putchar(x) + 0; }
+  if (x == 1058) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1059) { return putchar(x) + 2; }
+  if (x == 1060) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1061) { return putchar(x) + 4; }
+  if (x == 1062) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1063) { return putchar(x) + 6; }
+  if (x == 1064) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1065) { return putchar(x) + 1; }
+  if (x == 1066) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1067) { return putchar(x) + 3; }
+  if (x == 1068) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1069) { return putchar(x) + 5; }
+  if (x == 1070) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1071) { return putchar(x) + 0; }
+  if (x == 1072) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1073) { return putchar(x) + 2; }
+  if (x == 1074) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1075) { return putchar(x) + 4; }
+  if (x == 1076) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1077) { return putchar(x) + 6; }
+  if (x == 1078) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1079) { return putchar(x) + 1; }
+  if (x == 1080) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1081) { return putchar(x) + 3; }
+  if (x == 1082) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1083) { return putchar(x) + 5; }
+  if (x == 1084) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1085) { return putchar(x) + 0; }
+  if (x == 1086) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1087) { return putchar(x) + 2; }
+  if (x == 1088) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1089) { return putchar(x) + 4; }
+  if (x == 1090) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1091) { return putchar(x) + 6; }
+  if (x == 1092) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1093) { return putchar(x) + 1; }
+  if (x == 1094) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1095) { return putchar(x) + 3; }
+  if (x == 1096) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1097) { return putchar(x) + 5; }
+  if (x == 1098) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1099) { return putchar(x) + 0; }
+  if (x == 1100) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1101) { return putchar(x) + 2; }
+  if (x == 1102) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1103) { return putchar(x) + 4; }
+  if (x == 1104) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1105) { return putchar(x) + 6; }
+  if (x == 1106) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1107) { return putchar(x) + 1; }
+  if (x == 1108) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1109) { return putchar(x) + 3; }
+  if (x == 1110) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1111) { return putchar(x) + 5; }
+  if (x == 1112) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1113) { return putchar(x) + 0; }
+  if (x == 1114) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1115) { return putchar(x) + 2; }
+  if (x == 1116) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1117) { return putchar(x) + 4; }
+  if (x == 1118) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1119) { return putchar(x) + 6; }
+  if (x == 1120) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1121) { return putchar(x) + 1; }
+  if (x == 1122) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1123) { return putchar(x) + 3; }
+  if (x == 1124) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1125) { return putchar(x) + 5; }
+  if (x == 1126) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1127) { return putchar(x) + 0; }
+  if (x == 1128) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1129) { return putchar(x) + 2; }
+  if (x == 1130) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1131) { return putchar(x) + 4; }
+  if (x == 1132) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1133) { return putchar(x) + 6; }
+  if (x == 1134) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1135) { return putchar(x) + 1; }
+  if (x == 1136) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1137) { return putchar(x) + 3; }
+  if (x == 1138) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1139) { return putchar(x) + 5; }
+  if (x == 1140) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1141) { return putchar(x) + 0; }
+  if (x == 1142) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1143) { return putchar(x) + 2; }
+  if (x == 1144) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1145) { return putchar(x) + 4; }
+  if (x == 1146) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1147) { return putchar(x) + 6; }
+  if (x == 1148) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1149) { return putchar(x) + 1; }
+  if (x == 1150) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1151) { return putchar(x) + 3; }
+  if (x == 1152) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1153) { return putchar(x) + 5; }
+  if (x == 1154) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1155) { return putchar(x) + 0; }
+  if (x == 1156) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1157) { return putchar(x) + 2; }
+  if (x == 1158) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1159) { return putchar(x) + 4; }
+  if (x == 1160) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1161) { return putchar(x) + 6; }
+  if (x == 1162) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1163) { return putchar(x) + 1; }
+  if (x == 1164) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1165) { return putchar(x) + 3; }
+  if (x == 1166) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1167) { return putchar(x) + 5; }
+  if (x == 1168) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1169) { return putchar(x) + 0; }
+  if (x == 1170) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1171) { return putchar(x) + 2; }
+  if (x == 1172) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1173) { return putchar(x) + 4; }
+  if (x == 1174) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1175) { return putchar(x) + 6; }
+  if (x == 1176) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1177) { return putchar(x) + 1; }
+  if (x == 1178) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1179) { return putchar(x) + 3; }
+  if (x == 1180) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1181) { return putchar(x) + 5; }
+  if (x == 1182) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1183) { return putchar(x) + 0; }
+  if (x == 1184) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1185) { return putchar(x) + 2; }
+  if (x == 1186) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1187) { return putchar(x) + 4; }
+  if (x == 1188) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1189) { return putchar(x) + 6; }
+  if (x == 1190) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1191) { return putchar(x) + 1; }
+  if (x == 1192) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1193) { return putchar(x) + 3; }
+  if (x == 1194) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1195) { return putchar(x) + 5; }
+  if (x == 1196) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1197) { return putchar(x) + 0; }
+  if (x == 1198) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1199) { return putchar(x) + 2; }
+  if (x == 1200) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1201) { return putchar(x) + 4; }
+  if (x == 1202) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1203) { return putchar(x) + 6; }
+  if (x == 1204) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1205) { return putchar(x) + 1; }
+  if (x == 1206) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1207) { return putchar(x) + 3; }
+  if (x == 1208) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1209) { return putchar(x) + 5; }
+  if (x == 1210) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1211) { return putchar(x) + 0; }
+  if (x == 1212) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1213) { return putchar(x) + 2; }
+  if (x == 1214) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1215) { return putchar(x) + 4; }
+  if (x == 1216) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1217) { return putchar(x) + 6; }
+  if (x == 1218) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1219) { return putchar(x) + 1; }
+  if (x == 1220) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1221) { return putchar(x) + 3; }
+  if (x == 1222) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1223) { return putchar(x) + 5; }
+  if (x == 1224) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1225) { return putchar(x) + 0; }
+  if (x == 1226) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1227) { return putchar(x) + 2; }
+  if (x == 1228) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1229) { return putchar(x) + 4; }
+  if (x == 1230) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1231) { return putchar(x) + 6; }
+  if (x == 1232) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1233) { return putchar(x) + 1; }
+  if (x == 1234) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1235) { return putchar(x) + 3; }
+  if (x == 1236) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1237) { return putchar(x) + 5; }
+  if (x == 1238) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1239) { return putchar(x) + 0; }
+  if (x == 1240) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1241) { return putchar(x) + 2; }
+  if (x == 1242) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1243) { return putchar(x) + 4; }
+  if (x == 1244) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1245) { return putchar(x) + 6; }
+  if (x == 1246) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1247) { return putchar(x) + 1; }
+  if (x == 1248) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1249) { return putchar(x) + 3; }
+  if (x == 1250) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1251) { return putchar(x) + 5; }
+  if (x == 1252) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1253) { return putchar(x) + 0; }
+  if (x == 1254) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1255) { return putchar(x) + 2; }
+  if (x == 1256) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1257) { return putchar(x) + 4; }
+  if (x == 1258) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1259) { return putchar(x) + 6; }
+  if (x == 1260) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1261) { return putchar(x) + 1; }
+  if (x == 1262) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1263) { return putchar(x) + 3; }
+  if (x == 1264) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1265) { return putchar(x) + 5; }
+  if (x == 1266) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1267) { return putchar(x) + 0; }
+  if (x == 1268) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1269) { return putchar(x) + 2; }
+  if (x == 1270) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1271) { return putchar(x) + 4; }
+  if (x == 1272) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1273) { return putchar(x) + 6; }
+  if (x == 1274) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1275) { return putchar(x) + 1; }
+  if (x == 1276) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1277) { return putchar(x) + 3; }
+  if (x == 1278) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1279) { return putchar(x) + 5; }
+  if (x == 1280) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1281) { return putchar(x) + 0; }
+  if (x == 1282) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1283) { return putchar(x) + 2; }
+  if (x == 1284) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1285) { return putchar(x) + 4; }
+  if (x == 1286) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1287) { return putchar(x) + 6; }
+  if (x == 1288) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1289) { return putchar(x) + 1; }
+  if (x == 1290) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1291) { return putchar(x) + 3; }
+  if (x == 1292) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1293) { return putchar(x) + 5; }
+  if (x == 1294) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1295) { return putchar(x) + 0; }
+  if (x == 1296) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1297) { return putchar(x) + 2; }
+  if (x == 1298) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1299) { return putchar(x) + 4; }
+  if (x == 1300) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1301) { return putchar(x) + 6; }
+  if (x == 1302) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1303) { return putchar(x) + 1; }
+  if (x == 1304) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1305) { return putchar(x) + 3; }
+  if (x == 1306) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1307) { return putchar(x) + 5; }
+  if (x == 1308) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1309) { return putchar(x) + 0; }
+  if (x == 1310) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1311) { return putchar(x) + 2; }
+  if (x == 1312) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1313) { return putchar(x) + 4; }
+  if (x == 1314) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1315) { return putchar(x) + 6; }
+  if (x == 1316) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1317) { return putchar(x) + 1; }
+  if (x == 1318) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1319) { return putchar(x) + 3; }
+  if (x == 1320) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1321) { return putchar(x) + 5; }
+  if (x == 1322) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1323) { return putchar(x) + 0; }
+  if (x == 1324) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1325) { return putchar(x) + 2; }
+  if (x == 1326) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1327) { return putchar(x) + 4; }
+  if (x == 1328) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1329) { return putchar(x) + 6; }
+  if (x == 1330) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1331) { return putchar(x) + 1; }
+  if (x == 1332) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1333) { return putchar(x) + 3; }
+  if (x == 1334) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1335) { return putchar(x) + 5; }
+  if (x == 1336) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1337) { return putchar(x) + 0; }
+  if (x == 1338) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1339) { return putchar(x) + 2; }
+  if (x == 1340) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1341) { return putchar(x) + 4; }
+  if (x == 1342) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1343) { return putchar(x) + 6; }
+  if (x == 1344) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1345) { return putchar(x) + 1; }
+  if (x == 1346) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1347) { return putchar(x) + 3; }
+  if (x == 1348) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1349) { return putchar(x) + 5; }
+  if (x == 1350) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1351) { return putchar(x) + 0; }
+  if (x == 1352) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1353) { return putchar(x) + 2; }
+  if (x == 1354) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1355) { return putchar(x) + 4; }
+  if (x == 1356) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1357) { return putchar(x) + 6; }
+  if (x == 1358) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1359) { return putchar(x) + 1; }
+  if (x == 1360) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1361) { return putchar(x) + 3; }
+  if (x == 1362) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1363) { return putchar(x) + 5; }
+  if (x == 1364) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1365) { return putchar(x) + 0; }
+  if (x == 1366) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1367) { return putchar(x) + 2; }
+  if (x == 1368) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1369) { return putchar(x) + 4; }
+  if (x == 1370) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1371) { return putchar(x) + 6; }
+  if (x == 1372) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1373) { return putchar(x) + 1; }
+  if (x == 1374) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1375) { return putchar(x) + 3; }
+  if (x == 1376) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1377) { return putchar(x) + 5; }
+  if (x == 1378) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1379) { return putchar(x) + 0; }
+  if (x == 1380) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1381) { return putchar(x) + 2; }
+  if (x == 1382) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1383) { return putchar(x) + 4; }
+  if (x == 1384) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1385) { return putchar(x) + 6; }
+  if (x == 1386) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1387) { return putchar(x) + 1; }
+  if (x == 1388) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1389) { return putchar(x) + 3; }
+  if (x == 1390) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1391) { return putchar(x) + 5; }
+  if (x == 1392) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1393) { return putchar(x) + 0; }
+  if (x == 1394) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1395) { return putchar(x) + 2; }
+  if (x == 1396) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1397) { return putchar(x) + 4; }
+  if (x == 1398) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1399) { return putchar(x) + 6; }
+  if (x == 1400) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1401) { return putchar(x) + 1; }
+  if (x == 1402) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1403) { return putchar(x) + 3; }
+  if (x == 1404) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1405) { return putchar(x) + 5; }
+  if (x == 1406) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1407) { return putchar(x) + 0; }
+  if (x == 1408) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1409) { return putchar(x) + 2; }
+  if (x == 1410) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1411) { return putchar(x) + 4; }
+  if (x == 1412) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1413) { return putchar(x) + 6; }
+  if (x == 1414) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1415) { return putchar(x) + 1; }
+  if (x == 1416) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1417) { return putchar(x) + 3; }
+  if (x == 1418) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1419) { return putchar(x) + 5; }
+  if (x == 1420) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1421) { return putchar(x) + 0; }
+  if (x == 1422) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1423) { return putchar(x) + 2; }
+  if (x == 1424) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1425) { return putchar(x) + 4; }
+  if (x == 1426) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1427) { return putchar(x) + 6; }
+  if (x == 1428) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1429) { return putchar(x) + 1; }
+  if (x == 1430) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1431) { return putchar(x) + 3; }
+  if (x == 1432) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1433) { return putchar(x) + 5; }
+  if (x == 1434) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1435) { return putchar(x) + 0; }
+  if (x == 1436) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1437) { return putchar(x) + 2; }
+  if (x == 1438) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1439) { return putchar(x) + 4; }
+  if (x == 1440) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1441) { return putchar(x) + 6; }
+  if (x == 1442) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1443) { return putchar(x) + 1; }
+  if (x == 1444) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1445) { return putchar(x) + 3; }
+  if (x == 1446) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1447) { return putchar(x) + 5; }
+  if (x == 1448) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1449) { return putchar(x) + 0; }
+  if (x == 1450) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1451) { return putchar(x) + 2; }
+  if (x == 1452) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1453) { return putchar(x) + 4; }
+  if (x == 1454) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1455) { return putchar(x) + 6; }
+  if (x == 1456) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1457) { return putchar(x) + 1; }
+  if (x == 1458) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1459) { return putchar(x) + 3; }
+  if (x == 1460) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1461) { return putchar(x) + 5; }
+  if (x == 1462) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1463) { return putchar(x) + 0; }
+  if (x == 1464) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1465) { return putchar(x) + 2; }
+  if (x == 1466) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1467) { return putchar(x) + 4; }
+  if (x == 1468) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1469) { return putchar(x) + 6; }
+  if (x == 1470) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1471) { return putchar(x) + 1; }
+  if (x == 1472) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1473) { return putchar(x) + 3; }
+  if (x == 1474) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1475) { return putchar(x) + 5; }
+  if (x == 1476) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1477) { return putchar(x) + 0; }
+  if (x == 1478) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1479) { return putchar(x) + 2; }
+  if (x == 1480) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1481) { return putchar(x) + 4; }
+  if (x == 1482) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1483) { return putchar(x) + 6; }
+  if (x == 1484) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1485) { return putchar(x) + 1; }
+  if (x == 1486) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1487) { return putchar(x) + 3; }
+  if (x == 1488) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1489) { return putchar(x) + 5; }
+  if (x == 1490) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1491) { return putchar(x) + 0; }
+  if (x == 1492) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1493) { return putchar(x) + 2; }
+  if (x == 1494) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1495) { return putchar(x) + 4; }
+  if (x == 1496) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1497) { return putchar(x) + 6; }
+  if (x == 1498) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1499) { return putchar(x) + 1; }
+  if (x == 1500) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1501) { return putchar(x) + 3; }
+  if (x == 1502) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1503) { return putchar(x) + 5; }
+  if (x == 1504) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1505) { return putchar(x) + 0; }
+  if (x == 1506) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1507) { return putchar(x) + 2; }
+  if (x == 1508) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1509) { return putchar(x) + 4; }
+  if (x == 1510) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1511) { return putchar(x) + 6; }
+  if (x == 1512) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1513) { return putchar(x) + 1; }
+  if (x == 1514) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1515) { return putchar(x) + 3; }
+  if (x == 1516) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1517) { return putchar(x) + 5; }
+  if (x == 1518) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1519) { return putchar(x) + 0; }
+  if (x == 1520) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1521) { return putchar(x) + 2; }
+  if (x == 1522) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1523) { return putchar(x) + 4; }
+  if (x == 1524) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1525) { return putchar(x) + 6; }
+  if (x == 1526) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1527) { return putchar(x) + 1; }
+  if (x == 1528) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1529) { return putchar(x) + 3; }
+  if (x == 1530) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1531) { return putchar(x) + 5; }
+  if (x == 1532) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1533) { return putchar(x) + 0; }
+  if (x == 1534) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1535) { return putchar(x) + 2; }
+  if (x == 1536) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1537) { return putchar(x) + 4; }
+  if (x == 1538) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1539) { return putchar(x) + 6; }
+  if (x == 1540) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1541) { return putchar(x) + 1; }
+  if (x == 1542) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1543) { return putchar(x) + 3; }
+  if (x == 1544) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1545) { return putchar(x) + 5; }
+  if (x == 1546) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1547) { return putchar(x) + 0; }
+  if (x == 1548) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1549) { return putchar(x) + 2; }
+  if (x == 1550) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1551) { return putchar(x) + 4; }
+  if (x == 1552) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1553) { return putchar(x) + 6; }
+  if (x == 1554) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1555) { return putchar(x) + 1; }
+  if (x == 1556) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1557) { return putchar(x) + 3; }
+  if (x == 1558) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1559) { return putchar(x) + 5; }
+  if (x == 1560) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1561) { return putchar(x) + 0; }
+  if (x == 1562) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1563) { return putchar(x) + 2; }
+  if (x == 1564) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1565) { return putchar(x) + 4; }
+  if (x == 1566) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1567) { return putchar(x) + 6; }
+  if (x == 1568) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1569) { return putchar(x) + 1; }
+  if (x == 1570) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1571) { return putchar(x) + 3; }
+  if (x == 1572) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1573) { return putchar(x) + 5; }
+  if (x == 1574) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1575) { return putchar(x) + 0; }
+  if (x == 1576) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1577) { return putchar(x) + 2; }
+  if (x == 1578) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1579) { return putchar(x) + 4; }
+  if (x == 1580) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1581) { return putchar(x) + 6; }
+  if (x == 1582) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1583) { return putchar(x) + 1; }
+  if (x == 1584) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1585) { return putchar(x) + 3; }
+  if (x == 1586) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1587) { return putchar(x) + 5; }
+  if (x == 1588) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1589) { return putchar(x) + 0; }
+  if (x == 1590) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1591) { return putchar(x) + 2; }
+  if (x == 1592) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1593) { return putchar(x) + 4; }
+  if (x == 1594) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1595) { return putchar(x) + 6; }
+  if (x == 1596) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1597) { return putchar(x) + 1; }
+  if (x == 1598) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1599) { return putchar(x) + 3; }
+  if (x == 1600) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1601) { return putchar(x) + 5; }
+  if (x == 1602) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1603) { return putchar(x) + 0; }
+  if (x == 1604) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1605) { return putchar(x) + 2; }
+  if (x == 1606) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1607) { return putchar(x) + 4; }
+  if (x == 1608) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1609) { return putchar(x) + 6; }
+  if (x == 1610) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1611) { return putchar(x) + 1; }
+  if (x == 1612) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1613) { return putchar(x) + 3; }
+  if (x == 1614) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1615) { return putchar(x) + 5; }
+  if (x == 1616) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1617) { return putchar(x) + 0; }
+  if (x == 1618) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1619) { return putchar(x) + 2; }
+  if (x == 1620) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1621) { return putchar(x) + 4; }
+  if (x == 1622) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1623) { return putchar(x) + 6; }
+  if (x == 1624) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1625) { return putchar(x) + 1; }
+  if (x == 1626) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1627) { return putchar(x) + 3; }
+  if (x == 1628) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1629) { return putchar(x) + 5; }
+  if (x == 1630) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1631) { return putchar(x) + 0; }
+  if (x == 1632) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1633) { return putchar(x) + 2; }
+  if (x == 1634) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1635) { return putchar(x) + 4; }
+  if (x == 1636) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1637) { return putchar(x) + 6; }
+  if (x == 1638) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1639) { return putchar(x) + 1; }
+  if (x == 1640) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1641) { return putchar(x) + 3; }
+  if (x == 1642) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1643) { return putchar(x) + 5; }
+  if (x == 1644) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1645) { return putchar(x) + 0; }
+  if (x == 1646) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1647) { return putchar(x) + 2; }
+  if (x == 1648) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1649) { return putchar(x) + 4; }
+  if (x == 1650) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1651) { return putchar(x) + 6; }
+  if (x == 1652) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1653) { return putchar(x) + 1; }
+  if (x == 1654) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1655) { return putchar(x) + 3; }
+  if (x == 1656) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1657) { return putchar(x) + 5; }
+  if (x == 1658) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1659) { return putchar(x) + 0; }
+  if (x == 1660) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1661) { return putchar(x) + 2; }
+  if (x == 1662) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1663) { return putchar(x) + 4; }
+  if (x == 1664) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1665) { return putchar(x) + 6; }
+  if (x == 1666) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1667) { return putchar(x) + 1; }
+  if (x == 1668) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1669) { return putchar(x) + 3; }
+  if (x == 1670) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1671) { return putchar(x) + 5; }
+  if (x == 1672) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1673) { return putchar(x) + 0; }
+  if (x == 1674) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1675) { return putchar(x) + 2; }
+  if (x == 1676) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1677) { return putchar(x) + 4; }
+  if (x == 1678) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1679) { return putchar(x) + 6; }
+  if (x == 1680) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1681) { return putchar(x) + 1; }
+  if (x == 1682) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1683) { return putchar(x) + 3; }
+  if (x == 1684) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1685) { return putchar(x) + 5; }
+  if (x == 1686) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1687) { return putchar(x) + 0; }
+  if (x == 1688) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1689) { return putchar(x) + 2; }
+  if (x == 1690) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1691) { return putchar(x) + 4; }
+  if (x == 1692) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1693) { return putchar(x) + 6; }
+  if (x == 1694) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1695) { return putchar(x) + 1; }
+  if (x == 1696) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1697) { return putchar(x) + 3; }
+  if (x == 1698) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1699) { return putchar(x) + 5; }
+  if (x == 1700) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1701) { return putchar(x) + 0; }
+  if (x == 1702) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1703) { return putchar(x) + 2; }
+  if (x == 1704) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1705) { return putchar(x) + 4; }
+  if (x == 1706) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1707) { return putchar(x) + 6; }
+  if (x == 1708) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1709) { return putchar(x) + 1; }
+  if (x == 1710) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1711) { return putchar(x) + 3; }
+  if (x == 1712) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1713) { return putchar(x) + 5; }
+  if (x == 1714) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1715) { return putchar(x) + 0; }
+  if (x == 1716) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1717) { return putchar(x) + 2; }
+  if (x == 1718) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1719) { return putchar(x) + 4; }
+  if (x == 1720) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1721) { return putchar(x) + 6; }
+  if (x == 1722) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1723) { return putchar(x) + 1; }
+  if (x == 1724) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1725) { return putchar(x) + 3; }
+  if (x == 1726) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1727) { return putchar(x) + 5; }
+  if (x == 1728) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1729) { return putchar(x) + 0; }
+  if (x == 1730) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1731) { return putchar(x) + 2; }
+  if (x == 1732) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1733) { return putchar(x) + 4; }
+  if (x == 1734) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1735) { return putchar(x) + 6; }
+  if (x == 1736) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1737) { return putchar(x) + 1; }
+  if (x == 1738) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1739) { return putchar(x) + 3; }
+  if (x == 1740) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1741) { return putchar(x) + 5; }
+  if (x == 1742) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1743) { return putchar(x) + 0; }
+  if (x == 1744) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1745) { return putchar(x) + 2; }
+  if (x == 1746) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1747) { return putchar(x) + 4; }
+  if (x == 1748) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1749) { return putchar(x) + 6; }
+  if (x == 1750) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1751) { return putchar(x) + 1; }
+  if (x == 1752) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1753) { return putchar(x) + 3; }
+  if (x == 1754) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1755) { return putchar(x) + 5; }
+  if (x == 1756) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1757) { return putchar(x) + 0; }
+  if (x == 1758) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1759) { return putchar(x) + 2; }
+  if (x == 1760) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1761) { return putchar(x) + 4; }
+  if (x == 1762) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1763) { return putchar(x) + 6; }
+  if (x == 1764) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1765) { return putchar(x) + 1; }
+  if (x == 1766) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1767) { return putchar(x) + 3; }
+  if (x == 1768) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1769) { return putchar(x) + 5; }
+  if (x == 1770) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1771) { return putchar(x) + 0; }
+  if (x == 1772) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1773) { return putchar(x) + 2; }
+  if (x == 1774) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1775) { return putchar(x) + 4; }
+  if (x == 1776) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1777) { return putchar(x) + 6; }
+  if (x == 1778) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1779) { return putchar(x) + 1; }
+  if (x == 1780) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1781) { return putchar(x) + 3; }
+  if (x == 1782) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1783) { return putchar(x) + 5; }
+  if (x == 1784) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1785) { return putchar(x) + 0; }
+  if (x == 1786) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1787) { return putchar(x) + 2; }
+  if (x == 1788) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1789) { return putchar(x) + 4; }
+  if (x == 1790) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1791) { return putchar(x) + 6; }
+  if (x == 1792) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1793) { return putchar(x) + 1; }
+  if (x == 1794) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1795) { return putchar(x) + 3; }
+  if (x == 1796) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1797) { return putchar(x) + 5; }
+  if (x == 1798) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1799) { return putchar(x) + 0; }
+  if (x == 1800) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1801) { return putchar(x) + 2; }
+  if (x == 1802) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1803) { return putchar(x) + 4; }
+  if (x == 1804) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1805) { return putchar(x) + 6; }
+  if (x == 1806) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1807) { return putchar(x) + 1; }
+  if (x == 1808) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1809) { return putchar(x) + 3; }
+  if (x == 1810) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1811) { return putchar(x) + 5; }
+  if (x == 1812) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1813) { return putchar(x) + 0; }
+  if (x == 1814) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1815) { return putchar(x) + 2; }
+  if (x == 1816) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1817) { return putchar(x) + 4; }
+  if (x == 1818) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1819) { return putchar(x) + 6; }
+  if (x == 1820) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1821) { return putchar(x) + 1; }
+  if (x == 1822) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1823) { return putchar(x) + 3; }
+  if (x == 1824) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1825) { return putchar(x) + 5; }
+  if (x == 1826) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1827) { return putchar(x) + 0; }
+  if (x == 1828) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1829) { return putchar(x) + 2; }
+  if (x == 1830) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1831) { return putchar(x) + 4; }
+  if (x == 1832) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1833) { return putchar(x) + 6; }
+  if (x == 1834) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1835) { return putchar(x) + 1; }
+  if (x == 1836) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1837) { return putchar(x) + 3; }
+  if (x == 1838) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1839) { return putchar(x) + 5; }
+  if (x == 1840) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1841) { return putchar(x) + 0; }
+  if (x == 1842) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1843) { return putchar(x) + 2; }
+  if (x == 1844) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1845) { return putchar(x) + 4; }
+  if (x == 1846) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1847) { return putchar(x) + 6; }
+  if (x == 1848) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1849) { return putchar(x) + 1; }
+  if (x == 1850) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1851) { return putchar(x) + 3; }
+  if (x == 1852) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1853) { return putchar(x) + 5; }
+  if (x == 1854) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1855) { return putchar(x) + 0; }
+  if (x == 1856) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1857) { return putchar(x) + 2; }
+  if (x == 1858) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1859) { return putchar(x) + 4; }
+  if (x == 1860) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1861) { return putchar(x) + 6; }
+  if (x == 1862) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1863) { return putchar(x) + 1; }
+  if (x == 1864) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1865) { return putchar(x) + 3; }
+  if (x == 1866) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1867) { return putchar(x) + 5; }
+  if (x == 1868) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1869) { return putchar(x) + 0; }
+  if (x == 1870) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1871) { return putchar(x) + 2; }
+  if (x == 1872) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1873) { return putchar(x) + 4; }
+  if (x == 1874) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1875) { return putchar(x) + 6; }
+  if (x == 1876) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1877) { return putchar(x) + 1; }
+  if (x == 1878) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1879) { return putchar(x) + 3; }
+  if (x == 1880) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1881) { return putchar(x) + 5; }
+  if (x == 1882) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1883) { return putchar(x) + 0; }
+  if (x == 1884) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1885) { return putchar(x) + 2; }
+  if (x == 1886) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1887) { return putchar(x) + 4; }
+  if (x == 1888) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1889) { return putchar(x) + 6; }
+  if (x == 1890) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1891) { return putchar(x) + 1; }
+  if (x == 1892) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1893) { return putchar(x) + 3; }
+  if (x == 1894) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1895) { return putchar(x) + 5; }
+  if (x == 1896) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1897) { return putchar(x) + 0; }
+  if (x == 1898) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1899) { return putchar(x) + 2; }
+  if (x == 1900) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1901) { return putchar(x) + 4; }
+  if (x == 1902) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1903) { return putchar(x) + 6; }
+  if (x == 1904) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1905) { return putchar(x) + 1; }
+  if (x == 1906) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1907) { return putchar(x) + 3; }
+  if (x == 1908) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1909) { return putchar(x) + 5; }
+  if (x == 1910) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1911) { return putchar(x) + 0; }
+  if (x == 1912) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1913) { return putchar(x) + 2; }
+  if (x == 1914) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1915) { return putchar(x) + 4; }
+  if (x == 1916) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1917) { return putchar(x) + 6; }
+  if (x == 1918) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1919) { return putchar(x) + 1; }
+  if (x == 1920) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1921) { return putchar(x) + 3; }
+  if (x == 1922) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1923) { return putchar(x) + 5; }
+  if (x == 1924) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1925) { return putchar(x) + 0; }
+  if (x == 1926) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1927) { return putchar(x) + 2; }
+  if (x == 1928) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1929) { return putchar(x) + 4; }
+  if (x == 1930) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1931) { return putchar(x) + 6; }
+  if (x == 1932) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1933) { return putchar(x) + 1; }
+  if (x == 1934) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1935) { return putchar(x) + 3; }
+  if (x == 1936) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1937) { return putchar(x) + 5; }
+  if (x == 1938) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1939) { return putchar(x) + 0; }
+  if (x == 1940) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1941) { return putchar(x) + 2; }
+  if (x == 1942) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1943) { return putchar(x) + 4; }
+  if (x == 1944) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1945) { return putchar(x) + 6; }
+  if (x == 1946) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1947) { return putchar(x) + 1; }
+  if (x == 1948) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1949) { return putchar(x) + 3; }
+  if (x == 1950) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1951) { return putchar(x) + 5; }
+  if (x == 1952) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1953) { return putchar(x) + 0; }
+  if (x == 1954) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1955) { return putchar(x) + 2; }
+  if (x == 1956) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1957) { return putchar(x) + 4; }
+  if (x == 1958) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1959) { return putchar(x) + 6; }
+  if (x == 1960) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1961) { return putchar(x) + 1; }
+  if (x == 1962) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1963) { return putchar(x) + 3; }
+  if (x == 1964) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1965) { return putchar(x) + 5; }
+  if (x == 1966) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1967) { return putchar(x) + 0; }
+  if (x == 1968) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1969) { return putchar(x) + 2; }
+  if (x == 1970) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1971) { return putchar(x) + 4; }
+  if (x == 1972) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1973) { return putchar(x) + 6; }
+  if (x == 1974) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1975) { return putchar(x) + 1; }
+  if (x == 1976) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1977) { return putchar(x) + 3; }
+  if (x == 1978) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1979) { return putchar(x) + 5; }
+  if (x == 1980) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1981) { return putchar(x) + 0; }
+  if (x == 1982) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1983) { return putchar(x) + 2; }
+  if (x == 1984) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1985) { return putchar(x) + 4; }
+  if (x == 1986) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 1987) { return putchar(x) + 6; }
+  if (x == 1988) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 1989) { return putchar(x) + 1; }
+  if (x == 1990) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 1991) { return putchar(x) + 3; }
+  if (x == 1992) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 1993) { return putchar(x) + 5; }
+  if (x == 1994) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 1995) { return putchar(x) + 0; }
+  if (x == 1996) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 1997) { return putchar(x) + 2; }
+  if (x == 1998) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 1999) { return putchar(x) + 4; }
+  if (x == 2000) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2001) { return putchar(x) + 6; }
+  if (x == 2002) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2003) { return putchar(x) + 1; }
+  if (x == 2004) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2005) { return putchar(x) + 3; }
+  if (x == 2006) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2007) { return putchar(x) + 5; }
+  if (x == 2008) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2009) { return putchar(x) + 0; }
+  if (x == 2010) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2011) { return putchar(x) + 2; }
+  if (x == 2012) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2013) { return putchar(x) + 4; }
+  if (x == 2014) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2015) { return putchar(x) + 6; }
+  if (x == 2016) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2017) { return putchar(x) + 1; }
+  if (x == 2018) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2019) { return putchar(x) + 3; }
+  if (x == 2020) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2021) { return putchar(x) + 5; }
+  if (x == 2022) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2023) { return putchar(x) + 0; }
+  if (x == 2024) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2025) { return putchar(x) + 2; }
+  if (x == 2026) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2027) { return putchar(x) + 4; }
+  if (x == 2028) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2029) { return putchar(x) + 6; }
+  if (x == 2030) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2031) { return putchar(x) + 1; }
+  if (x == 2032) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2033) { return putchar(x) + 3; }
+  if (x == 2034) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2035) { return putchar(x) + 5; }
+  if (x == 2036) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2037) { return putchar(x) + 0; }
+  if (x == 2038) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2039) { return putchar(x) + 2; }
+  if (x == 2040) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2041) { return putchar(x) + 4; }
+  if (x == 2042) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2043) { return putchar(x) + 6; }
+  if (x == 2044) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2045) { return putchar(x) + 1; }
+  if (x == 2046) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2047) { return putchar(x) + 3; }
+  if (x == 2048) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2049) { return putchar(x) + 5; }
+  if (x == 2050) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2051) { return putchar(x) + 0; }
+  if (x == 2052) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2053) { return putchar(x) + 2; }
+  if (x == 2054) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2055) { return putchar(x) + 4; }
+  if (x == 2056) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2057) { return putchar(x) + 6; }
+  if (x == 2058) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2059) { return putchar(x) + 1; }
+  if (x == 2060) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2061) { return putchar(x) + 3; }
+  if (x == 2062) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2063) { return putchar(x) + 5; }
+  if (x == 2064) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2065) { return putchar(x) + 0; }
+  if (x == 2066) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2067) { return putchar(x) + 2; }
+  if (x == 2068) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2069) { return putchar(x) + 4; }
+  if (x == 2070) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2071) { return putchar(x) + 6; }
+  if (x == 2072) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2073) { return putchar(x) + 1; }
+  if (x == 2074) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2075) { return putchar(x) + 3; }
+  if (x == 2076) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2077) { return putchar(x) + 5; }
+  if (x == 2078) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2079) { return putchar(x) + 0; }
+  if (x == 2080) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2081) { return putchar(x) + 2; }
+  if (x == 2082) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2083) { return putchar(x) + 4; }
+  if (x == 2084) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2085) { return putchar(x) + 6; }
+  if (x == 2086) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2087) { return putchar(x) + 1; }
+  if (x == 2088) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2089) { return putchar(x) + 3; }
+  if (x == 2090) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2091) { return putchar(x) + 5; }
+  if (x == 2092) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2093) { return putchar(x) + 0; }
+  if (x == 2094) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2095) { return putchar(x) + 2; }
+  if (x == 2096) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2097) { return putchar(x) + 4; }
+  if (x == 2098) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2099) { return putchar(x) + 6; }
+  if (x == 2100) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2101) { return putchar(x) + 1; }
+  if (x == 2102) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2103) { return putchar(x) + 3; }
+  if (x == 2104) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2105) { return putchar(x) + 5; }
+  if (x == 2106) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2107) { return putchar(x) + 0; }
+  if (x == 2108) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2109) { return putchar(x) + 2; }
+  if (x == 2110) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2111) { return putchar(x) + 4; }
+  if (x == 2112) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2113) { return putchar(x) + 6; }
+  if (x == 2114) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2115) { return putchar(x) + 1; }
+  if (x == 2116) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2117) { return putchar(x) + 3; }
+  if (x == 2118) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2119) { return putchar(x) + 5; }
+  if (x == 2120) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2121) { return putchar(x) + 0; }
+  if (x == 2122) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2123) { return putchar(x) + 2; }
+  if (x == 2124) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2125) { return putchar(x) + 4; }
+  if (x == 2126) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2127) { return putchar(x) + 6; }
+  if (x == 2128) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2129) { return putchar(x) + 1; }
+  if (x == 2130) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2131) { return putchar(x) + 3; }
+  if (x == 2132) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2133) { return putchar(x) + 5; }
+  if (x == 2134) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2135) { return putchar(x) + 0; }
+  if (x == 2136) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2137) { return putchar(x) + 2; }
+  if (x == 2138) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2139) { return putchar(x) + 4; }
+  if (x == 2140) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2141) { return putchar(x) + 6; }
+  if (x == 2142) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2143) { return putchar(x) + 1; }
+  if (x == 2144) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2145) { return putchar(x) + 3; }
+  if (x == 2146) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2147) { return putchar(x) + 5; }
+  if (x == 2148) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2149) { return putchar(x) + 0; }
+  if (x == 2150) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2151) { return putchar(x) + 2; }
+  if (x == 2152) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2153) { return putchar(x) + 4; }
+  if (x == 2154) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2155) { return putchar(x) + 6; }
+  if (x == 2156) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2157) { return putchar(x) + 1; }
+  if (x == 2158) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2159) { return putchar(x) + 3; }
+  if (x == 2160) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2161) { return putchar(x) + 5; }
+  if (x == 2162) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2163) { return putchar(x) + 0; }
+  if (x == 2164) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2165) { return putchar(x) + 2; }
+  if (x == 2166) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2167) { return putchar(x) + 4; }
+  if (x == 2168) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2169) { return putchar(x) + 6; }
+  if (x == 2170) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2171) { return putchar(x) + 1; }
+  if (x == 2172) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2173) { return putchar(x) + 3; }
+  if (x == 2174) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2175) { return putchar(x) + 5; }
+  if (x == 2176) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2177) { return putchar(x) + 0; }
+  if (x == 2178) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2179) { return putchar(x) + 2; }
+  if (x == 2180) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2181) { return putchar(x) + 4; }
+  if (x == 2182) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2183) { return putchar(x) + 6; }
+  if (x == 2184) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2185) { return putchar(x) + 1; }
+  if (x == 2186) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2187) { return putchar(x) + 3; }
+  if (x == 2188) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2189) { return putchar(x) + 5; }
+  if (x == 2190) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2191) { return putchar(x) + 0; }
+  if (x == 2192) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2193) { return putchar(x) + 2; }
+  if (x == 2194) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2195) { return putchar(x) + 4; }
+  if (x == 2196) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2197) { return putchar(x) + 6; }
+  if (x == 2198) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2199) { return putchar(x) + 1; }
+  if (x == 2200) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2201) { return putchar(x) + 3; }
+  if (x == 2202) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2203) { return putchar(x) + 5; }
+  if (x == 2204) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2205) { return putchar(x) + 0; }
+  if (x == 2206) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2207) { return putchar(x) + 2; }
+  if (x == 2208) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2209) { return putchar(x) + 4; }
+  if (x == 2210) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2211) { return putchar(x) + 6; }
+  if (x == 2212) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2213) { return putchar(x) + 1; }
+  if (x == 2214) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2215) { return putchar(x) + 3; }
+  if (x == 2216) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2217) { return putchar(x) + 5; }
+  if (x == 2218) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2219) { return putchar(x) + 0; }
+  if (x == 2220) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2221) { return putchar(x) + 2; }
+  if (x == 2222) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2223) { return putchar(x) + 4; }
+  if (x == 2224) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2225) { return putchar(x) + 6; }
+  if (x == 2226) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2227) { return putchar(x) + 1; }
+  if (x == 2228) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2229) { return putchar(x) + 3; }
+  if (x == 2230) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2231) { return putchar(x) + 5; }
+  if (x == 2232) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2233) { return putchar(x) + 0; }
+  if (x == 2234) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2235) { return putchar(x) + 2; }
+  if (x == 2236) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2237) { return putchar(x) + 4; }
+  if (x == 2238) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2239) { return putchar(x) + 6; }
+  if (x == 2240) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2241) { return putchar(x) + 1; }
+  if (x == 2242) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2243) { return putchar(x) + 3; }
+  if (x == 2244) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2245) { return putchar(x) + 5; }
+  if (x == 2246) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2247) { return putchar(x) + 0; }
+  if (x == 2248) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2249) { return putchar(x) + 2; }
+  if (x == 2250) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2251) { return putchar(x) + 4; }
+  if (x == 2252) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2253) { return putchar(x) + 6; }
+  if (x == 2254) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2255) { return putchar(x) + 1; }
+  if (x == 2256) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2257) { return putchar(x) + 3; }
+  if (x == 2258) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2259) { return putchar(x) + 5; }
+  if (x == 2260) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2261) { return putchar(x) + 0; }
+  if (x == 2262) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2263) { return putchar(x) + 2; }
+  if (x == 2264) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2265) { return putchar(x) + 4; }
+  if (x == 2266) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2267) { return putchar(x) + 6; }
+  if (x == 2268) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2269) { return putchar(x) + 1; }
+  if (x == 2270) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2271) { return putchar(x) + 3; }
+  if (x == 2272) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2273) { return putchar(x) + 5; }
+  if (x == 2274) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2275) { return putchar(x) + 0; }
+  if (x == 2276) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2277) { return putchar(x) + 2; }
+  if (x == 2278) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2279) { return putchar(x) + 4; }
+  if (x == 2280) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2281) { return putchar(x) + 6; }
+  if (x == 2282) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2283) { return putchar(x) + 1; }
+  if (x == 2284) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2285) { return putchar(x) + 3; }
+  if (x == 2286) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2287) { return putchar(x) + 5; }
+  if (x == 2288) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2289) { return putchar(x) + 0; }
+  if (x == 2290) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2291) { return putchar(x) + 2; }
+  if (x == 2292) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2293) { return putchar(x) + 4; }
+  if (x == 2294) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2295) { return putchar(x) + 6; }
+  if (x == 2296) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2297) { return putchar(x) + 1; }
+  if (x == 2298) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2299) { return putchar(x) + 3; }
+  if (x == 2300) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2301) { return putchar(x) + 5; }
+  if (x == 2302) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2303) { return putchar(x) + 0; }
+  if (x == 2304) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2305) { return putchar(x) + 2; }
+  if (x == 2306) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2307) { return putchar(x) + 4; }
+  if (x == 2308) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2309) { return putchar(x) + 6; }
+  if (x == 2310) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2311) { return putchar(x) + 1; }
+  if (x == 2312) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2313) { return putchar(x) + 3; }
+  if (x == 2314) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2315) { return putchar(x) + 5; }
+  if (x == 2316) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2317) { return putchar(x) + 0; }
+  if (x == 2318) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2319) { return putchar(x) + 2; }
+  if (x == 2320) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2321) { return putchar(x) + 4; }
+  if (x == 2322) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2323) { return putchar(x) + 6; }
+  if (x == 2324) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2325) { return putchar(x) + 1; }
+  if (x == 2326) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2327) { return putchar(x) + 3; }
+  if (x == 2328) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2329) { return putchar(x) + 5; }
+  if (x == 2330) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2331) { return putchar(x) + 0; }
+  if (x == 2332) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2333) { return putchar(x) + 2; }
+  if (x == 2334) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2335) { return putchar(x) + 4; }
+  if (x == 2336) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2337) { return putchar(x) + 6; }
+  if (x == 2338) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2339) { return putchar(x) + 1; }
+  if (x == 2340) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2341) { return putchar(x) + 3; }
+  if (x == 2342) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2343) { return putchar(x) + 5; }
+  if (x == 2344) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2345) { return putchar(x) + 0; }
+  if (x == 2346) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2347) { return putchar(x) + 2; }
+  if (x == 2348) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2349) { return putchar(x) + 4; }
+  if (x == 2350) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2351) { return putchar(x) + 6; }
+  if (x == 2352) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2353) { return putchar(x) + 1; }
+  if (x == 2354) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2355) { return putchar(x) + 3; }
+  if (x == 2356) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2357) { return putchar(x) + 5; }
+  if (x == 2358) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2359) { return putchar(x) + 0; }
+  if (x == 2360) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2361) { return putchar(x) + 2; }
+  if (x == 2362) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2363) { return putchar(x) + 4; }
+  if (x == 2364) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2365) { return putchar(x) + 6; }
+  if (x == 2366) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2367) { return putchar(x) + 1; }
+  if (x == 2368) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2369) { return putchar(x) + 3; }
+  if (x == 2370) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2371) { return putchar(x) + 5; }
+  if (x == 2372) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2373) { return putchar(x) + 0; }
+  if (x == 2374) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2375) { return putchar(x) + 2; }
+  if (x == 2376) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2377) { return putchar(x) + 4; }
+  if (x == 2378) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2379) { return putchar(x) + 6; }
+  if (x == 2380) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2381) { return putchar(x) + 1; }
+  if (x == 2382) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2383) { return putchar(x) + 3; }
+  if (x == 2384) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2385) { return putchar(x) + 5; }
+  if (x == 2386) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2387) { return putchar(x) + 0; }
+  if (x == 2388) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2389) { return putchar(x) + 2; }
+  if (x == 2390) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2391) { return putchar(x) + 4; }
+  if (x == 2392) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2393) { return putchar(x) + 6; }
+  if (x == 2394) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2395) { return putchar(x) + 1; }
+  if (x == 2396) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2397) { return putchar(x) + 3; }
+  if (x == 2398) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2399) { return putchar(x) + 5; }
+  if (x == 2400) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2401) { return putchar(x) + 0; }
+  if (x == 2402) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2403) { return putchar(x) + 2; }
+  if (x == 2404) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2405) { return putchar(x) + 4; }
+  if (x == 2406) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2407) { return putchar(x) + 6; }
+  if (x == 2408) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2409) { return putchar(x) + 1; }
+  if (x == 2410) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2411) { return putchar(x) + 3; }
+  if (x == 2412) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2413) { return putchar(x) + 5; }
+  if (x == 2414) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2415) { return putchar(x) + 0; }
+  if (x == 2416) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2417) { return putchar(x) + 2; }
+  if (x == 2418) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2419) { return putchar(x) + 4; }
+  if (x == 2420) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2421) { return putchar(x) + 6; }
+  if (x == 2422) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2423) { return putchar(x) + 1; }
+  if (x == 2424) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2425) { return putchar(x) + 3; }
+  if (x == 2426) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2427) { return putchar(x) + 5; }
+  if (x == 2428) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2429) { return putchar(x) + 0; }
+  if (x == 2430) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2431) { return putchar(x) + 2; }
+  if (x == 2432) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2433) { return putchar(x) + 4; }
+  if (x == 2434) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2435) { return putchar(x) + 6; }
+  if (x == 2436) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2437) { return putchar(x) + 1; }
+  if (x == 2438) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2439) { return putchar(x) + 3; }
+  if (x == 2440) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2441) { return putchar(x) + 5; }
+  if (x == 2442) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2443) { return putchar(x) + 0; }
+  if (x == 2444) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2445) { return putchar(x) + 2; }
+  if (x == 2446) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2447) { return putchar(x) + 4; }
+  if (x == 2448) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2449) { return putchar(x) + 6; }
+  if (x == 2450) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2451) { return putchar(x) + 1; }
+  if (x == 2452) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2453) { return putchar(x) + 3; }
+  if (x == 2454) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2455) { return putchar(x) + 5; }
+  if (x == 2456) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2457) { return putchar(x) + 0; }
+  if (x == 2458) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2459) { return putchar(x) + 2; }
+  if (x == 2460) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2461) { return putchar(x) + 4; }
+  if (x == 2462) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2463) { return putchar(x) + 6; }
+  if (x == 2464) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2465) { return putchar(x) + 1; }
+  if (x == 2466) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2467) { return putchar(x) + 3; }
+  if (x == 2468) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2469) { return putchar(x) + 5; }
+  if (x == 2470) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2471) { return putchar(x) + 0; }
+  if (x == 2472) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2473) { return putchar(x) + 2; }
+  if (x == 2474) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2475) { return putchar(x) + 4; }
+  if (x == 2476) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2477) { return putchar(x) + 6; }
+  if (x == 2478) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2479) { return putchar(x) + 1; }
+  if (x == 2480) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2481) { return putchar(x) + 3; }
+  if (x == 2482) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2483) { return putchar(x) + 5; }
+  if (x == 2484) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2485) { return putchar(x) + 0; }
+  if (x == 2486) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2487) { return putchar(x) + 2; }
+  if (x == 2488) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2489) { return putchar(x) + 4; }
+  if (x == 2490) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2491) { return putchar(x) + 6; }
+  if (x == 2492) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2493) { return putchar(x) + 1; }
+  if (x == 2494) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2495) { return putchar(x) + 3; }
+  if (x == 2496) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2497) { return putchar(x) + 5; }
+  if (x == 2498) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2499) { return putchar(x) + 0; }
+  if (x == 2500) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2501) { return putchar(x) + 2; }
+  if (x == 2502) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2503) { return putchar(x) + 4; }
+  if (x == 2504) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2505) { return putchar(x) + 6; }
+  if (x == 2506) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2507) { return putchar(x) + 1; }
+  if (x == 2508) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2509) { return putchar(x) + 3; }
+  if (x == 2510) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2511) { return putchar(x) + 5; }
+  if (x == 2512) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2513) { return putchar(x) + 0; }
+  if (x == 2514) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2515) { return putchar(x) + 2; }
+  if (x == 2516) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2517) { return putchar(x) + 4; }
+  if (x == 2518) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2519) { return putchar(x) + 6; }
+  if (x == 2520) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2521) { return putchar(x) + 1; }
+  if (x == 2522) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2523) { return putchar(x) + 3; }
+  if (x == 2524) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2525) { return putchar(x) + 5; }
+  if (x == 2526) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2527) { return putchar(x) + 0; }
+  if (x == 2528) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2529) { return putchar(x) + 2; }
+  if (x == 2530) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2531) { return putchar(x) + 4; }
+  if (x == 2532) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2533) { return putchar(x) + 6; }
+  if (x == 2534) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2535) { return putchar(x) + 1; }
+  if (x == 2536) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2537) { return putchar(x) + 3; }
+  if (x == 2538) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2539) { return putchar(x) + 5; }
+  if (x == 2540) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2541) { return putchar(x) + 0; }
+  if (x == 2542) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2543) { return putchar(x) + 2; }
+  if (x == 2544) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2545) { return putchar(x) + 4; }
+  if (x == 2546) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2547) { return putchar(x) + 6; }
+  if (x == 2548) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2549) { return putchar(x) + 1; }
+  if (x == 2550) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2551) { return putchar(x) + 3; }
+  if (x == 2552) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2553) { return putchar(x) + 5; }
+  if (x == 2554) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2555) { return putchar(x) + 0; }
+  if (x == 2556) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2557) { return putchar(x) + 2; }
+  if (x == 2558) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2559) { return putchar(x) + 4; }
+  if (x == 2560) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2561) { return putchar(x) + 6; }
+  if (x == 2562) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2563) { return putchar(x) + 1; }
+  if (x == 2564) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2565) { return putchar(x) + 3; }
+  if (x == 2566) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2567) { return putchar(x) + 5; }
+  if (x == 2568) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2569) { return putchar(x) + 0; }
+  if (x == 2570) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2571) { return putchar(x) + 2; }
+  if (x == 2572) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2573) { return putchar(x) + 4; }
+  if (x == 2574) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2575) { return putchar(x) + 6; }
+  if (x == 2576) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2577) { return putchar(x) + 1; }
+  if (x == 2578) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2579) { return putchar(x) + 3; }
+  if (x == 2580) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2581) { return putchar(x) + 5; }
+  if (x == 2582) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2583) { return putchar(x) + 0; }
+  if (x == 2584) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2585) { return putchar(x) + 2; }
+  if (x == 2586) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2587) { return putchar(x) + 4; }
+  if (x == 2588) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2589) { return putchar(x) + 6; }
+  if (x == 2590) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2591) { return putchar(x) + 1; }
+  if (x == 2592) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2593) { return putchar(x) + 3; }
+  if (x == 2594) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2595) { return putchar(x) + 5; }
+  if (x == 2596) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2597) { return putchar(x) + 0; }
+  if (x == 2598) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2599) { return putchar(x) + 2; }
+  if (x == 2600) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2601) { return putchar(x) + 4; }
+  if (x == 2602) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2603) { return putchar(x) + 6; }
+  if (x == 2604) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2605) { return putchar(x) + 1; }
+  if (x == 2606) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2607) { return putchar(x) + 3; }
+  if (x == 2608) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2609) { return putchar(x) + 5; }
+  if (x == 2610) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2611) { return putchar(x) + 0; }
+  if (x == 2612) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2613) { return putchar(x) + 2; }
+  if (x == 2614) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2615) { return putchar(x) + 4; }
+  if (x == 2616) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2617) { return putchar(x) + 6; }
+  if (x == 2618) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2619) { return putchar(x) + 1; }
+  if (x == 2620) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2621) { return putchar(x) + 3; }
+  if (x == 2622) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2623) { return putchar(x) + 5; }
+  if (x == 2624) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2625) { return putchar(x) + 0; }
+  if (x == 2626) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2627) { return putchar(x) + 2; }
+  if (x == 2628) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2629) { return putchar(x) + 4; }
+  if (x == 2630) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2631) { return putchar(x) + 6; }
+  if (x == 2632) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2633) { return putchar(x) + 1; }
+  if (x == 2634) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2635) { return putchar(x) + 3; }
+  if (x == 2636) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2637) { return putchar(x) + 5; }
+  if (x == 2638) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2639) { return putchar(x) + 0; }
+  if (x == 2640) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2641) { return putchar(x) + 2; }
+  if (x == 2642) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2643) { return putchar(x) + 4; }
+  if (x == 2644) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2645) { return putchar(x) + 6; }
+  if (x == 2646) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2647) { return putchar(x) + 1; }
+  if (x == 2648) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2649) { return putchar(x) + 3; }
+  if (x == 2650) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2651) { return putchar(x) + 5; }
+  if (x == 2652) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2653) { return putchar(x) + 0; }
+  if (x == 2654) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2655) { return putchar(x) + 2; }
+  if (x == 2656) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2657) { return putchar(x) + 4; }
+  if (x == 2658) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2659) { return putchar(x) + 6; }
+  if (x == 2660) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2661) { return putchar(x) + 1; }
+  if (x == 2662) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2663) { return putchar(x) + 3; }
+  if (x == 2664) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2665) { return putchar(x) + 5; }
+  if (x == 2666) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2667) { return putchar(x) + 0; }
+  if (x == 2668) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2669) { return putchar(x) + 2; }
+  if (x == 2670) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2671) { return putchar(x) + 4; }
+  if (x == 2672) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2673) { return putchar(x) + 6; }
+  if (x == 2674) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2675) { return putchar(x) + 1; }
+  if (x == 2676) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2677) { return putchar(x) + 3; }
+  if (x == 2678) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2679) { return putchar(x) + 5; }
+  if (x == 2680) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2681) { return putchar(x) + 0; }
+  if (x == 2682) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2683) { return putchar(x) + 2; }
+  if (x == 2684) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2685) { return putchar(x) + 4; }
+  if (x == 2686) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2687) { return putchar(x) + 6; }
+  if (x == 2688) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2689) { return putchar(x) + 1; }
+  if (x == 2690) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2691) { return putchar(x) + 3; }
+  if (x == 2692) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2693) { return putchar(x) + 5; }
+  if (x == 2694) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2695) { return putchar(x) + 0; }
+  if (x == 2696) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2697) { return putchar(x) + 2; }
+  if (x == 2698) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2699) { return putchar(x) + 4; }
+  if (x == 2700) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2701) { return putchar(x) + 6; }
+  if (x == 2702) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2703) { return putchar(x) + 1; }
+  if (x == 2704) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2705) { return putchar(x) + 3; }
+  if (x == 2706) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2707) { return putchar(x) + 5; }
+  if (x == 2708) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2709) { return putchar(x) + 0; }
+  if (x == 2710) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2711) { return putchar(x) + 2; }
+  if (x == 2712) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2713) { return putchar(x) + 4; }
+  if (x == 2714) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2715) { return putchar(x) + 6; }
+  if (x == 2716) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2717) { return putchar(x) + 1; }
+  if (x == 2718) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2719) { return putchar(x) + 3; }
+  if (x == 2720) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2721) { return putchar(x) + 5; }
+  if (x == 2722) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2723) { return putchar(x) + 0; }
+  if (x == 2724) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2725) { return putchar(x) + 2; }
+  if (x == 2726) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2727) { return putchar(x) + 4; }
+  if (x == 2728) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2729) { return putchar(x) + 6; }
+  if (x == 2730) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2731) { return putchar(x) + 1; }
+  if (x == 2732) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2733) { return putchar(x) + 3; }
+  if (x == 2734) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2735) { return putchar(x) + 5; }
+  if (x == 2736) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2737) { return putchar(x) + 0; }
+  if (x == 2738) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2739) { return putchar(x) + 2; }
+  if (x == 2740) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2741) { return putchar(x) + 4; }
+  if (x == 2742) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2743) { return putchar(x) + 6; }
+  if (x == 2744) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2745) { return putchar(x) + 1; }
+  if (x == 2746) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2747) { return putchar(x) + 3; }
+  if (x == 2748) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2749) { return putchar(x) + 5; }
+  if (x == 2750) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2751) { return putchar(x) + 0; }
+  if (x == 2752) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2753) { return putchar(x) + 2; }
+  if (x == 2754) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2755) { return putchar(x) + 4; }
+  if (x == 2756) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2757) { return putchar(x) + 6; }
+  if (x == 2758) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2759) { return putchar(x) + 1; }
+  if (x == 2760) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2761) { return putchar(x) + 3; }
+  if (x == 2762) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2763) { return putchar(x) + 5; }
+  if (x == 2764) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2765) { return putchar(x) + 0; }
+  if (x == 2766) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2767) { return putchar(x) + 2; }
+  if (x == 2768) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2769) { return putchar(x) + 4; }
+  if (x == 2770) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2771) { return putchar(x) + 6; }
+  if (x == 2772) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2773) { return putchar(x) + 1; }
+  if (x == 2774) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2775) { return putchar(x) + 3; }
+  if (x == 2776) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2777) { return putchar(x) + 5; }
+  if (x == 2778) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2779) { return putchar(x) + 0; }
+  if (x == 2780) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2781) { return putchar(x) + 2; }
+  if (x == 2782) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2783) { return putchar(x) + 4; }
+  if (x == 2784) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2785) { return putchar(x) + 6; }
+  if (x == 2786) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2787) { return putchar(x) + 1; }
+  if (x == 2788) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2789) { return putchar(x) + 3; }
+  if (x == 2790) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2791) { return putchar(x) + 5; }
+  if (x == 2792) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2793) { return putchar(x) + 0; }
+  if (x == 2794) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2795) { return putchar(x) + 2; }
+  if (x == 2796) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2797) { return putchar(x) + 4; }
+  if (x == 2798) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2799) { return putchar(x) + 6; }
+  if (x == 2800) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2801) { return putchar(x) + 1; }
+  if (x == 2802) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2803) { return putchar(x) + 3; }
+  if (x == 2804) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2805) { return putchar(x) + 5; }
+  if (x == 2806) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2807) { return putchar(x) + 0; }
+  if (x == 2808) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2809) { return putchar(x) + 2; }
+  if (x == 2810) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2811) { return putchar(x) + 4; }
+  if (x == 2812) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2813) { return putchar(x) + 6; }
+  if (x == 2814) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2815) { return putchar(x) + 1; }
+  if (x == 2816) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2817) { return putchar(x) + 3; }
+  if (x == 2818) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2819) { return putchar(x) + 5; }
+  if (x == 2820) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2821) { return putchar(x) + 0; }
+  if (x == 2822) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2823) { return putchar(x) + 2; }
+  if (x == 2824) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2825) { return putchar(x) + 4; }
+  if (x == 2826) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2827) { return putchar(x) + 6; }
+  if (x == 2828) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2829) { return putchar(x) + 1; }
+  if (x == 2830) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2831) { return putchar(x) + 3; }
+  if (x == 2832) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2833) { return putchar(x) + 5; }
+  if (x == 2834) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2835) { return putchar(x) + 0; }
+  if (x == 2836) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2837) { return putchar(x) + 2; }
+  if (x == 2838) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2839) { return putchar(x) + 4; }
+  if (x == 2840) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2841) { return putchar(x) + 6; }
+  if (x == 2842) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2843) { return putchar(x) + 1; }
+  if (x == 2844) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2845) { return putchar(x) + 3; }
+  if (x == 2846) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2847) { return putchar(x) + 5; }
+  if (x == 2848) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2849) { return putchar(x) + 0; }
+  if (x == 2850) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2851) { return putchar(x) + 2; }
+  if (x == 2852) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2853) { return putchar(x) + 4; }
+  if (x == 2854) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2855) { return putchar(x) + 6; }
+  if (x == 2856) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2857) { return putchar(x) + 1; }
+  if (x == 2858) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2859) { return putchar(x) + 3; }
+  if (x == 2860) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2861) { return putchar(x) + 5; }
+  if (x == 2862) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2863) { return putchar(x) + 0; }
+  if (x == 2864) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2865) { return putchar(x) + 2; }
+  if (x == 2866) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2867) { return putchar(x) + 4; }
+  if (x == 2868) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2869) { return putchar(x) + 6; }
+  if (x == 2870) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2871) { return putchar(x) + 1; }
+  if (x == 2872) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2873) { return putchar(x) + 3; }
+  if (x == 2874) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2875) { return putchar(x) + 5; }
+  if (x == 2876) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2877) { return putchar(x) + 0; }
+  if (x == 2878) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2879) { return putchar(x) + 2; }
+  if (x == 2880) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2881) { return putchar(x) + 4; }
+  if (x == 2882) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2883) { return putchar(x) + 6; }
+  if (x == 2884) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2885) { return putchar(x) + 1; }
+  if (x == 2886) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2887) { return putchar(x) + 3; }
+  if (x == 2888) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2889) { return putchar(x) + 5; }
+  if (x == 2890) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2891) { return putchar(x) + 0; }
+  if (x == 2892) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2893) { return putchar(x) + 2; }
+  if (x == 2894) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2895) { return putchar(x) + 4; }
+  if (x == 2896) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2897) { return putchar(x) + 6; }
+  if (x == 2898) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2899) { return putchar(x) + 1; }
+  if (x == 2900) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2901) { return putchar(x) + 3; }
+  if (x == 2902) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2903) { return putchar(x) + 5; }
+  if (x == 2904) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2905) { return putchar(x) + 0; }
+  if (x == 2906) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2907) { return putchar(x) + 2; }
+  if (x == 2908) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2909) { return putchar(x) + 4; }
+  if (x == 2910) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2911) { return putchar(x) + 6; }
+  if (x == 2912) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2913) { return putchar(x) + 1; }
+  if (x == 2914) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2915) { return putchar(x) + 3; }
+  if (x == 2916) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2917) { return putchar(x) + 5; }
+  if (x == 2918) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2919) { return putchar(x) + 0; }
+  if (x == 2920) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2921) { return putchar(x) + 2; }
+  if (x == 2922) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2923) { return putchar(x) + 4; }
+  if (x == 2924) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2925) { return putchar(x) + 6; }
+  if (x == 2926) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2927) { return putchar(x) + 1; }
+  if (x == 2928) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2929) { return putchar(x) + 3; }
+  if (x == 2930) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2931) { return putchar(x) + 5; }
+  if (x == 2932) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2933) { return putchar(x) + 0; }
+  if (x == 2934) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2935) { return putchar(x) + 2; }
+  if (x == 2936) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2937) { return putchar(x) + 4; }
+  if (x == 2938) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2939) { return putchar(x) + 6; }
+  if (x == 2940) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2941) { return putchar(x) + 1; }
+  if (x == 2942) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2943) { return putchar(x) + 3; }
+  if (x == 2944) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2945) { return putchar(x) + 5; }
+  if (x == 2946) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2947) { return putchar(x) + 0; }
+  if (x == 2948) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2949) { return putchar(x) + 2; }
+  if (x == 2950) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2951) { return putchar(x) + 4; }
+  if (x == 2952) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2953) { return putchar(x) + 6; }
+  if (x == 2954) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2955) { return putchar(x) + 1; }
+  if (x == 2956) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2957) { return putchar(x) + 3; }
+  if (x == 2958) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2959) { return putchar(x) + 5; }
+  if (x == 2960) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2961) { return putchar(x) + 0; }
+  if (x == 2962) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2963) { return putchar(x) + 2; }
+  if (x == 2964) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2965) { return putchar(x) + 4; }
+  if (x == 2966) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2967) { return putchar(x) + 6; }
+  if (x == 2968) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2969) { return putchar(x) + 1; }
+  if (x == 2970) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2971) { return putchar(x) + 3; }
+  if (x == 2972) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2973) { return putchar(x) + 5; }
+  if (x == 2974) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2975) { return putchar(x) + 0; }
+  if (x == 2976) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2977) { return putchar(x) + 2; }
+  if (x == 2978) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2979) { return putchar(x) + 4; }
+  if (x == 2980) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2981) { return putchar(x) + 6; }
+  if (x == 2982) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2983) { return putchar(x) + 1; }
+  if (x == 2984) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2985) { return putchar(x) + 3; }
+  if (x == 2986) { x = putchar(x) + 4; } else { x = putchar(x + 1); }
+  if (x == 2987) { return putchar(x) + 5; }
+  if (x == 2988) { x = putchar(x) + 6; } else { x = putchar(x + 1); }
+  if (x == 2989) { return putchar(x) + 0; }
+  if (x == 2990) { x = putchar(x) + 1; } else { x = putchar(x + 1); }
+  if (x == 2991) { return putchar(x) + 2; }
+  if (x == 2992) { x = putchar(x) + 3; } else { x = putchar(x + 1); }
+  if (x == 2993) { return putchar(x) + 4; }
+  if (x == 2994) { x = putchar(x) + 5; } else { x = putchar(x + 1); }
+  if (x == 2995) { return putchar(x) + 6; }
+  if (x == 2996) { x = putchar(x) + 0; } else { x = putchar(x + 1); }
+  if (x == 2997) { return putchar(x) + 1; }
+  if (x == 2998) { x = putchar(x) + 2; } else { x = putchar(x + 1); }
+  if (x == 2999) { return putchar(x) + 3; }
+  return x;
+}
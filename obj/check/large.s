@@ -0,0 +1,37525 @@
+	.section .text
+	.global main
+	.type main, @function
+	.align 16
+main:
+	subq $8, %rsp
+	movl %edi, %eax
+	movl %eax, 4(%rsp)
+	cmpl $0, 4(%rsp)
+	jne .L0
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1
+.L0:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1:
+	cmpl $1, 4(%rsp)
+	je .LB0
+.L2:
+.L3:
+	cmpl $2, 4(%rsp)
+	jne .L4
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5
+.L4:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5:
+	cmpl $3, 4(%rsp)
+	je .LB1
+.L6:
+.L7:
+	cmpl $4, 4(%rsp)
+	jne .L8
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L9
+.L8:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L9:
+	cmpl $5, 4(%rsp)
+	je .LB2
+.L10:
+.L11:
+	cmpl $6, 4(%rsp)
+	jne .L12
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L13
+.L12:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L13:
+	cmpl $7, 4(%rsp)
+	je .LB3
+.L14:
+.L15:
+	cmpl $8, 4(%rsp)
+	jne .L16
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L17
+.LB0:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+.main_return:
+	addq $8, %rsp
+	ret
+.L16:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L17:
+	cmpl $9, 4(%rsp)
+	je .LB4
+.L18:
+.L19:
+	cmpl $10, 4(%rsp)
+	jne .L20
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L21
+.L20:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L21:
+	cmpl $11, 4(%rsp)
+	je .LB5
+.L22:
+.L23:
+	cmpl $12, 4(%rsp)
+	jne .L24
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L25
+.L24:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L25:
+	cmpl $13, 4(%rsp)
+	je .LB6
+.L26:
+.L27:
+	cmpl $14, 4(%rsp)
+	jne .L28
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L29
+.L28:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L29:
+	cmpl $15, 4(%rsp)
+	je .LB7
+.L30:
+.L31:
+	cmpl $16, 4(%rsp)
+	jne .L32
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L33
+.L32:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L33:
+	cmpl $17, 4(%rsp)
+	je .LB8
+.L34:
+.L35:
+	cmpl $18, 4(%rsp)
+	jne .L36
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L37
+.L36:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L37:
+	cmpl $19, 4(%rsp)
+	je .LB9
+.L38:
+.L39:
+	cmpl $20, 4(%rsp)
+	jne .L40
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L41
+.L40:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L41:
+	cmpl $21, 4(%rsp)
+	je .LB10
+.L42:
+.L43:
+	cmpl $22, 4(%rsp)
+	jne .L44
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L45
+.L44:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L45:
+	cmpl $23, 4(%rsp)
+	je .LB11
+.L46:
+.L47:
+	cmpl $24, 4(%rsp)
+	jne .L48
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L49
+.L48:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L49:
+	cmpl $25, 4(%rsp)
+	je .LB12
+.L50:
+.L51:
+	cmpl $26, 4(%rsp)
+	jne .L52
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L53
+.L52:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L53:
+	cmpl $27, 4(%rsp)
+	je .LB13
+.L54:
+.L55:
+	cmpl $28, 4(%rsp)
+	jne .L56
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L57
+.L56:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L57:
+	cmpl $29, 4(%rsp)
+	je .LB14
+.L58:
+.L59:
+	cmpl $30, 4(%rsp)
+	jne .L60
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L61
+.L60:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L61:
+	cmpl $31, 4(%rsp)
+	je .LB15
+.L62:
+.L63:
+	cmpl $32, 4(%rsp)
+	jne .L64
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L65
+.L64:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L65:
+	cmpl $33, 4(%rsp)
+	je .LB16
+.L66:
+.L67:
+	cmpl $34, 4(%rsp)
+	jne .L68
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L69
+.L68:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L69:
+	cmpl $35, 4(%rsp)
+	je .LB17
+.L70:
+.L71:
+	cmpl $36, 4(%rsp)
+	jne .L72
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L73
+.L72:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L73:
+	cmpl $37, 4(%rsp)
+	je .LB18
+.L74:
+.L75:
+	cmpl $38, 4(%rsp)
+	jne .L76
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L77
+.L76:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L77:
+	cmpl $39, 4(%rsp)
+	je .LB19
+.L78:
+.L79:
+	cmpl $40, 4(%rsp)
+	jne .L80
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L81
+.L80:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L81:
+	cmpl $41, 4(%rsp)
+	je .LB20
+.L82:
+.L83:
+	cmpl $42, 4(%rsp)
+	jne .L84
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L85
+.L84:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L85:
+	cmpl $43, 4(%rsp)
+	je .LB21
+.L86:
+.L87:
+	cmpl $44, 4(%rsp)
+	jne .L88
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L89
+.L88:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L89:
+	cmpl $45, 4(%rsp)
+	je .LB22
+.L90:
+.L91:
+	cmpl $46, 4(%rsp)
+	jne .L92
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L93
+.L92:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L93:
+	cmpl $47, 4(%rsp)
+	je .LB23
+.L94:
+.L95:
+	cmpl $48, 4(%rsp)
+	jne .L96
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L97
+.L96:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L97:
+	cmpl $49, 4(%rsp)
+	je .LB24
+.L98:
+.L99:
+	cmpl $50, 4(%rsp)
+	jne .L100
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L101
+.L100:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L101:
+	cmpl $51, 4(%rsp)
+	je .LB25
+.L102:
+.L103:
+	cmpl $52, 4(%rsp)
+	jne .L104
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L105
+.L104:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L105:
+	cmpl $53, 4(%rsp)
+	je .LB26
+.L106:
+.L107:
+	cmpl $54, 4(%rsp)
+	jne .L108
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L109
+.L108:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L109:
+	cmpl $55, 4(%rsp)
+	je .LB27
+.L110:
+.L111:
+	cmpl $56, 4(%rsp)
+	jne .L112
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L113
+.L112:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L113:
+	cmpl $57, 4(%rsp)
+	je .LB28
+.L114:
+.L115:
+	cmpl $58, 4(%rsp)
+	jne .L116
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L117
+.L116:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L117:
+	cmpl $59, 4(%rsp)
+	je .LB29
+.L118:
+.L119:
+	cmpl $60, 4(%rsp)
+	jne .L120
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L121
+.L120:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L121:
+	cmpl $61, 4(%rsp)
+	je .LB30
+.L122:
+.L123:
+	cmpl $62, 4(%rsp)
+	jne .L124
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L125
+.L124:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L125:
+	cmpl $63, 4(%rsp)
+	je .LB31
+.L126:
+.L127:
+	cmpl $64, 4(%rsp)
+	jne .L128
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L129
+.L128:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L129:
+	cmpl $65, 4(%rsp)
+	je .LB32
+.L130:
+.L131:
+	cmpl $66, 4(%rsp)
+	jne .L132
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L133
+.L132:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L133:
+	cmpl $67, 4(%rsp)
+	je .LB33
+.L134:
+.L135:
+	cmpl $68, 4(%rsp)
+	jne .L136
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L137
+.L136:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L137:
+	cmpl $69, 4(%rsp)
+	je .LB34
+.L138:
+.L139:
+	cmpl $70, 4(%rsp)
+	jne .L140
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L141
+.L140:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L141:
+	cmpl $71, 4(%rsp)
+	je .LB35
+.L142:
+.L143:
+	cmpl $72, 4(%rsp)
+	jne .L144
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L145
+.L144:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L145:
+	cmpl $73, 4(%rsp)
+	je .LB36
+.L146:
+.L147:
+	cmpl $74, 4(%rsp)
+	jne .L148
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L149
+.L148:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L149:
+	cmpl $75, 4(%rsp)
+	je .LB37
+.L150:
+.L151:
+	cmpl $76, 4(%rsp)
+	jne .L152
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L153
+.L152:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L153:
+	cmpl $77, 4(%rsp)
+	je .LB38
+.L154:
+.L155:
+	cmpl $78, 4(%rsp)
+	jne .L156
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L157
+.L156:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L157:
+	cmpl $79, 4(%rsp)
+	je .LB39
+.L158:
+.L159:
+	cmpl $80, 4(%rsp)
+	jne .L160
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L161
+.L160:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L161:
+	cmpl $81, 4(%rsp)
+	je .LB40
+.L162:
+.L163:
+	cmpl $82, 4(%rsp)
+	jne .L164
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L165
+.L164:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L165:
+	cmpl $83, 4(%rsp)
+	je .LB41
+.L166:
+.L167:
+	cmpl $84, 4(%rsp)
+	jne .L168
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L169
+.L168:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L169:
+	cmpl $85, 4(%rsp)
+	je .LB42
+.L170:
+.L171:
+	cmpl $86, 4(%rsp)
+	jne .L172
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L173
+.L172:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L173:
+	cmpl $87, 4(%rsp)
+	je .LB43
+.L174:
+.L175:
+	cmpl $88, 4(%rsp)
+	jne .L176
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L177
+.L176:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L177:
+	cmpl $89, 4(%rsp)
+	je .LB44
+.L178:
+.L179:
+	cmpl $90, 4(%rsp)
+	jne .L180
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L181
+.L180:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L181:
+	cmpl $91, 4(%rsp)
+	je .LB45
+.L182:
+.L183:
+	cmpl $92, 4(%rsp)
+	jne .L184
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L185
+.L184:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L185:
+	cmpl $93, 4(%rsp)
+	je .LB46
+.L186:
+.L187:
+	cmpl $94, 4(%rsp)
+	jne .L188
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L189
+.L188:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L189:
+	cmpl $95, 4(%rsp)
+	je .LB47
+.L190:
+.L191:
+	cmpl $96, 4(%rsp)
+	jne .L192
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L193
+.L192:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L193:
+	cmpl $97, 4(%rsp)
+	je .LB48
+.L194:
+.L195:
+	cmpl $98, 4(%rsp)
+	jne .L196
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L197
+.L196:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L197:
+	cmpl $99, 4(%rsp)
+	je .LB49
+.L198:
+.L199:
+	cmpl $100, 4(%rsp)
+	jne .L200
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L201
+.L200:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L201:
+	cmpl $101, 4(%rsp)
+	je .LB50
+.L202:
+.L203:
+	cmpl $102, 4(%rsp)
+	jne .L204
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L205
+.L204:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L205:
+	cmpl $103, 4(%rsp)
+	je .LB51
+.L206:
+.L207:
+	cmpl $104, 4(%rsp)
+	jne .L208
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L209
+.L208:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L209:
+	cmpl $105, 4(%rsp)
+	je .LB52
+.L210:
+.L211:
+	cmpl $106, 4(%rsp)
+	jne .L212
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L213
+.L212:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L213:
+	cmpl $107, 4(%rsp)
+	je .LB53
+.L214:
+.L215:
+	cmpl $108, 4(%rsp)
+	jne .L216
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L217
+.L216:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L217:
+	cmpl $109, 4(%rsp)
+	je .LB54
+.L218:
+.L219:
+	cmpl $110, 4(%rsp)
+	jne .L220
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L221
+.L220:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L221:
+	cmpl $111, 4(%rsp)
+	je .LB55
+.L222:
+.L223:
+	cmpl $112, 4(%rsp)
+	jne .L224
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L225
+.L224:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L225:
+	cmpl $113, 4(%rsp)
+	je .LB56
+.L226:
+.L227:
+	cmpl $114, 4(%rsp)
+	jne .L228
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L229
+.L228:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L229:
+	cmpl $115, 4(%rsp)
+	je .LB57
+.L230:
+.L231:
+	cmpl $116, 4(%rsp)
+	jne .L232
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L233
+.L232:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L233:
+	cmpl $117, 4(%rsp)
+	je .LB58
+.L234:
+.L235:
+	cmpl $118, 4(%rsp)
+	jne .L236
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L237
+.L236:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L237:
+	cmpl $119, 4(%rsp)
+	je .LB59
+.L238:
+.L239:
+	cmpl $120, 4(%rsp)
+	jne .L240
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L241
+.L240:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L241:
+	cmpl $121, 4(%rsp)
+	je .LB60
+.L242:
+.L243:
+	cmpl $122, 4(%rsp)
+	jne .L244
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L245
+.L244:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L245:
+	cmpl $123, 4(%rsp)
+	je .LB61
+.L246:
+.L247:
+	cmpl $124, 4(%rsp)
+	jne .L248
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L249
+.L248:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L249:
+	cmpl $125, 4(%rsp)
+	je .LB62
+.L250:
+.L251:
+	cmpl $126, 4(%rsp)
+	jne .L252
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L253
+.L252:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L253:
+	cmpl $127, 4(%rsp)
+	je .LB63
+.L254:
+.L255:
+	cmpl $128, 4(%rsp)
+	jne .L256
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L257
+.L256:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L257:
+	cmpl $129, 4(%rsp)
+	je .LB64
+.L258:
+.L259:
+	cmpl $130, 4(%rsp)
+	jne .L260
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L261
+.L260:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L261:
+	cmpl $131, 4(%rsp)
+	je .LB65
+.L262:
+.L263:
+	cmpl $132, 4(%rsp)
+	jne .L264
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L265
+.L264:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L265:
+	cmpl $133, 4(%rsp)
+	je .LB66
+.L266:
+.L267:
+	cmpl $134, 4(%rsp)
+	jne .L268
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L269
+.L268:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L269:
+	cmpl $135, 4(%rsp)
+	je .LB67
+.L270:
+.L271:
+	cmpl $136, 4(%rsp)
+	jne .L272
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L273
+.L272:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L273:
+	cmpl $137, 4(%rsp)
+	je .LB68
+.L274:
+.L275:
+	cmpl $138, 4(%rsp)
+	jne .L276
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L277
+.L276:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L277:
+	cmpl $139, 4(%rsp)
+	je .LB69
+.L278:
+.L279:
+	cmpl $140, 4(%rsp)
+	jne .L280
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L281
+.L280:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L281:
+	cmpl $141, 4(%rsp)
+	je .LB70
+.L282:
+.L283:
+	cmpl $142, 4(%rsp)
+	jne .L284
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L285
+.L284:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L285:
+	cmpl $143, 4(%rsp)
+	je .LB71
+.L286:
+.L287:
+	cmpl $144, 4(%rsp)
+	jne .L288
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L289
+.L288:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L289:
+	cmpl $145, 4(%rsp)
+	je .LB72
+.L290:
+.L291:
+	cmpl $146, 4(%rsp)
+	jne .L292
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L293
+.L292:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L293:
+	cmpl $147, 4(%rsp)
+	je .LB73
+.L294:
+.L295:
+	cmpl $148, 4(%rsp)
+	jne .L296
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L297
+.L296:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L297:
+	cmpl $149, 4(%rsp)
+	je .LB74
+.L298:
+.L299:
+	cmpl $150, 4(%rsp)
+	jne .L300
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L301
+.L300:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L301:
+	cmpl $151, 4(%rsp)
+	je .LB75
+.L302:
+.L303:
+	cmpl $152, 4(%rsp)
+	jne .L304
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L305
+.L304:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L305:
+	cmpl $153, 4(%rsp)
+	je .LB76
+.L306:
+.L307:
+	cmpl $154, 4(%rsp)
+	jne .L308
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L309
+.L308:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L309:
+	cmpl $155, 4(%rsp)
+	je .LB77
+.L310:
+.L311:
+	cmpl $156, 4(%rsp)
+	jne .L312
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L313
+.L312:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L313:
+	cmpl $157, 4(%rsp)
+	je .LB78
+.L314:
+.L315:
+	cmpl $158, 4(%rsp)
+	jne .L316
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L317
+.L316:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L317:
+	cmpl $159, 4(%rsp)
+	je .LB79
+.L318:
+.L319:
+	cmpl $160, 4(%rsp)
+	jne .L320
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L321
+.L320:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L321:
+	cmpl $161, 4(%rsp)
+	je .LB80
+.L322:
+.L323:
+	cmpl $162, 4(%rsp)
+	jne .L324
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L325
+.L324:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L325:
+	cmpl $163, 4(%rsp)
+	je .LB81
+.L326:
+.L327:
+	cmpl $164, 4(%rsp)
+	jne .L328
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L329
+.L328:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L329:
+	cmpl $165, 4(%rsp)
+	je .LB82
+.L330:
+.L331:
+	cmpl $166, 4(%rsp)
+	jne .L332
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L333
+.L332:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L333:
+	cmpl $167, 4(%rsp)
+	je .LB83
+.L334:
+.L335:
+	cmpl $168, 4(%rsp)
+	jne .L336
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L337
+.L336:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L337:
+	cmpl $169, 4(%rsp)
+	je .LB84
+.L338:
+.L339:
+	cmpl $170, 4(%rsp)
+	jne .L340
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L341
+.L340:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L341:
+	cmpl $171, 4(%rsp)
+	je .LB85
+.L342:
+.L343:
+	cmpl $172, 4(%rsp)
+	jne .L344
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L345
+.L344:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L345:
+	cmpl $173, 4(%rsp)
+	je .LB86
+.L346:
+.L347:
+	cmpl $174, 4(%rsp)
+	jne .L348
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L349
+.L348:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L349:
+	cmpl $175, 4(%rsp)
+	je .LB87
+.L350:
+.L351:
+	cmpl $176, 4(%rsp)
+	jne .L352
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L353
+.L352:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L353:
+	cmpl $177, 4(%rsp)
+	je .LB88
+.L354:
+.L355:
+	cmpl $178, 4(%rsp)
+	jne .L356
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L357
+.L356:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L357:
+	cmpl $179, 4(%rsp)
+	je .LB89
+.L358:
+.L359:
+	cmpl $180, 4(%rsp)
+	jne .L360
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L361
+.L360:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L361:
+	cmpl $181, 4(%rsp)
+	je .LB90
+.L362:
+.L363:
+	cmpl $182, 4(%rsp)
+	jne .L364
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L365
+.L364:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L365:
+	cmpl $183, 4(%rsp)
+	je .LB91
+.L366:
+.L367:
+	cmpl $184, 4(%rsp)
+	jne .L368
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L369
+.L368:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L369:
+	cmpl $185, 4(%rsp)
+	je .LB92
+.L370:
+.L371:
+	cmpl $186, 4(%rsp)
+	jne .L372
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L373
+.L372:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L373:
+	cmpl $187, 4(%rsp)
+	je .LB93
+.L374:
+.L375:
+	cmpl $188, 4(%rsp)
+	jne .L376
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L377
+.L376:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L377:
+	cmpl $189, 4(%rsp)
+	je .LB94
+.L378:
+.L379:
+	cmpl $190, 4(%rsp)
+	jne .L380
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L381
+.L380:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L381:
+	cmpl $191, 4(%rsp)
+	je .LB95
+.L382:
+.L383:
+	cmpl $192, 4(%rsp)
+	jne .L384
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L385
+.L384:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L385:
+	cmpl $193, 4(%rsp)
+	je .LB96
+.L386:
+.L387:
+	cmpl $194, 4(%rsp)
+	jne .L388
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L389
+.L388:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L389:
+	cmpl $195, 4(%rsp)
+	je .LB97
+.L390:
+.L391:
+	cmpl $196, 4(%rsp)
+	jne .L392
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L393
+.L392:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L393:
+	cmpl $197, 4(%rsp)
+	je .LB98
+.L394:
+.L395:
+	cmpl $198, 4(%rsp)
+	jne .L396
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L397
+.L396:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L397:
+	cmpl $199, 4(%rsp)
+	je .LB99
+.L398:
+.L399:
+	cmpl $200, 4(%rsp)
+	jne .L400
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L401
+.L400:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L401:
+	cmpl $201, 4(%rsp)
+	je .LB100
+.L402:
+.L403:
+	cmpl $202, 4(%rsp)
+	jne .L404
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L405
+.L404:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L405:
+	cmpl $203, 4(%rsp)
+	je .LB101
+.L406:
+.L407:
+	cmpl $204, 4(%rsp)
+	jne .L408
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L409
+.L408:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L409:
+	cmpl $205, 4(%rsp)
+	je .LB102
+.L410:
+.L411:
+	cmpl $206, 4(%rsp)
+	jne .L412
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L413
+.L412:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L413:
+	cmpl $207, 4(%rsp)
+	je .LB103
+.L414:
+.L415:
+	cmpl $208, 4(%rsp)
+	jne .L416
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L417
+.L416:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L417:
+	cmpl $209, 4(%rsp)
+	je .LB104
+.L418:
+.L419:
+	cmpl $210, 4(%rsp)
+	jne .L420
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L421
+.L420:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L421:
+	cmpl $211, 4(%rsp)
+	je .LB105
+.L422:
+.L423:
+	cmpl $212, 4(%rsp)
+	jne .L424
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L425
+.L424:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L425:
+	cmpl $213, 4(%rsp)
+	je .LB106
+.L426:
+.L427:
+	cmpl $214, 4(%rsp)
+	jne .L428
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L429
+.L428:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L429:
+	cmpl $215, 4(%rsp)
+	je .LB107
+.L430:
+.L431:
+	cmpl $216, 4(%rsp)
+	jne .L432
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L433
+.L432:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L433:
+	cmpl $217, 4(%rsp)
+	je .LB108
+.L434:
+.L435:
+	cmpl $218, 4(%rsp)
+	jne .L436
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L437
+.L436:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L437:
+	cmpl $219, 4(%rsp)
+	je .LB109
+.L438:
+.L439:
+	cmpl $220, 4(%rsp)
+	jne .L440
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L441
+.L440:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L441:
+	cmpl $221, 4(%rsp)
+	je .LB110
+.L442:
+.L443:
+	cmpl $222, 4(%rsp)
+	jne .L444
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L445
+.L444:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L445:
+	cmpl $223, 4(%rsp)
+	je .LB111
+.L446:
+.L447:
+	cmpl $224, 4(%rsp)
+	jne .L448
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L449
+.L448:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L449:
+	cmpl $225, 4(%rsp)
+	je .LB112
+.L450:
+.L451:
+	cmpl $226, 4(%rsp)
+	jne .L452
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L453
+.L452:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L453:
+	cmpl $227, 4(%rsp)
+	je .LB113
+.L454:
+.L455:
+	cmpl $228, 4(%rsp)
+	jne .L456
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L457
+.L456:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L457:
+	cmpl $229, 4(%rsp)
+	je .LB114
+.L458:
+.L459:
+	cmpl $230, 4(%rsp)
+	jne .L460
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L461
+.L460:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L461:
+	cmpl $231, 4(%rsp)
+	je .LB115
+.L462:
+.L463:
+	cmpl $232, 4(%rsp)
+	jne .L464
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L465
+.L464:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L465:
+	cmpl $233, 4(%rsp)
+	je .LB116
+.L466:
+.L467:
+	cmpl $234, 4(%rsp)
+	jne .L468
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L469
+.L468:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L469:
+	cmpl $235, 4(%rsp)
+	je .LB117
+.L470:
+.L471:
+	cmpl $236, 4(%rsp)
+	jne .L472
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L473
+.L472:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L473:
+	cmpl $237, 4(%rsp)
+	je .LB118
+.L474:
+.L475:
+	cmpl $238, 4(%rsp)
+	jne .L476
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L477
+.L476:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L477:
+	cmpl $239, 4(%rsp)
+	je .LB119
+.L478:
+.L479:
+	cmpl $240, 4(%rsp)
+	jne .L480
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L481
+.L480:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L481:
+	cmpl $241, 4(%rsp)
+	je .LB120
+.L482:
+.L483:
+	cmpl $242, 4(%rsp)
+	jne .L484
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L485
+.L484:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L485:
+	cmpl $243, 4(%rsp)
+	je .LB121
+.L486:
+.L487:
+	cmpl $244, 4(%rsp)
+	jne .L488
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L489
+.L488:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L489:
+	cmpl $245, 4(%rsp)
+	je .LB122
+.L490:
+.L491:
+	cmpl $246, 4(%rsp)
+	jne .L492
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L493
+.L492:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L493:
+	cmpl $247, 4(%rsp)
+	je .LB123
+.L494:
+.L495:
+	cmpl $248, 4(%rsp)
+	jne .L496
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L497
+.L496:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L497:
+	cmpl $249, 4(%rsp)
+	je .LB124
+.L498:
+.L499:
+	cmpl $250, 4(%rsp)
+	jne .L500
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L501
+.L500:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L501:
+	cmpl $251, 4(%rsp)
+	je .LB125
+.L502:
+.L503:
+	cmpl $252, 4(%rsp)
+	jne .L504
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L505
+.L504:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L505:
+	cmpl $253, 4(%rsp)
+	je .LB126
+.L506:
+.L507:
+	cmpl $254, 4(%rsp)
+	jne .L508
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L509
+.L508:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L509:
+	cmpl $255, 4(%rsp)
+	je .LB127
+.L510:
+.L511:
+	cmpl $256, 4(%rsp)
+	jne .L512
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L513
+.L512:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L513:
+	cmpl $257, 4(%rsp)
+	je .LB128
+.L514:
+.L515:
+	cmpl $258, 4(%rsp)
+	jne .L516
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L517
+.L516:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L517:
+	cmpl $259, 4(%rsp)
+	je .LB129
+.L518:
+.L519:
+	cmpl $260, 4(%rsp)
+	jne .L520
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L521
+.L520:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L521:
+	cmpl $261, 4(%rsp)
+	je .LB130
+.L522:
+.L523:
+	cmpl $262, 4(%rsp)
+	jne .L524
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L525
+.L524:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L525:
+	cmpl $263, 4(%rsp)
+	je .LB131
+.L526:
+.L527:
+	cmpl $264, 4(%rsp)
+	jne .L528
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L529
+.L528:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L529:
+	cmpl $265, 4(%rsp)
+	je .LB132
+.L530:
+.L531:
+	cmpl $266, 4(%rsp)
+	jne .L532
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L533
+.L532:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L533:
+	cmpl $267, 4(%rsp)
+	je .LB133
+.L534:
+.L535:
+	cmpl $268, 4(%rsp)
+	jne .L536
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L537
+.L536:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L537:
+	cmpl $269, 4(%rsp)
+	je .LB134
+.L538:
+.L539:
+	cmpl $270, 4(%rsp)
+	jne .L540
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L541
+.L540:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L541:
+	cmpl $271, 4(%rsp)
+	je .LB135
+.L542:
+.L543:
+	cmpl $272, 4(%rsp)
+	jne .L544
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L545
+.L544:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L545:
+	cmpl $273, 4(%rsp)
+	je .LB136
+.L546:
+.L547:
+	cmpl $274, 4(%rsp)
+	jne .L548
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L549
+.L548:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L549:
+	cmpl $275, 4(%rsp)
+	je .LB137
+.L550:
+.L551:
+	cmpl $276, 4(%rsp)
+	jne .L552
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L553
+.L552:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L553:
+	cmpl $277, 4(%rsp)
+	je .LB138
+.L554:
+.L555:
+	cmpl $278, 4(%rsp)
+	jne .L556
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L557
+.L556:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L557:
+	cmpl $279, 4(%rsp)
+	je .LB139
+.L558:
+.L559:
+	cmpl $280, 4(%rsp)
+	jne .L560
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L561
+.L560:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L561:
+	cmpl $281, 4(%rsp)
+	je .LB140
+.L562:
+.L563:
+	cmpl $282, 4(%rsp)
+	jne .L564
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L565
+.L564:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L565:
+	cmpl $283, 4(%rsp)
+	je .LB141
+.L566:
+.L567:
+	cmpl $284, 4(%rsp)
+	jne .L568
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L569
+.L568:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L569:
+	cmpl $285, 4(%rsp)
+	je .LB142
+.L570:
+.L571:
+	cmpl $286, 4(%rsp)
+	jne .L572
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L573
+.L572:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L573:
+	cmpl $287, 4(%rsp)
+	je .LB143
+.L574:
+.L575:
+	cmpl $288, 4(%rsp)
+	jne .L576
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L577
+.L576:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L577:
+	cmpl $289, 4(%rsp)
+	je .LB144
+.L578:
+.L579:
+	cmpl $290, 4(%rsp)
+	jne .L580
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L581
+.L580:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L581:
+	cmpl $291, 4(%rsp)
+	je .LB145
+.L582:
+.L583:
+	cmpl $292, 4(%rsp)
+	jne .L584
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L585
+.L584:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L585:
+	cmpl $293, 4(%rsp)
+	je .LB146
+.L586:
+.L587:
+	cmpl $294, 4(%rsp)
+	jne .L588
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L589
+.L588:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L589:
+	cmpl $295, 4(%rsp)
+	je .LB147
+.L590:
+.L591:
+	cmpl $296, 4(%rsp)
+	jne .L592
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L593
+.L592:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L593:
+	cmpl $297, 4(%rsp)
+	je .LB148
+.L594:
+.L595:
+	cmpl $298, 4(%rsp)
+	jne .L596
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L597
+.L596:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L597:
+	cmpl $299, 4(%rsp)
+	je .LB149
+.L598:
+.L599:
+	cmpl $300, 4(%rsp)
+	jne .L600
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L601
+.L600:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L601:
+	cmpl $301, 4(%rsp)
+	je .LB150
+.L602:
+.L603:
+	cmpl $302, 4(%rsp)
+	jne .L604
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L605
+.L604:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L605:
+	cmpl $303, 4(%rsp)
+	je .LB151
+.L606:
+.L607:
+	cmpl $304, 4(%rsp)
+	jne .L608
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L609
+.L608:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L609:
+	cmpl $305, 4(%rsp)
+	je .LB152
+.L610:
+.L611:
+	cmpl $306, 4(%rsp)
+	jne .L612
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L613
+.L612:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L613:
+	cmpl $307, 4(%rsp)
+	je .LB153
+.L614:
+.L615:
+	cmpl $308, 4(%rsp)
+	jne .L616
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L617
+.L616:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L617:
+	cmpl $309, 4(%rsp)
+	je .LB154
+.L618:
+.L619:
+	cmpl $310, 4(%rsp)
+	jne .L620
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L621
+.L620:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L621:
+	cmpl $311, 4(%rsp)
+	je .LB155
+.L622:
+.L623:
+	cmpl $312, 4(%rsp)
+	jne .L624
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L625
+.L624:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L625:
+	cmpl $313, 4(%rsp)
+	je .LB156
+.L626:
+.L627:
+	cmpl $314, 4(%rsp)
+	jne .L628
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L629
+.L628:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L629:
+	cmpl $315, 4(%rsp)
+	je .LB157
+.L630:
+.L631:
+	cmpl $316, 4(%rsp)
+	jne .L632
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L633
+.L632:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L633:
+	cmpl $317, 4(%rsp)
+	je .LB158
+.L634:
+.L635:
+	cmpl $318, 4(%rsp)
+	jne .L636
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L637
+.L636:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L637:
+	cmpl $319, 4(%rsp)
+	je .LB159
+.L638:
+.L639:
+	cmpl $320, 4(%rsp)
+	jne .L640
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L641
+.L640:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L641:
+	cmpl $321, 4(%rsp)
+	je .LB160
+.L642:
+.L643:
+	cmpl $322, 4(%rsp)
+	jne .L644
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L645
+.L644:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L645:
+	cmpl $323, 4(%rsp)
+	je .LB161
+.L646:
+.L647:
+	cmpl $324, 4(%rsp)
+	jne .L648
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L649
+.L648:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L649:
+	cmpl $325, 4(%rsp)
+	je .LB162
+.L650:
+.L651:
+	cmpl $326, 4(%rsp)
+	jne .L652
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L653
+.L652:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L653:
+	cmpl $327, 4(%rsp)
+	je .LB163
+.L654:
+.L655:
+	cmpl $328, 4(%rsp)
+	jne .L656
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L657
+.L656:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L657:
+	cmpl $329, 4(%rsp)
+	je .LB164
+.L658:
+.L659:
+	cmpl $330, 4(%rsp)
+	jne .L660
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L661
+.L660:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L661:
+	cmpl $331, 4(%rsp)
+	je .LB165
+.L662:
+.L663:
+	cmpl $332, 4(%rsp)
+	jne .L664
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L665
+.L664:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L665:
+	cmpl $333, 4(%rsp)
+	je .LB166
+.L666:
+.L667:
+	cmpl $334, 4(%rsp)
+	jne .L668
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L669
+.L668:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L669:
+	cmpl $335, 4(%rsp)
+	je .LB167
+.L670:
+.L671:
+	cmpl $336, 4(%rsp)
+	jne .L672
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L673
+.L672:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L673:
+	cmpl $337, 4(%rsp)
+	je .LB168
+.L674:
+.L675:
+	cmpl $338, 4(%rsp)
+	jne .L676
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L677
+.L676:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L677:
+	cmpl $339, 4(%rsp)
+	je .LB169
+.L678:
+.L679:
+	cmpl $340, 4(%rsp)
+	jne .L680
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L681
+.L680:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L681:
+	cmpl $341, 4(%rsp)
+	je .LB170
+.L682:
+.L683:
+	cmpl $342, 4(%rsp)
+	jne .L684
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L685
+.L684:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L685:
+	cmpl $343, 4(%rsp)
+	je .LB171
+.L686:
+.L687:
+	cmpl $344, 4(%rsp)
+	jne .L688
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L689
+.L688:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L689:
+	cmpl $345, 4(%rsp)
+	je .LB172
+.L690:
+.L691:
+	cmpl $346, 4(%rsp)
+	jne .L692
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L693
+.L692:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L693:
+	cmpl $347, 4(%rsp)
+	je .LB173
+.L694:
+.L695:
+	cmpl $348, 4(%rsp)
+	jne .L696
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L697
+.L696:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L697:
+	cmpl $349, 4(%rsp)
+	je .LB174
+.L698:
+.L699:
+	cmpl $350, 4(%rsp)
+	jne .L700
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L701
+.L700:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L701:
+	cmpl $351, 4(%rsp)
+	je .LB175
+.L702:
+.L703:
+	cmpl $352, 4(%rsp)
+	jne .L704
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L705
+.L704:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L705:
+	cmpl $353, 4(%rsp)
+	je .LB176
+.L706:
+.L707:
+	cmpl $354, 4(%rsp)
+	jne .L708
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L709
+.L708:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L709:
+	cmpl $355, 4(%rsp)
+	je .LB177
+.L710:
+.L711:
+	cmpl $356, 4(%rsp)
+	jne .L712
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L713
+.L712:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L713:
+	cmpl $357, 4(%rsp)
+	je .LB178
+.L714:
+.L715:
+	cmpl $358, 4(%rsp)
+	jne .L716
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L717
+.L716:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L717:
+	cmpl $359, 4(%rsp)
+	je .LB179
+.L718:
+.L719:
+	cmpl $360, 4(%rsp)
+	jne .L720
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L721
+.L720:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L721:
+	cmpl $361, 4(%rsp)
+	je .LB180
+.L722:
+.L723:
+	cmpl $362, 4(%rsp)
+	jne .L724
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L725
+.L724:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L725:
+	cmpl $363, 4(%rsp)
+	je .LB181
+.L726:
+.L727:
+	cmpl $364, 4(%rsp)
+	jne .L728
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L729
+.L728:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L729:
+	cmpl $365, 4(%rsp)
+	je .LB182
+.L730:
+.L731:
+	cmpl $366, 4(%rsp)
+	jne .L732
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L733
+.L732:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L733:
+	cmpl $367, 4(%rsp)
+	je .LB183
+.L734:
+.L735:
+	cmpl $368, 4(%rsp)
+	jne .L736
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L737
+.L736:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L737:
+	cmpl $369, 4(%rsp)
+	je .LB184
+.L738:
+.L739:
+	cmpl $370, 4(%rsp)
+	jne .L740
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L741
+.L740:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L741:
+	cmpl $371, 4(%rsp)
+	je .LB185
+.L742:
+.L743:
+	cmpl $372, 4(%rsp)
+	jne .L744
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L745
+.L744:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L745:
+	cmpl $373, 4(%rsp)
+	je .LB186
+.L746:
+.L747:
+	cmpl $374, 4(%rsp)
+	jne .L748
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L749
+.L748:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L749:
+	cmpl $375, 4(%rsp)
+	je .LB187
+.L750:
+.L751:
+	cmpl $376, 4(%rsp)
+	jne .L752
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L753
+.L752:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L753:
+	cmpl $377, 4(%rsp)
+	je .LB188
+.L754:
+.L755:
+	cmpl $378, 4(%rsp)
+	jne .L756
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L757
+.L756:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L757:
+	cmpl $379, 4(%rsp)
+	je .LB189
+.L758:
+.L759:
+	cmpl $380, 4(%rsp)
+	jne .L760
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L761
+.L760:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L761:
+	cmpl $381, 4(%rsp)
+	je .LB190
+.L762:
+.L763:
+	cmpl $382, 4(%rsp)
+	jne .L764
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L765
+.L764:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L765:
+	cmpl $383, 4(%rsp)
+	je .LB191
+.L766:
+.L767:
+	cmpl $384, 4(%rsp)
+	jne .L768
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L769
+.L768:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L769:
+	cmpl $385, 4(%rsp)
+	je .LB192
+.L770:
+.L771:
+	cmpl $386, 4(%rsp)
+	jne .L772
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L773
+.L772:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L773:
+	cmpl $387, 4(%rsp)
+	je .LB193
+.L774:
+.L775:
+	cmpl $388, 4(%rsp)
+	jne .L776
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L777
+.L776:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L777:
+	cmpl $389, 4(%rsp)
+	je .LB194
+.L778:
+.L779:
+	cmpl $390, 4(%rsp)
+	jne .L780
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L781
+.L780:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L781:
+	cmpl $391, 4(%rsp)
+	je .LB195
+.L782:
+.L783:
+	cmpl $392, 4(%rsp)
+	jne .L784
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L785
+.L784:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L785:
+	cmpl $393, 4(%rsp)
+	je .LB196
+.L786:
+.L787:
+	cmpl $394, 4(%rsp)
+	jne .L788
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L789
+.L788:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L789:
+	cmpl $395, 4(%rsp)
+	je .LB197
+.L790:
+.L791:
+	cmpl $396, 4(%rsp)
+	jne .L792
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L793
+.L792:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L793:
+	cmpl $397, 4(%rsp)
+	je .LB198
+.L794:
+.L795:
+	cmpl $398, 4(%rsp)
+	jne .L796
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L797
+.L796:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L797:
+	cmpl $399, 4(%rsp)
+	je .LB199
+.L798:
+.L799:
+	cmpl $400, 4(%rsp)
+	jne .L800
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L801
+.L800:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L801:
+	cmpl $401, 4(%rsp)
+	je .LB200
+.L802:
+.L803:
+	cmpl $402, 4(%rsp)
+	jne .L804
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L805
+.L804:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L805:
+	cmpl $403, 4(%rsp)
+	je .LB201
+.L806:
+.L807:
+	cmpl $404, 4(%rsp)
+	jne .L808
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L809
+.L808:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L809:
+	cmpl $405, 4(%rsp)
+	je .LB202
+.L810:
+.L811:
+	cmpl $406, 4(%rsp)
+	jne .L812
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L813
+.L812:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L813:
+	cmpl $407, 4(%rsp)
+	je .LB203
+.L814:
+.L815:
+	cmpl $408, 4(%rsp)
+	jne .L816
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L817
+.L816:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L817:
+	cmpl $409, 4(%rsp)
+	je .LB204
+.L818:
+.L819:
+	cmpl $410, 4(%rsp)
+	jne .L820
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L821
+.L820:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L821:
+	cmpl $411, 4(%rsp)
+	je .LB205
+.L822:
+.L823:
+	cmpl $412, 4(%rsp)
+	jne .L824
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L825
+.L824:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L825:
+	cmpl $413, 4(%rsp)
+	je .LB206
+.L826:
+.L827:
+	cmpl $414, 4(%rsp)
+	jne .L828
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L829
+.L828:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L829:
+	cmpl $415, 4(%rsp)
+	je .LB207
+.L830:
+.L831:
+	cmpl $416, 4(%rsp)
+	jne .L832
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L833
+.L832:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L833:
+	cmpl $417, 4(%rsp)
+	je .LB208
+.L834:
+.L835:
+	cmpl $418, 4(%rsp)
+	jne .L836
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L837
+.L836:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L837:
+	cmpl $419, 4(%rsp)
+	je .LB209
+.L838:
+.L839:
+	cmpl $420, 4(%rsp)
+	jne .L840
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L841
+.L840:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L841:
+	cmpl $421, 4(%rsp)
+	je .LB210
+.L842:
+.L843:
+	cmpl $422, 4(%rsp)
+	jne .L844
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L845
+.L844:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L845:
+	cmpl $423, 4(%rsp)
+	je .LB211
+.L846:
+.L847:
+	cmpl $424, 4(%rsp)
+	jne .L848
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L849
+.L848:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L849:
+	cmpl $425, 4(%rsp)
+	je .LB212
+.L850:
+.L851:
+	cmpl $426, 4(%rsp)
+	jne .L852
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L853
+.L852:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L853:
+	cmpl $427, 4(%rsp)
+	je .LB213
+.L854:
+.L855:
+	cmpl $428, 4(%rsp)
+	jne .L856
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L857
+.L856:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L857:
+	cmpl $429, 4(%rsp)
+	je .LB214
+.L858:
+.L859:
+	cmpl $430, 4(%rsp)
+	jne .L860
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L861
+.L860:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L861:
+	cmpl $431, 4(%rsp)
+	je .LB215
+.L862:
+.L863:
+	cmpl $432, 4(%rsp)
+	jne .L864
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L865
+.L864:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L865:
+	cmpl $433, 4(%rsp)
+	je .LB216
+.L866:
+.L867:
+	cmpl $434, 4(%rsp)
+	jne .L868
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L869
+.L868:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L869:
+	cmpl $435, 4(%rsp)
+	je .LB217
+.L870:
+.L871:
+	cmpl $436, 4(%rsp)
+	jne .L872
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L873
+.L872:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L873:
+	cmpl $437, 4(%rsp)
+	je .LB218
+.L874:
+.L875:
+	cmpl $438, 4(%rsp)
+	jne .L876
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L877
+.L876:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L877:
+	cmpl $439, 4(%rsp)
+	je .LB219
+.L878:
+.L879:
+	cmpl $440, 4(%rsp)
+	jne .L880
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L881
+.L880:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L881:
+	cmpl $441, 4(%rsp)
+	je .LB220
+.L882:
+.L883:
+	cmpl $442, 4(%rsp)
+	jne .L884
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L885
+.L884:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L885:
+	cmpl $443, 4(%rsp)
+	je .LB221
+.L886:
+.L887:
+	cmpl $444, 4(%rsp)
+	jne .L888
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L889
+.L888:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L889:
+	cmpl $445, 4(%rsp)
+	je .LB222
+.L890:
+.L891:
+	cmpl $446, 4(%rsp)
+	jne .L892
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L893
+.L892:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L893:
+	cmpl $447, 4(%rsp)
+	je .LB223
+.L894:
+.L895:
+	cmpl $448, 4(%rsp)
+	jne .L896
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L897
+.L896:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L897:
+	cmpl $449, 4(%rsp)
+	je .LB224
+.L898:
+.L899:
+	cmpl $450, 4(%rsp)
+	jne .L900
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L901
+.L900:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L901:
+	cmpl $451, 4(%rsp)
+	je .LB225
+.L902:
+.L903:
+	cmpl $452, 4(%rsp)
+	jne .L904
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L905
+.L904:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L905:
+	cmpl $453, 4(%rsp)
+	je .LB226
+.L906:
+.L907:
+	cmpl $454, 4(%rsp)
+	jne .L908
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L909
+.L908:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L909:
+	cmpl $455, 4(%rsp)
+	je .LB227
+.L910:
+.L911:
+	cmpl $456, 4(%rsp)
+	jne .L912
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L913
+.L912:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L913:
+	cmpl $457, 4(%rsp)
+	je .LB228
+.L914:
+.L915:
+	cmpl $458, 4(%rsp)
+	jne .L916
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L917
+.L916:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L917:
+	cmpl $459, 4(%rsp)
+	je .LB229
+.L918:
+.L919:
+	cmpl $460, 4(%rsp)
+	jne .L920
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L921
+.L920:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L921:
+	cmpl $461, 4(%rsp)
+	je .LB230
+.L922:
+.L923:
+	cmpl $462, 4(%rsp)
+	jne .L924
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L925
+.L924:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L925:
+	cmpl $463, 4(%rsp)
+	je .LB231
+.L926:
+.L927:
+	cmpl $464, 4(%rsp)
+	jne .L928
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L929
+.L928:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L929:
+	cmpl $465, 4(%rsp)
+	je .LB232
+.L930:
+.L931:
+	cmpl $466, 4(%rsp)
+	jne .L932
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L933
+.L932:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L933:
+	cmpl $467, 4(%rsp)
+	je .LB233
+.L934:
+.L935:
+	cmpl $468, 4(%rsp)
+	jne .L936
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L937
+.L936:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L937:
+	cmpl $469, 4(%rsp)
+	je .LB234
+.L938:
+.L939:
+	cmpl $470, 4(%rsp)
+	jne .L940
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L941
+.L940:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L941:
+	cmpl $471, 4(%rsp)
+	je .LB235
+.L942:
+.L943:
+	cmpl $472, 4(%rsp)
+	jne .L944
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L945
+.L944:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L945:
+	cmpl $473, 4(%rsp)
+	je .LB236
+.L946:
+.L947:
+	cmpl $474, 4(%rsp)
+	jne .L948
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L949
+.L948:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L949:
+	cmpl $475, 4(%rsp)
+	je .LB237
+.L950:
+.L951:
+	cmpl $476, 4(%rsp)
+	jne .L952
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L953
+.L952:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L953:
+	cmpl $477, 4(%rsp)
+	je .LB238
+.L954:
+.L955:
+	cmpl $478, 4(%rsp)
+	jne .L956
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L957
+.L956:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L957:
+	cmpl $479, 4(%rsp)
+	je .LB239
+.L958:
+.L959:
+	cmpl $480, 4(%rsp)
+	jne .L960
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L961
+.L960:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L961:
+	cmpl $481, 4(%rsp)
+	je .LB240
+.L962:
+.L963:
+	cmpl $482, 4(%rsp)
+	jne .L964
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L965
+.L964:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L965:
+	cmpl $483, 4(%rsp)
+	je .LB241
+.L966:
+.L967:
+	cmpl $484, 4(%rsp)
+	jne .L968
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L969
+.L968:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L969:
+	cmpl $485, 4(%rsp)
+	je .LB242
+.L970:
+.L971:
+	cmpl $486, 4(%rsp)
+	jne .L972
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L973
+.L972:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L973:
+	cmpl $487, 4(%rsp)
+	je .LB243
+.L974:
+.L975:
+	cmpl $488, 4(%rsp)
+	jne .L976
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L977
+.L976:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L977:
+	cmpl $489, 4(%rsp)
+	je .LB244
+.L978:
+.L979:
+	cmpl $490, 4(%rsp)
+	jne .L980
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L981
+.L980:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L981:
+	cmpl $491, 4(%rsp)
+	je .LB245
+.L982:
+.L983:
+	cmpl $492, 4(%rsp)
+	jne .L984
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L985
+.L984:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L985:
+	cmpl $493, 4(%rsp)
+	je .LB246
+.L986:
+.L987:
+	cmpl $494, 4(%rsp)
+	jne .L988
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L989
+.L988:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L989:
+	cmpl $495, 4(%rsp)
+	je .LB247
+.L990:
+.L991:
+	cmpl $496, 4(%rsp)
+	jne .L992
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L993
+.L992:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L993:
+	cmpl $497, 4(%rsp)
+	je .LB248
+.L994:
+.L995:
+	cmpl $498, 4(%rsp)
+	jne .L996
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L997
+.L996:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L997:
+	cmpl $499, 4(%rsp)
+	je .LB249
+.L998:
+.L999:
+	cmpl $500, 4(%rsp)
+	jne .L1000
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1001
+.L1000:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1001:
+	cmpl $501, 4(%rsp)
+	je .LB250
+.L1002:
+.L1003:
+	cmpl $502, 4(%rsp)
+	jne .L1004
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1005
+.L1004:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1005:
+	cmpl $503, 4(%rsp)
+	je .LB251
+.L1006:
+.L1007:
+	cmpl $504, 4(%rsp)
+	jne .L1008
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1009
+.L1008:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1009:
+	cmpl $505, 4(%rsp)
+	je .LB252
+.L1010:
+.L1011:
+	cmpl $506, 4(%rsp)
+	jne .L1012
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1013
+.L1012:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1013:
+	cmpl $507, 4(%rsp)
+	je .LB253
+.L1014:
+.L1015:
+	cmpl $508, 4(%rsp)
+	jne .L1016
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1017
+.L1016:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1017:
+	cmpl $509, 4(%rsp)
+	je .LB254
+.L1018:
+.L1019:
+	cmpl $510, 4(%rsp)
+	jne .L1020
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1021
+.L1020:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1021:
+	cmpl $511, 4(%rsp)
+	je .LB255
+.L1022:
+.L1023:
+	cmpl $512, 4(%rsp)
+	jne .L1024
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1025
+.L1024:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1025:
+	cmpl $513, 4(%rsp)
+	je .LB256
+.L1026:
+.L1027:
+	cmpl $514, 4(%rsp)
+	jne .L1028
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1029
+.L1028:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1029:
+	cmpl $515, 4(%rsp)
+	je .LB257
+.L1030:
+.L1031:
+	cmpl $516, 4(%rsp)
+	jne .L1032
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1033
+.L1032:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1033:
+	cmpl $517, 4(%rsp)
+	je .LB258
+.L1034:
+.L1035:
+	cmpl $518, 4(%rsp)
+	jne .L1036
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1037
+.L1036:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1037:
+	cmpl $519, 4(%rsp)
+	je .LB259
+.L1038:
+.L1039:
+	cmpl $520, 4(%rsp)
+	jne .L1040
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1041
+.L1040:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1041:
+	cmpl $521, 4(%rsp)
+	je .LB260
+.L1042:
+.L1043:
+	cmpl $522, 4(%rsp)
+	jne .L1044
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1045
+.L1044:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1045:
+	cmpl $523, 4(%rsp)
+	je .LB261
+.L1046:
+.L1047:
+	cmpl $524, 4(%rsp)
+	jne .L1048
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1049
+.L1048:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1049:
+	cmpl $525, 4(%rsp)
+	je .LB262
+.L1050:
+.L1051:
+	cmpl $526, 4(%rsp)
+	jne .L1052
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1053
+.L1052:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1053:
+	cmpl $527, 4(%rsp)
+	je .LB263
+.L1054:
+.L1055:
+	cmpl $528, 4(%rsp)
+	jne .L1056
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1057
+.L1056:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1057:
+	cmpl $529, 4(%rsp)
+	je .LB264
+.L1058:
+.L1059:
+	cmpl $530, 4(%rsp)
+	jne .L1060
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1061
+.L1060:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1061:
+	cmpl $531, 4(%rsp)
+	je .LB265
+.L1062:
+.L1063:
+	cmpl $532, 4(%rsp)
+	jne .L1064
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1065
+.L1064:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1065:
+	cmpl $533, 4(%rsp)
+	je .LB266
+.L1066:
+.L1067:
+	cmpl $534, 4(%rsp)
+	jne .L1068
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1069
+.L1068:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1069:
+	cmpl $535, 4(%rsp)
+	je .LB267
+.L1070:
+.L1071:
+	cmpl $536, 4(%rsp)
+	jne .L1072
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1073
+.L1072:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1073:
+	cmpl $537, 4(%rsp)
+	je .LB268
+.L1074:
+.L1075:
+	cmpl $538, 4(%rsp)
+	jne .L1076
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1077
+.L1076:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1077:
+	cmpl $539, 4(%rsp)
+	je .LB269
+.L1078:
+.L1079:
+	cmpl $540, 4(%rsp)
+	jne .L1080
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1081
+.L1080:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1081:
+	cmpl $541, 4(%rsp)
+	je .LB270
+.L1082:
+.L1083:
+	cmpl $542, 4(%rsp)
+	jne .L1084
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1085
+.L1084:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1085:
+	cmpl $543, 4(%rsp)
+	je .LB271
+.L1086:
+.L1087:
+	cmpl $544, 4(%rsp)
+	jne .L1088
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1089
+.L1088:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1089:
+	cmpl $545, 4(%rsp)
+	je .LB272
+.L1090:
+.L1091:
+	cmpl $546, 4(%rsp)
+	jne .L1092
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1093
+.L1092:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1093:
+	cmpl $547, 4(%rsp)
+	je .LB273
+.L1094:
+.L1095:
+	cmpl $548, 4(%rsp)
+	jne .L1096
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1097
+.L1096:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1097:
+	cmpl $549, 4(%rsp)
+	je .LB274
+.L1098:
+.L1099:
+	cmpl $550, 4(%rsp)
+	jne .L1100
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1101
+.L1100:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1101:
+	cmpl $551, 4(%rsp)
+	je .LB275
+.L1102:
+.L1103:
+	cmpl $552, 4(%rsp)
+	jne .L1104
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1105
+.L1104:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1105:
+	cmpl $553, 4(%rsp)
+	je .LB276
+.L1106:
+.L1107:
+	cmpl $554, 4(%rsp)
+	jne .L1108
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1109
+.L1108:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1109:
+	cmpl $555, 4(%rsp)
+	je .LB277
+.L1110:
+.L1111:
+	cmpl $556, 4(%rsp)
+	jne .L1112
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1113
+.L1112:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1113:
+	cmpl $557, 4(%rsp)
+	je .LB278
+.L1114:
+.L1115:
+	cmpl $558, 4(%rsp)
+	jne .L1116
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1117
+.L1116:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1117:
+	cmpl $559, 4(%rsp)
+	je .LB279
+.L1118:
+.L1119:
+	cmpl $560, 4(%rsp)
+	jne .L1120
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1121
+.L1120:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1121:
+	cmpl $561, 4(%rsp)
+	je .LB280
+.L1122:
+.L1123:
+	cmpl $562, 4(%rsp)
+	jne .L1124
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1125
+.L1124:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1125:
+	cmpl $563, 4(%rsp)
+	je .LB281
+.L1126:
+.L1127:
+	cmpl $564, 4(%rsp)
+	jne .L1128
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1129
+.L1128:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1129:
+	cmpl $565, 4(%rsp)
+	je .LB282
+.L1130:
+.L1131:
+	cmpl $566, 4(%rsp)
+	jne .L1132
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1133
+.L1132:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1133:
+	cmpl $567, 4(%rsp)
+	je .LB283
+.L1134:
+.L1135:
+	cmpl $568, 4(%rsp)
+	jne .L1136
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1137
+.L1136:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1137:
+	cmpl $569, 4(%rsp)
+	je .LB284
+.L1138:
+.L1139:
+	cmpl $570, 4(%rsp)
+	jne .L1140
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1141
+.L1140:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1141:
+	cmpl $571, 4(%rsp)
+	je .LB285
+.L1142:
+.L1143:
+	cmpl $572, 4(%rsp)
+	jne .L1144
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1145
+.L1144:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1145:
+	cmpl $573, 4(%rsp)
+	je .LB286
+.L1146:
+.L1147:
+	cmpl $574, 4(%rsp)
+	jne .L1148
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1149
+.L1148:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1149:
+	cmpl $575, 4(%rsp)
+	je .LB287
+.L1150:
+.L1151:
+	cmpl $576, 4(%rsp)
+	jne .L1152
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1153
+.L1152:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1153:
+	cmpl $577, 4(%rsp)
+	je .LB288
+.L1154:
+.L1155:
+	cmpl $578, 4(%rsp)
+	jne .L1156
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1157
+.L1156:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1157:
+	cmpl $579, 4(%rsp)
+	je .LB289
+.L1158:
+.L1159:
+	cmpl $580, 4(%rsp)
+	jne .L1160
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1161
+.L1160:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1161:
+	cmpl $581, 4(%rsp)
+	je .LB290
+.L1162:
+.L1163:
+	cmpl $582, 4(%rsp)
+	jne .L1164
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1165
+.L1164:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1165:
+	cmpl $583, 4(%rsp)
+	je .LB291
+.L1166:
+.L1167:
+	cmpl $584, 4(%rsp)
+	jne .L1168
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1169
+.L1168:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1169:
+	cmpl $585, 4(%rsp)
+	je .LB292
+.L1170:
+.L1171:
+	cmpl $586, 4(%rsp)
+	jne .L1172
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1173
+.L1172:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1173:
+	cmpl $587, 4(%rsp)
+	je .LB293
+.L1174:
+.L1175:
+	cmpl $588, 4(%rsp)
+	jne .L1176
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1177
+.L1176:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1177:
+	cmpl $589, 4(%rsp)
+	je .LB294
+.L1178:
+.L1179:
+	cmpl $590, 4(%rsp)
+	jne .L1180
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1181
+.L1180:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1181:
+	cmpl $591, 4(%rsp)
+	je .LB295
+.L1182:
+.L1183:
+	cmpl $592, 4(%rsp)
+	jne .L1184
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1185
+.L1184:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1185:
+	cmpl $593, 4(%rsp)
+	je .LB296
+.L1186:
+.L1187:
+	cmpl $594, 4(%rsp)
+	jne .L1188
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1189
+.L1188:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1189:
+	cmpl $595, 4(%rsp)
+	je .LB297
+.L1190:
+.L1191:
+	cmpl $596, 4(%rsp)
+	jne .L1192
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1193
+.L1192:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1193:
+	cmpl $597, 4(%rsp)
+	je .LB298
+.L1194:
+.L1195:
+	cmpl $598, 4(%rsp)
+	jne .L1196
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1197
+.L1196:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1197:
+	cmpl $599, 4(%rsp)
+	je .LB299
+.L1198:
+.L1199:
+	cmpl $600, 4(%rsp)
+	jne .L1200
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1201
+.L1200:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1201:
+	cmpl $601, 4(%rsp)
+	je .LB300
+.L1202:
+.L1203:
+	cmpl $602, 4(%rsp)
+	jne .L1204
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1205
+.L1204:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1205:
+	cmpl $603, 4(%rsp)
+	je .LB301
+.L1206:
+.L1207:
+	cmpl $604, 4(%rsp)
+	jne .L1208
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1209
+.L1208:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1209:
+	cmpl $605, 4(%rsp)
+	je .LB302
+.L1210:
+.L1211:
+	cmpl $606, 4(%rsp)
+	jne .L1212
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1213
+.L1212:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1213:
+	cmpl $607, 4(%rsp)
+	je .LB303
+.L1214:
+.L1215:
+	cmpl $608, 4(%rsp)
+	jne .L1216
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1217
+.L1216:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1217:
+	cmpl $609, 4(%rsp)
+	je .LB304
+.L1218:
+.L1219:
+	cmpl $610, 4(%rsp)
+	jne .L1220
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1221
+.L1220:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1221:
+	cmpl $611, 4(%rsp)
+	je .LB305
+.L1222:
+.L1223:
+	cmpl $612, 4(%rsp)
+	jne .L1224
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1225
+.L1224:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1225:
+	cmpl $613, 4(%rsp)
+	je .LB306
+.L1226:
+.L1227:
+	cmpl $614, 4(%rsp)
+	jne .L1228
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1229
+.L1228:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1229:
+	cmpl $615, 4(%rsp)
+	je .LB307
+.L1230:
+.L1231:
+	cmpl $616, 4(%rsp)
+	jne .L1232
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1233
+.L1232:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1233:
+	cmpl $617, 4(%rsp)
+	je .LB308
+.L1234:
+.L1235:
+	cmpl $618, 4(%rsp)
+	jne .L1236
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1237
+.L1236:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1237:
+	cmpl $619, 4(%rsp)
+	je .LB309
+.L1238:
+.L1239:
+	cmpl $620, 4(%rsp)
+	jne .L1240
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1241
+.L1240:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1241:
+	cmpl $621, 4(%rsp)
+	je .LB310
+.L1242:
+.L1243:
+	cmpl $622, 4(%rsp)
+	jne .L1244
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1245
+.L1244:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1245:
+	cmpl $623, 4(%rsp)
+	je .LB311
+.L1246:
+.L1247:
+	cmpl $624, 4(%rsp)
+	jne .L1248
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1249
+.L1248:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1249:
+	cmpl $625, 4(%rsp)
+	je .LB312
+.L1250:
+.L1251:
+	cmpl $626, 4(%rsp)
+	jne .L1252
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1253
+.L1252:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1253:
+	cmpl $627, 4(%rsp)
+	je .LB313
+.L1254:
+.L1255:
+	cmpl $628, 4(%rsp)
+	jne .L1256
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1257
+.L1256:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1257:
+	cmpl $629, 4(%rsp)
+	je .LB314
+.L1258:
+.L1259:
+	cmpl $630, 4(%rsp)
+	jne .L1260
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1261
+.L1260:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1261:
+	cmpl $631, 4(%rsp)
+	je .LB315
+.L1262:
+.L1263:
+	cmpl $632, 4(%rsp)
+	jne .L1264
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1265
+.L1264:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1265:
+	cmpl $633, 4(%rsp)
+	je .LB316
+.L1266:
+.L1267:
+	cmpl $634, 4(%rsp)
+	jne .L1268
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1269
+.L1268:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1269:
+	cmpl $635, 4(%rsp)
+	je .LB317
+.L1270:
+.L1271:
+	cmpl $636, 4(%rsp)
+	jne .L1272
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1273
+.L1272:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1273:
+	cmpl $637, 4(%rsp)
+	je .LB318
+.L1274:
+.L1275:
+	cmpl $638, 4(%rsp)
+	jne .L1276
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1277
+.L1276:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1277:
+	cmpl $639, 4(%rsp)
+	je .LB319
+.L1278:
+.L1279:
+	cmpl $640, 4(%rsp)
+	jne .L1280
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1281
+.L1280:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1281:
+	cmpl $641, 4(%rsp)
+	je .LB320
+.L1282:
+.L1283:
+	cmpl $642, 4(%rsp)
+	jne .L1284
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1285
+.L1284:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1285:
+	cmpl $643, 4(%rsp)
+	je .LB321
+.L1286:
+.L1287:
+	cmpl $644, 4(%rsp)
+	jne .L1288
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1289
+.L1288:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1289:
+	cmpl $645, 4(%rsp)
+	je .LB322
+.L1290:
+.L1291:
+	cmpl $646, 4(%rsp)
+	jne .L1292
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1293
+.L1292:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1293:
+	cmpl $647, 4(%rsp)
+	je .LB323
+.L1294:
+.L1295:
+	cmpl $648, 4(%rsp)
+	jne .L1296
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1297
+.L1296:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1297:
+	cmpl $649, 4(%rsp)
+	je .LB324
+.L1298:
+.L1299:
+	cmpl $650, 4(%rsp)
+	jne .L1300
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1301
+.L1300:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1301:
+	cmpl $651, 4(%rsp)
+	je .LB325
+.L1302:
+.L1303:
+	cmpl $652, 4(%rsp)
+	jne .L1304
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1305
+.L1304:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1305:
+	cmpl $653, 4(%rsp)
+	je .LB326
+.L1306:
+.L1307:
+	cmpl $654, 4(%rsp)
+	jne .L1308
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1309
+.L1308:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1309:
+	cmpl $655, 4(%rsp)
+	je .LB327
+.L1310:
+.L1311:
+	cmpl $656, 4(%rsp)
+	jne .L1312
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1313
+.L1312:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1313:
+	cmpl $657, 4(%rsp)
+	je .LB328
+.L1314:
+.L1315:
+	cmpl $658, 4(%rsp)
+	jne .L1316
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1317
+.L1316:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1317:
+	cmpl $659, 4(%rsp)
+	je .LB329
+.L1318:
+.L1319:
+	cmpl $660, 4(%rsp)
+	jne .L1320
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1321
+.L1320:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1321:
+	cmpl $661, 4(%rsp)
+	je .LB330
+.L1322:
+.L1323:
+	cmpl $662, 4(%rsp)
+	jne .L1324
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1325
+.L1324:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1325:
+	cmpl $663, 4(%rsp)
+	je .LB331
+.L1326:
+.L1327:
+	cmpl $664, 4(%rsp)
+	jne .L1328
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1329
+.L1328:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1329:
+	cmpl $665, 4(%rsp)
+	je .LB332
+.L1330:
+.L1331:
+	cmpl $666, 4(%rsp)
+	jne .L1332
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1333
+.L1332:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1333:
+	cmpl $667, 4(%rsp)
+	je .LB333
+.L1334:
+.L1335:
+	cmpl $668, 4(%rsp)
+	jne .L1336
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1337
+.L1336:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1337:
+	cmpl $669, 4(%rsp)
+	je .LB334
+.L1338:
+.L1339:
+	cmpl $670, 4(%rsp)
+	jne .L1340
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1341
+.L1340:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1341:
+	cmpl $671, 4(%rsp)
+	je .LB335
+.L1342:
+.L1343:
+	cmpl $672, 4(%rsp)
+	jne .L1344
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1345
+.L1344:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1345:
+	cmpl $673, 4(%rsp)
+	je .LB336
+.L1346:
+.L1347:
+	cmpl $674, 4(%rsp)
+	jne .L1348
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1349
+.L1348:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1349:
+	cmpl $675, 4(%rsp)
+	je .LB337
+.L1350:
+.L1351:
+	cmpl $676, 4(%rsp)
+	jne .L1352
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1353
+.L1352:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1353:
+	cmpl $677, 4(%rsp)
+	je .LB338
+.L1354:
+.L1355:
+	cmpl $678, 4(%rsp)
+	jne .L1356
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1357
+.L1356:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1357:
+	cmpl $679, 4(%rsp)
+	je .LB339
+.L1358:
+.L1359:
+	cmpl $680, 4(%rsp)
+	jne .L1360
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1361
+.L1360:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1361:
+	cmpl $681, 4(%rsp)
+	je .LB340
+.L1362:
+.L1363:
+	cmpl $682, 4(%rsp)
+	jne .L1364
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1365
+.L1364:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1365:
+	cmpl $683, 4(%rsp)
+	je .LB341
+.L1366:
+.L1367:
+	cmpl $684, 4(%rsp)
+	jne .L1368
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1369
+.L1368:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1369:
+	cmpl $685, 4(%rsp)
+	je .LB342
+.L1370:
+.L1371:
+	cmpl $686, 4(%rsp)
+	jne .L1372
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1373
+.L1372:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1373:
+	cmpl $687, 4(%rsp)
+	je .LB343
+.L1374:
+.L1375:
+	cmpl $688, 4(%rsp)
+	jne .L1376
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1377
+.L1376:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1377:
+	cmpl $689, 4(%rsp)
+	je .LB344
+.L1378:
+.L1379:
+	cmpl $690, 4(%rsp)
+	jne .L1380
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1381
+.L1380:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1381:
+	cmpl $691, 4(%rsp)
+	je .LB345
+.L1382:
+.L1383:
+	cmpl $692, 4(%rsp)
+	jne .L1384
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1385
+.L1384:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1385:
+	cmpl $693, 4(%rsp)
+	je .LB346
+.L1386:
+.L1387:
+	cmpl $694, 4(%rsp)
+	jne .L1388
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1389
+.L1388:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1389:
+	cmpl $695, 4(%rsp)
+	je .LB347
+.L1390:
+.L1391:
+	cmpl $696, 4(%rsp)
+	jne .L1392
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1393
+.L1392:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1393:
+	cmpl $697, 4(%rsp)
+	je .LB348
+.L1394:
+.L1395:
+	cmpl $698, 4(%rsp)
+	jne .L1396
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1397
+.L1396:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1397:
+	cmpl $699, 4(%rsp)
+	je .LB349
+.L1398:
+.L1399:
+	cmpl $700, 4(%rsp)
+	jne .L1400
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1401
+.L1400:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1401:
+	cmpl $701, 4(%rsp)
+	je .LB350
+.L1402:
+.L1403:
+	cmpl $702, 4(%rsp)
+	jne .L1404
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1405
+.L1404:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1405:
+	cmpl $703, 4(%rsp)
+	je .LB351
+.L1406:
+.L1407:
+	cmpl $704, 4(%rsp)
+	jne .L1408
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1409
+.L1408:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1409:
+	cmpl $705, 4(%rsp)
+	je .LB352
+.L1410:
+.L1411:
+	cmpl $706, 4(%rsp)
+	jne .L1412
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1413
+.L1412:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1413:
+	cmpl $707, 4(%rsp)
+	je .LB353
+.L1414:
+.L1415:
+	cmpl $708, 4(%rsp)
+	jne .L1416
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1417
+.L1416:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1417:
+	cmpl $709, 4(%rsp)
+	je .LB354
+.L1418:
+.L1419:
+	cmpl $710, 4(%rsp)
+	jne .L1420
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1421
+.L1420:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1421:
+	cmpl $711, 4(%rsp)
+	je .LB355
+.L1422:
+.L1423:
+	cmpl $712, 4(%rsp)
+	jne .L1424
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1425
+.L1424:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1425:
+	cmpl $713, 4(%rsp)
+	je .LB356
+.L1426:
+.L1427:
+	cmpl $714, 4(%rsp)
+	jne .L1428
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1429
+.L1428:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1429:
+	cmpl $715, 4(%rsp)
+	je .LB357
+.L1430:
+.L1431:
+	cmpl $716, 4(%rsp)
+	jne .L1432
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1433
+.L1432:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1433:
+	cmpl $717, 4(%rsp)
+	je .LB358
+.L1434:
+.L1435:
+	cmpl $718, 4(%rsp)
+	jne .L1436
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1437
+.L1436:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1437:
+	cmpl $719, 4(%rsp)
+	je .LB359
+.L1438:
+.L1439:
+	cmpl $720, 4(%rsp)
+	jne .L1440
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1441
+.L1440:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1441:
+	cmpl $721, 4(%rsp)
+	je .LB360
+.L1442:
+.L1443:
+	cmpl $722, 4(%rsp)
+	jne .L1444
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1445
+.L1444:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1445:
+	cmpl $723, 4(%rsp)
+	je .LB361
+.L1446:
+.L1447:
+	cmpl $724, 4(%rsp)
+	jne .L1448
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1449
+.L1448:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1449:
+	cmpl $725, 4(%rsp)
+	je .LB362
+.L1450:
+.L1451:
+	cmpl $726, 4(%rsp)
+	jne .L1452
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1453
+.L1452:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1453:
+	cmpl $727, 4(%rsp)
+	je .LB363
+.L1454:
+.L1455:
+	cmpl $728, 4(%rsp)
+	jne .L1456
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1457
+.L1456:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1457:
+	cmpl $729, 4(%rsp)
+	je .LB364
+.L1458:
+.L1459:
+	cmpl $730, 4(%rsp)
+	jne .L1460
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1461
+.L1460:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1461:
+	cmpl $731, 4(%rsp)
+	je .LB365
+.L1462:
+.L1463:
+	cmpl $732, 4(%rsp)
+	jne .L1464
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1465
+.L1464:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1465:
+	cmpl $733, 4(%rsp)
+	je .LB366
+.L1466:
+.L1467:
+	cmpl $734, 4(%rsp)
+	jne .L1468
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1469
+.L1468:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1469:
+	cmpl $735, 4(%rsp)
+	je .LB367
+.L1470:
+.L1471:
+	cmpl $736, 4(%rsp)
+	jne .L1472
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1473
+.L1472:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1473:
+	cmpl $737, 4(%rsp)
+	je .LB368
+.L1474:
+.L1475:
+	cmpl $738, 4(%rsp)
+	jne .L1476
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1477
+.L1476:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1477:
+	cmpl $739, 4(%rsp)
+	je .LB369
+.L1478:
+.L1479:
+	cmpl $740, 4(%rsp)
+	jne .L1480
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1481
+.L1480:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1481:
+	cmpl $741, 4(%rsp)
+	je .LB370
+.L1482:
+.L1483:
+	cmpl $742, 4(%rsp)
+	jne .L1484
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1485
+.L1484:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1485:
+	cmpl $743, 4(%rsp)
+	je .LB371
+.L1486:
+.L1487:
+	cmpl $744, 4(%rsp)
+	jne .L1488
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1489
+.L1488:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1489:
+	cmpl $745, 4(%rsp)
+	je .LB372
+.L1490:
+.L1491:
+	cmpl $746, 4(%rsp)
+	jne .L1492
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1493
+.L1492:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1493:
+	cmpl $747, 4(%rsp)
+	je .LB373
+.L1494:
+.L1495:
+	cmpl $748, 4(%rsp)
+	jne .L1496
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1497
+.L1496:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1497:
+	cmpl $749, 4(%rsp)
+	je .LB374
+.L1498:
+.L1499:
+	cmpl $750, 4(%rsp)
+	jne .L1500
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1501
+.L1500:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1501:
+	cmpl $751, 4(%rsp)
+	je .LB375
+.L1502:
+.L1503:
+	cmpl $752, 4(%rsp)
+	jne .L1504
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1505
+.L1504:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1505:
+	cmpl $753, 4(%rsp)
+	je .LB376
+.L1506:
+.L1507:
+	cmpl $754, 4(%rsp)
+	jne .L1508
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1509
+.L1508:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1509:
+	cmpl $755, 4(%rsp)
+	je .LB377
+.L1510:
+.L1511:
+	cmpl $756, 4(%rsp)
+	jne .L1512
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1513
+.L1512:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1513:
+	cmpl $757, 4(%rsp)
+	je .LB378
+.L1514:
+.L1515:
+	cmpl $758, 4(%rsp)
+	jne .L1516
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1517
+.L1516:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1517:
+	cmpl $759, 4(%rsp)
+	je .LB379
+.L1518:
+.L1519:
+	cmpl $760, 4(%rsp)
+	jne .L1520
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1521
+.L1520:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1521:
+	cmpl $761, 4(%rsp)
+	je .LB380
+.L1522:
+.L1523:
+	cmpl $762, 4(%rsp)
+	jne .L1524
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1525
+.L1524:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1525:
+	cmpl $763, 4(%rsp)
+	je .LB381
+.L1526:
+.L1527:
+	cmpl $764, 4(%rsp)
+	jne .L1528
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1529
+.L1528:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1529:
+	cmpl $765, 4(%rsp)
+	je .LB382
+.L1530:
+.L1531:
+	cmpl $766, 4(%rsp)
+	jne .L1532
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1533
+.L1532:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1533:
+	cmpl $767, 4(%rsp)
+	je .LB383
+.L1534:
+.L1535:
+	cmpl $768, 4(%rsp)
+	jne .L1536
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1537
+.L1536:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1537:
+	cmpl $769, 4(%rsp)
+	je .LB384
+.L1538:
+.L1539:
+	cmpl $770, 4(%rsp)
+	jne .L1540
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1541
+.L1540:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1541:
+	cmpl $771, 4(%rsp)
+	je .LB385
+.L1542:
+.L1543:
+	cmpl $772, 4(%rsp)
+	jne .L1544
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1545
+.L1544:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1545:
+	cmpl $773, 4(%rsp)
+	je .LB386
+.L1546:
+.L1547:
+	cmpl $774, 4(%rsp)
+	jne .L1548
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1549
+.L1548:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1549:
+	cmpl $775, 4(%rsp)
+	je .LB387
+.L1550:
+.L1551:
+	cmpl $776, 4(%rsp)
+	jne .L1552
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1553
+.L1552:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1553:
+	cmpl $777, 4(%rsp)
+	je .LB388
+.L1554:
+.L1555:
+	cmpl $778, 4(%rsp)
+	jne .L1556
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1557
+.L1556:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1557:
+	cmpl $779, 4(%rsp)
+	je .LB389
+.L1558:
+.L1559:
+	cmpl $780, 4(%rsp)
+	jne .L1560
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1561
+.L1560:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1561:
+	cmpl $781, 4(%rsp)
+	je .LB390
+.L1562:
+.L1563:
+	cmpl $782, 4(%rsp)
+	jne .L1564
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1565
+.L1564:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1565:
+	cmpl $783, 4(%rsp)
+	je .LB391
+.L1566:
+.L1567:
+	cmpl $784, 4(%rsp)
+	jne .L1568
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1569
+.L1568:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1569:
+	cmpl $785, 4(%rsp)
+	je .LB392
+.L1570:
+.L1571:
+	cmpl $786, 4(%rsp)
+	jne .L1572
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1573
+.L1572:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1573:
+	cmpl $787, 4(%rsp)
+	je .LB393
+.L1574:
+.L1575:
+	cmpl $788, 4(%rsp)
+	jne .L1576
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1577
+.L1576:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1577:
+	cmpl $789, 4(%rsp)
+	je .LB394
+.L1578:
+.L1579:
+	cmpl $790, 4(%rsp)
+	jne .L1580
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1581
+.L1580:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1581:
+	cmpl $791, 4(%rsp)
+	je .LB395
+.L1582:
+.L1583:
+	cmpl $792, 4(%rsp)
+	jne .L1584
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1585
+.L1584:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1585:
+	cmpl $793, 4(%rsp)
+	je .LB396
+.L1586:
+.L1587:
+	cmpl $794, 4(%rsp)
+	jne .L1588
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1589
+.L1588:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1589:
+	cmpl $795, 4(%rsp)
+	je .LB397
+.L1590:
+.L1591:
+	cmpl $796, 4(%rsp)
+	jne .L1592
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1593
+.L1592:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1593:
+	cmpl $797, 4(%rsp)
+	je .LB398
+.L1594:
+.L1595:
+	cmpl $798, 4(%rsp)
+	jne .L1596
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1597
+.L1596:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1597:
+	cmpl $799, 4(%rsp)
+	je .LB399
+.L1598:
+.L1599:
+	cmpl $800, 4(%rsp)
+	jne .L1600
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1601
+.L1600:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1601:
+	cmpl $801, 4(%rsp)
+	je .LB400
+.L1602:
+.L1603:
+	cmpl $802, 4(%rsp)
+	jne .L1604
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1605
+.L1604:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1605:
+	cmpl $803, 4(%rsp)
+	je .LB401
+.L1606:
+.L1607:
+	cmpl $804, 4(%rsp)
+	jne .L1608
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1609
+.L1608:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1609:
+	cmpl $805, 4(%rsp)
+	je .LB402
+.L1610:
+.L1611:
+	cmpl $806, 4(%rsp)
+	jne .L1612
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1613
+.L1612:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1613:
+	cmpl $807, 4(%rsp)
+	je .LB403
+.L1614:
+.L1615:
+	cmpl $808, 4(%rsp)
+	jne .L1616
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1617
+.L1616:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1617:
+	cmpl $809, 4(%rsp)
+	je .LB404
+.L1618:
+.L1619:
+	cmpl $810, 4(%rsp)
+	jne .L1620
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1621
+.L1620:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1621:
+	cmpl $811, 4(%rsp)
+	je .LB405
+.L1622:
+.L1623:
+	cmpl $812, 4(%rsp)
+	jne .L1624
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1625
+.L1624:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1625:
+	cmpl $813, 4(%rsp)
+	je .LB406
+.L1626:
+.L1627:
+	cmpl $814, 4(%rsp)
+	jne .L1628
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1629
+.L1628:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1629:
+	cmpl $815, 4(%rsp)
+	je .LB407
+.L1630:
+.L1631:
+	cmpl $816, 4(%rsp)
+	jne .L1632
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1633
+.L1632:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1633:
+	cmpl $817, 4(%rsp)
+	je .LB408
+.L1634:
+.L1635:
+	cmpl $818, 4(%rsp)
+	jne .L1636
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1637
+.L1636:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1637:
+	cmpl $819, 4(%rsp)
+	je .LB409
+.L1638:
+.L1639:
+	cmpl $820, 4(%rsp)
+	jne .L1640
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1641
+.L1640:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1641:
+	cmpl $821, 4(%rsp)
+	je .LB410
+.L1642:
+.L1643:
+	cmpl $822, 4(%rsp)
+	jne .L1644
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1645
+.L1644:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1645:
+	cmpl $823, 4(%rsp)
+	je .LB411
+.L1646:
+.L1647:
+	cmpl $824, 4(%rsp)
+	jne .L1648
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1649
+.L1648:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1649:
+	cmpl $825, 4(%rsp)
+	je .LB412
+.L1650:
+.L1651:
+	cmpl $826, 4(%rsp)
+	jne .L1652
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1653
+.L1652:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1653:
+	cmpl $827, 4(%rsp)
+	je .LB413
+.L1654:
+.L1655:
+	cmpl $828, 4(%rsp)
+	jne .L1656
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1657
+.L1656:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1657:
+	cmpl $829, 4(%rsp)
+	je .LB414
+.L1658:
+.L1659:
+	cmpl $830, 4(%rsp)
+	jne .L1660
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1661
+.L1660:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1661:
+	cmpl $831, 4(%rsp)
+	je .LB415
+.L1662:
+.L1663:
+	cmpl $832, 4(%rsp)
+	jne .L1664
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1665
+.L1664:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1665:
+	cmpl $833, 4(%rsp)
+	je .LB416
+.L1666:
+.L1667:
+	cmpl $834, 4(%rsp)
+	jne .L1668
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1669
+.L1668:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1669:
+	cmpl $835, 4(%rsp)
+	je .LB417
+.L1670:
+.L1671:
+	cmpl $836, 4(%rsp)
+	jne .L1672
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1673
+.L1672:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1673:
+	cmpl $837, 4(%rsp)
+	je .LB418
+.L1674:
+.L1675:
+	cmpl $838, 4(%rsp)
+	jne .L1676
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1677
+.L1676:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1677:
+	cmpl $839, 4(%rsp)
+	je .LB419
+.L1678:
+.L1679:
+	cmpl $840, 4(%rsp)
+	jne .L1680
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1681
+.L1680:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1681:
+	cmpl $841, 4(%rsp)
+	je .LB420
+.L1682:
+.L1683:
+	cmpl $842, 4(%rsp)
+	jne .L1684
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1685
+.L1684:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1685:
+	cmpl $843, 4(%rsp)
+	je .LB421
+.L1686:
+.L1687:
+	cmpl $844, 4(%rsp)
+	jne .L1688
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1689
+.L1688:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1689:
+	cmpl $845, 4(%rsp)
+	je .LB422
+.L1690:
+.L1691:
+	cmpl $846, 4(%rsp)
+	jne .L1692
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1693
+.L1692:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1693:
+	cmpl $847, 4(%rsp)
+	je .LB423
+.L1694:
+.L1695:
+	cmpl $848, 4(%rsp)
+	jne .L1696
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1697
+.L1696:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1697:
+	cmpl $849, 4(%rsp)
+	je .LB424
+.L1698:
+.L1699:
+	cmpl $850, 4(%rsp)
+	jne .L1700
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1701
+.L1700:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1701:
+	cmpl $851, 4(%rsp)
+	je .LB425
+.L1702:
+.L1703:
+	cmpl $852, 4(%rsp)
+	jne .L1704
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1705
+.L1704:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1705:
+	cmpl $853, 4(%rsp)
+	je .LB426
+.L1706:
+.L1707:
+	cmpl $854, 4(%rsp)
+	jne .L1708
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1709
+.L1708:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1709:
+	cmpl $855, 4(%rsp)
+	je .LB427
+.L1710:
+.L1711:
+	cmpl $856, 4(%rsp)
+	jne .L1712
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1713
+.L1712:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1713:
+	cmpl $857, 4(%rsp)
+	je .LB428
+.L1714:
+.L1715:
+	cmpl $858, 4(%rsp)
+	jne .L1716
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1717
+.L1716:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1717:
+	cmpl $859, 4(%rsp)
+	je .LB429
+.L1718:
+.L1719:
+	cmpl $860, 4(%rsp)
+	jne .L1720
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1721
+.L1720:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1721:
+	cmpl $861, 4(%rsp)
+	je .LB430
+.L1722:
+.L1723:
+	cmpl $862, 4(%rsp)
+	jne .L1724
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1725
+.L1724:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1725:
+	cmpl $863, 4(%rsp)
+	je .LB431
+.L1726:
+.L1727:
+	cmpl $864, 4(%rsp)
+	jne .L1728
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1729
+.L1728:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1729:
+	cmpl $865, 4(%rsp)
+	je .LB432
+.L1730:
+.L1731:
+	cmpl $866, 4(%rsp)
+	jne .L1732
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1733
+.L1732:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1733:
+	cmpl $867, 4(%rsp)
+	je .LB433
+.L1734:
+.L1735:
+	cmpl $868, 4(%rsp)
+	jne .L1736
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1737
+.L1736:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1737:
+	cmpl $869, 4(%rsp)
+	je .LB434
+.L1738:
+.L1739:
+	cmpl $870, 4(%rsp)
+	jne .L1740
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1741
+.L1740:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1741:
+	cmpl $871, 4(%rsp)
+	je .LB435
+.L1742:
+.L1743:
+	cmpl $872, 4(%rsp)
+	jne .L1744
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1745
+.L1744:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1745:
+	cmpl $873, 4(%rsp)
+	je .LB436
+.L1746:
+.L1747:
+	cmpl $874, 4(%rsp)
+	jne .L1748
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1749
+.L1748:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1749:
+	cmpl $875, 4(%rsp)
+	je .LB437
+.L1750:
+.L1751:
+	cmpl $876, 4(%rsp)
+	jne .L1752
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1753
+.L1752:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1753:
+	cmpl $877, 4(%rsp)
+	je .LB438
+.L1754:
+.L1755:
+	cmpl $878, 4(%rsp)
+	jne .L1756
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1757
+.L1756:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1757:
+	cmpl $879, 4(%rsp)
+	je .LB439
+.L1758:
+.L1759:
+	cmpl $880, 4(%rsp)
+	jne .L1760
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1761
+.L1760:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1761:
+	cmpl $881, 4(%rsp)
+	je .LB440
+.L1762:
+.L1763:
+	cmpl $882, 4(%rsp)
+	jne .L1764
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1765
+.L1764:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1765:
+	cmpl $883, 4(%rsp)
+	je .LB441
+.L1766:
+.L1767:
+	cmpl $884, 4(%rsp)
+	jne .L1768
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1769
+.L1768:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1769:
+	cmpl $885, 4(%rsp)
+	je .LB442
+.L1770:
+.L1771:
+	cmpl $886, 4(%rsp)
+	jne .L1772
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1773
+.L1772:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1773:
+	cmpl $887, 4(%rsp)
+	je .LB443
+.L1774:
+.L1775:
+	cmpl $888, 4(%rsp)
+	jne .L1776
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1777
+.L1776:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1777:
+	cmpl $889, 4(%rsp)
+	je .LB444
+.L1778:
+.L1779:
+	cmpl $890, 4(%rsp)
+	jne .L1780
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1781
+.L1780:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1781:
+	cmpl $891, 4(%rsp)
+	je .LB445
+.L1782:
+.L1783:
+	cmpl $892, 4(%rsp)
+	jne .L1784
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1785
+.L1784:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1785:
+	cmpl $893, 4(%rsp)
+	je .LB446
+.L1786:
+.L1787:
+	cmpl $894, 4(%rsp)
+	jne .L1788
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1789
+.L1788:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1789:
+	cmpl $895, 4(%rsp)
+	je .LB447
+.L1790:
+.L1791:
+	cmpl $896, 4(%rsp)
+	jne .L1792
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1793
+.L1792:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1793:
+	cmpl $897, 4(%rsp)
+	je .LB448
+.L1794:
+.L1795:
+	cmpl $898, 4(%rsp)
+	jne .L1796
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1797
+.L1796:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1797:
+	cmpl $899, 4(%rsp)
+	je .LB449
+.L1798:
+.L1799:
+	cmpl $900, 4(%rsp)
+	jne .L1800
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1801
+.L1800:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1801:
+	cmpl $901, 4(%rsp)
+	je .LB450
+.L1802:
+.L1803:
+	cmpl $902, 4(%rsp)
+	jne .L1804
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1805
+.L1804:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1805:
+	cmpl $903, 4(%rsp)
+	je .LB451
+.L1806:
+.L1807:
+	cmpl $904, 4(%rsp)
+	jne .L1808
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1809
+.L1808:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1809:
+	cmpl $905, 4(%rsp)
+	je .LB452
+.L1810:
+.L1811:
+	cmpl $906, 4(%rsp)
+	jne .L1812
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1813
+.L1812:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1813:
+	cmpl $907, 4(%rsp)
+	je .LB453
+.L1814:
+.L1815:
+	cmpl $908, 4(%rsp)
+	jne .L1816
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1817
+.L1816:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1817:
+	cmpl $909, 4(%rsp)
+	je .LB454
+.L1818:
+.L1819:
+	cmpl $910, 4(%rsp)
+	jne .L1820
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1821
+.L1820:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1821:
+	cmpl $911, 4(%rsp)
+	je .LB455
+.L1822:
+.L1823:
+	cmpl $912, 4(%rsp)
+	jne .L1824
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1825
+.L1824:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1825:
+	cmpl $913, 4(%rsp)
+	je .LB456
+.L1826:
+.L1827:
+	cmpl $914, 4(%rsp)
+	jne .L1828
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1829
+.L1828:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1829:
+	cmpl $915, 4(%rsp)
+	je .LB457
+.L1830:
+.L1831:
+	cmpl $916, 4(%rsp)
+	jne .L1832
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1833
+.L1832:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1833:
+	cmpl $917, 4(%rsp)
+	je .LB458
+.L1834:
+.L1835:
+	cmpl $918, 4(%rsp)
+	jne .L1836
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1837
+.L1836:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1837:
+	cmpl $919, 4(%rsp)
+	je .LB459
+.L1838:
+.L1839:
+	cmpl $920, 4(%rsp)
+	jne .L1840
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1841
+.L1840:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1841:
+	cmpl $921, 4(%rsp)
+	je .LB460
+.L1842:
+.L1843:
+	cmpl $922, 4(%rsp)
+	jne .L1844
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1845
+.L1844:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1845:
+	cmpl $923, 4(%rsp)
+	je .LB461
+.L1846:
+.L1847:
+	cmpl $924, 4(%rsp)
+	jne .L1848
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1849
+.L1848:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1849:
+	cmpl $925, 4(%rsp)
+	je .LB462
+.L1850:
+.L1851:
+	cmpl $926, 4(%rsp)
+	jne .L1852
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1853
+.L1852:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1853:
+	cmpl $927, 4(%rsp)
+	je .LB463
+.L1854:
+.L1855:
+	cmpl $928, 4(%rsp)
+	jne .L1856
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1857
+.L1856:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1857:
+	cmpl $929, 4(%rsp)
+	je .LB464
+.L1858:
+.L1859:
+	cmpl $930, 4(%rsp)
+	jne .L1860
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1861
+.L1860:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1861:
+	cmpl $931, 4(%rsp)
+	je .LB465
+.L1862:
+.L1863:
+	cmpl $932, 4(%rsp)
+	jne .L1864
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1865
+.L1864:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1865:
+	cmpl $933, 4(%rsp)
+	je .LB466
+.L1866:
+.L1867:
+	cmpl $934, 4(%rsp)
+	jne .L1868
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1869
+.L1868:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1869:
+	cmpl $935, 4(%rsp)
+	je .LB467
+.L1870:
+.L1871:
+	cmpl $936, 4(%rsp)
+	jne .L1872
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1873
+.L1872:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1873:
+	cmpl $937, 4(%rsp)
+	je .LB468
+.L1874:
+.L1875:
+	cmpl $938, 4(%rsp)
+	jne .L1876
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1877
+.L1876:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1877:
+	cmpl $939, 4(%rsp)
+	je .LB469
+.L1878:
+.L1879:
+	cmpl $940, 4(%rsp)
+	jne .L1880
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1881
+.L1880:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1881:
+	cmpl $941, 4(%rsp)
+	je .LB470
+.L1882:
+.L1883:
+	cmpl $942, 4(%rsp)
+	jne .L1884
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1885
+.L1884:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1885:
+	cmpl $943, 4(%rsp)
+	je .LB471
+.L1886:
+.L1887:
+	cmpl $944, 4(%rsp)
+	jne .L1888
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1889
+.L1888:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1889:
+	cmpl $945, 4(%rsp)
+	je .LB472
+.L1890:
+.L1891:
+	cmpl $946, 4(%rsp)
+	jne .L1892
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1893
+.L1892:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1893:
+	cmpl $947, 4(%rsp)
+	je .LB473
+.L1894:
+.L1895:
+	cmpl $948, 4(%rsp)
+	jne .L1896
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1897
+.L1896:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1897:
+	cmpl $949, 4(%rsp)
+	je .LB474
+.L1898:
+.L1899:
+	cmpl $950, 4(%rsp)
+	jne .L1900
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1901
+.L1900:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1901:
+	cmpl $951, 4(%rsp)
+	je .LB475
+.L1902:
+.L1903:
+	cmpl $952, 4(%rsp)
+	jne .L1904
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1905
+.L1904:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1905:
+	cmpl $953, 4(%rsp)
+	je .LB476
+.L1906:
+.L1907:
+	cmpl $954, 4(%rsp)
+	jne .L1908
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1909
+.L1908:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1909:
+	cmpl $955, 4(%rsp)
+	je .LB477
+.L1910:
+.L1911:
+	cmpl $956, 4(%rsp)
+	jne .L1912
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1913
+.L1912:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1913:
+	cmpl $957, 4(%rsp)
+	je .LB478
+.L1914:
+.L1915:
+	cmpl $958, 4(%rsp)
+	jne .L1916
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1917
+.L1916:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1917:
+	cmpl $959, 4(%rsp)
+	je .LB479
+.L1918:
+.L1919:
+	cmpl $960, 4(%rsp)
+	jne .L1920
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1921
+.L1920:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1921:
+	cmpl $961, 4(%rsp)
+	je .LB480
+.L1922:
+.L1923:
+	cmpl $962, 4(%rsp)
+	jne .L1924
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1925
+.L1924:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1925:
+	cmpl $963, 4(%rsp)
+	je .LB481
+.L1926:
+.L1927:
+	cmpl $964, 4(%rsp)
+	jne .L1928
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1929
+.L1928:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1929:
+	cmpl $965, 4(%rsp)
+	je .LB482
+.L1930:
+.L1931:
+	cmpl $966, 4(%rsp)
+	jne .L1932
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1933
+.L1932:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1933:
+	cmpl $967, 4(%rsp)
+	je .LB483
+.L1934:
+.L1935:
+	cmpl $968, 4(%rsp)
+	jne .L1936
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1937
+.L1936:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1937:
+	cmpl $969, 4(%rsp)
+	je .LB484
+.L1938:
+.L1939:
+	cmpl $970, 4(%rsp)
+	jne .L1940
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1941
+.L1940:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1941:
+	cmpl $971, 4(%rsp)
+	je .LB485
+.L1942:
+.L1943:
+	cmpl $972, 4(%rsp)
+	jne .L1944
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1945
+.L1944:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1945:
+	cmpl $973, 4(%rsp)
+	je .LB486
+.L1946:
+.L1947:
+	cmpl $974, 4(%rsp)
+	jne .L1948
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1949
+.L1948:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1949:
+	cmpl $975, 4(%rsp)
+	je .LB487
+.L1950:
+.L1951:
+	cmpl $976, 4(%rsp)
+	jne .L1952
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1953
+.L1952:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1953:
+	cmpl $977, 4(%rsp)
+	je .LB488
+.L1954:
+.L1955:
+	cmpl $978, 4(%rsp)
+	jne .L1956
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1957
+.L1956:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1957:
+	cmpl $979, 4(%rsp)
+	je .LB489
+.L1958:
+.L1959:
+	cmpl $980, 4(%rsp)
+	jne .L1960
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1961
+.L1960:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1961:
+	cmpl $981, 4(%rsp)
+	je .LB490
+.L1962:
+.L1963:
+	cmpl $982, 4(%rsp)
+	jne .L1964
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1965
+.L1964:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1965:
+	cmpl $983, 4(%rsp)
+	je .LB491
+.L1966:
+.L1967:
+	cmpl $984, 4(%rsp)
+	jne .L1968
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1969
+.L1968:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1969:
+	cmpl $985, 4(%rsp)
+	je .LB492
+.L1970:
+.L1971:
+	cmpl $986, 4(%rsp)
+	jne .L1972
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1973
+.L1972:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1973:
+	cmpl $987, 4(%rsp)
+	je .LB493
+.L1974:
+.L1975:
+	cmpl $988, 4(%rsp)
+	jne .L1976
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1977
+.L1976:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1977:
+	cmpl $989, 4(%rsp)
+	je .LB494
+.L1978:
+.L1979:
+	cmpl $990, 4(%rsp)
+	jne .L1980
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1981
+.L1980:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1981:
+	cmpl $991, 4(%rsp)
+	je .LB495
+.L1982:
+.L1983:
+	cmpl $992, 4(%rsp)
+	jne .L1984
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1985
+.L1984:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1985:
+	cmpl $993, 4(%rsp)
+	je .LB496
+.L1986:
+.L1987:
+	cmpl $994, 4(%rsp)
+	jne .L1988
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1989
+.L1988:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1989:
+	cmpl $995, 4(%rsp)
+	je .LB497
+.L1990:
+.L1991:
+	cmpl $996, 4(%rsp)
+	jne .L1992
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1993
+.L1992:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1993:
+	cmpl $997, 4(%rsp)
+	je .LB498
+.L1994:
+.L1995:
+	cmpl $998, 4(%rsp)
+	jne .L1996
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L1997
+.L1996:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L1997:
+	cmpl $999, 4(%rsp)
+	je .LB499
+.L1998:
+.L1999:
+	cmpl $1000, 4(%rsp)
+	jne .L2000
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2001
+.L2000:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2001:
+	cmpl $1001, 4(%rsp)
+	je .LB500
+.L2002:
+.L2003:
+	cmpl $1002, 4(%rsp)
+	jne .L2004
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2005
+.L2004:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2005:
+	cmpl $1003, 4(%rsp)
+	je .LB501
+.L2006:
+.L2007:
+	cmpl $1004, 4(%rsp)
+	jne .L2008
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2009
+.L2008:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2009:
+	cmpl $1005, 4(%rsp)
+	je .LB502
+.L2010:
+.L2011:
+	cmpl $1006, 4(%rsp)
+	jne .L2012
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2013
+.L2012:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2013:
+	cmpl $1007, 4(%rsp)
+	je .LB503
+.L2014:
+.L2015:
+	cmpl $1008, 4(%rsp)
+	jne .L2016
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2017
+.L2016:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2017:
+	cmpl $1009, 4(%rsp)
+	je .LB504
+.L2018:
+.L2019:
+	cmpl $1010, 4(%rsp)
+	jne .L2020
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2021
+.L2020:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2021:
+	cmpl $1011, 4(%rsp)
+	je .LB505
+.L2022:
+.L2023:
+	cmpl $1012, 4(%rsp)
+	jne .L2024
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2025
+.L2024:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2025:
+	cmpl $1013, 4(%rsp)
+	je .LB506
+.L2026:
+.L2027:
+	cmpl $1014, 4(%rsp)
+	jne .L2028
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2029
+.L2028:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2029:
+	cmpl $1015, 4(%rsp)
+	je .LB507
+.L2030:
+.L2031:
+	cmpl $1016, 4(%rsp)
+	jne .L2032
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2033
+.L2032:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2033:
+	cmpl $1017, 4(%rsp)
+	je .LB508
+.L2034:
+.L2035:
+	cmpl $1018, 4(%rsp)
+	jne .L2036
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2037
+.L2036:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2037:
+	cmpl $1019, 4(%rsp)
+	je .LB509
+.L2038:
+.L2039:
+	cmpl $1020, 4(%rsp)
+	jne .L2040
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2041
+.L2040:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2041:
+	cmpl $1021, 4(%rsp)
+	je .LB510
+.L2042:
+.L2043:
+	cmpl $1022, 4(%rsp)
+	jne .L2044
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2045
+.L2044:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2045:
+	cmpl $1023, 4(%rsp)
+	je .LB511
+.L2046:
+.L2047:
+	cmpl $1024, 4(%rsp)
+	jne .L2048
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2049
+.L2048:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2049:
+	cmpl $1025, 4(%rsp)
+	je .LB512
+.L2050:
+.L2051:
+	cmpl $1026, 4(%rsp)
+	jne .L2052
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2053
+.L2052:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2053:
+	cmpl $1027, 4(%rsp)
+	je .LB513
+.L2054:
+.L2055:
+	cmpl $1028, 4(%rsp)
+	jne .L2056
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2057
+.L2056:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2057:
+	cmpl $1029, 4(%rsp)
+	je .LB514
+.L2058:
+.L2059:
+	cmpl $1030, 4(%rsp)
+	jne .L2060
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2061
+.L2060:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2061:
+	cmpl $1031, 4(%rsp)
+	je .LB515
+.L2062:
+.L2063:
+	cmpl $1032, 4(%rsp)
+	jne .L2064
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2065
+.L2064:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2065:
+	cmpl $1033, 4(%rsp)
+	je .LB516
+.L2066:
+.L2067:
+	cmpl $1034, 4(%rsp)
+	jne .L2068
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2069
+.L2068:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2069:
+	cmpl $1035, 4(%rsp)
+	je .LB517
+.L2070:
+.L2071:
+	cmpl $1036, 4(%rsp)
+	jne .L2072
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2073
+.L2072:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2073:
+	cmpl $1037, 4(%rsp)
+	je .LB518
+.L2074:
+.L2075:
+	cmpl $1038, 4(%rsp)
+	jne .L2076
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2077
+.L2076:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2077:
+	cmpl $1039, 4(%rsp)
+	je .LB519
+.L2078:
+.L2079:
+	cmpl $1040, 4(%rsp)
+	jne .L2080
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2081
+.L2080:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2081:
+	cmpl $1041, 4(%rsp)
+	je .LB520
+.L2082:
+.L2083:
+	cmpl $1042, 4(%rsp)
+	jne .L2084
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2085
+.L2084:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2085:
+	cmpl $1043, 4(%rsp)
+	je .LB521
+.L2086:
+.L2087:
+	cmpl $1044, 4(%rsp)
+	jne .L2088
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2089
+.L2088:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2089:
+	cmpl $1045, 4(%rsp)
+	je .LB522
+.L2090:
+.L2091:
+	cmpl $1046, 4(%rsp)
+	jne .L2092
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2093
+.L2092:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2093:
+	cmpl $1047, 4(%rsp)
+	je .LB523
+.L2094:
+.L2095:
+	cmpl $1048, 4(%rsp)
+	jne .L2096
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2097
+.L2096:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2097:
+	cmpl $1049, 4(%rsp)
+	je .LB524
+.L2098:
+.L2099:
+	cmpl $1050, 4(%rsp)
+	jne .L2100
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2101
+.L2100:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2101:
+	cmpl $1051, 4(%rsp)
+	je .LB525
+.L2102:
+.L2103:
+	cmpl $1052, 4(%rsp)
+	jne .L2104
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2105
+.L2104:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2105:
+	cmpl $1053, 4(%rsp)
+	je .LB526
+.L2106:
+.L2107:
+	cmpl $1054, 4(%rsp)
+	jne .L2108
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2109
+.L2108:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2109:
+	cmpl $1055, 4(%rsp)
+	je .LB527
+.L2110:
+.L2111:
+	cmpl $1056, 4(%rsp)
+	jne .L2112
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2113
+.L2112:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2113:
+	cmpl $1057, 4(%rsp)
+	je .LB528
+.L2114:
+.L2115:
+	cmpl $1058, 4(%rsp)
+	jne .L2116
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2117
+.L2116:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2117:
+	cmpl $1059, 4(%rsp)
+	je .LB529
+.L2118:
+.L2119:
+	cmpl $1060, 4(%rsp)
+	jne .L2120
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2121
+.L2120:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2121:
+	cmpl $1061, 4(%rsp)
+	je .LB530
+.L2122:
+.L2123:
+	cmpl $1062, 4(%rsp)
+	jne .L2124
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2125
+.L2124:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2125:
+	cmpl $1063, 4(%rsp)
+	je .LB531
+.L2126:
+.L2127:
+	cmpl $1064, 4(%rsp)
+	jne .L2128
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2129
+.L2128:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2129:
+	cmpl $1065, 4(%rsp)
+	je .LB532
+.L2130:
+.L2131:
+	cmpl $1066, 4(%rsp)
+	jne .L2132
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2133
+.L2132:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2133:
+	cmpl $1067, 4(%rsp)
+	je .LB533
+.L2134:
+.L2135:
+	cmpl $1068, 4(%rsp)
+	jne .L2136
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2137
+.L2136:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2137:
+	cmpl $1069, 4(%rsp)
+	je .LB534
+.L2138:
+.L2139:
+	cmpl $1070, 4(%rsp)
+	jne .L2140
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2141
+.L2140:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2141:
+	cmpl $1071, 4(%rsp)
+	je .LB535
+.L2142:
+.L2143:
+	cmpl $1072, 4(%rsp)
+	jne .L2144
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2145
+.L2144:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2145:
+	cmpl $1073, 4(%rsp)
+	je .LB536
+.L2146:
+.L2147:
+	cmpl $1074, 4(%rsp)
+	jne .L2148
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2149
+.L2148:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2149:
+	cmpl $1075, 4(%rsp)
+	je .LB537
+.L2150:
+.L2151:
+	cmpl $1076, 4(%rsp)
+	jne .L2152
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2153
+.L2152:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2153:
+	cmpl $1077, 4(%rsp)
+	je .LB538
+.L2154:
+.L2155:
+	cmpl $1078, 4(%rsp)
+	jne .L2156
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2157
+.L2156:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2157:
+	cmpl $1079, 4(%rsp)
+	je .LB539
+.L2158:
+.L2159:
+	cmpl $1080, 4(%rsp)
+	jne .L2160
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2161
+.L2160:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2161:
+	cmpl $1081, 4(%rsp)
+	je .LB540
+.L2162:
+.L2163:
+	cmpl $1082, 4(%rsp)
+	jne .L2164
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2165
+.L2164:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2165:
+	cmpl $1083, 4(%rsp)
+	je .LB541
+.L2166:
+.L2167:
+	cmpl $1084, 4(%rsp)
+	jne .L2168
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2169
+.L2168:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2169:
+	cmpl $1085, 4(%rsp)
+	je .LB542
+.L2170:
+.L2171:
+	cmpl $1086, 4(%rsp)
+	jne .L2172
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2173
+.L2172:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2173:
+	cmpl $1087, 4(%rsp)
+	je .LB543
+.L2174:
+.L2175:
+	cmpl $1088, 4(%rsp)
+	jne .L2176
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2177
+.L2176:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2177:
+	cmpl $1089, 4(%rsp)
+	je .LB544
+.L2178:
+.L2179:
+	cmpl $1090, 4(%rsp)
+	jne .L2180
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2181
+.L2180:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2181:
+	cmpl $1091, 4(%rsp)
+	je .LB545
+.L2182:
+.L2183:
+	cmpl $1092, 4(%rsp)
+	jne .L2184
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2185
+.L2184:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2185:
+	cmpl $1093, 4(%rsp)
+	je .LB546
+.L2186:
+.L2187:
+	cmpl $1094, 4(%rsp)
+	jne .L2188
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2189
+.L2188:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2189:
+	cmpl $1095, 4(%rsp)
+	je .LB547
+.L2190:
+.L2191:
+	cmpl $1096, 4(%rsp)
+	jne .L2192
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2193
+.L2192:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2193:
+	cmpl $1097, 4(%rsp)
+	je .LB548
+.L2194:
+.L2195:
+	cmpl $1098, 4(%rsp)
+	jne .L2196
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2197
+.L2196:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2197:
+	cmpl $1099, 4(%rsp)
+	je .LB549
+.L2198:
+.L2199:
+	cmpl $1100, 4(%rsp)
+	jne .L2200
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2201
+.L2200:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2201:
+	cmpl $1101, 4(%rsp)
+	je .LB550
+.L2202:
+.L2203:
+	cmpl $1102, 4(%rsp)
+	jne .L2204
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2205
+.L2204:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2205:
+	cmpl $1103, 4(%rsp)
+	je .LB551
+.L2206:
+.L2207:
+	cmpl $1104, 4(%rsp)
+	jne .L2208
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2209
+.L2208:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2209:
+	cmpl $1105, 4(%rsp)
+	je .LB552
+.L2210:
+.L2211:
+	cmpl $1106, 4(%rsp)
+	jne .L2212
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2213
+.L2212:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2213:
+	cmpl $1107, 4(%rsp)
+	je .LB553
+.L2214:
+.L2215:
+	cmpl $1108, 4(%rsp)
+	jne .L2216
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2217
+.L2216:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2217:
+	cmpl $1109, 4(%rsp)
+	je .LB554
+.L2218:
+.L2219:
+	cmpl $1110, 4(%rsp)
+	jne .L2220
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2221
+.L2220:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2221:
+	cmpl $1111, 4(%rsp)
+	je .LB555
+.L2222:
+.L2223:
+	cmpl $1112, 4(%rsp)
+	jne .L2224
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2225
+.L2224:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2225:
+	cmpl $1113, 4(%rsp)
+	je .LB556
+.L2226:
+.L2227:
+	cmpl $1114, 4(%rsp)
+	jne .L2228
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2229
+.L2228:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2229:
+	cmpl $1115, 4(%rsp)
+	je .LB557
+.L2230:
+.L2231:
+	cmpl $1116, 4(%rsp)
+	jne .L2232
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2233
+.L2232:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2233:
+	cmpl $1117, 4(%rsp)
+	je .LB558
+.L2234:
+.L2235:
+	cmpl $1118, 4(%rsp)
+	jne .L2236
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2237
+.L2236:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2237:
+	cmpl $1119, 4(%rsp)
+	je .LB559
+.L2238:
+.L2239:
+	cmpl $1120, 4(%rsp)
+	jne .L2240
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2241
+.L2240:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2241:
+	cmpl $1121, 4(%rsp)
+	je .LB560
+.L2242:
+.L2243:
+	cmpl $1122, 4(%rsp)
+	jne .L2244
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2245
+.L2244:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2245:
+	cmpl $1123, 4(%rsp)
+	je .LB561
+.L2246:
+.L2247:
+	cmpl $1124, 4(%rsp)
+	jne .L2248
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2249
+.L2248:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2249:
+	cmpl $1125, 4(%rsp)
+	je .LB562
+.L2250:
+.L2251:
+	cmpl $1126, 4(%rsp)
+	jne .L2252
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2253
+.L2252:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2253:
+	cmpl $1127, 4(%rsp)
+	je .LB563
+.L2254:
+.L2255:
+	cmpl $1128, 4(%rsp)
+	jne .L2256
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2257
+.L2256:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2257:
+	cmpl $1129, 4(%rsp)
+	je .LB564
+.L2258:
+.L2259:
+	cmpl $1130, 4(%rsp)
+	jne .L2260
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2261
+.L2260:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2261:
+	cmpl $1131, 4(%rsp)
+	je .LB565
+.L2262:
+.L2263:
+	cmpl $1132, 4(%rsp)
+	jne .L2264
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2265
+.L2264:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2265:
+	cmpl $1133, 4(%rsp)
+	je .LB566
+.L2266:
+.L2267:
+	cmpl $1134, 4(%rsp)
+	jne .L2268
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2269
+.L2268:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2269:
+	cmpl $1135, 4(%rsp)
+	je .LB567
+.L2270:
+.L2271:
+	cmpl $1136, 4(%rsp)
+	jne .L2272
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2273
+.L2272:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2273:
+	cmpl $1137, 4(%rsp)
+	je .LB568
+.L2274:
+.L2275:
+	cmpl $1138, 4(%rsp)
+	jne .L2276
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2277
+.L2276:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2277:
+	cmpl $1139, 4(%rsp)
+	je .LB569
+.L2278:
+.L2279:
+	cmpl $1140, 4(%rsp)
+	jne .L2280
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2281
+.L2280:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2281:
+	cmpl $1141, 4(%rsp)
+	je .LB570
+.L2282:
+.L2283:
+	cmpl $1142, 4(%rsp)
+	jne .L2284
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2285
+.L2284:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2285:
+	cmpl $1143, 4(%rsp)
+	je .LB571
+.L2286:
+.L2287:
+	cmpl $1144, 4(%rsp)
+	jne .L2288
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2289
+.L2288:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2289:
+	cmpl $1145, 4(%rsp)
+	je .LB572
+.L2290:
+.L2291:
+	cmpl $1146, 4(%rsp)
+	jne .L2292
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2293
+.L2292:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2293:
+	cmpl $1147, 4(%rsp)
+	je .LB573
+.L2294:
+.L2295:
+	cmpl $1148, 4(%rsp)
+	jne .L2296
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2297
+.L2296:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2297:
+	cmpl $1149, 4(%rsp)
+	je .LB574
+.L2298:
+.L2299:
+	cmpl $1150, 4(%rsp)
+	jne .L2300
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2301
+.L2300:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2301:
+	cmpl $1151, 4(%rsp)
+	je .LB575
+.L2302:
+.L2303:
+	cmpl $1152, 4(%rsp)
+	jne .L2304
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2305
+.L2304:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2305:
+	cmpl $1153, 4(%rsp)
+	je .LB576
+.L2306:
+.L2307:
+	cmpl $1154, 4(%rsp)
+	jne .L2308
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2309
+.L2308:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2309:
+	cmpl $1155, 4(%rsp)
+	je .LB577
+.L2310:
+.L2311:
+	cmpl $1156, 4(%rsp)
+	jne .L2312
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2313
+.L2312:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2313:
+	cmpl $1157, 4(%rsp)
+	je .LB578
+.L2314:
+.L2315:
+	cmpl $1158, 4(%rsp)
+	jne .L2316
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2317
+.L2316:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2317:
+	cmpl $1159, 4(%rsp)
+	je .LB579
+.L2318:
+.L2319:
+	cmpl $1160, 4(%rsp)
+	jne .L2320
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2321
+.L2320:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2321:
+	cmpl $1161, 4(%rsp)
+	je .LB580
+.L2322:
+.L2323:
+	cmpl $1162, 4(%rsp)
+	jne .L2324
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2325
+.L2324:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2325:
+	cmpl $1163, 4(%rsp)
+	je .LB581
+.L2326:
+.L2327:
+	cmpl $1164, 4(%rsp)
+	jne .L2328
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2329
+.L2328:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2329:
+	cmpl $1165, 4(%rsp)
+	je .LB582
+.L2330:
+.L2331:
+	cmpl $1166, 4(%rsp)
+	jne .L2332
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2333
+.L2332:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2333:
+	cmpl $1167, 4(%rsp)
+	je .LB583
+.L2334:
+.L2335:
+	cmpl $1168, 4(%rsp)
+	jne .L2336
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2337
+.L2336:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2337:
+	cmpl $1169, 4(%rsp)
+	je .LB584
+.L2338:
+.L2339:
+	cmpl $1170, 4(%rsp)
+	jne .L2340
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2341
+.L2340:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2341:
+	cmpl $1171, 4(%rsp)
+	je .LB585
+.L2342:
+.L2343:
+	cmpl $1172, 4(%rsp)
+	jne .L2344
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2345
+.L2344:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2345:
+	cmpl $1173, 4(%rsp)
+	je .LB586
+.L2346:
+.L2347:
+	cmpl $1174, 4(%rsp)
+	jne .L2348
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2349
+.L2348:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2349:
+	cmpl $1175, 4(%rsp)
+	je .LB587
+.L2350:
+.L2351:
+	cmpl $1176, 4(%rsp)
+	jne .L2352
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2353
+.L2352:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2353:
+	cmpl $1177, 4(%rsp)
+	je .LB588
+.L2354:
+.L2355:
+	cmpl $1178, 4(%rsp)
+	jne .L2356
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2357
+.L2356:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2357:
+	cmpl $1179, 4(%rsp)
+	je .LB589
+.L2358:
+.L2359:
+	cmpl $1180, 4(%rsp)
+	jne .L2360
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2361
+.L2360:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2361:
+	cmpl $1181, 4(%rsp)
+	je .LB590
+.L2362:
+.L2363:
+	cmpl $1182, 4(%rsp)
+	jne .L2364
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2365
+.L2364:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2365:
+	cmpl $1183, 4(%rsp)
+	je .LB591
+.L2366:
+.L2367:
+	cmpl $1184, 4(%rsp)
+	jne .L2368
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2369
+.L2368:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2369:
+	cmpl $1185, 4(%rsp)
+	je .LB592
+.L2370:
+.L2371:
+	cmpl $1186, 4(%rsp)
+	jne .L2372
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2373
+.L2372:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2373:
+	cmpl $1187, 4(%rsp)
+	je .LB593
+.L2374:
+.L2375:
+	cmpl $1188, 4(%rsp)
+	jne .L2376
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2377
+.L2376:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2377:
+	cmpl $1189, 4(%rsp)
+	je .LB594
+.L2378:
+.L2379:
+	cmpl $1190, 4(%rsp)
+	jne .L2380
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2381
+.L2380:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2381:
+	cmpl $1191, 4(%rsp)
+	je .LB595
+.L2382:
+.L2383:
+	cmpl $1192, 4(%rsp)
+	jne .L2384
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2385
+.L2384:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2385:
+	cmpl $1193, 4(%rsp)
+	je .LB596
+.L2386:
+.L2387:
+	cmpl $1194, 4(%rsp)
+	jne .L2388
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2389
+.L2388:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2389:
+	cmpl $1195, 4(%rsp)
+	je .LB597
+.L2390:
+.L2391:
+	cmpl $1196, 4(%rsp)
+	jne .L2392
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2393
+.L2392:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2393:
+	cmpl $1197, 4(%rsp)
+	je .LB598
+.L2394:
+.L2395:
+	cmpl $1198, 4(%rsp)
+	jne .L2396
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2397
+.L2396:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2397:
+	cmpl $1199, 4(%rsp)
+	je .LB599
+.L2398:
+.L2399:
+	cmpl $1200, 4(%rsp)
+	jne .L2400
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2401
+.L2400:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2401:
+	cmpl $1201, 4(%rsp)
+	je .LB600
+.L2402:
+.L2403:
+	cmpl $1202, 4(%rsp)
+	jne .L2404
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2405
+.L2404:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2405:
+	cmpl $1203, 4(%rsp)
+	je .LB601
+.L2406:
+.L2407:
+	cmpl $1204, 4(%rsp)
+	jne .L2408
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2409
+.L2408:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2409:
+	cmpl $1205, 4(%rsp)
+	je .LB602
+.L2410:
+.L2411:
+	cmpl $1206, 4(%rsp)
+	jne .L2412
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2413
+.L2412:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2413:
+	cmpl $1207, 4(%rsp)
+	je .LB603
+.L2414:
+.L2415:
+	cmpl $1208, 4(%rsp)
+	jne .L2416
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2417
+.L2416:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2417:
+	cmpl $1209, 4(%rsp)
+	je .LB604
+.L2418:
+.L2419:
+	cmpl $1210, 4(%rsp)
+	jne .L2420
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2421
+.L2420:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2421:
+	cmpl $1211, 4(%rsp)
+	je .LB605
+.L2422:
+.L2423:
+	cmpl $1212, 4(%rsp)
+	jne .L2424
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2425
+.L2424:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2425:
+	cmpl $1213, 4(%rsp)
+	je .LB606
+.L2426:
+.L2427:
+	cmpl $1214, 4(%rsp)
+	jne .L2428
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2429
+.L2428:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2429:
+	cmpl $1215, 4(%rsp)
+	je .LB607
+.L2430:
+.L2431:
+	cmpl $1216, 4(%rsp)
+	jne .L2432
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2433
+.L2432:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2433:
+	cmpl $1217, 4(%rsp)
+	je .LB608
+.L2434:
+.L2435:
+	cmpl $1218, 4(%rsp)
+	jne .L2436
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2437
+.L2436:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2437:
+	cmpl $1219, 4(%rsp)
+	je .LB609
+.L2438:
+.L2439:
+	cmpl $1220, 4(%rsp)
+	jne .L2440
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2441
+.L2440:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2441:
+	cmpl $1221, 4(%rsp)
+	je .LB610
+.L2442:
+.L2443:
+	cmpl $1222, 4(%rsp)
+	jne .L2444
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2445
+.L2444:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2445:
+	cmpl $1223, 4(%rsp)
+	je .LB611
+.L2446:
+.L2447:
+	cmpl $1224, 4(%rsp)
+	jne .L2448
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2449
+.L2448:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2449:
+	cmpl $1225, 4(%rsp)
+	je .LB612
+.L2450:
+.L2451:
+	cmpl $1226, 4(%rsp)
+	jne .L2452
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2453
+.L2452:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2453:
+	cmpl $1227, 4(%rsp)
+	je .LB613
+.L2454:
+.L2455:
+	cmpl $1228, 4(%rsp)
+	jne .L2456
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2457
+.L2456:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2457:
+	cmpl $1229, 4(%rsp)
+	je .LB614
+.L2458:
+.L2459:
+	cmpl $1230, 4(%rsp)
+	jne .L2460
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2461
+.L2460:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2461:
+	cmpl $1231, 4(%rsp)
+	je .LB615
+.L2462:
+.L2463:
+	cmpl $1232, 4(%rsp)
+	jne .L2464
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2465
+.L2464:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2465:
+	cmpl $1233, 4(%rsp)
+	je .LB616
+.L2466:
+.L2467:
+	cmpl $1234, 4(%rsp)
+	jne .L2468
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2469
+.L2468:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2469:
+	cmpl $1235, 4(%rsp)
+	je .LB617
+.L2470:
+.L2471:
+	cmpl $1236, 4(%rsp)
+	jne .L2472
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2473
+.L2472:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2473:
+	cmpl $1237, 4(%rsp)
+	je .LB618
+.L2474:
+.L2475:
+	cmpl $1238, 4(%rsp)
+	jne .L2476
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2477
+.L2476:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2477:
+	cmpl $1239, 4(%rsp)
+	je .LB619
+.L2478:
+.L2479:
+	cmpl $1240, 4(%rsp)
+	jne .L2480
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2481
+.L2480:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2481:
+	cmpl $1241, 4(%rsp)
+	je .LB620
+.L2482:
+.L2483:
+	cmpl $1242, 4(%rsp)
+	jne .L2484
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2485
+.L2484:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2485:
+	cmpl $1243, 4(%rsp)
+	je .LB621
+.L2486:
+.L2487:
+	cmpl $1244, 4(%rsp)
+	jne .L2488
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2489
+.L2488:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2489:
+	cmpl $1245, 4(%rsp)
+	je .LB622
+.L2490:
+.L2491:
+	cmpl $1246, 4(%rsp)
+	jne .L2492
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2493
+.L2492:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2493:
+	cmpl $1247, 4(%rsp)
+	je .LB623
+.L2494:
+.L2495:
+	cmpl $1248, 4(%rsp)
+	jne .L2496
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2497
+.L2496:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2497:
+	cmpl $1249, 4(%rsp)
+	je .LB624
+.L2498:
+.L2499:
+	cmpl $1250, 4(%rsp)
+	jne .L2500
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2501
+.L2500:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2501:
+	cmpl $1251, 4(%rsp)
+	je .LB625
+.L2502:
+.L2503:
+	cmpl $1252, 4(%rsp)
+	jne .L2504
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2505
+.L2504:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2505:
+	cmpl $1253, 4(%rsp)
+	je .LB626
+.L2506:
+.L2507:
+	cmpl $1254, 4(%rsp)
+	jne .L2508
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2509
+.L2508:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2509:
+	cmpl $1255, 4(%rsp)
+	je .LB627
+.L2510:
+.L2511:
+	cmpl $1256, 4(%rsp)
+	jne .L2512
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2513
+.L2512:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2513:
+	cmpl $1257, 4(%rsp)
+	je .LB628
+.L2514:
+.L2515:
+	cmpl $1258, 4(%rsp)
+	jne .L2516
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2517
+.L2516:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2517:
+	cmpl $1259, 4(%rsp)
+	je .LB629
+.L2518:
+.L2519:
+	cmpl $1260, 4(%rsp)
+	jne .L2520
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2521
+.L2520:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2521:
+	cmpl $1261, 4(%rsp)
+	je .LB630
+.L2522:
+.L2523:
+	cmpl $1262, 4(%rsp)
+	jne .L2524
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2525
+.L2524:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2525:
+	cmpl $1263, 4(%rsp)
+	je .LB631
+.L2526:
+.L2527:
+	cmpl $1264, 4(%rsp)
+	jne .L2528
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2529
+.L2528:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2529:
+	cmpl $1265, 4(%rsp)
+	je .LB632
+.L2530:
+.L2531:
+	cmpl $1266, 4(%rsp)
+	jne .L2532
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2533
+.L2532:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2533:
+	cmpl $1267, 4(%rsp)
+	je .LB633
+.L2534:
+.L2535:
+	cmpl $1268, 4(%rsp)
+	jne .L2536
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2537
+.L2536:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2537:
+	cmpl $1269, 4(%rsp)
+	je .LB634
+.L2538:
+.L2539:
+	cmpl $1270, 4(%rsp)
+	jne .L2540
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2541
+.L2540:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2541:
+	cmpl $1271, 4(%rsp)
+	je .LB635
+.L2542:
+.L2543:
+	cmpl $1272, 4(%rsp)
+	jne .L2544
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2545
+.L2544:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2545:
+	cmpl $1273, 4(%rsp)
+	je .LB636
+.L2546:
+.L2547:
+	cmpl $1274, 4(%rsp)
+	jne .L2548
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2549
+.L2548:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2549:
+	cmpl $1275, 4(%rsp)
+	je .LB637
+.L2550:
+.L2551:
+	cmpl $1276, 4(%rsp)
+	jne .L2552
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2553
+.L2552:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2553:
+	cmpl $1277, 4(%rsp)
+	je .LB638
+.L2554:
+.L2555:
+	cmpl $1278, 4(%rsp)
+	jne .L2556
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2557
+.L2556:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2557:
+	cmpl $1279, 4(%rsp)
+	je .LB639
+.L2558:
+.L2559:
+	cmpl $1280, 4(%rsp)
+	jne .L2560
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2561
+.L2560:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2561:
+	cmpl $1281, 4(%rsp)
+	je .LB640
+.L2562:
+.L2563:
+	cmpl $1282, 4(%rsp)
+	jne .L2564
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2565
+.L2564:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2565:
+	cmpl $1283, 4(%rsp)
+	je .LB641
+.L2566:
+.L2567:
+	cmpl $1284, 4(%rsp)
+	jne .L2568
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2569
+.L2568:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2569:
+	cmpl $1285, 4(%rsp)
+	je .LB642
+.L2570:
+.L2571:
+	cmpl $1286, 4(%rsp)
+	jne .L2572
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2573
+.L2572:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2573:
+	cmpl $1287, 4(%rsp)
+	je .LB643
+.L2574:
+.L2575:
+	cmpl $1288, 4(%rsp)
+	jne .L2576
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2577
+.L2576:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2577:
+	cmpl $1289, 4(%rsp)
+	je .LB644
+.L2578:
+.L2579:
+	cmpl $1290, 4(%rsp)
+	jne .L2580
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2581
+.L2580:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2581:
+	cmpl $1291, 4(%rsp)
+	je .LB645
+.L2582:
+.L2583:
+	cmpl $1292, 4(%rsp)
+	jne .L2584
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2585
+.L2584:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2585:
+	cmpl $1293, 4(%rsp)
+	je .LB646
+.L2586:
+.L2587:
+	cmpl $1294, 4(%rsp)
+	jne .L2588
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2589
+.L2588:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2589:
+	cmpl $1295, 4(%rsp)
+	je .LB647
+.L2590:
+.L2591:
+	cmpl $1296, 4(%rsp)
+	jne .L2592
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2593
+.L2592:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2593:
+	cmpl $1297, 4(%rsp)
+	je .LB648
+.L2594:
+.L2595:
+	cmpl $1298, 4(%rsp)
+	jne .L2596
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2597
+.L2596:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2597:
+	cmpl $1299, 4(%rsp)
+	je .LB649
+.L2598:
+.L2599:
+	cmpl $1300, 4(%rsp)
+	jne .L2600
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2601
+.L2600:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2601:
+	cmpl $1301, 4(%rsp)
+	je .LB650
+.L2602:
+.L2603:
+	cmpl $1302, 4(%rsp)
+	jne .L2604
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2605
+.L2604:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2605:
+	cmpl $1303, 4(%rsp)
+	je .LB651
+.L2606:
+.L2607:
+	cmpl $1304, 4(%rsp)
+	jne .L2608
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2609
+.L2608:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2609:
+	cmpl $1305, 4(%rsp)
+	je .LB652
+.L2610:
+.L2611:
+	cmpl $1306, 4(%rsp)
+	jne .L2612
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2613
+.L2612:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2613:
+	cmpl $1307, 4(%rsp)
+	je .LB653
+.L2614:
+.L2615:
+	cmpl $1308, 4(%rsp)
+	jne .L2616
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2617
+.L2616:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2617:
+	cmpl $1309, 4(%rsp)
+	je .LB654
+.L2618:
+.L2619:
+	cmpl $1310, 4(%rsp)
+	jne .L2620
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2621
+.L2620:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2621:
+	cmpl $1311, 4(%rsp)
+	je .LB655
+.L2622:
+.L2623:
+	cmpl $1312, 4(%rsp)
+	jne .L2624
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2625
+.L2624:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2625:
+	cmpl $1313, 4(%rsp)
+	je .LB656
+.L2626:
+.L2627:
+	cmpl $1314, 4(%rsp)
+	jne .L2628
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2629
+.L2628:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2629:
+	cmpl $1315, 4(%rsp)
+	je .LB657
+.L2630:
+.L2631:
+	cmpl $1316, 4(%rsp)
+	jne .L2632
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2633
+.L2632:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2633:
+	cmpl $1317, 4(%rsp)
+	je .LB658
+.L2634:
+.L2635:
+	cmpl $1318, 4(%rsp)
+	jne .L2636
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2637
+.L2636:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2637:
+	cmpl $1319, 4(%rsp)
+	je .LB659
+.L2638:
+.L2639:
+	cmpl $1320, 4(%rsp)
+	jne .L2640
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2641
+.L2640:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2641:
+	cmpl $1321, 4(%rsp)
+	je .LB660
+.L2642:
+.L2643:
+	cmpl $1322, 4(%rsp)
+	jne .L2644
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2645
+.L2644:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2645:
+	cmpl $1323, 4(%rsp)
+	je .LB661
+.L2646:
+.L2647:
+	cmpl $1324, 4(%rsp)
+	jne .L2648
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2649
+.L2648:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2649:
+	cmpl $1325, 4(%rsp)
+	je .LB662
+.L2650:
+.L2651:
+	cmpl $1326, 4(%rsp)
+	jne .L2652
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2653
+.L2652:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2653:
+	cmpl $1327, 4(%rsp)
+	je .LB663
+.L2654:
+.L2655:
+	cmpl $1328, 4(%rsp)
+	jne .L2656
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2657
+.L2656:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2657:
+	cmpl $1329, 4(%rsp)
+	je .LB664
+.L2658:
+.L2659:
+	cmpl $1330, 4(%rsp)
+	jne .L2660
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2661
+.L2660:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2661:
+	cmpl $1331, 4(%rsp)
+	je .LB665
+.L2662:
+.L2663:
+	cmpl $1332, 4(%rsp)
+	jne .L2664
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2665
+.L2664:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2665:
+	cmpl $1333, 4(%rsp)
+	je .LB666
+.L2666:
+.L2667:
+	cmpl $1334, 4(%rsp)
+	jne .L2668
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2669
+.L2668:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2669:
+	cmpl $1335, 4(%rsp)
+	je .LB667
+.L2670:
+.L2671:
+	cmpl $1336, 4(%rsp)
+	jne .L2672
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2673
+.L2672:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2673:
+	cmpl $1337, 4(%rsp)
+	je .LB668
+.L2674:
+.L2675:
+	cmpl $1338, 4(%rsp)
+	jne .L2676
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2677
+.L2676:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2677:
+	cmpl $1339, 4(%rsp)
+	je .LB669
+.L2678:
+.L2679:
+	cmpl $1340, 4(%rsp)
+	jne .L2680
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2681
+.L2680:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2681:
+	cmpl $1341, 4(%rsp)
+	je .LB670
+.L2682:
+.L2683:
+	cmpl $1342, 4(%rsp)
+	jne .L2684
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2685
+.L2684:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2685:
+	cmpl $1343, 4(%rsp)
+	je .LB671
+.L2686:
+.L2687:
+	cmpl $1344, 4(%rsp)
+	jne .L2688
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2689
+.L2688:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2689:
+	cmpl $1345, 4(%rsp)
+	je .LB672
+.L2690:
+.L2691:
+	cmpl $1346, 4(%rsp)
+	jne .L2692
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2693
+.L2692:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2693:
+	cmpl $1347, 4(%rsp)
+	je .LB673
+.L2694:
+.L2695:
+	cmpl $1348, 4(%rsp)
+	jne .L2696
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2697
+.L2696:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2697:
+	cmpl $1349, 4(%rsp)
+	je .LB674
+.L2698:
+.L2699:
+	cmpl $1350, 4(%rsp)
+	jne .L2700
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2701
+.L2700:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2701:
+	cmpl $1351, 4(%rsp)
+	je .LB675
+.L2702:
+.L2703:
+	cmpl $1352, 4(%rsp)
+	jne .L2704
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2705
+.L2704:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2705:
+	cmpl $1353, 4(%rsp)
+	je .LB676
+.L2706:
+.L2707:
+	cmpl $1354, 4(%rsp)
+	jne .L2708
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2709
+.L2708:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2709:
+	cmpl $1355, 4(%rsp)
+	je .LB677
+.L2710:
+.L2711:
+	cmpl $1356, 4(%rsp)
+	jne .L2712
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2713
+.L2712:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2713:
+	cmpl $1357, 4(%rsp)
+	je .LB678
+.L2714:
+.L2715:
+	cmpl $1358, 4(%rsp)
+	jne .L2716
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2717
+.L2716:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2717:
+	cmpl $1359, 4(%rsp)
+	je .LB679
+.L2718:
+.L2719:
+	cmpl $1360, 4(%rsp)
+	jne .L2720
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2721
+.L2720:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2721:
+	cmpl $1361, 4(%rsp)
+	je .LB680
+.L2722:
+.L2723:
+	cmpl $1362, 4(%rsp)
+	jne .L2724
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2725
+.L2724:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2725:
+	cmpl $1363, 4(%rsp)
+	je .LB681
+.L2726:
+.L2727:
+	cmpl $1364, 4(%rsp)
+	jne .L2728
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2729
+.L2728:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2729:
+	cmpl $1365, 4(%rsp)
+	je .LB682
+.L2730:
+.L2731:
+	cmpl $1366, 4(%rsp)
+	jne .L2732
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2733
+.L2732:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2733:
+	cmpl $1367, 4(%rsp)
+	je .LB683
+.L2734:
+.L2735:
+	cmpl $1368, 4(%rsp)
+	jne .L2736
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2737
+.L2736:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2737:
+	cmpl $1369, 4(%rsp)
+	je .LB684
+.L2738:
+.L2739:
+	cmpl $1370, 4(%rsp)
+	jne .L2740
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2741
+.L2740:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2741:
+	cmpl $1371, 4(%rsp)
+	je .LB685
+.L2742:
+.L2743:
+	cmpl $1372, 4(%rsp)
+	jne .L2744
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2745
+.L2744:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2745:
+	cmpl $1373, 4(%rsp)
+	je .LB686
+.L2746:
+.L2747:
+	cmpl $1374, 4(%rsp)
+	jne .L2748
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2749
+.L2748:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2749:
+	cmpl $1375, 4(%rsp)
+	je .LB687
+.L2750:
+.L2751:
+	cmpl $1376, 4(%rsp)
+	jne .L2752
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2753
+.L2752:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2753:
+	cmpl $1377, 4(%rsp)
+	je .LB688
+.L2754:
+.L2755:
+	cmpl $1378, 4(%rsp)
+	jne .L2756
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2757
+.L2756:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2757:
+	cmpl $1379, 4(%rsp)
+	je .LB689
+.L2758:
+.L2759:
+	cmpl $1380, 4(%rsp)
+	jne .L2760
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2761
+.L2760:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2761:
+	cmpl $1381, 4(%rsp)
+	je .LB690
+.L2762:
+.L2763:
+	cmpl $1382, 4(%rsp)
+	jne .L2764
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2765
+.L2764:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2765:
+	cmpl $1383, 4(%rsp)
+	je .LB691
+.L2766:
+.L2767:
+	cmpl $1384, 4(%rsp)
+	jne .L2768
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2769
+.L2768:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2769:
+	cmpl $1385, 4(%rsp)
+	je .LB692
+.L2770:
+.L2771:
+	cmpl $1386, 4(%rsp)
+	jne .L2772
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2773
+.L2772:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2773:
+	cmpl $1387, 4(%rsp)
+	je .LB693
+.L2774:
+.L2775:
+	cmpl $1388, 4(%rsp)
+	jne .L2776
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2777
+.L2776:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2777:
+	cmpl $1389, 4(%rsp)
+	je .LB694
+.L2778:
+.L2779:
+	cmpl $1390, 4(%rsp)
+	jne .L2780
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2781
+.L2780:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2781:
+	cmpl $1391, 4(%rsp)
+	je .LB695
+.L2782:
+.L2783:
+	cmpl $1392, 4(%rsp)
+	jne .L2784
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2785
+.L2784:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2785:
+	cmpl $1393, 4(%rsp)
+	je .LB696
+.L2786:
+.L2787:
+	cmpl $1394, 4(%rsp)
+	jne .L2788
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2789
+.L2788:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2789:
+	cmpl $1395, 4(%rsp)
+	je .LB697
+.L2790:
+.L2791:
+	cmpl $1396, 4(%rsp)
+	jne .L2792
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2793
+.L2792:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2793:
+	cmpl $1397, 4(%rsp)
+	je .LB698
+.L2794:
+.L2795:
+	cmpl $1398, 4(%rsp)
+	jne .L2796
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2797
+.L2796:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2797:
+	cmpl $1399, 4(%rsp)
+	je .LB699
+.L2798:
+.L2799:
+	cmpl $1400, 4(%rsp)
+	jne .L2800
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2801
+.L2800:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2801:
+	cmpl $1401, 4(%rsp)
+	je .LB700
+.L2802:
+.L2803:
+	cmpl $1402, 4(%rsp)
+	jne .L2804
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2805
+.L2804:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2805:
+	cmpl $1403, 4(%rsp)
+	je .LB701
+.L2806:
+.L2807:
+	cmpl $1404, 4(%rsp)
+	jne .L2808
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2809
+.L2808:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2809:
+	cmpl $1405, 4(%rsp)
+	je .LB702
+.L2810:
+.L2811:
+	cmpl $1406, 4(%rsp)
+	jne .L2812
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2813
+.L2812:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2813:
+	cmpl $1407, 4(%rsp)
+	je .LB703
+.L2814:
+.L2815:
+	cmpl $1408, 4(%rsp)
+	jne .L2816
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2817
+.L2816:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2817:
+	cmpl $1409, 4(%rsp)
+	je .LB704
+.L2818:
+.L2819:
+	cmpl $1410, 4(%rsp)
+	jne .L2820
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2821
+.L2820:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2821:
+	cmpl $1411, 4(%rsp)
+	je .LB705
+.L2822:
+.L2823:
+	cmpl $1412, 4(%rsp)
+	jne .L2824
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2825
+.L2824:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2825:
+	cmpl $1413, 4(%rsp)
+	je .LB706
+.L2826:
+.L2827:
+	cmpl $1414, 4(%rsp)
+	jne .L2828
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2829
+.L2828:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2829:
+	cmpl $1415, 4(%rsp)
+	je .LB707
+.L2830:
+.L2831:
+	cmpl $1416, 4(%rsp)
+	jne .L2832
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2833
+.L2832:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2833:
+	cmpl $1417, 4(%rsp)
+	je .LB708
+.L2834:
+.L2835:
+	cmpl $1418, 4(%rsp)
+	jne .L2836
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2837
+.L2836:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2837:
+	cmpl $1419, 4(%rsp)
+	je .LB709
+.L2838:
+.L2839:
+	cmpl $1420, 4(%rsp)
+	jne .L2840
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2841
+.L2840:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2841:
+	cmpl $1421, 4(%rsp)
+	je .LB710
+.L2842:
+.L2843:
+	cmpl $1422, 4(%rsp)
+	jne .L2844
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2845
+.L2844:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2845:
+	cmpl $1423, 4(%rsp)
+	je .LB711
+.L2846:
+.L2847:
+	cmpl $1424, 4(%rsp)
+	jne .L2848
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2849
+.L2848:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2849:
+	cmpl $1425, 4(%rsp)
+	je .LB712
+.L2850:
+.L2851:
+	cmpl $1426, 4(%rsp)
+	jne .L2852
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2853
+.L2852:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2853:
+	cmpl $1427, 4(%rsp)
+	je .LB713
+.L2854:
+.L2855:
+	cmpl $1428, 4(%rsp)
+	jne .L2856
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2857
+.L2856:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2857:
+	cmpl $1429, 4(%rsp)
+	je .LB714
+.L2858:
+.L2859:
+	cmpl $1430, 4(%rsp)
+	jne .L2860
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2861
+.L2860:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2861:
+	cmpl $1431, 4(%rsp)
+	je .LB715
+.L2862:
+.L2863:
+	cmpl $1432, 4(%rsp)
+	jne .L2864
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2865
+.L2864:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2865:
+	cmpl $1433, 4(%rsp)
+	je .LB716
+.L2866:
+.L2867:
+	cmpl $1434, 4(%rsp)
+	jne .L2868
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2869
+.L2868:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2869:
+	cmpl $1435, 4(%rsp)
+	je .LB717
+.L2870:
+.L2871:
+	cmpl $1436, 4(%rsp)
+	jne .L2872
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2873
+.L2872:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2873:
+	cmpl $1437, 4(%rsp)
+	je .LB718
+.L2874:
+.L2875:
+	cmpl $1438, 4(%rsp)
+	jne .L2876
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2877
+.L2876:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2877:
+	cmpl $1439, 4(%rsp)
+	je .LB719
+.L2878:
+.L2879:
+	cmpl $1440, 4(%rsp)
+	jne .L2880
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2881
+.L2880:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2881:
+	cmpl $1441, 4(%rsp)
+	je .LB720
+.L2882:
+.L2883:
+	cmpl $1442, 4(%rsp)
+	jne .L2884
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2885
+.L2884:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2885:
+	cmpl $1443, 4(%rsp)
+	je .LB721
+.L2886:
+.L2887:
+	cmpl $1444, 4(%rsp)
+	jne .L2888
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2889
+.L2888:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2889:
+	cmpl $1445, 4(%rsp)
+	je .LB722
+.L2890:
+.L2891:
+	cmpl $1446, 4(%rsp)
+	jne .L2892
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2893
+.L2892:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2893:
+	cmpl $1447, 4(%rsp)
+	je .LB723
+.L2894:
+.L2895:
+	cmpl $1448, 4(%rsp)
+	jne .L2896
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2897
+.L2896:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2897:
+	cmpl $1449, 4(%rsp)
+	je .LB724
+.L2898:
+.L2899:
+	cmpl $1450, 4(%rsp)
+	jne .L2900
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2901
+.L2900:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2901:
+	cmpl $1451, 4(%rsp)
+	je .LB725
+.L2902:
+.L2903:
+	cmpl $1452, 4(%rsp)
+	jne .L2904
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2905
+.L2904:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2905:
+	cmpl $1453, 4(%rsp)
+	je .LB726
+.L2906:
+.L2907:
+	cmpl $1454, 4(%rsp)
+	jne .L2908
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2909
+.L2908:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2909:
+	cmpl $1455, 4(%rsp)
+	je .LB727
+.L2910:
+.L2911:
+	cmpl $1456, 4(%rsp)
+	jne .L2912
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2913
+.L2912:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2913:
+	cmpl $1457, 4(%rsp)
+	je .LB728
+.L2914:
+.L2915:
+	cmpl $1458, 4(%rsp)
+	jne .L2916
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2917
+.L2916:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2917:
+	cmpl $1459, 4(%rsp)
+	je .LB729
+.L2918:
+.L2919:
+	cmpl $1460, 4(%rsp)
+	jne .L2920
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2921
+.L2920:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2921:
+	cmpl $1461, 4(%rsp)
+	je .LB730
+.L2922:
+.L2923:
+	cmpl $1462, 4(%rsp)
+	jne .L2924
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2925
+.L2924:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2925:
+	cmpl $1463, 4(%rsp)
+	je .LB731
+.L2926:
+.L2927:
+	cmpl $1464, 4(%rsp)
+	jne .L2928
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2929
+.L2928:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2929:
+	cmpl $1465, 4(%rsp)
+	je .LB732
+.L2930:
+.L2931:
+	cmpl $1466, 4(%rsp)
+	jne .L2932
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2933
+.L2932:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2933:
+	cmpl $1467, 4(%rsp)
+	je .LB733
+.L2934:
+.L2935:
+	cmpl $1468, 4(%rsp)
+	jne .L2936
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2937
+.L2936:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2937:
+	cmpl $1469, 4(%rsp)
+	je .LB734
+.L2938:
+.L2939:
+	cmpl $1470, 4(%rsp)
+	jne .L2940
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2941
+.L2940:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2941:
+	cmpl $1471, 4(%rsp)
+	je .LB735
+.L2942:
+.L2943:
+	cmpl $1472, 4(%rsp)
+	jne .L2944
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2945
+.L2944:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2945:
+	cmpl $1473, 4(%rsp)
+	je .LB736
+.L2946:
+.L2947:
+	cmpl $1474, 4(%rsp)
+	jne .L2948
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2949
+.L2948:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2949:
+	cmpl $1475, 4(%rsp)
+	je .LB737
+.L2950:
+.L2951:
+	cmpl $1476, 4(%rsp)
+	jne .L2952
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2953
+.L2952:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2953:
+	cmpl $1477, 4(%rsp)
+	je .LB738
+.L2954:
+.L2955:
+	cmpl $1478, 4(%rsp)
+	jne .L2956
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2957
+.L2956:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2957:
+	cmpl $1479, 4(%rsp)
+	je .LB739
+.L2958:
+.L2959:
+	cmpl $1480, 4(%rsp)
+	jne .L2960
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2961
+.L2960:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2961:
+	cmpl $1481, 4(%rsp)
+	je .LB740
+.L2962:
+.L2963:
+	cmpl $1482, 4(%rsp)
+	jne .L2964
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2965
+.L2964:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2965:
+	cmpl $1483, 4(%rsp)
+	je .LB741
+.L2966:
+.L2967:
+	cmpl $1484, 4(%rsp)
+	jne .L2968
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2969
+.L2968:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2969:
+	cmpl $1485, 4(%rsp)
+	je .LB742
+.L2970:
+.L2971:
+	cmpl $1486, 4(%rsp)
+	jne .L2972
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2973
+.L2972:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2973:
+	cmpl $1487, 4(%rsp)
+	je .LB743
+.L2974:
+.L2975:
+	cmpl $1488, 4(%rsp)
+	jne .L2976
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2977
+.L2976:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2977:
+	cmpl $1489, 4(%rsp)
+	je .LB744
+.L2978:
+.L2979:
+	cmpl $1490, 4(%rsp)
+	jne .L2980
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2981
+.L2980:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2981:
+	cmpl $1491, 4(%rsp)
+	je .LB745
+.L2982:
+.L2983:
+	cmpl $1492, 4(%rsp)
+	jne .L2984
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2985
+.L2984:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2985:
+	cmpl $1493, 4(%rsp)
+	je .LB746
+.L2986:
+.L2987:
+	cmpl $1494, 4(%rsp)
+	jne .L2988
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2989
+.L2988:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2989:
+	cmpl $1495, 4(%rsp)
+	je .LB747
+.L2990:
+.L2991:
+	cmpl $1496, 4(%rsp)
+	jne .L2992
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2993
+.L2992:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2993:
+	cmpl $1497, 4(%rsp)
+	je .LB748
+.L2994:
+.L2995:
+	cmpl $1498, 4(%rsp)
+	jne .L2996
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L2997
+.L2996:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L2997:
+	cmpl $1499, 4(%rsp)
+	je .LB749
+.L2998:
+.L2999:
+	cmpl $1500, 4(%rsp)
+	jne .L3000
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3001
+.L3000:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3001:
+	cmpl $1501, 4(%rsp)
+	je .LB750
+.L3002:
+.L3003:
+	cmpl $1502, 4(%rsp)
+	jne .L3004
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3005
+.L3004:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3005:
+	cmpl $1503, 4(%rsp)
+	je .LB751
+.L3006:
+.L3007:
+	cmpl $1504, 4(%rsp)
+	jne .L3008
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3009
+.L3008:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3009:
+	cmpl $1505, 4(%rsp)
+	je .LB752
+.L3010:
+.L3011:
+	cmpl $1506, 4(%rsp)
+	jne .L3012
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3013
+.L3012:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3013:
+	cmpl $1507, 4(%rsp)
+	je .LB753
+.L3014:
+.L3015:
+	cmpl $1508, 4(%rsp)
+	jne .L3016
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3017
+.L3016:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3017:
+	cmpl $1509, 4(%rsp)
+	je .LB754
+.L3018:
+.L3019:
+	cmpl $1510, 4(%rsp)
+	jne .L3020
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3021
+.L3020:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3021:
+	cmpl $1511, 4(%rsp)
+	je .LB755
+.L3022:
+.L3023:
+	cmpl $1512, 4(%rsp)
+	jne .L3024
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3025
+.L3024:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3025:
+	cmpl $1513, 4(%rsp)
+	je .LB756
+.L3026:
+.L3027:
+	cmpl $1514, 4(%rsp)
+	jne .L3028
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3029
+.L3028:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3029:
+	cmpl $1515, 4(%rsp)
+	je .LB757
+.L3030:
+.L3031:
+	cmpl $1516, 4(%rsp)
+	jne .L3032
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3033
+.L3032:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3033:
+	cmpl $1517, 4(%rsp)
+	je .LB758
+.L3034:
+.L3035:
+	cmpl $1518, 4(%rsp)
+	jne .L3036
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3037
+.L3036:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3037:
+	cmpl $1519, 4(%rsp)
+	je .LB759
+.L3038:
+.L3039:
+	cmpl $1520, 4(%rsp)
+	jne .L3040
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3041
+.L3040:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3041:
+	cmpl $1521, 4(%rsp)
+	je .LB760
+.L3042:
+.L3043:
+	cmpl $1522, 4(%rsp)
+	jne .L3044
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3045
+.L3044:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3045:
+	cmpl $1523, 4(%rsp)
+	je .LB761
+.L3046:
+.L3047:
+	cmpl $1524, 4(%rsp)
+	jne .L3048
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3049
+.L3048:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3049:
+	cmpl $1525, 4(%rsp)
+	je .LB762
+.L3050:
+.L3051:
+	cmpl $1526, 4(%rsp)
+	jne .L3052
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3053
+.L3052:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3053:
+	cmpl $1527, 4(%rsp)
+	je .LB763
+.L3054:
+.L3055:
+	cmpl $1528, 4(%rsp)
+	jne .L3056
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3057
+.L3056:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3057:
+	cmpl $1529, 4(%rsp)
+	je .LB764
+.L3058:
+.L3059:
+	cmpl $1530, 4(%rsp)
+	jne .L3060
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3061
+.L3060:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3061:
+	cmpl $1531, 4(%rsp)
+	je .LB765
+.L3062:
+.L3063:
+	cmpl $1532, 4(%rsp)
+	jne .L3064
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3065
+.L3064:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3065:
+	cmpl $1533, 4(%rsp)
+	je .LB766
+.L3066:
+.L3067:
+	cmpl $1534, 4(%rsp)
+	jne .L3068
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3069
+.L3068:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3069:
+	cmpl $1535, 4(%rsp)
+	je .LB767
+.L3070:
+.L3071:
+	cmpl $1536, 4(%rsp)
+	jne .L3072
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3073
+.L3072:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3073:
+	cmpl $1537, 4(%rsp)
+	je .LB768
+.L3074:
+.L3075:
+	cmpl $1538, 4(%rsp)
+	jne .L3076
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3077
+.L3076:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3077:
+	cmpl $1539, 4(%rsp)
+	je .LB769
+.L3078:
+.L3079:
+	cmpl $1540, 4(%rsp)
+	jne .L3080
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3081
+.L3080:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3081:
+	cmpl $1541, 4(%rsp)
+	je .LB770
+.L3082:
+.L3083:
+	cmpl $1542, 4(%rsp)
+	jne .L3084
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3085
+.L3084:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3085:
+	cmpl $1543, 4(%rsp)
+	je .LB771
+.L3086:
+.L3087:
+	cmpl $1544, 4(%rsp)
+	jne .L3088
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3089
+.L3088:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3089:
+	cmpl $1545, 4(%rsp)
+	je .LB772
+.L3090:
+.L3091:
+	cmpl $1546, 4(%rsp)
+	jne .L3092
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3093
+.L3092:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3093:
+	cmpl $1547, 4(%rsp)
+	je .LB773
+.L3094:
+.L3095:
+	cmpl $1548, 4(%rsp)
+	jne .L3096
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3097
+.L3096:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3097:
+	cmpl $1549, 4(%rsp)
+	je .LB774
+.L3098:
+.L3099:
+	cmpl $1550, 4(%rsp)
+	jne .L3100
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3101
+.L3100:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3101:
+	cmpl $1551, 4(%rsp)
+	je .LB775
+.L3102:
+.L3103:
+	cmpl $1552, 4(%rsp)
+	jne .L3104
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3105
+.L3104:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3105:
+	cmpl $1553, 4(%rsp)
+	je .LB776
+.L3106:
+.L3107:
+	cmpl $1554, 4(%rsp)
+	jne .L3108
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3109
+.L3108:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3109:
+	cmpl $1555, 4(%rsp)
+	je .LB777
+.L3110:
+.L3111:
+	cmpl $1556, 4(%rsp)
+	jne .L3112
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3113
+.L3112:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3113:
+	cmpl $1557, 4(%rsp)
+	je .LB778
+.L3114:
+.L3115:
+	cmpl $1558, 4(%rsp)
+	jne .L3116
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3117
+.L3116:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3117:
+	cmpl $1559, 4(%rsp)
+	je .LB779
+.L3118:
+.L3119:
+	cmpl $1560, 4(%rsp)
+	jne .L3120
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3121
+.L3120:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3121:
+	cmpl $1561, 4(%rsp)
+	je .LB780
+.L3122:
+.L3123:
+	cmpl $1562, 4(%rsp)
+	jne .L3124
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3125
+.L3124:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3125:
+	cmpl $1563, 4(%rsp)
+	je .LB781
+.L3126:
+.L3127:
+	cmpl $1564, 4(%rsp)
+	jne .L3128
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3129
+.L3128:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3129:
+	cmpl $1565, 4(%rsp)
+	je .LB782
+.L3130:
+.L3131:
+	cmpl $1566, 4(%rsp)
+	jne .L3132
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3133
+.L3132:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3133:
+	cmpl $1567, 4(%rsp)
+	je .LB783
+.L3134:
+.L3135:
+	cmpl $1568, 4(%rsp)
+	jne .L3136
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3137
+.L3136:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3137:
+	cmpl $1569, 4(%rsp)
+	je .LB784
+.L3138:
+.L3139:
+	cmpl $1570, 4(%rsp)
+	jne .L3140
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3141
+.L3140:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3141:
+	cmpl $1571, 4(%rsp)
+	je .LB785
+.L3142:
+.L3143:
+	cmpl $1572, 4(%rsp)
+	jne .L3144
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3145
+.L3144:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3145:
+	cmpl $1573, 4(%rsp)
+	je .LB786
+.L3146:
+.L3147:
+	cmpl $1574, 4(%rsp)
+	jne .L3148
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3149
+.L3148:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3149:
+	cmpl $1575, 4(%rsp)
+	je .LB787
+.L3150:
+.L3151:
+	cmpl $1576, 4(%rsp)
+	jne .L3152
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3153
+.L3152:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3153:
+	cmpl $1577, 4(%rsp)
+	je .LB788
+.L3154:
+.L3155:
+	cmpl $1578, 4(%rsp)
+	jne .L3156
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3157
+.L3156:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3157:
+	cmpl $1579, 4(%rsp)
+	je .LB789
+.L3158:
+.L3159:
+	cmpl $1580, 4(%rsp)
+	jne .L3160
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3161
+.L3160:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3161:
+	cmpl $1581, 4(%rsp)
+	je .LB790
+.L3162:
+.L3163:
+	cmpl $1582, 4(%rsp)
+	jne .L3164
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3165
+.L3164:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3165:
+	cmpl $1583, 4(%rsp)
+	je .LB791
+.L3166:
+.L3167:
+	cmpl $1584, 4(%rsp)
+	jne .L3168
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3169
+.L3168:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3169:
+	cmpl $1585, 4(%rsp)
+	je .LB792
+.L3170:
+.L3171:
+	cmpl $1586, 4(%rsp)
+	jne .L3172
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3173
+.L3172:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3173:
+	cmpl $1587, 4(%rsp)
+	je .LB793
+.L3174:
+.L3175:
+	cmpl $1588, 4(%rsp)
+	jne .L3176
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3177
+.L3176:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3177:
+	cmpl $1589, 4(%rsp)
+	je .LB794
+.L3178:
+.L3179:
+	cmpl $1590, 4(%rsp)
+	jne .L3180
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3181
+.L3180:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3181:
+	cmpl $1591, 4(%rsp)
+	je .LB795
+.L3182:
+.L3183:
+	cmpl $1592, 4(%rsp)
+	jne .L3184
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3185
+.L3184:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3185:
+	cmpl $1593, 4(%rsp)
+	je .LB796
+.L3186:
+.L3187:
+	cmpl $1594, 4(%rsp)
+	jne .L3188
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3189
+.L3188:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3189:
+	cmpl $1595, 4(%rsp)
+	je .LB797
+.L3190:
+.L3191:
+	cmpl $1596, 4(%rsp)
+	jne .L3192
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3193
+.L3192:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3193:
+	cmpl $1597, 4(%rsp)
+	je .LB798
+.L3194:
+.L3195:
+	cmpl $1598, 4(%rsp)
+	jne .L3196
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3197
+.L3196:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3197:
+	cmpl $1599, 4(%rsp)
+	je .LB799
+.L3198:
+.L3199:
+	cmpl $1600, 4(%rsp)
+	jne .L3200
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3201
+.L3200:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3201:
+	cmpl $1601, 4(%rsp)
+	je .LB800
+.L3202:
+.L3203:
+	cmpl $1602, 4(%rsp)
+	jne .L3204
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3205
+.L3204:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3205:
+	cmpl $1603, 4(%rsp)
+	je .LB801
+.L3206:
+.L3207:
+	cmpl $1604, 4(%rsp)
+	jne .L3208
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3209
+.L3208:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3209:
+	cmpl $1605, 4(%rsp)
+	je .LB802
+.L3210:
+.L3211:
+	cmpl $1606, 4(%rsp)
+	jne .L3212
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3213
+.L3212:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3213:
+	cmpl $1607, 4(%rsp)
+	je .LB803
+.L3214:
+.L3215:
+	cmpl $1608, 4(%rsp)
+	jne .L3216
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3217
+.L3216:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3217:
+	cmpl $1609, 4(%rsp)
+	je .LB804
+.L3218:
+.L3219:
+	cmpl $1610, 4(%rsp)
+	jne .L3220
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3221
+.L3220:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3221:
+	cmpl $1611, 4(%rsp)
+	je .LB805
+.L3222:
+.L3223:
+	cmpl $1612, 4(%rsp)
+	jne .L3224
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3225
+.L3224:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3225:
+	cmpl $1613, 4(%rsp)
+	je .LB806
+.L3226:
+.L3227:
+	cmpl $1614, 4(%rsp)
+	jne .L3228
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3229
+.L3228:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3229:
+	cmpl $1615, 4(%rsp)
+	je .LB807
+.L3230:
+.L3231:
+	cmpl $1616, 4(%rsp)
+	jne .L3232
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3233
+.L3232:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3233:
+	cmpl $1617, 4(%rsp)
+	je .LB808
+.L3234:
+.L3235:
+	cmpl $1618, 4(%rsp)
+	jne .L3236
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3237
+.L3236:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3237:
+	cmpl $1619, 4(%rsp)
+	je .LB809
+.L3238:
+.L3239:
+	cmpl $1620, 4(%rsp)
+	jne .L3240
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3241
+.L3240:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3241:
+	cmpl $1621, 4(%rsp)
+	je .LB810
+.L3242:
+.L3243:
+	cmpl $1622, 4(%rsp)
+	jne .L3244
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3245
+.L3244:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3245:
+	cmpl $1623, 4(%rsp)
+	je .LB811
+.L3246:
+.L3247:
+	cmpl $1624, 4(%rsp)
+	jne .L3248
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3249
+.L3248:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3249:
+	cmpl $1625, 4(%rsp)
+	je .LB812
+.L3250:
+.L3251:
+	cmpl $1626, 4(%rsp)
+	jne .L3252
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3253
+.L3252:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3253:
+	cmpl $1627, 4(%rsp)
+	je .LB813
+.L3254:
+.L3255:
+	cmpl $1628, 4(%rsp)
+	jne .L3256
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3257
+.L3256:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3257:
+	cmpl $1629, 4(%rsp)
+	je .LB814
+.L3258:
+.L3259:
+	cmpl $1630, 4(%rsp)
+	jne .L3260
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3261
+.L3260:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3261:
+	cmpl $1631, 4(%rsp)
+	je .LB815
+.L3262:
+.L3263:
+	cmpl $1632, 4(%rsp)
+	jne .L3264
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3265
+.L3264:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3265:
+	cmpl $1633, 4(%rsp)
+	je .LB816
+.L3266:
+.L3267:
+	cmpl $1634, 4(%rsp)
+	jne .L3268
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3269
+.L3268:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3269:
+	cmpl $1635, 4(%rsp)
+	je .LB817
+.L3270:
+.L3271:
+	cmpl $1636, 4(%rsp)
+	jne .L3272
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3273
+.L3272:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3273:
+	cmpl $1637, 4(%rsp)
+	je .LB818
+.L3274:
+.L3275:
+	cmpl $1638, 4(%rsp)
+	jne .L3276
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3277
+.L3276:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3277:
+	cmpl $1639, 4(%rsp)
+	je .LB819
+.L3278:
+.L3279:
+	cmpl $1640, 4(%rsp)
+	jne .L3280
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3281
+.L3280:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3281:
+	cmpl $1641, 4(%rsp)
+	je .LB820
+.L3282:
+.L3283:
+	cmpl $1642, 4(%rsp)
+	jne .L3284
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3285
+.L3284:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3285:
+	cmpl $1643, 4(%rsp)
+	je .LB821
+.L3286:
+.L3287:
+	cmpl $1644, 4(%rsp)
+	jne .L3288
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3289
+.L3288:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3289:
+	cmpl $1645, 4(%rsp)
+	je .LB822
+.L3290:
+.L3291:
+	cmpl $1646, 4(%rsp)
+	jne .L3292
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3293
+.L3292:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3293:
+	cmpl $1647, 4(%rsp)
+	je .LB823
+.L3294:
+.L3295:
+	cmpl $1648, 4(%rsp)
+	jne .L3296
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3297
+.L3296:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3297:
+	cmpl $1649, 4(%rsp)
+	je .LB824
+.L3298:
+.L3299:
+	cmpl $1650, 4(%rsp)
+	jne .L3300
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3301
+.L3300:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3301:
+	cmpl $1651, 4(%rsp)
+	je .LB825
+.L3302:
+.L3303:
+	cmpl $1652, 4(%rsp)
+	jne .L3304
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3305
+.L3304:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3305:
+	cmpl $1653, 4(%rsp)
+	je .LB826
+.L3306:
+.L3307:
+	cmpl $1654, 4(%rsp)
+	jne .L3308
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3309
+.L3308:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3309:
+	cmpl $1655, 4(%rsp)
+	je .LB827
+.L3310:
+.L3311:
+	cmpl $1656, 4(%rsp)
+	jne .L3312
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3313
+.L3312:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3313:
+	cmpl $1657, 4(%rsp)
+	je .LB828
+.L3314:
+.L3315:
+	cmpl $1658, 4(%rsp)
+	jne .L3316
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3317
+.L3316:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3317:
+	cmpl $1659, 4(%rsp)
+	je .LB829
+.L3318:
+.L3319:
+	cmpl $1660, 4(%rsp)
+	jne .L3320
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3321
+.L3320:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3321:
+	cmpl $1661, 4(%rsp)
+	je .LB830
+.L3322:
+.L3323:
+	cmpl $1662, 4(%rsp)
+	jne .L3324
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3325
+.L3324:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3325:
+	cmpl $1663, 4(%rsp)
+	je .LB831
+.L3326:
+.L3327:
+	cmpl $1664, 4(%rsp)
+	jne .L3328
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3329
+.L3328:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3329:
+	cmpl $1665, 4(%rsp)
+	je .LB832
+.L3330:
+.L3331:
+	cmpl $1666, 4(%rsp)
+	jne .L3332
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3333
+.L3332:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3333:
+	cmpl $1667, 4(%rsp)
+	je .LB833
+.L3334:
+.L3335:
+	cmpl $1668, 4(%rsp)
+	jne .L3336
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3337
+.L3336:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3337:
+	cmpl $1669, 4(%rsp)
+	je .LB834
+.L3338:
+.L3339:
+	cmpl $1670, 4(%rsp)
+	jne .L3340
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3341
+.L3340:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3341:
+	cmpl $1671, 4(%rsp)
+	je .LB835
+.L3342:
+.L3343:
+	cmpl $1672, 4(%rsp)
+	jne .L3344
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3345
+.L3344:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3345:
+	cmpl $1673, 4(%rsp)
+	je .LB836
+.L3346:
+.L3347:
+	cmpl $1674, 4(%rsp)
+	jne .L3348
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3349
+.L3348:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3349:
+	cmpl $1675, 4(%rsp)
+	je .LB837
+.L3350:
+.L3351:
+	cmpl $1676, 4(%rsp)
+	jne .L3352
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3353
+.L3352:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3353:
+	cmpl $1677, 4(%rsp)
+	je .LB838
+.L3354:
+.L3355:
+	cmpl $1678, 4(%rsp)
+	jne .L3356
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3357
+.L3356:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3357:
+	cmpl $1679, 4(%rsp)
+	je .LB839
+.L3358:
+.L3359:
+	cmpl $1680, 4(%rsp)
+	jne .L3360
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3361
+.L3360:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3361:
+	cmpl $1681, 4(%rsp)
+	je .LB840
+.L3362:
+.L3363:
+	cmpl $1682, 4(%rsp)
+	jne .L3364
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3365
+.L3364:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3365:
+	cmpl $1683, 4(%rsp)
+	je .LB841
+.L3366:
+.L3367:
+	cmpl $1684, 4(%rsp)
+	jne .L3368
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3369
+.L3368:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3369:
+	cmpl $1685, 4(%rsp)
+	je .LB842
+.L3370:
+.L3371:
+	cmpl $1686, 4(%rsp)
+	jne .L3372
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3373
+.L3372:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3373:
+	cmpl $1687, 4(%rsp)
+	je .LB843
+.L3374:
+.L3375:
+	cmpl $1688, 4(%rsp)
+	jne .L3376
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3377
+.L3376:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3377:
+	cmpl $1689, 4(%rsp)
+	je .LB844
+.L3378:
+.L3379:
+	cmpl $1690, 4(%rsp)
+	jne .L3380
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3381
+.L3380:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3381:
+	cmpl $1691, 4(%rsp)
+	je .LB845
+.L3382:
+.L3383:
+	cmpl $1692, 4(%rsp)
+	jne .L3384
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3385
+.L3384:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3385:
+	cmpl $1693, 4(%rsp)
+	je .LB846
+.L3386:
+.L3387:
+	cmpl $1694, 4(%rsp)
+	jne .L3388
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3389
+.L3388:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3389:
+	cmpl $1695, 4(%rsp)
+	je .LB847
+.L3390:
+.L3391:
+	cmpl $1696, 4(%rsp)
+	jne .L3392
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3393
+.L3392:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3393:
+	cmpl $1697, 4(%rsp)
+	je .LB848
+.L3394:
+.L3395:
+	cmpl $1698, 4(%rsp)
+	jne .L3396
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3397
+.L3396:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3397:
+	cmpl $1699, 4(%rsp)
+	je .LB849
+.L3398:
+.L3399:
+	cmpl $1700, 4(%rsp)
+	jne .L3400
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3401
+.L3400:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3401:
+	cmpl $1701, 4(%rsp)
+	je .LB850
+.L3402:
+.L3403:
+	cmpl $1702, 4(%rsp)
+	jne .L3404
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3405
+.L3404:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3405:
+	cmpl $1703, 4(%rsp)
+	je .LB851
+.L3406:
+.L3407:
+	cmpl $1704, 4(%rsp)
+	jne .L3408
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3409
+.L3408:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3409:
+	cmpl $1705, 4(%rsp)
+	je .LB852
+.L3410:
+.L3411:
+	cmpl $1706, 4(%rsp)
+	jne .L3412
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3413
+.L3412:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3413:
+	cmpl $1707, 4(%rsp)
+	je .LB853
+.L3414:
+.L3415:
+	cmpl $1708, 4(%rsp)
+	jne .L3416
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3417
+.L3416:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3417:
+	cmpl $1709, 4(%rsp)
+	je .LB854
+.L3418:
+.L3419:
+	cmpl $1710, 4(%rsp)
+	jne .L3420
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3421
+.L3420:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3421:
+	cmpl $1711, 4(%rsp)
+	je .LB855
+.L3422:
+.L3423:
+	cmpl $1712, 4(%rsp)
+	jne .L3424
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3425
+.L3424:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3425:
+	cmpl $1713, 4(%rsp)
+	je .LB856
+.L3426:
+.L3427:
+	cmpl $1714, 4(%rsp)
+	jne .L3428
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3429
+.L3428:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3429:
+	cmpl $1715, 4(%rsp)
+	je .LB857
+.L3430:
+.L3431:
+	cmpl $1716, 4(%rsp)
+	jne .L3432
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3433
+.L3432:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3433:
+	cmpl $1717, 4(%rsp)
+	je .LB858
+.L3434:
+.L3435:
+	cmpl $1718, 4(%rsp)
+	jne .L3436
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3437
+.L3436:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3437:
+	cmpl $1719, 4(%rsp)
+	je .LB859
+.L3438:
+.L3439:
+	cmpl $1720, 4(%rsp)
+	jne .L3440
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3441
+.L3440:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3441:
+	cmpl $1721, 4(%rsp)
+	je .LB860
+.L3442:
+.L3443:
+	cmpl $1722, 4(%rsp)
+	jne .L3444
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3445
+.L3444:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3445:
+	cmpl $1723, 4(%rsp)
+	je .LB861
+.L3446:
+.L3447:
+	cmpl $1724, 4(%rsp)
+	jne .L3448
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3449
+.L3448:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3449:
+	cmpl $1725, 4(%rsp)
+	je .LB862
+.L3450:
+.L3451:
+	cmpl $1726, 4(%rsp)
+	jne .L3452
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3453
+.L3452:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3453:
+	cmpl $1727, 4(%rsp)
+	je .LB863
+.L3454:
+.L3455:
+	cmpl $1728, 4(%rsp)
+	jne .L3456
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3457
+.L3456:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3457:
+	cmpl $1729, 4(%rsp)
+	je .LB864
+.L3458:
+.L3459:
+	cmpl $1730, 4(%rsp)
+	jne .L3460
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3461
+.L3460:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3461:
+	cmpl $1731, 4(%rsp)
+	je .LB865
+.L3462:
+.L3463:
+	cmpl $1732, 4(%rsp)
+	jne .L3464
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3465
+.L3464:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3465:
+	cmpl $1733, 4(%rsp)
+	je .LB866
+.L3466:
+.L3467:
+	cmpl $1734, 4(%rsp)
+	jne .L3468
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3469
+.L3468:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3469:
+	cmpl $1735, 4(%rsp)
+	je .LB867
+.L3470:
+.L3471:
+	cmpl $1736, 4(%rsp)
+	jne .L3472
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3473
+.L3472:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3473:
+	cmpl $1737, 4(%rsp)
+	je .LB868
+.L3474:
+.L3475:
+	cmpl $1738, 4(%rsp)
+	jne .L3476
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3477
+.L3476:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3477:
+	cmpl $1739, 4(%rsp)
+	je .LB869
+.L3478:
+.L3479:
+	cmpl $1740, 4(%rsp)
+	jne .L3480
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3481
+.L3480:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3481:
+	cmpl $1741, 4(%rsp)
+	je .LB870
+.L3482:
+.L3483:
+	cmpl $1742, 4(%rsp)
+	jne .L3484
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3485
+.L3484:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3485:
+	cmpl $1743, 4(%rsp)
+	je .LB871
+.L3486:
+.L3487:
+	cmpl $1744, 4(%rsp)
+	jne .L3488
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3489
+.L3488:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3489:
+	cmpl $1745, 4(%rsp)
+	je .LB872
+.L3490:
+.L3491:
+	cmpl $1746, 4(%rsp)
+	jne .L3492
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3493
+.L3492:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3493:
+	cmpl $1747, 4(%rsp)
+	je .LB873
+.L3494:
+.L3495:
+	cmpl $1748, 4(%rsp)
+	jne .L3496
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3497
+.L3496:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3497:
+	cmpl $1749, 4(%rsp)
+	je .LB874
+.L3498:
+.L3499:
+	cmpl $1750, 4(%rsp)
+	jne .L3500
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3501
+.L3500:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3501:
+	cmpl $1751, 4(%rsp)
+	je .LB875
+.L3502:
+.L3503:
+	cmpl $1752, 4(%rsp)
+	jne .L3504
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3505
+.L3504:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3505:
+	cmpl $1753, 4(%rsp)
+	je .LB876
+.L3506:
+.L3507:
+	cmpl $1754, 4(%rsp)
+	jne .L3508
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3509
+.L3508:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3509:
+	cmpl $1755, 4(%rsp)
+	je .LB877
+.L3510:
+.L3511:
+	cmpl $1756, 4(%rsp)
+	jne .L3512
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3513
+.L3512:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3513:
+	cmpl $1757, 4(%rsp)
+	je .LB878
+.L3514:
+.L3515:
+	cmpl $1758, 4(%rsp)
+	jne .L3516
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3517
+.L3516:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3517:
+	cmpl $1759, 4(%rsp)
+	je .LB879
+.L3518:
+.L3519:
+	cmpl $1760, 4(%rsp)
+	jne .L3520
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3521
+.L3520:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3521:
+	cmpl $1761, 4(%rsp)
+	je .LB880
+.L3522:
+.L3523:
+	cmpl $1762, 4(%rsp)
+	jne .L3524
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3525
+.L3524:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3525:
+	cmpl $1763, 4(%rsp)
+	je .LB881
+.L3526:
+.L3527:
+	cmpl $1764, 4(%rsp)
+	jne .L3528
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3529
+.L3528:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3529:
+	cmpl $1765, 4(%rsp)
+	je .LB882
+.L3530:
+.L3531:
+	cmpl $1766, 4(%rsp)
+	jne .L3532
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3533
+.L3532:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3533:
+	cmpl $1767, 4(%rsp)
+	je .LB883
+.L3534:
+.L3535:
+	cmpl $1768, 4(%rsp)
+	jne .L3536
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3537
+.L3536:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3537:
+	cmpl $1769, 4(%rsp)
+	je .LB884
+.L3538:
+.L3539:
+	cmpl $1770, 4(%rsp)
+	jne .L3540
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3541
+.L3540:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3541:
+	cmpl $1771, 4(%rsp)
+	je .LB885
+.L3542:
+.L3543:
+	cmpl $1772, 4(%rsp)
+	jne .L3544
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3545
+.L3544:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3545:
+	cmpl $1773, 4(%rsp)
+	je .LB886
+.L3546:
+.L3547:
+	cmpl $1774, 4(%rsp)
+	jne .L3548
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3549
+.L3548:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3549:
+	cmpl $1775, 4(%rsp)
+	je .LB887
+.L3550:
+.L3551:
+	cmpl $1776, 4(%rsp)
+	jne .L3552
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3553
+.L3552:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3553:
+	cmpl $1777, 4(%rsp)
+	je .LB888
+.L3554:
+.L3555:
+	cmpl $1778, 4(%rsp)
+	jne .L3556
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3557
+.L3556:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3557:
+	cmpl $1779, 4(%rsp)
+	je .LB889
+.L3558:
+.L3559:
+	cmpl $1780, 4(%rsp)
+	jne .L3560
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3561
+.L3560:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3561:
+	cmpl $1781, 4(%rsp)
+	je .LB890
+.L3562:
+.L3563:
+	cmpl $1782, 4(%rsp)
+	jne .L3564
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3565
+.L3564:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3565:
+	cmpl $1783, 4(%rsp)
+	je .LB891
+.L3566:
+.L3567:
+	cmpl $1784, 4(%rsp)
+	jne .L3568
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3569
+.L3568:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3569:
+	cmpl $1785, 4(%rsp)
+	je .LB892
+.L3570:
+.L3571:
+	cmpl $1786, 4(%rsp)
+	jne .L3572
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3573
+.L3572:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3573:
+	cmpl $1787, 4(%rsp)
+	je .LB893
+.L3574:
+.L3575:
+	cmpl $1788, 4(%rsp)
+	jne .L3576
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3577
+.L3576:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3577:
+	cmpl $1789, 4(%rsp)
+	je .LB894
+.L3578:
+.L3579:
+	cmpl $1790, 4(%rsp)
+	jne .L3580
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3581
+.L3580:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3581:
+	cmpl $1791, 4(%rsp)
+	je .LB895
+.L3582:
+.L3583:
+	cmpl $1792, 4(%rsp)
+	jne .L3584
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3585
+.L3584:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3585:
+	cmpl $1793, 4(%rsp)
+	je .LB896
+.L3586:
+.L3587:
+	cmpl $1794, 4(%rsp)
+	jne .L3588
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3589
+.L3588:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3589:
+	cmpl $1795, 4(%rsp)
+	je .LB897
+.L3590:
+.L3591:
+	cmpl $1796, 4(%rsp)
+	jne .L3592
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3593
+.L3592:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3593:
+	cmpl $1797, 4(%rsp)
+	je .LB898
+.L3594:
+.L3595:
+	cmpl $1798, 4(%rsp)
+	jne .L3596
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3597
+.L3596:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3597:
+	cmpl $1799, 4(%rsp)
+	je .LB899
+.L3598:
+.L3599:
+	cmpl $1800, 4(%rsp)
+	jne .L3600
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3601
+.L3600:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3601:
+	cmpl $1801, 4(%rsp)
+	je .LB900
+.L3602:
+.L3603:
+	cmpl $1802, 4(%rsp)
+	jne .L3604
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3605
+.L3604:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3605:
+	cmpl $1803, 4(%rsp)
+	je .LB901
+.L3606:
+.L3607:
+	cmpl $1804, 4(%rsp)
+	jne .L3608
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3609
+.L3608:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3609:
+	cmpl $1805, 4(%rsp)
+	je .LB902
+.L3610:
+.L3611:
+	cmpl $1806, 4(%rsp)
+	jne .L3612
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3613
+.L3612:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3613:
+	cmpl $1807, 4(%rsp)
+	je .LB903
+.L3614:
+.L3615:
+	cmpl $1808, 4(%rsp)
+	jne .L3616
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3617
+.L3616:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3617:
+	cmpl $1809, 4(%rsp)
+	je .LB904
+.L3618:
+.L3619:
+	cmpl $1810, 4(%rsp)
+	jne .L3620
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3621
+.L3620:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3621:
+	cmpl $1811, 4(%rsp)
+	je .LB905
+.L3622:
+.L3623:
+	cmpl $1812, 4(%rsp)
+	jne .L3624
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3625
+.L3624:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3625:
+	cmpl $1813, 4(%rsp)
+	je .LB906
+.L3626:
+.L3627:
+	cmpl $1814, 4(%rsp)
+	jne .L3628
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3629
+.L3628:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3629:
+	cmpl $1815, 4(%rsp)
+	je .LB907
+.L3630:
+.L3631:
+	cmpl $1816, 4(%rsp)
+	jne .L3632
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3633
+.L3632:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3633:
+	cmpl $1817, 4(%rsp)
+	je .LB908
+.L3634:
+.L3635:
+	cmpl $1818, 4(%rsp)
+	jne .L3636
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3637
+.L3636:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3637:
+	cmpl $1819, 4(%rsp)
+	je .LB909
+.L3638:
+.L3639:
+	cmpl $1820, 4(%rsp)
+	jne .L3640
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3641
+.L3640:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3641:
+	cmpl $1821, 4(%rsp)
+	je .LB910
+.L3642:
+.L3643:
+	cmpl $1822, 4(%rsp)
+	jne .L3644
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3645
+.L3644:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3645:
+	cmpl $1823, 4(%rsp)
+	je .LB911
+.L3646:
+.L3647:
+	cmpl $1824, 4(%rsp)
+	jne .L3648
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3649
+.L3648:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3649:
+	cmpl $1825, 4(%rsp)
+	je .LB912
+.L3650:
+.L3651:
+	cmpl $1826, 4(%rsp)
+	jne .L3652
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3653
+.L3652:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3653:
+	cmpl $1827, 4(%rsp)
+	je .LB913
+.L3654:
+.L3655:
+	cmpl $1828, 4(%rsp)
+	jne .L3656
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3657
+.L3656:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3657:
+	cmpl $1829, 4(%rsp)
+	je .LB914
+.L3658:
+.L3659:
+	cmpl $1830, 4(%rsp)
+	jne .L3660
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3661
+.L3660:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3661:
+	cmpl $1831, 4(%rsp)
+	je .LB915
+.L3662:
+.L3663:
+	cmpl $1832, 4(%rsp)
+	jne .L3664
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3665
+.L3664:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3665:
+	cmpl $1833, 4(%rsp)
+	je .LB916
+.L3666:
+.L3667:
+	cmpl $1834, 4(%rsp)
+	jne .L3668
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3669
+.L3668:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3669:
+	cmpl $1835, 4(%rsp)
+	je .LB917
+.L3670:
+.L3671:
+	cmpl $1836, 4(%rsp)
+	jne .L3672
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3673
+.L3672:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3673:
+	cmpl $1837, 4(%rsp)
+	je .LB918
+.L3674:
+.L3675:
+	cmpl $1838, 4(%rsp)
+	jne .L3676
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3677
+.L3676:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3677:
+	cmpl $1839, 4(%rsp)
+	je .LB919
+.L3678:
+.L3679:
+	cmpl $1840, 4(%rsp)
+	jne .L3680
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3681
+.L3680:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3681:
+	cmpl $1841, 4(%rsp)
+	je .LB920
+.L3682:
+.L3683:
+	cmpl $1842, 4(%rsp)
+	jne .L3684
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3685
+.L3684:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3685:
+	cmpl $1843, 4(%rsp)
+	je .LB921
+.L3686:
+.L3687:
+	cmpl $1844, 4(%rsp)
+	jne .L3688
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3689
+.L3688:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3689:
+	cmpl $1845, 4(%rsp)
+	je .LB922
+.L3690:
+.L3691:
+	cmpl $1846, 4(%rsp)
+	jne .L3692
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3693
+.L3692:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3693:
+	cmpl $1847, 4(%rsp)
+	je .LB923
+.L3694:
+.L3695:
+	cmpl $1848, 4(%rsp)
+	jne .L3696
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3697
+.L3696:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3697:
+	cmpl $1849, 4(%rsp)
+	je .LB924
+.L3698:
+.L3699:
+	cmpl $1850, 4(%rsp)
+	jne .L3700
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3701
+.L3700:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3701:
+	cmpl $1851, 4(%rsp)
+	je .LB925
+.L3702:
+.L3703:
+	cmpl $1852, 4(%rsp)
+	jne .L3704
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3705
+.L3704:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3705:
+	cmpl $1853, 4(%rsp)
+	je .LB926
+.L3706:
+.L3707:
+	cmpl $1854, 4(%rsp)
+	jne .L3708
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3709
+.L3708:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3709:
+	cmpl $1855, 4(%rsp)
+	je .LB927
+.L3710:
+.L3711:
+	cmpl $1856, 4(%rsp)
+	jne .L3712
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3713
+.L3712:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3713:
+	cmpl $1857, 4(%rsp)
+	je .LB928
+.L3714:
+.L3715:
+	cmpl $1858, 4(%rsp)
+	jne .L3716
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3717
+.L3716:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3717:
+	cmpl $1859, 4(%rsp)
+	je .LB929
+.L3718:
+.L3719:
+	cmpl $1860, 4(%rsp)
+	jne .L3720
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3721
+.L3720:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3721:
+	cmpl $1861, 4(%rsp)
+	je .LB930
+.L3722:
+.L3723:
+	cmpl $1862, 4(%rsp)
+	jne .L3724
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3725
+.L3724:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3725:
+	cmpl $1863, 4(%rsp)
+	je .LB931
+.L3726:
+.L3727:
+	cmpl $1864, 4(%rsp)
+	jne .L3728
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3729
+.L3728:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3729:
+	cmpl $1865, 4(%rsp)
+	je .LB932
+.L3730:
+.L3731:
+	cmpl $1866, 4(%rsp)
+	jne .L3732
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3733
+.L3732:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3733:
+	cmpl $1867, 4(%rsp)
+	je .LB933
+.L3734:
+.L3735:
+	cmpl $1868, 4(%rsp)
+	jne .L3736
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3737
+.L3736:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3737:
+	cmpl $1869, 4(%rsp)
+	je .LB934
+.L3738:
+.L3739:
+	cmpl $1870, 4(%rsp)
+	jne .L3740
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3741
+.L3740:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3741:
+	cmpl $1871, 4(%rsp)
+	je .LB935
+.L3742:
+.L3743:
+	cmpl $1872, 4(%rsp)
+	jne .L3744
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3745
+.L3744:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3745:
+	cmpl $1873, 4(%rsp)
+	je .LB936
+.L3746:
+.L3747:
+	cmpl $1874, 4(%rsp)
+	jne .L3748
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3749
+.L3748:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3749:
+	cmpl $1875, 4(%rsp)
+	je .LB937
+.L3750:
+.L3751:
+	cmpl $1876, 4(%rsp)
+	jne .L3752
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3753
+.L3752:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3753:
+	cmpl $1877, 4(%rsp)
+	je .LB938
+.L3754:
+.L3755:
+	cmpl $1878, 4(%rsp)
+	jne .L3756
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3757
+.L3756:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3757:
+	cmpl $1879, 4(%rsp)
+	je .LB939
+.L3758:
+.L3759:
+	cmpl $1880, 4(%rsp)
+	jne .L3760
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3761
+.L3760:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3761:
+	cmpl $1881, 4(%rsp)
+	je .LB940
+.L3762:
+.L3763:
+	cmpl $1882, 4(%rsp)
+	jne .L3764
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3765
+.L3764:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3765:
+	cmpl $1883, 4(%rsp)
+	je .LB941
+.L3766:
+.L3767:
+	cmpl $1884, 4(%rsp)
+	jne .L3768
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3769
+.L3768:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3769:
+	cmpl $1885, 4(%rsp)
+	je .LB942
+.L3770:
+.L3771:
+	cmpl $1886, 4(%rsp)
+	jne .L3772
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3773
+.L3772:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3773:
+	cmpl $1887, 4(%rsp)
+	je .LB943
+.L3774:
+.L3775:
+	cmpl $1888, 4(%rsp)
+	jne .L3776
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3777
+.L3776:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3777:
+	cmpl $1889, 4(%rsp)
+	je .LB944
+.L3778:
+.L3779:
+	cmpl $1890, 4(%rsp)
+	jne .L3780
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3781
+.L3780:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3781:
+	cmpl $1891, 4(%rsp)
+	je .LB945
+.L3782:
+.L3783:
+	cmpl $1892, 4(%rsp)
+	jne .L3784
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3785
+.L3784:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3785:
+	cmpl $1893, 4(%rsp)
+	je .LB946
+.L3786:
+.L3787:
+	cmpl $1894, 4(%rsp)
+	jne .L3788
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3789
+.L3788:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3789:
+	cmpl $1895, 4(%rsp)
+	je .LB947
+.L3790:
+.L3791:
+	cmpl $1896, 4(%rsp)
+	jne .L3792
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3793
+.L3792:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3793:
+	cmpl $1897, 4(%rsp)
+	je .LB948
+.L3794:
+.L3795:
+	cmpl $1898, 4(%rsp)
+	jne .L3796
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3797
+.L3796:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3797:
+	cmpl $1899, 4(%rsp)
+	je .LB949
+.L3798:
+.L3799:
+	cmpl $1900, 4(%rsp)
+	jne .L3800
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3801
+.L3800:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3801:
+	cmpl $1901, 4(%rsp)
+	je .LB950
+.L3802:
+.L3803:
+	cmpl $1902, 4(%rsp)
+	jne .L3804
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3805
+.L3804:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3805:
+	cmpl $1903, 4(%rsp)
+	je .LB951
+.L3806:
+.L3807:
+	cmpl $1904, 4(%rsp)
+	jne .L3808
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3809
+.L3808:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3809:
+	cmpl $1905, 4(%rsp)
+	je .LB952
+.L3810:
+.L3811:
+	cmpl $1906, 4(%rsp)
+	jne .L3812
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3813
+.L3812:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3813:
+	cmpl $1907, 4(%rsp)
+	je .LB953
+.L3814:
+.L3815:
+	cmpl $1908, 4(%rsp)
+	jne .L3816
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3817
+.L3816:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3817:
+	cmpl $1909, 4(%rsp)
+	je .LB954
+.L3818:
+.L3819:
+	cmpl $1910, 4(%rsp)
+	jne .L3820
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3821
+.L3820:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3821:
+	cmpl $1911, 4(%rsp)
+	je .LB955
+.L3822:
+.L3823:
+	cmpl $1912, 4(%rsp)
+	jne .L3824
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3825
+.L3824:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3825:
+	cmpl $1913, 4(%rsp)
+	je .LB956
+.L3826:
+.L3827:
+	cmpl $1914, 4(%rsp)
+	jne .L3828
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3829
+.L3828:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3829:
+	cmpl $1915, 4(%rsp)
+	je .LB957
+.L3830:
+.L3831:
+	cmpl $1916, 4(%rsp)
+	jne .L3832
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3833
+.L3832:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3833:
+	cmpl $1917, 4(%rsp)
+	je .LB958
+.L3834:
+.L3835:
+	cmpl $1918, 4(%rsp)
+	jne .L3836
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3837
+.L3836:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3837:
+	cmpl $1919, 4(%rsp)
+	je .LB959
+.L3838:
+.L3839:
+	cmpl $1920, 4(%rsp)
+	jne .L3840
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3841
+.L3840:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3841:
+	cmpl $1921, 4(%rsp)
+	je .LB960
+.L3842:
+.L3843:
+	cmpl $1922, 4(%rsp)
+	jne .L3844
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3845
+.L3844:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3845:
+	cmpl $1923, 4(%rsp)
+	je .LB961
+.L3846:
+.L3847:
+	cmpl $1924, 4(%rsp)
+	jne .L3848
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3849
+.L3848:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3849:
+	cmpl $1925, 4(%rsp)
+	je .LB962
+.L3850:
+.L3851:
+	cmpl $1926, 4(%rsp)
+	jne .L3852
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3853
+.L3852:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3853:
+	cmpl $1927, 4(%rsp)
+	je .LB963
+.L3854:
+.L3855:
+	cmpl $1928, 4(%rsp)
+	jne .L3856
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3857
+.L3856:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3857:
+	cmpl $1929, 4(%rsp)
+	je .LB964
+.L3858:
+.L3859:
+	cmpl $1930, 4(%rsp)
+	jne .L3860
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3861
+.L3860:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3861:
+	cmpl $1931, 4(%rsp)
+	je .LB965
+.L3862:
+.L3863:
+	cmpl $1932, 4(%rsp)
+	jne .L3864
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3865
+.L3864:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3865:
+	cmpl $1933, 4(%rsp)
+	je .LB966
+.L3866:
+.L3867:
+	cmpl $1934, 4(%rsp)
+	jne .L3868
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3869
+.L3868:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3869:
+	cmpl $1935, 4(%rsp)
+	je .LB967
+.L3870:
+.L3871:
+	cmpl $1936, 4(%rsp)
+	jne .L3872
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3873
+.L3872:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3873:
+	cmpl $1937, 4(%rsp)
+	je .LB968
+.L3874:
+.L3875:
+	cmpl $1938, 4(%rsp)
+	jne .L3876
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3877
+.L3876:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3877:
+	cmpl $1939, 4(%rsp)
+	je .LB969
+.L3878:
+.L3879:
+	cmpl $1940, 4(%rsp)
+	jne .L3880
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3881
+.L3880:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3881:
+	cmpl $1941, 4(%rsp)
+	je .LB970
+.L3882:
+.L3883:
+	cmpl $1942, 4(%rsp)
+	jne .L3884
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3885
+.L3884:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3885:
+	cmpl $1943, 4(%rsp)
+	je .LB971
+.L3886:
+.L3887:
+	cmpl $1944, 4(%rsp)
+	jne .L3888
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3889
+.L3888:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3889:
+	cmpl $1945, 4(%rsp)
+	je .LB972
+.L3890:
+.L3891:
+	cmpl $1946, 4(%rsp)
+	jne .L3892
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3893
+.L3892:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3893:
+	cmpl $1947, 4(%rsp)
+	je .LB973
+.L3894:
+.L3895:
+	cmpl $1948, 4(%rsp)
+	jne .L3896
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3897
+.L3896:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3897:
+	cmpl $1949, 4(%rsp)
+	je .LB974
+.L3898:
+.L3899:
+	cmpl $1950, 4(%rsp)
+	jne .L3900
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3901
+.L3900:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3901:
+	cmpl $1951, 4(%rsp)
+	je .LB975
+.L3902:
+.L3903:
+	cmpl $1952, 4(%rsp)
+	jne .L3904
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3905
+.L3904:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3905:
+	cmpl $1953, 4(%rsp)
+	je .LB976
+.L3906:
+.L3907:
+	cmpl $1954, 4(%rsp)
+	jne .L3908
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3909
+.L3908:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3909:
+	cmpl $1955, 4(%rsp)
+	je .LB977
+.L3910:
+.L3911:
+	cmpl $1956, 4(%rsp)
+	jne .L3912
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3913
+.L3912:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3913:
+	cmpl $1957, 4(%rsp)
+	je .LB978
+.L3914:
+.L3915:
+	cmpl $1958, 4(%rsp)
+	jne .L3916
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3917
+.L3916:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3917:
+	cmpl $1959, 4(%rsp)
+	je .LB979
+.L3918:
+.L3919:
+	cmpl $1960, 4(%rsp)
+	jne .L3920
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3921
+.L3920:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3921:
+	cmpl $1961, 4(%rsp)
+	je .LB980
+.L3922:
+.L3923:
+	cmpl $1962, 4(%rsp)
+	jne .L3924
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3925
+.L3924:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3925:
+	cmpl $1963, 4(%rsp)
+	je .LB981
+.L3926:
+.L3927:
+	cmpl $1964, 4(%rsp)
+	jne .L3928
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3929
+.L3928:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3929:
+	cmpl $1965, 4(%rsp)
+	je .LB982
+.L3930:
+.L3931:
+	cmpl $1966, 4(%rsp)
+	jne .L3932
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3933
+.L3932:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3933:
+	cmpl $1967, 4(%rsp)
+	je .LB983
+.L3934:
+.L3935:
+	cmpl $1968, 4(%rsp)
+	jne .L3936
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3937
+.L3936:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3937:
+	cmpl $1969, 4(%rsp)
+	je .LB984
+.L3938:
+.L3939:
+	cmpl $1970, 4(%rsp)
+	jne .L3940
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3941
+.L3940:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3941:
+	cmpl $1971, 4(%rsp)
+	je .LB985
+.L3942:
+.L3943:
+	cmpl $1972, 4(%rsp)
+	jne .L3944
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3945
+.L3944:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3945:
+	cmpl $1973, 4(%rsp)
+	je .LB986
+.L3946:
+.L3947:
+	cmpl $1974, 4(%rsp)
+	jne .L3948
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3949
+.L3948:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3949:
+	cmpl $1975, 4(%rsp)
+	je .LB987
+.L3950:
+.L3951:
+	cmpl $1976, 4(%rsp)
+	jne .L3952
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3953
+.L3952:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3953:
+	cmpl $1977, 4(%rsp)
+	je .LB988
+.L3954:
+.L3955:
+	cmpl $1978, 4(%rsp)
+	jne .L3956
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3957
+.L3956:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3957:
+	cmpl $1979, 4(%rsp)
+	je .LB989
+.L3958:
+.L3959:
+	cmpl $1980, 4(%rsp)
+	jne .L3960
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3961
+.L3960:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3961:
+	cmpl $1981, 4(%rsp)
+	je .LB990
+.L3962:
+.L3963:
+	cmpl $1982, 4(%rsp)
+	jne .L3964
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3965
+.L3964:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3965:
+	cmpl $1983, 4(%rsp)
+	je .LB991
+.L3966:
+.L3967:
+	cmpl $1984, 4(%rsp)
+	jne .L3968
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3969
+.L3968:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3969:
+	cmpl $1985, 4(%rsp)
+	je .LB992
+.L3970:
+.L3971:
+	cmpl $1986, 4(%rsp)
+	jne .L3972
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3973
+.L3972:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3973:
+	cmpl $1987, 4(%rsp)
+	je .LB993
+.L3974:
+.L3975:
+	cmpl $1988, 4(%rsp)
+	jne .L3976
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3977
+.L3976:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3977:
+	cmpl $1989, 4(%rsp)
+	je .LB994
+.L3978:
+.L3979:
+	cmpl $1990, 4(%rsp)
+	jne .L3980
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3981
+.L3980:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3981:
+	cmpl $1991, 4(%rsp)
+	je .LB995
+.L3982:
+.L3983:
+	cmpl $1992, 4(%rsp)
+	jne .L3984
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3985
+.L3984:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3985:
+	cmpl $1993, 4(%rsp)
+	je .LB996
+.L3986:
+.L3987:
+	cmpl $1994, 4(%rsp)
+	jne .L3988
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3989
+.L3988:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3989:
+	cmpl $1995, 4(%rsp)
+	je .LB997
+.L3990:
+.L3991:
+	cmpl $1996, 4(%rsp)
+	jne .L3992
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3993
+.L3992:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3993:
+	cmpl $1997, 4(%rsp)
+	je .LB998
+.L3994:
+.L3995:
+	cmpl $1998, 4(%rsp)
+	jne .L3996
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L3997
+.L3996:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L3997:
+	cmpl $1999, 4(%rsp)
+	je .LB999
+.L3998:
+.L3999:
+	cmpl $2000, 4(%rsp)
+	jne .L4000
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4001
+.L4000:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4001:
+	cmpl $2001, 4(%rsp)
+	je .LB1000
+.L4002:
+.L4003:
+	cmpl $2002, 4(%rsp)
+	jne .L4004
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4005
+.L4004:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4005:
+	cmpl $2003, 4(%rsp)
+	je .LB1001
+.L4006:
+.L4007:
+	cmpl $2004, 4(%rsp)
+	jne .L4008
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4009
+.L4008:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4009:
+	cmpl $2005, 4(%rsp)
+	je .LB1002
+.L4010:
+.L4011:
+	cmpl $2006, 4(%rsp)
+	jne .L4012
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4013
+.L4012:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4013:
+	cmpl $2007, 4(%rsp)
+	je .LB1003
+.L4014:
+.L4015:
+	cmpl $2008, 4(%rsp)
+	jne .L4016
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4017
+.L4016:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4017:
+	cmpl $2009, 4(%rsp)
+	je .LB1004
+.L4018:
+.L4019:
+	cmpl $2010, 4(%rsp)
+	jne .L4020
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4021
+.L4020:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4021:
+	cmpl $2011, 4(%rsp)
+	je .LB1005
+.L4022:
+.L4023:
+	cmpl $2012, 4(%rsp)
+	jne .L4024
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4025
+.L4024:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4025:
+	cmpl $2013, 4(%rsp)
+	je .LB1006
+.L4026:
+.L4027:
+	cmpl $2014, 4(%rsp)
+	jne .L4028
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4029
+.L4028:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4029:
+	cmpl $2015, 4(%rsp)
+	je .LB1007
+.L4030:
+.L4031:
+	cmpl $2016, 4(%rsp)
+	jne .L4032
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4033
+.L4032:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4033:
+	cmpl $2017, 4(%rsp)
+	je .LB1008
+.L4034:
+.L4035:
+	cmpl $2018, 4(%rsp)
+	jne .L4036
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4037
+.L4036:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4037:
+	cmpl $2019, 4(%rsp)
+	je .LB1009
+.L4038:
+.L4039:
+	cmpl $2020, 4(%rsp)
+	jne .L4040
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4041
+.L4040:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4041:
+	cmpl $2021, 4(%rsp)
+	je .LB1010
+.L4042:
+.L4043:
+	cmpl $2022, 4(%rsp)
+	jne .L4044
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4045
+.L4044:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4045:
+	cmpl $2023, 4(%rsp)
+	je .LB1011
+.L4046:
+.L4047:
+	cmpl $2024, 4(%rsp)
+	jne .L4048
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4049
+.L4048:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4049:
+	cmpl $2025, 4(%rsp)
+	je .LB1012
+.L4050:
+.L4051:
+	cmpl $2026, 4(%rsp)
+	jne .L4052
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4053
+.L4052:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4053:
+	cmpl $2027, 4(%rsp)
+	je .LB1013
+.L4054:
+.L4055:
+	cmpl $2028, 4(%rsp)
+	jne .L4056
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4057
+.L4056:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4057:
+	cmpl $2029, 4(%rsp)
+	je .LB1014
+.L4058:
+.L4059:
+	cmpl $2030, 4(%rsp)
+	jne .L4060
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4061
+.L4060:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4061:
+	cmpl $2031, 4(%rsp)
+	je .LB1015
+.L4062:
+.L4063:
+	cmpl $2032, 4(%rsp)
+	jne .L4064
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4065
+.L4064:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4065:
+	cmpl $2033, 4(%rsp)
+	je .LB1016
+.L4066:
+.L4067:
+	cmpl $2034, 4(%rsp)
+	jne .L4068
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4069
+.L4068:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4069:
+	cmpl $2035, 4(%rsp)
+	je .LB1017
+.L4070:
+.L4071:
+	cmpl $2036, 4(%rsp)
+	jne .L4072
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4073
+.L4072:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4073:
+	cmpl $2037, 4(%rsp)
+	je .LB1018
+.L4074:
+.L4075:
+	cmpl $2038, 4(%rsp)
+	jne .L4076
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4077
+.L4076:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4077:
+	cmpl $2039, 4(%rsp)
+	je .LB1019
+.L4078:
+.L4079:
+	cmpl $2040, 4(%rsp)
+	jne .L4080
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4081
+.L4080:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4081:
+	cmpl $2041, 4(%rsp)
+	je .LB1020
+.L4082:
+.L4083:
+	cmpl $2042, 4(%rsp)
+	jne .L4084
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4085
+.L4084:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4085:
+	cmpl $2043, 4(%rsp)
+	je .LB1021
+.L4086:
+.L4087:
+	cmpl $2044, 4(%rsp)
+	jne .L4088
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4089
+.L4088:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4089:
+	cmpl $2045, 4(%rsp)
+	je .LB1022
+.L4090:
+.L4091:
+	cmpl $2046, 4(%rsp)
+	jne .L4092
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4093
+.L4092:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4093:
+	cmpl $2047, 4(%rsp)
+	je .LB1023
+.L4094:
+.L4095:
+	cmpl $2048, 4(%rsp)
+	jne .L4096
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4097
+.L4096:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4097:
+	cmpl $2049, 4(%rsp)
+	je .LB1024
+.L4098:
+.L4099:
+	cmpl $2050, 4(%rsp)
+	jne .L4100
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4101
+.L4100:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4101:
+	cmpl $2051, 4(%rsp)
+	je .LB1025
+.L4102:
+.L4103:
+	cmpl $2052, 4(%rsp)
+	jne .L4104
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4105
+.L4104:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4105:
+	cmpl $2053, 4(%rsp)
+	je .LB1026
+.L4106:
+.L4107:
+	cmpl $2054, 4(%rsp)
+	jne .L4108
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4109
+.L4108:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4109:
+	cmpl $2055, 4(%rsp)
+	je .LB1027
+.L4110:
+.L4111:
+	cmpl $2056, 4(%rsp)
+	jne .L4112
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4113
+.L4112:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4113:
+	cmpl $2057, 4(%rsp)
+	je .LB1028
+.L4114:
+.L4115:
+	cmpl $2058, 4(%rsp)
+	jne .L4116
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4117
+.L4116:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4117:
+	cmpl $2059, 4(%rsp)
+	je .LB1029
+.L4118:
+.L4119:
+	cmpl $2060, 4(%rsp)
+	jne .L4120
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4121
+.L4120:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4121:
+	cmpl $2061, 4(%rsp)
+	je .LB1030
+.L4122:
+.L4123:
+	cmpl $2062, 4(%rsp)
+	jne .L4124
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4125
+.L4124:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4125:
+	cmpl $2063, 4(%rsp)
+	je .LB1031
+.L4126:
+.L4127:
+	cmpl $2064, 4(%rsp)
+	jne .L4128
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4129
+.L4128:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4129:
+	cmpl $2065, 4(%rsp)
+	je .LB1032
+.L4130:
+.L4131:
+	cmpl $2066, 4(%rsp)
+	jne .L4132
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4133
+.L4132:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4133:
+	cmpl $2067, 4(%rsp)
+	je .LB1033
+.L4134:
+.L4135:
+	cmpl $2068, 4(%rsp)
+	jne .L4136
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4137
+.L4136:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4137:
+	cmpl $2069, 4(%rsp)
+	je .LB1034
+.L4138:
+.L4139:
+	cmpl $2070, 4(%rsp)
+	jne .L4140
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4141
+.L4140:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4141:
+	cmpl $2071, 4(%rsp)
+	je .LB1035
+.L4142:
+.L4143:
+	cmpl $2072, 4(%rsp)
+	jne .L4144
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4145
+.L4144:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4145:
+	cmpl $2073, 4(%rsp)
+	je .LB1036
+.L4146:
+.L4147:
+	cmpl $2074, 4(%rsp)
+	jne .L4148
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4149
+.L4148:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4149:
+	cmpl $2075, 4(%rsp)
+	je .LB1037
+.L4150:
+.L4151:
+	cmpl $2076, 4(%rsp)
+	jne .L4152
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4153
+.L4152:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4153:
+	cmpl $2077, 4(%rsp)
+	je .LB1038
+.L4154:
+.L4155:
+	cmpl $2078, 4(%rsp)
+	jne .L4156
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4157
+.L4156:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4157:
+	cmpl $2079, 4(%rsp)
+	je .LB1039
+.L4158:
+.L4159:
+	cmpl $2080, 4(%rsp)
+	jne .L4160
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4161
+.L4160:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4161:
+	cmpl $2081, 4(%rsp)
+	je .LB1040
+.L4162:
+.L4163:
+	cmpl $2082, 4(%rsp)
+	jne .L4164
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4165
+.L4164:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4165:
+	cmpl $2083, 4(%rsp)
+	je .LB1041
+.L4166:
+.L4167:
+	cmpl $2084, 4(%rsp)
+	jne .L4168
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4169
+.L4168:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4169:
+	cmpl $2085, 4(%rsp)
+	je .LB1042
+.L4170:
+.L4171:
+	cmpl $2086, 4(%rsp)
+	jne .L4172
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4173
+.L4172:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4173:
+	cmpl $2087, 4(%rsp)
+	je .LB1043
+.L4174:
+.L4175:
+	cmpl $2088, 4(%rsp)
+	jne .L4176
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4177
+.L4176:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4177:
+	cmpl $2089, 4(%rsp)
+	je .LB1044
+.L4178:
+.L4179:
+	cmpl $2090, 4(%rsp)
+	jne .L4180
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4181
+.L4180:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4181:
+	cmpl $2091, 4(%rsp)
+	je .LB1045
+.L4182:
+.L4183:
+	cmpl $2092, 4(%rsp)
+	jne .L4184
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4185
+.L4184:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4185:
+	cmpl $2093, 4(%rsp)
+	je .LB1046
+.L4186:
+.L4187:
+	cmpl $2094, 4(%rsp)
+	jne .L4188
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4189
+.L4188:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4189:
+	cmpl $2095, 4(%rsp)
+	je .LB1047
+.L4190:
+.L4191:
+	cmpl $2096, 4(%rsp)
+	jne .L4192
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4193
+.L4192:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4193:
+	cmpl $2097, 4(%rsp)
+	je .LB1048
+.L4194:
+.L4195:
+	cmpl $2098, 4(%rsp)
+	jne .L4196
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4197
+.L4196:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4197:
+	cmpl $2099, 4(%rsp)
+	je .LB1049
+.L4198:
+.L4199:
+	cmpl $2100, 4(%rsp)
+	jne .L4200
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4201
+.L4200:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4201:
+	cmpl $2101, 4(%rsp)
+	je .LB1050
+.L4202:
+.L4203:
+	cmpl $2102, 4(%rsp)
+	jne .L4204
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4205
+.L4204:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4205:
+	cmpl $2103, 4(%rsp)
+	je .LB1051
+.L4206:
+.L4207:
+	cmpl $2104, 4(%rsp)
+	jne .L4208
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4209
+.L4208:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4209:
+	cmpl $2105, 4(%rsp)
+	je .LB1052
+.L4210:
+.L4211:
+	cmpl $2106, 4(%rsp)
+	jne .L4212
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4213
+.L4212:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4213:
+	cmpl $2107, 4(%rsp)
+	je .LB1053
+.L4214:
+.L4215:
+	cmpl $2108, 4(%rsp)
+	jne .L4216
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4217
+.L4216:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4217:
+	cmpl $2109, 4(%rsp)
+	je .LB1054
+.L4218:
+.L4219:
+	cmpl $2110, 4(%rsp)
+	jne .L4220
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4221
+.L4220:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4221:
+	cmpl $2111, 4(%rsp)
+	je .LB1055
+.L4222:
+.L4223:
+	cmpl $2112, 4(%rsp)
+	jne .L4224
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4225
+.L4224:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4225:
+	cmpl $2113, 4(%rsp)
+	je .LB1056
+.L4226:
+.L4227:
+	cmpl $2114, 4(%rsp)
+	jne .L4228
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4229
+.L4228:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4229:
+	cmpl $2115, 4(%rsp)
+	je .LB1057
+.L4230:
+.L4231:
+	cmpl $2116, 4(%rsp)
+	jne .L4232
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4233
+.L4232:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4233:
+	cmpl $2117, 4(%rsp)
+	je .LB1058
+.L4234:
+.L4235:
+	cmpl $2118, 4(%rsp)
+	jne .L4236
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4237
+.L4236:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4237:
+	cmpl $2119, 4(%rsp)
+	je .LB1059
+.L4238:
+.L4239:
+	cmpl $2120, 4(%rsp)
+	jne .L4240
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4241
+.L4240:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4241:
+	cmpl $2121, 4(%rsp)
+	je .LB1060
+.L4242:
+.L4243:
+	cmpl $2122, 4(%rsp)
+	jne .L4244
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4245
+.L4244:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4245:
+	cmpl $2123, 4(%rsp)
+	je .LB1061
+.L4246:
+.L4247:
+	cmpl $2124, 4(%rsp)
+	jne .L4248
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4249
+.L4248:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4249:
+	cmpl $2125, 4(%rsp)
+	je .LB1062
+.L4250:
+.L4251:
+	cmpl $2126, 4(%rsp)
+	jne .L4252
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4253
+.L4252:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4253:
+	cmpl $2127, 4(%rsp)
+	je .LB1063
+.L4254:
+.L4255:
+	cmpl $2128, 4(%rsp)
+	jne .L4256
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4257
+.L4256:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4257:
+	cmpl $2129, 4(%rsp)
+	je .LB1064
+.L4258:
+.L4259:
+	cmpl $2130, 4(%rsp)
+	jne .L4260
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4261
+.L4260:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4261:
+	cmpl $2131, 4(%rsp)
+	je .LB1065
+.L4262:
+.L4263:
+	cmpl $2132, 4(%rsp)
+	jne .L4264
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4265
+.L4264:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4265:
+	cmpl $2133, 4(%rsp)
+	je .LB1066
+.L4266:
+.L4267:
+	cmpl $2134, 4(%rsp)
+	jne .L4268
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4269
+.L4268:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4269:
+	cmpl $2135, 4(%rsp)
+	je .LB1067
+.L4270:
+.L4271:
+	cmpl $2136, 4(%rsp)
+	jne .L4272
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4273
+.L4272:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4273:
+	cmpl $2137, 4(%rsp)
+	je .LB1068
+.L4274:
+.L4275:
+	cmpl $2138, 4(%rsp)
+	jne .L4276
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4277
+.L4276:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4277:
+	cmpl $2139, 4(%rsp)
+	je .LB1069
+.L4278:
+.L4279:
+	cmpl $2140, 4(%rsp)
+	jne .L4280
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4281
+.L4280:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4281:
+	cmpl $2141, 4(%rsp)
+	je .LB1070
+.L4282:
+.L4283:
+	cmpl $2142, 4(%rsp)
+	jne .L4284
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4285
+.L4284:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4285:
+	cmpl $2143, 4(%rsp)
+	je .LB1071
+.L4286:
+.L4287:
+	cmpl $2144, 4(%rsp)
+	jne .L4288
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4289
+.L4288:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4289:
+	cmpl $2145, 4(%rsp)
+	je .LB1072
+.L4290:
+.L4291:
+	cmpl $2146, 4(%rsp)
+	jne .L4292
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4293
+.L4292:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4293:
+	cmpl $2147, 4(%rsp)
+	je .LB1073
+.L4294:
+.L4295:
+	cmpl $2148, 4(%rsp)
+	jne .L4296
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4297
+.L4296:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4297:
+	cmpl $2149, 4(%rsp)
+	je .LB1074
+.L4298:
+.L4299:
+	cmpl $2150, 4(%rsp)
+	jne .L4300
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4301
+.L4300:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4301:
+	cmpl $2151, 4(%rsp)
+	je .LB1075
+.L4302:
+.L4303:
+	cmpl $2152, 4(%rsp)
+	jne .L4304
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4305
+.L4304:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4305:
+	cmpl $2153, 4(%rsp)
+	je .LB1076
+.L4306:
+.L4307:
+	cmpl $2154, 4(%rsp)
+	jne .L4308
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4309
+.L4308:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4309:
+	cmpl $2155, 4(%rsp)
+	je .LB1077
+.L4310:
+.L4311:
+	cmpl $2156, 4(%rsp)
+	jne .L4312
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4313
+.L4312:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4313:
+	cmpl $2157, 4(%rsp)
+	je .LB1078
+.L4314:
+.L4315:
+	cmpl $2158, 4(%rsp)
+	jne .L4316
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4317
+.L4316:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4317:
+	cmpl $2159, 4(%rsp)
+	je .LB1079
+.L4318:
+.L4319:
+	cmpl $2160, 4(%rsp)
+	jne .L4320
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4321
+.L4320:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4321:
+	cmpl $2161, 4(%rsp)
+	je .LB1080
+.L4322:
+.L4323:
+	cmpl $2162, 4(%rsp)
+	jne .L4324
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4325
+.L4324:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4325:
+	cmpl $2163, 4(%rsp)
+	je .LB1081
+.L4326:
+.L4327:
+	cmpl $2164, 4(%rsp)
+	jne .L4328
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4329
+.L4328:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4329:
+	cmpl $2165, 4(%rsp)
+	je .LB1082
+.L4330:
+.L4331:
+	cmpl $2166, 4(%rsp)
+	jne .L4332
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4333
+.L4332:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4333:
+	cmpl $2167, 4(%rsp)
+	je .LB1083
+.L4334:
+.L4335:
+	cmpl $2168, 4(%rsp)
+	jne .L4336
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4337
+.L4336:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4337:
+	cmpl $2169, 4(%rsp)
+	je .LB1084
+.L4338:
+.L4339:
+	cmpl $2170, 4(%rsp)
+	jne .L4340
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4341
+.L4340:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4341:
+	cmpl $2171, 4(%rsp)
+	je .LB1085
+.L4342:
+.L4343:
+	cmpl $2172, 4(%rsp)
+	jne .L4344
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4345
+.L4344:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4345:
+	cmpl $2173, 4(%rsp)
+	je .LB1086
+.L4346:
+.L4347:
+	cmpl $2174, 4(%rsp)
+	jne .L4348
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4349
+.L4348:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4349:
+	cmpl $2175, 4(%rsp)
+	je .LB1087
+.L4350:
+.L4351:
+	cmpl $2176, 4(%rsp)
+	jne .L4352
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4353
+.L4352:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4353:
+	cmpl $2177, 4(%rsp)
+	je .LB1088
+.L4354:
+.L4355:
+	cmpl $2178, 4(%rsp)
+	jne .L4356
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4357
+.L4356:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4357:
+	cmpl $2179, 4(%rsp)
+	je .LB1089
+.L4358:
+.L4359:
+	cmpl $2180, 4(%rsp)
+	jne .L4360
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4361
+.L4360:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4361:
+	cmpl $2181, 4(%rsp)
+	je .LB1090
+.L4362:
+.L4363:
+	cmpl $2182, 4(%rsp)
+	jne .L4364
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4365
+.L4364:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4365:
+	cmpl $2183, 4(%rsp)
+	je .LB1091
+.L4366:
+.L4367:
+	cmpl $2184, 4(%rsp)
+	jne .L4368
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4369
+.L4368:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4369:
+	cmpl $2185, 4(%rsp)
+	je .LB1092
+.L4370:
+.L4371:
+	cmpl $2186, 4(%rsp)
+	jne .L4372
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4373
+.L4372:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4373:
+	cmpl $2187, 4(%rsp)
+	je .LB1093
+.L4374:
+.L4375:
+	cmpl $2188, 4(%rsp)
+	jne .L4376
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4377
+.L4376:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4377:
+	cmpl $2189, 4(%rsp)
+	je .LB1094
+.L4378:
+.L4379:
+	cmpl $2190, 4(%rsp)
+	jne .L4380
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4381
+.L4380:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4381:
+	cmpl $2191, 4(%rsp)
+	je .LB1095
+.L4382:
+.L4383:
+	cmpl $2192, 4(%rsp)
+	jne .L4384
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4385
+.L4384:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4385:
+	cmpl $2193, 4(%rsp)
+	je .LB1096
+.L4386:
+.L4387:
+	cmpl $2194, 4(%rsp)
+	jne .L4388
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4389
+.L4388:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4389:
+	cmpl $2195, 4(%rsp)
+	je .LB1097
+.L4390:
+.L4391:
+	cmpl $2196, 4(%rsp)
+	jne .L4392
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4393
+.L4392:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4393:
+	cmpl $2197, 4(%rsp)
+	je .LB1098
+.L4394:
+.L4395:
+	cmpl $2198, 4(%rsp)
+	jne .L4396
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4397
+.L4396:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4397:
+	cmpl $2199, 4(%rsp)
+	je .LB1099
+.L4398:
+.L4399:
+	cmpl $2200, 4(%rsp)
+	jne .L4400
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4401
+.L4400:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4401:
+	cmpl $2201, 4(%rsp)
+	je .LB1100
+.L4402:
+.L4403:
+	cmpl $2202, 4(%rsp)
+	jne .L4404
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4405
+.L4404:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4405:
+	cmpl $2203, 4(%rsp)
+	je .LB1101
+.L4406:
+.L4407:
+	cmpl $2204, 4(%rsp)
+	jne .L4408
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4409
+.L4408:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4409:
+	cmpl $2205, 4(%rsp)
+	je .LB1102
+.L4410:
+.L4411:
+	cmpl $2206, 4(%rsp)
+	jne .L4412
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4413
+.L4412:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4413:
+	cmpl $2207, 4(%rsp)
+	je .LB1103
+.L4414:
+.L4415:
+	cmpl $2208, 4(%rsp)
+	jne .L4416
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4417
+.L4416:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4417:
+	cmpl $2209, 4(%rsp)
+	je .LB1104
+.L4418:
+.L4419:
+	cmpl $2210, 4(%rsp)
+	jne .L4420
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4421
+.L4420:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4421:
+	cmpl $2211, 4(%rsp)
+	je .LB1105
+.L4422:
+.L4423:
+	cmpl $2212, 4(%rsp)
+	jne .L4424
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4425
+.L4424:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4425:
+	cmpl $2213, 4(%rsp)
+	je .LB1106
+.L4426:
+.L4427:
+	cmpl $2214, 4(%rsp)
+	jne .L4428
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4429
+.L4428:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4429:
+	cmpl $2215, 4(%rsp)
+	je .LB1107
+.L4430:
+.L4431:
+	cmpl $2216, 4(%rsp)
+	jne .L4432
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4433
+.L4432:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4433:
+	cmpl $2217, 4(%rsp)
+	je .LB1108
+.L4434:
+.L4435:
+	cmpl $2218, 4(%rsp)
+	jne .L4436
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4437
+.L4436:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4437:
+	cmpl $2219, 4(%rsp)
+	je .LB1109
+.L4438:
+.L4439:
+	cmpl $2220, 4(%rsp)
+	jne .L4440
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4441
+.L4440:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4441:
+	cmpl $2221, 4(%rsp)
+	je .LB1110
+.L4442:
+.L4443:
+	cmpl $2222, 4(%rsp)
+	jne .L4444
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4445
+.L4444:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4445:
+	cmpl $2223, 4(%rsp)
+	je .LB1111
+.L4446:
+.L4447:
+	cmpl $2224, 4(%rsp)
+	jne .L4448
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4449
+.L4448:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4449:
+	cmpl $2225, 4(%rsp)
+	je .LB1112
+.L4450:
+.L4451:
+	cmpl $2226, 4(%rsp)
+	jne .L4452
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4453
+.L4452:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4453:
+	cmpl $2227, 4(%rsp)
+	je .LB1113
+.L4454:
+.L4455:
+	cmpl $2228, 4(%rsp)
+	jne .L4456
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4457
+.L4456:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4457:
+	cmpl $2229, 4(%rsp)
+	je .LB1114
+.L4458:
+.L4459:
+	cmpl $2230, 4(%rsp)
+	jne .L4460
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4461
+.L4460:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4461:
+	cmpl $2231, 4(%rsp)
+	je .LB1115
+.L4462:
+.L4463:
+	cmpl $2232, 4(%rsp)
+	jne .L4464
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4465
+.L4464:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4465:
+	cmpl $2233, 4(%rsp)
+	je .LB1116
+.L4466:
+.L4467:
+	cmpl $2234, 4(%rsp)
+	jne .L4468
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4469
+.L4468:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4469:
+	cmpl $2235, 4(%rsp)
+	je .LB1117
+.L4470:
+.L4471:
+	cmpl $2236, 4(%rsp)
+	jne .L4472
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4473
+.L4472:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4473:
+	cmpl $2237, 4(%rsp)
+	je .LB1118
+.L4474:
+.L4475:
+	cmpl $2238, 4(%rsp)
+	jne .L4476
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4477
+.L4476:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4477:
+	cmpl $2239, 4(%rsp)
+	je .LB1119
+.L4478:
+.L4479:
+	cmpl $2240, 4(%rsp)
+	jne .L4480
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4481
+.L4480:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4481:
+	cmpl $2241, 4(%rsp)
+	je .LB1120
+.L4482:
+.L4483:
+	cmpl $2242, 4(%rsp)
+	jne .L4484
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4485
+.L4484:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4485:
+	cmpl $2243, 4(%rsp)
+	je .LB1121
+.L4486:
+.L4487:
+	cmpl $2244, 4(%rsp)
+	jne .L4488
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4489
+.L4488:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4489:
+	cmpl $2245, 4(%rsp)
+	je .LB1122
+.L4490:
+.L4491:
+	cmpl $2246, 4(%rsp)
+	jne .L4492
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4493
+.L4492:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4493:
+	cmpl $2247, 4(%rsp)
+	je .LB1123
+.L4494:
+.L4495:
+	cmpl $2248, 4(%rsp)
+	jne .L4496
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4497
+.L4496:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4497:
+	cmpl $2249, 4(%rsp)
+	je .LB1124
+.L4498:
+.L4499:
+	cmpl $2250, 4(%rsp)
+	jne .L4500
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4501
+.L4500:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4501:
+	cmpl $2251, 4(%rsp)
+	je .LB1125
+.L4502:
+.L4503:
+	cmpl $2252, 4(%rsp)
+	jne .L4504
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4505
+.L4504:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4505:
+	cmpl $2253, 4(%rsp)
+	je .LB1126
+.L4506:
+.L4507:
+	cmpl $2254, 4(%rsp)
+	jne .L4508
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4509
+.L4508:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4509:
+	cmpl $2255, 4(%rsp)
+	je .LB1127
+.L4510:
+.L4511:
+	cmpl $2256, 4(%rsp)
+	jne .L4512
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4513
+.L4512:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4513:
+	cmpl $2257, 4(%rsp)
+	je .LB1128
+.L4514:
+.L4515:
+	cmpl $2258, 4(%rsp)
+	jne .L4516
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4517
+.L4516:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4517:
+	cmpl $2259, 4(%rsp)
+	je .LB1129
+.L4518:
+.L4519:
+	cmpl $2260, 4(%rsp)
+	jne .L4520
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4521
+.L4520:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4521:
+	cmpl $2261, 4(%rsp)
+	je .LB1130
+.L4522:
+.L4523:
+	cmpl $2262, 4(%rsp)
+	jne .L4524
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4525
+.L4524:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4525:
+	cmpl $2263, 4(%rsp)
+	je .LB1131
+.L4526:
+.L4527:
+	cmpl $2264, 4(%rsp)
+	jne .L4528
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4529
+.L4528:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4529:
+	cmpl $2265, 4(%rsp)
+	je .LB1132
+.L4530:
+.L4531:
+	cmpl $2266, 4(%rsp)
+	jne .L4532
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4533
+.L4532:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4533:
+	cmpl $2267, 4(%rsp)
+	je .LB1133
+.L4534:
+.L4535:
+	cmpl $2268, 4(%rsp)
+	jne .L4536
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4537
+.L4536:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4537:
+	cmpl $2269, 4(%rsp)
+	je .LB1134
+.L4538:
+.L4539:
+	cmpl $2270, 4(%rsp)
+	jne .L4540
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4541
+.L4540:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4541:
+	cmpl $2271, 4(%rsp)
+	je .LB1135
+.L4542:
+.L4543:
+	cmpl $2272, 4(%rsp)
+	jne .L4544
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4545
+.L4544:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4545:
+	cmpl $2273, 4(%rsp)
+	je .LB1136
+.L4546:
+.L4547:
+	cmpl $2274, 4(%rsp)
+	jne .L4548
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4549
+.L4548:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4549:
+	cmpl $2275, 4(%rsp)
+	je .LB1137
+.L4550:
+.L4551:
+	cmpl $2276, 4(%rsp)
+	jne .L4552
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4553
+.L4552:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4553:
+	cmpl $2277, 4(%rsp)
+	je .LB1138
+.L4554:
+.L4555:
+	cmpl $2278, 4(%rsp)
+	jne .L4556
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4557
+.L4556:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4557:
+	cmpl $2279, 4(%rsp)
+	je .LB1139
+.L4558:
+.L4559:
+	cmpl $2280, 4(%rsp)
+	jne .L4560
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4561
+.L4560:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4561:
+	cmpl $2281, 4(%rsp)
+	je .LB1140
+.L4562:
+.L4563:
+	cmpl $2282, 4(%rsp)
+	jne .L4564
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4565
+.L4564:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4565:
+	cmpl $2283, 4(%rsp)
+	je .LB1141
+.L4566:
+.L4567:
+	cmpl $2284, 4(%rsp)
+	jne .L4568
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4569
+.L4568:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4569:
+	cmpl $2285, 4(%rsp)
+	je .LB1142
+.L4570:
+.L4571:
+	cmpl $2286, 4(%rsp)
+	jne .L4572
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4573
+.L4572:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4573:
+	cmpl $2287, 4(%rsp)
+	je .LB1143
+.L4574:
+.L4575:
+	cmpl $2288, 4(%rsp)
+	jne .L4576
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4577
+.L4576:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4577:
+	cmpl $2289, 4(%rsp)
+	je .LB1144
+.L4578:
+.L4579:
+	cmpl $2290, 4(%rsp)
+	jne .L4580
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4581
+.L4580:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4581:
+	cmpl $2291, 4(%rsp)
+	je .LB1145
+.L4582:
+.L4583:
+	cmpl $2292, 4(%rsp)
+	jne .L4584
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4585
+.L4584:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4585:
+	cmpl $2293, 4(%rsp)
+	je .LB1146
+.L4586:
+.L4587:
+	cmpl $2294, 4(%rsp)
+	jne .L4588
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4589
+.L4588:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4589:
+	cmpl $2295, 4(%rsp)
+	je .LB1147
+.L4590:
+.L4591:
+	cmpl $2296, 4(%rsp)
+	jne .L4592
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4593
+.L4592:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4593:
+	cmpl $2297, 4(%rsp)
+	je .LB1148
+.L4594:
+.L4595:
+	cmpl $2298, 4(%rsp)
+	jne .L4596
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4597
+.L4596:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4597:
+	cmpl $2299, 4(%rsp)
+	je .LB1149
+.L4598:
+.L4599:
+	cmpl $2300, 4(%rsp)
+	jne .L4600
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4601
+.L4600:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4601:
+	cmpl $2301, 4(%rsp)
+	je .LB1150
+.L4602:
+.L4603:
+	cmpl $2302, 4(%rsp)
+	jne .L4604
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4605
+.L4604:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4605:
+	cmpl $2303, 4(%rsp)
+	je .LB1151
+.L4606:
+.L4607:
+	cmpl $2304, 4(%rsp)
+	jne .L4608
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4609
+.L4608:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4609:
+	cmpl $2305, 4(%rsp)
+	je .LB1152
+.L4610:
+.L4611:
+	cmpl $2306, 4(%rsp)
+	jne .L4612
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4613
+.L4612:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4613:
+	cmpl $2307, 4(%rsp)
+	je .LB1153
+.L4614:
+.L4615:
+	cmpl $2308, 4(%rsp)
+	jne .L4616
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4617
+.L4616:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4617:
+	cmpl $2309, 4(%rsp)
+	je .LB1154
+.L4618:
+.L4619:
+	cmpl $2310, 4(%rsp)
+	jne .L4620
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4621
+.L4620:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4621:
+	cmpl $2311, 4(%rsp)
+	je .LB1155
+.L4622:
+.L4623:
+	cmpl $2312, 4(%rsp)
+	jne .L4624
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4625
+.L4624:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4625:
+	cmpl $2313, 4(%rsp)
+	je .LB1156
+.L4626:
+.L4627:
+	cmpl $2314, 4(%rsp)
+	jne .L4628
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4629
+.L4628:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4629:
+	cmpl $2315, 4(%rsp)
+	je .LB1157
+.L4630:
+.L4631:
+	cmpl $2316, 4(%rsp)
+	jne .L4632
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4633
+.L4632:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4633:
+	cmpl $2317, 4(%rsp)
+	je .LB1158
+.L4634:
+.L4635:
+	cmpl $2318, 4(%rsp)
+	jne .L4636
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4637
+.L4636:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4637:
+	cmpl $2319, 4(%rsp)
+	je .LB1159
+.L4638:
+.L4639:
+	cmpl $2320, 4(%rsp)
+	jne .L4640
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4641
+.L4640:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4641:
+	cmpl $2321, 4(%rsp)
+	je .LB1160
+.L4642:
+.L4643:
+	cmpl $2322, 4(%rsp)
+	jne .L4644
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4645
+.L4644:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4645:
+	cmpl $2323, 4(%rsp)
+	je .LB1161
+.L4646:
+.L4647:
+	cmpl $2324, 4(%rsp)
+	jne .L4648
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4649
+.L4648:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4649:
+	cmpl $2325, 4(%rsp)
+	je .LB1162
+.L4650:
+.L4651:
+	cmpl $2326, 4(%rsp)
+	jne .L4652
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4653
+.L4652:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4653:
+	cmpl $2327, 4(%rsp)
+	je .LB1163
+.L4654:
+.L4655:
+	cmpl $2328, 4(%rsp)
+	jne .L4656
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4657
+.L4656:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4657:
+	cmpl $2329, 4(%rsp)
+	je .LB1164
+.L4658:
+.L4659:
+	cmpl $2330, 4(%rsp)
+	jne .L4660
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4661
+.L4660:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4661:
+	cmpl $2331, 4(%rsp)
+	je .LB1165
+.L4662:
+.L4663:
+	cmpl $2332, 4(%rsp)
+	jne .L4664
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4665
+.L4664:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4665:
+	cmpl $2333, 4(%rsp)
+	je .LB1166
+.L4666:
+.L4667:
+	cmpl $2334, 4(%rsp)
+	jne .L4668
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4669
+.L4668:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4669:
+	cmpl $2335, 4(%rsp)
+	je .LB1167
+.L4670:
+.L4671:
+	cmpl $2336, 4(%rsp)
+	jne .L4672
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4673
+.L4672:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4673:
+	cmpl $2337, 4(%rsp)
+	je .LB1168
+.L4674:
+.L4675:
+	cmpl $2338, 4(%rsp)
+	jne .L4676
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4677
+.L4676:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4677:
+	cmpl $2339, 4(%rsp)
+	je .LB1169
+.L4678:
+.L4679:
+	cmpl $2340, 4(%rsp)
+	jne .L4680
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4681
+.L4680:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4681:
+	cmpl $2341, 4(%rsp)
+	je .LB1170
+.L4682:
+.L4683:
+	cmpl $2342, 4(%rsp)
+	jne .L4684
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4685
+.L4684:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4685:
+	cmpl $2343, 4(%rsp)
+	je .LB1171
+.L4686:
+.L4687:
+	cmpl $2344, 4(%rsp)
+	jne .L4688
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4689
+.L4688:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4689:
+	cmpl $2345, 4(%rsp)
+	je .LB1172
+.L4690:
+.L4691:
+	cmpl $2346, 4(%rsp)
+	jne .L4692
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4693
+.L4692:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4693:
+	cmpl $2347, 4(%rsp)
+	je .LB1173
+.L4694:
+.L4695:
+	cmpl $2348, 4(%rsp)
+	jne .L4696
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4697
+.L4696:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4697:
+	cmpl $2349, 4(%rsp)
+	je .LB1174
+.L4698:
+.L4699:
+	cmpl $2350, 4(%rsp)
+	jne .L4700
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4701
+.L4700:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4701:
+	cmpl $2351, 4(%rsp)
+	je .LB1175
+.L4702:
+.L4703:
+	cmpl $2352, 4(%rsp)
+	jne .L4704
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4705
+.L4704:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4705:
+	cmpl $2353, 4(%rsp)
+	je .LB1176
+.L4706:
+.L4707:
+	cmpl $2354, 4(%rsp)
+	jne .L4708
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4709
+.L4708:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4709:
+	cmpl $2355, 4(%rsp)
+	je .LB1177
+.L4710:
+.L4711:
+	cmpl $2356, 4(%rsp)
+	jne .L4712
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4713
+.L4712:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4713:
+	cmpl $2357, 4(%rsp)
+	je .LB1178
+.L4714:
+.L4715:
+	cmpl $2358, 4(%rsp)
+	jne .L4716
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4717
+.L4716:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4717:
+	cmpl $2359, 4(%rsp)
+	je .LB1179
+.L4718:
+.L4719:
+	cmpl $2360, 4(%rsp)
+	jne .L4720
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4721
+.L4720:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4721:
+	cmpl $2361, 4(%rsp)
+	je .LB1180
+.L4722:
+.L4723:
+	cmpl $2362, 4(%rsp)
+	jne .L4724
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4725
+.L4724:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4725:
+	cmpl $2363, 4(%rsp)
+	je .LB1181
+.L4726:
+.L4727:
+	cmpl $2364, 4(%rsp)
+	jne .L4728
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4729
+.L4728:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4729:
+	cmpl $2365, 4(%rsp)
+	je .LB1182
+.L4730:
+.L4731:
+	cmpl $2366, 4(%rsp)
+	jne .L4732
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4733
+.L4732:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4733:
+	cmpl $2367, 4(%rsp)
+	je .LB1183
+.L4734:
+.L4735:
+	cmpl $2368, 4(%rsp)
+	jne .L4736
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4737
+.L4736:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4737:
+	cmpl $2369, 4(%rsp)
+	je .LB1184
+.L4738:
+.L4739:
+	cmpl $2370, 4(%rsp)
+	jne .L4740
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4741
+.L4740:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4741:
+	cmpl $2371, 4(%rsp)
+	je .LB1185
+.L4742:
+.L4743:
+	cmpl $2372, 4(%rsp)
+	jne .L4744
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4745
+.L4744:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4745:
+	cmpl $2373, 4(%rsp)
+	je .LB1186
+.L4746:
+.L4747:
+	cmpl $2374, 4(%rsp)
+	jne .L4748
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4749
+.L4748:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4749:
+	cmpl $2375, 4(%rsp)
+	je .LB1187
+.L4750:
+.L4751:
+	cmpl $2376, 4(%rsp)
+	jne .L4752
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4753
+.L4752:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4753:
+	cmpl $2377, 4(%rsp)
+	je .LB1188
+.L4754:
+.L4755:
+	cmpl $2378, 4(%rsp)
+	jne .L4756
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4757
+.L4756:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4757:
+	cmpl $2379, 4(%rsp)
+	je .LB1189
+.L4758:
+.L4759:
+	cmpl $2380, 4(%rsp)
+	jne .L4760
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4761
+.L4760:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4761:
+	cmpl $2381, 4(%rsp)
+	je .LB1190
+.L4762:
+.L4763:
+	cmpl $2382, 4(%rsp)
+	jne .L4764
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4765
+.L4764:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4765:
+	cmpl $2383, 4(%rsp)
+	je .LB1191
+.L4766:
+.L4767:
+	cmpl $2384, 4(%rsp)
+	jne .L4768
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4769
+.L4768:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4769:
+	cmpl $2385, 4(%rsp)
+	je .LB1192
+.L4770:
+.L4771:
+	cmpl $2386, 4(%rsp)
+	jne .L4772
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4773
+.L4772:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4773:
+	cmpl $2387, 4(%rsp)
+	je .LB1193
+.L4774:
+.L4775:
+	cmpl $2388, 4(%rsp)
+	jne .L4776
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4777
+.L4776:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4777:
+	cmpl $2389, 4(%rsp)
+	je .LB1194
+.L4778:
+.L4779:
+	cmpl $2390, 4(%rsp)
+	jne .L4780
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4781
+.L4780:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4781:
+	cmpl $2391, 4(%rsp)
+	je .LB1195
+.L4782:
+.L4783:
+	cmpl $2392, 4(%rsp)
+	jne .L4784
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4785
+.L4784:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4785:
+	cmpl $2393, 4(%rsp)
+	je .LB1196
+.L4786:
+.L4787:
+	cmpl $2394, 4(%rsp)
+	jne .L4788
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4789
+.L4788:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4789:
+	cmpl $2395, 4(%rsp)
+	je .LB1197
+.L4790:
+.L4791:
+	cmpl $2396, 4(%rsp)
+	jne .L4792
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4793
+.L4792:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4793:
+	cmpl $2397, 4(%rsp)
+	je .LB1198
+.L4794:
+.L4795:
+	cmpl $2398, 4(%rsp)
+	jne .L4796
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4797
+.L4796:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4797:
+	cmpl $2399, 4(%rsp)
+	je .LB1199
+.L4798:
+.L4799:
+	cmpl $2400, 4(%rsp)
+	jne .L4800
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4801
+.L4800:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4801:
+	cmpl $2401, 4(%rsp)
+	je .LB1200
+.L4802:
+.L4803:
+	cmpl $2402, 4(%rsp)
+	jne .L4804
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4805
+.L4804:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4805:
+	cmpl $2403, 4(%rsp)
+	je .LB1201
+.L4806:
+.L4807:
+	cmpl $2404, 4(%rsp)
+	jne .L4808
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4809
+.L4808:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4809:
+	cmpl $2405, 4(%rsp)
+	je .LB1202
+.L4810:
+.L4811:
+	cmpl $2406, 4(%rsp)
+	jne .L4812
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4813
+.L4812:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4813:
+	cmpl $2407, 4(%rsp)
+	je .LB1203
+.L4814:
+.L4815:
+	cmpl $2408, 4(%rsp)
+	jne .L4816
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4817
+.L4816:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4817:
+	cmpl $2409, 4(%rsp)
+	je .LB1204
+.L4818:
+.L4819:
+	cmpl $2410, 4(%rsp)
+	jne .L4820
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4821
+.L4820:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4821:
+	cmpl $2411, 4(%rsp)
+	je .LB1205
+.L4822:
+.L4823:
+	cmpl $2412, 4(%rsp)
+	jne .L4824
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4825
+.L4824:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4825:
+	cmpl $2413, 4(%rsp)
+	je .LB1206
+.L4826:
+.L4827:
+	cmpl $2414, 4(%rsp)
+	jne .L4828
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4829
+.L4828:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4829:
+	cmpl $2415, 4(%rsp)
+	je .LB1207
+.L4830:
+.L4831:
+	cmpl $2416, 4(%rsp)
+	jne .L4832
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4833
+.L4832:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4833:
+	cmpl $2417, 4(%rsp)
+	je .LB1208
+.L4834:
+.L4835:
+	cmpl $2418, 4(%rsp)
+	jne .L4836
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4837
+.L4836:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4837:
+	cmpl $2419, 4(%rsp)
+	je .LB1209
+.L4838:
+.L4839:
+	cmpl $2420, 4(%rsp)
+	jne .L4840
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4841
+.L4840:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4841:
+	cmpl $2421, 4(%rsp)
+	je .LB1210
+.L4842:
+.L4843:
+	cmpl $2422, 4(%rsp)
+	jne .L4844
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4845
+.L4844:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4845:
+	cmpl $2423, 4(%rsp)
+	je .LB1211
+.L4846:
+.L4847:
+	cmpl $2424, 4(%rsp)
+	jne .L4848
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4849
+.L4848:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4849:
+	cmpl $2425, 4(%rsp)
+	je .LB1212
+.L4850:
+.L4851:
+	cmpl $2426, 4(%rsp)
+	jne .L4852
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4853
+.L4852:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4853:
+	cmpl $2427, 4(%rsp)
+	je .LB1213
+.L4854:
+.L4855:
+	cmpl $2428, 4(%rsp)
+	jne .L4856
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4857
+.L4856:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4857:
+	cmpl $2429, 4(%rsp)
+	je .LB1214
+.L4858:
+.L4859:
+	cmpl $2430, 4(%rsp)
+	jne .L4860
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4861
+.L4860:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4861:
+	cmpl $2431, 4(%rsp)
+	je .LB1215
+.L4862:
+.L4863:
+	cmpl $2432, 4(%rsp)
+	jne .L4864
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4865
+.L4864:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4865:
+	cmpl $2433, 4(%rsp)
+	je .LB1216
+.L4866:
+.L4867:
+	cmpl $2434, 4(%rsp)
+	jne .L4868
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4869
+.L4868:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4869:
+	cmpl $2435, 4(%rsp)
+	je .LB1217
+.L4870:
+.L4871:
+	cmpl $2436, 4(%rsp)
+	jne .L4872
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4873
+.L4872:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4873:
+	cmpl $2437, 4(%rsp)
+	je .LB1218
+.L4874:
+.L4875:
+	cmpl $2438, 4(%rsp)
+	jne .L4876
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4877
+.L4876:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4877:
+	cmpl $2439, 4(%rsp)
+	je .LB1219
+.L4878:
+.L4879:
+	cmpl $2440, 4(%rsp)
+	jne .L4880
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4881
+.L4880:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4881:
+	cmpl $2441, 4(%rsp)
+	je .LB1220
+.L4882:
+.L4883:
+	cmpl $2442, 4(%rsp)
+	jne .L4884
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4885
+.L4884:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4885:
+	cmpl $2443, 4(%rsp)
+	je .LB1221
+.L4886:
+.L4887:
+	cmpl $2444, 4(%rsp)
+	jne .L4888
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4889
+.L4888:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4889:
+	cmpl $2445, 4(%rsp)
+	je .LB1222
+.L4890:
+.L4891:
+	cmpl $2446, 4(%rsp)
+	jne .L4892
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4893
+.L4892:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4893:
+	cmpl $2447, 4(%rsp)
+	je .LB1223
+.L4894:
+.L4895:
+	cmpl $2448, 4(%rsp)
+	jne .L4896
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4897
+.L4896:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4897:
+	cmpl $2449, 4(%rsp)
+	je .LB1224
+.L4898:
+.L4899:
+	cmpl $2450, 4(%rsp)
+	jne .L4900
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4901
+.L4900:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4901:
+	cmpl $2451, 4(%rsp)
+	je .LB1225
+.L4902:
+.L4903:
+	cmpl $2452, 4(%rsp)
+	jne .L4904
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4905
+.L4904:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4905:
+	cmpl $2453, 4(%rsp)
+	je .LB1226
+.L4906:
+.L4907:
+	cmpl $2454, 4(%rsp)
+	jne .L4908
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4909
+.L4908:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4909:
+	cmpl $2455, 4(%rsp)
+	je .LB1227
+.L4910:
+.L4911:
+	cmpl $2456, 4(%rsp)
+	jne .L4912
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4913
+.L4912:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4913:
+	cmpl $2457, 4(%rsp)
+	je .LB1228
+.L4914:
+.L4915:
+	cmpl $2458, 4(%rsp)
+	jne .L4916
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4917
+.L4916:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4917:
+	cmpl $2459, 4(%rsp)
+	je .LB1229
+.L4918:
+.L4919:
+	cmpl $2460, 4(%rsp)
+	jne .L4920
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4921
+.L4920:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4921:
+	cmpl $2461, 4(%rsp)
+	je .LB1230
+.L4922:
+.L4923:
+	cmpl $2462, 4(%rsp)
+	jne .L4924
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4925
+.L4924:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4925:
+	cmpl $2463, 4(%rsp)
+	je .LB1231
+.L4926:
+.L4927:
+	cmpl $2464, 4(%rsp)
+	jne .L4928
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4929
+.L4928:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4929:
+	cmpl $2465, 4(%rsp)
+	je .LB1232
+.L4930:
+.L4931:
+	cmpl $2466, 4(%rsp)
+	jne .L4932
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4933
+.L4932:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4933:
+	cmpl $2467, 4(%rsp)
+	je .LB1233
+.L4934:
+.L4935:
+	cmpl $2468, 4(%rsp)
+	jne .L4936
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4937
+.L4936:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4937:
+	cmpl $2469, 4(%rsp)
+	je .LB1234
+.L4938:
+.L4939:
+	cmpl $2470, 4(%rsp)
+	jne .L4940
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4941
+.L4940:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4941:
+	cmpl $2471, 4(%rsp)
+	je .LB1235
+.L4942:
+.L4943:
+	cmpl $2472, 4(%rsp)
+	jne .L4944
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4945
+.L4944:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4945:
+	cmpl $2473, 4(%rsp)
+	je .LB1236
+.L4946:
+.L4947:
+	cmpl $2474, 4(%rsp)
+	jne .L4948
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4949
+.L4948:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4949:
+	cmpl $2475, 4(%rsp)
+	je .LB1237
+.L4950:
+.L4951:
+	cmpl $2476, 4(%rsp)
+	jne .L4952
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4953
+.L4952:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4953:
+	cmpl $2477, 4(%rsp)
+	je .LB1238
+.L4954:
+.L4955:
+	cmpl $2478, 4(%rsp)
+	jne .L4956
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4957
+.L4956:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4957:
+	cmpl $2479, 4(%rsp)
+	je .LB1239
+.L4958:
+.L4959:
+	cmpl $2480, 4(%rsp)
+	jne .L4960
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4961
+.L4960:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4961:
+	cmpl $2481, 4(%rsp)
+	je .LB1240
+.L4962:
+.L4963:
+	cmpl $2482, 4(%rsp)
+	jne .L4964
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4965
+.L4964:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4965:
+	cmpl $2483, 4(%rsp)
+	je .LB1241
+.L4966:
+.L4967:
+	cmpl $2484, 4(%rsp)
+	jne .L4968
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4969
+.L4968:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4969:
+	cmpl $2485, 4(%rsp)
+	je .LB1242
+.L4970:
+.L4971:
+	cmpl $2486, 4(%rsp)
+	jne .L4972
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4973
+.L4972:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4973:
+	cmpl $2487, 4(%rsp)
+	je .LB1243
+.L4974:
+.L4975:
+	cmpl $2488, 4(%rsp)
+	jne .L4976
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4977
+.L4976:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4977:
+	cmpl $2489, 4(%rsp)
+	je .LB1244
+.L4978:
+.L4979:
+	cmpl $2490, 4(%rsp)
+	jne .L4980
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4981
+.L4980:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4981:
+	cmpl $2491, 4(%rsp)
+	je .LB1245
+.L4982:
+.L4983:
+	cmpl $2492, 4(%rsp)
+	jne .L4984
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4985
+.L4984:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4985:
+	cmpl $2493, 4(%rsp)
+	je .LB1246
+.L4986:
+.L4987:
+	cmpl $2494, 4(%rsp)
+	jne .L4988
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4989
+.L4988:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4989:
+	cmpl $2495, 4(%rsp)
+	je .LB1247
+.L4990:
+.L4991:
+	cmpl $2496, 4(%rsp)
+	jne .L4992
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4993
+.L4992:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4993:
+	cmpl $2497, 4(%rsp)
+	je .LB1248
+.L4994:
+.L4995:
+	cmpl $2498, 4(%rsp)
+	jne .L4996
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L4997
+.L4996:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L4997:
+	cmpl $2499, 4(%rsp)
+	je .LB1249
+.L4998:
+.L4999:
+	cmpl $2500, 4(%rsp)
+	jne .L5000
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5001
+.L5000:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5001:
+	cmpl $2501, 4(%rsp)
+	je .LB1250
+.L5002:
+.L5003:
+	cmpl $2502, 4(%rsp)
+	jne .L5004
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5005
+.L5004:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5005:
+	cmpl $2503, 4(%rsp)
+	je .LB1251
+.L5006:
+.L5007:
+	cmpl $2504, 4(%rsp)
+	jne .L5008
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5009
+.L5008:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5009:
+	cmpl $2505, 4(%rsp)
+	je .LB1252
+.L5010:
+.L5011:
+	cmpl $2506, 4(%rsp)
+	jne .L5012
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5013
+.L5012:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5013:
+	cmpl $2507, 4(%rsp)
+	je .LB1253
+.L5014:
+.L5015:
+	cmpl $2508, 4(%rsp)
+	jne .L5016
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5017
+.L5016:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5017:
+	cmpl $2509, 4(%rsp)
+	je .LB1254
+.L5018:
+.L5019:
+	cmpl $2510, 4(%rsp)
+	jne .L5020
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5021
+.L5020:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5021:
+	cmpl $2511, 4(%rsp)
+	je .LB1255
+.L5022:
+.L5023:
+	cmpl $2512, 4(%rsp)
+	jne .L5024
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5025
+.L5024:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5025:
+	cmpl $2513, 4(%rsp)
+	je .LB1256
+.L5026:
+.L5027:
+	cmpl $2514, 4(%rsp)
+	jne .L5028
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5029
+.L5028:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5029:
+	cmpl $2515, 4(%rsp)
+	je .LB1257
+.L5030:
+.L5031:
+	cmpl $2516, 4(%rsp)
+	jne .L5032
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5033
+.L5032:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5033:
+	cmpl $2517, 4(%rsp)
+	je .LB1258
+.L5034:
+.L5035:
+	cmpl $2518, 4(%rsp)
+	jne .L5036
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5037
+.L5036:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5037:
+	cmpl $2519, 4(%rsp)
+	je .LB1259
+.L5038:
+.L5039:
+	cmpl $2520, 4(%rsp)
+	jne .L5040
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5041
+.L5040:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5041:
+	cmpl $2521, 4(%rsp)
+	je .LB1260
+.L5042:
+.L5043:
+	cmpl $2522, 4(%rsp)
+	jne .L5044
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5045
+.L5044:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5045:
+	cmpl $2523, 4(%rsp)
+	je .LB1261
+.L5046:
+.L5047:
+	cmpl $2524, 4(%rsp)
+	jne .L5048
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5049
+.L5048:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5049:
+	cmpl $2525, 4(%rsp)
+	je .LB1262
+.L5050:
+.L5051:
+	cmpl $2526, 4(%rsp)
+	jne .L5052
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5053
+.L5052:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5053:
+	cmpl $2527, 4(%rsp)
+	je .LB1263
+.L5054:
+.L5055:
+	cmpl $2528, 4(%rsp)
+	jne .L5056
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5057
+.L5056:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5057:
+	cmpl $2529, 4(%rsp)
+	je .LB1264
+.L5058:
+.L5059:
+	cmpl $2530, 4(%rsp)
+	jne .L5060
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5061
+.L5060:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5061:
+	cmpl $2531, 4(%rsp)
+	je .LB1265
+.L5062:
+.L5063:
+	cmpl $2532, 4(%rsp)
+	jne .L5064
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5065
+.L5064:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5065:
+	cmpl $2533, 4(%rsp)
+	je .LB1266
+.L5066:
+.L5067:
+	cmpl $2534, 4(%rsp)
+	jne .L5068
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5069
+.L5068:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5069:
+	cmpl $2535, 4(%rsp)
+	je .LB1267
+.L5070:
+.L5071:
+	cmpl $2536, 4(%rsp)
+	jne .L5072
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5073
+.L5072:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5073:
+	cmpl $2537, 4(%rsp)
+	je .LB1268
+.L5074:
+.L5075:
+	cmpl $2538, 4(%rsp)
+	jne .L5076
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5077
+.L5076:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5077:
+	cmpl $2539, 4(%rsp)
+	je .LB1269
+.L5078:
+.L5079:
+	cmpl $2540, 4(%rsp)
+	jne .L5080
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5081
+.L5080:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5081:
+	cmpl $2541, 4(%rsp)
+	je .LB1270
+.L5082:
+.L5083:
+	cmpl $2542, 4(%rsp)
+	jne .L5084
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5085
+.L5084:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5085:
+	cmpl $2543, 4(%rsp)
+	je .LB1271
+.L5086:
+.L5087:
+	cmpl $2544, 4(%rsp)
+	jne .L5088
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5089
+.L5088:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5089:
+	cmpl $2545, 4(%rsp)
+	je .LB1272
+.L5090:
+.L5091:
+	cmpl $2546, 4(%rsp)
+	jne .L5092
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5093
+.L5092:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5093:
+	cmpl $2547, 4(%rsp)
+	je .LB1273
+.L5094:
+.L5095:
+	cmpl $2548, 4(%rsp)
+	jne .L5096
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5097
+.L5096:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5097:
+	cmpl $2549, 4(%rsp)
+	je .LB1274
+.L5098:
+.L5099:
+	cmpl $2550, 4(%rsp)
+	jne .L5100
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5101
+.L5100:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5101:
+	cmpl $2551, 4(%rsp)
+	je .LB1275
+.L5102:
+.L5103:
+	cmpl $2552, 4(%rsp)
+	jne .L5104
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5105
+.L5104:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5105:
+	cmpl $2553, 4(%rsp)
+	je .LB1276
+.L5106:
+.L5107:
+	cmpl $2554, 4(%rsp)
+	jne .L5108
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5109
+.L5108:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5109:
+	cmpl $2555, 4(%rsp)
+	je .LB1277
+.L5110:
+.L5111:
+	cmpl $2556, 4(%rsp)
+	jne .L5112
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5113
+.L5112:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5113:
+	cmpl $2557, 4(%rsp)
+	je .LB1278
+.L5114:
+.L5115:
+	cmpl $2558, 4(%rsp)
+	jne .L5116
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5117
+.L5116:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5117:
+	cmpl $2559, 4(%rsp)
+	je .LB1279
+.L5118:
+.L5119:
+	cmpl $2560, 4(%rsp)
+	jne .L5120
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5121
+.L5120:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5121:
+	cmpl $2561, 4(%rsp)
+	je .LB1280
+.L5122:
+.L5123:
+	cmpl $2562, 4(%rsp)
+	jne .L5124
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5125
+.L5124:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5125:
+	cmpl $2563, 4(%rsp)
+	je .LB1281
+.L5126:
+.L5127:
+	cmpl $2564, 4(%rsp)
+	jne .L5128
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5129
+.L5128:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5129:
+	cmpl $2565, 4(%rsp)
+	je .LB1282
+.L5130:
+.L5131:
+	cmpl $2566, 4(%rsp)
+	jne .L5132
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5133
+.L5132:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5133:
+	cmpl $2567, 4(%rsp)
+	je .LB1283
+.L5134:
+.L5135:
+	cmpl $2568, 4(%rsp)
+	jne .L5136
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5137
+.L5136:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5137:
+	cmpl $2569, 4(%rsp)
+	je .LB1284
+.L5138:
+.L5139:
+	cmpl $2570, 4(%rsp)
+	jne .L5140
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5141
+.L5140:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5141:
+	cmpl $2571, 4(%rsp)
+	je .LB1285
+.L5142:
+.L5143:
+	cmpl $2572, 4(%rsp)
+	jne .L5144
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5145
+.L5144:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5145:
+	cmpl $2573, 4(%rsp)
+	je .LB1286
+.L5146:
+.L5147:
+	cmpl $2574, 4(%rsp)
+	jne .L5148
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5149
+.L5148:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5149:
+	cmpl $2575, 4(%rsp)
+	je .LB1287
+.L5150:
+.L5151:
+	cmpl $2576, 4(%rsp)
+	jne .L5152
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5153
+.L5152:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5153:
+	cmpl $2577, 4(%rsp)
+	je .LB1288
+.L5154:
+.L5155:
+	cmpl $2578, 4(%rsp)
+	jne .L5156
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5157
+.L5156:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5157:
+	cmpl $2579, 4(%rsp)
+	je .LB1289
+.L5158:
+.L5159:
+	cmpl $2580, 4(%rsp)
+	jne .L5160
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5161
+.L5160:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5161:
+	cmpl $2581, 4(%rsp)
+	je .LB1290
+.L5162:
+.L5163:
+	cmpl $2582, 4(%rsp)
+	jne .L5164
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5165
+.L5164:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5165:
+	cmpl $2583, 4(%rsp)
+	je .LB1291
+.L5166:
+.L5167:
+	cmpl $2584, 4(%rsp)
+	jne .L5168
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5169
+.L5168:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5169:
+	cmpl $2585, 4(%rsp)
+	je .LB1292
+.L5170:
+.L5171:
+	cmpl $2586, 4(%rsp)
+	jne .L5172
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5173
+.L5172:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5173:
+	cmpl $2587, 4(%rsp)
+	je .LB1293
+.L5174:
+.L5175:
+	cmpl $2588, 4(%rsp)
+	jne .L5176
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5177
+.L5176:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5177:
+	cmpl $2589, 4(%rsp)
+	je .LB1294
+.L5178:
+.L5179:
+	cmpl $2590, 4(%rsp)
+	jne .L5180
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5181
+.L5180:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5181:
+	cmpl $2591, 4(%rsp)
+	je .LB1295
+.L5182:
+.L5183:
+	cmpl $2592, 4(%rsp)
+	jne .L5184
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5185
+.L5184:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5185:
+	cmpl $2593, 4(%rsp)
+	je .LB1296
+.L5186:
+.L5187:
+	cmpl $2594, 4(%rsp)
+	jne .L5188
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5189
+.L5188:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5189:
+	cmpl $2595, 4(%rsp)
+	je .LB1297
+.L5190:
+.L5191:
+	cmpl $2596, 4(%rsp)
+	jne .L5192
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5193
+.L5192:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5193:
+	cmpl $2597, 4(%rsp)
+	je .LB1298
+.L5194:
+.L5195:
+	cmpl $2598, 4(%rsp)
+	jne .L5196
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5197
+.L5196:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5197:
+	cmpl $2599, 4(%rsp)
+	je .LB1299
+.L5198:
+.L5199:
+	cmpl $2600, 4(%rsp)
+	jne .L5200
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5201
+.L5200:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5201:
+	cmpl $2601, 4(%rsp)
+	je .LB1300
+.L5202:
+.L5203:
+	cmpl $2602, 4(%rsp)
+	jne .L5204
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5205
+.L5204:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5205:
+	cmpl $2603, 4(%rsp)
+	je .LB1301
+.L5206:
+.L5207:
+	cmpl $2604, 4(%rsp)
+	jne .L5208
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5209
+.L5208:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5209:
+	cmpl $2605, 4(%rsp)
+	je .LB1302
+.L5210:
+.L5211:
+	cmpl $2606, 4(%rsp)
+	jne .L5212
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5213
+.L5212:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5213:
+	cmpl $2607, 4(%rsp)
+	je .LB1303
+.L5214:
+.L5215:
+	cmpl $2608, 4(%rsp)
+	jne .L5216
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5217
+.L5216:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5217:
+	cmpl $2609, 4(%rsp)
+	je .LB1304
+.L5218:
+.L5219:
+	cmpl $2610, 4(%rsp)
+	jne .L5220
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5221
+.L5220:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5221:
+	cmpl $2611, 4(%rsp)
+	je .LB1305
+.L5222:
+.L5223:
+	cmpl $2612, 4(%rsp)
+	jne .L5224
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5225
+.L5224:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5225:
+	cmpl $2613, 4(%rsp)
+	je .LB1306
+.L5226:
+.L5227:
+	cmpl $2614, 4(%rsp)
+	jne .L5228
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5229
+.L5228:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5229:
+	cmpl $2615, 4(%rsp)
+	je .LB1307
+.L5230:
+.L5231:
+	cmpl $2616, 4(%rsp)
+	jne .L5232
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5233
+.L5232:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5233:
+	cmpl $2617, 4(%rsp)
+	je .LB1308
+.L5234:
+.L5235:
+	cmpl $2618, 4(%rsp)
+	jne .L5236
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5237
+.L5236:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5237:
+	cmpl $2619, 4(%rsp)
+	je .LB1309
+.L5238:
+.L5239:
+	cmpl $2620, 4(%rsp)
+	jne .L5240
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5241
+.L5240:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5241:
+	cmpl $2621, 4(%rsp)
+	je .LB1310
+.L5242:
+.L5243:
+	cmpl $2622, 4(%rsp)
+	jne .L5244
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5245
+.L5244:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5245:
+	cmpl $2623, 4(%rsp)
+	je .LB1311
+.L5246:
+.L5247:
+	cmpl $2624, 4(%rsp)
+	jne .L5248
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5249
+.L5248:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5249:
+	cmpl $2625, 4(%rsp)
+	je .LB1312
+.L5250:
+.L5251:
+	cmpl $2626, 4(%rsp)
+	jne .L5252
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5253
+.L5252:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5253:
+	cmpl $2627, 4(%rsp)
+	je .LB1313
+.L5254:
+.L5255:
+	cmpl $2628, 4(%rsp)
+	jne .L5256
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5257
+.L5256:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5257:
+	cmpl $2629, 4(%rsp)
+	je .LB1314
+.L5258:
+.L5259:
+	cmpl $2630, 4(%rsp)
+	jne .L5260
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5261
+.L5260:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5261:
+	cmpl $2631, 4(%rsp)
+	je .LB1315
+.L5262:
+.L5263:
+	cmpl $2632, 4(%rsp)
+	jne .L5264
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5265
+.L5264:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5265:
+	cmpl $2633, 4(%rsp)
+	je .LB1316
+.L5266:
+.L5267:
+	cmpl $2634, 4(%rsp)
+	jne .L5268
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5269
+.L5268:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5269:
+	cmpl $2635, 4(%rsp)
+	je .LB1317
+.L5270:
+.L5271:
+	cmpl $2636, 4(%rsp)
+	jne .L5272
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5273
+.L5272:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5273:
+	cmpl $2637, 4(%rsp)
+	je .LB1318
+.L5274:
+.L5275:
+	cmpl $2638, 4(%rsp)
+	jne .L5276
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5277
+.L5276:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5277:
+	cmpl $2639, 4(%rsp)
+	je .LB1319
+.L5278:
+.L5279:
+	cmpl $2640, 4(%rsp)
+	jne .L5280
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5281
+.L5280:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5281:
+	cmpl $2641, 4(%rsp)
+	je .LB1320
+.L5282:
+.L5283:
+	cmpl $2642, 4(%rsp)
+	jne .L5284
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5285
+.L5284:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5285:
+	cmpl $2643, 4(%rsp)
+	je .LB1321
+.L5286:
+.L5287:
+	cmpl $2644, 4(%rsp)
+	jne .L5288
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5289
+.L5288:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5289:
+	cmpl $2645, 4(%rsp)
+	je .LB1322
+.L5290:
+.L5291:
+	cmpl $2646, 4(%rsp)
+	jne .L5292
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5293
+.L5292:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5293:
+	cmpl $2647, 4(%rsp)
+	je .LB1323
+.L5294:
+.L5295:
+	cmpl $2648, 4(%rsp)
+	jne .L5296
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5297
+.L5296:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5297:
+	cmpl $2649, 4(%rsp)
+	je .LB1324
+.L5298:
+.L5299:
+	cmpl $2650, 4(%rsp)
+	jne .L5300
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5301
+.L5300:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5301:
+	cmpl $2651, 4(%rsp)
+	je .LB1325
+.L5302:
+.L5303:
+	cmpl $2652, 4(%rsp)
+	jne .L5304
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5305
+.L5304:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5305:
+	cmpl $2653, 4(%rsp)
+	je .LB1326
+.L5306:
+.L5307:
+	cmpl $2654, 4(%rsp)
+	jne .L5308
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5309
+.L5308:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5309:
+	cmpl $2655, 4(%rsp)
+	je .LB1327
+.L5310:
+.L5311:
+	cmpl $2656, 4(%rsp)
+	jne .L5312
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5313
+.L5312:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5313:
+	cmpl $2657, 4(%rsp)
+	je .LB1328
+.L5314:
+.L5315:
+	cmpl $2658, 4(%rsp)
+	jne .L5316
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5317
+.L5316:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5317:
+	cmpl $2659, 4(%rsp)
+	je .LB1329
+.L5318:
+.L5319:
+	cmpl $2660, 4(%rsp)
+	jne .L5320
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5321
+.L5320:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5321:
+	cmpl $2661, 4(%rsp)
+	je .LB1330
+.L5322:
+.L5323:
+	cmpl $2662, 4(%rsp)
+	jne .L5324
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5325
+.L5324:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5325:
+	cmpl $2663, 4(%rsp)
+	je .LB1331
+.L5326:
+.L5327:
+	cmpl $2664, 4(%rsp)
+	jne .L5328
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5329
+.L5328:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5329:
+	cmpl $2665, 4(%rsp)
+	je .LB1332
+.L5330:
+.L5331:
+	cmpl $2666, 4(%rsp)
+	jne .L5332
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5333
+.L5332:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5333:
+	cmpl $2667, 4(%rsp)
+	je .LB1333
+.L5334:
+.L5335:
+	cmpl $2668, 4(%rsp)
+	jne .L5336
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5337
+.L5336:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5337:
+	cmpl $2669, 4(%rsp)
+	je .LB1334
+.L5338:
+.L5339:
+	cmpl $2670, 4(%rsp)
+	jne .L5340
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5341
+.L5340:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5341:
+	cmpl $2671, 4(%rsp)
+	je .LB1335
+.L5342:
+.L5343:
+	cmpl $2672, 4(%rsp)
+	jne .L5344
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5345
+.L5344:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5345:
+	cmpl $2673, 4(%rsp)
+	je .LB1336
+.L5346:
+.L5347:
+	cmpl $2674, 4(%rsp)
+	jne .L5348
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5349
+.L5348:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5349:
+	cmpl $2675, 4(%rsp)
+	je .LB1337
+.L5350:
+.L5351:
+	cmpl $2676, 4(%rsp)
+	jne .L5352
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5353
+.L5352:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5353:
+	cmpl $2677, 4(%rsp)
+	je .LB1338
+.L5354:
+.L5355:
+	cmpl $2678, 4(%rsp)
+	jne .L5356
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5357
+.L5356:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5357:
+	cmpl $2679, 4(%rsp)
+	je .LB1339
+.L5358:
+.L5359:
+	cmpl $2680, 4(%rsp)
+	jne .L5360
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5361
+.L5360:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5361:
+	cmpl $2681, 4(%rsp)
+	je .LB1340
+.L5362:
+.L5363:
+	cmpl $2682, 4(%rsp)
+	jne .L5364
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5365
+.L5364:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5365:
+	cmpl $2683, 4(%rsp)
+	je .LB1341
+.L5366:
+.L5367:
+	cmpl $2684, 4(%rsp)
+	jne .L5368
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5369
+.L5368:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5369:
+	cmpl $2685, 4(%rsp)
+	je .LB1342
+.L5370:
+.L5371:
+	cmpl $2686, 4(%rsp)
+	jne .L5372
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5373
+.L5372:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5373:
+	cmpl $2687, 4(%rsp)
+	je .LB1343
+.L5374:
+.L5375:
+	cmpl $2688, 4(%rsp)
+	jne .L5376
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5377
+.L5376:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5377:
+	cmpl $2689, 4(%rsp)
+	je .LB1344
+.L5378:
+.L5379:
+	cmpl $2690, 4(%rsp)
+	jne .L5380
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5381
+.L5380:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5381:
+	cmpl $2691, 4(%rsp)
+	je .LB1345
+.L5382:
+.L5383:
+	cmpl $2692, 4(%rsp)
+	jne .L5384
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5385
+.L5384:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5385:
+	cmpl $2693, 4(%rsp)
+	je .LB1346
+.L5386:
+.L5387:
+	cmpl $2694, 4(%rsp)
+	jne .L5388
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5389
+.L5388:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5389:
+	cmpl $2695, 4(%rsp)
+	je .LB1347
+.L5390:
+.L5391:
+	cmpl $2696, 4(%rsp)
+	jne .L5392
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5393
+.L5392:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5393:
+	cmpl $2697, 4(%rsp)
+	je .LB1348
+.L5394:
+.L5395:
+	cmpl $2698, 4(%rsp)
+	jne .L5396
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5397
+.L5396:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5397:
+	cmpl $2699, 4(%rsp)
+	je .LB1349
+.L5398:
+.L5399:
+	cmpl $2700, 4(%rsp)
+	jne .L5400
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5401
+.L5400:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5401:
+	cmpl $2701, 4(%rsp)
+	je .LB1350
+.L5402:
+.L5403:
+	cmpl $2702, 4(%rsp)
+	jne .L5404
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5405
+.L5404:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5405:
+	cmpl $2703, 4(%rsp)
+	je .LB1351
+.L5406:
+.L5407:
+	cmpl $2704, 4(%rsp)
+	jne .L5408
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5409
+.L5408:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5409:
+	cmpl $2705, 4(%rsp)
+	je .LB1352
+.L5410:
+.L5411:
+	cmpl $2706, 4(%rsp)
+	jne .L5412
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5413
+.L5412:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5413:
+	cmpl $2707, 4(%rsp)
+	je .LB1353
+.L5414:
+.L5415:
+	cmpl $2708, 4(%rsp)
+	jne .L5416
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5417
+.L5416:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5417:
+	cmpl $2709, 4(%rsp)
+	je .LB1354
+.L5418:
+.L5419:
+	cmpl $2710, 4(%rsp)
+	jne .L5420
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5421
+.L5420:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5421:
+	cmpl $2711, 4(%rsp)
+	je .LB1355
+.L5422:
+.L5423:
+	cmpl $2712, 4(%rsp)
+	jne .L5424
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5425
+.L5424:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5425:
+	cmpl $2713, 4(%rsp)
+	je .LB1356
+.L5426:
+.L5427:
+	cmpl $2714, 4(%rsp)
+	jne .L5428
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5429
+.L5428:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5429:
+	cmpl $2715, 4(%rsp)
+	je .LB1357
+.L5430:
+.L5431:
+	cmpl $2716, 4(%rsp)
+	jne .L5432
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5433
+.L5432:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5433:
+	cmpl $2717, 4(%rsp)
+	je .LB1358
+.L5434:
+.L5435:
+	cmpl $2718, 4(%rsp)
+	jne .L5436
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5437
+.L5436:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5437:
+	cmpl $2719, 4(%rsp)
+	je .LB1359
+.L5438:
+.L5439:
+	cmpl $2720, 4(%rsp)
+	jne .L5440
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5441
+.L5440:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5441:
+	cmpl $2721, 4(%rsp)
+	je .LB1360
+.L5442:
+.L5443:
+	cmpl $2722, 4(%rsp)
+	jne .L5444
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5445
+.L5444:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5445:
+	cmpl $2723, 4(%rsp)
+	je .LB1361
+.L5446:
+.L5447:
+	cmpl $2724, 4(%rsp)
+	jne .L5448
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5449
+.L5448:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5449:
+	cmpl $2725, 4(%rsp)
+	je .LB1362
+.L5450:
+.L5451:
+	cmpl $2726, 4(%rsp)
+	jne .L5452
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5453
+.L5452:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5453:
+	cmpl $2727, 4(%rsp)
+	je .LB1363
+.L5454:
+.L5455:
+	cmpl $2728, 4(%rsp)
+	jne .L5456
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5457
+.L5456:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5457:
+	cmpl $2729, 4(%rsp)
+	je .LB1364
+.L5458:
+.L5459:
+	cmpl $2730, 4(%rsp)
+	jne .L5460
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5461
+.L5460:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5461:
+	cmpl $2731, 4(%rsp)
+	je .LB1365
+.L5462:
+.L5463:
+	cmpl $2732, 4(%rsp)
+	jne .L5464
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5465
+.L5464:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5465:
+	cmpl $2733, 4(%rsp)
+	je .LB1366
+.L5466:
+.L5467:
+	cmpl $2734, 4(%rsp)
+	jne .L5468
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5469
+.L5468:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5469:
+	cmpl $2735, 4(%rsp)
+	je .LB1367
+.L5470:
+.L5471:
+	cmpl $2736, 4(%rsp)
+	jne .L5472
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5473
+.L5472:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5473:
+	cmpl $2737, 4(%rsp)
+	je .LB1368
+.L5474:
+.L5475:
+	cmpl $2738, 4(%rsp)
+	jne .L5476
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5477
+.L5476:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5477:
+	cmpl $2739, 4(%rsp)
+	je .LB1369
+.L5478:
+.L5479:
+	cmpl $2740, 4(%rsp)
+	jne .L5480
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5481
+.L5480:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5481:
+	cmpl $2741, 4(%rsp)
+	je .LB1370
+.L5482:
+.L5483:
+	cmpl $2742, 4(%rsp)
+	jne .L5484
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5485
+.L5484:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5485:
+	cmpl $2743, 4(%rsp)
+	je .LB1371
+.L5486:
+.L5487:
+	cmpl $2744, 4(%rsp)
+	jne .L5488
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5489
+.L5488:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5489:
+	cmpl $2745, 4(%rsp)
+	je .LB1372
+.L5490:
+.L5491:
+	cmpl $2746, 4(%rsp)
+	jne .L5492
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5493
+.L5492:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5493:
+	cmpl $2747, 4(%rsp)
+	je .LB1373
+.L5494:
+.L5495:
+	cmpl $2748, 4(%rsp)
+	jne .L5496
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5497
+.L5496:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5497:
+	cmpl $2749, 4(%rsp)
+	je .LB1374
+.L5498:
+.L5499:
+	cmpl $2750, 4(%rsp)
+	jne .L5500
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5501
+.L5500:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5501:
+	cmpl $2751, 4(%rsp)
+	je .LB1375
+.L5502:
+.L5503:
+	cmpl $2752, 4(%rsp)
+	jne .L5504
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5505
+.L5504:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5505:
+	cmpl $2753, 4(%rsp)
+	je .LB1376
+.L5506:
+.L5507:
+	cmpl $2754, 4(%rsp)
+	jne .L5508
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5509
+.L5508:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5509:
+	cmpl $2755, 4(%rsp)
+	je .LB1377
+.L5510:
+.L5511:
+	cmpl $2756, 4(%rsp)
+	jne .L5512
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5513
+.L5512:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5513:
+	cmpl $2757, 4(%rsp)
+	je .LB1378
+.L5514:
+.L5515:
+	cmpl $2758, 4(%rsp)
+	jne .L5516
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5517
+.L5516:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5517:
+	cmpl $2759, 4(%rsp)
+	je .LB1379
+.L5518:
+.L5519:
+	cmpl $2760, 4(%rsp)
+	jne .L5520
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5521
+.L5520:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5521:
+	cmpl $2761, 4(%rsp)
+	je .LB1380
+.L5522:
+.L5523:
+	cmpl $2762, 4(%rsp)
+	jne .L5524
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5525
+.L5524:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5525:
+	cmpl $2763, 4(%rsp)
+	je .LB1381
+.L5526:
+.L5527:
+	cmpl $2764, 4(%rsp)
+	jne .L5528
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5529
+.L5528:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5529:
+	cmpl $2765, 4(%rsp)
+	je .LB1382
+.L5530:
+.L5531:
+	cmpl $2766, 4(%rsp)
+	jne .L5532
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5533
+.L5532:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5533:
+	cmpl $2767, 4(%rsp)
+	je .LB1383
+.L5534:
+.L5535:
+	cmpl $2768, 4(%rsp)
+	jne .L5536
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5537
+.L5536:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5537:
+	cmpl $2769, 4(%rsp)
+	je .LB1384
+.L5538:
+.L5539:
+	cmpl $2770, 4(%rsp)
+	jne .L5540
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5541
+.L5540:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5541:
+	cmpl $2771, 4(%rsp)
+	je .LB1385
+.L5542:
+.L5543:
+	cmpl $2772, 4(%rsp)
+	jne .L5544
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5545
+.L5544:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5545:
+	cmpl $2773, 4(%rsp)
+	je .LB1386
+.L5546:
+.L5547:
+	cmpl $2774, 4(%rsp)
+	jne .L5548
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5549
+.L5548:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5549:
+	cmpl $2775, 4(%rsp)
+	je .LB1387
+.L5550:
+.L5551:
+	cmpl $2776, 4(%rsp)
+	jne .L5552
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5553
+.L5552:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5553:
+	cmpl $2777, 4(%rsp)
+	je .LB1388
+.L5554:
+.L5555:
+	cmpl $2778, 4(%rsp)
+	jne .L5556
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5557
+.L5556:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5557:
+	cmpl $2779, 4(%rsp)
+	je .LB1389
+.L5558:
+.L5559:
+	cmpl $2780, 4(%rsp)
+	jne .L5560
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5561
+.L5560:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5561:
+	cmpl $2781, 4(%rsp)
+	je .LB1390
+.L5562:
+.L5563:
+	cmpl $2782, 4(%rsp)
+	jne .L5564
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5565
+.L5564:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5565:
+	cmpl $2783, 4(%rsp)
+	je .LB1391
+.L5566:
+.L5567:
+	cmpl $2784, 4(%rsp)
+	jne .L5568
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5569
+.L5568:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5569:
+	cmpl $2785, 4(%rsp)
+	je .LB1392
+.L5570:
+.L5571:
+	cmpl $2786, 4(%rsp)
+	jne .L5572
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5573
+.L5572:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5573:
+	cmpl $2787, 4(%rsp)
+	je .LB1393
+.L5574:
+.L5575:
+	cmpl $2788, 4(%rsp)
+	jne .L5576
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5577
+.L5576:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5577:
+	cmpl $2789, 4(%rsp)
+	je .LB1394
+.L5578:
+.L5579:
+	cmpl $2790, 4(%rsp)
+	jne .L5580
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5581
+.L5580:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5581:
+	cmpl $2791, 4(%rsp)
+	je .LB1395
+.L5582:
+.L5583:
+	cmpl $2792, 4(%rsp)
+	jne .L5584
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5585
+.L5584:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5585:
+	cmpl $2793, 4(%rsp)
+	je .LB1396
+.L5586:
+.L5587:
+	cmpl $2794, 4(%rsp)
+	jne .L5588
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5589
+.L5588:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5589:
+	cmpl $2795, 4(%rsp)
+	je .LB1397
+.L5590:
+.L5591:
+	cmpl $2796, 4(%rsp)
+	jne .L5592
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5593
+.L5592:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5593:
+	cmpl $2797, 4(%rsp)
+	je .LB1398
+.L5594:
+.L5595:
+	cmpl $2798, 4(%rsp)
+	jne .L5596
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5597
+.L5596:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5597:
+	cmpl $2799, 4(%rsp)
+	je .LB1399
+.L5598:
+.L5599:
+	cmpl $2800, 4(%rsp)
+	jne .L5600
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5601
+.L5600:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5601:
+	cmpl $2801, 4(%rsp)
+	je .LB1400
+.L5602:
+.L5603:
+	cmpl $2802, 4(%rsp)
+	jne .L5604
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5605
+.L5604:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5605:
+	cmpl $2803, 4(%rsp)
+	je .LB1401
+.L5606:
+.L5607:
+	cmpl $2804, 4(%rsp)
+	jne .L5608
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5609
+.L5608:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5609:
+	cmpl $2805, 4(%rsp)
+	je .LB1402
+.L5610:
+.L5611:
+	cmpl $2806, 4(%rsp)
+	jne .L5612
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5613
+.L5612:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5613:
+	cmpl $2807, 4(%rsp)
+	je .LB1403
+.L5614:
+.L5615:
+	cmpl $2808, 4(%rsp)
+	jne .L5616
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5617
+.L5616:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5617:
+	cmpl $2809, 4(%rsp)
+	je .LB1404
+.L5618:
+.L5619:
+	cmpl $2810, 4(%rsp)
+	jne .L5620
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5621
+.L5620:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5621:
+	cmpl $2811, 4(%rsp)
+	je .LB1405
+.L5622:
+.L5623:
+	cmpl $2812, 4(%rsp)
+	jne .L5624
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5625
+.L5624:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5625:
+	cmpl $2813, 4(%rsp)
+	je .LB1406
+.L5626:
+.L5627:
+	cmpl $2814, 4(%rsp)
+	jne .L5628
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5629
+.L5628:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5629:
+	cmpl $2815, 4(%rsp)
+	je .LB1407
+.L5630:
+.L5631:
+	cmpl $2816, 4(%rsp)
+	jne .L5632
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5633
+.L5632:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5633:
+	cmpl $2817, 4(%rsp)
+	je .LB1408
+.L5634:
+.L5635:
+	cmpl $2818, 4(%rsp)
+	jne .L5636
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5637
+.L5636:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5637:
+	cmpl $2819, 4(%rsp)
+	je .LB1409
+.L5638:
+.L5639:
+	cmpl $2820, 4(%rsp)
+	jne .L5640
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5641
+.L5640:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5641:
+	cmpl $2821, 4(%rsp)
+	je .LB1410
+.L5642:
+.L5643:
+	cmpl $2822, 4(%rsp)
+	jne .L5644
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5645
+.L5644:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5645:
+	cmpl $2823, 4(%rsp)
+	je .LB1411
+.L5646:
+.L5647:
+	cmpl $2824, 4(%rsp)
+	jne .L5648
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5649
+.L5648:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5649:
+	cmpl $2825, 4(%rsp)
+	je .LB1412
+.L5650:
+.L5651:
+	cmpl $2826, 4(%rsp)
+	jne .L5652
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5653
+.L5652:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5653:
+	cmpl $2827, 4(%rsp)
+	je .LB1413
+.L5654:
+.L5655:
+	cmpl $2828, 4(%rsp)
+	jne .L5656
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5657
+.L5656:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5657:
+	cmpl $2829, 4(%rsp)
+	je .LB1414
+.L5658:
+.L5659:
+	cmpl $2830, 4(%rsp)
+	jne .L5660
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5661
+.L5660:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5661:
+	cmpl $2831, 4(%rsp)
+	je .LB1415
+.L5662:
+.L5663:
+	cmpl $2832, 4(%rsp)
+	jne .L5664
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5665
+.L5664:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5665:
+	cmpl $2833, 4(%rsp)
+	je .LB1416
+.L5666:
+.L5667:
+	cmpl $2834, 4(%rsp)
+	jne .L5668
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5669
+.L5668:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5669:
+	cmpl $2835, 4(%rsp)
+	je .LB1417
+.L5670:
+.L5671:
+	cmpl $2836, 4(%rsp)
+	jne .L5672
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5673
+.L5672:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5673:
+	cmpl $2837, 4(%rsp)
+	je .LB1418
+.L5674:
+.L5675:
+	cmpl $2838, 4(%rsp)
+	jne .L5676
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5677
+.L5676:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5677:
+	cmpl $2839, 4(%rsp)
+	je .LB1419
+.L5678:
+.L5679:
+	cmpl $2840, 4(%rsp)
+	jne .L5680
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5681
+.L5680:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5681:
+	cmpl $2841, 4(%rsp)
+	je .LB1420
+.L5682:
+.L5683:
+	cmpl $2842, 4(%rsp)
+	jne .L5684
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5685
+.L5684:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5685:
+	cmpl $2843, 4(%rsp)
+	je .LB1421
+.L5686:
+.L5687:
+	cmpl $2844, 4(%rsp)
+	jne .L5688
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5689
+.L5688:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5689:
+	cmpl $2845, 4(%rsp)
+	je .LB1422
+.L5690:
+.L5691:
+	cmpl $2846, 4(%rsp)
+	jne .L5692
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5693
+.L5692:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5693:
+	cmpl $2847, 4(%rsp)
+	je .LB1423
+.L5694:
+.L5695:
+	cmpl $2848, 4(%rsp)
+	jne .L5696
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5697
+.L5696:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5697:
+	cmpl $2849, 4(%rsp)
+	je .LB1424
+.L5698:
+.L5699:
+	cmpl $2850, 4(%rsp)
+	jne .L5700
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5701
+.L5700:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5701:
+	cmpl $2851, 4(%rsp)
+	je .LB1425
+.L5702:
+.L5703:
+	cmpl $2852, 4(%rsp)
+	jne .L5704
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5705
+.L5704:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5705:
+	cmpl $2853, 4(%rsp)
+	je .LB1426
+.L5706:
+.L5707:
+	cmpl $2854, 4(%rsp)
+	jne .L5708
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5709
+.L5708:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5709:
+	cmpl $2855, 4(%rsp)
+	je .LB1427
+.L5710:
+.L5711:
+	cmpl $2856, 4(%rsp)
+	jne .L5712
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5713
+.L5712:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5713:
+	cmpl $2857, 4(%rsp)
+	je .LB1428
+.L5714:
+.L5715:
+	cmpl $2858, 4(%rsp)
+	jne .L5716
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5717
+.L5716:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5717:
+	cmpl $2859, 4(%rsp)
+	je .LB1429
+.L5718:
+.L5719:
+	cmpl $2860, 4(%rsp)
+	jne .L5720
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5721
+.L5720:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5721:
+	cmpl $2861, 4(%rsp)
+	je .LB1430
+.L5722:
+.L5723:
+	cmpl $2862, 4(%rsp)
+	jne .L5724
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5725
+.L5724:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5725:
+	cmpl $2863, 4(%rsp)
+	je .LB1431
+.L5726:
+.L5727:
+	cmpl $2864, 4(%rsp)
+	jne .L5728
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5729
+.L5728:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5729:
+	cmpl $2865, 4(%rsp)
+	je .LB1432
+.L5730:
+.L5731:
+	cmpl $2866, 4(%rsp)
+	jne .L5732
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5733
+.L5732:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5733:
+	cmpl $2867, 4(%rsp)
+	je .LB1433
+.L5734:
+.L5735:
+	cmpl $2868, 4(%rsp)
+	jne .L5736
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5737
+.L5736:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5737:
+	cmpl $2869, 4(%rsp)
+	je .LB1434
+.L5738:
+.L5739:
+	cmpl $2870, 4(%rsp)
+	jne .L5740
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5741
+.L5740:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5741:
+	cmpl $2871, 4(%rsp)
+	je .LB1435
+.L5742:
+.L5743:
+	cmpl $2872, 4(%rsp)
+	jne .L5744
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5745
+.L5744:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5745:
+	cmpl $2873, 4(%rsp)
+	je .LB1436
+.L5746:
+.L5747:
+	cmpl $2874, 4(%rsp)
+	jne .L5748
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5749
+.L5748:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5749:
+	cmpl $2875, 4(%rsp)
+	je .LB1437
+.L5750:
+.L5751:
+	cmpl $2876, 4(%rsp)
+	jne .L5752
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5753
+.L5752:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5753:
+	cmpl $2877, 4(%rsp)
+	je .LB1438
+.L5754:
+.L5755:
+	cmpl $2878, 4(%rsp)
+	jne .L5756
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5757
+.L5756:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5757:
+	cmpl $2879, 4(%rsp)
+	je .LB1439
+.L5758:
+.L5759:
+	cmpl $2880, 4(%rsp)
+	jne .L5760
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5761
+.L5760:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5761:
+	cmpl $2881, 4(%rsp)
+	je .LB1440
+.L5762:
+.L5763:
+	cmpl $2882, 4(%rsp)
+	jne .L5764
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5765
+.L5764:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5765:
+	cmpl $2883, 4(%rsp)
+	je .LB1441
+.L5766:
+.L5767:
+	cmpl $2884, 4(%rsp)
+	jne .L5768
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5769
+.L5768:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5769:
+	cmpl $2885, 4(%rsp)
+	je .LB1442
+.L5770:
+.L5771:
+	cmpl $2886, 4(%rsp)
+	jne .L5772
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5773
+.L5772:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5773:
+	cmpl $2887, 4(%rsp)
+	je .LB1443
+.L5774:
+.L5775:
+	cmpl $2888, 4(%rsp)
+	jne .L5776
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5777
+.L5776:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5777:
+	cmpl $2889, 4(%rsp)
+	je .LB1444
+.L5778:
+.L5779:
+	cmpl $2890, 4(%rsp)
+	jne .L5780
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5781
+.L5780:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5781:
+	cmpl $2891, 4(%rsp)
+	je .LB1445
+.L5782:
+.L5783:
+	cmpl $2892, 4(%rsp)
+	jne .L5784
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5785
+.L5784:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5785:
+	cmpl $2893, 4(%rsp)
+	je .LB1446
+.L5786:
+.L5787:
+	cmpl $2894, 4(%rsp)
+	jne .L5788
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5789
+.L5788:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5789:
+	cmpl $2895, 4(%rsp)
+	je .LB1447
+.L5790:
+.L5791:
+	cmpl $2896, 4(%rsp)
+	jne .L5792
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5793
+.L5792:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5793:
+	cmpl $2897, 4(%rsp)
+	je .LB1448
+.L5794:
+.L5795:
+	cmpl $2898, 4(%rsp)
+	jne .L5796
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5797
+.L5796:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5797:
+	cmpl $2899, 4(%rsp)
+	je .LB1449
+.L5798:
+.L5799:
+	cmpl $2900, 4(%rsp)
+	jne .L5800
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5801
+.L5800:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5801:
+	cmpl $2901, 4(%rsp)
+	je .LB1450
+.L5802:
+.L5803:
+	cmpl $2902, 4(%rsp)
+	jne .L5804
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5805
+.L5804:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5805:
+	cmpl $2903, 4(%rsp)
+	je .LB1451
+.L5806:
+.L5807:
+	cmpl $2904, 4(%rsp)
+	jne .L5808
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5809
+.L5808:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5809:
+	cmpl $2905, 4(%rsp)
+	je .LB1452
+.L5810:
+.L5811:
+	cmpl $2906, 4(%rsp)
+	jne .L5812
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5813
+.L5812:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5813:
+	cmpl $2907, 4(%rsp)
+	je .LB1453
+.L5814:
+.L5815:
+	cmpl $2908, 4(%rsp)
+	jne .L5816
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5817
+.L5816:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5817:
+	cmpl $2909, 4(%rsp)
+	je .LB1454
+.L5818:
+.L5819:
+	cmpl $2910, 4(%rsp)
+	jne .L5820
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5821
+.L5820:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5821:
+	cmpl $2911, 4(%rsp)
+	je .LB1455
+.L5822:
+.L5823:
+	cmpl $2912, 4(%rsp)
+	jne .L5824
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5825
+.L5824:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5825:
+	cmpl $2913, 4(%rsp)
+	je .LB1456
+.L5826:
+.L5827:
+	cmpl $2914, 4(%rsp)
+	jne .L5828
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5829
+.L5828:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5829:
+	cmpl $2915, 4(%rsp)
+	je .LB1457
+.L5830:
+.L5831:
+	cmpl $2916, 4(%rsp)
+	jne .L5832
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5833
+.L5832:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5833:
+	cmpl $2917, 4(%rsp)
+	je .LB1458
+.L5834:
+.L5835:
+	cmpl $2918, 4(%rsp)
+	jne .L5836
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5837
+.L5836:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5837:
+	cmpl $2919, 4(%rsp)
+	je .LB1459
+.L5838:
+.L5839:
+	cmpl $2920, 4(%rsp)
+	jne .L5840
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5841
+.L5840:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5841:
+	cmpl $2921, 4(%rsp)
+	je .LB1460
+.L5842:
+.L5843:
+	cmpl $2922, 4(%rsp)
+	jne .L5844
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5845
+.L5844:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5845:
+	cmpl $2923, 4(%rsp)
+	je .LB1461
+.L5846:
+.L5847:
+	cmpl $2924, 4(%rsp)
+	jne .L5848
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5849
+.L5848:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5849:
+	cmpl $2925, 4(%rsp)
+	je .LB1462
+.L5850:
+.L5851:
+	cmpl $2926, 4(%rsp)
+	jne .L5852
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5853
+.L5852:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5853:
+	cmpl $2927, 4(%rsp)
+	je .LB1463
+.L5854:
+.L5855:
+	cmpl $2928, 4(%rsp)
+	jne .L5856
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5857
+.L5856:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5857:
+	cmpl $2929, 4(%rsp)
+	je .LB1464
+.L5858:
+.L5859:
+	cmpl $2930, 4(%rsp)
+	jne .L5860
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5861
+.L5860:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5861:
+	cmpl $2931, 4(%rsp)
+	je .LB1465
+.L5862:
+.L5863:
+	cmpl $2932, 4(%rsp)
+	jne .L5864
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5865
+.L5864:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5865:
+	cmpl $2933, 4(%rsp)
+	je .LB1466
+.L5866:
+.L5867:
+	cmpl $2934, 4(%rsp)
+	jne .L5868
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5869
+.L5868:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5869:
+	cmpl $2935, 4(%rsp)
+	je .LB1467
+.L5870:
+.L5871:
+	cmpl $2936, 4(%rsp)
+	jne .L5872
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5873
+.L5872:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5873:
+	cmpl $2937, 4(%rsp)
+	je .LB1468
+.L5874:
+.L5875:
+	cmpl $2938, 4(%rsp)
+	jne .L5876
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5877
+.L5876:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5877:
+	cmpl $2939, 4(%rsp)
+	je .LB1469
+.L5878:
+.L5879:
+	cmpl $2940, 4(%rsp)
+	jne .L5880
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5881
+.L5880:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5881:
+	cmpl $2941, 4(%rsp)
+	je .LB1470
+.L5882:
+.L5883:
+	cmpl $2942, 4(%rsp)
+	jne .L5884
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5885
+.L5884:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5885:
+	cmpl $2943, 4(%rsp)
+	je .LB1471
+.L5886:
+.L5887:
+	cmpl $2944, 4(%rsp)
+	jne .L5888
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5889
+.L5888:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5889:
+	cmpl $2945, 4(%rsp)
+	je .LB1472
+.L5890:
+.L5891:
+	cmpl $2946, 4(%rsp)
+	jne .L5892
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5893
+.L5892:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5893:
+	cmpl $2947, 4(%rsp)
+	je .LB1473
+.L5894:
+.L5895:
+	cmpl $2948, 4(%rsp)
+	jne .L5896
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5897
+.L5896:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5897:
+	cmpl $2949, 4(%rsp)
+	je .LB1474
+.L5898:
+.L5899:
+	cmpl $2950, 4(%rsp)
+	jne .L5900
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5901
+.L5900:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5901:
+	cmpl $2951, 4(%rsp)
+	je .LB1475
+.L5902:
+.L5903:
+	cmpl $2952, 4(%rsp)
+	jne .L5904
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5905
+.L5904:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5905:
+	cmpl $2953, 4(%rsp)
+	je .LB1476
+.L5906:
+.L5907:
+	cmpl $2954, 4(%rsp)
+	jne .L5908
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5909
+.L5908:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5909:
+	cmpl $2955, 4(%rsp)
+	je .LB1477
+.L5910:
+.L5911:
+	cmpl $2956, 4(%rsp)
+	jne .L5912
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5913
+.L5912:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5913:
+	cmpl $2957, 4(%rsp)
+	je .LB1478
+.L5914:
+.L5915:
+	cmpl $2958, 4(%rsp)
+	jne .L5916
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5917
+.L5916:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5917:
+	cmpl $2959, 4(%rsp)
+	je .LB1479
+.L5918:
+.L5919:
+	cmpl $2960, 4(%rsp)
+	jne .L5920
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5921
+.L5920:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5921:
+	cmpl $2961, 4(%rsp)
+	je .LB1480
+.L5922:
+.L5923:
+	cmpl $2962, 4(%rsp)
+	jne .L5924
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5925
+.L5924:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5925:
+	cmpl $2963, 4(%rsp)
+	je .LB1481
+.L5926:
+.L5927:
+	cmpl $2964, 4(%rsp)
+	jne .L5928
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5929
+.L5928:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5929:
+	cmpl $2965, 4(%rsp)
+	je .LB1482
+.L5930:
+.L5931:
+	cmpl $2966, 4(%rsp)
+	jne .L5932
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5933
+.L5932:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5933:
+	cmpl $2967, 4(%rsp)
+	je .LB1483
+.L5934:
+.L5935:
+	cmpl $2968, 4(%rsp)
+	jne .L5936
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5937
+.L5936:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5937:
+	cmpl $2969, 4(%rsp)
+	je .LB1484
+.L5938:
+.L5939:
+	cmpl $2970, 4(%rsp)
+	jne .L5940
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5941
+.L5940:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5941:
+	cmpl $2971, 4(%rsp)
+	je .LB1485
+.L5942:
+.L5943:
+	cmpl $2972, 4(%rsp)
+	jne .L5944
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5945
+.L5944:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5945:
+	cmpl $2973, 4(%rsp)
+	je .LB1486
+.L5946:
+.L5947:
+	cmpl $2974, 4(%rsp)
+	jne .L5948
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5949
+.L5948:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5949:
+	cmpl $2975, 4(%rsp)
+	je .LB1487
+.L5950:
+.L5951:
+	cmpl $2976, 4(%rsp)
+	jne .L5952
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5953
+.L5952:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5953:
+	cmpl $2977, 4(%rsp)
+	je .LB1488
+.L5954:
+.L5955:
+	cmpl $2978, 4(%rsp)
+	jne .L5956
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5957
+.L5956:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5957:
+	cmpl $2979, 4(%rsp)
+	je .LB1489
+.L5958:
+.L5959:
+	cmpl $2980, 4(%rsp)
+	jne .L5960
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5961
+.L5960:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5961:
+	cmpl $2981, 4(%rsp)
+	je .LB1490
+.L5962:
+.L5963:
+	cmpl $2982, 4(%rsp)
+	jne .L5964
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5965
+.L5964:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5965:
+	cmpl $2983, 4(%rsp)
+	je .LB1491
+.L5966:
+.L5967:
+	cmpl $2984, 4(%rsp)
+	jne .L5968
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5969
+.L5968:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5969:
+	cmpl $2985, 4(%rsp)
+	je .LB1492
+.L5970:
+.L5971:
+	cmpl $2986, 4(%rsp)
+	jne .L5972
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5973
+.L5972:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5973:
+	cmpl $2987, 4(%rsp)
+	je .LB1493
+.L5974:
+.L5975:
+	cmpl $2988, 4(%rsp)
+	jne .L5976
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5977
+.L5976:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5977:
+	cmpl $2989, 4(%rsp)
+	je .LB1494
+.L5978:
+.L5979:
+	cmpl $2990, 4(%rsp)
+	jne .L5980
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5981
+.L5980:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5981:
+	cmpl $2991, 4(%rsp)
+	je .LB1495
+.L5982:
+.L5983:
+	cmpl $2992, 4(%rsp)
+	jne .L5984
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5985
+.L5984:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5985:
+	cmpl $2993, 4(%rsp)
+	je .LB1496
+.L5986:
+.L5987:
+	cmpl $2994, 4(%rsp)
+	jne .L5988
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5989
+.L5988:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5989:
+	cmpl $2995, 4(%rsp)
+	je .LB1497
+.L5990:
+.L5991:
+	cmpl $2996, 4(%rsp)
+	jne .L5992
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5993
+.L5992:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5993:
+	cmpl $2997, 4(%rsp)
+	je .LB1498
+.L5994:
+.L5995:
+	cmpl $2998, 4(%rsp)
+	jne .L5996
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	movl %eax, 4(%rsp)
+	jmp .L5997
+.LB1:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB2:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB3:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB4:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB5:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB6:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB7:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB8:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB9:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB10:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB11:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB12:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB13:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB14:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB15:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB16:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB17:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB18:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB19:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB20:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB21:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB22:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB23:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB24:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB25:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB26:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB27:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB28:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB29:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB30:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB31:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB32:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB33:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB34:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB35:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB36:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB37:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB38:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB39:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB40:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB41:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB42:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB43:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB44:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB45:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB46:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB47:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB48:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB49:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB50:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB51:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB52:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB53:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB54:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB55:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB56:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB57:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB58:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB59:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB60:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB61:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB62:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB63:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB64:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB65:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB66:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB67:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB68:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB69:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB70:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB71:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB72:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB73:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB74:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB75:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB76:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB77:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB78:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB79:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB80:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB81:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB82:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB83:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB84:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB85:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB86:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB87:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB88:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB89:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB90:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB91:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB92:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB93:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB94:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB95:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB96:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB97:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB98:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB99:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB100:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB101:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB102:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB103:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB104:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB105:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB106:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB107:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB108:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB109:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB110:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB111:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB112:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB113:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB114:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB115:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB116:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB117:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB118:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB119:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB120:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB121:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB122:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB123:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB124:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB125:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB126:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB127:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB128:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB129:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB130:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB131:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB132:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB133:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB134:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB135:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB136:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB137:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB138:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB139:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB140:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB141:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB142:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB143:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB144:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB145:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB146:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB147:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB148:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB149:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB150:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB151:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB152:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB153:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB154:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB155:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB156:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB157:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB158:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB159:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB160:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB161:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB162:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB163:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB164:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB165:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB166:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB167:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB168:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB169:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB170:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB171:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB172:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB173:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB174:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB175:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB176:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB177:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB178:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB179:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB180:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB181:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB182:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB183:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB184:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB185:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB186:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB187:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB188:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB189:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB190:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB191:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB192:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB193:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB194:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB195:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB196:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB197:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB198:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB199:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB200:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB201:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB202:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB203:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB204:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB205:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB206:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB207:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB208:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB209:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB210:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB211:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB212:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB213:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB214:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB215:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB216:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB217:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB218:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB219:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB220:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB221:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB222:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB223:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB224:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB225:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB226:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB227:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB228:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB229:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB230:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB231:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB232:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB233:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB234:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB235:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB236:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB237:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB238:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB239:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB240:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB241:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB242:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB243:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB244:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB245:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB246:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB247:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB248:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB249:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB250:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB251:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB252:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB253:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB254:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB255:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB256:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB257:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB258:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB259:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB260:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB261:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB262:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB263:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB264:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB265:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB266:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB267:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB268:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB269:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB270:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB271:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB272:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB273:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB274:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB275:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB276:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB277:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB278:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB279:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB280:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB281:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB282:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB283:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB284:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB285:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB286:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB287:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB288:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB289:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB290:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB291:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB292:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB293:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB294:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB295:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB296:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB297:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB298:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB299:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB300:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB301:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB302:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB303:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB304:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB305:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB306:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB307:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB308:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB309:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB310:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB311:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB312:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB313:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB314:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB315:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB316:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB317:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB318:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB319:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB320:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB321:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB322:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB323:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB324:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB325:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB326:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB327:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB328:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB329:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB330:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB331:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB332:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB333:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB334:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB335:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB336:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB337:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB338:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB339:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB340:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB341:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB342:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB343:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB344:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB345:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB346:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB347:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB348:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB349:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB350:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB351:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB352:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB353:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB354:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB355:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB356:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB357:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB358:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB359:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB360:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB361:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB362:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB363:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB364:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB365:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB366:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB367:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB368:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB369:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB370:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB371:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB372:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB373:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB374:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB375:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB376:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB377:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB378:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB379:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB380:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB381:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB382:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB383:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB384:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB385:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB386:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB387:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB388:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB389:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB390:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB391:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB392:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB393:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB394:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB395:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB396:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB397:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB398:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB399:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB400:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB401:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB402:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB403:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB404:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB405:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB406:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB407:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB408:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB409:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB410:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB411:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB412:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB413:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB414:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB415:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB416:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB417:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB418:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB419:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB420:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB421:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB422:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB423:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB424:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB425:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB426:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB427:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB428:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB429:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB430:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB431:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB432:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB433:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB434:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB435:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB436:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB437:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB438:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB439:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB440:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB441:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB442:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB443:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB444:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB445:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB446:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB447:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB448:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB449:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB450:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB451:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB452:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB453:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB454:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB455:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB456:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB457:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB458:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB459:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB460:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB461:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB462:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB463:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB464:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB465:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB466:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB467:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB468:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB469:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB470:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB471:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB472:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB473:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB474:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB475:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB476:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB477:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB478:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB479:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB480:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB481:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB482:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB483:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB484:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB485:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB486:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB487:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB488:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB489:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB490:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB491:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB492:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB493:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB494:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB495:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB496:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB497:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB498:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB499:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB500:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB501:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB502:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB503:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB504:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB505:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB506:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB507:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB508:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB509:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB510:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB511:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB512:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB513:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB514:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB515:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB516:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB517:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB518:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB519:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB520:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB521:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB522:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB523:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB524:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB525:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB526:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB527:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB528:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB529:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB530:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB531:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB532:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB533:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB534:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB535:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB536:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB537:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB538:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB539:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB540:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB541:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB542:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB543:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB544:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB545:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB546:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB547:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB548:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB549:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB550:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB551:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB552:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB553:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB554:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB555:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB556:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB557:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB558:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB559:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB560:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB561:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB562:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB563:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB564:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB565:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB566:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB567:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB568:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB569:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB570:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB571:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB572:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB573:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB574:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB575:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB576:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB577:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB578:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB579:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB580:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB581:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB582:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB583:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB584:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB585:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB586:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB587:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB588:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB589:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB590:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB591:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB592:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB593:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB594:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB595:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB596:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB597:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB598:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB599:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB600:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB601:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB602:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB603:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB604:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB605:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB606:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB607:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB608:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB609:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB610:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB611:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB612:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB613:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB614:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB615:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB616:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB617:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB618:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB619:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB620:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB621:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB622:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB623:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB624:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB625:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB626:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB627:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB628:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB629:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB630:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB631:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB632:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB633:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB634:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB635:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB636:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB637:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB638:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB639:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB640:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB641:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB642:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB643:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB644:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB645:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB646:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB647:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB648:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB649:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB650:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB651:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB652:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB653:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB654:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB655:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB656:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB657:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB658:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB659:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB660:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB661:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB662:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB663:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB664:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB665:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB666:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB667:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB668:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB669:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB670:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB671:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB672:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB673:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB674:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB675:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB676:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB677:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB678:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB679:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB680:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB681:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB682:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB683:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB684:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB685:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB686:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB687:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB688:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB689:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB690:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB691:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB692:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB693:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB694:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB695:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB696:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB697:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB698:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB699:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB700:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB701:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB702:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB703:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB704:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB705:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB706:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB707:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB708:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB709:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB710:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB711:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB712:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB713:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB714:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB715:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB716:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB717:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB718:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB719:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB720:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB721:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB722:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB723:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB724:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB725:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB726:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB727:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB728:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB729:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB730:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB731:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB732:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB733:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB734:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB735:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB736:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB737:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB738:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB739:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB740:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB741:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB742:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB743:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB744:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB745:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB746:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB747:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB748:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB749:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB750:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB751:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB752:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB753:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB754:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB755:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB756:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB757:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB758:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB759:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB760:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB761:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB762:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB763:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB764:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB765:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB766:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB767:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB768:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB769:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB770:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB771:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB772:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB773:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB774:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB775:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB776:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB777:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB778:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB779:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB780:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB781:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB782:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB783:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB784:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB785:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB786:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB787:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB788:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB789:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB790:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB791:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB792:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB793:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB794:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB795:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB796:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB797:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB798:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB799:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB800:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB801:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB802:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB803:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB804:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB805:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB806:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB807:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB808:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB809:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB810:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB811:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB812:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB813:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB814:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB815:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB816:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB817:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB818:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB819:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB820:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB821:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB822:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB823:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB824:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB825:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB826:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB827:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB828:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB829:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB830:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB831:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB832:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB833:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB834:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB835:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB836:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB837:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB838:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB839:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB840:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB841:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB842:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB843:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB844:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB845:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB846:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB847:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB848:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB849:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB850:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB851:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB852:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB853:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB854:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB855:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB856:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB857:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB858:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB859:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB860:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB861:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB862:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB863:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB864:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB865:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB866:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB867:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB868:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB869:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB870:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB871:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB872:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB873:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB874:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB875:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB876:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB877:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB878:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB879:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB880:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB881:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB882:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB883:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB884:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB885:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB886:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB887:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB888:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB889:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB890:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB891:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB892:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB893:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB894:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB895:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB896:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB897:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB898:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB899:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB900:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB901:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB902:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB903:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB904:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB905:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB906:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB907:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB908:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB909:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB910:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB911:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB912:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB913:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB914:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB915:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB916:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB917:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB918:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB919:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB920:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB921:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB922:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB923:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB924:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB925:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB926:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB927:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB928:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB929:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB930:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB931:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB932:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB933:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB934:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB935:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB936:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB937:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB938:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB939:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB940:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB941:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB942:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB943:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB944:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB945:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB946:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB947:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB948:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB949:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB950:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB951:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB952:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB953:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB954:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB955:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB956:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB957:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB958:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB959:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB960:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB961:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB962:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB963:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB964:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB965:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB966:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB967:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB968:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB969:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB970:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB971:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB972:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB973:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB974:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB975:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB976:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB977:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB978:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB979:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB980:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB981:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB982:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB983:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB984:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB985:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB986:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB987:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB988:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB989:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB990:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB991:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB992:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB993:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB994:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB995:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB996:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB997:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB998:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB999:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1000:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1001:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1002:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1003:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1004:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1005:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1006:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1007:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1008:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1009:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1010:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1011:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1012:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1013:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1014:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1015:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1016:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1017:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1018:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1019:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1020:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1021:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1022:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1023:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1024:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1025:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1026:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1027:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1028:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1029:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1030:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1031:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1032:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1033:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1034:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1035:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1036:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1037:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1038:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1039:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1040:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1041:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1042:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1043:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1044:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1045:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1046:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1047:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1048:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1049:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1050:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1051:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1052:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1053:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1054:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1055:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1056:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1057:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1058:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1059:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1060:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1061:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1062:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1063:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1064:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1065:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1066:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1067:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1068:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1069:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1070:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1071:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1072:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1073:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1074:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1075:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1076:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1077:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1078:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1079:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1080:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1081:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1082:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1083:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1084:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1085:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1086:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1087:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1088:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1089:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1090:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1091:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1092:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1093:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1094:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1095:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1096:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1097:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1098:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1099:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1100:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1101:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1102:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1103:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1104:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1105:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1106:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1107:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1108:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1109:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1110:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1111:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1112:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1113:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1114:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1115:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1116:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1117:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1118:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1119:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1120:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1121:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1122:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1123:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1124:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1125:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1126:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1127:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1128:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1129:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1130:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1131:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1132:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1133:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1134:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1135:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1136:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1137:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1138:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1139:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1140:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1141:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1142:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1143:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1144:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1145:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1146:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1147:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1148:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1149:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1150:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1151:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1152:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1153:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1154:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1155:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1156:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1157:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1158:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1159:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1160:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1161:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1162:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1163:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1164:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1165:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1166:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1167:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1168:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1169:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1170:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1171:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1172:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1173:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1174:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1175:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1176:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1177:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1178:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1179:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1180:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1181:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1182:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1183:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1184:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1185:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1186:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1187:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1188:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1189:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1190:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1191:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1192:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1193:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1194:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1195:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1196:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1197:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1198:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1199:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1200:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1201:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1202:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1203:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1204:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1205:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1206:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1207:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1208:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1209:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1210:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1211:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1212:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1213:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1214:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1215:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1216:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1217:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1218:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1219:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1220:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1221:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1222:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1223:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1224:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1225:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1226:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1227:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1228:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1229:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1230:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1231:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1232:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1233:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1234:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1235:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1236:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1237:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1238:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1239:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1240:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1241:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1242:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1243:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1244:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1245:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1246:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1247:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1248:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1249:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1250:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1251:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1252:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1253:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1254:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1255:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1256:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1257:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1258:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1259:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1260:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1261:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1262:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1263:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1264:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1265:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1266:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1267:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1268:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1269:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1270:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1271:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1272:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1273:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1274:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1275:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1276:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1277:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1278:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1279:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1280:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1281:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1282:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1283:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1284:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1285:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1286:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1287:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1288:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1289:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1290:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1291:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1292:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1293:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1294:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1295:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1296:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1297:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1298:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1299:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1300:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1301:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1302:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1303:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1304:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1305:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1306:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1307:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1308:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1309:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1310:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1311:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1312:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1313:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1314:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1315:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1316:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1317:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1318:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1319:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1320:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1321:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1322:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1323:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1324:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1325:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1326:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1327:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1328:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1329:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1330:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1331:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1332:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1333:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1334:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1335:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1336:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1337:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1338:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1339:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1340:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1341:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1342:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1343:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1344:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1345:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1346:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1347:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1348:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1349:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1350:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1351:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1352:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1353:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1354:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1355:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1356:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1357:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1358:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1359:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1360:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1361:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1362:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1363:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1364:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1365:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1366:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1367:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1368:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1369:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1370:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1371:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1372:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1373:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1374:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1375:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1376:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1377:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1378:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1379:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1380:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1381:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1382:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1383:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1384:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1385:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1386:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1387:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1388:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1389:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1390:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1391:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1392:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1393:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1394:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1395:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1396:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1397:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1398:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1399:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1400:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1401:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1402:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1403:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1404:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1405:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1406:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1407:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1408:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1409:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1410:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1411:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1412:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1413:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1414:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1415:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1416:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1417:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1418:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1419:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1420:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1421:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1422:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1423:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1424:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1425:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1426:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1427:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1428:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1429:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1430:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1431:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1432:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1433:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1434:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1435:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1436:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1437:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1438:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1439:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1440:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1441:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1442:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1443:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1444:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1445:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1446:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1447:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1448:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1449:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1450:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1451:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1452:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1453:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1454:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1455:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1456:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1457:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1458:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1459:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1460:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1461:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1462:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1463:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1464:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1465:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1466:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1467:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1468:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1469:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1470:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1471:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1472:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1473:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1474:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1475:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1476:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1477:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1478:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1479:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1480:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1481:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1482:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1483:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1484:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1485:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1486:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1487:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1488:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.LB1489:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1490:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.LB1491:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+.LB1492:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1493:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $5, %eax
+	jmp .main_return
+.LB1494:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $0, %eax
+	jmp .main_return
+.LB1495:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $2, %eax
+	jmp .main_return
+.L5996:
+	movl 4(%rsp), %eax
+	addl $1, %eax
+	movq %rax, %rdi
+	call putchar
+	movl %eax, 4(%rsp)
+.L5997:
+	cmpl $2999, 4(%rsp)
+	jne .L5998
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $3, %eax
+	jmp .main_return
+.LB1496:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $4, %eax
+	jmp .main_return
+.LB1497:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $6, %eax
+	jmp .main_return
+.L5998:
+.L5999:
+	movl 4(%rsp), %eax
+	jmp .main_return
+.LB1498:
+	movl 4(%rsp), %eax
+	movq %rax, %rdi
+	call putchar
+	addl $1, %eax
+	jmp .main_return
+	.size main, .-main
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
@@ -0,0 +1,36 @@
+	.section .text
+	.global main
+	.type main, @function
+	.type f0, @function
+	.align 16
+main:
+	movl %edi, %eax
+	movq %rax, %rdi
+	jmp f0
+	.size main, .-main
+	.align 16
+f0:
+	movl %edi, %eax
+	addl $0, %eax
+	pushq %rax
+	movl %edi, %eax
+	subl $0, %eax
+	movq %rax, %rcx
+	cmpl $0, %edi
+	popq %rax
+	cmovgl %ecx, %eax
+	ret
+	.size f0, .-f0
+	.global _start
+	.type _start, @function
+_start:
+	# Set up stack frame
+	movq %rsp, %rbp
+	# Align stack to 16 bytes
+	andq $-16, %rsp
+	call main
+	# Exit syscall
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.size _start, .-_start
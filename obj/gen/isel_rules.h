@@ -0,0 +1,692 @@
+// Generated by tools/burg.c from src/isel.spec; do not edit.
+#ifndef ISEL_RULES_H
+#define ISEL_RULES_H
+
+#define ISEL_MAX_LEAVES 4
+#define ISEL_MAX_REGS 2
+#define ISEL_TIER_COUNT 3
+
+enum {
+    ISEL_ANY,
+    ISEL_NUM,
+    ISEL_VAR,
+    ISEL_ADD,
+    ISEL_SUB,
+    ISEL_MUL,
+    ISEL_DIV,
+    ISEL_CMP,
+    ISEL_ASGN,
+    ISEL_CVT,
+    ISEL_STR,
+    ISEL_ELEM,
+    ISEL_TERM_COUNT
+};
+
+enum {
+    ISEL_NT_IMM,
+    ISEL_NT_CON,
+    ISEL_NT_SCALE,
+    ISEL_NT_ZERO,
+    ISEL_NT_POW2,
+    ISEL_NT_MAGIC,
+    ISEL_NT_MAGICADD,
+    ISEL_NT_MEM,
+    ISEL_NT_ELEM,
+    ISEL_NT_REG,
+    ISEL_NT_CC,
+    ISEL_NT_STMT,
+    ISEL_NT_COUNT
+};
+
+static bool isel_pred_imm32(const ASTNode *node);
+static bool isel_pred_scale(const ASTNode *node);
+static bool isel_pred_zero(const ASTNode *node);
+static bool isel_pred_pow2(const ASTNode *node);
+static bool isel_pred_magic(const ASTNode *node);
+static bool isel_pred_magicadd(const ASTNode *node);
+static bool isel_pred_inbounds(const ASTNode *node);
+static bool isel_pred_local(const ASTNode *node);
+static bool isel_pred_global(const ASTNode *node);
+static bool isel_pred_movl(const ASTNode *node);
+static bool isel_pred_sbyte(const ASTNode *node);
+static bool isel_pred_ubyte(const ASTNode *node);
+static bool isel_pred_sword(const ASTNode *node);
+static bool isel_pred_uword(const ASTNode *node);
+static bool isel_pred_narrow(const ASTNode *node);
+static bool isel_pred_sext8(const ASTNode *node);
+static bool isel_pred_sext8q(const ASTNode *node);
+static bool isel_pred_zext8(const ASTNode *node);
+static bool isel_pred_sext16(const ASTNode *node);
+static bool isel_pred_sext16q(const ASTNode *node);
+static bool isel_pred_zext16(const ASTNode *node);
+static bool isel_pred_sext32(const ASTNode *node);
+static bool isel_pred_zext32(const ASTNode *node);
+static bool isel_pred_signed32(const ASTNode *node);
+static bool isel_pred_unsigned32(const ASTNode *node);
+static bool isel_pred_signed64(const ASTNode *node);
+static bool isel_pred_unsigned64(const ASTNode *node);
+static bool isel_pred_update(const ASTNode *node);
+
+static const IselPattern isel_patterns[] = {
+    {true, ISEL_NUM, {-1, -1}},  // 0
+    {true, ISEL_NUM, {-1, -1}},  // 1
+    {true, ISEL_NUM, {-1, -1}},  // 2
+    {true, ISEL_NUM, {-1, -1}},  // 3
+    {true, ISEL_NUM, {-1, -1}},  // 4
+    {true, ISEL_NUM, {-1, -1}},  // 5
+    {true, ISEL_NUM, {-1, -1}},  // 6
+    {true, ISEL_VAR, {-1, -1}},  // 7
+    {true, ISEL_ELEM, {9, -1}},  // 8
+    {true, ISEL_NUM, {-1, -1}},  // 9
+    {true, ISEL_ELEM, {11, -1}},  // 10
+    {false, ISEL_NT_REG, {-1, -1}},  // 11
+    {true, ISEL_ELEM, {13, -1}},  // 12
+    {false, ISEL_NT_REG, {-1, -1}},  // 13
+    {true, ISEL_NUM, {-1, -1}},  // 14
+    {false, ISEL_NT_IMM, {-1, -1}},  // 15
+    {true, ISEL_NUM, {-1, -1}},  // 16
+    {false, ISEL_NT_MEM, {-1, -1}},  // 17
+    {false, ISEL_NT_MEM, {-1, -1}},  // 18
+    {false, ISEL_NT_MEM, {-1, -1}},  // 19
+    {false, ISEL_NT_MEM, {-1, -1}},  // 20
+    {false, ISEL_NT_MEM, {-1, -1}},  // 21
+    {false, ISEL_NT_ELEM, {-1, -1}},  // 22
+    {false, ISEL_NT_ELEM, {-1, -1}},  // 23
+    {false, ISEL_NT_ELEM, {-1, -1}},  // 24
+    {false, ISEL_NT_ELEM, {-1, -1}},  // 25
+    {false, ISEL_NT_ELEM, {-1, -1}},  // 26
+    {false, ISEL_NT_CC, {-1, -1}},  // 27
+    {true, ISEL_STR, {-1, -1}},  // 28
+    {true, ISEL_ANY, {-1, -1}},  // 29
+    {true, ISEL_CVT, {31, -1}},  // 30
+    {false, ISEL_NT_REG, {-1, -1}},  // 31
+    {true, ISEL_CVT, {33, -1}},  // 32
+    {false, ISEL_NT_REG, {-1, -1}},  // 33
+    {true, ISEL_CVT, {35, -1}},  // 34
+    {false, ISEL_NT_MEM, {-1, -1}},  // 35
+    {true, ISEL_CVT, {37, -1}},  // 36
+    {false, ISEL_NT_REG, {-1, -1}},  // 37
+    {true, ISEL_CVT, {39, -1}},  // 38
+    {false, ISEL_NT_MEM, {-1, -1}},  // 39
+    {true, ISEL_CVT, {41, -1}},  // 40
+    {false, ISEL_NT_REG, {-1, -1}},  // 41
+    {true, ISEL_CVT, {43, -1}},  // 42
+    {false, ISEL_NT_MEM, {-1, -1}},  // 43
+    {true, ISEL_CVT, {45, -1}},  // 44
+    {false, ISEL_NT_REG, {-1, -1}},  // 45
+    {true, ISEL_CVT, {47, -1}},  // 46
+    {false, ISEL_NT_MEM, {-1, -1}},  // 47
+    {true, ISEL_CVT, {49, -1}},  // 48
+    {false, ISEL_NT_REG, {-1, -1}},  // 49
+    {true, ISEL_CVT, {51, -1}},  // 50
+    {false, ISEL_NT_MEM, {-1, -1}},  // 51
+    {true, ISEL_CVT, {53, -1}},  // 52
+    {false, ISEL_NT_REG, {-1, -1}},  // 53
+    {true, ISEL_CVT, {55, -1}},  // 54
+    {false, ISEL_NT_MEM, {-1, -1}},  // 55
+    {true, ISEL_CVT, {57, -1}},  // 56
+    {false, ISEL_NT_REG, {-1, -1}},  // 57
+    {true, ISEL_CVT, {59, -1}},  // 58
+    {false, ISEL_NT_MEM, {-1, -1}},  // 59
+    {true, ISEL_CVT, {61, -1}},  // 60
+    {false, ISEL_NT_REG, {-1, -1}},  // 61
+    {true, ISEL_CVT, {63, -1}},  // 62
+    {false, ISEL_NT_MEM, {-1, -1}},  // 63
+    {true, ISEL_ADD, {65, 66}},  // 64
+    {false, ISEL_NT_REG, {-1, -1}},  // 65
+    {false, ISEL_NT_REG, {-1, -1}},  // 66
+    {true, ISEL_ADD, {68, 69}},  // 67
+    {false, ISEL_NT_REG, {-1, -1}},  // 68
+    {false, ISEL_NT_IMM, {-1, -1}},  // 69
+    {true, ISEL_ADD, {71, 72}},  // 70
+    {false, ISEL_NT_IMM, {-1, -1}},  // 71
+    {false, ISEL_NT_REG, {-1, -1}},  // 72
+    {true, ISEL_ADD, {74, 75}},  // 73
+    {false, ISEL_NT_REG, {-1, -1}},  // 74
+    {false, ISEL_NT_MEM, {-1, -1}},  // 75
+    {true, ISEL_ADD, {77, 78}},  // 76
+    {false, ISEL_NT_MEM, {-1, -1}},  // 77
+    {false, ISEL_NT_REG, {-1, -1}},  // 78
+    {true, ISEL_MUL, {80, 81}},  // 79
+    {false, ISEL_NT_REG, {-1, -1}},  // 80
+    {false, ISEL_NT_POW2, {-1, -1}},  // 81
+    {true, ISEL_MUL, {83, 84}},  // 82
+    {false, ISEL_NT_REG, {-1, -1}},  // 83
+    {false, ISEL_NT_SCALE, {-1, -1}},  // 84
+    {true, ISEL_ADD, {86, 87}},  // 85
+    {false, ISEL_NT_REG, {-1, -1}},  // 86
+    {true, ISEL_MUL, {88, 89}},  // 87
+    {false, ISEL_NT_REG, {-1, -1}},  // 88
+    {false, ISEL_NT_SCALE, {-1, -1}},  // 89
+    {true, ISEL_ADD, {91, 94}},  // 90
+    {true, ISEL_MUL, {92, 93}},  // 91
+    {false, ISEL_NT_REG, {-1, -1}},  // 92
+    {false, ISEL_NT_SCALE, {-1, -1}},  // 93
+    {false, ISEL_NT_REG, {-1, -1}},  // 94
+    {true, ISEL_ADD, {96, 99}},  // 95
+    {true, ISEL_MUL, {97, 98}},  // 96
+    {false, ISEL_NT_REG, {-1, -1}},  // 97
+    {false, ISEL_NT_SCALE, {-1, -1}},  // 98
+    {false, ISEL_NT_CON, {-1, -1}},  // 99
+    {true, ISEL_ADD, {101, 104}},  // 100
+    {true, ISEL_ADD, {102, 103}},  // 101
+    {false, ISEL_NT_REG, {-1, -1}},  // 102
+    {false, ISEL_NT_REG, {-1, -1}},  // 103
+    {false, ISEL_NT_CON, {-1, -1}},  // 104
+    {true, ISEL_ADD, {106, 111}},  // 105
+    {true, ISEL_ADD, {107, 108}},  // 106
+    {false, ISEL_NT_REG, {-1, -1}},  // 107
+    {true, ISEL_MUL, {109, 110}},  // 108
+    {false, ISEL_NT_REG, {-1, -1}},  // 109
+    {false, ISEL_NT_SCALE, {-1, -1}},  // 110
+    {false, ISEL_NT_CON, {-1, -1}},  // 111
+    {true, ISEL_ADD, {113, 118}},  // 112
+    {true, ISEL_ADD, {114, 117}},  // 113
+    {true, ISEL_MUL, {115, 116}},  // 114
+    {false, ISEL_NT_REG, {-1, -1}},  // 115
+    {false, ISEL_NT_SCALE, {-1, -1}},  // 116
+    {false, ISEL_NT_REG, {-1, -1}},  // 117
+    {false, ISEL_NT_CON, {-1, -1}},  // 118
+    {true, ISEL_SUB, {120, 121}},  // 119
+    {false, ISEL_NT_REG, {-1, -1}},  // 120
+    {false, ISEL_NT_REG, {-1, -1}},  // 121
+    {true, ISEL_SUB, {123, 124}},  // 122
+    {false, ISEL_NT_REG, {-1, -1}},  // 123
+    {false, ISEL_NT_IMM, {-1, -1}},  // 124
+    {true, ISEL_SUB, {126, 127}},  // 125
+    {false, ISEL_NT_REG, {-1, -1}},  // 126
+    {false, ISEL_NT_MEM, {-1, -1}},  // 127
+    {true, ISEL_SUB, {129, 130}},  // 128
+    {false, ISEL_NT_IMM, {-1, -1}},  // 129
+    {false, ISEL_NT_REG, {-1, -1}},  // 130
+    {true, ISEL_SUB, {132, 133}},  // 131
+    {false, ISEL_NT_MEM, {-1, -1}},  // 132
+    {false, ISEL_NT_REG, {-1, -1}},  // 133
+    {true, ISEL_MUL, {135, 136}},  // 134
+    {false, ISEL_NT_REG, {-1, -1}},  // 135
+    {false, ISEL_NT_REG, {-1, -1}},  // 136
+    {true, ISEL_MUL, {138, 139}},  // 137
+    {false, ISEL_NT_REG, {-1, -1}},  // 138
+    {false, ISEL_NT_MEM, {-1, -1}},  // 139
+    {true, ISEL_MUL, {141, 142}},  // 140
+    {false, ISEL_NT_MEM, {-1, -1}},  // 141
+    {false, ISEL_NT_REG, {-1, -1}},  // 142
+    {true, ISEL_MUL, {144, 145}},  // 143
+    {false, ISEL_NT_REG, {-1, -1}},  // 144
+    {false, ISEL_NT_IMM, {-1, -1}},  // 145
+    {true, ISEL_MUL, {147, 148}},  // 146
+    {false, ISEL_NT_IMM, {-1, -1}},  // 147
+    {false, ISEL_NT_REG, {-1, -1}},  // 148
+    {true, ISEL_MUL, {150, 151}},  // 149
+    {false, ISEL_NT_MEM, {-1, -1}},  // 150
+    {false, ISEL_NT_IMM, {-1, -1}},  // 151
+    {true, ISEL_MUL, {153, 154}},  // 152
+    {false, ISEL_NT_IMM, {-1, -1}},  // 153
+    {false, ISEL_NT_MEM, {-1, -1}},  // 154
+    {true, ISEL_DIV, {156, 157}},  // 155
+    {false, ISEL_NT_REG, {-1, -1}},  // 156
+    {false, ISEL_NT_REG, {-1, -1}},  // 157
+    {true, ISEL_DIV, {159, 160}},  // 158
+    {false, ISEL_NT_REG, {-1, -1}},  // 159
+    {false, ISEL_NT_MEM, {-1, -1}},  // 160
+    {true, ISEL_DIV, {162, 163}},  // 161
+    {false, ISEL_NT_REG, {-1, -1}},  // 162
+    {false, ISEL_NT_REG, {-1, -1}},  // 163
+    {true, ISEL_DIV, {165, 166}},  // 164
+    {false, ISEL_NT_REG, {-1, -1}},  // 165
+    {false, ISEL_NT_MEM, {-1, -1}},  // 166
+    {true, ISEL_DIV, {168, 169}},  // 167
+    {false, ISEL_NT_REG, {-1, -1}},  // 168
+    {false, ISEL_NT_REG, {-1, -1}},  // 169
+    {true, ISEL_DIV, {171, 172}},  // 170
+    {false, ISEL_NT_REG, {-1, -1}},  // 171
+    {false, ISEL_NT_MEM, {-1, -1}},  // 172
+    {true, ISEL_DIV, {174, 175}},  // 173
+    {false, ISEL_NT_REG, {-1, -1}},  // 174
+    {false, ISEL_NT_REG, {-1, -1}},  // 175
+    {true, ISEL_DIV, {177, 178}},  // 176
+    {false, ISEL_NT_REG, {-1, -1}},  // 177
+    {false, ISEL_NT_MEM, {-1, -1}},  // 178
+    {true, ISEL_DIV, {180, 181}},  // 179
+    {false, ISEL_NT_REG, {-1, -1}},  // 180
+    {false, ISEL_NT_POW2, {-1, -1}},  // 181
+    {true, ISEL_DIV, {183, 184}},  // 182
+    {false, ISEL_NT_REG, {-1, -1}},  // 183
+    {false, ISEL_NT_POW2, {-1, -1}},  // 184
+    {true, ISEL_DIV, {186, 187}},  // 185
+    {false, ISEL_NT_REG, {-1, -1}},  // 186
+    {false, ISEL_NT_POW2, {-1, -1}},  // 187
+    {true, ISEL_DIV, {189, 190}},  // 188
+    {false, ISEL_NT_REG, {-1, -1}},  // 189
+    {false, ISEL_NT_POW2, {-1, -1}},  // 190
+    {true, ISEL_DIV, {192, 193}},  // 191
+    {false, ISEL_NT_REG, {-1, -1}},  // 192
+    {false, ISEL_NT_MAGIC, {-1, -1}},  // 193
+    {true, ISEL_DIV, {195, 196}},  // 194
+    {false, ISEL_NT_REG, {-1, -1}},  // 195
+    {false, ISEL_NT_MAGICADD, {-1, -1}},  // 196
+    {true, ISEL_DIV, {198, 199}},  // 197
+    {false, ISEL_NT_REG, {-1, -1}},  // 198
+    {false, ISEL_NT_MAGIC, {-1, -1}},  // 199
+    {true, ISEL_DIV, {201, 202}},  // 200
+    {false, ISEL_NT_REG, {-1, -1}},  // 201
+    {false, ISEL_NT_MAGICADD, {-1, -1}},  // 202
+    {true, ISEL_DIV, {204, 205}},  // 203
+    {false, ISEL_NT_REG, {-1, -1}},  // 204
+    {false, ISEL_NT_MAGIC, {-1, -1}},  // 205
+    {true, ISEL_DIV, {207, 208}},  // 206
+    {false, ISEL_NT_REG, {-1, -1}},  // 207
+    {false, ISEL_NT_MAGICADD, {-1, -1}},  // 208
+    {true, ISEL_ASGN, {210, 211}},  // 209
+    {false, ISEL_NT_MEM, {-1, -1}},  // 210
+    {false, ISEL_NT_REG, {-1, -1}},  // 211
+    {true, ISEL_ASGN, {213, 214}},  // 212
+    {false, ISEL_NT_ELEM, {-1, -1}},  // 213
+    {false, ISEL_NT_REG, {-1, -1}},  // 214
+    {true, ISEL_CMP, {216, 217}},  // 215
+    {false, ISEL_NT_REG, {-1, -1}},  // 216
+    {false, ISEL_NT_ZERO, {-1, -1}},  // 217
+    {true, ISEL_CMP, {219, 220}},  // 218
+    {false, ISEL_NT_ZERO, {-1, -1}},  // 219
+    {false, ISEL_NT_REG, {-1, -1}},  // 220
+    {true, ISEL_CMP, {222, 223}},  // 221
+    {false, ISEL_NT_REG, {-1, -1}},  // 222
+    {false, ISEL_NT_REG, {-1, -1}},  // 223
+    {true, ISEL_CMP, {225, 226}},  // 224
+    {false, ISEL_NT_REG, {-1, -1}},  // 225
+    {false, ISEL_NT_IMM, {-1, -1}},  // 226
+    {true, ISEL_CMP, {228, 229}},  // 227
+    {false, ISEL_NT_REG, {-1, -1}},  // 228
+    {false, ISEL_NT_MEM, {-1, -1}},  // 229
+    {true, ISEL_CMP, {231, 232}},  // 230
+    {false, ISEL_NT_MEM, {-1, -1}},  // 231
+    {false, ISEL_NT_REG, {-1, -1}},  // 232
+    {true, ISEL_CMP, {234, 235}},  // 233
+    {false, ISEL_NT_MEM, {-1, -1}},  // 234
+    {false, ISEL_NT_IMM, {-1, -1}},  // 235
+    {true, ISEL_CMP, {237, 238}},  // 236
+    {false, ISEL_NT_IMM, {-1, -1}},  // 237
+    {false, ISEL_NT_REG, {-1, -1}},  // 238
+    {true, ISEL_CMP, {240, 241}},  // 239
+    {false, ISEL_NT_IMM, {-1, -1}},  // 240
+    {false, ISEL_NT_MEM, {-1, -1}},  // 241
+    {false, ISEL_NT_REG, {-1, -1}},  // 242
+    {false, ISEL_NT_MEM, {-1, -1}},  // 243
+    {false, ISEL_NT_REG, {-1, -1}},  // 244
+    {true, ISEL_ASGN, {246, 247}},  // 245
+    {false, ISEL_NT_MEM, {-1, -1}},  // 246
+    {false, ISEL_NT_IMM, {-1, -1}},  // 247
+    {true, ISEL_ASGN, {249, 250}},  // 248
+    {false, ISEL_NT_ELEM, {-1, -1}},  // 249
+    {false, ISEL_NT_REG, {-1, -1}},  // 250
+    {true, ISEL_ASGN, {252, 253}},  // 251
+    {false, ISEL_NT_ELEM, {-1, -1}},  // 252
+    {false, ISEL_NT_IMM, {-1, -1}},  // 253
+    {true, ISEL_ASGN, {255, 256}},  // 254
+    {false, ISEL_NT_MEM, {-1, -1}},  // 255
+    {true, ISEL_ADD, {257, 258}},  // 256
+    {false, ISEL_NT_MEM, {-1, -1}},  // 257
+    {false, ISEL_NT_IMM, {-1, -1}},  // 258
+    {true, ISEL_ASGN, {260, 261}},  // 259
+    {false, ISEL_NT_MEM, {-1, -1}},  // 260
+    {true, ISEL_ADD, {262, 263}},  // 261
+    {false, ISEL_NT_MEM, {-1, -1}},  // 262
+    {false, ISEL_NT_REG, {-1, -1}},  // 263
+    {true, ISEL_ASGN, {265, 266}},  // 264
+    {false, ISEL_NT_MEM, {-1, -1}},  // 265
+    {true, ISEL_SUB, {267, 268}},  // 266
+    {false, ISEL_NT_MEM, {-1, -1}},  // 267
+    {false, ISEL_NT_IMM, {-1, -1}},  // 268
+    {true, ISEL_ASGN, {270, 271}},  // 269
+    {false, ISEL_NT_MEM, {-1, -1}},  // 270
+    {true, ISEL_SUB, {272, 273}},  // 271
+    {false, ISEL_NT_MEM, {-1, -1}},  // 272
+    {false, ISEL_NT_REG, {-1, -1}},  // 273
+};
+
+static const IselRule isel_rules[] = {
+    // imm: NUM, 0, if imm32 -> $%v
+    {ISEL_NT_IMM, 0, 0, isel_pred_imm32, NULL, "$%v"},
+    // con: NUM, 0, if imm32 -> %v
+    {ISEL_NT_CON, 1, 0, isel_pred_imm32, NULL, "%v"},
+    // scale: NUM, 0, if scale -> %v
+    {ISEL_NT_SCALE, 2, 0, isel_pred_scale, NULL, "%v"},
+    // zero: NUM, 0, if zero -> %v
+    {ISEL_NT_ZERO, 3, 0, isel_pred_zero, NULL, "%v"},
+    // pow2: NUM, 0, if pow2 -> %v
+    {ISEL_NT_POW2, 4, 0, isel_pred_pow2, NULL, "%v"},
+    // magic: NUM, 0, if magic -> %v
+    {ISEL_NT_MAGIC, 5, 0, isel_pred_magic, NULL, "%v"},
+    // magicadd: NUM, 0, if magicadd -> %v
+    {ISEL_NT_MAGICADD, 6, 0, isel_pred_magicadd, NULL, "%v"},
+    // mem: VAR, 0 -> %m
+    {ISEL_NT_MEM, 7, 0, NULL, NULL, "%m"},
+    // elem: ELEM(NUM), 0, if inbounds -> %a
+    {ISEL_NT_ELEM, 8, 0, isel_pred_inbounds, NULL, "%a"},
+    // elem: ELEM(reg), 0, if local -> %a
+    {ISEL_NT_ELEM, 10, 1, isel_pred_local, NULL, "%a"},
+    // elem: ELEM(reg), 1, if global { leaq %m, %%rdx } -> %a
+    {ISEL_NT_ELEM, 12, 1, isel_pred_global, "leaq %m, %%rdx", "%a"},
+    // reg: NUM, 1, if movl { movl $%v, %lr }
+    {ISEL_NT_REG, 14, 0, isel_pred_movl, "movl $%v, %lr", NULL},
+    // reg: imm, 1 { movq %0, %r }
+    {ISEL_NT_REG, 15, 1, NULL, "movq %0, %r", NULL},
+    // reg: NUM, 2 { movabsq $%v, %r }
+    {ISEL_NT_REG, 16, 0, NULL, "movabsq $%v, %r", NULL},
+    // reg: mem, 1, if sbyte { movsbl %0, %lr }
+    {ISEL_NT_REG, 17, 1, isel_pred_sbyte, "movsbl %0, %lr", NULL},
+    // reg: mem, 1, if ubyte { movzbl %0, %lr }
+    {ISEL_NT_REG, 18, 1, isel_pred_ubyte, "movzbl %0, %lr", NULL},
+    // reg: mem, 1, if sword { movswl %0, %lr }
+    {ISEL_NT_REG, 19, 1, isel_pred_sword, "movswl %0, %lr", NULL},
+    // reg: mem, 1, if uword { movzwl %0, %lr }
+    {ISEL_NT_REG, 20, 1, isel_pred_uword, "movzwl %0, %lr", NULL},
+    // reg: mem, 1 { mov%z %0, %r }
+    {ISEL_NT_REG, 21, 1, NULL, "mov%z %0, %r", NULL},
+    // reg: elem, 1, if sbyte { movsbl %0, %lr }
+    {ISEL_NT_REG, 22, 1, isel_pred_sbyte, "movsbl %0, %lr", NULL},
+    // reg: elem, 1, if ubyte { movzbl %0, %lr }
+    {ISEL_NT_REG, 23, 1, isel_pred_ubyte, "movzbl %0, %lr", NULL},
+    // reg: elem, 1, if sword { movswl %0, %lr }
+    {ISEL_NT_REG, 24, 1, isel_pred_sword, "movswl %0, %lr", NULL},
+    // reg: elem, 1, if uword { movzwl %0, %lr }
+    {ISEL_NT_REG, 25, 1, isel_pred_uword, "movzwl %0, %lr", NULL},
+    // reg: elem, 1 { mov%z %0, %r }
+    {ISEL_NT_REG, 26, 1, NULL, "mov%z %0, %r", NULL},
+    // reg: cc, 2 { set%0 %br; movzbl %br, %lr }
+    {ISEL_NT_REG, 27, 1, NULL, "set%0 %br\nmovzbl %br, %lr", NULL},
+    // reg: STR, 1 { leaq %m, %r }
+    {ISEL_NT_REG, 28, 0, NULL, "leaq %m, %r", NULL},
+    // reg: ANY, 5 { @ }
+    {ISEL_NT_REG, 29, 0, NULL, "@", NULL},
+    // reg: CVT(reg), 0, if narrow
+    {ISEL_NT_REG, 30, 1, isel_pred_narrow, NULL, NULL},
+    // reg: CVT(reg), 1, if sext8 { movsbl %0, %lr }
+    {ISEL_NT_REG, 32, 1, isel_pred_sext8, "movsbl %0, %lr", NULL},
+    // reg: CVT(mem), 1, if sext8 { movsbl %0, %lr }
+    {ISEL_NT_REG, 34, 1, isel_pred_sext8, "movsbl %0, %lr", NULL},
+    // reg: CVT(reg), 1, if sext8q { movsbq %0, %qr }
+    {ISEL_NT_REG, 36, 1, isel_pred_sext8q, "movsbq %0, %qr", NULL},
+    // reg: CVT(mem), 1, if sext8q { movsbq %0, %qr }
+    {ISEL_NT_REG, 38, 1, isel_pred_sext8q, "movsbq %0, %qr", NULL},
+    // reg: CVT(reg), 1, if zext8 { movzbl %0, %lr }
+    {ISEL_NT_REG, 40, 1, isel_pred_zext8, "movzbl %0, %lr", NULL},
+    // reg: CVT(mem), 1, if zext8 { movzbl %0, %lr }
+    {ISEL_NT_REG, 42, 1, isel_pred_zext8, "movzbl %0, %lr", NULL},
+    // reg: CVT(reg), 1, if sext16 { movswl %0, %lr }
+    {ISEL_NT_REG, 44, 1, isel_pred_sext16, "movswl %0, %lr", NULL},
+    // reg: CVT(mem), 1, if sext16 { movswl %0, %lr }
+    {ISEL_NT_REG, 46, 1, isel_pred_sext16, "movswl %0, %lr", NULL},
+    // reg: CVT(reg), 1, if sext16q { movswq %0, %qr }
+    {ISEL_NT_REG, 48, 1, isel_pred_sext16q, "movswq %0, %qr", NULL},
+    // reg: CVT(mem), 1, if sext16q { movswq %0, %qr }
+    {ISEL_NT_REG, 50, 1, isel_pred_sext16q, "movswq %0, %qr", NULL},
+    // reg: CVT(reg), 1, if zext16 { movzwl %0, %lr }
+    {ISEL_NT_REG, 52, 1, isel_pred_zext16, "movzwl %0, %lr", NULL},
+    // reg: CVT(mem), 1, if zext16 { movzwl %0, %lr }
+    {ISEL_NT_REG, 54, 1, isel_pred_zext16, "movzwl %0, %lr", NULL},
+    // reg: CVT(reg), 1, if sext32 { movslq %0, %qr }
+    {ISEL_NT_REG, 56, 1, isel_pred_sext32, "movslq %0, %qr", NULL},
+    // reg: CVT(mem), 1, if sext32 { movslq %0, %qr }
+    {ISEL_NT_REG, 58, 1, isel_pred_sext32, "movslq %0, %qr", NULL},
+    // reg: CVT(reg), 1, if zext32 { movl %0, %0 }
+    {ISEL_NT_REG, 60, 1, isel_pred_zext32, "movl %0, %0", NULL},
+    // reg: CVT(mem), 1, if zext32 { movl %0, %lr }
+    {ISEL_NT_REG, 62, 1, isel_pred_zext32, "movl %0, %lr", NULL},
+    // reg: ADD(reg, reg), 1 { add%z %1, %0 }
+    {ISEL_NT_REG, 64, 2, NULL, "add%z %1, %0", NULL},
+    // reg: ADD(reg, imm), 1 { add%z %1, %0 }
+    {ISEL_NT_REG, 67, 2, NULL, "add%z %1, %0", NULL},
+    // reg: ADD(imm, reg), 1 { add%z %0, %1 }
+    {ISEL_NT_REG, 70, 2, NULL, "add%z %0, %1", NULL},
+    // reg: ADD(reg, mem), 1 { add%z %1, %0 }
+    {ISEL_NT_REG, 73, 2, NULL, "add%z %1, %0", NULL},
+    // reg: ADD(mem, reg), 1 { add%z %0, %1 }
+    {ISEL_NT_REG, 76, 2, NULL, "add%z %0, %1", NULL},
+    // reg: MUL(reg, pow2), 1 { sal%z $%k, %0 }
+    {ISEL_NT_REG, 79, 2, NULL, "sal%z $%k, %0", NULL},
+    // reg: MUL(reg, scale), 1 { lea%z (,%q0,%1), %r }
+    {ISEL_NT_REG, 82, 2, NULL, "lea%z (,%q0,%1), %r", NULL},
+    // reg: ADD(reg, MUL(reg, scale)), 1 { lea%z (%q0,%q1,%2), %r }
+    {ISEL_NT_REG, 85, 3, NULL, "lea%z (%q0,%q1,%2), %r", NULL},
+    // reg: ADD(MUL(reg, scale), reg), 1 { lea%z (%q2,%q0,%1), %r }
+    {ISEL_NT_REG, 90, 3, NULL, "lea%z (%q2,%q0,%1), %r", NULL},
+    // reg: ADD(MUL(reg, scale), con), 1 { lea%z %2(,%q0,%1), %r }
+    {ISEL_NT_REG, 95, 3, NULL, "lea%z %2(,%q0,%1), %r", NULL},
+    // reg: ADD(ADD(reg, reg), con), 1 { lea%z %2(%q0,%q1), %r }
+    {ISEL_NT_REG, 100, 3, NULL, "lea%z %2(%q0,%q1), %r", NULL},
+    // reg: ADD(ADD(reg, MUL(reg, scale)), con), lea3 { lea%z %3(%q0,%q1,%2), %r }
+    {ISEL_NT_REG, 105, 4, NULL, "lea%z %3(%q0,%q1,%2), %r", NULL},
+    // reg: ADD(ADD(MUL(reg, scale), reg), con), lea3 { lea%z %3(%q2,%q0,%1), %r }
+    {ISEL_NT_REG, 112, 4, NULL, "lea%z %3(%q2,%q0,%1), %r", NULL},
+    // reg: SUB(reg, reg), 1 { sub%z %1, %0 }
+    {ISEL_NT_REG, 119, 2, NULL, "sub%z %1, %0", NULL},
+    // reg: SUB(reg, imm), 1 { sub%z %1, %0 }
+    {ISEL_NT_REG, 122, 2, NULL, "sub%z %1, %0", NULL},
+    // reg: SUB(reg, mem), 1 { sub%z %1, %0 }
+    {ISEL_NT_REG, 125, 2, NULL, "sub%z %1, %0", NULL},
+    // reg: SUB(imm, reg), 2 { neg%z %1; add%z %0, %1 }
+    {ISEL_NT_REG, 128, 2, NULL, "neg%z %1\nadd%z %0, %1", NULL},
+    // reg: SUB(mem, reg), 2 { neg%z %1; add%z %0, %1 }
+    {ISEL_NT_REG, 131, 2, NULL, "neg%z %1\nadd%z %0, %1", NULL},
+    // reg: MUL(reg, reg), imul { imul%z %1, %0 }
+    {ISEL_NT_REG, 134, 2, NULL, "imul%z %1, %0", NULL},
+    // reg: MUL(reg, mem), imul { imul%z %1, %0 }
+    {ISEL_NT_REG, 137, 2, NULL, "imul%z %1, %0", NULL},
+    // reg: MUL(mem, reg), imul { imul%z %0, %1 }
+    {ISEL_NT_REG, 140, 2, NULL, "imul%z %0, %1", NULL},
+    // reg: MUL(reg, imm), imul { imul%z %1, %0, %r }
+    {ISEL_NT_REG, 143, 2, NULL, "imul%z %1, %0, %r", NULL},
+    // reg: MUL(imm, reg), imul { imul%z %0, %1, %r }
+    {ISEL_NT_REG, 146, 2, NULL, "imul%z %0, %1, %r", NULL},
+    // reg: MUL(mem, imm), imul { imul%z %1, %0, %r }
+    {ISEL_NT_REG, 149, 2, NULL, "imul%z %1, %0, %r", NULL},
+    // reg: MUL(imm, mem), imul { imul%z %0, %1, %r }
+    {ISEL_NT_REG, 152, 2, NULL, "imul%z %0, %1, %r", NULL},
+    // reg: DIV(reg, reg), idiv32, if signed32 { cltd; idivl %1 }
+    {ISEL_NT_REG, 155, 2, isel_pred_signed32, "cltd\nidivl %1", NULL},
+    // reg: DIV(reg, mem), idiv32, if signed32 { cltd; idivl %1 }
+    {ISEL_NT_REG, 158, 2, isel_pred_signed32, "cltd\nidivl %1", NULL},
+    // reg: DIV(reg, reg), idiv32, if unsigned32 { xorl %%edx, %%edx; divl %1 }
+    {ISEL_NT_REG, 161, 2, isel_pred_unsigned32, "xorl %%edx, %%edx\ndivl %1", NULL},
+    // reg: DIV(reg, mem), idiv32, if unsigned32 { xorl %%edx, %%edx; divl %1 }
+    {ISEL_NT_REG, 164, 2, isel_pred_unsigned32, "xorl %%edx, %%edx\ndivl %1", NULL},
+    // reg: DIV(reg, reg), idiv, if signed64 { cqo; idivq %1 }
+    {ISEL_NT_REG, 167, 2, isel_pred_signed64, "cqo\nidivq %1", NULL},
+    // reg: DIV(reg, mem), idiv, if signed64 { cqo; idivq %1 }
+    {ISEL_NT_REG, 170, 2, isel_pred_signed64, "cqo\nidivq %1", NULL},
+    // reg: DIV(reg, reg), idiv, if unsigned64 { xorl %%edx, %%edx; divq %1 }
+    {ISEL_NT_REG, 173, 2, isel_pred_unsigned64, "xorl %%edx, %%edx\ndivq %1", NULL},
+    // reg: DIV(reg, mem), idiv, if unsigned64 { xorl %%edx, %%edx; divq %1 }
+    {ISEL_NT_REG, 176, 2, isel_pred_unsigned64, "xorl %%edx, %%edx\ndivq %1", NULL},
+    // reg: DIV(reg, pow2), 1, if unsigned32 { shrl $%k, %0 }
+    {ISEL_NT_REG, 179, 2, isel_pred_unsigned32, "shrl $%k, %0", NULL},
+    // reg: DIV(reg, pow2), 1, if unsigned64 { shrq $%k, %0 }
+    {ISEL_NT_REG, 182, 2, isel_pred_unsigned64, "shrq $%k, %0", NULL},
+    // reg: DIV(reg, pow2), 4, if signed32 { leal %n(%q0), %%ecx; testl %0, %0; cmovnsl %0, %%ecx; sarl $%k, %%ecx; movl %%ecx, %r }
+    {ISEL_NT_REG, 185, 2, isel_pred_signed32, "leal %n(%q0), %%ecx\ntestl %0, %0\ncmovnsl %0, %%ecx\nsarl $%k, %%ecx\nmovl %%ecx, %r", NULL},
+    // reg: DIV(reg, pow2), 4, if signed64 { leaq %n(%0), %%rcx; testq %0, %0; cmovnsq %0, %%rcx; sarq $%k, %%rcx; movq %%rcx, %r }
+    {ISEL_NT_REG, 188, 2, isel_pred_signed64, "leaq %n(%0), %%rcx\ntestq %0, %0\ncmovnsq %0, %%rcx\nsarq $%k, %%rcx\nmovq %%rcx, %r", NULL},
+    // reg: DIV(reg, magic), 7, if signed32 { movslq %0, %%rcx; movq %%rcx, %q0; movabsq $%M, %%rdx; imulq %%rdx; sarq $%S, %%rdx; shrq $63, %%rcx; leal (%%rdx,%%rcx), %r }
+    {ISEL_NT_REG, 191, 2, isel_pred_signed32, "movslq %0, %%rcx\nmovq %%rcx, %q0\nmovabsq $%M, %%rdx\nimulq %%rdx\nsarq $%S, %%rdx\nshrq $63, %%rcx\nleal (%%rdx,%%rcx), %r", NULL},
+    // reg: DIV(reg, magicadd), 8, if signed32 { movslq %0, %%rcx; movq %%rcx, %q0; movabsq $%M, %%rdx; imulq %%rdx; addq %%rcx, %%rdx; sarq $%S, %%rdx; shrq $63, %%rcx; leal (%%rdx,%%rcx), %r }
+    {ISEL_NT_REG, 194, 2, isel_pred_signed32, "movslq %0, %%rcx\nmovq %%rcx, %q0\nmovabsq $%M, %%rdx\nimulq %%rdx\naddq %%rcx, %%rdx\nsarq $%S, %%rdx\nshrq $63, %%rcx\nleal (%%rdx,%%rcx), %r", NULL},
+    // reg: DIV(reg, magic), 5, if unsigned32 { movl %0, %0; movabsq $%M, %%rdx; imulq %%rdx; sarq $%S, %%rdx; movl %%edx, %r }
+    {ISEL_NT_REG, 197, 2, isel_pred_unsigned32, "movl %0, %0\nmovabsq $%M, %%rdx\nimulq %%rdx\nsarq $%S, %%rdx\nmovl %%edx, %r", NULL},
+    // reg: DIV(reg, magicadd), 6, if unsigned32 { movl %0, %0; movq %q0, %%rcx; movabsq $%M, %%rdx; imulq %%rdx; addq %%rcx, %%rdx; sarq $%S, %%rdx; movl %%edx, %r }
+    {ISEL_NT_REG, 200, 2, isel_pred_unsigned32, "movl %0, %0\nmovq %q0, %%rcx\nmovabsq $%M, %%rdx\nimulq %%rdx\naddq %%rcx, %%rdx\nsarq $%S, %%rdx\nmovl %%edx, %r", NULL},
+    // reg: DIV(reg, magic), 7, if signed64 { movq %0, %%rcx; movabsq $%M, %%rdx; imulq %%rdx; sarq $%S, %%rdx; shrq $63, %%rcx; leaq (%%rdx,%%rcx), %r }
+    {ISEL_NT_REG, 203, 2, isel_pred_signed64, "movq %0, %%rcx\nmovabsq $%M, %%rdx\nimulq %%rdx\nsarq $%S, %%rdx\nshrq $63, %%rcx\nleaq (%%rdx,%%rcx), %r", NULL},
+    // reg: DIV(reg, magicadd), 8, if signed64 { movq %0, %%rcx; movabsq $%M, %%rdx; imulq %%rdx; addq %%rcx, %%rdx; sarq $%S, %%rdx; shrq $63, %%rcx; leaq (%%rdx,%%rcx), %r }
+    {ISEL_NT_REG, 206, 2, isel_pred_signed64, "movq %0, %%rcx\nmovabsq $%M, %%rdx\nimulq %%rdx\naddq %%rcx, %%rdx\nsarq $%S, %%rdx\nshrq $63, %%rcx\nleaq (%%rdx,%%rcx), %r", NULL},
+    // reg: ASGN(mem, reg), 1 { mov%z %1, %0 }
+    {ISEL_NT_REG, 209, 2, NULL, "mov%z %1, %0", NULL},
+    // reg: ASGN(elem, reg), 2 { mov%z %1, %0; mov%z %1, %r }
+    {ISEL_NT_REG, 212, 2, NULL, "mov%z %1, %0\nmov%z %1, %r", NULL},
+    // cc: CMP(reg, zero), 1 { test%z %0, %0 } -> %c
+    {ISEL_NT_CC, 215, 2, NULL, "test%z %0, %0", "%c"},
+    // cc: CMP(zero, reg), 1 { test%z %1, %1 } -> %s
+    {ISEL_NT_CC, 218, 2, NULL, "test%z %1, %1", "%s"},
+    // cc: CMP(reg, reg), 1 { cmp%z %1, %0 } -> %c
+    {ISEL_NT_CC, 221, 2, NULL, "cmp%z %1, %0", "%c"},
+    // cc: CMP(reg, imm), 1 { cmp%z %1, %0 } -> %c
+    {ISEL_NT_CC, 224, 2, NULL, "cmp%z %1, %0", "%c"},
+    // cc: CMP(reg, mem), 1 { cmp%z %1, %0 } -> %c
+    {ISEL_NT_CC, 227, 2, NULL, "cmp%z %1, %0", "%c"},
+    // cc: CMP(mem, reg), 1 { cmp%z %1, %0 } -> %c
+    {ISEL_NT_CC, 230, 2, NULL, "cmp%z %1, %0", "%c"},
+    // cc: CMP(mem, imm), 1 { cmp%z %1, %0 } -> %c
+    {ISEL_NT_CC, 233, 2, NULL, "cmp%z %1, %0", "%c"},
+    // cc: CMP(imm, reg), 1 { cmp%z %0, %1 } -> %s
+    {ISEL_NT_CC, 236, 2, NULL, "cmp%z %0, %1", "%s"},
+    // cc: CMP(imm, mem), 1 { cmp%z %0, %1 } -> %s
+    {ISEL_NT_CC, 239, 2, NULL, "cmp%z %0, %1", "%s"},
+    // cc: reg, 1 { test%z %0, %0 } -> ne
+    {ISEL_NT_CC, 242, 1, NULL, "test%z %0, %0", "ne"},
+    // cc: mem, 1 { cmp%z $0, %0 } -> ne
+    {ISEL_NT_CC, 243, 1, NULL, "cmp%z $0, %0", "ne"},
+    // stmt: reg, 0
+    {ISEL_NT_STMT, 244, 1, NULL, NULL, NULL},
+    // stmt: ASGN(mem, imm), 1 { mov%z %1, %0 }
+    {ISEL_NT_STMT, 245, 2, NULL, "mov%z %1, %0", NULL},
+    // stmt: ASGN(elem, reg), 1 { mov%z %1, %0 }
+    {ISEL_NT_STMT, 248, 2, NULL, "mov%z %1, %0", NULL},
+    // stmt: ASGN(elem, imm), 1 { mov%z %1, %0 }
+    {ISEL_NT_STMT, 251, 2, NULL, "mov%z %1, %0", NULL},
+    // stmt: ASGN(mem, ADD(mem, imm)), 1, if update { add%z %2, %0 }
+    {ISEL_NT_STMT, 254, 3, isel_pred_update, "add%z %2, %0", NULL},
+    // stmt: ASGN(mem, ADD(mem, reg)), 1, if update { add%z %2, %0 }
+    {ISEL_NT_STMT, 259, 3, isel_pred_update, "add%z %2, %0", NULL},
+    // stmt: ASGN(mem, SUB(mem, imm)), 1, if update { sub%z %2, %0 }
+    {ISEL_NT_STMT, 264, 3, isel_pred_update, "sub%z %2, %0", NULL},
+    // stmt: ASGN(mem, SUB(mem, reg)), 1, if update { sub%z %2, %0 }
+    {ISEL_NT_STMT, 269, 3, isel_pred_update, "sub%z %2, %0", NULL},
+};
+
+// Cost of each rule on each tier: x86-64 x86-64-v2 x86-64-v3
+static const short isel_rule_costs[][ISEL_TIER_COUNT] = {
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {0, 0, 0},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {2, 2, 2},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {2, 2, 2},
+    {1, 1, 1},
+    {5, 5, 5},
+    {0, 0, 0},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 2, 2},
+    {1, 2, 2},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {2, 2, 2},
+    {2, 2, 2},
+    {3, 3, 3},
+    {3, 3, 3},
+    {3, 3, 3},
+    {3, 3, 3},
+    {3, 3, 3},
+    {3, 3, 3},
+    {3, 3, 3},
+    {30, 26, 20},
+    {30, 26, 20},
+    {30, 26, 20},
+    {30, 26, 20},
+    {70, 60, 40},
+    {70, 60, 40},
+    {70, 60, 40},
+    {70, 60, 40},
+    {1, 1, 1},
+    {1, 1, 1},
+    {4, 4, 4},
+    {4, 4, 4},
+    {7, 7, 7},
+    {8, 8, 8},
+    {5, 5, 5},
+    {6, 6, 6},
+    {7, 7, 7},
+    {8, 8, 8},
+    {1, 1, 1},
+    {2, 2, 2},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {0, 0, 0},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+    {1, 1, 1},
+};
+
+static const short isel_term_rules[] = {
+    26, 0, 1, 2, 3, 4, 5, 6, 11, 13, 7, 44, 45, 46, 47, 48, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 49, 50, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 89, 90, 91, 92, 93, 94, 95, 96, 97, 87, 88, 101, 102, 103, 104, 105, 106, 107, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 25, 8, 9, 10,
+};
+
+static const short isel_term_rules_start[ISEL_TERM_COUNT + 1] = {
+    0, 1, 10, 11, 22, 27, 36, 54, 63, 72, 89, 90, 93,
+};
+
+// Rules whose pattern is a single nonterminal
+static const short isel_chain_rules[] = {
+    12, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 98, 99, 100,
+};
+#define ISEL_CHAIN_RULE_COUNT 15
+
+#endif // ISEL_RULES_H
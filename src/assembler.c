@@ -0,0 +1,1010 @@
+#include <ctype.h>
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assembler.h>
+#include <encoder.h>
+
+// A program is assembled in three steps. The lines are first turned into
+// items, each a run of bytes of one section: encoded instructions, data,
+// padding, and the jumps whose size is still open. Layout then places the
+// items, growing short jumps whose targets turn out to be out of reach
+// until nothing moves. Last, the bytes are written out and every symbolic
+// reference is either resolved or left as a relocation.
+
+typedef enum {
+    ITEM_BYTES,      // Fixed bytes from the pool, maybe with a rel32 to fill in
+    ITEM_JUMP,       // jmp or jcc to a symbol, short or near
+    ITEM_ALIGN,      // Padding to a multiple of addend bytes
+    ITEM_LABEL,      // Definition of symbol
+    ITEM_VALUE,      // .byte .short .long or .quad of symbol - minus + addend
+    ITEM_SPACE,      // .zero addend
+    ITEM_SIZE,       // .size symbol, .-symbol
+} ItemKind;
+
+typedef struct {
+    ItemKind kind;
+    int section;
+    int symbol;              // Referenced or defined symbol, or -1
+    int minus;               // ITEM_VALUE: symbol subtracted, or -1
+    long addend;
+    size_t data;             // ITEM_BYTES: start of the bytes in the pool
+    int length;              // Bytes; laid out for ITEM_JUMP and ITEM_ALIGN
+    unsigned long offset;    // In the section, once laid out
+    EncodeFixup fixup;       // ITEM_BYTES
+    int fixup_offset;        // Of the rel32 in the bytes
+    int condition;           // ITEM_JUMP: -1 for jmp
+    bool near;               // ITEM_JUMP: rel32 rather than rel8
+    long limit;              // ITEM_ALIGN: most bytes to pad, or -1
+    int region;              // Alignments before the item in its section
+} Item;
+
+#define SECTION_STACK_SIZE 16
+
+typedef struct {
+    Assembly *assembly;
+    Item *items;
+    int item_count;
+    int item_capacity;
+    unsigned char *pool;
+    size_t pool_size;
+    size_t pool_capacity;
+    int symbol_capacity;
+    int relocation_capacity;
+    int *buckets;            // Symbol index by name hash, -1 for empty
+    int bucket_count;
+    int section;             // Current section, or -1 before the first
+    int stack[SECTION_STACK_SIZE];
+    int depth;
+    const char *line;        // Being assembled, for error messages
+    char *error;
+    size_t error_size;
+} Assembler;
+
+// How a reference is resolved or relocated
+typedef enum {
+    REFERENCE_PC,            // sym(%rip) and label differences
+    REFERENCE_CALL,
+    REFERENCE_JUMP,          // jmp and jcc
+    REFERENCE_ABSOLUTE,      // Data
+} ReferenceKind;
+
+static bool fail(Assembler *as, const char *message) {
+    if (as->line) {
+        const char *line = as->line;
+        while (*line == '\t' || *line == ' ') line++;
+        snprintf(as->error, as->error_size, "%s: %s", message, line);
+    } else {
+        snprintf(as->error, as->error_size, "%s", message);
+    }
+    return false;
+}
+
+static unsigned hash_name(const char *name) {
+    unsigned hash = 2166136261u;
+    while (*name) {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void *grow(void *data, int *capacity, int count, size_t size) {
+    if (count < *capacity) return data;
+    int new_capacity = *capacity ? *capacity * 2 : 64;
+    void *grown = realloc(data, (size_t)new_capacity * size);
+    if (grown) *capacity = new_capacity;
+    return grown;
+}
+
+// Symbols without a name in the hash table: section symbols
+static int add_symbol(Assembler *as, const char *name) {
+    Assembly *assembly = as->assembly;
+    AsmSymbol *symbols = grow(assembly->symbols, &as->symbol_capacity, assembly->symbol_count, sizeof(AsmSymbol));
+    if (!symbols) return -1;
+    assembly->symbols = symbols;
+    char *copy = strdup(name);
+    if (!copy) return -1;
+    AsmSymbol *symbol = &symbols[assembly->symbol_count];
+    symbol->name = copy;
+    symbol->section = -1;
+    symbol->value = 0;
+    symbol->size = 0;
+    symbol->type = STT_NOTYPE;
+    symbol->global = false;
+    symbol->referenced = false;
+    return assembly->symbol_count++;
+}
+
+static bool rehash(Assembler *as, int bucket_count) {
+    int *buckets = malloc((size_t)bucket_count * sizeof(int));
+    if (!buckets) return false;
+    for (int i = 0; i < bucket_count; i++) buckets[i] = -1;
+    const Assembly *assembly = as->assembly;
+    for (int i = 0; i < assembly->symbol_count; i++) {
+        if (assembly->symbols[i].type == STT_SECTION) continue;
+        unsigned h = hash_name(assembly->symbols[i].name) & (unsigned)(bucket_count - 1);
+        while (buckets[h] >= 0) h = (h + 1) & (unsigned)(bucket_count - 1);
+        buckets[h] = i;
+    }
+    free(as->buckets);
+    as->buckets = buckets;
+    as->bucket_count = bucket_count;
+    return true;
+}
+
+// Index of the symbol called name, added undefined if it is new; -1 if
+// out of memory
+static int intern(Assembler *as, const char *name) {
+    unsigned mask = (unsigned)(as->bucket_count - 1);
+    unsigned h = hash_name(name) & mask;
+    for (int i; (i = as->buckets[h]) >= 0; h = (h + 1) & mask) {
+        if (strcmp(as->assembly->symbols[i].name, name) == 0) return i;
+    }
+    int index = add_symbol(as, name);
+    if (index < 0) return -1;
+    as->buckets[h] = index;
+    if (as->assembly->symbol_count * 2 > as->bucket_count && !rehash(as, as->bucket_count * 2)) return -1;
+    return index;
+}
+
+int assembly_find_symbol(const Assembly *assembly, const char *name) {
+    for (int i = 0; i < assembly->symbol_count; i++) {
+        if (assembly->symbols[i].type != STT_SECTION && strcmp(assembly->symbols[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static int section_symbol(Assembler *as, int section) {
+    AsmSection *s = &as->assembly->sections[section];
+    if (s->symbol < 0) {
+        int index = add_symbol(as, s->name);
+        if (index < 0) return -1;
+        as->assembly->symbols[index].section = section;
+        as->assembly->symbols[index].type = STT_SECTION;
+        s->symbol = index;
+    }
+    return s->symbol;
+}
+
+static Item *add_item(Assembler *as, ItemKind kind) {
+    if (as->section < 0) return NULL;
+    Item *items = grow(as->items, &as->item_capacity, as->item_count, sizeof(Item));
+    if (!items) return NULL;
+    as->items = items;
+    Item *item = &items[as->item_count++];
+    memset(item, 0, sizeof(Item));
+    item->kind = kind;
+    item->section = as->section;
+    item->symbol = -1;
+    item->minus = -1;
+    item->condition = -1;
+    item->limit = -1;
+    return item;
+}
+
+static bool add_bytes(Assembler *as, const unsigned char *bytes, size_t length) {
+    if (as->pool_size + length > as->pool_capacity) {
+        size_t capacity = as->pool_capacity ? as->pool_capacity : 4096;
+        while (capacity < as->pool_size + length) capacity *= 2;
+        unsigned char *pool = realloc(as->pool, capacity);
+        if (!pool) return fail(as, "out of memory");
+        as->pool = pool;
+        as->pool_capacity = capacity;
+    }
+    memcpy(as->pool + as->pool_size, bytes, length);
+    as->pool_size += length;
+    return true;
+}
+
+// Sections
+
+static int find_section(Assembler *as, const char *name, size_t length) {
+    const Assembly *assembly = as->assembly;
+    for (int i = 0; i < assembly->section_count; i++) {
+        if (strlen(assembly->sections[i].name) == length && strncmp(assembly->sections[i].name, name, length) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool starts_with(const char *s, const char *prefix) {
+    return strncmp(s, prefix, strlen(prefix)) == 0;
+}
+
+static int add_section(Assembler *as, const char *name, size_t length) {
+    Assembly *assembly = as->assembly;
+    AsmSection *sections = realloc(assembly->sections, (size_t)(assembly->section_count + 1) * sizeof(AsmSection));
+    if (!sections) return -1;
+    assembly->sections = sections;
+    char *copy = strndup(name, length);
+    if (!copy) return -1;
+
+    AsmSection *s = &sections[assembly->section_count];
+    s->name = copy;
+    s->type = SHT_PROGBITS;
+    s->entsize = 0;
+    s->align = 1;
+    s->data = NULL;
+    s->size = 0;
+    s->symbol = -1;
+    // The flags gas gives the usual sections when none are stated
+    if (strcmp(copy, ".bss") == 0 || starts_with(copy, ".bss.")) {
+        s->type = SHT_NOBITS;
+        s->flags = SHF_ALLOC | SHF_WRITE;
+    } else if (strcmp(copy, ".data") == 0 || starts_with(copy, ".data.")) {
+        s->flags = SHF_ALLOC | SHF_WRITE;
+    } else if (strcmp(copy, ".text") == 0 || starts_with(copy, ".text.")) {
+        s->flags = SHF_ALLOC | SHF_EXECINSTR;
+    } else if (strcmp(copy, ".rodata") == 0 || starts_with(copy, ".rodata.")) {
+        s->flags = SHF_ALLOC;
+    } else {
+        s->flags = 0;
+    }
+    return assembly->section_count++;
+}
+
+static const char *skip_spaces(const char *p) {
+    while (*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+static bool is_symbol_char(char c) {
+    return isalnum((unsigned char)c) || c == '_' || c == '.' || c == '$';
+}
+
+// name[,"flags"[,@type[,entsize]]]: switch to the section, creating it
+static bool parse_section(Assembler *as, const char *p) {
+    p = skip_spaces(p);
+    const char *name = p;
+    while (*p && *p != ',' && *p != ' ' && *p != '\t') p++;
+    size_t length = (size_t)(p - name);
+    if (length == 0) return fail(as, "missing section name");
+
+    int section = find_section(as, name, length);
+    bool created = section < 0;
+    if (created) section = add_section(as, name, length);
+    if (section < 0) return fail(as, "out of memory");
+    as->section = section;
+
+    p = skip_spaces(p);
+    if (*p != ',') return *p == '\0' || fail(as, "junk after section name");
+    p = skip_spaces(p + 1);
+    if (*p != '"') return fail(as, "bad section flags");
+    unsigned long flags = 0;
+    for (p++; *p && *p != '"'; p++) {
+        switch (*p) {
+        case 'a': flags |= SHF_ALLOC; break;
+        case 'w': flags |= SHF_WRITE; break;
+        case 'x': flags |= SHF_EXECINSTR; break;
+        case 'M': flags |= SHF_MERGE; break;
+        case 'S': flags |= SHF_STRINGS; break;
+        default: return fail(as, "unknown section flag");
+        }
+    }
+    if (*p != '"') return fail(as, "bad section flags");
+    p = skip_spaces(p + 1);
+
+    unsigned type = SHT_PROGBITS;
+    unsigned long entsize = 0;
+    if (*p == ',') {
+        p = skip_spaces(p + 1);
+        if (strncmp(p, "@progbits", 9) == 0) {
+            p += 9;
+        } else if (strncmp(p, "@nobits", 7) == 0) {
+            type = SHT_NOBITS;
+            p += 7;
+        } else {
+            return fail(as, "unknown section type");
+        }
+        p = skip_spaces(p);
+        if (*p == ',') {
+            char *end;
+            entsize = strtoul(skip_spaces(p + 1), &end, 0);
+            p = skip_spaces(end);
+        }
+    }
+    if (*p != '\0') return fail(as, "junk after section flags");
+    if ((flags & SHF_MERGE) && entsize == 0) return fail(as, "mergeable section without entry size");
+
+    AsmSection *s = &as->assembly->sections[section];
+    if (!created && (s->flags != flags || s->type != type)) return fail(as, "section flags changed");
+    s->flags = flags;
+    s->type = type;
+    s->entsize = entsize;
+    return true;
+}
+
+// Expressions
+
+static bool parse_name(const char **p, char *name, size_t size) {
+    const char *start = *p;
+    while (is_symbol_char(**p)) (*p)++;
+    size_t length = (size_t)(*p - start);
+    if (length == 0 || length >= size || isdigit((unsigned char)*start)) return false;
+    memcpy(name, start, length);
+    name[length] = '\0';
+    return true;
+}
+
+static bool parse_integer(const char **p, long *value) {
+    const char *s = *p;
+    bool negative = *s == '-';
+    if (negative) s = skip_spaces(s + 1);
+    if (!isdigit((unsigned char)*s)) return false;
+    char *end;
+    unsigned long magnitude = strtoul(s, &end, 0);
+    *value = negative ? -(long)magnitude : (long)magnitude;
+    *p = end;
+    return true;
+}
+
+// number, sym, sym+number, sym-number or sym-sym
+static bool parse_expression(Assembler *as, const char *p, Item *item) {
+    char name[ENCODER_SYMBOL_SIZE];
+    p = skip_spaces(p);
+    if (!parse_integer(&p, &item->addend)) {
+        if (!parse_name(&p, name, sizeof(name))) return fail(as, "bad expression");
+        item->symbol = intern(as, name);
+        if (item->symbol < 0) return fail(as, "out of memory");
+    }
+    for (p = skip_spaces(p); *p; p = skip_spaces(p)) {
+        char sign = *p;
+        if (sign != '+' && sign != '-') return fail(as, "bad expression");
+        p = skip_spaces(p + 1);
+        long value;
+        if (parse_integer(&p, &value)) {
+            item->addend += sign == '-' ? -value : value;
+        } else if (sign == '-' && item->symbol >= 0 && item->minus < 0 && parse_name(&p, name, sizeof(name))) {
+            item->minus = intern(as, name);
+            if (item->minus < 0) return fail(as, "out of memory");
+        } else {
+            return fail(as, "bad expression");
+        }
+    }
+    return true;
+}
+
+// Directives
+
+// The bytes of a quoted string with its escapes, plus a '\0' if terminate
+static bool parse_string(Assembler *as, const char *p, bool terminate) {
+    p = skip_spaces(p);
+    if (*p++ != '"') return fail(as, "expected a string");
+    size_t start = as->pool_size;
+    while (*p != '"') {
+        unsigned char c = (unsigned char)*p++;
+        if (c == '\0') return fail(as, "unterminated string");
+        if (c == '\\') {
+            c = (unsigned char)*p++;
+            switch (c) {
+            case 'n': c = '\n'; break;
+            case 't': c = '\t'; break;
+            case 'r': c = '\r'; break;
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case '\\': case '"': break;
+            case 'x': {
+                unsigned value = 0;
+                while (isxdigit((unsigned char)*p)) {
+                    value = value * 16 + (unsigned)(isdigit((unsigned char)*p) ? *p - '0' : (tolower((unsigned char)*p) - 'a' + 10));
+                    p++;
+                }
+                c = (unsigned char)value;
+                break;
+            }
+            default:
+                if (c < '0' || c > '7') return fail(as, "bad escape in string");
+                unsigned value = c - '0';
+                for (int i = 0; i < 2 && *p >= '0' && *p <= '7'; i++) value = value * 8 + (unsigned)(*p++ - '0');
+                c = (unsigned char)value;
+                break;
+            }
+        }
+        if (!add_bytes(as, &c, 1)) return false;
+    }
+    if (*skip_spaces(p + 1) != '\0') return fail(as, "junk after string");
+    if (terminate && !add_bytes(as, (const unsigned char *)"", 1)) return false;
+
+    Item *item = add_item(as, ITEM_BYTES);
+    if (!item) return fail(as, "out of memory");
+    item->data = start;
+    item->length = (int)(as->pool_size - start);
+    return true;
+}
+
+static bool add_align(Assembler *as, long align, long limit) {
+    if (align <= 0 || (align & (align - 1)) != 0) return fail(as, "alignment is not a power of 2");
+    Item *item = add_item(as, ITEM_ALIGN);
+    if (!item) return fail(as, "out of memory");
+    item->addend = align;
+    item->limit = limit;
+    AsmSection *s = &as->assembly->sections[as->section];
+    if ((unsigned long)align > s->align) s->align = (unsigned long)align;
+    return true;
+}
+
+// The symbol named at p, and p past it and a following comma
+static int directive_symbol(Assembler *as, const char **p) {
+    char name[ENCODER_SYMBOL_SIZE];
+    *p = skip_spaces(*p);
+    if (!parse_name(p, name, sizeof(name))) return -1;
+    *p = skip_spaces(*p);
+    if (**p == ',') *p = skip_spaces(*p + 1);
+    return intern(as, name);
+}
+
+static bool assemble_directive(Assembler *as, const char *text) {
+    const char *p = skip_spaces(text);
+    if (*p == '#' || *p == '\0') return true;
+
+    char name[32];
+    size_t length = 0;
+    while (p[length] && p[length] != ' ' && p[length] != '\t') length++;
+    if (length >= sizeof(name)) return fail(as, "unknown directive");
+    memcpy(name, p, length);
+    name[length] = '\0';
+    p = skip_spaces(p + length);
+
+    if (strcmp(name, ".section") == 0) return parse_section(as, p);
+    if (strcmp(name, ".text") == 0 || strcmp(name, ".data") == 0 || strcmp(name, ".bss") == 0) {
+        return parse_section(as, name);
+    }
+    if (strcmp(name, ".pushsection") == 0) {
+        if (as->depth == SECTION_STACK_SIZE) return fail(as, "sections nested too deeply");
+        as->stack[as->depth++] = as->section;
+        return parse_section(as, p);
+    }
+    if (strcmp(name, ".popsection") == 0) {
+        if (as->depth == 0) return fail(as, ".popsection without .pushsection");
+        as->section = as->stack[--as->depth];
+        return true;
+    }
+    if (strcmp(name, ".global") == 0 || strcmp(name, ".globl") == 0) {
+        int symbol = directive_symbol(as, &p);
+        if (symbol < 0) return fail(as, "bad symbol");
+        as->assembly->symbols[symbol].global = true;
+        return true;
+    }
+    if (strcmp(name, ".type") == 0) {
+        int symbol = directive_symbol(as, &p);
+        if (symbol < 0) return fail(as, "bad symbol");
+        if (strcmp(p, "@function") == 0) {
+            as->assembly->symbols[symbol].type = STT_FUNC;
+        } else if (strcmp(p, "@object") == 0) {
+            as->assembly->symbols[symbol].type = STT_OBJECT;
+        } else {
+            return fail(as, "unknown symbol type");
+        }
+        return true;
+    }
+    if (strcmp(name, ".size") == 0) {
+        int symbol = directive_symbol(as, &p);
+        if (symbol < 0) return fail(as, "bad symbol");
+        long size;
+        if (parse_integer(&p, &size) && *skip_spaces(p) == '\0') {
+            as->assembly->symbols[symbol].size = (unsigned long)size;
+            return true;
+        }
+        // .-symbol: measured once the section is laid out
+        char tail[ENCODER_SYMBOL_SIZE + 2];
+        snprintf(tail, sizeof(tail), ".-%s", as->assembly->symbols[symbol].name);
+        if (strcmp(p, tail) != 0) return fail(as, "unsupported .size expression");
+        Item *item = add_item(as, ITEM_SIZE);
+        if (!item) return fail(as, "no section");
+        item->symbol = symbol;
+        return true;
+    }
+
+    if (as->section < 0 && !parse_section(as, ".text")) return false;
+    if (strcmp(name, ".align") == 0 || strcmp(name, ".balign") == 0 || strcmp(name, ".p2align") == 0) {
+        long value, limit = -1;
+        if (!parse_integer(&p, &value)) return fail(as, "bad alignment");
+        p = skip_spaces(p);
+        if (*p == ',') {
+            p = skip_spaces(p + 1);
+            // No fill value: nops in code, zeros elsewhere
+            if (*p != ',') return fail(as, "unsupported alignment fill");
+            p = skip_spaces(p + 1);
+            if (!parse_integer(&p, &limit)) return fail(as, "bad alignment limit");
+            p = skip_spaces(p);
+        }
+        if (*p != '\0') return fail(as, "junk after alignment");
+        if (name[2] == '2') {
+            if (value < 0 || value > 30) return fail(as, "bad alignment");
+            value = 1L << value;
+        }
+        return add_align(as, value, limit);
+    }
+    if (strcmp(name, ".zero") == 0 || strcmp(name, ".skip") == 0 || strcmp(name, ".space") == 0) {
+        long count;
+        if (!parse_integer(&p, &count) || count < 0 || *skip_spaces(p) != '\0') return fail(as, "bad size");
+        Item *item = add_item(as, ITEM_SPACE);
+        if (!item) return fail(as, "out of memory");
+        item->addend = count;
+        return true;
+    }
+    if (strcmp(name, ".string") == 0 || strcmp(name, ".asciz") == 0) return parse_string(as, p, true);
+    if (strcmp(name, ".ascii") == 0) return parse_string(as, p, false);
+
+    int size = strcmp(name, ".byte") == 0 ? 1 :
+               strcmp(name, ".short") == 0 || strcmp(name, ".value") == 0 ? 2 :
+               strcmp(name, ".long") == 0 || strcmp(name, ".int") == 0 ? 4 :
+               strcmp(name, ".quad") == 0 ? 8 : 0;
+    if (size == 0) return fail(as, "unknown directive");
+    Item *item = add_item(as, ITEM_VALUE);
+    if (!item) return fail(as, "out of memory");
+    item->length = size;
+    return parse_expression(as, p, item);
+}
+
+static bool assemble_instruction(Assembler *as, const char *text) {
+    EncodedInsn encoded;
+    char message[ASSEMBLER_ERROR_SIZE];
+    if (!encode_insn(text, &encoded, message, sizeof(message))) {
+        snprintf(as->error, as->error_size, "%s", message);
+        return false;
+    }
+    if (as->section < 0 && !parse_section(as, ".text")) return false;
+
+    int symbol = -1;
+    if (encoded.fixup != ENCODE_NONE) {
+        symbol = intern(as, encoded.symbol);
+        if (symbol < 0) return fail(as, "out of memory");
+    }
+    if (encoded.fixup == ENCODE_JUMP) {
+        Item *item = add_item(as, ITEM_JUMP);
+        if (!item) return fail(as, "out of memory");
+        item->symbol = symbol;
+        item->condition = encoded.condition;
+        return true;
+    }
+
+    size_t start = as->pool_size;
+    if (!add_bytes(as, encoded.bytes, (size_t)encoded.length)) return false;
+    Item *item = add_item(as, ITEM_BYTES);
+    if (!item) return fail(as, "out of memory");
+    item->data = start;
+    item->length = encoded.length;
+    item->fixup = encoded.fixup;
+    item->fixup_offset = encoded.offset;
+    item->symbol = symbol;
+    item->addend = encoded.addend;
+    if (encoded.fixup == ENCODE_IMM32) {
+        item->minus = intern(as, encoded.minus);
+        if (item->minus < 0) return fail(as, "out of memory");
+    }
+    return true;
+}
+
+static bool assemble_label(Assembler *as, const char *name) {
+    if (as->section < 0 && !parse_section(as, ".text")) return false;
+    int symbol = intern(as, name);
+    if (symbol < 0) return fail(as, "out of memory");
+    AsmSymbol *s = &as->assembly->symbols[symbol];
+    if (s->section >= 0) return fail(as, "symbol already defined");
+    s->section = as->section;
+    Item *item = add_item(as, ITEM_LABEL);
+    if (!item) return fail(as, "out of memory");
+    item->symbol = symbol;
+    return true;
+}
+
+// Layout
+
+static int jump_length(const Item *item) {
+    if (!item->near) return 2;
+    return item->condition < 0 ? 5 : 6;
+}
+
+// Bytes of padding from offset to the item's alignment
+static int padding(const Item *item, unsigned long offset) {
+    unsigned long align = (unsigned long)item->addend;
+    long pad = (long)((align - offset % align) % align);
+    if (item->limit >= 0 && pad > item->limit) return 0;
+    return (int)pad;
+}
+
+// Whether a short jump at offset, in this pass, is out of reach of its
+// target, judged as gas's relax_frag does. A target behind the jump has
+// its new place; one ahead still has last pass's, which it is assumed to
+// keep or to move by the stretch so far. When an alignment lies between,
+// which may absorb the stretch, the stretch counts only if it is negative.
+static bool out_of_reach(const Item *jump, const Item *label, bool behind, long target, long stretch) {
+    long address = (long)jump->offset + 1;
+    if (!behind && stretch != 0) {
+        if (stretch < 0 || label->region == jump->region) {
+            target += stretch;
+        } else if (target < address) {
+            return false;
+        }
+    }
+    long aim = target - address;
+    return aim > 128 || aim < -127;
+}
+
+// Place every item, and the labels with them, relaxing jumps the way gas
+// does so the code comes out the same: jumps to the same section start
+// short, then pass after pass every item moves by the growth of what
+// comes before it in its section, the stretch, and each short jump found
+// out of reach grows, until a pass changes nothing. Jumps only grow, so
+// this ends.
+static bool layout(Assembler *as, unsigned long *cursors) {
+    Assembly *assembly = as->assembly;
+    int *labels = malloc(((size_t)assembly->symbol_count + 1) * sizeof(int));
+    long *stretches = calloc((size_t)assembly->section_count + 1, sizeof(long));
+    int *regions = calloc((size_t)assembly->section_count + 1, sizeof(int));
+    if (!labels || !stretches || !regions) {
+        free(labels);
+        free(stretches);
+        free(regions);
+        return fail(as, "out of memory");
+    }
+
+    // First guess, with the regions between alignments
+    for (int i = 0; i < as->item_count; i++) {
+        Item *item = &as->items[i];
+        unsigned long offset = cursors[item->section];
+        item->offset = offset;
+        item->region = regions[item->section];
+        switch (item->kind) {
+        case ITEM_JUMP:
+            item->near = assembly->symbols[item->symbol].section != item->section;
+            item->length = jump_length(item);
+            break;
+        case ITEM_ALIGN:
+            item->length = padding(item, offset);
+            regions[item->section]++;
+            break;
+        case ITEM_LABEL:
+            assembly->symbols[item->symbol].value = offset;
+            labels[item->symbol] = i;
+            break;
+        case ITEM_SPACE:
+            item->length = (int)item->addend;
+            break;
+        default:
+            break;
+        }
+        cursors[item->section] = offset + (unsigned long)item->length;
+    }
+
+    bool stretched;
+    do {
+        stretched = false;
+        for (int s = 0; s < assembly->section_count; s++) stretches[s] = 0;
+        for (int i = 0; i < as->item_count; i++) {
+            Item *item = &as->items[i];
+            long *stretch = &stretches[item->section];
+            item->offset = (unsigned long)((long)item->offset + *stretch);
+            int growth = 0;
+            if (item->kind == ITEM_LABEL) {
+                assembly->symbols[item->symbol].value = item->offset;
+            } else if (item->kind == ITEM_ALIGN) {
+                int length = padding(item, item->offset);
+                growth = length - item->length;
+                item->length = length;
+            } else if (item->kind == ITEM_JUMP && !item->near) {
+                int label = labels[item->symbol];
+                long target = (long)assembly->symbols[item->symbol].value;
+                if (out_of_reach(item, &as->items[label], label < i, target, *stretch)) {
+                    item->near = true;
+                    growth = jump_length(item) - item->length;
+                    item->length = jump_length(item);
+                }
+            }
+            if (growth != 0) {
+                *stretch += growth;
+                stretched = true;
+            }
+        }
+    } while (stretched);
+
+    for (int s = 0; s < assembly->section_count; s++) cursors[s] = 0;
+    for (int i = 0; i < as->item_count; i++) {
+        const Item *item = &as->items[i];
+        cursors[item->section] = item->offset + (unsigned long)item->length;
+    }
+    free(labels);
+    free(stretches);
+    free(regions);
+    return true;
+}
+
+// Emission
+
+static bool add_relocation(Assembler *as, int section, unsigned long offset, unsigned type, int symbol, long addend) {
+    Assembly *assembly = as->assembly;
+    AsmRelocation *relocations = grow(assembly->relocations, &as->relocation_capacity,
+                                      assembly->relocation_count, sizeof(AsmRelocation));
+    if (!relocations) return fail(as, "out of memory");
+    assembly->relocations = relocations;
+    AsmRelocation *r = &assembly->relocations[assembly->relocation_count++];
+    r->section = section;
+    r->offset = offset;
+    r->type = type;
+    r->symbol = symbol;
+    r->addend = addend;
+    assembly->symbols[symbol].referenced = true;
+    return true;
+}
+
+static void store(unsigned char *out, long value, int size) {
+    for (int i = 0; i < size; i++) out[i] = (unsigned char)((unsigned long)value >> (8 * i));
+}
+
+// Fill in the size-byte field at offset in section with symbol + addend,
+// less the field's own address unless the reference is absolute, or leave
+// it zero and add the relocation gas would. References within a section
+// are resolved, but for calls and sym(%rip) to global symbols, which
+// could be preempted. Relocations against global and undefined symbols
+// are kept against the symbol; other local ones are made against the
+// section symbol, except in mergeable sections where that would lose the
+// string a displaced reference is to.
+static bool reference(Assembler *as, int section, unsigned long offset, int size,
+                      ReferenceKind kind, int symbol, long addend) {
+    Assembly *assembly = as->assembly;
+    AsmSymbol *target = &assembly->symbols[symbol];
+    unsigned char *field = assembly->sections[section].data + offset;
+    bool global = target->global || target->section < 0;
+
+    if (kind != REFERENCE_ABSOLUTE && target->section == section && (!global || kind == REFERENCE_JUMP)) {
+        long value = (long)target->value + addend - (long)offset;
+        if (size == 4 && (value < INT32_MIN || value > INT32_MAX)) return fail(as, "displacement out of range");
+        store(field, value, size);
+        return true;
+    }
+
+    unsigned type;
+    if (kind == REFERENCE_ABSOLUTE) {
+        type = size == 8 ? R_X86_64_64 : R_X86_64_32;
+    } else if (kind != REFERENCE_PC && global) {
+        type = R_X86_64_PLT32;
+    } else {
+        type = size == 8 ? R_X86_64_PC64 : R_X86_64_PC32;
+    }
+    if (!global && !((assembly->sections[target->section].flags & SHF_MERGE) && addend != 0)) {
+        addend += (long)target->value;
+        symbol = section_symbol(as, target->section);
+        if (symbol < 0) return fail(as, "out of memory");
+    }
+    return add_relocation(as, section, offset, type, symbol, addend);
+}
+
+// symbol - minus of an immediate: a constant once both are laid out
+static bool emit_distance(Assembler *as, const Item *item, unsigned char *field) {
+    const AsmSymbol *target = &as->assembly->symbols[item->symbol];
+    const AsmSymbol *minus = &as->assembly->symbols[item->minus];
+    if (target->section < 0 || target->section != minus->section) {
+        return fail(as, "distance between symbols not in one section");
+    }
+    long value = (long)(target->value - minus->value);
+    if (value < INT32_MIN || value > INT32_MAX) return fail(as, "distance out of range");
+    store(field, value, 4);
+    return true;
+}
+
+static bool emit_value(Assembler *as, const Item *item) {
+    Assembly *assembly = as->assembly;
+    unsigned char *field = assembly->sections[item->section].data + item->offset;
+    if (item->symbol < 0) {
+        store(field, item->addend, item->length);
+        return true;
+    }
+    const AsmSymbol *target = &assembly->symbols[item->symbol];
+    if (item->minus < 0) {
+        if (item->length < 4) return fail(as, "symbol in a value too small for it");
+        return reference(as, item->section, item->offset, item->length, REFERENCE_ABSOLUTE, item->symbol, item->addend);
+    }
+    const AsmSymbol *minus = &assembly->symbols[item->minus];
+    if (minus->section < 0 || target->section < 0) return fail(as, "difference of undefined symbols");
+    if (minus->section == target->section) {
+        store(field, (long)(target->value - minus->value) + item->addend, item->length);
+        return true;
+    }
+    // A label of another section less one of this section: the distance
+    // from the field, which the linker fills in as a PC-relative value
+    if (minus->section != item->section || item->length < 4) return fail(as, "difference of symbols in other sections");
+    long addend = item->addend + (long)(item->offset - minus->value);
+    return reference(as, item->section, item->offset, item->length, REFERENCE_PC, item->symbol, addend);
+}
+
+static bool emit(Assembler *as) {
+    Assembly *assembly = as->assembly;
+    for (int i = 0; i < as->item_count; i++) {
+        const Item *item = &as->items[i];
+        AsmSection *section = &assembly->sections[item->section];
+        if (item->kind == ITEM_SIZE) {
+            AsmSymbol *symbol = &assembly->symbols[item->symbol];
+            if (symbol->section != item->section) return fail(as, ".size of a symbol in another section");
+            symbol->size = item->offset - symbol->value;
+            continue;
+        }
+        if (item->length == 0 || item->kind == ITEM_LABEL) continue;
+        if (!section->data) {
+            if (item->kind != ITEM_SPACE && item->kind != ITEM_ALIGN) return fail(as, "data in a section without contents");
+            continue;
+        }
+        unsigned char *out = section->data + item->offset;
+        switch (item->kind) {
+        case ITEM_BYTES:
+            memcpy(out, as->pool + item->data, (size_t)item->length);
+            if (item->fixup == ENCODE_IMM32) {
+                if (!emit_distance(as, item, out + item->fixup_offset)) return false;
+            } else if (item->fixup != ENCODE_NONE) {
+                ReferenceKind kind = item->fixup == ENCODE_CALL ? REFERENCE_CALL : REFERENCE_PC;
+                if (!reference(as, item->section, item->offset + (unsigned long)item->fixup_offset, 4,
+                               kind, item->symbol, item->addend)) {
+                    return false;
+                }
+            }
+            break;
+        case ITEM_JUMP: {
+            const AsmSymbol *target = &assembly->symbols[item->symbol];
+            if (!item->near) {
+                encode_jump(item->condition, false, (long)target->value - (long)(item->offset + 2), out);
+                break;
+            }
+            int length = encode_jump(item->condition, true, 0, out);
+            if (!reference(as, item->section, item->offset + (unsigned long)length - 4, 4,
+                           REFERENCE_JUMP, item->symbol, -4)) {
+                return false;
+            }
+            break;
+        }
+        case ITEM_ALIGN:
+            if (section->flags & SHF_EXECINSTR) encode_nops(out, item->length);
+            break;
+        case ITEM_VALUE:
+            if (!emit_value(as, item)) return false;
+            break;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+// Entry points
+
+void assembly_free(Assembly *assembly) {
+    if (!assembly) return;
+    for (int i = 0; i < assembly->section_count; i++) {
+        free(assembly->sections[i].name);
+        free(assembly->sections[i].data);
+    }
+    for (int i = 0; i < assembly->symbol_count; i++) free(assembly->symbols[i].name);
+    free(assembly->sections);
+    free(assembly->symbols);
+    free(assembly->relocations);
+    free(assembly);
+}
+
+static bool assemble_lines(Assembler *as, InsnList *code) {
+    for (int i = 0; i < code->count; i++) {
+        const Insn *insn = &code->items[i];
+        as->line = insn->text;
+        bool ok = true;
+        switch (insn->kind) {
+        case INSN_OP:
+            ok = assemble_instruction(as, insn->text);
+            break;
+        case INSN_LABEL:
+            ok = assemble_label(as, insn->label);
+            break;
+        case INSN_DIRECTIVE:
+            ok = assemble_directive(as, insn->text);
+            break;
+        case INSN_DELETED:
+            break;
+        }
+        if (!ok) return false;
+    }
+    as->line = NULL;
+    return true;
+}
+
+Assembly *assemble(InsnList *code, char *error, size_t error_size) {
+    Assembler as = {0};
+    as.section = -1;
+    as.error = error;
+    as.error_size = error_size;
+    as.assembly = calloc(1, sizeof(Assembly));
+    // The sections gas always has, in its order
+    if (!as.assembly || !rehash(&as, 1024) || add_section(&as, ".text", 5) < 0 ||
+        add_section(&as, ".data", 5) < 0 || add_section(&as, ".bss", 4) < 0) {
+        snprintf(error, error_size, "out of memory");
+        assembly_free(as.assembly);
+        free(as.buckets);
+        return NULL;
+    }
+
+    unsigned long *cursors = NULL;
+    bool ok = assemble_lines(&as, code);
+    if (ok) {
+        cursors = calloc((size_t)as.assembly->section_count + 1, sizeof(unsigned long));
+        ok = cursors != NULL || fail(&as, "out of memory");
+    }
+    if (ok) {
+        for (int i = 0; ok && i < as.assembly->symbol_count; i++) {
+            const AsmSymbol *symbol = &as.assembly->symbols[i];
+            if (symbol->section < 0 && symbol->type != STT_NOTYPE) ok = fail(&as, "symbol typed but not defined");
+        }
+    }
+    if (ok) {
+        ok = layout(&as, cursors);
+        for (int s = 0; ok && s < as.assembly->section_count; s++) {
+            AsmSection *section = &as.assembly->sections[s];
+            section->size = cursors[s];
+            if (section->type == SHT_NOBITS) continue;
+            section->data = calloc(section->size + 1, 1);
+            ok = section->data != NULL || fail(&as, "out of memory");
+        }
+    }
+    ok = ok && emit(&as);
+    if (ok) {
+        // Symbols used but never defined are left to the linker
+        for (int i = 0; i < as.assembly->symbol_count; i++) {
+            AsmSymbol *symbol = &as.assembly->symbols[i];
+            if (symbol->section < 0 && symbol->referenced) symbol->global = true;
+        }
+    }
+
+    free(cursors);
+    free(as.items);
+    free(as.pool);
+    free(as.buckets);
+    if (!ok) {
+        assembly_free(as.assembly);
+        return NULL;
+    }
+    return as.assembly;
+}
+
+bool assembly_link(Assembly *assembly, const unsigned long *addresses,
+                   unsigned long (*resolve)(const char *name, void *context), void *context,
+                   char *error, size_t error_size) {
+    for (int i = 0; i < assembly->relocation_count; i++) {
+        const AsmRelocation *r = &assembly->relocations[i];
+        const AsmSymbol *symbol = &assembly->symbols[r->symbol];
+        unsigned long target;
+        if (symbol->section >= 0) {
+            target = addresses[symbol->section] + symbol->value;
+        } else {
+            target = resolve ? resolve(symbol->name, context) : 0;
+            if (target == 0) {
+                snprintf(error, error_size, "undefined reference to %s", symbol->name);
+                return false;
+            }
+        }
+        unsigned long place = addresses[r->section] + r->offset;
+        unsigned char *field = assembly->sections[r->section].data + r->offset;
+        long value = (long)(target + (unsigned long)r->addend);
+        switch (r->type) {
+        case R_X86_64_64:
+            store(field, value, 8);
+            continue;
+        case R_X86_64_PC64:
+            store(field, value - (long)place, 8);
+            continue;
+        case R_X86_64_32:
+            if ((unsigned long)value > UINT32_MAX) break;
+            store(field, value, 4);
+            continue;
+        case R_X86_64_PC32:
+        case R_X86_64_PLT32:
+            value -= (long)place;
+            if (value < INT32_MIN || value > INT32_MAX) break;
+            store(field, value, 4);
+            continue;
+        default:
+            snprintf(error, error_size, "unknown relocation type %u", r->type);
+            return false;
+        }
+        snprintf(error, error_size, "relocation to %s out of range", symbol->name);
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
@@ -7,6 +7,8 @@ ASTNode *ast_create_node(NodeType type) {
     if (!node) return NULL;
     
     node->type = type;
+    node->profile_id = 0;
+    node->value_type = TYPE_INT;
     memset(&node->data, 0, sizeof(node->data));
     return node;
 }
@@ -20,13 +22,19 @@ void ast_free(ASTNode *node) {
                 ast_free(node->data.program.functions[i]);
             }
             free(node->data.program.functions);
+            for (int i = 0; i < node->data.program.global_count; i++) {
+                ast_free(node->data.program.globals[i]);
+            }
+            free(node->data.program.globals);
             break;
 
         case NODE_FUNCTION:
+        case NODE_EXTERN_FUNCTION:
             for (int i = 0; i < node->data.function.param_count; i++) {
                 free(node->data.function.params[i]);
             }
             free(node->data.function.params);
+            free(node->data.function.param_types);
             free(node->data.function.name);
             ast_free(node->data.function.body);
             break;
@@ -54,7 +62,10 @@ void ast_free(ASTNode *node) {
             break;
 
         case NODE_FOR:
-            // TODO: Implement for loop cleanup
+            ast_free(node->data.for_stmt.init);
+            ast_free(node->data.for_stmt.condition);
+            ast_free(node->data.for_stmt.step);
+            ast_free(node->data.for_stmt.body);
             break;
 
         case NODE_BINARY_OP:
@@ -93,6 +104,39 @@ void ast_free(ASTNode *node) {
         case NODE_ASSIGNMENT:
             // TODO: Implement assignment cleanup
             break;
+
+        case NODE_INLINE:
+            free(node->data.inline_call.name);
+            ast_free(node->data.inline_call.body);
+            break;
+        case NODE_SELECT:
+            ast_free(node->data.select.condition);
+            ast_free(node->data.select.if_true);
+            ast_free(node->data.select.if_false);
+            break;
+        case NODE_SWITCH:
+            ast_free(node->data.switch_stmt.value);
+            ast_free(node->data.switch_stmt.body);
+            break;
+        case NODE_GLOBAL:
+            free(node->data.global.name);
+            ast_free(node->data.global.init);
+            break;
+        case NODE_INDEX:
+            ast_free(node->data.index.array);
+            ast_free(node->data.index.index);
+            break;
+        case NODE_VECTOR:
+            ast_free(node->data.vector.loop);
+            ast_free(node->data.vector.counter);
+            ast_free(node->data.vector.limit);
+            ast_free(node->data.vector.operation);
+            ast_free(node->data.vector.check);
+            break;
+        case NODE_CASE:
+        case NODE_BREAK:
+            // Nothing to free for case labels and breaks
+            break;
     }
 
     free(node);
@@ -104,10 +148,13 @@ ASTNode *ast_create_program(void) {
 
     node->data.program.functions = NULL;
     node->data.program.function_count = 0;
+    node->data.program.globals = NULL;
+    node->data.program.global_count = 0;
     return node;
 }
 
-ASTNode *ast_create_function(const char *name, char **params, int param_count, ASTNode *body) {
+ASTNode *ast_create_function(const char *name, char **params, const TypeKind *param_types,
+                             int param_count, ASTNode *body) {
     ASTNode *node = ast_create_node(NODE_FUNCTION);
     if (!node) return NULL;
 
@@ -118,7 +165,8 @@ ASTNode *ast_create_function(const char *name, char **params, int param_count, A
     }
 
     node->data.function.params = malloc(sizeof(char *) * param_count);
-    if (!node->data.function.params) {
+    node->data.function.param_types = malloc(sizeof(TypeKind) * param_count);
+    if (!node->data.function.params || !node->data.function.param_types) {
         ast_free(node);
         return NULL;
     }
@@ -129,6 +177,7 @@ ASTNode *ast_create_function(const char *name, char **params, int param_count, A
             ast_free(node);
             return NULL;
         }
+        node->data.function.param_types[i] = param_types[i];
     }
 
     node->data.function.param_count = param_count;
@@ -172,6 +221,17 @@ ASTNode *ast_create_while(ASTNode *condition, ASTNode *body) {
     return node;
 }
 
+ASTNode *ast_create_for(ASTNode *init, ASTNode *condition, ASTNode *step, ASTNode *body) {
+    ASTNode *node = ast_create_node(NODE_FOR);
+    if (!node) return NULL;
+
+    node->data.for_stmt.init = init;
+    node->data.for_stmt.condition = condition;
+    node->data.for_stmt.step = step;
+    node->data.for_stmt.body = body;
+    return node;
+}
+
 ASTNode *ast_create_binary_op(char operator, ASTNode *left, ASTNode *right) {
     ASTNode *node = ast_create_node(NODE_BINARY_OP);
     if (!node) return NULL;
@@ -179,6 +239,11 @@ ASTNode *ast_create_binary_op(char operator, ASTNode *left, ASTNode *right) {
     node->data.binary_op.operator = operator;
     node->data.binary_op.left = left;
     node->data.binary_op.right = right;
+    // Assignments and arithmetic have the type of their (converted) left
+    // operand, comparisons and logical operators are int
+    if (left && (operator == '=' || operator == '+' || operator == '-' || operator == '*' || operator == '/')) {
+        node->value_type = left->value_type;
+    }
     return node;
 }
 
@@ -191,7 +256,7 @@ ASTNode *ast_create_unary_op(char operator, ASTNode *operand) {
     return node;
 }
 
-ASTNode *ast_create_number(int value) {
+ASTNode *ast_create_number(long value) {
     ASTNode *node = ast_create_node(NODE_NUMBER);
     if (!node) return NULL;
 
@@ -254,4 +319,306 @@ ASTNode *ast_create_call(const char *name, ASTNode **args, int arg_count) {
     
     node->data.call.arg_count = arg_count;
     return node;
+}
+
+ASTNode *ast_create_inline(const char *name, ASTNode *body) {
+    ASTNode *node = ast_create_node(NODE_INLINE);
+    if (!node) return NULL;
+
+    node->data.inline_call.name = strdup(name);
+    if (!node->data.inline_call.name) {
+        ast_free(node);
+        return NULL;
+    }
+    node->data.inline_call.body = body;
+    return node;
+}
+
+ASTNode *ast_create_select(ASTNode *condition, ASTNode *if_true, ASTNode *if_false) {
+    ASTNode *node = ast_create_node(NODE_SELECT);
+    if (!node) return NULL;
+
+    node->data.select.condition = condition;
+    node->data.select.if_true = if_true;
+    node->data.select.if_false = if_false;
+    node->value_type = if_true->value_type;
+    return node;
+}
+
+ASTNode *ast_create_cast(TypeKind type, ASTNode *operand) {
+    ASTNode *node = ast_create_unary_op('C', operand);
+    if (!node) return NULL;
+
+    node->value_type = type;
+    return node;
+}
+
+ASTNode *ast_create_switch(ASTNode *value, ASTNode *body) {
+    ASTNode *node = ast_create_node(NODE_SWITCH);
+    if (!node) return NULL;
+
+    node->data.switch_stmt.value = value;
+    node->data.switch_stmt.body = body;
+    return node;
+}
+
+ASTNode *ast_create_case(long value, bool is_default) {
+    ASTNode *node = ast_create_node(NODE_CASE);
+    if (!node) return NULL;
+
+    node->data.case_label.value = value;
+    node->data.case_label.is_default = is_default;
+    return node;
+}
+
+ASTNode *ast_create_break(void) {
+    return ast_create_node(NODE_BREAK);
+}
+
+ASTNode *ast_create_global(const char *name, TypeKind type, ASTNode *init) {
+    ASTNode *node = ast_create_node(NODE_GLOBAL);
+    if (!node) return NULL;
+
+    node->value_type = type;
+    node->data.global.init = init;
+    node->data.global.name = strdup(name);
+    if (!node->data.global.name) {
+        ast_free(node);
+        return NULL;
+    }
+    return node;
+}
+
+ASTNode *ast_create_index(ASTNode *array, ASTNode *index) {
+    ASTNode *node = ast_create_node(NODE_INDEX);
+    if (!node) return NULL;
+
+    node->data.index.array = array;
+    node->data.index.index = index;
+    if (array) node->value_type = array->value_type;
+    return node;
+}
+
+ASTNode *ast_create_vector(ASTNode *loop, ASTNode *counter, ASTNode *limit, ASTNode *operation,
+                           ASTNode *check, int lanes) {
+    ASTNode *node = ast_create_node(NODE_VECTOR);
+    if (!node) return NULL;
+
+    node->data.vector.loop = loop;
+    node->data.vector.counter = counter;
+    node->data.vector.limit = limit;
+    node->data.vector.operation = operation;
+    node->data.vector.check = check;
+    node->data.vector.lanes = lanes;
+    return node;
+}
+
+static ASTNode *clone_node(const ASTNode *node) {
+    switch (node->type) {
+        case NODE_PROGRAM: {
+            ASTNode *copy = ast_create_program();
+            for (int i = 0; i < node->data.program.function_count; i++) {
+                void *temp = realloc(copy->data.program.functions,
+                                     sizeof(ASTNode*) * (copy->data.program.function_count + 1));
+                if (!temp) break;
+                copy->data.program.functions = temp;
+                copy->data.program.functions[copy->data.program.function_count++] =
+                    ast_clone(node->data.program.functions[i]);
+            }
+            for (int i = 0; i < node->data.program.global_count; i++) {
+                void *temp = realloc(copy->data.program.globals,
+                                     sizeof(ASTNode*) * (copy->data.program.global_count + 1));
+                if (!temp) break;
+                copy->data.program.globals = temp;
+                copy->data.program.globals[copy->data.program.global_count++] =
+                    ast_clone(node->data.program.globals[i]);
+            }
+            return copy;
+        }
+
+        case NODE_FUNCTION:
+        case NODE_EXTERN_FUNCTION: {
+            ASTNode *copy = ast_create_function(node->data.function.name,
+                                                node->data.function.params,
+                                                node->data.function.param_types,
+                                                node->data.function.param_count,
+                                                ast_clone(node->data.function.body));
+            if (copy) {
+                copy->type = node->type;
+                copy->data.function.return_type = node->data.function.return_type;
+            }
+            return copy;
+        }
+
+        case NODE_BLOCK: {
+            ASTNode *copy = ast_create_block();
+            if (!copy) return NULL;
+            int count = node->data.block.statement_count;
+            if (count > 0) {
+                copy->data.block.statements = malloc(sizeof(ASTNode*) * count);
+                if (!copy->data.block.statements) {
+                    ast_free(copy);
+                    return NULL;
+                }
+                for (int i = 0; i < count; i++) {
+                    copy->data.block.statements[i] = ast_clone(node->data.block.statements[i]);
+                }
+                copy->data.block.statement_count = count;
+            }
+            return copy;
+        }
+
+        case NODE_RETURN:
+            return ast_create_return(ast_clone(node->data.return_stmt.expression));
+
+        case NODE_IF:
+            return ast_create_if(ast_clone(node->data.if_stmt.condition),
+                                 ast_clone(node->data.if_stmt.then_branch),
+                                 ast_clone(node->data.if_stmt.else_branch));
+
+        case NODE_WHILE:
+            return ast_create_while(ast_clone(node->data.while_stmt.condition),
+                                    ast_clone(node->data.while_stmt.body));
+
+        case NODE_FOR:
+            return ast_create_for(ast_clone(node->data.for_stmt.init),
+                                  ast_clone(node->data.for_stmt.condition),
+                                  ast_clone(node->data.for_stmt.step),
+                                  ast_clone(node->data.for_stmt.body));
+
+        case NODE_BINARY_OP:
+            return ast_create_binary_op(node->data.binary_op.operator,
+                                        ast_clone(node->data.binary_op.left),
+                                        ast_clone(node->data.binary_op.right));
+
+        case NODE_UNARY_OP:
+            return ast_create_unary_op(node->data.unary_op.operator,
+                                       ast_clone(node->data.unary_op.operand));
+
+        case NODE_VARIABLE: {
+            ASTNode *copy = ast_create_variable(node->data.variable.name);
+            if (copy) {
+                copy->data.variable.is_global = node->data.variable.is_global;
+                copy->data.variable.length = node->data.variable.length;
+            }
+            return copy;
+        }
+
+        case NODE_NUMBER:
+            return ast_create_number(node->data.number.value);
+
+        case NODE_STRING:
+            return ast_create_string(node->data.string.value);
+
+        case NODE_CHAR:
+            return ast_create_char(node->data.char_literal.value);
+
+        case NODE_CALL: {
+            ASTNode **args = NULL;
+            int count = node->data.call.arg_count;
+            if (count > 0) {
+                args = malloc(sizeof(ASTNode*) * count);
+                if (!args) return NULL;
+                for (int i = 0; i < count; i++) {
+                    args[i] = ast_clone(node->data.call.args[i]);
+                }
+            }
+            ASTNode *copy = ast_create_call(node->data.call.name, args, count);
+            free(args);
+            return copy;
+        }
+
+        case NODE_INLINE:
+            return ast_create_inline(node->data.inline_call.name,
+                                     ast_clone(node->data.inline_call.body));
+
+        case NODE_SELECT:
+            return ast_create_select(ast_clone(node->data.select.condition),
+                                     ast_clone(node->data.select.if_true),
+                                     ast_clone(node->data.select.if_false));
+
+        case NODE_SWITCH:
+            return ast_create_switch(ast_clone(node->data.switch_stmt.value),
+                                     ast_clone(node->data.switch_stmt.body));
+
+        case NODE_CASE:
+            return ast_create_case(node->data.case_label.value,
+                                   node->data.case_label.is_default);
+
+        case NODE_GLOBAL: {
+            ASTNode *copy = ast_create_global(node->data.global.name, node->value_type,
+                                              ast_clone(node->data.global.init));
+            if (copy) copy->data.global.length = node->data.global.length;
+            return copy;
+        }
+
+        case NODE_INDEX:
+            return ast_create_index(ast_clone(node->data.index.array),
+                                    ast_clone(node->data.index.index));
+
+        case NODE_VECTOR:
+            return ast_create_vector(ast_clone(node->data.vector.loop),
+                                     ast_clone(node->data.vector.counter),
+                                     ast_clone(node->data.vector.limit),
+                                     ast_clone(node->data.vector.operation),
+                                     ast_clone(node->data.vector.check),
+                                     node->data.vector.lanes);
+
+        default:
+            return ast_create_node(node->type);
+    }
+}
+
+ASTNode *ast_clone(const ASTNode *node) {
+    if (!node) return NULL;
+
+    // Copies share the profile counters of the original
+    ASTNode *copy = clone_node(node);
+    if (copy) {
+        copy->profile_id = node->profile_id;
+        copy->value_type = node->value_type;
+    }
+    return copy;
+}
+
+bool ast_equal(const ASTNode *a, const ASTNode *b) {
+    if (!a || !b) return a == b;
+    if (a->type != b->type || a->value_type != b->value_type) return false;
+
+    switch (a->type) {
+        case NODE_NUMBER:
+            return a->data.number.value == b->data.number.value;
+        case NODE_VARIABLE:
+            return strcmp(a->data.variable.name, b->data.variable.name) == 0;
+        case NODE_STRING:
+            return strcmp(a->data.string.value, b->data.string.value) == 0;
+        case NODE_CHAR:
+            return a->data.char_literal.value == b->data.char_literal.value;
+        case NODE_BINARY_OP:
+            return a->data.binary_op.operator == b->data.binary_op.operator &&
+                   ast_equal(a->data.binary_op.left, b->data.binary_op.left) &&
+                   ast_equal(a->data.binary_op.right, b->data.binary_op.right);
+        case NODE_UNARY_OP:
+            return a->data.unary_op.operator == b->data.unary_op.operator &&
+                   ast_equal(a->data.unary_op.operand, b->data.unary_op.operand);
+        case NODE_CALL:
+            if (strcmp(a->data.call.name, b->data.call.name) != 0 ||
+                a->data.call.arg_count != b->data.call.arg_count) {
+                return false;
+            }
+            for (int i = 0; i < a->data.call.arg_count; i++) {
+                if (!ast_equal(a->data.call.args[i], b->data.call.args[i])) return false;
+            }
+            return true;
+        case NODE_SELECT:
+            return ast_equal(a->data.select.condition, b->data.select.condition) &&
+                   ast_equal(a->data.select.if_true, b->data.select.if_true) &&
+                   ast_equal(a->data.select.if_false, b->data.select.if_false);
+        case NODE_INDEX:
+            return ast_equal(a->data.index.array, b->data.index.array) &&
+                   ast_equal(a->data.index.index, b->data.index.index);
+        default:
+            // Statements are never considered equal
+            return false;
+    }
 }
\ No newline at end of file
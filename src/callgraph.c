@@ -0,0 +1,367 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <callgraph.h>
+
+// What the call sites along an edge say about its weight
+typedef struct {
+    double local;        // Calls per entry of the caller, from loop depth
+    long measured;       // Calls counted by the profile, or -1
+} EdgeEstimate;
+
+typedef struct {
+    CallGraph *graph;
+    const Profile *profile;
+    EdgeEstimate *estimates;   // Parallel to graph->edges
+    int caller;
+} Builder;
+
+bool callgraph_is_exported(const char *name, const char **exports, int export_count) {
+    if (strcmp(name, "main") == 0) return true;
+    for (int i = 0; i < export_count; i++) {
+        if (strcmp(exports[i], name) == 0) return true;
+    }
+    return false;
+}
+
+static int find_function(ASTNode *program, const char *name) {
+    for (int i = 0; i < program->data.program.function_count; i++) {
+        if (strcmp(program->data.program.functions[i]->data.function.name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static void add_call(Builder *builder, ASTNode *call, int loop_depth) {
+    CallGraph *graph = builder->graph;
+    int callee = find_function(graph->program, call->data.call.name);
+    if (callee < 0) return;
+
+    int e = 0;
+    while (e < graph->edge_count &&
+           (graph->edges[e].caller != builder->caller || graph->edges[e].callee != callee)) {
+        e++;
+    }
+    if (e == graph->edge_count) {
+        void *edges = realloc(graph->edges, sizeof(CallEdge) * (e + 1));
+        if (edges) graph->edges = edges;
+        void *estimates = realloc(builder->estimates, sizeof(EdgeEstimate) * (e + 1));
+        if (estimates) builder->estimates = estimates;
+        if (!edges || !estimates) return;
+
+        graph->edges[e] = (CallEdge){builder->caller, callee, 0};
+        builder->estimates[e] = (EdgeEstimate){0, -1};
+        graph->edge_count++;
+    }
+
+    if (loop_depth > CALLGRAPH_MAX_LOOP_DEPTH) loop_depth = CALLGRAPH_MAX_LOOP_DEPTH;
+    double local = 1;
+    for (int d = 0; d < loop_depth; d++) local *= CALLGRAPH_LOOP_WEIGHT;
+    builder->estimates[e].local += local;
+
+    long count = profile_count(builder->profile, call, 0);
+    if (count >= 0) {
+        EdgeEstimate *estimate = &builder->estimates[e];
+        estimate->measured = (estimate->measured < 0 ? 0 : estimate->measured) + count;
+    }
+}
+
+static void scan(Builder *builder, ASTNode *node, int loop_depth) {
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                scan(builder, node->data.block.statements[i], loop_depth);
+            }
+            break;
+        case NODE_RETURN:
+            scan(builder, node->data.return_stmt.expression, loop_depth);
+            break;
+        case NODE_IF:
+            scan(builder, node->data.if_stmt.condition, loop_depth);
+            scan(builder, node->data.if_stmt.then_branch, loop_depth);
+            scan(builder, node->data.if_stmt.else_branch, loop_depth);
+            break;
+        case NODE_WHILE:
+            scan(builder, node->data.while_stmt.condition, loop_depth + 1);
+            scan(builder, node->data.while_stmt.body, loop_depth + 1);
+            break;
+        case NODE_FOR:
+            scan(builder, node->data.for_stmt.init, loop_depth);
+            scan(builder, node->data.for_stmt.condition, loop_depth + 1);
+            scan(builder, node->data.for_stmt.step, loop_depth + 1);
+            scan(builder, node->data.for_stmt.body, loop_depth + 1);
+            break;
+        case NODE_BINARY_OP:
+            scan(builder, node->data.binary_op.left, loop_depth);
+            scan(builder, node->data.binary_op.right, loop_depth);
+            break;
+        case NODE_UNARY_OP:
+            scan(builder, node->data.unary_op.operand, loop_depth);
+            break;
+        case NODE_INDEX:
+            scan(builder, node->data.index.index, loop_depth);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                scan(builder, node->data.call.args[i], loop_depth);
+            }
+            add_call(builder, node, loop_depth);
+            break;
+        case NODE_INLINE:
+            scan(builder, node->data.inline_call.body, loop_depth);
+            break;
+        case NODE_SELECT:
+            scan(builder, node->data.select.condition, loop_depth);
+            scan(builder, node->data.select.if_true, loop_depth);
+            scan(builder, node->data.select.if_false, loop_depth);
+            break;
+        case NODE_SWITCH:
+            scan(builder, node->data.switch_stmt.value, loop_depth);
+            scan(builder, node->data.switch_stmt.body, loop_depth);
+            break;
+        default:
+            break;
+    }
+}
+
+// Depth-first from f, appending each function after its callees
+static void visit(CallGraph *graph, int f, int *postorder, int *count) {
+    graph->reachable[f] = true;
+    for (int e = 0; e < graph->edge_count; e++) {
+        if (graph->edges[e].caller == f && !graph->reachable[graph->edges[e].callee]) {
+            visit(graph, graph->edges[e].callee, postorder, count);
+        }
+    }
+    postorder[(*count)++] = f;
+}
+
+// Push frequencies from the roots down the graph in reverse postorder,
+// so each function has all its callers' calls before its own are
+// weighed. Calls back up a recursive cycle do not feed the estimate.
+static void estimate_frequencies(CallGraph *graph, Builder *builder, const int *postorder, int count) {
+    int *position = malloc(sizeof(int) * (graph->count + 1));
+    if (!position) return;
+    for (int i = 0; i < count; i++) position[postorder[i]] = count - 1 - i;
+
+    for (int f = 0; f < graph->count; f++) {
+        long entries = profile_count(builder->profile, graph->program->data.program.functions[f], 0);
+        graph->frequency[f] = entries >= 0 ? entries : graph->root[f] ? 1 : 0;
+    }
+
+    for (int i = count - 1; i >= 0; i--) {
+        int f = postorder[i];
+        for (int e = 0; e < graph->edge_count; e++) {
+            CallEdge *edge = &graph->edges[e];
+            if (edge->caller != f) continue;
+
+            EdgeEstimate *estimate = &builder->estimates[e];
+            edge->weight = estimate->measured >= 0 ? estimate->measured
+                                                   : graph->frequency[f] * estimate->local;
+            ASTNode *callee = graph->program->data.program.functions[edge->callee];
+            bool measured = profile_count(builder->profile, callee, 0) >= 0;
+            if (!measured && position[edge->callee] > position[f]) {
+                graph->frequency[edge->callee] += edge->weight;
+            }
+        }
+    }
+    free(position);
+}
+
+CallGraph *callgraph_build(ASTNode *program, const char **exports, int export_count,
+                           const Profile *profile) {
+    CallGraph *graph = calloc(1, sizeof(CallGraph));
+    if (!graph) return NULL;
+
+    int count = program->data.program.function_count;
+    graph->program = program;
+    graph->count = count;
+    graph->frequency = calloc(count + 1, sizeof(double));
+    graph->root = calloc(count + 1, sizeof(bool));
+    graph->reachable = calloc(count + 1, sizeof(bool));
+    int *postorder = malloc(sizeof(int) * (count + 1));
+    Builder builder = {graph, profile, NULL, 0};
+
+    if (!graph->frequency || !graph->root || !graph->reachable || !postorder) {
+        free(postorder);
+        callgraph_free(graph);
+        return NULL;
+    }
+
+    for (int f = 0; f < count; f++) {
+        ASTNode *function = program->data.program.functions[f];
+        if (function->type != NODE_FUNCTION) continue;
+        graph->root[f] = callgraph_is_exported(function->data.function.name, exports, export_count);
+        builder.caller = f;
+        scan(&builder, function->data.function.body, 0);
+    }
+
+    int reached = 0;
+    for (int f = 0; f < count; f++) {
+        if (graph->root[f] && !graph->reachable[f]) visit(graph, f, postorder, &reached);
+    }
+    estimate_frequencies(graph, &builder, postorder, reached);
+
+    free(builder.estimates);
+    free(postorder);
+    return graph;
+}
+
+void callgraph_free(CallGraph *graph) {
+    if (!graph) return;
+    free(graph->edges);
+    free(graph->frequency);
+    free(graph->root);
+    free(graph->reachable);
+    free(graph);
+}
+
+int callgraph_remove_unreachable(CallGraph *graph) {
+    ASTNode *program = graph->program;
+    int kept = 0;
+    int removed = 0;
+
+    for (int f = 0; f < graph->count; f++) {
+        ASTNode *function = program->data.program.functions[f];
+        if (function->type == NODE_FUNCTION && !graph->reachable[f]) {
+            ast_free(function);
+            removed++;
+        } else {
+            program->data.program.functions[kept++] = function;
+        }
+    }
+    program->data.program.function_count = kept;
+    return removed;
+}
+
+bool callgraph_order(CallGraph *graph, const int *sizes) {
+    int n = graph->count;
+    int *cluster = malloc(sizeof(int) * (n + 1));   // Head of the cluster holding each function
+    int *next = malloc(sizeof(int) * (n + 1));      // Following function in the cluster
+    int *tail = malloc(sizeof(int) * (n + 1));
+    long *size = malloc(sizeof(long) * (n + 1));
+    int *sorted = malloc(sizeof(int) * (n + 1));
+    int *order = malloc(sizeof(int) * (n + 1));
+    double *density = malloc(sizeof(double) * (n + 1));
+    ASTNode **functions = malloc(sizeof(ASTNode *) * (n + 1));
+    bool changed = false;
+
+    if (!cluster || !next || !tail || !size || !sorted || !order || !density || !functions) goto done;
+
+    ASTNode *program = graph->program;
+    int hot_count = 0;
+    for (int f = 0; f < n; f++) {
+        cluster[f] = tail[f] = f;
+        next[f] = -1;
+        size[f] = sizes && sizes[f] > 0 ? sizes[f] : 1;
+        if (program->data.program.functions[f]->type == NODE_FUNCTION && graph->reachable[f]) {
+            sorted[hot_count++] = f;
+        }
+    }
+
+    // Hottest first; insertion sort keeps equal frequencies in source order
+    for (int i = 1; i < hot_count; i++) {
+        int f = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && graph->frequency[sorted[j]] < graph->frequency[f]) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = f;
+    }
+
+    for (int i = 0; i < hot_count; i++) {
+        int f = sorted[i];
+        int caller = -1;
+        double best = 0;
+        for (int e = 0; e < graph->edge_count; e++) {
+            CallEdge *edge = &graph->edges[e];
+            if (edge->callee == f && edge->caller != f && edge->weight > best) {
+                caller = edge->caller;
+                best = edge->weight;
+            }
+        }
+        if (caller < 0) continue;
+
+        int a = cluster[caller];
+        int b = cluster[f];
+        if (a == b || size[a] + size[b] > CALLGRAPH_CLUSTER_SIZE) continue;
+        next[tail[a]] = b;
+        tail[a] = tail[b];
+        for (int g = b; g >= 0; g = next[g]) cluster[g] = a;
+        size[a] += size[b];
+    }
+
+    // Clusters densest first: the most calls per node of code
+    int cluster_count = 0;
+    for (int i = 0; i < hot_count; i++) {
+        if (cluster[sorted[i]] == sorted[i]) sorted[cluster_count++] = sorted[i];
+    }
+    for (int c = 0; c < cluster_count; c++) {
+        int head = sorted[c];
+        density[head] = 0;
+        for (int g = head; g >= 0; g = next[g]) density[head] += graph->frequency[g];
+        density[head] /= size[head];
+    }
+    for (int i = 1; i < cluster_count; i++) {
+        int head = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && density[sorted[j]] < density[head]) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = head;
+    }
+
+    // Declarations, then the clusters, then whatever nothing calls
+    int count = 0;
+    for (int f = 0; f < n; f++) {
+        if (program->data.program.functions[f]->type != NODE_FUNCTION) order[count++] = f;
+    }
+    for (int c = 0; c < cluster_count; c++) {
+        for (int g = sorted[c]; g >= 0; g = next[g]) order[count++] = g;
+    }
+    for (int f = 0; f < n; f++) {
+        if (program->data.program.functions[f]->type == NODE_FUNCTION && !graph->reachable[f]) {
+            order[count++] = f;
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        functions[i] = program->data.program.functions[order[i]];
+        if (order[i] != i) changed = true;
+    }
+    memcpy(program->data.program.functions, functions, sizeof(ASTNode *) * n);
+
+done:
+    free(cluster);
+    free(next);
+    free(tail);
+    free(size);
+    free(sorted);
+    free(order);
+    free(density);
+    free(functions);
+    return changed;
+}
+
+void callgraph_dump(const CallGraph *graph, FILE *output) {
+    ASTNode **functions = graph->program->data.program.functions;
+
+    fprintf(output, "===-------------------------------------------------------===\n");
+    fprintf(output, "                         Call graph\n");
+    fprintf(output, "===-------------------------------------------------------===\n");
+    fprintf(output, "  %-24s %-12s %16s\n", "Function", "", "Entries/Calls");
+    for (int f = 0; f < graph->count; f++) {
+        const char *status = functions[f]->type != NODE_FUNCTION ? "extern"
+                           : graph->root[f] ? "root"
+                           : graph->reachable[f] ? "" : "unreachable";
+        fprintf(output, "  %-24s %-12s %16.0f\n", functions[f]->data.function.name, status,
+                graph->frequency[f]);
+        for (int e = 0; e < graph->edge_count; e++) {
+            if (graph->edges[e].caller != f) continue;
+            fprintf(output, "    -> %-33s %16.0f\n",
+                    functions[graph->edges[e].callee]->data.function.name, graph->edges[e].weight);
+        }
+    }
+}
\ No newline at end of file
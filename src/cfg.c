@@ -0,0 +1,286 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <cfg.h>
+
+static int compare_labels(const void *a, const void *b) {
+    return strcmp(((const CfgLabel *)a)->name, ((const CfgLabel *)b)->name);
+}
+
+static bool add_block(Cfg *cfg, int start, int end, int terminator, const char *label,
+                      long count) {
+    void *temp = realloc(cfg->blocks, sizeof(BasicBlock) * (cfg->count + 1));
+    if (!temp) return false;
+    cfg->blocks = temp;
+
+    BasicBlock *block = &cfg->blocks[cfg->count++];
+    memset(block, 0, sizeof(BasicBlock));
+    block->start = start;
+    block->end = end;
+    block->terminator = terminator;
+    block->label = label;
+    block->count = count;
+    block->succ[CFG_FALLTHROUGH] = -1;
+    block->succ[CFG_TARGET] = -1;
+    return true;
+}
+
+static bool add_label(Cfg *cfg, const char *name) {
+    void *temp = realloc(cfg->labels, sizeof(CfgLabel) * (cfg->label_count + 1));
+    if (!temp) return false;
+    cfg->labels = temp;
+    cfg->labels[cfg->label_count++] = (CfgLabel){name, cfg->count};
+    return true;
+}
+
+// Record a target of the indirect jump ending the block being built
+static bool add_table_edge(Cfg *cfg, const char *label) {
+    void *temp = realloc(cfg->table_edges, sizeof(CfgTableEdge) * (cfg->table_edge_count + 1));
+    if (!temp) return false;
+    cfg->table_edges = temp;
+
+    char *name = strdup(label);
+    if (!name) return false;
+    cfg->table_edges[cfg->table_edge_count++] = (CfgTableEdge){cfg->count, name, -1};
+    return true;
+}
+
+static bool is_alignment(const Insn *insn) {
+    return strncmp(insn->text, "\t.p2align", 9) == 0 || strncmp(insn->text, "\t.align", 7) == 0;
+}
+
+// Split the code into blocks. A block starts at a label, or at the
+// alignment directives in front of one, and ends after a jump or ret.
+static bool split_blocks(Cfg *cfg) {
+    InsnList *code = cfg->code;
+    int start = 0;
+    int aligned = -1;         // First alignment after the last instruction
+    bool has_ops = false;
+    const char *label = NULL;
+    long count = -1;
+
+    for (int i = 0; i < code->count; i++) {
+        Insn *insn = &code->items[i];
+
+        switch (insn->kind) {
+            case INSN_LABEL:
+                if (has_ops) {
+                    int end = aligned >= 0 ? aligned : i;
+                    if (!add_block(cfg, start, end, -1, label, count)) return false;
+                    start = end;
+                    has_ops = false;
+                    label = NULL;
+                    count = -1;
+                }
+                aligned = -1;
+                if (!label) label = insn->label;
+                if (!add_label(cfg, insn->label)) return false;
+                break;
+
+            case INSN_DIRECTIVE: {
+                long measured;
+                char target[128];
+                if (sscanf(insn->text, INSN_COUNT_FORMAT, &measured) == 1) {
+                    count = measured;
+                } else if (sscanf(insn->text, INSN_TABLE_TARGET_FORMAT, target) == 1) {
+                    if (!add_table_edge(cfg, target)) return false;
+                } else if (has_ops && aligned < 0 && is_alignment(insn)) {
+                    aligned = i;
+                }
+                break;
+            }
+
+            case INSN_OP:
+                aligned = -1;
+                has_ops = true;
+                if (insn_is_jump(insn) || insn_is_op(insn, "ret")) {
+                    if (!add_block(cfg, start, i + 1, i, label, count)) return false;
+                    start = i + 1;
+                    has_ops = false;
+                    label = NULL;
+                    count = -1;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (start < code->count && !add_block(cfg, start, code->count, -1, label, count)) {
+        return false;
+    }
+    return true;
+}
+
+int cfg_find_label(Cfg *cfg, const char *label) {
+    if (!cfg->labels) return -1;
+    CfgLabel key = {label, 0};
+    CfgLabel *found = bsearch(&key, cfg->labels, cfg->label_count,
+                              sizeof(CfgLabel), compare_labels);
+    return found ? found->block : -1;
+}
+
+bool cfg_has_table_edges(Cfg *cfg, int block) {
+    for (int i = 0; i < cfg->table_edge_count; i++) {
+        if (cfg->table_edges[i].source == block) return true;
+    }
+    return false;
+}
+
+static void connect_blocks(Cfg *cfg) {
+    for (int i = 0; i < cfg->table_edge_count; i++) {
+        cfg->table_edges[i].target = cfg_find_label(cfg, cfg->table_edges[i].label);
+    }
+
+    // The epilogue is the block labeled .<function>_return
+    cfg->epilogue = -1;
+    if (cfg->count > 0 && cfg->blocks[0].label) {
+        char name[128];
+        snprintf(name, sizeof(name), ".%s_return", cfg->blocks[0].label);
+        cfg->epilogue = cfg_find_label(cfg, name);
+    }
+
+    for (int b = 0; b < cfg->count; b++) {
+        BasicBlock *block = &cfg->blocks[b];
+        int next = b + 1 < cfg->count ? b + 1 : -1;
+
+        if (block->terminator < 0) {
+            block->succ[CFG_FALLTHROUGH] = next;
+            continue;
+        }
+
+        Insn *insn = &cfg->code->items[block->terminator];
+        if (insn_is_op(insn, "ret")) {
+            block->exits = true;
+            continue;
+        }
+
+        const char *target = insn_jump_target(insn);
+        int succ = target ? cfg_find_label(cfg, target) : -1;
+        block->succ[CFG_TARGET] = succ;
+        if (insn_is_cond_jump(insn)) {
+            block->succ[CFG_FALLTHROUGH] = next;
+        } else if (!target && cfg_has_table_edges(cfg, b)) {
+            // Jump through a table, whose targets are listed separately
+        } else if (succ < 0 || succ == cfg->epilogue) {
+            // Tail call, or a return statement
+            block->exits = true;
+        }
+    }
+
+    // Code is emitted in source order, so a loop is the range of blocks
+    // between the target of a back edge and its source
+    for (int b = 0; b < cfg->count; b++) {
+        int target = cfg->blocks[b].succ[CFG_TARGET];
+        if (target < 0 || target > b) continue;
+        for (int k = target; k <= b; k++) cfg->blocks[k].loop_depth++;
+    }
+}
+
+Cfg *cfg_build(InsnList *code) {
+    Cfg *cfg = calloc(1, sizeof(Cfg));
+    if (!cfg) return NULL;
+
+    cfg->code = code;
+    if (!split_blocks(cfg)) {
+        cfg_free(cfg);
+        return NULL;
+    }
+    qsort(cfg->labels, cfg->label_count, sizeof(CfgLabel), compare_labels);
+    connect_blocks(cfg);
+    return cfg;
+}
+
+void cfg_free(Cfg *cfg) {
+    if (cfg) {
+        for (int i = 0; i < cfg->table_edge_count; i++) {
+            free((char *)cfg->table_edges[i].label);
+        }
+        free(cfg->table_edges);
+        free(cfg->blocks);
+        free(cfg->labels);
+        free(cfg);
+    }
+}
+
+// Probability that the conditional jump ending a block is taken
+static double taken_probability(Cfg *cfg, int b) {
+    BasicBlock *block = &cfg->blocks[b];
+    int taken = block->succ[CFG_TARGET];
+    int fallthrough = block->succ[CFG_FALLTHROUGH];
+    BasicBlock *t = &cfg->blocks[taken];
+    BasicBlock *f = &cfg->blocks[fallthrough];
+
+    // Both sides of an if record how often they ran
+    if (t->count >= 0 && f->count >= 0 && t->count + f->count > 0 && taken > b) {
+        return (double)t->count / (double)(t->count + f->count);
+    }
+
+    if (taken <= b) return CFG_BACK_EDGE_PROB;
+    if (f->loop_depth > block->loop_depth) return 1.0 - CFG_LOOP_ENTRY_PROB;
+    if (t->loop_depth > block->loop_depth) return CFG_LOOP_ENTRY_PROB;
+    if (t->exits && !f->exits) return CFG_EXIT_PROB;
+    if (f->exits && !t->exits) return 1.0 - CFG_EXIT_PROB;
+    return 0.5;
+}
+
+// Propagate frequencies forward in emission order, where every edge that
+// goes backwards is a loop back edge: a block runs as often as its forward
+// predecessors reach it, times the expected trip count if it heads a loop
+void cfg_estimate(Cfg *cfg) {
+    double *incoming = calloc(cfg->count, sizeof(double));
+    bool *header = calloc(cfg->count, sizeof(bool));
+    if (!incoming || !header) {
+        free(incoming);
+        free(header);
+        return;
+    }
+
+    for (int b = 0; b < cfg->count; b++) {
+        int target = cfg->blocks[b].succ[CFG_TARGET];
+        if (target >= 0 && target <= b) header[target] = true;
+    }
+    if (cfg->count > 0) incoming[0] = 1.0;
+
+    for (int b = 0; b < cfg->count; b++) {
+        BasicBlock *block = &cfg->blocks[b];
+        if (block->count >= 0) {
+            block->frequency = block->count;
+        } else {
+            block->frequency = incoming[b] * (header[b] ? CFG_LOOP_SCALE : 1.0);
+        }
+
+        block->weight[CFG_FALLTHROUGH] = 0;
+        block->weight[CFG_TARGET] = 0;
+        if (block->succ[CFG_FALLTHROUGH] >= 0 && block->succ[CFG_TARGET] >= 0) {
+            double p = taken_probability(cfg, b);
+            block->weight[CFG_TARGET] = block->frequency * p;
+            block->weight[CFG_FALLTHROUGH] = block->frequency * (1.0 - p);
+        } else if (block->succ[CFG_FALLTHROUGH] >= 0) {
+            block->weight[CFG_FALLTHROUGH] = block->frequency;
+        } else if (block->succ[CFG_TARGET] >= 0) {
+            block->weight[CFG_TARGET] = block->frequency;
+        }
+
+        for (int kind = CFG_FALLTHROUGH; kind <= CFG_TARGET; kind++) {
+            int succ = block->succ[kind];
+            if (succ > b) incoming[succ] += block->weight[kind];
+        }
+
+        // Without a profile, every entry of a jump table is equally likely
+        int entries = 0;
+        for (int i = 0; i < cfg->table_edge_count; i++) {
+            if (cfg->table_edges[i].source == b) entries++;
+        }
+        for (int i = 0; entries && i < cfg->table_edge_count; i++) {
+            CfgTableEdge *edge = &cfg->table_edges[i];
+            if (edge->source == b && edge->target > b) {
+                incoming[edge->target] += block->frequency / entries;
+            }
+        }
+    }
+
+    free(incoming);
+    free(header);
+}
\ No newline at end of file
@@ -2,72 +2,387 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include <assembler.h>
 #include <codegen.h>
+#include <object.h>
+#include <switch.h>
+#include <callgraph.h>
+#include <isel.h>
+#include <vectorize.h>
 
 static const char *arg_registers[] = {
     "%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9"
 };
 static const int MAX_ARGS_IN_REGISTERS = 6;
 
-CodeGenerator *codegen_create(const char *output_file) {
+CodeGenerator *codegen_create(const char *output_file, EmitFormat emit) {
     CodeGenerator *gen = malloc(sizeof(CodeGenerator));
     if (!gen) return NULL;
 
-    gen->output = fopen(output_file, "w");
-    if (!gen->output) {
+    gen->output = NULL;
+    if (emit != EMIT_MEMORY) gen->output = output_open(output_file, emit == EMIT_EXECUTABLE ? 0777 : 0666);
+    if (emit != EMIT_MEMORY && !gen->output) {
         free(gen);
         return NULL;
     }
 
+    gen->insns = insn_list_create();
+    gen->rodata = insn_list_create();
+    if (!gen->insns || !gen->rodata) {
+        insn_list_free(gen->insns);
+        insn_list_free(gen->rodata);
+        output_close(gen->output);
+        free(gen);
+        return NULL;
+    }
+
+    gen->emit = emit;
+    gen->failed = false;
     gen->label_count = 0;
+    gen->strings = NULL;
+    gen->string_count = 0;
+    gen->function = NULL;
+    gen->locals = NULL;
+    gen->local_count = 0;
+    gen->frame_size = 0;
+    gen->push_depth = 0;
+    gen->inline_return_label = -1;
+    gen->break_label = -1;
+    gen->tail_calls = true;
+    gen->align_loops = true;
+    gen->target = (Target){TARGET_X86_64, 0};
+    gen->exports = NULL;
+    gen->export_count = 0;
+    gen->profile_counters = false;
+    gen->profile_counts = NULL;
     return gen;
 }
 
-void codegen_free(CodeGenerator *gen) {
+static void codegen_clear_locals(CodeGenerator *gen) {
+    for (int i = 0; i < gen->local_count; i++) {
+        free(gen->locals[i].name);
+    }
+    free(gen->locals);
+    gen->locals = NULL;
+    gen->local_count = 0;
+    gen->frame_size = 0;
+}
+
+LocalVariable *codegen_find_local(CodeGenerator *gen, const char *name) {
+    for (int i = 0; i < gen->local_count; i++) {
+        if (strcmp(gen->locals[i].name, name) == 0) return &gen->locals[i];
+    }
+    return NULL;
+}
+
+// Record a variable at the given %rbp offset; 0 means the next free slot,
+// packed below the others at the natural alignment of its type. Arrays of
+// length elements are aligned to 16 bytes for vector loads and stores.
+static void codegen_add_local(CodeGenerator *gen, const char *name, TypeKind type, int length, int offset) {
+    if (codegen_find_local(gen, name)) return;
+
+    void *temp = realloc(gen->locals, sizeof(LocalVariable) * (gen->local_count + 1));
+    if (!temp) return;
+    gen->locals = temp;
+
+    if (offset == 0) {
+        int size = type_size(type);
+        int align = length ? 16 : size;
+        if (length) size *= length;
+        gen->frame_size = (gen->frame_size + size + align - 1) / align * align;
+        offset = -gen->frame_size;
+    }
+    gen->locals[gen->local_count].name = strdup(name);
+    gen->locals[gen->local_count].type = type;
+    gen->locals[gen->local_count].offset = offset;
+    gen->local_count++;
+}
+
+// Give every variable referenced in a function body its own stack slot
+static void codegen_collect_locals(CodeGenerator *gen, ASTNode *node) {
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                codegen_collect_locals(gen, node->data.block.statements[i]);
+            }
+            break;
+        case NODE_RETURN:
+            codegen_collect_locals(gen, node->data.return_stmt.expression);
+            break;
+        case NODE_IF:
+            codegen_collect_locals(gen, node->data.if_stmt.condition);
+            codegen_collect_locals(gen, node->data.if_stmt.then_branch);
+            codegen_collect_locals(gen, node->data.if_stmt.else_branch);
+            break;
+        case NODE_WHILE:
+            codegen_collect_locals(gen, node->data.while_stmt.condition);
+            codegen_collect_locals(gen, node->data.while_stmt.body);
+            break;
+        case NODE_FOR:
+            codegen_collect_locals(gen, node->data.for_stmt.init);
+            codegen_collect_locals(gen, node->data.for_stmt.condition);
+            codegen_collect_locals(gen, node->data.for_stmt.step);
+            codegen_collect_locals(gen, node->data.for_stmt.body);
+            break;
+        case NODE_BINARY_OP:
+            codegen_collect_locals(gen, node->data.binary_op.left);
+            codegen_collect_locals(gen, node->data.binary_op.right);
+            break;
+        case NODE_UNARY_OP:
+            codegen_collect_locals(gen, node->data.unary_op.operand);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                codegen_collect_locals(gen, node->data.call.args[i]);
+            }
+            break;
+        case NODE_INLINE:
+            codegen_collect_locals(gen, node->data.inline_call.body);
+            break;
+        case NODE_SELECT:
+            codegen_collect_locals(gen, node->data.select.condition);
+            codegen_collect_locals(gen, node->data.select.if_true);
+            codegen_collect_locals(gen, node->data.select.if_false);
+            break;
+        case NODE_SWITCH:
+            codegen_collect_locals(gen, node->data.switch_stmt.value);
+            codegen_collect_locals(gen, node->data.switch_stmt.body);
+            break;
+        case NODE_VARIABLE:
+            if (!node->data.variable.is_global) {
+                codegen_add_local(gen, node->data.variable.name, node->value_type,
+                                  node->data.variable.length, 0);
+            }
+            break;
+        case NODE_INDEX:
+            codegen_collect_locals(gen, node->data.index.array);
+            codegen_collect_locals(gen, node->data.index.index);
+            break;
+        case NODE_VECTOR:
+            codegen_collect_locals(gen, node->data.vector.loop);
+            break;
+        default:
+            break;
+    }
+}
+
+int codegen_intern_string(CodeGenerator *gen, const char *value) {
+    for (int i = 0; i < gen->string_count; i++) {
+        if (strcmp(gen->strings[i], value) == 0) return i;
+    }
+
+    char *copy = strdup(value);
+    void *temp = copy ? realloc(gen->strings, sizeof(char *) * (gen->string_count + 1)) : NULL;
+    if (!temp) {
+        free(copy);
+        return 0;
+    }
+    gen->strings = temp;
+    gen->strings[gen->string_count] = copy;
+    return gen->string_count++;
+}
+
+void codegen_memory_operand(CodeGenerator *gen, const ASTNode *node, char *out, size_t size) {
+    if (node->type == NODE_INDEX) node = node->data.index.array;
+    if (node->type == NODE_STRING) {
+        snprintf(out, size, ".LC%d(%%rip)", codegen_intern_string(gen, node->data.string.value));
+    } else if (node->data.variable.is_global) {
+        snprintf(out, size, "%s(%%rip)", node->data.variable.name);
+    } else {
+        LocalVariable *var = codegen_find_local(gen, node->data.variable.name);
+        snprintf(out, size, "%d(%%rbp)", var->offset);
+    }
+}
+
+bool codegen_free(CodeGenerator *gen) {
+    bool written = true;
     if (gen) {
-        if (gen->output) fclose(gen->output);
+        written = output_close(gen->output) && !gen->failed;
+        insn_list_free(gen->insns);
+        insn_list_free(gen->rodata);
+        codegen_clear_locals(gen);
+        for (int i = 0; i < gen->string_count; i++) free(gen->strings[i]);
+        free(gen->strings);
         free(gen);
     }
+    return written;
 }
 
 void codegen_emit(CodeGenerator *gen, const char *format, ...) {
+    char line[640];
     va_list args;
     va_start(args, format);
-    vfprintf(gen->output, format, args);
+    output_vformat(line, line + sizeof(line), format, args);
     va_end(args);
-    fprintf(gen->output, "\n");
+    insn_list_append(gen->insns, line);
 }
 
-char *codegen_new_label(CodeGenerator *gen) {
-    char label[32];
-    snprintf(label, sizeof(label), ".L%d", gen->label_count++);
-    return strdup(label);
+void codegen_emit_line(CodeGenerator *gen, const char *line) {
+    insn_list_append(gen->insns, line);
 }
 
-void codegen_generate(CodeGenerator *gen, ASTNode *ast) {
-    // Data section
-    codegen_emit(gen, "\t.section .data");
-    
-    // BSS section
-    codegen_emit(gen, "\t.section .bss");
+int codegen_new_label(CodeGenerator *gen) {
+    return gen->label_count++;
+}
 
-    // Text section
-    codegen_emit(gen, "\t.section .text");
-    
-    // Generate all function declarations first
-    for (int i = 0; i < ast->data.program.function_count; i++) {
-        codegen_emit(gen, "\t.global %s", 
-            ast->data.program.functions[i]->data.function.name);
-        codegen_emit(gen, "\t.type %s, @function", 
-            ast->data.program.functions[i]->data.function.name);
+void codegen_emit_label(CodeGenerator *gen, int label) {
+    char line[32];
+    output_char(output_label(line, line + sizeof(line), label), line + sizeof(line), ':');
+    insn_list_append(gen->insns, line);
+}
+
+void codegen_emit_jump(CodeGenerator *gen, const char *mnemonic, int label) {
+    char line[32];
+    char *end = line + sizeof(line);
+    char *p = output_char(line, end, '\t');
+    p = output_char(output_text(p, end, mnemonic), end, ' ');
+    output_label(p, end, label);
+    insn_list_append(gen->insns, line);
+}
+
+// Count an execution of one of a node's profile counters, or record the
+// count measured for it. incq clobbers the flags, so this is only used
+// where they are dead.
+static void codegen_count(CodeGenerator *gen, const ASTNode *node, int counter) {
+    if (!node->profile_id) return;
+
+    int index = node->profile_id - 1 + counter;
+    if (gen->profile_counters) {
+        codegen_emit(gen, "\tincq __profile_counters+%d(%%rip)", index * 8);
+    } else if (gen->profile_counts && gen->profile_counts[index] >= 0) {
+        codegen_emit(gen, INSN_COUNT_FORMAT, gen->profile_counts[index]);
     }
+}
+
+void codegen_generate(CodeGenerator *gen, ASTNode *ast) {
+    codegen_program(gen, ast);
 
     // Generate the actual functions
     for (int i = 0; i < ast->data.program.function_count; i++) {
         codegen_function(gen, ast->data.program.functions[i]);
+        codegen_emit_rodata(gen);
     }
 
-    // Entry point last
+    codegen_entry_point(gen);
+    codegen_emit_strings(gen);
+    codegen_flush(gen);
+}
+
+// Move the jump tables of the function just generated into .rodata,
+// returning to whichever text section the function is in
+void codegen_emit_rodata(CodeGenerator *gen) {
+    if (gen->rodata->count == 0) return;
+
+    codegen_emit(gen, "\t.pushsection .rodata");
+    insn_list_splice(gen->insns, gen->rodata);
+    codegen_emit(gen, "\t.popsection");
+}
+
+// String literals go in a section of null-terminated strings of 1-byte
+// characters (flags M and S, entity size 1) that the linker merges, so each
+// string is stored once however many object files use it
+void codegen_emit_strings(CodeGenerator *gen) {
+    if (gen->string_count == 0) return;
+
+    codegen_emit(gen, "\t.section .rodata.str1.1,\"aMS\",@progbits,1");
+    for (int i = 0; i < gen->string_count; i++) {
+        const char *value = gen->strings[i];
+        char *line = malloc(strlen(value) * 4 + 16);
+        if (!line) return;
+
+        codegen_emit(gen, ".LC%d:", i);
+        char *out = line + sprintf(line, "\t.string \"");
+        for (const unsigned char *c = (const unsigned char *)value; *c; c++) {
+            if (*c == '"' || *c == '\\') {
+                out += sprintf(out, "\\%c", *c);
+            } else if (*c >= ' ' && *c < 127) {
+                *out++ = *c;
+            } else {
+                out += sprintf(out, "\\%03o", *c);
+            }
+        }
+        strcpy(out, "\"");
+        insn_list_append(gen->insns, line);
+        free(line);
+    }
+    codegen_emit(gen, "\t.section .text");
+}
+
+// A global's symbol, with its initial value or, in .bss, room for it.
+// Arrays are aligned to 32 bytes, the width of the widest vector.
+static void codegen_global(CodeGenerator *gen, ASTNode *global) {
+    static const char *directives[] = {NULL, ".byte", ".short", NULL, ".long", NULL, NULL, NULL, ".quad"};
+    const char *name = global->data.global.name;
+    ASTNode *init = global->data.global.init;
+    int size = type_size(global->value_type);
+    int length = global->data.global.length;
+
+    if (callgraph_is_exported(name, gen->exports, gen->export_count)) {
+        codegen_emit(gen, "\t.global %s", name);
+    }
+    codegen_emit(gen, "\t.type %s, @object", name);
+    if (length) {
+        codegen_emit(gen, "\t.size %s, %d", name, size * length);
+        codegen_emit(gen, "\t.p2align 5");
+        codegen_emit(gen, "%s:", name);
+        codegen_emit(gen, "\t.zero %d", size * length);
+        return;
+    }
+    codegen_emit(gen, "\t.size %s, %d", name, size);
+    codegen_emit(gen, "\t.p2align %d", size == 8 ? 3 : size / 2);
+    codegen_emit(gen, "%s:", name);
+    if (!init) {
+        codegen_emit(gen, "\t.zero %d", size);
+    } else if (init->type == NODE_STRING) {
+        codegen_emit(gen, "\t.quad .LC%d", codegen_intern_string(gen, init->data.string.value));
+    } else {
+        codegen_emit(gen, "\t%s %ld", directives[size], init->data.number.value);
+    }
+}
+
+static bool is_zero_initialized(const ASTNode *global) {
+    const ASTNode *init = global->data.global.init;
+    return !init || (init->type == NODE_NUMBER && init->data.number.value == 0);
+}
+
+void codegen_program(CodeGenerator *gen, ASTNode *node) {
+    // Initialized globals in .data, the rest in .bss, which takes no room
+    // in the file
+    for (int pass = 0; pass < 2; pass++) {
+        bool bss = pass == 1;
+        bool started = false;
+        for (int i = 0; i < node->data.program.global_count; i++) {
+            ASTNode *global = node->data.program.globals[i];
+            if (is_zero_initialized(global) != bss) continue;
+            if (!started) codegen_emit(gen, bss ? "\t.section .bss" : "\t.section .data");
+            started = true;
+            if (bss && global->data.global.init) {
+                // Zero stored as .zero, like no initializer
+                ast_free(global->data.global.init);
+                global->data.global.init = NULL;
+            }
+            codegen_global(gen, global);
+        }
+    }
+
+    // Text section
+    codegen_emit(gen, "\t.section .text");
+    
+    // Generate all function declarations first. The whole program is
+    // here, so only main and exported functions need global symbols.
+    for (int i = 0; i < node->data.program.function_count; i++) {
+        if (node->data.program.functions[i]->type != NODE_FUNCTION) continue;
+        const char *name = node->data.program.functions[i]->data.function.name;
+        if (callgraph_is_exported(name, gen->exports, gen->export_count)) {
+            codegen_emit(gen, "\t.global %s", name);
+        }
+        codegen_emit(gen, "\t.type %s, @function", name);
+    }
+}
+
+void codegen_entry_point(CodeGenerator *gen) {
     codegen_emit(gen, "\t.global _start");
     codegen_emit(gen, "\t.type _start, @function");
     codegen_emit(gen, "_start:");
@@ -78,6 +393,13 @@ void codegen_generate(CodeGenerator *gen, ASTNode *ast) {
     
     // Call main
     codegen_emit(gen, "\tcall main");
+
+    // Instrumented programs write their counters out before exiting
+    if (gen->profile_counters) {
+        codegen_emit(gen, "\tmovq %%rax, %%rbx");
+        codegen_emit(gen, "\tcall __profile_dump");
+        codegen_emit(gen, "\tmovq %%rbx, %%rax");
+    }
     
     // Exit syscall
     codegen_emit(gen, "\t# Exit syscall");
@@ -89,9 +411,81 @@ void codegen_generate(CodeGenerator *gen, ASTNode *ast) {
     codegen_emit(gen, "\t.size _start, .-_start");
 }
 
+// Assemble the program into an object file or executable
+static bool codegen_write_binary(CodeGenerator *gen) {
+    char error[ASSEMBLER_ERROR_SIZE];
+    Assembly *assembly = assemble(gen->insns, error, sizeof(error));
+    bool written = assembly && (gen->emit == EMIT_OBJECT
+                                    ? object_write_relocatable(assembly, gen->output, error, sizeof(error))
+                                    : object_write_executable(assembly, gen->output, error, sizeof(error)));
+    if (!written) fprintf(stderr, "Error: %s\n", error);
+    assembly_free(assembly);
+    return written;
+}
+
+void codegen_flush(CodeGenerator *gen) {
+    if (gen->emit == EMIT_MEMORY) return;
+    if (gen->emit == EMIT_ASSEMBLY) {
+        insn_list_print(gen->insns, gen->output);
+    } else if (!codegen_write_binary(gen)) {
+        gen->failed = true;
+    }
+    insn_list_clear(gen->insns);
+}
+
+// Restore the caller's frame, leaving %rsp at the return address
+static void codegen_frame_teardown(CodeGenerator *gen) {
+    codegen_emit(gen, "\tmovq %%rbp, %%rsp");
+    codegen_emit(gen, "\tpopq %%rbp");
+}
+
+static bool is_self_tail_call(ASTNode *node, const char *name) {
+    return node && node->type == NODE_RETURN && node->data.return_stmt.expression &&
+           node->data.return_stmt.expression->type == NODE_CALL &&
+           strcmp(node->data.return_stmt.expression->data.call.name, name) == 0;
+}
+
+static bool codegen_has_self_tail_call(ASTNode *node, const char *name) {
+    if (!node) return false;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                if (codegen_has_self_tail_call(node->data.block.statements[i], name)) return true;
+            }
+            return false;
+        case NODE_RETURN:
+            if (node->data.return_stmt.expression && node->data.return_stmt.expression->type == NODE_INLINE) {
+                return codegen_has_self_tail_call(node->data.return_stmt.expression->data.inline_call.body, name);
+            }
+            return is_self_tail_call(node, name);
+        case NODE_IF:
+            return codegen_has_self_tail_call(node->data.if_stmt.then_branch, name) ||
+                   codegen_has_self_tail_call(node->data.if_stmt.else_branch, name);
+        case NODE_WHILE:
+            return codegen_has_self_tail_call(node->data.while_stmt.body, name);
+        case NODE_FOR:
+            return codegen_has_self_tail_call(node->data.for_stmt.body, name);
+        case NODE_SWITCH:
+            return codegen_has_self_tail_call(node->data.switch_stmt.body, name);
+        default:
+            return false;
+    }
+}
+
 void codegen_function(CodeGenerator *gen, ASTNode *node) {
     if (node->type != NODE_FUNCTION) return;
 
+    // Lay out the frame: register parameters and locals get slots below
+    // %rbp, parameters passed on the stack stay above the return address
+    codegen_clear_locals(gen);
+    gen->function = node;
+    for (int i = 0; i < node->data.function.param_count; i++) {
+        int offset = i < MAX_ARGS_IN_REGISTERS ? 0 : 16 + (i - MAX_ARGS_IN_REGISTERS) * 8;
+        codegen_add_local(gen, node->data.function.params[i], node->data.function.param_types[i], 0, offset);
+    }
+    codegen_collect_locals(gen, node->data.function.body);
+
     // Function prologue
     codegen_emit(gen, "\t.align 16");
     codegen_emit(gen, "%s:", node->data.function.name);
@@ -102,21 +496,28 @@ void codegen_function(CodeGenerator *gen, ASTNode *node) {
     
     // Reserve stack space for local variables
     // Round up to maintain 16-byte stack alignment
-    int stack_size = ((node->data.function.param_count * 8 + 15) & ~15);
+    int stack_size = ((gen->frame_size + 15) & ~15);
     if (stack_size > 0) {
         codegen_emit(gen, "\tsubq $%d, %%rsp", stack_size);
     }
 
-    // Save any used callee-saved registers
-    codegen_emit(gen, "\tpushq %%rbx");
-    codegen_emit(gen, "\tpushq %%r12");
-    codegen_emit(gen, "\tpushq %%r13");
-    codegen_emit(gen, "\tpushq %%r14");
-    codegen_emit(gen, "\tpushq %%r15");
+    // No callee-saved registers are used. The frame pass shares slots,
+    // shrink-wraps this setup and drops what the body does not need.
+    gen->push_depth = 0;
 
     // Handle parameters according to System V AMD64 ABI
     for (int i = 0; i < node->data.function.param_count && i < MAX_ARGS_IN_REGISTERS; i++) {
-        codegen_emit(gen, "\tmovq %s, %d(%%rbp)", arg_registers[i], -(i+1)*8);
+        LocalVariable *param = codegen_find_local(gen, node->data.function.params[i]);
+        codegen_emit(gen, "\tmov%c %%%s, %d(%%rbp)", type_suffix(param->type),
+                     insn_reg_sized(arg_registers[i], type_size(param->type)), param->offset);
+    }
+
+    codegen_count(gen, node, 0);
+
+    // Self-recursive tail calls jump back here
+    if (gen->tail_calls &&
+        codegen_has_self_tail_call(node->data.function.body, node->data.function.name)) {
+        codegen_emit(gen, ".%s_entry:", node->data.function.name);
     }
 
     // Generate code for function body
@@ -124,16 +525,7 @@ void codegen_function(CodeGenerator *gen, ASTNode *node) {
 
     // Function epilogue
     codegen_emit(gen, ".%s_return:", node->data.function.name);
-    
-    // Restore callee-saved registers
-    codegen_emit(gen, "\tpopq %%r15");
-    codegen_emit(gen, "\tpopq %%r14");
-    codegen_emit(gen, "\tpopq %%r13");
-    codegen_emit(gen, "\tpopq %%r12");
-    codegen_emit(gen, "\tpopq %%rbx");
-    
-    codegen_emit(gen, "\tmovq %%rbp, %%rsp");
-    codegen_emit(gen, "\tpopq %%rbp");
+    codegen_frame_teardown(gen);
     codegen_emit(gen, "\tret");
     
     // Add size directive for debugging
@@ -153,106 +545,330 @@ void codegen_block(CodeGenerator *gen, ASTNode *node) {
 void codegen_statement(CodeGenerator *gen, ASTNode *node) {
     switch (node->type) {
         case NODE_RETURN:
+            // Inside an inlined body a return only ends the copy, unless the
+            // copy is itself our return value: then its returns are ours and
+            // its tail calls stay tail calls
+            if (gen->tail_calls && gen->inline_return_label < 0 && node->data.return_stmt.expression &&
+                node->data.return_stmt.expression->type == NODE_INLINE) {
+                codegen_count(gen, node->data.return_stmt.expression, 0);
+                codegen_block(gen, node->data.return_stmt.expression->data.inline_call.body);
+                codegen_emit(gen, "\tjmp .%s_return", gen->function->data.function.name);
+                break;
+            }
+            if (gen->tail_calls && gen->inline_return_label < 0 &&
+                codegen_tail_call(gen, node->data.return_stmt.expression)) {
+                break;
+            }
             codegen_expression(gen, node->data.return_stmt.expression);
-            codegen_emit(gen, "\tjmp .%s_return", "main");  // TODO: current function name
+            if (gen->inline_return_label >= 0) {
+                codegen_emit_jump(gen, "jmp", gen->inline_return_label);
+            } else {
+                codegen_emit(gen, "\tjmp .%s_return", gen->function->data.function.name);
+            }
             break;
 
         case NODE_IF: {
-            char *else_label = codegen_new_label(gen);
-            char *end_label = codegen_new_label(gen);
+            int else_label = codegen_new_label(gen);
+            int end_label = codegen_new_label(gen);
 
-            codegen_expression(gen, node->data.if_stmt.condition);
-            codegen_emit(gen, "\tcmpq $0, %%rax");
-            codegen_emit(gen, "\tje %s", else_label);
+            codegen_branch(gen, node->data.if_stmt.condition, false, else_label);
 
+            codegen_count(gen, node, 0);
             codegen_block(gen, node->data.if_stmt.then_branch);
-            codegen_emit(gen, "\tjmp %s", end_label);
+            codegen_emit_jump(gen, "jmp", end_label);
 
-            codegen_emit(gen, "%s:", else_label);
+            codegen_emit_label(gen, else_label);
+            codegen_count(gen, node, 1);
             if (node->data.if_stmt.else_branch) {
                 codegen_block(gen, node->data.if_stmt.else_branch);
             }
-            codegen_emit(gen, "%s:", end_label);
-
-            free(else_label);
-            free(end_label);
+            codegen_emit_label(gen, end_label);
             break;
         }
 
-        case NODE_WHILE: {
-            char *start_label = codegen_new_label(gen);
-            char *end_label = codegen_new_label(gen);
+        case NODE_WHILE:
+        case NODE_FOR:
+            codegen_loop(gen, node);
+            break;
 
-            codegen_emit(gen, "%s:", start_label);
-            codegen_expression(gen, node->data.while_stmt.condition);
-            codegen_emit(gen, "\tcmpq $0, %%rax");
-            codegen_emit(gen, "\tje %s", end_label);
+        case NODE_SWITCH:
+            codegen_switch(gen, node);
+            break;
 
-            codegen_block(gen, node->data.while_stmt.body);
-            codegen_emit(gen, "\tjmp %s", start_label);
-            codegen_emit(gen, "%s:", end_label);
+        case NODE_VECTOR:
+            codegen_vector_loop(gen, node);
+            break;
 
-            free(start_label);
-            free(end_label);
+        case NODE_BREAK:
+            codegen_emit_jump(gen, "jmp", gen->break_label);
+            break;
+
+        case NODE_VARIABLE:
+            // Declaration without initializer; the slot is already reserved
             break;
-        }
 
         default:
-            codegen_expression(gen, node);
+            isel_effect(gen, node);
             break;
     }
 }
 
+void codegen_push(CodeGenerator *gen, const char *reg) {
+    codegen_emit(gen, "\tpushq %s", reg);
+    gen->push_depth++;
+}
+
+void codegen_pop(CodeGenerator *gen, const char *reg) {
+    codegen_emit(gen, "\tpopq %s", reg);
+    gen->push_depth--;
+}
+
+// System V call: first six arguments in registers, the rest on the stack,
+// with %rsp 16-byte aligned at the call instruction
+static void codegen_call(CodeGenerator *gen, ASTNode *node) {
+    int arg_count = node->data.call.arg_count;
+    int stack_args = arg_count > MAX_ARGS_IN_REGISTERS ? arg_count - MAX_ARGS_IN_REGISTERS : 0;
+
+    codegen_count(gen, node, 0);
+    int padding = (gen->push_depth + stack_args) % 2 ? 8 : 0;
+    if (padding) {
+        codegen_emit(gen, "\tsubq $8, %%rsp");
+        gen->push_depth++;
+    }
+
+    // Push right to left so the first argument ends up on top
+    for (int i = arg_count - 1; i >= 0; i--) {
+        codegen_expression(gen, node->data.call.args[i]);
+        codegen_push(gen, "%rax");
+    }
+    for (int i = 0; i < arg_count && i < MAX_ARGS_IN_REGISTERS; i++) {
+        codegen_pop(gen, arg_registers[i]);
+    }
+
+    codegen_emit(gen, "\tcall %s", node->data.call.name);
+
+    int cleanup = stack_args * 8 + padding;
+    if (cleanup) {
+        codegen_emit(gen, "\taddq $%d, %%rsp", cleanup);
+        gen->push_depth -= cleanup / 8;
+    }
+}
+
+bool codegen_tail_call(CodeGenerator *gen, ASTNode *call) {
+    if (!call || call->type != NODE_CALL) return false;
+
+    ASTNode *function = gen->function;
+    int arg_count = call->data.call.arg_count;
+    bool self = strcmp(call->data.call.name, function->data.function.name) == 0;
+    if ((!self || arg_count != function->data.function.param_count) &&
+        arg_count > MAX_ARGS_IN_REGISTERS) {
+        return false;
+    }
+    codegen_count(gen, call, 0);
+
+    if (self && arg_count == function->data.function.param_count) {
+        // Self recursion becomes a loop: evaluate every argument before
+        // overwriting any parameter, then restart the body
+        for (int i = arg_count - 1; i >= 0; i--) {
+            codegen_expression(gen, call->data.call.args[i]);
+            codegen_push(gen, "%rax");
+        }
+        for (int i = 0; i < arg_count; i++) {
+            LocalVariable *param = codegen_find_local(gen, function->data.function.params[i]);
+            codegen_pop(gen, "%rax");
+            codegen_emit(gen, "\tmov%c %%%s, %d(%%rbp)", type_suffix(param->type),
+                         insn_reg_sized("rax", type_size(param->type)), param->offset);
+        }
+        codegen_emit(gen, "\tjmp .%s_entry", function->data.function.name);
+        return true;
+    }
+
+    // Sibling call: the callee reuses our return address, so its arguments
+    // must all fit in registers, as checked above
+    for (int i = arg_count - 1; i >= 0; i--) {
+        codegen_expression(gen, call->data.call.args[i]);
+        codegen_push(gen, "%rax");
+    }
+    for (int i = 0; i < arg_count; i++) {
+        codegen_pop(gen, arg_registers[i]);
+    }
+    codegen_frame_teardown(gen);
+    codegen_emit(gen, "\tjmp %s", call->data.call.name);
+    return true;
+}
+
+// Run an inlined body in place; its returns leave the value in %rax
+static void codegen_inline(CodeGenerator *gen, ASTNode *node) {
+    int end_label = codegen_new_label(gen);
+    int saved_label = gen->inline_return_label;
+
+    codegen_count(gen, node, 0);
+    gen->inline_return_label = end_label;
+    codegen_block(gen, node->data.inline_call.body);
+    gen->inline_return_label = saved_label;
+
+    codegen_emit_label(gen, end_label);
+}
+
+// Evaluate both values, then pick one with cmov on the condition's flags
+static void codegen_select(CodeGenerator *gen, ASTNode *node) {
+    ASTNode *condition = node->data.select.condition;
+
+    codegen_expression(gen, node->data.select.if_false);
+    codegen_push(gen, "%rax");
+    codegen_expression(gen, node->data.select.if_true);
+    codegen_push(gen, "%rax");
+
+    const char *cond = isel_condition(gen, condition);
+
+    // Pops leave the flags alone
+    codegen_pop(gen, "%rcx");
+    codegen_pop(gen, "%rax");
+    if (type_size(node->value_type) <= 4) {
+        codegen_emit(gen, "\tcmov%sl %%ecx, %%eax", cond);
+    } else {
+        codegen_emit(gen, "\tcmov%sq %%rcx, %%rax", cond);
+    }
+}
+
+static bool is_logical(const ASTNode *node, char operator) {
+    if (node->type == NODE_UNARY_OP) return node->data.unary_op.operator == operator;
+    return node->type == NODE_BINARY_OP && node->data.binary_op.operator == operator;
+}
+
+// Materialize node, or its negation, as 0 or 1. && and || branch past their
+// right operand, and only the last test of the chain is turned into a value.
+static void codegen_truth(CodeGenerator *gen, ASTNode *node, bool negate) {
+    if (is_logical(node, '!')) {
+        codegen_truth(gen, node->data.unary_op.operand, !negate);
+        return;
+    }
+
+    if (is_logical(node, 'A') || is_logical(node, 'O')) {
+        // a && b is false as soon as a is, a || b true as soon as a is
+        bool is_and = is_logical(node, 'A');
+        int decided_label = codegen_new_label(gen);
+        int end_label = codegen_new_label(gen);
+
+        codegen_branch(gen, node->data.binary_op.left, !is_and, decided_label);
+        codegen_truth(gen, node->data.binary_op.right, negate);
+        codegen_emit_jump(gen, "jmp", end_label);
+        codegen_emit_label(gen, decided_label);
+        codegen_emit(gen, "\tmovl $%d, %%eax", !is_and != negate);
+        codegen_emit_label(gen, end_label);
+        return;
+    }
+
+    const char *cond = isel_condition(gen, node);
+    codegen_emit(gen, "\tset%s %%al", negate ? insn_invert_cond(cond) : cond);
+    codegen_emit(gen, "\tmovzbl %%al, %%eax");
+}
+
+void codegen_branch(CodeGenerator *gen, ASTNode *node, bool jump_if, int label) {
+    if (is_logical(node, '!')) {
+        codegen_branch(gen, node->data.unary_op.operand, !jump_if, label);
+        return;
+    }
+
+    if (is_logical(node, 'A') || is_logical(node, 'O')) {
+        // a && b jumps only once both hold, a || b skips the rest once a
+        // holds; the opposite cases test both operands against label
+        bool is_and = is_logical(node, 'A');
+        if (jump_if == is_and) {
+            int skip_label = codegen_new_label(gen);
+            codegen_branch(gen, node->data.binary_op.left, !jump_if, skip_label);
+            codegen_branch(gen, node->data.binary_op.right, jump_if, label);
+            codegen_emit_label(gen, skip_label);
+        } else {
+            codegen_branch(gen, node->data.binary_op.left, jump_if, label);
+            codegen_branch(gen, node->data.binary_op.right, jump_if, label);
+        }
+        return;
+    }
+
+    // Branch directly on the flags of the comparison
+    char mnemonic[8] = "j";
+    const char *cond = isel_condition(gen, node);
+    output_text(mnemonic + 1, mnemonic + sizeof(mnemonic), jump_if ? cond : insn_invert_cond(cond));
+    codegen_emit_jump(gen, mnemonic, label);
+}
+
+void codegen_loop(CodeGenerator *gen, ASTNode *loop) {
+    ASTNode *init = NULL;
+    ASTNode *condition = loop->data.while_stmt.condition;
+    ASTNode *step = NULL;
+    ASTNode *body = loop->data.while_stmt.body;
+    if (loop->type == NODE_FOR) {
+        init = loop->data.for_stmt.init;
+        condition = loop->data.for_stmt.condition;
+        step = loop->data.for_stmt.step;
+        body = loop->data.for_stmt.body;
+    }
+
+    int top_label = codegen_new_label(gen);
+    int end_label = codegen_new_label(gen);
+    int saved_break = gen->break_label;
+
+    codegen_count(gen, loop, 0);
+    if (init) codegen_statement(gen, init);
+
+    // Rotated form: test once on entry, then once at the bottom of each
+    // iteration, so the loop body takes a single taken branch per trip
+    if (condition) codegen_branch(gen, condition, false, end_label);
+
+    if (gen->align_loops) codegen_emit(gen, "\t.p2align 4,,10");
+    codegen_emit_label(gen, top_label);
+    codegen_count(gen, loop, 1);
+    gen->break_label = end_label;
+    codegen_block(gen, body);
+    gen->break_label = saved_break;
+    if (step) codegen_statement(gen, step);
+
+    if (condition) {
+        codegen_branch(gen, condition, true, top_label);
+    } else {
+        codegen_emit_jump(gen, "jmp", top_label);
+    }
+    codegen_emit_label(gen, end_label);
+}
+
 void codegen_expression(CodeGenerator *gen, ASTNode *node) {
     if (!node) return;
 
     switch (node->type) {
+        case NODE_BINARY_OP:
+            if (is_logical(node, 'A') || is_logical(node, 'O')) {
+                codegen_truth(gen, node, false);
+                break;
+            }
+            isel_value(gen, node);
+            break;
+
         case NODE_NUMBER:
-            codegen_emit(gen, "\tmovq $%d, %%rax", node->data.number.value);
+        case NODE_VARIABLE:
+        case NODE_STRING:
+        case NODE_INDEX:
+            isel_value(gen, node);
             break;
 
-        case NODE_BINARY_OP:
-            // Generate right operand first
-            codegen_expression(gen, node->data.binary_op.right);
-            codegen_emit(gen, "\tpushq %%rax");
-            
-            // Generate left operand
-            codegen_expression(gen, node->data.binary_op.left);
-            codegen_emit(gen, "\tpopq %%rcx");
-
-            // Perform operation
-            switch (node->data.binary_op.operator) {
-                case '+':
-                    codegen_emit(gen, "\taddq %%rcx, %%rax");
-                    break;
-                case '-':
-                    codegen_emit(gen, "\tsubq %%rcx, %%rax");
-                    break;
-                case '*':
-                    codegen_emit(gen, "\timulq %%rcx, %%rax");
-                    break;
-                case '/':
-                    codegen_emit(gen, "\tcqo");        // Sign extend rax into rdx
-                    codegen_emit(gen, "\tidivq %%rcx");
-                    break;
-                case '>':
-                    codegen_emit(gen, "\tcmpq %%rcx, %%rax");
-                    codegen_emit(gen, "\tsetg %%al");
-                    codegen_emit(gen, "\tmovzbq %%al, %%rax");
-                    break;
-                case '<':
-                    codegen_emit(gen, "\tcmpq %%rcx, %%rax");
-                    codegen_emit(gen, "\tsetl %%al");
-                    codegen_emit(gen, "\tmovzbq %%al, %%rax");
-                    break;
-                case '=':
-                    // Handle assignment
-                    break;
+        case NODE_CALL:
+            codegen_call(gen, node);
+            break;
+
+        case NODE_INLINE:
+            codegen_inline(gen, node);
+            break;
+
+        case NODE_UNARY_OP:
+            if (is_logical(node, '!')) {
+                codegen_truth(gen, node, false);
+            } else {
+                isel_value(gen, node);   // Conversion
             }
             break;
 
-        case NODE_VARIABLE:
-            // This would require symbol table lookup
+        case NODE_SELECT:
+            codegen_select(gen, node);
             break;
 
         default:
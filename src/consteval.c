@@ -0,0 +1,509 @@
+#include <stdlib.h>
+#include <string.h>
+#include <consteval.h>
+#include <fold.h>
+
+// How a statement finished
+typedef enum {
+    FLOW_NEXT,       // Control reaches the following statement
+    FLOW_BREAK,
+    FLOW_RETURN,
+    FLOW_FAIL        // The evaluation gave up
+} Flow;
+
+typedef struct {
+    const char *name;
+    long value;
+} Binding;
+
+// Locals of one running call, bound as they are assigned
+typedef struct {
+    Binding *variables;
+    int count;
+    long result;     // Set by a return with a value
+} Frame;
+
+typedef struct {
+    ASTNode *program;
+    bool *pure;      // Indexed like the program's functions
+    long steps;      // Left for the current evaluation
+    long budget;     // Left for the program
+    int depth;
+} Evaluator;
+
+static int find_function(ASTNode *program, const char *name) {
+    for (int i = 0; i < program->data.program.function_count; i++) {
+        if (strcmp(program->data.program.functions[i]->data.function.name, name) == 0) return i;
+    }
+    return -1;
+}
+
+// Purity
+
+// False if node uses a global or calls anything but a pure function of the
+// program
+static bool calls_only_pure(ASTNode *program, const bool *pure, const ASTNode *node) {
+    if (!node) return true;
+
+    switch (node->type) {
+        case NODE_VARIABLE:
+            return !node->data.variable.is_global;
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                if (!calls_only_pure(program, pure, node->data.block.statements[i])) return false;
+            }
+            return true;
+        case NODE_RETURN:
+            return calls_only_pure(program, pure, node->data.return_stmt.expression);
+        case NODE_IF:
+            return calls_only_pure(program, pure, node->data.if_stmt.condition) &&
+                   calls_only_pure(program, pure, node->data.if_stmt.then_branch) &&
+                   calls_only_pure(program, pure, node->data.if_stmt.else_branch);
+        case NODE_WHILE:
+            return calls_only_pure(program, pure, node->data.while_stmt.condition) &&
+                   calls_only_pure(program, pure, node->data.while_stmt.body);
+        case NODE_FOR:
+            return calls_only_pure(program, pure, node->data.for_stmt.init) &&
+                   calls_only_pure(program, pure, node->data.for_stmt.condition) &&
+                   calls_only_pure(program, pure, node->data.for_stmt.step) &&
+                   calls_only_pure(program, pure, node->data.for_stmt.body);
+        case NODE_BINARY_OP:
+            return calls_only_pure(program, pure, node->data.binary_op.left) &&
+                   calls_only_pure(program, pure, node->data.binary_op.right);
+        case NODE_UNARY_OP:
+            return calls_only_pure(program, pure, node->data.unary_op.operand);
+        case NODE_INDEX:
+            return calls_only_pure(program, pure, node->data.index.array) &&
+                   calls_only_pure(program, pure, node->data.index.index);
+        case NODE_CALL: {
+            int callee = find_function(program, node->data.call.name);
+            if (callee < 0 || !pure[callee]) return false;
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                if (!calls_only_pure(program, pure, node->data.call.args[i])) return false;
+            }
+            return true;
+        }
+        case NODE_INLINE:
+            return calls_only_pure(program, pure, node->data.inline_call.body);
+        case NODE_SELECT:
+            return calls_only_pure(program, pure, node->data.select.condition) &&
+                   calls_only_pure(program, pure, node->data.select.if_true) &&
+                   calls_only_pure(program, pure, node->data.select.if_false);
+        case NODE_SWITCH:
+            return calls_only_pure(program, pure, node->data.switch_stmt.value) &&
+                   calls_only_pure(program, pure, node->data.switch_stmt.body);
+        default:
+            return true;
+    }
+}
+
+// Every defined function starts out pure, and a function calling one that
+// is not loses it, until nothing changes; recursion keeps purity
+static bool *find_pure_functions(ASTNode *program) {
+    int count = program->data.program.function_count;
+    bool *pure = malloc(sizeof(bool) * (count > 0 ? count : 1));
+    if (!pure) return NULL;
+
+    for (int i = 0; i < count; i++) {
+        pure[i] = program->data.program.functions[i]->type == NODE_FUNCTION;
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int i = 0; i < count; i++) {
+            ASTNode *function = program->data.program.functions[i];
+            if (pure[i] && !calls_only_pure(program, pure, function->data.function.body)) {
+                pure[i] = false;
+                changed = true;
+            }
+        }
+    }
+    return pure;
+}
+
+// Interpreter
+
+static bool lookup(const Frame *frame, const char *name, long *value) {
+    for (int i = 0; i < frame->count; i++) {
+        if (strcmp(frame->variables[i].name, name) == 0) {
+            *value = frame->variables[i].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool bind(Frame *frame, const char *name, long value) {
+    for (int i = 0; i < frame->count; i++) {
+        if (strcmp(frame->variables[i].name, name) == 0) {
+            frame->variables[i].value = value;
+            return true;
+        }
+    }
+
+    void *temp = realloc(frame->variables, sizeof(Binding) * (frame->count + 1));
+    if (!temp) return false;
+    frame->variables = temp;
+    frame->variables[frame->count++] = (Binding){name, value};
+    return true;
+}
+
+static bool step(Evaluator *ev) {
+    if (ev->steps <= 0 || ev->budget <= 0) return false;
+    ev->steps--;
+    ev->budget--;
+    return true;
+}
+
+static Flow execute(Evaluator *ev, Frame *frame, const ASTNode *node);
+static bool call_function(Evaluator *ev, const ASTNode *function, const long *args, long *value);
+
+static bool evaluate(Evaluator *ev, Frame *frame, const ASTNode *node, long *value) {
+    if (!step(ev)) return false;
+
+    switch (node->type) {
+        case NODE_NUMBER:
+            *value = node->data.number.value;
+            return true;
+
+        case NODE_VARIABLE:
+            // Unbound means read before any assignment
+            return lookup(frame, node->data.variable.name, value);
+
+        case NODE_BINARY_OP: {
+            char operator = node->data.binary_op.operator;
+            const ASTNode *left = node->data.binary_op.left;
+            long a, b;
+
+            if (operator == '=') {
+                if (left->type != NODE_VARIABLE ||
+                    !evaluate(ev, frame, node->data.binary_op.right, &b)) {
+                    return false;
+                }
+                *value = type_convert(b, left->value_type);
+                return bind(frame, left->data.variable.name, *value);
+            }
+
+            if (!evaluate(ev, frame, left, &a)) return false;
+            if (operator == 'A' || operator == 'O') {
+                if ((operator == 'A') != (a != 0)) {
+                    *value = a != 0;
+                    return true;
+                }
+                if (!evaluate(ev, frame, node->data.binary_op.right, &b)) return false;
+                *value = b != 0;
+                return true;
+            }
+            if (!evaluate(ev, frame, node->data.binary_op.right, &b)) return false;
+            return fold_operation(node, a, b, value);
+        }
+
+        case NODE_UNARY_OP: {
+            long operand;
+            if (!evaluate(ev, frame, node->data.unary_op.operand, &operand)) return false;
+            if (node->data.unary_op.operator == 'C') {
+                *value = type_convert(operand, node->value_type);
+            } else if (node->data.unary_op.operator == '!') {
+                *value = !operand;
+            } else {
+                return false;
+            }
+            return true;
+        }
+
+        case NODE_SELECT: {
+            long condition, if_true, if_false;
+            if (!evaluate(ev, frame, node->data.select.condition, &condition) ||
+                !evaluate(ev, frame, node->data.select.if_true, &if_true) ||
+                !evaluate(ev, frame, node->data.select.if_false, &if_false)) {
+                return false;
+            }
+            *value = condition ? if_true : if_false;
+            return true;
+        }
+
+        case NODE_CALL: {
+            int callee = find_function(ev->program, node->data.call.name);
+            if (callee < 0 || !ev->pure[callee]) return false;
+            const ASTNode *function = ev->program->data.program.functions[callee];
+            int count = node->data.call.arg_count;
+            if (count != function->data.function.param_count) return false;
+
+            long *args = malloc(sizeof(long) * (count > 0 ? count : 1));
+            if (!args) return false;
+            bool ok = true;
+            for (int i = 0; i < count && ok; i++) {
+                ok = evaluate(ev, frame, node->data.call.args[i], &args[i]);
+            }
+            ok = ok && call_function(ev, function, args, value);
+            free(args);
+            return ok;
+        }
+
+        case NODE_INLINE: {
+            // The body shares the frame, and its return ends only the body
+            Flow flow = execute(ev, frame, node->data.inline_call.body);
+            if (flow == FLOW_RETURN) {
+                *value = frame->result;
+                return true;
+            }
+            *value = 0;
+            return flow == FLOW_NEXT && node->value_type == TYPE_VOID;
+        }
+
+        default:
+            return false;
+    }
+}
+
+static Flow execute_block(Evaluator *ev, Frame *frame, const ASTNode *block, int start) {
+    if (!block) return FLOW_NEXT;
+
+    for (int i = start; i < block->data.block.statement_count; i++) {
+        Flow flow = execute(ev, frame, block->data.block.statements[i]);
+        if (flow != FLOW_NEXT) return flow;
+    }
+    return FLOW_NEXT;
+}
+
+// Runs one loop, of which init and step may be NULL
+static Flow execute_loop(Evaluator *ev, Frame *frame, const ASTNode *condition,
+                         const ASTNode *body, const ASTNode *step_expression) {
+    for (;;) {
+        long value = 1;
+        if (condition && !evaluate(ev, frame, condition, &value)) return FLOW_FAIL;
+        if (!value) return FLOW_NEXT;
+
+        Flow flow = execute(ev, frame, body);
+        if (flow == FLOW_BREAK) return FLOW_NEXT;
+        if (flow != FLOW_NEXT) return flow;
+
+        if (step_expression && execute(ev, frame, step_expression) == FLOW_FAIL) return FLOW_FAIL;
+    }
+}
+
+// Control enters the body at the matching case, or else at the default,
+// and falls through the labels after it
+static Flow execute_switch(Evaluator *ev, Frame *frame, const ASTNode *node) {
+    long value;
+    if (!evaluate(ev, frame, node->data.switch_stmt.value, &value)) return FLOW_FAIL;
+
+    // Cases of a 32-bit switch are stored sign-extended
+    if (type_size(node->data.switch_stmt.value->value_type) <= 4) {
+        value = type_convert(value, TYPE_INT);
+    }
+
+    const ASTNode *body = node->data.switch_stmt.body;
+    int start = -1;
+    for (int i = 0; i < body->data.block.statement_count && start < 0; i++) {
+        const ASTNode *label = body->data.block.statements[i];
+        if (label->type == NODE_CASE && !label->data.case_label.is_default &&
+            label->data.case_label.value == value) {
+            start = i;
+        }
+    }
+    for (int i = 0; i < body->data.block.statement_count && start < 0; i++) {
+        const ASTNode *label = body->data.block.statements[i];
+        if (label->type == NODE_CASE && label->data.case_label.is_default) start = i;
+    }
+    if (start < 0) return FLOW_NEXT;
+
+    Flow flow = execute_block(ev, frame, body, start);
+    return flow == FLOW_BREAK ? FLOW_NEXT : flow;
+}
+
+static Flow execute(Evaluator *ev, Frame *frame, const ASTNode *node) {
+    if (!node) return FLOW_NEXT;
+    if (!step(ev)) return FLOW_FAIL;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            return execute_block(ev, frame, node, 0);
+
+        case NODE_RETURN:
+            if (node->data.return_stmt.expression &&
+                !evaluate(ev, frame, node->data.return_stmt.expression, &frame->result)) {
+                return FLOW_FAIL;
+            }
+            return FLOW_RETURN;
+
+        case NODE_IF: {
+            long condition;
+            if (!evaluate(ev, frame, node->data.if_stmt.condition, &condition)) return FLOW_FAIL;
+            return execute(ev, frame, condition ? node->data.if_stmt.then_branch
+                                                : node->data.if_stmt.else_branch);
+        }
+
+        case NODE_WHILE:
+            return execute_loop(ev, frame, node->data.while_stmt.condition,
+                                node->data.while_stmt.body, NULL);
+
+        case NODE_FOR: {
+            Flow flow = execute(ev, frame, node->data.for_stmt.init);
+            if (flow != FLOW_NEXT) return flow;
+            return execute_loop(ev, frame, node->data.for_stmt.condition,
+                                node->data.for_stmt.body, node->data.for_stmt.step);
+        }
+
+        case NODE_SWITCH:
+            return execute_switch(ev, frame, node);
+
+        case NODE_BREAK:
+            return FLOW_BREAK;
+
+        case NODE_CASE:
+        case NODE_VARIABLE:
+            // A label, or a declaration without initializer
+            return FLOW_NEXT;
+
+        default: {
+            long value;
+            return evaluate(ev, frame, node, &value) ? FLOW_NEXT : FLOW_FAIL;
+        }
+    }
+}
+
+static bool call_function(Evaluator *ev, const ASTNode *function, const long *args, long *value) {
+    if (ev->depth >= CONSTEVAL_MAX_DEPTH) return false;
+
+    Frame frame = {NULL, 0, 0};
+    bool ok = true;
+    for (int i = 0; i < function->data.function.param_count && ok; i++) {
+        ok = bind(&frame, function->data.function.params[i], args[i]);
+    }
+
+    ev->depth++;
+    Flow flow = ok ? execute(ev, &frame, function->data.function.body) : FLOW_FAIL;
+    ev->depth--;
+
+    // Running off the end leaves no value
+    bool is_void = function->data.function.return_type == TYPE_VOID;
+    ok = flow == FLOW_RETURN || (flow == FLOW_NEXT && is_void);
+    *value = is_void ? 0 : frame.result;
+    free(frame.variables);
+    return ok;
+}
+
+// Replacement
+
+static int replace_calls(Evaluator *ev, ASTNode **slot);
+
+// Calls whose value is not used are kept, and only their arguments looked at
+static int replace_in_statement(Evaluator *ev, ASTNode **slot) {
+    ASTNode *node = *slot;
+    if (node && node->type == NODE_CALL) {
+        int changed = 0;
+        for (int i = 0; i < node->data.call.arg_count; i++) {
+            changed += replace_calls(ev, &node->data.call.args[i]);
+        }
+        return changed;
+    }
+    return replace_calls(ev, slot);
+}
+
+static int replace_children(Evaluator *ev, ASTNode *node) {
+    int changed = 0;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                changed += replace_in_statement(ev, &node->data.block.statements[i]);
+            }
+            break;
+        case NODE_RETURN:
+            changed += replace_calls(ev, &node->data.return_stmt.expression);
+            break;
+        case NODE_IF:
+            changed += replace_calls(ev, &node->data.if_stmt.condition);
+            changed += replace_calls(ev, &node->data.if_stmt.then_branch);
+            changed += replace_calls(ev, &node->data.if_stmt.else_branch);
+            break;
+        case NODE_WHILE:
+            changed += replace_calls(ev, &node->data.while_stmt.condition);
+            changed += replace_calls(ev, &node->data.while_stmt.body);
+            break;
+        case NODE_FOR:
+            changed += replace_in_statement(ev, &node->data.for_stmt.init);
+            changed += replace_calls(ev, &node->data.for_stmt.condition);
+            changed += replace_in_statement(ev, &node->data.for_stmt.step);
+            changed += replace_calls(ev, &node->data.for_stmt.body);
+            break;
+        case NODE_BINARY_OP:
+            changed += replace_calls(ev, &node->data.binary_op.left);
+            changed += replace_calls(ev, &node->data.binary_op.right);
+            break;
+        case NODE_UNARY_OP:
+            changed += replace_calls(ev, &node->data.unary_op.operand);
+            break;
+        case NODE_INDEX:
+            changed += replace_calls(ev, &node->data.index.index);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                changed += replace_calls(ev, &node->data.call.args[i]);
+            }
+            break;
+        case NODE_INLINE:
+            changed += replace_calls(ev, &node->data.inline_call.body);
+            break;
+        case NODE_SELECT:
+            changed += replace_calls(ev, &node->data.select.condition);
+            changed += replace_calls(ev, &node->data.select.if_true);
+            changed += replace_calls(ev, &node->data.select.if_false);
+            break;
+        case NODE_SWITCH:
+            changed += replace_calls(ev, &node->data.switch_stmt.value);
+            changed += replace_calls(ev, &node->data.switch_stmt.body);
+            break;
+        default:
+            break;
+    }
+    return changed;
+}
+
+// Arguments first, so that f(g(1)) can go once g(1) has. An argument is
+// constant if it folds, as -1 and conversions of literals do.
+static int replace_calls(Evaluator *ev, ASTNode **slot) {
+    ASTNode *node = *slot;
+    if (!node) return 0;
+
+    int changed = replace_children(ev, node);
+    if (node->type != NODE_CALL || node->value_type == TYPE_VOID) return changed;
+    for (int i = 0; i < node->data.call.arg_count; i++) {
+        long value;
+        if (!fold_constant(node->data.call.args[i], &value)) return changed;
+    }
+
+    Frame frame = {NULL, 0, 0};
+    long value;
+    ev->steps = CONSTEVAL_MAX_STEPS;
+    ev->depth = 0;
+    if (!evaluate(ev, &frame, node, &value)) return changed;
+
+    ASTNode *number = ast_create_number(value);
+    if (!number) return changed;
+    number->value_type = node->value_type;
+    *slot = number;
+    ast_free(node);
+    return changed + 1;
+}
+
+int consteval_run(ASTNode *program) {
+    bool *pure = find_pure_functions(program);
+    if (!pure) return 0;
+
+    Evaluator ev = {program, pure, 0, CONSTEVAL_BUDGET, 0};
+    int replaced = 0;
+    for (int i = 0; i < program->data.program.function_count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        if (function->type != NODE_FUNCTION) continue;
+
+        int count = replace_calls(&ev, &function->data.function.body);
+        if (count > 0) fold_function(function);
+        replaced += count;
+    }
+
+    free(pure);
+    return replaced;
+}
\ No newline at end of file
@@ -0,0 +1,1157 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <encoder.h>
+
+typedef enum {
+    OPERAND_REG,
+    OPERAND_IMM,
+    OPERAND_MEM,
+    OPERAND_SYMBOL,      // Bare symbol: a branch target
+} OperandKind;
+
+typedef struct {
+    OperandKind kind;
+    bool indirect;       // *%reg or *mem: the target of an indirect branch
+    // OPERAND_REG
+    int reg;             // 0-15
+    int size;            // 1, 2, 4 or 8 for general-purpose, 16 xmm, 32 ymm
+    bool byte_rex;       // %spl %bpl %sil %dil: need a REX prefix
+    bool byte_high;      // %ah %ch %dh %bh: cannot have one
+    // OPERAND_IMM, and the displacement of OPERAND_MEM
+    long value;
+    // OPERAND_MEM
+    int base;            // -1 for none, REG_RIP for %rip
+    int index;           // -1 for none
+    int scale;
+    char symbol[ENCODER_SYMBOL_SIZE];   // Also the name of OPERAND_SYMBOL
+    // OPERAND_IMM of $symbol-minus
+    char minus[ENCODER_SYMBOL_SIZE];
+} Operand;
+
+#define REG_RIP 16
+#define MAX_OPERANDS 3
+
+static const char *gpr_names[4][16] = {
+    {"al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+     "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"},
+    {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+     "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"},
+    {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+     "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"},
+    {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+     "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"},
+};
+static const char *high_byte_names[] = {"ah", "ch", "dh", "bh"};
+
+// Condition code suffixes and their numbers in jcc, setcc and cmovcc
+static const struct {
+    const char *name;
+    int code;
+} conditions[] = {
+    {"o", 0}, {"no", 1}, {"b", 2}, {"c", 2}, {"nae", 2}, {"ae", 3}, {"nb", 3}, {"nc", 3},
+    {"e", 4}, {"z", 4}, {"ne", 5}, {"nz", 5}, {"be", 6}, {"na", 6}, {"a", 7}, {"nbe", 7},
+    {"s", 8}, {"ns", 9}, {"p", 10}, {"pe", 10}, {"np", 11}, {"po", 11}, {"l", 12}, {"nge", 12},
+    {"ge", 13}, {"nl", 13}, {"le", 14}, {"ng", 14}, {"g", 15}, {"nle", 15},
+};
+static const int CONDITION_COUNT = sizeof(conditions) / sizeof(conditions[0]);
+
+// ALU operations sharing the encodings of add: their /digit and opcode base
+static const char *alu_names[] = {"add", "or", "adc", "sbb", "and", "sub", "xor", "cmp"};
+
+// Shifts and rotates: the /digit of c1, d1 and d3
+static const struct {
+    const char *name;
+    int digit;
+} shift_ops[] = {
+    {"rol", 0}, {"ror", 1}, {"shl", 4}, {"sal", 4}, {"shr", 5}, {"sar", 7},
+};
+
+// One-operand group of f7 (or f6) and ff (or fe)
+static const struct {
+    const char *name;
+    int opcode;
+    int digit;
+} unary_ops[] = {
+    {"not", 0xf7, 2}, {"neg", 0xf7, 3}, {"mul", 0xf7, 4}, {"imul", 0xf7, 5},
+    {"div", 0xf7, 6}, {"idiv", 0xf7, 7}, {"inc", 0xff, 0}, {"dec", 0xff, 1},
+};
+
+// Sign and zero extensions: source and destination sizes
+static const struct {
+    const char *name;
+    int opcode;          // After 0f, or 63 alone for movslq
+    int from;
+    int to;
+} extensions[] = {
+    {"movzbw", 0xb6, 1, 2}, {"movzbl", 0xb6, 1, 4}, {"movzbq", 0xb6, 1, 8},
+    {"movzwl", 0xb7, 2, 4}, {"movzwq", 0xb7, 2, 8},
+    {"movsbw", 0xbe, 1, 2}, {"movsbl", 0xbe, 1, 4}, {"movsbq", 0xbe, 1, 8},
+    {"movswl", 0xbf, 2, 4}, {"movswq", 0xbf, 2, 8}, {"movslq", 0x63, 4, 8},
+};
+
+// SSE2 and SSE4.1 integer operations, dst = dst op src, and their AVX
+// forms with a separate first source. Map 1 is 0f, 2 is 0f 38.
+static const struct {
+    const char *name;
+    int map;
+    int opcode;
+} vector_ops[] = {
+    {"paddd", 1, 0xfe}, {"psubd", 1, 0xfa}, {"paddq", 1, 0xd4}, {"psubq", 1, 0xfb},
+    {"pand", 1, 0xdb}, {"pandn", 1, 0xdf}, {"por", 1, 0xeb}, {"pxor", 1, 0xef},
+    {"pcmpgtd", 1, 0x66}, {"pcmpeqd", 1, 0x76}, {"pmuludq", 1, 0xf4},
+    {"punpckldq", 1, 0x62}, {"punpckhdq", 1, 0x6a}, {"punpcklqdq", 1, 0x6c},
+    {"pmulld", 2, 0x40}, {"pminsd", 2, 0x39}, {"pmaxsd", 2, 0x3d},
+    {"pminud", 2, 0x3b}, {"pmaxud", 2, 0x3f},
+};
+
+// Shifts of vector lanes by an immediate: 66 0f opcode /digit ib
+static const struct {
+    const char *name;
+    int opcode;
+    int digit;
+} vector_shifts[] = {
+    {"psrld", 0x72, 2}, {"psrad", 0x72, 4}, {"pslld", 0x72, 6},
+    {"psrlq", 0x73, 2}, {"psllq", 0x73, 6}, {"psrldq", 0x73, 3}, {"pslldq", 0x73, 7},
+};
+
+#define COUNT(array) ((int)(sizeof(array) / sizeof((array)[0])))
+
+// An instruction being put together: prefixes, opcode, ModRM operand and
+// immediate
+typedef struct {
+    int prefix;          // 66 or f3 before REX, or 0
+    bool rex_w;
+    bool rex_force;      // A byte register that needs REX
+    bool rex_forbid;     // A byte register that cannot have one
+    unsigned char opcode[3];
+    int opcode_length;
+    int opcode_reg;      // Register in the low bits of the last opcode byte, or -1
+    bool has_modrm;
+    int reg;             // ModRM.reg: a register or a /digit
+    const Operand *rm;
+    int imm_size;        // 0, 1, 2, 4 or 8
+    long imm;
+    const Operand *imm_symbol;   // Symbolic immediate, filled in by the assembler
+    // VEX
+    bool vex;
+    int vex_map;         // 1 0f, 2 0f 38, 3 0f 3a
+    int vex_pp;          // 0 none, 1 66, 2 f3, 3 f2
+    int vex_l;
+    int vvvv;            // Extra source register, or 0 for none
+} Encoding;
+
+static void set_error(char *error, int size, const char *message, const char *line) {
+    while (*line == '\t' || *line == ' ') line++;
+    snprintf(error, size, "%s: %s", message, line);
+}
+
+static bool parse_number(const char **p, long *value) {
+    const char *s = *p;
+    bool negative = false;
+    if (*s == '-' || *s == '+') {
+        negative = *s == '-';
+        s++;
+    }
+    if (!isdigit((unsigned char)*s)) return false;
+    char *end;
+    unsigned long magnitude = strtoul(s, &end, 0);
+    *value = negative ? -(long)magnitude : (long)magnitude;
+    *p = end;
+    return true;
+}
+
+static bool is_symbol_char(char c) {
+    return isalnum((unsigned char)c) || c == '_' || c == '.' || c == '$';
+}
+
+static bool parse_register(const char *name, size_t length, Operand *op) {
+    char text[8];
+    if (length == 0 || length >= sizeof(text)) return false;
+    memcpy(text, name, length);
+    text[length] = '\0';
+
+    op->kind = OPERAND_REG;
+    op->byte_rex = false;
+    op->byte_high = false;
+    for (int size = 0; size < 4; size++) {
+        for (int reg = 0; reg < 16; reg++) {
+            if (strcmp(text, gpr_names[size][reg]) == 0) {
+                op->reg = reg;
+                op->size = 1 << size;
+                op->byte_rex = size == 0 && reg >= 4 && reg < 8;
+                return true;
+            }
+        }
+    }
+    for (int reg = 0; reg < 4; reg++) {
+        if (strcmp(text, high_byte_names[reg]) == 0) {
+            op->reg = reg + 4;
+            op->size = 1;
+            op->byte_high = true;
+            return true;
+        }
+    }
+    if ((strncmp(text, "xmm", 3) == 0 || strncmp(text, "ymm", 3) == 0) && isdigit((unsigned char)text[3])) {
+        int reg = atoi(text + 3);
+        if (reg > 15) return false;
+        op->reg = reg;
+        op->size = text[0] == 'x' ? 16 : 32;
+        return true;
+    }
+    return false;
+}
+
+// Register operand "%name" at p, up to a delimiter
+static bool parse_register_at(const char **p, Operand *op) {
+    const char *s = *p;
+    if (*s != '%') return false;
+    s++;
+    const char *start = s;
+    while (isalnum((unsigned char)*s)) s++;
+    if (!parse_register(start, (size_t)(s - start), op)) return false;
+    *p = s;
+    return true;
+}
+
+// Symbol with an optional +n or -n, or a plain number, before a memory
+// operand's parentheses
+static bool parse_displacement(const char *s, const char *end, Operand *op) {
+    op->value = 0;
+    op->symbol[0] = '\0';
+    if (s == end) return true;
+    if (isdigit((unsigned char)*s) || *s == '-' || *s == '+') {
+        return parse_number(&s, &op->value) && s == end;
+    }
+    const char *start = s;
+    while (s < end && is_symbol_char(*s)) s++;
+    size_t length = (size_t)(s - start);
+    if (length == 0 || length >= ENCODER_SYMBOL_SIZE) return false;
+    memcpy(op->symbol, start, length);
+    op->symbol[length] = '\0';
+    if (s == end) return true;
+    return parse_number(&s, &op->value) && s == end;
+}
+
+static bool parse_operand(const char *text, Operand *op) {
+    memset(op, 0, sizeof(*op));
+    op->base = op->index = -1;
+    op->scale = 1;
+    const char *s = text;
+    if (*s == '*') {
+        op->indirect = true;
+        s++;
+    }
+    if (*s == '$') {
+        s++;
+        op->kind = OPERAND_IMM;
+        if (parse_number(&s, &op->value)) return *s == '\0';
+        // $symbol-symbol: a distance the assembler works out
+        const char *minus = strchr(s, '-');
+        if (!minus || !parse_displacement(s, minus, op) || !op->symbol[0] || op->value != 0) return false;
+        size_t length = strlen(minus + 1);
+        if (length == 0 || length >= ENCODER_SYMBOL_SIZE) return false;
+        for (const char *c = minus + 1; *c; c++) {
+            if (!is_symbol_char(*c)) return false;
+        }
+        memcpy(op->minus, minus + 1, length + 1);
+        return true;
+    }
+    if (*s == '%') return parse_register_at(&s, op) && *s == '\0';
+
+    const char *paren = strchr(s, '(');
+    if (!paren) {
+        // A bare number is an absolute address; anything else a symbol
+        if (!parse_displacement(s, s + strlen(s), op)) return false;
+        if (!op->symbol[0]) {
+            op->kind = OPERAND_MEM;
+            return true;
+        }
+        op->kind = op->indirect ? OPERAND_MEM : OPERAND_SYMBOL;
+        return op->kind == OPERAND_SYMBOL || op->value == 0;
+    }
+
+    op->kind = OPERAND_MEM;
+    if (!parse_displacement(s, paren, op)) return false;
+    s = paren + 1;
+    Operand reg;
+    if (*s == '%') {
+        if (strncmp(s, "%rip)", 5) == 0) {
+            op->base = REG_RIP;
+            return s[5] == '\0';
+        }
+        if (!parse_register_at(&s, &reg) || reg.size != 8) return false;
+        op->base = reg.reg;
+    }
+    if (*s == ',') {
+        s++;
+        if (!parse_register_at(&s, &reg) || reg.size != 8 || reg.reg == 4) return false;
+        op->index = reg.reg;
+        if (*s == ',') {
+            s++;
+            long scale;
+            if (!parse_number(&s, &scale) || (scale != 1 && scale != 2 && scale != 4 && scale != 8)) {
+                return false;
+            }
+            op->scale = (int)scale;
+        }
+    }
+    return s[0] == ')' && s[1] == '\0';
+}
+
+// Split "mnemonic op, op, op" into its parts; memory operands contain commas
+static int split_operands(const char *line, char *mnemonic, size_t mnemonic_size,
+                          char operands[MAX_OPERANDS][ENCODER_SYMBOL_SIZE + 32]) {
+    const char *p = line;
+    while (*p == '\t' || *p == ' ') p++;
+    size_t n = 0;
+    while (*p && !isspace((unsigned char)*p)) {
+        if (n + 1 >= mnemonic_size) return -1;
+        mnemonic[n++] = *p++;
+    }
+    mnemonic[n] = '\0';
+
+    int count = 0;
+    while (*p) {
+        while (isspace((unsigned char)*p)) p++;
+        if (!*p) break;
+        if (count == MAX_OPERANDS) return -1;
+        char *out = operands[count++];
+        size_t length = 0;
+        int depth = 0;
+        while (*p && (depth > 0 || *p != ',')) {
+            if (*p == '(') depth++;
+            if (*p == ')') depth--;
+            if (!isspace((unsigned char)*p)) {
+                if (length + 1 >= ENCODER_SYMBOL_SIZE + 32) return -1;
+                out[length++] = *p;
+            }
+            p++;
+        }
+        out[length] = '\0';
+        if (*p == ',') p++;
+    }
+    return count;
+}
+
+static int find_condition(const char *text) {
+    for (int i = 0; i < CONDITION_COUNT; i++) {
+        if (strcmp(text, conditions[i].name) == 0) return conditions[i].code;
+    }
+    return -1;
+}
+
+static bool fits_int8(long value) {
+    return value >= -128 && value <= 127;
+}
+
+static bool fits_int32(long value) {
+    return value >= -2147483648L && value <= 2147483647L;
+}
+
+// An immediate as the operation of size bytes reads it
+static long truncate_imm(long value, int size) {
+    if (size == 1) return (signed char)value;
+    if (size == 2) return (short)value;
+    if (size == 4) return (int)value;
+    return value;
+}
+
+// Operand-size suffix of a mnemonic: name is base followed by b, w, l or q.
+// Returns the size, 0 if name is base alone, or -1 if it is neither.
+static int suffix_size(const char *name, const char *base) {
+    size_t length = strlen(base);
+    if (strncmp(name, base, length) != 0) return -1;
+    const char *suffix = name + length;
+    if (!*suffix) return 0;
+    if (suffix[1]) return -1;
+    switch (*suffix) {
+    case 'b': return 1;
+    case 'w': return 2;
+    case 'l': return 4;
+    case 'q': return 8;
+    default: return -1;
+    }
+}
+
+static void encoding_init(Encoding *e) {
+    memset(e, 0, sizeof(*e));
+    e->opcode_reg = -1;
+}
+
+static void set_opcode(Encoding *e, int length, int a, int b, int c) {
+    e->opcode_length = length;
+    e->opcode[0] = (unsigned char)a;
+    e->opcode[1] = (unsigned char)b;
+    e->opcode[2] = (unsigned char)c;
+}
+
+// Operand size from a suffix: 66 for 16 bits, REX.W for 64
+static void set_size(Encoding *e, int size) {
+    if (size == 2) e->prefix = 0x66;
+    if (size == 8) e->rex_w = true;
+}
+
+static void note_byte_register(Encoding *e, const Operand *op) {
+    if (op->kind != OPERAND_REG || op->size != 1) return;
+    if (op->byte_rex) e->rex_force = true;
+    if (op->byte_high) e->rex_forbid = true;
+}
+
+static void put_bytes(EncodedInsn *out, long value, int count) {
+    for (int i = 0; i < count; i++) out->bytes[out->length++] = (unsigned char)(value >> (8 * i));
+}
+
+// Emit the ModRM byte, SIB byte and displacement of rm with reg in ModRM.reg
+static void put_modrm(EncodedInsn *out, int reg, const Operand *rm) {
+    int r = reg & 7;
+    if (rm->kind == OPERAND_REG) {
+        out->bytes[out->length++] = (unsigned char)(0xc0 | r << 3 | (rm->reg & 7));
+        return;
+    }
+    if (rm->base == REG_RIP) {
+        out->bytes[out->length++] = (unsigned char)(0x05 | r << 3);
+        if (rm->symbol[0]) {
+            out->fixup = ENCODE_PC32;
+            memcpy(out->symbol, rm->symbol, sizeof(out->symbol));
+            out->offset = out->length;
+            out->addend = rm->value;
+            put_bytes(out, 0, 4);
+        } else {
+            put_bytes(out, rm->value, 4);
+        }
+        return;
+    }
+    if (rm->base < 0) {
+        // No base: a disp32, with the index in a SIB byte or absolute
+        if (rm->index >= 0) {
+            int scale = rm->scale == 1 ? 0 : rm->scale == 2 ? 1 : rm->scale == 4 ? 2 : 3;
+            out->bytes[out->length++] = (unsigned char)(0x04 | r << 3);
+            out->bytes[out->length++] = (unsigned char)(scale << 6 | (rm->index & 7) << 3 | 5);
+        } else {
+            out->bytes[out->length++] = (unsigned char)(0x04 | r << 3);
+            out->bytes[out->length++] = 0x25;
+        }
+        put_bytes(out, rm->value, 4);
+        return;
+    }
+
+    // Zero displacements are dropped, except where mod 00 means something
+    // else for the base (%rbp and %r13)
+    int mod = rm->value == 0 && (rm->base & 7) != 5 ? 0 : fits_int8(rm->value) ? 1 : 2;
+    if (rm->index >= 0 || (rm->base & 7) == 4) {
+        int scale = rm->scale == 1 ? 0 : rm->scale == 2 ? 1 : rm->scale == 4 ? 2 : 3;
+        int index = rm->index >= 0 ? rm->index & 7 : 4;
+        out->bytes[out->length++] = (unsigned char)(mod << 6 | r << 3 | 4);
+        out->bytes[out->length++] = (unsigned char)(scale << 6 | index << 3 | (rm->base & 7));
+    } else {
+        out->bytes[out->length++] = (unsigned char)(mod << 6 | r << 3 | (rm->base & 7));
+    }
+    if (mod == 1) put_bytes(out, rm->value, 1);
+    if (mod == 2) put_bytes(out, rm->value, 4);
+}
+
+static bool finish(const Encoding *e, EncodedInsn *out) {
+    int rex_r = e->has_modrm && e->reg >= 8;
+    int rex_x = 0;
+    int rex_b = 0;
+    if (e->opcode_reg >= 0) rex_b = e->opcode_reg >= 8;
+    if (e->has_modrm && e->rm->kind == OPERAND_REG) rex_b = e->rm->reg >= 8;
+    if (e->has_modrm && e->rm->kind == OPERAND_MEM) {
+        rex_x = e->rm->index >= 8;
+        rex_b = e->rm->base >= 8 && e->rm->base != REG_RIP;
+    }
+
+    out->length = 0;
+    if (e->vex) {
+        if (e->vex_map == 1 && !e->rex_w && !rex_x && !rex_b) {
+            out->bytes[out->length++] = 0xc5;
+            out->bytes[out->length++] = (unsigned char)(!rex_r << 7 | (~e->vvvv & 15) << 3 |
+                                                        e->vex_l << 2 | e->vex_pp);
+        } else {
+            out->bytes[out->length++] = 0xc4;
+            out->bytes[out->length++] = (unsigned char)(!rex_r << 7 | !rex_x << 6 | !rex_b << 5 | e->vex_map);
+            out->bytes[out->length++] = (unsigned char)(e->rex_w << 7 | (~e->vvvv & 15) << 3 |
+                                                        e->vex_l << 2 | e->vex_pp);
+        }
+    } else {
+        if (e->prefix) out->bytes[out->length++] = (unsigned char)e->prefix;
+        bool rex = e->rex_w || rex_r || rex_x || rex_b || e->rex_force;
+        if (rex && e->rex_forbid) return false;
+        if (rex) out->bytes[out->length++] = (unsigned char)(0x40 | e->rex_w << 3 | rex_r << 2 | rex_x << 1 | rex_b);
+    }
+    for (int i = 0; i < e->opcode_length; i++) {
+        unsigned char byte = e->opcode[i];
+        if (i == e->opcode_length - 1 && e->opcode_reg >= 0) byte |= e->opcode_reg & 7;
+        out->bytes[out->length++] = byte;
+    }
+    if (e->has_modrm) put_modrm(out, e->reg, e->rm);
+    if (e->imm_symbol) {
+        out->fixup = ENCODE_IMM32;
+        memcpy(out->symbol, e->imm_symbol->symbol, sizeof(out->symbol));
+        memcpy(out->minus, e->imm_symbol->minus, sizeof(out->minus));
+        out->offset = out->length;
+        out->addend = 0;
+    }
+    put_bytes(out, e->imm, e->imm_size);
+    // rel32 is relative to the end of the instruction
+    if (out->fixup == ENCODE_PC32) out->addend -= out->length - out->offset;
+    return true;
+}
+
+static bool is_gpr(const Operand *op) {
+    return op->kind == OPERAND_REG && op->size <= 8;
+}
+
+static bool is_vector(const Operand *op) {
+    return op->kind == OPERAND_REG && op->size >= 16;
+}
+
+static bool is_rm(const Operand *op) {
+    return is_gpr(op) || op->kind == OPERAND_MEM;
+}
+
+static bool is_vector_rm(const Operand *op) {
+    return is_vector(op) || op->kind == OPERAND_MEM;
+}
+
+// Size of the operation from its suffix, or else from its register operands
+static int operation_size(int suffix, const Operand *ops, int count) {
+    if (suffix > 0) return suffix;
+    for (int i = count - 1; i >= 0; i--) {
+        if (is_gpr(&ops[i])) return ops[i].size;
+    }
+    return 0;
+}
+
+static bool encode_alu(Encoding *e, int op, int size, Operand *ops, int count) {
+    if (count != 2 || !is_rm(&ops[1])) return false;
+    Operand *src = &ops[0], *dst = &ops[1];
+    set_size(e, size);
+    if (src->kind == OPERAND_IMM) {
+        long imm = truncate_imm(src->value, size);
+        if (size == 8 && !fits_int32(imm)) return false;
+        if (size == 1) {
+            if (dst->kind == OPERAND_REG && dst->reg == 0 && !dst->byte_high) {
+                set_opcode(e, 1, 0x04 + 8 * op, 0, 0);
+                e->imm_size = 1;
+                e->imm = imm;
+                return true;
+            }
+            set_opcode(e, 1, 0x80, 0, 0);
+            e->imm_size = 1;
+        } else if (fits_int8(imm)) {
+            set_opcode(e, 1, 0x83, 0, 0);
+            e->imm_size = 1;
+        } else if (dst->kind == OPERAND_REG && dst->reg == 0) {
+            set_opcode(e, 1, 0x05 + 8 * op, 0, 0);
+            e->imm_size = size == 2 ? 2 : 4;
+            e->imm = imm;
+            return true;
+        } else {
+            set_opcode(e, 1, 0x81, 0, 0);
+            e->imm_size = size == 2 ? 2 : 4;
+        }
+        e->imm = imm;
+        e->has_modrm = true;
+        e->reg = op;
+        e->rm = dst;
+        return true;
+    }
+    e->has_modrm = true;
+    if (is_gpr(src)) {
+        set_opcode(e, 1, (size == 1 ? 0x00 : 0x01) + 8 * op, 0, 0);
+        e->reg = src->reg;
+        e->rm = dst;
+        return true;
+    }
+    if (src->kind == OPERAND_MEM && is_gpr(dst)) {
+        set_opcode(e, 1, (size == 1 ? 0x02 : 0x03) + 8 * op, 0, 0);
+        e->reg = dst->reg;
+        e->rm = src;
+        return true;
+    }
+    return false;
+}
+
+static bool encode_mov(Encoding *e, int size, Operand *ops, int count, bool movabs) {
+    if (count != 2) return false;
+    Operand *src = &ops[0], *dst = &ops[1];
+    set_size(e, size);
+    if (src->kind == OPERAND_IMM && src->symbol[0]) {
+        // Value unknown until layout: always an imm32, as with gas
+        if (movabs || size < 4 || !is_rm(dst)) return false;
+        if (size == 4 && is_gpr(dst)) {
+            set_opcode(e, 1, 0xb8, 0, 0);
+            e->opcode_reg = dst->reg;
+        } else {
+            set_opcode(e, 1, 0xc7, 0, 0);
+            e->has_modrm = true;
+            e->reg = 0;
+            e->rm = dst;
+        }
+        e->imm_size = 4;
+        e->imm_symbol = src;
+        return true;
+    }
+    if (src->kind == OPERAND_IMM) {
+        long imm = truncate_imm(src->value, size);
+        if (is_gpr(dst) && (size != 8 || movabs || !fits_int32(imm))) {
+            // mov $imm, %reg: b0 or b8 plus the register, imm of the full size
+            set_opcode(e, 1, size == 1 ? 0xb0 : 0xb8, 0, 0);
+            e->opcode_reg = dst->reg;
+            e->imm_size = size;
+            e->imm = imm;
+            return true;
+        }
+        if (movabs || !is_rm(dst) || (size == 8 && !fits_int32(imm))) return false;
+        set_opcode(e, 1, size == 1 ? 0xc6 : 0xc7, 0, 0);
+        e->has_modrm = true;
+        e->reg = 0;
+        e->rm = dst;
+        e->imm_size = size == 1 ? 1 : size == 2 ? 2 : 4;
+        e->imm = imm;
+        return true;
+    }
+    if (movabs) return false;
+    e->has_modrm = true;
+    if (is_gpr(src) && is_rm(dst)) {
+        set_opcode(e, 1, size == 1 ? 0x88 : 0x89, 0, 0);
+        e->reg = src->reg;
+        e->rm = dst;
+        return true;
+    }
+    if (src->kind == OPERAND_MEM && is_gpr(dst)) {
+        set_opcode(e, 1, size == 1 ? 0x8a : 0x8b, 0, 0);
+        e->reg = dst->reg;
+        e->rm = src;
+        return true;
+    }
+    return false;
+}
+
+static bool encode_test(Encoding *e, int size, Operand *ops, int count) {
+    if (count != 2 || !is_rm(&ops[1])) return false;
+    Operand *src = &ops[0], *dst = &ops[1];
+    set_size(e, size);
+    if (src->kind == OPERAND_IMM) {
+        long imm = truncate_imm(src->value, size);
+        if (size == 8 && !fits_int32(imm)) return false;
+        e->imm = imm;
+        e->imm_size = size == 1 ? 1 : size == 2 ? 2 : 4;
+        if (dst->kind == OPERAND_REG && dst->reg == 0 && !dst->byte_high) {
+            set_opcode(e, 1, size == 1 ? 0xa8 : 0xa9, 0, 0);
+            return true;
+        }
+        set_opcode(e, 1, size == 1 ? 0xf6 : 0xf7, 0, 0);
+        e->has_modrm = true;
+        e->reg = 0;
+        e->rm = dst;
+        return true;
+    }
+    if (!is_gpr(src)) return false;
+    set_opcode(e, 1, size == 1 ? 0x84 : 0x85, 0, 0);
+    e->has_modrm = true;
+    e->reg = src->reg;
+    e->rm = dst;
+    return true;
+}
+
+static bool encode_shift(Encoding *e, int digit, int size, Operand *ops, int count) {
+    Operand *dst = &ops[count - 1];
+    if (count < 1 || count > 2 || !is_rm(dst)) return false;
+    set_size(e, size);
+    e->has_modrm = true;
+    e->reg = digit;
+    e->rm = dst;
+    if (count == 1 || (ops[0].kind == OPERAND_IMM && ops[0].value == 1)) {
+        set_opcode(e, 1, size == 1 ? 0xd0 : 0xd1, 0, 0);
+    } else if (ops[0].kind == OPERAND_IMM) {
+        set_opcode(e, 1, size == 1 ? 0xc0 : 0xc1, 0, 0);
+        e->imm_size = 1;
+        e->imm = ops[0].value;
+    } else if (ops[0].kind == OPERAND_REG && ops[0].size == 1 && ops[0].reg == 1) {
+        set_opcode(e, 1, size == 1 ? 0xd2 : 0xd3, 0, 0);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool encode_imul(Encoding *e, int size, Operand *ops, int count) {
+    if (count == 1) return false;   // The one-operand form is a unary op
+    if (size == 1 || !is_gpr(&ops[count - 1])) return false;
+    set_size(e, size);
+    e->has_modrm = true;
+    e->reg = ops[count - 1].reg;
+    if (count == 2 && is_rm(&ops[0])) {
+        set_opcode(e, 2, 0x0f, 0xaf, 0);
+        e->rm = &ops[0];
+        return true;
+    }
+    if (ops[0].kind != OPERAND_IMM) return false;
+    // imul $imm, src, dst; with two operands the source is dst
+    e->rm = &ops[1];
+    if (!is_rm(e->rm)) return false;
+    long imm = truncate_imm(ops[0].value, size);
+    if (fits_int8(imm)) {
+        set_opcode(e, 1, 0x6b, 0, 0);
+        e->imm_size = 1;
+    } else {
+        set_opcode(e, 1, 0x69, 0, 0);
+        e->imm_size = size == 2 ? 2 : 4;
+    }
+    e->imm = imm;
+    return true;
+}
+
+// The vector operations: legacy SSE encodings, or VEX ones for the v forms
+static bool encode_vector(Encoding *e, const char *name, Operand *ops, int count) {
+    bool vex = name[0] == 'v' && strcmp(name, "vzeroupper") != 0;
+    const char *base = vex ? name + 1 : name;
+    Operand *dst = &ops[count - 1];
+    e->vex = vex;
+    e->vex_map = 1;
+
+    if (strcmp(name, "vzeroupper") == 0) {
+        if (count != 0) return false;
+        e->vex = true;
+        set_opcode(e, 1, 0x77, 0, 0);
+        return true;
+    }
+
+    // movd and movq between general-purpose and vector registers
+    if ((strcmp(base, "movd") == 0 || strcmp(base, "movq") == 0) && count == 2) {
+        bool wide = base[3] == 'q';
+        e->prefix = 0x66;
+        e->vex_pp = 1;
+        e->rex_w = wide;
+        e->has_modrm = true;
+        if (is_vector(dst) && dst->size == 16 && (is_rm(&ops[0]))) {
+            set_opcode(e, 2, 0x0f, 0x6e, 0);
+            e->reg = dst->reg;
+            e->rm = &ops[0];
+        } else if (is_vector(&ops[0]) && ops[0].size == 16 && is_rm(dst)) {
+            set_opcode(e, 2, 0x0f, 0x7e, 0);
+            e->reg = ops[0].reg;
+            e->rm = dst;
+        } else {
+            return false;
+        }
+        if (vex) set_opcode(e, 1, e->opcode[1], 0, 0);
+        return true;
+    }
+
+    if ((strcmp(base, "movdqa") == 0 || strcmp(base, "movdqu") == 0) && count == 2) {
+        bool aligned = base[5] == 'a';
+        e->prefix = aligned ? 0x66 : 0xf3;
+        e->vex_pp = aligned ? 1 : 2;
+        e->has_modrm = true;
+        if (is_vector(dst) && is_vector_rm(&ops[0])) {
+            set_opcode(e, 2, 0x0f, 0x6f, 0);
+            e->reg = dst->reg;
+            e->rm = &ops[0];
+            e->vex_l = dst->size == 32;
+        } else if (is_vector(&ops[0]) && dst->kind == OPERAND_MEM) {
+            set_opcode(e, 2, 0x0f, 0x7f, 0);
+            e->reg = ops[0].reg;
+            e->rm = dst;
+            e->vex_l = ops[0].size == 32;
+        } else {
+            return false;
+        }
+        if (!vex && e->vex_l) return false;
+        if (vex) set_opcode(e, 1, e->opcode[1], 0, 0);
+        return true;
+    }
+
+    if (strcmp(base, "pshufd") == 0) {
+        if (count != 3 || ops[0].kind != OPERAND_IMM || !is_vector(dst) || !is_vector_rm(&ops[1])) return false;
+        e->prefix = 0x66;
+        e->vex_pp = 1;
+        e->vex_l = dst->size == 32;
+        set_opcode(e, vex ? 1 : 2, vex ? 0x70 : 0x0f, 0x70, 0);
+        e->has_modrm = true;
+        e->reg = dst->reg;
+        e->rm = &ops[1];
+        e->imm_size = 1;
+        e->imm = ops[0].value;
+        return vex || !e->vex_l;
+    }
+
+    if (vex && strcmp(base, "pbroadcastd") == 0) {
+        if (count != 2 || !is_vector(dst) || !is_vector_rm(&ops[0])) return false;
+        if (is_vector(&ops[0]) && ops[0].size != 16) return false;
+        e->vex_map = 2;
+        e->vex_pp = 1;
+        e->vex_l = dst->size == 32;
+        set_opcode(e, 1, 0x58, 0, 0);
+        e->has_modrm = true;
+        e->reg = dst->reg;
+        e->rm = &ops[0];
+        return true;
+    }
+
+    if (vex && strcmp(base, "extracti128") == 0) {
+        if (count != 3 || ops[0].kind != OPERAND_IMM || !is_vector(&ops[1]) || ops[1].size != 32) return false;
+        if (!(is_vector(dst) && dst->size == 16) && dst->kind != OPERAND_MEM) return false;
+        e->vex_map = 3;
+        e->vex_pp = 1;
+        e->vex_l = 1;
+        set_opcode(e, 1, 0x39, 0, 0);
+        e->has_modrm = true;
+        e->reg = ops[1].reg;
+        e->rm = dst;
+        e->imm_size = 1;
+        e->imm = ops[0].value;
+        return true;
+    }
+
+    for (int i = 0; i < COUNT(vector_shifts); i++) {
+        if (strcmp(base, vector_shifts[i].name) != 0) continue;
+        if (count != (vex ? 3 : 2) || ops[0].kind != OPERAND_IMM || !is_vector(dst)) return false;
+        if (vex && (!is_vector(&ops[1]) || ops[1].size != dst->size)) return false;
+        e->prefix = 0x66;
+        e->vex_pp = 1;
+        e->vex_l = dst->size == 32;
+        if (vex) e->vvvv = dst->reg;
+        set_opcode(e, vex ? 1 : 2, vex ? vector_shifts[i].opcode : 0x0f, vector_shifts[i].opcode, 0);
+        e->has_modrm = true;
+        e->reg = vector_shifts[i].digit;
+        e->rm = vex ? &ops[1] : dst;
+        e->imm_size = 1;
+        e->imm = ops[0].value;
+        return vex || !e->vex_l;
+    }
+
+    for (int i = 0; i < COUNT(vector_ops); i++) {
+        if (strcmp(base, vector_ops[i].name) != 0) continue;
+        if (count != (vex ? 3 : 2) || !is_vector(dst) || !is_vector_rm(&ops[0])) return false;
+        e->prefix = 0x66;
+        e->vex_pp = 1;
+        e->vex_l = dst->size == 32;
+        e->has_modrm = true;
+        e->reg = dst->reg;
+        e->rm = &ops[0];
+        if (vex) {
+            if (!is_vector(&ops[1]) || ops[1].size != dst->size) return false;
+            e->vvvv = ops[1].reg;
+            e->vex_map = vector_ops[i].map;
+            set_opcode(e, 1, vector_ops[i].opcode, 0, 0);
+            return true;
+        }
+        if (e->vex_l) return false;
+        if (vector_ops[i].map == 2) {
+            set_opcode(e, 3, 0x0f, 0x38, vector_ops[i].opcode);
+        } else {
+            set_opcode(e, 2, 0x0f, vector_ops[i].opcode, 0);
+        }
+        return true;
+    }
+    return false;
+}
+
+static bool encode_operation(const char *name, Operand *ops, int count, Encoding *e, EncodedInsn *out) {
+    static const struct {
+        const char *name;
+        unsigned char bytes[3];
+        int length;
+    } fixed[] = {
+        {"ret", {0xc3}, 1}, {"leave", {0xc9}, 1}, {"syscall", {0x0f, 0x05}, 2},
+        {"cltd", {0x99}, 1}, {"cqto", {0x48, 0x99}, 2}, {"cqo", {0x48, 0x99}, 2},
+        {"cltq", {0x48, 0x98}, 2}, {"cwtl", {0x98}, 1}, {"nop", {0x90}, 1},
+        {"ud2", {0x0f, 0x0b}, 2}, {"hlt", {0xf4}, 1},
+    };
+    for (int i = 0; i < COUNT(fixed); i++) {
+        if (strcmp(name, fixed[i].name) == 0) {
+            if (count != 0) return false;
+            set_opcode(e, fixed[i].length, fixed[i].bytes[0], fixed[i].bytes[1], fixed[i].bytes[2]);
+            return true;
+        }
+    }
+
+    // Branches: to a symbol they are left to the assembler
+    bool is_jmp = strcmp(name, "jmp") == 0;
+    bool is_call = strcmp(name, "call") == 0 || strcmp(name, "callq") == 0;
+    int condition = name[0] == 'j' && !is_jmp ? find_condition(name + 1) : -1;
+    if (is_jmp || is_call || condition >= 0) {
+        if (count != 1) return false;
+        if (ops[0].kind == OPERAND_SYMBOL) {
+            out->fixup = is_call ? ENCODE_CALL : ENCODE_JUMP;
+            out->condition = condition;
+            snprintf(out->symbol, sizeof(out->symbol), "%s", ops[0].symbol);
+            out->addend = ops[0].value;
+            if (is_call) {
+                out->bytes[0] = 0xe8;
+                out->offset = 1;
+                out->length = 5;
+                memset(out->bytes + 1, 0, 4);
+                out->addend -= 4;
+            }
+            return true;
+        }
+        if (condition >= 0 || !ops[0].indirect || !(is_rm(&ops[0]))) return false;
+        if (ops[0].kind == OPERAND_REG && ops[0].size != 8) return false;
+        set_opcode(e, 1, 0xff, 0, 0);
+        e->has_modrm = true;
+        e->reg = is_call ? 2 : 4;
+        e->rm = &ops[0];
+        return true;
+    }
+
+    if (strncmp(name, "set", 3) == 0 && find_condition(name + 3) >= 0) {
+        if (count != 1 || !is_rm(&ops[0]) || (ops[0].kind == OPERAND_REG && ops[0].size != 1)) return false;
+        set_opcode(e, 2, 0x0f, 0x90 + find_condition(name + 3), 0);
+        note_byte_register(e, &ops[0]);
+        e->has_modrm = true;
+        e->reg = 0;
+        e->rm = &ops[0];
+        return true;
+    }
+
+    if (strncmp(name, "cmov", 4) == 0) {
+        // cmov<cond><suffix>, or cmov<cond> sized by its registers
+        const char *rest = name + 4;
+        size_t length = strlen(rest);
+        char cond[8];
+        int code = -1;
+        int size = 0;
+        if (length > 1 && length < sizeof(cond) && strchr("wlq", rest[length - 1])) {
+            memcpy(cond, rest, length - 1);
+            cond[length - 1] = '\0';
+            code = find_condition(cond);
+            size = rest[length - 1] == 'w' ? 2 : rest[length - 1] == 'l' ? 4 : 8;
+        }
+        if (code < 0) {
+            code = find_condition(rest);
+            size = 0;
+        }
+        if (code < 0 || count != 2 || !is_gpr(&ops[1]) || !is_rm(&ops[0])) return false;
+        size = operation_size(size, ops, count);
+        if (size < 2) return false;
+        set_size(e, size);
+        set_opcode(e, 2, 0x0f, 0x40 + code, 0);
+        e->has_modrm = true;
+        e->reg = ops[1].reg;
+        e->rm = &ops[0];
+        return true;
+    }
+
+    for (int i = 0; i < COUNT(extensions); i++) {
+        if (strcmp(name, extensions[i].name) != 0) continue;
+        if (count != 2 || !is_rm(&ops[0]) || !is_gpr(&ops[1]) || ops[1].size != extensions[i].to) return false;
+        if (ops[0].kind == OPERAND_REG && ops[0].size != extensions[i].from) return false;
+        set_size(e, extensions[i].to);
+        if (extensions[i].opcode == 0x63) {
+            set_opcode(e, 1, 0x63, 0, 0);
+        } else {
+            set_opcode(e, 2, 0x0f, extensions[i].opcode, 0);
+        }
+        note_byte_register(e, &ops[0]);
+        e->has_modrm = true;
+        e->reg = ops[1].reg;
+        e->rm = &ops[0];
+        return true;
+    }
+
+    if (strcmp(name, "movabsq") == 0 || strcmp(name, "movabs") == 0) {
+        if (count != 2 || !is_gpr(&ops[1]) || ops[1].size != 8) return false;
+        return encode_mov(e, 8, ops, count, true);
+    }
+
+    // Vector moves and operations; movd and movq take general registers too
+    bool vector_move = (strcmp(name, "movq") == 0 || strcmp(name, "movd") == 0) &&
+                       count == 2 && (is_vector(&ops[0]) || is_vector(&ops[1]));
+    if (vector_move || name[0] == 'p' || name[0] == 'v' || strncmp(name, "movdq", 5) == 0) {
+        if (encode_vector(e, name, ops, count)) return true;
+        if (name[0] == 'v' || vector_move || strncmp(name, "movdq", 5) == 0) return false;
+        encoding_init(e);   // push and pop
+    }
+
+    int size;
+    for (int i = 0; i < COUNT(alu_names); i++) {
+        if ((size = suffix_size(name, alu_names[i])) >= 0) {
+            size = operation_size(size, ops, count);
+            for (int k = 0; k < count; k++) note_byte_register(e, &ops[k]);
+            return size > 0 && encode_alu(e, i, size, ops, count);
+        }
+    }
+    if ((size = suffix_size(name, "mov")) >= 0) {
+        size = operation_size(size, ops, count);
+        for (int k = 0; k < count; k++) note_byte_register(e, &ops[k]);
+        return size > 0 && encode_mov(e, size, ops, count, false);
+    }
+    if ((size = suffix_size(name, "test")) >= 0) {
+        size = operation_size(size, ops, count);
+        for (int k = 0; k < count; k++) note_byte_register(e, &ops[k]);
+        return size > 0 && encode_test(e, size, ops, count);
+    }
+    if ((size = suffix_size(name, "lea")) >= 0) {
+        size = operation_size(size, ops, count);
+        if (count != 2 || ops[0].kind != OPERAND_MEM || !is_gpr(&ops[1]) || size < 2) return false;
+        set_size(e, size);
+        set_opcode(e, 1, 0x8d, 0, 0);
+        e->has_modrm = true;
+        e->reg = ops[1].reg;
+        e->rm = &ops[0];
+        return true;
+    }
+    for (int i = 0; i < COUNT(shift_ops); i++) {
+        if ((size = suffix_size(name, shift_ops[i].name)) >= 0) {
+            size = operation_size(size, ops, count);
+            if (count > 0) note_byte_register(e, &ops[count - 1]);
+            return size > 0 && encode_shift(e, shift_ops[i].digit, size, ops, count);
+        }
+    }
+    if ((size = suffix_size(name, "imul")) >= 0 && count > 1) {
+        return encode_imul(e, operation_size(size, ops, count), ops, count);
+    }
+    for (int i = 0; i < COUNT(unary_ops); i++) {
+        if ((size = suffix_size(name, unary_ops[i].name)) >= 0) {
+            size = operation_size(size, ops, count);
+            if (count != 1 || !is_rm(&ops[0]) || size == 0) return false;
+            note_byte_register(e, &ops[0]);
+            set_size(e, size);
+            set_opcode(e, 1, unary_ops[i].opcode - (size == 1), 0, 0);
+            e->has_modrm = true;
+            e->reg = unary_ops[i].digit;
+            e->rm = &ops[0];
+            return true;
+        }
+    }
+    if ((size = suffix_size(name, "bt")) >= 0) {
+        size = operation_size(size, ops, count);
+        if (count != 2 || !is_rm(&ops[1]) || size < 2) return false;
+        set_size(e, size);
+        e->has_modrm = true;
+        e->rm = &ops[1];
+        if (ops[0].kind == OPERAND_IMM) {
+            set_opcode(e, 2, 0x0f, 0xba, 0);
+            e->reg = 4;
+            e->imm_size = 1;
+            e->imm = ops[0].value;
+            return true;
+        }
+        if (!is_gpr(&ops[0])) return false;
+        set_opcode(e, 2, 0x0f, 0xa3, 0);
+        e->reg = ops[0].reg;
+        return true;
+    }
+    if (strcmp(name, "pushq") == 0 || strcmp(name, "push") == 0 ||
+        strcmp(name, "popq") == 0 || strcmp(name, "pop") == 0) {
+        bool push = name[1] == 'u';
+        if (count != 1) return false;
+        if (is_gpr(&ops[0])) {
+            if (ops[0].size != 8) return false;
+            set_opcode(e, 1, push ? 0x50 : 0x58, 0, 0);
+            e->opcode_reg = ops[0].reg;
+            return true;
+        }
+        if (push && ops[0].kind == OPERAND_IMM) {
+            bool short_imm = fits_int8(ops[0].value);
+            if (!fits_int32(ops[0].value)) return false;
+            set_opcode(e, 1, short_imm ? 0x6a : 0x68, 0, 0);
+            e->imm_size = short_imm ? 1 : 4;
+            e->imm = ops[0].value;
+            return true;
+        }
+        if (ops[0].kind != OPERAND_MEM) return false;
+        set_opcode(e, 1, push ? 0xff : 0x8f, 0, 0);
+        e->has_modrm = true;
+        e->reg = push ? 6 : 0;
+        e->rm = &ops[0];
+        return true;
+    }
+    return false;
+}
+
+bool encode_insn(const char *line, EncodedInsn *out, char *error, int error_size) {
+    char name[32];
+    char texts[MAX_OPERANDS][ENCODER_SYMBOL_SIZE + 32];
+    Operand ops[MAX_OPERANDS];
+
+    out->length = 0;
+    out->fixup = ENCODE_NONE;
+    out->symbol[0] = '\0';
+    out->minus[0] = '\0';
+    out->addend = 0;
+    out->offset = 0;
+    out->condition = -1;
+
+    int count = split_operands(line, name, sizeof(name), texts);
+    if (count < 0) {
+        set_error(error, error_size, "malformed instruction", line);
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        if (!parse_operand(texts[i], &ops[i])) {
+            set_error(error, error_size, "bad operand", line);
+            return false;
+        }
+        // Only branches take bare symbols and indirect operands, and only
+        // mov symbolic immediates
+        if (ops[i].kind == OPERAND_IMM && ops[i].symbol[0] && strcmp(name, "movl") != 0 && strcmp(name, "movq") != 0) {
+            set_error(error, error_size, "bad operand", line);
+            return false;
+        }
+        if ((ops[i].kind == OPERAND_SYMBOL || ops[i].indirect) && name[0] != 'j' && strncmp(name, "call", 4) != 0) {
+            set_error(error, error_size, "bad operand", line);
+            return false;
+        }
+    }
+
+    Encoding e;
+    encoding_init(&e);
+    if (!encode_operation(name, ops, count, &e, out)) {
+        set_error(error, error_size, "cannot encode", line);
+        return false;
+    }
+    if (out->fixup == ENCODE_JUMP || out->fixup == ENCODE_CALL) return true;
+    if (!finish(&e, out)) {
+        set_error(error, error_size, "cannot encode", line);
+        return false;
+    }
+    return true;
+}
+
+int encode_jump(int condition, bool near, long displacement, unsigned char *out) {
+    int length = 0;
+    if (!near) {
+        out[length++] = (unsigned char)(condition < 0 ? 0xeb : 0x70 + condition);
+        out[length++] = (unsigned char)displacement;
+        return length;
+    }
+    if (condition < 0) {
+        out[length++] = 0xe9;
+    } else {
+        out[length++] = 0x0f;
+        out[length++] = (unsigned char)(0x80 + condition);
+    }
+    for (int i = 0; i < 4; i++) out[length++] = (unsigned char)(displacement >> (8 * i));
+    return length;
+}
+
+void encode_nops(unsigned char *out, int length) {
+    // The longest nop GNU as uses in 64-bit code is 11 bytes; longer
+    // padding is a run of those, the remainder last
+    static const unsigned char nops[11][11] = {
+        {0x90},
+        {0x66, 0x90},
+        {0x0f, 0x1f, 0x00},
+        {0x0f, 0x1f, 0x40, 0x00},
+        {0x0f, 0x1f, 0x44, 0x00, 0x00},
+        {0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00},
+        {0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00},
+        {0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    };
+    while (length > 0) {
+        int chunk = length > 11 ? 11 : length;
+        memcpy(out, nops[chunk - 1], chunk);
+        out += chunk;
+        length -= chunk;
+    }
+}
\ No newline at end of file
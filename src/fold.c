@@ -0,0 +1,329 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fold.h>
+
+static int fold_block(ASTNode *block);
+
+bool fold_operation(const ASTNode *node, long left, long right, long *result) {
+    TypeKind type = node->data.binary_op.left->value_type;
+    bool is_signed = type_is_signed(type);
+    unsigned long a = left, b = right;
+
+    switch (node->data.binary_op.operator) {
+        case '+':
+        case '-':
+        case '*': {
+            char op = node->data.binary_op.operator;
+            bool overflow = op == '+' ? __builtin_add_overflow(left, right, result)
+                          : op == '-' ? __builtin_sub_overflow(left, right, result)
+                                      : __builtin_mul_overflow(left, right, result);
+            if (!is_signed) {
+                *result = type_convert((long)(op == '+' ? a + b : op == '-' ? a - b : a * b), type);
+            } else if (overflow || type_convert(*result, type) != *result) {
+                return false;
+            }
+            break;
+        }
+        case '/':
+            if (right == 0) return false;
+            if (is_signed) {
+                if (left == LONG_MIN && right == -1) return false;
+                *result = left / right;
+                if (type_convert(*result, type) != *result) return false;
+            } else {
+                *result = (long)(a / b);
+            }
+            break;
+        case '<': *result = is_signed ? left < right : a < b; break;
+        case '>': *result = is_signed ? left > right : a > b; break;
+        case 'L': *result = is_signed ? left <= right : a <= b; break;
+        case 'G': *result = is_signed ? left >= right : a >= b; break;
+        case 'E': *result = left == right; break;
+        case 'N': *result = left != right; break;
+        case 'A': *result = left && right; break;
+        case 'O': *result = left || right; break;
+        default:  return false;
+    }
+    return true;
+}
+
+bool fold_constant(const ASTNode *node, long *value) {
+    long left, right;
+
+    switch (node->type) {
+        case NODE_NUMBER:
+            *value = node->data.number.value;
+            return true;
+        case NODE_BINARY_OP:
+            if (!fold_constant(node->data.binary_op.left, &left) ||
+                !fold_constant(node->data.binary_op.right, &right)) {
+                return false;
+            }
+            return fold_operation(node, left, right, value);
+        case NODE_UNARY_OP:
+            if (!fold_constant(node->data.unary_op.operand, &left)) return false;
+            if (node->data.unary_op.operator == 'C') {
+                *value = type_convert(left, node->value_type);
+                return true;
+            }
+            if (node->data.unary_op.operator != '!') return false;
+            *value = !left;
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool has_side_effects(const ASTNode *node) {
+    if (!node) return false;
+
+    switch (node->type) {
+        case NODE_BINARY_OP:
+            return node->data.binary_op.operator == '=' ||
+                   has_side_effects(node->data.binary_op.left) ||
+                   has_side_effects(node->data.binary_op.right);
+        case NODE_UNARY_OP:
+            return has_side_effects(node->data.unary_op.operand);
+        case NODE_INDEX:
+            return has_side_effects(node->data.index.index);
+        case NODE_SELECT:
+            return has_side_effects(node->data.select.condition) ||
+                   has_side_effects(node->data.select.if_true) ||
+                   has_side_effects(node->data.select.if_false);
+        case NODE_CALL:
+        case NODE_INLINE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Already 0 or 1
+static bool is_truth_value(const ASTNode *node) {
+    if (node->type == NODE_UNARY_OP) return node->data.unary_op.operator == '!';
+    return node->type == NODE_BINARY_OP && strchr("<>LGENAO", node->data.binary_op.operator);
+}
+
+// Replace *slot by one of its children, detached first so it survives
+static int replace(ASTNode **slot, ASTNode **child) {
+    ASTNode *kept = *child;
+    *child = NULL;
+    ast_free(*slot);
+    *slot = kept;
+    return 1;
+}
+
+// The number has the type of the expression it replaces
+static int replace_with_number(ASTNode **slot, long value) {
+    ASTNode *number = ast_create_number(value);
+    if (!number) return 0;
+    number->value_type = (*slot)->value_type;
+    ast_free(*slot);
+    *slot = number;
+    return 1;
+}
+
+// Simplifications that need only one operand to be a literal
+static int simplify_binary(ASTNode **slot) {
+    ASTNode *node = *slot;
+    char op = node->data.binary_op.operator;
+    ASTNode **left = &node->data.binary_op.left;
+    ASTNode **right = &node->data.binary_op.right;
+    long value;
+
+    if ((op == 'A' || op == 'O') && fold_constant(*left, &value)) {
+        // Either the left side decides, or the result is the truth of the right
+        if ((op == 'A' && !value) || (op == 'O' && value)) return replace_with_number(slot, op == 'O');
+        if (is_truth_value(*right)) return replace(slot, right);
+
+        ASTNode *zero = ast_create_number(0);
+        if (!zero) return 0;
+        zero->value_type = (*right)->value_type;
+        ast_free(*left);
+        *left = *right;
+        *right = zero;
+        node->data.binary_op.operator = 'N';
+        return 1;
+    }
+
+    if (fold_constant(*right, &value)) {
+        if ((value == 0 && (op == '+' || op == '-')) || (value == 1 && (op == '*' || op == '/'))) {
+            return replace(slot, left);
+        }
+        if (value == 0 && op == '*' && !has_side_effects(*left)) return replace_with_number(slot, 0);
+    }
+    if (fold_constant(*left, &value)) {
+        if ((value == 0 && op == '+') || (value == 1 && op == '*')) return replace(slot, right);
+        if (value == 0 && op == '*' && !has_side_effects(*right)) return replace_with_number(slot, 0);
+    }
+    return 0;
+}
+
+static int fold_expression(ASTNode **slot) {
+    ASTNode *node = *slot;
+    if (!node) return 0;
+
+    int folded = 0;
+    long value;
+    switch (node->type) {
+        case NODE_BINARY_OP:
+            if (node->data.binary_op.operator != '=' ||
+                node->data.binary_op.left->type == NODE_INDEX) {
+                folded += fold_expression(&node->data.binary_op.left);
+            }
+            folded += fold_expression(&node->data.binary_op.right);
+            if (node->data.binary_op.operator == '=') break;
+            if (fold_constant(node, &value)) return folded + replace_with_number(slot, value);
+            folded += simplify_binary(slot);
+            break;
+        case NODE_UNARY_OP:
+            folded += fold_expression(&node->data.unary_op.operand);
+            if (fold_constant(node, &value)) folded += replace_with_number(slot, value);
+            break;
+        case NODE_INDEX:
+            folded += fold_expression(&node->data.index.index);
+            break;
+        case NODE_SELECT:
+            folded += fold_expression(&node->data.select.condition);
+            folded += fold_expression(&node->data.select.if_true);
+            folded += fold_expression(&node->data.select.if_false);
+            if (fold_constant(node->data.select.condition, &value)) {
+                folded += replace(slot, value ? &node->data.select.if_true
+                                              : &node->data.select.if_false);
+            }
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                folded += fold_expression(&node->data.call.args[i]);
+            }
+            break;
+        case NODE_INLINE:
+            folded += fold_block(node->data.inline_call.body);
+            break;
+        default:
+            break;
+    }
+    return folded;
+}
+
+// Put replacement in place of statements[index] of block: nothing when it
+// is NULL, the statements of a block, or a single statement. The old
+// statement is left to the caller.
+static bool block_replace(ASTNode *block, int index, ASTNode *replacement) {
+    ASTNode **statements = &replacement;
+    int count = replacement ? 1 : 0;
+    if (replacement && replacement->type == NODE_BLOCK) {
+        statements = replacement->data.block.statements;
+        count = replacement->data.block.statement_count;
+    }
+
+    int total = block->data.block.statement_count - 1 + count;
+    if (count > 1) {
+        void *temp = realloc(block->data.block.statements, sizeof(ASTNode *) * total);
+        if (!temp) return false;
+        block->data.block.statements = temp;
+    }
+
+    memmove(&block->data.block.statements[index + count],
+            &block->data.block.statements[index + 1],
+            sizeof(ASTNode *) * (block->data.block.statement_count - index - 1));
+    memcpy(&block->data.block.statements[index], statements, sizeof(ASTNode *) * count);
+    block->data.block.statement_count = total;
+
+    if (replacement && replacement->type == NODE_BLOCK) {
+        replacement->data.block.statement_count = 0;
+        ast_free(replacement);
+    }
+    return true;
+}
+
+// x = x, left behind by x = x + 0 and the like
+static bool is_self_assignment(const ASTNode *node) {
+    return node->type == NODE_BINARY_OP && node->data.binary_op.operator == '=' &&
+           node->data.binary_op.left->type == NODE_VARIABLE &&
+           node->data.binary_op.right->type == NODE_VARIABLE &&
+           strcmp(node->data.binary_op.left->data.variable.name,
+                  node->data.binary_op.right->data.variable.name) == 0;
+}
+
+// Statements after a return or break up to the next case label never run
+static int remove_unreachable(ASTNode *block, int index) {
+    int end = index;
+    while (end < block->data.block.statement_count &&
+           block->data.block.statements[end]->type != NODE_CASE) {
+        ast_free(block->data.block.statements[end++]);
+    }
+    memmove(&block->data.block.statements[index], &block->data.block.statements[end],
+            sizeof(ASTNode *) * (block->data.block.statement_count - end));
+    block->data.block.statement_count -= end - index;
+    return end - index;
+}
+
+static int fold_block(ASTNode *block) {
+    if (!block) return 0;
+
+    int folded = 0;
+    for (int i = 0; i < block->data.block.statement_count; i++) {
+        ASTNode *node = block->data.block.statements[i];
+        ASTNode **kept = NULL;   // Part of node that replaces it, if it goes
+        long value;
+
+        switch (node->type) {
+            case NODE_IF:
+                folded += fold_expression(&node->data.if_stmt.condition);
+                if (fold_constant(node->data.if_stmt.condition, &value)) {
+                    kept = value ? &node->data.if_stmt.then_branch : &node->data.if_stmt.else_branch;
+                    break;
+                }
+                folded += fold_block(node->data.if_stmt.then_branch);
+                folded += fold_block(node->data.if_stmt.else_branch);
+                continue;
+            case NODE_WHILE:
+                folded += fold_expression(&node->data.while_stmt.condition);
+                if (fold_constant(node->data.while_stmt.condition, &value) && !value) break;
+                folded += fold_block(node->data.while_stmt.body);
+                continue;
+            case NODE_FOR:
+                folded += fold_expression(&node->data.for_stmt.init);
+                folded += fold_expression(&node->data.for_stmt.condition);
+                folded += fold_expression(&node->data.for_stmt.step);
+                if (node->data.for_stmt.condition &&
+                    fold_constant(node->data.for_stmt.condition, &value) && !value) {
+                    kept = &node->data.for_stmt.init;
+                    break;
+                }
+                folded += fold_block(node->data.for_stmt.body);
+                continue;
+            case NODE_SWITCH:
+                folded += fold_expression(&node->data.switch_stmt.value);
+                folded += fold_block(node->data.switch_stmt.body);
+                continue;
+            case NODE_RETURN:
+                folded += fold_expression(&node->data.return_stmt.expression);
+                folded += remove_unreachable(block, i + 1);
+                continue;
+            case NODE_BREAK:
+                folded += remove_unreachable(block, i + 1);
+                continue;
+            default:
+                folded += fold_expression(&block->data.block.statements[i]);
+                node = block->data.block.statements[i];
+                if (is_self_assignment(node)) break;
+                continue;
+        }
+
+        // The statement goes; what it kept is folded when the loop reaches it
+        ASTNode *replacement = kept ? *kept : NULL;
+        if (!block_replace(block, i, replacement)) continue;
+        if (kept) *kept = NULL;
+        ast_free(node);
+        folded++;
+        i--;
+    }
+    return folded;
+}
+
+int fold_function(ASTNode *function) {
+    return fold_block(function->data.function.body);
+}
\ No newline at end of file
@@ -0,0 +1,984 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <frame.h>
+#include <cfg.h>
+
+#define MAX_SPILLS 6
+#define CALLEE_SAVED_COUNT 5
+
+static const char *arg_registers[MAX_SPILLS] = {"%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9"};
+static const char *callee_saved[CALLEE_SAVED_COUNT] = {"%rbx", "%r12", "%r13", "%r14", "%r15"};
+
+// Instructions that may read a register parameter in place of its slot
+static const char *forwardable[] = {
+    "movq", "addq", "subq", "imulq", "andq", "orq", "xorq", "cmpq", "testq", "pushq",
+    "movl", "addl", "subl", "imull", "andl", "orl", "xorl", "cmpl", "testl",
+    "movw", "cmpw", "testw", "movb", "cmpb", "testb",
+    "movsbl", "movsbq", "movzbl", "movswl", "movswq", "movzwl", "movslq",
+};
+static const int FORWARDABLE_COUNT = sizeof(forwardable) / sizeof(forwardable[0]);
+
+typedef enum {
+    ROLE_BODY,
+    ROLE_PROLOGUE,   // pushq %rbp; movq %rsp, %rbp; subq $N, %rsp
+    ROLE_SPILL,      // Store of a register parameter into its slot
+    ROLE_TEARDOWN    // movq %rbp, %rsp; popq %rbp
+} Role;
+
+typedef enum {
+    ACCESS_READ,
+    ACCESS_WRITE,    // Overwrites the whole slot
+    ACCESS_UPDATE    // Reads it, or writes only part of it
+} Access;
+
+typedef struct {
+    int insn;
+    const char *reg;     // 64-bit name of the parameter register
+    int offset;
+    int size;            // Bytes stored, from the register's low bytes
+    bool live;           // Still needed after dead stores are gone
+} Spill;
+
+typedef struct {
+    InsnList *code;
+    Cfg *cfg;
+    char *role;              // Of each instruction
+    int prologue;            // Index of pushq %rbp
+    int *pred_start;         // Predecessors of block b are preds[pred_start[b]..pred_start[b + 1]]
+    int *preds;
+
+    int *offsets;            // Distinct negative %rbp offsets in use, ascending
+    int *sizes;              // Widest access to the slot at each offset
+    int slot_count;
+    int *color;              // Shared slot of each offset, -1 once unused
+    int colors;
+    int *color_offset;       // Bytes from the top of the frame to each shared slot
+    int colors_size;         // Bytes of shared slots, rounded up to 8
+
+    Spill spills[MAX_SPILLS];
+    int spill_count;
+
+    const char *saved[CALLEE_SAVED_COUNT];
+    int saved_count;
+    bool calls;
+    bool stack_ops;          // Pushes, pops or %rsp arithmetic in the body
+
+    bool omit_frame_pointer;
+    int size;                // Bytes reserved with subq
+    int *depth;              // 8-byte pushes outstanding at the start of each block
+    bool *frameless;         // Blocks that run before the frame is set up
+    bool *setup;             // Blocks that set the frame up on entry
+    bool shrink_wrapped;
+} Frame;
+
+static bool is_line(const Insn *insn, const char *mnemonic, const char *first, const char *second) {
+    return insn_is_op(insn, mnemonic) && insn->operand_count == (second ? 2 : 1) &&
+           strcmp(insn->operands[0], first) == 0 &&
+           (!second || strcmp(insn->operands[1], second) == 0);
+}
+
+static bool mentions_frame_pointer(const char *operand) {
+    return strstr(operand, "%rbp") || strstr(operand, "%ebp") || strstr(operand, "%bp");
+}
+
+// Offset of an operand of the form N(%rbp)
+static bool frame_offset(const char *operand, int *offset) {
+    char *end;
+    long value = strtol(operand, &end, 10);
+    if (end == operand || strcmp(end, "(%rbp)") != 0 || value == 0) return false;
+    *offset = (int)value;
+    return true;
+}
+
+// Index of the next instruction or label after index, skipping directives
+static int next_item(InsnList *code, int index) {
+    for (index++; index < code->count; index++) {
+        InsnKind kind = code->items[index].kind;
+        if (kind == INSN_OP || kind == INSN_LABEL) break;
+    }
+    return index;
+}
+
+// Bytes of memory that operand k of insn reads or writes: the size of the
+// source for extending moves, else the operand size of the instruction
+static int access_size(const Insn *insn, int k) {
+    const char *m = insn->mnemonic;
+    size_t length = strlen(m);
+    if (strncmp(m, "set", 3) == 0) return 1;
+    if (strncmp(m, "push", 4) == 0 || strncmp(m, "pop", 3) == 0) return 8;
+
+    char suffix = m[length - 1];
+    if ((strncmp(m, "movs", 4) == 0 || strncmp(m, "movz", 4) == 0) && length == 6 && k == 0) {
+        suffix = m[4];
+    }
+    switch (suffix) {
+        case 'b': return 1;
+        case 'w': return 2;
+        case 'l': return 4;
+        default:  return 8;
+    }
+}
+
+static bool is_plain_move(const Insn *insn) {
+    return insn_is_op(insn, "movq") || insn_is_op(insn, "movl") ||
+           insn_is_op(insn, "movw") || insn_is_op(insn, "movb");
+}
+
+static Access operand_access(const Insn *insn, int k) {
+    const char *m = insn->mnemonic;
+    if (strncmp(m, "cmp", 3) == 0 || strncmp(m, "test", 4) == 0) return ACCESS_READ;
+    if (k < insn->operand_count - 1) return ACCESS_READ;
+    if (insn->operand_count == 1) {
+        if (strncmp(m, "pop", 3) == 0) return ACCESS_WRITE;
+        if (strncmp(m, "set", 3) == 0 || strncmp(m, "inc", 3) == 0 || strncmp(m, "dec", 3) == 0 ||
+            strncmp(m, "neg", 3) == 0 || strncmp(m, "not", 3) == 0) {
+            return ACCESS_UPDATE;
+        }
+        return ACCESS_READ;   // push, mul, div, indirect jmp or call
+    }
+    if (is_plain_move(insn)) return ACCESS_WRITE;
+    return ACCESS_UPDATE;
+}
+
+// Whether insn may change reg: anything that names it other than as the
+// source of a two-operand instruction, or a call
+static bool writes_register(const Insn *insn, const char *reg) {
+    if (insn_is_op(insn, "call")) return true;
+    if (!insn_mentions_reg(insn, reg)) return false;
+    if (strncmp(insn->mnemonic, "cmp", 3) == 0 || strncmp(insn->mnemonic, "test", 4) == 0) {
+        return false;
+    }
+    if (insn->operand_count < 2) return !insn_is_op(insn, "pushq");
+
+    Insn destination = *insn;
+    destination.operands[0][0] = '\0';
+    return insn_mentions_reg(&destination, reg);
+}
+
+// Print insn with operand k replaced by text
+static void format_with_operand(const Insn *insn, int k, const char *text, char *line, size_t size) {
+    int n = snprintf(line, size, "\t%s", insn->mnemonic);
+    for (int i = 0; i < insn->operand_count && n < (int)size; i++) {
+        n += snprintf(line + n, size - n, "%s%s", i ? ", " : " ", i == k ? text : insn->operands[i]);
+    }
+}
+
+static int compare_ints(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static int slot_index(Frame *f, int offset) {
+    int *found = bsearch(&offset, f->offsets, f->slot_count, sizeof(int), compare_ints);
+    return found ? (int)(found - f->offsets) : -1;
+}
+
+// Operand k of insn if it is a slot below %rbp, or -1
+static int slot_operand(Frame *f, const Insn *insn, int k) {
+    int offset;
+    if (!frame_offset(insn->operands[k], &offset) || offset > 0) return -1;
+    return slot_index(f, offset);
+}
+
+static int successors(Cfg *cfg, int b, int *out) {
+    int n = 0;
+    for (int kind = CFG_FALLTHROUGH; kind <= CFG_TARGET; kind++) {
+        int succ = cfg->blocks[b].succ[kind];
+        if (succ >= 0) out[n++] = succ;
+    }
+    for (int i = 0; i < cfg->table_edge_count; i++) {
+        if (cfg->table_edges[i].source == b && cfg->table_edges[i].target >= 0) {
+            out[n++] = cfg->table_edges[i].target;
+        }
+    }
+    return n;
+}
+
+// Recognize the prologue and teardowns the code generator emits, and check
+// that the body uses %rbp only to address slots
+static bool scan_function(Frame *f) {
+    InsnList *code = f->code;
+    int i = 0;
+    while (i < code->count && code->items[i].kind != INSN_LABEL) i++;
+
+    i = next_item(code, i);
+    if (i >= code->count || !is_line(&code->items[i], "pushq", "%rbp", NULL)) return false;
+    f->prologue = i;
+    f->role[i] = ROLE_PROLOGUE;
+
+    i = next_item(code, i);
+    if (i >= code->count || !is_line(&code->items[i], "movq", "%rsp", "%rbp")) return false;
+    f->role[i] = ROLE_PROLOGUE;
+
+    i = next_item(code, i);
+    if (i < code->count && insn_is_op(&code->items[i], "subq") &&
+        code->items[i].operands[0][0] == '$' && strcmp(code->items[i].operands[1], "%rsp") == 0) {
+        f->role[i] = ROLE_PROLOGUE;
+        i = next_item(code, i);
+    }
+
+    for (; i < code->count && f->spill_count < MAX_SPILLS; i = next_item(code, i)) {
+        Insn *insn = &code->items[i];
+        int offset, r = 0;
+        if (!is_plain_move(insn) || !frame_offset(insn->operands[1], &offset) || offset > 0) break;
+        const char *family = insn_reg_family(insn->operands[0]);
+        while (r < MAX_SPILLS && (!family || strcmp(family, arg_registers[r] + 1) != 0)) r++;
+        if (r == MAX_SPILLS) break;
+        f->spills[f->spill_count++] = (Spill){i, arg_registers[r], offset, access_size(insn, 1), true};
+        f->role[i] = ROLE_SPILL;
+    }
+
+    for (i = 0; i < code->count; i++) {
+        Insn *insn = &code->items[i];
+        if (insn->kind != INSN_OP || f->role[i] != ROLE_BODY) continue;
+
+        if (is_line(insn, "movq", "%rbp", "%rsp")) {
+            int pop = next_item(code, i);
+            if (pop >= code->count || !is_line(&code->items[pop], "popq", "%rbp", NULL)) return false;
+            f->role[i] = f->role[pop] = ROLE_TEARDOWN;
+            continue;
+        }
+
+        if (insn_mentions_reg(insn, "%rbp")) {
+            bool named = false;
+            for (int k = 0; k < insn->operand_count; k++) {
+                if (!mentions_frame_pointer(insn->operands[k])) continue;
+                int offset;
+                if (!frame_offset(insn->operands[k], &offset)) return false;
+                named = true;
+            }
+            // Taking a slot's address, or using %rbp implicitly
+            if (!named || strncmp(insn->mnemonic, "lea", 3) == 0) return false;
+        }
+
+        if (insn_is_op(insn, "call")) {
+            f->calls = true;
+        } else if (!insn_is_op(insn, "ret") && insn_touches_stack(insn)) {
+            f->stack_ops = true;
+        }
+        for (int r = 0; r < CALLEE_SAVED_COUNT; r++) {
+            if (!insn_mentions_reg(insn, callee_saved[r])) continue;
+            int k = 0;
+            while (k < f->saved_count && f->saved[k] != callee_saved[r]) k++;
+            if (k == f->saved_count) f->saved[f->saved_count++] = callee_saved[r];
+        }
+    }
+    return true;
+}
+
+// Find the slots and their sizes. Slots must not overlap, so that each
+// can be moved on its own.
+static bool collect_slots(Frame *f) {
+    InsnList *code = f->code;
+    f->offsets = malloc(sizeof(int) * (code->count + 1));
+    if (!f->offsets) return false;
+
+    for (int i = 0; i < code->count; i++) {
+        Insn *insn = &code->items[i];
+        if (insn->kind != INSN_OP || (f->role[i] != ROLE_BODY && f->role[i] != ROLE_SPILL)) continue;
+        for (int k = 0; k < insn->operand_count; k++) {
+            int offset;
+            if (frame_offset(insn->operands[k], &offset) && offset < 0) {
+                f->offsets[f->slot_count++] = offset;
+            }
+        }
+    }
+    qsort(f->offsets, f->slot_count, sizeof(int), compare_ints);
+
+    int unique = 0;
+    for (int s = 0; s < f->slot_count; s++) {
+        if (unique == 0 || f->offsets[unique - 1] != f->offsets[s]) f->offsets[unique++] = f->offsets[s];
+    }
+    f->slot_count = unique;
+
+    f->sizes = calloc(f->slot_count + 1, sizeof(int));
+    if (!f->sizes) return false;
+    for (int i = 0; i < code->count; i++) {
+        Insn *insn = &code->items[i];
+        if (insn->kind != INSN_OP || (f->role[i] != ROLE_BODY && f->role[i] != ROLE_SPILL)) continue;
+        for (int k = 0; k < insn->operand_count; k++) {
+            int slot = slot_operand(f, insn, k);
+            if (slot >= 0 && access_size(insn, k) > f->sizes[slot]) f->sizes[slot] = access_size(insn, k);
+        }
+    }
+    for (int slot = 0; slot < f->slot_count; slot++) {
+        int end = slot + 1 < f->slot_count ? f->offsets[slot + 1] : 0;
+        if (f->offsets[slot] + f->sizes[slot] > end) return false;
+    }
+    return true;
+}
+
+static bool build_preds(Frame *f) {
+    Cfg *cfg = f->cfg;
+    int *succ = malloc(sizeof(int) * (cfg->table_edge_count + 2));
+    f->pred_start = calloc(cfg->count + 1, sizeof(int));
+    if (!succ || !f->pred_start) {
+        free(succ);
+        return false;
+    }
+
+    int total = 0;
+    for (int b = 0; b < cfg->count; b++) {
+        int n = successors(cfg, b, succ);
+        for (int k = 0; k < n; k++) f->pred_start[succ[k] + 1]++;
+        total += n;
+    }
+    for (int b = 0; b < cfg->count; b++) f->pred_start[b + 1] += f->pred_start[b];
+
+    f->preds = malloc(sizeof(int) * (total + 1));
+    int *fill = calloc(cfg->count, sizeof(int));
+    if (!f->preds || !fill) {
+        free(succ);
+        free(fill);
+        return false;
+    }
+    for (int b = 0; b < cfg->count; b++) {
+        int n = successors(cfg, b, succ);
+        for (int k = 0; k < n; k++) {
+            f->preds[f->pred_start[succ[k]] + fill[succ[k]]++] = b;
+        }
+    }
+    free(succ);
+    free(fill);
+    return true;
+}
+
+// Walk one block knowing which parameters still have the same value in
+// their register and their slot; with rewrite set, reads of such a slot
+// read the register instead. Returns the number of operands rewritten.
+static int forward_block(Frame *f, int b, bool *valid, bool rewrite) {
+    BasicBlock *block = &f->cfg->blocks[b];
+    int rewritten = 0;
+
+    for (int i = block->start; i < block->end; i++) {
+        Insn *insn = &f->code->items[i];
+        if (insn->kind != INSN_OP || f->role[i] == ROLE_PROLOGUE || f->role[i] == ROLE_TEARDOWN) {
+            continue;
+        }
+
+        bool may_forward = false;
+        for (int m = 0; rewrite && m < FORWARDABLE_COUNT; m++) {
+            if (insn_is_op(insn, forwardable[m])) may_forward = true;
+        }
+        bool forwarded = false;
+        for (int k = 0; may_forward && !forwarded && k < insn->operand_count; k++) {
+            int offset;
+            if (!frame_offset(insn->operands[k], &offset) || operand_access(insn, k) != ACCESS_READ) {
+                continue;
+            }
+            for (int s = 0; s < f->spill_count; s++) {
+                // The register holds only the bytes that were stored
+                int size = access_size(insn, k);
+                if (!valid[s] || f->spills[s].offset != offset || size > f->spills[s].size) continue;
+                char reg[INSN_OPERAND_SIZE], line[160];
+                snprintf(reg, sizeof(reg), "%%%s", insn_reg_sized(f->spills[s].reg, size));
+                format_with_operand(insn, k, reg, line, sizeof(line));
+                insn_set(insn, line);
+                forwarded = true;
+                rewritten++;
+                break;
+            }
+        }
+        if (forwarded && insn_is_op(insn, "movq") && strcmp(insn->operands[0], insn->operands[1]) == 0) {
+            insn_delete(insn);
+            continue;
+        }
+
+        for (int s = 0; s < f->spill_count; s++) {
+            if (i == f->spills[s].insn) {
+                valid[s] = true;
+                continue;
+            }
+            if (writes_register(insn, f->spills[s].reg)) valid[s] = false;
+            for (int k = 0; k < insn->operand_count; k++) {
+                int offset;
+                if (frame_offset(insn->operands[k], &offset) && offset == f->spills[s].offset &&
+                    operand_access(insn, k) != ACCESS_READ) {
+                    valid[s] = false;
+                }
+            }
+        }
+    }
+    return rewritten;
+}
+
+// Forward dataflow: a parameter is available at a block if it is on every
+// path into it
+static int forward_parameters(Frame *f) {
+    Cfg *cfg = f->cfg;
+    // Nothing may jump back to the function label
+    if (f->spill_count == 0 || f->pred_start[1] > 0) return 0;
+
+    bool *in = malloc(sizeof(bool) * cfg->count * MAX_SPILLS);
+    bool *out = malloc(sizeof(bool) * cfg->count * MAX_SPILLS);
+    if (!in || !out) {
+        free(in);
+        free(out);
+        return 0;
+    }
+    for (int b = 0; b < cfg->count * MAX_SPILLS; b++) in[b] = out[b] = b >= MAX_SPILLS;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int b = 0; b < cfg->count; b++) {
+            bool *state = &in[b * MAX_SPILLS];
+            for (int p = f->pred_start[b]; b > 0 && p < f->pred_start[b + 1]; p++) {
+                for (int s = 0; s < f->spill_count; s++) {
+                    state[s] = state[s] && out[f->preds[p] * MAX_SPILLS + s];
+                }
+            }
+            bool result[MAX_SPILLS];
+            memcpy(result, state, sizeof(result));
+            forward_block(f, b, result, false);
+            if (memcmp(result, &out[b * MAX_SPILLS], sizeof(result)) != 0) {
+                memcpy(&out[b * MAX_SPILLS], result, sizeof(result));
+                changed = true;
+            }
+        }
+    }
+
+    int rewritten = 0;
+    for (int b = 0; b < cfg->count; b++) {
+        rewritten += forward_block(f, b, &in[b * MAX_SPILLS], true);
+    }
+    free(in);
+    free(out);
+    return rewritten;
+}
+
+// Backward liveness of the slots over one block. With interference set,
+// dead stores are deleted and every write interferes with the slots live
+// across it.
+static int live_block(Frame *f, int b, unsigned char *live, unsigned char *interference,
+                      bool *referenced) {
+    BasicBlock *block = &f->cfg->blocks[b];
+    int n = f->slot_count;
+    int deleted = 0;
+
+    for (int i = block->end - 1; i >= block->start; i--) {
+        Insn *insn = &f->code->items[i];
+        if (insn->kind != INSN_OP || (f->role[i] != ROLE_BODY && f->role[i] != ROLE_SPILL)) continue;
+
+        for (int k = 0; k < insn->operand_count; k++) {
+            int s = slot_operand(f, insn, k);
+            if (s < 0) continue;
+
+            // A store to part of a slot keeps the rest of it
+            Access access = operand_access(insn, k);
+            if (access == ACCESS_WRITE && access_size(insn, k) < f->sizes[s]) access = ACCESS_UPDATE;
+            if (access == ACCESS_WRITE && !live[s] && is_plain_move(insn)) {
+                if (interference) {
+                    insn_delete(insn);
+                    deleted++;
+                }
+                break;
+            }
+            if (interference) {
+                referenced[s] = true;
+                if (access != ACCESS_READ && n <= FRAME_MAX_COLORED_SLOTS) {
+                    for (int t = 0; t < n; t++) {
+                        if (live[t] && t != s) interference[s * n + t] = interference[t * n + s] = 1;
+                    }
+                }
+            }
+            live[s] = access != ACCESS_WRITE;
+        }
+    }
+    return deleted;
+}
+
+// Lay the shared slots out below the top of the frame, widest first, so
+// that each is naturally aligned without padding
+static bool pack_colors(Frame *f) {
+    int *size = calloc(f->colors + 1, sizeof(int));
+    f->color_offset = malloc(sizeof(int) * (f->colors + 1));
+    if (!size || !f->color_offset) {
+        free(size);
+        return false;
+    }
+    for (int s = 0; s < f->slot_count; s++) {
+        int c = f->color[s];
+        if (c >= 0 && f->sizes[s] > size[c]) size[c] = f->sizes[s];
+    }
+
+    int offset = 0;
+    for (int width = 8; width >= 1; width /= 2) {
+        for (int c = 0; c < f->colors; c++) {
+            if (size[c] > width / 2 && size[c] <= width) {
+                offset += width;
+                f->color_offset[c] = offset;
+            }
+        }
+    }
+    f->colors_size = (offset + 7) & ~7;
+    free(size);
+    return true;
+}
+
+// Share slots between variables that are never live at the same time.
+// Returns the number of stores deleted.
+static int color_slots(Frame *f) {
+    Cfg *cfg = f->cfg;
+    int n = f->slot_count;
+    int *succ = malloc(sizeof(int) * (cfg->table_edge_count + 2));
+    unsigned char *live_in = calloc((size_t)cfg->count * n + 1, 1);
+    unsigned char *live = malloc(n + 1);
+    unsigned char *interference = calloc(n <= FRAME_MAX_COLORED_SLOTS ? (size_t)n * n + 1 : 1, 1);
+    bool *referenced = calloc(n + 1, sizeof(bool));
+    f->color = malloc(sizeof(int) * (n + 1));
+    int deleted = 0;
+
+    if (succ && live_in && live && interference && referenced && f->color) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int b = cfg->count - 1; b >= 0; b--) {
+                memset(live, 0, n);
+                int count = successors(cfg, b, succ);
+                for (int k = 0; k < count; k++) {
+                    for (int s = 0; s < n; s++) live[s] |= live_in[(size_t)succ[k] * n + s];
+                }
+                live_block(f, b, live, NULL, NULL);
+                if (memcmp(live, &live_in[(size_t)b * n], n) != 0) {
+                    memcpy(&live_in[(size_t)b * n], live, n);
+                    changed = true;
+                }
+            }
+        }
+
+        for (int b = 0; b < cfg->count; b++) {
+            memset(live, 0, n);
+            int count = successors(cfg, b, succ);
+            for (int k = 0; k < count; k++) {
+                for (int s = 0; s < n; s++) live[s] |= live_in[(size_t)succ[k] * n + s];
+            }
+            deleted += live_block(f, b, live, interference, referenced);
+        }
+
+        // Greedy coloring in slot order
+        for (int s = 0; s < n; s++) {
+            f->color[s] = -1;
+            if (!referenced[s]) continue;
+            int c = 0;
+            if (n > FRAME_MAX_COLORED_SLOTS) {
+                c = f->colors;
+            } else {
+                for (bool taken = true; taken; c += taken) {
+                    taken = false;
+                    for (int t = 0; t < s && !taken; t++) {
+                        taken = f->color[t] == c && interference[s * n + t];
+                    }
+                }
+            }
+            f->color[s] = c;
+            if (c + 1 > f->colors) f->colors = c + 1;
+        }
+        for (int s = 0; s < f->spill_count; s++) {
+            f->spills[s].live = f->code->items[f->spills[s].insn].kind != INSN_DELETED;
+        }
+        if (!pack_colors(f)) {
+            free(f->color);
+            f->color = NULL;
+        }
+    } else {
+        free(f->color);
+        f->color = NULL;
+    }
+
+    free(succ);
+    free(live_in);
+    free(live);
+    free(interference);
+    free(referenced);
+    return deleted;
+}
+
+static void choose_size(Frame *f) {
+    int bytes = f->colors_size + f->saved_count * 8;
+    if (!f->calls && !f->stack_ops && bytes <= FRAME_RED_ZONE) {
+        f->size = 0;
+    } else if (!f->calls) {
+        f->size = bytes;
+    } else if (f->omit_frame_pointer) {
+        // The return address leaves %rsp 8 bytes off alignment
+        f->size = ((bytes + 8 + 15) & ~15) - 8;
+    } else {
+        f->size = (bytes + 15) & ~15;
+    }
+}
+
+// Pushes outstanding at the start of each block, needed to address slots
+// from %rsp. Returns false if they do not agree where paths meet.
+static bool compute_depths(Frame *f) {
+    Cfg *cfg = f->cfg;
+    int *succ = malloc(sizeof(int) * (cfg->table_edge_count + 2));
+    int *work = malloc(sizeof(int) * (cfg->count + 1));
+    f->depth = malloc(sizeof(int) * (cfg->count + 1));
+    if (!succ || !work || !f->depth) {
+        free(succ);
+        free(work);
+        return false;
+    }
+    for (int b = 0; b < cfg->count; b++) f->depth[b] = -1;
+
+    bool ok = true;
+    int pending = 0;
+    f->depth[0] = 0;
+    work[pending++] = 0;
+    while (ok && pending > 0) {
+        int b = work[--pending];
+        int depth = f->depth[b];
+        BasicBlock *block = &cfg->blocks[b];
+
+        for (int i = block->start; ok && i < block->end; i++) {
+            Insn *insn = &f->code->items[i];
+            if (insn->kind != INSN_OP || f->role[i] != ROLE_BODY) continue;
+            if (insn_is_op(insn, "call") || insn_is_op(insn, "ret")) continue;
+
+            int amount;
+            if (insn_is_op(insn, "pushq") || insn_is_op(insn, "popq")) {
+                // Their memory operands are addressed with %rsp already moved
+                ok = !mentions_frame_pointer(insn->operands[0]);
+                depth += insn_is_op(insn, "pushq") ? 1 : -1;
+            } else if ((insn_is_op(insn, "subq") || insn_is_op(insn, "addq")) &&
+                       sscanf(insn->operands[0], "$%d", &amount) == 1 &&
+                       strcmp(insn->operands[1], "%rsp") == 0 && amount % 8 == 0) {
+                depth += (insn_is_op(insn, "subq") ? amount : -amount) / 8;
+            } else if (insn_mentions_reg(insn, "%rsp")) {
+                ok = false;
+            }
+        }
+
+        int count = successors(cfg, b, succ);
+        for (int k = 0; ok && k < count; k++) {
+            if (f->depth[succ[k]] < 0) {
+                f->depth[succ[k]] = depth;
+                work[pending++] = succ[k];
+            } else {
+                ok = f->depth[succ[k]] == depth;
+            }
+        }
+    }
+
+    // Blocks nothing reaches never run
+    for (int b = 0; b < cfg->count; b++) {
+        if (f->depth[b] < 0) f->depth[b] = 0;
+    }
+    free(succ);
+    free(work);
+    return ok;
+}
+
+static bool needs_frame(Frame *f, int i) {
+    Insn *insn = &f->code->items[i];
+    if (insn->kind != INSN_OP || f->role[i] == ROLE_PROLOGUE || f->role[i] == ROLE_SPILL) return false;
+    if (f->role[i] == ROLE_TEARDOWN) return true;
+    if (insn_is_op(insn, "ret")) return false;
+    if (insn_mentions_reg(insn, "%rbp") || insn_touches_stack(insn)) return true;
+    for (int r = 0; r < f->saved_count; r++) {
+        if (insn_mentions_reg(insn, f->saved[r])) return true;
+    }
+    return false;
+}
+
+// Find the blocks from the entry that run without the frame and reach
+// the epilogue, and the blocks they lead to that set the frame up. Each
+// of those must be entered only from frameless blocks, so the setup runs
+// once.
+static bool shrink_wrap(Frame *f) {
+    Cfg *cfg = f->cfg;
+    int epilogue = cfg->epilogue;
+    if (epilogue <= 0 || f->pred_start[1] > 0) return false;
+
+    BasicBlock *exit_block = &cfg->blocks[epilogue];
+    for (int i = exit_block->start; i < exit_block->end; i++) {
+        Insn *insn = &f->code->items[i];
+        if (insn->kind == INSN_OP && f->role[i] != ROLE_TEARDOWN && !insn_is_op(insn, "ret")) {
+            return false;
+        }
+    }
+
+    bool *needs = calloc(cfg->count, sizeof(bool));
+    int *work = malloc(sizeof(int) * (cfg->count + 1));
+    int *succ = malloc(sizeof(int) * (cfg->table_edge_count + 2));
+    f->frameless = calloc(cfg->count, sizeof(bool));
+    f->setup = calloc(cfg->count, sizeof(bool));
+    bool ok = needs && work && succ && f->frameless && f->setup;
+
+    for (int b = 0; ok && b < cfg->count; b++) {
+        for (int i = cfg->blocks[b].start; i < cfg->blocks[b].end && !needs[b]; i++) {
+            needs[b] = needs_frame(f, i);
+        }
+    }
+
+    int exits = 0, pending = 0;
+    if (ok && !needs[0]) {
+        f->frameless[0] = true;
+        work[pending++] = 0;
+    }
+    while (ok && pending > 0) {
+        int b = work[--pending];
+        BasicBlock *block = &cfg->blocks[b];
+        int count = successors(cfg, b, succ);
+
+        for (int k = 0; ok && k < count; k++) {
+            int s = succ[k];
+            if (s == epilogue) {
+                // A conditional branch to the epilogue would need a block of its own
+                ok = block->terminator < 0 || !insn_is_cond_jump(&f->code->items[block->terminator]) ||
+                     block->succ[CFG_TARGET] != epilogue;
+                exits++;
+            } else if (needs[s]) {
+                f->setup[s] = true;
+            } else if (!f->frameless[s]) {
+                f->frameless[s] = true;
+                work[pending++] = s;
+            }
+        }
+
+        // Parameters still to be spilled must survive the frameless code
+        for (int i = block->start; ok && i < block->end; i++) {
+            Insn *insn = &f->code->items[i];
+            if (insn->kind != INSN_OP || f->role[i] != ROLE_BODY) continue;
+            for (int s = 0; s < f->spill_count; s++) {
+                if (f->spills[s].live && writes_register(insn, f->spills[s].reg)) ok = false;
+            }
+        }
+    }
+
+    for (int b = 0; ok && b < cfg->count; b++) {
+        if (!f->frameless[b] && !f->setup[b]) continue;
+        for (int p = f->pred_start[b]; p < f->pred_start[b + 1]; p++) {
+            if (!f->frameless[f->preds[p]]) ok = false;
+        }
+    }
+
+    free(needs);
+    free(work);
+    free(succ);
+    return ok && exits > 0;
+}
+
+static void append(InsnList *out, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+static void append(InsnList *out, const char *format, ...) {
+    char line[160];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    insn_list_append(out, line);
+}
+
+// Address of the slot offset bytes below the top of the frame: a shared
+// slot, or a callee-saved register's save slot after them
+static void slot_address(Frame *f, int offset, int depth, char *text, size_t size) {
+    if (f->omit_frame_pointer) {
+        snprintf(text, size, "%d(%%rsp)", f->size - offset + 8 * depth);
+    } else {
+        snprintf(text, size, "%d(%%rbp)", -offset);
+    }
+}
+
+static int saved_offset(Frame *f, int r) {
+    return f->colors_size + 8 * (r + 1);
+}
+
+// Rewrite an operand that addresses the frame
+static bool frame_address(Frame *f, const char *operand, int depth, char *text, size_t size) {
+    int offset;
+    if (!frame_offset(operand, &offset)) return false;
+
+    if (offset < 0) {
+        slot_address(f, f->color_offset[f->color[slot_index(f, offset)]], depth, text, size);
+    } else if (f->omit_frame_pointer) {
+        // Parameter passed on the stack, above the return address
+        snprintf(text, size, "%d(%%rsp)", f->size + offset - 8 + 8 * depth);
+    } else {
+        snprintf(text, size, "%d(%%rbp)", offset);
+    }
+    return true;
+}
+
+static void emit_setup(Frame *f, InsnList *out) {
+    char address[INSN_OPERAND_SIZE];
+
+    if (!f->omit_frame_pointer) {
+        append(out, "\tpushq %%rbp");
+        append(out, "\tmovq %%rsp, %%rbp");
+    }
+    if (f->size > 0) append(out, "\tsubq $%d, %%rsp", f->size);
+    for (int r = 0; r < f->saved_count; r++) {
+        slot_address(f, saved_offset(f, r), 0, address, sizeof(address));
+        append(out, "\tmovq %s, %s", f->saved[r], address);
+    }
+    for (int s = 0; s < f->spill_count; s++) {
+        if (!f->spills[s].live) continue;
+        Insn *spill = &f->code->items[f->spills[s].insn];
+        char line[160];
+        frame_address(f, spill->operands[1], 0, address, sizeof(address));
+        format_with_operand(spill, 1, address, line, sizeof(line));
+        insn_list_append(out, line);
+    }
+}
+
+static void emit_teardown(Frame *f, InsnList *out) {
+    char address[INSN_OPERAND_SIZE];
+
+    for (int r = 0; r < f->saved_count; r++) {
+        slot_address(f, saved_offset(f, r), 0, address, sizeof(address));
+        append(out, "\tmovq %s, %s", address, f->saved[r]);
+    }
+    if (f->omit_frame_pointer) {
+        if (f->size > 0) append(out, "\taddq $%d, %%rsp", f->size);
+    } else if (f->size > 0) {
+        append(out, "\tleave");
+    } else {
+        append(out, "\tpopq %%rbp");
+    }
+}
+
+// Whether the epilogue is still entered once frameless exits return on
+// their own, and whether anything still jumps to its label rather than
+// falling into it
+static void epilogue_entries(Frame *f, bool *reached, bool *jumped) {
+    Cfg *cfg = f->cfg;
+    int epilogue = cfg->epilogue;
+    *reached = *jumped = false;
+    if (epilogue < 0) return;
+
+    for (int p = f->pred_start[epilogue]; p < f->pred_start[epilogue + 1]; p++) {
+        int b = f->preds[p];
+        bool tables = cfg_has_table_edges(cfg, b);
+        if (f->shrink_wrapped && f->frameless[b] && !tables) continue;
+        *reached = true;
+        if (cfg->blocks[b].succ[CFG_TARGET] == epilogue || tables) *jumped = true;
+    }
+}
+
+static void emit_function(Frame *f, InsnList *out) {
+    Cfg *cfg = f->cfg;
+    int epilogue = cfg->epilogue;
+    bool reached, jumped;
+    epilogue_entries(f, &reached, &jumped);
+
+    for (int b = 0; b < cfg->count; b++) {
+        BasicBlock *block = &cfg->blocks[b];
+        bool frameless = f->shrink_wrapped && f->frameless[b];
+        bool setup = f->shrink_wrapped && f->setup[b];
+        int depth = f->depth ? f->depth[b] : 0;
+
+        for (int i = block->start; i < block->end; i++) {
+            Insn *insn = &f->code->items[i];
+            if (insn->kind == INSN_DELETED) continue;
+            // Leave out an epilogue nothing enters, and the label of one
+            // that is only fallen into; keep .size and other directives
+            if (b == epilogue && ((!reached && insn->kind == INSN_OP) ||
+                                  (!jumped && insn->kind == INSN_LABEL))) {
+                continue;
+            }
+            if (setup && insn->kind == INSN_OP) {
+                emit_setup(f, out);
+                setup = false;
+            }
+
+            switch (f->role[i]) {
+                case ROLE_PROLOGUE:
+                    if (i == f->prologue && !f->shrink_wrapped) emit_setup(f, out);
+                    continue;
+                case ROLE_SPILL:
+                    continue;
+                case ROLE_TEARDOWN:
+                    if (insn_is_op(insn, "movq")) emit_teardown(f, out);
+                    continue;
+                default:
+                    break;
+            }
+
+            if (frameless && i == block->terminator && block->succ[CFG_TARGET] == epilogue &&
+                insn_is_op(insn, "jmp")) {
+                append(out, "\tret");
+                continue;
+            }
+
+            bool rewritten = false;
+            for (int k = 0; insn->kind == INSN_OP && k < insn->operand_count; k++) {
+                char address[INSN_OPERAND_SIZE], line[160];
+                if (!frame_address(f, insn->operands[k], depth, address, sizeof(address))) continue;
+                format_with_operand(insn, k, address, line, sizeof(line));
+                insn_list_append(out, line);
+                rewritten = true;
+                break;
+            }
+            if (!rewritten) insn_list_append(out, insn->text);
+
+            if (insn_is_op(insn, "pushq")) depth++;
+            if (insn_is_op(insn, "popq")) depth--;
+            int amount;
+            if ((insn_is_op(insn, "subq") || insn_is_op(insn, "addq")) &&
+                strcmp(insn->operands[1], "%rsp") == 0 && sscanf(insn->operands[0], "$%d", &amount) == 1) {
+                depth += (insn_is_op(insn, "subq") ? amount : -amount) / 8;
+            }
+        }
+
+        if (frameless && block->succ[CFG_FALLTHROUGH] == epilogue) append(out, "\tret");
+    }
+}
+
+static void frame_free(Frame *f) {
+    cfg_free(f->cfg);
+    free(f->role);
+    free(f->pred_start);
+    free(f->preds);
+    free(f->offsets);
+    free(f->sizes);
+    free(f->color);
+    free(f->color_offset);
+    free(f->depth);
+    free(f->frameless);
+    free(f->setup);
+}
+
+int frame_function(InsnList *code, bool omit_frame_pointer) {
+    Frame f;
+    memset(&f, 0, sizeof(f));
+    f.code = code;
+    f.omit_frame_pointer = omit_frame_pointer;
+    f.role = calloc(code->count + 1, 1);
+    f.cfg = cfg_build(code);
+
+    if (!f.role || !f.cfg || f.cfg->count == 0 || !scan_function(&f) || !collect_slots(&f) ||
+        !build_preds(&f)) {
+        frame_free(&f);
+        return 0;
+    }
+
+    int changes = forward_parameters(&f);
+    changes += color_slots(&f);
+    if (!f.color) {
+        frame_free(&f);
+        return changes;
+    }
+    changes += f.slot_count - f.colors;
+
+    if (f.omit_frame_pointer) {
+        choose_size(&f);
+        if (!compute_depths(&f)) f.omit_frame_pointer = false;
+    }
+    choose_size(&f);
+    f.shrink_wrapped = shrink_wrap(&f);
+
+    InsnList *out = insn_list_create();
+    if (out) {
+        emit_function(&f, out);
+        insn_list_clear(code);
+        insn_list_splice(code, out);
+        insn_list_free(out);
+        changes++;
+    }
+    frame_free(&f);
+    return changes;
+}
\ No newline at end of file
@@ -0,0 +1,548 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <gvn.h>
+
+static int temp_count = 0;
+
+// Hash-consed expression shapes: equal keys always get the same number
+typedef struct {
+    char op;       // 0 marks an empty slot, '#' a constant, 'C' a conversion
+    long left;     // Operand numbers, or the value of a constant
+    int right;     // Type of a constant or conversion
+    int number;
+} ValueKey;
+
+// Current value number of a variable
+typedef struct {
+    const char *name;
+    int number;    // -1 until the variable is first read or written
+} Binding;
+
+typedef struct {
+    int index;
+    int number;
+} BindingUndo;
+
+// A value computed on every path to the current statement
+typedef struct {
+    int number;
+    const char *leader;   // Variable holding the value, while it keeps it
+    ASTNode **slot;       // Otherwise the expression that computed it
+    const char *temp;     // Temporary the expression was stored into
+} Available;
+
+typedef struct {
+    ValueKey *keys;
+    int capacity;
+    int used;
+    int next_number;
+
+    Binding *bindings;
+    int binding_count;
+    BindingUndo *undo;
+    int undo_count;
+
+    Available *available;
+    int available_count;
+
+    int replaced;
+} Gvn;
+
+// Everything pushed after a mark is dropped when its region ends
+typedef struct {
+    int available;
+    int undo;
+} Scope;
+
+static void gvn_statement(Gvn *gvn, ASTNode **slot);
+static int gvn_expression(Gvn *gvn, ASTNode **slot);
+
+static int fresh_number(Gvn *gvn) {
+    return gvn->next_number++;
+}
+
+static unsigned hash_key(char op, long left, int right) {
+    unsigned h = (unsigned char)op;
+    h = h * 0x9e3779b1u ^ (unsigned)left;
+    h = h * 0x9e3779b1u ^ (unsigned)((unsigned long)left >> 32);
+    h = h * 0x9e3779b1u ^ (unsigned)right;
+    return h ^ (h >> 15);
+}
+
+static bool table_grow(Gvn *gvn) {
+    int capacity = gvn->capacity ? gvn->capacity * 2 : GVN_INITIAL_TABLE_SIZE;
+    ValueKey *keys = calloc(capacity, sizeof(ValueKey));
+    if (!keys) return false;
+
+    for (int i = 0; i < gvn->capacity; i++) {
+        ValueKey *key = &gvn->keys[i];
+        if (!key->op) continue;
+        unsigned h = hash_key(key->op, key->left, key->right) & (capacity - 1);
+        while (keys[h].op) h = (h + 1) & (capacity - 1);
+        keys[h] = *key;
+    }
+
+    free(gvn->keys);
+    gvn->keys = keys;
+    gvn->capacity = capacity;
+    return true;
+}
+
+// Number of op(left, right), allocating a new one the first time it is seen
+static int table_lookup(Gvn *gvn, char op, long left, int right) {
+    if ((gvn->used + 1) * 2 > gvn->capacity && !table_grow(gvn)) {
+        return fresh_number(gvn);
+    }
+
+    unsigned h = hash_key(op, left, right) & (gvn->capacity - 1);
+    while (gvn->keys[h].op) {
+        ValueKey *key = &gvn->keys[h];
+        if (key->op == op && key->left == left && key->right == right) return key->number;
+        h = (h + 1) & (gvn->capacity - 1);
+    }
+
+    gvn->keys[h] = (ValueKey){op, left, right, fresh_number(gvn)};
+    gvn->used++;
+    return gvn->keys[h].number;
+}
+
+static int binding_find(Gvn *gvn, const char *name) {
+    for (int i = 0; i < gvn->binding_count; i++) {
+        if (strcmp(gvn->bindings[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static void binding_set(Gvn *gvn, const char *name, int number) {
+    int index = binding_find(gvn, name);
+    if (index < 0) {
+        void *temp = realloc(gvn->bindings, sizeof(Binding) * (gvn->binding_count + 1));
+        if (!temp) return;
+        gvn->bindings = temp;
+        index = gvn->binding_count++;
+        gvn->bindings[index] = (Binding){name, -1};
+    }
+
+    void *temp = realloc(gvn->undo, sizeof(BindingUndo) * (gvn->undo_count + 1));
+    if (!temp) return;
+    gvn->undo = temp;
+    gvn->undo[gvn->undo_count++] = (BindingUndo){index, gvn->bindings[index].number};
+    gvn->bindings[index].number = number;
+}
+
+static int binding_get(Gvn *gvn, const char *name) {
+    int index = binding_find(gvn, name);
+    if (index >= 0 && gvn->bindings[index].number >= 0) return gvn->bindings[index].number;
+
+    // First read of a parameter or an uninitialized variable
+    int number = fresh_number(gvn);
+    binding_set(gvn, name, number);
+    return number;
+}
+
+static Scope scope_enter(Gvn *gvn) {
+    return (Scope){gvn->available_count, gvn->undo_count};
+}
+
+static void scope_leave(Gvn *gvn, Scope scope) {
+    gvn->available_count = scope.available;
+    while (gvn->undo_count > scope.undo) {
+        BindingUndo *undo = &gvn->undo[--gvn->undo_count];
+        gvn->bindings[undo->index].number = undo->number;
+    }
+}
+
+static void available_push(Gvn *gvn, Available entry) {
+    void *temp = realloc(gvn->available, sizeof(Available) * (gvn->available_count + 1));
+    if (!temp) return;
+    gvn->available = temp;
+    gvn->available[gvn->available_count++] = entry;
+}
+
+// Give every variable assigned in a subtree a fresh number, as at a merge
+// point where the incoming paths may disagree about its value
+static void kill_assigned(Gvn *gvn, ASTNode *node, bool statement) {
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                kill_assigned(gvn, node->data.block.statements[i], true);
+            }
+            break;
+        case NODE_RETURN:
+            kill_assigned(gvn, node->data.return_stmt.expression, false);
+            break;
+        case NODE_IF:
+            kill_assigned(gvn, node->data.if_stmt.condition, false);
+            kill_assigned(gvn, node->data.if_stmt.then_branch, true);
+            kill_assigned(gvn, node->data.if_stmt.else_branch, true);
+            break;
+        case NODE_WHILE:
+            kill_assigned(gvn, node->data.while_stmt.condition, false);
+            kill_assigned(gvn, node->data.while_stmt.body, true);
+            break;
+        case NODE_FOR:
+            kill_assigned(gvn, node->data.for_stmt.init, true);
+            kill_assigned(gvn, node->data.for_stmt.condition, false);
+            kill_assigned(gvn, node->data.for_stmt.step, true);
+            kill_assigned(gvn, node->data.for_stmt.body, true);
+            break;
+        case NODE_BINARY_OP:
+            if (node->data.binary_op.operator == '=' && node->data.binary_op.left->type == NODE_VARIABLE) {
+                binding_set(gvn, node->data.binary_op.left->data.variable.name, fresh_number(gvn));
+            } else {
+                kill_assigned(gvn, node->data.binary_op.left, false);
+            }
+            kill_assigned(gvn, node->data.binary_op.right, false);
+            break;
+        case NODE_INDEX:
+            kill_assigned(gvn, node->data.index.index, false);
+            break;
+        case NODE_VECTOR:
+            // Assigns what the loop it runs does
+            kill_assigned(gvn, node->data.vector.loop, true);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                kill_assigned(gvn, node->data.call.args[i], false);
+            }
+            break;
+        case NODE_INLINE:
+            kill_assigned(gvn, node->data.inline_call.body, true);
+            break;
+        case NODE_SWITCH:
+            kill_assigned(gvn, node->data.switch_stmt.value, false);
+            kill_assigned(gvn, node->data.switch_stmt.body, true);
+            break;
+        case NODE_VARIABLE:
+            // A declaration; as an operand it is only a read
+            if (statement) binding_set(gvn, node->data.variable.name, fresh_number(gvn));
+            break;
+        default:
+            break;
+    }
+}
+
+// Built only from constants, locals and side-effect-free operators. A
+// global is not: any call may change it. Nor is an array element, which
+// is not numbered.
+static bool is_pure(ASTNode *node) {
+    switch (node->type) {
+        case NODE_NUMBER:
+            return true;
+        case NODE_VARIABLE:
+            return !node->data.variable.is_global;
+        case NODE_BINARY_OP:
+            return node->data.binary_op.operator != '=' &&
+                   is_pure(node->data.binary_op.left) &&
+                   is_pure(node->data.binary_op.right);
+        case NODE_UNARY_OP:
+            return node->data.unary_op.operator == 'C' && is_pure(node->data.unary_op.operand);
+        default:
+            return false;
+    }
+}
+
+static int number_of(Gvn *gvn, ASTNode *node) {
+    switch (node->type) {
+        case NODE_NUMBER:
+            // The same bits in another type are another value
+            return table_lookup(gvn, '#', node->data.number.value, node->value_type);
+        case NODE_VARIABLE:
+            if (node->data.variable.is_global) return fresh_number(gvn);
+            return binding_get(gvn, node->data.variable.name);
+        case NODE_BINARY_OP: {
+            char op = node->data.binary_op.operator;
+            int left = number_of(gvn, node->data.binary_op.left);
+            int right = number_of(gvn, node->data.binary_op.right);
+
+            // Canonical operand order, so a + b and b + a share a number
+            if (op == '>' || op == 'G') {
+                int swap = left; left = right; right = swap;
+                op = op == '>' ? '<' : 'L';
+            } else if ((op == '+' || op == '*' || op == 'E' || op == 'N' || op == 'A' || op == 'O') &&
+                       left > right) {
+                int swap = left; left = right; right = swap;
+            }
+            return table_lookup(gvn, op, left, right);
+        }
+        case NODE_UNARY_OP:
+            if (node->data.unary_op.operator != 'C') return fresh_number(gvn);
+            return table_lookup(gvn, 'C', number_of(gvn, node->data.unary_op.operand), node->value_type);
+        default:
+            return fresh_number(gvn);
+    }
+}
+
+// Name of a variable holding an available value, or NULL
+static const char *find_leader(Gvn *gvn, int number) {
+    Available *computed = NULL;
+
+    for (int i = gvn->available_count - 1; i >= 0; i--) {
+        Available *entry = &gvn->available[i];
+        if (entry->number != number) continue;
+
+        if (!entry->leader) {
+            if (!computed) computed = entry;
+            continue;
+        }
+        // A variable stays a leader only until it is reassigned
+        int index = binding_find(gvn, entry->leader);
+        if (index >= 0 && gvn->bindings[index].number == number) return entry->leader;
+    }
+
+    if (!computed) return NULL;
+    if (!computed->temp) {
+        // Keep the first computation in a temporary for the later uses
+        char name[32];
+        snprintf(name, sizeof(name), ".gvn%d", temp_count++);
+        ASTNode *temp = ast_create_variable(name);
+        if (temp) temp->value_type = (*computed->slot)->value_type;
+        ASTNode *assign = ast_create_binary_op('=', temp, *computed->slot);
+        if (!assign || !assign->data.binary_op.left) {
+            if (assign) {
+                assign->data.binary_op.right = NULL;
+                ast_free(assign);
+            }
+            return NULL;
+        }
+        *computed->slot = assign;
+        computed->temp = assign->data.binary_op.left->data.variable.name;
+    }
+    return computed->temp;
+}
+
+// Replace a pure expression by a variable already holding its value
+static bool reuse_leader(Gvn *gvn, ASTNode **slot, int number) {
+    const char *leader = find_leader(gvn, number);
+    if (!leader) return false;
+
+    ASTNode *variable = ast_create_variable(leader);
+    if (!variable) return false;
+    variable->value_type = (*slot)->value_type;
+    ast_free(*slot);
+    *slot = variable;
+    gvn->replaced++;
+    return true;
+}
+
+static int gvn_expression(Gvn *gvn, ASTNode **slot) {
+    ASTNode *node = *slot;
+    if (!node) return fresh_number(gvn);
+
+    switch (node->type) {
+        case NODE_NUMBER:
+        case NODE_VARIABLE:
+            return number_of(gvn, node);
+
+        case NODE_BINARY_OP: {
+            if (node->data.binary_op.operator == '=' && node->data.binary_op.left->type == NODE_INDEX) {
+                gvn_expression(gvn, &node->data.binary_op.right);
+                gvn_expression(gvn, &node->data.binary_op.left);
+                return fresh_number(gvn);
+            }
+            if (node->data.binary_op.operator == '=') {
+                const char *name = node->data.binary_op.left->data.variable.name;
+                int number = gvn_expression(gvn, &node->data.binary_op.right);
+                if (node->data.binary_op.left->data.variable.is_global) return number;
+                binding_set(gvn, name, number);
+                available_push(gvn, (Available){number, name, NULL, NULL});
+                return number;
+            }
+
+            if (is_pure(node)) {
+                int number = number_of(gvn, node);
+                if (reuse_leader(gvn, slot, number)) return number;
+            }
+
+            char op = node->data.binary_op.operator;
+            if (op == 'A' || op == 'O') {
+                // The right operand only runs when the left one does not
+                // decide the result, so nothing it computes is available after
+                gvn_expression(gvn, &node->data.binary_op.left);
+                Scope scope = scope_enter(gvn);
+                gvn_expression(gvn, &node->data.binary_op.right);
+                scope_leave(gvn, scope);
+            } else {
+                // Operands are evaluated right to left
+                gvn_expression(gvn, &node->data.binary_op.right);
+                gvn_expression(gvn, &node->data.binary_op.left);
+            }
+            if (!is_pure(node)) return fresh_number(gvn);
+
+            int number = number_of(gvn, node);
+            available_push(gvn, (Available){number, NULL, slot, NULL});
+            return number;
+        }
+
+        case NODE_UNARY_OP: {
+            if (is_pure(node)) {
+                int number = number_of(gvn, node);
+                if (reuse_leader(gvn, slot, number)) return number;
+            }
+            gvn_expression(gvn, &node->data.unary_op.operand);
+            if (!is_pure(node)) return fresh_number(gvn);
+
+            int number = number_of(gvn, node);
+            available_push(gvn, (Available){number, NULL, slot, NULL});
+            return number;
+        }
+
+        case NODE_INDEX:
+            gvn_expression(gvn, &node->data.index.index);
+            return fresh_number(gvn);
+
+        case NODE_CALL:
+            // Arguments are evaluated right to left; calls cannot see locals,
+            // and globals are never numbered
+            for (int i = node->data.call.arg_count - 1; i >= 0; i--) {
+                gvn_expression(gvn, &node->data.call.args[i]);
+            }
+            return fresh_number(gvn);
+
+        case NODE_INLINE: {
+            // An early return skips the rest of the copy, so nothing
+            // computed inside it is available afterwards
+            Scope scope = scope_enter(gvn);
+            gvn_statement(gvn, &node->data.inline_call.body);
+            scope_leave(gvn, scope);
+            kill_assigned(gvn, node->data.inline_call.body, true);
+            return fresh_number(gvn);
+        }
+
+        default:
+            return fresh_number(gvn);
+    }
+}
+
+// Whether a break in node leaves the loop or switch around it
+static bool has_break(const ASTNode *node) {
+    if (!node) return false;
+
+    switch (node->type) {
+        case NODE_BREAK:
+            return true;
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                if (has_break(node->data.block.statements[i])) return true;
+            }
+            return false;
+        case NODE_IF:
+            return has_break(node->data.if_stmt.then_branch) ||
+                   has_break(node->data.if_stmt.else_branch);
+        default:
+            return false;
+    }
+}
+
+static void gvn_region(Gvn *gvn, ASTNode **slot) {
+    Scope scope = scope_enter(gvn);
+    gvn_statement(gvn, slot);
+    scope_leave(gvn, scope);
+}
+
+static void gvn_statement(Gvn *gvn, ASTNode **slot) {
+    ASTNode *node = *slot;
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            // Each statement dominates the ones after it
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                gvn_statement(gvn, &node->data.block.statements[i]);
+            }
+            break;
+
+        case NODE_RETURN:
+            gvn_expression(gvn, &node->data.return_stmt.expression);
+            break;
+
+        case NODE_IF:
+            gvn_expression(gvn, &node->data.if_stmt.condition);
+            gvn_region(gvn, &node->data.if_stmt.then_branch);
+            gvn_region(gvn, &node->data.if_stmt.else_branch);
+            kill_assigned(gvn, node->data.if_stmt.then_branch, true);
+            kill_assigned(gvn, node->data.if_stmt.else_branch, true);
+            break;
+
+        case NODE_WHILE:
+            // The header merges the entry with the back edge. The loop exits
+            // from its test, so the header state also holds after the loop.
+            kill_assigned(gvn, node, true);
+            gvn_expression(gvn, &node->data.while_stmt.condition);
+            gvn_region(gvn, &node->data.while_stmt.body);
+            if (has_break(node->data.while_stmt.body)) kill_assigned(gvn, node, true);
+            break;
+
+        case NODE_FOR: {
+            gvn_statement(gvn, &node->data.for_stmt.init);
+            kill_assigned(gvn, node->data.for_stmt.condition, false);
+            kill_assigned(gvn, node->data.for_stmt.step, true);
+            kill_assigned(gvn, node->data.for_stmt.body, true);
+            gvn_expression(gvn, &node->data.for_stmt.condition);
+
+            Scope scope = scope_enter(gvn);
+            gvn_statement(gvn, &node->data.for_stmt.body);
+            gvn_statement(gvn, &node->data.for_stmt.step);
+            scope_leave(gvn, scope);
+            if (has_break(node->data.for_stmt.body)) kill_assigned(gvn, node, true);
+            break;
+        }
+
+        case NODE_SWITCH: {
+            // Each case label merges the dispatch with the case above it,
+            // and the end of the switch merges every break
+            ASTNode *body = node->data.switch_stmt.body;
+            gvn_expression(gvn, &node->data.switch_stmt.value);
+            kill_assigned(gvn, body, true);
+
+            Scope scope = scope_enter(gvn);
+            for (int i = 0; i < body->data.block.statement_count; i++) {
+                if (body->data.block.statements[i]->type == NODE_CASE) {
+                    scope_leave(gvn, scope);
+                    kill_assigned(gvn, body, true);
+                    scope = scope_enter(gvn);
+                } else {
+                    gvn_statement(gvn, &body->data.block.statements[i]);
+                }
+            }
+            scope_leave(gvn, scope);
+            kill_assigned(gvn, body, true);
+            break;
+        }
+
+        case NODE_BREAK:
+        case NODE_CASE:
+            break;
+
+        case NODE_VECTOR:
+            kill_assigned(gvn, node, true);
+            break;
+
+        case NODE_VARIABLE:
+            // Declaration without initializer
+            binding_set(gvn, node->data.variable.name, fresh_number(gvn));
+            break;
+
+        default:
+            gvn_expression(gvn, slot);
+            break;
+    }
+}
+
+int gvn_function(ASTNode *function) {
+    Gvn gvn = {0};
+
+    for (int i = 0; i < function->data.function.param_count; i++) {
+        binding_set(&gvn, function->data.function.params[i], fresh_number(&gvn));
+    }
+    gvn_statement(&gvn, &function->data.function.body);
+
+    free(gvn.keys);
+    free(gvn.bindings);
+    free(gvn.undo);
+    free(gvn.available);
+    return gvn.replaced;
+}
\ No newline at end of file
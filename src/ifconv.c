@@ -0,0 +1,289 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ifconv.h>
+
+typedef struct {
+    int cost;
+    int operands;
+} SpeculationCost;
+
+static int convert_statement(ASTNode *node, const Profile *profile);
+
+// Safe to evaluate on a path that did not ask for it: no side effects, and
+// no division that could trap
+static bool is_speculatable(const ASTNode *node) {
+    switch (node->type) {
+        case NODE_NUMBER:
+        case NODE_VARIABLE:
+            return true;
+        case NODE_BINARY_OP: {
+            char op = node->data.binary_op.operator;
+            const ASTNode *right = node->data.binary_op.right;
+            // && and || branch anyway, so there would be nothing to gain
+            if (op == '=' || op == 'A' || op == 'O') return false;
+            if (op == '/' && (right->type != NODE_NUMBER || right->data.number.value == 0 ||
+                              right->data.number.value == -1)) {
+                return false;
+            }
+            return is_speculatable(node->data.binary_op.left) && is_speculatable(right);
+        }
+        case NODE_UNARY_OP:
+            return (node->data.unary_op.operator == '!' || node->data.unary_op.operator == 'C') &&
+                   is_speculatable(node->data.unary_op.operand);
+        default:
+            return false;
+    }
+}
+
+static void add_cost(SpeculationCost *total, const ASTNode *node) {
+    switch (node->type) {
+        case NODE_NUMBER:
+        case NODE_VARIABLE:
+            total->cost += IFCONV_LEAF_COST;
+            total->operands++;
+            break;
+        case NODE_BINARY_OP:
+            switch (node->data.binary_op.operator) {
+                case '*': total->cost += IFCONV_MUL_COST; break;
+                case '/': total->cost += IFCONV_DIV_COST; break;
+                default:  total->cost += IFCONV_ALU_COST; break;
+            }
+            add_cost(total, node->data.binary_op.left);
+            add_cost(total, node->data.binary_op.right);
+            break;
+        case NODE_UNARY_OP:
+            total->cost += IFCONV_ALU_COST;
+            add_cost(total, node->data.unary_op.operand);
+            break;
+        default:
+            break;
+    }
+}
+
+// Worth trading the branch for evaluating both values every time
+static bool profitable(const ASTNode *branch, const ASTNode *if_true,
+                       const ASTNode *if_false, const Profile *profile) {
+    SpeculationCost total = {0, 0};
+    add_cost(&total, if_true);
+    add_cost(&total, if_false);
+    if (total.cost > IFCONV_MAX_COST || total.operands > IFCONV_MAX_OPERANDS) return false;
+
+    // A measured, lopsided branch is predicted almost for free
+    long taken = profile_count(profile, branch, 0);
+    long not_taken = profile_count(profile, branch, 1);
+    if (taken >= 0 && not_taken >= 0 && taken + not_taken > 0) {
+        long common = taken > not_taken ? taken : not_taken;
+        if ((double)common / (double)(taken + not_taken) >= IFCONV_PREDICTABLE_BIAS) return false;
+    }
+    return true;
+}
+
+// The only statement of a branch, looking through a one-statement block
+static ASTNode *single_statement(ASTNode *node) {
+    while (node && node->type == NODE_BLOCK) {
+        if (node->data.block.statement_count != 1) return NULL;
+        node = node->data.block.statements[0];
+    }
+    return node;
+}
+
+// Of a variable: a store to an element cannot be made unconditional
+static bool is_assignment(const ASTNode *node) {
+    return node && node->type == NODE_BINARY_OP && node->data.binary_op.operator == '=' &&
+           node->data.binary_op.left->type == NODE_VARIABLE;
+}
+
+static bool is_value_return(const ASTNode *node) {
+    return node && node->type == NODE_RETURN && node->data.return_stmt.expression;
+}
+
+static char inverted_comparison(char op) {
+    switch (op) {
+        case '<': return 'G';
+        case 'G': return '<';
+        case '>': return 'L';
+        case 'L': return '>';
+        case 'E': return 'N';
+        case 'N': return 'E';
+        default:  return 0;
+    }
+}
+
+static bool is_number(const ASTNode *node, long value) {
+    return node->type == NODE_NUMBER && node->data.number.value == value;
+}
+
+// Build condition ? if_true : if_false, taking ownership of all three.
+// A comparison choosing between 1 and 0 is already that value (setcc), when
+// the select is no wider than the int the comparison produces.
+static ASTNode *make_select(ASTNode *condition, ASTNode *if_true, ASTNode *if_false) {
+    char inverted = condition->type == NODE_BINARY_OP && type_size(if_true->value_type) <= 4
+                  ? inverted_comparison(condition->data.binary_op.operator) : 0;
+    if (inverted && is_number(if_true, 1) && is_number(if_false, 0)) {
+        ast_free(if_true);
+        ast_free(if_false);
+        return condition;
+    }
+    if (inverted && is_number(if_true, 0) && is_number(if_false, 1)) {
+        condition->data.binary_op.operator = inverted;
+        ast_free(if_true);
+        ast_free(if_false);
+        return condition;
+    }
+    return ast_create_select(condition, if_true, if_false);
+}
+
+// Try to replace the if statement at statements[index] of block. On success
+// the block holds the new statement and any return it absorbed is removed.
+static bool convert_if(ASTNode *block, int index, const Profile *profile) {
+    ASTNode *branch = block->data.block.statements[index];
+    ASTNode *condition = branch->data.if_stmt.condition;
+    ASTNode *then_stmt = single_statement(branch->data.if_stmt.then_branch);
+    ASTNode *else_stmt = branch->data.if_stmt.else_branch
+                       ? single_statement(branch->data.if_stmt.else_branch) : NULL;
+    if (!then_stmt || (branch->data.if_stmt.else_branch && !else_stmt)) return false;
+    if (!is_speculatable(condition)) return false;
+
+    ASTNode **true_slot = NULL;
+    ASTNode **false_slot = NULL;
+    ASTNode *following = NULL;   // Return after the if that becomes its else
+    ASTNode *result = NULL;
+
+    if (is_assignment(then_stmt)) {
+        const char *name = then_stmt->data.binary_op.left->data.variable.name;
+        true_slot = &then_stmt->data.binary_op.right;
+        if (else_stmt) {
+            if (!is_assignment(else_stmt) ||
+                strcmp(else_stmt->data.binary_op.left->data.variable.name, name) != 0) {
+                return false;
+            }
+            false_slot = &else_stmt->data.binary_op.right;
+        }
+    } else if (is_value_return(then_stmt)) {
+        true_slot = &then_stmt->data.return_stmt.expression;
+        if (!else_stmt && index + 1 < block->data.block.statement_count) {
+            following = block->data.block.statements[index + 1];
+            else_stmt = following;
+        }
+        if (!is_value_return(else_stmt)) return false;
+        false_slot = &else_stmt->data.return_stmt.expression;
+    } else {
+        return false;
+    }
+
+    // A triangle keeps the old value of the variable on the else path
+    ASTNode *current = NULL;
+    if (!false_slot) {
+        current = ast_clone(then_stmt->data.binary_op.left);
+        if (!current) return false;
+        false_slot = &current;
+    }
+
+    if (!is_speculatable(*true_slot) || !is_speculatable(*false_slot) ||
+        !profitable(branch, *true_slot, *false_slot, profile)) {
+        ast_free(current);
+        return false;
+    }
+
+    ASTNode *if_true = *true_slot;
+    ASTNode *if_false = *false_slot;
+    ASTNode *value = make_select(condition, if_true, if_false);
+    if (!value) {
+        ast_free(current);
+        return false;
+    }
+    *true_slot = NULL;
+    *false_slot = NULL;
+    branch->data.if_stmt.condition = NULL;
+
+    if (is_assignment(then_stmt)) {
+        result = ast_create_binary_op('=', then_stmt->data.binary_op.left, value);
+        then_stmt->data.binary_op.left = NULL;
+    } else {
+        result = ast_create_return(value);
+    }
+
+    ast_free(branch);
+    block->data.block.statements[index] = result;
+    if (following) {
+        ast_free(following);
+        int count = --block->data.block.statement_count;
+        memmove(&block->data.block.statements[index + 1],
+                &block->data.block.statements[index + 2],
+                sizeof(ASTNode *) * (count - index - 1));
+    }
+    return true;
+}
+
+// Inlined bodies sit inside expressions
+static int convert_expression(ASTNode *node, const Profile *profile) {
+    if (!node) return 0;
+
+    switch (node->type) {
+        case NODE_BINARY_OP:
+            return convert_expression(node->data.binary_op.left, profile) +
+                   convert_expression(node->data.binary_op.right, profile);
+        case NODE_CALL: {
+            int converted = 0;
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                converted += convert_expression(node->data.call.args[i], profile);
+            }
+            return converted;
+        }
+        case NODE_INLINE:
+            return convert_statement(node->data.inline_call.body, profile);
+        default:
+            return 0;
+    }
+}
+
+// Innermost branches first, so a converted inner if can make its parent
+// a candidate too
+static int convert_statement(ASTNode *node, const Profile *profile) {
+    if (!node) return 0;
+
+    int converted = 0;
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                ASTNode *statement = node->data.block.statements[i];
+                converted += convert_statement(statement, profile);
+                if (statement->type == NODE_IF && convert_if(node, i, profile)) converted++;
+            }
+            break;
+        case NODE_RETURN:
+            converted += convert_expression(node->data.return_stmt.expression, profile);
+            break;
+        case NODE_IF:
+            converted += convert_expression(node->data.if_stmt.condition, profile);
+            converted += convert_statement(node->data.if_stmt.then_branch, profile);
+            converted += convert_statement(node->data.if_stmt.else_branch, profile);
+            break;
+        case NODE_WHILE:
+            converted += convert_expression(node->data.while_stmt.condition, profile);
+            converted += convert_statement(node->data.while_stmt.body, profile);
+            break;
+        case NODE_FOR:
+            converted += convert_statement(node->data.for_stmt.init, profile);
+            converted += convert_expression(node->data.for_stmt.condition, profile);
+            converted += convert_statement(node->data.for_stmt.step, profile);
+            converted += convert_statement(node->data.for_stmt.body, profile);
+            break;
+        case NODE_SWITCH:
+            converted += convert_expression(node->data.switch_stmt.value, profile);
+            converted += convert_statement(node->data.switch_stmt.body, profile);
+            break;
+        case NODE_VECTOR:
+            converted += convert_statement(node->data.vector.loop, profile);
+            break;
+        default:
+            converted += convert_expression(node, profile);
+            break;
+    }
+    return converted;
+}
+
+int ifconv_function(ASTNode *function, const Profile *profile) {
+    return convert_statement(function->data.function.body, profile);
+}
\ No newline at end of file
@@ -0,0 +1,426 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inliner.h>
+
+typedef struct {
+    ASTNode *program;
+    ASTNode **sources;    // Unmodified body of each function, cloned into call sites
+    const int *sizes;     // Node count of each source, or NULL
+    const Profile *profile;
+    const char *current;  // Function whose body is being processed
+    int threshold;
+    int inline_count;     // Used to give each inlined copy unique variable names
+    int inlined;
+} Inliner;
+
+// Parameter substitution for one inlined copy
+typedef struct {
+    ASTNode *callee;
+    ASTNode **constants;  // Literal argument per parameter, or NULL
+    int id;
+} Renaming;
+
+static void inline_statement(Inliner *ctx, ASTNode *node, int loop_depth, int depth);
+
+int inliner_node_count(const ASTNode *node) {
+    if (!node) return 0;
+
+    int count = 1;
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                count += inliner_node_count(node->data.block.statements[i]);
+            }
+            break;
+        case NODE_RETURN:
+            count += inliner_node_count(node->data.return_stmt.expression);
+            break;
+        case NODE_IF:
+            count += inliner_node_count(node->data.if_stmt.condition) +
+                     inliner_node_count(node->data.if_stmt.then_branch) +
+                     inliner_node_count(node->data.if_stmt.else_branch);
+            break;
+        case NODE_WHILE:
+            count += inliner_node_count(node->data.while_stmt.condition) +
+                     inliner_node_count(node->data.while_stmt.body);
+            break;
+        case NODE_FOR:
+            count += inliner_node_count(node->data.for_stmt.init) +
+                     inliner_node_count(node->data.for_stmt.condition) +
+                     inliner_node_count(node->data.for_stmt.step) +
+                     inliner_node_count(node->data.for_stmt.body);
+            break;
+        case NODE_BINARY_OP:
+            count += inliner_node_count(node->data.binary_op.left) +
+                     inliner_node_count(node->data.binary_op.right);
+            break;
+        case NODE_UNARY_OP:
+            count += inliner_node_count(node->data.unary_op.operand);
+            break;
+        case NODE_INDEX:
+            count += inliner_node_count(node->data.index.array) +
+                     inliner_node_count(node->data.index.index);
+            break;
+        case NODE_VECTOR:
+            count += inliner_node_count(node->data.vector.loop);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                count += inliner_node_count(node->data.call.args[i]);
+            }
+            break;
+        case NODE_INLINE:
+            count += inliner_node_count(node->data.inline_call.body);
+            break;
+        case NODE_SWITCH:
+            count += inliner_node_count(node->data.switch_stmt.value) +
+                     inliner_node_count(node->data.switch_stmt.body);
+            break;
+        default:
+            break;
+    }
+    return count;
+}
+
+static int find_function(ASTNode *program, const char *name) {
+    for (int i = 0; i < program->data.program.function_count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        if (function->type == NODE_FUNCTION && strcmp(function->data.function.name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool assigns_variable(const ASTNode *node, const char *name) {
+    if (!node) return false;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                if (assigns_variable(node->data.block.statements[i], name)) return true;
+            }
+            return false;
+        case NODE_IF:
+            return assigns_variable(node->data.if_stmt.then_branch, name) ||
+                   assigns_variable(node->data.if_stmt.else_branch, name);
+        case NODE_WHILE:
+            return assigns_variable(node->data.while_stmt.body, name);
+        case NODE_FOR:
+            return assigns_variable(node->data.for_stmt.init, name) ||
+                   assigns_variable(node->data.for_stmt.step, name) ||
+                   assigns_variable(node->data.for_stmt.body, name);
+        case NODE_SWITCH:
+            return assigns_variable(node->data.switch_stmt.body, name);
+        case NODE_BINARY_OP:
+            return node->data.binary_op.operator == '=' &&
+                   node->data.binary_op.left->type == NODE_VARIABLE &&
+                   strcmp(node->data.binary_op.left->data.variable.name, name) == 0;
+        default:
+            return false;
+    }
+}
+
+static int parameter_index(ASTNode *callee, const char *name) {
+    for (int i = 0; i < callee->data.function.param_count; i++) {
+        if (strcmp(callee->data.function.params[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+// Give the callee's variables names private to this copy, and substitute
+// literal arguments for parameters the callee never assigns
+static void rename_variables(ASTNode **slot, Renaming *renaming) {
+    ASTNode *node = *slot;
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_VARIABLE: {
+            if (node->data.variable.is_global) break;   // Shared with the caller
+            int param = parameter_index(renaming->callee, node->data.variable.name);
+            if (param >= 0 && renaming->constants[param]) {
+                *slot = ast_clone(renaming->constants[param]);
+                ast_free(node);
+                return;
+            }
+
+            char name[300];
+            snprintf(name, sizeof(name), "%s.inl%d", node->data.variable.name, renaming->id);
+            free(node->data.variable.name);
+            node->data.variable.name = strdup(name);
+            break;
+        }
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                rename_variables(&node->data.block.statements[i], renaming);
+            }
+            break;
+        case NODE_RETURN:
+            rename_variables(&node->data.return_stmt.expression, renaming);
+            break;
+        case NODE_IF:
+            rename_variables(&node->data.if_stmt.condition, renaming);
+            rename_variables(&node->data.if_stmt.then_branch, renaming);
+            rename_variables(&node->data.if_stmt.else_branch, renaming);
+            break;
+        case NODE_WHILE:
+            rename_variables(&node->data.while_stmt.condition, renaming);
+            rename_variables(&node->data.while_stmt.body, renaming);
+            break;
+        case NODE_FOR:
+            rename_variables(&node->data.for_stmt.init, renaming);
+            rename_variables(&node->data.for_stmt.condition, renaming);
+            rename_variables(&node->data.for_stmt.step, renaming);
+            rename_variables(&node->data.for_stmt.body, renaming);
+            break;
+        case NODE_BINARY_OP:
+            rename_variables(&node->data.binary_op.left, renaming);
+            rename_variables(&node->data.binary_op.right, renaming);
+            break;
+        case NODE_UNARY_OP:
+            rename_variables(&node->data.unary_op.operand, renaming);
+            break;
+        case NODE_INDEX:
+            rename_variables(&node->data.index.array, renaming);
+            rename_variables(&node->data.index.index, renaming);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                rename_variables(&node->data.call.args[i], renaming);
+            }
+            break;
+        case NODE_INLINE:
+            rename_variables(&node->data.inline_call.body, renaming);
+            break;
+        case NODE_SWITCH:
+            rename_variables(&node->data.switch_stmt.value, renaming);
+            rename_variables(&node->data.switch_stmt.body, renaming);
+            break;
+        default:
+            break;
+    }
+}
+
+static bool should_inline(Inliner *ctx, ASTNode *call, int callee_index, int loop_depth) {
+    ASTNode *callee = ctx->program->data.program.functions[callee_index];
+    if (callee->data.function.param_count != call->data.call.arg_count) return false;
+
+    int constant_args = 0;
+    for (int i = 0; i < call->data.call.arg_count; i++) {
+        if (call->data.call.args[i]->type == NODE_NUMBER) constant_args++;
+    }
+    if (loop_depth > INLINER_MAX_LOOP_DEPTH) loop_depth = INLINER_MAX_LOOP_DEPTH;
+
+    int size = ctx->sizes ? ctx->sizes[callee_index]
+                          : inliner_node_count(ctx->sources[callee_index]);
+    int benefit = INLINER_CALL_BENEFIT + INLINER_CONST_ARG_BENEFIT * constant_args;
+
+    long count = profile_count(ctx->profile, call, 0);
+    if (count == 0) return false;   // Cold: not worth the code growth
+    if (count > 0) {
+        bool hot = count * INLINER_HOT_FRACTION >= ctx->profile->max_count;
+        if (hot) benefit += INLINER_HOT_BENEFIT;
+    } else {
+        benefit += INLINER_LOOP_BENEFIT * loop_depth;
+    }
+    return size - benefit <= ctx->threshold;
+}
+
+// Build the inlined copy: parameter assignments followed by the callee body
+static ASTNode *inline_call(Inliner *ctx, ASTNode *call, int callee_index) {
+    ASTNode *callee = ctx->program->data.program.functions[callee_index];
+    int param_count = callee->data.function.param_count;
+
+    Renaming renaming;
+    renaming.callee = callee;
+    renaming.id = ctx->inline_count++;
+    renaming.constants = calloc(param_count + 1, sizeof(ASTNode *));
+    if (!renaming.constants) return NULL;
+
+    ASTNode *body = ast_clone(ctx->sources[callee_index]);
+    if (!body) {
+        free(renaming.constants);
+        return NULL;
+    }
+
+    ASTNode **statements = malloc(sizeof(ASTNode *) * (param_count + body->data.block.statement_count + 1));
+    if (!statements) {
+        free(renaming.constants);
+        ast_free(body);
+        return NULL;
+    }
+
+    int count = 0;
+    for (int i = 0; i < param_count; i++) {
+        ASTNode *arg = call->data.call.args[i];
+        const char *param = callee->data.function.params[i];
+        if (arg->type == NODE_NUMBER && !assigns_variable(body, param)) {
+            renaming.constants[i] = arg;
+            continue;
+        }
+
+        char name[300];
+        snprintf(name, sizeof(name), "%s.inl%d", param, renaming.id);
+        ASTNode *variable = ast_create_variable(name);
+        if (variable) variable->value_type = callee->data.function.param_types[i];
+        statements[count++] = ast_create_binary_op('=', variable, arg);
+        call->data.call.args[i] = NULL;
+    }
+
+    rename_variables(&body, &renaming);
+    for (int i = 0; i < body->data.block.statement_count; i++) {
+        statements[count++] = body->data.block.statements[i];
+    }
+    free(body->data.block.statements);
+    body->data.block.statements = statements;
+    body->data.block.statement_count = count;
+
+    free(renaming.constants);
+
+    // The copy counts as the call site it replaces
+    ASTNode *inlined = ast_create_inline(callee->data.function.name, body);
+    if (inlined) {
+        inlined->profile_id = call->profile_id;
+        inlined->value_type = call->value_type;
+    }
+    return inlined;
+}
+
+static void inline_expression(Inliner *ctx, ASTNode **slot, int loop_depth, int depth) {
+    ASTNode *node = *slot;
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BINARY_OP:
+            inline_expression(ctx, &node->data.binary_op.left, loop_depth, depth);
+            inline_expression(ctx, &node->data.binary_op.right, loop_depth, depth);
+            break;
+        case NODE_UNARY_OP:
+            inline_expression(ctx, &node->data.unary_op.operand, loop_depth, depth);
+            break;
+        case NODE_INDEX:
+            inline_expression(ctx, &node->data.index.index, loop_depth, depth);
+            break;
+        case NODE_INLINE:
+            inline_statement(ctx, node->data.inline_call.body, loop_depth, depth);
+            break;
+        case NODE_CALL: {
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                inline_expression(ctx, &node->data.call.args[i], loop_depth, depth);
+            }
+
+            int callee = find_function(ctx->program, node->data.call.name);
+            if (callee < 0 || depth >= INLINER_MAX_DEPTH) break;
+            if (!should_inline(ctx, node, callee, loop_depth)) break;
+
+            ASTNode *inlined = inline_call(ctx, node, callee);
+            if (!inlined) break;
+            ctx->inlined++;
+            *slot = inlined;
+            ast_free(node);
+
+            // Calls inside the copied body are candidates one level deeper
+            inline_statement(ctx, inlined->data.inline_call.body, loop_depth, depth + 1);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void inline_statement(Inliner *ctx, ASTNode *node, int loop_depth, int depth) {
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                ASTNode **slot = &node->data.block.statements[i];
+                if ((*slot)->type == NODE_CALL) {
+                    inline_expression(ctx, slot, loop_depth, depth);
+                } else {
+                    inline_statement(ctx, *slot, loop_depth, depth);
+                }
+            }
+            break;
+        case NODE_RETURN: {
+            // Self-recursive tail calls become loops in codegen, which beats
+            // unrolling a few levels of the recursion
+            ASTNode *expr = node->data.return_stmt.expression;
+            if (depth == 0 && expr && expr->type == NODE_CALL &&
+                strcmp(expr->data.call.name, ctx->current) == 0) {
+                for (int i = 0; i < expr->data.call.arg_count; i++) {
+                    inline_expression(ctx, &expr->data.call.args[i], loop_depth, depth);
+                }
+                break;
+            }
+            inline_expression(ctx, &node->data.return_stmt.expression, loop_depth, depth);
+            break;
+        }
+        case NODE_IF:
+            inline_expression(ctx, &node->data.if_stmt.condition, loop_depth, depth);
+            inline_statement(ctx, node->data.if_stmt.then_branch, loop_depth, depth);
+            inline_statement(ctx, node->data.if_stmt.else_branch, loop_depth, depth);
+            break;
+        case NODE_WHILE:
+            inline_expression(ctx, &node->data.while_stmt.condition, loop_depth + 1, depth);
+            inline_statement(ctx, node->data.while_stmt.body, loop_depth + 1, depth);
+            break;
+        case NODE_FOR:
+            inline_statement(ctx, node->data.for_stmt.init, loop_depth, depth);
+            inline_expression(ctx, &node->data.for_stmt.condition, loop_depth + 1, depth);
+            inline_statement(ctx, node->data.for_stmt.step, loop_depth + 1, depth);
+            inline_statement(ctx, node->data.for_stmt.body, loop_depth + 1, depth);
+            break;
+        case NODE_SWITCH:
+            inline_expression(ctx, &node->data.switch_stmt.value, loop_depth, depth);
+            inline_statement(ctx, node->data.switch_stmt.body, loop_depth, depth);
+            break;
+        case NODE_BINARY_OP:
+            inline_expression(ctx, &node->data.binary_op.left, loop_depth, depth);
+            inline_expression(ctx, &node->data.binary_op.right, loop_depth, depth);
+            break;
+        case NODE_INLINE:
+            inline_statement(ctx, node->data.inline_call.body, loop_depth, depth);
+            break;
+        default:
+            break;
+    }
+}
+
+int inliner_run(ASTNode *program, int threshold, const int *sizes, const Profile *profile) {
+    if (threshold < 0) return 0;
+
+    int count = program->data.program.function_count;
+    Inliner ctx;
+    ctx.program = program;
+    ctx.current = NULL;
+    ctx.threshold = threshold;
+    ctx.sizes = sizes;
+    ctx.profile = profile;
+    ctx.inline_count = 0;
+    ctx.inlined = 0;
+    ctx.sources = calloc(count + 1, sizeof(ASTNode *));
+    if (!ctx.sources) return 0;
+
+    for (int i = 0; i < count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        if (function->type == NODE_FUNCTION) {
+            ctx.sources[i] = ast_clone(function->data.function.body);
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        if (function->type == NODE_FUNCTION) {
+            ctx.current = function->data.function.name;
+            inline_statement(&ctx, function->data.function.body, 0, 0);
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        ast_free(ctx.sources[i]);
+    }
+    free(ctx.sources);
+    return ctx.inlined;
+}
\ No newline at end of file
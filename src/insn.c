@@ -0,0 +1,407 @@
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <insn.h>
+
+// Register aliases, grouped by the 64-bit register they belong to
+static const char *reg_families[][5] = {
+    {"rax", "eax", "ax", "al", "ah"},
+    {"rbx", "ebx", "bx", "bl", "bh"},
+    {"rcx", "ecx", "cx", "cl", "ch"},
+    {"rdx", "edx", "dx", "dl", "dh"},
+    {"rsi", "esi", "si", "sil", NULL},
+    {"rdi", "edi", "di", "dil", NULL},
+    {"rbp", "ebp", "bp", "bpl", NULL},
+    {"rsp", "esp", "sp", "spl", NULL},
+    {"r8", "r8d", "r8w", "r8b", NULL},
+    {"r9", "r9d", "r9w", "r9b", NULL},
+    {"r10", "r10d", "r10w", "r10b", NULL},
+    {"r11", "r11d", "r11w", "r11b", NULL},
+    {"r12", "r12d", "r12w", "r12b", NULL},
+    {"r13", "r13d", "r13w", "r13b", NULL},
+    {"r14", "r14d", "r14w", "r14b", NULL},
+    {"r15", "r15d", "r15w", "r15b", NULL},
+};
+static const int REG_FAMILY_COUNT = sizeof(reg_families) / sizeof(reg_families[0]);
+
+// Registers read or written by an instruction without being named in it
+typedef struct {
+    const char *mnemonic;
+    const char *regs[10];
+} ImplicitRegs;
+
+static const ImplicitRegs implicit_regs[] = {
+    {"cqo",     {"rax", "rdx", NULL}},
+    {"cqto",    {"rax", "rdx", NULL}},
+    {"cltq",    {"rax", NULL}},
+    {"cltd",    {"rax", "rdx", NULL}},
+    {"idivq",   {"rax", "rdx", NULL}},
+    {"divq",    {"rax", "rdx", NULL}},
+    {"idivl",   {"rax", "rdx", NULL}},
+    {"divl",    {"rax", "rdx", NULL}},
+    {"mulq",    {"rax", "rdx", NULL}},
+    {"call",    {"rax", "rcx", "rdx", "rsi", "rdi", "r8", "r9", "r10", "r11", "rsp"}},
+    {"syscall", {"rax", "rcx", "rdx", "rsi", "rdi", "r8", "r9", "r10", "r11", NULL}},
+    {"ret",     {"rax", "rsp", NULL}},
+    {"leave",   {"rsp", "rbp", NULL}},
+    {"pushq",   {"rsp", NULL}},
+    {"popq",    {"rsp", NULL}},
+};
+static const int IMPLICIT_REGS_COUNT = sizeof(implicit_regs) / sizeof(implicit_regs[0]);
+
+// How instructions use the flags, by mnemonic without its operand size
+// suffix (addq and addl are both "add"). Conditional jumps, setcc and cmovcc
+// are recognized by their condition codes instead. An instruction missing
+// from this table is assumed to read and write the flags.
+enum {
+    FLAGS_NONE = 0,
+    FLAGS_READ = 1,
+    FLAGS_WRITE = 2,
+    FLAGS_SHIFT = 4,     // Written unless the count is zero, so only known for an immediate
+};
+
+typedef struct {
+    const char *mnemonic;
+    int use;
+} FlagUse;
+
+static const FlagUse flag_uses[] = {
+    // Arithmetic and logic
+    {"add", FLAGS_WRITE}, {"sub", FLAGS_WRITE}, {"and", FLAGS_WRITE}, {"or", FLAGS_WRITE},
+    {"xor", FLAGS_WRITE}, {"cmp", FLAGS_WRITE}, {"test", FLAGS_WRITE}, {"neg", FLAGS_WRITE},
+    {"inc", FLAGS_WRITE}, {"dec", FLAGS_WRITE}, {"imul", FLAGS_WRITE}, {"mul", FLAGS_WRITE},
+    {"idiv", FLAGS_WRITE}, {"div", FLAGS_WRITE}, {"adc", FLAGS_READ | FLAGS_WRITE},
+    {"sbb", FLAGS_READ | FLAGS_WRITE}, {"not", FLAGS_NONE}, {"mulx", FLAGS_NONE},
+    {"andn", FLAGS_WRITE},
+    // Shifts
+    {"sal", FLAGS_SHIFT}, {"shl", FLAGS_SHIFT}, {"sar", FLAGS_SHIFT}, {"shr", FLAGS_SHIFT},
+    {"shlx", FLAGS_NONE}, {"sarx", FLAGS_NONE}, {"shrx", FLAGS_NONE},
+    // Bit operations
+    {"bt", FLAGS_WRITE}, {"bsf", FLAGS_WRITE}, {"bsr", FLAGS_WRITE}, {"popcnt", FLAGS_WRITE},
+    {"lzcnt", FLAGS_WRITE}, {"tzcnt", FLAGS_WRITE},
+    // Moves and conversions
+    {"mov", FLAGS_NONE}, {"movabs", FLAGS_NONE}, {"movzb", FLAGS_NONE}, {"movzw", FLAGS_NONE},
+    {"movsb", FLAGS_NONE}, {"movsw", FLAGS_NONE}, {"movsl", FLAGS_NONE}, {"movbe", FLAGS_NONE},
+    {"lea", FLAGS_NONE}, {"xchg", FLAGS_NONE}, {"cltq", FLAGS_NONE}, {"cltd", FLAGS_NONE},
+    {"cqo", FLAGS_NONE}, {"cqto", FLAGS_NONE}, {"cwtl", FLAGS_NONE},
+    // Stack and control flow; the callee leaves the flags undefined
+    {"push", FLAGS_NONE}, {"pop", FLAGS_NONE}, {"jmp", FLAGS_NONE}, {"call", FLAGS_WRITE},
+    {"ret", FLAGS_NONE}, {"leave", FLAGS_NONE}, {"syscall", FLAGS_NONE}, {"nop", FLAGS_NONE},
+    // SSE and AVX
+    {"movd", FLAGS_NONE}, {"movdqa", FLAGS_NONE}, {"movdqu", FLAGS_NONE}, {"paddd", FLAGS_NONE},
+    {"psubd", FLAGS_NONE}, {"pmulld", FLAGS_NONE}, {"pmuludq", FLAGS_NONE}, {"pminsd", FLAGS_NONE},
+    {"pmaxsd", FLAGS_NONE}, {"pand", FLAGS_NONE}, {"pandn", FLAGS_NONE}, {"por", FLAGS_NONE},
+    {"pxor", FLAGS_NONE}, {"pcmpgtd", FLAGS_NONE}, {"pshufd", FLAGS_NONE}, {"psrlq", FLAGS_NONE},
+    {"punpckldq", FLAGS_NONE}, {"vmovd", FLAGS_NONE}, {"vmovdqa", FLAGS_NONE},
+    {"vmovdqu", FLAGS_NONE}, {"vpaddd", FLAGS_NONE}, {"vpsubd", FLAGS_NONE},
+    {"vpmulld", FLAGS_NONE}, {"vpminsd", FLAGS_NONE}, {"vpmaxsd", FLAGS_NONE},
+    {"vpand", FLAGS_NONE}, {"vpandn", FLAGS_NONE}, {"vpor", FLAGS_NONE}, {"vpxor", FLAGS_NONE},
+    {"vpshufd", FLAGS_NONE}, {"vpbroadcastd", FLAGS_NONE}, {"vextracti128", FLAGS_NONE},
+    {"vzeroupper", FLAGS_NONE},
+};
+static const int FLAG_USE_COUNT = sizeof(flag_uses) / sizeof(flag_uses[0]);
+
+static const char *conditions[][2] = {
+    {"e", "ne"}, {"z", "nz"}, {"l", "ge"}, {"le", "g"}, {"b", "ae"},
+    {"be", "a"}, {"s", "ns"}, {"o", "no"}, {"p", "np"}, {"c", "nc"},
+};
+static const int CONDITION_COUNT = sizeof(conditions) / sizeof(conditions[0]);
+
+InsnList *insn_list_create(void) {
+    InsnList *list = malloc(sizeof(InsnList));
+    if (!list) return NULL;
+
+    list->items = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    return list;
+}
+
+void insn_list_clear(InsnList *list) {
+    for (int i = 0; i < list->count; i++) {
+        free(list->items[i].text);
+        free(list->items[i].label);
+    }
+    list->count = 0;
+}
+
+void insn_list_free(InsnList *list) {
+    if (list) {
+        insn_list_clear(list);
+        free(list->items);
+        free(list);
+    }
+}
+
+static void insn_parse(Insn *insn, const char *line) {
+    insn->text = strdup(line);
+    insn->label = NULL;
+    insn->mnemonic[0] = '\0';
+    insn->operand_count = 0;
+
+    if (line[0] != '\t') {
+        size_t len = strlen(line);
+        if (len > 0 && line[len - 1] == ':') {
+            insn->kind = INSN_LABEL;
+            insn->label = strndup(line, len - 1);
+        } else {
+            insn->kind = INSN_DIRECTIVE;
+        }
+        return;
+    }
+
+    const char *p = line + 1;
+    if (*p == '.' || *p == '#') {
+        insn->kind = INSN_DIRECTIVE;
+        return;
+    }
+
+    insn->kind = INSN_OP;
+    int i = 0;
+    while (*p && !isspace(*p) && i < (int)sizeof(insn->mnemonic) - 1) {
+        insn->mnemonic[i++] = *p++;
+    }
+    insn->mnemonic[i] = '\0';
+
+    // Split operands on top-level commas; memory operands may contain commas
+    while (*p && insn->operand_count < INSN_MAX_OPERANDS) {
+        while (*p && isspace(*p)) p++;
+        if (!*p) break;
+
+        char *out = insn->operands[insn->operand_count++];
+        int depth = 0;
+        int n = 0;
+        while (*p && (depth > 0 || *p != ',')) {
+            if (*p == '(') depth++;
+            if (*p == ')') depth--;
+            if (n < INSN_OPERAND_SIZE - 1) out[n++] = *p;
+            p++;
+        }
+        while (n > 0 && isspace(out[n - 1])) n--;
+        out[n] = '\0';
+        if (*p == ',') p++;
+    }
+}
+
+bool insn_list_append(InsnList *list, const char *line) {
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 256;
+        void *temp = realloc(list->items, sizeof(Insn) * capacity);
+        if (!temp) return false;
+        list->items = temp;
+        list->capacity = capacity;
+    }
+
+    insn_parse(&list->items[list->count++], line);
+    return true;
+}
+
+bool insn_list_splice(InsnList *dst, InsnList *src) {
+    if (dst->count + src->count > dst->capacity) {
+        int capacity = dst->capacity ? dst->capacity : 256;
+        while (capacity < dst->count + src->count) capacity *= 2;
+        void *temp = realloc(dst->items, sizeof(Insn) * capacity);
+        if (!temp) return false;
+        dst->items = temp;
+        dst->capacity = capacity;
+    }
+
+    memcpy(&dst->items[dst->count], src->items, sizeof(Insn) * src->count);
+    dst->count += src->count;
+    src->count = 0;
+    return true;
+}
+
+void insn_set(Insn *insn, const char *line) {
+    char *old_text = insn->text;
+    free(insn->label);
+    insn_parse(insn, line);
+    free(old_text);
+}
+
+void insn_delete(Insn *insn) {
+    insn->kind = INSN_DELETED;
+}
+
+void insn_list_print(InsnList *list, Output *output) {
+    for (int i = 0; i < list->count; i++) {
+        if (list->items[i].kind == INSN_DELETED) continue;
+        output_write(output, list->items[i].text, strlen(list->items[i].text));
+        output_write(output, "\n", 1);
+    }
+}
+
+bool insn_is_op(const Insn *insn, const char *mnemonic) {
+    return insn->kind == INSN_OP && strcmp(insn->mnemonic, mnemonic) == 0;
+}
+
+bool insn_is_jump(const Insn *insn) {
+    return insn->kind == INSN_OP && insn->mnemonic[0] == 'j';
+}
+
+bool insn_is_cond_jump(const Insn *insn) {
+    return insn_is_jump(insn) && strcmp(insn->mnemonic, "jmp") != 0;
+}
+
+const char *insn_jump_target(const Insn *insn) {
+    if (!insn_is_jump(insn) || insn->operand_count != 1) return NULL;
+    if (insn->operands[0][0] == '*') return NULL;  // Indirect jump
+    return insn->operands[0];
+}
+
+// Whether a mnemonic is prefix + condition code, e.g. "setge" or "cmovlq"
+static bool has_cond_suffix(const char *mnemonic, const char *prefix) {
+    size_t len = strlen(prefix);
+    if (strncmp(mnemonic, prefix, len) != 0) return false;
+    const char *cond = mnemonic + len;
+    if (insn_invert_cond(cond)) return true;
+
+    // cmov takes an optional operand size suffix
+    char stripped[4];
+    size_t cond_len = strlen(cond);
+    if (strcmp(prefix, "cmov") == 0 && cond_len > 1 && cond_len <= sizeof(stripped) &&
+        (cond[cond_len - 1] == 'q' || cond[cond_len - 1] == 'l')) {
+        memcpy(stripped, cond, cond_len - 1);
+        stripped[cond_len - 1] = '\0';
+        return insn_invert_cond(stripped) != NULL;
+    }
+    return false;
+}
+
+static int lookup_flag_use(const char *mnemonic, size_t length) {
+    for (int i = 0; i < FLAG_USE_COUNT; i++) {
+        if (strlen(flag_uses[i].mnemonic) == length &&
+            strncmp(flag_uses[i].mnemonic, mnemonic, length) == 0) {
+            return flag_uses[i].use;
+        }
+    }
+    return -1;
+}
+
+static int flag_use(const Insn *insn) {
+    const char *m = insn->mnemonic;
+    if (insn_is_cond_jump(insn) || has_cond_suffix(m, "set") || has_cond_suffix(m, "cmov")) {
+        return FLAGS_READ;
+    }
+
+    // The exact mnemonic first: psrlq and cltq are not size-suffixed forms
+    size_t length = strlen(m);
+    int use = lookup_flag_use(m, length);
+    if (use < 0 && length > 1 && strchr("bwlq", m[length - 1])) {
+        use = lookup_flag_use(m, length - 1);
+    }
+    if (use < 0) return FLAGS_READ | FLAGS_WRITE;
+
+    // A shift by %cl leaves the flags alone when the count is zero, so only
+    // a nonzero immediate, or the implicit count of one, is known to write
+    if (use == FLAGS_SHIFT) {
+        if (insn->operand_count == 1) return FLAGS_WRITE;
+        return insn->operand_count == 2 && insn->operands[0][0] == '$' &&
+               strcmp(insn->operands[0], "$0") != 0 ? FLAGS_WRITE : FLAGS_NONE;
+    }
+    return use;
+}
+
+bool insn_reads_flags(const Insn *insn) {
+    return insn->kind == INSN_OP && (flag_use(insn) & FLAGS_READ);
+}
+
+bool insn_writes_flags(const Insn *insn) {
+    return insn->kind == INSN_OP && (flag_use(insn) & FLAGS_WRITE);
+}
+
+const char *insn_reg_family(const char *reg) {
+    if (reg[0] == '%') reg++;
+    for (int i = 0; i < REG_FAMILY_COUNT; i++) {
+        for (int j = 0; j < 5 && reg_families[i][j]; j++) {
+            if (strcmp(reg, reg_families[i][j]) == 0) return reg_families[i][0];
+        }
+    }
+    return NULL;
+}
+
+const char *insn_reg32(const char *reg64) {
+    const char *family = insn_reg_family(reg64);
+    if (!family) return NULL;
+    for (int i = 0; i < REG_FAMILY_COUNT; i++) {
+        if (reg_families[i][0] == family) return reg_families[i][1];
+    }
+    return NULL;
+}
+
+const char *insn_reg_sized(const char *reg, int size) {
+    const char *family = insn_reg_family(reg);
+    if (!family) return NULL;
+    int column = size == 8 ? 0 : size == 4 ? 1 : size == 2 ? 2 : 3;
+    for (int i = 0; i < REG_FAMILY_COUNT; i++) {
+        if (reg_families[i][0] == family) return reg_families[i][column];
+    }
+    return NULL;
+}
+
+int insn_reg_size(const char *reg) {
+    if (reg[0] == '%') reg++;
+    for (int i = 0; i < REG_FAMILY_COUNT; i++) {
+        for (int j = 0; j < 5 && reg_families[i][j]; j++) {
+            if (strcmp(reg, reg_families[i][j]) == 0) return j == 0 ? 8 : j == 1 ? 4 : j == 2 ? 2 : 1;
+        }
+    }
+    return 0;
+}
+
+static bool operand_mentions_family(const char *operand, const char *family) {
+    const char *p = operand;
+    while ((p = strchr(p, '%'))) {
+        char name[8];
+        int n = 0;
+        p++;
+        while (isalnum(*p) && n < (int)sizeof(name) - 1) name[n++] = *p++;
+        name[n] = '\0';
+        const char *f = insn_reg_family(name);
+        if (f && strcmp(f, family) == 0) return true;
+    }
+    return false;
+}
+
+bool insn_mentions_reg(const Insn *insn, const char *reg) {
+    if (insn->kind != INSN_OP) return false;
+    const char *family = insn_reg_family(reg);
+    if (!family) return false;
+
+    for (int i = 0; i < insn->operand_count; i++) {
+        if (operand_mentions_family(insn->operands[i], family)) return true;
+    }
+
+    for (int i = 0; i < IMPLICIT_REGS_COUNT; i++) {
+        if (strcmp(insn->mnemonic, implicit_regs[i].mnemonic) != 0) continue;
+        for (int j = 0; j < 10 && implicit_regs[i].regs[j]; j++) {
+            if (strcmp(implicit_regs[i].regs[j], family) == 0) return true;
+        }
+    }
+
+    // One-operand multiply forms use %rax/%rdx implicitly
+    if (insn->operand_count == 1 && strncmp(insn->mnemonic, "imul", 4) == 0) {
+        return strcmp(family, "rax") == 0 || strcmp(family, "rdx") == 0;
+    }
+    return false;
+}
+
+bool insn_touches_stack(const Insn *insn) {
+    if (insn->kind != INSN_OP) return false;
+    if (strncmp(insn->mnemonic, "push", 4) == 0 ||
+        strncmp(insn->mnemonic, "pop", 3) == 0 ||
+        strcmp(insn->mnemonic, "call") == 0 ||
+        strcmp(insn->mnemonic, "ret") == 0 ||
+        strcmp(insn->mnemonic, "leave") == 0) {
+        return true;
+    }
+    return insn_mentions_reg(insn, "%rsp");
+}
+
+const char *insn_invert_cond(const char *cond) {
+    for (int i = 0; i < CONDITION_COUNT; i++) {
+        if (strcmp(cond, conditions[i][0]) == 0) return conditions[i][1];
+        if (strcmp(cond, conditions[i][1]) == 0) return conditions[i][0];
+    }
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,556 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ipcp.h>
+#include <fold.h>
+#include <inliner.h>
+
+// Arguments of a call that are literals: parameter p receives values[p]
+// when fixed[p] is set
+typedef struct {
+    int function;     // Index of the callee
+    bool *fixed;
+    long *values;
+} Signature;
+
+typedef struct {
+    Signature signature;
+    int function;     // Index of the clone
+} Clone;
+
+typedef struct {
+    Signature signature;
+    ASTNode **sites;
+    int site_count;
+    long weight;      // Calls made through the sites
+} SiteGroup;
+
+typedef struct {
+    ASTNode *call;
+    ASTNode *caller;  // Function whose body holds the call
+} CallSite;
+
+typedef struct {
+    ASTNode *program;
+    const Profile *profile;
+    CallSite *calls;        // Every call to a function of the program
+    int call_count;
+    ASTNode *caller;        // Function being scanned for calls
+    Clone *clones;
+    int clone_count;
+    ASTNode **dirty;        // Functions to fold at the end of the round
+    int dirty_count;
+    long budget;            // Nodes the clones may still add
+} Ipcp;
+
+static void collect_calls(Ipcp *ctx, ASTNode *node);
+
+static void collect_children(Ipcp *ctx, ASTNode *node) {
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                collect_calls(ctx, node->data.block.statements[i]);
+            }
+            break;
+        case NODE_RETURN:
+            collect_calls(ctx, node->data.return_stmt.expression);
+            break;
+        case NODE_IF:
+            collect_calls(ctx, node->data.if_stmt.condition);
+            collect_calls(ctx, node->data.if_stmt.then_branch);
+            collect_calls(ctx, node->data.if_stmt.else_branch);
+            break;
+        case NODE_WHILE:
+            collect_calls(ctx, node->data.while_stmt.condition);
+            collect_calls(ctx, node->data.while_stmt.body);
+            break;
+        case NODE_FOR:
+            collect_calls(ctx, node->data.for_stmt.init);
+            collect_calls(ctx, node->data.for_stmt.condition);
+            collect_calls(ctx, node->data.for_stmt.step);
+            collect_calls(ctx, node->data.for_stmt.body);
+            break;
+        case NODE_BINARY_OP:
+            collect_calls(ctx, node->data.binary_op.left);
+            collect_calls(ctx, node->data.binary_op.right);
+            break;
+        case NODE_UNARY_OP:
+            collect_calls(ctx, node->data.unary_op.operand);
+            break;
+        case NODE_INDEX:
+            collect_calls(ctx, node->data.index.index);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                collect_calls(ctx, node->data.call.args[i]);
+            }
+            break;
+        case NODE_INLINE:
+            collect_calls(ctx, node->data.inline_call.body);
+            break;
+        case NODE_SELECT:
+            collect_calls(ctx, node->data.select.condition);
+            collect_calls(ctx, node->data.select.if_true);
+            collect_calls(ctx, node->data.select.if_false);
+            break;
+        case NODE_SWITCH:
+            collect_calls(ctx, node->data.switch_stmt.value);
+            collect_calls(ctx, node->data.switch_stmt.body);
+            break;
+        default:
+            break;
+    }
+}
+
+static void collect_calls(Ipcp *ctx, ASTNode *node) {
+    if (!node) return;
+
+    collect_children(ctx, node);
+    if (node->type != NODE_CALL) return;
+
+    void *temp = realloc(ctx->calls, sizeof(CallSite) * (ctx->call_count + 1));
+    if (!temp) return;
+    ctx->calls = temp;
+    ctx->calls[ctx->call_count++] = (CallSite){node, ctx->caller};
+}
+
+static bool assigns_variable(const ASTNode *node, const char *name) {
+    if (!node) return false;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                if (assigns_variable(node->data.block.statements[i], name)) return true;
+            }
+            return false;
+        case NODE_IF:
+            return assigns_variable(node->data.if_stmt.then_branch, name) ||
+                   assigns_variable(node->data.if_stmt.else_branch, name);
+        case NODE_WHILE:
+            return assigns_variable(node->data.while_stmt.body, name);
+        case NODE_FOR:
+            return assigns_variable(node->data.for_stmt.init, name) ||
+                   assigns_variable(node->data.for_stmt.step, name) ||
+                   assigns_variable(node->data.for_stmt.body, name);
+        case NODE_SWITCH:
+            return assigns_variable(node->data.switch_stmt.body, name);
+        case NODE_INLINE:
+            return assigns_variable(node->data.inline_call.body, name);
+        case NODE_BINARY_OP:
+            return node->data.binary_op.operator == '=' &&
+                   node->data.binary_op.left->type == NODE_VARIABLE &&
+                   strcmp(node->data.binary_op.left->data.variable.name, name) == 0;
+        default:
+            return false;
+    }
+}
+
+// Replace every use of variable name by the literal value, of the
+// variable's type
+static void substitute(ASTNode **slot, const char *name, long value) {
+    ASTNode *node = *slot;
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_VARIABLE:
+            if (strcmp(node->data.variable.name, name) == 0) {
+                ASTNode *number = ast_create_number(value);
+                if (!number) return;
+                number->value_type = node->value_type;
+                ast_free(node);
+                *slot = number;
+            }
+            break;
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                substitute(&node->data.block.statements[i], name, value);
+            }
+            break;
+        case NODE_RETURN:
+            substitute(&node->data.return_stmt.expression, name, value);
+            break;
+        case NODE_IF:
+            substitute(&node->data.if_stmt.condition, name, value);
+            substitute(&node->data.if_stmt.then_branch, name, value);
+            substitute(&node->data.if_stmt.else_branch, name, value);
+            break;
+        case NODE_WHILE:
+            substitute(&node->data.while_stmt.condition, name, value);
+            substitute(&node->data.while_stmt.body, name, value);
+            break;
+        case NODE_FOR:
+            substitute(&node->data.for_stmt.init, name, value);
+            substitute(&node->data.for_stmt.condition, name, value);
+            substitute(&node->data.for_stmt.step, name, value);
+            substitute(&node->data.for_stmt.body, name, value);
+            break;
+        case NODE_BINARY_OP:
+            if (node->data.binary_op.operator != '=' ||
+                node->data.binary_op.left->type == NODE_INDEX) {
+                substitute(&node->data.binary_op.left, name, value);
+            }
+            substitute(&node->data.binary_op.right, name, value);
+            break;
+        case NODE_UNARY_OP:
+            substitute(&node->data.unary_op.operand, name, value);
+            break;
+        case NODE_INDEX:
+            // Parameters are never arrays
+            substitute(&node->data.index.index, name, value);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                substitute(&node->data.call.args[i], name, value);
+            }
+            break;
+        case NODE_INLINE:
+            substitute(&node->data.inline_call.body, name, value);
+            break;
+        case NODE_SELECT:
+            substitute(&node->data.select.condition, name, value);
+            substitute(&node->data.select.if_true, name, value);
+            substitute(&node->data.select.if_false, name, value);
+            break;
+        case NODE_SWITCH:
+            substitute(&node->data.switch_stmt.value, name, value);
+            substitute(&node->data.switch_stmt.body, name, value);
+            break;
+        default:
+            break;
+    }
+}
+
+static void mark_dirty(Ipcp *ctx, ASTNode *function) {
+    for (int i = 0; i < ctx->dirty_count; i++) {
+        if (ctx->dirty[i] == function) return;
+    }
+    void *temp = realloc(ctx->dirty, sizeof(ASTNode *) * (ctx->dirty_count + 1));
+    if (!temp) return;
+    ctx->dirty = temp;
+    ctx->dirty[ctx->dirty_count++] = function;
+}
+
+// main is entered from _start, which no call site shows
+static bool is_specializable(const ASTNode *function) {
+    return function->type == NODE_FUNCTION && function->data.function.param_count > 0 &&
+           strcmp(function->data.function.name, "main") != 0;
+}
+
+// The calls to function, or NULL when there are none or one of them
+// passes the wrong number of arguments
+static CallSite *find_sites(Ipcp *ctx, const ASTNode *function, int *count) {
+    CallSite *sites = malloc(sizeof(CallSite) * (ctx->call_count + 1));
+    if (!sites) return NULL;
+
+    *count = 0;
+    for (int i = 0; i < ctx->call_count; i++) {
+        ASTNode *call = ctx->calls[i].call;
+        if (strcmp(call->data.call.name, function->data.function.name) != 0) continue;
+        if (call->data.call.arg_count != function->data.function.param_count) {
+            free(sites);
+            return NULL;
+        }
+        sites[(*count)++] = ctx->calls[i];
+    }
+    if (*count == 0) {
+        free(sites);
+        return NULL;
+    }
+    return sites;
+}
+
+static void remove_argument(ASTNode *call, int index) {
+    ast_free(call->data.call.args[index]);
+    memmove(&call->data.call.args[index], &call->data.call.args[index + 1],
+            sizeof(ASTNode *) * (call->data.call.arg_count - index - 1));
+    call->data.call.arg_count--;
+}
+
+// A recursive call handing parameter p on unchanged
+static bool passes_through(const CallSite *site, const ASTNode *function, int p) {
+    const ASTNode *arg = site->call->data.call.args[p];
+    return site->caller == function && arg->type == NODE_VARIABLE &&
+           strcmp(arg->data.variable.name, function->data.function.params[p]) == 0;
+}
+
+// Parameters on which all call sites agree become literals in the callee
+static int propagate(Ipcp *ctx, ASTNode *function) {
+    int site_count;
+    CallSite *sites = find_sites(ctx, function, &site_count);
+    if (!sites) return 0;
+
+    int propagated = 0;
+    for (int p = function->data.function.param_count - 1; p >= 0; p--) {
+        char *param = function->data.function.params[p];
+        if (assigns_variable(function->data.function.body, param)) continue;
+
+        bool found = false;
+        bool agreed = true;
+        long value = 0;
+        for (int s = 0; s < site_count && agreed; s++) {
+            long other;
+            if (passes_through(&sites[s], function, p)) continue;
+            agreed = fold_constant(sites[s].call->data.call.args[p], &other) &&
+                     (!found || other == value);
+            found = true;
+            value = other;
+        }
+        if (!found || !agreed) continue;
+
+        substitute(&function->data.function.body, param, value);
+        free(param);
+        memmove(&function->data.function.params[p], &function->data.function.params[p + 1],
+                sizeof(char *) * (function->data.function.param_count - p - 1));
+        memmove(&function->data.function.param_types[p], &function->data.function.param_types[p + 1],
+                sizeof(TypeKind) * (function->data.function.param_count - p - 1));
+        function->data.function.param_count--;
+        for (int s = 0; s < site_count; s++) remove_argument(sites[s].call, p);
+        propagated++;
+    }
+
+    if (propagated) mark_dirty(ctx, function);
+    free(sites);
+    return propagated;
+}
+
+static bool signature_equal(const Signature *a, const Signature *b, int param_count) {
+    if (a->function != b->function) return false;
+    for (int p = 0; p < param_count; p++) {
+        if (a->fixed[p] != b->fixed[p]) return false;
+        if (a->fixed[p] && a->values[p] != b->values[p]) return false;
+    }
+    return true;
+}
+
+static void signature_free(Signature *signature) {
+    free(signature->fixed);
+    free(signature->values);
+}
+
+static int compare_groups(const void *a, const void *b) {
+    long x = ((const SiteGroup *)a)->weight;
+    long y = ((const SiteGroup *)b)->weight;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+// Copy of a function with the fixed parameters replaced by their values;
+// returns its index in the program, or -1
+static int create_clone(Ipcp *ctx, const Signature *signature, int param_count) {
+    ASTNode *program = ctx->program;
+    ASTNode *original = program->data.program.functions[signature->function];
+    void *temp = realloc(ctx->clones, sizeof(Clone) * (ctx->clone_count + 1));
+    if (!temp) return -1;
+    ctx->clones = temp;
+    temp = realloc(program->data.program.functions,
+                   sizeof(ASTNode *) * (program->data.program.function_count + 1));
+    if (!temp) return -1;
+    program->data.program.functions = temp;
+
+    char **params = malloc(sizeof(char *) * (param_count + 1));
+    TypeKind *param_types = malloc(sizeof(TypeKind) * (param_count + 1));
+    ASTNode *body = ast_clone(original->data.function.body);
+    if (!params || !param_types || !body) {
+        free(params);
+        free(param_types);
+        ast_free(body);
+        return -1;
+    }
+
+    int kept = 0;
+    for (int p = 0; p < param_count; p++) {
+        const char *param = original->data.function.params[p];
+        if (signature->fixed[p]) {
+            substitute(&body, param, signature->values[p]);
+        } else {
+            param_types[kept] = original->data.function.param_types[p];
+            params[kept++] = (char *)param;
+        }
+    }
+
+    char name[300];
+    snprintf(name, sizeof(name), "%s.constprop.%d", original->data.function.name, ctx->clone_count);
+    ASTNode *function = ast_create_function(name, params, param_types, kept, body);
+    free(params);
+    free(param_types);
+    if (!function) {
+        ast_free(body);
+        return -1;
+    }
+    function->data.function.return_type = original->data.function.return_type;
+    // Its entry shares the counter of the original
+    function->profile_id = original->profile_id;
+
+    Clone *clone = &ctx->clones[ctx->clone_count];
+    clone->signature.function = signature->function;
+    clone->signature.fixed = malloc(sizeof(bool) * (param_count + 1));
+    clone->signature.values = malloc(sizeof(long) * (param_count + 1));
+    if (!clone->signature.fixed || !clone->signature.values) {
+        signature_free(&clone->signature);
+        ast_free(function);
+        return -1;
+    }
+    memcpy(clone->signature.fixed, signature->fixed, sizeof(bool) * param_count);
+    memcpy(clone->signature.values, signature->values, sizeof(long) * param_count);
+    clone->function = program->data.program.function_count;
+    ctx->clone_count++;
+
+    program->data.program.functions[program->data.program.function_count++] = function;
+    mark_dirty(ctx, function);
+    return clone->function;
+}
+
+static void redirect(ASTNode *call, const ASTNode *clone, const Signature *signature) {
+    char *name = strdup(clone->data.function.name);
+    if (!name) return;
+    free(call->data.call.name);
+    call->data.call.name = name;
+
+    for (int p = call->data.call.arg_count - 1; p >= 0; p--) {
+        if (signature->fixed[p]) remove_argument(call, p);
+    }
+}
+
+// Group the call sites of a function by their literal arguments and send
+// each group to a clone specialized for them
+static int specialize(Ipcp *ctx, int index) {
+    ASTNode *function = ctx->program->data.program.functions[index];
+    int param_count = function->data.function.param_count;
+    int site_count;
+    CallSite *sites = find_sites(ctx, function, &site_count);
+    bool *eligible = calloc(param_count + 1, sizeof(bool));
+    SiteGroup *groups = calloc(site_count + 1, sizeof(SiteGroup));
+    int group_count = 0;
+    int redirected = 0;
+
+    if (!sites || !eligible || !groups) {
+        free(sites);
+        free(eligible);
+        free(groups);
+        return 0;
+    }
+
+    for (int p = 0; p < param_count; p++) {
+        eligible[p] = !assigns_variable(function->data.function.body, function->data.function.params[p]);
+    }
+
+    for (int s = 0; s < site_count; s++) {
+        ASTNode *site = sites[s].call;
+        long count = profile_count(ctx->profile, site, 0);
+        if (count == 0) continue;   // Cold: not worth a copy
+
+        Signature signature = {index, calloc(param_count + 1, sizeof(bool)),
+                               calloc(param_count + 1, sizeof(long))};
+        bool any = false;
+        for (int p = 0; signature.fixed && signature.values && p < param_count; p++) {
+            signature.fixed[p] = eligible[p] &&
+                                 fold_constant(site->data.call.args[p], &signature.values[p]);
+            any = any || signature.fixed[p];
+        }
+        if (!any) {
+            signature_free(&signature);
+            continue;
+        }
+
+        int g = 0;
+        while (g < group_count && !signature_equal(&groups[g].signature, &signature, param_count)) g++;
+        if (g == group_count) {
+            groups[g].signature = signature;
+            groups[g].sites = malloc(sizeof(ASTNode *) * (site_count + 1));
+            group_count++;
+        } else {
+            signature_free(&signature);
+        }
+        if (!groups[g].sites) continue;
+        groups[g].sites[groups[g].site_count++] = site;
+        groups[g].weight += count > 0 ? count : 1;
+    }
+    qsort(groups, group_count, sizeof(SiteGroup), compare_groups);
+
+    int size = inliner_node_count(function->data.function.body);
+    for (int g = 0; g < group_count; g++) {
+        SiteGroup *group = &groups[g];
+        int clone = -1;
+        int clones_of_function = 0;
+        for (int c = 0; c < ctx->clone_count; c++) {
+            if (ctx->clones[c].signature.function != index) continue;
+            clones_of_function++;
+            if (signature_equal(&ctx->clones[c].signature, &group->signature, param_count)) {
+                clone = ctx->clones[c].function;
+            }
+        }
+
+        if (clone < 0) {
+            if (clones_of_function >= IPCP_MAX_CLONES || size > ctx->budget) continue;
+            clone = create_clone(ctx, &group->signature, param_count);
+            if (clone < 0) continue;
+            ctx->budget -= size;
+        }
+
+        ASTNode *target = ctx->program->data.program.functions[clone];
+        for (int s = 0; s < group->site_count; s++) {
+            redirect(group->sites[s], target, &group->signature);
+            redirected++;
+        }
+    }
+
+    for (int g = 0; g < group_count; g++) {
+        signature_free(&groups[g].signature);
+        free(groups[g].sites);
+    }
+    free(groups);
+    free(eligible);
+    free(sites);
+    return redirected;
+}
+
+int ipcp_run(ASTNode *program, int growth_percent, const Profile *profile) {
+    Ipcp ctx = {program, profile, NULL, 0, NULL, NULL, 0, NULL, 0, 0};
+    int changed = 0;
+
+    long program_size = 0;
+    for (int i = 0; i < program->data.program.function_count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        if (function->type == NODE_FUNCTION) {
+            program_size += inliner_node_count(function->data.function.body);
+        }
+    }
+    ctx.budget = program_size * growth_percent / 100;
+    if (growth_percent > 0 && ctx.budget < IPCP_MIN_GROWTH) ctx.budget = IPCP_MIN_GROWTH;
+
+    // Each round sees the calls made by the bodies the last one created,
+    // so a recursive clone comes to call itself
+    for (int round = 0; round < IPCP_MAX_ROUNDS; round++) {
+        int function_count = program->data.program.function_count;
+        int round_changes = 0;
+
+        ctx.call_count = 0;
+        for (int i = 0; i < function_count; i++) {
+            ASTNode *function = program->data.program.functions[i];
+            if (function->type != NODE_FUNCTION) continue;
+            ctx.caller = function;
+            collect_calls(&ctx, function->data.function.body);
+        }
+
+        for (int i = 0; i < function_count; i++) {
+            ASTNode *function = program->data.program.functions[i];
+            if (is_specializable(function)) round_changes += propagate(&ctx, function);
+        }
+        for (int i = 0; i < function_count && growth_percent > 0; i++) {
+            ASTNode *function = program->data.program.functions[i];
+            if (is_specializable(function)) round_changes += specialize(&ctx, i);
+        }
+
+        // Folding may delete calls, so it waits until the round is done
+        for (int i = 0; i < ctx.dirty_count; i++) fold_function(ctx.dirty[i]);
+        ctx.dirty_count = 0;
+
+        changed += round_changes;
+        if (round_changes == 0) break;
+    }
+
+    for (int c = 0; c < ctx.clone_count; c++) signature_free(&ctx.clones[c].signature);
+    free(ctx.clones);
+    free(ctx.calls);
+    free(ctx.dirty);
+    return changed;
+}
\ No newline at end of file
@@ -0,0 +1,621 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <isel.h>
+
+// Pattern trees of the rules, one node per entry
+typedef struct {
+    bool terminal;       // Else a nonterminal leaf
+    short symbol;        // ISEL_<TERM> or ISEL_NT_<NAME>
+    short kids[2];       // Operand patterns, -1 if none
+} IselPattern;
+
+typedef struct {
+    short lhs;           // Nonterminal derived
+    short pattern;       // Root in isel_patterns
+    short leaves;        // Nonterminal leaves in the pattern
+    bool (*predicate)(const ASTNode *node);  // If set, must accept the root node
+    const char *code;    // Instructions, one per line, or NULL
+    const char *result;  // Operand the rule gives its parent, or NULL
+} IselRule;
+
+#include <isel_rules.h>
+
+#define ISEL_NO_COVER (INT_MAX / 4)
+#define ISEL_OPERAND_SIZE 288          // Fits a symbol of 255 characters and (%rip)
+
+// An expression node with the cheapest derivation of each nonterminal
+typedef struct Label {
+    ASTNode *node;
+    int op;                          // ISEL_<TERM>
+    struct Label *kids[2];
+    int cost[ISEL_NT_COUNT];         // ISEL_NO_COVER if not derivable
+    short rule[ISEL_NT_COUNT];       // -1 if not derivable
+} Label;
+
+// Operand of a nonterminal leaf: the 64-bit name of a register, printed
+// at the width of the type of the value in it, or the text of an operand
+// folded into the instruction
+typedef struct {
+    char text[ISEL_OPERAND_SIZE];
+    bool is_reg;
+    TypeKind type;
+} Operand;
+
+// The derivation being emitted and the registers its reg leaves are in
+typedef struct {
+    CodeGenerator *gen;
+    const char *target;              // Result register
+    Label *leaves[ISEL_MAX_REGS];
+    const char *registers[ISEL_MAX_REGS];
+    int leaf_count;
+} Cover;
+
+static const char *conditions[][2] = {
+    // Condition and the one that holds with the operands swapped
+    {"e", "e"}, {"ne", "ne"}, {"l", "g"}, {"g", "l"}, {"le", "ge"}, {"ge", "le"},
+    {"b", "a"}, {"a", "b"}, {"be", "ae"}, {"ae", "be"}
+};
+static const int CONDITION_COUNT = sizeof(conditions) / sizeof(conditions[0]);
+
+// Condition code suffix for each relational operator, or NULL
+static const char *comparison_condition(char operator) {
+    switch (operator) {
+        case '>': return "g";
+        case '<': return "l";
+        case 'G': return "ge";
+        case 'L': return "le";
+        case 'E': return "e";
+        case 'N': return "ne";
+        default:  return NULL;
+    }
+}
+
+// The same comparison of unsigned operands: below and above instead of
+// less and greater
+static const char *unsigned_condition(const char *cond) {
+    if (strcmp(cond, "l") == 0) return "b";
+    if (strcmp(cond, "g") == 0) return "a";
+    if (strcmp(cond, "le") == 0) return "be";
+    if (strcmp(cond, "ge") == 0) return "ae";
+    return cond;
+}
+
+static const char *swapped_condition(const char *cond) {
+    for (int i = 0; i < CONDITION_COUNT; i++) {
+        if (strcmp(conditions[i][0], cond) == 0) return conditions[i][1];
+    }
+    return NULL;
+}
+
+// Constants of operations up to 32 bits are always immediates; 64-bit
+// ones are sign-extended from 32 bits
+static bool isel_pred_imm32(const ASTNode *node) {
+    long value = node->data.number.value;
+    return type_size(node->value_type) <= 4 || (value >= INT_MIN && value <= INT_MAX);
+}
+
+// Constants movl can load, zero-extending to 64 bits
+static bool isel_pred_movl(const ASTNode *node) {
+    long value = node->data.number.value;
+    return type_size(node->value_type) <= 4 || (value >= 0 && value <= (long)UINT_MAX);
+}
+
+static bool isel_pred_scale(const ASTNode *node) {
+    long value = node->data.number.value;
+    return value == 1 || value == 2 || value == 4 || value == 8;
+}
+
+static bool isel_pred_zero(const ASTNode *node) {
+    return node->data.number.value == 0;
+}
+
+// Powers of two from 2; 1 is left to constant folding. Signed division
+// adds the divisor minus one as a displacement, which must fit 32 bits.
+static bool isel_pred_pow2(const ASTNode *node) {
+    unsigned long value = node->data.number.value;
+    if (type_is_signed(node->value_type) && value > (1UL << 31)) return false;
+    return value > 1 && (value & (value - 1)) == 0;
+}
+
+// Elements at a constant index inside the array, whose address is known
+static bool isel_pred_inbounds(const ASTNode *node) {
+    const ASTNode *index = node->data.index.index;
+    return index->type == NODE_NUMBER && index->data.number.value >= 0 &&
+           index->data.number.value < node->data.index.array->data.variable.length;
+}
+
+// Elements, by where their array is
+static bool isel_pred_local(const ASTNode *node) { return !node->data.index.array->data.variable.is_global; }
+static bool isel_pred_global(const ASTNode *node) { return node->data.index.array->data.variable.is_global; }
+
+// Loads of narrow variables, extended to 32 bits
+static bool isel_pred_sbyte(const ASTNode *node) { return node->value_type == TYPE_CHAR; }
+static bool isel_pred_ubyte(const ASTNode *node) { return node->value_type == TYPE_UCHAR; }
+static bool isel_pred_sword(const ASTNode *node) { return node->value_type == TYPE_SHORT; }
+static bool isel_pred_uword(const ASTNode *node) { return node->value_type == TYPE_USHORT; }
+
+// Conversions, by the type converted from and the size converted to
+static bool converts(const ASTNode *node, TypeKind from, int min_size, int max_size) {
+    int size = type_size(node->value_type);
+    return node->data.unary_op.operand->value_type == from && size >= min_size && size <= max_size;
+}
+
+static bool isel_pred_narrow(const ASTNode *node) {
+    return type_size(node->value_type) <= type_size(node->data.unary_op.operand->value_type);
+}
+
+static bool isel_pred_sext8(const ASTNode *node) { return converts(node, TYPE_CHAR, 2, 4); }
+static bool isel_pred_sext8q(const ASTNode *node) { return converts(node, TYPE_CHAR, 8, 8); }
+static bool isel_pred_zext8(const ASTNode *node) { return converts(node, TYPE_UCHAR, 2, 8); }
+static bool isel_pred_sext16(const ASTNode *node) { return converts(node, TYPE_SHORT, 4, 4); }
+static bool isel_pred_sext16q(const ASTNode *node) { return converts(node, TYPE_SHORT, 8, 8); }
+static bool isel_pred_zext16(const ASTNode *node) { return converts(node, TYPE_USHORT, 4, 8); }
+static bool isel_pred_sext32(const ASTNode *node) { return converts(node, TYPE_INT, 8, 8); }
+static bool isel_pred_zext32(const ASTNode *node) { return converts(node, TYPE_UINT, 8, 8); }
+
+// Divisions, by the size and signedness of their type
+static bool isel_pred_signed32(const ASTNode *node) {
+    return type_size(node->value_type) <= 4 && type_is_signed(node->value_type);
+}
+
+static bool isel_pred_unsigned32(const ASTNode *node) {
+    return type_size(node->value_type) <= 4 && !type_is_signed(node->value_type);
+}
+
+static bool isel_pred_signed64(const ASTNode *node) {
+    return type_size(node->value_type) == 8 && type_is_signed(node->value_type);
+}
+
+static bool isel_pred_unsigned64(const ASTNode *node) {
+    return type_size(node->value_type) == 8 && !type_is_signed(node->value_type);
+}
+
+// Signed division by d >= 2: the quotient is the high half of n * M,
+// shifted right by shift and rounded towards zero, where M is the
+// smallest multiplier that is exact for all 64-bit n (Hacker's Delight
+// 10-1). M above 2^63 reads as negative, so n is added back to the high
+// half (returns true).
+static bool divide_magic(long divisor, unsigned long *multiplier, int *shift) {
+    const unsigned long two63 = 1UL << 63;
+    unsigned long d = divisor;
+    unsigned long anc = two63 - 1 - two63 % d;   // |nc|, the largest multiple of d minus one
+    unsigned long q1 = two63 / anc, r1 = two63 - q1 * anc;
+    unsigned long q2 = two63 / d, r2 = two63 - q2 * d;
+    unsigned long delta;
+    int p = 63;
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= d) {
+            q2++;
+            r2 -= d;
+        }
+        delta = d - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    *multiplier = q2 + 1;
+    *shift = p - 64;
+    return *multiplier >= two63;
+}
+
+// Divisors at least 3 that are not powers of two, by whether the
+// multiplier needs n added back. Unsigned longs may not fit the signed
+// 64-bit reciprocal, so they are left to div.
+static bool divides_by_magic(const ASTNode *node, bool add) {
+    unsigned long multiplier;
+    int shift;
+    long value = node->data.number.value;
+    if (type_size(node->value_type) == 8 && !type_is_signed(node->value_type)) return false;
+    if (value <= 2 || (value & (value - 1)) == 0) return false;
+    return divide_magic(value, &multiplier, &shift) == add;
+}
+
+static bool isel_pred_magic(const ASTNode *node) {
+    return divides_by_magic(node, false);
+}
+
+static bool isel_pred_magicadd(const ASTNode *node) {
+    return divides_by_magic(node, true);
+}
+
+// x = x op y, which can update the slot of x in place
+static bool isel_pred_update(const ASTNode *node) {
+    const ASTNode *value = node->data.binary_op.right;
+    return strcmp(node->data.binary_op.left->data.variable.name,
+                  value->data.binary_op.left->data.variable.name) == 0;
+}
+
+static int node_op(const ASTNode *node) {
+    switch (node->type) {
+        case NODE_NUMBER:
+            return ISEL_NUM;
+        case NODE_VARIABLE:
+            return ISEL_VAR;
+        case NODE_STRING:
+            return ISEL_STR;
+        case NODE_INDEX:
+            return ISEL_ELEM;
+        case NODE_UNARY_OP:
+            return node->data.unary_op.operator == 'C' ? ISEL_CVT : ISEL_ANY;
+        case NODE_BINARY_OP:
+            switch (node->data.binary_op.operator) {
+                case '+': return ISEL_ADD;
+                case '-': return ISEL_SUB;
+                case '*': return ISEL_MUL;
+                case '/': return ISEL_DIV;
+                case '=': return ISEL_ASGN;
+                default:
+                    // && and || branch, so the code generator lowers them
+                    return comparison_condition(node->data.binary_op.operator) ? ISEL_CMP : ISEL_ANY;
+            }
+        default:
+            return ISEL_ANY;
+    }
+}
+
+// Whether pattern p matches at label, adding the cost of its leaves
+static bool match(int p, const Label *label, int *cost) {
+    const IselPattern *pattern = &isel_patterns[p];
+    if (!pattern->terminal) {
+        if (label->rule[pattern->symbol] < 0) return false;
+        *cost += label->cost[pattern->symbol];
+        return true;
+    }
+    if (label->op != pattern->symbol) return false;
+    for (int k = 0; k < 2 && pattern->kids[k] >= 0; k++) {
+        if (!match(pattern->kids[k], label->kids[k], cost)) return false;
+    }
+    return true;
+}
+
+// Record rule r at label if it is the cheapest derivation so far, with
+// the costs of tier
+static bool try_rule(Label *label, int r, int tier) {
+    const IselRule *rule = &isel_rules[r];
+    int cost = isel_rule_costs[r][tier];
+    if (!match(rule->pattern, label, &cost)) return false;
+    if (rule->predicate && !rule->predicate(label->node)) return false;
+    if (cost >= label->cost[rule->lhs]) return false;
+    label->cost[rule->lhs] = cost;
+    label->rule[rule->lhs] = r;
+    return true;
+}
+
+// Label the tree bottom-up. Nodes the code generator lowers itself are
+// leaves; their operands are selected when it evaluates them.
+static Label *label_tree(ASTNode *node, int tier) {
+    Label *label = calloc(1, sizeof(Label));
+    label->node = node;
+    label->op = node_op(node);
+    for (int nt = 0; nt < ISEL_NT_COUNT; nt++) {
+        label->cost[nt] = ISEL_NO_COVER;
+        label->rule[nt] = -1;
+    }
+    if (node->type == NODE_BINARY_OP && label->op != ISEL_ANY) {
+        label->kids[0] = label_tree(node->data.binary_op.left, tier);
+        label->kids[1] = label_tree(node->data.binary_op.right, tier);
+    } else if (label->op == ISEL_CVT) {
+        label->kids[0] = label_tree(node->data.unary_op.operand, tier);
+    } else if (label->op == ISEL_ELEM) {
+        label->kids[0] = label_tree(node->data.index.index, tier);
+    }
+
+    for (int i = isel_term_rules_start[label->op]; i < isel_term_rules_start[label->op + 1]; i++) {
+        try_rule(label, isel_term_rules[i], tier);
+    }
+    // Chain rules until no derivation gets cheaper
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int i = 0; i < ISEL_CHAIN_RULE_COUNT; i++) {
+            if (try_rule(label, isel_chain_rules[i], tier)) changed = true;
+        }
+    }
+    return label;
+}
+
+static void label_free(Label *label) {
+    if (!label) return;
+    label_free(label->kids[0]);
+    label_free(label->kids[1]);
+    free(label);
+}
+
+// Add the reg leaves beneath pattern p at label to cover, looking through
+// the derivations of the other nonterminals
+static void collect_leaves(Cover *cover, int p, Label *label) {
+    const IselPattern *pattern = &isel_patterns[p];
+    if (pattern->terminal) {
+        for (int k = 0; k < 2 && pattern->kids[k] >= 0; k++) {
+            collect_leaves(cover, pattern->kids[k], label->kids[k]);
+        }
+    } else if (pattern->symbol == ISEL_NT_REG) {
+        cover->leaves[cover->leaf_count++] = label;
+    } else {
+        collect_leaves(cover, isel_rules[label->rule[pattern->symbol]].pattern, label);
+    }
+}
+
+static bool is_generated(const IselRule *rule) {
+    return rule->code && strcmp(rule->code, "@") == 0;
+}
+
+// A value computed into any register without touching others: no reg
+// leaves, and not lowered by the code generator
+static bool is_simple(Label *label) {
+    const IselRule *rule = &isel_rules[label->rule[ISEL_NT_REG]];
+    if (is_generated(rule)) return false;
+    Cover cover = {0};
+    collect_leaves(&cover, rule->pattern, label);
+    return cover.leaf_count == 0;
+}
+
+// Whether evaluating node may assign the variable name, or an element of
+// the array name, which a call may do if it is a global
+static bool assigns(const ASTNode *node, const char *name, bool is_global) {
+    switch (node->type) {
+        case NODE_NUMBER:
+        case NODE_VARIABLE:
+        case NODE_STRING:
+            return false;
+        case NODE_INDEX:
+            return assigns(node->data.index.index, name, is_global);
+        case NODE_BINARY_OP:
+            if (node->data.binary_op.operator == '=') {
+                const ASTNode *target = node->data.binary_op.left;
+                if (target->type == NODE_INDEX) target = target->data.index.array;
+                if (strcmp(target->data.variable.name, name) == 0) return true;
+            }
+            return assigns(node->data.binary_op.left, name, is_global) ||
+                   assigns(node->data.binary_op.right, name, is_global);
+        case NODE_UNARY_OP:
+            return assigns(node->data.unary_op.operand, name, is_global);
+        case NODE_CALL:
+            if (is_global) return true;
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                if (assigns(node->data.call.args[i], name, is_global)) return true;
+            }
+            return false;
+        case NODE_SELECT:
+            return assigns(node->data.select.condition, name, is_global) ||
+                   assigns(node->data.select.if_true, name, is_global) ||
+                   assigns(node->data.select.if_false, name, is_global);
+        default:
+            return true;
+    }
+}
+
+// Whether evaluating writer may assign a variable that reader reads, so
+// that reader must not be evaluated after it
+static bool may_write(const ASTNode *writer, const ASTNode *reader) {
+    if (reader->type == NODE_VARIABLE) {
+        return assigns(writer, reader->data.variable.name, reader->data.variable.is_global);
+    }
+    if (reader->type == NODE_INDEX) {
+        return may_write(writer, reader->data.index.array) || may_write(writer, reader->data.index.index);
+    }
+    if (reader->type == NODE_UNARY_OP) return may_write(writer, reader->data.unary_op.operand);
+    if (reader->type != NODE_BINARY_OP) return false;
+    return may_write(writer, reader->data.binary_op.left) || may_write(writer, reader->data.binary_op.right);
+}
+
+static void emit_cover(CodeGenerator *gen, Label *label, int nt, const char *target, char *result);
+
+static void emit_reg(CodeGenerator *gen, Label *label, const char *target) {
+    if (is_generated(&isel_rules[label->rule[ISEL_NT_REG]])) {
+        codegen_expression(gen, label->node);
+        if (strcmp(target, "%rax") != 0) codegen_emit(gen, "\tmovq %%rax, %s", target);
+        return;
+    }
+    char result[ISEL_OPERAND_SIZE];
+    emit_cover(gen, label, ISEL_NT_REG, target, result);
+}
+
+// Append register reg, a 64-bit name, at the width of a value of type;
+// void values are treated as full registers
+static char *format_register(char *out, char *end, const char *reg, int width) {
+    return output_text(output_char(out, end, '%'), end, insn_reg_sized(reg, width ? width : 8));
+}
+
+// Size suffix of the operation at node: the type of its operands for a
+// comparison, else of its value
+static char size_suffix(const ASTNode *node) {
+    TypeKind type = node->value_type;
+    if (node_op(node) == ISEL_CMP) type = node->data.binary_op.left->value_type;
+    return type_suffix(type);
+}
+
+// Expand one line of a template, up to a newline, at the end of the string
+// ending at out; returns its new end
+static char *format_template(Cover *cover, Label *label, const char *template,
+                             Operand *operands, char *out, char *end) {
+    *out = '\0';
+    for (const char *c = template; *c && *c != '\n'; c++) {
+        if (*c != '%') {
+            out = output_char(out, end, *c);
+            continue;
+        }
+        const ASTNode *node = label->node;
+        const ASTNode *number = node->type == NODE_BINARY_OP ? node->data.binary_op.right : node;
+        unsigned long multiplier;
+        int shift;
+        int width = 0;
+        c++;
+        if (*c && strchr("bwlq", *c) && ((c[1] >= '0' && c[1] <= '9') || c[1] == 'r')) {
+            width = *c == 'b' ? 1 : *c == 'w' ? 2 : *c == 'l' ? 4 : 8;
+            c++;
+        }
+        if (*c >= '0' && *c <= '9') {
+            Operand *operand = &operands[*c - '0'];
+            if (operand->is_reg) {
+                out = format_register(out, end, operand->text, width ? width : type_size(operand->type));
+            } else {
+                out = output_text(out, end, operand->text);
+            }
+        } else if (*c == 'r') {
+            out = format_register(out, end, cover->target, width ? width : type_size(node->value_type));
+        } else if (*c == 'z') {
+            out = output_char(out, end, size_suffix(node));
+        } else if (*c == 'v' || *c == 'n') {
+            out = output_long(out, end, number->data.number.value - (*c == 'n'));
+        } else if (*c == 'k') {
+            int log2 = 0;
+            while ((1UL << log2) < (unsigned long)number->data.number.value) log2++;
+            out = output_long(out, end, log2);
+        } else if (*c == 'M' || *c == 'S') {
+            divide_magic(number->data.number.value, &multiplier, &shift);
+            out = output_long(out, end, *c == 'M' ? (long)multiplier : (long)shift);
+        } else if (*c == 'm') {
+            char text[ISEL_OPERAND_SIZE];
+            codegen_memory_operand(cover->gen, node, text, sizeof(text));
+            out = output_text(out, end, text);
+        } else if (*c == 'a' && isel_pred_inbounds(node)) {
+            const ASTNode *array = node->data.index.array;
+            long offset = node->data.index.index->data.number.value * type_size(node->value_type);
+            if (array->data.variable.is_global) {
+                out = output_text(out, end, array->data.variable.name);
+                out = output_text(output_long(output_char(out, end, '+'), end, offset), end, "(%rip)");
+            } else {
+                LocalVariable *var = codegen_find_local(cover->gen, array->data.variable.name);
+                out = output_text(output_long(out, end, var->offset + offset), end, "(%rbp)");
+            }
+        } else if (*c == 'a') {
+            const ASTNode *array = node->data.index.array;
+            if (array->data.variable.is_global) {
+                out = output_text(out, end, "(%rdx,");
+            } else {
+                LocalVariable *var = codegen_find_local(cover->gen, array->data.variable.name);
+                out = output_text(output_long(out, end, var->offset), end, "(%rbp,");
+            }
+            out = output_char(format_register(out, end, operands[0].text, 8), end, ',');
+            out = output_char(output_long(out, end, type_size(node->value_type)), end, ')');
+        } else if (*c == 'c' || *c == 's') {
+            const char *cond = comparison_condition(node->data.binary_op.operator);
+            if (!type_is_signed(node->data.binary_op.left->value_type)) cond = unsigned_condition(cond);
+            out = output_text(out, end, *c == 'c' ? cond : swapped_condition(cond));
+        } else {
+            out = output_char(out, end, *c);
+        }
+    }
+    return out;
+}
+
+static void expand(Cover *cover, Label *label, int nt, char *result);
+
+// Operands of the nonterminal leaves of pattern p at label, in order;
+// those of non-reg leaves emit the code of their derivations first
+static void expand_operands(Cover *cover, int p, Label *label, Operand *operands, int *count) {
+    const IselPattern *pattern = &isel_patterns[p];
+    if (pattern->terminal) {
+        for (int k = 0; k < 2 && pattern->kids[k] >= 0; k++) {
+            expand_operands(cover, pattern->kids[k], label->kids[k], operands, count);
+        }
+        return;
+    }
+    Operand *operand = &operands[*count];
+    operand->is_reg = pattern->symbol == ISEL_NT_REG;
+    operand->type = label->node->value_type;
+    if (operand->is_reg) {
+        for (int i = 0; i < cover->leaf_count; i++) {
+            if (cover->leaves[i] == label) output_text(operand->text, operand->text + ISEL_OPERAND_SIZE, cover->registers[i]);
+        }
+    } else {
+        expand(cover, label, pattern->symbol, operand->text);
+    }
+    (*count)++;
+}
+
+static void expand(Cover *cover, Label *label, int nt, char *result) {
+    const IselRule *rule = &isel_rules[label->rule[nt]];
+    Operand operands[ISEL_MAX_LEAVES];
+    int count = 0;
+    expand_operands(cover, rule->pattern, label, operands, &count);
+
+    for (const char *line = rule->code; line; line = strchr(line, '\n')) {
+        if (*line == '\n') line++;
+        char text[2 * ISEL_OPERAND_SIZE];
+        text[0] = '\t';
+        format_template(cover, label, line, operands, text + 1, text + sizeof(text));
+        codegen_emit_line(cover->gen, text);
+    }
+    result[0] = '\0';
+    if (rule->result) format_template(cover, label, rule->result, operands, result, result + ISEL_OPERAND_SIZE);
+}
+
+// Emit the derivation of nt at label with its result in target. The reg
+// leaves are evaluated first, in %rax and %rcx: a simple second leaf is
+// loaded straight into %rcx, otherwise the second is evaluated first and
+// kept in %rcx or on the stack while the first is.
+static void emit_cover(CodeGenerator *gen, Label *label, int nt, const char *target, char *result) {
+    Cover cover = {gen, target, {NULL}, {"%rax", "%rcx"}, 0};
+    collect_leaves(&cover, isel_rules[label->rule[nt]].pattern, label);
+    if (cover.leaf_count > 0 && strcmp(target, "%rax") != 0) {
+        emit_cover(gen, label, nt, "%rax", result);
+        codegen_emit(gen, "\tmovq %%rax, %s", target);
+        return;
+    }
+
+    if (cover.leaf_count == 1) {
+        emit_reg(gen, cover.leaves[0], "%rax");
+    } else if (cover.leaf_count == 2) {
+        Label *first = cover.leaves[0];
+        Label *second = cover.leaves[1];
+        if (is_simple(second) && !may_write(first->node, second->node)) {
+            emit_reg(gen, first, "%rax");
+            emit_reg(gen, second, "%rcx");
+        } else if (is_simple(first)) {
+            emit_reg(gen, second, "%rax");
+            codegen_emit(gen, "\tmovq %%rax, %%rcx");
+            emit_reg(gen, first, "%rax");
+        } else {
+            emit_reg(gen, second, "%rax");
+            codegen_push(gen, "%rax");
+            emit_reg(gen, first, "%rax");
+            codegen_pop(gen, "%rcx");
+        }
+    }
+    expand(&cover, label, nt, result);
+}
+
+static Label *label_root(CodeGenerator *gen, ASTNode *node, int nt) {
+    int tier = gen->target.tier < ISEL_TIER_COUNT ? (int)gen->target.tier : ISEL_TIER_COUNT - 1;
+    Label *label = label_tree(node, tier);
+    if (label->rule[nt] < 0) {
+        fprintf(stderr, "Error: no instruction selection rule covers a node of type %d\n", node->type);
+        exit(1);
+    }
+    return label;
+}
+
+void isel_value(CodeGenerator *gen, ASTNode *node) {
+    Label *label = label_root(gen, node, ISEL_NT_REG);
+    emit_reg(gen, label, "%rax");
+    label_free(label);
+}
+
+void isel_effect(CodeGenerator *gen, ASTNode *node) {
+    Label *label = label_root(gen, node, ISEL_NT_STMT);
+    char result[ISEL_OPERAND_SIZE];
+    emit_cover(gen, label, ISEL_NT_STMT, "%rax", result);
+    label_free(label);
+}
+
+const char *isel_condition(CodeGenerator *gen, ASTNode *node) {
+    Label *label = label_root(gen, node, ISEL_NT_CC);
+    char result[ISEL_OPERAND_SIZE];
+    emit_cover(gen, label, ISEL_NT_CC, "%rax", result);
+    label_free(label);
+
+    for (int i = 0; i < CONDITION_COUNT; i++) {
+        if (strcmp(conditions[i][0], result) == 0) return conditions[i][0];
+    }
+    return "ne";
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+# Instruction selection rules, compiled into obj/gen/isel_rules.h by
+# tools/burg.c. The selector labels each expression tree bottom-up with the
+# cheapest rule deriving every nonterminal at every node, then emits the
+# cover of the root.
+#
+#   lhs: PATTERN, cost[, if predicate] [{ line; line }] [-> operand]
+#
+# A cost is a number, or the name of a %cost line that gives one for each
+# -march tier listed by %tiers (in the order of TargetTier in target.h).
+#
+# Patterns are trees of terminals (upper case, one per kind of AST node)
+# with nonterminals (lower case) as leaves; a pattern that is a single
+# nonterminal makes a chain rule. The cost of a cover is the sum of its
+# rule costs, about one per instruction with extra for slow ones; ties go
+# to the earlier rule. The predicate, isel_pred_NAME in src/isel.c, must
+# accept the AST node at the root of the pattern.
+#
+# Leaves derived as reg are evaluated into registers before any of the
+# rule's code runs: the first into the result register, the second into
+# %rcx, and a rule may have at most two, counting those of the non-reg
+# leaves beneath it. Code lines may use
+#   %0..%9  the operand of the nth nonterminal leaf, in pattern order
+#   %r      the result register
+#   %z      the size suffix (b, w, l or q) of the operation at the root:
+#           the type of its value, or of its operands for a CMP
+#   %v      the value of the NUM at the root
+#   %m      the memory of the VAR at the root: its stack slot, or its symbol
+#           relative to %rip for a global; or of the bytes of the STR, or
+#           of the array of the ELEM
+#   %a      the element of the ELEM at the root: at its constant index, or
+#           indexed by the register of %0 in its array's stack slot, or
+#           at %rdx for a global
+#   %k %n   the log2 of that value, and the value minus one
+#   %M %S   the multiplier and shift that divide by that value
+#   %c %s   the condition of the CMP at the root, and its operands swapped
+#   %%      a percent sign, as in %%rdx
+# and the operand of a non-reg nonterminal is its -> text, expanded the same
+# way. Registers are named at the width of their value's type, or at the
+# width given by a b, w, l or q between the % and the digit or r, as in
+# %q0 or %br. A NUM placeholder in a rule for a binary operator refers to
+# its right operand. A code line @ evaluates the node with the code
+# generator instead. Code may use %rcx and %rdx as scratch registers if the
+# rule has a reg leaf; otherwise it may write only the result register.
+#
+# A value narrower than its register is held in the low bytes, and the
+# bytes above are undefined: narrowing conversions are free, and 32-bit
+# operations, which need no REX prefix, serve every type up to int.
+
+%term ANY NUM VAR ADD SUB MUL DIV CMP ASGN CVT STR ELEM
+
+# Latencies that differ between microarchitecture levels: a 64-bit idiv
+# takes 40 to 90 cycles before Ice Lake and Zen, a 32-bit one 20 to 30,
+# and lea with a base, an index and a displacement takes 3 cycles on Sandy
+# Bridge to Skylake.
+%tiers x86-64 x86-64-v2 x86-64-v3
+%cost idiv 70 60 40
+%cost idiv32 30 26 20
+%cost lea3 1 2 2
+%cost imul 3 3 3
+
+# Operands folded into the instructions that use them. Instructions take
+# 32-bit immediates, sign-extended for 64-bit operations.
+imm: NUM, 0, if imm32 -> $%v
+con: NUM, 0, if imm32 -> %v
+scale: NUM, 0, if scale -> %v
+zero: NUM, 0, if zero -> %v
+pow2: NUM, 0, if pow2 -> %v
+magic: NUM, 0, if magic -> %v
+magicadd: NUM, 0, if magicadd -> %v
+mem: VAR, 0 -> %m
+
+# Array elements, addressed with the index scaled by the element size.
+# A global array's address is loaded first, as it is relative to %rip.
+elem: ELEM(NUM), 0, if inbounds -> %a
+elem: ELEM(reg), 0, if local -> %a
+elem: ELEM(reg), 1, if global { leaq %m, %%rdx } -> %a
+
+# Values. movl zero-extends into the whole register, so it also loads
+# small nonnegative longs; other 64-bit constants need movabs.
+reg: NUM, 1, if movl { movl $%v, %lr }
+reg: imm, 1 { movq %0, %r }
+reg: NUM, 2 { movabsq $%v, %r }
+reg: mem, 1, if sbyte { movsbl %0, %lr }
+reg: mem, 1, if ubyte { movzbl %0, %lr }
+reg: mem, 1, if sword { movswl %0, %lr }
+reg: mem, 1, if uword { movzwl %0, %lr }
+reg: mem, 1 { mov%z %0, %r }
+reg: elem, 1, if sbyte { movsbl %0, %lr }
+reg: elem, 1, if ubyte { movzbl %0, %lr }
+reg: elem, 1, if sword { movswl %0, %lr }
+reg: elem, 1, if uword { movzwl %0, %lr }
+reg: elem, 1 { mov%z %0, %r }
+reg: cc, 2 { set%0 %br; movzbl %br, %lr }
+reg: STR, 1 { leaq %m, %r }
+reg: ANY, 5 { @ }
+
+# Conversions: narrowing leaves the value where it is, widening extends it
+# to a full 32-bit register, or to 64 bits for long
+reg: CVT(reg), 0, if narrow
+reg: CVT(reg), 1, if sext8 { movsbl %0, %lr }
+reg: CVT(mem), 1, if sext8 { movsbl %0, %lr }
+reg: CVT(reg), 1, if sext8q { movsbq %0, %qr }
+reg: CVT(mem), 1, if sext8q { movsbq %0, %qr }
+reg: CVT(reg), 1, if zext8 { movzbl %0, %lr }
+reg: CVT(mem), 1, if zext8 { movzbl %0, %lr }
+reg: CVT(reg), 1, if sext16 { movswl %0, %lr }
+reg: CVT(mem), 1, if sext16 { movswl %0, %lr }
+reg: CVT(reg), 1, if sext16q { movswq %0, %qr }
+reg: CVT(mem), 1, if sext16q { movswq %0, %qr }
+reg: CVT(reg), 1, if zext16 { movzwl %0, %lr }
+reg: CVT(mem), 1, if zext16 { movzwl %0, %lr }
+reg: CVT(reg), 1, if sext32 { movslq %0, %qr }
+reg: CVT(mem), 1, if sext32 { movslq %0, %qr }
+reg: CVT(reg), 1, if zext32 { movl %0, %0 }
+reg: CVT(mem), 1, if zext32 { movl %0, %lr }
+
+reg: ADD(reg, reg), 1 { add%z %1, %0 }
+reg: ADD(reg, imm), 1 { add%z %1, %0 }
+reg: ADD(imm, reg), 1 { add%z %0, %1 }
+reg: ADD(reg, mem), 1 { add%z %1, %0 }
+reg: ADD(mem, reg), 1 { add%z %0, %1 }
+
+# Address arithmetic: base + index * scale + displacement in one lea,
+# which computes in 64 bits and keeps the low bytes for narrower types
+reg: MUL(reg, pow2), 1 { sal%z $%k, %0 }
+reg: MUL(reg, scale), 1 { lea%z (,%q0,%1), %r }
+reg: ADD(reg, MUL(reg, scale)), 1 { lea%z (%q0,%q1,%2), %r }
+reg: ADD(MUL(reg, scale), reg), 1 { lea%z (%q2,%q0,%1), %r }
+reg: ADD(MUL(reg, scale), con), 1 { lea%z %2(,%q0,%1), %r }
+reg: ADD(ADD(reg, reg), con), 1 { lea%z %2(%q0,%q1), %r }
+reg: ADD(ADD(reg, MUL(reg, scale)), con), lea3 { lea%z %3(%q0,%q1,%2), %r }
+reg: ADD(ADD(MUL(reg, scale), reg), con), lea3 { lea%z %3(%q2,%q0,%1), %r }
+
+reg: SUB(reg, reg), 1 { sub%z %1, %0 }
+reg: SUB(reg, imm), 1 { sub%z %1, %0 }
+reg: SUB(reg, mem), 1 { sub%z %1, %0 }
+reg: SUB(imm, reg), 2 { neg%z %1; add%z %0, %1 }
+reg: SUB(mem, reg), 2 { neg%z %1; add%z %0, %1 }
+
+reg: MUL(reg, reg), imul { imul%z %1, %0 }
+reg: MUL(reg, mem), imul { imul%z %1, %0 }
+reg: MUL(mem, reg), imul { imul%z %0, %1 }
+reg: MUL(reg, imm), imul { imul%z %1, %0, %r }
+reg: MUL(imm, reg), imul { imul%z %0, %1, %r }
+reg: MUL(mem, imm), imul { imul%z %1, %0, %r }
+reg: MUL(imm, mem), imul { imul%z %0, %1, %r }
+
+# div and idiv divide %rdx:%rax, so the dividend must be the result
+# register; its high half is the sign of the dividend, or zero when
+# unsigned. Constant divisors multiply by a fixed-point reciprocal
+# instead, taking the high half of the product and rounding towards zero
+# (Hacker's Delight, chapter 10). Ints are sign-extended and unsigned
+# ints zero-extended to use the 64-bit reciprocal, which is exact for
+# both. Signed powers of two shift after adding divisor - 1 to negative
+# dividends.
+reg: DIV(reg, reg), idiv32, if signed32 { cltd; idivl %1 }
+reg: DIV(reg, mem), idiv32, if signed32 { cltd; idivl %1 }
+reg: DIV(reg, reg), idiv32, if unsigned32 { xorl %%edx, %%edx; divl %1 }
+reg: DIV(reg, mem), idiv32, if unsigned32 { xorl %%edx, %%edx; divl %1 }
+reg: DIV(reg, reg), idiv, if signed64 { cqo; idivq %1 }
+reg: DIV(reg, mem), idiv, if signed64 { cqo; idivq %1 }
+reg: DIV(reg, reg), idiv, if unsigned64 { xorl %%edx, %%edx; divq %1 }
+reg: DIV(reg, mem), idiv, if unsigned64 { xorl %%edx, %%edx; divq %1 }
+reg: DIV(reg, pow2), 1, if unsigned32 { shrl $%k, %0 }
+reg: DIV(reg, pow2), 1, if unsigned64 { shrq $%k, %0 }
+reg: DIV(reg, pow2), 4, if signed32 { leal %n(%q0), %%ecx; testl %0, %0; cmovnsl %0, %%ecx; sarl $%k, %%ecx; movl %%ecx, %r }
+reg: DIV(reg, pow2), 4, if signed64 { leaq %n(%0), %%rcx; testq %0, %0; cmovnsq %0, %%rcx; sarq $%k, %%rcx; movq %%rcx, %r }
+reg: DIV(reg, magic), 7, if signed32 { movslq %0, %%rcx; movq %%rcx, %q0; movabsq $%M, %%rdx; imulq %%rdx; sarq $%S, %%rdx; shrq $63, %%rcx; leal (%%rdx,%%rcx), %r }
+reg: DIV(reg, magicadd), 8, if signed32 { movslq %0, %%rcx; movq %%rcx, %q0; movabsq $%M, %%rdx; imulq %%rdx; addq %%rcx, %%rdx; sarq $%S, %%rdx; shrq $63, %%rcx; leal (%%rdx,%%rcx), %r }
+reg: DIV(reg, magic), 5, if unsigned32 { movl %0, %0; movabsq $%M, %%rdx; imulq %%rdx; sarq $%S, %%rdx; movl %%edx, %r }
+reg: DIV(reg, magicadd), 6, if unsigned32 { movl %0, %0; movq %q0, %%rcx; movabsq $%M, %%rdx; imulq %%rdx; addq %%rcx, %%rdx; sarq $%S, %%rdx; movl %%edx, %r }
+reg: DIV(reg, magic), 7, if signed64 { movq %0, %%rcx; movabsq $%M, %%rdx; imulq %%rdx; sarq $%S, %%rdx; shrq $63, %%rcx; leaq (%%rdx,%%rcx), %r }
+reg: DIV(reg, magicadd), 8, if signed64 { movq %0, %%rcx; movabsq $%M, %%rdx; imulq %%rdx; addq %%rcx, %%rdx; sarq $%S, %%rdx; shrq $63, %%rcx; leaq (%%rdx,%%rcx), %r }
+
+reg: ASGN(mem, reg), 1 { mov%z %1, %0 }
+reg: ASGN(elem, reg), 2 { mov%z %1, %0; mov%z %1, %r }
+
+# Conditions: flags set for the returned condition code, which is the
+# unsigned one for unsigned operands
+cc: CMP(reg, zero), 1 { test%z %0, %0 } -> %c
+cc: CMP(zero, reg), 1 { test%z %1, %1 } -> %s
+cc: CMP(reg, reg), 1 { cmp%z %1, %0 } -> %c
+cc: CMP(reg, imm), 1 { cmp%z %1, %0 } -> %c
+cc: CMP(reg, mem), 1 { cmp%z %1, %0 } -> %c
+cc: CMP(mem, reg), 1 { cmp%z %1, %0 } -> %c
+cc: CMP(mem, imm), 1 { cmp%z %1, %0 } -> %c
+cc: CMP(imm, reg), 1 { cmp%z %0, %1 } -> %s
+cc: CMP(imm, mem), 1 { cmp%z %0, %1 } -> %s
+cc: reg, 1 { test%z %0, %0 } -> ne
+cc: mem, 1 { cmp%z $0, %0 } -> ne
+
+# Statements, whose value is not used
+stmt: reg, 0
+stmt: ASGN(mem, imm), 1 { mov%z %1, %0 }
+stmt: ASGN(elem, reg), 1 { mov%z %1, %0 }
+stmt: ASGN(elem, imm), 1 { mov%z %1, %0 }
+stmt: ASGN(mem, ADD(mem, imm)), 1, if update { add%z %2, %0 }
+stmt: ASGN(mem, ADD(mem, reg)), 1, if update { add%z %2, %0 }
+stmt: ASGN(mem, SUB(mem, imm)), 1, if update { sub%z %2, %0 }
+stmt: ASGN(mem, SUB(mem, reg)), 1, if update { sub%z %2, %0 }
\ No newline at end of file
@@ -0,0 +1,210 @@
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <elf.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <assembler.h>
+#include <jit.h>
+
+// Calls to functions outside the program go through a stub each, a jmp
+// through a slot holding the function's address: the function may be
+// anywhere in the address space, out of reach of a call's rel32
+#define STUB_SIZE 8          // ff 25 rel32, padded with int3
+
+// The run exit returns to
+static jmp_buf *exit_target;
+static int exit_status;
+
+static void runtime_exit(int status) {
+    exit_status = status;
+    longjmp(*exit_target, 1);
+}
+
+// Functions the program gets from the compiler rather than a library:
+// exit must end the program, not this process
+static const struct {
+    const char *name;
+    void *address;
+} runtime[] = {
+    {"exit", (void *)runtime_exit},
+    {"_exit", (void *)runtime_exit},
+    {"_Exit", (void *)runtime_exit},
+};
+
+#define COUNT(array) ((int)(sizeof(array) / sizeof((array)[0])))
+
+// A program loaded into memory
+typedef struct {
+    Assembly *assembly;
+    unsigned char *memory;
+    size_t size;
+    size_t code_size;        // Bytes at the start mapped executable
+    unsigned long *addresses;   // Of each section
+    int *stubs;              // Stub of each undefined symbol, or -1
+    int stub_count;
+    unsigned long stub_base;
+    unsigned long slot_base;
+} Image;
+
+static void *lookup(const char *name) {
+    for (int i = 0; i < COUNT(runtime); i++) {
+        if (strcmp(runtime[i].name, name) == 0) return runtime[i].address;
+    }
+    return dlsym(RTLD_DEFAULT, name);
+}
+
+static unsigned long resolve_stub(const char *name, void *context) {
+    const Image *image = context;
+    int symbol = assembly_find_symbol(image->assembly, name);
+    return image->stub_base + (unsigned long)image->stubs[symbol] * STUB_SIZE;
+}
+
+static unsigned long align_up(unsigned long value, unsigned long align) {
+    return align > 1 ? (value + align - 1) / align * align : value;
+}
+
+// Give every undefined function a stub; a program can only call them
+static bool assign_stubs(Image *image, char *error, size_t error_size) {
+    const Assembly *assembly = image->assembly;
+    for (int i = 0; i < assembly->symbol_count; i++) image->stubs[i] = -1;
+    for (int i = 0; i < assembly->relocation_count; i++) {
+        const AsmRelocation *r = &assembly->relocations[i];
+        const AsmSymbol *symbol = &assembly->symbols[r->symbol];
+        if (symbol->section >= 0 || image->stubs[r->symbol] >= 0) continue;
+        if (r->type != R_X86_64_PLT32) {
+            snprintf(error, error_size, "%s is not defined by the program", symbol->name);
+            return false;
+        }
+        if (!lookup(symbol->name)) {
+            snprintf(error, error_size, "undefined reference to %s", symbol->name);
+            return false;
+        }
+        image->stubs[r->symbol] = image->stub_count++;
+    }
+    return true;
+}
+
+// Code and read-only data, then the stubs and their slots, all mapped
+// executable; the writable sections on pages after them
+static void place_sections(Image *image) {
+    const Assembly *assembly = image->assembly;
+    unsigned long offset = 0;
+    for (int writable = 0; writable < 2; writable++) {
+        for (int s = 0; s < assembly->section_count; s++) {
+            const AsmSection *section = &assembly->sections[s];
+            if (!(section->flags & SHF_ALLOC) || (section->flags & SHF_WRITE) != (writable ? SHF_WRITE : 0)) {
+                continue;
+            }
+            offset = align_up(offset, section->align);
+            image->addresses[s] = offset;
+            offset += section->size;
+        }
+        if (!writable) {
+            image->stub_base = align_up(offset, STUB_SIZE);
+            image->slot_base = image->stub_base + (unsigned long)image->stub_count * STUB_SIZE;
+            offset = align_up(image->slot_base + (unsigned long)image->stub_count * 8, (unsigned long)getpagesize());
+            image->code_size = offset;
+        }
+    }
+    image->size = align_up(offset, (unsigned long)getpagesize());
+}
+
+static bool load(Image *image, char *error, size_t error_size) {
+    Assembly *assembly = image->assembly;
+    if (!assign_stubs(image, error, error_size)) return false;
+    place_sections(image);
+
+    void *memory = mmap(NULL, image->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        snprintf(error, error_size, "cannot map %zu bytes for the program", image->size);
+        return false;
+    }
+    image->memory = memory;
+    unsigned long base = (unsigned long)image->memory;
+    for (int s = 0; s < assembly->section_count; s++) image->addresses[s] += base;
+    image->stub_base += base;
+    image->slot_base += base;
+
+    if (!assembly_link(assembly, image->addresses, resolve_stub, image, error, error_size)) return false;
+    for (int s = 0; s < assembly->section_count; s++) {
+        const AsmSection *section = &assembly->sections[s];
+        if (section->data && (section->flags & SHF_ALLOC)) {
+            memcpy((void *)image->addresses[s], section->data, section->size);
+        }
+    }
+    for (int i = 0; i < assembly->symbol_count; i++) {
+        if (image->stubs[i] < 0) continue;
+        unsigned char *stub = (unsigned char *)(image->stub_base + (unsigned long)image->stubs[i] * STUB_SIZE);
+        unsigned long slot = image->slot_base + (unsigned long)image->stubs[i] * 8;
+        int displacement = (int)(slot - ((unsigned long)stub + 6));
+        unsigned long target = (unsigned long)lookup(assembly->symbols[i].name);
+        stub[0] = 0xff;
+        stub[1] = 0x25;
+        memcpy(stub + 2, &displacement, 4);
+        stub[6] = stub[7] = 0xcc;
+        memcpy((void *)slot, &target, 8);
+    }
+
+    if (mprotect(image->memory, image->code_size, PROT_READ | PROT_EXEC) != 0) {
+        snprintf(error, error_size, "cannot make the program executable");
+        return false;
+    }
+    return true;
+}
+
+// Call main, and after it the profile writer of an instrumented program,
+// as _start would
+static int call_main(const Image *image, int argc, char **argv) {
+    const Assembly *assembly = image->assembly;
+    int main_symbol = assembly_find_symbol(assembly, "main");
+    int dump_symbol = assembly_find_symbol(assembly, "__profile_dump");
+    const AsmSymbol *symbol = &assembly->symbols[main_symbol];
+    int (*entry)(int, char **) = (int (*)(int, char **))(image->addresses[symbol->section] + symbol->value);
+
+    jmp_buf target;
+    jmp_buf *saved_target = exit_target;
+    volatile int status = 0;
+    exit_target = &target;
+    if (setjmp(target) == 0) {
+        status = entry(argc, argv);
+        if (dump_symbol >= 0 && assembly->symbols[dump_symbol].section >= 0) {
+            symbol = &assembly->symbols[dump_symbol];
+            void (*dump)(void) = (void (*)(void))(image->addresses[symbol->section] + symbol->value);
+            dump();
+        }
+    } else {
+        status = exit_status;
+    }
+    exit_target = saved_target;
+    fflush(stdout);
+    return status;
+}
+
+bool jit_run(InsnList *code, int argc, char **argv, int *status, char *error, size_t error_size) {
+    Image image = {0};
+    image.assembly = assemble(code, error, error_size);
+    if (!image.assembly) return false;
+
+    bool ok = false;
+    int main_symbol = assembly_find_symbol(image.assembly, "main");
+    image.addresses = calloc((size_t)image.assembly->section_count + 1, sizeof(unsigned long));
+    image.stubs = calloc((size_t)image.assembly->symbol_count + 1, sizeof(int));
+    if (main_symbol < 0 || image.assembly->symbols[main_symbol].section < 0) {
+        snprintf(error, error_size, "no main to run");
+    } else if (!image.addresses || !image.stubs) {
+        snprintf(error, error_size, "out of memory");
+    } else if (load(&image, error, error_size)) {
+        *status = call_main(&image, argc, argv);
+        ok = true;
+    }
+
+    if (image.memory) munmap(image.memory, image.size);
+    free(image.addresses);
+    free(image.stubs);
+    assembly_free(image.assembly);
+    return ok;
+}
\ No newline at end of file
@@ -0,0 +1,323 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <layout.h>
+
+static int label_count = 0;
+
+typedef struct {
+    int src;
+    CfgEdgeKind kind;
+    double weight;
+} LayoutEdge;
+
+typedef struct {
+    Cfg *cfg;
+    int *next;       // Following block in the chain, or -1
+    int *prev;
+    int *parent;     // Union-find links, whose roots are the chains' heads
+    int *tail;       // Last block of the chain, at each head
+    int trailer;     // Directives after the final ret, kept last; or -1
+} Chains;
+
+// A chain waiting to be placed, with its affinity when it was queued
+typedef struct {
+    int head;
+    int cls;
+    double affinity;
+} Candidate;
+
+typedef struct {
+    Candidate *items;
+    int count;
+} Queue;
+
+static int compare_edges(const void *a, const void *b) {
+    const LayoutEdge *x = a;
+    const LayoutEdge *y = b;
+    if (x->weight != y->weight) return x->weight < y->weight ? 1 : -1;
+    // On ties keep the emitted fallthroughs, so layout only moves code
+    // when the estimate prefers another order
+    if (x->kind != y->kind) return (int)x->kind - (int)y->kind;
+    return x->src - y->src;
+}
+
+// First block of the chain holding block
+static int chain_head(Chains *chains, int block) {
+    while (chains->parent[block] != block) {
+        chains->parent[block] = chains->parent[chains->parent[block]];
+        block = chains->parent[block];
+    }
+    return block;
+}
+
+// Merge chains along the heaviest edges first, whenever the edge joins the
+// tail of one chain to the head of another
+static void build_chains(Chains *chains) {
+    Cfg *cfg = chains->cfg;
+    LayoutEdge *edges = malloc(sizeof(LayoutEdge) * cfg->count * 2);
+    if (!edges) return;
+
+    int edge_count = 0;
+    for (int b = 0; b < cfg->count; b++) {
+        for (int kind = CFG_FALLTHROUGH; kind <= CFG_TARGET; kind++) {
+            int succ = cfg->blocks[b].succ[kind];
+            // Nothing may be placed in front of the entry block, and back
+            // edges stay taken: codegen_loop has already rotated each loop
+            // so that its exit is the fallthrough of the bottom test
+            if (succ <= b || succ == chains->trailer) continue;
+            edges[edge_count++] = (LayoutEdge){b, kind, cfg->blocks[b].weight[kind]};
+        }
+    }
+    qsort(edges, edge_count, sizeof(LayoutEdge), compare_edges);
+
+    for (int i = 0; i < edge_count; i++) {
+        int src = edges[i].src;
+        int dst = cfg->blocks[src].succ[edges[i].kind];
+        if (chains->next[src] >= 0 || chains->prev[dst] >= 0) continue;
+        int head = chain_head(chains, src);
+        if (head == dst) continue;
+
+        // dst starts its chain, so it is that chain's root
+        chains->next[src] = dst;
+        chains->prev[dst] = src;
+        chains->parent[dst] = head;
+        chains->tail[head] = chains->tail[dst];
+    }
+    free(edges);
+}
+
+// 0 for ordinary chains, 1 for chains ending in a return or that never run,
+// 2 for the epilogue on its own. A chain that falls into the epilogue is
+// ordinary.
+static int chain_class(Chains *chains, int head) {
+    Cfg *cfg = chains->cfg;
+    if (head == cfg->epilogue) return 2;
+
+    double frequency = 0;
+    for (int b = head; b >= 0; b = chains->next[b]) frequency += cfg->blocks[b].frequency;
+    if (frequency == 0) return 1;
+
+    int tail = chains->tail[head];
+    return tail != cfg->epilogue && cfg->blocks[tail].exits ? 1 : 0;
+}
+
+// Whether a is placed before b: lower class first, then higher affinity,
+// then the earlier head
+static bool candidate_before(const Candidate *a, const Candidate *b) {
+    if (a->cls != b->cls) return a->cls < b->cls;
+    if (a->affinity != b->affinity) return a->affinity > b->affinity;
+    return a->head < b->head;
+}
+
+static void queue_push(Queue *queue, Candidate candidate) {
+    int i = queue->count++;
+    while (i > 0 && candidate_before(&candidate, &queue->items[(i - 1) / 2])) {
+        queue->items[i] = queue->items[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    queue->items[i] = candidate;
+}
+
+static Candidate queue_pop(Queue *queue) {
+    Candidate top = queue->items[0];
+    Candidate last = queue->items[--queue->count];
+    int i = 0;
+    for (;;) {
+        int child = i * 2 + 1;
+        if (child >= queue->count) break;
+        if (child + 1 < queue->count && candidate_before(&queue->items[child + 1], &queue->items[child])) {
+            child++;
+        }
+        if (!candidate_before(&queue->items[child], &last)) break;
+        queue->items[i] = queue->items[child];
+        i = child;
+    }
+    queue->items[i] = last;
+    return top;
+}
+
+// Entry chain first, then the chains most strongly connected to what is
+// already placed, then returning chains and finally the epilogue. The
+// affinity of a chain, the total weight of the edges into it from placed
+// blocks, grows as chains are placed; the queue keeps a stale entry for
+// each earlier value, skipped when it comes up.
+static int order_chains(Chains *chains, int *order) {
+    Cfg *cfg = chains->cfg;
+    bool *placed = calloc(cfg->count, sizeof(bool));
+    int *cls = malloc(sizeof(int) * cfg->count);
+    double *affinity = calloc(cfg->count, sizeof(double));
+    Queue queue = {malloc(sizeof(Candidate) * (cfg->count * 3 + 1)), 0};
+    int count = 0;
+    if (!placed || !cls || !affinity || !queue.items) goto done;
+
+    for (int b = 1; b < cfg->count; b++) {
+        if (chains->prev[b] >= 0 || b == chains->trailer) continue;
+        cls[b] = chain_class(chains, b);
+        queue_push(&queue, (Candidate){b, cls[b], 0});
+    }
+
+    int head = 0;
+    while (head >= 0) {
+        for (int b = head; b >= 0; b = chains->next[b]) {
+            order[count++] = b;
+            placed[b] = true;
+        }
+        for (int b = head; b >= 0; b = chains->next[b]) {
+            for (int kind = CFG_FALLTHROUGH; kind <= CFG_TARGET; kind++) {
+                int succ = cfg->blocks[b].succ[kind];
+                if (succ < 0) continue;
+                int target = chain_head(chains, succ);
+                if (placed[target] || target == chains->trailer) continue;
+                affinity[target] += cfg->blocks[b].weight[kind];
+                queue_push(&queue, (Candidate){target, cls[target], affinity[target]});
+            }
+        }
+
+        head = -1;
+        while (queue.count > 0) {
+            Candidate next = queue_pop(&queue);
+            if (!placed[next.head] && next.affinity == affinity[next.head]) {
+                head = next.head;
+                break;
+            }
+        }
+    }
+
+    if (chains->trailer >= 0) order[count++] = chains->trailer;
+done:
+    free(placed);
+    free(cls);
+    free(affinity);
+    free(queue.items);
+    return count;
+}
+
+static const char *block_label(Cfg *cfg, char **new_labels, int block) {
+    if (cfg->blocks[block].label) return cfg->blocks[block].label;
+    if (!new_labels[block]) {
+        char name[32];
+        snprintf(name, sizeof(name), ".LB%d", label_count++);
+        new_labels[block] = strdup(name);
+    }
+    return new_labels[block];
+}
+
+// Rewrite the code in the new block order
+static bool emit_blocks(Cfg *cfg, const int *order, int count) {
+    char **new_labels = calloc(cfg->count, sizeof(char *));
+    char **endings = calloc(cfg->count * 2, sizeof(char *));   // Terminator, extra jmp
+    bool *drop = calloc(cfg->count, sizeof(bool));
+    InsnList *out = insn_list_create();
+    bool ok = new_labels && endings && drop && out;
+
+    // Decide how each block ends before emitting anything, since a jump
+    // may need a label on a block that is emitted earlier
+    for (int p = 0; ok && p < count; p++) {
+        int b = order[p];
+        int next = p + 1 < count ? order[p + 1] : -1;
+        BasicBlock *block = &cfg->blocks[b];
+        int fallthrough = block->succ[CFG_FALLTHROUGH];
+        int target = block->succ[CFG_TARGET];
+        char line[160];
+
+        if (fallthrough >= 0 && target >= 0) {
+            Insn *jump = &cfg->code->items[block->terminator];
+            const char *inverted = insn_invert_cond(jump->mnemonic + 1);
+            if (next == fallthrough) continue;
+            if (next == target && inverted) {
+                snprintf(line, sizeof(line), "\tj%s %s", inverted,
+                         block_label(cfg, new_labels, fallthrough));
+                endings[b * 2] = strdup(line);
+                continue;
+            }
+            snprintf(line, sizeof(line), "\tjmp %s", block_label(cfg, new_labels, fallthrough));
+            endings[b * 2 + 1] = strdup(line);
+        } else if (target >= 0) {
+            if (next == target) drop[b] = true;
+        } else if (fallthrough >= 0 && next != fallthrough) {
+            snprintf(line, sizeof(line), "\tjmp %s", block_label(cfg, new_labels, fallthrough));
+            endings[b * 2 + 1] = strdup(line);
+        }
+    }
+
+    for (int p = 0; ok && p < count; p++) {
+        int b = order[p];
+        BasicBlock *block = &cfg->blocks[b];
+        char line[160];
+
+        if (new_labels[b]) {
+            snprintf(line, sizeof(line), "%s:", new_labels[b]);
+            insn_list_append(out, line);
+        }
+        for (int i = block->start; i < block->end; i++) {
+            Insn *insn = &cfg->code->items[i];
+            if (insn->kind == INSN_DELETED) continue;
+            if (i == block->terminator && drop[b]) continue;
+            if (i == block->terminator && endings[b * 2]) {
+                insn_list_append(out, endings[b * 2]);
+                continue;
+            }
+            insn_list_append(out, insn->text);
+        }
+        if (endings[b * 2 + 1]) insn_list_append(out, endings[b * 2 + 1]);
+    }
+
+    if (ok) {
+        insn_list_clear(cfg->code);
+        insn_list_splice(cfg->code, out);
+    }
+
+    for (int b = 0; new_labels && b < cfg->count; b++) free(new_labels[b]);
+    for (int b = 0; endings && b < cfg->count * 2; b++) free(endings[b]);
+    free(new_labels);
+    free(endings);
+    free(drop);
+    insn_list_free(out);
+    return ok;
+}
+
+int layout_blocks(Cfg *cfg) {
+    int n = cfg->count;
+    if (n < 3) return 0;
+
+    Chains chains = {cfg, malloc(sizeof(int) * n), malloc(sizeof(int) * n),
+                     malloc(sizeof(int) * n), malloc(sizeof(int) * n), -1};
+    int *order = malloc(sizeof(int) * n);
+    int moved = 0;
+
+    if (chains.next && chains.prev && chains.parent && chains.tail && order) {
+        for (int b = 0; b < n; b++) {
+            chains.next[b] = chains.prev[b] = -1;
+            chains.parent[b] = chains.tail[b] = b;
+        }
+        BasicBlock *last = &cfg->blocks[n - 1];
+        if (!last->label && last->terminator < 0 && last->succ[CFG_FALLTHROUGH] < 0) {
+            chains.trailer = n - 1;
+        }
+
+        build_chains(&chains);
+        int count = order_chains(&chains, order);
+        for (int p = 0; p < count; p++) {
+            if (order[p] != p) moved++;
+        }
+        if (count != n || (moved && !emit_blocks(cfg, order, count))) moved = 0;
+    }
+
+    free(chains.next);
+    free(chains.prev);
+    free(chains.parent);
+    free(chains.tail);
+    free(order);
+    return moved;
+}
+
+int layout_function(InsnList *code) {
+    Cfg *cfg = cfg_build(code);
+    if (!cfg) return 0;
+
+    cfg_estimate(cfg);
+    int moved = layout_blocks(cfg);
+    cfg_free(cfg);
+    return moved;
+}
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
@@ -84,6 +85,14 @@ Token *lexer_make_number(Lexer *lexer) {
         }
         lexer_advance(lexer);
     }
+
+    // Suffixes: u or U for unsigned, l, L, ll or LL for long
+    while (lexer->current_char && strchr("uUlL", lexer->current_char)) {
+        if (i < 255) {
+            buffer[i++] = lexer->current_char;
+        }
+        lexer_advance(lexer);
+    }
     
     return token_create(TOKEN_NUMBER, buffer, line, column);
 }
@@ -109,10 +118,123 @@ Token *lexer_make_identifier(Lexer *lexer) {
     if (strcmp(buffer, "while") == 0) return token_create(TOKEN_WHILE, buffer, line, column);
     if (strcmp(buffer, "for") == 0) return token_create(TOKEN_FOR, buffer, line, column);
     if (strcmp(buffer, "void") == 0) return token_create(TOKEN_VOID, buffer, line, column);
+    if (strcmp(buffer, "switch") == 0) return token_create(TOKEN_SWITCH, buffer, line, column);
+    if (strcmp(buffer, "case") == 0) return token_create(TOKEN_CASE, buffer, line, column);
+    if (strcmp(buffer, "default") == 0) return token_create(TOKEN_DEFAULT, buffer, line, column);
+    if (strcmp(buffer, "break") == 0) return token_create(TOKEN_BREAK, buffer, line, column);
+    if (strcmp(buffer, "char") == 0) return token_create(TOKEN_CHAR_TYPE, buffer, line, column);
+    if (strcmp(buffer, "short") == 0) return token_create(TOKEN_SHORT, buffer, line, column);
+    if (strcmp(buffer, "long") == 0) return token_create(TOKEN_LONG, buffer, line, column);
+    if (strcmp(buffer, "signed") == 0) return token_create(TOKEN_SIGNED, buffer, line, column);
+    if (strcmp(buffer, "unsigned") == 0) return token_create(TOKEN_UNSIGNED, buffer, line, column);
     
     return token_create(TOKEN_IDENTIFIER, buffer, line, column);
 }
 
+// Byte value of the escape sequence after a backslash, as in C: \n, \t and
+// the like, up to three octal digits, or \x and hex digits
+static int lexer_escape(Lexer *lexer) {
+    char c = lexer->current_char;
+    lexer_advance(lexer);
+
+    switch (c) {
+        case 'n': return '\n';
+        case 't': return '\t';
+        case 'r': return '\r';
+        case 'a': return '\a';
+        case 'b': return '\b';
+        case 'f': return '\f';
+        case 'v': return '\v';
+        case 'x': {
+            int value = 0;
+            while (isxdigit(lexer->current_char)) {
+                char d = lexer->current_char;
+                value = value * 16 + (isdigit(d) ? d - '0' : tolower(d) - 'a' + 10);
+                lexer_advance(lexer);
+            }
+            return value & 0xff;
+        }
+        default:
+            if (c >= '0' && c <= '7') {
+                int value = c - '0';
+                for (int i = 0; i < 2 && lexer->current_char >= '0' && lexer->current_char <= '7'; i++) {
+                    value = value * 8 + lexer->current_char - '0';
+                    lexer_advance(lexer);
+                }
+                return value & 0xff;
+            }
+            return (unsigned char)c;   // \\, \', \" and \?
+    }
+}
+
+// String literal: the token value holds its bytes with the escapes
+// decoded. A string may not contain a null character, which would end it.
+Token *lexer_make_string(Lexer *lexer) {
+    int line = lexer->line;
+    int column = lexer->column;
+    size_t length = 0, capacity = 64;
+    char *buffer = malloc(capacity);
+    if (!buffer) return NULL;
+
+    lexer_advance(lexer);   // Opening quote
+    while (lexer->current_char && lexer->current_char != '"' && lexer->current_char != '\n') {
+        int c = (unsigned char)lexer->current_char;
+        if (c == '\\') {
+            lexer_advance(lexer);
+            c = lexer_escape(lexer);
+        } else {
+            lexer_advance(lexer);
+        }
+        if (c == 0) {
+            free(buffer);
+            return token_create(TOKEN_ERROR, "\\0", line, column);
+        }
+
+        if (length + 2 > capacity) {
+            capacity *= 2;
+            char *temp = realloc(buffer, capacity);
+            if (!temp) {
+                free(buffer);
+                return NULL;
+            }
+            buffer = temp;
+        }
+        buffer[length++] = (char)c;
+    }
+    buffer[length] = '\0';
+
+    if (lexer->current_char != '"') {
+        free(buffer);
+        return token_create(TOKEN_ERROR, "\"", line, column);
+    }
+    lexer_advance(lexer);
+
+    Token *token = token_create(TOKEN_STRING, buffer, line, column);
+    free(buffer);
+    return token;
+}
+
+// Character literal: the token value is the decimal value of the char
+Token *lexer_make_char(Lexer *lexer) {
+    int line = lexer->line;
+    int column = lexer->column;
+
+    lexer_advance(lexer);   // Opening quote
+    if (!lexer->current_char || lexer->current_char == '\'' || lexer->current_char == '\n') {
+        return token_create(TOKEN_ERROR, "'", line, column);
+    }
+    int c = (unsigned char)lexer->current_char;
+    lexer_advance(lexer);
+    if (c == '\\') c = lexer_escape(lexer);
+
+    if (lexer->current_char != '\'') return token_create(TOKEN_ERROR, "'", line, column);
+    lexer_advance(lexer);
+
+    char value[8];
+    snprintf(value, sizeof(value), "%d", (signed char)c);
+    return token_create(TOKEN_CHAR, value, line, column);
+}
+
 Token *lexer_next_token(Lexer *lexer) {
     while (lexer->current_char) {
         // Skip whitespace and comments
@@ -134,6 +256,14 @@ Token *lexer_next_token(Lexer *lexer) {
             return lexer_make_identifier(lexer);
         }
 
+        if (lexer->current_char == '"') {
+            return lexer_make_string(lexer);
+        }
+
+        if (lexer->current_char == '\'') {
+            return lexer_make_char(lexer);
+        }
+
         // Handle operators and punctuation
         int line = lexer->line;
         int column = lexer->column;
@@ -154,6 +284,7 @@ Token *lexer_next_token(Lexer *lexer) {
             case ']': return token_create(TOKEN_RBRACKET, "]", line, column);
             case ';': return token_create(TOKEN_SEMICOLON, ";", line, column);
             case ',': return token_create(TOKEN_COMMA, ",", line, column);
+            case ':': return token_create(TOKEN_COLON, ":", line, column);
             case '.': return token_create(TOKEN_DOT, ".", line, column);
             
             // Two-character operators
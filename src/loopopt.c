@@ -0,0 +1,287 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <loopopt.h>
+
+static int temp_count = 0;
+
+// Variables assigned somewhere inside a loop
+typedef struct {
+    char **names;
+    int count;
+} NameSet;
+
+// Expressions hoisted into the preheader of the current loop
+typedef struct {
+    ASTNode **statements;
+    int count;
+    NameSet assigned;
+} Preheader;
+
+static bool name_set_contains(NameSet *set, const char *name) {
+    for (int i = 0; i < set->count; i++) {
+        if (strcmp(set->names[i], name) == 0) return true;
+    }
+    return false;
+}
+
+static void name_set_add(NameSet *set, const char *name) {
+    if (name_set_contains(set, name)) return;
+
+    void *temp = realloc(set->names, sizeof(char *) * (set->count + 1));
+    if (!temp) return;
+    set->names = temp;
+    set->names[set->count++] = (char *)name;
+}
+
+static void collect_assigned(ASTNode *node, NameSet *set) {
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                collect_assigned(node->data.block.statements[i], set);
+            }
+            break;
+        case NODE_IF:
+            collect_assigned(node->data.if_stmt.then_branch, set);
+            collect_assigned(node->data.if_stmt.else_branch, set);
+            break;
+        case NODE_WHILE:
+            collect_assigned(node->data.while_stmt.body, set);
+            break;
+        case NODE_FOR:
+            collect_assigned(node->data.for_stmt.init, set);
+            collect_assigned(node->data.for_stmt.step, set);
+            collect_assigned(node->data.for_stmt.body, set);
+            break;
+        case NODE_SWITCH:
+            collect_assigned(node->data.switch_stmt.body, set);
+            break;
+        case NODE_BINARY_OP:
+            if (node->data.binary_op.operator == '=') {
+                ASTNode *target = node->data.binary_op.left;
+                if (target->type == NODE_INDEX) target = target->data.index.array;
+                name_set_add(set, target->data.variable.name);
+            }
+            break;
+        case NODE_VARIABLE:
+            // A declaration inside the loop starts a fresh value every trip
+            name_set_add(set, node->data.variable.name);
+            break;
+        default:
+            break;
+    }
+}
+
+// Pure, non-trapping and computed only from values the loop never changes
+static bool is_invariant(ASTNode *node, NameSet *assigned) {
+    switch (node->type) {
+        case NODE_NUMBER:
+            return true;
+        case NODE_VARIABLE:
+            // A call in the loop may change a global
+            return !node->data.variable.is_global &&
+                   !name_set_contains(assigned, node->data.variable.name);
+        case NODE_BINARY_OP: {
+            char op = node->data.binary_op.operator;
+            if (op == '=') return false;
+            if (op == '/') {
+                // Hoisting a division could fault on a path that never ran it
+                ASTNode *divisor = node->data.binary_op.right;
+                if (divisor->type != NODE_NUMBER || divisor->data.number.value == 0 ||
+                    divisor->data.number.value == -1) {
+                    return false;
+                }
+            }
+            return is_invariant(node->data.binary_op.left, assigned) &&
+                   is_invariant(node->data.binary_op.right, assigned);
+        }
+        case NODE_UNARY_OP:
+            return node->data.unary_op.operator == 'C' &&
+                   is_invariant(node->data.unary_op.operand, assigned);
+        default:
+            return false;
+    }
+}
+
+static bool preheader_add(Preheader *pre, ASTNode *statement) {
+    void *temp = realloc(pre->statements, sizeof(ASTNode *) * (pre->count + 1));
+    if (!temp) return false;
+    pre->statements = temp;
+    pre->statements[pre->count++] = statement;
+    return true;
+}
+
+// Replace *slot with a temporary if it is invariant, otherwise look deeper
+static void hoist_expression(ASTNode **slot, Preheader *pre) {
+    ASTNode *node = *slot;
+    if (!node) return;
+
+    if (node->type == NODE_BINARY_OP && node->data.binary_op.operator != '=' &&
+        is_invariant(node, &pre->assigned)) {
+        // Reuse the temporary of an identical expression hoisted earlier
+        for (int i = 0; i < pre->count; i++) {
+            ASTNode *assign = pre->statements[i];
+            if (ast_equal(assign->data.binary_op.right, node)) {
+                *slot = ast_create_variable(assign->data.binary_op.left->data.variable.name);
+                if (*slot) (*slot)->value_type = node->value_type;
+                ast_free(node);
+                return;
+            }
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), ".licm%d", temp_count++);
+        ASTNode *temp = ast_create_variable(name);
+        if (temp) temp->value_type = node->value_type;
+        ASTNode *assign = ast_create_binary_op('=', temp, node);
+        if (!assign || !preheader_add(pre, assign)) return;
+        *slot = ast_create_variable(name);
+        if (*slot) (*slot)->value_type = node->value_type;
+        return;
+    }
+
+    switch (node->type) {
+        case NODE_BINARY_OP:
+            if (node->data.binary_op.operator != '=' ||
+                node->data.binary_op.left->type == NODE_INDEX) {
+                hoist_expression(&node->data.binary_op.left, pre);
+            }
+            hoist_expression(&node->data.binary_op.right, pre);
+            break;
+        case NODE_UNARY_OP:
+            hoist_expression(&node->data.unary_op.operand, pre);
+            break;
+        case NODE_INDEX:
+            hoist_expression(&node->data.index.index, pre);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                hoist_expression(&node->data.call.args[i], pre);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void hoist_statement(ASTNode *node, Preheader *pre) {
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                hoist_statement(node->data.block.statements[i], pre);
+            }
+            break;
+        case NODE_RETURN:
+            hoist_expression(&node->data.return_stmt.expression, pre);
+            break;
+        case NODE_IF:
+            hoist_expression(&node->data.if_stmt.condition, pre);
+            hoist_statement(node->data.if_stmt.then_branch, pre);
+            hoist_statement(node->data.if_stmt.else_branch, pre);
+            break;
+        case NODE_WHILE:
+            hoist_expression(&node->data.while_stmt.condition, pre);
+            hoist_statement(node->data.while_stmt.body, pre);
+            break;
+        case NODE_FOR:
+            hoist_statement(node->data.for_stmt.init, pre);
+            hoist_expression(&node->data.for_stmt.condition, pre);
+            hoist_statement(node->data.for_stmt.step, pre);
+            hoist_statement(node->data.for_stmt.body, pre);
+            break;
+        case NODE_SWITCH:
+            hoist_expression(&node->data.switch_stmt.value, pre);
+            hoist_statement(node->data.switch_stmt.body, pre);
+            break;
+        case NODE_BINARY_OP:
+        case NODE_CALL:
+            hoist_expression(&node, pre);
+            break;
+        default:
+            break;
+    }
+}
+
+// Insert statements into a block in front of position index
+static bool block_insert(ASTNode *block, int index, ASTNode **statements, int count) {
+    if (count == 0) return true;
+
+    int total = block->data.block.statement_count + count;
+    void *temp = realloc(block->data.block.statements, sizeof(ASTNode *) * total);
+    if (!temp) return false;
+    block->data.block.statements = temp;
+
+    memmove(&block->data.block.statements[index + count],
+            &block->data.block.statements[index],
+            sizeof(ASTNode *) * (block->data.block.statement_count - index));
+    memcpy(&block->data.block.statements[index], statements, sizeof(ASTNode *) * count);
+    block->data.block.statement_count = total;
+    return true;
+}
+
+static int loopopt_statement(ASTNode *node) {
+    if (!node) return 0;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            return loopopt_block(node);
+        case NODE_IF:
+            return loopopt_statement(node->data.if_stmt.then_branch) +
+                   loopopt_statement(node->data.if_stmt.else_branch);
+        case NODE_WHILE:
+            return loopopt_statement(node->data.while_stmt.body);
+        case NODE_FOR:
+            return loopopt_statement(node->data.for_stmt.body);
+        case NODE_SWITCH:
+            return loopopt_statement(node->data.switch_stmt.body);
+        default:
+            return 0;
+    }
+}
+
+int loopopt_block(ASTNode *block) {
+    if (!block || block->type != NODE_BLOCK) return 0;
+
+    int hoisted = 0;
+    for (int i = 0; i < block->data.block.statement_count; i++) {
+        ASTNode *loop = block->data.block.statements[i];
+
+        // Inner loops first, so their invariants can move out level by level
+        hoisted += loopopt_statement(loop);
+        if (loop->type != NODE_WHILE && loop->type != NODE_FOR) continue;
+
+        // The initializer runs once; pull it out so the preheader follows it
+        if (loop->type == NODE_FOR && loop->data.for_stmt.init) {
+            if (!block_insert(block, i, &loop->data.for_stmt.init, 1)) continue;
+            loop->data.for_stmt.init = NULL;
+            i++;
+        }
+
+        Preheader pre = {NULL, 0, {NULL, 0}};
+        collect_assigned(loop, &pre.assigned);
+        hoist_statement(loop, &pre);
+
+        if (block_insert(block, i, pre.statements, pre.count)) {
+            i += pre.count;
+            hoisted += pre.count;
+        }
+        free(pre.statements);
+        free(pre.assigned.names);
+    }
+    return hoisted;
+}
+
+int loopopt_optimize(ASTNode *program) {
+    int hoisted = 0;
+    for (int i = 0; i < program->data.program.function_count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        if (function->type == NODE_FUNCTION) {
+            hoisted += loopopt_block(function->data.function.body);
+        }
+    }
+    return hoisted;
+}
\ No newline at end of file
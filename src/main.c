@@ -1,9 +1,16 @@
+#include <assembler.h>
 #include <codegen.h>
+#include <inliner.h>
+#include <jit.h>
 #include <lexer.h>
 #include <parser.h>
+#include <passes.h>
+#include <target.h>
+#include <typecheck.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 // Read entire file into memory
 char *read_file(const char *filename) {
@@ -29,17 +36,46 @@ char *read_file(const char *filename) {
   return buffer;
 }
 
-int main(int argc, char *argv[]) {
-  if (argc != 3) {
-    fprintf(stderr, "Usage: %s <input.c> <output.s>\n", argv[0]);
-    return 1;
-  }
+static void usage(const char *program) {
+  fprintf(stderr, "Usage: %s [options] <input.c> <output>\n", program);
+  fprintf(stderr, "       %s [options] --run <input.c> [arguments]\n", program);
+  fprintf(stderr, "       %s [options] --run-batch <input.c>...\n", program);
+  fprintf(stderr, "Options:\n");
+  fprintf(stderr, "  -O0 -O1 -O2 -Os       Optimization level (default -O2)\n");
+  fprintf(stderr, "  --emit=asm|obj|exe    Write assembly (default), an ELF object file, or\n"
+                  "                        a static executable when nothing is external\n");
+  fprintf(stderr, "  --inline-threshold=N  Inline calls whose cost is at most N "
+                  "(default %d, negative disables)\n",
+          INLINER_DEFAULT_THRESHOLD);
+  fprintf(stderr, "  --run                 Compile in memory and run main with the arguments\n"
+                  "                        after the input, exiting with its status\n");
+  fprintf(stderr, "  --run-batch           Compile and run each input in turn in this process,\n"
+                  "                        printing its name and exit status\n");
+  fprintf(stderr, "  --time-passes         Report time and allocations per pass\n");
+  fprintf(stderr, "  --profile-generate[=FILE]\n"
+                  "                        Instrument the program to write execution "
+                  "counts to FILE (default %s)\n",
+          PROFILE_DEFAULT_FILE);
+  fprintf(stderr, "  --profile-use[=FILE]  Optimize using the counts in FILE\n");
+  fprintf(stderr, "  --disable-pass=NAME   Skip one pass of the pipeline\n");
+  fprintf(stderr, "  --export=NAME         Keep NAME callable from outside the program\n");
+  fprintf(stderr, "  --dump-callgraph      Print the call graph being compiled\n");
+  fprintf(stderr, "  -fno-omit-frame-pointer\n"
+                  "                        Keep %%rbp as the frame pointer when optimizing\n");
+  fprintf(stderr, "  -march=CPU            Select instructions for x86-64, x86-64-v2, x86-64-v3\n"
+                  "                        or native, the CPU compiling (default x86-64)\n");
+}
 
+// Compile input_file with gen, reporting any error. The --disable-pass
+// options are taken from argv[1] to argv[argc - 1], the compiler's own
+// arguments.
+static bool compile(const char *input_file, CompileOptions options, int argc, char *argv[],
+                    CodeGenerator *gen) {
   // Read input file
-  char *source = read_file(argv[1]);
+  char *source = read_file(input_file);
   if (!source) {
     fprintf(stderr, "Failed to read input file\n");
-    return 1;
+    return false;
   }
 
   // Create lexer
@@ -47,7 +83,7 @@ int main(int argc, char *argv[]) {
   if (!lexer) {
     fprintf(stderr, "Failed to create lexer\n");
     free(source);
-    return 1;
+    return false;
   }
 
   // Create parser
@@ -56,7 +92,7 @@ int main(int argc, char *argv[]) {
     fprintf(stderr, "Failed to create parser\n");
     lexer_free(lexer);
     free(source);
-    return 1;
+    return false;
   }
 
   // Parse the program
@@ -66,30 +102,220 @@ int main(int argc, char *argv[]) {
     parser_free(parser);
     lexer_free(lexer);
     free(source);
-    return 1;
+    return false;
   }
 
-  // Create code generator
-  CodeGenerator *codegen = codegen_create(argv[2]);
-  if (!codegen) {
-    fprintf(stderr, "Failed to create code generator\n");
+  // Type the expressions and make their conversions explicit
+  if (!typecheck_program(ast)) {
     ast_free(ast);
     parser_free(parser);
     lexer_free(lexer);
     free(source);
-    return 1;
+    return false;
   }
 
-  // Generate code
-  codegen_generate(codegen, ast);
+  // Create pass manager
+  PassManager *passes = pass_manager_create(options);
+  if (!passes) {
+    fprintf(stderr, "Failed to create pass manager\n");
+    ast_free(ast);
+    parser_free(parser);
+    lexer_free(lexer);
+    free(source);
+    return false;
+  }
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--disable-pass=", 15) == 0 &&
+        !pass_manager_enable(passes, argv[i] + 15, false)) {
+      fprintf(stderr, "Warning: no pass named %s\n", argv[i] + 15);
+    }
+  }
+
+  // Optimize and generate code
+  pass_manager_run(passes, ast, gen);
 
   // Clean up
-  codegen_free(codegen);
+  pass_manager_free(passes);
   ast_free(ast);
   parser_free(parser);
   lexer_free(lexer);
   free(source);
+  return true;
+}
+
+// Compile input_file in memory and run it with program_argv, setting
+// *status to its exit status
+static bool run(const char *input_file, CompileOptions options, int argc, char *argv[],
+                int program_argc, char **program_argv, int *status) {
+  CodeGenerator *codegen = codegen_create(NULL, EMIT_MEMORY);
+  if (!codegen) {
+    fprintf(stderr, "Failed to create code generator\n");
+    return false;
+  }
+  bool ran = compile(input_file, options, argc, argv, codegen);
+  if (ran) {
+    char error[ASSEMBLER_ERROR_SIZE];
+    ran = jit_run(codegen->insns, program_argc, program_argv, status, error, sizeof(error));
+    if (!ran) fprintf(stderr, "Error in %s: %s\n", input_file, error);
+  }
+  codegen_free(codegen);
+  return ran;
+}
+
+int main(int argc, char *argv[]) {
+  const char *input_file = NULL;
+  const char *output_file = NULL;
+  EmitFormat emit = EMIT_ASSEMBLY;
+  bool run_program = false;
+  int program_arg = 0;     // --run: index of the input, then its arguments
+  bool run_batch = false;
+  CompileOptions options = {OPT_LEVEL_2, INLINER_DEFAULT_THRESHOLD, false, false, NULL, NULL,
+                            NULL, 0, false, true, {TARGET_X86_64, 0}};
+  const char **exports = calloc(argc, sizeof(char *));
+  const char **batch = calloc(argc, sizeof(char *));
+  int batch_count = 0;
+  if (!exports || !batch) {
+    free(exports);
+    free(batch);
+    return 1;
+  }
+  options.exports = exports;
+
+  for (int i = 1; i < argc; i++) {
+    if (pass_parse_opt_level(argv[i], &options.level)) {
+      continue;
+    } else if (strncmp(argv[i], "--inline-threshold=", 19) == 0) {
+      options.inline_threshold = atoi(argv[i] + 19);
+      options.inline_threshold_set = true;
+    } else if (strcmp(argv[i], "--inline-threshold") == 0 && i + 1 < argc) {
+      options.inline_threshold = atoi(argv[++i]);
+      options.inline_threshold_set = true;
+    } else if (strncmp(argv[i], "--emit=", 7) == 0) {
+      const char *format = argv[i] + 7;
+      if (strcmp(format, "asm") == 0) {
+        emit = EMIT_ASSEMBLY;
+      } else if (strcmp(format, "obj") == 0) {
+        emit = EMIT_OBJECT;
+      } else if (strcmp(format, "exe") == 0) {
+        emit = EMIT_EXECUTABLE;
+      } else {
+        fprintf(stderr, "Unknown --emit value: %s\n", format);
+        free(exports);
+        free(batch);
+        return 1;
+      }
+    } else if (strcmp(argv[i], "--run") == 0) {
+      run_program = true;
+    } else if (strcmp(argv[i], "--run-batch") == 0) {
+      run_batch = true;
+    } else if (strcmp(argv[i], "--time-passes") == 0) {
+      options.time_passes = true;
+    } else if (strcmp(argv[i], "--profile-generate") == 0) {
+      options.profile_generate = PROFILE_DEFAULT_FILE;
+    } else if (strncmp(argv[i], "--profile-generate=", 19) == 0) {
+      options.profile_generate = argv[i] + 19;
+    } else if (strcmp(argv[i], "--profile-use") == 0) {
+      options.profile_use = PROFILE_DEFAULT_FILE;
+    } else if (strncmp(argv[i], "--profile-use=", 14) == 0) {
+      options.profile_use = argv[i] + 14;
+    } else if (strncmp(argv[i], "--export=", 9) == 0) {
+      exports[options.export_count++] = argv[i] + 9;
+    } else if (strcmp(argv[i], "--dump-callgraph") == 0) {
+      options.dump_callgraph = true;
+    } else if (strcmp(argv[i], "-fomit-frame-pointer") == 0) {
+      options.omit_frame_pointer = true;
+    } else if (strcmp(argv[i], "-fno-omit-frame-pointer") == 0) {
+      options.omit_frame_pointer = false;
+    } else if (strncmp(argv[i], "-march=", 7) == 0) {
+      if (!target_parse(argv[i] + 7, &options.target)) {
+        fprintf(stderr, "Unknown -march value: %s\n", argv[i] + 7);
+        free(exports);
+        free(batch);
+        return 1;
+      }
+    } else if (strncmp(argv[i], "--disable-pass=", 15) == 0) {
+      continue;  // Applied once the pass manager exists
+    } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+      fprintf(stderr, "Unknown option: %s\n", argv[i]);
+      usage(argv[0]);
+      free(exports);
+      free(batch);
+      return 1;
+    } else if (run_batch) {
+      batch[batch_count++] = argv[i];
+    } else if (!input_file) {
+      input_file = argv[i];
+      if (run_program) {
+        program_arg = i;
+        break;  // The rest are the program's arguments
+      }
+    } else if (!output_file) {
+      output_file = argv[i];
+    } else {
+      usage(argv[0]);
+      free(exports);
+      free(batch);
+      return 1;
+    }
+  }
+
+  int status = 0;
+  if (run_program || run_batch) {
+    bool ran = true;
+    if (run_program && input_file) {
+      // What follows the input belongs to the program, not the compiler
+      ran = run(input_file, options, program_arg, argv, argc - program_arg, argv + program_arg, &status);
+    } else if (run_batch && batch_count > 0) {
+      for (int i = 0; i < batch_count; i++) {
+        char *program_argv[] = {(char *)batch[i], NULL};
+        if (run(batch[i], options, argc, argv, 1, program_argv, &status)) {
+          printf("%s %d\n", batch[i], status & 0xff);
+        } else {
+          printf("%s failed\n", batch[i]);
+          ran = false;
+        }
+        fflush(stdout);
+      }
+    } else {
+      usage(argv[0]);
+      ran = false;
+    }
+    free(exports);
+    free(batch);
+    if (!ran) return 1;
+    return run_batch ? 0 : status;
+  }
 
-  printf("Compilation successful: output written to %s\n", argv[2]);
+  if (!input_file || !output_file) {
+    usage(argv[0]);
+    free(exports);
+    free(batch);
+    return 1;
+  }
+
+  // Create code generator
+  CodeGenerator *codegen = codegen_create(output_file, emit);
+  if (!codegen) {
+    fprintf(stderr, "Failed to create code generator\n");
+    free(exports);
+    free(batch);
+    return 1;
+  }
+  bool compiled = compile(input_file, options, argc, argv, codegen);
+  // The assembler and linker report their own errors
+  bool assembled = !codegen->failed;
+  bool written = codegen_free(codegen);
+  free(exports);
+  free(batch);
+
+  // Leave no partial or empty output behind
+  if (!compiled || !written) unlink(output_file);
+  if (!compiled) return 1;
+
+  if (!written) {
+    if (assembled) fprintf(stderr, "Error writing %s\n", output_file);
+    return 1;
+  }
+  printf("Compilation successful: output written to %s\n", output_file);
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,425 @@
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <object.h>
+
+// File being written, and how far
+typedef struct {
+    Output *output;
+    unsigned long position;
+} Writer;
+
+typedef struct {
+    char *data;
+    size_t size;
+    size_t capacity;
+    bool failed;         // Out of memory
+} StringTable;
+
+// The symbols an ELF file lists, locals first as ELF requires
+typedef struct {
+    Elf64_Sym *symbols;
+    int count;
+    int first_global;
+    StringTable names;
+    int *index;          // ELF symbol of each assembly symbol, 0 for none
+} SymbolTable;
+
+static void write_bytes(Writer *writer, const void *data, size_t size) {
+    output_write(writer->output, data, size);
+    writer->position += size;
+}
+
+static void write_zeros(Writer *writer, unsigned long offset) {
+    static const char zeros[256];
+    while (writer->position < offset) {
+        unsigned long count = offset - writer->position;
+        write_bytes(writer, zeros, count < sizeof(zeros) ? count : sizeof(zeros));
+    }
+}
+
+static unsigned long align_up(unsigned long value, unsigned long align) {
+    return align > 1 ? (value + align - 1) / align * align : value;
+}
+
+// Offset of text in the table, appended unless it is empty
+static unsigned string_add(StringTable *table, const char *text) {
+    if (table->size == 0) {
+        table->data = malloc(256);
+        if (!table->data) {
+            table->failed = true;
+            return 0;
+        }
+        table->capacity = 256;
+        table->data[table->size++] = '\0';
+    }
+    if (*text == '\0') return 0;
+
+    size_t length = strlen(text) + 1;
+    if (table->size + length > table->capacity) {
+        size_t capacity = table->capacity;
+        while (capacity < table->size + length) capacity *= 2;
+        char *data = realloc(table->data, capacity);
+        if (!data) {
+            table->failed = true;
+            return 0;
+        }
+        table->data = data;
+        table->capacity = capacity;
+    }
+    size_t offset = table->size;
+    memcpy(table->data + offset, text, length);
+    table->size += length;
+    return (unsigned)offset;
+}
+
+static bool is_listed(const AsmSymbol *symbol, bool executable) {
+    if (symbol->type == STT_SECTION) return !executable && symbol->referenced;
+    if (symbol->global) return true;
+    if (symbol->section < 0) return false;
+    // Local labels only as far as a relocation needs them
+    return strncmp(symbol->name, ".L", 2) != 0 || (!executable && symbol->referenced);
+}
+
+static void add_symbol(SymbolTable *table, const Assembly *assembly, int i,
+                       const unsigned *section_index, const unsigned long *addresses) {
+    const AsmSymbol *symbol = &assembly->symbols[i];
+    Elf64_Sym *out = &table->symbols[table->count];
+    memset(out, 0, sizeof(*out));
+    if (symbol->type != STT_SECTION) out->st_name = string_add(&table->names, symbol->name);
+    out->st_info = (unsigned char)ELF64_ST_INFO(symbol->global ? STB_GLOBAL : STB_LOCAL, symbol->type);
+    out->st_other = STV_DEFAULT;
+    if (symbol->section >= 0) {
+        out->st_shndx = (Elf64_Half)section_index[symbol->section];
+        out->st_value = addresses[symbol->section] + symbol->value;
+    } else {
+        out->st_shndx = SHN_UNDEF;
+    }
+    out->st_size = symbol->size;
+    table->index[i] = table->count++;
+}
+
+// Section and local symbols, then the global ones, with their values as
+// the addresses of their sections place them
+static bool build_symbols(const Assembly *assembly, bool executable, const unsigned *section_index,
+                          const unsigned long *addresses, SymbolTable *table) {
+    memset(table, 0, sizeof(*table));
+    table->symbols = calloc((size_t)assembly->symbol_count + 1, sizeof(Elf64_Sym));
+    table->index = calloc((size_t)assembly->symbol_count + 1, sizeof(int));
+    if (!table->symbols || !table->index) return false;
+    string_add(&table->names, "");
+    table->count = 1;
+
+    for (int i = 0; i < assembly->symbol_count; i++) {
+        const AsmSymbol *symbol = &assembly->symbols[i];
+        if (symbol->type == STT_SECTION && is_listed(symbol, executable)) {
+            add_symbol(table, assembly, i, section_index, addresses);
+        }
+    }
+    for (int i = 0; i < assembly->symbol_count; i++) {
+        const AsmSymbol *symbol = &assembly->symbols[i];
+        if (symbol->type != STT_SECTION && !symbol->global && is_listed(symbol, executable)) {
+            add_symbol(table, assembly, i, section_index, addresses);
+        }
+    }
+    table->first_global = table->count;
+    for (int i = 0; i < assembly->symbol_count; i++) {
+        if (assembly->symbols[i].global) add_symbol(table, assembly, i, section_index, addresses);
+    }
+    return !table->names.failed;
+}
+
+static void free_symbols(SymbolTable *table) {
+    free(table->symbols);
+    free(table->index);
+    free(table->names.data);
+}
+
+static void init_elf_header(Elf64_Ehdr *header, unsigned type) {
+    memset(header, 0, sizeof(*header));
+    memcpy(header->e_ident, ELFMAG, SELFMAG);
+    header->e_ident[EI_CLASS] = ELFCLASS64;
+    header->e_ident[EI_DATA] = ELFDATA2LSB;
+    header->e_ident[EI_VERSION] = EV_CURRENT;
+    header->e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    header->e_type = (Elf64_Half)type;
+    header->e_machine = EM_X86_64;
+    header->e_version = EV_CURRENT;
+    header->e_ehsize = sizeof(Elf64_Ehdr);
+    header->e_shentsize = sizeof(Elf64_Shdr);
+}
+
+// Placement of everything after the ELF and program headers: a section
+// header for each part of the file, with what goes there, in the order of
+// their offsets
+typedef struct {
+    Elf64_Shdr *headers;
+    const void **contents;   // NULL for SHT_NOBITS
+    int count;
+    StringTable names;
+    unsigned long end;       // Of the file so far
+} Layout;
+
+static bool start_layout(Layout *layout, int capacity, unsigned long start) {
+    memset(layout, 0, sizeof(*layout));
+    layout->headers = calloc((size_t)capacity, sizeof(Elf64_Shdr));
+    layout->contents = calloc((size_t)capacity, sizeof(void *));
+    string_add(&layout->names, "");
+    layout->count = 1;
+    layout->end = start;
+    return layout->headers && layout->contents && !layout->names.failed;
+}
+
+static void free_layout(Layout *layout) {
+    free(layout->headers);
+    free(layout->contents);
+    free(layout->names.data);
+}
+
+// Add a section at offset, or at the end of the file if offset is 0, and
+// return its index
+static int place(Layout *layout, const char *name, unsigned type, unsigned long flags, unsigned long offset,
+                 unsigned long size, unsigned long align, unsigned long entsize, const void *contents) {
+    Elf64_Shdr *header = &layout->headers[layout->count];
+    if (offset == 0) offset = align_up(layout->end, align);
+    header->sh_name = string_add(&layout->names, name);
+    header->sh_type = type;
+    header->sh_flags = flags;
+    header->sh_offset = offset;
+    header->sh_size = size;
+    header->sh_addralign = align;
+    header->sh_entsize = entsize;
+    layout->contents[layout->count] = type == SHT_NOBITS ? NULL : contents;
+    if (type != SHT_NOBITS) layout->end = offset + size;
+    return layout->count++;
+}
+
+// Place the symbol table, its names and the section names last
+static void place_tables(Layout *layout, const SymbolTable *symbols) {
+    int symtab = place(layout, ".symtab", SHT_SYMTAB, 0, 0, (unsigned long)symbols->count * sizeof(Elf64_Sym),
+                       8, sizeof(Elf64_Sym), symbols->symbols);
+    layout->headers[symtab].sh_link = (unsigned)symtab + 1;
+    layout->headers[symtab].sh_info = (unsigned)symbols->first_global;
+    place(layout, ".strtab", SHT_STRTAB, 0, 0, symbols->names.size, 1, 0, symbols->names.data);
+    // The section names include their own, so the size is known only
+    // once it is added
+    int shstrtab = place(layout, ".shstrtab", SHT_STRTAB, 0, 0, 0, 1, 0, NULL);
+    layout->headers[shstrtab].sh_size = layout->names.size;
+    layout->contents[shstrtab] = layout->names.data;
+    layout->end += layout->names.size;
+}
+
+// Write everything laid out, then the section headers
+static void write_layout(Writer *writer, const Layout *layout) {
+    for (int i = 1; i < layout->count; i++) {
+        if (!layout->contents[i]) continue;
+        write_zeros(writer, layout->headers[i].sh_offset);
+        write_bytes(writer, layout->contents[i], layout->headers[i].sh_size);
+    }
+    write_zeros(writer, align_up(writer->position, 8));
+    write_bytes(writer, layout->headers, (size_t)layout->count * sizeof(Elf64_Shdr));
+}
+
+static void finish_elf_header(Elf64_Ehdr *elf, const Layout *layout) {
+    elf->e_shoff = align_up(layout->end, 8);
+    elf->e_shnum = (Elf64_Half)layout->count;
+    elf->e_shstrndx = (Elf64_Half)(layout->count - 1);
+}
+
+bool object_write_relocatable(const Assembly *assembly, Output *output, char *error, size_t error_size) {
+    int count = assembly->section_count;
+    unsigned *section_index = calloc((size_t)count + 1, sizeof(unsigned));
+    unsigned long *addresses = calloc((size_t)count + 1, sizeof(unsigned long));
+    int *starts = calloc((size_t)count + 2, sizeof(int));
+    Elf64_Rela *relas = calloc((size_t)assembly->relocation_count + 1, sizeof(Elf64_Rela));
+    SymbolTable symbols = {0};
+    Layout layout = {0};
+    bool ok = section_index && addresses && starts && relas &&
+              start_layout(&layout, 2 * count + 4, sizeof(Elf64_Ehdr));
+    if (ok) {
+        for (int s = 0; s < count; s++) section_index[s] = (unsigned)s + 1;
+        ok = build_symbols(assembly, false, section_index, addresses, &symbols);
+    }
+    if (!ok) goto done;
+
+    // The relocations of each section together, in order
+    for (int i = 0; i < assembly->relocation_count; i++) starts[assembly->relocations[i].section + 2]++;
+    for (int s = 0; s < count; s++) starts[s + 2] += starts[s + 1];
+    for (int i = 0; i < assembly->relocation_count; i++) {
+        const AsmRelocation *r = &assembly->relocations[i];
+        Elf64_Rela *rela = &relas[starts[r->section + 1]++];
+        rela->r_offset = r->offset;
+        rela->r_info = ELF64_R_INFO((unsigned long)symbols.index[r->symbol], r->type);
+        rela->r_addend = r->addend;
+    }
+
+    for (int s = 0; s < count; s++) {
+        const AsmSection *section = &assembly->sections[s];
+        place(&layout, section->name, section->type, section->flags, 0, section->size,
+              section->align, section->entsize, section->data);
+    }
+    int rela_count = 0;
+    for (int s = 0; s < count; s++) rela_count += starts[s + 1] > starts[s];
+    for (int s = 0; s < count; s++) {
+        int size = starts[s + 1] - starts[s];
+        if (size == 0) continue;
+        char name[256];
+        snprintf(name, sizeof(name), ".rela%s", assembly->sections[s].name);
+        int index = place(&layout, name, SHT_RELA, SHF_INFO_LINK, 0, (unsigned long)size * sizeof(Elf64_Rela),
+                          8, sizeof(Elf64_Rela), &relas[starts[s]]);
+        // The symbol table comes right after the relocation sections
+        layout.headers[index].sh_link = (unsigned)(count + rela_count + 1);
+        layout.headers[index].sh_info = section_index[s];
+    }
+    place_tables(&layout, &symbols);
+    if (layout.names.failed) {
+        ok = false;
+        goto done;
+    }
+
+    Elf64_Ehdr elf;
+    init_elf_header(&elf, ET_REL);
+    finish_elf_header(&elf, &layout);
+    Writer writer = {output, 0};
+    write_bytes(&writer, &elf, sizeof(elf));
+    write_layout(&writer, &layout);
+
+done:
+    if (!ok) snprintf(error, error_size, "out of memory");
+    free_layout(&layout);
+    free_symbols(&symbols);
+    free(section_index);
+    free(addresses);
+    free(starts);
+    free(relas);
+    return ok;
+}
+
+// Sections in the order the executable has them: code, read-only data,
+// data, then .bss, so that each segment is contiguous
+static int segment_rank(const AsmSection *section) {
+    if (section->flags & SHF_EXECINSTR) return 0;
+    if (!(section->flags & SHF_WRITE)) return 1;
+    return section->type == SHT_NOBITS ? 3 : 2;
+}
+
+bool object_write_executable(Assembly *assembly, Output *output, char *error, size_t error_size) {
+    int count = assembly->section_count;
+    int entry = assembly_find_symbol(assembly, "_start");
+    if (entry < 0 || assembly->symbols[entry].section < 0) {
+        snprintf(error, error_size, "no _start to enter the program at");
+        return false;
+    }
+    for (int s = 0; s < count; s++) {
+        if (!(assembly->sections[s].flags & SHF_ALLOC)) {
+            snprintf(error, error_size, "section %s is not loaded", assembly->sections[s].name);
+            return false;
+        }
+    }
+
+    unsigned *section_index = calloc((size_t)count + 1, sizeof(unsigned));
+    unsigned long *addresses = calloc((size_t)count + 1, sizeof(unsigned long));
+    int *order = calloc((size_t)count + 1, sizeof(int));
+    SymbolTable symbols = {0};
+    Layout layout = {0};
+    bool writable = false;
+    for (int s = 0; s < count; s++) {
+        writable |= segment_rank(&assembly->sections[s]) >= 2 && assembly->sections[s].size > 0;
+    }
+    int phnum = writable ? 3 : 2;
+    bool ok = section_index && addresses && order &&
+              start_layout(&layout, count + 4, sizeof(Elf64_Ehdr) + (unsigned long)phnum * sizeof(Elf64_Phdr));
+    if (!ok) {
+        snprintf(error, error_size, "out of memory");
+        goto done;
+    }
+
+    // Every section is loaded at the base address plus its file offset;
+    // the data segment starts on a page of its own
+    int placed = 0;
+    for (int rank = 0; rank < 4; rank++) {
+        for (int s = 0; s < count; s++) {
+            if (segment_rank(&assembly->sections[s]) == rank) order[placed++] = s;
+        }
+    }
+    unsigned long text_end = 0, data_start = 0, data_end = 0, memory_end = 0;
+    for (int i = 0; i < count; i++) {
+        int s = order[i];
+        const AsmSection *section = &assembly->sections[s];
+        int rank = segment_rank(section);
+        if (rank >= 2 && writable && data_start == 0) {
+            text_end = layout.end;
+            data_start = align_up(layout.end, OBJECT_PAGE_SIZE);
+            layout.end = data_start;
+            memory_end = data_start;
+        }
+        unsigned long offset = align_up(rank == 3 ? memory_end : layout.end, section->align);
+        int index = place(&layout, section->name, section->type, section->flags, offset, section->size,
+                          section->align, section->entsize, section->data);
+        section_index[s] = (unsigned)index;
+        addresses[s] = OBJECT_BASE_ADDRESS + offset;
+        layout.headers[index].sh_addr = addresses[s];
+        if (rank >= 2) {
+            memory_end = offset + section->size;
+            if (rank == 2) data_end = layout.end;
+        }
+    }
+    if (!writable) text_end = layout.end;
+    if (writable && data_end == 0) data_end = data_start;
+
+    if (!assembly_link(assembly, addresses, NULL, NULL, error, error_size)) {
+        ok = false;
+        goto done;
+    }
+    ok = build_symbols(assembly, true, section_index, addresses, &symbols);
+    if (ok) {
+        place_tables(&layout, &symbols);
+        ok = !layout.names.failed;
+    }
+    if (!ok) {
+        snprintf(error, error_size, "out of memory");
+        goto done;
+    }
+
+    Elf64_Ehdr elf;
+    init_elf_header(&elf, ET_EXEC);
+    finish_elf_header(&elf, &layout);
+    elf.e_entry = addresses[assembly->symbols[entry].section] + assembly->symbols[entry].value;
+    elf.e_phoff = sizeof(Elf64_Ehdr);
+    elf.e_phentsize = sizeof(Elf64_Phdr);
+    elf.e_phnum = (Elf64_Half)phnum;
+
+    Elf64_Phdr segments[3];
+    memset(segments, 0, sizeof(segments));
+    segments[0].p_type = PT_LOAD;
+    segments[0].p_flags = PF_R | PF_X;
+    segments[0].p_vaddr = segments[0].p_paddr = OBJECT_BASE_ADDRESS;
+    segments[0].p_filesz = segments[0].p_memsz = text_end;
+    segments[0].p_align = OBJECT_PAGE_SIZE;
+    segments[1].p_type = PT_GNU_STACK;
+    segments[1].p_flags = PF_R | PF_W;
+    segments[1].p_align = 16;
+    if (writable) {
+        segments[2].p_type = PT_LOAD;
+        segments[2].p_flags = PF_R | PF_W;
+        segments[2].p_offset = data_start;
+        segments[2].p_vaddr = segments[2].p_paddr = OBJECT_BASE_ADDRESS + data_start;
+        segments[2].p_filesz = data_end - data_start;
+        segments[2].p_memsz = memory_end - data_start;
+        segments[2].p_align = OBJECT_PAGE_SIZE;
+    }
+
+    Writer writer = {output, 0};
+    write_bytes(&writer, &elf, sizeof(elf));
+    write_bytes(&writer, segments, (size_t)phnum * sizeof(Elf64_Phdr));
+    write_layout(&writer, &layout);
+
+done:
+    free_layout(&layout);
+    free_symbols(&symbols);
+    free(section_index);
+    free(addresses);
+    free(order);
+    return ok;
+}
\ No newline at end of file
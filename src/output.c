@@ -0,0 +1,181 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <output.h>
+
+// Decimal digits of 0..99, two characters each
+static const char digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+Output *output_open(const char *path, int mode) {
+    Output *output = malloc(sizeof(Output));
+    if (!output) return NULL;
+
+    output->data = malloc(OUTPUT_BUFFER_SIZE);
+    output->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, mode);
+    if (!output->data || output->fd < 0) {
+        if (output->fd >= 0) close(output->fd);
+        free(output->data);
+        free(output);
+        return NULL;
+    }
+    output->length = 0;
+    output->failed = false;
+    return output;
+}
+
+bool output_close(Output *output) {
+    if (!output) return true;
+    output_flush(output);
+    bool ok = !output->failed;
+    if (close(output->fd) != 0) ok = false;
+    free(output->data);
+    free(output);
+    return ok;
+}
+
+// Write all of length bytes, retrying short and interrupted writes
+static void write_all(Output *output, const char *data, size_t length) {
+    while (length > 0 && !output->failed) {
+        ssize_t written = write(output->fd, data, length);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) {
+            output->failed = true;
+            break;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+}
+
+void output_flush(Output *output) {
+    write_all(output, output->data, output->length);
+    output->length = 0;
+}
+
+void output_write(Output *output, const char *text, size_t length) {
+    if (output->length + length > OUTPUT_BUFFER_SIZE) {
+        output_flush(output);
+        if (length > OUTPUT_BUFFER_SIZE) {
+            write_all(output, text, length);
+            return;
+        }
+    }
+    memcpy(output->data + output->length, text, length);
+    output->length += length;
+}
+
+char *output_text(char *out, char *end, const char *text) {
+    while (*text && out + 1 < end) *out++ = *text++;
+    *out = '\0';
+    return out;
+}
+
+char *output_char(char *out, char *end, char c) {
+    if (out + 1 < end) *out++ = c;
+    *out = '\0';
+    return out;
+}
+
+// Digits of value, filled in from the end of buffer; returns the first
+static char *format_unsigned(char *buffer_end, unsigned long value) {
+    char *p = buffer_end;
+    *p = '\0';
+    while (value >= 100) {
+        const char *pair = &digit_pairs[(value % 100) * 2];
+        value /= 100;
+        *--p = pair[1];
+        *--p = pair[0];
+    }
+    if (value >= 10) {
+        *--p = digit_pairs[value * 2 + 1];
+        *--p = digit_pairs[value * 2];
+    } else {
+        *--p = (char)('0' + value);
+    }
+    return p;
+}
+
+static char *output_unsigned(char *out, char *end, unsigned long value) {
+    char digits[24];
+    return output_text(out, end, format_unsigned(&digits[sizeof(digits) - 1], value));
+}
+
+char *output_long(char *out, char *end, long value) {
+    if (value < 0) {
+        out = output_char(out, end, '-');
+        return output_unsigned(out, end, -(unsigned long)value);
+    }
+    return output_unsigned(out, end, (unsigned long)value);
+}
+
+static char *output_hex(char *out, char *end, unsigned long value) {
+    char digits[24];
+    char *p = &digits[sizeof(digits) - 1];
+    *p = '\0';
+    do {
+        *--p = "0123456789abcdef"[value & 15];
+        value >>= 4;
+    } while (value);
+    return output_text(out, end, p);
+}
+
+char *output_label(char *out, char *end, int label) {
+    out = output_text(out, end, ".L");
+    return output_long(out, end, label);
+}
+
+// Widths, precisions and other conversions
+static char *format_fallback(char *start, char *end, const char *format, va_list args) {
+    vsnprintf(start, (size_t)(end - start), format, args);
+    return start + strlen(start);
+}
+
+char *output_vformat(char *out, char *end, const char *format, va_list args) {
+    char *start = out;
+    va_list saved;
+    va_copy(saved, args);
+    *out = '\0';
+    for (const char *c = format; *c; c++) {
+        if (*c != '%') {
+            out = output_char(out, end, *c);
+            continue;
+        }
+        bool is_long = c[1] == 'l';
+        char conversion = c[1 + is_long];
+        // Only the integer conversions take an l
+        if (is_long && conversion != 'd' && conversion != 'u' && conversion != 'x') conversion = '\0';
+        switch (conversion) {
+            case '%':
+                out = output_char(out, end, '%');
+                break;
+            case 's':
+                out = output_text(out, end, va_arg(args, const char *));
+                break;
+            case 'c':
+                out = output_char(out, end, (char)va_arg(args, int));
+                break;
+            case 'd':
+                out = output_long(out, end, is_long ? va_arg(args, long) : va_arg(args, int));
+                break;
+            case 'u':
+                out = output_unsigned(out, end, is_long ? va_arg(args, unsigned long) : va_arg(args, unsigned));
+                break;
+            case 'x':
+                out = output_hex(out, end, is_long ? va_arg(args, unsigned long) : va_arg(args, unsigned));
+                break;
+            default:
+                out = format_fallback(start, end, format, saved);
+                va_end(saved);
+                return out;
+        }
+        c += 1 + is_long;
+    }
+    va_end(saved);
+    return out;
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <limits.h>
 #include <parser.h>
 
 Parser *parser_create(Lexer *lexer) {
@@ -10,13 +12,32 @@ Parser *parser_create(Lexer *lexer) {
     parser->lexer = lexer;
     parser->current_token = lexer_next_token(lexer);
     parser->peek_token = lexer_next_token(lexer);
+    parser->break_depth = 0;
+    parser->symbols = NULL;
+    parser->symbol_count = 0;
+    parser->globals = NULL;
+    parser->global_count = 0;
     return parser;
 }
 
+static void clear_symbols(Parser *parser) {
+    for (int i = 0; i < parser->symbol_count; i++) {
+        free(parser->symbols[i].name);
+    }
+    free(parser->symbols);
+    parser->symbols = NULL;
+    parser->symbol_count = 0;
+}
+
 void parser_free(Parser *parser) {
     if (parser) {
         token_free(parser->current_token);
         token_free(parser->peek_token);
+        clear_symbols(parser);
+        for (int i = 0; i < parser->global_count; i++) {
+            free(parser->globals[i].name);
+        }
+        free(parser->globals);
         free(parser);
     }
 }
@@ -43,109 +64,380 @@ void parser_error(Parser *parser, const char *message) {
     exit(1);
 }
 
+static Symbol *find_symbol(Parser *parser, const char *name) {
+    for (int i = 0; i < parser->symbol_count; i++) {
+        if (strcmp(parser->symbols[i].name, name) == 0) return &parser->symbols[i];
+    }
+    return NULL;
+}
+
+static Symbol *find_global(Parser *parser, const char *name) {
+    for (int i = 0; i < parser->global_count; i++) {
+        if (strcmp(parser->globals[i].name, name) == 0) return &parser->globals[i];
+    }
+    return NULL;
+}
+
+// Variables share one scope per function, as they share its stack slots,
+// so a name may be declared again only with the same type
+static void declare_symbol(Parser *parser, const char *name, TypeKind type, int length) {
+    Symbol *symbol = find_symbol(parser, name);
+    if (symbol) {
+        if (symbol->type != type || symbol->length != length) {
+            parser_error(parser, "Conflicting types for variable");
+        }
+        return;
+    }
+
+    void *temp = realloc(parser->symbols, sizeof(Symbol) * (parser->symbol_count + 1));
+    if (!temp) return;
+    parser->symbols = temp;
+    parser->symbols[parser->symbol_count].name = strdup(name);
+    parser->symbols[parser->symbol_count].type = type;
+    parser->symbols[parser->symbol_count].length = length;
+    parser->symbol_count++;
+}
+
+// A use of a declared variable, typed by its declaration: a local of the
+// function, or else a global declared before it
+static ASTNode *create_variable(Parser *parser, const char *name) {
+    Symbol *symbol = find_symbol(parser, name);
+    bool is_global = !symbol;
+    if (is_global) symbol = find_global(parser, name);
+    if (!symbol) {
+        parser_error(parser, "Undeclared variable");
+        return NULL;
+    }
+
+    ASTNode *var = ast_create_variable(name);
+    if (var) {
+        var->value_type = symbol->type;
+        var->data.variable.is_global = is_global;
+        var->data.variable.length = symbol->length;
+    }
+    return var;
+}
+
+// [N] after the name in a declaration: the length of an array, a positive
+// integer literal. Returns 0 when the variable is not an array.
+static int parse_array_length(Parser *parser, TypeKind type) {
+    if (parser->current_token->type != TOKEN_LBRACKET) return 0;
+    parser_advance(parser);
+
+    if (parser->current_token->type != TOKEN_NUMBER) {
+        parser_error(parser, "Expected array length");
+        return 0;
+    }
+    errno = 0;
+    unsigned long length = strtoul(parser->current_token->value, NULL, 10);
+    if (length == 0) parser_error(parser, "Array length must be positive");
+    if (errno == ERANGE || length > (unsigned long)INT_MAX / type_size(type) / 2) {
+        parser_error(parser, "Array is too large");
+    }
+    parser_advance(parser);
+
+    if (!parser_expect(parser, TOKEN_RBRACKET)) {
+        parser_error(parser, "Expected ']' after array length");
+        return 0;
+    }
+    return (int)length;
+}
+
+// A variable read or assigned at the identifier: an element array[index]
+// of an array, which can be used no other way, or a scalar
+static ASTNode *parse_variable_use(Parser *parser) {
+    ASTNode *var = create_variable(parser, parser->current_token->value);
+    if (!var) return NULL;
+    parser_advance(parser);
+
+    if (parser->current_token->type != TOKEN_LBRACKET) {
+        if (var->data.variable.length) {
+            ast_free(var);
+            parser_error(parser, "Array used as a value");
+            return NULL;
+        }
+        return var;
+    }
+    if (!var->data.variable.length) {
+        ast_free(var);
+        parser_error(parser, "Subscripted value is not an array");
+        return NULL;
+    }
+    parser_advance(parser);
+
+    ASTNode *index = parser_parse_expression(parser);
+    if (!index) {
+        ast_free(var);
+        return NULL;
+    }
+    if (!parser_expect(parser, TOKEN_RBRACKET)) {
+        ast_free(var);
+        ast_free(index);
+        parser_error(parser, "Expected ']' after array index");
+        return NULL;
+    }
+
+    ASTNode *element = ast_create_index(var, index);
+    if (!element) {
+        ast_free(var);
+        ast_free(index);
+    }
+    return element;
+}
+
+bool parser_at_type(Parser *parser) {
+    switch (parser->current_token->type) {
+        case TOKEN_CHAR_TYPE:
+        case TOKEN_SHORT:
+        case TOKEN_INT:
+        case TOKEN_LONG:
+        case TOKEN_SIGNED:
+        case TOKEN_UNSIGNED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+TypeKind parser_parse_type(Parser *parser) {
+    bool is_unsigned = false;
+    bool has_sign = false;
+    if (parser->current_token->type == TOKEN_SIGNED || parser->current_token->type == TOKEN_UNSIGNED) {
+        is_unsigned = parser->current_token->type == TOKEN_UNSIGNED;
+        has_sign = true;
+        parser_advance(parser);
+    }
+
+    TypeKind type = TYPE_INT;
+    switch (parser->current_token->type) {
+        case TOKEN_CHAR_TYPE:
+            parser_advance(parser);
+            return is_unsigned ? TYPE_UCHAR : TYPE_CHAR;
+        case TOKEN_SHORT:
+            parser_advance(parser);
+            type = TYPE_SHORT;
+            break;
+        case TOKEN_LONG:
+            parser_advance(parser);
+            parser_expect(parser, TOKEN_LONG);   // long long is the same 64 bits
+            type = TYPE_LONG;
+            break;
+        case TOKEN_INT:
+            parser_advance(parser);
+            return is_unsigned ? TYPE_UINT : TYPE_INT;
+        default:
+            // "signed" and "unsigned" alone mean int
+            if (!has_sign) parser_error(parser, "Expected type name");
+            return is_unsigned ? TYPE_UINT : TYPE_INT;
+    }
+
+    // short int, long int
+    parser_expect(parser, TOKEN_INT);
+    if (!is_unsigned) return type;
+    return type == TYPE_SHORT ? TYPE_USHORT : TYPE_ULONG;
+}
+
+// Integer literal with an optional u and l suffix, typed as in C: the
+// first of int, long (or unsigned int, unsigned long with u) that holds
+// the value
+static ASTNode *parse_number(Parser *parser) {
+    const char *text = parser->current_token->value;
+    char *suffix;
+    errno = 0;
+    unsigned long value = strtoul(text, &suffix, 10);
+    if (errno == ERANGE) parser_error(parser, "Integer constant is too large");
+
+    bool is_unsigned = strchr(suffix, 'u') || strchr(suffix, 'U');
+    bool is_long = strchr(suffix, 'l') || strchr(suffix, 'L');
+    TypeKind type;
+    if (!is_long && !is_unsigned && value <= INT_MAX) {
+        type = TYPE_INT;
+    } else if (!is_long && is_unsigned && value <= UINT_MAX) {
+        type = TYPE_UINT;
+    } else if (!is_unsigned && value <= LONG_MAX) {
+        type = TYPE_LONG;
+    } else {
+        type = TYPE_ULONG;
+    }
+    parser_advance(parser);
+
+    ASTNode *number = ast_create_number((long)value);
+    if (number) number->value_type = type;
+    return number;
+}
+
 // Grammar rules implementation
 ASTNode *parser_parse_program(Parser *parser) {
     ASTNode *program = ast_create_program();
     if (!program) return NULL;
 
-    // Add functions to program
+    // Add functions and globals to program
     while (parser->current_token->type != TOKEN_EOF) {
-        ASTNode *function = parser_parse_function(parser);
-        if (!function) {
+        ASTNode *node = parser_parse_external_declaration(parser);
+        if (!node) {
             ast_free(program);
             return NULL;
         }
 
-        // Reallocate function array
-        void *temp = realloc(program->data.program.functions,
-                           sizeof(ASTNode*) * (program->data.program.function_count + 1));
+        bool is_global = node->type == NODE_GLOBAL;
+        ASTNode ***items = is_global ? &program->data.program.globals : &program->data.program.functions;
+        int *count = is_global ? &program->data.program.global_count : &program->data.program.function_count;
+        void *temp = realloc(*items, sizeof(ASTNode*) * (*count + 1));
         if (!temp) {
-            ast_free(function);
+            ast_free(node);
             ast_free(program);
             return NULL;
         }
 
-        program->data.program.functions = temp;
-        program->data.program.functions[program->data.program.function_count++] = function;
+        *items = temp;
+        (*items)[(*count)++] = node;
     }
 
     return program;
 }
 
-ASTNode *parser_parse_function(Parser *parser) {
-    // Parse return type (for now, only 'int' or 'void')
-    if (!parser_expect(parser, TOKEN_INT) && !parser_expect(parser, TOKEN_VOID)) {
+// Type and name come first in both a function definition and a global
+ASTNode *parser_parse_external_declaration(Parser *parser) {
+    TypeKind type = TYPE_VOID;
+    if (parser_at_type(parser)) {
+        type = parser_parse_type(parser);
+    } else if (!parser_expect(parser, TOKEN_VOID)) {
         parser_error(parser, "Expected function return type");
         return NULL;
     }
+    clear_symbols(parser);
 
-    // Parse function name
     if (parser->current_token->type != TOKEN_IDENTIFIER) {
-        parser_error(parser, "Expected function name");
+        parser_error(parser, "Expected function or variable name");
         return NULL;
     }
     char *name = strdup(parser->current_token->value);
+    if (!name) return NULL;
     parser_advance(parser);
 
+    ASTNode *node = parser->current_token->type == TOKEN_LPAREN
+                  ? parser_parse_function(parser, type, name)
+                  : parser_parse_global(parser, type, name);
+    free(name);
+    return node;
+}
+
+// type name [= initializer]; or type name[N]; the checker requires a
+// constant initializer
+ASTNode *parser_parse_global(Parser *parser, TypeKind type, const char *name) {
+    if (type == TYPE_VOID) {
+        parser_error(parser, "Variable declared void");
+        return NULL;
+    }
+    if (find_global(parser, name)) {
+        parser_error(parser, "Redefinition of global variable");
+        return NULL;
+    }
+    int length = parse_array_length(parser, type);
+
+    ASTNode *init = NULL;
+    if (parser->current_token->type == TOKEN_ASSIGN) {
+        if (length) {
+            parser_error(parser, "Array initializers are not supported");
+            return NULL;
+        }
+        parser_advance(parser);
+        init = parser_parse_expression(parser);
+        if (!init) return NULL;
+    }
+    if (!parser_expect(parser, TOKEN_SEMICOLON)) {
+        ast_free(init);
+        parser_error(parser, "Expected ';' after global variable");
+        return NULL;
+    }
+
+    void *temp = realloc(parser->globals, sizeof(Symbol) * (parser->global_count + 1));
+    if (!temp) {
+        ast_free(init);
+        return NULL;
+    }
+    parser->globals = temp;
+    parser->globals[parser->global_count].name = strdup(name);
+    parser->globals[parser->global_count].type = type;
+    parser->globals[parser->global_count].length = length;
+    parser->global_count++;
+
+    ASTNode *global = ast_create_global(name, type, init);
+    if (global) {
+        global->data.global.length = length;
+    } else {
+        ast_free(init);
+    }
+    return global;
+}
+
+ASTNode *parser_parse_function(Parser *parser, TypeKind return_type, const char *name) {
     // Parse parameters
     if (!parser_expect(parser, TOKEN_LPAREN)) {
-        free(name);
         parser_error(parser, "Expected '(' after function name");
         return NULL;
     }
 
     char **params = NULL;
+    TypeKind *param_types = NULL;
     int param_count = 0;
 
     // Parse parameter list
     while (parser->current_token->type != TOKEN_RPAREN) {
         if (param_count > 0) {
             if (!parser_expect(parser, TOKEN_COMMA)) {
-                free(name);
                 // Free previously allocated parameters
                 for (int i = 0; i < param_count; i++) {
                     free(params[i]);
                 }
                 free(params);
+                free(param_types);
                 parser_error(parser, "Expected ',' between parameters");
                 return NULL;
             }
         }
 
         // Parse parameter type
-        if (!parser_expect(parser, TOKEN_INT)) {
-            free(name);
+        if (!parser_at_type(parser)) {
             for (int i = 0; i < param_count; i++) {
                 free(params[i]);
             }
             free(params);
+            free(param_types);
             parser_error(parser, "Expected parameter type");
             return NULL;
         }
+        TypeKind type = parser_parse_type(parser);
 
         // Parse parameter name
         if (parser->current_token->type != TOKEN_IDENTIFIER) {
-            free(name);
             for (int i = 0; i < param_count; i++) {
                 free(params[i]);
             }
             free(params);
+            free(param_types);
             parser_error(parser, "Expected parameter name");
             return NULL;
         }
 
         // Add parameter to list
+        // A successful realloc frees the old params, so take the new
+        // pointer before the second realloc can fail
         void *temp = realloc(params, sizeof(char*) * (param_count + 1));
-        if (!temp) {
-            free(name);
+        if (temp) params = temp;
+        void *temp_types = temp ? realloc(param_types, sizeof(TypeKind) * (param_count + 1)) : NULL;
+        if (!temp || !temp_types) {
             for (int i = 0; i < param_count; i++) {
                 free(params[i]);
             }
             free(params);
+            free(param_types);
             return NULL;
         }
-        params = temp;
+        param_types = temp_types;
         params[param_count] = strdup(parser->current_token->value);
+        param_types[param_count] = type;
+        declare_symbol(parser, params[param_count], type, 0);
         param_count++;
         parser_advance(parser);
     }
@@ -155,15 +447,22 @@ ASTNode *parser_parse_function(Parser *parser) {
     // Parse function body
     ASTNode *body = parser_parse_block(parser);
     if (!body) {
-        free(name);
         for (int i = 0; i < param_count; i++) {
             free(params[i]);
         }
         free(params);
+        free(param_types);
         return NULL;
     }
 
-    return ast_create_function(name, params, param_count, body);
+    ASTNode *function = ast_create_function(name, params, param_types, param_count, body);
+    if (function) function->data.function.return_type = return_type;
+    for (int i = 0; i < param_count; i++) {
+        free(params[i]);
+    }
+    free(params);
+    free(param_types);
+    return function;
 }
 
 ASTNode *parser_parse_block(Parser *parser) {
@@ -207,9 +506,23 @@ ASTNode *parser_parse_statement(Parser *parser) {
             return parser_parse_if_statement(parser);
         case TOKEN_WHILE:
             return parser_parse_while_statement(parser);
+        case TOKEN_FOR:
+            return parser_parse_for_statement(parser);
+        case TOKEN_SWITCH:
+            return parser_parse_switch_statement(parser);
+        case TOKEN_BREAK:
+            return parser_parse_break_statement(parser);
+        case TOKEN_CHAR_TYPE:
+        case TOKEN_SHORT:
         case TOKEN_INT:
+        case TOKEN_LONG:
+        case TOKEN_SIGNED:
+        case TOKEN_UNSIGNED:
             return parser_parse_variable_declaration(parser);
         case TOKEN_IDENTIFIER:
+            if (parser->peek_token->type == TOKEN_LPAREN) {
+                return parser_parse_call_statement(parser);
+            }
             return parser_parse_assignment(parser);
         default:
             parser_error(parser, "Expected statement");
@@ -218,6 +531,61 @@ ASTNode *parser_parse_statement(Parser *parser) {
 }
 
 ASTNode *parser_parse_expression(Parser *parser) {
+    return parser_parse_logical_or(parser);
+}
+
+// a || b || c groups to the left; '||' binds looser than '&&'
+ASTNode *parser_parse_logical_or(Parser *parser) {
+    ASTNode *left = parser_parse_logical_and(parser);
+    if (!left) return NULL;
+
+    while (parser->current_token->type == TOKEN_OR) {
+        parser_advance(parser);
+
+        ASTNode *right = parser_parse_logical_and(parser);
+        if (!right) {
+            ast_free(left);
+            return NULL;
+        }
+
+        ASTNode *new_node = ast_create_binary_op('O', left, right);
+        if (!new_node) {
+            ast_free(left);
+            ast_free(right);
+            return NULL;
+        }
+        left = new_node;
+    }
+
+    return left;
+}
+
+ASTNode *parser_parse_logical_and(Parser *parser) {
+    ASTNode *left = parser_parse_comparison(parser);
+    if (!left) return NULL;
+
+    while (parser->current_token->type == TOKEN_AND) {
+        parser_advance(parser);
+
+        ASTNode *right = parser_parse_comparison(parser);
+        if (!right) {
+            ast_free(left);
+            return NULL;
+        }
+
+        ASTNode *new_node = ast_create_binary_op('A', left, right);
+        if (!new_node) {
+            ast_free(left);
+            ast_free(right);
+            return NULL;
+        }
+        left = new_node;
+    }
+
+    return left;
+}
+
+ASTNode *parser_parse_comparison(Parser *parser) {
     ASTNode *left = parser_parse_arithmetic(parser);
     if (!left) return NULL;
 
@@ -317,18 +685,42 @@ ASTNode *parser_parse_term(Parser *parser) {
 
 ASTNode *parser_parse_factor(Parser *parser) {
     switch (parser->current_token->type) {
-        case TOKEN_NUMBER: {
-            int value = atoi(parser->current_token->value);
+        case TOKEN_NUMBER:
+            return parse_number(parser);
+        case TOKEN_STRING: {
+            // The value of a string is the address of its first byte
+            ASTNode *string = ast_create_string(parser->current_token->value);
+            if (string) string->value_type = TYPE_ULONG;
             parser_advance(parser);
-            return ast_create_number(value);
+            return string;
         }
-        case TOKEN_IDENTIFIER: {
-            char *name = strdup(parser->current_token->value);
+        case TOKEN_CHAR: {
+            ASTNode *literal = ast_create_char((char)atoi(parser->current_token->value));
             parser_advance(parser);
-            return ast_create_variable(name);
+            return literal;
+        }
+        case TOKEN_IDENTIFIER: {
+            if (parser->peek_token->type == TOKEN_LPAREN) {
+                return parser_parse_call(parser);
+            }
+            return parse_variable_use(parser);
         }
         case TOKEN_LPAREN: {
             parser_advance(parser);
+            if (parser_at_type(parser)) {
+                // Cast: (type) factor
+                TypeKind type = parser_parse_type(parser);
+                if (!parser_expect(parser, TOKEN_RPAREN)) {
+                    parser_error(parser, "Expected ')' after type name");
+                    return NULL;
+                }
+                ASTNode *factor = parser_parse_factor(parser);
+                if (!factor) return NULL;
+
+                ASTNode *cast = ast_create_cast(type, factor);
+                if (!cast) ast_free(factor);
+                return cast;
+            }
             ASTNode *expr = parser_parse_expression(parser);
             if (!expr) return NULL;
             
@@ -339,6 +731,15 @@ ASTNode *parser_parse_factor(Parser *parser) {
             }
             return expr;
         }
+        case TOKEN_NOT: {
+            parser_advance(parser);
+            ASTNode *factor = parser_parse_factor(parser);
+            if (!factor) return NULL;
+
+            ASTNode *node = ast_create_unary_op('!', factor);
+            if (!node) ast_free(factor);
+            return node;
+        }
         case TOKEN_MINUS: {
             parser_advance(parser);
             ASTNode *factor = parser_parse_factor(parser);
@@ -359,6 +760,67 @@ ASTNode *parser_parse_factor(Parser *parser) {
     }
 }
 
+ASTNode *parser_parse_call(Parser *parser) {
+    char *name = strdup(parser->current_token->value);
+    if (!name) return NULL;
+    parser_advance(parser);
+
+    if (!parser_expect(parser, TOKEN_LPAREN)) {
+        free(name);
+        parser_error(parser, "Expected '(' after function name");
+        return NULL;
+    }
+
+    ASTNode **args = NULL;
+    int arg_count = 0;
+
+    while (parser->current_token->type != TOKEN_RPAREN) {
+        if (arg_count > 0 && !parser_expect(parser, TOKEN_COMMA)) {
+            free(name);
+            for (int i = 0; i < arg_count; i++) {
+                ast_free(args[i]);
+            }
+            free(args);
+            parser_error(parser, "Expected ',' between arguments");
+            return NULL;
+        }
+
+        ASTNode *arg = parser_parse_expression(parser);
+        void *temp = arg ? realloc(args, sizeof(ASTNode*) * (arg_count + 1)) : NULL;
+        if (!temp) {
+            free(name);
+            ast_free(arg);
+            for (int i = 0; i < arg_count; i++) {
+                ast_free(args[i]);
+            }
+            free(args);
+            return NULL;
+        }
+        args = temp;
+        args[arg_count++] = arg;
+    }
+
+    parser_expect(parser, TOKEN_RPAREN);
+
+    ASTNode *call = ast_create_call(name, args, arg_count);
+    free(name);
+    free(args);
+    return call;
+}
+
+ASTNode *parser_parse_call_statement(Parser *parser) {
+    ASTNode *call = parser_parse_call(parser);
+    if (!call) return NULL;
+
+    if (!parser_expect(parser, TOKEN_SEMICOLON)) {
+        ast_free(call);
+        parser_error(parser, "Expected ';' after function call");
+        return NULL;
+    }
+
+    return call;
+}
+
 ASTNode *parser_parse_return_statement(Parser *parser) {
     if (!parser_expect(parser, TOKEN_RETURN)) {
         parser_error(parser, "Expected 'return'");
@@ -378,8 +840,7 @@ ASTNode *parser_parse_return_statement(Parser *parser) {
 }
 
 ASTNode *parser_parse_variable_declaration(Parser *parser) {
-    // Skip 'int' keyword
-    parser_advance(parser);
+    TypeKind type = parser_parse_type(parser);
 
     // Get variable name
     if (parser->current_token->type != TOKEN_IDENTIFIER) {
@@ -389,10 +850,13 @@ ASTNode *parser_parse_variable_declaration(Parser *parser) {
     
     char *name = strdup(parser->current_token->value);
     parser_advance(parser);
+    int length = parse_array_length(parser, type);
+    declare_symbol(parser, name, type, length);
 
     // Handle initialization if present
     ASTNode *init_expr = NULL;
     if (parser->current_token->type == TOKEN_ASSIGN) {
+        if (length) parser_error(parser, "Array initializers are not supported");
         parser_advance(parser);
         init_expr = parser_parse_expression(parser);
         if (!init_expr) {
@@ -409,7 +873,7 @@ ASTNode *parser_parse_variable_declaration(Parser *parser) {
     }
 
     // Create variable declaration node
-    ASTNode *var_node = ast_create_variable(name);
+    ASTNode *var_node = create_variable(parser, name);
     free(name);
     
     if (!var_node) {
@@ -485,7 +949,9 @@ ASTNode *parser_parse_while_statement(Parser *parser) {
         return NULL;
     }
 
+    parser->break_depth++;
     ASTNode *body = parser_parse_block(parser);
+    parser->break_depth--;
     if (!body) {
         ast_free(condition);
         return NULL;
@@ -495,21 +961,102 @@ ASTNode *parser_parse_while_statement(Parser *parser) {
     return ast_create_while(condition, body);
 }
 
+ASTNode *parser_parse_for_statement(Parser *parser) {
+    if (!parser_expect(parser, TOKEN_FOR)) {
+        parser_error(parser, "Expected 'for'");
+        return NULL;
+    }
+
+    if (!parser_expect(parser, TOKEN_LPAREN)) {
+        parser_error(parser, "Expected '(' after 'for'");
+        return NULL;
+    }
+
+    // Initializer: declaration, assignment or nothing (each consumes the ';')
+    ASTNode *init = NULL;
+    if (parser_at_type(parser)) {
+        init = parser_parse_variable_declaration(parser);
+        if (!init) return NULL;
+    } else if (parser->current_token->type == TOKEN_IDENTIFIER) {
+        init = parser_parse_assignment(parser);
+        if (!init) return NULL;
+    } else if (!parser_expect(parser, TOKEN_SEMICOLON)) {
+        parser_error(parser, "Expected ';' after for initializer");
+        return NULL;
+    }
+
+    ASTNode *condition = NULL;
+    if (parser->current_token->type != TOKEN_SEMICOLON) {
+        condition = parser_parse_expression(parser);
+        if (!condition) {
+            ast_free(init);
+            return NULL;
+        }
+    }
+
+    if (!parser_expect(parser, TOKEN_SEMICOLON)) {
+        ast_free(init);
+        ast_free(condition);
+        parser_error(parser, "Expected ';' after for condition");
+        return NULL;
+    }
+
+    ASTNode *step = NULL;
+    if (parser->current_token->type != TOKEN_RPAREN) {
+        step = parser_parse_assignment_expression(parser);
+        if (!step) {
+            ast_free(init);
+            ast_free(condition);
+            return NULL;
+        }
+    }
+
+    if (!parser_expect(parser, TOKEN_RPAREN)) {
+        ast_free(init);
+        ast_free(condition);
+        ast_free(step);
+        parser_error(parser, "Expected ')' after for clauses");
+        return NULL;
+    }
+
+    parser->break_depth++;
+    ASTNode *body = parser_parse_block(parser);
+    parser->break_depth--;
+    if (!body) {
+        ast_free(init);
+        ast_free(condition);
+        ast_free(step);
+        return NULL;
+    }
+
+    return ast_create_for(init, condition, step, body);
+}
+
 ASTNode *parser_parse_assignment(Parser *parser) {
+    ASTNode *assignment = parser_parse_assignment_expression(parser);
+    if (!assignment) return NULL;
+
+    if (!parser_expect(parser, TOKEN_SEMICOLON)) {
+        ast_free(assignment);
+        parser_error(parser, "Expected ';' after assignment");
+        return NULL;
+    }
+
+    return assignment;
+}
+
+ASTNode *parser_parse_assignment_expression(Parser *parser) {
     if (parser->current_token->type != TOKEN_IDENTIFIER) {
         parser_error(parser, "Expected identifier");
         return NULL;
     }
 
-    // Save the variable name
-    char *name = strdup(parser->current_token->value);
-    if (!name) return NULL;
-
-    parser_advance(parser);
+    ASTNode *var = parse_variable_use(parser);
+    if (!var) return NULL;
 
     // Check for assignment operator
     if (!parser_expect(parser, TOKEN_ASSIGN)) {
-        free(name);
+        ast_free(var);
         parser_error(parser, "Expected '=' after identifier");
         return NULL;
     }
@@ -517,25 +1064,132 @@ ASTNode *parser_parse_assignment(Parser *parser) {
     // Parse the expression being assigned
     ASTNode *expr = parser_parse_expression(parser);
     if (!expr) {
-        free(name);
+        ast_free(var);
         return NULL;
     }
 
-    if (!parser_expect(parser, TOKEN_SEMICOLON)) {
-        free(name);
-        ast_free(expr);
-        parser_error(parser, "Expected ';' after assignment");
+    // Create assignment node (using binary op node with '=' operator)
+    return ast_create_binary_op('=', var, expr);
+}
+
+// "case N:" or "default:", checked against the labels already in body
+static ASTNode *parse_case_label(Parser *parser, ASTNode *body) {
+    bool is_default = parser->current_token->type == TOKEN_DEFAULT;
+    long value = 0;
+    parser_advance(parser);
+
+    if (!is_default) {
+        bool negative = parser_expect(parser, TOKEN_MINUS);
+        if (parser->current_token->type != TOKEN_NUMBER) {
+            parser_error(parser, "Expected constant after 'case'");
+            return NULL;
+        }
+        ASTNode *number = parse_number(parser);
+        if (!number) return NULL;
+        value = negative ? -number->data.number.value : number->data.number.value;
+        ast_free(number);
+    }
+
+    if (!parser_expect(parser, TOKEN_COLON)) {
+        parser_error(parser, "Expected ':' after case label");
         return NULL;
     }
 
-    // Create variable node
-    ASTNode *var = ast_create_variable(name);
-    free(name);
-    if (!var) {
-        ast_free(expr);
+    for (int i = 0; i < body->data.block.statement_count; i++) {
+        ASTNode *other = body->data.block.statements[i];
+        if (other->type != NODE_CASE || other->data.case_label.is_default != is_default) continue;
+        if (is_default) {
+            parser_error(parser, "Multiple default labels in one switch");
+            return NULL;
+        }
+        if (other->data.case_label.value == value) {
+            parser_error(parser, "Duplicate case value");
+            return NULL;
+        }
+    }
+    return ast_create_case(value, is_default);
+}
+
+ASTNode *parser_parse_switch_statement(Parser *parser) {
+    if (!parser_expect(parser, TOKEN_SWITCH)) {
+        parser_error(parser, "Expected 'switch'");
         return NULL;
     }
 
-    // Create assignment node (using binary op node with '=' operator)
-    return ast_create_binary_op('=', var, expr);
+    if (!parser_expect(parser, TOKEN_LPAREN)) {
+        parser_error(parser, "Expected '(' after 'switch'");
+        return NULL;
+    }
+
+    ASTNode *value = parser_parse_expression(parser);
+    if (!value) return NULL;
+
+    if (!parser_expect(parser, TOKEN_RPAREN)) {
+        ast_free(value);
+        parser_error(parser, "Expected ')' after switch value");
+        return NULL;
+    }
+
+    if (!parser_expect(parser, TOKEN_LBRACE)) {
+        ast_free(value);
+        parser_error(parser, "Expected '{' at start of switch body");
+        return NULL;
+    }
+
+    ASTNode *body = ast_create_block();
+    if (!body) {
+        ast_free(value);
+        return NULL;
+    }
+
+    // Case labels are statements of the body; everything else is parsed
+    // as in an ordinary block
+    parser->break_depth++;
+    while (parser->current_token->type != TOKEN_RBRACE) {
+        ASTNode *statement;
+        if (parser->current_token->type == TOKEN_CASE ||
+            parser->current_token->type == TOKEN_DEFAULT) {
+            statement = parse_case_label(parser, body);
+        } else {
+            statement = parser_parse_statement(parser);
+        }
+        if (!statement) {
+            ast_free(value);
+            ast_free(body);
+            return NULL;
+        }
+
+        void *temp = realloc(body->data.block.statements,
+                             sizeof(ASTNode*) * (body->data.block.statement_count + 1));
+        if (!temp) {
+            ast_free(statement);
+            ast_free(value);
+            ast_free(body);
+            return NULL;
+        }
+        body->data.block.statements = temp;
+        body->data.block.statements[body->data.block.statement_count++] = statement;
+    }
+    parser->break_depth--;
+
+    parser_expect(parser, TOKEN_RBRACE);
+    return ast_create_switch(value, body);
+}
+
+ASTNode *parser_parse_break_statement(Parser *parser) {
+    if (!parser_expect(parser, TOKEN_BREAK)) {
+        parser_error(parser, "Expected 'break'");
+        return NULL;
+    }
+
+    if (parser->break_depth == 0) {
+        parser_error(parser, "'break' outside of a loop or switch");
+        return NULL;
+    }
+
+    if (!parser_expect(parser, TOKEN_SEMICOLON)) {
+        parser_error(parser, "Expected ';' after 'break'");
+        return NULL;
+    }
+    return ast_create_break();
 }
\ No newline at end of file
@@ -0,0 +1,725 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <passes.h>
+#include <callgraph.h>
+#include <consteval.h>
+#include <frame.h>
+#include <gvn.h>
+#include <ifconv.h>
+#include <inliner.h>
+#include <ipcp.h>
+#include <layout.h>
+#include <loopopt.h>
+#include <peephole.h>
+#include <unroll.h>
+#include <vectorize.h>
+
+// Allocation counting. The Makefile links with --wrap for these functions,
+// so every allocation made by the compiler's own code goes through here.
+static long allocation_count = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+char *__real_strdup(const char *s);
+char *__real_strndup(const char *s, size_t n);
+
+void *__wrap_malloc(size_t size) {
+    allocation_count++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    allocation_count++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    allocation_count++;
+    return __real_realloc(ptr, size);
+}
+
+char *__wrap_strdup(const char *s) {
+    allocation_count++;
+    return __real_strdup(s);
+}
+
+char *__wrap_strndup(const char *s, size_t n) {
+    allocation_count++;
+    return __real_strndup(s, n);
+}
+
+long pass_allocation_count(void) {
+    return allocation_count;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Built-in analyses
+
+typedef struct {
+    int loop_count;
+    int max_depth;
+} LoopInfo;
+
+static void *analyze_function_size(PassManager *pm, ASTNode *function) {
+    (void)pm;
+    int *size = malloc(sizeof(int));
+    if (size) *size = inliner_node_count(function->data.function.body);
+    return size;
+}
+
+// Statements, and the expressions that can hold inlined bodies
+static void count_loops(ASTNode *node, int depth, LoopInfo *info) {
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                count_loops(node->data.block.statements[i], depth, info);
+            }
+            break;
+        case NODE_RETURN:
+            count_loops(node->data.return_stmt.expression, depth, info);
+            break;
+        case NODE_BINARY_OP:
+            count_loops(node->data.binary_op.left, depth, info);
+            count_loops(node->data.binary_op.right, depth, info);
+            break;
+        case NODE_UNARY_OP:
+            count_loops(node->data.unary_op.operand, depth, info);
+            break;
+        case NODE_INDEX:
+            count_loops(node->data.index.index, depth, info);
+            break;
+        case NODE_VECTOR:
+            count_loops(node->data.vector.loop, depth, info);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                count_loops(node->data.call.args[i], depth, info);
+            }
+            break;
+        case NODE_INLINE:
+            count_loops(node->data.inline_call.body, depth, info);
+            break;
+        case NODE_IF:
+            count_loops(node->data.if_stmt.condition, depth, info);
+            count_loops(node->data.if_stmt.then_branch, depth, info);
+            count_loops(node->data.if_stmt.else_branch, depth, info);
+            break;
+        case NODE_WHILE:
+        case NODE_FOR: {
+            info->loop_count++;
+            if (depth + 1 > info->max_depth) info->max_depth = depth + 1;
+            ASTNode *body = node->type == NODE_WHILE ? node->data.while_stmt.body
+                                                     : node->data.for_stmt.body;
+            count_loops(body, depth + 1, info);
+            break;
+        }
+        case NODE_SWITCH:
+            count_loops(node->data.switch_stmt.body, depth, info);
+            break;
+        default:
+            break;
+    }
+}
+
+static void *analyze_loop_info(PassManager *pm, ASTNode *function) {
+    (void)pm;
+    LoopInfo *info = calloc(1, sizeof(LoopInfo));
+    if (info) count_loops(function->data.function.body, 0, info);
+    return info;
+}
+
+// Built-in transforms
+
+static int inline_threshold(PassManager *pm) {
+    if (pm->options.inline_threshold_set) return pm->options.inline_threshold;
+    return pm->options.level == OPT_LEVEL_SIZE ? 0 : INLINER_DEFAULT_THRESHOLD;
+}
+
+static bool run_inline(PassManager *pm, ASTNode *program) {
+    int count = program->data.program.function_count;
+    int *sizes = calloc(count + 1, sizeof(int));
+    if (!sizes) return false;
+
+    for (int i = 0; i < count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        if (function->type != NODE_FUNCTION) continue;
+        int *size = pass_manager_get_analysis(pm, "function-size", function);
+        if (size) sizes[i] = *size;
+    }
+
+    const Profile *profile = pm->options.profile_use ? pm->profile : NULL;
+    int inlined = inliner_run(program, inline_threshold(pm), sizes, profile);
+    free(sizes);
+    return inlined > 0;
+}
+
+// Runs first, so that ipcp and the inliner see the values instead of the calls
+static bool run_consteval(PassManager *pm, ASTNode *program) {
+    (void)pm;
+    return consteval_run(program) > 0;
+}
+
+// Cloning grows the code, so -Os only propagates constants all callers agree on
+static bool run_ipcp(PassManager *pm, ASTNode *program) {
+    int growth = pm->options.level == OPT_LEVEL_SIZE ? 0 : IPCP_GROWTH_PERCENT;
+    const Profile *profile = pm->options.profile_use ? pm->profile : NULL;
+    return ipcp_run(program, growth, profile) > 0;
+}
+
+static CallGraph *build_callgraph(PassManager *pm, ASTNode *program) {
+    const Profile *profile = pm->options.profile_use ? pm->profile : NULL;
+    return callgraph_build(program, pm->options.exports, pm->options.export_count, profile);
+}
+
+// Runs after inlining and cloning, which leave many functions uncalled
+static bool run_dfe(PassManager *pm, ASTNode *program) {
+    CallGraph *graph = build_callgraph(pm, program);
+    if (!graph) return false;
+    int removed = callgraph_remove_unreachable(graph);
+    callgraph_free(graph);
+    return removed > 0;
+}
+
+static bool run_function_order(PassManager *pm, ASTNode *program) {
+    int count = program->data.program.function_count;
+    int *sizes = calloc(count + 1, sizeof(int));
+    CallGraph *graph = build_callgraph(pm, program);
+    bool changed = false;
+
+    if (sizes && graph) {
+        for (int i = 0; i < count; i++) {
+            ASTNode *function = program->data.program.functions[i];
+            if (function->type != NODE_FUNCTION) continue;
+            int *size = pass_manager_get_analysis(pm, "function-size", function);
+            if (size) sizes[i] = *size;
+        }
+        changed = callgraph_order(graph, sizes);
+    }
+    callgraph_free(graph);
+    free(sizes);
+    return changed;
+}
+
+static bool run_licm(PassManager *pm, ASTNode *function) {
+    LoopInfo *info = pass_manager_get_analysis(pm, "loop-info", function);
+    if (info && info->loop_count == 0) return false;
+    return loopopt_block(function->data.function.body) > 0;
+}
+
+static bool run_vectorize(PassManager *pm, ASTNode *function) {
+    LoopInfo *info = pass_manager_get_analysis(pm, "loop-info", function);
+    if (info && info->loop_count == 0) return false;
+    int lanes = pm->options.target.features & TARGET_AVX2 ? VECTORIZE_AVX_LANES : VECTORIZE_SSE_LANES;
+    return vectorize_function(function, lanes) > 0;
+}
+
+// Unrolling grows the code, so -O1 and -Os only simplify induction variables
+static bool run_unroll(PassManager *pm, ASTNode *function) {
+    LoopInfo *info = pass_manager_get_analysis(pm, "loop-info", function);
+    if (info && info->loop_count == 0) return false;
+    int budget = pm->options.level == OPT_LEVEL_2 ? UNROLL_BUDGET : 0;
+    const Profile *profile = pm->options.profile_use ? pm->profile : NULL;
+    return unroll_function(function, budget, profile) > 0;
+}
+
+static bool run_ifconv(PassManager *pm, ASTNode *function) {
+    const Profile *profile = pm->options.profile_use ? pm->profile : NULL;
+    return ifconv_function(function, profile) > 0;
+}
+
+static bool run_gvn(PassManager *pm, ASTNode *function) {
+    (void)pm;
+    return gvn_function(function) > 0;
+}
+
+static bool run_layout(PassManager *pm, InsnList *code) {
+    (void)pm;
+    return layout_function(code) > 0;
+}
+
+static bool run_peephole(PassManager *pm, InsnList *code) {
+    (void)pm;
+    return peephole_optimize(code) > 0;
+}
+
+static bool run_frame(PassManager *pm, InsnList *code) {
+    return frame_function(code, pm->options.omit_frame_pointer) > 0;
+}
+
+static const Pass builtin_passes[] = {
+    {"function-size", PASS_ANALYSIS, {NULL}, analyze_function_size, free, NULL, NULL, NULL},
+    {"loop-info", PASS_ANALYSIS, {NULL}, analyze_loop_info, free, NULL, NULL, NULL},
+    {"consteval", PASS_PROGRAM, {NULL}, NULL, NULL, run_consteval, NULL, NULL},
+    {"ipcp", PASS_PROGRAM, {NULL}, NULL, NULL, run_ipcp, NULL, NULL},
+    {"inline", PASS_PROGRAM, {"function-size"}, NULL, NULL, run_inline, NULL, NULL},
+    {"dfe", PASS_PROGRAM, {NULL}, NULL, NULL, run_dfe, NULL, NULL},
+    {"function-order", PASS_PROGRAM, {"function-size"}, NULL, NULL, run_function_order, NULL, NULL},
+    {"licm", PASS_FUNCTION, {"loop-info"}, NULL, NULL, NULL, run_licm, NULL},
+    {"vectorize", PASS_FUNCTION, {"loop-info"}, NULL, NULL, NULL, run_vectorize, NULL},
+    {"unroll", PASS_FUNCTION, {"loop-info"}, NULL, NULL, NULL, run_unroll, NULL},
+    {"ifconv", PASS_FUNCTION, {NULL}, NULL, NULL, NULL, run_ifconv, NULL},
+    {"gvn", PASS_FUNCTION, {NULL}, NULL, NULL, NULL, run_gvn, NULL},
+    {"layout", PASS_MACHINE, {NULL}, NULL, NULL, NULL, NULL, run_layout},
+    {"peephole", PASS_MACHINE, {NULL}, NULL, NULL, NULL, NULL, run_peephole},
+    {"frame", PASS_MACHINE, {NULL}, NULL, NULL, NULL, NULL, run_frame},
+};
+static const int BUILTIN_PASS_COUNT = sizeof(builtin_passes) / sizeof(builtin_passes[0]);
+
+PassManager *pass_manager_create(CompileOptions options) {
+    PassManager *pm = calloc(1, sizeof(PassManager));
+    if (!pm) return NULL;
+
+    pm->options = options;
+    for (int i = 0; i < BUILTIN_PASS_COUNT; i++) {
+        if (!pass_manager_register(pm, &builtin_passes[i])) {
+            pass_manager_free(pm);
+            return NULL;
+        }
+    }
+    pass_manager_apply_preset(pm);
+    return pm;
+}
+
+void pass_manager_free(PassManager *pm) {
+    if (!pm) return;
+
+    pass_manager_invalidate(pm, NULL);
+    profile_free(pm->profile);
+    for (int i = 0; i < pm->slot_count; i++) free(pm->slots[i].results);
+    free(pm->slots);
+    free(pm->slot_buckets);
+    free(pm->passes);
+    free(pm->enabled);
+    for (int i = 0; i < pm->timing_count; i++) free(pm->timings[i].function);
+    free(pm->timings);
+    free(pm->timing_buckets);
+    free(pm);
+}
+
+bool pass_manager_register(PassManager *pm, const Pass *pass) {
+    void *passes = realloc(pm->passes, sizeof(Pass *) * (pm->pass_count + 1));
+    if (!passes) return false;
+    pm->passes = passes;
+
+    void *enabled = realloc(pm->enabled, sizeof(bool) * (pm->pass_count + 1));
+    if (!enabled) return false;
+    pm->enabled = enabled;
+
+    pm->passes[pm->pass_count] = pass;
+    pm->enabled[pm->pass_count] = pass->kind == PASS_ANALYSIS;
+    pm->pass_count++;
+    return true;
+}
+
+static int find_pass(PassManager *pm, const char *name) {
+    for (int i = 0; i < pm->pass_count; i++) {
+        if (strcmp(pm->passes[i]->name, name) == 0) return i;
+    }
+    return -1;
+}
+
+bool pass_manager_enable(PassManager *pm, const char *name, bool enabled) {
+    int index = find_pass(pm, name);
+    if (index < 0) return false;
+    pm->enabled[index] = enabled;
+    return true;
+}
+
+void pass_manager_apply_preset(PassManager *pm) {
+    OptLevel level = pm->options.level;
+    bool optimize = level != OPT_LEVEL_0;
+
+    pass_manager_enable(pm, "consteval", optimize);
+    pass_manager_enable(pm, "ipcp", level == OPT_LEVEL_2 || level == OPT_LEVEL_SIZE);
+    pass_manager_enable(pm, "inline", level == OPT_LEVEL_2 || level == OPT_LEVEL_SIZE);
+    pass_manager_enable(pm, "dfe", optimize);
+    pass_manager_enable(pm, "function-order", optimize);
+    pass_manager_enable(pm, "licm", optimize);
+    pass_manager_enable(pm, "vectorize", level == OPT_LEVEL_2);
+    pass_manager_enable(pm, "unroll", optimize);
+    pass_manager_enable(pm, "ifconv", optimize);
+    pass_manager_enable(pm, "gvn", optimize);
+    pass_manager_enable(pm, "layout", optimize);
+    pass_manager_enable(pm, "peephole", optimize);
+    pass_manager_enable(pm, "frame", optimize);
+}
+
+bool pass_parse_opt_level(const char *flag, OptLevel *level) {
+    if (strcmp(flag, "-O0") == 0) *level = OPT_LEVEL_0;
+    else if (strcmp(flag, "-O1") == 0) *level = OPT_LEVEL_1;
+    else if (strcmp(flag, "-O2") == 0 || strcmp(flag, "-O") == 0) *level = OPT_LEVEL_2;
+    else if (strcmp(flag, "-Os") == 0) *level = OPT_LEVEL_SIZE;
+    else return false;
+    return true;
+}
+
+// Open-addressed tables map keys to entry indices. Each has room for twice
+// its entries, so lookups stay constant time however many functions there are.
+#define INITIAL_BUCKET_COUNT 64
+
+static int *new_buckets(int bucket_count) {
+    int *buckets = malloc(sizeof(int) * bucket_count);
+    if (!buckets) return NULL;
+    for (int i = 0; i < bucket_count; i++) buckets[i] = -1;
+    return buckets;
+}
+
+static unsigned hash_name(unsigned hash, const char *name) {
+    while (*name) {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static unsigned hash_timing(const char *pass, const char *function) {
+    unsigned hash = hash_name(2166136261u, pass) * 16777619u;
+    return function ? hash_name(hash, function) : hash;
+}
+
+static unsigned hash_function(const ASTNode *function) {
+    unsigned long h = (unsigned long)function * 0x9e3779b97f4a7c15UL;
+    return (unsigned)(h >> 32);
+}
+
+static bool rehash_timings(PassManager *pm, int bucket_count) {
+    int *buckets = new_buckets(bucket_count);
+    if (!buckets) return false;
+    for (int i = 0; i < pm->timing_count; i++) {
+        unsigned h = hash_timing(pm->timings[i].pass, pm->timings[i].function) & (bucket_count - 1);
+        while (buckets[h] >= 0) h = (h + 1) & (bucket_count - 1);
+        buckets[h] = i;
+    }
+    free(pm->timing_buckets);
+    pm->timing_buckets = buckets;
+    pm->timing_bucket_count = bucket_count;
+    return true;
+}
+
+static void record_timing(PassManager *pm, const char *pass, ASTNode *function,
+                          double seconds, long allocations) {
+    if (!pm->options.time_passes) return;
+    if ((pm->timing_count + 1) * 2 > pm->timing_bucket_count &&
+        !rehash_timings(pm, pm->timing_bucket_count ? pm->timing_bucket_count * 2 : INITIAL_BUCKET_COUNT)) {
+        return;
+    }
+
+    const char *name = function ? function->data.function.name : NULL;
+    unsigned mask = pm->timing_bucket_count - 1;
+    unsigned h = hash_timing(pass, name) & mask;
+    for (int i; (i = pm->timing_buckets[h]) >= 0; h = (h + 1) & mask) {
+        PassTiming *t = &pm->timings[i];
+        if (strcmp(t->pass, pass) == 0 &&
+            (t->function == name || (t->function && name && strcmp(t->function, name) == 0))) {
+            t->seconds += seconds;
+            t->allocations += allocations;
+            t->runs++;
+            return;
+        }
+    }
+
+    if (pm->timing_count == pm->timing_capacity) {
+        int capacity = pm->timing_capacity ? pm->timing_capacity * 2 : INITIAL_BUCKET_COUNT;
+        void *temp = realloc(pm->timings, sizeof(PassTiming) * capacity);
+        if (!temp) return;
+        pm->timings = temp;
+        pm->timing_capacity = capacity;
+    }
+    char *copy = name ? strdup(name) : NULL;
+    if (name && !copy) return;
+    pm->timing_buckets[h] = pm->timing_count;
+    pm->timings[pm->timing_count++] = (PassTiming){pass, copy, seconds, allocations, 1};
+}
+
+static bool rehash_slots(PassManager *pm, int bucket_count) {
+    int *buckets = new_buckets(bucket_count);
+    if (!buckets) return false;
+    for (int i = 0; i < pm->slot_count; i++) {
+        unsigned h = hash_function(pm->slots[i].function) & (bucket_count - 1);
+        while (buckets[h] >= 0) h = (h + 1) & (bucket_count - 1);
+        buckets[h] = i;
+    }
+    free(pm->slot_buckets);
+    pm->slot_buckets = buckets;
+    pm->slot_bucket_count = bucket_count;
+    return true;
+}
+
+// The analyses cached for function; a new empty slot if create is set,
+// otherwise NULL when nothing was ever cached for it
+static AnalysisSlot *find_slot(PassManager *pm, ASTNode *function, bool create) {
+    if (pm->slot_count == 0 && !create) return NULL;
+    if (create && (pm->slot_count + 1) * 2 > pm->slot_bucket_count &&
+        !rehash_slots(pm, pm->slot_bucket_count ? pm->slot_bucket_count * 2 : INITIAL_BUCKET_COUNT)) {
+        return NULL;
+    }
+
+    unsigned mask = pm->slot_bucket_count - 1;
+    unsigned h = hash_function(function) & mask;
+    for (int i; (i = pm->slot_buckets[h]) >= 0; h = (h + 1) & mask) {
+        if (pm->slots[i].function == function) return &pm->slots[i];
+    }
+    if (!create) return NULL;
+
+    if (pm->slot_count == pm->slot_capacity) {
+        int capacity = pm->slot_capacity ? pm->slot_capacity * 2 : INITIAL_BUCKET_COUNT;
+        void *temp = realloc(pm->slots, sizeof(AnalysisSlot) * capacity);
+        if (!temp) return NULL;
+        pm->slots = temp;
+        pm->slot_capacity = capacity;
+    }
+    void **results = calloc(pm->pass_count, sizeof(void *));
+    if (!results) return NULL;
+    pm->slot_buckets[h] = pm->slot_count;
+    pm->slots[pm->slot_count] = (AnalysisSlot){function, results, pm->pass_count};
+    return &pm->slots[pm->slot_count++];
+}
+
+void *pass_manager_get_analysis(PassManager *pm, const char *name, ASTNode *function) {
+    int index = find_pass(pm, name);
+    if (index < 0 || pm->passes[index]->kind != PASS_ANALYSIS) return NULL;
+
+    AnalysisSlot *slot = find_slot(pm, function, true);
+    if (!slot || index >= slot->result_count) return NULL;
+    if (slot->results[index]) return slot->results[index];
+
+    double start = now_seconds();
+    long allocations = pass_allocation_count();
+    void *result = pm->passes[index]->analyze(pm, function);
+    record_timing(pm, name, function, now_seconds() - start,
+                  pass_allocation_count() - allocations);
+
+    slot->results[index] = result;
+    return result;
+}
+
+static void release_slot(PassManager *pm, AnalysisSlot *slot) {
+    for (int i = 0; i < slot->result_count; i++) {
+        if (!slot->results[i]) continue;
+        if (pm->passes[i]->release) pm->passes[i]->release(slot->results[i]);
+        slot->results[i] = NULL;
+    }
+}
+
+void pass_manager_invalidate(PassManager *pm, ASTNode *function) {
+    if (function) {
+        AnalysisSlot *slot = find_slot(pm, function, false);
+        if (slot) release_slot(pm, slot);
+        return;
+    }
+    for (int i = 0; i < pm->slot_count; i++) release_slot(pm, &pm->slots[i]);
+}
+
+static void compute_requirements(PassManager *pm, const Pass *pass, ASTNode *function) {
+    for (int r = 0; r < PASS_MAX_REQUIRES && pass->requires[r]; r++) {
+        if (function) {
+            pass_manager_get_analysis(pm, pass->requires[r], function);
+            continue;
+        }
+        for (int i = 0; i < pm->program->data.program.function_count; i++) {
+            ASTNode *f = pm->program->data.program.functions[i];
+            if (f->type == NODE_FUNCTION) pass_manager_get_analysis(pm, pass->requires[r], f);
+        }
+    }
+}
+
+// Run one transform and keep the analysis cache consistent with its result
+static void run_transform(PassManager *pm, int index, ASTNode *function, InsnList *code) {
+    const Pass *pass = pm->passes[index];
+    compute_requirements(pm, pass, pass->kind == PASS_PROGRAM ? NULL : function);
+
+    double start = now_seconds();
+    long allocations = pass_allocation_count();
+    bool changed = false;
+    switch (pass->kind) {
+        case PASS_PROGRAM:  changed = pass->run_program(pm, pm->program); break;
+        case PASS_FUNCTION: changed = pass->run_function(pm, function); break;
+        case PASS_MACHINE:  changed = pass->run_machine(pm, code); break;
+        default: break;
+    }
+    record_timing(pm, pass->name, pass->kind == PASS_PROGRAM ? NULL : function,
+                  now_seconds() - start, pass_allocation_count() - allocations);
+
+    // Machine passes leave the AST, and so its analyses, untouched
+    if (changed && pass->kind != PASS_MACHINE) {
+        pass_manager_invalidate(pm, pass->kind == PASS_PROGRAM ? NULL : function);
+    }
+}
+
+// Number the profile counters before any transform, and read the counts
+// of a training run. A missing or stale profile only costs its guidance.
+static void setup_profile(PassManager *pm, ASTNode *program) {
+    const char *use = pm->options.profile_use;
+    if (!pm->options.profile_generate && !use) return;
+
+    pm->profile = profile_create(program);
+    if (!pm->profile || !use) return;
+
+    char error[256];
+    if (!profile_load(pm->profile, use, error, sizeof(error))) {
+        fprintf(stderr, "warning: %s; compiling without profile feedback\n", error);
+        return;
+    }
+    int matched = profile_matched_count(pm->profile);
+    if (matched < pm->profile->function_count) {
+        fprintf(stderr, "warning: %s does not match %d of %d functions; "
+                        "they are compiled without profile feedback\n",
+                use, pm->profile->function_count - matched, pm->profile->function_count);
+    }
+}
+
+static long entry_count(PassManager *pm, ASTNode *function) {
+    if (!pm->options.profile_use) return -1;
+    return profile_count(pm->profile, function, 0);
+}
+
+// Hottest functions first so they share pages; functions the training run
+// never entered go last, into .text.unlikely. Without counts the program
+// order is kept, and so is the order function-order chose for the rest.
+static int order_functions(PassManager *pm, ASTNode *program, int *order) {
+    int index = find_pass(pm, "function-order");
+    bool clustered = index >= 0 && pm->enabled[index];
+    int count = 0;
+    for (int f = 0; f < program->data.program.function_count; f++) {
+        ASTNode *function = program->data.program.functions[f];
+        if (function->type == NODE_FUNCTION) order[count++] = f;
+    }
+
+    // Insertion sort keeps equal counts in program order
+    for (int i = 1; i < count; i++) {
+        int f = order[i];
+        long key = entry_count(pm, program->data.program.functions[f]);
+        if (clustered && key > 0) key = 1;
+        int j = i - 1;
+        while (j >= 0) {
+            long other = entry_count(pm, program->data.program.functions[order[j]]);
+            if (clustered && other > 0) other = 1;
+            bool before = key > 0 ? key > other : (key < 0 && other == 0);
+            if (!before) break;
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = f;
+    }
+    return count;
+}
+
+void pass_manager_run(PassManager *pm, ASTNode *program, CodeGenerator *gen) {
+    pm->program = program;
+    pm->gen = gen;
+
+    OptLevel level = pm->options.level;
+    gen->tail_calls = level != OPT_LEVEL_0;
+    gen->align_loops = level == OPT_LEVEL_1 || level == OPT_LEVEL_2;
+    gen->target = pm->options.target;
+    gen->exports = pm->options.exports;
+    gen->export_count = pm->options.export_count;
+
+    setup_profile(pm, program);
+    if (pm->profile) {
+        gen->profile_counters = pm->options.profile_generate != NULL;
+        gen->profile_counts = pm->options.profile_use ? pm->profile->counts : NULL;
+    }
+
+    for (int i = 0; i < pm->pass_count; i++) {
+        if (pm->enabled[i] && pm->passes[i]->kind == PASS_PROGRAM) {
+            run_transform(pm, i, NULL, NULL);
+        }
+    }
+
+    if (pm->options.dump_callgraph) {
+        CallGraph *graph = build_callgraph(pm, program);
+        if (graph) callgraph_dump(graph, stderr);
+        callgraph_free(graph);
+    }
+
+    codegen_program(gen, program);
+
+    InsnList *code = insn_list_create();
+    int *order = malloc(sizeof(int) * (program->data.program.function_count + 1));
+    if (!code || !order) {
+        insn_list_free(code);
+        free(order);
+        return;
+    }
+    InsnList *output = gen->insns;
+    int function_count = order_functions(pm, program, order);
+    bool cold_section = false;
+
+    for (int f = 0; f < function_count; f++) {
+        ASTNode *function = program->data.program.functions[order[f]];
+
+        for (int i = 0; i < pm->pass_count; i++) {
+            if (pm->enabled[i] && pm->passes[i]->kind == PASS_FUNCTION) {
+                run_transform(pm, i, function, NULL);
+            }
+        }
+
+        if (!cold_section && entry_count(pm, function) == 0) {
+            codegen_emit(gen, "\t.section .text.unlikely,\"ax\",@progbits");
+            cold_section = true;
+        }
+
+        // Generate the function on its own so machine passes see only it
+        double start = now_seconds();
+        long allocations = pass_allocation_count();
+        gen->insns = code;
+        codegen_function(gen, function);
+        gen->insns = output;
+        record_timing(pm, "codegen", function, now_seconds() - start,
+                      pass_allocation_count() - allocations);
+
+        for (int i = 0; i < pm->pass_count; i++) {
+            if (pm->enabled[i] && pm->passes[i]->kind == PASS_MACHINE) {
+                run_transform(pm, i, function, code);
+            }
+        }
+
+        insn_list_splice(output, code);
+        codegen_emit_rodata(gen);
+    }
+    insn_list_free(code);
+    free(order);
+
+    double start = now_seconds();
+    long allocations = pass_allocation_count();
+    if (cold_section) codegen_emit(gen, "\t.section .text");
+    codegen_entry_point(gen);
+    if (gen->profile_counters) profile_emit(pm->profile, gen, pm->options.profile_generate);
+    codegen_emit_strings(gen);
+    codegen_flush(gen);
+    record_timing(pm, "emit", NULL, now_seconds() - start,
+                  pass_allocation_count() - allocations);
+
+    if (pm->options.time_passes) pass_manager_report(pm, stderr);
+}
+
+void pass_manager_report(PassManager *pm, FILE *output) {
+    double total_seconds = 0;
+    long total_allocations = 0;
+
+    fprintf(output, "===-------------------------------------------------------===\n");
+    fprintf(output, "                  Pass execution timing report\n");
+    fprintf(output, "===-------------------------------------------------------===\n");
+    fprintf(output, "  %-14s %-20s %10s %10s %6s\n", "Pass", "Function", "Wall (ms)", "Allocs", "Runs");
+    for (int i = 0; i < pm->timing_count; i++) {
+        PassTiming *t = &pm->timings[i];
+        fprintf(output, "  %-14s %-20s %10.3f %10ld %6d\n", t->pass,
+                t->function ? t->function : "<program>",
+                t->seconds * 1000.0, t->allocations, t->runs);
+        total_seconds += t->seconds;
+        total_allocations += t->allocations;
+    }
+    fprintf(output, "  %-14s %-20s %10.3f %10ld\n", "Total", "",
+            total_seconds * 1000.0, total_allocations);
+}
\ No newline at end of file
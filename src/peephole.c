@@ -0,0 +1,382 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <peephole.h>
+
+static const int MAX_PEEPHOLE_ROUNDS = 16;
+static const int MAX_JUMP_CHAIN = 32;
+
+int peephole_next(InsnList *list, int index) {
+    index++;
+    while (index < list->count && list->items[index].kind == INSN_DELETED) {
+        index++;
+    }
+    return index;
+}
+
+static bool is_alignment(const Insn *insn) {
+    return insn->kind == INSN_DIRECTIVE &&
+           (strncmp(insn->text, "\t.p2align", 9) == 0 ||
+            strncmp(insn->text, "\t.align", 7) == 0);
+}
+
+static bool is_register(const char *operand) {
+    return operand[0] == '%' && insn_reg_family(operand) != NULL;
+}
+
+static int compare_labels(const void *a, const void *b) {
+    return strcmp(((const LabelEntry *)a)->name, ((const LabelEntry *)b)->name);
+}
+
+static void label_index_build(LabelIndex *labels, InsnList *list) {
+    labels->count = 0;
+    labels->entries = malloc(sizeof(LabelEntry) * (list->count + 1));
+    if (!labels->entries) return;
+
+    for (int i = 0; i < list->count; i++) {
+        if (list->items[i].kind == INSN_LABEL) {
+            labels->entries[labels->count].name = list->items[i].label;
+            labels->entries[labels->count].index = i;
+            labels->count++;
+        }
+    }
+    qsort(labels->entries, labels->count, sizeof(LabelEntry), compare_labels);
+}
+
+static void label_index_free(LabelIndex *labels) {
+    free(labels->entries);
+}
+
+static int label_index_find(LabelIndex *labels, const char *name) {
+    if (!labels->entries) return -1;
+    LabelEntry key = {name, 0};
+    LabelEntry *found = bsearch(&key, labels->entries, labels->count,
+                                sizeof(LabelEntry), compare_labels);
+    return found ? found->index : -1;
+}
+
+// pushq X; ...; popq R  =>  movq X, R; ...
+// The instructions in between must not touch the stack, branch, or use R.
+static bool peephole_push_pop(PeepholeContext *ctx, int index) {
+    InsnList *list = ctx->list;
+    Insn *push = &list->items[index];
+    if (!insn_is_op(push, "pushq")) return false;
+
+    const char *src = push->operands[0];
+    if (!is_register(src) && src[0] != '$') return false;
+
+    int j = peephole_next(list, index);
+    bool src_clobbered = false;
+    for (; j < list->count; j = peephole_next(list, j)) {
+        Insn *insn = &list->items[j];
+        if (insn->kind != INSN_OP) return false;
+        if (insn_is_op(insn, "popq")) break;
+        if (insn_is_jump(insn) || insn_touches_stack(insn)) return false;
+        if (is_register(src) && insn_mentions_reg(insn, src)) src_clobbered = true;
+    }
+    if (j >= list->count) return false;
+
+    Insn *pop = &list->items[j];
+    const char *dst = pop->operands[0];
+    if (!is_register(dst)) return false;
+
+    bool dst_used = false;
+    for (int k = peephole_next(list, index); k < j; k = peephole_next(list, k)) {
+        if (insn_mentions_reg(&list->items[k], dst)) dst_used = true;
+    }
+
+    char line[160];
+    bool same = is_register(src) && strcmp(insn_reg_family(src), insn_reg_family(dst)) == 0;
+    if (!dst_used) {
+        // Copy at the push site: R is not looked at until the pop
+        if (same) {
+            insn_delete(push);
+        } else {
+            snprintf(line, sizeof(line), "\tmovq %s, %s", src, dst);
+            insn_set(push, line);
+        }
+        insn_delete(pop);
+        return true;
+    }
+    if (!src_clobbered) {
+        // Copy at the pop site: X still holds the pushed value there
+        snprintf(line, sizeof(line), "\tmovq %s, %s", src, dst);
+        insn_delete(push);
+        insn_set(pop, line);
+        return true;
+    }
+    return false;
+}
+
+// Whether the flags are overwritten before anything reads them
+static bool flags_dead_after(InsnList *list, int index) {
+    for (int j = peephole_next(list, index); j < list->count; j = peephole_next(list, j)) {
+        Insn *insn = &list->items[j];
+        if (insn->kind != INSN_OP) return false;
+        if (insn_reads_flags(insn)) return false;
+        if (insn_writes_flags(insn) || insn_is_op(insn, "ret")) return true;
+        if (insn_is_jump(insn)) return false;
+    }
+    return false;
+}
+
+// movq $0, %reg  =>  xorl %reg32, %reg32 (shorter, breaks dependencies)
+static bool peephole_zero_to_xor(PeepholeContext *ctx, int index) {
+    InsnList *list = ctx->list;
+    Insn *insn = &list->items[index];
+    if (!insn_is_op(insn, "movq") && !insn_is_op(insn, "movl")) return false;
+    if (strcmp(insn->operands[0], "$0") != 0 || !is_register(insn->operands[1])) return false;
+    if (!flags_dead_after(list, index)) return false;
+
+    const char *reg32 = insn_reg32(insn->operands[1]);
+    char line[64];
+    snprintf(line, sizeof(line), "\txorl %%%s, %%%s", reg32, reg32);
+    insn_set(insn, line);
+    return true;
+}
+
+// shl/sal/sar/shr $0, X  =>  (nothing; a zero count leaves X and the flags alone)
+// The 32-bit forms may clear the upper half of a register, which holds
+// nothing a 32-bit value depends on.
+static bool peephole_zero_shift(PeepholeContext *ctx, int index) {
+    static const char *shifts[] = {"shlq", "salq", "sarq", "shrq", "shll", "sall", "sarl", "shrl"};
+    Insn *insn = &ctx->list->items[index];
+    bool is_shift = false;
+    for (int i = 0; i < (int)(sizeof(shifts) / sizeof(shifts[0])); i++) {
+        if (insn_is_op(insn, shifts[i])) is_shift = true;
+    }
+    if (!is_shift) return false;
+    if (insn->operand_count != 2 || strcmp(insn->operands[0], "$0") != 0) return false;
+    insn_delete(insn);
+    return true;
+}
+
+// Whether insn leaves its result in reg32, which clears the upper half
+static bool writes_reg32(const Insn *insn, const char *reg32) {
+    if (insn->kind != INSN_OP || insn->operand_count == 0) return false;
+    // One-operand multiply and divide write %eax and %edx
+    if (insn->operand_count == 1 && (insn_is_op(insn, "mull") || insn_is_op(insn, "imull") ||
+                                     insn_is_op(insn, "divl") || insn_is_op(insn, "idivl"))) {
+        return strcmp(reg32, "%eax") == 0 || strcmp(reg32, "%edx") == 0;
+    }
+    if (strcmp(insn->operands[insn->operand_count - 1], reg32) != 0) return false;
+    size_t length = strlen(insn->mnemonic);
+    if (insn->mnemonic[length - 1] != 'l') return false;
+    return strncmp(insn->mnemonic, "cmp", 3) != 0 && strncmp(insn->mnemonic, "test", 4) != 0 &&
+           !insn_is_op(insn, "btl");
+}
+
+// addl X, %eax; movl %eax, %eax  =>  addl X, %eax
+// The zero extension is already done by any instruction that writes the
+// 32-bit register right before it.
+static bool peephole_zero_extend(PeepholeContext *ctx, int index) {
+    InsnList *list = ctx->list;
+    Insn *insn = &list->items[index];
+    if (!insn_is_op(insn, "movl") || insn->operand_count != 2) return false;
+    if (!is_register(insn->operands[0]) || strcmp(insn->operands[0], insn->operands[1]) != 0) return false;
+
+    int previous = index - 1;
+    while (previous >= 0 && list->items[previous].kind == INSN_DELETED) previous--;
+    if (previous < 0 || !writes_reg32(&list->items[previous], insn->operands[0])) return false;
+    insn_delete(insn);
+    return true;
+}
+
+// setCC %al; movzbl %al, %eax; testl %eax, %eax; je L  =>  ...; jNCC L
+// (or movzbq, or cmp $0). The flags from the original comparison are still
+// live after setcc/movzb.
+static bool peephole_setcc_branch(PeepholeContext *ctx, int index) {
+    InsnList *list = ctx->list;
+    Insn *set = &list->items[index];
+    if (set->kind != INSN_OP || strncmp(set->mnemonic, "set", 3) != 0) return false;
+    const char *cond = set->mnemonic + 3;
+    if (!insn_invert_cond(cond)) return false;
+
+    int i1 = peephole_next(list, index);
+    int i2 = peephole_next(list, i1);
+    int i3 = peephole_next(list, i2);
+    if (i3 >= list->count) return false;
+
+    Insn *ext = &list->items[i1];
+    Insn *cmp = &list->items[i2];
+    Insn *jump = &list->items[i3];
+    if (!insn_is_op(ext, "movzbq") && !insn_is_op(ext, "movzbl")) return false;
+    bool is_test = insn_is_op(cmp, "testq") || insn_is_op(cmp, "testl");
+    if (!is_test && !insn_is_op(cmp, "cmpq") && !insn_is_op(cmp, "cmpl")) return false;
+    if (cmp->operand_count != 2 || !is_register(cmp->operands[1]) ||
+        strcmp(cmp->operands[0], is_test ? cmp->operands[1] : "$0") != 0) {
+        return false;
+    }
+    if (strcmp(insn_reg_family(set->operands[0]), insn_reg_family(ext->operands[1])) != 0 ||
+        strcmp(insn_reg_family(cmp->operands[1]), insn_reg_family(ext->operands[1])) != 0) {
+        return false;
+    }
+
+    const char *new_cond;
+    if (insn_is_op(jump, "je")) {
+        new_cond = insn_invert_cond(cond);
+    } else if (insn_is_op(jump, "jne")) {
+        new_cond = cond;
+    } else {
+        return false;
+    }
+
+    char line[160];
+    snprintf(line, sizeof(line), "\tj%s %s", new_cond, jump->operands[0]);
+    insn_delete(cmp);
+    insn_set(jump, line);
+    return true;
+}
+
+// subq $1, X; cmpq $0, X; jne L  =>  subq $1, X; jne L
+// (also add, and, or and xor, any width, and testq X, X for a register).
+// The arithmetic already set ZF and SF from the value the compare tests,
+// but not CF and OF, so only branches on zero and sign can use them.
+static bool peephole_arith_compare(PeepholeContext *ctx, int index) {
+    static const char *arithmetic[] = {"add", "sub", "and", "or", "xor"};
+    static const char *branches[] = {"je", "jne", "js", "jns"};
+    InsnList *list = ctx->list;
+    Insn *op = &list->items[index];
+    if (op->operand_count != 2) return false;
+
+    size_t length = strlen(op->mnemonic);
+    if (length < 2) return false;
+    char width = op->mnemonic[length - 1];
+    if (!strchr("bwlq", width)) return false;
+    bool is_arithmetic = false;
+    for (int i = 0; i < (int)(sizeof(arithmetic) / sizeof(arithmetic[0])); i++) {
+        if (length == strlen(arithmetic[i]) + 1 && strncmp(op->mnemonic, arithmetic[i], length - 1) == 0) {
+            is_arithmetic = true;
+        }
+    }
+    if (!is_arithmetic) return false;
+
+    int i1 = peephole_next(list, index);
+    int i2 = peephole_next(list, i1);
+    if (i2 >= list->count) return false;
+    Insn *cmp = &list->items[i1];
+    Insn *jump = &list->items[i2];
+
+    const char *result = op->operands[1];
+    char cmp_op[8], test_op[8];
+    snprintf(cmp_op, sizeof(cmp_op), "cmp%c", width);
+    snprintf(test_op, sizeof(test_op), "test%c", width);
+    bool compares_zero = insn_is_op(cmp, cmp_op) && cmp->operand_count == 2 &&
+                         strcmp(cmp->operands[0], "$0") == 0 && strcmp(cmp->operands[1], result) == 0;
+    bool tests_itself = insn_is_op(cmp, test_op) && cmp->operand_count == 2 && is_register(result) &&
+                        strcmp(cmp->operands[0], result) == 0 && strcmp(cmp->operands[1], result) == 0;
+    if (!compares_zero && !tests_itself) return false;
+
+    for (int i = 0; i < (int)(sizeof(branches) / sizeof(branches[0])); i++) {
+        if (insn_is_op(jump, branches[i])) {
+            insn_delete(cmp);
+            return true;
+        }
+    }
+    return false;
+}
+
+// jmp L; L:  =>  L:  (also for conditional jumps)
+static bool peephole_jump_to_next(PeepholeContext *ctx, int index) {
+    InsnList *list = ctx->list;
+    Insn *jump = &list->items[index];
+    const char *target = insn_jump_target(jump);
+    if (!target) return false;
+
+    for (int j = peephole_next(list, index); j < list->count; j = peephole_next(list, j)) {
+        Insn *insn = &list->items[j];
+        if (insn->kind == INSN_LABEL) {
+            if (strcmp(insn->label, target) == 0) {
+                insn_delete(jump);
+                return true;
+            }
+        } else if (!is_alignment(insn)) {
+            break;
+        }
+    }
+    return false;
+}
+
+// jmp L1; ... L1: jmp L2  =>  jmp L2
+static bool peephole_jump_chain(PeepholeContext *ctx, int index) {
+    InsnList *list = ctx->list;
+    Insn *jump = &list->items[index];
+    const char *target = insn_jump_target(jump);
+    if (!target) return false;
+
+    const char *final = target;
+    for (int hops = 0; hops < MAX_JUMP_CHAIN; hops++) {
+        int at = label_index_find(&ctx->labels, final);
+        if (at < 0) break;
+
+        int j = at;
+        while (j < list->count && (list->items[j].kind == INSN_LABEL ||
+                                   list->items[j].kind == INSN_DELETED ||
+                                   is_alignment(&list->items[j]))) {
+            j++;
+        }
+        if (j >= list->count || !insn_is_op(&list->items[j], "jmp")) break;
+
+        const char *next = insn_jump_target(&list->items[j]);
+        if (!next || strcmp(next, target) == 0 || strcmp(next, final) == 0) break;
+        final = next;
+    }
+    if (final == target) return false;
+
+    char line[160];
+    snprintf(line, sizeof(line), "\t%s %s", jump->mnemonic, final);
+    insn_set(jump, line);
+    return true;
+}
+
+// jmp L; <unreachable instructions>  =>  jmp L
+static bool peephole_unreachable(PeepholeContext *ctx, int index) {
+    InsnList *list = ctx->list;
+    Insn *insn = &list->items[index];
+    if (!insn_is_op(insn, "jmp") && !insn_is_op(insn, "ret")) return false;
+
+    bool changed = false;
+    for (int j = peephole_next(list, index); j < list->count; j = peephole_next(list, j)) {
+        if (list->items[j].kind != INSN_OP) break;
+        insn_delete(&list->items[j]);
+        changed = true;
+    }
+    return changed;
+}
+
+static const PeepholePattern patterns[] = {
+    {"push-pop-to-mov",   peephole_push_pop},
+    {"zero-to-xor",       peephole_zero_to_xor},
+    {"zero-shift",        peephole_zero_shift},
+    {"zero-extend",       peephole_zero_extend},
+    {"setcc-branch",      peephole_setcc_branch},
+    {"arith-compare",     peephole_arith_compare},
+    {"jump-to-next",      peephole_jump_to_next},
+    {"jump-chain",        peephole_jump_chain},
+    {"unreachable-code",  peephole_unreachable},
+};
+static const int PATTERN_COUNT = sizeof(patterns) / sizeof(patterns[0]);
+
+int peephole_optimize(InsnList *list) {
+    PeepholeContext ctx;
+    ctx.list = list;
+    label_index_build(&ctx.labels, list);
+
+    int rewrites = 0;
+    for (int round = 0; round < MAX_PEEPHOLE_ROUNDS; round++) {
+        bool changed = false;
+        for (int i = 0; i < list->count; i++) {
+            for (int p = 0; p < PATTERN_COUNT; p++) {
+                if (list->items[i].kind != INSN_OP) break;
+                if (patterns[p].apply(&ctx, i)) {
+                    changed = true;
+                    rewrites++;
+                }
+            }
+        }
+        if (!changed) break;
+    }
+
+    label_index_free(&ctx.labels);
+    return rewrites;
+}
\ No newline at end of file
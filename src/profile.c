@@ -0,0 +1,290 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <profile.h>
+
+// Profile file layout, all fields little-endian 64-bit:
+//   magic, function count, counter count,
+//   per function: name hash, checksum, counter count,
+//   counters
+#define PROFILE_HEADER_SIZE 24
+#define PROFILE_RECORD_SIZE 24
+
+static unsigned long hash_string(unsigned long hash, const char *s) {
+    while (*s) {
+        hash ^= (unsigned char)*s++;
+        hash *= 0x100000001b3UL;
+    }
+    return hash;
+}
+
+static unsigned long hash_int(unsigned long hash, long value) {
+    for (int i = 0; i < 8; i++) {
+        hash ^= (unsigned long)(value >> (i * 8)) & 0xff;
+        hash *= 0x100000001b3UL;
+    }
+    return hash;
+}
+
+// Give a node its counters and fold its shape into the function checksum.
+// Constants do not affect the checksum, so tuning a literal keeps the profile.
+static void number_node(Profile *profile, ASTNode *node, unsigned long *checksum) {
+    if (!node) return;
+
+    *checksum = hash_int(*checksum, node->type);
+
+    int counters = 0;
+    switch (node->type) {
+        case NODE_IF:    counters = PROFILE_IF_COUNTERS; break;
+        case NODE_WHILE:
+        case NODE_FOR:   counters = PROFILE_LOOP_COUNTERS; break;
+        case NODE_CALL:  counters = PROFILE_CALL_COUNTERS; break;
+        default: break;
+    }
+    if (counters) {
+        node->profile_id = profile->counter_count + 1;
+        profile->counter_count += counters;
+    }
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                number_node(profile, node->data.block.statements[i], checksum);
+            }
+            break;
+        case NODE_RETURN:
+            number_node(profile, node->data.return_stmt.expression, checksum);
+            break;
+        case NODE_IF:
+            number_node(profile, node->data.if_stmt.condition, checksum);
+            number_node(profile, node->data.if_stmt.then_branch, checksum);
+            number_node(profile, node->data.if_stmt.else_branch, checksum);
+            break;
+        case NODE_WHILE:
+            number_node(profile, node->data.while_stmt.condition, checksum);
+            number_node(profile, node->data.while_stmt.body, checksum);
+            break;
+        case NODE_FOR:
+            number_node(profile, node->data.for_stmt.init, checksum);
+            number_node(profile, node->data.for_stmt.condition, checksum);
+            number_node(profile, node->data.for_stmt.step, checksum);
+            number_node(profile, node->data.for_stmt.body, checksum);
+            break;
+        case NODE_SWITCH:
+            number_node(profile, node->data.switch_stmt.value, checksum);
+            number_node(profile, node->data.switch_stmt.body, checksum);
+            break;
+        case NODE_BINARY_OP:
+            *checksum = hash_int(*checksum, node->data.binary_op.operator);
+            number_node(profile, node->data.binary_op.left, checksum);
+            number_node(profile, node->data.binary_op.right, checksum);
+            break;
+        case NODE_UNARY_OP:
+            *checksum = hash_int(*checksum, node->data.unary_op.operator);
+            number_node(profile, node->data.unary_op.operand, checksum);
+            break;
+        case NODE_INDEX:
+            *checksum = hash_string(*checksum, node->data.index.array->data.variable.name);
+            number_node(profile, node->data.index.index, checksum);
+            break;
+        case NODE_CALL:
+            *checksum = hash_string(*checksum, node->data.call.name);
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                number_node(profile, node->data.call.args[i], checksum);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+Profile *profile_create(ASTNode *program) {
+    Profile *profile = calloc(1, sizeof(Profile));
+    if (!profile) return NULL;
+
+    int count = program->data.program.function_count;
+    profile->functions = calloc(count + 1, sizeof(ProfileFunction));
+    if (!profile->functions) {
+        free(profile);
+        return NULL;
+    }
+
+    for (int i = 0; i < count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        if (function->type != NODE_FUNCTION) continue;
+
+        ProfileFunction *record = &profile->functions[profile->function_count++];
+        record->name_hash = hash_string(0xcbf29ce484222325UL, function->data.function.name);
+        record->checksum = hash_int(0xcbf29ce484222325UL, function->data.function.param_count);
+        record->first = profile->counter_count;
+
+        function->profile_id = profile->counter_count + 1;
+        profile->counter_count += PROFILE_FUNCTION_COUNTERS;
+        number_node(profile, function->data.function.body, &record->checksum);
+        record->count = profile->counter_count - record->first;
+    }
+
+    profile->counts = malloc(sizeof(long) * (profile->counter_count + 1));
+    if (!profile->counts) {
+        profile_free(profile);
+        return NULL;
+    }
+    for (int i = 0; i < profile->counter_count; i++) profile->counts[i] = -1;
+    return profile;
+}
+
+void profile_free(Profile *profile) {
+    if (profile) {
+        free(profile->functions);
+        free(profile->counts);
+        free(profile);
+    }
+}
+
+static unsigned long read_quad(const unsigned char *p) {
+    unsigned long value = 0;
+    for (int i = 7; i >= 0; i--) value = (value << 8) | p[i];
+    return value;
+}
+
+bool profile_load(Profile *profile, const char *path, char *error, int error_size) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        snprintf(error, error_size, "cannot open %s", path);
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char *data = malloc(size > 0 ? size : 1);
+    if (!data) {
+        fclose(file);
+        snprintf(error, error_size, "out of memory reading %s", path);
+        return false;
+    }
+    size_t read_size = fread(data, 1, size, file);
+    fclose(file);
+
+    unsigned long function_count = 0;
+    unsigned long counter_count = 0;
+    bool valid = read_size == (size_t)size && size >= PROFILE_HEADER_SIZE &&
+                 memcmp(data, PROFILE_MAGIC, 8) == 0;
+    if (valid) {
+        function_count = read_quad(data + 8);
+        counter_count = read_quad(data + 16);
+        valid = function_count <= (unsigned long)size / PROFILE_RECORD_SIZE &&
+                counter_count <= (unsigned long)size / 8 &&
+                (unsigned long)size == PROFILE_HEADER_SIZE +
+                                       function_count * PROFILE_RECORD_SIZE +
+                                       counter_count * 8;
+    }
+    if (!valid) {
+        free(data);
+        snprintf(error, error_size, "%s is not a profile written by this compiler", path);
+        return false;
+    }
+
+    const unsigned char *records = data + PROFILE_HEADER_SIZE;
+    const unsigned char *counters = records + function_count * PROFILE_RECORD_SIZE;
+    unsigned long first = 0;
+
+    for (unsigned long f = 0; f < function_count; f++) {
+        const unsigned char *record = records + f * PROFILE_RECORD_SIZE;
+        unsigned long name_hash = read_quad(record);
+        unsigned long checksum = read_quad(record + 8);
+        unsigned long count = read_quad(record + 16);
+        if (count > counter_count - first) break;
+
+        // Only functions that kept their shape can use their old counts
+        for (int i = 0; i < profile->function_count; i++) {
+            ProfileFunction *current = &profile->functions[i];
+            if (current->matched || current->name_hash != name_hash ||
+                current->checksum != checksum || (unsigned long)current->count != count) {
+                continue;
+            }
+            for (unsigned long c = 0; c < count; c++) {
+                unsigned long value = read_quad(counters + (first + c) * 8);
+                long measured = value > LONG_MAX ? LONG_MAX : (long)value;
+                profile->counts[current->first + c] = measured;
+                if (measured > profile->max_count) profile->max_count = measured;
+            }
+            current->matched = true;
+            break;
+        }
+        first += count;
+    }
+
+    free(data);
+    return true;
+}
+
+int profile_matched_count(const Profile *profile) {
+    int matched = 0;
+    for (int i = 0; i < profile->function_count; i++) {
+        if (profile->functions[i].matched) matched++;
+    }
+    return matched;
+}
+
+long profile_count(const Profile *profile, const ASTNode *node, int counter) {
+    if (!profile || !node || !node->profile_id) return -1;
+
+    int index = node->profile_id - 1 + counter;
+    if (index < 0 || index >= profile->counter_count) return -1;
+    return profile->counts[index];
+}
+
+void profile_emit(const Profile *profile, CodeGenerator *gen, const char *path) {
+    codegen_emit(gen, "\t.section .data");
+    codegen_emit(gen, "\t.p2align 3");
+    codegen_emit(gen, "__profile_data:");
+    codegen_emit(gen, "\t.ascii \"%s\"", PROFILE_MAGIC);
+    codegen_emit(gen, "\t.quad %d", profile->function_count);
+    codegen_emit(gen, "\t.quad %d", profile->counter_count);
+    for (int i = 0; i < profile->function_count; i++) {
+        const ProfileFunction *record = &profile->functions[i];
+        codegen_emit(gen, "\t.quad 0x%lx", record->name_hash);
+        codegen_emit(gen, "\t.quad 0x%lx", record->checksum);
+        codegen_emit(gen, "\t.quad %d", record->count);
+    }
+    codegen_emit(gen, "__profile_counters:");
+    codegen_emit(gen, "\t.zero %d", profile->counter_count * 8);
+    codegen_emit(gen, "__profile_end:");
+
+    char escaped[200];
+    int n = 0;
+    for (const char *p = path; *p && n < (int)sizeof(escaped) - 2; p++) {
+        if (*p == '"' || *p == '\\') escaped[n++] = '\\';
+        escaped[n++] = *p;
+    }
+    escaped[n] = '\0';
+    codegen_emit(gen, "__profile_path:");
+    codegen_emit(gen, "\t.asciz \"%s\"", escaped);
+
+    // Overwrite the profile file with the counters of this run
+    codegen_emit(gen, "\t.section .text");
+    codegen_emit(gen, "\t.type __profile_dump, @function");
+    codegen_emit(gen, "__profile_dump:");
+    codegen_emit(gen, "\tmovq $2, %%rax");              // sys_open
+    codegen_emit(gen, "\tleaq __profile_path(%%rip), %%rdi");
+    codegen_emit(gen, "\tmovq $577, %%rsi");            // O_WRONLY | O_CREAT | O_TRUNC
+    codegen_emit(gen, "\tmovq $420, %%rdx");            // 0644
+    codegen_emit(gen, "\tsyscall");
+    codegen_emit(gen, "\ttestq %%rax, %%rax");
+    codegen_emit(gen, "\tjs .Lprofile_done");
+    codegen_emit(gen, "\tpushq %%rax");
+    codegen_emit(gen, "\tmovq %%rax, %%rdi");
+    codegen_emit(gen, "\tmovq $1, %%rax");              // sys_write
+    codegen_emit(gen, "\tleaq __profile_data(%%rip), %%rsi");
+    codegen_emit(gen, "\tmovq $__profile_end-__profile_data, %%rdx");
+    codegen_emit(gen, "\tsyscall");
+    codegen_emit(gen, "\tpopq %%rdi");
+    codegen_emit(gen, "\tmovq $3, %%rax");              // sys_close
+    codegen_emit(gen, "\tsyscall");
+    codegen_emit(gen, ".Lprofile_done:");
+    codegen_emit(gen, "\tret");
+    codegen_emit(gen, "\t.size __profile_dump, .-__profile_dump");
+}
\ No newline at end of file
@@ -0,0 +1,287 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <switch.h>
+
+typedef struct {
+    long value;
+    int label;           // Start of the case in the body
+} SwitchCase;
+
+typedef enum {
+    CLUSTER_RANGE,       // Consecutive values, all with the same target
+    CLUSTER_TABLE,
+    CLUSTER_BITS
+} ClusterKind;
+
+typedef struct {
+    ClusterKind kind;
+    long low;            // Smallest and largest case value in the cluster
+    long high;
+    int first;           // Its cases, a run of the sorted case array
+    int count;
+} Cluster;
+
+typedef struct {
+    CodeGenerator *gen;
+    SwitchCase *cases;   // Sorted by value
+    int case_count;
+    Cluster *clusters;
+    int cluster_count;
+    int default_label;
+} Switch;
+
+static int compare_cases(const void *a, const void *b) {
+    long x = ((const SwitchCase *)a)->value;
+    long y = ((const SwitchCase *)b)->value;
+    return x < y ? -1 : x > y;
+}
+
+static int distinct_targets(Switch *sw, int first, int last) {
+    int count = 0;
+    for (int i = first; i <= last; i++) {
+        bool seen = false;
+        for (int j = first; j < i && !seen; j++) {
+            seen = sw->cases[j].label == sw->cases[i].label;
+        }
+        if (!seen) count++;
+    }
+    return count;
+}
+
+// Bit tests pay off once they replace enough compare-and-branch pairs
+static bool bit_tests_profitable(int cases, int targets) {
+    return (targets == 1 && cases >= 3) ||
+           (targets == 2 && cases >= 5) ||
+           (targets == 3 && cases >= 6);
+}
+
+// Greedily cover the sorted cases with clusters, preferring the largest
+// jump table that starts at each case, then the largest bit-test set
+static bool build_clusters(Switch *sw) {
+    sw->clusters = malloc(sizeof(Cluster) * (sw->case_count + 1));
+    if (!sw->clusters) return false;
+
+    SwitchCase *cases = sw->cases;
+    int i = 0;
+    while (i < sw->case_count) {
+        Cluster cluster = {CLUSTER_RANGE, cases[i].value, cases[i].value, i, 1};
+
+        for (int j = i + SWITCH_MIN_TABLE_CASES - 1; j < sw->case_count; j++) {
+            long range = cases[j].value - cases[i].value + 1;
+            if (range > SWITCH_MAX_TABLE_SIZE) break;
+            if ((j - i + 1) * 100L >= range * SWITCH_MIN_TABLE_DENSITY) {
+                cluster = (Cluster){CLUSTER_TABLE, cases[i].value, cases[j].value, i, j - i + 1};
+            }
+        }
+
+        if (cluster.kind == CLUSTER_RANGE) {
+            for (int j = i + 1; j < sw->case_count; j++) {
+                if (cases[j].value - cases[i].value >= SWITCH_BIT_TEST_WIDTH) break;
+                int targets = distinct_targets(sw, i, j);
+                if (targets > SWITCH_MAX_BIT_TESTS) break;
+                if (bit_tests_profitable(j - i + 1, targets)) {
+                    cluster = (Cluster){CLUSTER_BITS, cases[i].value, cases[j].value, i, j - i + 1};
+                }
+            }
+        }
+
+        if (cluster.kind == CLUSTER_RANGE) {
+            while (i + cluster.count < sw->case_count) {
+                SwitchCase *next = &cases[i + cluster.count];
+                if (next->value != cluster.high + 1 || next->label != cases[i].label) break;
+                cluster.high++;
+                cluster.count++;
+            }
+        }
+
+        sw->clusters[sw->cluster_count++] = cluster;
+        i += cluster.count;
+    }
+    return true;
+}
+
+// %rcx = %rax - low, the index of the value within a cluster
+static void emit_rebase(CodeGenerator *gen, long low) {
+    if (low == 0) {
+        codegen_emit(gen, "\tmovq %%rax, %%rcx");
+    } else if (-low <= INT_MAX) {
+        codegen_emit(gen, "\tleaq %ld(%%rax), %%rcx", -low);
+    } else {
+        codegen_emit(gen, "\tmovq %%rax, %%rcx");
+        codegen_emit(gen, "\tsubq $%ld, %%rcx", low);
+    }
+}
+
+// Jump to the target of the value if it lies in the cluster, otherwise fall
+// through. min and max bound the values that can reach this point.
+static void emit_cluster(Switch *sw, Cluster *cluster, long min, long max) {
+    CodeGenerator *gen = sw->gen;
+    SwitchCase *cases = &sw->cases[cluster->first];
+    bool covers = min >= cluster->low && max <= cluster->high;
+    long span = cluster->high - cluster->low;
+
+    if (cluster->kind == CLUSTER_RANGE) {
+        if (covers) {
+            codegen_emit_jump(gen, "jmp", cases[0].label);
+        } else if (span == 0) {
+            codegen_emit(gen, "\tcmpq $%ld, %%rax", cluster->low);
+            codegen_emit_jump(gen, "je", cases[0].label);
+        } else {
+            emit_rebase(gen, cluster->low);
+            codegen_emit(gen, "\tcmpq $%ld, %%rcx", span);
+            codegen_emit_jump(gen, "jbe", cases[0].label);
+        }
+        return;
+    }
+
+    // Values inside the cluster that are not cases go to the default
+    int miss_label = codegen_new_label(gen);
+    emit_rebase(gen, cluster->low);
+    if (!covers) {
+        codegen_emit(gen, "\tcmpq $%ld, %%rcx", span);
+        codegen_emit_jump(gen, "ja", miss_label);
+    }
+
+    if (cluster->kind == CLUSTER_TABLE) {
+        // Entries are offsets from the table, so the code stays
+        // position-independent
+        int table_label = codegen_new_label(gen);
+        char line[64];
+        char *end = line + sizeof(line);
+        insn_list_append(gen->rodata, "\t.p2align 2");
+        output_char(output_label(line, end, table_label), end, ':');
+        insn_list_append(gen->rodata, line);
+
+        int next = 0;
+        for (long value = cluster->low; value <= cluster->high; value++) {
+            int target = sw->default_label;
+            if (next < cluster->count && cases[next].value == value) target = cases[next++].label;
+            char *p = output_label(output_text(line, end, "\t.long "), end, target);
+            output_label(output_char(p, end, '-'), end, table_label);
+            insn_list_append(gen->rodata, line);
+        }
+
+        codegen_emit(gen, "\tleaq .L%d(%%rip), %%rdx", table_label);
+        codegen_emit(gen, "\tmovslq (%%rdx,%%rcx,4), %%rcx");
+        codegen_emit(gen, "\taddq %%rdx, %%rcx");
+        output_label(line, end, sw->default_label);
+        codegen_emit(gen, INSN_TABLE_TARGET_FORMAT, line);
+        for (int i = 0; i < cluster->count; i++) {
+            bool listed = false;
+            for (int j = 0; j < i && !listed; j++) {
+                listed = cases[j].label == cases[i].label;
+            }
+            if (listed) continue;
+            output_label(line, end, cases[i].label);
+            codegen_emit(gen, INSN_TABLE_TARGET_FORMAT, line);
+        }
+        codegen_emit(gen, "\tjmp *%%rcx");
+    } else {
+        // One mask per target, with a bit set for each of its values
+        for (int i = 0; i < cluster->count; i++) {
+            bool tested = false;
+            for (int j = 0; j < i && !tested; j++) {
+                tested = cases[j].label == cases[i].label;
+            }
+            if (tested) continue;
+
+            unsigned long mask = 0;
+            for (int j = i; j < cluster->count; j++) {
+                if (cases[j].label == cases[i].label) {
+                    mask |= 1UL << (cases[j].value - cluster->low);
+                }
+            }
+            if (mask <= INT_MAX) {
+                codegen_emit(gen, "\tmovq $%lu, %%rdx", mask);
+            } else {
+                codegen_emit(gen, "\tmovabsq $%lu, %%rdx", mask);
+            }
+            codegen_emit(gen, "\tbtq %%rcx, %%rdx");
+            codegen_emit_jump(gen, "jc", cases[i].label);
+        }
+        codegen_emit_jump(gen, "jmp", sw->default_label);
+    }
+
+    codegen_emit_label(gen, miss_label);
+}
+
+// Binary search over clusters first..last for the value in %rax, known to
+// lie within min..max
+static void emit_search(Switch *sw, int first, int last, long min, long max) {
+    CodeGenerator *gen = sw->gen;
+
+    if (last - first + 1 <= SWITCH_LINEAR_CLUSTERS) {
+        for (int c = first; c <= last; c++) emit_cluster(sw, &sw->clusters[c], min, max);
+        codegen_emit_jump(gen, "jmp", sw->default_label);
+        return;
+    }
+
+    int middle = (first + last + 1) / 2;
+    long pivot = sw->clusters[middle].low;
+    int upper_label = codegen_new_label(gen);
+
+    codegen_emit(gen, "\tcmpq $%ld, %%rax", pivot);
+    codegen_emit_jump(gen, "jge", upper_label);
+    emit_search(sw, first, middle - 1, min, pivot - 1);
+    codegen_emit_label(gen, upper_label);
+    emit_search(sw, middle, last, pivot, max);
+}
+
+void codegen_switch(CodeGenerator *gen, ASTNode *node) {
+    ASTNode *body = node->data.switch_stmt.body;
+    int statement_count = body->data.block.statement_count;
+    int *labels = malloc(sizeof(int) * (statement_count + 1));   // -1 for statements
+    Switch sw = {gen, malloc(sizeof(SwitchCase) * (statement_count + 1)), 0, NULL, 0, -1};
+    int end_label = codegen_new_label(gen);
+    int saved_break = gen->break_label;
+
+    if (!labels || !sw.cases) {
+        free(labels);
+        free(sw.cases);
+        return;
+    }
+
+    sw.default_label = end_label;
+    for (int i = 0; i < statement_count; i++) {
+        ASTNode *statement = body->data.block.statements[i];
+        labels[i] = -1;
+        if (statement->type != NODE_CASE) continue;
+
+        // Adjacent labels start the same code, so they share a target
+        labels[i] = i > 0 && labels[i - 1] >= 0 ? labels[i - 1] : codegen_new_label(gen);
+        if (statement->data.case_label.is_default) {
+            sw.default_label = labels[i];
+        } else {
+            sw.cases[sw.case_count++] = (SwitchCase){statement->data.case_label.value, labels[i]};
+        }
+    }
+    qsort(sw.cases, sw.case_count, sizeof(SwitchCase), compare_cases);
+
+    // Cases are compared in 64 bits. The checker stores the cases of a
+    // 32-bit switch sign-extended, unsigned ones too, so the value is
+    // sign-extended to match.
+    codegen_expression(gen, node->data.switch_stmt.value);
+    if (type_size(node->data.switch_stmt.value->value_type) <= 4) {
+        codegen_emit(gen, "\tmovslq %%eax, %%rax");
+    }
+    if (build_clusters(&sw)) {
+        emit_search(&sw, 0, sw.cluster_count - 1, LONG_MIN, LONG_MAX);
+    }
+
+    gen->break_label = end_label;
+    for (int i = 0; i < statement_count; i++) {
+        if (labels[i] >= 0) {
+            if (i == 0 || labels[i] != labels[i - 1]) codegen_emit_label(gen, labels[i]);
+        } else {
+            codegen_statement(gen, body->data.block.statements[i]);
+        }
+    }
+    gen->break_label = saved_break;
+    codegen_emit_label(gen, end_label);
+
+    free(labels);
+    free(sw.cases);
+    free(sw.clusters);
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include <string.h>
+#include <target.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+static const char *tier_names[TARGET_TIER_COUNT] = {"x86-64", "x86-64-v2", "x86-64-v3"};
+static const unsigned tier_features[TARGET_TIER_COUNT] = {0, TARGET_V2_FEATURES, TARGET_V3_FEATURES};
+
+// Extensions and tier of the CPU the compiler runs on. Only the
+// extensions that mark a tier, or that the code generator uses, are
+// looked at: v2 for SSE4.2 and POPCNT, v3 for AVX2. AVX2 also needs the
+// operating system to save the upper halves of the vector registers on
+// context switches, which it reports in XCR0.
+static void native_target(Target *target) {
+    target->tier = TARGET_X86_64;
+    target->features = 0;
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned eax, ebx, ecx, edx;
+    bool os_saves_ymm = false;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        if (ecx & (1u << 19)) target->features |= TARGET_SSE4_1;
+        bool sse4_2 = ecx & (1u << 20), popcnt = ecx & (1u << 23);
+        if ((target->features & TARGET_SSE4_1) && sse4_2 && popcnt) target->tier = TARGET_X86_64_V2;
+
+        if (ecx & (1u << 27)) {   // OSXSAVE: xgetbv is available
+            unsigned xcr0_low, xcr0_high;
+            __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+            os_saves_ymm = (ecx & (1u << 28)) && (xcr0_low & 6) == 6;
+        }
+    }
+    if (os_saves_ymm && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1u << 5))) {
+        target->features |= TARGET_AVX2;
+        if (target->tier == TARGET_X86_64_V2) target->tier = TARGET_X86_64_V3;
+    }
+#endif
+}
+
+bool target_parse(const char *name, Target *target) {
+    if (strcmp(name, "native") == 0) {
+        native_target(target);
+        return true;
+    }
+    for (int tier = 0; tier < TARGET_TIER_COUNT; tier++) {
+        if (strcmp(name, tier_names[tier]) == 0) {
+            target->tier = (TargetTier)tier;
+            target->features = tier_features[tier];
+            return true;
+        }
+    }
+    return false;
+}
\ No newline at end of file
@@ -39,6 +39,11 @@ const char *token_type_to_string(TokenType type) {
         case TOKEN_WHILE: return "WHILE";
         case TOKEN_FOR: return "FOR";
         case TOKEN_VOID: return "VOID";
+        case TOKEN_CHAR_TYPE: return "CHAR_TYPE";
+        case TOKEN_SHORT: return "SHORT";
+        case TOKEN_LONG: return "LONG";
+        case TOKEN_SIGNED: return "SIGNED";
+        case TOKEN_UNSIGNED: return "UNSIGNED";
         case TOKEN_IDENTIFIER: return "IDENTIFIER";
         case TOKEN_NUMBER: return "NUMBER";
         case TOKEN_STRING: return "STRING";
@@ -0,0 +1,61 @@
+#include <type.h>
+
+static const char *type_names[] = {
+    "char", "unsigned char", "short", "unsigned short",
+    "int", "unsigned int", "long", "unsigned long", "void"
+};
+
+int type_size(TypeKind type) {
+    switch (type) {
+        case TYPE_CHAR:
+        case TYPE_UCHAR:  return 1;
+        case TYPE_SHORT:
+        case TYPE_USHORT: return 2;
+        case TYPE_INT:
+        case TYPE_UINT:   return 4;
+        case TYPE_LONG:
+        case TYPE_ULONG:  return 8;
+        default:          return 0;
+    }
+}
+
+bool type_is_signed(TypeKind type) {
+    return type == TYPE_CHAR || type == TYPE_SHORT || type == TYPE_INT || type == TYPE_LONG;
+}
+
+const char *type_name(TypeKind type) {
+    return type_names[type];
+}
+
+char type_suffix(TypeKind type) {
+    switch (type_size(type)) {
+        case 1:  return 'b';
+        case 2:  return 'w';
+        case 4:  return 'l';
+        default: return 'q';
+    }
+}
+
+TypeKind type_promote(TypeKind type) {
+    return type_size(type) < 4 ? TYPE_INT : type;
+}
+
+TypeKind type_common(TypeKind a, TypeKind b) {
+    a = type_promote(a);
+    b = type_promote(b);
+    if (type_size(a) != type_size(b)) return type_size(a) > type_size(b) ? a : b;
+    // Same size: unsigned wins
+    return type_is_signed(a) ? b : a;
+}
+
+long type_convert(long value, TypeKind type) {
+    switch (type) {
+        case TYPE_CHAR:   return (signed char)value;
+        case TYPE_UCHAR:  return (unsigned char)value;
+        case TYPE_SHORT:  return (short)value;
+        case TYPE_USHORT: return (unsigned short)value;
+        case TYPE_INT:    return (int)value;
+        case TYPE_UINT:   return (unsigned int)value;
+        default:          return value;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,319 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <typecheck.h>
+#include <fold.h>
+
+typedef struct {
+    ASTNode *program;
+    ASTNode *function;   // Function being checked, or NULL
+    ASTNode *global;     // Else the global whose initializer is checked
+    int errors;
+} Checker;
+
+static void check_error(Checker *checker, const char *message) {
+    if (checker->function) {
+        fprintf(stderr, "Error in function %s: %s\n", checker->function->data.function.name, message);
+    } else {
+        fprintf(stderr, "Error in global %s: %s\n", checker->global->data.global.name, message);
+    }
+    checker->errors++;
+}
+
+static ASTNode *find_function(Checker *checker, const char *name) {
+    for (int i = 0; i < checker->program->data.program.function_count; i++) {
+        ASTNode *function = checker->program->data.program.functions[i];
+        if (strcmp(function->data.function.name, name) == 0) return function;
+    }
+    return NULL;
+}
+
+static ASTNode *find_global(Checker *checker, const char *name) {
+    for (int i = 0; i < checker->program->data.program.global_count; i++) {
+        ASTNode *global = checker->program->data.program.globals[i];
+        if (strcmp(global->data.global.name, name) == 0) return global;
+    }
+    return NULL;
+}
+
+// Optimizations tell variables apart by name, so a local may not take the
+// name of a global, even one declared after the function
+static void check_local(Checker *checker, const ASTNode *variable) {
+    if (!variable->data.variable.is_global && find_global(checker, variable->data.variable.name)) {
+        check_error(checker, "Local variable has the name of a global");
+    }
+}
+
+// Convert the expression in slot to type
+static void convert(ASTNode **slot, TypeKind type) {
+    ASTNode *node = *slot;
+    if (node->value_type == type) return;
+
+    if (node->type == NODE_NUMBER) {
+        node->data.number.value = type_convert(node->data.number.value, type);
+        node->value_type = type;
+        return;
+    }
+    ASTNode *cast = ast_create_cast(type, node);
+    if (cast) *slot = cast;
+}
+
+static void check_expression(Checker *checker, ASTNode **slot);
+
+// An expression whose value is used, which a void call does not have
+static void check_value(Checker *checker, ASTNode **slot) {
+    check_expression(checker, slot);
+    if ((*slot)->value_type == TYPE_VOID) check_error(checker, "Void value used in an expression");
+}
+
+static bool is_comparison(char operator) {
+    return strchr("<>GLEN", operator) != NULL;
+}
+
+static void check_call(Checker *checker, ASTNode *node) {
+    ASTNode *callee = find_function(checker, node->data.call.name);
+    bool typed = callee && callee->data.function.param_count == node->data.call.arg_count;
+
+    for (int i = 0; i < node->data.call.arg_count; i++) {
+        ASTNode **arg = &node->data.call.args[i];
+        check_value(checker, arg);
+        if (typed) {
+            convert(arg, callee->data.function.param_types[i]);
+        } else {
+            // Functions outside the program get promoted arguments
+            convert(arg, type_promote((*arg)->value_type));
+        }
+    }
+    node->value_type = callee ? callee->data.function.return_type : TYPE_INT;
+}
+
+static void check_expression(Checker *checker, ASTNode **slot) {
+    ASTNode *node = *slot;
+
+    switch (node->type) {
+        case NODE_BINARY_OP: {
+            char operator = node->data.binary_op.operator;
+            ASTNode **left = &node->data.binary_op.left;
+            ASTNode **right = &node->data.binary_op.right;
+
+            if (operator == '=') {
+                if ((*left)->type == NODE_INDEX) {
+                    check_expression(checker, left);
+                } else {
+                    check_local(checker, *left);
+                }
+                check_value(checker, right);
+                convert(right, (*left)->value_type);
+                node->value_type = (*left)->value_type;
+                break;
+            }
+
+            check_value(checker, left);
+            check_value(checker, right);
+            if (operator == 'A' || operator == 'O') {
+                node->value_type = TYPE_INT;
+                break;
+            }
+
+            TypeKind common = type_common((*left)->value_type, (*right)->value_type);
+            convert(left, common);
+            convert(right, common);
+            node->value_type = is_comparison(operator) ? TYPE_INT : common;
+            break;
+        }
+
+        case NODE_UNARY_OP: {
+            ASTNode **operand = &node->data.unary_op.operand;
+            check_value(checker, operand);
+            if (node->data.unary_op.operator != 'C') {
+                node->value_type = TYPE_INT;
+                break;
+            }
+
+            // A cast to the type the operand already has does nothing
+            TypeKind type = node->value_type;
+            if ((*operand)->value_type == type || (*operand)->type == NODE_NUMBER) {
+                convert(operand, type);
+                *slot = *operand;
+                node->data.unary_op.operand = NULL;
+                ast_free(node);
+            }
+            break;
+        }
+
+        case NODE_CALL:
+            check_call(checker, node);
+            break;
+
+        case NODE_INDEX:
+            // Elements are addressed with a 64-bit index
+            check_local(checker, node->data.index.array);
+            check_value(checker, &node->data.index.index);
+            convert(&node->data.index.index, TYPE_LONG);
+            break;
+
+        case NODE_CHAR: {
+            // A character constant is an int
+            ASTNode *number = ast_create_number(node->data.char_literal.value);
+            if (!number) break;
+            *slot = number;
+            ast_free(node);
+            break;
+        }
+
+        default:
+            // Numbers, strings and variables were typed by the parser
+            break;
+    }
+}
+
+static void check_statement(Checker *checker, ASTNode **slot);
+
+static void check_block(Checker *checker, ASTNode *block) {
+    if (!block) return;
+    for (int i = 0; i < block->data.block.statement_count; i++) {
+        check_statement(checker, &block->data.block.statements[i]);
+    }
+}
+
+// The value is promoted, and each case converted to its type. The cases
+// of a 32-bit switch are then stored sign-extended, and those of a 64-bit
+// one must fit 32 bits, to be compared against immediates.
+static void check_switch(Checker *checker, ASTNode *node) {
+    ASTNode **value = &node->data.switch_stmt.value;
+    check_value(checker, value);
+    convert(value, type_promote((*value)->value_type));
+
+    TypeKind type = (*value)->value_type;
+    ASTNode *body = node->data.switch_stmt.body;
+    for (int i = 0; i < body->data.block.statement_count; i++) {
+        ASTNode *label = body->data.block.statements[i];
+        if (label->type != NODE_CASE || label->data.case_label.is_default) continue;
+
+        long case_value = type_convert(label->data.case_label.value, type);
+        if (type_size(type) <= 4) {
+            case_value = type_convert(case_value, TYPE_INT);
+        } else if (case_value < INT_MIN || case_value > INT_MAX) {
+            check_error(checker, "Case value of a long switch does not fit 32 bits");
+        }
+        label->data.case_label.value = case_value;
+
+        for (int j = 0; j < i; j++) {
+            ASTNode *other = body->data.block.statements[j];
+            if (other->type == NODE_CASE && !other->data.case_label.is_default &&
+                other->data.case_label.value == case_value) {
+                check_error(checker, "Duplicate case value");
+            }
+        }
+    }
+    check_block(checker, body);
+}
+
+static void check_statement(Checker *checker, ASTNode **slot) {
+    ASTNode *node = *slot;
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            check_block(checker, node);
+            break;
+
+        case NODE_RETURN: {
+            ASTNode **value = &node->data.return_stmt.expression;
+            TypeKind type = checker->function->data.function.return_type;
+            if (type == TYPE_VOID) {
+                check_expression(checker, value);
+            } else {
+                check_value(checker, value);
+                convert(value, type);
+            }
+            break;
+        }
+
+        case NODE_IF:
+            check_value(checker, &node->data.if_stmt.condition);
+            check_block(checker, node->data.if_stmt.then_branch);
+            check_block(checker, node->data.if_stmt.else_branch);
+            break;
+
+        case NODE_WHILE:
+            check_value(checker, &node->data.while_stmt.condition);
+            check_block(checker, node->data.while_stmt.body);
+            break;
+
+        case NODE_FOR:
+            check_statement(checker, &node->data.for_stmt.init);
+            if (node->data.for_stmt.condition) check_value(checker, &node->data.for_stmt.condition);
+            check_statement(checker, &node->data.for_stmt.step);
+            check_block(checker, node->data.for_stmt.body);
+            break;
+
+        case NODE_SWITCH:
+            check_switch(checker, node);
+            break;
+
+        case NODE_VARIABLE:
+            check_local(checker, node);
+            break;
+
+        case NODE_CASE:
+        case NODE_BREAK:
+            break;
+
+        default:
+            // Assignments and calls, whose value is dropped
+            check_expression(checker, slot);
+            break;
+    }
+}
+
+// The initializer is computed at compile time: a constant converted to the
+// type of the global, or a string, whose address needs 64 bits
+static void check_global(Checker *checker, ASTNode *global) {
+    if (find_function(checker, global->data.global.name)) {
+        check_error(checker, "Global variable has the name of a function");
+    }
+
+    ASTNode **init = &global->data.global.init;
+    if (!*init) return;
+    check_value(checker, init);
+    if ((*init)->type == NODE_STRING) {
+        if (type_size(global->value_type) != 8) {
+            check_error(checker, "String stored in a global narrower than 64 bits");
+        }
+        return;
+    }
+
+    long value;
+    convert(init, global->value_type);
+    if (!fold_constant(*init, &value)) {
+        check_error(checker, "Initializer is not a constant");
+        return;
+    }
+    ASTNode *number = ast_create_number(value);
+    if (!number) return;
+    number->value_type = global->value_type;
+    ast_free(*init);
+    *init = number;
+}
+
+bool typecheck_program(ASTNode *program) {
+    Checker checker = {program, NULL, NULL, 0};
+    for (int i = 0; i < program->data.program.global_count; i++) {
+        checker.global = program->data.program.globals[i];
+        check_global(&checker, checker.global);
+    }
+
+    for (int i = 0; i < program->data.program.function_count; i++) {
+        ASTNode *function = program->data.program.functions[i];
+        checker.function = function;
+        for (int p = 0; p < function->data.function.param_count; p++) {
+            if (find_global(&checker, function->data.function.params[p])) {
+                check_error(&checker, "Parameter has the name of a global");
+            }
+        }
+        check_block(&checker, function->data.function.body);
+    }
+    return checker.errors == 0;
+}
\ No newline at end of file
@@ -0,0 +1,836 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <fold.h>
+#include <inliner.h>
+#include <unroll.h>
+
+static int temp_count = 0;
+
+// A loop whose exit test compares a basic induction variable against a
+// limit the loop never changes: while (name op limit) { ...; name = name + step; }
+typedef struct {
+    ASTNode *loop;
+    ASTNode *condition;
+    ASTNode *body;
+    ASTNode *step_statement;   // Last statement of a while body, or the for step
+    const char *name;
+    TypeKind type;
+    char op;                   // < L > G, with the variable on the left
+    ASTNode *limit;
+    long step;
+} CountedLoop;
+
+// An i * k of the loop body kept in a temporary instead
+typedef struct {
+    ASTNode *product;          // The first occurrence, for comparing the others
+    char name[32];
+} Reduction;
+
+typedef struct {
+    Reduction *reductions;
+    int count;
+} ReductionSet;
+
+typedef struct {
+    ASTNode **statements;
+    int count;
+} StatementList;
+
+static bool list_add(StatementList *list, ASTNode *statement) {
+    if (!statement) return false;
+
+    void *temp = realloc(list->statements, sizeof(ASTNode *) * (list->count + 1));
+    if (!temp) {
+        ast_free(statement);
+        return false;
+    }
+    list->statements = temp;
+    list->statements[list->count++] = statement;
+    return true;
+}
+
+static void list_free(StatementList *list) {
+    for (int i = 0; i < list->count; i++) ast_free(list->statements[i]);
+    free(list->statements);
+}
+
+// Block owning the statements of list
+static ASTNode *list_to_block(StatementList *list) {
+    ASTNode *block = ast_create_block();
+    if (!block) {
+        list_free(list);
+        return NULL;
+    }
+    block->data.block.statements = list->statements;
+    block->data.block.statement_count = list->count;
+    return block;
+}
+
+// Replace the statement at index by count statements, or insert them in
+// front of it when replace is false
+static bool block_splice(ASTNode *block, int index, bool replace, ASTNode **statements, int count) {
+    int removed = replace ? 1 : 0;
+    int total = block->data.block.statement_count + count - removed;
+    if (count > removed) {
+        void *temp = realloc(block->data.block.statements, sizeof(ASTNode *) * total);
+        if (!temp) return false;
+        block->data.block.statements = temp;
+    }
+
+    if (replace) ast_free(block->data.block.statements[index]);
+    memmove(&block->data.block.statements[index + count],
+            &block->data.block.statements[index + removed],
+            sizeof(ASTNode *) * (block->data.block.statement_count - index - removed));
+    memcpy(&block->data.block.statements[index], statements, sizeof(ASTNode *) * count);
+    block->data.block.statement_count = total;
+    return true;
+}
+
+static ASTNode *typed_number(long value, TypeKind type) {
+    ASTNode *node = ast_create_number(type_convert(value, type));
+    if (node) node->value_type = type;
+    return node;
+}
+
+static ASTNode *typed_variable(const char *name, TypeKind type) {
+    ASTNode *node = ast_create_variable(name);
+    if (node) node->value_type = type;
+    return node;
+}
+
+static ASTNode *to_unsigned_long(ASTNode *node) {
+    if (!node || node->value_type == TYPE_ULONG) return node;
+    if (node->type == NODE_NUMBER) {
+        // Already sign- or zero-extended to 64 bits as the conversion would
+        node->value_type = TYPE_ULONG;
+        return node;
+    }
+    return ast_create_cast(TYPE_ULONG, node);
+}
+
+// Assignments and declarations of name among the statements of node
+static int count_assignments(const ASTNode *node, const char *name) {
+    if (!node) return 0;
+
+    switch (node->type) {
+        case NODE_BLOCK: {
+            int count = 0;
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                count += count_assignments(node->data.block.statements[i], name);
+            }
+            return count;
+        }
+        case NODE_IF:
+            return count_assignments(node->data.if_stmt.then_branch, name) +
+                   count_assignments(node->data.if_stmt.else_branch, name);
+        case NODE_WHILE:
+            return count_assignments(node->data.while_stmt.body, name);
+        case NODE_FOR:
+            return count_assignments(node->data.for_stmt.init, name) +
+                   count_assignments(node->data.for_stmt.step, name) +
+                   count_assignments(node->data.for_stmt.body, name);
+        case NODE_SWITCH:
+            return count_assignments(node->data.switch_stmt.body, name);
+        case NODE_VECTOR:
+            return count_assignments(node->data.vector.loop, name);
+        case NODE_BINARY_OP: {
+            // A store to an element assigns the array
+            const ASTNode *target = node->data.binary_op.left;
+            if (target->type == NODE_INDEX) target = target->data.index.array;
+            return node->data.binary_op.operator == '=' &&
+                   strcmp(target->data.variable.name, name) == 0;
+        }
+        case NODE_VARIABLE:
+            return strcmp(node->data.variable.name, name) == 0;
+        default:
+            return 0;
+    }
+}
+
+// Pure, non-trapping and computed only from values the loop never changes
+static bool is_invariant(const ASTNode *node, const ASTNode *loop) {
+    switch (node->type) {
+        case NODE_NUMBER:
+            return true;
+        case NODE_VARIABLE:
+            // A call in the loop may change a global
+            return !node->data.variable.is_global &&
+                   count_assignments(loop, node->data.variable.name) == 0;
+        case NODE_BINARY_OP: {
+            char op = node->data.binary_op.operator;
+            return (op == '+' || op == '-' || op == '*') &&
+                   is_invariant(node->data.binary_op.left, loop) &&
+                   is_invariant(node->data.binary_op.right, loop);
+        }
+        case NODE_UNARY_OP:
+            return node->data.unary_op.operator == 'C' &&
+                   is_invariant(node->data.unary_op.operand, loop);
+        default:
+            return false;
+    }
+}
+
+// Whether a break in node leaves the loop around it
+static bool has_break(const ASTNode *node) {
+    if (!node) return false;
+
+    switch (node->type) {
+        case NODE_BREAK:
+            return true;
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                if (has_break(node->data.block.statements[i])) return true;
+            }
+            return false;
+        case NODE_IF:
+            return has_break(node->data.if_stmt.then_branch) ||
+                   has_break(node->data.if_stmt.else_branch);
+        default:
+            return false;
+    }
+}
+
+static bool contains_loop(const ASTNode *node) {
+    if (!node) return false;
+
+    switch (node->type) {
+        case NODE_WHILE:
+        case NODE_FOR:
+        case NODE_VECTOR:
+            return true;
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                if (contains_loop(node->data.block.statements[i])) return true;
+            }
+            return false;
+        case NODE_IF:
+            return contains_loop(node->data.if_stmt.then_branch) ||
+                   contains_loop(node->data.if_stmt.else_branch);
+        case NODE_SWITCH:
+            return contains_loop(node->data.switch_stmt.body);
+        default:
+            return false;
+    }
+}
+
+// name = name + step or name = name - step, with a literal step
+static bool match_step(const ASTNode *node, const char *name, long *step) {
+    if (!node || node->type != NODE_BINARY_OP || node->data.binary_op.operator != '=') return false;
+    if (node->data.binary_op.left->type != NODE_VARIABLE ||
+        strcmp(node->data.binary_op.left->data.variable.name, name) != 0) {
+        return false;
+    }
+
+    const ASTNode *sum = node->data.binary_op.right;
+    if (sum->type != NODE_BINARY_OP) return false;
+    char op = sum->data.binary_op.operator;
+    const ASTNode *variable = sum->data.binary_op.left;
+    const ASTNode *amount = sum->data.binary_op.right;
+    if ((op != '+' && op != '-') || variable->type != NODE_VARIABLE ||
+        strcmp(variable->data.variable.name, name) != 0 || amount->type != NODE_NUMBER) {
+        return false;
+    }
+
+    long value = amount->data.number.value;
+    if (value == 0 || value == LONG_MIN) return false;
+    *step = op == '-' ? -value : value;
+    return true;
+}
+
+static char mirrored_comparison(char op) {
+    switch (op) {
+        case '<': return '>';
+        case '>': return '<';
+        case 'L': return 'G';
+        case 'G': return 'L';
+        default:  return 0;
+    }
+}
+
+static bool find_counted_loop(ASTNode *loop, CountedLoop *counted) {
+    ASTNode *condition, *body, *step_statement;
+    if (loop->type == NODE_WHILE) {
+        condition = loop->data.while_stmt.condition;
+        body = loop->data.while_stmt.body;
+        if (!body || body->type != NODE_BLOCK || body->data.block.statement_count == 0) return false;
+        step_statement = body->data.block.statements[body->data.block.statement_count - 1];
+    } else if (loop->type == NODE_FOR && !loop->data.for_stmt.init) {
+        condition = loop->data.for_stmt.condition;
+        body = loop->data.for_stmt.body;
+        step_statement = loop->data.for_stmt.step;
+        if (!body || body->type != NODE_BLOCK) return false;
+    } else {
+        return false;
+    }
+    if (!condition || condition->type != NODE_BINARY_OP) return false;
+
+    char op = condition->data.binary_op.operator;
+    ASTNode *variable = condition->data.binary_op.left;
+    ASTNode *limit = condition->data.binary_op.right;
+    if (variable->type != NODE_VARIABLE) {
+        ASTNode *swap = variable; variable = limit; limit = swap;
+        op = mirrored_comparison(op);
+    }
+    if (variable->type != NODE_VARIABLE || variable->data.variable.is_global ||
+        !mirrored_comparison(op)) {
+        return false;
+    }
+    // Narrower variables are stepped in int and converted back
+    if (type_size(variable->value_type) < 4) return false;
+
+    const char *name = variable->data.variable.name;
+    long step;
+    if (!match_step(step_statement, name, &step)) return false;
+    if ((op == '<' || op == 'L') != (step > 0)) return false;
+    if (count_assignments(loop, name) != 1) return false;
+    if (!is_invariant(limit, loop) || has_break(body)) return false;
+
+    *counted = (CountedLoop){loop, condition, body, step_statement, name,
+                             variable->value_type, op, limit, step};
+    return true;
+}
+
+static int body_size(const CountedLoop *counted) {
+    int size = inliner_node_count(counted->body);
+    if (counted->loop->type == NODE_FOR) size += inliner_node_count(counted->step_statement);
+    return size;
+}
+
+// Replace every read of variable name by the literal value
+static void substitute(ASTNode **slot, const char *name, long value, TypeKind type) {
+    ASTNode *node = *slot;
+    if (!node) return;
+
+    switch (node->type) {
+        case NODE_VARIABLE:
+            if (strcmp(node->data.variable.name, name) == 0) {
+                ASTNode *number = typed_number(value, type);
+                if (!number) return;
+                ast_free(node);
+                *slot = number;
+            }
+            break;
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                substitute(&node->data.block.statements[i], name, value, type);
+            }
+            break;
+        case NODE_RETURN:
+            substitute(&node->data.return_stmt.expression, name, value, type);
+            break;
+        case NODE_IF:
+            substitute(&node->data.if_stmt.condition, name, value, type);
+            substitute(&node->data.if_stmt.then_branch, name, value, type);
+            substitute(&node->data.if_stmt.else_branch, name, value, type);
+            break;
+        case NODE_WHILE:
+            substitute(&node->data.while_stmt.condition, name, value, type);
+            substitute(&node->data.while_stmt.body, name, value, type);
+            break;
+        case NODE_FOR:
+            substitute(&node->data.for_stmt.init, name, value, type);
+            substitute(&node->data.for_stmt.condition, name, value, type);
+            substitute(&node->data.for_stmt.step, name, value, type);
+            substitute(&node->data.for_stmt.body, name, value, type);
+            break;
+        case NODE_BINARY_OP:
+            // The loop never assigns name outside its step
+            if (node->data.binary_op.operator != '=' ||
+                node->data.binary_op.left->type == NODE_INDEX) {
+                substitute(&node->data.binary_op.left, name, value, type);
+            }
+            substitute(&node->data.binary_op.right, name, value, type);
+            break;
+        case NODE_UNARY_OP:
+            substitute(&node->data.unary_op.operand, name, value, type);
+            break;
+        case NODE_INDEX:
+            substitute(&node->data.index.index, name, value, type);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                substitute(&node->data.call.args[i], name, value, type);
+            }
+            break;
+        case NODE_INLINE:
+            substitute(&node->data.inline_call.body, name, value, type);
+            break;
+        case NODE_SELECT:
+            substitute(&node->data.select.condition, name, value, type);
+            substitute(&node->data.select.if_true, name, value, type);
+            substitute(&node->data.select.if_false, name, value, type);
+            break;
+        case NODE_SWITCH:
+            substitute(&node->data.switch_stmt.value, name, value, type);
+            substitute(&node->data.switch_stmt.body, name, value, type);
+            break;
+        case NODE_VECTOR:
+            // The vector trips repeat the loop, so both read the same values
+            substitute(&node->data.vector.loop, name, value, type);
+            substitute(&node->data.vector.limit, name, value, type);
+            substitute(&node->data.vector.operation, name, value, type);
+            substitute(&node->data.vector.check, name, value, type);
+            break;
+        default:
+            break;
+    }
+}
+
+// Append the statements of a fresh copy of the loop body, with the step
+// of a while loop left out when without_step is set
+static bool add_body_copy(StatementList *list, const CountedLoop *counted, bool without_step,
+                          bool substituted, long value) {
+    ASTNode *copy = ast_clone(counted->body);
+    if (!copy) return false;
+
+    int count = copy->data.block.statement_count;
+    if (without_step && counted->loop->type == NODE_WHILE) {
+        ast_free(copy->data.block.statements[--count]);
+        copy->data.block.statement_count = count;
+    }
+    if (substituted) substitute(&copy, counted->name, value, counted->type);
+
+    bool ok = true;
+    for (int i = 0; i < count; i++) {
+        if (ok) {
+            ok = list_add(list, copy->data.block.statements[i]);
+        } else {
+            ast_free(copy->data.block.statements[i]);
+        }
+    }
+    free(copy->data.block.statements);
+    copy->data.block.statements = NULL;
+    copy->data.block.statement_count = 0;
+    ast_free(copy);
+
+    if (ok && !without_step && counted->loop->type == NODE_FOR) {
+        ok = list_add(list, ast_clone(counted->step_statement));
+    }
+    return ok;
+}
+
+// The comparison of the exit test, on values of the variable's type
+static bool test_holds(char op, long a, long b, TypeKind type) {
+    int order;
+    if (type_is_signed(type)) {
+        order = (a > b) - (a < b);
+    } else {
+        order = ((unsigned long)a > (unsigned long)b) - ((unsigned long)a < (unsigned long)b);
+    }
+    switch (op) {
+        case '<': return order < 0;
+        case 'L': return order <= 0;
+        case '>': return order > 0;
+        default:  return order >= 0;
+    }
+}
+
+// Value after one step; signed overflow has none
+static bool advance(long *value, long step, TypeKind type) {
+    long next;
+    if (type_is_signed(type)) {
+        if (__builtin_add_overflow(*value, step, &next) || type_convert(next, type) != next) {
+            return false;
+        }
+    } else {
+        next = type_convert((long)((unsigned long)*value + (unsigned long)step), type);
+    }
+    *value = next;
+    return true;
+}
+
+// Replace a loop with a known trip count by a copy of its body per trip.
+// Returns the number of statements that replaced it, 0 if it was kept.
+static int full_unroll(ASTNode *block, int index, const CountedLoop *counted) {
+    if (counted->limit->type != NODE_NUMBER) return 0;
+
+    // The start is a literal assigned in front of the loop, with no case
+    // label in between to enter past it
+    ASTNode *init = NULL;
+    for (int i = index - 1; i >= 0 && !init; i--) {
+        ASTNode *statement = block->data.block.statements[i];
+        if (statement->type == NODE_CASE) return 0;
+        if (count_assignments(statement, counted->name) > 0) init = statement;
+    }
+    if (!init || init->type != NODE_BINARY_OP || init->data.binary_op.operator != '=' ||
+        init->data.binary_op.right->type != NODE_NUMBER) {
+        return 0;
+    }
+
+    long value = init->data.binary_op.right->data.number.value;
+    long limit = counted->limit->data.number.value;
+    long values[UNROLL_FULL_MAX_TRIPS];
+    int trips = 0;
+    while (test_holds(counted->op, value, limit, counted->type)) {
+        if (trips == UNROLL_FULL_MAX_TRIPS) return 0;
+        values[trips++] = value;
+        if (!advance(&value, counted->step, counted->type)) return 0;
+    }
+    if (trips * body_size(counted) > UNROLL_FULL_BUDGET) return 0;
+
+    StatementList list = {NULL, 0};
+    for (int t = 0; t < trips; t++) {
+        if (!add_body_copy(&list, counted, true, true, values[t])) {
+            list_free(&list);
+            return 0;
+        }
+    }
+    // The variable leaves the loop with the value that failed the test
+    ASTNode *final = ast_create_binary_op('=', typed_variable(counted->name, counted->type),
+                                          typed_number(value, counted->type));
+    if (!list_add(&list, final) || !block_splice(block, index, true, list.statements, list.count)) {
+        list_free(&list);
+        return 0;
+    }
+    int count = list.count;
+    free(list.statements);
+    return count;
+}
+
+// A multiply the additive form beats: a shift or lea already does powers
+// of two and 3, 5 and 9 in one cycle
+static bool is_cheap_multiplier(long k) {
+    return k > 0 && ((k & (k - 1)) == 0 || k == 3 || k == 5 || k == 9);
+}
+
+// i * k or k * i, for a k the loop never changes; *multiplier is set to k
+static bool is_derived(const ASTNode *node, const CountedLoop *counted, const ASTNode **multiplier) {
+    if (node->type != NODE_BINARY_OP || node->data.binary_op.operator != '*') return false;
+
+    const ASTNode *variable = node->data.binary_op.left;
+    const ASTNode *k = node->data.binary_op.right;
+    if (k->type == NODE_VARIABLE && strcmp(k->data.variable.name, counted->name) == 0) {
+        const ASTNode *swap = variable; variable = k; k = swap;
+    }
+    if (variable->type != NODE_VARIABLE || strcmp(variable->data.variable.name, counted->name) != 0) {
+        return false;
+    }
+    if (k->type == NODE_NUMBER ? is_cheap_multiplier(k->data.number.value)
+                               : !is_invariant(k, counted->loop)) {
+        return false;
+    }
+    *multiplier = k;
+    return true;
+}
+
+// Replace the derived products under *slot by their temporaries
+static void reduce_expression(ASTNode **slot, const CountedLoop *counted, ReductionSet *set) {
+    ASTNode *node = *slot;
+    if (!node) return;
+
+    const ASTNode *multiplier;
+    if (is_derived(node, counted, &multiplier)) {
+        Reduction *reduction = NULL;
+        for (int i = 0; i < set->count && !reduction; i++) {
+            if (ast_equal(set->reductions[i].product, node)) reduction = &set->reductions[i];
+        }
+        if (!reduction) {
+            void *temp = realloc(set->reductions, sizeof(Reduction) * (set->count + 1));
+            if (!temp) return;
+            set->reductions = temp;
+            reduction = &set->reductions[set->count++];
+            reduction->product = ast_clone(node);
+            snprintf(reduction->name, sizeof(reduction->name), ".iv%d", temp_count++);
+            if (!reduction->product) {
+                set->count--;
+                return;
+            }
+        }
+        ASTNode *variable = typed_variable(reduction->name, node->value_type);
+        if (!variable) return;
+        ast_free(node);
+        *slot = variable;
+        return;
+    }
+
+    switch (node->type) {
+        case NODE_BINARY_OP:
+            if (node->data.binary_op.operator != '=' ||
+                node->data.binary_op.left->type == NODE_INDEX) {
+                reduce_expression(&node->data.binary_op.left, counted, set);
+            }
+            reduce_expression(&node->data.binary_op.right, counted, set);
+            break;
+        case NODE_UNARY_OP:
+            reduce_expression(&node->data.unary_op.operand, counted, set);
+            break;
+        case NODE_INDEX:
+            reduce_expression(&node->data.index.index, counted, set);
+            break;
+        case NODE_CALL:
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                reduce_expression(&node->data.call.args[i], counted, set);
+            }
+            break;
+        case NODE_SELECT:
+            reduce_expression(&node->data.select.condition, counted, set);
+            reduce_expression(&node->data.select.if_true, counted, set);
+            reduce_expression(&node->data.select.if_false, counted, set);
+            break;
+        case NODE_BLOCK:
+            for (int i = 0; i < node->data.block.statement_count; i++) {
+                reduce_expression(&node->data.block.statements[i], counted, set);
+            }
+            break;
+        case NODE_RETURN:
+            reduce_expression(&node->data.return_stmt.expression, counted, set);
+            break;
+        case NODE_IF:
+            reduce_expression(&node->data.if_stmt.condition, counted, set);
+            reduce_expression(&node->data.if_stmt.then_branch, counted, set);
+            reduce_expression(&node->data.if_stmt.else_branch, counted, set);
+            break;
+        case NODE_WHILE:
+            reduce_expression(&node->data.while_stmt.condition, counted, set);
+            reduce_expression(&node->data.while_stmt.body, counted, set);
+            break;
+        case NODE_FOR:
+            reduce_expression(&node->data.for_stmt.init, counted, set);
+            reduce_expression(&node->data.for_stmt.condition, counted, set);
+            reduce_expression(&node->data.for_stmt.step, counted, set);
+            reduce_expression(&node->data.for_stmt.body, counted, set);
+            break;
+        case NODE_SWITCH:
+            reduce_expression(&node->data.switch_stmt.value, counted, set);
+            reduce_expression(&node->data.switch_stmt.body, counted, set);
+            break;
+        case NODE_INLINE:
+            reduce_expression(&node->data.inline_call.body, counted, set);
+            break;
+        default:
+            break;
+    }
+}
+
+// Strength reduction of the products of the induction variable in the
+// loop body. Each becomes a temporary set to i * k - step * k in front of
+// the loop and advanced by step * k at the top of every trip, where i
+// still has the value of the exit test. Returns the number of statements
+// inserted in front of the loop.
+static int strength_reduce(ASTNode *block, int index, const CountedLoop *counted) {
+    ReductionSet set = {NULL, 0};
+    ASTNode *body = counted->body;
+    for (int i = 0; i < body->data.block.statement_count; i++) {
+        if (body->data.block.statements[i] == counted->step_statement) continue;
+        reduce_expression(&body->data.block.statements[i], counted, &set);
+    }
+    if (set.count == 0) return 0;
+
+    StatementList preheader = {NULL, 0};
+    StatementList updates = {NULL, 0};
+    for (int r = 0; r < set.count; r++) {
+        Reduction *reduction = &set.reductions[r];
+        ASTNode *product = reduction->product;
+        TypeKind type = product->value_type;
+        const ASTNode *k = product->data.binary_op.right;
+        if (k->type == NODE_VARIABLE && strcmp(k->data.variable.name, counted->name) == 0) {
+            k = product->data.binary_op.left;
+        }
+
+        // What the product grows by every trip
+        ASTNode *increment;
+        if (k->type == NODE_NUMBER) {
+            increment = typed_number((long)((unsigned long)k->data.number.value *
+                                            (unsigned long)counted->step), type);
+        } else if (counted->step == 1) {
+            increment = ast_clone(k);
+        } else {
+            char name[32];
+            snprintf(name, sizeof(name), ".iv%d", temp_count++);
+            list_add(&preheader, ast_create_binary_op('=', typed_variable(name, type),
+                         ast_create_binary_op('*', ast_clone(k), typed_number(counted->step, type))));
+            increment = typed_variable(name, type);
+        }
+
+        list_add(&preheader, ast_create_binary_op('=', typed_variable(reduction->name, type),
+                     ast_create_binary_op('-', ast_clone(product), ast_clone(increment))));
+        list_add(&updates, ast_create_binary_op('=', typed_variable(reduction->name, type),
+                     ast_create_binary_op('+', typed_variable(reduction->name, type), increment)));
+        ast_free(product);
+    }
+    free(set.reductions);
+
+    block_splice(body, 0, false, updates.statements, updates.count);
+    free(updates.statements);
+    int count = preheader.count;
+    if (!block_splice(block, index, false, preheader.statements, preheader.count)) count = 0;
+    free(preheader.statements);
+    return count;
+}
+
+// Put a main loop running factor copies of the body per trip in front of
+// the loop, which then runs the trips left over:
+//   if (i < n) {
+//       .unr = (((unsigned long)n - (unsigned long)i - 1) / step + 1) / factor;
+//       while (.unr != 0) { body; body; ...; .unr = .unr - 1; }
+//   }
+//   while (i < n) { body }
+// The trip count is computed in unsigned long, where the distance between
+// any two values of the variable's type fits. It never exceeds the trips
+// the loop really makes: unsigned wraparound can only add more.
+static bool partial_unroll(ASTNode *block, int index, const CountedLoop *counted, int budget,
+                           const Profile *profile) {
+    if (contains_loop(counted->body)) return false;
+
+    int size = body_size(counted);
+    int factor = UNROLL_MAX_FACTOR;
+    while (factor > 1 && factor * size > budget) factor /= 2;
+    if (factor < 2) return false;
+
+    long entries = profile_count(profile, counted->loop, 0);
+    long iterations = profile_count(profile, counted->loop, 1);
+    if (entries >= 0 && iterations >= 0 && iterations < entries * factor) return false;
+
+    ASTNode *from = to_unsigned_long(typed_variable(counted->name, counted->type));
+    ASTNode *to = to_unsigned_long(ast_clone(counted->limit));
+    if (counted->step < 0) {
+        ASTNode *swap = from; from = to; to = swap;
+    }
+    ASTNode *trips = ast_create_binary_op('-', to, from);
+    bool strict = counted->op == '<' || counted->op == '>';
+    long stride = counted->step > 0 ? counted->step : -counted->step;
+    if (stride != 1 || !strict) {
+        if (strict) trips = ast_create_binary_op('-', trips, typed_number(1, TYPE_ULONG));
+        if (stride != 1) trips = ast_create_binary_op('/', trips, typed_number(stride, TYPE_ULONG));
+        trips = ast_create_binary_op('+', trips, typed_number(1, TYPE_ULONG));
+    }
+    ASTNode *count = ast_create_binary_op('/', trips, typed_number(factor, TYPE_ULONG));
+
+    char counter[32];
+    snprintf(counter, sizeof(counter), ".unr%d", temp_count++);
+
+    StatementList copies = {NULL, 0};
+    bool ok = true;
+    for (int f = 0; f < factor && ok; f++) ok = add_body_copy(&copies, counted, false, false, 0);
+    ok = ok && list_add(&copies, ast_create_binary_op('=', typed_variable(counter, TYPE_ULONG),
+                            ast_create_binary_op('-', typed_variable(counter, TYPE_ULONG),
+                                                 typed_number(1, TYPE_ULONG))));
+    if (!ok) {
+        list_free(&copies);
+        ast_free(count);
+        return false;
+    }
+    ASTNode *main_loop = ast_create_while(ast_create_binary_op('N', typed_variable(counter, TYPE_ULONG),
+                                                               typed_number(0, TYPE_ULONG)),
+                                          list_to_block(&copies));
+
+    StatementList entry = {NULL, 0};
+    list_add(&entry, ast_create_binary_op('=', typed_variable(counter, TYPE_ULONG), count));
+    list_add(&entry, main_loop);
+    ASTNode *guard = ast_create_if(ast_clone(counted->condition), list_to_block(&entry), NULL);
+    if (!guard || !block_splice(block, index, false, &guard, 1)) {
+        ast_free(guard);
+        return false;
+    }
+    return true;
+}
+
+static int unroll_statement(ASTNode *node, int budget, const Profile *profile, bool *substituted);
+
+static int unroll_block(ASTNode *block, int budget, const Profile *profile, bool *substituted) {
+    int changed = 0;
+    for (int i = 0; i < block->data.block.statement_count; i++) {
+        ASTNode *loop = block->data.block.statements[i];
+
+        // Inner loops first: a fully unrolled inner loop leaves a body the
+        // outer one can count
+        changed += unroll_statement(loop, budget, profile, substituted);
+        if (loop->type != NODE_WHILE && loop->type != NODE_FOR) continue;
+
+        // The initializer runs once; pull it out so the start is in front
+        if (loop->type == NODE_FOR && loop->data.for_stmt.init) {
+            if (!block_splice(block, i, false, &loop->data.for_stmt.init, 1)) continue;
+            loop->data.for_stmt.init = NULL;
+            i++;
+        }
+
+        CountedLoop counted;
+        if (!find_counted_loop(loop, &counted)) continue;
+
+        int replaced = full_unroll(block, i, &counted);
+        if (replaced > 0) {
+            *substituted = true;
+            changed++;
+            i += replaced - 1;
+            continue;
+        }
+
+        int inserted = strength_reduce(block, i, &counted);
+        if (inserted > 0) changed++;
+        i += inserted;
+
+        if (budget > 0 && partial_unroll(block, i, &counted, budget, profile)) {
+            changed++;
+            i++;
+        }
+    }
+    return changed;
+}
+
+// Loops of inlined bodies are found inside expressions
+static int unroll_expression(ASTNode *node, int budget, const Profile *profile, bool *substituted) {
+    if (!node) return 0;
+
+    switch (node->type) {
+        case NODE_BINARY_OP:
+            return unroll_expression(node->data.binary_op.left, budget, profile, substituted) +
+                   unroll_expression(node->data.binary_op.right, budget, profile, substituted);
+        case NODE_UNARY_OP:
+            return unroll_expression(node->data.unary_op.operand, budget, profile, substituted);
+        case NODE_INDEX:
+            return unroll_expression(node->data.index.index, budget, profile, substituted);
+        case NODE_CALL: {
+            int changed = 0;
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                changed += unroll_expression(node->data.call.args[i], budget, profile, substituted);
+            }
+            return changed;
+        }
+        case NODE_SELECT:
+            return unroll_expression(node->data.select.condition, budget, profile, substituted) +
+                   unroll_expression(node->data.select.if_true, budget, profile, substituted) +
+                   unroll_expression(node->data.select.if_false, budget, profile, substituted);
+        case NODE_INLINE:
+            return unroll_statement(node->data.inline_call.body, budget, profile, substituted);
+        default:
+            return 0;
+    }
+}
+
+static int unroll_statement(ASTNode *node, int budget, const Profile *profile, bool *substituted) {
+    if (!node) return 0;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            return unroll_block(node, budget, profile, substituted);
+        case NODE_RETURN:
+            return unroll_expression(node->data.return_stmt.expression, budget, profile, substituted);
+        case NODE_IF:
+            return unroll_expression(node->data.if_stmt.condition, budget, profile, substituted) +
+                   unroll_statement(node->data.if_stmt.then_branch, budget, profile, substituted) +
+                   unroll_statement(node->data.if_stmt.else_branch, budget, profile, substituted);
+        case NODE_WHILE:
+            return unroll_expression(node->data.while_stmt.condition, budget, profile, substituted) +
+                   unroll_statement(node->data.while_stmt.body, budget, profile, substituted);
+        case NODE_FOR:
+            return unroll_statement(node->data.for_stmt.init, budget, profile, substituted) +
+                   unroll_expression(node->data.for_stmt.condition, budget, profile, substituted) +
+                   unroll_statement(node->data.for_stmt.step, budget, profile, substituted) +
+                   unroll_statement(node->data.for_stmt.body, budget, profile, substituted);
+        case NODE_SWITCH:
+            return unroll_expression(node->data.switch_stmt.value, budget, profile, substituted) +
+                   unroll_statement(node->data.switch_stmt.body, budget, profile, substituted);
+        default:
+            return unroll_expression(node, budget, profile, substituted);
+    }
+}
+
+int unroll_function(ASTNode *function, int budget, const Profile *profile) {
+    bool substituted = false;
+    int changed = unroll_statement(function->data.function.body, budget, profile, &substituted);
+    // Copies with the variable replaced by literals fold further
+    if (substituted) fold_function(function);
+    return changed;
+}
\ No newline at end of file
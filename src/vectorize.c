@@ -0,0 +1,773 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <isel.h>
+#include <vectorize.h>
+
+#define MAX_INVARIANTS 8        // Broadcast into %xmm8-%xmm15
+#define MAX_LANE_REGISTERS 7    // %xmm0-%xmm6 evaluate e; %xmm7 accumulates
+#define MAX_BASES 6
+#define MAX_OFFSET (1L << 20)   // Elements; keeps the displacement in 32 bits
+#define ACCUMULATOR 7
+
+static const char *base_registers[MAX_BASES] = {"%rsi", "%rdi", "%r8", "%r9", "%r10", "%r11"};
+
+typedef enum {
+    VECTOR_MAP,          // a[i + c] = e
+    VECTOR_SUM,          // s = s + e, s = s - e
+    VECTOR_MIN,          // if (e < s) { s = e; }
+    VECTOR_MAX           // if (e > s) { s = e; }
+} VectorKind;
+
+// The statement of the loop body besides the step
+typedef struct {
+    VectorKind kind;
+    ASTNode *target;     // Element stored, or scalar reduced into
+    ASTNode *value;      // e
+    bool subtract;
+} Operation;
+
+// Index of an element: counter + constant + variable
+typedef struct {
+    long constant;
+    ASTNode *variable;   // Value the loop never changes, or NULL
+} Offset;
+
+typedef struct {
+    const char *array;
+    Offset offset;
+} Access;
+
+// What the loop reads and writes, gathered from its operation
+typedef struct {
+    const ASTNode *counter;
+    const char *accumulator;     // Scalar the operation assigns, or NULL
+    Access accesses[MAX_BASES * 4];   // The store of a map first
+    int access_count;
+    int invariant_count;
+} Footprint;
+
+// Code generation state of one vectorized loop
+typedef struct {
+    CodeGenerator *gen;
+    bool avx;                    // %ymm registers and VEX forms
+    bool sse41;                  // pmulld, pminsd and pmaxsd
+    const ASTNode *counter;
+    const ASTNode *invariants[MAX_INVARIANTS];   // In %xmm8 upwards
+    int invariant_count;
+    const char *base_arrays[MAX_BASES];          // Element 0 in base_registers
+    const ASTNode *base_offsets[MAX_BASES];      // Plus this many elements
+    int base_count;
+} VectorCode;
+
+static bool is_counter(const ASTNode *node, const ASTNode *counter) {
+    // An int counter converted to long for an index
+    if (node->type == NODE_UNARY_OP && node->data.unary_op.operator == 'C' &&
+        type_size(node->value_type) == 8 && counter->value_type == TYPE_INT) {
+        node = node->data.unary_op.operand;
+    }
+    return node->type == NODE_VARIABLE &&
+           strcmp(node->data.variable.name, counter->data.variable.name) == 0;
+}
+
+static bool is_assigned(const ASTNode *variable, const Footprint *footprint) {
+    const char *name = variable->data.variable.name;
+    return strcmp(name, footprint->counter->data.variable.name) == 0 ||
+           (footprint->accumulator && strcmp(name, footprint->accumulator) == 0);
+}
+
+// Pure, non-trapping and computed only from values the loop never
+// changes. The loop makes no calls, so globals qualify.
+static bool is_invariant(const ASTNode *node, const Footprint *footprint) {
+    switch (node->type) {
+        case NODE_NUMBER:
+        case NODE_CHAR:
+            return true;
+        case NODE_VARIABLE:
+            return node->data.variable.length == 0 && !is_assigned(node, footprint);
+        case NODE_BINARY_OP: {
+            char op = node->data.binary_op.operator;
+            return (op == '+' || op == '-' || op == '*') &&
+                   is_invariant(node->data.binary_op.left, footprint) &&
+                   is_invariant(node->data.binary_op.right, footprint);
+        }
+        case NODE_UNARY_OP:
+            return node->data.unary_op.operator == 'C' &&
+                   is_invariant(node->data.unary_op.operand, footprint);
+        default:
+            return false;
+    }
+}
+
+static bool contains_element(const ASTNode *node) {
+    switch (node->type) {
+        case NODE_INDEX:
+            return true;
+        case NODE_BINARY_OP:
+            return contains_element(node->data.binary_op.left) ||
+                   contains_element(node->data.binary_op.right);
+        case NODE_UNARY_OP:
+            return contains_element(node->data.unary_op.operand);
+        default:
+            return false;
+    }
+}
+
+// index as counter + constant, counter - constant or counter + variable part
+static bool match_index(ASTNode *index, const ASTNode *counter, Offset *offset) {
+    *offset = (Offset){0, NULL};
+    // An int index is computed in int, then converted
+    if (index->type == NODE_UNARY_OP && index->data.unary_op.operator == 'C' &&
+        index->data.unary_op.operand->value_type == TYPE_INT && counter->value_type == TYPE_INT) {
+        index = index->data.unary_op.operand;
+    }
+    if (is_counter(index, counter)) return true;
+    if (index->type != NODE_BINARY_OP) return false;
+
+    char op = index->data.binary_op.operator;
+    ASTNode *left = index->data.binary_op.left;
+    ASTNode *right = index->data.binary_op.right;
+    if (op == '+' && is_counter(right, counter)) {
+        ASTNode *swap = left; left = right; right = swap;
+    }
+    if ((op != '+' && op != '-') || !is_counter(left, counter)) return false;
+
+    if (right->type == NODE_NUMBER) {
+        long value = right->data.number.value;
+        if (value <= -MAX_OFFSET || value >= MAX_OFFSET) return false;
+        offset->constant = op == '-' ? -value : value;
+        return true;
+    }
+    if (op != '+') return false;
+    offset->variable = right;
+    return true;
+}
+
+// Find the operation in the statement of a loop body; counter must not be
+// its target
+static bool classify(ASTNode *statement, const ASTNode *counter, Operation *operation) {
+    *operation = (Operation){VECTOR_MAP, NULL, NULL, false};
+
+    if (statement->type == NODE_IF) {
+        ASTNode *condition = statement->data.if_stmt.condition;
+        ASTNode *then_branch = statement->data.if_stmt.then_branch;
+        if (statement->data.if_stmt.else_branch || condition->type != NODE_BINARY_OP ||
+            then_branch->type != NODE_BLOCK || then_branch->data.block.statement_count != 1) {
+            return false;
+        }
+        ASTNode *assignment = then_branch->data.block.statements[0];
+        if (assignment->type != NODE_BINARY_OP || assignment->data.binary_op.operator != '=' ||
+            assignment->data.binary_op.left->type != NODE_VARIABLE) {
+            return false;
+        }
+        ASTNode *scalar = assignment->data.binary_op.left;
+        ASTNode *value = condition->data.binary_op.left;
+        ASTNode *other = condition->data.binary_op.right;
+        bool less;
+        switch (condition->data.binary_op.operator) {
+            case '<': case 'L': less = true; break;
+            case '>': case 'G': less = false; break;
+            default: return false;
+        }
+        // s > e is e < s
+        if (ast_equal(value, scalar)) {
+            ASTNode *swap = value; value = other; other = swap;
+            less = !less;
+        }
+        if (!ast_equal(other, scalar) || !ast_equal(value, assignment->data.binary_op.right) ||
+            scalar->value_type != TYPE_INT) {
+            return false;
+        }
+        *operation = (Operation){less ? VECTOR_MIN : VECTOR_MAX, scalar, value, false};
+    } else if (statement->type == NODE_BINARY_OP && statement->data.binary_op.operator == '=') {
+        ASTNode *target = statement->data.binary_op.left;
+        ASTNode *value = statement->data.binary_op.right;
+        if (target->type == NODE_INDEX) {
+            *operation = (Operation){VECTOR_MAP, target, value, false};
+        } else {
+            // s = s + e, s = e + s or s = s - e
+            if (value->type != NODE_BINARY_OP || value->value_type != target->value_type) return false;
+            char op = value->data.binary_op.operator;
+            ASTNode *left = value->data.binary_op.left;
+            ASTNode *right = value->data.binary_op.right;
+            if (op == '+' && ast_equal(right, target)) {
+                ASTNode *swap = left; left = right; right = swap;
+            }
+            if ((op != '+' && op != '-') || !ast_equal(left, target)) return false;
+            *operation = (Operation){VECTOR_SUM, target, right, op == '-'};
+        }
+    } else {
+        return false;
+    }
+
+    if (operation->target->type == NODE_VARIABLE) {
+        ASTNode *scalar = operation->target;
+        if (scalar->data.variable.length > 0 || type_size(scalar->value_type) != 4 ||
+            strcmp(scalar->data.variable.name, counter->data.variable.name) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool add_access(Footprint *footprint, ASTNode *element) {
+    ASTNode *array = element->data.index.array;
+    Offset offset;
+    if (type_size(array->value_type) != 4 || footprint->access_count == MAX_BASES * 4 ||
+        !match_index(element->data.index.index, footprint->counter, &offset)) {
+        return false;
+    }
+    if (offset.variable && !is_invariant(offset.variable, footprint)) return false;
+    footprint->accesses[footprint->access_count++] = (Access){array->data.variable.name, offset};
+    return true;
+}
+
+// Whether e can be computed in lanes: each subexpression without an
+// element is broadcast from a scalar computed once in front of the loop
+static bool is_lane_value(ASTNode *node, Footprint *footprint) {
+    if (type_size(node->value_type) != 4) return false;
+    if (!contains_element(node)) {
+        footprint->invariant_count++;
+        return is_invariant(node, footprint);
+    }
+
+    switch (node->type) {
+        case NODE_INDEX:
+            return add_access(footprint, node);
+        case NODE_BINARY_OP: {
+            char op = node->data.binary_op.operator;
+            return (op == '+' || op == '-' || op == '*') &&
+                   is_lane_value(node->data.binary_op.left, footprint) &&
+                   is_lane_value(node->data.binary_op.right, footprint);
+        }
+        case NODE_UNARY_OP:
+            return node->data.unary_op.operator == 'C' &&
+                   type_size(node->data.unary_op.operand->value_type) == 4 &&
+                   is_lane_value(node->data.unary_op.operand, footprint);
+        default:
+            return false;
+    }
+}
+
+// Registers from the one e is evaluated into upwards that e may take. A
+// multiply without SSE4.1 needs two more above its operands.
+static int lane_registers(const ASTNode *node) {
+    if (!contains_element(node) || node->type == NODE_INDEX) return 1;
+    if (node->type == NODE_UNARY_OP) return lane_registers(node->data.unary_op.operand);
+
+    int left = lane_registers(node->data.binary_op.left);
+    int right = 1 + lane_registers(node->data.binary_op.right);
+    int count = left > right ? left : right;
+    if (node->data.binary_op.operator == '*' && count < 4) count = 4;
+    return count;
+}
+
+static ASTNode *typed_number(long value, TypeKind type) {
+    ASTNode *node = ast_create_number(value);
+    if (node) node->value_type = type;
+    return node;
+}
+
+static ASTNode *to_long(ASTNode *node) {
+    if (!node || type_size(node->value_type) == 8) return node;
+    return ast_create_cast(TYPE_LONG, node);
+}
+
+static ASTNode *comparison(char op, ASTNode *left, ASTNode *right) {
+    ASTNode *node = ast_create_binary_op(op, left, right);
+    if (node) node->value_type = TYPE_INT;
+    return node;
+}
+
+// Test that a store lands no fewer than lanes elements above a load of the
+// same array, or not above it at all: d <= 0 || d >= lanes, where d is the
+// distance from the load to the store
+static ASTNode *overlap_check(const Access *store, const Access *load, int lanes) {
+    long constant = store->offset.constant - load->offset.constant;
+    ASTNode *distance = store->offset.variable ? to_long(ast_clone(store->offset.variable))
+                                               : typed_number(0, TYPE_LONG);
+    if (load->offset.variable) {
+        distance = ast_create_binary_op('-', distance, to_long(ast_clone(load->offset.variable)));
+    }
+    if (constant) distance = ast_create_binary_op('+', distance, typed_number(constant, TYPE_LONG));
+    ASTNode *copy = ast_clone(distance);
+    return comparison('O', comparison('L', distance, typed_number(0, TYPE_LONG)),
+                      comparison('G', copy, typed_number(lanes, TYPE_LONG)));
+}
+
+static bool is_step(const ASTNode *node, const ASTNode *counter) {
+    if (node->type != NODE_BINARY_OP || node->data.binary_op.operator != '=' ||
+        !ast_equal(node->data.binary_op.left, counter)) {
+        return false;
+    }
+    const ASTNode *sum = node->data.binary_op.right;
+    return sum->type == NODE_BINARY_OP && sum->data.binary_op.operator == '+' &&
+           ast_equal(sum->data.binary_op.left, counter) &&
+           sum->data.binary_op.right->type == NODE_NUMBER &&
+           sum->data.binary_op.right->data.number.value == 1;
+}
+
+// The vectorized form of loop, or NULL. previous is the statement in front
+// of the loop, which may give the counter its start.
+static ASTNode *vectorize_loop(ASTNode *loop, const ASTNode *previous, int lanes) {
+    ASTNode *condition, *body, *step, *statement;
+    if (loop->type == NODE_WHILE) {
+        condition = loop->data.while_stmt.condition;
+        body = loop->data.while_stmt.body;
+        if (!body || body->type != NODE_BLOCK || body->data.block.statement_count != 2) return NULL;
+        statement = body->data.block.statements[0];
+        step = body->data.block.statements[1];
+    } else {
+        condition = loop->data.for_stmt.condition;
+        body = loop->data.for_stmt.body;
+        step = loop->data.for_stmt.step;
+        if (!body || body->type != NODE_BLOCK || body->data.block.statement_count != 1 || !step) {
+            return NULL;
+        }
+        statement = body->data.block.statements[0];
+    }
+    if (!condition || condition->type != NODE_BINARY_OP) return NULL;
+
+    // i < n, i <= n, or mirrored
+    char op = condition->data.binary_op.operator;
+    ASTNode *counter = condition->data.binary_op.left;
+    ASTNode *limit = condition->data.binary_op.right;
+    if (op == '>' || op == 'G') {
+        counter = limit;
+        limit = condition->data.binary_op.left;
+        op = op == '>' ? '<' : 'L';
+    }
+    if ((op != '<' && op != 'L') || counter->type != NODE_VARIABLE ||
+        counter->data.variable.is_global || counter->data.variable.length > 0 ||
+        (counter->value_type != TYPE_INT && counter->value_type != TYPE_LONG) ||
+        !is_step(step, counter)) {
+        return NULL;
+    }
+
+    Operation operation;
+    if (!classify(statement, counter, &operation)) return NULL;
+    Footprint footprint = {.counter = counter};
+    if (operation.target->type == NODE_VARIABLE) {
+        footprint.accumulator = operation.target->data.variable.name;
+    } else if (!add_access(&footprint, operation.target)) {
+        return NULL;
+    }
+    if (!is_lane_value(operation.value, &footprint) || !is_invariant(limit, &footprint) ||
+        footprint.invariant_count > MAX_INVARIANTS ||
+        lane_registers(operation.value) > MAX_LANE_REGISTERS) {
+        return NULL;
+    }
+
+    // Known too few trips to fill a vector
+    if (limit->type == NODE_NUMBER && previous && previous->type == NODE_BINARY_OP &&
+        previous->data.binary_op.operator == '=' && ast_equal(previous->data.binary_op.left, counter) &&
+        previous->data.binary_op.right->type == NODE_NUMBER &&
+        limit->data.number.value + (op == 'L') - previous->data.binary_op.right->data.number.value < lanes) {
+        return NULL;
+    }
+
+    // Each array takes a base register for each variable offset it is used at
+    int bases = 0;
+    for (int a = 0; a < footprint.access_count; a++) {
+        const Access *access = &footprint.accesses[a];
+        bool seen = false;
+        for (int b = 0; b < a && !seen; b++) {
+            seen = strcmp(footprint.accesses[b].array, access->array) == 0 &&
+                   ast_equal(footprint.accesses[b].offset.variable, access->offset.variable);
+        }
+        if (!seen) bases++;
+    }
+    if (bases > MAX_BASES) return NULL;
+
+    // Arrays never overlap each other; loads of the stored array must not
+    // read what an earlier lane of the same vector stores
+    ASTNode *check = NULL;
+    const Access *store = operation.kind == VECTOR_MAP ? &footprint.accesses[0] : NULL;
+    for (int a = 1; store && a < footprint.access_count; a++) {
+        const Access *load = &footprint.accesses[a];
+        if (strcmp(load->array, store->array) != 0) continue;
+        if (ast_equal(load->offset.variable, store->offset.variable)) {
+            long distance = store->offset.constant - load->offset.constant;
+            if (distance > 0 && distance < lanes) {
+                ast_free(check);
+                return NULL;
+            }
+            continue;
+        }
+        ASTNode *test = overlap_check(store, load, lanes);
+        check = check ? comparison('A', check, test) : test;
+        if (!check) return NULL;
+    }
+
+    ASTNode *bound = ast_clone(limit);
+    if (op == 'L') bound = ast_create_binary_op('+', to_long(bound), typed_number(1, TYPE_LONG));
+    ASTNode *counter_copy = ast_clone(counter);
+    ASTNode *operation_copy = ast_clone(statement);
+    ASTNode *vector = bound && counter_copy && operation_copy
+        ? ast_create_vector(loop, counter_copy, bound, operation_copy, check, lanes) : NULL;
+    if (!vector) {
+        ast_free(bound);
+        ast_free(counter_copy);
+        ast_free(operation_copy);
+        ast_free(check);
+    }
+    return vector;
+}
+
+static int vectorize_statement(ASTNode *node, int lanes);
+
+static int vectorize_block(ASTNode *block, int lanes) {
+    int changed = 0;
+    for (int i = 0; i < block->data.block.statement_count; i++) {
+        ASTNode *loop = block->data.block.statements[i];
+        changed += vectorize_statement(loop, lanes);
+        if (loop->type != NODE_WHILE && loop->type != NODE_FOR) continue;
+
+        ASTNode *init = loop->type == NODE_FOR ? loop->data.for_stmt.init : NULL;
+        const ASTNode *previous = init ? init : i > 0 ? block->data.block.statements[i - 1] : NULL;
+        ASTNode *vector = vectorize_loop(loop, previous, lanes);
+        if (!vector) continue;
+
+        // The initializer runs once, in front of both forms of the loop
+        if (init) {
+            void *temp = realloc(block->data.block.statements,
+                                 sizeof(ASTNode *) * (block->data.block.statement_count + 1));
+            if (!temp) {
+                vector->data.vector.loop = NULL;
+                ast_free(vector);
+                continue;
+            }
+            block->data.block.statements = temp;
+            memmove(&block->data.block.statements[i + 1], &block->data.block.statements[i],
+                    sizeof(ASTNode *) * (block->data.block.statement_count - i));
+            block->data.block.statement_count++;
+            block->data.block.statements[i++] = init;
+            loop->data.for_stmt.init = NULL;
+        }
+        block->data.block.statements[i] = vector;
+        changed++;
+    }
+    return changed;
+}
+
+// Loops of inlined bodies are found inside expressions
+static int vectorize_expression(ASTNode *node, int lanes) {
+    if (!node) return 0;
+
+    switch (node->type) {
+        case NODE_BINARY_OP:
+            return vectorize_expression(node->data.binary_op.left, lanes) +
+                   vectorize_expression(node->data.binary_op.right, lanes);
+        case NODE_UNARY_OP:
+            return vectorize_expression(node->data.unary_op.operand, lanes);
+        case NODE_INDEX:
+            return vectorize_expression(node->data.index.index, lanes);
+        case NODE_CALL: {
+            int changed = 0;
+            for (int i = 0; i < node->data.call.arg_count; i++) {
+                changed += vectorize_expression(node->data.call.args[i], lanes);
+            }
+            return changed;
+        }
+        case NODE_SELECT:
+            return vectorize_expression(node->data.select.condition, lanes) +
+                   vectorize_expression(node->data.select.if_true, lanes) +
+                   vectorize_expression(node->data.select.if_false, lanes);
+        case NODE_INLINE:
+            return vectorize_statement(node->data.inline_call.body, lanes);
+        default:
+            return 0;
+    }
+}
+
+static int vectorize_statement(ASTNode *node, int lanes) {
+    if (!node) return 0;
+
+    switch (node->type) {
+        case NODE_BLOCK:
+            return vectorize_block(node, lanes);
+        case NODE_RETURN:
+            return vectorize_expression(node->data.return_stmt.expression, lanes);
+        case NODE_IF:
+            return vectorize_expression(node->data.if_stmt.condition, lanes) +
+                   vectorize_statement(node->data.if_stmt.then_branch, lanes) +
+                   vectorize_statement(node->data.if_stmt.else_branch, lanes);
+        case NODE_WHILE:
+            return vectorize_expression(node->data.while_stmt.condition, lanes) +
+                   vectorize_statement(node->data.while_stmt.body, lanes);
+        case NODE_FOR:
+            return vectorize_statement(node->data.for_stmt.init, lanes) +
+                   vectorize_expression(node->data.for_stmt.condition, lanes) +
+                   vectorize_statement(node->data.for_stmt.step, lanes) +
+                   vectorize_statement(node->data.for_stmt.body, lanes);
+        case NODE_SWITCH:
+            return vectorize_expression(node->data.switch_stmt.value, lanes) +
+                   vectorize_statement(node->data.switch_stmt.body, lanes);
+        default:
+            return vectorize_expression(node, lanes);
+    }
+}
+
+int vectorize_function(ASTNode *function, int lanes) {
+    return vectorize_statement(function->data.function.body, lanes);
+}
+
+// Instruction emission. Registers are given by number; wide selects %ymm.
+
+static const char *width(const VectorCode *code, bool wide) {
+    return code->avx && wide ? "ymm" : "xmm";
+}
+
+// dst = left op src
+static void emit_op(VectorCode *code, const char *mnemonic, int src, int left, int dst, bool wide) {
+    const char *r = width(code, wide);
+    if (code->avx) {
+        codegen_emit(code->gen, "\tv%s %%%s%d, %%%s%d, %%%s%d", mnemonic, r, src, r, left, r, dst);
+        return;
+    }
+    if (left != dst) codegen_emit(code->gen, "\tmovdqa %%xmm%d, %%xmm%d", left, dst);
+    codegen_emit(code->gen, "\t%s %%xmm%d, %%xmm%d", mnemonic, src, dst);
+}
+
+static void emit_move(VectorCode *code, int src, int dst, bool wide) {
+    const char *r = width(code, wide);
+    codegen_emit(code->gen, "\t%smovdqa %%%s%d, %%%s%d", code->avx ? "v" : "", r, src, r, dst);
+}
+
+static void emit_shuffle(VectorCode *code, int order, int src, int dst) {
+    codegen_emit(code->gen, "\t%spshufd $%d, %%xmm%d, %%xmm%d", code->avx ? "v" : "", order, src, dst);
+}
+
+// Broadcast %eax to every lane of register dst
+static void emit_broadcast(VectorCode *code, int dst) {
+    if (code->avx) {
+        codegen_emit(code->gen, "\tvmovd %%eax, %%xmm%d", dst);
+        codegen_emit(code->gen, "\tvpbroadcastd %%xmm%d, %%ymm%d", dst, dst);
+    } else {
+        codegen_emit(code->gen, "\tmovd %%eax, %%xmm%d", dst);
+        emit_shuffle(code, 0, dst, dst);
+    }
+}
+
+// dst = left * src in 32-bit lanes. Without pmulld, the even and the odd
+// lanes are multiplied into 64-bit products by pmuludq and the low halves
+// interleaved back; dst + 2 and dst + 3 are scratch.
+static void emit_multiply(VectorCode *code, int src, int left, int dst) {
+    if (code->sse41) {
+        emit_op(code, "pmulld", src, left, dst, true);
+        return;
+    }
+    int odd = dst + 2, scratch = dst + 3;
+    if (left != dst) emit_move(code, left, dst, true);
+    emit_move(code, dst, odd, true);
+    codegen_emit(code->gen, "\tpmuludq %%xmm%d, %%xmm%d", src, dst);
+    codegen_emit(code->gen, "\tpsrlq $32, %%xmm%d", odd);
+    emit_move(code, src, scratch, true);
+    codegen_emit(code->gen, "\tpsrlq $32, %%xmm%d", scratch);
+    codegen_emit(code->gen, "\tpmuludq %%xmm%d, %%xmm%d", scratch, odd);
+    emit_shuffle(code, 8, dst, dst);
+    emit_shuffle(code, 8, odd, odd);
+    codegen_emit(code->gen, "\tpunpckldq %%xmm%d, %%xmm%d", odd, dst);
+}
+
+// acc = min or max of acc and src. Without pminsd and pmaxsd, a compare
+// mask selects between them; scratch is clobbered.
+static void emit_combine(VectorCode *code, VectorKind kind, int src, int acc, int scratch, bool wide) {
+    if (kind == VECTOR_SUM) {
+        emit_op(code, "paddd", src, acc, acc, wide);
+    } else if (code->sse41) {
+        emit_op(code, kind == VECTOR_MIN ? "pminsd" : "pmaxsd", src, acc, acc, wide);
+    } else {
+        // Mask the lanes where acc is kept: src > acc for min, acc > src for max
+        if (kind == VECTOR_MIN) {
+            emit_move(code, src, scratch, wide);
+            codegen_emit(code->gen, "\tpcmpgtd %%xmm%d, %%xmm%d", acc, scratch);
+        } else {
+            emit_move(code, acc, scratch, wide);
+            codegen_emit(code->gen, "\tpcmpgtd %%xmm%d, %%xmm%d", src, scratch);
+        }
+        codegen_emit(code->gen, "\tpand %%xmm%d, %%xmm%d", scratch, acc);
+        codegen_emit(code->gen, "\tpandn %%xmm%d, %%xmm%d", src, scratch);
+        codegen_emit(code->gen, "\tpor %%xmm%d, %%xmm%d", scratch, acc);
+    }
+}
+
+static int find_base(const VectorCode *code, const char *array, const ASTNode *offset) {
+    for (int b = 0; b < code->base_count; b++) {
+        if (strcmp(code->base_arrays[b], array) == 0 && ast_equal(code->base_offsets[b], offset)) return b;
+    }
+    return -1;
+}
+
+// Memory operand of the lanes of an element at the current counter
+static void element_operand(VectorCode *code, ASTNode *element, char *out, size_t size) {
+    Offset offset;
+    match_index(element->data.index.index, code->counter, &offset);
+    int b = find_base(code, element->data.index.array->data.variable.name, offset.variable);
+    if (offset.constant) {
+        snprintf(out, size, "%ld(%s,%%rcx,4)", offset.constant * 4, base_registers[b]);
+    } else {
+        snprintf(out, size, "(%s,%%rcx,4)", base_registers[b]);
+    }
+}
+
+// Load the bases of the elements under node into their registers: the
+// address of element 0, plus the variable part of the offset
+static void emit_bases(VectorCode *code, ASTNode *node) {
+    switch (node->type) {
+        case NODE_INDEX: {
+            Offset offset;
+            match_index(node->data.index.index, code->counter, &offset);
+            const char *array = node->data.index.array->data.variable.name;
+            if (find_base(code, array, offset.variable) >= 0) return;
+
+            const char *reg = base_registers[code->base_count];
+            code->base_arrays[code->base_count] = array;
+            code->base_offsets[code->base_count++] = offset.variable;
+            if (offset.variable) {
+                codegen_expression(code->gen, offset.variable);
+                if (type_size(offset.variable->value_type) == 4) codegen_emit(code->gen, "\tcltq");
+            }
+            char operand[64];
+            codegen_memory_operand(code->gen, node, operand, sizeof(operand));
+            codegen_emit(code->gen, "\tleaq %s, %s", operand, reg);
+            if (offset.variable) codegen_emit(code->gen, "\tleaq (%s,%%rax,4), %s", reg, reg);
+            break;
+        }
+        case NODE_BINARY_OP:
+            emit_bases(code, node->data.binary_op.left);
+            emit_bases(code, node->data.binary_op.right);
+            break;
+        case NODE_UNARY_OP:
+            emit_bases(code, node->data.unary_op.operand);
+            break;
+        default:
+            break;
+    }
+}
+
+// Compute the subexpressions without elements and broadcast each into a
+// register of its own
+static void emit_invariants(VectorCode *code, ASTNode *node) {
+    if (!contains_element(node)) {
+        codegen_expression(code->gen, node);
+        emit_broadcast(code, 8 + code->invariant_count);
+        code->invariants[code->invariant_count++] = node;
+        return;
+    }
+    if (node->type == NODE_BINARY_OP) {
+        emit_invariants(code, node->data.binary_op.left);
+        emit_invariants(code, node->data.binary_op.right);
+    } else if (node->type == NODE_UNARY_OP) {
+        emit_invariants(code, node->data.unary_op.operand);
+    }
+}
+
+// Evaluate e for every lane; returns the register holding it, dst unless
+// e is a broadcast value. Registers from dst up are scratch.
+static int emit_lanes(VectorCode *code, ASTNode *node, int dst) {
+    if (!contains_element(node)) {
+        int k = 0;
+        while (code->invariants[k] != node) k++;
+        return 8 + k;
+    }
+
+    switch (node->type) {
+        case NODE_INDEX: {
+            char operand[64];
+            element_operand(code, node, operand, sizeof(operand));
+            codegen_emit(code->gen, "\t%smovdqu %s, %%%s%d", code->avx ? "v" : "", operand,
+                         width(code, true), dst);
+            return dst;
+        }
+        case NODE_UNARY_OP:
+            return emit_lanes(code, node->data.unary_op.operand, dst);
+        default: {
+            int left = emit_lanes(code, node->data.binary_op.left, dst);
+            int right = emit_lanes(code, node->data.binary_op.right, dst + 1);
+            switch (node->data.binary_op.operator) {
+                case '+': emit_op(code, "paddd", right, left, dst, true); break;
+                case '-': emit_op(code, "psubd", right, left, dst, true); break;
+                default:  emit_multiply(code, right, left, dst); break;
+            }
+            return dst;
+        }
+    }
+}
+
+void codegen_vector_loop(CodeGenerator *gen, ASTNode *node) {
+    ASTNode *counter = node->data.vector.counter;
+    ASTNode *limit = node->data.vector.limit;
+    int lanes = node->data.vector.lanes;
+    Operation operation;
+    classify(node->data.vector.operation, counter, &operation);
+
+    VectorCode code = {.gen = gen, .avx = lanes == VECTORIZE_AVX_LANES, .counter = counter};
+    code.sse41 = code.avx || (gen->target.features & TARGET_SSE4_1);
+    int scalar_label = codegen_new_label(gen);
+    int top_label = codegen_new_label(gen);
+    int skip_label = codegen_new_label(gen);
+    char counter_operand[64], target_operand[64];
+    codegen_memory_operand(gen, counter, counter_operand, sizeof(counter_operand));
+    codegen_memory_operand(gen, operation.target, target_operand, sizeof(target_operand));
+    bool wide_counter = type_size(counter->value_type) == 8;
+
+    if (node->data.vector.check) codegen_branch(gen, node->data.vector.check, false, scalar_label);
+
+    emit_invariants(&code, operation.value);
+    if (operation.kind == VECTOR_SUM) {
+        emit_op(&code, "pxor", ACCUMULATOR, ACCUMULATOR, ACCUMULATOR, true);
+    } else if (operation.kind != VECTOR_MAP) {
+        codegen_expression(gen, operation.target);
+        emit_broadcast(&code, ACCUMULATOR);
+    }
+    if (operation.kind == VECTOR_MAP) emit_bases(&code, operation.target);
+    emit_bases(&code, operation.value);
+
+    // Vector trips run while counter + lanes <= limit
+    codegen_expression(gen, limit);
+    codegen_emit(gen, type_size(limit->value_type) == 8 ? "\tmovq %%rax, %%rdx" : "\tmovslq %%eax, %%rdx");
+    codegen_emit(gen, "\tsubq $%d, %%rdx", lanes);
+    codegen_emit(gen, "\t%s %s, %%rcx", wide_counter ? "movq" : "movslq", counter_operand);
+    codegen_emit(gen, "\tcmpq %%rdx, %%rcx");
+    codegen_emit_jump(gen, "jg", skip_label);
+
+    if (gen->align_loops) codegen_emit(gen, "\t.p2align 4,,10");
+    codegen_emit_label(gen, top_label);
+    int value = emit_lanes(&code, operation.value, 0);
+    if (operation.kind == VECTOR_MAP) {
+        char operand[64];
+        element_operand(&code, operation.target, operand, sizeof(operand));
+        codegen_emit(gen, "\t%smovdqu %%%s%d, %s", code.avx ? "v" : "", width(&code, true), value, operand);
+    } else if (operation.subtract) {
+        emit_op(&code, "psubd", value, ACCUMULATOR, ACCUMULATOR, true);
+    } else {
+        emit_combine(&code, operation.kind, value, ACCUMULATOR, value == 0 ? 1 : 0, true);
+    }
+    codegen_emit(gen, "\taddq $%d, %%rcx", lanes);
+    codegen_emit(gen, "\tcmpq %%rdx, %%rcx");
+    codegen_emit_jump(gen, "jle", top_label);
+    codegen_emit(gen, "\t%s %s, %s", wide_counter ? "movq" : "movl",
+                 wide_counter ? "%rcx" : "%ecx", counter_operand);
+
+    // Fold the lanes into one: the high half of a %ymm, then pairs of
+    // 64 and 32 bits
+    if (operation.kind != VECTOR_MAP) {
+        VectorKind kind = operation.kind;
+        if (code.avx) {
+            codegen_emit(gen, "\tvextracti128 $1, %%ymm%d, %%xmm%d", ACCUMULATOR, ACCUMULATOR - 1);
+            emit_combine(&code, kind, ACCUMULATOR - 1, ACCUMULATOR, ACCUMULATOR - 2, false);
+        }
+        emit_shuffle(&code, 0x4e, ACCUMULATOR, ACCUMULATOR - 1);
+        emit_combine(&code, kind, ACCUMULATOR - 1, ACCUMULATOR, ACCUMULATOR - 2, false);
+        emit_shuffle(&code, 0xb1, ACCUMULATOR, ACCUMULATOR - 1);
+        emit_combine(&code, kind, ACCUMULATOR - 1, ACCUMULATOR, ACCUMULATOR - 2, false);
+        codegen_emit(gen, "\t%smovd %%xmm%d, %%eax", code.avx ? "v" : "", ACCUMULATOR);
+        codegen_emit(gen, "\t%s %%eax, %s", operation.kind == VECTOR_SUM ? "addl" : "movl", target_operand);
+    }
+    codegen_emit_label(gen, skip_label);
+    if (code.avx) codegen_emit(gen, "\tvzeroupper");
+
+    codegen_emit_label(gen, scalar_label);
+    codegen_loop(gen, node->data.vector.loop);
+}
\ No newline at end of file
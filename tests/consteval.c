@@ -0,0 +1,27 @@
+// exit status: 111
+// Pure calls with literal arguments. fib(20) recurses within the depth
+// limit and is folded. down(100) nests deeper than the interpreter goes,
+// and spin(3000000) runs out of steps, so both stay calls. Every result
+// must match what the program computes when it runs.
+int fib(int n) {
+    if (n < 2) { return n; }
+    return fib(n - 1) + fib(n - 2);
+}
+
+int down(int n) {
+    if (n == 0) { return 0; }
+    return down(n - 1) + 2;
+}
+
+int spin(int n) {
+    int total = 0;
+    for (int i = 0; i < n; i = i + 1) {
+        total = total + i - i / 7 * 7;
+    }
+    return total;
+}
+
+int main() {
+    int sum = fib(20) + down(100) + spin(3000000);
+    return sum - sum / 256 * 256;
+}
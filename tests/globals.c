@@ -0,0 +1,29 @@
+// exit status: 20
+// counter and total start in .bss and limit in .data. bump() writes
+// counter behind main()'s back, so every read after a call must load it
+// again. Equal string literals share one entry of the string pool.
+int counter;
+long total = 0;
+int limit = 5;
+unsigned long greeting = "hello";
+unsigned long again = "hello";
+unsigned long other = "world";
+
+int bump(int by) {
+    counter = counter + by;
+    total = total + counter;
+    return counter;
+}
+
+int main() {
+    for (int i = 0; i < limit; i = i + 1) {
+        bump(i);
+    }
+    int before = counter;
+    bump(1);
+    int after = counter;
+    unsigned long local = "hello";
+    int pooled = (greeting == again) + (local == greeting) + (greeting != other);
+    int result = before * 100 + (after - before) * 10 + pooled + total;
+    return result - result / 256 * 256;
+}
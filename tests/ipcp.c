@@ -0,0 +1,39 @@
+// exit status: 151
+// scale() gets 3 for factor at every call, so the parameter is dropped.
+// pick() is called with six different modes: the first four groups get
+// clones and the rest keep calling the original. depth() passes its limit
+// on unchanged, so the clone for a limit of 40 recurses into itself.
+// bump() assigns its parameter, which must then stay a parameter.
+int scale(int x, int factor) {
+    return x * factor;
+}
+
+int pick(int mode, int x) {
+    if (mode == 0) { return x + 1; }
+    if (mode == 1) { return x * 2; }
+    if (mode == 2) { return x - 3; }
+    if (mode == 3) { return x / 2; }
+    if (mode == 4) { return 7; }
+    return x;
+}
+
+int depth(int n, int limit) {
+    if (n == limit) { return n; }
+    return depth(n + 1, limit);
+}
+
+int bump(int x, int by) {
+    by = by + x;
+    return by;
+}
+
+int main() {
+    int sum = 0;
+    for (int i = 0; i < 10; i = i + 1) {
+        sum = sum + scale(i, 3) + pick(0, i) + pick(0, i + 1) + pick(1, i) + pick(2, i) + pick(3, i) +
+              pick(4, i) + pick(5, i) + depth(i, 40);
+    }
+    sum = sum + depth(0, 9);
+    sum = sum + bump(2, 5) + bump(3, 5);
+    return sum - sum / 256 * 256;
+}
@@ -0,0 +1,32 @@
+// exit status: 39
+// profile: tests/profile.c
+// Rebuilt with the counts of its own training run: cold() never runs and
+// goes to .text.unlikely, the branches in step() are laid out the way they
+// went, and the hot calls from the loop are inlined.
+int cold(int x) {
+    return x * 3 + 1;
+}
+
+int step(int x) {
+    if (x - x / 2 * 2 == 0) { return x / 2; }
+    return 3 * x + 1;
+}
+
+int steps(int x) {
+    int count = 0;
+    while (x != 1) {
+        x = step(x);
+        count = count + 1;
+    }
+    return count;
+}
+
+int main() {
+    int total = 0;
+    for (int i = 1; i < 1000; i = i + 1) {
+        int s = steps(i);
+        if (s > 1000) { total = total + cold(s); }
+        total = total + s;
+    }
+    return total - total / 256 * 256;
+}
@@ -0,0 +1,38 @@
+// exit status: 72
+// profile: tests/profile.c
+// Built with the profile of tests/profile.c. step() is unchanged and keeps
+// its counts; cold(), steps() and main() changed shape, so their counts
+// are dropped with a warning. scale() is not in the profile at all.
+int cold(int x) {
+    if (x < 0) { return 0; }
+    return x * 3 + 1;
+}
+
+int step(int x) {
+    if (x - x / 2 * 2 == 0) { return x / 2; }
+    return 3 * x + 1;
+}
+
+int scale(int x) {
+    return x * 2;
+}
+
+int steps(int x, int limit) {
+    int count = 0;
+    while (x != 1) {
+        if (count == limit) { return count; }
+        x = step(x);
+        count = count + 1;
+    }
+    return count;
+}
+
+int main() {
+    int total = 0;
+    for (int i = 1; i < 2000; i = i + 1) {
+        int s = steps(i, 100);
+        if (s == 100) { total = total + cold(s); }
+        total = total + scale(s);
+    }
+    return total - total / 256 * 256;
+}
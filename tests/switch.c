@@ -0,0 +1,57 @@
+// exit status: 207
+// One switch per dispatch strategy, each run over every value in and
+// around its cases: a dense range becomes a jump table, small values
+// sharing a few targets become bit tests, and sparse values a search tree.
+// Each has a default and cases that fall through into the next.
+int table(int x) {
+    int r = 0;
+    switch (x) {
+        case 0: r = 10; break;
+        case 1: r = 11;
+        case 2: r = r + 12; break;
+        case 3: r = 13; break;
+        case 4:
+        case 5: r = 15; break;
+        case 6: r = 16;
+        case 7: r = r + 17; break;
+        default: r = 99;
+    }
+    return r;
+}
+
+int bits(int x) {
+    switch (x) {
+        case 4: case 12: case 20: case 28: case 44:
+            return 1;
+        case 8: case 24: case 60:
+            return 2;
+        default:
+            return 3;
+    }
+}
+
+int tree(int x) {
+    int r = 1;
+    switch (x) {
+        case -300: r = 2; break;
+        case 7: r = 3;
+        case 1000: r = r * 5; break;
+        case 50000: r = 7; break;
+        case 700000: r = 11; break;
+        default: r = 13; break;
+    }
+    return r;
+}
+
+int main() {
+    int sum = 0;
+    for (int x = -2; x < 10; x = x + 1) {
+        sum = sum + table(x) * (x + 3);
+    }
+    for (int x = 0; x < 64; x = x + 1) {
+        sum = sum + bits(x) * (x + 1);
+    }
+    sum = sum + tree(-300) + 2 * tree(-299) + 3 * tree(7) + 4 * tree(8) + 5 * tree(1000) +
+          6 * tree(50000) + 7 * tree(700000) + 8 * tree(699999) + 9 * tree(0);
+    return sum - sum / 256 * 256;
+}
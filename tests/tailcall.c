@@ -0,0 +1,17 @@
+// exit status: 2
+// Mutual recursion in tail position must run in constant stack. With
+// inlining on, each function is copied into the other, so the tail calls
+// end up inside inlined bodies.
+int even(int n) {
+    if (n == 0) { return 1; }
+    return odd(n - 1);
+}
+
+int odd(int n) {
+    if (n == 0) { return 0; }
+    return even(n - 1);
+}
+
+int main() {
+    return even(20000001) + 2 * odd(20000001);
+}
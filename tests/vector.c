@@ -0,0 +1,49 @@
+// exit status: 18
+// 103 elements leave a remainder after any number of 4 or 8 lane trips.
+// prefix() stores one element above the one it reads, so the loop carries
+// a dependence and must stay scalar. shift() stores k elements above its
+// read, with k unknown at compile time: the runtime check must take the
+// scalar loop while k is smaller than the vector and not zero.
+int a[103];
+int b[103];
+
+int prefix(int n) {
+    for (int i = 0; i < n; i = i + 1) {
+        a[i + 1] = a[i] + 2;
+    }
+    return a[n];
+}
+
+int shift(int k, int n) {
+    for (int i = 0; i < n; i = i + 1) {
+        b[i] = i;
+    }
+    for (int i = 0; i < n - k; i = i + 1) {
+        b[i + k] = b[i] + 1;
+    }
+    int total = 0;
+    for (int i = 0; i < n; i = i + 1) {
+        total = total + b[i];
+    }
+    return total;
+}
+
+int main() {
+    int n = 103;
+    for (int i = 0; i < n; i = i + 1) {
+        a[i] = i * 3 - 100;
+    }
+    int total = 0;
+    for (int i = 0; i < n; i = i + 1) {
+        total = total + a[i];
+    }
+    int smallest = 0;
+    for (int i = 0; i < n; i = i + 1) {
+        if (a[i] < smallest) { smallest = a[i]; }
+    }
+    int result = total - smallest + prefix(102);
+    for (int k = 0; k < 10; k = k + 1) {
+        result = result + shift(k, n) * (k + 1);
+    }
+    return result - result / 256 * 256;
+}
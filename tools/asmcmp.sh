@@ -0,0 +1,48 @@
+#!/bin/sh
+# Compare the object file the built-in assembler writes for a program with
+# the one as(1) assembles from the compiler's assembly output: the headers
+# of the allocated sections, their bytes and every relocation must match.
+# Usage: asmcmp.sh OPENCC SOURCE WORKDIR [FLAGS...]
+opencc=$1
+source=$2
+work=$3/$(basename "$source" .c)
+shift 3
+
+"$opencc" "$@" "$source" "$work.s" > /dev/null || { echo "$source ($*): not compiled"; exit 1; }
+"$opencc" "$@" --emit=obj "$source" "$work.o" > /dev/null || { echo "$source ($*): not assembled"; exit 1; }
+as "$work.s" -o "$work.as.o" || exit 1
+
+# Name, type, size, flags and alignment of each allocated section
+sections() {
+    readelf -SW "$1" | sed -n 's/^ *\[ *[0-9]*\] //p' |
+        awk '$7 ~ /A/ { print $1, $2, $5, $7, $10 }'
+}
+
+# Relocations by section, without the file offsets of the tables
+relocations() {
+    readelf -rW "$1" | sed 's/ at offset 0x[0-9a-f]*//' |
+        awk '/^Relocation section/ { print } /^[0-9a-f]+ / { print $1, $3, $5, $6, $7 }'
+}
+
+status=0
+sections "$work.as.o" > "$work.as.sections"
+sections "$work.o" > "$work.sections"
+if ! cmp -s "$work.as.sections" "$work.sections"; then
+    echo "$source ($*): sections differ"
+    status=1
+fi
+for section in $(awk '$2 == "PROGBITS" { print $1 }' "$work.as.sections"); do
+    objcopy -O binary -j "$section" "$work.as.o" "$work.as.bin"
+    objcopy -O binary -j "$section" "$work.o" "$work.bin"
+    if ! cmp -s "$work.as.bin" "$work.bin"; then
+        echo "$source ($*): $section bytes differ"
+        status=1
+    fi
+done
+relocations "$work.as.o" > "$work.as.rel"
+relocations "$work.o" > "$work.rel"
+if ! cmp -s "$work.as.rel" "$work.rel"; then
+    echo "$source ($*): relocations differ"
+    status=1
+fi
+exit $status
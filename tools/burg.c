@@ -0,0 +1,484 @@
+// Compile the instruction selection rules of src/isel.spec into the tables
+// src/isel.c matches expression trees against. Usage: burg SPEC HEADER
+// The spec format is described at the top of src/isel.spec.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <ctype.h>
+
+#define MAX_SYMBOLS 64
+#define MAX_RULES 256
+#define MAX_PATTERN_NODES 2048
+#define MAX_KIDS 2            // Every AST operator is unary or binary
+#define MAX_LEAVES 10         // %0..%9
+#define MAX_REGS 2            // The selector evaluates leaves into %rax and %rcx
+#define MAX_TIERS 8
+#define MAX_LINE 512
+
+typedef struct {
+    char name[32];
+    int arity;                // -1 until the first use in a pattern
+} Terminal;
+
+// A cost given per target tier
+typedef struct {
+    char name[32];
+    int cost[MAX_TIERS];
+} NamedCost;
+
+typedef struct {
+    bool terminal;
+    int symbol;
+    int kids[MAX_KIDS];
+    int kid_count;
+} PatternNode;
+
+typedef struct {
+    int line;
+    int lhs;
+    int pattern;              // Root; the pattern runs to pattern_end
+    int pattern_end;
+    int cost[MAX_TIERS];
+    char predicate[32];
+    char code[MAX_LINE];      // Lines separated by newlines
+    char result[64];
+    char text[MAX_LINE];      // As written, for the generated comments
+    int leaves;               // Nonterminal leaves in the pattern
+} Rule;
+
+static const char *spec_name;
+static int line_number;
+
+static Terminal terminals[MAX_SYMBOLS];
+static int terminal_count;
+static char nonterminals[MAX_SYMBOLS][32];
+static int nonterminal_count;
+static PatternNode patterns[MAX_PATTERN_NODES];
+static int pattern_count;
+static Rule rules[MAX_RULES];
+static int rule_count;
+static char tiers[MAX_TIERS][32];
+static int tier_count = 1;    // Without %tiers, costs are the same everywhere
+static NamedCost costs[MAX_SYMBOLS];
+static int cost_count;
+
+// Nonterminals used in a pattern, and the line of their first use, to
+// report those no rule derives
+static int used_line[MAX_SYMBOLS];
+
+static void fail(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    fprintf(stderr, "%s:%d: ", spec_name, line_number);
+    vfprintf(stderr, format, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    exit(1);
+}
+
+static const char *skip_space(const char *p) {
+    while (*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+static const char *read_name(const char *p, char *name, size_t size) {
+    size_t n = 0;
+    while (isalnum((unsigned char)*p) || *p == '_') {
+        if (n + 1 >= size) fail("name too long");
+        name[n++] = *p++;
+    }
+    name[n] = '\0';
+    if (n == 0) fail("expected a name at '%s'", p);
+    return p;
+}
+
+static int find_terminal(const char *name) {
+    for (int i = 0; i < terminal_count; i++) {
+        if (strcmp(terminals[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static int nonterminal(const char *name) {
+    for (int i = 0; i < nonterminal_count; i++) {
+        if (strcmp(nonterminals[i], name) == 0) return i;
+    }
+    if (nonterminal_count == MAX_SYMBOLS) fail("too many nonterminals");
+    for (const char *c = name; *c; c++) {
+        if (isupper((unsigned char)*c)) fail("undeclared terminal %s", name);
+    }
+    strcpy(nonterminals[nonterminal_count], name);
+    used_line[nonterminal_count] = 0;
+    return nonterminal_count++;
+}
+
+static const char *parse_pattern(const char *p, int *index, int *leaves) {
+    char name[32];
+    p = read_name(skip_space(p), name, sizeof(name));
+    if (pattern_count == MAX_PATTERN_NODES) fail("too many pattern nodes");
+    int self = pattern_count++;
+    PatternNode *node = &patterns[self];
+    memset(node, 0, sizeof(*node));
+    *index = self;
+
+    int t = find_terminal(name);
+    if (t < 0) {
+        node->symbol = nonterminal(name);
+        if (!used_line[node->symbol]) used_line[node->symbol] = line_number;
+        if (*skip_space(p) == '(') fail("nonterminal %s cannot have operands", name);
+        (*leaves)++;
+        return p;
+    }
+
+    node->terminal = true;
+    node->symbol = t;
+    p = skip_space(p);
+    if (*p == '(') {
+        do {
+            if (node->kid_count == MAX_KIDS) fail("%s has more than %d operands", name, MAX_KIDS);
+            int kid;
+            p = parse_pattern(p + 1, &kid, leaves);
+            patterns[self].kids[patterns[self].kid_count++] = kid;
+            p = skip_space(p);
+        } while (*p == ',');
+        if (*p != ')') fail("expected ')' in pattern");
+        p++;
+    }
+    node = &patterns[self];
+    if (terminals[t].arity < 0) {
+        terminals[t].arity = node->kid_count;
+    } else if (terminals[t].arity != node->kid_count) {
+        fail("%s used with %d operands, earlier with %d", name, node->kid_count, terminals[t].arity);
+    }
+    return p;
+}
+
+// Placeholders are checked here so that a bad one fails the build rather
+// than the compiled program
+static void check_template(const Rule *rule, const char *text) {
+    for (const char *c = text; *c; c++) {
+        if (*c != '%') continue;
+        c++;
+        // Width prefix of a register operand
+        if (*c && strchr("bwlq", *c) && (isdigit((unsigned char)c[1]) || c[1] == 'r')) c++;
+        if (isdigit((unsigned char)*c)) {
+            if (*c - '0' >= rule->leaves) fail("%%%c but the pattern has %d leaves", *c, rule->leaves);
+        } else if (!*c || !strchr("rvmaknMSzcs%", *c)) {
+            fail("unknown placeholder %%%c", *c);
+        } else if (*c != '%' && isalpha((unsigned char)c[1])) {
+            fail("%%%c%c reads as a placeholder; write registers as %%%%name", *c, c[1]);
+        }
+    }
+}
+
+static void parse_rule(const char *p) {
+    if (rule_count == MAX_RULES) fail("too many rules");
+    Rule *rule = &rules[rule_count];
+    memset(rule, 0, sizeof(*rule));
+    rule->line = line_number;
+    snprintf(rule->text, sizeof(rule->text), "%s", p);
+
+    char name[32];
+    p = read_name(p, name, sizeof(name));
+    rule->lhs = nonterminal(name);
+    p = skip_space(p);
+    if (*p++ != ':') fail("expected ':' after %s", name);
+
+    p = parse_pattern(p, &rule->pattern, &rule->leaves);
+    rule->pattern_end = pattern_count;
+    if (rule->leaves > MAX_LEAVES) fail("more than %d leaves", MAX_LEAVES);
+    p = skip_space(p);
+    if (*p++ != ',') fail("expected ', cost' after the pattern");
+    p = skip_space(p);
+    if (isalpha((unsigned char)*p)) {
+        char cost_name[32];
+        p = skip_space(read_name(p, cost_name, sizeof(cost_name)));
+        int c = 0;
+        while (c < cost_count && strcmp(costs[c].name, cost_name) != 0) c++;
+        if (c == cost_count) fail("undefined cost %s", cost_name);
+        memcpy(rule->cost, costs[c].cost, sizeof(rule->cost));
+    } else {
+        char *end;
+        int cost = (int)strtol(p, &end, 10);
+        if (end == p || cost < 0) fail("expected a cost");
+        for (int t = 0; t < tier_count; t++) rule->cost[t] = cost;
+        p = skip_space(end);
+    }
+
+    if (*p == ',') {
+        p = skip_space(p + 1);
+        if (strncmp(p, "if", 2) != 0) fail("expected 'if predicate'");
+        p = read_name(skip_space(p + 2), rule->predicate, sizeof(rule->predicate));
+        p = skip_space(p);
+    }
+
+    if (*p == '{') {
+        const char *close = strchr(p, '}');
+        if (!close) fail("missing '}'");
+        size_t n = 0;
+        for (const char *line = p + 1; line < close;) {
+            const char *semi = memchr(line, ';', close - line);
+            if (!semi) semi = close;
+            line = skip_space(line);
+            const char *stop = semi;
+            while (stop > line && (stop[-1] == ' ' || stop[-1] == '\t')) stop--;
+            if (stop > line) {
+                if (n + (stop - line) + 2 > sizeof(rule->code)) fail("code too long");
+                if (n) rule->code[n++] = '\n';
+                memcpy(rule->code + n, line, stop - line);
+                n += stop - line;
+            }
+            line = semi + 1;
+        }
+        rule->code[n] = '\0';
+        if (strchr(rule->code, '@') && strcmp(rule->code, "@") != 0) fail("@ must be the only line");
+        p = skip_space(close + 1);
+    }
+
+    if (strncmp(p, "->", 2) == 0) {
+        p = skip_space(p + 2);
+        size_t n = strlen(p);
+        while (n && isspace((unsigned char)p[n - 1])) n--;
+        if (n == 0 || n >= sizeof(rule->result)) fail("bad operand after '->'");
+        memcpy(rule->result, p, n);
+        rule->result[n] = '\0';
+        p += n;
+    }
+    if (*skip_space(p) && *skip_space(p) != '\n') fail("unexpected '%s'", skip_space(p));
+
+    check_template(rule, rule->code);
+    check_template(rule, rule->result);
+    rule_count++;
+}
+
+// Most registers a derivation of each nonterminal evaluates leaves into:
+// one for a reg leaf, and those beneath any other
+static void count_registers(int *registers) {
+    int reg = nonterminal("reg");
+    for (int i = 0; i < nonterminal_count; i++) registers[i] = 0;
+
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int r = 0; r < rule_count; r++) {
+            int count = 0;
+            for (int i = rules[r].pattern; i < rules[r].pattern_end; i++) {
+                if (patterns[i].terminal) continue;
+                count += patterns[i].symbol == reg ? 1 : registers[patterns[i].symbol];
+            }
+            if (count > MAX_REGS) {
+                line_number = rules[r].line;
+                fail("the rule needs %d registers, at most %d are available", count, MAX_REGS);
+            }
+            if (rules[r].lhs != reg && count > registers[rules[r].lhs]) {
+                registers[rules[r].lhs] = count;
+                changed = true;
+            }
+        }
+    }
+}
+
+static void write_string(FILE *out, const char *text) {
+    if (!*text) {
+        fprintf(out, "NULL");
+        return;
+    }
+    fputc('"', out);
+    for (const char *c = text; *c; c++) {
+        if (*c == '\n') {
+            fputs("\\n", out);
+        } else {
+            if (*c == '"' || *c == '\\') fputc('\\', out);
+            fputc(*c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+static void write_upper(FILE *out, const char *name) {
+    for (const char *c = name; *c; c++) fputc(toupper((unsigned char)*c), out);
+}
+
+static void write_header(FILE *out) {
+    fprintf(out, "// Generated by tools/burg.c from %s; do not edit.\n", spec_name);
+    fprintf(out, "#ifndef ISEL_RULES_H\n#define ISEL_RULES_H\n\n");
+    int max_leaves = 0;
+    for (int r = 0; r < rule_count; r++) {
+        if (rules[r].leaves > max_leaves) max_leaves = rules[r].leaves;
+    }
+    fprintf(out, "#define ISEL_MAX_LEAVES %d\n#define ISEL_MAX_REGS %d\n#define ISEL_TIER_COUNT %d\n\n",
+            max_leaves, MAX_REGS, tier_count);
+
+    fprintf(out, "enum {\n");
+    for (int i = 0; i < terminal_count; i++) fprintf(out, "    ISEL_%s,\n", terminals[i].name);
+    fprintf(out, "    ISEL_TERM_COUNT\n};\n\nenum {\n");
+    for (int i = 0; i < nonterminal_count; i++) {
+        fprintf(out, "    ISEL_NT_");
+        write_upper(out, nonterminals[i]);
+        fprintf(out, ",\n");
+    }
+    fprintf(out, "    ISEL_NT_COUNT\n};\n\n");
+
+    for (int r = 0; r < rule_count; r++) {
+        if (!rules[r].predicate[0]) continue;
+        bool seen = false;
+        for (int q = 0; q < r && !seen; q++) seen = strcmp(rules[q].predicate, rules[r].predicate) == 0;
+        if (!seen) fprintf(out, "static bool isel_pred_%s(const ASTNode *node);\n", rules[r].predicate);
+    }
+
+    fprintf(out, "\nstatic const IselPattern isel_patterns[] = {\n");
+    for (int i = 0; i < pattern_count; i++) {
+        PatternNode *node = &patterns[i];
+        fprintf(out, "    {%s, ", node->terminal ? "true" : "false");
+        if (node->terminal) {
+            fprintf(out, "ISEL_%s", terminals[node->symbol].name);
+        } else {
+            fprintf(out, "ISEL_NT_");
+            write_upper(out, nonterminals[node->symbol]);
+        }
+        fprintf(out, ", {%d, %d}},  // %d\n",
+                node->kid_count > 0 ? node->kids[0] : -1, node->kid_count > 1 ? node->kids[1] : -1, i);
+    }
+    fprintf(out, "};\n\nstatic const IselRule isel_rules[] = {\n");
+    for (int r = 0; r < rule_count; r++) {
+        Rule *rule = &rules[r];
+        fprintf(out, "    // %s\n    {ISEL_NT_", rule->text);
+        write_upper(out, nonterminals[rule->lhs]);
+        fprintf(out, ", %d, %d, ", rule->pattern, rule->leaves);
+        if (rule->predicate[0]) {
+            fprintf(out, "isel_pred_%s, ", rule->predicate);
+        } else {
+            fprintf(out, "NULL, ");
+        }
+        write_string(out, rule->code);
+        fprintf(out, ", ");
+        write_string(out, rule->result);
+        fprintf(out, "},\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Cost of each rule on each tier:");
+    for (int t = 0; t < tier_count; t++) fprintf(out, " %s", tiers[t]);
+    fprintf(out, "\nstatic const short isel_rule_costs[][ISEL_TIER_COUNT] = {\n");
+    for (int r = 0; r < rule_count; r++) {
+        fprintf(out, "    {");
+        for (int t = 0; t < tier_count; t++) fprintf(out, "%s%d", t ? ", " : "", rules[r].cost[t]);
+        fprintf(out, "},\n");
+    }
+    fprintf(out, "};\n\n");
+
+    // Rules by the terminal at the root of their pattern, in spec order
+    fprintf(out, "static const short isel_term_rules[] = {\n   ");
+    int start[MAX_SYMBOLS + 1];
+    int n = 0;
+    for (int t = 0; t < terminal_count; t++) {
+        start[t] = n;
+        for (int r = 0; r < rule_count; r++) {
+            PatternNode *root = &patterns[rules[r].pattern];
+            if (root->terminal && root->symbol == t) {
+                fprintf(out, " %d,", r);
+                n++;
+            }
+        }
+    }
+    start[terminal_count] = n;
+    fprintf(out, "\n};\n\nstatic const short isel_term_rules_start[ISEL_TERM_COUNT + 1] = {\n   ");
+    for (int t = 0; t <= terminal_count; t++) fprintf(out, " %d,", start[t]);
+
+    fprintf(out, "\n};\n\n// Rules whose pattern is a single nonterminal\nstatic const short isel_chain_rules[] = {\n   ");
+    n = 0;
+    for (int r = 0; r < rule_count; r++) {
+        if (!patterns[rules[r].pattern].terminal) {
+            fprintf(out, " %d,", r);
+            n++;
+        }
+    }
+    fprintf(out, "\n};\n#define ISEL_CHAIN_RULE_COUNT %d\n\n#endif // ISEL_RULES_H\n", n);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s SPEC HEADER\n", argv[0]);
+        return 1;
+    }
+    spec_name = argv[1];
+    FILE *in = fopen(spec_name, "r");
+    if (!in) {
+        perror(spec_name);
+        return 1;
+    }
+
+    char line[MAX_LINE];
+    while (fgets(line, sizeof(line), in)) {
+        line_number++;
+        char *comment = strchr(line, '#');
+        if (comment) *comment = '\0';
+        const char *p = skip_space(line);
+        if (*p == '\n' || *p == '\0' || *p == '\r') continue;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (strncmp(p, "%term", 5) == 0) {
+            p = skip_space(p + 5);
+            while (*p) {
+                if (terminal_count == MAX_SYMBOLS) fail("too many terminals");
+                Terminal *t = &terminals[terminal_count];
+                p = skip_space(read_name(p, t->name, sizeof(t->name)));
+                if (find_terminal(t->name) >= 0) fail("%s declared twice", t->name);
+                t->arity = -1;
+                terminal_count++;
+            }
+            continue;
+        }
+        if (strncmp(p, "%tiers", 6) == 0) {
+            if (rule_count || cost_count) fail("%%tiers must come before costs and rules");
+            p = skip_space(p + 6);
+            for (tier_count = 0; *p; tier_count++) {
+                if (tier_count == MAX_TIERS) fail("too many tiers");
+                size_t n = strcspn(p, " \t");
+                if (n >= sizeof(tiers[0])) fail("tier name too long");
+                memcpy(tiers[tier_count], p, n);
+                tiers[tier_count][n] = '\0';
+                p = skip_space(p + n);
+            }
+            if (tier_count == 0) fail("%%tiers needs at least one tier");
+            continue;
+        }
+        if (strncmp(p, "%cost", 5) == 0) {
+            if (cost_count == MAX_SYMBOLS) fail("too many costs");
+            NamedCost *cost = &costs[cost_count];
+            p = skip_space(read_name(skip_space(p + 5), cost->name, sizeof(cost->name)));
+            for (int t = 0; t < tier_count; t++) {
+                char *end;
+                cost->cost[t] = (int)strtol(p, &end, 10);
+                if (end == p || cost->cost[t] < 0) fail("%s needs a cost for each of %d tiers", cost->name, tier_count);
+                p = skip_space(end);
+            }
+            if (*p) fail("%s has more costs than tiers", cost->name);
+            cost_count++;
+            continue;
+        }
+        if (terminal_count == 0) fail("rules must follow %%term");
+        parse_rule(p);
+    }
+    fclose(in);
+
+    for (int i = 0; i < nonterminal_count; i++) {
+        bool derived = false;
+        for (int r = 0; r < rule_count && !derived; r++) derived = rules[r].lhs == i;
+        if (!derived) {
+            line_number = used_line[i];
+            fail("no rule derives %s", nonterminals[i]);
+        }
+    }
+    int registers[MAX_SYMBOLS];
+    count_registers(registers);
+
+    FILE *out = fopen(argv[2], "w");
+    if (!out) {
+        perror(argv[2]);
+        return 1;
+    }
+    write_header(out);
+    return fclose(out) == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,520 @@
+// Write a random, well-formed C program for the compiler's self checks:
+// globals, local and global arrays, loops, switches, early returns, calls
+// and casts between every integer type. The same seed always gives the
+// same program. Usage: progen SEED
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define MAX_VARS 32
+#define MAX_FUNCS 16
+#define MAX_LOOPS 8
+#define MAX_CASES 8
+#define NAME_SIZE 16
+
+static const char *types[] = {
+    "char", "unsigned char", "short", "unsigned short",
+    "int", "unsigned int", "long", "unsigned long",
+};
+#define TYPE_COUNT 8
+#define TYPE_SHORT 2
+#define TYPE_INT 4
+
+typedef struct {
+    char name[NAME_SIZE];
+    int type;
+    int length;               // Of an array
+} Var;
+
+typedef struct {
+    char name[NAME_SIZE];
+    int param_count;
+} Func;
+
+static unsigned long state;
+
+// Variables and arrays in scope, the globals first
+static Var vars[MAX_VARS];
+static int var_count;
+static int global_count;
+static Var arrays[MAX_VARS];
+static int array_count;
+static int global_array_count;
+static bool globals_read_only;    // Only main and the writers change globals
+
+static Func funcs[MAX_FUNCS];
+static int func_count;
+static Func writers[MAX_FUNCS];
+static int writer_count;
+
+// Variables counting the enclosing loops, which the body leaves alone
+static struct {
+    int var;
+    int bound;
+} loops[MAX_LOOPS];
+static int loop_count;
+
+static int next_int(int n) {
+    state = state * 6364136223846793005UL + 1442695040888963407UL;
+    return (int)((state >> 33) % (unsigned long)n);
+}
+
+static int between(int low, int high) {
+    return low + next_int(high - low + 1);
+}
+
+static void indent(int depth) {
+    for (int i = 0; i < depth; i++) fputs("    ", stdout);
+}
+
+static bool is_loop_var(int var) {
+    for (int i = 0; i < loop_count; i++) {
+        if (loops[i].var == var) return true;
+    }
+    return false;
+}
+
+static bool assignable(int var) {
+    return !is_loop_var(var) && !(var < global_count && globals_read_only);
+}
+
+// A variable the statement may assign, or -1
+static int pick_assignable(void) {
+    int candidates[MAX_VARS];
+    int count = 0;
+    for (int v = 0; v < var_count; v++) {
+        if (assignable(v)) candidates[count++] = v;
+    }
+    return count ? candidates[next_int(count)] : -1;
+}
+
+static int pick_writable_array(void) {
+    int first = globals_read_only ? global_array_count : 0;
+    return array_count > first ? between(first, array_count - 1) : -1;
+}
+
+static void literal(void) {
+    static const char *edges[] = {
+        "127", "128", "255", "256", "32767", "65535", "65536", "2147483647", "4294967295", "1000000007",
+    };
+    static const char *suffixes[] = {"u", "l", "ul", "L", "U"};
+    int c = next_int(10);
+    if (c < 5) {
+        printf("%d", next_int(11));
+    } else if (c < 8) {
+        printf("%d", next_int(1001));
+    } else if (c < 9) {
+        fputs(edges[next_int(10)], stdout);
+    } else {
+        printf("%lu", state >> 24);
+    }
+    if (next_int(10) == 0) fputs(suffixes[next_int(5)], stdout);
+}
+
+static void expression(int depth);
+
+static void factor(int depth) {
+    putchar('(');
+    expression(depth);
+    putchar(')');
+}
+
+static void call_arguments(const Func *func, int depth) {
+    printf("%s(", func->name);
+    for (int i = 0; i < func->param_count; i++) {
+        if (i > 0) fputs(", ", stdout);
+        expression(depth);
+    }
+    putchar(')');
+}
+
+static void expression(int depth) {
+    static const char *operators[] = {
+        "+", "-", "*", "+", "-", "<", ">", "<=", ">=", "==", "!=", "&&", "||",
+    };
+    static const char *divisors[] = {
+        "1", "2", "3", "4", "7", "8", "10", "16", "100", "3u", "5l", "1024", "13ul",
+    };
+
+    if (depth <= 0 || next_int(4) == 0) {
+        int c = next_int(20);
+        if (c < 9 && var_count > 0) {
+            fputs(vars[next_int(var_count)].name, stdout);
+        } else if (c < 11 && array_count > 0) {
+            const Var *array = &arrays[next_int(array_count)];
+            printf("%s[%d]", array->name, next_int(array->length));
+        } else {
+            literal();
+        }
+        return;
+    }
+
+    int c = next_int(100);
+    if (c < 45) {
+        putchar('(');
+        expression(depth - 1);
+        printf(" %s ", operators[next_int(13)]);
+        expression(depth - 1);
+        putchar(')');
+    } else if (c < 55) {
+        putchar('(');
+        expression(depth - 1);
+        if (var_count > 0 && next_int(2)) {
+            const char *name = vars[next_int(var_count)].name;
+            printf(" / (%s * %s + 1))", name, name);
+        } else {
+            printf(" / %s)", divisors[next_int(13)]);
+        }
+    } else if (c < 65) {
+        printf("(%s)", types[next_int(TYPE_COUNT)]);
+        factor(depth - 1);
+    } else if (c < 72) {
+        putchar('!');
+        factor(depth - 1);
+    } else if (c < 78) {
+        putchar('-');
+        factor(depth - 1);
+    } else if (c < 90 && func_count > 0) {
+        call_arguments(&funcs[next_int(func_count)], depth - 2);
+    } else {
+        expression(depth - 1);
+    }
+}
+
+static void statements(int depth, int count, int level, bool in_loop, bool returns);
+
+static void block(int depth, int count, int level, bool in_loop, bool returns) {
+    statements(depth, count, level + 1, in_loop, returns);
+    indent(level);
+}
+
+static void array_store(int level) {
+    const Var *array = &arrays[pick_writable_array()];
+    int fitting[MAX_LOOPS];
+    int fitting_count = 0;
+    for (int i = 0; i < loop_count; i++) {
+        if (loops[i].bound <= array->length) fitting[fitting_count++] = loops[i].var;
+    }
+
+    indent(level);
+    if (fitting_count > 0 && next_int(10) < 6) {
+        printf("%s[%s] = ", array->name, vars[fitting[next_int(fitting_count)]].name);
+        expression(2);
+        puts(";");
+    } else if (var_count > 0 && next_int(2)) {
+        const char *index = vars[next_int(var_count)].name;
+        printf("if (%s >= 0 && %s < %d) { %s[%s] = ", index, index, array->length, array->name, index);
+        expression(2);
+        puts("; }");
+    } else {
+        printf("%s[%d] = ", array->name, next_int(array->length));
+        expression(2);
+        puts(";");
+    }
+}
+
+// The types loop counters are given
+static bool countable(int type) {
+    return type == TYPE_SHORT || type >= TYPE_INT;
+}
+
+static void loop(int depth, int level, bool returns) {
+    static const int bounds[] = {3, 4, 5, 8, 16, 17, 33, 100};
+    int candidates[MAX_VARS];
+    int count = 0;
+    // Not a global, which a writer called in the body could change
+    for (int v = global_count; v < var_count; v++) {
+        if (assignable(v) && countable(vars[v].type)) {
+            candidates[count++] = v;
+        }
+    }
+    if (count == 0 || loop_count == MAX_LOOPS) return;
+
+    int var = candidates[next_int(count)];
+    int bound = bounds[next_int(8)];
+    const char *name = vars[var].name;
+    loops[loop_count].var = var;
+    loops[loop_count].bound = bound;
+    loop_count++;
+
+    indent(level);
+    if (next_int(10) < 6) {
+        static const int starts[] = {0, 0, 1, 2};
+        printf("for (%s = %d; %s < %d; %s = %s + 1) {\n", name, starts[next_int(4)], name, bound, name, name);
+        block(depth - 1, between(1, 3), level, true, returns);
+        puts("}");
+    } else {
+        printf("%s = 0;\n", name);
+        indent(level);
+        printf("while (%s < %d) {\n", name, bound);
+        statements(depth - 1, between(1, 3), level + 1, true, returns);
+        indent(level + 1);
+        printf("%s = %s + 1;\n", name, name);
+        indent(level);
+        puts("}");
+    }
+    loop_count--;
+}
+
+static void switch_statement(int depth, int level, bool in_loop, bool returns) {
+    int values[MAX_CASES + 1];
+    int count = 0;
+    bool dense = next_int(2);
+    for (int n = between(1, MAX_CASES); n > 0; n--) {
+        int value;
+        if (dense) {
+            value = next_int(11);
+        } else {
+            int c = next_int(3);
+            value = c == 0 ? between(-5, 5) : c == 1 ? next_int(1001) : next_int(71);
+        }
+        bool seen = false;
+        for (int i = 0; i < count; i++) seen |= values[i] == value;
+        if (!seen) values[count++] = value;
+    }
+    bool has_default = next_int(10) < 7;
+    int labels = count + has_default;
+    int default_at = has_default ? next_int(labels) : -1;
+
+    indent(level);
+    fputs("switch (", stdout);
+    expression(2);
+    puts(") {");
+    for (int i = 0, value = 0; i < labels; i++) {
+        indent(level);
+        if (i == default_at) {
+            puts("default:");
+        } else {
+            printf("case %d:\n", values[value++]);
+        }
+        statements(depth - 1, next_int(3), level + 1, in_loop, returns);
+        if (next_int(10) < 7) {
+            indent(level + 1);
+            puts("break;");
+        }
+    }
+    indent(level);
+    puts("}");
+}
+
+// Keep the smallest element seen by the enclosing loop
+static void minimum(int level) {
+    int var = pick_assignable();
+    if (var < 0 || array_count == 0 || loop_count == 0) return;
+    const Var *array = &arrays[next_int(array_count)];
+    int loop = next_int(loop_count);
+    if (loops[loop].bound > array->length) return;
+
+    const char *index = vars[loops[loop].var].name;
+    indent(level);
+    printf("if (%s[%s] < %s) { %s = %s[%s]; }\n", array->name, index, vars[var].name, vars[var].name,
+           array->name, index);
+}
+
+static void statements(int depth, int count, int level, bool in_loop, bool returns) {
+    for (int n = 0; n < count; n++) {
+        int c = next_int(100);
+        int var = pick_assignable();
+        if (c < 35 && var >= 0) {
+            indent(level);
+            printf("%s = ", vars[var].name);
+            expression(3);
+            puts(";");
+        } else if (c < 45 && pick_writable_array() >= 0) {
+            array_store(level);
+        } else if (c < 60 && depth > 0) {
+            indent(level);
+            fputs("if (", stdout);
+            expression(3);
+            puts(") {");
+            block(depth - 1, between(1, 3), level, in_loop, returns);
+            if (next_int(2)) {
+                puts("} else {");
+                block(depth - 1, between(1, 3), level, in_loop, returns);
+            }
+            puts("}");
+        } else if (c < 72 && depth > 0) {
+            loop(depth, level, returns);
+        } else if (c < 80 && depth > 0) {
+            switch_statement(depth, level, in_loop, returns);
+        } else if (c < 85 && in_loop) {
+            indent(level);
+            fputs("if (", stdout);
+            expression(2);
+            puts(") { break; }");
+        } else if (c < 87 && writer_count > 0 && !globals_read_only) {
+            indent(level);
+            call_arguments(&writers[next_int(writer_count)], 0);
+            puts(";");
+        } else if (c < 88 && in_loop) {
+            minimum(level);
+        } else if (c < 90 && func_count > 0) {
+            indent(level);
+            call_arguments(&funcs[next_int(func_count)], 1);
+            puts(";");
+        } else if (c < 93 && returns) {
+            indent(level);
+            fputs("if (", stdout);
+            expression(2);
+            fputs(") { return ", stdout);
+            expression(2);
+            puts("; }");
+        } else if (var >= 0) {
+            indent(level);
+            printf("%s = %s + ", vars[var].name, vars[var].name);
+            expression(2);
+            puts(";");
+        }
+    }
+}
+
+static void add_var(const char *prefix, int number, int type) {
+    Var *var = &vars[var_count++];
+    snprintf(var->name, sizeof(var->name), "%s%d", prefix, number);
+    var->type = type;
+    var->length = 0;
+}
+
+static void add_array(const char *prefix, int number) {
+    static const int lengths[] = {4, 8, 16, 33};
+    Var *array = &arrays[array_count++];
+    snprintf(array->name, sizeof(array->name), "%s%d", prefix, number);
+    array->type = TYPE_INT;
+    array->length = lengths[next_int(4)];
+}
+
+static void function(const char *name, bool is_main) {
+    var_count = global_count;
+    array_count = global_array_count;
+    globals_read_only = !is_main;
+
+    int param_count = is_main ? 0 : between(0, 8);
+    int return_type = is_main ? TYPE_INT : next_int(TYPE_COUNT);
+    printf("%s %s(", types[return_type], name);
+    for (int i = 0; i < param_count; i++) {
+        add_var("p", i, next_int(TYPE_COUNT));
+        printf("%s%s %s", i > 0 ? ", " : "", types[vars[var_count - 1].type], vars[var_count - 1].name);
+    }
+    puts(") {");
+
+    int first_local = var_count;
+    for (int i = between(2, 6); i > 0; i--) add_var("v", var_count - first_local, next_int(TYPE_COUNT));
+    add_var("i", 0, TYPE_INT);
+    add_var("j", 0, TYPE_INT + 2);
+    for (int v = first_local; v < var_count; v++) {
+        printf("    %s %s = ", types[vars[v].type], vars[v].name);
+        literal();
+        puts(";");
+    }
+    int first_array = array_count;
+    for (int i = between(0, 2); i > 0; i--) {
+        add_array("la", array_count - first_array);
+        const Var *array = &arrays[array_count - 1];
+        printf("    int %s[%d];\n", array->name, array->length);
+        printf("    for (i0 = 0; i0 < %d; i0 = i0 + 1) { %s[i0] = i0 * ", array->length, array->name);
+        literal();
+        puts("; }");
+    }
+
+    statements(3, between(3, 8), 1, false, true);
+
+    if (is_main) {
+        puts("    long h = 0;");
+        for (int v = 0; v < var_count; v++) {
+            if (v < global_count || v >= first_local) printf("    h = h * 31 + %s;\n", vars[v].name);
+        }
+        for (int a = 0; a < array_count; a++) {
+            printf("    for (i0 = 0; i0 < %d; i0 = i0 + 1) { h = h * 7 + %s[i0]; }\n", arrays[a].length,
+                   arrays[a].name);
+        }
+        puts("    h = h + h / 256 + h / 65536 + h / 16777216 + h / 4294967296 + h / 1099511627776;");
+        puts("    return h;");
+    } else {
+        fputs("    return ", stdout);
+        expression(3);
+        puts(";");
+    }
+    puts("}");
+
+    Func *func = &funcs[func_count++];
+    snprintf(func->name, sizeof(func->name), "%s", name);
+    func->param_count = param_count;
+}
+
+// A function that changes globals, called from main only
+static void writer(int number) {
+    Func *func = &writers[writer_count++];
+    snprintf(func->name, sizeof(func->name), "w%d", number);
+    func->param_count = between(1, 3);
+
+    printf("void %s(", func->name);
+    for (int i = 0; i < func->param_count; i++) {
+        printf("%s%s q%d", i > 0 ? ", " : "", types[next_int(TYPE_COUNT)], i);
+    }
+    puts(") {");
+    for (int n = between(1, 3); n > 0; n--) {
+        int param = next_int(func->param_count);
+        if (global_array_count > 0 && next_int(10) < 4) {
+            const Var *array = &arrays[next_int(global_array_count)];
+            printf("    %s[%d] = %s[%d] + q%d;\n", array->name, next_int(array->length), array->name,
+                   next_int(array->length), param);
+        } else {
+            const char *name = vars[next_int(global_count)].name;
+            printf("    %s = %s * 3 + q%d;\n", name, name, param);
+        }
+    }
+    puts("}");
+}
+
+// Bounded recursion, in tail position or not
+static void recursive(void) {
+    static const int rec_types[] = {TYPE_INT, TYPE_INT + 2, TYPE_INT + 1};
+    const char *type = types[rec_types[next_int(3)]];
+    printf("%s rec(%s n, %s acc) {\n", type, type, type);
+    printf("    if (n < %d || n > 18) { return acc + n; }\n", between(2, 5));
+    if (next_int(2)) {
+        printf("    return rec(n - %d, acc * 3 + n);\n", between(1, 3));
+    } else {
+        printf("    return rec(n - 1, acc + 1) + rec(n - %d, acc);\n", between(2, 4));
+    }
+    puts("}");
+
+    Func *func = &funcs[func_count++];
+    snprintf(func->name, sizeof(func->name), "rec");
+    func->param_count = 2;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s SEED\n", argv[0]);
+        return 1;
+    }
+    state = strtoul(argv[1], NULL, 10);
+    next_int(2);
+
+    for (int i = between(0, 3); i > 0; i--) {
+        add_var("g", global_count, next_int(TYPE_COUNT));
+        printf("%s %s", types[vars[global_count].type], vars[global_count].name);
+        if (next_int(2)) {
+            fputs(" = ", stdout);
+            literal();
+        }
+        puts(";");
+        global_count++;
+    }
+    for (int i = between(0, 2); i > 0; i--) {
+        add_array("ga", global_array_count);
+        printf("int %s[%d];\n", arrays[global_array_count].name, arrays[global_array_count].length);
+        global_array_count++;
+    }
+
+    for (int i = between(0, 4), n = 0; n < i; n++) {
+        char name[NAME_SIZE];
+        snprintf(name, sizeof(name), "f%d", n);
+        function(name, false);
+        if (global_count > 0 && next_int(2)) writer(n);
+    }
+    if (next_int(2)) recursive();
+    function("main", true);
+    return 0;
+}